@@ -90,6 +90,12 @@ if %errorlevel% neq 0 goto :error
 call :test enumswitch.c
 if %errorlevel% neq 0 goto :error
 
+call :test switchtabletest.c
+if %errorlevel% neq 0 goto :error
+
+call :test zeropagetest.c
+if %errorlevel% neq 0 goto :error
+
 call :test incvector.c
 if %errorlevel% neq 0 goto :error
 
@@ -108,6 +114,39 @@ if %errorlevel% neq 0 goto :error
 call :test randsumtest.c
 if %errorlevel% neq 0 goto :error
 
+call :test sourcelinetest.c
+if %errorlevel% neq 0 goto :error
+
+call :test sccptest.c
+if %errorlevel% neq 0 goto :error
+
+call :test licmtest.c
+if %errorlevel% neq 0 goto :error
+
+call :test ivtest.c
+if %errorlevel% neq 0 goto :error
+
+call :test rangetest.c
+if %errorlevel% neq 0 goto :error
+
+call :test staticframetest.c
+if %errorlevel% neq 0 goto :error
+
+call :test lazyparsetest.c
+if %errorlevel% neq 0 goto :error
+
+call :testo lazyparsetest.c -lazy-parse
+if %errorlevel% neq 0 goto :error
+
+call :test boolcmptest.c
+if %errorlevel% neq 0 goto :error
+
+call :testo inlinetest.c -O1
+if %errorlevel% neq 0 goto :error
+
+call :testo inlinetest.c "-O0 -O1"
+if %errorlevel% neq 0 goto :error
+
 exit /b 0
 
 :error
@@ -155,3 +194,12 @@ if %errorlevel% neq 0 goto :error
 if %errorlevel% neq 0 goto :error
 
 exit /b 0
+
+:testo
+..\release\oscar64 -e %~2 %~1
+if %errorlevel% neq 0 goto :error
+
+..\release\oscar64 -e -n %~2 %~1
+if %errorlevel% neq 0 goto :error
+
+exit /b 0
@@ -0,0 +1,496 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e a3 0c STX $0ca3 ; (spentry + 0)
+0811 : a9 a4 __ LDA #$a4
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0c __ LDA #$0c
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0c __ LDA #$0c
+081c : e9 0c __ SBC #$0c
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ac __ LDA #$ac
+0832 : e9 a4 __ SBC #$a4
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 96 0c JMP $0c96 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 03 __ SBC #$03
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 48 __ STA T0 + 0
+0911 : 85 49 __ STA T0 + 1
+0913 : a5 48 __ LDA T0 + 0
+0915 : 29 01 __ AND #$01
+0917 : f0 03 __ BEQ $091c
+0919 : 4c 01 0c JMP $0c01 ; (main + 769)
+091c : a9 00 __ LDA #$00
+091e : a4 48 __ LDY T0 + 0
+0920 : 99 a4 0c STA $0ca4,y ; (flags + 0)
+0923 : e6 48 __ INC T0 + 0
+0925 : d0 02 __ BNE $0929
+0927 : e6 49 __ INC T0 + 1
+0929 : a5 49 __ LDA T0 + 1
+092b : 30 e6 __ BMI $0913
+092d : d0 06 __ BNE $0935
+092f : a5 48 __ LDA T0 + 0
+0931 : c9 08 __ CMP #$08
+0933 : 90 de __ BCC $0913
+0935 : a9 00 __ LDA #$00
+0937 : 85 48 __ STA T0 + 0
+0939 : 85 49 __ STA T0 + 1
+093b : a5 48 __ LDA T0 + 0
+093d : 85 0d __ STA P0
+093f : a5 49 __ LDA T0 + 1
+0941 : 85 0e __ STA P1
+0943 : 20 2b 0c JSR $0c2b ; (isset + 0)
+0946 : a5 48 __ LDA T0 + 0
+0948 : 29 01 __ AND #$01
+094a : f0 03 __ BEQ $094f
+094c : 4c fc 0b JMP $0bfc ; (main + 764)
+094f : a9 00 __ LDA #$00
+0951 : 85 4b __ STA T3 + 0
+0953 : a5 1b __ LDA ACCU + 0
+0955 : c5 4b __ CMP T3 + 0
+0957 : d0 03 __ BNE $095c
+0959 : 4c f7 0b JMP $0bf7 ; (main + 759)
+095c : a9 00 __ LDA #$00
+095e : a0 02 __ LDY #$02
+0960 : 91 23 __ STA (SP + 0),y
+0962 : 20 06 0c JSR $0c06 ; (assert + 0)
+0965 : a5 48 __ LDA T0 + 0
+0967 : 85 0d __ STA P0
+0969 : a5 49 __ LDA T0 + 1
+096b : 85 0e __ STA P1
+096d : 20 2b 0c JSR $0c2b ; (isset + 0)
+0970 : a5 1b __ LDA ACCU + 0
+0972 : 05 4b __ ORA T3 + 0
+0974 : d0 03 __ BNE $0979
+0976 : 4c f2 0b JMP $0bf2 ; (main + 754)
+0979 : a9 00 __ LDA #$00
+097b : 85 4a __ STA T2 + 0
+097d : a5 48 __ LDA T0 + 0
+097f : 29 01 __ AND #$01
+0981 : d0 03 __ BNE $0986
+0983 : 4c ed 0b JMP $0bed ; (main + 749)
+0986 : a9 00 __ LDA #$00
+0988 : 85 4b __ STA T3 + 0
+098a : a5 4a __ LDA T2 + 0
+098c : c5 4b __ CMP T3 + 0
+098e : d0 03 __ BNE $0993
+0990 : 4c e8 0b JMP $0be8 ; (main + 744)
+0993 : a9 00 __ LDA #$00
+0995 : a0 02 __ LDY #$02
+0997 : 91 23 __ STA (SP + 0),y
+0999 : 20 06 0c JSR $0c06 ; (assert + 0)
+099c : a5 48 __ LDA T0 + 0
+099e : 85 0d __ STA P0
+09a0 : a5 49 __ LDA T0 + 1
+09a2 : 85 0e __ STA P1
+09a4 : 20 35 0c JSR $0c35 ; (isclear + 0)
+09a7 : a5 1b __ LDA ACCU + 0
+09a9 : 85 4a __ STA T2 + 0
+09ab : a5 48 __ LDA T0 + 0
+09ad : 85 0d __ STA P0
+09af : a5 49 __ LDA T0 + 1
+09b1 : 85 0e __ STA P1
+09b3 : 20 2b 0c JSR $0c2b ; (isset + 0)
+09b6 : a5 4a __ LDA T2 + 0
+09b8 : c5 1b __ CMP ACCU + 0
+09ba : d0 03 __ BNE $09bf
+09bc : 4c e3 0b JMP $0be3 ; (main + 739)
+09bf : a9 01 __ LDA #$01
+09c1 : a0 02 __ LDY #$02
+09c3 : 91 23 __ STA (SP + 0),y
+09c5 : 20 06 0c JSR $0c06 ; (assert + 0)
+09c8 : a5 48 __ LDA T0 + 0
+09ca : 85 0d __ STA P0
+09cc : a5 49 __ LDA T0 + 1
+09ce : 85 0e __ STA P1
+09d0 : 20 2b 0c JSR $0c2b ; (isset + 0)
+09d3 : a5 1b __ LDA ACCU + 0
+09d5 : f0 03 __ BEQ $09da
+09d7 : 4c dc 0b JMP $0bdc ; (main + 732)
+09da : a5 48 __ LDA T0 + 0
+09dc : 29 01 __ AND #$01
+09de : d0 03 __ BNE $09e3
+09e0 : 4c d7 0b JMP $0bd7 ; (main + 727)
+09e3 : a9 00 __ LDA #$00
+09e5 : a0 02 __ LDY #$02
+09e7 : 91 23 __ STA (SP + 0),y
+09e9 : 20 06 0c JSR $0c06 ; (assert + 0)
+09ec : e6 48 __ INC T0 + 0
+09ee : d0 02 __ BNE $09f2
+09f0 : e6 49 __ INC T0 + 1
+09f2 : a5 49 __ LDA T0 + 1
+09f4 : 10 03 __ BPL $09f9
+09f6 : 4c 3b 09 JMP $093b ; (main + 59)
+09f9 : d0 09 __ BNE $0a04
+09fb : a5 48 __ LDA T0 + 0
+09fd : c9 08 __ CMP #$08
+09ff : b0 03 __ BCS $0a04
+0a01 : 4c 3b 09 JMP $093b ; (main + 59)
+0a04 : a9 00 __ LDA #$00
+0a06 : 85 0d __ STA P0
+0a08 : 85 0e __ STA P1
+0a0a : 20 4c 0c JSR $0c4c ; (compare + 0)
+0a0d : a5 1c __ LDA ACCU + 1
+0a0f : d0 09 __ BNE $0a1a
+0a11 : a5 1b __ LDA ACCU + 0
+0a13 : c9 29 __ CMP #$29
+0a15 : d0 03 __ BNE $0a1a
+0a17 : 4c d2 0b JMP $0bd2 ; (main + 722)
+0a1a : a9 00 __ LDA #$00
+0a1c : a0 02 __ LDY #$02
+0a1e : 91 23 __ STA (SP + 0),y
+0a20 : 20 06 0c JSR $0c06 ; (assert + 0)
+0a23 : a9 00 __ LDA #$00
+0a25 : 85 0d __ STA P0
+0a27 : a9 01 __ LDA #$01
+0a29 : 85 0e __ STA P1
+0a2b : 20 4c 0c JSR $0c4c ; (compare + 0)
+0a2e : a5 1c __ LDA ACCU + 1
+0a30 : d0 09 __ BNE $0a3b
+0a32 : a5 1b __ LDA ACCU + 0
+0a34 : c9 0e __ CMP #$0e
+0a36 : d0 03 __ BNE $0a3b
+0a38 : 4c cd 0b JMP $0bcd ; (main + 717)
+0a3b : a9 00 __ LDA #$00
+0a3d : a0 02 __ LDY #$02
+0a3f : 91 23 __ STA (SP + 0),y
+0a41 : 20 06 0c JSR $0c06 ; (assert + 0)
+0a44 : a9 01 __ LDA #$01
+0a46 : 85 0d __ STA P0
+0a48 : a9 00 __ LDA #$00
+0a4a : 85 0e __ STA P1
+0a4c : 20 4c 0c JSR $0c4c ; (compare + 0)
+0a4f : a5 1c __ LDA ACCU + 1
+0a51 : d0 09 __ BNE $0a5c
+0a53 : a5 1b __ LDA ACCU + 0
+0a55 : c9 32 __ CMP #$32
+0a57 : d0 03 __ BNE $0a5c
+0a59 : 4c c8 0b JMP $0bc8 ; (main + 712)
+0a5c : a9 00 __ LDA #$00
+0a5e : a0 02 __ LDY #$02
+0a60 : 91 23 __ STA (SP + 0),y
+0a62 : 20 06 0c JSR $0c06 ; (assert + 0)
+0a65 : a9 01 __ LDA #$01
+0a67 : 85 0d __ STA P0
+0a69 : 85 0e __ STA P1
+0a6b : 20 4c 0c JSR $0c4c ; (compare + 0)
+0a6e : a5 1c __ LDA ACCU + 1
+0a70 : d0 09 __ BNE $0a7b
+0a72 : a5 1b __ LDA ACCU + 0
+0a74 : c9 29 __ CMP #$29
+0a76 : d0 03 __ BNE $0a7b
+0a78 : 4c c3 0b JMP $0bc3 ; (main + 707)
+0a7b : a9 00 __ LDA #$00
+0a7d : a0 02 __ LDY #$02
+0a7f : 91 23 __ STA (SP + 0),y
+0a81 : 20 06 0c JSR $0c06 ; (assert + 0)
+0a84 : a9 00 __ LDA #$00
+0a86 : 85 0d __ STA P0
+0a88 : 85 0e __ STA P1
+0a8a : 20 2b 0c JSR $0c2b ; (isset + 0)
+0a8d : a5 1b __ LDA ACCU + 0
+0a8f : 85 4a __ STA T2 + 0
+0a91 : a9 01 __ LDA #$01
+0a93 : 85 0d __ STA P0
+0a95 : a9 00 __ LDA #$00
+0a97 : 85 0e __ STA P1
+0a99 : 20 2b 0c JSR $0c2b ; (isset + 0)
+0a9c : a5 4a __ LDA T2 + 0
+0a9e : 85 0d __ STA P0
+0aa0 : a5 1b __ LDA ACCU + 0
+0aa2 : 85 0e __ STA P1
+0aa4 : 20 4c 0c JSR $0c4c ; (compare + 0)
+0aa7 : a5 1c __ LDA ACCU + 1
+0aa9 : d0 09 __ BNE $0ab4
+0aab : a5 1b __ LDA ACCU + 0
+0aad : c9 0e __ CMP #$0e
+0aaf : d0 03 __ BNE $0ab4
+0ab1 : 4c be 0b JMP $0bbe ; (main + 702)
+0ab4 : a9 00 __ LDA #$00
+0ab6 : a0 02 __ LDY #$02
+0ab8 : 91 23 __ STA (SP + 0),y
+0aba : 20 06 0c JSR $0c06 ; (assert + 0)
+0abd : a9 03 __ LDA #$03
+0abf : 85 0d __ STA P0
+0ac1 : a9 00 __ LDA #$00
+0ac3 : 85 0e __ STA P1
+0ac5 : 20 2b 0c JSR $0c2b ; (isset + 0)
+0ac8 : a5 1b __ LDA ACCU + 0
+0aca : 85 4a __ STA T2 + 0
+0acc : a9 03 __ LDA #$03
+0ace : 85 0d __ STA P0
+0ad0 : a9 00 __ LDA #$00
+0ad2 : 85 0e __ STA P1
+0ad4 : 20 35 0c JSR $0c35 ; (isclear + 0)
+0ad7 : a5 4a __ LDA T2 + 0
+0ad9 : 85 0d __ STA P0
+0adb : a5 1b __ LDA ACCU + 0
+0add : 85 0e __ STA P1
+0adf : 20 4c 0c JSR $0c4c ; (compare + 0)
+0ae2 : a5 1c __ LDA ACCU + 1
+0ae4 : d0 09 __ BNE $0aef
+0ae6 : a5 1b __ LDA ACCU + 0
+0ae8 : c9 32 __ CMP #$32
+0aea : d0 03 __ BNE $0aef
+0aec : 4c b9 0b JMP $0bb9 ; (main + 697)
+0aef : a9 00 __ LDA #$00
+0af1 : a0 02 __ LDY #$02
+0af3 : 91 23 __ STA (SP + 0),y
+0af5 : 20 06 0c JSR $0c06 ; (assert + 0)
+0af8 : a9 02 __ LDA #$02
+0afa : 85 0d __ STA P0
+0afc : a9 00 __ LDA #$00
+0afe : 85 0e __ STA P1
+0b00 : 20 35 0c JSR $0c35 ; (isclear + 0)
+0b03 : a5 1b __ LDA ACCU + 0
+0b05 : 85 4a __ STA T2 + 0
+0b07 : a9 05 __ LDA #$05
+0b09 : 85 0d __ STA P0
+0b0b : a9 00 __ LDA #$00
+0b0d : 85 0e __ STA P1
+0b0f : 20 2b 0c JSR $0c2b ; (isset + 0)
+0b12 : a5 1b __ LDA ACCU + 0
+0b14 : 85 0e __ STA P1
+0b16 : 85 4b __ STA T3 + 0
+0b18 : a5 4a __ LDA T2 + 0
+0b1a : 85 0d __ STA P0
+0b1c : 20 4c 0c JSR $0c4c ; (compare + 0)
+0b1f : a5 1c __ LDA ACCU + 1
+0b21 : d0 09 __ BNE $0b2c
+0b23 : a5 1b __ LDA ACCU + 0
+0b25 : c9 29 __ CMP #$29
+0b27 : d0 03 __ BNE $0b2c
+0b29 : 4c b4 0b JMP $0bb4 ; (main + 692)
+0b2c : a9 00 __ LDA #$00
+0b2e : a0 02 __ LDY #$02
+0b30 : 91 23 __ STA (SP + 0),y
+0b32 : 20 06 0c JSR $0c06 ; (assert + 0)
+0b35 : a5 4a __ LDA T2 + 0
+0b37 : c5 4b __ CMP T3 + 0
+0b39 : 90 74 __ BCC $0baf
+0b3b : a9 00 __ LDA #$00
+0b3d : 09 00 __ ORA #$00
+0b3f : f0 58 __ BEQ $0b99
+0b41 : a9 00 __ LDA #$00
+0b43 : a0 02 __ LDY #$02
+0b45 : 91 23 __ STA (SP + 0),y
+0b47 : 20 06 0c JSR $0c06 ; (assert + 0)
+0b4a : a9 04 __ LDA #$04
+0b4c : 85 0d __ STA P0
+0b4e : a9 00 __ LDA #$00
+0b50 : 85 0e __ STA P1
+0b52 : 20 2b 0c JSR $0c2b ; (isset + 0)
+0b55 : a5 1b __ LDA ACCU + 0
+0b57 : c5 4a __ CMP T2 + 0
+0b59 : 90 39 __ BCC $0b94
+0b5b : a9 00 __ LDA #$00
+0b5d : c9 01 __ CMP #$01
+0b5f : f0 1d __ BEQ $0b7e
+0b61 : a9 00 __ LDA #$00
+0b63 : a0 02 __ LDY #$02
+0b65 : 91 23 __ STA (SP + 0),y
+0b67 : 20 06 0c JSR $0c06 ; (assert + 0)
+0b6a : a9 00 __ LDA #$00
+0b6c : 85 1b __ STA ACCU + 0
+0b6e : 85 1c __ STA ACCU + 1
+0b70 : 18 __ __ CLC
+0b71 : a5 23 __ LDA SP + 0
+0b73 : 69 03 __ ADC #$03
+0b75 : 85 23 __ STA SP + 0
+0b77 : a5 24 __ LDA SP + 1
+0b79 : 69 00 __ ADC #$00
+0b7b : 85 24 __ STA SP + 1
+0b7d : 60 __ __ RTS
+0b7e : a5 1b __ LDA ACCU + 0
+0b80 : c5 4a __ CMP T2 + 0
+0b82 : 90 0b __ BCC $0b8f
+0b84 : a9 01 __ LDA #$01
+0b86 : 09 00 __ ORA #$00
+0b88 : d0 d7 __ BNE $0b61
+0b8a : a9 01 __ LDA #$01
+0b8c : 4c 63 0b JMP $0b63 ; (main + 611)
+0b8f : a9 00 __ LDA #$00
+0b91 : 4c 86 0b JMP $0b86 ; (main + 646)
+0b94 : a9 01 __ LDA #$01
+0b96 : 4c 5d 0b JMP $0b5d ; (main + 605)
+0b99 : a5 4a __ LDA T2 + 0
+0b9b : c5 4b __ CMP T3 + 0
+0b9d : 90 0b __ BCC $0baa
+0b9f : a9 01 __ LDA #$01
+0ba1 : c9 01 __ CMP #$01
+0ba3 : d0 9c __ BNE $0b41
+0ba5 : a9 01 __ LDA #$01
+0ba7 : 4c 43 0b JMP $0b43 ; (main + 579)
+0baa : a9 00 __ LDA #$00
+0bac : 4c a1 0b JMP $0ba1 ; (main + 673)
+0baf : a9 01 __ LDA #$01
+0bb1 : 4c 3d 0b JMP $0b3d ; (main + 573)
+0bb4 : a9 01 __ LDA #$01
+0bb6 : 4c 2e 0b JMP $0b2e ; (main + 558)
+0bb9 : a9 01 __ LDA #$01
+0bbb : 4c f1 0a JMP $0af1 ; (main + 497)
+0bbe : a9 01 __ LDA #$01
+0bc0 : 4c b6 0a JMP $0ab6 ; (main + 438)
+0bc3 : a9 01 __ LDA #$01
+0bc5 : 4c 7d 0a JMP $0a7d ; (main + 381)
+0bc8 : a9 01 __ LDA #$01
+0bca : 4c 5e 0a JMP $0a5e ; (main + 350)
+0bcd : a9 01 __ LDA #$01
+0bcf : 4c 3d 0a JMP $0a3d ; (main + 317)
+0bd2 : a9 01 __ LDA #$01
+0bd4 : 4c 1c 0a JMP $0a1c ; (main + 284)
+0bd7 : a9 01 __ LDA #$01
+0bd9 : 4c e5 09 JMP $09e5 ; (main + 229)
+0bdc : a5 48 __ LDA T0 + 0
+0bde : 29 01 __ AND #$01
+0be0 : 4c e5 09 JMP $09e5 ; (main + 229)
+0be3 : a9 00 __ LDA #$00
+0be5 : 4c c1 09 JMP $09c1 ; (main + 193)
+0be8 : a9 01 __ LDA #$01
+0bea : 4c 95 09 JMP $0995 ; (main + 149)
+0bed : a9 01 __ LDA #$01
+0bef : 4c 88 09 JMP $0988 ; (main + 136)
+0bf2 : a9 01 __ LDA #$01
+0bf4 : 4c 7b 09 JMP $097b ; (main + 123)
+0bf7 : a9 01 __ LDA #$01
+0bf9 : 4c 5e 09 JMP $095e ; (main + 94)
+0bfc : a9 01 __ LDA #$01
+0bfe : 4c 51 09 JMP $0951 ; (main + 81)
+0c01 : a9 01 __ LDA #$01
+0c03 : 4c 1e 09 JMP $091e ; (main + 30)
+--------------------------------------------------------------------
+assert:
+0c06 : a0 02 __ LDY #$02
+0c08 : b1 23 __ LDA (SP + 0),y
+0c0a : d0 09 __ BNE $0c15
+0c0c : a9 ff __ LDA #$ff
+0c0e : 85 0d __ STA P0
+0c10 : 85 0e __ STA P1
+0c12 : 20 16 0c JSR $0c16 ; (exit + 0)
+0c15 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+0c16 : a5 0d __ LDA P0
+0c18 : 85 1b __ STA ACCU + 0
+0c1a : a5 0e __ LDA P1
+0c1c : 85 1c __ STA ACCU + 1
+0c1e : ae a3 0c LDX $0ca3 ; (spentry + 0)
+0c21 : 9a __ __ TXS
+0c22 : a9 4c __ LDA #$4c
+0c24 : 85 54 __ STA $54
+0c26 : a9 00 __ LDA #$00
+0c28 : 85 13 __ STA P6
+0c2a : 60 __ __ RTS
+--------------------------------------------------------------------
+isset:
+0c2b : a4 0d __ LDY P0
+0c2d : b9 a4 0c LDA $0ca4,y ; (flags + 0)
+0c30 : 85 1b __ STA ACCU + 0
+0c32 : 86 1c __ STX ACCU + 1
+0c34 : 60 __ __ RTS
+--------------------------------------------------------------------
+isclear:
+0c35 : a4 0d __ LDY P0
+0c37 : b9 a4 0c LDA $0ca4,y ; (flags + 0)
+0c3a : 05 46 __ ORA $46
+0c3c : f0 09 __ BEQ $0c47
+0c3e : a9 00 __ LDA #$00
+0c40 : 85 1b __ STA ACCU + 0
+0c42 : a5 46 __ LDA $46
+0c44 : 85 1c __ STA ACCU + 1
+0c46 : 60 __ __ RTS
+0c47 : a9 01 __ LDA #$01
+0c49 : 4c 40 0c JMP $0c40 ; (isclear + 11)
+--------------------------------------------------------------------
+compare:
+0c4c : a5 0d __ LDA P0
+0c4e : c5 0e __ CMP P1
+0c50 : f0 3f __ BEQ $0c91
+0c52 : a9 00 __ LDA #$00
+0c54 : aa __ __ TAX
+0c55 : a5 0d __ LDA P0
+0c57 : c5 0e __ CMP P1
+0c59 : f0 04 __ BEQ $0c5f
+0c5b : 8a __ __ TXA
+0c5c : 09 02 __ ORA #$02
+0c5e : aa __ __ TAX
+0c5f : a5 0d __ LDA P0
+0c61 : c5 0e __ CMP P1
+0c63 : b0 04 __ BCS $0c69
+0c65 : 8a __ __ TXA
+0c66 : 09 04 __ ORA #$04
+0c68 : aa __ __ TAX
+0c69 : a5 0e __ LDA P1
+0c6b : c5 0d __ CMP P0
+0c6d : 90 04 __ BCC $0c73
+0c6f : 8a __ __ TXA
+0c70 : 09 08 __ ORA #$08
+0c72 : aa __ __ TAX
+0c73 : a5 0e __ LDA P1
+0c75 : c5 0d __ CMP P0
+0c77 : b0 04 __ BCS $0c7d
+0c79 : 8a __ __ TXA
+0c7a : 09 10 __ ORA #$10
+0c7c : aa __ __ TAX
+0c7d : a5 0d __ LDA P0
+0c7f : c5 0e __ CMP P1
+0c81 : 90 0a __ BCC $0c8d
+0c83 : 8a __ __ TXA
+0c84 : 09 20 __ ORA #$20
+0c86 : 85 1b __ STA ACCU + 0
+0c88 : a9 00 __ LDA #$00
+0c8a : 85 1c __ STA ACCU + 1
+0c8c : 60 __ __ RTS
+0c8d : 8a __ __ TXA
+0c8e : 4c 86 0c JMP $0c86 ; (compare + 58)
+0c91 : a9 01 __ LDA #$01
+0c93 : 4c 54 0c JMP $0c54 ; (compare + 8)
+--------------------------------------------------------------------
+inp_exit:
+0c96 : a9 4c __ LDA #$4c
+0c98 : 85 54 __ STA $54
+0c9a : a9 00 __ LDA #$00
+0c9c : 85 13 __ STA P6
+0c9e : a9 19 __ LDA #$19
+0ca0 : 85 16 __ STA P9
+0ca2 : 60 __ __ RTS
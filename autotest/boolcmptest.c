@@ -0,0 +1,60 @@
+#include <assert.h>
+
+bool	flags[8];
+
+bool isset(int i)
+{
+	return flags[i];
+}
+
+bool isclear(int i)
+{
+	return !flags[i];
+}
+
+int compare(bool a, bool b)
+{
+	int	r = 0;
+	if (a == b) r |= 1;
+	if (a != b) r |= 2;
+	if (a < b) r |= 4;
+	if (a <= b) r |= 8;
+	if (a > b) r |= 16;
+	if (a >= b) r |= 32;
+	return r;
+}
+
+int main(void)
+{
+	for (int i = 0; i < 8; i++)
+		flags[i] = (i & 1) != 0;
+
+	for (int i = 0; i < 8; i++)
+	{
+		assert(isset(i) == ((i & 1) != 0));
+		assert(!isset(i) == ((i & 1) == 0));
+		assert(isclear(i) != isset(i));
+		if (!isset(i))
+			assert(!(i & 1));
+		else
+			assert(i & 1);
+	}
+
+	assert(compare(false, false) == 1 + 8 + 32);
+	assert(compare(false, true) == 2 + 4 + 8);
+	assert(compare(true, false) == 2 + 16 + 32);
+	assert(compare(true, true) == 1 + 8 + 32);
+
+	bool	a = isset(0), b = isset(1);
+	assert(compare(a, b) == 2 + 4 + 8);
+	a = isset(3); b = isclear(3);
+	assert(compare(a, b) == 2 + 16 + 32);
+	a = isclear(2); b = isset(5);
+	assert(compare(a, b) == 1 + 8 + 32);
+
+	assert((a < b) == false && (a >= b) == true);
+	b = isset(4);
+	assert((a > b) == true && (a <= b) == false);
+
+	return 0;
+}
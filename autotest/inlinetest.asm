@@ -0,0 +1,164 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e cd 09 STX $09cd ; (spentry + 0)
+0811 : a9 ce __ LDA #$ce
+0813 : 85 19 __ STA IP + 0
+0815 : a9 09 __ LDA #$09
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 09 __ LDA #$09
+081c : e9 09 __ SBC #$09
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ce __ LDA #$ce
+0832 : e9 ce __ SBC #$ce
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c c0 09 JMP $09c0 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 03 __ SBC #$03
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : 20 49 09 JSR $0949 ; (inlined + 0)
+0910 : a5 1b __ LDA ACCU + 0
+0912 : 85 45 __ STA T0 + 0
+0914 : a5 1c __ LDA ACCU + 1
+0916 : 85 46 __ STA T0 + 1
+0918 : 20 72 09 JSR $0972 ; (called + 0)
+091b : a5 46 __ LDA T0 + 1
+091d : c5 1c __ CMP ACCU + 1
+091f : d0 06 __ BNE $0927
+0921 : a5 45 __ LDA T0 + 0
+0923 : c5 1b __ CMP ACCU + 0
+0925 : f0 1d __ BEQ $0944
+0927 : a9 01 __ LDA #$01
+0929 : a0 02 __ LDY #$02
+092b : 91 23 __ STA (SP + 0),y
+092d : 20 9b 09 JSR $099b ; (assert + 0)
+0930 : a9 00 __ LDA #$00
+0932 : 85 1b __ STA ACCU + 0
+0934 : 85 1c __ STA ACCU + 1
+0936 : 18 __ __ CLC
+0937 : a5 23 __ LDA SP + 0
+0939 : 69 03 __ ADC #$03
+093b : 85 23 __ STA SP + 0
+093d : a5 24 __ LDA SP + 1
+093f : 69 00 __ ADC #$00
+0941 : 85 24 __ STA SP + 1
+0943 : 60 __ __ RTS
+0944 : a9 00 __ LDA #$00
+0946 : 4c 29 09 JMP $0929 ; (main + 41)
+--------------------------------------------------------------------
+inlined:
+0949 : 38 __ __ SEC
+094a : a5 23 __ LDA SP + 0
+094c : e9 01 __ SBC #$01
+094e : 85 23 __ STA SP + 0
+0950 : a5 24 __ LDA SP + 1
+0952 : e9 00 __ SBC #$00
+0954 : 85 24 __ STA SP + 1
+0956 : a9 00 __ LDA #$00
+0958 : a0 00 __ LDY #$00
+095a : 91 23 __ STA (SP + 0),y
+095c : a5 23 __ LDA SP + 0
+095e : 85 1b __ STA ACCU + 0
+0960 : a5 24 __ LDA SP + 1
+0962 : 85 1c __ STA ACCU + 1
+0964 : 18 __ __ CLC
+0965 : a5 23 __ LDA SP + 0
+0967 : 69 01 __ ADC #$01
+0969 : 85 23 __ STA SP + 0
+096b : a5 24 __ LDA SP + 1
+096d : 69 00 __ ADC #$00
+096f : 85 24 __ STA SP + 1
+0971 : 60 __ __ RTS
+--------------------------------------------------------------------
+called:
+0972 : 38 __ __ SEC
+0973 : a5 23 __ LDA SP + 0
+0975 : e9 01 __ SBC #$01
+0977 : 85 23 __ STA SP + 0
+0979 : a5 24 __ LDA SP + 1
+097b : e9 00 __ SBC #$00
+097d : 85 24 __ STA SP + 1
+097f : a9 00 __ LDA #$00
+0981 : a0 00 __ LDY #$00
+0983 : 91 23 __ STA (SP + 0),y
+0985 : a5 23 __ LDA SP + 0
+0987 : 85 1b __ STA ACCU + 0
+0989 : a5 24 __ LDA SP + 1
+098b : 85 1c __ STA ACCU + 1
+098d : 18 __ __ CLC
+098e : a5 23 __ LDA SP + 0
+0990 : 69 01 __ ADC #$01
+0992 : 85 23 __ STA SP + 0
+0994 : a5 24 __ LDA SP + 1
+0996 : 69 00 __ ADC #$00
+0998 : 85 24 __ STA SP + 1
+099a : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+099b : a0 02 __ LDY #$02
+099d : b1 23 __ LDA (SP + 0),y
+099f : d0 09 __ BNE $09aa
+09a1 : a9 ff __ LDA #$ff
+09a3 : 85 0d __ STA P0
+09a5 : 85 0e __ STA P1
+09a7 : 20 ab 09 JSR $09ab ; (exit + 0)
+09aa : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+09ab : a5 0d __ LDA P0
+09ad : 85 1b __ STA ACCU + 0
+09af : a5 0e __ LDA P1
+09b1 : 85 1c __ STA ACCU + 1
+09b3 : ae cd 09 LDX $09cd ; (spentry + 0)
+09b6 : 9a __ __ TXS
+09b7 : a9 4c __ LDA #$4c
+09b9 : 85 54 __ STA $54
+09bb : a9 00 __ LDA #$00
+09bd : 85 13 __ STA P6
+09bf : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+09c0 : a9 4c __ LDA #$4c
+09c2 : 85 54 __ STA $54
+09c4 : a9 00 __ LDA #$00
+09c6 : 85 13 __ STA P6
+09c8 : a9 19 __ LDA #$19
+09ca : 85 16 __ STA P9
+09cc : 60 __ __ RTS
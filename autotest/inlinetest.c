@@ -0,0 +1,25 @@
+#include <assert.h>
+
+// An inline function shares the frame of its caller, so its local is
+// placed apart from the one of a called function at the same depth
+
+inline unsigned inlined(void)
+{
+	volatile char	c = 0;
+	return (unsigned)&c;
+}
+
+unsigned called(void)
+{
+	volatile char	c = 0;
+	return (unsigned)&c;
+}
+
+int main(void)
+{
+	unsigned	a = inlined(), b = called();
+
+	assert(a != b);
+
+	return 0;
+}
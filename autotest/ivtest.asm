@@ -0,0 +1,1176 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e f9 12 STX $12f9 ; (spentry + 0)
+0811 : a9 fe __ LDA #$fe
+0813 : 85 19 __ STA IP + 0
+0815 : a9 12 __ LDA #$12
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 1d __ LDA #$1d
+081c : e9 12 __ SBC #$12
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 26 __ LDA #$26
+0832 : e9 fe __ SBC #$fe
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 2
+0a04:	PUSH	#$0002
+0a07:	MOV	T0, #0
+0a0a:	LEA	T1, points + 0
+0a0e:	MOV	ADDR, T1
+0a10:	MOV	0(ADDR), T0
+0a13:	MOV	ACCU, T0
+0a15:	SHL	ACCU, #1
+0a17:	MOV	2(ADDR), ACCU
+0a1a:	MOVB	ACCU, T0
+0a1c:	ANDB	ACCU, #$0007
+0a1f:	MOVB	4(ADDR), ACCU
+0a22:	ADD	T1, #$0005
+0a26:	ADD	T0, #$0001
+0a2a:	MOV	ACCU, T0
+0a2c:	CMPS	ACCU, #$0064
+0a2f:	BGT	$0A0E
+0a31:	MOV	T0, #0
+0a34:	LEA	T1, grid + 0
+0a38:	LEA	T2, points + 0
+0a3c:	MOV	ADDR, T2
+0a3e:	MOV	T5, 2(ADDR)
+0a41:	MOV	ACCU, 0(ADDR)
+0a44:	ADD	T2, #$0005
+0a48:	ADD	ACCU, T5
+0a4a:	ADD	T0, ACCU
+0a4c:	MOV	ACCU, T1
+0a4e:	CMPU	ACCU, T2
+0a50:	BLT	$0A3C
+0a52:	MOV	ACCU, T0
+0a54:	CMPU	ACCU, #$3A02
+0a57:	BEQ	$0A5F
+0a59:	MOV	P0, #-1
+0a5c:	CALL	exit + 0
+0a5f:	MOV	T0, #0
+0a62:	LEA	T1, grid + 0
+0a66:	MOV	ADDR, T1
+0a68:	MOV	0(ADDR), T0
+0a6b:	ADD	T1, #$0002
+0a6f:	ADD	T0, #$0001
+0a73:	MOV	ACCU, T0
+0a75:	CMPS	ACCU, #$0190
+0a78:	BGT	$0A66
+0a7a:	MOV	T0, #0
+0a7d:	LEA	T1, grid + 238
+0a81:	LEA	T2, grid + 160
+0a85:	MOV	ADDR, T2
+0a87:	MOV	ACCU, 0(ADDR)
+0a8a:	ADD	T2, #$0002
+0a8e:	ADD	T0, ACCU
+0a90:	MOV	ACCU, T1
+0a92:	CMPU	ACCU, T2
+0a94:	BLE	$0A85
+0a96:	MOV	ACCU, T0
+0a98:	CMPU	ACCU, #$0F8C
+0a9b:	BEQ	$0AA3
+0a9d:	MOV	P0, #-1
+0aa0:	CALL	exit + 0
+0aa3:	MOV	T0, #$02da
+0aa7:	LEAX	ADDR, grid + 0 + T0
+0aab:	MOV	ACCU, 0(ADDR)
+0aae:	CMPU	ACCU, #$016D
+0ab1:	BEQ	$0AB9
+0ab3:	MOV	P0, #-1
+0ab6:	CALL	exit + 0
+0ab9:	MOV	T0, #0
+0abc:	MOV	T1, #0
+0abf:	MOV	ACCU, T1
+0ac1:	AND	ACCU, #$0007
+0ac5:	ADD	T1, #$0001
+0ac9:	ADD	T0, ACCU
+0acb:	MOV	ACCU, T1
+0acd:	CMPS	ACCU, #$0064
+0ad0:	BGT	$0ABF
+0ad2:	MOV	T1, #0
+0ad5:	MOV	T2, #99
+0ad8:	LEA	T4, points + 495
+0adc:	MOV	ADDR, T4
+0ade:	MOVUB	ACCU, 4(ADDR)
+0ae1:	ADD	T4, #$FFFB
+0ae5:	ADD	T2, #$FFFF
+0ae9:	ADD	T1, ACCU
+0aeb:	MOV	ACCU, T2
+0aed:	BGE	$0ADC
+0aef:	MOV	ACCU, T0
+0af1:	CMPU	ACCU, T1
+0af3:	BEQ	$0AFB
+0af5:	MOV	P0, #-1
+0af8:	CALL	exit + 0
+0afb:	LEA	T0, grid + 0
+0aff:	MOV	T1, #0
+0b02:	MOV	ACCU, T0
+0b04:	MOV	T2, ACCU
+0b06:	ADD	T0, #$0028
+0b0a:	MOV	ADDR, T2
+0b0c:	MOV	ACCU, 0(ADDR)
+0b0f:	ADD	T2, #$0004
+0b13:	ADD	T1, ACCU
+0b15:	MOV	ACCU, T0
+0b17:	CMPU	ACCU, T2
+0b19:	BLT	$0B0A
+0b1b:	MOV	ACCU, T1
+0b1d:	CMPU	ACCU, #$005A
+0b20:	BEQ	$0B28
+0b22:	MOV	P0, #-1
+0b25:	CALL	exit + 0
+0b28:	MOV	ACCU, #1
+0b2b:	MOVB	flags + 171, ACCU
+0b2f:	MOV	T0, #0
+0b32:	LEA	T1, flags + 0
+0b36:	MOV	ADDR, T1
+0b38:	MOVUB	ACCU, 0(ADDR)
+0b3b:	BNE	$0B4C
+0b3d:	ADD	T1, #$0003
+0b41:	ADD	T0, #$0001
+0b45:	MOV	ACCU, T0
+0b47:	CMPS	ACCU, #$0064
+0b4a:	BGT	$0B36
+0b4c:	MOV	ACCU, T0
+0b4e:	CMPU	ACCU, #$0039
+0b51:	BEQ	$0B59
+0b53:	MOV	P0, #-1
+0b56:	CALL	exit + 0
+0b59:	MOV	T0, #0
+0b5c:	LEA	T1, flags + 0
+0b60:	MOV	ADDR, T1
+0b62:	MOVUB	ACCU, 0(ADDR)
+0b65:	BNE	$0B76
+0b67:	ADD	T1, #$0003
+0b6b:	ADD	T0, #$0001
+0b6f:	MOV	ACCU, T0
+0b71:	CMPS	ACCU, #$0014
+0b74:	BGT	$0B60
+0b76:	MOV	ACCU, T0
+0b78:	CMPU	ACCU, #$0014
+0b7b:	BEQ	$0B83
+0b7d:	MOV	P0, #-1
+0b80:	CALL	exit + 0
+0b83:	MOV	T0, #0
+0b86:	MOV	T1, #0
+0b89:	MOV	ACCU, T1
+0b8b:	AND	ACCU, #$0001
+0b8f:	BEQ	$0BA3
+0b91:	MOV	ACCU, T1
+0b93:	MUL	ACCU, #5
+0b96:	LEA	T2, points + 0
+0b9a:	ADD	T2, ACCU
+0b9c:	MOV	ADDR, T2
+0b9e:	MOV	ACCU, 2(ADDR)
+0ba1:	ADD	T0, ACCU
+0ba3:	ADD	T1, #$0001
+0ba7:	MOV	ACCU, T1
+0ba9:	CMPS	ACCU, #$0064
+0bac:	BGT	$0B89
+0bae:	MOV	ACCU, T0
+0bb0:	CMPU	ACCU, #$1388
+0bb3:	BEQ	$0BBB
+0bb5:	MOV	P0, #-1
+0bb8:	CALL	exit + 0
+0bbb:	MOV	T0, #0
+0bbe:	MOV	ACCU, T0
+0bc0:	SHL	ACCU, #2
+0bc2:	LEA	T1, larr + 0
+0bc6:	ADD	T1, ACCU
+0bc8:	MOV	ADDR, T1
+0bca:	MOV	ACCU, T0
+0bcc:	ADD	ACCU, #$0001
+0bd0:	MOV	T2, ACCU
+0bd2:	EXTRT	$00, inp_op_ext_s16 + 0
+0bd6:	MOVD	0(ADDR), ACCU
+0bd9:	MOV	ACCU, T2
+0bdb:	MOV	T0, ACCU
+0bdd:	CMPS	ACCU, #$0064
+0be0:	BGT	$0BBE
+0be2:	MOVD	ACCU, #$00000000
+0be8:	MOVD	larr + 40, ACCU
+0bec:	MOV	T0, #0
+0bef:	LEA	T1, larr + 0
+0bf3:	MOV	ADDR, T1
+0bf5:	MOVD	T6, 0(ADDR)
+0bf8:	MOVD	ACCU, #$00000000
+0bfe:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c02:	BEQ	$0C24
+0c04:	MOVD	ACCU, T6
+0c06:	MOVD	$03, #$00000001
+0c0c:	EXTRT	$03, inp_op_addr_32 + 0
+0c10:	MOVD	T6, ACCU
+0c12:	MOVD	0(ADDR), T6
+0c15:	ADD	T1, #$0004
+0c19:	ADD	T0, #$0001
+0c1d:	MOV	ACCU, T0
+0c1f:	CMPS	ACCU, #$4000
+0c22:	BGT	$0BF3
+0c24:	MOVD	T6, larr + 0
+0c28:	MOVD	ACCU, #$00000002
+0c2e:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c32:	BNE	$0C64
+0c34:	MOVD	T6, larr + 36
+0c38:	MOVD	ACCU, #$0000000b
+0c3e:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c42:	BNE	$0C64
+0c44:	MOVD	T6, larr + 40
+0c48:	MOVD	ACCU, #$00000000
+0c4e:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c52:	BNE	$0C64
+0c54:	MOVD	T6, larr + 44
+0c58:	MOVD	ACCU, #$0000000c
+0c5e:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c62:	BEQ	$0C6A
+0c64:	MOV	P0, #-1
+0c67:	CALL	exit + 0
+0c6a:	LEA	T0, larr + 20
+0c6e:	LEA	T1, larr + 0
+0c72:	MOV	ADDR, T1
+0c74:	MOVD	T6, 0(ADDR)
+0c77:	MOVD	ACCU, #$00000000
+0c7d:	EXTRT	T6, inp_op_cmp_u32 + 0
+0c81:	BEQ	$0C9E
+0c83:	MOVD	ACCU, T6
+0c85:	MOVD	$03, #$00000001
+0c8b:	EXTRT	$03, inp_op_addr_32 + 0
+0c8f:	MOVD	T6, ACCU
+0c91:	MOVD	0(ADDR), T6
+0c94:	ADD	T1, #$0004
+0c98:	MOV	ACCU, T0
+0c9a:	CMPU	ACCU, T1
+0c9c:	BLT	$0C72
+0c9e:	MOVD	T6, larr + 16
+0ca2:	MOVD	ACCU, #$00000007
+0ca8:	EXTRT	T6, inp_op_cmp_u32 + 0
+0cac:	BNE	$0CBE
+0cae:	MOVD	T6, larr + 20
+0cb2:	MOVD	ACCU, #$00000007
+0cb8:	EXTRT	T6, inp_op_cmp_u32 + 0
+0cbc:	BEQ	$0CC4
+0cbe:	MOV	P0, #-1
+0cc1:	CALL	exit + 0
+0cc4:	MOV	T0, llimit + 0
+0cc8:	MOV	ACCU, T0
+0cca:	CMPS	ACCU, #$0000
+0ccd:	BLTF	$0D9B
+0cd0:	MOVD	T6, larr + 36
+0cd4:	MOVD	ACCU, #$0000000c
+0cda:	EXTRT	T6, inp_op_cmp_u32 + 0
+0cde:	BNE	$0D00
+0ce0:	MOVD	T6, larr + 40
+0ce4:	MOVD	ACCU, #$00000000
+0cea:	EXTRT	T6, inp_op_cmp_u32 + 0
+0cee:	BNE	$0D00
+0cf0:	MOVD	T6, larr + 44
+0cf4:	MOVD	ACCU, #$0000000c
+0cfa:	EXTRT	T6, inp_op_cmp_u32 + 0
+0cfe:	BEQ	$0D06
+0d00:	MOV	P0, #-1
+0d03:	CALL	exit + 0
+0d06:	MOV	T0, nlimit + 0
+0d0a:	MOV	T1, #0
+0d0d:	MOV	ACCU, T1
+0d0f:	SHL	ACCU, #1
+0d11:	LEA	T2, big + 0
+0d15:	ADD	T2, ACCU
+0d17:	MOV	ACCU, #7
+0d1a:	MOV	ADDR, T2
+0d1c:	MOV	0(ADDR), ACCU
+0d1f:	ADD	T2, #$0002
+0d23:	ADD	T1, #$0001
+0d27:	MOV	ACCU, T0
+0d29:	CMPS	ACCU, T1
+0d2b:	BLT	$0D17
+0d2d:	MOV	ACCU, big + 0
+0d31:	CMPU	ACCU, #$0007
+0d34:	BNE	$0D3C
+0d36:	MOV	ACCU, big + 2
+0d3a:	BEQ	$0D42
+0d3c:	MOV	P0, #-1
+0d3f:	CALL	exit + 0
+0d42:	MOV	T0, #0
+0d45:	LEAX	ADDR, big + 0 + T0
+0d49:	MOV	ACCU, #7
+0d4c:	MOV	0(ADDR), ACCU
+0d4f:	MOV	ACCU, big + 2
+0d53:	BEQ	$0D5B
+0d55:	MOV	P0, #-1
+0d58:	CALL	exit + 0
+0d5b:	MOV	ACCU, #0
+0d5e:	SHL	ACCU, #1
+0d60:	LEA	T0, big + 0
+0d64:	ADD	T0, ACCU
+0d66:	LEA	T1, big + 6
+0d6a:	MOV	ACCU, #7
+0d6d:	MOV	ADDR, T0
+0d6f:	MOV	0(ADDR), ACCU
+0d72:	ADD	T0, #$0002
+0d76:	MOV	ACCU, T1
+0d78:	CMPU	ACCU, T0
+0d7a:	BLT	$0D6A
+0d7c:	MOV	ACCU, big + 4
+0d80:	CMPU	ACCU, #$0007
+0d83:	BNE	$0D8B
+0d85:	MOV	ACCU, big + 6
+0d89:	BEQ	$0D91
+0d8b:	MOV	P0, #-1
+0d8e:	CALL	exit + 0
+0d91:	MOV	ACCU, #0
+0d94:	POP	#$0002
+0d97:	RETURN	0, 2
+0d9b:	MOV	T1, #0
+0d9e:	LEA	T2, larr + 0
+0da2:	MOV	ADDR, T2
+0da4:	MOVD	T6, 0(ADDR)
+0da7:	MOVD	ACCU, #$00000000
+0dad:	EXTRT	T6, inp_op_cmp_u32 + 0
+0db1:	BEQF	$0CD0
+0db4:	MOVD	ACCU, T6
+0db6:	MOVD	$03, #$00000001
+0dbc:	EXTRT	$03, inp_op_addr_32 + 0
+0dc0:	MOVD	T6, ACCU
+0dc2:	MOVD	0(ADDR), T6
+0dc5:	ADD	T2, #$0004
+0dc9:	ADD	T1, #$0001
+0dcd:	MOV	ACCU, T0
+0dcf:	CMPS	ACCU, T1
+0dd1:	BLT	$0DA2
+0dd3:	JUMPF	$0CD0
+--------------------------------------------------------------------
+exit:
+0dd6:	ENTER	0, 2
+0dda:	JSR	$0de1
+0ddd:	RETURN	0, 2
+--------------------------------------------------------------------
+0de1 : a5 0d __ LDA P0
+0de3 : 85 1b __ STA ACCU + 0
+0de5 : a5 0e __ LDA P1
+0de7 : 85 1c __ STA ACCU + 1
+0de9 : ae f9 12 LDX $12f9 ; (spentry + 0)
+0dec : 9a __ __ TXS
+0ded : a9 4c __ LDA #$4c
+0def : 85 54 __ STA $54
+0df1 : a9 00 __ LDA #$00
+0df3 : 85 13 __ STA P6
+0df5 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_s16:
+0df6 : a5 1c __ LDA ACCU + 1
+0df8 : 09 7f __ ORA #$7f
+0dfa : 30 02 __ BMI $0dfe
+0dfc : a9 00 __ LDA #$00
+0dfe : 85 1d __ STA ACCU + 2
+0e00 : 85 1e __ STA ACCU + 3
+0e02 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_addr_32:
+0e03 : 18 __ __ CLC
+0e04 : a5 1b __ LDA ACCU + 0
+0e06 : 75 00 __ ADC $00,x
+0e08 : 85 1b __ STA ACCU + 0
+0e0a : a5 1c __ LDA ACCU + 1
+0e0c : 75 01 __ ADC $01,x
+0e0e : 85 1c __ STA ACCU + 1
+0e10 : a5 1d __ LDA ACCU + 2
+0e12 : 75 02 __ ADC $02,x
+0e14 : 85 1d __ STA ACCU + 2
+0e16 : a5 1e __ LDA ACCU + 3
+0e18 : 75 03 __ ADC $03,x
+0e1a : 85 1e __ STA ACCU + 3
+0e1c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+0e1d : b5 03 __ LDA $03,x
+0e1f : c5 1e __ CMP ACCU + 3
+0e21 : d0 20 __ BNE $0e43
+0e23 : b5 02 __ LDA $02,x
+0e25 : c5 1d __ CMP ACCU + 2
+0e27 : d0 1a __ BNE $0e43
+0e29 : b5 01 __ LDA $01,x
+0e2b : c5 1c __ CMP ACCU + 1
+0e2d : d0 14 __ BNE $0e43
+0e2f : b5 00 __ LDA $00,x
+0e31 : c5 1b __ CMP ACCU + 0
+0e33 : d0 0e __ BNE $0e43
+0e35 : a9 00 __ LDA #$00
+0e37 : 85 1b __ STA ACCU + 0
+0e39 : 85 1c __ STA ACCU + 1
+0e3b : 60 __ __ RTS
+0e3c : a9 ff __ LDA #$ff
+0e3e : 85 1b __ STA ACCU + 0
+0e40 : 85 1c __ STA ACCU + 1
+0e42 : 60 __ __ RTS
+0e43 : 90 f7 __ BCC $0e3c
+0e45 : a9 01 __ LDA #$01
+0e47 : 85 1b __ STA ACCU + 0
+0e49 : a9 00 __ LDA #$00
+0e4b : 85 1c __ STA ACCU + 1
+0e4d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0e4e : a9 4c __ LDA #$4c
+0e50 : 85 54 __ STA $54
+0e52 : a9 00 __ LDA #$00
+0e54 : 85 13 __ STA P6
+0e56 : a9 19 __ LDA #$19
+0e58 : 85 16 __ STA P9
+0e5a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0e5b : b1 19 __ LDA (IP + 0),y
+0e5d : aa __ __ TAX
+0e5e : c8 __ __ INY
+0e5f : b1 19 __ LDA (IP + 0),y
+0e61 : 95 00 __ STA $00,x
+0e63 : a9 00 __ LDA #$00
+0e65 : 95 01 __ STA $01,x
+0e67 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+0e6a : b1 19 __ LDA (IP + 0),y
+0e6c : aa __ __ TAX
+0e6d : c8 __ __ INY
+0e6e : b1 19 __ LDA (IP + 0),y
+0e70 : 95 00 __ STA $00,x
+0e72 : a9 ff __ LDA #$ff
+0e74 : 95 01 __ STA $01,x
+0e76 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+0e79 : b1 19 __ LDA (IP + 0),y
+0e7b : aa __ __ TAX
+0e7c : c8 __ __ INY
+0e7d : b1 19 __ LDA (IP + 0),y
+0e7f : 95 00 __ STA $00,x
+0e81 : c8 __ __ INY
+0e82 : b1 19 __ LDA (IP + 0),y
+0e84 : 95 01 __ STA $01,x
+0e86 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+0e89 : b1 19 __ LDA (IP + 0),y
+0e8b : aa __ __ TAX
+0e8c : c8 __ __ INY
+0e8d : b1 19 __ LDA (IP + 0),y
+0e8f : 95 00 __ STA $00,x
+0e91 : c8 __ __ INY
+0e92 : b1 19 __ LDA (IP + 0),y
+0e94 : 95 01 __ STA $01,x
+0e96 : c8 __ __ INY
+0e97 : b1 19 __ LDA (IP + 0),y
+0e99 : 95 02 __ STA $02,x
+0e9b : c8 __ __ INY
+0e9c : b1 19 __ LDA (IP + 0),y
+0e9e : 95 03 __ STA $03,x
+0ea0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0ea3 : b1 19 __ LDA (IP + 0),y
+0ea5 : aa __ __ TAX
+0ea6 : b5 00 __ LDA $00,x
+0ea8 : 85 1b __ STA ACCU + 0
+0eaa : a9 00 __ LDA #$00
+0eac : 85 1c __ STA ACCU + 1
+0eae : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0eb1 : b1 19 __ LDA (IP + 0),y
+0eb3 : aa __ __ TAX
+0eb4 : b5 00 __ LDA $00,x
+0eb6 : 85 1b __ STA ACCU + 0
+0eb8 : b5 01 __ LDA $01,x
+0eba : 85 1c __ STA ACCU + 1
+0ebc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0ebf : b1 19 __ LDA (IP + 0),y
+0ec1 : aa __ __ TAX
+0ec2 : a5 1b __ LDA ACCU + 0
+0ec4 : 95 00 __ STA $00,x
+0ec6 : a5 1c __ LDA ACCU + 1
+0ec8 : 95 01 __ STA $01,x
+0eca : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0ecd : b1 19 __ LDA (IP + 0),y
+0ecf : aa __ __ TAX
+0ed0 : b5 00 __ LDA $00,x
+0ed2 : 85 1f __ STA ADDR + 0
+0ed4 : b5 01 __ LDA $01,x
+0ed6 : 85 20 __ STA ADDR + 1
+0ed8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+0edb : b1 19 __ LDA (IP + 0),y
+0edd : aa __ __ TAX
+0ede : b5 00 __ LDA $00,x
+0ee0 : 85 1b __ STA ACCU + 0
+0ee2 : b5 01 __ LDA $01,x
+0ee4 : 85 1c __ STA ACCU + 1
+0ee6 : b5 02 __ LDA $02,x
+0ee8 : 85 1d __ STA ACCU + 2
+0eea : b5 03 __ LDA $03,x
+0eec : 85 1e __ STA ACCU + 3
+0eee : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+0ef1 : b1 19 __ LDA (IP + 0),y
+0ef3 : aa __ __ TAX
+0ef4 : a5 1b __ LDA ACCU + 0
+0ef6 : 95 00 __ STA $00,x
+0ef8 : a5 1c __ LDA ACCU + 1
+0efa : 95 01 __ STA $01,x
+0efc : a5 1d __ LDA ACCU + 2
+0efe : 95 02 __ STA $02,x
+0f00 : a5 1e __ LDA ACCU + 3
+0f02 : 95 03 __ STA $03,x
+0f04 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0f07 : b1 19 __ LDA (IP + 0),y
+0f09 : 85 1f __ STA ADDR + 0
+0f0b : c8 __ __ INY
+0f0c : b1 19 __ LDA (IP + 0),y
+0f0e : 85 20 __ STA ADDR + 1
+0f10 : c8 __ __ INY
+0f11 : b1 19 __ LDA (IP + 0),y
+0f13 : aa __ __ TAX
+0f14 : 84 02 __ STY $02
+0f16 : a0 00 __ LDY #$00
+0f18 : b1 1f __ LDA (ADDR + 0),y
+0f1a : 95 00 __ STA $00,x
+0f1c : c8 __ __ INY
+0f1d : b1 1f __ LDA (ADDR + 0),y
+0f1f : 95 01 __ STA $01,x
+0f21 : a4 02 __ LDY $02
+0f23 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f26 : b1 19 __ LDA (IP + 0),y
+0f28 : aa __ __ TAX
+0f29 : c8 __ __ INY
+0f2a : b1 19 __ LDA (IP + 0),y
+0f2c : 84 02 __ STY $02
+0f2e : a8 __ __ TAY
+0f2f : 4c 18 0f JMP $0f18 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+0f32 : b1 19 __ LDA (IP + 0),y
+0f34 : 85 1f __ STA ADDR + 0
+0f36 : c8 __ __ INY
+0f37 : b1 19 __ LDA (IP + 0),y
+0f39 : 85 20 __ STA ADDR + 1
+0f3b : c8 __ __ INY
+0f3c : b1 19 __ LDA (IP + 0),y
+0f3e : aa __ __ TAX
+0f3f : 84 02 __ STY $02
+0f41 : a0 00 __ LDY #$00
+0f43 : b1 1f __ LDA (ADDR + 0),y
+0f45 : 95 00 __ STA $00,x
+0f47 : c8 __ __ INY
+0f48 : b1 1f __ LDA (ADDR + 0),y
+0f4a : 95 01 __ STA $01,x
+0f4c : c8 __ __ INY
+0f4d : b1 1f __ LDA (ADDR + 0),y
+0f4f : 95 02 __ STA $02,x
+0f51 : c8 __ __ INY
+0f52 : b1 1f __ LDA (ADDR + 0),y
+0f54 : 95 03 __ STA $03,x
+0f56 : a4 02 __ LDY $02
+0f58 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f5b : b1 19 __ LDA (IP + 0),y
+0f5d : aa __ __ TAX
+0f5e : c8 __ __ INY
+0f5f : b1 19 __ LDA (IP + 0),y
+0f61 : 84 02 __ STY $02
+0f63 : a8 __ __ TAY
+0f64 : 4c 43 0f JMP $0f43 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0f67 : b1 19 __ LDA (IP + 0),y
+0f69 : 85 1f __ STA ADDR + 0
+0f6b : c8 __ __ INY
+0f6c : b1 19 __ LDA (IP + 0),y
+0f6e : 85 20 __ STA ADDR + 1
+0f70 : c8 __ __ INY
+0f71 : b1 19 __ LDA (IP + 0),y
+0f73 : aa __ __ TAX
+0f74 : 84 02 __ STY $02
+0f76 : a0 00 __ LDY #$00
+0f78 : b5 00 __ LDA $00,x
+0f7a : 91 1f __ STA (ADDR + 0),y
+0f7c : a4 02 __ LDY $02
+0f7e : 4c 50 08 JMP $0850 ; (startup + 79)
+0f81 : b1 19 __ LDA (IP + 0),y
+0f83 : aa __ __ TAX
+0f84 : c8 __ __ INY
+0f85 : b1 19 __ LDA (IP + 0),y
+0f87 : 84 02 __ STY $02
+0f89 : a8 __ __ TAY
+0f8a : 4c 78 0f JMP $0f78 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_32:
+0f8d : b1 19 __ LDA (IP + 0),y
+0f8f : 85 1f __ STA ADDR + 0
+0f91 : c8 __ __ INY
+0f92 : b1 19 __ LDA (IP + 0),y
+0f94 : 85 20 __ STA ADDR + 1
+0f96 : c8 __ __ INY
+0f97 : b1 19 __ LDA (IP + 0),y
+0f99 : aa __ __ TAX
+0f9a : 84 02 __ STY $02
+0f9c : a0 00 __ LDY #$00
+0f9e : b5 00 __ LDA $00,x
+0fa0 : 91 1f __ STA (ADDR + 0),y
+0fa2 : c8 __ __ INY
+0fa3 : b5 01 __ LDA $01,x
+0fa5 : 91 1f __ STA (ADDR + 0),y
+0fa7 : c8 __ __ INY
+0fa8 : b5 02 __ LDA $02,x
+0faa : 91 1f __ STA (ADDR + 0),y
+0fac : c8 __ __ INY
+0fad : b5 03 __ LDA $03,x
+0faf : 91 1f __ STA (ADDR + 0),y
+0fb1 : a4 02 __ LDY $02
+0fb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fb6 : b1 19 __ LDA (IP + 0),y
+0fb8 : aa __ __ TAX
+0fb9 : c8 __ __ INY
+0fba : b1 19 __ LDA (IP + 0),y
+0fbc : 84 02 __ STY $02
+0fbe : a8 __ __ TAY
+0fbf : 4c 9e 0f JMP $0f9e ; (inp_store_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+0fc2 : b1 19 __ LDA (IP + 0),y
+0fc4 : aa __ __ TAX
+0fc5 : c8 __ __ INY
+0fc6 : b1 19 __ LDA (IP + 0),y
+0fc8 : 95 00 __ STA $00,x
+0fca : c8 __ __ INY
+0fcb : b1 19 __ LDA (IP + 0),y
+0fcd : 95 01 __ STA $01,x
+0fcf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+0fd2 : b1 19 __ LDA (IP + 0),y
+0fd4 : aa __ __ TAX
+0fd5 : c8 __ __ INY
+0fd6 : 18 __ __ CLC
+0fd7 : b5 00 __ LDA $00,x
+0fd9 : 71 19 __ ADC (IP + 0),y
+0fdb : 85 1f __ STA ADDR + 0
+0fdd : c8 __ __ INY
+0fde : b5 01 __ LDA $01,x
+0fe0 : 71 19 __ ADC (IP + 0),y
+0fe2 : 85 20 __ STA ADDR + 1
+0fe4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0fe7 : b1 19 __ LDA (IP + 0),y
+0fe9 : 85 1f __ STA ADDR + 0
+0feb : c8 __ __ INY
+0fec : b1 19 __ LDA (IP + 0),y
+0fee : 85 20 __ STA ADDR + 1
+0ff0 : c8 __ __ INY
+0ff1 : b1 19 __ LDA (IP + 0),y
+0ff3 : aa __ __ TAX
+0ff4 : 84 02 __ STY $02
+0ff6 : a0 00 __ LDY #$00
+0ff8 : b1 1f __ LDA (ADDR + 0),y
+0ffa : 95 00 __ STA $00,x
+0ffc : a9 00 __ LDA #$00
+0ffe : 95 01 __ STA $01,x
+1000 : a4 02 __ LDY $02
+1002 : 4c 50 08 JMP $0850 ; (startup + 79)
+1005 : b1 19 __ LDA (IP + 0),y
+1007 : aa __ __ TAX
+1008 : c8 __ __ INY
+1009 : b1 19 __ LDA (IP + 0),y
+100b : 84 02 __ STY $02
+100d : a8 __ __ TAY
+100e : 4c f8 0f JMP $0ff8 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1011 : b1 19 __ LDA (IP + 0),y
+1013 : 85 1f __ STA ADDR + 0
+1015 : c8 __ __ INY
+1016 : b1 19 __ LDA (IP + 0),y
+1018 : 85 20 __ STA ADDR + 1
+101a : c8 __ __ INY
+101b : b1 19 __ LDA (IP + 0),y
+101d : aa __ __ TAX
+101e : 84 02 __ STY $02
+1020 : a0 00 __ LDY #$00
+1022 : b5 00 __ LDA $00,x
+1024 : 91 1f __ STA (ADDR + 0),y
+1026 : c8 __ __ INY
+1027 : b5 01 __ LDA $01,x
+1029 : 91 1f __ STA (ADDR + 0),y
+102b : a4 02 __ LDY $02
+102d : 4c 50 08 JMP $0850 ; (startup + 79)
+1030 : b1 19 __ LDA (IP + 0),y
+1032 : aa __ __ TAX
+1033 : c8 __ __ INY
+1034 : b1 19 __ LDA (IP + 0),y
+1036 : 84 02 __ STY $02
+1038 : a8 __ __ TAY
+1039 : 4c 22 10 JMP $1022 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+103c : b1 19 __ LDA (IP + 0),y
+103e : aa __ __ TAX
+103f : 18 __ __ CLC
+1040 : a5 1b __ LDA ACCU + 0
+1042 : 75 00 __ ADC $00,x
+1044 : 85 1b __ STA ACCU + 0
+1046 : a5 1c __ LDA ACCU + 1
+1048 : 75 01 __ ADC $01,x
+104a : 85 1c __ STA ACCU + 1
+104c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+104f : b1 19 __ LDA (IP + 0),y
+1051 : aa __ __ TAX
+1052 : 18 __ __ CLC
+1053 : b5 00 __ LDA $00,x
+1055 : 65 1b __ ADC ACCU + 0
+1057 : 95 00 __ STA $00,x
+1059 : b5 01 __ LDA $01,x
+105b : 65 1c __ ADC ACCU + 1
+105d : 95 01 __ STA $01,x
+105f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1062 : b1 19 __ LDA (IP + 0),y
+1064 : c8 __ __ INY
+1065 : aa __ __ TAX
+1066 : 18 __ __ CLC
+1067 : b5 00 __ LDA $00,x
+1069 : 71 19 __ ADC (IP + 0),y
+106b : c8 __ __ INY
+106c : 95 00 __ STA $00,x
+106e : b5 01 __ LDA $01,x
+1070 : 71 19 __ ADC (IP + 0),y
+1072 : 95 01 __ STA $01,x
+1074 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1077 : b1 19 __ LDA (IP + 0),y
+1079 : c8 __ __ INY
+107a : aa __ __ TAX
+107b : b5 00 __ LDA $00,x
+107d : 31 19 __ AND (IP + 0),y
+107f : c8 __ __ INY
+1080 : 95 00 __ STA $00,x
+1082 : b5 01 __ LDA $01,x
+1084 : 31 19 __ AND (IP + 0),y
+1086 : 95 01 __ STA $01,x
+1088 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+108b : b1 19 __ LDA (IP + 0),y
+108d : c8 __ __ INY
+108e : aa __ __ TAX
+108f : a9 00 __ LDA #$00
+1091 : 85 05 __ STA $05
+1093 : 85 06 __ STA $06
+1095 : b5 00 __ LDA $00,x
+1097 : 85 03 __ STA $03
+1099 : b5 01 __ LDA $01,x
+109b : 85 04 __ STA $04
+109d : b1 19 __ LDA (IP + 0),y
+109f : 4a __ __ LSR
+10a0 : 85 07 __ STA $07
+10a2 : 90 0d __ BCC $10b1
+10a4 : 18 __ __ CLC
+10a5 : a5 05 __ LDA $05
+10a7 : 65 03 __ ADC $03
+10a9 : 85 05 __ STA $05
+10ab : a5 06 __ LDA $06
+10ad : 65 04 __ ADC $04
+10af : 85 06 __ STA $06
+10b1 : 06 03 __ ASL $03
+10b3 : 26 04 __ ROL $04
+10b5 : 46 07 __ LSR $07
+10b7 : b0 eb __ BCS $10a4
+10b9 : d0 f6 __ BNE $10b1
+10bb : a5 05 __ LDA $05
+10bd : 95 00 __ STA $00,x
+10bf : a5 06 __ LDA $06
+10c1 : 95 01 __ STA $01,x
+10c3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_8:
+10c6 : b1 19 __ LDA (IP + 0),y
+10c8 : c8 __ __ INY
+10c9 : aa __ __ TAX
+10ca : b5 00 __ LDA $00,x
+10cc : 31 19 __ AND (IP + 0),y
+10ce : 95 00 __ STA $00,x
+10d0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+10d3 : b1 19 __ LDA (IP + 0),y
+10d5 : aa __ __ TAX
+10d6 : b5 00 __ LDA $00,x
+10d8 : 2c b1 19 BIT $19b1 ; (larr + 115)
+10db : 29 0f __ AND #$0f
+10dd : f0 0b __ BEQ $10ea
+10df : aa __ __ TAX
+10e0 : a5 1c __ LDA ACCU + 1
+10e2 : 06 1b __ ASL ACCU + 0
+10e4 : 2a __ __ ROL
+10e5 : ca __ __ DEX
+10e6 : d0 fa __ BNE $10e2
+10e8 : 85 1c __ STA ACCU + 1
+10ea : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+10ed : b1 19 __ LDA (IP + 0),y
+10ef : aa __ __ TAX
+10f0 : 38 __ __ SEC
+10f1 : b5 01 __ LDA $01,x
+10f3 : e5 1c __ SBC ACCU + 1
+10f5 : f0 11 __ BEQ $1108
+10f7 : 50 02 __ BVC $10fb
+10f9 : 49 80 __ EOR #$80
+10fb : 30 2a __ BMI $1127
+10fd : 10 33 __ BPL $1132
+10ff : b1 19 __ LDA (IP + 0),y
+1101 : aa __ __ TAX
+1102 : b5 01 __ LDA $01,x
+1104 : c5 1c __ CMP ACCU + 1
+1106 : d0 28 __ BNE $1130
+1108 : b5 00 __ LDA $00,x
+110a : c5 1b __ CMP ACCU + 0
+110c : d0 22 __ BNE $1130
+110e : f0 0e __ BEQ $111e
+1110 : b1 19 __ LDA (IP + 0),y
+1112 : aa __ __ TAX
+1113 : c8 __ __ INY
+1114 : b1 19 __ LDA (IP + 0),y
+1116 : c5 1c __ CMP ACCU + 1
+1118 : d0 16 __ BNE $1130
+111a : e4 1b __ CPX ACCU + 0
+111c : d0 12 __ BNE $1130
+111e : a9 00 __ LDA #$00
+1120 : 85 1b __ STA ACCU + 0
+1122 : 85 1c __ STA ACCU + 1
+1124 : 4c 50 08 JMP $0850 ; (startup + 79)
+1127 : a9 ff __ LDA #$ff
+1129 : 85 1b __ STA ACCU + 0
+112b : 85 1c __ STA ACCU + 1
+112d : 4c 50 08 JMP $0850 ; (startup + 79)
+1130 : 90 f5 __ BCC $1127
+1132 : a9 01 __ LDA #$01
+1134 : 85 1b __ STA ACCU + 0
+1136 : a9 00 __ LDA #$00
+1138 : 85 1c __ STA ACCU + 1
+113a : 4c 50 08 JMP $0850 ; (startup + 79)
+113d : b1 19 __ LDA (IP + 0),y
+113f : c8 __ __ INY
+1140 : aa __ __ TAX
+1141 : b1 19 __ LDA (IP + 0),y
+1143 : 38 __ __ SEC
+1144 : e5 1c __ SBC ACCU + 1
+1146 : d0 af __ BNE $10f7
+1148 : e4 1b __ CPX ACCU + 0
+114a : d0 e4 __ BNE $1130
+114c : f0 d0 __ BEQ $111e
+114e : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+114f : b1 19 __ LDA (IP + 0),y
+1151 : 30 0c __ BMI $115f
+1153 : 38 __ __ SEC
+1154 : 65 19 __ ADC IP + 0
+1156 : 85 19 __ STA IP + 0
+1158 : 90 02 __ BCC $115c
+115a : e6 1a __ INC IP + 1
+115c : 4c 51 08 JMP $0851 ; (startup + 80)
+115f : 38 __ __ SEC
+1160 : 65 19 __ ADC IP + 0
+1162 : 85 19 __ STA IP + 0
+1164 : b0 02 __ BCS $1168
+1166 : c6 1a __ DEC IP + 1
+1168 : 4c 51 08 JMP $0851 ; (startup + 80)
+116b : a5 1b __ LDA ACCU + 0
+116d : 05 1c __ ORA ACCU + 1
+116f : f0 de __ BEQ $114f
+1171 : 4c 50 08 JMP $0850 ; (startup + 79)
+1174 : a5 1b __ LDA ACCU + 0
+1176 : 05 1c __ ORA ACCU + 1
+1178 : d0 d5 __ BNE $114f
+117a : 4c 50 08 JMP $0850 ; (startup + 79)
+117d : a5 1c __ LDA ACCU + 1
+117f : 30 04 __ BMI $1185
+1181 : 05 1b __ ORA ACCU + 0
+1183 : d0 ca __ BNE $114f
+1185 : 4c 50 08 JMP $0850 ; (startup + 79)
+1188 : a5 1c __ LDA ACCU + 1
+118a : 10 c3 __ BPL $114f
+118c : 4c 50 08 JMP $0850 ; (startup + 79)
+118f : a5 1c __ LDA ACCU + 1
+1191 : 30 bc __ BMI $114f
+1193 : 4c 50 08 JMP $0850 ; (startup + 79)
+1196 : a5 1c __ LDA ACCU + 1
+1198 : 30 b5 __ BMI $114f
+119a : 05 1b __ ORA ACCU + 0
+119c : f0 b1 __ BEQ $114f
+119e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+11a1 : 38 __ __ SEC
+11a2 : b1 19 __ LDA (IP + 0),y
+11a4 : 65 19 __ ADC IP + 0
+11a6 : aa __ __ TAX
+11a7 : c8 __ __ INY
+11a8 : b1 19 __ LDA (IP + 0),y
+11aa : 65 1a __ ADC IP + 1
+11ac : 85 1a __ STA IP + 1
+11ae : 86 19 __ STX IP + 0
+11b0 : 4c 51 08 JMP $0851 ; (startup + 80)
+11b3 : a5 1b __ LDA ACCU + 0
+11b5 : 05 1c __ ORA ACCU + 1
+11b7 : f0 e8 __ BEQ $11a1
+11b9 : c8 __ __ INY
+11ba : 4c 50 08 JMP $0850 ; (startup + 79)
+11bd : a5 1b __ LDA ACCU + 0
+11bf : 05 1c __ ORA ACCU + 1
+11c1 : d0 de __ BNE $11a1
+11c3 : c8 __ __ INY
+11c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+11c7 : a5 1c __ LDA ACCU + 1
+11c9 : 30 04 __ BMI $11cf
+11cb : 05 1b __ ORA ACCU + 0
+11cd : d0 d2 __ BNE $11a1
+11cf : c8 __ __ INY
+11d0 : 4c 50 08 JMP $0850 ; (startup + 79)
+11d3 : a5 1c __ LDA ACCU + 1
+11d5 : 10 ca __ BPL $11a1
+11d7 : c8 __ __ INY
+11d8 : 4c 50 08 JMP $0850 ; (startup + 79)
+11db : a5 1c __ LDA ACCU + 1
+11dd : 30 c2 __ BMI $11a1
+11df : c8 __ __ INY
+11e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+11e3 : a5 1c __ LDA ACCU + 1
+11e5 : 30 ba __ BMI $11a1
+11e7 : 05 1b __ ORA ACCU + 0
+11e9 : f0 b6 __ BEQ $11a1
+11eb : c8 __ __ INY
+11ec : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+11ef : b1 19 __ LDA (IP + 0),y
+11f1 : 8d 05 12 STA $1205 ; (inp_jsr + 22)
+11f4 : c8 __ __ INY
+11f5 : b1 19 __ LDA (IP + 0),y
+11f7 : 8d 06 12 STA $1206 ; (inp_jsr + 23)
+11fa : 98 __ __ TYA
+11fb : 38 __ __ SEC
+11fc : 65 19 __ ADC IP + 0
+11fe : 85 19 __ STA IP + 0
+1200 : 90 02 __ BCC $1204
+1202 : e6 1a __ INC IP + 1
+1204 : 20 00 00 JSR $0000 
+1207 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+120a : 98 __ __ TYA
+120b : 18 __ __ CLC
+120c : 65 19 __ ADC IP + 0
+120e : 8d 19 12 STA $1219 ; (inp_native + 15)
+1211 : a5 1a __ LDA IP + 1
+1213 : 69 00 __ ADC #$00
+1215 : 8d 1a 12 STA $121a ; (inp_native + 16)
+1218 : 20 00 00 JSR $0000 
+121b : a0 00 __ LDY #$00
+121d : b1 23 __ LDA (SP + 0),y
+121f : 85 19 __ STA IP + 0
+1221 : c8 __ __ INY
+1222 : b1 23 __ LDA (SP + 0),y
+1224 : 85 1a __ STA IP + 1
+1226 : 88 __ __ DEY
+1227 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+122a : 38 __ __ SEC
+122b : a5 23 __ LDA SP + 0
+122d : f1 19 __ SBC (IP + 0),y
+122f : c8 __ __ INY
+1230 : 85 23 __ STA SP + 0
+1232 : a5 24 __ LDA SP + 1
+1234 : f1 19 __ SBC (IP + 0),y
+1236 : c8 __ __ INY
+1237 : 85 24 __ STA SP + 1
+1239 : b1 19 __ LDA (IP + 0),y
+123b : 84 02 __ STY $02
+123d : a8 __ __ TAY
+123e : a5 25 __ LDA FP + 0
+1240 : 91 23 __ STA (SP + 0),y
+1242 : c8 __ __ INY
+1243 : a5 26 __ LDA FP + 1
+1245 : 91 23 __ STA (SP + 0),y
+1247 : 98 __ __ TYA
+1248 : 38 __ __ SEC
+1249 : 65 23 __ ADC SP + 0
+124b : 85 25 __ STA FP + 0
+124d : a9 00 __ LDA #$00
+124f : 65 24 __ ADC SP + 1
+1251 : 85 26 __ STA FP + 1
+1253 : 88 __ __ DEY
+1254 : f0 08 __ BEQ $125e
+1256 : b9 52 00 LDA $0052,y 
+1259 : 88 __ __ DEY
+125a : 91 23 __ STA (SP + 0),y
+125c : d0 f8 __ BNE $1256
+125e : a4 02 __ LDY $02
+1260 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+1263 : b1 19 __ LDA (IP + 0),y
+1265 : c8 __ __ INY
+1266 : 84 02 __ STY $02
+1268 : a8 __ __ TAY
+1269 : b1 23 __ LDA (SP + 0),y
+126b : 85 25 __ STA FP + 0
+126d : c8 __ __ INY
+126e : b1 23 __ LDA (SP + 0),y
+1270 : 85 26 __ STA FP + 1
+1272 : 88 __ __ DEY
+1273 : f0 09 __ BEQ $127e
+1275 : 88 __ __ DEY
+1276 : b1 23 __ LDA (SP + 0),y
+1278 : 99 53 00 STA $0053,y 
+127b : 88 __ __ DEY
+127c : 10 f8 __ BPL $1276
+127e : a4 02 __ LDY $02
+1280 : 18 __ __ CLC
+1281 : b1 19 __ LDA (IP + 0),y
+1283 : c8 __ __ INY
+1284 : 65 23 __ ADC SP + 0
+1286 : 85 23 __ STA SP + 0
+1288 : b1 19 __ LDA (IP + 0),y
+128a : c8 __ __ INY
+128b : 65 24 __ ADC SP + 1
+128d : 85 24 __ STA SP + 1
+128f : a0 01 __ LDY #$01
+1291 : b1 23 __ LDA (SP + 0),y
+1293 : 85 1a __ STA IP + 1
+1295 : 88 __ __ DEY
+1296 : b1 23 __ LDA (SP + 0),y
+1298 : 85 19 __ STA IP + 0
+129a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+129d : b1 19 __ LDA (IP + 0),y
+129f : 85 1f __ STA ADDR + 0
+12a1 : c8 __ __ INY
+12a2 : b1 19 __ LDA (IP + 0),y
+12a4 : 85 20 __ STA ADDR + 1
+12a6 : c8 __ __ INY
+12a7 : 98 __ __ TYA
+12a8 : a0 00 __ LDY #$00
+12aa : 18 __ __ CLC
+12ab : 65 19 __ ADC IP + 0
+12ad : 91 23 __ STA (SP + 0),y
+12af : c8 __ __ INY
+12b0 : a5 1a __ LDA IP + 1
+12b2 : 69 00 __ ADC #$00
+12b4 : 91 23 __ STA (SP + 0),y
+12b6 : a5 1f __ LDA ADDR + 0
+12b8 : 85 19 __ STA IP + 0
+12ba : a5 20 __ LDA ADDR + 1
+12bc : 85 1a __ STA IP + 1
+12be : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+12c1 : 38 __ __ SEC
+12c2 : a5 23 __ LDA SP + 0
+12c4 : f1 19 __ SBC (IP + 0),y
+12c6 : c8 __ __ INY
+12c7 : 85 23 __ STA SP + 0
+12c9 : a5 24 __ LDA SP + 1
+12cb : f1 19 __ SBC (IP + 0),y
+12cd : 85 24 __ STA SP + 1
+12cf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+12d2 : 18 __ __ CLC
+12d3 : b1 19 __ LDA (IP + 0),y
+12d5 : c8 __ __ INY
+12d6 : 65 23 __ ADC SP + 0
+12d8 : 85 23 __ STA SP + 0
+12da : b1 19 __ LDA (IP + 0),y
+12dc : 65 24 __ ADC SP + 1
+12de : 85 24 __ STA SP + 1
+12e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+12e3 : b1 19 __ LDA (IP + 0),y
+12e5 : c8 __ __ INY
+12e6 : 8d f4 12 STA $12f4 ; (inp_op_extrt + 17)
+12e9 : b1 19 __ LDA (IP + 0),y
+12eb : c8 __ __ INY
+12ec : 8d f5 12 STA $12f5 ; (inp_op_extrt + 18)
+12ef : b1 19 __ LDA (IP + 0),y
+12f1 : c8 __ __ INY
+12f2 : aa __ __ TAX
+12f3 : 20 00 00 JSR $0000 
+12f6 : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,140 @@
+#include <assert.h>
+
+struct Point
+{
+	int		x, y;
+	char	c;
+};
+
+struct Point	points[100];
+int				grid[10 * 40];
+char			flags[300];
+long			larr[100];
+int				big[300];
+int				llimit = 16384, nlimit = -20000;
+
+void fill(int n)
+{
+	for (int i = 0; i < n; i++)
+	{
+		points[i].x = i;
+		points[i].y = 2 * i;
+		points[i].c = i & 7;
+	}
+}
+
+int sumx(int n)
+{
+	int	s = 0;
+	for (int i = 0; i < n; i++)
+		s += points[i].x + points[i].y;
+	return s;
+}
+
+int sumrow(int row, int from, int to)
+{
+	int	s = 0;
+	for (int i = from; i <= to; i++)
+		s += grid[row * 40 + i];
+	return s;
+}
+
+int sumback(int n)
+{
+	int	s = 0;
+	for (int i = n - 1; i >= 0; i--)
+		s += points[i].c;
+	return s;
+}
+
+int sumptr(const int * p, int n)
+{
+	int	s = 0;
+	for (int i = 0; i < n; i++)
+		s += p[2 * i];
+	return s;
+}
+
+int firstflag(int n)
+{
+	int	i = 0;
+	while (i < n && !flags[3 * i])
+		i++;
+	return i;
+}
+
+int sumodd(int n)
+{
+	int	s = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (i & 1)
+			s += points[i].y;
+	}
+	return s;
+}
+
+void incuntil(int n)
+{
+	for (int i = 0; i < n; i++)
+	{
+		if (larr[i] == 0)
+			break;
+		larr[i]++;
+	}
+}
+
+void storeonce(int n)
+{
+	int	i = 0;
+	do {
+		big[i] = 7;
+		i++;
+	} while (i < n);
+}
+
+int main(void)
+{
+	fill(100);
+
+	assert(sumx(100) == 3 * 4950);
+	assert(sumx(0) == 0);
+
+	for (int i = 0; i < 10 * 40; i++)
+		grid[i] = i;
+
+	assert(sumrow(2, 0, 39) == 40 * 80 + 780);
+	assert(sumrow(9, 5, 5) == 365);
+
+	int	s = 0;
+	for (int i = 0; i < 100; i++)
+		s += i & 7;
+	assert(sumback(100) == s);
+
+	assert(sumptr(grid, 10) == 90);
+
+	flags[3 * 57] = 1;
+	assert(firstflag(100) == 57);
+	assert(firstflag(20) == 20);
+
+	assert(sumodd(100) == 2 * 2500);
+
+	for (int i = 0; i < 100; i++)
+		larr[i] = i + 1;
+	larr[10] = 0;
+	incuntil(16384);
+	assert(larr[0] == 2 && larr[9] == 11 && larr[10] == 0 && larr[11] == 12);
+	incuntil(5);
+	assert(larr[4] == 7 && larr[5] == 7);
+	incuntil(llimit);
+	assert(larr[9] == 12 && larr[10] == 0 && larr[11] == 12);
+
+	storeonce(nlimit);
+	assert(big[0] == 7 && big[1] == 0);
+	storeonce(-20000);
+	assert(big[1] == 0);
+	storeonce(3);
+	assert(big[2] == 7 && big[3] == 0);
+
+	return 0;
+}
@@ -0,0 +1,12 @@
+#include "lazyparselib.h"
+#include <string.h>
+
+void first(char * d)
+{
+	strcpy(d, "hello");
+}
+
+void second(char * d)
+{
+	strcpy(d, "hello");
+}
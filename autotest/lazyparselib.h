@@ -0,0 +1,10 @@
+#ifndef LAZYPARSELIB_H
+#define LAZYPARSELIB_H
+
+void first(char * d);
+
+void second(char * d);
+
+#pragma compile("lazyparselib.c")
+
+#endif
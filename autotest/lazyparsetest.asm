@@ -0,0 +1,504 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 04 0d STX $0d04 ; (spentry + 0)
+0811 : a9 05 __ LDA #$05
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0d __ LDA #$0d
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0d __ LDA #$0d
+081c : e9 0d __ SBC #$0d
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 05 __ LDA #$05
+0832 : e9 05 __ SBC #$05
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 12
+0a04:	PUSH	#$0004
+0a07:	LEA	T0, 0(FP)
+0a0b:	MOV	2(SP), T0
+0a0e:	CALL	second + 0
+0a11:	MOV	ACCU, T0
+0a13:	MOV	P0, ACCU
+0a15:	LEA	P2, $0aa7
+0a19:	JSR	strcmp + 0
+0a1c:	SEQ
+0a1d:	MOVB	2(SP), ACCU
+0a20:	CALL	assert + 0
+0a23:	MOV	ACCU, #0
+0a26:	POP	#$0004
+0a29:	RETURN	0, 12
+--------------------------------------------------------------------
+second:
+0a2d:	ENTER	0, 2
+0a31:	MOV	ADDR, 2(FP)
+0a34:	LEA	ACCU, $0a3d
+0a38:	STRCPY
+0a39:	RETURN	0, 2
+--------------------------------------------------------------------
+assert:
+0a3e:	ENTER	0, 2
+0a42:	PUSH	#$0002
+0a45:	MOVUB	ACCU, 2(FP)
+0a48:	BNE	$0A50
+0a4a:	MOV	P0, #-1
+0a4d:	CALL	exit + 0
+0a50:	POP	#$0002
+0a53:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+0a57:	ENTER	0, 2
+0a5b:	JSR	$0a62
+0a5e:	RETURN	0, 2
+--------------------------------------------------------------------
+0a62 : a5 0d __ LDA P0
+0a64 : 85 1b __ STA ACCU + 0
+0a66 : a5 0e __ LDA P1
+0a68 : 85 1c __ STA ACCU + 1
+0a6a : ae 04 0d LDX $0d04 ; (spentry + 0)
+0a6d : 9a __ __ TXS
+0a6e : a9 4c __ LDA #$4c
+0a70 : 85 54 __ STA $54
+0a72 : a9 00 __ LDA #$00
+0a74 : 85 13 __ STA P6
+0a76 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0a77 : ea __ __ NOP
+0a78 : a0 00 __ LDY #$00
+0a7a : 84 1c __ STY ACCU + 1
+0a7c : b1 0d __ LDA (P0),y
+0a7e : f0 16 __ BEQ $0a96
+0a80 : d1 0f __ CMP (P2),y
+0a82 : d0 16 __ BNE $0a9a
+0a84 : c8 __ __ INY
+0a85 : b1 0d __ LDA (P0),y
+0a87 : f0 0d __ BEQ $0a96
+0a89 : d1 0f __ CMP (P2),y
+0a8b : d0 0d __ BNE $0a9a
+0a8d : c8 __ __ INY
+0a8e : d0 ec __ BNE $0a7c
+0a90 : e6 0e __ INC P1
+0a92 : e6 10 __ INC P3
+0a94 : d0 e6 __ BNE $0a7c
+0a96 : d1 0f __ CMP (P2),y
+0a98 : f0 0a __ BEQ $0aa4
+0a9a : b0 06 __ BCS $0aa2
+0a9c : a9 ff __ LDA #$ff
+0a9e : 85 1c __ STA ACCU + 1
+0aa0 : 30 02 __ BMI $0aa4
+0aa2 : a9 01 __ LDA #$01
+0aa4 : 85 1b __ STA ACCU + 0
+0aa6 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0aad : a9 4c __ LDA #$4c
+0aaf : 85 54 __ STA $54
+0ab1 : a9 00 __ LDA #$00
+0ab3 : 85 13 __ STA P6
+0ab5 : a9 19 __ LDA #$19
+0ab7 : 85 16 __ STA P9
+0ab9 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0aba : b1 19 __ LDA (IP + 0),y
+0abc : aa __ __ TAX
+0abd : c8 __ __ INY
+0abe : b1 19 __ LDA (IP + 0),y
+0ac0 : 95 00 __ STA $00,x
+0ac2 : a9 00 __ LDA #$00
+0ac4 : 95 01 __ STA $01,x
+0ac6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+0ac9 : b1 19 __ LDA (IP + 0),y
+0acb : aa __ __ TAX
+0acc : c8 __ __ INY
+0acd : b1 19 __ LDA (IP + 0),y
+0acf : 95 00 __ STA $00,x
+0ad1 : a9 ff __ LDA #$ff
+0ad3 : 95 01 __ STA $01,x
+0ad5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0ad8 : b1 19 __ LDA (IP + 0),y
+0ada : aa __ __ TAX
+0adb : b5 00 __ LDA $00,x
+0add : 85 1b __ STA ACCU + 0
+0adf : b5 01 __ LDA $01,x
+0ae1 : 85 1c __ STA ACCU + 1
+0ae3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0ae6 : b1 19 __ LDA (IP + 0),y
+0ae8 : aa __ __ TAX
+0ae9 : a5 1b __ LDA ACCU + 0
+0aeb : 95 00 __ STA $00,x
+0aed : a5 1c __ LDA ACCU + 1
+0aef : 95 01 __ STA $01,x
+0af1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs:
+0af4 : b1 19 __ LDA (IP + 0),y
+0af6 : aa __ __ TAX
+0af7 : c8 __ __ INY
+0af8 : b1 19 __ LDA (IP + 0),y
+0afa : 95 00 __ STA $00,x
+0afc : c8 __ __ INY
+0afd : b1 19 __ LDA (IP + 0),y
+0aff : 95 01 __ STA $01,x
+0b01 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+0b04 : b1 19 __ LDA (IP + 0),y
+0b06 : aa __ __ TAX
+0b07 : c8 __ __ INY
+0b08 : b1 19 __ LDA (IP + 0),y
+0b0a : 84 02 __ STY $02
+0b0c : a8 __ __ TAY
+0b0d : b1 25 __ LDA (FP + 0),y
+0b0f : 95 00 __ STA $00,x
+0b11 : a9 00 __ LDA #$00
+0b13 : 95 01 __ STA $01,x
+0b15 : a4 02 __ LDY $02
+0b17 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+0b1a : b1 19 __ LDA (IP + 0),y
+0b1c : aa __ __ TAX
+0b1d : c8 __ __ INY
+0b1e : b1 19 __ LDA (IP + 0),y
+0b20 : 84 02 __ STY $02
+0b22 : a8 __ __ TAY
+0b23 : b1 25 __ LDA (FP + 0),y
+0b25 : 95 00 __ STA $00,x
+0b27 : c8 __ __ INY
+0b28 : b1 25 __ LDA (FP + 0),y
+0b2a : 95 01 __ STA $01,x
+0b2c : a4 02 __ LDY $02
+0b2e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+0b31 : b1 19 __ LDA (IP + 0),y
+0b33 : aa __ __ TAX
+0b34 : c8 __ __ INY
+0b35 : 18 __ __ CLC
+0b36 : b1 19 __ LDA (IP + 0),y
+0b38 : 65 25 __ ADC FP + 0
+0b3a : 95 00 __ STA $00,x
+0b3c : c8 __ __ INY
+0b3d : b1 19 __ LDA (IP + 0),y
+0b3f : 65 26 __ ADC FP + 1
+0b41 : 95 01 __ STA $01,x
+0b43 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+0b46 : b1 19 __ LDA (IP + 0),y
+0b48 : aa __ __ TAX
+0b49 : c8 __ __ INY
+0b4a : b1 19 __ LDA (IP + 0),y
+0b4c : 84 02 __ STY $02
+0b4e : a8 __ __ TAY
+0b4f : b5 00 __ LDA $00,x
+0b51 : 91 23 __ STA (SP + 0),y
+0b53 : a4 02 __ LDY $02
+0b55 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+0b58 : b1 19 __ LDA (IP + 0),y
+0b5a : aa __ __ TAX
+0b5b : c8 __ __ INY
+0b5c : b1 19 __ LDA (IP + 0),y
+0b5e : 84 02 __ STY $02
+0b60 : a8 __ __ TAY
+0b61 : b5 00 __ LDA $00,x
+0b63 : 91 23 __ STA (SP + 0),y
+0b65 : c8 __ __ INY
+0b66 : b5 01 __ LDA $01,x
+0b68 : 91 23 __ STA (SP + 0),y
+0b6a : a4 02 __ LDY $02
+0b6c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+bra:
+0b6f : b1 19 __ LDA (IP + 0),y
+0b71 : 30 0c __ BMI $0b7f
+0b73 : 38 __ __ SEC
+0b74 : 65 19 __ ADC IP + 0
+0b76 : 85 19 __ STA IP + 0
+0b78 : 90 02 __ BCC $0b7c
+0b7a : e6 1a __ INC IP + 1
+0b7c : 4c 51 08 JMP $0851 ; (startup + 80)
+0b7f : 38 __ __ SEC
+0b80 : 65 19 __ ADC IP + 0
+0b82 : 85 19 __ STA IP + 0
+0b84 : b0 02 __ BCS $0b88
+0b86 : c6 1a __ DEC IP + 1
+0b88 : 4c 51 08 JMP $0851 ; (startup + 80)
+0b8b : a5 1b __ LDA ACCU + 0
+0b8d : 05 1c __ ORA ACCU + 1
+0b8f : f0 de __ BEQ $0b6f
+0b91 : 4c 50 08 JMP $0850 ; (startup + 79)
+0b94 : a5 1b __ LDA ACCU + 0
+0b96 : 05 1c __ ORA ACCU + 1
+0b98 : d0 d5 __ BNE $0b6f
+0b9a : 4c 50 08 JMP $0850 ; (startup + 79)
+0b9d : a5 1c __ LDA ACCU + 1
+0b9f : 30 04 __ BMI $0ba5
+0ba1 : 05 1b __ ORA ACCU + 0
+0ba3 : d0 ca __ BNE $0b6f
+0ba5 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ba8 : a5 1c __ LDA ACCU + 1
+0baa : 10 c3 __ BPL $0b6f
+0bac : 4c 50 08 JMP $0850 ; (startup + 79)
+0baf : a5 1c __ LDA ACCU + 1
+0bb1 : 30 bc __ BMI $0b6f
+0bb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+0bb6 : a5 1c __ LDA ACCU + 1
+0bb8 : 30 b5 __ BMI $0b6f
+0bba : 05 1b __ ORA ACCU + 0
+0bbc : f0 b1 __ BEQ $0b6f
+0bbe : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+0bc1 : a9 00 __ LDA #$00
+0bc3 : 2c a9 01 BIT $01a9 
+0bc6 : 85 1b __ STA ACCU + 0
+0bc8 : a9 00 __ LDA #$00
+0bca : 85 1c __ STA ACCU + 1
+0bcc : 4c 51 08 JMP $0851 ; (startup + 80)
+0bcf : a5 1b __ LDA ACCU + 0
+0bd1 : 05 1c __ ORA ACCU + 1
+0bd3 : f0 ef __ BEQ $0bc4
+0bd5 : d0 ea __ BNE $0bc1
+0bd7 : a5 1b __ LDA ACCU + 0
+0bd9 : 05 1c __ ORA ACCU + 1
+0bdb : d0 e7 __ BNE $0bc4
+0bdd : f0 e2 __ BEQ $0bc1
+0bdf : a5 1c __ LDA ACCU + 1
+0be1 : 30 de __ BMI $0bc1
+0be3 : 05 1b __ ORA ACCU + 0
+0be5 : d0 dd __ BNE $0bc4
+0be7 : f0 d8 __ BEQ $0bc1
+0be9 : a5 1c __ LDA ACCU + 1
+0beb : 10 d7 __ BPL $0bc4
+0bed : 30 d2 __ BMI $0bc1
+0bef : a5 1c __ LDA ACCU + 1
+0bf1 : 30 d1 __ BMI $0bc4
+0bf3 : 10 cc __ BPL $0bc1
+0bf5 : a5 1c __ LDA ACCU + 1
+0bf7 : 30 cb __ BMI $0bc4
+0bf9 : 05 1b __ ORA ACCU + 0
+0bfb : f0 c7 __ BEQ $0bc4
+0bfd : d0 c2 __ BNE $0bc1
+0bff : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+0c00 : b1 19 __ LDA (IP + 0),y
+0c02 : 8d 16 0c STA $0c16 ; (inp_jsr + 22)
+0c05 : c8 __ __ INY
+0c06 : b1 19 __ LDA (IP + 0),y
+0c08 : 8d 17 0c STA $0c17 ; (inp_jsr + 23)
+0c0b : 98 __ __ TYA
+0c0c : 38 __ __ SEC
+0c0d : 65 19 __ ADC IP + 0
+0c0f : 85 19 __ STA IP + 0
+0c11 : 90 02 __ BCC $0c15
+0c13 : e6 1a __ INC IP + 1
+0c15 : 20 00 00 JSR $0000 
+0c18 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+0c1b : 98 __ __ TYA
+0c1c : 18 __ __ CLC
+0c1d : 65 19 __ ADC IP + 0
+0c1f : 8d 2a 0c STA $0c2a ; (inp_native + 15)
+0c22 : a5 1a __ LDA IP + 1
+0c24 : 69 00 __ ADC #$00
+0c26 : 8d 2b 0c STA $0c2b ; (inp_native + 16)
+0c29 : 20 00 00 JSR $0000 
+0c2c : a0 00 __ LDY #$00
+0c2e : b1 23 __ LDA (SP + 0),y
+0c30 : 85 19 __ STA IP + 0
+0c32 : c8 __ __ INY
+0c33 : b1 23 __ LDA (SP + 0),y
+0c35 : 85 1a __ STA IP + 1
+0c37 : 88 __ __ DEY
+0c38 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+0c3b : 38 __ __ SEC
+0c3c : a5 23 __ LDA SP + 0
+0c3e : f1 19 __ SBC (IP + 0),y
+0c40 : c8 __ __ INY
+0c41 : 85 23 __ STA SP + 0
+0c43 : a5 24 __ LDA SP + 1
+0c45 : f1 19 __ SBC (IP + 0),y
+0c47 : c8 __ __ INY
+0c48 : 85 24 __ STA SP + 1
+0c4a : b1 19 __ LDA (IP + 0),y
+0c4c : 84 02 __ STY $02
+0c4e : a8 __ __ TAY
+0c4f : a5 25 __ LDA FP + 0
+0c51 : 91 23 __ STA (SP + 0),y
+0c53 : c8 __ __ INY
+0c54 : a5 26 __ LDA FP + 1
+0c56 : 91 23 __ STA (SP + 0),y
+0c58 : 98 __ __ TYA
+0c59 : 38 __ __ SEC
+0c5a : 65 23 __ ADC SP + 0
+0c5c : 85 25 __ STA FP + 0
+0c5e : a9 00 __ LDA #$00
+0c60 : 65 24 __ ADC SP + 1
+0c62 : 85 26 __ STA FP + 1
+0c64 : 88 __ __ DEY
+0c65 : f0 08 __ BEQ $0c6f
+0c67 : b9 52 00 LDA $0052,y 
+0c6a : 88 __ __ DEY
+0c6b : 91 23 __ STA (SP + 0),y
+0c6d : d0 f8 __ BNE $0c67
+0c6f : a4 02 __ LDY $02
+0c71 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+0c74 : b1 19 __ LDA (IP + 0),y
+0c76 : c8 __ __ INY
+0c77 : 84 02 __ STY $02
+0c79 : a8 __ __ TAY
+0c7a : b1 23 __ LDA (SP + 0),y
+0c7c : 85 25 __ STA FP + 0
+0c7e : c8 __ __ INY
+0c7f : b1 23 __ LDA (SP + 0),y
+0c81 : 85 26 __ STA FP + 1
+0c83 : 88 __ __ DEY
+0c84 : f0 09 __ BEQ $0c8f
+0c86 : 88 __ __ DEY
+0c87 : b1 23 __ LDA (SP + 0),y
+0c89 : 99 53 00 STA $0053,y 
+0c8c : 88 __ __ DEY
+0c8d : 10 f8 __ BPL $0c87
+0c8f : a4 02 __ LDY $02
+0c91 : 18 __ __ CLC
+0c92 : b1 19 __ LDA (IP + 0),y
+0c94 : c8 __ __ INY
+0c95 : 65 23 __ ADC SP + 0
+0c97 : 85 23 __ STA SP + 0
+0c99 : b1 19 __ LDA (IP + 0),y
+0c9b : c8 __ __ INY
+0c9c : 65 24 __ ADC SP + 1
+0c9e : 85 24 __ STA SP + 1
+0ca0 : a0 01 __ LDY #$01
+0ca2 : b1 23 __ LDA (SP + 0),y
+0ca4 : 85 1a __ STA IP + 1
+0ca6 : 88 __ __ DEY
+0ca7 : b1 23 __ LDA (SP + 0),y
+0ca9 : 85 19 __ STA IP + 0
+0cab : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+0cae : b1 19 __ LDA (IP + 0),y
+0cb0 : 85 1f __ STA ADDR + 0
+0cb2 : c8 __ __ INY
+0cb3 : b1 19 __ LDA (IP + 0),y
+0cb5 : 85 20 __ STA ADDR + 1
+0cb7 : c8 __ __ INY
+0cb8 : 98 __ __ TYA
+0cb9 : a0 00 __ LDY #$00
+0cbb : 18 __ __ CLC
+0cbc : 65 19 __ ADC IP + 0
+0cbe : 91 23 __ STA (SP + 0),y
+0cc0 : c8 __ __ INY
+0cc1 : a5 1a __ LDA IP + 1
+0cc3 : 69 00 __ ADC #$00
+0cc5 : 91 23 __ STA (SP + 0),y
+0cc7 : a5 1f __ LDA ADDR + 0
+0cc9 : 85 19 __ STA IP + 0
+0ccb : a5 20 __ LDA ADDR + 1
+0ccd : 85 1a __ STA IP + 1
+0ccf : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+0cd2 : 38 __ __ SEC
+0cd3 : a5 23 __ LDA SP + 0
+0cd5 : f1 19 __ SBC (IP + 0),y
+0cd7 : c8 __ __ INY
+0cd8 : 85 23 __ STA SP + 0
+0cda : a5 24 __ LDA SP + 1
+0cdc : f1 19 __ SBC (IP + 0),y
+0cde : 85 24 __ STA SP + 1
+0ce0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+0ce3 : 18 __ __ CLC
+0ce4 : b1 19 __ LDA (IP + 0),y
+0ce6 : c8 __ __ INY
+0ce7 : 65 23 __ ADC SP + 0
+0ce9 : 85 23 __ STA SP + 0
+0ceb : b1 19 __ LDA (IP + 0),y
+0ced : 65 24 __ ADC SP + 1
+0cef : 85 24 __ STA SP + 1
+0cf1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+0cf4 : 84 02 __ STY $02
+0cf6 : a0 ff __ LDY #$ff
+0cf8 : c8 __ __ INY
+0cf9 : b1 1b __ LDA (ACCU + 0),y
+0cfb : 91 1f __ STA (ADDR + 0),y
+0cfd : d0 f9 __ BNE $0cf8
+0cff : a4 02 __ LDY $02
+0d01 : 4c 51 08 JMP $0851 ; (startup + 80)
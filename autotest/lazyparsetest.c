@@ -0,0 +1,13 @@
+#include "lazyparselib.h"
+#include <string.h>
+#include <assert.h>
+
+int main(void)
+{
+	char	buffer[10];
+
+	second(buffer);
+	assert(!strcmp(buffer, "hello"));
+
+	return 0;
+}
@@ -0,0 +1,70 @@
+#include <assert.h>
+
+struct Sprite
+{
+	char	x, y, c;
+};
+
+struct Sprite	sprites[8];
+char			screen[1000];
+int				row, col;
+
+void draw(char n, char d)
+{
+	for(char i=0; i<n; i++)
+	{
+		if (d)
+			screen[row * 40 + col + i] = sprites[col].x;
+		else
+			screen[row * 40 + col - i] = sprites[col].y;
+	}
+}
+
+int alias(int * p, int n)
+{
+	int	s = 0;
+
+	for(int i=0; i<n; i++)
+	{
+		if (i & 1)
+			*p += 1;
+		s += row + *p;
+	}
+
+	return s;
+}
+
+void move(char n)
+{
+	for(char i=0; i<n; i++)
+	{
+		if (i == 2)
+			col++;
+		screen[i] = col;
+	}
+}
+
+int main(void)
+{
+	sprites[3].x = 5;
+	sprites[3].y = 9;
+
+	row = 2;
+	col = 3;
+	draw(4, 1);
+	draw(3, 0);
+
+	assert(screen[81] == 9 && screen[82] == 9 && screen[83] == 9);
+	assert(screen[84] == 5 && screen[85] == 5 && screen[86] == 5);
+	assert(screen[80] == 0 && screen[87] == 0);
+
+	row = 1;
+	assert(alias(&row, 4) == 16);
+	assert(row == 3);
+
+	col = 0;
+	move(5);
+	assert(screen[0] == 0 && screen[1] == 0 && screen[2] == 1 && screen[4] == 1);
+
+	return 0;
+}
@@ -0,0 +1,3926 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e c8 25 STX $25c8 ; (spentry + 0)
+0811 : a9 cc __ LDA #$cc
+0813 : 85 19 __ STA IP + 0
+0815 : a9 25 __ LDA #$25
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 54 __ LDA #$54
+081c : e9 25 __ SBC #$25
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ac __ LDA #$ac
+0832 : e9 cc __ SBC #$cc
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 75 21 JMP $2175 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 02 __ SBC #$02
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : 38 __ __ SEC
+090e : a5 23 __ LDA SP + 0
+0910 : e9 06 __ SBC #$06
+0912 : 85 23 __ STA SP + 0
+0914 : a5 24 __ LDA SP + 1
+0916 : e9 00 __ SBC #$00
+0918 : 85 24 __ STA SP + 1
+091a : a9 cc __ LDA #$cc
+091c : a0 02 __ LDY #$02
+091e : 91 23 __ STA (SP + 0),y
+0920 : a9 25 __ LDA #$25
+0922 : c8 __ __ INY
+0923 : 91 23 __ STA (SP + 0),y
+0925 : a9 e8 __ LDA #$e8
+0927 : c8 __ __ INY
+0928 : 91 23 __ STA (SP + 0),y
+092a : a9 03 __ LDA #$03
+092c : c8 __ __ INY
+092d : 91 23 __ STA (SP + 0),y
+092f : 20 9b 09 JSR $099b ; (init + 0)
+0932 : a9 cc __ LDA #$cc
+0934 : a0 02 __ LDY #$02
+0936 : 91 23 __ STA (SP + 0),y
+0938 : a9 25 __ LDA #$25
+093a : c8 __ __ INY
+093b : 91 23 __ STA (SP + 0),y
+093d : a9 e8 __ LDA #$e8
+093f : c8 __ __ INY
+0940 : 91 23 __ STA (SP + 0),y
+0942 : a9 03 __ LDA #$03
+0944 : c8 __ __ INY
+0945 : 91 23 __ STA (SP + 0),y
+0947 : 20 07 1d JSR $1d07 ; (shuffle + 0)
+094a : a9 cc __ LDA #$cc
+094c : a0 02 __ LDY #$02
+094e : 91 23 __ STA (SP + 0),y
+0950 : a9 25 __ LDA #$25
+0952 : c8 __ __ INY
+0953 : 91 23 __ STA (SP + 0),y
+0955 : a9 e8 __ LDA #$e8
+0957 : c8 __ __ INY
+0958 : 91 23 __ STA (SP + 0),y
+095a : a9 03 __ LDA #$03
+095c : c8 __ __ INY
+095d : 91 23 __ STA (SP + 0),y
+095f : 20 24 1e JSR $1e24 ; (qsort + 0)
+0962 : a9 cc __ LDA #$cc
+0964 : a0 02 __ LDY #$02
+0966 : 91 23 __ STA (SP + 0),y
+0968 : a9 25 __ LDA #$25
+096a : c8 __ __ INY
+096b : 91 23 __ STA (SP + 0),y
+096d : a9 e8 __ LDA #$e8
+096f : c8 __ __ INY
+0970 : 91 23 __ STA (SP + 0),y
+0972 : a9 03 __ LDA #$03
+0974 : c8 __ __ INY
+0975 : 91 23 __ STA (SP + 0),y
+0977 : 20 a6 20 JSR $20a6 ; (check + 0)
+097a : a9 00 __ LDA #$00
+097c : 85 1b __ STA ACCU + 0
+097e : 85 1c __ STA ACCU + 1
+0980 : 18 __ __ CLC
+0981 : a5 23 __ LDA SP + 0
+0983 : 69 06 __ ADC #$06
+0985 : 85 23 __ STA SP + 0
+0987 : a5 24 __ LDA SP + 1
+0989 : 69 00 __ ADC #$00
+098b : 85 24 __ STA SP + 1
+098d : 18 __ __ CLC
+098e : a5 23 __ LDA SP + 0
+0990 : 69 02 __ ADC #$02
+0992 : 85 23 __ STA SP + 0
+0994 : a5 24 __ LDA SP + 1
+0996 : 69 00 __ ADC #$00
+0998 : 85 24 __ STA SP + 1
+099a : 60 __ __ RTS
+--------------------------------------------------------------------
+init:
+099b : 38 __ __ SEC
+099c : a5 23 __ LDA SP + 0
+099e : e9 08 __ SBC #$08
+09a0 : 85 23 __ STA SP + 0
+09a2 : a5 24 __ LDA SP + 1
+09a4 : e9 00 __ SBC #$00
+09a6 : 85 24 __ STA SP + 1
+09a8 : a0 05 __ LDY #$05
+09aa : b9 53 00 LDA $0053,y 
+09ad : 91 23 __ STA (SP + 0),y
+09af : 88 __ __ DEY
+09b0 : 10 f8 __ BPL $09aa
+09b2 : 38 __ __ SEC
+09b3 : a5 23 __ LDA SP + 0
+09b5 : e9 08 __ SBC #$08
+09b7 : 85 23 __ STA SP + 0
+09b9 : a5 24 __ LDA SP + 1
+09bb : e9 00 __ SBC #$00
+09bd : 85 24 __ STA SP + 1
+09bf : a0 14 __ LDY #$14
+09c1 : b1 23 __ LDA (SP + 0),y
+09c3 : 85 53 __ STA T0 + 0
+09c5 : c8 __ __ INY
+09c6 : b1 23 __ LDA (SP + 0),y
+09c8 : 30 04 __ BMI $09ce
+09ca : 05 53 __ ORA T0 + 0
+09cc : d0 25 __ BNE $09f3
+09ce : 18 __ __ CLC
+09cf : a5 23 __ LDA SP + 0
+09d1 : 69 08 __ ADC #$08
+09d3 : 85 23 __ STA SP + 0
+09d5 : a5 24 __ LDA SP + 1
+09d7 : 69 00 __ ADC #$00
+09d9 : 85 24 __ STA SP + 1
+09db : a0 05 __ LDY #$05
+09dd : b1 23 __ LDA (SP + 0),y
+09df : 99 53 00 STA $0053,y 
+09e2 : 88 __ __ DEY
+09e3 : 10 f8 __ BPL $09dd
+09e5 : 18 __ __ CLC
+09e6 : a5 23 __ LDA SP + 0
+09e8 : 69 08 __ ADC #$08
+09ea : 85 23 __ STA SP + 0
+09ec : a5 24 __ LDA SP + 1
+09ee : 69 00 __ ADC #$00
+09f0 : 85 24 __ STA SP + 1
+09f2 : 60 __ __ RTS
+09f3 : a9 00 __ LDA #$00
+09f5 : 85 53 __ STA T0 + 0
+09f7 : 85 54 __ STA T0 + 1
+09f9 : a0 14 __ LDY #$14
+09fb : b1 23 __ LDA (SP + 0),y
+09fd : 85 55 __ STA T2 + 0
+09ff : c8 __ __ INY
+0a00 : b1 23 __ LDA (SP + 0),y
+0a02 : 85 56 __ STA T2 + 1
+0a04 : a0 12 __ LDY #$12
+0a06 : b1 23 __ LDA (SP + 0),y
+0a08 : 85 57 __ STA T4 + 0
+0a0a : c8 __ __ INY
+0a0b : b1 23 __ LDA (SP + 0),y
+0a0d : 85 58 __ STA T4 + 1
+0a0f : a5 53 __ LDA T0 + 0
+0a11 : 0a __ __ ASL
+0a12 : aa __ __ TAX
+0a13 : a5 54 __ LDA T0 + 1
+0a15 : 2a __ __ ROL
+0a16 : a8 __ __ TAY
+0a17 : 18 __ __ CLC
+0a18 : 8a __ __ TXA
+0a19 : 65 53 __ ADC T0 + 0
+0a1b : 85 1b __ STA ACCU + 0
+0a1d : 98 __ __ TYA
+0a1e : 65 54 __ ADC T0 + 1
+0a20 : 06 1b __ ASL ACCU + 0
+0a22 : 2a __ __ ROL
+0a23 : 06 1b __ ASL ACCU + 0
+0a25 : 2a __ __ ROL
+0a26 : 85 1c __ STA ACCU + 1
+0a28 : 18 __ __ CLC
+0a29 : a5 57 __ LDA T4 + 0
+0a2b : 65 1b __ ADC ACCU + 0
+0a2d : 85 44 __ STA T5 + 0
+0a2f : a5 58 __ LDA T4 + 1
+0a31 : 65 1c __ ADC ACCU + 1
+0a33 : 85 45 __ STA T5 + 1
+0a35 : a5 53 __ LDA T0 + 0
+0a37 : a0 00 __ LDY #$00
+0a39 : 91 44 __ STA (T5 + 0),y
+0a3b : a5 54 __ LDA T0 + 1
+0a3d : c8 __ __ INY
+0a3e : 91 44 __ STA (T5 + 0),y
+0a40 : 18 __ __ CLC
+0a41 : a5 44 __ LDA T5 + 0
+0a43 : 69 02 __ ADC #$02
+0a45 : c8 __ __ INY
+0a46 : 91 23 __ STA (SP + 0),y
+0a48 : a5 45 __ LDA T5 + 1
+0a4a : 69 00 __ ADC #$00
+0a4c : c8 __ __ INY
+0a4d : 91 23 __ STA (SP + 0),y
+0a4f : a9 02 __ LDA #$02
+0a51 : c8 __ __ INY
+0a52 : 91 23 __ STA (SP + 0),y
+0a54 : a9 1d __ LDA #$1d
+0a56 : c8 __ __ INY
+0a57 : 91 23 __ STA (SP + 0),y
+0a59 : a5 53 __ LDA T0 + 0
+0a5b : c8 __ __ INY
+0a5c : 91 23 __ STA (SP + 0),y
+0a5e : a5 54 __ LDA T0 + 1
+0a60 : c8 __ __ INY
+0a61 : 91 23 __ STA (SP + 0),y
+0a63 : 20 83 0a JSR $0a83 ; (sprintf + 0)
+0a66 : e6 53 __ INC T0 + 0
+0a68 : d0 02 __ BNE $0a6c
+0a6a : e6 54 __ INC T0 + 1
+0a6c : a5 56 __ LDA T2 + 1
+0a6e : 49 80 __ EOR #$80
+0a70 : 85 03 __ STA $03
+0a72 : a5 54 __ LDA T0 + 1
+0a74 : 49 80 __ EOR #$80
+0a76 : c5 03 __ CMP $03
+0a78 : d0 04 __ BNE $0a7e
+0a7a : a5 53 __ LDA T0 + 0
+0a7c : c5 55 __ CMP T2 + 0
+0a7e : 90 8f __ BCC $0a0f
+0a80 : 4c ce 09 JMP $09ce ; (init + 51)
+--------------------------------------------------------------------
+sprintf:
+0a83 : 38 __ __ SEC
+0a84 : a5 23 __ LDA SP + 0
+0a86 : e9 09 __ SBC #$09
+0a88 : 85 23 __ STA SP + 0
+0a8a : a5 24 __ LDA SP + 1
+0a8c : e9 00 __ SBC #$00
+0a8e : 85 24 __ STA SP + 1
+0a90 : a0 0b __ LDY #$0b
+0a92 : b1 23 __ LDA (SP + 0),y
+0a94 : a0 02 __ LDY #$02
+0a96 : 91 23 __ STA (SP + 0),y
+0a98 : a0 0c __ LDY #$0c
+0a9a : b1 23 __ LDA (SP + 0),y
+0a9c : a0 03 __ LDY #$03
+0a9e : 91 23 __ STA (SP + 0),y
+0aa0 : a0 0d __ LDY #$0d
+0aa2 : b1 23 __ LDA (SP + 0),y
+0aa4 : a0 04 __ LDY #$04
+0aa6 : 91 23 __ STA (SP + 0),y
+0aa8 : a0 0e __ LDY #$0e
+0aaa : b1 23 __ LDA (SP + 0),y
+0aac : a0 05 __ LDY #$05
+0aae : 91 23 __ STA (SP + 0),y
+0ab0 : 18 __ __ CLC
+0ab1 : a5 23 __ LDA SP + 0
+0ab3 : 69 0f __ ADC #$0f
+0ab5 : c8 __ __ INY
+0ab6 : 91 23 __ STA (SP + 0),y
+0ab8 : a5 24 __ LDA SP + 1
+0aba : 69 00 __ ADC #$00
+0abc : c8 __ __ INY
+0abd : 91 23 __ STA (SP + 0),y
+0abf : a9 00 __ LDA #$00
+0ac1 : c8 __ __ INY
+0ac2 : 91 23 __ STA (SP + 0),y
+0ac4 : 20 ed 0a JSR $0aed ; (sformat + 0)
+0ac7 : a0 0b __ LDY #$0b
+0ac9 : b1 23 __ LDA (SP + 0),y
+0acb : 85 45 __ STA T1 + 0
+0acd : c8 __ __ INY
+0ace : b1 23 __ LDA (SP + 0),y
+0ad0 : 85 46 __ STA T1 + 1
+0ad2 : 38 __ __ SEC
+0ad3 : a5 1b __ LDA ACCU + 0
+0ad5 : e5 45 __ SBC T1 + 0
+0ad7 : 85 1b __ STA ACCU + 0
+0ad9 : a5 1c __ LDA ACCU + 1
+0adb : e5 46 __ SBC T1 + 1
+0add : 85 1c __ STA ACCU + 1
+0adf : 18 __ __ CLC
+0ae0 : a5 23 __ LDA SP + 0
+0ae2 : 69 09 __ ADC #$09
+0ae4 : 85 23 __ STA SP + 0
+0ae6 : a5 24 __ LDA SP + 1
+0ae8 : 69 00 __ ADC #$00
+0aea : 85 24 __ STA SP + 1
+0aec : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0aed : 38 __ __ SEC
+0aee : a5 23 __ LDA SP + 0
+0af0 : e9 0e __ SBC #$0e
+0af2 : 85 23 __ STA SP + 0
+0af4 : a5 24 __ LDA SP + 1
+0af6 : e9 00 __ SBC #$00
+0af8 : 85 24 __ STA SP + 1
+0afa : a0 05 __ LDY #$05
+0afc : b9 53 00 LDA $0053,y 
+0aff : 91 23 __ STA (SP + 0),y
+0b01 : 88 __ __ DEY
+0b02 : 10 f8 __ BPL $0afc
+0b04 : a0 10 __ LDY #$10
+0b06 : b1 23 __ LDA (SP + 0),y
+0b08 : 85 53 __ STA T0 + 0
+0b0a : c8 __ __ INY
+0b0b : b1 23 __ LDA (SP + 0),y
+0b0d : 85 54 __ STA T0 + 1
+0b0f : a9 00 __ LDA #$00
+0b11 : 85 55 __ STA T1 + 0
+0b13 : c8 __ __ INY
+0b14 : b1 23 __ LDA (SP + 0),y
+0b16 : 85 57 __ STA T2 + 0
+0b18 : c8 __ __ INY
+0b19 : b1 23 __ LDA (SP + 0),y
+0b1b : 85 58 __ STA T2 + 1
+0b1d : a0 00 __ LDY #$00
+0b1f : b1 57 __ LDA (T2 + 0),y
+0b21 : 85 43 __ STA T3 + 0
+0b23 : d0 59 __ BNE $0b7e
+0b25 : 18 __ __ CLC
+0b26 : a5 53 __ LDA T0 + 0
+0b28 : 65 55 __ ADC T1 + 0
+0b2a : 85 57 __ STA T2 + 0
+0b2c : a5 54 __ LDA T0 + 1
+0b2e : 69 00 __ ADC #$00
+0b30 : 85 58 __ STA T2 + 1
+0b32 : a9 00 __ LDA #$00
+0b34 : a4 55 __ LDY T1 + 0
+0b36 : 91 53 __ STA (T0 + 0),y
+0b38 : 98 __ __ TYA
+0b39 : d0 20 __ BNE $0b5b
+0b3b : a5 53 __ LDA T0 + 0
+0b3d : 85 1b __ STA ACCU + 0
+0b3f : a5 54 __ LDA T0 + 1
+0b41 : 85 1c __ STA ACCU + 1
+0b43 : a0 05 __ LDY #$05
+0b45 : b1 23 __ LDA (SP + 0),y
+0b47 : 99 53 00 STA $0053,y 
+0b4a : 88 __ __ DEY
+0b4b : 10 f8 __ BPL $0b45
+0b4d : 18 __ __ CLC
+0b4e : a5 23 __ LDA SP + 0
+0b50 : 69 0e __ ADC #$0e
+0b52 : 85 23 __ STA SP + 0
+0b54 : a5 24 __ LDA SP + 1
+0b56 : 69 00 __ ADC #$00
+0b58 : 85 24 __ STA SP + 1
+0b5a : 60 __ __ RTS
+0b5b : a0 16 __ LDY #$16
+0b5d : b1 23 __ LDA (SP + 0),y
+0b5f : d0 09 __ BNE $0b6a
+0b61 : a5 57 __ LDA T2 + 0
+0b63 : 85 1b __ STA ACCU + 0
+0b65 : a5 58 __ LDA T2 + 1
+0b67 : 4c 41 0b JMP $0b41 ; (sformat + 84)
+0b6a : a5 53 __ LDA T0 + 0
+0b6c : 85 0d __ STA P0
+0b6e : a5 54 __ LDA T0 + 1
+0b70 : 85 0e __ STA P1
+0b72 : 20 20 14 JSR $1420 ; (puts + 0)
+0b75 : a5 53 __ LDA T0 + 0
+0b77 : 85 1b __ STA ACCU + 0
+0b79 : a5 54 __ LDA T0 + 1
+0b7b : 4c 41 0b JMP $0b41 ; (sformat + 84)
+0b7e : e6 57 __ INC T2 + 0
+0b80 : d0 02 __ BNE $0b84
+0b82 : e6 58 __ INC T2 + 1
+0b84 : a5 43 __ LDA T3 + 0
+0b86 : c9 25 __ CMP #$25
+0b88 : f0 55 __ BEQ $0bdf
+0b8a : a4 55 __ LDY T1 + 0
+0b8c : 91 53 __ STA (T0 + 0),y
+0b8e : e6 55 __ INC T1 + 0
+0b90 : a5 55 __ LDA T1 + 0
+0b92 : c9 28 __ CMP #$28
+0b94 : 90 15 __ BCC $0bab
+0b96 : a0 16 __ LDY #$16
+0b98 : b1 23 __ LDA (SP + 0),y
+0b9a : d0 22 __ BNE $0bbe
+0b9c : 18 __ __ CLC
+0b9d : a5 53 __ LDA T0 + 0
+0b9f : 65 55 __ ADC T1 + 0
+0ba1 : 85 53 __ STA T0 + 0
+0ba3 : 90 02 __ BCC $0ba7
+0ba5 : e6 54 __ INC T0 + 1
+0ba7 : a9 00 __ LDA #$00
+0ba9 : 85 55 __ STA T1 + 0
+0bab : a0 00 __ LDY #$00
+0bad : b1 57 __ LDA (T2 + 0),y
+0baf : aa __ __ TAX
+0bb0 : e6 57 __ INC T2 + 0
+0bb2 : d0 02 __ BNE $0bb6
+0bb4 : e6 58 __ INC T2 + 1
+0bb6 : 8a __ __ TXA
+0bb7 : 86 43 __ STX T3 + 0
+0bb9 : d0 c9 __ BNE $0b84
+0bbb : 4c 25 0b JMP $0b25 ; (sformat + 56)
+0bbe : 18 __ __ CLC
+0bbf : a5 53 __ LDA T0 + 0
+0bc1 : 85 0d __ STA P0
+0bc3 : 65 55 __ ADC T1 + 0
+0bc5 : 85 46 __ STA T5 + 0
+0bc7 : a5 54 __ LDA T0 + 1
+0bc9 : 85 0e __ STA P1
+0bcb : 69 00 __ ADC #$00
+0bcd : 85 47 __ STA T5 + 1
+0bcf : a9 00 __ LDA #$00
+0bd1 : a0 00 __ LDY #$00
+0bd3 : 91 46 __ STA (T5 + 0),y
+0bd5 : 20 20 14 JSR $1420 ; (puts + 0)
+0bd8 : a9 00 __ LDA #$00
+0bda : 85 55 __ STA T1 + 0
+0bdc : 4c ab 0b JMP $0bab ; (sformat + 190)
+0bdf : a5 55 __ LDA T1 + 0
+0be1 : f0 03 __ BEQ $0be6
+0be3 : 4c e7 13 JMP $13e7 ; (sformat + 2298)
+0be6 : a0 00 __ LDY #$00
+0be8 : b1 57 __ LDA (T2 + 0),y
+0bea : 85 43 __ STA T3 + 0
+0bec : a9 0a __ LDA #$0a
+0bee : a0 09 __ LDY #$09
+0bf0 : 91 23 __ STA (SP + 0),y
+0bf2 : a9 00 __ LDA #$00
+0bf4 : c8 __ __ INY
+0bf5 : 91 23 __ STA (SP + 0),y
+0bf7 : a9 01 __ LDA #$01
+0bf9 : a0 07 __ LDY #$07
+0bfb : 91 23 __ STA (SP + 0),y
+0bfd : a9 ff __ LDA #$ff
+0bff : c8 __ __ INY
+0c00 : 91 23 __ STA (SP + 0),y
+0c02 : a9 20 __ LDA #$20
+0c04 : a0 06 __ LDY #$06
+0c06 : 91 23 __ STA (SP + 0),y
+0c08 : a9 00 __ LDA #$00
+0c0a : a0 0b __ LDY #$0b
+0c0c : 91 23 __ STA (SP + 0),y
+0c0e : c8 __ __ INY
+0c0f : 91 23 __ STA (SP + 0),y
+0c11 : c8 __ __ INY
+0c12 : 91 23 __ STA (SP + 0),y
+0c14 : e6 57 __ INC T2 + 0
+0c16 : d0 02 __ BNE $0c1a
+0c18 : e6 58 __ INC T2 + 1
+0c1a : a5 43 __ LDA T3 + 0
+0c1c : c9 2b __ CMP #$2b
+0c1e : d0 03 __ BNE $0c23
+0c20 : 4c d8 13 JMP $13d8 ; (sformat + 2283)
+0c23 : c9 30 __ CMP #$30
+0c25 : d0 03 __ BNE $0c2a
+0c27 : 4c c9 13 JMP $13c9 ; (sformat + 2268)
+0c2a : c9 23 __ CMP #$23
+0c2c : d0 03 __ BNE $0c31
+0c2e : 4c ba 13 JMP $13ba ; (sformat + 2253)
+0c31 : c9 30 __ CMP #$30
+0c33 : 90 65 __ BCC $0c9a
+0c35 : a9 39 __ LDA #$39
+0c37 : c5 43 __ CMP T3 + 0
+0c39 : 90 5f __ BCC $0c9a
+0c3b : a9 00 __ LDA #$00
+0c3d : 85 46 __ STA T5 + 0
+0c3f : 85 47 __ STA T5 + 1
+0c41 : a5 43 __ LDA T3 + 0
+0c43 : c9 30 __ CMP #$30
+0c45 : 90 4d __ BCC $0c94
+0c47 : a9 39 __ LDA #$39
+0c49 : c5 43 __ CMP T3 + 0
+0c4b : 90 47 __ BCC $0c94
+0c4d : a5 43 __ LDA T3 + 0
+0c4f : 85 48 __ STA T6 + 0
+0c51 : a0 00 __ LDY #$00
+0c53 : b1 57 __ LDA (T2 + 0),y
+0c55 : 85 43 __ STA T3 + 0
+0c57 : e6 57 __ INC T2 + 0
+0c59 : d0 02 __ BNE $0c5d
+0c5b : e6 58 __ INC T2 + 1
+0c5d : a5 46 __ LDA T5 + 0
+0c5f : 0a __ __ ASL
+0c60 : 85 07 __ STA $07
+0c62 : a5 47 __ LDA T5 + 1
+0c64 : 2a __ __ ROL
+0c65 : 06 07 __ ASL $07
+0c67 : 2a __ __ ROL
+0c68 : aa __ __ TAX
+0c69 : 18 __ __ CLC
+0c6a : a5 07 __ LDA $07
+0c6c : 65 46 __ ADC T5 + 0
+0c6e : 85 1b __ STA ACCU + 0
+0c70 : 8a __ __ TXA
+0c71 : 65 47 __ ADC T5 + 1
+0c73 : 06 1b __ ASL ACCU + 0
+0c75 : 2a __ __ ROL
+0c76 : 85 1c __ STA ACCU + 1
+0c78 : 18 __ __ CLC
+0c79 : a5 1b __ LDA ACCU + 0
+0c7b : 65 48 __ ADC T6 + 0
+0c7d : aa __ __ TAX
+0c7e : a5 1c __ LDA ACCU + 1
+0c80 : 69 00 __ ADC #$00
+0c82 : a8 __ __ TAY
+0c83 : 38 __ __ SEC
+0c84 : 8a __ __ TXA
+0c85 : e9 30 __ SBC #$30
+0c87 : 85 46 __ STA T5 + 0
+0c89 : 98 __ __ TYA
+0c8a : e9 00 __ SBC #$00
+0c8c : 85 47 __ STA T5 + 1
+0c8e : a5 43 __ LDA T3 + 0
+0c90 : c9 30 __ CMP #$30
+0c92 : b0 b3 __ BCS $0c47
+0c94 : a5 46 __ LDA T5 + 0
+0c96 : a0 07 __ LDY #$07
+0c98 : 91 23 __ STA (SP + 0),y
+0c9a : a5 43 __ LDA T3 + 0
+0c9c : c9 2e __ CMP #$2e
+0c9e : d0 03 __ BNE $0ca3
+0ca0 : 4c 4c 13 JMP $134c ; (sformat + 2143)
+0ca3 : a5 43 __ LDA T3 + 0
+0ca5 : c9 64 __ CMP #$64
+0ca7 : d0 03 __ BNE $0cac
+0ca9 : 4c b2 11 JMP $11b2 ; (sformat + 1733)
+0cac : c9 75 __ CMP #$75
+0cae : d0 03 __ BNE $0cb3
+0cb0 : 4c 54 10 JMP $1054 ; (sformat + 1383)
+0cb3 : c9 78 __ CMP #$78
+0cb5 : d0 03 __ BNE $0cba
+0cb7 : 4c eb 0e JMP $0eeb ; (sformat + 1022)
+0cba : c9 6c __ CMP #$6c
+0cbc : d0 03 __ BNE $0cc1
+0cbe : 4c f5 0d JMP $0df5 ; (sformat + 776)
+0cc1 : c9 66 __ CMP #$66
+0cc3 : d0 03 __ BNE $0cc8
+0cc5 : 4c 8b 0d JMP $0d8b ; (sformat + 670)
+0cc8 : c9 67 __ CMP #$67
+0cca : d0 03 __ BNE $0ccf
+0ccc : 4c 8b 0d JMP $0d8b ; (sformat + 670)
+0ccf : c9 65 __ CMP #$65
+0cd1 : d0 03 __ BNE $0cd6
+0cd3 : 4c 8b 0d JMP $0d8b ; (sformat + 670)
+0cd6 : c9 73 __ CMP #$73
+0cd8 : f0 3f __ BEQ $0d19
+0cda : c9 63 __ CMP #$63
+0cdc : f0 12 __ BEQ $0cf0
+0cde : 09 00 __ ORA #$00
+0ce0 : d0 03 __ BNE $0ce5
+0ce2 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0ce5 : a5 43 __ LDA T3 + 0
+0ce7 : a4 55 __ LDY T1 + 0
+0ce9 : 91 53 __ STA (T0 + 0),y
+0ceb : e6 55 __ INC T1 + 0
+0ced : 4c ab 0b JMP $0bab ; (sformat + 190)
+0cf0 : a0 14 __ LDY #$14
+0cf2 : b1 23 __ LDA (SP + 0),y
+0cf4 : 85 46 __ STA T5 + 0
+0cf6 : 18 __ __ CLC
+0cf7 : 69 02 __ ADC #$02
+0cf9 : aa __ __ TAX
+0cfa : c8 __ __ INY
+0cfb : b1 23 __ LDA (SP + 0),y
+0cfd : 85 47 __ STA T5 + 1
+0cff : 69 00 __ ADC #$00
+0d01 : 85 49 __ STA T6 + 1
+0d03 : 8a __ __ TXA
+0d04 : 88 __ __ DEY
+0d05 : 91 23 __ STA (SP + 0),y
+0d07 : a5 49 __ LDA T6 + 1
+0d09 : c8 __ __ INY
+0d0a : 91 23 __ STA (SP + 0),y
+0d0c : a0 00 __ LDY #$00
+0d0e : b1 46 __ LDA (T5 + 0),y
+0d10 : a4 55 __ LDY T1 + 0
+0d12 : 91 53 __ STA (T0 + 0),y
+0d14 : e6 55 __ INC T1 + 0
+0d16 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0d19 : a0 14 __ LDY #$14
+0d1b : b1 23 __ LDA (SP + 0),y
+0d1d : 85 46 __ STA T5 + 0
+0d1f : 18 __ __ CLC
+0d20 : 69 02 __ ADC #$02
+0d22 : aa __ __ TAX
+0d23 : c8 __ __ INY
+0d24 : b1 23 __ LDA (SP + 0),y
+0d26 : 85 47 __ STA T5 + 1
+0d28 : 69 00 __ ADC #$00
+0d2a : 85 49 __ STA T6 + 1
+0d2c : 8a __ __ TXA
+0d2d : 88 __ __ DEY
+0d2e : 91 23 __ STA (SP + 0),y
+0d30 : a5 49 __ LDA T6 + 1
+0d32 : c8 __ __ INY
+0d33 : 91 23 __ STA (SP + 0),y
+0d35 : a0 00 __ LDY #$00
+0d37 : b1 46 __ LDA (T5 + 0),y
+0d39 : 85 02 __ STA $02
+0d3b : c8 __ __ INY
+0d3c : b1 46 __ LDA (T5 + 0),y
+0d3e : 85 47 __ STA T5 + 1
+0d40 : a5 02 __ LDA $02
+0d42 : 85 46 __ STA T5 + 0
+0d44 : a0 16 __ LDY #$16
+0d46 : b1 23 __ LDA (SP + 0),y
+0d48 : d0 33 __ BNE $0d7d
+0d4a : a0 00 __ LDY #$00
+0d4c : b1 46 __ LDA (T5 + 0),y
+0d4e : 85 43 __ STA T3 + 0
+0d50 : d0 03 __ BNE $0d55
+0d52 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0d55 : 18 __ __ CLC
+0d56 : a5 02 __ LDA $02
+0d58 : 69 01 __ ADC #$01
+0d5a : 85 46 __ STA T5 + 0
+0d5c : 90 02 __ BCC $0d60
+0d5e : e6 47 __ INC T5 + 1
+0d60 : a5 43 __ LDA T3 + 0
+0d62 : a0 00 __ LDY #$00
+0d64 : 91 53 __ STA (T0 + 0),y
+0d66 : e6 53 __ INC T0 + 0
+0d68 : d0 02 __ BNE $0d6c
+0d6a : e6 54 __ INC T0 + 1
+0d6c : b1 46 __ LDA (T5 + 0),y
+0d6e : aa __ __ TAX
+0d6f : e6 46 __ INC T5 + 0
+0d71 : d0 02 __ BNE $0d75
+0d73 : e6 47 __ INC T5 + 1
+0d75 : 8a __ __ TXA
+0d76 : 86 43 __ STX T3 + 0
+0d78 : d0 e6 __ BNE $0d60
+0d7a : 4c ab 0b JMP $0bab ; (sformat + 190)
+0d7d : a5 02 __ LDA $02
+0d7f : 85 0d __ STA P0
+0d81 : a5 47 __ LDA T5 + 1
+0d83 : 85 0e __ STA P1
+0d85 : 20 20 14 JSR $1420 ; (puts + 0)
+0d88 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0d8b : 18 __ __ CLC
+0d8c : a5 23 __ LDA SP + 0
+0d8e : 69 06 __ ADC #$06
+0d90 : 85 0d __ STA P0
+0d92 : a5 24 __ LDA SP + 1
+0d94 : 69 00 __ ADC #$00
+0d96 : 85 0e __ STA P1
+0d98 : a5 53 __ LDA T0 + 0
+0d9a : 85 0f __ STA P2
+0d9c : a5 54 __ LDA T0 + 1
+0d9e : 85 10 __ STA P3
+0da0 : a0 14 __ LDY #$14
+0da2 : b1 23 __ LDA (SP + 0),y
+0da4 : 85 46 __ STA T5 + 0
+0da6 : c8 __ __ INY
+0da7 : b1 23 __ LDA (SP + 0),y
+0da9 : 85 47 __ STA T5 + 1
+0dab : a0 00 __ LDY #$00
+0dad : b1 46 __ LDA (T5 + 0),y
+0daf : 85 11 __ STA P4
+0db1 : c8 __ __ INY
+0db2 : b1 46 __ LDA (T5 + 0),y
+0db4 : 85 12 __ STA P5
+0db6 : c8 __ __ INY
+0db7 : b1 46 __ LDA (T5 + 0),y
+0db9 : 85 13 __ STA P6
+0dbb : c8 __ __ INY
+0dbc : b1 46 __ LDA (T5 + 0),y
+0dbe : 85 14 __ STA P7
+0dc0 : 20 8b 16 JSR $168b ; (nformf + 0)
+0dc3 : a5 1b __ LDA ACCU + 0
+0dc5 : 85 55 __ STA T1 + 0
+0dc7 : a0 14 __ LDY #$14
+0dc9 : b1 23 __ LDA (SP + 0),y
+0dcb : 85 46 __ STA T5 + 0
+0dcd : 18 __ __ CLC
+0dce : 69 02 __ ADC #$02
+0dd0 : aa __ __ TAX
+0dd1 : c8 __ __ INY
+0dd2 : b1 23 __ LDA (SP + 0),y
+0dd4 : 85 47 __ STA T5 + 1
+0dd6 : 69 00 __ ADC #$00
+0dd8 : 85 49 __ STA T6 + 1
+0dda : 8a __ __ TXA
+0ddb : 88 __ __ DEY
+0ddc : 91 23 __ STA (SP + 0),y
+0dde : a5 49 __ LDA T6 + 1
+0de0 : c8 __ __ INY
+0de1 : 91 23 __ STA (SP + 0),y
+0de3 : 18 __ __ CLC
+0de4 : a5 46 __ LDA T5 + 0
+0de6 : 69 04 __ ADC #$04
+0de8 : 88 __ __ DEY
+0de9 : 91 23 __ STA (SP + 0),y
+0deb : a5 47 __ LDA T5 + 1
+0ded : 69 00 __ ADC #$00
+0def : c8 __ __ INY
+0df0 : 91 23 __ STA (SP + 0),y
+0df2 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0df5 : a0 14 __ LDY #$14
+0df7 : b1 23 __ LDA (SP + 0),y
+0df9 : 85 46 __ STA T5 + 0
+0dfb : 18 __ __ CLC
+0dfc : 69 02 __ ADC #$02
+0dfe : aa __ __ TAX
+0dff : c8 __ __ INY
+0e00 : b1 23 __ LDA (SP + 0),y
+0e02 : 85 47 __ STA T5 + 1
+0e04 : a0 00 __ LDY #$00
+0e06 : b1 46 __ LDA (T5 + 0),y
+0e08 : 85 4f __ STA T10 + 0
+0e0a : c8 __ __ INY
+0e0b : b1 46 __ LDA (T5 + 0),y
+0e0d : 85 50 __ STA T10 + 1
+0e0f : c8 __ __ INY
+0e10 : b1 46 __ LDA (T5 + 0),y
+0e12 : 85 51 __ STA T10 + 2
+0e14 : c8 __ __ INY
+0e15 : b1 46 __ LDA (T5 + 0),y
+0e17 : 85 52 __ STA T10 + 3
+0e19 : a5 47 __ LDA T5 + 1
+0e1b : 69 00 __ ADC #$00
+0e1d : 85 49 __ STA T6 + 1
+0e1f : 8a __ __ TXA
+0e20 : a0 14 __ LDY #$14
+0e22 : 91 23 __ STA (SP + 0),y
+0e24 : a5 49 __ LDA T6 + 1
+0e26 : c8 __ __ INY
+0e27 : 91 23 __ STA (SP + 0),y
+0e29 : 18 __ __ CLC
+0e2a : a5 46 __ LDA T5 + 0
+0e2c : 69 04 __ ADC #$04
+0e2e : 88 __ __ DEY
+0e2f : 91 23 __ STA (SP + 0),y
+0e31 : a5 47 __ LDA T5 + 1
+0e33 : 69 00 __ ADC #$00
+0e35 : c8 __ __ INY
+0e36 : 91 23 __ STA (SP + 0),y
+0e38 : a0 00 __ LDY #$00
+0e3a : b1 57 __ LDA (T2 + 0),y
+0e3c : aa __ __ TAX
+0e3d : e6 57 __ INC T2 + 0
+0e3f : d0 02 __ BNE $0e43
+0e41 : e6 58 __ INC T2 + 1
+0e43 : 8a __ __ TXA
+0e44 : e0 64 __ CPX #$64
+0e46 : f0 74 __ BEQ $0ebc
+0e48 : c9 75 __ CMP #$75
+0e4a : f0 41 __ BEQ $0e8d
+0e4c : c9 78 __ CMP #$78
+0e4e : f0 03 __ BEQ $0e53
+0e50 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0e53 : a9 10 __ LDA #$10
+0e55 : a0 09 __ LDY #$09
+0e57 : 91 23 __ STA (SP + 0),y
+0e59 : a9 00 __ LDA #$00
+0e5b : c8 __ __ INY
+0e5c : 91 23 __ STA (SP + 0),y
+0e5e : 18 __ __ CLC
+0e5f : a5 23 __ LDA SP + 0
+0e61 : 69 06 __ ADC #$06
+0e63 : 85 0d __ STA P0
+0e65 : a5 24 __ LDA SP + 1
+0e67 : 69 00 __ ADC #$00
+0e69 : 85 0e __ STA P1
+0e6b : a5 53 __ LDA T0 + 0
+0e6d : 85 0f __ STA P2
+0e6f : a5 54 __ LDA T0 + 1
+0e71 : 85 10 __ STA P3
+0e73 : a5 4f __ LDA T10 + 0
+0e75 : 85 11 __ STA P4
+0e77 : a5 50 __ LDA T10 + 1
+0e79 : 85 12 __ STA P5
+0e7b : a5 51 __ LDA T10 + 2
+0e7d : 85 13 __ STA P6
+0e7f : a5 52 __ LDA T10 + 3
+0e81 : 85 14 __ STA P7
+0e83 : 20 5e 14 JSR $145e ; (nforml + 0)
+0e86 : a5 1b __ LDA ACCU + 0
+0e88 : 85 55 __ STA T1 + 0
+0e8a : 4c ab 0b JMP $0bab ; (sformat + 190)
+0e8d : 18 __ __ CLC
+0e8e : a5 23 __ LDA SP + 0
+0e90 : 69 06 __ ADC #$06
+0e92 : 85 0d __ STA P0
+0e94 : a5 24 __ LDA SP + 1
+0e96 : 69 00 __ ADC #$00
+0e98 : 85 0e __ STA P1
+0e9a : a5 53 __ LDA T0 + 0
+0e9c : 85 0f __ STA P2
+0e9e : a5 54 __ LDA T0 + 1
+0ea0 : 85 10 __ STA P3
+0ea2 : a5 4f __ LDA T10 + 0
+0ea4 : 85 11 __ STA P4
+0ea6 : a5 50 __ LDA T10 + 1
+0ea8 : 85 12 __ STA P5
+0eaa : a5 51 __ LDA T10 + 2
+0eac : 85 13 __ STA P6
+0eae : a5 52 __ LDA T10 + 3
+0eb0 : 85 14 __ STA P7
+0eb2 : 20 5e 14 JSR $145e ; (nforml + 0)
+0eb5 : a5 1b __ LDA ACCU + 0
+0eb7 : 85 55 __ STA T1 + 0
+0eb9 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0ebc : 18 __ __ CLC
+0ebd : a5 23 __ LDA SP + 0
+0ebf : 69 06 __ ADC #$06
+0ec1 : 85 0d __ STA P0
+0ec3 : a5 24 __ LDA SP + 1
+0ec5 : 69 00 __ ADC #$00
+0ec7 : 85 0e __ STA P1
+0ec9 : a5 53 __ LDA T0 + 0
+0ecb : 85 0f __ STA P2
+0ecd : a5 54 __ LDA T0 + 1
+0ecf : 85 10 __ STA P3
+0ed1 : a5 4f __ LDA T10 + 0
+0ed3 : 85 11 __ STA P4
+0ed5 : a5 50 __ LDA T10 + 1
+0ed7 : 85 12 __ STA P5
+0ed9 : a5 51 __ LDA T10 + 2
+0edb : 85 13 __ STA P6
+0edd : a5 52 __ LDA T10 + 3
+0edf : 85 14 __ STA P7
+0ee1 : 20 5e 14 JSR $145e ; (nforml + 0)
+0ee4 : a5 1b __ LDA ACCU + 0
+0ee6 : 85 55 __ STA T1 + 0
+0ee8 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0eeb : a9 10 __ LDA #$10
+0eed : a0 09 __ LDY #$09
+0eef : 91 23 __ STA (SP + 0),y
+0ef1 : a9 00 __ LDA #$00
+0ef3 : c8 __ __ INY
+0ef4 : 91 23 __ STA (SP + 0),y
+0ef6 : a0 14 __ LDY #$14
+0ef8 : b1 23 __ LDA (SP + 0),y
+0efa : 85 46 __ STA T5 + 0
+0efc : 18 __ __ CLC
+0efd : 69 02 __ ADC #$02
+0eff : aa __ __ TAX
+0f00 : c8 __ __ INY
+0f01 : b1 23 __ LDA (SP + 0),y
+0f03 : 85 47 __ STA T5 + 1
+0f05 : 69 00 __ ADC #$00
+0f07 : 85 49 __ STA T6 + 1
+0f09 : 8a __ __ TXA
+0f0a : 88 __ __ DEY
+0f0b : 91 23 __ STA (SP + 0),y
+0f0d : a5 49 __ LDA T6 + 1
+0f0f : c8 __ __ INY
+0f10 : 91 23 __ STA (SP + 0),y
+0f12 : a5 53 __ LDA T0 + 0
+0f14 : 85 48 __ STA T6 + 0
+0f16 : a5 54 __ LDA T0 + 1
+0f18 : 85 49 __ STA T6 + 1
+0f1a : a9 0a __ LDA #$0a
+0f1c : 85 43 __ STA T3 + 0
+0f1e : a0 00 __ LDY #$00
+0f20 : b1 46 __ LDA (T5 + 0),y
+0f22 : aa __ __ TAX
+0f23 : c8 __ __ INY
+0f24 : b1 46 __ LDA (T5 + 0),y
+0f26 : 86 46 __ STX T5 + 0
+0f28 : 85 47 __ STA T5 + 1
+0f2a : 8a __ __ TXA
+0f2b : 05 47 __ ORA T5 + 1
+0f2d : f0 03 __ BEQ $0f32
+0f2f : 4c fa 0f JMP $0ffa ; (sformat + 1293)
+0f32 : a0 08 __ LDY #$08
+0f34 : b1 23 __ LDA (SP + 0),y
+0f36 : 85 44 __ STA T4 + 0
+0f38 : c9 ff __ CMP #$ff
+0f3a : d0 03 __ BNE $0f3f
+0f3c : 4c ec 0f JMP $0fec ; (sformat + 1279)
+0f3f : 38 __ __ SEC
+0f40 : a9 0a __ LDA #$0a
+0f42 : e5 44 __ SBC T4 + 0
+0f44 : 85 44 __ STA T4 + 0
+0f46 : c5 43 __ CMP T3 + 0
+0f48 : b0 0e __ BCS $0f58
+0f4a : c6 43 __ DEC T3 + 0
+0f4c : a9 30 __ LDA #$30
+0f4e : a4 43 __ LDY T3 + 0
+0f50 : 91 48 __ STA (T6 + 0),y
+0f52 : a5 44 __ LDA T4 + 0
+0f54 : c5 43 __ CMP T3 + 0
+0f56 : 90 f2 __ BCC $0f4a
+0f58 : a0 0d __ LDY #$0d
+0f5a : b1 23 __ LDA (SP + 0),y
+0f5c : f0 34 __ BEQ $0f92
+0f5e : a0 09 __ LDY #$09
+0f60 : b1 23 __ LDA (SP + 0),y
+0f62 : 85 46 __ STA T5 + 0
+0f64 : c8 __ __ INY
+0f65 : b1 23 __ LDA (SP + 0),y
+0f67 : d0 29 __ BNE $0f92
+0f69 : a5 46 __ LDA T5 + 0
+0f6b : c9 10 __ CMP #$10
+0f6d : d0 23 __ BNE $0f92
+0f6f : 18 __ __ CLC
+0f70 : a5 43 __ LDA T3 + 0
+0f72 : 69 ff __ ADC #$ff
+0f74 : 18 __ __ CLC
+0f75 : 65 48 __ ADC T6 + 0
+0f77 : 85 46 __ STA T5 + 0
+0f79 : a5 49 __ LDA T6 + 1
+0f7b : 69 00 __ ADC #$00
+0f7d : 85 47 __ STA T5 + 1
+0f7f : a9 58 __ LDA #$58
+0f81 : a0 00 __ LDY #$00
+0f83 : 91 46 __ STA (T5 + 0),y
+0f85 : 18 __ __ CLC
+0f86 : a5 43 __ LDA T3 + 0
+0f88 : 69 fe __ ADC #$fe
+0f8a : 85 43 __ STA T3 + 0
+0f8c : a9 30 __ LDA #$30
+0f8e : a4 43 __ LDY T3 + 0
+0f90 : 91 48 __ STA (T6 + 0),y
+0f92 : a0 0b __ LDY #$0b
+0f94 : b1 23 __ LDA (SP + 0),y
+0f96 : f0 08 __ BEQ $0fa0
+0f98 : c6 43 __ DEC T3 + 0
+0f9a : a9 2b __ LDA #$2b
+0f9c : a4 43 __ LDY T3 + 0
+0f9e : 91 48 __ STA (T6 + 0),y
+0fa0 : a0 07 __ LDY #$07
+0fa2 : b1 23 __ LDA (SP + 0),y
+0fa4 : 85 55 __ STA T1 + 0
+0fa6 : 38 __ __ SEC
+0fa7 : a9 0a __ LDA #$0a
+0fa9 : e5 55 __ SBC T1 + 0
+0fab : 85 46 __ STA T5 + 0
+0fad : a9 00 __ LDA #$00
+0faf : e9 00 __ SBC #$00
+0fb1 : 49 80 __ EOR #$80
+0fb3 : c9 80 __ CMP #$80
+0fb5 : d0 04 __ BNE $0fbb
+0fb7 : a5 46 __ LDA T5 + 0
+0fb9 : c5 43 __ CMP T3 + 0
+0fbb : 90 22 __ BCC $0fdf
+0fbd : a9 00 __ LDA #$00
+0fbf : 85 55 __ STA T1 + 0
+0fc1 : a5 43 __ LDA T3 + 0
+0fc3 : c9 0a __ CMP #$0a
+0fc5 : 90 03 __ BCC $0fca
+0fc7 : 4c ab 0b JMP $0bab ; (sformat + 190)
+0fca : a4 43 __ LDY T3 + 0
+0fcc : b1 48 __ LDA (T6 + 0),y
+0fce : a4 55 __ LDY T1 + 0
+0fd0 : 91 48 __ STA (T6 + 0),y
+0fd2 : e6 55 __ INC T1 + 0
+0fd4 : e6 43 __ INC T3 + 0
+0fd6 : a5 43 __ LDA T3 + 0
+0fd8 : c9 0a __ CMP #$0a
+0fda : 90 ee __ BCC $0fca
+0fdc : 4c ab 0b JMP $0bab ; (sformat + 190)
+0fdf : c6 43 __ DEC T3 + 0
+0fe1 : a0 06 __ LDY #$06
+0fe3 : b1 23 __ LDA (SP + 0),y
+0fe5 : a4 43 __ LDY T3 + 0
+0fe7 : 91 48 __ STA (T6 + 0),y
+0fe9 : 4c a0 0f JMP $0fa0 ; (sformat + 1203)
+0fec : a9 09 __ LDA #$09
+0fee : 85 44 __ STA T4 + 0
+0ff0 : c5 43 __ CMP T3 + 0
+0ff2 : b0 03 __ BCS $0ff7
+0ff4 : 4c 4a 0f JMP $0f4a ; (sformat + 1117)
+0ff7 : 4c 58 0f JMP $0f58 ; (sformat + 1131)
+0ffa : a5 46 __ LDA T5 + 0
+0ffc : 85 1b __ STA ACCU + 0
+0ffe : a5 47 __ LDA T5 + 1
+1000 : 85 1c __ STA ACCU + 1
+1002 : a0 09 __ LDY #$09
+1004 : b1 23 __ LDA (SP + 0),y
+1006 : 85 03 __ STA $03
+1008 : c8 __ __ INY
+1009 : b1 23 __ LDA (SP + 0),y
+100b : 85 04 __ STA $04
+100d : 20 e5 23 JSR $23e5 ; (divmod + 0)
+1010 : a5 06 __ LDA $06
+1012 : 10 30 __ BPL $1044
+1014 : 18 __ __ CLC
+1015 : a5 05 __ LDA $05
+1017 : 69 30 __ ADC #$30
+1019 : c6 43 __ DEC T3 + 0
+101b : a4 43 __ LDY T3 + 0
+101d : 91 48 __ STA (T6 + 0),y
+101f : a5 46 __ LDA T5 + 0
+1021 : 85 1b __ STA ACCU + 0
+1023 : a5 47 __ LDA T5 + 1
+1025 : 85 1c __ STA ACCU + 1
+1027 : a0 09 __ LDY #$09
+1029 : b1 23 __ LDA (SP + 0),y
+102b : 85 03 __ STA $03
+102d : c8 __ __ INY
+102e : b1 23 __ LDA (SP + 0),y
+1030 : 85 04 __ STA $04
+1032 : 20 e5 23 JSR $23e5 ; (divmod + 0)
+1035 : a5 1b __ LDA ACCU + 0
+1037 : 85 46 __ STA T5 + 0
+1039 : a5 1c __ LDA ACCU + 1
+103b : 85 47 __ STA T5 + 1
+103d : 05 1b __ ORA ACCU + 0
+103f : d0 b9 __ BNE $0ffa
+1041 : 4c 32 0f JMP $0f32 ; (sformat + 1093)
+1044 : d0 06 __ BNE $104c
+1046 : a5 05 __ LDA $05
+1048 : c9 0a __ CMP #$0a
+104a : 90 c8 __ BCC $1014
+104c : 18 __ __ CLC
+104d : a5 05 __ LDA $05
+104f : 69 37 __ ADC #$37
+1051 : 4c 19 10 JMP $1019 ; (sformat + 1324)
+1054 : a0 14 __ LDY #$14
+1056 : b1 23 __ LDA (SP + 0),y
+1058 : 85 46 __ STA T5 + 0
+105a : 18 __ __ CLC
+105b : 69 02 __ ADC #$02
+105d : aa __ __ TAX
+105e : c8 __ __ INY
+105f : b1 23 __ LDA (SP + 0),y
+1061 : 85 47 __ STA T5 + 1
+1063 : 69 00 __ ADC #$00
+1065 : 85 49 __ STA T6 + 1
+1067 : 8a __ __ TXA
+1068 : 88 __ __ DEY
+1069 : 91 23 __ STA (SP + 0),y
+106b : a5 49 __ LDA T6 + 1
+106d : c8 __ __ INY
+106e : 91 23 __ STA (SP + 0),y
+1070 : a5 53 __ LDA T0 + 0
+1072 : 85 48 __ STA T6 + 0
+1074 : a5 54 __ LDA T0 + 1
+1076 : 85 49 __ STA T6 + 1
+1078 : a9 0a __ LDA #$0a
+107a : 85 43 __ STA T3 + 0
+107c : a0 00 __ LDY #$00
+107e : b1 46 __ LDA (T5 + 0),y
+1080 : aa __ __ TAX
+1081 : c8 __ __ INY
+1082 : b1 46 __ LDA (T5 + 0),y
+1084 : 86 46 __ STX T5 + 0
+1086 : 85 47 __ STA T5 + 1
+1088 : 8a __ __ TXA
+1089 : 05 47 __ ORA T5 + 1
+108b : f0 03 __ BEQ $1090
+108d : 4c 58 11 JMP $1158 ; (sformat + 1643)
+1090 : a0 08 __ LDY #$08
+1092 : b1 23 __ LDA (SP + 0),y
+1094 : 85 44 __ STA T4 + 0
+1096 : c9 ff __ CMP #$ff
+1098 : d0 03 __ BNE $109d
+109a : 4c 4a 11 JMP $114a ; (sformat + 1629)
+109d : 38 __ __ SEC
+109e : a9 0a __ LDA #$0a
+10a0 : e5 44 __ SBC T4 + 0
+10a2 : 85 44 __ STA T4 + 0
+10a4 : c5 43 __ CMP T3 + 0
+10a6 : b0 0e __ BCS $10b6
+10a8 : c6 43 __ DEC T3 + 0
+10aa : a9 30 __ LDA #$30
+10ac : a4 43 __ LDY T3 + 0
+10ae : 91 48 __ STA (T6 + 0),y
+10b0 : a5 44 __ LDA T4 + 0
+10b2 : c5 43 __ CMP T3 + 0
+10b4 : 90 f2 __ BCC $10a8
+10b6 : a0 0d __ LDY #$0d
+10b8 : b1 23 __ LDA (SP + 0),y
+10ba : f0 34 __ BEQ $10f0
+10bc : a0 09 __ LDY #$09
+10be : b1 23 __ LDA (SP + 0),y
+10c0 : 85 46 __ STA T5 + 0
+10c2 : c8 __ __ INY
+10c3 : b1 23 __ LDA (SP + 0),y
+10c5 : d0 29 __ BNE $10f0
+10c7 : a5 46 __ LDA T5 + 0
+10c9 : c9 10 __ CMP #$10
+10cb : d0 23 __ BNE $10f0
+10cd : 18 __ __ CLC
+10ce : a5 43 __ LDA T3 + 0
+10d0 : 69 ff __ ADC #$ff
+10d2 : 18 __ __ CLC
+10d3 : 65 48 __ ADC T6 + 0
+10d5 : 85 46 __ STA T5 + 0
+10d7 : a5 49 __ LDA T6 + 1
+10d9 : 69 00 __ ADC #$00
+10db : 85 47 __ STA T5 + 1
+10dd : a9 58 __ LDA #$58
+10df : a0 00 __ LDY #$00
+10e1 : 91 46 __ STA (T5 + 0),y
+10e3 : 18 __ __ CLC
+10e4 : a5 43 __ LDA T3 + 0
+10e6 : 69 fe __ ADC #$fe
+10e8 : 85 43 __ STA T3 + 0
+10ea : a9 30 __ LDA #$30
+10ec : a4 43 __ LDY T3 + 0
+10ee : 91 48 __ STA (T6 + 0),y
+10f0 : a0 0b __ LDY #$0b
+10f2 : b1 23 __ LDA (SP + 0),y
+10f4 : f0 08 __ BEQ $10fe
+10f6 : c6 43 __ DEC T3 + 0
+10f8 : a9 2b __ LDA #$2b
+10fa : a4 43 __ LDY T3 + 0
+10fc : 91 48 __ STA (T6 + 0),y
+10fe : a0 07 __ LDY #$07
+1100 : b1 23 __ LDA (SP + 0),y
+1102 : 85 55 __ STA T1 + 0
+1104 : 38 __ __ SEC
+1105 : a9 0a __ LDA #$0a
+1107 : e5 55 __ SBC T1 + 0
+1109 : 85 46 __ STA T5 + 0
+110b : a9 00 __ LDA #$00
+110d : e9 00 __ SBC #$00
+110f : 49 80 __ EOR #$80
+1111 : c9 80 __ CMP #$80
+1113 : d0 04 __ BNE $1119
+1115 : a5 46 __ LDA T5 + 0
+1117 : c5 43 __ CMP T3 + 0
+1119 : 90 22 __ BCC $113d
+111b : a9 00 __ LDA #$00
+111d : 85 55 __ STA T1 + 0
+111f : a5 43 __ LDA T3 + 0
+1121 : c9 0a __ CMP #$0a
+1123 : 90 03 __ BCC $1128
+1125 : 4c ab 0b JMP $0bab ; (sformat + 190)
+1128 : a4 43 __ LDY T3 + 0
+112a : b1 48 __ LDA (T6 + 0),y
+112c : a4 55 __ LDY T1 + 0
+112e : 91 48 __ STA (T6 + 0),y
+1130 : e6 55 __ INC T1 + 0
+1132 : e6 43 __ INC T3 + 0
+1134 : a5 43 __ LDA T3 + 0
+1136 : c9 0a __ CMP #$0a
+1138 : 90 ee __ BCC $1128
+113a : 4c ab 0b JMP $0bab ; (sformat + 190)
+113d : c6 43 __ DEC T3 + 0
+113f : a0 06 __ LDY #$06
+1141 : b1 23 __ LDA (SP + 0),y
+1143 : a4 43 __ LDY T3 + 0
+1145 : 91 48 __ STA (T6 + 0),y
+1147 : 4c fe 10 JMP $10fe ; (sformat + 1553)
+114a : a9 09 __ LDA #$09
+114c : 85 44 __ STA T4 + 0
+114e : c5 43 __ CMP T3 + 0
+1150 : b0 03 __ BCS $1155
+1152 : 4c a8 10 JMP $10a8 ; (sformat + 1467)
+1155 : 4c b6 10 JMP $10b6 ; (sformat + 1481)
+1158 : a5 46 __ LDA T5 + 0
+115a : 85 1b __ STA ACCU + 0
+115c : a5 47 __ LDA T5 + 1
+115e : 85 1c __ STA ACCU + 1
+1160 : a0 09 __ LDY #$09
+1162 : b1 23 __ LDA (SP + 0),y
+1164 : 85 03 __ STA $03
+1166 : c8 __ __ INY
+1167 : b1 23 __ LDA (SP + 0),y
+1169 : 85 04 __ STA $04
+116b : 20 e5 23 JSR $23e5 ; (divmod + 0)
+116e : a5 06 __ LDA $06
+1170 : 10 30 __ BPL $11a2
+1172 : 18 __ __ CLC
+1173 : a5 05 __ LDA $05
+1175 : 69 30 __ ADC #$30
+1177 : c6 43 __ DEC T3 + 0
+1179 : a4 43 __ LDY T3 + 0
+117b : 91 48 __ STA (T6 + 0),y
+117d : a5 46 __ LDA T5 + 0
+117f : 85 1b __ STA ACCU + 0
+1181 : a5 47 __ LDA T5 + 1
+1183 : 85 1c __ STA ACCU + 1
+1185 : a0 09 __ LDY #$09
+1187 : b1 23 __ LDA (SP + 0),y
+1189 : 85 03 __ STA $03
+118b : c8 __ __ INY
+118c : b1 23 __ LDA (SP + 0),y
+118e : 85 04 __ STA $04
+1190 : 20 e5 23 JSR $23e5 ; (divmod + 0)
+1193 : a5 1b __ LDA ACCU + 0
+1195 : 85 46 __ STA T5 + 0
+1197 : a5 1c __ LDA ACCU + 1
+1199 : 85 47 __ STA T5 + 1
+119b : 05 1b __ ORA ACCU + 0
+119d : d0 b9 __ BNE $1158
+119f : 4c 90 10 JMP $1090 ; (sformat + 1443)
+11a2 : d0 06 __ BNE $11aa
+11a4 : a5 05 __ LDA $05
+11a6 : c9 0a __ CMP #$0a
+11a8 : 90 c8 __ BCC $1172
+11aa : 18 __ __ CLC
+11ab : a5 05 __ LDA $05
+11ad : 69 37 __ ADC #$37
+11af : 4c 77 11 JMP $1177 ; (sformat + 1674)
+11b2 : a0 14 __ LDY #$14
+11b4 : b1 23 __ LDA (SP + 0),y
+11b6 : 85 46 __ STA T5 + 0
+11b8 : 18 __ __ CLC
+11b9 : 69 02 __ ADC #$02
+11bb : aa __ __ TAX
+11bc : c8 __ __ INY
+11bd : b1 23 __ LDA (SP + 0),y
+11bf : 85 47 __ STA T5 + 1
+11c1 : 69 00 __ ADC #$00
+11c3 : 85 49 __ STA T6 + 1
+11c5 : 8a __ __ TXA
+11c6 : 88 __ __ DEY
+11c7 : 91 23 __ STA (SP + 0),y
+11c9 : a5 49 __ LDA T6 + 1
+11cb : c8 __ __ INY
+11cc : 91 23 __ STA (SP + 0),y
+11ce : a5 53 __ LDA T0 + 0
+11d0 : 85 48 __ STA T6 + 0
+11d2 : a5 54 __ LDA T0 + 1
+11d4 : 85 49 __ STA T6 + 1
+11d6 : a0 00 __ LDY #$00
+11d8 : b1 46 __ LDA (T5 + 0),y
+11da : 85 02 __ STA $02
+11dc : c8 __ __ INY
+11dd : b1 46 __ LDA (T5 + 0),y
+11df : 85 47 __ STA T5 + 1
+11e1 : 10 03 __ BPL $11e6
+11e3 : 4c 30 13 JMP $1330 ; (sformat + 2115)
+11e6 : a5 02 __ LDA $02
+11e8 : 85 4a __ STA T7 + 0
+11ea : a5 47 __ LDA T5 + 1
+11ec : 85 4b __ STA T7 + 1
+11ee : a9 00 __ LDA #$00
+11f0 : 85 55 __ STA T1 + 0
+11f2 : a9 0a __ LDA #$0a
+11f4 : 85 43 __ STA T3 + 0
+11f6 : a5 02 __ LDA $02
+11f8 : 05 47 __ ORA T5 + 1
+11fa : f0 03 __ BEQ $11ff
+11fc : 4c d6 12 JMP $12d6 ; (sformat + 2025)
+11ff : a0 08 __ LDY #$08
+1201 : b1 23 __ LDA (SP + 0),y
+1203 : 85 44 __ STA T4 + 0
+1205 : c9 ff __ CMP #$ff
+1207 : d0 03 __ BNE $120c
+1209 : 4c c8 12 JMP $12c8 ; (sformat + 2011)
+120c : 38 __ __ SEC
+120d : a9 0a __ LDA #$0a
+120f : e5 44 __ SBC T4 + 0
+1211 : 85 44 __ STA T4 + 0
+1213 : c5 43 __ CMP T3 + 0
+1215 : b0 0e __ BCS $1225
+1217 : c6 43 __ DEC T3 + 0
+1219 : a9 30 __ LDA #$30
+121b : a4 43 __ LDY T3 + 0
+121d : 91 48 __ STA (T6 + 0),y
+121f : a5 44 __ LDA T4 + 0
+1221 : c5 43 __ CMP T3 + 0
+1223 : 90 f2 __ BCC $1217
+1225 : a0 0d __ LDY #$0d
+1227 : b1 23 __ LDA (SP + 0),y
+1229 : f0 34 __ BEQ $125f
+122b : a0 09 __ LDY #$09
+122d : b1 23 __ LDA (SP + 0),y
+122f : 85 46 __ STA T5 + 0
+1231 : c8 __ __ INY
+1232 : b1 23 __ LDA (SP + 0),y
+1234 : d0 29 __ BNE $125f
+1236 : a5 46 __ LDA T5 + 0
+1238 : c9 10 __ CMP #$10
+123a : d0 23 __ BNE $125f
+123c : 18 __ __ CLC
+123d : a5 43 __ LDA T3 + 0
+123f : 69 ff __ ADC #$ff
+1241 : 18 __ __ CLC
+1242 : 65 48 __ ADC T6 + 0
+1244 : 85 46 __ STA T5 + 0
+1246 : a5 49 __ LDA T6 + 1
+1248 : 69 00 __ ADC #$00
+124a : 85 47 __ STA T5 + 1
+124c : a9 58 __ LDA #$58
+124e : a0 00 __ LDY #$00
+1250 : 91 46 __ STA (T5 + 0),y
+1252 : 18 __ __ CLC
+1253 : a5 43 __ LDA T3 + 0
+1255 : 69 fe __ ADC #$fe
+1257 : 85 43 __ STA T3 + 0
+1259 : a9 30 __ LDA #$30
+125b : a4 43 __ LDY T3 + 0
+125d : 91 48 __ STA (T6 + 0),y
+125f : a5 55 __ LDA T1 + 0
+1261 : d0 5a __ BNE $12bd
+1263 : a0 0b __ LDY #$0b
+1265 : b1 23 __ LDA (SP + 0),y
+1267 : f0 08 __ BEQ $1271
+1269 : c6 43 __ DEC T3 + 0
+126b : a9 2b __ LDA #$2b
+126d : a4 43 __ LDY T3 + 0
+126f : 91 48 __ STA (T6 + 0),y
+1271 : a0 07 __ LDY #$07
+1273 : b1 23 __ LDA (SP + 0),y
+1275 : 85 55 __ STA T1 + 0
+1277 : 38 __ __ SEC
+1278 : a9 0a __ LDA #$0a
+127a : e5 55 __ SBC T1 + 0
+127c : 85 46 __ STA T5 + 0
+127e : a9 00 __ LDA #$00
+1280 : e9 00 __ SBC #$00
+1282 : 49 80 __ EOR #$80
+1284 : c9 80 __ CMP #$80
+1286 : d0 04 __ BNE $128c
+1288 : a5 46 __ LDA T5 + 0
+128a : c5 43 __ CMP T3 + 0
+128c : 90 22 __ BCC $12b0
+128e : a9 00 __ LDA #$00
+1290 : 85 55 __ STA T1 + 0
+1292 : a5 43 __ LDA T3 + 0
+1294 : c9 0a __ CMP #$0a
+1296 : 90 03 __ BCC $129b
+1298 : 4c ab 0b JMP $0bab ; (sformat + 190)
+129b : a4 43 __ LDY T3 + 0
+129d : b1 48 __ LDA (T6 + 0),y
+129f : a4 55 __ LDY T1 + 0
+12a1 : 91 48 __ STA (T6 + 0),y
+12a3 : e6 55 __ INC T1 + 0
+12a5 : e6 43 __ INC T3 + 0
+12a7 : a5 43 __ LDA T3 + 0
+12a9 : c9 0a __ CMP #$0a
+12ab : 90 ee __ BCC $129b
+12ad : 4c ab 0b JMP $0bab ; (sformat + 190)
+12b0 : c6 43 __ DEC T3 + 0
+12b2 : a0 06 __ LDY #$06
+12b4 : b1 23 __ LDA (SP + 0),y
+12b6 : a4 43 __ LDY T3 + 0
+12b8 : 91 48 __ STA (T6 + 0),y
+12ba : 4c 71 12 JMP $1271 ; (sformat + 1924)
+12bd : c6 43 __ DEC T3 + 0
+12bf : a9 2d __ LDA #$2d
+12c1 : a4 43 __ LDY T3 + 0
+12c3 : 91 48 __ STA (T6 + 0),y
+12c5 : 4c 71 12 JMP $1271 ; (sformat + 1924)
+12c8 : a9 09 __ LDA #$09
+12ca : 85 44 __ STA T4 + 0
+12cc : c5 43 __ CMP T3 + 0
+12ce : b0 03 __ BCS $12d3
+12d0 : 4c 17 12 JMP $1217 ; (sformat + 1834)
+12d3 : 4c 25 12 JMP $1225 ; (sformat + 1848)
+12d6 : a5 4a __ LDA T7 + 0
+12d8 : 85 1b __ STA ACCU + 0
+12da : a5 4b __ LDA T7 + 1
+12dc : 85 1c __ STA ACCU + 1
+12de : a0 09 __ LDY #$09
+12e0 : b1 23 __ LDA (SP + 0),y
+12e2 : 85 03 __ STA $03
+12e4 : c8 __ __ INY
+12e5 : b1 23 __ LDA (SP + 0),y
+12e7 : 85 04 __ STA $04
+12e9 : 20 e5 23 JSR $23e5 ; (divmod + 0)
+12ec : a5 06 __ LDA $06
+12ee : 10 30 __ BPL $1320
+12f0 : 18 __ __ CLC
+12f1 : a5 05 __ LDA $05
+12f3 : 69 30 __ ADC #$30
+12f5 : c6 43 __ DEC T3 + 0
+12f7 : a4 43 __ LDY T3 + 0
+12f9 : 91 48 __ STA (T6 + 0),y
+12fb : a5 4a __ LDA T7 + 0
+12fd : 85 1b __ STA ACCU + 0
+12ff : a5 4b __ LDA T7 + 1
+1301 : 85 1c __ STA ACCU + 1
+1303 : a0 09 __ LDY #$09
+1305 : b1 23 __ LDA (SP + 0),y
+1307 : 85 03 __ STA $03
+1309 : c8 __ __ INY
+130a : b1 23 __ LDA (SP + 0),y
+130c : 85 04 __ STA $04
+130e : 20 e5 23 JSR $23e5 ; (divmod + 0)
+1311 : a5 1b __ LDA ACCU + 0
+1313 : 85 4a __ STA T7 + 0
+1315 : a5 1c __ LDA ACCU + 1
+1317 : 85 4b __ STA T7 + 1
+1319 : 05 1b __ ORA ACCU + 0
+131b : d0 b9 __ BNE $12d6
+131d : 4c ff 11 JMP $11ff ; (sformat + 1810)
+1320 : d0 06 __ BNE $1328
+1322 : a5 05 __ LDA $05
+1324 : c9 0a __ CMP #$0a
+1326 : 90 c8 __ BCC $12f0
+1328 : 18 __ __ CLC
+1329 : a5 05 __ LDA $05
+132b : 69 37 __ ADC #$37
+132d : 4c f5 12 JMP $12f5 ; (sformat + 2056)
+1330 : a9 01 __ LDA #$01
+1332 : 85 55 __ STA T1 + 0
+1334 : a9 0a __ LDA #$0a
+1336 : 85 43 __ STA T3 + 0
+1338 : 38 __ __ SEC
+1339 : a9 00 __ LDA #$00
+133b : e5 02 __ SBC $02
+133d : 85 4a __ STA T7 + 0
+133f : a9 00 __ LDA #$00
+1341 : e5 47 __ SBC T5 + 1
+1343 : 85 4b __ STA T7 + 1
+1345 : 05 4a __ ORA T7 + 0
+1347 : d0 8d __ BNE $12d6
+1349 : 4c ff 11 JMP $11ff ; (sformat + 1810)
+134c : a9 00 __ LDA #$00
+134e : 85 46 __ STA T5 + 0
+1350 : 85 47 __ STA T5 + 1
+1352 : a0 00 __ LDY #$00
+1354 : b1 57 __ LDA (T2 + 0),y
+1356 : 85 43 __ STA T3 + 0
+1358 : e6 57 __ INC T2 + 0
+135a : d0 02 __ BNE $135e
+135c : e6 58 __ INC T2 + 1
+135e : a5 43 __ LDA T3 + 0
+1360 : c9 30 __ CMP #$30
+1362 : 90 4d __ BCC $13b1
+1364 : a9 39 __ LDA #$39
+1366 : c5 43 __ CMP T3 + 0
+1368 : 90 47 __ BCC $13b1
+136a : a5 43 __ LDA T3 + 0
+136c : 85 48 __ STA T6 + 0
+136e : a0 00 __ LDY #$00
+1370 : b1 57 __ LDA (T2 + 0),y
+1372 : 85 43 __ STA T3 + 0
+1374 : e6 57 __ INC T2 + 0
+1376 : d0 02 __ BNE $137a
+1378 : e6 58 __ INC T2 + 1
+137a : a5 46 __ LDA T5 + 0
+137c : 0a __ __ ASL
+137d : 85 07 __ STA $07
+137f : a5 47 __ LDA T5 + 1
+1381 : 2a __ __ ROL
+1382 : 06 07 __ ASL $07
+1384 : 2a __ __ ROL
+1385 : aa __ __ TAX
+1386 : 18 __ __ CLC
+1387 : a5 07 __ LDA $07
+1389 : 65 46 __ ADC T5 + 0
+138b : 85 1b __ STA ACCU + 0
+138d : 8a __ __ TXA
+138e : 65 47 __ ADC T5 + 1
+1390 : 06 1b __ ASL ACCU + 0
+1392 : 2a __ __ ROL
+1393 : 85 1c __ STA ACCU + 1
+1395 : 18 __ __ CLC
+1396 : a5 1b __ LDA ACCU + 0
+1398 : 65 48 __ ADC T6 + 0
+139a : aa __ __ TAX
+139b : a5 1c __ LDA ACCU + 1
+139d : 69 00 __ ADC #$00
+139f : a8 __ __ TAY
+13a0 : 38 __ __ SEC
+13a1 : 8a __ __ TXA
+13a2 : e9 30 __ SBC #$30
+13a4 : 85 46 __ STA T5 + 0
+13a6 : 98 __ __ TYA
+13a7 : e9 00 __ SBC #$00
+13a9 : 85 47 __ STA T5 + 1
+13ab : a5 43 __ LDA T3 + 0
+13ad : c9 30 __ CMP #$30
+13af : b0 b3 __ BCS $1364
+13b1 : a5 46 __ LDA T5 + 0
+13b3 : a0 08 __ LDY #$08
+13b5 : 91 23 __ STA (SP + 0),y
+13b7 : 4c a3 0c JMP $0ca3 ; (sformat + 438)
+13ba : a9 01 __ LDA #$01
+13bc : a0 0d __ LDY #$0d
+13be : 91 23 __ STA (SP + 0),y
+13c0 : a0 00 __ LDY #$00
+13c2 : b1 57 __ LDA (T2 + 0),y
+13c4 : 85 43 __ STA T3 + 0
+13c6 : 4c 14 0c JMP $0c14 ; (sformat + 295)
+13c9 : a9 30 __ LDA #$30
+13cb : a0 06 __ LDY #$06
+13cd : 91 23 __ STA (SP + 0),y
+13cf : a0 00 __ LDY #$00
+13d1 : b1 57 __ LDA (T2 + 0),y
+13d3 : 85 43 __ STA T3 + 0
+13d5 : 4c 14 0c JMP $0c14 ; (sformat + 295)
+13d8 : a9 01 __ LDA #$01
+13da : a0 0b __ LDY #$0b
+13dc : 91 23 __ STA (SP + 0),y
+13de : a0 00 __ LDY #$00
+13e0 : b1 57 __ LDA (T2 + 0),y
+13e2 : 85 43 __ STA T3 + 0
+13e4 : 4c 14 0c JMP $0c14 ; (sformat + 295)
+13e7 : a0 16 __ LDY #$16
+13e9 : b1 23 __ LDA (SP + 0),y
+13eb : d0 12 __ BNE $13ff
+13ed : 18 __ __ CLC
+13ee : a5 53 __ LDA T0 + 0
+13f0 : 65 55 __ ADC T1 + 0
+13f2 : 85 53 __ STA T0 + 0
+13f4 : 90 02 __ BCC $13f8
+13f6 : e6 54 __ INC T0 + 1
+13f8 : a9 00 __ LDA #$00
+13fa : 85 55 __ STA T1 + 0
+13fc : 4c e6 0b JMP $0be6 ; (sformat + 249)
+13ff : 18 __ __ CLC
+1400 : a5 53 __ LDA T0 + 0
+1402 : 85 0d __ STA P0
+1404 : 65 55 __ ADC T1 + 0
+1406 : 85 46 __ STA T5 + 0
+1408 : a5 54 __ LDA T0 + 1
+140a : 85 0e __ STA P1
+140c : 69 00 __ ADC #$00
+140e : 85 47 __ STA T5 + 1
+1410 : a9 00 __ LDA #$00
+1412 : a0 00 __ LDY #$00
+1414 : 91 46 __ STA (T5 + 0),y
+1416 : 20 20 14 JSR $1420 ; (puts + 0)
+1419 : a9 00 __ LDA #$00
+141b : 85 55 __ STA T1 + 0
+141d : 4c e6 0b JMP $0be6 ; (sformat + 249)
+--------------------------------------------------------------------
+puts:
+1420 : a0 00 __ LDY #$00
+1422 : b1 0d __ LDA (P0),y
+1424 : f0 0b __ BEQ $1431
+1426 : 20 32 14 JSR $1432 ; (putpch + 0)
+1429 : e6 0d __ INC P0
+142b : d0 f3 __ BNE $1420
+142d : e6 0e __ INC P1
+142f : d0 ef __ BNE $1420
+1431 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1432 : ae c9 25 LDX $25c9 ; (giocharmap + 0)
+1435 : e0 01 __ CPX #$01
+1437 : 90 22 __ BCC $145b
+1439 : c9 0a __ CMP #$0a
+143b : d0 02 __ BNE $143f
+143d : a9 0d __ LDA #$0d
+143f : e0 02 __ CPX #$02
+1441 : 90 18 __ BCC $145b
+1443 : c9 41 __ CMP #$41
+1445 : 90 14 __ BCC $145b
+1447 : c9 7b __ CMP #$7b
+1449 : b0 10 __ BCS $145b
+144b : c9 61 __ CMP #$61
+144d : b0 04 __ BCS $1453
+144f : c9 5b __ CMP #$5b
+1451 : b0 08 __ BCS $145b
+1453 : 49 20 __ EOR #$20
+1455 : e0 03 __ CPX #$03
+1457 : f0 02 __ BEQ $145b
+1459 : 29 df __ AND #$df
+145b : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+145e : 38 __ __ SEC
+145f : a5 23 __ LDA SP + 0
+1461 : e9 05 __ SBC #$05
+1463 : 85 23 __ STA SP + 0
+1465 : a5 24 __ LDA SP + 1
+1467 : e9 00 __ SBC #$00
+1469 : 85 24 __ STA SP + 1
+146b : a0 01 __ LDY #$01
+146d : b9 53 00 LDA $0053,y 
+1470 : 91 23 __ STA (SP + 0),y
+1472 : 88 __ __ DEY
+1473 : 10 f8 __ BPL $146d
+1475 : a5 11 __ LDA P4
+1477 : 85 47 __ STA T1 + 0
+1479 : a5 12 __ LDA P5
+147b : 85 48 __ STA T1 + 1
+147d : a5 13 __ LDA P6
+147f : 85 49 __ STA T1 + 2
+1481 : a5 14 __ LDA P7
+1483 : 85 4a __ STA T1 + 3
+1485 : a9 00 __ LDA #$00
+1487 : 85 4d __ STA T3 + 0
+1489 : a5 15 __ LDA P8
+148b : f0 03 __ BEQ $1490
+148d : 4c 36 16 JMP $1636 ; (nforml + 472)
+1490 : a9 10 __ LDA #$10
+1492 : 85 4e __ STA T4 + 0
+1494 : a9 00 __ LDA #$00
+1496 : c5 14 __ CMP P7
+1498 : d0 0a __ BNE $14a4
+149a : c5 13 __ CMP P6
+149c : d0 06 __ BNE $14a4
+149e : c5 12 __ CMP P5
+14a0 : d0 02 __ BNE $14a4
+14a2 : c5 11 __ CMP P4
+14a4 : b0 03 __ BCS $14a9
+14a6 : 4c aa 15 JMP $15aa ; (nforml + 332)
+14a9 : a0 02 __ LDY #$02
+14ab : b1 0d __ LDA (P0),y
+14ad : 85 4f __ STA T5 + 0
+14af : c9 ff __ CMP #$ff
+14b1 : d0 03 __ BNE $14b6
+14b3 : 4c 9c 15 JMP $159c ; (nforml + 318)
+14b6 : 38 __ __ SEC
+14b7 : a9 10 __ LDA #$10
+14b9 : e5 4f __ SBC T5 + 0
+14bb : 85 4f __ STA T5 + 0
+14bd : c5 4e __ CMP T4 + 0
+14bf : b0 0e __ BCS $14cf
+14c1 : c6 4e __ DEC T4 + 0
+14c3 : a9 30 __ LDA #$30
+14c5 : a4 4e __ LDY T4 + 0
+14c7 : 91 0f __ STA (P2),y
+14c9 : a5 4f __ LDA T5 + 0
+14cb : c5 4e __ CMP T4 + 0
+14cd : 90 f2 __ BCC $14c1
+14cf : a0 07 __ LDY #$07
+14d1 : b1 0d __ LDA (P0),y
+14d3 : f0 34 __ BEQ $1509
+14d5 : a0 03 __ LDY #$03
+14d7 : b1 0d __ LDA (P0),y
+14d9 : 85 53 __ STA T7 + 0
+14db : c8 __ __ INY
+14dc : b1 0d __ LDA (P0),y
+14de : d0 29 __ BNE $1509
+14e0 : a5 53 __ LDA T7 + 0
+14e2 : c9 10 __ CMP #$10
+14e4 : d0 23 __ BNE $1509
+14e6 : 18 __ __ CLC
+14e7 : a5 4e __ LDA T4 + 0
+14e9 : 69 ff __ ADC #$ff
+14eb : 18 __ __ CLC
+14ec : 65 0f __ ADC P2
+14ee : 85 53 __ STA T7 + 0
+14f0 : a5 10 __ LDA P3
+14f2 : 69 00 __ ADC #$00
+14f4 : 85 54 __ STA T7 + 1
+14f6 : a9 58 __ LDA #$58
+14f8 : a0 00 __ LDY #$00
+14fa : 91 53 __ STA (T7 + 0),y
+14fc : 18 __ __ CLC
+14fd : a5 4e __ LDA T4 + 0
+14ff : 69 fe __ ADC #$fe
+1501 : 85 4e __ STA T4 + 0
+1503 : a9 30 __ LDA #$30
+1505 : a4 4e __ LDY T4 + 0
+1507 : 91 0f __ STA (P2),y
+1509 : a5 4d __ LDA T3 + 0
+150b : f0 03 __ BEQ $1510
+150d : 4c 91 15 JMP $1591 ; (nforml + 307)
+1510 : a0 05 __ LDY #$05
+1512 : b1 0d __ LDA (P0),y
+1514 : f0 08 __ BEQ $151e
+1516 : c6 4e __ DEC T4 + 0
+1518 : a9 2b __ LDA #$2b
+151a : a4 4e __ LDY T4 + 0
+151c : 91 0f __ STA (P2),y
+151e : a0 01 __ LDY #$01
+1520 : b1 0d __ LDA (P0),y
+1522 : 85 53 __ STA T7 + 0
+1524 : 38 __ __ SEC
+1525 : a9 10 __ LDA #$10
+1527 : e5 53 __ SBC T7 + 0
+1529 : 85 53 __ STA T7 + 0
+152b : a9 00 __ LDA #$00
+152d : e9 00 __ SBC #$00
+152f : 49 80 __ EOR #$80
+1531 : c9 80 __ CMP #$80
+1533 : d0 04 __ BNE $1539
+1535 : a5 53 __ LDA T7 + 0
+1537 : c5 4e __ CMP T4 + 0
+1539 : 90 49 __ BCC $1584
+153b : a9 00 __ LDA #$00
+153d : 85 4d __ STA T3 + 0
+153f : a5 4e __ LDA T4 + 0
+1541 : c9 10 __ CMP #$10
+1543 : 90 20 __ BCC $1565
+1545 : a5 4d __ LDA T3 + 0
+1547 : 85 1b __ STA ACCU + 0
+1549 : a9 00 __ LDA #$00
+154b : 85 1c __ STA ACCU + 1
+154d : a0 01 __ LDY #$01
+154f : b1 23 __ LDA (SP + 0),y
+1551 : 99 53 00 STA $0053,y 
+1554 : 88 __ __ DEY
+1555 : 10 f8 __ BPL $154f
+1557 : 18 __ __ CLC
+1558 : a5 23 __ LDA SP + 0
+155a : 69 05 __ ADC #$05
+155c : 85 23 __ STA SP + 0
+155e : a5 24 __ LDA SP + 1
+1560 : 69 00 __ ADC #$00
+1562 : 85 24 __ STA SP + 1
+1564 : 60 __ __ RTS
+1565 : aa __ __ TAX
+1566 : 8a __ __ TXA
+1567 : 18 __ __ CLC
+1568 : 65 0f __ ADC P2
+156a : 85 51 __ STA T6 + 0
+156c : a5 10 __ LDA P3
+156e : 69 00 __ ADC #$00
+1570 : 85 52 __ STA T6 + 1
+1572 : a0 00 __ LDY #$00
+1574 : b1 51 __ LDA (T6 + 0),y
+1576 : a4 4d __ LDY T3 + 0
+1578 : 91 0f __ STA (P2),y
+157a : e6 4d __ INC T3 + 0
+157c : e8 __ __ INX
+157d : e0 10 __ CPX #$10
+157f : 90 e5 __ BCC $1566
+1581 : 4c 45 15 JMP $1545 ; (nforml + 231)
+1584 : c6 4e __ DEC T4 + 0
+1586 : a0 00 __ LDY #$00
+1588 : b1 0d __ LDA (P0),y
+158a : a4 4e __ LDY T4 + 0
+158c : 91 0f __ STA (P2),y
+158e : 4c 1e 15 JMP $151e ; (nforml + 192)
+1591 : c6 4e __ DEC T4 + 0
+1593 : a9 2d __ LDA #$2d
+1595 : a4 4e __ LDY T4 + 0
+1597 : 91 0f __ STA (P2),y
+1599 : 4c 1e 15 JMP $151e ; (nforml + 192)
+159c : a9 0f __ LDA #$0f
+159e : 85 4f __ STA T5 + 0
+15a0 : c5 4e __ CMP T4 + 0
+15a2 : b0 03 __ BCS $15a7
+15a4 : 4c c1 14 JMP $14c1 ; (nforml + 99)
+15a7 : 4c cf 14 JMP $14cf ; (nforml + 113)
+15aa : a0 03 __ LDY #$03
+15ac : b1 0d __ LDA (P0),y
+15ae : 85 03 __ STA $03
+15b0 : c8 __ __ INY
+15b1 : b1 0d __ LDA (P0),y
+15b3 : 85 04 __ STA $04
+15b5 : a9 00 __ LDA #$00
+15b7 : 85 05 __ STA $05
+15b9 : 85 06 __ STA $06
+15bb : a5 47 __ LDA T1 + 0
+15bd : 85 1b __ STA ACCU + 0
+15bf : a5 48 __ LDA T1 + 1
+15c1 : 85 1c __ STA ACCU + 1
+15c3 : a5 49 __ LDA T1 + 2
+15c5 : 85 1d __ STA ACCU + 2
+15c7 : a5 4a __ LDA T1 + 3
+15c9 : 85 1e __ STA ACCU + 3
+15cb : 20 71 25 JSR $2571 ; (divmod32 + 0)
+15ce : a5 08 __ LDA $08
+15d0 : 10 54 __ BPL $1626
+15d2 : 18 __ __ CLC
+15d3 : a5 07 __ LDA $07
+15d5 : 69 30 __ ADC #$30
+15d7 : c6 4e __ DEC T4 + 0
+15d9 : a4 4e __ LDY T4 + 0
+15db : 91 0f __ STA (P2),y
+15dd : a0 03 __ LDY #$03
+15df : b1 0d __ LDA (P0),y
+15e1 : 85 03 __ STA $03
+15e3 : c8 __ __ INY
+15e4 : b1 0d __ LDA (P0),y
+15e6 : 85 04 __ STA $04
+15e8 : a9 00 __ LDA #$00
+15ea : 85 05 __ STA $05
+15ec : 85 06 __ STA $06
+15ee : a5 47 __ LDA T1 + 0
+15f0 : 85 1b __ STA ACCU + 0
+15f2 : a5 48 __ LDA T1 + 1
+15f4 : 85 1c __ STA ACCU + 1
+15f6 : a5 49 __ LDA T1 + 2
+15f8 : 85 1d __ STA ACCU + 2
+15fa : a5 4a __ LDA T1 + 3
+15fc : 85 1e __ STA ACCU + 3
+15fe : 20 71 25 JSR $2571 ; (divmod32 + 0)
+1601 : a5 1b __ LDA ACCU + 0
+1603 : 85 47 __ STA T1 + 0
+1605 : a5 1c __ LDA ACCU + 1
+1607 : 85 48 __ STA T1 + 1
+1609 : a5 1d __ LDA ACCU + 2
+160b : 85 49 __ STA T1 + 2
+160d : a5 1e __ LDA ACCU + 3
+160f : 85 4a __ STA T1 + 3
+1611 : a9 00 __ LDA #$00
+1613 : c5 1e __ CMP ACCU + 3
+1615 : d0 0a __ BNE $1621
+1617 : c5 1d __ CMP ACCU + 2
+1619 : d0 06 __ BNE $1621
+161b : c5 1c __ CMP ACCU + 1
+161d : d0 02 __ BNE $1621
+161f : c5 1b __ CMP ACCU + 0
+1621 : 90 87 __ BCC $15aa
+1623 : 4c a9 14 JMP $14a9 ; (nforml + 75)
+1626 : d0 06 __ BNE $162e
+1628 : a5 07 __ LDA $07
+162a : c9 0a __ CMP #$0a
+162c : 90 a4 __ BCC $15d2
+162e : 18 __ __ CLC
+162f : a5 07 __ LDA $07
+1631 : 69 37 __ ADC #$37
+1633 : 4c d7 15 JMP $15d7 ; (nforml + 377)
+1636 : a5 14 __ LDA P7
+1638 : 49 80 __ EOR #$80
+163a : c9 80 __ CMP #$80
+163c : d0 0f __ BNE $164d
+163e : a5 13 __ LDA P6
+1640 : c9 00 __ CMP #$00
+1642 : d0 09 __ BNE $164d
+1644 : a5 12 __ LDA P5
+1646 : c9 00 __ CMP #$00
+1648 : d0 03 __ BNE $164d
+164a : 4c 90 14 JMP $1490 ; (nforml + 50)
+164d : 90 03 __ BCC $1652
+164f : 4c 90 14 JMP $1490 ; (nforml + 50)
+1652 : a9 01 __ LDA #$01
+1654 : 85 4d __ STA T3 + 0
+1656 : a9 10 __ LDA #$10
+1658 : 85 4e __ STA T4 + 0
+165a : 38 __ __ SEC
+165b : a9 00 __ LDA #$00
+165d : e5 11 __ SBC P4
+165f : 85 47 __ STA T1 + 0
+1661 : a9 00 __ LDA #$00
+1663 : e5 12 __ SBC P5
+1665 : 85 48 __ STA T1 + 1
+1667 : a9 00 __ LDA #$00
+1669 : e5 13 __ SBC P6
+166b : 85 49 __ STA T1 + 2
+166d : a9 00 __ LDA #$00
+166f : e5 14 __ SBC P7
+1671 : 85 4a __ STA T1 + 3
+1673 : a9 00 __ LDA #$00
+1675 : c5 4a __ CMP T1 + 3
+1677 : d0 0a __ BNE $1683
+1679 : c5 49 __ CMP T1 + 2
+167b : d0 06 __ BNE $1683
+167d : c5 48 __ CMP T1 + 1
+167f : d0 02 __ BNE $1683
+1681 : c5 47 __ CMP T1 + 0
+1683 : b0 03 __ BCS $1688
+1685 : 4c aa 15 JMP $15aa ; (nforml + 332)
+1688 : 4c a9 14 JMP $14a9 ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+168b : 38 __ __ SEC
+168c : a5 23 __ LDA SP + 0
+168e : e9 0a __ SBC #$0a
+1690 : 85 23 __ STA SP + 0
+1692 : a5 24 __ LDA SP + 1
+1694 : e9 00 __ SBC #$00
+1696 : 85 24 __ STA SP + 1
+1698 : a0 03 __ LDY #$03
+169a : b9 53 00 LDA $0053,y 
+169d : 91 23 __ STA (SP + 0),y
+169f : 88 __ __ DEY
+16a0 : 10 f8 __ BPL $169a
+16a2 : a9 00 __ LDA #$00
+16a4 : 85 1b __ STA ACCU + 0
+16a6 : 85 1c __ STA ACCU + 1
+16a8 : 85 1d __ STA ACCU + 2
+16aa : 85 1e __ STA ACCU + 3
+16ac : a5 11 __ LDA P4
+16ae : 85 03 __ STA $03
+16b0 : a5 12 __ LDA P5
+16b2 : 85 04 __ STA $04
+16b4 : a5 13 __ LDA P6
+16b6 : 85 05 __ STA $05
+16b8 : a5 14 __ LDA P7
+16ba : 85 06 __ STA $06
+16bc : 20 20 25 JSR $2520 ; (fcmp + 0)
+16bf : 10 03 __ BPL $16c4
+16c1 : 4c ef 1c JMP $1cef ; (nformf + 1636)
+16c4 : a9 00 __ LDA #$00
+16c6 : 85 4b __ STA T3 + 0
+16c8 : a0 05 __ LDY #$05
+16ca : b1 0d __ LDA (P0),y
+16cc : f0 0a __ BEQ $16d8
+16ce : a9 2b __ LDA #$2b
+16d0 : a0 00 __ LDY #$00
+16d2 : 91 0f __ STA (P2),y
+16d4 : a9 01 __ LDA #$01
+16d6 : 85 4b __ STA T3 + 0
+16d8 : a9 00 __ LDA #$00
+16da : 85 43 __ STA T0 + 0
+16dc : 85 44 __ STA T0 + 1
+16de : a0 02 __ LDY #$02
+16e0 : b1 0d __ LDA (P0),y
+16e2 : 85 4e __ STA T5 + 0
+16e4 : c9 ff __ CMP #$ff
+16e6 : d0 04 __ BNE $16ec
+16e8 : a9 06 __ LDA #$06
+16ea : 85 4e __ STA T5 + 0
+16ec : a9 00 __ LDA #$00
+16ee : 85 1b __ STA ACCU + 0
+16f0 : 85 1c __ STA ACCU + 1
+16f2 : 85 1d __ STA ACCU + 2
+16f4 : 85 1e __ STA ACCU + 3
+16f6 : a5 11 __ LDA P4
+16f8 : 85 03 __ STA $03
+16fa : a5 12 __ LDA P5
+16fc : 85 04 __ STA $04
+16fe : a5 13 __ LDA P6
+1700 : 85 05 __ STA $05
+1702 : a5 14 __ LDA P7
+1704 : 85 06 __ STA $06
+1706 : 20 20 25 JSR $2520 ; (fcmp + 0)
+1709 : d0 03 __ BNE $170e
+170b : 4c 92 18 JMP $1892 ; (nformf + 519)
+170e : a9 00 __ LDA #$00
+1710 : 85 1b __ STA ACCU + 0
+1712 : 85 1c __ STA ACCU + 1
+1714 : a9 7a __ LDA #$7a
+1716 : 85 1d __ STA ACCU + 2
+1718 : a9 44 __ LDA #$44
+171a : 85 1e __ STA ACCU + 3
+171c : a5 11 __ LDA P4
+171e : 85 03 __ STA $03
+1720 : a5 12 __ LDA P5
+1722 : 85 04 __ STA $04
+1724 : a5 13 __ LDA P6
+1726 : 85 05 __ STA $05
+1728 : a5 14 __ LDA P7
+172a : 85 06 __ STA $06
+172c : 20 20 25 JSR $2520 ; (fcmp + 0)
+172f : 30 5a __ BMI $178b
+1731 : a5 11 __ LDA P4
+1733 : 85 1b __ STA ACCU + 0
+1735 : a5 12 __ LDA P5
+1737 : 85 1c __ STA ACCU + 1
+1739 : a5 13 __ LDA P6
+173b : 85 1d __ STA ACCU + 2
+173d : a5 14 __ LDA P7
+173f : 85 1e __ STA ACCU + 3
+1741 : a9 00 __ LDA #$00
+1743 : 85 03 __ STA $03
+1745 : 85 04 __ STA $04
+1747 : a9 7a __ LDA #$7a
+1749 : 85 05 __ STA $05
+174b : a9 44 __ LDA #$44
+174d : 85 06 __ STA $06
+174f : 20 96 21 JSR $2196 ; (freg + 20)
+1752 : 20 2d 23 JSR $232d ; (fdiv + 0)
+1755 : a5 1b __ LDA ACCU + 0
+1757 : 85 11 __ STA P4
+1759 : 85 03 __ STA $03
+175b : a5 1c __ LDA ACCU + 1
+175d : 85 12 __ STA P5
+175f : 85 04 __ STA $04
+1761 : a5 1d __ LDA ACCU + 2
+1763 : 85 13 __ STA P6
+1765 : 85 05 __ STA $05
+1767 : a5 1e __ LDA ACCU + 3
+1769 : 85 14 __ STA P7
+176b : 85 06 __ STA $06
+176d : 18 __ __ CLC
+176e : a5 43 __ LDA T0 + 0
+1770 : 69 03 __ ADC #$03
+1772 : 85 43 __ STA T0 + 0
+1774 : 90 02 __ BCC $1778
+1776 : e6 44 __ INC T0 + 1
+1778 : a9 00 __ LDA #$00
+177a : 85 1b __ STA ACCU + 0
+177c : 85 1c __ STA ACCU + 1
+177e : a9 7a __ LDA #$7a
+1780 : 85 1d __ STA ACCU + 2
+1782 : a9 44 __ LDA #$44
+1784 : 85 1e __ STA ACCU + 3
+1786 : 20 20 25 JSR $2520 ; (fcmp + 0)
+1789 : 10 a6 __ BPL $1731
+178b : a9 00 __ LDA #$00
+178d : 85 1b __ STA ACCU + 0
+178f : 85 1c __ STA ACCU + 1
+1791 : a9 80 __ LDA #$80
+1793 : 85 1d __ STA ACCU + 2
+1795 : a9 3f __ LDA #$3f
+1797 : 85 1e __ STA ACCU + 3
+1799 : a5 11 __ LDA P4
+179b : 85 03 __ STA $03
+179d : a5 12 __ LDA P5
+179f : 85 04 __ STA $04
+17a1 : a5 13 __ LDA P6
+17a3 : 85 05 __ STA $05
+17a5 : a5 14 __ LDA P7
+17a7 : 85 06 __ STA $06
+17a9 : 20 20 25 JSR $2520 ; (fcmp + 0)
+17ac : 10 5c __ BPL $180a
+17ae : a5 11 __ LDA P4
+17b0 : 85 1b __ STA ACCU + 0
+17b2 : a5 12 __ LDA P5
+17b4 : 85 1c __ STA ACCU + 1
+17b6 : a5 13 __ LDA P6
+17b8 : 85 1d __ STA ACCU + 2
+17ba : a5 14 __ LDA P7
+17bc : 85 1e __ STA ACCU + 3
+17be : a9 00 __ LDA #$00
+17c0 : 85 03 __ STA $03
+17c2 : 85 04 __ STA $04
+17c4 : a9 7a __ LDA #$7a
+17c6 : 85 05 __ STA $05
+17c8 : a9 44 __ LDA #$44
+17ca : 85 06 __ STA $06
+17cc : 20 96 21 JSR $2196 ; (freg + 20)
+17cf : 20 8f 22 JSR $228f ; (fmul + 0)
+17d2 : a5 1b __ LDA ACCU + 0
+17d4 : 85 11 __ STA P4
+17d6 : 85 03 __ STA $03
+17d8 : a5 1c __ LDA ACCU + 1
+17da : 85 12 __ STA P5
+17dc : 85 04 __ STA $04
+17de : a5 1d __ LDA ACCU + 2
+17e0 : 85 13 __ STA P6
+17e2 : 85 05 __ STA $05
+17e4 : a5 1e __ LDA ACCU + 3
+17e6 : 85 14 __ STA P7
+17e8 : 85 06 __ STA $06
+17ea : 38 __ __ SEC
+17eb : a5 43 __ LDA T0 + 0
+17ed : e9 03 __ SBC #$03
+17ef : 85 43 __ STA T0 + 0
+17f1 : a5 44 __ LDA T0 + 1
+17f3 : e9 00 __ SBC #$00
+17f5 : 85 44 __ STA T0 + 1
+17f7 : a9 00 __ LDA #$00
+17f9 : 85 1b __ STA ACCU + 0
+17fb : 85 1c __ STA ACCU + 1
+17fd : a9 80 __ LDA #$80
+17ff : 85 1d __ STA ACCU + 2
+1801 : a9 3f __ LDA #$3f
+1803 : 85 1e __ STA ACCU + 3
+1805 : 20 20 25 JSR $2520 ; (fcmp + 0)
+1808 : 30 a4 __ BMI $17ae
+180a : a9 00 __ LDA #$00
+180c : 85 1b __ STA ACCU + 0
+180e : 85 1c __ STA ACCU + 1
+1810 : a9 20 __ LDA #$20
+1812 : 85 1d __ STA ACCU + 2
+1814 : a9 41 __ LDA #$41
+1816 : 85 1e __ STA ACCU + 3
+1818 : a5 11 __ LDA P4
+181a : 85 03 __ STA $03
+181c : a5 12 __ LDA P5
+181e : 85 04 __ STA $04
+1820 : a5 13 __ LDA P6
+1822 : 85 05 __ STA $05
+1824 : a5 14 __ LDA P7
+1826 : 85 06 __ STA $06
+1828 : 20 20 25 JSR $2520 ; (fcmp + 0)
+182b : 30 65 __ BMI $1892
+182d : a5 11 __ LDA P4
+182f : 85 1b __ STA ACCU + 0
+1831 : a5 12 __ LDA P5
+1833 : 85 1c __ STA ACCU + 1
+1835 : a5 13 __ LDA P6
+1837 : 85 1d __ STA ACCU + 2
+1839 : a5 14 __ LDA P7
+183b : 85 1e __ STA ACCU + 3
+183d : a9 00 __ LDA #$00
+183f : 85 03 __ STA $03
+1841 : 85 04 __ STA $04
+1843 : a9 20 __ LDA #$20
+1845 : 85 05 __ STA $05
+1847 : a9 41 __ LDA #$41
+1849 : 85 06 __ STA $06
+184b : 20 96 21 JSR $2196 ; (freg + 20)
+184e : 20 2d 23 JSR $232d ; (fdiv + 0)
+1851 : a5 1b __ LDA ACCU + 0
+1853 : 85 11 __ STA P4
+1855 : 85 47 __ STA T2 + 0
+1857 : a5 1c __ LDA ACCU + 1
+1859 : 85 12 __ STA P5
+185b : 85 48 __ STA T2 + 1
+185d : a5 1d __ LDA ACCU + 2
+185f : 85 13 __ STA P6
+1861 : 85 49 __ STA T2 + 2
+1863 : a5 1e __ LDA ACCU + 3
+1865 : 85 14 __ STA P7
+1867 : 85 4a __ STA T2 + 3
+1869 : e6 43 __ INC T0 + 0
+186b : d0 02 __ BNE $186f
+186d : e6 44 __ INC T0 + 1
+186f : a9 00 __ LDA #$00
+1871 : 85 1b __ STA ACCU + 0
+1873 : 85 1c __ STA ACCU + 1
+1875 : a9 20 __ LDA #$20
+1877 : 85 1d __ STA ACCU + 2
+1879 : a9 41 __ LDA #$41
+187b : 85 1e __ STA ACCU + 3
+187d : a5 47 __ LDA T2 + 0
+187f : 85 03 __ STA $03
+1881 : a5 48 __ LDA T2 + 1
+1883 : 85 04 __ STA $04
+1885 : a5 49 __ LDA T2 + 2
+1887 : 85 05 __ STA $05
+1889 : a5 4a __ LDA T2 + 3
+188b : 85 06 __ STA $06
+188d : 20 20 25 JSR $2520 ; (fcmp + 0)
+1890 : 10 9b __ BPL $182d
+1892 : a5 15 __ LDA P8
+1894 : c9 65 __ CMP #$65
+1896 : d0 03 __ BNE $189b
+1898 : 4c ea 1c JMP $1cea ; (nformf + 1631)
+189b : a9 00 __ LDA #$00
+189d : 85 51 __ STA T7 + 0
+189f : 85 52 __ STA T8 + 0
+18a1 : a5 4e __ LDA T5 + 0
+18a3 : 85 4c __ STA T4 + 0
+18a5 : e6 4c __ INC T4 + 0
+18a7 : a5 15 __ LDA P8
+18a9 : c9 67 __ CMP #$67
+18ab : d0 03 __ BNE $18b0
+18ad : 4c cd 1c JMP $1ccd ; (nformf + 1602)
+18b0 : a5 51 __ LDA T7 + 0
+18b2 : f0 03 __ BEQ $18b7
+18b4 : 4c db 1b JMP $1bdb ; (nformf + 1360)
+18b7 : a5 44 __ LDA T0 + 1
+18b9 : 10 03 __ BPL $18be
+18bb : 4c 9a 1b JMP $1b9a ; (nformf + 1295)
+18be : a9 00 __ LDA #$00
+18c0 : 85 47 __ STA T2 + 0
+18c2 : 85 48 __ STA T2 + 1
+18c4 : 85 49 __ STA T2 + 2
+18c6 : a9 3f __ LDA #$3f
+18c8 : 85 4a __ STA T2 + 3
+18ca : 18 __ __ CLC
+18cb : a5 4e __ LDA T5 + 0
+18cd : 65 43 __ ADC T0 + 0
+18cf : 85 4c __ STA T4 + 0
+18d1 : e6 4c __ INC T4 + 0
+18d3 : a9 01 __ LDA #$01
+18d5 : c5 4c __ CMP T4 + 0
+18d7 : b0 03 __ BCS $18dc
+18d9 : 4c 59 1b JMP $1b59 ; (nformf + 1230)
+18dc : a5 11 __ LDA P4
+18de : 85 1b __ STA ACCU + 0
+18e0 : a5 12 __ LDA P5
+18e2 : 85 1c __ STA ACCU + 1
+18e4 : a5 13 __ LDA P6
+18e6 : 85 1d __ STA ACCU + 2
+18e8 : a5 14 __ LDA P7
+18ea : 85 1e __ STA ACCU + 3
+18ec : a5 47 __ LDA T2 + 0
+18ee : 85 03 __ STA $03
+18f0 : a5 48 __ LDA T2 + 1
+18f2 : 85 04 __ STA $04
+18f4 : a5 49 __ LDA T2 + 2
+18f6 : 85 05 __ STA $05
+18f8 : a5 4a __ LDA T2 + 3
+18fa : 85 06 __ STA $06
+18fc : 20 96 21 JSR $2196 ; (freg + 20)
+18ff : 20 c7 21 JSR $21c7 ; (faddsub + 0)
+1902 : a5 1b __ LDA ACCU + 0
+1904 : 85 11 __ STA P4
+1906 : 85 47 __ STA T2 + 0
+1908 : 85 03 __ STA $03
+190a : a5 1c __ LDA ACCU + 1
+190c : 85 12 __ STA P5
+190e : 85 48 __ STA T2 + 1
+1910 : 85 04 __ STA $04
+1912 : a5 1d __ LDA ACCU + 2
+1914 : 85 13 __ STA P6
+1916 : 85 49 __ STA T2 + 2
+1918 : 85 05 __ STA $05
+191a : a5 1e __ LDA ACCU + 3
+191c : 85 14 __ STA P7
+191e : 85 4a __ STA T2 + 3
+1920 : 85 06 __ STA $06
+1922 : a9 00 __ LDA #$00
+1924 : 85 1b __ STA ACCU + 0
+1926 : 85 1c __ STA ACCU + 1
+1928 : a9 20 __ LDA #$20
+192a : 85 1d __ STA ACCU + 2
+192c : a9 41 __ LDA #$41
+192e : 85 1e __ STA ACCU + 3
+1930 : 20 20 25 JSR $2520 ; (fcmp + 0)
+1933 : 30 36 __ BMI $196b
+1935 : a5 47 __ LDA T2 + 0
+1937 : 85 1b __ STA ACCU + 0
+1939 : a5 48 __ LDA T2 + 1
+193b : 85 1c __ STA ACCU + 1
+193d : a5 49 __ LDA T2 + 2
+193f : 85 1d __ STA ACCU + 2
+1941 : a5 4a __ LDA T2 + 3
+1943 : 85 1e __ STA ACCU + 3
+1945 : a9 00 __ LDA #$00
+1947 : 85 03 __ STA $03
+1949 : 85 04 __ STA $04
+194b : a9 20 __ LDA #$20
+194d : 85 05 __ STA $05
+194f : a9 41 __ LDA #$41
+1951 : 85 06 __ STA $06
+1953 : 20 96 21 JSR $2196 ; (freg + 20)
+1956 : 20 2d 23 JSR $232d ; (fdiv + 0)
+1959 : a5 1b __ LDA ACCU + 0
+195b : 85 11 __ STA P4
+195d : a5 1c __ LDA ACCU + 1
+195f : 85 12 __ STA P5
+1961 : a5 1d __ LDA ACCU + 2
+1963 : 85 13 __ STA P6
+1965 : a5 1e __ LDA ACCU + 3
+1967 : 85 14 __ STA P7
+1969 : c6 4e __ DEC T5 + 0
+196b : 38 __ __ SEC
+196c : a5 4c __ LDA T4 + 0
+196e : e5 4e __ SBC T5 + 0
+1970 : 85 53 __ STA T10 + 0
+1972 : 85 4e __ STA T5 + 0
+1974 : a9 14 __ LDA #$14
+1976 : c5 4c __ CMP T4 + 0
+1978 : b0 02 __ BCS $197c
+197a : 85 4c __ STA T4 + 0
+197c : a5 53 __ LDA T10 + 0
+197e : d0 08 __ BNE $1988
+1980 : a9 30 __ LDA #$30
+1982 : a4 4b __ LDY T3 + 0
+1984 : 91 0f __ STA (P2),y
+1986 : e6 4b __ INC T3 + 0
+1988 : a9 00 __ LDA #$00
+198a : 85 50 __ STA T6 + 0
+198c : a5 4c __ LDA T4 + 0
+198e : f0 03 __ BEQ $1993
+1990 : 4c c8 1a JMP $1ac8 ; (nformf + 1085)
+1993 : a5 52 __ LDA T8 + 0
+1995 : f0 03 __ BEQ $199a
+1997 : 4c 48 1a JMP $1a48 ; (nformf + 957)
+199a : a5 4b __ LDA T3 + 0
+199c : a0 01 __ LDY #$01
+199e : d1 0d __ CMP (P0),y
+19a0 : 90 1e __ BCC $19c0
+19a2 : 85 1b __ STA ACCU + 0
+19a4 : a9 00 __ LDA #$00
+19a6 : 85 1c __ STA ACCU + 1
+19a8 : a0 03 __ LDY #$03
+19aa : b1 23 __ LDA (SP + 0),y
+19ac : 99 53 00 STA $0053,y 
+19af : 88 __ __ DEY
+19b0 : 10 f8 __ BPL $19aa
+19b2 : 18 __ __ CLC
+19b3 : a5 23 __ LDA SP + 0
+19b5 : 69 0a __ ADC #$0a
+19b7 : 85 23 __ STA SP + 0
+19b9 : a5 24 __ LDA SP + 1
+19bb : 69 00 __ ADC #$00
+19bd : 85 24 __ STA SP + 1
+19bf : 60 __ __ RTS
+19c0 : c9 01 __ CMP #$01
+19c2 : 90 53 __ BCC $1a17
+19c4 : a9 01 __ LDA #$01
+19c6 : 85 4e __ STA T5 + 0
+19c8 : a5 0d __ LDA P0
+19ca : 85 43 __ STA T0 + 0
+19cc : a5 0e __ LDA P1
+19ce : 85 44 __ STA T0 + 1
+19d0 : a5 4b __ LDA T3 + 0
+19d2 : 85 4c __ STA T4 + 0
+19d4 : 38 __ __ SEC
+19d5 : a5 4c __ LDA T4 + 0
+19d7 : e5 4e __ SBC T5 + 0
+19d9 : 85 55 __ STA T11 + 0
+19db : a9 00 __ LDA #$00
+19dd : e9 00 __ SBC #$00
+19df : 85 56 __ STA T11 + 1
+19e1 : 18 __ __ CLC
+19e2 : a5 0f __ LDA P2
+19e4 : 65 55 __ ADC T11 + 0
+19e6 : 85 55 __ STA T11 + 0
+19e8 : a5 10 __ LDA P3
+19ea : 65 56 __ ADC T11 + 1
+19ec : 85 56 __ STA T11 + 1
+19ee : a0 01 __ LDY #$01
+19f0 : b1 43 __ LDA (T0 + 0),y
+19f2 : 38 __ __ SEC
+19f3 : e5 4e __ SBC T5 + 0
+19f5 : 85 53 __ STA T10 + 0
+19f7 : a9 00 __ LDA #$00
+19f9 : e9 00 __ SBC #$00
+19fb : 85 54 __ STA T10 + 1
+19fd : 18 __ __ CLC
+19fe : a5 0f __ LDA P2
+1a00 : 65 53 __ ADC T10 + 0
+1a02 : 85 53 __ STA T10 + 0
+1a04 : a5 10 __ LDA P3
+1a06 : 65 54 __ ADC T10 + 1
+1a08 : 85 54 __ STA T10 + 1
+1a0a : 88 __ __ DEY
+1a0b : b1 55 __ LDA (T11 + 0),y
+1a0d : 91 53 __ STA (T10 + 0),y
+1a0f : e6 4e __ INC T5 + 0
+1a11 : a5 4b __ LDA T3 + 0
+1a13 : c5 4e __ CMP T5 + 0
+1a15 : b0 bd __ BCS $19d4
+1a17 : a9 00 __ LDA #$00
+1a19 : 85 4e __ STA T5 + 0
+1a1b : a0 01 __ LDY #$01
+1a1d : b1 0d __ LDA (P0),y
+1a1f : 85 50 __ STA T6 + 0
+1a21 : 38 __ __ SEC
+1a22 : e5 4b __ SBC T3 + 0
+1a24 : 85 4c __ STA T4 + 0
+1a26 : a9 00 __ LDA #$00
+1a28 : e9 00 __ SBC #$00
+1a2a : 85 4d __ STA T4 + 1
+1a2c : a9 00 __ LDA #$00
+1a2e : c5 4d __ CMP T4 + 1
+1a30 : d0 04 __ BNE $1a36
+1a32 : a5 4e __ LDA T5 + 0
+1a34 : c5 4c __ CMP T4 + 0
+1a36 : 90 05 __ BCC $1a3d
+1a38 : a5 50 __ LDA T6 + 0
+1a3a : 4c a2 19 JMP $19a2 ; (nformf + 791)
+1a3d : a9 20 __ LDA #$20
+1a3f : a4 4e __ LDY T5 + 0
+1a41 : 91 0f __ STA (P2),y
+1a43 : e6 4e __ INC T5 + 0
+1a45 : 4c 1b 1a JMP $1a1b ; (nformf + 912)
+1a48 : a9 45 __ LDA #$45
+1a4a : a4 4b __ LDY T3 + 0
+1a4c : 91 0f __ STA (P2),y
+1a4e : c8 __ __ INY
+1a4f : a5 44 __ LDA T0 + 1
+1a51 : 30 5a __ BMI $1aad
+1a53 : a9 2b __ LDA #$2b
+1a55 : 91 0f __ STA (P2),y
+1a57 : 18 __ __ CLC
+1a58 : a5 4b __ LDA T3 + 0
+1a5a : 69 02 __ ADC #$02
+1a5c : 85 4b __ STA T3 + 0
+1a5e : a5 43 __ LDA T0 + 0
+1a60 : 85 1b __ STA ACCU + 0
+1a62 : a5 44 __ LDA T0 + 1
+1a64 : 85 1c __ STA ACCU + 1
+1a66 : a9 0a __ LDA #$0a
+1a68 : 85 03 __ STA $03
+1a6a : a9 00 __ LDA #$00
+1a6c : 85 04 __ STA $04
+1a6e : 20 ab 23 JSR $23ab ; (divs16 + 0)
+1a71 : 18 __ __ CLC
+1a72 : a5 1b __ LDA ACCU + 0
+1a74 : 69 30 __ ADC #$30
+1a76 : a4 4b __ LDY T3 + 0
+1a78 : 91 0f __ STA (P2),y
+1a7a : c8 __ __ INY
+1a7b : 98 __ __ TYA
+1a7c : 18 __ __ CLC
+1a7d : 65 0f __ ADC P2
+1a7f : 85 4c __ STA T4 + 0
+1a81 : a5 10 __ LDA P3
+1a83 : 69 00 __ ADC #$00
+1a85 : 85 4d __ STA T4 + 1
+1a87 : a5 43 __ LDA T0 + 0
+1a89 : 85 1b __ STA ACCU + 0
+1a8b : a5 44 __ LDA T0 + 1
+1a8d : 85 1c __ STA ACCU + 1
+1a8f : a9 0a __ LDA #$0a
+1a91 : 85 03 __ STA $03
+1a93 : a9 00 __ LDA #$00
+1a95 : 85 04 __ STA $04
+1a97 : 20 6a 24 JSR $246a ; (mods16 + 0)
+1a9a : 18 __ __ CLC
+1a9b : a5 05 __ LDA $05
+1a9d : 69 30 __ ADC #$30
+1a9f : a0 00 __ LDY #$00
+1aa1 : 91 4c __ STA (T4 + 0),y
+1aa3 : 18 __ __ CLC
+1aa4 : a5 4b __ LDA T3 + 0
+1aa6 : 69 02 __ ADC #$02
+1aa8 : 85 4b __ STA T3 + 0
+1aaa : 4c 9a 19 JMP $199a ; (nformf + 783)
+1aad : a9 2d __ LDA #$2d
+1aaf : 91 0f __ STA (P2),y
+1ab1 : 18 __ __ CLC
+1ab2 : a5 4b __ LDA T3 + 0
+1ab4 : 69 02 __ ADC #$02
+1ab6 : 85 4b __ STA T3 + 0
+1ab8 : 38 __ __ SEC
+1ab9 : a9 00 __ LDA #$00
+1abb : e5 43 __ SBC T0 + 0
+1abd : 85 43 __ STA T0 + 0
+1abf : a9 00 __ LDA #$00
+1ac1 : e5 44 __ SBC T0 + 1
+1ac3 : 85 44 __ STA T0 + 1
+1ac5 : 4c 5e 1a JMP $1a5e ; (nformf + 979)
+1ac8 : a5 50 __ LDA T6 + 0
+1aca : c5 4e __ CMP T5 + 0
+1acc : d0 08 __ BNE $1ad6
+1ace : a9 2e __ LDA #$2e
+1ad0 : a4 4b __ LDY T3 + 0
+1ad2 : 91 0f __ STA (P2),y
+1ad4 : e6 4b __ INC T3 + 0
+1ad6 : a5 11 __ LDA P4
+1ad8 : 85 1b __ STA ACCU + 0
+1ada : a5 12 __ LDA P5
+1adc : 85 1c __ STA ACCU + 1
+1ade : a5 13 __ LDA P6
+1ae0 : 85 1d __ STA ACCU + 2
+1ae2 : a5 14 __ LDA P7
+1ae4 : 85 1e __ STA ACCU + 3
+1ae6 : 20 93 24 JSR $2493 ; (f32_to_i16 + 0)
+1ae9 : a5 1b __ LDA ACCU + 0
+1aeb : 85 53 __ STA T10 + 0
+1aed : 20 d5 24 JSR $24d5 ; (sint16_to_float + 0)
+1af0 : a5 1b __ LDA ACCU + 0
+1af2 : 85 03 __ STA $03
+1af4 : a5 1c __ LDA ACCU + 1
+1af6 : 85 04 __ STA $04
+1af8 : a5 1d __ LDA ACCU + 2
+1afa : 85 05 __ STA $05
+1afc : a5 1e __ LDA ACCU + 3
+1afe : 85 06 __ STA $06
+1b00 : a5 11 __ LDA P4
+1b02 : 85 1b __ STA ACCU + 0
+1b04 : a5 12 __ LDA P5
+1b06 : 85 1c __ STA ACCU + 1
+1b08 : a5 13 __ LDA P6
+1b0a : 85 1d __ STA ACCU + 2
+1b0c : a5 14 __ LDA P7
+1b0e : 85 1e __ STA ACCU + 3
+1b10 : 20 96 21 JSR $2196 ; (freg + 20)
+1b13 : a5 06 __ LDA $06
+1b15 : 49 80 __ EOR #$80
+1b17 : 85 06 __ STA $06
+1b19 : 20 c7 21 JSR $21c7 ; (faddsub + 0)
+1b1c : a9 00 __ LDA #$00
+1b1e : 85 03 __ STA $03
+1b20 : 85 04 __ STA $04
+1b22 : a9 20 __ LDA #$20
+1b24 : 85 05 __ STA $05
+1b26 : a9 41 __ LDA #$41
+1b28 : 85 06 __ STA $06
+1b2a : 20 96 21 JSR $2196 ; (freg + 20)
+1b2d : 20 8f 22 JSR $228f ; (fmul + 0)
+1b30 : a5 1b __ LDA ACCU + 0
+1b32 : 85 11 __ STA P4
+1b34 : a5 1c __ LDA ACCU + 1
+1b36 : 85 12 __ STA P5
+1b38 : a5 1d __ LDA ACCU + 2
+1b3a : 85 13 __ STA P6
+1b3c : a5 1e __ LDA ACCU + 3
+1b3e : 85 14 __ STA P7
+1b40 : 18 __ __ CLC
+1b41 : a5 53 __ LDA T10 + 0
+1b43 : 69 30 __ ADC #$30
+1b45 : a4 4b __ LDY T3 + 0
+1b47 : 91 0f __ STA (P2),y
+1b49 : e6 4b __ INC T3 + 0
+1b4b : e6 50 __ INC T6 + 0
+1b4d : a5 50 __ LDA T6 + 0
+1b4f : c5 4c __ CMP T4 + 0
+1b51 : b0 03 __ BCS $1b56
+1b53 : 4c c8 1a JMP $1ac8 ; (nformf + 1085)
+1b56 : 4c 93 19 JMP $1993 ; (nformf + 776)
+1b59 : 85 50 __ STA T6 + 0
+1b5b : a5 47 __ LDA T2 + 0
+1b5d : 85 1b __ STA ACCU + 0
+1b5f : a5 48 __ LDA T2 + 1
+1b61 : 85 1c __ STA ACCU + 1
+1b63 : a5 49 __ LDA T2 + 2
+1b65 : 85 1d __ STA ACCU + 2
+1b67 : a5 4a __ LDA T2 + 3
+1b69 : 85 1e __ STA ACCU + 3
+1b6b : a9 00 __ LDA #$00
+1b6d : 85 03 __ STA $03
+1b6f : 85 04 __ STA $04
+1b71 : a9 20 __ LDA #$20
+1b73 : 85 05 __ STA $05
+1b75 : a9 41 __ LDA #$41
+1b77 : 85 06 __ STA $06
+1b79 : 20 96 21 JSR $2196 ; (freg + 20)
+1b7c : 20 2d 23 JSR $232d ; (fdiv + 0)
+1b7f : a5 1b __ LDA ACCU + 0
+1b81 : 85 47 __ STA T2 + 0
+1b83 : a5 1c __ LDA ACCU + 1
+1b85 : 85 48 __ STA T2 + 1
+1b87 : a5 1d __ LDA ACCU + 2
+1b89 : 85 49 __ STA T2 + 2
+1b8b : a5 1e __ LDA ACCU + 3
+1b8d : 85 4a __ STA T2 + 3
+1b8f : e6 50 __ INC T6 + 0
+1b91 : a5 50 __ LDA T6 + 0
+1b93 : c5 4c __ CMP T4 + 0
+1b95 : 90 c4 __ BCC $1b5b
+1b97 : 4c dc 18 JMP $18dc ; (nformf + 593)
+1b9a : a5 11 __ LDA P4
+1b9c : 85 1b __ STA ACCU + 0
+1b9e : a5 12 __ LDA P5
+1ba0 : 85 1c __ STA ACCU + 1
+1ba2 : a5 13 __ LDA P6
+1ba4 : 85 1d __ STA ACCU + 2
+1ba6 : a5 14 __ LDA P7
+1ba8 : 85 1e __ STA ACCU + 3
+1baa : a9 00 __ LDA #$00
+1bac : 85 03 __ STA $03
+1bae : 85 04 __ STA $04
+1bb0 : a9 20 __ LDA #$20
+1bb2 : 85 05 __ STA $05
+1bb4 : a9 41 __ LDA #$41
+1bb6 : 85 06 __ STA $06
+1bb8 : 20 96 21 JSR $2196 ; (freg + 20)
+1bbb : 20 2d 23 JSR $232d ; (fdiv + 0)
+1bbe : a5 1b __ LDA ACCU + 0
+1bc0 : 85 11 __ STA P4
+1bc2 : a5 1c __ LDA ACCU + 1
+1bc4 : 85 12 __ STA P5
+1bc6 : a5 1d __ LDA ACCU + 2
+1bc8 : 85 13 __ STA P6
+1bca : a5 1e __ LDA ACCU + 3
+1bcc : 85 14 __ STA P7
+1bce : e6 43 __ INC T0 + 0
+1bd0 : d0 02 __ BNE $1bd4
+1bd2 : e6 44 __ INC T0 + 1
+1bd4 : a5 44 __ LDA T0 + 1
+1bd6 : 30 c2 __ BMI $1b9a
+1bd8 : 4c be 18 JMP $18be ; (nformf + 563)
+1bdb : a9 00 __ LDA #$00
+1bdd : 85 47 __ STA T2 + 0
+1bdf : 85 48 __ STA T2 + 1
+1be1 : 85 49 __ STA T2 + 2
+1be3 : a9 3f __ LDA #$3f
+1be5 : 85 4a __ STA T2 + 3
+1be7 : a5 4e __ LDA T5 + 0
+1be9 : f0 03 __ BEQ $1bee
+1beb : 4c 8a 1c JMP $1c8a ; (nformf + 1535)
+1bee : a5 11 __ LDA P4
+1bf0 : 85 1b __ STA ACCU + 0
+1bf2 : a5 12 __ LDA P5
+1bf4 : 85 1c __ STA ACCU + 1
+1bf6 : a5 13 __ LDA P6
+1bf8 : 85 1d __ STA ACCU + 2
+1bfa : a5 14 __ LDA P7
+1bfc : 85 1e __ STA ACCU + 3
+1bfe : a5 47 __ LDA T2 + 0
+1c00 : 85 03 __ STA $03
+1c02 : a5 48 __ LDA T2 + 1
+1c04 : 85 04 __ STA $04
+1c06 : a5 49 __ LDA T2 + 2
+1c08 : 85 05 __ STA $05
+1c0a : a5 4a __ LDA T2 + 3
+1c0c : 85 06 __ STA $06
+1c0e : 20 96 21 JSR $2196 ; (freg + 20)
+1c11 : 20 c7 21 JSR $21c7 ; (faddsub + 0)
+1c14 : a5 1b __ LDA ACCU + 0
+1c16 : 85 11 __ STA P4
+1c18 : 85 47 __ STA T2 + 0
+1c1a : 85 03 __ STA $03
+1c1c : a5 1c __ LDA ACCU + 1
+1c1e : 85 12 __ STA P5
+1c20 : 85 48 __ STA T2 + 1
+1c22 : 85 04 __ STA $04
+1c24 : a5 1d __ LDA ACCU + 2
+1c26 : 85 13 __ STA P6
+1c28 : 85 49 __ STA T2 + 2
+1c2a : 85 05 __ STA $05
+1c2c : a5 1e __ LDA ACCU + 3
+1c2e : 85 14 __ STA P7
+1c30 : 85 4a __ STA T2 + 3
+1c32 : 85 06 __ STA $06
+1c34 : a9 00 __ LDA #$00
+1c36 : 85 1b __ STA ACCU + 0
+1c38 : 85 1c __ STA ACCU + 1
+1c3a : a9 20 __ LDA #$20
+1c3c : 85 1d __ STA ACCU + 2
+1c3e : a9 41 __ LDA #$41
+1c40 : 85 1e __ STA ACCU + 3
+1c42 : 20 20 25 JSR $2520 ; (fcmp + 0)
+1c45 : 10 03 __ BPL $1c4a
+1c47 : 4c 6b 19 JMP $196b ; (nformf + 736)
+1c4a : a5 47 __ LDA T2 + 0
+1c4c : 85 1b __ STA ACCU + 0
+1c4e : a5 48 __ LDA T2 + 1
+1c50 : 85 1c __ STA ACCU + 1
+1c52 : a5 49 __ LDA T2 + 2
+1c54 : 85 1d __ STA ACCU + 2
+1c56 : a5 4a __ LDA T2 + 3
+1c58 : 85 1e __ STA ACCU + 3
+1c5a : a9 00 __ LDA #$00
+1c5c : 85 03 __ STA $03
+1c5e : 85 04 __ STA $04
+1c60 : a9 20 __ LDA #$20
+1c62 : 85 05 __ STA $05
+1c64 : a9 41 __ LDA #$41
+1c66 : 85 06 __ STA $06
+1c68 : 20 96 21 JSR $2196 ; (freg + 20)
+1c6b : 20 2d 23 JSR $232d ; (fdiv + 0)
+1c6e : a5 1b __ LDA ACCU + 0
+1c70 : 85 11 __ STA P4
+1c72 : a5 1c __ LDA ACCU + 1
+1c74 : 85 12 __ STA P5
+1c76 : a5 1d __ LDA ACCU + 2
+1c78 : 85 13 __ STA P6
+1c7a : a5 1e __ LDA ACCU + 3
+1c7c : 85 14 __ STA P7
+1c7e : e6 43 __ INC T0 + 0
+1c80 : f0 03 __ BEQ $1c85
+1c82 : 4c 6b 19 JMP $196b ; (nformf + 736)
+1c85 : e6 44 __ INC T0 + 1
+1c87 : 4c 6b 19 JMP $196b ; (nformf + 736)
+1c8a : a9 00 __ LDA #$00
+1c8c : 85 50 __ STA T6 + 0
+1c8e : a5 47 __ LDA T2 + 0
+1c90 : 85 1b __ STA ACCU + 0
+1c92 : a5 48 __ LDA T2 + 1
+1c94 : 85 1c __ STA ACCU + 1
+1c96 : a5 49 __ LDA T2 + 2
+1c98 : 85 1d __ STA ACCU + 2
+1c9a : a5 4a __ LDA T2 + 3
+1c9c : 85 1e __ STA ACCU + 3
+1c9e : a9 00 __ LDA #$00
+1ca0 : 85 03 __ STA $03
+1ca2 : 85 04 __ STA $04
+1ca4 : a9 20 __ LDA #$20
+1ca6 : 85 05 __ STA $05
+1ca8 : a9 41 __ LDA #$41
+1caa : 85 06 __ STA $06
+1cac : 20 96 21 JSR $2196 ; (freg + 20)
+1caf : 20 2d 23 JSR $232d ; (fdiv + 0)
+1cb2 : a5 1b __ LDA ACCU + 0
+1cb4 : 85 47 __ STA T2 + 0
+1cb6 : a5 1c __ LDA ACCU + 1
+1cb8 : 85 48 __ STA T2 + 1
+1cba : a5 1d __ LDA ACCU + 2
+1cbc : 85 49 __ STA T2 + 2
+1cbe : a5 1e __ LDA ACCU + 3
+1cc0 : 85 4a __ STA T2 + 3
+1cc2 : e6 50 __ INC T6 + 0
+1cc4 : a5 50 __ LDA T6 + 0
+1cc6 : c5 4e __ CMP T5 + 0
+1cc8 : 90 c4 __ BCC $1c8e
+1cca : 4c ee 1b JMP $1bee ; (nformf + 1379)
+1ccd : a5 44 __ LDA T0 + 1
+1ccf : 10 0e __ BPL $1cdf
+1cd1 : a5 44 __ LDA T0 + 1
+1cd3 : 30 03 __ BMI $1cd8
+1cd5 : 4c b0 18 JMP $18b0 ; (nformf + 549)
+1cd8 : a9 01 __ LDA #$01
+1cda : 85 52 __ STA T8 + 0
+1cdc : 4c db 1b JMP $1bdb ; (nformf + 1360)
+1cdf : d0 f7 __ BNE $1cd8
+1ce1 : a9 03 __ LDA #$03
+1ce3 : c5 43 __ CMP T0 + 0
+1ce5 : 90 f1 __ BCC $1cd8
+1ce7 : 4c d1 1c JMP $1cd1 ; (nformf + 1606)
+1cea : a9 01 __ LDA #$01
+1cec : 4c 9d 18 JMP $189d ; (nformf + 530)
+1cef : a5 14 __ LDA P7
+1cf1 : 49 80 __ EOR #$80
+1cf3 : 85 14 __ STA P7
+1cf5 : a9 2d __ LDA #$2d
+1cf7 : a0 00 __ LDY #$00
+1cf9 : 91 0f __ STA (P2),y
+1cfb : a9 01 __ LDA #$01
+1cfd : 85 4b __ STA T3 + 0
+1cff : 4c d8 16 JMP $16d8 ; (nformf + 77)
+--------------------------------------------------------------------
+shuffle:
+1d07 : 38 __ __ SEC
+1d08 : a5 23 __ LDA SP + 0
+1d0a : e9 0c __ SBC #$0c
+1d0c : 85 23 __ STA SP + 0
+1d0e : a5 24 __ LDA SP + 1
+1d10 : e9 00 __ SBC #$00
+1d12 : 85 24 __ STA SP + 1
+1d14 : a0 10 __ LDY #$10
+1d16 : b1 23 __ LDA (SP + 0),y
+1d18 : 85 47 __ STA T0 + 0
+1d1a : c8 __ __ INY
+1d1b : b1 23 __ LDA (SP + 0),y
+1d1d : 30 04 __ BMI $1d23
+1d1f : 05 47 __ ORA T0 + 0
+1d21 : d0 0e __ BNE $1d31
+1d23 : 18 __ __ CLC
+1d24 : a5 23 __ LDA SP + 0
+1d26 : 69 0c __ ADC #$0c
+1d28 : 85 23 __ STA SP + 0
+1d2a : a5 24 __ LDA SP + 1
+1d2c : 69 00 __ ADC #$00
+1d2e : 85 24 __ STA SP + 1
+1d30 : 60 __ __ RTS
+1d31 : a9 00 __ LDA #$00
+1d33 : 85 47 __ STA T0 + 0
+1d35 : 85 48 __ STA T0 + 1
+1d37 : a0 10 __ LDY #$10
+1d39 : b1 23 __ LDA (SP + 0),y
+1d3b : 85 49 __ STA T2 + 0
+1d3d : c8 __ __ INY
+1d3e : b1 23 __ LDA (SP + 0),y
+1d40 : 85 4a __ STA T2 + 1
+1d42 : a5 23 __ LDA SP + 0
+1d44 : 85 4b __ STA T3 + 0
+1d46 : a5 24 __ LDA SP + 1
+1d48 : 85 4c __ STA T3 + 1
+1d4a : a0 0e __ LDY #$0e
+1d4c : b1 23 __ LDA (SP + 0),y
+1d4e : 85 4d __ STA T4 + 0
+1d50 : c8 __ __ INY
+1d51 : b1 23 __ LDA (SP + 0),y
+1d53 : 85 4e __ STA T4 + 1
+1d55 : 20 fa 1d JSR $1dfa ; (rand + 0)
+1d58 : a5 1b __ LDA ACCU + 0
+1d5a : 85 44 __ STA T5 + 0
+1d5c : a5 1c __ LDA ACCU + 1
+1d5e : 85 45 __ STA T5 + 1
+1d60 : a5 47 __ LDA T0 + 0
+1d62 : 0a __ __ ASL
+1d63 : aa __ __ TAX
+1d64 : a5 48 __ LDA T0 + 1
+1d66 : 2a __ __ ROL
+1d67 : a8 __ __ TAY
+1d68 : 18 __ __ CLC
+1d69 : 8a __ __ TXA
+1d6a : 65 47 __ ADC T0 + 0
+1d6c : 85 1b __ STA ACCU + 0
+1d6e : 98 __ __ TYA
+1d6f : 65 48 __ ADC T0 + 1
+1d71 : 06 1b __ ASL ACCU + 0
+1d73 : 2a __ __ ROL
+1d74 : 06 1b __ ASL ACCU + 0
+1d76 : 2a __ __ ROL
+1d77 : 85 1c __ STA ACCU + 1
+1d79 : 18 __ __ CLC
+1d7a : a5 4d __ LDA T4 + 0
+1d7c : 65 1b __ ADC ACCU + 0
+1d7e : 85 4f __ STA T6 + 0
+1d80 : a5 4e __ LDA T4 + 1
+1d82 : 65 1c __ ADC ACCU + 1
+1d84 : 85 50 __ STA T6 + 1
+1d86 : a0 0b __ LDY #$0b
+1d88 : b1 4f __ LDA (T6 + 0),y
+1d8a : 91 4b __ STA (T3 + 0),y
+1d8c : 88 __ __ DEY
+1d8d : 10 f9 __ BPL $1d88
+1d8f : a5 44 __ LDA T5 + 0
+1d91 : 85 1b __ STA ACCU + 0
+1d93 : a5 45 __ LDA T5 + 1
+1d95 : 85 1c __ STA ACCU + 1
+1d97 : a5 49 __ LDA T2 + 0
+1d99 : 85 03 __ STA $03
+1d9b : a5 4a __ LDA T2 + 1
+1d9d : 85 04 __ STA $04
+1d9f : 20 e5 23 JSR $23e5 ; (divmod + 0)
+1da2 : a5 05 __ LDA $05
+1da4 : 0a __ __ ASL
+1da5 : aa __ __ TAX
+1da6 : a5 06 __ LDA $06
+1da8 : 2a __ __ ROL
+1da9 : a8 __ __ TAY
+1daa : 18 __ __ CLC
+1dab : 8a __ __ TXA
+1dac : 65 05 __ ADC $05
+1dae : 85 1b __ STA ACCU + 0
+1db0 : 98 __ __ TYA
+1db1 : 65 06 __ ADC $06
+1db3 : 06 1b __ ASL ACCU + 0
+1db5 : 2a __ __ ROL
+1db6 : 06 1b __ ASL ACCU + 0
+1db8 : 2a __ __ ROL
+1db9 : 85 1c __ STA ACCU + 1
+1dbb : 18 __ __ CLC
+1dbc : a5 4d __ LDA T4 + 0
+1dbe : 65 1b __ ADC ACCU + 0
+1dc0 : 85 44 __ STA T5 + 0
+1dc2 : a5 4e __ LDA T4 + 1
+1dc4 : 65 1c __ ADC ACCU + 1
+1dc6 : 85 45 __ STA T5 + 1
+1dc8 : a0 0b __ LDY #$0b
+1dca : b1 44 __ LDA (T5 + 0),y
+1dcc : 91 4f __ STA (T6 + 0),y
+1dce : 88 __ __ DEY
+1dcf : 10 f9 __ BPL $1dca
+1dd1 : a0 0b __ LDY #$0b
+1dd3 : b1 4b __ LDA (T3 + 0),y
+1dd5 : 91 44 __ STA (T5 + 0),y
+1dd7 : 88 __ __ DEY
+1dd8 : 10 f9 __ BPL $1dd3
+1dda : e6 47 __ INC T0 + 0
+1ddc : d0 02 __ BNE $1de0
+1dde : e6 48 __ INC T0 + 1
+1de0 : a5 4a __ LDA T2 + 1
+1de2 : 49 80 __ EOR #$80
+1de4 : 85 03 __ STA $03
+1de6 : a5 48 __ LDA T0 + 1
+1de8 : 49 80 __ EOR #$80
+1dea : c5 03 __ CMP $03
+1dec : d0 04 __ BNE $1df2
+1dee : a5 47 __ LDA T0 + 0
+1df0 : c5 49 __ CMP T2 + 0
+1df2 : b0 03 __ BCS $1df7
+1df4 : 4c 55 1d JMP $1d55 ; (shuffle + 78)
+1df7 : 4c 23 1d JMP $1d23 ; (shuffle + 28)
+--------------------------------------------------------------------
+rand:
+1dfa : ad cb 25 LDA $25cb ; (seed + 1)
+1dfd : 4a __ __ LSR
+1dfe : ad ca 25 LDA $25ca ; (seed + 0)
+1e01 : 6a __ __ ROR
+1e02 : aa __ __ TAX
+1e03 : a9 00 __ LDA #$00
+1e05 : 6a __ __ ROR
+1e06 : 4d ca 25 EOR $25ca ; (seed + 0)
+1e09 : 85 43 __ STA T0 + 0
+1e0b : 8a __ __ TXA
+1e0c : 4d cb 25 EOR $25cb ; (seed + 1)
+1e0f : 85 44 __ STA T0 + 1
+1e11 : 4a __ __ LSR
+1e12 : 45 43 __ EOR T0 + 0
+1e14 : aa __ __ TAX
+1e15 : 85 1b __ STA ACCU + 0
+1e17 : 45 44 __ EOR T0 + 1
+1e19 : a8 __ __ TAY
+1e1a : 8e ca 25 STX $25ca ; (seed + 0)
+1e1d : 98 __ __ TYA
+1e1e : 84 1c __ STY ACCU + 1
+1e20 : 8d cb 25 STA $25cb ; (seed + 1)
+1e23 : 60 __ __ RTS
+--------------------------------------------------------------------
+qsort:
+1e24 : 38 __ __ SEC
+1e25 : a5 23 __ LDA SP + 0
+1e27 : e9 12 __ SBC #$12
+1e29 : 85 23 __ STA SP + 0
+1e2b : a5 24 __ LDA SP + 1
+1e2d : e9 00 __ SBC #$00
+1e2f : 85 24 __ STA SP + 1
+1e31 : a0 03 __ LDY #$03
+1e33 : b9 53 00 LDA $0053,y 
+1e36 : 91 23 __ STA (SP + 0),y
+1e38 : 88 __ __ DEY
+1e39 : 10 f8 __ BPL $1e33
+1e3b : 38 __ __ SEC
+1e3c : a5 23 __ LDA SP + 0
+1e3e : e9 06 __ SBC #$06
+1e40 : 85 23 __ STA SP + 0
+1e42 : a5 24 __ LDA SP + 1
+1e44 : e9 00 __ SBC #$00
+1e46 : 85 24 __ STA SP + 1
+1e48 : a0 1c __ LDY #$1c
+1e4a : b1 23 __ LDA (SP + 0),y
+1e4c : 85 53 __ STA T0 + 0
+1e4e : c8 __ __ INY
+1e4f : b1 23 __ LDA (SP + 0),y
+1e51 : 85 54 __ STA T0 + 1
+1e53 : 10 25 __ BPL $1e7a
+1e55 : 18 __ __ CLC
+1e56 : a5 23 __ LDA SP + 0
+1e58 : 69 06 __ ADC #$06
+1e5a : 85 23 __ STA SP + 0
+1e5c : a5 24 __ LDA SP + 1
+1e5e : 69 00 __ ADC #$00
+1e60 : 85 24 __ STA SP + 1
+1e62 : a0 03 __ LDY #$03
+1e64 : b1 23 __ LDA (SP + 0),y
+1e66 : 99 53 00 STA $0053,y 
+1e69 : 88 __ __ DEY
+1e6a : 10 f8 __ BPL $1e64
+1e6c : 18 __ __ CLC
+1e6d : a5 23 __ LDA SP + 0
+1e6f : 69 12 __ ADC #$12
+1e71 : 85 23 __ STA SP + 0
+1e73 : a5 24 __ LDA SP + 1
+1e75 : 69 00 __ ADC #$00
+1e77 : 85 24 __ STA SP + 1
+1e79 : 60 __ __ RTS
+1e7a : d0 06 __ BNE $1e82
+1e7c : a9 01 __ LDA #$01
+1e7e : c5 53 __ CMP T0 + 0
+1e80 : b0 d3 __ BCS $1e55
+1e82 : 18 __ __ CLC
+1e83 : a5 23 __ LDA SP + 0
+1e85 : 69 0a __ ADC #$0a
+1e87 : 85 55 __ STA T2 + 0
+1e89 : a5 24 __ LDA SP + 1
+1e8b : 69 00 __ ADC #$00
+1e8d : 85 56 __ STA T2 + 1
+1e8f : a0 1a __ LDY #$1a
+1e91 : b1 23 __ LDA (SP + 0),y
+1e93 : 85 44 __ STA T3 + 0
+1e95 : c8 __ __ INY
+1e96 : b1 23 __ LDA (SP + 0),y
+1e98 : 85 45 __ STA T3 + 1
+1e9a : a0 0b __ LDY #$0b
+1e9c : b1 44 __ LDA (T3 + 0),y
+1e9e : 91 55 __ STA (T2 + 0),y
+1ea0 : 88 __ __ DEY
+1ea1 : 10 f9 __ BPL $1e9c
+1ea3 : a9 00 __ LDA #$00
+1ea5 : 85 55 __ STA T2 + 0
+1ea7 : 85 56 __ STA T2 + 1
+1ea9 : a5 54 __ LDA T0 + 1
+1eab : 30 03 __ BMI $1eb0
+1ead : 4c 72 1f JMP $1f72 ; (qsort + 334)
+1eb0 : a0 1a __ LDY #$1a
+1eb2 : b1 23 __ LDA (SP + 0),y
+1eb4 : 85 53 __ STA T0 + 0
+1eb6 : c8 __ __ INY
+1eb7 : b1 23 __ LDA (SP + 0),y
+1eb9 : 85 54 __ STA T0 + 1
+1ebb : a5 55 __ LDA T2 + 0
+1ebd : 0a __ __ ASL
+1ebe : aa __ __ TAX
+1ebf : a5 56 __ LDA T2 + 1
+1ec1 : 2a __ __ ROL
+1ec2 : a8 __ __ TAY
+1ec3 : 18 __ __ CLC
+1ec4 : 8a __ __ TXA
+1ec5 : 65 55 __ ADC T2 + 0
+1ec7 : 85 1b __ STA ACCU + 0
+1ec9 : 98 __ __ TYA
+1eca : 65 56 __ ADC T2 + 1
+1ecc : 06 1b __ ASL ACCU + 0
+1ece : 2a __ __ ROL
+1ecf : 06 1b __ ASL ACCU + 0
+1ed1 : 2a __ __ ROL
+1ed2 : 85 1c __ STA ACCU + 1
+1ed4 : 18 __ __ CLC
+1ed5 : a5 53 __ LDA T0 + 0
+1ed7 : 65 1b __ ADC ACCU + 0
+1ed9 : 85 44 __ STA T3 + 0
+1edb : a5 54 __ LDA T0 + 1
+1edd : 65 1c __ ADC ACCU + 1
+1edf : 85 45 __ STA T3 + 1
+1ee1 : 18 __ __ CLC
+1ee2 : a5 23 __ LDA SP + 0
+1ee4 : 69 0a __ ADC #$0a
+1ee6 : 85 46 __ STA T4 + 0
+1ee8 : a5 24 __ LDA SP + 1
+1eea : 69 00 __ ADC #$00
+1eec : 85 47 __ STA T4 + 1
+1eee : a0 0b __ LDY #$0b
+1ef0 : b1 46 __ LDA (T4 + 0),y
+1ef2 : 91 44 __ STA (T3 + 0),y
+1ef4 : 88 __ __ DEY
+1ef5 : 10 f9 __ BPL $1ef0
+1ef7 : a5 53 __ LDA T0 + 0
+1ef9 : a0 02 __ LDY #$02
+1efb : 91 23 __ STA (SP + 0),y
+1efd : a5 54 __ LDA T0 + 1
+1eff : c8 __ __ INY
+1f00 : 91 23 __ STA (SP + 0),y
+1f02 : a5 55 __ LDA T2 + 0
+1f04 : c8 __ __ INY
+1f05 : 91 23 __ STA (SP + 0),y
+1f07 : a5 56 __ LDA T2 + 1
+1f09 : c8 __ __ INY
+1f0a : 91 23 __ STA (SP + 0),y
+1f0c : 20 24 1e JSR $1e24 ; (qsort + 0)
+1f0f : a0 1a __ LDY #$1a
+1f11 : b1 23 __ LDA (SP + 0),y
+1f13 : 85 53 __ STA T0 + 0
+1f15 : c8 __ __ INY
+1f16 : b1 23 __ LDA (SP + 0),y
+1f18 : 85 54 __ STA T0 + 1
+1f1a : a5 55 __ LDA T2 + 0
+1f1c : 0a __ __ ASL
+1f1d : aa __ __ TAX
+1f1e : a5 56 __ LDA T2 + 1
+1f20 : 2a __ __ ROL
+1f21 : a8 __ __ TAY
+1f22 : 18 __ __ CLC
+1f23 : 8a __ __ TXA
+1f24 : 65 55 __ ADC T2 + 0
+1f26 : 85 1b __ STA ACCU + 0
+1f28 : 98 __ __ TYA
+1f29 : 65 56 __ ADC T2 + 1
+1f2b : 06 1b __ ASL ACCU + 0
+1f2d : 2a __ __ ROL
+1f2e : 06 1b __ ASL ACCU + 0
+1f30 : 2a __ __ ROL
+1f31 : 85 1c __ STA ACCU + 1
+1f33 : 18 __ __ CLC
+1f34 : a5 53 __ LDA T0 + 0
+1f36 : 65 1b __ ADC ACCU + 0
+1f38 : aa __ __ TAX
+1f39 : a5 54 __ LDA T0 + 1
+1f3b : 65 1c __ ADC ACCU + 1
+1f3d : 85 54 __ STA T0 + 1
+1f3f : 18 __ __ CLC
+1f40 : 8a __ __ TXA
+1f41 : 69 0c __ ADC #$0c
+1f43 : a0 02 __ LDY #$02
+1f45 : 91 23 __ STA (SP + 0),y
+1f47 : a5 54 __ LDA T0 + 1
+1f49 : 69 00 __ ADC #$00
+1f4b : c8 __ __ INY
+1f4c : 91 23 __ STA (SP + 0),y
+1f4e : a0 1c __ LDY #$1c
+1f50 : b1 23 __ LDA (SP + 0),y
+1f52 : 38 __ __ SEC
+1f53 : e5 55 __ SBC T2 + 0
+1f55 : aa __ __ TAX
+1f56 : c8 __ __ INY
+1f57 : b1 23 __ LDA (SP + 0),y
+1f59 : e5 56 __ SBC T2 + 1
+1f5b : 85 54 __ STA T0 + 1
+1f5d : 38 __ __ SEC
+1f5e : 8a __ __ TXA
+1f5f : e9 01 __ SBC #$01
+1f61 : a0 04 __ LDY #$04
+1f63 : 91 23 __ STA (SP + 0),y
+1f65 : a5 54 __ LDA T0 + 1
+1f67 : e9 00 __ SBC #$00
+1f69 : c8 __ __ INY
+1f6a : 91 23 __ STA (SP + 0),y
+1f6c : 20 24 1e JSR $1e24 ; (qsort + 0)
+1f6f : 4c 55 1e JMP $1e55 ; (qsort + 49)
+1f72 : d0 09 __ BNE $1f7d
+1f74 : a9 01 __ LDA #$01
+1f76 : c5 53 __ CMP T0 + 0
+1f78 : 90 03 __ BCC $1f7d
+1f7a : 4c b0 1e JMP $1eb0 ; (qsort + 140)
+1f7d : a9 01 __ LDA #$01
+1f7f : 85 53 __ STA T0 + 0
+1f81 : a9 00 __ LDA #$00
+1f83 : 85 54 __ STA T0 + 1
+1f85 : a0 1a __ LDY #$1a
+1f87 : b1 23 __ LDA (SP + 0),y
+1f89 : 85 44 __ STA T3 + 0
+1f8b : c8 __ __ INY
+1f8c : b1 23 __ LDA (SP + 0),y
+1f8e : 85 45 __ STA T3 + 1
+1f90 : a5 53 __ LDA T0 + 0
+1f92 : 0a __ __ ASL
+1f93 : aa __ __ TAX
+1f94 : a5 54 __ LDA T0 + 1
+1f96 : 2a __ __ ROL
+1f97 : a8 __ __ TAY
+1f98 : 18 __ __ CLC
+1f99 : 8a __ __ TXA
+1f9a : 65 53 __ ADC T0 + 0
+1f9c : 85 1b __ STA ACCU + 0
+1f9e : 98 __ __ TYA
+1f9f : 65 54 __ ADC T0 + 1
+1fa1 : 06 1b __ ASL ACCU + 0
+1fa3 : 2a __ __ ROL
+1fa4 : 06 1b __ ASL ACCU + 0
+1fa6 : 2a __ __ ROL
+1fa7 : 85 1c __ STA ACCU + 1
+1fa9 : 18 __ __ CLC
+1faa : a5 44 __ LDA T3 + 0
+1fac : 65 1b __ ADC ACCU + 0
+1fae : aa __ __ TAX
+1faf : a5 45 __ LDA T3 + 1
+1fb1 : 65 1c __ ADC ACCU + 1
+1fb3 : a8 __ __ TAY
+1fb4 : 18 __ __ CLC
+1fb5 : 8a __ __ TXA
+1fb6 : 69 02 __ ADC #$02
+1fb8 : 85 0d __ STA P0
+1fba : 98 __ __ TYA
+1fbb : 69 00 __ ADC #$00
+1fbd : 85 0e __ STA P1
+1fbf : 18 __ __ CLC
+1fc0 : a5 23 __ LDA SP + 0
+1fc2 : 69 0c __ ADC #$0c
+1fc4 : 85 0f __ STA P2
+1fc6 : a5 24 __ LDA SP + 1
+1fc8 : 69 00 __ ADC #$00
+1fca : 85 10 __ STA P3
+1fcc : 20 77 20 JSR $2077 ; (strcmp + 0)
+1fcf : a5 1c __ LDA ACCU + 1
+1fd1 : 30 24 __ BMI $1ff7
+1fd3 : a0 1c __ LDY #$1c
+1fd5 : b1 23 __ LDA (SP + 0),y
+1fd7 : 85 44 __ STA T3 + 0
+1fd9 : c8 __ __ INY
+1fda : b1 23 __ LDA (SP + 0),y
+1fdc : e6 53 __ INC T0 + 0
+1fde : d0 02 __ BNE $1fe2
+1fe0 : e6 54 __ INC T0 + 1
+1fe2 : 49 80 __ EOR #$80
+1fe4 : 85 03 __ STA $03
+1fe6 : a5 54 __ LDA T0 + 1
+1fe8 : 49 80 __ EOR #$80
+1fea : c5 03 __ CMP $03
+1fec : d0 04 __ BNE $1ff2
+1fee : a5 53 __ LDA T0 + 0
+1ff0 : c5 44 __ CMP T3 + 0
+1ff2 : 90 91 __ BCC $1f85
+1ff4 : 4c b0 1e JMP $1eb0 ; (qsort + 140)
+1ff7 : a0 1a __ LDY #$1a
+1ff9 : b1 23 __ LDA (SP + 0),y
+1ffb : 85 44 __ STA T3 + 0
+1ffd : c8 __ __ INY
+1ffe : b1 23 __ LDA (SP + 0),y
+2000 : 85 45 __ STA T3 + 1
+2002 : a5 55 __ LDA T2 + 0
+2004 : 0a __ __ ASL
+2005 : aa __ __ TAX
+2006 : a5 56 __ LDA T2 + 1
+2008 : 2a __ __ ROL
+2009 : a8 __ __ TAY
+200a : 18 __ __ CLC
+200b : 8a __ __ TXA
+200c : 65 55 __ ADC T2 + 0
+200e : 85 1b __ STA ACCU + 0
+2010 : 98 __ __ TYA
+2011 : 65 56 __ ADC T2 + 1
+2013 : 06 1b __ ASL ACCU + 0
+2015 : 2a __ __ ROL
+2016 : 06 1b __ ASL ACCU + 0
+2018 : 2a __ __ ROL
+2019 : 85 1c __ STA ACCU + 1
+201b : 18 __ __ CLC
+201c : a5 44 __ LDA T3 + 0
+201e : 65 1b __ ADC ACCU + 0
+2020 : 85 46 __ STA T4 + 0
+2022 : a5 45 __ LDA T3 + 1
+2024 : 65 1c __ ADC ACCU + 1
+2026 : 85 47 __ STA T4 + 1
+2028 : a5 53 __ LDA T0 + 0
+202a : 0a __ __ ASL
+202b : aa __ __ TAX
+202c : a5 54 __ LDA T0 + 1
+202e : 2a __ __ ROL
+202f : a8 __ __ TAY
+2030 : 18 __ __ CLC
+2031 : 8a __ __ TXA
+2032 : 65 53 __ ADC T0 + 0
+2034 : 85 1b __ STA ACCU + 0
+2036 : 98 __ __ TYA
+2037 : 65 54 __ ADC T0 + 1
+2039 : 06 1b __ ASL ACCU + 0
+203b : 2a __ __ ROL
+203c : 06 1b __ ASL ACCU + 0
+203e : 2a __ __ ROL
+203f : 85 1c __ STA ACCU + 1
+2041 : 18 __ __ CLC
+2042 : a5 44 __ LDA T3 + 0
+2044 : 65 1b __ ADC ACCU + 0
+2046 : 85 44 __ STA T3 + 0
+2048 : a5 45 __ LDA T3 + 1
+204a : 65 1c __ ADC ACCU + 1
+204c : 85 45 __ STA T3 + 1
+204e : a0 0b __ LDY #$0b
+2050 : b1 44 __ LDA (T3 + 0),y
+2052 : 91 46 __ STA (T4 + 0),y
+2054 : 88 __ __ DEY
+2055 : 10 f9 __ BPL $2050
+2057 : 18 __ __ CLC
+2058 : a5 46 __ LDA T4 + 0
+205a : 69 0c __ ADC #$0c
+205c : 85 46 __ STA T4 + 0
+205e : 90 02 __ BCC $2062
+2060 : e6 47 __ INC T4 + 1
+2062 : a0 0b __ LDY #$0b
+2064 : b1 46 __ LDA (T4 + 0),y
+2066 : 91 44 __ STA (T3 + 0),y
+2068 : 88 __ __ DEY
+2069 : 10 f9 __ BPL $2064
+206b : e6 55 __ INC T2 + 0
+206d : f0 03 __ BEQ $2072
+206f : 4c d3 1f JMP $1fd3 ; (qsort + 431)
+2072 : e6 56 __ INC T2 + 1
+2074 : 4c d3 1f JMP $1fd3 ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+2077 : a0 00 __ LDY #$00
+2079 : 84 1c __ STY ACCU + 1
+207b : b1 0d __ LDA (P0),y
+207d : f0 16 __ BEQ $2095
+207f : d1 0f __ CMP (P2),y
+2081 : d0 16 __ BNE $2099
+2083 : c8 __ __ INY
+2084 : b1 0d __ LDA (P0),y
+2086 : f0 0d __ BEQ $2095
+2088 : d1 0f __ CMP (P2),y
+208a : d0 0d __ BNE $2099
+208c : c8 __ __ INY
+208d : d0 ec __ BNE $207b
+208f : e6 0e __ INC P1
+2091 : e6 10 __ INC P3
+2093 : d0 e6 __ BNE $207b
+2095 : d1 0f __ CMP (P2),y
+2097 : f0 0a __ BEQ $20a3
+2099 : b0 06 __ BCS $20a1
+209b : a9 ff __ LDA #$ff
+209d : 85 1c __ STA ACCU + 1
+209f : 30 02 __ BMI $20a3
+20a1 : a9 01 __ LDA #$01
+20a3 : 85 1b __ STA ACCU + 0
+20a5 : 60 __ __ RTS
+--------------------------------------------------------------------
+check:
+20a6 : 38 __ __ SEC
+20a7 : a5 23 __ LDA SP + 0
+20a9 : e9 03 __ SBC #$03
+20ab : 85 23 __ STA SP + 0
+20ad : a5 24 __ LDA SP + 1
+20af : e9 00 __ SBC #$00
+20b1 : 85 24 __ STA SP + 1
+20b3 : a0 07 __ LDY #$07
+20b5 : b1 23 __ LDA (SP + 0),y
+20b7 : 85 44 __ STA T0 + 0
+20b9 : c8 __ __ INY
+20ba : b1 23 __ LDA (SP + 0),y
+20bc : 30 04 __ BMI $20c2
+20be : 05 44 __ ORA T0 + 0
+20c0 : d0 0e __ BNE $20d0
+20c2 : 18 __ __ CLC
+20c3 : a5 23 __ LDA SP + 0
+20c5 : 69 03 __ ADC #$03
+20c7 : 85 23 __ STA SP + 0
+20c9 : a5 24 __ LDA SP + 1
+20cb : 69 00 __ ADC #$00
+20cd : 85 24 __ STA SP + 1
+20cf : 60 __ __ RTS
+20d0 : a9 00 __ LDA #$00
+20d2 : 85 44 __ STA T0 + 0
+20d4 : 85 45 __ STA T0 + 1
+20d6 : a0 07 __ LDY #$07
+20d8 : b1 23 __ LDA (SP + 0),y
+20da : 85 46 __ STA T2 + 0
+20dc : c8 __ __ INY
+20dd : b1 23 __ LDA (SP + 0),y
+20df : 85 47 __ STA T2 + 1
+20e1 : a0 05 __ LDY #$05
+20e3 : b1 23 __ LDA (SP + 0),y
+20e5 : 85 48 __ STA T3 + 0
+20e7 : c8 __ __ INY
+20e8 : b1 23 __ LDA (SP + 0),y
+20ea : 85 49 __ STA T3 + 1
+20ec : a5 44 __ LDA T0 + 0
+20ee : 0a __ __ ASL
+20ef : aa __ __ TAX
+20f0 : a5 45 __ LDA T0 + 1
+20f2 : 2a __ __ ROL
+20f3 : a8 __ __ TAY
+20f4 : 18 __ __ CLC
+20f5 : 8a __ __ TXA
+20f6 : 65 44 __ ADC T0 + 0
+20f8 : 85 1b __ STA ACCU + 0
+20fa : 98 __ __ TYA
+20fb : 65 45 __ ADC T0 + 1
+20fd : 06 1b __ ASL ACCU + 0
+20ff : 2a __ __ ROL
+2100 : 06 1b __ ASL ACCU + 0
+2102 : 2a __ __ ROL
+2103 : 85 1c __ STA ACCU + 1
+2105 : 18 __ __ CLC
+2106 : a5 48 __ LDA T3 + 0
+2108 : 65 1b __ ADC ACCU + 0
+210a : 85 4a __ STA T4 + 0
+210c : a5 49 __ LDA T3 + 1
+210e : 65 1c __ ADC ACCU + 1
+2110 : 85 4b __ STA T4 + 1
+2112 : a0 00 __ LDY #$00
+2114 : b1 4a __ LDA (T4 + 0),y
+2116 : 85 02 __ STA $02
+2118 : c8 __ __ INY
+2119 : b1 4a __ LDA (T4 + 0),y
+211b : c5 45 __ CMP T0 + 1
+211d : d0 06 __ BNE $2125
+211f : a5 02 __ LDA $02
+2121 : c5 44 __ CMP T0 + 0
+2123 : f0 26 __ BEQ $214b
+2125 : a9 00 __ LDA #$00
+2127 : a0 02 __ LDY #$02
+2129 : 91 23 __ STA (SP + 0),y
+212b : 20 50 21 JSR $2150 ; (assert + 0)
+212e : e6 44 __ INC T0 + 0
+2130 : d0 02 __ BNE $2134
+2132 : e6 45 __ INC T0 + 1
+2134 : a5 47 __ LDA T2 + 1
+2136 : 49 80 __ EOR #$80
+2138 : 85 03 __ STA $03
+213a : a5 45 __ LDA T0 + 1
+213c : 49 80 __ EOR #$80
+213e : c5 03 __ CMP $03
+2140 : d0 04 __ BNE $2146
+2142 : a5 44 __ LDA T0 + 0
+2144 : c5 46 __ CMP T2 + 0
+2146 : 90 a4 __ BCC $20ec
+2148 : 4c c2 20 JMP $20c2 ; (check + 28)
+214b : a9 01 __ LDA #$01
+214d : 4c 27 21 JMP $2127 ; (check + 129)
+--------------------------------------------------------------------
+assert:
+2150 : a0 02 __ LDY #$02
+2152 : b1 23 __ LDA (SP + 0),y
+2154 : d0 09 __ BNE $215f
+2156 : a9 ff __ LDA #$ff
+2158 : 85 0d __ STA P0
+215a : 85 0e __ STA P1
+215c : 20 60 21 JSR $2160 ; (exit + 0)
+215f : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+2160 : a5 0d __ LDA P0
+2162 : 85 1b __ STA ACCU + 0
+2164 : a5 0e __ LDA P1
+2166 : 85 1c __ STA ACCU + 1
+2168 : ae c8 25 LDX $25c8 ; (spentry + 0)
+216b : 9a __ __ TXS
+216c : a9 4c __ LDA #$4c
+216e : 85 54 __ STA $54
+2170 : a9 00 __ LDA #$00
+2172 : 85 13 __ STA P6
+2174 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+2175 : a9 4c __ LDA #$4c
+2177 : 85 54 __ STA $54
+2179 : a9 00 __ LDA #$00
+217b : 85 13 __ STA P6
+217d : a9 19 __ LDA #$19
+217f : 85 16 __ STA P9
+2181 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+2182 : b1 19 __ LDA (IP + 0),y
+2184 : c8 __ __ INY
+2185 : aa __ __ TAX
+2186 : b5 00 __ LDA $00,x
+2188 : 85 03 __ STA $03
+218a : b5 01 __ LDA $01,x
+218c : 85 04 __ STA $04
+218e : b5 02 __ LDA $02,x
+2190 : 85 05 __ STA $05
+2192 : b5 03 __ LDA $03,x
+2194 : 85 06 __ STA $06
+2196 : a5 05 __ LDA $05
+2198 : 0a __ __ ASL
+2199 : a5 06 __ LDA $06
+219b : 2a __ __ ROL
+219c : 85 08 __ STA $08
+219e : f0 06 __ BEQ $21a6
+21a0 : a5 05 __ LDA $05
+21a2 : 09 80 __ ORA #$80
+21a4 : 85 05 __ STA $05
+21a6 : a5 1d __ LDA ACCU + 2
+21a8 : 0a __ __ ASL
+21a9 : a5 1e __ LDA ACCU + 3
+21ab : 2a __ __ ROL
+21ac : 85 07 __ STA $07
+21ae : f0 06 __ BEQ $21b6
+21b0 : a5 1d __ LDA ACCU + 2
+21b2 : 09 80 __ ORA #$80
+21b4 : 85 1d __ STA ACCU + 2
+21b6 : 60 __ __ RTS
+21b7 : 06 1e __ ASL ACCU + 3
+21b9 : a5 07 __ LDA $07
+21bb : 6a __ __ ROR
+21bc : 85 1e __ STA ACCU + 3
+21be : b0 06 __ BCS $21c6
+21c0 : a5 1d __ LDA ACCU + 2
+21c2 : 29 7f __ AND #$7f
+21c4 : 85 1d __ STA ACCU + 2
+21c6 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+21c7 : 38 __ __ SEC
+21c8 : a5 07 __ LDA $07
+21ca : e5 08 __ SBC $08
+21cc : f0 38 __ BEQ $2206
+21ce : aa __ __ TAX
+21cf : b0 25 __ BCS $21f6
+21d1 : e0 e9 __ CPX #$e9
+21d3 : b0 0e __ BCS $21e3
+21d5 : a5 08 __ LDA $08
+21d7 : 85 07 __ STA $07
+21d9 : a9 00 __ LDA #$00
+21db : 85 1b __ STA ACCU + 0
+21dd : 85 1c __ STA ACCU + 1
+21df : 85 1d __ STA ACCU + 2
+21e1 : f0 23 __ BEQ $2206
+21e3 : a5 1d __ LDA ACCU + 2
+21e5 : 4a __ __ LSR
+21e6 : 66 1c __ ROR ACCU + 1
+21e8 : 66 1b __ ROR ACCU + 0
+21ea : e8 __ __ INX
+21eb : d0 f8 __ BNE $21e5
+21ed : 85 1d __ STA ACCU + 2
+21ef : a5 08 __ LDA $08
+21f1 : 85 07 __ STA $07
+21f3 : 4c 06 22 JMP $2206 ; (faddsub + 63)
+21f6 : e0 18 __ CPX #$18
+21f8 : b0 33 __ BCS $222d
+21fa : a5 05 __ LDA $05
+21fc : 4a __ __ LSR
+21fd : 66 04 __ ROR $04
+21ff : 66 03 __ ROR $03
+2201 : ca __ __ DEX
+2202 : d0 f8 __ BNE $21fc
+2204 : 85 05 __ STA $05
+2206 : a5 1e __ LDA ACCU + 3
+2208 : 29 80 __ AND #$80
+220a : 85 1e __ STA ACCU + 3
+220c : 45 06 __ EOR $06
+220e : 30 2d __ BMI $223d
+2210 : 18 __ __ CLC
+2211 : a5 1b __ LDA ACCU + 0
+2213 : 65 03 __ ADC $03
+2215 : 85 1b __ STA ACCU + 0
+2217 : a5 1c __ LDA ACCU + 1
+2219 : 65 04 __ ADC $04
+221b : 85 1c __ STA ACCU + 1
+221d : a5 1d __ LDA ACCU + 2
+221f : 65 05 __ ADC $05
+2221 : 85 1d __ STA ACCU + 2
+2223 : 90 08 __ BCC $222d
+2225 : 66 1d __ ROR ACCU + 2
+2227 : 66 1c __ ROR ACCU + 1
+2229 : 66 1b __ ROR ACCU + 0
+222b : e6 07 __ INC $07
+222d : a5 07 __ LDA $07
+222f : 4a __ __ LSR
+2230 : 05 1e __ ORA ACCU + 3
+2232 : 85 1e __ STA ACCU + 3
+2234 : b0 06 __ BCS $223c
+2236 : a5 1d __ LDA ACCU + 2
+2238 : 29 7f __ AND #$7f
+223a : 85 1d __ STA ACCU + 2
+223c : 60 __ __ RTS
+223d : 38 __ __ SEC
+223e : a5 1b __ LDA ACCU + 0
+2240 : e5 03 __ SBC $03
+2242 : 85 1b __ STA ACCU + 0
+2244 : a5 1c __ LDA ACCU + 1
+2246 : e5 04 __ SBC $04
+2248 : 85 1c __ STA ACCU + 1
+224a : a5 1d __ LDA ACCU + 2
+224c : e5 05 __ SBC $05
+224e : 85 1d __ STA ACCU + 2
+2250 : b0 19 __ BCS $226b
+2252 : 38 __ __ SEC
+2253 : a9 00 __ LDA #$00
+2255 : e5 1b __ SBC ACCU + 0
+2257 : 85 1b __ STA ACCU + 0
+2259 : a9 00 __ LDA #$00
+225b : e5 1c __ SBC ACCU + 1
+225d : 85 1c __ STA ACCU + 1
+225f : a9 00 __ LDA #$00
+2261 : e5 1d __ SBC ACCU + 2
+2263 : 85 1d __ STA ACCU + 2
+2265 : a5 1e __ LDA ACCU + 3
+2267 : 49 80 __ EOR #$80
+2269 : 85 1e __ STA ACCU + 3
+226b : a5 1d __ LDA ACCU + 2
+226d : 30 be __ BMI $222d
+226f : 05 1c __ ORA ACCU + 1
+2271 : 05 1b __ ORA ACCU + 0
+2273 : f0 0f __ BEQ $2284
+2275 : c6 07 __ DEC $07
+2277 : f0 0b __ BEQ $2284
+2279 : 06 1b __ ASL ACCU + 0
+227b : 26 1c __ ROL ACCU + 1
+227d : 26 1d __ ROL ACCU + 2
+227f : 10 f4 __ BPL $2275
+2281 : 4c 2d 22 JMP $222d ; (faddsub + 102)
+2284 : a9 00 __ LDA #$00
+2286 : 85 1b __ STA ACCU + 0
+2288 : 85 1c __ STA ACCU + 1
+228a : 85 1d __ STA ACCU + 2
+228c : 85 1e __ STA ACCU + 3
+228e : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+228f : a5 1b __ LDA ACCU + 0
+2291 : 05 1c __ ORA ACCU + 1
+2293 : 05 1d __ ORA ACCU + 2
+2295 : d0 03 __ BNE $229a
+2297 : 85 1e __ STA ACCU + 3
+2299 : 60 __ __ RTS
+229a : a5 03 __ LDA $03
+229c : 05 04 __ ORA $04
+229e : 05 05 __ ORA $05
+22a0 : d0 09 __ BNE $22ab
+22a2 : 85 1b __ STA ACCU + 0
+22a4 : 85 1c __ STA ACCU + 1
+22a6 : 85 1d __ STA ACCU + 2
+22a8 : 85 1e __ STA ACCU + 3
+22aa : 60 __ __ RTS
+22ab : a9 00 __ LDA #$00
+22ad : 85 09 __ STA $09
+22af : 85 0a __ STA $0a
+22b1 : 85 0b __ STA $0b
+22b3 : a4 1b __ LDY ACCU + 0
+22b5 : a5 03 __ LDA $03
+22b7 : d0 06 __ BNE $22bf
+22b9 : a5 04 __ LDA $04
+22bb : f0 0a __ BEQ $22c7
+22bd : d0 05 __ BNE $22c4
+22bf : 20 ff 22 JSR $22ff ; (fmul8 + 0)
+22c2 : a5 04 __ LDA $04
+22c4 : 20 ff 22 JSR $22ff ; (fmul8 + 0)
+22c7 : a5 05 __ LDA $05
+22c9 : 20 ff 22 JSR $22ff ; (fmul8 + 0)
+22cc : 38 __ __ SEC
+22cd : a5 0b __ LDA $0b
+22cf : 30 06 __ BMI $22d7
+22d1 : 06 09 __ ASL $09
+22d3 : 26 0a __ ROL $0a
+22d5 : 2a __ __ ROL
+22d6 : 18 __ __ CLC
+22d7 : 29 7f __ AND #$7f
+22d9 : 85 0b __ STA $0b
+22db : a5 1e __ LDA ACCU + 3
+22dd : 45 06 __ EOR $06
+22df : 29 80 __ AND #$80
+22e1 : 85 1e __ STA ACCU + 3
+22e3 : a5 07 __ LDA $07
+22e5 : e9 7e __ SBC #$7e
+22e7 : 18 __ __ CLC
+22e8 : 65 08 __ ADC $08
+22ea : 4a __ __ LSR
+22eb : 05 1e __ ORA ACCU + 3
+22ed : 85 1e __ STA ACCU + 3
+22ef : a9 00 __ LDA #$00
+22f1 : 6a __ __ ROR
+22f2 : 05 0b __ ORA $0b
+22f4 : 85 1d __ STA ACCU + 2
+22f6 : a5 0a __ LDA $0a
+22f8 : 85 1c __ STA ACCU + 1
+22fa : a5 09 __ LDA $09
+22fc : 85 1b __ STA ACCU + 0
+22fe : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+22ff : 38 __ __ SEC
+2300 : 6a __ __ ROR
+2301 : 90 1e __ BCC $2321
+2303 : aa __ __ TAX
+2304 : 18 __ __ CLC
+2305 : 98 __ __ TYA
+2306 : 65 09 __ ADC $09
+2308 : 85 09 __ STA $09
+230a : a5 0a __ LDA $0a
+230c : 65 1c __ ADC ACCU + 1
+230e : 85 0a __ STA $0a
+2310 : a5 0b __ LDA $0b
+2312 : 65 1d __ ADC ACCU + 2
+2314 : 6a __ __ ROR
+2315 : 85 0b __ STA $0b
+2317 : 8a __ __ TXA
+2318 : 66 0a __ ROR $0a
+231a : 66 09 __ ROR $09
+231c : 4a __ __ LSR
+231d : f0 0d __ BEQ $232c
+231f : b0 e2 __ BCS $2303
+2321 : 66 0b __ ROR $0b
+2323 : 66 0a __ ROR $0a
+2325 : 66 09 __ ROR $09
+2327 : 4a __ __ LSR
+2328 : 90 f7 __ BCC $2321
+232a : d0 d7 __ BNE $2303
+232c : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+232d : a5 1b __ LDA ACCU + 0
+232f : 05 1c __ ORA ACCU + 1
+2331 : 05 1d __ ORA ACCU + 2
+2333 : d0 03 __ BNE $2338
+2335 : 85 1e __ STA ACCU + 3
+2337 : 60 __ __ RTS
+2338 : a5 1e __ LDA ACCU + 3
+233a : 45 06 __ EOR $06
+233c : 29 80 __ AND #$80
+233e : 85 1e __ STA ACCU + 3
+2340 : a9 00 __ LDA #$00
+2342 : 85 09 __ STA $09
+2344 : 85 0a __ STA $0a
+2346 : 85 0b __ STA $0b
+2348 : a2 18 __ LDX #$18
+234a : a5 1b __ LDA ACCU + 0
+234c : c5 03 __ CMP $03
+234e : a5 1c __ LDA ACCU + 1
+2350 : e5 04 __ SBC $04
+2352 : a5 1d __ LDA ACCU + 2
+2354 : e5 05 __ SBC $05
+2356 : 90 13 __ BCC $236b
+2358 : a5 1b __ LDA ACCU + 0
+235a : e5 03 __ SBC $03
+235c : 85 1b __ STA ACCU + 0
+235e : a5 1c __ LDA ACCU + 1
+2360 : e5 04 __ SBC $04
+2362 : 85 1c __ STA ACCU + 1
+2364 : a5 1d __ LDA ACCU + 2
+2366 : e5 05 __ SBC $05
+2368 : 85 1d __ STA ACCU + 2
+236a : 38 __ __ SEC
+236b : 26 09 __ ROL $09
+236d : 26 0a __ ROL $0a
+236f : 26 0b __ ROL $0b
+2371 : ca __ __ DEX
+2372 : f0 0a __ BEQ $237e
+2374 : 06 1b __ ASL ACCU + 0
+2376 : 26 1c __ ROL ACCU + 1
+2378 : 26 1d __ ROL ACCU + 2
+237a : b0 dc __ BCS $2358
+237c : 90 cc __ BCC $234a
+237e : 38 __ __ SEC
+237f : a5 0b __ LDA $0b
+2381 : 30 06 __ BMI $2389
+2383 : 06 09 __ ASL $09
+2385 : 26 0a __ ROL $0a
+2387 : 2a __ __ ROL
+2388 : 18 __ __ CLC
+2389 : 29 7f __ AND #$7f
+238b : 85 0b __ STA $0b
+238d : a5 08 __ LDA $08
+238f : 49 7f __ EOR #$7f
+2391 : 65 07 __ ADC $07
+2393 : 38 __ __ SEC
+2394 : e9 01 __ SBC #$01
+2396 : 4a __ __ LSR
+2397 : 05 1e __ ORA ACCU + 3
+2399 : 85 1e __ STA ACCU + 3
+239b : a9 00 __ LDA #$00
+239d : 6a __ __ ROR
+239e : 05 0b __ ORA $0b
+23a0 : 85 1d __ STA ACCU + 2
+23a2 : a5 0a __ LDA $0a
+23a4 : 85 1c __ STA ACCU + 1
+23a6 : a5 09 __ LDA $09
+23a8 : 85 1b __ STA ACCU + 0
+23aa : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+23ab : 24 1c __ BIT ACCU + 1
+23ad : 10 0d __ BPL $23bc
+23af : 20 c9 23 JSR $23c9 ; (negaccu + 0)
+23b2 : 24 04 __ BIT $04
+23b4 : 10 0d __ BPL $23c3
+23b6 : 20 d7 23 JSR $23d7 ; (negtmp + 0)
+23b9 : 4c e5 23 JMP $23e5 ; (divmod + 0)
+23bc : 24 04 __ BIT $04
+23be : 10 f9 __ BPL $23b9
+23c0 : 20 d7 23 JSR $23d7 ; (negtmp + 0)
+23c3 : 20 e5 23 JSR $23e5 ; (divmod + 0)
+23c6 : 4c c9 23 JMP $23c9 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+23c9 : 38 __ __ SEC
+23ca : a9 00 __ LDA #$00
+23cc : e5 1b __ SBC ACCU + 0
+23ce : 85 1b __ STA ACCU + 0
+23d0 : a9 00 __ LDA #$00
+23d2 : e5 1c __ SBC ACCU + 1
+23d4 : 85 1c __ STA ACCU + 1
+23d6 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+23d7 : 38 __ __ SEC
+23d8 : a9 00 __ LDA #$00
+23da : e5 03 __ SBC $03
+23dc : 85 03 __ STA $03
+23de : a9 00 __ LDA #$00
+23e0 : e5 04 __ SBC $04
+23e2 : 85 04 __ STA $04
+23e4 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+23e5 : a5 1c __ LDA ACCU + 1
+23e7 : d0 31 __ BNE $241a
+23e9 : a5 04 __ LDA $04
+23eb : d0 1e __ BNE $240b
+23ed : 85 06 __ STA $06
+23ef : a2 04 __ LDX #$04
+23f1 : 06 1b __ ASL ACCU + 0
+23f3 : 2a __ __ ROL
+23f4 : c5 03 __ CMP $03
+23f6 : 90 02 __ BCC $23fa
+23f8 : e5 03 __ SBC $03
+23fa : 26 1b __ ROL ACCU + 0
+23fc : 2a __ __ ROL
+23fd : c5 03 __ CMP $03
+23ff : 90 02 __ BCC $2403
+2401 : e5 03 __ SBC $03
+2403 : 26 1b __ ROL ACCU + 0
+2405 : ca __ __ DEX
+2406 : d0 eb __ BNE $23f3
+2408 : 85 05 __ STA $05
+240a : 60 __ __ RTS
+240b : a5 1b __ LDA ACCU + 0
+240d : 85 05 __ STA $05
+240f : a5 1c __ LDA ACCU + 1
+2411 : 85 06 __ STA $06
+2413 : a9 00 __ LDA #$00
+2415 : 85 1b __ STA ACCU + 0
+2417 : 85 1c __ STA ACCU + 1
+2419 : 60 __ __ RTS
+241a : a5 04 __ LDA $04
+241c : d0 1f __ BNE $243d
+241e : a5 03 __ LDA $03
+2420 : 30 1b __ BMI $243d
+2422 : a9 00 __ LDA #$00
+2424 : 85 06 __ STA $06
+2426 : a2 10 __ LDX #$10
+2428 : 06 1b __ ASL ACCU + 0
+242a : 26 1c __ ROL ACCU + 1
+242c : 2a __ __ ROL
+242d : c5 03 __ CMP $03
+242f : 90 02 __ BCC $2433
+2431 : e5 03 __ SBC $03
+2433 : 26 1b __ ROL ACCU + 0
+2435 : 26 1c __ ROL ACCU + 1
+2437 : ca __ __ DEX
+2438 : d0 f2 __ BNE $242c
+243a : 85 05 __ STA $05
+243c : 60 __ __ RTS
+243d : a9 00 __ LDA #$00
+243f : 85 05 __ STA $05
+2441 : 85 06 __ STA $06
+2443 : 84 02 __ STY $02
+2445 : a0 10 __ LDY #$10
+2447 : 18 __ __ CLC
+2448 : 26 1b __ ROL ACCU + 0
+244a : 26 1c __ ROL ACCU + 1
+244c : 26 05 __ ROL $05
+244e : 26 06 __ ROL $06
+2450 : 38 __ __ SEC
+2451 : a5 05 __ LDA $05
+2453 : e5 03 __ SBC $03
+2455 : aa __ __ TAX
+2456 : a5 06 __ LDA $06
+2458 : e5 04 __ SBC $04
+245a : 90 04 __ BCC $2460
+245c : 86 05 __ STX $05
+245e : 85 06 __ STA $06
+2460 : 88 __ __ DEY
+2461 : d0 e5 __ BNE $2448
+2463 : 26 1b __ ROL ACCU + 0
+2465 : 26 1c __ ROL ACCU + 1
+2467 : a4 02 __ LDY $02
+2469 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+246a : 24 1c __ BIT ACCU + 1
+246c : 10 0d __ BPL $247b
+246e : 20 c9 23 JSR $23c9 ; (negaccu + 0)
+2471 : 24 04 __ BIT $04
+2473 : 10 0d __ BPL $2482
+2475 : 20 d7 23 JSR $23d7 ; (negtmp + 0)
+2478 : 4c e5 23 JMP $23e5 ; (divmod + 0)
+247b : 24 04 __ BIT $04
+247d : 10 f9 __ BPL $2478
+247f : 20 d7 23 JSR $23d7 ; (negtmp + 0)
+2482 : 20 e5 23 JSR $23e5 ; (divmod + 0)
+2485 : 38 __ __ SEC
+2486 : a9 00 __ LDA #$00
+2488 : e5 05 __ SBC $05
+248a : 85 05 __ STA $05
+248c : a9 00 __ LDA #$00
+248e : e5 06 __ SBC $06
+2490 : 85 06 __ STA $06
+2492 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+2493 : 20 a6 21 JSR $21a6 ; (freg + 36)
+2496 : a5 07 __ LDA $07
+2498 : c9 7f __ CMP #$7f
+249a : b0 07 __ BCS $24a3
+249c : a9 00 __ LDA #$00
+249e : 85 1b __ STA ACCU + 0
+24a0 : 85 1c __ STA ACCU + 1
+24a2 : 60 __ __ RTS
+24a3 : 38 __ __ SEC
+24a4 : e9 8e __ SBC #$8e
+24a6 : 90 0a __ BCC $24b2
+24a8 : a9 ff __ LDA #$ff
+24aa : 85 1b __ STA ACCU + 0
+24ac : a9 7f __ LDA #$7f
+24ae : 85 1c __ STA ACCU + 1
+24b0 : d0 08 __ BNE $24ba
+24b2 : aa __ __ TAX
+24b3 : 46 1d __ LSR ACCU + 2
+24b5 : 66 1c __ ROR ACCU + 1
+24b7 : e8 __ __ INX
+24b8 : d0 f9 __ BNE $24b3
+24ba : 24 1e __ BIT ACCU + 3
+24bc : 10 0e __ BPL $24cc
+24be : 38 __ __ SEC
+24bf : a9 00 __ LDA #$00
+24c1 : e5 1c __ SBC ACCU + 1
+24c3 : 85 1b __ STA ACCU + 0
+24c5 : a9 00 __ LDA #$00
+24c7 : e5 1d __ SBC ACCU + 2
+24c9 : 85 1c __ STA ACCU + 1
+24cb : 60 __ __ RTS
+24cc : a5 1c __ LDA ACCU + 1
+24ce : 85 1b __ STA ACCU + 0
+24d0 : a5 1d __ LDA ACCU + 2
+24d2 : 85 1c __ STA ACCU + 1
+24d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+24d5 : 24 1c __ BIT ACCU + 1
+24d7 : 30 03 __ BMI $24dc
+24d9 : 4c f3 24 JMP $24f3 ; (uint16_to_float + 0)
+24dc : 38 __ __ SEC
+24dd : a9 00 __ LDA #$00
+24df : e5 1b __ SBC ACCU + 0
+24e1 : 85 1b __ STA ACCU + 0
+24e3 : a9 00 __ LDA #$00
+24e5 : e5 1c __ SBC ACCU + 1
+24e7 : 85 1c __ STA ACCU + 1
+24e9 : 20 f3 24 JSR $24f3 ; (uint16_to_float + 0)
+24ec : a5 1e __ LDA ACCU + 3
+24ee : 09 80 __ ORA #$80
+24f0 : 85 1e __ STA ACCU + 3
+24f2 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+24f3 : a5 1b __ LDA ACCU + 0
+24f5 : 05 1c __ ORA ACCU + 1
+24f7 : d0 05 __ BNE $24fe
+24f9 : 85 1d __ STA ACCU + 2
+24fb : 85 1e __ STA ACCU + 3
+24fd : 60 __ __ RTS
+24fe : a2 8e __ LDX #$8e
+2500 : a5 1c __ LDA ACCU + 1
+2502 : 30 06 __ BMI $250a
+2504 : ca __ __ DEX
+2505 : 06 1b __ ASL ACCU + 0
+2507 : 2a __ __ ROL
+2508 : 10 fa __ BPL $2504
+250a : 29 7f __ AND #$7f
+250c : 85 1d __ STA ACCU + 2
+250e : a5 1b __ LDA ACCU + 0
+2510 : 85 1c __ STA ACCU + 1
+2512 : 8a __ __ TXA
+2513 : 4a __ __ LSR
+2514 : 85 1e __ STA ACCU + 3
+2516 : a9 00 __ LDA #$00
+2518 : 85 1b __ STA ACCU + 0
+251a : 6a __ __ ROR
+251b : 05 1d __ ORA ACCU + 2
+251d : 85 1d __ STA ACCU + 2
+251f : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2520 : a5 1e __ LDA ACCU + 3
+2522 : 45 06 __ EOR $06
+2524 : 29 80 __ AND #$80
+2526 : f0 1e __ BEQ $2546
+2528 : a5 1e __ LDA ACCU + 3
+252a : 29 7f __ AND #$7f
+252c : 05 1d __ ORA ACCU + 2
+252e : 05 1c __ ORA ACCU + 1
+2530 : 05 1b __ ORA ACCU + 0
+2532 : d0 0c __ BNE $2540
+2534 : a5 06 __ LDA $06
+2536 : 29 7f __ AND #$7f
+2538 : 05 05 __ ORA $05
+253a : 05 04 __ ORA $04
+253c : 05 03 __ ORA $03
+253e : f0 1e __ BEQ $255e
+2540 : a5 1e __ LDA ACCU + 3
+2542 : 30 23 __ BMI $2567
+2544 : 10 28 __ BPL $256e
+2546 : a5 1e __ LDA ACCU + 3
+2548 : c5 06 __ CMP $06
+254a : d0 15 __ BNE $2561
+254c : a5 1d __ LDA ACCU + 2
+254e : c5 05 __ CMP $05
+2550 : d0 0f __ BNE $2561
+2552 : a5 1c __ LDA ACCU + 1
+2554 : c5 04 __ CMP $04
+2556 : d0 09 __ BNE $2561
+2558 : a5 1b __ LDA ACCU + 0
+255a : c5 03 __ CMP $03
+255c : d0 03 __ BNE $2561
+255e : a9 00 __ LDA #$00
+2560 : 60 __ __ RTS
+2561 : b0 07 __ BCS $256a
+2563 : 24 1e __ BIT ACCU + 3
+2565 : 30 07 __ BMI $256e
+2567 : a9 01 __ LDA #$01
+2569 : 60 __ __ RTS
+256a : 24 1e __ BIT ACCU + 3
+256c : 30 f9 __ BMI $2567
+256e : a9 ff __ LDA #$ff
+2570 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+2571 : 84 02 __ STY $02
+2573 : a9 00 __ LDA #$00
+2575 : 85 07 __ STA $07
+2577 : 85 08 __ STA $08
+2579 : 85 09 __ STA $09
+257b : 85 0a __ STA $0a
+257d : a0 20 __ LDY #$20
+257f : 18 __ __ CLC
+2580 : 26 1b __ ROL ACCU + 0
+2582 : 26 1c __ ROL ACCU + 1
+2584 : 26 1d __ ROL ACCU + 2
+2586 : 26 1e __ ROL ACCU + 3
+2588 : 26 07 __ ROL $07
+258a : 26 08 __ ROL $08
+258c : 26 09 __ ROL $09
+258e : 26 0a __ ROL $0a
+2590 : a5 07 __ LDA $07
+2592 : c5 03 __ CMP $03
+2594 : a5 08 __ LDA $08
+2596 : e5 04 __ SBC $04
+2598 : a5 09 __ LDA $09
+259a : e5 05 __ SBC $05
+259c : a5 0a __ LDA $0a
+259e : e5 06 __ SBC $06
+25a0 : 90 18 __ BCC $25ba
+25a2 : a5 07 __ LDA $07
+25a4 : e5 03 __ SBC $03
+25a6 : 85 07 __ STA $07
+25a8 : a5 08 __ LDA $08
+25aa : e5 04 __ SBC $04
+25ac : 85 08 __ STA $08
+25ae : a5 09 __ LDA $09
+25b0 : e5 05 __ SBC $05
+25b2 : 85 09 __ STA $09
+25b4 : a5 0a __ LDA $0a
+25b6 : e5 06 __ SBC $06
+25b8 : 85 0a __ STA $0a
+25ba : 88 __ __ DEY
+25bb : d0 c3 __ BNE $2580
+25bd : 26 1b __ ROL ACCU + 0
+25bf : 26 1c __ ROL ACCU + 1
+25c1 : 26 1d __ ROL ACCU + 2
+25c3 : 26 1e __ ROL ACCU + 3
+25c5 : a4 02 __ LDY $02
+25c7 : 60 __ __ RTS
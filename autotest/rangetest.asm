@@ -0,0 +1,713 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 0f 0e STX $0e0f ; (spentry + 0)
+0811 : a9 10 __ LDA #$10
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0e __ LDA #$0e
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0f __ LDA #$0f
+081c : e9 0e __ SBC #$0e
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c4 __ LDA #$c4
+0832 : e9 10 __ SBC #$10
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 02 0e JMP $0e02 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 02 __ SBC #$02
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 00 __ LDY #$00
+090f : a5 25 __ LDA FP + 0
+0911 : 91 23 __ STA (SP + 0),y
+0913 : c8 __ __ INY
+0914 : a5 26 __ LDA FP + 1
+0916 : 91 23 __ STA (SP + 0),y
+0918 : 18 __ __ CLC
+0919 : a5 23 __ LDA SP + 0
+091b : 69 02 __ ADC #$02
+091d : 85 25 __ STA FP + 0
+091f : a5 24 __ LDA SP + 1
+0921 : 69 00 __ ADC #$00
+0923 : 85 26 __ STA FP + 1
+0925 : 38 __ __ SEC
+0926 : a5 23 __ LDA SP + 0
+0928 : e9 03 __ SBC #$03
+092a : 85 23 __ STA SP + 0
+092c : a5 24 __ LDA SP + 1
+092e : e9 00 __ SBC #$00
+0930 : 85 24 __ STA SP + 1
+0932 : 20 e6 0b JSR $0be6 ; (fillbuffer + 0)
+0935 : a9 00 __ LDA #$00
+0937 : 85 4f __ STA T0 + 0
+0939 : a4 4f __ LDY T0 + 0
+093b : b9 10 0e LDA $0e10,y ; (buffer + 0)
+093e : aa __ __ TAX
+093f : 98 __ __ TYA
+0940 : 29 1f __ AND #$1f
+0942 : 85 46 __ STA T3 + 0
+0944 : e4 46 __ CPX T3 + 0
+0946 : d0 03 __ BNE $094b
+0948 : 4c e1 0b JMP $0be1 ; (main + 737)
+094b : a9 00 __ LDA #$00
+094d : a0 02 __ LDY #$02
+094f : 91 23 __ STA (SP + 0),y
+0951 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0954 : e6 4f __ INC T0 + 0
+0956 : a5 4f __ LDA T0 + 0
+0958 : c9 c8 __ CMP #$c8
+095a : 90 dd __ BCC $0939
+095c : a9 00 __ LDA #$00
+095e : 85 43 __ STA T1 + 0
+0960 : 85 44 __ STA T1 + 1
+0962 : a5 43 __ LDA T1 + 0
+0964 : 0a __ __ ASL
+0965 : a8 __ __ TAY
+0966 : a5 43 __ LDA T1 + 0
+0968 : 0a __ __ ASL
+0969 : aa __ __ TAX
+096a : a5 44 __ LDA T1 + 1
+096c : 2a __ __ ROL
+096d : 85 08 __ STA $08
+096f : 18 __ __ CLC
+0970 : 8a __ __ TXA
+0971 : 65 43 __ ADC T1 + 0
+0973 : 85 1b __ STA ACCU + 0
+0975 : a5 08 __ LDA $08
+0977 : 65 44 __ ADC T1 + 1
+0979 : 85 1c __ STA ACCU + 1
+097b : a5 1b __ LDA ACCU + 0
+097d : 99 d8 0e STA $0ed8,y ; (table + 0)
+0980 : a5 1c __ LDA ACCU + 1
+0982 : 99 d9 0e STA $0ed9,y ; (table + 1)
+0985 : e6 43 __ INC T1 + 0
+0987 : d0 02 __ BNE $098b
+0989 : e6 44 __ INC T1 + 1
+098b : a5 43 __ LDA T1 + 0
+098d : c9 64 __ CMP #$64
+098f : 90 d1 __ BCC $0962
+0991 : 20 19 0c JSR $0c19 ; (sumtable + 0)
+0994 : a5 1c __ LDA ACCU + 1
+0996 : c9 3a __ CMP #$3a
+0998 : d0 09 __ BNE $09a3
+099a : a5 1b __ LDA ACCU + 0
+099c : c9 02 __ CMP #$02
+099e : d0 03 __ BNE $09a3
+09a0 : 4c dc 0b JMP $0bdc ; (main + 732)
+09a3 : a9 00 __ LDA #$00
+09a5 : a0 02 __ LDY #$02
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+09ac : 20 40 0c JSR $0c40 ; (histogram + 0)
+09af : a9 00 __ LDA #$00
+09b1 : 85 43 __ STA T1 + 0
+09b3 : 85 44 __ STA T1 + 1
+09b5 : 85 4f __ STA T0 + 0
+09b7 : a5 4f __ LDA T0 + 0
+09b9 : 0a __ __ ASL
+09ba : a8 __ __ TAY
+09bb : e6 4f __ INC T0 + 0
+09bd : 18 __ __ CLC
+09be : b9 a0 0f LDA $0fa0,y ; (hist + 0)
+09c1 : 65 43 __ ADC T1 + 0
+09c3 : 85 43 __ STA T1 + 0
+09c5 : b9 a1 0f LDA $0fa1,y ; (hist + 1)
+09c8 : 65 44 __ ADC T1 + 1
+09ca : 85 44 __ STA T1 + 1
+09cc : a5 4f __ LDA T0 + 0
+09ce : c9 10 __ CMP #$10
+09d0 : 90 e5 __ BCC $09b7
+09d2 : a5 44 __ LDA T1 + 1
+09d4 : d0 09 __ BNE $09df
+09d6 : a5 43 __ LDA T1 + 0
+09d8 : c9 c8 __ CMP #$c8
+09da : d0 03 __ BNE $09df
+09dc : 4c d7 0b JMP $0bd7 ; (main + 727)
+09df : a9 00 __ LDA #$00
+09e1 : a0 02 __ LDY #$02
+09e3 : 91 23 __ STA (SP + 0),y
+09e5 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+09e8 : a9 05 __ LDA #$05
+09ea : 85 0d __ STA P0
+09ec : a9 00 __ LDA #$00
+09ee : 85 0e __ STA P1
+09f0 : 20 81 0c JSR $0c81 ; (countdown + 0)
+09f3 : a5 1c __ LDA ACCU + 1
+09f5 : d0 09 __ BNE $0a00
+09f7 : a5 1b __ LDA ACCU + 0
+09f9 : c9 04 __ CMP #$04
+09fb : d0 03 __ BNE $0a00
+09fd : 4c d2 0b JMP $0bd2 ; (main + 722)
+0a00 : a9 00 __ LDA #$00
+0a02 : a0 02 __ LDY #$02
+0a04 : 91 23 __ STA (SP + 0),y
+0a06 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0a09 : a9 14 __ LDA #$14
+0a0b : 85 0d __ STA P0
+0a0d : a9 00 __ LDA #$00
+0a0f : 85 0e __ STA P1
+0a11 : 20 81 0c JSR $0c81 ; (countdown + 0)
+0a14 : a5 1c __ LDA ACCU + 1
+0a16 : d0 09 __ BNE $0a21
+0a18 : a5 1b __ LDA ACCU + 0
+0a1a : c9 0a __ CMP #$0a
+0a1c : d0 03 __ BNE $0a21
+0a1e : 4c cd 0b JMP $0bcd ; (main + 717)
+0a21 : a9 00 __ LDA #$00
+0a23 : a0 02 __ LDY #$02
+0a25 : 91 23 __ STA (SP + 0),y
+0a27 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0a2a : a9 fd __ LDA #$fd
+0a2c : 85 0d __ STA P0
+0a2e : a9 ff __ LDA #$ff
+0a30 : 85 0e __ STA P1
+0a32 : 20 81 0c JSR $0c81 ; (countdown + 0)
+0a35 : a5 1b __ LDA ACCU + 0
+0a37 : 05 1c __ ORA ACCU + 1
+0a39 : d0 03 __ BNE $0a3e
+0a3b : 4c c8 0b JMP $0bc8 ; (main + 712)
+0a3e : a9 00 __ LDA #$00
+0a40 : a0 02 __ LDY #$02
+0a42 : 91 23 __ STA (SP + 0),y
+0a44 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0a47 : a9 ff __ LDA #$ff
+0a49 : 85 0d __ STA P0
+0a4b : a9 01 __ LDA #$01
+0a4d : 85 0e __ STA P1
+0a4f : a9 ff __ LDA #$ff
+0a51 : 85 0f __ STA P2
+0a53 : a9 01 __ LDA #$01
+0a55 : 85 10 __ STA P3
+0a57 : 20 a8 0c JSR $0ca8 ; (masked + 0)
+0a5a : a5 1c __ LDA ACCU + 1
+0a5c : d0 09 __ BNE $0a67
+0a5e : a5 1b __ LDA ACCU + 0
+0a60 : c9 5a __ CMP #$5a
+0a62 : d0 03 __ BNE $0a67
+0a64 : 4c c3 0b JMP $0bc3 ; (main + 707)
+0a67 : a9 00 __ LDA #$00
+0a69 : a0 02 __ LDY #$02
+0a6b : 91 23 __ STA (SP + 0),y
+0a6d : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0a70 : a9 10 __ LDA #$10
+0a72 : 85 0d __ STA P0
+0a74 : a9 00 __ LDA #$00
+0a76 : 85 0e __ STA P1
+0a78 : a9 01 __ LDA #$01
+0a7a : 85 0f __ STA P2
+0a7c : a9 00 __ LDA #$00
+0a7e : 85 10 __ STA P3
+0a80 : 20 a8 0c JSR $0ca8 ; (masked + 0)
+0a83 : a5 1c __ LDA ACCU + 1
+0a85 : d0 09 __ BNE $0a90
+0a87 : a5 1b __ LDA ACCU + 0
+0a89 : c9 11 __ CMP #$11
+0a8b : d0 03 __ BNE $0a90
+0a8d : 4c be 0b JMP $0bbe ; (main + 702)
+0a90 : a9 00 __ LDA #$00
+0a92 : a0 02 __ LDY #$02
+0a94 : 91 23 __ STA (SP + 0),y
+0a96 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0a99 : a9 ff __ LDA #$ff
+0a9b : 85 0d __ STA P0
+0a9d : 85 0e __ STA P1
+0a9f : a9 00 __ LDA #$00
+0aa1 : 85 0f __ STA P2
+0aa3 : 85 10 __ STA P3
+0aa5 : 20 a8 0c JSR $0ca8 ; (masked + 0)
+0aa8 : a5 1c __ LDA ACCU + 1
+0aaa : d0 09 __ BNE $0ab5
+0aac : a5 1b __ LDA ACCU + 0
+0aae : c9 1b __ CMP #$1b
+0ab0 : d0 03 __ BNE $0ab5
+0ab2 : 4c b9 0b JMP $0bb9 ; (main + 697)
+0ab5 : a9 00 __ LDA #$00
+0ab7 : a0 02 __ LDY #$02
+0ab9 : 91 23 __ STA (SP + 0),y
+0abb : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0abe : 20 d2 0c JSR $0cd2 ; (longloop + 0)
+0ac1 : a5 1e __ LDA ACCU + 3
+0ac3 : d0 13 __ BNE $0ad8
+0ac5 : a5 1d __ LDA ACCU + 2
+0ac7 : d0 0f __ BNE $0ad8
+0ac9 : a5 1c __ LDA ACCU + 1
+0acb : c9 af __ CMP #$af
+0acd : d0 09 __ BNE $0ad8
+0acf : a5 1b __ LDA ACCU + 0
+0ad1 : c9 32 __ CMP #$32
+0ad3 : d0 03 __ BNE $0ad8
+0ad5 : 4c b4 0b JMP $0bb4 ; (main + 692)
+0ad8 : a9 00 __ LDA #$00
+0ada : a0 02 __ LDY #$02
+0adc : 91 23 __ STA (SP + 0),y
+0ade : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0ae1 : 20 17 0d JSR $0d17 ; (wrapping + 0)
+0ae4 : a5 1c __ LDA ACCU + 1
+0ae6 : c9 09 __ CMP #$09
+0ae8 : d0 09 __ BNE $0af3
+0aea : a5 1b __ LDA ACCU + 0
+0aec : c9 f1 __ CMP #$f1
+0aee : d0 03 __ BNE $0af3
+0af0 : 4c af 0b JMP $0baf ; (main + 687)
+0af3 : a9 00 __ LDA #$00
+0af5 : a0 02 __ LDY #$02
+0af7 : 91 23 __ STA (SP + 0),y
+0af9 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0afc : a9 0a __ LDA #$0a
+0afe : 8d c0 0f STA $0fc0 ; (ga + 0)
+0b01 : a9 00 __ LDA #$00
+0b03 : 8d c1 0f STA $0fc1 ; (ga + 1)
+0b06 : 38 __ __ SEC
+0b07 : a5 23 __ LDA SP + 0
+0b09 : e9 04 __ SBC #$04
+0b0b : 85 23 __ STA SP + 0
+0b0d : a5 24 __ LDA SP + 1
+0b0f : e9 00 __ SBC #$00
+0b11 : 85 24 __ STA SP + 1
+0b13 : a9 04 __ LDA #$04
+0b15 : a0 02 __ LDY #$02
+0b17 : 91 23 __ STA (SP + 0),y
+0b19 : a9 00 __ LDA #$00
+0b1b : c8 __ __ INY
+0b1c : 91 23 __ STA (SP + 0),y
+0b1e : 20 45 0d JSR $0d45 ; (alternate + 0)
+0b21 : 18 __ __ CLC
+0b22 : a5 23 __ LDA SP + 0
+0b24 : 69 04 __ ADC #$04
+0b26 : 85 23 __ STA SP + 0
+0b28 : 90 02 __ BCC $0b2c
+0b2a : e6 24 __ INC SP + 1
+0b2c : a5 1c __ LDA ACCU + 1
+0b2e : d0 06 __ BNE $0b36
+0b30 : a5 1b __ LDA ACCU + 0
+0b32 : c9 14 __ CMP #$14
+0b34 : f0 74 __ BEQ $0baa
+0b36 : a9 00 __ LDA #$00
+0b38 : a0 02 __ LDY #$02
+0b3a : 91 23 __ STA (SP + 0),y
+0b3c : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0b3f : ad c2 0f LDA $0fc2 ; (gb + 0)
+0b42 : 85 43 __ STA T1 + 0
+0b44 : ad c3 0f LDA $0fc3 ; (gb + 1)
+0b47 : d0 06 __ BNE $0b4f
+0b49 : a5 43 __ LDA T1 + 0
+0b4b : c9 05 __ CMP #$05
+0b4d : f0 56 __ BEQ $0ba5
+0b4f : a9 00 __ LDA #$00
+0b51 : a0 02 __ LDY #$02
+0b53 : 91 23 __ STA (SP + 0),y
+0b55 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0b58 : 20 f0 0d JSR $0df0 ; (bump + 0)
+0b5b : ad c2 0f LDA $0fc2 ; (gb + 0)
+0b5e : 85 43 __ STA T1 + 0
+0b60 : ad c3 0f LDA $0fc3 ; (gb + 1)
+0b63 : d0 06 __ BNE $0b6b
+0b65 : a5 43 __ LDA T1 + 0
+0b67 : c9 06 __ CMP #$06
+0b69 : f0 35 __ BEQ $0ba0
+0b6b : a9 00 __ LDA #$00
+0b6d : a0 02 __ LDY #$02
+0b6f : 91 23 __ STA (SP + 0),y
+0b71 : 20 f4 0b JSR $0bf4 ; (assert + 0)
+0b74 : a9 00 __ LDA #$00
+0b76 : 85 1b __ STA ACCU + 0
+0b78 : 85 1c __ STA ACCU + 1
+0b7a : 18 __ __ CLC
+0b7b : a5 23 __ LDA SP + 0
+0b7d : 69 03 __ ADC #$03
+0b7f : 85 23 __ STA SP + 0
+0b81 : a5 24 __ LDA SP + 1
+0b83 : 69 00 __ ADC #$00
+0b85 : 85 24 __ STA SP + 1
+0b87 : a0 00 __ LDY #$00
+0b89 : b1 23 __ LDA (SP + 0),y
+0b8b : 85 25 __ STA FP + 0
+0b8d : c8 __ __ INY
+0b8e : b1 23 __ LDA (SP + 0),y
+0b90 : 85 26 __ STA FP + 1
+0b92 : 18 __ __ CLC
+0b93 : a5 23 __ LDA SP + 0
+0b95 : 69 02 __ ADC #$02
+0b97 : 85 23 __ STA SP + 0
+0b99 : a5 24 __ LDA SP + 1
+0b9b : 69 00 __ ADC #$00
+0b9d : 85 24 __ STA SP + 1
+0b9f : 60 __ __ RTS
+0ba0 : a9 01 __ LDA #$01
+0ba2 : 4c 6d 0b JMP $0b6d ; (main + 621)
+0ba5 : a9 01 __ LDA #$01
+0ba7 : 4c 51 0b JMP $0b51 ; (main + 593)
+0baa : a9 01 __ LDA #$01
+0bac : 4c 38 0b JMP $0b38 ; (main + 568)
+0baf : a9 01 __ LDA #$01
+0bb1 : 4c f5 0a JMP $0af5 ; (main + 501)
+0bb4 : a9 01 __ LDA #$01
+0bb6 : 4c da 0a JMP $0ada ; (main + 474)
+0bb9 : a9 01 __ LDA #$01
+0bbb : 4c b7 0a JMP $0ab7 ; (main + 439)
+0bbe : a9 01 __ LDA #$01
+0bc0 : 4c 92 0a JMP $0a92 ; (main + 402)
+0bc3 : a9 01 __ LDA #$01
+0bc5 : 4c 69 0a JMP $0a69 ; (main + 361)
+0bc8 : a9 01 __ LDA #$01
+0bca : 4c 40 0a JMP $0a40 ; (main + 320)
+0bcd : a9 01 __ LDA #$01
+0bcf : 4c 23 0a JMP $0a23 ; (main + 291)
+0bd2 : a9 01 __ LDA #$01
+0bd4 : 4c 02 0a JMP $0a02 ; (main + 258)
+0bd7 : a9 01 __ LDA #$01
+0bd9 : 4c e1 09 JMP $09e1 ; (main + 225)
+0bdc : a9 01 __ LDA #$01
+0bde : 4c a5 09 JMP $09a5 ; (main + 165)
+0be1 : a9 01 __ LDA #$01
+0be3 : 4c 4d 09 JMP $094d ; (main + 77)
+--------------------------------------------------------------------
+fillbuffer:
+0be6 : a0 00 __ LDY #$00
+0be8 : 98 __ __ TYA
+0be9 : 29 1f __ AND #$1f
+0beb : 99 10 0e STA $0e10,y ; (buffer + 0)
+0bee : c8 __ __ INY
+0bef : c0 c8 __ CPY #$c8
+0bf1 : 90 f5 __ BCC $0be8
+0bf3 : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+0bf4 : a0 02 __ LDY #$02
+0bf6 : b1 23 __ LDA (SP + 0),y
+0bf8 : d0 09 __ BNE $0c03
+0bfa : a9 ff __ LDA #$ff
+0bfc : 85 0d __ STA P0
+0bfe : 85 0e __ STA P1
+0c00 : 20 04 0c JSR $0c04 ; (exit + 0)
+0c03 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+0c04 : a5 0d __ LDA P0
+0c06 : 85 1b __ STA ACCU + 0
+0c08 : a5 0e __ LDA P1
+0c0a : 85 1c __ STA ACCU + 1
+0c0c : ae 0f 0e LDX $0e0f ; (spentry + 0)
+0c0f : 9a __ __ TXS
+0c10 : a9 4c __ LDA #$4c
+0c12 : 85 54 __ STA $54
+0c14 : a9 00 __ LDA #$00
+0c16 : 85 13 __ STA P6
+0c18 : 60 __ __ RTS
+--------------------------------------------------------------------
+sumtable:
+0c19 : a9 00 __ LDA #$00
+0c1b : 85 43 __ STA T0 + 0
+0c1d : 85 44 __ STA T0 + 1
+0c1f : aa __ __ TAX
+0c20 : 8a __ __ TXA
+0c21 : 0a __ __ ASL
+0c22 : a8 __ __ TAY
+0c23 : e8 __ __ INX
+0c24 : 18 __ __ CLC
+0c25 : b9 d8 0e LDA $0ed8,y ; (table + 0)
+0c28 : 65 43 __ ADC T0 + 0
+0c2a : 85 43 __ STA T0 + 0
+0c2c : b9 d9 0e LDA $0ed9,y ; (table + 1)
+0c2f : 65 44 __ ADC T0 + 1
+0c31 : 85 44 __ STA T0 + 1
+0c33 : e0 64 __ CPX #$64
+0c35 : 90 e9 __ BCC $0c20
+0c37 : a5 43 __ LDA T0 + 0
+0c39 : 85 1b __ STA ACCU + 0
+0c3b : a5 44 __ LDA T0 + 1
+0c3d : 85 1c __ STA ACCU + 1
+0c3f : 60 __ __ RTS
+--------------------------------------------------------------------
+histogram:
+0c40 : a2 00 __ LDX #$00
+0c42 : 8a __ __ TXA
+0c43 : 0a __ __ ASL
+0c44 : a8 __ __ TAY
+0c45 : a9 00 __ LDA #$00
+0c47 : 99 a0 0f STA $0fa0,y ; (hist + 0)
+0c4a : 99 a1 0f STA $0fa1,y ; (hist + 1)
+0c4d : e8 __ __ INX
+0c4e : e0 10 __ CPX #$10
+0c50 : 90 f0 __ BCC $0c42
+0c52 : 85 44 __ STA T1 + 0
+0c54 : 85 45 __ STA T1 + 1
+0c56 : 18 __ __ CLC
+0c57 : a4 44 __ LDY T1 + 0
+0c59 : b9 10 0e LDA $0e10,y ; (buffer + 0)
+0c5c : 65 44 __ ADC T1 + 0
+0c5e : 29 0f __ AND #$0f
+0c60 : 0a __ __ ASL
+0c61 : aa __ __ TAX
+0c62 : a8 __ __ TAY
+0c63 : 18 __ __ CLC
+0c64 : bd a0 0f LDA $0fa0,x ; (hist + 0)
+0c67 : 69 01 __ ADC #$01
+0c69 : 99 a0 0f STA $0fa0,y ; (hist + 0)
+0c6c : bd a1 0f LDA $0fa1,x ; (hist + 1)
+0c6f : 69 00 __ ADC #$00
+0c71 : 99 a1 0f STA $0fa1,y ; (hist + 1)
+0c74 : e6 44 __ INC T1 + 0
+0c76 : d0 02 __ BNE $0c7a
+0c78 : e6 45 __ INC T1 + 1
+0c7a : a5 44 __ LDA T1 + 0
+0c7c : c9 c8 __ CMP #$c8
+0c7e : 90 d6 __ BCC $0c56
+0c80 : 60 __ __ RTS
+--------------------------------------------------------------------
+countdown:
+0c81 : a9 00 __ LDA #$00
+0c83 : a8 __ __ TAY
+0c84 : 85 44 __ STA T0 + 1
+0c86 : a2 0a __ LDX #$0a
+0c88 : a5 0e __ LDA P1
+0c8a : 49 80 __ EOR #$80
+0c8c : 85 03 __ STA $03
+0c8e : a9 80 __ LDA #$80
+0c90 : c5 03 __ CMP $03
+0c92 : d0 02 __ BNE $0c96
+0c94 : e4 0d __ CPX P0
+0c96 : b0 05 __ BCS $0c9d
+0c98 : c8 __ __ INY
+0c99 : d0 02 __ BNE $0c9d
+0c9b : e6 44 __ INC T0 + 1
+0c9d : ca __ __ DEX
+0c9e : 8a __ __ TXA
+0c9f : d0 e7 __ BNE $0c88
+0ca1 : 84 1b __ STY ACCU + 0
+0ca3 : a5 44 __ LDA T0 + 1
+0ca5 : 85 1c __ STA ACCU + 1
+0ca7 : 60 __ __ RTS
+--------------------------------------------------------------------
+masked:
+0ca8 : a5 0d __ LDA P0
+0caa : 29 7f __ AND #$7f
+0cac : 85 43 __ STA T0 + 0
+0cae : a5 0f __ LDA P2
+0cb0 : 29 3f __ AND #$3f
+0cb2 : 85 45 __ STA T1 + 0
+0cb4 : 18 __ __ CLC
+0cb5 : 65 43 __ ADC T0 + 0
+0cb7 : 85 47 __ STA T2 + 0
+0cb9 : a9 64 __ LDA #$64
+0cbb : c5 47 __ CMP T2 + 0
+0cbd : 90 0b __ BCC $0cca
+0cbf : a5 43 __ LDA T0 + 0
+0cc1 : 45 45 __ EOR T1 + 0
+0cc3 : 85 1b __ STA ACCU + 0
+0cc5 : a9 00 __ LDA #$00
+0cc7 : 85 1c __ STA ACCU + 1
+0cc9 : 60 __ __ RTS
+0cca : 38 __ __ SEC
+0ccb : a5 47 __ LDA T2 + 0
+0ccd : e9 64 __ SBC #$64
+0ccf : 4c c3 0c JMP $0cc3 ; (masked + 27)
+--------------------------------------------------------------------
+longloop:
+0cd2 : a9 00 __ LDA #$00
+0cd4 : 85 43 __ STA T0 + 0
+0cd6 : 85 44 __ STA T0 + 1
+0cd8 : 85 45 __ STA T0 + 2
+0cda : 85 46 __ STA T0 + 3
+0cdc : aa __ __ TAX
+0cdd : a8 __ __ TAY
+0cde : 86 49 __ STX T2 + 0
+0ce0 : 98 __ __ TYA
+0ce1 : 84 4a __ STY T2 + 1
+0ce3 : e8 __ __ INX
+0ce4 : d0 01 __ BNE $0ce7
+0ce6 : c8 __ __ INY
+0ce7 : 18 __ __ CLC
+0ce8 : a5 43 __ LDA T0 + 0
+0cea : 65 49 __ ADC T2 + 0
+0cec : 85 43 __ STA T0 + 0
+0cee : a5 44 __ LDA T0 + 1
+0cf0 : 65 4a __ ADC T2 + 1
+0cf2 : 85 44 __ STA T0 + 1
+0cf4 : a5 45 __ LDA T0 + 2
+0cf6 : 69 00 __ ADC #$00
+0cf8 : 85 45 __ STA T0 + 2
+0cfa : 90 02 __ BCC $0cfe
+0cfc : e6 46 __ INC T0 + 3
+0cfe : c0 01 __ CPY #$01
+0d00 : d0 02 __ BNE $0d04
+0d02 : e0 2c __ CPX #$2c
+0d04 : 90 d8 __ BCC $0cde
+0d06 : a5 43 __ LDA T0 + 0
+0d08 : 85 1b __ STA ACCU + 0
+0d0a : a5 44 __ LDA T0 + 1
+0d0c : 85 1c __ STA ACCU + 1
+0d0e : a5 45 __ LDA T0 + 2
+0d10 : 85 1d __ STA ACCU + 2
+0d12 : a5 46 __ LDA T0 + 3
+0d14 : 85 1e __ STA ACCU + 3
+0d16 : 60 __ __ RTS
+--------------------------------------------------------------------
+wrapping:
+0d17 : a9 00 __ LDA #$00
+0d19 : aa __ __ TAX
+0d1a : a8 __ __ TAY
+0d1b : a9 fa __ LDA #$fa
+0d1d : 85 45 __ STA T1 + 0
+0d1f : a9 00 __ LDA #$00
+0d21 : 85 46 __ STA T1 + 1
+0d23 : 18 __ __ CLC
+0d24 : 8a __ __ TXA
+0d25 : 65 45 __ ADC T1 + 0
+0d27 : aa __ __ TAX
+0d28 : 98 __ __ TYA
+0d29 : 65 46 __ ADC T1 + 1
+0d2b : a8 __ __ TAY
+0d2c : e6 45 __ INC T1 + 0
+0d2e : d0 02 __ BNE $0d32
+0d30 : e6 46 __ INC T1 + 1
+0d32 : a5 46 __ LDA T1 + 1
+0d34 : 49 80 __ EOR #$80
+0d36 : c9 81 __ CMP #$81
+0d38 : d0 04 __ BNE $0d3e
+0d3a : a5 45 __ LDA T1 + 0
+0d3c : c9 04 __ CMP #$04
+0d3e : 90 e3 __ BCC $0d23
+0d40 : 86 1b __ STX ACCU + 0
+0d42 : 84 1c __ STY ACCU + 1
+0d44 : 60 __ __ RTS
+--------------------------------------------------------------------
+alternate:
+0d45 : a9 00 __ LDA #$00
+0d47 : 85 45 __ STA T0 + 0
+0d49 : 85 46 __ STA T0 + 1
+0d4b : a0 02 __ LDY #$02
+0d4d : b1 23 __ LDA (SP + 0),y
+0d4f : 85 47 __ STA T1 + 0
+0d51 : c8 __ __ INY
+0d52 : b1 23 __ LDA (SP + 0),y
+0d54 : 30 04 __ BMI $0d5a
+0d56 : 05 47 __ ORA T1 + 0
+0d58 : d0 2f __ BNE $0d89
+0d5a : a0 00 __ LDY #$00
+0d5c : 98 __ __ TYA
+0d5d : 29 02 __ AND #$02
+0d5f : d0 1f __ BNE $0d80
+0d61 : 18 __ __ CLC
+0d62 : ad c2 0f LDA $0fc2 ; (gb + 0)
+0d65 : 69 01 __ ADC #$01
+0d67 : 8d c2 0f STA $0fc2 ; (gb + 0)
+0d6a : ad c3 0f LDA $0fc3 ; (gb + 1)
+0d6d : 69 00 __ ADC #$00
+0d6f : 8d c3 0f STA $0fc3 ; (gb + 1)
+0d72 : c8 __ __ INY
+0d73 : c0 05 __ CPY #$05
+0d75 : 90 e5 __ BCC $0d5c
+0d77 : a5 45 __ LDA T0 + 0
+0d79 : 85 1b __ STA ACCU + 0
+0d7b : a5 46 __ LDA T0 + 1
+0d7d : 85 1c __ STA ACCU + 1
+0d7f : 60 __ __ RTS
+0d80 : b9 11 0e LDA $0e11,y ; (buffer + 1)
+0d83 : 99 10 0e STA $0e10,y ; (buffer + 0)
+0d86 : 4c 72 0d JMP $0d72 ; (alternate + 45)
+0d89 : a9 00 __ LDA #$00
+0d8b : 85 47 __ STA T1 + 0
+0d8d : 85 48 __ STA T1 + 1
+0d8f : a0 02 __ LDY #$02
+0d91 : b1 23 __ LDA (SP + 0),y
+0d93 : 85 49 __ STA T3 + 0
+0d95 : 85 4b __ STA T4 + 0
+0d97 : c8 __ __ INY
+0d98 : b1 23 __ LDA (SP + 0),y
+0d9a : 85 4a __ STA T3 + 1
+0d9c : 85 4c __ STA T4 + 1
+0d9e : a5 47 __ LDA T1 + 0
+0da0 : 29 01 __ AND #$01
+0da2 : d0 20 __ BNE $0dc4
+0da4 : 20 f0 0d JSR $0df0 ; (bump + 0)
+0da7 : e6 47 __ INC T1 + 0
+0da9 : d0 02 __ BNE $0dad
+0dab : e6 48 __ INC T1 + 1
+0dad : a5 4a __ LDA T3 + 1
+0daf : 49 80 __ EOR #$80
+0db1 : 85 03 __ STA $03
+0db3 : a5 48 __ LDA T1 + 1
+0db5 : 49 80 __ EOR #$80
+0db7 : c5 03 __ CMP $03
+0db9 : d0 04 __ BNE $0dbf
+0dbb : a5 47 __ LDA T1 + 0
+0dbd : c5 49 __ CMP T3 + 0
+0dbf : 90 dd __ BCC $0d9e
+0dc1 : 4c 5a 0d JMP $0d5a ; (alternate + 21)
+0dc4 : 18 __ __ CLC
+0dc5 : ad c0 0f LDA $0fc0 ; (ga + 0)
+0dc8 : 65 45 __ ADC T0 + 0
+0dca : 85 45 __ STA T0 + 0
+0dcc : ad c1 0f LDA $0fc1 ; (ga + 1)
+0dcf : 65 46 __ ADC T0 + 1
+0dd1 : 85 46 __ STA T0 + 1
+0dd3 : e6 47 __ INC T1 + 0
+0dd5 : d0 02 __ BNE $0dd9
+0dd7 : e6 48 __ INC T1 + 1
+0dd9 : a5 4c __ LDA T4 + 1
+0ddb : 49 80 __ EOR #$80
+0ddd : 85 03 __ STA $03
+0ddf : a5 48 __ LDA T1 + 1
+0de1 : 49 80 __ EOR #$80
+0de3 : c5 03 __ CMP $03
+0de5 : d0 04 __ BNE $0deb
+0de7 : a5 47 __ LDA T1 + 0
+0de9 : c5 4b __ CMP T4 + 0
+0deb : 90 b1 __ BCC $0d9e
+0ded : 4c 5a 0d JMP $0d5a ; (alternate + 21)
+--------------------------------------------------------------------
+bump:
+0df0 : 18 __ __ CLC
+0df1 : ad c2 0f LDA $0fc2 ; (gb + 0)
+0df4 : 69 01 __ ADC #$01
+0df6 : 8d c2 0f STA $0fc2 ; (gb + 0)
+0df9 : ad c3 0f LDA $0fc3 ; (gb + 1)
+0dfc : 69 00 __ ADC #$00
+0dfe : 8d c3 0f STA $0fc3 ; (gb + 1)
+0e01 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0e02 : a9 4c __ LDA #$4c
+0e04 : 85 54 __ STA $54
+0e06 : a9 00 __ LDA #$00
+0e08 : 85 13 __ STA P6
+0e0a : a9 19 __ LDA #$19
+0e0c : 85 16 __ STA P9
+0e0e : 60 __ __ RTS
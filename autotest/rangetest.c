@@ -0,0 +1,133 @@
+#include <assert.h>
+
+char			buffer[200];
+int				table[100];
+unsigned		hist[16];
+long			lsum;
+int				ga, gb;
+
+void fillbuffer(void)
+{
+	for (int i = 0; i < 200; i++)
+		buffer[i] = i & 31;
+}
+
+int sumtable(void)
+{
+	int	s = 0;
+	for (int i = 0; i < 100; i++)
+		s += table[i];
+	return s;
+}
+
+void histogram(void)
+{
+	for (int i = 0; i < 16; i++)
+		hist[i] = 0;
+
+	for (int i = 0; i < 200; i++)
+	{
+		int	k = (buffer[i] + i) & 15;
+		hist[k]++;
+	}
+}
+
+int countdown(int n)
+{
+	int	c = 0;
+	for (int i = 10; i > 0; i--)
+	{
+		if (i < n)
+			c++;
+	}
+	return c;
+}
+
+int masked(int a, int b)
+{
+	int	x = a & 0x7f, y = b & 0x3f;
+	int	z = x + y;
+	if (z > 100)
+		return z - 100;
+	else
+		return x ^ y;
+}
+
+long longloop(void)
+{
+	long	s = 0;
+	for (long i = 0; i < 300; i++)
+		s += i;
+	return s;
+}
+
+int wrapping(void)
+{
+	int	s = 0;
+	for (int i = 250; i < 260; i++)
+		s += i;
+	return s;
+}
+
+void bump(void)
+{
+	gb++;
+}
+
+int alternate(int n)
+{
+	int	s = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (i & 1)
+			s += ga;
+		else
+			bump();
+	}
+
+	for (int i = 0; i < 5; i++)
+	{
+		if (i & 2)
+			buffer[i] = buffer[i + 1];
+		else
+			gb++;
+	}
+
+	return s;
+}
+
+int main(void)
+{
+	fillbuffer();
+	for (int i = 0; i < 200; i++)
+		assert(buffer[i] == (i & 31));
+
+	for (int i = 0; i < 100; i++)
+		table[i] = 3 * i;
+	assert(sumtable() == 3 * 4950);
+
+	histogram();
+	unsigned	t = 0;
+	for (int i = 0; i < 16; i++)
+		t += hist[i];
+	assert(t == 200);
+
+	assert(countdown(5) == 4);
+	assert(countdown(20) == 10);
+	assert(countdown(-3) == 0);
+
+	assert(masked(0x1ff, 0x1ff) == 127 + 63 - 100);
+	assert(masked(0x10, 0x01) == 0x11);
+	assert(masked(-1, 0) == 27);
+
+	assert(longloop() == 44850);
+	assert(wrapping() == 2545);
+
+	ga = 10;
+	assert(alternate(4) == 20);
+	assert(gb == 5);
+	bump();
+	assert(gb == 6);
+
+	return 0;
+}
@@ -0,0 +1,758 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 4a 0e STX $0e4a ; (spentry + 0)
+0811 : a9 4c __ LDA #$4c
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0e __ LDA #$0e
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0e __ LDA #$0e
+081c : e9 0e __ SBC #$0e
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 4e __ LDA #$4e
+0832 : e9 4c __ SBC #$4c
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 3d 0e JMP $0e3d ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 02 __ SBC #$02
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 00 __ LDY #$00
+090f : a5 25 __ LDA FP + 0
+0911 : 91 23 __ STA (SP + 0),y
+0913 : c8 __ __ INY
+0914 : a5 26 __ LDA FP + 1
+0916 : 91 23 __ STA (SP + 0),y
+0918 : 18 __ __ CLC
+0919 : a5 23 __ LDA SP + 0
+091b : 69 02 __ ADC #$02
+091d : 85 25 __ STA FP + 0
+091f : a5 24 __ LDA SP + 1
+0921 : 69 00 __ ADC #$00
+0923 : 85 26 __ STA FP + 1
+0925 : 38 __ __ SEC
+0926 : a5 23 __ LDA SP + 0
+0928 : e9 03 __ SBC #$03
+092a : 85 23 __ STA SP + 0
+092c : a5 24 __ LDA SP + 1
+092e : e9 00 __ SBC #$00
+0930 : 85 24 __ STA SP + 1
+0932 : 38 __ __ SEC
+0933 : a5 23 __ LDA SP + 0
+0935 : e9 04 __ SBC #$04
+0937 : 85 23 __ STA SP + 0
+0939 : a5 24 __ LDA SP + 1
+093b : e9 00 __ SBC #$00
+093d : 85 24 __ STA SP + 1
+093f : a9 17 __ LDA #$17
+0941 : a0 02 __ LDY #$02
+0943 : 91 23 __ STA (SP + 0),y
+0945 : a9 00 __ LDA #$00
+0947 : c8 __ __ INY
+0948 : 91 23 __ STA (SP + 0),y
+094a : 20 c6 09 JSR $09c6 ; (fib + 0)
+094d : 18 __ __ CLC
+094e : a5 23 __ LDA SP + 0
+0950 : 69 04 __ ADC #$04
+0952 : 85 23 __ STA SP + 0
+0954 : 90 02 __ BCC $0958
+0956 : e6 24 __ INC SP + 1
+0958 : a5 1c __ LDA ACCU + 1
+095a : c9 6f __ CMP #$6f
+095c : d0 06 __ BNE $0964
+095e : a5 1b __ LDA ACCU + 0
+0960 : c9 f1 __ CMP #$f1
+0962 : f0 38 __ BEQ $099c
+0964 : a9 00 __ LDA #$00
+0966 : a0 02 __ LDY #$02
+0968 : 91 23 __ STA (SP + 0),y
+096a : 20 a1 09 JSR $09a1 ; (assert + 0)
+096d : 20 71 0a JSR $0a71 ; (btest + 0)
+0970 : a9 00 __ LDA #$00
+0972 : 85 1b __ STA ACCU + 0
+0974 : 85 1c __ STA ACCU + 1
+0976 : 18 __ __ CLC
+0977 : a5 23 __ LDA SP + 0
+0979 : 69 03 __ ADC #$03
+097b : 85 23 __ STA SP + 0
+097d : a5 24 __ LDA SP + 1
+097f : 69 00 __ ADC #$00
+0981 : 85 24 __ STA SP + 1
+0983 : a0 00 __ LDY #$00
+0985 : b1 23 __ LDA (SP + 0),y
+0987 : 85 25 __ STA FP + 0
+0989 : c8 __ __ INY
+098a : b1 23 __ LDA (SP + 0),y
+098c : 85 26 __ STA FP + 1
+098e : 18 __ __ CLC
+098f : a5 23 __ LDA SP + 0
+0991 : 69 02 __ ADC #$02
+0993 : 85 23 __ STA SP + 0
+0995 : a5 24 __ LDA SP + 1
+0997 : 69 00 __ ADC #$00
+0999 : 85 24 __ STA SP + 1
+099b : 60 __ __ RTS
+099c : a9 01 __ LDA #$01
+099e : 4c 66 09 JMP $0966 ; (main + 102)
+--------------------------------------------------------------------
+assert:
+09a1 : a0 02 __ LDY #$02
+09a3 : b1 23 __ LDA (SP + 0),y
+09a5 : d0 09 __ BNE $09b0
+09a7 : a9 ff __ LDA #$ff
+09a9 : 85 0d __ STA P0
+09ab : 85 0e __ STA P1
+09ad : 20 b1 09 JSR $09b1 ; (exit + 0)
+09b0 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+09b1 : a5 0d __ LDA P0
+09b3 : 85 1b __ STA ACCU + 0
+09b5 : a5 0e __ LDA P1
+09b7 : 85 1c __ STA ACCU + 1
+09b9 : ae 4a 0e LDX $0e4a ; (spentry + 0)
+09bc : 9a __ __ TXS
+09bd : a9 4c __ LDA #$4c
+09bf : 85 54 __ STA $54
+09c1 : a9 00 __ LDA #$00
+09c3 : 85 13 __ STA P6
+09c5 : 60 __ __ RTS
+--------------------------------------------------------------------
+fib:
+09c6 : 38 __ __ SEC
+09c7 : a5 23 __ LDA SP + 0
+09c9 : e9 02 __ SBC #$02
+09cb : 85 23 __ STA SP + 0
+09cd : a5 24 __ LDA SP + 1
+09cf : e9 00 __ SBC #$00
+09d1 : 85 24 __ STA SP + 1
+09d3 : a0 01 __ LDY #$01
+09d5 : b9 53 00 LDA $0053,y 
+09d8 : 91 23 __ STA (SP + 0),y
+09da : 88 __ __ DEY
+09db : 10 f8 __ BPL $09d5
+09dd : 38 __ __ SEC
+09de : a5 23 __ LDA SP + 0
+09e0 : e9 04 __ SBC #$04
+09e2 : 85 23 __ STA SP + 0
+09e4 : a5 24 __ LDA SP + 1
+09e6 : e9 00 __ SBC #$00
+09e8 : 85 24 __ STA SP + 1
+09ea : a0 08 __ LDY #$08
+09ec : b1 23 __ LDA (SP + 0),y
+09ee : 85 53 __ STA T0 + 0
+09f0 : c8 __ __ INY
+09f1 : b1 23 __ LDA (SP + 0),y
+09f3 : 85 54 __ STA T0 + 1
+09f5 : 10 2d __ BPL $0a24
+09f7 : a5 53 __ LDA T0 + 0
+09f9 : 85 1b __ STA ACCU + 0
+09fb : a5 54 __ LDA T0 + 1
+09fd : 85 1c __ STA ACCU + 1
+09ff : 18 __ __ CLC
+0a00 : a5 23 __ LDA SP + 0
+0a02 : 69 04 __ ADC #$04
+0a04 : 85 23 __ STA SP + 0
+0a06 : a5 24 __ LDA SP + 1
+0a08 : 69 00 __ ADC #$00
+0a0a : 85 24 __ STA SP + 1
+0a0c : a0 01 __ LDY #$01
+0a0e : b1 23 __ LDA (SP + 0),y
+0a10 : 99 53 00 STA $0053,y 
+0a13 : 88 __ __ DEY
+0a14 : 10 f8 __ BPL $0a0e
+0a16 : 18 __ __ CLC
+0a17 : a5 23 __ LDA SP + 0
+0a19 : 69 02 __ ADC #$02
+0a1b : 85 23 __ STA SP + 0
+0a1d : a5 24 __ LDA SP + 1
+0a1f : 69 00 __ ADC #$00
+0a21 : 85 24 __ STA SP + 1
+0a23 : 60 __ __ RTS
+0a24 : d0 06 __ BNE $0a2c
+0a26 : a5 53 __ LDA T0 + 0
+0a28 : c9 02 __ CMP #$02
+0a2a : 90 cb __ BCC $09f7
+0a2c : 38 __ __ SEC
+0a2d : a5 53 __ LDA T0 + 0
+0a2f : e9 01 __ SBC #$01
+0a31 : a0 02 __ LDY #$02
+0a33 : 91 23 __ STA (SP + 0),y
+0a35 : a5 54 __ LDA T0 + 1
+0a37 : e9 00 __ SBC #$00
+0a39 : c8 __ __ INY
+0a3a : 91 23 __ STA (SP + 0),y
+0a3c : 20 c6 09 JSR $09c6 ; (fib + 0)
+0a3f : a5 1b __ LDA ACCU + 0
+0a41 : 85 53 __ STA T0 + 0
+0a43 : a5 1c __ LDA ACCU + 1
+0a45 : 85 54 __ STA T0 + 1
+0a47 : a0 08 __ LDY #$08
+0a49 : b1 23 __ LDA (SP + 0),y
+0a4b : 38 __ __ SEC
+0a4c : e9 02 __ SBC #$02
+0a4e : aa __ __ TAX
+0a4f : c8 __ __ INY
+0a50 : b1 23 __ LDA (SP + 0),y
+0a52 : e9 00 __ SBC #$00
+0a54 : 85 45 __ STA T2 + 1
+0a56 : 8a __ __ TXA
+0a57 : a0 02 __ LDY #$02
+0a59 : 91 23 __ STA (SP + 0),y
+0a5b : a5 45 __ LDA T2 + 1
+0a5d : c8 __ __ INY
+0a5e : 91 23 __ STA (SP + 0),y
+0a60 : 20 c6 09 JSR $09c6 ; (fib + 0)
+0a63 : 18 __ __ CLC
+0a64 : a5 1b __ LDA ACCU + 0
+0a66 : 65 53 __ ADC T0 + 0
+0a68 : 85 1b __ STA ACCU + 0
+0a6a : a5 1c __ LDA ACCU + 1
+0a6c : 65 54 __ ADC T0 + 1
+0a6e : 4c fd 09 JMP $09fd ; (fib + 55)
+--------------------------------------------------------------------
+btest:
+0a71 : 38 __ __ SEC
+0a72 : a5 23 __ LDA SP + 0
+0a74 : e9 1a __ SBC #$1a
+0a76 : 85 23 __ STA SP + 0
+0a78 : a5 24 __ LDA SP + 1
+0a7a : e9 00 __ SBC #$00
+0a7c : 85 24 __ STA SP + 1
+0a7e : a0 03 __ LDY #$03
+0a80 : b9 53 00 LDA $0053,y 
+0a83 : 91 23 __ STA (SP + 0),y
+0a85 : 88 __ __ DEY
+0a86 : 10 f8 __ BPL $0a80
+0a88 : 38 __ __ SEC
+0a89 : a5 23 __ LDA SP + 0
+0a8b : e9 06 __ SBC #$06
+0a8d : 85 23 __ STA SP + 0
+0a8f : a5 24 __ LDA SP + 1
+0a91 : e9 00 __ SBC #$00
+0a93 : 85 24 __ STA SP + 1
+0a95 : a9 00 __ LDA #$00
+0a97 : 85 53 __ STA T0 + 0
+0a99 : 85 54 __ STA T0 + 1
+0a9b : ad 60 0b LDA $0b60 
+0a9e : d0 73 __ BNE $0b13
+0aa0 : a5 53 __ LDA T0 + 0
+0aa2 : a0 02 __ LDY #$02
+0aa4 : 91 23 __ STA (SP + 0),y
+0aa6 : a5 54 __ LDA T0 + 1
+0aa8 : c8 __ __ INY
+0aa9 : 91 23 __ STA (SP + 0),y
+0aab : 18 __ __ CLC
+0aac : a5 23 __ LDA SP + 0
+0aae : 69 0c __ ADC #$0c
+0ab0 : 85 53 __ STA T0 + 0
+0ab2 : c8 __ __ INY
+0ab3 : 91 23 __ STA (SP + 0),y
+0ab5 : a5 24 __ LDA SP + 1
+0ab7 : 69 00 __ ADC #$00
+0ab9 : 85 54 __ STA T0 + 1
+0abb : c8 __ __ INY
+0abc : 91 23 __ STA (SP + 0),y
+0abe : 20 7a 0d JSR $0d7a ; (collect + 0)
+0ac1 : a9 00 __ LDA #$00
+0ac3 : a0 00 __ LDY #$00
+0ac5 : 91 1b __ STA (ACCU + 0),y
+0ac7 : a5 53 __ LDA T0 + 0
+0ac9 : 85 0d __ STA P0
+0acb : a5 54 __ LDA T0 + 1
+0acd : 85 0e __ STA P1
+0acf : a9 31 __ LDA #$31
+0ad1 : 85 0f __ STA P2
+0ad3 : a9 0e __ LDA #$0e
+0ad5 : 85 10 __ STA P3
+0ad7 : 20 02 0e JSR $0e02 ; (strcmp + 0)
+0ada : a5 1b __ LDA ACCU + 0
+0adc : 05 1c __ ORA ACCU + 1
+0ade : f0 2e __ BEQ $0b0e
+0ae0 : a9 00 __ LDA #$00
+0ae2 : a0 02 __ LDY #$02
+0ae4 : 91 23 __ STA (SP + 0),y
+0ae6 : 20 a1 09 JSR $09a1 ; (assert + 0)
+0ae9 : 18 __ __ CLC
+0aea : a5 23 __ LDA SP + 0
+0aec : 69 06 __ ADC #$06
+0aee : 85 23 __ STA SP + 0
+0af0 : a5 24 __ LDA SP + 1
+0af2 : 69 00 __ ADC #$00
+0af4 : 85 24 __ STA SP + 1
+0af6 : a0 03 __ LDY #$03
+0af8 : b1 23 __ LDA (SP + 0),y
+0afa : 99 53 00 STA $0053,y 
+0afd : 88 __ __ DEY
+0afe : 10 f8 __ BPL $0af8
+0b00 : 18 __ __ CLC
+0b01 : a5 23 __ LDA SP + 0
+0b03 : 69 1a __ ADC #$1a
+0b05 : 85 23 __ STA SP + 0
+0b07 : a5 24 __ LDA SP + 1
+0b09 : 69 00 __ ADC #$00
+0b0b : 85 24 __ STA SP + 1
+0b0d : 60 __ __ RTS
+0b0e : a9 01 __ LDA #$01
+0b10 : 4c e2 0a JMP $0ae2 ; (btest + 113)
+0b13 : a9 00 __ LDA #$00
+0b15 : 85 55 __ STA T3 + 0
+0b17 : 85 56 __ STA T3 + 1
+0b19 : a5 53 __ LDA T0 + 0
+0b1b : a0 02 __ LDY #$02
+0b1d : 91 23 __ STA (SP + 0),y
+0b1f : a5 54 __ LDA T0 + 1
+0b21 : c8 __ __ INY
+0b22 : 91 23 __ STA (SP + 0),y
+0b24 : 18 __ __ CLC
+0b25 : a9 60 __ LDA #$60
+0b27 : 65 55 __ ADC T3 + 0
+0b29 : 85 53 __ STA T0 + 0
+0b2b : a9 0b __ LDA #$0b
+0b2d : 65 56 __ ADC T3 + 1
+0b2f : 85 54 __ STA T0 + 1
+0b31 : a0 00 __ LDY #$00
+0b33 : b1 53 __ LDA (T0 + 0),y
+0b35 : a0 04 __ LDY #$04
+0b37 : 91 23 __ STA (SP + 0),y
+0b39 : 20 6c 0b JSR $0b6c ; (insert + 0)
+0b3c : a5 1b __ LDA ACCU + 0
+0b3e : 85 53 __ STA T0 + 0
+0b40 : a5 1c __ LDA ACCU + 1
+0b42 : 85 54 __ STA T0 + 1
+0b44 : 18 __ __ CLC
+0b45 : a9 60 __ LDA #$60
+0b47 : 65 55 __ ADC T3 + 0
+0b49 : 85 44 __ STA T4 + 0
+0b4b : a9 0b __ LDA #$0b
+0b4d : 65 56 __ ADC T3 + 1
+0b4f : 85 45 __ STA T4 + 1
+0b51 : e6 55 __ INC T3 + 0
+0b53 : d0 02 __ BNE $0b57
+0b55 : e6 56 __ INC T3 + 1
+0b57 : a0 01 __ LDY #$01
+0b59 : b1 44 __ LDA (T4 + 0),y
+0b5b : d0 bc __ BNE $0b19
+0b5d : 4c a0 0a JMP $0aa0 ; (btest + 47)
+--------------------------------------------------------------------
+insert:
+0b6c : 38 __ __ SEC
+0b6d : a5 23 __ LDA SP + 0
+0b6f : e9 05 __ SBC #$05
+0b71 : 85 23 __ STA SP + 0
+0b73 : a5 24 __ LDA SP + 1
+0b75 : e9 00 __ SBC #$00
+0b77 : 85 24 __ STA SP + 1
+0b79 : a0 07 __ LDY #$07
+0b7b : b1 23 __ LDA (SP + 0),y
+0b7d : 85 43 __ STA T0 + 0
+0b7f : c8 __ __ INY
+0b80 : b1 23 __ LDA (SP + 0),y
+0b82 : 85 44 __ STA T0 + 1
+0b84 : 05 43 __ ORA T0 + 0
+0b86 : d0 27 __ BNE $0baf
+0b88 : 20 27 0c JSR $0c27 ; (newnode + 0)
+0b8b : a0 09 __ LDY #$09
+0b8d : b1 23 __ LDA (SP + 0),y
+0b8f : a0 00 __ LDY #$00
+0b91 : 91 1b __ STA (ACCU + 0),y
+0b93 : a9 00 __ LDA #$00
+0b95 : c8 __ __ INY
+0b96 : 91 1b __ STA (ACCU + 0),y
+0b98 : c8 __ __ INY
+0b99 : 91 1b __ STA (ACCU + 0),y
+0b9b : c8 __ __ INY
+0b9c : 91 1b __ STA (ACCU + 0),y
+0b9e : c8 __ __ INY
+0b9f : 91 1b __ STA (ACCU + 0),y
+0ba1 : 18 __ __ CLC
+0ba2 : a5 23 __ LDA SP + 0
+0ba4 : 69 05 __ ADC #$05
+0ba6 : 85 23 __ STA SP + 0
+0ba8 : a5 24 __ LDA SP + 1
+0baa : 69 00 __ ADC #$00
+0bac : 85 24 __ STA SP + 1
+0bae : 60 __ __ RTS
+0baf : a0 09 __ LDY #$09
+0bb1 : b1 23 __ LDA (SP + 0),y
+0bb3 : 85 45 __ STA T1 + 0
+0bb5 : a0 00 __ LDY #$00
+0bb7 : d1 43 __ CMP (T0 + 0),y
+0bb9 : 90 37 __ BCC $0bf2
+0bbb : a0 03 __ LDY #$03
+0bbd : b1 43 __ LDA (T0 + 0),y
+0bbf : 88 __ __ DEY
+0bc0 : 91 23 __ STA (SP + 0),y
+0bc2 : a0 04 __ LDY #$04
+0bc4 : b1 43 __ LDA (T0 + 0),y
+0bc6 : 88 __ __ DEY
+0bc7 : 91 23 __ STA (SP + 0),y
+0bc9 : a5 45 __ LDA T1 + 0
+0bcb : c8 __ __ INY
+0bcc : 91 23 __ STA (SP + 0),y
+0bce : 20 6c 0b JSR $0b6c ; (insert + 0)
+0bd1 : a0 07 __ LDY #$07
+0bd3 : b1 23 __ LDA (SP + 0),y
+0bd5 : 85 47 __ STA T3 + 0
+0bd7 : c8 __ __ INY
+0bd8 : b1 23 __ LDA (SP + 0),y
+0bda : 85 48 __ STA T3 + 1
+0bdc : a5 1b __ LDA ACCU + 0
+0bde : a0 03 __ LDY #$03
+0be0 : 91 47 __ STA (T3 + 0),y
+0be2 : a5 1c __ LDA ACCU + 1
+0be4 : c8 __ __ INY
+0be5 : 91 47 __ STA (T3 + 0),y
+0be7 : a5 47 __ LDA T3 + 0
+0be9 : 85 1b __ STA ACCU + 0
+0beb : a5 48 __ LDA T3 + 1
+0bed : 85 1c __ STA ACCU + 1
+0bef : 4c a1 0b JMP $0ba1 ; (insert + 53)
+0bf2 : a0 01 __ LDY #$01
+0bf4 : b1 43 __ LDA (T0 + 0),y
+0bf6 : c8 __ __ INY
+0bf7 : 91 23 __ STA (SP + 0),y
+0bf9 : b1 43 __ LDA (T0 + 0),y
+0bfb : c8 __ __ INY
+0bfc : 91 23 __ STA (SP + 0),y
+0bfe : a5 45 __ LDA T1 + 0
+0c00 : c8 __ __ INY
+0c01 : 91 23 __ STA (SP + 0),y
+0c03 : 20 6c 0b JSR $0b6c ; (insert + 0)
+0c06 : a0 07 __ LDY #$07
+0c08 : b1 23 __ LDA (SP + 0),y
+0c0a : 85 47 __ STA T3 + 0
+0c0c : c8 __ __ INY
+0c0d : b1 23 __ LDA (SP + 0),y
+0c0f : 85 48 __ STA T3 + 1
+0c11 : a5 1b __ LDA ACCU + 0
+0c13 : a0 01 __ LDY #$01
+0c15 : 91 47 __ STA (T3 + 0),y
+0c17 : a5 1c __ LDA ACCU + 1
+0c19 : c8 __ __ INY
+0c1a : 91 47 __ STA (T3 + 0),y
+0c1c : a5 47 __ LDA T3 + 0
+0c1e : 85 1b __ STA ACCU + 0
+0c20 : a5 48 __ LDA T3 + 1
+0c22 : 85 1c __ STA ACCU + 1
+0c24 : 4c a1 0b JMP $0ba1 ; (insert + 53)
+--------------------------------------------------------------------
+newnode:
+0c27 : a9 05 __ LDA #$05
+0c29 : 85 0d __ STA P0
+0c2b : a9 00 __ LDA #$00
+0c2d : 85 0e __ STA P1
+0c2f : 20 33 0c JSR $0c33 ; (malloc + 0)
+0c32 : 60 __ __ RTS
+--------------------------------------------------------------------
+malloc:
+0c33 : 18 __ __ CLC
+0c34 : a5 0d __ LDA P0
+0c36 : 69 07 __ ADC #$07
+0c38 : 29 fc __ AND #$fc
+0c3a : 85 0d __ STA P0
+0c3c : 90 02 __ BCC $0c40
+0c3e : e6 0e __ INC P1
+0c40 : ad 4b 0e LDA $0e4b ; (freeHeapInit + 0)
+0c43 : d0 26 __ BNE $0c6b
+0c45 : a9 4e __ LDA #$4e
+0c47 : 8d 4c 0e STA $0e4c ; (freeHeap + 0)
+0c4a : a9 0e __ LDA #$0e
+0c4c : 8d 4d 0e STA $0e4d ; (freeHeap + 1)
+0c4f : a9 00 __ LDA #$00
+0c51 : 8d 50 0e STA $0e50 
+0c54 : 8d 51 0e STA $0e51 
+0c57 : 38 __ __ SEC
+0c58 : a9 00 __ LDA #$00
+0c5a : e9 4e __ SBC #$4e
+0c5c : 8d 4e 0e STA $0e4e 
+0c5f : a9 90 __ LDA #$90
+0c61 : e9 0e __ SBC #$0e
+0c63 : 8d 4f 0e STA $0e4f 
+0c66 : a9 01 __ LDA #$01
+0c68 : 8d 4b 0e STA $0e4b ; (freeHeapInit + 0)
+0c6b : ad 4c 0e LDA $0e4c ; (freeHeap + 0)
+0c6e : 85 43 __ STA T0 + 0
+0c70 : ad 4d 0e LDA $0e4d ; (freeHeap + 1)
+0c73 : 85 44 __ STA T0 + 1
+0c75 : a5 43 __ LDA T0 + 0
+0c77 : 0d 4d 0e ORA $0e4d ; (freeHeap + 1)
+0c7a : d0 07 __ BNE $0c83
+0c7c : a9 00 __ LDA #$00
+0c7e : 85 1b __ STA ACCU + 0
+0c80 : 85 1c __ STA ACCU + 1
+0c82 : 60 __ __ RTS
+0c83 : a9 00 __ LDA #$00
+0c85 : 85 46 __ STA T2 + 0
+0c87 : 85 47 __ STA T2 + 1
+0c89 : a0 00 __ LDY #$00
+0c8b : b1 43 __ LDA (T0 + 0),y
+0c8d : 85 4a __ STA T4 + 0
+0c8f : c8 __ __ INY
+0c90 : b1 43 __ LDA (T0 + 0),y
+0c92 : 85 4b __ STA T4 + 1
+0c94 : c5 0e __ CMP P1
+0c96 : d0 04 __ BNE $0c9c
+0c98 : a5 4a __ LDA T4 + 0
+0c9a : c5 0d __ CMP P0
+0c9c : b0 03 __ BCS $0ca1
+0c9e : 4c 5b 0d JMP $0d5b ; (malloc + 296)
+0ca1 : a5 0e __ LDA P1
+0ca3 : c5 4b __ CMP T4 + 1
+0ca5 : d0 06 __ BNE $0cad
+0ca7 : a5 0d __ LDA P0
+0ca9 : c5 4a __ CMP T4 + 0
+0cab : f0 74 __ BEQ $0d21
+0cad : 18 __ __ CLC
+0cae : a5 43 __ LDA T0 + 0
+0cb0 : 65 0d __ ADC P0
+0cb2 : 85 4a __ STA T4 + 0
+0cb4 : a5 44 __ LDA T0 + 1
+0cb6 : 65 0e __ ADC P1
+0cb8 : 85 4b __ STA T4 + 1
+0cba : 38 __ __ SEC
+0cbb : a0 00 __ LDY #$00
+0cbd : b1 43 __ LDA (T0 + 0),y
+0cbf : e5 0d __ SBC P0
+0cc1 : 91 4a __ STA (T4 + 0),y
+0cc3 : c8 __ __ INY
+0cc4 : b1 43 __ LDA (T0 + 0),y
+0cc6 : e5 0e __ SBC P1
+0cc8 : 91 4a __ STA (T4 + 0),y
+0cca : c8 __ __ INY
+0ccb : b1 43 __ LDA (T0 + 0),y
+0ccd : 91 4a __ STA (T4 + 0),y
+0ccf : c8 __ __ INY
+0cd0 : b1 43 __ LDA (T0 + 0),y
+0cd2 : 91 4a __ STA (T4 + 0),y
+0cd4 : a5 46 __ LDA T2 + 0
+0cd6 : 05 47 __ ORA T2 + 1
+0cd8 : d0 23 __ BNE $0cfd
+0cda : a5 4a __ LDA T4 + 0
+0cdc : 8d 4c 0e STA $0e4c ; (freeHeap + 0)
+0cdf : a5 4b __ LDA T4 + 1
+0ce1 : 8d 4d 0e STA $0e4d ; (freeHeap + 1)
+0ce4 : a5 0d __ LDA P0
+0ce6 : a0 00 __ LDY #$00
+0ce8 : 91 43 __ STA (T0 + 0),y
+0cea : a5 0e __ LDA P1
+0cec : c8 __ __ INY
+0ced : 91 43 __ STA (T0 + 0),y
+0cef : 18 __ __ CLC
+0cf0 : a5 43 __ LDA T0 + 0
+0cf2 : 69 02 __ ADC #$02
+0cf4 : 85 1b __ STA ACCU + 0
+0cf6 : a5 44 __ LDA T0 + 1
+0cf8 : 69 00 __ ADC #$00
+0cfa : 4c 80 0c JMP $0c80 ; (malloc + 77)
+0cfd : a5 4a __ LDA T4 + 0
+0cff : a0 02 __ LDY #$02
+0d01 : 91 46 __ STA (T2 + 0),y
+0d03 : a5 4b __ LDA T4 + 1
+0d05 : c8 __ __ INY
+0d06 : 91 46 __ STA (T2 + 0),y
+0d08 : a5 0d __ LDA P0
+0d0a : a0 00 __ LDY #$00
+0d0c : 91 43 __ STA (T0 + 0),y
+0d0e : a5 0e __ LDA P1
+0d10 : c8 __ __ INY
+0d11 : 91 43 __ STA (T0 + 0),y
+0d13 : 18 __ __ CLC
+0d14 : a5 43 __ LDA T0 + 0
+0d16 : 69 02 __ ADC #$02
+0d18 : 85 1b __ STA ACCU + 0
+0d1a : a5 44 __ LDA T0 + 1
+0d1c : 69 00 __ ADC #$00
+0d1e : 4c 80 0c JMP $0c80 ; (malloc + 77)
+0d21 : a5 46 __ LDA T2 + 0
+0d23 : 05 47 __ ORA T2 + 1
+0d25 : d0 1b __ BNE $0d42
+0d27 : a0 02 __ LDY #$02
+0d29 : b1 43 __ LDA (T0 + 0),y
+0d2b : 8d 4c 0e STA $0e4c ; (freeHeap + 0)
+0d2e : c8 __ __ INY
+0d2f : b1 43 __ LDA (T0 + 0),y
+0d31 : 8d 4d 0e STA $0e4d ; (freeHeap + 1)
+0d34 : 18 __ __ CLC
+0d35 : a5 43 __ LDA T0 + 0
+0d37 : 69 02 __ ADC #$02
+0d39 : 85 1b __ STA ACCU + 0
+0d3b : a5 44 __ LDA T0 + 1
+0d3d : 69 00 __ ADC #$00
+0d3f : 4c 80 0c JMP $0c80 ; (malloc + 77)
+0d42 : a0 02 __ LDY #$02
+0d44 : b1 43 __ LDA (T0 + 0),y
+0d46 : 91 46 __ STA (T2 + 0),y
+0d48 : c8 __ __ INY
+0d49 : b1 43 __ LDA (T0 + 0),y
+0d4b : 91 46 __ STA (T2 + 0),y
+0d4d : 18 __ __ CLC
+0d4e : a5 43 __ LDA T0 + 0
+0d50 : 69 02 __ ADC #$02
+0d52 : 85 1b __ STA ACCU + 0
+0d54 : a5 44 __ LDA T0 + 1
+0d56 : 69 00 __ ADC #$00
+0d58 : 4c 80 0c JMP $0c80 ; (malloc + 77)
+0d5b : a5 43 __ LDA T0 + 0
+0d5d : 85 46 __ STA T2 + 0
+0d5f : a5 44 __ LDA T0 + 1
+0d61 : 85 47 __ STA T2 + 1
+0d63 : a0 02 __ LDY #$02
+0d65 : b1 43 __ LDA (T0 + 0),y
+0d67 : aa __ __ TAX
+0d68 : c8 __ __ INY
+0d69 : b1 43 __ LDA (T0 + 0),y
+0d6b : 86 43 __ STX T0 + 0
+0d6d : 85 44 __ STA T0 + 1
+0d6f : 8a __ __ TXA
+0d70 : 05 44 __ ORA T0 + 1
+0d72 : f0 03 __ BEQ $0d77
+0d74 : 4c 89 0c JMP $0c89 ; (malloc + 86)
+0d77 : 4c 7c 0c JMP $0c7c ; (malloc + 73)
+--------------------------------------------------------------------
+collect:
+0d7a : 38 __ __ SEC
+0d7b : a5 23 __ LDA SP + 0
+0d7d : e9 06 __ SBC #$06
+0d7f : 85 23 __ STA SP + 0
+0d81 : a5 24 __ LDA SP + 1
+0d83 : e9 00 __ SBC #$00
+0d85 : 85 24 __ STA SP + 1
+0d87 : a0 08 __ LDY #$08
+0d89 : b1 23 __ LDA (SP + 0),y
+0d8b : 85 43 __ STA T0 + 0
+0d8d : c8 __ __ INY
+0d8e : b1 23 __ LDA (SP + 0),y
+0d90 : 85 44 __ STA T0 + 1
+0d92 : 05 43 __ ORA T0 + 0
+0d94 : d0 19 __ BNE $0daf
+0d96 : a0 0a __ LDY #$0a
+0d98 : b1 23 __ LDA (SP + 0),y
+0d9a : 85 1b __ STA ACCU + 0
+0d9c : c8 __ __ INY
+0d9d : b1 23 __ LDA (SP + 0),y
+0d9f : 85 1c __ STA ACCU + 1
+0da1 : 18 __ __ CLC
+0da2 : a5 23 __ LDA SP + 0
+0da4 : 69 06 __ ADC #$06
+0da6 : 85 23 __ STA SP + 0
+0da8 : a5 24 __ LDA SP + 1
+0daa : 69 00 __ ADC #$00
+0dac : 85 24 __ STA SP + 1
+0dae : 60 __ __ RTS
+0daf : a0 01 __ LDY #$01
+0db1 : b1 43 __ LDA (T0 + 0),y
+0db3 : c8 __ __ INY
+0db4 : 91 23 __ STA (SP + 0),y
+0db6 : b1 43 __ LDA (T0 + 0),y
+0db8 : c8 __ __ INY
+0db9 : 91 23 __ STA (SP + 0),y
+0dbb : a0 0a __ LDY #$0a
+0dbd : b1 23 __ LDA (SP + 0),y
+0dbf : a0 04 __ LDY #$04
+0dc1 : 91 23 __ STA (SP + 0),y
+0dc3 : a0 0b __ LDY #$0b
+0dc5 : b1 23 __ LDA (SP + 0),y
+0dc7 : a0 05 __ LDY #$05
+0dc9 : 91 23 __ STA (SP + 0),y
+0dcb : 20 7a 0d JSR $0d7a ; (collect + 0)
+0dce : a0 08 __ LDY #$08
+0dd0 : b1 23 __ LDA (SP + 0),y
+0dd2 : 85 45 __ STA T1 + 0
+0dd4 : c8 __ __ INY
+0dd5 : b1 23 __ LDA (SP + 0),y
+0dd7 : 85 46 __ STA T1 + 1
+0dd9 : a0 00 __ LDY #$00
+0ddb : b1 45 __ LDA (T1 + 0),y
+0ddd : 91 1b __ STA (ACCU + 0),y
+0ddf : a0 03 __ LDY #$03
+0de1 : b1 45 __ LDA (T1 + 0),y
+0de3 : 88 __ __ DEY
+0de4 : 91 23 __ STA (SP + 0),y
+0de6 : a0 04 __ LDY #$04
+0de8 : b1 45 __ LDA (T1 + 0),y
+0dea : 88 __ __ DEY
+0deb : 91 23 __ STA (SP + 0),y
+0ded : 18 __ __ CLC
+0dee : a5 1b __ LDA ACCU + 0
+0df0 : 69 01 __ ADC #$01
+0df2 : c8 __ __ INY
+0df3 : 91 23 __ STA (SP + 0),y
+0df5 : a5 1c __ LDA ACCU + 1
+0df7 : 69 00 __ ADC #$00
+0df9 : c8 __ __ INY
+0dfa : 91 23 __ STA (SP + 0),y
+0dfc : 20 7a 0d JSR $0d7a ; (collect + 0)
+0dff : 4c a1 0d JMP $0da1 ; (collect + 39)
+--------------------------------------------------------------------
+strcmp:
+0e02 : a0 00 __ LDY #$00
+0e04 : 84 1c __ STY ACCU + 1
+0e06 : b1 0d __ LDA (P0),y
+0e08 : f0 16 __ BEQ $0e20
+0e0a : d1 0f __ CMP (P2),y
+0e0c : d0 16 __ BNE $0e24
+0e0e : c8 __ __ INY
+0e0f : b1 0d __ LDA (P0),y
+0e11 : f0 0d __ BEQ $0e20
+0e13 : d1 0f __ CMP (P2),y
+0e15 : d0 0d __ BNE $0e24
+0e17 : c8 __ __ INY
+0e18 : d0 ec __ BNE $0e06
+0e1a : e6 0e __ INC P1
+0e1c : e6 10 __ INC P3
+0e1e : d0 e6 __ BNE $0e06
+0e20 : d1 0f __ CMP (P2),y
+0e22 : f0 0a __ BEQ $0e2e
+0e24 : b0 06 __ BCS $0e2c
+0e26 : a9 ff __ LDA #$ff
+0e28 : 85 1c __ STA ACCU + 1
+0e2a : 30 02 __ BMI $0e2e
+0e2c : a9 01 __ LDA #$01
+0e2e : 85 1b __ STA ACCU + 0
+0e30 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0e3d : a9 4c __ LDA #$4c
+0e3f : 85 54 __ STA $54
+0e41 : a9 00 __ LDA #$00
+0e43 : 85 13 __ STA P6
+0e45 : a9 19 __ LDA #$19
+0e47 : 85 16 __ STA P9
+0e49 : 60 __ __ RTS
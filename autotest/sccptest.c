@@ -0,0 +1,73 @@
+#include <assert.h>
+
+int	g;
+
+int fconst(int c)
+{
+	int	x = 3, y;
+
+	if (c)
+		x = 3;
+	y = x * 2;
+
+	if (y == 6)
+		g = 1;
+	else
+		g = 2;
+
+	return y;
+}
+
+void fempty(int c)
+{
+	if (c) {}
+	g = 7;
+}
+
+int floop(int n)
+{
+	int	s = 0, k = 1;
+
+	for(int i=0; i<n; i++)
+	{
+		if (k != 1)
+			s += 100;
+		s += k;
+	}
+
+	return s;
+}
+
+int fflag(const char * p, bool print)
+{
+	int	s = 0;
+
+	while (*p)
+	{
+		if (print)
+			s += *p;
+		else
+			s -= *p;
+		p++;
+	}
+
+	return s;
+}
+
+int main(void)
+{
+	assert(fconst(1) == 6 && g == 1);
+	g = 0;
+	assert(fconst(0) == 6 && g == 1);
+
+	fempty(g);
+	assert(g == 7);
+
+	assert(floop(10) == 10);
+	assert(floop(0) == 0);
+
+	assert(fflag("AB", true) == 131);
+	assert(fflag("AB", false) == -131);
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+#include <assert.h>
+
+// A source line of almost two thousand characters and a macro joined from
+// many continued lines
+
+const unsigned char table[400] = {11, 48, 85, 122, 159, 196, 233, 19, 56, 93, 130, 167, 204, 241, 27, 64, 101, 138, 175, 212, 249, 35, 72, 109, 146, 183, 220, 6, 43, 80, 117, 154, 191, 228, 14, 51, 88, 125, 162, 199, 236, 22, 59, 96, 133, 170, 207, 244, 30, 67, 104, 141, 178, 215, 1, 38, 75, 112, 149, 186, 223, 9, 46, 83, 120, 157, 194, 231, 17, 54, 91, 128, 165, 202, 239, 25, 62, 99, 136, 173, 210, 247, 33, 70, 107, 144, 181, 218, 4, 41, 78, 115, 152, 189, 226, 12, 49, 86, 123, 160, 197, 234, 20, 57, 94, 131, 168, 205, 242, 28, 65, 102, 139, 176, 213, 250, 36, 73, 110, 147, 184, 221, 7, 44, 81, 118, 155, 192, 229, 15, 52, 89, 126, 163, 200, 237, 23, 60, 97, 134, 171, 208, 245, 31, 68, 105, 142, 179, 216, 2, 39, 76, 113, 150, 187, 224, 10, 47, 84, 121, 158, 195, 232, 18, 55, 92, 129, 166, 203, 240, 26, 63, 100, 137, 174, 211, 248, 34, 71, 108, 145, 182, 219, 5, 42, 79, 116, 153, 190, 227, 13, 50, 87, 124, 161, 198, 235, 21, 58, 95, 132, 169, 206, 243, 29, 66, 103, 140, 177, 214, 0, 37, 74, 111, 148, 185, 222, 8, 45, 82, 119, 156, 193, 230, 16, 53, 90, 127, 164, 201, 238, 24, 61, 98, 135, 172, 209, 246, 32, 69, 106, 143, 180, 217, 3, 40, 77, 114, 151, 188, 225, 11, 48, 85, 122, 159, 196, 233, 19, 56, 93, 130, 167, 204, 241, 27, 64, 101, 138, 175, 212, 249, 35, 72, 109, 146, 183, 220, 6, 43, 80, 117, 154, 191, 228, 14, 51, 88, 125, 162, 199, 236, 22, 59, 96, 133, 170, 207, 244, 30, 67, 104, 141, 178, 215, 1, 38, 75, 112, 149, 186, 223, 9, 46, 83, 120, 157, 194, 231, 17, 54, 91, 128, 165, 202, 239, 25, 62, 99, 136, 173, 210, 247, 33, 70, 107, 144, 181, 218, 4, 41, 78, 115, 152, 189, 226, 12, 49, 86, 123, 160, 197, 234, 20, 57, 94, 131, 168, 205, 242, 28, 65, 102, 139, 176, 213, 250, 36, 73, 110, 147, 184, 221, 7, 44, 81, 118, 155, 192, 229, 15, 52, 89, 126, 163, 200, 237, 23, 60, 97, 134, 171, 208, 245, 31, 68, 105, 142, 179, 216};
+
+#define SUM \
+	(0 + 0) * 1 +\
+	(1 + 3) * 2 +\
+	(2 + 6) * 3 +\
+	(3 + 9) * 4 +\
+	(4 + 12) * 5 +\
+	(5 + 15) * 1 +\
+	(6 + 18) * 2 +\
+	(7 + 21) * 3 +\
+	(8 + 24) * 4 +\
+	(9 + 27) * 5 +\
+	(10 + 30) * 1 +\
+	(11 + 33) * 2 +\
+	(12 + 36) * 3 +\
+	(13 + 39) * 4 +\
+	(14 + 42) * 5 +\
+	(15 + 45) * 1 +\
+	(16 + 48) * 2 +\
+	(17 + 51) * 3 +\
+	(18 + 54) * 4 +\
+	(19 + 57) * 5 +\
+	(20 + 60) * 1 +\
+	(21 + 63) * 2 +\
+	(22 + 66) * 3 +\
+	(23 + 69) * 4 +\
+	(24 + 72) * 5 +\
+	(25 + 75) * 1 +\
+	(26 + 78) * 2 +\
+	(27 + 81) * 3 +\
+	(28 + 84) * 4 +\
+	(29 + 87) * 5 +\
+	(30 + 90) * 1 +\
+	(31 + 93) * 2 +\
+	(32 + 96) * 3 +\
+	(33 + 99) * 4 +\
+	(34 + 102) * 5 +\
+	(35 + 105) * 1 +\
+	(36 + 108) * 2 +\
+	(37 + 111) * 3 +\
+	(38 + 114) * 4 +\
+	(39 + 117) * 5 +\
+	0
+
+int main(void)
+{
+	unsigned	s = 0;
+	for (int i = 0; i < 400; i++)
+		s += table[i];
+	assert(s == 50169);
+
+	long	l = SUM;
+	assert(l == 9680);
+
+	return 0;
+}
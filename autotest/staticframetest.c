@@ -0,0 +1,108 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct Point
+{
+	int		x, y;
+};
+
+int fill(char * p, int n)
+{
+	int	s = 0;
+	for (int i = 0; i < n; i++)
+	{
+		p[i] = i;
+		s += i;
+	}
+	return s;
+}
+
+int inner(int k)
+{
+	char	buf[20];
+	int		s = fill(buf, 20);
+	for (int i = 0; i < 20; i++)
+		s += buf[i] * k;
+	return s;
+}
+
+int outer(int k)
+{
+	char	buf[30];
+	fill(buf, 30);
+	int	s = inner(k);
+	for (int i = 0; i < 30; i++)
+		s += buf[i];
+	return s;
+}
+
+int sibling(int k)
+{
+	int		a[10];
+	for (int i = 0; i < 10; i++)
+		a[i] = i * k;
+	int	s = 0;
+	for (int i = 0; i < 10; i++)
+		s += a[i];
+	return s;
+}
+
+struct Point mirror(struct Point p)
+{
+	struct Point	q;
+	q.x = p.y;
+	q.y = p.x;
+	return q;
+}
+
+int recurse(int n)
+{
+	char	buf[4];
+	buf[0] = n;
+	if (n == 0)
+		return inner(1);
+	return recurse(n - 1) + buf[0] + sibling(n);
+}
+
+int callback(int k)
+{
+	int		a[5];
+	for (int i = 0; i < 5; i++)
+		a[i] = k + i;
+	return a[0] + a[4] + sibling(1);
+}
+
+int (* cbp)(int) = callback;
+
+int heapuse(int n)
+{
+	char	buf[16];
+	int		s = fill(buf, 16);
+	char	*	p = malloc(n);
+	memset(p, 0xff, n);
+	free(p);
+	for (int i = 0; i < 16; i++)
+		s += buf[i];
+	return s;
+}
+
+int main(void)
+{
+	assert(inner(1) == 380);
+	assert(outer(2) == 190 + 380 + 435);
+	assert(sibling(3) == 135);
+
+	struct Point	p = {1, 2};
+	struct Point	q = mirror(p);
+	assert(q.x == 2 && q.y == 1);
+
+	assert(recurse(3) == 380 + 3 + 2 + 1 + 45 * 6);
+	assert(cbp(7) == 7 + 11 + 45);
+	assert(heapuse(200) == 240);
+
+	int	t = outer(1) + sibling(2);
+	assert(t == 190 + 190 + 435 + 90);
+
+	return 0;
+}
@@ -0,0 +1,384 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 1d 0c STX $0c1d ; (spentry + 0)
+0811 : a9 1e __ LDA #$1e
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0c __ LDA #$0c
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 1b __ LDA #$1b
+081c : e9 0c __ SBC #$0c
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 be __ LDA #$be
+0832 : e9 1e __ SBC #$1e
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 10 0c JMP $0c10 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 03 __ SBC #$03
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 7a __ LDA #$7a
+090f : 85 0d __ STA P0
+0911 : a9 0b __ LDA #$0b
+0913 : 85 0e __ STA P1
+0915 : a9 83 __ LDA #$83
+0917 : 85 0f __ STA P2
+0919 : a9 0b __ LDA #$0b
+091b : 85 10 __ STA P3
+091d : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0920 : a5 1b __ LDA ACCU + 0
+0922 : 05 1c __ ORA ACCU + 1
+0924 : d0 03 __ BNE $0929
+0926 : 4c 21 0b JMP $0b21 ; (main + 545)
+0929 : a9 00 __ LDA #$00
+092b : a0 02 __ LDY #$02
+092d : 91 23 __ STA (SP + 0),y
+092f : 20 26 0b JSR $0b26 ; (assert + 0)
+0932 : a9 8c __ LDA #$8c
+0934 : 85 0d __ STA P0
+0936 : a9 0b __ LDA #$0b
+0938 : 85 0e __ STA P1
+093a : a9 95 __ LDA #$95
+093c : 85 0f __ STA P2
+093e : a9 0b __ LDA #$0b
+0940 : 85 10 __ STA P3
+0942 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0945 : a5 1c __ LDA ACCU + 1
+0947 : 10 03 __ BPL $094c
+0949 : 4c 1c 0b JMP $0b1c ; (main + 540)
+094c : a9 00 __ LDA #$00
+094e : a0 02 __ LDY #$02
+0950 : 91 23 __ STA (SP + 0),y
+0952 : 20 26 0b JSR $0b26 ; (assert + 0)
+0955 : a9 9e __ LDA #$9e
+0957 : 85 0d __ STA P0
+0959 : a9 0b __ LDA #$0b
+095b : 85 0e __ STA P1
+095d : a9 a7 __ LDA #$a7
+095f : 85 0f __ STA P2
+0961 : a9 0b __ LDA #$0b
+0963 : 85 10 __ STA P3
+0965 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0968 : a5 1c __ LDA ACCU + 1
+096a : 10 03 __ BPL $096f
+096c : 4c 17 0b JMP $0b17 ; (main + 535)
+096f : a9 00 __ LDA #$00
+0971 : a0 02 __ LDY #$02
+0973 : 91 23 __ STA (SP + 0),y
+0975 : 20 26 0b JSR $0b26 ; (assert + 0)
+0978 : a9 b1 __ LDA #$b1
+097a : 85 0d __ STA P0
+097c : a9 0b __ LDA #$0b
+097e : 85 0e __ STA P1
+0980 : a9 bb __ LDA #$bb
+0982 : 85 0f __ STA P2
+0984 : a9 0b __ LDA #$0b
+0986 : 85 10 __ STA P3
+0988 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+098b : a5 1c __ LDA ACCU + 1
+098d : 30 07 __ BMI $0996
+098f : 05 1b __ ORA ACCU + 0
+0991 : f0 03 __ BEQ $0996
+0993 : 4c 12 0b JMP $0b12 ; (main + 530)
+0996 : a9 00 __ LDA #$00
+0998 : a0 02 __ LDY #$02
+099a : 91 23 __ STA (SP + 0),y
+099c : 20 26 0b JSR $0b26 ; (assert + 0)
+099f : a9 c4 __ LDA #$c4
+09a1 : 85 0d __ STA P0
+09a3 : a9 0b __ LDA #$0b
+09a5 : 85 0e __ STA P1
+09a7 : a9 cd __ LDA #$cd
+09a9 : 85 0f __ STA P2
+09ab : a9 0b __ LDA #$0b
+09ad : 85 10 __ STA P3
+09af : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+09b2 : a5 1c __ LDA ACCU + 1
+09b4 : 30 07 __ BMI $09bd
+09b6 : 05 1b __ ORA ACCU + 0
+09b8 : f0 03 __ BEQ $09bd
+09ba : 4c 0d 0b JMP $0b0d ; (main + 525)
+09bd : a9 00 __ LDA #$00
+09bf : a0 02 __ LDY #$02
+09c1 : 91 23 __ STA (SP + 0),y
+09c3 : 20 26 0b JSR $0b26 ; (assert + 0)
+09c6 : a9 d6 __ LDA #$d6
+09c8 : 85 0d __ STA P0
+09ca : a9 0b __ LDA #$0b
+09cc : 85 0e __ STA P1
+09ce : a9 df __ LDA #$df
+09d0 : 85 0f __ STA P2
+09d2 : a9 0b __ LDA #$0b
+09d4 : 85 10 __ STA P3
+09d6 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+09d9 : a5 1b __ LDA ACCU + 0
+09db : 05 1c __ ORA ACCU + 1
+09dd : d0 03 __ BNE $09e2
+09df : 4c 08 0b JMP $0b08 ; (main + 520)
+09e2 : a9 00 __ LDA #$00
+09e4 : a0 02 __ LDY #$02
+09e6 : 91 23 __ STA (SP + 0),y
+09e8 : 20 26 0b JSR $0b26 ; (assert + 0)
+09eb : a9 00 __ LDA #$00
+09ed : 85 44 __ STA T0 + 0
+09ef : 85 45 __ STA T0 + 1
+09f1 : ad e8 0b LDA $0be8 
+09f4 : f0 03 __ BEQ $09f9
+09f6 : 4c ec 0a JMP $0aec ; (main + 492)
+09f9 : a5 45 __ LDA T0 + 1
+09fb : d0 09 __ BNE $0a06
+09fd : a5 44 __ LDA T0 + 0
+09ff : c9 06 __ CMP #$06
+0a01 : d0 03 __ BNE $0a06
+0a03 : 4c e7 0a JMP $0ae7 ; (main + 487)
+0a06 : a9 00 __ LDA #$00
+0a08 : a0 02 __ LDY #$02
+0a0a : 91 23 __ STA (SP + 0),y
+0a0c : 20 26 0b JSR $0b26 ; (assert + 0)
+0a0f : a9 00 __ LDA #$00
+0a11 : 85 44 __ STA T0 + 0
+0a13 : 85 45 __ STA T0 + 1
+0a15 : 18 __ __ CLC
+0a16 : a9 1e __ LDA #$1e
+0a18 : 65 44 __ ADC T0 + 0
+0a1a : 85 48 __ STA T3 + 0
+0a1c : a9 0c __ LDA #$0c
+0a1e : 65 45 __ ADC T0 + 1
+0a20 : 85 49 __ STA T3 + 1
+0a22 : a5 44 __ LDA T0 + 0
+0a24 : 29 07 __ AND #$07
+0a26 : 18 __ __ CLC
+0a27 : 69 61 __ ADC #$61
+0a29 : a0 00 __ LDY #$00
+0a2b : 91 48 __ STA (T3 + 0),y
+0a2d : e6 44 __ INC T0 + 0
+0a2f : d0 02 __ BNE $0a33
+0a31 : e6 45 __ INC T0 + 1
+0a33 : a5 45 __ LDA T0 + 1
+0a35 : 49 80 __ EOR #$80
+0a37 : c9 87 __ CMP #$87
+0a39 : d0 04 __ BNE $0a3f
+0a3b : a5 44 __ LDA T0 + 0
+0a3d : c9 6c __ CMP #$6c
+0a3f : 90 d4 __ BCC $0a15
+0a41 : a9 00 __ LDA #$00
+0a43 : 8d 8a 13 STA $138a ; (aa + 1900)
+0a46 : a9 ee __ LDA #$ee
+0a48 : 85 0d __ STA P0
+0a4a : a9 13 __ LDA #$13
+0a4c : 85 0e __ STA P1
+0a4e : a9 1e __ LDA #$1e
+0a50 : 85 0f __ STA P2
+0a52 : a9 0c __ LDA #$0c
+0a54 : 85 10 __ STA P3
+0a56 : 20 ef 0b JSR $0bef ; (strcpy + 0)
+0a59 : a9 1e __ LDA #$1e
+0a5b : 85 0d __ STA P0
+0a5d : a9 0c __ LDA #$0c
+0a5f : 85 0e __ STA P1
+0a61 : a9 ee __ LDA #$ee
+0a63 : 85 0f __ STA P2
+0a65 : a9 13 __ LDA #$13
+0a67 : 85 10 __ STA P3
+0a69 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0a6c : a5 1b __ LDA ACCU + 0
+0a6e : 05 1c __ ORA ACCU + 1
+0a70 : f0 70 __ BEQ $0ae2
+0a72 : a9 00 __ LDA #$00
+0a74 : a0 02 __ LDY #$02
+0a76 : 91 23 __ STA (SP + 0),y
+0a78 : 20 26 0b JSR $0b26 ; (assert + 0)
+0a7b : a9 7a __ LDA #$7a
+0a7d : 8d d6 17 STA $17d6 ; (ba + 1000)
+0a80 : a9 1e __ LDA #$1e
+0a82 : 85 0d __ STA P0
+0a84 : a9 0c __ LDA #$0c
+0a86 : 85 0e __ STA P1
+0a88 : a9 ee __ LDA #$ee
+0a8a : 85 0f __ STA P2
+0a8c : a9 13 __ LDA #$13
+0a8e : 85 10 __ STA P3
+0a90 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0a93 : a5 1c __ LDA ACCU + 1
+0a95 : 30 46 __ BMI $0add
+0a97 : a9 00 __ LDA #$00
+0a99 : a0 02 __ LDY #$02
+0a9b : 91 23 __ STA (SP + 0),y
+0a9d : 20 26 0b JSR $0b26 ; (assert + 0)
+0aa0 : a9 ee __ LDA #$ee
+0aa2 : 85 0d __ STA P0
+0aa4 : a9 13 __ LDA #$13
+0aa6 : 85 0e __ STA P1
+0aa8 : a9 1e __ LDA #$1e
+0aaa : 85 0f __ STA P2
+0aac : a9 0c __ LDA #$0c
+0aae : 85 10 __ STA P3
+0ab0 : 20 4b 0b JSR $0b4b ; (strcmp + 0)
+0ab3 : a5 1c __ LDA ACCU + 1
+0ab5 : 30 04 __ BMI $0abb
+0ab7 : 05 1b __ ORA ACCU + 0
+0ab9 : d0 1d __ BNE $0ad8
+0abb : a9 00 __ LDA #$00
+0abd : a0 02 __ LDY #$02
+0abf : 91 23 __ STA (SP + 0),y
+0ac1 : 20 26 0b JSR $0b26 ; (assert + 0)
+0ac4 : a9 00 __ LDA #$00
+0ac6 : 85 1b __ STA ACCU + 0
+0ac8 : 85 1c __ STA ACCU + 1
+0aca : 18 __ __ CLC
+0acb : a5 23 __ LDA SP + 0
+0acd : 69 03 __ ADC #$03
+0acf : 85 23 __ STA SP + 0
+0ad1 : a5 24 __ LDA SP + 1
+0ad3 : 69 00 __ ADC #$00
+0ad5 : 85 24 __ STA SP + 1
+0ad7 : 60 __ __ RTS
+0ad8 : a9 01 __ LDA #$01
+0ada : 4c bd 0a JMP $0abd ; (main + 445)
+0add : a9 01 __ LDA #$01
+0adf : 4c 99 0a JMP $0a99 ; (main + 409)
+0ae2 : a9 01 __ LDA #$01
+0ae4 : 4c 74 0a JMP $0a74 ; (main + 372)
+0ae7 : a9 01 __ LDA #$01
+0ae9 : 4c 08 0a JMP $0a08 ; (main + 264)
+0aec : 18 __ __ CLC
+0aed : a9 e8 __ LDA #$e8
+0aef : 65 44 __ ADC T0 + 0
+0af1 : 85 48 __ STA T3 + 0
+0af3 : a9 0b __ LDA #$0b
+0af5 : 65 45 __ ADC T0 + 1
+0af7 : 85 49 __ STA T3 + 1
+0af9 : e6 44 __ INC T0 + 0
+0afb : d0 02 __ BNE $0aff
+0afd : e6 45 __ INC T0 + 1
+0aff : a0 01 __ LDY #$01
+0b01 : b1 48 __ LDA (T3 + 0),y
+0b03 : d0 e7 __ BNE $0aec
+0b05 : 4c f9 09 JMP $09f9 ; (main + 249)
+0b08 : a9 01 __ LDA #$01
+0b0a : 4c e4 09 JMP $09e4 ; (main + 228)
+0b0d : a9 01 __ LDA #$01
+0b0f : 4c bf 09 JMP $09bf ; (main + 191)
+0b12 : a9 01 __ LDA #$01
+0b14 : 4c 98 09 JMP $0998 ; (main + 152)
+0b17 : a9 01 __ LDA #$01
+0b19 : 4c 71 09 JMP $0971 ; (main + 113)
+0b1c : a9 01 __ LDA #$01
+0b1e : 4c 4e 09 JMP $094e ; (main + 78)
+0b21 : a9 01 __ LDA #$01
+0b23 : 4c 2b 09 JMP $092b ; (main + 43)
+--------------------------------------------------------------------
+assert:
+0b26 : a0 02 __ LDY #$02
+0b28 : b1 23 __ LDA (SP + 0),y
+0b2a : d0 09 __ BNE $0b35
+0b2c : a9 ff __ LDA #$ff
+0b2e : 85 0d __ STA P0
+0b30 : 85 0e __ STA P1
+0b32 : 20 36 0b JSR $0b36 ; (exit + 0)
+0b35 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+0b36 : a5 0d __ LDA P0
+0b38 : 85 1b __ STA ACCU + 0
+0b3a : a5 0e __ LDA P1
+0b3c : 85 1c __ STA ACCU + 1
+0b3e : ae 1d 0c LDX $0c1d ; (spentry + 0)
+0b41 : 9a __ __ TXS
+0b42 : a9 4c __ LDA #$4c
+0b44 : 85 54 __ STA $54
+0b46 : a9 00 __ LDA #$00
+0b48 : 85 13 __ STA P6
+0b4a : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0b4b : a0 00 __ LDY #$00
+0b4d : 84 1c __ STY ACCU + 1
+0b4f : b1 0d __ LDA (P0),y
+0b51 : f0 16 __ BEQ $0b69
+0b53 : d1 0f __ CMP (P2),y
+0b55 : d0 16 __ BNE $0b6d
+0b57 : c8 __ __ INY
+0b58 : b1 0d __ LDA (P0),y
+0b5a : f0 0d __ BEQ $0b69
+0b5c : d1 0f __ CMP (P2),y
+0b5e : d0 0d __ BNE $0b6d
+0b60 : c8 __ __ INY
+0b61 : d0 ec __ BNE $0b4f
+0b63 : e6 0e __ INC P1
+0b65 : e6 10 __ INC P3
+0b67 : d0 e6 __ BNE $0b4f
+0b69 : d1 0f __ CMP (P2),y
+0b6b : f0 0a __ BEQ $0b77
+0b6d : b0 06 __ BCS $0b75
+0b6f : a9 ff __ LDA #$ff
+0b71 : 85 1c __ STA ACCU + 1
+0b73 : 30 02 __ BMI $0b77
+0b75 : a9 01 __ LDA #$01
+0b77 : 85 1b __ STA ACCU + 0
+0b79 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcpy:
+0bef : a5 0d __ LDA P0
+0bf1 : 85 1b __ STA ACCU + 0
+0bf3 : a5 0e __ LDA P1
+0bf5 : 85 1c __ STA ACCU + 1
+0bf7 : a0 00 __ LDY #$00
+0bf9 : b1 0f __ LDA (P2),y
+0bfb : 91 0d __ STA (P0),y
+0bfd : f0 10 __ BEQ $0c0f
+0bff : c8 __ __ INY
+0c00 : b1 0f __ LDA (P2),y
+0c02 : 91 0d __ STA (P0),y
+0c04 : f0 09 __ BEQ $0c0f
+0c06 : c8 __ __ INY
+0c07 : d0 f0 __ BNE $0bf9
+0c09 : e6 10 __ INC P3
+0c0b : e6 0e __ INC P1
+0c0d : d0 ea __ BNE $0bf9
+0c0f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0c10 : a9 4c __ LDA #$4c
+0c12 : 85 54 __ STA $54
+0c14 : a9 00 __ LDA #$00
+0c16 : 85 13 __ STA P6
+0c18 : a9 19 __ LDA #$19
+0c1a : 85 16 __ STA P9
+0c1c : 60 __ __ RTS
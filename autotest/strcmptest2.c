@@ -10,6 +10,8 @@ int main(void)
 	assert(strcmp("abcdefgh", "abcdefghi") < 0);
 	assert(strcmp("abcdefghi", "abcdefgh") > 0);
 	assert(strcmp("abcdemgh", "abcdefgh") > 0);
+	assert(strcmp("abcd" "efgh", "abcdefgh") == 0);
+	assert(strlen("ab" "cd" "ef") == 6);
 
 	for(int i=0; i<1900; i++)
 	{
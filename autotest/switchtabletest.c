@@ -0,0 +1,145 @@
+#include <assert.h>
+
+int dense(int i)
+{
+	switch (i)
+	{
+	case 10: return 1;
+	case 11: return 2;
+	case 12: return 3;
+	case 13:
+	case 14: return 4;
+	case 16: return 5;
+	case 17: return 6;
+	case 19: return 7;
+	default: return 0;
+	}
+}
+
+int sparse(int i)
+{
+	switch (i)
+	{
+	case -1000: return 1;
+	case -3: return 2;
+	case -2: return 3;
+	case -1: return 4;
+	case 0: return 5;
+	case 1: return 6;
+	case 2: return 7;
+	case 4: return 8;
+	case 500: return 9;
+	case 20000: return 10;
+	default: return 0;
+	}
+}
+
+int ubyte(unsigned char c)
+{
+	switch (c)
+	{
+	case 200: return 1;
+	case 201: return 2;
+	case 202: return 3;
+	case 204: return 4;
+	case 205: return 5;
+	case 207: return 6;
+	case 255: return 7;
+	case 300: return 8;
+	case -1: return 9;
+	}
+	return 0;
+}
+
+int sbyte(signed char c)
+{
+	switch (c)
+	{
+	case -128: return 1;
+	case -127: return 2;
+	case -125: return 3;
+	case -124: return 4;
+	case -123: return 5;
+	case -122: return 6;
+	case 127: return 7;
+	case 200: return 8;
+	}
+	return 0;
+}
+
+int fallthrough(char c)
+{
+	int	n = 0;
+	switch (c)
+	{
+	case 0: n++;
+	case 1: n++;
+	case 2: n++;
+	case 3: n++;
+	case 4: n++;
+	case 5: n++;
+	default: n++;
+	}
+	return n;
+}
+
+int constsel(void)
+{
+	int	s = 3, r = 0;
+	switch (s)
+	{
+	case 0: r = 1; break;
+	case 1: r = 2; break;
+	case 2: r = 3; break;
+	case 3: r = 4; break;
+	case 4: r = 5; break;
+	case 5: r = 6; break;
+	case 6: r = 7; break;
+	}
+	return r;
+}
+
+int main(void)
+{
+	static const char dres[] = {0, 0, 1, 2, 3, 4, 4, 0, 5, 6, 0, 7, 0, 0};
+
+	for(int i=8; i<22; i++)
+		assert(dense(i) == dres[i - 8]);
+	assert(dense(-32768) == 0);
+	assert(dense(32767) == 0);
+
+	assert(sparse(-1000) == 1);
+	assert(sparse(-999) == 0);
+	assert(sparse(-4) == 0);
+	for(int i=-3; i<3; i++)
+		assert(sparse(i) == i + 5);
+	assert(sparse(3) == 0);
+	assert(sparse(4) == 8);
+	assert(sparse(500) == 9);
+	assert(sparse(20000) == 10);
+	assert(sparse(20001) == 0);
+
+	static const char ures[] = {1, 2, 3, 0, 4, 5, 0, 6, 0};
+	for(int i=0; i<9; i++)
+		assert(ubyte(200 + i) == ures[i]);
+	assert(ubyte(0) == 0);
+	assert(ubyte(44) == 0);
+	assert(ubyte(199) == 0);
+	assert(ubyte(255) == 7);
+
+	static const char sres[] = {1, 2, 0, 3, 4, 5, 6, 0};
+	for(int i=0; i<8; i++)
+		assert(sbyte(-128 + i) == sres[i]);
+	assert(sbyte(0) == 0);
+	assert(sbyte(127) == 7);
+	assert(sbyte(-56) == 0);
+
+	for(char c=0; c<6; c++)
+		assert(fallthrough(c) == 7 - c);
+	assert(fallthrough(6) == 1);
+	assert(fallthrough(255) == 1);
+
+	assert(constsel() == 4);
+
+	return 0;
+}
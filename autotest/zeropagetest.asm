@@ -0,0 +1,4007 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 18 26 STX $2618 ; (spentry + 0)
+0811 : a9 19 __ LDA #$19
+0813 : 85 19 __ STA IP + 0
+0815 : a9 26 __ LDA #$26
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 26 __ LDA #$26
+081c : e9 26 __ SBC #$26
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 19 __ LDA #$19
+0832 : e9 19 __ SBC #$19
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c a9 25 JMP $25a9 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 26 __ SBC #$26
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 25 __ LDY #$25
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 0a __ SBC #$0a
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T0 + 0
+0928 : 85 54 __ STA T0 + 1
+092a : a5 53 __ LDA T0 + 0
+092c : 85 1b __ STA ACCU + 0
+092e : a5 54 __ LDA T0 + 1
+0930 : 85 1c __ STA ACCU + 1
+0932 : a9 0b __ LDA #$0b
+0934 : 85 03 __ STA $03
+0936 : 20 b6 25 JSR $25b6 ; (mul16by8 + 0)
+0939 : a5 06 __ LDA $06
+093b : 29 80 __ AND #$80
+093d : 10 02 __ BPL $0941
+093f : a9 ff __ LDA #$ff
+0941 : aa __ __ TAX
+0942 : a5 05 __ LDA $05
+0944 : a0 02 __ LDY #$02
+0946 : 91 23 __ STA (SP + 0),y
+0948 : a5 06 __ LDA $06
+094a : c8 __ __ INY
+094b : 91 23 __ STA (SP + 0),y
+094d : 8a __ __ TXA
+094e : c8 __ __ INY
+094f : 91 23 __ STA (SP + 0),y
+0951 : c8 __ __ INY
+0952 : 91 23 __ STA (SP + 0),y
+0954 : 38 __ __ SEC
+0955 : a5 53 __ LDA T0 + 0
+0957 : e9 03 __ SBC #$03
+0959 : c8 __ __ INY
+095a : 91 23 __ STA (SP + 0),y
+095c : a5 54 __ LDA T0 + 1
+095e : e9 00 __ SBC #$00
+0960 : c8 __ __ INY
+0961 : 91 23 __ STA (SP + 0),y
+0963 : 29 80 __ AND #$80
+0965 : 10 02 __ BPL $0969
+0967 : a9 ff __ LDA #$ff
+0969 : c8 __ __ INY
+096a : 91 23 __ STA (SP + 0),y
+096c : c8 __ __ INY
+096d : 91 23 __ STA (SP + 0),y
+096f : 20 7b 1d JSR $1d7b ; (leaf + 0)
+0972 : a5 1b __ LDA ACCU + 0
+0974 : 85 57 __ STA T2 + 0
+0976 : a5 1c __ LDA ACCU + 1
+0978 : 85 58 __ STA T2 + 1
+097a : a5 1d __ LDA ACCU + 2
+097c : 85 59 __ STA T2 + 2
+097e : a5 1e __ LDA ACCU + 3
+0980 : 85 5a __ STA T2 + 3
+0982 : a5 53 __ LDA T0 + 0
+0984 : 85 1b __ STA ACCU + 0
+0986 : a5 54 __ LDA T0 + 1
+0988 : 85 1c __ STA ACCU + 1
+098a : a9 0b __ LDA #$0b
+098c : 85 03 __ STA $03
+098e : 20 b6 25 JSR $25b6 ; (mul16by8 + 0)
+0991 : a5 06 __ LDA $06
+0993 : 85 1c __ STA ACCU + 1
+0995 : 29 80 __ AND #$80
+0997 : 10 02 __ BPL $099b
+0999 : a9 ff __ LDA #$ff
+099b : aa __ __ TAX
+099c : 85 1d __ STA ACCU + 2
+099e : a5 05 __ LDA $05
+09a0 : 85 1b __ STA ACCU + 0
+09a2 : 8a __ __ TXA
+09a3 : 86 1e __ STX ACCU + 3
+09a5 : a9 06 __ LDA #$06
+09a7 : 85 03 __ STA $03
+09a9 : a9 00 __ LDA #$00
+09ab : 85 04 __ STA $04
+09ad : 85 05 __ STA $05
+09af : 85 06 __ STA $06
+09b1 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+09b4 : a5 07 __ LDA $07
+09b6 : 85 5b __ STA T3 + 0
+09b8 : a5 08 __ LDA $08
+09ba : 85 5c __ STA T3 + 1
+09bc : a5 09 __ LDA $09
+09be : 85 5d __ STA T3 + 2
+09c0 : a5 0a __ LDA $0a
+09c2 : 85 5e __ STA T3 + 3
+09c4 : 38 __ __ SEC
+09c5 : a5 53 __ LDA T0 + 0
+09c7 : e9 03 __ SBC #$03
+09c9 : 85 5f __ STA T4 + 0
+09cb : a5 54 __ LDA T0 + 1
+09cd : e9 00 __ SBC #$00
+09cf : 85 60 __ STA T4 + 1
+09d1 : 29 80 __ AND #$80
+09d3 : 10 02 __ BPL $09d7
+09d5 : a9 ff __ LDA #$ff
+09d7 : 85 61 __ STA T4 + 2
+09d9 : a2 02 __ LDX #$02
+09db : 06 5f __ ASL T4 + 0
+09dd : 26 60 __ ROL T4 + 1
+09df : 26 61 __ ROL T4 + 2
+09e1 : 2a __ __ ROL
+09e2 : ca __ __ DEX
+09e3 : d0 f6 __ BNE $09db
+09e5 : 85 62 __ STA T4 + 3
+09e7 : 38 __ __ SEC
+09e8 : a5 5b __ LDA T3 + 0
+09ea : e5 5f __ SBC T4 + 0
+09ec : 85 5b __ STA T3 + 0
+09ee : a5 5c __ LDA T3 + 1
+09f0 : e5 60 __ SBC T4 + 1
+09f2 : 85 5c __ STA T3 + 1
+09f4 : a5 5d __ LDA T3 + 2
+09f6 : e5 61 __ SBC T4 + 2
+09f8 : 85 5d __ STA T3 + 2
+09fa : a5 5e __ LDA T3 + 3
+09fc : e5 62 __ SBC T4 + 3
+09fe : 85 5e __ STA T3 + 3
+0a00 : a5 5a __ LDA T2 + 3
+0a02 : c5 5e __ CMP T3 + 3
+0a04 : d0 12 __ BNE $0a18
+0a06 : a5 59 __ LDA T2 + 2
+0a08 : c5 5d __ CMP T3 + 2
+0a0a : d0 0c __ BNE $0a18
+0a0c : a5 58 __ LDA T2 + 1
+0a0e : c5 5c __ CMP T3 + 1
+0a10 : d0 06 __ BNE $0a18
+0a12 : a5 57 __ LDA T2 + 0
+0a14 : c5 5b __ CMP T3 + 0
+0a16 : f0 09 __ BEQ $0a21
+0a18 : a9 ff __ LDA #$ff
+0a1a : 85 0d __ STA P0
+0a1c : 85 0e __ STA P1
+0a1e : 20 62 1e JSR $1e62 ; (exit + 0)
+0a21 : a5 54 __ LDA T0 + 1
+0a23 : 29 80 __ AND #$80
+0a25 : 10 02 __ BPL $0a29
+0a27 : a9 ff __ LDA #$ff
+0a29 : aa __ __ TAX
+0a2a : a5 53 __ LDA T0 + 0
+0a2c : a0 02 __ LDY #$02
+0a2e : 91 23 __ STA (SP + 0),y
+0a30 : a5 54 __ LDA T0 + 1
+0a32 : c8 __ __ INY
+0a33 : 91 23 __ STA (SP + 0),y
+0a35 : 8a __ __ TXA
+0a36 : c8 __ __ INY
+0a37 : 91 23 __ STA (SP + 0),y
+0a39 : c8 __ __ INY
+0a3a : 91 23 __ STA (SP + 0),y
+0a3c : 38 __ __ SEC
+0a3d : a9 11 __ LDA #$11
+0a3f : e5 53 __ SBC T0 + 0
+0a41 : c8 __ __ INY
+0a42 : 91 23 __ STA (SP + 0),y
+0a44 : a9 00 __ LDA #$00
+0a46 : e5 54 __ SBC T0 + 1
+0a48 : c8 __ __ INY
+0a49 : 91 23 __ STA (SP + 0),y
+0a4b : 29 80 __ AND #$80
+0a4d : 10 02 __ BPL $0a51
+0a4f : a9 ff __ LDA #$ff
+0a51 : c8 __ __ INY
+0a52 : 91 23 __ STA (SP + 0),y
+0a54 : c8 __ __ INY
+0a55 : 91 23 __ STA (SP + 0),y
+0a57 : 20 77 1e JSR $1e77 ; (middle + 0)
+0a5a : a5 1b __ LDA ACCU + 0
+0a5c : 85 57 __ STA T2 + 0
+0a5e : a5 1c __ LDA ACCU + 1
+0a60 : 85 58 __ STA T2 + 1
+0a62 : a5 1d __ LDA ACCU + 2
+0a64 : 85 59 __ STA T2 + 2
+0a66 : a5 1e __ LDA ACCU + 3
+0a68 : 85 5a __ STA T2 + 3
+0a6a : a9 00 __ LDA #$00
+0a6c : 85 55 __ STA T1 + 0
+0a6e : 85 56 __ STA T1 + 1
+0a70 : 38 __ __ SEC
+0a71 : a9 11 __ LDA #$11
+0a73 : e5 53 __ SBC T0 + 0
+0a75 : 85 44 __ STA T6 + 0
+0a77 : 85 1b __ STA ACCU + 0
+0a79 : a9 00 __ LDA #$00
+0a7b : e5 54 __ SBC T0 + 1
+0a7d : 85 45 __ STA T6 + 1
+0a7f : 85 1c __ STA ACCU + 1
+0a81 : 29 80 __ AND #$80
+0a83 : 10 02 __ BPL $0a87
+0a85 : a9 ff __ LDA #$ff
+0a87 : 85 5d __ STA T3 + 2
+0a89 : a5 54 __ LDA T0 + 1
+0a8b : 29 80 __ AND #$80
+0a8d : 10 02 __ BPL $0a91
+0a8f : a9 ff __ LDA #$ff
+0a91 : 85 61 __ STA T4 + 2
+0a93 : 85 62 __ STA T4 + 3
+0a95 : 38 __ __ SEC
+0a96 : a5 53 __ LDA T0 + 0
+0a98 : e5 44 __ SBC T6 + 0
+0a9a : 85 63 __ STA T7 + 0
+0a9c : a5 54 __ LDA T0 + 1
+0a9e : e5 45 __ SBC T6 + 1
+0aa0 : 85 64 __ STA T7 + 1
+0aa2 : a5 61 __ LDA T4 + 2
+0aa4 : e5 5d __ SBC T3 + 2
+0aa6 : 85 65 __ STA T7 + 2
+0aa8 : a5 61 __ LDA T4 + 2
+0aaa : e5 5d __ SBC T3 + 2
+0aac : 85 66 __ STA T7 + 3
+0aae : a5 5d __ LDA T3 + 2
+0ab0 : 85 1d __ STA ACCU + 2
+0ab2 : 85 1e __ STA ACCU + 3
+0ab4 : a9 03 __ LDA #$03
+0ab6 : 85 03 __ STA $03
+0ab8 : a9 00 __ LDA #$00
+0aba : 85 04 __ STA $04
+0abc : 85 05 __ STA $05
+0abe : 85 06 __ STA $06
+0ac0 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0ac3 : a5 07 __ LDA $07
+0ac5 : 85 5b __ STA T3 + 0
+0ac7 : a5 08 __ LDA $08
+0ac9 : 85 5c __ STA T3 + 1
+0acb : a5 09 __ LDA $09
+0acd : 85 5d __ STA T3 + 2
+0acf : a5 0a __ LDA $0a
+0ad1 : 85 5e __ STA T3 + 3
+0ad3 : 18 __ __ CLC
+0ad4 : a5 53 __ LDA T0 + 0
+0ad6 : 69 01 __ ADC #$01
+0ad8 : 85 5f __ STA T4 + 0
+0ada : a5 54 __ LDA T0 + 1
+0adc : 69 00 __ ADC #$00
+0ade : 85 60 __ STA T4 + 1
+0ae0 : a5 61 __ LDA T4 + 2
+0ae2 : 69 00 __ ADC #$00
+0ae4 : 85 61 __ STA T4 + 2
+0ae6 : 90 02 __ BCC $0aea
+0ae8 : e6 62 __ INC T4 + 3
+0aea : a5 55 __ LDA T1 + 0
+0aec : 85 67 __ STA T8 + 0
+0aee : a5 56 __ LDA T1 + 1
+0af0 : 85 68 __ STA T8 + 1
+0af2 : 29 80 __ AND #$80
+0af4 : 10 02 __ BPL $0af8
+0af6 : a9 ff __ LDA #$ff
+0af8 : 85 69 __ STA T8 + 2
+0afa : 85 6a __ STA T8 + 3
+0afc : e6 55 __ INC T1 + 0
+0afe : d0 02 __ BNE $0b02
+0b00 : e6 56 __ INC T1 + 1
+0b02 : a9 06 __ LDA #$06
+0b04 : 85 1b __ STA ACCU + 0
+0b06 : a9 00 __ LDA #$00
+0b08 : 85 1c __ STA ACCU + 1
+0b0a : 85 1d __ STA ACCU + 2
+0b0c : 85 1e __ STA ACCU + 3
+0b0e : a5 67 __ LDA T8 + 0
+0b10 : 85 03 __ STA $03
+0b12 : a5 68 __ LDA T8 + 1
+0b14 : 85 04 __ STA $04
+0b16 : a5 69 __ LDA T8 + 2
+0b18 : 85 05 __ STA $05
+0b1a : 85 06 __ STA $06
+0b1c : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0b1f : a5 07 __ LDA $07
+0b21 : 85 46 __ STA T9 + 0
+0b23 : a5 08 __ LDA $08
+0b25 : 85 47 __ STA T9 + 1
+0b27 : a5 09 __ LDA $09
+0b29 : 85 48 __ STA T9 + 2
+0b2b : a5 0a __ LDA $0a
+0b2d : 85 49 __ STA T9 + 3
+0b2f : a9 06 __ LDA #$06
+0b31 : 85 1b __ STA ACCU + 0
+0b33 : a9 00 __ LDA #$00
+0b35 : 85 1c __ STA ACCU + 1
+0b37 : 85 1d __ STA ACCU + 2
+0b39 : 85 1e __ STA ACCU + 3
+0b3b : a5 5b __ LDA T3 + 0
+0b3d : 85 03 __ STA $03
+0b3f : a5 5c __ LDA T3 + 1
+0b41 : 85 04 __ STA $04
+0b43 : a5 5d __ LDA T3 + 2
+0b45 : 85 05 __ STA $05
+0b47 : a5 5e __ LDA T3 + 3
+0b49 : 85 06 __ STA $06
+0b4b : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0b4e : a5 07 __ LDA $07
+0b50 : 85 4a __ STA T10 + 0
+0b52 : a5 08 __ LDA $08
+0b54 : 85 4b __ STA T10 + 1
+0b56 : a5 09 __ LDA $09
+0b58 : 85 4c __ STA T10 + 2
+0b5a : a5 0a __ LDA $0a
+0b5c : 85 4d __ STA T10 + 3
+0b5e : a5 63 __ LDA T7 + 0
+0b60 : 85 4e __ STA T11 + 0
+0b62 : a5 64 __ LDA T7 + 1
+0b64 : 85 4f __ STA T11 + 1
+0b66 : a5 65 __ LDA T7 + 2
+0b68 : 85 50 __ STA T11 + 2
+0b6a : a5 66 __ LDA T7 + 3
+0b6c : a2 02 __ LDX #$02
+0b6e : 06 4e __ ASL T11 + 0
+0b70 : 26 4f __ ROL T11 + 1
+0b72 : 26 50 __ ROL T11 + 2
+0b74 : 2a __ __ ROL
+0b75 : ca __ __ DEX
+0b76 : d0 f6 __ BNE $0b6e
+0b78 : 85 51 __ STA T11 + 3
+0b7a : 38 __ __ SEC
+0b7b : a5 4a __ LDA T10 + 0
+0b7d : e5 4e __ SBC T11 + 0
+0b7f : aa __ __ TAX
+0b80 : a5 4b __ LDA T10 + 1
+0b82 : e5 4f __ SBC T11 + 1
+0b84 : a8 __ __ TAY
+0b85 : a5 4c __ LDA T10 + 2
+0b87 : e5 50 __ SBC T11 + 2
+0b89 : 85 4c __ STA T10 + 2
+0b8b : a5 4d __ LDA T10 + 3
+0b8d : e5 51 __ SBC T11 + 3
+0b8f : 85 4d __ STA T10 + 3
+0b91 : 18 __ __ CLC
+0b92 : 8a __ __ TXA
+0b93 : 65 5f __ ADC T4 + 0
+0b95 : 85 5f __ STA T4 + 0
+0b97 : 85 1b __ STA ACCU + 0
+0b99 : 98 __ __ TYA
+0b9a : 65 60 __ ADC T4 + 1
+0b9c : 85 60 __ STA T4 + 1
+0b9e : 85 1c __ STA ACCU + 1
+0ba0 : a5 4c __ LDA T10 + 2
+0ba2 : 65 61 __ ADC T4 + 2
+0ba4 : 85 61 __ STA T4 + 2
+0ba6 : 85 1d __ STA ACCU + 2
+0ba8 : a5 4d __ LDA T10 + 3
+0baa : 65 62 __ ADC T4 + 3
+0bac : 85 62 __ STA T4 + 3
+0bae : 85 1e __ STA ACCU + 3
+0bb0 : a9 06 __ LDA #$06
+0bb2 : 85 03 __ STA $03
+0bb4 : a9 00 __ LDA #$00
+0bb6 : 85 04 __ STA $04
+0bb8 : 85 05 __ STA $05
+0bba : 85 06 __ STA $06
+0bbc : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0bbf : a5 07 __ LDA $07
+0bc1 : 85 4a __ STA T10 + 0
+0bc3 : a5 08 __ LDA $08
+0bc5 : 85 4b __ STA T10 + 1
+0bc7 : a5 09 __ LDA $09
+0bc9 : 85 4c __ STA T10 + 2
+0bcb : a5 0a __ LDA $0a
+0bcd : 85 4d __ STA T10 + 3
+0bcf : a5 6a __ LDA T8 + 3
+0bd1 : a2 02 __ LDX #$02
+0bd3 : 06 67 __ ASL T8 + 0
+0bd5 : 26 68 __ ROL T8 + 1
+0bd7 : 26 69 __ ROL T8 + 2
+0bd9 : 2a __ __ ROL
+0bda : ca __ __ DEX
+0bdb : d0 f6 __ BNE $0bd3
+0bdd : 85 6a __ STA T8 + 3
+0bdf : 38 __ __ SEC
+0be0 : a5 4a __ LDA T10 + 0
+0be2 : e5 67 __ SBC T8 + 0
+0be4 : aa __ __ TAX
+0be5 : a5 4b __ LDA T10 + 1
+0be7 : e5 68 __ SBC T8 + 1
+0be9 : a8 __ __ TAY
+0bea : a5 4c __ LDA T10 + 2
+0bec : e5 69 __ SBC T8 + 2
+0bee : 85 69 __ STA T8 + 2
+0bf0 : a5 4d __ LDA T10 + 3
+0bf2 : e5 6a __ SBC T8 + 3
+0bf4 : 85 6a __ STA T8 + 3
+0bf6 : 18 __ __ CLC
+0bf7 : 8a __ __ TXA
+0bf8 : 65 5b __ ADC T3 + 0
+0bfa : 85 5b __ STA T3 + 0
+0bfc : 85 67 __ STA T8 + 0
+0bfe : 98 __ __ TYA
+0bff : 65 5c __ ADC T3 + 1
+0c01 : 85 5c __ STA T3 + 1
+0c03 : 85 68 __ STA T8 + 1
+0c05 : a5 69 __ LDA T8 + 2
+0c07 : 65 5d __ ADC T3 + 2
+0c09 : 85 5d __ STA T3 + 2
+0c0b : 85 69 __ STA T8 + 2
+0c0d : a5 6a __ LDA T8 + 3
+0c0f : 65 5e __ ADC T3 + 3
+0c11 : 85 5e __ STA T3 + 3
+0c13 : a2 02 __ LDX #$02
+0c15 : 06 67 __ ASL T8 + 0
+0c17 : 26 68 __ ROL T8 + 1
+0c19 : 26 69 __ ROL T8 + 2
+0c1b : 2a __ __ ROL
+0c1c : ca __ __ DEX
+0c1d : d0 f6 __ BNE $0c15
+0c1f : 85 6a __ STA T8 + 3
+0c21 : 38 __ __ SEC
+0c22 : a5 46 __ LDA T9 + 0
+0c24 : e5 67 __ SBC T8 + 0
+0c26 : 85 67 __ STA T8 + 0
+0c28 : a5 47 __ LDA T9 + 1
+0c2a : e5 68 __ SBC T8 + 1
+0c2c : 85 68 __ STA T8 + 1
+0c2e : a5 48 __ LDA T9 + 2
+0c30 : e5 69 __ SBC T8 + 2
+0c32 : 85 69 __ STA T8 + 2
+0c34 : a5 49 __ LDA T9 + 3
+0c36 : e5 6a __ SBC T8 + 3
+0c38 : 85 6a __ STA T8 + 3
+0c3a : 38 __ __ SEC
+0c3b : a5 63 __ LDA T7 + 0
+0c3d : e5 67 __ SBC T8 + 0
+0c3f : 85 63 __ STA T7 + 0
+0c41 : a5 64 __ LDA T7 + 1
+0c43 : e5 68 __ SBC T8 + 1
+0c45 : 85 64 __ STA T7 + 1
+0c47 : a5 65 __ LDA T7 + 2
+0c49 : e5 69 __ SBC T8 + 2
+0c4b : 85 65 __ STA T7 + 2
+0c4d : a5 66 __ LDA T7 + 3
+0c4f : e5 6a __ SBC T8 + 3
+0c51 : 85 66 __ STA T7 + 3
+0c53 : a5 56 __ LDA T1 + 1
+0c55 : 10 03 __ BPL $0c5a
+0c57 : 4c ea 0a JMP $0aea ; (main + 490)
+0c5a : d0 09 __ BNE $0c65
+0c5c : a5 55 __ LDA T1 + 0
+0c5e : c9 03 __ CMP #$03
+0c60 : b0 03 __ BCS $0c65
+0c62 : 4c ea 0a JMP $0aea ; (main + 490)
+0c65 : a5 5f __ LDA T4 + 0
+0c67 : 45 5b __ EOR T3 + 0
+0c69 : aa __ __ TAX
+0c6a : a5 60 __ LDA T4 + 1
+0c6c : 45 5c __ EOR T3 + 1
+0c6e : a8 __ __ TAY
+0c6f : a5 61 __ LDA T4 + 2
+0c71 : 45 5d __ EOR T3 + 2
+0c73 : 85 5d __ STA T3 + 2
+0c75 : a5 62 __ LDA T4 + 3
+0c77 : 45 5e __ EOR T3 + 3
+0c79 : 85 5e __ STA T3 + 3
+0c7b : 8a __ __ TXA
+0c7c : 45 63 __ EOR T7 + 0
+0c7e : 85 5b __ STA T3 + 0
+0c80 : 98 __ __ TYA
+0c81 : 45 64 __ EOR T7 + 1
+0c83 : 85 5c __ STA T3 + 1
+0c85 : a5 5d __ LDA T3 + 2
+0c87 : 45 65 __ EOR T7 + 2
+0c89 : 85 5d __ STA T3 + 2
+0c8b : a5 5e __ LDA T3 + 3
+0c8d : 45 66 __ EOR T7 + 3
+0c8f : 85 5e __ STA T3 + 3
+0c91 : a5 5a __ LDA T2 + 3
+0c93 : c5 5e __ CMP T3 + 3
+0c95 : d0 12 __ BNE $0ca9
+0c97 : a5 59 __ LDA T2 + 2
+0c99 : c5 5d __ CMP T3 + 2
+0c9b : d0 0c __ BNE $0ca9
+0c9d : a5 58 __ LDA T2 + 1
+0c9f : c5 5c __ CMP T3 + 1
+0ca1 : d0 06 __ BNE $0ca9
+0ca3 : a5 57 __ LDA T2 + 0
+0ca5 : c5 5b __ CMP T3 + 0
+0ca7 : f0 09 __ BEQ $0cb2
+0ca9 : a9 ff __ LDA #$ff
+0cab : 85 0d __ STA P0
+0cad : 85 0e __ STA P1
+0caf : 20 62 1e JSR $1e62 ; (exit + 0)
+0cb2 : a9 00 __ LDA #$00
+0cb4 : 85 57 __ STA T2 + 0
+0cb6 : 85 58 __ STA T2 + 1
+0cb8 : 85 59 __ STA T2 + 2
+0cba : 85 5a __ STA T2 + 3
+0cbc : 85 55 __ STA T1 + 0
+0cbe : 85 56 __ STA T1 + 1
+0cc0 : a5 53 __ LDA T0 + 0
+0cc2 : 0a __ __ ASL
+0cc3 : 85 07 __ STA $07
+0cc5 : a5 54 __ LDA T0 + 1
+0cc7 : 2a __ __ ROL
+0cc8 : 85 08 __ STA $08
+0cca : 18 __ __ CLC
+0ccb : a5 07 __ LDA $07
+0ccd : 65 53 __ ADC T0 + 0
+0ccf : 85 1b __ STA ACCU + 0
+0cd1 : a5 08 __ LDA $08
+0cd3 : 65 54 __ ADC T0 + 1
+0cd5 : 85 1c __ STA ACCU + 1
+0cd7 : 38 __ __ SEC
+0cd8 : a5 1b __ LDA ACCU + 0
+0cda : e9 04 __ SBC #$04
+0cdc : aa __ __ TAX
+0cdd : 85 1b __ STA ACCU + 0
+0cdf : a5 1c __ LDA ACCU + 1
+0ce1 : e9 00 __ SBC #$00
+0ce3 : a8 __ __ TAY
+0ce4 : 29 80 __ AND #$80
+0ce6 : 10 02 __ BPL $0cea
+0ce8 : a9 ff __ LDA #$ff
+0cea : 85 5d __ STA T3 + 2
+0cec : 38 __ __ SEC
+0ced : 8a __ __ TXA
+0cee : e9 05 __ SBC #$05
+0cf0 : 85 5f __ STA T4 + 0
+0cf2 : 98 __ __ TYA
+0cf3 : 84 1c __ STY ACCU + 1
+0cf5 : e9 00 __ SBC #$00
+0cf7 : 85 60 __ STA T4 + 1
+0cf9 : a5 5d __ LDA T3 + 2
+0cfb : e9 00 __ SBC #$00
+0cfd : 85 61 __ STA T4 + 2
+0cff : a5 5d __ LDA T3 + 2
+0d01 : e9 00 __ SBC #$00
+0d03 : 85 62 __ STA T4 + 3
+0d05 : a5 5d __ LDA T3 + 2
+0d07 : 85 1d __ STA ACCU + 2
+0d09 : 85 1e __ STA ACCU + 3
+0d0b : a9 07 __ LDA #$07
+0d0d : 85 03 __ STA $03
+0d0f : a9 00 __ LDA #$00
+0d11 : 85 04 __ STA $04
+0d13 : 85 05 __ STA $05
+0d15 : 85 06 __ STA $06
+0d17 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0d1a : a5 07 __ LDA $07
+0d1c : 85 5b __ STA T3 + 0
+0d1e : a5 08 __ LDA $08
+0d20 : 85 5c __ STA T3 + 1
+0d22 : a5 09 __ LDA $09
+0d24 : 85 5d __ STA T3 + 2
+0d26 : a5 0a __ LDA $0a
+0d28 : 85 5e __ STA T3 + 3
+0d2a : a5 5b __ LDA T3 + 0
+0d2c : a0 02 __ LDY #$02
+0d2e : 91 23 __ STA (SP + 0),y
+0d30 : a5 5c __ LDA T3 + 1
+0d32 : c8 __ __ INY
+0d33 : 91 23 __ STA (SP + 0),y
+0d35 : a5 5d __ LDA T3 + 2
+0d37 : c8 __ __ INY
+0d38 : 91 23 __ STA (SP + 0),y
+0d3a : a5 5e __ LDA T3 + 3
+0d3c : c8 __ __ INY
+0d3d : 91 23 __ STA (SP + 0),y
+0d3f : a5 5f __ LDA T4 + 0
+0d41 : c8 __ __ INY
+0d42 : 91 23 __ STA (SP + 0),y
+0d44 : a5 60 __ LDA T4 + 1
+0d46 : c8 __ __ INY
+0d47 : 91 23 __ STA (SP + 0),y
+0d49 : a5 61 __ LDA T4 + 2
+0d4b : c8 __ __ INY
+0d4c : 91 23 __ STA (SP + 0),y
+0d4e : a5 62 __ LDA T4 + 3
+0d50 : c8 __ __ INY
+0d51 : 91 23 __ STA (SP + 0),y
+0d53 : 20 77 1e JSR $1e77 ; (middle + 0)
+0d56 : 18 __ __ CLC
+0d57 : a5 1b __ LDA ACCU + 0
+0d59 : 65 57 __ ADC T2 + 0
+0d5b : 85 63 __ STA T7 + 0
+0d5d : a5 1c __ LDA ACCU + 1
+0d5f : 65 58 __ ADC T2 + 1
+0d61 : 85 64 __ STA T7 + 1
+0d63 : a5 1d __ LDA ACCU + 2
+0d65 : 65 59 __ ADC T2 + 2
+0d67 : 85 65 __ STA T7 + 2
+0d69 : a5 1e __ LDA ACCU + 3
+0d6b : 65 5a __ ADC T2 + 3
+0d6d : 85 66 __ STA T7 + 3
+0d6f : a5 63 __ LDA T7 + 0
+0d71 : 85 57 __ STA T2 + 0
+0d73 : a0 02 __ LDY #$02
+0d75 : 91 23 __ STA (SP + 0),y
+0d77 : a5 64 __ LDA T7 + 1
+0d79 : 85 58 __ STA T2 + 1
+0d7b : c8 __ __ INY
+0d7c : 91 23 __ STA (SP + 0),y
+0d7e : a5 65 __ LDA T7 + 2
+0d80 : 85 59 __ STA T2 + 2
+0d82 : c8 __ __ INY
+0d83 : 91 23 __ STA (SP + 0),y
+0d85 : a5 66 __ LDA T7 + 3
+0d87 : 85 5a __ STA T2 + 3
+0d89 : c8 __ __ INY
+0d8a : 91 23 __ STA (SP + 0),y
+0d8c : a5 5f __ LDA T4 + 0
+0d8e : c8 __ __ INY
+0d8f : 91 23 __ STA (SP + 0),y
+0d91 : a5 60 __ LDA T4 + 1
+0d93 : c8 __ __ INY
+0d94 : 91 23 __ STA (SP + 0),y
+0d96 : a5 61 __ LDA T4 + 2
+0d98 : c8 __ __ INY
+0d99 : 91 23 __ STA (SP + 0),y
+0d9b : a5 62 __ LDA T4 + 3
+0d9d : c8 __ __ INY
+0d9e : 91 23 __ STA (SP + 0),y
+0da0 : 20 7b 1d JSR $1d7b ; (leaf + 0)
+0da3 : a5 63 __ LDA T7 + 0
+0da5 : a0 02 __ LDY #$02
+0da7 : 91 23 __ STA (SP + 0),y
+0da9 : a5 64 __ LDA T7 + 1
+0dab : c8 __ __ INY
+0dac : 91 23 __ STA (SP + 0),y
+0dae : a5 65 __ LDA T7 + 2
+0db0 : c8 __ __ INY
+0db1 : 91 23 __ STA (SP + 0),y
+0db3 : a5 66 __ LDA T7 + 3
+0db5 : c8 __ __ INY
+0db6 : 91 23 __ STA (SP + 0),y
+0db8 : 18 __ __ CLC
+0db9 : a5 5b __ LDA T3 + 0
+0dbb : 65 1b __ ADC ACCU + 0
+0dbd : 85 67 __ STA T8 + 0
+0dbf : a5 5c __ LDA T3 + 1
+0dc1 : 65 1c __ ADC ACCU + 1
+0dc3 : 85 68 __ STA T8 + 1
+0dc5 : a5 5d __ LDA T3 + 2
+0dc7 : 65 1d __ ADC ACCU + 2
+0dc9 : 85 69 __ STA T8 + 2
+0dcb : a5 5e __ LDA T3 + 3
+0dcd : 65 1e __ ADC ACCU + 3
+0dcf : 85 6a __ STA T8 + 3
+0dd1 : a5 67 __ LDA T8 + 0
+0dd3 : 85 5b __ STA T3 + 0
+0dd5 : c8 __ __ INY
+0dd6 : 91 23 __ STA (SP + 0),y
+0dd8 : a5 68 __ LDA T8 + 1
+0dda : 85 5c __ STA T3 + 1
+0ddc : c8 __ __ INY
+0ddd : 91 23 __ STA (SP + 0),y
+0ddf : a5 69 __ LDA T8 + 2
+0de1 : 85 5d __ STA T3 + 2
+0de3 : c8 __ __ INY
+0de4 : 91 23 __ STA (SP + 0),y
+0de6 : a5 6a __ LDA T8 + 3
+0de8 : 85 5e __ STA T3 + 3
+0dea : c8 __ __ INY
+0deb : 91 23 __ STA (SP + 0),y
+0ded : 20 77 1e JSR $1e77 ; (middle + 0)
+0df0 : e6 55 __ INC T1 + 0
+0df2 : d0 02 __ BNE $0df6
+0df4 : e6 56 __ INC T1 + 1
+0df6 : a5 1b __ LDA ACCU + 0
+0df8 : 45 5f __ EOR T4 + 0
+0dfa : 85 5f __ STA T4 + 0
+0dfc : a5 1c __ LDA ACCU + 1
+0dfe : 45 60 __ EOR T4 + 1
+0e00 : 85 60 __ STA T4 + 1
+0e02 : a5 1d __ LDA ACCU + 2
+0e04 : 45 61 __ EOR T4 + 2
+0e06 : 85 61 __ STA T4 + 2
+0e08 : a5 1e __ LDA ACCU + 3
+0e0a : 45 62 __ EOR T4 + 3
+0e0c : 85 62 __ STA T4 + 3
+0e0e : a5 56 __ LDA T1 + 1
+0e10 : 10 03 __ BPL $0e15
+0e12 : 4c 2a 0d JMP $0d2a ; (main + 1066)
+0e15 : d0 09 __ BNE $0e20
+0e17 : a5 55 __ LDA T1 + 0
+0e19 : c9 03 __ CMP #$03
+0e1b : b0 03 __ BCS $0e20
+0e1d : 4c 2a 0d JMP $0d2a ; (main + 1066)
+0e20 : a9 00 __ LDA #$00
+0e22 : 85 57 __ STA T2 + 0
+0e24 : 85 58 __ STA T2 + 1
+0e26 : 85 59 __ STA T2 + 2
+0e28 : 85 5a __ STA T2 + 3
+0e2a : 85 55 __ STA T1 + 0
+0e2c : 85 56 __ STA T1 + 1
+0e2e : a5 53 __ LDA T0 + 0
+0e30 : 0a __ __ ASL
+0e31 : 85 07 __ STA $07
+0e33 : a5 54 __ LDA T0 + 1
+0e35 : 2a __ __ ROL
+0e36 : 85 08 __ STA $08
+0e38 : 18 __ __ CLC
+0e39 : a5 07 __ LDA $07
+0e3b : 65 53 __ ADC T0 + 0
+0e3d : 85 1b __ STA ACCU + 0
+0e3f : a5 08 __ LDA $08
+0e41 : 65 54 __ ADC T0 + 1
+0e43 : 85 1c __ STA ACCU + 1
+0e45 : 38 __ __ SEC
+0e46 : a5 1b __ LDA ACCU + 0
+0e48 : e9 04 __ SBC #$04
+0e4a : aa __ __ TAX
+0e4b : 85 1b __ STA ACCU + 0
+0e4d : a5 1c __ LDA ACCU + 1
+0e4f : e9 00 __ SBC #$00
+0e51 : a8 __ __ TAY
+0e52 : 29 80 __ AND #$80
+0e54 : 10 02 __ BPL $0e58
+0e56 : a9 ff __ LDA #$ff
+0e58 : 85 5d __ STA T3 + 2
+0e5a : 38 __ __ SEC
+0e5b : 8a __ __ TXA
+0e5c : e9 05 __ SBC #$05
+0e5e : 85 46 __ STA T9 + 0
+0e60 : 98 __ __ TYA
+0e61 : 84 1c __ STY ACCU + 1
+0e63 : e9 00 __ SBC #$00
+0e65 : 85 47 __ STA T9 + 1
+0e67 : a5 5d __ LDA T3 + 2
+0e69 : e9 00 __ SBC #$00
+0e6b : 85 48 __ STA T9 + 2
+0e6d : a5 5d __ LDA T3 + 2
+0e6f : e9 00 __ SBC #$00
+0e71 : 85 49 __ STA T9 + 3
+0e73 : a5 5d __ LDA T3 + 2
+0e75 : 85 1d __ STA ACCU + 2
+0e77 : 85 1e __ STA ACCU + 3
+0e79 : a9 07 __ LDA #$07
+0e7b : 85 03 __ STA $03
+0e7d : a9 00 __ LDA #$00
+0e7f : 85 04 __ STA $04
+0e81 : 85 05 __ STA $05
+0e83 : 85 06 __ STA $06
+0e85 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0e88 : a5 07 __ LDA $07
+0e8a : 85 5b __ STA T3 + 0
+0e8c : a5 08 __ LDA $08
+0e8e : 85 5c __ STA T3 + 1
+0e90 : a5 09 __ LDA $09
+0e92 : 85 5d __ STA T3 + 2
+0e94 : a5 0a __ LDA $0a
+0e96 : 85 5e __ STA T3 + 3
+0e98 : 18 __ __ CLC
+0e99 : a5 67 __ LDA T8 + 0
+0e9b : 65 5f __ ADC T4 + 0
+0e9d : aa __ __ TAX
+0e9e : a5 68 __ LDA T8 + 1
+0ea0 : 65 60 __ ADC T4 + 1
+0ea2 : a8 __ __ TAY
+0ea3 : a5 69 __ LDA T8 + 2
+0ea5 : 65 61 __ ADC T4 + 2
+0ea7 : 85 61 __ STA T4 + 2
+0ea9 : a5 6a __ LDA T8 + 3
+0eab : 65 62 __ ADC T4 + 3
+0ead : 85 62 __ STA T4 + 3
+0eaf : 18 __ __ CLC
+0eb0 : 8a __ __ TXA
+0eb1 : 65 63 __ ADC T7 + 0
+0eb3 : 85 5f __ STA T4 + 0
+0eb5 : 98 __ __ TYA
+0eb6 : 65 64 __ ADC T7 + 1
+0eb8 : 85 60 __ STA T4 + 1
+0eba : a5 61 __ LDA T4 + 2
+0ebc : 65 65 __ ADC T7 + 2
+0ebe : 85 61 __ STA T4 + 2
+0ec0 : a5 62 __ LDA T4 + 3
+0ec2 : 65 66 __ ADC T7 + 3
+0ec4 : 85 62 __ STA T4 + 3
+0ec6 : a9 00 __ LDA #$00
+0ec8 : 85 44 __ STA T6 + 0
+0eca : 85 45 __ STA T6 + 1
+0ecc : 38 __ __ SEC
+0ecd : a5 5b __ LDA T3 + 0
+0ecf : e5 46 __ SBC T9 + 0
+0ed1 : 85 63 __ STA T7 + 0
+0ed3 : a5 5c __ LDA T3 + 1
+0ed5 : e5 47 __ SBC T9 + 1
+0ed7 : 85 64 __ STA T7 + 1
+0ed9 : a5 5d __ LDA T3 + 2
+0edb : e5 48 __ SBC T9 + 2
+0edd : 85 65 __ STA T7 + 2
+0edf : a5 5e __ LDA T3 + 3
+0ee1 : e5 49 __ SBC T9 + 3
+0ee3 : 85 66 __ STA T7 + 3
+0ee5 : a5 46 __ LDA T9 + 0
+0ee7 : 85 1b __ STA ACCU + 0
+0ee9 : a5 47 __ LDA T9 + 1
+0eeb : 85 1c __ STA ACCU + 1
+0eed : a5 48 __ LDA T9 + 2
+0eef : 85 1d __ STA ACCU + 2
+0ef1 : a5 49 __ LDA T9 + 3
+0ef3 : 85 1e __ STA ACCU + 3
+0ef5 : a9 03 __ LDA #$03
+0ef7 : 85 03 __ STA $03
+0ef9 : a9 00 __ LDA #$00
+0efb : 85 04 __ STA $04
+0efd : 85 05 __ STA $05
+0eff : 85 06 __ STA $06
+0f01 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0f04 : a5 07 __ LDA $07
+0f06 : 85 67 __ STA T8 + 0
+0f08 : a5 08 __ LDA $08
+0f0a : 85 68 __ STA T8 + 1
+0f0c : a5 09 __ LDA $09
+0f0e : 85 69 __ STA T8 + 2
+0f10 : a5 0a __ LDA $0a
+0f12 : 85 6a __ STA T8 + 3
+0f14 : 18 __ __ CLC
+0f15 : a5 5b __ LDA T3 + 0
+0f17 : 69 01 __ ADC #$01
+0f19 : 85 4a __ STA T10 + 0
+0f1b : a5 5c __ LDA T3 + 1
+0f1d : 69 00 __ ADC #$00
+0f1f : 85 4b __ STA T10 + 1
+0f21 : a5 5d __ LDA T3 + 2
+0f23 : 69 00 __ ADC #$00
+0f25 : 85 4c __ STA T10 + 2
+0f27 : a5 5e __ LDA T3 + 3
+0f29 : 69 00 __ ADC #$00
+0f2b : 85 4d __ STA T10 + 3
+0f2d : a5 44 __ LDA T6 + 0
+0f2f : 85 4e __ STA T11 + 0
+0f31 : a5 45 __ LDA T6 + 1
+0f33 : 85 4f __ STA T11 + 1
+0f35 : 29 80 __ AND #$80
+0f37 : 10 02 __ BPL $0f3b
+0f39 : a9 ff __ LDA #$ff
+0f3b : 85 50 __ STA T11 + 2
+0f3d : 85 51 __ STA T11 + 3
+0f3f : e6 44 __ INC T6 + 0
+0f41 : d0 02 __ BNE $0f45
+0f43 : e6 45 __ INC T6 + 1
+0f45 : a9 06 __ LDA #$06
+0f47 : 85 1b __ STA ACCU + 0
+0f49 : a9 00 __ LDA #$00
+0f4b : 85 1c __ STA ACCU + 1
+0f4d : 85 1d __ STA ACCU + 2
+0f4f : 85 1e __ STA ACCU + 3
+0f51 : a5 4e __ LDA T11 + 0
+0f53 : 85 03 __ STA $03
+0f55 : a5 4f __ LDA T11 + 1
+0f57 : 85 04 __ STA $04
+0f59 : a5 50 __ LDA T11 + 2
+0f5b : 85 05 __ STA $05
+0f5d : 85 06 __ STA $06
+0f5f : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0f62 : a5 07 __ LDA $07
+0f64 : 85 6b __ STA T12 + 0
+0f66 : a5 08 __ LDA $08
+0f68 : 85 6c __ STA T12 + 1
+0f6a : a5 09 __ LDA $09
+0f6c : 85 6d __ STA T12 + 2
+0f6e : a5 0a __ LDA $0a
+0f70 : 85 6e __ STA T12 + 3
+0f72 : a9 06 __ LDA #$06
+0f74 : 85 1b __ STA ACCU + 0
+0f76 : a9 00 __ LDA #$00
+0f78 : 85 1c __ STA ACCU + 1
+0f7a : 85 1d __ STA ACCU + 2
+0f7c : 85 1e __ STA ACCU + 3
+0f7e : a5 67 __ LDA T8 + 0
+0f80 : 85 03 __ STA $03
+0f82 : a5 68 __ LDA T8 + 1
+0f84 : 85 04 __ STA $04
+0f86 : a5 69 __ LDA T8 + 2
+0f88 : 85 05 __ STA $05
+0f8a : a5 6a __ LDA T8 + 3
+0f8c : 85 06 __ STA $06
+0f8e : 20 dd 25 JSR $25dd ; (mul32 + 0)
+0f91 : a5 07 __ LDA $07
+0f93 : 85 6f __ STA T13 + 0
+0f95 : a5 08 __ LDA $08
+0f97 : 85 70 __ STA T13 + 1
+0f99 : a5 09 __ LDA $09
+0f9b : 85 71 __ STA T13 + 2
+0f9d : a5 0a __ LDA $0a
+0f9f : 85 72 __ STA T13 + 3
+0fa1 : a5 63 __ LDA T7 + 0
+0fa3 : 85 73 __ STA T14 + 0
+0fa5 : a5 64 __ LDA T7 + 1
+0fa7 : 85 74 __ STA T14 + 1
+0fa9 : a5 65 __ LDA T7 + 2
+0fab : 85 75 __ STA T14 + 2
+0fad : a5 66 __ LDA T7 + 3
+0faf : a2 02 __ LDX #$02
+0fb1 : 06 73 __ ASL T14 + 0
+0fb3 : 26 74 __ ROL T14 + 1
+0fb5 : 26 75 __ ROL T14 + 2
+0fb7 : 2a __ __ ROL
+0fb8 : ca __ __ DEX
+0fb9 : d0 f6 __ BNE $0fb1
+0fbb : 85 76 __ STA T14 + 3
+0fbd : 38 __ __ SEC
+0fbe : a5 6f __ LDA T13 + 0
+0fc0 : e5 73 __ SBC T14 + 0
+0fc2 : aa __ __ TAX
+0fc3 : a5 70 __ LDA T13 + 1
+0fc5 : e5 74 __ SBC T14 + 1
+0fc7 : a8 __ __ TAY
+0fc8 : a5 71 __ LDA T13 + 2
+0fca : e5 75 __ SBC T14 + 2
+0fcc : 85 71 __ STA T13 + 2
+0fce : a5 72 __ LDA T13 + 3
+0fd0 : e5 76 __ SBC T14 + 3
+0fd2 : 85 72 __ STA T13 + 3
+0fd4 : 18 __ __ CLC
+0fd5 : 8a __ __ TXA
+0fd6 : 65 4a __ ADC T10 + 0
+0fd8 : 85 4a __ STA T10 + 0
+0fda : 85 1b __ STA ACCU + 0
+0fdc : 98 __ __ TYA
+0fdd : 65 4b __ ADC T10 + 1
+0fdf : 85 4b __ STA T10 + 1
+0fe1 : 85 1c __ STA ACCU + 1
+0fe3 : a5 71 __ LDA T13 + 2
+0fe5 : 65 4c __ ADC T10 + 2
+0fe7 : 85 4c __ STA T10 + 2
+0fe9 : 85 1d __ STA ACCU + 2
+0feb : a5 72 __ LDA T13 + 3
+0fed : 65 4d __ ADC T10 + 3
+0fef : 85 4d __ STA T10 + 3
+0ff1 : 85 1e __ STA ACCU + 3
+0ff3 : a9 06 __ LDA #$06
+0ff5 : 85 03 __ STA $03
+0ff7 : a9 00 __ LDA #$00
+0ff9 : 85 04 __ STA $04
+0ffb : 85 05 __ STA $05
+0ffd : 85 06 __ STA $06
+0fff : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1002 : a5 07 __ LDA $07
+1004 : 85 6f __ STA T13 + 0
+1006 : a5 08 __ LDA $08
+1008 : 85 70 __ STA T13 + 1
+100a : a5 09 __ LDA $09
+100c : 85 71 __ STA T13 + 2
+100e : a5 0a __ LDA $0a
+1010 : 85 72 __ STA T13 + 3
+1012 : a5 51 __ LDA T11 + 3
+1014 : a2 02 __ LDX #$02
+1016 : 06 4e __ ASL T11 + 0
+1018 : 26 4f __ ROL T11 + 1
+101a : 26 50 __ ROL T11 + 2
+101c : 2a __ __ ROL
+101d : ca __ __ DEX
+101e : d0 f6 __ BNE $1016
+1020 : 85 51 __ STA T11 + 3
+1022 : 38 __ __ SEC
+1023 : a5 6f __ LDA T13 + 0
+1025 : e5 4e __ SBC T11 + 0
+1027 : aa __ __ TAX
+1028 : a5 70 __ LDA T13 + 1
+102a : e5 4f __ SBC T11 + 1
+102c : a8 __ __ TAY
+102d : a5 71 __ LDA T13 + 2
+102f : e5 50 __ SBC T11 + 2
+1031 : 85 50 __ STA T11 + 2
+1033 : a5 72 __ LDA T13 + 3
+1035 : e5 51 __ SBC T11 + 3
+1037 : 85 51 __ STA T11 + 3
+1039 : 18 __ __ CLC
+103a : 8a __ __ TXA
+103b : 65 67 __ ADC T8 + 0
+103d : 85 67 __ STA T8 + 0
+103f : 85 4e __ STA T11 + 0
+1041 : 98 __ __ TYA
+1042 : 65 68 __ ADC T8 + 1
+1044 : 85 68 __ STA T8 + 1
+1046 : 85 4f __ STA T11 + 1
+1048 : a5 50 __ LDA T11 + 2
+104a : 65 69 __ ADC T8 + 2
+104c : 85 69 __ STA T8 + 2
+104e : 85 50 __ STA T11 + 2
+1050 : a5 51 __ LDA T11 + 3
+1052 : 65 6a __ ADC T8 + 3
+1054 : 85 6a __ STA T8 + 3
+1056 : a2 02 __ LDX #$02
+1058 : 06 4e __ ASL T11 + 0
+105a : 26 4f __ ROL T11 + 1
+105c : 26 50 __ ROL T11 + 2
+105e : 2a __ __ ROL
+105f : ca __ __ DEX
+1060 : d0 f6 __ BNE $1058
+1062 : 85 51 __ STA T11 + 3
+1064 : 38 __ __ SEC
+1065 : a5 6b __ LDA T12 + 0
+1067 : e5 4e __ SBC T11 + 0
+1069 : 85 4e __ STA T11 + 0
+106b : a5 6c __ LDA T12 + 1
+106d : e5 4f __ SBC T11 + 1
+106f : 85 4f __ STA T11 + 1
+1071 : a5 6d __ LDA T12 + 2
+1073 : e5 50 __ SBC T11 + 2
+1075 : 85 50 __ STA T11 + 2
+1077 : a5 6e __ LDA T12 + 3
+1079 : e5 51 __ SBC T11 + 3
+107b : 85 51 __ STA T11 + 3
+107d : 38 __ __ SEC
+107e : a5 63 __ LDA T7 + 0
+1080 : e5 4e __ SBC T11 + 0
+1082 : 85 63 __ STA T7 + 0
+1084 : a5 64 __ LDA T7 + 1
+1086 : e5 4f __ SBC T11 + 1
+1088 : 85 64 __ STA T7 + 1
+108a : a5 65 __ LDA T7 + 2
+108c : e5 50 __ SBC T11 + 2
+108e : 85 65 __ STA T7 + 2
+1090 : a5 66 __ LDA T7 + 3
+1092 : e5 51 __ SBC T11 + 3
+1094 : 85 66 __ STA T7 + 3
+1096 : a5 45 __ LDA T6 + 1
+1098 : 10 03 __ BPL $109d
+109a : 4c 2d 0f JMP $0f2d ; (main + 1581)
+109d : d0 09 __ BNE $10a8
+109f : a5 44 __ LDA T6 + 0
+10a1 : c9 03 __ CMP #$03
+10a3 : b0 03 __ BCS $10a8
+10a5 : 4c 2d 0f JMP $0f2d ; (main + 1581)
+10a8 : a9 00 __ LDA #$00
+10aa : 85 44 __ STA T6 + 0
+10ac : 85 45 __ STA T6 + 1
+10ae : a5 4a __ LDA T10 + 0
+10b0 : 45 67 __ EOR T8 + 0
+10b2 : aa __ __ TAX
+10b3 : a5 4b __ LDA T10 + 1
+10b5 : 45 68 __ EOR T8 + 1
+10b7 : a8 __ __ TAY
+10b8 : a5 4c __ LDA T10 + 2
+10ba : 45 69 __ EOR T8 + 2
+10bc : 85 69 __ STA T8 + 2
+10be : a5 4d __ LDA T10 + 3
+10c0 : 45 6a __ EOR T8 + 3
+10c2 : 85 6a __ STA T8 + 3
+10c4 : 8a __ __ TXA
+10c5 : 45 63 __ EOR T7 + 0
+10c7 : aa __ __ TAX
+10c8 : 98 __ __ TYA
+10c9 : 45 64 __ EOR T7 + 1
+10cb : a8 __ __ TAY
+10cc : a5 69 __ LDA T8 + 2
+10ce : 45 65 __ EOR T7 + 2
+10d0 : 85 65 __ STA T7 + 2
+10d2 : a5 6a __ LDA T8 + 3
+10d4 : 45 66 __ EOR T7 + 3
+10d6 : 85 66 __ STA T7 + 3
+10d8 : 18 __ __ CLC
+10d9 : 8a __ __ TXA
+10da : 65 57 __ ADC T2 + 0
+10dc : 85 57 __ STA T2 + 0
+10de : 85 1b __ STA ACCU + 0
+10e0 : 98 __ __ TYA
+10e1 : 65 58 __ ADC T2 + 1
+10e3 : 85 58 __ STA T2 + 1
+10e5 : 85 1c __ STA ACCU + 1
+10e7 : a5 65 __ LDA T7 + 2
+10e9 : 65 59 __ ADC T2 + 2
+10eb : 85 59 __ STA T2 + 2
+10ed : 85 1d __ STA ACCU + 2
+10ef : a5 66 __ LDA T7 + 3
+10f1 : 65 5a __ ADC T2 + 3
+10f3 : 85 5a __ STA T2 + 3
+10f5 : 85 1e __ STA ACCU + 3
+10f7 : a9 06 __ LDA #$06
+10f9 : 85 03 __ STA $03
+10fb : a9 00 __ LDA #$00
+10fd : 85 04 __ STA $04
+10ff : 85 05 __ STA $05
+1101 : 85 06 __ STA $06
+1103 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1106 : a5 07 __ LDA $07
+1108 : 85 63 __ STA T7 + 0
+110a : a5 08 __ LDA $08
+110c : 85 64 __ STA T7 + 1
+110e : a5 09 __ LDA $09
+1110 : 85 65 __ STA T7 + 2
+1112 : a5 0a __ LDA $0a
+1114 : 85 66 __ STA T7 + 3
+1116 : a5 46 __ LDA T9 + 0
+1118 : 85 67 __ STA T8 + 0
+111a : a5 47 __ LDA T9 + 1
+111c : 85 68 __ STA T8 + 1
+111e : a5 48 __ LDA T9 + 2
+1120 : 85 69 __ STA T8 + 2
+1122 : a5 49 __ LDA T9 + 3
+1124 : a2 02 __ LDX #$02
+1126 : 06 67 __ ASL T8 + 0
+1128 : 26 68 __ ROL T8 + 1
+112a : 26 69 __ ROL T8 + 2
+112c : 2a __ __ ROL
+112d : ca __ __ DEX
+112e : d0 f6 __ BNE $1126
+1130 : 85 6a __ STA T8 + 3
+1132 : 38 __ __ SEC
+1133 : a5 63 __ LDA T7 + 0
+1135 : e5 67 __ SBC T8 + 0
+1137 : aa __ __ TAX
+1138 : a5 64 __ LDA T7 + 1
+113a : e5 68 __ SBC T8 + 1
+113c : a8 __ __ TAY
+113d : a5 65 __ LDA T7 + 2
+113f : e5 69 __ SBC T8 + 2
+1141 : 85 65 __ STA T7 + 2
+1143 : a5 66 __ LDA T7 + 3
+1145 : e5 6a __ SBC T8 + 3
+1147 : 85 66 __ STA T7 + 3
+1149 : 18 __ __ CLC
+114a : 8a __ __ TXA
+114b : 65 5b __ ADC T3 + 0
+114d : 85 5b __ STA T3 + 0
+114f : 85 1b __ STA ACCU + 0
+1151 : 98 __ __ TYA
+1152 : 65 5c __ ADC T3 + 1
+1154 : 85 5c __ STA T3 + 1
+1156 : 85 1c __ STA ACCU + 1
+1158 : a5 65 __ LDA T7 + 2
+115a : 65 5d __ ADC T3 + 2
+115c : 85 5d __ STA T3 + 2
+115e : 85 1d __ STA ACCU + 2
+1160 : a5 66 __ LDA T7 + 3
+1162 : 65 5e __ ADC T3 + 3
+1164 : 85 5e __ STA T3 + 3
+1166 : 85 1e __ STA ACCU + 3
+1168 : 38 __ __ SEC
+1169 : a5 57 __ LDA T2 + 0
+116b : e5 5b __ SBC T3 + 0
+116d : 85 63 __ STA T7 + 0
+116f : a5 58 __ LDA T2 + 1
+1171 : e5 5c __ SBC T3 + 1
+1173 : 85 64 __ STA T7 + 1
+1175 : a5 59 __ LDA T2 + 2
+1177 : e5 5d __ SBC T3 + 2
+1179 : 85 65 __ STA T7 + 2
+117b : a5 5a __ LDA T2 + 3
+117d : e5 5e __ SBC T3 + 3
+117f : 85 66 __ STA T7 + 3
+1181 : a9 03 __ LDA #$03
+1183 : 85 03 __ STA $03
+1185 : a9 00 __ LDA #$00
+1187 : 85 04 __ STA $04
+1189 : 85 05 __ STA $05
+118b : 85 06 __ STA $06
+118d : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1190 : a5 07 __ LDA $07
+1192 : 85 67 __ STA T8 + 0
+1194 : a5 08 __ LDA $08
+1196 : 85 68 __ STA T8 + 1
+1198 : a5 09 __ LDA $09
+119a : 85 69 __ STA T8 + 2
+119c : a5 0a __ LDA $0a
+119e : 85 6a __ STA T8 + 3
+11a0 : 18 __ __ CLC
+11a1 : a5 57 __ LDA T2 + 0
+11a3 : 69 01 __ ADC #$01
+11a5 : 85 4a __ STA T10 + 0
+11a7 : a5 58 __ LDA T2 + 1
+11a9 : 69 00 __ ADC #$00
+11ab : 85 4b __ STA T10 + 1
+11ad : a5 59 __ LDA T2 + 2
+11af : 69 00 __ ADC #$00
+11b1 : 85 4c __ STA T10 + 2
+11b3 : a5 5a __ LDA T2 + 3
+11b5 : 69 00 __ ADC #$00
+11b7 : 85 4d __ STA T10 + 3
+11b9 : a5 44 __ LDA T6 + 0
+11bb : 85 4e __ STA T11 + 0
+11bd : a5 45 __ LDA T6 + 1
+11bf : 85 4f __ STA T11 + 1
+11c1 : 29 80 __ AND #$80
+11c3 : 10 02 __ BPL $11c7
+11c5 : a9 ff __ LDA #$ff
+11c7 : 85 50 __ STA T11 + 2
+11c9 : 85 51 __ STA T11 + 3
+11cb : e6 44 __ INC T6 + 0
+11cd : d0 02 __ BNE $11d1
+11cf : e6 45 __ INC T6 + 1
+11d1 : a9 06 __ LDA #$06
+11d3 : 85 1b __ STA ACCU + 0
+11d5 : a9 00 __ LDA #$00
+11d7 : 85 1c __ STA ACCU + 1
+11d9 : 85 1d __ STA ACCU + 2
+11db : 85 1e __ STA ACCU + 3
+11dd : a5 4e __ LDA T11 + 0
+11df : 85 03 __ STA $03
+11e1 : a5 4f __ LDA T11 + 1
+11e3 : 85 04 __ STA $04
+11e5 : a5 50 __ LDA T11 + 2
+11e7 : 85 05 __ STA $05
+11e9 : 85 06 __ STA $06
+11eb : 20 dd 25 JSR $25dd ; (mul32 + 0)
+11ee : a5 07 __ LDA $07
+11f0 : 85 6b __ STA T12 + 0
+11f2 : a5 08 __ LDA $08
+11f4 : 85 6c __ STA T12 + 1
+11f6 : a5 09 __ LDA $09
+11f8 : 85 6d __ STA T12 + 2
+11fa : a5 0a __ LDA $0a
+11fc : 85 6e __ STA T12 + 3
+11fe : a9 06 __ LDA #$06
+1200 : 85 1b __ STA ACCU + 0
+1202 : a9 00 __ LDA #$00
+1204 : 85 1c __ STA ACCU + 1
+1206 : 85 1d __ STA ACCU + 2
+1208 : 85 1e __ STA ACCU + 3
+120a : a5 67 __ LDA T8 + 0
+120c : 85 03 __ STA $03
+120e : a5 68 __ LDA T8 + 1
+1210 : 85 04 __ STA $04
+1212 : a5 69 __ LDA T8 + 2
+1214 : 85 05 __ STA $05
+1216 : a5 6a __ LDA T8 + 3
+1218 : 85 06 __ STA $06
+121a : 20 dd 25 JSR $25dd ; (mul32 + 0)
+121d : a5 07 __ LDA $07
+121f : 85 6f __ STA T13 + 0
+1221 : a5 08 __ LDA $08
+1223 : 85 70 __ STA T13 + 1
+1225 : a5 09 __ LDA $09
+1227 : 85 71 __ STA T13 + 2
+1229 : a5 0a __ LDA $0a
+122b : 85 72 __ STA T13 + 3
+122d : a5 63 __ LDA T7 + 0
+122f : 85 73 __ STA T14 + 0
+1231 : a5 64 __ LDA T7 + 1
+1233 : 85 74 __ STA T14 + 1
+1235 : a5 65 __ LDA T7 + 2
+1237 : 85 75 __ STA T14 + 2
+1239 : a5 66 __ LDA T7 + 3
+123b : a2 02 __ LDX #$02
+123d : 06 73 __ ASL T14 + 0
+123f : 26 74 __ ROL T14 + 1
+1241 : 26 75 __ ROL T14 + 2
+1243 : 2a __ __ ROL
+1244 : ca __ __ DEX
+1245 : d0 f6 __ BNE $123d
+1247 : 85 76 __ STA T14 + 3
+1249 : 38 __ __ SEC
+124a : a5 6f __ LDA T13 + 0
+124c : e5 73 __ SBC T14 + 0
+124e : aa __ __ TAX
+124f : a5 70 __ LDA T13 + 1
+1251 : e5 74 __ SBC T14 + 1
+1253 : a8 __ __ TAY
+1254 : a5 71 __ LDA T13 + 2
+1256 : e5 75 __ SBC T14 + 2
+1258 : 85 71 __ STA T13 + 2
+125a : a5 72 __ LDA T13 + 3
+125c : e5 76 __ SBC T14 + 3
+125e : 85 72 __ STA T13 + 3
+1260 : 18 __ __ CLC
+1261 : 8a __ __ TXA
+1262 : 65 4a __ ADC T10 + 0
+1264 : 85 4a __ STA T10 + 0
+1266 : 85 1b __ STA ACCU + 0
+1268 : 98 __ __ TYA
+1269 : 65 4b __ ADC T10 + 1
+126b : 85 4b __ STA T10 + 1
+126d : 85 1c __ STA ACCU + 1
+126f : a5 71 __ LDA T13 + 2
+1271 : 65 4c __ ADC T10 + 2
+1273 : 85 4c __ STA T10 + 2
+1275 : 85 1d __ STA ACCU + 2
+1277 : a5 72 __ LDA T13 + 3
+1279 : 65 4d __ ADC T10 + 3
+127b : 85 4d __ STA T10 + 3
+127d : 85 1e __ STA ACCU + 3
+127f : a9 06 __ LDA #$06
+1281 : 85 03 __ STA $03
+1283 : a9 00 __ LDA #$00
+1285 : 85 04 __ STA $04
+1287 : 85 05 __ STA $05
+1289 : 85 06 __ STA $06
+128b : 20 dd 25 JSR $25dd ; (mul32 + 0)
+128e : a5 07 __ LDA $07
+1290 : 85 6f __ STA T13 + 0
+1292 : a5 08 __ LDA $08
+1294 : 85 70 __ STA T13 + 1
+1296 : a5 09 __ LDA $09
+1298 : 85 71 __ STA T13 + 2
+129a : a5 0a __ LDA $0a
+129c : 85 72 __ STA T13 + 3
+129e : a5 51 __ LDA T11 + 3
+12a0 : a2 02 __ LDX #$02
+12a2 : 06 4e __ ASL T11 + 0
+12a4 : 26 4f __ ROL T11 + 1
+12a6 : 26 50 __ ROL T11 + 2
+12a8 : 2a __ __ ROL
+12a9 : ca __ __ DEX
+12aa : d0 f6 __ BNE $12a2
+12ac : 85 51 __ STA T11 + 3
+12ae : 38 __ __ SEC
+12af : a5 6f __ LDA T13 + 0
+12b1 : e5 4e __ SBC T11 + 0
+12b3 : aa __ __ TAX
+12b4 : a5 70 __ LDA T13 + 1
+12b6 : e5 4f __ SBC T11 + 1
+12b8 : a8 __ __ TAY
+12b9 : a5 71 __ LDA T13 + 2
+12bb : e5 50 __ SBC T11 + 2
+12bd : 85 50 __ STA T11 + 2
+12bf : a5 72 __ LDA T13 + 3
+12c1 : e5 51 __ SBC T11 + 3
+12c3 : 85 51 __ STA T11 + 3
+12c5 : 18 __ __ CLC
+12c6 : 8a __ __ TXA
+12c7 : 65 67 __ ADC T8 + 0
+12c9 : 85 67 __ STA T8 + 0
+12cb : 85 4e __ STA T11 + 0
+12cd : 98 __ __ TYA
+12ce : 65 68 __ ADC T8 + 1
+12d0 : 85 68 __ STA T8 + 1
+12d2 : 85 4f __ STA T11 + 1
+12d4 : a5 50 __ LDA T11 + 2
+12d6 : 65 69 __ ADC T8 + 2
+12d8 : 85 69 __ STA T8 + 2
+12da : 85 50 __ STA T11 + 2
+12dc : a5 51 __ LDA T11 + 3
+12de : 65 6a __ ADC T8 + 3
+12e0 : 85 6a __ STA T8 + 3
+12e2 : a2 02 __ LDX #$02
+12e4 : 06 4e __ ASL T11 + 0
+12e6 : 26 4f __ ROL T11 + 1
+12e8 : 26 50 __ ROL T11 + 2
+12ea : 2a __ __ ROL
+12eb : ca __ __ DEX
+12ec : d0 f6 __ BNE $12e4
+12ee : 85 51 __ STA T11 + 3
+12f0 : 38 __ __ SEC
+12f1 : a5 6b __ LDA T12 + 0
+12f3 : e5 4e __ SBC T11 + 0
+12f5 : 85 4e __ STA T11 + 0
+12f7 : a5 6c __ LDA T12 + 1
+12f9 : e5 4f __ SBC T11 + 1
+12fb : 85 4f __ STA T11 + 1
+12fd : a5 6d __ LDA T12 + 2
+12ff : e5 50 __ SBC T11 + 2
+1301 : 85 50 __ STA T11 + 2
+1303 : a5 6e __ LDA T12 + 3
+1305 : e5 51 __ SBC T11 + 3
+1307 : 85 51 __ STA T11 + 3
+1309 : 38 __ __ SEC
+130a : a5 63 __ LDA T7 + 0
+130c : e5 4e __ SBC T11 + 0
+130e : 85 63 __ STA T7 + 0
+1310 : a5 64 __ LDA T7 + 1
+1312 : e5 4f __ SBC T11 + 1
+1314 : 85 64 __ STA T7 + 1
+1316 : a5 65 __ LDA T7 + 2
+1318 : e5 50 __ SBC T11 + 2
+131a : 85 65 __ STA T7 + 2
+131c : a5 66 __ LDA T7 + 3
+131e : e5 51 __ SBC T11 + 3
+1320 : 85 66 __ STA T7 + 3
+1322 : a5 45 __ LDA T6 + 1
+1324 : 10 03 __ BPL $1329
+1326 : 4c b9 11 JMP $11b9 ; (main + 2233)
+1329 : d0 09 __ BNE $1334
+132b : a5 44 __ LDA T6 + 0
+132d : c9 03 __ CMP #$03
+132f : b0 03 __ BCS $1334
+1331 : 4c b9 11 JMP $11b9 ; (main + 2233)
+1334 : e6 55 __ INC T1 + 0
+1336 : d0 02 __ BNE $133a
+1338 : e6 56 __ INC T1 + 1
+133a : a5 4a __ LDA T10 + 0
+133c : 45 67 __ EOR T8 + 0
+133e : aa __ __ TAX
+133f : a5 4b __ LDA T10 + 1
+1341 : 45 68 __ EOR T8 + 1
+1343 : a8 __ __ TAY
+1344 : a5 4c __ LDA T10 + 2
+1346 : 45 69 __ EOR T8 + 2
+1348 : 85 69 __ STA T8 + 2
+134a : a5 4d __ LDA T10 + 3
+134c : 45 6a __ EOR T8 + 3
+134e : 85 6a __ STA T8 + 3
+1350 : 8a __ __ TXA
+1351 : 45 63 __ EOR T7 + 0
+1353 : aa __ __ TAX
+1354 : 98 __ __ TYA
+1355 : 45 64 __ EOR T7 + 1
+1357 : a8 __ __ TAY
+1358 : a5 69 __ LDA T8 + 2
+135a : 45 65 __ EOR T7 + 2
+135c : 85 65 __ STA T7 + 2
+135e : a5 6a __ LDA T8 + 3
+1360 : 45 66 __ EOR T7 + 3
+1362 : 85 66 __ STA T7 + 3
+1364 : 8a __ __ TXA
+1365 : 45 46 __ EOR T9 + 0
+1367 : 85 46 __ STA T9 + 0
+1369 : 98 __ __ TYA
+136a : 45 47 __ EOR T9 + 1
+136c : 85 47 __ STA T9 + 1
+136e : a5 65 __ LDA T7 + 2
+1370 : 45 48 __ EOR T9 + 2
+1372 : 85 48 __ STA T9 + 2
+1374 : a5 66 __ LDA T7 + 3
+1376 : 45 49 __ EOR T9 + 3
+1378 : 85 49 __ STA T9 + 3
+137a : a5 56 __ LDA T1 + 1
+137c : 10 03 __ BPL $1381
+137e : 4c c6 0e JMP $0ec6 ; (main + 1478)
+1381 : d0 09 __ BNE $138c
+1383 : a5 55 __ LDA T1 + 0
+1385 : c9 03 __ CMP #$03
+1387 : b0 03 __ BCS $138c
+1389 : 4c c6 0e JMP $0ec6 ; (main + 1478)
+138c : 18 __ __ CLC
+138d : a5 5b __ LDA T3 + 0
+138f : 65 46 __ ADC T9 + 0
+1391 : aa __ __ TAX
+1392 : a5 5c __ LDA T3 + 1
+1394 : 65 47 __ ADC T9 + 1
+1396 : a8 __ __ TAY
+1397 : a5 5d __ LDA T3 + 2
+1399 : 65 48 __ ADC T9 + 2
+139b : 85 5d __ STA T3 + 2
+139d : a5 5e __ LDA T3 + 3
+139f : 65 49 __ ADC T9 + 3
+13a1 : 85 5e __ STA T3 + 3
+13a3 : 18 __ __ CLC
+13a4 : 8a __ __ TXA
+13a5 : 65 57 __ ADC T2 + 0
+13a7 : 85 57 __ STA T2 + 0
+13a9 : 98 __ __ TYA
+13aa : 65 58 __ ADC T2 + 1
+13ac : 85 58 __ STA T2 + 1
+13ae : a5 5d __ LDA T3 + 2
+13b0 : 65 59 __ ADC T2 + 2
+13b2 : 85 59 __ STA T2 + 2
+13b4 : a5 5e __ LDA T3 + 3
+13b6 : 65 5a __ ADC T2 + 3
+13b8 : 85 5a __ STA T2 + 3
+13ba : a5 62 __ LDA T4 + 3
+13bc : c5 5a __ CMP T2 + 3
+13be : d0 12 __ BNE $13d2
+13c0 : a5 61 __ LDA T4 + 2
+13c2 : c5 59 __ CMP T2 + 2
+13c4 : d0 0c __ BNE $13d2
+13c6 : a5 60 __ LDA T4 + 1
+13c8 : c5 58 __ CMP T2 + 1
+13ca : d0 06 __ BNE $13d2
+13cc : a5 5f __ LDA T4 + 0
+13ce : c5 57 __ CMP T2 + 0
+13d0 : f0 09 __ BEQ $13db
+13d2 : a9 ff __ LDA #$ff
+13d4 : 85 0d __ STA P0
+13d6 : 85 0e __ STA P1
+13d8 : 20 62 1e JSR $1e62 ; (exit + 0)
+13db : 18 __ __ CLC
+13dc : a5 53 __ LDA T0 + 0
+13de : 69 02 __ ADC #$02
+13e0 : a0 02 __ LDY #$02
+13e2 : 91 23 __ STA (SP + 0),y
+13e4 : a5 54 __ LDA T0 + 1
+13e6 : 69 00 __ ADC #$00
+13e8 : c8 __ __ INY
+13e9 : 91 23 __ STA (SP + 0),y
+13eb : 29 80 __ AND #$80
+13ed : 10 02 __ BPL $13f1
+13ef : a9 ff __ LDA #$ff
+13f1 : c8 __ __ INY
+13f2 : 91 23 __ STA (SP + 0),y
+13f4 : c8 __ __ INY
+13f5 : 91 23 __ STA (SP + 0),y
+13f7 : a9 03 __ LDA #$03
+13f9 : c8 __ __ INY
+13fa : 91 23 __ STA (SP + 0),y
+13fc : a9 00 __ LDA #$00
+13fe : c8 __ __ INY
+13ff : 91 23 __ STA (SP + 0),y
+1401 : 20 66 20 JSR $2066 ; (rec + 0)
+1404 : a5 1b __ LDA ACCU + 0
+1406 : 85 57 __ STA T2 + 0
+1408 : a5 1c __ LDA ACCU + 1
+140a : 85 58 __ STA T2 + 1
+140c : a5 1d __ LDA ACCU + 2
+140e : 85 59 __ STA T2 + 2
+1410 : a5 1e __ LDA ACCU + 3
+1412 : 85 5a __ STA T2 + 3
+1414 : 18 __ __ CLC
+1415 : a5 53 __ LDA T0 + 0
+1417 : 69 02 __ ADC #$02
+1419 : a0 02 __ LDY #$02
+141b : 91 23 __ STA (SP + 0),y
+141d : a5 54 __ LDA T0 + 1
+141f : 69 00 __ ADC #$00
+1421 : c8 __ __ INY
+1422 : 91 23 __ STA (SP + 0),y
+1424 : 29 80 __ AND #$80
+1426 : 10 02 __ BPL $142a
+1428 : a9 ff __ LDA #$ff
+142a : c8 __ __ INY
+142b : 91 23 __ STA (SP + 0),y
+142d : c8 __ __ INY
+142e : 91 23 __ STA (SP + 0),y
+1430 : a9 03 __ LDA #$03
+1432 : c8 __ __ INY
+1433 : 91 23 __ STA (SP + 0),y
+1435 : a9 00 __ LDA #$00
+1437 : c8 __ __ INY
+1438 : 91 23 __ STA (SP + 0),y
+143a : 20 11 22 JSR $2211 ; (rrec + 0)
+143d : a5 5a __ LDA T2 + 3
+143f : c5 1e __ CMP ACCU + 3
+1441 : d0 12 __ BNE $1455
+1443 : a5 59 __ LDA T2 + 2
+1445 : c5 1d __ CMP ACCU + 2
+1447 : d0 0c __ BNE $1455
+1449 : a5 58 __ LDA T2 + 1
+144b : c5 1c __ CMP ACCU + 1
+144d : d0 06 __ BNE $1455
+144f : a5 57 __ LDA T2 + 0
+1451 : c5 1b __ CMP ACCU + 0
+1453 : f0 09 __ BEQ $145e
+1455 : a9 ff __ LDA #$ff
+1457 : 85 0d __ STA P0
+1459 : 85 0e __ STA P1
+145b : 20 62 1e JSR $1e62 ; (exit + 0)
+145e : a5 54 __ LDA T0 + 1
+1460 : 29 80 __ AND #$80
+1462 : 10 02 __ BPL $1466
+1464 : a9 ff __ LDA #$ff
+1466 : 85 59 __ STA T2 + 2
+1468 : 85 5a __ STA T2 + 3
+146a : a5 53 __ LDA T0 + 0
+146c : a0 02 __ LDY #$02
+146e : 91 23 __ STA (SP + 0),y
+1470 : a5 54 __ LDA T0 + 1
+1472 : c8 __ __ INY
+1473 : 91 23 __ STA (SP + 0),y
+1475 : a5 59 __ LDA T2 + 2
+1477 : c8 __ __ INY
+1478 : 91 23 __ STA (SP + 0),y
+147a : c8 __ __ INY
+147b : 91 23 __ STA (SP + 0),y
+147d : a9 0c __ LDA #$0c
+147f : c8 __ __ INY
+1480 : 91 23 __ STA (SP + 0),y
+1482 : a9 00 __ LDA #$00
+1484 : c8 __ __ INY
+1485 : 91 23 __ STA (SP + 0),y
+1487 : c8 __ __ INY
+1488 : 91 23 __ STA (SP + 0),y
+148a : c8 __ __ INY
+148b : 91 23 __ STA (SP + 0),y
+148d : a9 77 __ LDA #$77
+148f : 85 1b __ STA ACCU + 0
+1491 : a9 1e __ LDA #$1e
+1493 : 85 1c __ STA ACCU + 1
+1495 : 20 da 25 JSR $25da ; (bcexec + 0)
+1498 : 38 __ __ SEC
+1499 : a5 53 __ LDA T0 + 0
+149b : e9 09 __ SBC #$09
+149d : aa __ __ TAX
+149e : a5 54 __ LDA T0 + 1
+14a0 : e9 00 __ SBC #$00
+14a2 : 85 58 __ STA T2 + 1
+14a4 : a5 59 __ LDA T2 + 2
+14a6 : e9 00 __ SBC #$00
+14a8 : 85 59 __ STA T2 + 2
+14aa : a5 5a __ LDA T2 + 3
+14ac : e9 00 __ SBC #$00
+14ae : 85 5a __ STA T2 + 3
+14b0 : 18 __ __ CLC
+14b1 : 8a __ __ TXA
+14b2 : 65 1b __ ADC ACCU + 0
+14b4 : 85 57 __ STA T2 + 0
+14b6 : a0 02 __ LDY #$02
+14b8 : 91 23 __ STA (SP + 0),y
+14ba : a5 58 __ LDA T2 + 1
+14bc : 65 1c __ ADC ACCU + 1
+14be : 85 58 __ STA T2 + 1
+14c0 : c8 __ __ INY
+14c1 : 91 23 __ STA (SP + 0),y
+14c3 : a5 59 __ LDA T2 + 2
+14c5 : 65 1d __ ADC ACCU + 2
+14c7 : 85 59 __ STA T2 + 2
+14c9 : c8 __ __ INY
+14ca : 91 23 __ STA (SP + 0),y
+14cc : a5 5a __ LDA T2 + 3
+14ce : 65 1e __ ADC ACCU + 3
+14d0 : 85 5a __ STA T2 + 3
+14d2 : c8 __ __ INY
+14d3 : 91 23 __ STA (SP + 0),y
+14d5 : a9 09 __ LDA #$09
+14d7 : c8 __ __ INY
+14d8 : 91 23 __ STA (SP + 0),y
+14da : a9 00 __ LDA #$00
+14dc : c8 __ __ INY
+14dd : 91 23 __ STA (SP + 0),y
+14df : c8 __ __ INY
+14e0 : 91 23 __ STA (SP + 0),y
+14e2 : c8 __ __ INY
+14e3 : 91 23 __ STA (SP + 0),y
+14e5 : a9 77 __ LDA #$77
+14e7 : 85 1b __ STA ACCU + 0
+14e9 : a9 1e __ LDA #$1e
+14eb : 85 1c __ STA ACCU + 1
+14ed : 20 da 25 JSR $25da ; (bcexec + 0)
+14f0 : 38 __ __ SEC
+14f1 : a5 53 __ LDA T0 + 0
+14f3 : e9 09 __ SBC #$09
+14f5 : 85 55 __ STA T1 + 0
+14f7 : a5 54 __ LDA T0 + 1
+14f9 : e9 00 __ SBC #$00
+14fb : 85 56 __ STA T1 + 1
+14fd : a9 24 __ LDA #$24
+14ff : 85 5f __ STA T4 + 0
+1501 : a9 00 __ LDA #$00
+1503 : 85 60 __ STA T4 + 1
+1505 : 85 61 __ STA T4 + 2
+1507 : 85 62 __ STA T4 + 3
+1509 : 85 44 __ STA T6 + 0
+150b : 85 45 __ STA T6 + 1
+150d : a5 54 __ LDA T0 + 1
+150f : 29 80 __ AND #$80
+1511 : 10 02 __ BPL $1515
+1513 : a9 ff __ LDA #$ff
+1515 : aa __ __ TAX
+1516 : a8 __ __ TAY
+1517 : 38 __ __ SEC
+1518 : a5 53 __ LDA T0 + 0
+151a : e9 0c __ SBC #$0c
+151c : 85 67 __ STA T8 + 0
+151e : a5 54 __ LDA T0 + 1
+1520 : e9 00 __ SBC #$00
+1522 : 85 68 __ STA T8 + 1
+1524 : 8a __ __ TXA
+1525 : e9 00 __ SBC #$00
+1527 : 85 69 __ STA T8 + 2
+1529 : 8a __ __ TXA
+152a : e9 00 __ SBC #$00
+152c : 85 6a __ STA T8 + 3
+152e : 18 __ __ CLC
+152f : a5 53 __ LDA T0 + 0
+1531 : 69 01 __ ADC #$01
+1533 : 85 63 __ STA T7 + 0
+1535 : a5 54 __ LDA T0 + 1
+1537 : 69 00 __ ADC #$00
+1539 : 85 64 __ STA T7 + 1
+153b : 8a __ __ TXA
+153c : 69 00 __ ADC #$00
+153e : 85 65 __ STA T7 + 2
+1540 : 98 __ __ TYA
+1541 : 69 00 __ ADC #$00
+1543 : 85 66 __ STA T7 + 3
+1545 : 18 __ __ CLC
+1546 : a9 0c __ LDA #$0c
+1548 : 65 1b __ ADC ACCU + 0
+154a : 85 1b __ STA ACCU + 0
+154c : a9 00 __ LDA #$00
+154e : 65 1c __ ADC ACCU + 1
+1550 : 85 1c __ STA ACCU + 1
+1552 : a9 00 __ LDA #$00
+1554 : 65 1d __ ADC ACCU + 2
+1556 : 85 1d __ STA ACCU + 2
+1558 : a9 00 __ LDA #$00
+155a : 65 1e __ ADC ACCU + 3
+155c : 85 1e __ STA ACCU + 3
+155e : a5 57 __ LDA T2 + 0
+1560 : 85 03 __ STA $03
+1562 : a5 58 __ LDA T2 + 1
+1564 : 85 04 __ STA $04
+1566 : a5 59 __ LDA T2 + 2
+1568 : 85 05 __ STA $05
+156a : a5 5a __ LDA T2 + 3
+156c : 85 06 __ STA $06
+156e : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1571 : a5 07 __ LDA $07
+1573 : 85 57 __ STA T2 + 0
+1575 : a5 08 __ LDA $08
+1577 : 85 58 __ STA T2 + 1
+1579 : a5 09 __ LDA $09
+157b : 85 59 __ STA T2 + 2
+157d : a5 0a __ LDA $0a
+157f : 85 5a __ STA T2 + 3
+1581 : a5 44 __ LDA T6 + 0
+1583 : 85 5b __ STA T3 + 0
+1585 : a5 45 __ LDA T6 + 1
+1587 : 85 5c __ STA T3 + 1
+1589 : 29 80 __ AND #$80
+158b : 10 02 __ BPL $158f
+158d : a9 ff __ LDA #$ff
+158f : 85 5d __ STA T3 + 2
+1591 : 85 5e __ STA T3 + 3
+1593 : e6 44 __ INC T6 + 0
+1595 : d0 02 __ BNE $1599
+1597 : e6 45 __ INC T6 + 1
+1599 : a9 06 __ LDA #$06
+159b : 85 1b __ STA ACCU + 0
+159d : a9 00 __ LDA #$00
+159f : 85 1c __ STA ACCU + 1
+15a1 : 85 1d __ STA ACCU + 2
+15a3 : 85 1e __ STA ACCU + 3
+15a5 : a5 5b __ LDA T3 + 0
+15a7 : 85 03 __ STA $03
+15a9 : a5 5c __ LDA T3 + 1
+15ab : 85 04 __ STA $04
+15ad : a5 5d __ LDA T3 + 2
+15af : 85 05 __ STA $05
+15b1 : 85 06 __ STA $06
+15b3 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+15b6 : a5 07 __ LDA $07
+15b8 : 85 46 __ STA T9 + 0
+15ba : a5 08 __ LDA $08
+15bc : 85 47 __ STA T9 + 1
+15be : a5 09 __ LDA $09
+15c0 : 85 48 __ STA T9 + 2
+15c2 : a5 0a __ LDA $0a
+15c4 : 85 49 __ STA T9 + 3
+15c6 : a9 06 __ LDA #$06
+15c8 : 85 1b __ STA ACCU + 0
+15ca : a9 00 __ LDA #$00
+15cc : 85 1c __ STA ACCU + 1
+15ce : 85 1d __ STA ACCU + 2
+15d0 : 85 1e __ STA ACCU + 3
+15d2 : a5 5f __ LDA T4 + 0
+15d4 : 85 03 __ STA $03
+15d6 : a5 60 __ LDA T4 + 1
+15d8 : 85 04 __ STA $04
+15da : a5 61 __ LDA T4 + 2
+15dc : 85 05 __ STA $05
+15de : a5 62 __ LDA T4 + 3
+15e0 : 85 06 __ STA $06
+15e2 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+15e5 : a5 07 __ LDA $07
+15e7 : 85 4a __ STA T10 + 0
+15e9 : a5 08 __ LDA $08
+15eb : 85 4b __ STA T10 + 1
+15ed : a5 09 __ LDA $09
+15ef : 85 4c __ STA T10 + 2
+15f1 : a5 0a __ LDA $0a
+15f3 : 85 4d __ STA T10 + 3
+15f5 : a5 67 __ LDA T8 + 0
+15f7 : 85 4e __ STA T11 + 0
+15f9 : a5 68 __ LDA T8 + 1
+15fb : 85 4f __ STA T11 + 1
+15fd : a5 69 __ LDA T8 + 2
+15ff : 85 50 __ STA T11 + 2
+1601 : a5 6a __ LDA T8 + 3
+1603 : a2 02 __ LDX #$02
+1605 : 06 4e __ ASL T11 + 0
+1607 : 26 4f __ ROL T11 + 1
+1609 : 26 50 __ ROL T11 + 2
+160b : 2a __ __ ROL
+160c : ca __ __ DEX
+160d : d0 f6 __ BNE $1605
+160f : 85 51 __ STA T11 + 3
+1611 : 38 __ __ SEC
+1612 : a5 4a __ LDA T10 + 0
+1614 : e5 4e __ SBC T11 + 0
+1616 : aa __ __ TAX
+1617 : a5 4b __ LDA T10 + 1
+1619 : e5 4f __ SBC T11 + 1
+161b : a8 __ __ TAY
+161c : a5 4c __ LDA T10 + 2
+161e : e5 50 __ SBC T11 + 2
+1620 : 85 4c __ STA T10 + 2
+1622 : a5 4d __ LDA T10 + 3
+1624 : e5 51 __ SBC T11 + 3
+1626 : 85 4d __ STA T10 + 3
+1628 : 18 __ __ CLC
+1629 : 8a __ __ TXA
+162a : 65 63 __ ADC T7 + 0
+162c : 85 63 __ STA T7 + 0
+162e : 85 1b __ STA ACCU + 0
+1630 : 98 __ __ TYA
+1631 : 65 64 __ ADC T7 + 1
+1633 : 85 64 __ STA T7 + 1
+1635 : 85 1c __ STA ACCU + 1
+1637 : a5 4c __ LDA T10 + 2
+1639 : 65 65 __ ADC T7 + 2
+163b : 85 65 __ STA T7 + 2
+163d : 85 1d __ STA ACCU + 2
+163f : a5 4d __ LDA T10 + 3
+1641 : 65 66 __ ADC T7 + 3
+1643 : 85 66 __ STA T7 + 3
+1645 : 85 1e __ STA ACCU + 3
+1647 : a9 06 __ LDA #$06
+1649 : 85 03 __ STA $03
+164b : a9 00 __ LDA #$00
+164d : 85 04 __ STA $04
+164f : 85 05 __ STA $05
+1651 : 85 06 __ STA $06
+1653 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1656 : a5 07 __ LDA $07
+1658 : 85 4a __ STA T10 + 0
+165a : a5 08 __ LDA $08
+165c : 85 4b __ STA T10 + 1
+165e : a5 09 __ LDA $09
+1660 : 85 4c __ STA T10 + 2
+1662 : a5 0a __ LDA $0a
+1664 : 85 4d __ STA T10 + 3
+1666 : a5 5e __ LDA T3 + 3
+1668 : a2 02 __ LDX #$02
+166a : 06 5b __ ASL T3 + 0
+166c : 26 5c __ ROL T3 + 1
+166e : 26 5d __ ROL T3 + 2
+1670 : 2a __ __ ROL
+1671 : ca __ __ DEX
+1672 : d0 f6 __ BNE $166a
+1674 : 85 5e __ STA T3 + 3
+1676 : 38 __ __ SEC
+1677 : a5 4a __ LDA T10 + 0
+1679 : e5 5b __ SBC T3 + 0
+167b : aa __ __ TAX
+167c : a5 4b __ LDA T10 + 1
+167e : e5 5c __ SBC T3 + 1
+1680 : a8 __ __ TAY
+1681 : a5 4c __ LDA T10 + 2
+1683 : e5 5d __ SBC T3 + 2
+1685 : 85 5d __ STA T3 + 2
+1687 : a5 4d __ LDA T10 + 3
+1689 : e5 5e __ SBC T3 + 3
+168b : 85 5e __ STA T3 + 3
+168d : 18 __ __ CLC
+168e : 8a __ __ TXA
+168f : 65 5f __ ADC T4 + 0
+1691 : 85 5f __ STA T4 + 0
+1693 : 85 5b __ STA T3 + 0
+1695 : 98 __ __ TYA
+1696 : 65 60 __ ADC T4 + 1
+1698 : 85 60 __ STA T4 + 1
+169a : 85 5c __ STA T3 + 1
+169c : a5 5d __ LDA T3 + 2
+169e : 65 61 __ ADC T4 + 2
+16a0 : 85 61 __ STA T4 + 2
+16a2 : 85 5d __ STA T3 + 2
+16a4 : a5 5e __ LDA T3 + 3
+16a6 : 65 62 __ ADC T4 + 3
+16a8 : 85 62 __ STA T4 + 3
+16aa : a2 02 __ LDX #$02
+16ac : 06 5b __ ASL T3 + 0
+16ae : 26 5c __ ROL T3 + 1
+16b0 : 26 5d __ ROL T3 + 2
+16b2 : 2a __ __ ROL
+16b3 : ca __ __ DEX
+16b4 : d0 f6 __ BNE $16ac
+16b6 : 85 5e __ STA T3 + 3
+16b8 : 38 __ __ SEC
+16b9 : a5 46 __ LDA T9 + 0
+16bb : e5 5b __ SBC T3 + 0
+16bd : 85 5b __ STA T3 + 0
+16bf : a5 47 __ LDA T9 + 1
+16c1 : e5 5c __ SBC T3 + 1
+16c3 : 85 5c __ STA T3 + 1
+16c5 : a5 48 __ LDA T9 + 2
+16c7 : e5 5d __ SBC T3 + 2
+16c9 : 85 5d __ STA T3 + 2
+16cb : a5 49 __ LDA T9 + 3
+16cd : e5 5e __ SBC T3 + 3
+16cf : 85 5e __ STA T3 + 3
+16d1 : 38 __ __ SEC
+16d2 : a5 67 __ LDA T8 + 0
+16d4 : e5 5b __ SBC T3 + 0
+16d6 : 85 67 __ STA T8 + 0
+16d8 : a5 68 __ LDA T8 + 1
+16da : e5 5c __ SBC T3 + 1
+16dc : 85 68 __ STA T8 + 1
+16de : a5 69 __ LDA T8 + 2
+16e0 : e5 5d __ SBC T3 + 2
+16e2 : 85 69 __ STA T8 + 2
+16e4 : a5 6a __ LDA T8 + 3
+16e6 : e5 5e __ SBC T3 + 3
+16e8 : 85 6a __ STA T8 + 3
+16ea : a5 45 __ LDA T6 + 1
+16ec : 10 03 __ BPL $16f1
+16ee : 4c 81 15 JMP $1581 ; (main + 3201)
+16f1 : d0 09 __ BNE $16fc
+16f3 : a5 44 __ LDA T6 + 0
+16f5 : c9 03 __ CMP #$03
+16f7 : b0 03 __ BCS $16fc
+16f9 : 4c 81 15 JMP $1581 ; (main + 3201)
+16fc : a5 63 __ LDA T7 + 0
+16fe : 45 5f __ EOR T4 + 0
+1700 : aa __ __ TAX
+1701 : a5 64 __ LDA T7 + 1
+1703 : 45 60 __ EOR T4 + 1
+1705 : a8 __ __ TAY
+1706 : a5 65 __ LDA T7 + 2
+1708 : 45 61 __ EOR T4 + 2
+170a : 85 5d __ STA T3 + 2
+170c : a5 66 __ LDA T7 + 3
+170e : 45 62 __ EOR T4 + 3
+1710 : 85 5e __ STA T3 + 3
+1712 : 8a __ __ TXA
+1713 : 45 67 __ EOR T8 + 0
+1715 : 85 5b __ STA T3 + 0
+1717 : 98 __ __ TYA
+1718 : 45 68 __ EOR T8 + 1
+171a : 85 5c __ STA T3 + 1
+171c : a5 5d __ LDA T3 + 2
+171e : 45 69 __ EOR T8 + 2
+1720 : 85 5d __ STA T3 + 2
+1722 : a5 5e __ LDA T3 + 3
+1724 : 45 6a __ EOR T8 + 3
+1726 : 85 5e __ STA T3 + 3
+1728 : a5 56 __ LDA T1 + 1
+172a : 29 80 __ AND #$80
+172c : 10 02 __ BPL $1730
+172e : a9 ff __ LDA #$ff
+1730 : aa __ __ TAX
+1731 : 18 __ __ CLC
+1732 : a5 55 __ LDA T1 + 0
+1734 : 65 5b __ ADC T3 + 0
+1736 : 85 5b __ STA T3 + 0
+1738 : a5 56 __ LDA T1 + 1
+173a : 65 5c __ ADC T3 + 1
+173c : 85 5c __ STA T3 + 1
+173e : 8a __ __ TXA
+173f : 65 5d __ ADC T3 + 2
+1741 : 85 5d __ STA T3 + 2
+1743 : 8a __ __ TXA
+1744 : 65 5e __ ADC T3 + 3
+1746 : 85 5e __ STA T3 + 3
+1748 : 38 __ __ SEC
+1749 : a5 53 __ LDA T0 + 0
+174b : e9 09 __ SBC #$09
+174d : 85 44 __ STA T6 + 0
+174f : a5 54 __ LDA T0 + 1
+1751 : e9 00 __ SBC #$00
+1753 : 85 45 __ STA T6 + 1
+1755 : a9 24 __ LDA #$24
+1757 : 85 5f __ STA T4 + 0
+1759 : a9 00 __ LDA #$00
+175b : 85 60 __ STA T4 + 1
+175d : 85 61 __ STA T4 + 2
+175f : 85 62 __ STA T4 + 3
+1761 : 85 77 __ STA T15 + 0
+1763 : 85 78 __ STA T15 + 1
+1765 : a5 54 __ LDA T0 + 1
+1767 : 29 80 __ AND #$80
+1769 : 10 02 __ BPL $176d
+176b : a9 ff __ LDA #$ff
+176d : aa __ __ TAX
+176e : a8 __ __ TAY
+176f : 38 __ __ SEC
+1770 : a5 53 __ LDA T0 + 0
+1772 : e9 0c __ SBC #$0c
+1774 : 85 67 __ STA T8 + 0
+1776 : a5 54 __ LDA T0 + 1
+1778 : e9 00 __ SBC #$00
+177a : 85 68 __ STA T8 + 1
+177c : 8a __ __ TXA
+177d : e9 00 __ SBC #$00
+177f : 85 69 __ STA T8 + 2
+1781 : 8a __ __ TXA
+1782 : e9 00 __ SBC #$00
+1784 : 85 6a __ STA T8 + 3
+1786 : 18 __ __ CLC
+1787 : a5 53 __ LDA T0 + 0
+1789 : 69 01 __ ADC #$01
+178b : 85 63 __ STA T7 + 0
+178d : a5 54 __ LDA T0 + 1
+178f : 69 00 __ ADC #$00
+1791 : 85 64 __ STA T7 + 1
+1793 : 8a __ __ TXA
+1794 : 69 00 __ ADC #$00
+1796 : 85 65 __ STA T7 + 2
+1798 : 98 __ __ TYA
+1799 : 69 00 __ ADC #$00
+179b : 85 66 __ STA T7 + 3
+179d : a5 77 __ LDA T15 + 0
+179f : 85 46 __ STA T9 + 0
+17a1 : a5 78 __ LDA T15 + 1
+17a3 : 85 47 __ STA T9 + 1
+17a5 : 29 80 __ AND #$80
+17a7 : 10 02 __ BPL $17ab
+17a9 : a9 ff __ LDA #$ff
+17ab : 85 48 __ STA T9 + 2
+17ad : 85 49 __ STA T9 + 3
+17af : e6 77 __ INC T15 + 0
+17b1 : d0 02 __ BNE $17b5
+17b3 : e6 78 __ INC T15 + 1
+17b5 : a9 06 __ LDA #$06
+17b7 : 85 1b __ STA ACCU + 0
+17b9 : a9 00 __ LDA #$00
+17bb : 85 1c __ STA ACCU + 1
+17bd : 85 1d __ STA ACCU + 2
+17bf : 85 1e __ STA ACCU + 3
+17c1 : a5 46 __ LDA T9 + 0
+17c3 : 85 03 __ STA $03
+17c5 : a5 47 __ LDA T9 + 1
+17c7 : 85 04 __ STA $04
+17c9 : a5 48 __ LDA T9 + 2
+17cb : 85 05 __ STA $05
+17cd : 85 06 __ STA $06
+17cf : 20 dd 25 JSR $25dd ; (mul32 + 0)
+17d2 : a5 07 __ LDA $07
+17d4 : 85 4a __ STA T10 + 0
+17d6 : a5 08 __ LDA $08
+17d8 : 85 4b __ STA T10 + 1
+17da : a5 09 __ LDA $09
+17dc : 85 4c __ STA T10 + 2
+17de : a5 0a __ LDA $0a
+17e0 : 85 4d __ STA T10 + 3
+17e2 : a9 06 __ LDA #$06
+17e4 : 85 1b __ STA ACCU + 0
+17e6 : a9 00 __ LDA #$00
+17e8 : 85 1c __ STA ACCU + 1
+17ea : 85 1d __ STA ACCU + 2
+17ec : 85 1e __ STA ACCU + 3
+17ee : a5 5f __ LDA T4 + 0
+17f0 : 85 03 __ STA $03
+17f2 : a5 60 __ LDA T4 + 1
+17f4 : 85 04 __ STA $04
+17f6 : a5 61 __ LDA T4 + 2
+17f8 : 85 05 __ STA $05
+17fa : a5 62 __ LDA T4 + 3
+17fc : 85 06 __ STA $06
+17fe : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1801 : a5 07 __ LDA $07
+1803 : 85 4e __ STA T11 + 0
+1805 : a5 08 __ LDA $08
+1807 : 85 4f __ STA T11 + 1
+1809 : a5 09 __ LDA $09
+180b : 85 50 __ STA T11 + 2
+180d : a5 0a __ LDA $0a
+180f : 85 51 __ STA T11 + 3
+1811 : a5 67 __ LDA T8 + 0
+1813 : 85 6b __ STA T12 + 0
+1815 : a5 68 __ LDA T8 + 1
+1817 : 85 6c __ STA T12 + 1
+1819 : a5 69 __ LDA T8 + 2
+181b : 85 6d __ STA T12 + 2
+181d : a5 6a __ LDA T8 + 3
+181f : a2 02 __ LDX #$02
+1821 : 06 6b __ ASL T12 + 0
+1823 : 26 6c __ ROL T12 + 1
+1825 : 26 6d __ ROL T12 + 2
+1827 : 2a __ __ ROL
+1828 : ca __ __ DEX
+1829 : d0 f6 __ BNE $1821
+182b : 85 6e __ STA T12 + 3
+182d : 38 __ __ SEC
+182e : a5 4e __ LDA T11 + 0
+1830 : e5 6b __ SBC T12 + 0
+1832 : aa __ __ TAX
+1833 : a5 4f __ LDA T11 + 1
+1835 : e5 6c __ SBC T12 + 1
+1837 : a8 __ __ TAY
+1838 : a5 50 __ LDA T11 + 2
+183a : e5 6d __ SBC T12 + 2
+183c : 85 50 __ STA T11 + 2
+183e : a5 51 __ LDA T11 + 3
+1840 : e5 6e __ SBC T12 + 3
+1842 : 85 51 __ STA T11 + 3
+1844 : 18 __ __ CLC
+1845 : 8a __ __ TXA
+1846 : 65 63 __ ADC T7 + 0
+1848 : 85 63 __ STA T7 + 0
+184a : 85 1b __ STA ACCU + 0
+184c : 98 __ __ TYA
+184d : 65 64 __ ADC T7 + 1
+184f : 85 64 __ STA T7 + 1
+1851 : 85 1c __ STA ACCU + 1
+1853 : a5 50 __ LDA T11 + 2
+1855 : 65 65 __ ADC T7 + 2
+1857 : 85 65 __ STA T7 + 2
+1859 : 85 1d __ STA ACCU + 2
+185b : a5 51 __ LDA T11 + 3
+185d : 65 66 __ ADC T7 + 3
+185f : 85 66 __ STA T7 + 3
+1861 : 85 1e __ STA ACCU + 3
+1863 : a9 06 __ LDA #$06
+1865 : 85 03 __ STA $03
+1867 : a9 00 __ LDA #$00
+1869 : 85 04 __ STA $04
+186b : 85 05 __ STA $05
+186d : 85 06 __ STA $06
+186f : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1872 : a5 07 __ LDA $07
+1874 : 85 4e __ STA T11 + 0
+1876 : a5 08 __ LDA $08
+1878 : 85 4f __ STA T11 + 1
+187a : a5 09 __ LDA $09
+187c : 85 50 __ STA T11 + 2
+187e : a5 0a __ LDA $0a
+1880 : 85 51 __ STA T11 + 3
+1882 : a5 49 __ LDA T9 + 3
+1884 : a2 02 __ LDX #$02
+1886 : 06 46 __ ASL T9 + 0
+1888 : 26 47 __ ROL T9 + 1
+188a : 26 48 __ ROL T9 + 2
+188c : 2a __ __ ROL
+188d : ca __ __ DEX
+188e : d0 f6 __ BNE $1886
+1890 : 85 49 __ STA T9 + 3
+1892 : 38 __ __ SEC
+1893 : a5 4e __ LDA T11 + 0
+1895 : e5 46 __ SBC T9 + 0
+1897 : aa __ __ TAX
+1898 : a5 4f __ LDA T11 + 1
+189a : e5 47 __ SBC T9 + 1
+189c : a8 __ __ TAY
+189d : a5 50 __ LDA T11 + 2
+189f : e5 48 __ SBC T9 + 2
+18a1 : 85 48 __ STA T9 + 2
+18a3 : a5 51 __ LDA T11 + 3
+18a5 : e5 49 __ SBC T9 + 3
+18a7 : 85 49 __ STA T9 + 3
+18a9 : 18 __ __ CLC
+18aa : 8a __ __ TXA
+18ab : 65 5f __ ADC T4 + 0
+18ad : 85 5f __ STA T4 + 0
+18af : 85 46 __ STA T9 + 0
+18b1 : 98 __ __ TYA
+18b2 : 65 60 __ ADC T4 + 1
+18b4 : 85 60 __ STA T4 + 1
+18b6 : 85 47 __ STA T9 + 1
+18b8 : a5 48 __ LDA T9 + 2
+18ba : 65 61 __ ADC T4 + 2
+18bc : 85 61 __ STA T4 + 2
+18be : 85 48 __ STA T9 + 2
+18c0 : a5 49 __ LDA T9 + 3
+18c2 : 65 62 __ ADC T4 + 3
+18c4 : 85 62 __ STA T4 + 3
+18c6 : a2 02 __ LDX #$02
+18c8 : 06 46 __ ASL T9 + 0
+18ca : 26 47 __ ROL T9 + 1
+18cc : 26 48 __ ROL T9 + 2
+18ce : 2a __ __ ROL
+18cf : ca __ __ DEX
+18d0 : d0 f6 __ BNE $18c8
+18d2 : 85 49 __ STA T9 + 3
+18d4 : 38 __ __ SEC
+18d5 : a5 4a __ LDA T10 + 0
+18d7 : e5 46 __ SBC T9 + 0
+18d9 : 85 46 __ STA T9 + 0
+18db : a5 4b __ LDA T10 + 1
+18dd : e5 47 __ SBC T9 + 1
+18df : 85 47 __ STA T9 + 1
+18e1 : a5 4c __ LDA T10 + 2
+18e3 : e5 48 __ SBC T9 + 2
+18e5 : 85 48 __ STA T9 + 2
+18e7 : a5 4d __ LDA T10 + 3
+18e9 : e5 49 __ SBC T9 + 3
+18eb : 85 49 __ STA T9 + 3
+18ed : 38 __ __ SEC
+18ee : a5 67 __ LDA T8 + 0
+18f0 : e5 46 __ SBC T9 + 0
+18f2 : 85 67 __ STA T8 + 0
+18f4 : a5 68 __ LDA T8 + 1
+18f6 : e5 47 __ SBC T9 + 1
+18f8 : 85 68 __ STA T8 + 1
+18fa : a5 69 __ LDA T8 + 2
+18fc : e5 48 __ SBC T9 + 2
+18fe : 85 69 __ STA T8 + 2
+1900 : a5 6a __ LDA T8 + 3
+1902 : e5 49 __ SBC T9 + 3
+1904 : 85 6a __ STA T8 + 3
+1906 : a5 78 __ LDA T15 + 1
+1908 : 10 03 __ BPL $190d
+190a : 4c 9d 17 JMP $179d ; (main + 3741)
+190d : d0 09 __ BNE $1918
+190f : a5 77 __ LDA T15 + 0
+1911 : c9 03 __ CMP #$03
+1913 : b0 03 __ BCS $1918
+1915 : 4c 9d 17 JMP $179d ; (main + 3741)
+1918 : a9 1b __ LDA #$1b
+191a : 85 46 __ STA T9 + 0
+191c : a9 00 __ LDA #$00
+191e : 85 47 __ STA T9 + 1
+1920 : 85 48 __ STA T9 + 2
+1922 : 85 49 __ STA T9 + 3
+1924 : 85 77 __ STA T15 + 0
+1926 : 85 78 __ STA T15 + 1
+1928 : a5 63 __ LDA T7 + 0
+192a : 45 5f __ EOR T4 + 0
+192c : aa __ __ TAX
+192d : a5 64 __ LDA T7 + 1
+192f : 45 60 __ EOR T4 + 1
+1931 : a8 __ __ TAY
+1932 : a5 65 __ LDA T7 + 2
+1934 : 45 61 __ EOR T4 + 2
+1936 : 85 61 __ STA T4 + 2
+1938 : a5 66 __ LDA T7 + 3
+193a : 45 62 __ EOR T4 + 3
+193c : 85 62 __ STA T4 + 3
+193e : 8a __ __ TXA
+193f : 45 67 __ EOR T8 + 0
+1941 : 85 5f __ STA T4 + 0
+1943 : 98 __ __ TYA
+1944 : 45 68 __ EOR T8 + 1
+1946 : 85 60 __ STA T4 + 1
+1948 : a5 61 __ LDA T4 + 2
+194a : 45 69 __ EOR T8 + 2
+194c : 85 61 __ STA T4 + 2
+194e : a5 62 __ LDA T4 + 3
+1950 : 45 6a __ EOR T8 + 3
+1952 : 85 62 __ STA T4 + 3
+1954 : a5 45 __ LDA T6 + 1
+1956 : 29 80 __ AND #$80
+1958 : 10 02 __ BPL $195c
+195a : a9 ff __ LDA #$ff
+195c : aa __ __ TAX
+195d : 18 __ __ CLC
+195e : a5 44 __ LDA T6 + 0
+1960 : 65 5f __ ADC T4 + 0
+1962 : a8 __ __ TAY
+1963 : a5 45 __ LDA T6 + 1
+1965 : 65 60 __ ADC T4 + 1
+1967 : 85 60 __ STA T4 + 1
+1969 : 8a __ __ TXA
+196a : 65 61 __ ADC T4 + 2
+196c : 85 61 __ STA T4 + 2
+196e : 8a __ __ TXA
+196f : 65 62 __ ADC T4 + 3
+1971 : aa __ __ TAX
+1972 : 38 __ __ SEC
+1973 : 98 __ __ TYA
+1974 : e9 09 __ SBC #$09
+1976 : 85 63 __ STA T7 + 0
+1978 : a5 60 __ LDA T4 + 1
+197a : e9 00 __ SBC #$00
+197c : 85 64 __ STA T7 + 1
+197e : a5 61 __ LDA T4 + 2
+1980 : e9 00 __ SBC #$00
+1982 : 85 65 __ STA T7 + 2
+1984 : 8a __ __ TXA
+1985 : e9 00 __ SBC #$00
+1987 : 85 66 __ STA T7 + 3
+1989 : 18 __ __ CLC
+198a : 98 __ __ TYA
+198b : 69 01 __ ADC #$01
+198d : 85 5f __ STA T4 + 0
+198f : a5 60 __ LDA T4 + 1
+1991 : 69 00 __ ADC #$00
+1993 : 85 60 __ STA T4 + 1
+1995 : a5 61 __ LDA T4 + 2
+1997 : 69 00 __ ADC #$00
+1999 : 85 61 __ STA T4 + 2
+199b : 8a __ __ TXA
+199c : 69 00 __ ADC #$00
+199e : 85 62 __ STA T4 + 3
+19a0 : a5 77 __ LDA T15 + 0
+19a2 : 85 67 __ STA T8 + 0
+19a4 : a5 78 __ LDA T15 + 1
+19a6 : 85 68 __ STA T8 + 1
+19a8 : 29 80 __ AND #$80
+19aa : 10 02 __ BPL $19ae
+19ac : a9 ff __ LDA #$ff
+19ae : 85 69 __ STA T8 + 2
+19b0 : 85 6a __ STA T8 + 3
+19b2 : e6 77 __ INC T15 + 0
+19b4 : d0 02 __ BNE $19b8
+19b6 : e6 78 __ INC T15 + 1
+19b8 : a9 06 __ LDA #$06
+19ba : 85 1b __ STA ACCU + 0
+19bc : a9 00 __ LDA #$00
+19be : 85 1c __ STA ACCU + 1
+19c0 : 85 1d __ STA ACCU + 2
+19c2 : 85 1e __ STA ACCU + 3
+19c4 : a5 67 __ LDA T8 + 0
+19c6 : 85 03 __ STA $03
+19c8 : a5 68 __ LDA T8 + 1
+19ca : 85 04 __ STA $04
+19cc : a5 69 __ LDA T8 + 2
+19ce : 85 05 __ STA $05
+19d0 : 85 06 __ STA $06
+19d2 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+19d5 : a5 07 __ LDA $07
+19d7 : 85 4a __ STA T10 + 0
+19d9 : a5 08 __ LDA $08
+19db : 85 4b __ STA T10 + 1
+19dd : a5 09 __ LDA $09
+19df : 85 4c __ STA T10 + 2
+19e1 : a5 0a __ LDA $0a
+19e3 : 85 4d __ STA T10 + 3
+19e5 : a9 06 __ LDA #$06
+19e7 : 85 1b __ STA ACCU + 0
+19e9 : a9 00 __ LDA #$00
+19eb : 85 1c __ STA ACCU + 1
+19ed : 85 1d __ STA ACCU + 2
+19ef : 85 1e __ STA ACCU + 3
+19f1 : a5 46 __ LDA T9 + 0
+19f3 : 85 03 __ STA $03
+19f5 : a5 47 __ LDA T9 + 1
+19f7 : 85 04 __ STA $04
+19f9 : a5 48 __ LDA T9 + 2
+19fb : 85 05 __ STA $05
+19fd : a5 49 __ LDA T9 + 3
+19ff : 85 06 __ STA $06
+1a01 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1a04 : a5 07 __ LDA $07
+1a06 : 85 4e __ STA T11 + 0
+1a08 : a5 08 __ LDA $08
+1a0a : 85 4f __ STA T11 + 1
+1a0c : a5 09 __ LDA $09
+1a0e : 85 50 __ STA T11 + 2
+1a10 : a5 0a __ LDA $0a
+1a12 : 85 51 __ STA T11 + 3
+1a14 : a5 63 __ LDA T7 + 0
+1a16 : 85 6b __ STA T12 + 0
+1a18 : a5 64 __ LDA T7 + 1
+1a1a : 85 6c __ STA T12 + 1
+1a1c : a5 65 __ LDA T7 + 2
+1a1e : 85 6d __ STA T12 + 2
+1a20 : a5 66 __ LDA T7 + 3
+1a22 : a2 02 __ LDX #$02
+1a24 : 06 6b __ ASL T12 + 0
+1a26 : 26 6c __ ROL T12 + 1
+1a28 : 26 6d __ ROL T12 + 2
+1a2a : 2a __ __ ROL
+1a2b : ca __ __ DEX
+1a2c : d0 f6 __ BNE $1a24
+1a2e : 85 6e __ STA T12 + 3
+1a30 : 38 __ __ SEC
+1a31 : a5 4e __ LDA T11 + 0
+1a33 : e5 6b __ SBC T12 + 0
+1a35 : aa __ __ TAX
+1a36 : a5 4f __ LDA T11 + 1
+1a38 : e5 6c __ SBC T12 + 1
+1a3a : a8 __ __ TAY
+1a3b : a5 50 __ LDA T11 + 2
+1a3d : e5 6d __ SBC T12 + 2
+1a3f : 85 50 __ STA T11 + 2
+1a41 : a5 51 __ LDA T11 + 3
+1a43 : e5 6e __ SBC T12 + 3
+1a45 : 85 51 __ STA T11 + 3
+1a47 : 18 __ __ CLC
+1a48 : 8a __ __ TXA
+1a49 : 65 5f __ ADC T4 + 0
+1a4b : 85 5f __ STA T4 + 0
+1a4d : 85 1b __ STA ACCU + 0
+1a4f : 98 __ __ TYA
+1a50 : 65 60 __ ADC T4 + 1
+1a52 : 85 60 __ STA T4 + 1
+1a54 : 85 1c __ STA ACCU + 1
+1a56 : a5 50 __ LDA T11 + 2
+1a58 : 65 61 __ ADC T4 + 2
+1a5a : 85 61 __ STA T4 + 2
+1a5c : 85 1d __ STA ACCU + 2
+1a5e : a5 51 __ LDA T11 + 3
+1a60 : 65 62 __ ADC T4 + 3
+1a62 : 85 62 __ STA T4 + 3
+1a64 : 85 1e __ STA ACCU + 3
+1a66 : a9 06 __ LDA #$06
+1a68 : 85 03 __ STA $03
+1a6a : a9 00 __ LDA #$00
+1a6c : 85 04 __ STA $04
+1a6e : 85 05 __ STA $05
+1a70 : 85 06 __ STA $06
+1a72 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1a75 : a5 07 __ LDA $07
+1a77 : 85 4e __ STA T11 + 0
+1a79 : a5 08 __ LDA $08
+1a7b : 85 4f __ STA T11 + 1
+1a7d : a5 09 __ LDA $09
+1a7f : 85 50 __ STA T11 + 2
+1a81 : a5 0a __ LDA $0a
+1a83 : 85 51 __ STA T11 + 3
+1a85 : a5 6a __ LDA T8 + 3
+1a87 : a2 02 __ LDX #$02
+1a89 : 06 67 __ ASL T8 + 0
+1a8b : 26 68 __ ROL T8 + 1
+1a8d : 26 69 __ ROL T8 + 2
+1a8f : 2a __ __ ROL
+1a90 : ca __ __ DEX
+1a91 : d0 f6 __ BNE $1a89
+1a93 : 85 6a __ STA T8 + 3
+1a95 : 38 __ __ SEC
+1a96 : a5 4e __ LDA T11 + 0
+1a98 : e5 67 __ SBC T8 + 0
+1a9a : aa __ __ TAX
+1a9b : a5 4f __ LDA T11 + 1
+1a9d : e5 68 __ SBC T8 + 1
+1a9f : a8 __ __ TAY
+1aa0 : a5 50 __ LDA T11 + 2
+1aa2 : e5 69 __ SBC T8 + 2
+1aa4 : 85 69 __ STA T8 + 2
+1aa6 : a5 51 __ LDA T11 + 3
+1aa8 : e5 6a __ SBC T8 + 3
+1aaa : 85 6a __ STA T8 + 3
+1aac : 18 __ __ CLC
+1aad : 8a __ __ TXA
+1aae : 65 46 __ ADC T9 + 0
+1ab0 : 85 46 __ STA T9 + 0
+1ab2 : 85 67 __ STA T8 + 0
+1ab4 : 98 __ __ TYA
+1ab5 : 65 47 __ ADC T9 + 1
+1ab7 : 85 47 __ STA T9 + 1
+1ab9 : 85 68 __ STA T8 + 1
+1abb : a5 69 __ LDA T8 + 2
+1abd : 65 48 __ ADC T9 + 2
+1abf : 85 48 __ STA T9 + 2
+1ac1 : 85 69 __ STA T8 + 2
+1ac3 : a5 6a __ LDA T8 + 3
+1ac5 : 65 49 __ ADC T9 + 3
+1ac7 : 85 49 __ STA T9 + 3
+1ac9 : a2 02 __ LDX #$02
+1acb : 06 67 __ ASL T8 + 0
+1acd : 26 68 __ ROL T8 + 1
+1acf : 26 69 __ ROL T8 + 2
+1ad1 : 2a __ __ ROL
+1ad2 : ca __ __ DEX
+1ad3 : d0 f6 __ BNE $1acb
+1ad5 : 85 6a __ STA T8 + 3
+1ad7 : 38 __ __ SEC
+1ad8 : a5 4a __ LDA T10 + 0
+1ada : e5 67 __ SBC T8 + 0
+1adc : 85 67 __ STA T8 + 0
+1ade : a5 4b __ LDA T10 + 1
+1ae0 : e5 68 __ SBC T8 + 1
+1ae2 : 85 68 __ STA T8 + 1
+1ae4 : a5 4c __ LDA T10 + 2
+1ae6 : e5 69 __ SBC T8 + 2
+1ae8 : 85 69 __ STA T8 + 2
+1aea : a5 4d __ LDA T10 + 3
+1aec : e5 6a __ SBC T8 + 3
+1aee : 85 6a __ STA T8 + 3
+1af0 : 38 __ __ SEC
+1af1 : a5 63 __ LDA T7 + 0
+1af3 : e5 67 __ SBC T8 + 0
+1af5 : 85 63 __ STA T7 + 0
+1af7 : a5 64 __ LDA T7 + 1
+1af9 : e5 68 __ SBC T8 + 1
+1afb : 85 64 __ STA T7 + 1
+1afd : a5 65 __ LDA T7 + 2
+1aff : e5 69 __ SBC T8 + 2
+1b01 : 85 65 __ STA T7 + 2
+1b03 : a5 66 __ LDA T7 + 3
+1b05 : e5 6a __ SBC T8 + 3
+1b07 : 85 66 __ STA T7 + 3
+1b09 : a5 78 __ LDA T15 + 1
+1b0b : 10 03 __ BPL $1b10
+1b0d : 4c a0 19 JMP $19a0 ; (main + 4256)
+1b10 : d0 09 __ BNE $1b1b
+1b12 : a5 77 __ LDA T15 + 0
+1b14 : c9 03 __ CMP #$03
+1b16 : b0 03 __ BCS $1b1b
+1b18 : 4c a0 19 JMP $19a0 ; (main + 4256)
+1b1b : a5 5f __ LDA T4 + 0
+1b1d : 45 46 __ EOR T9 + 0
+1b1f : aa __ __ TAX
+1b20 : a5 60 __ LDA T4 + 1
+1b22 : 45 47 __ EOR T9 + 1
+1b24 : a8 __ __ TAY
+1b25 : a5 61 __ LDA T4 + 2
+1b27 : 45 48 __ EOR T9 + 2
+1b29 : 85 61 __ STA T4 + 2
+1b2b : a5 62 __ LDA T4 + 3
+1b2d : 45 49 __ EOR T9 + 3
+1b2f : 85 62 __ STA T4 + 3
+1b31 : 8a __ __ TXA
+1b32 : 45 63 __ EOR T7 + 0
+1b34 : 85 5f __ STA T4 + 0
+1b36 : 98 __ __ TYA
+1b37 : 45 64 __ EOR T7 + 1
+1b39 : 85 60 __ STA T4 + 1
+1b3b : a5 61 __ LDA T4 + 2
+1b3d : 45 65 __ EOR T7 + 2
+1b3f : 85 61 __ STA T4 + 2
+1b41 : a5 62 __ LDA T4 + 3
+1b43 : 45 66 __ EOR T7 + 3
+1b45 : 85 62 __ STA T4 + 3
+1b47 : a9 00 __ LDA #$00
+1b49 : 29 80 __ AND #$80
+1b4b : 10 02 __ BPL $1b4f
+1b4d : a9 ff __ LDA #$ff
+1b4f : aa __ __ TAX
+1b50 : 18 __ __ CLC
+1b51 : a9 0c __ LDA #$0c
+1b53 : 65 5f __ ADC T4 + 0
+1b55 : 85 1b __ STA ACCU + 0
+1b57 : a9 00 __ LDA #$00
+1b59 : 65 60 __ ADC T4 + 1
+1b5b : 85 1c __ STA ACCU + 1
+1b5d : 8a __ __ TXA
+1b5e : 65 61 __ ADC T4 + 2
+1b60 : 85 1d __ STA ACCU + 2
+1b62 : 8a __ __ TXA
+1b63 : 65 62 __ ADC T4 + 3
+1b65 : 85 1e __ STA ACCU + 3
+1b67 : a5 5b __ LDA T3 + 0
+1b69 : 85 03 __ STA $03
+1b6b : a5 5c __ LDA T3 + 1
+1b6d : 85 04 __ STA $04
+1b6f : a5 5d __ LDA T3 + 2
+1b71 : 85 05 __ STA $05
+1b73 : a5 5e __ LDA T3 + 3
+1b75 : 85 06 __ STA $06
+1b77 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1b7a : a5 5a __ LDA T2 + 3
+1b7c : c5 0a __ CMP $0a
+1b7e : d0 12 __ BNE $1b92
+1b80 : a5 59 __ LDA T2 + 2
+1b82 : c5 09 __ CMP $09
+1b84 : d0 0c __ BNE $1b92
+1b86 : a5 58 __ LDA T2 + 1
+1b88 : c5 08 __ CMP $08
+1b8a : d0 06 __ BNE $1b92
+1b8c : a5 57 __ LDA T2 + 0
+1b8e : c5 07 __ CMP $07
+1b90 : f0 09 __ BEQ $1b9b
+1b92 : a9 ff __ LDA #$ff
+1b94 : 85 0d __ STA P0
+1b96 : 85 0e __ STA P1
+1b98 : 20 62 1e JSR $1e62 ; (exit + 0)
+1b9b : a5 54 __ LDA T0 + 1
+1b9d : 29 80 __ AND #$80
+1b9f : 10 02 __ BPL $1ba3
+1ba1 : a9 ff __ LDA #$ff
+1ba3 : 85 59 __ STA T2 + 2
+1ba5 : 85 5a __ STA T2 + 3
+1ba7 : a5 53 __ LDA T0 + 0
+1ba9 : a0 02 __ LDY #$02
+1bab : 91 23 __ STA (SP + 0),y
+1bad : a5 54 __ LDA T0 + 1
+1baf : c8 __ __ INY
+1bb0 : 91 23 __ STA (SP + 0),y
+1bb2 : a5 59 __ LDA T2 + 2
+1bb4 : c8 __ __ INY
+1bb5 : 91 23 __ STA (SP + 0),y
+1bb7 : c8 __ __ INY
+1bb8 : 91 23 __ STA (SP + 0),y
+1bba : a9 0c __ LDA #$0c
+1bbc : c8 __ __ INY
+1bbd : 91 23 __ STA (SP + 0),y
+1bbf : a9 00 __ LDA #$00
+1bc1 : c8 __ __ INY
+1bc2 : 91 23 __ STA (SP + 0),y
+1bc4 : c8 __ __ INY
+1bc5 : 91 23 __ STA (SP + 0),y
+1bc7 : c8 __ __ INY
+1bc8 : 91 23 __ STA (SP + 0),y
+1bca : a9 7b __ LDA #$7b
+1bcc : 85 1b __ STA ACCU + 0
+1bce : a9 1d __ LDA #$1d
+1bd0 : 85 1c __ STA ACCU + 1
+1bd2 : 20 da 25 JSR $25da ; (bcexec + 0)
+1bd5 : 38 __ __ SEC
+1bd6 : a5 53 __ LDA T0 + 0
+1bd8 : e9 09 __ SBC #$09
+1bda : aa __ __ TAX
+1bdb : a5 54 __ LDA T0 + 1
+1bdd : e9 00 __ SBC #$00
+1bdf : 85 58 __ STA T2 + 1
+1be1 : a5 59 __ LDA T2 + 2
+1be3 : e9 00 __ SBC #$00
+1be5 : 85 59 __ STA T2 + 2
+1be7 : a5 5a __ LDA T2 + 3
+1be9 : e9 00 __ SBC #$00
+1beb : 85 5a __ STA T2 + 3
+1bed : 18 __ __ CLC
+1bee : 8a __ __ TXA
+1bef : 65 1b __ ADC ACCU + 0
+1bf1 : 85 57 __ STA T2 + 0
+1bf3 : a0 02 __ LDY #$02
+1bf5 : 91 23 __ STA (SP + 0),y
+1bf7 : a5 58 __ LDA T2 + 1
+1bf9 : 65 1c __ ADC ACCU + 1
+1bfb : 85 58 __ STA T2 + 1
+1bfd : c8 __ __ INY
+1bfe : 91 23 __ STA (SP + 0),y
+1c00 : a5 59 __ LDA T2 + 2
+1c02 : 65 1d __ ADC ACCU + 2
+1c04 : 85 59 __ STA T2 + 2
+1c06 : c8 __ __ INY
+1c07 : 91 23 __ STA (SP + 0),y
+1c09 : a5 5a __ LDA T2 + 3
+1c0b : 65 1e __ ADC ACCU + 3
+1c0d : 85 5a __ STA T2 + 3
+1c0f : c8 __ __ INY
+1c10 : 91 23 __ STA (SP + 0),y
+1c12 : a9 09 __ LDA #$09
+1c14 : c8 __ __ INY
+1c15 : 91 23 __ STA (SP + 0),y
+1c17 : a9 00 __ LDA #$00
+1c19 : c8 __ __ INY
+1c1a : 91 23 __ STA (SP + 0),y
+1c1c : c8 __ __ INY
+1c1d : 91 23 __ STA (SP + 0),y
+1c1f : c8 __ __ INY
+1c20 : 91 23 __ STA (SP + 0),y
+1c22 : a9 7b __ LDA #$7b
+1c24 : 85 1b __ STA ACCU + 0
+1c26 : a9 1d __ LDA #$1d
+1c28 : 85 1c __ STA ACCU + 1
+1c2a : 20 da 25 JSR $25da ; (bcexec + 0)
+1c2d : 18 __ __ CLC
+1c2e : a9 0c __ LDA #$0c
+1c30 : 65 1b __ ADC ACCU + 0
+1c32 : 85 1b __ STA ACCU + 0
+1c34 : a9 00 __ LDA #$00
+1c36 : 65 1c __ ADC ACCU + 1
+1c38 : 85 1c __ STA ACCU + 1
+1c3a : a9 00 __ LDA #$00
+1c3c : 65 1d __ ADC ACCU + 2
+1c3e : 85 1d __ STA ACCU + 2
+1c40 : a9 00 __ LDA #$00
+1c42 : 65 1e __ ADC ACCU + 3
+1c44 : 85 1e __ STA ACCU + 3
+1c46 : a5 57 __ LDA T2 + 0
+1c48 : 85 03 __ STA $03
+1c4a : a5 58 __ LDA T2 + 1
+1c4c : 85 04 __ STA $04
+1c4e : a5 59 __ LDA T2 + 2
+1c50 : 85 05 __ STA $05
+1c52 : a5 5a __ LDA T2 + 3
+1c54 : 85 06 __ STA $06
+1c56 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1c59 : a5 54 __ LDA T0 + 1
+1c5b : 85 1c __ STA ACCU + 1
+1c5d : 29 80 __ AND #$80
+1c5f : 10 02 __ BPL $1c63
+1c61 : a9 ff __ LDA #$ff
+1c63 : aa __ __ TAX
+1c64 : 85 1d __ STA ACCU + 2
+1c66 : a5 53 __ LDA T0 + 0
+1c68 : 85 1b __ STA ACCU + 0
+1c6a : 8a __ __ TXA
+1c6b : 86 1e __ STX ACCU + 3
+1c6d : a9 06 __ LDA #$06
+1c6f : 85 03 __ STA $03
+1c71 : a9 00 __ LDA #$00
+1c73 : 85 04 __ STA $04
+1c75 : 85 05 __ STA $05
+1c77 : 85 06 __ STA $06
+1c79 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1c7c : 38 __ __ SEC
+1c7d : a5 07 __ LDA $07
+1c7f : e9 30 __ SBC #$30
+1c81 : 85 5b __ STA T3 + 0
+1c83 : a5 08 __ LDA $08
+1c85 : e9 00 __ SBC #$00
+1c87 : 85 5c __ STA T3 + 1
+1c89 : a5 09 __ LDA $09
+1c8b : e9 00 __ SBC #$00
+1c8d : 85 5d __ STA T3 + 2
+1c8f : a5 0a __ LDA $0a
+1c91 : e9 00 __ SBC #$00
+1c93 : 85 5e __ STA T3 + 3
+1c95 : 38 __ __ SEC
+1c96 : a5 53 __ LDA T0 + 0
+1c98 : e9 09 __ SBC #$09
+1c9a : aa __ __ TAX
+1c9b : a5 54 __ LDA T0 + 1
+1c9d : e9 00 __ SBC #$00
+1c9f : a8 __ __ TAY
+1ca0 : 29 80 __ AND #$80
+1ca2 : 10 02 __ BPL $1ca6
+1ca4 : a9 ff __ LDA #$ff
+1ca6 : 85 61 __ STA T4 + 2
+1ca8 : 18 __ __ CLC
+1ca9 : 8a __ __ TXA
+1caa : 65 5b __ ADC T3 + 0
+1cac : 85 5b __ STA T3 + 0
+1cae : 85 1b __ STA ACCU + 0
+1cb0 : 98 __ __ TYA
+1cb1 : 65 5c __ ADC T3 + 1
+1cb3 : 85 5c __ STA T3 + 1
+1cb5 : 85 1c __ STA ACCU + 1
+1cb7 : a5 61 __ LDA T4 + 2
+1cb9 : 65 5d __ ADC T3 + 2
+1cbb : 85 5d __ STA T3 + 2
+1cbd : 85 1d __ STA ACCU + 2
+1cbf : a5 61 __ LDA T4 + 2
+1cc1 : 65 5e __ ADC T3 + 3
+1cc3 : 85 5e __ STA T3 + 3
+1cc5 : 85 1e __ STA ACCU + 3
+1cc7 : a9 06 __ LDA #$06
+1cc9 : 85 03 __ STA $03
+1ccb : a9 00 __ LDA #$00
+1ccd : 85 04 __ STA $04
+1ccf : 85 05 __ STA $05
+1cd1 : 85 06 __ STA $06
+1cd3 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1cd6 : 38 __ __ SEC
+1cd7 : a5 07 __ LDA $07
+1cd9 : e9 24 __ SBC #$24
+1cdb : aa __ __ TAX
+1cdc : a5 08 __ LDA $08
+1cde : e9 00 __ SBC #$00
+1ce0 : a8 __ __ TAY
+1ce1 : a5 09 __ LDA $09
+1ce3 : e9 00 __ SBC #$00
+1ce5 : 85 61 __ STA T4 + 2
+1ce7 : a5 0a __ LDA $0a
+1ce9 : e9 00 __ SBC #$00
+1ceb : 85 62 __ STA T4 + 3
+1ced : 18 __ __ CLC
+1cee : 8a __ __ TXA
+1cef : 69 0c __ ADC #$0c
+1cf1 : 85 1b __ STA ACCU + 0
+1cf3 : 98 __ __ TYA
+1cf4 : 69 00 __ ADC #$00
+1cf6 : 85 1c __ STA ACCU + 1
+1cf8 : a5 61 __ LDA T4 + 2
+1cfa : 69 00 __ ADC #$00
+1cfc : 85 1d __ STA ACCU + 2
+1cfe : a5 62 __ LDA T4 + 3
+1d00 : 69 00 __ ADC #$00
+1d02 : 85 1e __ STA ACCU + 3
+1d04 : a5 5b __ LDA T3 + 0
+1d06 : 85 03 __ STA $03
+1d08 : a5 5c __ LDA T3 + 1
+1d0a : 85 04 __ STA $04
+1d0c : a5 5d __ LDA T3 + 2
+1d0e : 85 05 __ STA $05
+1d10 : a5 5e __ LDA T3 + 3
+1d12 : 85 06 __ STA $06
+1d14 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1d17 : a5 0a __ LDA $0a
+1d19 : c5 0a __ CMP $0a
+1d1b : d0 12 __ BNE $1d2f
+1d1d : a5 09 __ LDA $09
+1d1f : c5 09 __ CMP $09
+1d21 : d0 0c __ BNE $1d2f
+1d23 : a5 08 __ LDA $08
+1d25 : c5 08 __ CMP $08
+1d27 : d0 06 __ BNE $1d2f
+1d29 : a5 07 __ LDA $07
+1d2b : c5 07 __ CMP $07
+1d2d : f0 09 __ BEQ $1d38
+1d2f : a9 ff __ LDA #$ff
+1d31 : 85 0d __ STA P0
+1d33 : 85 0e __ STA P1
+1d35 : 20 62 1e JSR $1e62 ; (exit + 0)
+1d38 : e6 53 __ INC T0 + 0
+1d3a : d0 02 __ BNE $1d3e
+1d3c : e6 54 __ INC T0 + 1
+1d3e : a5 54 __ LDA T0 + 1
+1d40 : 10 03 __ BPL $1d45
+1d42 : 4c 2a 09 JMP $092a ; (main + 42)
+1d45 : d0 09 __ BNE $1d50
+1d47 : a5 53 __ LDA T0 + 0
+1d49 : c9 05 __ CMP #$05
+1d4b : b0 03 __ BCS $1d50
+1d4d : 4c 2a 09 JMP $092a ; (main + 42)
+1d50 : a9 00 __ LDA #$00
+1d52 : 85 1b __ STA ACCU + 0
+1d54 : 85 1c __ STA ACCU + 1
+1d56 : 18 __ __ CLC
+1d57 : a5 23 __ LDA SP + 0
+1d59 : 69 0a __ ADC #$0a
+1d5b : 85 23 __ STA SP + 0
+1d5d : a5 24 __ LDA SP + 1
+1d5f : 69 00 __ ADC #$00
+1d61 : 85 24 __ STA SP + 1
+1d63 : a0 25 __ LDY #$25
+1d65 : b1 23 __ LDA (SP + 0),y
+1d67 : 99 53 00 STA $0053,y 
+1d6a : 88 __ __ DEY
+1d6b : 10 f8 __ BPL $1d65
+1d6d : 18 __ __ CLC
+1d6e : a5 23 __ LDA SP + 0
+1d70 : 69 26 __ ADC #$26
+1d72 : 85 23 __ STA SP + 0
+1d74 : a5 24 __ LDA SP + 1
+1d76 : 69 00 __ ADC #$00
+1d78 : 85 24 __ STA SP + 1
+1d7a : 60 __ __ RTS
+--------------------------------------------------------------------
+leaf:
+1d7b : 38 __ __ SEC
+1d7c : a5 23 __ LDA SP + 0
+1d7e : e9 04 __ SBC #$04
+1d80 : 85 23 __ STA SP + 0
+1d82 : a5 24 __ LDA SP + 1
+1d84 : e9 00 __ SBC #$00
+1d86 : 85 24 __ STA SP + 1
+1d88 : a0 03 __ LDY #$03
+1d8a : b9 53 00 LDA $0053,y 
+1d8d : 91 23 __ STA (SP + 0),y
+1d8f : 88 __ __ DEY
+1d90 : 10 f8 __ BPL $1d8a
+1d92 : a9 00 __ LDA #$00
+1d94 : 85 43 __ STA T0 + 0
+1d96 : 85 44 __ STA T0 + 1
+1d98 : 85 45 __ STA T0 + 2
+1d9a : 85 46 __ STA T0 + 3
+1d9c : 85 47 __ STA T1 + 0
+1d9e : 85 48 __ STA T1 + 1
+1da0 : a0 06 __ LDY #$06
+1da2 : b1 23 __ LDA (SP + 0),y
+1da4 : 85 49 __ STA T2 + 0
+1da6 : c8 __ __ INY
+1da7 : b1 23 __ LDA (SP + 0),y
+1da9 : 85 4a __ STA T2 + 1
+1dab : c8 __ __ INY
+1dac : b1 23 __ LDA (SP + 0),y
+1dae : 85 4b __ STA T2 + 2
+1db0 : c8 __ __ INY
+1db1 : b1 23 __ LDA (SP + 0),y
+1db3 : 85 4c __ STA T2 + 3
+1db5 : c8 __ __ INY
+1db6 : b1 23 __ LDA (SP + 0),y
+1db8 : 85 4d __ STA T3 + 0
+1dba : c8 __ __ INY
+1dbb : b1 23 __ LDA (SP + 0),y
+1dbd : 85 4e __ STA T3 + 1
+1dbf : c8 __ __ INY
+1dc0 : b1 23 __ LDA (SP + 0),y
+1dc2 : 85 4f __ STA T3 + 2
+1dc4 : c8 __ __ INY
+1dc5 : b1 23 __ LDA (SP + 0),y
+1dc7 : 85 50 __ STA T3 + 3
+1dc9 : a5 47 __ LDA T1 + 0
+1dcb : 85 53 __ STA T4 + 0
+1dcd : a5 48 __ LDA T1 + 1
+1dcf : 85 54 __ STA T4 + 1
+1dd1 : 29 80 __ AND #$80
+1dd3 : 10 02 __ BPL $1dd7
+1dd5 : a9 ff __ LDA #$ff
+1dd7 : 85 55 __ STA T4 + 2
+1dd9 : e6 47 __ INC T1 + 0
+1ddb : d0 02 __ BNE $1ddf
+1ddd : e6 48 __ INC T1 + 1
+1ddf : a5 49 __ LDA T2 + 0
+1de1 : 85 1b __ STA ACCU + 0
+1de3 : a5 4a __ LDA T2 + 1
+1de5 : 85 1c __ STA ACCU + 1
+1de7 : a5 4b __ LDA T2 + 2
+1de9 : 85 1d __ STA ACCU + 2
+1deb : a5 4c __ LDA T2 + 3
+1ded : 85 1e __ STA ACCU + 3
+1def : a5 53 __ LDA T4 + 0
+1df1 : 85 03 __ STA $03
+1df3 : a5 54 __ LDA T4 + 1
+1df5 : 85 04 __ STA $04
+1df7 : a5 55 __ LDA T4 + 2
+1df9 : 85 05 __ STA $05
+1dfb : 85 06 __ STA $06
+1dfd : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1e00 : 38 __ __ SEC
+1e01 : a5 07 __ LDA $07
+1e03 : e5 4d __ SBC T3 + 0
+1e05 : aa __ __ TAX
+1e06 : a5 08 __ LDA $08
+1e08 : e5 4e __ SBC T3 + 1
+1e0a : a8 __ __ TAY
+1e0b : a5 09 __ LDA $09
+1e0d : e5 4f __ SBC T3 + 2
+1e0f : 85 55 __ STA T4 + 2
+1e11 : a5 0a __ LDA $0a
+1e13 : e5 50 __ SBC T3 + 3
+1e15 : 85 56 __ STA T4 + 3
+1e17 : 18 __ __ CLC
+1e18 : 8a __ __ TXA
+1e19 : 65 43 __ ADC T0 + 0
+1e1b : 85 43 __ STA T0 + 0
+1e1d : 98 __ __ TYA
+1e1e : 65 44 __ ADC T0 + 1
+1e20 : 85 44 __ STA T0 + 1
+1e22 : a5 55 __ LDA T4 + 2
+1e24 : 65 45 __ ADC T0 + 2
+1e26 : 85 45 __ STA T0 + 2
+1e28 : a5 56 __ LDA T4 + 3
+1e2a : 65 46 __ ADC T0 + 3
+1e2c : 85 46 __ STA T0 + 3
+1e2e : a5 48 __ LDA T1 + 1
+1e30 : 30 97 __ BMI $1dc9
+1e32 : d0 06 __ BNE $1e3a
+1e34 : a5 47 __ LDA T1 + 0
+1e36 : c9 04 __ CMP #$04
+1e38 : 90 8f __ BCC $1dc9
+1e3a : a5 43 __ LDA T0 + 0
+1e3c : 85 1b __ STA ACCU + 0
+1e3e : a5 44 __ LDA T0 + 1
+1e40 : 85 1c __ STA ACCU + 1
+1e42 : a5 45 __ LDA T0 + 2
+1e44 : 85 1d __ STA ACCU + 2
+1e46 : a5 46 __ LDA T0 + 3
+1e48 : 85 1e __ STA ACCU + 3
+1e4a : a0 03 __ LDY #$03
+1e4c : b1 23 __ LDA (SP + 0),y
+1e4e : 99 53 00 STA $0053,y 
+1e51 : 88 __ __ DEY
+1e52 : 10 f8 __ BPL $1e4c
+1e54 : 18 __ __ CLC
+1e55 : a5 23 __ LDA SP + 0
+1e57 : 69 04 __ ADC #$04
+1e59 : 85 23 __ STA SP + 0
+1e5b : a5 24 __ LDA SP + 1
+1e5d : 69 00 __ ADC #$00
+1e5f : 85 24 __ STA SP + 1
+1e61 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1e62 : a5 0d __ LDA P0
+1e64 : 85 1b __ STA ACCU + 0
+1e66 : a5 0e __ LDA P1
+1e68 : 85 1c __ STA ACCU + 1
+1e6a : ae 18 26 LDX $2618 ; (spentry + 0)
+1e6d : 9a __ __ TXS
+1e6e : a9 4c __ LDA #$4c
+1e70 : 85 54 __ STA $54
+1e72 : a9 00 __ LDA #$00
+1e74 : 85 13 __ STA P6
+1e76 : 60 __ __ RTS
+--------------------------------------------------------------------
+middle:
+1e77 : 38 __ __ SEC
+1e78 : a5 23 __ LDA SP + 0
+1e7a : e9 12 __ SBC #$12
+1e7c : 85 23 __ STA SP + 0
+1e7e : a5 24 __ LDA SP + 1
+1e80 : e9 00 __ SBC #$00
+1e82 : 85 24 __ STA SP + 1
+1e84 : a0 11 __ LDY #$11
+1e86 : b9 53 00 LDA $0053,y 
+1e89 : 91 23 __ STA (SP + 0),y
+1e8b : 88 __ __ DEY
+1e8c : 10 f8 __ BPL $1e86
+1e8e : 38 __ __ SEC
+1e8f : a5 23 __ LDA SP + 0
+1e91 : e9 0a __ SBC #$0a
+1e93 : 85 23 __ STA SP + 0
+1e95 : a5 24 __ LDA SP + 1
+1e97 : e9 00 __ SBC #$00
+1e99 : 85 24 __ STA SP + 1
+1e9b : a9 00 __ LDA #$00
+1e9d : 85 53 __ STA T0 + 0
+1e9f : 85 54 __ STA T0 + 1
+1ea1 : a0 22 __ LDY #$22
+1ea3 : b1 23 __ LDA (SP + 0),y
+1ea5 : 85 55 __ STA T1 + 0
+1ea7 : 85 1b __ STA ACCU + 0
+1ea9 : c8 __ __ INY
+1eaa : b1 23 __ LDA (SP + 0),y
+1eac : 85 56 __ STA T1 + 1
+1eae : 85 1c __ STA ACCU + 1
+1eb0 : c8 __ __ INY
+1eb1 : b1 23 __ LDA (SP + 0),y
+1eb3 : 85 57 __ STA T1 + 2
+1eb5 : 85 1d __ STA ACCU + 2
+1eb7 : c8 __ __ INY
+1eb8 : b1 23 __ LDA (SP + 0),y
+1eba : 85 58 __ STA T1 + 3
+1ebc : 85 1e __ STA ACCU + 3
+1ebe : a0 1e __ LDY #$1e
+1ec0 : b1 23 __ LDA (SP + 0),y
+1ec2 : 85 59 __ STA T2 + 0
+1ec4 : c8 __ __ INY
+1ec5 : b1 23 __ LDA (SP + 0),y
+1ec7 : 85 5a __ STA T2 + 1
+1ec9 : c8 __ __ INY
+1eca : b1 23 __ LDA (SP + 0),y
+1ecc : 85 5b __ STA T2 + 2
+1ece : c8 __ __ INY
+1ecf : b1 23 __ LDA (SP + 0),y
+1ed1 : 85 5c __ STA T2 + 3
+1ed3 : 38 __ __ SEC
+1ed4 : a5 59 __ LDA T2 + 0
+1ed6 : e5 55 __ SBC T1 + 0
+1ed8 : 85 5d __ STA T3 + 0
+1eda : a5 5a __ LDA T2 + 1
+1edc : e5 56 __ SBC T1 + 1
+1ede : 85 5e __ STA T3 + 1
+1ee0 : a5 5b __ LDA T2 + 2
+1ee2 : e5 57 __ SBC T1 + 2
+1ee4 : 85 5f __ STA T3 + 2
+1ee6 : a5 5c __ LDA T2 + 3
+1ee8 : e5 58 __ SBC T1 + 3
+1eea : 85 60 __ STA T3 + 3
+1eec : a9 03 __ LDA #$03
+1eee : 85 03 __ STA $03
+1ef0 : a9 00 __ LDA #$00
+1ef2 : 85 04 __ STA $04
+1ef4 : 85 05 __ STA $05
+1ef6 : 85 06 __ STA $06
+1ef8 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+1efb : a5 07 __ LDA $07
+1efd : 85 55 __ STA T1 + 0
+1eff : a5 08 __ LDA $08
+1f01 : 85 56 __ STA T1 + 1
+1f03 : a5 09 __ LDA $09
+1f05 : 85 57 __ STA T1 + 2
+1f07 : a5 0a __ LDA $0a
+1f09 : 85 58 __ STA T1 + 3
+1f0b : 18 __ __ CLC
+1f0c : a5 59 __ LDA T2 + 0
+1f0e : 69 01 __ ADC #$01
+1f10 : 85 59 __ STA T2 + 0
+1f12 : a5 5a __ LDA T2 + 1
+1f14 : 69 00 __ ADC #$00
+1f16 : 85 5a __ STA T2 + 1
+1f18 : a5 5b __ LDA T2 + 2
+1f1a : 69 00 __ ADC #$00
+1f1c : 85 5b __ STA T2 + 2
+1f1e : 90 02 __ BCC $1f22
+1f20 : e6 5c __ INC T2 + 3
+1f22 : a5 55 __ LDA T1 + 0
+1f24 : a0 02 __ LDY #$02
+1f26 : 91 23 __ STA (SP + 0),y
+1f28 : a5 56 __ LDA T1 + 1
+1f2a : c8 __ __ INY
+1f2b : 91 23 __ STA (SP + 0),y
+1f2d : a5 57 __ LDA T1 + 2
+1f2f : c8 __ __ INY
+1f30 : 91 23 __ STA (SP + 0),y
+1f32 : a5 58 __ LDA T1 + 3
+1f34 : c8 __ __ INY
+1f35 : 91 23 __ STA (SP + 0),y
+1f37 : a5 5d __ LDA T3 + 0
+1f39 : c8 __ __ INY
+1f3a : 91 23 __ STA (SP + 0),y
+1f3c : a5 5e __ LDA T3 + 1
+1f3e : c8 __ __ INY
+1f3f : 91 23 __ STA (SP + 0),y
+1f41 : a5 5f __ LDA T3 + 2
+1f43 : c8 __ __ INY
+1f44 : 91 23 __ STA (SP + 0),y
+1f46 : a5 60 __ LDA T3 + 3
+1f48 : c8 __ __ INY
+1f49 : 91 23 __ STA (SP + 0),y
+1f4b : 20 7b 1d JSR $1d7b ; (leaf + 0)
+1f4e : 18 __ __ CLC
+1f4f : a5 1b __ LDA ACCU + 0
+1f51 : 65 59 __ ADC T2 + 0
+1f53 : 85 61 __ STA T4 + 0
+1f55 : a5 1c __ LDA ACCU + 1
+1f57 : 65 5a __ ADC T2 + 1
+1f59 : 85 62 __ STA T4 + 1
+1f5b : a5 1d __ LDA ACCU + 2
+1f5d : 65 5b __ ADC T2 + 2
+1f5f : 85 63 __ STA T4 + 2
+1f61 : a5 1e __ LDA ACCU + 3
+1f63 : 65 5c __ ADC T2 + 3
+1f65 : 85 64 __ STA T4 + 3
+1f67 : a5 61 __ LDA T4 + 0
+1f69 : 85 59 __ STA T2 + 0
+1f6b : a0 02 __ LDY #$02
+1f6d : 91 23 __ STA (SP + 0),y
+1f6f : a5 62 __ LDA T4 + 1
+1f71 : 85 5a __ STA T2 + 1
+1f73 : c8 __ __ INY
+1f74 : 91 23 __ STA (SP + 0),y
+1f76 : a5 63 __ LDA T4 + 2
+1f78 : 85 5b __ STA T2 + 2
+1f7a : c8 __ __ INY
+1f7b : 91 23 __ STA (SP + 0),y
+1f7d : a5 64 __ LDA T4 + 3
+1f7f : 85 5c __ STA T2 + 3
+1f81 : c8 __ __ INY
+1f82 : 91 23 __ STA (SP + 0),y
+1f84 : a5 54 __ LDA T0 + 1
+1f86 : 29 80 __ AND #$80
+1f88 : 10 02 __ BPL $1f8c
+1f8a : a9 ff __ LDA #$ff
+1f8c : aa __ __ TAX
+1f8d : a5 53 __ LDA T0 + 0
+1f8f : c8 __ __ INY
+1f90 : 91 23 __ STA (SP + 0),y
+1f92 : a5 54 __ LDA T0 + 1
+1f94 : c8 __ __ INY
+1f95 : 91 23 __ STA (SP + 0),y
+1f97 : 8a __ __ TXA
+1f98 : c8 __ __ INY
+1f99 : 91 23 __ STA (SP + 0),y
+1f9b : c8 __ __ INY
+1f9c : 91 23 __ STA (SP + 0),y
+1f9e : 20 7b 1d JSR $1d7b ; (leaf + 0)
+1fa1 : a5 54 __ LDA T0 + 1
+1fa3 : 29 80 __ AND #$80
+1fa5 : 10 02 __ BPL $1fa9
+1fa7 : a9 ff __ LDA #$ff
+1fa9 : aa __ __ TAX
+1faa : a5 53 __ LDA T0 + 0
+1fac : a0 02 __ LDY #$02
+1fae : 91 23 __ STA (SP + 0),y
+1fb0 : a5 54 __ LDA T0 + 1
+1fb2 : c8 __ __ INY
+1fb3 : 91 23 __ STA (SP + 0),y
+1fb5 : 8a __ __ TXA
+1fb6 : c8 __ __ INY
+1fb7 : 91 23 __ STA (SP + 0),y
+1fb9 : c8 __ __ INY
+1fba : 91 23 __ STA (SP + 0),y
+1fbc : 18 __ __ CLC
+1fbd : a5 1b __ LDA ACCU + 0
+1fbf : 65 55 __ ADC T1 + 0
+1fc1 : 85 55 __ STA T1 + 0
+1fc3 : c8 __ __ INY
+1fc4 : 91 23 __ STA (SP + 0),y
+1fc6 : a5 1c __ LDA ACCU + 1
+1fc8 : 65 56 __ ADC T1 + 1
+1fca : 85 56 __ STA T1 + 1
+1fcc : c8 __ __ INY
+1fcd : 91 23 __ STA (SP + 0),y
+1fcf : a5 1d __ LDA ACCU + 2
+1fd1 : 65 57 __ ADC T1 + 2
+1fd3 : 85 57 __ STA T1 + 2
+1fd5 : c8 __ __ INY
+1fd6 : 91 23 __ STA (SP + 0),y
+1fd8 : a5 1e __ LDA ACCU + 3
+1fda : 65 58 __ ADC T1 + 3
+1fdc : 85 58 __ STA T1 + 3
+1fde : c8 __ __ INY
+1fdf : 91 23 __ STA (SP + 0),y
+1fe1 : 20 7b 1d JSR $1d7b ; (leaf + 0)
+1fe4 : e6 53 __ INC T0 + 0
+1fe6 : d0 02 __ BNE $1fea
+1fe8 : e6 54 __ INC T0 + 1
+1fea : 38 __ __ SEC
+1feb : a5 5d __ LDA T3 + 0
+1fed : e5 1b __ SBC ACCU + 0
+1fef : 85 5d __ STA T3 + 0
+1ff1 : a5 5e __ LDA T3 + 1
+1ff3 : e5 1c __ SBC ACCU + 1
+1ff5 : 85 5e __ STA T3 + 1
+1ff7 : a5 5f __ LDA T3 + 2
+1ff9 : e5 1d __ SBC ACCU + 2
+1ffb : 85 5f __ STA T3 + 2
+1ffd : a5 60 __ LDA T3 + 3
+1fff : e5 1e __ SBC ACCU + 3
+2001 : 85 60 __ STA T3 + 3
+2003 : a5 54 __ LDA T0 + 1
+2005 : 10 03 __ BPL $200a
+2007 : 4c 22 1f JMP $1f22 ; (middle + 171)
+200a : d0 09 __ BNE $2015
+200c : a5 53 __ LDA T0 + 0
+200e : c9 03 __ CMP #$03
+2010 : b0 03 __ BCS $2015
+2012 : 4c 22 1f JMP $1f22 ; (middle + 171)
+2015 : a5 61 __ LDA T4 + 0
+2017 : 45 55 __ EOR T1 + 0
+2019 : aa __ __ TAX
+201a : a5 62 __ LDA T4 + 1
+201c : 45 56 __ EOR T1 + 1
+201e : a8 __ __ TAY
+201f : a5 63 __ LDA T4 + 2
+2021 : 45 57 __ EOR T1 + 2
+2023 : 85 57 __ STA T1 + 2
+2025 : a5 64 __ LDA T4 + 3
+2027 : 45 58 __ EOR T1 + 3
+2029 : 85 58 __ STA T1 + 3
+202b : 8a __ __ TXA
+202c : 45 5d __ EOR T3 + 0
+202e : 85 1b __ STA ACCU + 0
+2030 : 98 __ __ TYA
+2031 : 45 5e __ EOR T3 + 1
+2033 : 85 1c __ STA ACCU + 1
+2035 : a5 57 __ LDA T1 + 2
+2037 : 45 5f __ EOR T3 + 2
+2039 : 85 1d __ STA ACCU + 2
+203b : a5 58 __ LDA T1 + 3
+203d : 45 60 __ EOR T3 + 3
+203f : 85 1e __ STA ACCU + 3
+2041 : 18 __ __ CLC
+2042 : a5 23 __ LDA SP + 0
+2044 : 69 0a __ ADC #$0a
+2046 : 85 23 __ STA SP + 0
+2048 : a5 24 __ LDA SP + 1
+204a : 69 00 __ ADC #$00
+204c : 85 24 __ STA SP + 1
+204e : a0 11 __ LDY #$11
+2050 : b1 23 __ LDA (SP + 0),y
+2052 : 99 53 00 STA $0053,y 
+2055 : 88 __ __ DEY
+2056 : 10 f8 __ BPL $2050
+2058 : 18 __ __ CLC
+2059 : a5 23 __ LDA SP + 0
+205b : 69 12 __ ADC #$12
+205d : 85 23 __ STA SP + 0
+205f : a5 24 __ LDA SP + 1
+2061 : 69 00 __ ADC #$00
+2063 : 85 24 __ STA SP + 1
+2065 : 60 __ __ RTS
+--------------------------------------------------------------------
+rec:
+2066 : 38 __ __ SEC
+2067 : a5 23 __ LDA SP + 0
+2069 : e9 0c __ SBC #$0c
+206b : 85 23 __ STA SP + 0
+206d : a5 24 __ LDA SP + 1
+206f : e9 00 __ SBC #$00
+2071 : 85 24 __ STA SP + 1
+2073 : a0 0b __ LDY #$0b
+2075 : b9 53 00 LDA $0053,y 
+2078 : 91 23 __ STA (SP + 0),y
+207a : 88 __ __ DEY
+207b : 10 f8 __ BPL $2075
+207d : 38 __ __ SEC
+207e : a5 23 __ LDA SP + 0
+2080 : e9 0a __ SBC #$0a
+2082 : 85 23 __ STA SP + 0
+2084 : a5 24 __ LDA SP + 1
+2086 : e9 00 __ SBC #$00
+2088 : 85 24 __ STA SP + 1
+208a : a0 18 __ LDY #$18
+208c : b1 23 __ LDA (SP + 0),y
+208e : 85 53 __ STA T0 + 0
+2090 : 85 1b __ STA ACCU + 0
+2092 : c8 __ __ INY
+2093 : b1 23 __ LDA (SP + 0),y
+2095 : 85 54 __ STA T0 + 1
+2097 : 85 1c __ STA ACCU + 1
+2099 : c8 __ __ INY
+209a : b1 23 __ LDA (SP + 0),y
+209c : 85 55 __ STA T0 + 2
+209e : 85 1d __ STA ACCU + 2
+20a0 : c8 __ __ INY
+20a1 : b1 23 __ LDA (SP + 0),y
+20a3 : 85 56 __ STA T0 + 3
+20a5 : 85 1e __ STA ACCU + 3
+20a7 : c8 __ __ INY
+20a8 : b1 23 __ LDA (SP + 0),y
+20aa : 85 43 __ STA T1 + 0
+20ac : c8 __ __ INY
+20ad : b1 23 __ LDA (SP + 0),y
+20af : 85 44 __ STA T1 + 1
+20b1 : 29 80 __ AND #$80
+20b3 : 10 02 __ BPL $20b7
+20b5 : a9 ff __ LDA #$ff
+20b7 : aa __ __ TAX
+20b8 : 85 05 __ STA $05
+20ba : 18 __ __ CLC
+20bb : a5 43 __ LDA T1 + 0
+20bd : 85 03 __ STA $03
+20bf : 65 53 __ ADC T0 + 0
+20c1 : 85 5b __ STA T3 + 0
+20c3 : a5 44 __ LDA T1 + 1
+20c5 : 85 04 __ STA $04
+20c7 : 65 54 __ ADC T0 + 1
+20c9 : 85 5c __ STA T3 + 1
+20cb : 8a __ __ TXA
+20cc : 65 55 __ ADC T0 + 2
+20ce : 85 5d __ STA T3 + 2
+20d0 : 8a __ __ TXA
+20d1 : 65 56 __ ADC T0 + 3
+20d3 : 85 5e __ STA T3 + 3
+20d5 : 8a __ __ TXA
+20d6 : 86 06 __ STX $06
+20d8 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+20db : a5 44 __ LDA T1 + 1
+20dd : 30 04 __ BMI $20e3
+20df : 05 43 __ ORA T1 + 0
+20e1 : d0 3e __ BNE $2121
+20e3 : 18 __ __ CLC
+20e4 : a5 5b __ LDA T3 + 0
+20e6 : 65 07 __ ADC $07
+20e8 : 85 1b __ STA ACCU + 0
+20ea : a5 5c __ LDA T3 + 1
+20ec : 65 08 __ ADC $08
+20ee : 85 1c __ STA ACCU + 1
+20f0 : a5 5d __ LDA T3 + 2
+20f2 : 65 09 __ ADC $09
+20f4 : 85 1d __ STA ACCU + 2
+20f6 : a5 5e __ LDA T3 + 3
+20f8 : 65 0a __ ADC $0a
+20fa : 85 1e __ STA ACCU + 3
+20fc : 18 __ __ CLC
+20fd : a5 23 __ LDA SP + 0
+20ff : 69 0a __ ADC #$0a
+2101 : 85 23 __ STA SP + 0
+2103 : a5 24 __ LDA SP + 1
+2105 : 69 00 __ ADC #$00
+2107 : 85 24 __ STA SP + 1
+2109 : a0 0b __ LDY #$0b
+210b : b1 23 __ LDA (SP + 0),y
+210d : 99 53 00 STA $0053,y 
+2110 : 88 __ __ DEY
+2111 : 10 f8 __ BPL $210b
+2113 : 18 __ __ CLC
+2114 : a5 23 __ LDA SP + 0
+2116 : 69 0c __ ADC #$0c
+2118 : 85 23 __ STA SP + 0
+211a : a5 24 __ LDA SP + 1
+211c : 69 00 __ ADC #$00
+211e : 85 24 __ STA SP + 1
+2120 : 60 __ __ RTS
+2121 : a5 07 __ LDA $07
+2123 : a0 02 __ LDY #$02
+2125 : 91 23 __ STA (SP + 0),y
+2127 : a5 08 __ LDA $08
+2129 : c8 __ __ INY
+212a : 91 23 __ STA (SP + 0),y
+212c : a5 09 __ LDA $09
+212e : c8 __ __ INY
+212f : 91 23 __ STA (SP + 0),y
+2131 : a5 0a __ LDA $0a
+2133 : c8 __ __ INY
+2134 : 91 23 __ STA (SP + 0),y
+2136 : 38 __ __ SEC
+2137 : a5 43 __ LDA T1 + 0
+2139 : e9 01 __ SBC #$01
+213b : c8 __ __ INY
+213c : 91 23 __ STA (SP + 0),y
+213e : a5 44 __ LDA T1 + 1
+2140 : e9 00 __ SBC #$00
+2142 : c8 __ __ INY
+2143 : 91 23 __ STA (SP + 0),y
+2145 : 20 66 20 JSR $2066 ; (rec + 0)
+2148 : 18 __ __ CLC
+2149 : a5 1b __ LDA ACCU + 0
+214b : 65 5b __ ADC T3 + 0
+214d : 85 57 __ STA T2 + 0
+214f : a0 02 __ LDY #$02
+2151 : 91 23 __ STA (SP + 0),y
+2153 : a5 1c __ LDA ACCU + 1
+2155 : 65 5c __ ADC T3 + 1
+2157 : 85 58 __ STA T2 + 1
+2159 : c8 __ __ INY
+215a : 91 23 __ STA (SP + 0),y
+215c : a5 1d __ LDA ACCU + 2
+215e : 65 5d __ ADC T3 + 2
+2160 : 85 59 __ STA T2 + 2
+2162 : c8 __ __ INY
+2163 : 91 23 __ STA (SP + 0),y
+2165 : a5 1e __ LDA ACCU + 3
+2167 : 65 5e __ ADC T3 + 3
+2169 : 85 5a __ STA T2 + 3
+216b : c8 __ __ INY
+216c : 91 23 __ STA (SP + 0),y
+216e : a0 1c __ LDY #$1c
+2170 : b1 23 __ LDA (SP + 0),y
+2172 : aa __ __ TAX
+2173 : c8 __ __ INY
+2174 : b1 23 __ LDA (SP + 0),y
+2176 : 85 44 __ STA T1 + 1
+2178 : 29 80 __ AND #$80
+217a : 10 02 __ BPL $217e
+217c : a9 ff __ LDA #$ff
+217e : 85 5d __ STA T3 + 2
+2180 : 8a __ __ TXA
+2181 : a0 06 __ LDY #$06
+2183 : 91 23 __ STA (SP + 0),y
+2185 : a5 44 __ LDA T1 + 1
+2187 : c8 __ __ INY
+2188 : 91 23 __ STA (SP + 0),y
+218a : a5 5d __ LDA T3 + 2
+218c : c8 __ __ INY
+218d : 91 23 __ STA (SP + 0),y
+218f : c8 __ __ INY
+2190 : 91 23 __ STA (SP + 0),y
+2192 : 20 77 1e JSR $1e77 ; (middle + 0)
+2195 : a5 1b __ LDA ACCU + 0
+2197 : 85 5b __ STA T3 + 0
+2199 : a5 1c __ LDA ACCU + 1
+219b : 85 5c __ STA T3 + 1
+219d : a5 1d __ LDA ACCU + 2
+219f : 85 5d __ STA T3 + 2
+21a1 : a5 1e __ LDA ACCU + 3
+21a3 : 85 5e __ STA T3 + 3
+21a5 : a5 57 __ LDA T2 + 0
+21a7 : a0 02 __ LDY #$02
+21a9 : 91 23 __ STA (SP + 0),y
+21ab : a5 58 __ LDA T2 + 1
+21ad : c8 __ __ INY
+21ae : 91 23 __ STA (SP + 0),y
+21b0 : a5 59 __ LDA T2 + 2
+21b2 : c8 __ __ INY
+21b3 : 91 23 __ STA (SP + 0),y
+21b5 : a5 5a __ LDA T2 + 3
+21b7 : c8 __ __ INY
+21b8 : 91 23 __ STA (SP + 0),y
+21ba : a0 1c __ LDY #$1c
+21bc : b1 23 __ LDA (SP + 0),y
+21be : 38 __ __ SEC
+21bf : e9 01 __ SBC #$01
+21c1 : aa __ __ TAX
+21c2 : c8 __ __ INY
+21c3 : b1 23 __ LDA (SP + 0),y
+21c5 : e9 00 __ SBC #$00
+21c7 : 85 44 __ STA T1 + 1
+21c9 : 8a __ __ TXA
+21ca : a0 06 __ LDY #$06
+21cc : 91 23 __ STA (SP + 0),y
+21ce : a5 44 __ LDA T1 + 1
+21d0 : c8 __ __ INY
+21d1 : 91 23 __ STA (SP + 0),y
+21d3 : 20 66 20 JSR $2066 ; (rec + 0)
+21d6 : 38 __ __ SEC
+21d7 : a5 07 __ LDA $07
+21d9 : e5 5b __ SBC T3 + 0
+21db : 85 53 __ STA T0 + 0
+21dd : a5 08 __ LDA $08
+21df : e5 5c __ SBC T3 + 1
+21e1 : 85 54 __ STA T0 + 1
+21e3 : a5 09 __ LDA $09
+21e5 : e5 5d __ SBC T3 + 2
+21e7 : 85 55 __ STA T0 + 2
+21e9 : a5 0a __ LDA $0a
+21eb : e5 5e __ SBC T3 + 3
+21ed : 85 56 __ STA T0 + 3
+21ef : a5 1b __ LDA ACCU + 0
+21f1 : 45 57 __ EOR T2 + 0
+21f3 : 18 __ __ CLC
+21f4 : 65 53 __ ADC T0 + 0
+21f6 : 85 1b __ STA ACCU + 0
+21f8 : a5 1c __ LDA ACCU + 1
+21fa : 45 58 __ EOR T2 + 1
+21fc : 65 54 __ ADC T0 + 1
+21fe : 85 1c __ STA ACCU + 1
+2200 : a5 1d __ LDA ACCU + 2
+2202 : 45 59 __ EOR T2 + 2
+2204 : 65 55 __ ADC T0 + 2
+2206 : 85 1d __ STA ACCU + 2
+2208 : a5 1e __ LDA ACCU + 3
+220a : 45 5a __ EOR T2 + 3
+220c : 65 56 __ ADC T0 + 3
+220e : 4c fa 20 JMP $20fa ; (rec + 148)
+--------------------------------------------------------------------
+rrec:
+2211 : 38 __ __ SEC
+2212 : a5 23 __ LDA SP + 0
+2214 : e9 1c __ SBC #$1c
+2216 : 85 23 __ STA SP + 0
+2218 : a5 24 __ LDA SP + 1
+221a : e9 00 __ SBC #$00
+221c : 85 24 __ STA SP + 1
+221e : a0 1b __ LDY #$1b
+2220 : b9 53 00 LDA $0053,y 
+2223 : 91 23 __ STA (SP + 0),y
+2225 : 88 __ __ DEY
+2226 : 10 f8 __ BPL $2220
+2228 : 38 __ __ SEC
+2229 : a5 23 __ LDA SP + 0
+222b : e9 08 __ SBC #$08
+222d : 85 23 __ STA SP + 0
+222f : a5 24 __ LDA SP + 1
+2231 : e9 00 __ SBC #$00
+2233 : 85 24 __ STA SP + 1
+2235 : a0 26 __ LDY #$26
+2237 : b1 23 __ LDA (SP + 0),y
+2239 : 85 53 __ STA T0 + 0
+223b : 85 03 __ STA $03
+223d : c8 __ __ INY
+223e : b1 23 __ LDA (SP + 0),y
+2240 : 85 54 __ STA T0 + 1
+2242 : 85 04 __ STA $04
+2244 : c8 __ __ INY
+2245 : b1 23 __ LDA (SP + 0),y
+2247 : 85 55 __ STA T0 + 2
+2249 : 85 05 __ STA $05
+224b : c8 __ __ INY
+224c : b1 23 __ LDA (SP + 0),y
+224e : 85 56 __ STA T0 + 3
+2250 : 85 06 __ STA $06
+2252 : c8 __ __ INY
+2253 : b1 23 __ LDA (SP + 0),y
+2255 : 85 43 __ STA T1 + 0
+2257 : 85 1b __ STA ACCU + 0
+2259 : c8 __ __ INY
+225a : b1 23 __ LDA (SP + 0),y
+225c : 85 44 __ STA T1 + 1
+225e : 85 1c __ STA ACCU + 1
+2260 : 29 80 __ AND #$80
+2262 : 10 02 __ BPL $2266
+2264 : a9 ff __ LDA #$ff
+2266 : 85 59 __ STA T2 + 2
+2268 : 85 1d __ STA ACCU + 2
+226a : 85 1e __ STA ACCU + 3
+226c : 20 dd 25 JSR $25dd ; (mul32 + 0)
+226f : 18 __ __ CLC
+2270 : a5 53 __ LDA T0 + 0
+2272 : 65 43 __ ADC T1 + 0
+2274 : 85 53 __ STA T0 + 0
+2276 : a5 54 __ LDA T0 + 1
+2278 : 65 44 __ ADC T1 + 1
+227a : 85 54 __ STA T0 + 1
+227c : a5 55 __ LDA T0 + 2
+227e : 65 59 __ ADC T2 + 2
+2280 : 85 55 __ STA T0 + 2
+2282 : a5 56 __ LDA T0 + 3
+2284 : 65 59 __ ADC T2 + 2
+2286 : 85 56 __ STA T0 + 3
+2288 : a5 44 __ LDA T1 + 1
+228a : 30 04 __ BMI $2290
+228c : 05 43 __ ORA T1 + 0
+228e : d0 3e __ BNE $22ce
+2290 : 18 __ __ CLC
+2291 : a5 53 __ LDA T0 + 0
+2293 : 65 07 __ ADC $07
+2295 : 85 1b __ STA ACCU + 0
+2297 : a5 54 __ LDA T0 + 1
+2299 : 65 08 __ ADC $08
+229b : 85 1c __ STA ACCU + 1
+229d : a5 55 __ LDA T0 + 2
+229f : 65 09 __ ADC $09
+22a1 : 85 1d __ STA ACCU + 2
+22a3 : a5 56 __ LDA T0 + 3
+22a5 : 65 0a __ ADC $0a
+22a7 : 85 1e __ STA ACCU + 3
+22a9 : 18 __ __ CLC
+22aa : a5 23 __ LDA SP + 0
+22ac : 69 08 __ ADC #$08
+22ae : 85 23 __ STA SP + 0
+22b0 : a5 24 __ LDA SP + 1
+22b2 : 69 00 __ ADC #$00
+22b4 : 85 24 __ STA SP + 1
+22b6 : a0 1b __ LDY #$1b
+22b8 : b1 23 __ LDA (SP + 0),y
+22ba : 99 53 00 STA $0053,y 
+22bd : 88 __ __ DEY
+22be : 10 f8 __ BPL $22b8
+22c0 : 18 __ __ CLC
+22c1 : a5 23 __ LDA SP + 0
+22c3 : 69 1c __ ADC #$1c
+22c5 : 85 23 __ STA SP + 0
+22c7 : a5 24 __ LDA SP + 1
+22c9 : 69 00 __ ADC #$00
+22cb : 85 24 __ STA SP + 1
+22cd : 60 __ __ RTS
+22ce : a5 07 __ LDA $07
+22d0 : 85 57 __ STA T2 + 0
+22d2 : a5 08 __ LDA $08
+22d4 : 85 58 __ STA T2 + 1
+22d6 : a5 09 __ LDA $09
+22d8 : 85 59 __ STA T2 + 2
+22da : a5 0a __ LDA $0a
+22dc : 85 5a __ STA T2 + 3
+22de : a5 07 __ LDA $07
+22e0 : a0 02 __ LDY #$02
+22e2 : 91 23 __ STA (SP + 0),y
+22e4 : a5 08 __ LDA $08
+22e6 : c8 __ __ INY
+22e7 : 91 23 __ STA (SP + 0),y
+22e9 : a5 09 __ LDA $09
+22eb : c8 __ __ INY
+22ec : 91 23 __ STA (SP + 0),y
+22ee : a5 0a __ LDA $0a
+22f0 : c8 __ __ INY
+22f1 : 91 23 __ STA (SP + 0),y
+22f3 : 38 __ __ SEC
+22f4 : a5 43 __ LDA T1 + 0
+22f6 : e9 01 __ SBC #$01
+22f8 : c8 __ __ INY
+22f9 : 91 23 __ STA (SP + 0),y
+22fb : a5 44 __ LDA T1 + 1
+22fd : e9 00 __ SBC #$00
+22ff : c8 __ __ INY
+2300 : 91 23 __ STA (SP + 0),y
+2302 : 20 11 22 JSR $2211 ; (rrec + 0)
+2305 : a9 00 __ LDA #$00
+2307 : 85 43 __ STA T1 + 0
+2309 : 85 44 __ STA T1 + 1
+230b : a0 2a __ LDY #$2a
+230d : b1 23 __ LDA (SP + 0),y
+230f : 85 46 __ STA T5 + 0
+2311 : c8 __ __ INY
+2312 : b1 23 __ LDA (SP + 0),y
+2314 : 85 47 __ STA T5 + 1
+2316 : 29 80 __ AND #$80
+2318 : 10 02 __ BPL $231c
+231a : a9 ff __ LDA #$ff
+231c : 85 61 __ STA T6 + 2
+231e : 18 __ __ CLC
+231f : a5 1b __ LDA ACCU + 0
+2321 : 65 53 __ ADC T0 + 0
+2323 : 85 53 __ STA T0 + 0
+2325 : a5 1c __ LDA ACCU + 1
+2327 : 65 54 __ ADC T0 + 1
+2329 : 85 54 __ STA T0 + 1
+232b : a5 1d __ LDA ACCU + 2
+232d : 65 55 __ ADC T0 + 2
+232f : 85 55 __ STA T0 + 2
+2331 : a5 1e __ LDA ACCU + 3
+2333 : 65 56 __ ADC T0 + 3
+2335 : 85 56 __ STA T0 + 3
+2337 : 38 __ __ SEC
+2338 : a5 53 __ LDA T0 + 0
+233a : e5 46 __ SBC T5 + 0
+233c : 85 5b __ STA T3 + 0
+233e : a5 54 __ LDA T0 + 1
+2340 : e5 47 __ SBC T5 + 1
+2342 : 85 5c __ STA T3 + 1
+2344 : a5 55 __ LDA T0 + 2
+2346 : e5 61 __ SBC T6 + 2
+2348 : 85 5d __ STA T3 + 2
+234a : a5 56 __ LDA T0 + 3
+234c : e5 61 __ SBC T6 + 2
+234e : 85 5e __ STA T3 + 3
+2350 : a5 46 __ LDA T5 + 0
+2352 : 85 1b __ STA ACCU + 0
+2354 : a5 47 __ LDA T5 + 1
+2356 : 85 1c __ STA ACCU + 1
+2358 : a5 61 __ LDA T6 + 2
+235a : 85 1d __ STA ACCU + 2
+235c : 85 1e __ STA ACCU + 3
+235e : a9 03 __ LDA #$03
+2360 : 85 03 __ STA $03
+2362 : a9 00 __ LDA #$00
+2364 : 85 04 __ STA $04
+2366 : 85 05 __ STA $05
+2368 : 85 06 __ STA $06
+236a : 20 dd 25 JSR $25dd ; (mul32 + 0)
+236d : a5 07 __ LDA $07
+236f : 85 5f __ STA T6 + 0
+2371 : a5 08 __ LDA $08
+2373 : 85 60 __ STA T6 + 1
+2375 : a5 09 __ LDA $09
+2377 : 85 61 __ STA T6 + 2
+2379 : a5 0a __ LDA $0a
+237b : 85 62 __ STA T6 + 3
+237d : 18 __ __ CLC
+237e : a5 53 __ LDA T0 + 0
+2380 : 69 01 __ ADC #$01
+2382 : 85 63 __ STA T7 + 0
+2384 : a5 54 __ LDA T0 + 1
+2386 : 69 00 __ ADC #$00
+2388 : 85 64 __ STA T7 + 1
+238a : a5 55 __ LDA T0 + 2
+238c : 69 00 __ ADC #$00
+238e : 85 65 __ STA T7 + 2
+2390 : a5 56 __ LDA T0 + 3
+2392 : 69 00 __ ADC #$00
+2394 : 85 66 __ STA T7 + 3
+2396 : a5 43 __ LDA T1 + 0
+2398 : 85 48 __ STA T8 + 0
+239a : a5 44 __ LDA T1 + 1
+239c : 85 49 __ STA T8 + 1
+239e : 29 80 __ AND #$80
+23a0 : 10 02 __ BPL $23a4
+23a2 : a9 ff __ LDA #$ff
+23a4 : 85 4a __ STA T8 + 2
+23a6 : 85 4b __ STA T8 + 3
+23a8 : e6 43 __ INC T1 + 0
+23aa : d0 02 __ BNE $23ae
+23ac : e6 44 __ INC T1 + 1
+23ae : a9 06 __ LDA #$06
+23b0 : 85 1b __ STA ACCU + 0
+23b2 : a9 00 __ LDA #$00
+23b4 : 85 1c __ STA ACCU + 1
+23b6 : 85 1d __ STA ACCU + 2
+23b8 : 85 1e __ STA ACCU + 3
+23ba : a5 48 __ LDA T8 + 0
+23bc : 85 03 __ STA $03
+23be : a5 49 __ LDA T8 + 1
+23c0 : 85 04 __ STA $04
+23c2 : a5 4a __ LDA T8 + 2
+23c4 : 85 05 __ STA $05
+23c6 : 85 06 __ STA $06
+23c8 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+23cb : a5 07 __ LDA $07
+23cd : 85 4c __ STA T9 + 0
+23cf : a5 08 __ LDA $08
+23d1 : 85 4d __ STA T9 + 1
+23d3 : a5 09 __ LDA $09
+23d5 : 85 4e __ STA T9 + 2
+23d7 : a5 0a __ LDA $0a
+23d9 : 85 4f __ STA T9 + 3
+23db : a9 06 __ LDA #$06
+23dd : 85 1b __ STA ACCU + 0
+23df : a9 00 __ LDA #$00
+23e1 : 85 1c __ STA ACCU + 1
+23e3 : 85 1d __ STA ACCU + 2
+23e5 : 85 1e __ STA ACCU + 3
+23e7 : a5 5f __ LDA T6 + 0
+23e9 : 85 03 __ STA $03
+23eb : a5 60 __ LDA T6 + 1
+23ed : 85 04 __ STA $04
+23ef : a5 61 __ LDA T6 + 2
+23f1 : 85 05 __ STA $05
+23f3 : a5 62 __ LDA T6 + 3
+23f5 : 85 06 __ STA $06
+23f7 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+23fa : a5 07 __ LDA $07
+23fc : 85 67 __ STA T10 + 0
+23fe : a5 08 __ LDA $08
+2400 : 85 68 __ STA T10 + 1
+2402 : a5 09 __ LDA $09
+2404 : 85 69 __ STA T10 + 2
+2406 : a5 0a __ LDA $0a
+2408 : 85 6a __ STA T10 + 3
+240a : a5 5b __ LDA T3 + 0
+240c : 85 6b __ STA T11 + 0
+240e : a5 5c __ LDA T3 + 1
+2410 : 85 6c __ STA T11 + 1
+2412 : a5 5d __ LDA T3 + 2
+2414 : 85 6d __ STA T11 + 2
+2416 : a5 5e __ LDA T3 + 3
+2418 : a2 02 __ LDX #$02
+241a : 06 6b __ ASL T11 + 0
+241c : 26 6c __ ROL T11 + 1
+241e : 26 6d __ ROL T11 + 2
+2420 : 2a __ __ ROL
+2421 : ca __ __ DEX
+2422 : d0 f6 __ BNE $241a
+2424 : 85 6e __ STA T11 + 3
+2426 : 38 __ __ SEC
+2427 : a5 67 __ LDA T10 + 0
+2429 : e5 6b __ SBC T11 + 0
+242b : aa __ __ TAX
+242c : a5 68 __ LDA T10 + 1
+242e : e5 6c __ SBC T11 + 1
+2430 : a8 __ __ TAY
+2431 : a5 69 __ LDA T10 + 2
+2433 : e5 6d __ SBC T11 + 2
+2435 : 85 69 __ STA T10 + 2
+2437 : a5 6a __ LDA T10 + 3
+2439 : e5 6e __ SBC T11 + 3
+243b : 85 6a __ STA T10 + 3
+243d : 18 __ __ CLC
+243e : 8a __ __ TXA
+243f : 65 63 __ ADC T7 + 0
+2441 : 85 63 __ STA T7 + 0
+2443 : 85 1b __ STA ACCU + 0
+2445 : 98 __ __ TYA
+2446 : 65 64 __ ADC T7 + 1
+2448 : 85 64 __ STA T7 + 1
+244a : 85 1c __ STA ACCU + 1
+244c : a5 69 __ LDA T10 + 2
+244e : 65 65 __ ADC T7 + 2
+2450 : 85 65 __ STA T7 + 2
+2452 : 85 1d __ STA ACCU + 2
+2454 : a5 6a __ LDA T10 + 3
+2456 : 65 66 __ ADC T7 + 3
+2458 : 85 66 __ STA T7 + 3
+245a : 85 1e __ STA ACCU + 3
+245c : a9 06 __ LDA #$06
+245e : 85 03 __ STA $03
+2460 : a9 00 __ LDA #$00
+2462 : 85 04 __ STA $04
+2464 : 85 05 __ STA $05
+2466 : 85 06 __ STA $06
+2468 : 20 dd 25 JSR $25dd ; (mul32 + 0)
+246b : a5 07 __ LDA $07
+246d : 85 67 __ STA T10 + 0
+246f : a5 08 __ LDA $08
+2471 : 85 68 __ STA T10 + 1
+2473 : a5 09 __ LDA $09
+2475 : 85 69 __ STA T10 + 2
+2477 : a5 0a __ LDA $0a
+2479 : 85 6a __ STA T10 + 3
+247b : a5 4b __ LDA T8 + 3
+247d : a2 02 __ LDX #$02
+247f : 06 48 __ ASL T8 + 0
+2481 : 26 49 __ ROL T8 + 1
+2483 : 26 4a __ ROL T8 + 2
+2485 : 2a __ __ ROL
+2486 : ca __ __ DEX
+2487 : d0 f6 __ BNE $247f
+2489 : 85 4b __ STA T8 + 3
+248b : 38 __ __ SEC
+248c : a5 67 __ LDA T10 + 0
+248e : e5 48 __ SBC T8 + 0
+2490 : aa __ __ TAX
+2491 : a5 68 __ LDA T10 + 1
+2493 : e5 49 __ SBC T8 + 1
+2495 : a8 __ __ TAY
+2496 : a5 69 __ LDA T10 + 2
+2498 : e5 4a __ SBC T8 + 2
+249a : 85 4a __ STA T8 + 2
+249c : a5 6a __ LDA T10 + 3
+249e : e5 4b __ SBC T8 + 3
+24a0 : 85 4b __ STA T8 + 3
+24a2 : 18 __ __ CLC
+24a3 : 8a __ __ TXA
+24a4 : 65 5f __ ADC T6 + 0
+24a6 : 85 5f __ STA T6 + 0
+24a8 : 85 48 __ STA T8 + 0
+24aa : 98 __ __ TYA
+24ab : 65 60 __ ADC T6 + 1
+24ad : 85 60 __ STA T6 + 1
+24af : 85 49 __ STA T8 + 1
+24b1 : a5 4a __ LDA T8 + 2
+24b3 : 65 61 __ ADC T6 + 2
+24b5 : 85 61 __ STA T6 + 2
+24b7 : 85 4a __ STA T8 + 2
+24b9 : a5 4b __ LDA T8 + 3
+24bb : 65 62 __ ADC T6 + 3
+24bd : 85 62 __ STA T6 + 3
+24bf : a2 02 __ LDX #$02
+24c1 : 06 48 __ ASL T8 + 0
+24c3 : 26 49 __ ROL T8 + 1
+24c5 : 26 4a __ ROL T8 + 2
+24c7 : 2a __ __ ROL
+24c8 : ca __ __ DEX
+24c9 : d0 f6 __ BNE $24c1
+24cb : 85 4b __ STA T8 + 3
+24cd : 38 __ __ SEC
+24ce : a5 4c __ LDA T9 + 0
+24d0 : e5 48 __ SBC T8 + 0
+24d2 : 85 48 __ STA T8 + 0
+24d4 : a5 4d __ LDA T9 + 1
+24d6 : e5 49 __ SBC T8 + 1
+24d8 : 85 49 __ STA T8 + 1
+24da : a5 4e __ LDA T9 + 2
+24dc : e5 4a __ SBC T8 + 2
+24de : 85 4a __ STA T8 + 2
+24e0 : a5 4f __ LDA T9 + 3
+24e2 : e5 4b __ SBC T8 + 3
+24e4 : 85 4b __ STA T8 + 3
+24e6 : 38 __ __ SEC
+24e7 : a5 5b __ LDA T3 + 0
+24e9 : e5 48 __ SBC T8 + 0
+24eb : 85 5b __ STA T3 + 0
+24ed : a5 5c __ LDA T3 + 1
+24ef : e5 49 __ SBC T8 + 1
+24f1 : 85 5c __ STA T3 + 1
+24f3 : a5 5d __ LDA T3 + 2
+24f5 : e5 4a __ SBC T8 + 2
+24f7 : 85 5d __ STA T3 + 2
+24f9 : a5 5e __ LDA T3 + 3
+24fb : e5 4b __ SBC T8 + 3
+24fd : 85 5e __ STA T3 + 3
+24ff : a5 44 __ LDA T1 + 1
+2501 : 10 03 __ BPL $2506
+2503 : 4c 96 23 JMP $2396 ; (rrec + 389)
+2506 : d0 09 __ BNE $2511
+2508 : a5 43 __ LDA T1 + 0
+250a : c9 03 __ CMP #$03
+250c : b0 03 __ BCS $2511
+250e : 4c 96 23 JMP $2396 ; (rrec + 389)
+2511 : a5 53 __ LDA T0 + 0
+2513 : a0 02 __ LDY #$02
+2515 : 91 23 __ STA (SP + 0),y
+2517 : a5 54 __ LDA T0 + 1
+2519 : c8 __ __ INY
+251a : 91 23 __ STA (SP + 0),y
+251c : a5 55 __ LDA T0 + 2
+251e : c8 __ __ INY
+251f : 91 23 __ STA (SP + 0),y
+2521 : a5 56 __ LDA T0 + 3
+2523 : c8 __ __ INY
+2524 : 91 23 __ STA (SP + 0),y
+2526 : a0 2a __ LDY #$2a
+2528 : b1 23 __ LDA (SP + 0),y
+252a : 38 __ __ SEC
+252b : e9 01 __ SBC #$01
+252d : aa __ __ TAX
+252e : c8 __ __ INY
+252f : b1 23 __ LDA (SP + 0),y
+2531 : e9 00 __ SBC #$00
+2533 : 85 44 __ STA T1 + 1
+2535 : 8a __ __ TXA
+2536 : a0 06 __ LDY #$06
+2538 : 91 23 __ STA (SP + 0),y
+253a : a5 44 __ LDA T1 + 1
+253c : c8 __ __ INY
+253d : 91 23 __ STA (SP + 0),y
+253f : 20 11 22 JSR $2211 ; (rrec + 0)
+2542 : a5 63 __ LDA T7 + 0
+2544 : 45 5f __ EOR T6 + 0
+2546 : aa __ __ TAX
+2547 : a5 64 __ LDA T7 + 1
+2549 : 45 60 __ EOR T6 + 1
+254b : a8 __ __ TAY
+254c : a5 65 __ LDA T7 + 2
+254e : 45 61 __ EOR T6 + 2
+2550 : 85 61 __ STA T6 + 2
+2552 : a5 66 __ LDA T7 + 3
+2554 : 45 62 __ EOR T6 + 3
+2556 : 85 62 __ STA T6 + 3
+2558 : 8a __ __ TXA
+2559 : 45 5b __ EOR T3 + 0
+255b : 85 5b __ STA T3 + 0
+255d : 98 __ __ TYA
+255e : 45 5c __ EOR T3 + 1
+2560 : 85 5c __ STA T3 + 1
+2562 : a5 61 __ LDA T6 + 2
+2564 : 45 5d __ EOR T3 + 2
+2566 : 85 5d __ STA T3 + 2
+2568 : a5 62 __ LDA T6 + 3
+256a : 45 5e __ EOR T3 + 3
+256c : 85 5e __ STA T3 + 3
+256e : 38 __ __ SEC
+256f : a5 57 __ LDA T2 + 0
+2571 : e5 5b __ SBC T3 + 0
+2573 : 85 57 __ STA T2 + 0
+2575 : a5 58 __ LDA T2 + 1
+2577 : e5 5c __ SBC T3 + 1
+2579 : 85 58 __ STA T2 + 1
+257b : a5 59 __ LDA T2 + 2
+257d : e5 5d __ SBC T3 + 2
+257f : 85 59 __ STA T2 + 2
+2581 : a5 5a __ LDA T2 + 3
+2583 : e5 5e __ SBC T3 + 3
+2585 : 85 5a __ STA T2 + 3
+2587 : a5 1b __ LDA ACCU + 0
+2589 : 45 53 __ EOR T0 + 0
+258b : 18 __ __ CLC
+258c : 65 57 __ ADC T2 + 0
+258e : 85 1b __ STA ACCU + 0
+2590 : a5 1c __ LDA ACCU + 1
+2592 : 45 54 __ EOR T0 + 1
+2594 : 65 58 __ ADC T2 + 1
+2596 : 85 1c __ STA ACCU + 1
+2598 : a5 1d __ LDA ACCU + 2
+259a : 45 55 __ EOR T0 + 2
+259c : 65 59 __ ADC T2 + 2
+259e : 85 1d __ STA ACCU + 2
+25a0 : a5 1e __ LDA ACCU + 3
+25a2 : 45 56 __ EOR T0 + 3
+25a4 : 65 5a __ ADC T2 + 3
+25a6 : 4c a7 22 JMP $22a7 ; (rrec + 150)
+--------------------------------------------------------------------
+inp_exit:
+25a9 : a9 4c __ LDA #$4c
+25ab : 85 54 __ STA $54
+25ad : a9 00 __ LDA #$00
+25af : 85 13 __ STA P6
+25b1 : a9 19 __ LDA #$19
+25b3 : 85 16 __ STA P9
+25b5 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+25b6 : a9 00 __ LDA #$00
+25b8 : 85 05 __ STA $05
+25ba : 85 06 __ STA $06
+25bc : a5 03 __ LDA $03
+25be : 4a __ __ LSR
+25bf : 90 0f __ BCC $25d0
+25c1 : aa __ __ TAX
+25c2 : 18 __ __ CLC
+25c3 : a5 05 __ LDA $05
+25c5 : 65 1b __ ADC ACCU + 0
+25c7 : 85 05 __ STA $05
+25c9 : a5 06 __ LDA $06
+25cb : 65 1c __ ADC ACCU + 1
+25cd : 85 06 __ STA $06
+25cf : 8a __ __ TXA
+25d0 : 06 1b __ ASL ACCU + 0
+25d2 : 26 1c __ ROL ACCU + 1
+25d4 : 4a __ __ LSR
+25d5 : b0 ea __ BCS $25c1
+25d7 : d0 f7 __ BNE $25d0
+25d9 : 60 __ __ RTS
+--------------------------------------------------------------------
+bcexec:
+25da : 6c 1b 00 JMP ($001b)
+--------------------------------------------------------------------
+mul32:
+25dd : a9 00 __ LDA #$00
+25df : 85 07 __ STA $07
+25e1 : 85 08 __ STA $08
+25e3 : 85 09 __ STA $09
+25e5 : 85 0a __ STA $0a
+25e7 : a2 20 __ LDX #$20
+25e9 : 46 06 __ LSR $06
+25eb : 66 05 __ ROR $05
+25ed : 66 04 __ ROR $04
+25ef : 66 03 __ ROR $03
+25f1 : 90 19 __ BCC $260c
+25f3 : 18 __ __ CLC
+25f4 : a5 07 __ LDA $07
+25f6 : 65 1b __ ADC ACCU + 0
+25f8 : 85 07 __ STA $07
+25fa : a5 08 __ LDA $08
+25fc : 65 1c __ ADC ACCU + 1
+25fe : 85 08 __ STA $08
+2600 : a5 09 __ LDA $09
+2602 : 65 1d __ ADC ACCU + 2
+2604 : 85 09 __ STA $09
+2606 : a5 0a __ LDA $0a
+2608 : 65 1e __ ADC ACCU + 3
+260a : 85 0a __ STA $0a
+260c : 06 1b __ ASL ACCU + 0
+260e : 26 1c __ ROL ACCU + 1
+2610 : 26 1d __ ROL ACCU + 2
+2612 : 26 1e __ ROL ACCU + 3
+2614 : ca __ __ DEX
+2615 : d0 d2 __ BNE $25e9
+2617 : 60 __ __ RTS
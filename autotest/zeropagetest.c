@@ -0,0 +1,130 @@
+#include <assert.h>
+
+// Values live across calls in callee saved registers, through direct
+// calls, recursion and calls through a pointer
+
+int leaf(int a, int b)
+{
+	int	s = 0;
+	for (int i = 0; i < 4; i++)
+		s += a * i - b;
+	return s;
+}
+
+int middle(int a, int b)
+{
+	int	x = a + 1, y = b * 3, z = a - b;
+	for (int i = 0; i < 3; i++)
+	{
+		x += leaf(y, z);
+		y += leaf(x, i);
+		z -= leaf(i, y);
+	}
+	return x ^ y ^ z;
+}
+
+int upper(int a)
+{
+	int	p = a * 7, q = a - 5, r = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		r += middle(p, q);
+		p += leaf(r, q);
+		q ^= middle(r, p);
+	}
+	return p + q + r;
+}
+
+int rec(int a, int n)
+{
+	int	u = a + n, v = a * n;
+	if (n > 0)
+	{
+		u += rec(v, n - 1);
+		v -= middle(u, n);
+		u ^= rec(u, n - 1);
+	}
+	return u + v;
+}
+
+int twice(int (* f)(int, int), int a, int b)
+{
+	int	s = a - b, t = b + 3;
+	s += f(a, t);
+	t += f(s, b);
+	return s * t;
+}
+
+// Reference implementations without calls between the computations
+
+int rleaf(int a, int b)
+{
+	return 6 * a - 4 * b;
+}
+
+int rmiddle(int a, int b)
+{
+	int	x = a + 1, y = b * 3, z = a - b;
+	for (int i = 0; i < 3; i++)
+	{
+		x += rleaf(y, z);
+		y += rleaf(x, i);
+		z -= rleaf(i, y);
+	}
+	return x ^ y ^ z;
+}
+
+int rupper(int a)
+{
+	int	p = a * 7, q = a - 5, r = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		r += rmiddle(p, q);
+		p += rleaf(r, q);
+		q ^= rmiddle(r, p);
+	}
+	return p + q + r;
+}
+
+int rrec(int a, int n)
+{
+	int	u = a + n, v = a * n;
+	if (n > 0)
+	{
+		u += rrec(v, n - 1);
+		v -= rmiddle(u, n);
+		u ^= rrec(u, n - 1);
+	}
+	return u + v;
+}
+
+void testcalls(void)
+{
+	for (int i = 0; i < 5; i++)
+	{
+		assert(leaf(i * 11, i - 3) == rleaf(i * 11, i - 3));
+		assert(middle(i, 17 - i) == rmiddle(i, 17 - i));
+		assert(upper(i * 3 - 4) == rupper(i * 3 - 4));
+		assert(rec(i + 2, 3) == rrec(i + 2, 3));
+	}
+}
+
+void testpointers(void)
+{
+	for (int i = 0; i < 5; i++)
+	{
+		int	s = i - 9 + rmiddle(i, 12);
+		assert(twice(middle, i, 9) == s * (12 + rmiddle(s, 9)));
+
+		int	t = i - 9 + rleaf(i, 12);
+		assert(twice(leaf, i, 9) == t * (12 + rleaf(t, 9)));
+	}
+}
+
+int main(void)
+{
+	testcalls();
+	testpointers();
+
+	return 0;
+}
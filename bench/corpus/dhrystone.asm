@@ -0,0 +1,1298 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e f8 12 STX $12f8 ; (spentry + 0)
+0811 : a9 f9 __ LDA #$f9
+0813 : 85 19 __ STA IP + 0
+0815 : a9 12 __ LDA #$12
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 27 __ LDA #$27
+081c : e9 12 __ SBC #$12
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 38 __ LDA #$38
+0832 : e9 f9 __ SBC #$f9
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c ea 11 JMP $11ea ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 4a __ SBC #$4a
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 06 __ LDY #$06
+090f : a5 25 __ LDA FP + 0
+0911 : 91 23 __ STA (SP + 0),y
+0913 : c8 __ __ INY
+0914 : a5 26 __ LDA FP + 1
+0916 : 91 23 __ STA (SP + 0),y
+0918 : 88 __ __ DEY
+0919 : 88 __ __ DEY
+091a : b9 53 00 LDA $0053,y 
+091d : 91 23 __ STA (SP + 0),y
+091f : 88 __ __ DEY
+0920 : 10 f8 __ BPL $091a
+0922 : 18 __ __ CLC
+0923 : a5 23 __ LDA SP + 0
+0925 : 69 09 __ ADC #$09
+0927 : 85 25 __ STA FP + 0
+0929 : a5 24 __ LDA SP + 1
+092b : 69 00 __ ADC #$00
+092d : 85 26 __ STA FP + 1
+092f : 38 __ __ SEC
+0930 : a5 23 __ LDA SP + 0
+0932 : e9 04 __ SBC #$04
+0934 : 85 23 __ STA SP + 0
+0936 : a5 24 __ LDA SP + 1
+0938 : e9 00 __ SBC #$00
+093a : 85 24 __ STA SP + 1
+093c : a9 f9 __ LDA #$f9
+093e : 8d 1e 13 STA $131e ; (Next_Ptr_Glob + 0)
+0941 : a9 12 __ LDA #$12
+0943 : 8d 1f 13 STA $131f ; (Next_Ptr_Glob + 1)
+0946 : a9 20 __ LDA #$20
+0948 : 8d 45 13 STA $1345 ; (Ptr_Glob + 0)
+094b : a9 13 __ LDA #$13
+094d : 8d 46 13 STA $1346 ; (Ptr_Glob + 1)
+0950 : a9 f9 __ LDA #$f9
+0952 : 8d 20 13 STA $1320 ; (Glob_Rec + 0)
+0955 : a9 12 __ LDA #$12
+0957 : 8d 21 13 STA $1321 ; (Glob_Rec + 1)
+095a : a9 00 __ LDA #$00
+095c : 8d 22 13 STA $1322 ; (Glob_Rec + 2)
+095f : a9 02 __ LDA #$02
+0961 : 8d 23 13 STA $1323 ; (Glob_Rec + 3)
+0964 : a9 28 __ LDA #$28
+0966 : 8d 24 13 STA $1324 ; (Glob_Rec + 4)
+0969 : a9 00 __ LDA #$00
+096b : 8d 25 13 STA $1325 ; (Glob_Rec + 5)
+096e : a0 ff __ LDY #$ff
+0970 : c8 __ __ INY
+0971 : b9 21 10 LDA $1021,y 
+0974 : 99 26 13 STA $1326,y ; (Glob_Rec + 6)
+0977 : d0 f7 __ BNE $0970
+0979 : 18 __ __ CLC
+097a : a5 25 __ LDA FP + 0
+097c : 69 03 __ ADC #$03
+097e : 85 4b __ STA T0 + 0
+0980 : a5 26 __ LDA FP + 1
+0982 : 69 00 __ ADC #$00
+0984 : 85 4c __ STA T0 + 1
+0986 : a0 ff __ LDY #$ff
+0988 : c8 __ __ INY
+0989 : b9 40 10 LDA $1040,y 
+098c : 91 4b __ STA (T0 + 0),y
+098e : d0 f8 __ BNE $0988
+0990 : a9 0a __ LDA #$0a
+0992 : 8d 75 16 STA $1675 ; (Arr_2_Glob + 814)
+0995 : a9 00 __ LDA #$00
+0997 : 8d 76 16 STA $1676 ; (Arr_2_Glob + 815)
+099a : a9 01 __ LDA #$01
+099c : 85 4b __ STA T0 + 0
+099e : a9 00 __ LDA #$00
+09a0 : 85 4c __ STA T0 + 1
+09a2 : a9 41 __ LDA #$41
+09a4 : 8d cf 26 STA $26cf ; (Ch_1_Glob + 0)
+09a7 : a9 01 __ LDA #$01
+09a9 : 8d d0 26 STA $26d0 ; (Bool_Glob + 0)
+09ac : a9 42 __ LDA #$42
+09ae : 8d d1 26 STA $26d1 ; (Ch_2_Glob + 0)
+09b1 : 18 __ __ CLC
+09b2 : a5 25 __ LDA FP + 0
+09b4 : 69 22 __ ADC #$22
+09b6 : 85 4d __ STA T1 + 0
+09b8 : a5 26 __ LDA FP + 1
+09ba : 69 00 __ ADC #$00
+09bc : 85 4e __ STA T1 + 1
+09be : a0 ff __ LDY #$ff
+09c0 : c8 __ __ INY
+09c1 : b9 5f 10 LDA $105f,y 
+09c4 : 91 4d __ STA (T1 + 0),y
+09c6 : d0 f8 __ BNE $09c0
+09c8 : a9 01 __ LDA #$01
+09ca : a0 02 __ LDY #$02
+09cc : 91 25 __ STA (FP + 0),y
+09ce : a9 02 __ LDA #$02
+09d0 : 85 4d __ STA T1 + 0
+09d2 : a9 00 __ LDA #$00
+09d4 : 85 4e __ STA T1 + 1
+09d6 : a9 03 __ LDA #$03
+09d8 : 85 4f __ STA T2 + 0
+09da : a9 00 __ LDA #$00
+09dc : 85 50 __ STA T2 + 1
+09de : 18 __ __ CLC
+09df : a5 25 __ LDA FP + 0
+09e1 : 69 03 __ ADC #$03
+09e3 : 85 51 __ STA T3 + 0
+09e5 : a5 26 __ LDA FP + 1
+09e7 : 69 00 __ ADC #$00
+09e9 : 85 52 __ STA T3 + 1
+09eb : 18 __ __ CLC
+09ec : a5 25 __ LDA FP + 0
+09ee : 69 22 __ ADC #$22
+09f0 : 85 53 __ STA T4 + 0
+09f2 : a5 26 __ LDA FP + 1
+09f4 : 69 00 __ ADC #$00
+09f6 : 85 54 __ STA T4 + 1
+09f8 : a9 02 __ LDA #$02
+09fa : 85 55 __ STA T5 + 0
+09fc : a9 00 __ LDA #$00
+09fe : 85 56 __ STA T5 + 1
+0a00 : 18 __ __ CLC
+0a01 : a5 51 __ LDA T3 + 0
+0a03 : 65 55 __ ADC T5 + 0
+0a05 : 85 43 __ STA T7 + 0
+0a07 : a5 52 __ LDA T3 + 1
+0a09 : 65 56 __ ADC T5 + 1
+0a0b : 85 44 __ STA T7 + 1
+0a0d : a0 00 __ LDY #$00
+0a0f : b1 43 __ LDA (T7 + 0),y
+0a11 : 85 0d __ STA P0
+0a13 : 18 __ __ CLC
+0a14 : a5 53 __ LDA T4 + 0
+0a16 : 65 55 __ ADC T5 + 0
+0a18 : 85 43 __ STA T7 + 0
+0a1a : a5 54 __ LDA T4 + 1
+0a1c : 65 56 __ ADC T5 + 1
+0a1e : 85 44 __ STA T7 + 1
+0a20 : c8 __ __ INY
+0a21 : b1 43 __ LDA (T7 + 0),y
+0a23 : 85 0e __ STA P1
+0a25 : 20 7e 10 JSR $107e ; (Func_1 + 0)
+0a28 : a5 1b __ LDA ACCU + 0
+0a2a : d0 03 __ BNE $0a2f
+0a2c : 4c 03 10 JMP $1003 ; (main + 1795)
+0a2f : a5 56 __ LDA T5 + 1
+0a31 : 30 cd __ BMI $0a00
+0a33 : d0 06 __ BNE $0a3b
+0a35 : a9 02 __ LDA #$02
+0a37 : c5 55 __ CMP T5 + 0
+0a39 : b0 c5 __ BCS $0a00
+0a3b : a5 51 __ LDA T3 + 0
+0a3d : 85 0d __ STA P0
+0a3f : a5 52 __ LDA T3 + 1
+0a41 : 85 0e __ STA P1
+0a43 : a5 53 __ LDA T4 + 0
+0a45 : 85 0f __ STA P2
+0a47 : a5 54 __ LDA T4 + 1
+0a49 : 85 10 __ STA P3
+0a4b : 20 97 10 JSR $1097 ; (strcmp + 0)
+0a4e : a5 1c __ LDA ACCU + 1
+0a50 : 30 07 __ BMI $0a59
+0a52 : 05 1b __ ORA ACCU + 0
+0a54 : f0 03 __ BEQ $0a59
+0a56 : 4c ef 0f JMP $0fef ; (main + 1775)
+0a59 : a9 01 __ LDA #$01
+0a5b : 8d d0 26 STA $26d0 ; (Bool_Glob + 0)
+0a5e : a5 25 __ LDA FP + 0
+0a60 : 85 51 __ STA T3 + 0
+0a62 : a5 26 __ LDA FP + 1
+0a64 : 85 52 __ STA T3 + 1
+0a66 : a5 4d __ LDA T1 + 0
+0a68 : 85 0d __ STA P0
+0a6a : 0a __ __ ASL
+0a6b : 85 07 __ STA $07
+0a6d : a5 4e __ LDA T1 + 1
+0a6f : 85 0e __ STA P1
+0a71 : 2a __ __ ROL
+0a72 : 06 07 __ ASL $07
+0a74 : 2a __ __ ROL
+0a75 : aa __ __ TAX
+0a76 : 18 __ __ CLC
+0a77 : a5 07 __ LDA $07
+0a79 : 65 4d __ ADC T1 + 0
+0a7b : 85 1b __ STA ACCU + 0
+0a7d : 8a __ __ TXA
+0a7e : 65 4e __ ADC T1 + 1
+0a80 : 85 1c __ STA ACCU + 1
+0a82 : 38 __ __ SEC
+0a83 : a5 1b __ LDA ACCU + 0
+0a85 : e9 03 __ SBC #$03
+0a87 : a0 00 __ LDY #$00
+0a89 : 91 25 __ STA (FP + 0),y
+0a8b : a5 1c __ LDA ACCU + 1
+0a8d : e9 00 __ SBC #$00
+0a8f : c8 __ __ INY
+0a90 : 91 25 __ STA (FP + 0),y
+0a92 : a9 03 __ LDA #$03
+0a94 : 85 0f __ STA P2
+0a96 : a9 00 __ LDA #$00
+0a98 : 85 10 __ STA P3
+0a9a : a5 51 __ LDA T3 + 0
+0a9c : 85 11 __ STA P4
+0a9e : a5 52 __ LDA T3 + 1
+0aa0 : 85 12 __ STA P5
+0aa2 : 20 c6 10 JSR $10c6 ; (Proc_7 + 0)
+0aa5 : e6 4d __ INC T1 + 0
+0aa7 : d0 02 __ BNE $0aab
+0aa9 : e6 4e __ INC T1 + 1
+0aab : a5 4e __ LDA T1 + 1
+0aad : 49 80 __ EOR #$80
+0aaf : c9 80 __ CMP #$80
+0ab1 : d0 04 __ BNE $0ab7
+0ab3 : a5 4d __ LDA T1 + 0
+0ab5 : c9 03 __ CMP #$03
+0ab7 : 90 ad __ BCC $0a66
+0ab9 : a5 4d __ LDA T1 + 0
+0abb : 0a __ __ ASL
+0abc : 85 51 __ STA T3 + 0
+0abe : a0 00 __ LDY #$00
+0ac0 : b1 25 __ LDA (FP + 0),y
+0ac2 : aa __ __ TAX
+0ac3 : c8 __ __ INY
+0ac4 : b1 25 __ LDA (FP + 0),y
+0ac6 : 85 56 __ STA T5 + 1
+0ac8 : 8a __ __ TXA
+0ac9 : a4 51 __ LDY T3 + 0
+0acb : 99 de 26 STA $26de,y ; (Arr_1_Glob + 10)
+0ace : a5 56 __ LDA T5 + 1
+0ad0 : 99 df 26 STA $26df,y ; (Arr_1_Glob + 11)
+0ad3 : 8a __ __ TXA
+0ad4 : 99 e0 26 STA $26e0,y ; (Arr_1_Glob + 12)
+0ad7 : a5 56 __ LDA T5 + 1
+0ad9 : 99 e1 26 STA $26e1,y ; (Arr_1_Glob + 13)
+0adc : 18 __ __ CLC
+0add : a5 4d __ LDA T1 + 0
+0adf : 69 05 __ ADC #$05
+0ae1 : 85 53 __ STA T4 + 0
+0ae3 : 99 1a 27 STA $271a,y ; (Arr_1_Glob + 70)
+0ae6 : a5 4e __ LDA T1 + 1
+0ae8 : 69 00 __ ADC #$00
+0aea : 85 54 __ STA T4 + 1
+0aec : 99 1b 27 STA $271b,y ; (Arr_1_Glob + 71)
+0aef : 18 __ __ CLC
+0af0 : a5 4d __ LDA T1 + 0
+0af2 : 69 06 __ ADC #$06
+0af4 : 85 43 __ STA T7 + 0
+0af6 : a5 4e __ LDA T1 + 1
+0af8 : 69 00 __ ADC #$00
+0afa : aa __ __ TAX
+0afb : a5 54 __ LDA T4 + 1
+0afd : 49 80 __ EOR #$80
+0aff : 85 03 __ STA $03
+0b01 : 8a __ __ TXA
+0b02 : 49 80 __ EOR #$80
+0b04 : c5 03 __ CMP $03
+0b06 : d0 04 __ BNE $0b0c
+0b08 : a5 43 __ LDA T7 + 0
+0b0a : c5 53 __ CMP T4 + 0
+0b0c : b0 03 __ BCS $0b11
+0b0e : 4c 96 0b JMP $0b96 ; (main + 662)
+0b11 : a5 53 __ LDA T4 + 0
+0b13 : 85 43 __ STA T7 + 0
+0b15 : a5 54 __ LDA T4 + 1
+0b17 : 85 44 __ STA T7 + 1
+0b19 : 18 __ __ CLC
+0b1a : a5 53 __ LDA T4 + 0
+0b1c : 69 01 __ ADC #$01
+0b1e : 85 45 __ STA T9 + 0
+0b20 : a5 54 __ LDA T4 + 1
+0b22 : 69 00 __ ADC #$00
+0b24 : 85 46 __ STA T9 + 1
+0b26 : a5 53 __ LDA T4 + 0
+0b28 : 0a __ __ ASL
+0b29 : aa __ __ TAX
+0b2a : a5 54 __ LDA T4 + 1
+0b2c : 2a __ __ ROL
+0b2d : a8 __ __ TAY
+0b2e : 18 __ __ CLC
+0b2f : 8a __ __ TXA
+0b30 : 65 53 __ ADC T4 + 0
+0b32 : aa __ __ TAX
+0b33 : 98 __ __ TYA
+0b34 : 65 54 __ ADC T4 + 1
+0b36 : 85 03 __ STA $03
+0b38 : 8a __ __ TXA
+0b39 : 0a __ __ ASL
+0b3a : 26 03 __ ROL $03
+0b3c : 0a __ __ ASL
+0b3d : 26 03 __ ROL $03
+0b3f : 0a __ __ ASL
+0b40 : 26 03 __ ROL $03
+0b42 : 18 __ __ CLC
+0b43 : 65 53 __ ADC T4 + 0
+0b45 : 85 1b __ STA ACCU + 0
+0b47 : a5 03 __ LDA $03
+0b49 : 65 54 __ ADC T4 + 1
+0b4b : 06 1b __ ASL ACCU + 0
+0b4d : 2a __ __ ROL
+0b4e : 85 48 __ STA T10 + 1
+0b50 : a5 1b __ LDA ACCU + 0
+0b52 : 85 47 __ STA T10 + 0
+0b54 : 18 __ __ CLC
+0b55 : a5 47 __ LDA T10 + 0
+0b57 : 65 43 __ ADC T7 + 0
+0b59 : 85 49 __ STA T11 + 0
+0b5b : a5 48 __ LDA T10 + 1
+0b5d : 65 44 __ ADC T7 + 1
+0b5f : 06 49 __ ASL T11 + 0
+0b61 : 2a __ __ ROL
+0b62 : 85 4a __ STA T11 + 1
+0b64 : 18 __ __ CLC
+0b65 : a9 47 __ LDA #$47
+0b67 : 65 49 __ ADC T11 + 0
+0b69 : 85 49 __ STA T11 + 0
+0b6b : a9 13 __ LDA #$13
+0b6d : 65 4a __ ADC T11 + 1
+0b6f : 85 4a __ STA T11 + 1
+0b71 : a5 53 __ LDA T4 + 0
+0b73 : a0 00 __ LDY #$00
+0b75 : 91 49 __ STA (T11 + 0),y
+0b77 : a5 54 __ LDA T4 + 1
+0b79 : c8 __ __ INY
+0b7a : 91 49 __ STA (T11 + 0),y
+0b7c : e6 43 __ INC T7 + 0
+0b7e : d0 02 __ BNE $0b82
+0b80 : e6 44 __ INC T7 + 1
+0b82 : a5 44 __ LDA T7 + 1
+0b84 : 49 80 __ EOR #$80
+0b86 : 85 03 __ STA $03
+0b88 : a5 46 __ LDA T9 + 1
+0b8a : 49 80 __ EOR #$80
+0b8c : c5 03 __ CMP $03
+0b8e : d0 04 __ BNE $0b94
+0b90 : a5 45 __ LDA T9 + 0
+0b92 : c5 43 __ CMP T7 + 0
+0b94 : b0 be __ BCS $0b54
+0b96 : a5 53 __ LDA T4 + 0
+0b98 : 0a __ __ ASL
+0b99 : aa __ __ TAX
+0b9a : a5 54 __ LDA T4 + 1
+0b9c : 2a __ __ ROL
+0b9d : a8 __ __ TAY
+0b9e : 18 __ __ CLC
+0b9f : 8a __ __ TXA
+0ba0 : 65 53 __ ADC T4 + 0
+0ba2 : aa __ __ TAX
+0ba3 : 98 __ __ TYA
+0ba4 : 65 54 __ ADC T4 + 1
+0ba6 : 85 03 __ STA $03
+0ba8 : 8a __ __ TXA
+0ba9 : 0a __ __ ASL
+0baa : 26 03 __ ROL $03
+0bac : 0a __ __ ASL
+0bad : 26 03 __ ROL $03
+0baf : 0a __ __ ASL
+0bb0 : 26 03 __ ROL $03
+0bb2 : 18 __ __ CLC
+0bb3 : 65 53 __ ADC T4 + 0
+0bb5 : 85 1b __ STA ACCU + 0
+0bb7 : a5 03 __ LDA $03
+0bb9 : 65 54 __ ADC T4 + 1
+0bbb : 06 1b __ ASL ACCU + 0
+0bbd : 2a __ __ ROL
+0bbe : 85 1c __ STA ACCU + 1
+0bc0 : 18 __ __ CLC
+0bc1 : a5 1b __ LDA ACCU + 0
+0bc3 : 65 53 __ ADC T4 + 0
+0bc5 : aa __ __ TAX
+0bc6 : a5 1c __ LDA ACCU + 1
+0bc8 : 65 54 __ ADC T4 + 1
+0bca : a8 __ __ TAY
+0bcb : 38 __ __ SEC
+0bcc : 8a __ __ TXA
+0bcd : e9 01 __ SBC #$01
+0bcf : 85 43 __ STA T7 + 0
+0bd1 : 98 __ __ TYA
+0bd2 : e9 00 __ SBC #$00
+0bd4 : 06 43 __ ASL T7 + 0
+0bd6 : 2a __ __ ROL
+0bd7 : 85 44 __ STA T7 + 1
+0bd9 : 18 __ __ CLC
+0bda : a9 47 __ LDA #$47
+0bdc : 65 43 __ ADC T7 + 0
+0bde : 85 43 __ STA T7 + 0
+0be0 : a9 13 __ LDA #$13
+0be2 : 65 44 __ ADC T7 + 1
+0be4 : 85 44 __ STA T7 + 1
+0be6 : 18 __ __ CLC
+0be7 : a0 00 __ LDY #$00
+0be9 : b1 43 __ LDA (T7 + 0),y
+0beb : 69 01 __ ADC #$01
+0bed : 91 43 __ STA (T7 + 0),y
+0bef : c8 __ __ INY
+0bf0 : b1 43 __ LDA (T7 + 0),y
+0bf2 : 69 00 __ ADC #$00
+0bf4 : 91 43 __ STA (T7 + 0),y
+0bf6 : a5 53 __ LDA T4 + 0
+0bf8 : 0a __ __ ASL
+0bf9 : 85 43 __ STA T7 + 0
+0bfb : a5 54 __ LDA T4 + 1
+0bfd : 2a __ __ ROL
+0bfe : 85 44 __ STA T7 + 1
+0c00 : 18 __ __ CLC
+0c01 : a9 d4 __ LDA #$d4
+0c03 : 65 43 __ ADC T7 + 0
+0c05 : 85 51 __ STA T3 + 0
+0c07 : a9 26 __ LDA #$26
+0c09 : 65 44 __ ADC T7 + 1
+0c0b : 85 52 __ STA T3 + 1
+0c0d : 18 __ __ CLC
+0c0e : a5 53 __ LDA T4 + 0
+0c10 : 69 14 __ ADC #$14
+0c12 : 85 43 __ STA T7 + 0
+0c14 : a5 54 __ LDA T4 + 1
+0c16 : 69 00 __ ADC #$00
+0c18 : 85 44 __ STA T7 + 1
+0c1a : a5 43 __ LDA T7 + 0
+0c1c : 0a __ __ ASL
+0c1d : aa __ __ TAX
+0c1e : a5 44 __ LDA T7 + 1
+0c20 : 2a __ __ ROL
+0c21 : a8 __ __ TAY
+0c22 : 18 __ __ CLC
+0c23 : 8a __ __ TXA
+0c24 : 65 43 __ ADC T7 + 0
+0c26 : aa __ __ TAX
+0c27 : 98 __ __ TYA
+0c28 : 65 44 __ ADC T7 + 1
+0c2a : 85 03 __ STA $03
+0c2c : 8a __ __ TXA
+0c2d : 0a __ __ ASL
+0c2e : 26 03 __ ROL $03
+0c30 : 0a __ __ ASL
+0c31 : 26 03 __ ROL $03
+0c33 : 0a __ __ ASL
+0c34 : 26 03 __ ROL $03
+0c36 : 18 __ __ CLC
+0c37 : 65 43 __ ADC T7 + 0
+0c39 : 85 1b __ STA ACCU + 0
+0c3b : a5 03 __ LDA $03
+0c3d : 65 44 __ ADC T7 + 1
+0c3f : 06 1b __ ASL ACCU + 0
+0c41 : 2a __ __ ROL
+0c42 : 85 1c __ STA ACCU + 1
+0c44 : 18 __ __ CLC
+0c45 : a5 1b __ LDA ACCU + 0
+0c47 : 65 53 __ ADC T4 + 0
+0c49 : 85 53 __ STA T4 + 0
+0c4b : a5 1c __ LDA ACCU + 1
+0c4d : 65 54 __ ADC T4 + 1
+0c4f : 06 53 __ ASL T4 + 0
+0c51 : 2a __ __ ROL
+0c52 : 85 54 __ STA T4 + 1
+0c54 : 18 __ __ CLC
+0c55 : a9 47 __ LDA #$47
+0c57 : 65 53 __ ADC T4 + 0
+0c59 : 85 53 __ STA T4 + 0
+0c5b : a9 13 __ LDA #$13
+0c5d : 65 54 __ ADC T4 + 1
+0c5f : 85 54 __ STA T4 + 1
+0c61 : a0 00 __ LDY #$00
+0c63 : b1 51 __ LDA (T3 + 0),y
+0c65 : 91 53 __ STA (T4 + 0),y
+0c67 : c8 __ __ INY
+0c68 : b1 51 __ LDA (T3 + 0),y
+0c6a : 91 53 __ STA (T4 + 0),y
+0c6c : a9 05 __ LDA #$05
+0c6e : 8d d2 26 STA $26d2 ; (Int_Glob + 0)
+0c71 : a9 00 __ LDA #$00
+0c73 : 8d d3 26 STA $26d3 ; (Int_Glob + 1)
+0c76 : ad 45 13 LDA $1345 ; (Ptr_Glob + 0)
+0c79 : 85 51 __ STA T3 + 0
+0c7b : ad 46 13 LDA $1346 ; (Ptr_Glob + 1)
+0c7e : 85 52 __ STA T3 + 1
+0c80 : 88 __ __ DEY
+0c81 : b1 51 __ LDA (T3 + 0),y
+0c83 : 85 53 __ STA T4 + 0
+0c85 : c8 __ __ INY
+0c86 : b1 51 __ LDA (T3 + 0),y
+0c88 : 85 54 __ STA T4 + 1
+0c8a : 88 __ __ DEY
+0c8b : b1 51 __ LDA (T3 + 0),y
+0c8d : 85 55 __ STA T5 + 0
+0c8f : c8 __ __ INY
+0c90 : b1 51 __ LDA (T3 + 0),y
+0c92 : 85 56 __ STA T5 + 1
+0c94 : a0 24 __ LDY #$24
+0c96 : b1 51 __ LDA (T3 + 0),y
+0c98 : 91 55 __ STA (T5 + 0),y
+0c9a : 88 __ __ DEY
+0c9b : 10 f9 __ BPL $0c96
+0c9d : a9 05 __ LDA #$05
+0c9f : a0 04 __ LDY #$04
+0ca1 : 91 51 __ STA (T3 + 0),y
+0ca3 : a9 00 __ LDA #$00
+0ca5 : c8 __ __ INY
+0ca6 : 91 51 __ STA (T3 + 0),y
+0ca8 : a9 05 __ LDA #$05
+0caa : 88 __ __ DEY
+0cab : 91 53 __ STA (T4 + 0),y
+0cad : a9 00 __ LDA #$00
+0caf : c8 __ __ INY
+0cb0 : 91 53 __ STA (T4 + 0),y
+0cb2 : a0 00 __ LDY #$00
+0cb4 : b1 51 __ LDA (T3 + 0),y
+0cb6 : 91 53 __ STA (T4 + 0),y
+0cb8 : c8 __ __ INY
+0cb9 : b1 51 __ LDA (T3 + 0),y
+0cbb : 91 53 __ STA (T4 + 0),y
+0cbd : a5 53 __ LDA T4 + 0
+0cbf : c8 __ __ INY
+0cc0 : 91 23 __ STA (SP + 0),y
+0cc2 : a5 54 __ LDA T4 + 1
+0cc4 : c8 __ __ INY
+0cc5 : 91 23 __ STA (SP + 0),y
+0cc7 : 20 e4 10 JSR $10e4 ; (Proc_3 + 0)
+0cca : a0 02 __ LDY #$02
+0ccc : b1 53 __ LDA (T4 + 0),y
+0cce : d0 03 __ BNE $0cd3
+0cd0 : 4c 85 0f JMP $0f85 ; (main + 1669)
+0cd3 : a0 00 __ LDY #$00
+0cd5 : b1 51 __ LDA (T3 + 0),y
+0cd7 : 85 53 __ STA T4 + 0
+0cd9 : c8 __ __ INY
+0cda : b1 51 __ LDA (T3 + 0),y
+0cdc : 85 54 __ STA T4 + 1
+0cde : a0 24 __ LDY #$24
+0ce0 : b1 53 __ LDA (T4 + 0),y
+0ce2 : 91 51 __ STA (T3 + 0),y
+0ce4 : 88 __ __ DEY
+0ce5 : 10 f9 __ BPL $0ce0
+0ce7 : a9 41 __ LDA #$41
+0ce9 : 85 57 __ STA T6 + 0
+0ceb : ad d1 26 LDA $26d1 ; (Ch_2_Glob + 0)
+0cee : c9 41 __ CMP #$41
+0cf0 : 90 23 __ BCC $0d15
+0cf2 : a0 02 __ LDY #$02
+0cf4 : b1 25 __ LDA (FP + 0),y
+0cf6 : 85 58 __ STA T8 + 0
+0cf8 : a5 57 __ LDA T6 + 0
+0cfa : 85 0d __ STA P0
+0cfc : a9 43 __ LDA #$43
+0cfe : 85 0e __ STA P1
+0d00 : 20 7e 10 JSR $107e ; (Func_1 + 0)
+0d03 : a5 58 __ LDA T8 + 0
+0d05 : c5 1b __ CMP ACCU + 0
+0d07 : d0 03 __ BNE $0d0c
+0d09 : 4c 3d 0f JMP $0f3d ; (main + 1597)
+0d0c : ae d1 26 LDX $26d1 ; (Ch_2_Glob + 0)
+0d0f : e6 57 __ INC T6 + 0
+0d11 : e4 57 __ CPX T6 + 0
+0d13 : b0 dd __ BCS $0cf2
+0d15 : ad cf 26 LDA $26cf ; (Ch_1_Glob + 0)
+0d18 : 85 57 __ STA T6 + 0
+0d1a : a5 4f __ LDA T2 + 0
+0d1c : 85 1b __ STA ACCU + 0
+0d1e : a5 50 __ LDA T2 + 1
+0d20 : 85 1c __ STA ACCU + 1
+0d22 : a5 4d __ LDA T1 + 0
+0d24 : 85 03 __ STA $03
+0d26 : a5 4e __ LDA T1 + 1
+0d28 : 85 04 __ STA $04
+0d2a : 20 f7 11 JSR $11f7 ; (mul16 + 0)
+0d2d : a5 05 __ LDA $05
+0d2f : 85 1b __ STA ACCU + 0
+0d31 : 85 4d __ STA T1 + 0
+0d33 : a5 06 __ LDA $06
+0d35 : 85 1c __ STA ACCU + 1
+0d37 : 85 4e __ STA T1 + 1
+0d39 : a0 00 __ LDY #$00
+0d3b : b1 25 __ LDA (FP + 0),y
+0d3d : 85 4f __ STA T2 + 0
+0d3f : 85 03 __ STA $03
+0d41 : c8 __ __ INY
+0d42 : b1 25 __ LDA (FP + 0),y
+0d44 : 85 50 __ STA T2 + 1
+0d46 : 85 04 __ STA $04
+0d48 : 20 39 12 JSR $1239 ; (divs16 + 0)
+0d4b : a5 1b __ LDA ACCU + 0
+0d4d : 85 51 __ STA T3 + 0
+0d4f : a5 1c __ LDA ACCU + 1
+0d51 : 85 52 __ STA T3 + 1
+0d53 : 18 __ __ CLC
+0d54 : a5 1b __ LDA ACCU + 0
+0d56 : 69 0a __ ADC #$0a
+0d58 : 85 53 __ STA T4 + 0
+0d5a : a5 1c __ LDA ACCU + 1
+0d5c : 69 00 __ ADC #$00
+0d5e : 85 54 __ STA T4 + 1
+0d60 : 38 __ __ SEC
+0d61 : a5 4d __ LDA T1 + 0
+0d63 : e5 4f __ SBC T2 + 0
+0d65 : 85 4d __ STA T1 + 0
+0d67 : a5 4e __ LDA T1 + 1
+0d69 : e5 50 __ SBC T2 + 1
+0d6b : 85 4e __ STA T1 + 1
+0d6d : a5 4d __ LDA T1 + 0
+0d6f : 0a __ __ ASL
+0d70 : 85 07 __ STA $07
+0d72 : a5 4e __ LDA T1 + 1
+0d74 : 2a __ __ ROL
+0d75 : 06 07 __ ASL $07
+0d77 : 2a __ __ ROL
+0d78 : 06 07 __ ASL $07
+0d7a : 2a __ __ ROL
+0d7b : aa __ __ TAX
+0d7c : 38 __ __ SEC
+0d7d : a5 07 __ LDA $07
+0d7f : e5 4d __ SBC T1 + 0
+0d81 : 85 1b __ STA ACCU + 0
+0d83 : 8a __ __ TXA
+0d84 : e5 4e __ SBC T1 + 1
+0d86 : 85 1c __ STA ACCU + 1
+0d88 : 38 __ __ SEC
+0d89 : a5 1b __ LDA ACCU + 0
+0d8b : e5 51 __ SBC T3 + 0
+0d8d : 85 4d __ STA T1 + 0
+0d8f : a5 1c __ LDA ACCU + 1
+0d91 : e5 52 __ SBC T3 + 1
+0d93 : 85 4e __ STA T1 + 1
+0d95 : a5 57 __ LDA T6 + 0
+0d97 : c9 41 __ CMP #$41
+0d99 : f0 07 __ BEQ $0da2
+0d9b : ad cf 26 LDA $26cf ; (Ch_1_Glob + 0)
+0d9e : c9 41 __ CMP #$41
+0da0 : d0 f9 __ BNE $0d9b
+0da2 : 38 __ __ SEC
+0da3 : a5 53 __ LDA T4 + 0
+0da5 : e9 01 __ SBC #$01
+0da7 : aa __ __ TAX
+0da8 : a5 54 __ LDA T4 + 1
+0daa : e9 00 __ SBC #$00
+0dac : a8 __ __ TAY
+0dad : 38 __ __ SEC
+0dae : 8a __ __ TXA
+0daf : ed d2 26 SBC $26d2 ; (Int_Glob + 0)
+0db2 : 85 51 __ STA T3 + 0
+0db4 : 98 __ __ TYA
+0db5 : ed d3 26 SBC $26d3 ; (Int_Glob + 1)
+0db8 : 85 52 __ STA T3 + 1
+0dba : e6 4b __ INC T0 + 0
+0dbc : d0 02 __ BNE $0dc0
+0dbe : e6 4c __ INC T0 + 1
+0dc0 : a5 4c __ LDA T0 + 1
+0dc2 : 49 80 __ EOR #$80
+0dc4 : c9 81 __ CMP #$81
+0dc6 : d0 04 __ BNE $0dcc
+0dc8 : a5 4b __ LDA T0 + 0
+0dca : c9 f5 __ CMP #$f5
+0dcc : b0 03 __ BCS $0dd1
+0dce : 4c a2 09 JMP $09a2 ; (main + 162)
+0dd1 : ad d2 26 LDA $26d2 ; (Int_Glob + 0)
+0dd4 : 85 4b __ STA T0 + 0
+0dd6 : ad d3 26 LDA $26d3 ; (Int_Glob + 1)
+0dd9 : d0 19 __ BNE $0df4
+0ddb : a5 4b __ LDA T0 + 0
+0ddd : c9 05 __ CMP #$05
+0ddf : d0 13 __ BNE $0df4
+0de1 : ad d0 26 LDA $26d0 ; (Bool_Glob + 0)
+0de4 : f0 0e __ BEQ $0df4
+0de6 : ad cf 26 LDA $26cf ; (Ch_1_Glob + 0)
+0de9 : c9 41 __ CMP #$41
+0deb : d0 07 __ BNE $0df4
+0ded : ad d1 26 LDA $26d1 ; (Ch_2_Glob + 0)
+0df0 : c9 42 __ CMP #$42
+0df2 : f0 38 __ BEQ $0e2c
+0df4 : a9 01 __ LDA #$01
+0df6 : 85 1b __ STA ACCU + 0
+0df8 : a9 00 __ LDA #$00
+0dfa : 85 1c __ STA ACCU + 1
+0dfc : 18 __ __ CLC
+0dfd : a5 23 __ LDA SP + 0
+0dff : 69 04 __ ADC #$04
+0e01 : 85 23 __ STA SP + 0
+0e03 : a5 24 __ LDA SP + 1
+0e05 : 69 00 __ ADC #$00
+0e07 : 85 24 __ STA SP + 1
+0e09 : a0 06 __ LDY #$06
+0e0b : b1 23 __ LDA (SP + 0),y
+0e0d : 85 25 __ STA FP + 0
+0e0f : c8 __ __ INY
+0e10 : b1 23 __ LDA (SP + 0),y
+0e12 : 85 26 __ STA FP + 1
+0e14 : 88 __ __ DEY
+0e15 : 88 __ __ DEY
+0e16 : b1 23 __ LDA (SP + 0),y
+0e18 : 99 53 00 STA $0053,y 
+0e1b : 88 __ __ DEY
+0e1c : 10 f8 __ BPL $0e16
+0e1e : 18 __ __ CLC
+0e1f : a5 23 __ LDA SP + 0
+0e21 : 69 4a __ ADC #$4a
+0e23 : 85 23 __ STA SP + 0
+0e25 : a5 24 __ LDA SP + 1
+0e27 : 69 00 __ ADC #$00
+0e29 : 85 24 __ STA SP + 1
+0e2b : 60 __ __ RTS
+0e2c : ad e4 26 LDA $26e4 ; (Arr_1_Glob + 16)
+0e2f : 85 4b __ STA T0 + 0
+0e31 : ad e5 26 LDA $26e5 ; (Arr_1_Glob + 17)
+0e34 : d0 18 __ BNE $0e4e
+0e36 : a5 4b __ LDA T0 + 0
+0e38 : c9 07 __ CMP #$07
+0e3a : d0 12 __ BNE $0e4e
+0e3c : ad 75 16 LDA $1675 ; (Arr_2_Glob + 814)
+0e3f : 85 4b __ STA T0 + 0
+0e41 : ad 76 16 LDA $1676 ; (Arr_2_Glob + 815)
+0e44 : c9 01 __ CMP #$01
+0e46 : d0 06 __ BNE $0e4e
+0e48 : a5 4b __ LDA T0 + 0
+0e4a : c9 fe __ CMP #$fe
+0e4c : f0 09 __ BEQ $0e57
+0e4e : a9 02 __ LDA #$02
+0e50 : 85 1b __ STA ACCU + 0
+0e52 : a9 00 __ LDA #$00
+0e54 : 4c fa 0d JMP $0dfa ; (main + 1274)
+0e57 : ad 45 13 LDA $1345 ; (Ptr_Glob + 0)
+0e5a : 85 4b __ STA T0 + 0
+0e5c : ad 46 13 LDA $1346 ; (Ptr_Glob + 1)
+0e5f : 85 4c __ STA T0 + 1
+0e61 : a0 02 __ LDY #$02
+0e63 : b1 4b __ LDA (T0 + 0),y
+0e65 : d0 19 __ BNE $0e80
+0e67 : a0 03 __ LDY #$03
+0e69 : b1 4b __ LDA (T0 + 0),y
+0e6b : c9 02 __ CMP #$02
+0e6d : d0 11 __ BNE $0e80
+0e6f : a0 04 __ LDY #$04
+0e71 : b1 4b __ LDA (T0 + 0),y
+0e73 : 85 4f __ STA T2 + 0
+0e75 : c8 __ __ INY
+0e76 : b1 4b __ LDA (T0 + 0),y
+0e78 : d0 06 __ BNE $0e80
+0e7a : a5 4f __ LDA T2 + 0
+0e7c : c9 11 __ CMP #$11
+0e7e : f0 09 __ BEQ $0e89
+0e80 : a9 03 __ LDA #$03
+0e82 : 85 1b __ STA ACCU + 0
+0e84 : a9 00 __ LDA #$00
+0e86 : 4c fa 0d JMP $0dfa ; (main + 1274)
+0e89 : ad 1e 13 LDA $131e ; (Next_Ptr_Glob + 0)
+0e8c : 85 4f __ STA T2 + 0
+0e8e : ad 1f 13 LDA $131f ; (Next_Ptr_Glob + 1)
+0e91 : 85 50 __ STA T2 + 1
+0e93 : a0 02 __ LDY #$02
+0e95 : b1 4f __ LDA (T2 + 0),y
+0e97 : d0 19 __ BNE $0eb2
+0e99 : a0 03 __ LDY #$03
+0e9b : b1 4f __ LDA (T2 + 0),y
+0e9d : c9 01 __ CMP #$01
+0e9f : d0 11 __ BNE $0eb2
+0ea1 : a0 04 __ LDY #$04
+0ea3 : b1 4f __ LDA (T2 + 0),y
+0ea5 : 85 02 __ STA $02
+0ea7 : c8 __ __ INY
+0ea8 : b1 4f __ LDA (T2 + 0),y
+0eaa : d0 06 __ BNE $0eb2
+0eac : a5 02 __ LDA $02
+0eae : c9 12 __ CMP #$12
+0eb0 : f0 09 __ BEQ $0ebb
+0eb2 : a9 04 __ LDA #$04
+0eb4 : 85 1b __ STA ACCU + 0
+0eb6 : a9 00 __ LDA #$00
+0eb8 : 4c fa 0d JMP $0dfa ; (main + 1274)
+0ebb : a5 52 __ LDA T3 + 1
+0ebd : d0 29 __ BNE $0ee8
+0ebf : a5 51 __ LDA T3 + 0
+0ec1 : c9 05 __ CMP #$05
+0ec3 : d0 23 __ BNE $0ee8
+0ec5 : a5 4e __ LDA T1 + 1
+0ec7 : d0 1f __ BNE $0ee8
+0ec9 : a5 4d __ LDA T1 + 0
+0ecb : c9 0d __ CMP #$0d
+0ecd : d0 19 __ BNE $0ee8
+0ecf : a0 00 __ LDY #$00
+0ed1 : b1 25 __ LDA (FP + 0),y
+0ed3 : 85 4d __ STA T1 + 0
+0ed5 : c8 __ __ INY
+0ed6 : b1 25 __ LDA (FP + 0),y
+0ed8 : d0 0e __ BNE $0ee8
+0eda : a5 4d __ LDA T1 + 0
+0edc : c9 07 __ CMP #$07
+0ede : d0 08 __ BNE $0ee8
+0ee0 : a0 02 __ LDY #$02
+0ee2 : b1 25 __ LDA (FP + 0),y
+0ee4 : c9 01 __ CMP #$01
+0ee6 : f0 09 __ BEQ $0ef1
+0ee8 : a9 05 __ LDA #$05
+0eea : 85 1b __ STA ACCU + 0
+0eec : a9 00 __ LDA #$00
+0eee : 4c fa 0d JMP $0dfa ; (main + 1274)
+0ef1 : 18 __ __ CLC
+0ef2 : a5 4b __ LDA T0 + 0
+0ef4 : 69 06 __ ADC #$06
+0ef6 : 85 0d __ STA P0
+0ef8 : a5 4c __ LDA T0 + 1
+0efa : 69 00 __ ADC #$00
+0efc : 85 0e __ STA P1
+0efe : a9 ac __ LDA #$ac
+0f00 : 85 0f __ STA P2
+0f02 : a9 11 __ LDA #$11
+0f04 : 85 10 __ STA P3
+0f06 : 20 97 10 JSR $1097 ; (strcmp + 0)
+0f09 : a5 1b __ LDA ACCU + 0
+0f0b : 05 1c __ ORA ACCU + 1
+0f0d : d0 25 __ BNE $0f34
+0f0f : 18 __ __ CLC
+0f10 : a5 25 __ LDA FP + 0
+0f12 : 69 22 __ ADC #$22
+0f14 : 85 0d __ STA P0
+0f16 : a5 26 __ LDA FP + 1
+0f18 : 69 00 __ ADC #$00
+0f1a : 85 0e __ STA P1
+0f1c : a9 cb __ LDA #$cb
+0f1e : 85 0f __ STA P2
+0f20 : a9 11 __ LDA #$11
+0f22 : 85 10 __ STA P3
+0f24 : 20 97 10 JSR $1097 ; (strcmp + 0)
+0f27 : a5 1b __ LDA ACCU + 0
+0f29 : 05 1c __ ORA ACCU + 1
+0f2b : d0 07 __ BNE $0f34
+0f2d : a9 00 __ LDA #$00
+0f2f : 85 1b __ STA ACCU + 0
+0f31 : 4c fa 0d JMP $0dfa ; (main + 1274)
+0f34 : a9 06 __ LDA #$06
+0f36 : 85 1b __ STA ACCU + 0
+0f38 : a9 00 __ LDA #$00
+0f3a : 4c fa 0d JMP $0dfa ; (main + 1274)
+0f3d : 18 __ __ CLC
+0f3e : a5 25 __ LDA FP + 0
+0f40 : 69 02 __ ADC #$02
+0f42 : 85 0e __ STA P1
+0f44 : a5 26 __ LDA FP + 1
+0f46 : 69 00 __ ADC #$00
+0f48 : 85 0f __ STA P2
+0f4a : a9 00 __ LDA #$00
+0f4c : 85 0d __ STA P0
+0f4e : 20 36 11 JSR $1136 ; (Proc_6 + 0)
+0f51 : 18 __ __ CLC
+0f52 : a5 25 __ LDA FP + 0
+0f54 : 69 22 __ ADC #$22
+0f56 : 85 4f __ STA T2 + 0
+0f58 : a5 26 __ LDA FP + 1
+0f5a : 69 00 __ ADC #$00
+0f5c : 85 50 __ STA T2 + 1
+0f5e : a0 ff __ LDY #$ff
+0f60 : c8 __ __ INY
+0f61 : b9 8d 11 LDA $118d,y 
+0f64 : 91 4f __ STA (T2 + 0),y
+0f66 : d0 f8 __ BNE $0f60
+0f68 : a5 4b __ LDA T0 + 0
+0f6a : 85 4f __ STA T2 + 0
+0f6c : 8d d2 26 STA $26d2 ; (Int_Glob + 0)
+0f6f : a5 4c __ LDA T0 + 1
+0f71 : 85 50 __ STA T2 + 1
+0f73 : 8d d3 26 STA $26d3 ; (Int_Glob + 1)
+0f76 : ae d1 26 LDX $26d1 ; (Ch_2_Glob + 0)
+0f79 : e6 57 __ INC T6 + 0
+0f7b : e4 57 __ CPX T6 + 0
+0f7d : b0 03 __ BCS $0f82
+0f7f : 4c 15 0d JMP $0d15 ; (main + 1045)
+0f82 : 4c f2 0c JMP $0cf2 ; (main + 1010)
+0f85 : a9 06 __ LDA #$06
+0f87 : a0 04 __ LDY #$04
+0f89 : 91 53 __ STA (T4 + 0),y
+0f8b : a9 00 __ LDA #$00
+0f8d : c8 __ __ INY
+0f8e : 91 53 __ STA (T4 + 0),y
+0f90 : a0 03 __ LDY #$03
+0f92 : b1 51 __ LDA (T3 + 0),y
+0f94 : 85 0d __ STA P0
+0f96 : 18 __ __ CLC
+0f97 : a5 53 __ LDA T4 + 0
+0f99 : 69 03 __ ADC #$03
+0f9b : 85 0e __ STA P1
+0f9d : a5 54 __ LDA T4 + 1
+0f9f : 69 00 __ ADC #$00
+0fa1 : 85 0f __ STA P2
+0fa3 : 20 36 11 JSR $1136 ; (Proc_6 + 0)
+0fa6 : ad 45 13 LDA $1345 ; (Ptr_Glob + 0)
+0fa9 : 85 51 __ STA T3 + 0
+0fab : ad 46 13 LDA $1346 ; (Ptr_Glob + 1)
+0fae : 85 52 __ STA T3 + 1
+0fb0 : a0 00 __ LDY #$00
+0fb2 : b1 51 __ LDA (T3 + 0),y
+0fb4 : 91 53 __ STA (T4 + 0),y
+0fb6 : c8 __ __ INY
+0fb7 : b1 51 __ LDA (T3 + 0),y
+0fb9 : 91 53 __ STA (T4 + 0),y
+0fbb : a0 04 __ LDY #$04
+0fbd : b1 53 __ LDA (T4 + 0),y
+0fbf : 85 0d __ STA P0
+0fc1 : c8 __ __ INY
+0fc2 : b1 53 __ LDA (T4 + 0),y
+0fc4 : 85 0e __ STA P1
+0fc6 : a9 0a __ LDA #$0a
+0fc8 : 85 0f __ STA P2
+0fca : a9 00 __ LDA #$00
+0fcc : 85 10 __ STA P3
+0fce : 18 __ __ CLC
+0fcf : a5 53 __ LDA T4 + 0
+0fd1 : 69 04 __ ADC #$04
+0fd3 : 85 11 __ STA P4
+0fd5 : a5 54 __ LDA T4 + 1
+0fd7 : 69 00 __ ADC #$00
+0fd9 : 85 12 __ STA P5
+0fdb : 20 c6 10 JSR $10c6 ; (Proc_7 + 0)
+0fde : a9 41 __ LDA #$41
+0fe0 : 85 57 __ STA T6 + 0
+0fe2 : ad d1 26 LDA $26d1 ; (Ch_2_Glob + 0)
+0fe5 : c9 41 __ CMP #$41
+0fe7 : b0 03 __ BCS $0fec
+0fe9 : 4c 15 0d JMP $0d15 ; (main + 1045)
+0fec : 4c f2 0c JMP $0cf2 ; (main + 1010)
+0fef : 18 __ __ CLC
+0ff0 : a5 55 __ LDA T5 + 0
+0ff2 : 69 07 __ ADC #$07
+0ff4 : 8d d2 26 STA $26d2 ; (Int_Glob + 0)
+0ff7 : a5 56 __ LDA T5 + 1
+0ff9 : 69 00 __ ADC #$00
+0ffb : 8d d3 26 STA $26d3 ; (Int_Glob + 1)
+0ffe : a9 00 __ LDA #$00
+1000 : 4c 5b 0a JMP $0a5b ; (main + 347)
+1003 : e6 55 __ INC T5 + 0
+1005 : d0 02 __ BNE $1009
+1007 : e6 56 __ INC T5 + 1
+1009 : a5 56 __ LDA T5 + 1
+100b : 10 03 __ BPL $1010
+100d : 4c 00 0a JMP $0a00 ; (main + 256)
+1010 : f0 03 __ BEQ $1015
+1012 : 4c 3b 0a JMP $0a3b ; (main + 315)
+1015 : a9 02 __ LDA #$02
+1017 : c5 55 __ CMP T5 + 0
+1019 : b0 03 __ BCS $101e
+101b : 4c 3b 0a JMP $0a3b ; (main + 315)
+101e : 4c 00 0a JMP $0a00 ; (main + 256)
+--------------------------------------------------------------------
+Func_1:
+107e : a5 0d __ LDA P0
+1080 : c5 0e __ CMP P1
+1082 : f0 07 __ BEQ $108b
+1084 : a9 00 __ LDA #$00
+1086 : 85 1b __ STA ACCU + 0
+1088 : 85 1c __ STA ACCU + 1
+108a : 60 __ __ RTS
+108b : 8d cf 26 STA $26cf ; (Ch_1_Glob + 0)
+108e : a9 01 __ LDA #$01
+1090 : 85 1b __ STA ACCU + 0
+1092 : a9 00 __ LDA #$00
+1094 : 4c 88 10 JMP $1088 ; (Func_1 + 10)
+--------------------------------------------------------------------
+strcmp:
+1097 : a0 00 __ LDY #$00
+1099 : 84 1c __ STY ACCU + 1
+109b : b1 0d __ LDA (P0),y
+109d : f0 16 __ BEQ $10b5
+109f : d1 0f __ CMP (P2),y
+10a1 : d0 16 __ BNE $10b9
+10a3 : c8 __ __ INY
+10a4 : b1 0d __ LDA (P0),y
+10a6 : f0 0d __ BEQ $10b5
+10a8 : d1 0f __ CMP (P2),y
+10aa : d0 0d __ BNE $10b9
+10ac : c8 __ __ INY
+10ad : d0 ec __ BNE $109b
+10af : e6 0e __ INC P1
+10b1 : e6 10 __ INC P3
+10b3 : d0 e6 __ BNE $109b
+10b5 : d1 0f __ CMP (P2),y
+10b7 : f0 0a __ BEQ $10c3
+10b9 : b0 06 __ BCS $10c1
+10bb : a9 ff __ LDA #$ff
+10bd : 85 1c __ STA ACCU + 1
+10bf : 30 02 __ BMI $10c3
+10c1 : a9 01 __ LDA #$01
+10c3 : 85 1b __ STA ACCU + 0
+10c5 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+10c6 : 18 __ __ CLC
+10c7 : a5 0d __ LDA P0
+10c9 : 69 02 __ ADC #$02
+10cb : 85 43 __ STA T0 + 0
+10cd : a5 0e __ LDA P1
+10cf : 69 00 __ ADC #$00
+10d1 : 85 44 __ STA T0 + 1
+10d3 : 18 __ __ CLC
+10d4 : a5 0f __ LDA P2
+10d6 : 65 43 __ ADC T0 + 0
+10d8 : a0 00 __ LDY #$00
+10da : 91 11 __ STA (P4),y
+10dc : a5 10 __ LDA P3
+10de : 65 44 __ ADC T0 + 1
+10e0 : c8 __ __ INY
+10e1 : 91 11 __ STA (P4),y
+10e3 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_3:
+10e4 : ad 45 13 LDA $1345 ; (Ptr_Glob + 0)
+10e7 : 85 43 __ STA T0 + 0
+10e9 : ad 46 13 LDA $1346 ; (Ptr_Glob + 1)
+10ec : 85 44 __ STA T0 + 1
+10ee : a5 43 __ LDA T0 + 0
+10f0 : 0d 46 13 ORA $1346 ; (Ptr_Glob + 1)
+10f3 : f0 1e __ BEQ $1113
+10f5 : a0 00 __ LDY #$00
+10f7 : b1 43 __ LDA (T0 + 0),y
+10f9 : aa __ __ TAX
+10fa : c8 __ __ INY
+10fb : b1 43 __ LDA (T0 + 0),y
+10fd : 85 46 __ STA T1 + 1
+10ff : c8 __ __ INY
+1100 : b1 23 __ LDA (SP + 0),y
+1102 : 85 47 __ STA T2 + 0
+1104 : c8 __ __ INY
+1105 : b1 23 __ LDA (SP + 0),y
+1107 : 85 48 __ STA T2 + 1
+1109 : 8a __ __ TXA
+110a : a0 00 __ LDY #$00
+110c : 91 47 __ STA (T2 + 0),y
+110e : a5 46 __ LDA T1 + 1
+1110 : c8 __ __ INY
+1111 : 91 47 __ STA (T2 + 0),y
+1113 : a9 0a __ LDA #$0a
+1115 : 85 0d __ STA P0
+1117 : a9 00 __ LDA #$00
+1119 : 85 0e __ STA P1
+111b : ad d2 26 LDA $26d2 ; (Int_Glob + 0)
+111e : 85 0f __ STA P2
+1120 : ad d3 26 LDA $26d3 ; (Int_Glob + 1)
+1123 : 85 10 __ STA P3
+1125 : 18 __ __ CLC
+1126 : a5 43 __ LDA T0 + 0
+1128 : 69 04 __ ADC #$04
+112a : 85 11 __ STA P4
+112c : a5 44 __ LDA T0 + 1
+112e : 69 00 __ ADC #$00
+1130 : 85 12 __ STA P5
+1132 : 20 c6 10 JSR $10c6 ; (Proc_7 + 0)
+1135 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_6:
+1136 : a6 0d __ LDX P0
+1138 : 8a __ __ TXA
+1139 : a0 00 __ LDY #$00
+113b : 91 0e __ STA (P1),y
+113d : c9 02 __ CMP #$02
+113f : f0 45 __ BEQ $1186
+1141 : a9 03 __ LDA #$03
+1143 : 91 0e __ STA (P1),y
+1145 : 8a __ __ TXA
+1146 : e0 03 __ CPX #$03
+1148 : f0 0c __ BEQ $1156
+114a : c9 03 __ CMP #$03
+114c : 90 09 __ BCC $1157
+114e : c9 04 __ CMP #$04
+1150 : d0 04 __ BNE $1156
+1152 : a9 02 __ LDA #$02
+1154 : 91 0e __ STA (P1),y
+1156 : 60 __ __ RTS
+1157 : 09 00 __ ORA #$00
+1159 : f0 24 __ BEQ $117f
+115b : c9 01 __ CMP #$01
+115d : f0 0b __ BEQ $116a
+115f : c9 02 __ CMP #$02
+1161 : d0 f3 __ BNE $1156
+1163 : a9 01 __ LDA #$01
+1165 : 91 0e __ STA (P1),y
+1167 : 4c 56 11 JMP $1156 ; (Proc_6 + 32)
+116a : ad d3 26 LDA $26d3 ; (Int_Glob + 1)
+116d : 10 07 __ BPL $1176
+116f : a9 03 __ LDA #$03
+1171 : 91 0e __ STA (P1),y
+1173 : 4c 56 11 JMP $1156 ; (Proc_6 + 32)
+1176 : d0 07 __ BNE $117f
+1178 : a9 64 __ LDA #$64
+117a : cd d2 26 CMP $26d2 ; (Int_Glob + 0)
+117d : b0 f0 __ BCS $116f
+117f : a9 00 __ LDA #$00
+1181 : 91 0e __ STA (P1),y
+1183 : 4c 56 11 JMP $1156 ; (Proc_6 + 32)
+1186 : c9 03 __ CMP #$03
+1188 : f0 cc __ BEQ $1156
+118a : 4c 4a 11 JMP $114a ; (Proc_6 + 20)
+--------------------------------------------------------------------
+inp_exit:
+11ea : a9 4c __ LDA #$4c
+11ec : 85 54 __ STA $54
+11ee : a9 00 __ LDA #$00
+11f0 : 85 13 __ STA P6
+11f2 : a9 19 __ LDA #$19
+11f4 : 85 16 __ STA P9
+11f6 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+11f7 : a0 00 __ LDY #$00
+11f9 : 84 06 __ STY $06
+11fb : a5 03 __ LDA $03
+11fd : a6 04 __ LDX $04
+11ff : f0 1c __ BEQ $121d
+1201 : 38 __ __ SEC
+1202 : 6a __ __ ROR
+1203 : 90 0d __ BCC $1212
+1205 : aa __ __ TAX
+1206 : 18 __ __ CLC
+1207 : 98 __ __ TYA
+1208 : 65 1b __ ADC ACCU + 0
+120a : a8 __ __ TAY
+120b : a5 06 __ LDA $06
+120d : 65 1c __ ADC ACCU + 1
+120f : 85 06 __ STA $06
+1211 : 8a __ __ TXA
+1212 : 06 1b __ ASL ACCU + 0
+1214 : 26 1c __ ROL ACCU + 1
+1216 : 4a __ __ LSR
+1217 : 90 f9 __ BCC $1212
+1219 : d0 ea __ BNE $1205
+121b : a5 04 __ LDA $04
+121d : 4a __ __ LSR
+121e : 90 0d __ BCC $122d
+1220 : aa __ __ TAX
+1221 : 18 __ __ CLC
+1222 : 98 __ __ TYA
+1223 : 65 1b __ ADC ACCU + 0
+1225 : a8 __ __ TAY
+1226 : a5 06 __ LDA $06
+1228 : 65 1c __ ADC ACCU + 1
+122a : 85 06 __ STA $06
+122c : 8a __ __ TXA
+122d : 06 1b __ ASL ACCU + 0
+122f : 26 1c __ ROL ACCU + 1
+1231 : 4a __ __ LSR
+1232 : b0 ec __ BCS $1220
+1234 : d0 f7 __ BNE $122d
+1236 : 84 05 __ STY $05
+1238 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1239 : 24 1c __ BIT ACCU + 1
+123b : 10 0d __ BPL $124a
+123d : 20 57 12 JSR $1257 ; (negaccu + 0)
+1240 : 24 04 __ BIT $04
+1242 : 10 0d __ BPL $1251
+1244 : 20 65 12 JSR $1265 ; (negtmp + 0)
+1247 : 4c 73 12 JMP $1273 ; (divmod + 0)
+124a : 24 04 __ BIT $04
+124c : 10 f9 __ BPL $1247
+124e : 20 65 12 JSR $1265 ; (negtmp + 0)
+1251 : 20 73 12 JSR $1273 ; (divmod + 0)
+1254 : 4c 57 12 JMP $1257 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1257 : 38 __ __ SEC
+1258 : a9 00 __ LDA #$00
+125a : e5 1b __ SBC ACCU + 0
+125c : 85 1b __ STA ACCU + 0
+125e : a9 00 __ LDA #$00
+1260 : e5 1c __ SBC ACCU + 1
+1262 : 85 1c __ STA ACCU + 1
+1264 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1265 : 38 __ __ SEC
+1266 : a9 00 __ LDA #$00
+1268 : e5 03 __ SBC $03
+126a : 85 03 __ STA $03
+126c : a9 00 __ LDA #$00
+126e : e5 04 __ SBC $04
+1270 : 85 04 __ STA $04
+1272 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1273 : a5 1c __ LDA ACCU + 1
+1275 : d0 31 __ BNE $12a8
+1277 : a5 04 __ LDA $04
+1279 : d0 1e __ BNE $1299
+127b : 85 06 __ STA $06
+127d : a2 04 __ LDX #$04
+127f : 06 1b __ ASL ACCU + 0
+1281 : 2a __ __ ROL
+1282 : c5 03 __ CMP $03
+1284 : 90 02 __ BCC $1288
+1286 : e5 03 __ SBC $03
+1288 : 26 1b __ ROL ACCU + 0
+128a : 2a __ __ ROL
+128b : c5 03 __ CMP $03
+128d : 90 02 __ BCC $1291
+128f : e5 03 __ SBC $03
+1291 : 26 1b __ ROL ACCU + 0
+1293 : ca __ __ DEX
+1294 : d0 eb __ BNE $1281
+1296 : 85 05 __ STA $05
+1298 : 60 __ __ RTS
+1299 : a5 1b __ LDA ACCU + 0
+129b : 85 05 __ STA $05
+129d : a5 1c __ LDA ACCU + 1
+129f : 85 06 __ STA $06
+12a1 : a9 00 __ LDA #$00
+12a3 : 85 1b __ STA ACCU + 0
+12a5 : 85 1c __ STA ACCU + 1
+12a7 : 60 __ __ RTS
+12a8 : a5 04 __ LDA $04
+12aa : d0 1f __ BNE $12cb
+12ac : a5 03 __ LDA $03
+12ae : 30 1b __ BMI $12cb
+12b0 : a9 00 __ LDA #$00
+12b2 : 85 06 __ STA $06
+12b4 : a2 10 __ LDX #$10
+12b6 : 06 1b __ ASL ACCU + 0
+12b8 : 26 1c __ ROL ACCU + 1
+12ba : 2a __ __ ROL
+12bb : c5 03 __ CMP $03
+12bd : 90 02 __ BCC $12c1
+12bf : e5 03 __ SBC $03
+12c1 : 26 1b __ ROL ACCU + 0
+12c3 : 26 1c __ ROL ACCU + 1
+12c5 : ca __ __ DEX
+12c6 : d0 f2 __ BNE $12ba
+12c8 : 85 05 __ STA $05
+12ca : 60 __ __ RTS
+12cb : a9 00 __ LDA #$00
+12cd : 85 05 __ STA $05
+12cf : 85 06 __ STA $06
+12d1 : 84 02 __ STY $02
+12d3 : a0 10 __ LDY #$10
+12d5 : 18 __ __ CLC
+12d6 : 26 1b __ ROL ACCU + 0
+12d8 : 26 1c __ ROL ACCU + 1
+12da : 26 05 __ ROL $05
+12dc : 26 06 __ ROL $06
+12de : 38 __ __ SEC
+12df : a5 05 __ LDA $05
+12e1 : e5 03 __ SBC $03
+12e3 : aa __ __ TAX
+12e4 : a5 06 __ LDA $06
+12e6 : e5 04 __ SBC $04
+12e8 : 90 04 __ BCC $12ee
+12ea : 86 05 __ STX $05
+12ec : 85 06 __ STA $06
+12ee : 88 __ __ DEY
+12ef : d0 e5 __ BNE $12d6
+12f1 : 26 1b __ ROL ACCU + 0
+12f3 : 26 1c __ ROL ACCU + 1
+12f5 : a4 02 __ LDY $02
+12f7 : 60 __ __ RTS
@@ -0,0 +1,263 @@
+// Dhrystone 2.1 with statically allocated records
+
+#include <string.h>
+
+#define NUMBER_OF_RUNS	500
+
+typedef enum {Ident_1, Ident_2, Ident_3, Ident_4, Ident_5} Enumeration;
+
+typedef int		One_Thirty;
+typedef int		One_Fifty;
+typedef char	Capital_Letter;
+typedef char	Str_30[31];
+typedef int		Arr_1_Dim[50];
+typedef int		Arr_2_Dim[50][50];
+
+typedef struct record
+{
+	struct record	*	Ptr_Comp;
+	Enumeration			Discr;
+	Enumeration			Enum_Comp;
+	int					Int_Comp;
+	Str_30				Str_Comp;
+}	Rec_Type, * Rec_Pointer;
+
+Rec_Type		Glob_Rec, Next_Glob_Rec;
+Rec_Pointer		Ptr_Glob, Next_Ptr_Glob;
+int				Int_Glob;
+bool			Bool_Glob;
+char			Ch_1_Glob, Ch_2_Glob;
+Arr_1_Dim		Arr_1_Glob;
+Arr_2_Dim		Arr_2_Glob;
+
+bool Func_3(Enumeration Enum_Par_Val)
+{
+	return Enum_Par_Val == Ident_3;
+}
+
+void Proc_6(Enumeration Enum_Val_Par, Enumeration * Enum_Ref_Par)
+{
+	*Enum_Ref_Par = Enum_Val_Par;
+	if (!Func_3(Enum_Val_Par))
+		*Enum_Ref_Par = Ident_4;
+
+	switch (Enum_Val_Par)
+	{
+	case Ident_1:
+		*Enum_Ref_Par = Ident_1;
+		break;
+	case Ident_2:
+		if (Int_Glob > 100)
+			*Enum_Ref_Par = Ident_1;
+		else
+			*Enum_Ref_Par = Ident_4;
+		break;
+	case Ident_3:
+		*Enum_Ref_Par = Ident_2;
+		break;
+	case Ident_4:
+		break;
+	case Ident_5:
+		*Enum_Ref_Par = Ident_3;
+		break;
+	}
+}
+
+void Proc_7(One_Fifty Int_1_Par_Val, One_Fifty Int_2_Par_Val, One_Fifty * Int_Par_Ref)
+{
+	One_Fifty Int_Loc = Int_1_Par_Val + 2;
+	*Int_Par_Ref = Int_2_Par_Val + Int_Loc;
+}
+
+void Proc_8(int * Arr_1_Par_Ref, int * Arr_2_Par_Ref, int Int_1_Par_Val, int Int_2_Par_Val)
+{
+	One_Fifty	Int_Index, Int_Loc;
+
+	Int_Loc = Int_1_Par_Val + 5;
+	Arr_1_Par_Ref[Int_Loc] = Int_2_Par_Val;
+	Arr_1_Par_Ref[Int_Loc + 1] = Arr_1_Par_Ref[Int_Loc];
+	Arr_1_Par_Ref[Int_Loc + 30] = Int_Loc;
+	for (Int_Index = Int_Loc; Int_Index <= Int_Loc + 1; ++Int_Index)
+		Arr_2_Par_Ref[Int_Loc * 50 + Int_Index] = Int_Loc;
+	Arr_2_Par_Ref[Int_Loc * 50 + Int_Loc - 1] += 1;
+	Arr_2_Par_Ref[(Int_Loc + 20) * 50 + Int_Loc] = Arr_1_Par_Ref[Int_Loc];
+	Int_Glob = 5;
+}
+
+Enumeration Func_1(Capital_Letter Ch_1_Par_Val, Capital_Letter Ch_2_Par_Val)
+{
+	Capital_Letter	Ch_1_Loc = Ch_1_Par_Val;
+	Capital_Letter	Ch_2_Loc = Ch_1_Loc;
+
+	if (Ch_2_Loc != Ch_2_Par_Val)
+		return Ident_1;
+	else
+	{
+		Ch_1_Glob = Ch_1_Loc;
+		return Ident_2;
+	}
+}
+
+bool Func_2(const char * Str_1_Par_Ref, const char * Str_2_Par_Ref)
+{
+	One_Thirty		Int_Loc = 2;
+	Capital_Letter	Ch_Loc = 'A';
+
+	while (Int_Loc <= 2)
+	{
+		if (Func_1(Str_1_Par_Ref[Int_Loc], Str_2_Par_Ref[Int_Loc + 1]) == Ident_1)
+		{
+			Ch_Loc = 'A';
+			Int_Loc += 1;
+		}
+	}
+
+	if (Ch_Loc >= 'W' && Ch_Loc < 'Z')
+		Int_Loc = 7;
+
+	if (Ch_Loc == 'R')
+		return true;
+	else
+	{
+		if (strcmp(Str_1_Par_Ref, Str_2_Par_Ref) > 0)
+		{
+			Int_Loc += 7;
+			Int_Glob = Int_Loc;
+			return true;
+		}
+		else
+			return false;
+	}
+}
+
+void Proc_3(Rec_Pointer * Ptr_Ref_Par)
+{
+	if (Ptr_Glob)
+		*Ptr_Ref_Par = Ptr_Glob->Ptr_Comp;
+	Proc_7(10, Int_Glob, &Ptr_Glob->Int_Comp);
+}
+
+void Proc_1(Rec_Pointer Ptr_Val_Par)
+{
+	Rec_Pointer	Next_Record = Ptr_Val_Par->Ptr_Comp;
+
+	*Ptr_Val_Par->Ptr_Comp = *Ptr_Glob;
+	Ptr_Val_Par->Int_Comp = 5;
+	Next_Record->Int_Comp = Ptr_Val_Par->Int_Comp;
+	Next_Record->Ptr_Comp = Ptr_Val_Par->Ptr_Comp;
+	Proc_3(&Next_Record->Ptr_Comp);
+
+	if (Next_Record->Discr == Ident_1)
+	{
+		Next_Record->Int_Comp = 6;
+		Proc_6(Ptr_Val_Par->Enum_Comp, &Next_Record->Enum_Comp);
+		Next_Record->Ptr_Comp = Ptr_Glob->Ptr_Comp;
+		Proc_7(Next_Record->Int_Comp, 10, &Next_Record->Int_Comp);
+	}
+	else
+		*Ptr_Val_Par = *Ptr_Val_Par->Ptr_Comp;
+}
+
+void Proc_2(One_Fifty * Int_Par_Ref)
+{
+	One_Fifty	Int_Loc = *Int_Par_Ref + 10;
+	Enumeration	Enum_Loc = Ident_2;
+
+	do
+	{
+		if (Ch_1_Glob == 'A')
+		{
+			Int_Loc -= 1;
+			*Int_Par_Ref = Int_Loc - Int_Glob;
+			Enum_Loc = Ident_1;
+		}
+	} while (Enum_Loc != Ident_1);
+}
+
+void Proc_4(void)
+{
+	bool	Bool_Loc = Ch_1_Glob == 'A';
+	Bool_Glob = Bool_Loc | Bool_Glob;
+	Ch_2_Glob = 'B';
+}
+
+void Proc_5(void)
+{
+	Ch_1_Glob = 'A';
+	Bool_Glob = false;
+}
+
+int main(void)
+{
+	One_Fifty		Int_1_Loc, Int_2_Loc, Int_3_Loc;
+	char			Ch_Index;
+	Enumeration		Enum_Loc;
+	Str_30			Str_1_Loc, Str_2_Loc;
+
+	Next_Ptr_Glob = &Next_Glob_Rec;
+	Ptr_Glob = &Glob_Rec;
+
+	Ptr_Glob->Ptr_Comp = Next_Ptr_Glob;
+	Ptr_Glob->Discr = Ident_1;
+	Ptr_Glob->Enum_Comp = Ident_3;
+	Ptr_Glob->Int_Comp = 40;
+	strcpy(Ptr_Glob->Str_Comp, "DHRYSTONE PROGRAM, SOME STRING");
+	strcpy(Str_1_Loc, "DHRYSTONE PROGRAM, 1'ST STRING");
+
+	Arr_2_Glob[8][7] = 10;
+
+	for (int Run_Index = 1; Run_Index <= NUMBER_OF_RUNS; ++Run_Index)
+	{
+		Proc_5();
+		Proc_4();
+
+		Int_1_Loc = 2;
+		Int_2_Loc = 3;
+		strcpy(Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING");
+		Enum_Loc = Ident_2;
+		Bool_Glob = !Func_2(Str_1_Loc, Str_2_Loc);
+
+		while (Int_1_Loc < Int_2_Loc)
+		{
+			Int_3_Loc = 5 * Int_1_Loc - Int_2_Loc;
+			Proc_7(Int_1_Loc, Int_2_Loc, &Int_3_Loc);
+			Int_1_Loc += 1;
+		}
+
+		Proc_8(Arr_1_Glob, &Arr_2_Glob[0][0], Int_1_Loc, Int_3_Loc);
+		Proc_1(Ptr_Glob);
+
+		for (Ch_Index = 'A'; Ch_Index <= Ch_2_Glob; ++Ch_Index)
+		{
+			if (Enum_Loc == Func_1(Ch_Index, 'C'))
+			{
+				Proc_6(Ident_1, &Enum_Loc);
+				strcpy(Str_2_Loc, "DHRYSTONE PROGRAM, 3'RD STRING");
+				Int_2_Loc = Run_Index;
+				Int_Glob = Run_Index;
+			}
+		}
+
+		Int_2_Loc = Int_2_Loc * Int_1_Loc;
+		Int_1_Loc = Int_2_Loc / Int_3_Loc;
+		Int_2_Loc = 7 * (Int_2_Loc - Int_3_Loc) - Int_1_Loc;
+		Proc_2(&Int_1_Loc);
+	}
+
+	// Check the final state against the reference values
+
+	if (Int_Glob != 5 || !Bool_Glob || Ch_1_Glob != 'A' || Ch_2_Glob != 'B')
+		return 1;
+	if (Arr_1_Glob[8] != 7 || Arr_2_Glob[8][7] != NUMBER_OF_RUNS + 10)
+		return 2;
+	if (Ptr_Glob->Discr != Ident_1 || Ptr_Glob->Enum_Comp != Ident_3 || Ptr_Glob->Int_Comp != 17)
+		return 3;
+	if (Next_Ptr_Glob->Discr != Ident_1 || Next_Ptr_Glob->Enum_Comp != Ident_2 || Next_Ptr_Glob->Int_Comp != 18)
+		return 4;
+	if (Int_1_Loc != 5 || Int_2_Loc != 13 || Int_3_Loc != 7 || Enum_Loc != Ident_2)
+		return 5;
+	if (strcmp(Ptr_Glob->Str_Comp, "DHRYSTONE PROGRAM, SOME STRING") || strcmp(Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING"))
+		return 6;
+
+	return 0;
+}
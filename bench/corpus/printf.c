@@ -0,0 +1,31 @@
+// Formatted output kernel: integer, string and float conversions
+
+#include <stdio.h>
+#include <string.h>
+
+char	buffer[100];
+
+int main(void)
+{
+	unsigned	sum = 0;
+
+	for (int i = 0; i < 100; i++)
+	{
+		sprintf(buffer, "%d %u %x %5d|%-5d|%s", i * 331 - 16000, i * 617, i * 97, i, -i, "abc");
+		sum += strlen(buffer);
+		for (int j = 0; buffer[j]; j++)
+			sum += buffer[j];
+	}
+
+	for (int i = 0; i < 20; i++)
+	{
+		sprintf(buffer, "%f %8.3f", i * 1.25, i * -0.0625);
+		sum += strlen(buffer);
+	}
+
+	sprintf(buffer, "%d %s %x", -123, "xyz", 0xbeef);
+	if (strcmp(buffer, "-123 xyz BEEF"))
+		return 1;
+
+	return sum == 0;
+}
@@ -0,0 +1,68 @@
+// String handling kernel: copy, concatenate, compare and scan
+
+#include <string.h>
+
+char	buffer[256], words[16][16];
+
+static const char * text[] = {
+	"the", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog",
+	"pack", "my", "box", "with", "five", "dozen", "liquor", "jugs"
+};
+
+int count(const char * s, char c)
+{
+	int	n = 0;
+	while (*s)
+	{
+		if (*s == c)
+			n++;
+		s++;
+	}
+	return n;
+}
+
+void sort(int n)
+{
+	for (int i = 1; i < n; i++)
+	{
+		char	t[16];
+		strcpy(t, words[i]);
+		int	j = i;
+		while (j > 0 && strcmp(words[j - 1], t) > 0)
+		{
+			strcpy(words[j], words[j - 1]);
+			j--;
+		}
+		strcpy(words[j], t);
+	}
+}
+
+int main(void)
+{
+	int	total = 0;
+
+	for (int k = 0; k < 20; k++)
+	{
+		buffer[0] = 0;
+		for (int i = 0; i < 17; i++)
+		{
+			strcat(buffer, text[i]);
+			strcat(buffer, " ");
+		}
+		total += strlen(buffer);
+		total += count(buffer, 'o');
+
+		for (int i = 0; i < 16; i++)
+			strcpy(words[i], text[(i * 5 + k) % 17]);
+		sort(16);
+
+		for (int i = 1; i < 16; i++)
+			if (strcmp(words[i - 1], words[i]) > 0)
+				return 1;
+	}
+
+	if (total != 20 * (84 + 7))
+		return 2;
+
+	return 0;
+}
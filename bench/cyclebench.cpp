@@ -0,0 +1,326 @@
+// Cycles, code size and compile time of a benchmark corpus at all
+// optimization levels in byte code and native mode
+//
+// usage: cyclebench [-c=compiler] [-i=include] [-w=workdir] [-csv=file] [-json=file]
+//                   [-b=baseline.csv] [-t=tolerance%] source.c ...
+//
+// Every program is compiled once to measure the compile time and once more
+// with -e to run it in the emulator.  A program has to return zero.  With a
+// baseline any cycle or size increase beyond the tolerance is a regression
+// and the exit code is one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <sys/stat.h>
+
+struct Config
+{
+	const char	*	mMode, * mOpt, * mFlags;
+};
+
+static const Config Configs[] = {
+	{ "bytecode", "O0", "-O0" },
+	{ "bytecode", "O1", "-O1" },
+	{ "bytecode", "O2", "-O2" },
+	{ "bytecode", "O3", "-O3" },
+	{ "bytecode", "Os", "-Os" },
+	{ "native",   "O0", "-O0 -n" },
+	{ "native",   "O1", "-O1 -n" },
+	{ "native",   "O2", "-O2 -n" },
+	{ "native",   "O3", "-O3 -n" },
+	{ "native",   "Os", "-Os -n" }
+};
+
+static const int NumConfigs = sizeof(Configs) / sizeof(Configs[0]);
+
+struct Result
+{
+	std::string	mBenchmark, mMode, mOpt, mStatus;
+	long long	mCycles;
+	int			mSize;
+	double		mCompileMS;
+};
+
+static double Seconds(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string BaseName(const char* path)
+{
+	const char* p = strrchr(path, '/');
+	std::string	name(p ? p + 1 : path);
+	size_t	dot = name.rfind('.');
+	if (dot != std::string::npos)
+		name.resize(dot);
+	return name;
+}
+
+static bool Run(const std::string& cmd, long long& cycles, int& ecode)
+{
+	FILE* pipe = popen((cmd + " 2>&1").c_str(), "r");
+	if (!pipe)
+		return false;
+
+	char	line[512];
+	while (fgets(line, sizeof(line), pipe))
+	{
+		long long	c;
+		int			e;
+		if (sscanf(line, "Total Cycles %lld", &c) == 1)
+			cycles = c;
+		else if (sscanf(line, "Emulation result %d", &e) == 1)
+			ecode = e;
+	}
+
+	return pclose(pipe) == 0;
+}
+
+static void Measure(Result& r, const char* compiler, const char* include, const char* workdir, const char* source, const Config& config)
+{
+	std::string	prg = std::string(workdir) + "/" + r.mBenchmark + "_" + r.mMode + "_" + r.mOpt + ".prg";
+	std::string	args = std::string(config.mFlags) + " -i=\"" + include + "\" -o=\"" + prg + "\" \"" + source + "\"";
+
+	r.mCycles = 0;
+	r.mSize = 0;
+
+	long long	cycles = 0;
+	int			ecode = -1;
+
+	double	start = Seconds();
+	bool	ok = Run(std::string("\"") + compiler + "\" " + args, cycles, ecode);
+	r.mCompileMS = (Seconds() - start) * 1000.0;
+
+	struct stat	st;
+	if (!ok || stat(prg.c_str(), &st) != 0)
+	{
+		r.mStatus = "compile";
+		return;
+	}
+
+	// Two bytes of load address precede the program
+
+	r.mSize = int(st.st_size) - 2;
+
+	if (!Run(std::string("\"") + compiler + "\" -e " + args, cycles, ecode))
+	{
+		r.mStatus = ecode > 0 ? "result" : "emulate";
+		return;
+	}
+
+	r.mCycles = cycles;
+	r.mStatus = "ok";
+}
+
+static bool ReadBaseline(const char* filename, std::vector<Result>& baseline)
+{
+	FILE* file = fopen(filename, "r");
+	if (!file)
+		return false;
+
+	char	line[512];
+	while (fgets(line, sizeof(line), file))
+	{
+		char		name[128], mode[16], opt[16], status[16];
+		long long	cycles;
+		int			size;
+		double		ms;
+
+		if (sscanf(line, "%127[^,],%15[^,],%15[^,],%lld,%d,%lf,%15s", name, mode, opt, &cycles, &size, &ms, status) == 7)
+		{
+			Result	r;
+			r.mBenchmark = name;
+			r.mMode = mode;
+			r.mOpt = opt;
+			r.mCycles = cycles;
+			r.mSize = size;
+			r.mCompileMS = ms;
+			r.mStatus = status;
+			baseline.push_back(r);
+		}
+	}
+
+	fclose(file);
+	return true;
+}
+
+static const Result* FindResult(const std::vector<Result>& results, const Result& r)
+{
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		if (results[i].mBenchmark == r.mBenchmark && results[i].mMode == r.mMode && results[i].mOpt == r.mOpt)
+			return &results[i];
+	}
+	return nullptr;
+}
+
+static double Percent(double now, double before)
+{
+	return before > 0 ? (now - before) * 100.0 / before : 0.0;
+}
+
+static void WriteCSV(FILE* file, const std::vector<Result>& results)
+{
+	fprintf(file, "benchmark,mode,opt,cycles,size,compile_ms,status\n");
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& r(results[i]);
+		fprintf(file, "%s,%s,%s,%lld,%d,%.1f,%s\n", r.mBenchmark.c_str(), r.mMode.c_str(), r.mOpt.c_str(), r.mCycles, r.mSize, r.mCompileMS, r.mStatus.c_str());
+	}
+}
+
+static void WriteJSON(FILE* file, const std::vector<Result>& results, const std::vector<Result>& baseline)
+{
+	fprintf(file, "[\n");
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& r(results[i]);
+		fprintf(file, "  {\"benchmark\": \"%s\", \"mode\": \"%s\", \"opt\": \"%s\", \"cycles\": %lld, \"size\": %d, \"compile_ms\": %.1f, \"status\": \"%s\"",
+			r.mBenchmark.c_str(), r.mMode.c_str(), r.mOpt.c_str(), r.mCycles, r.mSize, r.mCompileMS, r.mStatus.c_str());
+
+		const Result* b = FindResult(baseline, r);
+		if (b)
+			fprintf(file, ", \"baseline\": {\"cycles\": %lld, \"size\": %d, \"compile_ms\": %.1f}", b->mCycles, b->mSize, b->mCompileMS);
+
+		fprintf(file, "}%s\n", i + 1 < results.size() ? "," : "");
+	}
+	fprintf(file, "]\n");
+}
+
+int main(int argc, const char** argv)
+{
+	const char	*	compiler = "../bin/oscar64", * include = "../include", * workdir = "cyclebench";
+	const char	*	csvPath = nullptr, * jsonPath = nullptr, * baselinePath = nullptr;
+	double			tolerance = 0.0;
+
+	std::vector<const char*>	sources;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (!strncmp(arg, "-c=", 3))
+			compiler = arg + 3;
+		else if (!strncmp(arg, "-i=", 3))
+			include = arg + 3;
+		else if (!strncmp(arg, "-w=", 3))
+			workdir = arg + 3;
+		else if (!strncmp(arg, "-csv=", 5))
+			csvPath = arg + 5;
+		else if (!strncmp(arg, "-json=", 6))
+			jsonPath = arg + 6;
+		else if (!strncmp(arg, "-b=", 3))
+			baselinePath = arg + 3;
+		else if (!strncmp(arg, "-t=", 3))
+			tolerance = atof(arg + 3);
+		else if (arg[0] == '-')
+		{
+			printf("Invalid option <%s>\n", arg);
+			return 20;
+		}
+		else
+			sources.push_back(arg);
+	}
+
+	if (sources.size() == 0)
+	{
+		printf("cyclebench [-c=compiler] [-i=include] [-w=workdir] [-csv=file] [-json=file] [-b=baseline.csv] [-t=tolerance%%] source.c ...\n");
+		return 20;
+	}
+
+	std::vector<Result>	baseline;
+	if (baselinePath && !ReadBaseline(baselinePath, baseline))
+	{
+		printf("Could not read baseline <%s>\n", baselinePath);
+		return 20;
+	}
+
+	mkdir(workdir, 0777);
+
+	std::vector<Result>	results;
+	int		failed = 0, regressed = 0, improved = 0;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		for (int j = 0; j < NumConfigs; j++)
+		{
+			Result	r;
+			r.mBenchmark = BaseName(sources[i]);
+			r.mMode = Configs[j].mMode;
+			r.mOpt = Configs[j].mOpt;
+
+			Measure(r, compiler, include, workdir, sources[i], Configs[j]);
+			results.push_back(r);
+
+			printf("%-16s %-8s %s %10lld cycles %6d bytes %7.1f ms", r.mBenchmark.c_str(), r.mMode.c_str(), r.mOpt.c_str(), r.mCycles, r.mSize, r.mCompileMS);
+
+			if (r.mStatus != "ok")
+			{
+				printf("  FAILED (%s)", r.mStatus.c_str());
+				failed++;
+			}
+			else if (const Result* b = FindResult(baseline, r))
+			{
+				double	dc = Percent(double(r.mCycles), double(b->mCycles)), ds = Percent(r.mSize, b->mSize);
+
+				printf("  %+6.2f%% cycles %+6.2f%% bytes", dc, ds);
+				if (dc > tolerance || ds > tolerance)
+				{
+					printf("  REGRESSION");
+					regressed++;
+				}
+				else if (r.mCycles < b->mCycles || r.mSize < b->mSize)
+					improved++;
+			}
+			printf("\n");
+		}
+	}
+
+	if (csvPath)
+	{
+		FILE* file = fopen(csvPath, "w");
+		if (!file)
+		{
+			printf("Could not write <%s>\n", csvPath);
+			return 20;
+		}
+		WriteCSV(file, results);
+		fclose(file);
+	}
+
+	if (jsonPath)
+	{
+		FILE* file = fopen(jsonPath, "w");
+		if (!file)
+		{
+			printf("Could not write <%s>\n", jsonPath);
+			return 20;
+		}
+		WriteJSON(file, results, baseline);
+		fclose(file);
+	}
+
+	long long	tcycles = 0, bcycles = 0;
+	int			tsize = 0, bsize = 0;
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result* b = FindResult(baseline, results[i]);
+		if (b && results[i].mStatus == "ok")
+		{
+			tcycles += results[i].mCycles;
+			tsize += results[i].mSize;
+			bcycles += b->mCycles;
+			bsize += b->mSize;
+		}
+	}
+
+	printf("%d runs, %d failed", int(results.size()), failed);
+	if (baselinePath)
+		printf(", %d regressed, %d improved, total %+.2f%% cycles %+.2f%% bytes", regressed, improved, Percent(double(tcycles), double(bcycles)), Percent(tsize, bsize));
+	printf("\n");
+
+	return failed || regressed ? 1 : 0;
+}
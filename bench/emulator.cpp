@@ -0,0 +1,139 @@
+// Throughput of the emulator cores in emulated MHz
+//
+// usage: emulatorbench [iterations] program.prg ...
+//
+// Each program is run with the decoding core and with the fast core with and
+// without cycle counting.  The fast core has to leave the same memory, result
+// and cycles per address as the decoding core.
+
+#include "Emulator.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static double Seconds(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint8	Program[0x10000];
+static int		ProgramStart, ProgramEnd;
+
+static bool Load(const char* filename)
+{
+	FILE* file = fopen(filename, "rb");
+	if (!file)
+		return false;
+
+	uint8	header[2];
+	bool	ok = fread(header, 1, 2, file) == 2;
+	if (ok)
+	{
+		ProgramStart = header[0] + 256 * header[1];
+		ProgramEnd = ProgramStart + int(fread(Program + ProgramStart, 1, 0x10000 - ProgramStart, file));
+	}
+
+	fclose(file);
+	return ok;
+}
+
+static Emulator* Start(void)
+{
+	Emulator* emu = new Emulator(nullptr);
+
+	memcpy(emu->mMemory + ProgramStart, Program + ProgramStart, ProgramEnd - ProgramStart);
+	emu->mMemory[0x2d] = ProgramEnd & 0xff;
+	emu->mMemory[0x2e] = ProgramEnd >> 8;
+
+	return emu;
+}
+
+// Best of several runs, the output of the program goes to stdout
+
+static double Measure(bool decode, bool cycles, int iterations, int & result, Emulator* & last)
+{
+	double	best = 0;
+
+	for (int i = 0; i < iterations; i++)
+	{
+		delete last;
+		last = Start();
+		last->mDecodeCore = decode;
+		last->mCountCycles = cycles;
+
+		double	start = Seconds();
+		result = last->Run(2061);
+		double	t = Seconds() - start;
+
+		if (i == 0 || t < best)
+			best = t;
+	}
+
+	return best;
+}
+
+int main(int argc, const char** argv)
+{
+	int	iterations = 3, first = 1;
+	if (argc > 1 && atoi(argv[1]) > 0)
+	{
+		iterations = atoi(argv[1]);
+		first = 2;
+	}
+
+	if (first >= argc)
+	{
+		printf("emulatorbench [iterations] program.prg ...\n");
+		return 20;
+	}
+
+	double	tdecode = 0, tfast = 0, tnocycles = 0;
+	long long	tcycles = 0;
+	bool	failed = false;
+
+	for (int i = first; i < argc; i++)
+	{
+		if (!Load(argv[i]))
+		{
+			printf("Could not read <%s>\n", argv[i]);
+			return 20;
+		}
+
+		Emulator	*	ref = nullptr, * fast = nullptr, * nocycles = nullptr;
+		int				rref, rfast, rnocycles;
+
+		double	sdecode = Measure(true, true, iterations, rref, ref);
+		double	sfast = Measure(false, true, iterations, rfast, fast);
+		double	snocycles = Measure(false, false, iterations, rnocycles, nocycles);
+
+		long long	cycles = 0;
+		for (int j = 0; j < 0x10000; j++)
+			cycles += ref->mCycles[j];
+
+		bool	same =
+			rref == rfast && rref == rnocycles &&
+			!memcmp(ref->mMemory, fast->mMemory, 0x10000) && !memcmp(ref->mMemory, nocycles->mMemory, 0x10000) &&
+			!memcmp(ref->mCycles, fast->mCycles, sizeof(ref->mCycles));
+
+		printf("%-32s %10lld cycles  decode %7.2f MHz  fast %7.2f MHz  fast without cycles %7.2f MHz%s\n", argv[i], cycles,
+			cycles / sdecode * 1e-6, cycles / sfast * 1e-6, cycles / snocycles * 1e-6, same ? "" : "  MISMATCH");
+
+		if (!same)
+			failed = true;
+
+		tdecode += sdecode;
+		tfast += sfast;
+		tnocycles += snocycles;
+		tcycles += cycles;
+
+		delete ref;
+		delete fast;
+		delete nocycles;
+	}
+
+	printf("%-32s %10lld cycles  decode %7.2f MHz  fast %7.2f MHz  fast without cycles %7.2f MHz\n", "total", tcycles,
+		tcycles / tdecode * 1e-6, tcycles / tfast * 1e-6, tcycles / tnocycles * 1e-6);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+// Throughput of identifier interning and of parsing an identifier heavy source
+//
+// usage: identbench [identifiers]
+//
+// The identifiers are interned once and then looked up again several times,
+// the generated source declares a global variable for each identifier and
+// uses them in a set of functions with local variables.
+
+#include "Compiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const int Lookups = 8;
+
+static double Seconds(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void IdentName(char* name, int i)
+{
+	static const char* prefixes[] = { "v", "count", "index_", "tmp", "player_position_", "sprite", "x", "buffer_ptr_" };
+	sprintf(name, "%s%d", prefixes[i % 8], i);
+}
+
+static bool WriteSource(const char* filename, int count)
+{
+	FILE* file = fopen(filename, "w");
+	if (!file)
+		return false;
+
+	char	name[64], lname[64];
+	for (int i = 0; i < count; i++)
+	{
+		IdentName(name, i);
+		fprintf(file, "int %s;\n", name);
+	}
+
+	for (int i = 0; i < count; i += 16)
+	{
+		fprintf(file, "int func%d(int a)\n{\n", i);
+		for (int j = 0; j < 16 && i + j < count; j++)
+		{
+			IdentName(name, i + j);
+			IdentName(lname, j);
+			fprintf(file, "\tint l%s = a + %s;\n\ta += l%s * %s;\n", lname, name, lname, name);
+		}
+		fprintf(file, "\treturn a;\n}\n");
+	}
+
+	fclose(file);
+	return true;
+}
+
+int main(int argc, const char** argv)
+{
+	int	count = 100000;
+	if (argc > 1 && atoi(argv[1]) > 0)
+		count = atoi(argv[1]);
+
+	InitDeclarations();
+	InitAssembler();
+
+	char	*	names = new char[count * 32];
+	for (int i = 0; i < count; i++)
+		IdentName(names + 32 * i, i);
+
+	double	start = Seconds();
+	for (int i = 0; i < count; i++)
+		Ident::Unique(names + 32 * i);
+	double	tinsert = Seconds() - start;
+
+	start = Seconds();
+	unsigned int	check = 0;
+	for (int k = 0; k < Lookups; k++)
+	{
+		for (int i = 0; i < count; i++)
+			check += Ident::Unique(names + 32 * i)->mLength;
+	}
+	double	tlookup = Seconds() - start;
+
+	delete[] names;
+
+	printf("intern %d identifiers %7.1f ns  lookup %7.1f ns (%u)\n", count, tinsert / count * 1e9, tlookup / (count * Lookups) * 1e9, check);
+
+	const char* filename = "identbench.c";
+	if (!WriteSource(filename, count))
+	{
+		printf("Could not write <%s>\n", filename);
+		return 20;
+	}
+
+	MemoryArena			arena;
+	MemoryArena::Scope	arenaScope(&arena);
+
+	Compiler* compiler = new Compiler();
+
+	Location	loc;
+	compiler->mCompilationUnits->AddUnit(loc, filename, nullptr, false);
+
+	start = Seconds();
+	bool	ok = compiler->ParseSource();
+	double	tparse = Seconds() - start;
+
+	remove(filename);
+
+	printf("parse %d identifiers %7.1f ms%s\n", count, tparse * 1e3, ok ? "" : "  FAILED");
+
+	return ok ? 0 : 1;
+}
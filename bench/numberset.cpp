@@ -0,0 +1,106 @@
+// Throughput of the NumberSet bulk operations for the available kernels
+//
+// usage: numbersetbench [iterations]
+
+#include "NumberSet.h"
+#include <chrono>
+
+static const int NumSets = 64;
+
+static double Seconds(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32 Random(uint32 & seed)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 8;
+}
+
+static uint64 Run(int size, int iterations, double & seconds)
+{
+	NumberSet	sets[NumSets];
+	uint32		seed = 31415;
+
+	for (int i = 0; i < NumSets; i++)
+	{
+		sets[i].Reset(size);
+		for (int j = 0; j < size / 4; j++)
+			sets[i] += Random(seed) % size;
+	}
+
+	NumberSet	acc(size);
+	uint64		check = 0;
+
+	double	start = Seconds();
+
+	for (int k = 0; k < iterations; k++)
+	{
+		for (int i = 0; i < NumSets; i++)
+		{
+			const NumberSet& s = sets[i];
+
+			acc |= s;
+			if (acc <= s)
+				check++;
+			acc -= sets[(i + 1) % NumSets];
+			acc &= sets[(i + 7) % NumSets];
+			acc.OrNot(sets[(i + 3) % NumSets]);
+			acc -= sets[(i + 5) % NumSets];
+		}
+	}
+
+	seconds = Seconds() - start;
+
+	for (int i = 0; i < size; i++)
+		if (acc[i])
+			check = check * 31 + i;
+
+	return check;
+}
+
+int main(int argc, const char** argv)
+{
+	int	iterations = argc > 1 ? atoi(argv[1]) : 20000;
+
+	static const int		sizes[] = { 64, 256, 261, 1024, 4096, 16384 };
+	static const char	*	names[] = { "scalar", "sse2", "avx2" };
+
+	bool	ok = true;
+
+	printf("%8s %8s %12s %10s\n", "bits", "kernel", "Mops/s", "GB/s");
+
+	for (int si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++)
+	{
+		int		size = sizes[si];
+		int		its = int(iterations * 256.0 / (size + 256));
+		if (its < 1) its = 1;
+
+		uint64	reference = 0;
+
+		for (int k = NSK_SCALAR; k <= NSK_AVX2; k++)
+		{
+			if (NumberSet::SelectKernel(NumberSetKernel(k)))
+			{
+				double	seconds;
+				uint64	check = Run(size, its, seconds);
+
+				if (k == NSK_SCALAR)
+					reference = check;
+				else if (check != reference)
+				{
+					printf("Kernel %s differs from scalar for %d bits\n", names[k], size);
+					ok = false;
+				}
+
+				double	ops = 6.0 * NumSets * its;
+				double	bytes = ops * 2 * ((size + 63) / 64) * 8;
+
+				printf("%8d %8s %12.1f %10.2f\n", size, names[k], ops / seconds * 1e-6, bytes / seconds * 1e-9);
+			}
+		}
+	}
+
+	return ok ? 0 : 20;
+}
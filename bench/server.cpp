@@ -0,0 +1,239 @@
+// Memory use and output of repeated requests to the compile server
+//
+// usage: serverbench [-c=compiler] [-i=include] [-w=workdir] [-r=requests] [-m=growth MB] source.c ...
+//
+// Each source is compiled in byte code and native mode by one server
+// process, every request is repeated several times.  All requests have to
+// succeed and produce the same program as the first one.  The resident size
+// of the server after the first round of requests is the reference, any
+// growth beyond the limit in the following rounds is a leak and the exit
+// code is one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+
+static const char* Modes[] = { "", "-n" };
+
+static const int NumModes = sizeof(Modes) / sizeof(Modes[0]);
+
+static std::string BaseName(const char* path)
+{
+	const char* p = strrchr(path, '/');
+	std::string	name(p ? p + 1 : path);
+	size_t	dot = name.rfind('.');
+	if (dot != std::string::npos)
+		name.resize(dot);
+	return name;
+}
+
+static bool ReadFile(const std::string& filename, std::vector<char>& data)
+{
+	FILE* file = fopen(filename.c_str(), "rb");
+	if (!file)
+		return false;
+
+	data.clear();
+	char	buffer[4096];
+	size_t	n;
+	while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		data.insert(data.end(), buffer, buffer + n);
+
+	fclose(file);
+	return true;
+}
+
+static long ResidentKB(pid_t pid)
+{
+	char	filename[64];
+	sprintf(filename, "/proc/%d/status", int(pid));
+
+	FILE* file = fopen(filename, "r");
+	if (!file)
+		return -1;
+
+	long	rss = -1;
+	char	line[256];
+	while (fgets(line, sizeof(line), file))
+	{
+		if (sscanf(line, "VmRSS: %ld", &rss) == 1)
+			break;
+	}
+
+	fclose(file);
+	return rss;
+}
+
+static pid_t StartServer(const char* compiler, FILE*& requests, FILE*& replies)
+{
+	int	in[2], out[2];
+	if (pipe(in) || pipe(out))
+		return -1;
+
+	pid_t	pid = fork();
+	if (pid == 0)
+	{
+		dup2(in[0], 0);
+		dup2(out[1], 1);
+		close(in[0]); close(in[1]); close(out[0]); close(out[1]);
+		execl(compiler, compiler, "-server", (char*)nullptr);
+		_exit(20);
+	}
+
+	close(in[0]);
+	close(out[1]);
+
+	requests = fdopen(in[1], "w");
+	replies = fdopen(out[0], "r");
+
+	return pid;
+}
+
+static int Request(FILE* requests, FILE* replies, const std::string& args)
+{
+	fprintf(requests, "%s\n", args.c_str());
+	fflush(requests);
+
+	char	line[512];
+	while (fgets(line, sizeof(line), replies))
+	{
+		int	result;
+		if (sscanf(line, "@done %d", &result) == 1)
+			return result;
+	}
+
+	return -1;
+}
+
+int main(int argc, const char** argv)
+{
+	const char	*	compiler = "../bin/oscar64", * include = "../include", * workdir = "serverbench";
+	int				rounds = 10;
+	double			growth = 4.0;
+
+	std::vector<const char*>	sources;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (!strncmp(arg, "-c=", 3))
+			compiler = arg + 3;
+		else if (!strncmp(arg, "-i=", 3))
+			include = arg + 3;
+		else if (!strncmp(arg, "-w=", 3))
+			workdir = arg + 3;
+		else if (!strncmp(arg, "-r=", 3))
+			rounds = atoi(arg + 3);
+		else if (!strncmp(arg, "-m=", 3))
+			growth = atof(arg + 3);
+		else if (arg[0] == '-')
+		{
+			printf("Invalid option <%s>\n", arg);
+			return 20;
+		}
+		else
+			sources.push_back(arg);
+	}
+
+	if (sources.size() == 0 || rounds < 2)
+	{
+		printf("serverbench [-c=compiler] [-i=include] [-w=workdir] [-r=requests] [-m=growth MB] source.c ...\n");
+		return 20;
+	}
+
+	mkdir(workdir, 0777);
+
+	// The requests run from the work directory, the paths have to be absolute
+
+	char	cpath[4096], ipath[4096];
+	if (!realpath(compiler, cpath) || !realpath(include, ipath))
+	{
+		printf("Could not find <%s> or <%s>\n", compiler, include);
+		return 20;
+	}
+
+	std::vector<std::string>	args, prgs;
+	std::vector<std::vector<char>>	outputs;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		char	spath[4096];
+		if (!realpath(sources[i], spath))
+		{
+			printf("Could not find <%s>\n", sources[i]);
+			return 20;
+		}
+
+		for (int j = 0; j < NumModes; j++)
+		{
+			char	wpath[4096];
+			std::string	prg = std::string(realpath(workdir, wpath) ? wpath : workdir) + "/" + BaseName(sources[i]) + (j ? "_n" : "") + ".prg";
+			prgs.push_back(prg);
+			args.push_back(std::string(Modes[j]) + " -i=\"" + ipath + "\" -rt=\"" + ipath + "/crt.c\" -o=\"" + prg + "\" \"" + spath + "\"");
+		}
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+
+	FILE	*	requests, * replies;
+	pid_t	pid = StartServer(cpath, requests, replies);
+	if (pid < 0)
+	{
+		printf("Could not start <%s>\n", cpath);
+		return 20;
+	}
+
+	int		failed = 0, changed = 0;
+	long	first = 0, last = 0;
+
+	outputs.resize(args.size());
+
+	for (int r = 0; r < rounds && !failed; r++)
+	{
+		for (size_t i = 0; i < args.size(); i++)
+		{
+			std::vector<char>	data;
+
+			int	result = Request(requests, replies, args[i]);
+			if (result != 0 || !ReadFile(prgs[i], data))
+			{
+				printf("%s request %d FAILED (%d)\n", prgs[i].c_str(), r + 1, result);
+				failed++;
+				break;
+			}
+
+			if (r == 0)
+				outputs[i] = data;
+			else if (data != outputs[i])
+			{
+				printf("%s request %d CHANGED\n", prgs[i].c_str(), r + 1);
+				changed++;
+			}
+		}
+
+		last = ResidentKB(pid);
+		if (r == 0)
+			first = last;
+
+		printf("round %3d %8ld KB\n", r + 1, last);
+	}
+
+	fclose(requests);
+	fclose(replies);
+	waitpid(pid, nullptr, 0);
+
+	double	mb = double(last - first) / 1024.0;
+
+	printf("%d rounds of %d requests, %d failed, %d changed, %+.1f MB after the first round", rounds, int(args.size()), failed, changed, mb);
+	if (mb > growth)
+		printf("  LEAK");
+	printf("\n");
+
+	return failed || changed || mb > growth ? 1 : 0;
+}
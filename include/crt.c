@@ -668,6 +668,32 @@ P1:
 }		
 #pragma	bytecode(BC_JSR, inp_jsr)
 
+__asm inp_jump_table
+{
+		lda	(ip), y
+		tax
+		iny
+		lda	(ip), y
+		sta	addr
+		iny
+		lda	(ip), y
+		sta	addr + 1
+		iny
+		lda	(ip), y
+		sta	tmp
+		iny
+		lda	(ip), y
+		sta	tmp + 1
+		ldy	$00, x
+		lda	(addr), y
+		sta	ip
+		lda	(tmp), y
+		sta	ip + 1
+		jmp	startup.pexec
+}
+
+#pragma	bytecode(BC_JUMP_TABLE, inp_jump_table)
+
 __asm inp_native
 {
 		tya
@@ -148,6 +148,7 @@ enum ByteCode
 	BC_SET_LE,
 
 	BC_JSR,
+	BC_JUMP_TABLE,
 
 	BC_NATIVE = 0x75,
 
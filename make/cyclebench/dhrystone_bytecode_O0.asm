@@ -0,0 +1,1562 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 70 16 STX $1670 ; (spentry + 0)
+0811 : a9 71 __ LDA #$71
+0813 : 85 19 __ STA IP + 0
+0815 : a9 16 __ LDA #$16
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 2a __ LDA #$2a
+081c : e9 16 __ SBC #$16
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 b0 __ LDA #$b0
+0832 : e9 71 __ SBC #$71
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	3, 72
+0a04:	PUSH	#$0006
+0a07:	LEA	T0, Next_Glob_Rec + 0
+0a0b:	MOV	Next_Ptr_Glob + 0, T0
+0a0f:	LEA	T1, Glob_Rec + 0
+0a13:	MOV	Ptr_Glob + 0, T1
+0a17:	MOV	Glob_Rec + 0, T0
+0a1b:	MOV	ACCU, #0
+0a1e:	MOVB	Glob_Rec + 2, ACCU
+0a22:	MOV	ACCU, #2
+0a25:	MOVB	Glob_Rec + 3, ACCU
+0a29:	MOV	ACCU, #40
+0a2c:	MOV	Glob_Rec + 4, ACCU
+0a30:	LEA	ADDR, Glob_Rec + 6
+0a34:	LEA	ACCU, $0c28
+0a38:	STRCPY
+0a39:	LEA	ADDR, 5(FP)
+0a3d:	LEA	ACCU, $0c47
+0a41:	STRCPY
+0a42:	MOV	ACCU, #10
+0a45:	MOV	Arr_2_Glob + 814, ACCU
+0a49:	MOV	T0, #1
+0a4c:	CALL	Proc_5 + 0
+0a4f:	CALL	Proc_4 + 0
+0a52:	MOV	ACCU, #2
+0a55:	MOV	0(FP), ACCU
+0a58:	LEA	T1, 36(FP)
+0a5c:	LEA	T2, $0c9c
+0a60:	MOV	ADDR, T1
+0a62:	MOV	ACCU, T2
+0a64:	STRCPY
+0a65:	MOV	ACCU, #1
+0a68:	MOVB	4(FP), ACCU
+0a6b:	LEA	T2, 5(FP)
+0a6f:	MOV	2(SP), T2
+0a72:	MOV	4(SP), T1
+0a75:	CALL	Func_2 + 0
+0a78:	MOVB	ACCU, ACCU
+0a7a:	SEQ
+0a7b:	MOVB	Bool_Glob + 0, ACCU
+0a7f:	MOV	T1, #3
+0a82:	MOV	ACCU, 0(FP)
+0a85:	CMPS	ACCU, #$0003
+0a88:	BGTF	$0BF3
+0a8b:	LEA	P0, Arr_1_Glob + 0
+0a8f:	LEA	P2, Arr_2_Glob + 0
+0a93:	MOV	ACCU, 0(FP)
+0a96:	MOV	P4, ACCU
+0a98:	MOV	ACCU, 2(FP)
+0a9b:	MOV	P6, ACCU
+0a9d:	CALL	Proc_8 + 0
+0aa0:	MOV	T2, Ptr_Glob + 0
+0aa4:	MOV	2(SP), T2
+0aa7:	CALL	Proc_1 + 0
+0aaa:	MOVUB	ACCU, Ch_2_Glob + 0
+0aae:	CMPUB	ACCU, #$0041
+0ab0:	BLEF	$0BAE
+0ab3:	MOV	ACCU, 0(FP)
+0ab6:	MUL	ACCU, T1
+0ab8:	MOV	T1, ACCU
+0aba:	MOV	T2, 2(FP)
+0abd:	DIVS	ACCU, T2
+0abf:	MOV	T4, ACCU
+0ac1:	MOV	0(FP), T4
+0ac4:	LEA	P0, 0(FP)
+0ac8:	CALL	Proc_2 + 0
+0acb:	ADD	T0, #$0001
+0acf:	MOV	ACCU, T0
+0ad1:	CMPS	ACCU, #$01F4
+0ad4:	BGEF	$0A4C
+0ad7:	MOV	ACCU, Int_Glob + 0
+0adb:	CMPU	ACCU, #$0005
+0ade:	BNEF	$0BA9
+0ae1:	MOVUB	ACCU, Bool_Glob + 0
+0ae5:	BEQF	$0BA9
+0ae8:	MOVUB	ACCU, Ch_1_Glob + 0
+0aec:	CMPUB	ACCU, #$0041
+0aee:	BNEF	$0BA9
+0af1:	MOVUB	ACCU, Ch_2_Glob + 0
+0af5:	CMPUB	ACCU, #$0042
+0af7:	BNEF	$0BA9
+0afa:	MOV	ACCU, Arr_1_Glob + 16
+0afe:	CMPU	ACCU, #$0007
+0b01:	BNEF	$0BA4
+0b04:	MOV	ACCU, Arr_2_Glob + 814
+0b08:	CMPU	ACCU, #$01FE
+0b0b:	BNEF	$0BA4
+0b0e:	MOV	T0, Ptr_Glob + 0
+0b12:	MOV	ADDR, T0
+0b14:	MOVUB	ACCU, 2(ADDR)
+0b17:	BNEF	$0B9F
+0b1a:	MOVUB	ACCU, 3(ADDR)
+0b1d:	CMPUB	ACCU, #$0002
+0b1f:	BNE	$0B9F
+0b21:	MOV	ACCU, 4(ADDR)
+0b24:	CMPU	ACCU, #$0011
+0b27:	BNE	$0B9F
+0b29:	MOV	T5, Next_Ptr_Glob + 0
+0b2d:	MOV	ADDR, T5
+0b2f:	MOVUB	ACCU, 2(ADDR)
+0b32:	BNE	$0B9A
+0b34:	MOVUB	ACCU, 3(ADDR)
+0b37:	CMPUB	ACCU, #$0001
+0b39:	BNE	$0B9A
+0b3b:	MOV	ACCU, 4(ADDR)
+0b3e:	CMPU	ACCU, #$0012
+0b41:	BNE	$0B9A
+0b43:	MOV	ACCU, 0(FP)
+0b46:	CMPU	ACCU, #$0005
+0b49:	BNE	$0B95
+0b4b:	MOV	ACCU, T1
+0b4d:	SUB	ACCU, T2
+0b4f:	MUL	ACCU, #7
+0b52:	SUB	ACCU, T4
+0b54:	CMPU	ACCU, #$000D
+0b57:	BNE	$0B95
+0b59:	MOV	ACCU, 2(FP)
+0b5c:	CMPU	ACCU, #$0007
+0b5f:	BNE	$0B95
+0b61:	MOVUB	ACCU, 4(FP)
+0b64:	CMPUB	ACCU, #$0001
+0b66:	BNE	$0B95
+0b68:	ADD	T0, #$0006
+0b6c:	MOV	ACCU, T0
+0b6e:	MOV	P0, ACCU
+0b70:	LEA	P2, $0fc0
+0b74:	JSR	strcmp + 0
+0b77:	BNE	$0B8B
+0b79:	LEA	P0, 36(FP)
+0b7d:	LEA	P2, $0fdf
+0b81:	JSR	strcmp + 0
+0b84:	BNE	$0B8B
+0b86:	MOV	ACCU, #0
+0b89:	JUMP	$0B8E
+0b8b:	MOV	ACCU, #6
+0b8e:	POP	#$0006
+0b91:	RETURN	3, 72
+0b95:	MOV	ACCU, #5
+0b98:	JUMP	$0B8E
+0b9a:	MOV	ACCU, #4
+0b9d:	JUMP	$0B8E
+0b9f:	MOV	ACCU, #3
+0ba2:	JUMP	$0B8E
+0ba4:	MOV	ACCU, #2
+0ba7:	JUMP	$0B8E
+0ba9:	MOV	ACCU, #1
+0bac:	JUMP	$0B8E
+0bae:	MOVB	T3, #65
+0bb1:	MOVB	T6, 4(FP)
+0bb4:	MOVB	ACCU, T3
+0bb6:	MOVB	P0, ACCU
+0bb8:	MOVB	P1, #67
+0bbb:	CALL	Func_1 + 0
+0bbe:	CMPUB	ACCU, T6
+0bc0:	BNE	$0BE3
+0bc2:	LEA	T1, 4(FP)
+0bc6:	MOV	ACCU, #0
+0bc9:	MOVB	2(SP), ACCU
+0bcc:	MOV	3(SP), T1
+0bcf:	CALL	Proc_6 + 0
+0bd2:	LEA	ADDR, 36(FP)
+0bd6:	LEA	ACCU, $0f68
+0bda:	STRCPY
+0bdb:	MOV	Int_Glob + 0, T0
+0bdf:	MOV	ACCU, T0
+0be1:	MOV	T1, ACCU
+0be3:	MOVB	T6, Ch_2_Glob + 0
+0be7:	ADDB	T3, #$0001
+0bea:	MOVB	ACCU, T6
+0bec:	CMPUB	ACCU, T3
+0bee:	BLE	$0BB1
+0bf0:	JUMPF	$0AB3
+0bf3:	LEA	T2, 2(FP)
+0bf7:	MOV	T4, 0(FP)
+0bfa:	MOV	ACCU, T4
+0bfc:	MUL	ACCU, #5
+0bff:	ADD	ACCU, #$FFFD
+0c03:	MOV	2(FP), ACCU
+0c06:	MOV	ACCU, T4
+0c08:	MOV	P0, ACCU
+0c0a:	MOV	P2, #3
+0c0d:	MOV	ACCU, T2
+0c0f:	MOV	P4, ACCU
+0c11:	CALL	Proc_7 + 0
+0c14:	MOV	T4, 0(FP)
+0c17:	ADD	T4, #$0001
+0c1b:	MOV	0(FP), T4
+0c1e:	MOV	ACCU, T4
+0c20:	CMPS	ACCU, #$0003
+0c23:	BGT	$0BF7
+0c25:	JUMPF	$0A8B
+--------------------------------------------------------------------
+Proc_5:
+0c66:	ENTER	0, 2
+0c6a:	MOV	ACCU, #65
+0c6d:	MOVB	Ch_1_Glob + 0, ACCU
+0c71:	MOV	ACCU, #0
+0c74:	MOVB	Bool_Glob + 0, ACCU
+0c78:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_4:
+0c7c:	ENTER	0, 2
+0c80:	MOVUB	ACCU, Ch_1_Glob + 0
+0c84:	CMPUB	ACCU, #$0041
+0c86:	SEQ
+0c87:	MOVB	T1, Bool_Glob + 0
+0c8b:	OR	ACCU, T1
+0c8d:	MOVB	Bool_Glob + 0, ACCU
+0c91:	MOV	ACCU, #66
+0c94:	MOVB	Ch_2_Glob + 0, ACCU
+0c98:	RETURN	0, 2
+--------------------------------------------------------------------
+Func_2:
+0cbb:	ENTER	0, 2
+0cbf:	PUSH	#$0002
+0cc2:	MOV	T0, 4(FP)
+0cc5:	MOV	T1, 2(FP)
+0cc8:	MOV	T2, #2
+0ccb:	MOV	ACCU, T1
+0ccd:	LEAX	ADDR, T2 + ACCU
+0ccf:	MOVB	P0, 0(ADDR)
+0cd2:	MOV	ACCU, T0
+0cd4:	ADD	T2, ACCU
+0cd6:	MOV	ADDR, T2
+0cd8:	MOVB	P1, 1(ADDR)
+0cdb:	CALL	Func_1 + 0
+0cde:	MOVB	ACCU, ACCU
+0ce0:	BNE	$0CC8
+0ce2:	MOV	ACCU, 2(FP)
+0ce5:	MOV	P0, ACCU
+0ce7:	MOV	ACCU, 4(FP)
+0cea:	MOV	P2, ACCU
+0cec:	JSR	strcmp + 0
+0cef:	BGT	$0CF6
+0cf1:	MOV	ACCU, #0
+0cf4:	JUMP	$0D00
+0cf6:	MOV	ACCU, #10
+0cf9:	MOV	Int_Glob + 0, ACCU
+0cfd:	MOV	ACCU, #1
+0d00:	POP	#$0002
+0d03:	RETURN	0, 2
+--------------------------------------------------------------------
+Func_1:
+0d07:	ENTER	0, 2
+0d0b:	MOVB	ACCU, P0
+0d0d:	MOVB	T0, ACCU
+0d0f:	MOVB	ACCU, P1
+0d11:	CMPUB	ACCU, T0
+0d13:	BNE	$0D1E
+0d15:	MOVB	Ch_1_Glob + 0, T0
+0d19:	MOV	ACCU, #1
+0d1c:	JUMP	$0D21
+0d1e:	MOV	ACCU, #0
+0d21:	RETURN	0, 2
+--------------------------------------------------------------------
+strcmp:
+0d25 : ea __ __ NOP
+0d26 : a0 00 __ LDY #$00
+0d28 : 84 1c __ STY ACCU + 1
+0d2a : b1 0d __ LDA (P0),y
+0d2c : f0 16 __ BEQ $0d44
+0d2e : d1 0f __ CMP (P2),y
+0d30 : d0 16 __ BNE $0d48
+0d32 : c8 __ __ INY
+0d33 : b1 0d __ LDA (P0),y
+0d35 : f0 0d __ BEQ $0d44
+0d37 : d1 0f __ CMP (P2),y
+0d39 : d0 0d __ BNE $0d48
+0d3b : c8 __ __ INY
+0d3c : d0 ec __ BNE $0d2a
+0d3e : e6 0e __ INC P1
+0d40 : e6 10 __ INC P3
+0d42 : d0 e6 __ BNE $0d2a
+0d44 : d1 0f __ CMP (P2),y
+0d46 : f0 0a __ BEQ $0d52
+0d48 : b0 06 __ BCS $0d50
+0d4a : a9 ff __ LDA #$ff
+0d4c : 85 1c __ STA ACCU + 1
+0d4e : 30 02 __ BMI $0d52
+0d50 : a9 01 __ LDA #$01
+0d52 : 85 1b __ STA ACCU + 0
+0d54 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0d55:	ENTER	0, 2
+0d59:	MOV	ACCU, P0
+0d5b:	MOV	T0, ACCU
+0d5d:	ADD	T0, #$0002
+0d61:	MOV	ACCU, P2
+0d63:	ADD	T0, ACCU
+0d65:	MOV	ADDR, P4
+0d67:	MOV	0(ADDR), T0
+0d6a:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_8:
+0d6e:	ENTER	0, 2
+0d72:	MOV	ACCU, P0
+0d74:	MOV	T0, ACCU
+0d76:	MOV	ACCU, P4
+0d78:	MOV	T1, ACCU
+0d7a:	SHL	ACCU, #1
+0d7c:	ADD	T0, ACCU
+0d7e:	MOV	ADDR, T0
+0d80:	MOV	ACCU, P6
+0d82:	MOV	T2, ACCU
+0d84:	MOV	10(ADDR), T2
+0d87:	MOV	12(ADDR), T2
+0d8a:	MOV	ACCU, T1
+0d8c:	ADD	ACCU, #$0005
+0d90:	MOV	T2, ACCU
+0d92:	MOV	70(ADDR), T2
+0d95:	MOV	ACCU, T1
+0d97:	ADD	ACCU, #$0006
+0d9b:	CMPS	ACCU, T2
+0d9d:	BLE	$0DE8
+0d9f:	MOV	ACCU, P2
+0da1:	MOV	T0, ACCU
+0da3:	MOV	ACCU, T2
+0da5:	MUL	ACCU, #50
+0da8:	ADD	ACCU, T2
+0daa:	ADD	ACCU, #$FFFF
+0dae:	SHL	ACCU, #1
+0db0:	LEAX	ADDR, T0 + ACCU
+0db2:	MOV	T4, 0(ADDR)
+0db5:	ADD	T4, #$0001
+0db9:	MOV	0(ADDR), T4
+0dbc:	MOV	ACCU, P0
+0dbe:	MOV	T1, ACCU
+0dc0:	MOV	ACCU, T2
+0dc2:	SHL	ACCU, #1
+0dc4:	LEAX	ADDR, T1 + ACCU
+0dc6:	MOV	T1, 0(ADDR)
+0dc9:	MOV	ACCU, T2
+0dcb:	ADD	ACCU, #$0014
+0dcf:	MUL	ACCU, #50
+0dd2:	ADD	ACCU, T2
+0dd4:	SHL	ACCU, #1
+0dd6:	ADD	T0, ACCU
+0dd8:	MOV	ADDR, T0
+0dda:	MOV	0(ADDR), T1
+0ddd:	MOV	ACCU, #5
+0de0:	MOV	Int_Glob + 0, ACCU
+0de4:	RETURN	0, 2
+0de8:	MOV	ACCU, T2
+0dea:	MOV	T0, ACCU
+0dec:	MUL	ACCU, #50
+0def:	ADD	ACCU, T2
+0df1:	SHL	ACCU, #1
+0df3:	MOV	T1, ACCU
+0df5:	MOV	ACCU, P2
+0df7:	ADD	T1, ACCU
+0df9:	MOV	ACCU, T2
+0dfb:	ADD	ACCU, #$0001
+0dff:	MOV	T4, ACCU
+0e01:	MOV	ADDR, T1
+0e03:	MOV	0(ADDR), T2
+0e06:	ADD	T1, #$0002
+0e0a:	ADD	T0, #$0001
+0e0e:	MOV	ACCU, T4
+0e10:	CMPS	ACCU, T0
+0e12:	BLE	$0E01
+0e14:	JUMP	$0D9F
+--------------------------------------------------------------------
+Proc_1:
+0e16:	ENTER	0, 2
+0e1a:	PUSH	#$0005
+0e1d:	MOV	T0, 2(FP)
+0e20:	MOV	ADDR, T0
+0e22:	MOV	T1, 0(ADDR)
+0e25:	MOV	T2, Ptr_Glob + 0
+0e29:	MOV	ADDR, T0
+0e2b:	MOV	T3, 0(ADDR)
+0e2e:	MOV	ADDR, T3
+0e30:	MOV	ACCU, T2
+0e32:	COPY	#37
+0e34:	MOV	ACCU, #5
+0e37:	MOV	ADDR, T0
+0e39:	MOV	4(ADDR), ACCU
+0e3c:	MOV	ADDR, T1
+0e3e:	MOV	4(ADDR), ACCU
+0e41:	MOV	ADDR, T0
+0e43:	MOV	T0, 0(ADDR)
+0e46:	MOV	ADDR, T1
+0e48:	MOV	0(ADDR), T0
+0e4b:	MOV	2(SP), T1
+0e4e:	CALL	Proc_3 + 0
+0e51:	MOV	ADDR, T1
+0e53:	MOVUB	ACCU, 2(ADDR)
+0e56:	BEQ	$0E62
+0e58:	MOV	ADDR, 2(FP)
+0e5b:	MOV	ACCU, 0(ADDR)
+0e5e:	COPY	#37
+0e60:	JUMP	$0E9C
+0e62:	MOV	ACCU, #6
+0e65:	MOV	4(ADDR), ACCU
+0e68:	MOV	ADDR, 2(FP)
+0e6b:	MOVB	T4, 3(ADDR)
+0e6e:	MOVB	2(SP), T4
+0e71:	MOV	ACCU, T1
+0e73:	ADD	ACCU, #$0003
+0e77:	MOV	3(SP), ACCU
+0e7a:	CALL	Proc_6 + 0
+0e7d:	MOV	T0, Ptr_Glob + 0
+0e81:	MOV	ADDR, T0
+0e83:	MOV	T0, 0(ADDR)
+0e86:	MOV	ADDR, T1
+0e88:	MOV	P0, 4(ADDR)
+0e8b:	MOV	0(ADDR), T0
+0e8e:	MOV	P2, #10
+0e91:	MOV	ACCU, T1
+0e93:	ADD	ACCU, #$0004
+0e97:	MOV	P4, ACCU
+0e99:	CALL	Proc_7 + 0
+0e9c:	POP	#$0005
+0e9f:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_3:
+0ea3:	ENTER	0, 2
+0ea7:	PUSH	#$0002
+0eaa:	MOV	T0, Ptr_Glob + 0
+0eae:	MOV	ACCU, T0
+0eb0:	BEQ	$0EBD
+0eb2:	MOV	ADDR, T0
+0eb4:	MOV	T1, 0(ADDR)
+0eb7:	MOV	ADDR, 2(FP)
+0eba:	MOV	0(ADDR), T1
+0ebd:	MOV	P0, #10
+0ec0:	MOV	P2, Int_Glob + 0
+0ec4:	ADD	T0, #$0004
+0ec8:	MOV	ACCU, T0
+0eca:	MOV	P4, ACCU
+0ecc:	CALL	Proc_7 + 0
+0ecf:	POP	#$0002
+0ed2:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_6:
+0ed6:	ENTER	0, 2
+0eda:	PUSH	#$0002
+0edd:	MOVB	T0, 2(FP)
+0ee0:	MOV	ADDR, 3(FP)
+0ee3:	MOVB	0(ADDR), T0
+0ee6:	MOVB	ACCU, T0
+0ee8:	MOVB	P0, ACCU
+0eea:	CALL	Func_3 + 0
+0eed:	MOVB	ACCU, ACCU
+0eef:	BNE	$0EFA
+0ef1:	MOV	ADDR, 3(FP)
+0ef4:	MOV	ACCU, #3
+0ef7:	MOVB	0(ADDR), ACCU
+0efa:	MOVB	T0, 2(FP)
+0efd:	MOVB	ACCU, T0
+0eff:	CMPUB	ACCU, #$0003
+0f01:	BEQ	$0F18
+0f03:	MOVB	ACCU, T0
+0f05:	CMPUB	ACCU, #$0003
+0f07:	BGT	$0F1F
+0f09:	MOVB	ACCU, T0
+0f0b:	CMPUB	ACCU, #$0004
+0f0d:	BNE	$0F18
+0f0f:	MOV	ADDR, 3(FP)
+0f12:	MOV	ACCU, #2
+0f15:	MOVB	0(ADDR), ACCU
+0f18:	POP	#$0002
+0f1b:	RETURN	0, 2
+0f1f:	MOVB	ACCU, T0
+0f21:	BEQ	$0F4E
+0f23:	MOVB	ACCU, T0
+0f25:	CMPUB	ACCU, #$0001
+0f27:	BEQ	$0F3A
+0f29:	MOVB	ACCU, T0
+0f2b:	CMPUB	ACCU, #$0002
+0f2d:	BNE	$0F18
+0f2f:	MOV	ADDR, 3(FP)
+0f32:	MOV	ACCU, #1
+0f35:	MOVB	0(ADDR), ACCU
+0f38:	JUMP	$0F18
+0f3a:	MOV	ACCU, Int_Glob + 0
+0f3e:	CMPS	ACCU, #$0064
+0f41:	BLT	$0F4E
+0f43:	MOV	ADDR, 3(FP)
+0f46:	MOV	ACCU, #3
+0f49:	MOVB	0(ADDR), ACCU
+0f4c:	JUMP	$0F18
+0f4e:	MOV	ADDR, 3(FP)
+0f51:	MOV	ACCU, #0
+0f54:	MOVB	0(ADDR), ACCU
+0f57:	JUMP	$0F18
+--------------------------------------------------------------------
+Func_3:
+0f59:	ENTER	0, 2
+0f5d:	MOVB	ACCU, P0
+0f5f:	CMPUB	ACCU, #$0002
+0f61:	SEQ
+0f62:	MOVB	T0, ACCU
+0f64:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_2:
+0f87:	ENTER	0, 2
+0f8b:	MOVB	T0, Ch_1_Glob + 0
+0f8f:	MOV	ADDR, P0
+0f91:	MOV	T1, 0(ADDR)
+0f94:	ADD	T1, #$000A
+0f98:	MOVB	ACCU, T0
+0f9a:	CMPUB	ACCU, #$0041
+0f9c:	BEQ	$0FAB
+0f9e:	MOVUB	ACCU, Ch_1_Glob + 0
+0fa2:	CMPUB	ACCU, #$0041
+0fa4:	SEQ
+0fa5:	MOVB	T0, ACCU
+0fa7:	MOVB	ACCU, T0
+0fa9:	BEQ	$0FA7
+0fab:	ADD	T1, #$FFFF
+0faf:	MOV	T2, Int_Glob + 0
+0fb3:	MOV	ACCU, T1
+0fb5:	SUB	ACCU, T2
+0fb7:	MOV	ADDR, P0
+0fb9:	MOV	0(ADDR), ACCU
+0fbc:	RETURN	0, 2
+--------------------------------------------------------------------
+negaccu:
+0ffe : 38 __ __ SEC
+0fff : a9 00 __ LDA #$00
+1001 : e5 1b __ SBC ACCU + 0
+1003 : 85 1b __ STA ACCU + 0
+1005 : a9 00 __ LDA #$00
+1007 : e5 1c __ SBC ACCU + 1
+1009 : 85 1c __ STA ACCU + 1
+100b : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+100c : 38 __ __ SEC
+100d : a9 00 __ LDA #$00
+100f : e5 03 __ SBC $03
+1011 : 85 03 __ STA $03
+1013 : a9 00 __ LDA #$00
+1015 : e5 04 __ SBC $04
+1017 : 85 04 __ STA $04
+1019 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+101a : a5 1c __ LDA ACCU + 1
+101c : d0 31 __ BNE $104f
+101e : a5 04 __ LDA $04
+1020 : d0 1e __ BNE $1040
+1022 : 85 06 __ STA $06
+1024 : a2 04 __ LDX #$04
+1026 : 06 1b __ ASL ACCU + 0
+1028 : 2a __ __ ROL
+1029 : c5 03 __ CMP $03
+102b : 90 02 __ BCC $102f
+102d : e5 03 __ SBC $03
+102f : 26 1b __ ROL ACCU + 0
+1031 : 2a __ __ ROL
+1032 : c5 03 __ CMP $03
+1034 : 90 02 __ BCC $1038
+1036 : e5 03 __ SBC $03
+1038 : 26 1b __ ROL ACCU + 0
+103a : ca __ __ DEX
+103b : d0 eb __ BNE $1028
+103d : 85 05 __ STA $05
+103f : 60 __ __ RTS
+1040 : a5 1b __ LDA ACCU + 0
+1042 : 85 05 __ STA $05
+1044 : a5 1c __ LDA ACCU + 1
+1046 : 85 06 __ STA $06
+1048 : a9 00 __ LDA #$00
+104a : 85 1b __ STA ACCU + 0
+104c : 85 1c __ STA ACCU + 1
+104e : 60 __ __ RTS
+104f : a5 04 __ LDA $04
+1051 : d0 1f __ BNE $1072
+1053 : a5 03 __ LDA $03
+1055 : 30 1b __ BMI $1072
+1057 : a9 00 __ LDA #$00
+1059 : 85 06 __ STA $06
+105b : a2 10 __ LDX #$10
+105d : 06 1b __ ASL ACCU + 0
+105f : 26 1c __ ROL ACCU + 1
+1061 : 2a __ __ ROL
+1062 : c5 03 __ CMP $03
+1064 : 90 02 __ BCC $1068
+1066 : e5 03 __ SBC $03
+1068 : 26 1b __ ROL ACCU + 0
+106a : 26 1c __ ROL ACCU + 1
+106c : ca __ __ DEX
+106d : d0 f2 __ BNE $1061
+106f : 85 05 __ STA $05
+1071 : 60 __ __ RTS
+1072 : a9 00 __ LDA #$00
+1074 : 85 05 __ STA $05
+1076 : 85 06 __ STA $06
+1078 : 84 02 __ STY $02
+107a : a0 10 __ LDY #$10
+107c : 18 __ __ CLC
+107d : 26 1b __ ROL ACCU + 0
+107f : 26 1c __ ROL ACCU + 1
+1081 : 26 05 __ ROL $05
+1083 : 26 06 __ ROL $06
+1085 : 38 __ __ SEC
+1086 : a5 05 __ LDA $05
+1088 : e5 03 __ SBC $03
+108a : aa __ __ TAX
+108b : a5 06 __ LDA $06
+108d : e5 04 __ SBC $04
+108f : 90 04 __ BCC $1095
+1091 : 86 05 __ STX $05
+1093 : 85 06 __ STA $06
+1095 : 88 __ __ DEY
+1096 : d0 e5 __ BNE $107d
+1098 : 26 1b __ ROL ACCU + 0
+109a : 26 1c __ ROL ACCU + 1
+109c : a4 02 __ LDY $02
+109e : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+109f : a9 4c __ LDA #$4c
+10a1 : 85 54 __ STA $54
+10a3 : a9 00 __ LDA #$00
+10a5 : 85 13 __ STA P6
+10a7 : a9 19 __ LDA #$19
+10a9 : 85 16 __ STA P9
+10ab : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+10ac : b1 19 __ LDA (IP + 0),y
+10ae : aa __ __ TAX
+10af : c8 __ __ INY
+10b0 : b1 19 __ LDA (IP + 0),y
+10b2 : 95 00 __ STA $00,x
+10b4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+10b7 : b1 19 __ LDA (IP + 0),y
+10b9 : aa __ __ TAX
+10ba : c8 __ __ INY
+10bb : b1 19 __ LDA (IP + 0),y
+10bd : 95 00 __ STA $00,x
+10bf : a9 00 __ LDA #$00
+10c1 : 95 01 __ STA $01,x
+10c3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+10c6 : b1 19 __ LDA (IP + 0),y
+10c8 : aa __ __ TAX
+10c9 : b5 00 __ LDA $00,x
+10cb : 85 1b __ STA ACCU + 0
+10cd : a9 00 __ LDA #$00
+10cf : 85 1c __ STA ACCU + 1
+10d1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+10d4 : b1 19 __ LDA (IP + 0),y
+10d6 : aa __ __ TAX
+10d7 : a5 1b __ LDA ACCU + 0
+10d9 : 95 00 __ STA $00,x
+10db : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+10de : b1 19 __ LDA (IP + 0),y
+10e0 : aa __ __ TAX
+10e1 : b5 00 __ LDA $00,x
+10e3 : 85 1b __ STA ACCU + 0
+10e5 : b5 01 __ LDA $01,x
+10e7 : 85 1c __ STA ACCU + 1
+10e9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+10ec : b1 19 __ LDA (IP + 0),y
+10ee : aa __ __ TAX
+10ef : a5 1b __ LDA ACCU + 0
+10f1 : 95 00 __ STA $00,x
+10f3 : a5 1c __ LDA ACCU + 1
+10f5 : 95 01 __ STA $01,x
+10f7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+10fa : b1 19 __ LDA (IP + 0),y
+10fc : aa __ __ TAX
+10fd : b5 00 __ LDA $00,x
+10ff : 85 1f __ STA ADDR + 0
+1101 : b5 01 __ LDA $01,x
+1103 : 85 20 __ STA ADDR + 1
+1105 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1108 : b1 19 __ LDA (IP + 0),y
+110a : 85 1f __ STA ADDR + 0
+110c : c8 __ __ INY
+110d : b1 19 __ LDA (IP + 0),y
+110f : 85 20 __ STA ADDR + 1
+1111 : c8 __ __ INY
+1112 : b1 19 __ LDA (IP + 0),y
+1114 : aa __ __ TAX
+1115 : 84 02 __ STY $02
+1117 : a0 00 __ LDY #$00
+1119 : b1 1f __ LDA (ADDR + 0),y
+111b : 95 00 __ STA $00,x
+111d : a4 02 __ LDY $02
+111f : 4c 50 08 JMP $0850 ; (startup + 79)
+1122 : b1 19 __ LDA (IP + 0),y
+1124 : aa __ __ TAX
+1125 : c8 __ __ INY
+1126 : b1 19 __ LDA (IP + 0),y
+1128 : 84 02 __ STY $02
+112a : a8 __ __ TAY
+112b : 4c 19 11 JMP $1119 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+112e : b1 19 __ LDA (IP + 0),y
+1130 : 85 1f __ STA ADDR + 0
+1132 : c8 __ __ INY
+1133 : b1 19 __ LDA (IP + 0),y
+1135 : 85 20 __ STA ADDR + 1
+1137 : c8 __ __ INY
+1138 : b1 19 __ LDA (IP + 0),y
+113a : aa __ __ TAX
+113b : 84 02 __ STY $02
+113d : a0 00 __ LDY #$00
+113f : b1 1f __ LDA (ADDR + 0),y
+1141 : 95 00 __ STA $00,x
+1143 : a9 00 __ LDA #$00
+1145 : 95 01 __ STA $01,x
+1147 : a4 02 __ LDY $02
+1149 : 4c 50 08 JMP $0850 ; (startup + 79)
+114c : b1 19 __ LDA (IP + 0),y
+114e : aa __ __ TAX
+114f : c8 __ __ INY
+1150 : b1 19 __ LDA (IP + 0),y
+1152 : 84 02 __ STY $02
+1154 : a8 __ __ TAY
+1155 : 4c 3f 11 JMP $113f ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1158 : b1 19 __ LDA (IP + 0),y
+115a : 85 1f __ STA ADDR + 0
+115c : c8 __ __ INY
+115d : b1 19 __ LDA (IP + 0),y
+115f : 85 20 __ STA ADDR + 1
+1161 : c8 __ __ INY
+1162 : b1 19 __ LDA (IP + 0),y
+1164 : aa __ __ TAX
+1165 : 84 02 __ STY $02
+1167 : a0 00 __ LDY #$00
+1169 : b1 1f __ LDA (ADDR + 0),y
+116b : 95 00 __ STA $00,x
+116d : c8 __ __ INY
+116e : b1 1f __ LDA (ADDR + 0),y
+1170 : 95 01 __ STA $01,x
+1172 : a4 02 __ LDY $02
+1174 : 4c 50 08 JMP $0850 ; (startup + 79)
+1177 : b1 19 __ LDA (IP + 0),y
+1179 : aa __ __ TAX
+117a : c8 __ __ INY
+117b : b1 19 __ LDA (IP + 0),y
+117d : 84 02 __ STY $02
+117f : a8 __ __ TAY
+1180 : 4c 69 11 JMP $1169 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1183 : b1 19 __ LDA (IP + 0),y
+1185 : 85 1f __ STA ADDR + 0
+1187 : c8 __ __ INY
+1188 : b1 19 __ LDA (IP + 0),y
+118a : 85 20 __ STA ADDR + 1
+118c : c8 __ __ INY
+118d : b1 19 __ LDA (IP + 0),y
+118f : aa __ __ TAX
+1190 : 84 02 __ STY $02
+1192 : a0 00 __ LDY #$00
+1194 : b5 00 __ LDA $00,x
+1196 : 91 1f __ STA (ADDR + 0),y
+1198 : a4 02 __ LDY $02
+119a : 4c 50 08 JMP $0850 ; (startup + 79)
+119d : b1 19 __ LDA (IP + 0),y
+119f : aa __ __ TAX
+11a0 : c8 __ __ INY
+11a1 : b1 19 __ LDA (IP + 0),y
+11a3 : 84 02 __ STY $02
+11a5 : a8 __ __ TAY
+11a6 : 4c 94 11 JMP $1194 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+11a9 : b1 19 __ LDA (IP + 0),y
+11ab : 85 1f __ STA ADDR + 0
+11ad : c8 __ __ INY
+11ae : b1 19 __ LDA (IP + 0),y
+11b0 : 85 20 __ STA ADDR + 1
+11b2 : c8 __ __ INY
+11b3 : b1 19 __ LDA (IP + 0),y
+11b5 : aa __ __ TAX
+11b6 : 84 02 __ STY $02
+11b8 : a0 00 __ LDY #$00
+11ba : b5 00 __ LDA $00,x
+11bc : 91 1f __ STA (ADDR + 0),y
+11be : c8 __ __ INY
+11bf : b5 01 __ LDA $01,x
+11c1 : 91 1f __ STA (ADDR + 0),y
+11c3 : a4 02 __ LDY $02
+11c5 : 4c 50 08 JMP $0850 ; (startup + 79)
+11c8 : b1 19 __ LDA (IP + 0),y
+11ca : aa __ __ TAX
+11cb : c8 __ __ INY
+11cc : b1 19 __ LDA (IP + 0),y
+11ce : 84 02 __ STY $02
+11d0 : a8 __ __ TAY
+11d1 : 4c ba 11 JMP $11ba ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+11d4 : b1 19 __ LDA (IP + 0),y
+11d6 : aa __ __ TAX
+11d7 : c8 __ __ INY
+11d8 : b1 19 __ LDA (IP + 0),y
+11da : 95 00 __ STA $00,x
+11dc : c8 __ __ INY
+11dd : b1 19 __ LDA (IP + 0),y
+11df : 95 01 __ STA $01,x
+11e1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+11e4 : b1 19 __ LDA (IP + 0),y
+11e6 : aa __ __ TAX
+11e7 : 18 __ __ CLC
+11e8 : b5 00 __ LDA $00,x
+11ea : 65 1b __ ADC ACCU + 0
+11ec : 85 1f __ STA ADDR + 0
+11ee : b5 01 __ LDA $01,x
+11f0 : 65 1c __ ADC ACCU + 1
+11f2 : 85 20 __ STA ADDR + 1
+11f4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+11f7 : b1 19 __ LDA (IP + 0),y
+11f9 : aa __ __ TAX
+11fa : c8 __ __ INY
+11fb : b1 19 __ LDA (IP + 0),y
+11fd : 84 02 __ STY $02
+11ff : a8 __ __ TAY
+1200 : b1 25 __ LDA (FP + 0),y
+1202 : 95 00 __ STA $00,x
+1204 : a4 02 __ LDY $02
+1206 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1209 : b1 19 __ LDA (IP + 0),y
+120b : aa __ __ TAX
+120c : c8 __ __ INY
+120d : b1 19 __ LDA (IP + 0),y
+120f : 84 02 __ STY $02
+1211 : a8 __ __ TAY
+1212 : b1 25 __ LDA (FP + 0),y
+1214 : 95 00 __ STA $00,x
+1216 : a9 00 __ LDA #$00
+1218 : 95 01 __ STA $01,x
+121a : a4 02 __ LDY $02
+121c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+121f : b1 19 __ LDA (IP + 0),y
+1221 : aa __ __ TAX
+1222 : c8 __ __ INY
+1223 : b1 19 __ LDA (IP + 0),y
+1225 : 84 02 __ STY $02
+1227 : a8 __ __ TAY
+1228 : b1 25 __ LDA (FP + 0),y
+122a : 95 00 __ STA $00,x
+122c : c8 __ __ INY
+122d : b1 25 __ LDA (FP + 0),y
+122f : 95 01 __ STA $01,x
+1231 : a4 02 __ LDY $02
+1233 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1236 : b1 19 __ LDA (IP + 0),y
+1238 : aa __ __ TAX
+1239 : c8 __ __ INY
+123a : b1 19 __ LDA (IP + 0),y
+123c : 84 02 __ STY $02
+123e : a8 __ __ TAY
+123f : b5 00 __ LDA $00,x
+1241 : 91 25 __ STA (FP + 0),y
+1243 : a4 02 __ LDY $02
+1245 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1248 : b1 19 __ LDA (IP + 0),y
+124a : aa __ __ TAX
+124b : c8 __ __ INY
+124c : b1 19 __ LDA (IP + 0),y
+124e : 84 02 __ STY $02
+1250 : a8 __ __ TAY
+1251 : b5 00 __ LDA $00,x
+1253 : 91 25 __ STA (FP + 0),y
+1255 : c8 __ __ INY
+1256 : b5 01 __ LDA $01,x
+1258 : 91 25 __ STA (FP + 0),y
+125a : a4 02 __ LDY $02
+125c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+125f : b1 19 __ LDA (IP + 0),y
+1261 : aa __ __ TAX
+1262 : c8 __ __ INY
+1263 : 18 __ __ CLC
+1264 : b1 19 __ LDA (IP + 0),y
+1266 : 65 25 __ ADC FP + 0
+1268 : 95 00 __ STA $00,x
+126a : c8 __ __ INY
+126b : b1 19 __ LDA (IP + 0),y
+126d : 65 26 __ ADC FP + 1
+126f : 95 01 __ STA $01,x
+1271 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1274 : b1 19 __ LDA (IP + 0),y
+1276 : aa __ __ TAX
+1277 : c8 __ __ INY
+1278 : b1 19 __ LDA (IP + 0),y
+127a : 84 02 __ STY $02
+127c : a8 __ __ TAY
+127d : b5 00 __ LDA $00,x
+127f : 91 23 __ STA (SP + 0),y
+1281 : a4 02 __ LDY $02
+1283 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1286 : b1 19 __ LDA (IP + 0),y
+1288 : aa __ __ TAX
+1289 : c8 __ __ INY
+128a : b1 19 __ LDA (IP + 0),y
+128c : 84 02 __ STY $02
+128e : a8 __ __ TAY
+128f : b5 00 __ LDA $00,x
+1291 : 91 23 __ STA (SP + 0),y
+1293 : c8 __ __ INY
+1294 : b5 01 __ LDA $01,x
+1296 : 91 23 __ STA (SP + 0),y
+1298 : a4 02 __ LDY $02
+129a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+129d : b1 19 __ LDA (IP + 0),y
+129f : aa __ __ TAX
+12a0 : 18 __ __ CLC
+12a1 : a5 1b __ LDA ACCU + 0
+12a3 : 75 00 __ ADC $00,x
+12a5 : 85 1b __ STA ACCU + 0
+12a7 : a5 1c __ LDA ACCU + 1
+12a9 : 75 01 __ ADC $01,x
+12ab : 85 1c __ STA ACCU + 1
+12ad : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+12b0 : b1 19 __ LDA (IP + 0),y
+12b2 : aa __ __ TAX
+12b3 : 38 __ __ SEC
+12b4 : a5 1b __ LDA ACCU + 0
+12b6 : f5 00 __ SBC $00,x
+12b8 : 85 1b __ STA ACCU + 0
+12ba : a5 1c __ LDA ACCU + 1
+12bc : f5 01 __ SBC $01,x
+12be : 85 1c __ STA ACCU + 1
+12c0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_orr_16:
+12c3 : b1 19 __ LDA (IP + 0),y
+12c5 : aa __ __ TAX
+12c6 : a5 1b __ LDA ACCU + 0
+12c8 : 15 00 __ ORA $00,x
+12ca : 85 1b __ STA ACCU + 0
+12cc : a5 1c __ LDA ACCU + 1
+12ce : 15 01 __ ORA $01,x
+12d0 : 85 1c __ STA ACCU + 1
+12d2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+12d5 : b1 19 __ LDA (IP + 0),y
+12d7 : aa __ __ TAX
+12d8 : a9 00 __ LDA #$00
+12da : 85 05 __ STA $05
+12dc : 85 06 __ STA $06
+12de : b5 00 __ LDA $00,x
+12e0 : 85 03 __ STA $03
+12e2 : b5 01 __ LDA $01,x
+12e4 : 85 04 __ STA $04
+12e6 : a2 10 __ LDX #$10
+12e8 : 46 04 __ LSR $04
+12ea : 66 03 __ ROR $03
+12ec : 90 0d __ BCC $12fb
+12ee : 18 __ __ CLC
+12ef : a5 05 __ LDA $05
+12f1 : 65 1b __ ADC ACCU + 0
+12f3 : 85 05 __ STA $05
+12f5 : a5 06 __ LDA $06
+12f7 : 65 1c __ ADC ACCU + 1
+12f9 : 85 06 __ STA $06
+12fb : 06 1b __ ASL ACCU + 0
+12fd : 26 1c __ ROL ACCU + 1
+12ff : ca __ __ DEX
+1300 : d0 e6 __ BNE $12e8
+1302 : a5 05 __ LDA $05
+1304 : 85 1b __ STA ACCU + 0
+1306 : a5 06 __ LDA $06
+1308 : 85 1c __ STA ACCU + 1
+130a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+130d : b1 19 __ LDA (IP + 0),y
+130f : aa __ __ TAX
+1310 : b5 00 __ LDA $00,x
+1312 : 85 03 __ STA $03
+1314 : b5 01 __ LDA $01,x
+1316 : 85 04 __ STA $04
+1318 : 24 1c __ BIT ACCU + 1
+131a : 10 10 __ BPL $132c
+131c : 20 fe 0f JSR $0ffe ; (negaccu + 0)
+131f : 24 04 __ BIT $04
+1321 : 10 10 __ BPL $1333
+1323 : 20 0c 10 JSR $100c ; (negtmp + 0)
+1326 : 20 1a 10 JSR $101a ; (divmod + 0)
+1329 : 4c 50 08 JMP $0850 ; (startup + 79)
+132c : 24 04 __ BIT $04
+132e : 10 f6 __ BPL $1326
+1330 : 20 0c 10 JSR $100c ; (negtmp + 0)
+1333 : 20 1a 10 JSR $101a ; (divmod + 0)
+1336 : 20 fe 0f JSR $0ffe ; (negaccu + 0)
+1339 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+133c : b1 19 __ LDA (IP + 0),y
+133e : aa __ __ TAX
+133f : 18 __ __ CLC
+1340 : b5 00 __ LDA $00,x
+1342 : 65 1b __ ADC ACCU + 0
+1344 : 95 00 __ STA $00,x
+1346 : b5 01 __ LDA $01,x
+1348 : 65 1c __ ADC ACCU + 1
+134a : 95 01 __ STA $01,x
+134c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+134f : b1 19 __ LDA (IP + 0),y
+1351 : c8 __ __ INY
+1352 : aa __ __ TAX
+1353 : 18 __ __ CLC
+1354 : b5 00 __ LDA $00,x
+1356 : 71 19 __ ADC (IP + 0),y
+1358 : c8 __ __ INY
+1359 : 95 00 __ STA $00,x
+135b : b5 01 __ LDA $01,x
+135d : 71 19 __ ADC (IP + 0),y
+135f : 95 01 __ STA $01,x
+1361 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1364 : b1 19 __ LDA (IP + 0),y
+1366 : c8 __ __ INY
+1367 : aa __ __ TAX
+1368 : a9 00 __ LDA #$00
+136a : 85 05 __ STA $05
+136c : 85 06 __ STA $06
+136e : b5 00 __ LDA $00,x
+1370 : 85 03 __ STA $03
+1372 : b5 01 __ LDA $01,x
+1374 : 85 04 __ STA $04
+1376 : b1 19 __ LDA (IP + 0),y
+1378 : 4a __ __ LSR
+1379 : 85 07 __ STA $07
+137b : 90 0d __ BCC $138a
+137d : 18 __ __ CLC
+137e : a5 05 __ LDA $05
+1380 : 65 03 __ ADC $03
+1382 : 85 05 __ STA $05
+1384 : a5 06 __ LDA $06
+1386 : 65 04 __ ADC $04
+1388 : 85 06 __ STA $06
+138a : 06 03 __ ASL $03
+138c : 26 04 __ ROL $04
+138e : 46 07 __ LSR $07
+1390 : b0 eb __ BCS $137d
+1392 : d0 f6 __ BNE $138a
+1394 : a5 05 __ LDA $05
+1396 : 95 00 __ STA $00,x
+1398 : a5 06 __ LDA $06
+139a : 95 01 __ STA $01,x
+139c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+139f : b1 19 __ LDA (IP + 0),y
+13a1 : c8 __ __ INY
+13a2 : aa __ __ TAX
+13a3 : 18 __ __ CLC
+13a4 : b5 00 __ LDA $00,x
+13a6 : 71 19 __ ADC (IP + 0),y
+13a8 : 95 00 __ STA $00,x
+13aa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+13ad : b1 19 __ LDA (IP + 0),y
+13af : aa __ __ TAX
+13b0 : b5 00 __ LDA $00,x
+13b2 : 2c b1 19 BIT $19b1 ; (Arr_2_Glob + 754)
+13b5 : 29 0f __ AND #$0f
+13b7 : f0 0b __ BEQ $13c4
+13b9 : aa __ __ TAX
+13ba : a5 1c __ LDA ACCU + 1
+13bc : 06 1b __ ASL ACCU + 0
+13be : 2a __ __ ROL
+13bf : ca __ __ DEX
+13c0 : d0 fa __ BNE $13bc
+13c2 : 85 1c __ STA ACCU + 1
+13c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+13c7 : b1 19 __ LDA (IP + 0),y
+13c9 : aa __ __ TAX
+13ca : 38 __ __ SEC
+13cb : b5 01 __ LDA $01,x
+13cd : e5 1c __ SBC ACCU + 1
+13cf : f0 11 __ BEQ $13e2
+13d1 : 50 02 __ BVC $13d5
+13d3 : 49 80 __ EOR #$80
+13d5 : 30 2a __ BMI $1401
+13d7 : 10 33 __ BPL $140c
+13d9 : b1 19 __ LDA (IP + 0),y
+13db : aa __ __ TAX
+13dc : b5 01 __ LDA $01,x
+13de : c5 1c __ CMP ACCU + 1
+13e0 : d0 28 __ BNE $140a
+13e2 : b5 00 __ LDA $00,x
+13e4 : c5 1b __ CMP ACCU + 0
+13e6 : d0 22 __ BNE $140a
+13e8 : f0 0e __ BEQ $13f8
+13ea : b1 19 __ LDA (IP + 0),y
+13ec : aa __ __ TAX
+13ed : c8 __ __ INY
+13ee : b1 19 __ LDA (IP + 0),y
+13f0 : c5 1c __ CMP ACCU + 1
+13f2 : d0 16 __ BNE $140a
+13f4 : e4 1b __ CPX ACCU + 0
+13f6 : d0 12 __ BNE $140a
+13f8 : a9 00 __ LDA #$00
+13fa : 85 1b __ STA ACCU + 0
+13fc : 85 1c __ STA ACCU + 1
+13fe : 4c 50 08 JMP $0850 ; (startup + 79)
+1401 : a9 ff __ LDA #$ff
+1403 : 85 1b __ STA ACCU + 0
+1405 : 85 1c __ STA ACCU + 1
+1407 : 4c 50 08 JMP $0850 ; (startup + 79)
+140a : 90 f5 __ BCC $1401
+140c : a9 01 __ LDA #$01
+140e : 85 1b __ STA ACCU + 0
+1410 : a9 00 __ LDA #$00
+1412 : 85 1c __ STA ACCU + 1
+1414 : 4c 50 08 JMP $0850 ; (startup + 79)
+1417 : b1 19 __ LDA (IP + 0),y
+1419 : c8 __ __ INY
+141a : aa __ __ TAX
+141b : b1 19 __ LDA (IP + 0),y
+141d : 38 __ __ SEC
+141e : e5 1c __ SBC ACCU + 1
+1420 : d0 af __ BNE $13d1
+1422 : e4 1b __ CPX ACCU + 0
+1424 : d0 e4 __ BNE $140a
+1426 : f0 d0 __ BEQ $13f8
+1428 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1429 : b1 19 __ LDA (IP + 0),y
+142b : aa __ __ TAX
+142c : 38 __ __ SEC
+142d : b5 00 __ LDA $00,x
+142f : e5 1b __ SBC ACCU + 0
+1431 : f0 19 __ BEQ $144c
+1433 : 50 02 __ BVC $1437
+1435 : 49 80 __ EOR #$80
+1437 : 30 1c __ BMI $1455
+1439 : 10 25 __ BPL $1460
+143b : b1 19 __ LDA (IP + 0),y
+143d : aa __ __ TAX
+143e : b5 00 __ LDA $00,x
+1440 : c5 1b __ CMP ACCU + 0
+1442 : d0 1a __ BNE $145e
+1444 : f0 06 __ BEQ $144c
+1446 : b1 19 __ LDA (IP + 0),y
+1448 : c5 1b __ CMP ACCU + 0
+144a : d0 12 __ BNE $145e
+144c : a9 00 __ LDA #$00
+144e : 85 1b __ STA ACCU + 0
+1450 : 85 1c __ STA ACCU + 1
+1452 : 4c 50 08 JMP $0850 ; (startup + 79)
+1455 : a9 ff __ LDA #$ff
+1457 : 85 1b __ STA ACCU + 0
+1459 : 85 1c __ STA ACCU + 1
+145b : 4c 50 08 JMP $0850 ; (startup + 79)
+145e : 90 f5 __ BCC $1455
+1460 : a9 01 __ LDA #$01
+1462 : 85 1b __ STA ACCU + 0
+1464 : a9 00 __ LDA #$00
+1466 : 85 1c __ STA ACCU + 1
+1468 : 4c 50 08 JMP $0850 ; (startup + 79)
+146b : b1 19 __ LDA (IP + 0),y
+146d : 38 __ __ SEC
+146e : e5 1b __ SBC ACCU + 0
+1470 : d0 c1 __ BNE $1433
+1472 : f0 d8 __ BEQ $144c
+1474 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+1475 : b1 19 __ LDA (IP + 0),y
+1477 : 30 0c __ BMI $1485
+1479 : 38 __ __ SEC
+147a : 65 19 __ ADC IP + 0
+147c : 85 19 __ STA IP + 0
+147e : 90 02 __ BCC $1482
+1480 : e6 1a __ INC IP + 1
+1482 : 4c 51 08 JMP $0851 ; (startup + 80)
+1485 : 38 __ __ SEC
+1486 : 65 19 __ ADC IP + 0
+1488 : 85 19 __ STA IP + 0
+148a : b0 02 __ BCS $148e
+148c : c6 1a __ DEC IP + 1
+148e : 4c 51 08 JMP $0851 ; (startup + 80)
+1491 : a5 1b __ LDA ACCU + 0
+1493 : 05 1c __ ORA ACCU + 1
+1495 : f0 de __ BEQ $1475
+1497 : 4c 50 08 JMP $0850 ; (startup + 79)
+149a : a5 1b __ LDA ACCU + 0
+149c : 05 1c __ ORA ACCU + 1
+149e : d0 d5 __ BNE $1475
+14a0 : 4c 50 08 JMP $0850 ; (startup + 79)
+14a3 : a5 1c __ LDA ACCU + 1
+14a5 : 30 04 __ BMI $14ab
+14a7 : 05 1b __ ORA ACCU + 0
+14a9 : d0 ca __ BNE $1475
+14ab : 4c 50 08 JMP $0850 ; (startup + 79)
+14ae : a5 1c __ LDA ACCU + 1
+14b0 : 10 c3 __ BPL $1475
+14b2 : 4c 50 08 JMP $0850 ; (startup + 79)
+14b5 : a5 1c __ LDA ACCU + 1
+14b7 : 30 bc __ BMI $1475
+14b9 : 4c 50 08 JMP $0850 ; (startup + 79)
+14bc : a5 1c __ LDA ACCU + 1
+14be : 30 b5 __ BMI $1475
+14c0 : 05 1b __ ORA ACCU + 0
+14c2 : f0 b1 __ BEQ $1475
+14c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+14c7 : 38 __ __ SEC
+14c8 : b1 19 __ LDA (IP + 0),y
+14ca : 65 19 __ ADC IP + 0
+14cc : aa __ __ TAX
+14cd : c8 __ __ INY
+14ce : b1 19 __ LDA (IP + 0),y
+14d0 : 65 1a __ ADC IP + 1
+14d2 : 85 1a __ STA IP + 1
+14d4 : 86 19 __ STX IP + 0
+14d6 : 4c 51 08 JMP $0851 ; (startup + 80)
+14d9 : a5 1b __ LDA ACCU + 0
+14db : 05 1c __ ORA ACCU + 1
+14dd : f0 e8 __ BEQ $14c7
+14df : c8 __ __ INY
+14e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+14e3 : a5 1b __ LDA ACCU + 0
+14e5 : 05 1c __ ORA ACCU + 1
+14e7 : d0 de __ BNE $14c7
+14e9 : c8 __ __ INY
+14ea : 4c 50 08 JMP $0850 ; (startup + 79)
+14ed : a5 1c __ LDA ACCU + 1
+14ef : 30 04 __ BMI $14f5
+14f1 : 05 1b __ ORA ACCU + 0
+14f3 : d0 d2 __ BNE $14c7
+14f5 : c8 __ __ INY
+14f6 : 4c 50 08 JMP $0850 ; (startup + 79)
+14f9 : a5 1c __ LDA ACCU + 1
+14fb : 10 ca __ BPL $14c7
+14fd : c8 __ __ INY
+14fe : 4c 50 08 JMP $0850 ; (startup + 79)
+1501 : a5 1c __ LDA ACCU + 1
+1503 : 30 c2 __ BMI $14c7
+1505 : c8 __ __ INY
+1506 : 4c 50 08 JMP $0850 ; (startup + 79)
+1509 : a5 1c __ LDA ACCU + 1
+150b : 30 ba __ BMI $14c7
+150d : 05 1b __ ORA ACCU + 0
+150f : f0 b6 __ BEQ $14c7
+1511 : c8 __ __ INY
+1512 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+1515 : a9 00 __ LDA #$00
+1517 : 2c a9 01 BIT $01a9 
+151a : 85 1b __ STA ACCU + 0
+151c : a9 00 __ LDA #$00
+151e : 85 1c __ STA ACCU + 1
+1520 : 4c 51 08 JMP $0851 ; (startup + 80)
+1523 : a5 1b __ LDA ACCU + 0
+1525 : 05 1c __ ORA ACCU + 1
+1527 : f0 ef __ BEQ $1518
+1529 : d0 ea __ BNE $1515
+152b : a5 1b __ LDA ACCU + 0
+152d : 05 1c __ ORA ACCU + 1
+152f : d0 e7 __ BNE $1518
+1531 : f0 e2 __ BEQ $1515
+1533 : a5 1c __ LDA ACCU + 1
+1535 : 30 de __ BMI $1515
+1537 : 05 1b __ ORA ACCU + 0
+1539 : d0 dd __ BNE $1518
+153b : f0 d8 __ BEQ $1515
+153d : a5 1c __ LDA ACCU + 1
+153f : 10 d7 __ BPL $1518
+1541 : 30 d2 __ BMI $1515
+1543 : a5 1c __ LDA ACCU + 1
+1545 : 30 d1 __ BMI $1518
+1547 : 10 cc __ BPL $1515
+1549 : a5 1c __ LDA ACCU + 1
+154b : 30 cb __ BMI $1518
+154d : 05 1b __ ORA ACCU + 0
+154f : f0 c7 __ BEQ $1518
+1551 : d0 c2 __ BNE $1515
+1553 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+1554 : b1 19 __ LDA (IP + 0),y
+1556 : 8d 6a 15 STA $156a ; (inp_jsr + 22)
+1559 : c8 __ __ INY
+155a : b1 19 __ LDA (IP + 0),y
+155c : 8d 6b 15 STA $156b ; (inp_jsr + 23)
+155f : 98 __ __ TYA
+1560 : 38 __ __ SEC
+1561 : 65 19 __ ADC IP + 0
+1563 : 85 19 __ STA IP + 0
+1565 : 90 02 __ BCC $1569
+1567 : e6 1a __ INC IP + 1
+1569 : 20 00 00 JSR $0000 
+156c : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+156f : 98 __ __ TYA
+1570 : 18 __ __ CLC
+1571 : 65 19 __ ADC IP + 0
+1573 : 8d 7e 15 STA $157e ; (inp_native + 15)
+1576 : a5 1a __ LDA IP + 1
+1578 : 69 00 __ ADC #$00
+157a : 8d 7f 15 STA $157f ; (inp_native + 16)
+157d : 20 00 00 JSR $0000 
+1580 : a0 00 __ LDY #$00
+1582 : b1 23 __ LDA (SP + 0),y
+1584 : 85 19 __ STA IP + 0
+1586 : c8 __ __ INY
+1587 : b1 23 __ LDA (SP + 0),y
+1589 : 85 1a __ STA IP + 1
+158b : 88 __ __ DEY
+158c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+158f : 38 __ __ SEC
+1590 : a5 23 __ LDA SP + 0
+1592 : f1 19 __ SBC (IP + 0),y
+1594 : c8 __ __ INY
+1595 : 85 23 __ STA SP + 0
+1597 : a5 24 __ LDA SP + 1
+1599 : f1 19 __ SBC (IP + 0),y
+159b : c8 __ __ INY
+159c : 85 24 __ STA SP + 1
+159e : b1 19 __ LDA (IP + 0),y
+15a0 : 84 02 __ STY $02
+15a2 : a8 __ __ TAY
+15a3 : a5 25 __ LDA FP + 0
+15a5 : 91 23 __ STA (SP + 0),y
+15a7 : c8 __ __ INY
+15a8 : a5 26 __ LDA FP + 1
+15aa : 91 23 __ STA (SP + 0),y
+15ac : 98 __ __ TYA
+15ad : 38 __ __ SEC
+15ae : 65 23 __ ADC SP + 0
+15b0 : 85 25 __ STA FP + 0
+15b2 : a9 00 __ LDA #$00
+15b4 : 65 24 __ ADC SP + 1
+15b6 : 85 26 __ STA FP + 1
+15b8 : 88 __ __ DEY
+15b9 : f0 08 __ BEQ $15c3
+15bb : b9 52 00 LDA $0052,y 
+15be : 88 __ __ DEY
+15bf : 91 23 __ STA (SP + 0),y
+15c1 : d0 f8 __ BNE $15bb
+15c3 : a4 02 __ LDY $02
+15c5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+15c8 : b1 19 __ LDA (IP + 0),y
+15ca : c8 __ __ INY
+15cb : 84 02 __ STY $02
+15cd : a8 __ __ TAY
+15ce : b1 23 __ LDA (SP + 0),y
+15d0 : 85 25 __ STA FP + 0
+15d2 : c8 __ __ INY
+15d3 : b1 23 __ LDA (SP + 0),y
+15d5 : 85 26 __ STA FP + 1
+15d7 : 88 __ __ DEY
+15d8 : f0 09 __ BEQ $15e3
+15da : 88 __ __ DEY
+15db : b1 23 __ LDA (SP + 0),y
+15dd : 99 53 00 STA $0053,y 
+15e0 : 88 __ __ DEY
+15e1 : 10 f8 __ BPL $15db
+15e3 : a4 02 __ LDY $02
+15e5 : 18 __ __ CLC
+15e6 : b1 19 __ LDA (IP + 0),y
+15e8 : c8 __ __ INY
+15e9 : 65 23 __ ADC SP + 0
+15eb : 85 23 __ STA SP + 0
+15ed : b1 19 __ LDA (IP + 0),y
+15ef : c8 __ __ INY
+15f0 : 65 24 __ ADC SP + 1
+15f2 : 85 24 __ STA SP + 1
+15f4 : a0 01 __ LDY #$01
+15f6 : b1 23 __ LDA (SP + 0),y
+15f8 : 85 1a __ STA IP + 1
+15fa : 88 __ __ DEY
+15fb : b1 23 __ LDA (SP + 0),y
+15fd : 85 19 __ STA IP + 0
+15ff : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+1602 : b1 19 __ LDA (IP + 0),y
+1604 : 85 1f __ STA ADDR + 0
+1606 : c8 __ __ INY
+1607 : b1 19 __ LDA (IP + 0),y
+1609 : 85 20 __ STA ADDR + 1
+160b : c8 __ __ INY
+160c : 98 __ __ TYA
+160d : a0 00 __ LDY #$00
+160f : 18 __ __ CLC
+1610 : 65 19 __ ADC IP + 0
+1612 : 91 23 __ STA (SP + 0),y
+1614 : c8 __ __ INY
+1615 : a5 1a __ LDA IP + 1
+1617 : 69 00 __ ADC #$00
+1619 : 91 23 __ STA (SP + 0),y
+161b : a5 1f __ LDA ADDR + 0
+161d : 85 19 __ STA IP + 0
+161f : a5 20 __ LDA ADDR + 1
+1621 : 85 1a __ STA IP + 1
+1623 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+1626 : 38 __ __ SEC
+1627 : a5 23 __ LDA SP + 0
+1629 : f1 19 __ SBC (IP + 0),y
+162b : c8 __ __ INY
+162c : 85 23 __ STA SP + 0
+162e : a5 24 __ LDA SP + 1
+1630 : f1 19 __ SBC (IP + 0),y
+1632 : 85 24 __ STA SP + 1
+1634 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+1637 : 18 __ __ CLC
+1638 : b1 19 __ LDA (IP + 0),y
+163a : c8 __ __ INY
+163b : 65 23 __ ADC SP + 0
+163d : 85 23 __ STA SP + 0
+163f : b1 19 __ LDA (IP + 0),y
+1641 : 65 24 __ ADC SP + 1
+1643 : 85 24 __ STA SP + 1
+1645 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+1648 : b1 19 __ LDA (IP + 0),y
+164a : 84 02 __ STY $02
+164c : a8 __ __ TAY
+164d : 88 __ __ DEY
+164e : f0 07 __ BEQ $1657
+1650 : b1 1b __ LDA (ACCU + 0),y
+1652 : 91 1f __ STA (ADDR + 0),y
+1654 : 88 __ __ DEY
+1655 : d0 f9 __ BNE $1650
+1657 : b1 1b __ LDA (ACCU + 0),y
+1659 : 91 1f __ STA (ADDR + 0),y
+165b : a4 02 __ LDY $02
+165d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+1660 : 84 02 __ STY $02
+1662 : a0 ff __ LDY #$ff
+1664 : c8 __ __ INY
+1665 : b1 1b __ LDA (ACCU + 0),y
+1667 : 91 1f __ STA (ADDR + 0),y
+1669 : d0 f9 __ BNE $1664
+166b : a4 02 __ LDY $02
+166d : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,1386 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e e8 14 STX $14e8 ; (spentry + 0)
+0811 : a9 e9 __ LDA #$e9
+0813 : 85 19 __ STA IP + 0
+0815 : a9 14 __ LDA #$14
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 29 __ LDA #$29
+081c : e9 14 __ SBC #$14
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 28 __ LDA #$28
+0832 : e9 e9 __ SBC #$e9
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 67
+0a04:	PUSH	#$0004
+0a07:	LEA	T0, Next_Glob_Rec + 0
+0a0b:	MOV	Next_Ptr_Glob + 0, T0
+0a0f:	LEA	T1, Glob_Rec + 0
+0a13:	MOV	Ptr_Glob + 0, T1
+0a17:	MOV	Glob_Rec + 0, T0
+0a1b:	MOV	ACCU, #0
+0a1e:	MOVB	Glob_Rec + 2, ACCU
+0a22:	MOV	ACCU, #2
+0a25:	MOVB	Glob_Rec + 3, ACCU
+0a29:	MOV	ACCU, #40
+0a2c:	MOV	Glob_Rec + 4, ACCU
+0a30:	LEA	ADDR, Glob_Rec + 6
+0a34:	LEA	ACCU, $0d14
+0a38:	STRCPY
+0a39:	LEA	ADDR, 3(FP)
+0a3d:	LEA	ACCU, $0d33
+0a41:	STRCPY
+0a42:	MOV	ACCU, #10
+0a45:	MOV	Arr_2_Glob + 814, ACCU
+0a49:	MOV	T0, #1
+0a4c:	MOV	ACCU, #65
+0a4f:	MOVB	Ch_1_Glob + 0, ACCU
+0a53:	MOV	ACCU, #1
+0a56:	MOVB	Bool_Glob + 0, ACCU
+0a5a:	MOV	ACCU, #66
+0a5d:	MOVB	Ch_2_Glob + 0, ACCU
+0a61:	LEA	ADDR, 34(FP)
+0a65:	LEA	ACCU, $0d52
+0a69:	STRCPY
+0a6a:	MOV	ACCU, #1
+0a6d:	MOVB	2(FP), ACCU
+0a70:	MOV	T1, #3
+0a73:	LEA	T2, 3(FP)
+0a77:	LEA	T3, 34(FP)
+0a7b:	MOV	T4, #2
+0a7e:	MOV	ACCU, T2
+0a80:	LEAX	ADDR, T4 + ACCU
+0a82:	MOVB	P0, 0(ADDR)
+0a85:	MOV	ACCU, T3
+0a87:	ADD	T4, ACCU
+0a89:	MOV	ADDR, T4
+0a8b:	MOVB	P1, 1(ADDR)
+0a8e:	CALL	Func_1 + 0
+0a91:	MOVB	ACCU, ACCU
+0a93:	BNE	$0A7B
+0a95:	MOV	ACCU, T2
+0a97:	MOV	P0, ACCU
+0a99:	MOV	ACCU, T3
+0a9b:	MOV	P2, ACCU
+0a9d:	JSR	strcmp + 0
+0aa0:	BGT	$0AA7
+0aa2:	MOV	ACCU, #1
+0aa5:	JUMP	$0AB1
+0aa7:	MOV	ACCU, #10
+0aaa:	MOV	Int_Glob + 0, ACCU
+0aae:	MOV	ACCU, #0
+0ab1:	MOVB	Bool_Glob + 0, ACCU
+0ab5:	MOV	ACCU, #7
+0ab8:	MOV	0(FP), ACCU
+0abb:	MOV	P0, #2
+0abe:	MOV	P2, #3
+0ac1:	LEA	P4, 0(FP)
+0ac5:	CALL	Proc_7 + 0
+0ac8:	MOV	T2, #6
+0acb:	LEAX	ADDR, Arr_1_Glob + 10 + T2
+0acf:	MOV	T4, 0(FP)
+0ad2:	MOV	0(ADDR), T4
+0ad5:	LEAX	ADDR, Arr_1_Glob + 12 + T2
+0ad9:	MOV	0(ADDR), T4
+0adc:	LEAX	ADDR, Arr_1_Glob + 70 + T2
+0ae0:	MOV	ACCU, #8
+0ae3:	MOV	0(ADDR), ACCU
+0ae6:	LEA	T2, Arr_1_Glob + 0
+0aea:	LEA	T3, Arr_2_Glob + 0
+0aee:	MOV	ACCU, T3
+0af0:	ADD	ACCU, #$0332
+0af4:	MOV	T4, ACCU
+0af6:	MOV	ACCU, T3
+0af8:	ADD	ACCU, #$0330
+0afc:	MOV	T5, ACCU
+0afe:	MOV	ACCU, #8
+0b01:	MOV	ADDR, T5
+0b03:	MOV	0(ADDR), ACCU
+0b06:	ADD	T5, #$0002
+0b0a:	MOV	ACCU, T4
+0b0c:	CMPU	ACCU, T5
+0b0e:	BLE	$0AFE
+0b10:	MOV	ACCU, #$032e
+0b14:	LEAX	ADDR, T3 + ACCU
+0b16:	MOV	T5, 0(ADDR)
+0b19:	ADD	T5, #$0001
+0b1d:	MOV	0(ADDR), T5
+0b20:	MOV	ACCU, #16
+0b23:	LEAX	ADDR, T2 + ACCU
+0b25:	MOV	T2, 0(ADDR)
+0b28:	MOV	ACCU, #$0b00
+0b2c:	ADD	T3, ACCU
+0b2e:	MOV	ADDR, T3
+0b30:	MOV	0(ADDR), T2
+0b33:	MOV	ACCU, #5
+0b36:	MOV	Int_Glob + 0, ACCU
+0b3a:	MOV	T2, Ptr_Glob + 0
+0b3e:	MOV	ADDR, T2
+0b40:	MOV	T3, 0(ADDR)
+0b43:	MOV	T4, 0(ADDR)
+0b46:	MOV	ADDR, T4
+0b48:	MOV	ACCU, T2
+0b4a:	COPY	#37
+0b4c:	MOV	ACCU, #5
+0b4f:	MOV	ADDR, T2
+0b51:	MOV	4(ADDR), ACCU
+0b54:	MOV	ADDR, T3
+0b56:	MOV	4(ADDR), ACCU
+0b59:	MOV	ADDR, T2
+0b5b:	MOV	T4, 0(ADDR)
+0b5e:	MOV	ADDR, T3
+0b60:	MOV	0(ADDR), T4
+0b63:	MOV	2(SP), T3
+0b66:	CALL	Proc_3 + 0
+0b69:	MOV	ADDR, T3
+0b6b:	MOVUB	ACCU, 2(ADDR)
+0b6e:	BEQ	$0B79
+0b70:	MOV	ADDR, T2
+0b72:	MOV	ACCU, 0(ADDR)
+0b75:	COPY	#37
+0b77:	JUMP	$0BAE
+0b79:	MOV	ACCU, #6
+0b7c:	MOV	4(ADDR), ACCU
+0b7f:	MOV	ADDR, T2
+0b81:	MOVB	P0, 3(ADDR)
+0b84:	MOV	ACCU, T3
+0b86:	ADD	ACCU, #$0003
+0b8a:	MOV	P1, ACCU
+0b8c:	CALL	Proc_6 + 0
+0b8f:	MOV	T2, Ptr_Glob + 0
+0b93:	MOV	ADDR, T2
+0b95:	MOV	T2, 0(ADDR)
+0b98:	MOV	ADDR, T3
+0b9a:	MOV	0(ADDR), T2
+0b9d:	MOV	P0, 4(ADDR)
+0ba0:	MOV	P2, #10
+0ba3:	MOV	ACCU, T3
+0ba5:	ADD	ACCU, #$0004
+0ba9:	MOV	P4, ACCU
+0bab:	CALL	Proc_7 + 0
+0bae:	MOVB	T6, #65
+0bb1:	MOVUB	ACCU, Ch_2_Glob + 0
+0bb5:	CMPUB	ACCU, #$0041
+0bb7:	BLEF	$0CD4
+0bba:	MOVB	T6, Ch_1_Glob + 0
+0bbe:	MUL	T1, #3
+0bc1:	MOV	T2, 0(FP)
+0bc4:	MOV	ACCU, T1
+0bc6:	DIVS	ACCU, T2
+0bc8:	MOV	T3, ACCU
+0bca:	ADD	ACCU, #$000A
+0bce:	MOV	T4, ACCU
+0bd0:	MOV	ACCU, T1
+0bd2:	SUB	ACCU, T2
+0bd4:	MUL	ACCU, #7
+0bd7:	SUB	ACCU, T3
+0bd9:	MOV	T1, ACCU
+0bdb:	MOVB	ACCU, T6
+0bdd:	CMPUB	ACCU, #$0041
+0bdf:	BEQ	$0BEE
+0be1:	MOVUB	ACCU, Ch_1_Glob + 0
+0be5:	CMPUB	ACCU, #$0041
+0be7:	SEQ
+0be8:	MOVB	T6, ACCU
+0bea:	MOVB	ACCU, T6
+0bec:	BEQ	$0BEA
+0bee:	ADD	T0, #$0001
+0bf2:	MOV	ACCU, T0
+0bf4:	CMPS	ACCU, #$01F4
+0bf7:	BGEF	$0A4C
+0bfa:	MOV	ACCU, Int_Glob + 0
+0bfe:	CMPU	ACCU, #$0005
+0c01:	BNEF	$0CCF
+0c04:	MOVUB	ACCU, Bool_Glob + 0
+0c08:	BEQF	$0CCF
+0c0b:	MOVUB	ACCU, Ch_1_Glob + 0
+0c0f:	CMPUB	ACCU, #$0041
+0c11:	BNEF	$0CCF
+0c14:	MOVUB	ACCU, Ch_2_Glob + 0
+0c18:	CMPUB	ACCU, #$0042
+0c1a:	BNEF	$0CCF
+0c1d:	MOV	ACCU, Arr_1_Glob + 16
+0c21:	CMPU	ACCU, #$0007
+0c24:	BNEF	$0CCA
+0c27:	MOV	ACCU, Arr_2_Glob + 814
+0c2b:	CMPU	ACCU, #$01FE
+0c2e:	BNEF	$0CCA
+0c31:	MOV	T0, Ptr_Glob + 0
+0c35:	MOV	ADDR, T0
+0c37:	MOVUB	ACCU, 2(ADDR)
+0c3a:	BNEF	$0CC5
+0c3d:	MOVUB	ACCU, 3(ADDR)
+0c40:	CMPUB	ACCU, #$0002
+0c42:	BNEF	$0CC5
+0c45:	MOV	ACCU, 4(ADDR)
+0c48:	CMPU	ACCU, #$0011
+0c4b:	BNE	$0CC5
+0c4d:	MOV	T2, Next_Ptr_Glob + 0
+0c51:	MOV	ADDR, T2
+0c53:	MOVUB	ACCU, 2(ADDR)
+0c56:	BNE	$0CC0
+0c58:	MOVUB	ACCU, 3(ADDR)
+0c5b:	CMPUB	ACCU, #$0001
+0c5d:	BNE	$0CC0
+0c5f:	MOV	ACCU, 4(ADDR)
+0c62:	CMPU	ACCU, #$0012
+0c65:	BNE	$0CC0
+0c67:	MOV	ACCU, T4
+0c69:	ADD	ACCU, #$FFFF
+0c6d:	MOV	T3, Int_Glob + 0
+0c71:	SUB	ACCU, T3
+0c73:	CMPU	ACCU, #$0005
+0c76:	BNE	$0CBB
+0c78:	MOV	ACCU, T1
+0c7a:	CMPU	ACCU, #$000D
+0c7d:	BNE	$0CBB
+0c7f:	MOV	ACCU, 0(FP)
+0c82:	CMPU	ACCU, #$0007
+0c85:	BNE	$0CBB
+0c87:	MOVUB	ACCU, 2(FP)
+0c8a:	CMPUB	ACCU, #$0001
+0c8c:	BNE	$0CBB
+0c8e:	ADD	T0, #$0006
+0c92:	MOV	ACCU, T0
+0c94:	MOV	P0, ACCU
+0c96:	LEA	P2, $0e9c
+0c9a:	JSR	strcmp + 0
+0c9d:	BNE	$0CB1
+0c9f:	LEA	P0, 34(FP)
+0ca3:	LEA	P2, $0ebb
+0ca7:	JSR	strcmp + 0
+0caa:	BNE	$0CB1
+0cac:	MOV	ACCU, #0
+0caf:	JUMP	$0CB4
+0cb1:	MOV	ACCU, #6
+0cb4:	POP	#$0004
+0cb7:	RETURN	0, 67
+0cbb:	MOV	ACCU, #5
+0cbe:	JUMP	$0CB4
+0cc0:	MOV	ACCU, #4
+0cc3:	JUMP	$0CB4
+0cc5:	MOV	ACCU, #3
+0cc8:	JUMP	$0CB4
+0cca:	MOV	ACCU, #2
+0ccd:	JUMP	$0CB4
+0ccf:	MOV	ACCU, #1
+0cd2:	JUMP	$0CB4
+0cd4:	MOVB	T7, 2(FP)
+0cd7:	MOVB	ACCU, T6
+0cd9:	MOVB	P0, ACCU
+0cdb:	MOVB	P1, #67
+0cde:	CALL	Func_1 + 0
+0ce1:	CMPUB	ACCU, T7
+0ce3:	BNE	$0D04
+0ce5:	LEA	T1, 2(FP)
+0ce9:	MOVB	P0, #0
+0cec:	MOV	ACCU, T1
+0cee:	MOV	P1, ACCU
+0cf0:	CALL	Proc_6 + 0
+0cf3:	LEA	ADDR, 34(FP)
+0cf7:	LEA	ACCU, $0e7d
+0cfb:	STRCPY
+0cfc:	MOV	Int_Glob + 0, T0
+0d00:	MOV	ACCU, T0
+0d02:	MOV	T1, ACCU
+0d04:	MOVB	T7, Ch_2_Glob + 0
+0d08:	ADDB	T6, #$0001
+0d0b:	MOVB	ACCU, T7
+0d0d:	CMPUB	ACCU, T6
+0d0f:	BLE	$0CD4
+0d11:	JUMPF	$0BBA
+--------------------------------------------------------------------
+Func_1:
+0d71:	ENTER	0, 2
+0d75:	MOVB	ACCU, P0
+0d77:	MOVB	T0, ACCU
+0d79:	MOVB	ACCU, P1
+0d7b:	CMPUB	ACCU, T0
+0d7d:	BNE	$0D88
+0d7f:	MOVB	Ch_1_Glob + 0, T0
+0d83:	MOV	ACCU, #1
+0d86:	JUMP	$0D8B
+0d88:	MOV	ACCU, #0
+0d8b:	RETURN	0, 2
+--------------------------------------------------------------------
+strcmp:
+0d8f : ea __ __ NOP
+0d90 : a0 00 __ LDY #$00
+0d92 : 84 1c __ STY ACCU + 1
+0d94 : b1 0d __ LDA (P0),y
+0d96 : f0 16 __ BEQ $0dae
+0d98 : d1 0f __ CMP (P2),y
+0d9a : d0 16 __ BNE $0db2
+0d9c : c8 __ __ INY
+0d9d : b1 0d __ LDA (P0),y
+0d9f : f0 0d __ BEQ $0dae
+0da1 : d1 0f __ CMP (P2),y
+0da3 : d0 0d __ BNE $0db2
+0da5 : c8 __ __ INY
+0da6 : d0 ec __ BNE $0d94
+0da8 : e6 0e __ INC P1
+0daa : e6 10 __ INC P3
+0dac : d0 e6 __ BNE $0d94
+0dae : d1 0f __ CMP (P2),y
+0db0 : f0 0a __ BEQ $0dbc
+0db2 : b0 06 __ BCS $0dba
+0db4 : a9 ff __ LDA #$ff
+0db6 : 85 1c __ STA ACCU + 1
+0db8 : 30 02 __ BMI $0dbc
+0dba : a9 01 __ LDA #$01
+0dbc : 85 1b __ STA ACCU + 0
+0dbe : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0dbf:	ENTER	0, 2
+0dc3:	MOV	ACCU, P0
+0dc5:	MOV	T0, ACCU
+0dc7:	ADD	T0, #$0002
+0dcb:	MOV	ACCU, P2
+0dcd:	ADD	T0, ACCU
+0dcf:	MOV	ADDR, P4
+0dd1:	MOV	0(ADDR), T0
+0dd4:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_3:
+0dd8:	ENTER	0, 2
+0ddc:	PUSH	#$0002
+0ddf:	MOV	T0, Ptr_Glob + 0
+0de3:	MOV	ACCU, T0
+0de5:	BEQ	$0DF2
+0de7:	MOV	ADDR, T0
+0de9:	MOV	T1, 0(ADDR)
+0dec:	MOV	ADDR, 2(FP)
+0def:	MOV	0(ADDR), T1
+0df2:	MOV	P0, #10
+0df5:	MOV	P2, Int_Glob + 0
+0df9:	ADD	T0, #$0004
+0dfd:	MOV	ACCU, T0
+0dff:	MOV	P4, ACCU
+0e01:	CALL	Proc_7 + 0
+0e04:	POP	#$0002
+0e07:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_6:
+0e0b:	ENTER	0, 2
+0e0f:	MOVB	ACCU, P0
+0e11:	MOVB	T0, ACCU
+0e13:	MOV	ACCU, P1
+0e15:	MOV	T1, ACCU
+0e17:	MOV	ADDR, T1
+0e19:	MOVB	0(ADDR), T0
+0e1c:	MOVB	ACCU, T0
+0e1e:	CMPUB	ACCU, #$0002
+0e20:	BEQ	$0E28
+0e22:	MOV	ACCU, #3
+0e25:	MOVB	0(ADDR), ACCU
+0e28:	MOVB	ACCU, T0
+0e2a:	CMPUB	ACCU, #$0003
+0e2c:	BEQ	$0E42
+0e2e:	MOVB	ACCU, T0
+0e30:	CMPUB	ACCU, #$0003
+0e32:	BGT	$0E46
+0e34:	MOVB	ACCU, T0
+0e36:	CMPUB	ACCU, #$0004
+0e38:	BNE	$0E42
+0e3a:	MOV	ACCU, #2
+0e3d:	MOV	ADDR, T1
+0e3f:	MOVB	0(ADDR), ACCU
+0e42:	RETURN	0, 2
+0e46:	MOVB	ACCU, T0
+0e48:	BEQ	$0E73
+0e4a:	MOVB	ACCU, T0
+0e4c:	CMPUB	ACCU, #$0001
+0e4e:	BEQ	$0E60
+0e50:	MOVB	ACCU, T0
+0e52:	CMPUB	ACCU, #$0002
+0e54:	BNE	$0E42
+0e56:	MOV	ACCU, #1
+0e59:	MOV	ADDR, T1
+0e5b:	MOVB	0(ADDR), ACCU
+0e5e:	JUMP	$0E42
+0e60:	MOV	ACCU, Int_Glob + 0
+0e64:	CMPS	ACCU, #$0064
+0e67:	BLT	$0E73
+0e69:	MOV	ACCU, #3
+0e6c:	MOV	ADDR, T1
+0e6e:	MOVB	0(ADDR), ACCU
+0e71:	JUMP	$0E42
+0e73:	MOV	ACCU, #0
+0e76:	MOV	ADDR, T1
+0e78:	MOVB	0(ADDR), ACCU
+0e7b:	JUMP	$0E42
+--------------------------------------------------------------------
+negaccu:
+0eda : 38 __ __ SEC
+0edb : a9 00 __ LDA #$00
+0edd : e5 1b __ SBC ACCU + 0
+0edf : 85 1b __ STA ACCU + 0
+0ee1 : a9 00 __ LDA #$00
+0ee3 : e5 1c __ SBC ACCU + 1
+0ee5 : 85 1c __ STA ACCU + 1
+0ee7 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0ee8 : 38 __ __ SEC
+0ee9 : a9 00 __ LDA #$00
+0eeb : e5 03 __ SBC $03
+0eed : 85 03 __ STA $03
+0eef : a9 00 __ LDA #$00
+0ef1 : e5 04 __ SBC $04
+0ef3 : 85 04 __ STA $04
+0ef5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0ef6 : a5 1c __ LDA ACCU + 1
+0ef8 : d0 31 __ BNE $0f2b
+0efa : a5 04 __ LDA $04
+0efc : d0 1e __ BNE $0f1c
+0efe : 85 06 __ STA $06
+0f00 : a2 04 __ LDX #$04
+0f02 : 06 1b __ ASL ACCU + 0
+0f04 : 2a __ __ ROL
+0f05 : c5 03 __ CMP $03
+0f07 : 90 02 __ BCC $0f0b
+0f09 : e5 03 __ SBC $03
+0f0b : 26 1b __ ROL ACCU + 0
+0f0d : 2a __ __ ROL
+0f0e : c5 03 __ CMP $03
+0f10 : 90 02 __ BCC $0f14
+0f12 : e5 03 __ SBC $03
+0f14 : 26 1b __ ROL ACCU + 0
+0f16 : ca __ __ DEX
+0f17 : d0 eb __ BNE $0f04
+0f19 : 85 05 __ STA $05
+0f1b : 60 __ __ RTS
+0f1c : a5 1b __ LDA ACCU + 0
+0f1e : 85 05 __ STA $05
+0f20 : a5 1c __ LDA ACCU + 1
+0f22 : 85 06 __ STA $06
+0f24 : a9 00 __ LDA #$00
+0f26 : 85 1b __ STA ACCU + 0
+0f28 : 85 1c __ STA ACCU + 1
+0f2a : 60 __ __ RTS
+0f2b : a5 04 __ LDA $04
+0f2d : d0 1f __ BNE $0f4e
+0f2f : a5 03 __ LDA $03
+0f31 : 30 1b __ BMI $0f4e
+0f33 : a9 00 __ LDA #$00
+0f35 : 85 06 __ STA $06
+0f37 : a2 10 __ LDX #$10
+0f39 : 06 1b __ ASL ACCU + 0
+0f3b : 26 1c __ ROL ACCU + 1
+0f3d : 2a __ __ ROL
+0f3e : c5 03 __ CMP $03
+0f40 : 90 02 __ BCC $0f44
+0f42 : e5 03 __ SBC $03
+0f44 : 26 1b __ ROL ACCU + 0
+0f46 : 26 1c __ ROL ACCU + 1
+0f48 : ca __ __ DEX
+0f49 : d0 f2 __ BNE $0f3d
+0f4b : 85 05 __ STA $05
+0f4d : 60 __ __ RTS
+0f4e : a9 00 __ LDA #$00
+0f50 : 85 05 __ STA $05
+0f52 : 85 06 __ STA $06
+0f54 : 84 02 __ STY $02
+0f56 : a0 10 __ LDY #$10
+0f58 : 18 __ __ CLC
+0f59 : 26 1b __ ROL ACCU + 0
+0f5b : 26 1c __ ROL ACCU + 1
+0f5d : 26 05 __ ROL $05
+0f5f : 26 06 __ ROL $06
+0f61 : 38 __ __ SEC
+0f62 : a5 05 __ LDA $05
+0f64 : e5 03 __ SBC $03
+0f66 : aa __ __ TAX
+0f67 : a5 06 __ LDA $06
+0f69 : e5 04 __ SBC $04
+0f6b : 90 04 __ BCC $0f71
+0f6d : 86 05 __ STX $05
+0f6f : 85 06 __ STA $06
+0f71 : 88 __ __ DEY
+0f72 : d0 e5 __ BNE $0f59
+0f74 : 26 1b __ ROL ACCU + 0
+0f76 : 26 1c __ ROL ACCU + 1
+0f78 : a4 02 __ LDY $02
+0f7a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0f7b : a9 4c __ LDA #$4c
+0f7d : 85 54 __ STA $54
+0f7f : a9 00 __ LDA #$00
+0f81 : 85 13 __ STA P6
+0f83 : a9 19 __ LDA #$19
+0f85 : 85 16 __ STA P9
+0f87 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+0f88 : b1 19 __ LDA (IP + 0),y
+0f8a : aa __ __ TAX
+0f8b : c8 __ __ INY
+0f8c : b1 19 __ LDA (IP + 0),y
+0f8e : 95 00 __ STA $00,x
+0f90 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+0f93 : b1 19 __ LDA (IP + 0),y
+0f95 : aa __ __ TAX
+0f96 : c8 __ __ INY
+0f97 : b1 19 __ LDA (IP + 0),y
+0f99 : 95 00 __ STA $00,x
+0f9b : a9 00 __ LDA #$00
+0f9d : 95 01 __ STA $01,x
+0f9f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+0fa2 : b1 19 __ LDA (IP + 0),y
+0fa4 : aa __ __ TAX
+0fa5 : c8 __ __ INY
+0fa6 : b1 19 __ LDA (IP + 0),y
+0fa8 : 95 00 __ STA $00,x
+0faa : c8 __ __ INY
+0fab : b1 19 __ LDA (IP + 0),y
+0fad : 95 01 __ STA $01,x
+0faf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0fb2 : b1 19 __ LDA (IP + 0),y
+0fb4 : aa __ __ TAX
+0fb5 : b5 00 __ LDA $00,x
+0fb7 : 85 1b __ STA ACCU + 0
+0fb9 : a9 00 __ LDA #$00
+0fbb : 85 1c __ STA ACCU + 1
+0fbd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+0fc0 : b1 19 __ LDA (IP + 0),y
+0fc2 : aa __ __ TAX
+0fc3 : a5 1b __ LDA ACCU + 0
+0fc5 : 95 00 __ STA $00,x
+0fc7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0fca : b1 19 __ LDA (IP + 0),y
+0fcc : aa __ __ TAX
+0fcd : b5 00 __ LDA $00,x
+0fcf : 85 1b __ STA ACCU + 0
+0fd1 : b5 01 __ LDA $01,x
+0fd3 : 85 1c __ STA ACCU + 1
+0fd5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0fd8 : b1 19 __ LDA (IP + 0),y
+0fda : aa __ __ TAX
+0fdb : a5 1b __ LDA ACCU + 0
+0fdd : 95 00 __ STA $00,x
+0fdf : a5 1c __ LDA ACCU + 1
+0fe1 : 95 01 __ STA $01,x
+0fe3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0fe6 : b1 19 __ LDA (IP + 0),y
+0fe8 : aa __ __ TAX
+0fe9 : b5 00 __ LDA $00,x
+0feb : 85 1f __ STA ADDR + 0
+0fed : b5 01 __ LDA $01,x
+0fef : 85 20 __ STA ADDR + 1
+0ff1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+0ff4 : b1 19 __ LDA (IP + 0),y
+0ff6 : 85 1f __ STA ADDR + 0
+0ff8 : c8 __ __ INY
+0ff9 : b1 19 __ LDA (IP + 0),y
+0ffb : 85 20 __ STA ADDR + 1
+0ffd : c8 __ __ INY
+0ffe : b1 19 __ LDA (IP + 0),y
+1000 : aa __ __ TAX
+1001 : 84 02 __ STY $02
+1003 : a0 00 __ LDY #$00
+1005 : b1 1f __ LDA (ADDR + 0),y
+1007 : 95 00 __ STA $00,x
+1009 : a4 02 __ LDY $02
+100b : 4c 50 08 JMP $0850 ; (startup + 79)
+100e : b1 19 __ LDA (IP + 0),y
+1010 : aa __ __ TAX
+1011 : c8 __ __ INY
+1012 : b1 19 __ LDA (IP + 0),y
+1014 : 84 02 __ STY $02
+1016 : a8 __ __ TAY
+1017 : 4c 05 10 JMP $1005 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+101a : b1 19 __ LDA (IP + 0),y
+101c : 85 1f __ STA ADDR + 0
+101e : c8 __ __ INY
+101f : b1 19 __ LDA (IP + 0),y
+1021 : 85 20 __ STA ADDR + 1
+1023 : c8 __ __ INY
+1024 : b1 19 __ LDA (IP + 0),y
+1026 : aa __ __ TAX
+1027 : 84 02 __ STY $02
+1029 : a0 00 __ LDY #$00
+102b : b1 1f __ LDA (ADDR + 0),y
+102d : 95 00 __ STA $00,x
+102f : a9 00 __ LDA #$00
+1031 : 95 01 __ STA $01,x
+1033 : a4 02 __ LDY $02
+1035 : 4c 50 08 JMP $0850 ; (startup + 79)
+1038 : b1 19 __ LDA (IP + 0),y
+103a : aa __ __ TAX
+103b : c8 __ __ INY
+103c : b1 19 __ LDA (IP + 0),y
+103e : 84 02 __ STY $02
+1040 : a8 __ __ TAY
+1041 : 4c 2b 10 JMP $102b ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1044 : b1 19 __ LDA (IP + 0),y
+1046 : 85 1f __ STA ADDR + 0
+1048 : c8 __ __ INY
+1049 : b1 19 __ LDA (IP + 0),y
+104b : 85 20 __ STA ADDR + 1
+104d : c8 __ __ INY
+104e : b1 19 __ LDA (IP + 0),y
+1050 : aa __ __ TAX
+1051 : 84 02 __ STY $02
+1053 : a0 00 __ LDY #$00
+1055 : b1 1f __ LDA (ADDR + 0),y
+1057 : 95 00 __ STA $00,x
+1059 : c8 __ __ INY
+105a : b1 1f __ LDA (ADDR + 0),y
+105c : 95 01 __ STA $01,x
+105e : a4 02 __ LDY $02
+1060 : 4c 50 08 JMP $0850 ; (startup + 79)
+1063 : b1 19 __ LDA (IP + 0),y
+1065 : aa __ __ TAX
+1066 : c8 __ __ INY
+1067 : b1 19 __ LDA (IP + 0),y
+1069 : 84 02 __ STY $02
+106b : a8 __ __ TAY
+106c : 4c 55 10 JMP $1055 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+106f : b1 19 __ LDA (IP + 0),y
+1071 : 85 1f __ STA ADDR + 0
+1073 : c8 __ __ INY
+1074 : b1 19 __ LDA (IP + 0),y
+1076 : 85 20 __ STA ADDR + 1
+1078 : c8 __ __ INY
+1079 : b1 19 __ LDA (IP + 0),y
+107b : aa __ __ TAX
+107c : 84 02 __ STY $02
+107e : a0 00 __ LDY #$00
+1080 : b5 00 __ LDA $00,x
+1082 : 91 1f __ STA (ADDR + 0),y
+1084 : a4 02 __ LDY $02
+1086 : 4c 50 08 JMP $0850 ; (startup + 79)
+1089 : b1 19 __ LDA (IP + 0),y
+108b : aa __ __ TAX
+108c : c8 __ __ INY
+108d : b1 19 __ LDA (IP + 0),y
+108f : 84 02 __ STY $02
+1091 : a8 __ __ TAY
+1092 : 4c 80 10 JMP $1080 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1095 : b1 19 __ LDA (IP + 0),y
+1097 : 85 1f __ STA ADDR + 0
+1099 : c8 __ __ INY
+109a : b1 19 __ LDA (IP + 0),y
+109c : 85 20 __ STA ADDR + 1
+109e : c8 __ __ INY
+109f : b1 19 __ LDA (IP + 0),y
+10a1 : aa __ __ TAX
+10a2 : 84 02 __ STY $02
+10a4 : a0 00 __ LDY #$00
+10a6 : b5 00 __ LDA $00,x
+10a8 : 91 1f __ STA (ADDR + 0),y
+10aa : c8 __ __ INY
+10ab : b5 01 __ LDA $01,x
+10ad : 91 1f __ STA (ADDR + 0),y
+10af : a4 02 __ LDY $02
+10b1 : 4c 50 08 JMP $0850 ; (startup + 79)
+10b4 : b1 19 __ LDA (IP + 0),y
+10b6 : aa __ __ TAX
+10b7 : c8 __ __ INY
+10b8 : b1 19 __ LDA (IP + 0),y
+10ba : 84 02 __ STY $02
+10bc : a8 __ __ TAY
+10bd : 4c a6 10 JMP $10a6 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+10c0 : b1 19 __ LDA (IP + 0),y
+10c2 : aa __ __ TAX
+10c3 : c8 __ __ INY
+10c4 : b1 19 __ LDA (IP + 0),y
+10c6 : 95 00 __ STA $00,x
+10c8 : c8 __ __ INY
+10c9 : b1 19 __ LDA (IP + 0),y
+10cb : 95 01 __ STA $01,x
+10cd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+10d0 : b1 19 __ LDA (IP + 0),y
+10d2 : aa __ __ TAX
+10d3 : c8 __ __ INY
+10d4 : 18 __ __ CLC
+10d5 : b5 00 __ LDA $00,x
+10d7 : 71 19 __ ADC (IP + 0),y
+10d9 : 85 1f __ STA ADDR + 0
+10db : c8 __ __ INY
+10dc : b5 01 __ LDA $01,x
+10de : 71 19 __ ADC (IP + 0),y
+10e0 : 85 20 __ STA ADDR + 1
+10e2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+10e5 : b1 19 __ LDA (IP + 0),y
+10e7 : aa __ __ TAX
+10e8 : 18 __ __ CLC
+10e9 : b5 00 __ LDA $00,x
+10eb : 65 1b __ ADC ACCU + 0
+10ed : 85 1f __ STA ADDR + 0
+10ef : b5 01 __ LDA $01,x
+10f1 : 65 1c __ ADC ACCU + 1
+10f3 : 85 20 __ STA ADDR + 1
+10f5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+10f8 : b1 19 __ LDA (IP + 0),y
+10fa : aa __ __ TAX
+10fb : c8 __ __ INY
+10fc : b1 19 __ LDA (IP + 0),y
+10fe : 84 02 __ STY $02
+1100 : a8 __ __ TAY
+1101 : b1 25 __ LDA (FP + 0),y
+1103 : 95 00 __ STA $00,x
+1105 : a4 02 __ LDY $02
+1107 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+110a : b1 19 __ LDA (IP + 0),y
+110c : aa __ __ TAX
+110d : c8 __ __ INY
+110e : b1 19 __ LDA (IP + 0),y
+1110 : 84 02 __ STY $02
+1112 : a8 __ __ TAY
+1113 : b1 25 __ LDA (FP + 0),y
+1115 : 95 00 __ STA $00,x
+1117 : a9 00 __ LDA #$00
+1119 : 95 01 __ STA $01,x
+111b : a4 02 __ LDY $02
+111d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1120 : b1 19 __ LDA (IP + 0),y
+1122 : aa __ __ TAX
+1123 : c8 __ __ INY
+1124 : b1 19 __ LDA (IP + 0),y
+1126 : 84 02 __ STY $02
+1128 : a8 __ __ TAY
+1129 : b1 25 __ LDA (FP + 0),y
+112b : 95 00 __ STA $00,x
+112d : c8 __ __ INY
+112e : b1 25 __ LDA (FP + 0),y
+1130 : 95 01 __ STA $01,x
+1132 : a4 02 __ LDY $02
+1134 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1137 : b1 19 __ LDA (IP + 0),y
+1139 : aa __ __ TAX
+113a : c8 __ __ INY
+113b : b1 19 __ LDA (IP + 0),y
+113d : 84 02 __ STY $02
+113f : a8 __ __ TAY
+1140 : b5 00 __ LDA $00,x
+1142 : 91 25 __ STA (FP + 0),y
+1144 : a4 02 __ LDY $02
+1146 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1149 : b1 19 __ LDA (IP + 0),y
+114b : aa __ __ TAX
+114c : c8 __ __ INY
+114d : b1 19 __ LDA (IP + 0),y
+114f : 84 02 __ STY $02
+1151 : a8 __ __ TAY
+1152 : b5 00 __ LDA $00,x
+1154 : 91 25 __ STA (FP + 0),y
+1156 : c8 __ __ INY
+1157 : b5 01 __ LDA $01,x
+1159 : 91 25 __ STA (FP + 0),y
+115b : a4 02 __ LDY $02
+115d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1160 : b1 19 __ LDA (IP + 0),y
+1162 : aa __ __ TAX
+1163 : c8 __ __ INY
+1164 : 18 __ __ CLC
+1165 : b1 19 __ LDA (IP + 0),y
+1167 : 65 25 __ ADC FP + 0
+1169 : 95 00 __ STA $00,x
+116b : c8 __ __ INY
+116c : b1 19 __ LDA (IP + 0),y
+116e : 65 26 __ ADC FP + 1
+1170 : 95 01 __ STA $01,x
+1172 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1175 : b1 19 __ LDA (IP + 0),y
+1177 : aa __ __ TAX
+1178 : c8 __ __ INY
+1179 : b1 19 __ LDA (IP + 0),y
+117b : 84 02 __ STY $02
+117d : a8 __ __ TAY
+117e : b5 00 __ LDA $00,x
+1180 : 91 23 __ STA (SP + 0),y
+1182 : c8 __ __ INY
+1183 : b5 01 __ LDA $01,x
+1185 : 91 23 __ STA (SP + 0),y
+1187 : a4 02 __ LDY $02
+1189 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+118c : b1 19 __ LDA (IP + 0),y
+118e : aa __ __ TAX
+118f : 38 __ __ SEC
+1190 : a5 1b __ LDA ACCU + 0
+1192 : f5 00 __ SBC $00,x
+1194 : 85 1b __ STA ACCU + 0
+1196 : a5 1c __ LDA ACCU + 1
+1198 : f5 01 __ SBC $01,x
+119a : 85 1c __ STA ACCU + 1
+119c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+119f : b1 19 __ LDA (IP + 0),y
+11a1 : aa __ __ TAX
+11a2 : b5 00 __ LDA $00,x
+11a4 : 85 03 __ STA $03
+11a6 : b5 01 __ LDA $01,x
+11a8 : 85 04 __ STA $04
+11aa : 24 1c __ BIT ACCU + 1
+11ac : 10 10 __ BPL $11be
+11ae : 20 da 0e JSR $0eda ; (negaccu + 0)
+11b1 : 24 04 __ BIT $04
+11b3 : 10 10 __ BPL $11c5
+11b5 : 20 e8 0e JSR $0ee8 ; (negtmp + 0)
+11b8 : 20 f6 0e JSR $0ef6 ; (divmod + 0)
+11bb : 4c 50 08 JMP $0850 ; (startup + 79)
+11be : 24 04 __ BIT $04
+11c0 : 10 f6 __ BPL $11b8
+11c2 : 20 e8 0e JSR $0ee8 ; (negtmp + 0)
+11c5 : 20 f6 0e JSR $0ef6 ; (divmod + 0)
+11c8 : 20 da 0e JSR $0eda ; (negaccu + 0)
+11cb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+11ce : b1 19 __ LDA (IP + 0),y
+11d0 : aa __ __ TAX
+11d1 : 18 __ __ CLC
+11d2 : b5 00 __ LDA $00,x
+11d4 : 65 1b __ ADC ACCU + 0
+11d6 : 95 00 __ STA $00,x
+11d8 : b5 01 __ LDA $01,x
+11da : 65 1c __ ADC ACCU + 1
+11dc : 95 01 __ STA $01,x
+11de : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+11e1 : b1 19 __ LDA (IP + 0),y
+11e3 : c8 __ __ INY
+11e4 : aa __ __ TAX
+11e5 : 18 __ __ CLC
+11e6 : b5 00 __ LDA $00,x
+11e8 : 71 19 __ ADC (IP + 0),y
+11ea : c8 __ __ INY
+11eb : 95 00 __ STA $00,x
+11ed : b5 01 __ LDA $01,x
+11ef : 71 19 __ ADC (IP + 0),y
+11f1 : 95 01 __ STA $01,x
+11f3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+11f6 : b1 19 __ LDA (IP + 0),y
+11f8 : c8 __ __ INY
+11f9 : aa __ __ TAX
+11fa : a9 00 __ LDA #$00
+11fc : 85 05 __ STA $05
+11fe : 85 06 __ STA $06
+1200 : b5 00 __ LDA $00,x
+1202 : 85 03 __ STA $03
+1204 : b5 01 __ LDA $01,x
+1206 : 85 04 __ STA $04
+1208 : b1 19 __ LDA (IP + 0),y
+120a : 4a __ __ LSR
+120b : 85 07 __ STA $07
+120d : 90 0d __ BCC $121c
+120f : 18 __ __ CLC
+1210 : a5 05 __ LDA $05
+1212 : 65 03 __ ADC $03
+1214 : 85 05 __ STA $05
+1216 : a5 06 __ LDA $06
+1218 : 65 04 __ ADC $04
+121a : 85 06 __ STA $06
+121c : 06 03 __ ASL $03
+121e : 26 04 __ ROL $04
+1220 : 46 07 __ LSR $07
+1222 : b0 eb __ BCS $120f
+1224 : d0 f6 __ BNE $121c
+1226 : a5 05 __ LDA $05
+1228 : 95 00 __ STA $00,x
+122a : a5 06 __ LDA $06
+122c : 95 01 __ STA $01,x
+122e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1231 : b1 19 __ LDA (IP + 0),y
+1233 : c8 __ __ INY
+1234 : aa __ __ TAX
+1235 : 18 __ __ CLC
+1236 : b5 00 __ LDA $00,x
+1238 : 71 19 __ ADC (IP + 0),y
+123a : 95 00 __ STA $00,x
+123c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+123f : b1 19 __ LDA (IP + 0),y
+1241 : aa __ __ TAX
+1242 : 38 __ __ SEC
+1243 : b5 01 __ LDA $01,x
+1245 : e5 1c __ SBC ACCU + 1
+1247 : f0 11 __ BEQ $125a
+1249 : 50 02 __ BVC $124d
+124b : 49 80 __ EOR #$80
+124d : 30 2a __ BMI $1279
+124f : 10 33 __ BPL $1284
+1251 : b1 19 __ LDA (IP + 0),y
+1253 : aa __ __ TAX
+1254 : b5 01 __ LDA $01,x
+1256 : c5 1c __ CMP ACCU + 1
+1258 : d0 28 __ BNE $1282
+125a : b5 00 __ LDA $00,x
+125c : c5 1b __ CMP ACCU + 0
+125e : d0 22 __ BNE $1282
+1260 : f0 0e __ BEQ $1270
+1262 : b1 19 __ LDA (IP + 0),y
+1264 : aa __ __ TAX
+1265 : c8 __ __ INY
+1266 : b1 19 __ LDA (IP + 0),y
+1268 : c5 1c __ CMP ACCU + 1
+126a : d0 16 __ BNE $1282
+126c : e4 1b __ CPX ACCU + 0
+126e : d0 12 __ BNE $1282
+1270 : a9 00 __ LDA #$00
+1272 : 85 1b __ STA ACCU + 0
+1274 : 85 1c __ STA ACCU + 1
+1276 : 4c 50 08 JMP $0850 ; (startup + 79)
+1279 : a9 ff __ LDA #$ff
+127b : 85 1b __ STA ACCU + 0
+127d : 85 1c __ STA ACCU + 1
+127f : 4c 50 08 JMP $0850 ; (startup + 79)
+1282 : 90 f5 __ BCC $1279
+1284 : a9 01 __ LDA #$01
+1286 : 85 1b __ STA ACCU + 0
+1288 : a9 00 __ LDA #$00
+128a : 85 1c __ STA ACCU + 1
+128c : 4c 50 08 JMP $0850 ; (startup + 79)
+128f : b1 19 __ LDA (IP + 0),y
+1291 : c8 __ __ INY
+1292 : aa __ __ TAX
+1293 : b1 19 __ LDA (IP + 0),y
+1295 : 38 __ __ SEC
+1296 : e5 1c __ SBC ACCU + 1
+1298 : d0 af __ BNE $1249
+129a : e4 1b __ CPX ACCU + 0
+129c : d0 e4 __ BNE $1282
+129e : f0 d0 __ BEQ $1270
+12a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+12a1 : b1 19 __ LDA (IP + 0),y
+12a3 : aa __ __ TAX
+12a4 : 38 __ __ SEC
+12a5 : b5 00 __ LDA $00,x
+12a7 : e5 1b __ SBC ACCU + 0
+12a9 : f0 19 __ BEQ $12c4
+12ab : 50 02 __ BVC $12af
+12ad : 49 80 __ EOR #$80
+12af : 30 1c __ BMI $12cd
+12b1 : 10 25 __ BPL $12d8
+12b3 : b1 19 __ LDA (IP + 0),y
+12b5 : aa __ __ TAX
+12b6 : b5 00 __ LDA $00,x
+12b8 : c5 1b __ CMP ACCU + 0
+12ba : d0 1a __ BNE $12d6
+12bc : f0 06 __ BEQ $12c4
+12be : b1 19 __ LDA (IP + 0),y
+12c0 : c5 1b __ CMP ACCU + 0
+12c2 : d0 12 __ BNE $12d6
+12c4 : a9 00 __ LDA #$00
+12c6 : 85 1b __ STA ACCU + 0
+12c8 : 85 1c __ STA ACCU + 1
+12ca : 4c 50 08 JMP $0850 ; (startup + 79)
+12cd : a9 ff __ LDA #$ff
+12cf : 85 1b __ STA ACCU + 0
+12d1 : 85 1c __ STA ACCU + 1
+12d3 : 4c 50 08 JMP $0850 ; (startup + 79)
+12d6 : 90 f5 __ BCC $12cd
+12d8 : a9 01 __ LDA #$01
+12da : 85 1b __ STA ACCU + 0
+12dc : a9 00 __ LDA #$00
+12de : 85 1c __ STA ACCU + 1
+12e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+12e3 : b1 19 __ LDA (IP + 0),y
+12e5 : 38 __ __ SEC
+12e6 : e5 1b __ SBC ACCU + 0
+12e8 : d0 c1 __ BNE $12ab
+12ea : f0 d8 __ BEQ $12c4
+12ec : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+12ed : b1 19 __ LDA (IP + 0),y
+12ef : 30 0c __ BMI $12fd
+12f1 : 38 __ __ SEC
+12f2 : 65 19 __ ADC IP + 0
+12f4 : 85 19 __ STA IP + 0
+12f6 : 90 02 __ BCC $12fa
+12f8 : e6 1a __ INC IP + 1
+12fa : 4c 51 08 JMP $0851 ; (startup + 80)
+12fd : 38 __ __ SEC
+12fe : 65 19 __ ADC IP + 0
+1300 : 85 19 __ STA IP + 0
+1302 : b0 02 __ BCS $1306
+1304 : c6 1a __ DEC IP + 1
+1306 : 4c 51 08 JMP $0851 ; (startup + 80)
+1309 : a5 1b __ LDA ACCU + 0
+130b : 05 1c __ ORA ACCU + 1
+130d : f0 de __ BEQ $12ed
+130f : 4c 50 08 JMP $0850 ; (startup + 79)
+1312 : a5 1b __ LDA ACCU + 0
+1314 : 05 1c __ ORA ACCU + 1
+1316 : d0 d5 __ BNE $12ed
+1318 : 4c 50 08 JMP $0850 ; (startup + 79)
+131b : a5 1c __ LDA ACCU + 1
+131d : 30 04 __ BMI $1323
+131f : 05 1b __ ORA ACCU + 0
+1321 : d0 ca __ BNE $12ed
+1323 : 4c 50 08 JMP $0850 ; (startup + 79)
+1326 : a5 1c __ LDA ACCU + 1
+1328 : 10 c3 __ BPL $12ed
+132a : 4c 50 08 JMP $0850 ; (startup + 79)
+132d : a5 1c __ LDA ACCU + 1
+132f : 30 bc __ BMI $12ed
+1331 : 4c 50 08 JMP $0850 ; (startup + 79)
+1334 : a5 1c __ LDA ACCU + 1
+1336 : 30 b5 __ BMI $12ed
+1338 : 05 1b __ ORA ACCU + 0
+133a : f0 b1 __ BEQ $12ed
+133c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+133f : 38 __ __ SEC
+1340 : b1 19 __ LDA (IP + 0),y
+1342 : 65 19 __ ADC IP + 0
+1344 : aa __ __ TAX
+1345 : c8 __ __ INY
+1346 : b1 19 __ LDA (IP + 0),y
+1348 : 65 1a __ ADC IP + 1
+134a : 85 1a __ STA IP + 1
+134c : 86 19 __ STX IP + 0
+134e : 4c 51 08 JMP $0851 ; (startup + 80)
+1351 : a5 1b __ LDA ACCU + 0
+1353 : 05 1c __ ORA ACCU + 1
+1355 : f0 e8 __ BEQ $133f
+1357 : c8 __ __ INY
+1358 : 4c 50 08 JMP $0850 ; (startup + 79)
+135b : a5 1b __ LDA ACCU + 0
+135d : 05 1c __ ORA ACCU + 1
+135f : d0 de __ BNE $133f
+1361 : c8 __ __ INY
+1362 : 4c 50 08 JMP $0850 ; (startup + 79)
+1365 : a5 1c __ LDA ACCU + 1
+1367 : 30 04 __ BMI $136d
+1369 : 05 1b __ ORA ACCU + 0
+136b : d0 d2 __ BNE $133f
+136d : c8 __ __ INY
+136e : 4c 50 08 JMP $0850 ; (startup + 79)
+1371 : a5 1c __ LDA ACCU + 1
+1373 : 10 ca __ BPL $133f
+1375 : c8 __ __ INY
+1376 : 4c 50 08 JMP $0850 ; (startup + 79)
+1379 : a5 1c __ LDA ACCU + 1
+137b : 30 c2 __ BMI $133f
+137d : c8 __ __ INY
+137e : 4c 50 08 JMP $0850 ; (startup + 79)
+1381 : a5 1c __ LDA ACCU + 1
+1383 : 30 ba __ BMI $133f
+1385 : 05 1b __ ORA ACCU + 0
+1387 : f0 b6 __ BEQ $133f
+1389 : c8 __ __ INY
+138a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+138d : a9 00 __ LDA #$00
+138f : 2c a9 01 BIT $01a9 
+1392 : 85 1b __ STA ACCU + 0
+1394 : a9 00 __ LDA #$00
+1396 : 85 1c __ STA ACCU + 1
+1398 : 4c 51 08 JMP $0851 ; (startup + 80)
+139b : a5 1b __ LDA ACCU + 0
+139d : 05 1c __ ORA ACCU + 1
+139f : f0 ef __ BEQ $1390
+13a1 : d0 ea __ BNE $138d
+13a3 : a5 1b __ LDA ACCU + 0
+13a5 : 05 1c __ ORA ACCU + 1
+13a7 : d0 e7 __ BNE $1390
+13a9 : f0 e2 __ BEQ $138d
+13ab : a5 1c __ LDA ACCU + 1
+13ad : 30 de __ BMI $138d
+13af : 05 1b __ ORA ACCU + 0
+13b1 : d0 dd __ BNE $1390
+13b3 : f0 d8 __ BEQ $138d
+13b5 : a5 1c __ LDA ACCU + 1
+13b7 : 10 d7 __ BPL $1390
+13b9 : 30 d2 __ BMI $138d
+13bb : a5 1c __ LDA ACCU + 1
+13bd : 30 d1 __ BMI $1390
+13bf : 10 cc __ BPL $138d
+13c1 : a5 1c __ LDA ACCU + 1
+13c3 : 30 cb __ BMI $1390
+13c5 : 05 1b __ ORA ACCU + 0
+13c7 : f0 c7 __ BEQ $1390
+13c9 : d0 c2 __ BNE $138d
+13cb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+13cc : b1 19 __ LDA (IP + 0),y
+13ce : 8d e2 13 STA $13e2 ; (inp_jsr + 22)
+13d1 : c8 __ __ INY
+13d2 : b1 19 __ LDA (IP + 0),y
+13d4 : 8d e3 13 STA $13e3 ; (inp_jsr + 23)
+13d7 : 98 __ __ TYA
+13d8 : 38 __ __ SEC
+13d9 : 65 19 __ ADC IP + 0
+13db : 85 19 __ STA IP + 0
+13dd : 90 02 __ BCC $13e1
+13df : e6 1a __ INC IP + 1
+13e1 : 20 00 00 JSR $0000 
+13e4 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+13e7 : 98 __ __ TYA
+13e8 : 18 __ __ CLC
+13e9 : 65 19 __ ADC IP + 0
+13eb : 8d f6 13 STA $13f6 ; (inp_native + 15)
+13ee : a5 1a __ LDA IP + 1
+13f0 : 69 00 __ ADC #$00
+13f2 : 8d f7 13 STA $13f7 ; (inp_native + 16)
+13f5 : 20 00 00 JSR $0000 
+13f8 : a0 00 __ LDY #$00
+13fa : b1 23 __ LDA (SP + 0),y
+13fc : 85 19 __ STA IP + 0
+13fe : c8 __ __ INY
+13ff : b1 23 __ LDA (SP + 0),y
+1401 : 85 1a __ STA IP + 1
+1403 : 88 __ __ DEY
+1404 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+1407 : 38 __ __ SEC
+1408 : a5 23 __ LDA SP + 0
+140a : f1 19 __ SBC (IP + 0),y
+140c : c8 __ __ INY
+140d : 85 23 __ STA SP + 0
+140f : a5 24 __ LDA SP + 1
+1411 : f1 19 __ SBC (IP + 0),y
+1413 : c8 __ __ INY
+1414 : 85 24 __ STA SP + 1
+1416 : b1 19 __ LDA (IP + 0),y
+1418 : 84 02 __ STY $02
+141a : a8 __ __ TAY
+141b : a5 25 __ LDA FP + 0
+141d : 91 23 __ STA (SP + 0),y
+141f : c8 __ __ INY
+1420 : a5 26 __ LDA FP + 1
+1422 : 91 23 __ STA (SP + 0),y
+1424 : 98 __ __ TYA
+1425 : 38 __ __ SEC
+1426 : 65 23 __ ADC SP + 0
+1428 : 85 25 __ STA FP + 0
+142a : a9 00 __ LDA #$00
+142c : 65 24 __ ADC SP + 1
+142e : 85 26 __ STA FP + 1
+1430 : 88 __ __ DEY
+1431 : f0 08 __ BEQ $143b
+1433 : b9 52 00 LDA $0052,y 
+1436 : 88 __ __ DEY
+1437 : 91 23 __ STA (SP + 0),y
+1439 : d0 f8 __ BNE $1433
+143b : a4 02 __ LDY $02
+143d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+1440 : b1 19 __ LDA (IP + 0),y
+1442 : c8 __ __ INY
+1443 : 84 02 __ STY $02
+1445 : a8 __ __ TAY
+1446 : b1 23 __ LDA (SP + 0),y
+1448 : 85 25 __ STA FP + 0
+144a : c8 __ __ INY
+144b : b1 23 __ LDA (SP + 0),y
+144d : 85 26 __ STA FP + 1
+144f : 88 __ __ DEY
+1450 : f0 09 __ BEQ $145b
+1452 : 88 __ __ DEY
+1453 : b1 23 __ LDA (SP + 0),y
+1455 : 99 53 00 STA $0053,y 
+1458 : 88 __ __ DEY
+1459 : 10 f8 __ BPL $1453
+145b : a4 02 __ LDY $02
+145d : 18 __ __ CLC
+145e : b1 19 __ LDA (IP + 0),y
+1460 : c8 __ __ INY
+1461 : 65 23 __ ADC SP + 0
+1463 : 85 23 __ STA SP + 0
+1465 : b1 19 __ LDA (IP + 0),y
+1467 : c8 __ __ INY
+1468 : 65 24 __ ADC SP + 1
+146a : 85 24 __ STA SP + 1
+146c : a0 01 __ LDY #$01
+146e : b1 23 __ LDA (SP + 0),y
+1470 : 85 1a __ STA IP + 1
+1472 : 88 __ __ DEY
+1473 : b1 23 __ LDA (SP + 0),y
+1475 : 85 19 __ STA IP + 0
+1477 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+147a : b1 19 __ LDA (IP + 0),y
+147c : 85 1f __ STA ADDR + 0
+147e : c8 __ __ INY
+147f : b1 19 __ LDA (IP + 0),y
+1481 : 85 20 __ STA ADDR + 1
+1483 : c8 __ __ INY
+1484 : 98 __ __ TYA
+1485 : a0 00 __ LDY #$00
+1487 : 18 __ __ CLC
+1488 : 65 19 __ ADC IP + 0
+148a : 91 23 __ STA (SP + 0),y
+148c : c8 __ __ INY
+148d : a5 1a __ LDA IP + 1
+148f : 69 00 __ ADC #$00
+1491 : 91 23 __ STA (SP + 0),y
+1493 : a5 1f __ LDA ADDR + 0
+1495 : 85 19 __ STA IP + 0
+1497 : a5 20 __ LDA ADDR + 1
+1499 : 85 1a __ STA IP + 1
+149b : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+149e : 38 __ __ SEC
+149f : a5 23 __ LDA SP + 0
+14a1 : f1 19 __ SBC (IP + 0),y
+14a3 : c8 __ __ INY
+14a4 : 85 23 __ STA SP + 0
+14a6 : a5 24 __ LDA SP + 1
+14a8 : f1 19 __ SBC (IP + 0),y
+14aa : 85 24 __ STA SP + 1
+14ac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+14af : 18 __ __ CLC
+14b0 : b1 19 __ LDA (IP + 0),y
+14b2 : c8 __ __ INY
+14b3 : 65 23 __ ADC SP + 0
+14b5 : 85 23 __ STA SP + 0
+14b7 : b1 19 __ LDA (IP + 0),y
+14b9 : 65 24 __ ADC SP + 1
+14bb : 85 24 __ STA SP + 1
+14bd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+14c0 : b1 19 __ LDA (IP + 0),y
+14c2 : 84 02 __ STY $02
+14c4 : a8 __ __ TAY
+14c5 : 88 __ __ DEY
+14c6 : f0 07 __ BEQ $14cf
+14c8 : b1 1b __ LDA (ACCU + 0),y
+14ca : 91 1f __ STA (ADDR + 0),y
+14cc : 88 __ __ DEY
+14cd : d0 f9 __ BNE $14c8
+14cf : b1 1b __ LDA (ACCU + 0),y
+14d1 : 91 1f __ STA (ADDR + 0),y
+14d3 : a4 02 __ LDY $02
+14d5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+14d8 : 84 02 __ STY $02
+14da : a0 ff __ LDY #$ff
+14dc : c8 __ __ INY
+14dd : b1 1b __ LDA (ACCU + 0),y
+14df : 91 1f __ STA (ADDR + 0),y
+14e1 : d0 f9 __ BNE $14dc
+14e3 : a4 02 __ LDY $02
+14e5 : 4c 51 08 JMP $0851 ; (startup + 80)
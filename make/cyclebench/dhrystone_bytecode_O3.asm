@@ -0,0 +1,1236 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e b9 13 STX $13b9 ; (spentry + 0)
+0811 : a9 ba __ LDA #$ba
+0813 : 85 19 __ STA IP + 0
+0815 : a9 13 __ LDA #$13
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 27 __ LDA #$27
+081c : e9 13 __ SBC #$13
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 f9 __ LDA #$f9
+0832 : e9 ba __ SBC #$ba
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 64
+0a04:	PUSH	#$0002
+0a07:	LEA	T0, Next_Glob_Rec + 0
+0a0b:	MOV	Next_Ptr_Glob + 0, T0
+0a0f:	LEA	T1, Glob_Rec + 0
+0a13:	MOV	Ptr_Glob + 0, T1
+0a17:	MOV	Glob_Rec + 0, T0
+0a1b:	MOV	ACCU, #0
+0a1e:	MOVB	Glob_Rec + 2, ACCU
+0a22:	MOV	ACCU, #2
+0a25:	MOVB	Glob_Rec + 3, ACCU
+0a29:	MOV	ACCU, #40
+0a2c:	MOV	Glob_Rec + 4, ACCU
+0a30:	LEA	ADDR, Glob_Rec + 6
+0a34:	LEA	ACCU, $0d40
+0a38:	STRCPY
+0a39:	LEA	ADDR, 0(FP)
+0a3d:	LEA	ACCU, $0d5f
+0a41:	STRCPY
+0a42:	MOV	ACCU, #10
+0a45:	MOV	Arr_2_Glob + 814, ACCU
+0a49:	MOV	T0, #1
+0a4c:	MOV	ACCU, #65
+0a4f:	MOVB	Ch_1_Glob + 0, ACCU
+0a53:	MOV	ACCU, #1
+0a56:	MOVB	Bool_Glob + 0, ACCU
+0a5a:	MOV	ACCU, #66
+0a5d:	MOVB	Ch_2_Glob + 0, ACCU
+0a61:	LEA	ADDR, 31(FP)
+0a65:	LEA	ACCU, $0d7e
+0a69:	STRCPY
+0a6a:	MOV	T1, #3
+0a6d:	MOVB	T3, #1
+0a70:	LEA	T2, 0(FP)
+0a74:	LEA	T4, 31(FP)
+0a78:	MOV	T5, #2
+0a7b:	MOV	ACCU, T2
+0a7d:	LEAX	ADDR, T5 + ACCU
+0a7f:	MOVB	T7, 0(ADDR)
+0a82:	MOV	ACCU, T4
+0a84:	ADD	T5, ACCU
+0a86:	MOV	ADDR, T5
+0a88:	MOVUB	ACCU, 1(ADDR)
+0a8b:	CMPUB	ACCU, T7
+0a8d:	BNE	$0A95
+0a8f:	MOVB	Ch_1_Glob + 0, T7
+0a93:	JUMP	$0A78
+0a95:	MOV	ACCU, T2
+0a97:	MOV	P0, ACCU
+0a99:	MOV	ACCU, T4
+0a9b:	MOV	P2, ACCU
+0a9d:	JSR	strcmp + 0
+0aa0:	BGT	$0AA7
+0aa2:	MOV	ACCU, #1
+0aa5:	JUMP	$0AAA
+0aa7:	MOV	ACCU, #0
+0aaa:	MOVB	Bool_Glob + 0, ACCU
+0aae:	MOV	T2, #6
+0ab1:	LEAX	ADDR, Arr_1_Glob + 10 + T2
+0ab5:	MOV	ACCU, #7
+0ab8:	MOV	0(ADDR), ACCU
+0abb:	LEAX	ADDR, Arr_1_Glob + 12 + T2
+0abf:	MOV	0(ADDR), ACCU
+0ac2:	LEAX	ADDR, Arr_1_Glob + 70 + T2
+0ac6:	MOV	ACCU, #8
+0ac9:	MOV	0(ADDR), ACCU
+0acc:	LEA	T2, Arr_1_Glob + 0
+0ad0:	LEA	T4, Arr_2_Glob + 0
+0ad4:	MOV	ACCU, T4
+0ad6:	ADD	ACCU, #$0332
+0ada:	MOV	T5, ACCU
+0adc:	MOV	ACCU, T4
+0ade:	ADD	ACCU, #$0330
+0ae2:	MOV	T6, ACCU
+0ae4:	MOV	ACCU, #8
+0ae7:	MOV	ADDR, T6
+0ae9:	MOV	0(ADDR), ACCU
+0aec:	ADD	T6, #$0002
+0af0:	MOV	ACCU, T5
+0af2:	CMPU	ACCU, T6
+0af4:	BLE	$0AE4
+0af6:	MOV	ACCU, #$032e
+0afa:	LEAX	ADDR, T4 + ACCU
+0afc:	MOV	T6, 0(ADDR)
+0aff:	ADD	T6, #$0001
+0b03:	MOV	0(ADDR), T6
+0b06:	MOV	ACCU, #16
+0b09:	LEAX	ADDR, T2 + ACCU
+0b0b:	MOV	T2, 0(ADDR)
+0b0e:	MOV	ACCU, #$0b00
+0b12:	ADD	T4, ACCU
+0b14:	MOV	ADDR, T4
+0b16:	MOV	0(ADDR), T2
+0b19:	MOV	ACCU, #5
+0b1c:	MOV	Int_Glob + 0, ACCU
+0b20:	MOV	T2, Ptr_Glob + 0
+0b24:	MOV	ADDR, T2
+0b26:	MOV	T5, 0(ADDR)
+0b29:	MOV	T4, 0(ADDR)
+0b2c:	MOV	ADDR, T5
+0b2e:	MOV	ACCU, T2
+0b30:	COPY	#37
+0b32:	MOV	ACCU, #5
+0b35:	MOV	ADDR, T2
+0b37:	MOV	4(ADDR), ACCU
+0b3a:	MOV	ADDR, T4
+0b3c:	MOV	4(ADDR), ACCU
+0b3f:	MOV	ADDR, T2
+0b41:	MOV	T5, 0(ADDR)
+0b44:	MOV	ADDR, T4
+0b46:	MOV	0(ADDR), T5
+0b49:	MOV	ACCU, T2
+0b4b:	BEQ	$0B57
+0b4d:	MOV	ADDR, T2
+0b4f:	MOV	T5, 0(ADDR)
+0b52:	MOV	ADDR, T4
+0b54:	MOV	0(ADDR), T5
+0b57:	MOV	ACCU, #17
+0b5a:	MOV	ADDR, T2
+0b5c:	MOV	4(ADDR), ACCU
+0b5f:	MOV	ADDR, T4
+0b61:	MOVUB	ACCU, 2(ADDR)
+0b64:	BEQF	$0CC5
+0b67:	MOV	ADDR, T2
+0b69:	MOV	ACCU, 0(ADDR)
+0b6c:	COPY	#37
+0b6e:	MOVB	T7, #65
+0b71:	MOVUB	ACCU, Ch_2_Glob + 0
+0b75:	CMPUB	ACCU, #$0041
+0b77:	BLEF	$0C8B
+0b7a:	MOVB	T7, Ch_1_Glob + 0
+0b7e:	MUL	T1, #3
+0b81:	MOV	ACCU, T1
+0b83:	MOV	ADDR, #7
+0b86:	DIVS	ACCU, ADDR
+0b88:	MOV	T2, ACCU
+0b8a:	ADD	ACCU, #$000A
+0b8e:	MOV	T4, ACCU
+0b90:	ADD	T1, #$FFF9
+0b94:	MUL	T1, #7
+0b97:	MOV	ACCU, T1
+0b99:	SUB	ACCU, T2
+0b9b:	MOV	T1, ACCU
+0b9d:	MOVB	ACCU, T7
+0b9f:	CMPUB	ACCU, #$0041
+0ba1:	BEQ	$0BB0
+0ba3:	MOVUB	ACCU, Ch_1_Glob + 0
+0ba7:	CMPUB	ACCU, #$0041
+0ba9:	SEQ
+0baa:	MOVB	T7, ACCU
+0bac:	MOVB	ACCU, T7
+0bae:	BEQ	$0BAC
+0bb0:	ADD	T0, #$0001
+0bb4:	MOV	ACCU, T0
+0bb6:	CMPS	ACCU, #$01F4
+0bb9:	BGEF	$0A4C
+0bbc:	MOV	ACCU, Int_Glob + 0
+0bc0:	CMPU	ACCU, #$0005
+0bc3:	BNEF	$0C86
+0bc6:	MOVUB	ACCU, Bool_Glob + 0
+0bca:	BEQF	$0C86
+0bcd:	MOVUB	ACCU, Ch_1_Glob + 0
+0bd1:	CMPUB	ACCU, #$0041
+0bd3:	BNEF	$0C86
+0bd6:	MOVUB	ACCU, Ch_2_Glob + 0
+0bda:	CMPUB	ACCU, #$0042
+0bdc:	BNEF	$0C86
+0bdf:	MOV	ACCU, Arr_1_Glob + 16
+0be3:	CMPU	ACCU, #$0007
+0be6:	BNEF	$0C81
+0be9:	MOV	ACCU, Arr_2_Glob + 814
+0bed:	CMPU	ACCU, #$01FE
+0bf0:	BNEF	$0C81
+0bf3:	MOV	T0, Ptr_Glob + 0
+0bf7:	MOV	ADDR, T0
+0bf9:	MOVUB	ACCU, 2(ADDR)
+0bfc:	BNE	$0C7C
+0bfe:	MOVUB	ACCU, 3(ADDR)
+0c01:	CMPUB	ACCU, #$0002
+0c03:	BNE	$0C7C
+0c05:	MOV	ACCU, 4(ADDR)
+0c08:	CMPU	ACCU, #$0011
+0c0b:	BNE	$0C7C
+0c0d:	MOV	T2, Next_Ptr_Glob + 0
+0c11:	MOV	ADDR, T2
+0c13:	MOVUB	ACCU, 2(ADDR)
+0c16:	BNE	$0C77
+0c18:	MOVUB	ACCU, 3(ADDR)
+0c1b:	CMPUB	ACCU, #$0001
+0c1d:	BNE	$0C77
+0c1f:	MOV	ACCU, 4(ADDR)
+0c22:	CMPU	ACCU, #$0012
+0c25:	BNE	$0C77
+0c27:	MOV	ACCU, T4
+0c29:	ADD	ACCU, #$FFFF
+0c2d:	MOV	T4, Int_Glob + 0
+0c31:	SUB	ACCU, T4
+0c33:	CMPU	ACCU, #$0005
+0c36:	BNE	$0C72
+0c38:	MOV	ACCU, T1
+0c3a:	CMPU	ACCU, #$000D
+0c3d:	BNE	$0C72
+0c3f:	MOVB	ACCU, T3
+0c41:	CMPUB	ACCU, #$0001
+0c43:	BNE	$0C72
+0c45:	ADD	T0, #$0006
+0c49:	MOV	ACCU, T0
+0c4b:	MOV	P0, ACCU
+0c4d:	LEA	P2, $0dec
+0c51:	JSR	strcmp + 0
+0c54:	BNE	$0C68
+0c56:	LEA	P0, 31(FP)
+0c5a:	LEA	P2, $0e0b
+0c5e:	JSR	strcmp + 0
+0c61:	BNE	$0C68
+0c63:	MOV	ACCU, #0
+0c66:	JUMP	$0C6B
+0c68:	MOV	ACCU, #6
+0c6b:	POP	#$0002
+0c6e:	RETURN	0, 64
+0c72:	MOV	ACCU, #5
+0c75:	JUMP	$0C6B
+0c77:	MOV	ACCU, #4
+0c7a:	JUMP	$0C6B
+0c7c:	MOV	ACCU, #3
+0c7f:	JUMP	$0C6B
+0c81:	MOV	ACCU, #2
+0c84:	JUMP	$0C6B
+0c86:	MOV	ACCU, #1
+0c89:	JUMP	$0C6B
+0c8b:	MOVB	ACCU, T7
+0c8d:	CMPUB	ACCU, #$0043
+0c8f:	BNE	$0CBF
+0c91:	MOVB	Ch_1_Glob + 0, T7
+0c95:	MOVB	ACCU, T3
+0c97:	CMPUB	ACCU, #$0001
+0c99:	BNE	$0CAF
+0c9b:	LEA	ADDR, 31(FP)
+0c9f:	LEA	ACCU, $0dcd
+0ca3:	STRCPY
+0ca4:	MOV	Int_Glob + 0, T0
+0ca8:	MOV	ACCU, T0
+0caa:	MOV	T1, ACCU
+0cac:	MOVB	T3, #0
+0caf:	MOVB	T8, Ch_2_Glob + 0
+0cb3:	ADDB	T7, #$0001
+0cb6:	MOVB	ACCU, T8
+0cb8:	CMPUB	ACCU, T7
+0cba:	BLE	$0C8B
+0cbc:	JUMPF	$0B7A
+0cbf:	MOVB	ACCU, T3
+0cc1:	BEQ	$0C9B
+0cc3:	JUMP	$0CAF
+0cc5:	MOV	ACCU, #6
+0cc8:	MOV	4(ADDR), ACCU
+0ccb:	MOV	ADDR, T2
+0ccd:	MOVB	T7, 3(ADDR)
+0cd0:	MOV	ADDR, T4
+0cd2:	MOVB	3(ADDR), T7
+0cd5:	MOVB	ACCU, T7
+0cd7:	CMPUB	ACCU, #$0002
+0cd9:	BEQ	$0CE1
+0cdb:	MOV	ACCU, #3
+0cde:	MOVB	3(ADDR), ACCU
+0ce1:	MOVB	ACCU, T7
+0ce3:	CMPUB	ACCU, #$0003
+0ce5:	BEQ	$0CFB
+0ce7:	MOVB	ACCU, T7
+0ce9:	CMPUB	ACCU, #$0003
+0ceb:	BGT	$0D12
+0ced:	MOVB	ACCU, T7
+0cef:	CMPUB	ACCU, #$0004
+0cf1:	BNE	$0CFB
+0cf3:	MOV	ACCU, #2
+0cf6:	MOV	ADDR, T4
+0cf8:	MOVB	3(ADDR), ACCU
+0cfb:	MOV	ADDR, T2
+0cfd:	MOV	T2, 0(ADDR)
+0d00:	MOV	ADDR, T4
+0d02:	MOV	0(ADDR), T2
+0d05:	MOV	T2, 4(ADDR)
+0d08:	ADD	T2, #$000C
+0d0c:	MOV	4(ADDR), T2
+0d0f:	JUMPF	$0B6E
+0d12:	MOVB	ACCU, T7
+0d14:	BEQ	$0D36
+0d16:	MOVB	ACCU, T7
+0d18:	CMPUB	ACCU, #$0001
+0d1a:	BEQ	$0D2C
+0d1c:	MOVB	ACCU, T7
+0d1e:	CMPUB	ACCU, #$0002
+0d20:	BNE	$0CFB
+0d22:	MOV	ACCU, #1
+0d25:	MOV	ADDR, T4
+0d27:	MOVB	3(ADDR), ACCU
+0d2a:	JUMP	$0CFB
+0d2c:	MOV	ACCU, #3
+0d2f:	MOV	ADDR, T4
+0d31:	MOVB	3(ADDR), ACCU
+0d34:	JUMP	$0CFB
+0d36:	MOV	ACCU, #0
+0d39:	MOV	ADDR, T4
+0d3b:	MOVB	3(ADDR), ACCU
+0d3e:	JUMP	$0CFB
+--------------------------------------------------------------------
+strcmp:
+0d9d : ea __ __ NOP
+0d9e : a0 00 __ LDY #$00
+0da0 : 84 1c __ STY ACCU + 1
+0da2 : b1 0d __ LDA (P0),y
+0da4 : f0 16 __ BEQ $0dbc
+0da6 : d1 0f __ CMP (P2),y
+0da8 : d0 16 __ BNE $0dc0
+0daa : c8 __ __ INY
+0dab : b1 0d __ LDA (P0),y
+0dad : f0 0d __ BEQ $0dbc
+0daf : d1 0f __ CMP (P2),y
+0db1 : d0 0d __ BNE $0dc0
+0db3 : c8 __ __ INY
+0db4 : d0 ec __ BNE $0da2
+0db6 : e6 0e __ INC P1
+0db8 : e6 10 __ INC P3
+0dba : d0 e6 __ BNE $0da2
+0dbc : d1 0f __ CMP (P2),y
+0dbe : f0 0a __ BEQ $0dca
+0dc0 : b0 06 __ BCS $0dc8
+0dc2 : a9 ff __ LDA #$ff
+0dc4 : 85 1c __ STA ACCU + 1
+0dc6 : 30 02 __ BMI $0dca
+0dc8 : a9 01 __ LDA #$01
+0dca : 85 1b __ STA ACCU + 0
+0dcc : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0e2a : 38 __ __ SEC
+0e2b : a9 00 __ LDA #$00
+0e2d : e5 1b __ SBC ACCU + 0
+0e2f : 85 1b __ STA ACCU + 0
+0e31 : a9 00 __ LDA #$00
+0e33 : e5 1c __ SBC ACCU + 1
+0e35 : 85 1c __ STA ACCU + 1
+0e37 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0e38 : 38 __ __ SEC
+0e39 : a9 00 __ LDA #$00
+0e3b : e5 03 __ SBC $03
+0e3d : 85 03 __ STA $03
+0e3f : a9 00 __ LDA #$00
+0e41 : e5 04 __ SBC $04
+0e43 : 85 04 __ STA $04
+0e45 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0e46 : a5 1c __ LDA ACCU + 1
+0e48 : d0 31 __ BNE $0e7b
+0e4a : a5 04 __ LDA $04
+0e4c : d0 1e __ BNE $0e6c
+0e4e : 85 06 __ STA $06
+0e50 : a2 04 __ LDX #$04
+0e52 : 06 1b __ ASL ACCU + 0
+0e54 : 2a __ __ ROL
+0e55 : c5 03 __ CMP $03
+0e57 : 90 02 __ BCC $0e5b
+0e59 : e5 03 __ SBC $03
+0e5b : 26 1b __ ROL ACCU + 0
+0e5d : 2a __ __ ROL
+0e5e : c5 03 __ CMP $03
+0e60 : 90 02 __ BCC $0e64
+0e62 : e5 03 __ SBC $03
+0e64 : 26 1b __ ROL ACCU + 0
+0e66 : ca __ __ DEX
+0e67 : d0 eb __ BNE $0e54
+0e69 : 85 05 __ STA $05
+0e6b : 60 __ __ RTS
+0e6c : a5 1b __ LDA ACCU + 0
+0e6e : 85 05 __ STA $05
+0e70 : a5 1c __ LDA ACCU + 1
+0e72 : 85 06 __ STA $06
+0e74 : a9 00 __ LDA #$00
+0e76 : 85 1b __ STA ACCU + 0
+0e78 : 85 1c __ STA ACCU + 1
+0e7a : 60 __ __ RTS
+0e7b : a5 04 __ LDA $04
+0e7d : d0 1f __ BNE $0e9e
+0e7f : a5 03 __ LDA $03
+0e81 : 30 1b __ BMI $0e9e
+0e83 : a9 00 __ LDA #$00
+0e85 : 85 06 __ STA $06
+0e87 : a2 10 __ LDX #$10
+0e89 : 06 1b __ ASL ACCU + 0
+0e8b : 26 1c __ ROL ACCU + 1
+0e8d : 2a __ __ ROL
+0e8e : c5 03 __ CMP $03
+0e90 : 90 02 __ BCC $0e94
+0e92 : e5 03 __ SBC $03
+0e94 : 26 1b __ ROL ACCU + 0
+0e96 : 26 1c __ ROL ACCU + 1
+0e98 : ca __ __ DEX
+0e99 : d0 f2 __ BNE $0e8d
+0e9b : 85 05 __ STA $05
+0e9d : 60 __ __ RTS
+0e9e : a9 00 __ LDA #$00
+0ea0 : 85 05 __ STA $05
+0ea2 : 85 06 __ STA $06
+0ea4 : 84 02 __ STY $02
+0ea6 : a0 10 __ LDY #$10
+0ea8 : 18 __ __ CLC
+0ea9 : 26 1b __ ROL ACCU + 0
+0eab : 26 1c __ ROL ACCU + 1
+0ead : 26 05 __ ROL $05
+0eaf : 26 06 __ ROL $06
+0eb1 : 38 __ __ SEC
+0eb2 : a5 05 __ LDA $05
+0eb4 : e5 03 __ SBC $03
+0eb6 : aa __ __ TAX
+0eb7 : a5 06 __ LDA $06
+0eb9 : e5 04 __ SBC $04
+0ebb : 90 04 __ BCC $0ec1
+0ebd : 86 05 __ STX $05
+0ebf : 85 06 __ STA $06
+0ec1 : 88 __ __ DEY
+0ec2 : d0 e5 __ BNE $0ea9
+0ec4 : 26 1b __ ROL ACCU + 0
+0ec6 : 26 1c __ ROL ACCU + 1
+0ec8 : a4 02 __ LDY $02
+0eca : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0ecb : a9 4c __ LDA #$4c
+0ecd : 85 54 __ STA $54
+0ecf : a9 00 __ LDA #$00
+0ed1 : 85 13 __ STA P6
+0ed3 : a9 19 __ LDA #$19
+0ed5 : 85 16 __ STA P9
+0ed7 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+0ed8 : b1 19 __ LDA (IP + 0),y
+0eda : aa __ __ TAX
+0edb : c8 __ __ INY
+0edc : b1 19 __ LDA (IP + 0),y
+0ede : 95 00 __ STA $00,x
+0ee0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+0ee3 : b1 19 __ LDA (IP + 0),y
+0ee5 : aa __ __ TAX
+0ee6 : c8 __ __ INY
+0ee7 : b1 19 __ LDA (IP + 0),y
+0ee9 : 95 00 __ STA $00,x
+0eeb : a9 00 __ LDA #$00
+0eed : 95 01 __ STA $01,x
+0eef : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+0ef2 : b1 19 __ LDA (IP + 0),y
+0ef4 : aa __ __ TAX
+0ef5 : c8 __ __ INY
+0ef6 : b1 19 __ LDA (IP + 0),y
+0ef8 : 95 00 __ STA $00,x
+0efa : c8 __ __ INY
+0efb : b1 19 __ LDA (IP + 0),y
+0efd : 95 01 __ STA $01,x
+0eff : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0f02 : b1 19 __ LDA (IP + 0),y
+0f04 : aa __ __ TAX
+0f05 : b5 00 __ LDA $00,x
+0f07 : 85 1b __ STA ACCU + 0
+0f09 : a9 00 __ LDA #$00
+0f0b : 85 1c __ STA ACCU + 1
+0f0d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+0f10 : b1 19 __ LDA (IP + 0),y
+0f12 : aa __ __ TAX
+0f13 : a5 1b __ LDA ACCU + 0
+0f15 : 95 00 __ STA $00,x
+0f17 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0f1a : b1 19 __ LDA (IP + 0),y
+0f1c : aa __ __ TAX
+0f1d : b5 00 __ LDA $00,x
+0f1f : 85 1b __ STA ACCU + 0
+0f21 : b5 01 __ LDA $01,x
+0f23 : 85 1c __ STA ACCU + 1
+0f25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0f28 : b1 19 __ LDA (IP + 0),y
+0f2a : aa __ __ TAX
+0f2b : a5 1b __ LDA ACCU + 0
+0f2d : 95 00 __ STA $00,x
+0f2f : a5 1c __ LDA ACCU + 1
+0f31 : 95 01 __ STA $01,x
+0f33 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0f36 : b1 19 __ LDA (IP + 0),y
+0f38 : aa __ __ TAX
+0f39 : b5 00 __ LDA $00,x
+0f3b : 85 1f __ STA ADDR + 0
+0f3d : b5 01 __ LDA $01,x
+0f3f : 85 20 __ STA ADDR + 1
+0f41 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+0f44 : b1 19 __ LDA (IP + 0),y
+0f46 : 85 1f __ STA ADDR + 0
+0f48 : c8 __ __ INY
+0f49 : b1 19 __ LDA (IP + 0),y
+0f4b : 85 20 __ STA ADDR + 1
+0f4d : c8 __ __ INY
+0f4e : b1 19 __ LDA (IP + 0),y
+0f50 : aa __ __ TAX
+0f51 : 84 02 __ STY $02
+0f53 : a0 00 __ LDY #$00
+0f55 : b1 1f __ LDA (ADDR + 0),y
+0f57 : 95 00 __ STA $00,x
+0f59 : a4 02 __ LDY $02
+0f5b : 4c 50 08 JMP $0850 ; (startup + 79)
+0f5e : b1 19 __ LDA (IP + 0),y
+0f60 : aa __ __ TAX
+0f61 : c8 __ __ INY
+0f62 : b1 19 __ LDA (IP + 0),y
+0f64 : 84 02 __ STY $02
+0f66 : a8 __ __ TAY
+0f67 : 4c 55 0f JMP $0f55 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0f6a : b1 19 __ LDA (IP + 0),y
+0f6c : 85 1f __ STA ADDR + 0
+0f6e : c8 __ __ INY
+0f6f : b1 19 __ LDA (IP + 0),y
+0f71 : 85 20 __ STA ADDR + 1
+0f73 : c8 __ __ INY
+0f74 : b1 19 __ LDA (IP + 0),y
+0f76 : aa __ __ TAX
+0f77 : 84 02 __ STY $02
+0f79 : a0 00 __ LDY #$00
+0f7b : b1 1f __ LDA (ADDR + 0),y
+0f7d : 95 00 __ STA $00,x
+0f7f : a9 00 __ LDA #$00
+0f81 : 95 01 __ STA $01,x
+0f83 : a4 02 __ LDY $02
+0f85 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f88 : b1 19 __ LDA (IP + 0),y
+0f8a : aa __ __ TAX
+0f8b : c8 __ __ INY
+0f8c : b1 19 __ LDA (IP + 0),y
+0f8e : 84 02 __ STY $02
+0f90 : a8 __ __ TAY
+0f91 : 4c 7b 0f JMP $0f7b ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0f94 : b1 19 __ LDA (IP + 0),y
+0f96 : 85 1f __ STA ADDR + 0
+0f98 : c8 __ __ INY
+0f99 : b1 19 __ LDA (IP + 0),y
+0f9b : 85 20 __ STA ADDR + 1
+0f9d : c8 __ __ INY
+0f9e : b1 19 __ LDA (IP + 0),y
+0fa0 : aa __ __ TAX
+0fa1 : 84 02 __ STY $02
+0fa3 : a0 00 __ LDY #$00
+0fa5 : b1 1f __ LDA (ADDR + 0),y
+0fa7 : 95 00 __ STA $00,x
+0fa9 : c8 __ __ INY
+0faa : b1 1f __ LDA (ADDR + 0),y
+0fac : 95 01 __ STA $01,x
+0fae : a4 02 __ LDY $02
+0fb0 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fb3 : b1 19 __ LDA (IP + 0),y
+0fb5 : aa __ __ TAX
+0fb6 : c8 __ __ INY
+0fb7 : b1 19 __ LDA (IP + 0),y
+0fb9 : 84 02 __ STY $02
+0fbb : a8 __ __ TAY
+0fbc : 4c a5 0f JMP $0fa5 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0fbf : b1 19 __ LDA (IP + 0),y
+0fc1 : 85 1f __ STA ADDR + 0
+0fc3 : c8 __ __ INY
+0fc4 : b1 19 __ LDA (IP + 0),y
+0fc6 : 85 20 __ STA ADDR + 1
+0fc8 : c8 __ __ INY
+0fc9 : b1 19 __ LDA (IP + 0),y
+0fcb : aa __ __ TAX
+0fcc : 84 02 __ STY $02
+0fce : a0 00 __ LDY #$00
+0fd0 : b5 00 __ LDA $00,x
+0fd2 : 91 1f __ STA (ADDR + 0),y
+0fd4 : a4 02 __ LDY $02
+0fd6 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fd9 : b1 19 __ LDA (IP + 0),y
+0fdb : aa __ __ TAX
+0fdc : c8 __ __ INY
+0fdd : b1 19 __ LDA (IP + 0),y
+0fdf : 84 02 __ STY $02
+0fe1 : a8 __ __ TAY
+0fe2 : 4c d0 0f JMP $0fd0 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+0fe5 : b1 19 __ LDA (IP + 0),y
+0fe7 : 85 1f __ STA ADDR + 0
+0fe9 : c8 __ __ INY
+0fea : b1 19 __ LDA (IP + 0),y
+0fec : 85 20 __ STA ADDR + 1
+0fee : c8 __ __ INY
+0fef : b1 19 __ LDA (IP + 0),y
+0ff1 : aa __ __ TAX
+0ff2 : 84 02 __ STY $02
+0ff4 : a0 00 __ LDY #$00
+0ff6 : b5 00 __ LDA $00,x
+0ff8 : 91 1f __ STA (ADDR + 0),y
+0ffa : c8 __ __ INY
+0ffb : b5 01 __ LDA $01,x
+0ffd : 91 1f __ STA (ADDR + 0),y
+0fff : a4 02 __ LDY $02
+1001 : 4c 50 08 JMP $0850 ; (startup + 79)
+1004 : b1 19 __ LDA (IP + 0),y
+1006 : aa __ __ TAX
+1007 : c8 __ __ INY
+1008 : b1 19 __ LDA (IP + 0),y
+100a : 84 02 __ STY $02
+100c : a8 __ __ TAY
+100d : 4c f6 0f JMP $0ff6 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1010 : b1 19 __ LDA (IP + 0),y
+1012 : aa __ __ TAX
+1013 : c8 __ __ INY
+1014 : b1 19 __ LDA (IP + 0),y
+1016 : 95 00 __ STA $00,x
+1018 : c8 __ __ INY
+1019 : b1 19 __ LDA (IP + 0),y
+101b : 95 01 __ STA $01,x
+101d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1020 : b1 19 __ LDA (IP + 0),y
+1022 : aa __ __ TAX
+1023 : c8 __ __ INY
+1024 : 18 __ __ CLC
+1025 : b5 00 __ LDA $00,x
+1027 : 71 19 __ ADC (IP + 0),y
+1029 : 85 1f __ STA ADDR + 0
+102b : c8 __ __ INY
+102c : b5 01 __ LDA $01,x
+102e : 71 19 __ ADC (IP + 0),y
+1030 : 85 20 __ STA ADDR + 1
+1032 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1035 : b1 19 __ LDA (IP + 0),y
+1037 : aa __ __ TAX
+1038 : 18 __ __ CLC
+1039 : b5 00 __ LDA $00,x
+103b : 65 1b __ ADC ACCU + 0
+103d : 85 1f __ STA ADDR + 0
+103f : b5 01 __ LDA $01,x
+1041 : 65 1c __ ADC ACCU + 1
+1043 : 85 20 __ STA ADDR + 1
+1045 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1048 : b1 19 __ LDA (IP + 0),y
+104a : aa __ __ TAX
+104b : c8 __ __ INY
+104c : 18 __ __ CLC
+104d : b1 19 __ LDA (IP + 0),y
+104f : 65 25 __ ADC FP + 0
+1051 : 95 00 __ STA $00,x
+1053 : c8 __ __ INY
+1054 : b1 19 __ LDA (IP + 0),y
+1056 : 65 26 __ ADC FP + 1
+1058 : 95 01 __ STA $01,x
+105a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+105d : b1 19 __ LDA (IP + 0),y
+105f : aa __ __ TAX
+1060 : 38 __ __ SEC
+1061 : a5 1b __ LDA ACCU + 0
+1063 : f5 00 __ SBC $00,x
+1065 : 85 1b __ STA ACCU + 0
+1067 : a5 1c __ LDA ACCU + 1
+1069 : f5 01 __ SBC $01,x
+106b : 85 1c __ STA ACCU + 1
+106d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1070 : b1 19 __ LDA (IP + 0),y
+1072 : aa __ __ TAX
+1073 : b5 00 __ LDA $00,x
+1075 : 85 03 __ STA $03
+1077 : b5 01 __ LDA $01,x
+1079 : 85 04 __ STA $04
+107b : 24 1c __ BIT ACCU + 1
+107d : 10 10 __ BPL $108f
+107f : 20 2a 0e JSR $0e2a ; (negaccu + 0)
+1082 : 24 04 __ BIT $04
+1084 : 10 10 __ BPL $1096
+1086 : 20 38 0e JSR $0e38 ; (negtmp + 0)
+1089 : 20 46 0e JSR $0e46 ; (divmod + 0)
+108c : 4c 50 08 JMP $0850 ; (startup + 79)
+108f : 24 04 __ BIT $04
+1091 : 10 f6 __ BPL $1089
+1093 : 20 38 0e JSR $0e38 ; (negtmp + 0)
+1096 : 20 46 0e JSR $0e46 ; (divmod + 0)
+1099 : 20 2a 0e JSR $0e2a ; (negaccu + 0)
+109c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+109f : b1 19 __ LDA (IP + 0),y
+10a1 : aa __ __ TAX
+10a2 : 18 __ __ CLC
+10a3 : b5 00 __ LDA $00,x
+10a5 : 65 1b __ ADC ACCU + 0
+10a7 : 95 00 __ STA $00,x
+10a9 : b5 01 __ LDA $01,x
+10ab : 65 1c __ ADC ACCU + 1
+10ad : 95 01 __ STA $01,x
+10af : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+10b2 : b1 19 __ LDA (IP + 0),y
+10b4 : c8 __ __ INY
+10b5 : aa __ __ TAX
+10b6 : 18 __ __ CLC
+10b7 : b5 00 __ LDA $00,x
+10b9 : 71 19 __ ADC (IP + 0),y
+10bb : c8 __ __ INY
+10bc : 95 00 __ STA $00,x
+10be : b5 01 __ LDA $01,x
+10c0 : 71 19 __ ADC (IP + 0),y
+10c2 : 95 01 __ STA $01,x
+10c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+10c7 : b1 19 __ LDA (IP + 0),y
+10c9 : c8 __ __ INY
+10ca : aa __ __ TAX
+10cb : a9 00 __ LDA #$00
+10cd : 85 05 __ STA $05
+10cf : 85 06 __ STA $06
+10d1 : b5 00 __ LDA $00,x
+10d3 : 85 03 __ STA $03
+10d5 : b5 01 __ LDA $01,x
+10d7 : 85 04 __ STA $04
+10d9 : b1 19 __ LDA (IP + 0),y
+10db : 4a __ __ LSR
+10dc : 85 07 __ STA $07
+10de : 90 0d __ BCC $10ed
+10e0 : 18 __ __ CLC
+10e1 : a5 05 __ LDA $05
+10e3 : 65 03 __ ADC $03
+10e5 : 85 05 __ STA $05
+10e7 : a5 06 __ LDA $06
+10e9 : 65 04 __ ADC $04
+10eb : 85 06 __ STA $06
+10ed : 06 03 __ ASL $03
+10ef : 26 04 __ ROL $04
+10f1 : 46 07 __ LSR $07
+10f3 : b0 eb __ BCS $10e0
+10f5 : d0 f6 __ BNE $10ed
+10f7 : a5 05 __ LDA $05
+10f9 : 95 00 __ STA $00,x
+10fb : a5 06 __ LDA $06
+10fd : 95 01 __ STA $01,x
+10ff : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1102 : b1 19 __ LDA (IP + 0),y
+1104 : c8 __ __ INY
+1105 : aa __ __ TAX
+1106 : 18 __ __ CLC
+1107 : b5 00 __ LDA $00,x
+1109 : 71 19 __ ADC (IP + 0),y
+110b : 95 00 __ STA $00,x
+110d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1110 : b1 19 __ LDA (IP + 0),y
+1112 : aa __ __ TAX
+1113 : 38 __ __ SEC
+1114 : b5 01 __ LDA $01,x
+1116 : e5 1c __ SBC ACCU + 1
+1118 : f0 11 __ BEQ $112b
+111a : 50 02 __ BVC $111e
+111c : 49 80 __ EOR #$80
+111e : 30 2a __ BMI $114a
+1120 : 10 33 __ BPL $1155
+1122 : b1 19 __ LDA (IP + 0),y
+1124 : aa __ __ TAX
+1125 : b5 01 __ LDA $01,x
+1127 : c5 1c __ CMP ACCU + 1
+1129 : d0 28 __ BNE $1153
+112b : b5 00 __ LDA $00,x
+112d : c5 1b __ CMP ACCU + 0
+112f : d0 22 __ BNE $1153
+1131 : f0 0e __ BEQ $1141
+1133 : b1 19 __ LDA (IP + 0),y
+1135 : aa __ __ TAX
+1136 : c8 __ __ INY
+1137 : b1 19 __ LDA (IP + 0),y
+1139 : c5 1c __ CMP ACCU + 1
+113b : d0 16 __ BNE $1153
+113d : e4 1b __ CPX ACCU + 0
+113f : d0 12 __ BNE $1153
+1141 : a9 00 __ LDA #$00
+1143 : 85 1b __ STA ACCU + 0
+1145 : 85 1c __ STA ACCU + 1
+1147 : 4c 50 08 JMP $0850 ; (startup + 79)
+114a : a9 ff __ LDA #$ff
+114c : 85 1b __ STA ACCU + 0
+114e : 85 1c __ STA ACCU + 1
+1150 : 4c 50 08 JMP $0850 ; (startup + 79)
+1153 : 90 f5 __ BCC $114a
+1155 : a9 01 __ LDA #$01
+1157 : 85 1b __ STA ACCU + 0
+1159 : a9 00 __ LDA #$00
+115b : 85 1c __ STA ACCU + 1
+115d : 4c 50 08 JMP $0850 ; (startup + 79)
+1160 : b1 19 __ LDA (IP + 0),y
+1162 : c8 __ __ INY
+1163 : aa __ __ TAX
+1164 : b1 19 __ LDA (IP + 0),y
+1166 : 38 __ __ SEC
+1167 : e5 1c __ SBC ACCU + 1
+1169 : d0 af __ BNE $111a
+116b : e4 1b __ CPX ACCU + 0
+116d : d0 e4 __ BNE $1153
+116f : f0 d0 __ BEQ $1141
+1171 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1172 : b1 19 __ LDA (IP + 0),y
+1174 : aa __ __ TAX
+1175 : 38 __ __ SEC
+1176 : b5 00 __ LDA $00,x
+1178 : e5 1b __ SBC ACCU + 0
+117a : f0 19 __ BEQ $1195
+117c : 50 02 __ BVC $1180
+117e : 49 80 __ EOR #$80
+1180 : 30 1c __ BMI $119e
+1182 : 10 25 __ BPL $11a9
+1184 : b1 19 __ LDA (IP + 0),y
+1186 : aa __ __ TAX
+1187 : b5 00 __ LDA $00,x
+1189 : c5 1b __ CMP ACCU + 0
+118b : d0 1a __ BNE $11a7
+118d : f0 06 __ BEQ $1195
+118f : b1 19 __ LDA (IP + 0),y
+1191 : c5 1b __ CMP ACCU + 0
+1193 : d0 12 __ BNE $11a7
+1195 : a9 00 __ LDA #$00
+1197 : 85 1b __ STA ACCU + 0
+1199 : 85 1c __ STA ACCU + 1
+119b : 4c 50 08 JMP $0850 ; (startup + 79)
+119e : a9 ff __ LDA #$ff
+11a0 : 85 1b __ STA ACCU + 0
+11a2 : 85 1c __ STA ACCU + 1
+11a4 : 4c 50 08 JMP $0850 ; (startup + 79)
+11a7 : 90 f5 __ BCC $119e
+11a9 : a9 01 __ LDA #$01
+11ab : 85 1b __ STA ACCU + 0
+11ad : a9 00 __ LDA #$00
+11af : 85 1c __ STA ACCU + 1
+11b1 : 4c 50 08 JMP $0850 ; (startup + 79)
+11b4 : b1 19 __ LDA (IP + 0),y
+11b6 : 38 __ __ SEC
+11b7 : e5 1b __ SBC ACCU + 0
+11b9 : d0 c1 __ BNE $117c
+11bb : f0 d8 __ BEQ $1195
+11bd : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+11be : b1 19 __ LDA (IP + 0),y
+11c0 : 30 0c __ BMI $11ce
+11c2 : 38 __ __ SEC
+11c3 : 65 19 __ ADC IP + 0
+11c5 : 85 19 __ STA IP + 0
+11c7 : 90 02 __ BCC $11cb
+11c9 : e6 1a __ INC IP + 1
+11cb : 4c 51 08 JMP $0851 ; (startup + 80)
+11ce : 38 __ __ SEC
+11cf : 65 19 __ ADC IP + 0
+11d1 : 85 19 __ STA IP + 0
+11d3 : b0 02 __ BCS $11d7
+11d5 : c6 1a __ DEC IP + 1
+11d7 : 4c 51 08 JMP $0851 ; (startup + 80)
+11da : a5 1b __ LDA ACCU + 0
+11dc : 05 1c __ ORA ACCU + 1
+11de : f0 de __ BEQ $11be
+11e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+11e3 : a5 1b __ LDA ACCU + 0
+11e5 : 05 1c __ ORA ACCU + 1
+11e7 : d0 d5 __ BNE $11be
+11e9 : 4c 50 08 JMP $0850 ; (startup + 79)
+11ec : a5 1c __ LDA ACCU + 1
+11ee : 30 04 __ BMI $11f4
+11f0 : 05 1b __ ORA ACCU + 0
+11f2 : d0 ca __ BNE $11be
+11f4 : 4c 50 08 JMP $0850 ; (startup + 79)
+11f7 : a5 1c __ LDA ACCU + 1
+11f9 : 10 c3 __ BPL $11be
+11fb : 4c 50 08 JMP $0850 ; (startup + 79)
+11fe : a5 1c __ LDA ACCU + 1
+1200 : 30 bc __ BMI $11be
+1202 : 4c 50 08 JMP $0850 ; (startup + 79)
+1205 : a5 1c __ LDA ACCU + 1
+1207 : 30 b5 __ BMI $11be
+1209 : 05 1b __ ORA ACCU + 0
+120b : f0 b1 __ BEQ $11be
+120d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1210 : 38 __ __ SEC
+1211 : b1 19 __ LDA (IP + 0),y
+1213 : 65 19 __ ADC IP + 0
+1215 : aa __ __ TAX
+1216 : c8 __ __ INY
+1217 : b1 19 __ LDA (IP + 0),y
+1219 : 65 1a __ ADC IP + 1
+121b : 85 1a __ STA IP + 1
+121d : 86 19 __ STX IP + 0
+121f : 4c 51 08 JMP $0851 ; (startup + 80)
+1222 : a5 1b __ LDA ACCU + 0
+1224 : 05 1c __ ORA ACCU + 1
+1226 : f0 e8 __ BEQ $1210
+1228 : c8 __ __ INY
+1229 : 4c 50 08 JMP $0850 ; (startup + 79)
+122c : a5 1b __ LDA ACCU + 0
+122e : 05 1c __ ORA ACCU + 1
+1230 : d0 de __ BNE $1210
+1232 : c8 __ __ INY
+1233 : 4c 50 08 JMP $0850 ; (startup + 79)
+1236 : a5 1c __ LDA ACCU + 1
+1238 : 30 04 __ BMI $123e
+123a : 05 1b __ ORA ACCU + 0
+123c : d0 d2 __ BNE $1210
+123e : c8 __ __ INY
+123f : 4c 50 08 JMP $0850 ; (startup + 79)
+1242 : a5 1c __ LDA ACCU + 1
+1244 : 10 ca __ BPL $1210
+1246 : c8 __ __ INY
+1247 : 4c 50 08 JMP $0850 ; (startup + 79)
+124a : a5 1c __ LDA ACCU + 1
+124c : 30 c2 __ BMI $1210
+124e : c8 __ __ INY
+124f : 4c 50 08 JMP $0850 ; (startup + 79)
+1252 : a5 1c __ LDA ACCU + 1
+1254 : 30 ba __ BMI $1210
+1256 : 05 1b __ ORA ACCU + 0
+1258 : f0 b6 __ BEQ $1210
+125a : c8 __ __ INY
+125b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+125e : a9 00 __ LDA #$00
+1260 : 2c a9 01 BIT $01a9 
+1263 : 85 1b __ STA ACCU + 0
+1265 : a9 00 __ LDA #$00
+1267 : 85 1c __ STA ACCU + 1
+1269 : 4c 51 08 JMP $0851 ; (startup + 80)
+126c : a5 1b __ LDA ACCU + 0
+126e : 05 1c __ ORA ACCU + 1
+1270 : f0 ef __ BEQ $1261
+1272 : d0 ea __ BNE $125e
+1274 : a5 1b __ LDA ACCU + 0
+1276 : 05 1c __ ORA ACCU + 1
+1278 : d0 e7 __ BNE $1261
+127a : f0 e2 __ BEQ $125e
+127c : a5 1c __ LDA ACCU + 1
+127e : 30 de __ BMI $125e
+1280 : 05 1b __ ORA ACCU + 0
+1282 : d0 dd __ BNE $1261
+1284 : f0 d8 __ BEQ $125e
+1286 : a5 1c __ LDA ACCU + 1
+1288 : 10 d7 __ BPL $1261
+128a : 30 d2 __ BMI $125e
+128c : a5 1c __ LDA ACCU + 1
+128e : 30 d1 __ BMI $1261
+1290 : 10 cc __ BPL $125e
+1292 : a5 1c __ LDA ACCU + 1
+1294 : 30 cb __ BMI $1261
+1296 : 05 1b __ ORA ACCU + 0
+1298 : f0 c7 __ BEQ $1261
+129a : d0 c2 __ BNE $125e
+129c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+129d : b1 19 __ LDA (IP + 0),y
+129f : 8d b3 12 STA $12b3 ; (inp_jsr + 22)
+12a2 : c8 __ __ INY
+12a3 : b1 19 __ LDA (IP + 0),y
+12a5 : 8d b4 12 STA $12b4 ; (inp_jsr + 23)
+12a8 : 98 __ __ TYA
+12a9 : 38 __ __ SEC
+12aa : 65 19 __ ADC IP + 0
+12ac : 85 19 __ STA IP + 0
+12ae : 90 02 __ BCC $12b2
+12b0 : e6 1a __ INC IP + 1
+12b2 : 20 00 00 JSR $0000 
+12b5 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+12b8 : 98 __ __ TYA
+12b9 : 18 __ __ CLC
+12ba : 65 19 __ ADC IP + 0
+12bc : 8d c7 12 STA $12c7 ; (inp_native + 15)
+12bf : a5 1a __ LDA IP + 1
+12c1 : 69 00 __ ADC #$00
+12c3 : 8d c8 12 STA $12c8 ; (inp_native + 16)
+12c6 : 20 00 00 JSR $0000 
+12c9 : a0 00 __ LDY #$00
+12cb : b1 23 __ LDA (SP + 0),y
+12cd : 85 19 __ STA IP + 0
+12cf : c8 __ __ INY
+12d0 : b1 23 __ LDA (SP + 0),y
+12d2 : 85 1a __ STA IP + 1
+12d4 : 88 __ __ DEY
+12d5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+12d8 : 38 __ __ SEC
+12d9 : a5 23 __ LDA SP + 0
+12db : f1 19 __ SBC (IP + 0),y
+12dd : c8 __ __ INY
+12de : 85 23 __ STA SP + 0
+12e0 : a5 24 __ LDA SP + 1
+12e2 : f1 19 __ SBC (IP + 0),y
+12e4 : c8 __ __ INY
+12e5 : 85 24 __ STA SP + 1
+12e7 : b1 19 __ LDA (IP + 0),y
+12e9 : 84 02 __ STY $02
+12eb : a8 __ __ TAY
+12ec : a5 25 __ LDA FP + 0
+12ee : 91 23 __ STA (SP + 0),y
+12f0 : c8 __ __ INY
+12f1 : a5 26 __ LDA FP + 1
+12f3 : 91 23 __ STA (SP + 0),y
+12f5 : 98 __ __ TYA
+12f6 : 38 __ __ SEC
+12f7 : 65 23 __ ADC SP + 0
+12f9 : 85 25 __ STA FP + 0
+12fb : a9 00 __ LDA #$00
+12fd : 65 24 __ ADC SP + 1
+12ff : 85 26 __ STA FP + 1
+1301 : 88 __ __ DEY
+1302 : f0 08 __ BEQ $130c
+1304 : b9 52 00 LDA $0052,y 
+1307 : 88 __ __ DEY
+1308 : 91 23 __ STA (SP + 0),y
+130a : d0 f8 __ BNE $1304
+130c : a4 02 __ LDY $02
+130e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+1311 : b1 19 __ LDA (IP + 0),y
+1313 : c8 __ __ INY
+1314 : 84 02 __ STY $02
+1316 : a8 __ __ TAY
+1317 : b1 23 __ LDA (SP + 0),y
+1319 : 85 25 __ STA FP + 0
+131b : c8 __ __ INY
+131c : b1 23 __ LDA (SP + 0),y
+131e : 85 26 __ STA FP + 1
+1320 : 88 __ __ DEY
+1321 : f0 09 __ BEQ $132c
+1323 : 88 __ __ DEY
+1324 : b1 23 __ LDA (SP + 0),y
+1326 : 99 53 00 STA $0053,y 
+1329 : 88 __ __ DEY
+132a : 10 f8 __ BPL $1324
+132c : a4 02 __ LDY $02
+132e : 18 __ __ CLC
+132f : b1 19 __ LDA (IP + 0),y
+1331 : c8 __ __ INY
+1332 : 65 23 __ ADC SP + 0
+1334 : 85 23 __ STA SP + 0
+1336 : b1 19 __ LDA (IP + 0),y
+1338 : c8 __ __ INY
+1339 : 65 24 __ ADC SP + 1
+133b : 85 24 __ STA SP + 1
+133d : a0 01 __ LDY #$01
+133f : b1 23 __ LDA (SP + 0),y
+1341 : 85 1a __ STA IP + 1
+1343 : 88 __ __ DEY
+1344 : b1 23 __ LDA (SP + 0),y
+1346 : 85 19 __ STA IP + 0
+1348 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+134b : b1 19 __ LDA (IP + 0),y
+134d : 85 1f __ STA ADDR + 0
+134f : c8 __ __ INY
+1350 : b1 19 __ LDA (IP + 0),y
+1352 : 85 20 __ STA ADDR + 1
+1354 : c8 __ __ INY
+1355 : 98 __ __ TYA
+1356 : a0 00 __ LDY #$00
+1358 : 18 __ __ CLC
+1359 : 65 19 __ ADC IP + 0
+135b : 91 23 __ STA (SP + 0),y
+135d : c8 __ __ INY
+135e : a5 1a __ LDA IP + 1
+1360 : 69 00 __ ADC #$00
+1362 : 91 23 __ STA (SP + 0),y
+1364 : a5 1f __ LDA ADDR + 0
+1366 : 85 19 __ STA IP + 0
+1368 : a5 20 __ LDA ADDR + 1
+136a : 85 1a __ STA IP + 1
+136c : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+136f : 38 __ __ SEC
+1370 : a5 23 __ LDA SP + 0
+1372 : f1 19 __ SBC (IP + 0),y
+1374 : c8 __ __ INY
+1375 : 85 23 __ STA SP + 0
+1377 : a5 24 __ LDA SP + 1
+1379 : f1 19 __ SBC (IP + 0),y
+137b : 85 24 __ STA SP + 1
+137d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+1380 : 18 __ __ CLC
+1381 : b1 19 __ LDA (IP + 0),y
+1383 : c8 __ __ INY
+1384 : 65 23 __ ADC SP + 0
+1386 : 85 23 __ STA SP + 0
+1388 : b1 19 __ LDA (IP + 0),y
+138a : 65 24 __ ADC SP + 1
+138c : 85 24 __ STA SP + 1
+138e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+1391 : b1 19 __ LDA (IP + 0),y
+1393 : 84 02 __ STY $02
+1395 : a8 __ __ TAY
+1396 : 88 __ __ DEY
+1397 : f0 07 __ BEQ $13a0
+1399 : b1 1b __ LDA (ACCU + 0),y
+139b : 91 1f __ STA (ADDR + 0),y
+139d : 88 __ __ DEY
+139e : d0 f9 __ BNE $1399
+13a0 : b1 1b __ LDA (ACCU + 0),y
+13a2 : 91 1f __ STA (ADDR + 0),y
+13a4 : a4 02 __ LDY $02
+13a6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+13a9 : 84 02 __ STY $02
+13ab : a0 ff __ LDY #$ff
+13ad : c8 __ __ INY
+13ae : b1 1b __ LDA (ACCU + 0),y
+13b0 : 91 1f __ STA (ADDR + 0),y
+13b2 : d0 f9 __ BNE $13ad
+13b4 : a4 02 __ LDY $02
+13b6 : 4c 51 08 JMP $0851 ; (startup + 80)
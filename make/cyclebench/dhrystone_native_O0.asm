@@ -0,0 +1,1509 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 4d 14 STX $144d ; (spentry + 0)
+0811 : a9 4e __ LDA #$4e
+0813 : 85 19 __ STA IP + 0
+0815 : a9 14 __ LDA #$14
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 28 __ LDA #$28
+081c : e9 14 __ SBC #$14
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 8d __ LDA #$8d
+0832 : e9 4e __ SBC #$4e
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 3f 13 JMP $133f ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 48 __ SBC #$48
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 03 __ LDY #$03
+090f : a5 25 __ LDA FP + 0
+0911 : 91 23 __ STA (SP + 0),y
+0913 : c8 __ __ INY
+0914 : a5 26 __ LDA FP + 1
+0916 : 91 23 __ STA (SP + 0),y
+0918 : 88 __ __ DEY
+0919 : 88 __ __ DEY
+091a : b9 53 00 LDA $0053,y 
+091d : 91 23 __ STA (SP + 0),y
+091f : 88 __ __ DEY
+0920 : 10 f8 __ BPL $091a
+0922 : 18 __ __ CLC
+0923 : a5 23 __ LDA SP + 0
+0925 : 69 05 __ ADC #$05
+0927 : 85 25 __ STA FP + 0
+0929 : a5 24 __ LDA SP + 1
+092b : 69 00 __ ADC #$00
+092d : 85 26 __ STA FP + 1
+092f : 38 __ __ SEC
+0930 : a5 23 __ LDA SP + 0
+0932 : e9 06 __ SBC #$06
+0934 : 85 23 __ STA SP + 0
+0936 : a5 24 __ LDA SP + 1
+0938 : e9 00 __ SBC #$00
+093a : 85 24 __ STA SP + 1
+093c : a9 4e __ LDA #$4e
+093e : 8d 73 14 STA $1473 ; (Next_Ptr_Glob + 0)
+0941 : a9 14 __ LDA #$14
+0943 : 8d 74 14 STA $1474 ; (Next_Ptr_Glob + 1)
+0946 : a9 75 __ LDA #$75
+0948 : 8d 9a 14 STA $149a ; (Ptr_Glob + 0)
+094b : a9 14 __ LDA #$14
+094d : 8d 9b 14 STA $149b ; (Ptr_Glob + 1)
+0950 : a9 4e __ LDA #$4e
+0952 : 8d 75 14 STA $1475 ; (Glob_Rec + 0)
+0955 : a9 14 __ LDA #$14
+0957 : 8d 76 14 STA $1476 ; (Glob_Rec + 1)
+095a : a9 00 __ LDA #$00
+095c : 8d 77 14 STA $1477 ; (Glob_Rec + 2)
+095f : a9 02 __ LDA #$02
+0961 : 8d 78 14 STA $1478 ; (Glob_Rec + 3)
+0964 : a9 28 __ LDA #$28
+0966 : 8d 79 14 STA $1479 ; (Glob_Rec + 4)
+0969 : a9 00 __ LDA #$00
+096b : 8d 7a 14 STA $147a ; (Glob_Rec + 5)
+096e : a0 ff __ LDY #$ff
+0970 : c8 __ __ INY
+0971 : b9 54 0d LDA $0d54,y 
+0974 : 99 7b 14 STA $147b,y ; (Glob_Rec + 6)
+0977 : d0 f7 __ BNE $0970
+0979 : 18 __ __ CLC
+097a : a5 25 __ LDA FP + 0
+097c : 69 05 __ ADC #$05
+097e : 85 4c __ STA T0 + 0
+0980 : a5 26 __ LDA FP + 1
+0982 : 69 00 __ ADC #$00
+0984 : 85 4d __ STA T0 + 1
+0986 : a0 ff __ LDY #$ff
+0988 : c8 __ __ INY
+0989 : b9 73 0d LDA $0d73,y 
+098c : 91 4c __ STA (T0 + 0),y
+098e : d0 f8 __ BNE $0988
+0990 : a9 0a __ LDA #$0a
+0992 : 8d ca 17 STA $17ca ; (Arr_2_Glob + 814)
+0995 : a9 00 __ LDA #$00
+0997 : 8d cb 17 STA $17cb ; (Arr_2_Glob + 815)
+099a : a9 01 __ LDA #$01
+099c : 85 4c __ STA T0 + 0
+099e : a9 00 __ LDA #$00
+09a0 : 85 4d __ STA T0 + 1
+09a2 : 20 92 0d JSR $0d92 ; (Proc_5 + 0)
+09a5 : 20 9d 0d JSR $0d9d ; (Proc_4 + 0)
+09a8 : a9 02 __ LDA #$02
+09aa : a0 00 __ LDY #$00
+09ac : 91 25 __ STA (FP + 0),y
+09ae : a9 00 __ LDA #$00
+09b0 : c8 __ __ INY
+09b1 : 91 25 __ STA (FP + 0),y
+09b3 : 18 __ __ CLC
+09b4 : a5 25 __ LDA FP + 0
+09b6 : 69 24 __ ADC #$24
+09b8 : 85 4e __ STA T1 + 0
+09ba : a5 26 __ LDA FP + 1
+09bc : 69 00 __ ADC #$00
+09be : 85 4f __ STA T1 + 1
+09c0 : a0 ff __ LDY #$ff
+09c2 : c8 __ __ INY
+09c3 : b9 b7 0d LDA $0db7,y 
+09c6 : 91 4e __ STA (T1 + 0),y
+09c8 : d0 f8 __ BNE $09c2
+09ca : a9 01 __ LDA #$01
+09cc : a0 04 __ LDY #$04
+09ce : 91 25 __ STA (FP + 0),y
+09d0 : 18 __ __ CLC
+09d1 : a5 25 __ LDA FP + 0
+09d3 : 69 05 __ ADC #$05
+09d5 : a0 02 __ LDY #$02
+09d7 : 91 23 __ STA (SP + 0),y
+09d9 : a5 26 __ LDA FP + 1
+09db : 69 00 __ ADC #$00
+09dd : c8 __ __ INY
+09de : 91 23 __ STA (SP + 0),y
+09e0 : a5 4e __ LDA T1 + 0
+09e2 : c8 __ __ INY
+09e3 : 91 23 __ STA (SP + 0),y
+09e5 : a5 4f __ LDA T1 + 1
+09e7 : c8 __ __ INY
+09e8 : 91 23 __ STA (SP + 0),y
+09ea : 20 d6 0d JSR $0dd6 ; (Func_2 + 0)
+09ed : a5 1b __ LDA ACCU + 0
+09ef : d0 03 __ BNE $09f4
+09f1 : 4c 4f 0d JMP $0d4f ; (main + 1103)
+09f4 : a9 00 __ LDA #$00
+09f6 : 8d 25 28 STA $2825 ; (Bool_Glob + 0)
+09f9 : a9 03 __ LDA #$03
+09fb : 85 4e __ STA T1 + 0
+09fd : a9 00 __ LDA #$00
+09ff : 85 4f __ STA T1 + 1
+0a01 : a0 00 __ LDY #$00
+0a03 : b1 25 __ LDA (FP + 0),y
+0a05 : 85 50 __ STA T2 + 0
+0a07 : c8 __ __ INY
+0a08 : b1 25 __ LDA (FP + 0),y
+0a0a : 30 03 __ BMI $0a0f
+0a0c : 4c 3e 0d JMP $0d3e ; (main + 1086)
+0a0f : 18 __ __ CLC
+0a10 : a5 25 __ LDA FP + 0
+0a12 : 69 02 __ ADC #$02
+0a14 : 85 50 __ STA T2 + 0
+0a16 : a5 26 __ LDA FP + 1
+0a18 : 69 00 __ ADC #$00
+0a1a : 85 51 __ STA T2 + 1
+0a1c : a0 00 __ LDY #$00
+0a1e : b1 25 __ LDA (FP + 0),y
+0a20 : 85 53 __ STA T4 + 0
+0a22 : 85 0d __ STA P0
+0a24 : 0a __ __ ASL
+0a25 : 85 07 __ STA $07
+0a27 : c8 __ __ INY
+0a28 : b1 25 __ LDA (FP + 0),y
+0a2a : 85 54 __ STA T4 + 1
+0a2c : 85 0e __ STA P1
+0a2e : 2a __ __ ROL
+0a2f : 06 07 __ ASL $07
+0a31 : 2a __ __ ROL
+0a32 : aa __ __ TAX
+0a33 : 18 __ __ CLC
+0a34 : a5 07 __ LDA $07
+0a36 : 65 53 __ ADC T4 + 0
+0a38 : 85 1b __ STA ACCU + 0
+0a3a : 8a __ __ TXA
+0a3b : 65 54 __ ADC T4 + 1
+0a3d : 85 1c __ STA ACCU + 1
+0a3f : 38 __ __ SEC
+0a40 : a5 1b __ LDA ACCU + 0
+0a42 : e9 03 __ SBC #$03
+0a44 : c8 __ __ INY
+0a45 : 91 25 __ STA (FP + 0),y
+0a47 : a5 1c __ LDA ACCU + 1
+0a49 : e9 00 __ SBC #$00
+0a4b : c8 __ __ INY
+0a4c : 91 25 __ STA (FP + 0),y
+0a4e : a9 03 __ LDA #$03
+0a50 : 85 0f __ STA P2
+0a52 : a9 00 __ LDA #$00
+0a54 : 85 10 __ STA P3
+0a56 : a5 50 __ LDA T2 + 0
+0a58 : 85 11 __ STA P4
+0a5a : a5 51 __ LDA T2 + 1
+0a5c : 85 12 __ STA P5
+0a5e : 20 9a 0e JSR $0e9a ; (Proc_7 + 0)
+0a61 : 18 __ __ CLC
+0a62 : a0 00 __ LDY #$00
+0a64 : b1 25 __ LDA (FP + 0),y
+0a66 : 69 01 __ ADC #$01
+0a68 : 85 53 __ STA T4 + 0
+0a6a : c8 __ __ INY
+0a6b : b1 25 __ LDA (FP + 0),y
+0a6d : 69 00 __ ADC #$00
+0a6f : aa __ __ TAX
+0a70 : a5 53 __ LDA T4 + 0
+0a72 : 88 __ __ DEY
+0a73 : 91 25 __ STA (FP + 0),y
+0a75 : 8a __ __ TXA
+0a76 : c8 __ __ INY
+0a77 : 91 25 __ STA (FP + 0),y
+0a79 : 09 00 __ ORA #$00
+0a7b : 30 9f __ BMI $0a1c
+0a7d : d0 06 __ BNE $0a85
+0a7f : a5 53 __ LDA T4 + 0
+0a81 : c9 03 __ CMP #$03
+0a83 : 90 97 __ BCC $0a1c
+0a85 : a9 29 __ LDA #$29
+0a87 : 85 0d __ STA P0
+0a89 : a9 28 __ LDA #$28
+0a8b : 85 0e __ STA P1
+0a8d : a9 9c __ LDA #$9c
+0a8f : 85 0f __ STA P2
+0a91 : a9 14 __ LDA #$14
+0a93 : 85 10 __ STA P3
+0a95 : a0 00 __ LDY #$00
+0a97 : b1 25 __ LDA (FP + 0),y
+0a99 : 85 11 __ STA P4
+0a9b : c8 __ __ INY
+0a9c : b1 25 __ LDA (FP + 0),y
+0a9e : 85 12 __ STA P5
+0aa0 : c8 __ __ INY
+0aa1 : b1 25 __ LDA (FP + 0),y
+0aa3 : 85 13 __ STA P6
+0aa5 : c8 __ __ INY
+0aa6 : b1 25 __ LDA (FP + 0),y
+0aa8 : 85 14 __ STA P7
+0aaa : 20 b8 0e JSR $0eb8 ; (Proc_8 + 0)
+0aad : ad 9a 14 LDA $149a ; (Ptr_Glob + 0)
+0ab0 : a0 02 __ LDY #$02
+0ab2 : 91 23 __ STA (SP + 0),y
+0ab4 : ad 9b 14 LDA $149b ; (Ptr_Glob + 1)
+0ab7 : c8 __ __ INY
+0ab8 : 91 23 __ STA (SP + 0),y
+0aba : 20 87 10 JSR $1087 ; (Proc_1 + 0)
+0abd : ad 26 28 LDA $2826 ; (Ch_2_Glob + 0)
+0ac0 : c9 41 __ CMP #$41
+0ac2 : 90 27 __ BCC $0aeb
+0ac4 : a9 41 __ LDA #$41
+0ac6 : 85 52 __ STA T3 + 0
+0ac8 : a0 04 __ LDY #$04
+0aca : b1 25 __ LDA (FP + 0),y
+0acc : 85 55 __ STA T6 + 0
+0ace : a5 52 __ LDA T3 + 0
+0ad0 : 85 0d __ STA P0
+0ad2 : a9 43 __ LDA #$43
+0ad4 : 85 0e __ STA P1
+0ad6 : 20 52 0e JSR $0e52 ; (Func_1 + 0)
+0ad9 : a5 55 __ LDA T6 + 0
+0adb : c5 1b __ CMP ACCU + 0
+0add : d0 03 __ BNE $0ae2
+0adf : 4c f8 0c JMP $0cf8 ; (main + 1016)
+0ae2 : ae 26 28 LDX $2826 ; (Ch_2_Glob + 0)
+0ae5 : e6 52 __ INC T3 + 0
+0ae7 : e4 52 __ CPX T3 + 0
+0ae9 : b0 dd __ BCS $0ac8
+0aeb : a0 00 __ LDY #$00
+0aed : b1 25 __ LDA (FP + 0),y
+0aef : 85 1b __ STA ACCU + 0
+0af1 : c8 __ __ INY
+0af2 : b1 25 __ LDA (FP + 0),y
+0af4 : 85 1c __ STA ACCU + 1
+0af6 : a5 4e __ LDA T1 + 0
+0af8 : 85 03 __ STA $03
+0afa : a5 4f __ LDA T1 + 1
+0afc : 85 04 __ STA $04
+0afe : 20 4c 13 JSR $134c ; (mul16 + 0)
+0b01 : a5 05 __ LDA $05
+0b03 : 85 1b __ STA ACCU + 0
+0b05 : 85 4e __ STA T1 + 0
+0b07 : a5 06 __ LDA $06
+0b09 : 85 1c __ STA ACCU + 1
+0b0b : 85 4f __ STA T1 + 1
+0b0d : a0 02 __ LDY #$02
+0b0f : b1 25 __ LDA (FP + 0),y
+0b11 : 85 50 __ STA T2 + 0
+0b13 : 85 03 __ STA $03
+0b15 : c8 __ __ INY
+0b16 : b1 25 __ LDA (FP + 0),y
+0b18 : 85 51 __ STA T2 + 1
+0b1a : 85 04 __ STA $04
+0b1c : 20 8e 13 JSR $138e ; (divs16 + 0)
+0b1f : a5 1b __ LDA ACCU + 0
+0b21 : 85 53 __ STA T4 + 0
+0b23 : a5 1c __ LDA ACCU + 1
+0b25 : 85 54 __ STA T4 + 1
+0b27 : a5 1b __ LDA ACCU + 0
+0b29 : a0 00 __ LDY #$00
+0b2b : 91 25 __ STA (FP + 0),y
+0b2d : a5 1c __ LDA ACCU + 1
+0b2f : c8 __ __ INY
+0b30 : 91 25 __ STA (FP + 0),y
+0b32 : a5 25 __ LDA FP + 0
+0b34 : 85 0d __ STA P0
+0b36 : a5 26 __ LDA FP + 1
+0b38 : 85 0e __ STA P1
+0b3a : 20 bc 12 JSR $12bc ; (Proc_2 + 0)
+0b3d : e6 4c __ INC T0 + 0
+0b3f : d0 02 __ BNE $0b43
+0b41 : e6 4d __ INC T0 + 1
+0b43 : a5 4d __ LDA T0 + 1
+0b45 : 49 80 __ EOR #$80
+0b47 : c9 81 __ CMP #$81
+0b49 : d0 04 __ BNE $0b4f
+0b4b : a5 4c __ LDA T0 + 0
+0b4d : c9 f5 __ CMP #$f5
+0b4f : b0 03 __ BCS $0b54
+0b51 : 4c a2 09 JMP $09a2 ; (main + 162)
+0b54 : ad 27 28 LDA $2827 ; (Int_Glob + 0)
+0b57 : 85 4c __ STA T0 + 0
+0b59 : ad 28 28 LDA $2828 ; (Int_Glob + 1)
+0b5c : d0 19 __ BNE $0b77
+0b5e : a5 4c __ LDA T0 + 0
+0b60 : c9 05 __ CMP #$05
+0b62 : d0 13 __ BNE $0b77
+0b64 : ad 25 28 LDA $2825 ; (Bool_Glob + 0)
+0b67 : f0 0e __ BEQ $0b77
+0b69 : ad 24 28 LDA $2824 ; (Ch_1_Glob + 0)
+0b6c : c9 41 __ CMP #$41
+0b6e : d0 07 __ BNE $0b77
+0b70 : ad 26 28 LDA $2826 ; (Ch_2_Glob + 0)
+0b73 : c9 42 __ CMP #$42
+0b75 : f0 38 __ BEQ $0baf
+0b77 : a9 01 __ LDA #$01
+0b79 : 85 1b __ STA ACCU + 0
+0b7b : a9 00 __ LDA #$00
+0b7d : 85 1c __ STA ACCU + 1
+0b7f : 18 __ __ CLC
+0b80 : a5 23 __ LDA SP + 0
+0b82 : 69 06 __ ADC #$06
+0b84 : 85 23 __ STA SP + 0
+0b86 : a5 24 __ LDA SP + 1
+0b88 : 69 00 __ ADC #$00
+0b8a : 85 24 __ STA SP + 1
+0b8c : a0 03 __ LDY #$03
+0b8e : b1 23 __ LDA (SP + 0),y
+0b90 : 85 25 __ STA FP + 0
+0b92 : c8 __ __ INY
+0b93 : b1 23 __ LDA (SP + 0),y
+0b95 : 85 26 __ STA FP + 1
+0b97 : 88 __ __ DEY
+0b98 : 88 __ __ DEY
+0b99 : b1 23 __ LDA (SP + 0),y
+0b9b : 99 53 00 STA $0053,y 
+0b9e : 88 __ __ DEY
+0b9f : 10 f8 __ BPL $0b99
+0ba1 : 18 __ __ CLC
+0ba2 : a5 23 __ LDA SP + 0
+0ba4 : 69 48 __ ADC #$48
+0ba6 : 85 23 __ STA SP + 0
+0ba8 : a5 24 __ LDA SP + 1
+0baa : 69 00 __ ADC #$00
+0bac : 85 24 __ STA SP + 1
+0bae : 60 __ __ RTS
+0baf : ad 39 28 LDA $2839 ; (Arr_1_Glob + 16)
+0bb2 : 85 4c __ STA T0 + 0
+0bb4 : ad 3a 28 LDA $283a ; (Arr_1_Glob + 17)
+0bb7 : d0 18 __ BNE $0bd1
+0bb9 : a5 4c __ LDA T0 + 0
+0bbb : c9 07 __ CMP #$07
+0bbd : d0 12 __ BNE $0bd1
+0bbf : ad ca 17 LDA $17ca ; (Arr_2_Glob + 814)
+0bc2 : 85 4c __ STA T0 + 0
+0bc4 : ad cb 17 LDA $17cb ; (Arr_2_Glob + 815)
+0bc7 : c9 01 __ CMP #$01
+0bc9 : d0 06 __ BNE $0bd1
+0bcb : a5 4c __ LDA T0 + 0
+0bcd : c9 fe __ CMP #$fe
+0bcf : f0 09 __ BEQ $0bda
+0bd1 : a9 02 __ LDA #$02
+0bd3 : 85 1b __ STA ACCU + 0
+0bd5 : a9 00 __ LDA #$00
+0bd7 : 4c 7d 0b JMP $0b7d ; (main + 637)
+0bda : ad 9a 14 LDA $149a ; (Ptr_Glob + 0)
+0bdd : 85 4c __ STA T0 + 0
+0bdf : ad 9b 14 LDA $149b ; (Ptr_Glob + 1)
+0be2 : 85 4d __ STA T0 + 1
+0be4 : a0 02 __ LDY #$02
+0be6 : b1 4c __ LDA (T0 + 0),y
+0be8 : d0 19 __ BNE $0c03
+0bea : a0 03 __ LDY #$03
+0bec : b1 4c __ LDA (T0 + 0),y
+0bee : c9 02 __ CMP #$02
+0bf0 : d0 11 __ BNE $0c03
+0bf2 : a0 04 __ LDY #$04
+0bf4 : b1 4c __ LDA (T0 + 0),y
+0bf6 : 85 43 __ STA T5 + 0
+0bf8 : c8 __ __ INY
+0bf9 : b1 4c __ LDA (T0 + 0),y
+0bfb : d0 06 __ BNE $0c03
+0bfd : a5 43 __ LDA T5 + 0
+0bff : c9 11 __ CMP #$11
+0c01 : f0 09 __ BEQ $0c0c
+0c03 : a9 03 __ LDA #$03
+0c05 : 85 1b __ STA ACCU + 0
+0c07 : a9 00 __ LDA #$00
+0c09 : 4c 7d 0b JMP $0b7d ; (main + 637)
+0c0c : ad 73 14 LDA $1473 ; (Next_Ptr_Glob + 0)
+0c0f : 85 43 __ STA T5 + 0
+0c11 : ad 74 14 LDA $1474 ; (Next_Ptr_Glob + 1)
+0c14 : 85 44 __ STA T5 + 1
+0c16 : a0 02 __ LDY #$02
+0c18 : b1 43 __ LDA (T5 + 0),y
+0c1a : d0 19 __ BNE $0c35
+0c1c : a0 03 __ LDY #$03
+0c1e : b1 43 __ LDA (T5 + 0),y
+0c20 : c9 01 __ CMP #$01
+0c22 : d0 11 __ BNE $0c35
+0c24 : a0 04 __ LDY #$04
+0c26 : b1 43 __ LDA (T5 + 0),y
+0c28 : 85 02 __ STA $02
+0c2a : c8 __ __ INY
+0c2b : b1 43 __ LDA (T5 + 0),y
+0c2d : d0 06 __ BNE $0c35
+0c2f : a5 02 __ LDA $02
+0c31 : c9 12 __ CMP #$12
+0c33 : f0 09 __ BEQ $0c3e
+0c35 : a9 04 __ LDA #$04
+0c37 : 85 1b __ STA ACCU + 0
+0c39 : a9 00 __ LDA #$00
+0c3b : 4c 7d 0b JMP $0b7d ; (main + 637)
+0c3e : a0 00 __ LDY #$00
+0c40 : b1 25 __ LDA (FP + 0),y
+0c42 : 85 43 __ STA T5 + 0
+0c44 : c8 __ __ INY
+0c45 : b1 25 __ LDA (FP + 0),y
+0c47 : d0 5a __ BNE $0ca3
+0c49 : a5 43 __ LDA T5 + 0
+0c4b : c9 05 __ CMP #$05
+0c4d : d0 54 __ BNE $0ca3
+0c4f : 38 __ __ SEC
+0c50 : a5 4e __ LDA T1 + 0
+0c52 : e5 50 __ SBC T2 + 0
+0c54 : 85 4e __ STA T1 + 0
+0c56 : a5 4f __ LDA T1 + 1
+0c58 : e5 51 __ SBC T2 + 1
+0c5a : 85 4f __ STA T1 + 1
+0c5c : a5 4e __ LDA T1 + 0
+0c5e : 0a __ __ ASL
+0c5f : 85 07 __ STA $07
+0c61 : a5 4f __ LDA T1 + 1
+0c63 : 2a __ __ ROL
+0c64 : 06 07 __ ASL $07
+0c66 : 2a __ __ ROL
+0c67 : 06 07 __ ASL $07
+0c69 : 2a __ __ ROL
+0c6a : aa __ __ TAX
+0c6b : 38 __ __ SEC
+0c6c : a5 07 __ LDA $07
+0c6e : e5 4e __ SBC T1 + 0
+0c70 : 85 1b __ STA ACCU + 0
+0c72 : 8a __ __ TXA
+0c73 : e5 4f __ SBC T1 + 1
+0c75 : 85 1c __ STA ACCU + 1
+0c77 : 38 __ __ SEC
+0c78 : a5 1b __ LDA ACCU + 0
+0c7a : e5 53 __ SBC T4 + 0
+0c7c : 85 4e __ STA T1 + 0
+0c7e : a5 1c __ LDA ACCU + 1
+0c80 : e5 54 __ SBC T4 + 1
+0c82 : d0 1f __ BNE $0ca3
+0c84 : a5 4e __ LDA T1 + 0
+0c86 : c9 0d __ CMP #$0d
+0c88 : d0 19 __ BNE $0ca3
+0c8a : a0 02 __ LDY #$02
+0c8c : b1 25 __ LDA (FP + 0),y
+0c8e : 85 4e __ STA T1 + 0
+0c90 : c8 __ __ INY
+0c91 : b1 25 __ LDA (FP + 0),y
+0c93 : d0 0e __ BNE $0ca3
+0c95 : a5 4e __ LDA T1 + 0
+0c97 : c9 07 __ CMP #$07
+0c99 : d0 08 __ BNE $0ca3
+0c9b : a0 04 __ LDY #$04
+0c9d : b1 25 __ LDA (FP + 0),y
+0c9f : c9 01 __ CMP #$01
+0ca1 : f0 09 __ BEQ $0cac
+0ca3 : a9 05 __ LDA #$05
+0ca5 : 85 1b __ STA ACCU + 0
+0ca7 : a9 00 __ LDA #$00
+0ca9 : 4c 7d 0b JMP $0b7d ; (main + 637)
+0cac : 18 __ __ CLC
+0cad : a5 4c __ LDA T0 + 0
+0caf : 69 06 __ ADC #$06
+0cb1 : 85 0d __ STA P0
+0cb3 : a5 4d __ LDA T0 + 1
+0cb5 : 69 00 __ ADC #$00
+0cb7 : 85 0e __ STA P1
+0cb9 : a9 01 __ LDA #$01
+0cbb : 85 0f __ STA P2
+0cbd : a9 13 __ LDA #$13
+0cbf : 85 10 __ STA P3
+0cc1 : 20 6b 0e JSR $0e6b ; (strcmp + 0)
+0cc4 : a5 1b __ LDA ACCU + 0
+0cc6 : 05 1c __ ORA ACCU + 1
+0cc8 : d0 25 __ BNE $0cef
+0cca : 18 __ __ CLC
+0ccb : a5 25 __ LDA FP + 0
+0ccd : 69 24 __ ADC #$24
+0ccf : 85 0d __ STA P0
+0cd1 : a5 26 __ LDA FP + 1
+0cd3 : 69 00 __ ADC #$00
+0cd5 : 85 0e __ STA P1
+0cd7 : a9 20 __ LDA #$20
+0cd9 : 85 0f __ STA P2
+0cdb : a9 13 __ LDA #$13
+0cdd : 85 10 __ STA P3
+0cdf : 20 6b 0e JSR $0e6b ; (strcmp + 0)
+0ce2 : a5 1b __ LDA ACCU + 0
+0ce4 : 05 1c __ ORA ACCU + 1
+0ce6 : d0 07 __ BNE $0cef
+0ce8 : a9 00 __ LDA #$00
+0cea : 85 1b __ STA ACCU + 0
+0cec : 4c 7d 0b JMP $0b7d ; (main + 637)
+0cef : a9 06 __ LDA #$06
+0cf1 : 85 1b __ STA ACCU + 0
+0cf3 : a9 00 __ LDA #$00
+0cf5 : 4c 7d 0b JMP $0b7d ; (main + 637)
+0cf8 : 18 __ __ CLC
+0cf9 : a5 25 __ LDA FP + 0
+0cfb : 69 04 __ ADC #$04
+0cfd : aa __ __ TAX
+0cfe : a5 26 __ LDA FP + 1
+0d00 : 69 00 __ ADC #$00
+0d02 : 85 4f __ STA T1 + 1
+0d04 : a9 00 __ LDA #$00
+0d06 : a0 02 __ LDY #$02
+0d08 : 91 23 __ STA (SP + 0),y
+0d0a : 8a __ __ TXA
+0d0b : c8 __ __ INY
+0d0c : 91 23 __ STA (SP + 0),y
+0d0e : a5 4f __ LDA T1 + 1
+0d10 : c8 __ __ INY
+0d11 : 91 23 __ STA (SP + 0),y
+0d13 : 20 e3 11 JSR $11e3 ; (Proc_6 + 0)
+0d16 : 18 __ __ CLC
+0d17 : a5 25 __ LDA FP + 0
+0d19 : 69 24 __ ADC #$24
+0d1b : 85 4e __ STA T1 + 0
+0d1d : a5 26 __ LDA FP + 1
+0d1f : 69 00 __ ADC #$00
+0d21 : 85 4f __ STA T1 + 1
+0d23 : a0 ff __ LDY #$ff
+0d25 : c8 __ __ INY
+0d26 : b9 9d 12 LDA $129d,y 
+0d29 : 91 4e __ STA (T1 + 0),y
+0d2b : d0 f8 __ BNE $0d25
+0d2d : a5 4c __ LDA T0 + 0
+0d2f : 85 4e __ STA T1 + 0
+0d31 : 8d 27 28 STA $2827 ; (Int_Glob + 0)
+0d34 : a5 4d __ LDA T0 + 1
+0d36 : 85 4f __ STA T1 + 1
+0d38 : 8d 28 28 STA $2828 ; (Int_Glob + 1)
+0d3b : 4c e2 0a JMP $0ae2 ; (main + 482)
+0d3e : f0 03 __ BEQ $0d43
+0d40 : 4c 85 0a JMP $0a85 ; (main + 389)
+0d43 : a5 50 __ LDA T2 + 0
+0d45 : c9 03 __ CMP #$03
+0d47 : b0 03 __ BCS $0d4c
+0d49 : 4c 0f 0a JMP $0a0f ; (main + 271)
+0d4c : 4c 85 0a JMP $0a85 ; (main + 389)
+0d4f : a9 01 __ LDA #$01
+0d51 : 4c f6 09 JMP $09f6 ; (main + 246)
+--------------------------------------------------------------------
+Proc_5:
+0d92 : a9 41 __ LDA #$41
+0d94 : 8d 24 28 STA $2824 ; (Ch_1_Glob + 0)
+0d97 : a9 00 __ LDA #$00
+0d99 : 8d 25 28 STA $2825 ; (Bool_Glob + 0)
+0d9c : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_4:
+0d9d : ad 24 28 LDA $2824 ; (Ch_1_Glob + 0)
+0da0 : c9 41 __ CMP #$41
+0da2 : f0 0e __ BEQ $0db2
+0da4 : a9 00 __ LDA #$00
+0da6 : 0d 25 28 ORA $2825 ; (Bool_Glob + 0)
+0da9 : 8d 25 28 STA $2825 ; (Bool_Glob + 0)
+0dac : a9 42 __ LDA #$42
+0dae : 8d 26 28 STA $2826 ; (Ch_2_Glob + 0)
+0db1 : 60 __ __ RTS
+0db2 : a9 01 __ LDA #$01
+0db4 : 4c a6 0d JMP $0da6 ; (Proc_4 + 9)
+--------------------------------------------------------------------
+Func_2:
+0dd6 : a0 04 __ LDY #$04
+0dd8 : b1 23 __ LDA (SP + 0),y
+0dda : 85 45 __ STA T0 + 0
+0ddc : c8 __ __ INY
+0ddd : b1 23 __ LDA (SP + 0),y
+0ddf : 85 46 __ STA T0 + 1
+0de1 : a0 02 __ LDY #$02
+0de3 : b1 23 __ LDA (SP + 0),y
+0de5 : 85 47 __ STA T1 + 0
+0de7 : c8 __ __ INY
+0de8 : b1 23 __ LDA (SP + 0),y
+0dea : 85 48 __ STA T1 + 1
+0dec : 18 __ __ CLC
+0ded : a5 47 __ LDA T1 + 0
+0def : 69 02 __ ADC #$02
+0df1 : 85 49 __ STA T3 + 0
+0df3 : a5 48 __ LDA T1 + 1
+0df5 : 69 00 __ ADC #$00
+0df7 : 85 4a __ STA T3 + 1
+0df9 : a0 00 __ LDY #$00
+0dfb : b1 49 __ LDA (T3 + 0),y
+0dfd : 85 0d __ STA P0
+0dff : 18 __ __ CLC
+0e00 : a5 45 __ LDA T0 + 0
+0e02 : 69 02 __ ADC #$02
+0e04 : 85 43 __ STA T2 + 0
+0e06 : a5 46 __ LDA T0 + 1
+0e08 : 69 00 __ ADC #$00
+0e0a : 85 44 __ STA T2 + 1
+0e0c : c8 __ __ INY
+0e0d : b1 43 __ LDA (T2 + 0),y
+0e0f : 85 0e __ STA P1
+0e11 : 20 52 0e JSR $0e52 ; (Func_1 + 0)
+0e14 : a5 1b __ LDA ACCU + 0
+0e16 : d0 d4 __ BNE $0dec
+0e18 : a0 02 __ LDY #$02
+0e1a : b1 23 __ LDA (SP + 0),y
+0e1c : 85 0d __ STA P0
+0e1e : c8 __ __ INY
+0e1f : b1 23 __ LDA (SP + 0),y
+0e21 : 85 0e __ STA P1
+0e23 : c8 __ __ INY
+0e24 : b1 23 __ LDA (SP + 0),y
+0e26 : 85 0f __ STA P2
+0e28 : c8 __ __ INY
+0e29 : b1 23 __ LDA (SP + 0),y
+0e2b : 85 10 __ STA P3
+0e2d : 20 6b 0e JSR $0e6b ; (strcmp + 0)
+0e30 : a5 1c __ LDA ACCU + 1
+0e32 : 30 04 __ BMI $0e38
+0e34 : 05 1b __ ORA ACCU + 0
+0e36 : d0 07 __ BNE $0e3f
+0e38 : a9 00 __ LDA #$00
+0e3a : 85 1b __ STA ACCU + 0
+0e3c : 85 1c __ STA ACCU + 1
+0e3e : 60 __ __ RTS
+0e3f : a9 0a __ LDA #$0a
+0e41 : 8d 27 28 STA $2827 ; (Int_Glob + 0)
+0e44 : a9 00 __ LDA #$00
+0e46 : 8d 28 28 STA $2828 ; (Int_Glob + 1)
+0e49 : a9 01 __ LDA #$01
+0e4b : 85 1b __ STA ACCU + 0
+0e4d : a9 00 __ LDA #$00
+0e4f : 4c 3c 0e JMP $0e3c ; (Func_2 + 102)
+--------------------------------------------------------------------
+Func_1:
+0e52 : a5 0d __ LDA P0
+0e54 : c5 0e __ CMP P1
+0e56 : f0 07 __ BEQ $0e5f
+0e58 : a9 00 __ LDA #$00
+0e5a : 85 1b __ STA ACCU + 0
+0e5c : 85 1c __ STA ACCU + 1
+0e5e : 60 __ __ RTS
+0e5f : 8d 24 28 STA $2824 ; (Ch_1_Glob + 0)
+0e62 : a9 01 __ LDA #$01
+0e64 : 85 1b __ STA ACCU + 0
+0e66 : a9 00 __ LDA #$00
+0e68 : 4c 5c 0e JMP $0e5c ; (Func_1 + 10)
+--------------------------------------------------------------------
+strcmp:
+0e6b : a0 00 __ LDY #$00
+0e6d : 84 1c __ STY ACCU + 1
+0e6f : b1 0d __ LDA (P0),y
+0e71 : f0 16 __ BEQ $0e89
+0e73 : d1 0f __ CMP (P2),y
+0e75 : d0 16 __ BNE $0e8d
+0e77 : c8 __ __ INY
+0e78 : b1 0d __ LDA (P0),y
+0e7a : f0 0d __ BEQ $0e89
+0e7c : d1 0f __ CMP (P2),y
+0e7e : d0 0d __ BNE $0e8d
+0e80 : c8 __ __ INY
+0e81 : d0 ec __ BNE $0e6f
+0e83 : e6 0e __ INC P1
+0e85 : e6 10 __ INC P3
+0e87 : d0 e6 __ BNE $0e6f
+0e89 : d1 0f __ CMP (P2),y
+0e8b : f0 0a __ BEQ $0e97
+0e8d : b0 06 __ BCS $0e95
+0e8f : a9 ff __ LDA #$ff
+0e91 : 85 1c __ STA ACCU + 1
+0e93 : 30 02 __ BMI $0e97
+0e95 : a9 01 __ LDA #$01
+0e97 : 85 1b __ STA ACCU + 0
+0e99 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0e9a : 18 __ __ CLC
+0e9b : a5 0d __ LDA P0
+0e9d : 69 02 __ ADC #$02
+0e9f : 85 43 __ STA T0 + 0
+0ea1 : a5 0e __ LDA P1
+0ea3 : 69 00 __ ADC #$00
+0ea5 : 85 44 __ STA T0 + 1
+0ea7 : 18 __ __ CLC
+0ea8 : a5 0f __ LDA P2
+0eaa : 65 43 __ ADC T0 + 0
+0eac : a0 00 __ LDY #$00
+0eae : 91 11 __ STA (P4),y
+0eb0 : a5 10 __ LDA P3
+0eb2 : 65 44 __ ADC T0 + 1
+0eb4 : c8 __ __ INY
+0eb5 : 91 11 __ STA (P4),y
+0eb7 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_8:
+0eb8 : a5 11 __ LDA P4
+0eba : 0a __ __ ASL
+0ebb : 85 47 __ STA T2 + 0
+0ebd : a5 12 __ LDA P5
+0ebf : 2a __ __ ROL
+0ec0 : 85 48 __ STA T2 + 1
+0ec2 : 18 __ __ CLC
+0ec3 : a5 0d __ LDA P0
+0ec5 : 65 47 __ ADC T2 + 0
+0ec7 : 85 43 __ STA T0 + 0
+0ec9 : a5 0e __ LDA P1
+0ecb : 65 48 __ ADC T2 + 1
+0ecd : 85 44 __ STA T0 + 1
+0ecf : a5 13 __ LDA P6
+0ed1 : a0 0a __ LDY #$0a
+0ed3 : 91 43 __ STA (T0 + 0),y
+0ed5 : a5 14 __ LDA P7
+0ed7 : c8 __ __ INY
+0ed8 : 91 43 __ STA (T0 + 0),y
+0eda : a5 13 __ LDA P6
+0edc : c8 __ __ INY
+0edd : 91 43 __ STA (T0 + 0),y
+0edf : a5 14 __ LDA P7
+0ee1 : c8 __ __ INY
+0ee2 : 91 43 __ STA (T0 + 0),y
+0ee4 : 18 __ __ CLC
+0ee5 : a5 11 __ LDA P4
+0ee7 : 69 05 __ ADC #$05
+0ee9 : 85 47 __ STA T2 + 0
+0eeb : a0 46 __ LDY #$46
+0eed : 91 43 __ STA (T0 + 0),y
+0eef : a5 12 __ LDA P5
+0ef1 : 69 00 __ ADC #$00
+0ef3 : 85 48 __ STA T2 + 1
+0ef5 : c8 __ __ INY
+0ef6 : 91 43 __ STA (T0 + 0),y
+0ef8 : 18 __ __ CLC
+0ef9 : a5 11 __ LDA P4
+0efb : 69 06 __ ADC #$06
+0efd : 85 43 __ STA T0 + 0
+0eff : a5 12 __ LDA P5
+0f01 : 69 00 __ ADC #$00
+0f03 : aa __ __ TAX
+0f04 : a5 48 __ LDA T2 + 1
+0f06 : 49 80 __ EOR #$80
+0f08 : 85 03 __ STA $03
+0f0a : 8a __ __ TXA
+0f0b : 49 80 __ EOR #$80
+0f0d : c5 03 __ CMP $03
+0f0f : d0 04 __ BNE $0f15
+0f11 : a5 43 __ LDA T0 + 0
+0f13 : c5 47 __ CMP T2 + 0
+0f15 : b0 03 __ BCS $0f1a
+0f17 : 4c a6 0f JMP $0fa6 ; (Proc_8 + 238)
+0f1a : a5 47 __ LDA T2 + 0
+0f1c : 85 43 __ STA T0 + 0
+0f1e : a5 48 __ LDA T2 + 1
+0f20 : 85 44 __ STA T0 + 1
+0f22 : a5 47 __ LDA T2 + 0
+0f24 : 0a __ __ ASL
+0f25 : aa __ __ TAX
+0f26 : a5 48 __ LDA T2 + 1
+0f28 : 2a __ __ ROL
+0f29 : a8 __ __ TAY
+0f2a : 18 __ __ CLC
+0f2b : 8a __ __ TXA
+0f2c : 65 47 __ ADC T2 + 0
+0f2e : aa __ __ TAX
+0f2f : 98 __ __ TYA
+0f30 : 65 48 __ ADC T2 + 1
+0f32 : 85 03 __ STA $03
+0f34 : 8a __ __ TXA
+0f35 : 0a __ __ ASL
+0f36 : 26 03 __ ROL $03
+0f38 : 0a __ __ ASL
+0f39 : 26 03 __ ROL $03
+0f3b : 0a __ __ ASL
+0f3c : 26 03 __ ROL $03
+0f3e : 18 __ __ CLC
+0f3f : 65 47 __ ADC T2 + 0
+0f41 : 85 1b __ STA ACCU + 0
+0f43 : a5 03 __ LDA $03
+0f45 : 65 48 __ ADC T2 + 1
+0f47 : 06 1b __ ASL ACCU + 0
+0f49 : 2a __ __ ROL
+0f4a : 85 1c __ STA ACCU + 1
+0f4c : 18 __ __ CLC
+0f4d : a5 1b __ LDA ACCU + 0
+0f4f : 65 47 __ ADC T2 + 0
+0f51 : 85 45 __ STA T1 + 0
+0f53 : a5 1c __ LDA ACCU + 1
+0f55 : 65 48 __ ADC T2 + 1
+0f57 : 06 45 __ ASL T1 + 0
+0f59 : 2a __ __ ROL
+0f5a : 85 46 __ STA T1 + 1
+0f5c : 18 __ __ CLC
+0f5d : a5 0f __ LDA P2
+0f5f : 65 45 __ ADC T1 + 0
+0f61 : 85 45 __ STA T1 + 0
+0f63 : a5 10 __ LDA P3
+0f65 : 65 46 __ ADC T1 + 1
+0f67 : 85 46 __ STA T1 + 1
+0f69 : 18 __ __ CLC
+0f6a : a5 47 __ LDA T2 + 0
+0f6c : 69 01 __ ADC #$01
+0f6e : 85 4a __ STA T4 + 0
+0f70 : a5 48 __ LDA T2 + 1
+0f72 : 69 00 __ ADC #$00
+0f74 : 85 4b __ STA T4 + 1
+0f76 : a5 47 __ LDA T2 + 0
+0f78 : a0 00 __ LDY #$00
+0f7a : 91 45 __ STA (T1 + 0),y
+0f7c : a5 48 __ LDA T2 + 1
+0f7e : c8 __ __ INY
+0f7f : 91 45 __ STA (T1 + 0),y
+0f81 : 18 __ __ CLC
+0f82 : a5 45 __ LDA T1 + 0
+0f84 : 69 02 __ ADC #$02
+0f86 : 85 45 __ STA T1 + 0
+0f88 : 90 02 __ BCC $0f8c
+0f8a : e6 46 __ INC T1 + 1
+0f8c : e6 43 __ INC T0 + 0
+0f8e : d0 02 __ BNE $0f92
+0f90 : e6 44 __ INC T0 + 1
+0f92 : a5 44 __ LDA T0 + 1
+0f94 : 49 80 __ EOR #$80
+0f96 : 85 03 __ STA $03
+0f98 : a5 4b __ LDA T4 + 1
+0f9a : 49 80 __ EOR #$80
+0f9c : c5 03 __ CMP $03
+0f9e : d0 04 __ BNE $0fa4
+0fa0 : a5 4a __ LDA T4 + 0
+0fa2 : c5 43 __ CMP T0 + 0
+0fa4 : b0 d0 __ BCS $0f76
+0fa6 : a5 47 __ LDA T2 + 0
+0fa8 : 0a __ __ ASL
+0fa9 : aa __ __ TAX
+0faa : a5 48 __ LDA T2 + 1
+0fac : 2a __ __ ROL
+0fad : a8 __ __ TAY
+0fae : 18 __ __ CLC
+0faf : 8a __ __ TXA
+0fb0 : 65 47 __ ADC T2 + 0
+0fb2 : aa __ __ TAX
+0fb3 : 98 __ __ TYA
+0fb4 : 65 48 __ ADC T2 + 1
+0fb6 : 85 03 __ STA $03
+0fb8 : 8a __ __ TXA
+0fb9 : 0a __ __ ASL
+0fba : 26 03 __ ROL $03
+0fbc : 0a __ __ ASL
+0fbd : 26 03 __ ROL $03
+0fbf : 0a __ __ ASL
+0fc0 : 26 03 __ ROL $03
+0fc2 : 18 __ __ CLC
+0fc3 : 65 47 __ ADC T2 + 0
+0fc5 : 85 1b __ STA ACCU + 0
+0fc7 : a5 03 __ LDA $03
+0fc9 : 65 48 __ ADC T2 + 1
+0fcb : 06 1b __ ASL ACCU + 0
+0fcd : 2a __ __ ROL
+0fce : 85 1c __ STA ACCU + 1
+0fd0 : 18 __ __ CLC
+0fd1 : a5 1b __ LDA ACCU + 0
+0fd3 : 65 47 __ ADC T2 + 0
+0fd5 : aa __ __ TAX
+0fd6 : a5 1c __ LDA ACCU + 1
+0fd8 : 65 48 __ ADC T2 + 1
+0fda : a8 __ __ TAY
+0fdb : 38 __ __ SEC
+0fdc : 8a __ __ TXA
+0fdd : e9 01 __ SBC #$01
+0fdf : 85 45 __ STA T1 + 0
+0fe1 : 98 __ __ TYA
+0fe2 : e9 00 __ SBC #$00
+0fe4 : 06 45 __ ASL T1 + 0
+0fe6 : 2a __ __ ROL
+0fe7 : 85 46 __ STA T1 + 1
+0fe9 : 18 __ __ CLC
+0fea : a5 0f __ LDA P2
+0fec : 65 45 __ ADC T1 + 0
+0fee : 85 45 __ STA T1 + 0
+0ff0 : a5 10 __ LDA P3
+0ff2 : 65 46 __ ADC T1 + 1
+0ff4 : 85 46 __ STA T1 + 1
+0ff6 : 18 __ __ CLC
+0ff7 : a0 00 __ LDY #$00
+0ff9 : b1 45 __ LDA (T1 + 0),y
+0ffb : 69 01 __ ADC #$01
+0ffd : 91 45 __ STA (T1 + 0),y
+0fff : c8 __ __ INY
+1000 : b1 45 __ LDA (T1 + 0),y
+1002 : 69 00 __ ADC #$00
+1004 : 91 45 __ STA (T1 + 0),y
+1006 : a5 47 __ LDA T2 + 0
+1008 : 0a __ __ ASL
+1009 : 85 4a __ STA T4 + 0
+100b : a5 48 __ LDA T2 + 1
+100d : 2a __ __ ROL
+100e : 85 4b __ STA T4 + 1
+1010 : 18 __ __ CLC
+1011 : a5 0d __ LDA P0
+1013 : 65 4a __ ADC T4 + 0
+1015 : 85 45 __ STA T1 + 0
+1017 : a5 0e __ LDA P1
+1019 : 65 4b __ ADC T4 + 1
+101b : 85 46 __ STA T1 + 1
+101d : 18 __ __ CLC
+101e : a5 47 __ LDA T2 + 0
+1020 : 69 14 __ ADC #$14
+1022 : 85 4a __ STA T4 + 0
+1024 : a5 48 __ LDA T2 + 1
+1026 : 69 00 __ ADC #$00
+1028 : 85 4b __ STA T4 + 1
+102a : a5 4a __ LDA T4 + 0
+102c : 0a __ __ ASL
+102d : aa __ __ TAX
+102e : a5 4b __ LDA T4 + 1
+1030 : 2a __ __ ROL
+1031 : a8 __ __ TAY
+1032 : 18 __ __ CLC
+1033 : 8a __ __ TXA
+1034 : 65 4a __ ADC T4 + 0
+1036 : aa __ __ TAX
+1037 : 98 __ __ TYA
+1038 : 65 4b __ ADC T4 + 1
+103a : 85 03 __ STA $03
+103c : 8a __ __ TXA
+103d : 0a __ __ ASL
+103e : 26 03 __ ROL $03
+1040 : 0a __ __ ASL
+1041 : 26 03 __ ROL $03
+1043 : 0a __ __ ASL
+1044 : 26 03 __ ROL $03
+1046 : 18 __ __ CLC
+1047 : 65 4a __ ADC T4 + 0
+1049 : 85 1b __ STA ACCU + 0
+104b : a5 03 __ LDA $03
+104d : 65 4b __ ADC T4 + 1
+104f : 06 1b __ ASL ACCU + 0
+1051 : 2a __ __ ROL
+1052 : 85 1c __ STA ACCU + 1
+1054 : 18 __ __ CLC
+1055 : a5 1b __ LDA ACCU + 0
+1057 : 65 47 __ ADC T2 + 0
+1059 : 85 47 __ STA T2 + 0
+105b : a5 1c __ LDA ACCU + 1
+105d : 65 48 __ ADC T2 + 1
+105f : 06 47 __ ASL T2 + 0
+1061 : 2a __ __ ROL
+1062 : 85 48 __ STA T2 + 1
+1064 : 18 __ __ CLC
+1065 : a5 0f __ LDA P2
+1067 : 65 47 __ ADC T2 + 0
+1069 : 85 43 __ STA T0 + 0
+106b : a5 10 __ LDA P3
+106d : 65 48 __ ADC T2 + 1
+106f : 85 44 __ STA T0 + 1
+1071 : a0 00 __ LDY #$00
+1073 : b1 45 __ LDA (T1 + 0),y
+1075 : 91 43 __ STA (T0 + 0),y
+1077 : c8 __ __ INY
+1078 : b1 45 __ LDA (T1 + 0),y
+107a : 91 43 __ STA (T0 + 0),y
+107c : a9 05 __ LDA #$05
+107e : 8d 27 28 STA $2827 ; (Int_Glob + 0)
+1081 : a9 00 __ LDA #$00
+1083 : 8d 28 28 STA $2828 ; (Int_Glob + 1)
+1086 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_1:
+1087 : 38 __ __ SEC
+1088 : a5 23 __ LDA SP + 0
+108a : e9 05 __ SBC #$05
+108c : 85 23 __ STA SP + 0
+108e : a5 24 __ LDA SP + 1
+1090 : e9 00 __ SBC #$00
+1092 : 85 24 __ STA SP + 1
+1094 : a0 07 __ LDY #$07
+1096 : b1 23 __ LDA (SP + 0),y
+1098 : 85 43 __ STA T0 + 0
+109a : c8 __ __ INY
+109b : b1 23 __ LDA (SP + 0),y
+109d : 85 44 __ STA T0 + 1
+109f : a0 00 __ LDY #$00
+10a1 : b1 43 __ LDA (T0 + 0),y
+10a3 : 85 49 __ STA T1 + 0
+10a5 : c8 __ __ INY
+10a6 : b1 43 __ LDA (T0 + 0),y
+10a8 : 85 4a __ STA T1 + 1
+10aa : ad 9a 14 LDA $149a ; (Ptr_Glob + 0)
+10ad : 85 45 __ STA T2 + 0
+10af : ad 9b 14 LDA $149b ; (Ptr_Glob + 1)
+10b2 : 85 46 __ STA T2 + 1
+10b4 : 88 __ __ DEY
+10b5 : b1 43 __ LDA (T0 + 0),y
+10b7 : 85 47 __ STA T3 + 0
+10b9 : c8 __ __ INY
+10ba : b1 43 __ LDA (T0 + 0),y
+10bc : 85 48 __ STA T3 + 1
+10be : a0 24 __ LDY #$24
+10c0 : b1 45 __ LDA (T2 + 0),y
+10c2 : 91 47 __ STA (T3 + 0),y
+10c4 : 88 __ __ DEY
+10c5 : 10 f9 __ BPL $10c0
+10c7 : a9 05 __ LDA #$05
+10c9 : a0 04 __ LDY #$04
+10cb : 91 43 __ STA (T0 + 0),y
+10cd : a9 00 __ LDA #$00
+10cf : c8 __ __ INY
+10d0 : 91 43 __ STA (T0 + 0),y
+10d2 : a9 05 __ LDA #$05
+10d4 : 88 __ __ DEY
+10d5 : 91 49 __ STA (T1 + 0),y
+10d7 : a9 00 __ LDA #$00
+10d9 : c8 __ __ INY
+10da : 91 49 __ STA (T1 + 0),y
+10dc : a0 00 __ LDY #$00
+10de : b1 43 __ LDA (T0 + 0),y
+10e0 : 91 49 __ STA (T1 + 0),y
+10e2 : c8 __ __ INY
+10e3 : b1 43 __ LDA (T0 + 0),y
+10e5 : 91 49 __ STA (T1 + 0),y
+10e7 : a5 49 __ LDA T1 + 0
+10e9 : c8 __ __ INY
+10ea : 91 23 __ STA (SP + 0),y
+10ec : a5 4a __ LDA T1 + 1
+10ee : c8 __ __ INY
+10ef : 91 23 __ STA (SP + 0),y
+10f1 : 20 91 11 JSR $1191 ; (Proc_3 + 0)
+10f4 : a0 02 __ LDY #$02
+10f6 : b1 49 __ LDA (T1 + 0),y
+10f8 : f0 2d __ BEQ $1127
+10fa : a0 07 __ LDY #$07
+10fc : b1 23 __ LDA (SP + 0),y
+10fe : 85 43 __ STA T0 + 0
+1100 : c8 __ __ INY
+1101 : b1 23 __ LDA (SP + 0),y
+1103 : 85 44 __ STA T0 + 1
+1105 : a0 00 __ LDY #$00
+1107 : b1 43 __ LDA (T0 + 0),y
+1109 : 85 49 __ STA T1 + 0
+110b : c8 __ __ INY
+110c : b1 43 __ LDA (T0 + 0),y
+110e : 85 4a __ STA T1 + 1
+1110 : a0 24 __ LDY #$24
+1112 : b1 49 __ LDA (T1 + 0),y
+1114 : 91 43 __ STA (T0 + 0),y
+1116 : 88 __ __ DEY
+1117 : 10 f9 __ BPL $1112
+1119 : 18 __ __ CLC
+111a : a5 23 __ LDA SP + 0
+111c : 69 05 __ ADC #$05
+111e : 85 23 __ STA SP + 0
+1120 : a5 24 __ LDA SP + 1
+1122 : 69 00 __ ADC #$00
+1124 : 85 24 __ STA SP + 1
+1126 : 60 __ __ RTS
+1127 : a9 06 __ LDA #$06
+1129 : a0 04 __ LDY #$04
+112b : 91 49 __ STA (T1 + 0),y
+112d : a9 00 __ LDA #$00
+112f : c8 __ __ INY
+1130 : 91 49 __ STA (T1 + 0),y
+1132 : a0 07 __ LDY #$07
+1134 : b1 23 __ LDA (SP + 0),y
+1136 : 85 43 __ STA T0 + 0
+1138 : c8 __ __ INY
+1139 : b1 23 __ LDA (SP + 0),y
+113b : 85 44 __ STA T0 + 1
+113d : a0 03 __ LDY #$03
+113f : b1 43 __ LDA (T0 + 0),y
+1141 : 88 __ __ DEY
+1142 : 91 23 __ STA (SP + 0),y
+1144 : 18 __ __ CLC
+1145 : a5 49 __ LDA T1 + 0
+1147 : 69 03 __ ADC #$03
+1149 : c8 __ __ INY
+114a : 91 23 __ STA (SP + 0),y
+114c : a5 4a __ LDA T1 + 1
+114e : 69 00 __ ADC #$00
+1150 : c8 __ __ INY
+1151 : 91 23 __ STA (SP + 0),y
+1153 : 20 e3 11 JSR $11e3 ; (Proc_6 + 0)
+1156 : ad 9a 14 LDA $149a ; (Ptr_Glob + 0)
+1159 : 85 43 __ STA T0 + 0
+115b : ad 9b 14 LDA $149b ; (Ptr_Glob + 1)
+115e : 85 44 __ STA T0 + 1
+1160 : a0 00 __ LDY #$00
+1162 : b1 43 __ LDA (T0 + 0),y
+1164 : 91 49 __ STA (T1 + 0),y
+1166 : c8 __ __ INY
+1167 : b1 43 __ LDA (T0 + 0),y
+1169 : 91 49 __ STA (T1 + 0),y
+116b : a0 04 __ LDY #$04
+116d : b1 49 __ LDA (T1 + 0),y
+116f : 85 0d __ STA P0
+1171 : c8 __ __ INY
+1172 : b1 49 __ LDA (T1 + 0),y
+1174 : 85 0e __ STA P1
+1176 : a9 0a __ LDA #$0a
+1178 : 85 0f __ STA P2
+117a : a9 00 __ LDA #$00
+117c : 85 10 __ STA P3
+117e : 18 __ __ CLC
+117f : a5 49 __ LDA T1 + 0
+1181 : 69 04 __ ADC #$04
+1183 : 85 11 __ STA P4
+1185 : a5 4a __ LDA T1 + 1
+1187 : 69 00 __ ADC #$00
+1189 : 85 12 __ STA P5
+118b : 20 9a 0e JSR $0e9a ; (Proc_7 + 0)
+118e : 4c 19 11 JMP $1119 ; (Proc_1 + 146)
+--------------------------------------------------------------------
+Proc_3:
+1191 : ad 9a 14 LDA $149a ; (Ptr_Glob + 0)
+1194 : 85 43 __ STA T0 + 0
+1196 : ad 9b 14 LDA $149b ; (Ptr_Glob + 1)
+1199 : 85 44 __ STA T0 + 1
+119b : a5 43 __ LDA T0 + 0
+119d : 0d 9b 14 ORA $149b ; (Ptr_Glob + 1)
+11a0 : f0 1e __ BEQ $11c0
+11a2 : a0 00 __ LDY #$00
+11a4 : b1 43 __ LDA (T0 + 0),y
+11a6 : aa __ __ TAX
+11a7 : c8 __ __ INY
+11a8 : b1 43 __ LDA (T0 + 0),y
+11aa : 85 46 __ STA T1 + 1
+11ac : c8 __ __ INY
+11ad : b1 23 __ LDA (SP + 0),y
+11af : 85 47 __ STA T2 + 0
+11b1 : c8 __ __ INY
+11b2 : b1 23 __ LDA (SP + 0),y
+11b4 : 85 48 __ STA T2 + 1
+11b6 : 8a __ __ TXA
+11b7 : a0 00 __ LDY #$00
+11b9 : 91 47 __ STA (T2 + 0),y
+11bb : a5 46 __ LDA T1 + 1
+11bd : c8 __ __ INY
+11be : 91 47 __ STA (T2 + 0),y
+11c0 : a9 0a __ LDA #$0a
+11c2 : 85 0d __ STA P0
+11c4 : a9 00 __ LDA #$00
+11c6 : 85 0e __ STA P1
+11c8 : ad 27 28 LDA $2827 ; (Int_Glob + 0)
+11cb : 85 0f __ STA P2
+11cd : ad 28 28 LDA $2828 ; (Int_Glob + 1)
+11d0 : 85 10 __ STA P3
+11d2 : 18 __ __ CLC
+11d3 : a5 43 __ LDA T0 + 0
+11d5 : 69 04 __ ADC #$04
+11d7 : 85 11 __ STA P4
+11d9 : a5 44 __ LDA T0 + 1
+11db : 69 00 __ ADC #$00
+11dd : 85 12 __ STA P5
+11df : 20 9a 0e JSR $0e9a ; (Proc_7 + 0)
+11e2 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_6:
+11e3 : a0 02 __ LDY #$02
+11e5 : b1 23 __ LDA (SP + 0),y
+11e7 : aa __ __ TAX
+11e8 : c8 __ __ INY
+11e9 : b1 23 __ LDA (SP + 0),y
+11eb : 85 44 __ STA T1 + 0
+11ed : c8 __ __ INY
+11ee : b1 23 __ LDA (SP + 0),y
+11f0 : 85 45 __ STA T1 + 1
+11f2 : 8a __ __ TXA
+11f3 : a0 00 __ LDY #$00
+11f5 : 91 44 __ STA (T1 + 0),y
+11f7 : 85 0d __ STA P0
+11f9 : 20 89 12 JSR $1289 ; (Func_3 + 0)
+11fc : a5 1b __ LDA ACCU + 0
+11fe : d0 11 __ BNE $1211
+1200 : a0 03 __ LDY #$03
+1202 : b1 23 __ LDA (SP + 0),y
+1204 : 85 44 __ STA T1 + 0
+1206 : c8 __ __ INY
+1207 : b1 23 __ LDA (SP + 0),y
+1209 : 85 45 __ STA T1 + 1
+120b : a9 03 __ LDA #$03
+120d : a0 00 __ LDY #$00
+120f : 91 44 __ STA (T1 + 0),y
+1211 : a0 02 __ LDY #$02
+1213 : b1 23 __ LDA (SP + 0),y
+1215 : c9 03 __ CMP #$03
+1217 : f0 19 __ BEQ $1232
+1219 : c9 03 __ CMP #$03
+121b : 90 16 __ BCC $1233
+121d : c9 04 __ CMP #$04
+121f : d0 11 __ BNE $1232
+1221 : a0 03 __ LDY #$03
+1223 : b1 23 __ LDA (SP + 0),y
+1225 : 85 44 __ STA T1 + 0
+1227 : c8 __ __ INY
+1228 : b1 23 __ LDA (SP + 0),y
+122a : 85 45 __ STA T1 + 1
+122c : a9 02 __ LDA #$02
+122e : a0 00 __ LDY #$00
+1230 : 91 44 __ STA (T1 + 0),y
+1232 : 60 __ __ RTS
+1233 : 09 00 __ ORA #$00
+1235 : f0 3e __ BEQ $1275
+1237 : c9 01 __ CMP #$01
+1239 : f0 18 __ BEQ $1253
+123b : c9 02 __ CMP #$02
+123d : d0 f3 __ BNE $1232
+123f : a0 03 __ LDY #$03
+1241 : b1 23 __ LDA (SP + 0),y
+1243 : 85 44 __ STA T1 + 0
+1245 : c8 __ __ INY
+1246 : b1 23 __ LDA (SP + 0),y
+1248 : 85 45 __ STA T1 + 1
+124a : a9 01 __ LDA #$01
+124c : a0 00 __ LDY #$00
+124e : 91 44 __ STA (T1 + 0),y
+1250 : 4c 32 12 JMP $1232 ; (Proc_6 + 79)
+1253 : ad 28 28 LDA $2828 ; (Int_Glob + 1)
+1256 : 10 14 __ BPL $126c
+1258 : a0 03 __ LDY #$03
+125a : b1 23 __ LDA (SP + 0),y
+125c : 85 44 __ STA T1 + 0
+125e : c8 __ __ INY
+125f : b1 23 __ LDA (SP + 0),y
+1261 : 85 45 __ STA T1 + 1
+1263 : a9 03 __ LDA #$03
+1265 : a0 00 __ LDY #$00
+1267 : 91 44 __ STA (T1 + 0),y
+1269 : 4c 32 12 JMP $1232 ; (Proc_6 + 79)
+126c : d0 07 __ BNE $1275
+126e : a9 64 __ LDA #$64
+1270 : cd 27 28 CMP $2827 ; (Int_Glob + 0)
+1273 : b0 e3 __ BCS $1258
+1275 : a0 03 __ LDY #$03
+1277 : b1 23 __ LDA (SP + 0),y
+1279 : 85 44 __ STA T1 + 0
+127b : c8 __ __ INY
+127c : b1 23 __ LDA (SP + 0),y
+127e : 85 45 __ STA T1 + 1
+1280 : a9 00 __ LDA #$00
+1282 : a0 00 __ LDY #$00
+1284 : 91 44 __ STA (T1 + 0),y
+1286 : 4c 32 12 JMP $1232 ; (Proc_6 + 79)
+--------------------------------------------------------------------
+Func_3:
+1289 : a5 0d __ LDA P0
+128b : c9 02 __ CMP #$02
+128d : f0 09 __ BEQ $1298
+128f : a9 00 __ LDA #$00
+1291 : 85 1b __ STA ACCU + 0
+1293 : a5 44 __ LDA $44
+1295 : 85 1c __ STA ACCU + 1
+1297 : 60 __ __ RTS
+1298 : a9 01 __ LDA #$01
+129a : 4c 91 12 JMP $1291 ; (Func_3 + 8)
+--------------------------------------------------------------------
+Proc_2:
+12bc : 18 __ __ CLC
+12bd : a0 00 __ LDY #$00
+12bf : b1 0d __ LDA (P0),y
+12c1 : 69 0a __ ADC #$0a
+12c3 : ae 24 28 LDX $2824 ; (Ch_1_Glob + 0)
+12c6 : 85 44 __ STA T1 + 0
+12c8 : c8 __ __ INY
+12c9 : b1 0d __ LDA (P0),y
+12cb : 69 00 __ ADC #$00
+12cd : 85 45 __ STA T1 + 1
+12cf : 8a __ __ TXA
+12d0 : e0 41 __ CPX #$41
+12d2 : f0 0a __ BEQ $12de
+12d4 : c9 41 __ CMP #$41
+12d6 : f0 24 __ BEQ $12fc
+12d8 : a9 00 __ LDA #$00
+12da : aa __ __ TAX
+12db : 8a __ __ TXA
+12dc : f0 fd __ BEQ $12db
+12de : 38 __ __ SEC
+12df : a5 44 __ LDA T1 + 0
+12e1 : e9 01 __ SBC #$01
+12e3 : aa __ __ TAX
+12e4 : a5 45 __ LDA T1 + 1
+12e6 : e9 00 __ SBC #$00
+12e8 : 85 45 __ STA T1 + 1
+12ea : 38 __ __ SEC
+12eb : 8a __ __ TXA
+12ec : ed 27 28 SBC $2827 ; (Int_Glob + 0)
+12ef : a0 00 __ LDY #$00
+12f1 : 91 0d __ STA (P0),y
+12f3 : a5 45 __ LDA T1 + 1
+12f5 : ed 28 28 SBC $2828 ; (Int_Glob + 1)
+12f8 : c8 __ __ INY
+12f9 : 91 0d __ STA (P0),y
+12fb : 60 __ __ RTS
+12fc : a9 01 __ LDA #$01
+12fe : 4c da 12 JMP $12da ; (Proc_2 + 30)
+--------------------------------------------------------------------
+inp_exit:
+133f : a9 4c __ LDA #$4c
+1341 : 85 54 __ STA $54
+1343 : a9 00 __ LDA #$00
+1345 : 85 13 __ STA P6
+1347 : a9 19 __ LDA #$19
+1349 : 85 16 __ STA P9
+134b : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+134c : a0 00 __ LDY #$00
+134e : 84 06 __ STY $06
+1350 : a5 03 __ LDA $03
+1352 : a6 04 __ LDX $04
+1354 : f0 1c __ BEQ $1372
+1356 : 38 __ __ SEC
+1357 : 6a __ __ ROR
+1358 : 90 0d __ BCC $1367
+135a : aa __ __ TAX
+135b : 18 __ __ CLC
+135c : 98 __ __ TYA
+135d : 65 1b __ ADC ACCU + 0
+135f : a8 __ __ TAY
+1360 : a5 06 __ LDA $06
+1362 : 65 1c __ ADC ACCU + 1
+1364 : 85 06 __ STA $06
+1366 : 8a __ __ TXA
+1367 : 06 1b __ ASL ACCU + 0
+1369 : 26 1c __ ROL ACCU + 1
+136b : 4a __ __ LSR
+136c : 90 f9 __ BCC $1367
+136e : d0 ea __ BNE $135a
+1370 : a5 04 __ LDA $04
+1372 : 4a __ __ LSR
+1373 : 90 0d __ BCC $1382
+1375 : aa __ __ TAX
+1376 : 18 __ __ CLC
+1377 : 98 __ __ TYA
+1378 : 65 1b __ ADC ACCU + 0
+137a : a8 __ __ TAY
+137b : a5 06 __ LDA $06
+137d : 65 1c __ ADC ACCU + 1
+137f : 85 06 __ STA $06
+1381 : 8a __ __ TXA
+1382 : 06 1b __ ASL ACCU + 0
+1384 : 26 1c __ ROL ACCU + 1
+1386 : 4a __ __ LSR
+1387 : b0 ec __ BCS $1375
+1389 : d0 f7 __ BNE $1382
+138b : 84 05 __ STY $05
+138d : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+138e : 24 1c __ BIT ACCU + 1
+1390 : 10 0d __ BPL $139f
+1392 : 20 ac 13 JSR $13ac ; (negaccu + 0)
+1395 : 24 04 __ BIT $04
+1397 : 10 0d __ BPL $13a6
+1399 : 20 ba 13 JSR $13ba ; (negtmp + 0)
+139c : 4c c8 13 JMP $13c8 ; (divmod + 0)
+139f : 24 04 __ BIT $04
+13a1 : 10 f9 __ BPL $139c
+13a3 : 20 ba 13 JSR $13ba ; (negtmp + 0)
+13a6 : 20 c8 13 JSR $13c8 ; (divmod + 0)
+13a9 : 4c ac 13 JMP $13ac ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+13ac : 38 __ __ SEC
+13ad : a9 00 __ LDA #$00
+13af : e5 1b __ SBC ACCU + 0
+13b1 : 85 1b __ STA ACCU + 0
+13b3 : a9 00 __ LDA #$00
+13b5 : e5 1c __ SBC ACCU + 1
+13b7 : 85 1c __ STA ACCU + 1
+13b9 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+13ba : 38 __ __ SEC
+13bb : a9 00 __ LDA #$00
+13bd : e5 03 __ SBC $03
+13bf : 85 03 __ STA $03
+13c1 : a9 00 __ LDA #$00
+13c3 : e5 04 __ SBC $04
+13c5 : 85 04 __ STA $04
+13c7 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+13c8 : a5 1c __ LDA ACCU + 1
+13ca : d0 31 __ BNE $13fd
+13cc : a5 04 __ LDA $04
+13ce : d0 1e __ BNE $13ee
+13d0 : 85 06 __ STA $06
+13d2 : a2 04 __ LDX #$04
+13d4 : 06 1b __ ASL ACCU + 0
+13d6 : 2a __ __ ROL
+13d7 : c5 03 __ CMP $03
+13d9 : 90 02 __ BCC $13dd
+13db : e5 03 __ SBC $03
+13dd : 26 1b __ ROL ACCU + 0
+13df : 2a __ __ ROL
+13e0 : c5 03 __ CMP $03
+13e2 : 90 02 __ BCC $13e6
+13e4 : e5 03 __ SBC $03
+13e6 : 26 1b __ ROL ACCU + 0
+13e8 : ca __ __ DEX
+13e9 : d0 eb __ BNE $13d6
+13eb : 85 05 __ STA $05
+13ed : 60 __ __ RTS
+13ee : a5 1b __ LDA ACCU + 0
+13f0 : 85 05 __ STA $05
+13f2 : a5 1c __ LDA ACCU + 1
+13f4 : 85 06 __ STA $06
+13f6 : a9 00 __ LDA #$00
+13f8 : 85 1b __ STA ACCU + 0
+13fa : 85 1c __ STA ACCU + 1
+13fc : 60 __ __ RTS
+13fd : a5 04 __ LDA $04
+13ff : d0 1f __ BNE $1420
+1401 : a5 03 __ LDA $03
+1403 : 30 1b __ BMI $1420
+1405 : a9 00 __ LDA #$00
+1407 : 85 06 __ STA $06
+1409 : a2 10 __ LDX #$10
+140b : 06 1b __ ASL ACCU + 0
+140d : 26 1c __ ROL ACCU + 1
+140f : 2a __ __ ROL
+1410 : c5 03 __ CMP $03
+1412 : 90 02 __ BCC $1416
+1414 : e5 03 __ SBC $03
+1416 : 26 1b __ ROL ACCU + 0
+1418 : 26 1c __ ROL ACCU + 1
+141a : ca __ __ DEX
+141b : d0 f2 __ BNE $140f
+141d : 85 05 __ STA $05
+141f : 60 __ __ RTS
+1420 : a9 00 __ LDA #$00
+1422 : 85 05 __ STA $05
+1424 : 85 06 __ STA $06
+1426 : 84 02 __ STY $02
+1428 : a0 10 __ LDY #$10
+142a : 18 __ __ CLC
+142b : 26 1b __ ROL ACCU + 0
+142d : 26 1c __ ROL ACCU + 1
+142f : 26 05 __ ROL $05
+1431 : 26 06 __ ROL $06
+1433 : 38 __ __ SEC
+1434 : a5 05 __ LDA $05
+1436 : e5 03 __ SBC $03
+1438 : aa __ __ TAX
+1439 : a5 06 __ LDA $06
+143b : e5 04 __ SBC $04
+143d : 90 04 __ BCC $1443
+143f : 86 05 __ STX $05
+1441 : 85 06 __ STA $06
+1443 : 88 __ __ DEY
+1444 : d0 e5 __ BNE $142b
+1446 : 26 1b __ ROL ACCU + 0
+1448 : 26 1c __ ROL ACCU + 1
+144a : a4 02 __ LDY $02
+144c : 60 __ __ RTS
@@ -0,0 +1,1388 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e a1 13 STX $13a1 ; (spentry + 0)
+0811 : a9 a2 __ LDA #$a2
+0813 : 85 19 __ STA IP + 0
+0815 : a9 13 __ LDA #$13
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 28 __ LDA #$28
+081c : e9 13 __ SBC #$13
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 24 __ LDA #$24
+0832 : e9 a2 __ SBC #$a2
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 93 12 JMP $1293 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 06 __ SBC #$06
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 a2 __ LDA #$a2
+090f : 8d c7 13 STA $13c7 ; (Next_Ptr_Glob + 0)
+0912 : a9 13 __ LDA #$13
+0914 : 8d c8 13 STA $13c8 ; (Next_Ptr_Glob + 1)
+0917 : a9 c9 __ LDA #$c9
+0919 : 8d ee 13 STA $13ee ; (Ptr_Glob + 0)
+091c : a9 13 __ LDA #$13
+091e : 8d ef 13 STA $13ef ; (Ptr_Glob + 1)
+0921 : a9 a2 __ LDA #$a2
+0923 : 8d c9 13 STA $13c9 ; (Glob_Rec + 0)
+0926 : a9 13 __ LDA #$13
+0928 : 8d ca 13 STA $13ca ; (Glob_Rec + 1)
+092b : a9 00 __ LDA #$00
+092d : 8d cb 13 STA $13cb ; (Glob_Rec + 2)
+0930 : a9 02 __ LDA #$02
+0932 : 8d cc 13 STA $13cc ; (Glob_Rec + 3)
+0935 : a9 28 __ LDA #$28
+0937 : 8d cd 13 STA $13cd ; (Glob_Rec + 4)
+093a : a9 00 __ LDA #$00
+093c : 8d ce 13 STA $13ce ; (Glob_Rec + 5)
+093f : a0 ff __ LDY #$ff
+0941 : c8 __ __ INY
+0942 : b9 a8 0c LDA $0ca8,y 
+0945 : 99 cf 13 STA $13cf,y ; (Glob_Rec + 6)
+0948 : d0 f7 __ BNE $0941
+094a : a0 ff __ LDY #$ff
+094c : c8 __ __ INY
+094d : b9 c7 0c LDA $0cc7,y 
+0950 : 99 e6 27 STA $27e6,y ; (sframe + 5)
+0953 : d0 f7 __ BNE $094c
+0955 : a9 0a __ LDA #$0a
+0957 : 8d 1e 17 STA $171e ; (Arr_2_Glob + 814)
+095a : a9 00 __ LDA #$00
+095c : 8d 1f 17 STA $171f ; (Arr_2_Glob + 815)
+095f : a9 01 __ LDA #$01
+0961 : 85 4c __ STA T0 + 0
+0963 : a9 00 __ LDA #$00
+0965 : 85 4d __ STA T0 + 1
+0967 : 20 e6 0c JSR $0ce6 ; (Proc_5 + 0)
+096a : 20 f1 0c JSR $0cf1 ; (Proc_4 + 0)
+096d : a9 02 __ LDA #$02
+096f : 8d e1 27 STA $27e1 ; (sframe + 0)
+0972 : a9 00 __ LDA #$00
+0974 : 8d e2 27 STA $27e2 ; (sframe + 1)
+0977 : a0 ff __ LDY #$ff
+0979 : c8 __ __ INY
+097a : b9 0b 0d LDA $0d0b,y 
+097d : 99 05 28 STA $2805,y ; (sframe + 36)
+0980 : d0 f7 __ BNE $0979
+0982 : a9 01 __ LDA #$01
+0984 : 8d e5 27 STA $27e5 ; (sframe + 4)
+0987 : a9 e6 __ LDA #$e6
+0989 : a0 02 __ LDY #$02
+098b : 91 23 __ STA (SP + 0),y
+098d : a9 27 __ LDA #$27
+098f : c8 __ __ INY
+0990 : 91 23 __ STA (SP + 0),y
+0992 : a9 05 __ LDA #$05
+0994 : c8 __ __ INY
+0995 : 91 23 __ STA (SP + 0),y
+0997 : a9 28 __ LDA #$28
+0999 : c8 __ __ INY
+099a : 91 23 __ STA (SP + 0),y
+099c : 20 2a 0d JSR $0d2a ; (Func_2 + 0)
+099f : a5 1b __ LDA ACCU + 0
+09a1 : d0 03 __ BNE $09a6
+09a3 : 4c a3 0c JMP $0ca3 ; (main + 931)
+09a6 : a9 00 __ LDA #$00
+09a8 : 8d 79 27 STA $2779 ; (Bool_Glob + 0)
+09ab : a9 03 __ LDA #$03
+09ad : 85 4e __ STA T1 + 0
+09af : a9 00 __ LDA #$00
+09b1 : 85 4f __ STA T1 + 1
+09b3 : ad e1 27 LDA $27e1 ; (sframe + 0)
+09b6 : 85 50 __ STA T2 + 0
+09b8 : ad e2 27 LDA $27e2 ; (sframe + 1)
+09bb : 30 03 __ BMI $09c0
+09bd : 4c 92 0c JMP $0c92 ; (main + 914)
+09c0 : ae e1 27 LDX $27e1 ; (sframe + 0)
+09c3 : 86 0d __ STX P0
+09c5 : ac e2 27 LDY $27e2 ; (sframe + 1)
+09c8 : 8a __ __ TXA
+09c9 : 0a __ __ ASL
+09ca : 85 07 __ STA $07
+09cc : 98 __ __ TYA
+09cd : 84 0e __ STY P1
+09cf : 2a __ __ ROL
+09d0 : 06 07 __ ASL $07
+09d2 : 2a __ __ ROL
+09d3 : aa __ __ TAX
+09d4 : 18 __ __ CLC
+09d5 : a5 07 __ LDA $07
+09d7 : 6d e1 27 ADC $27e1 ; (sframe + 0)
+09da : 85 1b __ STA ACCU + 0
+09dc : 8a __ __ TXA
+09dd : 6d e2 27 ADC $27e2 ; (sframe + 1)
+09e0 : 85 1c __ STA ACCU + 1
+09e2 : 38 __ __ SEC
+09e3 : a5 1b __ LDA ACCU + 0
+09e5 : e9 03 __ SBC #$03
+09e7 : 8d e3 27 STA $27e3 ; (sframe + 2)
+09ea : a5 1c __ LDA ACCU + 1
+09ec : e9 00 __ SBC #$00
+09ee : 8d e4 27 STA $27e4 ; (sframe + 3)
+09f1 : a9 03 __ LDA #$03
+09f3 : 85 0f __ STA P2
+09f5 : a9 00 __ LDA #$00
+09f7 : 85 10 __ STA P3
+09f9 : a9 e3 __ LDA #$e3
+09fb : 85 11 __ STA P4
+09fd : a9 27 __ LDA #$27
+09ff : 85 12 __ STA P5
+0a01 : 20 ee 0d JSR $0dee ; (Proc_7 + 0)
+0a04 : 18 __ __ CLC
+0a05 : ad e1 27 LDA $27e1 ; (sframe + 0)
+0a08 : 69 01 __ ADC #$01
+0a0a : 85 53 __ STA T4 + 0
+0a0c : 8d e1 27 STA $27e1 ; (sframe + 0)
+0a0f : ad e2 27 LDA $27e2 ; (sframe + 1)
+0a12 : 69 00 __ ADC #$00
+0a14 : 8d e2 27 STA $27e2 ; (sframe + 1)
+0a17 : 30 a7 __ BMI $09c0
+0a19 : d0 06 __ BNE $0a21
+0a1b : a5 53 __ LDA T4 + 0
+0a1d : c9 03 __ CMP #$03
+0a1f : 90 9f __ BCC $09c0
+0a21 : a9 7d __ LDA #$7d
+0a23 : 85 0d __ STA P0
+0a25 : a9 27 __ LDA #$27
+0a27 : 85 0e __ STA P1
+0a29 : a9 f0 __ LDA #$f0
+0a2b : 85 0f __ STA P2
+0a2d : a9 13 __ LDA #$13
+0a2f : 85 10 __ STA P3
+0a31 : ad e1 27 LDA $27e1 ; (sframe + 0)
+0a34 : 85 11 __ STA P4
+0a36 : ad e2 27 LDA $27e2 ; (sframe + 1)
+0a39 : 85 12 __ STA P5
+0a3b : ad e3 27 LDA $27e3 ; (sframe + 2)
+0a3e : 85 13 __ STA P6
+0a40 : ad e4 27 LDA $27e4 ; (sframe + 3)
+0a43 : 85 14 __ STA P7
+0a45 : 20 0c 0e JSR $0e0c ; (Proc_8 + 0)
+0a48 : ad ee 13 LDA $13ee ; (Ptr_Glob + 0)
+0a4b : a0 02 __ LDY #$02
+0a4d : 91 23 __ STA (SP + 0),y
+0a4f : ad ef 13 LDA $13ef ; (Ptr_Glob + 1)
+0a52 : c8 __ __ INY
+0a53 : 91 23 __ STA (SP + 0),y
+0a55 : 20 db 0f JSR $0fdb ; (Proc_1 + 0)
+0a58 : ad 7a 27 LDA $277a ; (Ch_2_Glob + 0)
+0a5b : c9 41 __ CMP #$41
+0a5d : 90 26 __ BCC $0a85
+0a5f : a9 41 __ LDA #$41
+0a61 : 85 52 __ STA T3 + 0
+0a63 : ad e5 27 LDA $27e5 ; (sframe + 4)
+0a66 : 85 55 __ STA T6 + 0
+0a68 : a5 52 __ LDA T3 + 0
+0a6a : 85 0d __ STA P0
+0a6c : a9 43 __ LDA #$43
+0a6e : 85 0e __ STA P1
+0a70 : 20 a6 0d JSR $0da6 ; (Func_1 + 0)
+0a73 : a5 55 __ LDA T6 + 0
+0a75 : c5 1b __ CMP ACCU + 0
+0a77 : d0 03 __ BNE $0a7c
+0a79 : 4c 63 0c JMP $0c63 ; (main + 867)
+0a7c : ae 7a 27 LDX $277a ; (Ch_2_Glob + 0)
+0a7f : e6 52 __ INC T3 + 0
+0a81 : e4 52 __ CPX T3 + 0
+0a83 : b0 de __ BCS $0a63
+0a85 : ad e1 27 LDA $27e1 ; (sframe + 0)
+0a88 : 85 1b __ STA ACCU + 0
+0a8a : ad e2 27 LDA $27e2 ; (sframe + 1)
+0a8d : 85 1c __ STA ACCU + 1
+0a8f : a5 4e __ LDA T1 + 0
+0a91 : 85 03 __ STA $03
+0a93 : a5 4f __ LDA T1 + 1
+0a95 : 85 04 __ STA $04
+0a97 : 20 a0 12 JSR $12a0 ; (mul16 + 0)
+0a9a : a5 05 __ LDA $05
+0a9c : 85 1b __ STA ACCU + 0
+0a9e : 85 4e __ STA T1 + 0
+0aa0 : a5 06 __ LDA $06
+0aa2 : 85 1c __ STA ACCU + 1
+0aa4 : 85 4f __ STA T1 + 1
+0aa6 : ad e3 27 LDA $27e3 ; (sframe + 2)
+0aa9 : 85 03 __ STA $03
+0aab : ad e4 27 LDA $27e4 ; (sframe + 3)
+0aae : 85 04 __ STA $04
+0ab0 : 20 e2 12 JSR $12e2 ; (divs16 + 0)
+0ab3 : a5 1b __ LDA ACCU + 0
+0ab5 : 85 53 __ STA T4 + 0
+0ab7 : a5 1c __ LDA ACCU + 1
+0ab9 : 85 54 __ STA T4 + 1
+0abb : a5 1b __ LDA ACCU + 0
+0abd : 8d e1 27 STA $27e1 ; (sframe + 0)
+0ac0 : a5 1c __ LDA ACCU + 1
+0ac2 : 8d e2 27 STA $27e2 ; (sframe + 1)
+0ac5 : a9 e1 __ LDA #$e1
+0ac7 : 85 0d __ STA P0
+0ac9 : a9 27 __ LDA #$27
+0acb : 85 0e __ STA P1
+0acd : 20 10 12 JSR $1210 ; (Proc_2 + 0)
+0ad0 : e6 4c __ INC T0 + 0
+0ad2 : d0 02 __ BNE $0ad6
+0ad4 : e6 4d __ INC T0 + 1
+0ad6 : a5 4d __ LDA T0 + 1
+0ad8 : 49 80 __ EOR #$80
+0ada : c9 81 __ CMP #$81
+0adc : d0 04 __ BNE $0ae2
+0ade : a5 4c __ LDA T0 + 0
+0ae0 : c9 f5 __ CMP #$f5
+0ae2 : b0 03 __ BCS $0ae7
+0ae4 : 4c 67 09 JMP $0967 ; (main + 103)
+0ae7 : ad 7b 27 LDA $277b ; (Int_Glob + 0)
+0aea : 85 4c __ STA T0 + 0
+0aec : ad 7c 27 LDA $277c ; (Int_Glob + 1)
+0aef : d0 19 __ BNE $0b0a
+0af1 : a5 4c __ LDA T0 + 0
+0af3 : c9 05 __ CMP #$05
+0af5 : d0 13 __ BNE $0b0a
+0af7 : ad 79 27 LDA $2779 ; (Bool_Glob + 0)
+0afa : f0 0e __ BEQ $0b0a
+0afc : ad 78 27 LDA $2778 ; (Ch_1_Glob + 0)
+0aff : c9 41 __ CMP #$41
+0b01 : d0 07 __ BNE $0b0a
+0b03 : ad 7a 27 LDA $277a ; (Ch_2_Glob + 0)
+0b06 : c9 42 __ CMP #$42
+0b08 : f0 16 __ BEQ $0b20
+0b0a : a9 01 __ LDA #$01
+0b0c : 85 1b __ STA ACCU + 0
+0b0e : a9 00 __ LDA #$00
+0b10 : 85 1c __ STA ACCU + 1
+0b12 : 18 __ __ CLC
+0b13 : a5 23 __ LDA SP + 0
+0b15 : 69 06 __ ADC #$06
+0b17 : 85 23 __ STA SP + 0
+0b19 : a5 24 __ LDA SP + 1
+0b1b : 69 00 __ ADC #$00
+0b1d : 85 24 __ STA SP + 1
+0b1f : 60 __ __ RTS
+0b20 : ad 8d 27 LDA $278d ; (Arr_1_Glob + 16)
+0b23 : 85 4c __ STA T0 + 0
+0b25 : ad 8e 27 LDA $278e ; (Arr_1_Glob + 17)
+0b28 : d0 18 __ BNE $0b42
+0b2a : a5 4c __ LDA T0 + 0
+0b2c : c9 07 __ CMP #$07
+0b2e : d0 12 __ BNE $0b42
+0b30 : ad 1e 17 LDA $171e ; (Arr_2_Glob + 814)
+0b33 : 85 4c __ STA T0 + 0
+0b35 : ad 1f 17 LDA $171f ; (Arr_2_Glob + 815)
+0b38 : c9 01 __ CMP #$01
+0b3a : d0 06 __ BNE $0b42
+0b3c : a5 4c __ LDA T0 + 0
+0b3e : c9 fe __ CMP #$fe
+0b40 : f0 09 __ BEQ $0b4b
+0b42 : a9 02 __ LDA #$02
+0b44 : 85 1b __ STA ACCU + 0
+0b46 : a9 00 __ LDA #$00
+0b48 : 4c 10 0b JMP $0b10 ; (main + 528)
+0b4b : ad ee 13 LDA $13ee ; (Ptr_Glob + 0)
+0b4e : 85 4c __ STA T0 + 0
+0b50 : ad ef 13 LDA $13ef ; (Ptr_Glob + 1)
+0b53 : 85 4d __ STA T0 + 1
+0b55 : a0 02 __ LDY #$02
+0b57 : b1 4c __ LDA (T0 + 0),y
+0b59 : d0 19 __ BNE $0b74
+0b5b : a0 03 __ LDY #$03
+0b5d : b1 4c __ LDA (T0 + 0),y
+0b5f : c9 02 __ CMP #$02
+0b61 : d0 11 __ BNE $0b74
+0b63 : a0 04 __ LDY #$04
+0b65 : b1 4c __ LDA (T0 + 0),y
+0b67 : 85 43 __ STA T5 + 0
+0b69 : c8 __ __ INY
+0b6a : b1 4c __ LDA (T0 + 0),y
+0b6c : d0 06 __ BNE $0b74
+0b6e : a5 43 __ LDA T5 + 0
+0b70 : c9 11 __ CMP #$11
+0b72 : f0 09 __ BEQ $0b7d
+0b74 : a9 03 __ LDA #$03
+0b76 : 85 1b __ STA ACCU + 0
+0b78 : a9 00 __ LDA #$00
+0b7a : 4c 10 0b JMP $0b10 ; (main + 528)
+0b7d : ad c7 13 LDA $13c7 ; (Next_Ptr_Glob + 0)
+0b80 : 85 43 __ STA T5 + 0
+0b82 : ad c8 13 LDA $13c8 ; (Next_Ptr_Glob + 1)
+0b85 : 85 44 __ STA T5 + 1
+0b87 : a0 02 __ LDY #$02
+0b89 : b1 43 __ LDA (T5 + 0),y
+0b8b : d0 19 __ BNE $0ba6
+0b8d : a0 03 __ LDY #$03
+0b8f : b1 43 __ LDA (T5 + 0),y
+0b91 : c9 01 __ CMP #$01
+0b93 : d0 11 __ BNE $0ba6
+0b95 : a0 04 __ LDY #$04
+0b97 : b1 43 __ LDA (T5 + 0),y
+0b99 : 85 02 __ STA $02
+0b9b : c8 __ __ INY
+0b9c : b1 43 __ LDA (T5 + 0),y
+0b9e : d0 06 __ BNE $0ba6
+0ba0 : a5 02 __ LDA $02
+0ba2 : c9 12 __ CMP #$12
+0ba4 : f0 09 __ BEQ $0baf
+0ba6 : a9 04 __ LDA #$04
+0ba8 : 85 1b __ STA ACCU + 0
+0baa : a9 00 __ LDA #$00
+0bac : 4c 10 0b JMP $0b10 ; (main + 528)
+0baf : ad e1 27 LDA $27e1 ; (sframe + 0)
+0bb2 : 85 43 __ STA T5 + 0
+0bb4 : ad e2 27 LDA $27e2 ; (sframe + 1)
+0bb7 : d0 5a __ BNE $0c13
+0bb9 : a5 43 __ LDA T5 + 0
+0bbb : c9 05 __ CMP #$05
+0bbd : d0 54 __ BNE $0c13
+0bbf : 38 __ __ SEC
+0bc0 : a5 4e __ LDA T1 + 0
+0bc2 : ed e3 27 SBC $27e3 ; (sframe + 2)
+0bc5 : 85 4e __ STA T1 + 0
+0bc7 : a5 4f __ LDA T1 + 1
+0bc9 : ed e4 27 SBC $27e4 ; (sframe + 3)
+0bcc : 85 4f __ STA T1 + 1
+0bce : a5 4e __ LDA T1 + 0
+0bd0 : 0a __ __ ASL
+0bd1 : 85 07 __ STA $07
+0bd3 : a5 4f __ LDA T1 + 1
+0bd5 : 2a __ __ ROL
+0bd6 : 06 07 __ ASL $07
+0bd8 : 2a __ __ ROL
+0bd9 : 06 07 __ ASL $07
+0bdb : 2a __ __ ROL
+0bdc : aa __ __ TAX
+0bdd : 38 __ __ SEC
+0bde : a5 07 __ LDA $07
+0be0 : e5 4e __ SBC T1 + 0
+0be2 : 85 1b __ STA ACCU + 0
+0be4 : 8a __ __ TXA
+0be5 : e5 4f __ SBC T1 + 1
+0be7 : 85 1c __ STA ACCU + 1
+0be9 : 38 __ __ SEC
+0bea : a5 1b __ LDA ACCU + 0
+0bec : e5 53 __ SBC T4 + 0
+0bee : 85 4e __ STA T1 + 0
+0bf0 : a5 1c __ LDA ACCU + 1
+0bf2 : e5 54 __ SBC T4 + 1
+0bf4 : d0 1d __ BNE $0c13
+0bf6 : a5 4e __ LDA T1 + 0
+0bf8 : c9 0d __ CMP #$0d
+0bfa : d0 17 __ BNE $0c13
+0bfc : ad e3 27 LDA $27e3 ; (sframe + 2)
+0bff : 85 4e __ STA T1 + 0
+0c01 : ad e4 27 LDA $27e4 ; (sframe + 3)
+0c04 : d0 0d __ BNE $0c13
+0c06 : a5 4e __ LDA T1 + 0
+0c08 : c9 07 __ CMP #$07
+0c0a : d0 07 __ BNE $0c13
+0c0c : ad e5 27 LDA $27e5 ; (sframe + 4)
+0c0f : c9 01 __ CMP #$01
+0c11 : f0 09 __ BEQ $0c1c
+0c13 : a9 05 __ LDA #$05
+0c15 : 85 1b __ STA ACCU + 0
+0c17 : a9 00 __ LDA #$00
+0c19 : 4c 10 0b JMP $0b10 ; (main + 528)
+0c1c : 18 __ __ CLC
+0c1d : a5 4c __ LDA T0 + 0
+0c1f : 69 06 __ ADC #$06
+0c21 : 85 0d __ STA P0
+0c23 : a5 4d __ LDA T0 + 1
+0c25 : 69 00 __ ADC #$00
+0c27 : 85 0e __ STA P1
+0c29 : a9 55 __ LDA #$55
+0c2b : 85 0f __ STA P2
+0c2d : a9 12 __ LDA #$12
+0c2f : 85 10 __ STA P3
+0c31 : 20 bf 0d JSR $0dbf ; (strcmp + 0)
+0c34 : a5 1b __ LDA ACCU + 0
+0c36 : 05 1c __ ORA ACCU + 1
+0c38 : d0 20 __ BNE $0c5a
+0c3a : a9 05 __ LDA #$05
+0c3c : 85 0d __ STA P0
+0c3e : a9 28 __ LDA #$28
+0c40 : 85 0e __ STA P1
+0c42 : a9 74 __ LDA #$74
+0c44 : 85 0f __ STA P2
+0c46 : a9 12 __ LDA #$12
+0c48 : 85 10 __ STA P3
+0c4a : 20 bf 0d JSR $0dbf ; (strcmp + 0)
+0c4d : a5 1b __ LDA ACCU + 0
+0c4f : 05 1c __ ORA ACCU + 1
+0c51 : d0 07 __ BNE $0c5a
+0c53 : a9 00 __ LDA #$00
+0c55 : 85 1b __ STA ACCU + 0
+0c57 : 4c 10 0b JMP $0b10 ; (main + 528)
+0c5a : a9 06 __ LDA #$06
+0c5c : 85 1b __ STA ACCU + 0
+0c5e : a9 00 __ LDA #$00
+0c60 : 4c 10 0b JMP $0b10 ; (main + 528)
+0c63 : a9 00 __ LDA #$00
+0c65 : a0 02 __ LDY #$02
+0c67 : 91 23 __ STA (SP + 0),y
+0c69 : a9 e5 __ LDA #$e5
+0c6b : c8 __ __ INY
+0c6c : 91 23 __ STA (SP + 0),y
+0c6e : a9 27 __ LDA #$27
+0c70 : c8 __ __ INY
+0c71 : 91 23 __ STA (SP + 0),y
+0c73 : 20 37 11 JSR $1137 ; (Proc_6 + 0)
+0c76 : a0 ff __ LDY #$ff
+0c78 : c8 __ __ INY
+0c79 : b9 f1 11 LDA $11f1,y 
+0c7c : 99 05 28 STA $2805,y ; (sframe + 36)
+0c7f : d0 f7 __ BNE $0c78
+0c81 : a5 4c __ LDA T0 + 0
+0c83 : 85 4e __ STA T1 + 0
+0c85 : 8d 7b 27 STA $277b ; (Int_Glob + 0)
+0c88 : a5 4d __ LDA T0 + 1
+0c8a : 85 4f __ STA T1 + 1
+0c8c : 8d 7c 27 STA $277c ; (Int_Glob + 1)
+0c8f : 4c 7c 0a JMP $0a7c ; (main + 380)
+0c92 : f0 03 __ BEQ $0c97
+0c94 : 4c 21 0a JMP $0a21 ; (main + 289)
+0c97 : a5 50 __ LDA T2 + 0
+0c99 : c9 03 __ CMP #$03
+0c9b : b0 03 __ BCS $0ca0
+0c9d : 4c c0 09 JMP $09c0 ; (main + 192)
+0ca0 : 4c 21 0a JMP $0a21 ; (main + 289)
+0ca3 : a9 01 __ LDA #$01
+0ca5 : 4c a8 09 JMP $09a8 ; (main + 168)
+--------------------------------------------------------------------
+Proc_5:
+0ce6 : a9 41 __ LDA #$41
+0ce8 : 8d 78 27 STA $2778 ; (Ch_1_Glob + 0)
+0ceb : a9 00 __ LDA #$00
+0ced : 8d 79 27 STA $2779 ; (Bool_Glob + 0)
+0cf0 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_4:
+0cf1 : ad 78 27 LDA $2778 ; (Ch_1_Glob + 0)
+0cf4 : c9 41 __ CMP #$41
+0cf6 : f0 0e __ BEQ $0d06
+0cf8 : a9 00 __ LDA #$00
+0cfa : 0d 79 27 ORA $2779 ; (Bool_Glob + 0)
+0cfd : 8d 79 27 STA $2779 ; (Bool_Glob + 0)
+0d00 : a9 42 __ LDA #$42
+0d02 : 8d 7a 27 STA $277a ; (Ch_2_Glob + 0)
+0d05 : 60 __ __ RTS
+0d06 : a9 01 __ LDA #$01
+0d08 : 4c fa 0c JMP $0cfa ; (Proc_4 + 9)
+--------------------------------------------------------------------
+Func_2:
+0d2a : a0 04 __ LDY #$04
+0d2c : b1 23 __ LDA (SP + 0),y
+0d2e : 85 45 __ STA T0 + 0
+0d30 : c8 __ __ INY
+0d31 : b1 23 __ LDA (SP + 0),y
+0d33 : 85 46 __ STA T0 + 1
+0d35 : a0 02 __ LDY #$02
+0d37 : b1 23 __ LDA (SP + 0),y
+0d39 : 85 47 __ STA T1 + 0
+0d3b : c8 __ __ INY
+0d3c : b1 23 __ LDA (SP + 0),y
+0d3e : 85 48 __ STA T1 + 1
+0d40 : 18 __ __ CLC
+0d41 : a5 47 __ LDA T1 + 0
+0d43 : 69 02 __ ADC #$02
+0d45 : 85 49 __ STA T3 + 0
+0d47 : a5 48 __ LDA T1 + 1
+0d49 : 69 00 __ ADC #$00
+0d4b : 85 4a __ STA T3 + 1
+0d4d : a0 00 __ LDY #$00
+0d4f : b1 49 __ LDA (T3 + 0),y
+0d51 : 85 0d __ STA P0
+0d53 : 18 __ __ CLC
+0d54 : a5 45 __ LDA T0 + 0
+0d56 : 69 02 __ ADC #$02
+0d58 : 85 43 __ STA T2 + 0
+0d5a : a5 46 __ LDA T0 + 1
+0d5c : 69 00 __ ADC #$00
+0d5e : 85 44 __ STA T2 + 1
+0d60 : c8 __ __ INY
+0d61 : b1 43 __ LDA (T2 + 0),y
+0d63 : 85 0e __ STA P1
+0d65 : 20 a6 0d JSR $0da6 ; (Func_1 + 0)
+0d68 : a5 1b __ LDA ACCU + 0
+0d6a : d0 d4 __ BNE $0d40
+0d6c : a0 02 __ LDY #$02
+0d6e : b1 23 __ LDA (SP + 0),y
+0d70 : 85 0d __ STA P0
+0d72 : c8 __ __ INY
+0d73 : b1 23 __ LDA (SP + 0),y
+0d75 : 85 0e __ STA P1
+0d77 : c8 __ __ INY
+0d78 : b1 23 __ LDA (SP + 0),y
+0d7a : 85 0f __ STA P2
+0d7c : c8 __ __ INY
+0d7d : b1 23 __ LDA (SP + 0),y
+0d7f : 85 10 __ STA P3
+0d81 : 20 bf 0d JSR $0dbf ; (strcmp + 0)
+0d84 : a5 1c __ LDA ACCU + 1
+0d86 : 30 04 __ BMI $0d8c
+0d88 : 05 1b __ ORA ACCU + 0
+0d8a : d0 07 __ BNE $0d93
+0d8c : a9 00 __ LDA #$00
+0d8e : 85 1b __ STA ACCU + 0
+0d90 : 85 1c __ STA ACCU + 1
+0d92 : 60 __ __ RTS
+0d93 : a9 0a __ LDA #$0a
+0d95 : 8d 7b 27 STA $277b ; (Int_Glob + 0)
+0d98 : a9 00 __ LDA #$00
+0d9a : 8d 7c 27 STA $277c ; (Int_Glob + 1)
+0d9d : a9 01 __ LDA #$01
+0d9f : 85 1b __ STA ACCU + 0
+0da1 : a9 00 __ LDA #$00
+0da3 : 4c 90 0d JMP $0d90 ; (Func_2 + 102)
+--------------------------------------------------------------------
+Func_1:
+0da6 : a5 0d __ LDA P0
+0da8 : c5 0e __ CMP P1
+0daa : f0 07 __ BEQ $0db3
+0dac : a9 00 __ LDA #$00
+0dae : 85 1b __ STA ACCU + 0
+0db0 : 85 1c __ STA ACCU + 1
+0db2 : 60 __ __ RTS
+0db3 : 8d 78 27 STA $2778 ; (Ch_1_Glob + 0)
+0db6 : a9 01 __ LDA #$01
+0db8 : 85 1b __ STA ACCU + 0
+0dba : a9 00 __ LDA #$00
+0dbc : 4c b0 0d JMP $0db0 ; (Func_1 + 10)
+--------------------------------------------------------------------
+strcmp:
+0dbf : a0 00 __ LDY #$00
+0dc1 : 84 1c __ STY ACCU + 1
+0dc3 : b1 0d __ LDA (P0),y
+0dc5 : f0 16 __ BEQ $0ddd
+0dc7 : d1 0f __ CMP (P2),y
+0dc9 : d0 16 __ BNE $0de1
+0dcb : c8 __ __ INY
+0dcc : b1 0d __ LDA (P0),y
+0dce : f0 0d __ BEQ $0ddd
+0dd0 : d1 0f __ CMP (P2),y
+0dd2 : d0 0d __ BNE $0de1
+0dd4 : c8 __ __ INY
+0dd5 : d0 ec __ BNE $0dc3
+0dd7 : e6 0e __ INC P1
+0dd9 : e6 10 __ INC P3
+0ddb : d0 e6 __ BNE $0dc3
+0ddd : d1 0f __ CMP (P2),y
+0ddf : f0 0a __ BEQ $0deb
+0de1 : b0 06 __ BCS $0de9
+0de3 : a9 ff __ LDA #$ff
+0de5 : 85 1c __ STA ACCU + 1
+0de7 : 30 02 __ BMI $0deb
+0de9 : a9 01 __ LDA #$01
+0deb : 85 1b __ STA ACCU + 0
+0ded : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0dee : 18 __ __ CLC
+0def : a5 0d __ LDA P0
+0df1 : 69 02 __ ADC #$02
+0df3 : 85 43 __ STA T0 + 0
+0df5 : a5 0e __ LDA P1
+0df7 : 69 00 __ ADC #$00
+0df9 : 85 44 __ STA T0 + 1
+0dfb : 18 __ __ CLC
+0dfc : a5 0f __ LDA P2
+0dfe : 65 43 __ ADC T0 + 0
+0e00 : a0 00 __ LDY #$00
+0e02 : 91 11 __ STA (P4),y
+0e04 : a5 10 __ LDA P3
+0e06 : 65 44 __ ADC T0 + 1
+0e08 : c8 __ __ INY
+0e09 : 91 11 __ STA (P4),y
+0e0b : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_8:
+0e0c : a5 11 __ LDA P4
+0e0e : 0a __ __ ASL
+0e0f : 85 47 __ STA T2 + 0
+0e11 : a5 12 __ LDA P5
+0e13 : 2a __ __ ROL
+0e14 : 85 48 __ STA T2 + 1
+0e16 : 18 __ __ CLC
+0e17 : a5 0d __ LDA P0
+0e19 : 65 47 __ ADC T2 + 0
+0e1b : 85 43 __ STA T0 + 0
+0e1d : a5 0e __ LDA P1
+0e1f : 65 48 __ ADC T2 + 1
+0e21 : 85 44 __ STA T0 + 1
+0e23 : a5 13 __ LDA P6
+0e25 : a0 0a __ LDY #$0a
+0e27 : 91 43 __ STA (T0 + 0),y
+0e29 : a5 14 __ LDA P7
+0e2b : c8 __ __ INY
+0e2c : 91 43 __ STA (T0 + 0),y
+0e2e : a5 13 __ LDA P6
+0e30 : c8 __ __ INY
+0e31 : 91 43 __ STA (T0 + 0),y
+0e33 : a5 14 __ LDA P7
+0e35 : c8 __ __ INY
+0e36 : 91 43 __ STA (T0 + 0),y
+0e38 : 18 __ __ CLC
+0e39 : a5 11 __ LDA P4
+0e3b : 69 05 __ ADC #$05
+0e3d : 85 47 __ STA T2 + 0
+0e3f : a0 46 __ LDY #$46
+0e41 : 91 43 __ STA (T0 + 0),y
+0e43 : a5 12 __ LDA P5
+0e45 : 69 00 __ ADC #$00
+0e47 : 85 48 __ STA T2 + 1
+0e49 : c8 __ __ INY
+0e4a : 91 43 __ STA (T0 + 0),y
+0e4c : 18 __ __ CLC
+0e4d : a5 11 __ LDA P4
+0e4f : 69 06 __ ADC #$06
+0e51 : 85 43 __ STA T0 + 0
+0e53 : a5 12 __ LDA P5
+0e55 : 69 00 __ ADC #$00
+0e57 : aa __ __ TAX
+0e58 : a5 48 __ LDA T2 + 1
+0e5a : 49 80 __ EOR #$80
+0e5c : 85 03 __ STA $03
+0e5e : 8a __ __ TXA
+0e5f : 49 80 __ EOR #$80
+0e61 : c5 03 __ CMP $03
+0e63 : d0 04 __ BNE $0e69
+0e65 : a5 43 __ LDA T0 + 0
+0e67 : c5 47 __ CMP T2 + 0
+0e69 : b0 03 __ BCS $0e6e
+0e6b : 4c fa 0e JMP $0efa ; (Proc_8 + 238)
+0e6e : a5 47 __ LDA T2 + 0
+0e70 : 85 43 __ STA T0 + 0
+0e72 : a5 48 __ LDA T2 + 1
+0e74 : 85 44 __ STA T0 + 1
+0e76 : a5 47 __ LDA T2 + 0
+0e78 : 0a __ __ ASL
+0e79 : aa __ __ TAX
+0e7a : a5 48 __ LDA T2 + 1
+0e7c : 2a __ __ ROL
+0e7d : a8 __ __ TAY
+0e7e : 18 __ __ CLC
+0e7f : 8a __ __ TXA
+0e80 : 65 47 __ ADC T2 + 0
+0e82 : aa __ __ TAX
+0e83 : 98 __ __ TYA
+0e84 : 65 48 __ ADC T2 + 1
+0e86 : 85 03 __ STA $03
+0e88 : 8a __ __ TXA
+0e89 : 0a __ __ ASL
+0e8a : 26 03 __ ROL $03
+0e8c : 0a __ __ ASL
+0e8d : 26 03 __ ROL $03
+0e8f : 0a __ __ ASL
+0e90 : 26 03 __ ROL $03
+0e92 : 18 __ __ CLC
+0e93 : 65 47 __ ADC T2 + 0
+0e95 : 85 1b __ STA ACCU + 0
+0e97 : a5 03 __ LDA $03
+0e99 : 65 48 __ ADC T2 + 1
+0e9b : 06 1b __ ASL ACCU + 0
+0e9d : 2a __ __ ROL
+0e9e : 85 1c __ STA ACCU + 1
+0ea0 : 18 __ __ CLC
+0ea1 : a5 1b __ LDA ACCU + 0
+0ea3 : 65 47 __ ADC T2 + 0
+0ea5 : 85 45 __ STA T1 + 0
+0ea7 : a5 1c __ LDA ACCU + 1
+0ea9 : 65 48 __ ADC T2 + 1
+0eab : 06 45 __ ASL T1 + 0
+0ead : 2a __ __ ROL
+0eae : 85 46 __ STA T1 + 1
+0eb0 : 18 __ __ CLC
+0eb1 : a5 0f __ LDA P2
+0eb3 : 65 45 __ ADC T1 + 0
+0eb5 : 85 45 __ STA T1 + 0
+0eb7 : a5 10 __ LDA P3
+0eb9 : 65 46 __ ADC T1 + 1
+0ebb : 85 46 __ STA T1 + 1
+0ebd : 18 __ __ CLC
+0ebe : a5 47 __ LDA T2 + 0
+0ec0 : 69 01 __ ADC #$01
+0ec2 : 85 4a __ STA T4 + 0
+0ec4 : a5 48 __ LDA T2 + 1
+0ec6 : 69 00 __ ADC #$00
+0ec8 : 85 4b __ STA T4 + 1
+0eca : a5 47 __ LDA T2 + 0
+0ecc : a0 00 __ LDY #$00
+0ece : 91 45 __ STA (T1 + 0),y
+0ed0 : a5 48 __ LDA T2 + 1
+0ed2 : c8 __ __ INY
+0ed3 : 91 45 __ STA (T1 + 0),y
+0ed5 : 18 __ __ CLC
+0ed6 : a5 45 __ LDA T1 + 0
+0ed8 : 69 02 __ ADC #$02
+0eda : 85 45 __ STA T1 + 0
+0edc : 90 02 __ BCC $0ee0
+0ede : e6 46 __ INC T1 + 1
+0ee0 : e6 43 __ INC T0 + 0
+0ee2 : d0 02 __ BNE $0ee6
+0ee4 : e6 44 __ INC T0 + 1
+0ee6 : a5 44 __ LDA T0 + 1
+0ee8 : 49 80 __ EOR #$80
+0eea : 85 03 __ STA $03
+0eec : a5 4b __ LDA T4 + 1
+0eee : 49 80 __ EOR #$80
+0ef0 : c5 03 __ CMP $03
+0ef2 : d0 04 __ BNE $0ef8
+0ef4 : a5 4a __ LDA T4 + 0
+0ef6 : c5 43 __ CMP T0 + 0
+0ef8 : b0 d0 __ BCS $0eca
+0efa : a5 47 __ LDA T2 + 0
+0efc : 0a __ __ ASL
+0efd : aa __ __ TAX
+0efe : a5 48 __ LDA T2 + 1
+0f00 : 2a __ __ ROL
+0f01 : a8 __ __ TAY
+0f02 : 18 __ __ CLC
+0f03 : 8a __ __ TXA
+0f04 : 65 47 __ ADC T2 + 0
+0f06 : aa __ __ TAX
+0f07 : 98 __ __ TYA
+0f08 : 65 48 __ ADC T2 + 1
+0f0a : 85 03 __ STA $03
+0f0c : 8a __ __ TXA
+0f0d : 0a __ __ ASL
+0f0e : 26 03 __ ROL $03
+0f10 : 0a __ __ ASL
+0f11 : 26 03 __ ROL $03
+0f13 : 0a __ __ ASL
+0f14 : 26 03 __ ROL $03
+0f16 : 18 __ __ CLC
+0f17 : 65 47 __ ADC T2 + 0
+0f19 : 85 1b __ STA ACCU + 0
+0f1b : a5 03 __ LDA $03
+0f1d : 65 48 __ ADC T2 + 1
+0f1f : 06 1b __ ASL ACCU + 0
+0f21 : 2a __ __ ROL
+0f22 : 85 1c __ STA ACCU + 1
+0f24 : 18 __ __ CLC
+0f25 : a5 1b __ LDA ACCU + 0
+0f27 : 65 47 __ ADC T2 + 0
+0f29 : aa __ __ TAX
+0f2a : a5 1c __ LDA ACCU + 1
+0f2c : 65 48 __ ADC T2 + 1
+0f2e : a8 __ __ TAY
+0f2f : 38 __ __ SEC
+0f30 : 8a __ __ TXA
+0f31 : e9 01 __ SBC #$01
+0f33 : 85 45 __ STA T1 + 0
+0f35 : 98 __ __ TYA
+0f36 : e9 00 __ SBC #$00
+0f38 : 06 45 __ ASL T1 + 0
+0f3a : 2a __ __ ROL
+0f3b : 85 46 __ STA T1 + 1
+0f3d : 18 __ __ CLC
+0f3e : a5 0f __ LDA P2
+0f40 : 65 45 __ ADC T1 + 0
+0f42 : 85 45 __ STA T1 + 0
+0f44 : a5 10 __ LDA P3
+0f46 : 65 46 __ ADC T1 + 1
+0f48 : 85 46 __ STA T1 + 1
+0f4a : 18 __ __ CLC
+0f4b : a0 00 __ LDY #$00
+0f4d : b1 45 __ LDA (T1 + 0),y
+0f4f : 69 01 __ ADC #$01
+0f51 : 91 45 __ STA (T1 + 0),y
+0f53 : c8 __ __ INY
+0f54 : b1 45 __ LDA (T1 + 0),y
+0f56 : 69 00 __ ADC #$00
+0f58 : 91 45 __ STA (T1 + 0),y
+0f5a : a5 47 __ LDA T2 + 0
+0f5c : 0a __ __ ASL
+0f5d : 85 4a __ STA T4 + 0
+0f5f : a5 48 __ LDA T2 + 1
+0f61 : 2a __ __ ROL
+0f62 : 85 4b __ STA T4 + 1
+0f64 : 18 __ __ CLC
+0f65 : a5 0d __ LDA P0
+0f67 : 65 4a __ ADC T4 + 0
+0f69 : 85 45 __ STA T1 + 0
+0f6b : a5 0e __ LDA P1
+0f6d : 65 4b __ ADC T4 + 1
+0f6f : 85 46 __ STA T1 + 1
+0f71 : 18 __ __ CLC
+0f72 : a5 47 __ LDA T2 + 0
+0f74 : 69 14 __ ADC #$14
+0f76 : 85 4a __ STA T4 + 0
+0f78 : a5 48 __ LDA T2 + 1
+0f7a : 69 00 __ ADC #$00
+0f7c : 85 4b __ STA T4 + 1
+0f7e : a5 4a __ LDA T4 + 0
+0f80 : 0a __ __ ASL
+0f81 : aa __ __ TAX
+0f82 : a5 4b __ LDA T4 + 1
+0f84 : 2a __ __ ROL
+0f85 : a8 __ __ TAY
+0f86 : 18 __ __ CLC
+0f87 : 8a __ __ TXA
+0f88 : 65 4a __ ADC T4 + 0
+0f8a : aa __ __ TAX
+0f8b : 98 __ __ TYA
+0f8c : 65 4b __ ADC T4 + 1
+0f8e : 85 03 __ STA $03
+0f90 : 8a __ __ TXA
+0f91 : 0a __ __ ASL
+0f92 : 26 03 __ ROL $03
+0f94 : 0a __ __ ASL
+0f95 : 26 03 __ ROL $03
+0f97 : 0a __ __ ASL
+0f98 : 26 03 __ ROL $03
+0f9a : 18 __ __ CLC
+0f9b : 65 4a __ ADC T4 + 0
+0f9d : 85 1b __ STA ACCU + 0
+0f9f : a5 03 __ LDA $03
+0fa1 : 65 4b __ ADC T4 + 1
+0fa3 : 06 1b __ ASL ACCU + 0
+0fa5 : 2a __ __ ROL
+0fa6 : 85 1c __ STA ACCU + 1
+0fa8 : 18 __ __ CLC
+0fa9 : a5 1b __ LDA ACCU + 0
+0fab : 65 47 __ ADC T2 + 0
+0fad : 85 47 __ STA T2 + 0
+0faf : a5 1c __ LDA ACCU + 1
+0fb1 : 65 48 __ ADC T2 + 1
+0fb3 : 06 47 __ ASL T2 + 0
+0fb5 : 2a __ __ ROL
+0fb6 : 85 48 __ STA T2 + 1
+0fb8 : 18 __ __ CLC
+0fb9 : a5 0f __ LDA P2
+0fbb : 65 47 __ ADC T2 + 0
+0fbd : 85 43 __ STA T0 + 0
+0fbf : a5 10 __ LDA P3
+0fc1 : 65 48 __ ADC T2 + 1
+0fc3 : 85 44 __ STA T0 + 1
+0fc5 : a0 00 __ LDY #$00
+0fc7 : b1 45 __ LDA (T1 + 0),y
+0fc9 : 91 43 __ STA (T0 + 0),y
+0fcb : c8 __ __ INY
+0fcc : b1 45 __ LDA (T1 + 0),y
+0fce : 91 43 __ STA (T0 + 0),y
+0fd0 : a9 05 __ LDA #$05
+0fd2 : 8d 7b 27 STA $277b ; (Int_Glob + 0)
+0fd5 : a9 00 __ LDA #$00
+0fd7 : 8d 7c 27 STA $277c ; (Int_Glob + 1)
+0fda : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_1:
+0fdb : 38 __ __ SEC
+0fdc : a5 23 __ LDA SP + 0
+0fde : e9 05 __ SBC #$05
+0fe0 : 85 23 __ STA SP + 0
+0fe2 : a5 24 __ LDA SP + 1
+0fe4 : e9 00 __ SBC #$00
+0fe6 : 85 24 __ STA SP + 1
+0fe8 : a0 07 __ LDY #$07
+0fea : b1 23 __ LDA (SP + 0),y
+0fec : 85 43 __ STA T0 + 0
+0fee : c8 __ __ INY
+0fef : b1 23 __ LDA (SP + 0),y
+0ff1 : 85 44 __ STA T0 + 1
+0ff3 : a0 00 __ LDY #$00
+0ff5 : b1 43 __ LDA (T0 + 0),y
+0ff7 : 85 49 __ STA T1 + 0
+0ff9 : c8 __ __ INY
+0ffa : b1 43 __ LDA (T0 + 0),y
+0ffc : 85 4a __ STA T1 + 1
+0ffe : ad ee 13 LDA $13ee ; (Ptr_Glob + 0)
+1001 : 85 45 __ STA T2 + 0
+1003 : ad ef 13 LDA $13ef ; (Ptr_Glob + 1)
+1006 : 85 46 __ STA T2 + 1
+1008 : 88 __ __ DEY
+1009 : b1 43 __ LDA (T0 + 0),y
+100b : 85 47 __ STA T3 + 0
+100d : c8 __ __ INY
+100e : b1 43 __ LDA (T0 + 0),y
+1010 : 85 48 __ STA T3 + 1
+1012 : a0 24 __ LDY #$24
+1014 : b1 45 __ LDA (T2 + 0),y
+1016 : 91 47 __ STA (T3 + 0),y
+1018 : 88 __ __ DEY
+1019 : 10 f9 __ BPL $1014
+101b : a9 05 __ LDA #$05
+101d : a0 04 __ LDY #$04
+101f : 91 43 __ STA (T0 + 0),y
+1021 : a9 00 __ LDA #$00
+1023 : c8 __ __ INY
+1024 : 91 43 __ STA (T0 + 0),y
+1026 : a9 05 __ LDA #$05
+1028 : 88 __ __ DEY
+1029 : 91 49 __ STA (T1 + 0),y
+102b : a9 00 __ LDA #$00
+102d : c8 __ __ INY
+102e : 91 49 __ STA (T1 + 0),y
+1030 : a0 00 __ LDY #$00
+1032 : b1 43 __ LDA (T0 + 0),y
+1034 : 91 49 __ STA (T1 + 0),y
+1036 : c8 __ __ INY
+1037 : b1 43 __ LDA (T0 + 0),y
+1039 : 91 49 __ STA (T1 + 0),y
+103b : a5 49 __ LDA T1 + 0
+103d : c8 __ __ INY
+103e : 91 23 __ STA (SP + 0),y
+1040 : a5 4a __ LDA T1 + 1
+1042 : c8 __ __ INY
+1043 : 91 23 __ STA (SP + 0),y
+1045 : 20 e5 10 JSR $10e5 ; (Proc_3 + 0)
+1048 : a0 02 __ LDY #$02
+104a : b1 49 __ LDA (T1 + 0),y
+104c : f0 2d __ BEQ $107b
+104e : a0 07 __ LDY #$07
+1050 : b1 23 __ LDA (SP + 0),y
+1052 : 85 43 __ STA T0 + 0
+1054 : c8 __ __ INY
+1055 : b1 23 __ LDA (SP + 0),y
+1057 : 85 44 __ STA T0 + 1
+1059 : a0 00 __ LDY #$00
+105b : b1 43 __ LDA (T0 + 0),y
+105d : 85 49 __ STA T1 + 0
+105f : c8 __ __ INY
+1060 : b1 43 __ LDA (T0 + 0),y
+1062 : 85 4a __ STA T1 + 1
+1064 : a0 24 __ LDY #$24
+1066 : b1 49 __ LDA (T1 + 0),y
+1068 : 91 43 __ STA (T0 + 0),y
+106a : 88 __ __ DEY
+106b : 10 f9 __ BPL $1066
+106d : 18 __ __ CLC
+106e : a5 23 __ LDA SP + 0
+1070 : 69 05 __ ADC #$05
+1072 : 85 23 __ STA SP + 0
+1074 : a5 24 __ LDA SP + 1
+1076 : 69 00 __ ADC #$00
+1078 : 85 24 __ STA SP + 1
+107a : 60 __ __ RTS
+107b : a9 06 __ LDA #$06
+107d : a0 04 __ LDY #$04
+107f : 91 49 __ STA (T1 + 0),y
+1081 : a9 00 __ LDA #$00
+1083 : c8 __ __ INY
+1084 : 91 49 __ STA (T1 + 0),y
+1086 : a0 07 __ LDY #$07
+1088 : b1 23 __ LDA (SP + 0),y
+108a : 85 43 __ STA T0 + 0
+108c : c8 __ __ INY
+108d : b1 23 __ LDA (SP + 0),y
+108f : 85 44 __ STA T0 + 1
+1091 : a0 03 __ LDY #$03
+1093 : b1 43 __ LDA (T0 + 0),y
+1095 : 88 __ __ DEY
+1096 : 91 23 __ STA (SP + 0),y
+1098 : 18 __ __ CLC
+1099 : a5 49 __ LDA T1 + 0
+109b : 69 03 __ ADC #$03
+109d : c8 __ __ INY
+109e : 91 23 __ STA (SP + 0),y
+10a0 : a5 4a __ LDA T1 + 1
+10a2 : 69 00 __ ADC #$00
+10a4 : c8 __ __ INY
+10a5 : 91 23 __ STA (SP + 0),y
+10a7 : 20 37 11 JSR $1137 ; (Proc_6 + 0)
+10aa : ad ee 13 LDA $13ee ; (Ptr_Glob + 0)
+10ad : 85 43 __ STA T0 + 0
+10af : ad ef 13 LDA $13ef ; (Ptr_Glob + 1)
+10b2 : 85 44 __ STA T0 + 1
+10b4 : a0 00 __ LDY #$00
+10b6 : b1 43 __ LDA (T0 + 0),y
+10b8 : 91 49 __ STA (T1 + 0),y
+10ba : c8 __ __ INY
+10bb : b1 43 __ LDA (T0 + 0),y
+10bd : 91 49 __ STA (T1 + 0),y
+10bf : a0 04 __ LDY #$04
+10c1 : b1 49 __ LDA (T1 + 0),y
+10c3 : 85 0d __ STA P0
+10c5 : c8 __ __ INY
+10c6 : b1 49 __ LDA (T1 + 0),y
+10c8 : 85 0e __ STA P1
+10ca : a9 0a __ LDA #$0a
+10cc : 85 0f __ STA P2
+10ce : a9 00 __ LDA #$00
+10d0 : 85 10 __ STA P3
+10d2 : 18 __ __ CLC
+10d3 : a5 49 __ LDA T1 + 0
+10d5 : 69 04 __ ADC #$04
+10d7 : 85 11 __ STA P4
+10d9 : a5 4a __ LDA T1 + 1
+10db : 69 00 __ ADC #$00
+10dd : 85 12 __ STA P5
+10df : 20 ee 0d JSR $0dee ; (Proc_7 + 0)
+10e2 : 4c 6d 10 JMP $106d ; (Proc_1 + 146)
+--------------------------------------------------------------------
+Proc_3:
+10e5 : ad ee 13 LDA $13ee ; (Ptr_Glob + 0)
+10e8 : 85 43 __ STA T0 + 0
+10ea : ad ef 13 LDA $13ef ; (Ptr_Glob + 1)
+10ed : 85 44 __ STA T0 + 1
+10ef : a5 43 __ LDA T0 + 0
+10f1 : 0d ef 13 ORA $13ef ; (Ptr_Glob + 1)
+10f4 : f0 1e __ BEQ $1114
+10f6 : a0 00 __ LDY #$00
+10f8 : b1 43 __ LDA (T0 + 0),y
+10fa : aa __ __ TAX
+10fb : c8 __ __ INY
+10fc : b1 43 __ LDA (T0 + 0),y
+10fe : 85 46 __ STA T1 + 1
+1100 : c8 __ __ INY
+1101 : b1 23 __ LDA (SP + 0),y
+1103 : 85 47 __ STA T2 + 0
+1105 : c8 __ __ INY
+1106 : b1 23 __ LDA (SP + 0),y
+1108 : 85 48 __ STA T2 + 1
+110a : 8a __ __ TXA
+110b : a0 00 __ LDY #$00
+110d : 91 47 __ STA (T2 + 0),y
+110f : a5 46 __ LDA T1 + 1
+1111 : c8 __ __ INY
+1112 : 91 47 __ STA (T2 + 0),y
+1114 : a9 0a __ LDA #$0a
+1116 : 85 0d __ STA P0
+1118 : a9 00 __ LDA #$00
+111a : 85 0e __ STA P1
+111c : ad 7b 27 LDA $277b ; (Int_Glob + 0)
+111f : 85 0f __ STA P2
+1121 : ad 7c 27 LDA $277c ; (Int_Glob + 1)
+1124 : 85 10 __ STA P3
+1126 : 18 __ __ CLC
+1127 : a5 43 __ LDA T0 + 0
+1129 : 69 04 __ ADC #$04
+112b : 85 11 __ STA P4
+112d : a5 44 __ LDA T0 + 1
+112f : 69 00 __ ADC #$00
+1131 : 85 12 __ STA P5
+1133 : 20 ee 0d JSR $0dee ; (Proc_7 + 0)
+1136 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_6:
+1137 : a0 02 __ LDY #$02
+1139 : b1 23 __ LDA (SP + 0),y
+113b : aa __ __ TAX
+113c : c8 __ __ INY
+113d : b1 23 __ LDA (SP + 0),y
+113f : 85 44 __ STA T1 + 0
+1141 : c8 __ __ INY
+1142 : b1 23 __ LDA (SP + 0),y
+1144 : 85 45 __ STA T1 + 1
+1146 : 8a __ __ TXA
+1147 : a0 00 __ LDY #$00
+1149 : 91 44 __ STA (T1 + 0),y
+114b : 85 0d __ STA P0
+114d : 20 dd 11 JSR $11dd ; (Func_3 + 0)
+1150 : a5 1b __ LDA ACCU + 0
+1152 : d0 11 __ BNE $1165
+1154 : a0 03 __ LDY #$03
+1156 : b1 23 __ LDA (SP + 0),y
+1158 : 85 44 __ STA T1 + 0
+115a : c8 __ __ INY
+115b : b1 23 __ LDA (SP + 0),y
+115d : 85 45 __ STA T1 + 1
+115f : a9 03 __ LDA #$03
+1161 : a0 00 __ LDY #$00
+1163 : 91 44 __ STA (T1 + 0),y
+1165 : a0 02 __ LDY #$02
+1167 : b1 23 __ LDA (SP + 0),y
+1169 : c9 03 __ CMP #$03
+116b : f0 19 __ BEQ $1186
+116d : c9 03 __ CMP #$03
+116f : 90 16 __ BCC $1187
+1171 : c9 04 __ CMP #$04
+1173 : d0 11 __ BNE $1186
+1175 : a0 03 __ LDY #$03
+1177 : b1 23 __ LDA (SP + 0),y
+1179 : 85 44 __ STA T1 + 0
+117b : c8 __ __ INY
+117c : b1 23 __ LDA (SP + 0),y
+117e : 85 45 __ STA T1 + 1
+1180 : a9 02 __ LDA #$02
+1182 : a0 00 __ LDY #$00
+1184 : 91 44 __ STA (T1 + 0),y
+1186 : 60 __ __ RTS
+1187 : 09 00 __ ORA #$00
+1189 : f0 3e __ BEQ $11c9
+118b : c9 01 __ CMP #$01
+118d : f0 18 __ BEQ $11a7
+118f : c9 02 __ CMP #$02
+1191 : d0 f3 __ BNE $1186
+1193 : a0 03 __ LDY #$03
+1195 : b1 23 __ LDA (SP + 0),y
+1197 : 85 44 __ STA T1 + 0
+1199 : c8 __ __ INY
+119a : b1 23 __ LDA (SP + 0),y
+119c : 85 45 __ STA T1 + 1
+119e : a9 01 __ LDA #$01
+11a0 : a0 00 __ LDY #$00
+11a2 : 91 44 __ STA (T1 + 0),y
+11a4 : 4c 86 11 JMP $1186 ; (Proc_6 + 79)
+11a7 : ad 7c 27 LDA $277c ; (Int_Glob + 1)
+11aa : 10 14 __ BPL $11c0
+11ac : a0 03 __ LDY #$03
+11ae : b1 23 __ LDA (SP + 0),y
+11b0 : 85 44 __ STA T1 + 0
+11b2 : c8 __ __ INY
+11b3 : b1 23 __ LDA (SP + 0),y
+11b5 : 85 45 __ STA T1 + 1
+11b7 : a9 03 __ LDA #$03
+11b9 : a0 00 __ LDY #$00
+11bb : 91 44 __ STA (T1 + 0),y
+11bd : 4c 86 11 JMP $1186 ; (Proc_6 + 79)
+11c0 : d0 07 __ BNE $11c9
+11c2 : a9 64 __ LDA #$64
+11c4 : cd 7b 27 CMP $277b ; (Int_Glob + 0)
+11c7 : b0 e3 __ BCS $11ac
+11c9 : a0 03 __ LDY #$03
+11cb : b1 23 __ LDA (SP + 0),y
+11cd : 85 44 __ STA T1 + 0
+11cf : c8 __ __ INY
+11d0 : b1 23 __ LDA (SP + 0),y
+11d2 : 85 45 __ STA T1 + 1
+11d4 : a9 00 __ LDA #$00
+11d6 : a0 00 __ LDY #$00
+11d8 : 91 44 __ STA (T1 + 0),y
+11da : 4c 86 11 JMP $1186 ; (Proc_6 + 79)
+--------------------------------------------------------------------
+Func_3:
+11dd : a5 0d __ LDA P0
+11df : c9 02 __ CMP #$02
+11e1 : f0 09 __ BEQ $11ec
+11e3 : a9 00 __ LDA #$00
+11e5 : 85 1b __ STA ACCU + 0
+11e7 : a5 44 __ LDA $44
+11e9 : 85 1c __ STA ACCU + 1
+11eb : 60 __ __ RTS
+11ec : a9 01 __ LDA #$01
+11ee : 4c e5 11 JMP $11e5 ; (Func_3 + 8)
+--------------------------------------------------------------------
+Proc_2:
+1210 : 18 __ __ CLC
+1211 : a0 00 __ LDY #$00
+1213 : b1 0d __ LDA (P0),y
+1215 : 69 0a __ ADC #$0a
+1217 : ae 78 27 LDX $2778 ; (Ch_1_Glob + 0)
+121a : 85 44 __ STA T1 + 0
+121c : c8 __ __ INY
+121d : b1 0d __ LDA (P0),y
+121f : 69 00 __ ADC #$00
+1221 : 85 45 __ STA T1 + 1
+1223 : 8a __ __ TXA
+1224 : e0 41 __ CPX #$41
+1226 : f0 0a __ BEQ $1232
+1228 : c9 41 __ CMP #$41
+122a : f0 24 __ BEQ $1250
+122c : a9 00 __ LDA #$00
+122e : aa __ __ TAX
+122f : 8a __ __ TXA
+1230 : f0 fd __ BEQ $122f
+1232 : 38 __ __ SEC
+1233 : a5 44 __ LDA T1 + 0
+1235 : e9 01 __ SBC #$01
+1237 : aa __ __ TAX
+1238 : a5 45 __ LDA T1 + 1
+123a : e9 00 __ SBC #$00
+123c : 85 45 __ STA T1 + 1
+123e : 38 __ __ SEC
+123f : 8a __ __ TXA
+1240 : ed 7b 27 SBC $277b ; (Int_Glob + 0)
+1243 : a0 00 __ LDY #$00
+1245 : 91 0d __ STA (P0),y
+1247 : a5 45 __ LDA T1 + 1
+1249 : ed 7c 27 SBC $277c ; (Int_Glob + 1)
+124c : c8 __ __ INY
+124d : 91 0d __ STA (P0),y
+124f : 60 __ __ RTS
+1250 : a9 01 __ LDA #$01
+1252 : 4c 2e 12 JMP $122e ; (Proc_2 + 30)
+--------------------------------------------------------------------
+inp_exit:
+1293 : a9 4c __ LDA #$4c
+1295 : 85 54 __ STA $54
+1297 : a9 00 __ LDA #$00
+1299 : 85 13 __ STA P6
+129b : a9 19 __ LDA #$19
+129d : 85 16 __ STA P9
+129f : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+12a0 : a0 00 __ LDY #$00
+12a2 : 84 06 __ STY $06
+12a4 : a5 03 __ LDA $03
+12a6 : a6 04 __ LDX $04
+12a8 : f0 1c __ BEQ $12c6
+12aa : 38 __ __ SEC
+12ab : 6a __ __ ROR
+12ac : 90 0d __ BCC $12bb
+12ae : aa __ __ TAX
+12af : 18 __ __ CLC
+12b0 : 98 __ __ TYA
+12b1 : 65 1b __ ADC ACCU + 0
+12b3 : a8 __ __ TAY
+12b4 : a5 06 __ LDA $06
+12b6 : 65 1c __ ADC ACCU + 1
+12b8 : 85 06 __ STA $06
+12ba : 8a __ __ TXA
+12bb : 06 1b __ ASL ACCU + 0
+12bd : 26 1c __ ROL ACCU + 1
+12bf : 4a __ __ LSR
+12c0 : 90 f9 __ BCC $12bb
+12c2 : d0 ea __ BNE $12ae
+12c4 : a5 04 __ LDA $04
+12c6 : 4a __ __ LSR
+12c7 : 90 0d __ BCC $12d6
+12c9 : aa __ __ TAX
+12ca : 18 __ __ CLC
+12cb : 98 __ __ TYA
+12cc : 65 1b __ ADC ACCU + 0
+12ce : a8 __ __ TAY
+12cf : a5 06 __ LDA $06
+12d1 : 65 1c __ ADC ACCU + 1
+12d3 : 85 06 __ STA $06
+12d5 : 8a __ __ TXA
+12d6 : 06 1b __ ASL ACCU + 0
+12d8 : 26 1c __ ROL ACCU + 1
+12da : 4a __ __ LSR
+12db : b0 ec __ BCS $12c9
+12dd : d0 f7 __ BNE $12d6
+12df : 84 05 __ STY $05
+12e1 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+12e2 : 24 1c __ BIT ACCU + 1
+12e4 : 10 0d __ BPL $12f3
+12e6 : 20 00 13 JSR $1300 ; (negaccu + 0)
+12e9 : 24 04 __ BIT $04
+12eb : 10 0d __ BPL $12fa
+12ed : 20 0e 13 JSR $130e ; (negtmp + 0)
+12f0 : 4c 1c 13 JMP $131c ; (divmod + 0)
+12f3 : 24 04 __ BIT $04
+12f5 : 10 f9 __ BPL $12f0
+12f7 : 20 0e 13 JSR $130e ; (negtmp + 0)
+12fa : 20 1c 13 JSR $131c ; (divmod + 0)
+12fd : 4c 00 13 JMP $1300 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1300 : 38 __ __ SEC
+1301 : a9 00 __ LDA #$00
+1303 : e5 1b __ SBC ACCU + 0
+1305 : 85 1b __ STA ACCU + 0
+1307 : a9 00 __ LDA #$00
+1309 : e5 1c __ SBC ACCU + 1
+130b : 85 1c __ STA ACCU + 1
+130d : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+130e : 38 __ __ SEC
+130f : a9 00 __ LDA #$00
+1311 : e5 03 __ SBC $03
+1313 : 85 03 __ STA $03
+1315 : a9 00 __ LDA #$00
+1317 : e5 04 __ SBC $04
+1319 : 85 04 __ STA $04
+131b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+131c : a5 1c __ LDA ACCU + 1
+131e : d0 31 __ BNE $1351
+1320 : a5 04 __ LDA $04
+1322 : d0 1e __ BNE $1342
+1324 : 85 06 __ STA $06
+1326 : a2 04 __ LDX #$04
+1328 : 06 1b __ ASL ACCU + 0
+132a : 2a __ __ ROL
+132b : c5 03 __ CMP $03
+132d : 90 02 __ BCC $1331
+132f : e5 03 __ SBC $03
+1331 : 26 1b __ ROL ACCU + 0
+1333 : 2a __ __ ROL
+1334 : c5 03 __ CMP $03
+1336 : 90 02 __ BCC $133a
+1338 : e5 03 __ SBC $03
+133a : 26 1b __ ROL ACCU + 0
+133c : ca __ __ DEX
+133d : d0 eb __ BNE $132a
+133f : 85 05 __ STA $05
+1341 : 60 __ __ RTS
+1342 : a5 1b __ LDA ACCU + 0
+1344 : 85 05 __ STA $05
+1346 : a5 1c __ LDA ACCU + 1
+1348 : 85 06 __ STA $06
+134a : a9 00 __ LDA #$00
+134c : 85 1b __ STA ACCU + 0
+134e : 85 1c __ STA ACCU + 1
+1350 : 60 __ __ RTS
+1351 : a5 04 __ LDA $04
+1353 : d0 1f __ BNE $1374
+1355 : a5 03 __ LDA $03
+1357 : 30 1b __ BMI $1374
+1359 : a9 00 __ LDA #$00
+135b : 85 06 __ STA $06
+135d : a2 10 __ LDX #$10
+135f : 06 1b __ ASL ACCU + 0
+1361 : 26 1c __ ROL ACCU + 1
+1363 : 2a __ __ ROL
+1364 : c5 03 __ CMP $03
+1366 : 90 02 __ BCC $136a
+1368 : e5 03 __ SBC $03
+136a : 26 1b __ ROL ACCU + 0
+136c : 26 1c __ ROL ACCU + 1
+136e : ca __ __ DEX
+136f : d0 f2 __ BNE $1363
+1371 : 85 05 __ STA $05
+1373 : 60 __ __ RTS
+1374 : a9 00 __ LDA #$00
+1376 : 85 05 __ STA $05
+1378 : 85 06 __ STA $06
+137a : 84 02 __ STY $02
+137c : a0 10 __ LDY #$10
+137e : 18 __ __ CLC
+137f : 26 1b __ ROL ACCU + 0
+1381 : 26 1c __ ROL ACCU + 1
+1383 : 26 05 __ ROL $05
+1385 : 26 06 __ ROL $06
+1387 : 38 __ __ SEC
+1388 : a5 05 __ LDA $05
+138a : e5 03 __ SBC $03
+138c : aa __ __ TAX
+138d : a5 06 __ LDA $06
+138f : e5 04 __ SBC $04
+1391 : 90 04 __ BCC $1397
+1393 : 86 05 __ STX $05
+1395 : 85 06 __ STA $06
+1397 : 88 __ __ DEY
+1398 : d0 e5 __ BNE $137f
+139a : 26 1b __ ROL ACCU + 0
+139c : 26 1c __ ROL ACCU + 1
+139e : a4 02 __ LDY $02
+13a0 : 60 __ __ RTS
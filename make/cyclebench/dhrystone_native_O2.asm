@@ -0,0 +1,944 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 91 10 STX $1091 ; (spentry + 0)
+0811 : a9 92 __ LDA #$92
+0813 : 85 19 __ STA IP + 0
+0815 : a9 10 __ LDA #$10
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 25 __ LDA #$25
+081c : e9 10 __ SBC #$10
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 12 __ LDA #$12
+0832 : e9 92 __ SBC #$92
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c c5 0f JMP $0fc5 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 04 __ SBC #$04
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 92 __ LDA #$92
+090f : 8d b7 10 STA $10b7 ; (Next_Ptr_Glob + 0)
+0912 : a9 10 __ LDA #$10
+0914 : 8d b8 10 STA $10b8 ; (Next_Ptr_Glob + 1)
+0917 : a9 b9 __ LDA #$b9
+0919 : 8d de 10 STA $10de ; (Ptr_Glob + 0)
+091c : a9 10 __ LDA #$10
+091e : 8d df 10 STA $10df ; (Ptr_Glob + 1)
+0921 : a9 92 __ LDA #$92
+0923 : 8d b9 10 STA $10b9 ; (Glob_Rec + 0)
+0926 : a9 10 __ LDA #$10
+0928 : 8d ba 10 STA $10ba ; (Glob_Rec + 1)
+092b : a9 00 __ LDA #$00
+092d : 8d bb 10 STA $10bb ; (Glob_Rec + 2)
+0930 : a9 02 __ LDA #$02
+0932 : 8d bc 10 STA $10bc ; (Glob_Rec + 3)
+0935 : a9 28 __ LDA #$28
+0937 : 8d bd 10 STA $10bd ; (Glob_Rec + 4)
+093a : a9 00 __ LDA #$00
+093c : 8d be 10 STA $10be ; (Glob_Rec + 5)
+093f : a0 ff __ LDY #$ff
+0941 : c8 __ __ INY
+0942 : b9 03 0e LDA $0e03,y 
+0945 : 99 bf 10 STA $10bf,y ; (Glob_Rec + 6)
+0948 : d0 f7 __ BNE $0941
+094a : a0 ff __ LDY #$ff
+094c : c8 __ __ INY
+094d : b9 22 0e LDA $0e22,y 
+0950 : 99 d4 24 STA $24d4,y ; (sframe + 3)
+0953 : d0 f7 __ BNE $094c
+0955 : a9 0a __ LDA #$0a
+0957 : 8d 0e 14 STA $140e ; (Arr_2_Glob + 814)
+095a : a9 00 __ LDA #$00
+095c : 8d 0f 14 STA $140f ; (Arr_2_Glob + 815)
+095f : a9 01 __ LDA #$01
+0961 : 85 49 __ STA T0 + 0
+0963 : a9 00 __ LDA #$00
+0965 : 85 4a __ STA T0 + 1
+0967 : a9 41 __ LDA #$41
+0969 : 8d 68 24 STA $2468 ; (Ch_1_Glob + 0)
+096c : a9 01 __ LDA #$01
+096e : 8d 69 24 STA $2469 ; (Bool_Glob + 0)
+0971 : a9 42 __ LDA #$42
+0973 : 8d 6a 24 STA $246a ; (Ch_2_Glob + 0)
+0976 : a0 ff __ LDY #$ff
+0978 : c8 __ __ INY
+0979 : b9 41 0e LDA $0e41,y 
+097c : 99 f3 24 STA $24f3,y ; (sframe + 34)
+097f : d0 f7 __ BNE $0978
+0981 : a9 01 __ LDA #$01
+0983 : 8d d3 24 STA $24d3 ; (sframe + 2)
+0986 : a9 03 __ LDA #$03
+0988 : 85 4b __ STA T1 + 0
+098a : a9 00 __ LDA #$00
+098c : 85 4c __ STA T1 + 1
+098e : 18 __ __ CLC
+098f : a9 d4 __ LDA #$d4
+0991 : 69 02 __ ADC #$02
+0993 : 85 45 __ STA T5 + 0
+0995 : a9 24 __ LDA #$24
+0997 : 69 00 __ ADC #$00
+0999 : 85 46 __ STA T5 + 1
+099b : a0 00 __ LDY #$00
+099d : b1 45 __ LDA (T5 + 0),y
+099f : 85 0d __ STA P0
+09a1 : 18 __ __ CLC
+09a2 : a9 f3 __ LDA #$f3
+09a4 : 69 02 __ ADC #$02
+09a6 : 85 43 __ STA T4 + 0
+09a8 : a9 24 __ LDA #$24
+09aa : 69 00 __ ADC #$00
+09ac : 85 44 __ STA T4 + 1
+09ae : c8 __ __ INY
+09af : b1 43 __ LDA (T4 + 0),y
+09b1 : 85 0e __ STA P1
+09b3 : 20 60 0e JSR $0e60 ; (Func_1 + 0)
+09b6 : a5 1b __ LDA ACCU + 0
+09b8 : d0 d4 __ BNE $098e
+09ba : a9 d4 __ LDA #$d4
+09bc : 85 0d __ STA P0
+09be : a9 24 __ LDA #$24
+09c0 : 85 0e __ STA P1
+09c2 : a9 f3 __ LDA #$f3
+09c4 : 85 0f __ STA P2
+09c6 : a9 24 __ LDA #$24
+09c8 : 85 10 __ STA P3
+09ca : 20 79 0e JSR $0e79 ; (strcmp + 0)
+09cd : a5 1c __ LDA ACCU + 1
+09cf : 30 07 __ BMI $09d8
+09d1 : 05 1b __ ORA ACCU + 0
+09d3 : f0 03 __ BEQ $09d8
+09d5 : 4c f6 0d JMP $0df6 ; (main + 1270)
+09d8 : a9 01 __ LDA #$01
+09da : 8d 69 24 STA $2469 ; (Bool_Glob + 0)
+09dd : a9 07 __ LDA #$07
+09df : 8d d1 24 STA $24d1 ; (sframe + 0)
+09e2 : a9 00 __ LDA #$00
+09e4 : 8d d2 24 STA $24d2 ; (sframe + 1)
+09e7 : a9 02 __ LDA #$02
+09e9 : 85 0d __ STA P0
+09eb : a9 00 __ LDA #$00
+09ed : 85 0e __ STA P1
+09ef : a9 03 __ LDA #$03
+09f1 : 85 0f __ STA P2
+09f3 : a9 00 __ LDA #$00
+09f5 : 85 10 __ STA P3
+09f7 : a9 d1 __ LDA #$d1
+09f9 : 85 11 __ STA P4
+09fb : a9 24 __ LDA #$24
+09fd : 85 12 __ STA P5
+09ff : 20 a8 0e JSR $0ea8 ; (Proc_7 + 0)
+0a02 : 18 __ __ CLC
+0a03 : a9 77 __ LDA #$77
+0a05 : 69 06 __ ADC #$06
+0a07 : 85 4f __ STA T3 + 0
+0a09 : a9 24 __ LDA #$24
+0a0b : 69 00 __ ADC #$00
+0a0d : 85 50 __ STA T3 + 1
+0a0f : ad d1 24 LDA $24d1 ; (sframe + 0)
+0a12 : aa __ __ TAX
+0a13 : a0 00 __ LDY #$00
+0a15 : 91 4f __ STA (T3 + 0),y
+0a17 : ad d2 24 LDA $24d2 ; (sframe + 1)
+0a1a : 85 44 __ STA T4 + 1
+0a1c : c8 __ __ INY
+0a1d : 91 4f __ STA (T3 + 0),y
+0a1f : 18 __ __ CLC
+0a20 : a9 79 __ LDA #$79
+0a22 : 69 06 __ ADC #$06
+0a24 : 85 4f __ STA T3 + 0
+0a26 : a9 24 __ LDA #$24
+0a28 : 69 00 __ ADC #$00
+0a2a : 85 50 __ STA T3 + 1
+0a2c : 8a __ __ TXA
+0a2d : 88 __ __ DEY
+0a2e : 91 4f __ STA (T3 + 0),y
+0a30 : a5 44 __ LDA T4 + 1
+0a32 : c8 __ __ INY
+0a33 : 91 4f __ STA (T3 + 0),y
+0a35 : 18 __ __ CLC
+0a36 : a9 b3 __ LDA #$b3
+0a38 : 69 06 __ ADC #$06
+0a3a : 85 4d __ STA T2 + 0
+0a3c : a9 24 __ LDA #$24
+0a3e : 69 00 __ ADC #$00
+0a40 : 85 4e __ STA T2 + 1
+0a42 : a9 08 __ LDA #$08
+0a44 : 88 __ __ DEY
+0a45 : 91 4d __ STA (T2 + 0),y
+0a47 : a9 00 __ LDA #$00
+0a49 : c8 __ __ INY
+0a4a : 91 4d __ STA (T2 + 0),y
+0a4c : a9 e0 __ LDA #$e0
+0a4e : 85 4f __ STA T3 + 0
+0a50 : 18 __ __ CLC
+0a51 : a9 e0 __ LDA #$e0
+0a53 : 69 32 __ ADC #$32
+0a55 : 85 43 __ STA T4 + 0
+0a57 : a9 10 __ LDA #$10
+0a59 : 69 03 __ ADC #$03
+0a5b : 85 44 __ STA T4 + 1
+0a5d : 18 __ __ CLC
+0a5e : a9 e0 __ LDA #$e0
+0a60 : 69 30 __ ADC #$30
+0a62 : 85 45 __ STA T5 + 0
+0a64 : a9 10 __ LDA #$10
+0a66 : 69 03 __ ADC #$03
+0a68 : 85 46 __ STA T5 + 1
+0a6a : a9 08 __ LDA #$08
+0a6c : a0 00 __ LDY #$00
+0a6e : 91 45 __ STA (T5 + 0),y
+0a70 : a9 00 __ LDA #$00
+0a72 : c8 __ __ INY
+0a73 : 91 45 __ STA (T5 + 0),y
+0a75 : 18 __ __ CLC
+0a76 : a5 45 __ LDA T5 + 0
+0a78 : 69 02 __ ADC #$02
+0a7a : 85 45 __ STA T5 + 0
+0a7c : 90 02 __ BCC $0a80
+0a7e : e6 46 __ INC T5 + 1
+0a80 : a5 44 __ LDA T4 + 1
+0a82 : c5 46 __ CMP T5 + 1
+0a84 : d0 04 __ BNE $0a8a
+0a86 : a5 43 __ LDA T4 + 0
+0a88 : c5 45 __ CMP T5 + 0
+0a8a : b0 de __ BCS $0a6a
+0a8c : 18 __ __ CLC
+0a8d : a9 e0 __ LDA #$e0
+0a8f : 69 2e __ ADC #$2e
+0a91 : 85 43 __ STA T4 + 0
+0a93 : a9 10 __ LDA #$10
+0a95 : 69 03 __ ADC #$03
+0a97 : 85 44 __ STA T4 + 1
+0a99 : 18 __ __ CLC
+0a9a : a0 00 __ LDY #$00
+0a9c : b1 43 __ LDA (T4 + 0),y
+0a9e : 69 01 __ ADC #$01
+0aa0 : 91 43 __ STA (T4 + 0),y
+0aa2 : c8 __ __ INY
+0aa3 : b1 43 __ LDA (T4 + 0),y
+0aa5 : 69 00 __ ADC #$00
+0aa7 : 91 43 __ STA (T4 + 0),y
+0aa9 : 18 __ __ CLC
+0aaa : a9 6d __ LDA #$6d
+0aac : 69 10 __ ADC #$10
+0aae : 85 4d __ STA T2 + 0
+0ab0 : a9 24 __ LDA #$24
+0ab2 : 69 00 __ ADC #$00
+0ab4 : 85 4e __ STA T2 + 1
+0ab6 : 18 __ __ CLC
+0ab7 : a9 10 __ LDA #$10
+0ab9 : 69 0b __ ADC #$0b
+0abb : 85 50 __ STA T3 + 1
+0abd : 88 __ __ DEY
+0abe : b1 4d __ LDA (T2 + 0),y
+0ac0 : 91 4f __ STA (T3 + 0),y
+0ac2 : c8 __ __ INY
+0ac3 : b1 4d __ LDA (T2 + 0),y
+0ac5 : 91 4f __ STA (T3 + 0),y
+0ac7 : a9 05 __ LDA #$05
+0ac9 : 8d 6b 24 STA $246b ; (Int_Glob + 0)
+0acc : a9 00 __ LDA #$00
+0ace : 8d 6c 24 STA $246c ; (Int_Glob + 1)
+0ad1 : ad de 10 LDA $10de ; (Ptr_Glob + 0)
+0ad4 : 85 4d __ STA T2 + 0
+0ad6 : ad df 10 LDA $10df ; (Ptr_Glob + 1)
+0ad9 : 85 4e __ STA T2 + 1
+0adb : 88 __ __ DEY
+0adc : b1 4d __ LDA (T2 + 0),y
+0ade : 85 4f __ STA T3 + 0
+0ae0 : c8 __ __ INY
+0ae1 : b1 4d __ LDA (T2 + 0),y
+0ae3 : 85 50 __ STA T3 + 1
+0ae5 : 88 __ __ DEY
+0ae6 : b1 4d __ LDA (T2 + 0),y
+0ae8 : 85 43 __ STA T4 + 0
+0aea : c8 __ __ INY
+0aeb : b1 4d __ LDA (T2 + 0),y
+0aed : 85 44 __ STA T4 + 1
+0aef : a0 24 __ LDY #$24
+0af1 : b1 4d __ LDA (T2 + 0),y
+0af3 : 91 43 __ STA (T4 + 0),y
+0af5 : 88 __ __ DEY
+0af6 : 10 f9 __ BPL $0af1
+0af8 : a9 05 __ LDA #$05
+0afa : a0 04 __ LDY #$04
+0afc : 91 4d __ STA (T2 + 0),y
+0afe : a9 00 __ LDA #$00
+0b00 : c8 __ __ INY
+0b01 : 91 4d __ STA (T2 + 0),y
+0b03 : a9 05 __ LDA #$05
+0b05 : 88 __ __ DEY
+0b06 : 91 4f __ STA (T3 + 0),y
+0b08 : a9 00 __ LDA #$00
+0b0a : c8 __ __ INY
+0b0b : 91 4f __ STA (T3 + 0),y
+0b0d : a0 00 __ LDY #$00
+0b0f : b1 4d __ LDA (T2 + 0),y
+0b11 : 91 4f __ STA (T3 + 0),y
+0b13 : c8 __ __ INY
+0b14 : b1 4d __ LDA (T2 + 0),y
+0b16 : 91 4f __ STA (T3 + 0),y
+0b18 : a5 4f __ LDA T3 + 0
+0b1a : c8 __ __ INY
+0b1b : 91 23 __ STA (SP + 0),y
+0b1d : a5 50 __ LDA T3 + 1
+0b1f : c8 __ __ INY
+0b20 : 91 23 __ STA (SP + 0),y
+0b22 : 20 c6 0e JSR $0ec6 ; (Proc_3 + 0)
+0b25 : a0 02 __ LDY #$02
+0b27 : b1 4f __ LDA (T3 + 0),y
+0b29 : d0 03 __ BNE $0b2e
+0b2b : 4c 9a 0d JMP $0d9a ; (main + 1178)
+0b2e : a0 00 __ LDY #$00
+0b30 : b1 4d __ LDA (T2 + 0),y
+0b32 : 85 4f __ STA T3 + 0
+0b34 : c8 __ __ INY
+0b35 : b1 4d __ LDA (T2 + 0),y
+0b37 : 85 50 __ STA T3 + 1
+0b39 : a0 24 __ LDY #$24
+0b3b : b1 4f __ LDA (T3 + 0),y
+0b3d : 91 4d __ STA (T2 + 0),y
+0b3f : 88 __ __ DEY
+0b40 : 10 f9 __ BPL $0b3b
+0b42 : a9 41 __ LDA #$41
+0b44 : 85 51 __ STA T6 + 0
+0b46 : ad 6a 24 LDA $246a ; (Ch_2_Glob + 0)
+0b49 : c9 41 __ CMP #$41
+0b4b : 90 22 __ BCC $0b6f
+0b4d : ad d3 24 LDA $24d3 ; (sframe + 2)
+0b50 : 85 52 __ STA T7 + 0
+0b52 : a5 51 __ LDA T6 + 0
+0b54 : 85 0d __ STA P0
+0b56 : a9 43 __ LDA #$43
+0b58 : 85 0e __ STA P1
+0b5a : 20 60 0e JSR $0e60 ; (Func_1 + 0)
+0b5d : a5 52 __ LDA T7 + 0
+0b5f : c5 1b __ CMP ACCU + 0
+0b61 : d0 03 __ BNE $0b66
+0b63 : 4c 6f 0d JMP $0d6f ; (main + 1135)
+0b66 : ae 6a 24 LDX $246a ; (Ch_2_Glob + 0)
+0b69 : e6 51 __ INC T6 + 0
+0b6b : e4 51 __ CPX T6 + 0
+0b6d : b0 de __ BCS $0b4d
+0b6f : ad 68 24 LDA $2468 ; (Ch_1_Glob + 0)
+0b72 : 85 51 __ STA T6 + 0
+0b74 : a5 4b __ LDA T1 + 0
+0b76 : 0a __ __ ASL
+0b77 : aa __ __ TAX
+0b78 : a5 4c __ LDA T1 + 1
+0b7a : 2a __ __ ROL
+0b7b : a8 __ __ TAY
+0b7c : 18 __ __ CLC
+0b7d : 8a __ __ TXA
+0b7e : 65 4b __ ADC T1 + 0
+0b80 : 85 1b __ STA ACCU + 0
+0b82 : 85 4b __ STA T1 + 0
+0b84 : 98 __ __ TYA
+0b85 : 65 4c __ ADC T1 + 1
+0b87 : 85 1c __ STA ACCU + 1
+0b89 : 85 4c __ STA T1 + 1
+0b8b : ad d1 24 LDA $24d1 ; (sframe + 0)
+0b8e : 85 03 __ STA $03
+0b90 : ad d2 24 LDA $24d2 ; (sframe + 1)
+0b93 : 85 04 __ STA $04
+0b95 : 20 d2 0f JSR $0fd2 ; (divs16 + 0)
+0b98 : a5 1b __ LDA ACCU + 0
+0b9a : 85 4f __ STA T3 + 0
+0b9c : a5 1c __ LDA ACCU + 1
+0b9e : 85 50 __ STA T3 + 1
+0ba0 : 18 __ __ CLC
+0ba1 : a5 1b __ LDA ACCU + 0
+0ba3 : 69 0a __ ADC #$0a
+0ba5 : 85 43 __ STA T4 + 0
+0ba7 : a5 1c __ LDA ACCU + 1
+0ba9 : 69 00 __ ADC #$00
+0bab : 85 44 __ STA T4 + 1
+0bad : 38 __ __ SEC
+0bae : a5 4b __ LDA T1 + 0
+0bb0 : ed d1 24 SBC $24d1 ; (sframe + 0)
+0bb3 : 85 4b __ STA T1 + 0
+0bb5 : a5 4c __ LDA T1 + 1
+0bb7 : ed d2 24 SBC $24d2 ; (sframe + 1)
+0bba : 85 4c __ STA T1 + 1
+0bbc : a5 4b __ LDA T1 + 0
+0bbe : 0a __ __ ASL
+0bbf : 85 07 __ STA $07
+0bc1 : a5 4c __ LDA T1 + 1
+0bc3 : 2a __ __ ROL
+0bc4 : 06 07 __ ASL $07
+0bc6 : 2a __ __ ROL
+0bc7 : 06 07 __ ASL $07
+0bc9 : 2a __ __ ROL
+0bca : aa __ __ TAX
+0bcb : 38 __ __ SEC
+0bcc : a5 07 __ LDA $07
+0bce : e5 4b __ SBC T1 + 0
+0bd0 : 85 1b __ STA ACCU + 0
+0bd2 : 8a __ __ TXA
+0bd3 : e5 4c __ SBC T1 + 1
+0bd5 : 85 1c __ STA ACCU + 1
+0bd7 : 38 __ __ SEC
+0bd8 : a5 1b __ LDA ACCU + 0
+0bda : e5 4f __ SBC T3 + 0
+0bdc : 85 4b __ STA T1 + 0
+0bde : a5 1c __ LDA ACCU + 1
+0be0 : e5 50 __ SBC T3 + 1
+0be2 : 85 4c __ STA T1 + 1
+0be4 : a5 51 __ LDA T6 + 0
+0be6 : c9 41 __ CMP #$41
+0be8 : f0 12 __ BEQ $0bfc
+0bea : ad 68 24 LDA $2468 ; (Ch_1_Glob + 0)
+0bed : c9 41 __ CMP #$41
+0bef : d0 03 __ BNE $0bf4
+0bf1 : 4c 6a 0d JMP $0d6a ; (main + 1130)
+0bf4 : a9 00 __ LDA #$00
+0bf6 : 85 51 __ STA T6 + 0
+0bf8 : a5 51 __ LDA T6 + 0
+0bfa : f0 fc __ BEQ $0bf8
+0bfc : e6 49 __ INC T0 + 0
+0bfe : d0 02 __ BNE $0c02
+0c00 : e6 4a __ INC T0 + 1
+0c02 : a5 4a __ LDA T0 + 1
+0c04 : 49 80 __ EOR #$80
+0c06 : c9 81 __ CMP #$81
+0c08 : d0 04 __ BNE $0c0e
+0c0a : a5 49 __ LDA T0 + 0
+0c0c : c9 f5 __ CMP #$f5
+0c0e : b0 03 __ BCS $0c13
+0c10 : 4c 67 09 JMP $0967 ; (main + 103)
+0c13 : ad 6b 24 LDA $246b ; (Int_Glob + 0)
+0c16 : 85 49 __ STA T0 + 0
+0c18 : ad 6c 24 LDA $246c ; (Int_Glob + 1)
+0c1b : d0 19 __ BNE $0c36
+0c1d : a5 49 __ LDA T0 + 0
+0c1f : c9 05 __ CMP #$05
+0c21 : d0 13 __ BNE $0c36
+0c23 : ad 69 24 LDA $2469 ; (Bool_Glob + 0)
+0c26 : f0 0e __ BEQ $0c36
+0c28 : ad 68 24 LDA $2468 ; (Ch_1_Glob + 0)
+0c2b : c9 41 __ CMP #$41
+0c2d : d0 07 __ BNE $0c36
+0c2f : ad 6a 24 LDA $246a ; (Ch_2_Glob + 0)
+0c32 : c9 42 __ CMP #$42
+0c34 : f0 16 __ BEQ $0c4c
+0c36 : a9 01 __ LDA #$01
+0c38 : 85 1b __ STA ACCU + 0
+0c3a : a9 00 __ LDA #$00
+0c3c : 85 1c __ STA ACCU + 1
+0c3e : 18 __ __ CLC
+0c3f : a5 23 __ LDA SP + 0
+0c41 : 69 04 __ ADC #$04
+0c43 : 85 23 __ STA SP + 0
+0c45 : a5 24 __ LDA SP + 1
+0c47 : 69 00 __ ADC #$00
+0c49 : 85 24 __ STA SP + 1
+0c4b : 60 __ __ RTS
+0c4c : ad 7d 24 LDA $247d ; (Arr_1_Glob + 16)
+0c4f : 85 49 __ STA T0 + 0
+0c51 : ad 7e 24 LDA $247e ; (Arr_1_Glob + 17)
+0c54 : d0 18 __ BNE $0c6e
+0c56 : a5 49 __ LDA T0 + 0
+0c58 : c9 07 __ CMP #$07
+0c5a : d0 12 __ BNE $0c6e
+0c5c : ad 0e 14 LDA $140e ; (Arr_2_Glob + 814)
+0c5f : 85 49 __ STA T0 + 0
+0c61 : ad 0f 14 LDA $140f ; (Arr_2_Glob + 815)
+0c64 : c9 01 __ CMP #$01
+0c66 : d0 06 __ BNE $0c6e
+0c68 : a5 49 __ LDA T0 + 0
+0c6a : c9 fe __ CMP #$fe
+0c6c : f0 09 __ BEQ $0c77
+0c6e : a9 02 __ LDA #$02
+0c70 : 85 1b __ STA ACCU + 0
+0c72 : a9 00 __ LDA #$00
+0c74 : 4c 3c 0c JMP $0c3c ; (main + 828)
+0c77 : ad de 10 LDA $10de ; (Ptr_Glob + 0)
+0c7a : 85 49 __ STA T0 + 0
+0c7c : ad df 10 LDA $10df ; (Ptr_Glob + 1)
+0c7f : 85 4a __ STA T0 + 1
+0c81 : a0 02 __ LDY #$02
+0c83 : b1 49 __ LDA (T0 + 0),y
+0c85 : d0 19 __ BNE $0ca0
+0c87 : a0 03 __ LDY #$03
+0c89 : b1 49 __ LDA (T0 + 0),y
+0c8b : c9 02 __ CMP #$02
+0c8d : d0 11 __ BNE $0ca0
+0c8f : a0 04 __ LDY #$04
+0c91 : b1 49 __ LDA (T0 + 0),y
+0c93 : 85 4d __ STA T2 + 0
+0c95 : c8 __ __ INY
+0c96 : b1 49 __ LDA (T0 + 0),y
+0c98 : d0 06 __ BNE $0ca0
+0c9a : a5 4d __ LDA T2 + 0
+0c9c : c9 11 __ CMP #$11
+0c9e : f0 09 __ BEQ $0ca9
+0ca0 : a9 03 __ LDA #$03
+0ca2 : 85 1b __ STA ACCU + 0
+0ca4 : a9 00 __ LDA #$00
+0ca6 : 4c 3c 0c JMP $0c3c ; (main + 828)
+0ca9 : ad b7 10 LDA $10b7 ; (Next_Ptr_Glob + 0)
+0cac : 85 4d __ STA T2 + 0
+0cae : ad b8 10 LDA $10b8 ; (Next_Ptr_Glob + 1)
+0cb1 : 85 4e __ STA T2 + 1
+0cb3 : a0 02 __ LDY #$02
+0cb5 : b1 4d __ LDA (T2 + 0),y
+0cb7 : d0 19 __ BNE $0cd2
+0cb9 : a0 03 __ LDY #$03
+0cbb : b1 4d __ LDA (T2 + 0),y
+0cbd : c9 01 __ CMP #$01
+0cbf : d0 11 __ BNE $0cd2
+0cc1 : a0 04 __ LDY #$04
+0cc3 : b1 4d __ LDA (T2 + 0),y
+0cc5 : 85 02 __ STA $02
+0cc7 : c8 __ __ INY
+0cc8 : b1 4d __ LDA (T2 + 0),y
+0cca : d0 06 __ BNE $0cd2
+0ccc : a5 02 __ LDA $02
+0cce : c9 12 __ CMP #$12
+0cd0 : f0 09 __ BEQ $0cdb
+0cd2 : a9 04 __ LDA #$04
+0cd4 : 85 1b __ STA ACCU + 0
+0cd6 : a9 00 __ LDA #$00
+0cd8 : 4c 3c 0c JMP $0c3c ; (main + 828)
+0cdb : 38 __ __ SEC
+0cdc : a5 43 __ LDA T4 + 0
+0cde : e9 01 __ SBC #$01
+0ce0 : aa __ __ TAX
+0ce1 : a5 44 __ LDA T4 + 1
+0ce3 : e9 00 __ SBC #$00
+0ce5 : a8 __ __ TAY
+0ce6 : 38 __ __ SEC
+0ce7 : 8a __ __ TXA
+0ce8 : ed 6b 24 SBC $246b ; (Int_Glob + 0)
+0ceb : 85 4d __ STA T2 + 0
+0ced : 98 __ __ TYA
+0cee : ed 6c 24 SBC $246c ; (Int_Glob + 1)
+0cf1 : d0 27 __ BNE $0d1a
+0cf3 : a5 4d __ LDA T2 + 0
+0cf5 : c9 05 __ CMP #$05
+0cf7 : d0 21 __ BNE $0d1a
+0cf9 : a5 4c __ LDA T1 + 1
+0cfb : d0 1d __ BNE $0d1a
+0cfd : a5 4b __ LDA T1 + 0
+0cff : c9 0d __ CMP #$0d
+0d01 : d0 17 __ BNE $0d1a
+0d03 : ad d1 24 LDA $24d1 ; (sframe + 0)
+0d06 : 85 4b __ STA T1 + 0
+0d08 : ad d2 24 LDA $24d2 ; (sframe + 1)
+0d0b : d0 0d __ BNE $0d1a
+0d0d : a5 4b __ LDA T1 + 0
+0d0f : c9 07 __ CMP #$07
+0d11 : d0 07 __ BNE $0d1a
+0d13 : ad d3 24 LDA $24d3 ; (sframe + 2)
+0d16 : c9 01 __ CMP #$01
+0d18 : f0 09 __ BEQ $0d23
+0d1a : a9 05 __ LDA #$05
+0d1c : 85 1b __ STA ACCU + 0
+0d1e : a9 00 __ LDA #$00
+0d20 : 4c 3c 0c JMP $0c3c ; (main + 828)
+0d23 : 18 __ __ CLC
+0d24 : a5 49 __ LDA T0 + 0
+0d26 : 69 06 __ ADC #$06
+0d28 : 85 0d __ STA P0
+0d2a : a5 4a __ LDA T0 + 1
+0d2c : 69 00 __ ADC #$00
+0d2e : 85 0e __ STA P1
+0d30 : a9 87 __ LDA #$87
+0d32 : 85 0f __ STA P2
+0d34 : a9 0f __ LDA #$0f
+0d36 : 85 10 __ STA P3
+0d38 : 20 79 0e JSR $0e79 ; (strcmp + 0)
+0d3b : a5 1b __ LDA ACCU + 0
+0d3d : 05 1c __ ORA ACCU + 1
+0d3f : d0 20 __ BNE $0d61
+0d41 : a9 f3 __ LDA #$f3
+0d43 : 85 0d __ STA P0
+0d45 : a9 24 __ LDA #$24
+0d47 : 85 0e __ STA P1
+0d49 : a9 a6 __ LDA #$a6
+0d4b : 85 0f __ STA P2
+0d4d : a9 0f __ LDA #$0f
+0d4f : 85 10 __ STA P3
+0d51 : 20 79 0e JSR $0e79 ; (strcmp + 0)
+0d54 : a5 1b __ LDA ACCU + 0
+0d56 : 05 1c __ ORA ACCU + 1
+0d58 : d0 07 __ BNE $0d61
+0d5a : a9 00 __ LDA #$00
+0d5c : 85 1b __ STA ACCU + 0
+0d5e : 4c 3c 0c JMP $0c3c ; (main + 828)
+0d61 : a9 06 __ LDA #$06
+0d63 : 85 1b __ STA ACCU + 0
+0d65 : a9 00 __ LDA #$00
+0d67 : 4c 3c 0c JMP $0c3c ; (main + 828)
+0d6a : a9 01 __ LDA #$01
+0d6c : 4c f6 0b JMP $0bf6 ; (main + 758)
+0d6f : a9 00 __ LDA #$00
+0d71 : 85 0d __ STA P0
+0d73 : a9 d3 __ LDA #$d3
+0d75 : 85 0e __ STA P1
+0d77 : a9 24 __ LDA #$24
+0d79 : 85 0f __ STA P2
+0d7b : 20 18 0f JSR $0f18 ; (Proc_6 + 0)
+0d7e : a0 ff __ LDY #$ff
+0d80 : c8 __ __ INY
+0d81 : b9 68 0f LDA $0f68,y 
+0d84 : 99 f3 24 STA $24f3,y ; (sframe + 34)
+0d87 : d0 f7 __ BNE $0d80
+0d89 : a5 49 __ LDA T0 + 0
+0d8b : 85 4b __ STA T1 + 0
+0d8d : 8d 6b 24 STA $246b ; (Int_Glob + 0)
+0d90 : a5 4a __ LDA T0 + 1
+0d92 : 85 4c __ STA T1 + 1
+0d94 : 8d 6c 24 STA $246c ; (Int_Glob + 1)
+0d97 : 4c 66 0b JMP $0b66 ; (main + 614)
+0d9a : a9 06 __ LDA #$06
+0d9c : a0 04 __ LDY #$04
+0d9e : 91 4f __ STA (T3 + 0),y
+0da0 : a9 00 __ LDA #$00
+0da2 : c8 __ __ INY
+0da3 : 91 4f __ STA (T3 + 0),y
+0da5 : a0 03 __ LDY #$03
+0da7 : b1 4d __ LDA (T2 + 0),y
+0da9 : 85 0d __ STA P0
+0dab : 18 __ __ CLC
+0dac : a5 4f __ LDA T3 + 0
+0dae : 69 03 __ ADC #$03
+0db0 : 85 0e __ STA P1
+0db2 : a5 50 __ LDA T3 + 1
+0db4 : 69 00 __ ADC #$00
+0db6 : 85 0f __ STA P2
+0db8 : 20 18 0f JSR $0f18 ; (Proc_6 + 0)
+0dbb : ad de 10 LDA $10de ; (Ptr_Glob + 0)
+0dbe : 85 4d __ STA T2 + 0
+0dc0 : ad df 10 LDA $10df ; (Ptr_Glob + 1)
+0dc3 : 85 4e __ STA T2 + 1
+0dc5 : a0 00 __ LDY #$00
+0dc7 : b1 4d __ LDA (T2 + 0),y
+0dc9 : 91 4f __ STA (T3 + 0),y
+0dcb : c8 __ __ INY
+0dcc : b1 4d __ LDA (T2 + 0),y
+0dce : 91 4f __ STA (T3 + 0),y
+0dd0 : a0 04 __ LDY #$04
+0dd2 : b1 4f __ LDA (T3 + 0),y
+0dd4 : 85 0d __ STA P0
+0dd6 : c8 __ __ INY
+0dd7 : b1 4f __ LDA (T3 + 0),y
+0dd9 : 85 0e __ STA P1
+0ddb : a9 0a __ LDA #$0a
+0ddd : 85 0f __ STA P2
+0ddf : a9 00 __ LDA #$00
+0de1 : 85 10 __ STA P3
+0de3 : 18 __ __ CLC
+0de4 : a5 4f __ LDA T3 + 0
+0de6 : 69 04 __ ADC #$04
+0de8 : 85 11 __ STA P4
+0dea : a5 50 __ LDA T3 + 1
+0dec : 69 00 __ ADC #$00
+0dee : 85 12 __ STA P5
+0df0 : 20 a8 0e JSR $0ea8 ; (Proc_7 + 0)
+0df3 : 4c 42 0b JMP $0b42 ; (main + 578)
+0df6 : a9 0a __ LDA #$0a
+0df8 : 8d 6b 24 STA $246b ; (Int_Glob + 0)
+0dfb : a9 00 __ LDA #$00
+0dfd : 8d 6c 24 STA $246c ; (Int_Glob + 1)
+0e00 : 4c da 09 JMP $09da ; (main + 218)
+--------------------------------------------------------------------
+Func_1:
+0e60 : a5 0d __ LDA P0
+0e62 : c5 0e __ CMP P1
+0e64 : f0 07 __ BEQ $0e6d
+0e66 : a9 00 __ LDA #$00
+0e68 : 85 1b __ STA ACCU + 0
+0e6a : 85 1c __ STA ACCU + 1
+0e6c : 60 __ __ RTS
+0e6d : 8d 68 24 STA $2468 ; (Ch_1_Glob + 0)
+0e70 : a9 01 __ LDA #$01
+0e72 : 85 1b __ STA ACCU + 0
+0e74 : a9 00 __ LDA #$00
+0e76 : 4c 6a 0e JMP $0e6a ; (Func_1 + 10)
+--------------------------------------------------------------------
+strcmp:
+0e79 : a0 00 __ LDY #$00
+0e7b : 84 1c __ STY ACCU + 1
+0e7d : b1 0d __ LDA (P0),y
+0e7f : f0 16 __ BEQ $0e97
+0e81 : d1 0f __ CMP (P2),y
+0e83 : d0 16 __ BNE $0e9b
+0e85 : c8 __ __ INY
+0e86 : b1 0d __ LDA (P0),y
+0e88 : f0 0d __ BEQ $0e97
+0e8a : d1 0f __ CMP (P2),y
+0e8c : d0 0d __ BNE $0e9b
+0e8e : c8 __ __ INY
+0e8f : d0 ec __ BNE $0e7d
+0e91 : e6 0e __ INC P1
+0e93 : e6 10 __ INC P3
+0e95 : d0 e6 __ BNE $0e7d
+0e97 : d1 0f __ CMP (P2),y
+0e99 : f0 0a __ BEQ $0ea5
+0e9b : b0 06 __ BCS $0ea3
+0e9d : a9 ff __ LDA #$ff
+0e9f : 85 1c __ STA ACCU + 1
+0ea1 : 30 02 __ BMI $0ea5
+0ea3 : a9 01 __ LDA #$01
+0ea5 : 85 1b __ STA ACCU + 0
+0ea7 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0ea8 : 18 __ __ CLC
+0ea9 : a5 0d __ LDA P0
+0eab : 69 02 __ ADC #$02
+0ead : 85 43 __ STA T0 + 0
+0eaf : a5 0e __ LDA P1
+0eb1 : 69 00 __ ADC #$00
+0eb3 : 85 44 __ STA T0 + 1
+0eb5 : 18 __ __ CLC
+0eb6 : a5 0f __ LDA P2
+0eb8 : 65 43 __ ADC T0 + 0
+0eba : a0 00 __ LDY #$00
+0ebc : 91 11 __ STA (P4),y
+0ebe : a5 10 __ LDA P3
+0ec0 : 65 44 __ ADC T0 + 1
+0ec2 : c8 __ __ INY
+0ec3 : 91 11 __ STA (P4),y
+0ec5 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_3:
+0ec6 : ad de 10 LDA $10de ; (Ptr_Glob + 0)
+0ec9 : 85 43 __ STA T0 + 0
+0ecb : ad df 10 LDA $10df ; (Ptr_Glob + 1)
+0ece : 85 44 __ STA T0 + 1
+0ed0 : a5 43 __ LDA T0 + 0
+0ed2 : 0d df 10 ORA $10df ; (Ptr_Glob + 1)
+0ed5 : f0 1e __ BEQ $0ef5
+0ed7 : a0 00 __ LDY #$00
+0ed9 : b1 43 __ LDA (T0 + 0),y
+0edb : aa __ __ TAX
+0edc : c8 __ __ INY
+0edd : b1 43 __ LDA (T0 + 0),y
+0edf : 85 46 __ STA T1 + 1
+0ee1 : c8 __ __ INY
+0ee2 : b1 23 __ LDA (SP + 0),y
+0ee4 : 85 47 __ STA T2 + 0
+0ee6 : c8 __ __ INY
+0ee7 : b1 23 __ LDA (SP + 0),y
+0ee9 : 85 48 __ STA T2 + 1
+0eeb : 8a __ __ TXA
+0eec : a0 00 __ LDY #$00
+0eee : 91 47 __ STA (T2 + 0),y
+0ef0 : a5 46 __ LDA T1 + 1
+0ef2 : c8 __ __ INY
+0ef3 : 91 47 __ STA (T2 + 0),y
+0ef5 : a9 0a __ LDA #$0a
+0ef7 : 85 0d __ STA P0
+0ef9 : a9 00 __ LDA #$00
+0efb : 85 0e __ STA P1
+0efd : ad 6b 24 LDA $246b ; (Int_Glob + 0)
+0f00 : 85 0f __ STA P2
+0f02 : ad 6c 24 LDA $246c ; (Int_Glob + 1)
+0f05 : 85 10 __ STA P3
+0f07 : 18 __ __ CLC
+0f08 : a5 43 __ LDA T0 + 0
+0f0a : 69 04 __ ADC #$04
+0f0c : 85 11 __ STA P4
+0f0e : a5 44 __ LDA T0 + 1
+0f10 : 69 00 __ ADC #$00
+0f12 : 85 12 __ STA P5
+0f14 : 20 a8 0e JSR $0ea8 ; (Proc_7 + 0)
+0f17 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_6:
+0f18 : a6 0d __ LDX P0
+0f1a : 8a __ __ TXA
+0f1b : a0 00 __ LDY #$00
+0f1d : 91 0e __ STA (P1),y
+0f1f : c9 02 __ CMP #$02
+0f21 : f0 04 __ BEQ $0f27
+0f23 : a9 03 __ LDA #$03
+0f25 : 91 0e __ STA (P1),y
+0f27 : 8a __ __ TXA
+0f28 : e0 03 __ CPX #$03
+0f2a : f0 0c __ BEQ $0f38
+0f2c : c9 03 __ CMP #$03
+0f2e : 90 09 __ BCC $0f39
+0f30 : c9 04 __ CMP #$04
+0f32 : d0 04 __ BNE $0f38
+0f34 : a9 02 __ LDA #$02
+0f36 : 91 0e __ STA (P1),y
+0f38 : 60 __ __ RTS
+0f39 : 09 00 __ ORA #$00
+0f3b : f0 24 __ BEQ $0f61
+0f3d : c9 01 __ CMP #$01
+0f3f : f0 0b __ BEQ $0f4c
+0f41 : c9 02 __ CMP #$02
+0f43 : d0 f3 __ BNE $0f38
+0f45 : a9 01 __ LDA #$01
+0f47 : 91 0e __ STA (P1),y
+0f49 : 4c 38 0f JMP $0f38 ; (Proc_6 + 32)
+0f4c : ad 6c 24 LDA $246c ; (Int_Glob + 1)
+0f4f : 10 07 __ BPL $0f58
+0f51 : a9 03 __ LDA #$03
+0f53 : 91 0e __ STA (P1),y
+0f55 : 4c 38 0f JMP $0f38 ; (Proc_6 + 32)
+0f58 : d0 07 __ BNE $0f61
+0f5a : a9 64 __ LDA #$64
+0f5c : cd 6b 24 CMP $246b ; (Int_Glob + 0)
+0f5f : b0 f0 __ BCS $0f51
+0f61 : a9 00 __ LDA #$00
+0f63 : 91 0e __ STA (P1),y
+0f65 : 4c 38 0f JMP $0f38 ; (Proc_6 + 32)
+--------------------------------------------------------------------
+inp_exit:
+0fc5 : a9 4c __ LDA #$4c
+0fc7 : 85 54 __ STA $54
+0fc9 : a9 00 __ LDA #$00
+0fcb : 85 13 __ STA P6
+0fcd : a9 19 __ LDA #$19
+0fcf : 85 16 __ STA P9
+0fd1 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+0fd2 : 24 1c __ BIT ACCU + 1
+0fd4 : 10 0d __ BPL $0fe3
+0fd6 : 20 f0 0f JSR $0ff0 ; (negaccu + 0)
+0fd9 : 24 04 __ BIT $04
+0fdb : 10 0d __ BPL $0fea
+0fdd : 20 fe 0f JSR $0ffe ; (negtmp + 0)
+0fe0 : 4c 0c 10 JMP $100c ; (divmod + 0)
+0fe3 : 24 04 __ BIT $04
+0fe5 : 10 f9 __ BPL $0fe0
+0fe7 : 20 fe 0f JSR $0ffe ; (negtmp + 0)
+0fea : 20 0c 10 JSR $100c ; (divmod + 0)
+0fed : 4c f0 0f JMP $0ff0 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+0ff0 : 38 __ __ SEC
+0ff1 : a9 00 __ LDA #$00
+0ff3 : e5 1b __ SBC ACCU + 0
+0ff5 : 85 1b __ STA ACCU + 0
+0ff7 : a9 00 __ LDA #$00
+0ff9 : e5 1c __ SBC ACCU + 1
+0ffb : 85 1c __ STA ACCU + 1
+0ffd : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0ffe : 38 __ __ SEC
+0fff : a9 00 __ LDA #$00
+1001 : e5 03 __ SBC $03
+1003 : 85 03 __ STA $03
+1005 : a9 00 __ LDA #$00
+1007 : e5 04 __ SBC $04
+1009 : 85 04 __ STA $04
+100b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+100c : a5 1c __ LDA ACCU + 1
+100e : d0 31 __ BNE $1041
+1010 : a5 04 __ LDA $04
+1012 : d0 1e __ BNE $1032
+1014 : 85 06 __ STA $06
+1016 : a2 04 __ LDX #$04
+1018 : 06 1b __ ASL ACCU + 0
+101a : 2a __ __ ROL
+101b : c5 03 __ CMP $03
+101d : 90 02 __ BCC $1021
+101f : e5 03 __ SBC $03
+1021 : 26 1b __ ROL ACCU + 0
+1023 : 2a __ __ ROL
+1024 : c5 03 __ CMP $03
+1026 : 90 02 __ BCC $102a
+1028 : e5 03 __ SBC $03
+102a : 26 1b __ ROL ACCU + 0
+102c : ca __ __ DEX
+102d : d0 eb __ BNE $101a
+102f : 85 05 __ STA $05
+1031 : 60 __ __ RTS
+1032 : a5 1b __ LDA ACCU + 0
+1034 : 85 05 __ STA $05
+1036 : a5 1c __ LDA ACCU + 1
+1038 : 85 06 __ STA $06
+103a : a9 00 __ LDA #$00
+103c : 85 1b __ STA ACCU + 0
+103e : 85 1c __ STA ACCU + 1
+1040 : 60 __ __ RTS
+1041 : a5 04 __ LDA $04
+1043 : d0 1f __ BNE $1064
+1045 : a5 03 __ LDA $03
+1047 : 30 1b __ BMI $1064
+1049 : a9 00 __ LDA #$00
+104b : 85 06 __ STA $06
+104d : a2 10 __ LDX #$10
+104f : 06 1b __ ASL ACCU + 0
+1051 : 26 1c __ ROL ACCU + 1
+1053 : 2a __ __ ROL
+1054 : c5 03 __ CMP $03
+1056 : 90 02 __ BCC $105a
+1058 : e5 03 __ SBC $03
+105a : 26 1b __ ROL ACCU + 0
+105c : 26 1c __ ROL ACCU + 1
+105e : ca __ __ DEX
+105f : d0 f2 __ BNE $1053
+1061 : 85 05 __ STA $05
+1063 : 60 __ __ RTS
+1064 : a9 00 __ LDA #$00
+1066 : 85 05 __ STA $05
+1068 : 85 06 __ STA $06
+106a : 84 02 __ STY $02
+106c : a0 10 __ LDY #$10
+106e : 18 __ __ CLC
+106f : 26 1b __ ROL ACCU + 0
+1071 : 26 1c __ ROL ACCU + 1
+1073 : 26 05 __ ROL $05
+1075 : 26 06 __ ROL $06
+1077 : 38 __ __ SEC
+1078 : a5 05 __ LDA $05
+107a : e5 03 __ SBC $03
+107c : aa __ __ TAX
+107d : a5 06 __ LDA $06
+107f : e5 04 __ SBC $04
+1081 : 90 04 __ BCC $1087
+1083 : 86 05 __ STX $05
+1085 : 85 06 __ STA $06
+1087 : 88 __ __ DEY
+1088 : d0 e5 __ BNE $106f
+108a : 26 1b __ ROL ACCU + 0
+108c : 26 1c __ ROL ACCU + 1
+108e : a4 02 __ LDY $02
+1090 : 60 __ __ RTS
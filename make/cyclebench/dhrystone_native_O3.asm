@@ -0,0 +1,786 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 62 0f STX $0f62 ; (spentry + 0)
+0811 : a9 63 __ LDA #$63
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0f __ LDA #$0f
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 0f __ SBC #$0f
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 e0 __ LDA #$e0
+0832 : e9 63 __ SBC #$63
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 96 0e JMP $0e96 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : a9 63 __ LDA #$63
+0902 : 8d 88 0f STA $0f88 ; (Next_Ptr_Glob + 0)
+0905 : a9 0f __ LDA #$0f
+0907 : 8d 89 0f STA $0f89 ; (Next_Ptr_Glob + 1)
+090a : a9 8a __ LDA #$8a
+090c : 8d af 0f STA $0faf ; (Ptr_Glob + 0)
+090f : a9 0f __ LDA #$0f
+0911 : 8d b0 0f STA $0fb0 ; (Ptr_Glob + 1)
+0914 : a9 63 __ LDA #$63
+0916 : 8d 8a 0f STA $0f8a ; (Glob_Rec + 0)
+0919 : a9 0f __ LDA #$0f
+091b : 8d 8b 0f STA $0f8b ; (Glob_Rec + 1)
+091e : a9 00 __ LDA #$00
+0920 : 8d 8c 0f STA $0f8c ; (Glob_Rec + 2)
+0923 : a9 02 __ LDA #$02
+0925 : 8d 8d 0f STA $0f8d ; (Glob_Rec + 3)
+0928 : a9 28 __ LDA #$28
+092a : 8d 8e 0f STA $0f8e ; (Glob_Rec + 4)
+092d : a9 00 __ LDA #$00
+092f : 8d 8f 0f STA $0f8f ; (Glob_Rec + 5)
+0932 : a0 ff __ LDY #$ff
+0934 : c8 __ __ INY
+0935 : b9 ad 0d LDA $0dad,y 
+0938 : 99 90 0f STA $0f90,y ; (Glob_Rec + 6)
+093b : d0 f7 __ BNE $0934
+093d : a0 ff __ LDY #$ff
+093f : c8 __ __ INY
+0940 : b9 cc 0d LDA $0dcc,y 
+0943 : 99 a2 23 STA $23a2,y ; (sframe + 0)
+0946 : d0 f7 __ BNE $093f
+0948 : a9 0a __ LDA #$0a
+094a : 8d df 12 STA $12df ; (Arr_2_Glob + 814)
+094d : a9 00 __ LDA #$00
+094f : 8d e0 12 STA $12e0 ; (Arr_2_Glob + 815)
+0952 : a9 01 __ LDA #$01
+0954 : 85 43 __ STA T0 + 0
+0956 : a9 00 __ LDA #$00
+0958 : 85 44 __ STA T0 + 1
+095a : a9 41 __ LDA #$41
+095c : 8d 39 23 STA $2339 ; (Ch_1_Glob + 0)
+095f : a9 01 __ LDA #$01
+0961 : 8d 3a 23 STA $233a ; (Bool_Glob + 0)
+0964 : a9 42 __ LDA #$42
+0966 : 8d 3b 23 STA $233b ; (Ch_2_Glob + 0)
+0969 : a0 ff __ LDY #$ff
+096b : c8 __ __ INY
+096c : b9 eb 0d LDA $0deb,y 
+096f : 99 c1 23 STA $23c1,y ; (sframe + 31)
+0972 : d0 f7 __ BNE $096b
+0974 : a9 03 __ LDA #$03
+0976 : 85 45 __ STA T1 + 0
+0978 : a9 00 __ LDA #$00
+097a : 85 46 __ STA T1 + 1
+097c : a9 01 __ LDA #$01
+097e : 85 49 __ STA T3 + 0
+0980 : 18 __ __ CLC
+0981 : a9 a2 __ LDA #$a2
+0983 : 69 02 __ ADC #$02
+0985 : 85 4e __ STA T6 + 0
+0987 : a9 23 __ LDA #$23
+0989 : 69 00 __ ADC #$00
+098b : 85 4f __ STA T6 + 1
+098d : 18 __ __ CLC
+098e : a9 c1 __ LDA #$c1
+0990 : 69 02 __ ADC #$02
+0992 : 85 4c __ STA T5 + 0
+0994 : a9 23 __ LDA #$23
+0996 : 69 00 __ ADC #$00
+0998 : 85 4d __ STA T5 + 1
+099a : a0 00 __ LDY #$00
+099c : b1 4e __ LDA (T6 + 0),y
+099e : c8 __ __ INY
+099f : d1 4c __ CMP (T5 + 0),y
+09a1 : d0 03 __ BNE $09a6
+09a3 : 4c a7 0d JMP $0da7 ; (main + 1191)
+09a6 : a9 a2 __ LDA #$a2
+09a8 : 85 0d __ STA P0
+09aa : a9 23 __ LDA #$23
+09ac : 85 0e __ STA P1
+09ae : a9 c1 __ LDA #$c1
+09b0 : 85 0f __ STA P2
+09b2 : a9 23 __ LDA #$23
+09b4 : 85 10 __ STA P3
+09b6 : 20 0a 0e JSR $0e0a ; (strcmp + 0)
+09b9 : a5 1c __ LDA ACCU + 1
+09bb : 30 07 __ BMI $09c4
+09bd : 05 1b __ ORA ACCU + 0
+09bf : f0 03 __ BEQ $09c4
+09c1 : 4c a2 0d JMP $0da2 ; (main + 1186)
+09c4 : a9 01 __ LDA #$01
+09c6 : 8d 3a 23 STA $233a ; (Bool_Glob + 0)
+09c9 : 18 __ __ CLC
+09ca : a9 48 __ LDA #$48
+09cc : 69 06 __ ADC #$06
+09ce : 85 4a __ STA T4 + 0
+09d0 : a9 23 __ LDA #$23
+09d2 : 69 00 __ ADC #$00
+09d4 : 85 4b __ STA T4 + 1
+09d6 : a9 07 __ LDA #$07
+09d8 : a0 00 __ LDY #$00
+09da : 91 4a __ STA (T4 + 0),y
+09dc : a9 00 __ LDA #$00
+09de : c8 __ __ INY
+09df : 91 4a __ STA (T4 + 0),y
+09e1 : 18 __ __ CLC
+09e2 : a9 4a __ LDA #$4a
+09e4 : 69 06 __ ADC #$06
+09e6 : 85 4a __ STA T4 + 0
+09e8 : a9 23 __ LDA #$23
+09ea : 69 00 __ ADC #$00
+09ec : 85 4b __ STA T4 + 1
+09ee : a9 07 __ LDA #$07
+09f0 : 88 __ __ DEY
+09f1 : 91 4a __ STA (T4 + 0),y
+09f3 : a9 00 __ LDA #$00
+09f5 : c8 __ __ INY
+09f6 : 91 4a __ STA (T4 + 0),y
+09f8 : 18 __ __ CLC
+09f9 : a9 84 __ LDA #$84
+09fb : 69 06 __ ADC #$06
+09fd : 85 47 __ STA T2 + 0
+09ff : a9 23 __ LDA #$23
+0a01 : 69 00 __ ADC #$00
+0a03 : 85 48 __ STA T2 + 1
+0a05 : a9 08 __ LDA #$08
+0a07 : 88 __ __ DEY
+0a08 : 91 47 __ STA (T2 + 0),y
+0a0a : a9 00 __ LDA #$00
+0a0c : c8 __ __ INY
+0a0d : 91 47 __ STA (T2 + 0),y
+0a0f : a9 b1 __ LDA #$b1
+0a11 : 85 4a __ STA T4 + 0
+0a13 : 18 __ __ CLC
+0a14 : a9 b1 __ LDA #$b1
+0a16 : 69 32 __ ADC #$32
+0a18 : 85 4c __ STA T5 + 0
+0a1a : a9 0f __ LDA #$0f
+0a1c : 69 03 __ ADC #$03
+0a1e : 85 4d __ STA T5 + 1
+0a20 : 18 __ __ CLC
+0a21 : a9 b1 __ LDA #$b1
+0a23 : 69 30 __ ADC #$30
+0a25 : 85 4e __ STA T6 + 0
+0a27 : a9 0f __ LDA #$0f
+0a29 : 69 03 __ ADC #$03
+0a2b : 85 4f __ STA T6 + 1
+0a2d : a9 08 __ LDA #$08
+0a2f : a0 00 __ LDY #$00
+0a31 : 91 4e __ STA (T6 + 0),y
+0a33 : a9 00 __ LDA #$00
+0a35 : c8 __ __ INY
+0a36 : 91 4e __ STA (T6 + 0),y
+0a38 : 18 __ __ CLC
+0a39 : a5 4e __ LDA T6 + 0
+0a3b : 69 02 __ ADC #$02
+0a3d : 85 4e __ STA T6 + 0
+0a3f : 90 02 __ BCC $0a43
+0a41 : e6 4f __ INC T6 + 1
+0a43 : a5 4d __ LDA T5 + 1
+0a45 : c5 4f __ CMP T6 + 1
+0a47 : d0 04 __ BNE $0a4d
+0a49 : a5 4c __ LDA T5 + 0
+0a4b : c5 4e __ CMP T6 + 0
+0a4d : b0 de __ BCS $0a2d
+0a4f : 18 __ __ CLC
+0a50 : a9 b1 __ LDA #$b1
+0a52 : 69 2e __ ADC #$2e
+0a54 : 85 4c __ STA T5 + 0
+0a56 : a9 0f __ LDA #$0f
+0a58 : 69 03 __ ADC #$03
+0a5a : 85 4d __ STA T5 + 1
+0a5c : 18 __ __ CLC
+0a5d : a0 00 __ LDY #$00
+0a5f : b1 4c __ LDA (T5 + 0),y
+0a61 : 69 01 __ ADC #$01
+0a63 : 91 4c __ STA (T5 + 0),y
+0a65 : c8 __ __ INY
+0a66 : b1 4c __ LDA (T5 + 0),y
+0a68 : 69 00 __ ADC #$00
+0a6a : 91 4c __ STA (T5 + 0),y
+0a6c : 18 __ __ CLC
+0a6d : a9 3e __ LDA #$3e
+0a6f : 69 10 __ ADC #$10
+0a71 : 85 47 __ STA T2 + 0
+0a73 : a9 23 __ LDA #$23
+0a75 : 69 00 __ ADC #$00
+0a77 : 85 48 __ STA T2 + 1
+0a79 : 18 __ __ CLC
+0a7a : a9 0f __ LDA #$0f
+0a7c : 69 0b __ ADC #$0b
+0a7e : 85 4b __ STA T4 + 1
+0a80 : 88 __ __ DEY
+0a81 : b1 47 __ LDA (T2 + 0),y
+0a83 : 91 4a __ STA (T4 + 0),y
+0a85 : c8 __ __ INY
+0a86 : b1 47 __ LDA (T2 + 0),y
+0a88 : 91 4a __ STA (T4 + 0),y
+0a8a : a9 05 __ LDA #$05
+0a8c : 8d 3c 23 STA $233c ; (Int_Glob + 0)
+0a8f : a9 00 __ LDA #$00
+0a91 : 8d 3d 23 STA $233d ; (Int_Glob + 1)
+0a94 : ad af 0f LDA $0faf ; (Ptr_Glob + 0)
+0a97 : 85 47 __ STA T2 + 0
+0a99 : ad b0 0f LDA $0fb0 ; (Ptr_Glob + 1)
+0a9c : 85 48 __ STA T2 + 1
+0a9e : 88 __ __ DEY
+0a9f : b1 47 __ LDA (T2 + 0),y
+0aa1 : 85 4a __ STA T4 + 0
+0aa3 : c8 __ __ INY
+0aa4 : b1 47 __ LDA (T2 + 0),y
+0aa6 : 85 4b __ STA T4 + 1
+0aa8 : 88 __ __ DEY
+0aa9 : b1 47 __ LDA (T2 + 0),y
+0aab : 85 4c __ STA T5 + 0
+0aad : c8 __ __ INY
+0aae : b1 47 __ LDA (T2 + 0),y
+0ab0 : 85 4d __ STA T5 + 1
+0ab2 : a0 24 __ LDY #$24
+0ab4 : b1 47 __ LDA (T2 + 0),y
+0ab6 : 91 4c __ STA (T5 + 0),y
+0ab8 : 88 __ __ DEY
+0ab9 : 10 f9 __ BPL $0ab4
+0abb : a9 05 __ LDA #$05
+0abd : a0 04 __ LDY #$04
+0abf : 91 47 __ STA (T2 + 0),y
+0ac1 : a9 00 __ LDA #$00
+0ac3 : c8 __ __ INY
+0ac4 : 91 47 __ STA (T2 + 0),y
+0ac6 : a9 05 __ LDA #$05
+0ac8 : 88 __ __ DEY
+0ac9 : 91 4a __ STA (T4 + 0),y
+0acb : a9 00 __ LDA #$00
+0acd : c8 __ __ INY
+0ace : 91 4a __ STA (T4 + 0),y
+0ad0 : a0 00 __ LDY #$00
+0ad2 : b1 47 __ LDA (T2 + 0),y
+0ad4 : 91 4a __ STA (T4 + 0),y
+0ad6 : c8 __ __ INY
+0ad7 : b1 47 __ LDA (T2 + 0),y
+0ad9 : 91 4a __ STA (T4 + 0),y
+0adb : a5 47 __ LDA T2 + 0
+0add : 05 48 __ ORA T2 + 1
+0adf : f0 0b __ BEQ $0aec
+0ae1 : a0 00 __ LDY #$00
+0ae3 : b1 47 __ LDA (T2 + 0),y
+0ae5 : 91 4a __ STA (T4 + 0),y
+0ae7 : c8 __ __ INY
+0ae8 : b1 47 __ LDA (T2 + 0),y
+0aea : 91 4a __ STA (T4 + 0),y
+0aec : a9 11 __ LDA #$11
+0aee : a0 04 __ LDY #$04
+0af0 : 91 47 __ STA (T2 + 0),y
+0af2 : a9 00 __ LDA #$00
+0af4 : c8 __ __ INY
+0af5 : 91 47 __ STA (T2 + 0),y
+0af7 : a0 02 __ LDY #$02
+0af9 : b1 4a __ LDA (T4 + 0),y
+0afb : d0 03 __ BNE $0b00
+0afd : 4c 36 0d JMP $0d36 ; (main + 1078)
+0b00 : a0 00 __ LDY #$00
+0b02 : b1 47 __ LDA (T2 + 0),y
+0b04 : 85 4a __ STA T4 + 0
+0b06 : c8 __ __ INY
+0b07 : b1 47 __ LDA (T2 + 0),y
+0b09 : 85 4b __ STA T4 + 1
+0b0b : a0 24 __ LDY #$24
+0b0d : b1 4a __ LDA (T4 + 0),y
+0b0f : 91 47 __ STA (T2 + 0),y
+0b11 : 88 __ __ DEY
+0b12 : 10 f9 __ BPL $0b0d
+0b14 : a9 41 __ LDA #$41
+0b16 : 85 50 __ STA T7 + 0
+0b18 : ad 3b 23 LDA $233b ; (Ch_2_Glob + 0)
+0b1b : c9 41 __ CMP #$41
+0b1d : 90 19 __ BCC $0b38
+0b1f : a5 50 __ LDA T7 + 0
+0b21 : c9 43 __ CMP #$43
+0b23 : d0 03 __ BNE $0b28
+0b25 : 4c 2a 0d JMP $0d2a ; (main + 1066)
+0b28 : a5 49 __ LDA T3 + 0
+0b2a : d0 03 __ BNE $0b2f
+0b2c : 4c 0a 0d JMP $0d0a ; (main + 1034)
+0b2f : ae 3b 23 LDX $233b ; (Ch_2_Glob + 0)
+0b32 : e6 50 __ INC T7 + 0
+0b34 : e4 50 __ CPX T7 + 0
+0b36 : b0 e7 __ BCS $0b1f
+0b38 : ad 39 23 LDA $2339 ; (Ch_1_Glob + 0)
+0b3b : 85 50 __ STA T7 + 0
+0b3d : a5 45 __ LDA T1 + 0
+0b3f : 0a __ __ ASL
+0b40 : aa __ __ TAX
+0b41 : a5 46 __ LDA T1 + 1
+0b43 : 2a __ __ ROL
+0b44 : a8 __ __ TAY
+0b45 : 18 __ __ CLC
+0b46 : 8a __ __ TXA
+0b47 : 65 45 __ ADC T1 + 0
+0b49 : 85 1b __ STA ACCU + 0
+0b4b : 85 45 __ STA T1 + 0
+0b4d : 98 __ __ TYA
+0b4e : 65 46 __ ADC T1 + 1
+0b50 : 85 1c __ STA ACCU + 1
+0b52 : 85 46 __ STA T1 + 1
+0b54 : a9 07 __ LDA #$07
+0b56 : 85 03 __ STA $03
+0b58 : a9 00 __ LDA #$00
+0b5a : 85 04 __ STA $04
+0b5c : 20 a3 0e JSR $0ea3 ; (divs16 + 0)
+0b5f : a5 1b __ LDA ACCU + 0
+0b61 : 85 47 __ STA T2 + 0
+0b63 : a5 1c __ LDA ACCU + 1
+0b65 : 85 48 __ STA T2 + 1
+0b67 : 18 __ __ CLC
+0b68 : a5 1b __ LDA ACCU + 0
+0b6a : 69 0a __ ADC #$0a
+0b6c : 85 51 __ STA T8 + 0
+0b6e : 38 __ __ SEC
+0b6f : a5 45 __ LDA T1 + 0
+0b71 : e9 07 __ SBC #$07
+0b73 : 85 45 __ STA T1 + 0
+0b75 : a5 46 __ LDA T1 + 1
+0b77 : e9 00 __ SBC #$00
+0b79 : 85 46 __ STA T1 + 1
+0b7b : a5 45 __ LDA T1 + 0
+0b7d : 0a __ __ ASL
+0b7e : 85 07 __ STA $07
+0b80 : a5 46 __ LDA T1 + 1
+0b82 : 2a __ __ ROL
+0b83 : 06 07 __ ASL $07
+0b85 : 2a __ __ ROL
+0b86 : 06 07 __ ASL $07
+0b88 : 2a __ __ ROL
+0b89 : aa __ __ TAX
+0b8a : 38 __ __ SEC
+0b8b : a5 07 __ LDA $07
+0b8d : e5 45 __ SBC T1 + 0
+0b8f : 85 1b __ STA ACCU + 0
+0b91 : 8a __ __ TXA
+0b92 : e5 46 __ SBC T1 + 1
+0b94 : 85 1c __ STA ACCU + 1
+0b96 : 38 __ __ SEC
+0b97 : a5 1b __ LDA ACCU + 0
+0b99 : e5 47 __ SBC T2 + 0
+0b9b : 85 45 __ STA T1 + 0
+0b9d : a5 1c __ LDA ACCU + 1
+0b9f : e5 48 __ SBC T2 + 1
+0ba1 : 85 46 __ STA T1 + 1
+0ba3 : a5 50 __ LDA T7 + 0
+0ba5 : c9 41 __ CMP #$41
+0ba7 : f0 12 __ BEQ $0bbb
+0ba9 : ad 39 23 LDA $2339 ; (Ch_1_Glob + 0)
+0bac : c9 41 __ CMP #$41
+0bae : d0 03 __ BNE $0bb3
+0bb0 : 4c 05 0d JMP $0d05 ; (main + 1029)
+0bb3 : a9 00 __ LDA #$00
+0bb5 : 85 50 __ STA T7 + 0
+0bb7 : a5 50 __ LDA T7 + 0
+0bb9 : f0 fc __ BEQ $0bb7
+0bbb : e6 43 __ INC T0 + 0
+0bbd : d0 02 __ BNE $0bc1
+0bbf : e6 44 __ INC T0 + 1
+0bc1 : a5 44 __ LDA T0 + 1
+0bc3 : 49 80 __ EOR #$80
+0bc5 : c9 81 __ CMP #$81
+0bc7 : d0 04 __ BNE $0bcd
+0bc9 : a5 43 __ LDA T0 + 0
+0bcb : c9 f5 __ CMP #$f5
+0bcd : b0 03 __ BCS $0bd2
+0bcf : 4c 5a 09 JMP $095a ; (main + 90)
+0bd2 : ad 3c 23 LDA $233c ; (Int_Glob + 0)
+0bd5 : 85 43 __ STA T0 + 0
+0bd7 : ad 3d 23 LDA $233d ; (Int_Glob + 1)
+0bda : d0 19 __ BNE $0bf5
+0bdc : a5 43 __ LDA T0 + 0
+0bde : c9 05 __ CMP #$05
+0be0 : d0 13 __ BNE $0bf5
+0be2 : ad 3a 23 LDA $233a ; (Bool_Glob + 0)
+0be5 : f0 0e __ BEQ $0bf5
+0be7 : ad 39 23 LDA $2339 ; (Ch_1_Glob + 0)
+0bea : c9 41 __ CMP #$41
+0bec : d0 07 __ BNE $0bf5
+0bee : ad 3b 23 LDA $233b ; (Ch_2_Glob + 0)
+0bf1 : c9 42 __ CMP #$42
+0bf3 : f0 09 __ BEQ $0bfe
+0bf5 : a9 01 __ LDA #$01
+0bf7 : 85 1b __ STA ACCU + 0
+0bf9 : a9 00 __ LDA #$00
+0bfb : 85 1c __ STA ACCU + 1
+0bfd : 60 __ __ RTS
+0bfe : ad 4e 23 LDA $234e ; (Arr_1_Glob + 16)
+0c01 : 85 43 __ STA T0 + 0
+0c03 : ad 4f 23 LDA $234f ; (Arr_1_Glob + 17)
+0c06 : d0 18 __ BNE $0c20
+0c08 : a5 43 __ LDA T0 + 0
+0c0a : c9 07 __ CMP #$07
+0c0c : d0 12 __ BNE $0c20
+0c0e : ad df 12 LDA $12df ; (Arr_2_Glob + 814)
+0c11 : 85 43 __ STA T0 + 0
+0c13 : ad e0 12 LDA $12e0 ; (Arr_2_Glob + 815)
+0c16 : c9 01 __ CMP #$01
+0c18 : d0 06 __ BNE $0c20
+0c1a : a5 43 __ LDA T0 + 0
+0c1c : c9 fe __ CMP #$fe
+0c1e : f0 09 __ BEQ $0c29
+0c20 : a9 02 __ LDA #$02
+0c22 : 85 1b __ STA ACCU + 0
+0c24 : a9 00 __ LDA #$00
+0c26 : 4c fb 0b JMP $0bfb ; (main + 763)
+0c29 : ad af 0f LDA $0faf ; (Ptr_Glob + 0)
+0c2c : 85 43 __ STA T0 + 0
+0c2e : ad b0 0f LDA $0fb0 ; (Ptr_Glob + 1)
+0c31 : 85 44 __ STA T0 + 1
+0c33 : a0 02 __ LDY #$02
+0c35 : b1 43 __ LDA (T0 + 0),y
+0c37 : d0 19 __ BNE $0c52
+0c39 : a0 03 __ LDY #$03
+0c3b : b1 43 __ LDA (T0 + 0),y
+0c3d : c9 02 __ CMP #$02
+0c3f : d0 11 __ BNE $0c52
+0c41 : a0 04 __ LDY #$04
+0c43 : b1 43 __ LDA (T0 + 0),y
+0c45 : 85 47 __ STA T2 + 0
+0c47 : c8 __ __ INY
+0c48 : b1 43 __ LDA (T0 + 0),y
+0c4a : d0 06 __ BNE $0c52
+0c4c : a5 47 __ LDA T2 + 0
+0c4e : c9 11 __ CMP #$11
+0c50 : f0 09 __ BEQ $0c5b
+0c52 : a9 03 __ LDA #$03
+0c54 : 85 1b __ STA ACCU + 0
+0c56 : a9 00 __ LDA #$00
+0c58 : 4c fb 0b JMP $0bfb ; (main + 763)
+0c5b : ad 88 0f LDA $0f88 ; (Next_Ptr_Glob + 0)
+0c5e : 85 47 __ STA T2 + 0
+0c60 : ad 89 0f LDA $0f89 ; (Next_Ptr_Glob + 1)
+0c63 : 85 48 __ STA T2 + 1
+0c65 : a0 02 __ LDY #$02
+0c67 : b1 47 __ LDA (T2 + 0),y
+0c69 : d0 19 __ BNE $0c84
+0c6b : a0 03 __ LDY #$03
+0c6d : b1 47 __ LDA (T2 + 0),y
+0c6f : c9 01 __ CMP #$01
+0c71 : d0 11 __ BNE $0c84
+0c73 : a0 04 __ LDY #$04
+0c75 : b1 47 __ LDA (T2 + 0),y
+0c77 : 85 02 __ STA $02
+0c79 : c8 __ __ INY
+0c7a : b1 47 __ LDA (T2 + 0),y
+0c7c : d0 06 __ BNE $0c84
+0c7e : a5 02 __ LDA $02
+0c80 : c9 12 __ CMP #$12
+0c82 : f0 09 __ BEQ $0c8d
+0c84 : a9 04 __ LDA #$04
+0c86 : 85 1b __ STA ACCU + 0
+0c88 : a9 00 __ LDA #$00
+0c8a : 4c fb 0b JMP $0bfb ; (main + 763)
+0c8d : 38 __ __ SEC
+0c8e : a5 51 __ LDA T8 + 0
+0c90 : e9 01 __ SBC #$01
+0c92 : 38 __ __ SEC
+0c93 : ed 3c 23 SBC $233c ; (Int_Glob + 0)
+0c96 : 85 47 __ STA T2 + 0
+0c98 : a9 00 __ LDA #$00
+0c9a : ed 3d 23 SBC $233d ; (Int_Glob + 1)
+0c9d : d0 16 __ BNE $0cb5
+0c9f : a5 47 __ LDA T2 + 0
+0ca1 : c9 05 __ CMP #$05
+0ca3 : d0 10 __ BNE $0cb5
+0ca5 : a5 46 __ LDA T1 + 1
+0ca7 : d0 0c __ BNE $0cb5
+0ca9 : a5 45 __ LDA T1 + 0
+0cab : c9 0d __ CMP #$0d
+0cad : d0 06 __ BNE $0cb5
+0caf : a5 49 __ LDA T3 + 0
+0cb1 : c9 01 __ CMP #$01
+0cb3 : f0 09 __ BEQ $0cbe
+0cb5 : a9 05 __ LDA #$05
+0cb7 : 85 1b __ STA ACCU + 0
+0cb9 : a9 00 __ LDA #$00
+0cbb : 4c fb 0b JMP $0bfb ; (main + 763)
+0cbe : 18 __ __ CLC
+0cbf : a5 43 __ LDA T0 + 0
+0cc1 : 69 06 __ ADC #$06
+0cc3 : 85 0d __ STA P0
+0cc5 : a5 44 __ LDA T0 + 1
+0cc7 : 69 00 __ ADC #$00
+0cc9 : 85 0e __ STA P1
+0ccb : a9 58 __ LDA #$58
+0ccd : 85 0f __ STA P2
+0ccf : a9 0e __ LDA #$0e
+0cd1 : 85 10 __ STA P3
+0cd3 : 20 0a 0e JSR $0e0a ; (strcmp + 0)
+0cd6 : a5 1b __ LDA ACCU + 0
+0cd8 : 05 1c __ ORA ACCU + 1
+0cda : d0 20 __ BNE $0cfc
+0cdc : a9 c1 __ LDA #$c1
+0cde : 85 0d __ STA P0
+0ce0 : a9 23 __ LDA #$23
+0ce2 : 85 0e __ STA P1
+0ce4 : a9 77 __ LDA #$77
+0ce6 : 85 0f __ STA P2
+0ce8 : a9 0e __ LDA #$0e
+0cea : 85 10 __ STA P3
+0cec : 20 0a 0e JSR $0e0a ; (strcmp + 0)
+0cef : a5 1b __ LDA ACCU + 0
+0cf1 : 05 1c __ ORA ACCU + 1
+0cf3 : d0 07 __ BNE $0cfc
+0cf5 : a9 00 __ LDA #$00
+0cf7 : 85 1b __ STA ACCU + 0
+0cf9 : 4c fb 0b JMP $0bfb ; (main + 763)
+0cfc : a9 06 __ LDA #$06
+0cfe : 85 1b __ STA ACCU + 0
+0d00 : a9 00 __ LDA #$00
+0d02 : 4c fb 0b JMP $0bfb ; (main + 763)
+0d05 : a9 01 __ LDA #$01
+0d07 : 4c b5 0b JMP $0bb5 ; (main + 693)
+0d0a : a0 ff __ LDY #$ff
+0d0c : c8 __ __ INY
+0d0d : b9 39 0e LDA $0e39,y 
+0d10 : 99 c1 23 STA $23c1,y ; (sframe + 31)
+0d13 : d0 f7 __ BNE $0d0c
+0d15 : a5 43 __ LDA T0 + 0
+0d17 : 85 45 __ STA T1 + 0
+0d19 : 8d 3c 23 STA $233c ; (Int_Glob + 0)
+0d1c : a5 44 __ LDA T0 + 1
+0d1e : 85 46 __ STA T1 + 1
+0d20 : 8d 3d 23 STA $233d ; (Int_Glob + 1)
+0d23 : a9 00 __ LDA #$00
+0d25 : 85 49 __ STA T3 + 0
+0d27 : 4c 2f 0b JMP $0b2f ; (main + 559)
+0d2a : 8d 39 23 STA $2339 ; (Ch_1_Glob + 0)
+0d2d : a5 49 __ LDA T3 + 0
+0d2f : c9 01 __ CMP #$01
+0d31 : f0 d7 __ BEQ $0d0a
+0d33 : 4c 2f 0b JMP $0b2f ; (main + 559)
+0d36 : a9 06 __ LDA #$06
+0d38 : a0 04 __ LDY #$04
+0d3a : 91 4a __ STA (T4 + 0),y
+0d3c : a9 00 __ LDA #$00
+0d3e : c8 __ __ INY
+0d3f : 91 4a __ STA (T4 + 0),y
+0d41 : a0 03 __ LDY #$03
+0d43 : b1 47 __ LDA (T2 + 0),y
+0d45 : 85 50 __ STA T7 + 0
+0d47 : 91 4a __ STA (T4 + 0),y
+0d49 : c9 02 __ CMP #$02
+0d4b : f0 04 __ BEQ $0d51
+0d4d : a9 03 __ LDA #$03
+0d4f : 91 4a __ STA (T4 + 0),y
+0d51 : a5 50 __ LDA T7 + 0
+0d53 : c9 03 __ CMP #$03
+0d55 : f0 0c __ BEQ $0d63
+0d57 : c9 03 __ CMP #$03
+0d59 : 90 26 __ BCC $0d81
+0d5b : c9 04 __ CMP #$04
+0d5d : d0 04 __ BNE $0d63
+0d5f : a9 02 __ LDA #$02
+0d61 : 91 4a __ STA (T4 + 0),y
+0d63 : a0 00 __ LDY #$00
+0d65 : b1 47 __ LDA (T2 + 0),y
+0d67 : 91 4a __ STA (T4 + 0),y
+0d69 : c8 __ __ INY
+0d6a : b1 47 __ LDA (T2 + 0),y
+0d6c : 91 4a __ STA (T4 + 0),y
+0d6e : 18 __ __ CLC
+0d6f : a0 04 __ LDY #$04
+0d71 : b1 4a __ LDA (T4 + 0),y
+0d73 : 69 0c __ ADC #$0c
+0d75 : 91 4a __ STA (T4 + 0),y
+0d77 : c8 __ __ INY
+0d78 : b1 4a __ LDA (T4 + 0),y
+0d7a : 69 00 __ ADC #$00
+0d7c : 91 4a __ STA (T4 + 0),y
+0d7e : 4c 14 0b JMP $0b14 ; (main + 532)
+0d81 : 09 00 __ ORA #$00
+0d83 : f0 16 __ BEQ $0d9b
+0d85 : c9 01 __ CMP #$01
+0d87 : f0 0b __ BEQ $0d94
+0d89 : c9 02 __ CMP #$02
+0d8b : d0 d6 __ BNE $0d63
+0d8d : a9 01 __ LDA #$01
+0d8f : 91 4a __ STA (T4 + 0),y
+0d91 : 4c 63 0d JMP $0d63 ; (main + 1123)
+0d94 : a9 03 __ LDA #$03
+0d96 : 91 4a __ STA (T4 + 0),y
+0d98 : 4c 63 0d JMP $0d63 ; (main + 1123)
+0d9b : a9 00 __ LDA #$00
+0d9d : 91 4a __ STA (T4 + 0),y
+0d9f : 4c 63 0d JMP $0d63 ; (main + 1123)
+0da2 : a9 00 __ LDA #$00
+0da4 : 4c c6 09 JMP $09c6 ; (main + 198)
+0da7 : 8d 39 23 STA $2339 ; (Ch_1_Glob + 0)
+0daa : 4c 80 09 JMP $0980 ; (main + 128)
+--------------------------------------------------------------------
+strcmp:
+0e0a : a0 00 __ LDY #$00
+0e0c : 84 1c __ STY ACCU + 1
+0e0e : b1 0d __ LDA (P0),y
+0e10 : f0 16 __ BEQ $0e28
+0e12 : d1 0f __ CMP (P2),y
+0e14 : d0 16 __ BNE $0e2c
+0e16 : c8 __ __ INY
+0e17 : b1 0d __ LDA (P0),y
+0e19 : f0 0d __ BEQ $0e28
+0e1b : d1 0f __ CMP (P2),y
+0e1d : d0 0d __ BNE $0e2c
+0e1f : c8 __ __ INY
+0e20 : d0 ec __ BNE $0e0e
+0e22 : e6 0e __ INC P1
+0e24 : e6 10 __ INC P3
+0e26 : d0 e6 __ BNE $0e0e
+0e28 : d1 0f __ CMP (P2),y
+0e2a : f0 0a __ BEQ $0e36
+0e2c : b0 06 __ BCS $0e34
+0e2e : a9 ff __ LDA #$ff
+0e30 : 85 1c __ STA ACCU + 1
+0e32 : 30 02 __ BMI $0e36
+0e34 : a9 01 __ LDA #$01
+0e36 : 85 1b __ STA ACCU + 0
+0e38 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0e96 : a9 4c __ LDA #$4c
+0e98 : 85 54 __ STA $54
+0e9a : a9 00 __ LDA #$00
+0e9c : 85 13 __ STA P6
+0e9e : a9 19 __ LDA #$19
+0ea0 : 85 16 __ STA P9
+0ea2 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+0ea3 : 24 1c __ BIT ACCU + 1
+0ea5 : 10 0d __ BPL $0eb4
+0ea7 : 20 c1 0e JSR $0ec1 ; (negaccu + 0)
+0eaa : 24 04 __ BIT $04
+0eac : 10 0d __ BPL $0ebb
+0eae : 20 cf 0e JSR $0ecf ; (negtmp + 0)
+0eb1 : 4c dd 0e JMP $0edd ; (divmod + 0)
+0eb4 : 24 04 __ BIT $04
+0eb6 : 10 f9 __ BPL $0eb1
+0eb8 : 20 cf 0e JSR $0ecf ; (negtmp + 0)
+0ebb : 20 dd 0e JSR $0edd ; (divmod + 0)
+0ebe : 4c c1 0e JMP $0ec1 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+0ec1 : 38 __ __ SEC
+0ec2 : a9 00 __ LDA #$00
+0ec4 : e5 1b __ SBC ACCU + 0
+0ec6 : 85 1b __ STA ACCU + 0
+0ec8 : a9 00 __ LDA #$00
+0eca : e5 1c __ SBC ACCU + 1
+0ecc : 85 1c __ STA ACCU + 1
+0ece : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0ecf : 38 __ __ SEC
+0ed0 : a9 00 __ LDA #$00
+0ed2 : e5 03 __ SBC $03
+0ed4 : 85 03 __ STA $03
+0ed6 : a9 00 __ LDA #$00
+0ed8 : e5 04 __ SBC $04
+0eda : 85 04 __ STA $04
+0edc : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0edd : a5 1c __ LDA ACCU + 1
+0edf : d0 31 __ BNE $0f12
+0ee1 : a5 04 __ LDA $04
+0ee3 : d0 1e __ BNE $0f03
+0ee5 : 85 06 __ STA $06
+0ee7 : a2 04 __ LDX #$04
+0ee9 : 06 1b __ ASL ACCU + 0
+0eeb : 2a __ __ ROL
+0eec : c5 03 __ CMP $03
+0eee : 90 02 __ BCC $0ef2
+0ef0 : e5 03 __ SBC $03
+0ef2 : 26 1b __ ROL ACCU + 0
+0ef4 : 2a __ __ ROL
+0ef5 : c5 03 __ CMP $03
+0ef7 : 90 02 __ BCC $0efb
+0ef9 : e5 03 __ SBC $03
+0efb : 26 1b __ ROL ACCU + 0
+0efd : ca __ __ DEX
+0efe : d0 eb __ BNE $0eeb
+0f00 : 85 05 __ STA $05
+0f02 : 60 __ __ RTS
+0f03 : a5 1b __ LDA ACCU + 0
+0f05 : 85 05 __ STA $05
+0f07 : a5 1c __ LDA ACCU + 1
+0f09 : 85 06 __ STA $06
+0f0b : a9 00 __ LDA #$00
+0f0d : 85 1b __ STA ACCU + 0
+0f0f : 85 1c __ STA ACCU + 1
+0f11 : 60 __ __ RTS
+0f12 : a5 04 __ LDA $04
+0f14 : d0 1f __ BNE $0f35
+0f16 : a5 03 __ LDA $03
+0f18 : 30 1b __ BMI $0f35
+0f1a : a9 00 __ LDA #$00
+0f1c : 85 06 __ STA $06
+0f1e : a2 10 __ LDX #$10
+0f20 : 06 1b __ ASL ACCU + 0
+0f22 : 26 1c __ ROL ACCU + 1
+0f24 : 2a __ __ ROL
+0f25 : c5 03 __ CMP $03
+0f27 : 90 02 __ BCC $0f2b
+0f29 : e5 03 __ SBC $03
+0f2b : 26 1b __ ROL ACCU + 0
+0f2d : 26 1c __ ROL ACCU + 1
+0f2f : ca __ __ DEX
+0f30 : d0 f2 __ BNE $0f24
+0f32 : 85 05 __ STA $05
+0f34 : 60 __ __ RTS
+0f35 : a9 00 __ LDA #$00
+0f37 : 85 05 __ STA $05
+0f39 : 85 06 __ STA $06
+0f3b : 84 02 __ STY $02
+0f3d : a0 10 __ LDY #$10
+0f3f : 18 __ __ CLC
+0f40 : 26 1b __ ROL ACCU + 0
+0f42 : 26 1c __ ROL ACCU + 1
+0f44 : 26 05 __ ROL $05
+0f46 : 26 06 __ ROL $06
+0f48 : 38 __ __ SEC
+0f49 : a5 05 __ LDA $05
+0f4b : e5 03 __ SBC $03
+0f4d : aa __ __ TAX
+0f4e : a5 06 __ LDA $06
+0f50 : e5 04 __ SBC $04
+0f52 : 90 04 __ BCC $0f58
+0f54 : 86 05 __ STX $05
+0f56 : 85 06 __ STA $06
+0f58 : 88 __ __ DEY
+0f59 : d0 e5 __ BNE $0f40
+0f5b : 26 1b __ ROL ACCU + 0
+0f5d : 26 1c __ ROL ACCU + 1
+0f5f : a4 02 __ LDY $02
+0f61 : 60 __ __ RTS
@@ -0,0 +1,2905 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e a5 20 STX $20a5 ; (spentry + 0)
+0811 : a9 af __ LDA #$af
+0813 : 85 19 __ STA IP + 0
+0815 : a9 20 __ LDA #$20
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 20 __ LDA #$20
+081c : e9 20 __ SBC #$20
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 af __ LDA #$af
+0832 : e9 af __ SBC #$af
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	LEA	T2, $14c1
+0a14:	MOV	2(SP), T2
+0a17:	MOV	4(SP), T1
+0a1a:	MOVD	T3, c + 0
+0a1e:	MOV	ACCU, T1
+0a20:	CNVSF	ACCU
+0a21:	MULF	ACCU, T3
+0a23:	MOVD	T3, ACCU
+0a25:	MOVD	6(SP), T3
+0a28:	MOVD	10(SP), T0
+0a2b:	SUBF	ACCU, T0
+0a2d:	MOVD	14(SP), ACCU
+0a30:	CALL	printf + 0
+0a33:	MOVD	T3, c + 0
+0a37:	MOV	ACCU, T1
+0a39:	CNVSF	ACCU
+0a3a:	MULF	ACCU, T3
+0a3c:	MOVD	T3, ACCU
+0a3e:	MOVD	ACCU, T0
+0a40:	CMPF	ACCU, T3
+0a42:	SEQ
+0a43:	MOVB	2(SP), ACCU
+0a46:	CALL	assert + 0
+0a49:	MOVD	ACCU, c + 0
+0a4d:	ADDF	ACCU, T0
+0a4f:	MOVD	T0, ACCU
+0a51:	ADD	T1, #$0001
+0a55:	MOV	ACCU, T1
+0a57:	CMPS	ACCU, #$0032
+0a5a:	BGT	$0A14
+0a5c:	MOVD	T0, d + 0
+0a60:	MOV	T1, #1
+0a63:	LEA	T2, $1507
+0a67:	MOV	2(SP), T2
+0a6a:	MOV	4(SP), T1
+0a6d:	MOVD	T3, d + 0
+0a71:	MOV	ACCU, T1
+0a73:	CNVSF	ACCU
+0a74:	MOVD	T4, ACCU
+0a76:	MULF	ACCU, T3
+0a78:	MOVD	T3, ACCU
+0a7a:	MOVD	6(SP), T3
+0a7d:	MOVD	10(SP), T0
+0a80:	SUBF	ACCU, T0
+0a82:	ABSF	ACCU
+0a83:	DIVF	ACCU, T4
+0a85:	MOVD	14(SP), ACCU
+0a88:	CALL	printf + 0
+0a8b:	MOVD	T3, d + 0
+0a8f:	MOV	ACCU, T1
+0a91:	CNVSF	ACCU
+0a92:	MOVD	T4, ACCU
+0a94:	MULF	ACCU, T3
+0a96:	SUBF	ACCU, T0
+0a98:	ABSF	ACCU
+0a99:	MOVD	T3, ACCU
+0a9b:	MOVD	ACCU, T4
+0a9d:	MOVD	$03, #$358637bd
+0aa3:	MULF	ACCU, $03
+0aa5:	CMPF	ACCU, T3
+0aa7:	SLT
+0aa8:	MOVB	2(SP), ACCU
+0aab:	CALL	assert + 0
+0aae:	MOVD	ACCU, d + 0
+0ab2:	ADDF	ACCU, T0
+0ab4:	MOVD	T0, ACCU
+0ab6:	ADD	T1, #$0001
+0aba:	MOV	ACCU, T1
+0abc:	CMPS	ACCU, #$0032
+0abf:	BGT	$0A67
+0ac1:	MOV	ACCU, #0
+0ac4:	POP	#$0012
+0ac7:	RETURN	8, 10
+--------------------------------------------------------------------
+printf:
+0acb:	ENTER	0, 52
+0acf:	PUSH	#$0009
+0ad2:	LEA	T0, 0(FP)
+0ad6:	MOV	2(SP), T0
+0ad9:	MOV	T0, 52(FP)
+0adc:	MOV	4(SP), T0
+0adf:	LEA	T0, 54(FP)
+0ae3:	MOV	6(SP), T0
+0ae6:	MOV	ACCU, #1
+0ae9:	MOVB	8(SP), ACCU
+0aec:	CALL	sformat + 0
+0aef:	POP	#$0009
+0af2:	RETURN	0, 52
+--------------------------------------------------------------------
+sformat:
+0af6:	ENTER	6, 16
+0afa:	PUSH	#$0002
+0afd:	MOV	T0, 10(FP)
+0b00:	MOVB	T1, #0
+0b03:	MOV	T2, 12(FP)
+0b06:	MOV	ADDR, T2
+0b08:	MOVB	T3, 0(ADDR)
+0b0b:	MOVB	ACCU, T3
+0b0d:	BNE	$0B3E
+0b0f:	MOVB	ACCU, T1
+0b11:	ADD	ACCU, T0
+0b13:	MOV	T2, ACCU
+0b15:	MOV	ACCU, #0
+0b18:	MOV	ADDR, T2
+0b1a:	MOVB	0(ADDR), ACCU
+0b1d:	MOVB	ACCU, T1
+0b1f:	BNE	$0B2A
+0b21:	MOV	ACCU, T0
+0b23:	POP	#$0002
+0b26:	RETURN	6, 16
+0b2a:	MOVUB	ACCU, 16(FP)
+0b2d:	BNE	$0B33
+0b2f:	MOV	ACCU, T2
+0b31:	JUMP	$0B23
+0b33:	MOV	ACCU, T0
+0b35:	MOV	P0, ACCU
+0b37:	CALL	puts + 0
+0b3a:	MOV	ACCU, T0
+0b3c:	JUMP	$0B23
+0b3e:	ADD	T2, #$0001
+0b42:	MOVB	ACCU, T3
+0b44:	CMPUB	ACCU, #$0025
+0b46:	BEQ	$0B93
+0b48:	MOVB	ACCU, T1
+0b4a:	LEAX	ADDR, T0 + ACCU
+0b4c:	MOVB	0(ADDR), T3
+0b4f:	ADDB	T1, #$0001
+0b52:	MOVB	ACCU, T1
+0b54:	CMPUB	ACCU, #$0028
+0b56:	BLE	$0B69
+0b58:	MOV	ADDR, T2
+0b5a:	MOVB	T4, 0(ADDR)
+0b5d:	ADD	T2, #$0001
+0b61:	MOVB	ACCU, T4
+0b63:	MOVB	T3, ACCU
+0b65:	BNE	$0B42
+0b67:	JUMP	$0B0F
+0b69:	MOVB	ACCU, T1
+0b6b:	MOV	T5, ACCU
+0b6d:	MOVUB	ACCU, 16(FP)
+0b70:	BNE	$0B7B
+0b72:	MOV	ACCU, T5
+0b74:	ADD	T0, ACCU
+0b76:	MOVB	T1, #0
+0b79:	JUMP	$0B58
+0b7b:	MOV	ACCU, T0
+0b7d:	ADD	T5, ACCU
+0b7f:	MOV	ADDR, T5
+0b81:	MOV	ACCU, #0
+0b84:	MOVB	0(ADDR), ACCU
+0b87:	MOV	ACCU, T0
+0b89:	MOV	P0, ACCU
+0b8b:	CALL	puts + 0
+0b8e:	MOVB	T1, #0
+0b91:	JUMP	$0B58
+0b93:	MOVB	ACCU, T1
+0b95:	BNEF	$0E5B
+0b98:	MOV	ADDR, T2
+0b9a:	MOVB	T3, 0(ADDR)
+0b9d:	MOV	ACCU, #10
+0ba0:	MOV	3(FP), ACCU
+0ba3:	MOV	ACCU, #1
+0ba6:	MOVB	1(FP), ACCU
+0ba9:	MOV	ACCU, #255
+0bac:	MOVB	2(FP), ACCU
+0baf:	MOV	ACCU, #32
+0bb2:	MOVB	0(FP), ACCU
+0bb5:	MOV	ACCU, #0
+0bb8:	MOVB	5(FP), ACCU
+0bbb:	MOVB	6(FP), ACCU
+0bbe:	MOVB	7(FP), ACCU
+0bc1:	ADD	T2, #$0001
+0bc5:	MOVB	ACCU, T3
+0bc7:	CMPUB	ACCU, #$002B
+0bc9:	BEQF	$0E4D
+0bcc:	MOVB	ACCU, T3
+0bce:	CMPUB	ACCU, #$0030
+0bd0:	BEQF	$0E3F
+0bd3:	MOVB	ACCU, T3
+0bd5:	CMPUB	ACCU, #$0023
+0bd7:	BEQF	$0E31
+0bda:	MOVB	ACCU, T3
+0bdc:	CMPUB	ACCU, #$0030
+0bde:	BGT	$0BE7
+0be0:	MOVB	ACCU, T3
+0be2:	CMPUB	ACCU, #$0039
+0be4:	BGEF	$0E00
+0be7:	MOVB	ACCU, T3
+0be9:	CMPUB	ACCU, #$002E
+0beb:	BEQF	$0DC6
+0bee:	MOVB	ACCU, T3
+0bf0:	CMPUB	ACCU, #$0064
+0bf2:	BEQF	$0DA2
+0bf5:	MOVB	ACCU, T3
+0bf7:	CMPUB	ACCU, #$0075
+0bf9:	BEQF	$0D7E
+0bfc:	MOVB	ACCU, T3
+0bfe:	CMPUB	ACCU, #$0078
+0c00:	BEQF	$0D54
+0c03:	MOVB	ACCU, T3
+0c05:	CMPUB	ACCU, #$006C
+0c07:	BEQF	$0CD5
+0c0a:	MOVB	ACCU, T3
+0c0c:	CMPUB	ACCU, #$0066
+0c0e:	BEQF	$0CA4
+0c11:	MOVB	ACCU, T3
+0c13:	CMPUB	ACCU, #$0067
+0c15:	BEQF	$0CA4
+0c18:	MOVB	ACCU, T3
+0c1a:	CMPUB	ACCU, #$0065
+0c1c:	BEQF	$0CA4
+0c1f:	MOVB	ACCU, T3
+0c21:	CMPUB	ACCU, #$0073
+0c23:	BEQ	$0C5B
+0c25:	MOVB	ACCU, T3
+0c27:	CMPUB	ACCU, #$0063
+0c29:	BEQ	$0C3D
+0c2b:	MOVB	ACCU, T3
+0c2d:	BEQF	$0B58
+0c30:	MOVB	ACCU, T1
+0c32:	LEAX	ADDR, T0 + ACCU
+0c34:	MOVB	0(ADDR), T3
+0c37:	ADDB	T1, #$0001
+0c3a:	JUMPF	$0B58
+0c3d:	MOV	T5, 14(FP)
+0c40:	MOV	ACCU, T5
+0c42:	MOV	ADDR, T5
+0c44:	MOV	T5, 0(ADDR)
+0c47:	ADD	ACCU, #$0002
+0c4b:	MOV	14(FP), ACCU
+0c4e:	MOVB	ACCU, T1
+0c50:	LEAX	ADDR, T0 + ACCU
+0c52:	MOVB	0(ADDR), T5
+0c55:	ADDB	T1, #$0001
+0c58:	JUMPF	$0B58
+0c5b:	MOV	T5, 14(FP)
+0c5e:	MOV	ACCU, T5
+0c60:	MOV	ADDR, T5
+0c62:	MOV	T5, 0(ADDR)
+0c65:	ADD	ACCU, #$0002
+0c69:	MOV	14(FP), ACCU
+0c6c:	MOVUB	ACCU, 16(FP)
+0c6f:	BNE	$0C9A
+0c71:	MOV	ADDR, T5
+0c73:	MOVB	T3, 0(ADDR)
+0c76:	MOVB	ACCU, T3
+0c78:	BEQF	$0B58
+0c7b:	ADD	T5, #$0001
+0c7f:	MOV	ADDR, T0
+0c81:	MOVB	0(ADDR), T3
+0c84:	ADD	T0, #$0001
+0c88:	MOV	ADDR, T5
+0c8a:	MOVB	T4, 0(ADDR)
+0c8d:	ADD	T5, #$0001
+0c91:	MOVB	ACCU, T4
+0c93:	MOVB	T3, ACCU
+0c95:	BNE	$0C7F
+0c97:	JUMPF	$0B58
+0c9a:	MOV	ACCU, T5
+0c9c:	MOV	P0, ACCU
+0c9e:	CALL	puts + 0
+0ca1:	JUMPF	$0B58
+0ca4:	LEA	P0, 0(FP)
+0ca8:	MOV	ACCU, T0
+0caa:	MOV	P2, ACCU
+0cac:	MOV	ADDR, 14(FP)
+0caf:	MOVD	T7, 0(ADDR)
+0cb2:	MOVD	ACCU, T7
+0cb4:	MOVD	P4, ACCU
+0cb6:	MOVB	ACCU, T3
+0cb8:	MOVB	P8, ACCU
+0cba:	CALL	nformf + 0
+0cbd:	MOV	T1, ACCU
+0cbf:	MOV	T5, 14(FP)
+0cc2:	MOV	ACCU, T5
+0cc4:	ADD	ACCU, #$0002
+0cc8:	MOV	14(FP), ACCU
+0ccb:	ADD	T5, #$0004
+0ccf:	MOV	14(FP), T5
+0cd2:	JUMPF	$0B58
+0cd5:	MOV	T5, 14(FP)
+0cd8:	MOV	ADDR, T5
+0cda:	MOVD	T7, 0(ADDR)
+0cdd:	MOV	ACCU, T5
+0cdf:	ADD	ACCU, #$0002
+0ce3:	MOV	14(FP), ACCU
+0ce6:	ADD	T5, #$0004
+0cea:	MOV	14(FP), T5
+0ced:	MOV	ADDR, T2
+0cef:	MOVB	T3, 0(ADDR)
+0cf2:	ADD	T2, #$0001
+0cf6:	MOVB	ACCU, T3
+0cf8:	CMPUB	ACCU, #$0064
+0cfa:	BEQ	$0D3D
+0cfc:	MOVB	ACCU, T3
+0cfe:	CMPUB	ACCU, #$0075
+0d00:	BEQ	$0D26
+0d02:	MOVB	ACCU, T3
+0d04:	CMPUB	ACCU, #$0078
+0d06:	BNEF	$0B58
+0d09:	MOV	ACCU, #16
+0d0c:	MOV	3(FP), ACCU
+0d0f:	LEA	P0, 0(FP)
+0d13:	MOV	ACCU, T0
+0d15:	MOV	P2, ACCU
+0d17:	MOVD	ACCU, T7
+0d19:	MOVD	P4, ACCU
+0d1b:	MOVB	P8, #0
+0d1e:	CALL	nforml + 0
+0d21:	MOV	T1, ACCU
+0d23:	JUMPF	$0B58
+0d26:	LEA	P0, 0(FP)
+0d2a:	MOV	ACCU, T0
+0d2c:	MOV	P2, ACCU
+0d2e:	MOVD	ACCU, T7
+0d30:	MOVD	P4, ACCU
+0d32:	MOVB	P8, #0
+0d35:	CALL	nforml + 0
+0d38:	MOV	T1, ACCU
+0d3a:	JUMPF	$0B58
+0d3d:	LEA	P0, 0(FP)
+0d41:	MOV	ACCU, T0
+0d43:	MOV	P2, ACCU
+0d45:	MOVD	ACCU, T7
+0d47:	MOVD	P4, ACCU
+0d49:	MOVB	P8, #1
+0d4c:	CALL	nforml + 0
+0d4f:	MOV	T1, ACCU
+0d51:	JUMPF	$0B58
+0d54:	MOV	ACCU, #16
+0d57:	MOV	3(FP), ACCU
+0d5a:	LEA	P0, 0(FP)
+0d5e:	MOV	ACCU, T0
+0d60:	MOV	P2, ACCU
+0d62:	MOV	T5, 14(FP)
+0d65:	MOV	ACCU, T5
+0d67:	MOV	ADDR, T5
+0d69:	MOV	P4, 0(ADDR)
+0d6c:	ADD	ACCU, #$0002
+0d70:	MOV	14(FP), ACCU
+0d73:	MOVB	P6, #0
+0d76:	CALL	nformi + 0
+0d79:	MOV	T1, ACCU
+0d7b:	JUMPF	$0B58
+0d7e:	LEA	P0, 0(FP)
+0d82:	MOV	ACCU, T0
+0d84:	MOV	P2, ACCU
+0d86:	MOV	T5, 14(FP)
+0d89:	MOV	ACCU, T5
+0d8b:	MOV	ADDR, T5
+0d8d:	MOV	P4, 0(ADDR)
+0d90:	ADD	ACCU, #$0002
+0d94:	MOV	14(FP), ACCU
+0d97:	MOVB	P6, #0
+0d9a:	CALL	nformi + 0
+0d9d:	MOV	T1, ACCU
+0d9f:	JUMPF	$0B58
+0da2:	LEA	P0, 0(FP)
+0da6:	MOV	ACCU, T0
+0da8:	MOV	P2, ACCU
+0daa:	MOV	T5, 14(FP)
+0dad:	MOV	ACCU, T5
+0daf:	MOV	ADDR, T5
+0db1:	MOV	P4, 0(ADDR)
+0db4:	ADD	ACCU, #$0002
+0db8:	MOV	14(FP), ACCU
+0dbb:	MOVB	P6, #1
+0dbe:	CALL	nformi + 0
+0dc1:	MOV	T1, ACCU
+0dc3:	JUMPF	$0B58
+0dc6:	MOV	T5, #0
+0dc9:	MOV	ADDR, T2
+0dcb:	MOVB	T3, 0(ADDR)
+0dce:	ADD	T2, #$0001
+0dd2:	MOVB	ACCU, T3
+0dd4:	CMPUB	ACCU, #$0030
+0dd6:	BGT	$0DFA
+0dd8:	MOVB	ACCU, T3
+0dda:	CMPUB	ACCU, #$0039
+0ddc:	BLT	$0DFA
+0dde:	MOVB	ACCU, T3
+0de0:	MOV	T6, ACCU
+0de2:	MOV	ADDR, T2
+0de4:	MOVB	T3, 0(ADDR)
+0de7:	ADD	T2, #$0001
+0deb:	MUL	T5, #10
+0dee:	ADD	T5, ACCU
+0df0:	ADD	T5, #$FFD0
+0df4:	MOVB	ACCU, T3
+0df6:	CMPUB	ACCU, #$0030
+0df8:	BLE	$0DD8
+0dfa:	MOVB	2(FP), T5
+0dfd:	JUMPF	$0BEE
+0e00:	MOV	T5, #0
+0e03:	MOVB	ACCU, T3
+0e05:	CMPUB	ACCU, #$0030
+0e07:	BGT	$0E2B
+0e09:	MOVB	ACCU, T3
+0e0b:	CMPUB	ACCU, #$0039
+0e0d:	BLT	$0E2B
+0e0f:	MOVB	ACCU, T3
+0e11:	MOV	T6, ACCU
+0e13:	MOV	ADDR, T2
+0e15:	MOVB	T3, 0(ADDR)
+0e18:	ADD	T2, #$0001
+0e1c:	MUL	T5, #10
+0e1f:	ADD	T5, ACCU
+0e21:	ADD	T5, #$FFD0
+0e25:	MOVB	ACCU, T3
+0e27:	CMPUB	ACCU, #$0030
+0e29:	BLE	$0E09
+0e2b:	MOVB	1(FP), T5
+0e2e:	JUMPF	$0BE7
+0e31:	MOV	ACCU, #1
+0e34:	MOVB	7(FP), ACCU
+0e37:	MOV	ADDR, T2
+0e39:	MOVB	T3, 0(ADDR)
+0e3c:	JUMPF	$0BC1
+0e3f:	MOV	ACCU, #48
+0e42:	MOVB	0(FP), ACCU
+0e45:	MOV	ADDR, T2
+0e47:	MOVB	T3, 0(ADDR)
+0e4a:	JUMPF	$0BC1
+0e4d:	MOV	ACCU, #1
+0e50:	MOVB	5(FP), ACCU
+0e53:	MOV	ADDR, T2
+0e55:	MOVB	T3, 0(ADDR)
+0e58:	JUMPF	$0BC1
+0e5b:	MOVUB	ACCU, 16(FP)
+0e5e:	BNE	$0E6A
+0e60:	MOVB	ACCU, T1
+0e62:	ADD	T0, ACCU
+0e64:	MOVB	T1, #0
+0e67:	JUMPF	$0B98
+0e6a:	MOVB	ACCU, T1
+0e6c:	LEAX	ADDR, T0 + ACCU
+0e6e:	MOV	ACCU, #0
+0e71:	MOVB	0(ADDR), ACCU
+0e74:	MOV	ACCU, T0
+0e76:	MOV	P0, ACCU
+0e78:	CALL	puts + 0
+0e7b:	MOVB	T1, #0
+0e7e:	JUMPF	$0B98
+--------------------------------------------------------------------
+puts:
+0e81:	ENTER	0, 2
+0e85:	JSR	$0e8c
+0e88:	RETURN	0, 2
+--------------------------------------------------------------------
+0e8c : a0 00 __ LDY #$00
+0e8e : b1 0d __ LDA (P0),y
+0e90 : f0 0b __ BEQ $0e9d
+0e92 : 20 9e 0e JSR $0e9e ; (putpch + 0)
+0e95 : e6 0d __ INC P0
+0e97 : d0 f3 __ BNE $0e8c
+0e99 : e6 0e __ INC P1
+0e9b : d0 ef __ BNE $0e8c
+0e9d : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+0e9e : ae a6 20 LDX $20a6 ; (giocharmap + 0)
+0ea1 : e0 01 __ CPX #$01
+0ea3 : 90 22 __ BCC $0ec7
+0ea5 : c9 0a __ CMP #$0a
+0ea7 : d0 02 __ BNE $0eab
+0ea9 : a9 0d __ LDA #$0d
+0eab : e0 02 __ CPX #$02
+0ead : 90 18 __ BCC $0ec7
+0eaf : c9 41 __ CMP #$41
+0eb1 : 90 14 __ BCC $0ec7
+0eb3 : c9 7b __ CMP #$7b
+0eb5 : b0 10 __ BCS $0ec7
+0eb7 : c9 61 __ CMP #$61
+0eb9 : b0 04 __ BCS $0ebf
+0ebb : c9 5b __ CMP #$5b
+0ebd : b0 08 __ BCS $0ec7
+0ebf : 49 20 __ EOR #$20
+0ec1 : e0 03 __ CPX #$03
+0ec3 : f0 02 __ BEQ $0ec7
+0ec5 : 29 df __ AND #$df
+0ec7 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+0eca:	ENTER	0, 2
+0ece:	MOV	ACCU, P4
+0ed0:	MOV	T0, ACCU
+0ed2:	MOV	T1, ACCU
+0ed4:	MOV	ACCU, P2
+0ed6:	MOV	T2, ACCU
+0ed8:	MOVB	T3, #0
+0edb:	MOVB	ACCU, P6
+0edd:	BEQ	$0EE4
+0edf:	MOV	ACCU, T0
+0ee1:	BLTF	$1001
+0ee4:	MOVB	T4, #10
+0ee7:	MOV	ACCU, T0
+0ee9:	BNEF	$0FC9
+0eec:	MOV	ADDR, P0
+0eee:	MOVB	T5, 2(ADDR)
+0ef1:	MOVB	ACCU, T5
+0ef3:	CMPUB	ACCU, #$00FF
+0ef5:	BNEF	$0FB9
+0ef8:	MOVB	T5, #9
+0efb:	MOVB	ACCU, T4
+0efd:	CMPUB	ACCU, #$0009
+0eff:	BGE	$0F14
+0f01:	ADDB	T4, #$00FF
+0f04:	MOVB	ACCU, T4
+0f06:	LEAX	ADDR, T2 + ACCU
+0f08:	MOV	ACCU, #48
+0f0b:	MOVB	0(ADDR), ACCU
+0f0e:	MOVB	ACCU, T5
+0f10:	CMPUB	ACCU, T4
+0f12:	BGT	$0F01
+0f14:	MOV	ACCU, P0
+0f16:	MOV	T0, ACCU
+0f18:	MOV	ADDR, T0
+0f1a:	MOVUB	ACCU, 7(ADDR)
+0f1d:	BEQ	$0F43
+0f1f:	MOV	ACCU, 3(ADDR)
+0f22:	CMPU	ACCU, #$0010
+0f25:	BNE	$0F43
+0f27:	MOVB	ACCU, T4
+0f29:	ADDB	ACCU, #$00FF
+0f2c:	MOVB	ACCU, ACCU
+0f2e:	LEAX	ADDR, T2 + ACCU
+0f30:	MOV	ACCU, #88
+0f33:	MOVB	0(ADDR), ACCU
+0f36:	ADDB	T4, #$00FE
+0f39:	MOVB	ACCU, T4
+0f3b:	LEAX	ADDR, T2 + ACCU
+0f3d:	MOV	ACCU, #48
+0f40:	MOVB	0(ADDR), ACCU
+0f43:	MOVB	ACCU, T3
+0f45:	BNE	$0FAA
+0f47:	MOV	ADDR, T0
+0f49:	MOVUB	ACCU, 5(ADDR)
+0f4c:	BEQ	$0F5B
+0f4e:	ADDB	T4, #$00FF
+0f51:	MOVB	ACCU, T4
+0f53:	LEAX	ADDR, T2 + ACCU
+0f55:	MOV	ACCU, #43
+0f58:	MOVB	0(ADDR), ACCU
+0f5b:	MOV	ACCU, P0
+0f5d:	MOV	T0, ACCU
+0f5f:	MOV	ADDR, T0
+0f61:	MOVUB	T1, 1(ADDR)
+0f64:	SUBR	T1, #$000A
+0f68:	MOVB	ACCU, T4
+0f6a:	MOV	T6, ACCU
+0f6c:	MOV	ACCU, T1
+0f6e:	CMPS	ACCU, T6
+0f70:	BGT	$0F9B
+0f72:	MOVB	T3, #0
+0f75:	MOVB	ACCU, T4
+0f77:	CMPUB	ACCU, #$000A
+0f79:	BLE	$0F95
+0f7b:	MOVB	ACCU, T4
+0f7d:	LEAX	ADDR, T2 + ACCU
+0f7f:	MOVB	T5, 0(ADDR)
+0f82:	MOVB	ACCU, T3
+0f84:	LEAX	ADDR, T2 + ACCU
+0f86:	MOVB	0(ADDR), T5
+0f89:	ADDB	T3, #$0001
+0f8c:	ADDB	T4, #$0001
+0f8f:	MOVB	ACCU, T4
+0f91:	CMPUB	ACCU, #$000A
+0f93:	BGT	$0F7B
+0f95:	MOVB	ACCU, T3
+0f97:	RETURN	0, 2
+0f9b:	MOVB	T3, 0(ADDR)
+0f9e:	ADDB	T4, #$00FF
+0fa1:	MOVB	ACCU, T4
+0fa3:	LEAX	ADDR, T2 + ACCU
+0fa5:	MOVB	0(ADDR), T3
+0fa8:	JUMP	$0F5B
+0faa:	ADDB	T4, #$00FF
+0fad:	MOVB	ACCU, T4
+0faf:	LEAX	ADDR, T2 + ACCU
+0fb1:	MOV	ACCU, #45
+0fb4:	MOVB	0(ADDR), ACCU
+0fb7:	JUMP	$0F5B
+0fb9:	MOVB	ACCU, T5
+0fbb:	SUBR	ACCU, #$000A
+0fbf:	MOV	T5, ACCU
+0fc1:	CMPUB	ACCU, T4
+0fc3:	BGTF	$0F01
+0fc6:	JUMPF	$0F14
+0fc9:	MOV	ACCU, P0
+0fcb:	MOV	T0, ACCU
+0fcd:	MOV	ADDR, T0
+0fcf:	MOV	T6, 3(ADDR)
+0fd2:	MOV	ACCU, T1
+0fd4:	MODU	ACCU, T6
+0fd6:	MOV	T6, ACCU
+0fd8:	CMPS	ACCU, #$000A
+0fdb:	BLE	$0FE3
+0fdd:	ADD	T6, #$0030
+0fe1:	JUMP	$0FE7
+0fe3:	ADD	T6, #$0037
+0fe7:	ADDB	T4, #$00FF
+0fea:	MOVB	ACCU, T4
+0fec:	LEAX	ADDR, T2 + ACCU
+0fee:	MOVB	0(ADDR), T6
+0ff1:	MOV	ADDR, T0
+0ff3:	MOV	T0, 3(ADDR)
+0ff6:	MOV	ACCU, T1
+0ff8:	DIVU	ACCU, T0
+0ffa:	MOV	T1, ACCU
+0ffc:	BNE	$0FC9
+0ffe:	JUMPF	$0EEC
+1001:	MOVB	T3, #1
+1004:	MOVB	T4, #10
+1007:	NEG	ACCU
+1008:	MOV	T1, ACCU
+100a:	BNE	$0FC9
+100c:	JUMPF	$0EEC
+--------------------------------------------------------------------
+nforml:
+100f:	ENTER	5, 7
+1013:	MOVD	ACCU, P4
+1015:	MOVD	T0, ACCU
+1017:	MOVD	T1, ACCU
+1019:	MOV	ACCU, P2
+101b:	MOV	T2, ACCU
+101d:	MOVB	T3, #0
+1020:	MOVB	ACCU, P8
+1022:	BEQ	$1031
+1024:	MOVD	ACCU, #$00000000
+102a:	EXTRT	T0, inp_op_cmp_s32 + 0
+102e:	BLTF	$1176
+1031:	MOVB	T4, #16
+1034:	MOVD	ACCU, #$00000000
+103a:	EXTRT	T0, inp_op_cmp_u32 + 0
+103e:	BGTF	$111E
+1041:	MOV	ADDR, P0
+1043:	MOVB	T5, 2(ADDR)
+1046:	MOVB	ACCU, T5
+1048:	CMPUB	ACCU, #$00FF
+104a:	BNEF	$110E
+104d:	MOVB	T5, #15
+1050:	MOVB	ACCU, T4
+1052:	CMPUB	ACCU, #$000F
+1054:	BGE	$1069
+1056:	ADDB	T4, #$00FF
+1059:	MOVB	ACCU, T4
+105b:	LEAX	ADDR, T2 + ACCU
+105d:	MOV	ACCU, #48
+1060:	MOVB	0(ADDR), ACCU
+1063:	MOVB	ACCU, T5
+1065:	CMPUB	ACCU, T4
+1067:	BGT	$1056
+1069:	MOV	ACCU, P0
+106b:	MOV	T6, ACCU
+106d:	MOV	ADDR, T6
+106f:	MOVUB	ACCU, 7(ADDR)
+1072:	BEQ	$1098
+1074:	MOV	ACCU, 3(ADDR)
+1077:	CMPU	ACCU, #$0010
+107a:	BNE	$1098
+107c:	MOVB	ACCU, T4
+107e:	ADDB	ACCU, #$00FF
+1081:	MOVB	ACCU, ACCU
+1083:	LEAX	ADDR, T2 + ACCU
+1085:	MOV	ACCU, #88
+1088:	MOVB	0(ADDR), ACCU
+108b:	ADDB	T4, #$00FE
+108e:	MOVB	ACCU, T4
+1090:	LEAX	ADDR, T2 + ACCU
+1092:	MOV	ACCU, #48
+1095:	MOVB	0(ADDR), ACCU
+1098:	MOVB	ACCU, T3
+109a:	BNE	$10FF
+109c:	MOV	ADDR, T6
+109e:	MOVUB	ACCU, 5(ADDR)
+10a1:	BEQ	$10B0
+10a3:	ADDB	T4, #$00FF
+10a6:	MOVB	ACCU, T4
+10a8:	LEAX	ADDR, T2 + ACCU
+10aa:	MOV	ACCU, #43
+10ad:	MOVB	0(ADDR), ACCU
+10b0:	MOV	ACCU, P0
+10b2:	MOV	T6, ACCU
+10b4:	MOV	ADDR, T6
+10b6:	MOVUB	T7, 1(ADDR)
+10b9:	SUBR	T7, #$0010
+10bd:	MOVB	ACCU, T4
+10bf:	MOV	T8, ACCU
+10c1:	MOV	ACCU, T7
+10c3:	CMPS	ACCU, T8
+10c5:	BGT	$10F0
+10c7:	MOVB	T3, #0
+10ca:	MOVB	ACCU, T4
+10cc:	CMPUB	ACCU, #$0010
+10ce:	BLE	$10EA
+10d0:	MOVB	ACCU, T4
+10d2:	LEAX	ADDR, T2 + ACCU
+10d4:	MOVB	T5, 0(ADDR)
+10d7:	MOVB	ACCU, T3
+10d9:	LEAX	ADDR, T2 + ACCU
+10db:	MOVB	0(ADDR), T5
+10de:	ADDB	T3, #$0001
+10e1:	ADDB	T4, #$0001
+10e4:	MOVB	ACCU, T4
+10e6:	CMPUB	ACCU, #$0010
+10e8:	BGT	$10D0
+10ea:	MOVB	ACCU, T3
+10ec:	RETURN	5, 7
+10f0:	MOVB	T3, 0(ADDR)
+10f3:	ADDB	T4, #$00FF
+10f6:	MOVB	ACCU, T4
+10f8:	LEAX	ADDR, T2 + ACCU
+10fa:	MOVB	0(ADDR), T3
+10fd:	JUMP	$10B0
+10ff:	ADDB	T4, #$00FF
+1102:	MOVB	ACCU, T4
+1104:	LEAX	ADDR, T2 + ACCU
+1106:	MOV	ACCU, #45
+1109:	MOVB	0(ADDR), ACCU
+110c:	JUMP	$10B0
+110e:	MOVB	ACCU, T5
+1110:	SUBR	ACCU, #$0010
+1114:	MOV	T5, ACCU
+1116:	CMPUB	ACCU, T4
+1118:	BGTF	$1056
+111b:	JUMPF	$1069
+111e:	MOV	ACCU, P0
+1120:	MOV	T6, ACCU
+1122:	MOV	ADDR, T6
+1124:	MOV	ACCU, 3(ADDR)
+1127:	EXTRT	$00, inp_op_ext_u16 + 0
+112b:	MOVD	T0, ACCU
+112d:	MOVD	ACCU, T1
+112f:	EXTRT	T0, inp_binop_mod_u32 + 0
+1133:	MOVD	T0, ACCU
+1135:	CMPS	ACCU, #$000A
+1138:	BLE	$1142
+113a:	MOV	ACCU, T0
+113c:	ADD	ACCU, #$0030
+1140:	JUMP	$1148
+1142:	MOV	ACCU, T0
+1144:	ADD	ACCU, #$0037
+1148:	MOV	T7, ACCU
+114a:	ADDB	T4, #$00FF
+114d:	MOVB	ACCU, T4
+114f:	LEAX	ADDR, T2 + ACCU
+1151:	MOVB	0(ADDR), T7
+1154:	MOV	ADDR, T6
+1156:	MOV	ACCU, 3(ADDR)
+1159:	EXTRT	$00, inp_op_ext_u16 + 0
+115d:	MOVD	T0, ACCU
+115f:	MOVD	ACCU, T1
+1161:	EXTRT	T0, inp_binop_div_u32 + 0
+1165:	MOVD	T1, ACCU
+1167:	MOVD	ACCU, #$00000000
+116d:	EXTRT	T1, inp_op_cmp_u32 + 0
+1171:	BGT	$111E
+1173:	JUMPF	$1041
+1176:	MOVB	T3, #1
+1179:	MOVB	T4, #16
+117c:	MOVD	ACCU, T0
+117e:	EXTRT	$00, negaccu32 + 0
+1182:	MOVD	T1, ACCU
+1184:	MOVD	ACCU, #$00000000
+118a:	EXTRT	T1, inp_op_cmp_u32 + 0
+118e:	BGT	$111E
+1190:	JUMPF	$1041
+--------------------------------------------------------------------
+nformf:
+1193:	ENTER	10, 12
+1197:	MOV	ACCU, P2
+1199:	MOV	T0, ACCU
+119b:	MOV	T1, ACCU
+119d:	MOVD	ACCU, P4
+119f:	MOVD	T2, ACCU
+11a1:	MOVD	ACCU, #$00000000
+11a7:	CMPF	ACCU, T2
+11a9:	BLTF	$14AC
+11ac:	MOVB	T3, #0
+11af:	MOV	ADDR, P0
+11b1:	MOVUB	ACCU, 5(ADDR)
+11b4:	BEQ	$11C1
+11b6:	MOV	ACCU, #43
+11b9:	MOV	ADDR, T0
+11bb:	MOVB	0(ADDR), ACCU
+11be:	MOVB	T3, #1
+11c1:	MOV	T0, #0
+11c4:	MOV	ADDR, P0
+11c6:	MOVB	T5, 2(ADDR)
+11c9:	MOVB	ACCU, T5
+11cb:	CMPUB	ACCU, #$00FF
+11cd:	BNE	$11D4
+11cf:	MOVB	T5, #6
+11d2:	JUMP	$11D8
+11d4:	AND	T5, #$00FF
+11d8:	MOVD	ACCU, P4
+11da:	MOVD	T2, #$00000000
+11e0:	CMPF	ACCU, T2
+11e2:	BNEF	$1430
+11e5:	MOVB	ACCU, P8
+11e7:	MOVB	T6, ACCU
+11e9:	CMPUB	ACCU, #$0065
+11eb:	SEQ
+11ec:	MOVB	T7, ACCU
+11ee:	MOVB	T8, ACCU
+11f0:	MOVB	ACCU, T5
+11f2:	MOV	T4, ACCU
+11f4:	ADD	T4, #$0001
+11f8:	MOVB	ACCU, T6
+11fa:	CMPUB	ACCU, #$0067
+11fc:	BEQF	$141F
+11ff:	MOVB	ACCU, T7
+1201:	BNEF	$13D3
+1204:	MOV	ACCU, T0
+1206:	BGE	$121E
+1208:	MOVD	ACCU, P4
+120a:	MOVD	$03, #$41200000
+1210:	DIVF	ACCU, $03
+1212:	MOVD	T2, ACCU
+1214:	MOVD	P4, ACCU
+1216:	ADD	T0, #$0001
+121a:	MOV	ACCU, T0
+121c:	BLT	$1208
+121e:	MOVD	T2, #$3f000000
+1224:	MOVB	ACCU, T5
+1226:	ADD	ACCU, T0
+1228:	MOV	T4, ACCU
+122a:	ADD	T4, #$0001
+122e:	MOVB	ACCU, T4
+1230:	CMPUB	ACCU, #$0001
+1232:	BLTF	$13B8
+1235:	MOVD	ACCU, P4
+1237:	ADDF	ACCU, T2
+1239:	MOVD	T2, ACCU
+123b:	MOVD	P4, ACCU
+123d:	MOVD	ACCU, #$41200000
+1243:	CMPF	ACCU, T2
+1245:	BLT	$1258
+1247:	MOVD	ACCU, T2
+1249:	MOVD	$03, #$41200000
+124f:	DIVF	ACCU, $03
+1251:	MOVD	T2, ACCU
+1253:	MOVD	P4, ACCU
+1255:	ADDB	T5, #$00FF
+1258:	MOVB	ACCU, T4
+125a:	MOV	T10, ACCU
+125c:	MOVB	ACCU, T5
+125e:	NEG	ACCU
+125f:	ADD	ACCU, T10
+1261:	MOV	T10, ACCU
+1263:	MOVB	T5, ACCU
+1265:	MOVB	ACCU, T4
+1267:	CMPUB	ACCU, #$0014
+1269:	BGE	$126E
+126b:	MOVB	T4, #20
+126e:	MOVB	ACCU, T10
+1270:	BNE	$127F
+1272:	MOVB	ACCU, T3
+1274:	LEAX	ADDR, T1 + ACCU
+1276:	MOV	ACCU, #48
+1279:	MOVB	0(ADDR), ACCU
+127c:	ADDB	T3, #$0001
+127f:	MOVB	T6, #0
+1282:	MOVB	ACCU, T4
+1284:	BNEF	$1371
+1287:	MOVB	ACCU, T8
+1289:	BNE	$1300
+128b:	MOV	ADDR, P0
+128d:	MOVUB	ACCU, 1(ADDR)
+1290:	CMPUB	ACCU, T3
+1292:	BLT	$129A
+1294:	MOVB	ACCU, T3
+1296:	RETURN	10, 12
+129a:	MOVB	ACCU, T3
+129c:	CMPUB	ACCU, #$0001
+129e:	BLE	$12CF
+12a0:	MOVB	T5, #0
+12a3:	MOVB	ACCU, T3
+12a5:	MOV	T0, ACCU
+12a7:	MOV	ADDR, P0
+12a9:	MOVUB	ACCU, 1(ADDR)
+12ac:	MOV	T4, ACCU
+12ae:	SUB	ACCU, T0
+12b0:	MOV	T10, ACCU
+12b2:	MOVB	ACCU, T5
+12b4:	MOV	T11, ACCU
+12b6:	MOV	ACCU, T10
+12b8:	CMPU	ACCU, T11
+12ba:	BLT	$12C0
+12bc:	MOV	ACCU, T4
+12be:	JUMP	$1296
+12c0:	MOV	ACCU, T1
+12c2:	LEAX	ADDR, T11 + ACCU
+12c4:	MOV	ACCU, #32
+12c7:	MOVB	0(ADDR), ACCU
+12ca:	ADDB	T5, #$0001
+12cd:	JUMP	$12A7
+12cf:	MOVB	T5, #1
+12d2:	MOV	ACCU, P0
+12d4:	MOV	T0, ACCU
+12d6:	MOVB	ACCU, T3
+12d8:	MOV	T4, ACCU
+12da:	MOVB	ACCU, T5
+12dc:	MOV	T10, ACCU
+12de:	MOV	ACCU, T4
+12e0:	SUB	ACCU, T10
+12e2:	MOV	ADDR, T0
+12e4:	MOVB	T6, 1(ADDR)
+12e7:	LEAX	ADDR, T1 + ACCU
+12e9:	MOVB	ACCU, T6
+12eb:	MOVB	T6, 0(ADDR)
+12ee:	SUB	ACCU, T10
+12f0:	LEAX	ADDR, T1 + ACCU
+12f2:	MOVB	0(ADDR), T6
+12f5:	ADDB	T5, #$0001
+12f8:	MOVB	ACCU, T3
+12fa:	CMPUB	ACCU, T5
+12fc:	BLE	$12DA
+12fe:	JUMP	$12A0
+1300:	MOVB	ACCU, T3
+1302:	LEAX	ADDR, T1 + ACCU
+1304:	MOV	ACCU, #69
+1307:	MOVB	0(ADDR), ACCU
+130a:	MOVB	ACCU, T3
+130c:	ADDB	ACCU, #$0001
+130f:	MOVB	T5, ACCU
+1311:	MOV	ACCU, T0
+1313:	BLT	$1324
+1315:	MOVB	ACCU, T5
+1317:	LEAX	ADDR, T1 + ACCU
+1319:	MOV	ACCU, #43
+131c:	MOVB	0(ADDR), ACCU
+131f:	ADDB	T3, #$0002
+1322:	JUMP	$1336
+1324:	MOVB	ACCU, T5
+1326:	LEAX	ADDR, T1 + ACCU
+1328:	MOV	ACCU, #45
+132b:	MOVB	0(ADDR), ACCU
+132e:	ADDB	T3, #$0002
+1331:	MOV	ACCU, T0
+1333:	NEG	ACCU
+1334:	MOV	T0, ACCU
+1336:	MOVB	ACCU, T3
+1338:	ADD	ACCU, T1
+133a:	MOV	T4, ACCU
+133c:	MOV	ACCU, T0
+133e:	MOV	ADDR, #10
+1341:	DIVS	ACCU, ADDR
+1343:	MOV	ADDR, T4
+1345:	MOV	T10, ACCU
+1347:	ADD	T10, #$0030
+134b:	MOVB	0(ADDR), T10
+134e:	MOVB	ACCU, T3
+1350:	ADDB	ACCU, #$0001
+1353:	MOVB	ACCU, ACCU
+1355:	ADD	ACCU, T1
+1357:	MOV	T4, ACCU
+1359:	MOV	ACCU, T0
+135b:	MOV	ADDR, #10
+135e:	MODS	ACCU, ADDR
+1360:	MOV	ADDR, T4
+1362:	MOV	T0, ACCU
+1364:	ADD	T0, #$0030
+1368:	MOVB	0(ADDR), T0
+136b:	ADDB	T3, #$0002
+136e:	JUMPF	$128B
+1371:	MOVB	ACCU, T5
+1373:	CMPUB	ACCU, T6
+1375:	BNE	$1384
+1377:	MOVB	ACCU, T3
+1379:	LEAX	ADDR, T1 + ACCU
+137b:	MOV	ACCU, #46
+137e:	MOVB	0(ADDR), ACCU
+1381:	ADDB	T3, #$0001
+1384:	MOVD	ACCU, P4
+1386:	MOVD	T2, ACCU
+1388:	CNVFS	ACCU
+1389:	MOV	T10, ACCU
+138b:	CNVSF	ACCU
+138c:	MOVD	T9, ACCU
+138e:	MOVD	ACCU, T2
+1390:	SUBF	ACCU, T9
+1392:	MOVD	$03, #$41200000
+1398:	MULF	ACCU, $03
+139a:	MOVD	T2, ACCU
+139c:	MOVD	P4, ACCU
+139e:	MOVB	ACCU, T3
+13a0:	LEAX	ADDR, T1 + ACCU
+13a2:	ADD	T10, #$0030
+13a6:	MOVB	0(ADDR), T10
+13a9:	ADDB	T3, #$0001
+13ac:	ADDB	T6, #$0001
+13af:	MOVB	ACCU, T4
+13b1:	CMPUB	ACCU, T6
+13b3:	BLT	$1371
+13b5:	JUMPF	$1287
+13b8:	MOVB	T6, #1
+13bb:	MOVD	ACCU, T2
+13bd:	MOVD	$03, #$41200000
+13c3:	DIVF	ACCU, $03
+13c5:	MOVD	T2, ACCU
+13c7:	ADDB	T6, #$0001
+13ca:	MOVB	ACCU, T4
+13cc:	CMPUB	ACCU, T6
+13ce:	BLT	$13BB
+13d0:	JUMPF	$1235
+13d3:	MOVD	T2, #$3f000000
+13d9:	MOVB	ACCU, T5
+13db:	BNE	$1405
+13dd:	MOVD	ACCU, P4
+13df:	ADDF	ACCU, T2
+13e1:	MOVD	T2, ACCU
+13e3:	MOVD	P4, ACCU
+13e5:	MOVD	ACCU, #$41200000
+13eb:	CMPF	ACCU, T2
+13ed:	BLTF	$1258
+13f0:	MOVD	ACCU, T2
+13f2:	MOVD	$03, #$41200000
+13f8:	DIVF	ACCU, $03
+13fa:	MOVD	T2, ACCU
+13fc:	MOVD	P4, ACCU
+13fe:	ADD	T0, #$0001
+1402:	JUMPF	$1258
+1405:	MOVB	T6, #0
+1408:	MOVD	ACCU, T2
+140a:	MOVD	$03, #$41200000
+1410:	DIVF	ACCU, $03
+1412:	MOVD	T2, ACCU
+1414:	ADDB	T6, #$0001
+1417:	MOVB	ACCU, T5
+1419:	CMPUB	ACCU, T6
+141b:	BLT	$1408
+141d:	JUMP	$13DD
+141f:	MOV	ACCU, T0
+1421:	CMPS	ACCU, #$0003
+1424:	BLT	$142B
+1426:	MOV	ACCU, T0
+1428:	BGEF	$11FF
+142b:	MOVB	T8, #1
+142e:	JUMP	$13D3
+1430:	MOVD	ACCU, P4
+1432:	MOVD	T2, #$447a0000
+1438:	CMPF	ACCU, T2
+143a:	BGT	$1458
+143c:	MOVD	ACCU, P4
+143e:	MOVD	$03, #$447a0000
+1444:	DIVF	ACCU, $03
+1446:	MOVD	T2, ACCU
+1448:	MOVD	P4, ACCU
+144a:	ADD	T0, #$0003
+144e:	MOVD	ACCU, #$447a0000
+1454:	CMPF	ACCU, T2
+1456:	BGE	$143C
+1458:	MOVD	ACCU, P4
+145a:	MOVD	T2, #$3f800000
+1460:	CMPF	ACCU, T2
+1462:	BLE	$1480
+1464:	MOVD	ACCU, P4
+1466:	MOVD	$03, #$447a0000
+146c:	MULF	ACCU, $03
+146e:	MOVD	T2, ACCU
+1470:	MOVD	P4, ACCU
+1472:	ADD	T0, #$FFFD
+1476:	MOVD	ACCU, #$3f800000
+147c:	CMPF	ACCU, T2
+147e:	BLT	$1464
+1480:	MOVD	ACCU, P4
+1482:	MOVD	T2, #$41200000
+1488:	CMPF	ACCU, T2
+148a:	BGTF	$11E5
+148d:	MOVD	ACCU, P4
+148f:	MOVD	$03, #$41200000
+1495:	DIVF	ACCU, $03
+1497:	MOVD	T2, ACCU
+1499:	MOVD	P4, ACCU
+149b:	ADD	T0, #$0001
+149f:	MOVD	ACCU, #$41200000
+14a5:	CMPF	ACCU, T2
+14a7:	BGE	$148D
+14a9:	JUMPF	$11E5
+14ac:	MOV	ADDR, T0
+14ae:	MOVD	ACCU, T2
+14b0:	NEGF	ACCU
+14b1:	MOVD	T2, ACCU
+14b3:	MOVD	P4, ACCU
+14b5:	MOV	ACCU, #45
+14b8:	MOVB	0(ADDR), ACCU
+14bb:	MOVB	T3, #1
+14be:	JUMPF	$11C1
+--------------------------------------------------------------------
+assert:
+14ce:	ENTER	0, 2
+14d2:	PUSH	#$0002
+14d5:	MOVUB	ACCU, 2(FP)
+14d8:	BNE	$14E0
+14da:	MOV	P0, #-1
+14dd:	CALL	exit + 0
+14e0:	POP	#$0002
+14e3:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+14e7:	ENTER	0, 2
+14eb:	JSR	$14f2
+14ee:	RETURN	0, 2
+--------------------------------------------------------------------
+14f2 : a5 0d __ LDA P0
+14f4 : 85 1b __ STA ACCU + 0
+14f6 : a5 0e __ LDA P1
+14f8 : 85 1c __ STA ACCU + 1
+14fa : ae a5 20 LDX $20a5 ; (spentry + 0)
+14fd : 9a __ __ TXS
+14fe : a9 4c __ LDA #$4c
+1500 : 85 54 __ STA $54
+1502 : a9 00 __ LDA #$00
+1504 : 85 13 __ STA P6
+1506 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1514 : b1 19 __ LDA (IP + 0),y
+1516 : c8 __ __ INY
+1517 : aa __ __ TAX
+1518 : b5 00 __ LDA $00,x
+151a : 85 03 __ STA $03
+151c : b5 01 __ LDA $01,x
+151e : 85 04 __ STA $04
+1520 : b5 02 __ LDA $02,x
+1522 : 85 05 __ STA $05
+1524 : b5 03 __ LDA $03,x
+1526 : 85 06 __ STA $06
+1528 : a5 05 __ LDA $05
+152a : 0a __ __ ASL
+152b : a5 06 __ LDA $06
+152d : 2a __ __ ROL
+152e : 85 08 __ STA $08
+1530 : f0 06 __ BEQ $1538
+1532 : a5 05 __ LDA $05
+1534 : 09 80 __ ORA #$80
+1536 : 85 05 __ STA $05
+1538 : a5 1d __ LDA ACCU + 2
+153a : 0a __ __ ASL
+153b : a5 1e __ LDA ACCU + 3
+153d : 2a __ __ ROL
+153e : 85 07 __ STA $07
+1540 : f0 06 __ BEQ $1548
+1542 : a5 1d __ LDA ACCU + 2
+1544 : 09 80 __ ORA #$80
+1546 : 85 1d __ STA ACCU + 2
+1548 : 60 __ __ RTS
+1549 : 06 1e __ ASL ACCU + 3
+154b : a5 07 __ LDA $07
+154d : 6a __ __ ROR
+154e : 85 1e __ STA ACCU + 3
+1550 : b0 06 __ BCS $1558
+1552 : a5 1d __ LDA ACCU + 2
+1554 : 29 7f __ AND #$7f
+1556 : 85 1d __ STA ACCU + 2
+1558 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1559 : 38 __ __ SEC
+155a : a5 07 __ LDA $07
+155c : e5 08 __ SBC $08
+155e : f0 38 __ BEQ $1598
+1560 : aa __ __ TAX
+1561 : b0 25 __ BCS $1588
+1563 : e0 e9 __ CPX #$e9
+1565 : b0 0e __ BCS $1575
+1567 : a5 08 __ LDA $08
+1569 : 85 07 __ STA $07
+156b : a9 00 __ LDA #$00
+156d : 85 1b __ STA ACCU + 0
+156f : 85 1c __ STA ACCU + 1
+1571 : 85 1d __ STA ACCU + 2
+1573 : f0 23 __ BEQ $1598
+1575 : a5 1d __ LDA ACCU + 2
+1577 : 4a __ __ LSR
+1578 : 66 1c __ ROR ACCU + 1
+157a : 66 1b __ ROR ACCU + 0
+157c : e8 __ __ INX
+157d : d0 f8 __ BNE $1577
+157f : 85 1d __ STA ACCU + 2
+1581 : a5 08 __ LDA $08
+1583 : 85 07 __ STA $07
+1585 : 4c 98 15 JMP $1598 ; (faddsub + 63)
+1588 : e0 18 __ CPX #$18
+158a : b0 33 __ BCS $15bf
+158c : a5 05 __ LDA $05
+158e : 4a __ __ LSR
+158f : 66 04 __ ROR $04
+1591 : 66 03 __ ROR $03
+1593 : ca __ __ DEX
+1594 : d0 f8 __ BNE $158e
+1596 : 85 05 __ STA $05
+1598 : a5 1e __ LDA ACCU + 3
+159a : 29 80 __ AND #$80
+159c : 85 1e __ STA ACCU + 3
+159e : 45 06 __ EOR $06
+15a0 : 30 2d __ BMI $15cf
+15a2 : 18 __ __ CLC
+15a3 : a5 1b __ LDA ACCU + 0
+15a5 : 65 03 __ ADC $03
+15a7 : 85 1b __ STA ACCU + 0
+15a9 : a5 1c __ LDA ACCU + 1
+15ab : 65 04 __ ADC $04
+15ad : 85 1c __ STA ACCU + 1
+15af : a5 1d __ LDA ACCU + 2
+15b1 : 65 05 __ ADC $05
+15b3 : 85 1d __ STA ACCU + 2
+15b5 : 90 08 __ BCC $15bf
+15b7 : 66 1d __ ROR ACCU + 2
+15b9 : 66 1c __ ROR ACCU + 1
+15bb : 66 1b __ ROR ACCU + 0
+15bd : e6 07 __ INC $07
+15bf : a5 07 __ LDA $07
+15c1 : 4a __ __ LSR
+15c2 : 05 1e __ ORA ACCU + 3
+15c4 : 85 1e __ STA ACCU + 3
+15c6 : b0 06 __ BCS $15ce
+15c8 : a5 1d __ LDA ACCU + 2
+15ca : 29 7f __ AND #$7f
+15cc : 85 1d __ STA ACCU + 2
+15ce : 60 __ __ RTS
+15cf : 38 __ __ SEC
+15d0 : a5 1b __ LDA ACCU + 0
+15d2 : e5 03 __ SBC $03
+15d4 : 85 1b __ STA ACCU + 0
+15d6 : a5 1c __ LDA ACCU + 1
+15d8 : e5 04 __ SBC $04
+15da : 85 1c __ STA ACCU + 1
+15dc : a5 1d __ LDA ACCU + 2
+15de : e5 05 __ SBC $05
+15e0 : 85 1d __ STA ACCU + 2
+15e2 : b0 19 __ BCS $15fd
+15e4 : 38 __ __ SEC
+15e5 : a9 00 __ LDA #$00
+15e7 : e5 1b __ SBC ACCU + 0
+15e9 : 85 1b __ STA ACCU + 0
+15eb : a9 00 __ LDA #$00
+15ed : e5 1c __ SBC ACCU + 1
+15ef : 85 1c __ STA ACCU + 1
+15f1 : a9 00 __ LDA #$00
+15f3 : e5 1d __ SBC ACCU + 2
+15f5 : 85 1d __ STA ACCU + 2
+15f7 : a5 1e __ LDA ACCU + 3
+15f9 : 49 80 __ EOR #$80
+15fb : 85 1e __ STA ACCU + 3
+15fd : a5 1d __ LDA ACCU + 2
+15ff : 30 be __ BMI $15bf
+1601 : 05 1c __ ORA ACCU + 1
+1603 : 05 1b __ ORA ACCU + 0
+1605 : f0 0f __ BEQ $1616
+1607 : c6 07 __ DEC $07
+1609 : f0 0b __ BEQ $1616
+160b : 06 1b __ ASL ACCU + 0
+160d : 26 1c __ ROL ACCU + 1
+160f : 26 1d __ ROL ACCU + 2
+1611 : 10 f4 __ BPL $1607
+1613 : 4c bf 15 JMP $15bf ; (faddsub + 102)
+1616 : a9 00 __ LDA #$00
+1618 : 85 1b __ STA ACCU + 0
+161a : 85 1c __ STA ACCU + 1
+161c : 85 1d __ STA ACCU + 2
+161e : 85 1e __ STA ACCU + 3
+1620 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1621 : a5 1b __ LDA ACCU + 0
+1623 : 05 1c __ ORA ACCU + 1
+1625 : 05 1d __ ORA ACCU + 2
+1627 : d0 03 __ BNE $162c
+1629 : 85 1e __ STA ACCU + 3
+162b : 60 __ __ RTS
+162c : a5 03 __ LDA $03
+162e : 05 04 __ ORA $04
+1630 : 05 05 __ ORA $05
+1632 : d0 09 __ BNE $163d
+1634 : 85 1b __ STA ACCU + 0
+1636 : 85 1c __ STA ACCU + 1
+1638 : 85 1d __ STA ACCU + 2
+163a : 85 1e __ STA ACCU + 3
+163c : 60 __ __ RTS
+163d : a9 00 __ LDA #$00
+163f : 85 09 __ STA $09
+1641 : 85 0a __ STA $0a
+1643 : 85 0b __ STA $0b
+1645 : a4 1b __ LDY ACCU + 0
+1647 : a5 03 __ LDA $03
+1649 : d0 06 __ BNE $1651
+164b : a5 04 __ LDA $04
+164d : f0 0a __ BEQ $1659
+164f : d0 05 __ BNE $1656
+1651 : 20 91 16 JSR $1691 ; (fmul8 + 0)
+1654 : a5 04 __ LDA $04
+1656 : 20 91 16 JSR $1691 ; (fmul8 + 0)
+1659 : a5 05 __ LDA $05
+165b : 20 91 16 JSR $1691 ; (fmul8 + 0)
+165e : 38 __ __ SEC
+165f : a5 0b __ LDA $0b
+1661 : 30 06 __ BMI $1669
+1663 : 06 09 __ ASL $09
+1665 : 26 0a __ ROL $0a
+1667 : 2a __ __ ROL
+1668 : 18 __ __ CLC
+1669 : 29 7f __ AND #$7f
+166b : 85 0b __ STA $0b
+166d : a5 1e __ LDA ACCU + 3
+166f : 45 06 __ EOR $06
+1671 : 29 80 __ AND #$80
+1673 : 85 1e __ STA ACCU + 3
+1675 : a5 07 __ LDA $07
+1677 : e9 7e __ SBC #$7e
+1679 : 18 __ __ CLC
+167a : 65 08 __ ADC $08
+167c : 4a __ __ LSR
+167d : 05 1e __ ORA ACCU + 3
+167f : 85 1e __ STA ACCU + 3
+1681 : a9 00 __ LDA #$00
+1683 : 6a __ __ ROR
+1684 : 05 0b __ ORA $0b
+1686 : 85 1d __ STA ACCU + 2
+1688 : a5 0a __ LDA $0a
+168a : 85 1c __ STA ACCU + 1
+168c : a5 09 __ LDA $09
+168e : 85 1b __ STA ACCU + 0
+1690 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1691 : 38 __ __ SEC
+1692 : 6a __ __ ROR
+1693 : 90 1e __ BCC $16b3
+1695 : aa __ __ TAX
+1696 : 18 __ __ CLC
+1697 : 98 __ __ TYA
+1698 : 65 09 __ ADC $09
+169a : 85 09 __ STA $09
+169c : a5 0a __ LDA $0a
+169e : 65 1c __ ADC ACCU + 1
+16a0 : 85 0a __ STA $0a
+16a2 : a5 0b __ LDA $0b
+16a4 : 65 1d __ ADC ACCU + 2
+16a6 : 6a __ __ ROR
+16a7 : 85 0b __ STA $0b
+16a9 : 8a __ __ TXA
+16aa : 66 0a __ ROR $0a
+16ac : 66 09 __ ROR $09
+16ae : 4a __ __ LSR
+16af : f0 0d __ BEQ $16be
+16b1 : b0 e2 __ BCS $1695
+16b3 : 66 0b __ ROR $0b
+16b5 : 66 0a __ ROR $0a
+16b7 : 66 09 __ ROR $09
+16b9 : 4a __ __ LSR
+16ba : 90 f7 __ BCC $16b3
+16bc : d0 d7 __ BNE $1695
+16be : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+16bf : a5 1b __ LDA ACCU + 0
+16c1 : 05 1c __ ORA ACCU + 1
+16c3 : 05 1d __ ORA ACCU + 2
+16c5 : d0 03 __ BNE $16ca
+16c7 : 85 1e __ STA ACCU + 3
+16c9 : 60 __ __ RTS
+16ca : a5 1e __ LDA ACCU + 3
+16cc : 45 06 __ EOR $06
+16ce : 29 80 __ AND #$80
+16d0 : 85 1e __ STA ACCU + 3
+16d2 : a9 00 __ LDA #$00
+16d4 : 85 09 __ STA $09
+16d6 : 85 0a __ STA $0a
+16d8 : 85 0b __ STA $0b
+16da : a2 18 __ LDX #$18
+16dc : a5 1b __ LDA ACCU + 0
+16de : c5 03 __ CMP $03
+16e0 : a5 1c __ LDA ACCU + 1
+16e2 : e5 04 __ SBC $04
+16e4 : a5 1d __ LDA ACCU + 2
+16e6 : e5 05 __ SBC $05
+16e8 : 90 13 __ BCC $16fd
+16ea : a5 1b __ LDA ACCU + 0
+16ec : e5 03 __ SBC $03
+16ee : 85 1b __ STA ACCU + 0
+16f0 : a5 1c __ LDA ACCU + 1
+16f2 : e5 04 __ SBC $04
+16f4 : 85 1c __ STA ACCU + 1
+16f6 : a5 1d __ LDA ACCU + 2
+16f8 : e5 05 __ SBC $05
+16fa : 85 1d __ STA ACCU + 2
+16fc : 38 __ __ SEC
+16fd : 26 09 __ ROL $09
+16ff : 26 0a __ ROL $0a
+1701 : 26 0b __ ROL $0b
+1703 : ca __ __ DEX
+1704 : f0 0a __ BEQ $1710
+1706 : 06 1b __ ASL ACCU + 0
+1708 : 26 1c __ ROL ACCU + 1
+170a : 26 1d __ ROL ACCU + 2
+170c : b0 dc __ BCS $16ea
+170e : 90 cc __ BCC $16dc
+1710 : 38 __ __ SEC
+1711 : a5 0b __ LDA $0b
+1713 : 30 06 __ BMI $171b
+1715 : 06 09 __ ASL $09
+1717 : 26 0a __ ROL $0a
+1719 : 2a __ __ ROL
+171a : 18 __ __ CLC
+171b : 29 7f __ AND #$7f
+171d : 85 0b __ STA $0b
+171f : a5 08 __ LDA $08
+1721 : 49 7f __ EOR #$7f
+1723 : 65 07 __ ADC $07
+1725 : 38 __ __ SEC
+1726 : e9 01 __ SBC #$01
+1728 : 4a __ __ LSR
+1729 : 05 1e __ ORA ACCU + 3
+172b : 85 1e __ STA ACCU + 3
+172d : a9 00 __ LDA #$00
+172f : 6a __ __ ROR
+1730 : 05 0b __ ORA $0b
+1732 : 85 1d __ STA ACCU + 2
+1734 : a5 0a __ LDA $0a
+1736 : 85 1c __ STA ACCU + 1
+1738 : a5 09 __ LDA $09
+173a : 85 1b __ STA ACCU + 0
+173c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+173d : 38 __ __ SEC
+173e : a9 00 __ LDA #$00
+1740 : e5 1b __ SBC ACCU + 0
+1742 : 85 1b __ STA ACCU + 0
+1744 : a9 00 __ LDA #$00
+1746 : e5 1c __ SBC ACCU + 1
+1748 : 85 1c __ STA ACCU + 1
+174a : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+174b : 38 __ __ SEC
+174c : a9 00 __ LDA #$00
+174e : e5 03 __ SBC $03
+1750 : 85 03 __ STA $03
+1752 : a9 00 __ LDA #$00
+1754 : e5 04 __ SBC $04
+1756 : 85 04 __ STA $04
+1758 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1759 : a5 1c __ LDA ACCU + 1
+175b : d0 31 __ BNE $178e
+175d : a5 04 __ LDA $04
+175f : d0 1e __ BNE $177f
+1761 : 85 06 __ STA $06
+1763 : a2 04 __ LDX #$04
+1765 : 06 1b __ ASL ACCU + 0
+1767 : 2a __ __ ROL
+1768 : c5 03 __ CMP $03
+176a : 90 02 __ BCC $176e
+176c : e5 03 __ SBC $03
+176e : 26 1b __ ROL ACCU + 0
+1770 : 2a __ __ ROL
+1771 : c5 03 __ CMP $03
+1773 : 90 02 __ BCC $1777
+1775 : e5 03 __ SBC $03
+1777 : 26 1b __ ROL ACCU + 0
+1779 : ca __ __ DEX
+177a : d0 eb __ BNE $1767
+177c : 85 05 __ STA $05
+177e : 60 __ __ RTS
+177f : a5 1b __ LDA ACCU + 0
+1781 : 85 05 __ STA $05
+1783 : a5 1c __ LDA ACCU + 1
+1785 : 85 06 __ STA $06
+1787 : a9 00 __ LDA #$00
+1789 : 85 1b __ STA ACCU + 0
+178b : 85 1c __ STA ACCU + 1
+178d : 60 __ __ RTS
+178e : a5 04 __ LDA $04
+1790 : d0 1f __ BNE $17b1
+1792 : a5 03 __ LDA $03
+1794 : 30 1b __ BMI $17b1
+1796 : a9 00 __ LDA #$00
+1798 : 85 06 __ STA $06
+179a : a2 10 __ LDX #$10
+179c : 06 1b __ ASL ACCU + 0
+179e : 26 1c __ ROL ACCU + 1
+17a0 : 2a __ __ ROL
+17a1 : c5 03 __ CMP $03
+17a3 : 90 02 __ BCC $17a7
+17a5 : e5 03 __ SBC $03
+17a7 : 26 1b __ ROL ACCU + 0
+17a9 : 26 1c __ ROL ACCU + 1
+17ab : ca __ __ DEX
+17ac : d0 f2 __ BNE $17a0
+17ae : 85 05 __ STA $05
+17b0 : 60 __ __ RTS
+17b1 : a9 00 __ LDA #$00
+17b3 : 85 05 __ STA $05
+17b5 : 85 06 __ STA $06
+17b7 : 84 02 __ STY $02
+17b9 : a0 10 __ LDY #$10
+17bb : 18 __ __ CLC
+17bc : 26 1b __ ROL ACCU + 0
+17be : 26 1c __ ROL ACCU + 1
+17c0 : 26 05 __ ROL $05
+17c2 : 26 06 __ ROL $06
+17c4 : 38 __ __ SEC
+17c5 : a5 05 __ LDA $05
+17c7 : e5 03 __ SBC $03
+17c9 : aa __ __ TAX
+17ca : a5 06 __ LDA $06
+17cc : e5 04 __ SBC $04
+17ce : 90 04 __ BCC $17d4
+17d0 : 86 05 __ STX $05
+17d2 : 85 06 __ STA $06
+17d4 : 88 __ __ DEY
+17d5 : d0 e5 __ BNE $17bc
+17d7 : 26 1b __ ROL ACCU + 0
+17d9 : 26 1c __ ROL ACCU + 1
+17db : a4 02 __ LDY $02
+17dd : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+17de : 20 38 15 JSR $1538 ; (freg + 36)
+17e1 : a5 07 __ LDA $07
+17e3 : c9 7f __ CMP #$7f
+17e5 : b0 07 __ BCS $17ee
+17e7 : a9 00 __ LDA #$00
+17e9 : 85 1b __ STA ACCU + 0
+17eb : 85 1c __ STA ACCU + 1
+17ed : 60 __ __ RTS
+17ee : 38 __ __ SEC
+17ef : e9 8e __ SBC #$8e
+17f1 : 90 0a __ BCC $17fd
+17f3 : a9 ff __ LDA #$ff
+17f5 : 85 1b __ STA ACCU + 0
+17f7 : a9 7f __ LDA #$7f
+17f9 : 85 1c __ STA ACCU + 1
+17fb : d0 08 __ BNE $1805
+17fd : aa __ __ TAX
+17fe : 46 1d __ LSR ACCU + 2
+1800 : 66 1c __ ROR ACCU + 1
+1802 : e8 __ __ INX
+1803 : d0 f9 __ BNE $17fe
+1805 : 24 1e __ BIT ACCU + 3
+1807 : 10 0e __ BPL $1817
+1809 : 38 __ __ SEC
+180a : a9 00 __ LDA #$00
+180c : e5 1c __ SBC ACCU + 1
+180e : 85 1b __ STA ACCU + 0
+1810 : a9 00 __ LDA #$00
+1812 : e5 1d __ SBC ACCU + 2
+1814 : 85 1c __ STA ACCU + 1
+1816 : 60 __ __ RTS
+1817 : a5 1c __ LDA ACCU + 1
+1819 : 85 1b __ STA ACCU + 0
+181b : a5 1d __ LDA ACCU + 2
+181d : 85 1c __ STA ACCU + 1
+181f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1820 : 24 1c __ BIT ACCU + 1
+1822 : 30 03 __ BMI $1827
+1824 : 4c 3e 18 JMP $183e ; (uint16_to_float + 0)
+1827 : 38 __ __ SEC
+1828 : a9 00 __ LDA #$00
+182a : e5 1b __ SBC ACCU + 0
+182c : 85 1b __ STA ACCU + 0
+182e : a9 00 __ LDA #$00
+1830 : e5 1c __ SBC ACCU + 1
+1832 : 85 1c __ STA ACCU + 1
+1834 : 20 3e 18 JSR $183e ; (uint16_to_float + 0)
+1837 : a5 1e __ LDA ACCU + 3
+1839 : 09 80 __ ORA #$80
+183b : 85 1e __ STA ACCU + 3
+183d : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+183e : a5 1b __ LDA ACCU + 0
+1840 : 05 1c __ ORA ACCU + 1
+1842 : d0 05 __ BNE $1849
+1844 : 85 1d __ STA ACCU + 2
+1846 : 85 1e __ STA ACCU + 3
+1848 : 60 __ __ RTS
+1849 : a2 8e __ LDX #$8e
+184b : a5 1c __ LDA ACCU + 1
+184d : 30 06 __ BMI $1855
+184f : ca __ __ DEX
+1850 : 06 1b __ ASL ACCU + 0
+1852 : 2a __ __ ROL
+1853 : 10 fa __ BPL $184f
+1855 : 29 7f __ AND #$7f
+1857 : 85 1d __ STA ACCU + 2
+1859 : a5 1b __ LDA ACCU + 0
+185b : 85 1c __ STA ACCU + 1
+185d : 8a __ __ TXA
+185e : 4a __ __ LSR
+185f : 85 1e __ STA ACCU + 3
+1861 : a9 00 __ LDA #$00
+1863 : 85 1b __ STA ACCU + 0
+1865 : 6a __ __ ROR
+1866 : 05 1d __ ORA ACCU + 2
+1868 : 85 1d __ STA ACCU + 2
+186a : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+186b : 38 __ __ SEC
+186c : a9 00 __ LDA #$00
+186e : e5 1b __ SBC ACCU + 0
+1870 : 85 1b __ STA ACCU + 0
+1872 : a9 00 __ LDA #$00
+1874 : e5 1c __ SBC ACCU + 1
+1876 : 85 1c __ STA ACCU + 1
+1878 : a9 00 __ LDA #$00
+187a : e5 1d __ SBC ACCU + 2
+187c : 85 1d __ STA ACCU + 2
+187e : a9 00 __ LDA #$00
+1880 : e5 1e __ SBC ACCU + 3
+1882 : 85 1e __ STA ACCU + 3
+1884 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1885 : 84 02 __ STY $02
+1887 : a9 00 __ LDA #$00
+1889 : 85 07 __ STA $07
+188b : 85 08 __ STA $08
+188d : 85 09 __ STA $09
+188f : 85 0a __ STA $0a
+1891 : a0 20 __ LDY #$20
+1893 : 18 __ __ CLC
+1894 : 26 1b __ ROL ACCU + 0
+1896 : 26 1c __ ROL ACCU + 1
+1898 : 26 1d __ ROL ACCU + 2
+189a : 26 1e __ ROL ACCU + 3
+189c : 26 07 __ ROL $07
+189e : 26 08 __ ROL $08
+18a0 : 26 09 __ ROL $09
+18a2 : 26 0a __ ROL $0a
+18a4 : a5 07 __ LDA $07
+18a6 : c5 03 __ CMP $03
+18a8 : a5 08 __ LDA $08
+18aa : e5 04 __ SBC $04
+18ac : a5 09 __ LDA $09
+18ae : e5 05 __ SBC $05
+18b0 : a5 0a __ LDA $0a
+18b2 : e5 06 __ SBC $06
+18b4 : 90 18 __ BCC $18ce
+18b6 : a5 07 __ LDA $07
+18b8 : e5 03 __ SBC $03
+18ba : 85 07 __ STA $07
+18bc : a5 08 __ LDA $08
+18be : e5 04 __ SBC $04
+18c0 : 85 08 __ STA $08
+18c2 : a5 09 __ LDA $09
+18c4 : e5 05 __ SBC $05
+18c6 : 85 09 __ STA $09
+18c8 : a5 0a __ LDA $0a
+18ca : e5 06 __ SBC $06
+18cc : 85 0a __ STA $0a
+18ce : 88 __ __ DEY
+18cf : d0 c3 __ BNE $1894
+18d1 : 26 1b __ ROL ACCU + 0
+18d3 : 26 1c __ ROL ACCU + 1
+18d5 : 26 1d __ ROL ACCU + 2
+18d7 : 26 1e __ ROL ACCU + 3
+18d9 : a4 02 __ LDY $02
+18db : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+18dc : a9 00 __ LDA #$00
+18de : 85 1d __ STA ACCU + 2
+18e0 : 85 1e __ STA ACCU + 3
+18e2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+18e3 : b5 00 __ LDA $00,x
+18e5 : 85 03 __ STA $03
+18e7 : b5 01 __ LDA $01,x
+18e9 : 85 04 __ STA $04
+18eb : b5 02 __ LDA $02,x
+18ed : 85 05 __ STA $05
+18ef : b5 03 __ LDA $03,x
+18f1 : 85 06 __ STA $06
+18f3 : 20 85 18 JSR $1885 ; (divmod32 + 0)
+18f6 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+18f7 : b5 00 __ LDA $00,x
+18f9 : 85 03 __ STA $03
+18fb : b5 01 __ LDA $01,x
+18fd : 85 04 __ STA $04
+18ff : b5 02 __ LDA $02,x
+1901 : 85 05 __ STA $05
+1903 : b5 03 __ LDA $03,x
+1905 : 85 06 __ STA $06
+1907 : 20 85 18 JSR $1885 ; (divmod32 + 0)
+190a : a5 07 __ LDA $07
+190c : 85 1b __ STA ACCU + 0
+190e : a5 08 __ LDA $08
+1910 : 85 1c __ STA ACCU + 1
+1912 : a5 09 __ LDA $09
+1914 : 85 1d __ STA ACCU + 2
+1916 : a5 0a __ LDA $0a
+1918 : 85 1e __ STA ACCU + 3
+191a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+191b : b5 03 __ LDA $03,x
+191d : c5 1e __ CMP ACCU + 3
+191f : d0 20 __ BNE $1941
+1921 : b5 02 __ LDA $02,x
+1923 : c5 1d __ CMP ACCU + 2
+1925 : d0 1a __ BNE $1941
+1927 : b5 01 __ LDA $01,x
+1929 : c5 1c __ CMP ACCU + 1
+192b : d0 14 __ BNE $1941
+192d : b5 00 __ LDA $00,x
+192f : c5 1b __ CMP ACCU + 0
+1931 : d0 0e __ BNE $1941
+1933 : a9 00 __ LDA #$00
+1935 : 85 1b __ STA ACCU + 0
+1937 : 85 1c __ STA ACCU + 1
+1939 : 60 __ __ RTS
+193a : a9 ff __ LDA #$ff
+193c : 85 1b __ STA ACCU + 0
+193e : 85 1c __ STA ACCU + 1
+1940 : 60 __ __ RTS
+1941 : 90 f7 __ BCC $193a
+1943 : a9 01 __ LDA #$01
+1945 : 85 1b __ STA ACCU + 0
+1947 : a9 00 __ LDA #$00
+1949 : 85 1c __ STA ACCU + 1
+194b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+194c : a5 1e __ LDA ACCU + 3
+194e : 49 80 __ EOR #$80
+1950 : 85 1e __ STA ACCU + 3
+1952 : b5 03 __ LDA $03,x
+1954 : 49 80 __ EOR #$80
+1956 : c5 1e __ CMP ACCU + 3
+1958 : d0 20 __ BNE $197a
+195a : b5 02 __ LDA $02,x
+195c : c5 1d __ CMP ACCU + 2
+195e : d0 1a __ BNE $197a
+1960 : b5 01 __ LDA $01,x
+1962 : c5 1c __ CMP ACCU + 1
+1964 : d0 14 __ BNE $197a
+1966 : b5 00 __ LDA $00,x
+1968 : c5 1b __ CMP ACCU + 0
+196a : d0 0e __ BNE $197a
+196c : a9 00 __ LDA #$00
+196e : 85 1b __ STA ACCU + 0
+1970 : 85 1c __ STA ACCU + 1
+1972 : 60 __ __ RTS
+1973 : a9 ff __ LDA #$ff
+1975 : 85 1b __ STA ACCU + 0
+1977 : 85 1c __ STA ACCU + 1
+1979 : 60 __ __ RTS
+197a : 90 f7 __ BCC $1973
+197c : a9 01 __ LDA #$01
+197e : 85 1b __ STA ACCU + 0
+1980 : a9 00 __ LDA #$00
+1982 : 85 1c __ STA ACCU + 1
+1984 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1985 : a9 4c __ LDA #$4c
+1987 : 85 54 __ STA $54
+1989 : a9 00 __ LDA #$00
+198b : 85 13 __ STA P6
+198d : a9 19 __ LDA #$19
+198f : 85 16 __ STA P9
+1991 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1992 : b1 19 __ LDA (IP + 0),y
+1994 : aa __ __ TAX
+1995 : c8 __ __ INY
+1996 : b1 19 __ LDA (IP + 0),y
+1998 : 95 00 __ STA $00,x
+199a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+199d : b1 19 __ LDA (IP + 0),y
+199f : aa __ __ TAX
+19a0 : c8 __ __ INY
+19a1 : b1 19 __ LDA (IP + 0),y
+19a3 : 95 00 __ STA $00,x
+19a5 : a9 00 __ LDA #$00
+19a7 : 95 01 __ STA $01,x
+19a9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+19ac : b1 19 __ LDA (IP + 0),y
+19ae : aa __ __ TAX
+19af : c8 __ __ INY
+19b0 : b1 19 __ LDA (IP + 0),y
+19b2 : 95 00 __ STA $00,x
+19b4 : a9 ff __ LDA #$ff
+19b6 : 95 01 __ STA $01,x
+19b8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+19bb : b1 19 __ LDA (IP + 0),y
+19bd : aa __ __ TAX
+19be : c8 __ __ INY
+19bf : b1 19 __ LDA (IP + 0),y
+19c1 : 95 00 __ STA $00,x
+19c3 : c8 __ __ INY
+19c4 : b1 19 __ LDA (IP + 0),y
+19c6 : 95 01 __ STA $01,x
+19c8 : c8 __ __ INY
+19c9 : b1 19 __ LDA (IP + 0),y
+19cb : 95 02 __ STA $02,x
+19cd : c8 __ __ INY
+19ce : b1 19 __ LDA (IP + 0),y
+19d0 : 95 03 __ STA $03,x
+19d2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+19d5 : b1 19 __ LDA (IP + 0),y
+19d7 : aa __ __ TAX
+19d8 : b5 00 __ LDA $00,x
+19da : 85 1b __ STA ACCU + 0
+19dc : a9 00 __ LDA #$00
+19de : 85 1c __ STA ACCU + 1
+19e0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+19e3 : b1 19 __ LDA (IP + 0),y
+19e5 : aa __ __ TAX
+19e6 : a5 1b __ LDA ACCU + 0
+19e8 : 95 00 __ STA $00,x
+19ea : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+19ed : b1 19 __ LDA (IP + 0),y
+19ef : aa __ __ TAX
+19f0 : b5 00 __ LDA $00,x
+19f2 : 85 1b __ STA ACCU + 0
+19f4 : b5 01 __ LDA $01,x
+19f6 : 85 1c __ STA ACCU + 1
+19f8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+19fb : b1 19 __ LDA (IP + 0),y
+19fd : aa __ __ TAX
+19fe : a5 1b __ LDA ACCU + 0
+1a00 : 95 00 __ STA $00,x
+1a02 : a5 1c __ LDA ACCU + 1
+1a04 : 95 01 __ STA $01,x
+1a06 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1a09 : b1 19 __ LDA (IP + 0),y
+1a0b : aa __ __ TAX
+1a0c : b5 00 __ LDA $00,x
+1a0e : 85 1f __ STA ADDR + 0
+1a10 : b5 01 __ LDA $01,x
+1a12 : 85 20 __ STA ADDR + 1
+1a14 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1a17 : b1 19 __ LDA (IP + 0),y
+1a19 : aa __ __ TAX
+1a1a : b5 00 __ LDA $00,x
+1a1c : 85 1b __ STA ACCU + 0
+1a1e : b5 01 __ LDA $01,x
+1a20 : 85 1c __ STA ACCU + 1
+1a22 : b5 02 __ LDA $02,x
+1a24 : 85 1d __ STA ACCU + 2
+1a26 : b5 03 __ LDA $03,x
+1a28 : 85 1e __ STA ACCU + 3
+1a2a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1a2d : b1 19 __ LDA (IP + 0),y
+1a2f : aa __ __ TAX
+1a30 : a5 1b __ LDA ACCU + 0
+1a32 : 95 00 __ STA $00,x
+1a34 : a5 1c __ LDA ACCU + 1
+1a36 : 95 01 __ STA $01,x
+1a38 : a5 1d __ LDA ACCU + 2
+1a3a : 95 02 __ STA $02,x
+1a3c : a5 1e __ LDA ACCU + 3
+1a3e : 95 03 __ STA $03,x
+1a40 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1a43 : b1 19 __ LDA (IP + 0),y
+1a45 : 85 1f __ STA ADDR + 0
+1a47 : c8 __ __ INY
+1a48 : b1 19 __ LDA (IP + 0),y
+1a4a : 85 20 __ STA ADDR + 1
+1a4c : c8 __ __ INY
+1a4d : b1 19 __ LDA (IP + 0),y
+1a4f : aa __ __ TAX
+1a50 : 84 02 __ STY $02
+1a52 : a0 00 __ LDY #$00
+1a54 : b1 1f __ LDA (ADDR + 0),y
+1a56 : 95 00 __ STA $00,x
+1a58 : c8 __ __ INY
+1a59 : b1 1f __ LDA (ADDR + 0),y
+1a5b : 95 01 __ STA $01,x
+1a5d : c8 __ __ INY
+1a5e : b1 1f __ LDA (ADDR + 0),y
+1a60 : 95 02 __ STA $02,x
+1a62 : c8 __ __ INY
+1a63 : b1 1f __ LDA (ADDR + 0),y
+1a65 : 95 03 __ STA $03,x
+1a67 : a4 02 __ LDY $02
+1a69 : 4c 50 08 JMP $0850 ; (startup + 79)
+1a6c : b1 19 __ LDA (IP + 0),y
+1a6e : aa __ __ TAX
+1a6f : c8 __ __ INY
+1a70 : b1 19 __ LDA (IP + 0),y
+1a72 : 84 02 __ STY $02
+1a74 : a8 __ __ TAY
+1a75 : 4c 54 1a JMP $1a54 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1a78 : b1 19 __ LDA (IP + 0),y
+1a7a : aa __ __ TAX
+1a7b : c8 __ __ INY
+1a7c : b1 19 __ LDA (IP + 0),y
+1a7e : 95 00 __ STA $00,x
+1a80 : c8 __ __ INY
+1a81 : b1 19 __ LDA (IP + 0),y
+1a83 : 95 01 __ STA $01,x
+1a85 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1a88 : b1 19 __ LDA (IP + 0),y
+1a8a : aa __ __ TAX
+1a8b : 18 __ __ CLC
+1a8c : b5 00 __ LDA $00,x
+1a8e : 65 1b __ ADC ACCU + 0
+1a90 : 85 1f __ STA ADDR + 0
+1a92 : b5 01 __ LDA $01,x
+1a94 : 65 1c __ ADC ACCU + 1
+1a96 : 85 20 __ STA ADDR + 1
+1a98 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1a9b : b1 19 __ LDA (IP + 0),y
+1a9d : aa __ __ TAX
+1a9e : c8 __ __ INY
+1a9f : b1 19 __ LDA (IP + 0),y
+1aa1 : 84 02 __ STY $02
+1aa3 : a8 __ __ TAY
+1aa4 : b1 25 __ LDA (FP + 0),y
+1aa6 : 95 00 __ STA $00,x
+1aa8 : a9 00 __ LDA #$00
+1aaa : 95 01 __ STA $01,x
+1aac : a4 02 __ LDY $02
+1aae : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1ab1 : b1 19 __ LDA (IP + 0),y
+1ab3 : aa __ __ TAX
+1ab4 : c8 __ __ INY
+1ab5 : b1 19 __ LDA (IP + 0),y
+1ab7 : 84 02 __ STY $02
+1ab9 : a8 __ __ TAY
+1aba : b1 25 __ LDA (FP + 0),y
+1abc : 95 00 __ STA $00,x
+1abe : c8 __ __ INY
+1abf : b1 25 __ LDA (FP + 0),y
+1ac1 : 95 01 __ STA $01,x
+1ac3 : a4 02 __ LDY $02
+1ac5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1ac8 : b1 19 __ LDA (IP + 0),y
+1aca : aa __ __ TAX
+1acb : c8 __ __ INY
+1acc : b1 19 __ LDA (IP + 0),y
+1ace : 84 02 __ STY $02
+1ad0 : a8 __ __ TAY
+1ad1 : b5 00 __ LDA $00,x
+1ad3 : 91 25 __ STA (FP + 0),y
+1ad5 : a4 02 __ LDY $02
+1ad7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1ada : b1 19 __ LDA (IP + 0),y
+1adc : aa __ __ TAX
+1add : c8 __ __ INY
+1ade : b1 19 __ LDA (IP + 0),y
+1ae0 : 84 02 __ STY $02
+1ae2 : a8 __ __ TAY
+1ae3 : b5 00 __ LDA $00,x
+1ae5 : 91 25 __ STA (FP + 0),y
+1ae7 : c8 __ __ INY
+1ae8 : b5 01 __ LDA $01,x
+1aea : 91 25 __ STA (FP + 0),y
+1aec : a4 02 __ LDY $02
+1aee : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1af1 : b1 19 __ LDA (IP + 0),y
+1af3 : aa __ __ TAX
+1af4 : c8 __ __ INY
+1af5 : 18 __ __ CLC
+1af6 : b1 19 __ LDA (IP + 0),y
+1af8 : 65 25 __ ADC FP + 0
+1afa : 95 00 __ STA $00,x
+1afc : c8 __ __ INY
+1afd : b1 19 __ LDA (IP + 0),y
+1aff : 65 26 __ ADC FP + 1
+1b01 : 95 01 __ STA $01,x
+1b03 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1b06 : b1 19 __ LDA (IP + 0),y
+1b08 : aa __ __ TAX
+1b09 : c8 __ __ INY
+1b0a : b1 19 __ LDA (IP + 0),y
+1b0c : 84 02 __ STY $02
+1b0e : a8 __ __ TAY
+1b0f : b5 00 __ LDA $00,x
+1b11 : 91 23 __ STA (SP + 0),y
+1b13 : a4 02 __ LDY $02
+1b15 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1b18 : b1 19 __ LDA (IP + 0),y
+1b1a : aa __ __ TAX
+1b1b : c8 __ __ INY
+1b1c : b1 19 __ LDA (IP + 0),y
+1b1e : 84 02 __ STY $02
+1b20 : a8 __ __ TAY
+1b21 : b5 00 __ LDA $00,x
+1b23 : 91 23 __ STA (SP + 0),y
+1b25 : c8 __ __ INY
+1b26 : b5 01 __ LDA $01,x
+1b28 : 91 23 __ STA (SP + 0),y
+1b2a : a4 02 __ LDY $02
+1b2c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1b2f : b1 19 __ LDA (IP + 0),y
+1b31 : aa __ __ TAX
+1b32 : c8 __ __ INY
+1b33 : b1 19 __ LDA (IP + 0),y
+1b35 : 84 02 __ STY $02
+1b37 : a8 __ __ TAY
+1b38 : b5 00 __ LDA $00,x
+1b3a : 91 23 __ STA (SP + 0),y
+1b3c : c8 __ __ INY
+1b3d : b5 01 __ LDA $01,x
+1b3f : 91 23 __ STA (SP + 0),y
+1b41 : c8 __ __ INY
+1b42 : b5 02 __ LDA $02,x
+1b44 : 91 23 __ STA (SP + 0),y
+1b46 : c8 __ __ INY
+1b47 : b5 03 __ LDA $03,x
+1b49 : 91 23 __ STA (SP + 0),y
+1b4b : a4 02 __ LDY $02
+1b4d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1b50 : b1 19 __ LDA (IP + 0),y
+1b52 : 85 1f __ STA ADDR + 0
+1b54 : c8 __ __ INY
+1b55 : b1 19 __ LDA (IP + 0),y
+1b57 : 85 20 __ STA ADDR + 1
+1b59 : c8 __ __ INY
+1b5a : b1 19 __ LDA (IP + 0),y
+1b5c : aa __ __ TAX
+1b5d : 84 02 __ STY $02
+1b5f : a0 00 __ LDY #$00
+1b61 : b1 1f __ LDA (ADDR + 0),y
+1b63 : 95 00 __ STA $00,x
+1b65 : a4 02 __ LDY $02
+1b67 : 4c 50 08 JMP $0850 ; (startup + 79)
+1b6a : b1 19 __ LDA (IP + 0),y
+1b6c : aa __ __ TAX
+1b6d : c8 __ __ INY
+1b6e : b1 19 __ LDA (IP + 0),y
+1b70 : 84 02 __ STY $02
+1b72 : a8 __ __ TAY
+1b73 : 4c 61 1b JMP $1b61 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1b76 : b1 19 __ LDA (IP + 0),y
+1b78 : 85 1f __ STA ADDR + 0
+1b7a : c8 __ __ INY
+1b7b : b1 19 __ LDA (IP + 0),y
+1b7d : 85 20 __ STA ADDR + 1
+1b7f : c8 __ __ INY
+1b80 : b1 19 __ LDA (IP + 0),y
+1b82 : aa __ __ TAX
+1b83 : 84 02 __ STY $02
+1b85 : a0 00 __ LDY #$00
+1b87 : b1 1f __ LDA (ADDR + 0),y
+1b89 : 95 00 __ STA $00,x
+1b8b : a9 00 __ LDA #$00
+1b8d : 95 01 __ STA $01,x
+1b8f : a4 02 __ LDY $02
+1b91 : 4c 50 08 JMP $0850 ; (startup + 79)
+1b94 : b1 19 __ LDA (IP + 0),y
+1b96 : aa __ __ TAX
+1b97 : c8 __ __ INY
+1b98 : b1 19 __ LDA (IP + 0),y
+1b9a : 84 02 __ STY $02
+1b9c : a8 __ __ TAY
+1b9d : 4c 87 1b JMP $1b87 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1ba0 : b1 19 __ LDA (IP + 0),y
+1ba2 : 85 1f __ STA ADDR + 0
+1ba4 : c8 __ __ INY
+1ba5 : b1 19 __ LDA (IP + 0),y
+1ba7 : 85 20 __ STA ADDR + 1
+1ba9 : c8 __ __ INY
+1baa : b1 19 __ LDA (IP + 0),y
+1bac : aa __ __ TAX
+1bad : 84 02 __ STY $02
+1baf : a0 00 __ LDY #$00
+1bb1 : b1 1f __ LDA (ADDR + 0),y
+1bb3 : 95 00 __ STA $00,x
+1bb5 : c8 __ __ INY
+1bb6 : b1 1f __ LDA (ADDR + 0),y
+1bb8 : 95 01 __ STA $01,x
+1bba : a4 02 __ LDY $02
+1bbc : 4c 50 08 JMP $0850 ; (startup + 79)
+1bbf : b1 19 __ LDA (IP + 0),y
+1bc1 : aa __ __ TAX
+1bc2 : c8 __ __ INY
+1bc3 : b1 19 __ LDA (IP + 0),y
+1bc5 : 84 02 __ STY $02
+1bc7 : a8 __ __ TAY
+1bc8 : 4c b1 1b JMP $1bb1 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1bcb : b1 19 __ LDA (IP + 0),y
+1bcd : 85 1f __ STA ADDR + 0
+1bcf : c8 __ __ INY
+1bd0 : b1 19 __ LDA (IP + 0),y
+1bd2 : 85 20 __ STA ADDR + 1
+1bd4 : c8 __ __ INY
+1bd5 : b1 19 __ LDA (IP + 0),y
+1bd7 : aa __ __ TAX
+1bd8 : 84 02 __ STY $02
+1bda : a0 00 __ LDY #$00
+1bdc : b5 00 __ LDA $00,x
+1bde : 91 1f __ STA (ADDR + 0),y
+1be0 : a4 02 __ LDY $02
+1be2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1be5 : b1 19 __ LDA (IP + 0),y
+1be7 : aa __ __ TAX
+1be8 : c8 __ __ INY
+1be9 : b1 19 __ LDA (IP + 0),y
+1beb : 84 02 __ STY $02
+1bed : a8 __ __ TAY
+1bee : 4c dc 1b JMP $1bdc ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1bf1 : b1 19 __ LDA (IP + 0),y
+1bf3 : aa __ __ TAX
+1bf4 : 18 __ __ CLC
+1bf5 : a5 1b __ LDA ACCU + 0
+1bf7 : 75 00 __ ADC $00,x
+1bf9 : 85 1b __ STA ACCU + 0
+1bfb : a5 1c __ LDA ACCU + 1
+1bfd : 75 01 __ ADC $01,x
+1bff : 85 1c __ STA ACCU + 1
+1c01 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1c04 : b1 19 __ LDA (IP + 0),y
+1c06 : aa __ __ TAX
+1c07 : 38 __ __ SEC
+1c08 : a5 1b __ LDA ACCU + 0
+1c0a : f5 00 __ SBC $00,x
+1c0c : 85 1b __ STA ACCU + 0
+1c0e : a5 1c __ LDA ACCU + 1
+1c10 : f5 01 __ SBC $01,x
+1c12 : 85 1c __ STA ACCU + 1
+1c14 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1c17 : b1 19 __ LDA (IP + 0),y
+1c19 : aa __ __ TAX
+1c1a : b5 00 __ LDA $00,x
+1c1c : 85 03 __ STA $03
+1c1e : b5 01 __ LDA $01,x
+1c20 : 85 04 __ STA $04
+1c22 : 20 59 17 JSR $1759 ; (divmod + 0)
+1c25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1c28 : b1 19 __ LDA (IP + 0),y
+1c2a : aa __ __ TAX
+1c2b : b5 00 __ LDA $00,x
+1c2d : 85 03 __ STA $03
+1c2f : b5 01 __ LDA $01,x
+1c31 : 85 04 __ STA $04
+1c33 : 20 59 17 JSR $1759 ; (divmod + 0)
+1c36 : a5 05 __ LDA $05
+1c38 : 85 1b __ STA ACCU + 0
+1c3a : a5 06 __ LDA $06
+1c3c : 85 1c __ STA ACCU + 1
+1c3e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1c41 : b1 19 __ LDA (IP + 0),y
+1c43 : aa __ __ TAX
+1c44 : b5 00 __ LDA $00,x
+1c46 : 85 03 __ STA $03
+1c48 : b5 01 __ LDA $01,x
+1c4a : 85 04 __ STA $04
+1c4c : 24 1c __ BIT ACCU + 1
+1c4e : 10 10 __ BPL $1c60
+1c50 : 20 3d 17 JSR $173d ; (negaccu + 0)
+1c53 : 24 04 __ BIT $04
+1c55 : 10 10 __ BPL $1c67
+1c57 : 20 4b 17 JSR $174b ; (negtmp + 0)
+1c5a : 20 59 17 JSR $1759 ; (divmod + 0)
+1c5d : 4c 50 08 JMP $0850 ; (startup + 79)
+1c60 : 24 04 __ BIT $04
+1c62 : 10 f6 __ BPL $1c5a
+1c64 : 20 4b 17 JSR $174b ; (negtmp + 0)
+1c67 : 20 59 17 JSR $1759 ; (divmod + 0)
+1c6a : 20 3d 17 JSR $173d ; (negaccu + 0)
+1c6d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1c70 : b1 19 __ LDA (IP + 0),y
+1c72 : aa __ __ TAX
+1c73 : b5 00 __ LDA $00,x
+1c75 : 85 03 __ STA $03
+1c77 : b5 01 __ LDA $01,x
+1c79 : 85 04 __ STA $04
+1c7b : 24 1c __ BIT ACCU + 1
+1c7d : 10 18 __ BPL $1c97
+1c7f : 20 3d 17 JSR $173d ; (negaccu + 0)
+1c82 : 24 04 __ BIT $04
+1c84 : 10 18 __ BPL $1c9e
+1c86 : 20 4b 17 JSR $174b ; (negtmp + 0)
+1c89 : 20 59 17 JSR $1759 ; (divmod + 0)
+1c8c : a5 05 __ LDA $05
+1c8e : 85 1b __ STA ACCU + 0
+1c90 : a5 06 __ LDA $06
+1c92 : 85 1c __ STA ACCU + 1
+1c94 : 4c 50 08 JMP $0850 ; (startup + 79)
+1c97 : 24 04 __ BIT $04
+1c99 : 10 ee __ BPL $1c89
+1c9b : 20 4b 17 JSR $174b ; (negtmp + 0)
+1c9e : 20 59 17 JSR $1759 ; (divmod + 0)
+1ca1 : a5 05 __ LDA $05
+1ca3 : 85 1b __ STA ACCU + 0
+1ca5 : a5 06 __ LDA $06
+1ca7 : 85 1c __ STA ACCU + 1
+1ca9 : 20 3d 17 JSR $173d ; (negaccu + 0)
+1cac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1caf : b1 19 __ LDA (IP + 0),y
+1cb1 : aa __ __ TAX
+1cb2 : 18 __ __ CLC
+1cb3 : b5 00 __ LDA $00,x
+1cb5 : 65 1b __ ADC ACCU + 0
+1cb7 : 95 00 __ STA $00,x
+1cb9 : b5 01 __ LDA $01,x
+1cbb : 65 1c __ ADC ACCU + 1
+1cbd : 95 01 __ STA $01,x
+1cbf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1cc2 : b1 19 __ LDA (IP + 0),y
+1cc4 : c8 __ __ INY
+1cc5 : aa __ __ TAX
+1cc6 : 18 __ __ CLC
+1cc7 : b5 00 __ LDA $00,x
+1cc9 : 71 19 __ ADC (IP + 0),y
+1ccb : c8 __ __ INY
+1ccc : 95 00 __ STA $00,x
+1cce : b5 01 __ LDA $01,x
+1cd0 : 71 19 __ ADC (IP + 0),y
+1cd2 : 95 01 __ STA $01,x
+1cd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1cd7 : b1 19 __ LDA (IP + 0),y
+1cd9 : c8 __ __ INY
+1cda : aa __ __ TAX
+1cdb : 38 __ __ SEC
+1cdc : b1 19 __ LDA (IP + 0),y
+1cde : c8 __ __ INY
+1cdf : f5 00 __ SBC $00,x
+1ce1 : 95 00 __ STA $00,x
+1ce3 : b1 19 __ LDA (IP + 0),y
+1ce5 : f5 01 __ SBC $01,x
+1ce7 : 95 01 __ STA $01,x
+1ce9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1cec : b1 19 __ LDA (IP + 0),y
+1cee : c8 __ __ INY
+1cef : aa __ __ TAX
+1cf0 : b5 00 __ LDA $00,x
+1cf2 : 31 19 __ AND (IP + 0),y
+1cf4 : c8 __ __ INY
+1cf5 : 95 00 __ STA $00,x
+1cf7 : b5 01 __ LDA $01,x
+1cf9 : 31 19 __ AND (IP + 0),y
+1cfb : 95 01 __ STA $01,x
+1cfd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1d00 : b1 19 __ LDA (IP + 0),y
+1d02 : c8 __ __ INY
+1d03 : aa __ __ TAX
+1d04 : a9 00 __ LDA #$00
+1d06 : 85 05 __ STA $05
+1d08 : 85 06 __ STA $06
+1d0a : b5 00 __ LDA $00,x
+1d0c : 85 03 __ STA $03
+1d0e : b5 01 __ LDA $01,x
+1d10 : 85 04 __ STA $04
+1d12 : b1 19 __ LDA (IP + 0),y
+1d14 : 4a __ __ LSR
+1d15 : 85 07 __ STA $07
+1d17 : 90 0d __ BCC $1d26
+1d19 : 18 __ __ CLC
+1d1a : a5 05 __ LDA $05
+1d1c : 65 03 __ ADC $03
+1d1e : 85 05 __ STA $05
+1d20 : a5 06 __ LDA $06
+1d22 : 65 04 __ ADC $04
+1d24 : 85 06 __ STA $06
+1d26 : 06 03 __ ASL $03
+1d28 : 26 04 __ ROL $04
+1d2a : 46 07 __ LSR $07
+1d2c : b0 eb __ BCS $1d19
+1d2e : d0 f6 __ BNE $1d26
+1d30 : a5 05 __ LDA $05
+1d32 : 95 00 __ STA $00,x
+1d34 : a5 06 __ LDA $06
+1d36 : 95 01 __ STA $01,x
+1d38 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1d3b : b1 19 __ LDA (IP + 0),y
+1d3d : c8 __ __ INY
+1d3e : aa __ __ TAX
+1d3f : 18 __ __ CLC
+1d40 : b5 00 __ LDA $00,x
+1d42 : 71 19 __ ADC (IP + 0),y
+1d44 : 95 00 __ STA $00,x
+1d46 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1d49 : b1 19 __ LDA (IP + 0),y
+1d4b : aa __ __ TAX
+1d4c : 38 __ __ SEC
+1d4d : b5 01 __ LDA $01,x
+1d4f : e5 1c __ SBC ACCU + 1
+1d51 : f0 11 __ BEQ $1d64
+1d53 : 50 02 __ BVC $1d57
+1d55 : 49 80 __ EOR #$80
+1d57 : 30 2a __ BMI $1d83
+1d59 : 10 33 __ BPL $1d8e
+1d5b : b1 19 __ LDA (IP + 0),y
+1d5d : aa __ __ TAX
+1d5e : b5 01 __ LDA $01,x
+1d60 : c5 1c __ CMP ACCU + 1
+1d62 : d0 28 __ BNE $1d8c
+1d64 : b5 00 __ LDA $00,x
+1d66 : c5 1b __ CMP ACCU + 0
+1d68 : d0 22 __ BNE $1d8c
+1d6a : f0 0e __ BEQ $1d7a
+1d6c : b1 19 __ LDA (IP + 0),y
+1d6e : aa __ __ TAX
+1d6f : c8 __ __ INY
+1d70 : b1 19 __ LDA (IP + 0),y
+1d72 : c5 1c __ CMP ACCU + 1
+1d74 : d0 16 __ BNE $1d8c
+1d76 : e4 1b __ CPX ACCU + 0
+1d78 : d0 12 __ BNE $1d8c
+1d7a : a9 00 __ LDA #$00
+1d7c : 85 1b __ STA ACCU + 0
+1d7e : 85 1c __ STA ACCU + 1
+1d80 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d83 : a9 ff __ LDA #$ff
+1d85 : 85 1b __ STA ACCU + 0
+1d87 : 85 1c __ STA ACCU + 1
+1d89 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d8c : 90 f5 __ BCC $1d83
+1d8e : a9 01 __ LDA #$01
+1d90 : 85 1b __ STA ACCU + 0
+1d92 : a9 00 __ LDA #$00
+1d94 : 85 1c __ STA ACCU + 1
+1d96 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d99 : b1 19 __ LDA (IP + 0),y
+1d9b : c8 __ __ INY
+1d9c : aa __ __ TAX
+1d9d : b1 19 __ LDA (IP + 0),y
+1d9f : 38 __ __ SEC
+1da0 : e5 1c __ SBC ACCU + 1
+1da2 : d0 af __ BNE $1d53
+1da4 : e4 1b __ CPX ACCU + 0
+1da6 : d0 e4 __ BNE $1d8c
+1da8 : f0 d0 __ BEQ $1d7a
+1daa : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1dab : b1 19 __ LDA (IP + 0),y
+1dad : aa __ __ TAX
+1dae : 38 __ __ SEC
+1daf : b5 00 __ LDA $00,x
+1db1 : e5 1b __ SBC ACCU + 0
+1db3 : f0 19 __ BEQ $1dce
+1db5 : 50 02 __ BVC $1db9
+1db7 : 49 80 __ EOR #$80
+1db9 : 30 1c __ BMI $1dd7
+1dbb : 10 25 __ BPL $1de2
+1dbd : b1 19 __ LDA (IP + 0),y
+1dbf : aa __ __ TAX
+1dc0 : b5 00 __ LDA $00,x
+1dc2 : c5 1b __ CMP ACCU + 0
+1dc4 : d0 1a __ BNE $1de0
+1dc6 : f0 06 __ BEQ $1dce
+1dc8 : b1 19 __ LDA (IP + 0),y
+1dca : c5 1b __ CMP ACCU + 0
+1dcc : d0 12 __ BNE $1de0
+1dce : a9 00 __ LDA #$00
+1dd0 : 85 1b __ STA ACCU + 0
+1dd2 : 85 1c __ STA ACCU + 1
+1dd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+1dd7 : a9 ff __ LDA #$ff
+1dd9 : 85 1b __ STA ACCU + 0
+1ddb : 85 1c __ STA ACCU + 1
+1ddd : 4c 50 08 JMP $0850 ; (startup + 79)
+1de0 : 90 f5 __ BCC $1dd7
+1de2 : a9 01 __ LDA #$01
+1de4 : 85 1b __ STA ACCU + 0
+1de6 : a9 00 __ LDA #$00
+1de8 : 85 1c __ STA ACCU + 1
+1dea : 4c 50 08 JMP $0850 ; (startup + 79)
+1ded : b1 19 __ LDA (IP + 0),y
+1def : 38 __ __ SEC
+1df0 : e5 1b __ SBC ACCU + 0
+1df2 : d0 c1 __ BNE $1db5
+1df4 : f0 d8 __ BEQ $1dce
+1df6 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1df7 : 38 __ __ SEC
+1df8 : a9 00 __ LDA #$00
+1dfa : e5 1b __ SBC ACCU + 0
+1dfc : 85 1b __ STA ACCU + 0
+1dfe : a9 00 __ LDA #$00
+1e00 : e5 1c __ SBC ACCU + 1
+1e02 : 85 1c __ STA ACCU + 1
+1e04 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1e07 : 20 14 15 JSR $1514 ; (freg + 0)
+1e0a : 20 59 15 JSR $1559 ; (faddsub + 0)
+1e0d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1e10 : 20 14 15 JSR $1514 ; (freg + 0)
+1e13 : a5 06 __ LDA $06
+1e15 : 49 80 __ EOR #$80
+1e17 : 85 06 __ STA $06
+1e19 : 20 59 15 JSR $1559 ; (faddsub + 0)
+1e1c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1e1f : 20 14 15 JSR $1514 ; (freg + 0)
+1e22 : 84 02 __ STY $02
+1e24 : 20 21 16 JSR $1621 ; (fmul + 0)
+1e27 : a4 02 __ LDY $02
+1e29 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1e2c : 20 14 15 JSR $1514 ; (freg + 0)
+1e2f : 20 bf 16 JSR $16bf ; (fdiv + 0)
+1e32 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1e35 : b1 19 __ LDA (IP + 0),y
+1e37 : c8 __ __ INY
+1e38 : aa __ __ TAX
+1e39 : a5 1e __ LDA ACCU + 3
+1e3b : 55 03 __ EOR $03,x
+1e3d : 29 80 __ AND #$80
+1e3f : f0 1e __ BEQ $1e5f
+1e41 : a5 1e __ LDA ACCU + 3
+1e43 : 29 7f __ AND #$7f
+1e45 : 05 1d __ ORA ACCU + 2
+1e47 : 05 1c __ ORA ACCU + 1
+1e49 : 05 1b __ ORA ACCU + 0
+1e4b : d0 0c __ BNE $1e59
+1e4d : b5 03 __ LDA $03,x
+1e4f : 29 7f __ AND #$7f
+1e51 : 15 02 __ ORA $02,x
+1e53 : 15 01 __ ORA $01,x
+1e55 : 15 00 __ ORA $00,x
+1e57 : f0 1e __ BEQ $1e77
+1e59 : a5 1e __ LDA ACCU + 3
+1e5b : 30 29 __ BMI $1e86
+1e5d : 10 36 __ BPL $1e95
+1e5f : a5 1e __ LDA ACCU + 3
+1e61 : d5 03 __ CMP $03,x
+1e63 : d0 1b __ BNE $1e80
+1e65 : a5 1d __ LDA ACCU + 2
+1e67 : d5 02 __ CMP $02,x
+1e69 : d0 15 __ BNE $1e80
+1e6b : a5 1c __ LDA ACCU + 1
+1e6d : d5 01 __ CMP $01,x
+1e6f : d0 0f __ BNE $1e80
+1e71 : a5 1b __ LDA ACCU + 0
+1e73 : d5 00 __ CMP $00,x
+1e75 : d0 09 __ BNE $1e80
+1e77 : a9 00 __ LDA #$00
+1e79 : 85 1b __ STA ACCU + 0
+1e7b : 85 1c __ STA ACCU + 1
+1e7d : 4c 51 08 JMP $0851 ; (startup + 80)
+1e80 : b0 0f __ BCS $1e91
+1e82 : 24 1e __ BIT ACCU + 3
+1e84 : 30 0f __ BMI $1e95
+1e86 : a9 00 __ LDA #$00
+1e88 : 85 1c __ STA ACCU + 1
+1e8a : a9 01 __ LDA #$01
+1e8c : 85 1b __ STA ACCU + 0
+1e8e : 4c 51 08 JMP $0851 ; (startup + 80)
+1e91 : 24 1e __ BIT ACCU + 3
+1e93 : 30 f1 __ BMI $1e86
+1e95 : a9 ff __ LDA #$ff
+1e97 : 85 1b __ STA ACCU + 0
+1e99 : 85 1c __ STA ACCU + 1
+1e9b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+1e9e : a5 1e __ LDA ACCU + 3
+1ea0 : 49 80 __ EOR #$80
+1ea2 : 85 1e __ STA ACCU + 3
+1ea4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_abs_f32:
+1ea7 : a5 1e __ LDA ACCU + 3
+1ea9 : 29 7f __ AND #$7f
+1eab : 85 1e __ STA ACCU + 3
+1ead : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+1eb0 : 20 20 18 JSR $1820 ; (sint16_to_float + 0)
+1eb3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+1eb6 : 20 de 17 JSR $17de ; (f32_to_i16 + 0)
+1eb9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+1ebc : b1 19 __ LDA (IP + 0),y
+1ebe : 30 0c __ BMI $1ecc
+1ec0 : 38 __ __ SEC
+1ec1 : 65 19 __ ADC IP + 0
+1ec3 : 85 19 __ STA IP + 0
+1ec5 : 90 02 __ BCC $1ec9
+1ec7 : e6 1a __ INC IP + 1
+1ec9 : 4c 51 08 JMP $0851 ; (startup + 80)
+1ecc : 38 __ __ SEC
+1ecd : 65 19 __ ADC IP + 0
+1ecf : 85 19 __ STA IP + 0
+1ed1 : b0 02 __ BCS $1ed5
+1ed3 : c6 1a __ DEC IP + 1
+1ed5 : 4c 51 08 JMP $0851 ; (startup + 80)
+1ed8 : a5 1b __ LDA ACCU + 0
+1eda : 05 1c __ ORA ACCU + 1
+1edc : f0 de __ BEQ $1ebc
+1ede : 4c 50 08 JMP $0850 ; (startup + 79)
+1ee1 : a5 1b __ LDA ACCU + 0
+1ee3 : 05 1c __ ORA ACCU + 1
+1ee5 : d0 d5 __ BNE $1ebc
+1ee7 : 4c 50 08 JMP $0850 ; (startup + 79)
+1eea : a5 1c __ LDA ACCU + 1
+1eec : 30 04 __ BMI $1ef2
+1eee : 05 1b __ ORA ACCU + 0
+1ef0 : d0 ca __ BNE $1ebc
+1ef2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ef5 : a5 1c __ LDA ACCU + 1
+1ef7 : 10 c3 __ BPL $1ebc
+1ef9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1efc : a5 1c __ LDA ACCU + 1
+1efe : 30 bc __ BMI $1ebc
+1f00 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f03 : a5 1c __ LDA ACCU + 1
+1f05 : 30 b5 __ BMI $1ebc
+1f07 : 05 1b __ ORA ACCU + 0
+1f09 : f0 b1 __ BEQ $1ebc
+1f0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1f0e : 38 __ __ SEC
+1f0f : b1 19 __ LDA (IP + 0),y
+1f11 : 65 19 __ ADC IP + 0
+1f13 : aa __ __ TAX
+1f14 : c8 __ __ INY
+1f15 : b1 19 __ LDA (IP + 0),y
+1f17 : 65 1a __ ADC IP + 1
+1f19 : 85 1a __ STA IP + 1
+1f1b : 86 19 __ STX IP + 0
+1f1d : 4c 51 08 JMP $0851 ; (startup + 80)
+1f20 : a5 1b __ LDA ACCU + 0
+1f22 : 05 1c __ ORA ACCU + 1
+1f24 : f0 e8 __ BEQ $1f0e
+1f26 : c8 __ __ INY
+1f27 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f2a : a5 1b __ LDA ACCU + 0
+1f2c : 05 1c __ ORA ACCU + 1
+1f2e : d0 de __ BNE $1f0e
+1f30 : c8 __ __ INY
+1f31 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f34 : a5 1c __ LDA ACCU + 1
+1f36 : 30 04 __ BMI $1f3c
+1f38 : 05 1b __ ORA ACCU + 0
+1f3a : d0 d2 __ BNE $1f0e
+1f3c : c8 __ __ INY
+1f3d : 4c 50 08 JMP $0850 ; (startup + 79)
+1f40 : a5 1c __ LDA ACCU + 1
+1f42 : 10 ca __ BPL $1f0e
+1f44 : c8 __ __ INY
+1f45 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f48 : a5 1c __ LDA ACCU + 1
+1f4a : 30 c2 __ BMI $1f0e
+1f4c : c8 __ __ INY
+1f4d : 4c 50 08 JMP $0850 ; (startup + 79)
+1f50 : a5 1c __ LDA ACCU + 1
+1f52 : 30 ba __ BMI $1f0e
+1f54 : 05 1b __ ORA ACCU + 0
+1f56 : f0 b6 __ BEQ $1f0e
+1f58 : c8 __ __ INY
+1f59 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+1f5c : a9 00 __ LDA #$00
+1f5e : 2c a9 01 BIT $01a9 
+1f61 : 85 1b __ STA ACCU + 0
+1f63 : a9 00 __ LDA #$00
+1f65 : 85 1c __ STA ACCU + 1
+1f67 : 4c 51 08 JMP $0851 ; (startup + 80)
+1f6a : a5 1b __ LDA ACCU + 0
+1f6c : 05 1c __ ORA ACCU + 1
+1f6e : f0 ef __ BEQ $1f5f
+1f70 : d0 ea __ BNE $1f5c
+1f72 : a5 1b __ LDA ACCU + 0
+1f74 : 05 1c __ ORA ACCU + 1
+1f76 : d0 e7 __ BNE $1f5f
+1f78 : f0 e2 __ BEQ $1f5c
+1f7a : a5 1c __ LDA ACCU + 1
+1f7c : 30 de __ BMI $1f5c
+1f7e : 05 1b __ ORA ACCU + 0
+1f80 : d0 dd __ BNE $1f5f
+1f82 : f0 d8 __ BEQ $1f5c
+1f84 : a5 1c __ LDA ACCU + 1
+1f86 : 10 d7 __ BPL $1f5f
+1f88 : 30 d2 __ BMI $1f5c
+1f8a : a5 1c __ LDA ACCU + 1
+1f8c : 30 d1 __ BMI $1f5f
+1f8e : 10 cc __ BPL $1f5c
+1f90 : a5 1c __ LDA ACCU + 1
+1f92 : 30 cb __ BMI $1f5f
+1f94 : 05 1b __ ORA ACCU + 0
+1f96 : f0 c7 __ BEQ $1f5f
+1f98 : d0 c2 __ BNE $1f5c
+1f9a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+1f9b : b1 19 __ LDA (IP + 0),y
+1f9d : 8d b1 1f STA $1fb1 ; (inp_jsr + 22)
+1fa0 : c8 __ __ INY
+1fa1 : b1 19 __ LDA (IP + 0),y
+1fa3 : 8d b2 1f STA $1fb2 ; (inp_jsr + 23)
+1fa6 : 98 __ __ TYA
+1fa7 : 38 __ __ SEC
+1fa8 : 65 19 __ ADC IP + 0
+1faa : 85 19 __ STA IP + 0
+1fac : 90 02 __ BCC $1fb0
+1fae : e6 1a __ INC IP + 1
+1fb0 : 20 00 00 JSR $0000 
+1fb3 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+1fb6 : 98 __ __ TYA
+1fb7 : 18 __ __ CLC
+1fb8 : 65 19 __ ADC IP + 0
+1fba : 8d c5 1f STA $1fc5 ; (inp_native + 15)
+1fbd : a5 1a __ LDA IP + 1
+1fbf : 69 00 __ ADC #$00
+1fc1 : 8d c6 1f STA $1fc6 ; (inp_native + 16)
+1fc4 : 20 00 00 JSR $0000 
+1fc7 : a0 00 __ LDY #$00
+1fc9 : b1 23 __ LDA (SP + 0),y
+1fcb : 85 19 __ STA IP + 0
+1fcd : c8 __ __ INY
+1fce : b1 23 __ LDA (SP + 0),y
+1fd0 : 85 1a __ STA IP + 1
+1fd2 : 88 __ __ DEY
+1fd3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+1fd6 : 38 __ __ SEC
+1fd7 : a5 23 __ LDA SP + 0
+1fd9 : f1 19 __ SBC (IP + 0),y
+1fdb : c8 __ __ INY
+1fdc : 85 23 __ STA SP + 0
+1fde : a5 24 __ LDA SP + 1
+1fe0 : f1 19 __ SBC (IP + 0),y
+1fe2 : c8 __ __ INY
+1fe3 : 85 24 __ STA SP + 1
+1fe5 : b1 19 __ LDA (IP + 0),y
+1fe7 : 84 02 __ STY $02
+1fe9 : a8 __ __ TAY
+1fea : a5 25 __ LDA FP + 0
+1fec : 91 23 __ STA (SP + 0),y
+1fee : c8 __ __ INY
+1fef : a5 26 __ LDA FP + 1
+1ff1 : 91 23 __ STA (SP + 0),y
+1ff3 : 98 __ __ TYA
+1ff4 : 38 __ __ SEC
+1ff5 : 65 23 __ ADC SP + 0
+1ff7 : 85 25 __ STA FP + 0
+1ff9 : a9 00 __ LDA #$00
+1ffb : 65 24 __ ADC SP + 1
+1ffd : 85 26 __ STA FP + 1
+1fff : 88 __ __ DEY
+2000 : f0 08 __ BEQ $200a
+2002 : b9 52 00 LDA $0052,y 
+2005 : 88 __ __ DEY
+2006 : 91 23 __ STA (SP + 0),y
+2008 : d0 f8 __ BNE $2002
+200a : a4 02 __ LDY $02
+200c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+200f : b1 19 __ LDA (IP + 0),y
+2011 : c8 __ __ INY
+2012 : 84 02 __ STY $02
+2014 : a8 __ __ TAY
+2015 : b1 23 __ LDA (SP + 0),y
+2017 : 85 25 __ STA FP + 0
+2019 : c8 __ __ INY
+201a : b1 23 __ LDA (SP + 0),y
+201c : 85 26 __ STA FP + 1
+201e : 88 __ __ DEY
+201f : f0 09 __ BEQ $202a
+2021 : 88 __ __ DEY
+2022 : b1 23 __ LDA (SP + 0),y
+2024 : 99 53 00 STA $0053,y 
+2027 : 88 __ __ DEY
+2028 : 10 f8 __ BPL $2022
+202a : a4 02 __ LDY $02
+202c : 18 __ __ CLC
+202d : b1 19 __ LDA (IP + 0),y
+202f : c8 __ __ INY
+2030 : 65 23 __ ADC SP + 0
+2032 : 85 23 __ STA SP + 0
+2034 : b1 19 __ LDA (IP + 0),y
+2036 : c8 __ __ INY
+2037 : 65 24 __ ADC SP + 1
+2039 : 85 24 __ STA SP + 1
+203b : a0 01 __ LDY #$01
+203d : b1 23 __ LDA (SP + 0),y
+203f : 85 1a __ STA IP + 1
+2041 : 88 __ __ DEY
+2042 : b1 23 __ LDA (SP + 0),y
+2044 : 85 19 __ STA IP + 0
+2046 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+2049 : b1 19 __ LDA (IP + 0),y
+204b : 85 1f __ STA ADDR + 0
+204d : c8 __ __ INY
+204e : b1 19 __ LDA (IP + 0),y
+2050 : 85 20 __ STA ADDR + 1
+2052 : c8 __ __ INY
+2053 : 98 __ __ TYA
+2054 : a0 00 __ LDY #$00
+2056 : 18 __ __ CLC
+2057 : 65 19 __ ADC IP + 0
+2059 : 91 23 __ STA (SP + 0),y
+205b : c8 __ __ INY
+205c : a5 1a __ LDA IP + 1
+205e : 69 00 __ ADC #$00
+2060 : 91 23 __ STA (SP + 0),y
+2062 : a5 1f __ LDA ADDR + 0
+2064 : 85 19 __ STA IP + 0
+2066 : a5 20 __ LDA ADDR + 1
+2068 : 85 1a __ STA IP + 1
+206a : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+206d : 38 __ __ SEC
+206e : a5 23 __ LDA SP + 0
+2070 : f1 19 __ SBC (IP + 0),y
+2072 : c8 __ __ INY
+2073 : 85 23 __ STA SP + 0
+2075 : a5 24 __ LDA SP + 1
+2077 : f1 19 __ SBC (IP + 0),y
+2079 : 85 24 __ STA SP + 1
+207b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+207e : 18 __ __ CLC
+207f : b1 19 __ LDA (IP + 0),y
+2081 : c8 __ __ INY
+2082 : 65 23 __ ADC SP + 0
+2084 : 85 23 __ STA SP + 0
+2086 : b1 19 __ LDA (IP + 0),y
+2088 : 65 24 __ ADC SP + 1
+208a : 85 24 __ STA SP + 1
+208c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+208f : b1 19 __ LDA (IP + 0),y
+2091 : c8 __ __ INY
+2092 : 8d a0 20 STA $20a0 ; (inp_op_extrt + 17)
+2095 : b1 19 __ LDA (IP + 0),y
+2097 : c8 __ __ INY
+2098 : 8d a1 20 STA $20a1 ; (inp_op_extrt + 18)
+209b : b1 19 __ LDA (IP + 0),y
+209d : c8 __ __ INY
+209e : aa __ __ TAX
+209f : 20 00 00 JSR $0000 
+20a2 : 4c 51 08 JMP $0851 ; (startup + 80)
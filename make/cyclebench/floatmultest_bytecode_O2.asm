@@ -0,0 +1,3022 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e c7 21 STX $21c7 ; (spentry + 0)
+0811 : a9 d1 __ LDA #$d1
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 d1 __ LDA #$d1
+0832 : e9 d1 __ SBC #$d1
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	LEA	T2, $15d1
+0a14:	MOV	2(SP), T2
+0a17:	MOV	4(SP), T1
+0a1a:	MOVD	T3, c + 0
+0a1e:	MOV	ACCU, T1
+0a20:	CNVSF	ACCU
+0a21:	MULF	ACCU, T3
+0a23:	MOVD	T3, ACCU
+0a25:	MOVD	6(SP), T3
+0a28:	MOVD	10(SP), T0
+0a2b:	SUBF	ACCU, T0
+0a2d:	MOVD	14(SP), ACCU
+0a30:	CALL	printf + 0
+0a33:	MOVD	T3, c + 0
+0a37:	MOV	ACCU, T1
+0a39:	CNVSF	ACCU
+0a3a:	MULF	ACCU, T3
+0a3c:	MOVD	T3, ACCU
+0a3e:	MOVD	ACCU, T0
+0a40:	CMPF	ACCU, T3
+0a42:	SEQ
+0a43:	MOVB	2(SP), ACCU
+0a46:	CALL	assert + 0
+0a49:	MOVD	ACCU, c + 0
+0a4d:	ADDF	ACCU, T0
+0a4f:	MOVD	T0, ACCU
+0a51:	ADD	T1, #$0001
+0a55:	MOV	ACCU, T1
+0a57:	CMPS	ACCU, #$0032
+0a5a:	BGT	$0A14
+0a5c:	MOVD	T0, d + 0
+0a60:	MOV	T1, #1
+0a63:	LEA	T2, $1617
+0a67:	MOV	2(SP), T2
+0a6a:	MOV	4(SP), T1
+0a6d:	MOVD	T3, d + 0
+0a71:	MOV	ACCU, T1
+0a73:	CNVSF	ACCU
+0a74:	MOVD	T4, ACCU
+0a76:	MULF	ACCU, T3
+0a78:	MOVD	T3, ACCU
+0a7a:	MOVD	6(SP), T3
+0a7d:	MOVD	10(SP), T0
+0a80:	SUBF	ACCU, T0
+0a82:	ABSF	ACCU
+0a83:	DIVF	ACCU, T4
+0a85:	MOVD	14(SP), ACCU
+0a88:	CALL	printf + 0
+0a8b:	MOVD	T3, d + 0
+0a8f:	MOV	ACCU, T1
+0a91:	CNVSF	ACCU
+0a92:	MOVD	T4, ACCU
+0a94:	MULF	ACCU, T3
+0a96:	SUBF	ACCU, T0
+0a98:	ABSF	ACCU
+0a99:	MOVD	T3, ACCU
+0a9b:	MOVD	ACCU, T4
+0a9d:	MOVD	$03, #$358637bd
+0aa3:	MULF	ACCU, $03
+0aa5:	CMPF	ACCU, T3
+0aa7:	SLT
+0aa8:	MOVB	2(SP), ACCU
+0aab:	CALL	assert + 0
+0aae:	MOVD	ACCU, d + 0
+0ab2:	ADDF	ACCU, T0
+0ab4:	MOVD	T0, ACCU
+0ab6:	ADD	T1, #$0001
+0aba:	MOV	ACCU, T1
+0abc:	CMPS	ACCU, #$0032
+0abf:	BGT	$0A67
+0ac1:	MOV	ACCU, #0
+0ac4:	POP	#$0012
+0ac7:	RETURN	8, 10
+--------------------------------------------------------------------
+printf:
+0acb:	ENTER	13, 73
+0acf:	PUSH	#$0002
+0ad2:	LEA	T0, 0(FP)
+0ad6:	MOVB	T1, #0
+0ad9:	MOV	T2, 60(FP)
+0adc:	MOV	ADDR, T2
+0ade:	MOVB	T3, 0(ADDR)
+0ae1:	MOVB	ACCU, T3
+0ae3:	BNE	$0B01
+0ae5:	MOVB	ACCU, T1
+0ae7:	LEAX	ADDR, T0 + ACCU
+0ae9:	MOV	ACCU, #0
+0aec:	MOVB	0(ADDR), ACCU
+0aef:	MOVB	ACCU, T1
+0af1:	BEQ	$0AFA
+0af3:	MOV	ACCU, T0
+0af5:	MOV	P0, ACCU
+0af7:	CALL	puts + 0
+0afa:	POP	#$0002
+0afd:	RETURN	13, 73
+0b01:	LEA	T4, 62(FP)
+0b05:	ADD	T2, #$0001
+0b09:	MOVB	ACCU, T3
+0b0b:	CMPUB	ACCU, #$0025
+0b0d:	BEQ	$0B4F
+0b0f:	MOVB	ACCU, T1
+0b11:	LEAX	ADDR, T0 + ACCU
+0b13:	MOVB	0(ADDR), T3
+0b16:	ADDB	T1, #$0001
+0b19:	MOVB	ACCU, T1
+0b1b:	CMPUB	ACCU, #$0028
+0b1d:	BLE	$0B2A
+0b1f:	MOV	ADDR, T2
+0b21:	MOVB	T5, 0(ADDR)
+0b24:	ADD	T2, #$0001
+0b28:	JUMP	$0B47
+0b2a:	MOVB	ACCU, T1
+0b2c:	LEAX	ADDR, T0 + ACCU
+0b2e:	MOV	ACCU, #0
+0b31:	MOVB	0(ADDR), ACCU
+0b34:	MOV	ACCU, T0
+0b36:	MOV	P0, ACCU
+0b38:	CALL	puts + 0
+0b3b:	MOVB	T1, #0
+0b3e:	MOV	ADDR, T2
+0b40:	MOVB	T5, 0(ADDR)
+0b43:	ADD	T2, #$0001
+0b47:	MOVB	ACCU, T5
+0b49:	MOVB	T3, ACCU
+0b4b:	BNE	$0B09
+0b4d:	JUMP	$0AE5
+0b4f:	MOVB	ACCU, T1
+0b51:	BEQ	$0B67
+0b53:	MOVB	ACCU, T1
+0b55:	LEAX	ADDR, T0 + ACCU
+0b57:	MOV	ACCU, #0
+0b5a:	MOVB	0(ADDR), ACCU
+0b5d:	MOV	ACCU, T0
+0b5f:	MOV	P0, ACCU
+0b61:	CALL	puts + 0
+0b64:	MOVB	T1, #0
+0b67:	MOV	ADDR, T2
+0b69:	MOVB	T3, 0(ADDR)
+0b6c:	MOV	ACCU, #10
+0b6f:	MOV	53(FP), ACCU
+0b72:	MOV	ACCU, #1
+0b75:	MOVB	51(FP), ACCU
+0b78:	MOV	ACCU, #255
+0b7b:	MOVB	52(FP), ACCU
+0b7e:	MOV	ACCU, #32
+0b81:	MOVB	50(FP), ACCU
+0b84:	MOV	ACCU, #0
+0b87:	MOVB	55(FP), ACCU
+0b8a:	MOVB	56(FP), ACCU
+0b8d:	MOVB	57(FP), ACCU
+0b90:	ADD	T2, #$0001
+0b94:	MOVB	ACCU, T3
+0b96:	CMPUB	ACCU, #$002B
+0b98:	BEQF	$10C8
+0b9b:	MOVB	ACCU, T3
+0b9d:	CMPUB	ACCU, #$0030
+0b9f:	BEQF	$10BA
+0ba2:	MOVB	ACCU, T3
+0ba4:	CMPUB	ACCU, #$0023
+0ba6:	BEQF	$10AC
+0ba9:	MOVB	ACCU, T3
+0bab:	CMPUB	ACCU, #$0030
+0bad:	BGT	$0BB6
+0baf:	MOVB	ACCU, T3
+0bb1:	CMPUB	ACCU, #$0039
+0bb3:	BGEF	$107B
+0bb6:	MOVB	ACCU, T3
+0bb8:	CMPUB	ACCU, #$002E
+0bba:	BEQF	$1041
+0bbd:	MOVB	ACCU, T3
+0bbf:	CMPUB	ACCU, #$0064
+0bc1:	BEQF	$0F0C
+0bc4:	MOVB	ACCU, T3
+0bc6:	CMPUB	ACCU, #$0075
+0bc8:	BEQF	$0E0E
+0bcb:	MOVB	ACCU, T3
+0bcd:	CMPUB	ACCU, #$0078
+0bcf:	BEQF	$0CFE
+0bd2:	MOVB	ACCU, T3
+0bd4:	CMPUB	ACCU, #$006C
+0bd6:	BEQF	$0C73
+0bd9:	MOVB	ACCU, T3
+0bdb:	CMPUB	ACCU, #$0066
+0bdd:	BEQ	$0C49
+0bdf:	MOVB	ACCU, T3
+0be1:	CMPUB	ACCU, #$0067
+0be3:	BEQ	$0C49
+0be5:	MOVB	ACCU, T3
+0be7:	CMPUB	ACCU, #$0065
+0be9:	BEQ	$0C49
+0beb:	MOVB	ACCU, T3
+0bed:	CMPUB	ACCU, #$0073
+0bef:	BEQ	$0C31
+0bf1:	MOVB	ACCU, T3
+0bf3:	CMPUB	ACCU, #$0063
+0bf5:	BEQ	$0C12
+0bf7:	MOVB	ACCU, T3
+0bf9:	BEQF	$0B1F
+0bfc:	MOVB	ACCU, T1
+0bfe:	LEAX	ADDR, T0 + ACCU
+0c00:	MOVB	0(ADDR), T3
+0c03:	ADDB	T1, #$0001
+0c06:	MOV	ADDR, T2
+0c08:	MOVB	T5, 0(ADDR)
+0c0b:	ADD	T2, #$0001
+0c0f:	JUMPF	$0B47
+0c12:	MOVB	ACCU, T1
+0c14:	MOV	ADDR, T4
+0c16:	MOV	T7, 0(ADDR)
+0c19:	LEAX	ADDR, T0 + ACCU
+0c1b:	MOVB	0(ADDR), T7
+0c1e:	ADD	T4, #$0002
+0c22:	ADDB	T1, #$0001
+0c25:	MOV	ADDR, T2
+0c27:	MOVB	T5, 0(ADDR)
+0c2a:	ADD	T2, #$0001
+0c2e:	JUMPF	$0B47
+0c31:	MOV	ADDR, T4
+0c33:	MOV	P0, 0(ADDR)
+0c36:	CALL	puts + 0
+0c39:	ADD	T4, #$0002
+0c3d:	MOV	ADDR, T2
+0c3f:	MOVB	T5, 0(ADDR)
+0c42:	ADD	T2, #$0001
+0c46:	JUMPF	$0B47
+0c49:	LEA	P0, 50(FP)
+0c4d:	MOV	ACCU, T0
+0c4f:	MOV	P2, ACCU
+0c51:	MOV	ADDR, T4
+0c53:	MOVD	T13, 0(ADDR)
+0c56:	MOVD	ACCU, T13
+0c58:	MOVD	P4, ACCU
+0c5a:	MOVB	ACCU, T3
+0c5c:	MOVB	P8, ACCU
+0c5e:	CALL	nformf + 0
+0c61:	MOV	T1, ACCU
+0c63:	ADD	T4, #$0004
+0c67:	MOV	ADDR, T2
+0c69:	MOVB	T5, 0(ADDR)
+0c6c:	ADD	T2, #$0001
+0c70:	JUMPF	$0B47
+0c73:	MOV	ADDR, T4
+0c75:	MOVD	T13, 0(ADDR)
+0c78:	ADD	T4, #$0004
+0c7c:	MOV	ADDR, T2
+0c7e:	MOVB	T3, 0(ADDR)
+0c81:	ADD	T2, #$0001
+0c85:	MOVB	ACCU, T3
+0c87:	CMPUB	ACCU, #$0064
+0c89:	BEQ	$0CDE
+0c8b:	MOVB	ACCU, T3
+0c8d:	CMPUB	ACCU, #$0075
+0c8f:	BEQ	$0CBE
+0c91:	MOVB	ACCU, T3
+0c93:	CMPUB	ACCU, #$0078
+0c95:	BNEF	$0B1F
+0c98:	MOV	ACCU, #16
+0c9b:	MOV	53(FP), ACCU
+0c9e:	LEA	P0, 50(FP)
+0ca2:	MOV	ACCU, T0
+0ca4:	MOV	P2, ACCU
+0ca6:	MOVD	ACCU, T13
+0ca8:	MOVD	P4, ACCU
+0caa:	MOVB	P8, #0
+0cad:	CALL	nforml + 0
+0cb0:	MOV	T1, ACCU
+0cb2:	MOV	ADDR, T2
+0cb4:	MOVB	T5, 0(ADDR)
+0cb7:	ADD	T2, #$0001
+0cbb:	JUMPF	$0B47
+0cbe:	LEA	P0, 50(FP)
+0cc2:	MOV	ACCU, T0
+0cc4:	MOV	P2, ACCU
+0cc6:	MOVD	ACCU, T13
+0cc8:	MOVD	P4, ACCU
+0cca:	MOVB	P8, #0
+0ccd:	CALL	nforml + 0
+0cd0:	MOV	T1, ACCU
+0cd2:	MOV	ADDR, T2
+0cd4:	MOVB	T5, 0(ADDR)
+0cd7:	ADD	T2, #$0001
+0cdb:	JUMPF	$0B47
+0cde:	LEA	P0, 50(FP)
+0ce2:	MOV	ACCU, T0
+0ce4:	MOV	P2, ACCU
+0ce6:	MOVD	ACCU, T13
+0ce8:	MOVD	P4, ACCU
+0cea:	MOVB	P8, #1
+0ced:	CALL	nforml + 0
+0cf0:	MOV	T1, ACCU
+0cf2:	MOV	ADDR, T2
+0cf4:	MOVB	T5, 0(ADDR)
+0cf7:	ADD	T2, #$0001
+0cfb:	JUMPF	$0B47
+0cfe:	MOV	ACCU, #16
+0d01:	MOV	53(FP), ACCU
+0d04:	MOV	ADDR, T4
+0d06:	MOV	T6, 0(ADDR)
+0d09:	ADD	T4, #$0002
+0d0d:	LEA	T7, 0(FP)
+0d11:	MOVB	T1, #10
+0d14:	MOV	ACCU, T6
+0d16:	BNEF	$0DDD
+0d19:	MOVB	T3, 52(FP)
+0d1c:	MOVB	ACCU, T3
+0d1e:	CMPUB	ACCU, #$00FF
+0d20:	BNEF	$0DCD
+0d23:	MOVB	T3, #9
+0d26:	MOVB	ACCU, T1
+0d28:	CMPUB	ACCU, #$0009
+0d2a:	BGE	$0D3F
+0d2c:	ADDB	T1, #$00FF
+0d2f:	MOVB	ACCU, T1
+0d31:	LEAX	ADDR, T7 + ACCU
+0d33:	MOV	ACCU, #48
+0d36:	MOVB	0(ADDR), ACCU
+0d39:	MOVB	ACCU, T3
+0d3b:	CMPUB	ACCU, T1
+0d3d:	BGT	$0D2C
+0d3f:	MOVUB	ACCU, 57(FP)
+0d42:	BEQ	$0D68
+0d44:	MOV	ACCU, 53(FP)
+0d47:	CMPU	ACCU, #$0010
+0d4a:	BNE	$0D68
+0d4c:	MOVB	ACCU, T1
+0d4e:	ADDB	ACCU, #$00FF
+0d51:	MOVB	ACCU, ACCU
+0d53:	LEAX	ADDR, T7 + ACCU
+0d55:	MOV	ACCU, #88
+0d58:	MOVB	0(ADDR), ACCU
+0d5b:	ADDB	T1, #$00FE
+0d5e:	MOVB	ACCU, T1
+0d60:	LEAX	ADDR, T7 + ACCU
+0d62:	MOV	ACCU, #48
+0d65:	MOVB	0(ADDR), ACCU
+0d68:	MOVUB	ACCU, 55(FP)
+0d6b:	BEQ	$0D7A
+0d6d:	ADDB	T1, #$00FF
+0d70:	MOVB	ACCU, T1
+0d72:	LEAX	ADDR, T7 + ACCU
+0d74:	MOV	ACCU, #43
+0d77:	MOVB	0(ADDR), ACCU
+0d7a:	MOVUB	T6, 51(FP)
+0d7d:	SUBR	T6, #$000A
+0d81:	MOVB	T3, 50(FP)
+0d84:	MOVB	ACCU, T1
+0d86:	MOV	T8, ACCU
+0d88:	MOV	ACCU, T6
+0d8a:	CMPS	ACCU, T8
+0d8c:	BGT	$0DC1
+0d8e:	MOVB	T3, #0
+0d91:	MOVB	ACCU, T1
+0d93:	CMPUB	ACCU, #$000A
+0d95:	BLE	$0DB1
+0d97:	MOVB	ACCU, T1
+0d99:	LEAX	ADDR, T7 + ACCU
+0d9b:	MOVB	T5, 0(ADDR)
+0d9e:	MOVB	ACCU, T3
+0da0:	LEAX	ADDR, T7 + ACCU
+0da2:	MOVB	0(ADDR), T5
+0da5:	ADDB	T3, #$0001
+0da8:	ADDB	T1, #$0001
+0dab:	MOVB	ACCU, T1
+0dad:	CMPUB	ACCU, #$000A
+0daf:	BGT	$0D97
+0db1:	MOV	ADDR, T2
+0db3:	MOVB	T5, 0(ADDR)
+0db6:	ADD	T2, #$0001
+0dba:	MOVB	ACCU, T3
+0dbc:	MOV	T1, ACCU
+0dbe:	JUMPF	$0B47
+0dc1:	ADDB	T1, #$00FF
+0dc4:	MOVB	ACCU, T1
+0dc6:	LEAX	ADDR, T7 + ACCU
+0dc8:	MOVB	0(ADDR), T3
+0dcb:	JUMP	$0D84
+0dcd:	MOVB	ACCU, T3
+0dcf:	SUBR	ACCU, #$000A
+0dd3:	MOV	T3, ACCU
+0dd5:	CMPUB	ACCU, T1
+0dd7:	BGTF	$0D2C
+0dda:	JUMPF	$0D3F
+0ddd:	MOV	T8, 53(FP)
+0de0:	MOV	ACCU, T8
+0de2:	MOV	T9, ACCU
+0de4:	MOV	ACCU, T6
+0de6:	MODU	ACCU, T9
+0de8:	MOV	T10, ACCU
+0dea:	CMPS	ACCU, #$000A
+0ded:	BLE	$0DF5
+0def:	ADD	T10, #$0030
+0df3:	JUMP	$0DF9
+0df5:	ADD	T10, #$0037
+0df9:	ADDB	T1, #$00FF
+0dfc:	MOVB	ACCU, T1
+0dfe:	LEAX	ADDR, T7 + ACCU
+0e00:	MOVB	0(ADDR), T10
+0e03:	MOV	ACCU, T6
+0e05:	DIVU	ACCU, T8
+0e07:	MOV	T6, ACCU
+0e09:	BNE	$0DE4
+0e0b:	JUMPF	$0D19
+0e0e:	MOV	ADDR, T4
+0e10:	MOV	T6, 0(ADDR)
+0e13:	ADD	T4, #$0002
+0e17:	LEA	T7, 0(FP)
+0e1b:	MOVB	T1, #10
+0e1e:	MOV	ACCU, T6
+0e20:	BNEF	$0EDB
+0e23:	MOVB	T3, 52(FP)
+0e26:	MOVB	ACCU, T3
+0e28:	CMPUB	ACCU, #$00FF
+0e2a:	BNEF	$0ECB
+0e2d:	MOVB	T3, #9
+0e30:	MOVB	ACCU, T1
+0e32:	CMPUB	ACCU, #$0009
+0e34:	BGE	$0E49
+0e36:	ADDB	T1, #$00FF
+0e39:	MOVB	ACCU, T1
+0e3b:	LEAX	ADDR, T7 + ACCU
+0e3d:	MOV	ACCU, #48
+0e40:	MOVB	0(ADDR), ACCU
+0e43:	MOVB	ACCU, T3
+0e45:	CMPUB	ACCU, T1
+0e47:	BGT	$0E36
+0e49:	MOVUB	ACCU, 57(FP)
+0e4c:	BEQ	$0E72
+0e4e:	MOV	ACCU, 53(FP)
+0e51:	CMPU	ACCU, #$0010
+0e54:	BNE	$0E72
+0e56:	MOVB	ACCU, T1
+0e58:	ADDB	ACCU, #$00FF
+0e5b:	MOVB	ACCU, ACCU
+0e5d:	LEAX	ADDR, T7 + ACCU
+0e5f:	MOV	ACCU, #88
+0e62:	MOVB	0(ADDR), ACCU
+0e65:	ADDB	T1, #$00FE
+0e68:	MOVB	ACCU, T1
+0e6a:	LEAX	ADDR, T7 + ACCU
+0e6c:	MOV	ACCU, #48
+0e6f:	MOVB	0(ADDR), ACCU
+0e72:	MOVUB	ACCU, 55(FP)
+0e75:	BEQ	$0E84
+0e77:	ADDB	T1, #$00FF
+0e7a:	MOVB	ACCU, T1
+0e7c:	LEAX	ADDR, T7 + ACCU
+0e7e:	MOV	ACCU, #43
+0e81:	MOVB	0(ADDR), ACCU
+0e84:	MOVUB	T6, 51(FP)
+0e87:	SUBR	T6, #$000A
+0e8b:	MOVB	T3, 50(FP)
+0e8e:	MOVB	ACCU, T1
+0e90:	MOV	T8, ACCU
+0e92:	MOV	ACCU, T6
+0e94:	CMPS	ACCU, T8
+0e96:	BGT	$0EBF
+0e98:	MOVB	T3, #0
+0e9b:	MOVB	ACCU, T1
+0e9d:	CMPUB	ACCU, #$000A
+0e9f:	BLEF	$0DB1
+0ea2:	MOVB	ACCU, T1
+0ea4:	LEAX	ADDR, T7 + ACCU
+0ea6:	MOVB	T5, 0(ADDR)
+0ea9:	MOVB	ACCU, T3
+0eab:	LEAX	ADDR, T7 + ACCU
+0ead:	MOVB	0(ADDR), T5
+0eb0:	ADDB	T3, #$0001
+0eb3:	ADDB	T1, #$0001
+0eb6:	MOVB	ACCU, T1
+0eb8:	CMPUB	ACCU, #$000A
+0eba:	BGT	$0EA2
+0ebc:	JUMPF	$0DB1
+0ebf:	ADDB	T1, #$00FF
+0ec2:	MOVB	ACCU, T1
+0ec4:	LEAX	ADDR, T7 + ACCU
+0ec6:	MOVB	0(ADDR), T3
+0ec9:	JUMP	$0E8E
+0ecb:	MOVB	ACCU, T3
+0ecd:	SUBR	ACCU, #$000A
+0ed1:	MOV	T3, ACCU
+0ed3:	CMPUB	ACCU, T1
+0ed5:	BGTF	$0E36
+0ed8:	JUMPF	$0E49
+0edb:	MOV	T8, 53(FP)
+0ede:	MOV	ACCU, T8
+0ee0:	MOV	T9, ACCU
+0ee2:	MOV	ACCU, T6
+0ee4:	MODU	ACCU, T9
+0ee6:	MOV	T10, ACCU
+0ee8:	CMPS	ACCU, #$000A
+0eeb:	BLE	$0EF3
+0eed:	ADD	T10, #$0030
+0ef1:	JUMP	$0EF7
+0ef3:	ADD	T10, #$0037
+0ef7:	ADDB	T1, #$00FF
+0efa:	MOVB	ACCU, T1
+0efc:	LEAX	ADDR, T7 + ACCU
+0efe:	MOVB	0(ADDR), T10
+0f01:	MOV	ACCU, T6
+0f03:	DIVU	ACCU, T8
+0f05:	MOV	T6, ACCU
+0f07:	BNE	$0EE2
+0f09:	JUMPF	$0E23
+0f0c:	MOV	ADDR, T4
+0f0e:	MOV	T6, 0(ADDR)
+0f11:	ADD	T4, #$0002
+0f15:	LEA	T7, 0(FP)
+0f19:	MOV	ACCU, T6
+0f1b:	BLTF	$1033
+0f1e:	MOV	T8, ACCU
+0f20:	MOVB	T1, #0
+0f23:	MOVB	T3, #10
+0f26:	MOV	ACCU, T6
+0f28:	BNEF	$1002
+0f2b:	MOVB	T5, 52(FP)
+0f2e:	MOVB	ACCU, T5
+0f30:	CMPUB	ACCU, #$00FF
+0f32:	BNEF	$0FF2
+0f35:	MOVB	T5, #9
+0f38:	MOVB	ACCU, T3
+0f3a:	CMPUB	ACCU, #$0009
+0f3c:	BGE	$0F51
+0f3e:	ADDB	T3, #$00FF
+0f41:	MOVB	ACCU, T3
+0f43:	LEAX	ADDR, T7 + ACCU
+0f45:	MOV	ACCU, #48
+0f48:	MOVB	0(ADDR), ACCU
+0f4b:	MOVB	ACCU, T5
+0f4d:	CMPUB	ACCU, T3
+0f4f:	BGT	$0F3E
+0f51:	MOVUB	ACCU, 57(FP)
+0f54:	BEQ	$0F7A
+0f56:	MOV	ACCU, 53(FP)
+0f59:	CMPU	ACCU, #$0010
+0f5c:	BNE	$0F7A
+0f5e:	MOVB	ACCU, T3
+0f60:	ADDB	ACCU, #$00FF
+0f63:	MOVB	ACCU, ACCU
+0f65:	LEAX	ADDR, T7 + ACCU
+0f67:	MOV	ACCU, #88
+0f6a:	MOVB	0(ADDR), ACCU
+0f6d:	ADDB	T3, #$00FE
+0f70:	MOVB	ACCU, T3
+0f72:	LEAX	ADDR, T7 + ACCU
+0f74:	MOV	ACCU, #48
+0f77:	MOVB	0(ADDR), ACCU
+0f7a:	MOVB	ACCU, T1
+0f7c:	BNE	$0FE3
+0f7e:	MOVUB	ACCU, 55(FP)
+0f81:	BEQ	$0F90
+0f83:	ADDB	T3, #$00FF
+0f86:	MOVB	ACCU, T3
+0f88:	LEAX	ADDR, T7 + ACCU
+0f8a:	MOV	ACCU, #43
+0f8d:	MOVB	0(ADDR), ACCU
+0f90:	MOVUB	T6, 51(FP)
+0f93:	SUBR	T6, #$000A
+0f97:	MOVB	T1, 50(FP)
+0f9a:	MOVB	ACCU, T3
+0f9c:	MOV	T8, ACCU
+0f9e:	MOV	ACCU, T6
+0fa0:	CMPS	ACCU, T8
+0fa2:	BGT	$0FD7
+0fa4:	MOVB	T1, #0
+0fa7:	MOVB	ACCU, T3
+0fa9:	CMPUB	ACCU, #$000A
+0fab:	BLE	$0FC7
+0fad:	MOVB	ACCU, T3
+0faf:	LEAX	ADDR, T7 + ACCU
+0fb1:	MOVB	T5, 0(ADDR)
+0fb4:	MOVB	ACCU, T1
+0fb6:	LEAX	ADDR, T7 + ACCU
+0fb8:	MOVB	0(ADDR), T5
+0fbb:	ADDB	T1, #$0001
+0fbe:	ADDB	T3, #$0001
+0fc1:	MOVB	ACCU, T3
+0fc3:	CMPUB	ACCU, #$000A
+0fc5:	BGT	$0FAD
+0fc7:	MOV	ADDR, T2
+0fc9:	MOVB	T5, 0(ADDR)
+0fcc:	ADD	T2, #$0001
+0fd0:	AND	T1, #$00FF
+0fd4:	JUMPF	$0B47
+0fd7:	ADDB	T3, #$00FF
+0fda:	MOVB	ACCU, T3
+0fdc:	LEAX	ADDR, T7 + ACCU
+0fde:	MOVB	0(ADDR), T1
+0fe1:	JUMP	$0F9A
+0fe3:	ADDB	T3, #$00FF
+0fe6:	MOVB	ACCU, T3
+0fe8:	LEAX	ADDR, T7 + ACCU
+0fea:	MOV	ACCU, #45
+0fed:	MOVB	0(ADDR), ACCU
+0ff0:	JUMP	$0F90
+0ff2:	MOVB	ACCU, T5
+0ff4:	SUBR	ACCU, #$000A
+0ff8:	MOV	T5, ACCU
+0ffa:	CMPUB	ACCU, T3
+0ffc:	BGTF	$0F3E
+0fff:	JUMPF	$0F51
+1002:	MOV	T6, 53(FP)
+1005:	MOV	ACCU, T6
+1007:	MOV	T9, ACCU
+1009:	MOV	ACCU, T8
+100b:	MODU	ACCU, T9
+100d:	MOV	T10, ACCU
+100f:	CMPS	ACCU, #$000A
+1012:	BLE	$101A
+1014:	ADD	T10, #$0030
+1018:	JUMP	$101E
+101a:	ADD	T10, #$0037
+101e:	ADDB	T3, #$00FF
+1021:	MOVB	ACCU, T3
+1023:	LEAX	ADDR, T7 + ACCU
+1025:	MOVB	0(ADDR), T10
+1028:	MOV	ACCU, T8
+102a:	DIVU	ACCU, T6
+102c:	MOV	T8, ACCU
+102e:	BNE	$1009
+1030:	JUMPF	$0F2B
+1033:	MOVB	T1, #1
+1036:	MOVB	T3, #10
+1039:	NEG	ACCU
+103a:	MOV	T8, ACCU
+103c:	BNE	$1002
+103e:	JUMPF	$0F2B
+1041:	MOV	T6, #0
+1044:	MOV	ADDR, T2
+1046:	MOVB	T3, 0(ADDR)
+1049:	ADD	T2, #$0001
+104d:	MOVB	ACCU, T3
+104f:	CMPUB	ACCU, #$0030
+1051:	BGT	$1075
+1053:	MOVB	ACCU, T3
+1055:	CMPUB	ACCU, #$0039
+1057:	BLT	$1075
+1059:	MOVB	ACCU, T3
+105b:	MOV	T7, ACCU
+105d:	MOV	ADDR, T2
+105f:	MOVB	T3, 0(ADDR)
+1062:	ADD	T2, #$0001
+1066:	MUL	T6, #10
+1069:	ADD	T6, ACCU
+106b:	ADD	T6, #$FFD0
+106f:	MOVB	ACCU, T3
+1071:	CMPUB	ACCU, #$0030
+1073:	BLE	$1053
+1075:	MOVB	52(FP), T6
+1078:	JUMPF	$0BBD
+107b:	MOV	T6, #0
+107e:	MOVB	ACCU, T3
+1080:	CMPUB	ACCU, #$0030
+1082:	BGT	$10A6
+1084:	MOVB	ACCU, T3
+1086:	CMPUB	ACCU, #$0039
+1088:	BLT	$10A6
+108a:	MOVB	ACCU, T3
+108c:	MOV	T7, ACCU
+108e:	MOV	ADDR, T2
+1090:	MOVB	T3, 0(ADDR)
+1093:	ADD	T2, #$0001
+1097:	MUL	T6, #10
+109a:	ADD	T6, ACCU
+109c:	ADD	T6, #$FFD0
+10a0:	MOVB	ACCU, T3
+10a2:	CMPUB	ACCU, #$0030
+10a4:	BLE	$1084
+10a6:	MOVB	51(FP), T6
+10a9:	JUMPF	$0BB6
+10ac:	MOV	ACCU, #1
+10af:	MOVB	57(FP), ACCU
+10b2:	MOV	ADDR, T2
+10b4:	MOVB	T3, 0(ADDR)
+10b7:	JUMPF	$0B90
+10ba:	MOV	ACCU, #48
+10bd:	MOVB	50(FP), ACCU
+10c0:	MOV	ADDR, T2
+10c2:	MOVB	T3, 0(ADDR)
+10c5:	JUMPF	$0B90
+10c8:	MOV	ACCU, #1
+10cb:	MOVB	55(FP), ACCU
+10ce:	MOV	ADDR, T2
+10d0:	MOVB	T3, 0(ADDR)
+10d3:	JUMPF	$0B90
+--------------------------------------------------------------------
+puts:
+10d6:	ENTER	0, 2
+10da:	JSR	$10e1
+10dd:	RETURN	0, 2
+--------------------------------------------------------------------
+10e1 : a0 00 __ LDY #$00
+10e3 : b1 0d __ LDA (P0),y
+10e5 : f0 0b __ BEQ $10f2
+10e7 : 20 f3 10 JSR $10f3 ; (putpch + 0)
+10ea : e6 0d __ INC P0
+10ec : d0 f3 __ BNE $10e1
+10ee : e6 0e __ INC P1
+10f0 : d0 ef __ BNE $10e1
+10f2 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+10f3 : ae c8 21 LDX $21c8 ; (giocharmap + 0)
+10f6 : e0 01 __ CPX #$01
+10f8 : 90 22 __ BCC $111c
+10fa : c9 0a __ CMP #$0a
+10fc : d0 02 __ BNE $1100
+10fe : a9 0d __ LDA #$0d
+1100 : e0 02 __ CPX #$02
+1102 : 90 18 __ BCC $111c
+1104 : c9 41 __ CMP #$41
+1106 : 90 14 __ BCC $111c
+1108 : c9 7b __ CMP #$7b
+110a : b0 10 __ BCS $111c
+110c : c9 61 __ CMP #$61
+110e : b0 04 __ BCS $1114
+1110 : c9 5b __ CMP #$5b
+1112 : b0 08 __ BCS $111c
+1114 : 49 20 __ EOR #$20
+1116 : e0 03 __ CPX #$03
+1118 : f0 02 __ BEQ $111c
+111a : 29 df __ AND #$df
+111c : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+111f:	ENTER	5, 7
+1123:	MOVD	ACCU, P4
+1125:	MOVD	T0, ACCU
+1127:	MOVD	T1, ACCU
+1129:	MOV	ACCU, P2
+112b:	MOV	T2, ACCU
+112d:	MOVB	T3, #0
+1130:	MOVB	ACCU, P8
+1132:	BEQ	$1141
+1134:	MOVD	ACCU, #$00000000
+113a:	EXTRT	T0, inp_op_cmp_s32 + 0
+113e:	BLTF	$1286
+1141:	MOVB	T4, #16
+1144:	MOVD	ACCU, #$00000000
+114a:	EXTRT	T0, inp_op_cmp_u32 + 0
+114e:	BGTF	$122E
+1151:	MOV	ADDR, P0
+1153:	MOVB	T5, 2(ADDR)
+1156:	MOVB	ACCU, T5
+1158:	CMPUB	ACCU, #$00FF
+115a:	BNEF	$121E
+115d:	MOVB	T5, #15
+1160:	MOVB	ACCU, T4
+1162:	CMPUB	ACCU, #$000F
+1164:	BGE	$1179
+1166:	ADDB	T4, #$00FF
+1169:	MOVB	ACCU, T4
+116b:	LEAX	ADDR, T2 + ACCU
+116d:	MOV	ACCU, #48
+1170:	MOVB	0(ADDR), ACCU
+1173:	MOVB	ACCU, T5
+1175:	CMPUB	ACCU, T4
+1177:	BGT	$1166
+1179:	MOV	ACCU, P0
+117b:	MOV	T6, ACCU
+117d:	MOV	ADDR, T6
+117f:	MOVUB	ACCU, 7(ADDR)
+1182:	BEQ	$11A8
+1184:	MOV	ACCU, 3(ADDR)
+1187:	CMPU	ACCU, #$0010
+118a:	BNE	$11A8
+118c:	MOVB	ACCU, T4
+118e:	ADDB	ACCU, #$00FF
+1191:	MOVB	ACCU, ACCU
+1193:	LEAX	ADDR, T2 + ACCU
+1195:	MOV	ACCU, #88
+1198:	MOVB	0(ADDR), ACCU
+119b:	ADDB	T4, #$00FE
+119e:	MOVB	ACCU, T4
+11a0:	LEAX	ADDR, T2 + ACCU
+11a2:	MOV	ACCU, #48
+11a5:	MOVB	0(ADDR), ACCU
+11a8:	MOVB	ACCU, T3
+11aa:	BNE	$120F
+11ac:	MOV	ADDR, T6
+11ae:	MOVUB	ACCU, 5(ADDR)
+11b1:	BEQ	$11C0
+11b3:	ADDB	T4, #$00FF
+11b6:	MOVB	ACCU, T4
+11b8:	LEAX	ADDR, T2 + ACCU
+11ba:	MOV	ACCU, #43
+11bd:	MOVB	0(ADDR), ACCU
+11c0:	MOV	ACCU, P0
+11c2:	MOV	T6, ACCU
+11c4:	MOV	ADDR, T6
+11c6:	MOVUB	T7, 1(ADDR)
+11c9:	SUBR	T7, #$0010
+11cd:	MOVB	ACCU, T4
+11cf:	MOV	T8, ACCU
+11d1:	MOV	ACCU, T7
+11d3:	CMPS	ACCU, T8
+11d5:	BGT	$1200
+11d7:	MOVB	T3, #0
+11da:	MOVB	ACCU, T4
+11dc:	CMPUB	ACCU, #$0010
+11de:	BLE	$11FA
+11e0:	MOVB	ACCU, T4
+11e2:	LEAX	ADDR, T2 + ACCU
+11e4:	MOVB	T5, 0(ADDR)
+11e7:	MOVB	ACCU, T3
+11e9:	LEAX	ADDR, T2 + ACCU
+11eb:	MOVB	0(ADDR), T5
+11ee:	ADDB	T3, #$0001
+11f1:	ADDB	T4, #$0001
+11f4:	MOVB	ACCU, T4
+11f6:	CMPUB	ACCU, #$0010
+11f8:	BGT	$11E0
+11fa:	MOVB	ACCU, T3
+11fc:	RETURN	5, 7
+1200:	MOVB	T3, 0(ADDR)
+1203:	ADDB	T4, #$00FF
+1206:	MOVB	ACCU, T4
+1208:	LEAX	ADDR, T2 + ACCU
+120a:	MOVB	0(ADDR), T3
+120d:	JUMP	$11C0
+120f:	ADDB	T4, #$00FF
+1212:	MOVB	ACCU, T4
+1214:	LEAX	ADDR, T2 + ACCU
+1216:	MOV	ACCU, #45
+1219:	MOVB	0(ADDR), ACCU
+121c:	JUMP	$11C0
+121e:	MOVB	ACCU, T5
+1220:	SUBR	ACCU, #$0010
+1224:	MOV	T5, ACCU
+1226:	CMPUB	ACCU, T4
+1228:	BGTF	$1166
+122b:	JUMPF	$1179
+122e:	MOV	ACCU, P0
+1230:	MOV	T6, ACCU
+1232:	MOV	ADDR, T6
+1234:	MOV	ACCU, 3(ADDR)
+1237:	EXTRT	$00, inp_op_ext_u16 + 0
+123b:	MOVD	T0, ACCU
+123d:	MOVD	ACCU, T1
+123f:	EXTRT	T0, inp_binop_mod_u32 + 0
+1243:	MOVD	T0, ACCU
+1245:	CMPS	ACCU, #$000A
+1248:	BLE	$1252
+124a:	MOV	ACCU, T0
+124c:	ADD	ACCU, #$0030
+1250:	JUMP	$1258
+1252:	MOV	ACCU, T0
+1254:	ADD	ACCU, #$0037
+1258:	MOV	T7, ACCU
+125a:	ADDB	T4, #$00FF
+125d:	MOVB	ACCU, T4
+125f:	LEAX	ADDR, T2 + ACCU
+1261:	MOVB	0(ADDR), T7
+1264:	MOV	ADDR, T6
+1266:	MOV	ACCU, 3(ADDR)
+1269:	EXTRT	$00, inp_op_ext_u16 + 0
+126d:	MOVD	T0, ACCU
+126f:	MOVD	ACCU, T1
+1271:	EXTRT	T0, inp_binop_div_u32 + 0
+1275:	MOVD	T1, ACCU
+1277:	MOVD	ACCU, #$00000000
+127d:	EXTRT	T1, inp_op_cmp_u32 + 0
+1281:	BGT	$122E
+1283:	JUMPF	$1151
+1286:	MOVB	T3, #1
+1289:	MOVB	T4, #16
+128c:	MOVD	ACCU, T0
+128e:	EXTRT	$00, negaccu32 + 0
+1292:	MOVD	T1, ACCU
+1294:	MOVD	ACCU, #$00000000
+129a:	EXTRT	T1, inp_op_cmp_u32 + 0
+129e:	BGT	$122E
+12a0:	JUMPF	$1151
+--------------------------------------------------------------------
+nformf:
+12a3:	ENTER	10, 12
+12a7:	MOV	ACCU, P2
+12a9:	MOV	T0, ACCU
+12ab:	MOV	T1, ACCU
+12ad:	MOVD	ACCU, P4
+12af:	MOVD	T2, ACCU
+12b1:	MOVD	ACCU, #$00000000
+12b7:	CMPF	ACCU, T2
+12b9:	BLTF	$15BC
+12bc:	MOVB	T3, #0
+12bf:	MOV	ADDR, P0
+12c1:	MOVUB	ACCU, 5(ADDR)
+12c4:	BEQ	$12D1
+12c6:	MOV	ACCU, #43
+12c9:	MOV	ADDR, T0
+12cb:	MOVB	0(ADDR), ACCU
+12ce:	MOVB	T3, #1
+12d1:	MOV	T0, #0
+12d4:	MOV	ADDR, P0
+12d6:	MOVB	T5, 2(ADDR)
+12d9:	MOVB	ACCU, T5
+12db:	CMPUB	ACCU, #$00FF
+12dd:	BNE	$12E4
+12df:	MOVB	T5, #6
+12e2:	JUMP	$12E8
+12e4:	AND	T5, #$00FF
+12e8:	MOVD	ACCU, P4
+12ea:	MOVD	T2, #$00000000
+12f0:	CMPF	ACCU, T2
+12f2:	BNEF	$1540
+12f5:	MOVB	ACCU, P8
+12f7:	MOVB	T6, ACCU
+12f9:	CMPUB	ACCU, #$0065
+12fb:	SEQ
+12fc:	MOVB	T7, ACCU
+12fe:	MOVB	T8, ACCU
+1300:	MOVB	ACCU, T5
+1302:	MOV	T4, ACCU
+1304:	ADD	T4, #$0001
+1308:	MOVB	ACCU, T6
+130a:	CMPUB	ACCU, #$0067
+130c:	BEQF	$152F
+130f:	MOVB	ACCU, T7
+1311:	BNEF	$14E3
+1314:	MOV	ACCU, T0
+1316:	BGE	$132E
+1318:	MOVD	ACCU, P4
+131a:	MOVD	$03, #$41200000
+1320:	DIVF	ACCU, $03
+1322:	MOVD	T2, ACCU
+1324:	MOVD	P4, ACCU
+1326:	ADD	T0, #$0001
+132a:	MOV	ACCU, T0
+132c:	BLT	$1318
+132e:	MOVD	T2, #$3f000000
+1334:	MOVB	ACCU, T5
+1336:	ADD	ACCU, T0
+1338:	MOV	T4, ACCU
+133a:	ADD	T4, #$0001
+133e:	MOVB	ACCU, T4
+1340:	CMPUB	ACCU, #$0001
+1342:	BLTF	$14C8
+1345:	MOVD	ACCU, P4
+1347:	ADDF	ACCU, T2
+1349:	MOVD	T2, ACCU
+134b:	MOVD	P4, ACCU
+134d:	MOVD	ACCU, #$41200000
+1353:	CMPF	ACCU, T2
+1355:	BLT	$1368
+1357:	MOVD	ACCU, T2
+1359:	MOVD	$03, #$41200000
+135f:	DIVF	ACCU, $03
+1361:	MOVD	T2, ACCU
+1363:	MOVD	P4, ACCU
+1365:	ADDB	T5, #$00FF
+1368:	MOVB	ACCU, T4
+136a:	MOV	T10, ACCU
+136c:	MOVB	ACCU, T5
+136e:	NEG	ACCU
+136f:	ADD	ACCU, T10
+1371:	MOV	T10, ACCU
+1373:	MOVB	T5, ACCU
+1375:	MOVB	ACCU, T4
+1377:	CMPUB	ACCU, #$0014
+1379:	BGE	$137E
+137b:	MOVB	T4, #20
+137e:	MOVB	ACCU, T10
+1380:	BNE	$138F
+1382:	MOVB	ACCU, T3
+1384:	LEAX	ADDR, T1 + ACCU
+1386:	MOV	ACCU, #48
+1389:	MOVB	0(ADDR), ACCU
+138c:	ADDB	T3, #$0001
+138f:	MOVB	T6, #0
+1392:	MOVB	ACCU, T4
+1394:	BNEF	$1481
+1397:	MOVB	ACCU, T8
+1399:	BNE	$1410
+139b:	MOV	ADDR, P0
+139d:	MOVUB	ACCU, 1(ADDR)
+13a0:	CMPUB	ACCU, T3
+13a2:	BLT	$13AA
+13a4:	MOVB	ACCU, T3
+13a6:	RETURN	10, 12
+13aa:	MOVB	ACCU, T3
+13ac:	CMPUB	ACCU, #$0001
+13ae:	BLE	$13DF
+13b0:	MOVB	T5, #0
+13b3:	MOVB	ACCU, T3
+13b5:	MOV	T0, ACCU
+13b7:	MOV	ADDR, P0
+13b9:	MOVUB	ACCU, 1(ADDR)
+13bc:	MOV	T4, ACCU
+13be:	SUB	ACCU, T0
+13c0:	MOV	T10, ACCU
+13c2:	MOVB	ACCU, T5
+13c4:	MOV	T11, ACCU
+13c6:	MOV	ACCU, T10
+13c8:	CMPU	ACCU, T11
+13ca:	BLT	$13D0
+13cc:	MOV	ACCU, T4
+13ce:	JUMP	$13A6
+13d0:	MOV	ACCU, T1
+13d2:	LEAX	ADDR, T11 + ACCU
+13d4:	MOV	ACCU, #32
+13d7:	MOVB	0(ADDR), ACCU
+13da:	ADDB	T5, #$0001
+13dd:	JUMP	$13B7
+13df:	MOVB	T5, #1
+13e2:	MOV	ACCU, P0
+13e4:	MOV	T0, ACCU
+13e6:	MOVB	ACCU, T3
+13e8:	MOV	T4, ACCU
+13ea:	MOVB	ACCU, T5
+13ec:	MOV	T10, ACCU
+13ee:	MOV	ACCU, T4
+13f0:	SUB	ACCU, T10
+13f2:	MOV	ADDR, T0
+13f4:	MOVB	T6, 1(ADDR)
+13f7:	LEAX	ADDR, T1 + ACCU
+13f9:	MOVB	ACCU, T6
+13fb:	MOVB	T6, 0(ADDR)
+13fe:	SUB	ACCU, T10
+1400:	LEAX	ADDR, T1 + ACCU
+1402:	MOVB	0(ADDR), T6
+1405:	ADDB	T5, #$0001
+1408:	MOVB	ACCU, T3
+140a:	CMPUB	ACCU, T5
+140c:	BLE	$13EA
+140e:	JUMP	$13B0
+1410:	MOVB	ACCU, T3
+1412:	LEAX	ADDR, T1 + ACCU
+1414:	MOV	ACCU, #69
+1417:	MOVB	0(ADDR), ACCU
+141a:	MOVB	ACCU, T3
+141c:	ADDB	ACCU, #$0001
+141f:	MOVB	T5, ACCU
+1421:	MOV	ACCU, T0
+1423:	BLT	$1434
+1425:	MOVB	ACCU, T5
+1427:	LEAX	ADDR, T1 + ACCU
+1429:	MOV	ACCU, #43
+142c:	MOVB	0(ADDR), ACCU
+142f:	ADDB	T3, #$0002
+1432:	JUMP	$1446
+1434:	MOVB	ACCU, T5
+1436:	LEAX	ADDR, T1 + ACCU
+1438:	MOV	ACCU, #45
+143b:	MOVB	0(ADDR), ACCU
+143e:	ADDB	T3, #$0002
+1441:	MOV	ACCU, T0
+1443:	NEG	ACCU
+1444:	MOV	T0, ACCU
+1446:	MOVB	ACCU, T3
+1448:	ADD	ACCU, T1
+144a:	MOV	T4, ACCU
+144c:	MOV	ACCU, T0
+144e:	MOV	ADDR, #10
+1451:	DIVS	ACCU, ADDR
+1453:	MOV	ADDR, T4
+1455:	MOV	T10, ACCU
+1457:	ADD	T10, #$0030
+145b:	MOVB	0(ADDR), T10
+145e:	MOVB	ACCU, T3
+1460:	ADDB	ACCU, #$0001
+1463:	MOVB	ACCU, ACCU
+1465:	ADD	ACCU, T1
+1467:	MOV	T4, ACCU
+1469:	MOV	ACCU, T0
+146b:	MOV	ADDR, #10
+146e:	MODS	ACCU, ADDR
+1470:	MOV	ADDR, T4
+1472:	MOV	T0, ACCU
+1474:	ADD	T0, #$0030
+1478:	MOVB	0(ADDR), T0
+147b:	ADDB	T3, #$0002
+147e:	JUMPF	$139B
+1481:	MOVB	ACCU, T5
+1483:	CMPUB	ACCU, T6
+1485:	BNE	$1494
+1487:	MOVB	ACCU, T3
+1489:	LEAX	ADDR, T1 + ACCU
+148b:	MOV	ACCU, #46
+148e:	MOVB	0(ADDR), ACCU
+1491:	ADDB	T3, #$0001
+1494:	MOVD	ACCU, P4
+1496:	MOVD	T2, ACCU
+1498:	CNVFS	ACCU
+1499:	MOV	T10, ACCU
+149b:	CNVSF	ACCU
+149c:	MOVD	T9, ACCU
+149e:	MOVD	ACCU, T2
+14a0:	SUBF	ACCU, T9
+14a2:	MOVD	$03, #$41200000
+14a8:	MULF	ACCU, $03
+14aa:	MOVD	T2, ACCU
+14ac:	MOVD	P4, ACCU
+14ae:	MOVB	ACCU, T3
+14b0:	LEAX	ADDR, T1 + ACCU
+14b2:	ADD	T10, #$0030
+14b6:	MOVB	0(ADDR), T10
+14b9:	ADDB	T3, #$0001
+14bc:	ADDB	T6, #$0001
+14bf:	MOVB	ACCU, T4
+14c1:	CMPUB	ACCU, T6
+14c3:	BLT	$1481
+14c5:	JUMPF	$1397
+14c8:	MOVB	T6, #1
+14cb:	MOVD	ACCU, T2
+14cd:	MOVD	$03, #$41200000
+14d3:	DIVF	ACCU, $03
+14d5:	MOVD	T2, ACCU
+14d7:	ADDB	T6, #$0001
+14da:	MOVB	ACCU, T4
+14dc:	CMPUB	ACCU, T6
+14de:	BLT	$14CB
+14e0:	JUMPF	$1345
+14e3:	MOVD	T2, #$3f000000
+14e9:	MOVB	ACCU, T5
+14eb:	BNE	$1515
+14ed:	MOVD	ACCU, P4
+14ef:	ADDF	ACCU, T2
+14f1:	MOVD	T2, ACCU
+14f3:	MOVD	P4, ACCU
+14f5:	MOVD	ACCU, #$41200000
+14fb:	CMPF	ACCU, T2
+14fd:	BLTF	$1368
+1500:	MOVD	ACCU, T2
+1502:	MOVD	$03, #$41200000
+1508:	DIVF	ACCU, $03
+150a:	MOVD	T2, ACCU
+150c:	MOVD	P4, ACCU
+150e:	ADD	T0, #$0001
+1512:	JUMPF	$1368
+1515:	MOVB	T6, #0
+1518:	MOVD	ACCU, T2
+151a:	MOVD	$03, #$41200000
+1520:	DIVF	ACCU, $03
+1522:	MOVD	T2, ACCU
+1524:	ADDB	T6, #$0001
+1527:	MOVB	ACCU, T5
+1529:	CMPUB	ACCU, T6
+152b:	BLT	$1518
+152d:	JUMP	$14ED
+152f:	MOV	ACCU, T0
+1531:	CMPS	ACCU, #$0003
+1534:	BLT	$153B
+1536:	MOV	ACCU, T0
+1538:	BGEF	$130F
+153b:	MOVB	T8, #1
+153e:	JUMP	$14E3
+1540:	MOVD	ACCU, P4
+1542:	MOVD	T2, #$447a0000
+1548:	CMPF	ACCU, T2
+154a:	BGT	$1568
+154c:	MOVD	ACCU, P4
+154e:	MOVD	$03, #$447a0000
+1554:	DIVF	ACCU, $03
+1556:	MOVD	T2, ACCU
+1558:	MOVD	P4, ACCU
+155a:	ADD	T0, #$0003
+155e:	MOVD	ACCU, #$447a0000
+1564:	CMPF	ACCU, T2
+1566:	BGE	$154C
+1568:	MOVD	ACCU, P4
+156a:	MOVD	T2, #$3f800000
+1570:	CMPF	ACCU, T2
+1572:	BLE	$1590
+1574:	MOVD	ACCU, P4
+1576:	MOVD	$03, #$447a0000
+157c:	MULF	ACCU, $03
+157e:	MOVD	T2, ACCU
+1580:	MOVD	P4, ACCU
+1582:	ADD	T0, #$FFFD
+1586:	MOVD	ACCU, #$3f800000
+158c:	CMPF	ACCU, T2
+158e:	BLT	$1574
+1590:	MOVD	ACCU, P4
+1592:	MOVD	T2, #$41200000
+1598:	CMPF	ACCU, T2
+159a:	BGTF	$12F5
+159d:	MOVD	ACCU, P4
+159f:	MOVD	$03, #$41200000
+15a5:	DIVF	ACCU, $03
+15a7:	MOVD	T2, ACCU
+15a9:	MOVD	P4, ACCU
+15ab:	ADD	T0, #$0001
+15af:	MOVD	ACCU, #$41200000
+15b5:	CMPF	ACCU, T2
+15b7:	BGE	$159D
+15b9:	JUMPF	$12F5
+15bc:	MOV	ADDR, T0
+15be:	MOVD	ACCU, T2
+15c0:	NEGF	ACCU
+15c1:	MOVD	T2, ACCU
+15c3:	MOVD	P4, ACCU
+15c5:	MOV	ACCU, #45
+15c8:	MOVB	0(ADDR), ACCU
+15cb:	MOVB	T3, #1
+15ce:	JUMPF	$12D1
+--------------------------------------------------------------------
+assert:
+15de:	ENTER	0, 2
+15e2:	PUSH	#$0002
+15e5:	MOVUB	ACCU, 2(FP)
+15e8:	BNE	$15F0
+15ea:	MOV	P0, #-1
+15ed:	CALL	exit + 0
+15f0:	POP	#$0002
+15f3:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+15f7:	ENTER	0, 2
+15fb:	JSR	$1602
+15fe:	RETURN	0, 2
+--------------------------------------------------------------------
+1602 : a5 0d __ LDA P0
+1604 : 85 1b __ STA ACCU + 0
+1606 : a5 0e __ LDA P1
+1608 : 85 1c __ STA ACCU + 1
+160a : ae c7 21 LDX $21c7 ; (spentry + 0)
+160d : 9a __ __ TXS
+160e : a9 4c __ LDA #$4c
+1610 : 85 54 __ STA $54
+1612 : a9 00 __ LDA #$00
+1614 : 85 13 __ STA P6
+1616 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1624 : b1 19 __ LDA (IP + 0),y
+1626 : c8 __ __ INY
+1627 : aa __ __ TAX
+1628 : b5 00 __ LDA $00,x
+162a : 85 03 __ STA $03
+162c : b5 01 __ LDA $01,x
+162e : 85 04 __ STA $04
+1630 : b5 02 __ LDA $02,x
+1632 : 85 05 __ STA $05
+1634 : b5 03 __ LDA $03,x
+1636 : 85 06 __ STA $06
+1638 : a5 05 __ LDA $05
+163a : 0a __ __ ASL
+163b : a5 06 __ LDA $06
+163d : 2a __ __ ROL
+163e : 85 08 __ STA $08
+1640 : f0 06 __ BEQ $1648
+1642 : a5 05 __ LDA $05
+1644 : 09 80 __ ORA #$80
+1646 : 85 05 __ STA $05
+1648 : a5 1d __ LDA ACCU + 2
+164a : 0a __ __ ASL
+164b : a5 1e __ LDA ACCU + 3
+164d : 2a __ __ ROL
+164e : 85 07 __ STA $07
+1650 : f0 06 __ BEQ $1658
+1652 : a5 1d __ LDA ACCU + 2
+1654 : 09 80 __ ORA #$80
+1656 : 85 1d __ STA ACCU + 2
+1658 : 60 __ __ RTS
+1659 : 06 1e __ ASL ACCU + 3
+165b : a5 07 __ LDA $07
+165d : 6a __ __ ROR
+165e : 85 1e __ STA ACCU + 3
+1660 : b0 06 __ BCS $1668
+1662 : a5 1d __ LDA ACCU + 2
+1664 : 29 7f __ AND #$7f
+1666 : 85 1d __ STA ACCU + 2
+1668 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1669 : 38 __ __ SEC
+166a : a5 07 __ LDA $07
+166c : e5 08 __ SBC $08
+166e : f0 38 __ BEQ $16a8
+1670 : aa __ __ TAX
+1671 : b0 25 __ BCS $1698
+1673 : e0 e9 __ CPX #$e9
+1675 : b0 0e __ BCS $1685
+1677 : a5 08 __ LDA $08
+1679 : 85 07 __ STA $07
+167b : a9 00 __ LDA #$00
+167d : 85 1b __ STA ACCU + 0
+167f : 85 1c __ STA ACCU + 1
+1681 : 85 1d __ STA ACCU + 2
+1683 : f0 23 __ BEQ $16a8
+1685 : a5 1d __ LDA ACCU + 2
+1687 : 4a __ __ LSR
+1688 : 66 1c __ ROR ACCU + 1
+168a : 66 1b __ ROR ACCU + 0
+168c : e8 __ __ INX
+168d : d0 f8 __ BNE $1687
+168f : 85 1d __ STA ACCU + 2
+1691 : a5 08 __ LDA $08
+1693 : 85 07 __ STA $07
+1695 : 4c a8 16 JMP $16a8 ; (faddsub + 63)
+1698 : e0 18 __ CPX #$18
+169a : b0 33 __ BCS $16cf
+169c : a5 05 __ LDA $05
+169e : 4a __ __ LSR
+169f : 66 04 __ ROR $04
+16a1 : 66 03 __ ROR $03
+16a3 : ca __ __ DEX
+16a4 : d0 f8 __ BNE $169e
+16a6 : 85 05 __ STA $05
+16a8 : a5 1e __ LDA ACCU + 3
+16aa : 29 80 __ AND #$80
+16ac : 85 1e __ STA ACCU + 3
+16ae : 45 06 __ EOR $06
+16b0 : 30 2d __ BMI $16df
+16b2 : 18 __ __ CLC
+16b3 : a5 1b __ LDA ACCU + 0
+16b5 : 65 03 __ ADC $03
+16b7 : 85 1b __ STA ACCU + 0
+16b9 : a5 1c __ LDA ACCU + 1
+16bb : 65 04 __ ADC $04
+16bd : 85 1c __ STA ACCU + 1
+16bf : a5 1d __ LDA ACCU + 2
+16c1 : 65 05 __ ADC $05
+16c3 : 85 1d __ STA ACCU + 2
+16c5 : 90 08 __ BCC $16cf
+16c7 : 66 1d __ ROR ACCU + 2
+16c9 : 66 1c __ ROR ACCU + 1
+16cb : 66 1b __ ROR ACCU + 0
+16cd : e6 07 __ INC $07
+16cf : a5 07 __ LDA $07
+16d1 : 4a __ __ LSR
+16d2 : 05 1e __ ORA ACCU + 3
+16d4 : 85 1e __ STA ACCU + 3
+16d6 : b0 06 __ BCS $16de
+16d8 : a5 1d __ LDA ACCU + 2
+16da : 29 7f __ AND #$7f
+16dc : 85 1d __ STA ACCU + 2
+16de : 60 __ __ RTS
+16df : 38 __ __ SEC
+16e0 : a5 1b __ LDA ACCU + 0
+16e2 : e5 03 __ SBC $03
+16e4 : 85 1b __ STA ACCU + 0
+16e6 : a5 1c __ LDA ACCU + 1
+16e8 : e5 04 __ SBC $04
+16ea : 85 1c __ STA ACCU + 1
+16ec : a5 1d __ LDA ACCU + 2
+16ee : e5 05 __ SBC $05
+16f0 : 85 1d __ STA ACCU + 2
+16f2 : b0 19 __ BCS $170d
+16f4 : 38 __ __ SEC
+16f5 : a9 00 __ LDA #$00
+16f7 : e5 1b __ SBC ACCU + 0
+16f9 : 85 1b __ STA ACCU + 0
+16fb : a9 00 __ LDA #$00
+16fd : e5 1c __ SBC ACCU + 1
+16ff : 85 1c __ STA ACCU + 1
+1701 : a9 00 __ LDA #$00
+1703 : e5 1d __ SBC ACCU + 2
+1705 : 85 1d __ STA ACCU + 2
+1707 : a5 1e __ LDA ACCU + 3
+1709 : 49 80 __ EOR #$80
+170b : 85 1e __ STA ACCU + 3
+170d : a5 1d __ LDA ACCU + 2
+170f : 30 be __ BMI $16cf
+1711 : 05 1c __ ORA ACCU + 1
+1713 : 05 1b __ ORA ACCU + 0
+1715 : f0 0f __ BEQ $1726
+1717 : c6 07 __ DEC $07
+1719 : f0 0b __ BEQ $1726
+171b : 06 1b __ ASL ACCU + 0
+171d : 26 1c __ ROL ACCU + 1
+171f : 26 1d __ ROL ACCU + 2
+1721 : 10 f4 __ BPL $1717
+1723 : 4c cf 16 JMP $16cf ; (faddsub + 102)
+1726 : a9 00 __ LDA #$00
+1728 : 85 1b __ STA ACCU + 0
+172a : 85 1c __ STA ACCU + 1
+172c : 85 1d __ STA ACCU + 2
+172e : 85 1e __ STA ACCU + 3
+1730 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1731 : a5 1b __ LDA ACCU + 0
+1733 : 05 1c __ ORA ACCU + 1
+1735 : 05 1d __ ORA ACCU + 2
+1737 : d0 03 __ BNE $173c
+1739 : 85 1e __ STA ACCU + 3
+173b : 60 __ __ RTS
+173c : a5 03 __ LDA $03
+173e : 05 04 __ ORA $04
+1740 : 05 05 __ ORA $05
+1742 : d0 09 __ BNE $174d
+1744 : 85 1b __ STA ACCU + 0
+1746 : 85 1c __ STA ACCU + 1
+1748 : 85 1d __ STA ACCU + 2
+174a : 85 1e __ STA ACCU + 3
+174c : 60 __ __ RTS
+174d : a9 00 __ LDA #$00
+174f : 85 09 __ STA $09
+1751 : 85 0a __ STA $0a
+1753 : 85 0b __ STA $0b
+1755 : a4 1b __ LDY ACCU + 0
+1757 : a5 03 __ LDA $03
+1759 : d0 06 __ BNE $1761
+175b : a5 04 __ LDA $04
+175d : f0 0a __ BEQ $1769
+175f : d0 05 __ BNE $1766
+1761 : 20 a1 17 JSR $17a1 ; (fmul8 + 0)
+1764 : a5 04 __ LDA $04
+1766 : 20 a1 17 JSR $17a1 ; (fmul8 + 0)
+1769 : a5 05 __ LDA $05
+176b : 20 a1 17 JSR $17a1 ; (fmul8 + 0)
+176e : 38 __ __ SEC
+176f : a5 0b __ LDA $0b
+1771 : 30 06 __ BMI $1779
+1773 : 06 09 __ ASL $09
+1775 : 26 0a __ ROL $0a
+1777 : 2a __ __ ROL
+1778 : 18 __ __ CLC
+1779 : 29 7f __ AND #$7f
+177b : 85 0b __ STA $0b
+177d : a5 1e __ LDA ACCU + 3
+177f : 45 06 __ EOR $06
+1781 : 29 80 __ AND #$80
+1783 : 85 1e __ STA ACCU + 3
+1785 : a5 07 __ LDA $07
+1787 : e9 7e __ SBC #$7e
+1789 : 18 __ __ CLC
+178a : 65 08 __ ADC $08
+178c : 4a __ __ LSR
+178d : 05 1e __ ORA ACCU + 3
+178f : 85 1e __ STA ACCU + 3
+1791 : a9 00 __ LDA #$00
+1793 : 6a __ __ ROR
+1794 : 05 0b __ ORA $0b
+1796 : 85 1d __ STA ACCU + 2
+1798 : a5 0a __ LDA $0a
+179a : 85 1c __ STA ACCU + 1
+179c : a5 09 __ LDA $09
+179e : 85 1b __ STA ACCU + 0
+17a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+17a1 : 38 __ __ SEC
+17a2 : 6a __ __ ROR
+17a3 : 90 1e __ BCC $17c3
+17a5 : aa __ __ TAX
+17a6 : 18 __ __ CLC
+17a7 : 98 __ __ TYA
+17a8 : 65 09 __ ADC $09
+17aa : 85 09 __ STA $09
+17ac : a5 0a __ LDA $0a
+17ae : 65 1c __ ADC ACCU + 1
+17b0 : 85 0a __ STA $0a
+17b2 : a5 0b __ LDA $0b
+17b4 : 65 1d __ ADC ACCU + 2
+17b6 : 6a __ __ ROR
+17b7 : 85 0b __ STA $0b
+17b9 : 8a __ __ TXA
+17ba : 66 0a __ ROR $0a
+17bc : 66 09 __ ROR $09
+17be : 4a __ __ LSR
+17bf : f0 0d __ BEQ $17ce
+17c1 : b0 e2 __ BCS $17a5
+17c3 : 66 0b __ ROR $0b
+17c5 : 66 0a __ ROR $0a
+17c7 : 66 09 __ ROR $09
+17c9 : 4a __ __ LSR
+17ca : 90 f7 __ BCC $17c3
+17cc : d0 d7 __ BNE $17a5
+17ce : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+17cf : a5 1b __ LDA ACCU + 0
+17d1 : 05 1c __ ORA ACCU + 1
+17d3 : 05 1d __ ORA ACCU + 2
+17d5 : d0 03 __ BNE $17da
+17d7 : 85 1e __ STA ACCU + 3
+17d9 : 60 __ __ RTS
+17da : a5 1e __ LDA ACCU + 3
+17dc : 45 06 __ EOR $06
+17de : 29 80 __ AND #$80
+17e0 : 85 1e __ STA ACCU + 3
+17e2 : a9 00 __ LDA #$00
+17e4 : 85 09 __ STA $09
+17e6 : 85 0a __ STA $0a
+17e8 : 85 0b __ STA $0b
+17ea : a2 18 __ LDX #$18
+17ec : a5 1b __ LDA ACCU + 0
+17ee : c5 03 __ CMP $03
+17f0 : a5 1c __ LDA ACCU + 1
+17f2 : e5 04 __ SBC $04
+17f4 : a5 1d __ LDA ACCU + 2
+17f6 : e5 05 __ SBC $05
+17f8 : 90 13 __ BCC $180d
+17fa : a5 1b __ LDA ACCU + 0
+17fc : e5 03 __ SBC $03
+17fe : 85 1b __ STA ACCU + 0
+1800 : a5 1c __ LDA ACCU + 1
+1802 : e5 04 __ SBC $04
+1804 : 85 1c __ STA ACCU + 1
+1806 : a5 1d __ LDA ACCU + 2
+1808 : e5 05 __ SBC $05
+180a : 85 1d __ STA ACCU + 2
+180c : 38 __ __ SEC
+180d : 26 09 __ ROL $09
+180f : 26 0a __ ROL $0a
+1811 : 26 0b __ ROL $0b
+1813 : ca __ __ DEX
+1814 : f0 0a __ BEQ $1820
+1816 : 06 1b __ ASL ACCU + 0
+1818 : 26 1c __ ROL ACCU + 1
+181a : 26 1d __ ROL ACCU + 2
+181c : b0 dc __ BCS $17fa
+181e : 90 cc __ BCC $17ec
+1820 : 38 __ __ SEC
+1821 : a5 0b __ LDA $0b
+1823 : 30 06 __ BMI $182b
+1825 : 06 09 __ ASL $09
+1827 : 26 0a __ ROL $0a
+1829 : 2a __ __ ROL
+182a : 18 __ __ CLC
+182b : 29 7f __ AND #$7f
+182d : 85 0b __ STA $0b
+182f : a5 08 __ LDA $08
+1831 : 49 7f __ EOR #$7f
+1833 : 65 07 __ ADC $07
+1835 : 38 __ __ SEC
+1836 : e9 01 __ SBC #$01
+1838 : 4a __ __ LSR
+1839 : 05 1e __ ORA ACCU + 3
+183b : 85 1e __ STA ACCU + 3
+183d : a9 00 __ LDA #$00
+183f : 6a __ __ ROR
+1840 : 05 0b __ ORA $0b
+1842 : 85 1d __ STA ACCU + 2
+1844 : a5 0a __ LDA $0a
+1846 : 85 1c __ STA ACCU + 1
+1848 : a5 09 __ LDA $09
+184a : 85 1b __ STA ACCU + 0
+184c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+184d : 38 __ __ SEC
+184e : a9 00 __ LDA #$00
+1850 : e5 1b __ SBC ACCU + 0
+1852 : 85 1b __ STA ACCU + 0
+1854 : a9 00 __ LDA #$00
+1856 : e5 1c __ SBC ACCU + 1
+1858 : 85 1c __ STA ACCU + 1
+185a : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+185b : 38 __ __ SEC
+185c : a9 00 __ LDA #$00
+185e : e5 03 __ SBC $03
+1860 : 85 03 __ STA $03
+1862 : a9 00 __ LDA #$00
+1864 : e5 04 __ SBC $04
+1866 : 85 04 __ STA $04
+1868 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1869 : a5 1c __ LDA ACCU + 1
+186b : d0 31 __ BNE $189e
+186d : a5 04 __ LDA $04
+186f : d0 1e __ BNE $188f
+1871 : 85 06 __ STA $06
+1873 : a2 04 __ LDX #$04
+1875 : 06 1b __ ASL ACCU + 0
+1877 : 2a __ __ ROL
+1878 : c5 03 __ CMP $03
+187a : 90 02 __ BCC $187e
+187c : e5 03 __ SBC $03
+187e : 26 1b __ ROL ACCU + 0
+1880 : 2a __ __ ROL
+1881 : c5 03 __ CMP $03
+1883 : 90 02 __ BCC $1887
+1885 : e5 03 __ SBC $03
+1887 : 26 1b __ ROL ACCU + 0
+1889 : ca __ __ DEX
+188a : d0 eb __ BNE $1877
+188c : 85 05 __ STA $05
+188e : 60 __ __ RTS
+188f : a5 1b __ LDA ACCU + 0
+1891 : 85 05 __ STA $05
+1893 : a5 1c __ LDA ACCU + 1
+1895 : 85 06 __ STA $06
+1897 : a9 00 __ LDA #$00
+1899 : 85 1b __ STA ACCU + 0
+189b : 85 1c __ STA ACCU + 1
+189d : 60 __ __ RTS
+189e : a5 04 __ LDA $04
+18a0 : d0 1f __ BNE $18c1
+18a2 : a5 03 __ LDA $03
+18a4 : 30 1b __ BMI $18c1
+18a6 : a9 00 __ LDA #$00
+18a8 : 85 06 __ STA $06
+18aa : a2 10 __ LDX #$10
+18ac : 06 1b __ ASL ACCU + 0
+18ae : 26 1c __ ROL ACCU + 1
+18b0 : 2a __ __ ROL
+18b1 : c5 03 __ CMP $03
+18b3 : 90 02 __ BCC $18b7
+18b5 : e5 03 __ SBC $03
+18b7 : 26 1b __ ROL ACCU + 0
+18b9 : 26 1c __ ROL ACCU + 1
+18bb : ca __ __ DEX
+18bc : d0 f2 __ BNE $18b0
+18be : 85 05 __ STA $05
+18c0 : 60 __ __ RTS
+18c1 : a9 00 __ LDA #$00
+18c3 : 85 05 __ STA $05
+18c5 : 85 06 __ STA $06
+18c7 : 84 02 __ STY $02
+18c9 : a0 10 __ LDY #$10
+18cb : 18 __ __ CLC
+18cc : 26 1b __ ROL ACCU + 0
+18ce : 26 1c __ ROL ACCU + 1
+18d0 : 26 05 __ ROL $05
+18d2 : 26 06 __ ROL $06
+18d4 : 38 __ __ SEC
+18d5 : a5 05 __ LDA $05
+18d7 : e5 03 __ SBC $03
+18d9 : aa __ __ TAX
+18da : a5 06 __ LDA $06
+18dc : e5 04 __ SBC $04
+18de : 90 04 __ BCC $18e4
+18e0 : 86 05 __ STX $05
+18e2 : 85 06 __ STA $06
+18e4 : 88 __ __ DEY
+18e5 : d0 e5 __ BNE $18cc
+18e7 : 26 1b __ ROL ACCU + 0
+18e9 : 26 1c __ ROL ACCU + 1
+18eb : a4 02 __ LDY $02
+18ed : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+18ee : 20 48 16 JSR $1648 ; (freg + 36)
+18f1 : a5 07 __ LDA $07
+18f3 : c9 7f __ CMP #$7f
+18f5 : b0 07 __ BCS $18fe
+18f7 : a9 00 __ LDA #$00
+18f9 : 85 1b __ STA ACCU + 0
+18fb : 85 1c __ STA ACCU + 1
+18fd : 60 __ __ RTS
+18fe : 38 __ __ SEC
+18ff : e9 8e __ SBC #$8e
+1901 : 90 0a __ BCC $190d
+1903 : a9 ff __ LDA #$ff
+1905 : 85 1b __ STA ACCU + 0
+1907 : a9 7f __ LDA #$7f
+1909 : 85 1c __ STA ACCU + 1
+190b : d0 08 __ BNE $1915
+190d : aa __ __ TAX
+190e : 46 1d __ LSR ACCU + 2
+1910 : 66 1c __ ROR ACCU + 1
+1912 : e8 __ __ INX
+1913 : d0 f9 __ BNE $190e
+1915 : 24 1e __ BIT ACCU + 3
+1917 : 10 0e __ BPL $1927
+1919 : 38 __ __ SEC
+191a : a9 00 __ LDA #$00
+191c : e5 1c __ SBC ACCU + 1
+191e : 85 1b __ STA ACCU + 0
+1920 : a9 00 __ LDA #$00
+1922 : e5 1d __ SBC ACCU + 2
+1924 : 85 1c __ STA ACCU + 1
+1926 : 60 __ __ RTS
+1927 : a5 1c __ LDA ACCU + 1
+1929 : 85 1b __ STA ACCU + 0
+192b : a5 1d __ LDA ACCU + 2
+192d : 85 1c __ STA ACCU + 1
+192f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1930 : 24 1c __ BIT ACCU + 1
+1932 : 30 03 __ BMI $1937
+1934 : 4c 4e 19 JMP $194e ; (uint16_to_float + 0)
+1937 : 38 __ __ SEC
+1938 : a9 00 __ LDA #$00
+193a : e5 1b __ SBC ACCU + 0
+193c : 85 1b __ STA ACCU + 0
+193e : a9 00 __ LDA #$00
+1940 : e5 1c __ SBC ACCU + 1
+1942 : 85 1c __ STA ACCU + 1
+1944 : 20 4e 19 JSR $194e ; (uint16_to_float + 0)
+1947 : a5 1e __ LDA ACCU + 3
+1949 : 09 80 __ ORA #$80
+194b : 85 1e __ STA ACCU + 3
+194d : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+194e : a5 1b __ LDA ACCU + 0
+1950 : 05 1c __ ORA ACCU + 1
+1952 : d0 05 __ BNE $1959
+1954 : 85 1d __ STA ACCU + 2
+1956 : 85 1e __ STA ACCU + 3
+1958 : 60 __ __ RTS
+1959 : a2 8e __ LDX #$8e
+195b : a5 1c __ LDA ACCU + 1
+195d : 30 06 __ BMI $1965
+195f : ca __ __ DEX
+1960 : 06 1b __ ASL ACCU + 0
+1962 : 2a __ __ ROL
+1963 : 10 fa __ BPL $195f
+1965 : 29 7f __ AND #$7f
+1967 : 85 1d __ STA ACCU + 2
+1969 : a5 1b __ LDA ACCU + 0
+196b : 85 1c __ STA ACCU + 1
+196d : 8a __ __ TXA
+196e : 4a __ __ LSR
+196f : 85 1e __ STA ACCU + 3
+1971 : a9 00 __ LDA #$00
+1973 : 85 1b __ STA ACCU + 0
+1975 : 6a __ __ ROR
+1976 : 05 1d __ ORA ACCU + 2
+1978 : 85 1d __ STA ACCU + 2
+197a : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+197b : 38 __ __ SEC
+197c : a9 00 __ LDA #$00
+197e : e5 1b __ SBC ACCU + 0
+1980 : 85 1b __ STA ACCU + 0
+1982 : a9 00 __ LDA #$00
+1984 : e5 1c __ SBC ACCU + 1
+1986 : 85 1c __ STA ACCU + 1
+1988 : a9 00 __ LDA #$00
+198a : e5 1d __ SBC ACCU + 2
+198c : 85 1d __ STA ACCU + 2
+198e : a9 00 __ LDA #$00
+1990 : e5 1e __ SBC ACCU + 3
+1992 : 85 1e __ STA ACCU + 3
+1994 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1995 : 84 02 __ STY $02
+1997 : a9 00 __ LDA #$00
+1999 : 85 07 __ STA $07
+199b : 85 08 __ STA $08
+199d : 85 09 __ STA $09
+199f : 85 0a __ STA $0a
+19a1 : a0 20 __ LDY #$20
+19a3 : 18 __ __ CLC
+19a4 : 26 1b __ ROL ACCU + 0
+19a6 : 26 1c __ ROL ACCU + 1
+19a8 : 26 1d __ ROL ACCU + 2
+19aa : 26 1e __ ROL ACCU + 3
+19ac : 26 07 __ ROL $07
+19ae : 26 08 __ ROL $08
+19b0 : 26 09 __ ROL $09
+19b2 : 26 0a __ ROL $0a
+19b4 : a5 07 __ LDA $07
+19b6 : c5 03 __ CMP $03
+19b8 : a5 08 __ LDA $08
+19ba : e5 04 __ SBC $04
+19bc : a5 09 __ LDA $09
+19be : e5 05 __ SBC $05
+19c0 : a5 0a __ LDA $0a
+19c2 : e5 06 __ SBC $06
+19c4 : 90 18 __ BCC $19de
+19c6 : a5 07 __ LDA $07
+19c8 : e5 03 __ SBC $03
+19ca : 85 07 __ STA $07
+19cc : a5 08 __ LDA $08
+19ce : e5 04 __ SBC $04
+19d0 : 85 08 __ STA $08
+19d2 : a5 09 __ LDA $09
+19d4 : e5 05 __ SBC $05
+19d6 : 85 09 __ STA $09
+19d8 : a5 0a __ LDA $0a
+19da : e5 06 __ SBC $06
+19dc : 85 0a __ STA $0a
+19de : 88 __ __ DEY
+19df : d0 c3 __ BNE $19a4
+19e1 : 26 1b __ ROL ACCU + 0
+19e3 : 26 1c __ ROL ACCU + 1
+19e5 : 26 1d __ ROL ACCU + 2
+19e7 : 26 1e __ ROL ACCU + 3
+19e9 : a4 02 __ LDY $02
+19eb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+19ec : a9 00 __ LDA #$00
+19ee : 85 1d __ STA ACCU + 2
+19f0 : 85 1e __ STA ACCU + 3
+19f2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+19f3 : b5 00 __ LDA $00,x
+19f5 : 85 03 __ STA $03
+19f7 : b5 01 __ LDA $01,x
+19f9 : 85 04 __ STA $04
+19fb : b5 02 __ LDA $02,x
+19fd : 85 05 __ STA $05
+19ff : b5 03 __ LDA $03,x
+1a01 : 85 06 __ STA $06
+1a03 : 20 95 19 JSR $1995 ; (divmod32 + 0)
+1a06 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1a07 : b5 00 __ LDA $00,x
+1a09 : 85 03 __ STA $03
+1a0b : b5 01 __ LDA $01,x
+1a0d : 85 04 __ STA $04
+1a0f : b5 02 __ LDA $02,x
+1a11 : 85 05 __ STA $05
+1a13 : b5 03 __ LDA $03,x
+1a15 : 85 06 __ STA $06
+1a17 : 20 95 19 JSR $1995 ; (divmod32 + 0)
+1a1a : a5 07 __ LDA $07
+1a1c : 85 1b __ STA ACCU + 0
+1a1e : a5 08 __ LDA $08
+1a20 : 85 1c __ STA ACCU + 1
+1a22 : a5 09 __ LDA $09
+1a24 : 85 1d __ STA ACCU + 2
+1a26 : a5 0a __ LDA $0a
+1a28 : 85 1e __ STA ACCU + 3
+1a2a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1a2b : b5 03 __ LDA $03,x
+1a2d : c5 1e __ CMP ACCU + 3
+1a2f : d0 20 __ BNE $1a51
+1a31 : b5 02 __ LDA $02,x
+1a33 : c5 1d __ CMP ACCU + 2
+1a35 : d0 1a __ BNE $1a51
+1a37 : b5 01 __ LDA $01,x
+1a39 : c5 1c __ CMP ACCU + 1
+1a3b : d0 14 __ BNE $1a51
+1a3d : b5 00 __ LDA $00,x
+1a3f : c5 1b __ CMP ACCU + 0
+1a41 : d0 0e __ BNE $1a51
+1a43 : a9 00 __ LDA #$00
+1a45 : 85 1b __ STA ACCU + 0
+1a47 : 85 1c __ STA ACCU + 1
+1a49 : 60 __ __ RTS
+1a4a : a9 ff __ LDA #$ff
+1a4c : 85 1b __ STA ACCU + 0
+1a4e : 85 1c __ STA ACCU + 1
+1a50 : 60 __ __ RTS
+1a51 : 90 f7 __ BCC $1a4a
+1a53 : a9 01 __ LDA #$01
+1a55 : 85 1b __ STA ACCU + 0
+1a57 : a9 00 __ LDA #$00
+1a59 : 85 1c __ STA ACCU + 1
+1a5b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1a5c : a5 1e __ LDA ACCU + 3
+1a5e : 49 80 __ EOR #$80
+1a60 : 85 1e __ STA ACCU + 3
+1a62 : b5 03 __ LDA $03,x
+1a64 : 49 80 __ EOR #$80
+1a66 : c5 1e __ CMP ACCU + 3
+1a68 : d0 20 __ BNE $1a8a
+1a6a : b5 02 __ LDA $02,x
+1a6c : c5 1d __ CMP ACCU + 2
+1a6e : d0 1a __ BNE $1a8a
+1a70 : b5 01 __ LDA $01,x
+1a72 : c5 1c __ CMP ACCU + 1
+1a74 : d0 14 __ BNE $1a8a
+1a76 : b5 00 __ LDA $00,x
+1a78 : c5 1b __ CMP ACCU + 0
+1a7a : d0 0e __ BNE $1a8a
+1a7c : a9 00 __ LDA #$00
+1a7e : 85 1b __ STA ACCU + 0
+1a80 : 85 1c __ STA ACCU + 1
+1a82 : 60 __ __ RTS
+1a83 : a9 ff __ LDA #$ff
+1a85 : 85 1b __ STA ACCU + 0
+1a87 : 85 1c __ STA ACCU + 1
+1a89 : 60 __ __ RTS
+1a8a : 90 f7 __ BCC $1a83
+1a8c : a9 01 __ LDA #$01
+1a8e : 85 1b __ STA ACCU + 0
+1a90 : a9 00 __ LDA #$00
+1a92 : 85 1c __ STA ACCU + 1
+1a94 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1a95 : a9 4c __ LDA #$4c
+1a97 : 85 54 __ STA $54
+1a99 : a9 00 __ LDA #$00
+1a9b : 85 13 __ STA P6
+1a9d : a9 19 __ LDA #$19
+1a9f : 85 16 __ STA P9
+1aa1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1aa2 : b1 19 __ LDA (IP + 0),y
+1aa4 : aa __ __ TAX
+1aa5 : c8 __ __ INY
+1aa6 : b1 19 __ LDA (IP + 0),y
+1aa8 : 95 00 __ STA $00,x
+1aaa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1aad : b1 19 __ LDA (IP + 0),y
+1aaf : aa __ __ TAX
+1ab0 : c8 __ __ INY
+1ab1 : b1 19 __ LDA (IP + 0),y
+1ab3 : 95 00 __ STA $00,x
+1ab5 : a9 00 __ LDA #$00
+1ab7 : 95 01 __ STA $01,x
+1ab9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1abc : b1 19 __ LDA (IP + 0),y
+1abe : aa __ __ TAX
+1abf : c8 __ __ INY
+1ac0 : b1 19 __ LDA (IP + 0),y
+1ac2 : 95 00 __ STA $00,x
+1ac4 : a9 ff __ LDA #$ff
+1ac6 : 95 01 __ STA $01,x
+1ac8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1acb : b1 19 __ LDA (IP + 0),y
+1acd : aa __ __ TAX
+1ace : c8 __ __ INY
+1acf : b1 19 __ LDA (IP + 0),y
+1ad1 : 95 00 __ STA $00,x
+1ad3 : c8 __ __ INY
+1ad4 : b1 19 __ LDA (IP + 0),y
+1ad6 : 95 01 __ STA $01,x
+1ad8 : c8 __ __ INY
+1ad9 : b1 19 __ LDA (IP + 0),y
+1adb : 95 02 __ STA $02,x
+1add : c8 __ __ INY
+1ade : b1 19 __ LDA (IP + 0),y
+1ae0 : 95 03 __ STA $03,x
+1ae2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1ae5 : b1 19 __ LDA (IP + 0),y
+1ae7 : aa __ __ TAX
+1ae8 : b5 00 __ LDA $00,x
+1aea : 85 1b __ STA ACCU + 0
+1aec : a9 00 __ LDA #$00
+1aee : 85 1c __ STA ACCU + 1
+1af0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1af3 : b1 19 __ LDA (IP + 0),y
+1af5 : aa __ __ TAX
+1af6 : a5 1b __ LDA ACCU + 0
+1af8 : 95 00 __ STA $00,x
+1afa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1afd : b1 19 __ LDA (IP + 0),y
+1aff : aa __ __ TAX
+1b00 : b5 00 __ LDA $00,x
+1b02 : 85 1b __ STA ACCU + 0
+1b04 : b5 01 __ LDA $01,x
+1b06 : 85 1c __ STA ACCU + 1
+1b08 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1b0b : b1 19 __ LDA (IP + 0),y
+1b0d : aa __ __ TAX
+1b0e : a5 1b __ LDA ACCU + 0
+1b10 : 95 00 __ STA $00,x
+1b12 : a5 1c __ LDA ACCU + 1
+1b14 : 95 01 __ STA $01,x
+1b16 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1b19 : b1 19 __ LDA (IP + 0),y
+1b1b : aa __ __ TAX
+1b1c : b5 00 __ LDA $00,x
+1b1e : 85 1f __ STA ADDR + 0
+1b20 : b5 01 __ LDA $01,x
+1b22 : 85 20 __ STA ADDR + 1
+1b24 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1b27 : b1 19 __ LDA (IP + 0),y
+1b29 : aa __ __ TAX
+1b2a : b5 00 __ LDA $00,x
+1b2c : 85 1b __ STA ACCU + 0
+1b2e : b5 01 __ LDA $01,x
+1b30 : 85 1c __ STA ACCU + 1
+1b32 : b5 02 __ LDA $02,x
+1b34 : 85 1d __ STA ACCU + 2
+1b36 : b5 03 __ LDA $03,x
+1b38 : 85 1e __ STA ACCU + 3
+1b3a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1b3d : b1 19 __ LDA (IP + 0),y
+1b3f : aa __ __ TAX
+1b40 : a5 1b __ LDA ACCU + 0
+1b42 : 95 00 __ STA $00,x
+1b44 : a5 1c __ LDA ACCU + 1
+1b46 : 95 01 __ STA $01,x
+1b48 : a5 1d __ LDA ACCU + 2
+1b4a : 95 02 __ STA $02,x
+1b4c : a5 1e __ LDA ACCU + 3
+1b4e : 95 03 __ STA $03,x
+1b50 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1b53 : b1 19 __ LDA (IP + 0),y
+1b55 : 85 1f __ STA ADDR + 0
+1b57 : c8 __ __ INY
+1b58 : b1 19 __ LDA (IP + 0),y
+1b5a : 85 20 __ STA ADDR + 1
+1b5c : c8 __ __ INY
+1b5d : b1 19 __ LDA (IP + 0),y
+1b5f : aa __ __ TAX
+1b60 : 84 02 __ STY $02
+1b62 : a0 00 __ LDY #$00
+1b64 : b1 1f __ LDA (ADDR + 0),y
+1b66 : 95 00 __ STA $00,x
+1b68 : c8 __ __ INY
+1b69 : b1 1f __ LDA (ADDR + 0),y
+1b6b : 95 01 __ STA $01,x
+1b6d : c8 __ __ INY
+1b6e : b1 1f __ LDA (ADDR + 0),y
+1b70 : 95 02 __ STA $02,x
+1b72 : c8 __ __ INY
+1b73 : b1 1f __ LDA (ADDR + 0),y
+1b75 : 95 03 __ STA $03,x
+1b77 : a4 02 __ LDY $02
+1b79 : 4c 50 08 JMP $0850 ; (startup + 79)
+1b7c : b1 19 __ LDA (IP + 0),y
+1b7e : aa __ __ TAX
+1b7f : c8 __ __ INY
+1b80 : b1 19 __ LDA (IP + 0),y
+1b82 : 84 02 __ STY $02
+1b84 : a8 __ __ TAY
+1b85 : 4c 64 1b JMP $1b64 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1b88 : b1 19 __ LDA (IP + 0),y
+1b8a : aa __ __ TAX
+1b8b : c8 __ __ INY
+1b8c : b1 19 __ LDA (IP + 0),y
+1b8e : 95 00 __ STA $00,x
+1b90 : c8 __ __ INY
+1b91 : b1 19 __ LDA (IP + 0),y
+1b93 : 95 01 __ STA $01,x
+1b95 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1b98 : b1 19 __ LDA (IP + 0),y
+1b9a : aa __ __ TAX
+1b9b : 18 __ __ CLC
+1b9c : b5 00 __ LDA $00,x
+1b9e : 65 1b __ ADC ACCU + 0
+1ba0 : 85 1f __ STA ADDR + 0
+1ba2 : b5 01 __ LDA $01,x
+1ba4 : 65 1c __ ADC ACCU + 1
+1ba6 : 85 20 __ STA ADDR + 1
+1ba8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1bab : b1 19 __ LDA (IP + 0),y
+1bad : aa __ __ TAX
+1bae : c8 __ __ INY
+1baf : b1 19 __ LDA (IP + 0),y
+1bb1 : 84 02 __ STY $02
+1bb3 : a8 __ __ TAY
+1bb4 : b1 25 __ LDA (FP + 0),y
+1bb6 : 95 00 __ STA $00,x
+1bb8 : a4 02 __ LDY $02
+1bba : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1bbd : b1 19 __ LDA (IP + 0),y
+1bbf : aa __ __ TAX
+1bc0 : c8 __ __ INY
+1bc1 : b1 19 __ LDA (IP + 0),y
+1bc3 : 84 02 __ STY $02
+1bc5 : a8 __ __ TAY
+1bc6 : b1 25 __ LDA (FP + 0),y
+1bc8 : 95 00 __ STA $00,x
+1bca : a9 00 __ LDA #$00
+1bcc : 95 01 __ STA $01,x
+1bce : a4 02 __ LDY $02
+1bd0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1bd3 : b1 19 __ LDA (IP + 0),y
+1bd5 : aa __ __ TAX
+1bd6 : c8 __ __ INY
+1bd7 : b1 19 __ LDA (IP + 0),y
+1bd9 : 84 02 __ STY $02
+1bdb : a8 __ __ TAY
+1bdc : b1 25 __ LDA (FP + 0),y
+1bde : 95 00 __ STA $00,x
+1be0 : c8 __ __ INY
+1be1 : b1 25 __ LDA (FP + 0),y
+1be3 : 95 01 __ STA $01,x
+1be5 : a4 02 __ LDY $02
+1be7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1bea : b1 19 __ LDA (IP + 0),y
+1bec : aa __ __ TAX
+1bed : c8 __ __ INY
+1bee : b1 19 __ LDA (IP + 0),y
+1bf0 : 84 02 __ STY $02
+1bf2 : a8 __ __ TAY
+1bf3 : b5 00 __ LDA $00,x
+1bf5 : 91 25 __ STA (FP + 0),y
+1bf7 : a4 02 __ LDY $02
+1bf9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1bfc : b1 19 __ LDA (IP + 0),y
+1bfe : aa __ __ TAX
+1bff : c8 __ __ INY
+1c00 : b1 19 __ LDA (IP + 0),y
+1c02 : 84 02 __ STY $02
+1c04 : a8 __ __ TAY
+1c05 : b5 00 __ LDA $00,x
+1c07 : 91 25 __ STA (FP + 0),y
+1c09 : c8 __ __ INY
+1c0a : b5 01 __ LDA $01,x
+1c0c : 91 25 __ STA (FP + 0),y
+1c0e : a4 02 __ LDY $02
+1c10 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1c13 : b1 19 __ LDA (IP + 0),y
+1c15 : aa __ __ TAX
+1c16 : c8 __ __ INY
+1c17 : 18 __ __ CLC
+1c18 : b1 19 __ LDA (IP + 0),y
+1c1a : 65 25 __ ADC FP + 0
+1c1c : 95 00 __ STA $00,x
+1c1e : c8 __ __ INY
+1c1f : b1 19 __ LDA (IP + 0),y
+1c21 : 65 26 __ ADC FP + 1
+1c23 : 95 01 __ STA $01,x
+1c25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1c28 : b1 19 __ LDA (IP + 0),y
+1c2a : aa __ __ TAX
+1c2b : c8 __ __ INY
+1c2c : b1 19 __ LDA (IP + 0),y
+1c2e : 84 02 __ STY $02
+1c30 : a8 __ __ TAY
+1c31 : b5 00 __ LDA $00,x
+1c33 : 91 23 __ STA (SP + 0),y
+1c35 : a4 02 __ LDY $02
+1c37 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1c3a : b1 19 __ LDA (IP + 0),y
+1c3c : aa __ __ TAX
+1c3d : c8 __ __ INY
+1c3e : b1 19 __ LDA (IP + 0),y
+1c40 : 84 02 __ STY $02
+1c42 : a8 __ __ TAY
+1c43 : b5 00 __ LDA $00,x
+1c45 : 91 23 __ STA (SP + 0),y
+1c47 : c8 __ __ INY
+1c48 : b5 01 __ LDA $01,x
+1c4a : 91 23 __ STA (SP + 0),y
+1c4c : a4 02 __ LDY $02
+1c4e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1c51 : b1 19 __ LDA (IP + 0),y
+1c53 : aa __ __ TAX
+1c54 : c8 __ __ INY
+1c55 : b1 19 __ LDA (IP + 0),y
+1c57 : 84 02 __ STY $02
+1c59 : a8 __ __ TAY
+1c5a : b5 00 __ LDA $00,x
+1c5c : 91 23 __ STA (SP + 0),y
+1c5e : c8 __ __ INY
+1c5f : b5 01 __ LDA $01,x
+1c61 : 91 23 __ STA (SP + 0),y
+1c63 : c8 __ __ INY
+1c64 : b5 02 __ LDA $02,x
+1c66 : 91 23 __ STA (SP + 0),y
+1c68 : c8 __ __ INY
+1c69 : b5 03 __ LDA $03,x
+1c6b : 91 23 __ STA (SP + 0),y
+1c6d : a4 02 __ LDY $02
+1c6f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1c72 : b1 19 __ LDA (IP + 0),y
+1c74 : 85 1f __ STA ADDR + 0
+1c76 : c8 __ __ INY
+1c77 : b1 19 __ LDA (IP + 0),y
+1c79 : 85 20 __ STA ADDR + 1
+1c7b : c8 __ __ INY
+1c7c : b1 19 __ LDA (IP + 0),y
+1c7e : aa __ __ TAX
+1c7f : 84 02 __ STY $02
+1c81 : a0 00 __ LDY #$00
+1c83 : b1 1f __ LDA (ADDR + 0),y
+1c85 : 95 00 __ STA $00,x
+1c87 : a4 02 __ LDY $02
+1c89 : 4c 50 08 JMP $0850 ; (startup + 79)
+1c8c : b1 19 __ LDA (IP + 0),y
+1c8e : aa __ __ TAX
+1c8f : c8 __ __ INY
+1c90 : b1 19 __ LDA (IP + 0),y
+1c92 : 84 02 __ STY $02
+1c94 : a8 __ __ TAY
+1c95 : 4c 83 1c JMP $1c83 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1c98 : b1 19 __ LDA (IP + 0),y
+1c9a : 85 1f __ STA ADDR + 0
+1c9c : c8 __ __ INY
+1c9d : b1 19 __ LDA (IP + 0),y
+1c9f : 85 20 __ STA ADDR + 1
+1ca1 : c8 __ __ INY
+1ca2 : b1 19 __ LDA (IP + 0),y
+1ca4 : aa __ __ TAX
+1ca5 : 84 02 __ STY $02
+1ca7 : a0 00 __ LDY #$00
+1ca9 : b1 1f __ LDA (ADDR + 0),y
+1cab : 95 00 __ STA $00,x
+1cad : a9 00 __ LDA #$00
+1caf : 95 01 __ STA $01,x
+1cb1 : a4 02 __ LDY $02
+1cb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+1cb6 : b1 19 __ LDA (IP + 0),y
+1cb8 : aa __ __ TAX
+1cb9 : c8 __ __ INY
+1cba : b1 19 __ LDA (IP + 0),y
+1cbc : 84 02 __ STY $02
+1cbe : a8 __ __ TAY
+1cbf : 4c a9 1c JMP $1ca9 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1cc2 : b1 19 __ LDA (IP + 0),y
+1cc4 : 85 1f __ STA ADDR + 0
+1cc6 : c8 __ __ INY
+1cc7 : b1 19 __ LDA (IP + 0),y
+1cc9 : 85 20 __ STA ADDR + 1
+1ccb : c8 __ __ INY
+1ccc : b1 19 __ LDA (IP + 0),y
+1cce : aa __ __ TAX
+1ccf : 84 02 __ STY $02
+1cd1 : a0 00 __ LDY #$00
+1cd3 : b1 1f __ LDA (ADDR + 0),y
+1cd5 : 95 00 __ STA $00,x
+1cd7 : c8 __ __ INY
+1cd8 : b1 1f __ LDA (ADDR + 0),y
+1cda : 95 01 __ STA $01,x
+1cdc : a4 02 __ LDY $02
+1cde : 4c 50 08 JMP $0850 ; (startup + 79)
+1ce1 : b1 19 __ LDA (IP + 0),y
+1ce3 : aa __ __ TAX
+1ce4 : c8 __ __ INY
+1ce5 : b1 19 __ LDA (IP + 0),y
+1ce7 : 84 02 __ STY $02
+1ce9 : a8 __ __ TAY
+1cea : 4c d3 1c JMP $1cd3 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1ced : b1 19 __ LDA (IP + 0),y
+1cef : 85 1f __ STA ADDR + 0
+1cf1 : c8 __ __ INY
+1cf2 : b1 19 __ LDA (IP + 0),y
+1cf4 : 85 20 __ STA ADDR + 1
+1cf6 : c8 __ __ INY
+1cf7 : b1 19 __ LDA (IP + 0),y
+1cf9 : aa __ __ TAX
+1cfa : 84 02 __ STY $02
+1cfc : a0 00 __ LDY #$00
+1cfe : b5 00 __ LDA $00,x
+1d00 : 91 1f __ STA (ADDR + 0),y
+1d02 : a4 02 __ LDY $02
+1d04 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d07 : b1 19 __ LDA (IP + 0),y
+1d09 : aa __ __ TAX
+1d0a : c8 __ __ INY
+1d0b : b1 19 __ LDA (IP + 0),y
+1d0d : 84 02 __ STY $02
+1d0f : a8 __ __ TAY
+1d10 : 4c fe 1c JMP $1cfe ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1d13 : b1 19 __ LDA (IP + 0),y
+1d15 : aa __ __ TAX
+1d16 : 18 __ __ CLC
+1d17 : a5 1b __ LDA ACCU + 0
+1d19 : 75 00 __ ADC $00,x
+1d1b : 85 1b __ STA ACCU + 0
+1d1d : a5 1c __ LDA ACCU + 1
+1d1f : 75 01 __ ADC $01,x
+1d21 : 85 1c __ STA ACCU + 1
+1d23 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1d26 : b1 19 __ LDA (IP + 0),y
+1d28 : aa __ __ TAX
+1d29 : 38 __ __ SEC
+1d2a : a5 1b __ LDA ACCU + 0
+1d2c : f5 00 __ SBC $00,x
+1d2e : 85 1b __ STA ACCU + 0
+1d30 : a5 1c __ LDA ACCU + 1
+1d32 : f5 01 __ SBC $01,x
+1d34 : 85 1c __ STA ACCU + 1
+1d36 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1d39 : b1 19 __ LDA (IP + 0),y
+1d3b : aa __ __ TAX
+1d3c : b5 00 __ LDA $00,x
+1d3e : 85 03 __ STA $03
+1d40 : b5 01 __ LDA $01,x
+1d42 : 85 04 __ STA $04
+1d44 : 20 69 18 JSR $1869 ; (divmod + 0)
+1d47 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1d4a : b1 19 __ LDA (IP + 0),y
+1d4c : aa __ __ TAX
+1d4d : b5 00 __ LDA $00,x
+1d4f : 85 03 __ STA $03
+1d51 : b5 01 __ LDA $01,x
+1d53 : 85 04 __ STA $04
+1d55 : 20 69 18 JSR $1869 ; (divmod + 0)
+1d58 : a5 05 __ LDA $05
+1d5a : 85 1b __ STA ACCU + 0
+1d5c : a5 06 __ LDA $06
+1d5e : 85 1c __ STA ACCU + 1
+1d60 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1d63 : b1 19 __ LDA (IP + 0),y
+1d65 : aa __ __ TAX
+1d66 : b5 00 __ LDA $00,x
+1d68 : 85 03 __ STA $03
+1d6a : b5 01 __ LDA $01,x
+1d6c : 85 04 __ STA $04
+1d6e : 24 1c __ BIT ACCU + 1
+1d70 : 10 10 __ BPL $1d82
+1d72 : 20 4d 18 JSR $184d ; (negaccu + 0)
+1d75 : 24 04 __ BIT $04
+1d77 : 10 10 __ BPL $1d89
+1d79 : 20 5b 18 JSR $185b ; (negtmp + 0)
+1d7c : 20 69 18 JSR $1869 ; (divmod + 0)
+1d7f : 4c 50 08 JMP $0850 ; (startup + 79)
+1d82 : 24 04 __ BIT $04
+1d84 : 10 f6 __ BPL $1d7c
+1d86 : 20 5b 18 JSR $185b ; (negtmp + 0)
+1d89 : 20 69 18 JSR $1869 ; (divmod + 0)
+1d8c : 20 4d 18 JSR $184d ; (negaccu + 0)
+1d8f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1d92 : b1 19 __ LDA (IP + 0),y
+1d94 : aa __ __ TAX
+1d95 : b5 00 __ LDA $00,x
+1d97 : 85 03 __ STA $03
+1d99 : b5 01 __ LDA $01,x
+1d9b : 85 04 __ STA $04
+1d9d : 24 1c __ BIT ACCU + 1
+1d9f : 10 18 __ BPL $1db9
+1da1 : 20 4d 18 JSR $184d ; (negaccu + 0)
+1da4 : 24 04 __ BIT $04
+1da6 : 10 18 __ BPL $1dc0
+1da8 : 20 5b 18 JSR $185b ; (negtmp + 0)
+1dab : 20 69 18 JSR $1869 ; (divmod + 0)
+1dae : a5 05 __ LDA $05
+1db0 : 85 1b __ STA ACCU + 0
+1db2 : a5 06 __ LDA $06
+1db4 : 85 1c __ STA ACCU + 1
+1db6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1db9 : 24 04 __ BIT $04
+1dbb : 10 ee __ BPL $1dab
+1dbd : 20 5b 18 JSR $185b ; (negtmp + 0)
+1dc0 : 20 69 18 JSR $1869 ; (divmod + 0)
+1dc3 : a5 05 __ LDA $05
+1dc5 : 85 1b __ STA ACCU + 0
+1dc7 : a5 06 __ LDA $06
+1dc9 : 85 1c __ STA ACCU + 1
+1dcb : 20 4d 18 JSR $184d ; (negaccu + 0)
+1dce : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1dd1 : b1 19 __ LDA (IP + 0),y
+1dd3 : aa __ __ TAX
+1dd4 : 18 __ __ CLC
+1dd5 : b5 00 __ LDA $00,x
+1dd7 : 65 1b __ ADC ACCU + 0
+1dd9 : 95 00 __ STA $00,x
+1ddb : b5 01 __ LDA $01,x
+1ddd : 65 1c __ ADC ACCU + 1
+1ddf : 95 01 __ STA $01,x
+1de1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1de4 : b1 19 __ LDA (IP + 0),y
+1de6 : c8 __ __ INY
+1de7 : aa __ __ TAX
+1de8 : 18 __ __ CLC
+1de9 : b5 00 __ LDA $00,x
+1deb : 71 19 __ ADC (IP + 0),y
+1ded : c8 __ __ INY
+1dee : 95 00 __ STA $00,x
+1df0 : b5 01 __ LDA $01,x
+1df2 : 71 19 __ ADC (IP + 0),y
+1df4 : 95 01 __ STA $01,x
+1df6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1df9 : b1 19 __ LDA (IP + 0),y
+1dfb : c8 __ __ INY
+1dfc : aa __ __ TAX
+1dfd : 38 __ __ SEC
+1dfe : b1 19 __ LDA (IP + 0),y
+1e00 : c8 __ __ INY
+1e01 : f5 00 __ SBC $00,x
+1e03 : 95 00 __ STA $00,x
+1e05 : b1 19 __ LDA (IP + 0),y
+1e07 : f5 01 __ SBC $01,x
+1e09 : 95 01 __ STA $01,x
+1e0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1e0e : b1 19 __ LDA (IP + 0),y
+1e10 : c8 __ __ INY
+1e11 : aa __ __ TAX
+1e12 : b5 00 __ LDA $00,x
+1e14 : 31 19 __ AND (IP + 0),y
+1e16 : c8 __ __ INY
+1e17 : 95 00 __ STA $00,x
+1e19 : b5 01 __ LDA $01,x
+1e1b : 31 19 __ AND (IP + 0),y
+1e1d : 95 01 __ STA $01,x
+1e1f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1e22 : b1 19 __ LDA (IP + 0),y
+1e24 : c8 __ __ INY
+1e25 : aa __ __ TAX
+1e26 : a9 00 __ LDA #$00
+1e28 : 85 05 __ STA $05
+1e2a : 85 06 __ STA $06
+1e2c : b5 00 __ LDA $00,x
+1e2e : 85 03 __ STA $03
+1e30 : b5 01 __ LDA $01,x
+1e32 : 85 04 __ STA $04
+1e34 : b1 19 __ LDA (IP + 0),y
+1e36 : 4a __ __ LSR
+1e37 : 85 07 __ STA $07
+1e39 : 90 0d __ BCC $1e48
+1e3b : 18 __ __ CLC
+1e3c : a5 05 __ LDA $05
+1e3e : 65 03 __ ADC $03
+1e40 : 85 05 __ STA $05
+1e42 : a5 06 __ LDA $06
+1e44 : 65 04 __ ADC $04
+1e46 : 85 06 __ STA $06
+1e48 : 06 03 __ ASL $03
+1e4a : 26 04 __ ROL $04
+1e4c : 46 07 __ LSR $07
+1e4e : b0 eb __ BCS $1e3b
+1e50 : d0 f6 __ BNE $1e48
+1e52 : a5 05 __ LDA $05
+1e54 : 95 00 __ STA $00,x
+1e56 : a5 06 __ LDA $06
+1e58 : 95 01 __ STA $01,x
+1e5a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1e5d : b1 19 __ LDA (IP + 0),y
+1e5f : c8 __ __ INY
+1e60 : aa __ __ TAX
+1e61 : 18 __ __ CLC
+1e62 : b5 00 __ LDA $00,x
+1e64 : 71 19 __ ADC (IP + 0),y
+1e66 : 95 00 __ STA $00,x
+1e68 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1e6b : b1 19 __ LDA (IP + 0),y
+1e6d : aa __ __ TAX
+1e6e : 38 __ __ SEC
+1e6f : b5 01 __ LDA $01,x
+1e71 : e5 1c __ SBC ACCU + 1
+1e73 : f0 11 __ BEQ $1e86
+1e75 : 50 02 __ BVC $1e79
+1e77 : 49 80 __ EOR #$80
+1e79 : 30 2a __ BMI $1ea5
+1e7b : 10 33 __ BPL $1eb0
+1e7d : b1 19 __ LDA (IP + 0),y
+1e7f : aa __ __ TAX
+1e80 : b5 01 __ LDA $01,x
+1e82 : c5 1c __ CMP ACCU + 1
+1e84 : d0 28 __ BNE $1eae
+1e86 : b5 00 __ LDA $00,x
+1e88 : c5 1b __ CMP ACCU + 0
+1e8a : d0 22 __ BNE $1eae
+1e8c : f0 0e __ BEQ $1e9c
+1e8e : b1 19 __ LDA (IP + 0),y
+1e90 : aa __ __ TAX
+1e91 : c8 __ __ INY
+1e92 : b1 19 __ LDA (IP + 0),y
+1e94 : c5 1c __ CMP ACCU + 1
+1e96 : d0 16 __ BNE $1eae
+1e98 : e4 1b __ CPX ACCU + 0
+1e9a : d0 12 __ BNE $1eae
+1e9c : a9 00 __ LDA #$00
+1e9e : 85 1b __ STA ACCU + 0
+1ea0 : 85 1c __ STA ACCU + 1
+1ea2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ea5 : a9 ff __ LDA #$ff
+1ea7 : 85 1b __ STA ACCU + 0
+1ea9 : 85 1c __ STA ACCU + 1
+1eab : 4c 50 08 JMP $0850 ; (startup + 79)
+1eae : 90 f5 __ BCC $1ea5
+1eb0 : a9 01 __ LDA #$01
+1eb2 : 85 1b __ STA ACCU + 0
+1eb4 : a9 00 __ LDA #$00
+1eb6 : 85 1c __ STA ACCU + 1
+1eb8 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ebb : b1 19 __ LDA (IP + 0),y
+1ebd : c8 __ __ INY
+1ebe : aa __ __ TAX
+1ebf : b1 19 __ LDA (IP + 0),y
+1ec1 : 38 __ __ SEC
+1ec2 : e5 1c __ SBC ACCU + 1
+1ec4 : d0 af __ BNE $1e75
+1ec6 : e4 1b __ CPX ACCU + 0
+1ec8 : d0 e4 __ BNE $1eae
+1eca : f0 d0 __ BEQ $1e9c
+1ecc : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1ecd : b1 19 __ LDA (IP + 0),y
+1ecf : aa __ __ TAX
+1ed0 : 38 __ __ SEC
+1ed1 : b5 00 __ LDA $00,x
+1ed3 : e5 1b __ SBC ACCU + 0
+1ed5 : f0 19 __ BEQ $1ef0
+1ed7 : 50 02 __ BVC $1edb
+1ed9 : 49 80 __ EOR #$80
+1edb : 30 1c __ BMI $1ef9
+1edd : 10 25 __ BPL $1f04
+1edf : b1 19 __ LDA (IP + 0),y
+1ee1 : aa __ __ TAX
+1ee2 : b5 00 __ LDA $00,x
+1ee4 : c5 1b __ CMP ACCU + 0
+1ee6 : d0 1a __ BNE $1f02
+1ee8 : f0 06 __ BEQ $1ef0
+1eea : b1 19 __ LDA (IP + 0),y
+1eec : c5 1b __ CMP ACCU + 0
+1eee : d0 12 __ BNE $1f02
+1ef0 : a9 00 __ LDA #$00
+1ef2 : 85 1b __ STA ACCU + 0
+1ef4 : 85 1c __ STA ACCU + 1
+1ef6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ef9 : a9 ff __ LDA #$ff
+1efb : 85 1b __ STA ACCU + 0
+1efd : 85 1c __ STA ACCU + 1
+1eff : 4c 50 08 JMP $0850 ; (startup + 79)
+1f02 : 90 f5 __ BCC $1ef9
+1f04 : a9 01 __ LDA #$01
+1f06 : 85 1b __ STA ACCU + 0
+1f08 : a9 00 __ LDA #$00
+1f0a : 85 1c __ STA ACCU + 1
+1f0c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f0f : b1 19 __ LDA (IP + 0),y
+1f11 : 38 __ __ SEC
+1f12 : e5 1b __ SBC ACCU + 0
+1f14 : d0 c1 __ BNE $1ed7
+1f16 : f0 d8 __ BEQ $1ef0
+1f18 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1f19 : 38 __ __ SEC
+1f1a : a9 00 __ LDA #$00
+1f1c : e5 1b __ SBC ACCU + 0
+1f1e : 85 1b __ STA ACCU + 0
+1f20 : a9 00 __ LDA #$00
+1f22 : e5 1c __ SBC ACCU + 1
+1f24 : 85 1c __ STA ACCU + 1
+1f26 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1f29 : 20 24 16 JSR $1624 ; (freg + 0)
+1f2c : 20 69 16 JSR $1669 ; (faddsub + 0)
+1f2f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1f32 : 20 24 16 JSR $1624 ; (freg + 0)
+1f35 : a5 06 __ LDA $06
+1f37 : 49 80 __ EOR #$80
+1f39 : 85 06 __ STA $06
+1f3b : 20 69 16 JSR $1669 ; (faddsub + 0)
+1f3e : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1f41 : 20 24 16 JSR $1624 ; (freg + 0)
+1f44 : 84 02 __ STY $02
+1f46 : 20 31 17 JSR $1731 ; (fmul + 0)
+1f49 : a4 02 __ LDY $02
+1f4b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1f4e : 20 24 16 JSR $1624 ; (freg + 0)
+1f51 : 20 cf 17 JSR $17cf ; (fdiv + 0)
+1f54 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1f57 : b1 19 __ LDA (IP + 0),y
+1f59 : c8 __ __ INY
+1f5a : aa __ __ TAX
+1f5b : a5 1e __ LDA ACCU + 3
+1f5d : 55 03 __ EOR $03,x
+1f5f : 29 80 __ AND #$80
+1f61 : f0 1e __ BEQ $1f81
+1f63 : a5 1e __ LDA ACCU + 3
+1f65 : 29 7f __ AND #$7f
+1f67 : 05 1d __ ORA ACCU + 2
+1f69 : 05 1c __ ORA ACCU + 1
+1f6b : 05 1b __ ORA ACCU + 0
+1f6d : d0 0c __ BNE $1f7b
+1f6f : b5 03 __ LDA $03,x
+1f71 : 29 7f __ AND #$7f
+1f73 : 15 02 __ ORA $02,x
+1f75 : 15 01 __ ORA $01,x
+1f77 : 15 00 __ ORA $00,x
+1f79 : f0 1e __ BEQ $1f99
+1f7b : a5 1e __ LDA ACCU + 3
+1f7d : 30 29 __ BMI $1fa8
+1f7f : 10 36 __ BPL $1fb7
+1f81 : a5 1e __ LDA ACCU + 3
+1f83 : d5 03 __ CMP $03,x
+1f85 : d0 1b __ BNE $1fa2
+1f87 : a5 1d __ LDA ACCU + 2
+1f89 : d5 02 __ CMP $02,x
+1f8b : d0 15 __ BNE $1fa2
+1f8d : a5 1c __ LDA ACCU + 1
+1f8f : d5 01 __ CMP $01,x
+1f91 : d0 0f __ BNE $1fa2
+1f93 : a5 1b __ LDA ACCU + 0
+1f95 : d5 00 __ CMP $00,x
+1f97 : d0 09 __ BNE $1fa2
+1f99 : a9 00 __ LDA #$00
+1f9b : 85 1b __ STA ACCU + 0
+1f9d : 85 1c __ STA ACCU + 1
+1f9f : 4c 51 08 JMP $0851 ; (startup + 80)
+1fa2 : b0 0f __ BCS $1fb3
+1fa4 : 24 1e __ BIT ACCU + 3
+1fa6 : 30 0f __ BMI $1fb7
+1fa8 : a9 00 __ LDA #$00
+1faa : 85 1c __ STA ACCU + 1
+1fac : a9 01 __ LDA #$01
+1fae : 85 1b __ STA ACCU + 0
+1fb0 : 4c 51 08 JMP $0851 ; (startup + 80)
+1fb3 : 24 1e __ BIT ACCU + 3
+1fb5 : 30 f1 __ BMI $1fa8
+1fb7 : a9 ff __ LDA #$ff
+1fb9 : 85 1b __ STA ACCU + 0
+1fbb : 85 1c __ STA ACCU + 1
+1fbd : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+1fc0 : a5 1e __ LDA ACCU + 3
+1fc2 : 49 80 __ EOR #$80
+1fc4 : 85 1e __ STA ACCU + 3
+1fc6 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_abs_f32:
+1fc9 : a5 1e __ LDA ACCU + 3
+1fcb : 29 7f __ AND #$7f
+1fcd : 85 1e __ STA ACCU + 3
+1fcf : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+1fd2 : 20 30 19 JSR $1930 ; (sint16_to_float + 0)
+1fd5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+1fd8 : 20 ee 18 JSR $18ee ; (f32_to_i16 + 0)
+1fdb : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+1fde : b1 19 __ LDA (IP + 0),y
+1fe0 : 30 0c __ BMI $1fee
+1fe2 : 38 __ __ SEC
+1fe3 : 65 19 __ ADC IP + 0
+1fe5 : 85 19 __ STA IP + 0
+1fe7 : 90 02 __ BCC $1feb
+1fe9 : e6 1a __ INC IP + 1
+1feb : 4c 51 08 JMP $0851 ; (startup + 80)
+1fee : 38 __ __ SEC
+1fef : 65 19 __ ADC IP + 0
+1ff1 : 85 19 __ STA IP + 0
+1ff3 : b0 02 __ BCS $1ff7
+1ff5 : c6 1a __ DEC IP + 1
+1ff7 : 4c 51 08 JMP $0851 ; (startup + 80)
+1ffa : a5 1b __ LDA ACCU + 0
+1ffc : 05 1c __ ORA ACCU + 1
+1ffe : f0 de __ BEQ $1fde
+2000 : 4c 50 08 JMP $0850 ; (startup + 79)
+2003 : a5 1b __ LDA ACCU + 0
+2005 : 05 1c __ ORA ACCU + 1
+2007 : d0 d5 __ BNE $1fde
+2009 : 4c 50 08 JMP $0850 ; (startup + 79)
+200c : a5 1c __ LDA ACCU + 1
+200e : 30 04 __ BMI $2014
+2010 : 05 1b __ ORA ACCU + 0
+2012 : d0 ca __ BNE $1fde
+2014 : 4c 50 08 JMP $0850 ; (startup + 79)
+2017 : a5 1c __ LDA ACCU + 1
+2019 : 10 c3 __ BPL $1fde
+201b : 4c 50 08 JMP $0850 ; (startup + 79)
+201e : a5 1c __ LDA ACCU + 1
+2020 : 30 bc __ BMI $1fde
+2022 : 4c 50 08 JMP $0850 ; (startup + 79)
+2025 : a5 1c __ LDA ACCU + 1
+2027 : 30 b5 __ BMI $1fde
+2029 : 05 1b __ ORA ACCU + 0
+202b : f0 b1 __ BEQ $1fde
+202d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2030 : 38 __ __ SEC
+2031 : b1 19 __ LDA (IP + 0),y
+2033 : 65 19 __ ADC IP + 0
+2035 : aa __ __ TAX
+2036 : c8 __ __ INY
+2037 : b1 19 __ LDA (IP + 0),y
+2039 : 65 1a __ ADC IP + 1
+203b : 85 1a __ STA IP + 1
+203d : 86 19 __ STX IP + 0
+203f : 4c 51 08 JMP $0851 ; (startup + 80)
+2042 : a5 1b __ LDA ACCU + 0
+2044 : 05 1c __ ORA ACCU + 1
+2046 : f0 e8 __ BEQ $2030
+2048 : c8 __ __ INY
+2049 : 4c 50 08 JMP $0850 ; (startup + 79)
+204c : a5 1b __ LDA ACCU + 0
+204e : 05 1c __ ORA ACCU + 1
+2050 : d0 de __ BNE $2030
+2052 : c8 __ __ INY
+2053 : 4c 50 08 JMP $0850 ; (startup + 79)
+2056 : a5 1c __ LDA ACCU + 1
+2058 : 30 04 __ BMI $205e
+205a : 05 1b __ ORA ACCU + 0
+205c : d0 d2 __ BNE $2030
+205e : c8 __ __ INY
+205f : 4c 50 08 JMP $0850 ; (startup + 79)
+2062 : a5 1c __ LDA ACCU + 1
+2064 : 10 ca __ BPL $2030
+2066 : c8 __ __ INY
+2067 : 4c 50 08 JMP $0850 ; (startup + 79)
+206a : a5 1c __ LDA ACCU + 1
+206c : 30 c2 __ BMI $2030
+206e : c8 __ __ INY
+206f : 4c 50 08 JMP $0850 ; (startup + 79)
+2072 : a5 1c __ LDA ACCU + 1
+2074 : 30 ba __ BMI $2030
+2076 : 05 1b __ ORA ACCU + 0
+2078 : f0 b6 __ BEQ $2030
+207a : c8 __ __ INY
+207b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+207e : a9 00 __ LDA #$00
+2080 : 2c a9 01 BIT $01a9 
+2083 : 85 1b __ STA ACCU + 0
+2085 : a9 00 __ LDA #$00
+2087 : 85 1c __ STA ACCU + 1
+2089 : 4c 51 08 JMP $0851 ; (startup + 80)
+208c : a5 1b __ LDA ACCU + 0
+208e : 05 1c __ ORA ACCU + 1
+2090 : f0 ef __ BEQ $2081
+2092 : d0 ea __ BNE $207e
+2094 : a5 1b __ LDA ACCU + 0
+2096 : 05 1c __ ORA ACCU + 1
+2098 : d0 e7 __ BNE $2081
+209a : f0 e2 __ BEQ $207e
+209c : a5 1c __ LDA ACCU + 1
+209e : 30 de __ BMI $207e
+20a0 : 05 1b __ ORA ACCU + 0
+20a2 : d0 dd __ BNE $2081
+20a4 : f0 d8 __ BEQ $207e
+20a6 : a5 1c __ LDA ACCU + 1
+20a8 : 10 d7 __ BPL $2081
+20aa : 30 d2 __ BMI $207e
+20ac : a5 1c __ LDA ACCU + 1
+20ae : 30 d1 __ BMI $2081
+20b0 : 10 cc __ BPL $207e
+20b2 : a5 1c __ LDA ACCU + 1
+20b4 : 30 cb __ BMI $2081
+20b6 : 05 1b __ ORA ACCU + 0
+20b8 : f0 c7 __ BEQ $2081
+20ba : d0 c2 __ BNE $207e
+20bc : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+20bd : b1 19 __ LDA (IP + 0),y
+20bf : 8d d3 20 STA $20d3 ; (inp_jsr + 22)
+20c2 : c8 __ __ INY
+20c3 : b1 19 __ LDA (IP + 0),y
+20c5 : 8d d4 20 STA $20d4 ; (inp_jsr + 23)
+20c8 : 98 __ __ TYA
+20c9 : 38 __ __ SEC
+20ca : 65 19 __ ADC IP + 0
+20cc : 85 19 __ STA IP + 0
+20ce : 90 02 __ BCC $20d2
+20d0 : e6 1a __ INC IP + 1
+20d2 : 20 00 00 JSR $0000 
+20d5 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+20d8 : 98 __ __ TYA
+20d9 : 18 __ __ CLC
+20da : 65 19 __ ADC IP + 0
+20dc : 8d e7 20 STA $20e7 ; (inp_native + 15)
+20df : a5 1a __ LDA IP + 1
+20e1 : 69 00 __ ADC #$00
+20e3 : 8d e8 20 STA $20e8 ; (inp_native + 16)
+20e6 : 20 00 00 JSR $0000 
+20e9 : a0 00 __ LDY #$00
+20eb : b1 23 __ LDA (SP + 0),y
+20ed : 85 19 __ STA IP + 0
+20ef : c8 __ __ INY
+20f0 : b1 23 __ LDA (SP + 0),y
+20f2 : 85 1a __ STA IP + 1
+20f4 : 88 __ __ DEY
+20f5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+20f8 : 38 __ __ SEC
+20f9 : a5 23 __ LDA SP + 0
+20fb : f1 19 __ SBC (IP + 0),y
+20fd : c8 __ __ INY
+20fe : 85 23 __ STA SP + 0
+2100 : a5 24 __ LDA SP + 1
+2102 : f1 19 __ SBC (IP + 0),y
+2104 : c8 __ __ INY
+2105 : 85 24 __ STA SP + 1
+2107 : b1 19 __ LDA (IP + 0),y
+2109 : 84 02 __ STY $02
+210b : a8 __ __ TAY
+210c : a5 25 __ LDA FP + 0
+210e : 91 23 __ STA (SP + 0),y
+2110 : c8 __ __ INY
+2111 : a5 26 __ LDA FP + 1
+2113 : 91 23 __ STA (SP + 0),y
+2115 : 98 __ __ TYA
+2116 : 38 __ __ SEC
+2117 : 65 23 __ ADC SP + 0
+2119 : 85 25 __ STA FP + 0
+211b : a9 00 __ LDA #$00
+211d : 65 24 __ ADC SP + 1
+211f : 85 26 __ STA FP + 1
+2121 : 88 __ __ DEY
+2122 : f0 08 __ BEQ $212c
+2124 : b9 52 00 LDA $0052,y 
+2127 : 88 __ __ DEY
+2128 : 91 23 __ STA (SP + 0),y
+212a : d0 f8 __ BNE $2124
+212c : a4 02 __ LDY $02
+212e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2131 : b1 19 __ LDA (IP + 0),y
+2133 : c8 __ __ INY
+2134 : 84 02 __ STY $02
+2136 : a8 __ __ TAY
+2137 : b1 23 __ LDA (SP + 0),y
+2139 : 85 25 __ STA FP + 0
+213b : c8 __ __ INY
+213c : b1 23 __ LDA (SP + 0),y
+213e : 85 26 __ STA FP + 1
+2140 : 88 __ __ DEY
+2141 : f0 09 __ BEQ $214c
+2143 : 88 __ __ DEY
+2144 : b1 23 __ LDA (SP + 0),y
+2146 : 99 53 00 STA $0053,y 
+2149 : 88 __ __ DEY
+214a : 10 f8 __ BPL $2144
+214c : a4 02 __ LDY $02
+214e : 18 __ __ CLC
+214f : b1 19 __ LDA (IP + 0),y
+2151 : c8 __ __ INY
+2152 : 65 23 __ ADC SP + 0
+2154 : 85 23 __ STA SP + 0
+2156 : b1 19 __ LDA (IP + 0),y
+2158 : c8 __ __ INY
+2159 : 65 24 __ ADC SP + 1
+215b : 85 24 __ STA SP + 1
+215d : a0 01 __ LDY #$01
+215f : b1 23 __ LDA (SP + 0),y
+2161 : 85 1a __ STA IP + 1
+2163 : 88 __ __ DEY
+2164 : b1 23 __ LDA (SP + 0),y
+2166 : 85 19 __ STA IP + 0
+2168 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+216b : b1 19 __ LDA (IP + 0),y
+216d : 85 1f __ STA ADDR + 0
+216f : c8 __ __ INY
+2170 : b1 19 __ LDA (IP + 0),y
+2172 : 85 20 __ STA ADDR + 1
+2174 : c8 __ __ INY
+2175 : 98 __ __ TYA
+2176 : a0 00 __ LDY #$00
+2178 : 18 __ __ CLC
+2179 : 65 19 __ ADC IP + 0
+217b : 91 23 __ STA (SP + 0),y
+217d : c8 __ __ INY
+217e : a5 1a __ LDA IP + 1
+2180 : 69 00 __ ADC #$00
+2182 : 91 23 __ STA (SP + 0),y
+2184 : a5 1f __ LDA ADDR + 0
+2186 : 85 19 __ STA IP + 0
+2188 : a5 20 __ LDA ADDR + 1
+218a : 85 1a __ STA IP + 1
+218c : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+218f : 38 __ __ SEC
+2190 : a5 23 __ LDA SP + 0
+2192 : f1 19 __ SBC (IP + 0),y
+2194 : c8 __ __ INY
+2195 : 85 23 __ STA SP + 0
+2197 : a5 24 __ LDA SP + 1
+2199 : f1 19 __ SBC (IP + 0),y
+219b : 85 24 __ STA SP + 1
+219d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+21a0 : 18 __ __ CLC
+21a1 : b1 19 __ LDA (IP + 0),y
+21a3 : c8 __ __ INY
+21a4 : 65 23 __ ADC SP + 0
+21a6 : 85 23 __ STA SP + 0
+21a8 : b1 19 __ LDA (IP + 0),y
+21aa : 65 24 __ ADC SP + 1
+21ac : 85 24 __ STA SP + 1
+21ae : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+21b1 : b1 19 __ LDA (IP + 0),y
+21b3 : c8 __ __ INY
+21b4 : 8d c2 21 STA $21c2 ; (inp_op_extrt + 17)
+21b7 : b1 19 __ LDA (IP + 0),y
+21b9 : c8 __ __ INY
+21ba : 8d c3 21 STA $21c3 ; (inp_op_extrt + 18)
+21bd : b1 19 __ LDA (IP + 0),y
+21bf : c8 __ __ INY
+21c0 : aa __ __ TAX
+21c1 : 20 00 00 JSR $0000 
+21c4 : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,3106 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e ee 22 STX $22ee ; (spentry + 0)
+0811 : a9 f8 __ LDA #$f8
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 f8 __ LDA #$f8
+0832 : e9 f8 __ SBC #$f8
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	6, 8
+0a04:	PUSH	#$0012
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	LEA	T2, $174d
+0a14:	MOV	2(SP), T2
+0a17:	MOV	4(SP), T1
+0a1a:	MOVD	T3, c + 0
+0a1e:	MOV	ACCU, T1
+0a20:	CNVSF	ACCU
+0a21:	MULF	ACCU, T3
+0a23:	MOVD	T3, ACCU
+0a25:	MOVD	6(SP), T3
+0a28:	MOVD	10(SP), T0
+0a2b:	SUBF	ACCU, T0
+0a2d:	MOVD	14(SP), ACCU
+0a30:	CALL	printf + 0
+0a33:	MOVD	T3, c + 0
+0a37:	MOV	ACCU, T1
+0a39:	CNVSF	ACCU
+0a3a:	MULF	ACCU, T3
+0a3c:	MOVD	T3, ACCU
+0a3e:	MOVD	ACCU, T0
+0a40:	CMPF	ACCU, T3
+0a42:	BEQ	$0A4A
+0a44:	MOV	P0, #-1
+0a47:	CALL	exit + 0
+0a4a:	MOVD	ACCU, c + 0
+0a4e:	ADDF	ACCU, T0
+0a50:	MOVD	T0, ACCU
+0a52:	ADD	T1, #$0001
+0a56:	MOV	ACCU, T1
+0a58:	CMPS	ACCU, #$0032
+0a5b:	BGT	$0A10
+0a5d:	MOVD	T0, d + 0
+0a61:	MOV	T1, #1
+0a64:	LEA	T2, $177a
+0a68:	MOV	2(SP), T2
+0a6b:	MOV	4(SP), T1
+0a6e:	MOVD	T3, d + 0
+0a72:	MOV	ACCU, T1
+0a74:	CNVSF	ACCU
+0a75:	MOVD	T4, ACCU
+0a77:	MULF	ACCU, T3
+0a79:	MOVD	T3, ACCU
+0a7b:	MOVD	6(SP), T3
+0a7e:	MOVD	10(SP), T0
+0a81:	SUBF	ACCU, T0
+0a83:	ABSF	ACCU
+0a84:	DIVF	ACCU, T4
+0a86:	MOVD	14(SP), ACCU
+0a89:	CALL	printf + 0
+0a8c:	MOVD	T3, d + 0
+0a90:	MOV	ACCU, T1
+0a92:	CNVSF	ACCU
+0a93:	MOVD	T4, ACCU
+0a95:	MULF	ACCU, T3
+0a97:	SUBF	ACCU, T0
+0a99:	ABSF	ACCU
+0a9a:	MOVD	T3, ACCU
+0a9c:	MOVD	ACCU, T4
+0a9e:	MOVD	$03, #$358637bd
+0aa4:	MULF	ACCU, $03
+0aa6:	CMPF	ACCU, T3
+0aa8:	BLT	$0AB0
+0aaa:	MOV	P0, #-1
+0aad:	CALL	exit + 0
+0ab0:	MOVD	ACCU, d + 0
+0ab4:	ADDF	ACCU, T0
+0ab6:	MOVD	T0, ACCU
+0ab8:	ADD	T1, #$0001
+0abc:	MOV	ACCU, T1
+0abe:	CMPS	ACCU, #$0032
+0ac1:	BGT	$0A64
+0ac3:	MOV	ACCU, #0
+0ac6:	POP	#$0012
+0ac9:	RETURN	6, 8
+--------------------------------------------------------------------
+printf:
+0acd:	ENTER	26, 86
+0ad1:	PUSH	#$0002
+0ad4:	LEA	T0, 0(FP)
+0ad8:	MOVB	T1, #0
+0adb:	MOV	T2, 60(FP)
+0ade:	MOV	ADDR, T2
+0ae0:	MOVB	T3, 0(ADDR)
+0ae3:	MOVB	ACCU, T3
+0ae5:	BNE	$0B03
+0ae7:	MOVB	ACCU, T1
+0ae9:	LEAX	ADDR, T0 + ACCU
+0aeb:	MOV	ACCU, #0
+0aee:	MOVB	0(ADDR), ACCU
+0af1:	MOVB	ACCU, T1
+0af3:	BEQ	$0AFC
+0af5:	MOV	ACCU, T0
+0af7:	MOV	P0, ACCU
+0af9:	CALL	puts + 0
+0afc:	POP	#$0002
+0aff:	RETURN	26, 86
+0b03:	LEA	T4, 62(FP)
+0b07:	ADD	T2, #$0001
+0b0b:	MOVB	ACCU, T3
+0b0d:	CMPUB	ACCU, #$0025
+0b0f:	BEQ	$0B51
+0b11:	MOVB	ACCU, T1
+0b13:	LEAX	ADDR, T0 + ACCU
+0b15:	MOVB	0(ADDR), T3
+0b18:	ADDB	T1, #$0001
+0b1b:	MOVB	ACCU, T1
+0b1d:	CMPUB	ACCU, #$0028
+0b1f:	BLE	$0B2C
+0b21:	MOV	ADDR, T2
+0b23:	MOVB	T5, 0(ADDR)
+0b26:	ADD	T2, #$0001
+0b2a:	JUMP	$0B49
+0b2c:	MOVB	ACCU, T1
+0b2e:	LEAX	ADDR, T0 + ACCU
+0b30:	MOV	ACCU, #0
+0b33:	MOVB	0(ADDR), ACCU
+0b36:	MOV	ACCU, T0
+0b38:	MOV	P0, ACCU
+0b3a:	CALL	puts + 0
+0b3d:	MOVB	T1, #0
+0b40:	MOV	ADDR, T2
+0b42:	MOVB	T5, 0(ADDR)
+0b45:	ADD	T2, #$0001
+0b49:	MOVB	ACCU, T5
+0b4b:	MOVB	T3, ACCU
+0b4d:	BNE	$0B0B
+0b4f:	JUMP	$0AE7
+0b51:	MOVB	ACCU, T1
+0b53:	BEQ	$0B69
+0b55:	MOVB	ACCU, T1
+0b57:	LEAX	ADDR, T0 + ACCU
+0b59:	MOV	ACCU, #0
+0b5c:	MOVB	0(ADDR), ACCU
+0b5f:	MOV	ACCU, T0
+0b61:	MOV	P0, ACCU
+0b63:	CALL	puts + 0
+0b66:	MOVB	T1, #0
+0b69:	MOV	ADDR, T2
+0b6b:	MOVB	T3, 0(ADDR)
+0b6e:	MOV	ACCU, #10
+0b71:	MOV	53(FP), ACCU
+0b74:	MOV	ACCU, #1
+0b77:	MOVB	51(FP), ACCU
+0b7a:	MOV	ACCU, #255
+0b7d:	MOVB	52(FP), ACCU
+0b80:	MOV	ACCU, #32
+0b83:	MOVB	50(FP), ACCU
+0b86:	MOV	ACCU, #0
+0b89:	MOVB	55(FP), ACCU
+0b8c:	MOVB	56(FP), ACCU
+0b8f:	MOVB	57(FP), ACCU
+0b92:	ADD	T2, #$0001
+0b96:	MOVB	ACCU, T3
+0b98:	CMPUB	ACCU, #$002B
+0b9a:	BEQF	$16F6
+0b9d:	MOVB	ACCU, T3
+0b9f:	CMPUB	ACCU, #$0030
+0ba1:	BEQF	$16E8
+0ba4:	MOVB	ACCU, T3
+0ba6:	CMPUB	ACCU, #$0023
+0ba8:	BEQF	$16DA
+0bab:	MOVB	ACCU, T3
+0bad:	CMPUB	ACCU, #$0030
+0baf:	BGT	$0BB8
+0bb1:	MOVB	ACCU, T3
+0bb3:	CMPUB	ACCU, #$0039
+0bb5:	BGEF	$16A9
+0bb8:	MOVB	ACCU, T3
+0bba:	CMPUB	ACCU, #$002E
+0bbc:	BEQF	$166F
+0bbf:	MOVB	ACCU, T3
+0bc1:	CMPUB	ACCU, #$0064
+0bc3:	BEQF	$1546
+0bc6:	MOVB	ACCU, T3
+0bc8:	CMPUB	ACCU, #$0075
+0bca:	BEQF	$1448
+0bcd:	MOVB	ACCU, T3
+0bcf:	CMPUB	ACCU, #$0078
+0bd1:	BEQF	$1344
+0bd4:	MOVB	ACCU, T3
+0bd6:	CMPUB	ACCU, #$006C
+0bd8:	BEQF	$0F64
+0bdb:	MOVB	ACCU, T3
+0bdd:	CMPUB	ACCU, #$0066
+0bdf:	BEQ	$0C4B
+0be1:	MOVB	ACCU, T3
+0be3:	CMPUB	ACCU, #$0067
+0be5:	BEQ	$0C4B
+0be7:	MOVB	ACCU, T3
+0be9:	CMPUB	ACCU, #$0065
+0beb:	BEQ	$0C4B
+0bed:	MOVB	ACCU, T3
+0bef:	CMPUB	ACCU, #$0073
+0bf1:	BEQ	$0C33
+0bf3:	MOVB	ACCU, T3
+0bf5:	CMPUB	ACCU, #$0063
+0bf7:	BEQ	$0C14
+0bf9:	MOVB	ACCU, T3
+0bfb:	BEQF	$0B21
+0bfe:	MOVB	ACCU, T1
+0c00:	LEAX	ADDR, T0 + ACCU
+0c02:	MOVB	0(ADDR), T3
+0c05:	ADDB	T1, #$0001
+0c08:	MOV	ADDR, T2
+0c0a:	MOVB	T5, 0(ADDR)
+0c0d:	ADD	T2, #$0001
+0c11:	JUMPF	$0B49
+0c14:	MOVB	ACCU, T1
+0c16:	MOV	ADDR, T4
+0c18:	MOV	T7, 0(ADDR)
+0c1b:	LEAX	ADDR, T0 + ACCU
+0c1d:	MOVB	0(ADDR), T7
+0c20:	ADD	T4, #$0002
+0c24:	ADDB	T1, #$0001
+0c27:	MOV	ADDR, T2
+0c29:	MOVB	T5, 0(ADDR)
+0c2c:	ADD	T2, #$0001
+0c30:	JUMPF	$0B49
+0c33:	MOV	ADDR, T4
+0c35:	MOV	P0, 0(ADDR)
+0c38:	CALL	puts + 0
+0c3b:	ADD	T4, #$0002
+0c3f:	MOV	ADDR, T2
+0c41:	MOVB	T5, 0(ADDR)
+0c44:	ADD	T2, #$0001
+0c48:	JUMPF	$0B49
+0c4b:	MOV	ADDR, T4
+0c4d:	MOVD	T13, 0(ADDR)
+0c50:	MOVB	ACCU, T3
+0c52:	MOVB	T1, ACCU
+0c54:	LEA	T6, 0(FP)
+0c58:	MOVD	ACCU, #$00000000
+0c5e:	CMPF	ACCU, T13
+0c60:	BLTF	$0F53
+0c63:	MOVB	T3, #0
+0c66:	MOVUB	ACCU, 55(FP)
+0c69:	BEQ	$0C74
+0c6b:	MOV	ACCU, #43
+0c6e:	MOVB	0(FP), ACCU
+0c71:	MOVB	T3, #1
+0c74:	MOV	T7, #0
+0c77:	MOVB	T5, 52(FP)
+0c7a:	MOVB	ACCU, T5
+0c7c:	CMPUB	ACCU, #$00FF
+0c7e:	BNE	$0C85
+0c80:	MOVB	T5, #6
+0c83:	JUMP	$0C89
+0c85:	AND	T5, #$00FF
+0c89:	MOVD	ACCU, #$00000000
+0c8f:	CMPF	ACCU, T13
+0c91:	BNEF	$0EE3
+0c94:	MOVB	ACCU, T1
+0c96:	CMPUB	ACCU, #$0065
+0c98:	SEQ
+0c99:	MOVB	T12, ACCU
+0c9b:	MOVB	T17, ACCU
+0c9d:	MOVB	ACCU, T5
+0c9f:	MOV	T8, ACCU
+0ca1:	ADD	T8, #$0001
+0ca5:	MOVB	ACCU, T1
+0ca7:	CMPUB	ACCU, #$0067
+0ca9:	BEQF	$0ED2
+0cac:	MOVB	ACCU, T12
+0cae:	BNEF	$0E88
+0cb1:	MOV	ACCU, T7
+0cb3:	BGE	$0CC9
+0cb5:	MOVD	ACCU, T13
+0cb7:	MOVD	$03, #$41200000
+0cbd:	DIVF	ACCU, $03
+0cbf:	MOVD	T13, ACCU
+0cc1:	ADD	T7, #$0001
+0cc5:	MOV	ACCU, T7
+0cc7:	BLT	$0CB5
+0cc9:	MOVD	T14, #$3f000000
+0ccf:	MOVB	ACCU, T5
+0cd1:	ADD	ACCU, T7
+0cd3:	MOV	T8, ACCU
+0cd5:	ADD	T8, #$0001
+0cd9:	MOVB	ACCU, T8
+0cdb:	CMPUB	ACCU, #$0001
+0cdd:	BLTF	$0E6D
+0ce0:	MOVD	ACCU, T13
+0ce2:	ADDF	ACCU, T14
+0ce4:	MOVD	T13, ACCU
+0ce6:	MOVD	T14, ACCU
+0ce8:	MOVD	ACCU, #$41200000
+0cee:	CMPF	ACCU, T13
+0cf0:	BLT	$0D01
+0cf2:	MOVD	ACCU, T13
+0cf4:	MOVD	$03, #$41200000
+0cfa:	DIVF	ACCU, $03
+0cfc:	MOVD	T14, ACCU
+0cfe:	ADDB	T5, #$00FF
+0d01:	MOVB	ACCU, T8
+0d03:	MOV	T9, ACCU
+0d05:	MOVB	ACCU, T5
+0d07:	NEG	ACCU
+0d08:	ADD	ACCU, T9
+0d0a:	MOV	T9, ACCU
+0d0c:	MOVB	T1, ACCU
+0d0e:	MOVB	ACCU, T8
+0d10:	CMPUB	ACCU, #$0014
+0d12:	BGE	$0D17
+0d14:	MOVB	T8, #20
+0d17:	MOVB	ACCU, T9
+0d19:	BNE	$0D28
+0d1b:	MOVB	ACCU, T3
+0d1d:	LEAX	ADDR, T6 + ACCU
+0d1f:	MOV	ACCU, #48
+0d22:	MOVB	0(ADDR), ACCU
+0d25:	ADDB	T3, #$0001
+0d28:	MOVB	T5, #0
+0d2b:	MOVB	ACCU, T8
+0d2d:	BNEF	$0E29
+0d30:	MOVB	ACCU, T17
+0d32:	BNE	$0DAC
+0d34:	MOVUB	ACCU, 51(FP)
+0d37:	CMPUB	ACCU, T3
+0d39:	BLT	$0D4F
+0d3b:	MOVB	ACCU, T3
+0d3d:	MOVB	T1, ACCU
+0d3f:	ADD	T4, #$0004
+0d43:	MOV	ADDR, T2
+0d45:	MOVB	T5, 0(ADDR)
+0d48:	ADD	T2, #$0001
+0d4c:	JUMPF	$0B49
+0d4f:	MOVB	ACCU, T3
+0d51:	CMPUB	ACCU, #$0001
+0d53:	BLE	$0D81
+0d55:	MOVB	T1, #0
+0d58:	MOVUB	T7, 51(FP)
+0d5b:	MOVB	ACCU, T3
+0d5d:	NEG	ACCU
+0d5e:	ADD	ACCU, T7
+0d60:	MOV	T8, ACCU
+0d62:	MOVB	ACCU, T1
+0d64:	MOV	T9, ACCU
+0d66:	MOV	ACCU, T8
+0d68:	CMPU	ACCU, T9
+0d6a:	BLT	$0D70
+0d6c:	MOV	ACCU, T7
+0d6e:	JUMP	$0D3D
+0d70:	MOV	ACCU, T6
+0d72:	ADD	T9, ACCU
+0d74:	MOV	ADDR, T9
+0d76:	MOV	ACCU, #32
+0d79:	MOVB	0(ADDR), ACCU
+0d7c:	ADDB	T1, #$0001
+0d7f:	JUMP	$0D62
+0d81:	MOVB	T1, #1
+0d84:	MOVUB	T7, 51(FP)
+0d87:	MOVB	ACCU, T3
+0d89:	MOV	T8, ACCU
+0d8b:	MOVB	ACCU, T1
+0d8d:	MOV	T9, ACCU
+0d8f:	MOV	ACCU, T8
+0d91:	SUB	ACCU, T9
+0d93:	LEAX	ADDR, T6 + ACCU
+0d95:	MOVB	T5, 0(ADDR)
+0d98:	MOV	ACCU, T7
+0d9a:	SUB	ACCU, T9
+0d9c:	LEAX	ADDR, T6 + ACCU
+0d9e:	MOVB	0(ADDR), T5
+0da1:	ADDB	T1, #$0001
+0da4:	MOVB	ACCU, T3
+0da6:	CMPUB	ACCU, T1
+0da8:	BLE	$0D8B
+0daa:	JUMP	$0D55
+0dac:	MOVB	ACCU, T3
+0dae:	LEAX	ADDR, T6 + ACCU
+0db0:	MOV	ACCU, #69
+0db3:	MOVB	0(ADDR), ACCU
+0db6:	MOVB	ACCU, T3
+0db8:	ADDB	ACCU, #$0001
+0dbb:	MOVB	T1, ACCU
+0dbd:	MOV	ACCU, T7
+0dbf:	BLT	$0DD4
+0dc1:	MOVB	ACCU, T1
+0dc3:	LEAX	ADDR, T6 + ACCU
+0dc5:	MOV	ACCU, #43
+0dc8:	MOVB	0(ADDR), ACCU
+0dcb:	MOVB	ACCU, T3
+0dcd:	ADDB	ACCU, #$0002
+0dd0:	MOVB	T1, ACCU
+0dd2:	JUMP	$0DEA
+0dd4:	MOVB	ACCU, T1
+0dd6:	LEAX	ADDR, T6 + ACCU
+0dd8:	MOV	ACCU, #45
+0ddb:	MOVB	0(ADDR), ACCU
+0dde:	MOVB	ACCU, T3
+0de0:	ADDB	ACCU, #$0002
+0de3:	MOVB	T1, ACCU
+0de5:	MOV	ACCU, T7
+0de7:	NEG	ACCU
+0de8:	MOV	T7, ACCU
+0dea:	MOVB	ACCU, T1
+0dec:	ADD	ACCU, T6
+0dee:	MOV	T8, ACCU
+0df0:	MOV	ACCU, T7
+0df2:	MOV	ADDR, #10
+0df5:	DIVS	ACCU, ADDR
+0df7:	MOV	ADDR, T8
+0df9:	MOV	T9, ACCU
+0dfb:	ADD	T9, #$0030
+0dff:	MOVB	0(ADDR), T9
+0e02:	MOVB	ACCU, T1
+0e04:	ADDB	ACCU, #$0001
+0e07:	MOVB	ACCU, ACCU
+0e09:	ADD	ACCU, T6
+0e0b:	MOV	T8, ACCU
+0e0d:	MOV	ACCU, T7
+0e0f:	MOV	ADDR, #10
+0e12:	MODS	ACCU, ADDR
+0e14:	MOV	ADDR, T8
+0e16:	MOV	T7, ACCU
+0e18:	ADD	T7, #$0030
+0e1c:	MOVB	0(ADDR), T7
+0e1f:	MOVB	ACCU, T1
+0e21:	ADDB	ACCU, #$0002
+0e24:	MOVB	T3, ACCU
+0e26:	JUMPF	$0D34
+0e29:	MOVB	ACCU, T1
+0e2b:	CMPUB	ACCU, T5
+0e2d:	BNE	$0E3C
+0e2f:	MOVB	ACCU, T3
+0e31:	LEAX	ADDR, T6 + ACCU
+0e33:	MOV	ACCU, #46
+0e36:	MOVB	0(ADDR), ACCU
+0e39:	ADDB	T3, #$0001
+0e3c:	MOVB	ACCU, T3
+0e3e:	LEAX	ADDR, T6 + ACCU
+0e40:	MOVD	ACCU, T14
+0e42:	CNVFS	ACCU
+0e43:	MOV	T10, ACCU
+0e45:	ADDB	ACCU, #$0030
+0e48:	MOVB	0(ADDR), ACCU
+0e4b:	MOV	ACCU, T10
+0e4d:	CNVSF	ACCU
+0e4e:	MOVD	T13, ACCU
+0e50:	MOVD	ACCU, T14
+0e52:	SUBF	ACCU, T13
+0e54:	MOVD	$03, #$41200000
+0e5a:	MULF	ACCU, $03
+0e5c:	MOVD	T14, ACCU
+0e5e:	ADDB	T3, #$0001
+0e61:	ADDB	T5, #$0001
+0e64:	MOVB	ACCU, T8
+0e66:	CMPUB	ACCU, T5
+0e68:	BLT	$0E29
+0e6a:	JUMPF	$0D30
+0e6d:	MOVB	T1, #1
+0e70:	MOVD	ACCU, T14
+0e72:	MOVD	$03, #$41200000
+0e78:	DIVF	ACCU, $03
+0e7a:	MOVD	T14, ACCU
+0e7c:	ADDB	T1, #$0001
+0e7f:	MOVB	ACCU, T8
+0e81:	CMPUB	ACCU, T1
+0e83:	BLT	$0E70
+0e85:	JUMPF	$0CE0
+0e88:	MOVD	T14, #$3f000000
+0e8e:	MOVB	ACCU, T5
+0e90:	BNE	$0EB8
+0e92:	MOVD	ACCU, T13
+0e94:	ADDF	ACCU, T14
+0e96:	MOVD	T13, ACCU
+0e98:	MOVD	T14, ACCU
+0e9a:	MOVD	ACCU, #$41200000
+0ea0:	CMPF	ACCU, T13
+0ea2:	BLTF	$0D01
+0ea5:	MOVD	ACCU, T13
+0ea7:	MOVD	$03, #$41200000
+0ead:	DIVF	ACCU, $03
+0eaf:	MOVD	T14, ACCU
+0eb1:	ADD	T7, #$0001
+0eb5:	JUMPF	$0D01
+0eb8:	MOVB	T1, #0
+0ebb:	MOVD	ACCU, T14
+0ebd:	MOVD	$03, #$41200000
+0ec3:	DIVF	ACCU, $03
+0ec5:	MOVD	T14, ACCU
+0ec7:	ADDB	T1, #$0001
+0eca:	MOVB	ACCU, T5
+0ecc:	CMPUB	ACCU, T1
+0ece:	BLT	$0EBB
+0ed0:	JUMP	$0E92
+0ed2:	MOV	ACCU, T7
+0ed4:	CMPS	ACCU, #$0003
+0ed7:	BLT	$0EDE
+0ed9:	MOV	ACCU, T7
+0edb:	BGEF	$0CAC
+0ede:	MOVB	T17, #1
+0ee1:	JUMP	$0E88
+0ee3:	MOVD	ACCU, #$447a0000
+0ee9:	CMPF	ACCU, T13
+0eeb:	BLT	$0F07
+0eed:	ADD	T7, #$0003
+0ef1:	MOVD	ACCU, T13
+0ef3:	MOVD	$03, #$447a0000
+0ef9:	DIVF	ACCU, $03
+0efb:	MOVD	T13, ACCU
+0efd:	MOVD	ACCU, #$447a0000
+0f03:	CMPF	ACCU, T13
+0f05:	BGE	$0EED
+0f07:	MOVD	ACCU, #$3f800000
+0f0d:	CMPF	ACCU, T13
+0f0f:	BGE	$0F2B
+0f11:	ADD	T7, #$FFFD
+0f15:	MOVD	ACCU, T13
+0f17:	MOVD	$03, #$447a0000
+0f1d:	MULF	ACCU, $03
+0f1f:	MOVD	T13, ACCU
+0f21:	MOVD	ACCU, #$3f800000
+0f27:	CMPF	ACCU, T13
+0f29:	BLT	$0F11
+0f2b:	MOVD	ACCU, #$41200000
+0f31:	CMPF	ACCU, T13
+0f33:	BLTF	$0C94
+0f36:	ADD	T7, #$0001
+0f3a:	MOVD	ACCU, T13
+0f3c:	MOVD	$03, #$41200000
+0f42:	DIVF	ACCU, $03
+0f44:	MOVD	T13, ACCU
+0f46:	MOVD	ACCU, #$41200000
+0f4c:	CMPF	ACCU, T13
+0f4e:	BGE	$0F36
+0f50:	JUMPF	$0C94
+0f53:	MOV	ACCU, #45
+0f56:	MOVB	0(FP), ACCU
+0f59:	MOVB	T3, #1
+0f5c:	MOVD	ACCU, T13
+0f5e:	NEGF	ACCU
+0f5f:	MOVD	T13, ACCU
+0f61:	JUMPF	$0C74
+0f64:	MOV	ADDR, T4
+0f66:	MOVD	T13, 0(ADDR)
+0f69:	ADD	T4, #$0004
+0f6d:	MOV	ADDR, T2
+0f6f:	MOVB	T3, 0(ADDR)
+0f72:	ADD	T2, #$0001
+0f76:	MOVB	ACCU, T3
+0f78:	CMPUB	ACCU, #$0064
+0f7a:	BEQF	$11D7
+0f7d:	MOVB	ACCU, T3
+0f7f:	CMPUB	ACCU, #$0075
+0f81:	BEQF	$10BA
+0f84:	MOVB	ACCU, T3
+0f86:	CMPUB	ACCU, #$0078
+0f88:	BNEF	$0B21
+0f8b:	MOV	ACCU, #16
+0f8e:	MOV	53(FP), ACCU
+0f91:	LEA	T6, 0(FP)
+0f95:	MOVB	T1, #16
+0f98:	MOVD	ACCU, #$00000000
+0f9e:	EXTRT	T13, inp_op_cmp_u32 + 0
+0fa2:	BGTF	$1069
+0fa5:	MOVB	T3, 52(FP)
+0fa8:	MOVB	ACCU, T3
+0faa:	CMPUB	ACCU, #$00FF
+0fac:	BNEF	$1059
+0faf:	MOVB	T3, #15
+0fb2:	MOVB	ACCU, T1
+0fb4:	CMPUB	ACCU, #$000F
+0fb6:	BGE	$0FCB
+0fb8:	ADDB	T1, #$00FF
+0fbb:	MOVB	ACCU, T1
+0fbd:	LEAX	ADDR, T6 + ACCU
+0fbf:	MOV	ACCU, #48
+0fc2:	MOVB	0(ADDR), ACCU
+0fc5:	MOVB	ACCU, T3
+0fc7:	CMPUB	ACCU, T1
+0fc9:	BGT	$0FB8
+0fcb:	MOVUB	ACCU, 57(FP)
+0fce:	BEQ	$0FF4
+0fd0:	MOV	ACCU, 53(FP)
+0fd3:	CMPU	ACCU, #$0010
+0fd6:	BNE	$0FF4
+0fd8:	MOVB	ACCU, T1
+0fda:	ADDB	ACCU, #$00FF
+0fdd:	MOVB	ACCU, ACCU
+0fdf:	LEAX	ADDR, T6 + ACCU
+0fe1:	MOV	ACCU, #88
+0fe4:	MOVB	0(ADDR), ACCU
+0fe7:	ADDB	T1, #$00FE
+0fea:	MOVB	ACCU, T1
+0fec:	LEAX	ADDR, T6 + ACCU
+0fee:	MOV	ACCU, #48
+0ff1:	MOVB	0(ADDR), ACCU
+0ff4:	MOVUB	ACCU, 55(FP)
+0ff7:	BEQ	$1006
+0ff9:	ADDB	T1, #$00FF
+0ffc:	MOVB	ACCU, T1
+0ffe:	LEAX	ADDR, T6 + ACCU
+1000:	MOV	ACCU, #43
+1003:	MOVB	0(ADDR), ACCU
+1006:	MOVUB	T7, 51(FP)
+1009:	SUBR	T7, #$0010
+100d:	MOVB	T3, 50(FP)
+1010:	MOVB	ACCU, T1
+1012:	MOV	T8, ACCU
+1014:	MOV	ACCU, T7
+1016:	CMPS	ACCU, T8
+1018:	BGT	$104D
+101a:	MOVB	T3, #0
+101d:	MOVB	ACCU, T1
+101f:	CMPUB	ACCU, #$0010
+1021:	BLE	$103D
+1023:	MOVB	ACCU, T1
+1025:	LEAX	ADDR, T6 + ACCU
+1027:	MOVB	T5, 0(ADDR)
+102a:	MOVB	ACCU, T3
+102c:	LEAX	ADDR, T6 + ACCU
+102e:	MOVB	0(ADDR), T5
+1031:	ADDB	T3, #$0001
+1034:	ADDB	T1, #$0001
+1037:	MOVB	ACCU, T1
+1039:	CMPUB	ACCU, #$0010
+103b:	BGT	$1023
+103d:	MOV	ADDR, T2
+103f:	MOVB	T5, 0(ADDR)
+1042:	ADD	T2, #$0001
+1046:	MOVB	ACCU, T3
+1048:	MOV	T1, ACCU
+104a:	JUMPF	$0B49
+104d:	ADDB	T1, #$00FF
+1050:	MOVB	ACCU, T1
+1052:	LEAX	ADDR, T6 + ACCU
+1054:	MOVB	0(ADDR), T3
+1057:	JUMP	$1010
+1059:	MOVB	ACCU, T3
+105b:	SUBR	ACCU, #$0010
+105f:	MOV	T3, ACCU
+1061:	CMPUB	ACCU, T1
+1063:	BGTF	$0FB8
+1066:	JUMPF	$0FCB
+1069:	MOV	T7, 53(FP)
+106c:	MOV	ACCU, T7
+106e:	EXTRT	$00, inp_op_ext_u16 + 0
+1072:	MOVD	T14, ACCU
+1074:	MOV	ACCU, T7
+1076:	EXTRT	$00, inp_op_ext_u16 + 0
+107a:	MOVD	T15, ACCU
+107c:	MOVD	ACCU, T13
+107e:	EXTRT	T14, inp_binop_mod_u32 + 0
+1082:	MOVD	T16, ACCU
+1084:	CMPS	ACCU, #$000A
+1087:	BLE	$1091
+1089:	MOV	ACCU, T16
+108b:	ADD	ACCU, #$0030
+108f:	JUMP	$1097
+1091:	MOV	ACCU, T16
+1093:	ADD	ACCU, #$0037
+1097:	MOV	T7, ACCU
+1099:	ADDB	T1, #$00FF
+109c:	MOVB	ACCU, T1
+109e:	LEAX	ADDR, T6 + ACCU
+10a0:	MOVB	0(ADDR), T7
+10a3:	MOVD	ACCU, T13
+10a5:	EXTRT	T15, inp_binop_div_u32 + 0
+10a9:	MOVD	T13, ACCU
+10ab:	MOVD	ACCU, #$00000000
+10b1:	EXTRT	T13, inp_op_cmp_u32 + 0
+10b5:	BGT	$107C
+10b7:	JUMPF	$0FA5
+10ba:	LEA	T6, 0(FP)
+10be:	MOVB	T1, #16
+10c1:	MOVD	ACCU, #$00000000
+10c7:	EXTRT	T13, inp_op_cmp_u32 + 0
+10cb:	BGTF	$1186
+10ce:	MOVB	T3, 52(FP)
+10d1:	MOVB	ACCU, T3
+10d3:	CMPUB	ACCU, #$00FF
+10d5:	BNEF	$1176
+10d8:	MOVB	T3, #15
+10db:	MOVB	ACCU, T1
+10dd:	CMPUB	ACCU, #$000F
+10df:	BGE	$10F4
+10e1:	ADDB	T1, #$00FF
+10e4:	MOVB	ACCU, T1
+10e6:	LEAX	ADDR, T6 + ACCU
+10e8:	MOV	ACCU, #48
+10eb:	MOVB	0(ADDR), ACCU
+10ee:	MOVB	ACCU, T3
+10f0:	CMPUB	ACCU, T1
+10f2:	BGT	$10E1
+10f4:	MOVUB	ACCU, 57(FP)
+10f7:	BEQ	$111D
+10f9:	MOV	ACCU, 53(FP)
+10fc:	CMPU	ACCU, #$0010
+10ff:	BNE	$111D
+1101:	MOVB	ACCU, T1
+1103:	ADDB	ACCU, #$00FF
+1106:	MOVB	ACCU, ACCU
+1108:	LEAX	ADDR, T6 + ACCU
+110a:	MOV	ACCU, #88
+110d:	MOVB	0(ADDR), ACCU
+1110:	ADDB	T1, #$00FE
+1113:	MOVB	ACCU, T1
+1115:	LEAX	ADDR, T6 + ACCU
+1117:	MOV	ACCU, #48
+111a:	MOVB	0(ADDR), ACCU
+111d:	MOVUB	ACCU, 55(FP)
+1120:	BEQ	$112F
+1122:	ADDB	T1, #$00FF
+1125:	MOVB	ACCU, T1
+1127:	LEAX	ADDR, T6 + ACCU
+1129:	MOV	ACCU, #43
+112c:	MOVB	0(ADDR), ACCU
+112f:	MOVUB	T7, 51(FP)
+1132:	SUBR	T7, #$0010
+1136:	MOVB	T3, 50(FP)
+1139:	MOVB	ACCU, T1
+113b:	MOV	T8, ACCU
+113d:	MOV	ACCU, T7
+113f:	CMPS	ACCU, T8
+1141:	BGT	$116A
+1143:	MOVB	T3, #0
+1146:	MOVB	ACCU, T1
+1148:	CMPUB	ACCU, #$0010
+114a:	BLEF	$103D
+114d:	MOVB	ACCU, T1
+114f:	LEAX	ADDR, T6 + ACCU
+1151:	MOVB	T5, 0(ADDR)
+1154:	MOVB	ACCU, T3
+1156:	LEAX	ADDR, T6 + ACCU
+1158:	MOVB	0(ADDR), T5
+115b:	ADDB	T3, #$0001
+115e:	ADDB	T1, #$0001
+1161:	MOVB	ACCU, T1
+1163:	CMPUB	ACCU, #$0010
+1165:	BGT	$114D
+1167:	JUMPF	$103D
+116a:	ADDB	T1, #$00FF
+116d:	MOVB	ACCU, T1
+116f:	LEAX	ADDR, T6 + ACCU
+1171:	MOVB	0(ADDR), T3
+1174:	JUMP	$1139
+1176:	MOVB	ACCU, T3
+1178:	SUBR	ACCU, #$0010
+117c:	MOV	T3, ACCU
+117e:	CMPUB	ACCU, T1
+1180:	BGTF	$10E1
+1183:	JUMPF	$10F4
+1186:	MOV	T7, 53(FP)
+1189:	MOV	ACCU, T7
+118b:	EXTRT	$00, inp_op_ext_u16 + 0
+118f:	MOVD	T14, ACCU
+1191:	MOV	ACCU, T7
+1193:	EXTRT	$00, inp_op_ext_u16 + 0
+1197:	MOVD	T15, ACCU
+1199:	MOVD	ACCU, T13
+119b:	EXTRT	T14, inp_binop_mod_u32 + 0
+119f:	MOVD	T16, ACCU
+11a1:	CMPS	ACCU, #$000A
+11a4:	BLE	$11AE
+11a6:	MOV	ACCU, T16
+11a8:	ADD	ACCU, #$0030
+11ac:	JUMP	$11B4
+11ae:	MOV	ACCU, T16
+11b0:	ADD	ACCU, #$0037
+11b4:	MOV	T7, ACCU
+11b6:	ADDB	T1, #$00FF
+11b9:	MOVB	ACCU, T1
+11bb:	LEAX	ADDR, T6 + ACCU
+11bd:	MOVB	0(ADDR), T7
+11c0:	MOVD	ACCU, T13
+11c2:	EXTRT	T15, inp_binop_div_u32 + 0
+11c6:	MOVD	T13, ACCU
+11c8:	MOVD	ACCU, #$00000000
+11ce:	EXTRT	T13, inp_op_cmp_u32 + 0
+11d2:	BGT	$1199
+11d4:	JUMPF	$10CE
+11d7:	LEA	T6, 0(FP)
+11db:	MOVD	ACCU, #$00000000
+11e1:	EXTRT	T13, inp_op_cmp_s32 + 0
+11e5:	BLTF	$1327
+11e8:	MOVD	ACCU, T13
+11ea:	MOVD	T14, ACCU
+11ec:	MOVB	T1, #0
+11ef:	MOVB	T3, #16
+11f2:	MOVD	ACCU, #$00000000
+11f8:	EXTRT	T13, inp_op_cmp_u32 + 0
+11fc:	BGTF	$12D6
+11ff:	MOVB	T5, 52(FP)
+1202:	MOVB	ACCU, T5
+1204:	CMPUB	ACCU, #$00FF
+1206:	BNEF	$12C6
+1209:	MOVB	T5, #15
+120c:	MOVB	ACCU, T3
+120e:	CMPUB	ACCU, #$000F
+1210:	BGE	$1225
+1212:	ADDB	T3, #$00FF
+1215:	MOVB	ACCU, T3
+1217:	LEAX	ADDR, T6 + ACCU
+1219:	MOV	ACCU, #48
+121c:	MOVB	0(ADDR), ACCU
+121f:	MOVB	ACCU, T5
+1221:	CMPUB	ACCU, T3
+1223:	BGT	$1212
+1225:	MOVUB	ACCU, 57(FP)
+1228:	BEQ	$124E
+122a:	MOV	ACCU, 53(FP)
+122d:	CMPU	ACCU, #$0010
+1230:	BNE	$124E
+1232:	MOVB	ACCU, T3
+1234:	ADDB	ACCU, #$00FF
+1237:	MOVB	ACCU, ACCU
+1239:	LEAX	ADDR, T6 + ACCU
+123b:	MOV	ACCU, #88
+123e:	MOVB	0(ADDR), ACCU
+1241:	ADDB	T3, #$00FE
+1244:	MOVB	ACCU, T3
+1246:	LEAX	ADDR, T6 + ACCU
+1248:	MOV	ACCU, #48
+124b:	MOVB	0(ADDR), ACCU
+124e:	MOVB	ACCU, T1
+1250:	BNE	$12B7
+1252:	MOVUB	ACCU, 55(FP)
+1255:	BEQ	$1264
+1257:	ADDB	T3, #$00FF
+125a:	MOVB	ACCU, T3
+125c:	LEAX	ADDR, T6 + ACCU
+125e:	MOV	ACCU, #43
+1261:	MOVB	0(ADDR), ACCU
+1264:	MOVUB	T7, 51(FP)
+1267:	SUBR	T7, #$0010
+126b:	MOVB	T1, 50(FP)
+126e:	MOVB	ACCU, T3
+1270:	MOV	T8, ACCU
+1272:	MOV	ACCU, T7
+1274:	CMPS	ACCU, T8
+1276:	BGT	$12AB
+1278:	MOVB	T1, #0
+127b:	MOVB	ACCU, T3
+127d:	CMPUB	ACCU, #$0010
+127f:	BLE	$129B
+1281:	MOVB	ACCU, T3
+1283:	LEAX	ADDR, T6 + ACCU
+1285:	MOVB	T5, 0(ADDR)
+1288:	MOVB	ACCU, T1
+128a:	LEAX	ADDR, T6 + ACCU
+128c:	MOVB	0(ADDR), T5
+128f:	ADDB	T1, #$0001
+1292:	ADDB	T3, #$0001
+1295:	MOVB	ACCU, T3
+1297:	CMPUB	ACCU, #$0010
+1299:	BGT	$1281
+129b:	MOV	ADDR, T2
+129d:	MOVB	T5, 0(ADDR)
+12a0:	ADD	T2, #$0001
+12a4:	AND	T1, #$00FF
+12a8:	JUMPF	$0B49
+12ab:	ADDB	T3, #$00FF
+12ae:	MOVB	ACCU, T3
+12b0:	LEAX	ADDR, T6 + ACCU
+12b2:	MOVB	0(ADDR), T1
+12b5:	JUMP	$126E
+12b7:	ADDB	T3, #$00FF
+12ba:	MOVB	ACCU, T3
+12bc:	LEAX	ADDR, T6 + ACCU
+12be:	MOV	ACCU, #45
+12c1:	MOVB	0(ADDR), ACCU
+12c4:	JUMP	$1264
+12c6:	MOVB	ACCU, T5
+12c8:	SUBR	ACCU, #$0010
+12cc:	MOV	T5, ACCU
+12ce:	CMPUB	ACCU, T3
+12d0:	BGTF	$1212
+12d3:	JUMPF	$1225
+12d6:	MOV	T7, 53(FP)
+12d9:	MOV	ACCU, T7
+12db:	EXTRT	$00, inp_op_ext_u16 + 0
+12df:	MOVD	T13, ACCU
+12e1:	MOV	ACCU, T7
+12e3:	EXTRT	$00, inp_op_ext_u16 + 0
+12e7:	MOVD	T15, ACCU
+12e9:	MOVD	ACCU, T14
+12eb:	EXTRT	T13, inp_binop_mod_u32 + 0
+12ef:	MOVD	T16, ACCU
+12f1:	CMPS	ACCU, #$000A
+12f4:	BLE	$12FE
+12f6:	MOV	ACCU, T16
+12f8:	ADD	ACCU, #$0030
+12fc:	JUMP	$1304
+12fe:	MOV	ACCU, T16
+1300:	ADD	ACCU, #$0037
+1304:	MOV	T7, ACCU
+1306:	ADDB	T3, #$00FF
+1309:	MOVB	ACCU, T3
+130b:	LEAX	ADDR, T6 + ACCU
+130d:	MOVB	0(ADDR), T7
+1310:	MOVD	ACCU, T14
+1312:	EXTRT	T15, inp_binop_div_u32 + 0
+1316:	MOVD	T14, ACCU
+1318:	MOVD	ACCU, #$00000000
+131e:	EXTRT	T14, inp_op_cmp_u32 + 0
+1322:	BGT	$12E9
+1324:	JUMPF	$11FF
+1327:	MOVB	T1, #1
+132a:	MOVB	T3, #16
+132d:	MOVD	ACCU, T13
+132f:	EXTRT	$00, negaccu32 + 0
+1333:	MOVD	T14, ACCU
+1335:	MOVD	ACCU, #$00000000
+133b:	EXTRT	T14, inp_op_cmp_u32 + 0
+133f:	BGT	$12D6
+1341:	JUMPF	$11FF
+1344:	MOV	ACCU, #16
+1347:	MOV	53(FP), ACCU
+134a:	MOV	ADDR, T4
+134c:	MOV	T6, 0(ADDR)
+134f:	ADD	T4, #$0002
+1353:	LEA	T7, 0(FP)
+1357:	MOVB	T1, #10
+135a:	MOV	ACCU, T6
+135c:	BNEF	$1417
+135f:	MOVB	T3, 52(FP)
+1362:	MOVB	ACCU, T3
+1364:	CMPUB	ACCU, #$00FF
+1366:	BNEF	$1407
+1369:	MOVB	T3, #9
+136c:	MOVB	ACCU, T1
+136e:	CMPUB	ACCU, #$0009
+1370:	BGE	$1385
+1372:	ADDB	T1, #$00FF
+1375:	MOVB	ACCU, T1
+1377:	LEAX	ADDR, T7 + ACCU
+1379:	MOV	ACCU, #48
+137c:	MOVB	0(ADDR), ACCU
+137f:	MOVB	ACCU, T3
+1381:	CMPUB	ACCU, T1
+1383:	BGT	$1372
+1385:	MOVUB	ACCU, 57(FP)
+1388:	BEQ	$13AE
+138a:	MOV	ACCU, 53(FP)
+138d:	CMPU	ACCU, #$0010
+1390:	BNE	$13AE
+1392:	MOVB	ACCU, T1
+1394:	ADDB	ACCU, #$00FF
+1397:	MOVB	ACCU, ACCU
+1399:	LEAX	ADDR, T7 + ACCU
+139b:	MOV	ACCU, #88
+139e:	MOVB	0(ADDR), ACCU
+13a1:	ADDB	T1, #$00FE
+13a4:	MOVB	ACCU, T1
+13a6:	LEAX	ADDR, T7 + ACCU
+13a8:	MOV	ACCU, #48
+13ab:	MOVB	0(ADDR), ACCU
+13ae:	MOVUB	ACCU, 55(FP)
+13b1:	BEQ	$13C0
+13b3:	ADDB	T1, #$00FF
+13b6:	MOVB	ACCU, T1
+13b8:	LEAX	ADDR, T7 + ACCU
+13ba:	MOV	ACCU, #43
+13bd:	MOVB	0(ADDR), ACCU
+13c0:	MOVUB	T6, 51(FP)
+13c3:	SUBR	T6, #$000A
+13c7:	MOVB	T3, 50(FP)
+13ca:	MOVB	ACCU, T1
+13cc:	MOV	T8, ACCU
+13ce:	MOV	ACCU, T6
+13d0:	CMPS	ACCU, T8
+13d2:	BGT	$13FB
+13d4:	MOVB	T3, #0
+13d7:	MOVB	ACCU, T1
+13d9:	CMPUB	ACCU, #$000A
+13db:	BLEF	$103D
+13de:	MOVB	ACCU, T1
+13e0:	LEAX	ADDR, T7 + ACCU
+13e2:	MOVB	T5, 0(ADDR)
+13e5:	MOVB	ACCU, T3
+13e7:	LEAX	ADDR, T7 + ACCU
+13e9:	MOVB	0(ADDR), T5
+13ec:	ADDB	T3, #$0001
+13ef:	ADDB	T1, #$0001
+13f2:	MOVB	ACCU, T1
+13f4:	CMPUB	ACCU, #$000A
+13f6:	BGT	$13DE
+13f8:	JUMPF	$103D
+13fb:	ADDB	T1, #$00FF
+13fe:	MOVB	ACCU, T1
+1400:	LEAX	ADDR, T7 + ACCU
+1402:	MOVB	0(ADDR), T3
+1405:	JUMP	$13CA
+1407:	MOVB	ACCU, T3
+1409:	SUBR	ACCU, #$000A
+140d:	MOV	T3, ACCU
+140f:	CMPUB	ACCU, T1
+1411:	BGTF	$1372
+1414:	JUMPF	$1385
+1417:	MOV	T8, 53(FP)
+141a:	MOV	ACCU, T8
+141c:	MOV	T9, ACCU
+141e:	MOV	ACCU, T6
+1420:	MODU	ACCU, T9
+1422:	MOV	T10, ACCU
+1424:	CMPS	ACCU, #$000A
+1427:	BLE	$142F
+1429:	ADD	T10, #$0030
+142d:	JUMP	$1433
+142f:	ADD	T10, #$0037
+1433:	ADDB	T1, #$00FF
+1436:	MOVB	ACCU, T1
+1438:	LEAX	ADDR, T7 + ACCU
+143a:	MOVB	0(ADDR), T10
+143d:	MOV	ACCU, T6
+143f:	DIVU	ACCU, T8
+1441:	MOV	T6, ACCU
+1443:	BNE	$141E
+1445:	JUMPF	$135F
+1448:	MOV	ADDR, T4
+144a:	MOV	T6, 0(ADDR)
+144d:	ADD	T4, #$0002
+1451:	LEA	T7, 0(FP)
+1455:	MOVB	T1, #10
+1458:	MOV	ACCU, T6
+145a:	BNEF	$1515
+145d:	MOVB	T3, 52(FP)
+1460:	MOVB	ACCU, T3
+1462:	CMPUB	ACCU, #$00FF
+1464:	BNEF	$1505
+1467:	MOVB	T3, #9
+146a:	MOVB	ACCU, T1
+146c:	CMPUB	ACCU, #$0009
+146e:	BGE	$1483
+1470:	ADDB	T1, #$00FF
+1473:	MOVB	ACCU, T1
+1475:	LEAX	ADDR, T7 + ACCU
+1477:	MOV	ACCU, #48
+147a:	MOVB	0(ADDR), ACCU
+147d:	MOVB	ACCU, T3
+147f:	CMPUB	ACCU, T1
+1481:	BGT	$1470
+1483:	MOVUB	ACCU, 57(FP)
+1486:	BEQ	$14AC
+1488:	MOV	ACCU, 53(FP)
+148b:	CMPU	ACCU, #$0010
+148e:	BNE	$14AC
+1490:	MOVB	ACCU, T1
+1492:	ADDB	ACCU, #$00FF
+1495:	MOVB	ACCU, ACCU
+1497:	LEAX	ADDR, T7 + ACCU
+1499:	MOV	ACCU, #88
+149c:	MOVB	0(ADDR), ACCU
+149f:	ADDB	T1, #$00FE
+14a2:	MOVB	ACCU, T1
+14a4:	LEAX	ADDR, T7 + ACCU
+14a6:	MOV	ACCU, #48
+14a9:	MOVB	0(ADDR), ACCU
+14ac:	MOVUB	ACCU, 55(FP)
+14af:	BEQ	$14BE
+14b1:	ADDB	T1, #$00FF
+14b4:	MOVB	ACCU, T1
+14b6:	LEAX	ADDR, T7 + ACCU
+14b8:	MOV	ACCU, #43
+14bb:	MOVB	0(ADDR), ACCU
+14be:	MOVUB	T6, 51(FP)
+14c1:	SUBR	T6, #$000A
+14c5:	MOVB	T3, 50(FP)
+14c8:	MOVB	ACCU, T1
+14ca:	MOV	T8, ACCU
+14cc:	MOV	ACCU, T6
+14ce:	CMPS	ACCU, T8
+14d0:	BGT	$14F9
+14d2:	MOVB	T3, #0
+14d5:	MOVB	ACCU, T1
+14d7:	CMPUB	ACCU, #$000A
+14d9:	BLEF	$103D
+14dc:	MOVB	ACCU, T1
+14de:	LEAX	ADDR, T7 + ACCU
+14e0:	MOVB	T5, 0(ADDR)
+14e3:	MOVB	ACCU, T3
+14e5:	LEAX	ADDR, T7 + ACCU
+14e7:	MOVB	0(ADDR), T5
+14ea:	ADDB	T3, #$0001
+14ed:	ADDB	T1, #$0001
+14f0:	MOVB	ACCU, T1
+14f2:	CMPUB	ACCU, #$000A
+14f4:	BGT	$14DC
+14f6:	JUMPF	$103D
+14f9:	ADDB	T1, #$00FF
+14fc:	MOVB	ACCU, T1
+14fe:	LEAX	ADDR, T7 + ACCU
+1500:	MOVB	0(ADDR), T3
+1503:	JUMP	$14C8
+1505:	MOVB	ACCU, T3
+1507:	SUBR	ACCU, #$000A
+150b:	MOV	T3, ACCU
+150d:	CMPUB	ACCU, T1
+150f:	BGTF	$1470
+1512:	JUMPF	$1483
+1515:	MOV	T8, 53(FP)
+1518:	MOV	ACCU, T8
+151a:	MOV	T9, ACCU
+151c:	MOV	ACCU, T6
+151e:	MODU	ACCU, T9
+1520:	MOV	T10, ACCU
+1522:	CMPS	ACCU, #$000A
+1525:	BLE	$152D
+1527:	ADD	T10, #$0030
+152b:	JUMP	$1531
+152d:	ADD	T10, #$0037
+1531:	ADDB	T1, #$00FF
+1534:	MOVB	ACCU, T1
+1536:	LEAX	ADDR, T7 + ACCU
+1538:	MOVB	0(ADDR), T10
+153b:	MOV	ACCU, T6
+153d:	DIVU	ACCU, T8
+153f:	MOV	T6, ACCU
+1541:	BNE	$151C
+1543:	JUMPF	$145D
+1546:	MOV	ADDR, T4
+1548:	MOV	T6, 0(ADDR)
+154b:	ADD	T4, #$0002
+154f:	LEA	T7, 0(FP)
+1553:	MOV	ACCU, T6
+1555:	BLTF	$1661
+1558:	MOV	T8, ACCU
+155a:	MOVB	T1, #0
+155d:	MOVB	T3, #10
+1560:	MOV	ACCU, T6
+1562:	BNEF	$1630
+1565:	MOVB	T5, 52(FP)
+1568:	MOVB	ACCU, T5
+156a:	CMPUB	ACCU, #$00FF
+156c:	BNEF	$1620
+156f:	MOVB	T5, #9
+1572:	MOVB	ACCU, T3
+1574:	CMPUB	ACCU, #$0009
+1576:	BGE	$158B
+1578:	ADDB	T3, #$00FF
+157b:	MOVB	ACCU, T3
+157d:	LEAX	ADDR, T7 + ACCU
+157f:	MOV	ACCU, #48
+1582:	MOVB	0(ADDR), ACCU
+1585:	MOVB	ACCU, T5
+1587:	CMPUB	ACCU, T3
+1589:	BGT	$1578
+158b:	MOVUB	ACCU, 57(FP)
+158e:	BEQ	$15B4
+1590:	MOV	ACCU, 53(FP)
+1593:	CMPU	ACCU, #$0010
+1596:	BNE	$15B4
+1598:	MOVB	ACCU, T3
+159a:	ADDB	ACCU, #$00FF
+159d:	MOVB	ACCU, ACCU
+159f:	LEAX	ADDR, T7 + ACCU
+15a1:	MOV	ACCU, #88
+15a4:	MOVB	0(ADDR), ACCU
+15a7:	ADDB	T3, #$00FE
+15aa:	MOVB	ACCU, T3
+15ac:	LEAX	ADDR, T7 + ACCU
+15ae:	MOV	ACCU, #48
+15b1:	MOVB	0(ADDR), ACCU
+15b4:	MOVB	ACCU, T1
+15b6:	BNE	$1611
+15b8:	MOVUB	ACCU, 55(FP)
+15bb:	BEQ	$15CA
+15bd:	ADDB	T3, #$00FF
+15c0:	MOVB	ACCU, T3
+15c2:	LEAX	ADDR, T7 + ACCU
+15c4:	MOV	ACCU, #43
+15c7:	MOVB	0(ADDR), ACCU
+15ca:	MOVUB	T6, 51(FP)
+15cd:	SUBR	T6, #$000A
+15d1:	MOVB	T1, 50(FP)
+15d4:	MOVB	ACCU, T3
+15d6:	MOV	T8, ACCU
+15d8:	MOV	ACCU, T6
+15da:	CMPS	ACCU, T8
+15dc:	BGT	$1605
+15de:	MOVB	T1, #0
+15e1:	MOVB	ACCU, T3
+15e3:	CMPUB	ACCU, #$000A
+15e5:	BLEF	$129B
+15e8:	MOVB	ACCU, T3
+15ea:	LEAX	ADDR, T7 + ACCU
+15ec:	MOVB	T5, 0(ADDR)
+15ef:	MOVB	ACCU, T1
+15f1:	LEAX	ADDR, T7 + ACCU
+15f3:	MOVB	0(ADDR), T5
+15f6:	ADDB	T1, #$0001
+15f9:	ADDB	T3, #$0001
+15fc:	MOVB	ACCU, T3
+15fe:	CMPUB	ACCU, #$000A
+1600:	BGT	$15E8
+1602:	JUMPF	$129B
+1605:	ADDB	T3, #$00FF
+1608:	MOVB	ACCU, T3
+160a:	LEAX	ADDR, T7 + ACCU
+160c:	MOVB	0(ADDR), T1
+160f:	JUMP	$15D4
+1611:	ADDB	T3, #$00FF
+1614:	MOVB	ACCU, T3
+1616:	LEAX	ADDR, T7 + ACCU
+1618:	MOV	ACCU, #45
+161b:	MOVB	0(ADDR), ACCU
+161e:	JUMP	$15CA
+1620:	MOVB	ACCU, T5
+1622:	SUBR	ACCU, #$000A
+1626:	MOV	T5, ACCU
+1628:	CMPUB	ACCU, T3
+162a:	BGTF	$1578
+162d:	JUMPF	$158B
+1630:	MOV	T6, 53(FP)
+1633:	MOV	ACCU, T6
+1635:	MOV	T9, ACCU
+1637:	MOV	ACCU, T8
+1639:	MODU	ACCU, T9
+163b:	MOV	T10, ACCU
+163d:	CMPS	ACCU, #$000A
+1640:	BLE	$1648
+1642:	ADD	T10, #$0030
+1646:	JUMP	$164C
+1648:	ADD	T10, #$0037
+164c:	ADDB	T3, #$00FF
+164f:	MOVB	ACCU, T3
+1651:	LEAX	ADDR, T7 + ACCU
+1653:	MOVB	0(ADDR), T10
+1656:	MOV	ACCU, T8
+1658:	DIVU	ACCU, T6
+165a:	MOV	T8, ACCU
+165c:	BNE	$1637
+165e:	JUMPF	$1565
+1661:	MOVB	T1, #1
+1664:	MOVB	T3, #10
+1667:	NEG	ACCU
+1668:	MOV	T8, ACCU
+166a:	BNE	$1630
+166c:	JUMPF	$1565
+166f:	MOV	T6, #0
+1672:	MOV	ADDR, T2
+1674:	MOVB	T3, 0(ADDR)
+1677:	ADD	T2, #$0001
+167b:	MOVB	ACCU, T3
+167d:	CMPUB	ACCU, #$0030
+167f:	BGT	$16A3
+1681:	MOVB	ACCU, T3
+1683:	CMPUB	ACCU, #$0039
+1685:	BLT	$16A3
+1687:	MOVB	ACCU, T3
+1689:	MOV	T7, ACCU
+168b:	MOV	ADDR, T2
+168d:	MOVB	T3, 0(ADDR)
+1690:	ADD	T2, #$0001
+1694:	MUL	T6, #10
+1697:	ADD	T6, ACCU
+1699:	ADD	T6, #$FFD0
+169d:	MOVB	ACCU, T3
+169f:	CMPUB	ACCU, #$0030
+16a1:	BLE	$1681
+16a3:	MOVB	52(FP), T6
+16a6:	JUMPF	$0BBF
+16a9:	MOV	T6, #0
+16ac:	MOVB	ACCU, T3
+16ae:	CMPUB	ACCU, #$0030
+16b0:	BGT	$16D4
+16b2:	MOVB	ACCU, T3
+16b4:	CMPUB	ACCU, #$0039
+16b6:	BLT	$16D4
+16b8:	MOVB	ACCU, T3
+16ba:	MOV	T7, ACCU
+16bc:	MOV	ADDR, T2
+16be:	MOVB	T3, 0(ADDR)
+16c1:	ADD	T2, #$0001
+16c5:	MUL	T6, #10
+16c8:	ADD	T6, ACCU
+16ca:	ADD	T6, #$FFD0
+16ce:	MOVB	ACCU, T3
+16d0:	CMPUB	ACCU, #$0030
+16d2:	BLE	$16B2
+16d4:	MOVB	51(FP), T6
+16d7:	JUMPF	$0BB8
+16da:	MOV	ACCU, #1
+16dd:	MOVB	57(FP), ACCU
+16e0:	MOV	ADDR, T2
+16e2:	MOVB	T3, 0(ADDR)
+16e5:	JUMPF	$0B92
+16e8:	MOV	ACCU, #48
+16eb:	MOVB	50(FP), ACCU
+16ee:	MOV	ADDR, T2
+16f0:	MOVB	T3, 0(ADDR)
+16f3:	JUMPF	$0B92
+16f6:	MOV	ACCU, #1
+16f9:	MOVB	55(FP), ACCU
+16fc:	MOV	ADDR, T2
+16fe:	MOVB	T3, 0(ADDR)
+1701:	JUMPF	$0B92
+--------------------------------------------------------------------
+puts:
+1704:	ENTER	0, 2
+1708:	JSR	$170f
+170b:	RETURN	0, 2
+--------------------------------------------------------------------
+170f : a0 00 __ LDY #$00
+1711 : b1 0d __ LDA (P0),y
+1713 : f0 0b __ BEQ $1720
+1715 : 20 21 17 JSR $1721 ; (putpch + 0)
+1718 : e6 0d __ INC P0
+171a : d0 f3 __ BNE $170f
+171c : e6 0e __ INC P1
+171e : d0 ef __ BNE $170f
+1720 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1721 : ae ef 22 LDX $22ef ; (giocharmap + 0)
+1724 : e0 01 __ CPX #$01
+1726 : 90 22 __ BCC $174a
+1728 : c9 0a __ CMP #$0a
+172a : d0 02 __ BNE $172e
+172c : a9 0d __ LDA #$0d
+172e : e0 02 __ CPX #$02
+1730 : 90 18 __ BCC $174a
+1732 : c9 41 __ CMP #$41
+1734 : 90 14 __ BCC $174a
+1736 : c9 7b __ CMP #$7b
+1738 : b0 10 __ BCS $174a
+173a : c9 61 __ CMP #$61
+173c : b0 04 __ BCS $1742
+173e : c9 5b __ CMP #$5b
+1740 : b0 08 __ BCS $174a
+1742 : 49 20 __ EOR #$20
+1744 : e0 03 __ CPX #$03
+1746 : f0 02 __ BEQ $174a
+1748 : 29 df __ AND #$df
+174a : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+exit:
+175a:	ENTER	0, 2
+175e:	JSR	$1765
+1761:	RETURN	0, 2
+--------------------------------------------------------------------
+1765 : a5 0d __ LDA P0
+1767 : 85 1b __ STA ACCU + 0
+1769 : a5 0e __ LDA P1
+176b : 85 1c __ STA ACCU + 1
+176d : ae ee 22 LDX $22ee ; (spentry + 0)
+1770 : 9a __ __ TXS
+1771 : a9 4c __ LDA #$4c
+1773 : 85 54 __ STA $54
+1775 : a9 00 __ LDA #$00
+1777 : 85 13 __ STA P6
+1779 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1787 : b1 19 __ LDA (IP + 0),y
+1789 : c8 __ __ INY
+178a : aa __ __ TAX
+178b : b5 00 __ LDA $00,x
+178d : 85 03 __ STA $03
+178f : b5 01 __ LDA $01,x
+1791 : 85 04 __ STA $04
+1793 : b5 02 __ LDA $02,x
+1795 : 85 05 __ STA $05
+1797 : b5 03 __ LDA $03,x
+1799 : 85 06 __ STA $06
+179b : a5 05 __ LDA $05
+179d : 0a __ __ ASL
+179e : a5 06 __ LDA $06
+17a0 : 2a __ __ ROL
+17a1 : 85 08 __ STA $08
+17a3 : f0 06 __ BEQ $17ab
+17a5 : a5 05 __ LDA $05
+17a7 : 09 80 __ ORA #$80
+17a9 : 85 05 __ STA $05
+17ab : a5 1d __ LDA ACCU + 2
+17ad : 0a __ __ ASL
+17ae : a5 1e __ LDA ACCU + 3
+17b0 : 2a __ __ ROL
+17b1 : 85 07 __ STA $07
+17b3 : f0 06 __ BEQ $17bb
+17b5 : a5 1d __ LDA ACCU + 2
+17b7 : 09 80 __ ORA #$80
+17b9 : 85 1d __ STA ACCU + 2
+17bb : 60 __ __ RTS
+17bc : 06 1e __ ASL ACCU + 3
+17be : a5 07 __ LDA $07
+17c0 : 6a __ __ ROR
+17c1 : 85 1e __ STA ACCU + 3
+17c3 : b0 06 __ BCS $17cb
+17c5 : a5 1d __ LDA ACCU + 2
+17c7 : 29 7f __ AND #$7f
+17c9 : 85 1d __ STA ACCU + 2
+17cb : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+17cc : 38 __ __ SEC
+17cd : a5 07 __ LDA $07
+17cf : e5 08 __ SBC $08
+17d1 : f0 38 __ BEQ $180b
+17d3 : aa __ __ TAX
+17d4 : b0 25 __ BCS $17fb
+17d6 : e0 e9 __ CPX #$e9
+17d8 : b0 0e __ BCS $17e8
+17da : a5 08 __ LDA $08
+17dc : 85 07 __ STA $07
+17de : a9 00 __ LDA #$00
+17e0 : 85 1b __ STA ACCU + 0
+17e2 : 85 1c __ STA ACCU + 1
+17e4 : 85 1d __ STA ACCU + 2
+17e6 : f0 23 __ BEQ $180b
+17e8 : a5 1d __ LDA ACCU + 2
+17ea : 4a __ __ LSR
+17eb : 66 1c __ ROR ACCU + 1
+17ed : 66 1b __ ROR ACCU + 0
+17ef : e8 __ __ INX
+17f0 : d0 f8 __ BNE $17ea
+17f2 : 85 1d __ STA ACCU + 2
+17f4 : a5 08 __ LDA $08
+17f6 : 85 07 __ STA $07
+17f8 : 4c 0b 18 JMP $180b ; (faddsub + 63)
+17fb : e0 18 __ CPX #$18
+17fd : b0 33 __ BCS $1832
+17ff : a5 05 __ LDA $05
+1801 : 4a __ __ LSR
+1802 : 66 04 __ ROR $04
+1804 : 66 03 __ ROR $03
+1806 : ca __ __ DEX
+1807 : d0 f8 __ BNE $1801
+1809 : 85 05 __ STA $05
+180b : a5 1e __ LDA ACCU + 3
+180d : 29 80 __ AND #$80
+180f : 85 1e __ STA ACCU + 3
+1811 : 45 06 __ EOR $06
+1813 : 30 2d __ BMI $1842
+1815 : 18 __ __ CLC
+1816 : a5 1b __ LDA ACCU + 0
+1818 : 65 03 __ ADC $03
+181a : 85 1b __ STA ACCU + 0
+181c : a5 1c __ LDA ACCU + 1
+181e : 65 04 __ ADC $04
+1820 : 85 1c __ STA ACCU + 1
+1822 : a5 1d __ LDA ACCU + 2
+1824 : 65 05 __ ADC $05
+1826 : 85 1d __ STA ACCU + 2
+1828 : 90 08 __ BCC $1832
+182a : 66 1d __ ROR ACCU + 2
+182c : 66 1c __ ROR ACCU + 1
+182e : 66 1b __ ROR ACCU + 0
+1830 : e6 07 __ INC $07
+1832 : a5 07 __ LDA $07
+1834 : 4a __ __ LSR
+1835 : 05 1e __ ORA ACCU + 3
+1837 : 85 1e __ STA ACCU + 3
+1839 : b0 06 __ BCS $1841
+183b : a5 1d __ LDA ACCU + 2
+183d : 29 7f __ AND #$7f
+183f : 85 1d __ STA ACCU + 2
+1841 : 60 __ __ RTS
+1842 : 38 __ __ SEC
+1843 : a5 1b __ LDA ACCU + 0
+1845 : e5 03 __ SBC $03
+1847 : 85 1b __ STA ACCU + 0
+1849 : a5 1c __ LDA ACCU + 1
+184b : e5 04 __ SBC $04
+184d : 85 1c __ STA ACCU + 1
+184f : a5 1d __ LDA ACCU + 2
+1851 : e5 05 __ SBC $05
+1853 : 85 1d __ STA ACCU + 2
+1855 : b0 19 __ BCS $1870
+1857 : 38 __ __ SEC
+1858 : a9 00 __ LDA #$00
+185a : e5 1b __ SBC ACCU + 0
+185c : 85 1b __ STA ACCU + 0
+185e : a9 00 __ LDA #$00
+1860 : e5 1c __ SBC ACCU + 1
+1862 : 85 1c __ STA ACCU + 1
+1864 : a9 00 __ LDA #$00
+1866 : e5 1d __ SBC ACCU + 2
+1868 : 85 1d __ STA ACCU + 2
+186a : a5 1e __ LDA ACCU + 3
+186c : 49 80 __ EOR #$80
+186e : 85 1e __ STA ACCU + 3
+1870 : a5 1d __ LDA ACCU + 2
+1872 : 30 be __ BMI $1832
+1874 : 05 1c __ ORA ACCU + 1
+1876 : 05 1b __ ORA ACCU + 0
+1878 : f0 0f __ BEQ $1889
+187a : c6 07 __ DEC $07
+187c : f0 0b __ BEQ $1889
+187e : 06 1b __ ASL ACCU + 0
+1880 : 26 1c __ ROL ACCU + 1
+1882 : 26 1d __ ROL ACCU + 2
+1884 : 10 f4 __ BPL $187a
+1886 : 4c 32 18 JMP $1832 ; (faddsub + 102)
+1889 : a9 00 __ LDA #$00
+188b : 85 1b __ STA ACCU + 0
+188d : 85 1c __ STA ACCU + 1
+188f : 85 1d __ STA ACCU + 2
+1891 : 85 1e __ STA ACCU + 3
+1893 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1894 : a5 1b __ LDA ACCU + 0
+1896 : 05 1c __ ORA ACCU + 1
+1898 : 05 1d __ ORA ACCU + 2
+189a : d0 03 __ BNE $189f
+189c : 85 1e __ STA ACCU + 3
+189e : 60 __ __ RTS
+189f : a5 03 __ LDA $03
+18a1 : 05 04 __ ORA $04
+18a3 : 05 05 __ ORA $05
+18a5 : d0 09 __ BNE $18b0
+18a7 : 85 1b __ STA ACCU + 0
+18a9 : 85 1c __ STA ACCU + 1
+18ab : 85 1d __ STA ACCU + 2
+18ad : 85 1e __ STA ACCU + 3
+18af : 60 __ __ RTS
+18b0 : a9 00 __ LDA #$00
+18b2 : 85 09 __ STA $09
+18b4 : 85 0a __ STA $0a
+18b6 : 85 0b __ STA $0b
+18b8 : a4 1b __ LDY ACCU + 0
+18ba : a5 03 __ LDA $03
+18bc : d0 06 __ BNE $18c4
+18be : a5 04 __ LDA $04
+18c0 : f0 0a __ BEQ $18cc
+18c2 : d0 05 __ BNE $18c9
+18c4 : 20 04 19 JSR $1904 ; (fmul8 + 0)
+18c7 : a5 04 __ LDA $04
+18c9 : 20 04 19 JSR $1904 ; (fmul8 + 0)
+18cc : a5 05 __ LDA $05
+18ce : 20 04 19 JSR $1904 ; (fmul8 + 0)
+18d1 : 38 __ __ SEC
+18d2 : a5 0b __ LDA $0b
+18d4 : 30 06 __ BMI $18dc
+18d6 : 06 09 __ ASL $09
+18d8 : 26 0a __ ROL $0a
+18da : 2a __ __ ROL
+18db : 18 __ __ CLC
+18dc : 29 7f __ AND #$7f
+18de : 85 0b __ STA $0b
+18e0 : a5 1e __ LDA ACCU + 3
+18e2 : 45 06 __ EOR $06
+18e4 : 29 80 __ AND #$80
+18e6 : 85 1e __ STA ACCU + 3
+18e8 : a5 07 __ LDA $07
+18ea : e9 7e __ SBC #$7e
+18ec : 18 __ __ CLC
+18ed : 65 08 __ ADC $08
+18ef : 4a __ __ LSR
+18f0 : 05 1e __ ORA ACCU + 3
+18f2 : 85 1e __ STA ACCU + 3
+18f4 : a9 00 __ LDA #$00
+18f6 : 6a __ __ ROR
+18f7 : 05 0b __ ORA $0b
+18f9 : 85 1d __ STA ACCU + 2
+18fb : a5 0a __ LDA $0a
+18fd : 85 1c __ STA ACCU + 1
+18ff : a5 09 __ LDA $09
+1901 : 85 1b __ STA ACCU + 0
+1903 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1904 : 38 __ __ SEC
+1905 : 6a __ __ ROR
+1906 : 90 1e __ BCC $1926
+1908 : aa __ __ TAX
+1909 : 18 __ __ CLC
+190a : 98 __ __ TYA
+190b : 65 09 __ ADC $09
+190d : 85 09 __ STA $09
+190f : a5 0a __ LDA $0a
+1911 : 65 1c __ ADC ACCU + 1
+1913 : 85 0a __ STA $0a
+1915 : a5 0b __ LDA $0b
+1917 : 65 1d __ ADC ACCU + 2
+1919 : 6a __ __ ROR
+191a : 85 0b __ STA $0b
+191c : 8a __ __ TXA
+191d : 66 0a __ ROR $0a
+191f : 66 09 __ ROR $09
+1921 : 4a __ __ LSR
+1922 : f0 0d __ BEQ $1931
+1924 : b0 e2 __ BCS $1908
+1926 : 66 0b __ ROR $0b
+1928 : 66 0a __ ROR $0a
+192a : 66 09 __ ROR $09
+192c : 4a __ __ LSR
+192d : 90 f7 __ BCC $1926
+192f : d0 d7 __ BNE $1908
+1931 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1932 : a5 1b __ LDA ACCU + 0
+1934 : 05 1c __ ORA ACCU + 1
+1936 : 05 1d __ ORA ACCU + 2
+1938 : d0 03 __ BNE $193d
+193a : 85 1e __ STA ACCU + 3
+193c : 60 __ __ RTS
+193d : a5 1e __ LDA ACCU + 3
+193f : 45 06 __ EOR $06
+1941 : 29 80 __ AND #$80
+1943 : 85 1e __ STA ACCU + 3
+1945 : a9 00 __ LDA #$00
+1947 : 85 09 __ STA $09
+1949 : 85 0a __ STA $0a
+194b : 85 0b __ STA $0b
+194d : a2 18 __ LDX #$18
+194f : a5 1b __ LDA ACCU + 0
+1951 : c5 03 __ CMP $03
+1953 : a5 1c __ LDA ACCU + 1
+1955 : e5 04 __ SBC $04
+1957 : a5 1d __ LDA ACCU + 2
+1959 : e5 05 __ SBC $05
+195b : 90 13 __ BCC $1970
+195d : a5 1b __ LDA ACCU + 0
+195f : e5 03 __ SBC $03
+1961 : 85 1b __ STA ACCU + 0
+1963 : a5 1c __ LDA ACCU + 1
+1965 : e5 04 __ SBC $04
+1967 : 85 1c __ STA ACCU + 1
+1969 : a5 1d __ LDA ACCU + 2
+196b : e5 05 __ SBC $05
+196d : 85 1d __ STA ACCU + 2
+196f : 38 __ __ SEC
+1970 : 26 09 __ ROL $09
+1972 : 26 0a __ ROL $0a
+1974 : 26 0b __ ROL $0b
+1976 : ca __ __ DEX
+1977 : f0 0a __ BEQ $1983
+1979 : 06 1b __ ASL ACCU + 0
+197b : 26 1c __ ROL ACCU + 1
+197d : 26 1d __ ROL ACCU + 2
+197f : b0 dc __ BCS $195d
+1981 : 90 cc __ BCC $194f
+1983 : 38 __ __ SEC
+1984 : a5 0b __ LDA $0b
+1986 : 30 06 __ BMI $198e
+1988 : 06 09 __ ASL $09
+198a : 26 0a __ ROL $0a
+198c : 2a __ __ ROL
+198d : 18 __ __ CLC
+198e : 29 7f __ AND #$7f
+1990 : 85 0b __ STA $0b
+1992 : a5 08 __ LDA $08
+1994 : 49 7f __ EOR #$7f
+1996 : 65 07 __ ADC $07
+1998 : 38 __ __ SEC
+1999 : e9 01 __ SBC #$01
+199b : 4a __ __ LSR
+199c : 05 1e __ ORA ACCU + 3
+199e : 85 1e __ STA ACCU + 3
+19a0 : a9 00 __ LDA #$00
+19a2 : 6a __ __ ROR
+19a3 : 05 0b __ ORA $0b
+19a5 : 85 1d __ STA ACCU + 2
+19a7 : a5 0a __ LDA $0a
+19a9 : 85 1c __ STA ACCU + 1
+19ab : a5 09 __ LDA $09
+19ad : 85 1b __ STA ACCU + 0
+19af : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+19b0 : 38 __ __ SEC
+19b1 : a9 00 __ LDA #$00
+19b3 : e5 1b __ SBC ACCU + 0
+19b5 : 85 1b __ STA ACCU + 0
+19b7 : a9 00 __ LDA #$00
+19b9 : e5 1c __ SBC ACCU + 1
+19bb : 85 1c __ STA ACCU + 1
+19bd : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+19be : 38 __ __ SEC
+19bf : a9 00 __ LDA #$00
+19c1 : e5 03 __ SBC $03
+19c3 : 85 03 __ STA $03
+19c5 : a9 00 __ LDA #$00
+19c7 : e5 04 __ SBC $04
+19c9 : 85 04 __ STA $04
+19cb : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+19cc : a5 1c __ LDA ACCU + 1
+19ce : d0 31 __ BNE $1a01
+19d0 : a5 04 __ LDA $04
+19d2 : d0 1e __ BNE $19f2
+19d4 : 85 06 __ STA $06
+19d6 : a2 04 __ LDX #$04
+19d8 : 06 1b __ ASL ACCU + 0
+19da : 2a __ __ ROL
+19db : c5 03 __ CMP $03
+19dd : 90 02 __ BCC $19e1
+19df : e5 03 __ SBC $03
+19e1 : 26 1b __ ROL ACCU + 0
+19e3 : 2a __ __ ROL
+19e4 : c5 03 __ CMP $03
+19e6 : 90 02 __ BCC $19ea
+19e8 : e5 03 __ SBC $03
+19ea : 26 1b __ ROL ACCU + 0
+19ec : ca __ __ DEX
+19ed : d0 eb __ BNE $19da
+19ef : 85 05 __ STA $05
+19f1 : 60 __ __ RTS
+19f2 : a5 1b __ LDA ACCU + 0
+19f4 : 85 05 __ STA $05
+19f6 : a5 1c __ LDA ACCU + 1
+19f8 : 85 06 __ STA $06
+19fa : a9 00 __ LDA #$00
+19fc : 85 1b __ STA ACCU + 0
+19fe : 85 1c __ STA ACCU + 1
+1a00 : 60 __ __ RTS
+1a01 : a5 04 __ LDA $04
+1a03 : d0 1f __ BNE $1a24
+1a05 : a5 03 __ LDA $03
+1a07 : 30 1b __ BMI $1a24
+1a09 : a9 00 __ LDA #$00
+1a0b : 85 06 __ STA $06
+1a0d : a2 10 __ LDX #$10
+1a0f : 06 1b __ ASL ACCU + 0
+1a11 : 26 1c __ ROL ACCU + 1
+1a13 : 2a __ __ ROL
+1a14 : c5 03 __ CMP $03
+1a16 : 90 02 __ BCC $1a1a
+1a18 : e5 03 __ SBC $03
+1a1a : 26 1b __ ROL ACCU + 0
+1a1c : 26 1c __ ROL ACCU + 1
+1a1e : ca __ __ DEX
+1a1f : d0 f2 __ BNE $1a13
+1a21 : 85 05 __ STA $05
+1a23 : 60 __ __ RTS
+1a24 : a9 00 __ LDA #$00
+1a26 : 85 05 __ STA $05
+1a28 : 85 06 __ STA $06
+1a2a : 84 02 __ STY $02
+1a2c : a0 10 __ LDY #$10
+1a2e : 18 __ __ CLC
+1a2f : 26 1b __ ROL ACCU + 0
+1a31 : 26 1c __ ROL ACCU + 1
+1a33 : 26 05 __ ROL $05
+1a35 : 26 06 __ ROL $06
+1a37 : 38 __ __ SEC
+1a38 : a5 05 __ LDA $05
+1a3a : e5 03 __ SBC $03
+1a3c : aa __ __ TAX
+1a3d : a5 06 __ LDA $06
+1a3f : e5 04 __ SBC $04
+1a41 : 90 04 __ BCC $1a47
+1a43 : 86 05 __ STX $05
+1a45 : 85 06 __ STA $06
+1a47 : 88 __ __ DEY
+1a48 : d0 e5 __ BNE $1a2f
+1a4a : 26 1b __ ROL ACCU + 0
+1a4c : 26 1c __ ROL ACCU + 1
+1a4e : a4 02 __ LDY $02
+1a50 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1a51 : 20 ab 17 JSR $17ab ; (freg + 36)
+1a54 : a5 07 __ LDA $07
+1a56 : c9 7f __ CMP #$7f
+1a58 : b0 07 __ BCS $1a61
+1a5a : a9 00 __ LDA #$00
+1a5c : 85 1b __ STA ACCU + 0
+1a5e : 85 1c __ STA ACCU + 1
+1a60 : 60 __ __ RTS
+1a61 : 38 __ __ SEC
+1a62 : e9 8e __ SBC #$8e
+1a64 : 90 0a __ BCC $1a70
+1a66 : a9 ff __ LDA #$ff
+1a68 : 85 1b __ STA ACCU + 0
+1a6a : a9 7f __ LDA #$7f
+1a6c : 85 1c __ STA ACCU + 1
+1a6e : d0 08 __ BNE $1a78
+1a70 : aa __ __ TAX
+1a71 : 46 1d __ LSR ACCU + 2
+1a73 : 66 1c __ ROR ACCU + 1
+1a75 : e8 __ __ INX
+1a76 : d0 f9 __ BNE $1a71
+1a78 : 24 1e __ BIT ACCU + 3
+1a7a : 10 0e __ BPL $1a8a
+1a7c : 38 __ __ SEC
+1a7d : a9 00 __ LDA #$00
+1a7f : e5 1c __ SBC ACCU + 1
+1a81 : 85 1b __ STA ACCU + 0
+1a83 : a9 00 __ LDA #$00
+1a85 : e5 1d __ SBC ACCU + 2
+1a87 : 85 1c __ STA ACCU + 1
+1a89 : 60 __ __ RTS
+1a8a : a5 1c __ LDA ACCU + 1
+1a8c : 85 1b __ STA ACCU + 0
+1a8e : a5 1d __ LDA ACCU + 2
+1a90 : 85 1c __ STA ACCU + 1
+1a92 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1a93 : 24 1c __ BIT ACCU + 1
+1a95 : 30 03 __ BMI $1a9a
+1a97 : 4c b1 1a JMP $1ab1 ; (uint16_to_float + 0)
+1a9a : 38 __ __ SEC
+1a9b : a9 00 __ LDA #$00
+1a9d : e5 1b __ SBC ACCU + 0
+1a9f : 85 1b __ STA ACCU + 0
+1aa1 : a9 00 __ LDA #$00
+1aa3 : e5 1c __ SBC ACCU + 1
+1aa5 : 85 1c __ STA ACCU + 1
+1aa7 : 20 b1 1a JSR $1ab1 ; (uint16_to_float + 0)
+1aaa : a5 1e __ LDA ACCU + 3
+1aac : 09 80 __ ORA #$80
+1aae : 85 1e __ STA ACCU + 3
+1ab0 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1ab1 : a5 1b __ LDA ACCU + 0
+1ab3 : 05 1c __ ORA ACCU + 1
+1ab5 : d0 05 __ BNE $1abc
+1ab7 : 85 1d __ STA ACCU + 2
+1ab9 : 85 1e __ STA ACCU + 3
+1abb : 60 __ __ RTS
+1abc : a2 8e __ LDX #$8e
+1abe : a5 1c __ LDA ACCU + 1
+1ac0 : 30 06 __ BMI $1ac8
+1ac2 : ca __ __ DEX
+1ac3 : 06 1b __ ASL ACCU + 0
+1ac5 : 2a __ __ ROL
+1ac6 : 10 fa __ BPL $1ac2
+1ac8 : 29 7f __ AND #$7f
+1aca : 85 1d __ STA ACCU + 2
+1acc : a5 1b __ LDA ACCU + 0
+1ace : 85 1c __ STA ACCU + 1
+1ad0 : 8a __ __ TXA
+1ad1 : 4a __ __ LSR
+1ad2 : 85 1e __ STA ACCU + 3
+1ad4 : a9 00 __ LDA #$00
+1ad6 : 85 1b __ STA ACCU + 0
+1ad8 : 6a __ __ ROR
+1ad9 : 05 1d __ ORA ACCU + 2
+1adb : 85 1d __ STA ACCU + 2
+1add : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1ade : 38 __ __ SEC
+1adf : a9 00 __ LDA #$00
+1ae1 : e5 1b __ SBC ACCU + 0
+1ae3 : 85 1b __ STA ACCU + 0
+1ae5 : a9 00 __ LDA #$00
+1ae7 : e5 1c __ SBC ACCU + 1
+1ae9 : 85 1c __ STA ACCU + 1
+1aeb : a9 00 __ LDA #$00
+1aed : e5 1d __ SBC ACCU + 2
+1aef : 85 1d __ STA ACCU + 2
+1af1 : a9 00 __ LDA #$00
+1af3 : e5 1e __ SBC ACCU + 3
+1af5 : 85 1e __ STA ACCU + 3
+1af7 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1af8 : 84 02 __ STY $02
+1afa : a9 00 __ LDA #$00
+1afc : 85 07 __ STA $07
+1afe : 85 08 __ STA $08
+1b00 : 85 09 __ STA $09
+1b02 : 85 0a __ STA $0a
+1b04 : a0 20 __ LDY #$20
+1b06 : 18 __ __ CLC
+1b07 : 26 1b __ ROL ACCU + 0
+1b09 : 26 1c __ ROL ACCU + 1
+1b0b : 26 1d __ ROL ACCU + 2
+1b0d : 26 1e __ ROL ACCU + 3
+1b0f : 26 07 __ ROL $07
+1b11 : 26 08 __ ROL $08
+1b13 : 26 09 __ ROL $09
+1b15 : 26 0a __ ROL $0a
+1b17 : a5 07 __ LDA $07
+1b19 : c5 03 __ CMP $03
+1b1b : a5 08 __ LDA $08
+1b1d : e5 04 __ SBC $04
+1b1f : a5 09 __ LDA $09
+1b21 : e5 05 __ SBC $05
+1b23 : a5 0a __ LDA $0a
+1b25 : e5 06 __ SBC $06
+1b27 : 90 18 __ BCC $1b41
+1b29 : a5 07 __ LDA $07
+1b2b : e5 03 __ SBC $03
+1b2d : 85 07 __ STA $07
+1b2f : a5 08 __ LDA $08
+1b31 : e5 04 __ SBC $04
+1b33 : 85 08 __ STA $08
+1b35 : a5 09 __ LDA $09
+1b37 : e5 05 __ SBC $05
+1b39 : 85 09 __ STA $09
+1b3b : a5 0a __ LDA $0a
+1b3d : e5 06 __ SBC $06
+1b3f : 85 0a __ STA $0a
+1b41 : 88 __ __ DEY
+1b42 : d0 c3 __ BNE $1b07
+1b44 : 26 1b __ ROL ACCU + 0
+1b46 : 26 1c __ ROL ACCU + 1
+1b48 : 26 1d __ ROL ACCU + 2
+1b4a : 26 1e __ ROL ACCU + 3
+1b4c : a4 02 __ LDY $02
+1b4e : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1b4f : a9 00 __ LDA #$00
+1b51 : 85 1d __ STA ACCU + 2
+1b53 : 85 1e __ STA ACCU + 3
+1b55 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1b56 : b5 00 __ LDA $00,x
+1b58 : 85 03 __ STA $03
+1b5a : b5 01 __ LDA $01,x
+1b5c : 85 04 __ STA $04
+1b5e : b5 02 __ LDA $02,x
+1b60 : 85 05 __ STA $05
+1b62 : b5 03 __ LDA $03,x
+1b64 : 85 06 __ STA $06
+1b66 : 20 f8 1a JSR $1af8 ; (divmod32 + 0)
+1b69 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1b6a : b5 00 __ LDA $00,x
+1b6c : 85 03 __ STA $03
+1b6e : b5 01 __ LDA $01,x
+1b70 : 85 04 __ STA $04
+1b72 : b5 02 __ LDA $02,x
+1b74 : 85 05 __ STA $05
+1b76 : b5 03 __ LDA $03,x
+1b78 : 85 06 __ STA $06
+1b7a : 20 f8 1a JSR $1af8 ; (divmod32 + 0)
+1b7d : a5 07 __ LDA $07
+1b7f : 85 1b __ STA ACCU + 0
+1b81 : a5 08 __ LDA $08
+1b83 : 85 1c __ STA ACCU + 1
+1b85 : a5 09 __ LDA $09
+1b87 : 85 1d __ STA ACCU + 2
+1b89 : a5 0a __ LDA $0a
+1b8b : 85 1e __ STA ACCU + 3
+1b8d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1b8e : b5 03 __ LDA $03,x
+1b90 : c5 1e __ CMP ACCU + 3
+1b92 : d0 20 __ BNE $1bb4
+1b94 : b5 02 __ LDA $02,x
+1b96 : c5 1d __ CMP ACCU + 2
+1b98 : d0 1a __ BNE $1bb4
+1b9a : b5 01 __ LDA $01,x
+1b9c : c5 1c __ CMP ACCU + 1
+1b9e : d0 14 __ BNE $1bb4
+1ba0 : b5 00 __ LDA $00,x
+1ba2 : c5 1b __ CMP ACCU + 0
+1ba4 : d0 0e __ BNE $1bb4
+1ba6 : a9 00 __ LDA #$00
+1ba8 : 85 1b __ STA ACCU + 0
+1baa : 85 1c __ STA ACCU + 1
+1bac : 60 __ __ RTS
+1bad : a9 ff __ LDA #$ff
+1baf : 85 1b __ STA ACCU + 0
+1bb1 : 85 1c __ STA ACCU + 1
+1bb3 : 60 __ __ RTS
+1bb4 : 90 f7 __ BCC $1bad
+1bb6 : a9 01 __ LDA #$01
+1bb8 : 85 1b __ STA ACCU + 0
+1bba : a9 00 __ LDA #$00
+1bbc : 85 1c __ STA ACCU + 1
+1bbe : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1bbf : a5 1e __ LDA ACCU + 3
+1bc1 : 49 80 __ EOR #$80
+1bc3 : 85 1e __ STA ACCU + 3
+1bc5 : b5 03 __ LDA $03,x
+1bc7 : 49 80 __ EOR #$80
+1bc9 : c5 1e __ CMP ACCU + 3
+1bcb : d0 20 __ BNE $1bed
+1bcd : b5 02 __ LDA $02,x
+1bcf : c5 1d __ CMP ACCU + 2
+1bd1 : d0 1a __ BNE $1bed
+1bd3 : b5 01 __ LDA $01,x
+1bd5 : c5 1c __ CMP ACCU + 1
+1bd7 : d0 14 __ BNE $1bed
+1bd9 : b5 00 __ LDA $00,x
+1bdb : c5 1b __ CMP ACCU + 0
+1bdd : d0 0e __ BNE $1bed
+1bdf : a9 00 __ LDA #$00
+1be1 : 85 1b __ STA ACCU + 0
+1be3 : 85 1c __ STA ACCU + 1
+1be5 : 60 __ __ RTS
+1be6 : a9 ff __ LDA #$ff
+1be8 : 85 1b __ STA ACCU + 0
+1bea : 85 1c __ STA ACCU + 1
+1bec : 60 __ __ RTS
+1bed : 90 f7 __ BCC $1be6
+1bef : a9 01 __ LDA #$01
+1bf1 : 85 1b __ STA ACCU + 0
+1bf3 : a9 00 __ LDA #$00
+1bf5 : 85 1c __ STA ACCU + 1
+1bf7 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1bf8 : a9 4c __ LDA #$4c
+1bfa : 85 54 __ STA $54
+1bfc : a9 00 __ LDA #$00
+1bfe : 85 13 __ STA P6
+1c00 : a9 19 __ LDA #$19
+1c02 : 85 16 __ STA P9
+1c04 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1c05 : b1 19 __ LDA (IP + 0),y
+1c07 : aa __ __ TAX
+1c08 : c8 __ __ INY
+1c09 : b1 19 __ LDA (IP + 0),y
+1c0b : 95 00 __ STA $00,x
+1c0d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1c10 : b1 19 __ LDA (IP + 0),y
+1c12 : aa __ __ TAX
+1c13 : c8 __ __ INY
+1c14 : b1 19 __ LDA (IP + 0),y
+1c16 : 95 00 __ STA $00,x
+1c18 : a9 00 __ LDA #$00
+1c1a : 95 01 __ STA $01,x
+1c1c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1c1f : b1 19 __ LDA (IP + 0),y
+1c21 : aa __ __ TAX
+1c22 : c8 __ __ INY
+1c23 : b1 19 __ LDA (IP + 0),y
+1c25 : 95 00 __ STA $00,x
+1c27 : a9 ff __ LDA #$ff
+1c29 : 95 01 __ STA $01,x
+1c2b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1c2e : b1 19 __ LDA (IP + 0),y
+1c30 : aa __ __ TAX
+1c31 : c8 __ __ INY
+1c32 : b1 19 __ LDA (IP + 0),y
+1c34 : 95 00 __ STA $00,x
+1c36 : c8 __ __ INY
+1c37 : b1 19 __ LDA (IP + 0),y
+1c39 : 95 01 __ STA $01,x
+1c3b : c8 __ __ INY
+1c3c : b1 19 __ LDA (IP + 0),y
+1c3e : 95 02 __ STA $02,x
+1c40 : c8 __ __ INY
+1c41 : b1 19 __ LDA (IP + 0),y
+1c43 : 95 03 __ STA $03,x
+1c45 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1c48 : b1 19 __ LDA (IP + 0),y
+1c4a : aa __ __ TAX
+1c4b : b5 00 __ LDA $00,x
+1c4d : 85 1b __ STA ACCU + 0
+1c4f : a9 00 __ LDA #$00
+1c51 : 85 1c __ STA ACCU + 1
+1c53 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1c56 : b1 19 __ LDA (IP + 0),y
+1c58 : aa __ __ TAX
+1c59 : a5 1b __ LDA ACCU + 0
+1c5b : 95 00 __ STA $00,x
+1c5d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1c60 : b1 19 __ LDA (IP + 0),y
+1c62 : aa __ __ TAX
+1c63 : b5 00 __ LDA $00,x
+1c65 : 85 1b __ STA ACCU + 0
+1c67 : b5 01 __ LDA $01,x
+1c69 : 85 1c __ STA ACCU + 1
+1c6b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1c6e : b1 19 __ LDA (IP + 0),y
+1c70 : aa __ __ TAX
+1c71 : a5 1b __ LDA ACCU + 0
+1c73 : 95 00 __ STA $00,x
+1c75 : a5 1c __ LDA ACCU + 1
+1c77 : 95 01 __ STA $01,x
+1c79 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1c7c : b1 19 __ LDA (IP + 0),y
+1c7e : aa __ __ TAX
+1c7f : b5 00 __ LDA $00,x
+1c81 : 85 1f __ STA ADDR + 0
+1c83 : b5 01 __ LDA $01,x
+1c85 : 85 20 __ STA ADDR + 1
+1c87 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1c8a : b1 19 __ LDA (IP + 0),y
+1c8c : aa __ __ TAX
+1c8d : b5 00 __ LDA $00,x
+1c8f : 85 1b __ STA ACCU + 0
+1c91 : b5 01 __ LDA $01,x
+1c93 : 85 1c __ STA ACCU + 1
+1c95 : b5 02 __ LDA $02,x
+1c97 : 85 1d __ STA ACCU + 2
+1c99 : b5 03 __ LDA $03,x
+1c9b : 85 1e __ STA ACCU + 3
+1c9d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1ca0 : b1 19 __ LDA (IP + 0),y
+1ca2 : aa __ __ TAX
+1ca3 : a5 1b __ LDA ACCU + 0
+1ca5 : 95 00 __ STA $00,x
+1ca7 : a5 1c __ LDA ACCU + 1
+1ca9 : 95 01 __ STA $01,x
+1cab : a5 1d __ LDA ACCU + 2
+1cad : 95 02 __ STA $02,x
+1caf : a5 1e __ LDA ACCU + 3
+1cb1 : 95 03 __ STA $03,x
+1cb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1cb6 : b1 19 __ LDA (IP + 0),y
+1cb8 : 85 1f __ STA ADDR + 0
+1cba : c8 __ __ INY
+1cbb : b1 19 __ LDA (IP + 0),y
+1cbd : 85 20 __ STA ADDR + 1
+1cbf : c8 __ __ INY
+1cc0 : b1 19 __ LDA (IP + 0),y
+1cc2 : aa __ __ TAX
+1cc3 : 84 02 __ STY $02
+1cc5 : a0 00 __ LDY #$00
+1cc7 : b1 1f __ LDA (ADDR + 0),y
+1cc9 : 95 00 __ STA $00,x
+1ccb : c8 __ __ INY
+1ccc : b1 1f __ LDA (ADDR + 0),y
+1cce : 95 01 __ STA $01,x
+1cd0 : c8 __ __ INY
+1cd1 : b1 1f __ LDA (ADDR + 0),y
+1cd3 : 95 02 __ STA $02,x
+1cd5 : c8 __ __ INY
+1cd6 : b1 1f __ LDA (ADDR + 0),y
+1cd8 : 95 03 __ STA $03,x
+1cda : a4 02 __ LDY $02
+1cdc : 4c 50 08 JMP $0850 ; (startup + 79)
+1cdf : b1 19 __ LDA (IP + 0),y
+1ce1 : aa __ __ TAX
+1ce2 : c8 __ __ INY
+1ce3 : b1 19 __ LDA (IP + 0),y
+1ce5 : 84 02 __ STY $02
+1ce7 : a8 __ __ TAY
+1ce8 : 4c c7 1c JMP $1cc7 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1ceb : b1 19 __ LDA (IP + 0),y
+1ced : aa __ __ TAX
+1cee : c8 __ __ INY
+1cef : b1 19 __ LDA (IP + 0),y
+1cf1 : 95 00 __ STA $00,x
+1cf3 : c8 __ __ INY
+1cf4 : b1 19 __ LDA (IP + 0),y
+1cf6 : 95 01 __ STA $01,x
+1cf8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1cfb : b1 19 __ LDA (IP + 0),y
+1cfd : aa __ __ TAX
+1cfe : 18 __ __ CLC
+1cff : b5 00 __ LDA $00,x
+1d01 : 65 1b __ ADC ACCU + 0
+1d03 : 85 1f __ STA ADDR + 0
+1d05 : b5 01 __ LDA $01,x
+1d07 : 65 1c __ ADC ACCU + 1
+1d09 : 85 20 __ STA ADDR + 1
+1d0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1d0e : b1 19 __ LDA (IP + 0),y
+1d10 : aa __ __ TAX
+1d11 : c8 __ __ INY
+1d12 : b1 19 __ LDA (IP + 0),y
+1d14 : 84 02 __ STY $02
+1d16 : a8 __ __ TAY
+1d17 : b1 25 __ LDA (FP + 0),y
+1d19 : 95 00 __ STA $00,x
+1d1b : a4 02 __ LDY $02
+1d1d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1d20 : b1 19 __ LDA (IP + 0),y
+1d22 : aa __ __ TAX
+1d23 : c8 __ __ INY
+1d24 : b1 19 __ LDA (IP + 0),y
+1d26 : 84 02 __ STY $02
+1d28 : a8 __ __ TAY
+1d29 : b1 25 __ LDA (FP + 0),y
+1d2b : 95 00 __ STA $00,x
+1d2d : a9 00 __ LDA #$00
+1d2f : 95 01 __ STA $01,x
+1d31 : a4 02 __ LDY $02
+1d33 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1d36 : b1 19 __ LDA (IP + 0),y
+1d38 : aa __ __ TAX
+1d39 : c8 __ __ INY
+1d3a : b1 19 __ LDA (IP + 0),y
+1d3c : 84 02 __ STY $02
+1d3e : a8 __ __ TAY
+1d3f : b1 25 __ LDA (FP + 0),y
+1d41 : 95 00 __ STA $00,x
+1d43 : c8 __ __ INY
+1d44 : b1 25 __ LDA (FP + 0),y
+1d46 : 95 01 __ STA $01,x
+1d48 : a4 02 __ LDY $02
+1d4a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1d4d : b1 19 __ LDA (IP + 0),y
+1d4f : aa __ __ TAX
+1d50 : c8 __ __ INY
+1d51 : b1 19 __ LDA (IP + 0),y
+1d53 : 84 02 __ STY $02
+1d55 : a8 __ __ TAY
+1d56 : b5 00 __ LDA $00,x
+1d58 : 91 25 __ STA (FP + 0),y
+1d5a : a4 02 __ LDY $02
+1d5c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1d5f : b1 19 __ LDA (IP + 0),y
+1d61 : aa __ __ TAX
+1d62 : c8 __ __ INY
+1d63 : b1 19 __ LDA (IP + 0),y
+1d65 : 84 02 __ STY $02
+1d67 : a8 __ __ TAY
+1d68 : b5 00 __ LDA $00,x
+1d6a : 91 25 __ STA (FP + 0),y
+1d6c : c8 __ __ INY
+1d6d : b5 01 __ LDA $01,x
+1d6f : 91 25 __ STA (FP + 0),y
+1d71 : a4 02 __ LDY $02
+1d73 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1d76 : b1 19 __ LDA (IP + 0),y
+1d78 : aa __ __ TAX
+1d79 : c8 __ __ INY
+1d7a : 18 __ __ CLC
+1d7b : b1 19 __ LDA (IP + 0),y
+1d7d : 65 25 __ ADC FP + 0
+1d7f : 95 00 __ STA $00,x
+1d81 : c8 __ __ INY
+1d82 : b1 19 __ LDA (IP + 0),y
+1d84 : 65 26 __ ADC FP + 1
+1d86 : 95 01 __ STA $01,x
+1d88 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1d8b : b1 19 __ LDA (IP + 0),y
+1d8d : aa __ __ TAX
+1d8e : c8 __ __ INY
+1d8f : b1 19 __ LDA (IP + 0),y
+1d91 : 84 02 __ STY $02
+1d93 : a8 __ __ TAY
+1d94 : b5 00 __ LDA $00,x
+1d96 : 91 23 __ STA (SP + 0),y
+1d98 : c8 __ __ INY
+1d99 : b5 01 __ LDA $01,x
+1d9b : 91 23 __ STA (SP + 0),y
+1d9d : a4 02 __ LDY $02
+1d9f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1da2 : b1 19 __ LDA (IP + 0),y
+1da4 : aa __ __ TAX
+1da5 : c8 __ __ INY
+1da6 : b1 19 __ LDA (IP + 0),y
+1da8 : 84 02 __ STY $02
+1daa : a8 __ __ TAY
+1dab : b5 00 __ LDA $00,x
+1dad : 91 23 __ STA (SP + 0),y
+1daf : c8 __ __ INY
+1db0 : b5 01 __ LDA $01,x
+1db2 : 91 23 __ STA (SP + 0),y
+1db4 : c8 __ __ INY
+1db5 : b5 02 __ LDA $02,x
+1db7 : 91 23 __ STA (SP + 0),y
+1db9 : c8 __ __ INY
+1dba : b5 03 __ LDA $03,x
+1dbc : 91 23 __ STA (SP + 0),y
+1dbe : a4 02 __ LDY $02
+1dc0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1dc3 : b1 19 __ LDA (IP + 0),y
+1dc5 : 85 1f __ STA ADDR + 0
+1dc7 : c8 __ __ INY
+1dc8 : b1 19 __ LDA (IP + 0),y
+1dca : 85 20 __ STA ADDR + 1
+1dcc : c8 __ __ INY
+1dcd : b1 19 __ LDA (IP + 0),y
+1dcf : aa __ __ TAX
+1dd0 : 84 02 __ STY $02
+1dd2 : a0 00 __ LDY #$00
+1dd4 : b1 1f __ LDA (ADDR + 0),y
+1dd6 : 95 00 __ STA $00,x
+1dd8 : a4 02 __ LDY $02
+1dda : 4c 50 08 JMP $0850 ; (startup + 79)
+1ddd : b1 19 __ LDA (IP + 0),y
+1ddf : aa __ __ TAX
+1de0 : c8 __ __ INY
+1de1 : b1 19 __ LDA (IP + 0),y
+1de3 : 84 02 __ STY $02
+1de5 : a8 __ __ TAY
+1de6 : 4c d4 1d JMP $1dd4 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1de9 : b1 19 __ LDA (IP + 0),y
+1deb : 85 1f __ STA ADDR + 0
+1ded : c8 __ __ INY
+1dee : b1 19 __ LDA (IP + 0),y
+1df0 : 85 20 __ STA ADDR + 1
+1df2 : c8 __ __ INY
+1df3 : b1 19 __ LDA (IP + 0),y
+1df5 : aa __ __ TAX
+1df6 : 84 02 __ STY $02
+1df8 : a0 00 __ LDY #$00
+1dfa : b1 1f __ LDA (ADDR + 0),y
+1dfc : 95 00 __ STA $00,x
+1dfe : c8 __ __ INY
+1dff : b1 1f __ LDA (ADDR + 0),y
+1e01 : 95 01 __ STA $01,x
+1e03 : a4 02 __ LDY $02
+1e05 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e08 : b1 19 __ LDA (IP + 0),y
+1e0a : aa __ __ TAX
+1e0b : c8 __ __ INY
+1e0c : b1 19 __ LDA (IP + 0),y
+1e0e : 84 02 __ STY $02
+1e10 : a8 __ __ TAY
+1e11 : 4c fa 1d JMP $1dfa ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1e14 : b1 19 __ LDA (IP + 0),y
+1e16 : 85 1f __ STA ADDR + 0
+1e18 : c8 __ __ INY
+1e19 : b1 19 __ LDA (IP + 0),y
+1e1b : 85 20 __ STA ADDR + 1
+1e1d : c8 __ __ INY
+1e1e : b1 19 __ LDA (IP + 0),y
+1e20 : aa __ __ TAX
+1e21 : 84 02 __ STY $02
+1e23 : a0 00 __ LDY #$00
+1e25 : b5 00 __ LDA $00,x
+1e27 : 91 1f __ STA (ADDR + 0),y
+1e29 : a4 02 __ LDY $02
+1e2b : 4c 50 08 JMP $0850 ; (startup + 79)
+1e2e : b1 19 __ LDA (IP + 0),y
+1e30 : aa __ __ TAX
+1e31 : c8 __ __ INY
+1e32 : b1 19 __ LDA (IP + 0),y
+1e34 : 84 02 __ STY $02
+1e36 : a8 __ __ TAY
+1e37 : 4c 25 1e JMP $1e25 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1e3a : b1 19 __ LDA (IP + 0),y
+1e3c : aa __ __ TAX
+1e3d : 18 __ __ CLC
+1e3e : a5 1b __ LDA ACCU + 0
+1e40 : 75 00 __ ADC $00,x
+1e42 : 85 1b __ STA ACCU + 0
+1e44 : a5 1c __ LDA ACCU + 1
+1e46 : 75 01 __ ADC $01,x
+1e48 : 85 1c __ STA ACCU + 1
+1e4a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1e4d : b1 19 __ LDA (IP + 0),y
+1e4f : aa __ __ TAX
+1e50 : 38 __ __ SEC
+1e51 : a5 1b __ LDA ACCU + 0
+1e53 : f5 00 __ SBC $00,x
+1e55 : 85 1b __ STA ACCU + 0
+1e57 : a5 1c __ LDA ACCU + 1
+1e59 : f5 01 __ SBC $01,x
+1e5b : 85 1c __ STA ACCU + 1
+1e5d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1e60 : b1 19 __ LDA (IP + 0),y
+1e62 : aa __ __ TAX
+1e63 : b5 00 __ LDA $00,x
+1e65 : 85 03 __ STA $03
+1e67 : b5 01 __ LDA $01,x
+1e69 : 85 04 __ STA $04
+1e6b : 20 cc 19 JSR $19cc ; (divmod + 0)
+1e6e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1e71 : b1 19 __ LDA (IP + 0),y
+1e73 : aa __ __ TAX
+1e74 : b5 00 __ LDA $00,x
+1e76 : 85 03 __ STA $03
+1e78 : b5 01 __ LDA $01,x
+1e7a : 85 04 __ STA $04
+1e7c : 20 cc 19 JSR $19cc ; (divmod + 0)
+1e7f : a5 05 __ LDA $05
+1e81 : 85 1b __ STA ACCU + 0
+1e83 : a5 06 __ LDA $06
+1e85 : 85 1c __ STA ACCU + 1
+1e87 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1e8a : b1 19 __ LDA (IP + 0),y
+1e8c : aa __ __ TAX
+1e8d : b5 00 __ LDA $00,x
+1e8f : 85 03 __ STA $03
+1e91 : b5 01 __ LDA $01,x
+1e93 : 85 04 __ STA $04
+1e95 : 24 1c __ BIT ACCU + 1
+1e97 : 10 10 __ BPL $1ea9
+1e99 : 20 b0 19 JSR $19b0 ; (negaccu + 0)
+1e9c : 24 04 __ BIT $04
+1e9e : 10 10 __ BPL $1eb0
+1ea0 : 20 be 19 JSR $19be ; (negtmp + 0)
+1ea3 : 20 cc 19 JSR $19cc ; (divmod + 0)
+1ea6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ea9 : 24 04 __ BIT $04
+1eab : 10 f6 __ BPL $1ea3
+1ead : 20 be 19 JSR $19be ; (negtmp + 0)
+1eb0 : 20 cc 19 JSR $19cc ; (divmod + 0)
+1eb3 : 20 b0 19 JSR $19b0 ; (negaccu + 0)
+1eb6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1eb9 : b1 19 __ LDA (IP + 0),y
+1ebb : aa __ __ TAX
+1ebc : b5 00 __ LDA $00,x
+1ebe : 85 03 __ STA $03
+1ec0 : b5 01 __ LDA $01,x
+1ec2 : 85 04 __ STA $04
+1ec4 : 24 1c __ BIT ACCU + 1
+1ec6 : 10 18 __ BPL $1ee0
+1ec8 : 20 b0 19 JSR $19b0 ; (negaccu + 0)
+1ecb : 24 04 __ BIT $04
+1ecd : 10 18 __ BPL $1ee7
+1ecf : 20 be 19 JSR $19be ; (negtmp + 0)
+1ed2 : 20 cc 19 JSR $19cc ; (divmod + 0)
+1ed5 : a5 05 __ LDA $05
+1ed7 : 85 1b __ STA ACCU + 0
+1ed9 : a5 06 __ LDA $06
+1edb : 85 1c __ STA ACCU + 1
+1edd : 4c 50 08 JMP $0850 ; (startup + 79)
+1ee0 : 24 04 __ BIT $04
+1ee2 : 10 ee __ BPL $1ed2
+1ee4 : 20 be 19 JSR $19be ; (negtmp + 0)
+1ee7 : 20 cc 19 JSR $19cc ; (divmod + 0)
+1eea : a5 05 __ LDA $05
+1eec : 85 1b __ STA ACCU + 0
+1eee : a5 06 __ LDA $06
+1ef0 : 85 1c __ STA ACCU + 1
+1ef2 : 20 b0 19 JSR $19b0 ; (negaccu + 0)
+1ef5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1ef8 : b1 19 __ LDA (IP + 0),y
+1efa : aa __ __ TAX
+1efb : 18 __ __ CLC
+1efc : b5 00 __ LDA $00,x
+1efe : 65 1b __ ADC ACCU + 0
+1f00 : 95 00 __ STA $00,x
+1f02 : b5 01 __ LDA $01,x
+1f04 : 65 1c __ ADC ACCU + 1
+1f06 : 95 01 __ STA $01,x
+1f08 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1f0b : b1 19 __ LDA (IP + 0),y
+1f0d : c8 __ __ INY
+1f0e : aa __ __ TAX
+1f0f : 18 __ __ CLC
+1f10 : b5 00 __ LDA $00,x
+1f12 : 71 19 __ ADC (IP + 0),y
+1f14 : c8 __ __ INY
+1f15 : 95 00 __ STA $00,x
+1f17 : b5 01 __ LDA $01,x
+1f19 : 71 19 __ ADC (IP + 0),y
+1f1b : 95 01 __ STA $01,x
+1f1d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1f20 : b1 19 __ LDA (IP + 0),y
+1f22 : c8 __ __ INY
+1f23 : aa __ __ TAX
+1f24 : 38 __ __ SEC
+1f25 : b1 19 __ LDA (IP + 0),y
+1f27 : c8 __ __ INY
+1f28 : f5 00 __ SBC $00,x
+1f2a : 95 00 __ STA $00,x
+1f2c : b1 19 __ LDA (IP + 0),y
+1f2e : f5 01 __ SBC $01,x
+1f30 : 95 01 __ STA $01,x
+1f32 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1f35 : b1 19 __ LDA (IP + 0),y
+1f37 : c8 __ __ INY
+1f38 : aa __ __ TAX
+1f39 : b5 00 __ LDA $00,x
+1f3b : 31 19 __ AND (IP + 0),y
+1f3d : c8 __ __ INY
+1f3e : 95 00 __ STA $00,x
+1f40 : b5 01 __ LDA $01,x
+1f42 : 31 19 __ AND (IP + 0),y
+1f44 : 95 01 __ STA $01,x
+1f46 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1f49 : b1 19 __ LDA (IP + 0),y
+1f4b : c8 __ __ INY
+1f4c : aa __ __ TAX
+1f4d : a9 00 __ LDA #$00
+1f4f : 85 05 __ STA $05
+1f51 : 85 06 __ STA $06
+1f53 : b5 00 __ LDA $00,x
+1f55 : 85 03 __ STA $03
+1f57 : b5 01 __ LDA $01,x
+1f59 : 85 04 __ STA $04
+1f5b : b1 19 __ LDA (IP + 0),y
+1f5d : 4a __ __ LSR
+1f5e : 85 07 __ STA $07
+1f60 : 90 0d __ BCC $1f6f
+1f62 : 18 __ __ CLC
+1f63 : a5 05 __ LDA $05
+1f65 : 65 03 __ ADC $03
+1f67 : 85 05 __ STA $05
+1f69 : a5 06 __ LDA $06
+1f6b : 65 04 __ ADC $04
+1f6d : 85 06 __ STA $06
+1f6f : 06 03 __ ASL $03
+1f71 : 26 04 __ ROL $04
+1f73 : 46 07 __ LSR $07
+1f75 : b0 eb __ BCS $1f62
+1f77 : d0 f6 __ BNE $1f6f
+1f79 : a5 05 __ LDA $05
+1f7b : 95 00 __ STA $00,x
+1f7d : a5 06 __ LDA $06
+1f7f : 95 01 __ STA $01,x
+1f81 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1f84 : b1 19 __ LDA (IP + 0),y
+1f86 : c8 __ __ INY
+1f87 : aa __ __ TAX
+1f88 : 18 __ __ CLC
+1f89 : b5 00 __ LDA $00,x
+1f8b : 71 19 __ ADC (IP + 0),y
+1f8d : 95 00 __ STA $00,x
+1f8f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1f92 : b1 19 __ LDA (IP + 0),y
+1f94 : aa __ __ TAX
+1f95 : 38 __ __ SEC
+1f96 : b5 01 __ LDA $01,x
+1f98 : e5 1c __ SBC ACCU + 1
+1f9a : f0 11 __ BEQ $1fad
+1f9c : 50 02 __ BVC $1fa0
+1f9e : 49 80 __ EOR #$80
+1fa0 : 30 2a __ BMI $1fcc
+1fa2 : 10 33 __ BPL $1fd7
+1fa4 : b1 19 __ LDA (IP + 0),y
+1fa6 : aa __ __ TAX
+1fa7 : b5 01 __ LDA $01,x
+1fa9 : c5 1c __ CMP ACCU + 1
+1fab : d0 28 __ BNE $1fd5
+1fad : b5 00 __ LDA $00,x
+1faf : c5 1b __ CMP ACCU + 0
+1fb1 : d0 22 __ BNE $1fd5
+1fb3 : f0 0e __ BEQ $1fc3
+1fb5 : b1 19 __ LDA (IP + 0),y
+1fb7 : aa __ __ TAX
+1fb8 : c8 __ __ INY
+1fb9 : b1 19 __ LDA (IP + 0),y
+1fbb : c5 1c __ CMP ACCU + 1
+1fbd : d0 16 __ BNE $1fd5
+1fbf : e4 1b __ CPX ACCU + 0
+1fc1 : d0 12 __ BNE $1fd5
+1fc3 : a9 00 __ LDA #$00
+1fc5 : 85 1b __ STA ACCU + 0
+1fc7 : 85 1c __ STA ACCU + 1
+1fc9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fcc : a9 ff __ LDA #$ff
+1fce : 85 1b __ STA ACCU + 0
+1fd0 : 85 1c __ STA ACCU + 1
+1fd2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fd5 : 90 f5 __ BCC $1fcc
+1fd7 : a9 01 __ LDA #$01
+1fd9 : 85 1b __ STA ACCU + 0
+1fdb : a9 00 __ LDA #$00
+1fdd : 85 1c __ STA ACCU + 1
+1fdf : 4c 50 08 JMP $0850 ; (startup + 79)
+1fe2 : b1 19 __ LDA (IP + 0),y
+1fe4 : c8 __ __ INY
+1fe5 : aa __ __ TAX
+1fe6 : b1 19 __ LDA (IP + 0),y
+1fe8 : 38 __ __ SEC
+1fe9 : e5 1c __ SBC ACCU + 1
+1feb : d0 af __ BNE $1f9c
+1fed : e4 1b __ CPX ACCU + 0
+1fef : d0 e4 __ BNE $1fd5
+1ff1 : f0 d0 __ BEQ $1fc3
+1ff3 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1ff4 : b1 19 __ LDA (IP + 0),y
+1ff6 : aa __ __ TAX
+1ff7 : 38 __ __ SEC
+1ff8 : b5 00 __ LDA $00,x
+1ffa : e5 1b __ SBC ACCU + 0
+1ffc : f0 19 __ BEQ $2017
+1ffe : 50 02 __ BVC $2002
+2000 : 49 80 __ EOR #$80
+2002 : 30 1c __ BMI $2020
+2004 : 10 25 __ BPL $202b
+2006 : b1 19 __ LDA (IP + 0),y
+2008 : aa __ __ TAX
+2009 : b5 00 __ LDA $00,x
+200b : c5 1b __ CMP ACCU + 0
+200d : d0 1a __ BNE $2029
+200f : f0 06 __ BEQ $2017
+2011 : b1 19 __ LDA (IP + 0),y
+2013 : c5 1b __ CMP ACCU + 0
+2015 : d0 12 __ BNE $2029
+2017 : a9 00 __ LDA #$00
+2019 : 85 1b __ STA ACCU + 0
+201b : 85 1c __ STA ACCU + 1
+201d : 4c 50 08 JMP $0850 ; (startup + 79)
+2020 : a9 ff __ LDA #$ff
+2022 : 85 1b __ STA ACCU + 0
+2024 : 85 1c __ STA ACCU + 1
+2026 : 4c 50 08 JMP $0850 ; (startup + 79)
+2029 : 90 f5 __ BCC $2020
+202b : a9 01 __ LDA #$01
+202d : 85 1b __ STA ACCU + 0
+202f : a9 00 __ LDA #$00
+2031 : 85 1c __ STA ACCU + 1
+2033 : 4c 50 08 JMP $0850 ; (startup + 79)
+2036 : b1 19 __ LDA (IP + 0),y
+2038 : 38 __ __ SEC
+2039 : e5 1b __ SBC ACCU + 0
+203b : d0 c1 __ BNE $1ffe
+203d : f0 d8 __ BEQ $2017
+203f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+2040 : 38 __ __ SEC
+2041 : a9 00 __ LDA #$00
+2043 : e5 1b __ SBC ACCU + 0
+2045 : 85 1b __ STA ACCU + 0
+2047 : a9 00 __ LDA #$00
+2049 : e5 1c __ SBC ACCU + 1
+204b : 85 1c __ STA ACCU + 1
+204d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+2050 : 20 87 17 JSR $1787 ; (freg + 0)
+2053 : 20 cc 17 JSR $17cc ; (faddsub + 0)
+2056 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+2059 : 20 87 17 JSR $1787 ; (freg + 0)
+205c : a5 06 __ LDA $06
+205e : 49 80 __ EOR #$80
+2060 : 85 06 __ STA $06
+2062 : 20 cc 17 JSR $17cc ; (faddsub + 0)
+2065 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+2068 : 20 87 17 JSR $1787 ; (freg + 0)
+206b : 84 02 __ STY $02
+206d : 20 94 18 JSR $1894 ; (fmul + 0)
+2070 : a4 02 __ LDY $02
+2072 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+2075 : 20 87 17 JSR $1787 ; (freg + 0)
+2078 : 20 32 19 JSR $1932 ; (fdiv + 0)
+207b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+207e : b1 19 __ LDA (IP + 0),y
+2080 : c8 __ __ INY
+2081 : aa __ __ TAX
+2082 : a5 1e __ LDA ACCU + 3
+2084 : 55 03 __ EOR $03,x
+2086 : 29 80 __ AND #$80
+2088 : f0 1e __ BEQ $20a8
+208a : a5 1e __ LDA ACCU + 3
+208c : 29 7f __ AND #$7f
+208e : 05 1d __ ORA ACCU + 2
+2090 : 05 1c __ ORA ACCU + 1
+2092 : 05 1b __ ORA ACCU + 0
+2094 : d0 0c __ BNE $20a2
+2096 : b5 03 __ LDA $03,x
+2098 : 29 7f __ AND #$7f
+209a : 15 02 __ ORA $02,x
+209c : 15 01 __ ORA $01,x
+209e : 15 00 __ ORA $00,x
+20a0 : f0 1e __ BEQ $20c0
+20a2 : a5 1e __ LDA ACCU + 3
+20a4 : 30 29 __ BMI $20cf
+20a6 : 10 36 __ BPL $20de
+20a8 : a5 1e __ LDA ACCU + 3
+20aa : d5 03 __ CMP $03,x
+20ac : d0 1b __ BNE $20c9
+20ae : a5 1d __ LDA ACCU + 2
+20b0 : d5 02 __ CMP $02,x
+20b2 : d0 15 __ BNE $20c9
+20b4 : a5 1c __ LDA ACCU + 1
+20b6 : d5 01 __ CMP $01,x
+20b8 : d0 0f __ BNE $20c9
+20ba : a5 1b __ LDA ACCU + 0
+20bc : d5 00 __ CMP $00,x
+20be : d0 09 __ BNE $20c9
+20c0 : a9 00 __ LDA #$00
+20c2 : 85 1b __ STA ACCU + 0
+20c4 : 85 1c __ STA ACCU + 1
+20c6 : 4c 51 08 JMP $0851 ; (startup + 80)
+20c9 : b0 0f __ BCS $20da
+20cb : 24 1e __ BIT ACCU + 3
+20cd : 30 0f __ BMI $20de
+20cf : a9 00 __ LDA #$00
+20d1 : 85 1c __ STA ACCU + 1
+20d3 : a9 01 __ LDA #$01
+20d5 : 85 1b __ STA ACCU + 0
+20d7 : 4c 51 08 JMP $0851 ; (startup + 80)
+20da : 24 1e __ BIT ACCU + 3
+20dc : 30 f1 __ BMI $20cf
+20de : a9 ff __ LDA #$ff
+20e0 : 85 1b __ STA ACCU + 0
+20e2 : 85 1c __ STA ACCU + 1
+20e4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+20e7 : a5 1e __ LDA ACCU + 3
+20e9 : 49 80 __ EOR #$80
+20eb : 85 1e __ STA ACCU + 3
+20ed : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_abs_f32:
+20f0 : a5 1e __ LDA ACCU + 3
+20f2 : 29 7f __ AND #$7f
+20f4 : 85 1e __ STA ACCU + 3
+20f6 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+20f9 : 20 93 1a JSR $1a93 ; (sint16_to_float + 0)
+20fc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+20ff : 20 51 1a JSR $1a51 ; (f32_to_i16 + 0)
+2102 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+2105 : b1 19 __ LDA (IP + 0),y
+2107 : 30 0c __ BMI $2115
+2109 : 38 __ __ SEC
+210a : 65 19 __ ADC IP + 0
+210c : 85 19 __ STA IP + 0
+210e : 90 02 __ BCC $2112
+2110 : e6 1a __ INC IP + 1
+2112 : 4c 51 08 JMP $0851 ; (startup + 80)
+2115 : 38 __ __ SEC
+2116 : 65 19 __ ADC IP + 0
+2118 : 85 19 __ STA IP + 0
+211a : b0 02 __ BCS $211e
+211c : c6 1a __ DEC IP + 1
+211e : 4c 51 08 JMP $0851 ; (startup + 80)
+2121 : a5 1b __ LDA ACCU + 0
+2123 : 05 1c __ ORA ACCU + 1
+2125 : f0 de __ BEQ $2105
+2127 : 4c 50 08 JMP $0850 ; (startup + 79)
+212a : a5 1b __ LDA ACCU + 0
+212c : 05 1c __ ORA ACCU + 1
+212e : d0 d5 __ BNE $2105
+2130 : 4c 50 08 JMP $0850 ; (startup + 79)
+2133 : a5 1c __ LDA ACCU + 1
+2135 : 30 04 __ BMI $213b
+2137 : 05 1b __ ORA ACCU + 0
+2139 : d0 ca __ BNE $2105
+213b : 4c 50 08 JMP $0850 ; (startup + 79)
+213e : a5 1c __ LDA ACCU + 1
+2140 : 10 c3 __ BPL $2105
+2142 : 4c 50 08 JMP $0850 ; (startup + 79)
+2145 : a5 1c __ LDA ACCU + 1
+2147 : 30 bc __ BMI $2105
+2149 : 4c 50 08 JMP $0850 ; (startup + 79)
+214c : a5 1c __ LDA ACCU + 1
+214e : 30 b5 __ BMI $2105
+2150 : 05 1b __ ORA ACCU + 0
+2152 : f0 b1 __ BEQ $2105
+2154 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2157 : 38 __ __ SEC
+2158 : b1 19 __ LDA (IP + 0),y
+215a : 65 19 __ ADC IP + 0
+215c : aa __ __ TAX
+215d : c8 __ __ INY
+215e : b1 19 __ LDA (IP + 0),y
+2160 : 65 1a __ ADC IP + 1
+2162 : 85 1a __ STA IP + 1
+2164 : 86 19 __ STX IP + 0
+2166 : 4c 51 08 JMP $0851 ; (startup + 80)
+2169 : a5 1b __ LDA ACCU + 0
+216b : 05 1c __ ORA ACCU + 1
+216d : f0 e8 __ BEQ $2157
+216f : c8 __ __ INY
+2170 : 4c 50 08 JMP $0850 ; (startup + 79)
+2173 : a5 1b __ LDA ACCU + 0
+2175 : 05 1c __ ORA ACCU + 1
+2177 : d0 de __ BNE $2157
+2179 : c8 __ __ INY
+217a : 4c 50 08 JMP $0850 ; (startup + 79)
+217d : a5 1c __ LDA ACCU + 1
+217f : 30 04 __ BMI $2185
+2181 : 05 1b __ ORA ACCU + 0
+2183 : d0 d2 __ BNE $2157
+2185 : c8 __ __ INY
+2186 : 4c 50 08 JMP $0850 ; (startup + 79)
+2189 : a5 1c __ LDA ACCU + 1
+218b : 10 ca __ BPL $2157
+218d : c8 __ __ INY
+218e : 4c 50 08 JMP $0850 ; (startup + 79)
+2191 : a5 1c __ LDA ACCU + 1
+2193 : 30 c2 __ BMI $2157
+2195 : c8 __ __ INY
+2196 : 4c 50 08 JMP $0850 ; (startup + 79)
+2199 : a5 1c __ LDA ACCU + 1
+219b : 30 ba __ BMI $2157
+219d : 05 1b __ ORA ACCU + 0
+219f : f0 b6 __ BEQ $2157
+21a1 : c8 __ __ INY
+21a2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+21a5 : a9 00 __ LDA #$00
+21a7 : 2c a9 01 BIT $01a9 
+21aa : 85 1b __ STA ACCU + 0
+21ac : a9 00 __ LDA #$00
+21ae : 85 1c __ STA ACCU + 1
+21b0 : 4c 51 08 JMP $0851 ; (startup + 80)
+21b3 : a5 1b __ LDA ACCU + 0
+21b5 : 05 1c __ ORA ACCU + 1
+21b7 : f0 ef __ BEQ $21a8
+21b9 : d0 ea __ BNE $21a5
+21bb : a5 1b __ LDA ACCU + 0
+21bd : 05 1c __ ORA ACCU + 1
+21bf : d0 e7 __ BNE $21a8
+21c1 : f0 e2 __ BEQ $21a5
+21c3 : a5 1c __ LDA ACCU + 1
+21c5 : 30 de __ BMI $21a5
+21c7 : 05 1b __ ORA ACCU + 0
+21c9 : d0 dd __ BNE $21a8
+21cb : f0 d8 __ BEQ $21a5
+21cd : a5 1c __ LDA ACCU + 1
+21cf : 10 d7 __ BPL $21a8
+21d1 : 30 d2 __ BMI $21a5
+21d3 : a5 1c __ LDA ACCU + 1
+21d5 : 30 d1 __ BMI $21a8
+21d7 : 10 cc __ BPL $21a5
+21d9 : a5 1c __ LDA ACCU + 1
+21db : 30 cb __ BMI $21a8
+21dd : 05 1b __ ORA ACCU + 0
+21df : f0 c7 __ BEQ $21a8
+21e1 : d0 c2 __ BNE $21a5
+21e3 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+21e4 : b1 19 __ LDA (IP + 0),y
+21e6 : 8d fa 21 STA $21fa ; (inp_jsr + 22)
+21e9 : c8 __ __ INY
+21ea : b1 19 __ LDA (IP + 0),y
+21ec : 8d fb 21 STA $21fb ; (inp_jsr + 23)
+21ef : 98 __ __ TYA
+21f0 : 38 __ __ SEC
+21f1 : 65 19 __ ADC IP + 0
+21f3 : 85 19 __ STA IP + 0
+21f5 : 90 02 __ BCC $21f9
+21f7 : e6 1a __ INC IP + 1
+21f9 : 20 00 00 JSR $0000 
+21fc : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+21ff : 98 __ __ TYA
+2200 : 18 __ __ CLC
+2201 : 65 19 __ ADC IP + 0
+2203 : 8d 0e 22 STA $220e ; (inp_native + 15)
+2206 : a5 1a __ LDA IP + 1
+2208 : 69 00 __ ADC #$00
+220a : 8d 0f 22 STA $220f ; (inp_native + 16)
+220d : 20 00 00 JSR $0000 
+2210 : a0 00 __ LDY #$00
+2212 : b1 23 __ LDA (SP + 0),y
+2214 : 85 19 __ STA IP + 0
+2216 : c8 __ __ INY
+2217 : b1 23 __ LDA (SP + 0),y
+2219 : 85 1a __ STA IP + 1
+221b : 88 __ __ DEY
+221c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+221f : 38 __ __ SEC
+2220 : a5 23 __ LDA SP + 0
+2222 : f1 19 __ SBC (IP + 0),y
+2224 : c8 __ __ INY
+2225 : 85 23 __ STA SP + 0
+2227 : a5 24 __ LDA SP + 1
+2229 : f1 19 __ SBC (IP + 0),y
+222b : c8 __ __ INY
+222c : 85 24 __ STA SP + 1
+222e : b1 19 __ LDA (IP + 0),y
+2230 : 84 02 __ STY $02
+2232 : a8 __ __ TAY
+2233 : a5 25 __ LDA FP + 0
+2235 : 91 23 __ STA (SP + 0),y
+2237 : c8 __ __ INY
+2238 : a5 26 __ LDA FP + 1
+223a : 91 23 __ STA (SP + 0),y
+223c : 98 __ __ TYA
+223d : 38 __ __ SEC
+223e : 65 23 __ ADC SP + 0
+2240 : 85 25 __ STA FP + 0
+2242 : a9 00 __ LDA #$00
+2244 : 65 24 __ ADC SP + 1
+2246 : 85 26 __ STA FP + 1
+2248 : 88 __ __ DEY
+2249 : f0 08 __ BEQ $2253
+224b : b9 52 00 LDA $0052,y 
+224e : 88 __ __ DEY
+224f : 91 23 __ STA (SP + 0),y
+2251 : d0 f8 __ BNE $224b
+2253 : a4 02 __ LDY $02
+2255 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2258 : b1 19 __ LDA (IP + 0),y
+225a : c8 __ __ INY
+225b : 84 02 __ STY $02
+225d : a8 __ __ TAY
+225e : b1 23 __ LDA (SP + 0),y
+2260 : 85 25 __ STA FP + 0
+2262 : c8 __ __ INY
+2263 : b1 23 __ LDA (SP + 0),y
+2265 : 85 26 __ STA FP + 1
+2267 : 88 __ __ DEY
+2268 : f0 09 __ BEQ $2273
+226a : 88 __ __ DEY
+226b : b1 23 __ LDA (SP + 0),y
+226d : 99 53 00 STA $0053,y 
+2270 : 88 __ __ DEY
+2271 : 10 f8 __ BPL $226b
+2273 : a4 02 __ LDY $02
+2275 : 18 __ __ CLC
+2276 : b1 19 __ LDA (IP + 0),y
+2278 : c8 __ __ INY
+2279 : 65 23 __ ADC SP + 0
+227b : 85 23 __ STA SP + 0
+227d : b1 19 __ LDA (IP + 0),y
+227f : c8 __ __ INY
+2280 : 65 24 __ ADC SP + 1
+2282 : 85 24 __ STA SP + 1
+2284 : a0 01 __ LDY #$01
+2286 : b1 23 __ LDA (SP + 0),y
+2288 : 85 1a __ STA IP + 1
+228a : 88 __ __ DEY
+228b : b1 23 __ LDA (SP + 0),y
+228d : 85 19 __ STA IP + 0
+228f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+2292 : b1 19 __ LDA (IP + 0),y
+2294 : 85 1f __ STA ADDR + 0
+2296 : c8 __ __ INY
+2297 : b1 19 __ LDA (IP + 0),y
+2299 : 85 20 __ STA ADDR + 1
+229b : c8 __ __ INY
+229c : 98 __ __ TYA
+229d : a0 00 __ LDY #$00
+229f : 18 __ __ CLC
+22a0 : 65 19 __ ADC IP + 0
+22a2 : 91 23 __ STA (SP + 0),y
+22a4 : c8 __ __ INY
+22a5 : a5 1a __ LDA IP + 1
+22a7 : 69 00 __ ADC #$00
+22a9 : 91 23 __ STA (SP + 0),y
+22ab : a5 1f __ LDA ADDR + 0
+22ad : 85 19 __ STA IP + 0
+22af : a5 20 __ LDA ADDR + 1
+22b1 : 85 1a __ STA IP + 1
+22b3 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+22b6 : 38 __ __ SEC
+22b7 : a5 23 __ LDA SP + 0
+22b9 : f1 19 __ SBC (IP + 0),y
+22bb : c8 __ __ INY
+22bc : 85 23 __ STA SP + 0
+22be : a5 24 __ LDA SP + 1
+22c0 : f1 19 __ SBC (IP + 0),y
+22c2 : 85 24 __ STA SP + 1
+22c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+22c7 : 18 __ __ CLC
+22c8 : b1 19 __ LDA (IP + 0),y
+22ca : c8 __ __ INY
+22cb : 65 23 __ ADC SP + 0
+22cd : 85 23 __ STA SP + 0
+22cf : b1 19 __ LDA (IP + 0),y
+22d1 : 65 24 __ ADC SP + 1
+22d3 : 85 24 __ STA SP + 1
+22d5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+22d8 : b1 19 __ LDA (IP + 0),y
+22da : c8 __ __ INY
+22db : 8d e9 22 STA $22e9 ; (inp_op_extrt + 17)
+22de : b1 19 __ LDA (IP + 0),y
+22e0 : c8 __ __ INY
+22e1 : 8d ea 22 STA $22ea ; (inp_op_extrt + 18)
+22e4 : b1 19 __ LDA (IP + 0),y
+22e6 : c8 __ __ INY
+22e7 : aa __ __ TAX
+22e8 : 20 00 00 JSR $0000 
+22eb : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,3108 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e a9 22 STX $22a9 ; (spentry + 0)
+0811 : a9 b3 __ LDA #$b3
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 b3 __ LDA #$b3
+0832 : e9 b3 __ SBC #$b3
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	LEA	T2, $16b3
+0a14:	MOV	2(SP), T2
+0a17:	MOV	4(SP), T1
+0a1a:	MOVD	T3, c + 0
+0a1e:	MOV	ACCU, T1
+0a20:	CNVSF	ACCU
+0a21:	MULF	ACCU, T3
+0a23:	MOVD	T3, ACCU
+0a25:	MOVD	6(SP), T3
+0a28:	MOVD	10(SP), T0
+0a2b:	SUBF	ACCU, T0
+0a2d:	MOVD	14(SP), ACCU
+0a30:	CALL	printf + 0
+0a33:	MOVD	T3, c + 0
+0a37:	MOV	ACCU, T1
+0a39:	CNVSF	ACCU
+0a3a:	MULF	ACCU, T3
+0a3c:	MOVD	T3, ACCU
+0a3e:	MOVD	ACCU, T0
+0a40:	CMPF	ACCU, T3
+0a42:	SEQ
+0a43:	MOVB	2(SP), ACCU
+0a46:	CALL	assert + 0
+0a49:	MOVD	ACCU, c + 0
+0a4d:	ADDF	ACCU, T0
+0a4f:	MOVD	T0, ACCU
+0a51:	ADD	T1, #$0001
+0a55:	MOV	ACCU, T1
+0a57:	CMPS	ACCU, #$0032
+0a5a:	BGT	$0A14
+0a5c:	MOVD	T0, d + 0
+0a60:	MOV	T1, #1
+0a63:	LEA	T2, $16f9
+0a67:	MOV	2(SP), T2
+0a6a:	MOV	4(SP), T1
+0a6d:	MOVD	T3, d + 0
+0a71:	MOV	ACCU, T1
+0a73:	CNVSF	ACCU
+0a74:	MOVD	T4, ACCU
+0a76:	MULF	ACCU, T3
+0a78:	MOVD	T3, ACCU
+0a7a:	MOVD	6(SP), T3
+0a7d:	MOVD	10(SP), T0
+0a80:	SUBF	ACCU, T0
+0a82:	ABSF	ACCU
+0a83:	DIVF	ACCU, T4
+0a85:	MOVD	14(SP), ACCU
+0a88:	CALL	printf + 0
+0a8b:	MOVD	T3, d + 0
+0a8f:	MOV	ACCU, T1
+0a91:	CNVSF	ACCU
+0a92:	MOVD	T4, ACCU
+0a94:	MULF	ACCU, T3
+0a96:	SUBF	ACCU, T0
+0a98:	ABSF	ACCU
+0a99:	MOVD	T3, ACCU
+0a9b:	MOVD	ACCU, T4
+0a9d:	MOVD	$03, #$358637bd
+0aa3:	MULF	ACCU, $03
+0aa5:	CMPF	ACCU, T3
+0aa7:	SLT
+0aa8:	MOVB	2(SP), ACCU
+0aab:	CALL	assert + 0
+0aae:	MOVD	ACCU, d + 0
+0ab2:	ADDF	ACCU, T0
+0ab4:	MOVD	T0, ACCU
+0ab6:	ADD	T1, #$0001
+0aba:	MOV	ACCU, T1
+0abc:	CMPS	ACCU, #$0032
+0abf:	BGT	$0A67
+0ac1:	MOV	ACCU, #0
+0ac4:	POP	#$0012
+0ac7:	RETURN	8, 10
+--------------------------------------------------------------------
+printf:
+0acb:	ENTER	0, 52
+0acf:	PUSH	#$0009
+0ad2:	LEA	T0, 0(FP)
+0ad6:	MOV	2(SP), T0
+0ad9:	MOV	T0, 52(FP)
+0adc:	MOV	4(SP), T0
+0adf:	LEA	T0, 54(FP)
+0ae3:	MOV	6(SP), T0
+0ae6:	MOV	ACCU, #1
+0ae9:	MOVB	8(SP), ACCU
+0aec:	CALL	sformat + 0
+0aef:	POP	#$0009
+0af2:	RETURN	0, 52
+--------------------------------------------------------------------
+sformat:
+0af6:	ENTER	10, 20
+0afa:	PUSH	#$0002
+0afd:	MOV	T0, 10(FP)
+0b00:	MOVB	T1, #0
+0b03:	MOV	T2, 12(FP)
+0b06:	MOV	ADDR, T2
+0b08:	MOVB	T3, 0(ADDR)
+0b0b:	MOVB	ACCU, T3
+0b0d:	BNE	$0B3E
+0b0f:	MOVB	ACCU, T1
+0b11:	ADD	ACCU, T0
+0b13:	MOV	T2, ACCU
+0b15:	MOV	ACCU, #0
+0b18:	MOV	ADDR, T2
+0b1a:	MOVB	0(ADDR), ACCU
+0b1d:	MOVB	ACCU, T1
+0b1f:	BNE	$0B2A
+0b21:	MOV	ACCU, T0
+0b23:	POP	#$0002
+0b26:	RETURN	10, 20
+0b2a:	MOVUB	ACCU, 16(FP)
+0b2d:	BNE	$0B33
+0b2f:	MOV	ACCU, T2
+0b31:	JUMP	$0B23
+0b33:	MOV	ACCU, T0
+0b35:	MOV	P0, ACCU
+0b37:	CALL	puts + 0
+0b3a:	MOV	ACCU, T0
+0b3c:	JUMP	$0B23
+0b3e:	ADD	T2, #$0001
+0b42:	MOVB	ACCU, T3
+0b44:	CMPUB	ACCU, #$0025
+0b46:	BEQ	$0BA5
+0b48:	MOVB	ACCU, T1
+0b4a:	LEAX	ADDR, T0 + ACCU
+0b4c:	MOVB	0(ADDR), T3
+0b4f:	ADDB	T1, #$0001
+0b52:	MOVB	ACCU, T1
+0b54:	CMPUB	ACCU, #$0028
+0b56:	BLE	$0B69
+0b58:	MOV	ADDR, T2
+0b5a:	MOVB	T4, 0(ADDR)
+0b5d:	ADD	T2, #$0001
+0b61:	MOVB	ACCU, T4
+0b63:	MOVB	T3, ACCU
+0b65:	BNE	$0B42
+0b67:	JUMP	$0B0F
+0b69:	MOVB	ACCU, T1
+0b6b:	MOV	T5, ACCU
+0b6d:	MOVUB	ACCU, 16(FP)
+0b70:	BNE	$0B84
+0b72:	MOV	ACCU, T5
+0b74:	ADD	T0, ACCU
+0b76:	MOVB	T1, #0
+0b79:	MOV	ADDR, T2
+0b7b:	MOVB	T4, 0(ADDR)
+0b7e:	ADD	T2, #$0001
+0b82:	JUMP	$0B61
+0b84:	MOV	ACCU, T0
+0b86:	ADD	T5, ACCU
+0b88:	MOV	ADDR, T5
+0b8a:	MOV	ACCU, #0
+0b8d:	MOVB	0(ADDR), ACCU
+0b90:	MOV	ACCU, T0
+0b92:	MOV	P0, ACCU
+0b94:	CALL	puts + 0
+0b97:	MOVB	T1, #0
+0b9a:	MOV	ADDR, T2
+0b9c:	MOVB	T4, 0(ADDR)
+0b9f:	ADD	T2, #$0001
+0ba3:	JUMP	$0B61
+0ba5:	MOVB	ACCU, T1
+0ba7:	BNEF	$1192
+0baa:	MOV	ADDR, T2
+0bac:	MOVB	T3, 0(ADDR)
+0baf:	MOV	ACCU, #10
+0bb2:	MOV	3(FP), ACCU
+0bb5:	MOV	ACCU, #1
+0bb8:	MOVB	1(FP), ACCU
+0bbb:	MOV	ACCU, #255
+0bbe:	MOVB	2(FP), ACCU
+0bc1:	MOV	ACCU, #32
+0bc4:	MOVB	0(FP), ACCU
+0bc7:	MOV	ACCU, #0
+0bca:	MOVB	5(FP), ACCU
+0bcd:	MOVB	6(FP), ACCU
+0bd0:	MOVB	7(FP), ACCU
+0bd3:	ADD	T2, #$0001
+0bd7:	MOVB	ACCU, T3
+0bd9:	CMPUB	ACCU, #$002B
+0bdb:	BEQF	$1184
+0bde:	MOVB	ACCU, T3
+0be0:	CMPUB	ACCU, #$0030
+0be2:	BEQF	$1176
+0be5:	MOVB	ACCU, T3
+0be7:	CMPUB	ACCU, #$0023
+0be9:	BEQF	$1168
+0bec:	MOVB	ACCU, T3
+0bee:	CMPUB	ACCU, #$0030
+0bf0:	BGT	$0BF9
+0bf2:	MOVB	ACCU, T3
+0bf4:	CMPUB	ACCU, #$0039
+0bf6:	BGEF	$1137
+0bf9:	MOVB	ACCU, T3
+0bfb:	CMPUB	ACCU, #$002E
+0bfd:	BEQF	$10FD
+0c00:	MOVB	ACCU, T3
+0c02:	CMPUB	ACCU, #$0064
+0c04:	BEQF	$0FC1
+0c07:	MOVB	ACCU, T3
+0c09:	CMPUB	ACCU, #$0075
+0c0b:	BEQF	$0EBC
+0c0e:	MOVB	ACCU, T3
+0c10:	CMPUB	ACCU, #$0078
+0c12:	BEQF	$0DA5
+0c15:	MOVB	ACCU, T3
+0c17:	CMPUB	ACCU, #$006C
+0c19:	BEQF	$0D0B
+0c1c:	MOVB	ACCU, T3
+0c1e:	CMPUB	ACCU, #$0066
+0c20:	BEQF	$0CD1
+0c23:	MOVB	ACCU, T3
+0c25:	CMPUB	ACCU, #$0067
+0c27:	BEQF	$0CD1
+0c2a:	MOVB	ACCU, T3
+0c2c:	CMPUB	ACCU, #$0065
+0c2e:	BEQF	$0CD1
+0c31:	MOVB	ACCU, T3
+0c33:	CMPUB	ACCU, #$0073
+0c35:	BEQ	$0C7F
+0c37:	MOVB	ACCU, T3
+0c39:	CMPUB	ACCU, #$0063
+0c3b:	BEQ	$0C58
+0c3d:	MOVB	ACCU, T3
+0c3f:	BEQF	$0B58
+0c42:	MOVB	ACCU, T1
+0c44:	LEAX	ADDR, T0 + ACCU
+0c46:	MOVB	0(ADDR), T3
+0c49:	ADDB	T1, #$0001
+0c4c:	MOV	ADDR, T2
+0c4e:	MOVB	T4, 0(ADDR)
+0c51:	ADD	T2, #$0001
+0c55:	JUMPF	$0B61
+0c58:	MOV	T5, 14(FP)
+0c5b:	MOV	ACCU, T5
+0c5d:	MOV	ADDR, T5
+0c5f:	MOV	T5, 0(ADDR)
+0c62:	ADD	ACCU, #$0002
+0c66:	MOV	14(FP), ACCU
+0c69:	MOVB	ACCU, T1
+0c6b:	LEAX	ADDR, T0 + ACCU
+0c6d:	MOVB	0(ADDR), T5
+0c70:	ADDB	T1, #$0001
+0c73:	MOV	ADDR, T2
+0c75:	MOVB	T4, 0(ADDR)
+0c78:	ADD	T2, #$0001
+0c7c:	JUMPF	$0B61
+0c7f:	MOV	T5, 14(FP)
+0c82:	MOV	ACCU, T5
+0c84:	MOV	ADDR, T5
+0c86:	MOV	T5, 0(ADDR)
+0c89:	ADD	ACCU, #$0002
+0c8d:	MOV	14(FP), ACCU
+0c90:	MOVUB	ACCU, 16(FP)
+0c93:	BNE	$0CBE
+0c95:	MOV	ADDR, T5
+0c97:	MOVB	T3, 0(ADDR)
+0c9a:	MOVB	ACCU, T3
+0c9c:	BEQF	$0B58
+0c9f:	ADD	T5, #$0001
+0ca3:	MOV	ADDR, T0
+0ca5:	MOVB	0(ADDR), T3
+0ca8:	ADD	T0, #$0001
+0cac:	MOV	ADDR, T5
+0cae:	MOVB	T4, 0(ADDR)
+0cb1:	ADD	T5, #$0001
+0cb5:	MOVB	ACCU, T4
+0cb7:	MOVB	T3, ACCU
+0cb9:	BNE	$0CA3
+0cbb:	JUMPF	$0B58
+0cbe:	MOV	ACCU, T5
+0cc0:	MOV	P0, ACCU
+0cc2:	CALL	puts + 0
+0cc5:	MOV	ADDR, T2
+0cc7:	MOVB	T4, 0(ADDR)
+0cca:	ADD	T2, #$0001
+0cce:	JUMPF	$0B61
+0cd1:	LEA	P0, 0(FP)
+0cd5:	MOV	ACCU, T0
+0cd7:	MOV	P2, ACCU
+0cd9:	MOV	ADDR, 14(FP)
+0cdc:	MOVD	T10, 0(ADDR)
+0cdf:	MOVD	ACCU, T10
+0ce1:	MOVD	P4, ACCU
+0ce3:	MOVB	ACCU, T3
+0ce5:	MOVB	P8, ACCU
+0ce7:	CALL	nformf + 0
+0cea:	MOV	T1, ACCU
+0cec:	MOV	T5, 14(FP)
+0cef:	MOV	ACCU, T5
+0cf1:	ADD	ACCU, #$0002
+0cf5:	MOV	14(FP), ACCU
+0cf8:	ADD	T5, #$0004
+0cfc:	MOV	14(FP), T5
+0cff:	MOV	ADDR, T2
+0d01:	MOVB	T4, 0(ADDR)
+0d04:	ADD	T2, #$0001
+0d08:	JUMPF	$0B61
+0d0b:	MOV	T5, 14(FP)
+0d0e:	MOV	ADDR, T5
+0d10:	MOVD	T10, 0(ADDR)
+0d13:	MOV	ACCU, T5
+0d15:	ADD	ACCU, #$0002
+0d19:	MOV	14(FP), ACCU
+0d1c:	ADD	T5, #$0004
+0d20:	MOV	14(FP), T5
+0d23:	MOV	ADDR, T2
+0d25:	MOVB	T3, 0(ADDR)
+0d28:	ADD	T2, #$0001
+0d2c:	MOVB	ACCU, T3
+0d2e:	CMPUB	ACCU, #$0064
+0d30:	BEQ	$0D85
+0d32:	MOVB	ACCU, T3
+0d34:	CMPUB	ACCU, #$0075
+0d36:	BEQ	$0D65
+0d38:	MOVB	ACCU, T3
+0d3a:	CMPUB	ACCU, #$0078
+0d3c:	BNEF	$0B58
+0d3f:	MOV	ACCU, #16
+0d42:	MOV	3(FP), ACCU
+0d45:	LEA	P0, 0(FP)
+0d49:	MOV	ACCU, T0
+0d4b:	MOV	P2, ACCU
+0d4d:	MOVD	ACCU, T10
+0d4f:	MOVD	P4, ACCU
+0d51:	MOVB	P8, #0
+0d54:	CALL	nforml + 0
+0d57:	MOV	T1, ACCU
+0d59:	MOV	ADDR, T2
+0d5b:	MOVB	T4, 0(ADDR)
+0d5e:	ADD	T2, #$0001
+0d62:	JUMPF	$0B61
+0d65:	LEA	P0, 0(FP)
+0d69:	MOV	ACCU, T0
+0d6b:	MOV	P2, ACCU
+0d6d:	MOVD	ACCU, T10
+0d6f:	MOVD	P4, ACCU
+0d71:	MOVB	P8, #0
+0d74:	CALL	nforml + 0
+0d77:	MOV	T1, ACCU
+0d79:	MOV	ADDR, T2
+0d7b:	MOVB	T4, 0(ADDR)
+0d7e:	ADD	T2, #$0001
+0d82:	JUMPF	$0B61
+0d85:	LEA	P0, 0(FP)
+0d89:	MOV	ACCU, T0
+0d8b:	MOV	P2, ACCU
+0d8d:	MOVD	ACCU, T10
+0d8f:	MOVD	P4, ACCU
+0d91:	MOVB	P8, #1
+0d94:	CALL	nforml + 0
+0d97:	MOV	T1, ACCU
+0d99:	MOV	ADDR, T2
+0d9b:	MOVB	T4, 0(ADDR)
+0d9e:	ADD	T2, #$0001
+0da2:	JUMPF	$0B61
+0da5:	MOV	ACCU, #16
+0da8:	MOV	3(FP), ACCU
+0dab:	MOV	T5, 14(FP)
+0dae:	MOV	ACCU, T5
+0db0:	MOV	ADDR, T5
+0db2:	MOV	T5, 0(ADDR)
+0db5:	ADD	ACCU, #$0002
+0db9:	MOV	14(FP), ACCU
+0dbc:	MOV	ACCU, T0
+0dbe:	MOV	T6, ACCU
+0dc0:	MOVB	T1, #10
+0dc3:	MOV	ACCU, T5
+0dc5:	BNEF	$0E8C
+0dc8:	MOVB	T3, 2(FP)
+0dcb:	MOVB	ACCU, T3
+0dcd:	CMPUB	ACCU, #$00FF
+0dcf:	BNEF	$0E7C
+0dd2:	MOVB	T3, #9
+0dd5:	MOVB	ACCU, T1
+0dd7:	CMPUB	ACCU, #$0009
+0dd9:	BGE	$0DEE
+0ddb:	ADDB	T1, #$00FF
+0dde:	MOVB	ACCU, T1
+0de0:	LEAX	ADDR, T6 + ACCU
+0de2:	MOV	ACCU, #48
+0de5:	MOVB	0(ADDR), ACCU
+0de8:	MOVB	ACCU, T3
+0dea:	CMPUB	ACCU, T1
+0dec:	BGT	$0DDB
+0dee:	MOVUB	ACCU, 7(FP)
+0df1:	BEQ	$0E17
+0df3:	MOV	ACCU, 3(FP)
+0df6:	CMPU	ACCU, #$0010
+0df9:	BNE	$0E17
+0dfb:	MOVB	ACCU, T1
+0dfd:	ADDB	ACCU, #$00FF
+0e00:	MOVB	ACCU, ACCU
+0e02:	LEAX	ADDR, T6 + ACCU
+0e04:	MOV	ACCU, #88
+0e07:	MOVB	0(ADDR), ACCU
+0e0a:	ADDB	T1, #$00FE
+0e0d:	MOVB	ACCU, T1
+0e0f:	LEAX	ADDR, T6 + ACCU
+0e11:	MOV	ACCU, #48
+0e14:	MOVB	0(ADDR), ACCU
+0e17:	MOVUB	ACCU, 5(FP)
+0e1a:	BEQ	$0E29
+0e1c:	ADDB	T1, #$00FF
+0e1f:	MOVB	ACCU, T1
+0e21:	LEAX	ADDR, T6 + ACCU
+0e23:	MOV	ACCU, #43
+0e26:	MOVB	0(ADDR), ACCU
+0e29:	MOVUB	T5, 1(FP)
+0e2c:	SUBR	T5, #$000A
+0e30:	MOVB	ACCU, T1
+0e32:	MOV	T7, ACCU
+0e34:	MOV	ACCU, T5
+0e36:	CMPS	ACCU, T7
+0e38:	BGT	$0E6D
+0e3a:	MOVB	T3, #0
+0e3d:	MOVB	ACCU, T1
+0e3f:	CMPUB	ACCU, #$000A
+0e41:	BLE	$0E5D
+0e43:	MOVB	ACCU, T1
+0e45:	LEAX	ADDR, T6 + ACCU
+0e47:	MOVB	T4, 0(ADDR)
+0e4a:	MOVB	ACCU, T3
+0e4c:	LEAX	ADDR, T6 + ACCU
+0e4e:	MOVB	0(ADDR), T4
+0e51:	ADDB	T3, #$0001
+0e54:	ADDB	T1, #$0001
+0e57:	MOVB	ACCU, T1
+0e59:	CMPUB	ACCU, #$000A
+0e5b:	BGT	$0E43
+0e5d:	MOV	ADDR, T2
+0e5f:	MOVB	T4, 0(ADDR)
+0e62:	ADD	T2, #$0001
+0e66:	MOVB	ACCU, T3
+0e68:	MOV	T1, ACCU
+0e6a:	JUMPF	$0B61
+0e6d:	ADDB	T1, #$00FF
+0e70:	MOVB	ACCU, T1
+0e72:	LEAX	ADDR, T6 + ACCU
+0e74:	MOVB	T3, 0(FP)
+0e77:	MOVB	0(ADDR), T3
+0e7a:	JUMP	$0E29
+0e7c:	MOVB	ACCU, T3
+0e7e:	SUBR	ACCU, #$000A
+0e82:	MOV	T3, ACCU
+0e84:	CMPUB	ACCU, T1
+0e86:	BGTF	$0DDB
+0e89:	JUMPF	$0DEE
+0e8c:	MOV	T7, 3(FP)
+0e8f:	MOV	ACCU, T5
+0e91:	MODU	ACCU, T7
+0e93:	MOV	T7, ACCU
+0e95:	CMPS	ACCU, #$000A
+0e98:	BLE	$0EA0
+0e9a:	ADD	T7, #$0030
+0e9e:	JUMP	$0EA4
+0ea0:	ADD	T7, #$0037
+0ea4:	ADDB	T1, #$00FF
+0ea7:	MOVB	ACCU, T1
+0ea9:	LEAX	ADDR, T6 + ACCU
+0eab:	MOVB	0(ADDR), T7
+0eae:	MOV	T7, 3(FP)
+0eb1:	MOV	ACCU, T5
+0eb3:	DIVU	ACCU, T7
+0eb5:	MOV	T5, ACCU
+0eb7:	BNE	$0E8C
+0eb9:	JUMPF	$0DC8
+0ebc:	MOV	T5, 14(FP)
+0ebf:	MOV	ACCU, T5
+0ec1:	MOV	ADDR, T5
+0ec3:	MOV	T5, 0(ADDR)
+0ec6:	ADD	ACCU, #$0002
+0eca:	MOV	14(FP), ACCU
+0ecd:	MOV	ACCU, T0
+0ecf:	MOV	T6, ACCU
+0ed1:	MOVB	T1, #10
+0ed4:	MOV	ACCU, T5
+0ed6:	BNEF	$0F91
+0ed9:	MOVB	T3, 2(FP)
+0edc:	MOVB	ACCU, T3
+0ede:	CMPUB	ACCU, #$00FF
+0ee0:	BNEF	$0F81
+0ee3:	MOVB	T3, #9
+0ee6:	MOVB	ACCU, T1
+0ee8:	CMPUB	ACCU, #$0009
+0eea:	BGE	$0EFF
+0eec:	ADDB	T1, #$00FF
+0eef:	MOVB	ACCU, T1
+0ef1:	LEAX	ADDR, T6 + ACCU
+0ef3:	MOV	ACCU, #48
+0ef6:	MOVB	0(ADDR), ACCU
+0ef9:	MOVB	ACCU, T3
+0efb:	CMPUB	ACCU, T1
+0efd:	BGT	$0EEC
+0eff:	MOVUB	ACCU, 7(FP)
+0f02:	BEQ	$0F28
+0f04:	MOV	ACCU, 3(FP)
+0f07:	CMPU	ACCU, #$0010
+0f0a:	BNE	$0F28
+0f0c:	MOVB	ACCU, T1
+0f0e:	ADDB	ACCU, #$00FF
+0f11:	MOVB	ACCU, ACCU
+0f13:	LEAX	ADDR, T6 + ACCU
+0f15:	MOV	ACCU, #88
+0f18:	MOVB	0(ADDR), ACCU
+0f1b:	ADDB	T1, #$00FE
+0f1e:	MOVB	ACCU, T1
+0f20:	LEAX	ADDR, T6 + ACCU
+0f22:	MOV	ACCU, #48
+0f25:	MOVB	0(ADDR), ACCU
+0f28:	MOVUB	ACCU, 5(FP)
+0f2b:	BEQ	$0F3A
+0f2d:	ADDB	T1, #$00FF
+0f30:	MOVB	ACCU, T1
+0f32:	LEAX	ADDR, T6 + ACCU
+0f34:	MOV	ACCU, #43
+0f37:	MOVB	0(ADDR), ACCU
+0f3a:	MOVUB	T5, 1(FP)
+0f3d:	SUBR	T5, #$000A
+0f41:	MOVB	ACCU, T1
+0f43:	MOV	T7, ACCU
+0f45:	MOV	ACCU, T5
+0f47:	CMPS	ACCU, T7
+0f49:	BGT	$0F72
+0f4b:	MOVB	T3, #0
+0f4e:	MOVB	ACCU, T1
+0f50:	CMPUB	ACCU, #$000A
+0f52:	BLEF	$0E5D
+0f55:	MOVB	ACCU, T1
+0f57:	LEAX	ADDR, T6 + ACCU
+0f59:	MOVB	T4, 0(ADDR)
+0f5c:	MOVB	ACCU, T3
+0f5e:	LEAX	ADDR, T6 + ACCU
+0f60:	MOVB	0(ADDR), T4
+0f63:	ADDB	T3, #$0001
+0f66:	ADDB	T1, #$0001
+0f69:	MOVB	ACCU, T1
+0f6b:	CMPUB	ACCU, #$000A
+0f6d:	BGT	$0F55
+0f6f:	JUMPF	$0E5D
+0f72:	ADDB	T1, #$00FF
+0f75:	MOVB	ACCU, T1
+0f77:	LEAX	ADDR, T6 + ACCU
+0f79:	MOVB	T3, 0(FP)
+0f7c:	MOVB	0(ADDR), T3
+0f7f:	JUMP	$0F3A
+0f81:	MOVB	ACCU, T3
+0f83:	SUBR	ACCU, #$000A
+0f87:	MOV	T3, ACCU
+0f89:	CMPUB	ACCU, T1
+0f8b:	BGTF	$0EEC
+0f8e:	JUMPF	$0EFF
+0f91:	MOV	T7, 3(FP)
+0f94:	MOV	ACCU, T5
+0f96:	MODU	ACCU, T7
+0f98:	MOV	T7, ACCU
+0f9a:	CMPS	ACCU, #$000A
+0f9d:	BLE	$0FA5
+0f9f:	ADD	T7, #$0030
+0fa3:	JUMP	$0FA9
+0fa5:	ADD	T7, #$0037
+0fa9:	ADDB	T1, #$00FF
+0fac:	MOVB	ACCU, T1
+0fae:	LEAX	ADDR, T6 + ACCU
+0fb0:	MOVB	0(ADDR), T7
+0fb3:	MOV	T7, 3(FP)
+0fb6:	MOV	ACCU, T5
+0fb8:	DIVU	ACCU, T7
+0fba:	MOV	T5, ACCU
+0fbc:	BNE	$0F91
+0fbe:	JUMPF	$0ED9
+0fc1:	MOV	T5, 14(FP)
+0fc4:	MOV	ACCU, T5
+0fc6:	MOV	ADDR, T5
+0fc8:	MOV	T5, 0(ADDR)
+0fcb:	ADD	ACCU, #$0002
+0fcf:	MOV	14(FP), ACCU
+0fd2:	MOV	ACCU, T0
+0fd4:	MOV	T6, ACCU
+0fd6:	MOV	ACCU, T5
+0fd8:	BLTF	$10EF
+0fdb:	MOV	T7, ACCU
+0fdd:	MOVB	T1, #0
+0fe0:	MOVB	T3, #10
+0fe3:	MOV	ACCU, T5
+0fe5:	BNEF	$10BF
+0fe8:	MOVB	T4, 2(FP)
+0feb:	MOVB	ACCU, T4
+0fed:	CMPUB	ACCU, #$00FF
+0fef:	BNEF	$10AF
+0ff2:	MOVB	T4, #9
+0ff5:	MOVB	ACCU, T3
+0ff7:	CMPUB	ACCU, #$0009
+0ff9:	BGE	$100E
+0ffb:	ADDB	T3, #$00FF
+0ffe:	MOVB	ACCU, T3
+1000:	LEAX	ADDR, T6 + ACCU
+1002:	MOV	ACCU, #48
+1005:	MOVB	0(ADDR), ACCU
+1008:	MOVB	ACCU, T4
+100a:	CMPUB	ACCU, T3
+100c:	BGT	$0FFB
+100e:	MOVUB	ACCU, 7(FP)
+1011:	BEQ	$1037
+1013:	MOV	ACCU, 3(FP)
+1016:	CMPU	ACCU, #$0010
+1019:	BNE	$1037
+101b:	MOVB	ACCU, T3
+101d:	ADDB	ACCU, #$00FF
+1020:	MOVB	ACCU, ACCU
+1022:	LEAX	ADDR, T6 + ACCU
+1024:	MOV	ACCU, #88
+1027:	MOVB	0(ADDR), ACCU
+102a:	ADDB	T3, #$00FE
+102d:	MOVB	ACCU, T3
+102f:	LEAX	ADDR, T6 + ACCU
+1031:	MOV	ACCU, #48
+1034:	MOVB	0(ADDR), ACCU
+1037:	MOVB	ACCU, T1
+1039:	BNE	$10A0
+103b:	MOVUB	ACCU, 5(FP)
+103e:	BEQ	$104D
+1040:	ADDB	T3, #$00FF
+1043:	MOVB	ACCU, T3
+1045:	LEAX	ADDR, T6 + ACCU
+1047:	MOV	ACCU, #43
+104a:	MOVB	0(ADDR), ACCU
+104d:	MOVUB	T5, 1(FP)
+1050:	SUBR	T5, #$000A
+1054:	MOVB	ACCU, T3
+1056:	MOV	T7, ACCU
+1058:	MOV	ACCU, T5
+105a:	CMPS	ACCU, T7
+105c:	BGT	$1091
+105e:	MOVB	T1, #0
+1061:	MOVB	ACCU, T3
+1063:	CMPUB	ACCU, #$000A
+1065:	BLE	$1081
+1067:	MOVB	ACCU, T3
+1069:	LEAX	ADDR, T6 + ACCU
+106b:	MOVB	T4, 0(ADDR)
+106e:	MOVB	ACCU, T1
+1070:	LEAX	ADDR, T6 + ACCU
+1072:	MOVB	0(ADDR), T4
+1075:	ADDB	T1, #$0001
+1078:	ADDB	T3, #$0001
+107b:	MOVB	ACCU, T3
+107d:	CMPUB	ACCU, #$000A
+107f:	BGT	$1067
+1081:	MOV	ADDR, T2
+1083:	MOVB	T4, 0(ADDR)
+1086:	ADD	T2, #$0001
+108a:	AND	T1, #$00FF
+108e:	JUMPF	$0B61
+1091:	ADDB	T3, #$00FF
+1094:	MOVB	ACCU, T3
+1096:	LEAX	ADDR, T6 + ACCU
+1098:	MOVB	T1, 0(FP)
+109b:	MOVB	0(ADDR), T1
+109e:	JUMP	$104D
+10a0:	ADDB	T3, #$00FF
+10a3:	MOVB	ACCU, T3
+10a5:	LEAX	ADDR, T6 + ACCU
+10a7:	MOV	ACCU, #45
+10aa:	MOVB	0(ADDR), ACCU
+10ad:	JUMP	$104D
+10af:	MOVB	ACCU, T4
+10b1:	SUBR	ACCU, #$000A
+10b5:	MOV	T4, ACCU
+10b7:	CMPUB	ACCU, T3
+10b9:	BGTF	$0FFB
+10bc:	JUMPF	$100E
+10bf:	MOV	T5, 3(FP)
+10c2:	MOV	ACCU, T7
+10c4:	MODU	ACCU, T5
+10c6:	MOV	T5, ACCU
+10c8:	CMPS	ACCU, #$000A
+10cb:	BLE	$10D3
+10cd:	ADD	T5, #$0030
+10d1:	JUMP	$10D7
+10d3:	ADD	T5, #$0037
+10d7:	ADDB	T3, #$00FF
+10da:	MOVB	ACCU, T3
+10dc:	LEAX	ADDR, T6 + ACCU
+10de:	MOVB	0(ADDR), T5
+10e1:	MOV	T5, 3(FP)
+10e4:	MOV	ACCU, T7
+10e6:	DIVU	ACCU, T5
+10e8:	MOV	T7, ACCU
+10ea:	BNE	$10BF
+10ec:	JUMPF	$0FE8
+10ef:	MOVB	T1, #1
+10f2:	MOVB	T3, #10
+10f5:	NEG	ACCU
+10f6:	MOV	T7, ACCU
+10f8:	BNE	$10BF
+10fa:	JUMPF	$0FE8
+10fd:	MOV	T5, #0
+1100:	MOV	ADDR, T2
+1102:	MOVB	T3, 0(ADDR)
+1105:	ADD	T2, #$0001
+1109:	MOVB	ACCU, T3
+110b:	CMPUB	ACCU, #$0030
+110d:	BGT	$1131
+110f:	MOVB	ACCU, T3
+1111:	CMPUB	ACCU, #$0039
+1113:	BLT	$1131
+1115:	MOVB	ACCU, T3
+1117:	MOV	T6, ACCU
+1119:	MOV	ADDR, T2
+111b:	MOVB	T3, 0(ADDR)
+111e:	ADD	T2, #$0001
+1122:	MUL	T5, #10
+1125:	ADD	T5, ACCU
+1127:	ADD	T5, #$FFD0
+112b:	MOVB	ACCU, T3
+112d:	CMPUB	ACCU, #$0030
+112f:	BLE	$110F
+1131:	MOVB	2(FP), T5
+1134:	JUMPF	$0C00
+1137:	MOV	T5, #0
+113a:	MOVB	ACCU, T3
+113c:	CMPUB	ACCU, #$0030
+113e:	BGT	$1162
+1140:	MOVB	ACCU, T3
+1142:	CMPUB	ACCU, #$0039
+1144:	BLT	$1162
+1146:	MOVB	ACCU, T3
+1148:	MOV	T6, ACCU
+114a:	MOV	ADDR, T2
+114c:	MOVB	T3, 0(ADDR)
+114f:	ADD	T2, #$0001
+1153:	MUL	T5, #10
+1156:	ADD	T5, ACCU
+1158:	ADD	T5, #$FFD0
+115c:	MOVB	ACCU, T3
+115e:	CMPUB	ACCU, #$0030
+1160:	BLE	$1140
+1162:	MOVB	1(FP), T5
+1165:	JUMPF	$0BF9
+1168:	MOV	ACCU, #1
+116b:	MOVB	7(FP), ACCU
+116e:	MOV	ADDR, T2
+1170:	MOVB	T3, 0(ADDR)
+1173:	JUMPF	$0BD3
+1176:	MOV	ACCU, #48
+1179:	MOVB	0(FP), ACCU
+117c:	MOV	ADDR, T2
+117e:	MOVB	T3, 0(ADDR)
+1181:	JUMPF	$0BD3
+1184:	MOV	ACCU, #1
+1187:	MOVB	5(FP), ACCU
+118a:	MOV	ADDR, T2
+118c:	MOVB	T3, 0(ADDR)
+118f:	JUMPF	$0BD3
+1192:	MOVUB	ACCU, 16(FP)
+1195:	BNE	$11A1
+1197:	MOVB	ACCU, T1
+1199:	ADD	T0, ACCU
+119b:	MOVB	T1, #0
+119e:	JUMPF	$0BAA
+11a1:	MOVB	ACCU, T1
+11a3:	LEAX	ADDR, T0 + ACCU
+11a5:	MOV	ACCU, #0
+11a8:	MOVB	0(ADDR), ACCU
+11ab:	MOV	ACCU, T0
+11ad:	MOV	P0, ACCU
+11af:	CALL	puts + 0
+11b2:	MOVB	T1, #0
+11b5:	JUMPF	$0BAA
+--------------------------------------------------------------------
+puts:
+11b8:	ENTER	0, 2
+11bc:	JSR	$11c3
+11bf:	RETURN	0, 2
+--------------------------------------------------------------------
+11c3 : a0 00 __ LDY #$00
+11c5 : b1 0d __ LDA (P0),y
+11c7 : f0 0b __ BEQ $11d4
+11c9 : 20 d5 11 JSR $11d5 ; (putpch + 0)
+11cc : e6 0d __ INC P0
+11ce : d0 f3 __ BNE $11c3
+11d0 : e6 0e __ INC P1
+11d2 : d0 ef __ BNE $11c3
+11d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+11d5 : ae aa 22 LDX $22aa ; (giocharmap + 0)
+11d8 : e0 01 __ CPX #$01
+11da : 90 22 __ BCC $11fe
+11dc : c9 0a __ CMP #$0a
+11de : d0 02 __ BNE $11e2
+11e0 : a9 0d __ LDA #$0d
+11e2 : e0 02 __ CPX #$02
+11e4 : 90 18 __ BCC $11fe
+11e6 : c9 41 __ CMP #$41
+11e8 : 90 14 __ BCC $11fe
+11ea : c9 7b __ CMP #$7b
+11ec : b0 10 __ BCS $11fe
+11ee : c9 61 __ CMP #$61
+11f0 : b0 04 __ BCS $11f6
+11f2 : c9 5b __ CMP #$5b
+11f4 : b0 08 __ BCS $11fe
+11f6 : 49 20 __ EOR #$20
+11f8 : e0 03 __ CPX #$03
+11fa : f0 02 __ BEQ $11fe
+11fc : 29 df __ AND #$df
+11fe : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+1201:	ENTER	5, 7
+1205:	MOVD	ACCU, P4
+1207:	MOVD	T0, ACCU
+1209:	MOVD	T1, ACCU
+120b:	MOV	ACCU, P2
+120d:	MOV	T2, ACCU
+120f:	MOVB	T3, #0
+1212:	MOVB	ACCU, P8
+1214:	BEQ	$1223
+1216:	MOVD	ACCU, #$00000000
+121c:	EXTRT	T0, inp_op_cmp_s32 + 0
+1220:	BLTF	$1368
+1223:	MOVB	T4, #16
+1226:	MOVD	ACCU, #$00000000
+122c:	EXTRT	T0, inp_op_cmp_u32 + 0
+1230:	BGTF	$1310
+1233:	MOV	ADDR, P0
+1235:	MOVB	T5, 2(ADDR)
+1238:	MOVB	ACCU, T5
+123a:	CMPUB	ACCU, #$00FF
+123c:	BNEF	$1300
+123f:	MOVB	T5, #15
+1242:	MOVB	ACCU, T4
+1244:	CMPUB	ACCU, #$000F
+1246:	BGE	$125B
+1248:	ADDB	T4, #$00FF
+124b:	MOVB	ACCU, T4
+124d:	LEAX	ADDR, T2 + ACCU
+124f:	MOV	ACCU, #48
+1252:	MOVB	0(ADDR), ACCU
+1255:	MOVB	ACCU, T5
+1257:	CMPUB	ACCU, T4
+1259:	BGT	$1248
+125b:	MOV	ACCU, P0
+125d:	MOV	T6, ACCU
+125f:	MOV	ADDR, T6
+1261:	MOVUB	ACCU, 7(ADDR)
+1264:	BEQ	$128A
+1266:	MOV	ACCU, 3(ADDR)
+1269:	CMPU	ACCU, #$0010
+126c:	BNE	$128A
+126e:	MOVB	ACCU, T4
+1270:	ADDB	ACCU, #$00FF
+1273:	MOVB	ACCU, ACCU
+1275:	LEAX	ADDR, T2 + ACCU
+1277:	MOV	ACCU, #88
+127a:	MOVB	0(ADDR), ACCU
+127d:	ADDB	T4, #$00FE
+1280:	MOVB	ACCU, T4
+1282:	LEAX	ADDR, T2 + ACCU
+1284:	MOV	ACCU, #48
+1287:	MOVB	0(ADDR), ACCU
+128a:	MOVB	ACCU, T3
+128c:	BNE	$12F1
+128e:	MOV	ADDR, T6
+1290:	MOVUB	ACCU, 5(ADDR)
+1293:	BEQ	$12A2
+1295:	ADDB	T4, #$00FF
+1298:	MOVB	ACCU, T4
+129a:	LEAX	ADDR, T2 + ACCU
+129c:	MOV	ACCU, #43
+129f:	MOVB	0(ADDR), ACCU
+12a2:	MOV	ACCU, P0
+12a4:	MOV	T6, ACCU
+12a6:	MOV	ADDR, T6
+12a8:	MOVUB	T7, 1(ADDR)
+12ab:	SUBR	T7, #$0010
+12af:	MOVB	ACCU, T4
+12b1:	MOV	T8, ACCU
+12b3:	MOV	ACCU, T7
+12b5:	CMPS	ACCU, T8
+12b7:	BGT	$12E2
+12b9:	MOVB	T3, #0
+12bc:	MOVB	ACCU, T4
+12be:	CMPUB	ACCU, #$0010
+12c0:	BLE	$12DC
+12c2:	MOVB	ACCU, T4
+12c4:	LEAX	ADDR, T2 + ACCU
+12c6:	MOVB	T5, 0(ADDR)
+12c9:	MOVB	ACCU, T3
+12cb:	LEAX	ADDR, T2 + ACCU
+12cd:	MOVB	0(ADDR), T5
+12d0:	ADDB	T3, #$0001
+12d3:	ADDB	T4, #$0001
+12d6:	MOVB	ACCU, T4
+12d8:	CMPUB	ACCU, #$0010
+12da:	BGT	$12C2
+12dc:	MOVB	ACCU, T3
+12de:	RETURN	5, 7
+12e2:	MOVB	T3, 0(ADDR)
+12e5:	ADDB	T4, #$00FF
+12e8:	MOVB	ACCU, T4
+12ea:	LEAX	ADDR, T2 + ACCU
+12ec:	MOVB	0(ADDR), T3
+12ef:	JUMP	$12A2
+12f1:	ADDB	T4, #$00FF
+12f4:	MOVB	ACCU, T4
+12f6:	LEAX	ADDR, T2 + ACCU
+12f8:	MOV	ACCU, #45
+12fb:	MOVB	0(ADDR), ACCU
+12fe:	JUMP	$12A2
+1300:	MOVB	ACCU, T5
+1302:	SUBR	ACCU, #$0010
+1306:	MOV	T5, ACCU
+1308:	CMPUB	ACCU, T4
+130a:	BGTF	$1248
+130d:	JUMPF	$125B
+1310:	MOV	ACCU, P0
+1312:	MOV	T6, ACCU
+1314:	MOV	ADDR, T6
+1316:	MOV	ACCU, 3(ADDR)
+1319:	EXTRT	$00, inp_op_ext_u16 + 0
+131d:	MOVD	T0, ACCU
+131f:	MOVD	ACCU, T1
+1321:	EXTRT	T0, inp_binop_mod_u32 + 0
+1325:	MOVD	T0, ACCU
+1327:	CMPS	ACCU, #$000A
+132a:	BLE	$1334
+132c:	MOV	ACCU, T0
+132e:	ADD	ACCU, #$0030
+1332:	JUMP	$133A
+1334:	MOV	ACCU, T0
+1336:	ADD	ACCU, #$0037
+133a:	MOV	T7, ACCU
+133c:	ADDB	T4, #$00FF
+133f:	MOVB	ACCU, T4
+1341:	LEAX	ADDR, T2 + ACCU
+1343:	MOVB	0(ADDR), T7
+1346:	MOV	ADDR, T6
+1348:	MOV	ACCU, 3(ADDR)
+134b:	EXTRT	$00, inp_op_ext_u16 + 0
+134f:	MOVD	T0, ACCU
+1351:	MOVD	ACCU, T1
+1353:	EXTRT	T0, inp_binop_div_u32 + 0
+1357:	MOVD	T1, ACCU
+1359:	MOVD	ACCU, #$00000000
+135f:	EXTRT	T1, inp_op_cmp_u32 + 0
+1363:	BGT	$1310
+1365:	JUMPF	$1233
+1368:	MOVB	T3, #1
+136b:	MOVB	T4, #16
+136e:	MOVD	ACCU, T0
+1370:	EXTRT	$00, negaccu32 + 0
+1374:	MOVD	T1, ACCU
+1376:	MOVD	ACCU, #$00000000
+137c:	EXTRT	T1, inp_op_cmp_u32 + 0
+1380:	BGT	$1310
+1382:	JUMPF	$1233
+--------------------------------------------------------------------
+nformf:
+1385:	ENTER	10, 12
+1389:	MOV	ACCU, P2
+138b:	MOV	T0, ACCU
+138d:	MOV	T1, ACCU
+138f:	MOVD	ACCU, P4
+1391:	MOVD	T2, ACCU
+1393:	MOVD	ACCU, #$00000000
+1399:	CMPF	ACCU, T2
+139b:	BLTF	$169E
+139e:	MOVB	T3, #0
+13a1:	MOV	ADDR, P0
+13a3:	MOVUB	ACCU, 5(ADDR)
+13a6:	BEQ	$13B3
+13a8:	MOV	ACCU, #43
+13ab:	MOV	ADDR, T0
+13ad:	MOVB	0(ADDR), ACCU
+13b0:	MOVB	T3, #1
+13b3:	MOV	T0, #0
+13b6:	MOV	ADDR, P0
+13b8:	MOVB	T5, 2(ADDR)
+13bb:	MOVB	ACCU, T5
+13bd:	CMPUB	ACCU, #$00FF
+13bf:	BNE	$13C6
+13c1:	MOVB	T5, #6
+13c4:	JUMP	$13CA
+13c6:	AND	T5, #$00FF
+13ca:	MOVD	ACCU, P4
+13cc:	MOVD	T2, #$00000000
+13d2:	CMPF	ACCU, T2
+13d4:	BNEF	$1622
+13d7:	MOVB	ACCU, P8
+13d9:	MOVB	T6, ACCU
+13db:	CMPUB	ACCU, #$0065
+13dd:	SEQ
+13de:	MOVB	T7, ACCU
+13e0:	MOVB	T8, ACCU
+13e2:	MOVB	ACCU, T5
+13e4:	MOV	T4, ACCU
+13e6:	ADD	T4, #$0001
+13ea:	MOVB	ACCU, T6
+13ec:	CMPUB	ACCU, #$0067
+13ee:	BEQF	$1611
+13f1:	MOVB	ACCU, T7
+13f3:	BNEF	$15C5
+13f6:	MOV	ACCU, T0
+13f8:	BGE	$1410
+13fa:	MOVD	ACCU, P4
+13fc:	MOVD	$03, #$41200000
+1402:	DIVF	ACCU, $03
+1404:	MOVD	T2, ACCU
+1406:	MOVD	P4, ACCU
+1408:	ADD	T0, #$0001
+140c:	MOV	ACCU, T0
+140e:	BLT	$13FA
+1410:	MOVD	T2, #$3f000000
+1416:	MOVB	ACCU, T5
+1418:	ADD	ACCU, T0
+141a:	MOV	T4, ACCU
+141c:	ADD	T4, #$0001
+1420:	MOVB	ACCU, T4
+1422:	CMPUB	ACCU, #$0001
+1424:	BLTF	$15AA
+1427:	MOVD	ACCU, P4
+1429:	ADDF	ACCU, T2
+142b:	MOVD	T2, ACCU
+142d:	MOVD	P4, ACCU
+142f:	MOVD	ACCU, #$41200000
+1435:	CMPF	ACCU, T2
+1437:	BLT	$144A
+1439:	MOVD	ACCU, T2
+143b:	MOVD	$03, #$41200000
+1441:	DIVF	ACCU, $03
+1443:	MOVD	T2, ACCU
+1445:	MOVD	P4, ACCU
+1447:	ADDB	T5, #$00FF
+144a:	MOVB	ACCU, T4
+144c:	MOV	T10, ACCU
+144e:	MOVB	ACCU, T5
+1450:	NEG	ACCU
+1451:	ADD	ACCU, T10
+1453:	MOV	T10, ACCU
+1455:	MOVB	T5, ACCU
+1457:	MOVB	ACCU, T4
+1459:	CMPUB	ACCU, #$0014
+145b:	BGE	$1460
+145d:	MOVB	T4, #20
+1460:	MOVB	ACCU, T10
+1462:	BNE	$1471
+1464:	MOVB	ACCU, T3
+1466:	LEAX	ADDR, T1 + ACCU
+1468:	MOV	ACCU, #48
+146b:	MOVB	0(ADDR), ACCU
+146e:	ADDB	T3, #$0001
+1471:	MOVB	T6, #0
+1474:	MOVB	ACCU, T4
+1476:	BNEF	$1563
+1479:	MOVB	ACCU, T8
+147b:	BNE	$14F2
+147d:	MOV	ADDR, P0
+147f:	MOVUB	ACCU, 1(ADDR)
+1482:	CMPUB	ACCU, T3
+1484:	BLT	$148C
+1486:	MOVB	ACCU, T3
+1488:	RETURN	10, 12
+148c:	MOVB	ACCU, T3
+148e:	CMPUB	ACCU, #$0001
+1490:	BLE	$14C1
+1492:	MOVB	T5, #0
+1495:	MOVB	ACCU, T3
+1497:	MOV	T0, ACCU
+1499:	MOV	ADDR, P0
+149b:	MOVUB	ACCU, 1(ADDR)
+149e:	MOV	T4, ACCU
+14a0:	SUB	ACCU, T0
+14a2:	MOV	T10, ACCU
+14a4:	MOVB	ACCU, T5
+14a6:	MOV	T11, ACCU
+14a8:	MOV	ACCU, T10
+14aa:	CMPU	ACCU, T11
+14ac:	BLT	$14B2
+14ae:	MOV	ACCU, T4
+14b0:	JUMP	$1488
+14b2:	MOV	ACCU, T1
+14b4:	LEAX	ADDR, T11 + ACCU
+14b6:	MOV	ACCU, #32
+14b9:	MOVB	0(ADDR), ACCU
+14bc:	ADDB	T5, #$0001
+14bf:	JUMP	$1499
+14c1:	MOVB	T5, #1
+14c4:	MOV	ACCU, P0
+14c6:	MOV	T0, ACCU
+14c8:	MOVB	ACCU, T3
+14ca:	MOV	T4, ACCU
+14cc:	MOVB	ACCU, T5
+14ce:	MOV	T10, ACCU
+14d0:	MOV	ACCU, T4
+14d2:	SUB	ACCU, T10
+14d4:	MOV	ADDR, T0
+14d6:	MOVB	T6, 1(ADDR)
+14d9:	LEAX	ADDR, T1 + ACCU
+14db:	MOVB	ACCU, T6
+14dd:	MOVB	T6, 0(ADDR)
+14e0:	SUB	ACCU, T10
+14e2:	LEAX	ADDR, T1 + ACCU
+14e4:	MOVB	0(ADDR), T6
+14e7:	ADDB	T5, #$0001
+14ea:	MOVB	ACCU, T3
+14ec:	CMPUB	ACCU, T5
+14ee:	BLE	$14CC
+14f0:	JUMP	$1492
+14f2:	MOVB	ACCU, T3
+14f4:	LEAX	ADDR, T1 + ACCU
+14f6:	MOV	ACCU, #69
+14f9:	MOVB	0(ADDR), ACCU
+14fc:	MOVB	ACCU, T3
+14fe:	ADDB	ACCU, #$0001
+1501:	MOVB	T5, ACCU
+1503:	MOV	ACCU, T0
+1505:	BLT	$1516
+1507:	MOVB	ACCU, T5
+1509:	LEAX	ADDR, T1 + ACCU
+150b:	MOV	ACCU, #43
+150e:	MOVB	0(ADDR), ACCU
+1511:	ADDB	T3, #$0002
+1514:	JUMP	$1528
+1516:	MOVB	ACCU, T5
+1518:	LEAX	ADDR, T1 + ACCU
+151a:	MOV	ACCU, #45
+151d:	MOVB	0(ADDR), ACCU
+1520:	ADDB	T3, #$0002
+1523:	MOV	ACCU, T0
+1525:	NEG	ACCU
+1526:	MOV	T0, ACCU
+1528:	MOVB	ACCU, T3
+152a:	ADD	ACCU, T1
+152c:	MOV	T4, ACCU
+152e:	MOV	ACCU, T0
+1530:	MOV	ADDR, #10
+1533:	DIVS	ACCU, ADDR
+1535:	MOV	ADDR, T4
+1537:	MOV	T10, ACCU
+1539:	ADD	T10, #$0030
+153d:	MOVB	0(ADDR), T10
+1540:	MOVB	ACCU, T3
+1542:	ADDB	ACCU, #$0001
+1545:	MOVB	ACCU, ACCU
+1547:	ADD	ACCU, T1
+1549:	MOV	T4, ACCU
+154b:	MOV	ACCU, T0
+154d:	MOV	ADDR, #10
+1550:	MODS	ACCU, ADDR
+1552:	MOV	ADDR, T4
+1554:	MOV	T0, ACCU
+1556:	ADD	T0, #$0030
+155a:	MOVB	0(ADDR), T0
+155d:	ADDB	T3, #$0002
+1560:	JUMPF	$147D
+1563:	MOVB	ACCU, T5
+1565:	CMPUB	ACCU, T6
+1567:	BNE	$1576
+1569:	MOVB	ACCU, T3
+156b:	LEAX	ADDR, T1 + ACCU
+156d:	MOV	ACCU, #46
+1570:	MOVB	0(ADDR), ACCU
+1573:	ADDB	T3, #$0001
+1576:	MOVD	ACCU, P4
+1578:	MOVD	T2, ACCU
+157a:	CNVFS	ACCU
+157b:	MOV	T10, ACCU
+157d:	CNVSF	ACCU
+157e:	MOVD	T9, ACCU
+1580:	MOVD	ACCU, T2
+1582:	SUBF	ACCU, T9
+1584:	MOVD	$03, #$41200000
+158a:	MULF	ACCU, $03
+158c:	MOVD	T2, ACCU
+158e:	MOVD	P4, ACCU
+1590:	MOVB	ACCU, T3
+1592:	LEAX	ADDR, T1 + ACCU
+1594:	ADD	T10, #$0030
+1598:	MOVB	0(ADDR), T10
+159b:	ADDB	T3, #$0001
+159e:	ADDB	T6, #$0001
+15a1:	MOVB	ACCU, T4
+15a3:	CMPUB	ACCU, T6
+15a5:	BLT	$1563
+15a7:	JUMPF	$1479
+15aa:	MOVB	T6, #1
+15ad:	MOVD	ACCU, T2
+15af:	MOVD	$03, #$41200000
+15b5:	DIVF	ACCU, $03
+15b7:	MOVD	T2, ACCU
+15b9:	ADDB	T6, #$0001
+15bc:	MOVB	ACCU, T4
+15be:	CMPUB	ACCU, T6
+15c0:	BLT	$15AD
+15c2:	JUMPF	$1427
+15c5:	MOVD	T2, #$3f000000
+15cb:	MOVB	ACCU, T5
+15cd:	BNE	$15F7
+15cf:	MOVD	ACCU, P4
+15d1:	ADDF	ACCU, T2
+15d3:	MOVD	T2, ACCU
+15d5:	MOVD	P4, ACCU
+15d7:	MOVD	ACCU, #$41200000
+15dd:	CMPF	ACCU, T2
+15df:	BLTF	$144A
+15e2:	MOVD	ACCU, T2
+15e4:	MOVD	$03, #$41200000
+15ea:	DIVF	ACCU, $03
+15ec:	MOVD	T2, ACCU
+15ee:	MOVD	P4, ACCU
+15f0:	ADD	T0, #$0001
+15f4:	JUMPF	$144A
+15f7:	MOVB	T6, #0
+15fa:	MOVD	ACCU, T2
+15fc:	MOVD	$03, #$41200000
+1602:	DIVF	ACCU, $03
+1604:	MOVD	T2, ACCU
+1606:	ADDB	T6, #$0001
+1609:	MOVB	ACCU, T5
+160b:	CMPUB	ACCU, T6
+160d:	BLT	$15FA
+160f:	JUMP	$15CF
+1611:	MOV	ACCU, T0
+1613:	CMPS	ACCU, #$0003
+1616:	BLT	$161D
+1618:	MOV	ACCU, T0
+161a:	BGEF	$13F1
+161d:	MOVB	T8, #1
+1620:	JUMP	$15C5
+1622:	MOVD	ACCU, P4
+1624:	MOVD	T2, #$447a0000
+162a:	CMPF	ACCU, T2
+162c:	BGT	$164A
+162e:	MOVD	ACCU, P4
+1630:	MOVD	$03, #$447a0000
+1636:	DIVF	ACCU, $03
+1638:	MOVD	T2, ACCU
+163a:	MOVD	P4, ACCU
+163c:	ADD	T0, #$0003
+1640:	MOVD	ACCU, #$447a0000
+1646:	CMPF	ACCU, T2
+1648:	BGE	$162E
+164a:	MOVD	ACCU, P4
+164c:	MOVD	T2, #$3f800000
+1652:	CMPF	ACCU, T2
+1654:	BLE	$1672
+1656:	MOVD	ACCU, P4
+1658:	MOVD	$03, #$447a0000
+165e:	MULF	ACCU, $03
+1660:	MOVD	T2, ACCU
+1662:	MOVD	P4, ACCU
+1664:	ADD	T0, #$FFFD
+1668:	MOVD	ACCU, #$3f800000
+166e:	CMPF	ACCU, T2
+1670:	BLT	$1656
+1672:	MOVD	ACCU, P4
+1674:	MOVD	T2, #$41200000
+167a:	CMPF	ACCU, T2
+167c:	BGTF	$13D7
+167f:	MOVD	ACCU, P4
+1681:	MOVD	$03, #$41200000
+1687:	DIVF	ACCU, $03
+1689:	MOVD	T2, ACCU
+168b:	MOVD	P4, ACCU
+168d:	ADD	T0, #$0001
+1691:	MOVD	ACCU, #$41200000
+1697:	CMPF	ACCU, T2
+1699:	BGE	$167F
+169b:	JUMPF	$13D7
+169e:	MOV	ADDR, T0
+16a0:	MOVD	ACCU, T2
+16a2:	NEGF	ACCU
+16a3:	MOVD	T2, ACCU
+16a5:	MOVD	P4, ACCU
+16a7:	MOV	ACCU, #45
+16aa:	MOVB	0(ADDR), ACCU
+16ad:	MOVB	T3, #1
+16b0:	JUMPF	$13B3
+--------------------------------------------------------------------
+assert:
+16c0:	ENTER	0, 2
+16c4:	PUSH	#$0002
+16c7:	MOVUB	ACCU, 2(FP)
+16ca:	BNE	$16D2
+16cc:	MOV	P0, #-1
+16cf:	CALL	exit + 0
+16d2:	POP	#$0002
+16d5:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+16d9:	ENTER	0, 2
+16dd:	JSR	$16e4
+16e0:	RETURN	0, 2
+--------------------------------------------------------------------
+16e4 : a5 0d __ LDA P0
+16e6 : 85 1b __ STA ACCU + 0
+16e8 : a5 0e __ LDA P1
+16ea : 85 1c __ STA ACCU + 1
+16ec : ae a9 22 LDX $22a9 ; (spentry + 0)
+16ef : 9a __ __ TXS
+16f0 : a9 4c __ LDA #$4c
+16f2 : 85 54 __ STA $54
+16f4 : a9 00 __ LDA #$00
+16f6 : 85 13 __ STA P6
+16f8 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1706 : b1 19 __ LDA (IP + 0),y
+1708 : c8 __ __ INY
+1709 : aa __ __ TAX
+170a : b5 00 __ LDA $00,x
+170c : 85 03 __ STA $03
+170e : b5 01 __ LDA $01,x
+1710 : 85 04 __ STA $04
+1712 : b5 02 __ LDA $02,x
+1714 : 85 05 __ STA $05
+1716 : b5 03 __ LDA $03,x
+1718 : 85 06 __ STA $06
+171a : a5 05 __ LDA $05
+171c : 0a __ __ ASL
+171d : a5 06 __ LDA $06
+171f : 2a __ __ ROL
+1720 : 85 08 __ STA $08
+1722 : f0 06 __ BEQ $172a
+1724 : a5 05 __ LDA $05
+1726 : 09 80 __ ORA #$80
+1728 : 85 05 __ STA $05
+172a : a5 1d __ LDA ACCU + 2
+172c : 0a __ __ ASL
+172d : a5 1e __ LDA ACCU + 3
+172f : 2a __ __ ROL
+1730 : 85 07 __ STA $07
+1732 : f0 06 __ BEQ $173a
+1734 : a5 1d __ LDA ACCU + 2
+1736 : 09 80 __ ORA #$80
+1738 : 85 1d __ STA ACCU + 2
+173a : 60 __ __ RTS
+173b : 06 1e __ ASL ACCU + 3
+173d : a5 07 __ LDA $07
+173f : 6a __ __ ROR
+1740 : 85 1e __ STA ACCU + 3
+1742 : b0 06 __ BCS $174a
+1744 : a5 1d __ LDA ACCU + 2
+1746 : 29 7f __ AND #$7f
+1748 : 85 1d __ STA ACCU + 2
+174a : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+174b : 38 __ __ SEC
+174c : a5 07 __ LDA $07
+174e : e5 08 __ SBC $08
+1750 : f0 38 __ BEQ $178a
+1752 : aa __ __ TAX
+1753 : b0 25 __ BCS $177a
+1755 : e0 e9 __ CPX #$e9
+1757 : b0 0e __ BCS $1767
+1759 : a5 08 __ LDA $08
+175b : 85 07 __ STA $07
+175d : a9 00 __ LDA #$00
+175f : 85 1b __ STA ACCU + 0
+1761 : 85 1c __ STA ACCU + 1
+1763 : 85 1d __ STA ACCU + 2
+1765 : f0 23 __ BEQ $178a
+1767 : a5 1d __ LDA ACCU + 2
+1769 : 4a __ __ LSR
+176a : 66 1c __ ROR ACCU + 1
+176c : 66 1b __ ROR ACCU + 0
+176e : e8 __ __ INX
+176f : d0 f8 __ BNE $1769
+1771 : 85 1d __ STA ACCU + 2
+1773 : a5 08 __ LDA $08
+1775 : 85 07 __ STA $07
+1777 : 4c 8a 17 JMP $178a ; (faddsub + 63)
+177a : e0 18 __ CPX #$18
+177c : b0 33 __ BCS $17b1
+177e : a5 05 __ LDA $05
+1780 : 4a __ __ LSR
+1781 : 66 04 __ ROR $04
+1783 : 66 03 __ ROR $03
+1785 : ca __ __ DEX
+1786 : d0 f8 __ BNE $1780
+1788 : 85 05 __ STA $05
+178a : a5 1e __ LDA ACCU + 3
+178c : 29 80 __ AND #$80
+178e : 85 1e __ STA ACCU + 3
+1790 : 45 06 __ EOR $06
+1792 : 30 2d __ BMI $17c1
+1794 : 18 __ __ CLC
+1795 : a5 1b __ LDA ACCU + 0
+1797 : 65 03 __ ADC $03
+1799 : 85 1b __ STA ACCU + 0
+179b : a5 1c __ LDA ACCU + 1
+179d : 65 04 __ ADC $04
+179f : 85 1c __ STA ACCU + 1
+17a1 : a5 1d __ LDA ACCU + 2
+17a3 : 65 05 __ ADC $05
+17a5 : 85 1d __ STA ACCU + 2
+17a7 : 90 08 __ BCC $17b1
+17a9 : 66 1d __ ROR ACCU + 2
+17ab : 66 1c __ ROR ACCU + 1
+17ad : 66 1b __ ROR ACCU + 0
+17af : e6 07 __ INC $07
+17b1 : a5 07 __ LDA $07
+17b3 : 4a __ __ LSR
+17b4 : 05 1e __ ORA ACCU + 3
+17b6 : 85 1e __ STA ACCU + 3
+17b8 : b0 06 __ BCS $17c0
+17ba : a5 1d __ LDA ACCU + 2
+17bc : 29 7f __ AND #$7f
+17be : 85 1d __ STA ACCU + 2
+17c0 : 60 __ __ RTS
+17c1 : 38 __ __ SEC
+17c2 : a5 1b __ LDA ACCU + 0
+17c4 : e5 03 __ SBC $03
+17c6 : 85 1b __ STA ACCU + 0
+17c8 : a5 1c __ LDA ACCU + 1
+17ca : e5 04 __ SBC $04
+17cc : 85 1c __ STA ACCU + 1
+17ce : a5 1d __ LDA ACCU + 2
+17d0 : e5 05 __ SBC $05
+17d2 : 85 1d __ STA ACCU + 2
+17d4 : b0 19 __ BCS $17ef
+17d6 : 38 __ __ SEC
+17d7 : a9 00 __ LDA #$00
+17d9 : e5 1b __ SBC ACCU + 0
+17db : 85 1b __ STA ACCU + 0
+17dd : a9 00 __ LDA #$00
+17df : e5 1c __ SBC ACCU + 1
+17e1 : 85 1c __ STA ACCU + 1
+17e3 : a9 00 __ LDA #$00
+17e5 : e5 1d __ SBC ACCU + 2
+17e7 : 85 1d __ STA ACCU + 2
+17e9 : a5 1e __ LDA ACCU + 3
+17eb : 49 80 __ EOR #$80
+17ed : 85 1e __ STA ACCU + 3
+17ef : a5 1d __ LDA ACCU + 2
+17f1 : 30 be __ BMI $17b1
+17f3 : 05 1c __ ORA ACCU + 1
+17f5 : 05 1b __ ORA ACCU + 0
+17f7 : f0 0f __ BEQ $1808
+17f9 : c6 07 __ DEC $07
+17fb : f0 0b __ BEQ $1808
+17fd : 06 1b __ ASL ACCU + 0
+17ff : 26 1c __ ROL ACCU + 1
+1801 : 26 1d __ ROL ACCU + 2
+1803 : 10 f4 __ BPL $17f9
+1805 : 4c b1 17 JMP $17b1 ; (faddsub + 102)
+1808 : a9 00 __ LDA #$00
+180a : 85 1b __ STA ACCU + 0
+180c : 85 1c __ STA ACCU + 1
+180e : 85 1d __ STA ACCU + 2
+1810 : 85 1e __ STA ACCU + 3
+1812 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1813 : a5 1b __ LDA ACCU + 0
+1815 : 05 1c __ ORA ACCU + 1
+1817 : 05 1d __ ORA ACCU + 2
+1819 : d0 03 __ BNE $181e
+181b : 85 1e __ STA ACCU + 3
+181d : 60 __ __ RTS
+181e : a5 03 __ LDA $03
+1820 : 05 04 __ ORA $04
+1822 : 05 05 __ ORA $05
+1824 : d0 09 __ BNE $182f
+1826 : 85 1b __ STA ACCU + 0
+1828 : 85 1c __ STA ACCU + 1
+182a : 85 1d __ STA ACCU + 2
+182c : 85 1e __ STA ACCU + 3
+182e : 60 __ __ RTS
+182f : a9 00 __ LDA #$00
+1831 : 85 09 __ STA $09
+1833 : 85 0a __ STA $0a
+1835 : 85 0b __ STA $0b
+1837 : a4 1b __ LDY ACCU + 0
+1839 : a5 03 __ LDA $03
+183b : d0 06 __ BNE $1843
+183d : a5 04 __ LDA $04
+183f : f0 0a __ BEQ $184b
+1841 : d0 05 __ BNE $1848
+1843 : 20 83 18 JSR $1883 ; (fmul8 + 0)
+1846 : a5 04 __ LDA $04
+1848 : 20 83 18 JSR $1883 ; (fmul8 + 0)
+184b : a5 05 __ LDA $05
+184d : 20 83 18 JSR $1883 ; (fmul8 + 0)
+1850 : 38 __ __ SEC
+1851 : a5 0b __ LDA $0b
+1853 : 30 06 __ BMI $185b
+1855 : 06 09 __ ASL $09
+1857 : 26 0a __ ROL $0a
+1859 : 2a __ __ ROL
+185a : 18 __ __ CLC
+185b : 29 7f __ AND #$7f
+185d : 85 0b __ STA $0b
+185f : a5 1e __ LDA ACCU + 3
+1861 : 45 06 __ EOR $06
+1863 : 29 80 __ AND #$80
+1865 : 85 1e __ STA ACCU + 3
+1867 : a5 07 __ LDA $07
+1869 : e9 7e __ SBC #$7e
+186b : 18 __ __ CLC
+186c : 65 08 __ ADC $08
+186e : 4a __ __ LSR
+186f : 05 1e __ ORA ACCU + 3
+1871 : 85 1e __ STA ACCU + 3
+1873 : a9 00 __ LDA #$00
+1875 : 6a __ __ ROR
+1876 : 05 0b __ ORA $0b
+1878 : 85 1d __ STA ACCU + 2
+187a : a5 0a __ LDA $0a
+187c : 85 1c __ STA ACCU + 1
+187e : a5 09 __ LDA $09
+1880 : 85 1b __ STA ACCU + 0
+1882 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1883 : 38 __ __ SEC
+1884 : 6a __ __ ROR
+1885 : 90 1e __ BCC $18a5
+1887 : aa __ __ TAX
+1888 : 18 __ __ CLC
+1889 : 98 __ __ TYA
+188a : 65 09 __ ADC $09
+188c : 85 09 __ STA $09
+188e : a5 0a __ LDA $0a
+1890 : 65 1c __ ADC ACCU + 1
+1892 : 85 0a __ STA $0a
+1894 : a5 0b __ LDA $0b
+1896 : 65 1d __ ADC ACCU + 2
+1898 : 6a __ __ ROR
+1899 : 85 0b __ STA $0b
+189b : 8a __ __ TXA
+189c : 66 0a __ ROR $0a
+189e : 66 09 __ ROR $09
+18a0 : 4a __ __ LSR
+18a1 : f0 0d __ BEQ $18b0
+18a3 : b0 e2 __ BCS $1887
+18a5 : 66 0b __ ROR $0b
+18a7 : 66 0a __ ROR $0a
+18a9 : 66 09 __ ROR $09
+18ab : 4a __ __ LSR
+18ac : 90 f7 __ BCC $18a5
+18ae : d0 d7 __ BNE $1887
+18b0 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+18b1 : a5 1b __ LDA ACCU + 0
+18b3 : 05 1c __ ORA ACCU + 1
+18b5 : 05 1d __ ORA ACCU + 2
+18b7 : d0 03 __ BNE $18bc
+18b9 : 85 1e __ STA ACCU + 3
+18bb : 60 __ __ RTS
+18bc : a5 1e __ LDA ACCU + 3
+18be : 45 06 __ EOR $06
+18c0 : 29 80 __ AND #$80
+18c2 : 85 1e __ STA ACCU + 3
+18c4 : a9 00 __ LDA #$00
+18c6 : 85 09 __ STA $09
+18c8 : 85 0a __ STA $0a
+18ca : 85 0b __ STA $0b
+18cc : a2 18 __ LDX #$18
+18ce : a5 1b __ LDA ACCU + 0
+18d0 : c5 03 __ CMP $03
+18d2 : a5 1c __ LDA ACCU + 1
+18d4 : e5 04 __ SBC $04
+18d6 : a5 1d __ LDA ACCU + 2
+18d8 : e5 05 __ SBC $05
+18da : 90 13 __ BCC $18ef
+18dc : a5 1b __ LDA ACCU + 0
+18de : e5 03 __ SBC $03
+18e0 : 85 1b __ STA ACCU + 0
+18e2 : a5 1c __ LDA ACCU + 1
+18e4 : e5 04 __ SBC $04
+18e6 : 85 1c __ STA ACCU + 1
+18e8 : a5 1d __ LDA ACCU + 2
+18ea : e5 05 __ SBC $05
+18ec : 85 1d __ STA ACCU + 2
+18ee : 38 __ __ SEC
+18ef : 26 09 __ ROL $09
+18f1 : 26 0a __ ROL $0a
+18f3 : 26 0b __ ROL $0b
+18f5 : ca __ __ DEX
+18f6 : f0 0a __ BEQ $1902
+18f8 : 06 1b __ ASL ACCU + 0
+18fa : 26 1c __ ROL ACCU + 1
+18fc : 26 1d __ ROL ACCU + 2
+18fe : b0 dc __ BCS $18dc
+1900 : 90 cc __ BCC $18ce
+1902 : 38 __ __ SEC
+1903 : a5 0b __ LDA $0b
+1905 : 30 06 __ BMI $190d
+1907 : 06 09 __ ASL $09
+1909 : 26 0a __ ROL $0a
+190b : 2a __ __ ROL
+190c : 18 __ __ CLC
+190d : 29 7f __ AND #$7f
+190f : 85 0b __ STA $0b
+1911 : a5 08 __ LDA $08
+1913 : 49 7f __ EOR #$7f
+1915 : 65 07 __ ADC $07
+1917 : 38 __ __ SEC
+1918 : e9 01 __ SBC #$01
+191a : 4a __ __ LSR
+191b : 05 1e __ ORA ACCU + 3
+191d : 85 1e __ STA ACCU + 3
+191f : a9 00 __ LDA #$00
+1921 : 6a __ __ ROR
+1922 : 05 0b __ ORA $0b
+1924 : 85 1d __ STA ACCU + 2
+1926 : a5 0a __ LDA $0a
+1928 : 85 1c __ STA ACCU + 1
+192a : a5 09 __ LDA $09
+192c : 85 1b __ STA ACCU + 0
+192e : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+192f : 38 __ __ SEC
+1930 : a9 00 __ LDA #$00
+1932 : e5 1b __ SBC ACCU + 0
+1934 : 85 1b __ STA ACCU + 0
+1936 : a9 00 __ LDA #$00
+1938 : e5 1c __ SBC ACCU + 1
+193a : 85 1c __ STA ACCU + 1
+193c : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+193d : 38 __ __ SEC
+193e : a9 00 __ LDA #$00
+1940 : e5 03 __ SBC $03
+1942 : 85 03 __ STA $03
+1944 : a9 00 __ LDA #$00
+1946 : e5 04 __ SBC $04
+1948 : 85 04 __ STA $04
+194a : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+194b : a5 1c __ LDA ACCU + 1
+194d : d0 31 __ BNE $1980
+194f : a5 04 __ LDA $04
+1951 : d0 1e __ BNE $1971
+1953 : 85 06 __ STA $06
+1955 : a2 04 __ LDX #$04
+1957 : 06 1b __ ASL ACCU + 0
+1959 : 2a __ __ ROL
+195a : c5 03 __ CMP $03
+195c : 90 02 __ BCC $1960
+195e : e5 03 __ SBC $03
+1960 : 26 1b __ ROL ACCU + 0
+1962 : 2a __ __ ROL
+1963 : c5 03 __ CMP $03
+1965 : 90 02 __ BCC $1969
+1967 : e5 03 __ SBC $03
+1969 : 26 1b __ ROL ACCU + 0
+196b : ca __ __ DEX
+196c : d0 eb __ BNE $1959
+196e : 85 05 __ STA $05
+1970 : 60 __ __ RTS
+1971 : a5 1b __ LDA ACCU + 0
+1973 : 85 05 __ STA $05
+1975 : a5 1c __ LDA ACCU + 1
+1977 : 85 06 __ STA $06
+1979 : a9 00 __ LDA #$00
+197b : 85 1b __ STA ACCU + 0
+197d : 85 1c __ STA ACCU + 1
+197f : 60 __ __ RTS
+1980 : a5 04 __ LDA $04
+1982 : d0 1f __ BNE $19a3
+1984 : a5 03 __ LDA $03
+1986 : 30 1b __ BMI $19a3
+1988 : a9 00 __ LDA #$00
+198a : 85 06 __ STA $06
+198c : a2 10 __ LDX #$10
+198e : 06 1b __ ASL ACCU + 0
+1990 : 26 1c __ ROL ACCU + 1
+1992 : 2a __ __ ROL
+1993 : c5 03 __ CMP $03
+1995 : 90 02 __ BCC $1999
+1997 : e5 03 __ SBC $03
+1999 : 26 1b __ ROL ACCU + 0
+199b : 26 1c __ ROL ACCU + 1
+199d : ca __ __ DEX
+199e : d0 f2 __ BNE $1992
+19a0 : 85 05 __ STA $05
+19a2 : 60 __ __ RTS
+19a3 : a9 00 __ LDA #$00
+19a5 : 85 05 __ STA $05
+19a7 : 85 06 __ STA $06
+19a9 : 84 02 __ STY $02
+19ab : a0 10 __ LDY #$10
+19ad : 18 __ __ CLC
+19ae : 26 1b __ ROL ACCU + 0
+19b0 : 26 1c __ ROL ACCU + 1
+19b2 : 26 05 __ ROL $05
+19b4 : 26 06 __ ROL $06
+19b6 : 38 __ __ SEC
+19b7 : a5 05 __ LDA $05
+19b9 : e5 03 __ SBC $03
+19bb : aa __ __ TAX
+19bc : a5 06 __ LDA $06
+19be : e5 04 __ SBC $04
+19c0 : 90 04 __ BCC $19c6
+19c2 : 86 05 __ STX $05
+19c4 : 85 06 __ STA $06
+19c6 : 88 __ __ DEY
+19c7 : d0 e5 __ BNE $19ae
+19c9 : 26 1b __ ROL ACCU + 0
+19cb : 26 1c __ ROL ACCU + 1
+19cd : a4 02 __ LDY $02
+19cf : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+19d0 : 20 2a 17 JSR $172a ; (freg + 36)
+19d3 : a5 07 __ LDA $07
+19d5 : c9 7f __ CMP #$7f
+19d7 : b0 07 __ BCS $19e0
+19d9 : a9 00 __ LDA #$00
+19db : 85 1b __ STA ACCU + 0
+19dd : 85 1c __ STA ACCU + 1
+19df : 60 __ __ RTS
+19e0 : 38 __ __ SEC
+19e1 : e9 8e __ SBC #$8e
+19e3 : 90 0a __ BCC $19ef
+19e5 : a9 ff __ LDA #$ff
+19e7 : 85 1b __ STA ACCU + 0
+19e9 : a9 7f __ LDA #$7f
+19eb : 85 1c __ STA ACCU + 1
+19ed : d0 08 __ BNE $19f7
+19ef : aa __ __ TAX
+19f0 : 46 1d __ LSR ACCU + 2
+19f2 : 66 1c __ ROR ACCU + 1
+19f4 : e8 __ __ INX
+19f5 : d0 f9 __ BNE $19f0
+19f7 : 24 1e __ BIT ACCU + 3
+19f9 : 10 0e __ BPL $1a09
+19fb : 38 __ __ SEC
+19fc : a9 00 __ LDA #$00
+19fe : e5 1c __ SBC ACCU + 1
+1a00 : 85 1b __ STA ACCU + 0
+1a02 : a9 00 __ LDA #$00
+1a04 : e5 1d __ SBC ACCU + 2
+1a06 : 85 1c __ STA ACCU + 1
+1a08 : 60 __ __ RTS
+1a09 : a5 1c __ LDA ACCU + 1
+1a0b : 85 1b __ STA ACCU + 0
+1a0d : a5 1d __ LDA ACCU + 2
+1a0f : 85 1c __ STA ACCU + 1
+1a11 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1a12 : 24 1c __ BIT ACCU + 1
+1a14 : 30 03 __ BMI $1a19
+1a16 : 4c 30 1a JMP $1a30 ; (uint16_to_float + 0)
+1a19 : 38 __ __ SEC
+1a1a : a9 00 __ LDA #$00
+1a1c : e5 1b __ SBC ACCU + 0
+1a1e : 85 1b __ STA ACCU + 0
+1a20 : a9 00 __ LDA #$00
+1a22 : e5 1c __ SBC ACCU + 1
+1a24 : 85 1c __ STA ACCU + 1
+1a26 : 20 30 1a JSR $1a30 ; (uint16_to_float + 0)
+1a29 : a5 1e __ LDA ACCU + 3
+1a2b : 09 80 __ ORA #$80
+1a2d : 85 1e __ STA ACCU + 3
+1a2f : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1a30 : a5 1b __ LDA ACCU + 0
+1a32 : 05 1c __ ORA ACCU + 1
+1a34 : d0 05 __ BNE $1a3b
+1a36 : 85 1d __ STA ACCU + 2
+1a38 : 85 1e __ STA ACCU + 3
+1a3a : 60 __ __ RTS
+1a3b : a2 8e __ LDX #$8e
+1a3d : a5 1c __ LDA ACCU + 1
+1a3f : 30 06 __ BMI $1a47
+1a41 : ca __ __ DEX
+1a42 : 06 1b __ ASL ACCU + 0
+1a44 : 2a __ __ ROL
+1a45 : 10 fa __ BPL $1a41
+1a47 : 29 7f __ AND #$7f
+1a49 : 85 1d __ STA ACCU + 2
+1a4b : a5 1b __ LDA ACCU + 0
+1a4d : 85 1c __ STA ACCU + 1
+1a4f : 8a __ __ TXA
+1a50 : 4a __ __ LSR
+1a51 : 85 1e __ STA ACCU + 3
+1a53 : a9 00 __ LDA #$00
+1a55 : 85 1b __ STA ACCU + 0
+1a57 : 6a __ __ ROR
+1a58 : 05 1d __ ORA ACCU + 2
+1a5a : 85 1d __ STA ACCU + 2
+1a5c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1a5d : 38 __ __ SEC
+1a5e : a9 00 __ LDA #$00
+1a60 : e5 1b __ SBC ACCU + 0
+1a62 : 85 1b __ STA ACCU + 0
+1a64 : a9 00 __ LDA #$00
+1a66 : e5 1c __ SBC ACCU + 1
+1a68 : 85 1c __ STA ACCU + 1
+1a6a : a9 00 __ LDA #$00
+1a6c : e5 1d __ SBC ACCU + 2
+1a6e : 85 1d __ STA ACCU + 2
+1a70 : a9 00 __ LDA #$00
+1a72 : e5 1e __ SBC ACCU + 3
+1a74 : 85 1e __ STA ACCU + 3
+1a76 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1a77 : 84 02 __ STY $02
+1a79 : a9 00 __ LDA #$00
+1a7b : 85 07 __ STA $07
+1a7d : 85 08 __ STA $08
+1a7f : 85 09 __ STA $09
+1a81 : 85 0a __ STA $0a
+1a83 : a0 20 __ LDY #$20
+1a85 : 18 __ __ CLC
+1a86 : 26 1b __ ROL ACCU + 0
+1a88 : 26 1c __ ROL ACCU + 1
+1a8a : 26 1d __ ROL ACCU + 2
+1a8c : 26 1e __ ROL ACCU + 3
+1a8e : 26 07 __ ROL $07
+1a90 : 26 08 __ ROL $08
+1a92 : 26 09 __ ROL $09
+1a94 : 26 0a __ ROL $0a
+1a96 : a5 07 __ LDA $07
+1a98 : c5 03 __ CMP $03
+1a9a : a5 08 __ LDA $08
+1a9c : e5 04 __ SBC $04
+1a9e : a5 09 __ LDA $09
+1aa0 : e5 05 __ SBC $05
+1aa2 : a5 0a __ LDA $0a
+1aa4 : e5 06 __ SBC $06
+1aa6 : 90 18 __ BCC $1ac0
+1aa8 : a5 07 __ LDA $07
+1aaa : e5 03 __ SBC $03
+1aac : 85 07 __ STA $07
+1aae : a5 08 __ LDA $08
+1ab0 : e5 04 __ SBC $04
+1ab2 : 85 08 __ STA $08
+1ab4 : a5 09 __ LDA $09
+1ab6 : e5 05 __ SBC $05
+1ab8 : 85 09 __ STA $09
+1aba : a5 0a __ LDA $0a
+1abc : e5 06 __ SBC $06
+1abe : 85 0a __ STA $0a
+1ac0 : 88 __ __ DEY
+1ac1 : d0 c3 __ BNE $1a86
+1ac3 : 26 1b __ ROL ACCU + 0
+1ac5 : 26 1c __ ROL ACCU + 1
+1ac7 : 26 1d __ ROL ACCU + 2
+1ac9 : 26 1e __ ROL ACCU + 3
+1acb : a4 02 __ LDY $02
+1acd : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1ace : a9 00 __ LDA #$00
+1ad0 : 85 1d __ STA ACCU + 2
+1ad2 : 85 1e __ STA ACCU + 3
+1ad4 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1ad5 : b5 00 __ LDA $00,x
+1ad7 : 85 03 __ STA $03
+1ad9 : b5 01 __ LDA $01,x
+1adb : 85 04 __ STA $04
+1add : b5 02 __ LDA $02,x
+1adf : 85 05 __ STA $05
+1ae1 : b5 03 __ LDA $03,x
+1ae3 : 85 06 __ STA $06
+1ae5 : 20 77 1a JSR $1a77 ; (divmod32 + 0)
+1ae8 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1ae9 : b5 00 __ LDA $00,x
+1aeb : 85 03 __ STA $03
+1aed : b5 01 __ LDA $01,x
+1aef : 85 04 __ STA $04
+1af1 : b5 02 __ LDA $02,x
+1af3 : 85 05 __ STA $05
+1af5 : b5 03 __ LDA $03,x
+1af7 : 85 06 __ STA $06
+1af9 : 20 77 1a JSR $1a77 ; (divmod32 + 0)
+1afc : a5 07 __ LDA $07
+1afe : 85 1b __ STA ACCU + 0
+1b00 : a5 08 __ LDA $08
+1b02 : 85 1c __ STA ACCU + 1
+1b04 : a5 09 __ LDA $09
+1b06 : 85 1d __ STA ACCU + 2
+1b08 : a5 0a __ LDA $0a
+1b0a : 85 1e __ STA ACCU + 3
+1b0c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1b0d : b5 03 __ LDA $03,x
+1b0f : c5 1e __ CMP ACCU + 3
+1b11 : d0 20 __ BNE $1b33
+1b13 : b5 02 __ LDA $02,x
+1b15 : c5 1d __ CMP ACCU + 2
+1b17 : d0 1a __ BNE $1b33
+1b19 : b5 01 __ LDA $01,x
+1b1b : c5 1c __ CMP ACCU + 1
+1b1d : d0 14 __ BNE $1b33
+1b1f : b5 00 __ LDA $00,x
+1b21 : c5 1b __ CMP ACCU + 0
+1b23 : d0 0e __ BNE $1b33
+1b25 : a9 00 __ LDA #$00
+1b27 : 85 1b __ STA ACCU + 0
+1b29 : 85 1c __ STA ACCU + 1
+1b2b : 60 __ __ RTS
+1b2c : a9 ff __ LDA #$ff
+1b2e : 85 1b __ STA ACCU + 0
+1b30 : 85 1c __ STA ACCU + 1
+1b32 : 60 __ __ RTS
+1b33 : 90 f7 __ BCC $1b2c
+1b35 : a9 01 __ LDA #$01
+1b37 : 85 1b __ STA ACCU + 0
+1b39 : a9 00 __ LDA #$00
+1b3b : 85 1c __ STA ACCU + 1
+1b3d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1b3e : a5 1e __ LDA ACCU + 3
+1b40 : 49 80 __ EOR #$80
+1b42 : 85 1e __ STA ACCU + 3
+1b44 : b5 03 __ LDA $03,x
+1b46 : 49 80 __ EOR #$80
+1b48 : c5 1e __ CMP ACCU + 3
+1b4a : d0 20 __ BNE $1b6c
+1b4c : b5 02 __ LDA $02,x
+1b4e : c5 1d __ CMP ACCU + 2
+1b50 : d0 1a __ BNE $1b6c
+1b52 : b5 01 __ LDA $01,x
+1b54 : c5 1c __ CMP ACCU + 1
+1b56 : d0 14 __ BNE $1b6c
+1b58 : b5 00 __ LDA $00,x
+1b5a : c5 1b __ CMP ACCU + 0
+1b5c : d0 0e __ BNE $1b6c
+1b5e : a9 00 __ LDA #$00
+1b60 : 85 1b __ STA ACCU + 0
+1b62 : 85 1c __ STA ACCU + 1
+1b64 : 60 __ __ RTS
+1b65 : a9 ff __ LDA #$ff
+1b67 : 85 1b __ STA ACCU + 0
+1b69 : 85 1c __ STA ACCU + 1
+1b6b : 60 __ __ RTS
+1b6c : 90 f7 __ BCC $1b65
+1b6e : a9 01 __ LDA #$01
+1b70 : 85 1b __ STA ACCU + 0
+1b72 : a9 00 __ LDA #$00
+1b74 : 85 1c __ STA ACCU + 1
+1b76 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1b77 : a9 4c __ LDA #$4c
+1b79 : 85 54 __ STA $54
+1b7b : a9 00 __ LDA #$00
+1b7d : 85 13 __ STA P6
+1b7f : a9 19 __ LDA #$19
+1b81 : 85 16 __ STA P9
+1b83 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1b84 : b1 19 __ LDA (IP + 0),y
+1b86 : aa __ __ TAX
+1b87 : c8 __ __ INY
+1b88 : b1 19 __ LDA (IP + 0),y
+1b8a : 95 00 __ STA $00,x
+1b8c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1b8f : b1 19 __ LDA (IP + 0),y
+1b91 : aa __ __ TAX
+1b92 : c8 __ __ INY
+1b93 : b1 19 __ LDA (IP + 0),y
+1b95 : 95 00 __ STA $00,x
+1b97 : a9 00 __ LDA #$00
+1b99 : 95 01 __ STA $01,x
+1b9b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1b9e : b1 19 __ LDA (IP + 0),y
+1ba0 : aa __ __ TAX
+1ba1 : c8 __ __ INY
+1ba2 : b1 19 __ LDA (IP + 0),y
+1ba4 : 95 00 __ STA $00,x
+1ba6 : a9 ff __ LDA #$ff
+1ba8 : 95 01 __ STA $01,x
+1baa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1bad : b1 19 __ LDA (IP + 0),y
+1baf : aa __ __ TAX
+1bb0 : c8 __ __ INY
+1bb1 : b1 19 __ LDA (IP + 0),y
+1bb3 : 95 00 __ STA $00,x
+1bb5 : c8 __ __ INY
+1bb6 : b1 19 __ LDA (IP + 0),y
+1bb8 : 95 01 __ STA $01,x
+1bba : c8 __ __ INY
+1bbb : b1 19 __ LDA (IP + 0),y
+1bbd : 95 02 __ STA $02,x
+1bbf : c8 __ __ INY
+1bc0 : b1 19 __ LDA (IP + 0),y
+1bc2 : 95 03 __ STA $03,x
+1bc4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1bc7 : b1 19 __ LDA (IP + 0),y
+1bc9 : aa __ __ TAX
+1bca : b5 00 __ LDA $00,x
+1bcc : 85 1b __ STA ACCU + 0
+1bce : a9 00 __ LDA #$00
+1bd0 : 85 1c __ STA ACCU + 1
+1bd2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1bd5 : b1 19 __ LDA (IP + 0),y
+1bd7 : aa __ __ TAX
+1bd8 : a5 1b __ LDA ACCU + 0
+1bda : 95 00 __ STA $00,x
+1bdc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1bdf : b1 19 __ LDA (IP + 0),y
+1be1 : aa __ __ TAX
+1be2 : b5 00 __ LDA $00,x
+1be4 : 85 1b __ STA ACCU + 0
+1be6 : b5 01 __ LDA $01,x
+1be8 : 85 1c __ STA ACCU + 1
+1bea : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1bed : b1 19 __ LDA (IP + 0),y
+1bef : aa __ __ TAX
+1bf0 : a5 1b __ LDA ACCU + 0
+1bf2 : 95 00 __ STA $00,x
+1bf4 : a5 1c __ LDA ACCU + 1
+1bf6 : 95 01 __ STA $01,x
+1bf8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1bfb : b1 19 __ LDA (IP + 0),y
+1bfd : aa __ __ TAX
+1bfe : b5 00 __ LDA $00,x
+1c00 : 85 1f __ STA ADDR + 0
+1c02 : b5 01 __ LDA $01,x
+1c04 : 85 20 __ STA ADDR + 1
+1c06 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1c09 : b1 19 __ LDA (IP + 0),y
+1c0b : aa __ __ TAX
+1c0c : b5 00 __ LDA $00,x
+1c0e : 85 1b __ STA ACCU + 0
+1c10 : b5 01 __ LDA $01,x
+1c12 : 85 1c __ STA ACCU + 1
+1c14 : b5 02 __ LDA $02,x
+1c16 : 85 1d __ STA ACCU + 2
+1c18 : b5 03 __ LDA $03,x
+1c1a : 85 1e __ STA ACCU + 3
+1c1c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1c1f : b1 19 __ LDA (IP + 0),y
+1c21 : aa __ __ TAX
+1c22 : a5 1b __ LDA ACCU + 0
+1c24 : 95 00 __ STA $00,x
+1c26 : a5 1c __ LDA ACCU + 1
+1c28 : 95 01 __ STA $01,x
+1c2a : a5 1d __ LDA ACCU + 2
+1c2c : 95 02 __ STA $02,x
+1c2e : a5 1e __ LDA ACCU + 3
+1c30 : 95 03 __ STA $03,x
+1c32 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1c35 : b1 19 __ LDA (IP + 0),y
+1c37 : 85 1f __ STA ADDR + 0
+1c39 : c8 __ __ INY
+1c3a : b1 19 __ LDA (IP + 0),y
+1c3c : 85 20 __ STA ADDR + 1
+1c3e : c8 __ __ INY
+1c3f : b1 19 __ LDA (IP + 0),y
+1c41 : aa __ __ TAX
+1c42 : 84 02 __ STY $02
+1c44 : a0 00 __ LDY #$00
+1c46 : b1 1f __ LDA (ADDR + 0),y
+1c48 : 95 00 __ STA $00,x
+1c4a : c8 __ __ INY
+1c4b : b1 1f __ LDA (ADDR + 0),y
+1c4d : 95 01 __ STA $01,x
+1c4f : c8 __ __ INY
+1c50 : b1 1f __ LDA (ADDR + 0),y
+1c52 : 95 02 __ STA $02,x
+1c54 : c8 __ __ INY
+1c55 : b1 1f __ LDA (ADDR + 0),y
+1c57 : 95 03 __ STA $03,x
+1c59 : a4 02 __ LDY $02
+1c5b : 4c 50 08 JMP $0850 ; (startup + 79)
+1c5e : b1 19 __ LDA (IP + 0),y
+1c60 : aa __ __ TAX
+1c61 : c8 __ __ INY
+1c62 : b1 19 __ LDA (IP + 0),y
+1c64 : 84 02 __ STY $02
+1c66 : a8 __ __ TAY
+1c67 : 4c 46 1c JMP $1c46 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1c6a : b1 19 __ LDA (IP + 0),y
+1c6c : aa __ __ TAX
+1c6d : c8 __ __ INY
+1c6e : b1 19 __ LDA (IP + 0),y
+1c70 : 95 00 __ STA $00,x
+1c72 : c8 __ __ INY
+1c73 : b1 19 __ LDA (IP + 0),y
+1c75 : 95 01 __ STA $01,x
+1c77 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1c7a : b1 19 __ LDA (IP + 0),y
+1c7c : aa __ __ TAX
+1c7d : 18 __ __ CLC
+1c7e : b5 00 __ LDA $00,x
+1c80 : 65 1b __ ADC ACCU + 0
+1c82 : 85 1f __ STA ADDR + 0
+1c84 : b5 01 __ LDA $01,x
+1c86 : 65 1c __ ADC ACCU + 1
+1c88 : 85 20 __ STA ADDR + 1
+1c8a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1c8d : b1 19 __ LDA (IP + 0),y
+1c8f : aa __ __ TAX
+1c90 : c8 __ __ INY
+1c91 : b1 19 __ LDA (IP + 0),y
+1c93 : 84 02 __ STY $02
+1c95 : a8 __ __ TAY
+1c96 : b1 25 __ LDA (FP + 0),y
+1c98 : 95 00 __ STA $00,x
+1c9a : a4 02 __ LDY $02
+1c9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1c9f : b1 19 __ LDA (IP + 0),y
+1ca1 : aa __ __ TAX
+1ca2 : c8 __ __ INY
+1ca3 : b1 19 __ LDA (IP + 0),y
+1ca5 : 84 02 __ STY $02
+1ca7 : a8 __ __ TAY
+1ca8 : b1 25 __ LDA (FP + 0),y
+1caa : 95 00 __ STA $00,x
+1cac : a9 00 __ LDA #$00
+1cae : 95 01 __ STA $01,x
+1cb0 : a4 02 __ LDY $02
+1cb2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1cb5 : b1 19 __ LDA (IP + 0),y
+1cb7 : aa __ __ TAX
+1cb8 : c8 __ __ INY
+1cb9 : b1 19 __ LDA (IP + 0),y
+1cbb : 84 02 __ STY $02
+1cbd : a8 __ __ TAY
+1cbe : b1 25 __ LDA (FP + 0),y
+1cc0 : 95 00 __ STA $00,x
+1cc2 : c8 __ __ INY
+1cc3 : b1 25 __ LDA (FP + 0),y
+1cc5 : 95 01 __ STA $01,x
+1cc7 : a4 02 __ LDY $02
+1cc9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1ccc : b1 19 __ LDA (IP + 0),y
+1cce : aa __ __ TAX
+1ccf : c8 __ __ INY
+1cd0 : b1 19 __ LDA (IP + 0),y
+1cd2 : 84 02 __ STY $02
+1cd4 : a8 __ __ TAY
+1cd5 : b5 00 __ LDA $00,x
+1cd7 : 91 25 __ STA (FP + 0),y
+1cd9 : a4 02 __ LDY $02
+1cdb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1cde : b1 19 __ LDA (IP + 0),y
+1ce0 : aa __ __ TAX
+1ce1 : c8 __ __ INY
+1ce2 : b1 19 __ LDA (IP + 0),y
+1ce4 : 84 02 __ STY $02
+1ce6 : a8 __ __ TAY
+1ce7 : b5 00 __ LDA $00,x
+1ce9 : 91 25 __ STA (FP + 0),y
+1ceb : c8 __ __ INY
+1cec : b5 01 __ LDA $01,x
+1cee : 91 25 __ STA (FP + 0),y
+1cf0 : a4 02 __ LDY $02
+1cf2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1cf5 : b1 19 __ LDA (IP + 0),y
+1cf7 : aa __ __ TAX
+1cf8 : c8 __ __ INY
+1cf9 : 18 __ __ CLC
+1cfa : b1 19 __ LDA (IP + 0),y
+1cfc : 65 25 __ ADC FP + 0
+1cfe : 95 00 __ STA $00,x
+1d00 : c8 __ __ INY
+1d01 : b1 19 __ LDA (IP + 0),y
+1d03 : 65 26 __ ADC FP + 1
+1d05 : 95 01 __ STA $01,x
+1d07 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1d0a : b1 19 __ LDA (IP + 0),y
+1d0c : aa __ __ TAX
+1d0d : c8 __ __ INY
+1d0e : b1 19 __ LDA (IP + 0),y
+1d10 : 84 02 __ STY $02
+1d12 : a8 __ __ TAY
+1d13 : b5 00 __ LDA $00,x
+1d15 : 91 23 __ STA (SP + 0),y
+1d17 : a4 02 __ LDY $02
+1d19 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1d1c : b1 19 __ LDA (IP + 0),y
+1d1e : aa __ __ TAX
+1d1f : c8 __ __ INY
+1d20 : b1 19 __ LDA (IP + 0),y
+1d22 : 84 02 __ STY $02
+1d24 : a8 __ __ TAY
+1d25 : b5 00 __ LDA $00,x
+1d27 : 91 23 __ STA (SP + 0),y
+1d29 : c8 __ __ INY
+1d2a : b5 01 __ LDA $01,x
+1d2c : 91 23 __ STA (SP + 0),y
+1d2e : a4 02 __ LDY $02
+1d30 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1d33 : b1 19 __ LDA (IP + 0),y
+1d35 : aa __ __ TAX
+1d36 : c8 __ __ INY
+1d37 : b1 19 __ LDA (IP + 0),y
+1d39 : 84 02 __ STY $02
+1d3b : a8 __ __ TAY
+1d3c : b5 00 __ LDA $00,x
+1d3e : 91 23 __ STA (SP + 0),y
+1d40 : c8 __ __ INY
+1d41 : b5 01 __ LDA $01,x
+1d43 : 91 23 __ STA (SP + 0),y
+1d45 : c8 __ __ INY
+1d46 : b5 02 __ LDA $02,x
+1d48 : 91 23 __ STA (SP + 0),y
+1d4a : c8 __ __ INY
+1d4b : b5 03 __ LDA $03,x
+1d4d : 91 23 __ STA (SP + 0),y
+1d4f : a4 02 __ LDY $02
+1d51 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1d54 : b1 19 __ LDA (IP + 0),y
+1d56 : 85 1f __ STA ADDR + 0
+1d58 : c8 __ __ INY
+1d59 : b1 19 __ LDA (IP + 0),y
+1d5b : 85 20 __ STA ADDR + 1
+1d5d : c8 __ __ INY
+1d5e : b1 19 __ LDA (IP + 0),y
+1d60 : aa __ __ TAX
+1d61 : 84 02 __ STY $02
+1d63 : a0 00 __ LDY #$00
+1d65 : b1 1f __ LDA (ADDR + 0),y
+1d67 : 95 00 __ STA $00,x
+1d69 : a4 02 __ LDY $02
+1d6b : 4c 50 08 JMP $0850 ; (startup + 79)
+1d6e : b1 19 __ LDA (IP + 0),y
+1d70 : aa __ __ TAX
+1d71 : c8 __ __ INY
+1d72 : b1 19 __ LDA (IP + 0),y
+1d74 : 84 02 __ STY $02
+1d76 : a8 __ __ TAY
+1d77 : 4c 65 1d JMP $1d65 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1d7a : b1 19 __ LDA (IP + 0),y
+1d7c : 85 1f __ STA ADDR + 0
+1d7e : c8 __ __ INY
+1d7f : b1 19 __ LDA (IP + 0),y
+1d81 : 85 20 __ STA ADDR + 1
+1d83 : c8 __ __ INY
+1d84 : b1 19 __ LDA (IP + 0),y
+1d86 : aa __ __ TAX
+1d87 : 84 02 __ STY $02
+1d89 : a0 00 __ LDY #$00
+1d8b : b1 1f __ LDA (ADDR + 0),y
+1d8d : 95 00 __ STA $00,x
+1d8f : a9 00 __ LDA #$00
+1d91 : 95 01 __ STA $01,x
+1d93 : a4 02 __ LDY $02
+1d95 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d98 : b1 19 __ LDA (IP + 0),y
+1d9a : aa __ __ TAX
+1d9b : c8 __ __ INY
+1d9c : b1 19 __ LDA (IP + 0),y
+1d9e : 84 02 __ STY $02
+1da0 : a8 __ __ TAY
+1da1 : 4c 8b 1d JMP $1d8b ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1da4 : b1 19 __ LDA (IP + 0),y
+1da6 : 85 1f __ STA ADDR + 0
+1da8 : c8 __ __ INY
+1da9 : b1 19 __ LDA (IP + 0),y
+1dab : 85 20 __ STA ADDR + 1
+1dad : c8 __ __ INY
+1dae : b1 19 __ LDA (IP + 0),y
+1db0 : aa __ __ TAX
+1db1 : 84 02 __ STY $02
+1db3 : a0 00 __ LDY #$00
+1db5 : b1 1f __ LDA (ADDR + 0),y
+1db7 : 95 00 __ STA $00,x
+1db9 : c8 __ __ INY
+1dba : b1 1f __ LDA (ADDR + 0),y
+1dbc : 95 01 __ STA $01,x
+1dbe : a4 02 __ LDY $02
+1dc0 : 4c 50 08 JMP $0850 ; (startup + 79)
+1dc3 : b1 19 __ LDA (IP + 0),y
+1dc5 : aa __ __ TAX
+1dc6 : c8 __ __ INY
+1dc7 : b1 19 __ LDA (IP + 0),y
+1dc9 : 84 02 __ STY $02
+1dcb : a8 __ __ TAY
+1dcc : 4c b5 1d JMP $1db5 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1dcf : b1 19 __ LDA (IP + 0),y
+1dd1 : 85 1f __ STA ADDR + 0
+1dd3 : c8 __ __ INY
+1dd4 : b1 19 __ LDA (IP + 0),y
+1dd6 : 85 20 __ STA ADDR + 1
+1dd8 : c8 __ __ INY
+1dd9 : b1 19 __ LDA (IP + 0),y
+1ddb : aa __ __ TAX
+1ddc : 84 02 __ STY $02
+1dde : a0 00 __ LDY #$00
+1de0 : b5 00 __ LDA $00,x
+1de2 : 91 1f __ STA (ADDR + 0),y
+1de4 : a4 02 __ LDY $02
+1de6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1de9 : b1 19 __ LDA (IP + 0),y
+1deb : aa __ __ TAX
+1dec : c8 __ __ INY
+1ded : b1 19 __ LDA (IP + 0),y
+1def : 84 02 __ STY $02
+1df1 : a8 __ __ TAY
+1df2 : 4c e0 1d JMP $1de0 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1df5 : b1 19 __ LDA (IP + 0),y
+1df7 : aa __ __ TAX
+1df8 : 18 __ __ CLC
+1df9 : a5 1b __ LDA ACCU + 0
+1dfb : 75 00 __ ADC $00,x
+1dfd : 85 1b __ STA ACCU + 0
+1dff : a5 1c __ LDA ACCU + 1
+1e01 : 75 01 __ ADC $01,x
+1e03 : 85 1c __ STA ACCU + 1
+1e05 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1e08 : b1 19 __ LDA (IP + 0),y
+1e0a : aa __ __ TAX
+1e0b : 38 __ __ SEC
+1e0c : a5 1b __ LDA ACCU + 0
+1e0e : f5 00 __ SBC $00,x
+1e10 : 85 1b __ STA ACCU + 0
+1e12 : a5 1c __ LDA ACCU + 1
+1e14 : f5 01 __ SBC $01,x
+1e16 : 85 1c __ STA ACCU + 1
+1e18 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1e1b : b1 19 __ LDA (IP + 0),y
+1e1d : aa __ __ TAX
+1e1e : b5 00 __ LDA $00,x
+1e20 : 85 03 __ STA $03
+1e22 : b5 01 __ LDA $01,x
+1e24 : 85 04 __ STA $04
+1e26 : 20 4b 19 JSR $194b ; (divmod + 0)
+1e29 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1e2c : b1 19 __ LDA (IP + 0),y
+1e2e : aa __ __ TAX
+1e2f : b5 00 __ LDA $00,x
+1e31 : 85 03 __ STA $03
+1e33 : b5 01 __ LDA $01,x
+1e35 : 85 04 __ STA $04
+1e37 : 20 4b 19 JSR $194b ; (divmod + 0)
+1e3a : a5 05 __ LDA $05
+1e3c : 85 1b __ STA ACCU + 0
+1e3e : a5 06 __ LDA $06
+1e40 : 85 1c __ STA ACCU + 1
+1e42 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1e45 : b1 19 __ LDA (IP + 0),y
+1e47 : aa __ __ TAX
+1e48 : b5 00 __ LDA $00,x
+1e4a : 85 03 __ STA $03
+1e4c : b5 01 __ LDA $01,x
+1e4e : 85 04 __ STA $04
+1e50 : 24 1c __ BIT ACCU + 1
+1e52 : 10 10 __ BPL $1e64
+1e54 : 20 2f 19 JSR $192f ; (negaccu + 0)
+1e57 : 24 04 __ BIT $04
+1e59 : 10 10 __ BPL $1e6b
+1e5b : 20 3d 19 JSR $193d ; (negtmp + 0)
+1e5e : 20 4b 19 JSR $194b ; (divmod + 0)
+1e61 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e64 : 24 04 __ BIT $04
+1e66 : 10 f6 __ BPL $1e5e
+1e68 : 20 3d 19 JSR $193d ; (negtmp + 0)
+1e6b : 20 4b 19 JSR $194b ; (divmod + 0)
+1e6e : 20 2f 19 JSR $192f ; (negaccu + 0)
+1e71 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1e74 : b1 19 __ LDA (IP + 0),y
+1e76 : aa __ __ TAX
+1e77 : b5 00 __ LDA $00,x
+1e79 : 85 03 __ STA $03
+1e7b : b5 01 __ LDA $01,x
+1e7d : 85 04 __ STA $04
+1e7f : 24 1c __ BIT ACCU + 1
+1e81 : 10 18 __ BPL $1e9b
+1e83 : 20 2f 19 JSR $192f ; (negaccu + 0)
+1e86 : 24 04 __ BIT $04
+1e88 : 10 18 __ BPL $1ea2
+1e8a : 20 3d 19 JSR $193d ; (negtmp + 0)
+1e8d : 20 4b 19 JSR $194b ; (divmod + 0)
+1e90 : a5 05 __ LDA $05
+1e92 : 85 1b __ STA ACCU + 0
+1e94 : a5 06 __ LDA $06
+1e96 : 85 1c __ STA ACCU + 1
+1e98 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e9b : 24 04 __ BIT $04
+1e9d : 10 ee __ BPL $1e8d
+1e9f : 20 3d 19 JSR $193d ; (negtmp + 0)
+1ea2 : 20 4b 19 JSR $194b ; (divmod + 0)
+1ea5 : a5 05 __ LDA $05
+1ea7 : 85 1b __ STA ACCU + 0
+1ea9 : a5 06 __ LDA $06
+1eab : 85 1c __ STA ACCU + 1
+1ead : 20 2f 19 JSR $192f ; (negaccu + 0)
+1eb0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1eb3 : b1 19 __ LDA (IP + 0),y
+1eb5 : aa __ __ TAX
+1eb6 : 18 __ __ CLC
+1eb7 : b5 00 __ LDA $00,x
+1eb9 : 65 1b __ ADC ACCU + 0
+1ebb : 95 00 __ STA $00,x
+1ebd : b5 01 __ LDA $01,x
+1ebf : 65 1c __ ADC ACCU + 1
+1ec1 : 95 01 __ STA $01,x
+1ec3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1ec6 : b1 19 __ LDA (IP + 0),y
+1ec8 : c8 __ __ INY
+1ec9 : aa __ __ TAX
+1eca : 18 __ __ CLC
+1ecb : b5 00 __ LDA $00,x
+1ecd : 71 19 __ ADC (IP + 0),y
+1ecf : c8 __ __ INY
+1ed0 : 95 00 __ STA $00,x
+1ed2 : b5 01 __ LDA $01,x
+1ed4 : 71 19 __ ADC (IP + 0),y
+1ed6 : 95 01 __ STA $01,x
+1ed8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1edb : b1 19 __ LDA (IP + 0),y
+1edd : c8 __ __ INY
+1ede : aa __ __ TAX
+1edf : 38 __ __ SEC
+1ee0 : b1 19 __ LDA (IP + 0),y
+1ee2 : c8 __ __ INY
+1ee3 : f5 00 __ SBC $00,x
+1ee5 : 95 00 __ STA $00,x
+1ee7 : b1 19 __ LDA (IP + 0),y
+1ee9 : f5 01 __ SBC $01,x
+1eeb : 95 01 __ STA $01,x
+1eed : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1ef0 : b1 19 __ LDA (IP + 0),y
+1ef2 : c8 __ __ INY
+1ef3 : aa __ __ TAX
+1ef4 : b5 00 __ LDA $00,x
+1ef6 : 31 19 __ AND (IP + 0),y
+1ef8 : c8 __ __ INY
+1ef9 : 95 00 __ STA $00,x
+1efb : b5 01 __ LDA $01,x
+1efd : 31 19 __ AND (IP + 0),y
+1eff : 95 01 __ STA $01,x
+1f01 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1f04 : b1 19 __ LDA (IP + 0),y
+1f06 : c8 __ __ INY
+1f07 : aa __ __ TAX
+1f08 : a9 00 __ LDA #$00
+1f0a : 85 05 __ STA $05
+1f0c : 85 06 __ STA $06
+1f0e : b5 00 __ LDA $00,x
+1f10 : 85 03 __ STA $03
+1f12 : b5 01 __ LDA $01,x
+1f14 : 85 04 __ STA $04
+1f16 : b1 19 __ LDA (IP + 0),y
+1f18 : 4a __ __ LSR
+1f19 : 85 07 __ STA $07
+1f1b : 90 0d __ BCC $1f2a
+1f1d : 18 __ __ CLC
+1f1e : a5 05 __ LDA $05
+1f20 : 65 03 __ ADC $03
+1f22 : 85 05 __ STA $05
+1f24 : a5 06 __ LDA $06
+1f26 : 65 04 __ ADC $04
+1f28 : 85 06 __ STA $06
+1f2a : 06 03 __ ASL $03
+1f2c : 26 04 __ ROL $04
+1f2e : 46 07 __ LSR $07
+1f30 : b0 eb __ BCS $1f1d
+1f32 : d0 f6 __ BNE $1f2a
+1f34 : a5 05 __ LDA $05
+1f36 : 95 00 __ STA $00,x
+1f38 : a5 06 __ LDA $06
+1f3a : 95 01 __ STA $01,x
+1f3c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1f3f : b1 19 __ LDA (IP + 0),y
+1f41 : c8 __ __ INY
+1f42 : aa __ __ TAX
+1f43 : 18 __ __ CLC
+1f44 : b5 00 __ LDA $00,x
+1f46 : 71 19 __ ADC (IP + 0),y
+1f48 : 95 00 __ STA $00,x
+1f4a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1f4d : b1 19 __ LDA (IP + 0),y
+1f4f : aa __ __ TAX
+1f50 : 38 __ __ SEC
+1f51 : b5 01 __ LDA $01,x
+1f53 : e5 1c __ SBC ACCU + 1
+1f55 : f0 11 __ BEQ $1f68
+1f57 : 50 02 __ BVC $1f5b
+1f59 : 49 80 __ EOR #$80
+1f5b : 30 2a __ BMI $1f87
+1f5d : 10 33 __ BPL $1f92
+1f5f : b1 19 __ LDA (IP + 0),y
+1f61 : aa __ __ TAX
+1f62 : b5 01 __ LDA $01,x
+1f64 : c5 1c __ CMP ACCU + 1
+1f66 : d0 28 __ BNE $1f90
+1f68 : b5 00 __ LDA $00,x
+1f6a : c5 1b __ CMP ACCU + 0
+1f6c : d0 22 __ BNE $1f90
+1f6e : f0 0e __ BEQ $1f7e
+1f70 : b1 19 __ LDA (IP + 0),y
+1f72 : aa __ __ TAX
+1f73 : c8 __ __ INY
+1f74 : b1 19 __ LDA (IP + 0),y
+1f76 : c5 1c __ CMP ACCU + 1
+1f78 : d0 16 __ BNE $1f90
+1f7a : e4 1b __ CPX ACCU + 0
+1f7c : d0 12 __ BNE $1f90
+1f7e : a9 00 __ LDA #$00
+1f80 : 85 1b __ STA ACCU + 0
+1f82 : 85 1c __ STA ACCU + 1
+1f84 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f87 : a9 ff __ LDA #$ff
+1f89 : 85 1b __ STA ACCU + 0
+1f8b : 85 1c __ STA ACCU + 1
+1f8d : 4c 50 08 JMP $0850 ; (startup + 79)
+1f90 : 90 f5 __ BCC $1f87
+1f92 : a9 01 __ LDA #$01
+1f94 : 85 1b __ STA ACCU + 0
+1f96 : a9 00 __ LDA #$00
+1f98 : 85 1c __ STA ACCU + 1
+1f9a : 4c 50 08 JMP $0850 ; (startup + 79)
+1f9d : b1 19 __ LDA (IP + 0),y
+1f9f : c8 __ __ INY
+1fa0 : aa __ __ TAX
+1fa1 : b1 19 __ LDA (IP + 0),y
+1fa3 : 38 __ __ SEC
+1fa4 : e5 1c __ SBC ACCU + 1
+1fa6 : d0 af __ BNE $1f57
+1fa8 : e4 1b __ CPX ACCU + 0
+1faa : d0 e4 __ BNE $1f90
+1fac : f0 d0 __ BEQ $1f7e
+1fae : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1faf : b1 19 __ LDA (IP + 0),y
+1fb1 : aa __ __ TAX
+1fb2 : 38 __ __ SEC
+1fb3 : b5 00 __ LDA $00,x
+1fb5 : e5 1b __ SBC ACCU + 0
+1fb7 : f0 19 __ BEQ $1fd2
+1fb9 : 50 02 __ BVC $1fbd
+1fbb : 49 80 __ EOR #$80
+1fbd : 30 1c __ BMI $1fdb
+1fbf : 10 25 __ BPL $1fe6
+1fc1 : b1 19 __ LDA (IP + 0),y
+1fc3 : aa __ __ TAX
+1fc4 : b5 00 __ LDA $00,x
+1fc6 : c5 1b __ CMP ACCU + 0
+1fc8 : d0 1a __ BNE $1fe4
+1fca : f0 06 __ BEQ $1fd2
+1fcc : b1 19 __ LDA (IP + 0),y
+1fce : c5 1b __ CMP ACCU + 0
+1fd0 : d0 12 __ BNE $1fe4
+1fd2 : a9 00 __ LDA #$00
+1fd4 : 85 1b __ STA ACCU + 0
+1fd6 : 85 1c __ STA ACCU + 1
+1fd8 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fdb : a9 ff __ LDA #$ff
+1fdd : 85 1b __ STA ACCU + 0
+1fdf : 85 1c __ STA ACCU + 1
+1fe1 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fe4 : 90 f5 __ BCC $1fdb
+1fe6 : a9 01 __ LDA #$01
+1fe8 : 85 1b __ STA ACCU + 0
+1fea : a9 00 __ LDA #$00
+1fec : 85 1c __ STA ACCU + 1
+1fee : 4c 50 08 JMP $0850 ; (startup + 79)
+1ff1 : b1 19 __ LDA (IP + 0),y
+1ff3 : 38 __ __ SEC
+1ff4 : e5 1b __ SBC ACCU + 0
+1ff6 : d0 c1 __ BNE $1fb9
+1ff8 : f0 d8 __ BEQ $1fd2
+1ffa : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1ffb : 38 __ __ SEC
+1ffc : a9 00 __ LDA #$00
+1ffe : e5 1b __ SBC ACCU + 0
+2000 : 85 1b __ STA ACCU + 0
+2002 : a9 00 __ LDA #$00
+2004 : e5 1c __ SBC ACCU + 1
+2006 : 85 1c __ STA ACCU + 1
+2008 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+200b : 20 06 17 JSR $1706 ; (freg + 0)
+200e : 20 4b 17 JSR $174b ; (faddsub + 0)
+2011 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+2014 : 20 06 17 JSR $1706 ; (freg + 0)
+2017 : a5 06 __ LDA $06
+2019 : 49 80 __ EOR #$80
+201b : 85 06 __ STA $06
+201d : 20 4b 17 JSR $174b ; (faddsub + 0)
+2020 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+2023 : 20 06 17 JSR $1706 ; (freg + 0)
+2026 : 84 02 __ STY $02
+2028 : 20 13 18 JSR $1813 ; (fmul + 0)
+202b : a4 02 __ LDY $02
+202d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+2030 : 20 06 17 JSR $1706 ; (freg + 0)
+2033 : 20 b1 18 JSR $18b1 ; (fdiv + 0)
+2036 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+2039 : b1 19 __ LDA (IP + 0),y
+203b : c8 __ __ INY
+203c : aa __ __ TAX
+203d : a5 1e __ LDA ACCU + 3
+203f : 55 03 __ EOR $03,x
+2041 : 29 80 __ AND #$80
+2043 : f0 1e __ BEQ $2063
+2045 : a5 1e __ LDA ACCU + 3
+2047 : 29 7f __ AND #$7f
+2049 : 05 1d __ ORA ACCU + 2
+204b : 05 1c __ ORA ACCU + 1
+204d : 05 1b __ ORA ACCU + 0
+204f : d0 0c __ BNE $205d
+2051 : b5 03 __ LDA $03,x
+2053 : 29 7f __ AND #$7f
+2055 : 15 02 __ ORA $02,x
+2057 : 15 01 __ ORA $01,x
+2059 : 15 00 __ ORA $00,x
+205b : f0 1e __ BEQ $207b
+205d : a5 1e __ LDA ACCU + 3
+205f : 30 29 __ BMI $208a
+2061 : 10 36 __ BPL $2099
+2063 : a5 1e __ LDA ACCU + 3
+2065 : d5 03 __ CMP $03,x
+2067 : d0 1b __ BNE $2084
+2069 : a5 1d __ LDA ACCU + 2
+206b : d5 02 __ CMP $02,x
+206d : d0 15 __ BNE $2084
+206f : a5 1c __ LDA ACCU + 1
+2071 : d5 01 __ CMP $01,x
+2073 : d0 0f __ BNE $2084
+2075 : a5 1b __ LDA ACCU + 0
+2077 : d5 00 __ CMP $00,x
+2079 : d0 09 __ BNE $2084
+207b : a9 00 __ LDA #$00
+207d : 85 1b __ STA ACCU + 0
+207f : 85 1c __ STA ACCU + 1
+2081 : 4c 51 08 JMP $0851 ; (startup + 80)
+2084 : b0 0f __ BCS $2095
+2086 : 24 1e __ BIT ACCU + 3
+2088 : 30 0f __ BMI $2099
+208a : a9 00 __ LDA #$00
+208c : 85 1c __ STA ACCU + 1
+208e : a9 01 __ LDA #$01
+2090 : 85 1b __ STA ACCU + 0
+2092 : 4c 51 08 JMP $0851 ; (startup + 80)
+2095 : 24 1e __ BIT ACCU + 3
+2097 : 30 f1 __ BMI $208a
+2099 : a9 ff __ LDA #$ff
+209b : 85 1b __ STA ACCU + 0
+209d : 85 1c __ STA ACCU + 1
+209f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+20a2 : a5 1e __ LDA ACCU + 3
+20a4 : 49 80 __ EOR #$80
+20a6 : 85 1e __ STA ACCU + 3
+20a8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_abs_f32:
+20ab : a5 1e __ LDA ACCU + 3
+20ad : 29 7f __ AND #$7f
+20af : 85 1e __ STA ACCU + 3
+20b1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+20b4 : 20 12 1a JSR $1a12 ; (sint16_to_float + 0)
+20b7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+20ba : 20 d0 19 JSR $19d0 ; (f32_to_i16 + 0)
+20bd : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+20c0 : b1 19 __ LDA (IP + 0),y
+20c2 : 30 0c __ BMI $20d0
+20c4 : 38 __ __ SEC
+20c5 : 65 19 __ ADC IP + 0
+20c7 : 85 19 __ STA IP + 0
+20c9 : 90 02 __ BCC $20cd
+20cb : e6 1a __ INC IP + 1
+20cd : 4c 51 08 JMP $0851 ; (startup + 80)
+20d0 : 38 __ __ SEC
+20d1 : 65 19 __ ADC IP + 0
+20d3 : 85 19 __ STA IP + 0
+20d5 : b0 02 __ BCS $20d9
+20d7 : c6 1a __ DEC IP + 1
+20d9 : 4c 51 08 JMP $0851 ; (startup + 80)
+20dc : a5 1b __ LDA ACCU + 0
+20de : 05 1c __ ORA ACCU + 1
+20e0 : f0 de __ BEQ $20c0
+20e2 : 4c 50 08 JMP $0850 ; (startup + 79)
+20e5 : a5 1b __ LDA ACCU + 0
+20e7 : 05 1c __ ORA ACCU + 1
+20e9 : d0 d5 __ BNE $20c0
+20eb : 4c 50 08 JMP $0850 ; (startup + 79)
+20ee : a5 1c __ LDA ACCU + 1
+20f0 : 30 04 __ BMI $20f6
+20f2 : 05 1b __ ORA ACCU + 0
+20f4 : d0 ca __ BNE $20c0
+20f6 : 4c 50 08 JMP $0850 ; (startup + 79)
+20f9 : a5 1c __ LDA ACCU + 1
+20fb : 10 c3 __ BPL $20c0
+20fd : 4c 50 08 JMP $0850 ; (startup + 79)
+2100 : a5 1c __ LDA ACCU + 1
+2102 : 30 bc __ BMI $20c0
+2104 : 4c 50 08 JMP $0850 ; (startup + 79)
+2107 : a5 1c __ LDA ACCU + 1
+2109 : 30 b5 __ BMI $20c0
+210b : 05 1b __ ORA ACCU + 0
+210d : f0 b1 __ BEQ $20c0
+210f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2112 : 38 __ __ SEC
+2113 : b1 19 __ LDA (IP + 0),y
+2115 : 65 19 __ ADC IP + 0
+2117 : aa __ __ TAX
+2118 : c8 __ __ INY
+2119 : b1 19 __ LDA (IP + 0),y
+211b : 65 1a __ ADC IP + 1
+211d : 85 1a __ STA IP + 1
+211f : 86 19 __ STX IP + 0
+2121 : 4c 51 08 JMP $0851 ; (startup + 80)
+2124 : a5 1b __ LDA ACCU + 0
+2126 : 05 1c __ ORA ACCU + 1
+2128 : f0 e8 __ BEQ $2112
+212a : c8 __ __ INY
+212b : 4c 50 08 JMP $0850 ; (startup + 79)
+212e : a5 1b __ LDA ACCU + 0
+2130 : 05 1c __ ORA ACCU + 1
+2132 : d0 de __ BNE $2112
+2134 : c8 __ __ INY
+2135 : 4c 50 08 JMP $0850 ; (startup + 79)
+2138 : a5 1c __ LDA ACCU + 1
+213a : 30 04 __ BMI $2140
+213c : 05 1b __ ORA ACCU + 0
+213e : d0 d2 __ BNE $2112
+2140 : c8 __ __ INY
+2141 : 4c 50 08 JMP $0850 ; (startup + 79)
+2144 : a5 1c __ LDA ACCU + 1
+2146 : 10 ca __ BPL $2112
+2148 : c8 __ __ INY
+2149 : 4c 50 08 JMP $0850 ; (startup + 79)
+214c : a5 1c __ LDA ACCU + 1
+214e : 30 c2 __ BMI $2112
+2150 : c8 __ __ INY
+2151 : 4c 50 08 JMP $0850 ; (startup + 79)
+2154 : a5 1c __ LDA ACCU + 1
+2156 : 30 ba __ BMI $2112
+2158 : 05 1b __ ORA ACCU + 0
+215a : f0 b6 __ BEQ $2112
+215c : c8 __ __ INY
+215d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2160 : a9 00 __ LDA #$00
+2162 : 2c a9 01 BIT $01a9 
+2165 : 85 1b __ STA ACCU + 0
+2167 : a9 00 __ LDA #$00
+2169 : 85 1c __ STA ACCU + 1
+216b : 4c 51 08 JMP $0851 ; (startup + 80)
+216e : a5 1b __ LDA ACCU + 0
+2170 : 05 1c __ ORA ACCU + 1
+2172 : f0 ef __ BEQ $2163
+2174 : d0 ea __ BNE $2160
+2176 : a5 1b __ LDA ACCU + 0
+2178 : 05 1c __ ORA ACCU + 1
+217a : d0 e7 __ BNE $2163
+217c : f0 e2 __ BEQ $2160
+217e : a5 1c __ LDA ACCU + 1
+2180 : 30 de __ BMI $2160
+2182 : 05 1b __ ORA ACCU + 0
+2184 : d0 dd __ BNE $2163
+2186 : f0 d8 __ BEQ $2160
+2188 : a5 1c __ LDA ACCU + 1
+218a : 10 d7 __ BPL $2163
+218c : 30 d2 __ BMI $2160
+218e : a5 1c __ LDA ACCU + 1
+2190 : 30 d1 __ BMI $2163
+2192 : 10 cc __ BPL $2160
+2194 : a5 1c __ LDA ACCU + 1
+2196 : 30 cb __ BMI $2163
+2198 : 05 1b __ ORA ACCU + 0
+219a : f0 c7 __ BEQ $2163
+219c : d0 c2 __ BNE $2160
+219e : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+219f : b1 19 __ LDA (IP + 0),y
+21a1 : 8d b5 21 STA $21b5 ; (inp_jsr + 22)
+21a4 : c8 __ __ INY
+21a5 : b1 19 __ LDA (IP + 0),y
+21a7 : 8d b6 21 STA $21b6 ; (inp_jsr + 23)
+21aa : 98 __ __ TYA
+21ab : 38 __ __ SEC
+21ac : 65 19 __ ADC IP + 0
+21ae : 85 19 __ STA IP + 0
+21b0 : 90 02 __ BCC $21b4
+21b2 : e6 1a __ INC IP + 1
+21b4 : 20 00 00 JSR $0000 
+21b7 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+21ba : 98 __ __ TYA
+21bb : 18 __ __ CLC
+21bc : 65 19 __ ADC IP + 0
+21be : 8d c9 21 STA $21c9 ; (inp_native + 15)
+21c1 : a5 1a __ LDA IP + 1
+21c3 : 69 00 __ ADC #$00
+21c5 : 8d ca 21 STA $21ca ; (inp_native + 16)
+21c8 : 20 00 00 JSR $0000 
+21cb : a0 00 __ LDY #$00
+21cd : b1 23 __ LDA (SP + 0),y
+21cf : 85 19 __ STA IP + 0
+21d1 : c8 __ __ INY
+21d2 : b1 23 __ LDA (SP + 0),y
+21d4 : 85 1a __ STA IP + 1
+21d6 : 88 __ __ DEY
+21d7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+21da : 38 __ __ SEC
+21db : a5 23 __ LDA SP + 0
+21dd : f1 19 __ SBC (IP + 0),y
+21df : c8 __ __ INY
+21e0 : 85 23 __ STA SP + 0
+21e2 : a5 24 __ LDA SP + 1
+21e4 : f1 19 __ SBC (IP + 0),y
+21e6 : c8 __ __ INY
+21e7 : 85 24 __ STA SP + 1
+21e9 : b1 19 __ LDA (IP + 0),y
+21eb : 84 02 __ STY $02
+21ed : a8 __ __ TAY
+21ee : a5 25 __ LDA FP + 0
+21f0 : 91 23 __ STA (SP + 0),y
+21f2 : c8 __ __ INY
+21f3 : a5 26 __ LDA FP + 1
+21f5 : 91 23 __ STA (SP + 0),y
+21f7 : 98 __ __ TYA
+21f8 : 38 __ __ SEC
+21f9 : 65 23 __ ADC SP + 0
+21fb : 85 25 __ STA FP + 0
+21fd : a9 00 __ LDA #$00
+21ff : 65 24 __ ADC SP + 1
+2201 : 85 26 __ STA FP + 1
+2203 : 88 __ __ DEY
+2204 : f0 08 __ BEQ $220e
+2206 : b9 52 00 LDA $0052,y 
+2209 : 88 __ __ DEY
+220a : 91 23 __ STA (SP + 0),y
+220c : d0 f8 __ BNE $2206
+220e : a4 02 __ LDY $02
+2210 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2213 : b1 19 __ LDA (IP + 0),y
+2215 : c8 __ __ INY
+2216 : 84 02 __ STY $02
+2218 : a8 __ __ TAY
+2219 : b1 23 __ LDA (SP + 0),y
+221b : 85 25 __ STA FP + 0
+221d : c8 __ __ INY
+221e : b1 23 __ LDA (SP + 0),y
+2220 : 85 26 __ STA FP + 1
+2222 : 88 __ __ DEY
+2223 : f0 09 __ BEQ $222e
+2225 : 88 __ __ DEY
+2226 : b1 23 __ LDA (SP + 0),y
+2228 : 99 53 00 STA $0053,y 
+222b : 88 __ __ DEY
+222c : 10 f8 __ BPL $2226
+222e : a4 02 __ LDY $02
+2230 : 18 __ __ CLC
+2231 : b1 19 __ LDA (IP + 0),y
+2233 : c8 __ __ INY
+2234 : 65 23 __ ADC SP + 0
+2236 : 85 23 __ STA SP + 0
+2238 : b1 19 __ LDA (IP + 0),y
+223a : c8 __ __ INY
+223b : 65 24 __ ADC SP + 1
+223d : 85 24 __ STA SP + 1
+223f : a0 01 __ LDY #$01
+2241 : b1 23 __ LDA (SP + 0),y
+2243 : 85 1a __ STA IP + 1
+2245 : 88 __ __ DEY
+2246 : b1 23 __ LDA (SP + 0),y
+2248 : 85 19 __ STA IP + 0
+224a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+224d : b1 19 __ LDA (IP + 0),y
+224f : 85 1f __ STA ADDR + 0
+2251 : c8 __ __ INY
+2252 : b1 19 __ LDA (IP + 0),y
+2254 : 85 20 __ STA ADDR + 1
+2256 : c8 __ __ INY
+2257 : 98 __ __ TYA
+2258 : a0 00 __ LDY #$00
+225a : 18 __ __ CLC
+225b : 65 19 __ ADC IP + 0
+225d : 91 23 __ STA (SP + 0),y
+225f : c8 __ __ INY
+2260 : a5 1a __ LDA IP + 1
+2262 : 69 00 __ ADC #$00
+2264 : 91 23 __ STA (SP + 0),y
+2266 : a5 1f __ LDA ADDR + 0
+2268 : 85 19 __ STA IP + 0
+226a : a5 20 __ LDA ADDR + 1
+226c : 85 1a __ STA IP + 1
+226e : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2271 : 38 __ __ SEC
+2272 : a5 23 __ LDA SP + 0
+2274 : f1 19 __ SBC (IP + 0),y
+2276 : c8 __ __ INY
+2277 : 85 23 __ STA SP + 0
+2279 : a5 24 __ LDA SP + 1
+227b : f1 19 __ SBC (IP + 0),y
+227d : 85 24 __ STA SP + 1
+227f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2282 : 18 __ __ CLC
+2283 : b1 19 __ LDA (IP + 0),y
+2285 : c8 __ __ INY
+2286 : 65 23 __ ADC SP + 0
+2288 : 85 23 __ STA SP + 0
+228a : b1 19 __ LDA (IP + 0),y
+228c : 65 24 __ ADC SP + 1
+228e : 85 24 __ STA SP + 1
+2290 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2293 : b1 19 __ LDA (IP + 0),y
+2295 : c8 __ __ INY
+2296 : 8d a4 22 STA $22a4 ; (inp_op_extrt + 17)
+2299 : b1 19 __ LDA (IP + 0),y
+229b : c8 __ __ INY
+229c : 8d a5 22 STA $22a5 ; (inp_op_extrt + 18)
+229f : b1 19 __ LDA (IP + 0),y
+22a1 : c8 __ __ INY
+22a2 : aa __ __ TAX
+22a3 : 20 00 00 JSR $0000 
+22a6 : 4c 51 08 JMP $0851 ; (startup + 80)
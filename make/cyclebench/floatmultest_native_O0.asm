@@ -0,0 +1,3280 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e aa 21 STX $21aa ; (spentry + 0)
+0811 : a9 b4 __ LDA #$b4
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 b4 __ LDA #$b4
+0832 : e9 b4 __ SBC #$b4
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 57 1d JMP $1d57 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 08 __ SBC #$08
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 05 __ LDY #$05
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 12 __ SBC #$12
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T0 + 0
+0928 : 85 54 __ STA T0 + 1
+092a : 85 55 __ STA T0 + 2
+092c : 85 56 __ STA T0 + 3
+092e : 85 57 __ STA T1 + 0
+0930 : 85 58 __ STA T1 + 1
+0932 : a9 18 __ LDA #$18
+0934 : a0 02 __ LDY #$02
+0936 : 91 23 __ STA (SP + 0),y
+0938 : a9 1d __ LDA #$1d
+093a : c8 __ __ INY
+093b : 91 23 __ STA (SP + 0),y
+093d : a5 57 __ LDA T1 + 0
+093f : 85 1b __ STA ACCU + 0
+0941 : c8 __ __ INY
+0942 : 91 23 __ STA (SP + 0),y
+0944 : a5 58 __ LDA T1 + 1
+0946 : 85 1c __ STA ACCU + 1
+0948 : c8 __ __ INY
+0949 : 91 23 __ STA (SP + 0),y
+094b : ad ac 21 LDA $21ac ; (c + 0)
+094e : 85 43 __ STA T3 + 0
+0950 : ad ad 21 LDA $21ad ; (c + 1)
+0953 : 85 44 __ STA T3 + 1
+0955 : ad ae 21 LDA $21ae ; (c + 2)
+0958 : 85 45 __ STA T3 + 2
+095a : ad af 21 LDA $21af ; (c + 3)
+095d : 85 46 __ STA T3 + 3
+095f : 20 b7 20 JSR $20b7 ; (sint16_to_float + 0)
+0962 : a5 43 __ LDA T3 + 0
+0964 : 85 03 __ STA $03
+0966 : a5 44 __ LDA T3 + 1
+0968 : 85 04 __ STA $04
+096a : a5 45 __ LDA T3 + 2
+096c : 85 05 __ STA $05
+096e : a5 46 __ LDA T3 + 3
+0970 : 85 06 __ STA $06
+0972 : 20 78 1d JSR $1d78 ; (freg + 20)
+0975 : 20 71 1e JSR $1e71 ; (fmul + 0)
+0978 : a5 1b __ LDA ACCU + 0
+097a : a0 06 __ LDY #$06
+097c : 91 23 __ STA (SP + 0),y
+097e : a5 1c __ LDA ACCU + 1
+0980 : c8 __ __ INY
+0981 : 91 23 __ STA (SP + 0),y
+0983 : a5 1d __ LDA ACCU + 2
+0985 : c8 __ __ INY
+0986 : 91 23 __ STA (SP + 0),y
+0988 : a5 1e __ LDA ACCU + 3
+098a : c8 __ __ INY
+098b : 91 23 __ STA (SP + 0),y
+098d : a5 53 __ LDA T0 + 0
+098f : 85 03 __ STA $03
+0991 : c8 __ __ INY
+0992 : 91 23 __ STA (SP + 0),y
+0994 : a5 54 __ LDA T0 + 1
+0996 : 85 04 __ STA $04
+0998 : c8 __ __ INY
+0999 : 91 23 __ STA (SP + 0),y
+099b : a5 55 __ LDA T0 + 2
+099d : 85 05 __ STA $05
+099f : c8 __ __ INY
+09a0 : 91 23 __ STA (SP + 0),y
+09a2 : a5 56 __ LDA T0 + 3
+09a4 : 85 06 __ STA $06
+09a6 : c8 __ __ INY
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : 20 78 1d JSR $1d78 ; (freg + 20)
+09ac : a5 06 __ LDA $06
+09ae : 49 80 __ EOR #$80
+09b0 : 85 06 __ STA $06
+09b2 : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+09b5 : a5 1b __ LDA ACCU + 0
+09b7 : a0 0e __ LDY #$0e
+09b9 : 91 23 __ STA (SP + 0),y
+09bb : a5 1c __ LDA ACCU + 1
+09bd : c8 __ __ INY
+09be : 91 23 __ STA (SP + 0),y
+09c0 : a5 1d __ LDA ACCU + 2
+09c2 : c8 __ __ INY
+09c3 : 91 23 __ STA (SP + 0),y
+09c5 : a5 1e __ LDA ACCU + 3
+09c7 : c8 __ __ INY
+09c8 : 91 23 __ STA (SP + 0),y
+09ca : 20 97 0c JSR $0c97 ; (printf + 0)
+09cd : ad ac 21 LDA $21ac ; (c + 0)
+09d0 : 85 43 __ STA T3 + 0
+09d2 : ad ad 21 LDA $21ad ; (c + 1)
+09d5 : 85 44 __ STA T3 + 1
+09d7 : ad ae 21 LDA $21ae ; (c + 2)
+09da : 85 45 __ STA T3 + 2
+09dc : ad af 21 LDA $21af ; (c + 3)
+09df : 85 46 __ STA T3 + 3
+09e1 : a5 57 __ LDA T1 + 0
+09e3 : 85 1b __ STA ACCU + 0
+09e5 : a5 58 __ LDA T1 + 1
+09e7 : 85 1c __ STA ACCU + 1
+09e9 : 20 b7 20 JSR $20b7 ; (sint16_to_float + 0)
+09ec : a5 43 __ LDA T3 + 0
+09ee : 85 03 __ STA $03
+09f0 : a5 44 __ LDA T3 + 1
+09f2 : 85 04 __ STA $04
+09f4 : a5 45 __ LDA T3 + 2
+09f6 : 85 05 __ STA $05
+09f8 : a5 46 __ LDA T3 + 3
+09fa : 85 06 __ STA $06
+09fc : 20 78 1d JSR $1d78 ; (freg + 20)
+09ff : 20 71 1e JSR $1e71 ; (fmul + 0)
+0a02 : a5 1b __ LDA ACCU + 0
+0a04 : 85 03 __ STA $03
+0a06 : a5 1c __ LDA ACCU + 1
+0a08 : 85 04 __ STA $04
+0a0a : a5 1d __ LDA ACCU + 2
+0a0c : 85 05 __ STA $05
+0a0e : a5 1e __ LDA ACCU + 3
+0a10 : 85 06 __ STA $06
+0a12 : a5 53 __ LDA T0 + 0
+0a14 : 85 1b __ STA ACCU + 0
+0a16 : a5 54 __ LDA T0 + 1
+0a18 : 85 1c __ STA ACCU + 1
+0a1a : a5 55 __ LDA T0 + 2
+0a1c : 85 1d __ STA ACCU + 2
+0a1e : a5 56 __ LDA T0 + 3
+0a20 : 85 1e __ STA ACCU + 3
+0a22 : 20 02 21 JSR $2102 ; (fcmp + 0)
+0a25 : d0 03 __ BNE $0a2a
+0a27 : 4c 92 0c JMP $0c92 ; (main + 914)
+0a2a : a9 00 __ LDA #$00
+0a2c : a0 02 __ LDY #$02
+0a2e : 91 23 __ STA (SP + 0),y
+0a30 : 20 25 1d JSR $1d25 ; (assert + 0)
+0a33 : ad ac 21 LDA $21ac ; (c + 0)
+0a36 : 85 1b __ STA ACCU + 0
+0a38 : ad ad 21 LDA $21ad ; (c + 1)
+0a3b : 85 1c __ STA ACCU + 1
+0a3d : ad ae 21 LDA $21ae ; (c + 2)
+0a40 : 85 1d __ STA ACCU + 2
+0a42 : ad af 21 LDA $21af ; (c + 3)
+0a45 : 85 1e __ STA ACCU + 3
+0a47 : a5 53 __ LDA T0 + 0
+0a49 : 85 03 __ STA $03
+0a4b : a5 54 __ LDA T0 + 1
+0a4d : 85 04 __ STA $04
+0a4f : a5 55 __ LDA T0 + 2
+0a51 : 85 05 __ STA $05
+0a53 : a5 56 __ LDA T0 + 3
+0a55 : 85 06 __ STA $06
+0a57 : 20 78 1d JSR $1d78 ; (freg + 20)
+0a5a : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+0a5d : a5 1b __ LDA ACCU + 0
+0a5f : 85 53 __ STA T0 + 0
+0a61 : a5 1c __ LDA ACCU + 1
+0a63 : 85 54 __ STA T0 + 1
+0a65 : a5 1d __ LDA ACCU + 2
+0a67 : 85 55 __ STA T0 + 2
+0a69 : a5 1e __ LDA ACCU + 3
+0a6b : 85 56 __ STA T0 + 3
+0a6d : e6 57 __ INC T1 + 0
+0a6f : d0 02 __ BNE $0a73
+0a71 : e6 58 __ INC T1 + 1
+0a73 : a5 57 __ LDA T1 + 0
+0a75 : c9 32 __ CMP #$32
+0a77 : b0 03 __ BCS $0a7c
+0a79 : 4c 32 09 JMP $0932 ; (main + 50)
+0a7c : ad b0 21 LDA $21b0 ; (d + 0)
+0a7f : 85 53 __ STA T0 + 0
+0a81 : ad b1 21 LDA $21b1 ; (d + 1)
+0a84 : 85 54 __ STA T0 + 1
+0a86 : ad b2 21 LDA $21b2 ; (d + 2)
+0a89 : 85 55 __ STA T0 + 2
+0a8b : ad b3 21 LDA $21b3 ; (d + 3)
+0a8e : 85 56 __ STA T0 + 3
+0a90 : a9 01 __ LDA #$01
+0a92 : 85 57 __ STA T1 + 0
+0a94 : a9 00 __ LDA #$00
+0a96 : 85 58 __ STA T1 + 1
+0a98 : a9 4a __ LDA #$4a
+0a9a : a0 02 __ LDY #$02
+0a9c : 91 23 __ STA (SP + 0),y
+0a9e : a9 1d __ LDA #$1d
+0aa0 : c8 __ __ INY
+0aa1 : 91 23 __ STA (SP + 0),y
+0aa3 : a5 57 __ LDA T1 + 0
+0aa5 : 85 1b __ STA ACCU + 0
+0aa7 : c8 __ __ INY
+0aa8 : 91 23 __ STA (SP + 0),y
+0aaa : a5 58 __ LDA T1 + 1
+0aac : 85 1c __ STA ACCU + 1
+0aae : c8 __ __ INY
+0aaf : 91 23 __ STA (SP + 0),y
+0ab1 : ad b0 21 LDA $21b0 ; (d + 0)
+0ab4 : 85 43 __ STA T3 + 0
+0ab6 : ad b1 21 LDA $21b1 ; (d + 1)
+0ab9 : 85 44 __ STA T3 + 1
+0abb : ad b2 21 LDA $21b2 ; (d + 2)
+0abe : 85 45 __ STA T3 + 2
+0ac0 : ad b3 21 LDA $21b3 ; (d + 3)
+0ac3 : 85 46 __ STA T3 + 3
+0ac5 : 20 b7 20 JSR $20b7 ; (sint16_to_float + 0)
+0ac8 : a5 1b __ LDA ACCU + 0
+0aca : 85 47 __ STA T4 + 0
+0acc : a5 1c __ LDA ACCU + 1
+0ace : 85 48 __ STA T4 + 1
+0ad0 : a5 1d __ LDA ACCU + 2
+0ad2 : 85 49 __ STA T4 + 2
+0ad4 : a5 1e __ LDA ACCU + 3
+0ad6 : 85 4a __ STA T4 + 3
+0ad8 : a5 43 __ LDA T3 + 0
+0ada : 85 03 __ STA $03
+0adc : a5 44 __ LDA T3 + 1
+0ade : 85 04 __ STA $04
+0ae0 : a5 45 __ LDA T3 + 2
+0ae2 : 85 05 __ STA $05
+0ae4 : a5 46 __ LDA T3 + 3
+0ae6 : 85 06 __ STA $06
+0ae8 : 20 78 1d JSR $1d78 ; (freg + 20)
+0aeb : 20 71 1e JSR $1e71 ; (fmul + 0)
+0aee : a5 1b __ LDA ACCU + 0
+0af0 : a0 06 __ LDY #$06
+0af2 : 91 23 __ STA (SP + 0),y
+0af4 : a5 1c __ LDA ACCU + 1
+0af6 : c8 __ __ INY
+0af7 : 91 23 __ STA (SP + 0),y
+0af9 : a5 1d __ LDA ACCU + 2
+0afb : c8 __ __ INY
+0afc : 91 23 __ STA (SP + 0),y
+0afe : a5 1e __ LDA ACCU + 3
+0b00 : c8 __ __ INY
+0b01 : 91 23 __ STA (SP + 0),y
+0b03 : a5 53 __ LDA T0 + 0
+0b05 : 85 03 __ STA $03
+0b07 : c8 __ __ INY
+0b08 : 91 23 __ STA (SP + 0),y
+0b0a : a5 54 __ LDA T0 + 1
+0b0c : 85 04 __ STA $04
+0b0e : c8 __ __ INY
+0b0f : 91 23 __ STA (SP + 0),y
+0b11 : a5 55 __ LDA T0 + 2
+0b13 : 85 05 __ STA $05
+0b15 : c8 __ __ INY
+0b16 : 91 23 __ STA (SP + 0),y
+0b18 : a5 56 __ LDA T0 + 3
+0b1a : 85 06 __ STA $06
+0b1c : c8 __ __ INY
+0b1d : 91 23 __ STA (SP + 0),y
+0b1f : 20 78 1d JSR $1d78 ; (freg + 20)
+0b22 : a5 06 __ LDA $06
+0b24 : 49 80 __ EOR #$80
+0b26 : 85 06 __ STA $06
+0b28 : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+0b2b : a5 1e __ LDA ACCU + 3
+0b2d : 29 7f __ AND #$7f
+0b2f : 85 1e __ STA ACCU + 3
+0b31 : a5 47 __ LDA T4 + 0
+0b33 : 85 03 __ STA $03
+0b35 : a5 48 __ LDA T4 + 1
+0b37 : 85 04 __ STA $04
+0b39 : a5 49 __ LDA T4 + 2
+0b3b : 85 05 __ STA $05
+0b3d : a5 4a __ LDA T4 + 3
+0b3f : 85 06 __ STA $06
+0b41 : 20 78 1d JSR $1d78 ; (freg + 20)
+0b44 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+0b47 : a5 1b __ LDA ACCU + 0
+0b49 : a0 0e __ LDY #$0e
+0b4b : 91 23 __ STA (SP + 0),y
+0b4d : a5 1c __ LDA ACCU + 1
+0b4f : c8 __ __ INY
+0b50 : 91 23 __ STA (SP + 0),y
+0b52 : a5 1d __ LDA ACCU + 2
+0b54 : c8 __ __ INY
+0b55 : 91 23 __ STA (SP + 0),y
+0b57 : a5 1e __ LDA ACCU + 3
+0b59 : c8 __ __ INY
+0b5a : 91 23 __ STA (SP + 0),y
+0b5c : 20 97 0c JSR $0c97 ; (printf + 0)
+0b5f : ad b0 21 LDA $21b0 ; (d + 0)
+0b62 : 85 43 __ STA T3 + 0
+0b64 : ad b1 21 LDA $21b1 ; (d + 1)
+0b67 : 85 44 __ STA T3 + 1
+0b69 : ad b2 21 LDA $21b2 ; (d + 2)
+0b6c : 85 45 __ STA T3 + 2
+0b6e : ad b3 21 LDA $21b3 ; (d + 3)
+0b71 : 85 46 __ STA T3 + 3
+0b73 : a5 57 __ LDA T1 + 0
+0b75 : 85 1b __ STA ACCU + 0
+0b77 : a5 58 __ LDA T1 + 1
+0b79 : 85 1c __ STA ACCU + 1
+0b7b : 20 b7 20 JSR $20b7 ; (sint16_to_float + 0)
+0b7e : a5 1b __ LDA ACCU + 0
+0b80 : 85 47 __ STA T4 + 0
+0b82 : a5 1c __ LDA ACCU + 1
+0b84 : 85 48 __ STA T4 + 1
+0b86 : a5 1d __ LDA ACCU + 2
+0b88 : 85 49 __ STA T4 + 2
+0b8a : a5 1e __ LDA ACCU + 3
+0b8c : 85 4a __ STA T4 + 3
+0b8e : a5 43 __ LDA T3 + 0
+0b90 : 85 03 __ STA $03
+0b92 : a5 44 __ LDA T3 + 1
+0b94 : 85 04 __ STA $04
+0b96 : a5 45 __ LDA T3 + 2
+0b98 : 85 05 __ STA $05
+0b9a : a5 46 __ LDA T3 + 3
+0b9c : 85 06 __ STA $06
+0b9e : 20 78 1d JSR $1d78 ; (freg + 20)
+0ba1 : 20 71 1e JSR $1e71 ; (fmul + 0)
+0ba4 : a5 53 __ LDA T0 + 0
+0ba6 : 85 03 __ STA $03
+0ba8 : a5 54 __ LDA T0 + 1
+0baa : 85 04 __ STA $04
+0bac : a5 55 __ LDA T0 + 2
+0bae : 85 05 __ STA $05
+0bb0 : a5 56 __ LDA T0 + 3
+0bb2 : 85 06 __ STA $06
+0bb4 : 20 78 1d JSR $1d78 ; (freg + 20)
+0bb7 : a5 06 __ LDA $06
+0bb9 : 49 80 __ EOR #$80
+0bbb : 85 06 __ STA $06
+0bbd : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+0bc0 : a5 1b __ LDA ACCU + 0
+0bc2 : 85 43 __ STA T3 + 0
+0bc4 : a5 1c __ LDA ACCU + 1
+0bc6 : 85 44 __ STA T3 + 1
+0bc8 : a5 1d __ LDA ACCU + 2
+0bca : 85 45 __ STA T3 + 2
+0bcc : a5 1e __ LDA ACCU + 3
+0bce : 29 7f __ AND #$7f
+0bd0 : 85 46 __ STA T3 + 3
+0bd2 : a5 47 __ LDA T4 + 0
+0bd4 : 85 1b __ STA ACCU + 0
+0bd6 : a5 48 __ LDA T4 + 1
+0bd8 : 85 1c __ STA ACCU + 1
+0bda : a5 49 __ LDA T4 + 2
+0bdc : 85 1d __ STA ACCU + 2
+0bde : a5 4a __ LDA T4 + 3
+0be0 : 85 1e __ STA ACCU + 3
+0be2 : a9 bd __ LDA #$bd
+0be4 : 85 03 __ STA $03
+0be6 : a9 37 __ LDA #$37
+0be8 : 85 04 __ STA $04
+0bea : a9 86 __ LDA #$86
+0bec : 85 05 __ STA $05
+0bee : a9 35 __ LDA #$35
+0bf0 : 85 06 __ STA $06
+0bf2 : 20 78 1d JSR $1d78 ; (freg + 20)
+0bf5 : 20 71 1e JSR $1e71 ; (fmul + 0)
+0bf8 : a5 43 __ LDA T3 + 0
+0bfa : 85 03 __ STA $03
+0bfc : a5 44 __ LDA T3 + 1
+0bfe : 85 04 __ STA $04
+0c00 : a5 45 __ LDA T3 + 2
+0c02 : 85 05 __ STA $05
+0c04 : a5 46 __ LDA T3 + 3
+0c06 : 85 06 __ STA $06
+0c08 : 20 02 21 JSR $2102 ; (fcmp + 0)
+0c0b : 10 03 __ BPL $0c10
+0c0d : 4c 8d 0c JMP $0c8d ; (main + 909)
+0c10 : a9 00 __ LDA #$00
+0c12 : a0 02 __ LDY #$02
+0c14 : 91 23 __ STA (SP + 0),y
+0c16 : 20 25 1d JSR $1d25 ; (assert + 0)
+0c19 : ad b0 21 LDA $21b0 ; (d + 0)
+0c1c : 85 1b __ STA ACCU + 0
+0c1e : ad b1 21 LDA $21b1 ; (d + 1)
+0c21 : 85 1c __ STA ACCU + 1
+0c23 : ad b2 21 LDA $21b2 ; (d + 2)
+0c26 : 85 1d __ STA ACCU + 2
+0c28 : ad b3 21 LDA $21b3 ; (d + 3)
+0c2b : 85 1e __ STA ACCU + 3
+0c2d : a5 53 __ LDA T0 + 0
+0c2f : 85 03 __ STA $03
+0c31 : a5 54 __ LDA T0 + 1
+0c33 : 85 04 __ STA $04
+0c35 : a5 55 __ LDA T0 + 2
+0c37 : 85 05 __ STA $05
+0c39 : a5 56 __ LDA T0 + 3
+0c3b : 85 06 __ STA $06
+0c3d : 20 78 1d JSR $1d78 ; (freg + 20)
+0c40 : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+0c43 : a5 1b __ LDA ACCU + 0
+0c45 : 85 53 __ STA T0 + 0
+0c47 : a5 1c __ LDA ACCU + 1
+0c49 : 85 54 __ STA T0 + 1
+0c4b : a5 1d __ LDA ACCU + 2
+0c4d : 85 55 __ STA T0 + 2
+0c4f : a5 1e __ LDA ACCU + 3
+0c51 : 85 56 __ STA T0 + 3
+0c53 : e6 57 __ INC T1 + 0
+0c55 : d0 02 __ BNE $0c59
+0c57 : e6 58 __ INC T1 + 1
+0c59 : a5 57 __ LDA T1 + 0
+0c5b : c9 32 __ CMP #$32
+0c5d : b0 03 __ BCS $0c62
+0c5f : 4c 98 0a JMP $0a98 ; (main + 408)
+0c62 : a9 00 __ LDA #$00
+0c64 : 85 1b __ STA ACCU + 0
+0c66 : 85 1c __ STA ACCU + 1
+0c68 : 18 __ __ CLC
+0c69 : a5 23 __ LDA SP + 0
+0c6b : 69 12 __ ADC #$12
+0c6d : 85 23 __ STA SP + 0
+0c6f : a5 24 __ LDA SP + 1
+0c71 : 69 00 __ ADC #$00
+0c73 : 85 24 __ STA SP + 1
+0c75 : a0 05 __ LDY #$05
+0c77 : b1 23 __ LDA (SP + 0),y
+0c79 : 99 53 00 STA $0053,y 
+0c7c : 88 __ __ DEY
+0c7d : 10 f8 __ BPL $0c77
+0c7f : 18 __ __ CLC
+0c80 : a5 23 __ LDA SP + 0
+0c82 : 69 08 __ ADC #$08
+0c84 : 85 23 __ STA SP + 0
+0c86 : a5 24 __ LDA SP + 1
+0c88 : 69 00 __ ADC #$00
+0c8a : 85 24 __ STA SP + 1
+0c8c : 60 __ __ RTS
+0c8d : a9 01 __ LDA #$01
+0c8f : 4c 12 0c JMP $0c12 ; (main + 786)
+0c92 : a9 01 __ LDA #$01
+0c94 : 4c 2c 0a JMP $0a2c ; (main + 300)
+--------------------------------------------------------------------
+printf:
+0c97 : 38 __ __ SEC
+0c98 : a5 23 __ LDA SP + 0
+0c9a : e9 32 __ SBC #$32
+0c9c : 85 23 __ STA SP + 0
+0c9e : a5 24 __ LDA SP + 1
+0ca0 : e9 00 __ SBC #$00
+0ca2 : 85 24 __ STA SP + 1
+0ca4 : 38 __ __ SEC
+0ca5 : a5 23 __ LDA SP + 0
+0ca7 : e9 09 __ SBC #$09
+0ca9 : 85 23 __ STA SP + 0
+0cab : a5 24 __ LDA SP + 1
+0cad : e9 00 __ SBC #$00
+0caf : 85 24 __ STA SP + 1
+0cb1 : 18 __ __ CLC
+0cb2 : a5 23 __ LDA SP + 0
+0cb4 : 69 09 __ ADC #$09
+0cb6 : a0 02 __ LDY #$02
+0cb8 : 91 23 __ STA (SP + 0),y
+0cba : a5 24 __ LDA SP + 1
+0cbc : 69 00 __ ADC #$00
+0cbe : c8 __ __ INY
+0cbf : 91 23 __ STA (SP + 0),y
+0cc1 : a0 3d __ LDY #$3d
+0cc3 : b1 23 __ LDA (SP + 0),y
+0cc5 : a0 04 __ LDY #$04
+0cc7 : 91 23 __ STA (SP + 0),y
+0cc9 : a0 3e __ LDY #$3e
+0ccb : b1 23 __ LDA (SP + 0),y
+0ccd : a0 05 __ LDY #$05
+0ccf : 91 23 __ STA (SP + 0),y
+0cd1 : 18 __ __ CLC
+0cd2 : a5 23 __ LDA SP + 0
+0cd4 : 69 3f __ ADC #$3f
+0cd6 : c8 __ __ INY
+0cd7 : 91 23 __ STA (SP + 0),y
+0cd9 : a5 24 __ LDA SP + 1
+0cdb : 69 00 __ ADC #$00
+0cdd : c8 __ __ INY
+0cde : 91 23 __ STA (SP + 0),y
+0ce0 : a9 01 __ LDA #$01
+0ce2 : c8 __ __ INY
+0ce3 : 91 23 __ STA (SP + 0),y
+0ce5 : 20 03 0d JSR $0d03 ; (sformat + 0)
+0ce8 : 18 __ __ CLC
+0ce9 : a5 23 __ LDA SP + 0
+0ceb : 69 09 __ ADC #$09
+0ced : 85 23 __ STA SP + 0
+0cef : a5 24 __ LDA SP + 1
+0cf1 : 69 00 __ ADC #$00
+0cf3 : 85 24 __ STA SP + 1
+0cf5 : 18 __ __ CLC
+0cf6 : a5 23 __ LDA SP + 0
+0cf8 : 69 32 __ ADC #$32
+0cfa : 85 23 __ STA SP + 0
+0cfc : a5 24 __ LDA SP + 1
+0cfe : 69 00 __ ADC #$00
+0d00 : 85 24 __ STA SP + 1
+0d02 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0d03 : 38 __ __ SEC
+0d04 : a5 23 __ LDA SP + 0
+0d06 : e9 0e __ SBC #$0e
+0d08 : 85 23 __ STA SP + 0
+0d0a : a5 24 __ LDA SP + 1
+0d0c : e9 00 __ SBC #$00
+0d0e : 85 24 __ STA SP + 1
+0d10 : a0 05 __ LDY #$05
+0d12 : b9 53 00 LDA $0053,y 
+0d15 : 91 23 __ STA (SP + 0),y
+0d17 : 88 __ __ DEY
+0d18 : 10 f8 __ BPL $0d12
+0d1a : a0 10 __ LDY #$10
+0d1c : b1 23 __ LDA (SP + 0),y
+0d1e : 85 53 __ STA T0 + 0
+0d20 : c8 __ __ INY
+0d21 : b1 23 __ LDA (SP + 0),y
+0d23 : 85 54 __ STA T0 + 1
+0d25 : a9 00 __ LDA #$00
+0d27 : 85 55 __ STA T1 + 0
+0d29 : c8 __ __ INY
+0d2a : b1 23 __ LDA (SP + 0),y
+0d2c : 85 57 __ STA T2 + 0
+0d2e : c8 __ __ INY
+0d2f : b1 23 __ LDA (SP + 0),y
+0d31 : 85 58 __ STA T2 + 1
+0d33 : a0 00 __ LDY #$00
+0d35 : b1 57 __ LDA (T2 + 0),y
+0d37 : 85 43 __ STA T3 + 0
+0d39 : d0 59 __ BNE $0d94
+0d3b : 18 __ __ CLC
+0d3c : a5 53 __ LDA T0 + 0
+0d3e : 65 55 __ ADC T1 + 0
+0d40 : 85 57 __ STA T2 + 0
+0d42 : a5 54 __ LDA T0 + 1
+0d44 : 69 00 __ ADC #$00
+0d46 : 85 58 __ STA T2 + 1
+0d48 : a9 00 __ LDA #$00
+0d4a : a4 55 __ LDY T1 + 0
+0d4c : 91 53 __ STA (T0 + 0),y
+0d4e : 98 __ __ TYA
+0d4f : d0 20 __ BNE $0d71
+0d51 : a5 53 __ LDA T0 + 0
+0d53 : 85 1b __ STA ACCU + 0
+0d55 : a5 54 __ LDA T0 + 1
+0d57 : 85 1c __ STA ACCU + 1
+0d59 : a0 05 __ LDY #$05
+0d5b : b1 23 __ LDA (SP + 0),y
+0d5d : 99 53 00 STA $0053,y 
+0d60 : 88 __ __ DEY
+0d61 : 10 f8 __ BPL $0d5b
+0d63 : 18 __ __ CLC
+0d64 : a5 23 __ LDA SP + 0
+0d66 : 69 0e __ ADC #$0e
+0d68 : 85 23 __ STA SP + 0
+0d6a : a5 24 __ LDA SP + 1
+0d6c : 69 00 __ ADC #$00
+0d6e : 85 24 __ STA SP + 1
+0d70 : 60 __ __ RTS
+0d71 : a0 16 __ LDY #$16
+0d73 : b1 23 __ LDA (SP + 0),y
+0d75 : d0 09 __ BNE $0d80
+0d77 : a5 57 __ LDA T2 + 0
+0d79 : 85 1b __ STA ACCU + 0
+0d7b : a5 58 __ LDA T2 + 1
+0d7d : 4c 57 0d JMP $0d57 ; (sformat + 84)
+0d80 : a5 53 __ LDA T0 + 0
+0d82 : 85 0d __ STA P0
+0d84 : a5 54 __ LDA T0 + 1
+0d86 : 85 0e __ STA P1
+0d88 : 20 be 12 JSR $12be ; (puts + 0)
+0d8b : a5 53 __ LDA T0 + 0
+0d8d : 85 1b __ STA ACCU + 0
+0d8f : a5 54 __ LDA T0 + 1
+0d91 : 4c 57 0d JMP $0d57 ; (sformat + 84)
+0d94 : e6 57 __ INC T2 + 0
+0d96 : d0 02 __ BNE $0d9a
+0d98 : e6 58 __ INC T2 + 1
+0d9a : a5 43 __ LDA T3 + 0
+0d9c : c9 25 __ CMP #$25
+0d9e : f0 55 __ BEQ $0df5
+0da0 : a4 55 __ LDY T1 + 0
+0da2 : 91 53 __ STA (T0 + 0),y
+0da4 : e6 55 __ INC T1 + 0
+0da6 : a5 55 __ LDA T1 + 0
+0da8 : c9 28 __ CMP #$28
+0daa : 90 15 __ BCC $0dc1
+0dac : a0 16 __ LDY #$16
+0dae : b1 23 __ LDA (SP + 0),y
+0db0 : d0 22 __ BNE $0dd4
+0db2 : 18 __ __ CLC
+0db3 : a5 53 __ LDA T0 + 0
+0db5 : 65 55 __ ADC T1 + 0
+0db7 : 85 53 __ STA T0 + 0
+0db9 : 90 02 __ BCC $0dbd
+0dbb : e6 54 __ INC T0 + 1
+0dbd : a9 00 __ LDA #$00
+0dbf : 85 55 __ STA T1 + 0
+0dc1 : a0 00 __ LDY #$00
+0dc3 : b1 57 __ LDA (T2 + 0),y
+0dc5 : aa __ __ TAX
+0dc6 : e6 57 __ INC T2 + 0
+0dc8 : d0 02 __ BNE $0dcc
+0dca : e6 58 __ INC T2 + 1
+0dcc : 8a __ __ TXA
+0dcd : 86 43 __ STX T3 + 0
+0dcf : d0 c9 __ BNE $0d9a
+0dd1 : 4c 3b 0d JMP $0d3b ; (sformat + 56)
+0dd4 : 18 __ __ CLC
+0dd5 : a5 53 __ LDA T0 + 0
+0dd7 : 85 0d __ STA P0
+0dd9 : 65 55 __ ADC T1 + 0
+0ddb : 85 45 __ STA T5 + 0
+0ddd : a5 54 __ LDA T0 + 1
+0ddf : 85 0e __ STA P1
+0de1 : 69 00 __ ADC #$00
+0de3 : 85 46 __ STA T5 + 1
+0de5 : a9 00 __ LDA #$00
+0de7 : a0 00 __ LDY #$00
+0de9 : 91 45 __ STA (T5 + 0),y
+0deb : 20 be 12 JSR $12be ; (puts + 0)
+0dee : a9 00 __ LDA #$00
+0df0 : 85 55 __ STA T1 + 0
+0df2 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0df5 : a5 55 __ LDA T1 + 0
+0df7 : f0 03 __ BEQ $0dfc
+0df9 : 4c 85 12 JMP $1285 ; (sformat + 1410)
+0dfc : a0 00 __ LDY #$00
+0dfe : b1 57 __ LDA (T2 + 0),y
+0e00 : 85 43 __ STA T3 + 0
+0e02 : a9 0a __ LDA #$0a
+0e04 : a0 09 __ LDY #$09
+0e06 : 91 23 __ STA (SP + 0),y
+0e08 : a9 00 __ LDA #$00
+0e0a : c8 __ __ INY
+0e0b : 91 23 __ STA (SP + 0),y
+0e0d : a9 01 __ LDA #$01
+0e0f : a0 07 __ LDY #$07
+0e11 : 91 23 __ STA (SP + 0),y
+0e13 : a9 ff __ LDA #$ff
+0e15 : c8 __ __ INY
+0e16 : 91 23 __ STA (SP + 0),y
+0e18 : a9 20 __ LDA #$20
+0e1a : a0 06 __ LDY #$06
+0e1c : 91 23 __ STA (SP + 0),y
+0e1e : a9 00 __ LDA #$00
+0e20 : a0 0b __ LDY #$0b
+0e22 : 91 23 __ STA (SP + 0),y
+0e24 : c8 __ __ INY
+0e25 : 91 23 __ STA (SP + 0),y
+0e27 : c8 __ __ INY
+0e28 : 91 23 __ STA (SP + 0),y
+0e2a : e6 57 __ INC T2 + 0
+0e2c : d0 02 __ BNE $0e30
+0e2e : e6 58 __ INC T2 + 1
+0e30 : a5 43 __ LDA T3 + 0
+0e32 : c9 2b __ CMP #$2b
+0e34 : d0 03 __ BNE $0e39
+0e36 : 4c 76 12 JMP $1276 ; (sformat + 1395)
+0e39 : c9 30 __ CMP #$30
+0e3b : d0 03 __ BNE $0e40
+0e3d : 4c 67 12 JMP $1267 ; (sformat + 1380)
+0e40 : c9 23 __ CMP #$23
+0e42 : d0 03 __ BNE $0e47
+0e44 : 4c 58 12 JMP $1258 ; (sformat + 1365)
+0e47 : c9 30 __ CMP #$30
+0e49 : 90 65 __ BCC $0eb0
+0e4b : a9 39 __ LDA #$39
+0e4d : c5 43 __ CMP T3 + 0
+0e4f : 90 5f __ BCC $0eb0
+0e51 : a9 00 __ LDA #$00
+0e53 : 85 45 __ STA T5 + 0
+0e55 : 85 46 __ STA T5 + 1
+0e57 : a5 43 __ LDA T3 + 0
+0e59 : c9 30 __ CMP #$30
+0e5b : 90 4d __ BCC $0eaa
+0e5d : a9 39 __ LDA #$39
+0e5f : c5 43 __ CMP T3 + 0
+0e61 : 90 47 __ BCC $0eaa
+0e63 : a5 43 __ LDA T3 + 0
+0e65 : 85 47 __ STA T6 + 0
+0e67 : a0 00 __ LDY #$00
+0e69 : b1 57 __ LDA (T2 + 0),y
+0e6b : 85 43 __ STA T3 + 0
+0e6d : e6 57 __ INC T2 + 0
+0e6f : d0 02 __ BNE $0e73
+0e71 : e6 58 __ INC T2 + 1
+0e73 : a5 45 __ LDA T5 + 0
+0e75 : 0a __ __ ASL
+0e76 : 85 07 __ STA $07
+0e78 : a5 46 __ LDA T5 + 1
+0e7a : 2a __ __ ROL
+0e7b : 06 07 __ ASL $07
+0e7d : 2a __ __ ROL
+0e7e : aa __ __ TAX
+0e7f : 18 __ __ CLC
+0e80 : a5 07 __ LDA $07
+0e82 : 65 45 __ ADC T5 + 0
+0e84 : 85 1b __ STA ACCU + 0
+0e86 : 8a __ __ TXA
+0e87 : 65 46 __ ADC T5 + 1
+0e89 : 06 1b __ ASL ACCU + 0
+0e8b : 2a __ __ ROL
+0e8c : 85 1c __ STA ACCU + 1
+0e8e : 18 __ __ CLC
+0e8f : a5 1b __ LDA ACCU + 0
+0e91 : 65 47 __ ADC T6 + 0
+0e93 : aa __ __ TAX
+0e94 : a5 1c __ LDA ACCU + 1
+0e96 : 69 00 __ ADC #$00
+0e98 : a8 __ __ TAY
+0e99 : 38 __ __ SEC
+0e9a : 8a __ __ TXA
+0e9b : e9 30 __ SBC #$30
+0e9d : 85 45 __ STA T5 + 0
+0e9f : 98 __ __ TYA
+0ea0 : e9 00 __ SBC #$00
+0ea2 : 85 46 __ STA T5 + 1
+0ea4 : a5 43 __ LDA T3 + 0
+0ea6 : c9 30 __ CMP #$30
+0ea8 : b0 b3 __ BCS $0e5d
+0eaa : a5 45 __ LDA T5 + 0
+0eac : a0 07 __ LDY #$07
+0eae : 91 23 __ STA (SP + 0),y
+0eb0 : a5 43 __ LDA T3 + 0
+0eb2 : c9 2e __ CMP #$2e
+0eb4 : d0 03 __ BNE $0eb9
+0eb6 : 4c ea 11 JMP $11ea ; (sformat + 1255)
+0eb9 : a5 43 __ LDA T3 + 0
+0ebb : c9 64 __ CMP #$64
+0ebd : d0 03 __ BNE $0ec2
+0ebf : 4c a0 11 JMP $11a0 ; (sformat + 1181)
+0ec2 : c9 75 __ CMP #$75
+0ec4 : d0 03 __ BNE $0ec9
+0ec6 : 4c 56 11 JMP $1156 ; (sformat + 1107)
+0ec9 : c9 78 __ CMP #$78
+0ecb : d0 03 __ BNE $0ed0
+0ecd : 4c 01 11 JMP $1101 ; (sformat + 1022)
+0ed0 : c9 6c __ CMP #$6c
+0ed2 : d0 03 __ BNE $0ed7
+0ed4 : 4c 0b 10 JMP $100b ; (sformat + 776)
+0ed7 : c9 66 __ CMP #$66
+0ed9 : d0 03 __ BNE $0ede
+0edb : 4c a1 0f JMP $0fa1 ; (sformat + 670)
+0ede : c9 67 __ CMP #$67
+0ee0 : d0 03 __ BNE $0ee5
+0ee2 : 4c a1 0f JMP $0fa1 ; (sformat + 670)
+0ee5 : c9 65 __ CMP #$65
+0ee7 : d0 03 __ BNE $0eec
+0ee9 : 4c a1 0f JMP $0fa1 ; (sformat + 670)
+0eec : c9 73 __ CMP #$73
+0eee : f0 3f __ BEQ $0f2f
+0ef0 : c9 63 __ CMP #$63
+0ef2 : f0 12 __ BEQ $0f06
+0ef4 : 09 00 __ ORA #$00
+0ef6 : d0 03 __ BNE $0efb
+0ef8 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0efb : a5 43 __ LDA T3 + 0
+0efd : a4 55 __ LDY T1 + 0
+0eff : 91 53 __ STA (T0 + 0),y
+0f01 : e6 55 __ INC T1 + 0
+0f03 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0f06 : a0 14 __ LDY #$14
+0f08 : b1 23 __ LDA (SP + 0),y
+0f0a : 85 45 __ STA T5 + 0
+0f0c : 18 __ __ CLC
+0f0d : 69 02 __ ADC #$02
+0f0f : aa __ __ TAX
+0f10 : c8 __ __ INY
+0f11 : b1 23 __ LDA (SP + 0),y
+0f13 : 85 46 __ STA T5 + 1
+0f15 : 69 00 __ ADC #$00
+0f17 : 85 48 __ STA T6 + 1
+0f19 : 8a __ __ TXA
+0f1a : 88 __ __ DEY
+0f1b : 91 23 __ STA (SP + 0),y
+0f1d : a5 48 __ LDA T6 + 1
+0f1f : c8 __ __ INY
+0f20 : 91 23 __ STA (SP + 0),y
+0f22 : a0 00 __ LDY #$00
+0f24 : b1 45 __ LDA (T5 + 0),y
+0f26 : a4 55 __ LDY T1 + 0
+0f28 : 91 53 __ STA (T0 + 0),y
+0f2a : e6 55 __ INC T1 + 0
+0f2c : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0f2f : a0 14 __ LDY #$14
+0f31 : b1 23 __ LDA (SP + 0),y
+0f33 : 85 45 __ STA T5 + 0
+0f35 : 18 __ __ CLC
+0f36 : 69 02 __ ADC #$02
+0f38 : aa __ __ TAX
+0f39 : c8 __ __ INY
+0f3a : b1 23 __ LDA (SP + 0),y
+0f3c : 85 46 __ STA T5 + 1
+0f3e : 69 00 __ ADC #$00
+0f40 : 85 48 __ STA T6 + 1
+0f42 : 8a __ __ TXA
+0f43 : 88 __ __ DEY
+0f44 : 91 23 __ STA (SP + 0),y
+0f46 : a5 48 __ LDA T6 + 1
+0f48 : c8 __ __ INY
+0f49 : 91 23 __ STA (SP + 0),y
+0f4b : a0 00 __ LDY #$00
+0f4d : b1 45 __ LDA (T5 + 0),y
+0f4f : 85 02 __ STA $02
+0f51 : c8 __ __ INY
+0f52 : b1 45 __ LDA (T5 + 0),y
+0f54 : 85 46 __ STA T5 + 1
+0f56 : a5 02 __ LDA $02
+0f58 : 85 45 __ STA T5 + 0
+0f5a : a0 16 __ LDY #$16
+0f5c : b1 23 __ LDA (SP + 0),y
+0f5e : d0 33 __ BNE $0f93
+0f60 : a0 00 __ LDY #$00
+0f62 : b1 45 __ LDA (T5 + 0),y
+0f64 : 85 43 __ STA T3 + 0
+0f66 : d0 03 __ BNE $0f6b
+0f68 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0f6b : 18 __ __ CLC
+0f6c : a5 02 __ LDA $02
+0f6e : 69 01 __ ADC #$01
+0f70 : 85 45 __ STA T5 + 0
+0f72 : 90 02 __ BCC $0f76
+0f74 : e6 46 __ INC T5 + 1
+0f76 : a5 43 __ LDA T3 + 0
+0f78 : a0 00 __ LDY #$00
+0f7a : 91 53 __ STA (T0 + 0),y
+0f7c : e6 53 __ INC T0 + 0
+0f7e : d0 02 __ BNE $0f82
+0f80 : e6 54 __ INC T0 + 1
+0f82 : b1 45 __ LDA (T5 + 0),y
+0f84 : aa __ __ TAX
+0f85 : e6 45 __ INC T5 + 0
+0f87 : d0 02 __ BNE $0f8b
+0f89 : e6 46 __ INC T5 + 1
+0f8b : 8a __ __ TXA
+0f8c : 86 43 __ STX T3 + 0
+0f8e : d0 e6 __ BNE $0f76
+0f90 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0f93 : a5 02 __ LDA $02
+0f95 : 85 0d __ STA P0
+0f97 : a5 46 __ LDA T5 + 1
+0f99 : 85 0e __ STA P1
+0f9b : 20 be 12 JSR $12be ; (puts + 0)
+0f9e : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+0fa1 : 18 __ __ CLC
+0fa2 : a5 23 __ LDA SP + 0
+0fa4 : 69 06 __ ADC #$06
+0fa6 : 85 0d __ STA P0
+0fa8 : a5 24 __ LDA SP + 1
+0faa : 69 00 __ ADC #$00
+0fac : 85 0e __ STA P1
+0fae : a5 53 __ LDA T0 + 0
+0fb0 : 85 0f __ STA P2
+0fb2 : a5 54 __ LDA T0 + 1
+0fb4 : 85 10 __ STA P3
+0fb6 : a0 14 __ LDY #$14
+0fb8 : b1 23 __ LDA (SP + 0),y
+0fba : 85 45 __ STA T5 + 0
+0fbc : c8 __ __ INY
+0fbd : b1 23 __ LDA (SP + 0),y
+0fbf : 85 46 __ STA T5 + 1
+0fc1 : a0 00 __ LDY #$00
+0fc3 : b1 45 __ LDA (T5 + 0),y
+0fc5 : 85 11 __ STA P4
+0fc7 : c8 __ __ INY
+0fc8 : b1 45 __ LDA (T5 + 0),y
+0fca : 85 12 __ STA P5
+0fcc : c8 __ __ INY
+0fcd : b1 45 __ LDA (T5 + 0),y
+0fcf : 85 13 __ STA P6
+0fd1 : c8 __ __ INY
+0fd2 : b1 45 __ LDA (T5 + 0),y
+0fd4 : 85 14 __ STA P7
+0fd6 : 20 9d 16 JSR $169d ; (nformf + 0)
+0fd9 : a5 1b __ LDA ACCU + 0
+0fdb : 85 55 __ STA T1 + 0
+0fdd : a0 14 __ LDY #$14
+0fdf : b1 23 __ LDA (SP + 0),y
+0fe1 : 85 45 __ STA T5 + 0
+0fe3 : 18 __ __ CLC
+0fe4 : 69 02 __ ADC #$02
+0fe6 : aa __ __ TAX
+0fe7 : c8 __ __ INY
+0fe8 : b1 23 __ LDA (SP + 0),y
+0fea : 85 46 __ STA T5 + 1
+0fec : 69 00 __ ADC #$00
+0fee : 85 48 __ STA T6 + 1
+0ff0 : 8a __ __ TXA
+0ff1 : 88 __ __ DEY
+0ff2 : 91 23 __ STA (SP + 0),y
+0ff4 : a5 48 __ LDA T6 + 1
+0ff6 : c8 __ __ INY
+0ff7 : 91 23 __ STA (SP + 0),y
+0ff9 : 18 __ __ CLC
+0ffa : a5 45 __ LDA T5 + 0
+0ffc : 69 04 __ ADC #$04
+0ffe : 88 __ __ DEY
+0fff : 91 23 __ STA (SP + 0),y
+1001 : a5 46 __ LDA T5 + 1
+1003 : 69 00 __ ADC #$00
+1005 : c8 __ __ INY
+1006 : 91 23 __ STA (SP + 0),y
+1008 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+100b : a0 14 __ LDY #$14
+100d : b1 23 __ LDA (SP + 0),y
+100f : 85 45 __ STA T5 + 0
+1011 : 18 __ __ CLC
+1012 : 69 02 __ ADC #$02
+1014 : aa __ __ TAX
+1015 : c8 __ __ INY
+1016 : b1 23 __ LDA (SP + 0),y
+1018 : 85 46 __ STA T5 + 1
+101a : a0 00 __ LDY #$00
+101c : b1 45 __ LDA (T5 + 0),y
+101e : 85 49 __ STA T7 + 0
+1020 : c8 __ __ INY
+1021 : b1 45 __ LDA (T5 + 0),y
+1023 : 85 4a __ STA T7 + 1
+1025 : c8 __ __ INY
+1026 : b1 45 __ LDA (T5 + 0),y
+1028 : 85 4b __ STA T7 + 2
+102a : c8 __ __ INY
+102b : b1 45 __ LDA (T5 + 0),y
+102d : 85 4c __ STA T7 + 3
+102f : a5 46 __ LDA T5 + 1
+1031 : 69 00 __ ADC #$00
+1033 : 85 48 __ STA T6 + 1
+1035 : 8a __ __ TXA
+1036 : a0 14 __ LDY #$14
+1038 : 91 23 __ STA (SP + 0),y
+103a : a5 48 __ LDA T6 + 1
+103c : c8 __ __ INY
+103d : 91 23 __ STA (SP + 0),y
+103f : 18 __ __ CLC
+1040 : a5 45 __ LDA T5 + 0
+1042 : 69 04 __ ADC #$04
+1044 : 88 __ __ DEY
+1045 : 91 23 __ STA (SP + 0),y
+1047 : a5 46 __ LDA T5 + 1
+1049 : 69 00 __ ADC #$00
+104b : c8 __ __ INY
+104c : 91 23 __ STA (SP + 0),y
+104e : a0 00 __ LDY #$00
+1050 : b1 57 __ LDA (T2 + 0),y
+1052 : aa __ __ TAX
+1053 : e6 57 __ INC T2 + 0
+1055 : d0 02 __ BNE $1059
+1057 : e6 58 __ INC T2 + 1
+1059 : 8a __ __ TXA
+105a : e0 64 __ CPX #$64
+105c : f0 74 __ BEQ $10d2
+105e : c9 75 __ CMP #$75
+1060 : f0 41 __ BEQ $10a3
+1062 : c9 78 __ CMP #$78
+1064 : f0 03 __ BEQ $1069
+1066 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+1069 : a9 10 __ LDA #$10
+106b : a0 09 __ LDY #$09
+106d : 91 23 __ STA (SP + 0),y
+106f : a9 00 __ LDA #$00
+1071 : c8 __ __ INY
+1072 : 91 23 __ STA (SP + 0),y
+1074 : 18 __ __ CLC
+1075 : a5 23 __ LDA SP + 0
+1077 : 69 06 __ ADC #$06
+1079 : 85 0d __ STA P0
+107b : a5 24 __ LDA SP + 1
+107d : 69 00 __ ADC #$00
+107f : 85 0e __ STA P1
+1081 : a5 53 __ LDA T0 + 0
+1083 : 85 0f __ STA P2
+1085 : a5 54 __ LDA T0 + 1
+1087 : 85 10 __ STA P3
+1089 : a5 49 __ LDA T7 + 0
+108b : 85 11 __ STA P4
+108d : a5 4a __ LDA T7 + 1
+108f : 85 12 __ STA P5
+1091 : a5 4b __ LDA T7 + 2
+1093 : 85 13 __ STA P6
+1095 : a5 4c __ LDA T7 + 3
+1097 : 85 14 __ STA P7
+1099 : 20 70 14 JSR $1470 ; (nforml + 0)
+109c : a5 1b __ LDA ACCU + 0
+109e : 85 55 __ STA T1 + 0
+10a0 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+10a3 : 18 __ __ CLC
+10a4 : a5 23 __ LDA SP + 0
+10a6 : 69 06 __ ADC #$06
+10a8 : 85 0d __ STA P0
+10aa : a5 24 __ LDA SP + 1
+10ac : 69 00 __ ADC #$00
+10ae : 85 0e __ STA P1
+10b0 : a5 53 __ LDA T0 + 0
+10b2 : 85 0f __ STA P2
+10b4 : a5 54 __ LDA T0 + 1
+10b6 : 85 10 __ STA P3
+10b8 : a5 49 __ LDA T7 + 0
+10ba : 85 11 __ STA P4
+10bc : a5 4a __ LDA T7 + 1
+10be : 85 12 __ STA P5
+10c0 : a5 4b __ LDA T7 + 2
+10c2 : 85 13 __ STA P6
+10c4 : a5 4c __ LDA T7 + 3
+10c6 : 85 14 __ STA P7
+10c8 : 20 70 14 JSR $1470 ; (nforml + 0)
+10cb : a5 1b __ LDA ACCU + 0
+10cd : 85 55 __ STA T1 + 0
+10cf : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+10d2 : 18 __ __ CLC
+10d3 : a5 23 __ LDA SP + 0
+10d5 : 69 06 __ ADC #$06
+10d7 : 85 0d __ STA P0
+10d9 : a5 24 __ LDA SP + 1
+10db : 69 00 __ ADC #$00
+10dd : 85 0e __ STA P1
+10df : a5 53 __ LDA T0 + 0
+10e1 : 85 0f __ STA P2
+10e3 : a5 54 __ LDA T0 + 1
+10e5 : 85 10 __ STA P3
+10e7 : a5 49 __ LDA T7 + 0
+10e9 : 85 11 __ STA P4
+10eb : a5 4a __ LDA T7 + 1
+10ed : 85 12 __ STA P5
+10ef : a5 4b __ LDA T7 + 2
+10f1 : 85 13 __ STA P6
+10f3 : a5 4c __ LDA T7 + 3
+10f5 : 85 14 __ STA P7
+10f7 : 20 70 14 JSR $1470 ; (nforml + 0)
+10fa : a5 1b __ LDA ACCU + 0
+10fc : 85 55 __ STA T1 + 0
+10fe : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+1101 : a9 10 __ LDA #$10
+1103 : a0 09 __ LDY #$09
+1105 : 91 23 __ STA (SP + 0),y
+1107 : a9 00 __ LDA #$00
+1109 : c8 __ __ INY
+110a : 91 23 __ STA (SP + 0),y
+110c : 18 __ __ CLC
+110d : a5 23 __ LDA SP + 0
+110f : 69 06 __ ADC #$06
+1111 : 85 0d __ STA P0
+1113 : a5 24 __ LDA SP + 1
+1115 : 69 00 __ ADC #$00
+1117 : 85 0e __ STA P1
+1119 : a5 53 __ LDA T0 + 0
+111b : 85 0f __ STA P2
+111d : a5 54 __ LDA T0 + 1
+111f : 85 10 __ STA P3
+1121 : a0 14 __ LDY #$14
+1123 : b1 23 __ LDA (SP + 0),y
+1125 : 85 45 __ STA T5 + 0
+1127 : 18 __ __ CLC
+1128 : 69 02 __ ADC #$02
+112a : aa __ __ TAX
+112b : c8 __ __ INY
+112c : b1 23 __ LDA (SP + 0),y
+112e : 85 46 __ STA T5 + 1
+1130 : 69 00 __ ADC #$00
+1132 : 85 48 __ STA T6 + 1
+1134 : 8a __ __ TXA
+1135 : 88 __ __ DEY
+1136 : 91 23 __ STA (SP + 0),y
+1138 : a5 48 __ LDA T6 + 1
+113a : c8 __ __ INY
+113b : 91 23 __ STA (SP + 0),y
+113d : a0 00 __ LDY #$00
+113f : b1 45 __ LDA (T5 + 0),y
+1141 : 85 11 __ STA P4
+1143 : c8 __ __ INY
+1144 : b1 45 __ LDA (T5 + 0),y
+1146 : 85 12 __ STA P5
+1148 : a9 00 __ LDA #$00
+114a : 85 13 __ STA P6
+114c : 20 fc 12 JSR $12fc ; (nformi + 0)
+114f : a5 1b __ LDA ACCU + 0
+1151 : 85 55 __ STA T1 + 0
+1153 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+1156 : 18 __ __ CLC
+1157 : a5 23 __ LDA SP + 0
+1159 : 69 06 __ ADC #$06
+115b : 85 0d __ STA P0
+115d : a5 24 __ LDA SP + 1
+115f : 69 00 __ ADC #$00
+1161 : 85 0e __ STA P1
+1163 : a5 53 __ LDA T0 + 0
+1165 : 85 0f __ STA P2
+1167 : a5 54 __ LDA T0 + 1
+1169 : 85 10 __ STA P3
+116b : a0 14 __ LDY #$14
+116d : b1 23 __ LDA (SP + 0),y
+116f : 85 45 __ STA T5 + 0
+1171 : 18 __ __ CLC
+1172 : 69 02 __ ADC #$02
+1174 : aa __ __ TAX
+1175 : c8 __ __ INY
+1176 : b1 23 __ LDA (SP + 0),y
+1178 : 85 46 __ STA T5 + 1
+117a : 69 00 __ ADC #$00
+117c : 85 48 __ STA T6 + 1
+117e : 8a __ __ TXA
+117f : 88 __ __ DEY
+1180 : 91 23 __ STA (SP + 0),y
+1182 : a5 48 __ LDA T6 + 1
+1184 : c8 __ __ INY
+1185 : 91 23 __ STA (SP + 0),y
+1187 : a0 00 __ LDY #$00
+1189 : b1 45 __ LDA (T5 + 0),y
+118b : 85 11 __ STA P4
+118d : c8 __ __ INY
+118e : b1 45 __ LDA (T5 + 0),y
+1190 : 85 12 __ STA P5
+1192 : a9 00 __ LDA #$00
+1194 : 85 13 __ STA P6
+1196 : 20 fc 12 JSR $12fc ; (nformi + 0)
+1199 : a5 1b __ LDA ACCU + 0
+119b : 85 55 __ STA T1 + 0
+119d : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+11a0 : 18 __ __ CLC
+11a1 : a5 23 __ LDA SP + 0
+11a3 : 69 06 __ ADC #$06
+11a5 : 85 0d __ STA P0
+11a7 : a5 24 __ LDA SP + 1
+11a9 : 69 00 __ ADC #$00
+11ab : 85 0e __ STA P1
+11ad : a5 53 __ LDA T0 + 0
+11af : 85 0f __ STA P2
+11b1 : a5 54 __ LDA T0 + 1
+11b3 : 85 10 __ STA P3
+11b5 : a0 14 __ LDY #$14
+11b7 : b1 23 __ LDA (SP + 0),y
+11b9 : 85 45 __ STA T5 + 0
+11bb : 18 __ __ CLC
+11bc : 69 02 __ ADC #$02
+11be : aa __ __ TAX
+11bf : c8 __ __ INY
+11c0 : b1 23 __ LDA (SP + 0),y
+11c2 : 85 46 __ STA T5 + 1
+11c4 : 69 00 __ ADC #$00
+11c6 : 85 48 __ STA T6 + 1
+11c8 : 8a __ __ TXA
+11c9 : 88 __ __ DEY
+11ca : 91 23 __ STA (SP + 0),y
+11cc : a5 48 __ LDA T6 + 1
+11ce : c8 __ __ INY
+11cf : 91 23 __ STA (SP + 0),y
+11d1 : a0 00 __ LDY #$00
+11d3 : b1 45 __ LDA (T5 + 0),y
+11d5 : 85 11 __ STA P4
+11d7 : c8 __ __ INY
+11d8 : b1 45 __ LDA (T5 + 0),y
+11da : 85 12 __ STA P5
+11dc : a9 01 __ LDA #$01
+11de : 85 13 __ STA P6
+11e0 : 20 fc 12 JSR $12fc ; (nformi + 0)
+11e3 : a5 1b __ LDA ACCU + 0
+11e5 : 85 55 __ STA T1 + 0
+11e7 : 4c c1 0d JMP $0dc1 ; (sformat + 190)
+11ea : a9 00 __ LDA #$00
+11ec : 85 45 __ STA T5 + 0
+11ee : 85 46 __ STA T5 + 1
+11f0 : a0 00 __ LDY #$00
+11f2 : b1 57 __ LDA (T2 + 0),y
+11f4 : 85 43 __ STA T3 + 0
+11f6 : e6 57 __ INC T2 + 0
+11f8 : d0 02 __ BNE $11fc
+11fa : e6 58 __ INC T2 + 1
+11fc : a5 43 __ LDA T3 + 0
+11fe : c9 30 __ CMP #$30
+1200 : 90 4d __ BCC $124f
+1202 : a9 39 __ LDA #$39
+1204 : c5 43 __ CMP T3 + 0
+1206 : 90 47 __ BCC $124f
+1208 : a5 43 __ LDA T3 + 0
+120a : 85 47 __ STA T6 + 0
+120c : a0 00 __ LDY #$00
+120e : b1 57 __ LDA (T2 + 0),y
+1210 : 85 43 __ STA T3 + 0
+1212 : e6 57 __ INC T2 + 0
+1214 : d0 02 __ BNE $1218
+1216 : e6 58 __ INC T2 + 1
+1218 : a5 45 __ LDA T5 + 0
+121a : 0a __ __ ASL
+121b : 85 07 __ STA $07
+121d : a5 46 __ LDA T5 + 1
+121f : 2a __ __ ROL
+1220 : 06 07 __ ASL $07
+1222 : 2a __ __ ROL
+1223 : aa __ __ TAX
+1224 : 18 __ __ CLC
+1225 : a5 07 __ LDA $07
+1227 : 65 45 __ ADC T5 + 0
+1229 : 85 1b __ STA ACCU + 0
+122b : 8a __ __ TXA
+122c : 65 46 __ ADC T5 + 1
+122e : 06 1b __ ASL ACCU + 0
+1230 : 2a __ __ ROL
+1231 : 85 1c __ STA ACCU + 1
+1233 : 18 __ __ CLC
+1234 : a5 1b __ LDA ACCU + 0
+1236 : 65 47 __ ADC T6 + 0
+1238 : aa __ __ TAX
+1239 : a5 1c __ LDA ACCU + 1
+123b : 69 00 __ ADC #$00
+123d : a8 __ __ TAY
+123e : 38 __ __ SEC
+123f : 8a __ __ TXA
+1240 : e9 30 __ SBC #$30
+1242 : 85 45 __ STA T5 + 0
+1244 : 98 __ __ TYA
+1245 : e9 00 __ SBC #$00
+1247 : 85 46 __ STA T5 + 1
+1249 : a5 43 __ LDA T3 + 0
+124b : c9 30 __ CMP #$30
+124d : b0 b3 __ BCS $1202
+124f : a5 45 __ LDA T5 + 0
+1251 : a0 08 __ LDY #$08
+1253 : 91 23 __ STA (SP + 0),y
+1255 : 4c b9 0e JMP $0eb9 ; (sformat + 438)
+1258 : a9 01 __ LDA #$01
+125a : a0 0d __ LDY #$0d
+125c : 91 23 __ STA (SP + 0),y
+125e : a0 00 __ LDY #$00
+1260 : b1 57 __ LDA (T2 + 0),y
+1262 : 85 43 __ STA T3 + 0
+1264 : 4c 2a 0e JMP $0e2a ; (sformat + 295)
+1267 : a9 30 __ LDA #$30
+1269 : a0 06 __ LDY #$06
+126b : 91 23 __ STA (SP + 0),y
+126d : a0 00 __ LDY #$00
+126f : b1 57 __ LDA (T2 + 0),y
+1271 : 85 43 __ STA T3 + 0
+1273 : 4c 2a 0e JMP $0e2a ; (sformat + 295)
+1276 : a9 01 __ LDA #$01
+1278 : a0 0b __ LDY #$0b
+127a : 91 23 __ STA (SP + 0),y
+127c : a0 00 __ LDY #$00
+127e : b1 57 __ LDA (T2 + 0),y
+1280 : 85 43 __ STA T3 + 0
+1282 : 4c 2a 0e JMP $0e2a ; (sformat + 295)
+1285 : a0 16 __ LDY #$16
+1287 : b1 23 __ LDA (SP + 0),y
+1289 : d0 12 __ BNE $129d
+128b : 18 __ __ CLC
+128c : a5 53 __ LDA T0 + 0
+128e : 65 55 __ ADC T1 + 0
+1290 : 85 53 __ STA T0 + 0
+1292 : 90 02 __ BCC $1296
+1294 : e6 54 __ INC T0 + 1
+1296 : a9 00 __ LDA #$00
+1298 : 85 55 __ STA T1 + 0
+129a : 4c fc 0d JMP $0dfc ; (sformat + 249)
+129d : 18 __ __ CLC
+129e : a5 53 __ LDA T0 + 0
+12a0 : 85 0d __ STA P0
+12a2 : 65 55 __ ADC T1 + 0
+12a4 : 85 45 __ STA T5 + 0
+12a6 : a5 54 __ LDA T0 + 1
+12a8 : 85 0e __ STA P1
+12aa : 69 00 __ ADC #$00
+12ac : 85 46 __ STA T5 + 1
+12ae : a9 00 __ LDA #$00
+12b0 : a0 00 __ LDY #$00
+12b2 : 91 45 __ STA (T5 + 0),y
+12b4 : 20 be 12 JSR $12be ; (puts + 0)
+12b7 : a9 00 __ LDA #$00
+12b9 : 85 55 __ STA T1 + 0
+12bb : 4c fc 0d JMP $0dfc ; (sformat + 249)
+--------------------------------------------------------------------
+puts:
+12be : a0 00 __ LDY #$00
+12c0 : b1 0d __ LDA (P0),y
+12c2 : f0 0b __ BEQ $12cf
+12c4 : 20 d0 12 JSR $12d0 ; (putpch + 0)
+12c7 : e6 0d __ INC P0
+12c9 : d0 f3 __ BNE $12be
+12cb : e6 0e __ INC P1
+12cd : d0 ef __ BNE $12be
+12cf : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+12d0 : ae ab 21 LDX $21ab ; (giocharmap + 0)
+12d3 : e0 01 __ CPX #$01
+12d5 : 90 22 __ BCC $12f9
+12d7 : c9 0a __ CMP #$0a
+12d9 : d0 02 __ BNE $12dd
+12db : a9 0d __ LDA #$0d
+12dd : e0 02 __ CPX #$02
+12df : 90 18 __ BCC $12f9
+12e1 : c9 41 __ CMP #$41
+12e3 : 90 14 __ BCC $12f9
+12e5 : c9 7b __ CMP #$7b
+12e7 : b0 10 __ BCS $12f9
+12e9 : c9 61 __ CMP #$61
+12eb : b0 04 __ BCS $12f1
+12ed : c9 5b __ CMP #$5b
+12ef : b0 08 __ BCS $12f9
+12f1 : 49 20 __ EOR #$20
+12f3 : e0 03 __ CPX #$03
+12f5 : f0 02 __ BEQ $12f9
+12f7 : 29 df __ AND #$df
+12f9 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+12fc : a5 11 __ LDA P4
+12fe : 85 45 __ STA T1 + 0
+1300 : a5 12 __ LDA P5
+1302 : 85 46 __ STA T1 + 1
+1304 : a9 00 __ LDA #$00
+1306 : 85 49 __ STA T3 + 0
+1308 : a5 13 __ LDA P6
+130a : f0 07 __ BEQ $1313
+130c : a5 12 __ LDA P5
+130e : 10 03 __ BPL $1313
+1310 : 4c 54 14 JMP $1454 ; (nformi + 344)
+1313 : a9 0a __ LDA #$0a
+1315 : 85 4a __ STA T4 + 0
+1317 : a5 11 __ LDA P4
+1319 : 05 12 __ ORA P5
+131b : f0 03 __ BEQ $1320
+131d : 4c fa 13 JMP $13fa ; (nformi + 254)
+1320 : a0 02 __ LDY #$02
+1322 : b1 0d __ LDA (P0),y
+1324 : 85 4b __ STA T5 + 0
+1326 : c9 ff __ CMP #$ff
+1328 : d0 03 __ BNE $132d
+132a : 4c ec 13 JMP $13ec ; (nformi + 240)
+132d : 38 __ __ SEC
+132e : a9 0a __ LDA #$0a
+1330 : e5 4b __ SBC T5 + 0
+1332 : 85 4b __ STA T5 + 0
+1334 : c5 4a __ CMP T4 + 0
+1336 : b0 0e __ BCS $1346
+1338 : c6 4a __ DEC T4 + 0
+133a : a9 30 __ LDA #$30
+133c : a4 4a __ LDY T4 + 0
+133e : 91 0f __ STA (P2),y
+1340 : a5 4b __ LDA T5 + 0
+1342 : c5 4a __ CMP T4 + 0
+1344 : 90 f2 __ BCC $1338
+1346 : a0 07 __ LDY #$07
+1348 : b1 0d __ LDA (P0),y
+134a : f0 34 __ BEQ $1380
+134c : a0 03 __ LDY #$03
+134e : b1 0d __ LDA (P0),y
+1350 : 85 45 __ STA T1 + 0
+1352 : c8 __ __ INY
+1353 : b1 0d __ LDA (P0),y
+1355 : d0 29 __ BNE $1380
+1357 : a5 45 __ LDA T1 + 0
+1359 : c9 10 __ CMP #$10
+135b : d0 23 __ BNE $1380
+135d : 18 __ __ CLC
+135e : a5 4a __ LDA T4 + 0
+1360 : 69 ff __ ADC #$ff
+1362 : 18 __ __ CLC
+1363 : 65 0f __ ADC P2
+1365 : 85 45 __ STA T1 + 0
+1367 : a5 10 __ LDA P3
+1369 : 69 00 __ ADC #$00
+136b : 85 46 __ STA T1 + 1
+136d : a9 58 __ LDA #$58
+136f : a0 00 __ LDY #$00
+1371 : 91 45 __ STA (T1 + 0),y
+1373 : 18 __ __ CLC
+1374 : a5 4a __ LDA T4 + 0
+1376 : 69 fe __ ADC #$fe
+1378 : 85 4a __ STA T4 + 0
+137a : a9 30 __ LDA #$30
+137c : a4 4a __ LDY T4 + 0
+137e : 91 0f __ STA (P2),y
+1380 : a5 49 __ LDA T3 + 0
+1382 : d0 5d __ BNE $13e1
+1384 : a0 05 __ LDY #$05
+1386 : b1 0d __ LDA (P0),y
+1388 : f0 08 __ BEQ $1392
+138a : c6 4a __ DEC T4 + 0
+138c : a9 2b __ LDA #$2b
+138e : a4 4a __ LDY T4 + 0
+1390 : 91 0f __ STA (P2),y
+1392 : a0 01 __ LDY #$01
+1394 : b1 0d __ LDA (P0),y
+1396 : 85 49 __ STA T3 + 0
+1398 : 38 __ __ SEC
+1399 : a9 0a __ LDA #$0a
+139b : e5 49 __ SBC T3 + 0
+139d : 85 45 __ STA T1 + 0
+139f : a9 00 __ LDA #$00
+13a1 : e9 00 __ SBC #$00
+13a3 : 49 80 __ EOR #$80
+13a5 : c9 80 __ CMP #$80
+13a7 : d0 04 __ BNE $13ad
+13a9 : a5 45 __ LDA T1 + 0
+13ab : c5 4a __ CMP T4 + 0
+13ad : 90 25 __ BCC $13d4
+13af : a9 00 __ LDA #$00
+13b1 : 85 49 __ STA T3 + 0
+13b3 : a5 4a __ LDA T4 + 0
+13b5 : c9 0a __ CMP #$0a
+13b7 : b0 12 __ BCS $13cb
+13b9 : a4 4a __ LDY T4 + 0
+13bb : b1 0f __ LDA (P2),y
+13bd : a4 49 __ LDY T3 + 0
+13bf : 91 0f __ STA (P2),y
+13c1 : e6 49 __ INC T3 + 0
+13c3 : e6 4a __ INC T4 + 0
+13c5 : a5 4a __ LDA T4 + 0
+13c7 : c9 0a __ CMP #$0a
+13c9 : 90 ee __ BCC $13b9
+13cb : a5 49 __ LDA T3 + 0
+13cd : 85 1b __ STA ACCU + 0
+13cf : a9 00 __ LDA #$00
+13d1 : 85 1c __ STA ACCU + 1
+13d3 : 60 __ __ RTS
+13d4 : c6 4a __ DEC T4 + 0
+13d6 : a0 00 __ LDY #$00
+13d8 : b1 0d __ LDA (P0),y
+13da : a4 4a __ LDY T4 + 0
+13dc : 91 0f __ STA (P2),y
+13de : 4c 92 13 JMP $1392 ; (nformi + 150)
+13e1 : c6 4a __ DEC T4 + 0
+13e3 : a9 2d __ LDA #$2d
+13e5 : a4 4a __ LDY T4 + 0
+13e7 : 91 0f __ STA (P2),y
+13e9 : 4c 92 13 JMP $1392 ; (nformi + 150)
+13ec : a9 09 __ LDA #$09
+13ee : 85 4b __ STA T5 + 0
+13f0 : c5 4a __ CMP T4 + 0
+13f2 : b0 03 __ BCS $13f7
+13f4 : 4c 38 13 JMP $1338 ; (nformi + 60)
+13f7 : 4c 46 13 JMP $1346 ; (nformi + 74)
+13fa : a5 45 __ LDA T1 + 0
+13fc : 85 1b __ STA ACCU + 0
+13fe : a5 46 __ LDA T1 + 1
+1400 : 85 1c __ STA ACCU + 1
+1402 : a0 03 __ LDY #$03
+1404 : b1 0d __ LDA (P0),y
+1406 : 85 03 __ STA $03
+1408 : c8 __ __ INY
+1409 : b1 0d __ LDA (P0),y
+140b : 85 04 __ STA $04
+140d : 20 c7 1f JSR $1fc7 ; (divmod + 0)
+1410 : a5 06 __ LDA $06
+1412 : 10 30 __ BPL $1444
+1414 : 18 __ __ CLC
+1415 : a5 05 __ LDA $05
+1417 : 69 30 __ ADC #$30
+1419 : c6 4a __ DEC T4 + 0
+141b : a4 4a __ LDY T4 + 0
+141d : 91 0f __ STA (P2),y
+141f : a5 45 __ LDA T1 + 0
+1421 : 85 1b __ STA ACCU + 0
+1423 : a5 46 __ LDA T1 + 1
+1425 : 85 1c __ STA ACCU + 1
+1427 : a0 03 __ LDY #$03
+1429 : b1 0d __ LDA (P0),y
+142b : 85 03 __ STA $03
+142d : c8 __ __ INY
+142e : b1 0d __ LDA (P0),y
+1430 : 85 04 __ STA $04
+1432 : 20 c7 1f JSR $1fc7 ; (divmod + 0)
+1435 : a5 1b __ LDA ACCU + 0
+1437 : 85 45 __ STA T1 + 0
+1439 : a5 1c __ LDA ACCU + 1
+143b : 85 46 __ STA T1 + 1
+143d : 05 1b __ ORA ACCU + 0
+143f : d0 b9 __ BNE $13fa
+1441 : 4c 20 13 JMP $1320 ; (nformi + 36)
+1444 : d0 06 __ BNE $144c
+1446 : a5 05 __ LDA $05
+1448 : c9 0a __ CMP #$0a
+144a : 90 c8 __ BCC $1414
+144c : 18 __ __ CLC
+144d : a5 05 __ LDA $05
+144f : 69 37 __ ADC #$37
+1451 : 4c 19 14 JMP $1419 ; (nformi + 285)
+1454 : a9 01 __ LDA #$01
+1456 : 85 49 __ STA T3 + 0
+1458 : a9 0a __ LDA #$0a
+145a : 85 4a __ STA T4 + 0
+145c : 38 __ __ SEC
+145d : a9 00 __ LDA #$00
+145f : e5 11 __ SBC P4
+1461 : 85 45 __ STA T1 + 0
+1463 : a9 00 __ LDA #$00
+1465 : e5 12 __ SBC P5
+1467 : 85 46 __ STA T1 + 1
+1469 : 05 45 __ ORA T1 + 0
+146b : d0 8d __ BNE $13fa
+146d : 4c 20 13 JMP $1320 ; (nformi + 36)
+--------------------------------------------------------------------
+nforml:
+1470 : 38 __ __ SEC
+1471 : a5 23 __ LDA SP + 0
+1473 : e9 05 __ SBC #$05
+1475 : 85 23 __ STA SP + 0
+1477 : a5 24 __ LDA SP + 1
+1479 : e9 00 __ SBC #$00
+147b : 85 24 __ STA SP + 1
+147d : a0 01 __ LDY #$01
+147f : b9 53 00 LDA $0053,y 
+1482 : 91 23 __ STA (SP + 0),y
+1484 : 88 __ __ DEY
+1485 : 10 f8 __ BPL $147f
+1487 : a5 11 __ LDA P4
+1489 : 85 47 __ STA T1 + 0
+148b : a5 12 __ LDA P5
+148d : 85 48 __ STA T1 + 1
+148f : a5 13 __ LDA P6
+1491 : 85 49 __ STA T1 + 2
+1493 : a5 14 __ LDA P7
+1495 : 85 4a __ STA T1 + 3
+1497 : a9 00 __ LDA #$00
+1499 : 85 4d __ STA T3 + 0
+149b : a5 15 __ LDA P8
+149d : f0 03 __ BEQ $14a2
+149f : 4c 48 16 JMP $1648 ; (nforml + 472)
+14a2 : a9 10 __ LDA #$10
+14a4 : 85 4e __ STA T4 + 0
+14a6 : a9 00 __ LDA #$00
+14a8 : c5 14 __ CMP P7
+14aa : d0 0a __ BNE $14b6
+14ac : c5 13 __ CMP P6
+14ae : d0 06 __ BNE $14b6
+14b0 : c5 12 __ CMP P5
+14b2 : d0 02 __ BNE $14b6
+14b4 : c5 11 __ CMP P4
+14b6 : b0 03 __ BCS $14bb
+14b8 : 4c bc 15 JMP $15bc ; (nforml + 332)
+14bb : a0 02 __ LDY #$02
+14bd : b1 0d __ LDA (P0),y
+14bf : 85 4f __ STA T5 + 0
+14c1 : c9 ff __ CMP #$ff
+14c3 : d0 03 __ BNE $14c8
+14c5 : 4c ae 15 JMP $15ae ; (nforml + 318)
+14c8 : 38 __ __ SEC
+14c9 : a9 10 __ LDA #$10
+14cb : e5 4f __ SBC T5 + 0
+14cd : 85 4f __ STA T5 + 0
+14cf : c5 4e __ CMP T4 + 0
+14d1 : b0 0e __ BCS $14e1
+14d3 : c6 4e __ DEC T4 + 0
+14d5 : a9 30 __ LDA #$30
+14d7 : a4 4e __ LDY T4 + 0
+14d9 : 91 0f __ STA (P2),y
+14db : a5 4f __ LDA T5 + 0
+14dd : c5 4e __ CMP T4 + 0
+14df : 90 f2 __ BCC $14d3
+14e1 : a0 07 __ LDY #$07
+14e3 : b1 0d __ LDA (P0),y
+14e5 : f0 34 __ BEQ $151b
+14e7 : a0 03 __ LDY #$03
+14e9 : b1 0d __ LDA (P0),y
+14eb : 85 53 __ STA T7 + 0
+14ed : c8 __ __ INY
+14ee : b1 0d __ LDA (P0),y
+14f0 : d0 29 __ BNE $151b
+14f2 : a5 53 __ LDA T7 + 0
+14f4 : c9 10 __ CMP #$10
+14f6 : d0 23 __ BNE $151b
+14f8 : 18 __ __ CLC
+14f9 : a5 4e __ LDA T4 + 0
+14fb : 69 ff __ ADC #$ff
+14fd : 18 __ __ CLC
+14fe : 65 0f __ ADC P2
+1500 : 85 53 __ STA T7 + 0
+1502 : a5 10 __ LDA P3
+1504 : 69 00 __ ADC #$00
+1506 : 85 54 __ STA T7 + 1
+1508 : a9 58 __ LDA #$58
+150a : a0 00 __ LDY #$00
+150c : 91 53 __ STA (T7 + 0),y
+150e : 18 __ __ CLC
+150f : a5 4e __ LDA T4 + 0
+1511 : 69 fe __ ADC #$fe
+1513 : 85 4e __ STA T4 + 0
+1515 : a9 30 __ LDA #$30
+1517 : a4 4e __ LDY T4 + 0
+1519 : 91 0f __ STA (P2),y
+151b : a5 4d __ LDA T3 + 0
+151d : f0 03 __ BEQ $1522
+151f : 4c a3 15 JMP $15a3 ; (nforml + 307)
+1522 : a0 05 __ LDY #$05
+1524 : b1 0d __ LDA (P0),y
+1526 : f0 08 __ BEQ $1530
+1528 : c6 4e __ DEC T4 + 0
+152a : a9 2b __ LDA #$2b
+152c : a4 4e __ LDY T4 + 0
+152e : 91 0f __ STA (P2),y
+1530 : a0 01 __ LDY #$01
+1532 : b1 0d __ LDA (P0),y
+1534 : 85 53 __ STA T7 + 0
+1536 : 38 __ __ SEC
+1537 : a9 10 __ LDA #$10
+1539 : e5 53 __ SBC T7 + 0
+153b : 85 53 __ STA T7 + 0
+153d : a9 00 __ LDA #$00
+153f : e9 00 __ SBC #$00
+1541 : 49 80 __ EOR #$80
+1543 : c9 80 __ CMP #$80
+1545 : d0 04 __ BNE $154b
+1547 : a5 53 __ LDA T7 + 0
+1549 : c5 4e __ CMP T4 + 0
+154b : 90 49 __ BCC $1596
+154d : a9 00 __ LDA #$00
+154f : 85 4d __ STA T3 + 0
+1551 : a5 4e __ LDA T4 + 0
+1553 : c9 10 __ CMP #$10
+1555 : 90 20 __ BCC $1577
+1557 : a5 4d __ LDA T3 + 0
+1559 : 85 1b __ STA ACCU + 0
+155b : a9 00 __ LDA #$00
+155d : 85 1c __ STA ACCU + 1
+155f : a0 01 __ LDY #$01
+1561 : b1 23 __ LDA (SP + 0),y
+1563 : 99 53 00 STA $0053,y 
+1566 : 88 __ __ DEY
+1567 : 10 f8 __ BPL $1561
+1569 : 18 __ __ CLC
+156a : a5 23 __ LDA SP + 0
+156c : 69 05 __ ADC #$05
+156e : 85 23 __ STA SP + 0
+1570 : a5 24 __ LDA SP + 1
+1572 : 69 00 __ ADC #$00
+1574 : 85 24 __ STA SP + 1
+1576 : 60 __ __ RTS
+1577 : aa __ __ TAX
+1578 : 8a __ __ TXA
+1579 : 18 __ __ CLC
+157a : 65 0f __ ADC P2
+157c : 85 51 __ STA T6 + 0
+157e : a5 10 __ LDA P3
+1580 : 69 00 __ ADC #$00
+1582 : 85 52 __ STA T6 + 1
+1584 : a0 00 __ LDY #$00
+1586 : b1 51 __ LDA (T6 + 0),y
+1588 : a4 4d __ LDY T3 + 0
+158a : 91 0f __ STA (P2),y
+158c : e6 4d __ INC T3 + 0
+158e : e8 __ __ INX
+158f : e0 10 __ CPX #$10
+1591 : 90 e5 __ BCC $1578
+1593 : 4c 57 15 JMP $1557 ; (nforml + 231)
+1596 : c6 4e __ DEC T4 + 0
+1598 : a0 00 __ LDY #$00
+159a : b1 0d __ LDA (P0),y
+159c : a4 4e __ LDY T4 + 0
+159e : 91 0f __ STA (P2),y
+15a0 : 4c 30 15 JMP $1530 ; (nforml + 192)
+15a3 : c6 4e __ DEC T4 + 0
+15a5 : a9 2d __ LDA #$2d
+15a7 : a4 4e __ LDY T4 + 0
+15a9 : 91 0f __ STA (P2),y
+15ab : 4c 30 15 JMP $1530 ; (nforml + 192)
+15ae : a9 0f __ LDA #$0f
+15b0 : 85 4f __ STA T5 + 0
+15b2 : c5 4e __ CMP T4 + 0
+15b4 : b0 03 __ BCS $15b9
+15b6 : 4c d3 14 JMP $14d3 ; (nforml + 99)
+15b9 : 4c e1 14 JMP $14e1 ; (nforml + 113)
+15bc : a0 03 __ LDY #$03
+15be : b1 0d __ LDA (P0),y
+15c0 : 85 03 __ STA $03
+15c2 : c8 __ __ INY
+15c3 : b1 0d __ LDA (P0),y
+15c5 : 85 04 __ STA $04
+15c7 : a9 00 __ LDA #$00
+15c9 : 85 05 __ STA $05
+15cb : 85 06 __ STA $06
+15cd : a5 47 __ LDA T1 + 0
+15cf : 85 1b __ STA ACCU + 0
+15d1 : a5 48 __ LDA T1 + 1
+15d3 : 85 1c __ STA ACCU + 1
+15d5 : a5 49 __ LDA T1 + 2
+15d7 : 85 1d __ STA ACCU + 2
+15d9 : a5 4a __ LDA T1 + 3
+15db : 85 1e __ STA ACCU + 3
+15dd : 20 53 21 JSR $2153 ; (divmod32 + 0)
+15e0 : a5 08 __ LDA $08
+15e2 : 10 54 __ BPL $1638
+15e4 : 18 __ __ CLC
+15e5 : a5 07 __ LDA $07
+15e7 : 69 30 __ ADC #$30
+15e9 : c6 4e __ DEC T4 + 0
+15eb : a4 4e __ LDY T4 + 0
+15ed : 91 0f __ STA (P2),y
+15ef : a0 03 __ LDY #$03
+15f1 : b1 0d __ LDA (P0),y
+15f3 : 85 03 __ STA $03
+15f5 : c8 __ __ INY
+15f6 : b1 0d __ LDA (P0),y
+15f8 : 85 04 __ STA $04
+15fa : a9 00 __ LDA #$00
+15fc : 85 05 __ STA $05
+15fe : 85 06 __ STA $06
+1600 : a5 47 __ LDA T1 + 0
+1602 : 85 1b __ STA ACCU + 0
+1604 : a5 48 __ LDA T1 + 1
+1606 : 85 1c __ STA ACCU + 1
+1608 : a5 49 __ LDA T1 + 2
+160a : 85 1d __ STA ACCU + 2
+160c : a5 4a __ LDA T1 + 3
+160e : 85 1e __ STA ACCU + 3
+1610 : 20 53 21 JSR $2153 ; (divmod32 + 0)
+1613 : a5 1b __ LDA ACCU + 0
+1615 : 85 47 __ STA T1 + 0
+1617 : a5 1c __ LDA ACCU + 1
+1619 : 85 48 __ STA T1 + 1
+161b : a5 1d __ LDA ACCU + 2
+161d : 85 49 __ STA T1 + 2
+161f : a5 1e __ LDA ACCU + 3
+1621 : 85 4a __ STA T1 + 3
+1623 : a9 00 __ LDA #$00
+1625 : c5 1e __ CMP ACCU + 3
+1627 : d0 0a __ BNE $1633
+1629 : c5 1d __ CMP ACCU + 2
+162b : d0 06 __ BNE $1633
+162d : c5 1c __ CMP ACCU + 1
+162f : d0 02 __ BNE $1633
+1631 : c5 1b __ CMP ACCU + 0
+1633 : 90 87 __ BCC $15bc
+1635 : 4c bb 14 JMP $14bb ; (nforml + 75)
+1638 : d0 06 __ BNE $1640
+163a : a5 07 __ LDA $07
+163c : c9 0a __ CMP #$0a
+163e : 90 a4 __ BCC $15e4
+1640 : 18 __ __ CLC
+1641 : a5 07 __ LDA $07
+1643 : 69 37 __ ADC #$37
+1645 : 4c e9 15 JMP $15e9 ; (nforml + 377)
+1648 : a5 14 __ LDA P7
+164a : 49 80 __ EOR #$80
+164c : c9 80 __ CMP #$80
+164e : d0 0f __ BNE $165f
+1650 : a5 13 __ LDA P6
+1652 : c9 00 __ CMP #$00
+1654 : d0 09 __ BNE $165f
+1656 : a5 12 __ LDA P5
+1658 : c9 00 __ CMP #$00
+165a : d0 03 __ BNE $165f
+165c : 4c a2 14 JMP $14a2 ; (nforml + 50)
+165f : 90 03 __ BCC $1664
+1661 : 4c a2 14 JMP $14a2 ; (nforml + 50)
+1664 : a9 01 __ LDA #$01
+1666 : 85 4d __ STA T3 + 0
+1668 : a9 10 __ LDA #$10
+166a : 85 4e __ STA T4 + 0
+166c : 38 __ __ SEC
+166d : a9 00 __ LDA #$00
+166f : e5 11 __ SBC P4
+1671 : 85 47 __ STA T1 + 0
+1673 : a9 00 __ LDA #$00
+1675 : e5 12 __ SBC P5
+1677 : 85 48 __ STA T1 + 1
+1679 : a9 00 __ LDA #$00
+167b : e5 13 __ SBC P6
+167d : 85 49 __ STA T1 + 2
+167f : a9 00 __ LDA #$00
+1681 : e5 14 __ SBC P7
+1683 : 85 4a __ STA T1 + 3
+1685 : a9 00 __ LDA #$00
+1687 : c5 4a __ CMP T1 + 3
+1689 : d0 0a __ BNE $1695
+168b : c5 49 __ CMP T1 + 2
+168d : d0 06 __ BNE $1695
+168f : c5 48 __ CMP T1 + 1
+1691 : d0 02 __ BNE $1695
+1693 : c5 47 __ CMP T1 + 0
+1695 : b0 03 __ BCS $169a
+1697 : 4c bc 15 JMP $15bc ; (nforml + 332)
+169a : 4c bb 14 JMP $14bb ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+169d : 38 __ __ SEC
+169e : a5 23 __ LDA SP + 0
+16a0 : e9 0a __ SBC #$0a
+16a2 : 85 23 __ STA SP + 0
+16a4 : a5 24 __ LDA SP + 1
+16a6 : e9 00 __ SBC #$00
+16a8 : 85 24 __ STA SP + 1
+16aa : a0 03 __ LDY #$03
+16ac : b9 53 00 LDA $0053,y 
+16af : 91 23 __ STA (SP + 0),y
+16b1 : 88 __ __ DEY
+16b2 : 10 f8 __ BPL $16ac
+16b4 : a9 00 __ LDA #$00
+16b6 : 85 1b __ STA ACCU + 0
+16b8 : 85 1c __ STA ACCU + 1
+16ba : 85 1d __ STA ACCU + 2
+16bc : 85 1e __ STA ACCU + 3
+16be : a5 11 __ LDA P4
+16c0 : 85 03 __ STA $03
+16c2 : a5 12 __ LDA P5
+16c4 : 85 04 __ STA $04
+16c6 : a5 13 __ LDA P6
+16c8 : 85 05 __ STA $05
+16ca : a5 14 __ LDA P7
+16cc : 85 06 __ STA $06
+16ce : 20 02 21 JSR $2102 ; (fcmp + 0)
+16d1 : 10 03 __ BPL $16d6
+16d3 : 4c 05 1d JMP $1d05 ; (nformf + 1640)
+16d6 : a9 00 __ LDA #$00
+16d8 : 85 4b __ STA T3 + 0
+16da : a0 05 __ LDY #$05
+16dc : b1 0d __ LDA (P0),y
+16de : f0 0a __ BEQ $16ea
+16e0 : a9 2b __ LDA #$2b
+16e2 : a0 00 __ LDY #$00
+16e4 : 91 0f __ STA (P2),y
+16e6 : a9 01 __ LDA #$01
+16e8 : 85 4b __ STA T3 + 0
+16ea : a9 00 __ LDA #$00
+16ec : 85 43 __ STA T0 + 0
+16ee : 85 44 __ STA T0 + 1
+16f0 : a0 02 __ LDY #$02
+16f2 : b1 0d __ LDA (P0),y
+16f4 : 85 4e __ STA T5 + 0
+16f6 : c9 ff __ CMP #$ff
+16f8 : d0 04 __ BNE $16fe
+16fa : a9 06 __ LDA #$06
+16fc : 85 4e __ STA T5 + 0
+16fe : a9 00 __ LDA #$00
+1700 : 85 1b __ STA ACCU + 0
+1702 : 85 1c __ STA ACCU + 1
+1704 : 85 1d __ STA ACCU + 2
+1706 : 85 1e __ STA ACCU + 3
+1708 : a5 11 __ LDA P4
+170a : 85 03 __ STA $03
+170c : a5 12 __ LDA P5
+170e : 85 04 __ STA $04
+1710 : a5 13 __ LDA P6
+1712 : 85 05 __ STA $05
+1714 : a5 14 __ LDA P7
+1716 : 85 06 __ STA $06
+1718 : 20 02 21 JSR $2102 ; (fcmp + 0)
+171b : d0 03 __ BNE $1720
+171d : 4c a4 18 JMP $18a4 ; (nformf + 519)
+1720 : a9 00 __ LDA #$00
+1722 : 85 1b __ STA ACCU + 0
+1724 : 85 1c __ STA ACCU + 1
+1726 : a9 7a __ LDA #$7a
+1728 : 85 1d __ STA ACCU + 2
+172a : a9 44 __ LDA #$44
+172c : 85 1e __ STA ACCU + 3
+172e : a5 11 __ LDA P4
+1730 : 85 03 __ STA $03
+1732 : a5 12 __ LDA P5
+1734 : 85 04 __ STA $04
+1736 : a5 13 __ LDA P6
+1738 : 85 05 __ STA $05
+173a : a5 14 __ LDA P7
+173c : 85 06 __ STA $06
+173e : 20 02 21 JSR $2102 ; (fcmp + 0)
+1741 : 30 5a __ BMI $179d
+1743 : a5 11 __ LDA P4
+1745 : 85 1b __ STA ACCU + 0
+1747 : a5 12 __ LDA P5
+1749 : 85 1c __ STA ACCU + 1
+174b : a5 13 __ LDA P6
+174d : 85 1d __ STA ACCU + 2
+174f : a5 14 __ LDA P7
+1751 : 85 1e __ STA ACCU + 3
+1753 : a9 00 __ LDA #$00
+1755 : 85 03 __ STA $03
+1757 : 85 04 __ STA $04
+1759 : a9 7a __ LDA #$7a
+175b : 85 05 __ STA $05
+175d : a9 44 __ LDA #$44
+175f : 85 06 __ STA $06
+1761 : 20 78 1d JSR $1d78 ; (freg + 20)
+1764 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1767 : a5 1b __ LDA ACCU + 0
+1769 : 85 11 __ STA P4
+176b : 85 03 __ STA $03
+176d : a5 1c __ LDA ACCU + 1
+176f : 85 12 __ STA P5
+1771 : 85 04 __ STA $04
+1773 : a5 1d __ LDA ACCU + 2
+1775 : 85 13 __ STA P6
+1777 : 85 05 __ STA $05
+1779 : a5 1e __ LDA ACCU + 3
+177b : 85 14 __ STA P7
+177d : 85 06 __ STA $06
+177f : 18 __ __ CLC
+1780 : a5 43 __ LDA T0 + 0
+1782 : 69 03 __ ADC #$03
+1784 : 85 43 __ STA T0 + 0
+1786 : 90 02 __ BCC $178a
+1788 : e6 44 __ INC T0 + 1
+178a : a9 00 __ LDA #$00
+178c : 85 1b __ STA ACCU + 0
+178e : 85 1c __ STA ACCU + 1
+1790 : a9 7a __ LDA #$7a
+1792 : 85 1d __ STA ACCU + 2
+1794 : a9 44 __ LDA #$44
+1796 : 85 1e __ STA ACCU + 3
+1798 : 20 02 21 JSR $2102 ; (fcmp + 0)
+179b : 10 a6 __ BPL $1743
+179d : a9 00 __ LDA #$00
+179f : 85 1b __ STA ACCU + 0
+17a1 : 85 1c __ STA ACCU + 1
+17a3 : a9 80 __ LDA #$80
+17a5 : 85 1d __ STA ACCU + 2
+17a7 : a9 3f __ LDA #$3f
+17a9 : 85 1e __ STA ACCU + 3
+17ab : a5 11 __ LDA P4
+17ad : 85 03 __ STA $03
+17af : a5 12 __ LDA P5
+17b1 : 85 04 __ STA $04
+17b3 : a5 13 __ LDA P6
+17b5 : 85 05 __ STA $05
+17b7 : a5 14 __ LDA P7
+17b9 : 85 06 __ STA $06
+17bb : 20 02 21 JSR $2102 ; (fcmp + 0)
+17be : 10 5c __ BPL $181c
+17c0 : a5 11 __ LDA P4
+17c2 : 85 1b __ STA ACCU + 0
+17c4 : a5 12 __ LDA P5
+17c6 : 85 1c __ STA ACCU + 1
+17c8 : a5 13 __ LDA P6
+17ca : 85 1d __ STA ACCU + 2
+17cc : a5 14 __ LDA P7
+17ce : 85 1e __ STA ACCU + 3
+17d0 : a9 00 __ LDA #$00
+17d2 : 85 03 __ STA $03
+17d4 : 85 04 __ STA $04
+17d6 : a9 7a __ LDA #$7a
+17d8 : 85 05 __ STA $05
+17da : a9 44 __ LDA #$44
+17dc : 85 06 __ STA $06
+17de : 20 78 1d JSR $1d78 ; (freg + 20)
+17e1 : 20 71 1e JSR $1e71 ; (fmul + 0)
+17e4 : a5 1b __ LDA ACCU + 0
+17e6 : 85 11 __ STA P4
+17e8 : 85 03 __ STA $03
+17ea : a5 1c __ LDA ACCU + 1
+17ec : 85 12 __ STA P5
+17ee : 85 04 __ STA $04
+17f0 : a5 1d __ LDA ACCU + 2
+17f2 : 85 13 __ STA P6
+17f4 : 85 05 __ STA $05
+17f6 : a5 1e __ LDA ACCU + 3
+17f8 : 85 14 __ STA P7
+17fa : 85 06 __ STA $06
+17fc : 38 __ __ SEC
+17fd : a5 43 __ LDA T0 + 0
+17ff : e9 03 __ SBC #$03
+1801 : 85 43 __ STA T0 + 0
+1803 : a5 44 __ LDA T0 + 1
+1805 : e9 00 __ SBC #$00
+1807 : 85 44 __ STA T0 + 1
+1809 : a9 00 __ LDA #$00
+180b : 85 1b __ STA ACCU + 0
+180d : 85 1c __ STA ACCU + 1
+180f : a9 80 __ LDA #$80
+1811 : 85 1d __ STA ACCU + 2
+1813 : a9 3f __ LDA #$3f
+1815 : 85 1e __ STA ACCU + 3
+1817 : 20 02 21 JSR $2102 ; (fcmp + 0)
+181a : 30 a4 __ BMI $17c0
+181c : a9 00 __ LDA #$00
+181e : 85 1b __ STA ACCU + 0
+1820 : 85 1c __ STA ACCU + 1
+1822 : a9 20 __ LDA #$20
+1824 : 85 1d __ STA ACCU + 2
+1826 : a9 41 __ LDA #$41
+1828 : 85 1e __ STA ACCU + 3
+182a : a5 11 __ LDA P4
+182c : 85 03 __ STA $03
+182e : a5 12 __ LDA P5
+1830 : 85 04 __ STA $04
+1832 : a5 13 __ LDA P6
+1834 : 85 05 __ STA $05
+1836 : a5 14 __ LDA P7
+1838 : 85 06 __ STA $06
+183a : 20 02 21 JSR $2102 ; (fcmp + 0)
+183d : 30 65 __ BMI $18a4
+183f : a5 11 __ LDA P4
+1841 : 85 1b __ STA ACCU + 0
+1843 : a5 12 __ LDA P5
+1845 : 85 1c __ STA ACCU + 1
+1847 : a5 13 __ LDA P6
+1849 : 85 1d __ STA ACCU + 2
+184b : a5 14 __ LDA P7
+184d : 85 1e __ STA ACCU + 3
+184f : a9 00 __ LDA #$00
+1851 : 85 03 __ STA $03
+1853 : 85 04 __ STA $04
+1855 : a9 20 __ LDA #$20
+1857 : 85 05 __ STA $05
+1859 : a9 41 __ LDA #$41
+185b : 85 06 __ STA $06
+185d : 20 78 1d JSR $1d78 ; (freg + 20)
+1860 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1863 : a5 1b __ LDA ACCU + 0
+1865 : 85 11 __ STA P4
+1867 : 85 47 __ STA T2 + 0
+1869 : a5 1c __ LDA ACCU + 1
+186b : 85 12 __ STA P5
+186d : 85 48 __ STA T2 + 1
+186f : a5 1d __ LDA ACCU + 2
+1871 : 85 13 __ STA P6
+1873 : 85 49 __ STA T2 + 2
+1875 : a5 1e __ LDA ACCU + 3
+1877 : 85 14 __ STA P7
+1879 : 85 4a __ STA T2 + 3
+187b : e6 43 __ INC T0 + 0
+187d : d0 02 __ BNE $1881
+187f : e6 44 __ INC T0 + 1
+1881 : a9 00 __ LDA #$00
+1883 : 85 1b __ STA ACCU + 0
+1885 : 85 1c __ STA ACCU + 1
+1887 : a9 20 __ LDA #$20
+1889 : 85 1d __ STA ACCU + 2
+188b : a9 41 __ LDA #$41
+188d : 85 1e __ STA ACCU + 3
+188f : a5 47 __ LDA T2 + 0
+1891 : 85 03 __ STA $03
+1893 : a5 48 __ LDA T2 + 1
+1895 : 85 04 __ STA $04
+1897 : a5 49 __ LDA T2 + 2
+1899 : 85 05 __ STA $05
+189b : a5 4a __ LDA T2 + 3
+189d : 85 06 __ STA $06
+189f : 20 02 21 JSR $2102 ; (fcmp + 0)
+18a2 : 10 9b __ BPL $183f
+18a4 : a5 15 __ LDA P8
+18a6 : c9 65 __ CMP #$65
+18a8 : d0 03 __ BNE $18ad
+18aa : 4c 00 1d JMP $1d00 ; (nformf + 1635)
+18ad : a9 00 __ LDA #$00
+18af : 85 51 __ STA T7 + 0
+18b1 : 85 52 __ STA T8 + 0
+18b3 : a5 4e __ LDA T5 + 0
+18b5 : 85 4c __ STA T4 + 0
+18b7 : e6 4c __ INC T4 + 0
+18b9 : a5 15 __ LDA P8
+18bb : c9 67 __ CMP #$67
+18bd : d0 03 __ BNE $18c2
+18bf : 4c e3 1c JMP $1ce3 ; (nformf + 1606)
+18c2 : a5 51 __ LDA T7 + 0
+18c4 : f0 03 __ BEQ $18c9
+18c6 : 4c f1 1b JMP $1bf1 ; (nformf + 1364)
+18c9 : a5 44 __ LDA T0 + 1
+18cb : 10 03 __ BPL $18d0
+18cd : 4c b0 1b JMP $1bb0 ; (nformf + 1299)
+18d0 : a9 00 __ LDA #$00
+18d2 : 85 47 __ STA T2 + 0
+18d4 : 85 48 __ STA T2 + 1
+18d6 : 85 49 __ STA T2 + 2
+18d8 : a9 3f __ LDA #$3f
+18da : 85 4a __ STA T2 + 3
+18dc : 18 __ __ CLC
+18dd : a5 4e __ LDA T5 + 0
+18df : 65 43 __ ADC T0 + 0
+18e1 : 85 4c __ STA T4 + 0
+18e3 : e6 4c __ INC T4 + 0
+18e5 : a9 01 __ LDA #$01
+18e7 : c5 4c __ CMP T4 + 0
+18e9 : b0 03 __ BCS $18ee
+18eb : 4c 6f 1b JMP $1b6f ; (nformf + 1234)
+18ee : a5 11 __ LDA P4
+18f0 : 85 1b __ STA ACCU + 0
+18f2 : a5 12 __ LDA P5
+18f4 : 85 1c __ STA ACCU + 1
+18f6 : a5 13 __ LDA P6
+18f8 : 85 1d __ STA ACCU + 2
+18fa : a5 14 __ LDA P7
+18fc : 85 1e __ STA ACCU + 3
+18fe : a5 47 __ LDA T2 + 0
+1900 : 85 03 __ STA $03
+1902 : a5 48 __ LDA T2 + 1
+1904 : 85 04 __ STA $04
+1906 : a5 49 __ LDA T2 + 2
+1908 : 85 05 __ STA $05
+190a : a5 4a __ LDA T2 + 3
+190c : 85 06 __ STA $06
+190e : 20 78 1d JSR $1d78 ; (freg + 20)
+1911 : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+1914 : a5 1b __ LDA ACCU + 0
+1916 : 85 11 __ STA P4
+1918 : 85 47 __ STA T2 + 0
+191a : 85 03 __ STA $03
+191c : a5 1c __ LDA ACCU + 1
+191e : 85 12 __ STA P5
+1920 : 85 48 __ STA T2 + 1
+1922 : 85 04 __ STA $04
+1924 : a5 1d __ LDA ACCU + 2
+1926 : 85 13 __ STA P6
+1928 : 85 49 __ STA T2 + 2
+192a : 85 05 __ STA $05
+192c : a5 1e __ LDA ACCU + 3
+192e : 85 14 __ STA P7
+1930 : 85 4a __ STA T2 + 3
+1932 : 85 06 __ STA $06
+1934 : a9 00 __ LDA #$00
+1936 : 85 1b __ STA ACCU + 0
+1938 : 85 1c __ STA ACCU + 1
+193a : a9 20 __ LDA #$20
+193c : 85 1d __ STA ACCU + 2
+193e : a9 41 __ LDA #$41
+1940 : 85 1e __ STA ACCU + 3
+1942 : 20 02 21 JSR $2102 ; (fcmp + 0)
+1945 : 30 36 __ BMI $197d
+1947 : a5 47 __ LDA T2 + 0
+1949 : 85 1b __ STA ACCU + 0
+194b : a5 48 __ LDA T2 + 1
+194d : 85 1c __ STA ACCU + 1
+194f : a5 49 __ LDA T2 + 2
+1951 : 85 1d __ STA ACCU + 2
+1953 : a5 4a __ LDA T2 + 3
+1955 : 85 1e __ STA ACCU + 3
+1957 : a9 00 __ LDA #$00
+1959 : 85 03 __ STA $03
+195b : 85 04 __ STA $04
+195d : a9 20 __ LDA #$20
+195f : 85 05 __ STA $05
+1961 : a9 41 __ LDA #$41
+1963 : 85 06 __ STA $06
+1965 : 20 78 1d JSR $1d78 ; (freg + 20)
+1968 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+196b : a5 1b __ LDA ACCU + 0
+196d : 85 11 __ STA P4
+196f : a5 1c __ LDA ACCU + 1
+1971 : 85 12 __ STA P5
+1973 : a5 1d __ LDA ACCU + 2
+1975 : 85 13 __ STA P6
+1977 : a5 1e __ LDA ACCU + 3
+1979 : 85 14 __ STA P7
+197b : c6 4e __ DEC T5 + 0
+197d : 38 __ __ SEC
+197e : a5 4c __ LDA T4 + 0
+1980 : e5 4e __ SBC T5 + 0
+1982 : 85 53 __ STA T10 + 0
+1984 : 85 4e __ STA T5 + 0
+1986 : a9 14 __ LDA #$14
+1988 : c5 4c __ CMP T4 + 0
+198a : b0 02 __ BCS $198e
+198c : 85 4c __ STA T4 + 0
+198e : a5 53 __ LDA T10 + 0
+1990 : d0 08 __ BNE $199a
+1992 : a9 30 __ LDA #$30
+1994 : a4 4b __ LDY T3 + 0
+1996 : 91 0f __ STA (P2),y
+1998 : e6 4b __ INC T3 + 0
+199a : a9 00 __ LDA #$00
+199c : 85 50 __ STA T6 + 0
+199e : a5 4c __ LDA T4 + 0
+19a0 : f0 03 __ BEQ $19a5
+19a2 : 4c de 1a JMP $1ade ; (nformf + 1089)
+19a5 : a5 52 __ LDA T8 + 0
+19a7 : f0 03 __ BEQ $19ac
+19a9 : 4c 5e 1a JMP $1a5e ; (nformf + 961)
+19ac : a5 4b __ LDA T3 + 0
+19ae : a0 01 __ LDY #$01
+19b0 : d1 0d __ CMP (P0),y
+19b2 : 90 1e __ BCC $19d2
+19b4 : 85 1b __ STA ACCU + 0
+19b6 : a9 00 __ LDA #$00
+19b8 : 85 1c __ STA ACCU + 1
+19ba : a0 03 __ LDY #$03
+19bc : b1 23 __ LDA (SP + 0),y
+19be : 99 53 00 STA $0053,y 
+19c1 : 88 __ __ DEY
+19c2 : 10 f8 __ BPL $19bc
+19c4 : 18 __ __ CLC
+19c5 : a5 23 __ LDA SP + 0
+19c7 : 69 0a __ ADC #$0a
+19c9 : 85 23 __ STA SP + 0
+19cb : a5 24 __ LDA SP + 1
+19cd : 69 00 __ ADC #$00
+19cf : 85 24 __ STA SP + 1
+19d1 : 60 __ __ RTS
+19d2 : c9 01 __ CMP #$01
+19d4 : 90 53 __ BCC $1a29
+19d6 : a9 01 __ LDA #$01
+19d8 : 85 4e __ STA T5 + 0
+19da : a5 0d __ LDA P0
+19dc : 85 43 __ STA T0 + 0
+19de : a5 0e __ LDA P1
+19e0 : 85 44 __ STA T0 + 1
+19e2 : a5 4b __ LDA T3 + 0
+19e4 : 85 4c __ STA T4 + 0
+19e6 : 38 __ __ SEC
+19e7 : a5 4c __ LDA T4 + 0
+19e9 : e5 4e __ SBC T5 + 0
+19eb : 85 55 __ STA T11 + 0
+19ed : a9 00 __ LDA #$00
+19ef : e9 00 __ SBC #$00
+19f1 : 85 56 __ STA T11 + 1
+19f3 : 18 __ __ CLC
+19f4 : a5 0f __ LDA P2
+19f6 : 65 55 __ ADC T11 + 0
+19f8 : 85 55 __ STA T11 + 0
+19fa : a5 10 __ LDA P3
+19fc : 65 56 __ ADC T11 + 1
+19fe : 85 56 __ STA T11 + 1
+1a00 : a0 01 __ LDY #$01
+1a02 : b1 43 __ LDA (T0 + 0),y
+1a04 : 38 __ __ SEC
+1a05 : e5 4e __ SBC T5 + 0
+1a07 : 85 53 __ STA T10 + 0
+1a09 : a9 00 __ LDA #$00
+1a0b : e9 00 __ SBC #$00
+1a0d : 85 54 __ STA T10 + 1
+1a0f : 18 __ __ CLC
+1a10 : a5 0f __ LDA P2
+1a12 : 65 53 __ ADC T10 + 0
+1a14 : 85 53 __ STA T10 + 0
+1a16 : a5 10 __ LDA P3
+1a18 : 65 54 __ ADC T10 + 1
+1a1a : 85 54 __ STA T10 + 1
+1a1c : 88 __ __ DEY
+1a1d : b1 55 __ LDA (T11 + 0),y
+1a1f : 91 53 __ STA (T10 + 0),y
+1a21 : e6 4e __ INC T5 + 0
+1a23 : a5 4b __ LDA T3 + 0
+1a25 : c5 4e __ CMP T5 + 0
+1a27 : b0 bd __ BCS $19e6
+1a29 : a9 00 __ LDA #$00
+1a2b : 85 4e __ STA T5 + 0
+1a2d : a5 4b __ LDA T3 + 0
+1a2f : 85 43 __ STA T0 + 0
+1a31 : a0 01 __ LDY #$01
+1a33 : b1 0d __ LDA (P0),y
+1a35 : 85 4b __ STA T3 + 0
+1a37 : 38 __ __ SEC
+1a38 : e5 43 __ SBC T0 + 0
+1a3a : 85 53 __ STA T10 + 0
+1a3c : a9 00 __ LDA #$00
+1a3e : e9 00 __ SBC #$00
+1a40 : 85 54 __ STA T10 + 1
+1a42 : a9 00 __ LDA #$00
+1a44 : c5 54 __ CMP T10 + 1
+1a46 : d0 04 __ BNE $1a4c
+1a48 : a5 4e __ LDA T5 + 0
+1a4a : c5 53 __ CMP T10 + 0
+1a4c : 90 05 __ BCC $1a53
+1a4e : a5 4b __ LDA T3 + 0
+1a50 : 4c b4 19 JMP $19b4 ; (nformf + 791)
+1a53 : a9 20 __ LDA #$20
+1a55 : a4 4e __ LDY T5 + 0
+1a57 : 91 0f __ STA (P2),y
+1a59 : e6 4e __ INC T5 + 0
+1a5b : 4c 31 1a JMP $1a31 ; (nformf + 916)
+1a5e : a9 45 __ LDA #$45
+1a60 : a4 4b __ LDY T3 + 0
+1a62 : 91 0f __ STA (P2),y
+1a64 : c8 __ __ INY
+1a65 : a5 44 __ LDA T0 + 1
+1a67 : 30 5a __ BMI $1ac3
+1a69 : a9 2b __ LDA #$2b
+1a6b : 91 0f __ STA (P2),y
+1a6d : 18 __ __ CLC
+1a6e : a5 4b __ LDA T3 + 0
+1a70 : 69 02 __ ADC #$02
+1a72 : 85 4b __ STA T3 + 0
+1a74 : a5 43 __ LDA T0 + 0
+1a76 : 85 1b __ STA ACCU + 0
+1a78 : a5 44 __ LDA T0 + 1
+1a7a : 85 1c __ STA ACCU + 1
+1a7c : a9 0a __ LDA #$0a
+1a7e : 85 03 __ STA $03
+1a80 : a9 00 __ LDA #$00
+1a82 : 85 04 __ STA $04
+1a84 : 20 8d 1f JSR $1f8d ; (divs16 + 0)
+1a87 : 18 __ __ CLC
+1a88 : a5 1b __ LDA ACCU + 0
+1a8a : 69 30 __ ADC #$30
+1a8c : a4 4b __ LDY T3 + 0
+1a8e : 91 0f __ STA (P2),y
+1a90 : c8 __ __ INY
+1a91 : 98 __ __ TYA
+1a92 : 18 __ __ CLC
+1a93 : 65 0f __ ADC P2
+1a95 : 85 4c __ STA T4 + 0
+1a97 : a5 10 __ LDA P3
+1a99 : 69 00 __ ADC #$00
+1a9b : 85 4d __ STA T4 + 1
+1a9d : a5 43 __ LDA T0 + 0
+1a9f : 85 1b __ STA ACCU + 0
+1aa1 : a5 44 __ LDA T0 + 1
+1aa3 : 85 1c __ STA ACCU + 1
+1aa5 : a9 0a __ LDA #$0a
+1aa7 : 85 03 __ STA $03
+1aa9 : a9 00 __ LDA #$00
+1aab : 85 04 __ STA $04
+1aad : 20 4c 20 JSR $204c ; (mods16 + 0)
+1ab0 : 18 __ __ CLC
+1ab1 : a5 05 __ LDA $05
+1ab3 : 69 30 __ ADC #$30
+1ab5 : a0 00 __ LDY #$00
+1ab7 : 91 4c __ STA (T4 + 0),y
+1ab9 : 18 __ __ CLC
+1aba : a5 4b __ LDA T3 + 0
+1abc : 69 02 __ ADC #$02
+1abe : 85 4b __ STA T3 + 0
+1ac0 : 4c ac 19 JMP $19ac ; (nformf + 783)
+1ac3 : a9 2d __ LDA #$2d
+1ac5 : 91 0f __ STA (P2),y
+1ac7 : 18 __ __ CLC
+1ac8 : a5 4b __ LDA T3 + 0
+1aca : 69 02 __ ADC #$02
+1acc : 85 4b __ STA T3 + 0
+1ace : 38 __ __ SEC
+1acf : a9 00 __ LDA #$00
+1ad1 : e5 43 __ SBC T0 + 0
+1ad3 : 85 43 __ STA T0 + 0
+1ad5 : a9 00 __ LDA #$00
+1ad7 : e5 44 __ SBC T0 + 1
+1ad9 : 85 44 __ STA T0 + 1
+1adb : 4c 74 1a JMP $1a74 ; (nformf + 983)
+1ade : a5 50 __ LDA T6 + 0
+1ae0 : c5 4e __ CMP T5 + 0
+1ae2 : d0 08 __ BNE $1aec
+1ae4 : a9 2e __ LDA #$2e
+1ae6 : a4 4b __ LDY T3 + 0
+1ae8 : 91 0f __ STA (P2),y
+1aea : e6 4b __ INC T3 + 0
+1aec : a5 11 __ LDA P4
+1aee : 85 1b __ STA ACCU + 0
+1af0 : a5 12 __ LDA P5
+1af2 : 85 1c __ STA ACCU + 1
+1af4 : a5 13 __ LDA P6
+1af6 : 85 1d __ STA ACCU + 2
+1af8 : a5 14 __ LDA P7
+1afa : 85 1e __ STA ACCU + 3
+1afc : 20 75 20 JSR $2075 ; (f32_to_i16 + 0)
+1aff : a5 1b __ LDA ACCU + 0
+1b01 : 85 53 __ STA T10 + 0
+1b03 : 20 b7 20 JSR $20b7 ; (sint16_to_float + 0)
+1b06 : a5 1b __ LDA ACCU + 0
+1b08 : 85 03 __ STA $03
+1b0a : a5 1c __ LDA ACCU + 1
+1b0c : 85 04 __ STA $04
+1b0e : a5 1d __ LDA ACCU + 2
+1b10 : 85 05 __ STA $05
+1b12 : a5 1e __ LDA ACCU + 3
+1b14 : 85 06 __ STA $06
+1b16 : a5 11 __ LDA P4
+1b18 : 85 1b __ STA ACCU + 0
+1b1a : a5 12 __ LDA P5
+1b1c : 85 1c __ STA ACCU + 1
+1b1e : a5 13 __ LDA P6
+1b20 : 85 1d __ STA ACCU + 2
+1b22 : a5 14 __ LDA P7
+1b24 : 85 1e __ STA ACCU + 3
+1b26 : 20 78 1d JSR $1d78 ; (freg + 20)
+1b29 : a5 06 __ LDA $06
+1b2b : 49 80 __ EOR #$80
+1b2d : 85 06 __ STA $06
+1b2f : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+1b32 : a9 00 __ LDA #$00
+1b34 : 85 03 __ STA $03
+1b36 : 85 04 __ STA $04
+1b38 : a9 20 __ LDA #$20
+1b3a : 85 05 __ STA $05
+1b3c : a9 41 __ LDA #$41
+1b3e : 85 06 __ STA $06
+1b40 : 20 78 1d JSR $1d78 ; (freg + 20)
+1b43 : 20 71 1e JSR $1e71 ; (fmul + 0)
+1b46 : a5 1b __ LDA ACCU + 0
+1b48 : 85 11 __ STA P4
+1b4a : a5 1c __ LDA ACCU + 1
+1b4c : 85 12 __ STA P5
+1b4e : a5 1d __ LDA ACCU + 2
+1b50 : 85 13 __ STA P6
+1b52 : a5 1e __ LDA ACCU + 3
+1b54 : 85 14 __ STA P7
+1b56 : 18 __ __ CLC
+1b57 : a5 53 __ LDA T10 + 0
+1b59 : 69 30 __ ADC #$30
+1b5b : a4 4b __ LDY T3 + 0
+1b5d : 91 0f __ STA (P2),y
+1b5f : e6 4b __ INC T3 + 0
+1b61 : e6 50 __ INC T6 + 0
+1b63 : a5 50 __ LDA T6 + 0
+1b65 : c5 4c __ CMP T4 + 0
+1b67 : b0 03 __ BCS $1b6c
+1b69 : 4c de 1a JMP $1ade ; (nformf + 1089)
+1b6c : 4c a5 19 JMP $19a5 ; (nformf + 776)
+1b6f : 85 50 __ STA T6 + 0
+1b71 : a5 47 __ LDA T2 + 0
+1b73 : 85 1b __ STA ACCU + 0
+1b75 : a5 48 __ LDA T2 + 1
+1b77 : 85 1c __ STA ACCU + 1
+1b79 : a5 49 __ LDA T2 + 2
+1b7b : 85 1d __ STA ACCU + 2
+1b7d : a5 4a __ LDA T2 + 3
+1b7f : 85 1e __ STA ACCU + 3
+1b81 : a9 00 __ LDA #$00
+1b83 : 85 03 __ STA $03
+1b85 : 85 04 __ STA $04
+1b87 : a9 20 __ LDA #$20
+1b89 : 85 05 __ STA $05
+1b8b : a9 41 __ LDA #$41
+1b8d : 85 06 __ STA $06
+1b8f : 20 78 1d JSR $1d78 ; (freg + 20)
+1b92 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1b95 : a5 1b __ LDA ACCU + 0
+1b97 : 85 47 __ STA T2 + 0
+1b99 : a5 1c __ LDA ACCU + 1
+1b9b : 85 48 __ STA T2 + 1
+1b9d : a5 1d __ LDA ACCU + 2
+1b9f : 85 49 __ STA T2 + 2
+1ba1 : a5 1e __ LDA ACCU + 3
+1ba3 : 85 4a __ STA T2 + 3
+1ba5 : e6 50 __ INC T6 + 0
+1ba7 : a5 50 __ LDA T6 + 0
+1ba9 : c5 4c __ CMP T4 + 0
+1bab : 90 c4 __ BCC $1b71
+1bad : 4c ee 18 JMP $18ee ; (nformf + 593)
+1bb0 : a5 11 __ LDA P4
+1bb2 : 85 1b __ STA ACCU + 0
+1bb4 : a5 12 __ LDA P5
+1bb6 : 85 1c __ STA ACCU + 1
+1bb8 : a5 13 __ LDA P6
+1bba : 85 1d __ STA ACCU + 2
+1bbc : a5 14 __ LDA P7
+1bbe : 85 1e __ STA ACCU + 3
+1bc0 : a9 00 __ LDA #$00
+1bc2 : 85 03 __ STA $03
+1bc4 : 85 04 __ STA $04
+1bc6 : a9 20 __ LDA #$20
+1bc8 : 85 05 __ STA $05
+1bca : a9 41 __ LDA #$41
+1bcc : 85 06 __ STA $06
+1bce : 20 78 1d JSR $1d78 ; (freg + 20)
+1bd1 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1bd4 : a5 1b __ LDA ACCU + 0
+1bd6 : 85 11 __ STA P4
+1bd8 : a5 1c __ LDA ACCU + 1
+1bda : 85 12 __ STA P5
+1bdc : a5 1d __ LDA ACCU + 2
+1bde : 85 13 __ STA P6
+1be0 : a5 1e __ LDA ACCU + 3
+1be2 : 85 14 __ STA P7
+1be4 : e6 43 __ INC T0 + 0
+1be6 : d0 02 __ BNE $1bea
+1be8 : e6 44 __ INC T0 + 1
+1bea : a5 44 __ LDA T0 + 1
+1bec : 30 c2 __ BMI $1bb0
+1bee : 4c d0 18 JMP $18d0 ; (nformf + 563)
+1bf1 : a9 00 __ LDA #$00
+1bf3 : 85 47 __ STA T2 + 0
+1bf5 : 85 48 __ STA T2 + 1
+1bf7 : 85 49 __ STA T2 + 2
+1bf9 : a9 3f __ LDA #$3f
+1bfb : 85 4a __ STA T2 + 3
+1bfd : a5 4e __ LDA T5 + 0
+1bff : f0 03 __ BEQ $1c04
+1c01 : 4c a0 1c JMP $1ca0 ; (nformf + 1539)
+1c04 : a5 11 __ LDA P4
+1c06 : 85 1b __ STA ACCU + 0
+1c08 : a5 12 __ LDA P5
+1c0a : 85 1c __ STA ACCU + 1
+1c0c : a5 13 __ LDA P6
+1c0e : 85 1d __ STA ACCU + 2
+1c10 : a5 14 __ LDA P7
+1c12 : 85 1e __ STA ACCU + 3
+1c14 : a5 47 __ LDA T2 + 0
+1c16 : 85 03 __ STA $03
+1c18 : a5 48 __ LDA T2 + 1
+1c1a : 85 04 __ STA $04
+1c1c : a5 49 __ LDA T2 + 2
+1c1e : 85 05 __ STA $05
+1c20 : a5 4a __ LDA T2 + 3
+1c22 : 85 06 __ STA $06
+1c24 : 20 78 1d JSR $1d78 ; (freg + 20)
+1c27 : 20 a9 1d JSR $1da9 ; (faddsub + 0)
+1c2a : a5 1b __ LDA ACCU + 0
+1c2c : 85 11 __ STA P4
+1c2e : 85 47 __ STA T2 + 0
+1c30 : 85 03 __ STA $03
+1c32 : a5 1c __ LDA ACCU + 1
+1c34 : 85 12 __ STA P5
+1c36 : 85 48 __ STA T2 + 1
+1c38 : 85 04 __ STA $04
+1c3a : a5 1d __ LDA ACCU + 2
+1c3c : 85 13 __ STA P6
+1c3e : 85 49 __ STA T2 + 2
+1c40 : 85 05 __ STA $05
+1c42 : a5 1e __ LDA ACCU + 3
+1c44 : 85 14 __ STA P7
+1c46 : 85 4a __ STA T2 + 3
+1c48 : 85 06 __ STA $06
+1c4a : a9 00 __ LDA #$00
+1c4c : 85 1b __ STA ACCU + 0
+1c4e : 85 1c __ STA ACCU + 1
+1c50 : a9 20 __ LDA #$20
+1c52 : 85 1d __ STA ACCU + 2
+1c54 : a9 41 __ LDA #$41
+1c56 : 85 1e __ STA ACCU + 3
+1c58 : 20 02 21 JSR $2102 ; (fcmp + 0)
+1c5b : 10 03 __ BPL $1c60
+1c5d : 4c 7d 19 JMP $197d ; (nformf + 736)
+1c60 : a5 47 __ LDA T2 + 0
+1c62 : 85 1b __ STA ACCU + 0
+1c64 : a5 48 __ LDA T2 + 1
+1c66 : 85 1c __ STA ACCU + 1
+1c68 : a5 49 __ LDA T2 + 2
+1c6a : 85 1d __ STA ACCU + 2
+1c6c : a5 4a __ LDA T2 + 3
+1c6e : 85 1e __ STA ACCU + 3
+1c70 : a9 00 __ LDA #$00
+1c72 : 85 03 __ STA $03
+1c74 : 85 04 __ STA $04
+1c76 : a9 20 __ LDA #$20
+1c78 : 85 05 __ STA $05
+1c7a : a9 41 __ LDA #$41
+1c7c : 85 06 __ STA $06
+1c7e : 20 78 1d JSR $1d78 ; (freg + 20)
+1c81 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1c84 : a5 1b __ LDA ACCU + 0
+1c86 : 85 11 __ STA P4
+1c88 : a5 1c __ LDA ACCU + 1
+1c8a : 85 12 __ STA P5
+1c8c : a5 1d __ LDA ACCU + 2
+1c8e : 85 13 __ STA P6
+1c90 : a5 1e __ LDA ACCU + 3
+1c92 : 85 14 __ STA P7
+1c94 : e6 43 __ INC T0 + 0
+1c96 : f0 03 __ BEQ $1c9b
+1c98 : 4c 7d 19 JMP $197d ; (nformf + 736)
+1c9b : e6 44 __ INC T0 + 1
+1c9d : 4c 7d 19 JMP $197d ; (nformf + 736)
+1ca0 : a9 00 __ LDA #$00
+1ca2 : 85 50 __ STA T6 + 0
+1ca4 : a5 47 __ LDA T2 + 0
+1ca6 : 85 1b __ STA ACCU + 0
+1ca8 : a5 48 __ LDA T2 + 1
+1caa : 85 1c __ STA ACCU + 1
+1cac : a5 49 __ LDA T2 + 2
+1cae : 85 1d __ STA ACCU + 2
+1cb0 : a5 4a __ LDA T2 + 3
+1cb2 : 85 1e __ STA ACCU + 3
+1cb4 : a9 00 __ LDA #$00
+1cb6 : 85 03 __ STA $03
+1cb8 : 85 04 __ STA $04
+1cba : a9 20 __ LDA #$20
+1cbc : 85 05 __ STA $05
+1cbe : a9 41 __ LDA #$41
+1cc0 : 85 06 __ STA $06
+1cc2 : 20 78 1d JSR $1d78 ; (freg + 20)
+1cc5 : 20 0f 1f JSR $1f0f ; (fdiv + 0)
+1cc8 : a5 1b __ LDA ACCU + 0
+1cca : 85 47 __ STA T2 + 0
+1ccc : a5 1c __ LDA ACCU + 1
+1cce : 85 48 __ STA T2 + 1
+1cd0 : a5 1d __ LDA ACCU + 2
+1cd2 : 85 49 __ STA T2 + 2
+1cd4 : a5 1e __ LDA ACCU + 3
+1cd6 : 85 4a __ STA T2 + 3
+1cd8 : e6 50 __ INC T6 + 0
+1cda : a5 50 __ LDA T6 + 0
+1cdc : c5 4e __ CMP T5 + 0
+1cde : 90 c4 __ BCC $1ca4
+1ce0 : 4c 04 1c JMP $1c04 ; (nformf + 1383)
+1ce3 : a5 44 __ LDA T0 + 1
+1ce5 : 10 0e __ BPL $1cf5
+1ce7 : a5 44 __ LDA T0 + 1
+1ce9 : 30 03 __ BMI $1cee
+1ceb : 4c c2 18 JMP $18c2 ; (nformf + 549)
+1cee : a9 01 __ LDA #$01
+1cf0 : 85 52 __ STA T8 + 0
+1cf2 : 4c f1 1b JMP $1bf1 ; (nformf + 1364)
+1cf5 : d0 f7 __ BNE $1cee
+1cf7 : a9 03 __ LDA #$03
+1cf9 : c5 43 __ CMP T0 + 0
+1cfb : 90 f1 __ BCC $1cee
+1cfd : 4c e7 1c JMP $1ce7 ; (nformf + 1610)
+1d00 : a9 01 __ LDA #$01
+1d02 : 4c af 18 JMP $18af ; (nformf + 530)
+1d05 : a5 14 __ LDA P7
+1d07 : 49 80 __ EOR #$80
+1d09 : 85 14 __ STA P7
+1d0b : a9 2d __ LDA #$2d
+1d0d : a0 00 __ LDY #$00
+1d0f : 91 0f __ STA (P2),y
+1d11 : a9 01 __ LDA #$01
+1d13 : 85 4b __ STA T3 + 0
+1d15 : 4c ea 16 JMP $16ea ; (nformf + 77)
+--------------------------------------------------------------------
+assert:
+1d25 : a0 02 __ LDY #$02
+1d27 : b1 23 __ LDA (SP + 0),y
+1d29 : d0 09 __ BNE $1d34
+1d2b : a9 ff __ LDA #$ff
+1d2d : 85 0d __ STA P0
+1d2f : 85 0e __ STA P1
+1d31 : 20 35 1d JSR $1d35 ; (exit + 0)
+1d34 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1d35 : a5 0d __ LDA P0
+1d37 : 85 1b __ STA ACCU + 0
+1d39 : a5 0e __ LDA P1
+1d3b : 85 1c __ STA ACCU + 1
+1d3d : ae aa 21 LDX $21aa ; (spentry + 0)
+1d40 : 9a __ __ TXS
+1d41 : a9 4c __ LDA #$4c
+1d43 : 85 54 __ STA $54
+1d45 : a9 00 __ LDA #$00
+1d47 : 85 13 __ STA P6
+1d49 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1d57 : a9 4c __ LDA #$4c
+1d59 : 85 54 __ STA $54
+1d5b : a9 00 __ LDA #$00
+1d5d : 85 13 __ STA P6
+1d5f : a9 19 __ LDA #$19
+1d61 : 85 16 __ STA P9
+1d63 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1d64 : b1 19 __ LDA (IP + 0),y
+1d66 : c8 __ __ INY
+1d67 : aa __ __ TAX
+1d68 : b5 00 __ LDA $00,x
+1d6a : 85 03 __ STA $03
+1d6c : b5 01 __ LDA $01,x
+1d6e : 85 04 __ STA $04
+1d70 : b5 02 __ LDA $02,x
+1d72 : 85 05 __ STA $05
+1d74 : b5 03 __ LDA $03,x
+1d76 : 85 06 __ STA $06
+1d78 : a5 05 __ LDA $05
+1d7a : 0a __ __ ASL
+1d7b : a5 06 __ LDA $06
+1d7d : 2a __ __ ROL
+1d7e : 85 08 __ STA $08
+1d80 : f0 06 __ BEQ $1d88
+1d82 : a5 05 __ LDA $05
+1d84 : 09 80 __ ORA #$80
+1d86 : 85 05 __ STA $05
+1d88 : a5 1d __ LDA ACCU + 2
+1d8a : 0a __ __ ASL
+1d8b : a5 1e __ LDA ACCU + 3
+1d8d : 2a __ __ ROL
+1d8e : 85 07 __ STA $07
+1d90 : f0 06 __ BEQ $1d98
+1d92 : a5 1d __ LDA ACCU + 2
+1d94 : 09 80 __ ORA #$80
+1d96 : 85 1d __ STA ACCU + 2
+1d98 : 60 __ __ RTS
+1d99 : 06 1e __ ASL ACCU + 3
+1d9b : a5 07 __ LDA $07
+1d9d : 6a __ __ ROR
+1d9e : 85 1e __ STA ACCU + 3
+1da0 : b0 06 __ BCS $1da8
+1da2 : a5 1d __ LDA ACCU + 2
+1da4 : 29 7f __ AND #$7f
+1da6 : 85 1d __ STA ACCU + 2
+1da8 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1da9 : 38 __ __ SEC
+1daa : a5 07 __ LDA $07
+1dac : e5 08 __ SBC $08
+1dae : f0 38 __ BEQ $1de8
+1db0 : aa __ __ TAX
+1db1 : b0 25 __ BCS $1dd8
+1db3 : e0 e9 __ CPX #$e9
+1db5 : b0 0e __ BCS $1dc5
+1db7 : a5 08 __ LDA $08
+1db9 : 85 07 __ STA $07
+1dbb : a9 00 __ LDA #$00
+1dbd : 85 1b __ STA ACCU + 0
+1dbf : 85 1c __ STA ACCU + 1
+1dc1 : 85 1d __ STA ACCU + 2
+1dc3 : f0 23 __ BEQ $1de8
+1dc5 : a5 1d __ LDA ACCU + 2
+1dc7 : 4a __ __ LSR
+1dc8 : 66 1c __ ROR ACCU + 1
+1dca : 66 1b __ ROR ACCU + 0
+1dcc : e8 __ __ INX
+1dcd : d0 f8 __ BNE $1dc7
+1dcf : 85 1d __ STA ACCU + 2
+1dd1 : a5 08 __ LDA $08
+1dd3 : 85 07 __ STA $07
+1dd5 : 4c e8 1d JMP $1de8 ; (faddsub + 63)
+1dd8 : e0 18 __ CPX #$18
+1dda : b0 33 __ BCS $1e0f
+1ddc : a5 05 __ LDA $05
+1dde : 4a __ __ LSR
+1ddf : 66 04 __ ROR $04
+1de1 : 66 03 __ ROR $03
+1de3 : ca __ __ DEX
+1de4 : d0 f8 __ BNE $1dde
+1de6 : 85 05 __ STA $05
+1de8 : a5 1e __ LDA ACCU + 3
+1dea : 29 80 __ AND #$80
+1dec : 85 1e __ STA ACCU + 3
+1dee : 45 06 __ EOR $06
+1df0 : 30 2d __ BMI $1e1f
+1df2 : 18 __ __ CLC
+1df3 : a5 1b __ LDA ACCU + 0
+1df5 : 65 03 __ ADC $03
+1df7 : 85 1b __ STA ACCU + 0
+1df9 : a5 1c __ LDA ACCU + 1
+1dfb : 65 04 __ ADC $04
+1dfd : 85 1c __ STA ACCU + 1
+1dff : a5 1d __ LDA ACCU + 2
+1e01 : 65 05 __ ADC $05
+1e03 : 85 1d __ STA ACCU + 2
+1e05 : 90 08 __ BCC $1e0f
+1e07 : 66 1d __ ROR ACCU + 2
+1e09 : 66 1c __ ROR ACCU + 1
+1e0b : 66 1b __ ROR ACCU + 0
+1e0d : e6 07 __ INC $07
+1e0f : a5 07 __ LDA $07
+1e11 : 4a __ __ LSR
+1e12 : 05 1e __ ORA ACCU + 3
+1e14 : 85 1e __ STA ACCU + 3
+1e16 : b0 06 __ BCS $1e1e
+1e18 : a5 1d __ LDA ACCU + 2
+1e1a : 29 7f __ AND #$7f
+1e1c : 85 1d __ STA ACCU + 2
+1e1e : 60 __ __ RTS
+1e1f : 38 __ __ SEC
+1e20 : a5 1b __ LDA ACCU + 0
+1e22 : e5 03 __ SBC $03
+1e24 : 85 1b __ STA ACCU + 0
+1e26 : a5 1c __ LDA ACCU + 1
+1e28 : e5 04 __ SBC $04
+1e2a : 85 1c __ STA ACCU + 1
+1e2c : a5 1d __ LDA ACCU + 2
+1e2e : e5 05 __ SBC $05
+1e30 : 85 1d __ STA ACCU + 2
+1e32 : b0 19 __ BCS $1e4d
+1e34 : 38 __ __ SEC
+1e35 : a9 00 __ LDA #$00
+1e37 : e5 1b __ SBC ACCU + 0
+1e39 : 85 1b __ STA ACCU + 0
+1e3b : a9 00 __ LDA #$00
+1e3d : e5 1c __ SBC ACCU + 1
+1e3f : 85 1c __ STA ACCU + 1
+1e41 : a9 00 __ LDA #$00
+1e43 : e5 1d __ SBC ACCU + 2
+1e45 : 85 1d __ STA ACCU + 2
+1e47 : a5 1e __ LDA ACCU + 3
+1e49 : 49 80 __ EOR #$80
+1e4b : 85 1e __ STA ACCU + 3
+1e4d : a5 1d __ LDA ACCU + 2
+1e4f : 30 be __ BMI $1e0f
+1e51 : 05 1c __ ORA ACCU + 1
+1e53 : 05 1b __ ORA ACCU + 0
+1e55 : f0 0f __ BEQ $1e66
+1e57 : c6 07 __ DEC $07
+1e59 : f0 0b __ BEQ $1e66
+1e5b : 06 1b __ ASL ACCU + 0
+1e5d : 26 1c __ ROL ACCU + 1
+1e5f : 26 1d __ ROL ACCU + 2
+1e61 : 10 f4 __ BPL $1e57
+1e63 : 4c 0f 1e JMP $1e0f ; (faddsub + 102)
+1e66 : a9 00 __ LDA #$00
+1e68 : 85 1b __ STA ACCU + 0
+1e6a : 85 1c __ STA ACCU + 1
+1e6c : 85 1d __ STA ACCU + 2
+1e6e : 85 1e __ STA ACCU + 3
+1e70 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1e71 : a5 1b __ LDA ACCU + 0
+1e73 : 05 1c __ ORA ACCU + 1
+1e75 : 05 1d __ ORA ACCU + 2
+1e77 : d0 03 __ BNE $1e7c
+1e79 : 85 1e __ STA ACCU + 3
+1e7b : 60 __ __ RTS
+1e7c : a5 03 __ LDA $03
+1e7e : 05 04 __ ORA $04
+1e80 : 05 05 __ ORA $05
+1e82 : d0 09 __ BNE $1e8d
+1e84 : 85 1b __ STA ACCU + 0
+1e86 : 85 1c __ STA ACCU + 1
+1e88 : 85 1d __ STA ACCU + 2
+1e8a : 85 1e __ STA ACCU + 3
+1e8c : 60 __ __ RTS
+1e8d : a9 00 __ LDA #$00
+1e8f : 85 09 __ STA $09
+1e91 : 85 0a __ STA $0a
+1e93 : 85 0b __ STA $0b
+1e95 : a4 1b __ LDY ACCU + 0
+1e97 : a5 03 __ LDA $03
+1e99 : d0 06 __ BNE $1ea1
+1e9b : a5 04 __ LDA $04
+1e9d : f0 0a __ BEQ $1ea9
+1e9f : d0 05 __ BNE $1ea6
+1ea1 : 20 e1 1e JSR $1ee1 ; (fmul8 + 0)
+1ea4 : a5 04 __ LDA $04
+1ea6 : 20 e1 1e JSR $1ee1 ; (fmul8 + 0)
+1ea9 : a5 05 __ LDA $05
+1eab : 20 e1 1e JSR $1ee1 ; (fmul8 + 0)
+1eae : 38 __ __ SEC
+1eaf : a5 0b __ LDA $0b
+1eb1 : 30 06 __ BMI $1eb9
+1eb3 : 06 09 __ ASL $09
+1eb5 : 26 0a __ ROL $0a
+1eb7 : 2a __ __ ROL
+1eb8 : 18 __ __ CLC
+1eb9 : 29 7f __ AND #$7f
+1ebb : 85 0b __ STA $0b
+1ebd : a5 1e __ LDA ACCU + 3
+1ebf : 45 06 __ EOR $06
+1ec1 : 29 80 __ AND #$80
+1ec3 : 85 1e __ STA ACCU + 3
+1ec5 : a5 07 __ LDA $07
+1ec7 : e9 7e __ SBC #$7e
+1ec9 : 18 __ __ CLC
+1eca : 65 08 __ ADC $08
+1ecc : 4a __ __ LSR
+1ecd : 05 1e __ ORA ACCU + 3
+1ecf : 85 1e __ STA ACCU + 3
+1ed1 : a9 00 __ LDA #$00
+1ed3 : 6a __ __ ROR
+1ed4 : 05 0b __ ORA $0b
+1ed6 : 85 1d __ STA ACCU + 2
+1ed8 : a5 0a __ LDA $0a
+1eda : 85 1c __ STA ACCU + 1
+1edc : a5 09 __ LDA $09
+1ede : 85 1b __ STA ACCU + 0
+1ee0 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1ee1 : 38 __ __ SEC
+1ee2 : 6a __ __ ROR
+1ee3 : 90 1e __ BCC $1f03
+1ee5 : aa __ __ TAX
+1ee6 : 18 __ __ CLC
+1ee7 : 98 __ __ TYA
+1ee8 : 65 09 __ ADC $09
+1eea : 85 09 __ STA $09
+1eec : a5 0a __ LDA $0a
+1eee : 65 1c __ ADC ACCU + 1
+1ef0 : 85 0a __ STA $0a
+1ef2 : a5 0b __ LDA $0b
+1ef4 : 65 1d __ ADC ACCU + 2
+1ef6 : 6a __ __ ROR
+1ef7 : 85 0b __ STA $0b
+1ef9 : 8a __ __ TXA
+1efa : 66 0a __ ROR $0a
+1efc : 66 09 __ ROR $09
+1efe : 4a __ __ LSR
+1eff : f0 0d __ BEQ $1f0e
+1f01 : b0 e2 __ BCS $1ee5
+1f03 : 66 0b __ ROR $0b
+1f05 : 66 0a __ ROR $0a
+1f07 : 66 09 __ ROR $09
+1f09 : 4a __ __ LSR
+1f0a : 90 f7 __ BCC $1f03
+1f0c : d0 d7 __ BNE $1ee5
+1f0e : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1f0f : a5 1b __ LDA ACCU + 0
+1f11 : 05 1c __ ORA ACCU + 1
+1f13 : 05 1d __ ORA ACCU + 2
+1f15 : d0 03 __ BNE $1f1a
+1f17 : 85 1e __ STA ACCU + 3
+1f19 : 60 __ __ RTS
+1f1a : a5 1e __ LDA ACCU + 3
+1f1c : 45 06 __ EOR $06
+1f1e : 29 80 __ AND #$80
+1f20 : 85 1e __ STA ACCU + 3
+1f22 : a9 00 __ LDA #$00
+1f24 : 85 09 __ STA $09
+1f26 : 85 0a __ STA $0a
+1f28 : 85 0b __ STA $0b
+1f2a : a2 18 __ LDX #$18
+1f2c : a5 1b __ LDA ACCU + 0
+1f2e : c5 03 __ CMP $03
+1f30 : a5 1c __ LDA ACCU + 1
+1f32 : e5 04 __ SBC $04
+1f34 : a5 1d __ LDA ACCU + 2
+1f36 : e5 05 __ SBC $05
+1f38 : 90 13 __ BCC $1f4d
+1f3a : a5 1b __ LDA ACCU + 0
+1f3c : e5 03 __ SBC $03
+1f3e : 85 1b __ STA ACCU + 0
+1f40 : a5 1c __ LDA ACCU + 1
+1f42 : e5 04 __ SBC $04
+1f44 : 85 1c __ STA ACCU + 1
+1f46 : a5 1d __ LDA ACCU + 2
+1f48 : e5 05 __ SBC $05
+1f4a : 85 1d __ STA ACCU + 2
+1f4c : 38 __ __ SEC
+1f4d : 26 09 __ ROL $09
+1f4f : 26 0a __ ROL $0a
+1f51 : 26 0b __ ROL $0b
+1f53 : ca __ __ DEX
+1f54 : f0 0a __ BEQ $1f60
+1f56 : 06 1b __ ASL ACCU + 0
+1f58 : 26 1c __ ROL ACCU + 1
+1f5a : 26 1d __ ROL ACCU + 2
+1f5c : b0 dc __ BCS $1f3a
+1f5e : 90 cc __ BCC $1f2c
+1f60 : 38 __ __ SEC
+1f61 : a5 0b __ LDA $0b
+1f63 : 30 06 __ BMI $1f6b
+1f65 : 06 09 __ ASL $09
+1f67 : 26 0a __ ROL $0a
+1f69 : 2a __ __ ROL
+1f6a : 18 __ __ CLC
+1f6b : 29 7f __ AND #$7f
+1f6d : 85 0b __ STA $0b
+1f6f : a5 08 __ LDA $08
+1f71 : 49 7f __ EOR #$7f
+1f73 : 65 07 __ ADC $07
+1f75 : 38 __ __ SEC
+1f76 : e9 01 __ SBC #$01
+1f78 : 4a __ __ LSR
+1f79 : 05 1e __ ORA ACCU + 3
+1f7b : 85 1e __ STA ACCU + 3
+1f7d : a9 00 __ LDA #$00
+1f7f : 6a __ __ ROR
+1f80 : 05 0b __ ORA $0b
+1f82 : 85 1d __ STA ACCU + 2
+1f84 : a5 0a __ LDA $0a
+1f86 : 85 1c __ STA ACCU + 1
+1f88 : a5 09 __ LDA $09
+1f8a : 85 1b __ STA ACCU + 0
+1f8c : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1f8d : 24 1c __ BIT ACCU + 1
+1f8f : 10 0d __ BPL $1f9e
+1f91 : 20 ab 1f JSR $1fab ; (negaccu + 0)
+1f94 : 24 04 __ BIT $04
+1f96 : 10 0d __ BPL $1fa5
+1f98 : 20 b9 1f JSR $1fb9 ; (negtmp + 0)
+1f9b : 4c c7 1f JMP $1fc7 ; (divmod + 0)
+1f9e : 24 04 __ BIT $04
+1fa0 : 10 f9 __ BPL $1f9b
+1fa2 : 20 b9 1f JSR $1fb9 ; (negtmp + 0)
+1fa5 : 20 c7 1f JSR $1fc7 ; (divmod + 0)
+1fa8 : 4c ab 1f JMP $1fab ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1fab : 38 __ __ SEC
+1fac : a9 00 __ LDA #$00
+1fae : e5 1b __ SBC ACCU + 0
+1fb0 : 85 1b __ STA ACCU + 0
+1fb2 : a9 00 __ LDA #$00
+1fb4 : e5 1c __ SBC ACCU + 1
+1fb6 : 85 1c __ STA ACCU + 1
+1fb8 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1fb9 : 38 __ __ SEC
+1fba : a9 00 __ LDA #$00
+1fbc : e5 03 __ SBC $03
+1fbe : 85 03 __ STA $03
+1fc0 : a9 00 __ LDA #$00
+1fc2 : e5 04 __ SBC $04
+1fc4 : 85 04 __ STA $04
+1fc6 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1fc7 : a5 1c __ LDA ACCU + 1
+1fc9 : d0 31 __ BNE $1ffc
+1fcb : a5 04 __ LDA $04
+1fcd : d0 1e __ BNE $1fed
+1fcf : 85 06 __ STA $06
+1fd1 : a2 04 __ LDX #$04
+1fd3 : 06 1b __ ASL ACCU + 0
+1fd5 : 2a __ __ ROL
+1fd6 : c5 03 __ CMP $03
+1fd8 : 90 02 __ BCC $1fdc
+1fda : e5 03 __ SBC $03
+1fdc : 26 1b __ ROL ACCU + 0
+1fde : 2a __ __ ROL
+1fdf : c5 03 __ CMP $03
+1fe1 : 90 02 __ BCC $1fe5
+1fe3 : e5 03 __ SBC $03
+1fe5 : 26 1b __ ROL ACCU + 0
+1fe7 : ca __ __ DEX
+1fe8 : d0 eb __ BNE $1fd5
+1fea : 85 05 __ STA $05
+1fec : 60 __ __ RTS
+1fed : a5 1b __ LDA ACCU + 0
+1fef : 85 05 __ STA $05
+1ff1 : a5 1c __ LDA ACCU + 1
+1ff3 : 85 06 __ STA $06
+1ff5 : a9 00 __ LDA #$00
+1ff7 : 85 1b __ STA ACCU + 0
+1ff9 : 85 1c __ STA ACCU + 1
+1ffb : 60 __ __ RTS
+1ffc : a5 04 __ LDA $04
+1ffe : d0 1f __ BNE $201f
+2000 : a5 03 __ LDA $03
+2002 : 30 1b __ BMI $201f
+2004 : a9 00 __ LDA #$00
+2006 : 85 06 __ STA $06
+2008 : a2 10 __ LDX #$10
+200a : 06 1b __ ASL ACCU + 0
+200c : 26 1c __ ROL ACCU + 1
+200e : 2a __ __ ROL
+200f : c5 03 __ CMP $03
+2011 : 90 02 __ BCC $2015
+2013 : e5 03 __ SBC $03
+2015 : 26 1b __ ROL ACCU + 0
+2017 : 26 1c __ ROL ACCU + 1
+2019 : ca __ __ DEX
+201a : d0 f2 __ BNE $200e
+201c : 85 05 __ STA $05
+201e : 60 __ __ RTS
+201f : a9 00 __ LDA #$00
+2021 : 85 05 __ STA $05
+2023 : 85 06 __ STA $06
+2025 : 84 02 __ STY $02
+2027 : a0 10 __ LDY #$10
+2029 : 18 __ __ CLC
+202a : 26 1b __ ROL ACCU + 0
+202c : 26 1c __ ROL ACCU + 1
+202e : 26 05 __ ROL $05
+2030 : 26 06 __ ROL $06
+2032 : 38 __ __ SEC
+2033 : a5 05 __ LDA $05
+2035 : e5 03 __ SBC $03
+2037 : aa __ __ TAX
+2038 : a5 06 __ LDA $06
+203a : e5 04 __ SBC $04
+203c : 90 04 __ BCC $2042
+203e : 86 05 __ STX $05
+2040 : 85 06 __ STA $06
+2042 : 88 __ __ DEY
+2043 : d0 e5 __ BNE $202a
+2045 : 26 1b __ ROL ACCU + 0
+2047 : 26 1c __ ROL ACCU + 1
+2049 : a4 02 __ LDY $02
+204b : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+204c : 24 1c __ BIT ACCU + 1
+204e : 10 0d __ BPL $205d
+2050 : 20 ab 1f JSR $1fab ; (negaccu + 0)
+2053 : 24 04 __ BIT $04
+2055 : 10 0d __ BPL $2064
+2057 : 20 b9 1f JSR $1fb9 ; (negtmp + 0)
+205a : 4c c7 1f JMP $1fc7 ; (divmod + 0)
+205d : 24 04 __ BIT $04
+205f : 10 f9 __ BPL $205a
+2061 : 20 b9 1f JSR $1fb9 ; (negtmp + 0)
+2064 : 20 c7 1f JSR $1fc7 ; (divmod + 0)
+2067 : 38 __ __ SEC
+2068 : a9 00 __ LDA #$00
+206a : e5 05 __ SBC $05
+206c : 85 05 __ STA $05
+206e : a9 00 __ LDA #$00
+2070 : e5 06 __ SBC $06
+2072 : 85 06 __ STA $06
+2074 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+2075 : 20 88 1d JSR $1d88 ; (freg + 36)
+2078 : a5 07 __ LDA $07
+207a : c9 7f __ CMP #$7f
+207c : b0 07 __ BCS $2085
+207e : a9 00 __ LDA #$00
+2080 : 85 1b __ STA ACCU + 0
+2082 : 85 1c __ STA ACCU + 1
+2084 : 60 __ __ RTS
+2085 : 38 __ __ SEC
+2086 : e9 8e __ SBC #$8e
+2088 : 90 0a __ BCC $2094
+208a : a9 ff __ LDA #$ff
+208c : 85 1b __ STA ACCU + 0
+208e : a9 7f __ LDA #$7f
+2090 : 85 1c __ STA ACCU + 1
+2092 : d0 08 __ BNE $209c
+2094 : aa __ __ TAX
+2095 : 46 1d __ LSR ACCU + 2
+2097 : 66 1c __ ROR ACCU + 1
+2099 : e8 __ __ INX
+209a : d0 f9 __ BNE $2095
+209c : 24 1e __ BIT ACCU + 3
+209e : 10 0e __ BPL $20ae
+20a0 : 38 __ __ SEC
+20a1 : a9 00 __ LDA #$00
+20a3 : e5 1c __ SBC ACCU + 1
+20a5 : 85 1b __ STA ACCU + 0
+20a7 : a9 00 __ LDA #$00
+20a9 : e5 1d __ SBC ACCU + 2
+20ab : 85 1c __ STA ACCU + 1
+20ad : 60 __ __ RTS
+20ae : a5 1c __ LDA ACCU + 1
+20b0 : 85 1b __ STA ACCU + 0
+20b2 : a5 1d __ LDA ACCU + 2
+20b4 : 85 1c __ STA ACCU + 1
+20b6 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+20b7 : 24 1c __ BIT ACCU + 1
+20b9 : 30 03 __ BMI $20be
+20bb : 4c d5 20 JMP $20d5 ; (uint16_to_float + 0)
+20be : 38 __ __ SEC
+20bf : a9 00 __ LDA #$00
+20c1 : e5 1b __ SBC ACCU + 0
+20c3 : 85 1b __ STA ACCU + 0
+20c5 : a9 00 __ LDA #$00
+20c7 : e5 1c __ SBC ACCU + 1
+20c9 : 85 1c __ STA ACCU + 1
+20cb : 20 d5 20 JSR $20d5 ; (uint16_to_float + 0)
+20ce : a5 1e __ LDA ACCU + 3
+20d0 : 09 80 __ ORA #$80
+20d2 : 85 1e __ STA ACCU + 3
+20d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+20d5 : a5 1b __ LDA ACCU + 0
+20d7 : 05 1c __ ORA ACCU + 1
+20d9 : d0 05 __ BNE $20e0
+20db : 85 1d __ STA ACCU + 2
+20dd : 85 1e __ STA ACCU + 3
+20df : 60 __ __ RTS
+20e0 : a2 8e __ LDX #$8e
+20e2 : a5 1c __ LDA ACCU + 1
+20e4 : 30 06 __ BMI $20ec
+20e6 : ca __ __ DEX
+20e7 : 06 1b __ ASL ACCU + 0
+20e9 : 2a __ __ ROL
+20ea : 10 fa __ BPL $20e6
+20ec : 29 7f __ AND #$7f
+20ee : 85 1d __ STA ACCU + 2
+20f0 : a5 1b __ LDA ACCU + 0
+20f2 : 85 1c __ STA ACCU + 1
+20f4 : 8a __ __ TXA
+20f5 : 4a __ __ LSR
+20f6 : 85 1e __ STA ACCU + 3
+20f8 : a9 00 __ LDA #$00
+20fa : 85 1b __ STA ACCU + 0
+20fc : 6a __ __ ROR
+20fd : 05 1d __ ORA ACCU + 2
+20ff : 85 1d __ STA ACCU + 2
+2101 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2102 : a5 1e __ LDA ACCU + 3
+2104 : 45 06 __ EOR $06
+2106 : 29 80 __ AND #$80
+2108 : f0 1e __ BEQ $2128
+210a : a5 1e __ LDA ACCU + 3
+210c : 29 7f __ AND #$7f
+210e : 05 1d __ ORA ACCU + 2
+2110 : 05 1c __ ORA ACCU + 1
+2112 : 05 1b __ ORA ACCU + 0
+2114 : d0 0c __ BNE $2122
+2116 : a5 06 __ LDA $06
+2118 : 29 7f __ AND #$7f
+211a : 05 05 __ ORA $05
+211c : 05 04 __ ORA $04
+211e : 05 03 __ ORA $03
+2120 : f0 1e __ BEQ $2140
+2122 : a5 1e __ LDA ACCU + 3
+2124 : 30 23 __ BMI $2149
+2126 : 10 28 __ BPL $2150
+2128 : a5 1e __ LDA ACCU + 3
+212a : c5 06 __ CMP $06
+212c : d0 15 __ BNE $2143
+212e : a5 1d __ LDA ACCU + 2
+2130 : c5 05 __ CMP $05
+2132 : d0 0f __ BNE $2143
+2134 : a5 1c __ LDA ACCU + 1
+2136 : c5 04 __ CMP $04
+2138 : d0 09 __ BNE $2143
+213a : a5 1b __ LDA ACCU + 0
+213c : c5 03 __ CMP $03
+213e : d0 03 __ BNE $2143
+2140 : a9 00 __ LDA #$00
+2142 : 60 __ __ RTS
+2143 : b0 07 __ BCS $214c
+2145 : 24 1e __ BIT ACCU + 3
+2147 : 30 07 __ BMI $2150
+2149 : a9 01 __ LDA #$01
+214b : 60 __ __ RTS
+214c : 24 1e __ BIT ACCU + 3
+214e : 30 f9 __ BMI $2149
+2150 : a9 ff __ LDA #$ff
+2152 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+2153 : 84 02 __ STY $02
+2155 : a9 00 __ LDA #$00
+2157 : 85 07 __ STA $07
+2159 : 85 08 __ STA $08
+215b : 85 09 __ STA $09
+215d : 85 0a __ STA $0a
+215f : a0 20 __ LDY #$20
+2161 : 18 __ __ CLC
+2162 : 26 1b __ ROL ACCU + 0
+2164 : 26 1c __ ROL ACCU + 1
+2166 : 26 1d __ ROL ACCU + 2
+2168 : 26 1e __ ROL ACCU + 3
+216a : 26 07 __ ROL $07
+216c : 26 08 __ ROL $08
+216e : 26 09 __ ROL $09
+2170 : 26 0a __ ROL $0a
+2172 : a5 07 __ LDA $07
+2174 : c5 03 __ CMP $03
+2176 : a5 08 __ LDA $08
+2178 : e5 04 __ SBC $04
+217a : a5 09 __ LDA $09
+217c : e5 05 __ SBC $05
+217e : a5 0a __ LDA $0a
+2180 : e5 06 __ SBC $06
+2182 : 90 18 __ BCC $219c
+2184 : a5 07 __ LDA $07
+2186 : e5 03 __ SBC $03
+2188 : 85 07 __ STA $07
+218a : a5 08 __ LDA $08
+218c : e5 04 __ SBC $04
+218e : 85 08 __ STA $08
+2190 : a5 09 __ LDA $09
+2192 : e5 05 __ SBC $05
+2194 : 85 09 __ STA $09
+2196 : a5 0a __ LDA $0a
+2198 : e5 06 __ SBC $06
+219a : 85 0a __ STA $0a
+219c : 88 __ __ DEY
+219d : d0 c3 __ BNE $2162
+219f : 26 1b __ ROL ACCU + 0
+21a1 : 26 1c __ ROL ACCU + 1
+21a3 : 26 1d __ ROL ACCU + 2
+21a5 : 26 1e __ ROL ACCU + 3
+21a7 : a4 02 __ LDY $02
+21a9 : 60 __ __ RTS
@@ -0,0 +1,3181 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 84 21 STX $2184 ; (spentry + 0)
+0811 : a9 8e __ LDA #$8e
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c8 __ LDA #$c8
+0832 : e9 8e __ SBC #$8e
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 31 1d JMP $1d31 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 6a __ STA T0 + 0
+0911 : 85 6b __ STA T0 + 1
+0913 : 85 6c __ STA T0 + 2
+0915 : 85 6d __ STA T0 + 3
+0917 : 85 6e __ STA T1 + 0
+0919 : 85 6f __ STA T1 + 1
+091b : a9 f2 __ LDA #$f2
+091d : a0 02 __ LDY #$02
+091f : 91 23 __ STA (SP + 0),y
+0921 : a9 1c __ LDA #$1c
+0923 : c8 __ __ INY
+0924 : 91 23 __ STA (SP + 0),y
+0926 : a5 6e __ LDA T1 + 0
+0928 : 85 1b __ STA ACCU + 0
+092a : c8 __ __ INY
+092b : 91 23 __ STA (SP + 0),y
+092d : a5 6f __ LDA T1 + 1
+092f : 85 1c __ STA ACCU + 1
+0931 : c8 __ __ INY
+0932 : 91 23 __ STA (SP + 0),y
+0934 : ad 86 21 LDA $2186 ; (c + 0)
+0937 : 85 43 __ STA T3 + 0
+0939 : ad 87 21 LDA $2187 ; (c + 1)
+093c : 85 44 __ STA T3 + 1
+093e : ad 88 21 LDA $2188 ; (c + 2)
+0941 : 85 45 __ STA T3 + 2
+0943 : ad 89 21 LDA $2189 ; (c + 3)
+0946 : 85 46 __ STA T3 + 3
+0948 : 20 91 20 JSR $2091 ; (sint16_to_float + 0)
+094b : a5 43 __ LDA T3 + 0
+094d : 85 03 __ STA $03
+094f : a5 44 __ LDA T3 + 1
+0951 : 85 04 __ STA $04
+0953 : a5 45 __ LDA T3 + 2
+0955 : 85 05 __ STA $05
+0957 : a5 46 __ LDA T3 + 3
+0959 : 85 06 __ STA $06
+095b : 20 52 1d JSR $1d52 ; (freg + 20)
+095e : 20 4b 1e JSR $1e4b ; (fmul + 0)
+0961 : a5 1b __ LDA ACCU + 0
+0963 : a0 06 __ LDY #$06
+0965 : 91 23 __ STA (SP + 0),y
+0967 : a5 1c __ LDA ACCU + 1
+0969 : c8 __ __ INY
+096a : 91 23 __ STA (SP + 0),y
+096c : a5 1d __ LDA ACCU + 2
+096e : c8 __ __ INY
+096f : 91 23 __ STA (SP + 0),y
+0971 : a5 1e __ LDA ACCU + 3
+0973 : c8 __ __ INY
+0974 : 91 23 __ STA (SP + 0),y
+0976 : a5 6a __ LDA T0 + 0
+0978 : 85 03 __ STA $03
+097a : c8 __ __ INY
+097b : 91 23 __ STA (SP + 0),y
+097d : a5 6b __ LDA T0 + 1
+097f : 85 04 __ STA $04
+0981 : c8 __ __ INY
+0982 : 91 23 __ STA (SP + 0),y
+0984 : a5 6c __ LDA T0 + 2
+0986 : 85 05 __ STA $05
+0988 : c8 __ __ INY
+0989 : 91 23 __ STA (SP + 0),y
+098b : a5 6d __ LDA T0 + 3
+098d : 85 06 __ STA $06
+098f : c8 __ __ INY
+0990 : 91 23 __ STA (SP + 0),y
+0992 : 20 52 1d JSR $1d52 ; (freg + 20)
+0995 : a5 06 __ LDA $06
+0997 : 49 80 __ EOR #$80
+0999 : 85 06 __ STA $06
+099b : 20 83 1d JSR $1d83 ; (faddsub + 0)
+099e : a5 1b __ LDA ACCU + 0
+09a0 : a0 0e __ LDY #$0e
+09a2 : 91 23 __ STA (SP + 0),y
+09a4 : a5 1c __ LDA ACCU + 1
+09a6 : c8 __ __ INY
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : a5 1d __ LDA ACCU + 2
+09ab : c8 __ __ INY
+09ac : 91 23 __ STA (SP + 0),y
+09ae : a5 1e __ LDA ACCU + 3
+09b0 : c8 __ __ INY
+09b1 : 91 23 __ STA (SP + 0),y
+09b3 : 20 66 0c JSR $0c66 ; (printf + 0)
+09b6 : ad 86 21 LDA $2186 ; (c + 0)
+09b9 : 85 43 __ STA T3 + 0
+09bb : ad 87 21 LDA $2187 ; (c + 1)
+09be : 85 44 __ STA T3 + 1
+09c0 : ad 88 21 LDA $2188 ; (c + 2)
+09c3 : 85 45 __ STA T3 + 2
+09c5 : ad 89 21 LDA $2189 ; (c + 3)
+09c8 : 85 46 __ STA T3 + 3
+09ca : a5 6e __ LDA T1 + 0
+09cc : 85 1b __ STA ACCU + 0
+09ce : a5 6f __ LDA T1 + 1
+09d0 : 85 1c __ STA ACCU + 1
+09d2 : 20 91 20 JSR $2091 ; (sint16_to_float + 0)
+09d5 : a5 43 __ LDA T3 + 0
+09d7 : 85 03 __ STA $03
+09d9 : a5 44 __ LDA T3 + 1
+09db : 85 04 __ STA $04
+09dd : a5 45 __ LDA T3 + 2
+09df : 85 05 __ STA $05
+09e1 : a5 46 __ LDA T3 + 3
+09e3 : 85 06 __ STA $06
+09e5 : 20 52 1d JSR $1d52 ; (freg + 20)
+09e8 : 20 4b 1e JSR $1e4b ; (fmul + 0)
+09eb : a5 1b __ LDA ACCU + 0
+09ed : 85 03 __ STA $03
+09ef : a5 1c __ LDA ACCU + 1
+09f1 : 85 04 __ STA $04
+09f3 : a5 1d __ LDA ACCU + 2
+09f5 : 85 05 __ STA $05
+09f7 : a5 1e __ LDA ACCU + 3
+09f9 : 85 06 __ STA $06
+09fb : a5 6a __ LDA T0 + 0
+09fd : 85 1b __ STA ACCU + 0
+09ff : a5 6b __ LDA T0 + 1
+0a01 : 85 1c __ STA ACCU + 1
+0a03 : a5 6c __ LDA T0 + 2
+0a05 : 85 1d __ STA ACCU + 2
+0a07 : a5 6d __ LDA T0 + 3
+0a09 : 85 1e __ STA ACCU + 3
+0a0b : 20 dc 20 JSR $20dc ; (fcmp + 0)
+0a0e : d0 03 __ BNE $0a13
+0a10 : 4c 61 0c JMP $0c61 ; (main + 865)
+0a13 : a9 00 __ LDA #$00
+0a15 : a0 02 __ LDY #$02
+0a17 : 91 23 __ STA (SP + 0),y
+0a19 : 20 ff 1c JSR $1cff ; (assert + 0)
+0a1c : ad 86 21 LDA $2186 ; (c + 0)
+0a1f : 85 1b __ STA ACCU + 0
+0a21 : ad 87 21 LDA $2187 ; (c + 1)
+0a24 : 85 1c __ STA ACCU + 1
+0a26 : ad 88 21 LDA $2188 ; (c + 2)
+0a29 : 85 1d __ STA ACCU + 2
+0a2b : ad 89 21 LDA $2189 ; (c + 3)
+0a2e : 85 1e __ STA ACCU + 3
+0a30 : a5 6a __ LDA T0 + 0
+0a32 : 85 03 __ STA $03
+0a34 : a5 6b __ LDA T0 + 1
+0a36 : 85 04 __ STA $04
+0a38 : a5 6c __ LDA T0 + 2
+0a3a : 85 05 __ STA $05
+0a3c : a5 6d __ LDA T0 + 3
+0a3e : 85 06 __ STA $06
+0a40 : 20 52 1d JSR $1d52 ; (freg + 20)
+0a43 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+0a46 : a5 1b __ LDA ACCU + 0
+0a48 : 85 6a __ STA T0 + 0
+0a4a : a5 1c __ LDA ACCU + 1
+0a4c : 85 6b __ STA T0 + 1
+0a4e : a5 1d __ LDA ACCU + 2
+0a50 : 85 6c __ STA T0 + 2
+0a52 : a5 1e __ LDA ACCU + 3
+0a54 : 85 6d __ STA T0 + 3
+0a56 : e6 6e __ INC T1 + 0
+0a58 : d0 02 __ BNE $0a5c
+0a5a : e6 6f __ INC T1 + 1
+0a5c : a5 6e __ LDA T1 + 0
+0a5e : c9 32 __ CMP #$32
+0a60 : b0 03 __ BCS $0a65
+0a62 : 4c 1b 09 JMP $091b ; (main + 27)
+0a65 : ad 8a 21 LDA $218a ; (d + 0)
+0a68 : 85 6a __ STA T0 + 0
+0a6a : ad 8b 21 LDA $218b ; (d + 1)
+0a6d : 85 6b __ STA T0 + 1
+0a6f : ad 8c 21 LDA $218c ; (d + 2)
+0a72 : 85 6c __ STA T0 + 2
+0a74 : ad 8d 21 LDA $218d ; (d + 3)
+0a77 : 85 6d __ STA T0 + 3
+0a79 : a9 01 __ LDA #$01
+0a7b : 85 6e __ STA T1 + 0
+0a7d : a9 00 __ LDA #$00
+0a7f : 85 6f __ STA T1 + 1
+0a81 : a9 24 __ LDA #$24
+0a83 : a0 02 __ LDY #$02
+0a85 : 91 23 __ STA (SP + 0),y
+0a87 : a9 1d __ LDA #$1d
+0a89 : c8 __ __ INY
+0a8a : 91 23 __ STA (SP + 0),y
+0a8c : a5 6e __ LDA T1 + 0
+0a8e : 85 1b __ STA ACCU + 0
+0a90 : c8 __ __ INY
+0a91 : 91 23 __ STA (SP + 0),y
+0a93 : a5 6f __ LDA T1 + 1
+0a95 : 85 1c __ STA ACCU + 1
+0a97 : c8 __ __ INY
+0a98 : 91 23 __ STA (SP + 0),y
+0a9a : ad 8a 21 LDA $218a ; (d + 0)
+0a9d : 85 43 __ STA T3 + 0
+0a9f : ad 8b 21 LDA $218b ; (d + 1)
+0aa2 : 85 44 __ STA T3 + 1
+0aa4 : ad 8c 21 LDA $218c ; (d + 2)
+0aa7 : 85 45 __ STA T3 + 2
+0aa9 : ad 8d 21 LDA $218d ; (d + 3)
+0aac : 85 46 __ STA T3 + 3
+0aae : 20 91 20 JSR $2091 ; (sint16_to_float + 0)
+0ab1 : a5 1b __ LDA ACCU + 0
+0ab3 : 85 47 __ STA T4 + 0
+0ab5 : a5 1c __ LDA ACCU + 1
+0ab7 : 85 48 __ STA T4 + 1
+0ab9 : a5 1d __ LDA ACCU + 2
+0abb : 85 49 __ STA T4 + 2
+0abd : a5 1e __ LDA ACCU + 3
+0abf : 85 4a __ STA T4 + 3
+0ac1 : a5 43 __ LDA T3 + 0
+0ac3 : 85 03 __ STA $03
+0ac5 : a5 44 __ LDA T3 + 1
+0ac7 : 85 04 __ STA $04
+0ac9 : a5 45 __ LDA T3 + 2
+0acb : 85 05 __ STA $05
+0acd : a5 46 __ LDA T3 + 3
+0acf : 85 06 __ STA $06
+0ad1 : 20 52 1d JSR $1d52 ; (freg + 20)
+0ad4 : 20 4b 1e JSR $1e4b ; (fmul + 0)
+0ad7 : a5 1b __ LDA ACCU + 0
+0ad9 : a0 06 __ LDY #$06
+0adb : 91 23 __ STA (SP + 0),y
+0add : a5 1c __ LDA ACCU + 1
+0adf : c8 __ __ INY
+0ae0 : 91 23 __ STA (SP + 0),y
+0ae2 : a5 1d __ LDA ACCU + 2
+0ae4 : c8 __ __ INY
+0ae5 : 91 23 __ STA (SP + 0),y
+0ae7 : a5 1e __ LDA ACCU + 3
+0ae9 : c8 __ __ INY
+0aea : 91 23 __ STA (SP + 0),y
+0aec : a5 6a __ LDA T0 + 0
+0aee : 85 03 __ STA $03
+0af0 : c8 __ __ INY
+0af1 : 91 23 __ STA (SP + 0),y
+0af3 : a5 6b __ LDA T0 + 1
+0af5 : 85 04 __ STA $04
+0af7 : c8 __ __ INY
+0af8 : 91 23 __ STA (SP + 0),y
+0afa : a5 6c __ LDA T0 + 2
+0afc : 85 05 __ STA $05
+0afe : c8 __ __ INY
+0aff : 91 23 __ STA (SP + 0),y
+0b01 : a5 6d __ LDA T0 + 3
+0b03 : 85 06 __ STA $06
+0b05 : c8 __ __ INY
+0b06 : 91 23 __ STA (SP + 0),y
+0b08 : 20 52 1d JSR $1d52 ; (freg + 20)
+0b0b : a5 06 __ LDA $06
+0b0d : 49 80 __ EOR #$80
+0b0f : 85 06 __ STA $06
+0b11 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+0b14 : a5 1e __ LDA ACCU + 3
+0b16 : 29 7f __ AND #$7f
+0b18 : 85 1e __ STA ACCU + 3
+0b1a : a5 47 __ LDA T4 + 0
+0b1c : 85 03 __ STA $03
+0b1e : a5 48 __ LDA T4 + 1
+0b20 : 85 04 __ STA $04
+0b22 : a5 49 __ LDA T4 + 2
+0b24 : 85 05 __ STA $05
+0b26 : a5 4a __ LDA T4 + 3
+0b28 : 85 06 __ STA $06
+0b2a : 20 52 1d JSR $1d52 ; (freg + 20)
+0b2d : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+0b30 : a5 1b __ LDA ACCU + 0
+0b32 : a0 0e __ LDY #$0e
+0b34 : 91 23 __ STA (SP + 0),y
+0b36 : a5 1c __ LDA ACCU + 1
+0b38 : c8 __ __ INY
+0b39 : 91 23 __ STA (SP + 0),y
+0b3b : a5 1d __ LDA ACCU + 2
+0b3d : c8 __ __ INY
+0b3e : 91 23 __ STA (SP + 0),y
+0b40 : a5 1e __ LDA ACCU + 3
+0b42 : c8 __ __ INY
+0b43 : 91 23 __ STA (SP + 0),y
+0b45 : 20 66 0c JSR $0c66 ; (printf + 0)
+0b48 : ad 8a 21 LDA $218a ; (d + 0)
+0b4b : 85 43 __ STA T3 + 0
+0b4d : ad 8b 21 LDA $218b ; (d + 1)
+0b50 : 85 44 __ STA T3 + 1
+0b52 : ad 8c 21 LDA $218c ; (d + 2)
+0b55 : 85 45 __ STA T3 + 2
+0b57 : ad 8d 21 LDA $218d ; (d + 3)
+0b5a : 85 46 __ STA T3 + 3
+0b5c : a5 6e __ LDA T1 + 0
+0b5e : 85 1b __ STA ACCU + 0
+0b60 : a5 6f __ LDA T1 + 1
+0b62 : 85 1c __ STA ACCU + 1
+0b64 : 20 91 20 JSR $2091 ; (sint16_to_float + 0)
+0b67 : a5 1b __ LDA ACCU + 0
+0b69 : 85 47 __ STA T4 + 0
+0b6b : a5 1c __ LDA ACCU + 1
+0b6d : 85 48 __ STA T4 + 1
+0b6f : a5 1d __ LDA ACCU + 2
+0b71 : 85 49 __ STA T4 + 2
+0b73 : a5 1e __ LDA ACCU + 3
+0b75 : 85 4a __ STA T4 + 3
+0b77 : a5 43 __ LDA T3 + 0
+0b79 : 85 03 __ STA $03
+0b7b : a5 44 __ LDA T3 + 1
+0b7d : 85 04 __ STA $04
+0b7f : a5 45 __ LDA T3 + 2
+0b81 : 85 05 __ STA $05
+0b83 : a5 46 __ LDA T3 + 3
+0b85 : 85 06 __ STA $06
+0b87 : 20 52 1d JSR $1d52 ; (freg + 20)
+0b8a : 20 4b 1e JSR $1e4b ; (fmul + 0)
+0b8d : a5 6a __ LDA T0 + 0
+0b8f : 85 03 __ STA $03
+0b91 : a5 6b __ LDA T0 + 1
+0b93 : 85 04 __ STA $04
+0b95 : a5 6c __ LDA T0 + 2
+0b97 : 85 05 __ STA $05
+0b99 : a5 6d __ LDA T0 + 3
+0b9b : 85 06 __ STA $06
+0b9d : 20 52 1d JSR $1d52 ; (freg + 20)
+0ba0 : a5 06 __ LDA $06
+0ba2 : 49 80 __ EOR #$80
+0ba4 : 85 06 __ STA $06
+0ba6 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+0ba9 : a5 1b __ LDA ACCU + 0
+0bab : 85 43 __ STA T3 + 0
+0bad : a5 1c __ LDA ACCU + 1
+0baf : 85 44 __ STA T3 + 1
+0bb1 : a5 1d __ LDA ACCU + 2
+0bb3 : 85 45 __ STA T3 + 2
+0bb5 : a5 1e __ LDA ACCU + 3
+0bb7 : 29 7f __ AND #$7f
+0bb9 : 85 46 __ STA T3 + 3
+0bbb : a5 47 __ LDA T4 + 0
+0bbd : 85 1b __ STA ACCU + 0
+0bbf : a5 48 __ LDA T4 + 1
+0bc1 : 85 1c __ STA ACCU + 1
+0bc3 : a5 49 __ LDA T4 + 2
+0bc5 : 85 1d __ STA ACCU + 2
+0bc7 : a5 4a __ LDA T4 + 3
+0bc9 : 85 1e __ STA ACCU + 3
+0bcb : a9 bd __ LDA #$bd
+0bcd : 85 03 __ STA $03
+0bcf : a9 37 __ LDA #$37
+0bd1 : 85 04 __ STA $04
+0bd3 : a9 86 __ LDA #$86
+0bd5 : 85 05 __ STA $05
+0bd7 : a9 35 __ LDA #$35
+0bd9 : 85 06 __ STA $06
+0bdb : 20 52 1d JSR $1d52 ; (freg + 20)
+0bde : 20 4b 1e JSR $1e4b ; (fmul + 0)
+0be1 : a5 43 __ LDA T3 + 0
+0be3 : 85 03 __ STA $03
+0be5 : a5 44 __ LDA T3 + 1
+0be7 : 85 04 __ STA $04
+0be9 : a5 45 __ LDA T3 + 2
+0beb : 85 05 __ STA $05
+0bed : a5 46 __ LDA T3 + 3
+0bef : 85 06 __ STA $06
+0bf1 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+0bf4 : 30 66 __ BMI $0c5c
+0bf6 : a9 00 __ LDA #$00
+0bf8 : a0 02 __ LDY #$02
+0bfa : 91 23 __ STA (SP + 0),y
+0bfc : 20 ff 1c JSR $1cff ; (assert + 0)
+0bff : ad 8a 21 LDA $218a ; (d + 0)
+0c02 : 85 1b __ STA ACCU + 0
+0c04 : ad 8b 21 LDA $218b ; (d + 1)
+0c07 : 85 1c __ STA ACCU + 1
+0c09 : ad 8c 21 LDA $218c ; (d + 2)
+0c0c : 85 1d __ STA ACCU + 2
+0c0e : ad 8d 21 LDA $218d ; (d + 3)
+0c11 : 85 1e __ STA ACCU + 3
+0c13 : a5 6a __ LDA T0 + 0
+0c15 : 85 03 __ STA $03
+0c17 : a5 6b __ LDA T0 + 1
+0c19 : 85 04 __ STA $04
+0c1b : a5 6c __ LDA T0 + 2
+0c1d : 85 05 __ STA $05
+0c1f : a5 6d __ LDA T0 + 3
+0c21 : 85 06 __ STA $06
+0c23 : 20 52 1d JSR $1d52 ; (freg + 20)
+0c26 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+0c29 : a5 1b __ LDA ACCU + 0
+0c2b : 85 6a __ STA T0 + 0
+0c2d : a5 1c __ LDA ACCU + 1
+0c2f : 85 6b __ STA T0 + 1
+0c31 : a5 1d __ LDA ACCU + 2
+0c33 : 85 6c __ STA T0 + 2
+0c35 : a5 1e __ LDA ACCU + 3
+0c37 : 85 6d __ STA T0 + 3
+0c39 : e6 6e __ INC T1 + 0
+0c3b : d0 02 __ BNE $0c3f
+0c3d : e6 6f __ INC T1 + 1
+0c3f : a5 6e __ LDA T1 + 0
+0c41 : c9 32 __ CMP #$32
+0c43 : b0 03 __ BCS $0c48
+0c45 : 4c 81 0a JMP $0a81 ; (main + 385)
+0c48 : a9 00 __ LDA #$00
+0c4a : 85 1b __ STA ACCU + 0
+0c4c : 85 1c __ STA ACCU + 1
+0c4e : 18 __ __ CLC
+0c4f : a5 23 __ LDA SP + 0
+0c51 : 69 12 __ ADC #$12
+0c53 : 85 23 __ STA SP + 0
+0c55 : a5 24 __ LDA SP + 1
+0c57 : 69 00 __ ADC #$00
+0c59 : 85 24 __ STA SP + 1
+0c5b : 60 __ __ RTS
+0c5c : a9 01 __ LDA #$01
+0c5e : 4c f8 0b JMP $0bf8 ; (main + 760)
+0c61 : a9 01 __ LDA #$01
+0c63 : 4c 15 0a JMP $0a15 ; (main + 277)
+--------------------------------------------------------------------
+printf:
+0c66 : a9 00 __ LDA #$00
+0c68 : 85 5d __ STA T1 + 0
+0c6a : a0 02 __ LDY #$02
+0c6c : b1 23 __ LDA (SP + 0),y
+0c6e : 85 5f __ STA T2 + 0
+0c70 : c8 __ __ INY
+0c71 : b1 23 __ LDA (SP + 0),y
+0c73 : 85 60 __ STA T2 + 1
+0c75 : a0 00 __ LDY #$00
+0c77 : b1 5f __ LDA (T2 + 0),y
+0c79 : 85 43 __ STA T3 + 0
+0c7b : d0 16 __ BNE $0c93
+0c7d : a9 00 __ LDA #$00
+0c7f : a4 5d __ LDY T1 + 0
+0c81 : 99 8e 21 STA $218e,y ; (sframe + 0)
+0c84 : 98 __ __ TYA
+0c85 : f0 0b __ BEQ $0c92
+0c87 : a9 8e __ LDA #$8e
+0c89 : 85 0d __ STA P0
+0c8b : a9 21 __ LDA #$21
+0c8d : 85 0e __ STA P1
+0c8f : 20 6b 14 JSR $146b ; (puts + 0)
+0c92 : 60 __ __ RTS
+0c93 : 18 __ __ CLC
+0c94 : a5 23 __ LDA SP + 0
+0c96 : 69 04 __ ADC #$04
+0c98 : 85 61 __ STA T4 + 0
+0c9a : a5 24 __ LDA SP + 1
+0c9c : 69 00 __ ADC #$00
+0c9e : 85 62 __ STA T4 + 1
+0ca0 : e6 5f __ INC T2 + 0
+0ca2 : d0 02 __ BNE $0ca6
+0ca4 : e6 60 __ INC T2 + 1
+0ca6 : a5 43 __ LDA T3 + 0
+0ca8 : c9 25 __ CMP #$25
+0caa : f0 4f __ BEQ $0cfb
+0cac : a4 5d __ LDY T1 + 0
+0cae : 99 8e 21 STA $218e,y ; (sframe + 0)
+0cb1 : e6 5d __ INC T1 + 0
+0cb3 : a5 5d __ LDA T1 + 0
+0cb5 : c9 28 __ CMP #$28
+0cb7 : a0 00 __ LDY #$00
+0cb9 : 90 31 __ BCC $0cec
+0cbb : 18 __ __ CLC
+0cbc : 69 8e __ ADC #$8e
+0cbe : 85 47 __ STA T6 + 0
+0cc0 : a9 21 __ LDA #$21
+0cc2 : 85 0e __ STA P1
+0cc4 : 69 00 __ ADC #$00
+0cc6 : 85 48 __ STA T6 + 1
+0cc8 : a9 00 __ LDA #$00
+0cca : 91 47 __ STA (T6 + 0),y
+0ccc : a9 8e __ LDA #$8e
+0cce : 85 0d __ STA P0
+0cd0 : 20 6b 14 JSR $146b ; (puts + 0)
+0cd3 : a9 00 __ LDA #$00
+0cd5 : 85 5d __ STA T1 + 0
+0cd7 : a0 00 __ LDY #$00
+0cd9 : b1 5f __ LDA (T2 + 0),y
+0cdb : 85 45 __ STA T5 + 0
+0cdd : e6 5f __ INC T2 + 0
+0cdf : d0 02 __ BNE $0ce3
+0ce1 : e6 60 __ INC T2 + 1
+0ce3 : a5 45 __ LDA T5 + 0
+0ce5 : 85 43 __ STA T3 + 0
+0ce7 : d0 bd __ BNE $0ca6
+0ce9 : 4c 7d 0c JMP $0c7d ; (printf + 23)
+0cec : a0 00 __ LDY #$00
+0cee : b1 5f __ LDA (T2 + 0),y
+0cf0 : 85 45 __ STA T5 + 0
+0cf2 : e6 5f __ INC T2 + 0
+0cf4 : d0 02 __ BNE $0cf8
+0cf6 : e6 60 __ INC T2 + 1
+0cf8 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0cfb : a5 5d __ LDA T1 + 0
+0cfd : f0 1e __ BEQ $0d1d
+0cff : 18 __ __ CLC
+0d00 : 69 8e __ ADC #$8e
+0d02 : 85 47 __ STA T6 + 0
+0d04 : a9 21 __ LDA #$21
+0d06 : 85 0e __ STA P1
+0d08 : 69 00 __ ADC #$00
+0d0a : 85 48 __ STA T6 + 1
+0d0c : a9 00 __ LDA #$00
+0d0e : a0 00 __ LDY #$00
+0d10 : 91 47 __ STA (T6 + 0),y
+0d12 : a9 8e __ LDA #$8e
+0d14 : 85 0d __ STA P0
+0d16 : 20 6b 14 JSR $146b ; (puts + 0)
+0d19 : a9 00 __ LDA #$00
+0d1b : 85 5d __ STA T1 + 0
+0d1d : a0 00 __ LDY #$00
+0d1f : b1 5f __ LDA (T2 + 0),y
+0d21 : 85 43 __ STA T3 + 0
+0d23 : a9 0a __ LDA #$0a
+0d25 : 8d c3 21 STA $21c3 ; (sframe + 53)
+0d28 : a9 00 __ LDA #$00
+0d2a : 8d c4 21 STA $21c4 ; (sframe + 54)
+0d2d : a9 01 __ LDA #$01
+0d2f : 8d c1 21 STA $21c1 ; (sframe + 51)
+0d32 : a9 ff __ LDA #$ff
+0d34 : 8d c2 21 STA $21c2 ; (sframe + 52)
+0d37 : a9 20 __ LDA #$20
+0d39 : 8d c0 21 STA $21c0 ; (sframe + 50)
+0d3c : a9 00 __ LDA #$00
+0d3e : 8d c5 21 STA $21c5 ; (sframe + 55)
+0d41 : 8d c6 21 STA $21c6 ; (sframe + 56)
+0d44 : 8d c7 21 STA $21c7 ; (sframe + 57)
+0d47 : e6 5f __ INC T2 + 0
+0d49 : d0 02 __ BNE $0d4d
+0d4b : e6 60 __ INC T2 + 1
+0d4d : a5 43 __ LDA T3 + 0
+0d4f : c9 2b __ CMP #$2b
+0d51 : d0 03 __ BNE $0d56
+0d53 : 4c 5d 14 JMP $145d ; (printf + 2039)
+0d56 : c9 30 __ CMP #$30
+0d58 : d0 03 __ BNE $0d5d
+0d5a : 4c 4f 14 JMP $144f ; (printf + 2025)
+0d5d : c9 23 __ CMP #$23
+0d5f : d0 03 __ BNE $0d64
+0d61 : 4c 41 14 JMP $1441 ; (printf + 2011)
+0d64 : c9 30 __ CMP #$30
+0d66 : 90 64 __ BCC $0dcc
+0d68 : a9 39 __ LDA #$39
+0d6a : c5 43 __ CMP T3 + 0
+0d6c : 90 5e __ BCC $0dcc
+0d6e : a9 00 __ LDA #$00
+0d70 : 85 47 __ STA T6 + 0
+0d72 : 85 48 __ STA T6 + 1
+0d74 : a5 43 __ LDA T3 + 0
+0d76 : c9 30 __ CMP #$30
+0d78 : 90 4d __ BCC $0dc7
+0d7a : a9 39 __ LDA #$39
+0d7c : c5 43 __ CMP T3 + 0
+0d7e : 90 47 __ BCC $0dc7
+0d80 : a5 43 __ LDA T3 + 0
+0d82 : 85 49 __ STA T7 + 0
+0d84 : a0 00 __ LDY #$00
+0d86 : b1 5f __ LDA (T2 + 0),y
+0d88 : 85 43 __ STA T3 + 0
+0d8a : e6 5f __ INC T2 + 0
+0d8c : d0 02 __ BNE $0d90
+0d8e : e6 60 __ INC T2 + 1
+0d90 : a5 47 __ LDA T6 + 0
+0d92 : 0a __ __ ASL
+0d93 : 85 07 __ STA $07
+0d95 : a5 48 __ LDA T6 + 1
+0d97 : 2a __ __ ROL
+0d98 : 06 07 __ ASL $07
+0d9a : 2a __ __ ROL
+0d9b : aa __ __ TAX
+0d9c : 18 __ __ CLC
+0d9d : a5 07 __ LDA $07
+0d9f : 65 47 __ ADC T6 + 0
+0da1 : 85 1b __ STA ACCU + 0
+0da3 : 8a __ __ TXA
+0da4 : 65 48 __ ADC T6 + 1
+0da6 : 06 1b __ ASL ACCU + 0
+0da8 : 2a __ __ ROL
+0da9 : 85 1c __ STA ACCU + 1
+0dab : 18 __ __ CLC
+0dac : a5 1b __ LDA ACCU + 0
+0dae : 65 49 __ ADC T7 + 0
+0db0 : aa __ __ TAX
+0db1 : a5 1c __ LDA ACCU + 1
+0db3 : 69 00 __ ADC #$00
+0db5 : a8 __ __ TAY
+0db6 : 38 __ __ SEC
+0db7 : 8a __ __ TXA
+0db8 : e9 30 __ SBC #$30
+0dba : 85 47 __ STA T6 + 0
+0dbc : 98 __ __ TYA
+0dbd : e9 00 __ SBC #$00
+0dbf : 85 48 __ STA T6 + 1
+0dc1 : a5 43 __ LDA T3 + 0
+0dc3 : c9 30 __ CMP #$30
+0dc5 : b0 b3 __ BCS $0d7a
+0dc7 : a5 47 __ LDA T6 + 0
+0dc9 : 8d c1 21 STA $21c1 ; (sframe + 51)
+0dcc : a5 43 __ LDA T3 + 0
+0dce : c9 2e __ CMP #$2e
+0dd0 : d0 03 __ BNE $0dd5
+0dd2 : 4c d4 13 JMP $13d4 ; (printf + 1902)
+0dd5 : a5 43 __ LDA T3 + 0
+0dd7 : c9 64 __ CMP #$64
+0dd9 : d0 03 __ BNE $0dde
+0ddb : 4c 46 12 JMP $1246 ; (printf + 1504)
+0dde : c9 75 __ CMP #$75
+0de0 : d0 03 __ BNE $0de5
+0de2 : 4c 00 11 JMP $1100 ; (printf + 1178)
+0de5 : c9 78 __ CMP #$78
+0de7 : d0 03 __ BNE $0dec
+0de9 : 4c a3 0f JMP $0fa3 ; (printf + 829)
+0dec : c9 6c __ CMP #$6c
+0dee : d0 03 __ BNE $0df3
+0df0 : 4c b9 0e JMP $0eb9 ; (printf + 595)
+0df3 : c9 66 __ CMP #$66
+0df5 : f0 7c __ BEQ $0e73
+0df7 : c9 67 __ CMP #$67
+0df9 : f0 78 __ BEQ $0e73
+0dfb : c9 65 __ CMP #$65
+0dfd : f0 74 __ BEQ $0e73
+0dff : c9 73 __ CMP #$73
+0e01 : f0 48 __ BEQ $0e4b
+0e03 : c9 63 __ CMP #$63
+0e05 : f0 1f __ BEQ $0e26
+0e07 : 09 00 __ ORA #$00
+0e09 : d0 03 __ BNE $0e0e
+0e0b : 4c ec 0c JMP $0cec ; (printf + 134)
+0e0e : a5 43 __ LDA T3 + 0
+0e10 : a4 5d __ LDY T1 + 0
+0e12 : 99 8e 21 STA $218e,y ; (sframe + 0)
+0e15 : e6 5d __ INC T1 + 0
+0e17 : a0 00 __ LDY #$00
+0e19 : b1 5f __ LDA (T2 + 0),y
+0e1b : 85 45 __ STA T5 + 0
+0e1d : e6 5f __ INC T2 + 0
+0e1f : d0 02 __ BNE $0e23
+0e21 : e6 60 __ INC T2 + 1
+0e23 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0e26 : a0 00 __ LDY #$00
+0e28 : b1 61 __ LDA (T4 + 0),y
+0e2a : a4 5d __ LDY T1 + 0
+0e2c : 99 8e 21 STA $218e,y ; (sframe + 0)
+0e2f : 18 __ __ CLC
+0e30 : a5 61 __ LDA T4 + 0
+0e32 : 69 02 __ ADC #$02
+0e34 : 85 61 __ STA T4 + 0
+0e36 : 90 02 __ BCC $0e3a
+0e38 : e6 62 __ INC T4 + 1
+0e3a : e6 5d __ INC T1 + 0
+0e3c : a0 00 __ LDY #$00
+0e3e : b1 5f __ LDA (T2 + 0),y
+0e40 : 85 45 __ STA T5 + 0
+0e42 : e6 5f __ INC T2 + 0
+0e44 : d0 02 __ BNE $0e48
+0e46 : e6 60 __ INC T2 + 1
+0e48 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0e4b : a0 00 __ LDY #$00
+0e4d : b1 61 __ LDA (T4 + 0),y
+0e4f : 85 0d __ STA P0
+0e51 : c8 __ __ INY
+0e52 : b1 61 __ LDA (T4 + 0),y
+0e54 : 85 0e __ STA P1
+0e56 : 20 6b 14 JSR $146b ; (puts + 0)
+0e59 : 18 __ __ CLC
+0e5a : a5 61 __ LDA T4 + 0
+0e5c : 69 02 __ ADC #$02
+0e5e : 85 61 __ STA T4 + 0
+0e60 : 90 02 __ BCC $0e64
+0e62 : e6 62 __ INC T4 + 1
+0e64 : a0 00 __ LDY #$00
+0e66 : b1 5f __ LDA (T2 + 0),y
+0e68 : 85 45 __ STA T5 + 0
+0e6a : e6 5f __ INC T2 + 0
+0e6c : d0 02 __ BNE $0e70
+0e6e : e6 60 __ INC T2 + 1
+0e70 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0e73 : a9 c0 __ LDA #$c0
+0e75 : 85 0d __ STA P0
+0e77 : a9 21 __ LDA #$21
+0e79 : 85 0e __ STA P1
+0e7b : a9 8e __ LDA #$8e
+0e7d : 85 0f __ STA P2
+0e7f : a9 21 __ LDA #$21
+0e81 : 85 10 __ STA P3
+0e83 : a0 00 __ LDY #$00
+0e85 : b1 61 __ LDA (T4 + 0),y
+0e87 : 85 11 __ STA P4
+0e89 : c8 __ __ INY
+0e8a : b1 61 __ LDA (T4 + 0),y
+0e8c : 85 12 __ STA P5
+0e8e : c8 __ __ INY
+0e8f : b1 61 __ LDA (T4 + 0),y
+0e91 : 85 13 __ STA P6
+0e93 : c8 __ __ INY
+0e94 : b1 61 __ LDA (T4 + 0),y
+0e96 : 85 14 __ STA P7
+0e98 : 20 a5 16 JSR $16a5 ; (nformf + 0)
+0e9b : a5 1b __ LDA ACCU + 0
+0e9d : 85 5d __ STA T1 + 0
+0e9f : 18 __ __ CLC
+0ea0 : a5 61 __ LDA T4 + 0
+0ea2 : 69 04 __ ADC #$04
+0ea4 : 85 61 __ STA T4 + 0
+0ea6 : 90 02 __ BCC $0eaa
+0ea8 : e6 62 __ INC T4 + 1
+0eaa : a0 00 __ LDY #$00
+0eac : b1 5f __ LDA (T2 + 0),y
+0eae : 85 45 __ STA T5 + 0
+0eb0 : e6 5f __ INC T2 + 0
+0eb2 : d0 02 __ BNE $0eb6
+0eb4 : e6 60 __ INC T2 + 1
+0eb6 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0eb9 : a0 00 __ LDY #$00
+0ebb : b1 61 __ LDA (T4 + 0),y
+0ebd : 85 63 __ STA T13 + 0
+0ebf : c8 __ __ INY
+0ec0 : b1 61 __ LDA (T4 + 0),y
+0ec2 : 85 64 __ STA T13 + 1
+0ec4 : c8 __ __ INY
+0ec5 : b1 61 __ LDA (T4 + 0),y
+0ec7 : 85 65 __ STA T13 + 2
+0ec9 : c8 __ __ INY
+0eca : b1 61 __ LDA (T4 + 0),y
+0ecc : 85 66 __ STA T13 + 3
+0ece : 18 __ __ CLC
+0ecf : a5 61 __ LDA T4 + 0
+0ed1 : 69 04 __ ADC #$04
+0ed3 : 85 61 __ STA T4 + 0
+0ed5 : 90 02 __ BCC $0ed9
+0ed7 : e6 62 __ INC T4 + 1
+0ed9 : a0 00 __ LDY #$00
+0edb : b1 5f __ LDA (T2 + 0),y
+0edd : aa __ __ TAX
+0ede : e6 5f __ INC T2 + 0
+0ee0 : d0 02 __ BNE $0ee4
+0ee2 : e6 60 __ INC T2 + 1
+0ee4 : 8a __ __ TXA
+0ee5 : e0 64 __ CPX #$64
+0ee7 : d0 03 __ BNE $0eec
+0ee9 : 4c 6d 0f JMP $0f6d ; (printf + 775)
+0eec : c9 75 __ CMP #$75
+0eee : f0 47 __ BEQ $0f37
+0ef0 : c9 78 __ CMP #$78
+0ef2 : f0 03 __ BEQ $0ef7
+0ef4 : 4c ec 0c JMP $0cec ; (printf + 134)
+0ef7 : a9 10 __ LDA #$10
+0ef9 : 8d c3 21 STA $21c3 ; (sframe + 53)
+0efc : a9 00 __ LDA #$00
+0efe : 8d c4 21 STA $21c4 ; (sframe + 54)
+0f01 : a9 c0 __ LDA #$c0
+0f03 : 85 0d __ STA P0
+0f05 : a9 21 __ LDA #$21
+0f07 : 85 0e __ STA P1
+0f09 : a9 8e __ LDA #$8e
+0f0b : 85 0f __ STA P2
+0f0d : a9 21 __ LDA #$21
+0f0f : 85 10 __ STA P3
+0f11 : a5 63 __ LDA T13 + 0
+0f13 : 85 11 __ STA P4
+0f15 : a5 64 __ LDA T13 + 1
+0f17 : 85 12 __ STA P5
+0f19 : a5 65 __ LDA T13 + 2
+0f1b : 85 13 __ STA P6
+0f1d : a5 66 __ LDA T13 + 3
+0f1f : 85 14 __ STA P7
+0f21 : 20 a9 14 JSR $14a9 ; (nforml + 0)
+0f24 : a5 1b __ LDA ACCU + 0
+0f26 : 85 5d __ STA T1 + 0
+0f28 : a0 00 __ LDY #$00
+0f2a : b1 5f __ LDA (T2 + 0),y
+0f2c : 85 45 __ STA T5 + 0
+0f2e : e6 5f __ INC T2 + 0
+0f30 : d0 02 __ BNE $0f34
+0f32 : e6 60 __ INC T2 + 1
+0f34 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0f37 : a9 c0 __ LDA #$c0
+0f39 : 85 0d __ STA P0
+0f3b : a9 21 __ LDA #$21
+0f3d : 85 0e __ STA P1
+0f3f : a9 8e __ LDA #$8e
+0f41 : 85 0f __ STA P2
+0f43 : a9 21 __ LDA #$21
+0f45 : 85 10 __ STA P3
+0f47 : a5 63 __ LDA T13 + 0
+0f49 : 85 11 __ STA P4
+0f4b : a5 64 __ LDA T13 + 1
+0f4d : 85 12 __ STA P5
+0f4f : a5 65 __ LDA T13 + 2
+0f51 : 85 13 __ STA P6
+0f53 : a5 66 __ LDA T13 + 3
+0f55 : 85 14 __ STA P7
+0f57 : 20 a9 14 JSR $14a9 ; (nforml + 0)
+0f5a : a5 1b __ LDA ACCU + 0
+0f5c : 85 5d __ STA T1 + 0
+0f5e : a0 00 __ LDY #$00
+0f60 : b1 5f __ LDA (T2 + 0),y
+0f62 : 85 45 __ STA T5 + 0
+0f64 : e6 5f __ INC T2 + 0
+0f66 : d0 02 __ BNE $0f6a
+0f68 : e6 60 __ INC T2 + 1
+0f6a : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0f6d : a9 c0 __ LDA #$c0
+0f6f : 85 0d __ STA P0
+0f71 : a9 21 __ LDA #$21
+0f73 : 85 0e __ STA P1
+0f75 : a9 8e __ LDA #$8e
+0f77 : 85 0f __ STA P2
+0f79 : a9 21 __ LDA #$21
+0f7b : 85 10 __ STA P3
+0f7d : a5 63 __ LDA T13 + 0
+0f7f : 85 11 __ STA P4
+0f81 : a5 64 __ LDA T13 + 1
+0f83 : 85 12 __ STA P5
+0f85 : a5 65 __ LDA T13 + 2
+0f87 : 85 13 __ STA P6
+0f89 : a5 66 __ LDA T13 + 3
+0f8b : 85 14 __ STA P7
+0f8d : 20 a9 14 JSR $14a9 ; (nforml + 0)
+0f90 : a5 1b __ LDA ACCU + 0
+0f92 : 85 5d __ STA T1 + 0
+0f94 : a0 00 __ LDY #$00
+0f96 : b1 5f __ LDA (T2 + 0),y
+0f98 : 85 45 __ STA T5 + 0
+0f9a : e6 5f __ INC T2 + 0
+0f9c : d0 02 __ BNE $0fa0
+0f9e : e6 60 __ INC T2 + 1
+0fa0 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+0fa3 : a9 10 __ LDA #$10
+0fa5 : 8d c3 21 STA $21c3 ; (sframe + 53)
+0fa8 : a9 00 __ LDA #$00
+0faa : 8d c4 21 STA $21c4 ; (sframe + 54)
+0fad : a0 00 __ LDY #$00
+0faf : b1 61 __ LDA (T4 + 0),y
+0fb1 : 85 47 __ STA T6 + 0
+0fb3 : c8 __ __ INY
+0fb4 : b1 61 __ LDA (T4 + 0),y
+0fb6 : 85 48 __ STA T6 + 1
+0fb8 : 18 __ __ CLC
+0fb9 : a5 61 __ LDA T4 + 0
+0fbb : 69 02 __ ADC #$02
+0fbd : 85 61 __ STA T4 + 0
+0fbf : 90 02 __ BCC $0fc3
+0fc1 : e6 62 __ INC T4 + 1
+0fc3 : a9 0a __ LDA #$0a
+0fc5 : 85 5d __ STA T1 + 0
+0fc7 : a5 47 __ LDA T6 + 0
+0fc9 : 05 48 __ ORA T6 + 1
+0fcb : f0 03 __ BEQ $0fd0
+0fcd : 4c 9d 10 JMP $109d ; (printf + 1079)
+0fd0 : ad c2 21 LDA $21c2 ; (sframe + 52)
+0fd3 : c9 ff __ CMP #$ff
+0fd5 : d0 03 __ BNE $0fda
+0fd7 : 4c 8f 10 JMP $108f ; (printf + 1065)
+0fda : 38 __ __ SEC
+0fdb : a9 0a __ LDA #$0a
+0fdd : ed c2 21 SBC $21c2 ; (sframe + 52)
+0fe0 : 85 43 __ STA T3 + 0
+0fe2 : c5 5d __ CMP T1 + 0
+0fe4 : b0 0f __ BCS $0ff5
+0fe6 : c6 5d __ DEC T1 + 0
+0fe8 : a9 30 __ LDA #$30
+0fea : a4 5d __ LDY T1 + 0
+0fec : 99 8e 21 STA $218e,y ; (sframe + 0)
+0fef : a5 43 __ LDA T3 + 0
+0ff1 : c5 5d __ CMP T1 + 0
+0ff3 : 90 f1 __ BCC $0fe6
+0ff5 : ad c7 21 LDA $21c7 ; (sframe + 57)
+0ff8 : f0 29 __ BEQ $1023
+0ffa : ad c3 21 LDA $21c3 ; (sframe + 53)
+0ffd : 85 47 __ STA T6 + 0
+0fff : ad c4 21 LDA $21c4 ; (sframe + 54)
+1002 : d0 1f __ BNE $1023
+1004 : a5 47 __ LDA T6 + 0
+1006 : c9 10 __ CMP #$10
+1008 : d0 19 __ BNE $1023
+100a : 18 __ __ CLC
+100b : a5 5d __ LDA T1 + 0
+100d : 69 ff __ ADC #$ff
+100f : a8 __ __ TAY
+1010 : a9 58 __ LDA #$58
+1012 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1015 : 18 __ __ CLC
+1016 : a5 5d __ LDA T1 + 0
+1018 : 69 fe __ ADC #$fe
+101a : 85 5d __ STA T1 + 0
+101c : a9 30 __ LDA #$30
+101e : a4 5d __ LDY T1 + 0
+1020 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1023 : ad c5 21 LDA $21c5 ; (sframe + 55)
+1026 : f0 09 __ BEQ $1031
+1028 : c6 5d __ DEC T1 + 0
+102a : a9 2b __ LDA #$2b
+102c : a4 5d __ LDY T1 + 0
+102e : 99 8e 21 STA $218e,y ; (sframe + 0)
+1031 : 38 __ __ SEC
+1032 : a9 0a __ LDA #$0a
+1034 : ed c1 21 SBC $21c1 ; (sframe + 51)
+1037 : 85 47 __ STA T6 + 0
+1039 : a9 00 __ LDA #$00
+103b : e9 00 __ SBC #$00
+103d : 85 48 __ STA T6 + 1
+103f : ad c0 21 LDA $21c0 ; (sframe + 50)
+1042 : 85 43 __ STA T3 + 0
+1044 : a5 48 __ LDA T6 + 1
+1046 : 49 80 __ EOR #$80
+1048 : c9 80 __ CMP #$80
+104a : d0 04 __ BNE $1050
+104c : a5 47 __ LDA T6 + 0
+104e : c5 5d __ CMP T1 + 0
+1050 : 90 31 __ BCC $1083
+1052 : a9 00 __ LDA #$00
+1054 : 85 43 __ STA T3 + 0
+1056 : a5 5d __ LDA T1 + 0
+1058 : c9 0a __ CMP #$0a
+105a : b0 14 __ BCS $1070
+105c : a4 5d __ LDY T1 + 0
+105e : b9 8e 21 LDA $218e,y ; (sframe + 0)
+1061 : a4 43 __ LDY T3 + 0
+1063 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1066 : e6 43 __ INC T3 + 0
+1068 : e6 5d __ INC T1 + 0
+106a : a5 5d __ LDA T1 + 0
+106c : c9 0a __ CMP #$0a
+106e : 90 ec __ BCC $105c
+1070 : a0 00 __ LDY #$00
+1072 : b1 5f __ LDA (T2 + 0),y
+1074 : 85 45 __ STA T5 + 0
+1076 : e6 5f __ INC T2 + 0
+1078 : d0 02 __ BNE $107c
+107a : e6 60 __ INC T2 + 1
+107c : a5 43 __ LDA T3 + 0
+107e : 85 5d __ STA T1 + 0
+1080 : 4c e3 0c JMP $0ce3 ; (printf + 125)
+1083 : c6 5d __ DEC T1 + 0
+1085 : a5 43 __ LDA T3 + 0
+1087 : a4 5d __ LDY T1 + 0
+1089 : 99 8e 21 STA $218e,y ; (sframe + 0)
+108c : 4c 44 10 JMP $1044 ; (printf + 990)
+108f : a9 09 __ LDA #$09
+1091 : 85 43 __ STA T3 + 0
+1093 : c5 5d __ CMP T1 + 0
+1095 : b0 03 __ BCS $109a
+1097 : 4c e6 0f JMP $0fe6 ; (printf + 896)
+109a : 4c f5 0f JMP $0ff5 ; (printf + 911)
+109d : ad c3 21 LDA $21c3 ; (sframe + 53)
+10a0 : 85 4b __ STA T8 + 0
+10a2 : 85 4d __ STA T9 + 0
+10a4 : ad c4 21 LDA $21c4 ; (sframe + 54)
+10a7 : 85 4c __ STA T8 + 1
+10a9 : 85 4e __ STA T9 + 1
+10ab : a5 47 __ LDA T6 + 0
+10ad : 85 1b __ STA ACCU + 0
+10af : a5 48 __ LDA T6 + 1
+10b1 : 85 1c __ STA ACCU + 1
+10b3 : a5 4d __ LDA T9 + 0
+10b5 : 85 03 __ STA $03
+10b7 : a5 4e __ LDA T9 + 1
+10b9 : 85 04 __ STA $04
+10bb : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+10be : a5 06 __ LDA $06
+10c0 : 10 2e __ BPL $10f0
+10c2 : 18 __ __ CLC
+10c3 : a5 05 __ LDA $05
+10c5 : 69 30 __ ADC #$30
+10c7 : c6 5d __ DEC T1 + 0
+10c9 : a4 5d __ LDY T1 + 0
+10cb : 99 8e 21 STA $218e,y ; (sframe + 0)
+10ce : a5 47 __ LDA T6 + 0
+10d0 : 85 1b __ STA ACCU + 0
+10d2 : a5 48 __ LDA T6 + 1
+10d4 : 85 1c __ STA ACCU + 1
+10d6 : a5 4b __ LDA T8 + 0
+10d8 : 85 03 __ STA $03
+10da : a5 4c __ LDA T8 + 1
+10dc : 85 04 __ STA $04
+10de : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+10e1 : a5 1b __ LDA ACCU + 0
+10e3 : 85 47 __ STA T6 + 0
+10e5 : a5 1c __ LDA ACCU + 1
+10e7 : 85 48 __ STA T6 + 1
+10e9 : 05 1b __ ORA ACCU + 0
+10eb : d0 be __ BNE $10ab
+10ed : 4c d0 0f JMP $0fd0 ; (printf + 874)
+10f0 : d0 06 __ BNE $10f8
+10f2 : a5 05 __ LDA $05
+10f4 : c9 0a __ CMP #$0a
+10f6 : 90 ca __ BCC $10c2
+10f8 : 18 __ __ CLC
+10f9 : a5 05 __ LDA $05
+10fb : 69 37 __ ADC #$37
+10fd : 4c c7 10 JMP $10c7 ; (printf + 1121)
+1100 : a0 00 __ LDY #$00
+1102 : b1 61 __ LDA (T4 + 0),y
+1104 : 85 47 __ STA T6 + 0
+1106 : c8 __ __ INY
+1107 : b1 61 __ LDA (T4 + 0),y
+1109 : 85 48 __ STA T6 + 1
+110b : 18 __ __ CLC
+110c : a5 61 __ LDA T4 + 0
+110e : 69 02 __ ADC #$02
+1110 : 85 61 __ STA T4 + 0
+1112 : 90 02 __ BCC $1116
+1114 : e6 62 __ INC T4 + 1
+1116 : a9 0a __ LDA #$0a
+1118 : 85 5d __ STA T1 + 0
+111a : a5 47 __ LDA T6 + 0
+111c : 05 48 __ ORA T6 + 1
+111e : f0 03 __ BEQ $1123
+1120 : 4c e3 11 JMP $11e3 ; (printf + 1405)
+1123 : ad c2 21 LDA $21c2 ; (sframe + 52)
+1126 : c9 ff __ CMP #$ff
+1128 : d0 03 __ BNE $112d
+112a : 4c d5 11 JMP $11d5 ; (printf + 1391)
+112d : 38 __ __ SEC
+112e : a9 0a __ LDA #$0a
+1130 : ed c2 21 SBC $21c2 ; (sframe + 52)
+1133 : 85 43 __ STA T3 + 0
+1135 : c5 5d __ CMP T1 + 0
+1137 : b0 0f __ BCS $1148
+1139 : c6 5d __ DEC T1 + 0
+113b : a9 30 __ LDA #$30
+113d : a4 5d __ LDY T1 + 0
+113f : 99 8e 21 STA $218e,y ; (sframe + 0)
+1142 : a5 43 __ LDA T3 + 0
+1144 : c5 5d __ CMP T1 + 0
+1146 : 90 f1 __ BCC $1139
+1148 : ad c7 21 LDA $21c7 ; (sframe + 57)
+114b : f0 29 __ BEQ $1176
+114d : ad c3 21 LDA $21c3 ; (sframe + 53)
+1150 : 85 47 __ STA T6 + 0
+1152 : ad c4 21 LDA $21c4 ; (sframe + 54)
+1155 : d0 1f __ BNE $1176
+1157 : a5 47 __ LDA T6 + 0
+1159 : c9 10 __ CMP #$10
+115b : d0 19 __ BNE $1176
+115d : 18 __ __ CLC
+115e : a5 5d __ LDA T1 + 0
+1160 : 69 ff __ ADC #$ff
+1162 : a8 __ __ TAY
+1163 : a9 58 __ LDA #$58
+1165 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1168 : 18 __ __ CLC
+1169 : a5 5d __ LDA T1 + 0
+116b : 69 fe __ ADC #$fe
+116d : 85 5d __ STA T1 + 0
+116f : a9 30 __ LDA #$30
+1171 : a4 5d __ LDY T1 + 0
+1173 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1176 : ad c5 21 LDA $21c5 ; (sframe + 55)
+1179 : f0 09 __ BEQ $1184
+117b : c6 5d __ DEC T1 + 0
+117d : a9 2b __ LDA #$2b
+117f : a4 5d __ LDY T1 + 0
+1181 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1184 : 38 __ __ SEC
+1185 : a9 0a __ LDA #$0a
+1187 : ed c1 21 SBC $21c1 ; (sframe + 51)
+118a : 85 47 __ STA T6 + 0
+118c : a9 00 __ LDA #$00
+118e : e9 00 __ SBC #$00
+1190 : 85 48 __ STA T6 + 1
+1192 : ad c0 21 LDA $21c0 ; (sframe + 50)
+1195 : 85 43 __ STA T3 + 0
+1197 : a5 48 __ LDA T6 + 1
+1199 : 49 80 __ EOR #$80
+119b : c9 80 __ CMP #$80
+119d : d0 04 __ BNE $11a3
+119f : a5 47 __ LDA T6 + 0
+11a1 : c5 5d __ CMP T1 + 0
+11a3 : 90 24 __ BCC $11c9
+11a5 : a9 00 __ LDA #$00
+11a7 : 85 43 __ STA T3 + 0
+11a9 : a5 5d __ LDA T1 + 0
+11ab : c9 0a __ CMP #$0a
+11ad : 90 03 __ BCC $11b2
+11af : 4c 70 10 JMP $1070 ; (printf + 1034)
+11b2 : a4 5d __ LDY T1 + 0
+11b4 : b9 8e 21 LDA $218e,y ; (sframe + 0)
+11b7 : a4 43 __ LDY T3 + 0
+11b9 : 99 8e 21 STA $218e,y ; (sframe + 0)
+11bc : e6 43 __ INC T3 + 0
+11be : e6 5d __ INC T1 + 0
+11c0 : a5 5d __ LDA T1 + 0
+11c2 : c9 0a __ CMP #$0a
+11c4 : 90 ec __ BCC $11b2
+11c6 : 4c 70 10 JMP $1070 ; (printf + 1034)
+11c9 : c6 5d __ DEC T1 + 0
+11cb : a5 43 __ LDA T3 + 0
+11cd : a4 5d __ LDY T1 + 0
+11cf : 99 8e 21 STA $218e,y ; (sframe + 0)
+11d2 : 4c 97 11 JMP $1197 ; (printf + 1329)
+11d5 : a9 09 __ LDA #$09
+11d7 : 85 43 __ STA T3 + 0
+11d9 : c5 5d __ CMP T1 + 0
+11db : b0 03 __ BCS $11e0
+11dd : 4c 39 11 JMP $1139 ; (printf + 1235)
+11e0 : 4c 48 11 JMP $1148 ; (printf + 1250)
+11e3 : ad c3 21 LDA $21c3 ; (sframe + 53)
+11e6 : 85 4b __ STA T8 + 0
+11e8 : 85 4d __ STA T9 + 0
+11ea : ad c4 21 LDA $21c4 ; (sframe + 54)
+11ed : 85 4c __ STA T8 + 1
+11ef : 85 4e __ STA T9 + 1
+11f1 : a5 47 __ LDA T6 + 0
+11f3 : 85 1b __ STA ACCU + 0
+11f5 : a5 48 __ LDA T6 + 1
+11f7 : 85 1c __ STA ACCU + 1
+11f9 : a5 4d __ LDA T9 + 0
+11fb : 85 03 __ STA $03
+11fd : a5 4e __ LDA T9 + 1
+11ff : 85 04 __ STA $04
+1201 : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+1204 : a5 06 __ LDA $06
+1206 : 10 2e __ BPL $1236
+1208 : 18 __ __ CLC
+1209 : a5 05 __ LDA $05
+120b : 69 30 __ ADC #$30
+120d : c6 5d __ DEC T1 + 0
+120f : a4 5d __ LDY T1 + 0
+1211 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1214 : a5 47 __ LDA T6 + 0
+1216 : 85 1b __ STA ACCU + 0
+1218 : a5 48 __ LDA T6 + 1
+121a : 85 1c __ STA ACCU + 1
+121c : a5 4b __ LDA T8 + 0
+121e : 85 03 __ STA $03
+1220 : a5 4c __ LDA T8 + 1
+1222 : 85 04 __ STA $04
+1224 : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+1227 : a5 1b __ LDA ACCU + 0
+1229 : 85 47 __ STA T6 + 0
+122b : a5 1c __ LDA ACCU + 1
+122d : 85 48 __ STA T6 + 1
+122f : 05 1b __ ORA ACCU + 0
+1231 : d0 be __ BNE $11f1
+1233 : 4c 23 11 JMP $1123 ; (printf + 1213)
+1236 : d0 06 __ BNE $123e
+1238 : a5 05 __ LDA $05
+123a : c9 0a __ CMP #$0a
+123c : 90 ca __ BCC $1208
+123e : 18 __ __ CLC
+123f : a5 05 __ LDA $05
+1241 : 69 37 __ ADC #$37
+1243 : 4c 0d 12 JMP $120d ; (printf + 1447)
+1246 : a0 00 __ LDY #$00
+1248 : b1 61 __ LDA (T4 + 0),y
+124a : 85 47 __ STA T6 + 0
+124c : c8 __ __ INY
+124d : b1 61 __ LDA (T4 + 0),y
+124f : 85 48 __ STA T6 + 1
+1251 : 18 __ __ CLC
+1252 : a5 61 __ LDA T4 + 0
+1254 : 69 02 __ ADC #$02
+1256 : 85 61 __ STA T4 + 0
+1258 : 90 02 __ BCC $125c
+125a : e6 62 __ INC T4 + 1
+125c : a5 48 __ LDA T6 + 1
+125e : 10 03 __ BPL $1263
+1260 : 4c b8 13 JMP $13b8 ; (printf + 1874)
+1263 : a5 47 __ LDA T6 + 0
+1265 : 85 4b __ STA T8 + 0
+1267 : a5 48 __ LDA T6 + 1
+1269 : 85 4c __ STA T8 + 1
+126b : a9 00 __ LDA #$00
+126d : 85 5d __ STA T1 + 0
+126f : a9 0a __ LDA #$0a
+1271 : 85 43 __ STA T3 + 0
+1273 : a5 47 __ LDA T6 + 0
+1275 : 05 48 __ ORA T6 + 1
+1277 : f0 03 __ BEQ $127c
+1279 : 4c 55 13 JMP $1355 ; (printf + 1775)
+127c : ad c2 21 LDA $21c2 ; (sframe + 52)
+127f : c9 ff __ CMP #$ff
+1281 : d0 03 __ BNE $1286
+1283 : 4c 47 13 JMP $1347 ; (printf + 1761)
+1286 : 38 __ __ SEC
+1287 : a9 0a __ LDA #$0a
+1289 : ed c2 21 SBC $21c2 ; (sframe + 52)
+128c : 85 45 __ STA T5 + 0
+128e : c5 43 __ CMP T3 + 0
+1290 : b0 0f __ BCS $12a1
+1292 : c6 43 __ DEC T3 + 0
+1294 : a9 30 __ LDA #$30
+1296 : a4 43 __ LDY T3 + 0
+1298 : 99 8e 21 STA $218e,y ; (sframe + 0)
+129b : a5 45 __ LDA T5 + 0
+129d : c5 43 __ CMP T3 + 0
+129f : 90 f1 __ BCC $1292
+12a1 : ad c7 21 LDA $21c7 ; (sframe + 57)
+12a4 : f0 29 __ BEQ $12cf
+12a6 : ad c3 21 LDA $21c3 ; (sframe + 53)
+12a9 : 85 47 __ STA T6 + 0
+12ab : ad c4 21 LDA $21c4 ; (sframe + 54)
+12ae : d0 1f __ BNE $12cf
+12b0 : a5 47 __ LDA T6 + 0
+12b2 : c9 10 __ CMP #$10
+12b4 : d0 19 __ BNE $12cf
+12b6 : 18 __ __ CLC
+12b7 : a5 43 __ LDA T3 + 0
+12b9 : 69 ff __ ADC #$ff
+12bb : a8 __ __ TAY
+12bc : a9 58 __ LDA #$58
+12be : 99 8e 21 STA $218e,y ; (sframe + 0)
+12c1 : 18 __ __ CLC
+12c2 : a5 43 __ LDA T3 + 0
+12c4 : 69 fe __ ADC #$fe
+12c6 : 85 43 __ STA T3 + 0
+12c8 : a9 30 __ LDA #$30
+12ca : a4 43 __ LDY T3 + 0
+12cc : 99 8e 21 STA $218e,y ; (sframe + 0)
+12cf : a5 5d __ LDA T1 + 0
+12d1 : d0 68 __ BNE $133b
+12d3 : ad c5 21 LDA $21c5 ; (sframe + 55)
+12d6 : f0 09 __ BEQ $12e1
+12d8 : c6 43 __ DEC T3 + 0
+12da : a9 2b __ LDA #$2b
+12dc : a4 43 __ LDY T3 + 0
+12de : 99 8e 21 STA $218e,y ; (sframe + 0)
+12e1 : 38 __ __ SEC
+12e2 : a9 0a __ LDA #$0a
+12e4 : ed c1 21 SBC $21c1 ; (sframe + 51)
+12e7 : 85 47 __ STA T6 + 0
+12e9 : a9 00 __ LDA #$00
+12eb : e9 00 __ SBC #$00
+12ed : 85 48 __ STA T6 + 1
+12ef : ad c0 21 LDA $21c0 ; (sframe + 50)
+12f2 : 85 5d __ STA T1 + 0
+12f4 : a5 48 __ LDA T6 + 1
+12f6 : 49 80 __ EOR #$80
+12f8 : c9 80 __ CMP #$80
+12fa : d0 04 __ BNE $1300
+12fc : a5 47 __ LDA T6 + 0
+12fe : c5 43 __ CMP T3 + 0
+1300 : 90 2d __ BCC $132f
+1302 : a9 00 __ LDA #$00
+1304 : 85 5d __ STA T1 + 0
+1306 : a5 43 __ LDA T3 + 0
+1308 : c9 0a __ CMP #$0a
+130a : b0 14 __ BCS $1320
+130c : a4 43 __ LDY T3 + 0
+130e : b9 8e 21 LDA $218e,y ; (sframe + 0)
+1311 : a4 5d __ LDY T1 + 0
+1313 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1316 : e6 5d __ INC T1 + 0
+1318 : e6 43 __ INC T3 + 0
+131a : a5 43 __ LDA T3 + 0
+131c : c9 0a __ CMP #$0a
+131e : 90 ec __ BCC $130c
+1320 : a0 00 __ LDY #$00
+1322 : b1 5f __ LDA (T2 + 0),y
+1324 : 85 45 __ STA T5 + 0
+1326 : e6 5f __ INC T2 + 0
+1328 : d0 02 __ BNE $132c
+132a : e6 60 __ INC T2 + 1
+132c : 4c e3 0c JMP $0ce3 ; (printf + 125)
+132f : c6 43 __ DEC T3 + 0
+1331 : a5 5d __ LDA T1 + 0
+1333 : a4 43 __ LDY T3 + 0
+1335 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1338 : 4c f4 12 JMP $12f4 ; (printf + 1678)
+133b : c6 43 __ DEC T3 + 0
+133d : a9 2d __ LDA #$2d
+133f : a4 43 __ LDY T3 + 0
+1341 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1344 : 4c e1 12 JMP $12e1 ; (printf + 1659)
+1347 : a9 09 __ LDA #$09
+1349 : 85 45 __ STA T5 + 0
+134b : c5 43 __ CMP T3 + 0
+134d : b0 03 __ BCS $1352
+134f : 4c 92 12 JMP $1292 ; (printf + 1580)
+1352 : 4c a1 12 JMP $12a1 ; (printf + 1595)
+1355 : ad c3 21 LDA $21c3 ; (sframe + 53)
+1358 : 85 47 __ STA T6 + 0
+135a : 85 4d __ STA T9 + 0
+135c : ad c4 21 LDA $21c4 ; (sframe + 54)
+135f : 85 48 __ STA T6 + 1
+1361 : 85 4e __ STA T9 + 1
+1363 : a5 4b __ LDA T8 + 0
+1365 : 85 1b __ STA ACCU + 0
+1367 : a5 4c __ LDA T8 + 1
+1369 : 85 1c __ STA ACCU + 1
+136b : a5 4d __ LDA T9 + 0
+136d : 85 03 __ STA $03
+136f : a5 4e __ LDA T9 + 1
+1371 : 85 04 __ STA $04
+1373 : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+1376 : a5 06 __ LDA $06
+1378 : 10 2e __ BPL $13a8
+137a : 18 __ __ CLC
+137b : a5 05 __ LDA $05
+137d : 69 30 __ ADC #$30
+137f : c6 43 __ DEC T3 + 0
+1381 : a4 43 __ LDY T3 + 0
+1383 : 99 8e 21 STA $218e,y ; (sframe + 0)
+1386 : a5 4b __ LDA T8 + 0
+1388 : 85 1b __ STA ACCU + 0
+138a : a5 4c __ LDA T8 + 1
+138c : 85 1c __ STA ACCU + 1
+138e : a5 47 __ LDA T6 + 0
+1390 : 85 03 __ STA $03
+1392 : a5 48 __ LDA T6 + 1
+1394 : 85 04 __ STA $04
+1396 : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+1399 : a5 1b __ LDA ACCU + 0
+139b : 85 4b __ STA T8 + 0
+139d : a5 1c __ LDA ACCU + 1
+139f : 85 4c __ STA T8 + 1
+13a1 : 05 1b __ ORA ACCU + 0
+13a3 : d0 be __ BNE $1363
+13a5 : 4c 7c 12 JMP $127c ; (printf + 1558)
+13a8 : d0 06 __ BNE $13b0
+13aa : a5 05 __ LDA $05
+13ac : c9 0a __ CMP #$0a
+13ae : 90 ca __ BCC $137a
+13b0 : 18 __ __ CLC
+13b1 : a5 05 __ LDA $05
+13b3 : 69 37 __ ADC #$37
+13b5 : 4c 7f 13 JMP $137f ; (printf + 1817)
+13b8 : a9 01 __ LDA #$01
+13ba : 85 5d __ STA T1 + 0
+13bc : a9 0a __ LDA #$0a
+13be : 85 43 __ STA T3 + 0
+13c0 : 38 __ __ SEC
+13c1 : a9 00 __ LDA #$00
+13c3 : e5 47 __ SBC T6 + 0
+13c5 : 85 4b __ STA T8 + 0
+13c7 : a9 00 __ LDA #$00
+13c9 : e5 48 __ SBC T6 + 1
+13cb : 85 4c __ STA T8 + 1
+13cd : 05 4b __ ORA T8 + 0
+13cf : d0 84 __ BNE $1355
+13d1 : 4c 7c 12 JMP $127c ; (printf + 1558)
+13d4 : a9 00 __ LDA #$00
+13d6 : 85 47 __ STA T6 + 0
+13d8 : 85 48 __ STA T6 + 1
+13da : a0 00 __ LDY #$00
+13dc : b1 5f __ LDA (T2 + 0),y
+13de : 85 43 __ STA T3 + 0
+13e0 : e6 5f __ INC T2 + 0
+13e2 : d0 02 __ BNE $13e6
+13e4 : e6 60 __ INC T2 + 1
+13e6 : a5 43 __ LDA T3 + 0
+13e8 : c9 30 __ CMP #$30
+13ea : 90 4d __ BCC $1439
+13ec : a9 39 __ LDA #$39
+13ee : c5 43 __ CMP T3 + 0
+13f0 : 90 47 __ BCC $1439
+13f2 : a5 43 __ LDA T3 + 0
+13f4 : 85 49 __ STA T7 + 0
+13f6 : a0 00 __ LDY #$00
+13f8 : b1 5f __ LDA (T2 + 0),y
+13fa : 85 43 __ STA T3 + 0
+13fc : e6 5f __ INC T2 + 0
+13fe : d0 02 __ BNE $1402
+1400 : e6 60 __ INC T2 + 1
+1402 : a5 47 __ LDA T6 + 0
+1404 : 0a __ __ ASL
+1405 : 85 07 __ STA $07
+1407 : a5 48 __ LDA T6 + 1
+1409 : 2a __ __ ROL
+140a : 06 07 __ ASL $07
+140c : 2a __ __ ROL
+140d : aa __ __ TAX
+140e : 18 __ __ CLC
+140f : a5 07 __ LDA $07
+1411 : 65 47 __ ADC T6 + 0
+1413 : 85 1b __ STA ACCU + 0
+1415 : 8a __ __ TXA
+1416 : 65 48 __ ADC T6 + 1
+1418 : 06 1b __ ASL ACCU + 0
+141a : 2a __ __ ROL
+141b : 85 1c __ STA ACCU + 1
+141d : 18 __ __ CLC
+141e : a5 1b __ LDA ACCU + 0
+1420 : 65 49 __ ADC T7 + 0
+1422 : aa __ __ TAX
+1423 : a5 1c __ LDA ACCU + 1
+1425 : 69 00 __ ADC #$00
+1427 : a8 __ __ TAY
+1428 : 38 __ __ SEC
+1429 : 8a __ __ TXA
+142a : e9 30 __ SBC #$30
+142c : 85 47 __ STA T6 + 0
+142e : 98 __ __ TYA
+142f : e9 00 __ SBC #$00
+1431 : 85 48 __ STA T6 + 1
+1433 : a5 43 __ LDA T3 + 0
+1435 : c9 30 __ CMP #$30
+1437 : b0 b3 __ BCS $13ec
+1439 : a5 47 __ LDA T6 + 0
+143b : 8d c2 21 STA $21c2 ; (sframe + 52)
+143e : 4c d5 0d JMP $0dd5 ; (printf + 367)
+1441 : a9 01 __ LDA #$01
+1443 : 8d c7 21 STA $21c7 ; (sframe + 57)
+1446 : a0 00 __ LDY #$00
+1448 : b1 5f __ LDA (T2 + 0),y
+144a : 85 43 __ STA T3 + 0
+144c : 4c 47 0d JMP $0d47 ; (printf + 225)
+144f : a9 30 __ LDA #$30
+1451 : 8d c0 21 STA $21c0 ; (sframe + 50)
+1454 : a0 00 __ LDY #$00
+1456 : b1 5f __ LDA (T2 + 0),y
+1458 : 85 43 __ STA T3 + 0
+145a : 4c 47 0d JMP $0d47 ; (printf + 225)
+145d : a9 01 __ LDA #$01
+145f : 8d c5 21 STA $21c5 ; (sframe + 55)
+1462 : a0 00 __ LDY #$00
+1464 : b1 5f __ LDA (T2 + 0),y
+1466 : 85 43 __ STA T3 + 0
+1468 : 4c 47 0d JMP $0d47 ; (printf + 225)
+--------------------------------------------------------------------
+puts:
+146b : a0 00 __ LDY #$00
+146d : b1 0d __ LDA (P0),y
+146f : f0 0b __ BEQ $147c
+1471 : 20 7d 14 JSR $147d ; (putpch + 0)
+1474 : e6 0d __ INC P0
+1476 : d0 f3 __ BNE $146b
+1478 : e6 0e __ INC P1
+147a : d0 ef __ BNE $146b
+147c : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+147d : ae 85 21 LDX $2185 ; (giocharmap + 0)
+1480 : e0 01 __ CPX #$01
+1482 : 90 22 __ BCC $14a6
+1484 : c9 0a __ CMP #$0a
+1486 : d0 02 __ BNE $148a
+1488 : a9 0d __ LDA #$0d
+148a : e0 02 __ CPX #$02
+148c : 90 18 __ BCC $14a6
+148e : c9 41 __ CMP #$41
+1490 : 90 14 __ BCC $14a6
+1492 : c9 7b __ CMP #$7b
+1494 : b0 10 __ BCS $14a6
+1496 : c9 61 __ CMP #$61
+1498 : b0 04 __ BCS $149e
+149a : c9 5b __ CMP #$5b
+149c : b0 08 __ BCS $14a6
+149e : 49 20 __ EOR #$20
+14a0 : e0 03 __ CPX #$03
+14a2 : f0 02 __ BEQ $14a6
+14a4 : 29 df __ AND #$df
+14a6 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+14a9 : a5 11 __ LDA P4
+14ab : 85 47 __ STA T1 + 0
+14ad : a5 12 __ LDA P5
+14af : 85 48 __ STA T1 + 1
+14b1 : a5 13 __ LDA P6
+14b3 : 85 49 __ STA T1 + 2
+14b5 : a5 14 __ LDA P7
+14b7 : 85 4a __ STA T1 + 3
+14b9 : a9 00 __ LDA #$00
+14bb : 85 4d __ STA T3 + 0
+14bd : a5 15 __ LDA P8
+14bf : f0 03 __ BEQ $14c4
+14c1 : 4c 50 16 JMP $1650 ; (nforml + 423)
+14c4 : a9 10 __ LDA #$10
+14c6 : 85 4e __ STA T4 + 0
+14c8 : a9 00 __ LDA #$00
+14ca : c5 14 __ CMP P7
+14cc : d0 0a __ BNE $14d8
+14ce : c5 13 __ CMP P6
+14d0 : d0 06 __ BNE $14d8
+14d2 : c5 12 __ CMP P5
+14d4 : d0 02 __ BNE $14d8
+14d6 : c5 11 __ CMP P4
+14d8 : b0 03 __ BCS $14dd
+14da : 4c c4 15 JMP $15c4 ; (nforml + 283)
+14dd : a0 02 __ LDY #$02
+14df : b1 0d __ LDA (P0),y
+14e1 : 85 4f __ STA T5 + 0
+14e3 : c9 ff __ CMP #$ff
+14e5 : d0 03 __ BNE $14ea
+14e7 : 4c b6 15 JMP $15b6 ; (nforml + 269)
+14ea : 38 __ __ SEC
+14eb : a9 10 __ LDA #$10
+14ed : e5 4f __ SBC T5 + 0
+14ef : 85 4f __ STA T5 + 0
+14f1 : c5 4e __ CMP T4 + 0
+14f3 : b0 0e __ BCS $1503
+14f5 : c6 4e __ DEC T4 + 0
+14f7 : a9 30 __ LDA #$30
+14f9 : a4 4e __ LDY T4 + 0
+14fb : 91 0f __ STA (P2),y
+14fd : a5 4f __ LDA T5 + 0
+14ff : c5 4e __ CMP T4 + 0
+1501 : 90 f2 __ BCC $14f5
+1503 : a0 07 __ LDY #$07
+1505 : b1 0d __ LDA (P0),y
+1507 : f0 34 __ BEQ $153d
+1509 : a0 03 __ LDY #$03
+150b : b1 0d __ LDA (P0),y
+150d : 85 53 __ STA T7 + 0
+150f : c8 __ __ INY
+1510 : b1 0d __ LDA (P0),y
+1512 : d0 29 __ BNE $153d
+1514 : a5 53 __ LDA T7 + 0
+1516 : c9 10 __ CMP #$10
+1518 : d0 23 __ BNE $153d
+151a : 18 __ __ CLC
+151b : a5 4e __ LDA T4 + 0
+151d : 69 ff __ ADC #$ff
+151f : 18 __ __ CLC
+1520 : 65 0f __ ADC P2
+1522 : 85 53 __ STA T7 + 0
+1524 : a5 10 __ LDA P3
+1526 : 69 00 __ ADC #$00
+1528 : 85 54 __ STA T7 + 1
+152a : a9 58 __ LDA #$58
+152c : a0 00 __ LDY #$00
+152e : 91 53 __ STA (T7 + 0),y
+1530 : 18 __ __ CLC
+1531 : a5 4e __ LDA T4 + 0
+1533 : 69 fe __ ADC #$fe
+1535 : 85 4e __ STA T4 + 0
+1537 : a9 30 __ LDA #$30
+1539 : a4 4e __ LDY T4 + 0
+153b : 91 0f __ STA (P2),y
+153d : a5 4d __ LDA T3 + 0
+153f : d0 6a __ BNE $15ab
+1541 : a0 05 __ LDY #$05
+1543 : b1 0d __ LDA (P0),y
+1545 : f0 08 __ BEQ $154f
+1547 : c6 4e __ DEC T4 + 0
+1549 : a9 2b __ LDA #$2b
+154b : a4 4e __ LDY T4 + 0
+154d : 91 0f __ STA (P2),y
+154f : a0 01 __ LDY #$01
+1551 : b1 0d __ LDA (P0),y
+1553 : 85 53 __ STA T7 + 0
+1555 : 38 __ __ SEC
+1556 : a9 10 __ LDA #$10
+1558 : e5 53 __ SBC T7 + 0
+155a : 85 53 __ STA T7 + 0
+155c : a9 00 __ LDA #$00
+155e : e9 00 __ SBC #$00
+1560 : 49 80 __ EOR #$80
+1562 : c9 80 __ CMP #$80
+1564 : d0 04 __ BNE $156a
+1566 : a5 53 __ LDA T7 + 0
+1568 : c5 4e __ CMP T4 + 0
+156a : 90 32 __ BCC $159e
+156c : a9 00 __ LDA #$00
+156e : 85 4d __ STA T3 + 0
+1570 : a5 4e __ LDA T4 + 0
+1572 : c9 10 __ CMP #$10
+1574 : 90 09 __ BCC $157f
+1576 : a5 4d __ LDA T3 + 0
+1578 : 85 1b __ STA ACCU + 0
+157a : a9 00 __ LDA #$00
+157c : 85 1c __ STA ACCU + 1
+157e : 60 __ __ RTS
+157f : aa __ __ TAX
+1580 : 8a __ __ TXA
+1581 : 18 __ __ CLC
+1582 : 65 0f __ ADC P2
+1584 : 85 51 __ STA T6 + 0
+1586 : a5 10 __ LDA P3
+1588 : 69 00 __ ADC #$00
+158a : 85 52 __ STA T6 + 1
+158c : a0 00 __ LDY #$00
+158e : b1 51 __ LDA (T6 + 0),y
+1590 : a4 4d __ LDY T3 + 0
+1592 : 91 0f __ STA (P2),y
+1594 : e6 4d __ INC T3 + 0
+1596 : e8 __ __ INX
+1597 : e0 10 __ CPX #$10
+1599 : 90 e5 __ BCC $1580
+159b : 4c 76 15 JMP $1576 ; (nforml + 205)
+159e : c6 4e __ DEC T4 + 0
+15a0 : a0 00 __ LDY #$00
+15a2 : b1 0d __ LDA (P0),y
+15a4 : a4 4e __ LDY T4 + 0
+15a6 : 91 0f __ STA (P2),y
+15a8 : 4c 4f 15 JMP $154f ; (nforml + 166)
+15ab : c6 4e __ DEC T4 + 0
+15ad : a9 2d __ LDA #$2d
+15af : a4 4e __ LDY T4 + 0
+15b1 : 91 0f __ STA (P2),y
+15b3 : 4c 4f 15 JMP $154f ; (nforml + 166)
+15b6 : a9 0f __ LDA #$0f
+15b8 : 85 4f __ STA T5 + 0
+15ba : c5 4e __ CMP T4 + 0
+15bc : b0 03 __ BCS $15c1
+15be : 4c f5 14 JMP $14f5 ; (nforml + 76)
+15c1 : 4c 03 15 JMP $1503 ; (nforml + 90)
+15c4 : a0 03 __ LDY #$03
+15c6 : b1 0d __ LDA (P0),y
+15c8 : 85 03 __ STA $03
+15ca : c8 __ __ INY
+15cb : b1 0d __ LDA (P0),y
+15cd : 85 04 __ STA $04
+15cf : a9 00 __ LDA #$00
+15d1 : 85 05 __ STA $05
+15d3 : 85 06 __ STA $06
+15d5 : a5 47 __ LDA T1 + 0
+15d7 : 85 1b __ STA ACCU + 0
+15d9 : a5 48 __ LDA T1 + 1
+15db : 85 1c __ STA ACCU + 1
+15dd : a5 49 __ LDA T1 + 2
+15df : 85 1d __ STA ACCU + 2
+15e1 : a5 4a __ LDA T1 + 3
+15e3 : 85 1e __ STA ACCU + 3
+15e5 : 20 2d 21 JSR $212d ; (divmod32 + 0)
+15e8 : a5 08 __ LDA $08
+15ea : 10 54 __ BPL $1640
+15ec : 18 __ __ CLC
+15ed : a5 07 __ LDA $07
+15ef : 69 30 __ ADC #$30
+15f1 : c6 4e __ DEC T4 + 0
+15f3 : a4 4e __ LDY T4 + 0
+15f5 : 91 0f __ STA (P2),y
+15f7 : a0 03 __ LDY #$03
+15f9 : b1 0d __ LDA (P0),y
+15fb : 85 03 __ STA $03
+15fd : c8 __ __ INY
+15fe : b1 0d __ LDA (P0),y
+1600 : 85 04 __ STA $04
+1602 : a9 00 __ LDA #$00
+1604 : 85 05 __ STA $05
+1606 : 85 06 __ STA $06
+1608 : a5 47 __ LDA T1 + 0
+160a : 85 1b __ STA ACCU + 0
+160c : a5 48 __ LDA T1 + 1
+160e : 85 1c __ STA ACCU + 1
+1610 : a5 49 __ LDA T1 + 2
+1612 : 85 1d __ STA ACCU + 2
+1614 : a5 4a __ LDA T1 + 3
+1616 : 85 1e __ STA ACCU + 3
+1618 : 20 2d 21 JSR $212d ; (divmod32 + 0)
+161b : a5 1b __ LDA ACCU + 0
+161d : 85 47 __ STA T1 + 0
+161f : a5 1c __ LDA ACCU + 1
+1621 : 85 48 __ STA T1 + 1
+1623 : a5 1d __ LDA ACCU + 2
+1625 : 85 49 __ STA T1 + 2
+1627 : a5 1e __ LDA ACCU + 3
+1629 : 85 4a __ STA T1 + 3
+162b : a9 00 __ LDA #$00
+162d : c5 1e __ CMP ACCU + 3
+162f : d0 0a __ BNE $163b
+1631 : c5 1d __ CMP ACCU + 2
+1633 : d0 06 __ BNE $163b
+1635 : c5 1c __ CMP ACCU + 1
+1637 : d0 02 __ BNE $163b
+1639 : c5 1b __ CMP ACCU + 0
+163b : 90 87 __ BCC $15c4
+163d : 4c dd 14 JMP $14dd ; (nforml + 52)
+1640 : d0 06 __ BNE $1648
+1642 : a5 07 __ LDA $07
+1644 : c9 0a __ CMP #$0a
+1646 : 90 a4 __ BCC $15ec
+1648 : 18 __ __ CLC
+1649 : a5 07 __ LDA $07
+164b : 69 37 __ ADC #$37
+164d : 4c f1 15 JMP $15f1 ; (nforml + 328)
+1650 : a5 14 __ LDA P7
+1652 : 49 80 __ EOR #$80
+1654 : c9 80 __ CMP #$80
+1656 : d0 0f __ BNE $1667
+1658 : a5 13 __ LDA P6
+165a : c9 00 __ CMP #$00
+165c : d0 09 __ BNE $1667
+165e : a5 12 __ LDA P5
+1660 : c9 00 __ CMP #$00
+1662 : d0 03 __ BNE $1667
+1664 : 4c c4 14 JMP $14c4 ; (nforml + 27)
+1667 : 90 03 __ BCC $166c
+1669 : 4c c4 14 JMP $14c4 ; (nforml + 27)
+166c : a9 01 __ LDA #$01
+166e : 85 4d __ STA T3 + 0
+1670 : a9 10 __ LDA #$10
+1672 : 85 4e __ STA T4 + 0
+1674 : 38 __ __ SEC
+1675 : a9 00 __ LDA #$00
+1677 : e5 11 __ SBC P4
+1679 : 85 47 __ STA T1 + 0
+167b : a9 00 __ LDA #$00
+167d : e5 12 __ SBC P5
+167f : 85 48 __ STA T1 + 1
+1681 : a9 00 __ LDA #$00
+1683 : e5 13 __ SBC P6
+1685 : 85 49 __ STA T1 + 2
+1687 : a9 00 __ LDA #$00
+1689 : e5 14 __ SBC P7
+168b : 85 4a __ STA T1 + 3
+168d : a9 00 __ LDA #$00
+168f : c5 4a __ CMP T1 + 3
+1691 : d0 0a __ BNE $169d
+1693 : c5 49 __ CMP T1 + 2
+1695 : d0 06 __ BNE $169d
+1697 : c5 48 __ CMP T1 + 1
+1699 : d0 02 __ BNE $169d
+169b : c5 47 __ CMP T1 + 0
+169d : b0 03 __ BCS $16a2
+169f : 4c c4 15 JMP $15c4 ; (nforml + 283)
+16a2 : 4c dd 14 JMP $14dd ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+16a5 : a9 00 __ LDA #$00
+16a7 : 85 1b __ STA ACCU + 0
+16a9 : 85 1c __ STA ACCU + 1
+16ab : 85 1d __ STA ACCU + 2
+16ad : 85 1e __ STA ACCU + 3
+16af : a5 11 __ LDA P4
+16b1 : 85 03 __ STA $03
+16b3 : a5 12 __ LDA P5
+16b5 : 85 04 __ STA $04
+16b7 : a5 13 __ LDA P6
+16b9 : 85 05 __ STA $05
+16bb : a5 14 __ LDA P7
+16bd : 85 06 __ STA $06
+16bf : 20 dc 20 JSR $20dc ; (fcmp + 0)
+16c2 : 10 03 __ BPL $16c7
+16c4 : 4c df 1c JMP $1cdf ; (nformf + 1594)
+16c7 : a9 00 __ LDA #$00
+16c9 : 85 4b __ STA T3 + 0
+16cb : a0 05 __ LDY #$05
+16cd : b1 0d __ LDA (P0),y
+16cf : f0 0a __ BEQ $16db
+16d1 : a9 2b __ LDA #$2b
+16d3 : a0 00 __ LDY #$00
+16d5 : 91 0f __ STA (P2),y
+16d7 : a9 01 __ LDA #$01
+16d9 : 85 4b __ STA T3 + 0
+16db : a9 00 __ LDA #$00
+16dd : 85 43 __ STA T0 + 0
+16df : 85 44 __ STA T0 + 1
+16e1 : a0 02 __ LDY #$02
+16e3 : b1 0d __ LDA (P0),y
+16e5 : 85 4e __ STA T5 + 0
+16e7 : c9 ff __ CMP #$ff
+16e9 : d0 04 __ BNE $16ef
+16eb : a9 06 __ LDA #$06
+16ed : 85 4e __ STA T5 + 0
+16ef : a9 00 __ LDA #$00
+16f1 : 85 1b __ STA ACCU + 0
+16f3 : 85 1c __ STA ACCU + 1
+16f5 : 85 1d __ STA ACCU + 2
+16f7 : 85 1e __ STA ACCU + 3
+16f9 : a5 11 __ LDA P4
+16fb : 85 03 __ STA $03
+16fd : a5 12 __ LDA P5
+16ff : 85 04 __ STA $04
+1701 : a5 13 __ LDA P6
+1703 : 85 05 __ STA $05
+1705 : a5 14 __ LDA P7
+1707 : 85 06 __ STA $06
+1709 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+170c : d0 03 __ BNE $1711
+170e : 4c 95 18 JMP $1895 ; (nformf + 496)
+1711 : a9 00 __ LDA #$00
+1713 : 85 1b __ STA ACCU + 0
+1715 : 85 1c __ STA ACCU + 1
+1717 : a9 7a __ LDA #$7a
+1719 : 85 1d __ STA ACCU + 2
+171b : a9 44 __ LDA #$44
+171d : 85 1e __ STA ACCU + 3
+171f : a5 11 __ LDA P4
+1721 : 85 03 __ STA $03
+1723 : a5 12 __ LDA P5
+1725 : 85 04 __ STA $04
+1727 : a5 13 __ LDA P6
+1729 : 85 05 __ STA $05
+172b : a5 14 __ LDA P7
+172d : 85 06 __ STA $06
+172f : 20 dc 20 JSR $20dc ; (fcmp + 0)
+1732 : 30 5a __ BMI $178e
+1734 : a5 11 __ LDA P4
+1736 : 85 1b __ STA ACCU + 0
+1738 : a5 12 __ LDA P5
+173a : 85 1c __ STA ACCU + 1
+173c : a5 13 __ LDA P6
+173e : 85 1d __ STA ACCU + 2
+1740 : a5 14 __ LDA P7
+1742 : 85 1e __ STA ACCU + 3
+1744 : a9 00 __ LDA #$00
+1746 : 85 03 __ STA $03
+1748 : 85 04 __ STA $04
+174a : a9 7a __ LDA #$7a
+174c : 85 05 __ STA $05
+174e : a9 44 __ LDA #$44
+1750 : 85 06 __ STA $06
+1752 : 20 52 1d JSR $1d52 ; (freg + 20)
+1755 : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1758 : a5 1b __ LDA ACCU + 0
+175a : 85 11 __ STA P4
+175c : 85 03 __ STA $03
+175e : a5 1c __ LDA ACCU + 1
+1760 : 85 12 __ STA P5
+1762 : 85 04 __ STA $04
+1764 : a5 1d __ LDA ACCU + 2
+1766 : 85 13 __ STA P6
+1768 : 85 05 __ STA $05
+176a : a5 1e __ LDA ACCU + 3
+176c : 85 14 __ STA P7
+176e : 85 06 __ STA $06
+1770 : 18 __ __ CLC
+1771 : a5 43 __ LDA T0 + 0
+1773 : 69 03 __ ADC #$03
+1775 : 85 43 __ STA T0 + 0
+1777 : 90 02 __ BCC $177b
+1779 : e6 44 __ INC T0 + 1
+177b : a9 00 __ LDA #$00
+177d : 85 1b __ STA ACCU + 0
+177f : 85 1c __ STA ACCU + 1
+1781 : a9 7a __ LDA #$7a
+1783 : 85 1d __ STA ACCU + 2
+1785 : a9 44 __ LDA #$44
+1787 : 85 1e __ STA ACCU + 3
+1789 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+178c : 10 a6 __ BPL $1734
+178e : a9 00 __ LDA #$00
+1790 : 85 1b __ STA ACCU + 0
+1792 : 85 1c __ STA ACCU + 1
+1794 : a9 80 __ LDA #$80
+1796 : 85 1d __ STA ACCU + 2
+1798 : a9 3f __ LDA #$3f
+179a : 85 1e __ STA ACCU + 3
+179c : a5 11 __ LDA P4
+179e : 85 03 __ STA $03
+17a0 : a5 12 __ LDA P5
+17a2 : 85 04 __ STA $04
+17a4 : a5 13 __ LDA P6
+17a6 : 85 05 __ STA $05
+17a8 : a5 14 __ LDA P7
+17aa : 85 06 __ STA $06
+17ac : 20 dc 20 JSR $20dc ; (fcmp + 0)
+17af : 10 5c __ BPL $180d
+17b1 : a5 11 __ LDA P4
+17b3 : 85 1b __ STA ACCU + 0
+17b5 : a5 12 __ LDA P5
+17b7 : 85 1c __ STA ACCU + 1
+17b9 : a5 13 __ LDA P6
+17bb : 85 1d __ STA ACCU + 2
+17bd : a5 14 __ LDA P7
+17bf : 85 1e __ STA ACCU + 3
+17c1 : a9 00 __ LDA #$00
+17c3 : 85 03 __ STA $03
+17c5 : 85 04 __ STA $04
+17c7 : a9 7a __ LDA #$7a
+17c9 : 85 05 __ STA $05
+17cb : a9 44 __ LDA #$44
+17cd : 85 06 __ STA $06
+17cf : 20 52 1d JSR $1d52 ; (freg + 20)
+17d2 : 20 4b 1e JSR $1e4b ; (fmul + 0)
+17d5 : a5 1b __ LDA ACCU + 0
+17d7 : 85 11 __ STA P4
+17d9 : 85 03 __ STA $03
+17db : a5 1c __ LDA ACCU + 1
+17dd : 85 12 __ STA P5
+17df : 85 04 __ STA $04
+17e1 : a5 1d __ LDA ACCU + 2
+17e3 : 85 13 __ STA P6
+17e5 : 85 05 __ STA $05
+17e7 : a5 1e __ LDA ACCU + 3
+17e9 : 85 14 __ STA P7
+17eb : 85 06 __ STA $06
+17ed : 38 __ __ SEC
+17ee : a5 43 __ LDA T0 + 0
+17f0 : e9 03 __ SBC #$03
+17f2 : 85 43 __ STA T0 + 0
+17f4 : a5 44 __ LDA T0 + 1
+17f6 : e9 00 __ SBC #$00
+17f8 : 85 44 __ STA T0 + 1
+17fa : a9 00 __ LDA #$00
+17fc : 85 1b __ STA ACCU + 0
+17fe : 85 1c __ STA ACCU + 1
+1800 : a9 80 __ LDA #$80
+1802 : 85 1d __ STA ACCU + 2
+1804 : a9 3f __ LDA #$3f
+1806 : 85 1e __ STA ACCU + 3
+1808 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+180b : 30 a4 __ BMI $17b1
+180d : a9 00 __ LDA #$00
+180f : 85 1b __ STA ACCU + 0
+1811 : 85 1c __ STA ACCU + 1
+1813 : a9 20 __ LDA #$20
+1815 : 85 1d __ STA ACCU + 2
+1817 : a9 41 __ LDA #$41
+1819 : 85 1e __ STA ACCU + 3
+181b : a5 11 __ LDA P4
+181d : 85 03 __ STA $03
+181f : a5 12 __ LDA P5
+1821 : 85 04 __ STA $04
+1823 : a5 13 __ LDA P6
+1825 : 85 05 __ STA $05
+1827 : a5 14 __ LDA P7
+1829 : 85 06 __ STA $06
+182b : 20 dc 20 JSR $20dc ; (fcmp + 0)
+182e : 30 65 __ BMI $1895
+1830 : a5 11 __ LDA P4
+1832 : 85 1b __ STA ACCU + 0
+1834 : a5 12 __ LDA P5
+1836 : 85 1c __ STA ACCU + 1
+1838 : a5 13 __ LDA P6
+183a : 85 1d __ STA ACCU + 2
+183c : a5 14 __ LDA P7
+183e : 85 1e __ STA ACCU + 3
+1840 : a9 00 __ LDA #$00
+1842 : 85 03 __ STA $03
+1844 : 85 04 __ STA $04
+1846 : a9 20 __ LDA #$20
+1848 : 85 05 __ STA $05
+184a : a9 41 __ LDA #$41
+184c : 85 06 __ STA $06
+184e : 20 52 1d JSR $1d52 ; (freg + 20)
+1851 : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1854 : a5 1b __ LDA ACCU + 0
+1856 : 85 11 __ STA P4
+1858 : 85 47 __ STA T2 + 0
+185a : a5 1c __ LDA ACCU + 1
+185c : 85 12 __ STA P5
+185e : 85 48 __ STA T2 + 1
+1860 : a5 1d __ LDA ACCU + 2
+1862 : 85 13 __ STA P6
+1864 : 85 49 __ STA T2 + 2
+1866 : a5 1e __ LDA ACCU + 3
+1868 : 85 14 __ STA P7
+186a : 85 4a __ STA T2 + 3
+186c : e6 43 __ INC T0 + 0
+186e : d0 02 __ BNE $1872
+1870 : e6 44 __ INC T0 + 1
+1872 : a9 00 __ LDA #$00
+1874 : 85 1b __ STA ACCU + 0
+1876 : 85 1c __ STA ACCU + 1
+1878 : a9 20 __ LDA #$20
+187a : 85 1d __ STA ACCU + 2
+187c : a9 41 __ LDA #$41
+187e : 85 1e __ STA ACCU + 3
+1880 : a5 47 __ LDA T2 + 0
+1882 : 85 03 __ STA $03
+1884 : a5 48 __ LDA T2 + 1
+1886 : 85 04 __ STA $04
+1888 : a5 49 __ LDA T2 + 2
+188a : 85 05 __ STA $05
+188c : a5 4a __ LDA T2 + 3
+188e : 85 06 __ STA $06
+1890 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+1893 : 10 9b __ BPL $1830
+1895 : a5 15 __ LDA P8
+1897 : c9 65 __ CMP #$65
+1899 : d0 03 __ BNE $189e
+189b : 4c da 1c JMP $1cda ; (nformf + 1589)
+189e : a9 00 __ LDA #$00
+18a0 : 85 51 __ STA T7 + 0
+18a2 : 85 52 __ STA T8 + 0
+18a4 : a5 4e __ LDA T5 + 0
+18a6 : 85 4c __ STA T4 + 0
+18a8 : e6 4c __ INC T4 + 0
+18aa : a5 15 __ LDA P8
+18ac : c9 67 __ CMP #$67
+18ae : d0 03 __ BNE $18b3
+18b0 : 4c bd 1c JMP $1cbd ; (nformf + 1560)
+18b3 : a5 51 __ LDA T7 + 0
+18b5 : f0 03 __ BEQ $18ba
+18b7 : 4c cb 1b JMP $1bcb ; (nformf + 1318)
+18ba : a5 44 __ LDA T0 + 1
+18bc : 10 03 __ BPL $18c1
+18be : 4c 8a 1b JMP $1b8a ; (nformf + 1253)
+18c1 : a9 00 __ LDA #$00
+18c3 : 85 47 __ STA T2 + 0
+18c5 : 85 48 __ STA T2 + 1
+18c7 : 85 49 __ STA T2 + 2
+18c9 : a9 3f __ LDA #$3f
+18cb : 85 4a __ STA T2 + 3
+18cd : 18 __ __ CLC
+18ce : a5 4e __ LDA T5 + 0
+18d0 : 65 43 __ ADC T0 + 0
+18d2 : 85 4c __ STA T4 + 0
+18d4 : e6 4c __ INC T4 + 0
+18d6 : a9 01 __ LDA #$01
+18d8 : c5 4c __ CMP T4 + 0
+18da : b0 03 __ BCS $18df
+18dc : 4c 49 1b JMP $1b49 ; (nformf + 1188)
+18df : a5 11 __ LDA P4
+18e1 : 85 1b __ STA ACCU + 0
+18e3 : a5 12 __ LDA P5
+18e5 : 85 1c __ STA ACCU + 1
+18e7 : a5 13 __ LDA P6
+18e9 : 85 1d __ STA ACCU + 2
+18eb : a5 14 __ LDA P7
+18ed : 85 1e __ STA ACCU + 3
+18ef : a5 47 __ LDA T2 + 0
+18f1 : 85 03 __ STA $03
+18f3 : a5 48 __ LDA T2 + 1
+18f5 : 85 04 __ STA $04
+18f7 : a5 49 __ LDA T2 + 2
+18f9 : 85 05 __ STA $05
+18fb : a5 4a __ LDA T2 + 3
+18fd : 85 06 __ STA $06
+18ff : 20 52 1d JSR $1d52 ; (freg + 20)
+1902 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+1905 : a5 1b __ LDA ACCU + 0
+1907 : 85 11 __ STA P4
+1909 : 85 47 __ STA T2 + 0
+190b : 85 03 __ STA $03
+190d : a5 1c __ LDA ACCU + 1
+190f : 85 12 __ STA P5
+1911 : 85 48 __ STA T2 + 1
+1913 : 85 04 __ STA $04
+1915 : a5 1d __ LDA ACCU + 2
+1917 : 85 13 __ STA P6
+1919 : 85 49 __ STA T2 + 2
+191b : 85 05 __ STA $05
+191d : a5 1e __ LDA ACCU + 3
+191f : 85 14 __ STA P7
+1921 : 85 4a __ STA T2 + 3
+1923 : 85 06 __ STA $06
+1925 : a9 00 __ LDA #$00
+1927 : 85 1b __ STA ACCU + 0
+1929 : 85 1c __ STA ACCU + 1
+192b : a9 20 __ LDA #$20
+192d : 85 1d __ STA ACCU + 2
+192f : a9 41 __ LDA #$41
+1931 : 85 1e __ STA ACCU + 3
+1933 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+1936 : 30 36 __ BMI $196e
+1938 : a5 47 __ LDA T2 + 0
+193a : 85 1b __ STA ACCU + 0
+193c : a5 48 __ LDA T2 + 1
+193e : 85 1c __ STA ACCU + 1
+1940 : a5 49 __ LDA T2 + 2
+1942 : 85 1d __ STA ACCU + 2
+1944 : a5 4a __ LDA T2 + 3
+1946 : 85 1e __ STA ACCU + 3
+1948 : a9 00 __ LDA #$00
+194a : 85 03 __ STA $03
+194c : 85 04 __ STA $04
+194e : a9 20 __ LDA #$20
+1950 : 85 05 __ STA $05
+1952 : a9 41 __ LDA #$41
+1954 : 85 06 __ STA $06
+1956 : 20 52 1d JSR $1d52 ; (freg + 20)
+1959 : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+195c : a5 1b __ LDA ACCU + 0
+195e : 85 11 __ STA P4
+1960 : a5 1c __ LDA ACCU + 1
+1962 : 85 12 __ STA P5
+1964 : a5 1d __ LDA ACCU + 2
+1966 : 85 13 __ STA P6
+1968 : a5 1e __ LDA ACCU + 3
+196a : 85 14 __ STA P7
+196c : c6 4e __ DEC T5 + 0
+196e : 38 __ __ SEC
+196f : a5 4c __ LDA T4 + 0
+1971 : e5 4e __ SBC T5 + 0
+1973 : 85 53 __ STA T10 + 0
+1975 : 85 4e __ STA T5 + 0
+1977 : a9 14 __ LDA #$14
+1979 : c5 4c __ CMP T4 + 0
+197b : b0 02 __ BCS $197f
+197d : 85 4c __ STA T4 + 0
+197f : a5 53 __ LDA T10 + 0
+1981 : d0 08 __ BNE $198b
+1983 : a9 30 __ LDA #$30
+1985 : a4 4b __ LDY T3 + 0
+1987 : 91 0f __ STA (P2),y
+1989 : e6 4b __ INC T3 + 0
+198b : a9 00 __ LDA #$00
+198d : 85 50 __ STA T6 + 0
+198f : a5 4c __ LDA T4 + 0
+1991 : f0 03 __ BEQ $1996
+1993 : 4c b8 1a JMP $1ab8 ; (nformf + 1043)
+1996 : a5 52 __ LDA T8 + 0
+1998 : f0 03 __ BEQ $199d
+199a : 4c 38 1a JMP $1a38 ; (nformf + 915)
+199d : a5 4b __ LDA T3 + 0
+199f : a0 01 __ LDY #$01
+19a1 : d1 0d __ CMP (P0),y
+19a3 : 90 07 __ BCC $19ac
+19a5 : 85 1b __ STA ACCU + 0
+19a7 : a9 00 __ LDA #$00
+19a9 : 85 1c __ STA ACCU + 1
+19ab : 60 __ __ RTS
+19ac : c9 01 __ CMP #$01
+19ae : 90 53 __ BCC $1a03
+19b0 : a9 01 __ LDA #$01
+19b2 : 85 4e __ STA T5 + 0
+19b4 : a5 0d __ LDA P0
+19b6 : 85 43 __ STA T0 + 0
+19b8 : a5 0e __ LDA P1
+19ba : 85 44 __ STA T0 + 1
+19bc : a5 4b __ LDA T3 + 0
+19be : 85 4c __ STA T4 + 0
+19c0 : 38 __ __ SEC
+19c1 : a5 4c __ LDA T4 + 0
+19c3 : e5 4e __ SBC T5 + 0
+19c5 : 85 55 __ STA T11 + 0
+19c7 : a9 00 __ LDA #$00
+19c9 : e9 00 __ SBC #$00
+19cb : 85 56 __ STA T11 + 1
+19cd : 18 __ __ CLC
+19ce : a5 0f __ LDA P2
+19d0 : 65 55 __ ADC T11 + 0
+19d2 : 85 55 __ STA T11 + 0
+19d4 : a5 10 __ LDA P3
+19d6 : 65 56 __ ADC T11 + 1
+19d8 : 85 56 __ STA T11 + 1
+19da : a0 01 __ LDY #$01
+19dc : b1 43 __ LDA (T0 + 0),y
+19de : 38 __ __ SEC
+19df : e5 4e __ SBC T5 + 0
+19e1 : 85 53 __ STA T10 + 0
+19e3 : a9 00 __ LDA #$00
+19e5 : e9 00 __ SBC #$00
+19e7 : 85 54 __ STA T10 + 1
+19e9 : 18 __ __ CLC
+19ea : a5 0f __ LDA P2
+19ec : 65 53 __ ADC T10 + 0
+19ee : 85 53 __ STA T10 + 0
+19f0 : a5 10 __ LDA P3
+19f2 : 65 54 __ ADC T10 + 1
+19f4 : 85 54 __ STA T10 + 1
+19f6 : 88 __ __ DEY
+19f7 : b1 55 __ LDA (T11 + 0),y
+19f9 : 91 53 __ STA (T10 + 0),y
+19fb : e6 4e __ INC T5 + 0
+19fd : a5 4b __ LDA T3 + 0
+19ff : c5 4e __ CMP T5 + 0
+1a01 : b0 bd __ BCS $19c0
+1a03 : a9 00 __ LDA #$00
+1a05 : 85 4e __ STA T5 + 0
+1a07 : a5 4b __ LDA T3 + 0
+1a09 : 85 43 __ STA T0 + 0
+1a0b : a0 01 __ LDY #$01
+1a0d : b1 0d __ LDA (P0),y
+1a0f : 85 4b __ STA T3 + 0
+1a11 : 38 __ __ SEC
+1a12 : e5 43 __ SBC T0 + 0
+1a14 : 85 53 __ STA T10 + 0
+1a16 : a9 00 __ LDA #$00
+1a18 : e9 00 __ SBC #$00
+1a1a : 85 54 __ STA T10 + 1
+1a1c : a9 00 __ LDA #$00
+1a1e : c5 54 __ CMP T10 + 1
+1a20 : d0 04 __ BNE $1a26
+1a22 : a5 4e __ LDA T5 + 0
+1a24 : c5 53 __ CMP T10 + 0
+1a26 : 90 05 __ BCC $1a2d
+1a28 : a5 4b __ LDA T3 + 0
+1a2a : 4c a5 19 JMP $19a5 ; (nformf + 768)
+1a2d : a9 20 __ LDA #$20
+1a2f : a4 4e __ LDY T5 + 0
+1a31 : 91 0f __ STA (P2),y
+1a33 : e6 4e __ INC T5 + 0
+1a35 : 4c 0b 1a JMP $1a0b ; (nformf + 870)
+1a38 : a9 45 __ LDA #$45
+1a3a : a4 4b __ LDY T3 + 0
+1a3c : 91 0f __ STA (P2),y
+1a3e : c8 __ __ INY
+1a3f : a5 44 __ LDA T0 + 1
+1a41 : 30 5a __ BMI $1a9d
+1a43 : a9 2b __ LDA #$2b
+1a45 : 91 0f __ STA (P2),y
+1a47 : 18 __ __ CLC
+1a48 : a5 4b __ LDA T3 + 0
+1a4a : 69 02 __ ADC #$02
+1a4c : 85 4b __ STA T3 + 0
+1a4e : a5 43 __ LDA T0 + 0
+1a50 : 85 1b __ STA ACCU + 0
+1a52 : a5 44 __ LDA T0 + 1
+1a54 : 85 1c __ STA ACCU + 1
+1a56 : a9 0a __ LDA #$0a
+1a58 : 85 03 __ STA $03
+1a5a : a9 00 __ LDA #$00
+1a5c : 85 04 __ STA $04
+1a5e : 20 67 1f JSR $1f67 ; (divs16 + 0)
+1a61 : 18 __ __ CLC
+1a62 : a5 1b __ LDA ACCU + 0
+1a64 : 69 30 __ ADC #$30
+1a66 : a4 4b __ LDY T3 + 0
+1a68 : 91 0f __ STA (P2),y
+1a6a : c8 __ __ INY
+1a6b : 98 __ __ TYA
+1a6c : 18 __ __ CLC
+1a6d : 65 0f __ ADC P2
+1a6f : 85 4c __ STA T4 + 0
+1a71 : a5 10 __ LDA P3
+1a73 : 69 00 __ ADC #$00
+1a75 : 85 4d __ STA T4 + 1
+1a77 : a5 43 __ LDA T0 + 0
+1a79 : 85 1b __ STA ACCU + 0
+1a7b : a5 44 __ LDA T0 + 1
+1a7d : 85 1c __ STA ACCU + 1
+1a7f : a9 0a __ LDA #$0a
+1a81 : 85 03 __ STA $03
+1a83 : a9 00 __ LDA #$00
+1a85 : 85 04 __ STA $04
+1a87 : 20 26 20 JSR $2026 ; (mods16 + 0)
+1a8a : 18 __ __ CLC
+1a8b : a5 05 __ LDA $05
+1a8d : 69 30 __ ADC #$30
+1a8f : a0 00 __ LDY #$00
+1a91 : 91 4c __ STA (T4 + 0),y
+1a93 : 18 __ __ CLC
+1a94 : a5 4b __ LDA T3 + 0
+1a96 : 69 02 __ ADC #$02
+1a98 : 85 4b __ STA T3 + 0
+1a9a : 4c 9d 19 JMP $199d ; (nformf + 760)
+1a9d : a9 2d __ LDA #$2d
+1a9f : 91 0f __ STA (P2),y
+1aa1 : 18 __ __ CLC
+1aa2 : a5 4b __ LDA T3 + 0
+1aa4 : 69 02 __ ADC #$02
+1aa6 : 85 4b __ STA T3 + 0
+1aa8 : 38 __ __ SEC
+1aa9 : a9 00 __ LDA #$00
+1aab : e5 43 __ SBC T0 + 0
+1aad : 85 43 __ STA T0 + 0
+1aaf : a9 00 __ LDA #$00
+1ab1 : e5 44 __ SBC T0 + 1
+1ab3 : 85 44 __ STA T0 + 1
+1ab5 : 4c 4e 1a JMP $1a4e ; (nformf + 937)
+1ab8 : a5 50 __ LDA T6 + 0
+1aba : c5 4e __ CMP T5 + 0
+1abc : d0 08 __ BNE $1ac6
+1abe : a9 2e __ LDA #$2e
+1ac0 : a4 4b __ LDY T3 + 0
+1ac2 : 91 0f __ STA (P2),y
+1ac4 : e6 4b __ INC T3 + 0
+1ac6 : a5 11 __ LDA P4
+1ac8 : 85 1b __ STA ACCU + 0
+1aca : a5 12 __ LDA P5
+1acc : 85 1c __ STA ACCU + 1
+1ace : a5 13 __ LDA P6
+1ad0 : 85 1d __ STA ACCU + 2
+1ad2 : a5 14 __ LDA P7
+1ad4 : 85 1e __ STA ACCU + 3
+1ad6 : 20 4f 20 JSR $204f ; (f32_to_i16 + 0)
+1ad9 : a5 1b __ LDA ACCU + 0
+1adb : 85 53 __ STA T10 + 0
+1add : 20 91 20 JSR $2091 ; (sint16_to_float + 0)
+1ae0 : a5 1b __ LDA ACCU + 0
+1ae2 : 85 03 __ STA $03
+1ae4 : a5 1c __ LDA ACCU + 1
+1ae6 : 85 04 __ STA $04
+1ae8 : a5 1d __ LDA ACCU + 2
+1aea : 85 05 __ STA $05
+1aec : a5 1e __ LDA ACCU + 3
+1aee : 85 06 __ STA $06
+1af0 : a5 11 __ LDA P4
+1af2 : 85 1b __ STA ACCU + 0
+1af4 : a5 12 __ LDA P5
+1af6 : 85 1c __ STA ACCU + 1
+1af8 : a5 13 __ LDA P6
+1afa : 85 1d __ STA ACCU + 2
+1afc : a5 14 __ LDA P7
+1afe : 85 1e __ STA ACCU + 3
+1b00 : 20 52 1d JSR $1d52 ; (freg + 20)
+1b03 : a5 06 __ LDA $06
+1b05 : 49 80 __ EOR #$80
+1b07 : 85 06 __ STA $06
+1b09 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+1b0c : a9 00 __ LDA #$00
+1b0e : 85 03 __ STA $03
+1b10 : 85 04 __ STA $04
+1b12 : a9 20 __ LDA #$20
+1b14 : 85 05 __ STA $05
+1b16 : a9 41 __ LDA #$41
+1b18 : 85 06 __ STA $06
+1b1a : 20 52 1d JSR $1d52 ; (freg + 20)
+1b1d : 20 4b 1e JSR $1e4b ; (fmul + 0)
+1b20 : a5 1b __ LDA ACCU + 0
+1b22 : 85 11 __ STA P4
+1b24 : a5 1c __ LDA ACCU + 1
+1b26 : 85 12 __ STA P5
+1b28 : a5 1d __ LDA ACCU + 2
+1b2a : 85 13 __ STA P6
+1b2c : a5 1e __ LDA ACCU + 3
+1b2e : 85 14 __ STA P7
+1b30 : 18 __ __ CLC
+1b31 : a5 53 __ LDA T10 + 0
+1b33 : 69 30 __ ADC #$30
+1b35 : a4 4b __ LDY T3 + 0
+1b37 : 91 0f __ STA (P2),y
+1b39 : e6 4b __ INC T3 + 0
+1b3b : e6 50 __ INC T6 + 0
+1b3d : a5 50 __ LDA T6 + 0
+1b3f : c5 4c __ CMP T4 + 0
+1b41 : b0 03 __ BCS $1b46
+1b43 : 4c b8 1a JMP $1ab8 ; (nformf + 1043)
+1b46 : 4c 96 19 JMP $1996 ; (nformf + 753)
+1b49 : 85 50 __ STA T6 + 0
+1b4b : a5 47 __ LDA T2 + 0
+1b4d : 85 1b __ STA ACCU + 0
+1b4f : a5 48 __ LDA T2 + 1
+1b51 : 85 1c __ STA ACCU + 1
+1b53 : a5 49 __ LDA T2 + 2
+1b55 : 85 1d __ STA ACCU + 2
+1b57 : a5 4a __ LDA T2 + 3
+1b59 : 85 1e __ STA ACCU + 3
+1b5b : a9 00 __ LDA #$00
+1b5d : 85 03 __ STA $03
+1b5f : 85 04 __ STA $04
+1b61 : a9 20 __ LDA #$20
+1b63 : 85 05 __ STA $05
+1b65 : a9 41 __ LDA #$41
+1b67 : 85 06 __ STA $06
+1b69 : 20 52 1d JSR $1d52 ; (freg + 20)
+1b6c : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1b6f : a5 1b __ LDA ACCU + 0
+1b71 : 85 47 __ STA T2 + 0
+1b73 : a5 1c __ LDA ACCU + 1
+1b75 : 85 48 __ STA T2 + 1
+1b77 : a5 1d __ LDA ACCU + 2
+1b79 : 85 49 __ STA T2 + 2
+1b7b : a5 1e __ LDA ACCU + 3
+1b7d : 85 4a __ STA T2 + 3
+1b7f : e6 50 __ INC T6 + 0
+1b81 : a5 50 __ LDA T6 + 0
+1b83 : c5 4c __ CMP T4 + 0
+1b85 : 90 c4 __ BCC $1b4b
+1b87 : 4c df 18 JMP $18df ; (nformf + 570)
+1b8a : a5 11 __ LDA P4
+1b8c : 85 1b __ STA ACCU + 0
+1b8e : a5 12 __ LDA P5
+1b90 : 85 1c __ STA ACCU + 1
+1b92 : a5 13 __ LDA P6
+1b94 : 85 1d __ STA ACCU + 2
+1b96 : a5 14 __ LDA P7
+1b98 : 85 1e __ STA ACCU + 3
+1b9a : a9 00 __ LDA #$00
+1b9c : 85 03 __ STA $03
+1b9e : 85 04 __ STA $04
+1ba0 : a9 20 __ LDA #$20
+1ba2 : 85 05 __ STA $05
+1ba4 : a9 41 __ LDA #$41
+1ba6 : 85 06 __ STA $06
+1ba8 : 20 52 1d JSR $1d52 ; (freg + 20)
+1bab : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1bae : a5 1b __ LDA ACCU + 0
+1bb0 : 85 11 __ STA P4
+1bb2 : a5 1c __ LDA ACCU + 1
+1bb4 : 85 12 __ STA P5
+1bb6 : a5 1d __ LDA ACCU + 2
+1bb8 : 85 13 __ STA P6
+1bba : a5 1e __ LDA ACCU + 3
+1bbc : 85 14 __ STA P7
+1bbe : e6 43 __ INC T0 + 0
+1bc0 : d0 02 __ BNE $1bc4
+1bc2 : e6 44 __ INC T0 + 1
+1bc4 : a5 44 __ LDA T0 + 1
+1bc6 : 30 c2 __ BMI $1b8a
+1bc8 : 4c c1 18 JMP $18c1 ; (nformf + 540)
+1bcb : a9 00 __ LDA #$00
+1bcd : 85 47 __ STA T2 + 0
+1bcf : 85 48 __ STA T2 + 1
+1bd1 : 85 49 __ STA T2 + 2
+1bd3 : a9 3f __ LDA #$3f
+1bd5 : 85 4a __ STA T2 + 3
+1bd7 : a5 4e __ LDA T5 + 0
+1bd9 : f0 03 __ BEQ $1bde
+1bdb : 4c 7a 1c JMP $1c7a ; (nformf + 1493)
+1bde : a5 11 __ LDA P4
+1be0 : 85 1b __ STA ACCU + 0
+1be2 : a5 12 __ LDA P5
+1be4 : 85 1c __ STA ACCU + 1
+1be6 : a5 13 __ LDA P6
+1be8 : 85 1d __ STA ACCU + 2
+1bea : a5 14 __ LDA P7
+1bec : 85 1e __ STA ACCU + 3
+1bee : a5 47 __ LDA T2 + 0
+1bf0 : 85 03 __ STA $03
+1bf2 : a5 48 __ LDA T2 + 1
+1bf4 : 85 04 __ STA $04
+1bf6 : a5 49 __ LDA T2 + 2
+1bf8 : 85 05 __ STA $05
+1bfa : a5 4a __ LDA T2 + 3
+1bfc : 85 06 __ STA $06
+1bfe : 20 52 1d JSR $1d52 ; (freg + 20)
+1c01 : 20 83 1d JSR $1d83 ; (faddsub + 0)
+1c04 : a5 1b __ LDA ACCU + 0
+1c06 : 85 11 __ STA P4
+1c08 : 85 47 __ STA T2 + 0
+1c0a : 85 03 __ STA $03
+1c0c : a5 1c __ LDA ACCU + 1
+1c0e : 85 12 __ STA P5
+1c10 : 85 48 __ STA T2 + 1
+1c12 : 85 04 __ STA $04
+1c14 : a5 1d __ LDA ACCU + 2
+1c16 : 85 13 __ STA P6
+1c18 : 85 49 __ STA T2 + 2
+1c1a : 85 05 __ STA $05
+1c1c : a5 1e __ LDA ACCU + 3
+1c1e : 85 14 __ STA P7
+1c20 : 85 4a __ STA T2 + 3
+1c22 : 85 06 __ STA $06
+1c24 : a9 00 __ LDA #$00
+1c26 : 85 1b __ STA ACCU + 0
+1c28 : 85 1c __ STA ACCU + 1
+1c2a : a9 20 __ LDA #$20
+1c2c : 85 1d __ STA ACCU + 2
+1c2e : a9 41 __ LDA #$41
+1c30 : 85 1e __ STA ACCU + 3
+1c32 : 20 dc 20 JSR $20dc ; (fcmp + 0)
+1c35 : 10 03 __ BPL $1c3a
+1c37 : 4c 6e 19 JMP $196e ; (nformf + 713)
+1c3a : a5 47 __ LDA T2 + 0
+1c3c : 85 1b __ STA ACCU + 0
+1c3e : a5 48 __ LDA T2 + 1
+1c40 : 85 1c __ STA ACCU + 1
+1c42 : a5 49 __ LDA T2 + 2
+1c44 : 85 1d __ STA ACCU + 2
+1c46 : a5 4a __ LDA T2 + 3
+1c48 : 85 1e __ STA ACCU + 3
+1c4a : a9 00 __ LDA #$00
+1c4c : 85 03 __ STA $03
+1c4e : 85 04 __ STA $04
+1c50 : a9 20 __ LDA #$20
+1c52 : 85 05 __ STA $05
+1c54 : a9 41 __ LDA #$41
+1c56 : 85 06 __ STA $06
+1c58 : 20 52 1d JSR $1d52 ; (freg + 20)
+1c5b : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1c5e : a5 1b __ LDA ACCU + 0
+1c60 : 85 11 __ STA P4
+1c62 : a5 1c __ LDA ACCU + 1
+1c64 : 85 12 __ STA P5
+1c66 : a5 1d __ LDA ACCU + 2
+1c68 : 85 13 __ STA P6
+1c6a : a5 1e __ LDA ACCU + 3
+1c6c : 85 14 __ STA P7
+1c6e : e6 43 __ INC T0 + 0
+1c70 : f0 03 __ BEQ $1c75
+1c72 : 4c 6e 19 JMP $196e ; (nformf + 713)
+1c75 : e6 44 __ INC T0 + 1
+1c77 : 4c 6e 19 JMP $196e ; (nformf + 713)
+1c7a : a9 00 __ LDA #$00
+1c7c : 85 50 __ STA T6 + 0
+1c7e : a5 47 __ LDA T2 + 0
+1c80 : 85 1b __ STA ACCU + 0
+1c82 : a5 48 __ LDA T2 + 1
+1c84 : 85 1c __ STA ACCU + 1
+1c86 : a5 49 __ LDA T2 + 2
+1c88 : 85 1d __ STA ACCU + 2
+1c8a : a5 4a __ LDA T2 + 3
+1c8c : 85 1e __ STA ACCU + 3
+1c8e : a9 00 __ LDA #$00
+1c90 : 85 03 __ STA $03
+1c92 : 85 04 __ STA $04
+1c94 : a9 20 __ LDA #$20
+1c96 : 85 05 __ STA $05
+1c98 : a9 41 __ LDA #$41
+1c9a : 85 06 __ STA $06
+1c9c : 20 52 1d JSR $1d52 ; (freg + 20)
+1c9f : 20 e9 1e JSR $1ee9 ; (fdiv + 0)
+1ca2 : a5 1b __ LDA ACCU + 0
+1ca4 : 85 47 __ STA T2 + 0
+1ca6 : a5 1c __ LDA ACCU + 1
+1ca8 : 85 48 __ STA T2 + 1
+1caa : a5 1d __ LDA ACCU + 2
+1cac : 85 49 __ STA T2 + 2
+1cae : a5 1e __ LDA ACCU + 3
+1cb0 : 85 4a __ STA T2 + 3
+1cb2 : e6 50 __ INC T6 + 0
+1cb4 : a5 50 __ LDA T6 + 0
+1cb6 : c5 4e __ CMP T5 + 0
+1cb8 : 90 c4 __ BCC $1c7e
+1cba : 4c de 1b JMP $1bde ; (nformf + 1337)
+1cbd : a5 44 __ LDA T0 + 1
+1cbf : 10 0e __ BPL $1ccf
+1cc1 : a5 44 __ LDA T0 + 1
+1cc3 : 30 03 __ BMI $1cc8
+1cc5 : 4c b3 18 JMP $18b3 ; (nformf + 526)
+1cc8 : a9 01 __ LDA #$01
+1cca : 85 52 __ STA T8 + 0
+1ccc : 4c cb 1b JMP $1bcb ; (nformf + 1318)
+1ccf : d0 f7 __ BNE $1cc8
+1cd1 : a9 03 __ LDA #$03
+1cd3 : c5 43 __ CMP T0 + 0
+1cd5 : 90 f1 __ BCC $1cc8
+1cd7 : 4c c1 1c JMP $1cc1 ; (nformf + 1564)
+1cda : a9 01 __ LDA #$01
+1cdc : 4c a0 18 JMP $18a0 ; (nformf + 507)
+1cdf : a5 14 __ LDA P7
+1ce1 : 49 80 __ EOR #$80
+1ce3 : 85 14 __ STA P7
+1ce5 : a9 2d __ LDA #$2d
+1ce7 : a0 00 __ LDY #$00
+1ce9 : 91 0f __ STA (P2),y
+1ceb : a9 01 __ LDA #$01
+1ced : 85 4b __ STA T3 + 0
+1cef : 4c db 16 JMP $16db ; (nformf + 54)
+--------------------------------------------------------------------
+assert:
+1cff : a0 02 __ LDY #$02
+1d01 : b1 23 __ LDA (SP + 0),y
+1d03 : d0 09 __ BNE $1d0e
+1d05 : a9 ff __ LDA #$ff
+1d07 : 85 0d __ STA P0
+1d09 : 85 0e __ STA P1
+1d0b : 20 0f 1d JSR $1d0f ; (exit + 0)
+1d0e : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1d0f : a5 0d __ LDA P0
+1d11 : 85 1b __ STA ACCU + 0
+1d13 : a5 0e __ LDA P1
+1d15 : 85 1c __ STA ACCU + 1
+1d17 : ae 84 21 LDX $2184 ; (spentry + 0)
+1d1a : 9a __ __ TXS
+1d1b : a9 4c __ LDA #$4c
+1d1d : 85 54 __ STA $54
+1d1f : a9 00 __ LDA #$00
+1d21 : 85 13 __ STA P6
+1d23 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1d31 : a9 4c __ LDA #$4c
+1d33 : 85 54 __ STA $54
+1d35 : a9 00 __ LDA #$00
+1d37 : 85 13 __ STA P6
+1d39 : a9 19 __ LDA #$19
+1d3b : 85 16 __ STA P9
+1d3d : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1d3e : b1 19 __ LDA (IP + 0),y
+1d40 : c8 __ __ INY
+1d41 : aa __ __ TAX
+1d42 : b5 00 __ LDA $00,x
+1d44 : 85 03 __ STA $03
+1d46 : b5 01 __ LDA $01,x
+1d48 : 85 04 __ STA $04
+1d4a : b5 02 __ LDA $02,x
+1d4c : 85 05 __ STA $05
+1d4e : b5 03 __ LDA $03,x
+1d50 : 85 06 __ STA $06
+1d52 : a5 05 __ LDA $05
+1d54 : 0a __ __ ASL
+1d55 : a5 06 __ LDA $06
+1d57 : 2a __ __ ROL
+1d58 : 85 08 __ STA $08
+1d5a : f0 06 __ BEQ $1d62
+1d5c : a5 05 __ LDA $05
+1d5e : 09 80 __ ORA #$80
+1d60 : 85 05 __ STA $05
+1d62 : a5 1d __ LDA ACCU + 2
+1d64 : 0a __ __ ASL
+1d65 : a5 1e __ LDA ACCU + 3
+1d67 : 2a __ __ ROL
+1d68 : 85 07 __ STA $07
+1d6a : f0 06 __ BEQ $1d72
+1d6c : a5 1d __ LDA ACCU + 2
+1d6e : 09 80 __ ORA #$80
+1d70 : 85 1d __ STA ACCU + 2
+1d72 : 60 __ __ RTS
+1d73 : 06 1e __ ASL ACCU + 3
+1d75 : a5 07 __ LDA $07
+1d77 : 6a __ __ ROR
+1d78 : 85 1e __ STA ACCU + 3
+1d7a : b0 06 __ BCS $1d82
+1d7c : a5 1d __ LDA ACCU + 2
+1d7e : 29 7f __ AND #$7f
+1d80 : 85 1d __ STA ACCU + 2
+1d82 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1d83 : 38 __ __ SEC
+1d84 : a5 07 __ LDA $07
+1d86 : e5 08 __ SBC $08
+1d88 : f0 38 __ BEQ $1dc2
+1d8a : aa __ __ TAX
+1d8b : b0 25 __ BCS $1db2
+1d8d : e0 e9 __ CPX #$e9
+1d8f : b0 0e __ BCS $1d9f
+1d91 : a5 08 __ LDA $08
+1d93 : 85 07 __ STA $07
+1d95 : a9 00 __ LDA #$00
+1d97 : 85 1b __ STA ACCU + 0
+1d99 : 85 1c __ STA ACCU + 1
+1d9b : 85 1d __ STA ACCU + 2
+1d9d : f0 23 __ BEQ $1dc2
+1d9f : a5 1d __ LDA ACCU + 2
+1da1 : 4a __ __ LSR
+1da2 : 66 1c __ ROR ACCU + 1
+1da4 : 66 1b __ ROR ACCU + 0
+1da6 : e8 __ __ INX
+1da7 : d0 f8 __ BNE $1da1
+1da9 : 85 1d __ STA ACCU + 2
+1dab : a5 08 __ LDA $08
+1dad : 85 07 __ STA $07
+1daf : 4c c2 1d JMP $1dc2 ; (faddsub + 63)
+1db2 : e0 18 __ CPX #$18
+1db4 : b0 33 __ BCS $1de9
+1db6 : a5 05 __ LDA $05
+1db8 : 4a __ __ LSR
+1db9 : 66 04 __ ROR $04
+1dbb : 66 03 __ ROR $03
+1dbd : ca __ __ DEX
+1dbe : d0 f8 __ BNE $1db8
+1dc0 : 85 05 __ STA $05
+1dc2 : a5 1e __ LDA ACCU + 3
+1dc4 : 29 80 __ AND #$80
+1dc6 : 85 1e __ STA ACCU + 3
+1dc8 : 45 06 __ EOR $06
+1dca : 30 2d __ BMI $1df9
+1dcc : 18 __ __ CLC
+1dcd : a5 1b __ LDA ACCU + 0
+1dcf : 65 03 __ ADC $03
+1dd1 : 85 1b __ STA ACCU + 0
+1dd3 : a5 1c __ LDA ACCU + 1
+1dd5 : 65 04 __ ADC $04
+1dd7 : 85 1c __ STA ACCU + 1
+1dd9 : a5 1d __ LDA ACCU + 2
+1ddb : 65 05 __ ADC $05
+1ddd : 85 1d __ STA ACCU + 2
+1ddf : 90 08 __ BCC $1de9
+1de1 : 66 1d __ ROR ACCU + 2
+1de3 : 66 1c __ ROR ACCU + 1
+1de5 : 66 1b __ ROR ACCU + 0
+1de7 : e6 07 __ INC $07
+1de9 : a5 07 __ LDA $07
+1deb : 4a __ __ LSR
+1dec : 05 1e __ ORA ACCU + 3
+1dee : 85 1e __ STA ACCU + 3
+1df0 : b0 06 __ BCS $1df8
+1df2 : a5 1d __ LDA ACCU + 2
+1df4 : 29 7f __ AND #$7f
+1df6 : 85 1d __ STA ACCU + 2
+1df8 : 60 __ __ RTS
+1df9 : 38 __ __ SEC
+1dfa : a5 1b __ LDA ACCU + 0
+1dfc : e5 03 __ SBC $03
+1dfe : 85 1b __ STA ACCU + 0
+1e00 : a5 1c __ LDA ACCU + 1
+1e02 : e5 04 __ SBC $04
+1e04 : 85 1c __ STA ACCU + 1
+1e06 : a5 1d __ LDA ACCU + 2
+1e08 : e5 05 __ SBC $05
+1e0a : 85 1d __ STA ACCU + 2
+1e0c : b0 19 __ BCS $1e27
+1e0e : 38 __ __ SEC
+1e0f : a9 00 __ LDA #$00
+1e11 : e5 1b __ SBC ACCU + 0
+1e13 : 85 1b __ STA ACCU + 0
+1e15 : a9 00 __ LDA #$00
+1e17 : e5 1c __ SBC ACCU + 1
+1e19 : 85 1c __ STA ACCU + 1
+1e1b : a9 00 __ LDA #$00
+1e1d : e5 1d __ SBC ACCU + 2
+1e1f : 85 1d __ STA ACCU + 2
+1e21 : a5 1e __ LDA ACCU + 3
+1e23 : 49 80 __ EOR #$80
+1e25 : 85 1e __ STA ACCU + 3
+1e27 : a5 1d __ LDA ACCU + 2
+1e29 : 30 be __ BMI $1de9
+1e2b : 05 1c __ ORA ACCU + 1
+1e2d : 05 1b __ ORA ACCU + 0
+1e2f : f0 0f __ BEQ $1e40
+1e31 : c6 07 __ DEC $07
+1e33 : f0 0b __ BEQ $1e40
+1e35 : 06 1b __ ASL ACCU + 0
+1e37 : 26 1c __ ROL ACCU + 1
+1e39 : 26 1d __ ROL ACCU + 2
+1e3b : 10 f4 __ BPL $1e31
+1e3d : 4c e9 1d JMP $1de9 ; (faddsub + 102)
+1e40 : a9 00 __ LDA #$00
+1e42 : 85 1b __ STA ACCU + 0
+1e44 : 85 1c __ STA ACCU + 1
+1e46 : 85 1d __ STA ACCU + 2
+1e48 : 85 1e __ STA ACCU + 3
+1e4a : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1e4b : a5 1b __ LDA ACCU + 0
+1e4d : 05 1c __ ORA ACCU + 1
+1e4f : 05 1d __ ORA ACCU + 2
+1e51 : d0 03 __ BNE $1e56
+1e53 : 85 1e __ STA ACCU + 3
+1e55 : 60 __ __ RTS
+1e56 : a5 03 __ LDA $03
+1e58 : 05 04 __ ORA $04
+1e5a : 05 05 __ ORA $05
+1e5c : d0 09 __ BNE $1e67
+1e5e : 85 1b __ STA ACCU + 0
+1e60 : 85 1c __ STA ACCU + 1
+1e62 : 85 1d __ STA ACCU + 2
+1e64 : 85 1e __ STA ACCU + 3
+1e66 : 60 __ __ RTS
+1e67 : a9 00 __ LDA #$00
+1e69 : 85 09 __ STA $09
+1e6b : 85 0a __ STA $0a
+1e6d : 85 0b __ STA $0b
+1e6f : a4 1b __ LDY ACCU + 0
+1e71 : a5 03 __ LDA $03
+1e73 : d0 06 __ BNE $1e7b
+1e75 : a5 04 __ LDA $04
+1e77 : f0 0a __ BEQ $1e83
+1e79 : d0 05 __ BNE $1e80
+1e7b : 20 bb 1e JSR $1ebb ; (fmul8 + 0)
+1e7e : a5 04 __ LDA $04
+1e80 : 20 bb 1e JSR $1ebb ; (fmul8 + 0)
+1e83 : a5 05 __ LDA $05
+1e85 : 20 bb 1e JSR $1ebb ; (fmul8 + 0)
+1e88 : 38 __ __ SEC
+1e89 : a5 0b __ LDA $0b
+1e8b : 30 06 __ BMI $1e93
+1e8d : 06 09 __ ASL $09
+1e8f : 26 0a __ ROL $0a
+1e91 : 2a __ __ ROL
+1e92 : 18 __ __ CLC
+1e93 : 29 7f __ AND #$7f
+1e95 : 85 0b __ STA $0b
+1e97 : a5 1e __ LDA ACCU + 3
+1e99 : 45 06 __ EOR $06
+1e9b : 29 80 __ AND #$80
+1e9d : 85 1e __ STA ACCU + 3
+1e9f : a5 07 __ LDA $07
+1ea1 : e9 7e __ SBC #$7e
+1ea3 : 18 __ __ CLC
+1ea4 : 65 08 __ ADC $08
+1ea6 : 4a __ __ LSR
+1ea7 : 05 1e __ ORA ACCU + 3
+1ea9 : 85 1e __ STA ACCU + 3
+1eab : a9 00 __ LDA #$00
+1ead : 6a __ __ ROR
+1eae : 05 0b __ ORA $0b
+1eb0 : 85 1d __ STA ACCU + 2
+1eb2 : a5 0a __ LDA $0a
+1eb4 : 85 1c __ STA ACCU + 1
+1eb6 : a5 09 __ LDA $09
+1eb8 : 85 1b __ STA ACCU + 0
+1eba : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1ebb : 38 __ __ SEC
+1ebc : 6a __ __ ROR
+1ebd : 90 1e __ BCC $1edd
+1ebf : aa __ __ TAX
+1ec0 : 18 __ __ CLC
+1ec1 : 98 __ __ TYA
+1ec2 : 65 09 __ ADC $09
+1ec4 : 85 09 __ STA $09
+1ec6 : a5 0a __ LDA $0a
+1ec8 : 65 1c __ ADC ACCU + 1
+1eca : 85 0a __ STA $0a
+1ecc : a5 0b __ LDA $0b
+1ece : 65 1d __ ADC ACCU + 2
+1ed0 : 6a __ __ ROR
+1ed1 : 85 0b __ STA $0b
+1ed3 : 8a __ __ TXA
+1ed4 : 66 0a __ ROR $0a
+1ed6 : 66 09 __ ROR $09
+1ed8 : 4a __ __ LSR
+1ed9 : f0 0d __ BEQ $1ee8
+1edb : b0 e2 __ BCS $1ebf
+1edd : 66 0b __ ROR $0b
+1edf : 66 0a __ ROR $0a
+1ee1 : 66 09 __ ROR $09
+1ee3 : 4a __ __ LSR
+1ee4 : 90 f7 __ BCC $1edd
+1ee6 : d0 d7 __ BNE $1ebf
+1ee8 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1ee9 : a5 1b __ LDA ACCU + 0
+1eeb : 05 1c __ ORA ACCU + 1
+1eed : 05 1d __ ORA ACCU + 2
+1eef : d0 03 __ BNE $1ef4
+1ef1 : 85 1e __ STA ACCU + 3
+1ef3 : 60 __ __ RTS
+1ef4 : a5 1e __ LDA ACCU + 3
+1ef6 : 45 06 __ EOR $06
+1ef8 : 29 80 __ AND #$80
+1efa : 85 1e __ STA ACCU + 3
+1efc : a9 00 __ LDA #$00
+1efe : 85 09 __ STA $09
+1f00 : 85 0a __ STA $0a
+1f02 : 85 0b __ STA $0b
+1f04 : a2 18 __ LDX #$18
+1f06 : a5 1b __ LDA ACCU + 0
+1f08 : c5 03 __ CMP $03
+1f0a : a5 1c __ LDA ACCU + 1
+1f0c : e5 04 __ SBC $04
+1f0e : a5 1d __ LDA ACCU + 2
+1f10 : e5 05 __ SBC $05
+1f12 : 90 13 __ BCC $1f27
+1f14 : a5 1b __ LDA ACCU + 0
+1f16 : e5 03 __ SBC $03
+1f18 : 85 1b __ STA ACCU + 0
+1f1a : a5 1c __ LDA ACCU + 1
+1f1c : e5 04 __ SBC $04
+1f1e : 85 1c __ STA ACCU + 1
+1f20 : a5 1d __ LDA ACCU + 2
+1f22 : e5 05 __ SBC $05
+1f24 : 85 1d __ STA ACCU + 2
+1f26 : 38 __ __ SEC
+1f27 : 26 09 __ ROL $09
+1f29 : 26 0a __ ROL $0a
+1f2b : 26 0b __ ROL $0b
+1f2d : ca __ __ DEX
+1f2e : f0 0a __ BEQ $1f3a
+1f30 : 06 1b __ ASL ACCU + 0
+1f32 : 26 1c __ ROL ACCU + 1
+1f34 : 26 1d __ ROL ACCU + 2
+1f36 : b0 dc __ BCS $1f14
+1f38 : 90 cc __ BCC $1f06
+1f3a : 38 __ __ SEC
+1f3b : a5 0b __ LDA $0b
+1f3d : 30 06 __ BMI $1f45
+1f3f : 06 09 __ ASL $09
+1f41 : 26 0a __ ROL $0a
+1f43 : 2a __ __ ROL
+1f44 : 18 __ __ CLC
+1f45 : 29 7f __ AND #$7f
+1f47 : 85 0b __ STA $0b
+1f49 : a5 08 __ LDA $08
+1f4b : 49 7f __ EOR #$7f
+1f4d : 65 07 __ ADC $07
+1f4f : 38 __ __ SEC
+1f50 : e9 01 __ SBC #$01
+1f52 : 4a __ __ LSR
+1f53 : 05 1e __ ORA ACCU + 3
+1f55 : 85 1e __ STA ACCU + 3
+1f57 : a9 00 __ LDA #$00
+1f59 : 6a __ __ ROR
+1f5a : 05 0b __ ORA $0b
+1f5c : 85 1d __ STA ACCU + 2
+1f5e : a5 0a __ LDA $0a
+1f60 : 85 1c __ STA ACCU + 1
+1f62 : a5 09 __ LDA $09
+1f64 : 85 1b __ STA ACCU + 0
+1f66 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1f67 : 24 1c __ BIT ACCU + 1
+1f69 : 10 0d __ BPL $1f78
+1f6b : 20 85 1f JSR $1f85 ; (negaccu + 0)
+1f6e : 24 04 __ BIT $04
+1f70 : 10 0d __ BPL $1f7f
+1f72 : 20 93 1f JSR $1f93 ; (negtmp + 0)
+1f75 : 4c a1 1f JMP $1fa1 ; (divmod + 0)
+1f78 : 24 04 __ BIT $04
+1f7a : 10 f9 __ BPL $1f75
+1f7c : 20 93 1f JSR $1f93 ; (negtmp + 0)
+1f7f : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+1f82 : 4c 85 1f JMP $1f85 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1f85 : 38 __ __ SEC
+1f86 : a9 00 __ LDA #$00
+1f88 : e5 1b __ SBC ACCU + 0
+1f8a : 85 1b __ STA ACCU + 0
+1f8c : a9 00 __ LDA #$00
+1f8e : e5 1c __ SBC ACCU + 1
+1f90 : 85 1c __ STA ACCU + 1
+1f92 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1f93 : 38 __ __ SEC
+1f94 : a9 00 __ LDA #$00
+1f96 : e5 03 __ SBC $03
+1f98 : 85 03 __ STA $03
+1f9a : a9 00 __ LDA #$00
+1f9c : e5 04 __ SBC $04
+1f9e : 85 04 __ STA $04
+1fa0 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1fa1 : a5 1c __ LDA ACCU + 1
+1fa3 : d0 31 __ BNE $1fd6
+1fa5 : a5 04 __ LDA $04
+1fa7 : d0 1e __ BNE $1fc7
+1fa9 : 85 06 __ STA $06
+1fab : a2 04 __ LDX #$04
+1fad : 06 1b __ ASL ACCU + 0
+1faf : 2a __ __ ROL
+1fb0 : c5 03 __ CMP $03
+1fb2 : 90 02 __ BCC $1fb6
+1fb4 : e5 03 __ SBC $03
+1fb6 : 26 1b __ ROL ACCU + 0
+1fb8 : 2a __ __ ROL
+1fb9 : c5 03 __ CMP $03
+1fbb : 90 02 __ BCC $1fbf
+1fbd : e5 03 __ SBC $03
+1fbf : 26 1b __ ROL ACCU + 0
+1fc1 : ca __ __ DEX
+1fc2 : d0 eb __ BNE $1faf
+1fc4 : 85 05 __ STA $05
+1fc6 : 60 __ __ RTS
+1fc7 : a5 1b __ LDA ACCU + 0
+1fc9 : 85 05 __ STA $05
+1fcb : a5 1c __ LDA ACCU + 1
+1fcd : 85 06 __ STA $06
+1fcf : a9 00 __ LDA #$00
+1fd1 : 85 1b __ STA ACCU + 0
+1fd3 : 85 1c __ STA ACCU + 1
+1fd5 : 60 __ __ RTS
+1fd6 : a5 04 __ LDA $04
+1fd8 : d0 1f __ BNE $1ff9
+1fda : a5 03 __ LDA $03
+1fdc : 30 1b __ BMI $1ff9
+1fde : a9 00 __ LDA #$00
+1fe0 : 85 06 __ STA $06
+1fe2 : a2 10 __ LDX #$10
+1fe4 : 06 1b __ ASL ACCU + 0
+1fe6 : 26 1c __ ROL ACCU + 1
+1fe8 : 2a __ __ ROL
+1fe9 : c5 03 __ CMP $03
+1feb : 90 02 __ BCC $1fef
+1fed : e5 03 __ SBC $03
+1fef : 26 1b __ ROL ACCU + 0
+1ff1 : 26 1c __ ROL ACCU + 1
+1ff3 : ca __ __ DEX
+1ff4 : d0 f2 __ BNE $1fe8
+1ff6 : 85 05 __ STA $05
+1ff8 : 60 __ __ RTS
+1ff9 : a9 00 __ LDA #$00
+1ffb : 85 05 __ STA $05
+1ffd : 85 06 __ STA $06
+1fff : 84 02 __ STY $02
+2001 : a0 10 __ LDY #$10
+2003 : 18 __ __ CLC
+2004 : 26 1b __ ROL ACCU + 0
+2006 : 26 1c __ ROL ACCU + 1
+2008 : 26 05 __ ROL $05
+200a : 26 06 __ ROL $06
+200c : 38 __ __ SEC
+200d : a5 05 __ LDA $05
+200f : e5 03 __ SBC $03
+2011 : aa __ __ TAX
+2012 : a5 06 __ LDA $06
+2014 : e5 04 __ SBC $04
+2016 : 90 04 __ BCC $201c
+2018 : 86 05 __ STX $05
+201a : 85 06 __ STA $06
+201c : 88 __ __ DEY
+201d : d0 e5 __ BNE $2004
+201f : 26 1b __ ROL ACCU + 0
+2021 : 26 1c __ ROL ACCU + 1
+2023 : a4 02 __ LDY $02
+2025 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2026 : 24 1c __ BIT ACCU + 1
+2028 : 10 0d __ BPL $2037
+202a : 20 85 1f JSR $1f85 ; (negaccu + 0)
+202d : 24 04 __ BIT $04
+202f : 10 0d __ BPL $203e
+2031 : 20 93 1f JSR $1f93 ; (negtmp + 0)
+2034 : 4c a1 1f JMP $1fa1 ; (divmod + 0)
+2037 : 24 04 __ BIT $04
+2039 : 10 f9 __ BPL $2034
+203b : 20 93 1f JSR $1f93 ; (negtmp + 0)
+203e : 20 a1 1f JSR $1fa1 ; (divmod + 0)
+2041 : 38 __ __ SEC
+2042 : a9 00 __ LDA #$00
+2044 : e5 05 __ SBC $05
+2046 : 85 05 __ STA $05
+2048 : a9 00 __ LDA #$00
+204a : e5 06 __ SBC $06
+204c : 85 06 __ STA $06
+204e : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+204f : 20 62 1d JSR $1d62 ; (freg + 36)
+2052 : a5 07 __ LDA $07
+2054 : c9 7f __ CMP #$7f
+2056 : b0 07 __ BCS $205f
+2058 : a9 00 __ LDA #$00
+205a : 85 1b __ STA ACCU + 0
+205c : 85 1c __ STA ACCU + 1
+205e : 60 __ __ RTS
+205f : 38 __ __ SEC
+2060 : e9 8e __ SBC #$8e
+2062 : 90 0a __ BCC $206e
+2064 : a9 ff __ LDA #$ff
+2066 : 85 1b __ STA ACCU + 0
+2068 : a9 7f __ LDA #$7f
+206a : 85 1c __ STA ACCU + 1
+206c : d0 08 __ BNE $2076
+206e : aa __ __ TAX
+206f : 46 1d __ LSR ACCU + 2
+2071 : 66 1c __ ROR ACCU + 1
+2073 : e8 __ __ INX
+2074 : d0 f9 __ BNE $206f
+2076 : 24 1e __ BIT ACCU + 3
+2078 : 10 0e __ BPL $2088
+207a : 38 __ __ SEC
+207b : a9 00 __ LDA #$00
+207d : e5 1c __ SBC ACCU + 1
+207f : 85 1b __ STA ACCU + 0
+2081 : a9 00 __ LDA #$00
+2083 : e5 1d __ SBC ACCU + 2
+2085 : 85 1c __ STA ACCU + 1
+2087 : 60 __ __ RTS
+2088 : a5 1c __ LDA ACCU + 1
+208a : 85 1b __ STA ACCU + 0
+208c : a5 1d __ LDA ACCU + 2
+208e : 85 1c __ STA ACCU + 1
+2090 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2091 : 24 1c __ BIT ACCU + 1
+2093 : 30 03 __ BMI $2098
+2095 : 4c af 20 JMP $20af ; (uint16_to_float + 0)
+2098 : 38 __ __ SEC
+2099 : a9 00 __ LDA #$00
+209b : e5 1b __ SBC ACCU + 0
+209d : 85 1b __ STA ACCU + 0
+209f : a9 00 __ LDA #$00
+20a1 : e5 1c __ SBC ACCU + 1
+20a3 : 85 1c __ STA ACCU + 1
+20a5 : 20 af 20 JSR $20af ; (uint16_to_float + 0)
+20a8 : a5 1e __ LDA ACCU + 3
+20aa : 09 80 __ ORA #$80
+20ac : 85 1e __ STA ACCU + 3
+20ae : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+20af : a5 1b __ LDA ACCU + 0
+20b1 : 05 1c __ ORA ACCU + 1
+20b3 : d0 05 __ BNE $20ba
+20b5 : 85 1d __ STA ACCU + 2
+20b7 : 85 1e __ STA ACCU + 3
+20b9 : 60 __ __ RTS
+20ba : a2 8e __ LDX #$8e
+20bc : a5 1c __ LDA ACCU + 1
+20be : 30 06 __ BMI $20c6
+20c0 : ca __ __ DEX
+20c1 : 06 1b __ ASL ACCU + 0
+20c3 : 2a __ __ ROL
+20c4 : 10 fa __ BPL $20c0
+20c6 : 29 7f __ AND #$7f
+20c8 : 85 1d __ STA ACCU + 2
+20ca : a5 1b __ LDA ACCU + 0
+20cc : 85 1c __ STA ACCU + 1
+20ce : 8a __ __ TXA
+20cf : 4a __ __ LSR
+20d0 : 85 1e __ STA ACCU + 3
+20d2 : a9 00 __ LDA #$00
+20d4 : 85 1b __ STA ACCU + 0
+20d6 : 6a __ __ ROR
+20d7 : 05 1d __ ORA ACCU + 2
+20d9 : 85 1d __ STA ACCU + 2
+20db : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+20dc : a5 1e __ LDA ACCU + 3
+20de : 45 06 __ EOR $06
+20e0 : 29 80 __ AND #$80
+20e2 : f0 1e __ BEQ $2102
+20e4 : a5 1e __ LDA ACCU + 3
+20e6 : 29 7f __ AND #$7f
+20e8 : 05 1d __ ORA ACCU + 2
+20ea : 05 1c __ ORA ACCU + 1
+20ec : 05 1b __ ORA ACCU + 0
+20ee : d0 0c __ BNE $20fc
+20f0 : a5 06 __ LDA $06
+20f2 : 29 7f __ AND #$7f
+20f4 : 05 05 __ ORA $05
+20f6 : 05 04 __ ORA $04
+20f8 : 05 03 __ ORA $03
+20fa : f0 1e __ BEQ $211a
+20fc : a5 1e __ LDA ACCU + 3
+20fe : 30 23 __ BMI $2123
+2100 : 10 28 __ BPL $212a
+2102 : a5 1e __ LDA ACCU + 3
+2104 : c5 06 __ CMP $06
+2106 : d0 15 __ BNE $211d
+2108 : a5 1d __ LDA ACCU + 2
+210a : c5 05 __ CMP $05
+210c : d0 0f __ BNE $211d
+210e : a5 1c __ LDA ACCU + 1
+2110 : c5 04 __ CMP $04
+2112 : d0 09 __ BNE $211d
+2114 : a5 1b __ LDA ACCU + 0
+2116 : c5 03 __ CMP $03
+2118 : d0 03 __ BNE $211d
+211a : a9 00 __ LDA #$00
+211c : 60 __ __ RTS
+211d : b0 07 __ BCS $2126
+211f : 24 1e __ BIT ACCU + 3
+2121 : 30 07 __ BMI $212a
+2123 : a9 01 __ LDA #$01
+2125 : 60 __ __ RTS
+2126 : 24 1e __ BIT ACCU + 3
+2128 : 30 f9 __ BMI $2123
+212a : a9 ff __ LDA #$ff
+212c : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+212d : 84 02 __ STY $02
+212f : a9 00 __ LDA #$00
+2131 : 85 07 __ STA $07
+2133 : 85 08 __ STA $08
+2135 : 85 09 __ STA $09
+2137 : 85 0a __ STA $0a
+2139 : a0 20 __ LDY #$20
+213b : 18 __ __ CLC
+213c : 26 1b __ ROL ACCU + 0
+213e : 26 1c __ ROL ACCU + 1
+2140 : 26 1d __ ROL ACCU + 2
+2142 : 26 1e __ ROL ACCU + 3
+2144 : 26 07 __ ROL $07
+2146 : 26 08 __ ROL $08
+2148 : 26 09 __ ROL $09
+214a : 26 0a __ ROL $0a
+214c : a5 07 __ LDA $07
+214e : c5 03 __ CMP $03
+2150 : a5 08 __ LDA $08
+2152 : e5 04 __ SBC $04
+2154 : a5 09 __ LDA $09
+2156 : e5 05 __ SBC $05
+2158 : a5 0a __ LDA $0a
+215a : e5 06 __ SBC $06
+215c : 90 18 __ BCC $2176
+215e : a5 07 __ LDA $07
+2160 : e5 03 __ SBC $03
+2162 : 85 07 __ STA $07
+2164 : a5 08 __ LDA $08
+2166 : e5 04 __ SBC $04
+2168 : 85 08 __ STA $08
+216a : a5 09 __ LDA $09
+216c : e5 05 __ SBC $05
+216e : 85 09 __ STA $09
+2170 : a5 0a __ LDA $0a
+2172 : e5 06 __ SBC $06
+2174 : 85 0a __ STA $0a
+2176 : 88 __ __ DEY
+2177 : d0 c3 __ BNE $213c
+2179 : 26 1b __ ROL ACCU + 0
+217b : 26 1c __ ROL ACCU + 1
+217d : 26 1d __ ROL ACCU + 2
+217f : 26 1e __ ROL ACCU + 3
+2181 : a4 02 __ LDY $02
+2183 : 60 __ __ RTS
@@ -0,0 +1,3385 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 7d 23 STX $237d ; (spentry + 0)
+0811 : a9 87 __ LDA #$87
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c1 __ LDA #$c1
+0832 : e9 87 __ SBC #$87
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 2a 1f JMP $1f2a ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 6d __ STA T0 + 0
+0911 : 85 6e __ STA T0 + 1
+0913 : 85 6f __ STA T0 + 2
+0915 : 85 70 __ STA T0 + 3
+0917 : 85 71 __ STA T1 + 0
+0919 : 85 72 __ STA T1 + 1
+091b : a9 fb __ LDA #$fb
+091d : a0 02 __ LDY #$02
+091f : 91 23 __ STA (SP + 0),y
+0921 : a9 1e __ LDA #$1e
+0923 : c8 __ __ INY
+0924 : 91 23 __ STA (SP + 0),y
+0926 : a5 71 __ LDA T1 + 0
+0928 : 85 1b __ STA ACCU + 0
+092a : c8 __ __ INY
+092b : 91 23 __ STA (SP + 0),y
+092d : a5 72 __ LDA T1 + 1
+092f : 85 1c __ STA ACCU + 1
+0931 : c8 __ __ INY
+0932 : 91 23 __ STA (SP + 0),y
+0934 : ad 7f 23 LDA $237f ; (c + 0)
+0937 : 85 45 __ STA T3 + 0
+0939 : ad 80 23 LDA $2380 ; (c + 1)
+093c : 85 46 __ STA T3 + 1
+093e : ad 81 23 LDA $2381 ; (c + 2)
+0941 : 85 47 __ STA T3 + 2
+0943 : ad 82 23 LDA $2382 ; (c + 3)
+0946 : 85 48 __ STA T3 + 3
+0948 : 20 8a 22 JSR $228a ; (sint16_to_float + 0)
+094b : a5 45 __ LDA T3 + 0
+094d : 85 03 __ STA $03
+094f : a5 46 __ LDA T3 + 1
+0951 : 85 04 __ STA $04
+0953 : a5 47 __ LDA T3 + 2
+0955 : 85 05 __ STA $05
+0957 : a5 48 __ LDA T3 + 3
+0959 : 85 06 __ STA $06
+095b : 20 4b 1f JSR $1f4b ; (freg + 20)
+095e : 20 44 20 JSR $2044 ; (fmul + 0)
+0961 : a5 1b __ LDA ACCU + 0
+0963 : a0 06 __ LDY #$06
+0965 : 91 23 __ STA (SP + 0),y
+0967 : a5 1c __ LDA ACCU + 1
+0969 : c8 __ __ INY
+096a : 91 23 __ STA (SP + 0),y
+096c : a5 1d __ LDA ACCU + 2
+096e : c8 __ __ INY
+096f : 91 23 __ STA (SP + 0),y
+0971 : a5 1e __ LDA ACCU + 3
+0973 : c8 __ __ INY
+0974 : 91 23 __ STA (SP + 0),y
+0976 : a5 6d __ LDA T0 + 0
+0978 : 85 03 __ STA $03
+097a : c8 __ __ INY
+097b : 91 23 __ STA (SP + 0),y
+097d : a5 6e __ LDA T0 + 1
+097f : 85 04 __ STA $04
+0981 : c8 __ __ INY
+0982 : 91 23 __ STA (SP + 0),y
+0984 : a5 6f __ LDA T0 + 2
+0986 : 85 05 __ STA $05
+0988 : c8 __ __ INY
+0989 : 91 23 __ STA (SP + 0),y
+098b : a5 70 __ LDA T0 + 3
+098d : 85 06 __ STA $06
+098f : c8 __ __ INY
+0990 : 91 23 __ STA (SP + 0),y
+0992 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0995 : a5 06 __ LDA $06
+0997 : 49 80 __ EOR #$80
+0999 : 85 06 __ STA $06
+099b : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+099e : a5 1b __ LDA ACCU + 0
+09a0 : a0 0e __ LDY #$0e
+09a2 : 91 23 __ STA (SP + 0),y
+09a4 : a5 1c __ LDA ACCU + 1
+09a6 : c8 __ __ INY
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : a5 1d __ LDA ACCU + 2
+09ab : c8 __ __ INY
+09ac : 91 23 __ STA (SP + 0),y
+09ae : a5 1e __ LDA ACCU + 3
+09b0 : c8 __ __ INY
+09b1 : 91 23 __ STA (SP + 0),y
+09b3 : 20 59 0c JSR $0c59 ; (printf + 0)
+09b6 : ad 7f 23 LDA $237f ; (c + 0)
+09b9 : 85 45 __ STA T3 + 0
+09bb : ad 80 23 LDA $2380 ; (c + 1)
+09be : 85 46 __ STA T3 + 1
+09c0 : ad 81 23 LDA $2381 ; (c + 2)
+09c3 : 85 47 __ STA T3 + 2
+09c5 : ad 82 23 LDA $2382 ; (c + 3)
+09c8 : 85 48 __ STA T3 + 3
+09ca : a5 71 __ LDA T1 + 0
+09cc : 85 1b __ STA ACCU + 0
+09ce : a5 72 __ LDA T1 + 1
+09d0 : 85 1c __ STA ACCU + 1
+09d2 : 20 8a 22 JSR $228a ; (sint16_to_float + 0)
+09d5 : a5 45 __ LDA T3 + 0
+09d7 : 85 03 __ STA $03
+09d9 : a5 46 __ LDA T3 + 1
+09db : 85 04 __ STA $04
+09dd : a5 47 __ LDA T3 + 2
+09df : 85 05 __ STA $05
+09e1 : a5 48 __ LDA T3 + 3
+09e3 : 85 06 __ STA $06
+09e5 : 20 4b 1f JSR $1f4b ; (freg + 20)
+09e8 : 20 44 20 JSR $2044 ; (fmul + 0)
+09eb : a5 1b __ LDA ACCU + 0
+09ed : 85 03 __ STA $03
+09ef : a5 1c __ LDA ACCU + 1
+09f1 : 85 04 __ STA $04
+09f3 : a5 1d __ LDA ACCU + 2
+09f5 : 85 05 __ STA $05
+09f7 : a5 1e __ LDA ACCU + 3
+09f9 : 85 06 __ STA $06
+09fb : a5 6d __ LDA T0 + 0
+09fd : 85 1b __ STA ACCU + 0
+09ff : a5 6e __ LDA T0 + 1
+0a01 : 85 1c __ STA ACCU + 1
+0a03 : a5 6f __ LDA T0 + 2
+0a05 : 85 1d __ STA ACCU + 2
+0a07 : a5 70 __ LDA T0 + 3
+0a09 : 85 1e __ STA ACCU + 3
+0a0b : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0a0e : f0 09 __ BEQ $0a19
+0a10 : a9 ff __ LDA #$ff
+0a12 : 85 0d __ STA P0
+0a14 : 85 0e __ STA P1
+0a16 : 20 08 1f JSR $1f08 ; (exit + 0)
+0a19 : ad 7f 23 LDA $237f ; (c + 0)
+0a1c : 85 1b __ STA ACCU + 0
+0a1e : ad 80 23 LDA $2380 ; (c + 1)
+0a21 : 85 1c __ STA ACCU + 1
+0a23 : ad 81 23 LDA $2381 ; (c + 2)
+0a26 : 85 1d __ STA ACCU + 2
+0a28 : ad 82 23 LDA $2382 ; (c + 3)
+0a2b : 85 1e __ STA ACCU + 3
+0a2d : a5 6d __ LDA T0 + 0
+0a2f : 85 03 __ STA $03
+0a31 : a5 6e __ LDA T0 + 1
+0a33 : 85 04 __ STA $04
+0a35 : a5 6f __ LDA T0 + 2
+0a37 : 85 05 __ STA $05
+0a39 : a5 70 __ LDA T0 + 3
+0a3b : 85 06 __ STA $06
+0a3d : 20 4b 1f JSR $1f4b ; (freg + 20)
+0a40 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+0a43 : a5 1b __ LDA ACCU + 0
+0a45 : 85 6d __ STA T0 + 0
+0a47 : a5 1c __ LDA ACCU + 1
+0a49 : 85 6e __ STA T0 + 1
+0a4b : a5 1d __ LDA ACCU + 2
+0a4d : 85 6f __ STA T0 + 2
+0a4f : a5 1e __ LDA ACCU + 3
+0a51 : 85 70 __ STA T0 + 3
+0a53 : e6 71 __ INC T1 + 0
+0a55 : d0 02 __ BNE $0a59
+0a57 : e6 72 __ INC T1 + 1
+0a59 : a5 71 __ LDA T1 + 0
+0a5b : c9 32 __ CMP #$32
+0a5d : b0 03 __ BCS $0a62
+0a5f : 4c 1b 09 JMP $091b ; (main + 27)
+0a62 : ad 83 23 LDA $2383 ; (d + 0)
+0a65 : 85 6d __ STA T0 + 0
+0a67 : ad 84 23 LDA $2384 ; (d + 1)
+0a6a : 85 6e __ STA T0 + 1
+0a6c : ad 85 23 LDA $2385 ; (d + 2)
+0a6f : 85 6f __ STA T0 + 2
+0a71 : ad 86 23 LDA $2386 ; (d + 3)
+0a74 : 85 70 __ STA T0 + 3
+0a76 : a9 01 __ LDA #$01
+0a78 : 85 71 __ STA T1 + 0
+0a7a : a9 00 __ LDA #$00
+0a7c : 85 72 __ STA T1 + 1
+0a7e : a9 1d __ LDA #$1d
+0a80 : a0 02 __ LDY #$02
+0a82 : 91 23 __ STA (SP + 0),y
+0a84 : a9 1f __ LDA #$1f
+0a86 : c8 __ __ INY
+0a87 : 91 23 __ STA (SP + 0),y
+0a89 : a5 71 __ LDA T1 + 0
+0a8b : 85 1b __ STA ACCU + 0
+0a8d : c8 __ __ INY
+0a8e : 91 23 __ STA (SP + 0),y
+0a90 : a5 72 __ LDA T1 + 1
+0a92 : 85 1c __ STA ACCU + 1
+0a94 : c8 __ __ INY
+0a95 : 91 23 __ STA (SP + 0),y
+0a97 : ad 83 23 LDA $2383 ; (d + 0)
+0a9a : 85 45 __ STA T3 + 0
+0a9c : ad 84 23 LDA $2384 ; (d + 1)
+0a9f : 85 46 __ STA T3 + 1
+0aa1 : ad 85 23 LDA $2385 ; (d + 2)
+0aa4 : 85 47 __ STA T3 + 2
+0aa6 : ad 86 23 LDA $2386 ; (d + 3)
+0aa9 : 85 48 __ STA T3 + 3
+0aab : 20 8a 22 JSR $228a ; (sint16_to_float + 0)
+0aae : a5 1b __ LDA ACCU + 0
+0ab0 : 85 49 __ STA T4 + 0
+0ab2 : a5 1c __ LDA ACCU + 1
+0ab4 : 85 4a __ STA T4 + 1
+0ab6 : a5 1d __ LDA ACCU + 2
+0ab8 : 85 4b __ STA T4 + 2
+0aba : a5 1e __ LDA ACCU + 3
+0abc : 85 4c __ STA T4 + 3
+0abe : a5 45 __ LDA T3 + 0
+0ac0 : 85 03 __ STA $03
+0ac2 : a5 46 __ LDA T3 + 1
+0ac4 : 85 04 __ STA $04
+0ac6 : a5 47 __ LDA T3 + 2
+0ac8 : 85 05 __ STA $05
+0aca : a5 48 __ LDA T3 + 3
+0acc : 85 06 __ STA $06
+0ace : 20 4b 1f JSR $1f4b ; (freg + 20)
+0ad1 : 20 44 20 JSR $2044 ; (fmul + 0)
+0ad4 : a5 1b __ LDA ACCU + 0
+0ad6 : a0 06 __ LDY #$06
+0ad8 : 91 23 __ STA (SP + 0),y
+0ada : a5 1c __ LDA ACCU + 1
+0adc : c8 __ __ INY
+0add : 91 23 __ STA (SP + 0),y
+0adf : a5 1d __ LDA ACCU + 2
+0ae1 : c8 __ __ INY
+0ae2 : 91 23 __ STA (SP + 0),y
+0ae4 : a5 1e __ LDA ACCU + 3
+0ae6 : c8 __ __ INY
+0ae7 : 91 23 __ STA (SP + 0),y
+0ae9 : a5 6d __ LDA T0 + 0
+0aeb : 85 03 __ STA $03
+0aed : c8 __ __ INY
+0aee : 91 23 __ STA (SP + 0),y
+0af0 : a5 6e __ LDA T0 + 1
+0af2 : 85 04 __ STA $04
+0af4 : c8 __ __ INY
+0af5 : 91 23 __ STA (SP + 0),y
+0af7 : a5 6f __ LDA T0 + 2
+0af9 : 85 05 __ STA $05
+0afb : c8 __ __ INY
+0afc : 91 23 __ STA (SP + 0),y
+0afe : a5 70 __ LDA T0 + 3
+0b00 : 85 06 __ STA $06
+0b02 : c8 __ __ INY
+0b03 : 91 23 __ STA (SP + 0),y
+0b05 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0b08 : a5 06 __ LDA $06
+0b0a : 49 80 __ EOR #$80
+0b0c : 85 06 __ STA $06
+0b0e : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+0b11 : a5 1e __ LDA ACCU + 3
+0b13 : 29 7f __ AND #$7f
+0b15 : 85 1e __ STA ACCU + 3
+0b17 : a5 49 __ LDA T4 + 0
+0b19 : 85 03 __ STA $03
+0b1b : a5 4a __ LDA T4 + 1
+0b1d : 85 04 __ STA $04
+0b1f : a5 4b __ LDA T4 + 2
+0b21 : 85 05 __ STA $05
+0b23 : a5 4c __ LDA T4 + 3
+0b25 : 85 06 __ STA $06
+0b27 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0b2a : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+0b2d : a5 1b __ LDA ACCU + 0
+0b2f : a0 0e __ LDY #$0e
+0b31 : 91 23 __ STA (SP + 0),y
+0b33 : a5 1c __ LDA ACCU + 1
+0b35 : c8 __ __ INY
+0b36 : 91 23 __ STA (SP + 0),y
+0b38 : a5 1d __ LDA ACCU + 2
+0b3a : c8 __ __ INY
+0b3b : 91 23 __ STA (SP + 0),y
+0b3d : a5 1e __ LDA ACCU + 3
+0b3f : c8 __ __ INY
+0b40 : 91 23 __ STA (SP + 0),y
+0b42 : 20 59 0c JSR $0c59 ; (printf + 0)
+0b45 : ad 83 23 LDA $2383 ; (d + 0)
+0b48 : 85 45 __ STA T3 + 0
+0b4a : ad 84 23 LDA $2384 ; (d + 1)
+0b4d : 85 46 __ STA T3 + 1
+0b4f : ad 85 23 LDA $2385 ; (d + 2)
+0b52 : 85 47 __ STA T3 + 2
+0b54 : ad 86 23 LDA $2386 ; (d + 3)
+0b57 : 85 48 __ STA T3 + 3
+0b59 : a5 71 __ LDA T1 + 0
+0b5b : 85 1b __ STA ACCU + 0
+0b5d : a5 72 __ LDA T1 + 1
+0b5f : 85 1c __ STA ACCU + 1
+0b61 : 20 8a 22 JSR $228a ; (sint16_to_float + 0)
+0b64 : a5 1b __ LDA ACCU + 0
+0b66 : 85 49 __ STA T4 + 0
+0b68 : a5 1c __ LDA ACCU + 1
+0b6a : 85 4a __ STA T4 + 1
+0b6c : a5 1d __ LDA ACCU + 2
+0b6e : 85 4b __ STA T4 + 2
+0b70 : a5 1e __ LDA ACCU + 3
+0b72 : 85 4c __ STA T4 + 3
+0b74 : a5 45 __ LDA T3 + 0
+0b76 : 85 03 __ STA $03
+0b78 : a5 46 __ LDA T3 + 1
+0b7a : 85 04 __ STA $04
+0b7c : a5 47 __ LDA T3 + 2
+0b7e : 85 05 __ STA $05
+0b80 : a5 48 __ LDA T3 + 3
+0b82 : 85 06 __ STA $06
+0b84 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0b87 : 20 44 20 JSR $2044 ; (fmul + 0)
+0b8a : a5 6d __ LDA T0 + 0
+0b8c : 85 03 __ STA $03
+0b8e : a5 6e __ LDA T0 + 1
+0b90 : 85 04 __ STA $04
+0b92 : a5 6f __ LDA T0 + 2
+0b94 : 85 05 __ STA $05
+0b96 : a5 70 __ LDA T0 + 3
+0b98 : 85 06 __ STA $06
+0b9a : 20 4b 1f JSR $1f4b ; (freg + 20)
+0b9d : a5 06 __ LDA $06
+0b9f : 49 80 __ EOR #$80
+0ba1 : 85 06 __ STA $06
+0ba3 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+0ba6 : a5 1b __ LDA ACCU + 0
+0ba8 : 85 45 __ STA T3 + 0
+0baa : a5 1c __ LDA ACCU + 1
+0bac : 85 46 __ STA T3 + 1
+0bae : a5 1d __ LDA ACCU + 2
+0bb0 : 85 47 __ STA T3 + 2
+0bb2 : a5 1e __ LDA ACCU + 3
+0bb4 : 29 7f __ AND #$7f
+0bb6 : 85 48 __ STA T3 + 3
+0bb8 : a5 49 __ LDA T4 + 0
+0bba : 85 1b __ STA ACCU + 0
+0bbc : a5 4a __ LDA T4 + 1
+0bbe : 85 1c __ STA ACCU + 1
+0bc0 : a5 4b __ LDA T4 + 2
+0bc2 : 85 1d __ STA ACCU + 2
+0bc4 : a5 4c __ LDA T4 + 3
+0bc6 : 85 1e __ STA ACCU + 3
+0bc8 : a9 bd __ LDA #$bd
+0bca : 85 03 __ STA $03
+0bcc : a9 37 __ LDA #$37
+0bce : 85 04 __ STA $04
+0bd0 : a9 86 __ LDA #$86
+0bd2 : 85 05 __ STA $05
+0bd4 : a9 35 __ LDA #$35
+0bd6 : 85 06 __ STA $06
+0bd8 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0bdb : 20 44 20 JSR $2044 ; (fmul + 0)
+0bde : a5 45 __ LDA T3 + 0
+0be0 : 85 03 __ STA $03
+0be2 : a5 46 __ LDA T3 + 1
+0be4 : 85 04 __ STA $04
+0be6 : a5 47 __ LDA T3 + 2
+0be8 : 85 05 __ STA $05
+0bea : a5 48 __ LDA T3 + 3
+0bec : 85 06 __ STA $06
+0bee : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0bf1 : 30 09 __ BMI $0bfc
+0bf3 : a9 ff __ LDA #$ff
+0bf5 : 85 0d __ STA P0
+0bf7 : 85 0e __ STA P1
+0bf9 : 20 08 1f JSR $1f08 ; (exit + 0)
+0bfc : ad 83 23 LDA $2383 ; (d + 0)
+0bff : 85 1b __ STA ACCU + 0
+0c01 : ad 84 23 LDA $2384 ; (d + 1)
+0c04 : 85 1c __ STA ACCU + 1
+0c06 : ad 85 23 LDA $2385 ; (d + 2)
+0c09 : 85 1d __ STA ACCU + 2
+0c0b : ad 86 23 LDA $2386 ; (d + 3)
+0c0e : 85 1e __ STA ACCU + 3
+0c10 : a5 6d __ LDA T0 + 0
+0c12 : 85 03 __ STA $03
+0c14 : a5 6e __ LDA T0 + 1
+0c16 : 85 04 __ STA $04
+0c18 : a5 6f __ LDA T0 + 2
+0c1a : 85 05 __ STA $05
+0c1c : a5 70 __ LDA T0 + 3
+0c1e : 85 06 __ STA $06
+0c20 : 20 4b 1f JSR $1f4b ; (freg + 20)
+0c23 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+0c26 : a5 1b __ LDA ACCU + 0
+0c28 : 85 6d __ STA T0 + 0
+0c2a : a5 1c __ LDA ACCU + 1
+0c2c : 85 6e __ STA T0 + 1
+0c2e : a5 1d __ LDA ACCU + 2
+0c30 : 85 6f __ STA T0 + 2
+0c32 : a5 1e __ LDA ACCU + 3
+0c34 : 85 70 __ STA T0 + 3
+0c36 : e6 71 __ INC T1 + 0
+0c38 : d0 02 __ BNE $0c3c
+0c3a : e6 72 __ INC T1 + 1
+0c3c : a5 71 __ LDA T1 + 0
+0c3e : c9 32 __ CMP #$32
+0c40 : b0 03 __ BCS $0c45
+0c42 : 4c 7e 0a JMP $0a7e ; (main + 382)
+0c45 : a9 00 __ LDA #$00
+0c47 : 85 1b __ STA ACCU + 0
+0c49 : 85 1c __ STA ACCU + 1
+0c4b : 18 __ __ CLC
+0c4c : a5 23 __ LDA SP + 0
+0c4e : 69 12 __ ADC #$12
+0c50 : 85 23 __ STA SP + 0
+0c52 : a5 24 __ LDA SP + 1
+0c54 : 69 00 __ ADC #$00
+0c56 : 85 24 __ STA SP + 1
+0c58 : 60 __ __ RTS
+--------------------------------------------------------------------
+printf:
+0c59 : a9 00 __ LDA #$00
+0c5b : 85 45 __ STA T1 + 0
+0c5d : a0 02 __ LDY #$02
+0c5f : b1 23 __ LDA (SP + 0),y
+0c61 : 85 47 __ STA T2 + 0
+0c63 : c8 __ __ INY
+0c64 : b1 23 __ LDA (SP + 0),y
+0c66 : 85 48 __ STA T2 + 1
+0c68 : a0 00 __ LDY #$00
+0c6a : b1 47 __ LDA (T2 + 0),y
+0c6c : 85 49 __ STA T3 + 0
+0c6e : d0 16 __ BNE $0c86
+0c70 : a9 00 __ LDA #$00
+0c72 : a4 45 __ LDY T1 + 0
+0c74 : 99 87 23 STA $2387,y ; (sframe + 0)
+0c77 : 98 __ __ TYA
+0c78 : f0 0b __ BEQ $0c85
+0c7a : a9 87 __ LDA #$87
+0c7c : 85 0d __ STA P0
+0c7e : a9 23 __ LDA #$23
+0c80 : 85 0e __ STA P1
+0c82 : 20 bd 1e JSR $1ebd ; (puts + 0)
+0c85 : 60 __ __ RTS
+0c86 : 18 __ __ CLC
+0c87 : a5 23 __ LDA SP + 0
+0c89 : 69 04 __ ADC #$04
+0c8b : 85 4b __ STA T4 + 0
+0c8d : a5 24 __ LDA SP + 1
+0c8f : 69 00 __ ADC #$00
+0c91 : 85 4c __ STA T4 + 1
+0c93 : e6 47 __ INC T2 + 0
+0c95 : d0 02 __ BNE $0c99
+0c97 : e6 48 __ INC T2 + 1
+0c99 : a5 49 __ LDA T3 + 0
+0c9b : c9 25 __ CMP #$25
+0c9d : f0 4f __ BEQ $0cee
+0c9f : a4 45 __ LDY T1 + 0
+0ca1 : 99 87 23 STA $2387,y ; (sframe + 0)
+0ca4 : e6 45 __ INC T1 + 0
+0ca6 : a5 45 __ LDA T1 + 0
+0ca8 : c9 28 __ CMP #$28
+0caa : a0 00 __ LDY #$00
+0cac : 90 31 __ BCC $0cdf
+0cae : 18 __ __ CLC
+0caf : 69 87 __ ADC #$87
+0cb1 : 85 4f __ STA T6 + 0
+0cb3 : a9 23 __ LDA #$23
+0cb5 : 85 0e __ STA P1
+0cb7 : 69 00 __ ADC #$00
+0cb9 : 85 50 __ STA T6 + 1
+0cbb : a9 00 __ LDA #$00
+0cbd : 91 4f __ STA (T6 + 0),y
+0cbf : a9 87 __ LDA #$87
+0cc1 : 85 0d __ STA P0
+0cc3 : 20 bd 1e JSR $1ebd ; (puts + 0)
+0cc6 : a9 00 __ LDA #$00
+0cc8 : 85 45 __ STA T1 + 0
+0cca : a0 00 __ LDY #$00
+0ccc : b1 47 __ LDA (T2 + 0),y
+0cce : 85 4d __ STA T5 + 0
+0cd0 : e6 47 __ INC T2 + 0
+0cd2 : d0 02 __ BNE $0cd6
+0cd4 : e6 48 __ INC T2 + 1
+0cd6 : a5 4d __ LDA T5 + 0
+0cd8 : 85 49 __ STA T3 + 0
+0cda : d0 bd __ BNE $0c99
+0cdc : 4c 70 0c JMP $0c70 ; (printf + 23)
+0cdf : a0 00 __ LDY #$00
+0ce1 : b1 47 __ LDA (T2 + 0),y
+0ce3 : 85 4d __ STA T5 + 0
+0ce5 : e6 47 __ INC T2 + 0
+0ce7 : d0 02 __ BNE $0ceb
+0ce9 : e6 48 __ INC T2 + 1
+0ceb : 4c d6 0c JMP $0cd6 ; (printf + 125)
+0cee : a5 45 __ LDA T1 + 0
+0cf0 : f0 1e __ BEQ $0d10
+0cf2 : 18 __ __ CLC
+0cf3 : 69 87 __ ADC #$87
+0cf5 : 85 4f __ STA T6 + 0
+0cf7 : a9 23 __ LDA #$23
+0cf9 : 85 0e __ STA P1
+0cfb : 69 00 __ ADC #$00
+0cfd : 85 50 __ STA T6 + 1
+0cff : a9 00 __ LDA #$00
+0d01 : a0 00 __ LDY #$00
+0d03 : 91 4f __ STA (T6 + 0),y
+0d05 : a9 87 __ LDA #$87
+0d07 : 85 0d __ STA P0
+0d09 : 20 bd 1e JSR $1ebd ; (puts + 0)
+0d0c : a9 00 __ LDA #$00
+0d0e : 85 45 __ STA T1 + 0
+0d10 : a0 00 __ LDY #$00
+0d12 : b1 47 __ LDA (T2 + 0),y
+0d14 : 85 49 __ STA T3 + 0
+0d16 : a9 0a __ LDA #$0a
+0d18 : 8d bc 23 STA $23bc ; (sframe + 53)
+0d1b : a9 00 __ LDA #$00
+0d1d : 8d bd 23 STA $23bd ; (sframe + 54)
+0d20 : a9 01 __ LDA #$01
+0d22 : 8d ba 23 STA $23ba ; (sframe + 51)
+0d25 : a9 ff __ LDA #$ff
+0d27 : 8d bb 23 STA $23bb ; (sframe + 52)
+0d2a : a9 20 __ LDA #$20
+0d2c : 8d b9 23 STA $23b9 ; (sframe + 50)
+0d2f : a9 00 __ LDA #$00
+0d31 : 8d be 23 STA $23be ; (sframe + 55)
+0d34 : 8d bf 23 STA $23bf ; (sframe + 56)
+0d37 : 8d c0 23 STA $23c0 ; (sframe + 57)
+0d3a : e6 47 __ INC T2 + 0
+0d3c : d0 02 __ BNE $0d40
+0d3e : e6 48 __ INC T2 + 1
+0d40 : a5 49 __ LDA T3 + 0
+0d42 : c9 2b __ CMP #$2b
+0d44 : d0 03 __ BNE $0d49
+0d46 : 4c af 1e JMP $1eaf ; (printf + 4694)
+0d49 : c9 30 __ CMP #$30
+0d4b : d0 03 __ BNE $0d50
+0d4d : 4c a1 1e JMP $1ea1 ; (printf + 4680)
+0d50 : c9 23 __ CMP #$23
+0d52 : d0 03 __ BNE $0d57
+0d54 : 4c 93 1e JMP $1e93 ; (printf + 4666)
+0d57 : c9 30 __ CMP #$30
+0d59 : 90 66 __ BCC $0dc1
+0d5b : a9 39 __ LDA #$39
+0d5d : c5 49 __ CMP T3 + 0
+0d5f : 90 60 __ BCC $0dc1
+0d61 : a9 00 __ LDA #$00
+0d63 : 85 4f __ STA T6 + 0
+0d65 : 85 50 __ STA T6 + 1
+0d67 : a5 49 __ LDA T3 + 0
+0d69 : c9 30 __ CMP #$30
+0d6b : 90 4f __ BCC $0dbc
+0d6d : a9 39 __ LDA #$39
+0d6f : c5 49 __ CMP T3 + 0
+0d71 : 90 49 __ BCC $0dbc
+0d73 : a5 49 __ LDA T3 + 0
+0d75 : 85 51 __ STA T7 + 0
+0d77 : a0 00 __ LDY #$00
+0d79 : b1 47 __ LDA (T2 + 0),y
+0d7b : 85 49 __ STA T3 + 0
+0d7d : e6 47 __ INC T2 + 0
+0d7f : d0 02 __ BNE $0d83
+0d81 : e6 48 __ INC T2 + 1
+0d83 : a5 4f __ LDA T6 + 0
+0d85 : 0a __ __ ASL
+0d86 : 85 07 __ STA $07
+0d88 : a5 50 __ LDA T6 + 1
+0d8a : 2a __ __ ROL
+0d8b : 06 07 __ ASL $07
+0d8d : 2a __ __ ROL
+0d8e : 85 08 __ STA $08
+0d90 : 18 __ __ CLC
+0d91 : a5 07 __ LDA $07
+0d93 : 65 4f __ ADC T6 + 0
+0d95 : 85 1b __ STA ACCU + 0
+0d97 : a5 08 __ LDA $08
+0d99 : 65 50 __ ADC T6 + 1
+0d9b : 06 1b __ ASL ACCU + 0
+0d9d : 2a __ __ ROL
+0d9e : 85 1c __ STA ACCU + 1
+0da0 : 18 __ __ CLC
+0da1 : a5 1b __ LDA ACCU + 0
+0da3 : 65 51 __ ADC T7 + 0
+0da5 : aa __ __ TAX
+0da6 : a5 1c __ LDA ACCU + 1
+0da8 : 69 00 __ ADC #$00
+0daa : a8 __ __ TAY
+0dab : 38 __ __ SEC
+0dac : 8a __ __ TXA
+0dad : e9 30 __ SBC #$30
+0daf : 85 4f __ STA T6 + 0
+0db1 : 98 __ __ TYA
+0db2 : e9 00 __ SBC #$00
+0db4 : 85 50 __ STA T6 + 1
+0db6 : a5 49 __ LDA T3 + 0
+0db8 : c9 30 __ CMP #$30
+0dba : b0 b1 __ BCS $0d6d
+0dbc : a5 4f __ LDA T6 + 0
+0dbe : 8d ba 23 STA $23ba ; (sframe + 51)
+0dc1 : a5 49 __ LDA T3 + 0
+0dc3 : c9 2e __ CMP #$2e
+0dc5 : d0 03 __ BNE $0dca
+0dc7 : 4c 24 1e JMP $1e24 ; (printf + 4555)
+0dca : a5 49 __ LDA T3 + 0
+0dcc : c9 64 __ CMP #$64
+0dce : d0 03 __ BNE $0dd3
+0dd0 : 4c 9f 1c JMP $1c9f ; (printf + 4166)
+0dd3 : c9 75 __ CMP #$75
+0dd5 : d0 03 __ BNE $0dda
+0dd7 : 4c 59 1b JMP $1b59 ; (printf + 3840)
+0dda : c9 78 __ CMP #$78
+0ddc : d0 03 __ BNE $0de1
+0dde : 4c 09 1a JMP $1a09 ; (printf + 3504)
+0de1 : c9 6c __ CMP #$6c
+0de3 : d0 03 __ BNE $0de8
+0de5 : 4c c1 14 JMP $14c1 ; (printf + 2152)
+0de8 : c9 66 __ CMP #$66
+0dea : f0 7c __ BEQ $0e68
+0dec : c9 67 __ CMP #$67
+0dee : f0 78 __ BEQ $0e68
+0df0 : c9 65 __ CMP #$65
+0df2 : f0 74 __ BEQ $0e68
+0df4 : c9 73 __ CMP #$73
+0df6 : f0 48 __ BEQ $0e40
+0df8 : c9 63 __ CMP #$63
+0dfa : f0 1f __ BEQ $0e1b
+0dfc : 09 00 __ ORA #$00
+0dfe : d0 03 __ BNE $0e03
+0e00 : 4c df 0c JMP $0cdf ; (printf + 134)
+0e03 : a5 49 __ LDA T3 + 0
+0e05 : a4 45 __ LDY T1 + 0
+0e07 : 99 87 23 STA $2387,y ; (sframe + 0)
+0e0a : e6 45 __ INC T1 + 0
+0e0c : a0 00 __ LDY #$00
+0e0e : b1 47 __ LDA (T2 + 0),y
+0e10 : 85 4d __ STA T5 + 0
+0e12 : e6 47 __ INC T2 + 0
+0e14 : d0 02 __ BNE $0e18
+0e16 : e6 48 __ INC T2 + 1
+0e18 : 4c d6 0c JMP $0cd6 ; (printf + 125)
+0e1b : a0 00 __ LDY #$00
+0e1d : b1 4b __ LDA (T4 + 0),y
+0e1f : a4 45 __ LDY T1 + 0
+0e21 : 99 87 23 STA $2387,y ; (sframe + 0)
+0e24 : 18 __ __ CLC
+0e25 : a5 4b __ LDA T4 + 0
+0e27 : 69 02 __ ADC #$02
+0e29 : 85 4b __ STA T4 + 0
+0e2b : 90 02 __ BCC $0e2f
+0e2d : e6 4c __ INC T4 + 1
+0e2f : e6 45 __ INC T1 + 0
+0e31 : a0 00 __ LDY #$00
+0e33 : b1 47 __ LDA (T2 + 0),y
+0e35 : 85 4d __ STA T5 + 0
+0e37 : e6 47 __ INC T2 + 0
+0e39 : d0 02 __ BNE $0e3d
+0e3b : e6 48 __ INC T2 + 1
+0e3d : 4c d6 0c JMP $0cd6 ; (printf + 125)
+0e40 : a0 00 __ LDY #$00
+0e42 : b1 4b __ LDA (T4 + 0),y
+0e44 : 85 0d __ STA P0
+0e46 : c8 __ __ INY
+0e47 : b1 4b __ LDA (T4 + 0),y
+0e49 : 85 0e __ STA P1
+0e4b : 20 bd 1e JSR $1ebd ; (puts + 0)
+0e4e : 18 __ __ CLC
+0e4f : a5 4b __ LDA T4 + 0
+0e51 : 69 02 __ ADC #$02
+0e53 : 85 4b __ STA T4 + 0
+0e55 : 90 02 __ BCC $0e59
+0e57 : e6 4c __ INC T4 + 1
+0e59 : a0 00 __ LDY #$00
+0e5b : b1 47 __ LDA (T2 + 0),y
+0e5d : 85 4d __ STA T5 + 0
+0e5f : e6 47 __ INC T2 + 0
+0e61 : d0 02 __ BNE $0e65
+0e63 : e6 48 __ INC T2 + 1
+0e65 : 4c d6 0c JMP $0cd6 ; (printf + 125)
+0e68 : a0 00 __ LDY #$00
+0e6a : b1 4b __ LDA (T4 + 0),y
+0e6c : 85 5a __ STA T13 + 0
+0e6e : 85 03 __ STA $03
+0e70 : c8 __ __ INY
+0e71 : b1 4b __ LDA (T4 + 0),y
+0e73 : 85 5b __ STA T13 + 1
+0e75 : 85 04 __ STA $04
+0e77 : c8 __ __ INY
+0e78 : b1 4b __ LDA (T4 + 0),y
+0e7a : 85 5c __ STA T13 + 2
+0e7c : 85 05 __ STA $05
+0e7e : c8 __ __ INY
+0e7f : b1 4b __ LDA (T4 + 0),y
+0e81 : 85 5d __ STA T13 + 3
+0e83 : 85 06 __ STA $06
+0e85 : a5 49 __ LDA T3 + 0
+0e87 : 85 45 __ STA T1 + 0
+0e89 : a9 00 __ LDA #$00
+0e8b : 85 1b __ STA ACCU + 0
+0e8d : 85 1c __ STA ACCU + 1
+0e8f : 85 1d __ STA ACCU + 2
+0e91 : 85 1e __ STA ACCU + 3
+0e93 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0e96 : 10 03 __ BPL $0e9b
+0e98 : 4c af 14 JMP $14af ; (printf + 2134)
+0e9b : a9 00 __ LDA #$00
+0e9d : 85 49 __ STA T3 + 0
+0e9f : ad be 23 LDA $23be ; (sframe + 55)
+0ea2 : f0 09 __ BEQ $0ead
+0ea4 : a9 2b __ LDA #$2b
+0ea6 : 8d 87 23 STA $2387 ; (sframe + 0)
+0ea9 : a9 01 __ LDA #$01
+0eab : 85 49 __ STA T3 + 0
+0ead : a9 00 __ LDA #$00
+0eaf : 85 51 __ STA T7 + 0
+0eb1 : 85 52 __ STA T7 + 1
+0eb3 : ad bb 23 LDA $23bb ; (sframe + 52)
+0eb6 : 85 4d __ STA T5 + 0
+0eb8 : c9 ff __ CMP #$ff
+0eba : d0 04 __ BNE $0ec0
+0ebc : a9 06 __ LDA #$06
+0ebe : 85 4d __ STA T5 + 0
+0ec0 : a9 00 __ LDA #$00
+0ec2 : 85 1b __ STA ACCU + 0
+0ec4 : 85 1c __ STA ACCU + 1
+0ec6 : 85 1d __ STA ACCU + 2
+0ec8 : 85 1e __ STA ACCU + 3
+0eca : a5 5a __ LDA T13 + 0
+0ecc : 85 03 __ STA $03
+0ece : a5 5b __ LDA T13 + 1
+0ed0 : 85 04 __ STA $04
+0ed2 : a5 5c __ LDA T13 + 2
+0ed4 : 85 05 __ STA $05
+0ed6 : a5 5d __ LDA T13 + 3
+0ed8 : 85 06 __ STA $06
+0eda : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0edd : d0 03 __ BNE $0ee2
+0edf : 4c 56 10 JMP $1056 ; (printf + 1021)
+0ee2 : a9 00 __ LDA #$00
+0ee4 : 85 1b __ STA ACCU + 0
+0ee6 : 85 1c __ STA ACCU + 1
+0ee8 : a9 7a __ LDA #$7a
+0eea : 85 1d __ STA ACCU + 2
+0eec : a9 44 __ LDA #$44
+0eee : 85 1e __ STA ACCU + 3
+0ef0 : a5 5a __ LDA T13 + 0
+0ef2 : 85 03 __ STA $03
+0ef4 : a5 5b __ LDA T13 + 1
+0ef6 : 85 04 __ STA $04
+0ef8 : a5 5c __ LDA T13 + 2
+0efa : 85 05 __ STA $05
+0efc : a5 5d __ LDA T13 + 3
+0efe : 85 06 __ STA $06
+0f00 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0f03 : 30 5a __ BMI $0f5f
+0f05 : 18 __ __ CLC
+0f06 : a5 51 __ LDA T7 + 0
+0f08 : 69 03 __ ADC #$03
+0f0a : 85 51 __ STA T7 + 0
+0f0c : 90 02 __ BCC $0f10
+0f0e : e6 52 __ INC T7 + 1
+0f10 : a5 5a __ LDA T13 + 0
+0f12 : 85 1b __ STA ACCU + 0
+0f14 : a5 5b __ LDA T13 + 1
+0f16 : 85 1c __ STA ACCU + 1
+0f18 : a5 5c __ LDA T13 + 2
+0f1a : 85 1d __ STA ACCU + 2
+0f1c : a5 5d __ LDA T13 + 3
+0f1e : 85 1e __ STA ACCU + 3
+0f20 : a9 00 __ LDA #$00
+0f22 : 85 03 __ STA $03
+0f24 : 85 04 __ STA $04
+0f26 : a9 7a __ LDA #$7a
+0f28 : 85 05 __ STA $05
+0f2a : a9 44 __ LDA #$44
+0f2c : 85 06 __ STA $06
+0f2e : 20 4b 1f JSR $1f4b ; (freg + 20)
+0f31 : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+0f34 : a5 1b __ LDA ACCU + 0
+0f36 : 85 5a __ STA T13 + 0
+0f38 : 85 03 __ STA $03
+0f3a : a5 1c __ LDA ACCU + 1
+0f3c : 85 5b __ STA T13 + 1
+0f3e : 85 04 __ STA $04
+0f40 : a5 1d __ LDA ACCU + 2
+0f42 : 85 5c __ STA T13 + 2
+0f44 : 85 05 __ STA $05
+0f46 : a5 1e __ LDA ACCU + 3
+0f48 : 85 5d __ STA T13 + 3
+0f4a : 85 06 __ STA $06
+0f4c : a9 00 __ LDA #$00
+0f4e : 85 1b __ STA ACCU + 0
+0f50 : 85 1c __ STA ACCU + 1
+0f52 : a9 7a __ LDA #$7a
+0f54 : 85 1d __ STA ACCU + 2
+0f56 : a9 44 __ LDA #$44
+0f58 : 85 1e __ STA ACCU + 3
+0f5a : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0f5d : 10 a6 __ BPL $0f05
+0f5f : a9 00 __ LDA #$00
+0f61 : 85 1b __ STA ACCU + 0
+0f63 : 85 1c __ STA ACCU + 1
+0f65 : a9 80 __ LDA #$80
+0f67 : 85 1d __ STA ACCU + 2
+0f69 : a9 3f __ LDA #$3f
+0f6b : 85 1e __ STA ACCU + 3
+0f6d : a5 5a __ LDA T13 + 0
+0f6f : 85 03 __ STA $03
+0f71 : a5 5b __ LDA T13 + 1
+0f73 : 85 04 __ STA $04
+0f75 : a5 5c __ LDA T13 + 2
+0f77 : 85 05 __ STA $05
+0f79 : a5 5d __ LDA T13 + 3
+0f7b : 85 06 __ STA $06
+0f7d : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0f80 : 10 5c __ BPL $0fde
+0f82 : 38 __ __ SEC
+0f83 : a5 51 __ LDA T7 + 0
+0f85 : e9 03 __ SBC #$03
+0f87 : 85 51 __ STA T7 + 0
+0f89 : a5 52 __ LDA T7 + 1
+0f8b : e9 00 __ SBC #$00
+0f8d : 85 52 __ STA T7 + 1
+0f8f : a5 5a __ LDA T13 + 0
+0f91 : 85 1b __ STA ACCU + 0
+0f93 : a5 5b __ LDA T13 + 1
+0f95 : 85 1c __ STA ACCU + 1
+0f97 : a5 5c __ LDA T13 + 2
+0f99 : 85 1d __ STA ACCU + 2
+0f9b : a5 5d __ LDA T13 + 3
+0f9d : 85 1e __ STA ACCU + 3
+0f9f : a9 00 __ LDA #$00
+0fa1 : 85 03 __ STA $03
+0fa3 : 85 04 __ STA $04
+0fa5 : a9 7a __ LDA #$7a
+0fa7 : 85 05 __ STA $05
+0fa9 : a9 44 __ LDA #$44
+0fab : 85 06 __ STA $06
+0fad : 20 4b 1f JSR $1f4b ; (freg + 20)
+0fb0 : 20 44 20 JSR $2044 ; (fmul + 0)
+0fb3 : a5 1b __ LDA ACCU + 0
+0fb5 : 85 5a __ STA T13 + 0
+0fb7 : 85 03 __ STA $03
+0fb9 : a5 1c __ LDA ACCU + 1
+0fbb : 85 5b __ STA T13 + 1
+0fbd : 85 04 __ STA $04
+0fbf : a5 1d __ LDA ACCU + 2
+0fc1 : 85 5c __ STA T13 + 2
+0fc3 : 85 05 __ STA $05
+0fc5 : a5 1e __ LDA ACCU + 3
+0fc7 : 85 5d __ STA T13 + 3
+0fc9 : 85 06 __ STA $06
+0fcb : a9 00 __ LDA #$00
+0fcd : 85 1b __ STA ACCU + 0
+0fcf : 85 1c __ STA ACCU + 1
+0fd1 : a9 80 __ LDA #$80
+0fd3 : 85 1d __ STA ACCU + 2
+0fd5 : a9 3f __ LDA #$3f
+0fd7 : 85 1e __ STA ACCU + 3
+0fd9 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0fdc : 30 a4 __ BMI $0f82
+0fde : a9 00 __ LDA #$00
+0fe0 : 85 1b __ STA ACCU + 0
+0fe2 : 85 1c __ STA ACCU + 1
+0fe4 : a9 20 __ LDA #$20
+0fe6 : 85 1d __ STA ACCU + 2
+0fe8 : a9 41 __ LDA #$41
+0fea : 85 1e __ STA ACCU + 3
+0fec : a5 5a __ LDA T13 + 0
+0fee : 85 03 __ STA $03
+0ff0 : a5 5b __ LDA T13 + 1
+0ff2 : 85 04 __ STA $04
+0ff4 : a5 5c __ LDA T13 + 2
+0ff6 : 85 05 __ STA $05
+0ff8 : a5 5d __ LDA T13 + 3
+0ffa : 85 06 __ STA $06
+0ffc : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+0fff : 30 55 __ BMI $1056
+1001 : e6 51 __ INC T7 + 0
+1003 : d0 02 __ BNE $1007
+1005 : e6 52 __ INC T7 + 1
+1007 : a5 5a __ LDA T13 + 0
+1009 : 85 1b __ STA ACCU + 0
+100b : a5 5b __ LDA T13 + 1
+100d : 85 1c __ STA ACCU + 1
+100f : a5 5c __ LDA T13 + 2
+1011 : 85 1d __ STA ACCU + 2
+1013 : a5 5d __ LDA T13 + 3
+1015 : 85 1e __ STA ACCU + 3
+1017 : a9 00 __ LDA #$00
+1019 : 85 03 __ STA $03
+101b : 85 04 __ STA $04
+101d : a9 20 __ LDA #$20
+101f : 85 05 __ STA $05
+1021 : a9 41 __ LDA #$41
+1023 : 85 06 __ STA $06
+1025 : 20 4b 1f JSR $1f4b ; (freg + 20)
+1028 : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+102b : a5 1b __ LDA ACCU + 0
+102d : 85 5a __ STA T13 + 0
+102f : 85 03 __ STA $03
+1031 : a5 1c __ LDA ACCU + 1
+1033 : 85 5b __ STA T13 + 1
+1035 : 85 04 __ STA $04
+1037 : a5 1d __ LDA ACCU + 2
+1039 : 85 5c __ STA T13 + 2
+103b : 85 05 __ STA $05
+103d : a5 1e __ LDA ACCU + 3
+103f : 85 5d __ STA T13 + 3
+1041 : 85 06 __ STA $06
+1043 : a9 00 __ LDA #$00
+1045 : 85 1b __ STA ACCU + 0
+1047 : 85 1c __ STA ACCU + 1
+1049 : a9 20 __ LDA #$20
+104b : 85 1d __ STA ACCU + 2
+104d : a9 41 __ LDA #$41
+104f : 85 1e __ STA ACCU + 3
+1051 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+1054 : 10 ab __ BPL $1001
+1056 : a5 45 __ LDA T1 + 0
+1058 : c9 65 __ CMP #$65
+105a : d0 03 __ BNE $105f
+105c : 4c aa 14 JMP $14aa ; (printf + 2129)
+105f : a9 00 __ LDA #$00
+1061 : 85 59 __ STA T12 + 0
+1063 : 85 66 __ STA T17 + 0
+1065 : a5 4d __ LDA T5 + 0
+1067 : 85 53 __ STA T8 + 0
+1069 : e6 53 __ INC T8 + 0
+106b : a5 45 __ LDA T1 + 0
+106d : c9 67 __ CMP #$67
+106f : d0 03 __ BNE $1074
+1071 : 4c 8d 14 JMP $148d ; (printf + 2100)
+1074 : a5 59 __ LDA T12 + 0
+1076 : f0 03 __ BEQ $107b
+1078 : 4c 9b 13 JMP $139b ; (printf + 1858)
+107b : a5 52 __ LDA T7 + 1
+107d : 10 03 __ BPL $1082
+107f : 4c 5a 13 JMP $135a ; (printf + 1793)
+1082 : a9 00 __ LDA #$00
+1084 : 85 5e __ STA T14 + 0
+1086 : 85 5f __ STA T14 + 1
+1088 : 85 60 __ STA T14 + 2
+108a : a9 3f __ LDA #$3f
+108c : 85 61 __ STA T14 + 3
+108e : 18 __ __ CLC
+108f : a5 4d __ LDA T5 + 0
+1091 : 65 51 __ ADC T7 + 0
+1093 : 85 53 __ STA T8 + 0
+1095 : e6 53 __ INC T8 + 0
+1097 : a9 01 __ LDA #$01
+1099 : c5 53 __ CMP T8 + 0
+109b : b0 03 __ BCS $10a0
+109d : 4c 19 13 JMP $1319 ; (printf + 1728)
+10a0 : a5 5a __ LDA T13 + 0
+10a2 : 85 1b __ STA ACCU + 0
+10a4 : a5 5b __ LDA T13 + 1
+10a6 : 85 1c __ STA ACCU + 1
+10a8 : a5 5c __ LDA T13 + 2
+10aa : 85 1d __ STA ACCU + 2
+10ac : a5 5d __ LDA T13 + 3
+10ae : 85 1e __ STA ACCU + 3
+10b0 : a5 5e __ LDA T14 + 0
+10b2 : 85 03 __ STA $03
+10b4 : a5 5f __ LDA T14 + 1
+10b6 : 85 04 __ STA $04
+10b8 : a5 60 __ LDA T14 + 2
+10ba : 85 05 __ STA $05
+10bc : a5 61 __ LDA T14 + 3
+10be : 85 06 __ STA $06
+10c0 : 20 4b 1f JSR $1f4b ; (freg + 20)
+10c3 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+10c6 : a5 1b __ LDA ACCU + 0
+10c8 : 85 5e __ STA T14 + 0
+10ca : 85 5a __ STA T13 + 0
+10cc : 85 03 __ STA $03
+10ce : a5 1c __ LDA ACCU + 1
+10d0 : 85 5f __ STA T14 + 1
+10d2 : 85 5b __ STA T13 + 1
+10d4 : 85 04 __ STA $04
+10d6 : a5 1d __ LDA ACCU + 2
+10d8 : 85 60 __ STA T14 + 2
+10da : 85 5c __ STA T13 + 2
+10dc : 85 05 __ STA $05
+10de : a5 1e __ LDA ACCU + 3
+10e0 : 85 61 __ STA T14 + 3
+10e2 : 85 5d __ STA T13 + 3
+10e4 : 85 06 __ STA $06
+10e6 : a9 00 __ LDA #$00
+10e8 : 85 1b __ STA ACCU + 0
+10ea : 85 1c __ STA ACCU + 1
+10ec : a9 20 __ LDA #$20
+10ee : 85 1d __ STA ACCU + 2
+10f0 : a9 41 __ LDA #$41
+10f2 : 85 1e __ STA ACCU + 3
+10f4 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+10f7 : 30 36 __ BMI $112f
+10f9 : a5 5a __ LDA T13 + 0
+10fb : 85 1b __ STA ACCU + 0
+10fd : a5 5b __ LDA T13 + 1
+10ff : 85 1c __ STA ACCU + 1
+1101 : a5 5c __ LDA T13 + 2
+1103 : 85 1d __ STA ACCU + 2
+1105 : a5 5d __ LDA T13 + 3
+1107 : 85 1e __ STA ACCU + 3
+1109 : a9 00 __ LDA #$00
+110b : 85 03 __ STA $03
+110d : 85 04 __ STA $04
+110f : a9 20 __ LDA #$20
+1111 : 85 05 __ STA $05
+1113 : a9 41 __ LDA #$41
+1115 : 85 06 __ STA $06
+1117 : 20 4b 1f JSR $1f4b ; (freg + 20)
+111a : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+111d : a5 1b __ LDA ACCU + 0
+111f : 85 5e __ STA T14 + 0
+1121 : a5 1c __ LDA ACCU + 1
+1123 : 85 5f __ STA T14 + 1
+1125 : a5 1d __ LDA ACCU + 2
+1127 : 85 60 __ STA T14 + 2
+1129 : a5 1e __ LDA ACCU + 3
+112b : 85 61 __ STA T14 + 3
+112d : c6 4d __ DEC T5 + 0
+112f : 38 __ __ SEC
+1130 : a5 53 __ LDA T8 + 0
+1132 : e5 4d __ SBC T5 + 0
+1134 : 85 55 __ STA T9 + 0
+1136 : 85 45 __ STA T1 + 0
+1138 : a9 14 __ LDA #$14
+113a : c5 53 __ CMP T8 + 0
+113c : b0 02 __ BCS $1140
+113e : 85 53 __ STA T8 + 0
+1140 : a5 55 __ LDA T9 + 0
+1142 : d0 09 __ BNE $114d
+1144 : a9 30 __ LDA #$30
+1146 : a4 49 __ LDY T3 + 0
+1148 : 99 87 23 STA $2387,y ; (sframe + 0)
+114b : e6 49 __ INC T3 + 0
+114d : a9 00 __ LDA #$00
+114f : 85 4d __ STA T5 + 0
+1151 : a5 53 __ LDA T8 + 0
+1153 : f0 03 __ BEQ $1158
+1155 : 4c 8a 12 JMP $128a ; (printf + 1585)
+1158 : a5 66 __ LDA T17 + 0
+115a : f0 03 __ BEQ $115f
+115c : 4c 06 12 JMP $1206 ; (printf + 1453)
+115f : a5 49 __ LDA T3 + 0
+1161 : cd ba 23 CMP $23ba ; (sframe + 51)
+1164 : 90 1c __ BCC $1182
+1166 : 85 45 __ STA T1 + 0
+1168 : 18 __ __ CLC
+1169 : a5 4b __ LDA T4 + 0
+116b : 69 04 __ ADC #$04
+116d : 85 4b __ STA T4 + 0
+116f : 90 02 __ BCC $1173
+1171 : e6 4c __ INC T4 + 1
+1173 : a0 00 __ LDY #$00
+1175 : b1 47 __ LDA (T2 + 0),y
+1177 : 85 4d __ STA T5 + 0
+1179 : e6 47 __ INC T2 + 0
+117b : d0 02 __ BNE $117f
+117d : e6 48 __ INC T2 + 1
+117f : 4c d6 0c JMP $0cd6 ; (printf + 125)
+1182 : c9 01 __ CMP #$01
+1184 : 90 4f __ BCC $11d5
+1186 : a9 01 __ LDA #$01
+1188 : 85 45 __ STA T1 + 0
+118a : ad ba 23 LDA $23ba ; (sframe + 51)
+118d : 85 51 __ STA T7 + 0
+118f : a5 49 __ LDA T3 + 0
+1191 : 85 53 __ STA T8 + 0
+1193 : 38 __ __ SEC
+1194 : a5 53 __ LDA T8 + 0
+1196 : e5 45 __ SBC T1 + 0
+1198 : 85 57 __ STA T10 + 0
+119a : a9 00 __ LDA #$00
+119c : e9 00 __ SBC #$00
+119e : 85 58 __ STA T10 + 1
+11a0 : 18 __ __ CLC
+11a1 : a9 87 __ LDA #$87
+11a3 : 65 57 __ ADC T10 + 0
+11a5 : 85 57 __ STA T10 + 0
+11a7 : a9 23 __ LDA #$23
+11a9 : 65 58 __ ADC T10 + 1
+11ab : 85 58 __ STA T10 + 1
+11ad : 38 __ __ SEC
+11ae : a5 51 __ LDA T7 + 0
+11b0 : e5 45 __ SBC T1 + 0
+11b2 : 85 55 __ STA T9 + 0
+11b4 : a9 00 __ LDA #$00
+11b6 : e9 00 __ SBC #$00
+11b8 : 85 56 __ STA T9 + 1
+11ba : 18 __ __ CLC
+11bb : a9 87 __ LDA #$87
+11bd : 65 55 __ ADC T9 + 0
+11bf : 85 55 __ STA T9 + 0
+11c1 : a9 23 __ LDA #$23
+11c3 : 65 56 __ ADC T9 + 1
+11c5 : 85 56 __ STA T9 + 1
+11c7 : a0 00 __ LDY #$00
+11c9 : b1 57 __ LDA (T10 + 0),y
+11cb : 91 55 __ STA (T9 + 0),y
+11cd : e6 45 __ INC T1 + 0
+11cf : a5 49 __ LDA T3 + 0
+11d1 : c5 45 __ CMP T1 + 0
+11d3 : b0 be __ BCS $1193
+11d5 : a9 00 __ LDA #$00
+11d7 : 85 45 __ STA T1 + 0
+11d9 : ad ba 23 LDA $23ba ; (sframe + 51)
+11dc : 85 51 __ STA T7 + 0
+11de : 38 __ __ SEC
+11df : e5 49 __ SBC T3 + 0
+11e1 : 85 53 __ STA T8 + 0
+11e3 : a9 00 __ LDA #$00
+11e5 : e9 00 __ SBC #$00
+11e7 : 85 54 __ STA T8 + 1
+11e9 : a9 00 __ LDA #$00
+11eb : c5 54 __ CMP T8 + 1
+11ed : d0 04 __ BNE $11f3
+11ef : a5 45 __ LDA T1 + 0
+11f1 : c5 53 __ CMP T8 + 0
+11f3 : 90 05 __ BCC $11fa
+11f5 : a5 51 __ LDA T7 + 0
+11f7 : 4c 66 11 JMP $1166 ; (printf + 1293)
+11fa : a9 20 __ LDA #$20
+11fc : a4 45 __ LDY T1 + 0
+11fe : 99 87 23 STA $2387,y ; (sframe + 0)
+1201 : e6 45 __ INC T1 + 0
+1203 : 4c e9 11 JMP $11e9 ; (printf + 1424)
+1206 : a9 45 __ LDA #$45
+1208 : a4 49 __ LDY T3 + 0
+120a : 99 87 23 STA $2387,y ; (sframe + 0)
+120d : c8 __ __ INY
+120e : a5 52 __ LDA T7 + 1
+1210 : 30 5c __ BMI $126e
+1212 : a9 2b __ LDA #$2b
+1214 : 99 87 23 STA $2387,y ; (sframe + 0)
+1217 : 18 __ __ CLC
+1218 : a5 49 __ LDA T3 + 0
+121a : 69 02 __ ADC #$02
+121c : 85 45 __ STA T1 + 0
+121e : a5 51 __ LDA T7 + 0
+1220 : 85 1b __ STA ACCU + 0
+1222 : a5 52 __ LDA T7 + 1
+1224 : 85 1c __ STA ACCU + 1
+1226 : a9 0a __ LDA #$0a
+1228 : 85 03 __ STA $03
+122a : a9 00 __ LDA #$00
+122c : 85 04 __ STA $04
+122e : 20 60 21 JSR $2160 ; (divs16 + 0)
+1231 : 18 __ __ CLC
+1232 : a5 1b __ LDA ACCU + 0
+1234 : 69 30 __ ADC #$30
+1236 : a4 45 __ LDY T1 + 0
+1238 : 99 87 23 STA $2387,y ; (sframe + 0)
+123b : c8 __ __ INY
+123c : 98 __ __ TYA
+123d : 18 __ __ CLC
+123e : 69 87 __ ADC #$87
+1240 : 85 53 __ STA T8 + 0
+1242 : a9 23 __ LDA #$23
+1244 : 69 00 __ ADC #$00
+1246 : 85 54 __ STA T8 + 1
+1248 : a5 51 __ LDA T7 + 0
+124a : 85 1b __ STA ACCU + 0
+124c : a5 52 __ LDA T7 + 1
+124e : 85 1c __ STA ACCU + 1
+1250 : a9 0a __ LDA #$0a
+1252 : 85 03 __ STA $03
+1254 : a9 00 __ LDA #$00
+1256 : 85 04 __ STA $04
+1258 : 20 1f 22 JSR $221f ; (mods16 + 0)
+125b : 18 __ __ CLC
+125c : a5 05 __ LDA $05
+125e : 69 30 __ ADC #$30
+1260 : a0 00 __ LDY #$00
+1262 : 91 53 __ STA (T8 + 0),y
+1264 : 18 __ __ CLC
+1265 : a5 45 __ LDA T1 + 0
+1267 : 69 02 __ ADC #$02
+1269 : 85 49 __ STA T3 + 0
+126b : 4c 5f 11 JMP $115f ; (printf + 1286)
+126e : a9 2d __ LDA #$2d
+1270 : 99 87 23 STA $2387,y ; (sframe + 0)
+1273 : 18 __ __ CLC
+1274 : a5 49 __ LDA T3 + 0
+1276 : 69 02 __ ADC #$02
+1278 : 85 45 __ STA T1 + 0
+127a : 38 __ __ SEC
+127b : a9 00 __ LDA #$00
+127d : e5 51 __ SBC T7 + 0
+127f : 85 51 __ STA T7 + 0
+1281 : a9 00 __ LDA #$00
+1283 : e5 52 __ SBC T7 + 1
+1285 : 85 52 __ STA T7 + 1
+1287 : 4c 1e 12 JMP $121e ; (printf + 1477)
+128a : a5 4d __ LDA T5 + 0
+128c : c5 45 __ CMP T1 + 0
+128e : d0 09 __ BNE $1299
+1290 : a9 2e __ LDA #$2e
+1292 : a4 49 __ LDY T3 + 0
+1294 : 99 87 23 STA $2387,y ; (sframe + 0)
+1297 : e6 49 __ INC T3 + 0
+1299 : a5 5e __ LDA T14 + 0
+129b : 85 1b __ STA ACCU + 0
+129d : a5 5f __ LDA T14 + 1
+129f : 85 1c __ STA ACCU + 1
+12a1 : a5 60 __ LDA T14 + 2
+12a3 : 85 1d __ STA ACCU + 2
+12a5 : a5 61 __ LDA T14 + 3
+12a7 : 85 1e __ STA ACCU + 3
+12a9 : 20 48 22 JSR $2248 ; (f32_to_i16 + 0)
+12ac : 18 __ __ CLC
+12ad : a5 1b __ LDA ACCU + 0
+12af : 69 30 __ ADC #$30
+12b1 : a4 49 __ LDY T3 + 0
+12b3 : 99 87 23 STA $2387,y ; (sframe + 0)
+12b6 : 20 8a 22 JSR $228a ; (sint16_to_float + 0)
+12b9 : a5 1b __ LDA ACCU + 0
+12bb : 85 03 __ STA $03
+12bd : a5 1c __ LDA ACCU + 1
+12bf : 85 04 __ STA $04
+12c1 : a5 1d __ LDA ACCU + 2
+12c3 : 85 05 __ STA $05
+12c5 : a5 1e __ LDA ACCU + 3
+12c7 : 85 06 __ STA $06
+12c9 : a5 5e __ LDA T14 + 0
+12cb : 85 1b __ STA ACCU + 0
+12cd : a5 5f __ LDA T14 + 1
+12cf : 85 1c __ STA ACCU + 1
+12d1 : a5 60 __ LDA T14 + 2
+12d3 : 85 1d __ STA ACCU + 2
+12d5 : a5 61 __ LDA T14 + 3
+12d7 : 85 1e __ STA ACCU + 3
+12d9 : 20 4b 1f JSR $1f4b ; (freg + 20)
+12dc : a5 06 __ LDA $06
+12de : 49 80 __ EOR #$80
+12e0 : 85 06 __ STA $06
+12e2 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+12e5 : a9 00 __ LDA #$00
+12e7 : 85 03 __ STA $03
+12e9 : 85 04 __ STA $04
+12eb : a9 20 __ LDA #$20
+12ed : 85 05 __ STA $05
+12ef : a9 41 __ LDA #$41
+12f1 : 85 06 __ STA $06
+12f3 : 20 4b 1f JSR $1f4b ; (freg + 20)
+12f6 : 20 44 20 JSR $2044 ; (fmul + 0)
+12f9 : a5 1b __ LDA ACCU + 0
+12fb : 85 5e __ STA T14 + 0
+12fd : a5 1c __ LDA ACCU + 1
+12ff : 85 5f __ STA T14 + 1
+1301 : a5 1d __ LDA ACCU + 2
+1303 : 85 60 __ STA T14 + 2
+1305 : a5 1e __ LDA ACCU + 3
+1307 : 85 61 __ STA T14 + 3
+1309 : e6 49 __ INC T3 + 0
+130b : e6 4d __ INC T5 + 0
+130d : a5 4d __ LDA T5 + 0
+130f : c5 53 __ CMP T8 + 0
+1311 : b0 03 __ BCS $1316
+1313 : 4c 8a 12 JMP $128a ; (printf + 1585)
+1316 : 4c 58 11 JMP $1158 ; (printf + 1279)
+1319 : 85 45 __ STA T1 + 0
+131b : a5 5e __ LDA T14 + 0
+131d : 85 1b __ STA ACCU + 0
+131f : a5 5f __ LDA T14 + 1
+1321 : 85 1c __ STA ACCU + 1
+1323 : a5 60 __ LDA T14 + 2
+1325 : 85 1d __ STA ACCU + 2
+1327 : a5 61 __ LDA T14 + 3
+1329 : 85 1e __ STA ACCU + 3
+132b : a9 00 __ LDA #$00
+132d : 85 03 __ STA $03
+132f : 85 04 __ STA $04
+1331 : a9 20 __ LDA #$20
+1333 : 85 05 __ STA $05
+1335 : a9 41 __ LDA #$41
+1337 : 85 06 __ STA $06
+1339 : 20 4b 1f JSR $1f4b ; (freg + 20)
+133c : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+133f : a5 1b __ LDA ACCU + 0
+1341 : 85 5e __ STA T14 + 0
+1343 : a5 1c __ LDA ACCU + 1
+1345 : 85 5f __ STA T14 + 1
+1347 : a5 1d __ LDA ACCU + 2
+1349 : 85 60 __ STA T14 + 2
+134b : a5 1e __ LDA ACCU + 3
+134d : 85 61 __ STA T14 + 3
+134f : e6 45 __ INC T1 + 0
+1351 : a5 45 __ LDA T1 + 0
+1353 : c5 53 __ CMP T8 + 0
+1355 : 90 c4 __ BCC $131b
+1357 : 4c a0 10 JMP $10a0 ; (printf + 1095)
+135a : a5 5a __ LDA T13 + 0
+135c : 85 1b __ STA ACCU + 0
+135e : a5 5b __ LDA T13 + 1
+1360 : 85 1c __ STA ACCU + 1
+1362 : a5 5c __ LDA T13 + 2
+1364 : 85 1d __ STA ACCU + 2
+1366 : a5 5d __ LDA T13 + 3
+1368 : 85 1e __ STA ACCU + 3
+136a : a9 00 __ LDA #$00
+136c : 85 03 __ STA $03
+136e : 85 04 __ STA $04
+1370 : a9 20 __ LDA #$20
+1372 : 85 05 __ STA $05
+1374 : a9 41 __ LDA #$41
+1376 : 85 06 __ STA $06
+1378 : 20 4b 1f JSR $1f4b ; (freg + 20)
+137b : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+137e : a5 1b __ LDA ACCU + 0
+1380 : 85 5a __ STA T13 + 0
+1382 : a5 1c __ LDA ACCU + 1
+1384 : 85 5b __ STA T13 + 1
+1386 : a5 1d __ LDA ACCU + 2
+1388 : 85 5c __ STA T13 + 2
+138a : a5 1e __ LDA ACCU + 3
+138c : 85 5d __ STA T13 + 3
+138e : e6 51 __ INC T7 + 0
+1390 : d0 02 __ BNE $1394
+1392 : e6 52 __ INC T7 + 1
+1394 : a5 52 __ LDA T7 + 1
+1396 : 30 c2 __ BMI $135a
+1398 : 4c 82 10 JMP $1082 ; (printf + 1065)
+139b : a9 00 __ LDA #$00
+139d : 85 5e __ STA T14 + 0
+139f : 85 5f __ STA T14 + 1
+13a1 : 85 60 __ STA T14 + 2
+13a3 : a9 3f __ LDA #$3f
+13a5 : 85 61 __ STA T14 + 3
+13a7 : a5 4d __ LDA T5 + 0
+13a9 : f0 03 __ BEQ $13ae
+13ab : 4c 4a 14 JMP $144a ; (printf + 2033)
+13ae : a5 5a __ LDA T13 + 0
+13b0 : 85 1b __ STA ACCU + 0
+13b2 : a5 5b __ LDA T13 + 1
+13b4 : 85 1c __ STA ACCU + 1
+13b6 : a5 5c __ LDA T13 + 2
+13b8 : 85 1d __ STA ACCU + 2
+13ba : a5 5d __ LDA T13 + 3
+13bc : 85 1e __ STA ACCU + 3
+13be : a5 5e __ LDA T14 + 0
+13c0 : 85 03 __ STA $03
+13c2 : a5 5f __ LDA T14 + 1
+13c4 : 85 04 __ STA $04
+13c6 : a5 60 __ LDA T14 + 2
+13c8 : 85 05 __ STA $05
+13ca : a5 61 __ LDA T14 + 3
+13cc : 85 06 __ STA $06
+13ce : 20 4b 1f JSR $1f4b ; (freg + 20)
+13d1 : 20 7c 1f JSR $1f7c ; (faddsub + 0)
+13d4 : a5 1b __ LDA ACCU + 0
+13d6 : 85 5e __ STA T14 + 0
+13d8 : 85 5a __ STA T13 + 0
+13da : 85 03 __ STA $03
+13dc : a5 1c __ LDA ACCU + 1
+13de : 85 5f __ STA T14 + 1
+13e0 : 85 5b __ STA T13 + 1
+13e2 : 85 04 __ STA $04
+13e4 : a5 1d __ LDA ACCU + 2
+13e6 : 85 60 __ STA T14 + 2
+13e8 : 85 5c __ STA T13 + 2
+13ea : 85 05 __ STA $05
+13ec : a5 1e __ LDA ACCU + 3
+13ee : 85 61 __ STA T14 + 3
+13f0 : 85 5d __ STA T13 + 3
+13f2 : 85 06 __ STA $06
+13f4 : a9 00 __ LDA #$00
+13f6 : 85 1b __ STA ACCU + 0
+13f8 : 85 1c __ STA ACCU + 1
+13fa : a9 20 __ LDA #$20
+13fc : 85 1d __ STA ACCU + 2
+13fe : a9 41 __ LDA #$41
+1400 : 85 1e __ STA ACCU + 3
+1402 : 20 d5 22 JSR $22d5 ; (fcmp + 0)
+1405 : 10 03 __ BPL $140a
+1407 : 4c 2f 11 JMP $112f ; (printf + 1238)
+140a : a5 5a __ LDA T13 + 0
+140c : 85 1b __ STA ACCU + 0
+140e : a5 5b __ LDA T13 + 1
+1410 : 85 1c __ STA ACCU + 1
+1412 : a5 5c __ LDA T13 + 2
+1414 : 85 1d __ STA ACCU + 2
+1416 : a5 5d __ LDA T13 + 3
+1418 : 85 1e __ STA ACCU + 3
+141a : a9 00 __ LDA #$00
+141c : 85 03 __ STA $03
+141e : 85 04 __ STA $04
+1420 : a9 20 __ LDA #$20
+1422 : 85 05 __ STA $05
+1424 : a9 41 __ LDA #$41
+1426 : 85 06 __ STA $06
+1428 : 20 4b 1f JSR $1f4b ; (freg + 20)
+142b : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+142e : a5 1b __ LDA ACCU + 0
+1430 : 85 5e __ STA T14 + 0
+1432 : a5 1c __ LDA ACCU + 1
+1434 : 85 5f __ STA T14 + 1
+1436 : a5 1d __ LDA ACCU + 2
+1438 : 85 60 __ STA T14 + 2
+143a : a5 1e __ LDA ACCU + 3
+143c : 85 61 __ STA T14 + 3
+143e : e6 51 __ INC T7 + 0
+1440 : f0 03 __ BEQ $1445
+1442 : 4c 2f 11 JMP $112f ; (printf + 1238)
+1445 : e6 52 __ INC T7 + 1
+1447 : 4c 2f 11 JMP $112f ; (printf + 1238)
+144a : a9 00 __ LDA #$00
+144c : 85 45 __ STA T1 + 0
+144e : a5 5e __ LDA T14 + 0
+1450 : 85 1b __ STA ACCU + 0
+1452 : a5 5f __ LDA T14 + 1
+1454 : 85 1c __ STA ACCU + 1
+1456 : a5 60 __ LDA T14 + 2
+1458 : 85 1d __ STA ACCU + 2
+145a : a5 61 __ LDA T14 + 3
+145c : 85 1e __ STA ACCU + 3
+145e : a9 00 __ LDA #$00
+1460 : 85 03 __ STA $03
+1462 : 85 04 __ STA $04
+1464 : a9 20 __ LDA #$20
+1466 : 85 05 __ STA $05
+1468 : a9 41 __ LDA #$41
+146a : 85 06 __ STA $06
+146c : 20 4b 1f JSR $1f4b ; (freg + 20)
+146f : 20 e2 20 JSR $20e2 ; (fdiv + 0)
+1472 : a5 1b __ LDA ACCU + 0
+1474 : 85 5e __ STA T14 + 0
+1476 : a5 1c __ LDA ACCU + 1
+1478 : 85 5f __ STA T14 + 1
+147a : a5 1d __ LDA ACCU + 2
+147c : 85 60 __ STA T14 + 2
+147e : a5 1e __ LDA ACCU + 3
+1480 : 85 61 __ STA T14 + 3
+1482 : e6 45 __ INC T1 + 0
+1484 : a5 45 __ LDA T1 + 0
+1486 : c5 4d __ CMP T5 + 0
+1488 : 90 c4 __ BCC $144e
+148a : 4c ae 13 JMP $13ae ; (printf + 1877)
+148d : a5 52 __ LDA T7 + 1
+148f : 10 0e __ BPL $149f
+1491 : a5 52 __ LDA T7 + 1
+1493 : 30 03 __ BMI $1498
+1495 : 4c 74 10 JMP $1074 ; (printf + 1051)
+1498 : a9 01 __ LDA #$01
+149a : 85 66 __ STA T17 + 0
+149c : 4c 9b 13 JMP $139b ; (printf + 1858)
+149f : d0 f7 __ BNE $1498
+14a1 : a9 03 __ LDA #$03
+14a3 : c5 51 __ CMP T7 + 0
+14a5 : 90 f1 __ BCC $1498
+14a7 : 4c 91 14 JMP $1491 ; (printf + 2104)
+14aa : a9 01 __ LDA #$01
+14ac : 4c 61 10 JMP $1061 ; (printf + 1032)
+14af : a9 2d __ LDA #$2d
+14b1 : 8d 87 23 STA $2387 ; (sframe + 0)
+14b4 : a9 01 __ LDA #$01
+14b6 : 85 49 __ STA T3 + 0
+14b8 : a5 5d __ LDA T13 + 3
+14ba : 49 80 __ EOR #$80
+14bc : 85 5d __ STA T13 + 3
+14be : 4c ad 0e JMP $0ead ; (printf + 596)
+14c1 : a0 00 __ LDY #$00
+14c3 : b1 4b __ LDA (T4 + 0),y
+14c5 : 85 5a __ STA T13 + 0
+14c7 : c8 __ __ INY
+14c8 : b1 4b __ LDA (T4 + 0),y
+14ca : 85 5b __ STA T13 + 1
+14cc : c8 __ __ INY
+14cd : b1 4b __ LDA (T4 + 0),y
+14cf : 85 5c __ STA T13 + 2
+14d1 : c8 __ __ INY
+14d2 : b1 4b __ LDA (T4 + 0),y
+14d4 : 85 5d __ STA T13 + 3
+14d6 : 18 __ __ CLC
+14d7 : a5 4b __ LDA T4 + 0
+14d9 : 69 04 __ ADC #$04
+14db : 85 4b __ STA T4 + 0
+14dd : 90 02 __ BCC $14e1
+14df : e6 4c __ INC T4 + 1
+14e1 : a0 00 __ LDY #$00
+14e3 : b1 47 __ LDA (T2 + 0),y
+14e5 : aa __ __ TAX
+14e6 : e6 47 __ INC T2 + 0
+14e8 : d0 02 __ BNE $14ec
+14ea : e6 48 __ INC T2 + 1
+14ec : 8a __ __ TXA
+14ed : e0 64 __ CPX #$64
+14ef : d0 03 __ BNE $14f4
+14f1 : 4c f5 17 JMP $17f5 ; (printf + 2972)
+14f4 : c9 75 __ CMP #$75
+14f6 : d0 03 __ BNE $14fb
+14f8 : 4c 87 16 JMP $1687 ; (printf + 2606)
+14fb : c9 78 __ CMP #$78
+14fd : f0 03 __ BEQ $1502
+14ff : 4c df 0c JMP $0cdf ; (printf + 134)
+1502 : a9 10 __ LDA #$10
+1504 : 8d bc 23 STA $23bc ; (sframe + 53)
+1507 : a9 00 __ LDA #$00
+1509 : 8d bd 23 STA $23bd ; (sframe + 54)
+150c : a9 10 __ LDA #$10
+150e : 85 45 __ STA T1 + 0
+1510 : a9 00 __ LDA #$00
+1512 : c5 5d __ CMP T13 + 3
+1514 : d0 0a __ BNE $1520
+1516 : c5 5c __ CMP T13 + 2
+1518 : d0 06 __ BNE $1520
+151a : c5 5b __ CMP T13 + 1
+151c : d0 02 __ BNE $1520
+151e : c5 5a __ CMP T13 + 0
+1520 : b0 03 __ BCS $1525
+1522 : 4c f2 15 JMP $15f2 ; (printf + 2457)
+1525 : ad bb 23 LDA $23bb ; (sframe + 52)
+1528 : c9 ff __ CMP #$ff
+152a : d0 03 __ BNE $152f
+152c : 4c e4 15 JMP $15e4 ; (printf + 2443)
+152f : 38 __ __ SEC
+1530 : a9 10 __ LDA #$10
+1532 : ed bb 23 SBC $23bb ; (sframe + 52)
+1535 : 85 49 __ STA T3 + 0
+1537 : c5 45 __ CMP T1 + 0
+1539 : b0 0f __ BCS $154a
+153b : c6 45 __ DEC T1 + 0
+153d : a9 30 __ LDA #$30
+153f : a4 45 __ LDY T1 + 0
+1541 : 99 87 23 STA $2387,y ; (sframe + 0)
+1544 : a5 49 __ LDA T3 + 0
+1546 : c5 45 __ CMP T1 + 0
+1548 : 90 f1 __ BCC $153b
+154a : ad c0 23 LDA $23c0 ; (sframe + 57)
+154d : f0 29 __ BEQ $1578
+154f : ad bc 23 LDA $23bc ; (sframe + 53)
+1552 : 85 51 __ STA T7 + 0
+1554 : ad bd 23 LDA $23bd ; (sframe + 54)
+1557 : d0 1f __ BNE $1578
+1559 : a5 51 __ LDA T7 + 0
+155b : c9 10 __ CMP #$10
+155d : d0 19 __ BNE $1578
+155f : 18 __ __ CLC
+1560 : a5 45 __ LDA T1 + 0
+1562 : 69 ff __ ADC #$ff
+1564 : a8 __ __ TAY
+1565 : a9 58 __ LDA #$58
+1567 : 99 87 23 STA $2387,y ; (sframe + 0)
+156a : 18 __ __ CLC
+156b : a5 45 __ LDA T1 + 0
+156d : 69 fe __ ADC #$fe
+156f : 85 45 __ STA T1 + 0
+1571 : a9 30 __ LDA #$30
+1573 : a4 45 __ LDY T1 + 0
+1575 : 99 87 23 STA $2387,y ; (sframe + 0)
+1578 : ad be 23 LDA $23be ; (sframe + 55)
+157b : f0 09 __ BEQ $1586
+157d : c6 45 __ DEC T1 + 0
+157f : a9 2b __ LDA #$2b
+1581 : a4 45 __ LDY T1 + 0
+1583 : 99 87 23 STA $2387,y ; (sframe + 0)
+1586 : 38 __ __ SEC
+1587 : a9 10 __ LDA #$10
+1589 : ed ba 23 SBC $23ba ; (sframe + 51)
+158c : 85 51 __ STA T7 + 0
+158e : a9 00 __ LDA #$00
+1590 : e9 00 __ SBC #$00
+1592 : 85 52 __ STA T7 + 1
+1594 : ad b9 23 LDA $23b9 ; (sframe + 50)
+1597 : 85 49 __ STA T3 + 0
+1599 : a5 52 __ LDA T7 + 1
+159b : 49 80 __ EOR #$80
+159d : c9 80 __ CMP #$80
+159f : d0 04 __ BNE $15a5
+15a1 : a5 51 __ LDA T7 + 0
+15a3 : c5 45 __ CMP T1 + 0
+15a5 : 90 31 __ BCC $15d8
+15a7 : a9 00 __ LDA #$00
+15a9 : 85 49 __ STA T3 + 0
+15ab : a5 45 __ LDA T1 + 0
+15ad : c9 10 __ CMP #$10
+15af : b0 14 __ BCS $15c5
+15b1 : a4 45 __ LDY T1 + 0
+15b3 : b9 87 23 LDA $2387,y ; (sframe + 0)
+15b6 : a4 49 __ LDY T3 + 0
+15b8 : 99 87 23 STA $2387,y ; (sframe + 0)
+15bb : e6 49 __ INC T3 + 0
+15bd : e6 45 __ INC T1 + 0
+15bf : a5 45 __ LDA T1 + 0
+15c1 : c9 10 __ CMP #$10
+15c3 : 90 ec __ BCC $15b1
+15c5 : a0 00 __ LDY #$00
+15c7 : b1 47 __ LDA (T2 + 0),y
+15c9 : 85 4d __ STA T5 + 0
+15cb : e6 47 __ INC T2 + 0
+15cd : d0 02 __ BNE $15d1
+15cf : e6 48 __ INC T2 + 1
+15d1 : a5 49 __ LDA T3 + 0
+15d3 : 85 45 __ STA T1 + 0
+15d5 : 4c d6 0c JMP $0cd6 ; (printf + 125)
+15d8 : c6 45 __ DEC T1 + 0
+15da : a5 49 __ LDA T3 + 0
+15dc : a4 45 __ LDY T1 + 0
+15de : 99 87 23 STA $2387,y ; (sframe + 0)
+15e1 : 4c 99 15 JMP $1599 ; (printf + 2368)
+15e4 : a9 0f __ LDA #$0f
+15e6 : 85 49 __ STA T3 + 0
+15e8 : c5 45 __ CMP T1 + 0
+15ea : b0 03 __ BCS $15ef
+15ec : 4c 3b 15 JMP $153b ; (printf + 2274)
+15ef : 4c 4a 15 JMP $154a ; (printf + 2289)
+15f2 : ad bc 23 LDA $23bc ; (sframe + 53)
+15f5 : 85 62 __ STA T15 + 0
+15f7 : 85 5e __ STA T14 + 0
+15f9 : ad bd 23 LDA $23bd ; (sframe + 54)
+15fc : 85 63 __ STA T15 + 1
+15fe : 85 5f __ STA T14 + 1
+1600 : a5 5a __ LDA T13 + 0
+1602 : 85 1b __ STA ACCU + 0
+1604 : a5 5b __ LDA T13 + 1
+1606 : 85 1c __ STA ACCU + 1
+1608 : a5 5c __ LDA T13 + 2
+160a : 85 1d __ STA ACCU + 2
+160c : a5 5d __ LDA T13 + 3
+160e : 85 1e __ STA ACCU + 3
+1610 : a5 5e __ LDA T14 + 0
+1612 : 85 03 __ STA $03
+1614 : a5 5f __ LDA T14 + 1
+1616 : 85 04 __ STA $04
+1618 : a9 00 __ LDA #$00
+161a : 85 05 __ STA $05
+161c : 85 06 __ STA $06
+161e : 20 26 23 JSR $2326 ; (divmod32 + 0)
+1621 : a5 08 __ LDA $08
+1623 : 10 52 __ BPL $1677
+1625 : 18 __ __ CLC
+1626 : a5 07 __ LDA $07
+1628 : 69 30 __ ADC #$30
+162a : c6 45 __ DEC T1 + 0
+162c : a4 45 __ LDY T1 + 0
+162e : 99 87 23 STA $2387,y ; (sframe + 0)
+1631 : a5 5a __ LDA T13 + 0
+1633 : 85 1b __ STA ACCU + 0
+1635 : a5 5b __ LDA T13 + 1
+1637 : 85 1c __ STA ACCU + 1
+1639 : a5 5c __ LDA T13 + 2
+163b : 85 1d __ STA ACCU + 2
+163d : a5 5d __ LDA T13 + 3
+163f : 85 1e __ STA ACCU + 3
+1641 : a5 62 __ LDA T15 + 0
+1643 : 85 03 __ STA $03
+1645 : a5 63 __ LDA T15 + 1
+1647 : 85 04 __ STA $04
+1649 : a9 00 __ LDA #$00
+164b : 85 05 __ STA $05
+164d : 85 06 __ STA $06
+164f : 20 26 23 JSR $2326 ; (divmod32 + 0)
+1652 : a5 1b __ LDA ACCU + 0
+1654 : 85 5a __ STA T13 + 0
+1656 : a5 1c __ LDA ACCU + 1
+1658 : 85 5b __ STA T13 + 1
+165a : a5 1d __ LDA ACCU + 2
+165c : 85 5c __ STA T13 + 2
+165e : a5 1e __ LDA ACCU + 3
+1660 : 85 5d __ STA T13 + 3
+1662 : a9 00 __ LDA #$00
+1664 : c5 1e __ CMP ACCU + 3
+1666 : d0 0a __ BNE $1672
+1668 : c5 1d __ CMP ACCU + 2
+166a : d0 06 __ BNE $1672
+166c : c5 1c __ CMP ACCU + 1
+166e : d0 02 __ BNE $1672
+1670 : c5 1b __ CMP ACCU + 0
+1672 : 90 8c __ BCC $1600
+1674 : 4c 25 15 JMP $1525 ; (printf + 2252)
+1677 : d0 06 __ BNE $167f
+1679 : a5 07 __ LDA $07
+167b : c9 0a __ CMP #$0a
+167d : 90 a6 __ BCC $1625
+167f : 18 __ __ CLC
+1680 : a5 07 __ LDA $07
+1682 : 69 37 __ ADC #$37
+1684 : 4c 2a 16 JMP $162a ; (printf + 2513)
+1687 : a9 10 __ LDA #$10
+1689 : 85 45 __ STA T1 + 0
+168b : a9 00 __ LDA #$00
+168d : c5 5d __ CMP T13 + 3
+168f : d0 0a __ BNE $169b
+1691 : c5 5c __ CMP T13 + 2
+1693 : d0 06 __ BNE $169b
+1695 : c5 5b __ CMP T13 + 1
+1697 : d0 02 __ BNE $169b
+1699 : c5 5a __ CMP T13 + 0
+169b : b0 03 __ BCS $16a0
+169d : 4c 60 17 JMP $1760 ; (printf + 2823)
+16a0 : ad bb 23 LDA $23bb ; (sframe + 52)
+16a3 : c9 ff __ CMP #$ff
+16a5 : d0 03 __ BNE $16aa
+16a7 : 4c 52 17 JMP $1752 ; (printf + 2809)
+16aa : 38 __ __ SEC
+16ab : a9 10 __ LDA #$10
+16ad : ed bb 23 SBC $23bb ; (sframe + 52)
+16b0 : 85 49 __ STA T3 + 0
+16b2 : c5 45 __ CMP T1 + 0
+16b4 : b0 0f __ BCS $16c5
+16b6 : c6 45 __ DEC T1 + 0
+16b8 : a9 30 __ LDA #$30
+16ba : a4 45 __ LDY T1 + 0
+16bc : 99 87 23 STA $2387,y ; (sframe + 0)
+16bf : a5 49 __ LDA T3 + 0
+16c1 : c5 45 __ CMP T1 + 0
+16c3 : 90 f1 __ BCC $16b6
+16c5 : ad c0 23 LDA $23c0 ; (sframe + 57)
+16c8 : f0 29 __ BEQ $16f3
+16ca : ad bc 23 LDA $23bc ; (sframe + 53)
+16cd : 85 51 __ STA T7 + 0
+16cf : ad bd 23 LDA $23bd ; (sframe + 54)
+16d2 : d0 1f __ BNE $16f3
+16d4 : a5 51 __ LDA T7 + 0
+16d6 : c9 10 __ CMP #$10
+16d8 : d0 19 __ BNE $16f3
+16da : 18 __ __ CLC
+16db : a5 45 __ LDA T1 + 0
+16dd : 69 ff __ ADC #$ff
+16df : a8 __ __ TAY
+16e0 : a9 58 __ LDA #$58
+16e2 : 99 87 23 STA $2387,y ; (sframe + 0)
+16e5 : 18 __ __ CLC
+16e6 : a5 45 __ LDA T1 + 0
+16e8 : 69 fe __ ADC #$fe
+16ea : 85 45 __ STA T1 + 0
+16ec : a9 30 __ LDA #$30
+16ee : a4 45 __ LDY T1 + 0
+16f0 : 99 87 23 STA $2387,y ; (sframe + 0)
+16f3 : ad be 23 LDA $23be ; (sframe + 55)
+16f6 : f0 09 __ BEQ $1701
+16f8 : c6 45 __ DEC T1 + 0
+16fa : a9 2b __ LDA #$2b
+16fc : a4 45 __ LDY T1 + 0
+16fe : 99 87 23 STA $2387,y ; (sframe + 0)
+1701 : 38 __ __ SEC
+1702 : a9 10 __ LDA #$10
+1704 : ed ba 23 SBC $23ba ; (sframe + 51)
+1707 : 85 51 __ STA T7 + 0
+1709 : a9 00 __ LDA #$00
+170b : e9 00 __ SBC #$00
+170d : 85 52 __ STA T7 + 1
+170f : ad b9 23 LDA $23b9 ; (sframe + 50)
+1712 : 85 49 __ STA T3 + 0
+1714 : a5 52 __ LDA T7 + 1
+1716 : 49 80 __ EOR #$80
+1718 : c9 80 __ CMP #$80
+171a : d0 04 __ BNE $1720
+171c : a5 51 __ LDA T7 + 0
+171e : c5 45 __ CMP T1 + 0
+1720 : 90 24 __ BCC $1746
+1722 : a9 00 __ LDA #$00
+1724 : 85 49 __ STA T3 + 0
+1726 : a5 45 __ LDA T1 + 0
+1728 : c9 10 __ CMP #$10
+172a : 90 03 __ BCC $172f
+172c : 4c c5 15 JMP $15c5 ; (printf + 2412)
+172f : a4 45 __ LDY T1 + 0
+1731 : b9 87 23 LDA $2387,y ; (sframe + 0)
+1734 : a4 49 __ LDY T3 + 0
+1736 : 99 87 23 STA $2387,y ; (sframe + 0)
+1739 : e6 49 __ INC T3 + 0
+173b : e6 45 __ INC T1 + 0
+173d : a5 45 __ LDA T1 + 0
+173f : c9 10 __ CMP #$10
+1741 : 90 ec __ BCC $172f
+1743 : 4c c5 15 JMP $15c5 ; (printf + 2412)
+1746 : c6 45 __ DEC T1 + 0
+1748 : a5 49 __ LDA T3 + 0
+174a : a4 45 __ LDY T1 + 0
+174c : 99 87 23 STA $2387,y ; (sframe + 0)
+174f : 4c 14 17 JMP $1714 ; (printf + 2747)
+1752 : a9 0f __ LDA #$0f
+1754 : 85 49 __ STA T3 + 0
+1756 : c5 45 __ CMP T1 + 0
+1758 : b0 03 __ BCS $175d
+175a : 4c b6 16 JMP $16b6 ; (printf + 2653)
+175d : 4c c5 16 JMP $16c5 ; (printf + 2668)
+1760 : ad bc 23 LDA $23bc ; (sframe + 53)
+1763 : 85 62 __ STA T15 + 0
+1765 : 85 5e __ STA T14 + 0
+1767 : ad bd 23 LDA $23bd ; (sframe + 54)
+176a : 85 63 __ STA T15 + 1
+176c : 85 5f __ STA T14 + 1
+176e : a5 5a __ LDA T13 + 0
+1770 : 85 1b __ STA ACCU + 0
+1772 : a5 5b __ LDA T13 + 1
+1774 : 85 1c __ STA ACCU + 1
+1776 : a5 5c __ LDA T13 + 2
+1778 : 85 1d __ STA ACCU + 2
+177a : a5 5d __ LDA T13 + 3
+177c : 85 1e __ STA ACCU + 3
+177e : a5 5e __ LDA T14 + 0
+1780 : 85 03 __ STA $03
+1782 : a5 5f __ LDA T14 + 1
+1784 : 85 04 __ STA $04
+1786 : a9 00 __ LDA #$00
+1788 : 85 05 __ STA $05
+178a : 85 06 __ STA $06
+178c : 20 26 23 JSR $2326 ; (divmod32 + 0)
+178f : a5 08 __ LDA $08
+1791 : 10 52 __ BPL $17e5
+1793 : 18 __ __ CLC
+1794 : a5 07 __ LDA $07
+1796 : 69 30 __ ADC #$30
+1798 : c6 45 __ DEC T1 + 0
+179a : a4 45 __ LDY T1 + 0
+179c : 99 87 23 STA $2387,y ; (sframe + 0)
+179f : a5 5a __ LDA T13 + 0
+17a1 : 85 1b __ STA ACCU + 0
+17a3 : a5 5b __ LDA T13 + 1
+17a5 : 85 1c __ STA ACCU + 1
+17a7 : a5 5c __ LDA T13 + 2
+17a9 : 85 1d __ STA ACCU + 2
+17ab : a5 5d __ LDA T13 + 3
+17ad : 85 1e __ STA ACCU + 3
+17af : a5 62 __ LDA T15 + 0
+17b1 : 85 03 __ STA $03
+17b3 : a5 63 __ LDA T15 + 1
+17b5 : 85 04 __ STA $04
+17b7 : a9 00 __ LDA #$00
+17b9 : 85 05 __ STA $05
+17bb : 85 06 __ STA $06
+17bd : 20 26 23 JSR $2326 ; (divmod32 + 0)
+17c0 : a5 1b __ LDA ACCU + 0
+17c2 : 85 5a __ STA T13 + 0
+17c4 : a5 1c __ LDA ACCU + 1
+17c6 : 85 5b __ STA T13 + 1
+17c8 : a5 1d __ LDA ACCU + 2
+17ca : 85 5c __ STA T13 + 2
+17cc : a5 1e __ LDA ACCU + 3
+17ce : 85 5d __ STA T13 + 3
+17d0 : a9 00 __ LDA #$00
+17d2 : c5 1e __ CMP ACCU + 3
+17d4 : d0 0a __ BNE $17e0
+17d6 : c5 1d __ CMP ACCU + 2
+17d8 : d0 06 __ BNE $17e0
+17da : c5 1c __ CMP ACCU + 1
+17dc : d0 02 __ BNE $17e0
+17de : c5 1b __ CMP ACCU + 0
+17e0 : 90 8c __ BCC $176e
+17e2 : 4c a0 16 JMP $16a0 ; (printf + 2631)
+17e5 : d0 06 __ BNE $17ed
+17e7 : a5 07 __ LDA $07
+17e9 : c9 0a __ CMP #$0a
+17eb : 90 a6 __ BCC $1793
+17ed : 18 __ __ CLC
+17ee : a5 07 __ LDA $07
+17f0 : 69 37 __ ADC #$37
+17f2 : 4c 98 17 JMP $1798 ; (printf + 2879)
+17f5 : a5 5d __ LDA T13 + 3
+17f7 : 49 80 __ EOR #$80
+17f9 : c9 80 __ CMP #$80
+17fb : f0 03 __ BEQ $1800
+17fd : 4c ac 19 JMP $19ac ; (printf + 3411)
+1800 : a5 5c __ LDA T13 + 2
+1802 : c9 00 __ CMP #$00
+1804 : f0 03 __ BEQ $1809
+1806 : 4c ac 19 JMP $19ac ; (printf + 3411)
+1809 : a5 5b __ LDA T13 + 1
+180b : c9 00 __ CMP #$00
+180d : f0 03 __ BEQ $1812
+180f : 4c ac 19 JMP $19ac ; (printf + 3411)
+1812 : a5 5a __ LDA T13 + 0
+1814 : 85 5e __ STA T14 + 0
+1816 : a5 5b __ LDA T13 + 1
+1818 : 85 5f __ STA T14 + 1
+181a : a5 5c __ LDA T13 + 2
+181c : 85 60 __ STA T14 + 2
+181e : a5 5d __ LDA T13 + 3
+1820 : 85 61 __ STA T14 + 3
+1822 : a9 00 __ LDA #$00
+1824 : 85 45 __ STA T1 + 0
+1826 : a9 10 __ LDA #$10
+1828 : 85 49 __ STA T3 + 0
+182a : a9 00 __ LDA #$00
+182c : c5 5d __ CMP T13 + 3
+182e : d0 0a __ BNE $183a
+1830 : c5 5c __ CMP T13 + 2
+1832 : d0 06 __ BNE $183a
+1834 : c5 5b __ CMP T13 + 1
+1836 : d0 02 __ BNE $183a
+1838 : c5 5a __ CMP T13 + 0
+183a : b0 03 __ BCS $183f
+183c : 4c 17 19 JMP $1917 ; (printf + 3262)
+183f : ad bb 23 LDA $23bb ; (sframe + 52)
+1842 : c9 ff __ CMP #$ff
+1844 : d0 03 __ BNE $1849
+1846 : 4c 09 19 JMP $1909 ; (printf + 3248)
+1849 : 38 __ __ SEC
+184a : a9 10 __ LDA #$10
+184c : ed bb 23 SBC $23bb ; (sframe + 52)
+184f : 85 4d __ STA T5 + 0
+1851 : c5 49 __ CMP T3 + 0
+1853 : b0 0f __ BCS $1864
+1855 : c6 49 __ DEC T3 + 0
+1857 : a9 30 __ LDA #$30
+1859 : a4 49 __ LDY T3 + 0
+185b : 99 87 23 STA $2387,y ; (sframe + 0)
+185e : a5 4d __ LDA T5 + 0
+1860 : c5 49 __ CMP T3 + 0
+1862 : 90 f1 __ BCC $1855
+1864 : ad c0 23 LDA $23c0 ; (sframe + 57)
+1867 : f0 29 __ BEQ $1892
+1869 : ad bc 23 LDA $23bc ; (sframe + 53)
+186c : 85 51 __ STA T7 + 0
+186e : ad bd 23 LDA $23bd ; (sframe + 54)
+1871 : d0 1f __ BNE $1892
+1873 : a5 51 __ LDA T7 + 0
+1875 : c9 10 __ CMP #$10
+1877 : d0 19 __ BNE $1892
+1879 : 18 __ __ CLC
+187a : a5 49 __ LDA T3 + 0
+187c : 69 ff __ ADC #$ff
+187e : a8 __ __ TAY
+187f : a9 58 __ LDA #$58
+1881 : 99 87 23 STA $2387,y ; (sframe + 0)
+1884 : 18 __ __ CLC
+1885 : a5 49 __ LDA T3 + 0
+1887 : 69 fe __ ADC #$fe
+1889 : 85 49 __ STA T3 + 0
+188b : a9 30 __ LDA #$30
+188d : a4 49 __ LDY T3 + 0
+188f : 99 87 23 STA $2387,y ; (sframe + 0)
+1892 : a5 45 __ LDA T1 + 0
+1894 : d0 67 __ BNE $18fd
+1896 : ad be 23 LDA $23be ; (sframe + 55)
+1899 : f0 09 __ BEQ $18a4
+189b : c6 49 __ DEC T3 + 0
+189d : a9 2b __ LDA #$2b
+189f : a4 49 __ LDY T3 + 0
+18a1 : 99 87 23 STA $2387,y ; (sframe + 0)
+18a4 : 38 __ __ SEC
+18a5 : a9 10 __ LDA #$10
+18a7 : ed ba 23 SBC $23ba ; (sframe + 51)
+18aa : 85 51 __ STA T7 + 0
+18ac : a9 00 __ LDA #$00
+18ae : e9 00 __ SBC #$00
+18b0 : 85 52 __ STA T7 + 1
+18b2 : ad b9 23 LDA $23b9 ; (sframe + 50)
+18b5 : 85 45 __ STA T1 + 0
+18b7 : a5 52 __ LDA T7 + 1
+18b9 : 49 80 __ EOR #$80
+18bb : c9 80 __ CMP #$80
+18bd : d0 04 __ BNE $18c3
+18bf : a5 51 __ LDA T7 + 0
+18c1 : c5 49 __ CMP T3 + 0
+18c3 : 90 2c __ BCC $18f1
+18c5 : a9 00 __ LDA #$00
+18c7 : 85 45 __ STA T1 + 0
+18c9 : a5 49 __ LDA T3 + 0
+18cb : c9 10 __ CMP #$10
+18cd : 90 0f __ BCC $18de
+18cf : a0 00 __ LDY #$00
+18d1 : b1 47 __ LDA (T2 + 0),y
+18d3 : 85 4d __ STA T5 + 0
+18d5 : e6 47 __ INC T2 + 0
+18d7 : d0 02 __ BNE $18db
+18d9 : e6 48 __ INC T2 + 1
+18db : 4c d6 0c JMP $0cd6 ; (printf + 125)
+18de : aa __ __ TAX
+18df : bd 87 23 LDA $2387,x ; (sframe + 0)
+18e2 : a4 45 __ LDY T1 + 0
+18e4 : 99 87 23 STA $2387,y ; (sframe + 0)
+18e7 : e6 45 __ INC T1 + 0
+18e9 : e8 __ __ INX
+18ea : e0 10 __ CPX #$10
+18ec : 90 f1 __ BCC $18df
+18ee : 4c cf 18 JMP $18cf ; (printf + 3190)
+18f1 : c6 49 __ DEC T3 + 0
+18f3 : a5 45 __ LDA T1 + 0
+18f5 : a4 49 __ LDY T3 + 0
+18f7 : 99 87 23 STA $2387,y ; (sframe + 0)
+18fa : 4c b7 18 JMP $18b7 ; (printf + 3166)
+18fd : c6 49 __ DEC T3 + 0
+18ff : a9 2d __ LDA #$2d
+1901 : a4 49 __ LDY T3 + 0
+1903 : 99 87 23 STA $2387,y ; (sframe + 0)
+1906 : 4c a4 18 JMP $18a4 ; (printf + 3147)
+1909 : a9 0f __ LDA #$0f
+190b : 85 4d __ STA T5 + 0
+190d : c5 49 __ CMP T3 + 0
+190f : b0 03 __ BCS $1914
+1911 : 4c 55 18 JMP $1855 ; (printf + 3068)
+1914 : 4c 64 18 JMP $1864 ; (printf + 3083)
+1917 : ad bc 23 LDA $23bc ; (sframe + 53)
+191a : 85 62 __ STA T15 + 0
+191c : 85 5a __ STA T13 + 0
+191e : ad bd 23 LDA $23bd ; (sframe + 54)
+1921 : 85 63 __ STA T15 + 1
+1923 : 85 5b __ STA T13 + 1
+1925 : a5 5e __ LDA T14 + 0
+1927 : 85 1b __ STA ACCU + 0
+1929 : a5 5f __ LDA T14 + 1
+192b : 85 1c __ STA ACCU + 1
+192d : a5 60 __ LDA T14 + 2
+192f : 85 1d __ STA ACCU + 2
+1931 : a5 61 __ LDA T14 + 3
+1933 : 85 1e __ STA ACCU + 3
+1935 : a5 5a __ LDA T13 + 0
+1937 : 85 03 __ STA $03
+1939 : a5 5b __ LDA T13 + 1
+193b : 85 04 __ STA $04
+193d : a9 00 __ LDA #$00
+193f : 85 05 __ STA $05
+1941 : 85 06 __ STA $06
+1943 : 20 26 23 JSR $2326 ; (divmod32 + 0)
+1946 : a5 08 __ LDA $08
+1948 : 10 52 __ BPL $199c
+194a : 18 __ __ CLC
+194b : a5 07 __ LDA $07
+194d : 69 30 __ ADC #$30
+194f : c6 49 __ DEC T3 + 0
+1951 : a4 49 __ LDY T3 + 0
+1953 : 99 87 23 STA $2387,y ; (sframe + 0)
+1956 : a5 5e __ LDA T14 + 0
+1958 : 85 1b __ STA ACCU + 0
+195a : a5 5f __ LDA T14 + 1
+195c : 85 1c __ STA ACCU + 1
+195e : a5 60 __ LDA T14 + 2
+1960 : 85 1d __ STA ACCU + 2
+1962 : a5 61 __ LDA T14 + 3
+1964 : 85 1e __ STA ACCU + 3
+1966 : a5 62 __ LDA T15 + 0
+1968 : 85 03 __ STA $03
+196a : a5 63 __ LDA T15 + 1
+196c : 85 04 __ STA $04
+196e : a9 00 __ LDA #$00
+1970 : 85 05 __ STA $05
+1972 : 85 06 __ STA $06
+1974 : 20 26 23 JSR $2326 ; (divmod32 + 0)
+1977 : a5 1b __ LDA ACCU + 0
+1979 : 85 5e __ STA T14 + 0
+197b : a5 1c __ LDA ACCU + 1
+197d : 85 5f __ STA T14 + 1
+197f : a5 1d __ LDA ACCU + 2
+1981 : 85 60 __ STA T14 + 2
+1983 : a5 1e __ LDA ACCU + 3
+1985 : 85 61 __ STA T14 + 3
+1987 : a9 00 __ LDA #$00
+1989 : c5 1e __ CMP ACCU + 3
+198b : d0 0a __ BNE $1997
+198d : c5 1d __ CMP ACCU + 2
+198f : d0 06 __ BNE $1997
+1991 : c5 1c __ CMP ACCU + 1
+1993 : d0 02 __ BNE $1997
+1995 : c5 1b __ CMP ACCU + 0
+1997 : 90 8c __ BCC $1925
+1999 : 4c 3f 18 JMP $183f ; (printf + 3046)
+199c : d0 06 __ BNE $19a4
+199e : a5 07 __ LDA $07
+19a0 : c9 0a __ CMP #$0a
+19a2 : 90 a6 __ BCC $194a
+19a4 : 18 __ __ CLC
+19a5 : a5 07 __ LDA $07
+19a7 : 69 37 __ ADC #$37
+19a9 : 4c 4f 19 JMP $194f ; (printf + 3318)
+19ac : 90 22 __ BCC $19d0
+19ae : 85 5e __ STA T14 + 0
+19b0 : a5 5b __ LDA T13 + 1
+19b2 : 85 5f __ STA T14 + 1
+19b4 : a5 5c __ LDA T13 + 2
+19b6 : 85 60 __ STA T14 + 2
+19b8 : a5 5d __ LDA T13 + 3
+19ba : 85 61 __ STA T14 + 3
+19bc : a9 00 __ LDA #$00
+19be : 85 45 __ STA T1 + 0
+19c0 : a9 10 __ LDA #$10
+19c2 : 85 49 __ STA T3 + 0
+19c4 : a9 00 __ LDA #$00
+19c6 : c5 5d __ CMP T13 + 3
+19c8 : f0 03 __ BEQ $19cd
+19ca : 4c 3a 18 JMP $183a ; (printf + 3041)
+19cd : 4c 30 18 JMP $1830 ; (printf + 3031)
+19d0 : a9 01 __ LDA #$01
+19d2 : 85 45 __ STA T1 + 0
+19d4 : a9 10 __ LDA #$10
+19d6 : 85 49 __ STA T3 + 0
+19d8 : 38 __ __ SEC
+19d9 : a9 00 __ LDA #$00
+19db : e5 5a __ SBC T13 + 0
+19dd : 85 5e __ STA T14 + 0
+19df : a9 00 __ LDA #$00
+19e1 : e5 5b __ SBC T13 + 1
+19e3 : 85 5f __ STA T14 + 1
+19e5 : a9 00 __ LDA #$00
+19e7 : e5 5c __ SBC T13 + 2
+19e9 : 85 60 __ STA T14 + 2
+19eb : a9 00 __ LDA #$00
+19ed : e5 5d __ SBC T13 + 3
+19ef : 85 61 __ STA T14 + 3
+19f1 : a9 00 __ LDA #$00
+19f3 : c5 61 __ CMP T14 + 3
+19f5 : d0 0a __ BNE $1a01
+19f7 : c5 60 __ CMP T14 + 2
+19f9 : d0 06 __ BNE $1a01
+19fb : c5 5f __ CMP T14 + 1
+19fd : d0 02 __ BNE $1a01
+19ff : c5 5e __ CMP T14 + 0
+1a01 : b0 03 __ BCS $1a06
+1a03 : 4c 17 19 JMP $1917 ; (printf + 3262)
+1a06 : 4c 3f 18 JMP $183f ; (printf + 3046)
+1a09 : a9 10 __ LDA #$10
+1a0b : 8d bc 23 STA $23bc ; (sframe + 53)
+1a0e : a9 00 __ LDA #$00
+1a10 : 8d bd 23 STA $23bd ; (sframe + 54)
+1a13 : a0 00 __ LDY #$00
+1a15 : b1 4b __ LDA (T4 + 0),y
+1a17 : 85 4f __ STA T6 + 0
+1a19 : c8 __ __ INY
+1a1a : b1 4b __ LDA (T4 + 0),y
+1a1c : 85 50 __ STA T6 + 1
+1a1e : 18 __ __ CLC
+1a1f : a5 4b __ LDA T4 + 0
+1a21 : 69 02 __ ADC #$02
+1a23 : 85 4b __ STA T4 + 0
+1a25 : 90 02 __ BCC $1a29
+1a27 : e6 4c __ INC T4 + 1
+1a29 : a9 0a __ LDA #$0a
+1a2b : 85 45 __ STA T1 + 0
+1a2d : a5 4f __ LDA T6 + 0
+1a2f : 05 50 __ ORA T6 + 1
+1a31 : f0 03 __ BEQ $1a36
+1a33 : 4c f6 1a JMP $1af6 ; (printf + 3741)
+1a36 : ad bb 23 LDA $23bb ; (sframe + 52)
+1a39 : c9 ff __ CMP #$ff
+1a3b : d0 03 __ BNE $1a40
+1a3d : 4c e8 1a JMP $1ae8 ; (printf + 3727)
+1a40 : 38 __ __ SEC
+1a41 : a9 0a __ LDA #$0a
+1a43 : ed bb 23 SBC $23bb ; (sframe + 52)
+1a46 : 85 49 __ STA T3 + 0
+1a48 : c5 45 __ CMP T1 + 0
+1a4a : b0 0f __ BCS $1a5b
+1a4c : c6 45 __ DEC T1 + 0
+1a4e : a9 30 __ LDA #$30
+1a50 : a4 45 __ LDY T1 + 0
+1a52 : 99 87 23 STA $2387,y ; (sframe + 0)
+1a55 : a5 49 __ LDA T3 + 0
+1a57 : c5 45 __ CMP T1 + 0
+1a59 : 90 f1 __ BCC $1a4c
+1a5b : ad c0 23 LDA $23c0 ; (sframe + 57)
+1a5e : f0 29 __ BEQ $1a89
+1a60 : ad bc 23 LDA $23bc ; (sframe + 53)
+1a63 : 85 4f __ STA T6 + 0
+1a65 : ad bd 23 LDA $23bd ; (sframe + 54)
+1a68 : d0 1f __ BNE $1a89
+1a6a : a5 4f __ LDA T6 + 0
+1a6c : c9 10 __ CMP #$10
+1a6e : d0 19 __ BNE $1a89
+1a70 : 18 __ __ CLC
+1a71 : a5 45 __ LDA T1 + 0
+1a73 : 69 ff __ ADC #$ff
+1a75 : a8 __ __ TAY
+1a76 : a9 58 __ LDA #$58
+1a78 : 99 87 23 STA $2387,y ; (sframe + 0)
+1a7b : 18 __ __ CLC
+1a7c : a5 45 __ LDA T1 + 0
+1a7e : 69 fe __ ADC #$fe
+1a80 : 85 45 __ STA T1 + 0
+1a82 : a9 30 __ LDA #$30
+1a84 : a4 45 __ LDY T1 + 0
+1a86 : 99 87 23 STA $2387,y ; (sframe + 0)
+1a89 : ad be 23 LDA $23be ; (sframe + 55)
+1a8c : f0 09 __ BEQ $1a97
+1a8e : c6 45 __ DEC T1 + 0
+1a90 : a9 2b __ LDA #$2b
+1a92 : a4 45 __ LDY T1 + 0
+1a94 : 99 87 23 STA $2387,y ; (sframe + 0)
+1a97 : 38 __ __ SEC
+1a98 : a9 0a __ LDA #$0a
+1a9a : ed ba 23 SBC $23ba ; (sframe + 51)
+1a9d : 85 4f __ STA T6 + 0
+1a9f : a9 00 __ LDA #$00
+1aa1 : e9 00 __ SBC #$00
+1aa3 : 85 50 __ STA T6 + 1
+1aa5 : ad b9 23 LDA $23b9 ; (sframe + 50)
+1aa8 : 85 49 __ STA T3 + 0
+1aaa : a5 50 __ LDA T6 + 1
+1aac : 49 80 __ EOR #$80
+1aae : c9 80 __ CMP #$80
+1ab0 : d0 04 __ BNE $1ab6
+1ab2 : a5 4f __ LDA T6 + 0
+1ab4 : c5 45 __ CMP T1 + 0
+1ab6 : 90 24 __ BCC $1adc
+1ab8 : a9 00 __ LDA #$00
+1aba : 85 49 __ STA T3 + 0
+1abc : a5 45 __ LDA T1 + 0
+1abe : c9 0a __ CMP #$0a
+1ac0 : 90 03 __ BCC $1ac5
+1ac2 : 4c c5 15 JMP $15c5 ; (printf + 2412)
+1ac5 : a4 45 __ LDY T1 + 0
+1ac7 : b9 87 23 LDA $2387,y ; (sframe + 0)
+1aca : a4 49 __ LDY T3 + 0
+1acc : 99 87 23 STA $2387,y ; (sframe + 0)
+1acf : e6 49 __ INC T3 + 0
+1ad1 : e6 45 __ INC T1 + 0
+1ad3 : a5 45 __ LDA T1 + 0
+1ad5 : c9 0a __ CMP #$0a
+1ad7 : 90 ec __ BCC $1ac5
+1ad9 : 4c c5 15 JMP $15c5 ; (printf + 2412)
+1adc : c6 45 __ DEC T1 + 0
+1ade : a5 49 __ LDA T3 + 0
+1ae0 : a4 45 __ LDY T1 + 0
+1ae2 : 99 87 23 STA $2387,y ; (sframe + 0)
+1ae5 : 4c aa 1a JMP $1aaa ; (printf + 3665)
+1ae8 : a9 09 __ LDA #$09
+1aea : 85 49 __ STA T3 + 0
+1aec : c5 45 __ CMP T1 + 0
+1aee : b0 03 __ BCS $1af3
+1af0 : 4c 4c 1a JMP $1a4c ; (printf + 3571)
+1af3 : 4c 5b 1a JMP $1a5b ; (printf + 3586)
+1af6 : ad bc 23 LDA $23bc ; (sframe + 53)
+1af9 : 85 53 __ STA T8 + 0
+1afb : 85 55 __ STA T9 + 0
+1afd : ad bd 23 LDA $23bd ; (sframe + 54)
+1b00 : 85 54 __ STA T8 + 1
+1b02 : 85 56 __ STA T9 + 1
+1b04 : a5 4f __ LDA T6 + 0
+1b06 : 85 1b __ STA ACCU + 0
+1b08 : a5 50 __ LDA T6 + 1
+1b0a : 85 1c __ STA ACCU + 1
+1b0c : a5 55 __ LDA T9 + 0
+1b0e : 85 03 __ STA $03
+1b10 : a5 56 __ LDA T9 + 1
+1b12 : 85 04 __ STA $04
+1b14 : 20 9a 21 JSR $219a ; (divmod + 0)
+1b17 : a5 06 __ LDA $06
+1b19 : 10 2e __ BPL $1b49
+1b1b : 18 __ __ CLC
+1b1c : a5 05 __ LDA $05
+1b1e : 69 30 __ ADC #$30
+1b20 : c6 45 __ DEC T1 + 0
+1b22 : a4 45 __ LDY T1 + 0
+1b24 : 99 87 23 STA $2387,y ; (sframe + 0)
+1b27 : a5 4f __ LDA T6 + 0
+1b29 : 85 1b __ STA ACCU + 0
+1b2b : a5 50 __ LDA T6 + 1
+1b2d : 85 1c __ STA ACCU + 1
+1b2f : a5 53 __ LDA T8 + 0
+1b31 : 85 03 __ STA $03
+1b33 : a5 54 __ LDA T8 + 1
+1b35 : 85 04 __ STA $04
+1b37 : 20 9a 21 JSR $219a ; (divmod + 0)
+1b3a : a5 1b __ LDA ACCU + 0
+1b3c : 85 4f __ STA T6 + 0
+1b3e : a5 1c __ LDA ACCU + 1
+1b40 : 85 50 __ STA T6 + 1
+1b42 : 05 1b __ ORA ACCU + 0
+1b44 : d0 be __ BNE $1b04
+1b46 : 4c 36 1a JMP $1a36 ; (printf + 3549)
+1b49 : d0 06 __ BNE $1b51
+1b4b : a5 05 __ LDA $05
+1b4d : c9 0a __ CMP #$0a
+1b4f : 90 ca __ BCC $1b1b
+1b51 : 18 __ __ CLC
+1b52 : a5 05 __ LDA $05
+1b54 : 69 37 __ ADC #$37
+1b56 : 4c 20 1b JMP $1b20 ; (printf + 3783)
+1b59 : a0 00 __ LDY #$00
+1b5b : b1 4b __ LDA (T4 + 0),y
+1b5d : 85 4f __ STA T6 + 0
+1b5f : c8 __ __ INY
+1b60 : b1 4b __ LDA (T4 + 0),y
+1b62 : 85 50 __ STA T6 + 1
+1b64 : 18 __ __ CLC
+1b65 : a5 4b __ LDA T4 + 0
+1b67 : 69 02 __ ADC #$02
+1b69 : 85 4b __ STA T4 + 0
+1b6b : 90 02 __ BCC $1b6f
+1b6d : e6 4c __ INC T4 + 1
+1b6f : a9 0a __ LDA #$0a
+1b71 : 85 45 __ STA T1 + 0
+1b73 : a5 4f __ LDA T6 + 0
+1b75 : 05 50 __ ORA T6 + 1
+1b77 : f0 03 __ BEQ $1b7c
+1b79 : 4c 3c 1c JMP $1c3c ; (printf + 4067)
+1b7c : ad bb 23 LDA $23bb ; (sframe + 52)
+1b7f : c9 ff __ CMP #$ff
+1b81 : d0 03 __ BNE $1b86
+1b83 : 4c 2e 1c JMP $1c2e ; (printf + 4053)
+1b86 : 38 __ __ SEC
+1b87 : a9 0a __ LDA #$0a
+1b89 : ed bb 23 SBC $23bb ; (sframe + 52)
+1b8c : 85 49 __ STA T3 + 0
+1b8e : c5 45 __ CMP T1 + 0
+1b90 : b0 0f __ BCS $1ba1
+1b92 : c6 45 __ DEC T1 + 0
+1b94 : a9 30 __ LDA #$30
+1b96 : a4 45 __ LDY T1 + 0
+1b98 : 99 87 23 STA $2387,y ; (sframe + 0)
+1b9b : a5 49 __ LDA T3 + 0
+1b9d : c5 45 __ CMP T1 + 0
+1b9f : 90 f1 __ BCC $1b92
+1ba1 : ad c0 23 LDA $23c0 ; (sframe + 57)
+1ba4 : f0 29 __ BEQ $1bcf
+1ba6 : ad bc 23 LDA $23bc ; (sframe + 53)
+1ba9 : 85 4f __ STA T6 + 0
+1bab : ad bd 23 LDA $23bd ; (sframe + 54)
+1bae : d0 1f __ BNE $1bcf
+1bb0 : a5 4f __ LDA T6 + 0
+1bb2 : c9 10 __ CMP #$10
+1bb4 : d0 19 __ BNE $1bcf
+1bb6 : 18 __ __ CLC
+1bb7 : a5 45 __ LDA T1 + 0
+1bb9 : 69 ff __ ADC #$ff
+1bbb : a8 __ __ TAY
+1bbc : a9 58 __ LDA #$58
+1bbe : 99 87 23 STA $2387,y ; (sframe + 0)
+1bc1 : 18 __ __ CLC
+1bc2 : a5 45 __ LDA T1 + 0
+1bc4 : 69 fe __ ADC #$fe
+1bc6 : 85 45 __ STA T1 + 0
+1bc8 : a9 30 __ LDA #$30
+1bca : a4 45 __ LDY T1 + 0
+1bcc : 99 87 23 STA $2387,y ; (sframe + 0)
+1bcf : ad be 23 LDA $23be ; (sframe + 55)
+1bd2 : f0 09 __ BEQ $1bdd
+1bd4 : c6 45 __ DEC T1 + 0
+1bd6 : a9 2b __ LDA #$2b
+1bd8 : a4 45 __ LDY T1 + 0
+1bda : 99 87 23 STA $2387,y ; (sframe + 0)
+1bdd : 38 __ __ SEC
+1bde : a9 0a __ LDA #$0a
+1be0 : ed ba 23 SBC $23ba ; (sframe + 51)
+1be3 : 85 4f __ STA T6 + 0
+1be5 : a9 00 __ LDA #$00
+1be7 : e9 00 __ SBC #$00
+1be9 : 85 50 __ STA T6 + 1
+1beb : ad b9 23 LDA $23b9 ; (sframe + 50)
+1bee : 85 49 __ STA T3 + 0
+1bf0 : a5 50 __ LDA T6 + 1
+1bf2 : 49 80 __ EOR #$80
+1bf4 : c9 80 __ CMP #$80
+1bf6 : d0 04 __ BNE $1bfc
+1bf8 : a5 4f __ LDA T6 + 0
+1bfa : c5 45 __ CMP T1 + 0
+1bfc : 90 24 __ BCC $1c22
+1bfe : a9 00 __ LDA #$00
+1c00 : 85 49 __ STA T3 + 0
+1c02 : a5 45 __ LDA T1 + 0
+1c04 : c9 0a __ CMP #$0a
+1c06 : 90 03 __ BCC $1c0b
+1c08 : 4c c5 15 JMP $15c5 ; (printf + 2412)
+1c0b : a4 45 __ LDY T1 + 0
+1c0d : b9 87 23 LDA $2387,y ; (sframe + 0)
+1c10 : a4 49 __ LDY T3 + 0
+1c12 : 99 87 23 STA $2387,y ; (sframe + 0)
+1c15 : e6 49 __ INC T3 + 0
+1c17 : e6 45 __ INC T1 + 0
+1c19 : a5 45 __ LDA T1 + 0
+1c1b : c9 0a __ CMP #$0a
+1c1d : 90 ec __ BCC $1c0b
+1c1f : 4c c5 15 JMP $15c5 ; (printf + 2412)
+1c22 : c6 45 __ DEC T1 + 0
+1c24 : a5 49 __ LDA T3 + 0
+1c26 : a4 45 __ LDY T1 + 0
+1c28 : 99 87 23 STA $2387,y ; (sframe + 0)
+1c2b : 4c f0 1b JMP $1bf0 ; (printf + 3991)
+1c2e : a9 09 __ LDA #$09
+1c30 : 85 49 __ STA T3 + 0
+1c32 : c5 45 __ CMP T1 + 0
+1c34 : b0 03 __ BCS $1c39
+1c36 : 4c 92 1b JMP $1b92 ; (printf + 3897)
+1c39 : 4c a1 1b JMP $1ba1 ; (printf + 3912)
+1c3c : ad bc 23 LDA $23bc ; (sframe + 53)
+1c3f : 85 53 __ STA T8 + 0
+1c41 : 85 55 __ STA T9 + 0
+1c43 : ad bd 23 LDA $23bd ; (sframe + 54)
+1c46 : 85 54 __ STA T8 + 1
+1c48 : 85 56 __ STA T9 + 1
+1c4a : a5 4f __ LDA T6 + 0
+1c4c : 85 1b __ STA ACCU + 0
+1c4e : a5 50 __ LDA T6 + 1
+1c50 : 85 1c __ STA ACCU + 1
+1c52 : a5 55 __ LDA T9 + 0
+1c54 : 85 03 __ STA $03
+1c56 : a5 56 __ LDA T9 + 1
+1c58 : 85 04 __ STA $04
+1c5a : 20 9a 21 JSR $219a ; (divmod + 0)
+1c5d : a5 06 __ LDA $06
+1c5f : 10 2e __ BPL $1c8f
+1c61 : 18 __ __ CLC
+1c62 : a5 05 __ LDA $05
+1c64 : 69 30 __ ADC #$30
+1c66 : c6 45 __ DEC T1 + 0
+1c68 : a4 45 __ LDY T1 + 0
+1c6a : 99 87 23 STA $2387,y ; (sframe + 0)
+1c6d : a5 4f __ LDA T6 + 0
+1c6f : 85 1b __ STA ACCU + 0
+1c71 : a5 50 __ LDA T6 + 1
+1c73 : 85 1c __ STA ACCU + 1
+1c75 : a5 53 __ LDA T8 + 0
+1c77 : 85 03 __ STA $03
+1c79 : a5 54 __ LDA T8 + 1
+1c7b : 85 04 __ STA $04
+1c7d : 20 9a 21 JSR $219a ; (divmod + 0)
+1c80 : a5 1b __ LDA ACCU + 0
+1c82 : 85 4f __ STA T6 + 0
+1c84 : a5 1c __ LDA ACCU + 1
+1c86 : 85 50 __ STA T6 + 1
+1c88 : 05 1b __ ORA ACCU + 0
+1c8a : d0 be __ BNE $1c4a
+1c8c : 4c 7c 1b JMP $1b7c ; (printf + 3875)
+1c8f : d0 06 __ BNE $1c97
+1c91 : a5 05 __ LDA $05
+1c93 : c9 0a __ CMP #$0a
+1c95 : 90 ca __ BCC $1c61
+1c97 : 18 __ __ CLC
+1c98 : a5 05 __ LDA $05
+1c9a : 69 37 __ ADC #$37
+1c9c : 4c 66 1c JMP $1c66 ; (printf + 4109)
+1c9f : a0 00 __ LDY #$00
+1ca1 : b1 4b __ LDA (T4 + 0),y
+1ca3 : 85 4f __ STA T6 + 0
+1ca5 : c8 __ __ INY
+1ca6 : b1 4b __ LDA (T4 + 0),y
+1ca8 : 85 50 __ STA T6 + 1
+1caa : 18 __ __ CLC
+1cab : a5 4b __ LDA T4 + 0
+1cad : 69 02 __ ADC #$02
+1caf : 85 4b __ STA T4 + 0
+1cb1 : 90 02 __ BCC $1cb5
+1cb3 : e6 4c __ INC T4 + 1
+1cb5 : a5 50 __ LDA T6 + 1
+1cb7 : 10 03 __ BPL $1cbc
+1cb9 : 4c 08 1e JMP $1e08 ; (printf + 4527)
+1cbc : a5 4f __ LDA T6 + 0
+1cbe : 85 53 __ STA T8 + 0
+1cc0 : a5 50 __ LDA T6 + 1
+1cc2 : 85 54 __ STA T8 + 1
+1cc4 : a9 00 __ LDA #$00
+1cc6 : 85 45 __ STA T1 + 0
+1cc8 : a9 0a __ LDA #$0a
+1cca : 85 49 __ STA T3 + 0
+1ccc : a5 4f __ LDA T6 + 0
+1cce : 05 50 __ ORA T6 + 1
+1cd0 : f0 03 __ BEQ $1cd5
+1cd2 : 4c a5 1d JMP $1da5 ; (printf + 4428)
+1cd5 : ad bb 23 LDA $23bb ; (sframe + 52)
+1cd8 : c9 ff __ CMP #$ff
+1cda : d0 03 __ BNE $1cdf
+1cdc : 4c 97 1d JMP $1d97 ; (printf + 4414)
+1cdf : 38 __ __ SEC
+1ce0 : a9 0a __ LDA #$0a
+1ce2 : ed bb 23 SBC $23bb ; (sframe + 52)
+1ce5 : 85 4d __ STA T5 + 0
+1ce7 : c5 49 __ CMP T3 + 0
+1ce9 : b0 0f __ BCS $1cfa
+1ceb : c6 49 __ DEC T3 + 0
+1ced : a9 30 __ LDA #$30
+1cef : a4 49 __ LDY T3 + 0
+1cf1 : 99 87 23 STA $2387,y ; (sframe + 0)
+1cf4 : a5 4d __ LDA T5 + 0
+1cf6 : c5 49 __ CMP T3 + 0
+1cf8 : 90 f1 __ BCC $1ceb
+1cfa : ad c0 23 LDA $23c0 ; (sframe + 57)
+1cfd : f0 29 __ BEQ $1d28
+1cff : ad bc 23 LDA $23bc ; (sframe + 53)
+1d02 : 85 4f __ STA T6 + 0
+1d04 : ad bd 23 LDA $23bd ; (sframe + 54)
+1d07 : d0 1f __ BNE $1d28
+1d09 : a5 4f __ LDA T6 + 0
+1d0b : c9 10 __ CMP #$10
+1d0d : d0 19 __ BNE $1d28
+1d0f : 18 __ __ CLC
+1d10 : a5 49 __ LDA T3 + 0
+1d12 : 69 ff __ ADC #$ff
+1d14 : a8 __ __ TAY
+1d15 : a9 58 __ LDA #$58
+1d17 : 99 87 23 STA $2387,y ; (sframe + 0)
+1d1a : 18 __ __ CLC
+1d1b : a5 49 __ LDA T3 + 0
+1d1d : 69 fe __ ADC #$fe
+1d1f : 85 49 __ STA T3 + 0
+1d21 : a9 30 __ LDA #$30
+1d23 : a4 49 __ LDY T3 + 0
+1d25 : 99 87 23 STA $2387,y ; (sframe + 0)
+1d28 : a5 45 __ LDA T1 + 0
+1d2a : d0 5f __ BNE $1d8b
+1d2c : ad be 23 LDA $23be ; (sframe + 55)
+1d2f : f0 09 __ BEQ $1d3a
+1d31 : c6 49 __ DEC T3 + 0
+1d33 : a9 2b __ LDA #$2b
+1d35 : a4 49 __ LDY T3 + 0
+1d37 : 99 87 23 STA $2387,y ; (sframe + 0)
+1d3a : 38 __ __ SEC
+1d3b : a9 0a __ LDA #$0a
+1d3d : ed ba 23 SBC $23ba ; (sframe + 51)
+1d40 : 85 4f __ STA T6 + 0
+1d42 : a9 00 __ LDA #$00
+1d44 : e9 00 __ SBC #$00
+1d46 : 85 50 __ STA T6 + 1
+1d48 : ad b9 23 LDA $23b9 ; (sframe + 50)
+1d4b : 85 45 __ STA T1 + 0
+1d4d : a5 50 __ LDA T6 + 1
+1d4f : 49 80 __ EOR #$80
+1d51 : c9 80 __ CMP #$80
+1d53 : d0 04 __ BNE $1d59
+1d55 : a5 4f __ LDA T6 + 0
+1d57 : c5 49 __ CMP T3 + 0
+1d59 : 90 24 __ BCC $1d7f
+1d5b : a9 00 __ LDA #$00
+1d5d : 85 45 __ STA T1 + 0
+1d5f : a5 49 __ LDA T3 + 0
+1d61 : c9 0a __ CMP #$0a
+1d63 : 90 03 __ BCC $1d68
+1d65 : 4c cf 18 JMP $18cf ; (printf + 3190)
+1d68 : a4 49 __ LDY T3 + 0
+1d6a : b9 87 23 LDA $2387,y ; (sframe + 0)
+1d6d : a4 45 __ LDY T1 + 0
+1d6f : 99 87 23 STA $2387,y ; (sframe + 0)
+1d72 : e6 45 __ INC T1 + 0
+1d74 : e6 49 __ INC T3 + 0
+1d76 : a5 49 __ LDA T3 + 0
+1d78 : c9 0a __ CMP #$0a
+1d7a : 90 ec __ BCC $1d68
+1d7c : 4c cf 18 JMP $18cf ; (printf + 3190)
+1d7f : c6 49 __ DEC T3 + 0
+1d81 : a5 45 __ LDA T1 + 0
+1d83 : a4 49 __ LDY T3 + 0
+1d85 : 99 87 23 STA $2387,y ; (sframe + 0)
+1d88 : 4c 4d 1d JMP $1d4d ; (printf + 4340)
+1d8b : c6 49 __ DEC T3 + 0
+1d8d : a9 2d __ LDA #$2d
+1d8f : a4 49 __ LDY T3 + 0
+1d91 : 99 87 23 STA $2387,y ; (sframe + 0)
+1d94 : 4c 3a 1d JMP $1d3a ; (printf + 4321)
+1d97 : a9 09 __ LDA #$09
+1d99 : 85 4d __ STA T5 + 0
+1d9b : c5 49 __ CMP T3 + 0
+1d9d : b0 03 __ BCS $1da2
+1d9f : 4c eb 1c JMP $1ceb ; (printf + 4242)
+1da2 : 4c fa 1c JMP $1cfa ; (printf + 4257)
+1da5 : ad bc 23 LDA $23bc ; (sframe + 53)
+1da8 : 85 4f __ STA T6 + 0
+1daa : 85 55 __ STA T9 + 0
+1dac : ad bd 23 LDA $23bd ; (sframe + 54)
+1daf : 85 50 __ STA T6 + 1
+1db1 : 85 56 __ STA T9 + 1
+1db3 : a5 53 __ LDA T8 + 0
+1db5 : 85 1b __ STA ACCU + 0
+1db7 : a5 54 __ LDA T8 + 1
+1db9 : 85 1c __ STA ACCU + 1
+1dbb : a5 55 __ LDA T9 + 0
+1dbd : 85 03 __ STA $03
+1dbf : a5 56 __ LDA T9 + 1
+1dc1 : 85 04 __ STA $04
+1dc3 : 20 9a 21 JSR $219a ; (divmod + 0)
+1dc6 : a5 06 __ LDA $06
+1dc8 : 10 2e __ BPL $1df8
+1dca : 18 __ __ CLC
+1dcb : a5 05 __ LDA $05
+1dcd : 69 30 __ ADC #$30
+1dcf : c6 49 __ DEC T3 + 0
+1dd1 : a4 49 __ LDY T3 + 0
+1dd3 : 99 87 23 STA $2387,y ; (sframe + 0)
+1dd6 : a5 53 __ LDA T8 + 0
+1dd8 : 85 1b __ STA ACCU + 0
+1dda : a5 54 __ LDA T8 + 1
+1ddc : 85 1c __ STA ACCU + 1
+1dde : a5 4f __ LDA T6 + 0
+1de0 : 85 03 __ STA $03
+1de2 : a5 50 __ LDA T6 + 1
+1de4 : 85 04 __ STA $04
+1de6 : 20 9a 21 JSR $219a ; (divmod + 0)
+1de9 : a5 1b __ LDA ACCU + 0
+1deb : 85 53 __ STA T8 + 0
+1ded : a5 1c __ LDA ACCU + 1
+1def : 85 54 __ STA T8 + 1
+1df1 : 05 1b __ ORA ACCU + 0
+1df3 : d0 be __ BNE $1db3
+1df5 : 4c d5 1c JMP $1cd5 ; (printf + 4220)
+1df8 : d0 06 __ BNE $1e00
+1dfa : a5 05 __ LDA $05
+1dfc : c9 0a __ CMP #$0a
+1dfe : 90 ca __ BCC $1dca
+1e00 : 18 __ __ CLC
+1e01 : a5 05 __ LDA $05
+1e03 : 69 37 __ ADC #$37
+1e05 : 4c cf 1d JMP $1dcf ; (printf + 4470)
+1e08 : a9 01 __ LDA #$01
+1e0a : 85 45 __ STA T1 + 0
+1e0c : a9 0a __ LDA #$0a
+1e0e : 85 49 __ STA T3 + 0
+1e10 : 38 __ __ SEC
+1e11 : a9 00 __ LDA #$00
+1e13 : e5 4f __ SBC T6 + 0
+1e15 : 85 53 __ STA T8 + 0
+1e17 : a9 00 __ LDA #$00
+1e19 : e5 50 __ SBC T6 + 1
+1e1b : 85 54 __ STA T8 + 1
+1e1d : 05 53 __ ORA T8 + 0
+1e1f : d0 84 __ BNE $1da5
+1e21 : 4c d5 1c JMP $1cd5 ; (printf + 4220)
+1e24 : a9 00 __ LDA #$00
+1e26 : 85 4f __ STA T6 + 0
+1e28 : 85 50 __ STA T6 + 1
+1e2a : a0 00 __ LDY #$00
+1e2c : b1 47 __ LDA (T2 + 0),y
+1e2e : 85 49 __ STA T3 + 0
+1e30 : e6 47 __ INC T2 + 0
+1e32 : d0 02 __ BNE $1e36
+1e34 : e6 48 __ INC T2 + 1
+1e36 : a5 49 __ LDA T3 + 0
+1e38 : c9 30 __ CMP #$30
+1e3a : 90 4f __ BCC $1e8b
+1e3c : a9 39 __ LDA #$39
+1e3e : c5 49 __ CMP T3 + 0
+1e40 : 90 49 __ BCC $1e8b
+1e42 : a5 49 __ LDA T3 + 0
+1e44 : 85 51 __ STA T7 + 0
+1e46 : a0 00 __ LDY #$00
+1e48 : b1 47 __ LDA (T2 + 0),y
+1e4a : 85 49 __ STA T3 + 0
+1e4c : e6 47 __ INC T2 + 0
+1e4e : d0 02 __ BNE $1e52
+1e50 : e6 48 __ INC T2 + 1
+1e52 : a5 4f __ LDA T6 + 0
+1e54 : 0a __ __ ASL
+1e55 : 85 07 __ STA $07
+1e57 : a5 50 __ LDA T6 + 1
+1e59 : 2a __ __ ROL
+1e5a : 06 07 __ ASL $07
+1e5c : 2a __ __ ROL
+1e5d : 85 08 __ STA $08
+1e5f : 18 __ __ CLC
+1e60 : a5 07 __ LDA $07
+1e62 : 65 4f __ ADC T6 + 0
+1e64 : 85 1b __ STA ACCU + 0
+1e66 : a5 08 __ LDA $08
+1e68 : 65 50 __ ADC T6 + 1
+1e6a : 06 1b __ ASL ACCU + 0
+1e6c : 2a __ __ ROL
+1e6d : 85 1c __ STA ACCU + 1
+1e6f : 18 __ __ CLC
+1e70 : a5 1b __ LDA ACCU + 0
+1e72 : 65 51 __ ADC T7 + 0
+1e74 : aa __ __ TAX
+1e75 : a5 1c __ LDA ACCU + 1
+1e77 : 69 00 __ ADC #$00
+1e79 : a8 __ __ TAY
+1e7a : 38 __ __ SEC
+1e7b : 8a __ __ TXA
+1e7c : e9 30 __ SBC #$30
+1e7e : 85 4f __ STA T6 + 0
+1e80 : 98 __ __ TYA
+1e81 : e9 00 __ SBC #$00
+1e83 : 85 50 __ STA T6 + 1
+1e85 : a5 49 __ LDA T3 + 0
+1e87 : c9 30 __ CMP #$30
+1e89 : b0 b1 __ BCS $1e3c
+1e8b : a5 4f __ LDA T6 + 0
+1e8d : 8d bb 23 STA $23bb ; (sframe + 52)
+1e90 : 4c ca 0d JMP $0dca ; (printf + 369)
+1e93 : a9 01 __ LDA #$01
+1e95 : 8d c0 23 STA $23c0 ; (sframe + 57)
+1e98 : a0 00 __ LDY #$00
+1e9a : b1 47 __ LDA (T2 + 0),y
+1e9c : 85 49 __ STA T3 + 0
+1e9e : 4c 3a 0d JMP $0d3a ; (printf + 225)
+1ea1 : a9 30 __ LDA #$30
+1ea3 : 8d b9 23 STA $23b9 ; (sframe + 50)
+1ea6 : a0 00 __ LDY #$00
+1ea8 : b1 47 __ LDA (T2 + 0),y
+1eaa : 85 49 __ STA T3 + 0
+1eac : 4c 3a 0d JMP $0d3a ; (printf + 225)
+1eaf : a9 01 __ LDA #$01
+1eb1 : 8d be 23 STA $23be ; (sframe + 55)
+1eb4 : a0 00 __ LDY #$00
+1eb6 : b1 47 __ LDA (T2 + 0),y
+1eb8 : 85 49 __ STA T3 + 0
+1eba : 4c 3a 0d JMP $0d3a ; (printf + 225)
+--------------------------------------------------------------------
+puts:
+1ebd : a0 00 __ LDY #$00
+1ebf : b1 0d __ LDA (P0),y
+1ec1 : f0 0b __ BEQ $1ece
+1ec3 : 20 cf 1e JSR $1ecf ; (putpch + 0)
+1ec6 : e6 0d __ INC P0
+1ec8 : d0 f3 __ BNE $1ebd
+1eca : e6 0e __ INC P1
+1ecc : d0 ef __ BNE $1ebd
+1ece : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1ecf : ae 7e 23 LDX $237e ; (giocharmap + 0)
+1ed2 : e0 01 __ CPX #$01
+1ed4 : 90 22 __ BCC $1ef8
+1ed6 : c9 0a __ CMP #$0a
+1ed8 : d0 02 __ BNE $1edc
+1eda : a9 0d __ LDA #$0d
+1edc : e0 02 __ CPX #$02
+1ede : 90 18 __ BCC $1ef8
+1ee0 : c9 41 __ CMP #$41
+1ee2 : 90 14 __ BCC $1ef8
+1ee4 : c9 7b __ CMP #$7b
+1ee6 : b0 10 __ BCS $1ef8
+1ee8 : c9 61 __ CMP #$61
+1eea : b0 04 __ BCS $1ef0
+1eec : c9 5b __ CMP #$5b
+1eee : b0 08 __ BCS $1ef8
+1ef0 : 49 20 __ EOR #$20
+1ef2 : e0 03 __ CPX #$03
+1ef4 : f0 02 __ BEQ $1ef8
+1ef6 : 29 df __ AND #$df
+1ef8 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+exit:
+1f08 : a5 0d __ LDA P0
+1f0a : 85 1b __ STA ACCU + 0
+1f0c : a5 0e __ LDA P1
+1f0e : 85 1c __ STA ACCU + 1
+1f10 : ae 7d 23 LDX $237d ; (spentry + 0)
+1f13 : 9a __ __ TXS
+1f14 : a9 4c __ LDA #$4c
+1f16 : 85 54 __ STA $54
+1f18 : a9 00 __ LDA #$00
+1f1a : 85 13 __ STA P6
+1f1c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1f2a : a9 4c __ LDA #$4c
+1f2c : 85 54 __ STA $54
+1f2e : a9 00 __ LDA #$00
+1f30 : 85 13 __ STA P6
+1f32 : a9 19 __ LDA #$19
+1f34 : 85 16 __ STA P9
+1f36 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1f37 : b1 19 __ LDA (IP + 0),y
+1f39 : c8 __ __ INY
+1f3a : aa __ __ TAX
+1f3b : b5 00 __ LDA $00,x
+1f3d : 85 03 __ STA $03
+1f3f : b5 01 __ LDA $01,x
+1f41 : 85 04 __ STA $04
+1f43 : b5 02 __ LDA $02,x
+1f45 : 85 05 __ STA $05
+1f47 : b5 03 __ LDA $03,x
+1f49 : 85 06 __ STA $06
+1f4b : a5 05 __ LDA $05
+1f4d : 0a __ __ ASL
+1f4e : a5 06 __ LDA $06
+1f50 : 2a __ __ ROL
+1f51 : 85 08 __ STA $08
+1f53 : f0 06 __ BEQ $1f5b
+1f55 : a5 05 __ LDA $05
+1f57 : 09 80 __ ORA #$80
+1f59 : 85 05 __ STA $05
+1f5b : a5 1d __ LDA ACCU + 2
+1f5d : 0a __ __ ASL
+1f5e : a5 1e __ LDA ACCU + 3
+1f60 : 2a __ __ ROL
+1f61 : 85 07 __ STA $07
+1f63 : f0 06 __ BEQ $1f6b
+1f65 : a5 1d __ LDA ACCU + 2
+1f67 : 09 80 __ ORA #$80
+1f69 : 85 1d __ STA ACCU + 2
+1f6b : 60 __ __ RTS
+1f6c : 06 1e __ ASL ACCU + 3
+1f6e : a5 07 __ LDA $07
+1f70 : 6a __ __ ROR
+1f71 : 85 1e __ STA ACCU + 3
+1f73 : b0 06 __ BCS $1f7b
+1f75 : a5 1d __ LDA ACCU + 2
+1f77 : 29 7f __ AND #$7f
+1f79 : 85 1d __ STA ACCU + 2
+1f7b : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1f7c : 38 __ __ SEC
+1f7d : a5 07 __ LDA $07
+1f7f : e5 08 __ SBC $08
+1f81 : f0 38 __ BEQ $1fbb
+1f83 : aa __ __ TAX
+1f84 : b0 25 __ BCS $1fab
+1f86 : e0 e9 __ CPX #$e9
+1f88 : b0 0e __ BCS $1f98
+1f8a : a5 08 __ LDA $08
+1f8c : 85 07 __ STA $07
+1f8e : a9 00 __ LDA #$00
+1f90 : 85 1b __ STA ACCU + 0
+1f92 : 85 1c __ STA ACCU + 1
+1f94 : 85 1d __ STA ACCU + 2
+1f96 : f0 23 __ BEQ $1fbb
+1f98 : a5 1d __ LDA ACCU + 2
+1f9a : 4a __ __ LSR
+1f9b : 66 1c __ ROR ACCU + 1
+1f9d : 66 1b __ ROR ACCU + 0
+1f9f : e8 __ __ INX
+1fa0 : d0 f8 __ BNE $1f9a
+1fa2 : 85 1d __ STA ACCU + 2
+1fa4 : a5 08 __ LDA $08
+1fa6 : 85 07 __ STA $07
+1fa8 : 4c bb 1f JMP $1fbb ; (faddsub + 63)
+1fab : e0 18 __ CPX #$18
+1fad : b0 33 __ BCS $1fe2
+1faf : a5 05 __ LDA $05
+1fb1 : 4a __ __ LSR
+1fb2 : 66 04 __ ROR $04
+1fb4 : 66 03 __ ROR $03
+1fb6 : ca __ __ DEX
+1fb7 : d0 f8 __ BNE $1fb1
+1fb9 : 85 05 __ STA $05
+1fbb : a5 1e __ LDA ACCU + 3
+1fbd : 29 80 __ AND #$80
+1fbf : 85 1e __ STA ACCU + 3
+1fc1 : 45 06 __ EOR $06
+1fc3 : 30 2d __ BMI $1ff2
+1fc5 : 18 __ __ CLC
+1fc6 : a5 1b __ LDA ACCU + 0
+1fc8 : 65 03 __ ADC $03
+1fca : 85 1b __ STA ACCU + 0
+1fcc : a5 1c __ LDA ACCU + 1
+1fce : 65 04 __ ADC $04
+1fd0 : 85 1c __ STA ACCU + 1
+1fd2 : a5 1d __ LDA ACCU + 2
+1fd4 : 65 05 __ ADC $05
+1fd6 : 85 1d __ STA ACCU + 2
+1fd8 : 90 08 __ BCC $1fe2
+1fda : 66 1d __ ROR ACCU + 2
+1fdc : 66 1c __ ROR ACCU + 1
+1fde : 66 1b __ ROR ACCU + 0
+1fe0 : e6 07 __ INC $07
+1fe2 : a5 07 __ LDA $07
+1fe4 : 4a __ __ LSR
+1fe5 : 05 1e __ ORA ACCU + 3
+1fe7 : 85 1e __ STA ACCU + 3
+1fe9 : b0 06 __ BCS $1ff1
+1feb : a5 1d __ LDA ACCU + 2
+1fed : 29 7f __ AND #$7f
+1fef : 85 1d __ STA ACCU + 2
+1ff1 : 60 __ __ RTS
+1ff2 : 38 __ __ SEC
+1ff3 : a5 1b __ LDA ACCU + 0
+1ff5 : e5 03 __ SBC $03
+1ff7 : 85 1b __ STA ACCU + 0
+1ff9 : a5 1c __ LDA ACCU + 1
+1ffb : e5 04 __ SBC $04
+1ffd : 85 1c __ STA ACCU + 1
+1fff : a5 1d __ LDA ACCU + 2
+2001 : e5 05 __ SBC $05
+2003 : 85 1d __ STA ACCU + 2
+2005 : b0 19 __ BCS $2020
+2007 : 38 __ __ SEC
+2008 : a9 00 __ LDA #$00
+200a : e5 1b __ SBC ACCU + 0
+200c : 85 1b __ STA ACCU + 0
+200e : a9 00 __ LDA #$00
+2010 : e5 1c __ SBC ACCU + 1
+2012 : 85 1c __ STA ACCU + 1
+2014 : a9 00 __ LDA #$00
+2016 : e5 1d __ SBC ACCU + 2
+2018 : 85 1d __ STA ACCU + 2
+201a : a5 1e __ LDA ACCU + 3
+201c : 49 80 __ EOR #$80
+201e : 85 1e __ STA ACCU + 3
+2020 : a5 1d __ LDA ACCU + 2
+2022 : 30 be __ BMI $1fe2
+2024 : 05 1c __ ORA ACCU + 1
+2026 : 05 1b __ ORA ACCU + 0
+2028 : f0 0f __ BEQ $2039
+202a : c6 07 __ DEC $07
+202c : f0 0b __ BEQ $2039
+202e : 06 1b __ ASL ACCU + 0
+2030 : 26 1c __ ROL ACCU + 1
+2032 : 26 1d __ ROL ACCU + 2
+2034 : 10 f4 __ BPL $202a
+2036 : 4c e2 1f JMP $1fe2 ; (faddsub + 102)
+2039 : a9 00 __ LDA #$00
+203b : 85 1b __ STA ACCU + 0
+203d : 85 1c __ STA ACCU + 1
+203f : 85 1d __ STA ACCU + 2
+2041 : 85 1e __ STA ACCU + 3
+2043 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+2044 : a5 1b __ LDA ACCU + 0
+2046 : 05 1c __ ORA ACCU + 1
+2048 : 05 1d __ ORA ACCU + 2
+204a : d0 03 __ BNE $204f
+204c : 85 1e __ STA ACCU + 3
+204e : 60 __ __ RTS
+204f : a5 03 __ LDA $03
+2051 : 05 04 __ ORA $04
+2053 : 05 05 __ ORA $05
+2055 : d0 09 __ BNE $2060
+2057 : 85 1b __ STA ACCU + 0
+2059 : 85 1c __ STA ACCU + 1
+205b : 85 1d __ STA ACCU + 2
+205d : 85 1e __ STA ACCU + 3
+205f : 60 __ __ RTS
+2060 : a9 00 __ LDA #$00
+2062 : 85 09 __ STA $09
+2064 : 85 0a __ STA $0a
+2066 : 85 0b __ STA $0b
+2068 : a4 1b __ LDY ACCU + 0
+206a : a5 03 __ LDA $03
+206c : d0 06 __ BNE $2074
+206e : a5 04 __ LDA $04
+2070 : f0 0a __ BEQ $207c
+2072 : d0 05 __ BNE $2079
+2074 : 20 b4 20 JSR $20b4 ; (fmul8 + 0)
+2077 : a5 04 __ LDA $04
+2079 : 20 b4 20 JSR $20b4 ; (fmul8 + 0)
+207c : a5 05 __ LDA $05
+207e : 20 b4 20 JSR $20b4 ; (fmul8 + 0)
+2081 : 38 __ __ SEC
+2082 : a5 0b __ LDA $0b
+2084 : 30 06 __ BMI $208c
+2086 : 06 09 __ ASL $09
+2088 : 26 0a __ ROL $0a
+208a : 2a __ __ ROL
+208b : 18 __ __ CLC
+208c : 29 7f __ AND #$7f
+208e : 85 0b __ STA $0b
+2090 : a5 1e __ LDA ACCU + 3
+2092 : 45 06 __ EOR $06
+2094 : 29 80 __ AND #$80
+2096 : 85 1e __ STA ACCU + 3
+2098 : a5 07 __ LDA $07
+209a : e9 7e __ SBC #$7e
+209c : 18 __ __ CLC
+209d : 65 08 __ ADC $08
+209f : 4a __ __ LSR
+20a0 : 05 1e __ ORA ACCU + 3
+20a2 : 85 1e __ STA ACCU + 3
+20a4 : a9 00 __ LDA #$00
+20a6 : 6a __ __ ROR
+20a7 : 05 0b __ ORA $0b
+20a9 : 85 1d __ STA ACCU + 2
+20ab : a5 0a __ LDA $0a
+20ad : 85 1c __ STA ACCU + 1
+20af : a5 09 __ LDA $09
+20b1 : 85 1b __ STA ACCU + 0
+20b3 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+20b4 : 38 __ __ SEC
+20b5 : 6a __ __ ROR
+20b6 : 90 1e __ BCC $20d6
+20b8 : aa __ __ TAX
+20b9 : 18 __ __ CLC
+20ba : 98 __ __ TYA
+20bb : 65 09 __ ADC $09
+20bd : 85 09 __ STA $09
+20bf : a5 0a __ LDA $0a
+20c1 : 65 1c __ ADC ACCU + 1
+20c3 : 85 0a __ STA $0a
+20c5 : a5 0b __ LDA $0b
+20c7 : 65 1d __ ADC ACCU + 2
+20c9 : 6a __ __ ROR
+20ca : 85 0b __ STA $0b
+20cc : 8a __ __ TXA
+20cd : 66 0a __ ROR $0a
+20cf : 66 09 __ ROR $09
+20d1 : 4a __ __ LSR
+20d2 : f0 0d __ BEQ $20e1
+20d4 : b0 e2 __ BCS $20b8
+20d6 : 66 0b __ ROR $0b
+20d8 : 66 0a __ ROR $0a
+20da : 66 09 __ ROR $09
+20dc : 4a __ __ LSR
+20dd : 90 f7 __ BCC $20d6
+20df : d0 d7 __ BNE $20b8
+20e1 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+20e2 : a5 1b __ LDA ACCU + 0
+20e4 : 05 1c __ ORA ACCU + 1
+20e6 : 05 1d __ ORA ACCU + 2
+20e8 : d0 03 __ BNE $20ed
+20ea : 85 1e __ STA ACCU + 3
+20ec : 60 __ __ RTS
+20ed : a5 1e __ LDA ACCU + 3
+20ef : 45 06 __ EOR $06
+20f1 : 29 80 __ AND #$80
+20f3 : 85 1e __ STA ACCU + 3
+20f5 : a9 00 __ LDA #$00
+20f7 : 85 09 __ STA $09
+20f9 : 85 0a __ STA $0a
+20fb : 85 0b __ STA $0b
+20fd : a2 18 __ LDX #$18
+20ff : a5 1b __ LDA ACCU + 0
+2101 : c5 03 __ CMP $03
+2103 : a5 1c __ LDA ACCU + 1
+2105 : e5 04 __ SBC $04
+2107 : a5 1d __ LDA ACCU + 2
+2109 : e5 05 __ SBC $05
+210b : 90 13 __ BCC $2120
+210d : a5 1b __ LDA ACCU + 0
+210f : e5 03 __ SBC $03
+2111 : 85 1b __ STA ACCU + 0
+2113 : a5 1c __ LDA ACCU + 1
+2115 : e5 04 __ SBC $04
+2117 : 85 1c __ STA ACCU + 1
+2119 : a5 1d __ LDA ACCU + 2
+211b : e5 05 __ SBC $05
+211d : 85 1d __ STA ACCU + 2
+211f : 38 __ __ SEC
+2120 : 26 09 __ ROL $09
+2122 : 26 0a __ ROL $0a
+2124 : 26 0b __ ROL $0b
+2126 : ca __ __ DEX
+2127 : f0 0a __ BEQ $2133
+2129 : 06 1b __ ASL ACCU + 0
+212b : 26 1c __ ROL ACCU + 1
+212d : 26 1d __ ROL ACCU + 2
+212f : b0 dc __ BCS $210d
+2131 : 90 cc __ BCC $20ff
+2133 : 38 __ __ SEC
+2134 : a5 0b __ LDA $0b
+2136 : 30 06 __ BMI $213e
+2138 : 06 09 __ ASL $09
+213a : 26 0a __ ROL $0a
+213c : 2a __ __ ROL
+213d : 18 __ __ CLC
+213e : 29 7f __ AND #$7f
+2140 : 85 0b __ STA $0b
+2142 : a5 08 __ LDA $08
+2144 : 49 7f __ EOR #$7f
+2146 : 65 07 __ ADC $07
+2148 : 38 __ __ SEC
+2149 : e9 01 __ SBC #$01
+214b : 4a __ __ LSR
+214c : 05 1e __ ORA ACCU + 3
+214e : 85 1e __ STA ACCU + 3
+2150 : a9 00 __ LDA #$00
+2152 : 6a __ __ ROR
+2153 : 05 0b __ ORA $0b
+2155 : 85 1d __ STA ACCU + 2
+2157 : a5 0a __ LDA $0a
+2159 : 85 1c __ STA ACCU + 1
+215b : a5 09 __ LDA $09
+215d : 85 1b __ STA ACCU + 0
+215f : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+2160 : 24 1c __ BIT ACCU + 1
+2162 : 10 0d __ BPL $2171
+2164 : 20 7e 21 JSR $217e ; (negaccu + 0)
+2167 : 24 04 __ BIT $04
+2169 : 10 0d __ BPL $2178
+216b : 20 8c 21 JSR $218c ; (negtmp + 0)
+216e : 4c 9a 21 JMP $219a ; (divmod + 0)
+2171 : 24 04 __ BIT $04
+2173 : 10 f9 __ BPL $216e
+2175 : 20 8c 21 JSR $218c ; (negtmp + 0)
+2178 : 20 9a 21 JSR $219a ; (divmod + 0)
+217b : 4c 7e 21 JMP $217e ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+217e : 38 __ __ SEC
+217f : a9 00 __ LDA #$00
+2181 : e5 1b __ SBC ACCU + 0
+2183 : 85 1b __ STA ACCU + 0
+2185 : a9 00 __ LDA #$00
+2187 : e5 1c __ SBC ACCU + 1
+2189 : 85 1c __ STA ACCU + 1
+218b : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+218c : 38 __ __ SEC
+218d : a9 00 __ LDA #$00
+218f : e5 03 __ SBC $03
+2191 : 85 03 __ STA $03
+2193 : a9 00 __ LDA #$00
+2195 : e5 04 __ SBC $04
+2197 : 85 04 __ STA $04
+2199 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+219a : a5 1c __ LDA ACCU + 1
+219c : d0 31 __ BNE $21cf
+219e : a5 04 __ LDA $04
+21a0 : d0 1e __ BNE $21c0
+21a2 : 85 06 __ STA $06
+21a4 : a2 04 __ LDX #$04
+21a6 : 06 1b __ ASL ACCU + 0
+21a8 : 2a __ __ ROL
+21a9 : c5 03 __ CMP $03
+21ab : 90 02 __ BCC $21af
+21ad : e5 03 __ SBC $03
+21af : 26 1b __ ROL ACCU + 0
+21b1 : 2a __ __ ROL
+21b2 : c5 03 __ CMP $03
+21b4 : 90 02 __ BCC $21b8
+21b6 : e5 03 __ SBC $03
+21b8 : 26 1b __ ROL ACCU + 0
+21ba : ca __ __ DEX
+21bb : d0 eb __ BNE $21a8
+21bd : 85 05 __ STA $05
+21bf : 60 __ __ RTS
+21c0 : a5 1b __ LDA ACCU + 0
+21c2 : 85 05 __ STA $05
+21c4 : a5 1c __ LDA ACCU + 1
+21c6 : 85 06 __ STA $06
+21c8 : a9 00 __ LDA #$00
+21ca : 85 1b __ STA ACCU + 0
+21cc : 85 1c __ STA ACCU + 1
+21ce : 60 __ __ RTS
+21cf : a5 04 __ LDA $04
+21d1 : d0 1f __ BNE $21f2
+21d3 : a5 03 __ LDA $03
+21d5 : 30 1b __ BMI $21f2
+21d7 : a9 00 __ LDA #$00
+21d9 : 85 06 __ STA $06
+21db : a2 10 __ LDX #$10
+21dd : 06 1b __ ASL ACCU + 0
+21df : 26 1c __ ROL ACCU + 1
+21e1 : 2a __ __ ROL
+21e2 : c5 03 __ CMP $03
+21e4 : 90 02 __ BCC $21e8
+21e6 : e5 03 __ SBC $03
+21e8 : 26 1b __ ROL ACCU + 0
+21ea : 26 1c __ ROL ACCU + 1
+21ec : ca __ __ DEX
+21ed : d0 f2 __ BNE $21e1
+21ef : 85 05 __ STA $05
+21f1 : 60 __ __ RTS
+21f2 : a9 00 __ LDA #$00
+21f4 : 85 05 __ STA $05
+21f6 : 85 06 __ STA $06
+21f8 : 84 02 __ STY $02
+21fa : a0 10 __ LDY #$10
+21fc : 18 __ __ CLC
+21fd : 26 1b __ ROL ACCU + 0
+21ff : 26 1c __ ROL ACCU + 1
+2201 : 26 05 __ ROL $05
+2203 : 26 06 __ ROL $06
+2205 : 38 __ __ SEC
+2206 : a5 05 __ LDA $05
+2208 : e5 03 __ SBC $03
+220a : aa __ __ TAX
+220b : a5 06 __ LDA $06
+220d : e5 04 __ SBC $04
+220f : 90 04 __ BCC $2215
+2211 : 86 05 __ STX $05
+2213 : 85 06 __ STA $06
+2215 : 88 __ __ DEY
+2216 : d0 e5 __ BNE $21fd
+2218 : 26 1b __ ROL ACCU + 0
+221a : 26 1c __ ROL ACCU + 1
+221c : a4 02 __ LDY $02
+221e : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+221f : 24 1c __ BIT ACCU + 1
+2221 : 10 0d __ BPL $2230
+2223 : 20 7e 21 JSR $217e ; (negaccu + 0)
+2226 : 24 04 __ BIT $04
+2228 : 10 0d __ BPL $2237
+222a : 20 8c 21 JSR $218c ; (negtmp + 0)
+222d : 4c 9a 21 JMP $219a ; (divmod + 0)
+2230 : 24 04 __ BIT $04
+2232 : 10 f9 __ BPL $222d
+2234 : 20 8c 21 JSR $218c ; (negtmp + 0)
+2237 : 20 9a 21 JSR $219a ; (divmod + 0)
+223a : 38 __ __ SEC
+223b : a9 00 __ LDA #$00
+223d : e5 05 __ SBC $05
+223f : 85 05 __ STA $05
+2241 : a9 00 __ LDA #$00
+2243 : e5 06 __ SBC $06
+2245 : 85 06 __ STA $06
+2247 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+2248 : 20 5b 1f JSR $1f5b ; (freg + 36)
+224b : a5 07 __ LDA $07
+224d : c9 7f __ CMP #$7f
+224f : b0 07 __ BCS $2258
+2251 : a9 00 __ LDA #$00
+2253 : 85 1b __ STA ACCU + 0
+2255 : 85 1c __ STA ACCU + 1
+2257 : 60 __ __ RTS
+2258 : 38 __ __ SEC
+2259 : e9 8e __ SBC #$8e
+225b : 90 0a __ BCC $2267
+225d : a9 ff __ LDA #$ff
+225f : 85 1b __ STA ACCU + 0
+2261 : a9 7f __ LDA #$7f
+2263 : 85 1c __ STA ACCU + 1
+2265 : d0 08 __ BNE $226f
+2267 : aa __ __ TAX
+2268 : 46 1d __ LSR ACCU + 2
+226a : 66 1c __ ROR ACCU + 1
+226c : e8 __ __ INX
+226d : d0 f9 __ BNE $2268
+226f : 24 1e __ BIT ACCU + 3
+2271 : 10 0e __ BPL $2281
+2273 : 38 __ __ SEC
+2274 : a9 00 __ LDA #$00
+2276 : e5 1c __ SBC ACCU + 1
+2278 : 85 1b __ STA ACCU + 0
+227a : a9 00 __ LDA #$00
+227c : e5 1d __ SBC ACCU + 2
+227e : 85 1c __ STA ACCU + 1
+2280 : 60 __ __ RTS
+2281 : a5 1c __ LDA ACCU + 1
+2283 : 85 1b __ STA ACCU + 0
+2285 : a5 1d __ LDA ACCU + 2
+2287 : 85 1c __ STA ACCU + 1
+2289 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+228a : 24 1c __ BIT ACCU + 1
+228c : 30 03 __ BMI $2291
+228e : 4c a8 22 JMP $22a8 ; (uint16_to_float + 0)
+2291 : 38 __ __ SEC
+2292 : a9 00 __ LDA #$00
+2294 : e5 1b __ SBC ACCU + 0
+2296 : 85 1b __ STA ACCU + 0
+2298 : a9 00 __ LDA #$00
+229a : e5 1c __ SBC ACCU + 1
+229c : 85 1c __ STA ACCU + 1
+229e : 20 a8 22 JSR $22a8 ; (uint16_to_float + 0)
+22a1 : a5 1e __ LDA ACCU + 3
+22a3 : 09 80 __ ORA #$80
+22a5 : 85 1e __ STA ACCU + 3
+22a7 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+22a8 : a5 1b __ LDA ACCU + 0
+22aa : 05 1c __ ORA ACCU + 1
+22ac : d0 05 __ BNE $22b3
+22ae : 85 1d __ STA ACCU + 2
+22b0 : 85 1e __ STA ACCU + 3
+22b2 : 60 __ __ RTS
+22b3 : a2 8e __ LDX #$8e
+22b5 : a5 1c __ LDA ACCU + 1
+22b7 : 30 06 __ BMI $22bf
+22b9 : ca __ __ DEX
+22ba : 06 1b __ ASL ACCU + 0
+22bc : 2a __ __ ROL
+22bd : 10 fa __ BPL $22b9
+22bf : 29 7f __ AND #$7f
+22c1 : 85 1d __ STA ACCU + 2
+22c3 : a5 1b __ LDA ACCU + 0
+22c5 : 85 1c __ STA ACCU + 1
+22c7 : 8a __ __ TXA
+22c8 : 4a __ __ LSR
+22c9 : 85 1e __ STA ACCU + 3
+22cb : a9 00 __ LDA #$00
+22cd : 85 1b __ STA ACCU + 0
+22cf : 6a __ __ ROR
+22d0 : 05 1d __ ORA ACCU + 2
+22d2 : 85 1d __ STA ACCU + 2
+22d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+22d5 : a5 1e __ LDA ACCU + 3
+22d7 : 45 06 __ EOR $06
+22d9 : 29 80 __ AND #$80
+22db : f0 1e __ BEQ $22fb
+22dd : a5 1e __ LDA ACCU + 3
+22df : 29 7f __ AND #$7f
+22e1 : 05 1d __ ORA ACCU + 2
+22e3 : 05 1c __ ORA ACCU + 1
+22e5 : 05 1b __ ORA ACCU + 0
+22e7 : d0 0c __ BNE $22f5
+22e9 : a5 06 __ LDA $06
+22eb : 29 7f __ AND #$7f
+22ed : 05 05 __ ORA $05
+22ef : 05 04 __ ORA $04
+22f1 : 05 03 __ ORA $03
+22f3 : f0 1e __ BEQ $2313
+22f5 : a5 1e __ LDA ACCU + 3
+22f7 : 30 23 __ BMI $231c
+22f9 : 10 28 __ BPL $2323
+22fb : a5 1e __ LDA ACCU + 3
+22fd : c5 06 __ CMP $06
+22ff : d0 15 __ BNE $2316
+2301 : a5 1d __ LDA ACCU + 2
+2303 : c5 05 __ CMP $05
+2305 : d0 0f __ BNE $2316
+2307 : a5 1c __ LDA ACCU + 1
+2309 : c5 04 __ CMP $04
+230b : d0 09 __ BNE $2316
+230d : a5 1b __ LDA ACCU + 0
+230f : c5 03 __ CMP $03
+2311 : d0 03 __ BNE $2316
+2313 : a9 00 __ LDA #$00
+2315 : 60 __ __ RTS
+2316 : b0 07 __ BCS $231f
+2318 : 24 1e __ BIT ACCU + 3
+231a : 30 07 __ BMI $2323
+231c : a9 01 __ LDA #$01
+231e : 60 __ __ RTS
+231f : 24 1e __ BIT ACCU + 3
+2321 : 30 f9 __ BMI $231c
+2323 : a9 ff __ LDA #$ff
+2325 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+2326 : 84 02 __ STY $02
+2328 : a9 00 __ LDA #$00
+232a : 85 07 __ STA $07
+232c : 85 08 __ STA $08
+232e : 85 09 __ STA $09
+2330 : 85 0a __ STA $0a
+2332 : a0 20 __ LDY #$20
+2334 : 18 __ __ CLC
+2335 : 26 1b __ ROL ACCU + 0
+2337 : 26 1c __ ROL ACCU + 1
+2339 : 26 1d __ ROL ACCU + 2
+233b : 26 1e __ ROL ACCU + 3
+233d : 26 07 __ ROL $07
+233f : 26 08 __ ROL $08
+2341 : 26 09 __ ROL $09
+2343 : 26 0a __ ROL $0a
+2345 : a5 07 __ LDA $07
+2347 : c5 03 __ CMP $03
+2349 : a5 08 __ LDA $08
+234b : e5 04 __ SBC $04
+234d : a5 09 __ LDA $09
+234f : e5 05 __ SBC $05
+2351 : a5 0a __ LDA $0a
+2353 : e5 06 __ SBC $06
+2355 : 90 18 __ BCC $236f
+2357 : a5 07 __ LDA $07
+2359 : e5 03 __ SBC $03
+235b : 85 07 __ STA $07
+235d : a5 08 __ LDA $08
+235f : e5 04 __ SBC $04
+2361 : 85 08 __ STA $08
+2363 : a5 09 __ LDA $09
+2365 : e5 05 __ SBC $05
+2367 : 85 09 __ STA $09
+2369 : a5 0a __ LDA $0a
+236b : e5 06 __ SBC $06
+236d : 85 0a __ STA $0a
+236f : 88 __ __ DEY
+2370 : d0 c3 __ BNE $2335
+2372 : 26 1b __ ROL ACCU + 0
+2374 : 26 1c __ ROL ACCU + 1
+2376 : 26 1d __ ROL ACCU + 2
+2378 : 26 1e __ ROL ACCU + 3
+237a : a4 02 __ LDY $02
+237c : 60 __ __ RTS
@@ -0,0 +1,3419 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 15 23 STX $2315 ; (spentry + 0)
+0811 : a9 1f __ LDA #$1f
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 59 __ LDA #$59
+0832 : e9 1f __ SBC #$1f
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c c2 1e JMP $1ec2 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 67 __ STA T0 + 0
+0911 : 85 68 __ STA T0 + 1
+0913 : 85 69 __ STA T0 + 2
+0915 : 85 6a __ STA T0 + 3
+0917 : 85 6b __ STA T1 + 0
+0919 : 85 6c __ STA T1 + 1
+091b : a9 83 __ LDA #$83
+091d : a0 02 __ LDY #$02
+091f : 91 23 __ STA (SP + 0),y
+0921 : a9 1e __ LDA #$1e
+0923 : c8 __ __ INY
+0924 : 91 23 __ STA (SP + 0),y
+0926 : a5 6b __ LDA T1 + 0
+0928 : 85 1b __ STA ACCU + 0
+092a : c8 __ __ INY
+092b : 91 23 __ STA (SP + 0),y
+092d : a5 6c __ LDA T1 + 1
+092f : 85 1c __ STA ACCU + 1
+0931 : c8 __ __ INY
+0932 : 91 23 __ STA (SP + 0),y
+0934 : ad 17 23 LDA $2317 ; (c + 0)
+0937 : 85 43 __ STA T3 + 0
+0939 : ad 18 23 LDA $2318 ; (c + 1)
+093c : 85 44 __ STA T3 + 1
+093e : ad 19 23 LDA $2319 ; (c + 2)
+0941 : 85 45 __ STA T3 + 2
+0943 : ad 1a 23 LDA $231a ; (c + 3)
+0946 : 85 46 __ STA T3 + 3
+0948 : 20 22 22 JSR $2222 ; (sint16_to_float + 0)
+094b : a5 43 __ LDA T3 + 0
+094d : 85 03 __ STA $03
+094f : a5 44 __ LDA T3 + 1
+0951 : 85 04 __ STA $04
+0953 : a5 45 __ LDA T3 + 2
+0955 : 85 05 __ STA $05
+0957 : a5 46 __ LDA T3 + 3
+0959 : 85 06 __ STA $06
+095b : 20 e3 1e JSR $1ee3 ; (freg + 20)
+095e : 20 dc 1f JSR $1fdc ; (fmul + 0)
+0961 : a5 1b __ LDA ACCU + 0
+0963 : a0 06 __ LDY #$06
+0965 : 91 23 __ STA (SP + 0),y
+0967 : a5 1c __ LDA ACCU + 1
+0969 : c8 __ __ INY
+096a : 91 23 __ STA (SP + 0),y
+096c : a5 1d __ LDA ACCU + 2
+096e : c8 __ __ INY
+096f : 91 23 __ STA (SP + 0),y
+0971 : a5 1e __ LDA ACCU + 3
+0973 : c8 __ __ INY
+0974 : 91 23 __ STA (SP + 0),y
+0976 : a5 67 __ LDA T0 + 0
+0978 : 85 03 __ STA $03
+097a : c8 __ __ INY
+097b : 91 23 __ STA (SP + 0),y
+097d : a5 68 __ LDA T0 + 1
+097f : 85 04 __ STA $04
+0981 : c8 __ __ INY
+0982 : 91 23 __ STA (SP + 0),y
+0984 : a5 69 __ LDA T0 + 2
+0986 : 85 05 __ STA $05
+0988 : c8 __ __ INY
+0989 : 91 23 __ STA (SP + 0),y
+098b : a5 6a __ LDA T0 + 3
+098d : 85 06 __ STA $06
+098f : c8 __ __ INY
+0990 : 91 23 __ STA (SP + 0),y
+0992 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0995 : a5 06 __ LDA $06
+0997 : 49 80 __ EOR #$80
+0999 : 85 06 __ STA $06
+099b : 20 14 1f JSR $1f14 ; (faddsub + 0)
+099e : a5 1b __ LDA ACCU + 0
+09a0 : a0 0e __ LDY #$0e
+09a2 : 91 23 __ STA (SP + 0),y
+09a4 : a5 1c __ LDA ACCU + 1
+09a6 : c8 __ __ INY
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : a5 1d __ LDA ACCU + 2
+09ab : c8 __ __ INY
+09ac : 91 23 __ STA (SP + 0),y
+09ae : a5 1e __ LDA ACCU + 3
+09b0 : c8 __ __ INY
+09b1 : 91 23 __ STA (SP + 0),y
+09b3 : 20 66 0c JSR $0c66 ; (printf + 0)
+09b6 : ad 17 23 LDA $2317 ; (c + 0)
+09b9 : 85 43 __ STA T3 + 0
+09bb : ad 18 23 LDA $2318 ; (c + 1)
+09be : 85 44 __ STA T3 + 1
+09c0 : ad 19 23 LDA $2319 ; (c + 2)
+09c3 : 85 45 __ STA T3 + 2
+09c5 : ad 1a 23 LDA $231a ; (c + 3)
+09c8 : 85 46 __ STA T3 + 3
+09ca : a5 6b __ LDA T1 + 0
+09cc : 85 1b __ STA ACCU + 0
+09ce : a5 6c __ LDA T1 + 1
+09d0 : 85 1c __ STA ACCU + 1
+09d2 : 20 22 22 JSR $2222 ; (sint16_to_float + 0)
+09d5 : a5 43 __ LDA T3 + 0
+09d7 : 85 03 __ STA $03
+09d9 : a5 44 __ LDA T3 + 1
+09db : 85 04 __ STA $04
+09dd : a5 45 __ LDA T3 + 2
+09df : 85 05 __ STA $05
+09e1 : a5 46 __ LDA T3 + 3
+09e3 : 85 06 __ STA $06
+09e5 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+09e8 : 20 dc 1f JSR $1fdc ; (fmul + 0)
+09eb : a5 1b __ LDA ACCU + 0
+09ed : 85 03 __ STA $03
+09ef : a5 1c __ LDA ACCU + 1
+09f1 : 85 04 __ STA $04
+09f3 : a5 1d __ LDA ACCU + 2
+09f5 : 85 05 __ STA $05
+09f7 : a5 1e __ LDA ACCU + 3
+09f9 : 85 06 __ STA $06
+09fb : a5 67 __ LDA T0 + 0
+09fd : 85 1b __ STA ACCU + 0
+09ff : a5 68 __ LDA T0 + 1
+0a01 : 85 1c __ STA ACCU + 1
+0a03 : a5 69 __ LDA T0 + 2
+0a05 : 85 1d __ STA ACCU + 2
+0a07 : a5 6a __ LDA T0 + 3
+0a09 : 85 1e __ STA ACCU + 3
+0a0b : 20 6d 22 JSR $226d ; (fcmp + 0)
+0a0e : d0 03 __ BNE $0a13
+0a10 : 4c 61 0c JMP $0c61 ; (main + 865)
+0a13 : a9 00 __ LDA #$00
+0a15 : a0 02 __ LDY #$02
+0a17 : 91 23 __ STA (SP + 0),y
+0a19 : 20 90 1e JSR $1e90 ; (assert + 0)
+0a1c : ad 17 23 LDA $2317 ; (c + 0)
+0a1f : 85 1b __ STA ACCU + 0
+0a21 : ad 18 23 LDA $2318 ; (c + 1)
+0a24 : 85 1c __ STA ACCU + 1
+0a26 : ad 19 23 LDA $2319 ; (c + 2)
+0a29 : 85 1d __ STA ACCU + 2
+0a2b : ad 1a 23 LDA $231a ; (c + 3)
+0a2e : 85 1e __ STA ACCU + 3
+0a30 : a5 67 __ LDA T0 + 0
+0a32 : 85 03 __ STA $03
+0a34 : a5 68 __ LDA T0 + 1
+0a36 : 85 04 __ STA $04
+0a38 : a5 69 __ LDA T0 + 2
+0a3a : 85 05 __ STA $05
+0a3c : a5 6a __ LDA T0 + 3
+0a3e : 85 06 __ STA $06
+0a40 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0a43 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+0a46 : a5 1b __ LDA ACCU + 0
+0a48 : 85 67 __ STA T0 + 0
+0a4a : a5 1c __ LDA ACCU + 1
+0a4c : 85 68 __ STA T0 + 1
+0a4e : a5 1d __ LDA ACCU + 2
+0a50 : 85 69 __ STA T0 + 2
+0a52 : a5 1e __ LDA ACCU + 3
+0a54 : 85 6a __ STA T0 + 3
+0a56 : e6 6b __ INC T1 + 0
+0a58 : d0 02 __ BNE $0a5c
+0a5a : e6 6c __ INC T1 + 1
+0a5c : a5 6b __ LDA T1 + 0
+0a5e : c9 32 __ CMP #$32
+0a60 : b0 03 __ BCS $0a65
+0a62 : 4c 1b 09 JMP $091b ; (main + 27)
+0a65 : ad 1b 23 LDA $231b ; (d + 0)
+0a68 : 85 67 __ STA T0 + 0
+0a6a : ad 1c 23 LDA $231c ; (d + 1)
+0a6d : 85 68 __ STA T0 + 1
+0a6f : ad 1d 23 LDA $231d ; (d + 2)
+0a72 : 85 69 __ STA T0 + 2
+0a74 : ad 1e 23 LDA $231e ; (d + 3)
+0a77 : 85 6a __ STA T0 + 3
+0a79 : a9 01 __ LDA #$01
+0a7b : 85 6b __ STA T1 + 0
+0a7d : a9 00 __ LDA #$00
+0a7f : 85 6c __ STA T1 + 1
+0a81 : a9 b5 __ LDA #$b5
+0a83 : a0 02 __ LDY #$02
+0a85 : 91 23 __ STA (SP + 0),y
+0a87 : a9 1e __ LDA #$1e
+0a89 : c8 __ __ INY
+0a8a : 91 23 __ STA (SP + 0),y
+0a8c : a5 6b __ LDA T1 + 0
+0a8e : 85 1b __ STA ACCU + 0
+0a90 : c8 __ __ INY
+0a91 : 91 23 __ STA (SP + 0),y
+0a93 : a5 6c __ LDA T1 + 1
+0a95 : 85 1c __ STA ACCU + 1
+0a97 : c8 __ __ INY
+0a98 : 91 23 __ STA (SP + 0),y
+0a9a : ad 1b 23 LDA $231b ; (d + 0)
+0a9d : 85 43 __ STA T3 + 0
+0a9f : ad 1c 23 LDA $231c ; (d + 1)
+0aa2 : 85 44 __ STA T3 + 1
+0aa4 : ad 1d 23 LDA $231d ; (d + 2)
+0aa7 : 85 45 __ STA T3 + 2
+0aa9 : ad 1e 23 LDA $231e ; (d + 3)
+0aac : 85 46 __ STA T3 + 3
+0aae : 20 22 22 JSR $2222 ; (sint16_to_float + 0)
+0ab1 : a5 1b __ LDA ACCU + 0
+0ab3 : 85 47 __ STA T4 + 0
+0ab5 : a5 1c __ LDA ACCU + 1
+0ab7 : 85 48 __ STA T4 + 1
+0ab9 : a5 1d __ LDA ACCU + 2
+0abb : 85 49 __ STA T4 + 2
+0abd : a5 1e __ LDA ACCU + 3
+0abf : 85 4a __ STA T4 + 3
+0ac1 : a5 43 __ LDA T3 + 0
+0ac3 : 85 03 __ STA $03
+0ac5 : a5 44 __ LDA T3 + 1
+0ac7 : 85 04 __ STA $04
+0ac9 : a5 45 __ LDA T3 + 2
+0acb : 85 05 __ STA $05
+0acd : a5 46 __ LDA T3 + 3
+0acf : 85 06 __ STA $06
+0ad1 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0ad4 : 20 dc 1f JSR $1fdc ; (fmul + 0)
+0ad7 : a5 1b __ LDA ACCU + 0
+0ad9 : a0 06 __ LDY #$06
+0adb : 91 23 __ STA (SP + 0),y
+0add : a5 1c __ LDA ACCU + 1
+0adf : c8 __ __ INY
+0ae0 : 91 23 __ STA (SP + 0),y
+0ae2 : a5 1d __ LDA ACCU + 2
+0ae4 : c8 __ __ INY
+0ae5 : 91 23 __ STA (SP + 0),y
+0ae7 : a5 1e __ LDA ACCU + 3
+0ae9 : c8 __ __ INY
+0aea : 91 23 __ STA (SP + 0),y
+0aec : a5 67 __ LDA T0 + 0
+0aee : 85 03 __ STA $03
+0af0 : c8 __ __ INY
+0af1 : 91 23 __ STA (SP + 0),y
+0af3 : a5 68 __ LDA T0 + 1
+0af5 : 85 04 __ STA $04
+0af7 : c8 __ __ INY
+0af8 : 91 23 __ STA (SP + 0),y
+0afa : a5 69 __ LDA T0 + 2
+0afc : 85 05 __ STA $05
+0afe : c8 __ __ INY
+0aff : 91 23 __ STA (SP + 0),y
+0b01 : a5 6a __ LDA T0 + 3
+0b03 : 85 06 __ STA $06
+0b05 : c8 __ __ INY
+0b06 : 91 23 __ STA (SP + 0),y
+0b08 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0b0b : a5 06 __ LDA $06
+0b0d : 49 80 __ EOR #$80
+0b0f : 85 06 __ STA $06
+0b11 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+0b14 : a5 1e __ LDA ACCU + 3
+0b16 : 29 7f __ AND #$7f
+0b18 : 85 1e __ STA ACCU + 3
+0b1a : a5 47 __ LDA T4 + 0
+0b1c : 85 03 __ STA $03
+0b1e : a5 48 __ LDA T4 + 1
+0b20 : 85 04 __ STA $04
+0b22 : a5 49 __ LDA T4 + 2
+0b24 : 85 05 __ STA $05
+0b26 : a5 4a __ LDA T4 + 3
+0b28 : 85 06 __ STA $06
+0b2a : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0b2d : 20 7a 20 JSR $207a ; (fdiv + 0)
+0b30 : a5 1b __ LDA ACCU + 0
+0b32 : a0 0e __ LDY #$0e
+0b34 : 91 23 __ STA (SP + 0),y
+0b36 : a5 1c __ LDA ACCU + 1
+0b38 : c8 __ __ INY
+0b39 : 91 23 __ STA (SP + 0),y
+0b3b : a5 1d __ LDA ACCU + 2
+0b3d : c8 __ __ INY
+0b3e : 91 23 __ STA (SP + 0),y
+0b40 : a5 1e __ LDA ACCU + 3
+0b42 : c8 __ __ INY
+0b43 : 91 23 __ STA (SP + 0),y
+0b45 : 20 66 0c JSR $0c66 ; (printf + 0)
+0b48 : ad 1b 23 LDA $231b ; (d + 0)
+0b4b : 85 43 __ STA T3 + 0
+0b4d : ad 1c 23 LDA $231c ; (d + 1)
+0b50 : 85 44 __ STA T3 + 1
+0b52 : ad 1d 23 LDA $231d ; (d + 2)
+0b55 : 85 45 __ STA T3 + 2
+0b57 : ad 1e 23 LDA $231e ; (d + 3)
+0b5a : 85 46 __ STA T3 + 3
+0b5c : a5 6b __ LDA T1 + 0
+0b5e : 85 1b __ STA ACCU + 0
+0b60 : a5 6c __ LDA T1 + 1
+0b62 : 85 1c __ STA ACCU + 1
+0b64 : 20 22 22 JSR $2222 ; (sint16_to_float + 0)
+0b67 : a5 1b __ LDA ACCU + 0
+0b69 : 85 47 __ STA T4 + 0
+0b6b : a5 1c __ LDA ACCU + 1
+0b6d : 85 48 __ STA T4 + 1
+0b6f : a5 1d __ LDA ACCU + 2
+0b71 : 85 49 __ STA T4 + 2
+0b73 : a5 1e __ LDA ACCU + 3
+0b75 : 85 4a __ STA T4 + 3
+0b77 : a5 43 __ LDA T3 + 0
+0b79 : 85 03 __ STA $03
+0b7b : a5 44 __ LDA T3 + 1
+0b7d : 85 04 __ STA $04
+0b7f : a5 45 __ LDA T3 + 2
+0b81 : 85 05 __ STA $05
+0b83 : a5 46 __ LDA T3 + 3
+0b85 : 85 06 __ STA $06
+0b87 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0b8a : 20 dc 1f JSR $1fdc ; (fmul + 0)
+0b8d : a5 67 __ LDA T0 + 0
+0b8f : 85 03 __ STA $03
+0b91 : a5 68 __ LDA T0 + 1
+0b93 : 85 04 __ STA $04
+0b95 : a5 69 __ LDA T0 + 2
+0b97 : 85 05 __ STA $05
+0b99 : a5 6a __ LDA T0 + 3
+0b9b : 85 06 __ STA $06
+0b9d : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0ba0 : a5 06 __ LDA $06
+0ba2 : 49 80 __ EOR #$80
+0ba4 : 85 06 __ STA $06
+0ba6 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+0ba9 : a5 1b __ LDA ACCU + 0
+0bab : 85 43 __ STA T3 + 0
+0bad : a5 1c __ LDA ACCU + 1
+0baf : 85 44 __ STA T3 + 1
+0bb1 : a5 1d __ LDA ACCU + 2
+0bb3 : 85 45 __ STA T3 + 2
+0bb5 : a5 1e __ LDA ACCU + 3
+0bb7 : 29 7f __ AND #$7f
+0bb9 : 85 46 __ STA T3 + 3
+0bbb : a5 47 __ LDA T4 + 0
+0bbd : 85 1b __ STA ACCU + 0
+0bbf : a5 48 __ LDA T4 + 1
+0bc1 : 85 1c __ STA ACCU + 1
+0bc3 : a5 49 __ LDA T4 + 2
+0bc5 : 85 1d __ STA ACCU + 2
+0bc7 : a5 4a __ LDA T4 + 3
+0bc9 : 85 1e __ STA ACCU + 3
+0bcb : a9 bd __ LDA #$bd
+0bcd : 85 03 __ STA $03
+0bcf : a9 37 __ LDA #$37
+0bd1 : 85 04 __ STA $04
+0bd3 : a9 86 __ LDA #$86
+0bd5 : 85 05 __ STA $05
+0bd7 : a9 35 __ LDA #$35
+0bd9 : 85 06 __ STA $06
+0bdb : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0bde : 20 dc 1f JSR $1fdc ; (fmul + 0)
+0be1 : a5 43 __ LDA T3 + 0
+0be3 : 85 03 __ STA $03
+0be5 : a5 44 __ LDA T3 + 1
+0be7 : 85 04 __ STA $04
+0be9 : a5 45 __ LDA T3 + 2
+0beb : 85 05 __ STA $05
+0bed : a5 46 __ LDA T3 + 3
+0bef : 85 06 __ STA $06
+0bf1 : 20 6d 22 JSR $226d ; (fcmp + 0)
+0bf4 : 30 66 __ BMI $0c5c
+0bf6 : a9 00 __ LDA #$00
+0bf8 : a0 02 __ LDY #$02
+0bfa : 91 23 __ STA (SP + 0),y
+0bfc : 20 90 1e JSR $1e90 ; (assert + 0)
+0bff : ad 1b 23 LDA $231b ; (d + 0)
+0c02 : 85 1b __ STA ACCU + 0
+0c04 : ad 1c 23 LDA $231c ; (d + 1)
+0c07 : 85 1c __ STA ACCU + 1
+0c09 : ad 1d 23 LDA $231d ; (d + 2)
+0c0c : 85 1d __ STA ACCU + 2
+0c0e : ad 1e 23 LDA $231e ; (d + 3)
+0c11 : 85 1e __ STA ACCU + 3
+0c13 : a5 67 __ LDA T0 + 0
+0c15 : 85 03 __ STA $03
+0c17 : a5 68 __ LDA T0 + 1
+0c19 : 85 04 __ STA $04
+0c1b : a5 69 __ LDA T0 + 2
+0c1d : 85 05 __ STA $05
+0c1f : a5 6a __ LDA T0 + 3
+0c21 : 85 06 __ STA $06
+0c23 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+0c26 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+0c29 : a5 1b __ LDA ACCU + 0
+0c2b : 85 67 __ STA T0 + 0
+0c2d : a5 1c __ LDA ACCU + 1
+0c2f : 85 68 __ STA T0 + 1
+0c31 : a5 1d __ LDA ACCU + 2
+0c33 : 85 69 __ STA T0 + 2
+0c35 : a5 1e __ LDA ACCU + 3
+0c37 : 85 6a __ STA T0 + 3
+0c39 : e6 6b __ INC T1 + 0
+0c3b : d0 02 __ BNE $0c3f
+0c3d : e6 6c __ INC T1 + 1
+0c3f : a5 6b __ LDA T1 + 0
+0c41 : c9 32 __ CMP #$32
+0c43 : b0 03 __ BCS $0c48
+0c45 : 4c 81 0a JMP $0a81 ; (main + 385)
+0c48 : a9 00 __ LDA #$00
+0c4a : 85 1b __ STA ACCU + 0
+0c4c : 85 1c __ STA ACCU + 1
+0c4e : 18 __ __ CLC
+0c4f : a5 23 __ LDA SP + 0
+0c51 : 69 12 __ ADC #$12
+0c53 : 85 23 __ STA SP + 0
+0c55 : a5 24 __ LDA SP + 1
+0c57 : 69 00 __ ADC #$00
+0c59 : 85 24 __ STA SP + 1
+0c5b : 60 __ __ RTS
+0c5c : a9 01 __ LDA #$01
+0c5e : 4c f8 0b JMP $0bf8 ; (main + 760)
+0c61 : a9 01 __ LDA #$01
+0c63 : 4c 15 0a JMP $0a15 ; (main + 277)
+--------------------------------------------------------------------
+printf:
+0c66 : 38 __ __ SEC
+0c67 : a5 23 __ LDA SP + 0
+0c69 : e9 09 __ SBC #$09
+0c6b : 85 23 __ STA SP + 0
+0c6d : a5 24 __ LDA SP + 1
+0c6f : e9 00 __ SBC #$00
+0c71 : 85 24 __ STA SP + 1
+0c73 : a9 1f __ LDA #$1f
+0c75 : a0 02 __ LDY #$02
+0c77 : 91 23 __ STA (SP + 0),y
+0c79 : a9 23 __ LDA #$23
+0c7b : c8 __ __ INY
+0c7c : 91 23 __ STA (SP + 0),y
+0c7e : a0 0b __ LDY #$0b
+0c80 : b1 23 __ LDA (SP + 0),y
+0c82 : a0 04 __ LDY #$04
+0c84 : 91 23 __ STA (SP + 0),y
+0c86 : a0 0c __ LDY #$0c
+0c88 : b1 23 __ LDA (SP + 0),y
+0c8a : a0 05 __ LDY #$05
+0c8c : 91 23 __ STA (SP + 0),y
+0c8e : 18 __ __ CLC
+0c8f : a5 23 __ LDA SP + 0
+0c91 : 69 0d __ ADC #$0d
+0c93 : c8 __ __ INY
+0c94 : 91 23 __ STA (SP + 0),y
+0c96 : a5 24 __ LDA SP + 1
+0c98 : 69 00 __ ADC #$00
+0c9a : c8 __ __ INY
+0c9b : 91 23 __ STA (SP + 0),y
+0c9d : a9 01 __ LDA #$01
+0c9f : c8 __ __ INY
+0ca0 : 91 23 __ STA (SP + 0),y
+0ca2 : 20 b3 0c JSR $0cb3 ; (sformat + 0)
+0ca5 : 18 __ __ CLC
+0ca6 : a5 23 __ LDA SP + 0
+0ca8 : 69 09 __ ADC #$09
+0caa : 85 23 __ STA SP + 0
+0cac : a5 24 __ LDA SP + 1
+0cae : 69 00 __ ADC #$00
+0cb0 : 85 24 __ STA SP + 1
+0cb2 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0cb3 : a0 02 __ LDY #$02
+0cb5 : b1 23 __ LDA (SP + 0),y
+0cb7 : 85 5d __ STA T0 + 0
+0cb9 : c8 __ __ INY
+0cba : b1 23 __ LDA (SP + 0),y
+0cbc : 85 5e __ STA T0 + 1
+0cbe : a9 00 __ LDA #$00
+0cc0 : 85 5f __ STA T1 + 0
+0cc2 : c8 __ __ INY
+0cc3 : b1 23 __ LDA (SP + 0),y
+0cc5 : 85 61 __ STA T2 + 0
+0cc7 : c8 __ __ INY
+0cc8 : b1 23 __ LDA (SP + 0),y
+0cca : 85 62 __ STA T2 + 1
+0ccc : a0 00 __ LDY #$00
+0cce : b1 61 __ LDA (T2 + 0),y
+0cd0 : 85 43 __ STA T3 + 0
+0cd2 : d0 42 __ BNE $0d16
+0cd4 : 18 __ __ CLC
+0cd5 : a5 5d __ LDA T0 + 0
+0cd7 : 65 5f __ ADC T1 + 0
+0cd9 : 85 61 __ STA T2 + 0
+0cdb : a5 5e __ LDA T0 + 1
+0cdd : 69 00 __ ADC #$00
+0cdf : 85 62 __ STA T2 + 1
+0ce1 : a9 00 __ LDA #$00
+0ce3 : a4 5f __ LDY T1 + 0
+0ce5 : 91 5d __ STA (T0 + 0),y
+0ce7 : 98 __ __ TYA
+0ce8 : d0 09 __ BNE $0cf3
+0cea : a5 5d __ LDA T0 + 0
+0cec : 85 1b __ STA ACCU + 0
+0cee : a5 5e __ LDA T0 + 1
+0cf0 : 85 1c __ STA ACCU + 1
+0cf2 : 60 __ __ RTS
+0cf3 : a0 08 __ LDY #$08
+0cf5 : b1 23 __ LDA (SP + 0),y
+0cf7 : d0 09 __ BNE $0d02
+0cf9 : a5 61 __ LDA T2 + 0
+0cfb : 85 1b __ STA ACCU + 0
+0cfd : a5 62 __ LDA T2 + 1
+0cff : 4c f0 0c JMP $0cf0 ; (sformat + 61)
+0d02 : a5 5d __ LDA T0 + 0
+0d04 : 85 0d __ STA P0
+0d06 : a5 5e __ LDA T0 + 1
+0d08 : 85 0e __ STA P1
+0d0a : 20 fc 15 JSR $15fc ; (puts + 0)
+0d0d : a5 5d __ LDA T0 + 0
+0d0f : 85 1b __ STA ACCU + 0
+0d11 : a5 5e __ LDA T0 + 1
+0d13 : 4c f0 0c JMP $0cf0 ; (sformat + 61)
+0d16 : e6 61 __ INC T2 + 0
+0d18 : d0 02 __ BNE $0d1c
+0d1a : e6 62 __ INC T2 + 1
+0d1c : a5 43 __ LDA T3 + 0
+0d1e : c9 25 __ CMP #$25
+0d20 : f0 72 __ BEQ $0d94
+0d22 : a4 5f __ LDY T1 + 0
+0d24 : 91 5d __ STA (T0 + 0),y
+0d26 : e6 5f __ INC T1 + 0
+0d28 : a5 5f __ LDA T1 + 0
+0d2a : c9 28 __ CMP #$28
+0d2c : 90 57 __ BCC $0d85
+0d2e : a0 08 __ LDY #$08
+0d30 : b1 23 __ LDA (SP + 0),y
+0d32 : d0 24 __ BNE $0d58
+0d34 : 18 __ __ CLC
+0d35 : a5 5d __ LDA T0 + 0
+0d37 : 65 5f __ ADC T1 + 0
+0d39 : 85 5d __ STA T0 + 0
+0d3b : 90 02 __ BCC $0d3f
+0d3d : e6 5e __ INC T0 + 1
+0d3f : a9 00 __ LDA #$00
+0d41 : 85 5f __ STA T1 + 0
+0d43 : a0 00 __ LDY #$00
+0d45 : b1 61 __ LDA (T2 + 0),y
+0d47 : 85 45 __ STA T4 + 0
+0d49 : e6 61 __ INC T2 + 0
+0d4b : d0 02 __ BNE $0d4f
+0d4d : e6 62 __ INC T2 + 1
+0d4f : a5 45 __ LDA T4 + 0
+0d51 : 85 43 __ STA T3 + 0
+0d53 : d0 c7 __ BNE $0d1c
+0d55 : 4c d4 0c JMP $0cd4 ; (sformat + 33)
+0d58 : 18 __ __ CLC
+0d59 : a5 5d __ LDA T0 + 0
+0d5b : 85 0d __ STA P0
+0d5d : 65 5f __ ADC T1 + 0
+0d5f : 85 47 __ STA T5 + 0
+0d61 : a5 5e __ LDA T0 + 1
+0d63 : 85 0e __ STA P1
+0d65 : 69 00 __ ADC #$00
+0d67 : 85 48 __ STA T5 + 1
+0d69 : a9 00 __ LDA #$00
+0d6b : a0 00 __ LDY #$00
+0d6d : 91 47 __ STA (T5 + 0),y
+0d6f : 20 fc 15 JSR $15fc ; (puts + 0)
+0d72 : a9 00 __ LDA #$00
+0d74 : 85 5f __ STA T1 + 0
+0d76 : a0 00 __ LDY #$00
+0d78 : b1 61 __ LDA (T2 + 0),y
+0d7a : 85 45 __ STA T4 + 0
+0d7c : e6 61 __ INC T2 + 0
+0d7e : d0 02 __ BNE $0d82
+0d80 : e6 62 __ INC T2 + 1
+0d82 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0d85 : a0 00 __ LDY #$00
+0d87 : b1 61 __ LDA (T2 + 0),y
+0d89 : 85 45 __ STA T4 + 0
+0d8b : e6 61 __ INC T2 + 0
+0d8d : d0 02 __ BNE $0d91
+0d8f : e6 62 __ INC T2 + 1
+0d91 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0d94 : a5 5f __ LDA T1 + 0
+0d96 : f0 03 __ BEQ $0d9b
+0d98 : 4c c3 15 JMP $15c3 ; (sformat + 2320)
+0d9b : a0 00 __ LDY #$00
+0d9d : b1 61 __ LDA (T2 + 0),y
+0d9f : 85 43 __ STA T3 + 0
+0da1 : a9 0a __ LDA #$0a
+0da3 : 8d 54 23 STA $2354 ; (sframe + 53)
+0da6 : a9 00 __ LDA #$00
+0da8 : 8d 55 23 STA $2355 ; (sframe + 54)
+0dab : a9 01 __ LDA #$01
+0dad : 8d 52 23 STA $2352 ; (sframe + 51)
+0db0 : a9 ff __ LDA #$ff
+0db2 : 8d 53 23 STA $2353 ; (sframe + 52)
+0db5 : a9 20 __ LDA #$20
+0db7 : 8d 51 23 STA $2351 ; (sframe + 50)
+0dba : a9 00 __ LDA #$00
+0dbc : 8d 56 23 STA $2356 ; (sframe + 55)
+0dbf : 8d 57 23 STA $2357 ; (sframe + 56)
+0dc2 : 8d 58 23 STA $2358 ; (sframe + 57)
+0dc5 : e6 61 __ INC T2 + 0
+0dc7 : d0 02 __ BNE $0dcb
+0dc9 : e6 62 __ INC T2 + 1
+0dcb : a5 43 __ LDA T3 + 0
+0dcd : c9 2b __ CMP #$2b
+0dcf : d0 03 __ BNE $0dd4
+0dd1 : 4c b5 15 JMP $15b5 ; (sformat + 2306)
+0dd4 : c9 30 __ CMP #$30
+0dd6 : d0 03 __ BNE $0ddb
+0dd8 : 4c a7 15 JMP $15a7 ; (sformat + 2292)
+0ddb : c9 23 __ CMP #$23
+0ddd : d0 03 __ BNE $0de2
+0ddf : 4c 99 15 JMP $1599 ; (sformat + 2278)
+0de2 : c9 30 __ CMP #$30
+0de4 : 90 64 __ BCC $0e4a
+0de6 : a9 39 __ LDA #$39
+0de8 : c5 43 __ CMP T3 + 0
+0dea : 90 5e __ BCC $0e4a
+0dec : a9 00 __ LDA #$00
+0dee : 85 47 __ STA T5 + 0
+0df0 : 85 48 __ STA T5 + 1
+0df2 : a5 43 __ LDA T3 + 0
+0df4 : c9 30 __ CMP #$30
+0df6 : 90 4d __ BCC $0e45
+0df8 : a9 39 __ LDA #$39
+0dfa : c5 43 __ CMP T3 + 0
+0dfc : 90 47 __ BCC $0e45
+0dfe : a5 43 __ LDA T3 + 0
+0e00 : 85 49 __ STA T6 + 0
+0e02 : a0 00 __ LDY #$00
+0e04 : b1 61 __ LDA (T2 + 0),y
+0e06 : 85 43 __ STA T3 + 0
+0e08 : e6 61 __ INC T2 + 0
+0e0a : d0 02 __ BNE $0e0e
+0e0c : e6 62 __ INC T2 + 1
+0e0e : a5 47 __ LDA T5 + 0
+0e10 : 0a __ __ ASL
+0e11 : 85 07 __ STA $07
+0e13 : a5 48 __ LDA T5 + 1
+0e15 : 2a __ __ ROL
+0e16 : 06 07 __ ASL $07
+0e18 : 2a __ __ ROL
+0e19 : aa __ __ TAX
+0e1a : 18 __ __ CLC
+0e1b : a5 07 __ LDA $07
+0e1d : 65 47 __ ADC T5 + 0
+0e1f : 85 1b __ STA ACCU + 0
+0e21 : 8a __ __ TXA
+0e22 : 65 48 __ ADC T5 + 1
+0e24 : 06 1b __ ASL ACCU + 0
+0e26 : 2a __ __ ROL
+0e27 : 85 1c __ STA ACCU + 1
+0e29 : 18 __ __ CLC
+0e2a : a5 1b __ LDA ACCU + 0
+0e2c : 65 49 __ ADC T6 + 0
+0e2e : aa __ __ TAX
+0e2f : a5 1c __ LDA ACCU + 1
+0e31 : 69 00 __ ADC #$00
+0e33 : a8 __ __ TAY
+0e34 : 38 __ __ SEC
+0e35 : 8a __ __ TXA
+0e36 : e9 30 __ SBC #$30
+0e38 : 85 47 __ STA T5 + 0
+0e3a : 98 __ __ TYA
+0e3b : e9 00 __ SBC #$00
+0e3d : 85 48 __ STA T5 + 1
+0e3f : a5 43 __ LDA T3 + 0
+0e41 : c9 30 __ CMP #$30
+0e43 : b0 b3 __ BCS $0df8
+0e45 : a5 47 __ LDA T5 + 0
+0e47 : 8d 52 23 STA $2352 ; (sframe + 51)
+0e4a : a5 43 __ LDA T3 + 0
+0e4c : c9 2e __ CMP #$2e
+0e4e : d0 03 __ BNE $0e53
+0e50 : 4c 2c 15 JMP $152c ; (sformat + 2169)
+0e53 : a5 43 __ LDA T3 + 0
+0e55 : c9 64 __ CMP #$64
+0e57 : d0 03 __ BNE $0e5c
+0e59 : 4c 96 13 JMP $1396 ; (sformat + 1763)
+0e5c : c9 75 __ CMP #$75
+0e5e : d0 03 __ BNE $0e63
+0e60 : 4c 45 12 JMP $1245 ; (sformat + 1426)
+0e63 : c9 78 __ CMP #$78
+0e65 : d0 03 __ BNE $0e6a
+0e67 : 4c dd 10 JMP $10dd ; (sformat + 1066)
+0e6a : c9 6c __ CMP #$6c
+0e6c : d0 03 __ BNE $0e71
+0e6e : 4c d0 0f JMP $0fd0 ; (sformat + 797)
+0e71 : c9 66 __ CMP #$66
+0e73 : d0 03 __ BNE $0e78
+0e75 : 4c 5f 0f JMP $0f5f ; (sformat + 684)
+0e78 : c9 67 __ CMP #$67
+0e7a : d0 03 __ BNE $0e7f
+0e7c : 4c 5f 0f JMP $0f5f ; (sformat + 684)
+0e7f : c9 65 __ CMP #$65
+0e81 : d0 03 __ BNE $0e86
+0e83 : 4c 5f 0f JMP $0f5f ; (sformat + 684)
+0e86 : c9 73 __ CMP #$73
+0e88 : f0 57 __ BEQ $0ee1
+0e8a : c9 63 __ CMP #$63
+0e8c : f0 1e __ BEQ $0eac
+0e8e : 09 00 __ ORA #$00
+0e90 : d0 03 __ BNE $0e95
+0e92 : 4c 85 0d JMP $0d85 ; (sformat + 210)
+0e95 : a5 43 __ LDA T3 + 0
+0e97 : a4 5f __ LDY T1 + 0
+0e99 : 91 5d __ STA (T0 + 0),y
+0e9b : e6 5f __ INC T1 + 0
+0e9d : a0 00 __ LDY #$00
+0e9f : b1 61 __ LDA (T2 + 0),y
+0ea1 : 85 45 __ STA T4 + 0
+0ea3 : e6 61 __ INC T2 + 0
+0ea5 : d0 02 __ BNE $0ea9
+0ea7 : e6 62 __ INC T2 + 1
+0ea9 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0eac : a0 06 __ LDY #$06
+0eae : b1 23 __ LDA (SP + 0),y
+0eb0 : 85 47 __ STA T5 + 0
+0eb2 : 18 __ __ CLC
+0eb3 : 69 02 __ ADC #$02
+0eb5 : aa __ __ TAX
+0eb6 : c8 __ __ INY
+0eb7 : b1 23 __ LDA (SP + 0),y
+0eb9 : 85 48 __ STA T5 + 1
+0ebb : 69 00 __ ADC #$00
+0ebd : 85 4a __ STA T6 + 1
+0ebf : 8a __ __ TXA
+0ec0 : 88 __ __ DEY
+0ec1 : 91 23 __ STA (SP + 0),y
+0ec3 : a5 4a __ LDA T6 + 1
+0ec5 : c8 __ __ INY
+0ec6 : 91 23 __ STA (SP + 0),y
+0ec8 : a0 00 __ LDY #$00
+0eca : b1 47 __ LDA (T5 + 0),y
+0ecc : a4 5f __ LDY T1 + 0
+0ece : 91 5d __ STA (T0 + 0),y
+0ed0 : e6 5f __ INC T1 + 0
+0ed2 : a0 00 __ LDY #$00
+0ed4 : b1 61 __ LDA (T2 + 0),y
+0ed6 : 85 45 __ STA T4 + 0
+0ed8 : e6 61 __ INC T2 + 0
+0eda : d0 02 __ BNE $0ede
+0edc : e6 62 __ INC T2 + 1
+0ede : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0ee1 : a0 06 __ LDY #$06
+0ee3 : b1 23 __ LDA (SP + 0),y
+0ee5 : 85 47 __ STA T5 + 0
+0ee7 : 18 __ __ CLC
+0ee8 : 69 02 __ ADC #$02
+0eea : aa __ __ TAX
+0eeb : c8 __ __ INY
+0eec : b1 23 __ LDA (SP + 0),y
+0eee : 85 48 __ STA T5 + 1
+0ef0 : 69 00 __ ADC #$00
+0ef2 : 85 4a __ STA T6 + 1
+0ef4 : 8a __ __ TXA
+0ef5 : 88 __ __ DEY
+0ef6 : 91 23 __ STA (SP + 0),y
+0ef8 : a5 4a __ LDA T6 + 1
+0efa : c8 __ __ INY
+0efb : 91 23 __ STA (SP + 0),y
+0efd : a0 00 __ LDY #$00
+0eff : b1 47 __ LDA (T5 + 0),y
+0f01 : 85 02 __ STA $02
+0f03 : c8 __ __ INY
+0f04 : b1 47 __ LDA (T5 + 0),y
+0f06 : 85 48 __ STA T5 + 1
+0f08 : a5 02 __ LDA $02
+0f0a : 85 47 __ STA T5 + 0
+0f0c : a0 08 __ LDY #$08
+0f0e : b1 23 __ LDA (SP + 0),y
+0f10 : d0 33 __ BNE $0f45
+0f12 : a0 00 __ LDY #$00
+0f14 : b1 47 __ LDA (T5 + 0),y
+0f16 : 85 43 __ STA T3 + 0
+0f18 : d0 03 __ BNE $0f1d
+0f1a : 4c 85 0d JMP $0d85 ; (sformat + 210)
+0f1d : 18 __ __ CLC
+0f1e : a5 02 __ LDA $02
+0f20 : 69 01 __ ADC #$01
+0f22 : 85 47 __ STA T5 + 0
+0f24 : 90 02 __ BCC $0f28
+0f26 : e6 48 __ INC T5 + 1
+0f28 : a5 43 __ LDA T3 + 0
+0f2a : a0 00 __ LDY #$00
+0f2c : 91 5d __ STA (T0 + 0),y
+0f2e : e6 5d __ INC T0 + 0
+0f30 : d0 02 __ BNE $0f34
+0f32 : e6 5e __ INC T0 + 1
+0f34 : b1 47 __ LDA (T5 + 0),y
+0f36 : aa __ __ TAX
+0f37 : e6 47 __ INC T5 + 0
+0f39 : d0 02 __ BNE $0f3d
+0f3b : e6 48 __ INC T5 + 1
+0f3d : 8a __ __ TXA
+0f3e : 86 43 __ STX T3 + 0
+0f40 : d0 e6 __ BNE $0f28
+0f42 : 4c 85 0d JMP $0d85 ; (sformat + 210)
+0f45 : a5 02 __ LDA $02
+0f47 : 85 0d __ STA P0
+0f49 : a5 48 __ LDA T5 + 1
+0f4b : 85 0e __ STA P1
+0f4d : 20 fc 15 JSR $15fc ; (puts + 0)
+0f50 : a0 00 __ LDY #$00
+0f52 : b1 61 __ LDA (T2 + 0),y
+0f54 : 85 45 __ STA T4 + 0
+0f56 : e6 61 __ INC T2 + 0
+0f58 : d0 02 __ BNE $0f5c
+0f5a : e6 62 __ INC T2 + 1
+0f5c : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0f5f : a9 51 __ LDA #$51
+0f61 : 85 0d __ STA P0
+0f63 : a9 23 __ LDA #$23
+0f65 : 85 0e __ STA P1
+0f67 : a5 5d __ LDA T0 + 0
+0f69 : 85 0f __ STA P2
+0f6b : a5 5e __ LDA T0 + 1
+0f6d : 85 10 __ STA P3
+0f6f : a0 06 __ LDY #$06
+0f71 : b1 23 __ LDA (SP + 0),y
+0f73 : 85 47 __ STA T5 + 0
+0f75 : c8 __ __ INY
+0f76 : b1 23 __ LDA (SP + 0),y
+0f78 : 85 48 __ STA T5 + 1
+0f7a : a0 00 __ LDY #$00
+0f7c : b1 47 __ LDA (T5 + 0),y
+0f7e : 85 11 __ STA P4
+0f80 : c8 __ __ INY
+0f81 : b1 47 __ LDA (T5 + 0),y
+0f83 : 85 12 __ STA P5
+0f85 : c8 __ __ INY
+0f86 : b1 47 __ LDA (T5 + 0),y
+0f88 : 85 13 __ STA P6
+0f8a : c8 __ __ INY
+0f8b : b1 47 __ LDA (T5 + 0),y
+0f8d : 85 14 __ STA P7
+0f8f : 20 36 18 JSR $1836 ; (nformf + 0)
+0f92 : a5 1b __ LDA ACCU + 0
+0f94 : 85 5f __ STA T1 + 0
+0f96 : a0 06 __ LDY #$06
+0f98 : b1 23 __ LDA (SP + 0),y
+0f9a : 85 47 __ STA T5 + 0
+0f9c : 18 __ __ CLC
+0f9d : 69 02 __ ADC #$02
+0f9f : aa __ __ TAX
+0fa0 : c8 __ __ INY
+0fa1 : b1 23 __ LDA (SP + 0),y
+0fa3 : 85 48 __ STA T5 + 1
+0fa5 : 69 00 __ ADC #$00
+0fa7 : 85 4a __ STA T6 + 1
+0fa9 : 8a __ __ TXA
+0faa : 88 __ __ DEY
+0fab : 91 23 __ STA (SP + 0),y
+0fad : a5 4a __ LDA T6 + 1
+0faf : c8 __ __ INY
+0fb0 : 91 23 __ STA (SP + 0),y
+0fb2 : 18 __ __ CLC
+0fb3 : a5 47 __ LDA T5 + 0
+0fb5 : 69 04 __ ADC #$04
+0fb7 : 88 __ __ DEY
+0fb8 : 91 23 __ STA (SP + 0),y
+0fba : a5 48 __ LDA T5 + 1
+0fbc : 69 00 __ ADC #$00
+0fbe : c8 __ __ INY
+0fbf : 91 23 __ STA (SP + 0),y
+0fc1 : a0 00 __ LDY #$00
+0fc3 : b1 61 __ LDA (T2 + 0),y
+0fc5 : 85 45 __ STA T4 + 0
+0fc7 : e6 61 __ INC T2 + 0
+0fc9 : d0 02 __ BNE $0fcd
+0fcb : e6 62 __ INC T2 + 1
+0fcd : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+0fd0 : a0 06 __ LDY #$06
+0fd2 : b1 23 __ LDA (SP + 0),y
+0fd4 : 85 47 __ STA T5 + 0
+0fd6 : 18 __ __ CLC
+0fd7 : 69 02 __ ADC #$02
+0fd9 : aa __ __ TAX
+0fda : c8 __ __ INY
+0fdb : b1 23 __ LDA (SP + 0),y
+0fdd : 85 48 __ STA T5 + 1
+0fdf : a0 00 __ LDY #$00
+0fe1 : b1 47 __ LDA (T5 + 0),y
+0fe3 : 85 63 __ STA T10 + 0
+0fe5 : c8 __ __ INY
+0fe6 : b1 47 __ LDA (T5 + 0),y
+0fe8 : 85 64 __ STA T10 + 1
+0fea : c8 __ __ INY
+0feb : b1 47 __ LDA (T5 + 0),y
+0fed : 85 65 __ STA T10 + 2
+0fef : c8 __ __ INY
+0ff0 : b1 47 __ LDA (T5 + 0),y
+0ff2 : 85 66 __ STA T10 + 3
+0ff4 : a5 48 __ LDA T5 + 1
+0ff6 : 69 00 __ ADC #$00
+0ff8 : 85 4a __ STA T6 + 1
+0ffa : 8a __ __ TXA
+0ffb : a0 06 __ LDY #$06
+0ffd : 91 23 __ STA (SP + 0),y
+0fff : a5 4a __ LDA T6 + 1
+1001 : c8 __ __ INY
+1002 : 91 23 __ STA (SP + 0),y
+1004 : 18 __ __ CLC
+1005 : a5 47 __ LDA T5 + 0
+1007 : 69 04 __ ADC #$04
+1009 : 88 __ __ DEY
+100a : 91 23 __ STA (SP + 0),y
+100c : a5 48 __ LDA T5 + 1
+100e : 69 00 __ ADC #$00
+1010 : c8 __ __ INY
+1011 : 91 23 __ STA (SP + 0),y
+1013 : a0 00 __ LDY #$00
+1015 : b1 61 __ LDA (T2 + 0),y
+1017 : aa __ __ TAX
+1018 : e6 61 __ INC T2 + 0
+101a : d0 02 __ BNE $101e
+101c : e6 62 __ INC T2 + 1
+101e : 8a __ __ TXA
+101f : e0 64 __ CPX #$64
+1021 : d0 03 __ BNE $1026
+1023 : 4c a7 10 JMP $10a7 ; (sformat + 1012)
+1026 : c9 75 __ CMP #$75
+1028 : f0 47 __ BEQ $1071
+102a : c9 78 __ CMP #$78
+102c : f0 03 __ BEQ $1031
+102e : 4c 85 0d JMP $0d85 ; (sformat + 210)
+1031 : a9 10 __ LDA #$10
+1033 : 8d 54 23 STA $2354 ; (sframe + 53)
+1036 : a9 00 __ LDA #$00
+1038 : 8d 55 23 STA $2355 ; (sframe + 54)
+103b : a9 51 __ LDA #$51
+103d : 85 0d __ STA P0
+103f : a9 23 __ LDA #$23
+1041 : 85 0e __ STA P1
+1043 : a5 5d __ LDA T0 + 0
+1045 : 85 0f __ STA P2
+1047 : a5 5e __ LDA T0 + 1
+1049 : 85 10 __ STA P3
+104b : a5 63 __ LDA T10 + 0
+104d : 85 11 __ STA P4
+104f : a5 64 __ LDA T10 + 1
+1051 : 85 12 __ STA P5
+1053 : a5 65 __ LDA T10 + 2
+1055 : 85 13 __ STA P6
+1057 : a5 66 __ LDA T10 + 3
+1059 : 85 14 __ STA P7
+105b : 20 3a 16 JSR $163a ; (nforml + 0)
+105e : a5 1b __ LDA ACCU + 0
+1060 : 85 5f __ STA T1 + 0
+1062 : a0 00 __ LDY #$00
+1064 : b1 61 __ LDA (T2 + 0),y
+1066 : 85 45 __ STA T4 + 0
+1068 : e6 61 __ INC T2 + 0
+106a : d0 02 __ BNE $106e
+106c : e6 62 __ INC T2 + 1
+106e : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+1071 : a9 51 __ LDA #$51
+1073 : 85 0d __ STA P0
+1075 : a9 23 __ LDA #$23
+1077 : 85 0e __ STA P1
+1079 : a5 5d __ LDA T0 + 0
+107b : 85 0f __ STA P2
+107d : a5 5e __ LDA T0 + 1
+107f : 85 10 __ STA P3
+1081 : a5 63 __ LDA T10 + 0
+1083 : 85 11 __ STA P4
+1085 : a5 64 __ LDA T10 + 1
+1087 : 85 12 __ STA P5
+1089 : a5 65 __ LDA T10 + 2
+108b : 85 13 __ STA P6
+108d : a5 66 __ LDA T10 + 3
+108f : 85 14 __ STA P7
+1091 : 20 3a 16 JSR $163a ; (nforml + 0)
+1094 : a5 1b __ LDA ACCU + 0
+1096 : 85 5f __ STA T1 + 0
+1098 : a0 00 __ LDY #$00
+109a : b1 61 __ LDA (T2 + 0),y
+109c : 85 45 __ STA T4 + 0
+109e : e6 61 __ INC T2 + 0
+10a0 : d0 02 __ BNE $10a4
+10a2 : e6 62 __ INC T2 + 1
+10a4 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+10a7 : a9 51 __ LDA #$51
+10a9 : 85 0d __ STA P0
+10ab : a9 23 __ LDA #$23
+10ad : 85 0e __ STA P1
+10af : a5 5d __ LDA T0 + 0
+10b1 : 85 0f __ STA P2
+10b3 : a5 5e __ LDA T0 + 1
+10b5 : 85 10 __ STA P3
+10b7 : a5 63 __ LDA T10 + 0
+10b9 : 85 11 __ STA P4
+10bb : a5 64 __ LDA T10 + 1
+10bd : 85 12 __ STA P5
+10bf : a5 65 __ LDA T10 + 2
+10c1 : 85 13 __ STA P6
+10c3 : a5 66 __ LDA T10 + 3
+10c5 : 85 14 __ STA P7
+10c7 : 20 3a 16 JSR $163a ; (nforml + 0)
+10ca : a5 1b __ LDA ACCU + 0
+10cc : 85 5f __ STA T1 + 0
+10ce : a0 00 __ LDY #$00
+10d0 : b1 61 __ LDA (T2 + 0),y
+10d2 : 85 45 __ STA T4 + 0
+10d4 : e6 61 __ INC T2 + 0
+10d6 : d0 02 __ BNE $10da
+10d8 : e6 62 __ INC T2 + 1
+10da : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+10dd : a9 10 __ LDA #$10
+10df : 8d 54 23 STA $2354 ; (sframe + 53)
+10e2 : a9 00 __ LDA #$00
+10e4 : 8d 55 23 STA $2355 ; (sframe + 54)
+10e7 : a0 06 __ LDY #$06
+10e9 : b1 23 __ LDA (SP + 0),y
+10eb : 85 47 __ STA T5 + 0
+10ed : 18 __ __ CLC
+10ee : 69 02 __ ADC #$02
+10f0 : aa __ __ TAX
+10f1 : c8 __ __ INY
+10f2 : b1 23 __ LDA (SP + 0),y
+10f4 : 85 48 __ STA T5 + 1
+10f6 : 69 00 __ ADC #$00
+10f8 : 85 4a __ STA T6 + 1
+10fa : 8a __ __ TXA
+10fb : 88 __ __ DEY
+10fc : 91 23 __ STA (SP + 0),y
+10fe : a5 4a __ LDA T6 + 1
+1100 : c8 __ __ INY
+1101 : 91 23 __ STA (SP + 0),y
+1103 : a5 5d __ LDA T0 + 0
+1105 : 85 49 __ STA T6 + 0
+1107 : a5 5e __ LDA T0 + 1
+1109 : 85 4a __ STA T6 + 1
+110b : a9 0a __ LDA #$0a
+110d : 85 5f __ STA T1 + 0
+110f : a0 00 __ LDY #$00
+1111 : b1 47 __ LDA (T5 + 0),y
+1113 : aa __ __ TAX
+1114 : c8 __ __ INY
+1115 : b1 47 __ LDA (T5 + 0),y
+1117 : 86 47 __ STX T5 + 0
+1119 : 85 48 __ STA T5 + 1
+111b : 8a __ __ TXA
+111c : 05 48 __ ORA T5 + 1
+111e : f0 03 __ BEQ $1123
+1120 : 4c ed 11 JMP $11ed ; (sformat + 1338)
+1123 : ad 53 23 LDA $2353 ; (sframe + 52)
+1126 : c9 ff __ CMP #$ff
+1128 : d0 03 __ BNE $112d
+112a : 4c df 11 JMP $11df ; (sformat + 1324)
+112d : 38 __ __ SEC
+112e : a9 0a __ LDA #$0a
+1130 : ed 53 23 SBC $2353 ; (sframe + 52)
+1133 : 85 43 __ STA T3 + 0
+1135 : c5 5f __ CMP T1 + 0
+1137 : b0 0e __ BCS $1147
+1139 : c6 5f __ DEC T1 + 0
+113b : a9 30 __ LDA #$30
+113d : a4 5f __ LDY T1 + 0
+113f : 91 49 __ STA (T6 + 0),y
+1141 : a5 43 __ LDA T3 + 0
+1143 : c5 5f __ CMP T1 + 0
+1145 : 90 f2 __ BCC $1139
+1147 : ad 58 23 LDA $2358 ; (sframe + 57)
+114a : f0 33 __ BEQ $117f
+114c : ad 54 23 LDA $2354 ; (sframe + 53)
+114f : 85 47 __ STA T5 + 0
+1151 : ad 55 23 LDA $2355 ; (sframe + 54)
+1154 : d0 29 __ BNE $117f
+1156 : a5 47 __ LDA T5 + 0
+1158 : c9 10 __ CMP #$10
+115a : d0 23 __ BNE $117f
+115c : 18 __ __ CLC
+115d : a5 5f __ LDA T1 + 0
+115f : 69 ff __ ADC #$ff
+1161 : 18 __ __ CLC
+1162 : 65 49 __ ADC T6 + 0
+1164 : 85 47 __ STA T5 + 0
+1166 : a5 4a __ LDA T6 + 1
+1168 : 69 00 __ ADC #$00
+116a : 85 48 __ STA T5 + 1
+116c : a9 58 __ LDA #$58
+116e : a0 00 __ LDY #$00
+1170 : 91 47 __ STA (T5 + 0),y
+1172 : 18 __ __ CLC
+1173 : a5 5f __ LDA T1 + 0
+1175 : 69 fe __ ADC #$fe
+1177 : 85 5f __ STA T1 + 0
+1179 : a9 30 __ LDA #$30
+117b : a4 5f __ LDY T1 + 0
+117d : 91 49 __ STA (T6 + 0),y
+117f : ad 56 23 LDA $2356 ; (sframe + 55)
+1182 : f0 08 __ BEQ $118c
+1184 : c6 5f __ DEC T1 + 0
+1186 : a9 2b __ LDA #$2b
+1188 : a4 5f __ LDY T1 + 0
+118a : 91 49 __ STA (T6 + 0),y
+118c : 38 __ __ SEC
+118d : a9 0a __ LDA #$0a
+118f : ed 52 23 SBC $2352 ; (sframe + 51)
+1192 : 85 47 __ STA T5 + 0
+1194 : a9 00 __ LDA #$00
+1196 : e9 00 __ SBC #$00
+1198 : 49 80 __ EOR #$80
+119a : c9 80 __ CMP #$80
+119c : d0 04 __ BNE $11a2
+119e : a5 47 __ LDA T5 + 0
+11a0 : c5 5f __ CMP T1 + 0
+11a2 : 90 2f __ BCC $11d3
+11a4 : a9 00 __ LDA #$00
+11a6 : 85 43 __ STA T3 + 0
+11a8 : a5 5f __ LDA T1 + 0
+11aa : c9 0a __ CMP #$0a
+11ac : b0 12 __ BCS $11c0
+11ae : a4 5f __ LDY T1 + 0
+11b0 : b1 49 __ LDA (T6 + 0),y
+11b2 : a4 43 __ LDY T3 + 0
+11b4 : 91 49 __ STA (T6 + 0),y
+11b6 : e6 43 __ INC T3 + 0
+11b8 : e6 5f __ INC T1 + 0
+11ba : a5 5f __ LDA T1 + 0
+11bc : c9 0a __ CMP #$0a
+11be : 90 ee __ BCC $11ae
+11c0 : a0 00 __ LDY #$00
+11c2 : b1 61 __ LDA (T2 + 0),y
+11c4 : 85 45 __ STA T4 + 0
+11c6 : e6 61 __ INC T2 + 0
+11c8 : d0 02 __ BNE $11cc
+11ca : e6 62 __ INC T2 + 1
+11cc : a5 43 __ LDA T3 + 0
+11ce : 85 5f __ STA T1 + 0
+11d0 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+11d3 : c6 5f __ DEC T1 + 0
+11d5 : ad 51 23 LDA $2351 ; (sframe + 50)
+11d8 : a4 5f __ LDY T1 + 0
+11da : 91 49 __ STA (T6 + 0),y
+11dc : 4c 8c 11 JMP $118c ; (sformat + 1241)
+11df : a9 09 __ LDA #$09
+11e1 : 85 43 __ STA T3 + 0
+11e3 : c5 5f __ CMP T1 + 0
+11e5 : b0 03 __ BCS $11ea
+11e7 : 4c 39 11 JMP $1139 ; (sformat + 1158)
+11ea : 4c 47 11 JMP $1147 ; (sformat + 1172)
+11ed : a5 47 __ LDA T5 + 0
+11ef : 85 1b __ STA ACCU + 0
+11f1 : a5 48 __ LDA T5 + 1
+11f3 : 85 1c __ STA ACCU + 1
+11f5 : ad 54 23 LDA $2354 ; (sframe + 53)
+11f8 : 85 03 __ STA $03
+11fa : ad 55 23 LDA $2355 ; (sframe + 54)
+11fd : 85 04 __ STA $04
+11ff : 20 32 21 JSR $2132 ; (divmod + 0)
+1202 : a5 06 __ LDA $06
+1204 : 10 2f __ BPL $1235
+1206 : 18 __ __ CLC
+1207 : a5 05 __ LDA $05
+1209 : 69 30 __ ADC #$30
+120b : c6 5f __ DEC T1 + 0
+120d : a4 5f __ LDY T1 + 0
+120f : 91 49 __ STA (T6 + 0),y
+1211 : a5 47 __ LDA T5 + 0
+1213 : 85 1b __ STA ACCU + 0
+1215 : a5 48 __ LDA T5 + 1
+1217 : 85 1c __ STA ACCU + 1
+1219 : ad 54 23 LDA $2354 ; (sframe + 53)
+121c : 85 03 __ STA $03
+121e : ad 55 23 LDA $2355 ; (sframe + 54)
+1221 : 85 04 __ STA $04
+1223 : 20 32 21 JSR $2132 ; (divmod + 0)
+1226 : a5 1b __ LDA ACCU + 0
+1228 : 85 47 __ STA T5 + 0
+122a : a5 1c __ LDA ACCU + 1
+122c : 85 48 __ STA T5 + 1
+122e : 05 1b __ ORA ACCU + 0
+1230 : d0 bb __ BNE $11ed
+1232 : 4c 23 11 JMP $1123 ; (sformat + 1136)
+1235 : d0 06 __ BNE $123d
+1237 : a5 05 __ LDA $05
+1239 : c9 0a __ CMP #$0a
+123b : 90 c9 __ BCC $1206
+123d : 18 __ __ CLC
+123e : a5 05 __ LDA $05
+1240 : 69 37 __ ADC #$37
+1242 : 4c 0b 12 JMP $120b ; (sformat + 1368)
+1245 : a0 06 __ LDY #$06
+1247 : b1 23 __ LDA (SP + 0),y
+1249 : 85 47 __ STA T5 + 0
+124b : 18 __ __ CLC
+124c : 69 02 __ ADC #$02
+124e : aa __ __ TAX
+124f : c8 __ __ INY
+1250 : b1 23 __ LDA (SP + 0),y
+1252 : 85 48 __ STA T5 + 1
+1254 : 69 00 __ ADC #$00
+1256 : 85 4a __ STA T6 + 1
+1258 : 8a __ __ TXA
+1259 : 88 __ __ DEY
+125a : 91 23 __ STA (SP + 0),y
+125c : a5 4a __ LDA T6 + 1
+125e : c8 __ __ INY
+125f : 91 23 __ STA (SP + 0),y
+1261 : a5 5d __ LDA T0 + 0
+1263 : 85 49 __ STA T6 + 0
+1265 : a5 5e __ LDA T0 + 1
+1267 : 85 4a __ STA T6 + 1
+1269 : a9 0a __ LDA #$0a
+126b : 85 5f __ STA T1 + 0
+126d : a0 00 __ LDY #$00
+126f : b1 47 __ LDA (T5 + 0),y
+1271 : aa __ __ TAX
+1272 : c8 __ __ INY
+1273 : b1 47 __ LDA (T5 + 0),y
+1275 : 86 47 __ STX T5 + 0
+1277 : 85 48 __ STA T5 + 1
+1279 : 8a __ __ TXA
+127a : 05 48 __ ORA T5 + 1
+127c : f0 03 __ BEQ $1281
+127e : 4c 3e 13 JMP $133e ; (sformat + 1675)
+1281 : ad 53 23 LDA $2353 ; (sframe + 52)
+1284 : c9 ff __ CMP #$ff
+1286 : d0 03 __ BNE $128b
+1288 : 4c 30 13 JMP $1330 ; (sformat + 1661)
+128b : 38 __ __ SEC
+128c : a9 0a __ LDA #$0a
+128e : ed 53 23 SBC $2353 ; (sframe + 52)
+1291 : 85 43 __ STA T3 + 0
+1293 : c5 5f __ CMP T1 + 0
+1295 : b0 0e __ BCS $12a5
+1297 : c6 5f __ DEC T1 + 0
+1299 : a9 30 __ LDA #$30
+129b : a4 5f __ LDY T1 + 0
+129d : 91 49 __ STA (T6 + 0),y
+129f : a5 43 __ LDA T3 + 0
+12a1 : c5 5f __ CMP T1 + 0
+12a3 : 90 f2 __ BCC $1297
+12a5 : ad 58 23 LDA $2358 ; (sframe + 57)
+12a8 : f0 33 __ BEQ $12dd
+12aa : ad 54 23 LDA $2354 ; (sframe + 53)
+12ad : 85 47 __ STA T5 + 0
+12af : ad 55 23 LDA $2355 ; (sframe + 54)
+12b2 : d0 29 __ BNE $12dd
+12b4 : a5 47 __ LDA T5 + 0
+12b6 : c9 10 __ CMP #$10
+12b8 : d0 23 __ BNE $12dd
+12ba : 18 __ __ CLC
+12bb : a5 5f __ LDA T1 + 0
+12bd : 69 ff __ ADC #$ff
+12bf : 18 __ __ CLC
+12c0 : 65 49 __ ADC T6 + 0
+12c2 : 85 47 __ STA T5 + 0
+12c4 : a5 4a __ LDA T6 + 1
+12c6 : 69 00 __ ADC #$00
+12c8 : 85 48 __ STA T5 + 1
+12ca : a9 58 __ LDA #$58
+12cc : a0 00 __ LDY #$00
+12ce : 91 47 __ STA (T5 + 0),y
+12d0 : 18 __ __ CLC
+12d1 : a5 5f __ LDA T1 + 0
+12d3 : 69 fe __ ADC #$fe
+12d5 : 85 5f __ STA T1 + 0
+12d7 : a9 30 __ LDA #$30
+12d9 : a4 5f __ LDY T1 + 0
+12db : 91 49 __ STA (T6 + 0),y
+12dd : ad 56 23 LDA $2356 ; (sframe + 55)
+12e0 : f0 08 __ BEQ $12ea
+12e2 : c6 5f __ DEC T1 + 0
+12e4 : a9 2b __ LDA #$2b
+12e6 : a4 5f __ LDY T1 + 0
+12e8 : 91 49 __ STA (T6 + 0),y
+12ea : 38 __ __ SEC
+12eb : a9 0a __ LDA #$0a
+12ed : ed 52 23 SBC $2352 ; (sframe + 51)
+12f0 : 85 47 __ STA T5 + 0
+12f2 : a9 00 __ LDA #$00
+12f4 : e9 00 __ SBC #$00
+12f6 : 49 80 __ EOR #$80
+12f8 : c9 80 __ CMP #$80
+12fa : d0 04 __ BNE $1300
+12fc : a5 47 __ LDA T5 + 0
+12fe : c5 5f __ CMP T1 + 0
+1300 : 90 22 __ BCC $1324
+1302 : a9 00 __ LDA #$00
+1304 : 85 43 __ STA T3 + 0
+1306 : a5 5f __ LDA T1 + 0
+1308 : c9 0a __ CMP #$0a
+130a : 90 03 __ BCC $130f
+130c : 4c c0 11 JMP $11c0 ; (sformat + 1293)
+130f : a4 5f __ LDY T1 + 0
+1311 : b1 49 __ LDA (T6 + 0),y
+1313 : a4 43 __ LDY T3 + 0
+1315 : 91 49 __ STA (T6 + 0),y
+1317 : e6 43 __ INC T3 + 0
+1319 : e6 5f __ INC T1 + 0
+131b : a5 5f __ LDA T1 + 0
+131d : c9 0a __ CMP #$0a
+131f : 90 ee __ BCC $130f
+1321 : 4c c0 11 JMP $11c0 ; (sformat + 1293)
+1324 : c6 5f __ DEC T1 + 0
+1326 : ad 51 23 LDA $2351 ; (sframe + 50)
+1329 : a4 5f __ LDY T1 + 0
+132b : 91 49 __ STA (T6 + 0),y
+132d : 4c ea 12 JMP $12ea ; (sformat + 1591)
+1330 : a9 09 __ LDA #$09
+1332 : 85 43 __ STA T3 + 0
+1334 : c5 5f __ CMP T1 + 0
+1336 : b0 03 __ BCS $133b
+1338 : 4c 97 12 JMP $1297 ; (sformat + 1508)
+133b : 4c a5 12 JMP $12a5 ; (sformat + 1522)
+133e : a5 47 __ LDA T5 + 0
+1340 : 85 1b __ STA ACCU + 0
+1342 : a5 48 __ LDA T5 + 1
+1344 : 85 1c __ STA ACCU + 1
+1346 : ad 54 23 LDA $2354 ; (sframe + 53)
+1349 : 85 03 __ STA $03
+134b : ad 55 23 LDA $2355 ; (sframe + 54)
+134e : 85 04 __ STA $04
+1350 : 20 32 21 JSR $2132 ; (divmod + 0)
+1353 : a5 06 __ LDA $06
+1355 : 10 2f __ BPL $1386
+1357 : 18 __ __ CLC
+1358 : a5 05 __ LDA $05
+135a : 69 30 __ ADC #$30
+135c : c6 5f __ DEC T1 + 0
+135e : a4 5f __ LDY T1 + 0
+1360 : 91 49 __ STA (T6 + 0),y
+1362 : a5 47 __ LDA T5 + 0
+1364 : 85 1b __ STA ACCU + 0
+1366 : a5 48 __ LDA T5 + 1
+1368 : 85 1c __ STA ACCU + 1
+136a : ad 54 23 LDA $2354 ; (sframe + 53)
+136d : 85 03 __ STA $03
+136f : ad 55 23 LDA $2355 ; (sframe + 54)
+1372 : 85 04 __ STA $04
+1374 : 20 32 21 JSR $2132 ; (divmod + 0)
+1377 : a5 1b __ LDA ACCU + 0
+1379 : 85 47 __ STA T5 + 0
+137b : a5 1c __ LDA ACCU + 1
+137d : 85 48 __ STA T5 + 1
+137f : 05 1b __ ORA ACCU + 0
+1381 : d0 bb __ BNE $133e
+1383 : 4c 81 12 JMP $1281 ; (sformat + 1486)
+1386 : d0 06 __ BNE $138e
+1388 : a5 05 __ LDA $05
+138a : c9 0a __ CMP #$0a
+138c : 90 c9 __ BCC $1357
+138e : 18 __ __ CLC
+138f : a5 05 __ LDA $05
+1391 : 69 37 __ ADC #$37
+1393 : 4c 5c 13 JMP $135c ; (sformat + 1705)
+1396 : a0 06 __ LDY #$06
+1398 : b1 23 __ LDA (SP + 0),y
+139a : 85 47 __ STA T5 + 0
+139c : 18 __ __ CLC
+139d : 69 02 __ ADC #$02
+139f : aa __ __ TAX
+13a0 : c8 __ __ INY
+13a1 : b1 23 __ LDA (SP + 0),y
+13a3 : 85 48 __ STA T5 + 1
+13a5 : 69 00 __ ADC #$00
+13a7 : 85 4a __ STA T6 + 1
+13a9 : 8a __ __ TXA
+13aa : 88 __ __ DEY
+13ab : 91 23 __ STA (SP + 0),y
+13ad : a5 4a __ LDA T6 + 1
+13af : c8 __ __ INY
+13b0 : 91 23 __ STA (SP + 0),y
+13b2 : a5 5d __ LDA T0 + 0
+13b4 : 85 49 __ STA T6 + 0
+13b6 : a5 5e __ LDA T0 + 1
+13b8 : 85 4a __ STA T6 + 1
+13ba : a0 00 __ LDY #$00
+13bc : b1 47 __ LDA (T5 + 0),y
+13be : 85 02 __ STA $02
+13c0 : c8 __ __ INY
+13c1 : b1 47 __ LDA (T5 + 0),y
+13c3 : 85 48 __ STA T5 + 1
+13c5 : 10 03 __ BPL $13ca
+13c7 : 4c 10 15 JMP $1510 ; (sformat + 2141)
+13ca : a5 02 __ LDA $02
+13cc : 85 4b __ STA T7 + 0
+13ce : a5 48 __ LDA T5 + 1
+13d0 : 85 4c __ STA T7 + 1
+13d2 : a9 00 __ LDA #$00
+13d4 : 85 5f __ STA T1 + 0
+13d6 : a9 0a __ LDA #$0a
+13d8 : 85 43 __ STA T3 + 0
+13da : a5 02 __ LDA $02
+13dc : 05 48 __ ORA T5 + 1
+13de : f0 03 __ BEQ $13e3
+13e0 : 4c b8 14 JMP $14b8 ; (sformat + 2053)
+13e3 : ad 53 23 LDA $2353 ; (sframe + 52)
+13e6 : c9 ff __ CMP #$ff
+13e8 : d0 03 __ BNE $13ed
+13ea : 4c aa 14 JMP $14aa ; (sformat + 2039)
+13ed : 38 __ __ SEC
+13ee : a9 0a __ LDA #$0a
+13f0 : ed 53 23 SBC $2353 ; (sframe + 52)
+13f3 : 85 45 __ STA T4 + 0
+13f5 : c5 43 __ CMP T3 + 0
+13f7 : b0 0e __ BCS $1407
+13f9 : c6 43 __ DEC T3 + 0
+13fb : a9 30 __ LDA #$30
+13fd : a4 43 __ LDY T3 + 0
+13ff : 91 49 __ STA (T6 + 0),y
+1401 : a5 45 __ LDA T4 + 0
+1403 : c5 43 __ CMP T3 + 0
+1405 : 90 f2 __ BCC $13f9
+1407 : ad 58 23 LDA $2358 ; (sframe + 57)
+140a : f0 33 __ BEQ $143f
+140c : ad 54 23 LDA $2354 ; (sframe + 53)
+140f : 85 47 __ STA T5 + 0
+1411 : ad 55 23 LDA $2355 ; (sframe + 54)
+1414 : d0 29 __ BNE $143f
+1416 : a5 47 __ LDA T5 + 0
+1418 : c9 10 __ CMP #$10
+141a : d0 23 __ BNE $143f
+141c : 18 __ __ CLC
+141d : a5 43 __ LDA T3 + 0
+141f : 69 ff __ ADC #$ff
+1421 : 18 __ __ CLC
+1422 : 65 49 __ ADC T6 + 0
+1424 : 85 47 __ STA T5 + 0
+1426 : a5 4a __ LDA T6 + 1
+1428 : 69 00 __ ADC #$00
+142a : 85 48 __ STA T5 + 1
+142c : a9 58 __ LDA #$58
+142e : a0 00 __ LDY #$00
+1430 : 91 47 __ STA (T5 + 0),y
+1432 : 18 __ __ CLC
+1433 : a5 43 __ LDA T3 + 0
+1435 : 69 fe __ ADC #$fe
+1437 : 85 43 __ STA T3 + 0
+1439 : a9 30 __ LDA #$30
+143b : a4 43 __ LDY T3 + 0
+143d : 91 49 __ STA (T6 + 0),y
+143f : a5 5f __ LDA T1 + 0
+1441 : d0 5c __ BNE $149f
+1443 : ad 56 23 LDA $2356 ; (sframe + 55)
+1446 : f0 08 __ BEQ $1450
+1448 : c6 43 __ DEC T3 + 0
+144a : a9 2b __ LDA #$2b
+144c : a4 43 __ LDY T3 + 0
+144e : 91 49 __ STA (T6 + 0),y
+1450 : 38 __ __ SEC
+1451 : a9 0a __ LDA #$0a
+1453 : ed 52 23 SBC $2352 ; (sframe + 51)
+1456 : 85 47 __ STA T5 + 0
+1458 : a9 00 __ LDA #$00
+145a : e9 00 __ SBC #$00
+145c : 49 80 __ EOR #$80
+145e : c9 80 __ CMP #$80
+1460 : d0 04 __ BNE $1466
+1462 : a5 47 __ LDA T5 + 0
+1464 : c5 43 __ CMP T3 + 0
+1466 : 90 2b __ BCC $1493
+1468 : a9 00 __ LDA #$00
+146a : 85 5f __ STA T1 + 0
+146c : a5 43 __ LDA T3 + 0
+146e : c9 0a __ CMP #$0a
+1470 : b0 12 __ BCS $1484
+1472 : a4 43 __ LDY T3 + 0
+1474 : b1 49 __ LDA (T6 + 0),y
+1476 : a4 5f __ LDY T1 + 0
+1478 : 91 49 __ STA (T6 + 0),y
+147a : e6 5f __ INC T1 + 0
+147c : e6 43 __ INC T3 + 0
+147e : a5 43 __ LDA T3 + 0
+1480 : c9 0a __ CMP #$0a
+1482 : 90 ee __ BCC $1472
+1484 : a0 00 __ LDY #$00
+1486 : b1 61 __ LDA (T2 + 0),y
+1488 : 85 45 __ STA T4 + 0
+148a : e6 61 __ INC T2 + 0
+148c : d0 02 __ BNE $1490
+148e : e6 62 __ INC T2 + 1
+1490 : 4c 4f 0d JMP $0d4f ; (sformat + 156)
+1493 : c6 43 __ DEC T3 + 0
+1495 : ad 51 23 LDA $2351 ; (sframe + 50)
+1498 : a4 43 __ LDY T3 + 0
+149a : 91 49 __ STA (T6 + 0),y
+149c : 4c 50 14 JMP $1450 ; (sformat + 1949)
+149f : c6 43 __ DEC T3 + 0
+14a1 : a9 2d __ LDA #$2d
+14a3 : a4 43 __ LDY T3 + 0
+14a5 : 91 49 __ STA (T6 + 0),y
+14a7 : 4c 50 14 JMP $1450 ; (sformat + 1949)
+14aa : a9 09 __ LDA #$09
+14ac : 85 45 __ STA T4 + 0
+14ae : c5 43 __ CMP T3 + 0
+14b0 : b0 03 __ BCS $14b5
+14b2 : 4c f9 13 JMP $13f9 ; (sformat + 1862)
+14b5 : 4c 07 14 JMP $1407 ; (sformat + 1876)
+14b8 : a5 4b __ LDA T7 + 0
+14ba : 85 1b __ STA ACCU + 0
+14bc : a5 4c __ LDA T7 + 1
+14be : 85 1c __ STA ACCU + 1
+14c0 : ad 54 23 LDA $2354 ; (sframe + 53)
+14c3 : 85 03 __ STA $03
+14c5 : ad 55 23 LDA $2355 ; (sframe + 54)
+14c8 : 85 04 __ STA $04
+14ca : 20 32 21 JSR $2132 ; (divmod + 0)
+14cd : a5 06 __ LDA $06
+14cf : 10 2f __ BPL $1500
+14d1 : 18 __ __ CLC
+14d2 : a5 05 __ LDA $05
+14d4 : 69 30 __ ADC #$30
+14d6 : c6 43 __ DEC T3 + 0
+14d8 : a4 43 __ LDY T3 + 0
+14da : 91 49 __ STA (T6 + 0),y
+14dc : a5 4b __ LDA T7 + 0
+14de : 85 1b __ STA ACCU + 0
+14e0 : a5 4c __ LDA T7 + 1
+14e2 : 85 1c __ STA ACCU + 1
+14e4 : ad 54 23 LDA $2354 ; (sframe + 53)
+14e7 : 85 03 __ STA $03
+14e9 : ad 55 23 LDA $2355 ; (sframe + 54)
+14ec : 85 04 __ STA $04
+14ee : 20 32 21 JSR $2132 ; (divmod + 0)
+14f1 : a5 1b __ LDA ACCU + 0
+14f3 : 85 4b __ STA T7 + 0
+14f5 : a5 1c __ LDA ACCU + 1
+14f7 : 85 4c __ STA T7 + 1
+14f9 : 05 1b __ ORA ACCU + 0
+14fb : d0 bb __ BNE $14b8
+14fd : 4c e3 13 JMP $13e3 ; (sformat + 1840)
+1500 : d0 06 __ BNE $1508
+1502 : a5 05 __ LDA $05
+1504 : c9 0a __ CMP #$0a
+1506 : 90 c9 __ BCC $14d1
+1508 : 18 __ __ CLC
+1509 : a5 05 __ LDA $05
+150b : 69 37 __ ADC #$37
+150d : 4c d6 14 JMP $14d6 ; (sformat + 2083)
+1510 : a9 01 __ LDA #$01
+1512 : 85 5f __ STA T1 + 0
+1514 : a9 0a __ LDA #$0a
+1516 : 85 43 __ STA T3 + 0
+1518 : 38 __ __ SEC
+1519 : a9 00 __ LDA #$00
+151b : e5 02 __ SBC $02
+151d : 85 4b __ STA T7 + 0
+151f : a9 00 __ LDA #$00
+1521 : e5 48 __ SBC T5 + 1
+1523 : 85 4c __ STA T7 + 1
+1525 : 05 4b __ ORA T7 + 0
+1527 : d0 8f __ BNE $14b8
+1529 : 4c e3 13 JMP $13e3 ; (sformat + 1840)
+152c : a9 00 __ LDA #$00
+152e : 85 47 __ STA T5 + 0
+1530 : 85 48 __ STA T5 + 1
+1532 : a0 00 __ LDY #$00
+1534 : b1 61 __ LDA (T2 + 0),y
+1536 : 85 43 __ STA T3 + 0
+1538 : e6 61 __ INC T2 + 0
+153a : d0 02 __ BNE $153e
+153c : e6 62 __ INC T2 + 1
+153e : a5 43 __ LDA T3 + 0
+1540 : c9 30 __ CMP #$30
+1542 : 90 4d __ BCC $1591
+1544 : a9 39 __ LDA #$39
+1546 : c5 43 __ CMP T3 + 0
+1548 : 90 47 __ BCC $1591
+154a : a5 43 __ LDA T3 + 0
+154c : 85 49 __ STA T6 + 0
+154e : a0 00 __ LDY #$00
+1550 : b1 61 __ LDA (T2 + 0),y
+1552 : 85 43 __ STA T3 + 0
+1554 : e6 61 __ INC T2 + 0
+1556 : d0 02 __ BNE $155a
+1558 : e6 62 __ INC T2 + 1
+155a : a5 47 __ LDA T5 + 0
+155c : 0a __ __ ASL
+155d : 85 07 __ STA $07
+155f : a5 48 __ LDA T5 + 1
+1561 : 2a __ __ ROL
+1562 : 06 07 __ ASL $07
+1564 : 2a __ __ ROL
+1565 : aa __ __ TAX
+1566 : 18 __ __ CLC
+1567 : a5 07 __ LDA $07
+1569 : 65 47 __ ADC T5 + 0
+156b : 85 1b __ STA ACCU + 0
+156d : 8a __ __ TXA
+156e : 65 48 __ ADC T5 + 1
+1570 : 06 1b __ ASL ACCU + 0
+1572 : 2a __ __ ROL
+1573 : 85 1c __ STA ACCU + 1
+1575 : 18 __ __ CLC
+1576 : a5 1b __ LDA ACCU + 0
+1578 : 65 49 __ ADC T6 + 0
+157a : aa __ __ TAX
+157b : a5 1c __ LDA ACCU + 1
+157d : 69 00 __ ADC #$00
+157f : a8 __ __ TAY
+1580 : 38 __ __ SEC
+1581 : 8a __ __ TXA
+1582 : e9 30 __ SBC #$30
+1584 : 85 47 __ STA T5 + 0
+1586 : 98 __ __ TYA
+1587 : e9 00 __ SBC #$00
+1589 : 85 48 __ STA T5 + 1
+158b : a5 43 __ LDA T3 + 0
+158d : c9 30 __ CMP #$30
+158f : b0 b3 __ BCS $1544
+1591 : a5 47 __ LDA T5 + 0
+1593 : 8d 53 23 STA $2353 ; (sframe + 52)
+1596 : 4c 53 0e JMP $0e53 ; (sformat + 416)
+1599 : a9 01 __ LDA #$01
+159b : 8d 58 23 STA $2358 ; (sframe + 57)
+159e : a0 00 __ LDY #$00
+15a0 : b1 61 __ LDA (T2 + 0),y
+15a2 : 85 43 __ STA T3 + 0
+15a4 : 4c c5 0d JMP $0dc5 ; (sformat + 274)
+15a7 : a9 30 __ LDA #$30
+15a9 : 8d 51 23 STA $2351 ; (sframe + 50)
+15ac : a0 00 __ LDY #$00
+15ae : b1 61 __ LDA (T2 + 0),y
+15b0 : 85 43 __ STA T3 + 0
+15b2 : 4c c5 0d JMP $0dc5 ; (sformat + 274)
+15b5 : a9 01 __ LDA #$01
+15b7 : 8d 56 23 STA $2356 ; (sframe + 55)
+15ba : a0 00 __ LDY #$00
+15bc : b1 61 __ LDA (T2 + 0),y
+15be : 85 43 __ STA T3 + 0
+15c0 : 4c c5 0d JMP $0dc5 ; (sformat + 274)
+15c3 : a0 08 __ LDY #$08
+15c5 : b1 23 __ LDA (SP + 0),y
+15c7 : d0 12 __ BNE $15db
+15c9 : 18 __ __ CLC
+15ca : a5 5d __ LDA T0 + 0
+15cc : 65 5f __ ADC T1 + 0
+15ce : 85 5d __ STA T0 + 0
+15d0 : 90 02 __ BCC $15d4
+15d2 : e6 5e __ INC T0 + 1
+15d4 : a9 00 __ LDA #$00
+15d6 : 85 5f __ STA T1 + 0
+15d8 : 4c 9b 0d JMP $0d9b ; (sformat + 232)
+15db : 18 __ __ CLC
+15dc : a5 5d __ LDA T0 + 0
+15de : 85 0d __ STA P0
+15e0 : 65 5f __ ADC T1 + 0
+15e2 : 85 47 __ STA T5 + 0
+15e4 : a5 5e __ LDA T0 + 1
+15e6 : 85 0e __ STA P1
+15e8 : 69 00 __ ADC #$00
+15ea : 85 48 __ STA T5 + 1
+15ec : a9 00 __ LDA #$00
+15ee : a0 00 __ LDY #$00
+15f0 : 91 47 __ STA (T5 + 0),y
+15f2 : 20 fc 15 JSR $15fc ; (puts + 0)
+15f5 : a9 00 __ LDA #$00
+15f7 : 85 5f __ STA T1 + 0
+15f9 : 4c 9b 0d JMP $0d9b ; (sformat + 232)
+--------------------------------------------------------------------
+puts:
+15fc : a0 00 __ LDY #$00
+15fe : b1 0d __ LDA (P0),y
+1600 : f0 0b __ BEQ $160d
+1602 : 20 0e 16 JSR $160e ; (putpch + 0)
+1605 : e6 0d __ INC P0
+1607 : d0 f3 __ BNE $15fc
+1609 : e6 0e __ INC P1
+160b : d0 ef __ BNE $15fc
+160d : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+160e : ae 16 23 LDX $2316 ; (giocharmap + 0)
+1611 : e0 01 __ CPX #$01
+1613 : 90 22 __ BCC $1637
+1615 : c9 0a __ CMP #$0a
+1617 : d0 02 __ BNE $161b
+1619 : a9 0d __ LDA #$0d
+161b : e0 02 __ CPX #$02
+161d : 90 18 __ BCC $1637
+161f : c9 41 __ CMP #$41
+1621 : 90 14 __ BCC $1637
+1623 : c9 7b __ CMP #$7b
+1625 : b0 10 __ BCS $1637
+1627 : c9 61 __ CMP #$61
+1629 : b0 04 __ BCS $162f
+162b : c9 5b __ CMP #$5b
+162d : b0 08 __ BCS $1637
+162f : 49 20 __ EOR #$20
+1631 : e0 03 __ CPX #$03
+1633 : f0 02 __ BEQ $1637
+1635 : 29 df __ AND #$df
+1637 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+163a : a5 11 __ LDA P4
+163c : 85 47 __ STA T1 + 0
+163e : a5 12 __ LDA P5
+1640 : 85 48 __ STA T1 + 1
+1642 : a5 13 __ LDA P6
+1644 : 85 49 __ STA T1 + 2
+1646 : a5 14 __ LDA P7
+1648 : 85 4a __ STA T1 + 3
+164a : a9 00 __ LDA #$00
+164c : 85 4d __ STA T3 + 0
+164e : a5 15 __ LDA P8
+1650 : f0 03 __ BEQ $1655
+1652 : 4c e1 17 JMP $17e1 ; (nforml + 423)
+1655 : a9 10 __ LDA #$10
+1657 : 85 4e __ STA T4 + 0
+1659 : a9 00 __ LDA #$00
+165b : c5 14 __ CMP P7
+165d : d0 0a __ BNE $1669
+165f : c5 13 __ CMP P6
+1661 : d0 06 __ BNE $1669
+1663 : c5 12 __ CMP P5
+1665 : d0 02 __ BNE $1669
+1667 : c5 11 __ CMP P4
+1669 : b0 03 __ BCS $166e
+166b : 4c 55 17 JMP $1755 ; (nforml + 283)
+166e : a0 02 __ LDY #$02
+1670 : b1 0d __ LDA (P0),y
+1672 : 85 4f __ STA T5 + 0
+1674 : c9 ff __ CMP #$ff
+1676 : d0 03 __ BNE $167b
+1678 : 4c 47 17 JMP $1747 ; (nforml + 269)
+167b : 38 __ __ SEC
+167c : a9 10 __ LDA #$10
+167e : e5 4f __ SBC T5 + 0
+1680 : 85 4f __ STA T5 + 0
+1682 : c5 4e __ CMP T4 + 0
+1684 : b0 0e __ BCS $1694
+1686 : c6 4e __ DEC T4 + 0
+1688 : a9 30 __ LDA #$30
+168a : a4 4e __ LDY T4 + 0
+168c : 91 0f __ STA (P2),y
+168e : a5 4f __ LDA T5 + 0
+1690 : c5 4e __ CMP T4 + 0
+1692 : 90 f2 __ BCC $1686
+1694 : a0 07 __ LDY #$07
+1696 : b1 0d __ LDA (P0),y
+1698 : f0 34 __ BEQ $16ce
+169a : a0 03 __ LDY #$03
+169c : b1 0d __ LDA (P0),y
+169e : 85 53 __ STA T7 + 0
+16a0 : c8 __ __ INY
+16a1 : b1 0d __ LDA (P0),y
+16a3 : d0 29 __ BNE $16ce
+16a5 : a5 53 __ LDA T7 + 0
+16a7 : c9 10 __ CMP #$10
+16a9 : d0 23 __ BNE $16ce
+16ab : 18 __ __ CLC
+16ac : a5 4e __ LDA T4 + 0
+16ae : 69 ff __ ADC #$ff
+16b0 : 18 __ __ CLC
+16b1 : 65 0f __ ADC P2
+16b3 : 85 53 __ STA T7 + 0
+16b5 : a5 10 __ LDA P3
+16b7 : 69 00 __ ADC #$00
+16b9 : 85 54 __ STA T7 + 1
+16bb : a9 58 __ LDA #$58
+16bd : a0 00 __ LDY #$00
+16bf : 91 53 __ STA (T7 + 0),y
+16c1 : 18 __ __ CLC
+16c2 : a5 4e __ LDA T4 + 0
+16c4 : 69 fe __ ADC #$fe
+16c6 : 85 4e __ STA T4 + 0
+16c8 : a9 30 __ LDA #$30
+16ca : a4 4e __ LDY T4 + 0
+16cc : 91 0f __ STA (P2),y
+16ce : a5 4d __ LDA T3 + 0
+16d0 : d0 6a __ BNE $173c
+16d2 : a0 05 __ LDY #$05
+16d4 : b1 0d __ LDA (P0),y
+16d6 : f0 08 __ BEQ $16e0
+16d8 : c6 4e __ DEC T4 + 0
+16da : a9 2b __ LDA #$2b
+16dc : a4 4e __ LDY T4 + 0
+16de : 91 0f __ STA (P2),y
+16e0 : a0 01 __ LDY #$01
+16e2 : b1 0d __ LDA (P0),y
+16e4 : 85 53 __ STA T7 + 0
+16e6 : 38 __ __ SEC
+16e7 : a9 10 __ LDA #$10
+16e9 : e5 53 __ SBC T7 + 0
+16eb : 85 53 __ STA T7 + 0
+16ed : a9 00 __ LDA #$00
+16ef : e9 00 __ SBC #$00
+16f1 : 49 80 __ EOR #$80
+16f3 : c9 80 __ CMP #$80
+16f5 : d0 04 __ BNE $16fb
+16f7 : a5 53 __ LDA T7 + 0
+16f9 : c5 4e __ CMP T4 + 0
+16fb : 90 32 __ BCC $172f
+16fd : a9 00 __ LDA #$00
+16ff : 85 4d __ STA T3 + 0
+1701 : a5 4e __ LDA T4 + 0
+1703 : c9 10 __ CMP #$10
+1705 : 90 09 __ BCC $1710
+1707 : a5 4d __ LDA T3 + 0
+1709 : 85 1b __ STA ACCU + 0
+170b : a9 00 __ LDA #$00
+170d : 85 1c __ STA ACCU + 1
+170f : 60 __ __ RTS
+1710 : aa __ __ TAX
+1711 : 8a __ __ TXA
+1712 : 18 __ __ CLC
+1713 : 65 0f __ ADC P2
+1715 : 85 51 __ STA T6 + 0
+1717 : a5 10 __ LDA P3
+1719 : 69 00 __ ADC #$00
+171b : 85 52 __ STA T6 + 1
+171d : a0 00 __ LDY #$00
+171f : b1 51 __ LDA (T6 + 0),y
+1721 : a4 4d __ LDY T3 + 0
+1723 : 91 0f __ STA (P2),y
+1725 : e6 4d __ INC T3 + 0
+1727 : e8 __ __ INX
+1728 : e0 10 __ CPX #$10
+172a : 90 e5 __ BCC $1711
+172c : 4c 07 17 JMP $1707 ; (nforml + 205)
+172f : c6 4e __ DEC T4 + 0
+1731 : a0 00 __ LDY #$00
+1733 : b1 0d __ LDA (P0),y
+1735 : a4 4e __ LDY T4 + 0
+1737 : 91 0f __ STA (P2),y
+1739 : 4c e0 16 JMP $16e0 ; (nforml + 166)
+173c : c6 4e __ DEC T4 + 0
+173e : a9 2d __ LDA #$2d
+1740 : a4 4e __ LDY T4 + 0
+1742 : 91 0f __ STA (P2),y
+1744 : 4c e0 16 JMP $16e0 ; (nforml + 166)
+1747 : a9 0f __ LDA #$0f
+1749 : 85 4f __ STA T5 + 0
+174b : c5 4e __ CMP T4 + 0
+174d : b0 03 __ BCS $1752
+174f : 4c 86 16 JMP $1686 ; (nforml + 76)
+1752 : 4c 94 16 JMP $1694 ; (nforml + 90)
+1755 : a0 03 __ LDY #$03
+1757 : b1 0d __ LDA (P0),y
+1759 : 85 03 __ STA $03
+175b : c8 __ __ INY
+175c : b1 0d __ LDA (P0),y
+175e : 85 04 __ STA $04
+1760 : a9 00 __ LDA #$00
+1762 : 85 05 __ STA $05
+1764 : 85 06 __ STA $06
+1766 : a5 47 __ LDA T1 + 0
+1768 : 85 1b __ STA ACCU + 0
+176a : a5 48 __ LDA T1 + 1
+176c : 85 1c __ STA ACCU + 1
+176e : a5 49 __ LDA T1 + 2
+1770 : 85 1d __ STA ACCU + 2
+1772 : a5 4a __ LDA T1 + 3
+1774 : 85 1e __ STA ACCU + 3
+1776 : 20 be 22 JSR $22be ; (divmod32 + 0)
+1779 : a5 08 __ LDA $08
+177b : 10 54 __ BPL $17d1
+177d : 18 __ __ CLC
+177e : a5 07 __ LDA $07
+1780 : 69 30 __ ADC #$30
+1782 : c6 4e __ DEC T4 + 0
+1784 : a4 4e __ LDY T4 + 0
+1786 : 91 0f __ STA (P2),y
+1788 : a0 03 __ LDY #$03
+178a : b1 0d __ LDA (P0),y
+178c : 85 03 __ STA $03
+178e : c8 __ __ INY
+178f : b1 0d __ LDA (P0),y
+1791 : 85 04 __ STA $04
+1793 : a9 00 __ LDA #$00
+1795 : 85 05 __ STA $05
+1797 : 85 06 __ STA $06
+1799 : a5 47 __ LDA T1 + 0
+179b : 85 1b __ STA ACCU + 0
+179d : a5 48 __ LDA T1 + 1
+179f : 85 1c __ STA ACCU + 1
+17a1 : a5 49 __ LDA T1 + 2
+17a3 : 85 1d __ STA ACCU + 2
+17a5 : a5 4a __ LDA T1 + 3
+17a7 : 85 1e __ STA ACCU + 3
+17a9 : 20 be 22 JSR $22be ; (divmod32 + 0)
+17ac : a5 1b __ LDA ACCU + 0
+17ae : 85 47 __ STA T1 + 0
+17b0 : a5 1c __ LDA ACCU + 1
+17b2 : 85 48 __ STA T1 + 1
+17b4 : a5 1d __ LDA ACCU + 2
+17b6 : 85 49 __ STA T1 + 2
+17b8 : a5 1e __ LDA ACCU + 3
+17ba : 85 4a __ STA T1 + 3
+17bc : a9 00 __ LDA #$00
+17be : c5 1e __ CMP ACCU + 3
+17c0 : d0 0a __ BNE $17cc
+17c2 : c5 1d __ CMP ACCU + 2
+17c4 : d0 06 __ BNE $17cc
+17c6 : c5 1c __ CMP ACCU + 1
+17c8 : d0 02 __ BNE $17cc
+17ca : c5 1b __ CMP ACCU + 0
+17cc : 90 87 __ BCC $1755
+17ce : 4c 6e 16 JMP $166e ; (nforml + 52)
+17d1 : d0 06 __ BNE $17d9
+17d3 : a5 07 __ LDA $07
+17d5 : c9 0a __ CMP #$0a
+17d7 : 90 a4 __ BCC $177d
+17d9 : 18 __ __ CLC
+17da : a5 07 __ LDA $07
+17dc : 69 37 __ ADC #$37
+17de : 4c 82 17 JMP $1782 ; (nforml + 328)
+17e1 : a5 14 __ LDA P7
+17e3 : 49 80 __ EOR #$80
+17e5 : c9 80 __ CMP #$80
+17e7 : d0 0f __ BNE $17f8
+17e9 : a5 13 __ LDA P6
+17eb : c9 00 __ CMP #$00
+17ed : d0 09 __ BNE $17f8
+17ef : a5 12 __ LDA P5
+17f1 : c9 00 __ CMP #$00
+17f3 : d0 03 __ BNE $17f8
+17f5 : 4c 55 16 JMP $1655 ; (nforml + 27)
+17f8 : 90 03 __ BCC $17fd
+17fa : 4c 55 16 JMP $1655 ; (nforml + 27)
+17fd : a9 01 __ LDA #$01
+17ff : 85 4d __ STA T3 + 0
+1801 : a9 10 __ LDA #$10
+1803 : 85 4e __ STA T4 + 0
+1805 : 38 __ __ SEC
+1806 : a9 00 __ LDA #$00
+1808 : e5 11 __ SBC P4
+180a : 85 47 __ STA T1 + 0
+180c : a9 00 __ LDA #$00
+180e : e5 12 __ SBC P5
+1810 : 85 48 __ STA T1 + 1
+1812 : a9 00 __ LDA #$00
+1814 : e5 13 __ SBC P6
+1816 : 85 49 __ STA T1 + 2
+1818 : a9 00 __ LDA #$00
+181a : e5 14 __ SBC P7
+181c : 85 4a __ STA T1 + 3
+181e : a9 00 __ LDA #$00
+1820 : c5 4a __ CMP T1 + 3
+1822 : d0 0a __ BNE $182e
+1824 : c5 49 __ CMP T1 + 2
+1826 : d0 06 __ BNE $182e
+1828 : c5 48 __ CMP T1 + 1
+182a : d0 02 __ BNE $182e
+182c : c5 47 __ CMP T1 + 0
+182e : b0 03 __ BCS $1833
+1830 : 4c 55 17 JMP $1755 ; (nforml + 283)
+1833 : 4c 6e 16 JMP $166e ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+1836 : a9 00 __ LDA #$00
+1838 : 85 1b __ STA ACCU + 0
+183a : 85 1c __ STA ACCU + 1
+183c : 85 1d __ STA ACCU + 2
+183e : 85 1e __ STA ACCU + 3
+1840 : a5 11 __ LDA P4
+1842 : 85 03 __ STA $03
+1844 : a5 12 __ LDA P5
+1846 : 85 04 __ STA $04
+1848 : a5 13 __ LDA P6
+184a : 85 05 __ STA $05
+184c : a5 14 __ LDA P7
+184e : 85 06 __ STA $06
+1850 : 20 6d 22 JSR $226d ; (fcmp + 0)
+1853 : 10 03 __ BPL $1858
+1855 : 4c 70 1e JMP $1e70 ; (nformf + 1594)
+1858 : a9 00 __ LDA #$00
+185a : 85 4b __ STA T3 + 0
+185c : a0 05 __ LDY #$05
+185e : b1 0d __ LDA (P0),y
+1860 : f0 0a __ BEQ $186c
+1862 : a9 2b __ LDA #$2b
+1864 : a0 00 __ LDY #$00
+1866 : 91 0f __ STA (P2),y
+1868 : a9 01 __ LDA #$01
+186a : 85 4b __ STA T3 + 0
+186c : a9 00 __ LDA #$00
+186e : 85 43 __ STA T0 + 0
+1870 : 85 44 __ STA T0 + 1
+1872 : a0 02 __ LDY #$02
+1874 : b1 0d __ LDA (P0),y
+1876 : 85 4e __ STA T5 + 0
+1878 : c9 ff __ CMP #$ff
+187a : d0 04 __ BNE $1880
+187c : a9 06 __ LDA #$06
+187e : 85 4e __ STA T5 + 0
+1880 : a9 00 __ LDA #$00
+1882 : 85 1b __ STA ACCU + 0
+1884 : 85 1c __ STA ACCU + 1
+1886 : 85 1d __ STA ACCU + 2
+1888 : 85 1e __ STA ACCU + 3
+188a : a5 11 __ LDA P4
+188c : 85 03 __ STA $03
+188e : a5 12 __ LDA P5
+1890 : 85 04 __ STA $04
+1892 : a5 13 __ LDA P6
+1894 : 85 05 __ STA $05
+1896 : a5 14 __ LDA P7
+1898 : 85 06 __ STA $06
+189a : 20 6d 22 JSR $226d ; (fcmp + 0)
+189d : d0 03 __ BNE $18a2
+189f : 4c 26 1a JMP $1a26 ; (nformf + 496)
+18a2 : a9 00 __ LDA #$00
+18a4 : 85 1b __ STA ACCU + 0
+18a6 : 85 1c __ STA ACCU + 1
+18a8 : a9 7a __ LDA #$7a
+18aa : 85 1d __ STA ACCU + 2
+18ac : a9 44 __ LDA #$44
+18ae : 85 1e __ STA ACCU + 3
+18b0 : a5 11 __ LDA P4
+18b2 : 85 03 __ STA $03
+18b4 : a5 12 __ LDA P5
+18b6 : 85 04 __ STA $04
+18b8 : a5 13 __ LDA P6
+18ba : 85 05 __ STA $05
+18bc : a5 14 __ LDA P7
+18be : 85 06 __ STA $06
+18c0 : 20 6d 22 JSR $226d ; (fcmp + 0)
+18c3 : 30 5a __ BMI $191f
+18c5 : a5 11 __ LDA P4
+18c7 : 85 1b __ STA ACCU + 0
+18c9 : a5 12 __ LDA P5
+18cb : 85 1c __ STA ACCU + 1
+18cd : a5 13 __ LDA P6
+18cf : 85 1d __ STA ACCU + 2
+18d1 : a5 14 __ LDA P7
+18d3 : 85 1e __ STA ACCU + 3
+18d5 : a9 00 __ LDA #$00
+18d7 : 85 03 __ STA $03
+18d9 : 85 04 __ STA $04
+18db : a9 7a __ LDA #$7a
+18dd : 85 05 __ STA $05
+18df : a9 44 __ LDA #$44
+18e1 : 85 06 __ STA $06
+18e3 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+18e6 : 20 7a 20 JSR $207a ; (fdiv + 0)
+18e9 : a5 1b __ LDA ACCU + 0
+18eb : 85 11 __ STA P4
+18ed : 85 03 __ STA $03
+18ef : a5 1c __ LDA ACCU + 1
+18f1 : 85 12 __ STA P5
+18f3 : 85 04 __ STA $04
+18f5 : a5 1d __ LDA ACCU + 2
+18f7 : 85 13 __ STA P6
+18f9 : 85 05 __ STA $05
+18fb : a5 1e __ LDA ACCU + 3
+18fd : 85 14 __ STA P7
+18ff : 85 06 __ STA $06
+1901 : 18 __ __ CLC
+1902 : a5 43 __ LDA T0 + 0
+1904 : 69 03 __ ADC #$03
+1906 : 85 43 __ STA T0 + 0
+1908 : 90 02 __ BCC $190c
+190a : e6 44 __ INC T0 + 1
+190c : a9 00 __ LDA #$00
+190e : 85 1b __ STA ACCU + 0
+1910 : 85 1c __ STA ACCU + 1
+1912 : a9 7a __ LDA #$7a
+1914 : 85 1d __ STA ACCU + 2
+1916 : a9 44 __ LDA #$44
+1918 : 85 1e __ STA ACCU + 3
+191a : 20 6d 22 JSR $226d ; (fcmp + 0)
+191d : 10 a6 __ BPL $18c5
+191f : a9 00 __ LDA #$00
+1921 : 85 1b __ STA ACCU + 0
+1923 : 85 1c __ STA ACCU + 1
+1925 : a9 80 __ LDA #$80
+1927 : 85 1d __ STA ACCU + 2
+1929 : a9 3f __ LDA #$3f
+192b : 85 1e __ STA ACCU + 3
+192d : a5 11 __ LDA P4
+192f : 85 03 __ STA $03
+1931 : a5 12 __ LDA P5
+1933 : 85 04 __ STA $04
+1935 : a5 13 __ LDA P6
+1937 : 85 05 __ STA $05
+1939 : a5 14 __ LDA P7
+193b : 85 06 __ STA $06
+193d : 20 6d 22 JSR $226d ; (fcmp + 0)
+1940 : 10 5c __ BPL $199e
+1942 : a5 11 __ LDA P4
+1944 : 85 1b __ STA ACCU + 0
+1946 : a5 12 __ LDA P5
+1948 : 85 1c __ STA ACCU + 1
+194a : a5 13 __ LDA P6
+194c : 85 1d __ STA ACCU + 2
+194e : a5 14 __ LDA P7
+1950 : 85 1e __ STA ACCU + 3
+1952 : a9 00 __ LDA #$00
+1954 : 85 03 __ STA $03
+1956 : 85 04 __ STA $04
+1958 : a9 7a __ LDA #$7a
+195a : 85 05 __ STA $05
+195c : a9 44 __ LDA #$44
+195e : 85 06 __ STA $06
+1960 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1963 : 20 dc 1f JSR $1fdc ; (fmul + 0)
+1966 : a5 1b __ LDA ACCU + 0
+1968 : 85 11 __ STA P4
+196a : 85 03 __ STA $03
+196c : a5 1c __ LDA ACCU + 1
+196e : 85 12 __ STA P5
+1970 : 85 04 __ STA $04
+1972 : a5 1d __ LDA ACCU + 2
+1974 : 85 13 __ STA P6
+1976 : 85 05 __ STA $05
+1978 : a5 1e __ LDA ACCU + 3
+197a : 85 14 __ STA P7
+197c : 85 06 __ STA $06
+197e : 38 __ __ SEC
+197f : a5 43 __ LDA T0 + 0
+1981 : e9 03 __ SBC #$03
+1983 : 85 43 __ STA T0 + 0
+1985 : a5 44 __ LDA T0 + 1
+1987 : e9 00 __ SBC #$00
+1989 : 85 44 __ STA T0 + 1
+198b : a9 00 __ LDA #$00
+198d : 85 1b __ STA ACCU + 0
+198f : 85 1c __ STA ACCU + 1
+1991 : a9 80 __ LDA #$80
+1993 : 85 1d __ STA ACCU + 2
+1995 : a9 3f __ LDA #$3f
+1997 : 85 1e __ STA ACCU + 3
+1999 : 20 6d 22 JSR $226d ; (fcmp + 0)
+199c : 30 a4 __ BMI $1942
+199e : a9 00 __ LDA #$00
+19a0 : 85 1b __ STA ACCU + 0
+19a2 : 85 1c __ STA ACCU + 1
+19a4 : a9 20 __ LDA #$20
+19a6 : 85 1d __ STA ACCU + 2
+19a8 : a9 41 __ LDA #$41
+19aa : 85 1e __ STA ACCU + 3
+19ac : a5 11 __ LDA P4
+19ae : 85 03 __ STA $03
+19b0 : a5 12 __ LDA P5
+19b2 : 85 04 __ STA $04
+19b4 : a5 13 __ LDA P6
+19b6 : 85 05 __ STA $05
+19b8 : a5 14 __ LDA P7
+19ba : 85 06 __ STA $06
+19bc : 20 6d 22 JSR $226d ; (fcmp + 0)
+19bf : 30 65 __ BMI $1a26
+19c1 : a5 11 __ LDA P4
+19c3 : 85 1b __ STA ACCU + 0
+19c5 : a5 12 __ LDA P5
+19c7 : 85 1c __ STA ACCU + 1
+19c9 : a5 13 __ LDA P6
+19cb : 85 1d __ STA ACCU + 2
+19cd : a5 14 __ LDA P7
+19cf : 85 1e __ STA ACCU + 3
+19d1 : a9 00 __ LDA #$00
+19d3 : 85 03 __ STA $03
+19d5 : 85 04 __ STA $04
+19d7 : a9 20 __ LDA #$20
+19d9 : 85 05 __ STA $05
+19db : a9 41 __ LDA #$41
+19dd : 85 06 __ STA $06
+19df : 20 e3 1e JSR $1ee3 ; (freg + 20)
+19e2 : 20 7a 20 JSR $207a ; (fdiv + 0)
+19e5 : a5 1b __ LDA ACCU + 0
+19e7 : 85 11 __ STA P4
+19e9 : 85 47 __ STA T2 + 0
+19eb : a5 1c __ LDA ACCU + 1
+19ed : 85 12 __ STA P5
+19ef : 85 48 __ STA T2 + 1
+19f1 : a5 1d __ LDA ACCU + 2
+19f3 : 85 13 __ STA P6
+19f5 : 85 49 __ STA T2 + 2
+19f7 : a5 1e __ LDA ACCU + 3
+19f9 : 85 14 __ STA P7
+19fb : 85 4a __ STA T2 + 3
+19fd : e6 43 __ INC T0 + 0
+19ff : d0 02 __ BNE $1a03
+1a01 : e6 44 __ INC T0 + 1
+1a03 : a9 00 __ LDA #$00
+1a05 : 85 1b __ STA ACCU + 0
+1a07 : 85 1c __ STA ACCU + 1
+1a09 : a9 20 __ LDA #$20
+1a0b : 85 1d __ STA ACCU + 2
+1a0d : a9 41 __ LDA #$41
+1a0f : 85 1e __ STA ACCU + 3
+1a11 : a5 47 __ LDA T2 + 0
+1a13 : 85 03 __ STA $03
+1a15 : a5 48 __ LDA T2 + 1
+1a17 : 85 04 __ STA $04
+1a19 : a5 49 __ LDA T2 + 2
+1a1b : 85 05 __ STA $05
+1a1d : a5 4a __ LDA T2 + 3
+1a1f : 85 06 __ STA $06
+1a21 : 20 6d 22 JSR $226d ; (fcmp + 0)
+1a24 : 10 9b __ BPL $19c1
+1a26 : a5 15 __ LDA P8
+1a28 : c9 65 __ CMP #$65
+1a2a : d0 03 __ BNE $1a2f
+1a2c : 4c 6b 1e JMP $1e6b ; (nformf + 1589)
+1a2f : a9 00 __ LDA #$00
+1a31 : 85 51 __ STA T7 + 0
+1a33 : 85 52 __ STA T8 + 0
+1a35 : a5 4e __ LDA T5 + 0
+1a37 : 85 4c __ STA T4 + 0
+1a39 : e6 4c __ INC T4 + 0
+1a3b : a5 15 __ LDA P8
+1a3d : c9 67 __ CMP #$67
+1a3f : d0 03 __ BNE $1a44
+1a41 : 4c 4e 1e JMP $1e4e ; (nformf + 1560)
+1a44 : a5 51 __ LDA T7 + 0
+1a46 : f0 03 __ BEQ $1a4b
+1a48 : 4c 5c 1d JMP $1d5c ; (nformf + 1318)
+1a4b : a5 44 __ LDA T0 + 1
+1a4d : 10 03 __ BPL $1a52
+1a4f : 4c 1b 1d JMP $1d1b ; (nformf + 1253)
+1a52 : a9 00 __ LDA #$00
+1a54 : 85 47 __ STA T2 + 0
+1a56 : 85 48 __ STA T2 + 1
+1a58 : 85 49 __ STA T2 + 2
+1a5a : a9 3f __ LDA #$3f
+1a5c : 85 4a __ STA T2 + 3
+1a5e : 18 __ __ CLC
+1a5f : a5 4e __ LDA T5 + 0
+1a61 : 65 43 __ ADC T0 + 0
+1a63 : 85 4c __ STA T4 + 0
+1a65 : e6 4c __ INC T4 + 0
+1a67 : a9 01 __ LDA #$01
+1a69 : c5 4c __ CMP T4 + 0
+1a6b : b0 03 __ BCS $1a70
+1a6d : 4c da 1c JMP $1cda ; (nformf + 1188)
+1a70 : a5 11 __ LDA P4
+1a72 : 85 1b __ STA ACCU + 0
+1a74 : a5 12 __ LDA P5
+1a76 : 85 1c __ STA ACCU + 1
+1a78 : a5 13 __ LDA P6
+1a7a : 85 1d __ STA ACCU + 2
+1a7c : a5 14 __ LDA P7
+1a7e : 85 1e __ STA ACCU + 3
+1a80 : a5 47 __ LDA T2 + 0
+1a82 : 85 03 __ STA $03
+1a84 : a5 48 __ LDA T2 + 1
+1a86 : 85 04 __ STA $04
+1a88 : a5 49 __ LDA T2 + 2
+1a8a : 85 05 __ STA $05
+1a8c : a5 4a __ LDA T2 + 3
+1a8e : 85 06 __ STA $06
+1a90 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1a93 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+1a96 : a5 1b __ LDA ACCU + 0
+1a98 : 85 11 __ STA P4
+1a9a : 85 47 __ STA T2 + 0
+1a9c : 85 03 __ STA $03
+1a9e : a5 1c __ LDA ACCU + 1
+1aa0 : 85 12 __ STA P5
+1aa2 : 85 48 __ STA T2 + 1
+1aa4 : 85 04 __ STA $04
+1aa6 : a5 1d __ LDA ACCU + 2
+1aa8 : 85 13 __ STA P6
+1aaa : 85 49 __ STA T2 + 2
+1aac : 85 05 __ STA $05
+1aae : a5 1e __ LDA ACCU + 3
+1ab0 : 85 14 __ STA P7
+1ab2 : 85 4a __ STA T2 + 3
+1ab4 : 85 06 __ STA $06
+1ab6 : a9 00 __ LDA #$00
+1ab8 : 85 1b __ STA ACCU + 0
+1aba : 85 1c __ STA ACCU + 1
+1abc : a9 20 __ LDA #$20
+1abe : 85 1d __ STA ACCU + 2
+1ac0 : a9 41 __ LDA #$41
+1ac2 : 85 1e __ STA ACCU + 3
+1ac4 : 20 6d 22 JSR $226d ; (fcmp + 0)
+1ac7 : 30 36 __ BMI $1aff
+1ac9 : a5 47 __ LDA T2 + 0
+1acb : 85 1b __ STA ACCU + 0
+1acd : a5 48 __ LDA T2 + 1
+1acf : 85 1c __ STA ACCU + 1
+1ad1 : a5 49 __ LDA T2 + 2
+1ad3 : 85 1d __ STA ACCU + 2
+1ad5 : a5 4a __ LDA T2 + 3
+1ad7 : 85 1e __ STA ACCU + 3
+1ad9 : a9 00 __ LDA #$00
+1adb : 85 03 __ STA $03
+1add : 85 04 __ STA $04
+1adf : a9 20 __ LDA #$20
+1ae1 : 85 05 __ STA $05
+1ae3 : a9 41 __ LDA #$41
+1ae5 : 85 06 __ STA $06
+1ae7 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1aea : 20 7a 20 JSR $207a ; (fdiv + 0)
+1aed : a5 1b __ LDA ACCU + 0
+1aef : 85 11 __ STA P4
+1af1 : a5 1c __ LDA ACCU + 1
+1af3 : 85 12 __ STA P5
+1af5 : a5 1d __ LDA ACCU + 2
+1af7 : 85 13 __ STA P6
+1af9 : a5 1e __ LDA ACCU + 3
+1afb : 85 14 __ STA P7
+1afd : c6 4e __ DEC T5 + 0
+1aff : 38 __ __ SEC
+1b00 : a5 4c __ LDA T4 + 0
+1b02 : e5 4e __ SBC T5 + 0
+1b04 : 85 53 __ STA T10 + 0
+1b06 : 85 4e __ STA T5 + 0
+1b08 : a9 14 __ LDA #$14
+1b0a : c5 4c __ CMP T4 + 0
+1b0c : b0 02 __ BCS $1b10
+1b0e : 85 4c __ STA T4 + 0
+1b10 : a5 53 __ LDA T10 + 0
+1b12 : d0 08 __ BNE $1b1c
+1b14 : a9 30 __ LDA #$30
+1b16 : a4 4b __ LDY T3 + 0
+1b18 : 91 0f __ STA (P2),y
+1b1a : e6 4b __ INC T3 + 0
+1b1c : a9 00 __ LDA #$00
+1b1e : 85 50 __ STA T6 + 0
+1b20 : a5 4c __ LDA T4 + 0
+1b22 : f0 03 __ BEQ $1b27
+1b24 : 4c 49 1c JMP $1c49 ; (nformf + 1043)
+1b27 : a5 52 __ LDA T8 + 0
+1b29 : f0 03 __ BEQ $1b2e
+1b2b : 4c c9 1b JMP $1bc9 ; (nformf + 915)
+1b2e : a5 4b __ LDA T3 + 0
+1b30 : a0 01 __ LDY #$01
+1b32 : d1 0d __ CMP (P0),y
+1b34 : 90 07 __ BCC $1b3d
+1b36 : 85 1b __ STA ACCU + 0
+1b38 : a9 00 __ LDA #$00
+1b3a : 85 1c __ STA ACCU + 1
+1b3c : 60 __ __ RTS
+1b3d : c9 01 __ CMP #$01
+1b3f : 90 53 __ BCC $1b94
+1b41 : a9 01 __ LDA #$01
+1b43 : 85 4e __ STA T5 + 0
+1b45 : a5 0d __ LDA P0
+1b47 : 85 43 __ STA T0 + 0
+1b49 : a5 0e __ LDA P1
+1b4b : 85 44 __ STA T0 + 1
+1b4d : a5 4b __ LDA T3 + 0
+1b4f : 85 4c __ STA T4 + 0
+1b51 : 38 __ __ SEC
+1b52 : a5 4c __ LDA T4 + 0
+1b54 : e5 4e __ SBC T5 + 0
+1b56 : 85 55 __ STA T11 + 0
+1b58 : a9 00 __ LDA #$00
+1b5a : e9 00 __ SBC #$00
+1b5c : 85 56 __ STA T11 + 1
+1b5e : 18 __ __ CLC
+1b5f : a5 0f __ LDA P2
+1b61 : 65 55 __ ADC T11 + 0
+1b63 : 85 55 __ STA T11 + 0
+1b65 : a5 10 __ LDA P3
+1b67 : 65 56 __ ADC T11 + 1
+1b69 : 85 56 __ STA T11 + 1
+1b6b : a0 01 __ LDY #$01
+1b6d : b1 43 __ LDA (T0 + 0),y
+1b6f : 38 __ __ SEC
+1b70 : e5 4e __ SBC T5 + 0
+1b72 : 85 53 __ STA T10 + 0
+1b74 : a9 00 __ LDA #$00
+1b76 : e9 00 __ SBC #$00
+1b78 : 85 54 __ STA T10 + 1
+1b7a : 18 __ __ CLC
+1b7b : a5 0f __ LDA P2
+1b7d : 65 53 __ ADC T10 + 0
+1b7f : 85 53 __ STA T10 + 0
+1b81 : a5 10 __ LDA P3
+1b83 : 65 54 __ ADC T10 + 1
+1b85 : 85 54 __ STA T10 + 1
+1b87 : 88 __ __ DEY
+1b88 : b1 55 __ LDA (T11 + 0),y
+1b8a : 91 53 __ STA (T10 + 0),y
+1b8c : e6 4e __ INC T5 + 0
+1b8e : a5 4b __ LDA T3 + 0
+1b90 : c5 4e __ CMP T5 + 0
+1b92 : b0 bd __ BCS $1b51
+1b94 : a9 00 __ LDA #$00
+1b96 : 85 4e __ STA T5 + 0
+1b98 : a5 4b __ LDA T3 + 0
+1b9a : 85 43 __ STA T0 + 0
+1b9c : a0 01 __ LDY #$01
+1b9e : b1 0d __ LDA (P0),y
+1ba0 : 85 4b __ STA T3 + 0
+1ba2 : 38 __ __ SEC
+1ba3 : e5 43 __ SBC T0 + 0
+1ba5 : 85 53 __ STA T10 + 0
+1ba7 : a9 00 __ LDA #$00
+1ba9 : e9 00 __ SBC #$00
+1bab : 85 54 __ STA T10 + 1
+1bad : a9 00 __ LDA #$00
+1baf : c5 54 __ CMP T10 + 1
+1bb1 : d0 04 __ BNE $1bb7
+1bb3 : a5 4e __ LDA T5 + 0
+1bb5 : c5 53 __ CMP T10 + 0
+1bb7 : 90 05 __ BCC $1bbe
+1bb9 : a5 4b __ LDA T3 + 0
+1bbb : 4c 36 1b JMP $1b36 ; (nformf + 768)
+1bbe : a9 20 __ LDA #$20
+1bc0 : a4 4e __ LDY T5 + 0
+1bc2 : 91 0f __ STA (P2),y
+1bc4 : e6 4e __ INC T5 + 0
+1bc6 : 4c 9c 1b JMP $1b9c ; (nformf + 870)
+1bc9 : a9 45 __ LDA #$45
+1bcb : a4 4b __ LDY T3 + 0
+1bcd : 91 0f __ STA (P2),y
+1bcf : c8 __ __ INY
+1bd0 : a5 44 __ LDA T0 + 1
+1bd2 : 30 5a __ BMI $1c2e
+1bd4 : a9 2b __ LDA #$2b
+1bd6 : 91 0f __ STA (P2),y
+1bd8 : 18 __ __ CLC
+1bd9 : a5 4b __ LDA T3 + 0
+1bdb : 69 02 __ ADC #$02
+1bdd : 85 4b __ STA T3 + 0
+1bdf : a5 43 __ LDA T0 + 0
+1be1 : 85 1b __ STA ACCU + 0
+1be3 : a5 44 __ LDA T0 + 1
+1be5 : 85 1c __ STA ACCU + 1
+1be7 : a9 0a __ LDA #$0a
+1be9 : 85 03 __ STA $03
+1beb : a9 00 __ LDA #$00
+1bed : 85 04 __ STA $04
+1bef : 20 f8 20 JSR $20f8 ; (divs16 + 0)
+1bf2 : 18 __ __ CLC
+1bf3 : a5 1b __ LDA ACCU + 0
+1bf5 : 69 30 __ ADC #$30
+1bf7 : a4 4b __ LDY T3 + 0
+1bf9 : 91 0f __ STA (P2),y
+1bfb : c8 __ __ INY
+1bfc : 98 __ __ TYA
+1bfd : 18 __ __ CLC
+1bfe : 65 0f __ ADC P2
+1c00 : 85 4c __ STA T4 + 0
+1c02 : a5 10 __ LDA P3
+1c04 : 69 00 __ ADC #$00
+1c06 : 85 4d __ STA T4 + 1
+1c08 : a5 43 __ LDA T0 + 0
+1c0a : 85 1b __ STA ACCU + 0
+1c0c : a5 44 __ LDA T0 + 1
+1c0e : 85 1c __ STA ACCU + 1
+1c10 : a9 0a __ LDA #$0a
+1c12 : 85 03 __ STA $03
+1c14 : a9 00 __ LDA #$00
+1c16 : 85 04 __ STA $04
+1c18 : 20 b7 21 JSR $21b7 ; (mods16 + 0)
+1c1b : 18 __ __ CLC
+1c1c : a5 05 __ LDA $05
+1c1e : 69 30 __ ADC #$30
+1c20 : a0 00 __ LDY #$00
+1c22 : 91 4c __ STA (T4 + 0),y
+1c24 : 18 __ __ CLC
+1c25 : a5 4b __ LDA T3 + 0
+1c27 : 69 02 __ ADC #$02
+1c29 : 85 4b __ STA T3 + 0
+1c2b : 4c 2e 1b JMP $1b2e ; (nformf + 760)
+1c2e : a9 2d __ LDA #$2d
+1c30 : 91 0f __ STA (P2),y
+1c32 : 18 __ __ CLC
+1c33 : a5 4b __ LDA T3 + 0
+1c35 : 69 02 __ ADC #$02
+1c37 : 85 4b __ STA T3 + 0
+1c39 : 38 __ __ SEC
+1c3a : a9 00 __ LDA #$00
+1c3c : e5 43 __ SBC T0 + 0
+1c3e : 85 43 __ STA T0 + 0
+1c40 : a9 00 __ LDA #$00
+1c42 : e5 44 __ SBC T0 + 1
+1c44 : 85 44 __ STA T0 + 1
+1c46 : 4c df 1b JMP $1bdf ; (nformf + 937)
+1c49 : a5 50 __ LDA T6 + 0
+1c4b : c5 4e __ CMP T5 + 0
+1c4d : d0 08 __ BNE $1c57
+1c4f : a9 2e __ LDA #$2e
+1c51 : a4 4b __ LDY T3 + 0
+1c53 : 91 0f __ STA (P2),y
+1c55 : e6 4b __ INC T3 + 0
+1c57 : a5 11 __ LDA P4
+1c59 : 85 1b __ STA ACCU + 0
+1c5b : a5 12 __ LDA P5
+1c5d : 85 1c __ STA ACCU + 1
+1c5f : a5 13 __ LDA P6
+1c61 : 85 1d __ STA ACCU + 2
+1c63 : a5 14 __ LDA P7
+1c65 : 85 1e __ STA ACCU + 3
+1c67 : 20 e0 21 JSR $21e0 ; (f32_to_i16 + 0)
+1c6a : a5 1b __ LDA ACCU + 0
+1c6c : 85 53 __ STA T10 + 0
+1c6e : 20 22 22 JSR $2222 ; (sint16_to_float + 0)
+1c71 : a5 1b __ LDA ACCU + 0
+1c73 : 85 03 __ STA $03
+1c75 : a5 1c __ LDA ACCU + 1
+1c77 : 85 04 __ STA $04
+1c79 : a5 1d __ LDA ACCU + 2
+1c7b : 85 05 __ STA $05
+1c7d : a5 1e __ LDA ACCU + 3
+1c7f : 85 06 __ STA $06
+1c81 : a5 11 __ LDA P4
+1c83 : 85 1b __ STA ACCU + 0
+1c85 : a5 12 __ LDA P5
+1c87 : 85 1c __ STA ACCU + 1
+1c89 : a5 13 __ LDA P6
+1c8b : 85 1d __ STA ACCU + 2
+1c8d : a5 14 __ LDA P7
+1c8f : 85 1e __ STA ACCU + 3
+1c91 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1c94 : a5 06 __ LDA $06
+1c96 : 49 80 __ EOR #$80
+1c98 : 85 06 __ STA $06
+1c9a : 20 14 1f JSR $1f14 ; (faddsub + 0)
+1c9d : a9 00 __ LDA #$00
+1c9f : 85 03 __ STA $03
+1ca1 : 85 04 __ STA $04
+1ca3 : a9 20 __ LDA #$20
+1ca5 : 85 05 __ STA $05
+1ca7 : a9 41 __ LDA #$41
+1ca9 : 85 06 __ STA $06
+1cab : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1cae : 20 dc 1f JSR $1fdc ; (fmul + 0)
+1cb1 : a5 1b __ LDA ACCU + 0
+1cb3 : 85 11 __ STA P4
+1cb5 : a5 1c __ LDA ACCU + 1
+1cb7 : 85 12 __ STA P5
+1cb9 : a5 1d __ LDA ACCU + 2
+1cbb : 85 13 __ STA P6
+1cbd : a5 1e __ LDA ACCU + 3
+1cbf : 85 14 __ STA P7
+1cc1 : 18 __ __ CLC
+1cc2 : a5 53 __ LDA T10 + 0
+1cc4 : 69 30 __ ADC #$30
+1cc6 : a4 4b __ LDY T3 + 0
+1cc8 : 91 0f __ STA (P2),y
+1cca : e6 4b __ INC T3 + 0
+1ccc : e6 50 __ INC T6 + 0
+1cce : a5 50 __ LDA T6 + 0
+1cd0 : c5 4c __ CMP T4 + 0
+1cd2 : b0 03 __ BCS $1cd7
+1cd4 : 4c 49 1c JMP $1c49 ; (nformf + 1043)
+1cd7 : 4c 27 1b JMP $1b27 ; (nformf + 753)
+1cda : 85 50 __ STA T6 + 0
+1cdc : a5 47 __ LDA T2 + 0
+1cde : 85 1b __ STA ACCU + 0
+1ce0 : a5 48 __ LDA T2 + 1
+1ce2 : 85 1c __ STA ACCU + 1
+1ce4 : a5 49 __ LDA T2 + 2
+1ce6 : 85 1d __ STA ACCU + 2
+1ce8 : a5 4a __ LDA T2 + 3
+1cea : 85 1e __ STA ACCU + 3
+1cec : a9 00 __ LDA #$00
+1cee : 85 03 __ STA $03
+1cf0 : 85 04 __ STA $04
+1cf2 : a9 20 __ LDA #$20
+1cf4 : 85 05 __ STA $05
+1cf6 : a9 41 __ LDA #$41
+1cf8 : 85 06 __ STA $06
+1cfa : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1cfd : 20 7a 20 JSR $207a ; (fdiv + 0)
+1d00 : a5 1b __ LDA ACCU + 0
+1d02 : 85 47 __ STA T2 + 0
+1d04 : a5 1c __ LDA ACCU + 1
+1d06 : 85 48 __ STA T2 + 1
+1d08 : a5 1d __ LDA ACCU + 2
+1d0a : 85 49 __ STA T2 + 2
+1d0c : a5 1e __ LDA ACCU + 3
+1d0e : 85 4a __ STA T2 + 3
+1d10 : e6 50 __ INC T6 + 0
+1d12 : a5 50 __ LDA T6 + 0
+1d14 : c5 4c __ CMP T4 + 0
+1d16 : 90 c4 __ BCC $1cdc
+1d18 : 4c 70 1a JMP $1a70 ; (nformf + 570)
+1d1b : a5 11 __ LDA P4
+1d1d : 85 1b __ STA ACCU + 0
+1d1f : a5 12 __ LDA P5
+1d21 : 85 1c __ STA ACCU + 1
+1d23 : a5 13 __ LDA P6
+1d25 : 85 1d __ STA ACCU + 2
+1d27 : a5 14 __ LDA P7
+1d29 : 85 1e __ STA ACCU + 3
+1d2b : a9 00 __ LDA #$00
+1d2d : 85 03 __ STA $03
+1d2f : 85 04 __ STA $04
+1d31 : a9 20 __ LDA #$20
+1d33 : 85 05 __ STA $05
+1d35 : a9 41 __ LDA #$41
+1d37 : 85 06 __ STA $06
+1d39 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1d3c : 20 7a 20 JSR $207a ; (fdiv + 0)
+1d3f : a5 1b __ LDA ACCU + 0
+1d41 : 85 11 __ STA P4
+1d43 : a5 1c __ LDA ACCU + 1
+1d45 : 85 12 __ STA P5
+1d47 : a5 1d __ LDA ACCU + 2
+1d49 : 85 13 __ STA P6
+1d4b : a5 1e __ LDA ACCU + 3
+1d4d : 85 14 __ STA P7
+1d4f : e6 43 __ INC T0 + 0
+1d51 : d0 02 __ BNE $1d55
+1d53 : e6 44 __ INC T0 + 1
+1d55 : a5 44 __ LDA T0 + 1
+1d57 : 30 c2 __ BMI $1d1b
+1d59 : 4c 52 1a JMP $1a52 ; (nformf + 540)
+1d5c : a9 00 __ LDA #$00
+1d5e : 85 47 __ STA T2 + 0
+1d60 : 85 48 __ STA T2 + 1
+1d62 : 85 49 __ STA T2 + 2
+1d64 : a9 3f __ LDA #$3f
+1d66 : 85 4a __ STA T2 + 3
+1d68 : a5 4e __ LDA T5 + 0
+1d6a : f0 03 __ BEQ $1d6f
+1d6c : 4c 0b 1e JMP $1e0b ; (nformf + 1493)
+1d6f : a5 11 __ LDA P4
+1d71 : 85 1b __ STA ACCU + 0
+1d73 : a5 12 __ LDA P5
+1d75 : 85 1c __ STA ACCU + 1
+1d77 : a5 13 __ LDA P6
+1d79 : 85 1d __ STA ACCU + 2
+1d7b : a5 14 __ LDA P7
+1d7d : 85 1e __ STA ACCU + 3
+1d7f : a5 47 __ LDA T2 + 0
+1d81 : 85 03 __ STA $03
+1d83 : a5 48 __ LDA T2 + 1
+1d85 : 85 04 __ STA $04
+1d87 : a5 49 __ LDA T2 + 2
+1d89 : 85 05 __ STA $05
+1d8b : a5 4a __ LDA T2 + 3
+1d8d : 85 06 __ STA $06
+1d8f : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1d92 : 20 14 1f JSR $1f14 ; (faddsub + 0)
+1d95 : a5 1b __ LDA ACCU + 0
+1d97 : 85 11 __ STA P4
+1d99 : 85 47 __ STA T2 + 0
+1d9b : 85 03 __ STA $03
+1d9d : a5 1c __ LDA ACCU + 1
+1d9f : 85 12 __ STA P5
+1da1 : 85 48 __ STA T2 + 1
+1da3 : 85 04 __ STA $04
+1da5 : a5 1d __ LDA ACCU + 2
+1da7 : 85 13 __ STA P6
+1da9 : 85 49 __ STA T2 + 2
+1dab : 85 05 __ STA $05
+1dad : a5 1e __ LDA ACCU + 3
+1daf : 85 14 __ STA P7
+1db1 : 85 4a __ STA T2 + 3
+1db3 : 85 06 __ STA $06
+1db5 : a9 00 __ LDA #$00
+1db7 : 85 1b __ STA ACCU + 0
+1db9 : 85 1c __ STA ACCU + 1
+1dbb : a9 20 __ LDA #$20
+1dbd : 85 1d __ STA ACCU + 2
+1dbf : a9 41 __ LDA #$41
+1dc1 : 85 1e __ STA ACCU + 3
+1dc3 : 20 6d 22 JSR $226d ; (fcmp + 0)
+1dc6 : 10 03 __ BPL $1dcb
+1dc8 : 4c ff 1a JMP $1aff ; (nformf + 713)
+1dcb : a5 47 __ LDA T2 + 0
+1dcd : 85 1b __ STA ACCU + 0
+1dcf : a5 48 __ LDA T2 + 1
+1dd1 : 85 1c __ STA ACCU + 1
+1dd3 : a5 49 __ LDA T2 + 2
+1dd5 : 85 1d __ STA ACCU + 2
+1dd7 : a5 4a __ LDA T2 + 3
+1dd9 : 85 1e __ STA ACCU + 3
+1ddb : a9 00 __ LDA #$00
+1ddd : 85 03 __ STA $03
+1ddf : 85 04 __ STA $04
+1de1 : a9 20 __ LDA #$20
+1de3 : 85 05 __ STA $05
+1de5 : a9 41 __ LDA #$41
+1de7 : 85 06 __ STA $06
+1de9 : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1dec : 20 7a 20 JSR $207a ; (fdiv + 0)
+1def : a5 1b __ LDA ACCU + 0
+1df1 : 85 11 __ STA P4
+1df3 : a5 1c __ LDA ACCU + 1
+1df5 : 85 12 __ STA P5
+1df7 : a5 1d __ LDA ACCU + 2
+1df9 : 85 13 __ STA P6
+1dfb : a5 1e __ LDA ACCU + 3
+1dfd : 85 14 __ STA P7
+1dff : e6 43 __ INC T0 + 0
+1e01 : f0 03 __ BEQ $1e06
+1e03 : 4c ff 1a JMP $1aff ; (nformf + 713)
+1e06 : e6 44 __ INC T0 + 1
+1e08 : 4c ff 1a JMP $1aff ; (nformf + 713)
+1e0b : a9 00 __ LDA #$00
+1e0d : 85 50 __ STA T6 + 0
+1e0f : a5 47 __ LDA T2 + 0
+1e11 : 85 1b __ STA ACCU + 0
+1e13 : a5 48 __ LDA T2 + 1
+1e15 : 85 1c __ STA ACCU + 1
+1e17 : a5 49 __ LDA T2 + 2
+1e19 : 85 1d __ STA ACCU + 2
+1e1b : a5 4a __ LDA T2 + 3
+1e1d : 85 1e __ STA ACCU + 3
+1e1f : a9 00 __ LDA #$00
+1e21 : 85 03 __ STA $03
+1e23 : 85 04 __ STA $04
+1e25 : a9 20 __ LDA #$20
+1e27 : 85 05 __ STA $05
+1e29 : a9 41 __ LDA #$41
+1e2b : 85 06 __ STA $06
+1e2d : 20 e3 1e JSR $1ee3 ; (freg + 20)
+1e30 : 20 7a 20 JSR $207a ; (fdiv + 0)
+1e33 : a5 1b __ LDA ACCU + 0
+1e35 : 85 47 __ STA T2 + 0
+1e37 : a5 1c __ LDA ACCU + 1
+1e39 : 85 48 __ STA T2 + 1
+1e3b : a5 1d __ LDA ACCU + 2
+1e3d : 85 49 __ STA T2 + 2
+1e3f : a5 1e __ LDA ACCU + 3
+1e41 : 85 4a __ STA T2 + 3
+1e43 : e6 50 __ INC T6 + 0
+1e45 : a5 50 __ LDA T6 + 0
+1e47 : c5 4e __ CMP T5 + 0
+1e49 : 90 c4 __ BCC $1e0f
+1e4b : 4c 6f 1d JMP $1d6f ; (nformf + 1337)
+1e4e : a5 44 __ LDA T0 + 1
+1e50 : 10 0e __ BPL $1e60
+1e52 : a5 44 __ LDA T0 + 1
+1e54 : 30 03 __ BMI $1e59
+1e56 : 4c 44 1a JMP $1a44 ; (nformf + 526)
+1e59 : a9 01 __ LDA #$01
+1e5b : 85 52 __ STA T8 + 0
+1e5d : 4c 5c 1d JMP $1d5c ; (nformf + 1318)
+1e60 : d0 f7 __ BNE $1e59
+1e62 : a9 03 __ LDA #$03
+1e64 : c5 43 __ CMP T0 + 0
+1e66 : 90 f1 __ BCC $1e59
+1e68 : 4c 52 1e JMP $1e52 ; (nformf + 1564)
+1e6b : a9 01 __ LDA #$01
+1e6d : 4c 31 1a JMP $1a31 ; (nformf + 507)
+1e70 : a5 14 __ LDA P7
+1e72 : 49 80 __ EOR #$80
+1e74 : 85 14 __ STA P7
+1e76 : a9 2d __ LDA #$2d
+1e78 : a0 00 __ LDY #$00
+1e7a : 91 0f __ STA (P2),y
+1e7c : a9 01 __ LDA #$01
+1e7e : 85 4b __ STA T3 + 0
+1e80 : 4c 6c 18 JMP $186c ; (nformf + 54)
+--------------------------------------------------------------------
+assert:
+1e90 : a0 02 __ LDY #$02
+1e92 : b1 23 __ LDA (SP + 0),y
+1e94 : d0 09 __ BNE $1e9f
+1e96 : a9 ff __ LDA #$ff
+1e98 : 85 0d __ STA P0
+1e9a : 85 0e __ STA P1
+1e9c : 20 a0 1e JSR $1ea0 ; (exit + 0)
+1e9f : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1ea0 : a5 0d __ LDA P0
+1ea2 : 85 1b __ STA ACCU + 0
+1ea4 : a5 0e __ LDA P1
+1ea6 : 85 1c __ STA ACCU + 1
+1ea8 : ae 15 23 LDX $2315 ; (spentry + 0)
+1eab : 9a __ __ TXS
+1eac : a9 4c __ LDA #$4c
+1eae : 85 54 __ STA $54
+1eb0 : a9 00 __ LDA #$00
+1eb2 : 85 13 __ STA P6
+1eb4 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1ec2 : a9 4c __ LDA #$4c
+1ec4 : 85 54 __ STA $54
+1ec6 : a9 00 __ LDA #$00
+1ec8 : 85 13 __ STA P6
+1eca : a9 19 __ LDA #$19
+1ecc : 85 16 __ STA P9
+1ece : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1ecf : b1 19 __ LDA (IP + 0),y
+1ed1 : c8 __ __ INY
+1ed2 : aa __ __ TAX
+1ed3 : b5 00 __ LDA $00,x
+1ed5 : 85 03 __ STA $03
+1ed7 : b5 01 __ LDA $01,x
+1ed9 : 85 04 __ STA $04
+1edb : b5 02 __ LDA $02,x
+1edd : 85 05 __ STA $05
+1edf : b5 03 __ LDA $03,x
+1ee1 : 85 06 __ STA $06
+1ee3 : a5 05 __ LDA $05
+1ee5 : 0a __ __ ASL
+1ee6 : a5 06 __ LDA $06
+1ee8 : 2a __ __ ROL
+1ee9 : 85 08 __ STA $08
+1eeb : f0 06 __ BEQ $1ef3
+1eed : a5 05 __ LDA $05
+1eef : 09 80 __ ORA #$80
+1ef1 : 85 05 __ STA $05
+1ef3 : a5 1d __ LDA ACCU + 2
+1ef5 : 0a __ __ ASL
+1ef6 : a5 1e __ LDA ACCU + 3
+1ef8 : 2a __ __ ROL
+1ef9 : 85 07 __ STA $07
+1efb : f0 06 __ BEQ $1f03
+1efd : a5 1d __ LDA ACCU + 2
+1eff : 09 80 __ ORA #$80
+1f01 : 85 1d __ STA ACCU + 2
+1f03 : 60 __ __ RTS
+1f04 : 06 1e __ ASL ACCU + 3
+1f06 : a5 07 __ LDA $07
+1f08 : 6a __ __ ROR
+1f09 : 85 1e __ STA ACCU + 3
+1f0b : b0 06 __ BCS $1f13
+1f0d : a5 1d __ LDA ACCU + 2
+1f0f : 29 7f __ AND #$7f
+1f11 : 85 1d __ STA ACCU + 2
+1f13 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1f14 : 38 __ __ SEC
+1f15 : a5 07 __ LDA $07
+1f17 : e5 08 __ SBC $08
+1f19 : f0 38 __ BEQ $1f53
+1f1b : aa __ __ TAX
+1f1c : b0 25 __ BCS $1f43
+1f1e : e0 e9 __ CPX #$e9
+1f20 : b0 0e __ BCS $1f30
+1f22 : a5 08 __ LDA $08
+1f24 : 85 07 __ STA $07
+1f26 : a9 00 __ LDA #$00
+1f28 : 85 1b __ STA ACCU + 0
+1f2a : 85 1c __ STA ACCU + 1
+1f2c : 85 1d __ STA ACCU + 2
+1f2e : f0 23 __ BEQ $1f53
+1f30 : a5 1d __ LDA ACCU + 2
+1f32 : 4a __ __ LSR
+1f33 : 66 1c __ ROR ACCU + 1
+1f35 : 66 1b __ ROR ACCU + 0
+1f37 : e8 __ __ INX
+1f38 : d0 f8 __ BNE $1f32
+1f3a : 85 1d __ STA ACCU + 2
+1f3c : a5 08 __ LDA $08
+1f3e : 85 07 __ STA $07
+1f40 : 4c 53 1f JMP $1f53 ; (faddsub + 63)
+1f43 : e0 18 __ CPX #$18
+1f45 : b0 33 __ BCS $1f7a
+1f47 : a5 05 __ LDA $05
+1f49 : 4a __ __ LSR
+1f4a : 66 04 __ ROR $04
+1f4c : 66 03 __ ROR $03
+1f4e : ca __ __ DEX
+1f4f : d0 f8 __ BNE $1f49
+1f51 : 85 05 __ STA $05
+1f53 : a5 1e __ LDA ACCU + 3
+1f55 : 29 80 __ AND #$80
+1f57 : 85 1e __ STA ACCU + 3
+1f59 : 45 06 __ EOR $06
+1f5b : 30 2d __ BMI $1f8a
+1f5d : 18 __ __ CLC
+1f5e : a5 1b __ LDA ACCU + 0
+1f60 : 65 03 __ ADC $03
+1f62 : 85 1b __ STA ACCU + 0
+1f64 : a5 1c __ LDA ACCU + 1
+1f66 : 65 04 __ ADC $04
+1f68 : 85 1c __ STA ACCU + 1
+1f6a : a5 1d __ LDA ACCU + 2
+1f6c : 65 05 __ ADC $05
+1f6e : 85 1d __ STA ACCU + 2
+1f70 : 90 08 __ BCC $1f7a
+1f72 : 66 1d __ ROR ACCU + 2
+1f74 : 66 1c __ ROR ACCU + 1
+1f76 : 66 1b __ ROR ACCU + 0
+1f78 : e6 07 __ INC $07
+1f7a : a5 07 __ LDA $07
+1f7c : 4a __ __ LSR
+1f7d : 05 1e __ ORA ACCU + 3
+1f7f : 85 1e __ STA ACCU + 3
+1f81 : b0 06 __ BCS $1f89
+1f83 : a5 1d __ LDA ACCU + 2
+1f85 : 29 7f __ AND #$7f
+1f87 : 85 1d __ STA ACCU + 2
+1f89 : 60 __ __ RTS
+1f8a : 38 __ __ SEC
+1f8b : a5 1b __ LDA ACCU + 0
+1f8d : e5 03 __ SBC $03
+1f8f : 85 1b __ STA ACCU + 0
+1f91 : a5 1c __ LDA ACCU + 1
+1f93 : e5 04 __ SBC $04
+1f95 : 85 1c __ STA ACCU + 1
+1f97 : a5 1d __ LDA ACCU + 2
+1f99 : e5 05 __ SBC $05
+1f9b : 85 1d __ STA ACCU + 2
+1f9d : b0 19 __ BCS $1fb8
+1f9f : 38 __ __ SEC
+1fa0 : a9 00 __ LDA #$00
+1fa2 : e5 1b __ SBC ACCU + 0
+1fa4 : 85 1b __ STA ACCU + 0
+1fa6 : a9 00 __ LDA #$00
+1fa8 : e5 1c __ SBC ACCU + 1
+1faa : 85 1c __ STA ACCU + 1
+1fac : a9 00 __ LDA #$00
+1fae : e5 1d __ SBC ACCU + 2
+1fb0 : 85 1d __ STA ACCU + 2
+1fb2 : a5 1e __ LDA ACCU + 3
+1fb4 : 49 80 __ EOR #$80
+1fb6 : 85 1e __ STA ACCU + 3
+1fb8 : a5 1d __ LDA ACCU + 2
+1fba : 30 be __ BMI $1f7a
+1fbc : 05 1c __ ORA ACCU + 1
+1fbe : 05 1b __ ORA ACCU + 0
+1fc0 : f0 0f __ BEQ $1fd1
+1fc2 : c6 07 __ DEC $07
+1fc4 : f0 0b __ BEQ $1fd1
+1fc6 : 06 1b __ ASL ACCU + 0
+1fc8 : 26 1c __ ROL ACCU + 1
+1fca : 26 1d __ ROL ACCU + 2
+1fcc : 10 f4 __ BPL $1fc2
+1fce : 4c 7a 1f JMP $1f7a ; (faddsub + 102)
+1fd1 : a9 00 __ LDA #$00
+1fd3 : 85 1b __ STA ACCU + 0
+1fd5 : 85 1c __ STA ACCU + 1
+1fd7 : 85 1d __ STA ACCU + 2
+1fd9 : 85 1e __ STA ACCU + 3
+1fdb : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1fdc : a5 1b __ LDA ACCU + 0
+1fde : 05 1c __ ORA ACCU + 1
+1fe0 : 05 1d __ ORA ACCU + 2
+1fe2 : d0 03 __ BNE $1fe7
+1fe4 : 85 1e __ STA ACCU + 3
+1fe6 : 60 __ __ RTS
+1fe7 : a5 03 __ LDA $03
+1fe9 : 05 04 __ ORA $04
+1feb : 05 05 __ ORA $05
+1fed : d0 09 __ BNE $1ff8
+1fef : 85 1b __ STA ACCU + 0
+1ff1 : 85 1c __ STA ACCU + 1
+1ff3 : 85 1d __ STA ACCU + 2
+1ff5 : 85 1e __ STA ACCU + 3
+1ff7 : 60 __ __ RTS
+1ff8 : a9 00 __ LDA #$00
+1ffa : 85 09 __ STA $09
+1ffc : 85 0a __ STA $0a
+1ffe : 85 0b __ STA $0b
+2000 : a4 1b __ LDY ACCU + 0
+2002 : a5 03 __ LDA $03
+2004 : d0 06 __ BNE $200c
+2006 : a5 04 __ LDA $04
+2008 : f0 0a __ BEQ $2014
+200a : d0 05 __ BNE $2011
+200c : 20 4c 20 JSR $204c ; (fmul8 + 0)
+200f : a5 04 __ LDA $04
+2011 : 20 4c 20 JSR $204c ; (fmul8 + 0)
+2014 : a5 05 __ LDA $05
+2016 : 20 4c 20 JSR $204c ; (fmul8 + 0)
+2019 : 38 __ __ SEC
+201a : a5 0b __ LDA $0b
+201c : 30 06 __ BMI $2024
+201e : 06 09 __ ASL $09
+2020 : 26 0a __ ROL $0a
+2022 : 2a __ __ ROL
+2023 : 18 __ __ CLC
+2024 : 29 7f __ AND #$7f
+2026 : 85 0b __ STA $0b
+2028 : a5 1e __ LDA ACCU + 3
+202a : 45 06 __ EOR $06
+202c : 29 80 __ AND #$80
+202e : 85 1e __ STA ACCU + 3
+2030 : a5 07 __ LDA $07
+2032 : e9 7e __ SBC #$7e
+2034 : 18 __ __ CLC
+2035 : 65 08 __ ADC $08
+2037 : 4a __ __ LSR
+2038 : 05 1e __ ORA ACCU + 3
+203a : 85 1e __ STA ACCU + 3
+203c : a9 00 __ LDA #$00
+203e : 6a __ __ ROR
+203f : 05 0b __ ORA $0b
+2041 : 85 1d __ STA ACCU + 2
+2043 : a5 0a __ LDA $0a
+2045 : 85 1c __ STA ACCU + 1
+2047 : a5 09 __ LDA $09
+2049 : 85 1b __ STA ACCU + 0
+204b : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+204c : 38 __ __ SEC
+204d : 6a __ __ ROR
+204e : 90 1e __ BCC $206e
+2050 : aa __ __ TAX
+2051 : 18 __ __ CLC
+2052 : 98 __ __ TYA
+2053 : 65 09 __ ADC $09
+2055 : 85 09 __ STA $09
+2057 : a5 0a __ LDA $0a
+2059 : 65 1c __ ADC ACCU + 1
+205b : 85 0a __ STA $0a
+205d : a5 0b __ LDA $0b
+205f : 65 1d __ ADC ACCU + 2
+2061 : 6a __ __ ROR
+2062 : 85 0b __ STA $0b
+2064 : 8a __ __ TXA
+2065 : 66 0a __ ROR $0a
+2067 : 66 09 __ ROR $09
+2069 : 4a __ __ LSR
+206a : f0 0d __ BEQ $2079
+206c : b0 e2 __ BCS $2050
+206e : 66 0b __ ROR $0b
+2070 : 66 0a __ ROR $0a
+2072 : 66 09 __ ROR $09
+2074 : 4a __ __ LSR
+2075 : 90 f7 __ BCC $206e
+2077 : d0 d7 __ BNE $2050
+2079 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+207a : a5 1b __ LDA ACCU + 0
+207c : 05 1c __ ORA ACCU + 1
+207e : 05 1d __ ORA ACCU + 2
+2080 : d0 03 __ BNE $2085
+2082 : 85 1e __ STA ACCU + 3
+2084 : 60 __ __ RTS
+2085 : a5 1e __ LDA ACCU + 3
+2087 : 45 06 __ EOR $06
+2089 : 29 80 __ AND #$80
+208b : 85 1e __ STA ACCU + 3
+208d : a9 00 __ LDA #$00
+208f : 85 09 __ STA $09
+2091 : 85 0a __ STA $0a
+2093 : 85 0b __ STA $0b
+2095 : a2 18 __ LDX #$18
+2097 : a5 1b __ LDA ACCU + 0
+2099 : c5 03 __ CMP $03
+209b : a5 1c __ LDA ACCU + 1
+209d : e5 04 __ SBC $04
+209f : a5 1d __ LDA ACCU + 2
+20a1 : e5 05 __ SBC $05
+20a3 : 90 13 __ BCC $20b8
+20a5 : a5 1b __ LDA ACCU + 0
+20a7 : e5 03 __ SBC $03
+20a9 : 85 1b __ STA ACCU + 0
+20ab : a5 1c __ LDA ACCU + 1
+20ad : e5 04 __ SBC $04
+20af : 85 1c __ STA ACCU + 1
+20b1 : a5 1d __ LDA ACCU + 2
+20b3 : e5 05 __ SBC $05
+20b5 : 85 1d __ STA ACCU + 2
+20b7 : 38 __ __ SEC
+20b8 : 26 09 __ ROL $09
+20ba : 26 0a __ ROL $0a
+20bc : 26 0b __ ROL $0b
+20be : ca __ __ DEX
+20bf : f0 0a __ BEQ $20cb
+20c1 : 06 1b __ ASL ACCU + 0
+20c3 : 26 1c __ ROL ACCU + 1
+20c5 : 26 1d __ ROL ACCU + 2
+20c7 : b0 dc __ BCS $20a5
+20c9 : 90 cc __ BCC $2097
+20cb : 38 __ __ SEC
+20cc : a5 0b __ LDA $0b
+20ce : 30 06 __ BMI $20d6
+20d0 : 06 09 __ ASL $09
+20d2 : 26 0a __ ROL $0a
+20d4 : 2a __ __ ROL
+20d5 : 18 __ __ CLC
+20d6 : 29 7f __ AND #$7f
+20d8 : 85 0b __ STA $0b
+20da : a5 08 __ LDA $08
+20dc : 49 7f __ EOR #$7f
+20de : 65 07 __ ADC $07
+20e0 : 38 __ __ SEC
+20e1 : e9 01 __ SBC #$01
+20e3 : 4a __ __ LSR
+20e4 : 05 1e __ ORA ACCU + 3
+20e6 : 85 1e __ STA ACCU + 3
+20e8 : a9 00 __ LDA #$00
+20ea : 6a __ __ ROR
+20eb : 05 0b __ ORA $0b
+20ed : 85 1d __ STA ACCU + 2
+20ef : a5 0a __ LDA $0a
+20f1 : 85 1c __ STA ACCU + 1
+20f3 : a5 09 __ LDA $09
+20f5 : 85 1b __ STA ACCU + 0
+20f7 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+20f8 : 24 1c __ BIT ACCU + 1
+20fa : 10 0d __ BPL $2109
+20fc : 20 16 21 JSR $2116 ; (negaccu + 0)
+20ff : 24 04 __ BIT $04
+2101 : 10 0d __ BPL $2110
+2103 : 20 24 21 JSR $2124 ; (negtmp + 0)
+2106 : 4c 32 21 JMP $2132 ; (divmod + 0)
+2109 : 24 04 __ BIT $04
+210b : 10 f9 __ BPL $2106
+210d : 20 24 21 JSR $2124 ; (negtmp + 0)
+2110 : 20 32 21 JSR $2132 ; (divmod + 0)
+2113 : 4c 16 21 JMP $2116 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+2116 : 38 __ __ SEC
+2117 : a9 00 __ LDA #$00
+2119 : e5 1b __ SBC ACCU + 0
+211b : 85 1b __ STA ACCU + 0
+211d : a9 00 __ LDA #$00
+211f : e5 1c __ SBC ACCU + 1
+2121 : 85 1c __ STA ACCU + 1
+2123 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+2124 : 38 __ __ SEC
+2125 : a9 00 __ LDA #$00
+2127 : e5 03 __ SBC $03
+2129 : 85 03 __ STA $03
+212b : a9 00 __ LDA #$00
+212d : e5 04 __ SBC $04
+212f : 85 04 __ STA $04
+2131 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+2132 : a5 1c __ LDA ACCU + 1
+2134 : d0 31 __ BNE $2167
+2136 : a5 04 __ LDA $04
+2138 : d0 1e __ BNE $2158
+213a : 85 06 __ STA $06
+213c : a2 04 __ LDX #$04
+213e : 06 1b __ ASL ACCU + 0
+2140 : 2a __ __ ROL
+2141 : c5 03 __ CMP $03
+2143 : 90 02 __ BCC $2147
+2145 : e5 03 __ SBC $03
+2147 : 26 1b __ ROL ACCU + 0
+2149 : 2a __ __ ROL
+214a : c5 03 __ CMP $03
+214c : 90 02 __ BCC $2150
+214e : e5 03 __ SBC $03
+2150 : 26 1b __ ROL ACCU + 0
+2152 : ca __ __ DEX
+2153 : d0 eb __ BNE $2140
+2155 : 85 05 __ STA $05
+2157 : 60 __ __ RTS
+2158 : a5 1b __ LDA ACCU + 0
+215a : 85 05 __ STA $05
+215c : a5 1c __ LDA ACCU + 1
+215e : 85 06 __ STA $06
+2160 : a9 00 __ LDA #$00
+2162 : 85 1b __ STA ACCU + 0
+2164 : 85 1c __ STA ACCU + 1
+2166 : 60 __ __ RTS
+2167 : a5 04 __ LDA $04
+2169 : d0 1f __ BNE $218a
+216b : a5 03 __ LDA $03
+216d : 30 1b __ BMI $218a
+216f : a9 00 __ LDA #$00
+2171 : 85 06 __ STA $06
+2173 : a2 10 __ LDX #$10
+2175 : 06 1b __ ASL ACCU + 0
+2177 : 26 1c __ ROL ACCU + 1
+2179 : 2a __ __ ROL
+217a : c5 03 __ CMP $03
+217c : 90 02 __ BCC $2180
+217e : e5 03 __ SBC $03
+2180 : 26 1b __ ROL ACCU + 0
+2182 : 26 1c __ ROL ACCU + 1
+2184 : ca __ __ DEX
+2185 : d0 f2 __ BNE $2179
+2187 : 85 05 __ STA $05
+2189 : 60 __ __ RTS
+218a : a9 00 __ LDA #$00
+218c : 85 05 __ STA $05
+218e : 85 06 __ STA $06
+2190 : 84 02 __ STY $02
+2192 : a0 10 __ LDY #$10
+2194 : 18 __ __ CLC
+2195 : 26 1b __ ROL ACCU + 0
+2197 : 26 1c __ ROL ACCU + 1
+2199 : 26 05 __ ROL $05
+219b : 26 06 __ ROL $06
+219d : 38 __ __ SEC
+219e : a5 05 __ LDA $05
+21a0 : e5 03 __ SBC $03
+21a2 : aa __ __ TAX
+21a3 : a5 06 __ LDA $06
+21a5 : e5 04 __ SBC $04
+21a7 : 90 04 __ BCC $21ad
+21a9 : 86 05 __ STX $05
+21ab : 85 06 __ STA $06
+21ad : 88 __ __ DEY
+21ae : d0 e5 __ BNE $2195
+21b0 : 26 1b __ ROL ACCU + 0
+21b2 : 26 1c __ ROL ACCU + 1
+21b4 : a4 02 __ LDY $02
+21b6 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+21b7 : 24 1c __ BIT ACCU + 1
+21b9 : 10 0d __ BPL $21c8
+21bb : 20 16 21 JSR $2116 ; (negaccu + 0)
+21be : 24 04 __ BIT $04
+21c0 : 10 0d __ BPL $21cf
+21c2 : 20 24 21 JSR $2124 ; (negtmp + 0)
+21c5 : 4c 32 21 JMP $2132 ; (divmod + 0)
+21c8 : 24 04 __ BIT $04
+21ca : 10 f9 __ BPL $21c5
+21cc : 20 24 21 JSR $2124 ; (negtmp + 0)
+21cf : 20 32 21 JSR $2132 ; (divmod + 0)
+21d2 : 38 __ __ SEC
+21d3 : a9 00 __ LDA #$00
+21d5 : e5 05 __ SBC $05
+21d7 : 85 05 __ STA $05
+21d9 : a9 00 __ LDA #$00
+21db : e5 06 __ SBC $06
+21dd : 85 06 __ STA $06
+21df : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+21e0 : 20 f3 1e JSR $1ef3 ; (freg + 36)
+21e3 : a5 07 __ LDA $07
+21e5 : c9 7f __ CMP #$7f
+21e7 : b0 07 __ BCS $21f0
+21e9 : a9 00 __ LDA #$00
+21eb : 85 1b __ STA ACCU + 0
+21ed : 85 1c __ STA ACCU + 1
+21ef : 60 __ __ RTS
+21f0 : 38 __ __ SEC
+21f1 : e9 8e __ SBC #$8e
+21f3 : 90 0a __ BCC $21ff
+21f5 : a9 ff __ LDA #$ff
+21f7 : 85 1b __ STA ACCU + 0
+21f9 : a9 7f __ LDA #$7f
+21fb : 85 1c __ STA ACCU + 1
+21fd : d0 08 __ BNE $2207
+21ff : aa __ __ TAX
+2200 : 46 1d __ LSR ACCU + 2
+2202 : 66 1c __ ROR ACCU + 1
+2204 : e8 __ __ INX
+2205 : d0 f9 __ BNE $2200
+2207 : 24 1e __ BIT ACCU + 3
+2209 : 10 0e __ BPL $2219
+220b : 38 __ __ SEC
+220c : a9 00 __ LDA #$00
+220e : e5 1c __ SBC ACCU + 1
+2210 : 85 1b __ STA ACCU + 0
+2212 : a9 00 __ LDA #$00
+2214 : e5 1d __ SBC ACCU + 2
+2216 : 85 1c __ STA ACCU + 1
+2218 : 60 __ __ RTS
+2219 : a5 1c __ LDA ACCU + 1
+221b : 85 1b __ STA ACCU + 0
+221d : a5 1d __ LDA ACCU + 2
+221f : 85 1c __ STA ACCU + 1
+2221 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2222 : 24 1c __ BIT ACCU + 1
+2224 : 30 03 __ BMI $2229
+2226 : 4c 40 22 JMP $2240 ; (uint16_to_float + 0)
+2229 : 38 __ __ SEC
+222a : a9 00 __ LDA #$00
+222c : e5 1b __ SBC ACCU + 0
+222e : 85 1b __ STA ACCU + 0
+2230 : a9 00 __ LDA #$00
+2232 : e5 1c __ SBC ACCU + 1
+2234 : 85 1c __ STA ACCU + 1
+2236 : 20 40 22 JSR $2240 ; (uint16_to_float + 0)
+2239 : a5 1e __ LDA ACCU + 3
+223b : 09 80 __ ORA #$80
+223d : 85 1e __ STA ACCU + 3
+223f : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+2240 : a5 1b __ LDA ACCU + 0
+2242 : 05 1c __ ORA ACCU + 1
+2244 : d0 05 __ BNE $224b
+2246 : 85 1d __ STA ACCU + 2
+2248 : 85 1e __ STA ACCU + 3
+224a : 60 __ __ RTS
+224b : a2 8e __ LDX #$8e
+224d : a5 1c __ LDA ACCU + 1
+224f : 30 06 __ BMI $2257
+2251 : ca __ __ DEX
+2252 : 06 1b __ ASL ACCU + 0
+2254 : 2a __ __ ROL
+2255 : 10 fa __ BPL $2251
+2257 : 29 7f __ AND #$7f
+2259 : 85 1d __ STA ACCU + 2
+225b : a5 1b __ LDA ACCU + 0
+225d : 85 1c __ STA ACCU + 1
+225f : 8a __ __ TXA
+2260 : 4a __ __ LSR
+2261 : 85 1e __ STA ACCU + 3
+2263 : a9 00 __ LDA #$00
+2265 : 85 1b __ STA ACCU + 0
+2267 : 6a __ __ ROR
+2268 : 05 1d __ ORA ACCU + 2
+226a : 85 1d __ STA ACCU + 2
+226c : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+226d : a5 1e __ LDA ACCU + 3
+226f : 45 06 __ EOR $06
+2271 : 29 80 __ AND #$80
+2273 : f0 1e __ BEQ $2293
+2275 : a5 1e __ LDA ACCU + 3
+2277 : 29 7f __ AND #$7f
+2279 : 05 1d __ ORA ACCU + 2
+227b : 05 1c __ ORA ACCU + 1
+227d : 05 1b __ ORA ACCU + 0
+227f : d0 0c __ BNE $228d
+2281 : a5 06 __ LDA $06
+2283 : 29 7f __ AND #$7f
+2285 : 05 05 __ ORA $05
+2287 : 05 04 __ ORA $04
+2289 : 05 03 __ ORA $03
+228b : f0 1e __ BEQ $22ab
+228d : a5 1e __ LDA ACCU + 3
+228f : 30 23 __ BMI $22b4
+2291 : 10 28 __ BPL $22bb
+2293 : a5 1e __ LDA ACCU + 3
+2295 : c5 06 __ CMP $06
+2297 : d0 15 __ BNE $22ae
+2299 : a5 1d __ LDA ACCU + 2
+229b : c5 05 __ CMP $05
+229d : d0 0f __ BNE $22ae
+229f : a5 1c __ LDA ACCU + 1
+22a1 : c5 04 __ CMP $04
+22a3 : d0 09 __ BNE $22ae
+22a5 : a5 1b __ LDA ACCU + 0
+22a7 : c5 03 __ CMP $03
+22a9 : d0 03 __ BNE $22ae
+22ab : a9 00 __ LDA #$00
+22ad : 60 __ __ RTS
+22ae : b0 07 __ BCS $22b7
+22b0 : 24 1e __ BIT ACCU + 3
+22b2 : 30 07 __ BMI $22bb
+22b4 : a9 01 __ LDA #$01
+22b6 : 60 __ __ RTS
+22b7 : 24 1e __ BIT ACCU + 3
+22b9 : 30 f9 __ BMI $22b4
+22bb : a9 ff __ LDA #$ff
+22bd : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+22be : 84 02 __ STY $02
+22c0 : a9 00 __ LDA #$00
+22c2 : 85 07 __ STA $07
+22c4 : 85 08 __ STA $08
+22c6 : 85 09 __ STA $09
+22c8 : 85 0a __ STA $0a
+22ca : a0 20 __ LDY #$20
+22cc : 18 __ __ CLC
+22cd : 26 1b __ ROL ACCU + 0
+22cf : 26 1c __ ROL ACCU + 1
+22d1 : 26 1d __ ROL ACCU + 2
+22d3 : 26 1e __ ROL ACCU + 3
+22d5 : 26 07 __ ROL $07
+22d7 : 26 08 __ ROL $08
+22d9 : 26 09 __ ROL $09
+22db : 26 0a __ ROL $0a
+22dd : a5 07 __ LDA $07
+22df : c5 03 __ CMP $03
+22e1 : a5 08 __ LDA $08
+22e3 : e5 04 __ SBC $04
+22e5 : a5 09 __ LDA $09
+22e7 : e5 05 __ SBC $05
+22e9 : a5 0a __ LDA $0a
+22eb : e5 06 __ SBC $06
+22ed : 90 18 __ BCC $2307
+22ef : a5 07 __ LDA $07
+22f1 : e5 03 __ SBC $03
+22f3 : 85 07 __ STA $07
+22f5 : a5 08 __ LDA $08
+22f7 : e5 04 __ SBC $04
+22f9 : 85 08 __ STA $08
+22fb : a5 09 __ LDA $09
+22fd : e5 05 __ SBC $05
+22ff : 85 09 __ STA $09
+2301 : a5 0a __ LDA $0a
+2303 : e5 06 __ SBC $06
+2305 : 85 0a __ STA $0a
+2307 : 88 __ __ DEY
+2308 : d0 c3 __ BNE $22cd
+230a : 26 1b __ ROL ACCU + 0
+230c : 26 1c __ ROL ACCU + 1
+230e : 26 1d __ ROL ACCU + 2
+2310 : 26 1e __ ROL ACCU + 3
+2312 : a4 02 __ LDY $02
+2314 : 60 __ __ RTS
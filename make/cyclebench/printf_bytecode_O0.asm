@@ -0,0 +1,3000 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 87 21 STX $2187 ; (spentry + 0)
+0811 : a9 89 __ LDA #$89
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ed __ LDA #$ed
+0832 : e9 89 __ SBC #$89
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	LEA	T2, buffer + 0
+0a11:	MOV	2(SP), T2
+0a14:	LEA	T3, $1503
+0a18:	MOV	4(SP), T3
+0a1b:	MOV	ACCU, #$014b
+0a1f:	MUL	ACCU, T1
+0a21:	ADD	ACCU, #$C180
+0a25:	MOV	6(SP), ACCU
+0a28:	MOV	ACCU, #$0269
+0a2c:	MUL	ACCU, T1
+0a2e:	MOV	8(SP), ACCU
+0a31:	MOV	ACCU, T1
+0a33:	MUL	ACCU, #97
+0a36:	MOV	10(SP), ACCU
+0a39:	MOV	12(SP), T1
+0a3c:	MOV	ACCU, T1
+0a3e:	NEG	ACCU
+0a3f:	MOV	14(SP), ACCU
+0a42:	LEA	T3, $1518
+0a46:	MOV	16(SP), T3
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	ACCU, T2
+0a4e:	MOV	P0, ACCU
+0a50:	JSR	strlen + 0
+0a53:	ADD	T0, ACCU
+0a55:	MOVUB	ACCU, buffer + 0
+0a59:	BNEF	$0AEB
+0a5c:	ADD	T1, #$0001
+0a60:	MOV	ACCU, T1
+0a62:	CMPS	ACCU, #$0064
+0a65:	BGT	$0A0D
+0a67:	MOV	T1, #0
+0a6a:	LEA	T2, $154e
+0a6e:	LEA	T3, buffer + 0
+0a72:	MOV	2(SP), T3
+0a75:	MOV	4(SP), T2
+0a78:	MOV	ACCU, T1
+0a7a:	CNVSF	ACCU
+0a7b:	MOVD	T6, ACCU
+0a7d:	MOVD	$03, #$3fa00000
+0a83:	MULF	ACCU, $03
+0a85:	MOVD	6(SP), ACCU
+0a88:	MOVD	ACCU, T6
+0a8a:	MOVD	$03, #$bd800000
+0a90:	MULF	ACCU, $03
+0a92:	MOVD	10(SP), ACCU
+0a95:	CALL	sprintf + 0
+0a98:	MOV	ACCU, T3
+0a9a:	MOV	P0, ACCU
+0a9c:	JSR	strlen + 0
+0a9f:	ADD	T1, #$0001
+0aa3:	ADD	T0, ACCU
+0aa5:	MOV	ACCU, T1
+0aa7:	CMPS	ACCU, #$0014
+0aaa:	BGT	$0A72
+0aac:	MOV	2(SP), T3
+0aaf:	LEA	T1, $1557
+0ab3:	MOV	4(SP), T1
+0ab6:	MOV	ACCU, #-123
+0ab9:	MOV	6(SP), ACCU
+0abc:	LEA	T1, $1560
+0ac0:	MOV	8(SP), T1
+0ac3:	MOV	ACCU, #$beef
+0ac7:	MOV	10(SP), ACCU
+0aca:	CALL	sprintf + 0
+0acd:	MOV	ACCU, T3
+0acf:	MOV	P0, ACCU
+0ad1:	LEA	P2, $1594
+0ad5:	JSR	strcmp + 0
+0ad8:	BNE	$0AE1
+0ada:	MOV	ACCU, T0
+0adc:	SEQ
+0add:	MOVB	T4, ACCU
+0adf:	JUMP	$0AE4
+0ae1:	MOV	ACCU, #1
+0ae4:	POP	#$0012
+0ae7:	RETURN	8, 10
+0aeb:	MOV	T2, #0
+0aee:	LEAX	ADDR, buffer + 0 + T2
+0af2:	MOVB	T4, 0(ADDR)
+0af5:	LEAX	ADDR, buffer + 1 + T2
+0af9:	MOVB	ACCU, T4
+0afb:	ADD	T0, ACCU
+0afd:	MOVUB	ACCU, 0(ADDR)
+0b00:	ADD	T2, #$0001
+0b04:	BNE	$0AEE
+0b06:	JUMPF	$0A5C
+--------------------------------------------------------------------
+sprintf:
+0b09:	ENTER	0, 2
+0b0d:	PUSH	#$0009
+0b10:	MOV	T0, 2(FP)
+0b13:	MOV	2(SP), T0
+0b16:	MOV	T0, 4(FP)
+0b19:	MOV	4(SP), T0
+0b1c:	LEA	T0, 6(FP)
+0b20:	MOV	6(SP), T0
+0b23:	MOV	ACCU, #0
+0b26:	MOVB	8(SP), ACCU
+0b29:	CALL	sformat + 0
+0b2c:	MOV	T1, 2(FP)
+0b2f:	SUB	ACCU, T1
+0b31:	POP	#$0009
+0b34:	RETURN	0, 2
+--------------------------------------------------------------------
+sformat:
+0b38:	ENTER	6, 16
+0b3c:	PUSH	#$0002
+0b3f:	MOV	T0, 10(FP)
+0b42:	MOVB	T1, #0
+0b45:	MOV	T2, 12(FP)
+0b48:	MOV	ADDR, T2
+0b4a:	MOVB	T3, 0(ADDR)
+0b4d:	MOVB	ACCU, T3
+0b4f:	BNE	$0B80
+0b51:	MOVB	ACCU, T1
+0b53:	ADD	ACCU, T0
+0b55:	MOV	T2, ACCU
+0b57:	MOV	ACCU, #0
+0b5a:	MOV	ADDR, T2
+0b5c:	MOVB	0(ADDR), ACCU
+0b5f:	MOVB	ACCU, T1
+0b61:	BNE	$0B6C
+0b63:	MOV	ACCU, T0
+0b65:	POP	#$0002
+0b68:	RETURN	6, 16
+0b6c:	MOVUB	ACCU, 16(FP)
+0b6f:	BNE	$0B75
+0b71:	MOV	ACCU, T2
+0b73:	JUMP	$0B65
+0b75:	MOV	ACCU, T0
+0b77:	MOV	P0, ACCU
+0b79:	CALL	puts + 0
+0b7c:	MOV	ACCU, T0
+0b7e:	JUMP	$0B65
+0b80:	ADD	T2, #$0001
+0b84:	MOVB	ACCU, T3
+0b86:	CMPUB	ACCU, #$0025
+0b88:	BEQ	$0BD5
+0b8a:	MOVB	ACCU, T1
+0b8c:	LEAX	ADDR, T0 + ACCU
+0b8e:	MOVB	0(ADDR), T3
+0b91:	ADDB	T1, #$0001
+0b94:	MOVB	ACCU, T1
+0b96:	CMPUB	ACCU, #$0028
+0b98:	BLE	$0BAB
+0b9a:	MOV	ADDR, T2
+0b9c:	MOVB	T4, 0(ADDR)
+0b9f:	ADD	T2, #$0001
+0ba3:	MOVB	ACCU, T4
+0ba5:	MOVB	T3, ACCU
+0ba7:	BNE	$0B84
+0ba9:	JUMP	$0B51
+0bab:	MOVB	ACCU, T1
+0bad:	MOV	T5, ACCU
+0baf:	MOVUB	ACCU, 16(FP)
+0bb2:	BNE	$0BBD
+0bb4:	MOV	ACCU, T5
+0bb6:	ADD	T0, ACCU
+0bb8:	MOVB	T1, #0
+0bbb:	JUMP	$0B9A
+0bbd:	MOV	ACCU, T0
+0bbf:	ADD	T5, ACCU
+0bc1:	MOV	ADDR, T5
+0bc3:	MOV	ACCU, #0
+0bc6:	MOVB	0(ADDR), ACCU
+0bc9:	MOV	ACCU, T0
+0bcb:	MOV	P0, ACCU
+0bcd:	CALL	puts + 0
+0bd0:	MOVB	T1, #0
+0bd3:	JUMP	$0B9A
+0bd5:	MOVB	ACCU, T1
+0bd7:	BNEF	$0E9D
+0bda:	MOV	ADDR, T2
+0bdc:	MOVB	T3, 0(ADDR)
+0bdf:	MOV	ACCU, #10
+0be2:	MOV	3(FP), ACCU
+0be5:	MOV	ACCU, #1
+0be8:	MOVB	1(FP), ACCU
+0beb:	MOV	ACCU, #255
+0bee:	MOVB	2(FP), ACCU
+0bf1:	MOV	ACCU, #32
+0bf4:	MOVB	0(FP), ACCU
+0bf7:	MOV	ACCU, #0
+0bfa:	MOVB	5(FP), ACCU
+0bfd:	MOVB	6(FP), ACCU
+0c00:	MOVB	7(FP), ACCU
+0c03:	ADD	T2, #$0001
+0c07:	MOVB	ACCU, T3
+0c09:	CMPUB	ACCU, #$002B
+0c0b:	BEQF	$0E8F
+0c0e:	MOVB	ACCU, T3
+0c10:	CMPUB	ACCU, #$0030
+0c12:	BEQF	$0E81
+0c15:	MOVB	ACCU, T3
+0c17:	CMPUB	ACCU, #$0023
+0c19:	BEQF	$0E73
+0c1c:	MOVB	ACCU, T3
+0c1e:	CMPUB	ACCU, #$0030
+0c20:	BGT	$0C29
+0c22:	MOVB	ACCU, T3
+0c24:	CMPUB	ACCU, #$0039
+0c26:	BGEF	$0E42
+0c29:	MOVB	ACCU, T3
+0c2b:	CMPUB	ACCU, #$002E
+0c2d:	BEQF	$0E08
+0c30:	MOVB	ACCU, T3
+0c32:	CMPUB	ACCU, #$0064
+0c34:	BEQF	$0DE4
+0c37:	MOVB	ACCU, T3
+0c39:	CMPUB	ACCU, #$0075
+0c3b:	BEQF	$0DC0
+0c3e:	MOVB	ACCU, T3
+0c40:	CMPUB	ACCU, #$0078
+0c42:	BEQF	$0D96
+0c45:	MOVB	ACCU, T3
+0c47:	CMPUB	ACCU, #$006C
+0c49:	BEQF	$0D17
+0c4c:	MOVB	ACCU, T3
+0c4e:	CMPUB	ACCU, #$0066
+0c50:	BEQF	$0CE6
+0c53:	MOVB	ACCU, T3
+0c55:	CMPUB	ACCU, #$0067
+0c57:	BEQF	$0CE6
+0c5a:	MOVB	ACCU, T3
+0c5c:	CMPUB	ACCU, #$0065
+0c5e:	BEQF	$0CE6
+0c61:	MOVB	ACCU, T3
+0c63:	CMPUB	ACCU, #$0073
+0c65:	BEQ	$0C9D
+0c67:	MOVB	ACCU, T3
+0c69:	CMPUB	ACCU, #$0063
+0c6b:	BEQ	$0C7F
+0c6d:	MOVB	ACCU, T3
+0c6f:	BEQF	$0B9A
+0c72:	MOVB	ACCU, T1
+0c74:	LEAX	ADDR, T0 + ACCU
+0c76:	MOVB	0(ADDR), T3
+0c79:	ADDB	T1, #$0001
+0c7c:	JUMPF	$0B9A
+0c7f:	MOV	T5, 14(FP)
+0c82:	MOV	ACCU, T5
+0c84:	MOV	ADDR, T5
+0c86:	MOV	T5, 0(ADDR)
+0c89:	ADD	ACCU, #$0002
+0c8d:	MOV	14(FP), ACCU
+0c90:	MOVB	ACCU, T1
+0c92:	LEAX	ADDR, T0 + ACCU
+0c94:	MOVB	0(ADDR), T5
+0c97:	ADDB	T1, #$0001
+0c9a:	JUMPF	$0B9A
+0c9d:	MOV	T5, 14(FP)
+0ca0:	MOV	ACCU, T5
+0ca2:	MOV	ADDR, T5
+0ca4:	MOV	T5, 0(ADDR)
+0ca7:	ADD	ACCU, #$0002
+0cab:	MOV	14(FP), ACCU
+0cae:	MOVUB	ACCU, 16(FP)
+0cb1:	BNE	$0CDC
+0cb3:	MOV	ADDR, T5
+0cb5:	MOVB	T3, 0(ADDR)
+0cb8:	MOVB	ACCU, T3
+0cba:	BEQF	$0B9A
+0cbd:	ADD	T5, #$0001
+0cc1:	MOV	ADDR, T0
+0cc3:	MOVB	0(ADDR), T3
+0cc6:	ADD	T0, #$0001
+0cca:	MOV	ADDR, T5
+0ccc:	MOVB	T4, 0(ADDR)
+0ccf:	ADD	T5, #$0001
+0cd3:	MOVB	ACCU, T4
+0cd5:	MOVB	T3, ACCU
+0cd7:	BNE	$0CC1
+0cd9:	JUMPF	$0B9A
+0cdc:	MOV	ACCU, T5
+0cde:	MOV	P0, ACCU
+0ce0:	CALL	puts + 0
+0ce3:	JUMPF	$0B9A
+0ce6:	LEA	P0, 0(FP)
+0cea:	MOV	ACCU, T0
+0cec:	MOV	P2, ACCU
+0cee:	MOV	ADDR, 14(FP)
+0cf1:	MOVD	T7, 0(ADDR)
+0cf4:	MOVD	ACCU, T7
+0cf6:	MOVD	P4, ACCU
+0cf8:	MOVB	ACCU, T3
+0cfa:	MOVB	P8, ACCU
+0cfc:	CALL	nformf + 0
+0cff:	MOV	T1, ACCU
+0d01:	MOV	T5, 14(FP)
+0d04:	MOV	ACCU, T5
+0d06:	ADD	ACCU, #$0002
+0d0a:	MOV	14(FP), ACCU
+0d0d:	ADD	T5, #$0004
+0d11:	MOV	14(FP), T5
+0d14:	JUMPF	$0B9A
+0d17:	MOV	T5, 14(FP)
+0d1a:	MOV	ADDR, T5
+0d1c:	MOVD	T7, 0(ADDR)
+0d1f:	MOV	ACCU, T5
+0d21:	ADD	ACCU, #$0002
+0d25:	MOV	14(FP), ACCU
+0d28:	ADD	T5, #$0004
+0d2c:	MOV	14(FP), T5
+0d2f:	MOV	ADDR, T2
+0d31:	MOVB	T3, 0(ADDR)
+0d34:	ADD	T2, #$0001
+0d38:	MOVB	ACCU, T3
+0d3a:	CMPUB	ACCU, #$0064
+0d3c:	BEQ	$0D7F
+0d3e:	MOVB	ACCU, T3
+0d40:	CMPUB	ACCU, #$0075
+0d42:	BEQ	$0D68
+0d44:	MOVB	ACCU, T3
+0d46:	CMPUB	ACCU, #$0078
+0d48:	BNEF	$0B9A
+0d4b:	MOV	ACCU, #16
+0d4e:	MOV	3(FP), ACCU
+0d51:	LEA	P0, 0(FP)
+0d55:	MOV	ACCU, T0
+0d57:	MOV	P2, ACCU
+0d59:	MOVD	ACCU, T7
+0d5b:	MOVD	P4, ACCU
+0d5d:	MOVB	P8, #0
+0d60:	CALL	nforml + 0
+0d63:	MOV	T1, ACCU
+0d65:	JUMPF	$0B9A
+0d68:	LEA	P0, 0(FP)
+0d6c:	MOV	ACCU, T0
+0d6e:	MOV	P2, ACCU
+0d70:	MOVD	ACCU, T7
+0d72:	MOVD	P4, ACCU
+0d74:	MOVB	P8, #0
+0d77:	CALL	nforml + 0
+0d7a:	MOV	T1, ACCU
+0d7c:	JUMPF	$0B9A
+0d7f:	LEA	P0, 0(FP)
+0d83:	MOV	ACCU, T0
+0d85:	MOV	P2, ACCU
+0d87:	MOVD	ACCU, T7
+0d89:	MOVD	P4, ACCU
+0d8b:	MOVB	P8, #1
+0d8e:	CALL	nforml + 0
+0d91:	MOV	T1, ACCU
+0d93:	JUMPF	$0B9A
+0d96:	MOV	ACCU, #16
+0d99:	MOV	3(FP), ACCU
+0d9c:	LEA	P0, 0(FP)
+0da0:	MOV	ACCU, T0
+0da2:	MOV	P2, ACCU
+0da4:	MOV	T5, 14(FP)
+0da7:	MOV	ACCU, T5
+0da9:	MOV	ADDR, T5
+0dab:	MOV	P4, 0(ADDR)
+0dae:	ADD	ACCU, #$0002
+0db2:	MOV	14(FP), ACCU
+0db5:	MOVB	P6, #0
+0db8:	CALL	nformi + 0
+0dbb:	MOV	T1, ACCU
+0dbd:	JUMPF	$0B9A
+0dc0:	LEA	P0, 0(FP)
+0dc4:	MOV	ACCU, T0
+0dc6:	MOV	P2, ACCU
+0dc8:	MOV	T5, 14(FP)
+0dcb:	MOV	ACCU, T5
+0dcd:	MOV	ADDR, T5
+0dcf:	MOV	P4, 0(ADDR)
+0dd2:	ADD	ACCU, #$0002
+0dd6:	MOV	14(FP), ACCU
+0dd9:	MOVB	P6, #0
+0ddc:	CALL	nformi + 0
+0ddf:	MOV	T1, ACCU
+0de1:	JUMPF	$0B9A
+0de4:	LEA	P0, 0(FP)
+0de8:	MOV	ACCU, T0
+0dea:	MOV	P2, ACCU
+0dec:	MOV	T5, 14(FP)
+0def:	MOV	ACCU, T5
+0df1:	MOV	ADDR, T5
+0df3:	MOV	P4, 0(ADDR)
+0df6:	ADD	ACCU, #$0002
+0dfa:	MOV	14(FP), ACCU
+0dfd:	MOVB	P6, #1
+0e00:	CALL	nformi + 0
+0e03:	MOV	T1, ACCU
+0e05:	JUMPF	$0B9A
+0e08:	MOV	T5, #0
+0e0b:	MOV	ADDR, T2
+0e0d:	MOVB	T3, 0(ADDR)
+0e10:	ADD	T2, #$0001
+0e14:	MOVB	ACCU, T3
+0e16:	CMPUB	ACCU, #$0030
+0e18:	BGT	$0E3C
+0e1a:	MOVB	ACCU, T3
+0e1c:	CMPUB	ACCU, #$0039
+0e1e:	BLT	$0E3C
+0e20:	MOVB	ACCU, T3
+0e22:	MOV	T6, ACCU
+0e24:	MOV	ADDR, T2
+0e26:	MOVB	T3, 0(ADDR)
+0e29:	ADD	T2, #$0001
+0e2d:	MUL	T5, #10
+0e30:	ADD	T5, ACCU
+0e32:	ADD	T5, #$FFD0
+0e36:	MOVB	ACCU, T3
+0e38:	CMPUB	ACCU, #$0030
+0e3a:	BLE	$0E1A
+0e3c:	MOVB	2(FP), T5
+0e3f:	JUMPF	$0C30
+0e42:	MOV	T5, #0
+0e45:	MOVB	ACCU, T3
+0e47:	CMPUB	ACCU, #$0030
+0e49:	BGT	$0E6D
+0e4b:	MOVB	ACCU, T3
+0e4d:	CMPUB	ACCU, #$0039
+0e4f:	BLT	$0E6D
+0e51:	MOVB	ACCU, T3
+0e53:	MOV	T6, ACCU
+0e55:	MOV	ADDR, T2
+0e57:	MOVB	T3, 0(ADDR)
+0e5a:	ADD	T2, #$0001
+0e5e:	MUL	T5, #10
+0e61:	ADD	T5, ACCU
+0e63:	ADD	T5, #$FFD0
+0e67:	MOVB	ACCU, T3
+0e69:	CMPUB	ACCU, #$0030
+0e6b:	BLE	$0E4B
+0e6d:	MOVB	1(FP), T5
+0e70:	JUMPF	$0C29
+0e73:	MOV	ACCU, #1
+0e76:	MOVB	7(FP), ACCU
+0e79:	MOV	ADDR, T2
+0e7b:	MOVB	T3, 0(ADDR)
+0e7e:	JUMPF	$0C03
+0e81:	MOV	ACCU, #48
+0e84:	MOVB	0(FP), ACCU
+0e87:	MOV	ADDR, T2
+0e89:	MOVB	T3, 0(ADDR)
+0e8c:	JUMPF	$0C03
+0e8f:	MOV	ACCU, #1
+0e92:	MOVB	5(FP), ACCU
+0e95:	MOV	ADDR, T2
+0e97:	MOVB	T3, 0(ADDR)
+0e9a:	JUMPF	$0C03
+0e9d:	MOVUB	ACCU, 16(FP)
+0ea0:	BNE	$0EAC
+0ea2:	MOVB	ACCU, T1
+0ea4:	ADD	T0, ACCU
+0ea6:	MOVB	T1, #0
+0ea9:	JUMPF	$0BDA
+0eac:	MOVB	ACCU, T1
+0eae:	LEAX	ADDR, T0 + ACCU
+0eb0:	MOV	ACCU, #0
+0eb3:	MOVB	0(ADDR), ACCU
+0eb6:	MOV	ACCU, T0
+0eb8:	MOV	P0, ACCU
+0eba:	CALL	puts + 0
+0ebd:	MOVB	T1, #0
+0ec0:	JUMPF	$0BDA
+--------------------------------------------------------------------
+puts:
+0ec3:	ENTER	0, 2
+0ec7:	JSR	$0ece
+0eca:	RETURN	0, 2
+--------------------------------------------------------------------
+0ece : a0 00 __ LDY #$00
+0ed0 : b1 0d __ LDA (P0),y
+0ed2 : f0 0b __ BEQ $0edf
+0ed4 : 20 e0 0e JSR $0ee0 ; (putpch + 0)
+0ed7 : e6 0d __ INC P0
+0ed9 : d0 f3 __ BNE $0ece
+0edb : e6 0e __ INC P1
+0edd : d0 ef __ BNE $0ece
+0edf : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+0ee0 : ae 88 21 LDX $2188 ; (giocharmap + 0)
+0ee3 : e0 01 __ CPX #$01
+0ee5 : 90 22 __ BCC $0f09
+0ee7 : c9 0a __ CMP #$0a
+0ee9 : d0 02 __ BNE $0eed
+0eeb : a9 0d __ LDA #$0d
+0eed : e0 02 __ CPX #$02
+0eef : 90 18 __ BCC $0f09
+0ef1 : c9 41 __ CMP #$41
+0ef3 : 90 14 __ BCC $0f09
+0ef5 : c9 7b __ CMP #$7b
+0ef7 : b0 10 __ BCS $0f09
+0ef9 : c9 61 __ CMP #$61
+0efb : b0 04 __ BCS $0f01
+0efd : c9 5b __ CMP #$5b
+0eff : b0 08 __ BCS $0f09
+0f01 : 49 20 __ EOR #$20
+0f03 : e0 03 __ CPX #$03
+0f05 : f0 02 __ BEQ $0f09
+0f07 : 29 df __ AND #$df
+0f09 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+0f0c:	ENTER	0, 2
+0f10:	MOV	ACCU, P4
+0f12:	MOV	T0, ACCU
+0f14:	MOV	T1, ACCU
+0f16:	MOV	ACCU, P2
+0f18:	MOV	T2, ACCU
+0f1a:	MOVB	T3, #0
+0f1d:	MOVB	ACCU, P6
+0f1f:	BEQ	$0F26
+0f21:	MOV	ACCU, T0
+0f23:	BLTF	$1043
+0f26:	MOVB	T4, #10
+0f29:	MOV	ACCU, T0
+0f2b:	BNEF	$100B
+0f2e:	MOV	ADDR, P0
+0f30:	MOVB	T5, 2(ADDR)
+0f33:	MOVB	ACCU, T5
+0f35:	CMPUB	ACCU, #$00FF
+0f37:	BNEF	$0FFB
+0f3a:	MOVB	T5, #9
+0f3d:	MOVB	ACCU, T4
+0f3f:	CMPUB	ACCU, #$0009
+0f41:	BGE	$0F56
+0f43:	ADDB	T4, #$00FF
+0f46:	MOVB	ACCU, T4
+0f48:	LEAX	ADDR, T2 + ACCU
+0f4a:	MOV	ACCU, #48
+0f4d:	MOVB	0(ADDR), ACCU
+0f50:	MOVB	ACCU, T5
+0f52:	CMPUB	ACCU, T4
+0f54:	BGT	$0F43
+0f56:	MOV	ACCU, P0
+0f58:	MOV	T0, ACCU
+0f5a:	MOV	ADDR, T0
+0f5c:	MOVUB	ACCU, 7(ADDR)
+0f5f:	BEQ	$0F85
+0f61:	MOV	ACCU, 3(ADDR)
+0f64:	CMPU	ACCU, #$0010
+0f67:	BNE	$0F85
+0f69:	MOVB	ACCU, T4
+0f6b:	ADDB	ACCU, #$00FF
+0f6e:	MOVB	ACCU, ACCU
+0f70:	LEAX	ADDR, T2 + ACCU
+0f72:	MOV	ACCU, #88
+0f75:	MOVB	0(ADDR), ACCU
+0f78:	ADDB	T4, #$00FE
+0f7b:	MOVB	ACCU, T4
+0f7d:	LEAX	ADDR, T2 + ACCU
+0f7f:	MOV	ACCU, #48
+0f82:	MOVB	0(ADDR), ACCU
+0f85:	MOVB	ACCU, T3
+0f87:	BNE	$0FEC
+0f89:	MOV	ADDR, T0
+0f8b:	MOVUB	ACCU, 5(ADDR)
+0f8e:	BEQ	$0F9D
+0f90:	ADDB	T4, #$00FF
+0f93:	MOVB	ACCU, T4
+0f95:	LEAX	ADDR, T2 + ACCU
+0f97:	MOV	ACCU, #43
+0f9a:	MOVB	0(ADDR), ACCU
+0f9d:	MOV	ACCU, P0
+0f9f:	MOV	T0, ACCU
+0fa1:	MOV	ADDR, T0
+0fa3:	MOVUB	T1, 1(ADDR)
+0fa6:	SUBR	T1, #$000A
+0faa:	MOVB	ACCU, T4
+0fac:	MOV	T6, ACCU
+0fae:	MOV	ACCU, T1
+0fb0:	CMPS	ACCU, T6
+0fb2:	BGT	$0FDD
+0fb4:	MOVB	T3, #0
+0fb7:	MOVB	ACCU, T4
+0fb9:	CMPUB	ACCU, #$000A
+0fbb:	BLE	$0FD7
+0fbd:	MOVB	ACCU, T4
+0fbf:	LEAX	ADDR, T2 + ACCU
+0fc1:	MOVB	T5, 0(ADDR)
+0fc4:	MOVB	ACCU, T3
+0fc6:	LEAX	ADDR, T2 + ACCU
+0fc8:	MOVB	0(ADDR), T5
+0fcb:	ADDB	T3, #$0001
+0fce:	ADDB	T4, #$0001
+0fd1:	MOVB	ACCU, T4
+0fd3:	CMPUB	ACCU, #$000A
+0fd5:	BGT	$0FBD
+0fd7:	MOVB	ACCU, T3
+0fd9:	RETURN	0, 2
+0fdd:	MOVB	T3, 0(ADDR)
+0fe0:	ADDB	T4, #$00FF
+0fe3:	MOVB	ACCU, T4
+0fe5:	LEAX	ADDR, T2 + ACCU
+0fe7:	MOVB	0(ADDR), T3
+0fea:	JUMP	$0F9D
+0fec:	ADDB	T4, #$00FF
+0fef:	MOVB	ACCU, T4
+0ff1:	LEAX	ADDR, T2 + ACCU
+0ff3:	MOV	ACCU, #45
+0ff6:	MOVB	0(ADDR), ACCU
+0ff9:	JUMP	$0F9D
+0ffb:	MOVB	ACCU, T5
+0ffd:	SUBR	ACCU, #$000A
+1001:	MOV	T5, ACCU
+1003:	CMPUB	ACCU, T4
+1005:	BGTF	$0F43
+1008:	JUMPF	$0F56
+100b:	MOV	ACCU, P0
+100d:	MOV	T0, ACCU
+100f:	MOV	ADDR, T0
+1011:	MOV	T6, 3(ADDR)
+1014:	MOV	ACCU, T1
+1016:	MODU	ACCU, T6
+1018:	MOV	T6, ACCU
+101a:	CMPS	ACCU, #$000A
+101d:	BLE	$1025
+101f:	ADD	T6, #$0030
+1023:	JUMP	$1029
+1025:	ADD	T6, #$0037
+1029:	ADDB	T4, #$00FF
+102c:	MOVB	ACCU, T4
+102e:	LEAX	ADDR, T2 + ACCU
+1030:	MOVB	0(ADDR), T6
+1033:	MOV	ADDR, T0
+1035:	MOV	T0, 3(ADDR)
+1038:	MOV	ACCU, T1
+103a:	DIVU	ACCU, T0
+103c:	MOV	T1, ACCU
+103e:	BNE	$100B
+1040:	JUMPF	$0F2E
+1043:	MOVB	T3, #1
+1046:	MOVB	T4, #10
+1049:	NEG	ACCU
+104a:	MOV	T1, ACCU
+104c:	BNE	$100B
+104e:	JUMPF	$0F2E
+--------------------------------------------------------------------
+nforml:
+1051:	ENTER	5, 7
+1055:	MOVD	ACCU, P4
+1057:	MOVD	T0, ACCU
+1059:	MOVD	T1, ACCU
+105b:	MOV	ACCU, P2
+105d:	MOV	T2, ACCU
+105f:	MOVB	T3, #0
+1062:	MOVB	ACCU, P8
+1064:	BEQ	$1073
+1066:	MOVD	ACCU, #$00000000
+106c:	EXTRT	T0, inp_op_cmp_s32 + 0
+1070:	BLTF	$11B8
+1073:	MOVB	T4, #16
+1076:	MOVD	ACCU, #$00000000
+107c:	EXTRT	T0, inp_op_cmp_u32 + 0
+1080:	BGTF	$1160
+1083:	MOV	ADDR, P0
+1085:	MOVB	T5, 2(ADDR)
+1088:	MOVB	ACCU, T5
+108a:	CMPUB	ACCU, #$00FF
+108c:	BNEF	$1150
+108f:	MOVB	T5, #15
+1092:	MOVB	ACCU, T4
+1094:	CMPUB	ACCU, #$000F
+1096:	BGE	$10AB
+1098:	ADDB	T4, #$00FF
+109b:	MOVB	ACCU, T4
+109d:	LEAX	ADDR, T2 + ACCU
+109f:	MOV	ACCU, #48
+10a2:	MOVB	0(ADDR), ACCU
+10a5:	MOVB	ACCU, T5
+10a7:	CMPUB	ACCU, T4
+10a9:	BGT	$1098
+10ab:	MOV	ACCU, P0
+10ad:	MOV	T6, ACCU
+10af:	MOV	ADDR, T6
+10b1:	MOVUB	ACCU, 7(ADDR)
+10b4:	BEQ	$10DA
+10b6:	MOV	ACCU, 3(ADDR)
+10b9:	CMPU	ACCU, #$0010
+10bc:	BNE	$10DA
+10be:	MOVB	ACCU, T4
+10c0:	ADDB	ACCU, #$00FF
+10c3:	MOVB	ACCU, ACCU
+10c5:	LEAX	ADDR, T2 + ACCU
+10c7:	MOV	ACCU, #88
+10ca:	MOVB	0(ADDR), ACCU
+10cd:	ADDB	T4, #$00FE
+10d0:	MOVB	ACCU, T4
+10d2:	LEAX	ADDR, T2 + ACCU
+10d4:	MOV	ACCU, #48
+10d7:	MOVB	0(ADDR), ACCU
+10da:	MOVB	ACCU, T3
+10dc:	BNE	$1141
+10de:	MOV	ADDR, T6
+10e0:	MOVUB	ACCU, 5(ADDR)
+10e3:	BEQ	$10F2
+10e5:	ADDB	T4, #$00FF
+10e8:	MOVB	ACCU, T4
+10ea:	LEAX	ADDR, T2 + ACCU
+10ec:	MOV	ACCU, #43
+10ef:	MOVB	0(ADDR), ACCU
+10f2:	MOV	ACCU, P0
+10f4:	MOV	T6, ACCU
+10f6:	MOV	ADDR, T6
+10f8:	MOVUB	T7, 1(ADDR)
+10fb:	SUBR	T7, #$0010
+10ff:	MOVB	ACCU, T4
+1101:	MOV	T8, ACCU
+1103:	MOV	ACCU, T7
+1105:	CMPS	ACCU, T8
+1107:	BGT	$1132
+1109:	MOVB	T3, #0
+110c:	MOVB	ACCU, T4
+110e:	CMPUB	ACCU, #$0010
+1110:	BLE	$112C
+1112:	MOVB	ACCU, T4
+1114:	LEAX	ADDR, T2 + ACCU
+1116:	MOVB	T5, 0(ADDR)
+1119:	MOVB	ACCU, T3
+111b:	LEAX	ADDR, T2 + ACCU
+111d:	MOVB	0(ADDR), T5
+1120:	ADDB	T3, #$0001
+1123:	ADDB	T4, #$0001
+1126:	MOVB	ACCU, T4
+1128:	CMPUB	ACCU, #$0010
+112a:	BGT	$1112
+112c:	MOVB	ACCU, T3
+112e:	RETURN	5, 7
+1132:	MOVB	T3, 0(ADDR)
+1135:	ADDB	T4, #$00FF
+1138:	MOVB	ACCU, T4
+113a:	LEAX	ADDR, T2 + ACCU
+113c:	MOVB	0(ADDR), T3
+113f:	JUMP	$10F2
+1141:	ADDB	T4, #$00FF
+1144:	MOVB	ACCU, T4
+1146:	LEAX	ADDR, T2 + ACCU
+1148:	MOV	ACCU, #45
+114b:	MOVB	0(ADDR), ACCU
+114e:	JUMP	$10F2
+1150:	MOVB	ACCU, T5
+1152:	SUBR	ACCU, #$0010
+1156:	MOV	T5, ACCU
+1158:	CMPUB	ACCU, T4
+115a:	BGTF	$1098
+115d:	JUMPF	$10AB
+1160:	MOV	ACCU, P0
+1162:	MOV	T6, ACCU
+1164:	MOV	ADDR, T6
+1166:	MOV	ACCU, 3(ADDR)
+1169:	EXTRT	$00, inp_op_ext_u16 + 0
+116d:	MOVD	T0, ACCU
+116f:	MOVD	ACCU, T1
+1171:	EXTRT	T0, inp_binop_mod_u32 + 0
+1175:	MOVD	T0, ACCU
+1177:	CMPS	ACCU, #$000A
+117a:	BLE	$1184
+117c:	MOV	ACCU, T0
+117e:	ADD	ACCU, #$0030
+1182:	JUMP	$118A
+1184:	MOV	ACCU, T0
+1186:	ADD	ACCU, #$0037
+118a:	MOV	T7, ACCU
+118c:	ADDB	T4, #$00FF
+118f:	MOVB	ACCU, T4
+1191:	LEAX	ADDR, T2 + ACCU
+1193:	MOVB	0(ADDR), T7
+1196:	MOV	ADDR, T6
+1198:	MOV	ACCU, 3(ADDR)
+119b:	EXTRT	$00, inp_op_ext_u16 + 0
+119f:	MOVD	T0, ACCU
+11a1:	MOVD	ACCU, T1
+11a3:	EXTRT	T0, inp_binop_div_u32 + 0
+11a7:	MOVD	T1, ACCU
+11a9:	MOVD	ACCU, #$00000000
+11af:	EXTRT	T1, inp_op_cmp_u32 + 0
+11b3:	BGT	$1160
+11b5:	JUMPF	$1083
+11b8:	MOVB	T3, #1
+11bb:	MOVB	T4, #16
+11be:	MOVD	ACCU, T0
+11c0:	EXTRT	$00, negaccu32 + 0
+11c4:	MOVD	T1, ACCU
+11c6:	MOVD	ACCU, #$00000000
+11cc:	EXTRT	T1, inp_op_cmp_u32 + 0
+11d0:	BGT	$1160
+11d2:	JUMPF	$1083
+--------------------------------------------------------------------
+nformf:
+11d5:	ENTER	10, 12
+11d9:	MOV	ACCU, P2
+11db:	MOV	T0, ACCU
+11dd:	MOV	T1, ACCU
+11df:	MOVD	ACCU, P4
+11e1:	MOVD	T2, ACCU
+11e3:	MOVD	ACCU, #$00000000
+11e9:	CMPF	ACCU, T2
+11eb:	BLTF	$14EE
+11ee:	MOVB	T3, #0
+11f1:	MOV	ADDR, P0
+11f3:	MOVUB	ACCU, 5(ADDR)
+11f6:	BEQ	$1203
+11f8:	MOV	ACCU, #43
+11fb:	MOV	ADDR, T0
+11fd:	MOVB	0(ADDR), ACCU
+1200:	MOVB	T3, #1
+1203:	MOV	T0, #0
+1206:	MOV	ADDR, P0
+1208:	MOVB	T5, 2(ADDR)
+120b:	MOVB	ACCU, T5
+120d:	CMPUB	ACCU, #$00FF
+120f:	BNE	$1216
+1211:	MOVB	T5, #6
+1214:	JUMP	$121A
+1216:	AND	T5, #$00FF
+121a:	MOVD	ACCU, P4
+121c:	MOVD	T2, #$00000000
+1222:	CMPF	ACCU, T2
+1224:	BNEF	$1472
+1227:	MOVB	ACCU, P8
+1229:	MOVB	T6, ACCU
+122b:	CMPUB	ACCU, #$0065
+122d:	SEQ
+122e:	MOVB	T7, ACCU
+1230:	MOVB	T8, ACCU
+1232:	MOVB	ACCU, T5
+1234:	MOV	T4, ACCU
+1236:	ADD	T4, #$0001
+123a:	MOVB	ACCU, T6
+123c:	CMPUB	ACCU, #$0067
+123e:	BEQF	$1461
+1241:	MOVB	ACCU, T7
+1243:	BNEF	$1415
+1246:	MOV	ACCU, T0
+1248:	BGE	$1260
+124a:	MOVD	ACCU, P4
+124c:	MOVD	$03, #$41200000
+1252:	DIVF	ACCU, $03
+1254:	MOVD	T2, ACCU
+1256:	MOVD	P4, ACCU
+1258:	ADD	T0, #$0001
+125c:	MOV	ACCU, T0
+125e:	BLT	$124A
+1260:	MOVD	T2, #$3f000000
+1266:	MOVB	ACCU, T5
+1268:	ADD	ACCU, T0
+126a:	MOV	T4, ACCU
+126c:	ADD	T4, #$0001
+1270:	MOVB	ACCU, T4
+1272:	CMPUB	ACCU, #$0001
+1274:	BLTF	$13FA
+1277:	MOVD	ACCU, P4
+1279:	ADDF	ACCU, T2
+127b:	MOVD	T2, ACCU
+127d:	MOVD	P4, ACCU
+127f:	MOVD	ACCU, #$41200000
+1285:	CMPF	ACCU, T2
+1287:	BLT	$129A
+1289:	MOVD	ACCU, T2
+128b:	MOVD	$03, #$41200000
+1291:	DIVF	ACCU, $03
+1293:	MOVD	T2, ACCU
+1295:	MOVD	P4, ACCU
+1297:	ADDB	T5, #$00FF
+129a:	MOVB	ACCU, T4
+129c:	MOV	T10, ACCU
+129e:	MOVB	ACCU, T5
+12a0:	NEG	ACCU
+12a1:	ADD	ACCU, T10
+12a3:	MOV	T10, ACCU
+12a5:	MOVB	T5, ACCU
+12a7:	MOVB	ACCU, T4
+12a9:	CMPUB	ACCU, #$0014
+12ab:	BGE	$12B0
+12ad:	MOVB	T4, #20
+12b0:	MOVB	ACCU, T10
+12b2:	BNE	$12C1
+12b4:	MOVB	ACCU, T3
+12b6:	LEAX	ADDR, T1 + ACCU
+12b8:	MOV	ACCU, #48
+12bb:	MOVB	0(ADDR), ACCU
+12be:	ADDB	T3, #$0001
+12c1:	MOVB	T6, #0
+12c4:	MOVB	ACCU, T4
+12c6:	BNEF	$13B3
+12c9:	MOVB	ACCU, T8
+12cb:	BNE	$1342
+12cd:	MOV	ADDR, P0
+12cf:	MOVUB	ACCU, 1(ADDR)
+12d2:	CMPUB	ACCU, T3
+12d4:	BLT	$12DC
+12d6:	MOVB	ACCU, T3
+12d8:	RETURN	10, 12
+12dc:	MOVB	ACCU, T3
+12de:	CMPUB	ACCU, #$0001
+12e0:	BLE	$1311
+12e2:	MOVB	T5, #0
+12e5:	MOVB	ACCU, T3
+12e7:	MOV	T0, ACCU
+12e9:	MOV	ADDR, P0
+12eb:	MOVUB	ACCU, 1(ADDR)
+12ee:	MOV	T4, ACCU
+12f0:	SUB	ACCU, T0
+12f2:	MOV	T10, ACCU
+12f4:	MOVB	ACCU, T5
+12f6:	MOV	T11, ACCU
+12f8:	MOV	ACCU, T10
+12fa:	CMPU	ACCU, T11
+12fc:	BLT	$1302
+12fe:	MOV	ACCU, T4
+1300:	JUMP	$12D8
+1302:	MOV	ACCU, T1
+1304:	LEAX	ADDR, T11 + ACCU
+1306:	MOV	ACCU, #32
+1309:	MOVB	0(ADDR), ACCU
+130c:	ADDB	T5, #$0001
+130f:	JUMP	$12E9
+1311:	MOVB	T5, #1
+1314:	MOV	ACCU, P0
+1316:	MOV	T0, ACCU
+1318:	MOVB	ACCU, T3
+131a:	MOV	T4, ACCU
+131c:	MOVB	ACCU, T5
+131e:	MOV	T10, ACCU
+1320:	MOV	ACCU, T4
+1322:	SUB	ACCU, T10
+1324:	MOV	ADDR, T0
+1326:	MOVB	T6, 1(ADDR)
+1329:	LEAX	ADDR, T1 + ACCU
+132b:	MOVB	ACCU, T6
+132d:	MOVB	T6, 0(ADDR)
+1330:	SUB	ACCU, T10
+1332:	LEAX	ADDR, T1 + ACCU
+1334:	MOVB	0(ADDR), T6
+1337:	ADDB	T5, #$0001
+133a:	MOVB	ACCU, T3
+133c:	CMPUB	ACCU, T5
+133e:	BLE	$131C
+1340:	JUMP	$12E2
+1342:	MOVB	ACCU, T3
+1344:	LEAX	ADDR, T1 + ACCU
+1346:	MOV	ACCU, #69
+1349:	MOVB	0(ADDR), ACCU
+134c:	MOVB	ACCU, T3
+134e:	ADDB	ACCU, #$0001
+1351:	MOVB	T5, ACCU
+1353:	MOV	ACCU, T0
+1355:	BLT	$1366
+1357:	MOVB	ACCU, T5
+1359:	LEAX	ADDR, T1 + ACCU
+135b:	MOV	ACCU, #43
+135e:	MOVB	0(ADDR), ACCU
+1361:	ADDB	T3, #$0002
+1364:	JUMP	$1378
+1366:	MOVB	ACCU, T5
+1368:	LEAX	ADDR, T1 + ACCU
+136a:	MOV	ACCU, #45
+136d:	MOVB	0(ADDR), ACCU
+1370:	ADDB	T3, #$0002
+1373:	MOV	ACCU, T0
+1375:	NEG	ACCU
+1376:	MOV	T0, ACCU
+1378:	MOVB	ACCU, T3
+137a:	ADD	ACCU, T1
+137c:	MOV	T4, ACCU
+137e:	MOV	ACCU, T0
+1380:	MOV	ADDR, #10
+1383:	DIVS	ACCU, ADDR
+1385:	MOV	ADDR, T4
+1387:	MOV	T10, ACCU
+1389:	ADD	T10, #$0030
+138d:	MOVB	0(ADDR), T10
+1390:	MOVB	ACCU, T3
+1392:	ADDB	ACCU, #$0001
+1395:	MOVB	ACCU, ACCU
+1397:	ADD	ACCU, T1
+1399:	MOV	T4, ACCU
+139b:	MOV	ACCU, T0
+139d:	MOV	ADDR, #10
+13a0:	MODS	ACCU, ADDR
+13a2:	MOV	ADDR, T4
+13a4:	MOV	T0, ACCU
+13a6:	ADD	T0, #$0030
+13aa:	MOVB	0(ADDR), T0
+13ad:	ADDB	T3, #$0002
+13b0:	JUMPF	$12CD
+13b3:	MOVB	ACCU, T5
+13b5:	CMPUB	ACCU, T6
+13b7:	BNE	$13C6
+13b9:	MOVB	ACCU, T3
+13bb:	LEAX	ADDR, T1 + ACCU
+13bd:	MOV	ACCU, #46
+13c0:	MOVB	0(ADDR), ACCU
+13c3:	ADDB	T3, #$0001
+13c6:	MOVD	ACCU, P4
+13c8:	MOVD	T2, ACCU
+13ca:	CNVFS	ACCU
+13cb:	MOV	T10, ACCU
+13cd:	CNVSF	ACCU
+13ce:	MOVD	T9, ACCU
+13d0:	MOVD	ACCU, T2
+13d2:	SUBF	ACCU, T9
+13d4:	MOVD	$03, #$41200000
+13da:	MULF	ACCU, $03
+13dc:	MOVD	T2, ACCU
+13de:	MOVD	P4, ACCU
+13e0:	MOVB	ACCU, T3
+13e2:	LEAX	ADDR, T1 + ACCU
+13e4:	ADD	T10, #$0030
+13e8:	MOVB	0(ADDR), T10
+13eb:	ADDB	T3, #$0001
+13ee:	ADDB	T6, #$0001
+13f1:	MOVB	ACCU, T4
+13f3:	CMPUB	ACCU, T6
+13f5:	BLT	$13B3
+13f7:	JUMPF	$12C9
+13fa:	MOVB	T6, #1
+13fd:	MOVD	ACCU, T2
+13ff:	MOVD	$03, #$41200000
+1405:	DIVF	ACCU, $03
+1407:	MOVD	T2, ACCU
+1409:	ADDB	T6, #$0001
+140c:	MOVB	ACCU, T4
+140e:	CMPUB	ACCU, T6
+1410:	BLT	$13FD
+1412:	JUMPF	$1277
+1415:	MOVD	T2, #$3f000000
+141b:	MOVB	ACCU, T5
+141d:	BNE	$1447
+141f:	MOVD	ACCU, P4
+1421:	ADDF	ACCU, T2
+1423:	MOVD	T2, ACCU
+1425:	MOVD	P4, ACCU
+1427:	MOVD	ACCU, #$41200000
+142d:	CMPF	ACCU, T2
+142f:	BLTF	$129A
+1432:	MOVD	ACCU, T2
+1434:	MOVD	$03, #$41200000
+143a:	DIVF	ACCU, $03
+143c:	MOVD	T2, ACCU
+143e:	MOVD	P4, ACCU
+1440:	ADD	T0, #$0001
+1444:	JUMPF	$129A
+1447:	MOVB	T6, #0
+144a:	MOVD	ACCU, T2
+144c:	MOVD	$03, #$41200000
+1452:	DIVF	ACCU, $03
+1454:	MOVD	T2, ACCU
+1456:	ADDB	T6, #$0001
+1459:	MOVB	ACCU, T5
+145b:	CMPUB	ACCU, T6
+145d:	BLT	$144A
+145f:	JUMP	$141F
+1461:	MOV	ACCU, T0
+1463:	CMPS	ACCU, #$0003
+1466:	BLT	$146D
+1468:	MOV	ACCU, T0
+146a:	BGEF	$1241
+146d:	MOVB	T8, #1
+1470:	JUMP	$1415
+1472:	MOVD	ACCU, P4
+1474:	MOVD	T2, #$447a0000
+147a:	CMPF	ACCU, T2
+147c:	BGT	$149A
+147e:	MOVD	ACCU, P4
+1480:	MOVD	$03, #$447a0000
+1486:	DIVF	ACCU, $03
+1488:	MOVD	T2, ACCU
+148a:	MOVD	P4, ACCU
+148c:	ADD	T0, #$0003
+1490:	MOVD	ACCU, #$447a0000
+1496:	CMPF	ACCU, T2
+1498:	BGE	$147E
+149a:	MOVD	ACCU, P4
+149c:	MOVD	T2, #$3f800000
+14a2:	CMPF	ACCU, T2
+14a4:	BLE	$14C2
+14a6:	MOVD	ACCU, P4
+14a8:	MOVD	$03, #$447a0000
+14ae:	MULF	ACCU, $03
+14b0:	MOVD	T2, ACCU
+14b2:	MOVD	P4, ACCU
+14b4:	ADD	T0, #$FFFD
+14b8:	MOVD	ACCU, #$3f800000
+14be:	CMPF	ACCU, T2
+14c0:	BLT	$14A6
+14c2:	MOVD	ACCU, P4
+14c4:	MOVD	T2, #$41200000
+14ca:	CMPF	ACCU, T2
+14cc:	BGTF	$1227
+14cf:	MOVD	ACCU, P4
+14d1:	MOVD	$03, #$41200000
+14d7:	DIVF	ACCU, $03
+14d9:	MOVD	T2, ACCU
+14db:	MOVD	P4, ACCU
+14dd:	ADD	T0, #$0001
+14e1:	MOVD	ACCU, #$41200000
+14e7:	CMPF	ACCU, T2
+14e9:	BGE	$14CF
+14eb:	JUMPF	$1227
+14ee:	MOV	ADDR, T0
+14f0:	MOVD	ACCU, T2
+14f2:	NEGF	ACCU
+14f3:	MOVD	T2, ACCU
+14f5:	MOVD	P4, ACCU
+14f7:	MOV	ACCU, #45
+14fa:	MOVB	0(ADDR), ACCU
+14fd:	MOVB	T3, #1
+1500:	JUMPF	$1203
+--------------------------------------------------------------------
+strlen:
+151c : ea __ __ NOP
+151d : a9 00 __ LDA #$00
+151f : 85 43 __ STA T0 + 0
+1521 : 85 44 __ STA T0 + 1
+1523 : a0 00 __ LDY #$00
+1525 : b1 0d __ LDA (P0),y
+1527 : d0 09 __ BNE $1532
+1529 : a5 43 __ LDA T0 + 0
+152b : 85 1b __ STA ACCU + 0
+152d : a5 44 __ LDA T0 + 1
+152f : 85 1c __ STA ACCU + 1
+1531 : 60 __ __ RTS
+1532 : 18 __ __ CLC
+1533 : a5 0d __ LDA P0
+1535 : 65 43 __ ADC T0 + 0
+1537 : 85 48 __ STA T3 + 0
+1539 : a5 0e __ LDA P1
+153b : 65 44 __ ADC T0 + 1
+153d : 85 49 __ STA T3 + 1
+153f : e6 43 __ INC T0 + 0
+1541 : d0 02 __ BNE $1545
+1543 : e6 44 __ INC T0 + 1
+1545 : a0 01 __ LDY #$01
+1547 : b1 48 __ LDA (T3 + 0),y
+1549 : d0 e7 __ BNE $1532
+154b : 4c 29 15 JMP $1529 ; (strlen + 13)
+--------------------------------------------------------------------
+strcmp:
+1564 : ea __ __ NOP
+1565 : a0 00 __ LDY #$00
+1567 : 84 1c __ STY ACCU + 1
+1569 : b1 0d __ LDA (P0),y
+156b : f0 16 __ BEQ $1583
+156d : d1 0f __ CMP (P2),y
+156f : d0 16 __ BNE $1587
+1571 : c8 __ __ INY
+1572 : b1 0d __ LDA (P0),y
+1574 : f0 0d __ BEQ $1583
+1576 : d1 0f __ CMP (P2),y
+1578 : d0 0d __ BNE $1587
+157a : c8 __ __ INY
+157b : d0 ec __ BNE $1569
+157d : e6 0e __ INC P1
+157f : e6 10 __ INC P3
+1581 : d0 e6 __ BNE $1569
+1583 : d1 0f __ CMP (P2),y
+1585 : f0 0a __ BEQ $1591
+1587 : b0 06 __ BCS $158f
+1589 : a9 ff __ LDA #$ff
+158b : 85 1c __ STA ACCU + 1
+158d : 30 02 __ BMI $1591
+158f : a9 01 __ LDA #$01
+1591 : 85 1b __ STA ACCU + 0
+1593 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+15a2 : b1 19 __ LDA (IP + 0),y
+15a4 : c8 __ __ INY
+15a5 : aa __ __ TAX
+15a6 : b5 00 __ LDA $00,x
+15a8 : 85 03 __ STA $03
+15aa : b5 01 __ LDA $01,x
+15ac : 85 04 __ STA $04
+15ae : b5 02 __ LDA $02,x
+15b0 : 85 05 __ STA $05
+15b2 : b5 03 __ LDA $03,x
+15b4 : 85 06 __ STA $06
+15b6 : a5 05 __ LDA $05
+15b8 : 0a __ __ ASL
+15b9 : a5 06 __ LDA $06
+15bb : 2a __ __ ROL
+15bc : 85 08 __ STA $08
+15be : f0 06 __ BEQ $15c6
+15c0 : a5 05 __ LDA $05
+15c2 : 09 80 __ ORA #$80
+15c4 : 85 05 __ STA $05
+15c6 : a5 1d __ LDA ACCU + 2
+15c8 : 0a __ __ ASL
+15c9 : a5 1e __ LDA ACCU + 3
+15cb : 2a __ __ ROL
+15cc : 85 07 __ STA $07
+15ce : f0 06 __ BEQ $15d6
+15d0 : a5 1d __ LDA ACCU + 2
+15d2 : 09 80 __ ORA #$80
+15d4 : 85 1d __ STA ACCU + 2
+15d6 : 60 __ __ RTS
+15d7 : 06 1e __ ASL ACCU + 3
+15d9 : a5 07 __ LDA $07
+15db : 6a __ __ ROR
+15dc : 85 1e __ STA ACCU + 3
+15de : b0 06 __ BCS $15e6
+15e0 : a5 1d __ LDA ACCU + 2
+15e2 : 29 7f __ AND #$7f
+15e4 : 85 1d __ STA ACCU + 2
+15e6 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+15e7 : 38 __ __ SEC
+15e8 : a5 07 __ LDA $07
+15ea : e5 08 __ SBC $08
+15ec : f0 38 __ BEQ $1626
+15ee : aa __ __ TAX
+15ef : b0 25 __ BCS $1616
+15f1 : e0 e9 __ CPX #$e9
+15f3 : b0 0e __ BCS $1603
+15f5 : a5 08 __ LDA $08
+15f7 : 85 07 __ STA $07
+15f9 : a9 00 __ LDA #$00
+15fb : 85 1b __ STA ACCU + 0
+15fd : 85 1c __ STA ACCU + 1
+15ff : 85 1d __ STA ACCU + 2
+1601 : f0 23 __ BEQ $1626
+1603 : a5 1d __ LDA ACCU + 2
+1605 : 4a __ __ LSR
+1606 : 66 1c __ ROR ACCU + 1
+1608 : 66 1b __ ROR ACCU + 0
+160a : e8 __ __ INX
+160b : d0 f8 __ BNE $1605
+160d : 85 1d __ STA ACCU + 2
+160f : a5 08 __ LDA $08
+1611 : 85 07 __ STA $07
+1613 : 4c 26 16 JMP $1626 ; (faddsub + 63)
+1616 : e0 18 __ CPX #$18
+1618 : b0 33 __ BCS $164d
+161a : a5 05 __ LDA $05
+161c : 4a __ __ LSR
+161d : 66 04 __ ROR $04
+161f : 66 03 __ ROR $03
+1621 : ca __ __ DEX
+1622 : d0 f8 __ BNE $161c
+1624 : 85 05 __ STA $05
+1626 : a5 1e __ LDA ACCU + 3
+1628 : 29 80 __ AND #$80
+162a : 85 1e __ STA ACCU + 3
+162c : 45 06 __ EOR $06
+162e : 30 2d __ BMI $165d
+1630 : 18 __ __ CLC
+1631 : a5 1b __ LDA ACCU + 0
+1633 : 65 03 __ ADC $03
+1635 : 85 1b __ STA ACCU + 0
+1637 : a5 1c __ LDA ACCU + 1
+1639 : 65 04 __ ADC $04
+163b : 85 1c __ STA ACCU + 1
+163d : a5 1d __ LDA ACCU + 2
+163f : 65 05 __ ADC $05
+1641 : 85 1d __ STA ACCU + 2
+1643 : 90 08 __ BCC $164d
+1645 : 66 1d __ ROR ACCU + 2
+1647 : 66 1c __ ROR ACCU + 1
+1649 : 66 1b __ ROR ACCU + 0
+164b : e6 07 __ INC $07
+164d : a5 07 __ LDA $07
+164f : 4a __ __ LSR
+1650 : 05 1e __ ORA ACCU + 3
+1652 : 85 1e __ STA ACCU + 3
+1654 : b0 06 __ BCS $165c
+1656 : a5 1d __ LDA ACCU + 2
+1658 : 29 7f __ AND #$7f
+165a : 85 1d __ STA ACCU + 2
+165c : 60 __ __ RTS
+165d : 38 __ __ SEC
+165e : a5 1b __ LDA ACCU + 0
+1660 : e5 03 __ SBC $03
+1662 : 85 1b __ STA ACCU + 0
+1664 : a5 1c __ LDA ACCU + 1
+1666 : e5 04 __ SBC $04
+1668 : 85 1c __ STA ACCU + 1
+166a : a5 1d __ LDA ACCU + 2
+166c : e5 05 __ SBC $05
+166e : 85 1d __ STA ACCU + 2
+1670 : b0 19 __ BCS $168b
+1672 : 38 __ __ SEC
+1673 : a9 00 __ LDA #$00
+1675 : e5 1b __ SBC ACCU + 0
+1677 : 85 1b __ STA ACCU + 0
+1679 : a9 00 __ LDA #$00
+167b : e5 1c __ SBC ACCU + 1
+167d : 85 1c __ STA ACCU + 1
+167f : a9 00 __ LDA #$00
+1681 : e5 1d __ SBC ACCU + 2
+1683 : 85 1d __ STA ACCU + 2
+1685 : a5 1e __ LDA ACCU + 3
+1687 : 49 80 __ EOR #$80
+1689 : 85 1e __ STA ACCU + 3
+168b : a5 1d __ LDA ACCU + 2
+168d : 30 be __ BMI $164d
+168f : 05 1c __ ORA ACCU + 1
+1691 : 05 1b __ ORA ACCU + 0
+1693 : f0 0f __ BEQ $16a4
+1695 : c6 07 __ DEC $07
+1697 : f0 0b __ BEQ $16a4
+1699 : 06 1b __ ASL ACCU + 0
+169b : 26 1c __ ROL ACCU + 1
+169d : 26 1d __ ROL ACCU + 2
+169f : 10 f4 __ BPL $1695
+16a1 : 4c 4d 16 JMP $164d ; (faddsub + 102)
+16a4 : a9 00 __ LDA #$00
+16a6 : 85 1b __ STA ACCU + 0
+16a8 : 85 1c __ STA ACCU + 1
+16aa : 85 1d __ STA ACCU + 2
+16ac : 85 1e __ STA ACCU + 3
+16ae : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+16af : a5 1b __ LDA ACCU + 0
+16b1 : 05 1c __ ORA ACCU + 1
+16b3 : 05 1d __ ORA ACCU + 2
+16b5 : d0 03 __ BNE $16ba
+16b7 : 85 1e __ STA ACCU + 3
+16b9 : 60 __ __ RTS
+16ba : a5 03 __ LDA $03
+16bc : 05 04 __ ORA $04
+16be : 05 05 __ ORA $05
+16c0 : d0 09 __ BNE $16cb
+16c2 : 85 1b __ STA ACCU + 0
+16c4 : 85 1c __ STA ACCU + 1
+16c6 : 85 1d __ STA ACCU + 2
+16c8 : 85 1e __ STA ACCU + 3
+16ca : 60 __ __ RTS
+16cb : a9 00 __ LDA #$00
+16cd : 85 09 __ STA $09
+16cf : 85 0a __ STA $0a
+16d1 : 85 0b __ STA $0b
+16d3 : a4 1b __ LDY ACCU + 0
+16d5 : a5 03 __ LDA $03
+16d7 : d0 06 __ BNE $16df
+16d9 : a5 04 __ LDA $04
+16db : f0 0a __ BEQ $16e7
+16dd : d0 05 __ BNE $16e4
+16df : 20 1f 17 JSR $171f ; (fmul8 + 0)
+16e2 : a5 04 __ LDA $04
+16e4 : 20 1f 17 JSR $171f ; (fmul8 + 0)
+16e7 : a5 05 __ LDA $05
+16e9 : 20 1f 17 JSR $171f ; (fmul8 + 0)
+16ec : 38 __ __ SEC
+16ed : a5 0b __ LDA $0b
+16ef : 30 06 __ BMI $16f7
+16f1 : 06 09 __ ASL $09
+16f3 : 26 0a __ ROL $0a
+16f5 : 2a __ __ ROL
+16f6 : 18 __ __ CLC
+16f7 : 29 7f __ AND #$7f
+16f9 : 85 0b __ STA $0b
+16fb : a5 1e __ LDA ACCU + 3
+16fd : 45 06 __ EOR $06
+16ff : 29 80 __ AND #$80
+1701 : 85 1e __ STA ACCU + 3
+1703 : a5 07 __ LDA $07
+1705 : e9 7e __ SBC #$7e
+1707 : 18 __ __ CLC
+1708 : 65 08 __ ADC $08
+170a : 4a __ __ LSR
+170b : 05 1e __ ORA ACCU + 3
+170d : 85 1e __ STA ACCU + 3
+170f : a9 00 __ LDA #$00
+1711 : 6a __ __ ROR
+1712 : 05 0b __ ORA $0b
+1714 : 85 1d __ STA ACCU + 2
+1716 : a5 0a __ LDA $0a
+1718 : 85 1c __ STA ACCU + 1
+171a : a5 09 __ LDA $09
+171c : 85 1b __ STA ACCU + 0
+171e : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+171f : 38 __ __ SEC
+1720 : 6a __ __ ROR
+1721 : 90 1e __ BCC $1741
+1723 : aa __ __ TAX
+1724 : 18 __ __ CLC
+1725 : 98 __ __ TYA
+1726 : 65 09 __ ADC $09
+1728 : 85 09 __ STA $09
+172a : a5 0a __ LDA $0a
+172c : 65 1c __ ADC ACCU + 1
+172e : 85 0a __ STA $0a
+1730 : a5 0b __ LDA $0b
+1732 : 65 1d __ ADC ACCU + 2
+1734 : 6a __ __ ROR
+1735 : 85 0b __ STA $0b
+1737 : 8a __ __ TXA
+1738 : 66 0a __ ROR $0a
+173a : 66 09 __ ROR $09
+173c : 4a __ __ LSR
+173d : f0 0d __ BEQ $174c
+173f : b0 e2 __ BCS $1723
+1741 : 66 0b __ ROR $0b
+1743 : 66 0a __ ROR $0a
+1745 : 66 09 __ ROR $09
+1747 : 4a __ __ LSR
+1748 : 90 f7 __ BCC $1741
+174a : d0 d7 __ BNE $1723
+174c : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+174d : a5 1b __ LDA ACCU + 0
+174f : 05 1c __ ORA ACCU + 1
+1751 : 05 1d __ ORA ACCU + 2
+1753 : d0 03 __ BNE $1758
+1755 : 85 1e __ STA ACCU + 3
+1757 : 60 __ __ RTS
+1758 : a5 1e __ LDA ACCU + 3
+175a : 45 06 __ EOR $06
+175c : 29 80 __ AND #$80
+175e : 85 1e __ STA ACCU + 3
+1760 : a9 00 __ LDA #$00
+1762 : 85 09 __ STA $09
+1764 : 85 0a __ STA $0a
+1766 : 85 0b __ STA $0b
+1768 : a2 18 __ LDX #$18
+176a : a5 1b __ LDA ACCU + 0
+176c : c5 03 __ CMP $03
+176e : a5 1c __ LDA ACCU + 1
+1770 : e5 04 __ SBC $04
+1772 : a5 1d __ LDA ACCU + 2
+1774 : e5 05 __ SBC $05
+1776 : 90 13 __ BCC $178b
+1778 : a5 1b __ LDA ACCU + 0
+177a : e5 03 __ SBC $03
+177c : 85 1b __ STA ACCU + 0
+177e : a5 1c __ LDA ACCU + 1
+1780 : e5 04 __ SBC $04
+1782 : 85 1c __ STA ACCU + 1
+1784 : a5 1d __ LDA ACCU + 2
+1786 : e5 05 __ SBC $05
+1788 : 85 1d __ STA ACCU + 2
+178a : 38 __ __ SEC
+178b : 26 09 __ ROL $09
+178d : 26 0a __ ROL $0a
+178f : 26 0b __ ROL $0b
+1791 : ca __ __ DEX
+1792 : f0 0a __ BEQ $179e
+1794 : 06 1b __ ASL ACCU + 0
+1796 : 26 1c __ ROL ACCU + 1
+1798 : 26 1d __ ROL ACCU + 2
+179a : b0 dc __ BCS $1778
+179c : 90 cc __ BCC $176a
+179e : 38 __ __ SEC
+179f : a5 0b __ LDA $0b
+17a1 : 30 06 __ BMI $17a9
+17a3 : 06 09 __ ASL $09
+17a5 : 26 0a __ ROL $0a
+17a7 : 2a __ __ ROL
+17a8 : 18 __ __ CLC
+17a9 : 29 7f __ AND #$7f
+17ab : 85 0b __ STA $0b
+17ad : a5 08 __ LDA $08
+17af : 49 7f __ EOR #$7f
+17b1 : 65 07 __ ADC $07
+17b3 : 38 __ __ SEC
+17b4 : e9 01 __ SBC #$01
+17b6 : 4a __ __ LSR
+17b7 : 05 1e __ ORA ACCU + 3
+17b9 : 85 1e __ STA ACCU + 3
+17bb : a9 00 __ LDA #$00
+17bd : 6a __ __ ROR
+17be : 05 0b __ ORA $0b
+17c0 : 85 1d __ STA ACCU + 2
+17c2 : a5 0a __ LDA $0a
+17c4 : 85 1c __ STA ACCU + 1
+17c6 : a5 09 __ LDA $09
+17c8 : 85 1b __ STA ACCU + 0
+17ca : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+17cb : 38 __ __ SEC
+17cc : a9 00 __ LDA #$00
+17ce : e5 1b __ SBC ACCU + 0
+17d0 : 85 1b __ STA ACCU + 0
+17d2 : a9 00 __ LDA #$00
+17d4 : e5 1c __ SBC ACCU + 1
+17d6 : 85 1c __ STA ACCU + 1
+17d8 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+17d9 : 38 __ __ SEC
+17da : a9 00 __ LDA #$00
+17dc : e5 03 __ SBC $03
+17de : 85 03 __ STA $03
+17e0 : a9 00 __ LDA #$00
+17e2 : e5 04 __ SBC $04
+17e4 : 85 04 __ STA $04
+17e6 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+17e7 : a5 1c __ LDA ACCU + 1
+17e9 : d0 31 __ BNE $181c
+17eb : a5 04 __ LDA $04
+17ed : d0 1e __ BNE $180d
+17ef : 85 06 __ STA $06
+17f1 : a2 04 __ LDX #$04
+17f3 : 06 1b __ ASL ACCU + 0
+17f5 : 2a __ __ ROL
+17f6 : c5 03 __ CMP $03
+17f8 : 90 02 __ BCC $17fc
+17fa : e5 03 __ SBC $03
+17fc : 26 1b __ ROL ACCU + 0
+17fe : 2a __ __ ROL
+17ff : c5 03 __ CMP $03
+1801 : 90 02 __ BCC $1805
+1803 : e5 03 __ SBC $03
+1805 : 26 1b __ ROL ACCU + 0
+1807 : ca __ __ DEX
+1808 : d0 eb __ BNE $17f5
+180a : 85 05 __ STA $05
+180c : 60 __ __ RTS
+180d : a5 1b __ LDA ACCU + 0
+180f : 85 05 __ STA $05
+1811 : a5 1c __ LDA ACCU + 1
+1813 : 85 06 __ STA $06
+1815 : a9 00 __ LDA #$00
+1817 : 85 1b __ STA ACCU + 0
+1819 : 85 1c __ STA ACCU + 1
+181b : 60 __ __ RTS
+181c : a5 04 __ LDA $04
+181e : d0 1f __ BNE $183f
+1820 : a5 03 __ LDA $03
+1822 : 30 1b __ BMI $183f
+1824 : a9 00 __ LDA #$00
+1826 : 85 06 __ STA $06
+1828 : a2 10 __ LDX #$10
+182a : 06 1b __ ASL ACCU + 0
+182c : 26 1c __ ROL ACCU + 1
+182e : 2a __ __ ROL
+182f : c5 03 __ CMP $03
+1831 : 90 02 __ BCC $1835
+1833 : e5 03 __ SBC $03
+1835 : 26 1b __ ROL ACCU + 0
+1837 : 26 1c __ ROL ACCU + 1
+1839 : ca __ __ DEX
+183a : d0 f2 __ BNE $182e
+183c : 85 05 __ STA $05
+183e : 60 __ __ RTS
+183f : a9 00 __ LDA #$00
+1841 : 85 05 __ STA $05
+1843 : 85 06 __ STA $06
+1845 : 84 02 __ STY $02
+1847 : a0 10 __ LDY #$10
+1849 : 18 __ __ CLC
+184a : 26 1b __ ROL ACCU + 0
+184c : 26 1c __ ROL ACCU + 1
+184e : 26 05 __ ROL $05
+1850 : 26 06 __ ROL $06
+1852 : 38 __ __ SEC
+1853 : a5 05 __ LDA $05
+1855 : e5 03 __ SBC $03
+1857 : aa __ __ TAX
+1858 : a5 06 __ LDA $06
+185a : e5 04 __ SBC $04
+185c : 90 04 __ BCC $1862
+185e : 86 05 __ STX $05
+1860 : 85 06 __ STA $06
+1862 : 88 __ __ DEY
+1863 : d0 e5 __ BNE $184a
+1865 : 26 1b __ ROL ACCU + 0
+1867 : 26 1c __ ROL ACCU + 1
+1869 : a4 02 __ LDY $02
+186b : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+186c : 20 c6 15 JSR $15c6 ; (freg + 36)
+186f : a5 07 __ LDA $07
+1871 : c9 7f __ CMP #$7f
+1873 : b0 07 __ BCS $187c
+1875 : a9 00 __ LDA #$00
+1877 : 85 1b __ STA ACCU + 0
+1879 : 85 1c __ STA ACCU + 1
+187b : 60 __ __ RTS
+187c : 38 __ __ SEC
+187d : e9 8e __ SBC #$8e
+187f : 90 0a __ BCC $188b
+1881 : a9 ff __ LDA #$ff
+1883 : 85 1b __ STA ACCU + 0
+1885 : a9 7f __ LDA #$7f
+1887 : 85 1c __ STA ACCU + 1
+1889 : d0 08 __ BNE $1893
+188b : aa __ __ TAX
+188c : 46 1d __ LSR ACCU + 2
+188e : 66 1c __ ROR ACCU + 1
+1890 : e8 __ __ INX
+1891 : d0 f9 __ BNE $188c
+1893 : 24 1e __ BIT ACCU + 3
+1895 : 10 0e __ BPL $18a5
+1897 : 38 __ __ SEC
+1898 : a9 00 __ LDA #$00
+189a : e5 1c __ SBC ACCU + 1
+189c : 85 1b __ STA ACCU + 0
+189e : a9 00 __ LDA #$00
+18a0 : e5 1d __ SBC ACCU + 2
+18a2 : 85 1c __ STA ACCU + 1
+18a4 : 60 __ __ RTS
+18a5 : a5 1c __ LDA ACCU + 1
+18a7 : 85 1b __ STA ACCU + 0
+18a9 : a5 1d __ LDA ACCU + 2
+18ab : 85 1c __ STA ACCU + 1
+18ad : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+18ae : 24 1c __ BIT ACCU + 1
+18b0 : 30 03 __ BMI $18b5
+18b2 : 4c cc 18 JMP $18cc ; (uint16_to_float + 0)
+18b5 : 38 __ __ SEC
+18b6 : a9 00 __ LDA #$00
+18b8 : e5 1b __ SBC ACCU + 0
+18ba : 85 1b __ STA ACCU + 0
+18bc : a9 00 __ LDA #$00
+18be : e5 1c __ SBC ACCU + 1
+18c0 : 85 1c __ STA ACCU + 1
+18c2 : 20 cc 18 JSR $18cc ; (uint16_to_float + 0)
+18c5 : a5 1e __ LDA ACCU + 3
+18c7 : 09 80 __ ORA #$80
+18c9 : 85 1e __ STA ACCU + 3
+18cb : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+18cc : a5 1b __ LDA ACCU + 0
+18ce : 05 1c __ ORA ACCU + 1
+18d0 : d0 05 __ BNE $18d7
+18d2 : 85 1d __ STA ACCU + 2
+18d4 : 85 1e __ STA ACCU + 3
+18d6 : 60 __ __ RTS
+18d7 : a2 8e __ LDX #$8e
+18d9 : a5 1c __ LDA ACCU + 1
+18db : 30 06 __ BMI $18e3
+18dd : ca __ __ DEX
+18de : 06 1b __ ASL ACCU + 0
+18e0 : 2a __ __ ROL
+18e1 : 10 fa __ BPL $18dd
+18e3 : 29 7f __ AND #$7f
+18e5 : 85 1d __ STA ACCU + 2
+18e7 : a5 1b __ LDA ACCU + 0
+18e9 : 85 1c __ STA ACCU + 1
+18eb : 8a __ __ TXA
+18ec : 4a __ __ LSR
+18ed : 85 1e __ STA ACCU + 3
+18ef : a9 00 __ LDA #$00
+18f1 : 85 1b __ STA ACCU + 0
+18f3 : 6a __ __ ROR
+18f4 : 05 1d __ ORA ACCU + 2
+18f6 : 85 1d __ STA ACCU + 2
+18f8 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+18f9 : 38 __ __ SEC
+18fa : a9 00 __ LDA #$00
+18fc : e5 1b __ SBC ACCU + 0
+18fe : 85 1b __ STA ACCU + 0
+1900 : a9 00 __ LDA #$00
+1902 : e5 1c __ SBC ACCU + 1
+1904 : 85 1c __ STA ACCU + 1
+1906 : a9 00 __ LDA #$00
+1908 : e5 1d __ SBC ACCU + 2
+190a : 85 1d __ STA ACCU + 2
+190c : a9 00 __ LDA #$00
+190e : e5 1e __ SBC ACCU + 3
+1910 : 85 1e __ STA ACCU + 3
+1912 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1913 : 84 02 __ STY $02
+1915 : a9 00 __ LDA #$00
+1917 : 85 07 __ STA $07
+1919 : 85 08 __ STA $08
+191b : 85 09 __ STA $09
+191d : 85 0a __ STA $0a
+191f : a0 20 __ LDY #$20
+1921 : 18 __ __ CLC
+1922 : 26 1b __ ROL ACCU + 0
+1924 : 26 1c __ ROL ACCU + 1
+1926 : 26 1d __ ROL ACCU + 2
+1928 : 26 1e __ ROL ACCU + 3
+192a : 26 07 __ ROL $07
+192c : 26 08 __ ROL $08
+192e : 26 09 __ ROL $09
+1930 : 26 0a __ ROL $0a
+1932 : a5 07 __ LDA $07
+1934 : c5 03 __ CMP $03
+1936 : a5 08 __ LDA $08
+1938 : e5 04 __ SBC $04
+193a : a5 09 __ LDA $09
+193c : e5 05 __ SBC $05
+193e : a5 0a __ LDA $0a
+1940 : e5 06 __ SBC $06
+1942 : 90 18 __ BCC $195c
+1944 : a5 07 __ LDA $07
+1946 : e5 03 __ SBC $03
+1948 : 85 07 __ STA $07
+194a : a5 08 __ LDA $08
+194c : e5 04 __ SBC $04
+194e : 85 08 __ STA $08
+1950 : a5 09 __ LDA $09
+1952 : e5 05 __ SBC $05
+1954 : 85 09 __ STA $09
+1956 : a5 0a __ LDA $0a
+1958 : e5 06 __ SBC $06
+195a : 85 0a __ STA $0a
+195c : 88 __ __ DEY
+195d : d0 c3 __ BNE $1922
+195f : 26 1b __ ROL ACCU + 0
+1961 : 26 1c __ ROL ACCU + 1
+1963 : 26 1d __ ROL ACCU + 2
+1965 : 26 1e __ ROL ACCU + 3
+1967 : a4 02 __ LDY $02
+1969 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+196a : a9 00 __ LDA #$00
+196c : 85 1d __ STA ACCU + 2
+196e : 85 1e __ STA ACCU + 3
+1970 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1971 : b5 00 __ LDA $00,x
+1973 : 85 03 __ STA $03
+1975 : b5 01 __ LDA $01,x
+1977 : 85 04 __ STA $04
+1979 : b5 02 __ LDA $02,x
+197b : 85 05 __ STA $05
+197d : b5 03 __ LDA $03,x
+197f : 85 06 __ STA $06
+1981 : 20 13 19 JSR $1913 ; (divmod32 + 0)
+1984 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1985 : b5 00 __ LDA $00,x
+1987 : 85 03 __ STA $03
+1989 : b5 01 __ LDA $01,x
+198b : 85 04 __ STA $04
+198d : b5 02 __ LDA $02,x
+198f : 85 05 __ STA $05
+1991 : b5 03 __ LDA $03,x
+1993 : 85 06 __ STA $06
+1995 : 20 13 19 JSR $1913 ; (divmod32 + 0)
+1998 : a5 07 __ LDA $07
+199a : 85 1b __ STA ACCU + 0
+199c : a5 08 __ LDA $08
+199e : 85 1c __ STA ACCU + 1
+19a0 : a5 09 __ LDA $09
+19a2 : 85 1d __ STA ACCU + 2
+19a4 : a5 0a __ LDA $0a
+19a6 : 85 1e __ STA ACCU + 3
+19a8 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+19a9 : b5 03 __ LDA $03,x
+19ab : c5 1e __ CMP ACCU + 3
+19ad : d0 20 __ BNE $19cf
+19af : b5 02 __ LDA $02,x
+19b1 : c5 1d __ CMP ACCU + 2
+19b3 : d0 1a __ BNE $19cf
+19b5 : b5 01 __ LDA $01,x
+19b7 : c5 1c __ CMP ACCU + 1
+19b9 : d0 14 __ BNE $19cf
+19bb : b5 00 __ LDA $00,x
+19bd : c5 1b __ CMP ACCU + 0
+19bf : d0 0e __ BNE $19cf
+19c1 : a9 00 __ LDA #$00
+19c3 : 85 1b __ STA ACCU + 0
+19c5 : 85 1c __ STA ACCU + 1
+19c7 : 60 __ __ RTS
+19c8 : a9 ff __ LDA #$ff
+19ca : 85 1b __ STA ACCU + 0
+19cc : 85 1c __ STA ACCU + 1
+19ce : 60 __ __ RTS
+19cf : 90 f7 __ BCC $19c8
+19d1 : a9 01 __ LDA #$01
+19d3 : 85 1b __ STA ACCU + 0
+19d5 : a9 00 __ LDA #$00
+19d7 : 85 1c __ STA ACCU + 1
+19d9 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+19da : a5 1e __ LDA ACCU + 3
+19dc : 49 80 __ EOR #$80
+19de : 85 1e __ STA ACCU + 3
+19e0 : b5 03 __ LDA $03,x
+19e2 : 49 80 __ EOR #$80
+19e4 : c5 1e __ CMP ACCU + 3
+19e6 : d0 20 __ BNE $1a08
+19e8 : b5 02 __ LDA $02,x
+19ea : c5 1d __ CMP ACCU + 2
+19ec : d0 1a __ BNE $1a08
+19ee : b5 01 __ LDA $01,x
+19f0 : c5 1c __ CMP ACCU + 1
+19f2 : d0 14 __ BNE $1a08
+19f4 : b5 00 __ LDA $00,x
+19f6 : c5 1b __ CMP ACCU + 0
+19f8 : d0 0e __ BNE $1a08
+19fa : a9 00 __ LDA #$00
+19fc : 85 1b __ STA ACCU + 0
+19fe : 85 1c __ STA ACCU + 1
+1a00 : 60 __ __ RTS
+1a01 : a9 ff __ LDA #$ff
+1a03 : 85 1b __ STA ACCU + 0
+1a05 : 85 1c __ STA ACCU + 1
+1a07 : 60 __ __ RTS
+1a08 : 90 f7 __ BCC $1a01
+1a0a : a9 01 __ LDA #$01
+1a0c : 85 1b __ STA ACCU + 0
+1a0e : a9 00 __ LDA #$00
+1a10 : 85 1c __ STA ACCU + 1
+1a12 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1a13 : a9 4c __ LDA #$4c
+1a15 : 85 54 __ STA $54
+1a17 : a9 00 __ LDA #$00
+1a19 : 85 13 __ STA P6
+1a1b : a9 19 __ LDA #$19
+1a1d : 85 16 __ STA P9
+1a1f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1a20 : b1 19 __ LDA (IP + 0),y
+1a22 : aa __ __ TAX
+1a23 : c8 __ __ INY
+1a24 : b1 19 __ LDA (IP + 0),y
+1a26 : 95 00 __ STA $00,x
+1a28 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1a2b : b1 19 __ LDA (IP + 0),y
+1a2d : aa __ __ TAX
+1a2e : c8 __ __ INY
+1a2f : b1 19 __ LDA (IP + 0),y
+1a31 : 95 00 __ STA $00,x
+1a33 : a9 00 __ LDA #$00
+1a35 : 95 01 __ STA $01,x
+1a37 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1a3a : b1 19 __ LDA (IP + 0),y
+1a3c : aa __ __ TAX
+1a3d : c8 __ __ INY
+1a3e : b1 19 __ LDA (IP + 0),y
+1a40 : 95 00 __ STA $00,x
+1a42 : a9 ff __ LDA #$ff
+1a44 : 95 01 __ STA $01,x
+1a46 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1a49 : b1 19 __ LDA (IP + 0),y
+1a4b : aa __ __ TAX
+1a4c : c8 __ __ INY
+1a4d : b1 19 __ LDA (IP + 0),y
+1a4f : 95 00 __ STA $00,x
+1a51 : c8 __ __ INY
+1a52 : b1 19 __ LDA (IP + 0),y
+1a54 : 95 01 __ STA $01,x
+1a56 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1a59 : b1 19 __ LDA (IP + 0),y
+1a5b : aa __ __ TAX
+1a5c : c8 __ __ INY
+1a5d : b1 19 __ LDA (IP + 0),y
+1a5f : 95 00 __ STA $00,x
+1a61 : c8 __ __ INY
+1a62 : b1 19 __ LDA (IP + 0),y
+1a64 : 95 01 __ STA $01,x
+1a66 : c8 __ __ INY
+1a67 : b1 19 __ LDA (IP + 0),y
+1a69 : 95 02 __ STA $02,x
+1a6b : c8 __ __ INY
+1a6c : b1 19 __ LDA (IP + 0),y
+1a6e : 95 03 __ STA $03,x
+1a70 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1a73 : b1 19 __ LDA (IP + 0),y
+1a75 : aa __ __ TAX
+1a76 : b5 00 __ LDA $00,x
+1a78 : 85 1b __ STA ACCU + 0
+1a7a : a9 00 __ LDA #$00
+1a7c : 85 1c __ STA ACCU + 1
+1a7e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1a81 : b1 19 __ LDA (IP + 0),y
+1a83 : aa __ __ TAX
+1a84 : a5 1b __ LDA ACCU + 0
+1a86 : 95 00 __ STA $00,x
+1a88 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1a8b : b1 19 __ LDA (IP + 0),y
+1a8d : aa __ __ TAX
+1a8e : b5 00 __ LDA $00,x
+1a90 : 85 1b __ STA ACCU + 0
+1a92 : b5 01 __ LDA $01,x
+1a94 : 85 1c __ STA ACCU + 1
+1a96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1a99 : b1 19 __ LDA (IP + 0),y
+1a9b : aa __ __ TAX
+1a9c : a5 1b __ LDA ACCU + 0
+1a9e : 95 00 __ STA $00,x
+1aa0 : a5 1c __ LDA ACCU + 1
+1aa2 : 95 01 __ STA $01,x
+1aa4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1aa7 : b1 19 __ LDA (IP + 0),y
+1aa9 : aa __ __ TAX
+1aaa : b5 00 __ LDA $00,x
+1aac : 85 1f __ STA ADDR + 0
+1aae : b5 01 __ LDA $01,x
+1ab0 : 85 20 __ STA ADDR + 1
+1ab2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1ab5 : b1 19 __ LDA (IP + 0),y
+1ab7 : aa __ __ TAX
+1ab8 : b5 00 __ LDA $00,x
+1aba : 85 1b __ STA ACCU + 0
+1abc : b5 01 __ LDA $01,x
+1abe : 85 1c __ STA ACCU + 1
+1ac0 : b5 02 __ LDA $02,x
+1ac2 : 85 1d __ STA ACCU + 2
+1ac4 : b5 03 __ LDA $03,x
+1ac6 : 85 1e __ STA ACCU + 3
+1ac8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1acb : b1 19 __ LDA (IP + 0),y
+1acd : aa __ __ TAX
+1ace : a5 1b __ LDA ACCU + 0
+1ad0 : 95 00 __ STA $00,x
+1ad2 : a5 1c __ LDA ACCU + 1
+1ad4 : 95 01 __ STA $01,x
+1ad6 : a5 1d __ LDA ACCU + 2
+1ad8 : 95 02 __ STA $02,x
+1ada : a5 1e __ LDA ACCU + 3
+1adc : 95 03 __ STA $03,x
+1ade : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1ae1 : b1 19 __ LDA (IP + 0),y
+1ae3 : 85 1f __ STA ADDR + 0
+1ae5 : c8 __ __ INY
+1ae6 : b1 19 __ LDA (IP + 0),y
+1ae8 : 85 20 __ STA ADDR + 1
+1aea : c8 __ __ INY
+1aeb : b1 19 __ LDA (IP + 0),y
+1aed : aa __ __ TAX
+1aee : 84 02 __ STY $02
+1af0 : a0 00 __ LDY #$00
+1af2 : b1 1f __ LDA (ADDR + 0),y
+1af4 : 95 00 __ STA $00,x
+1af6 : a9 00 __ LDA #$00
+1af8 : 95 01 __ STA $01,x
+1afa : a4 02 __ LDY $02
+1afc : 4c 50 08 JMP $0850 ; (startup + 79)
+1aff : b1 19 __ LDA (IP + 0),y
+1b01 : aa __ __ TAX
+1b02 : c8 __ __ INY
+1b03 : b1 19 __ LDA (IP + 0),y
+1b05 : 84 02 __ STY $02
+1b07 : a8 __ __ TAY
+1b08 : 4c f2 1a JMP $1af2 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1b0b : b1 19 __ LDA (IP + 0),y
+1b0d : aa __ __ TAX
+1b0e : c8 __ __ INY
+1b0f : b1 19 __ LDA (IP + 0),y
+1b11 : 95 00 __ STA $00,x
+1b13 : c8 __ __ INY
+1b14 : b1 19 __ LDA (IP + 0),y
+1b16 : 95 01 __ STA $01,x
+1b18 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1b1b : b1 19 __ LDA (IP + 0),y
+1b1d : aa __ __ TAX
+1b1e : c8 __ __ INY
+1b1f : 18 __ __ CLC
+1b20 : b5 00 __ LDA $00,x
+1b22 : 71 19 __ ADC (IP + 0),y
+1b24 : 85 1f __ STA ADDR + 0
+1b26 : c8 __ __ INY
+1b27 : b5 01 __ LDA $01,x
+1b29 : 71 19 __ ADC (IP + 0),y
+1b2b : 85 20 __ STA ADDR + 1
+1b2d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1b30 : b1 19 __ LDA (IP + 0),y
+1b32 : aa __ __ TAX
+1b33 : 18 __ __ CLC
+1b34 : b5 00 __ LDA $00,x
+1b36 : 65 1b __ ADC ACCU + 0
+1b38 : 85 1f __ STA ADDR + 0
+1b3a : b5 01 __ LDA $01,x
+1b3c : 65 1c __ ADC ACCU + 1
+1b3e : 85 20 __ STA ADDR + 1
+1b40 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1b43 : b1 19 __ LDA (IP + 0),y
+1b45 : aa __ __ TAX
+1b46 : c8 __ __ INY
+1b47 : b1 19 __ LDA (IP + 0),y
+1b49 : 84 02 __ STY $02
+1b4b : a8 __ __ TAY
+1b4c : b1 25 __ LDA (FP + 0),y
+1b4e : 95 00 __ STA $00,x
+1b50 : a9 00 __ LDA #$00
+1b52 : 95 01 __ STA $01,x
+1b54 : a4 02 __ LDY $02
+1b56 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1b59 : b1 19 __ LDA (IP + 0),y
+1b5b : aa __ __ TAX
+1b5c : c8 __ __ INY
+1b5d : b1 19 __ LDA (IP + 0),y
+1b5f : 84 02 __ STY $02
+1b61 : a8 __ __ TAY
+1b62 : b1 25 __ LDA (FP + 0),y
+1b64 : 95 00 __ STA $00,x
+1b66 : c8 __ __ INY
+1b67 : b1 25 __ LDA (FP + 0),y
+1b69 : 95 01 __ STA $01,x
+1b6b : a4 02 __ LDY $02
+1b6d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1b70 : b1 19 __ LDA (IP + 0),y
+1b72 : aa __ __ TAX
+1b73 : c8 __ __ INY
+1b74 : b1 19 __ LDA (IP + 0),y
+1b76 : 84 02 __ STY $02
+1b78 : a8 __ __ TAY
+1b79 : b5 00 __ LDA $00,x
+1b7b : 91 25 __ STA (FP + 0),y
+1b7d : a4 02 __ LDY $02
+1b7f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1b82 : b1 19 __ LDA (IP + 0),y
+1b84 : aa __ __ TAX
+1b85 : c8 __ __ INY
+1b86 : b1 19 __ LDA (IP + 0),y
+1b88 : 84 02 __ STY $02
+1b8a : a8 __ __ TAY
+1b8b : b5 00 __ LDA $00,x
+1b8d : 91 25 __ STA (FP + 0),y
+1b8f : c8 __ __ INY
+1b90 : b5 01 __ LDA $01,x
+1b92 : 91 25 __ STA (FP + 0),y
+1b94 : a4 02 __ LDY $02
+1b96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1b99 : b1 19 __ LDA (IP + 0),y
+1b9b : aa __ __ TAX
+1b9c : c8 __ __ INY
+1b9d : 18 __ __ CLC
+1b9e : b1 19 __ LDA (IP + 0),y
+1ba0 : 65 25 __ ADC FP + 0
+1ba2 : 95 00 __ STA $00,x
+1ba4 : c8 __ __ INY
+1ba5 : b1 19 __ LDA (IP + 0),y
+1ba7 : 65 26 __ ADC FP + 1
+1ba9 : 95 01 __ STA $01,x
+1bab : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1bae : b1 19 __ LDA (IP + 0),y
+1bb0 : aa __ __ TAX
+1bb1 : c8 __ __ INY
+1bb2 : b1 19 __ LDA (IP + 0),y
+1bb4 : 84 02 __ STY $02
+1bb6 : a8 __ __ TAY
+1bb7 : b5 00 __ LDA $00,x
+1bb9 : 91 23 __ STA (SP + 0),y
+1bbb : a4 02 __ LDY $02
+1bbd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1bc0 : b1 19 __ LDA (IP + 0),y
+1bc2 : aa __ __ TAX
+1bc3 : c8 __ __ INY
+1bc4 : b1 19 __ LDA (IP + 0),y
+1bc6 : 84 02 __ STY $02
+1bc8 : a8 __ __ TAY
+1bc9 : b5 00 __ LDA $00,x
+1bcb : 91 23 __ STA (SP + 0),y
+1bcd : c8 __ __ INY
+1bce : b5 01 __ LDA $01,x
+1bd0 : 91 23 __ STA (SP + 0),y
+1bd2 : a4 02 __ LDY $02
+1bd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1bd7 : b1 19 __ LDA (IP + 0),y
+1bd9 : aa __ __ TAX
+1bda : c8 __ __ INY
+1bdb : b1 19 __ LDA (IP + 0),y
+1bdd : 84 02 __ STY $02
+1bdf : a8 __ __ TAY
+1be0 : b5 00 __ LDA $00,x
+1be2 : 91 23 __ STA (SP + 0),y
+1be4 : c8 __ __ INY
+1be5 : b5 01 __ LDA $01,x
+1be7 : 91 23 __ STA (SP + 0),y
+1be9 : c8 __ __ INY
+1bea : b5 02 __ LDA $02,x
+1bec : 91 23 __ STA (SP + 0),y
+1bee : c8 __ __ INY
+1bef : b5 03 __ LDA $03,x
+1bf1 : 91 23 __ STA (SP + 0),y
+1bf3 : a4 02 __ LDY $02
+1bf5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1bf8 : b1 19 __ LDA (IP + 0),y
+1bfa : 85 1f __ STA ADDR + 0
+1bfc : c8 __ __ INY
+1bfd : b1 19 __ LDA (IP + 0),y
+1bff : 85 20 __ STA ADDR + 1
+1c01 : c8 __ __ INY
+1c02 : b1 19 __ LDA (IP + 0),y
+1c04 : aa __ __ TAX
+1c05 : 84 02 __ STY $02
+1c07 : a0 00 __ LDY #$00
+1c09 : b1 1f __ LDA (ADDR + 0),y
+1c0b : 95 00 __ STA $00,x
+1c0d : a4 02 __ LDY $02
+1c0f : 4c 50 08 JMP $0850 ; (startup + 79)
+1c12 : b1 19 __ LDA (IP + 0),y
+1c14 : aa __ __ TAX
+1c15 : c8 __ __ INY
+1c16 : b1 19 __ LDA (IP + 0),y
+1c18 : 84 02 __ STY $02
+1c1a : a8 __ __ TAY
+1c1b : 4c 09 1c JMP $1c09 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1c1e : b1 19 __ LDA (IP + 0),y
+1c20 : 85 1f __ STA ADDR + 0
+1c22 : c8 __ __ INY
+1c23 : b1 19 __ LDA (IP + 0),y
+1c25 : 85 20 __ STA ADDR + 1
+1c27 : c8 __ __ INY
+1c28 : b1 19 __ LDA (IP + 0),y
+1c2a : aa __ __ TAX
+1c2b : 84 02 __ STY $02
+1c2d : a0 00 __ LDY #$00
+1c2f : b1 1f __ LDA (ADDR + 0),y
+1c31 : 95 00 __ STA $00,x
+1c33 : c8 __ __ INY
+1c34 : b1 1f __ LDA (ADDR + 0),y
+1c36 : 95 01 __ STA $01,x
+1c38 : a4 02 __ LDY $02
+1c3a : 4c 50 08 JMP $0850 ; (startup + 79)
+1c3d : b1 19 __ LDA (IP + 0),y
+1c3f : aa __ __ TAX
+1c40 : c8 __ __ INY
+1c41 : b1 19 __ LDA (IP + 0),y
+1c43 : 84 02 __ STY $02
+1c45 : a8 __ __ TAY
+1c46 : 4c 2f 1c JMP $1c2f ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1c49 : b1 19 __ LDA (IP + 0),y
+1c4b : 85 1f __ STA ADDR + 0
+1c4d : c8 __ __ INY
+1c4e : b1 19 __ LDA (IP + 0),y
+1c50 : 85 20 __ STA ADDR + 1
+1c52 : c8 __ __ INY
+1c53 : b1 19 __ LDA (IP + 0),y
+1c55 : aa __ __ TAX
+1c56 : 84 02 __ STY $02
+1c58 : a0 00 __ LDY #$00
+1c5a : b1 1f __ LDA (ADDR + 0),y
+1c5c : 95 00 __ STA $00,x
+1c5e : c8 __ __ INY
+1c5f : b1 1f __ LDA (ADDR + 0),y
+1c61 : 95 01 __ STA $01,x
+1c63 : c8 __ __ INY
+1c64 : b1 1f __ LDA (ADDR + 0),y
+1c66 : 95 02 __ STA $02,x
+1c68 : c8 __ __ INY
+1c69 : b1 1f __ LDA (ADDR + 0),y
+1c6b : 95 03 __ STA $03,x
+1c6d : a4 02 __ LDY $02
+1c6f : 4c 50 08 JMP $0850 ; (startup + 79)
+1c72 : b1 19 __ LDA (IP + 0),y
+1c74 : aa __ __ TAX
+1c75 : c8 __ __ INY
+1c76 : b1 19 __ LDA (IP + 0),y
+1c78 : 84 02 __ STY $02
+1c7a : a8 __ __ TAY
+1c7b : 4c 5a 1c JMP $1c5a ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1c7e : b1 19 __ LDA (IP + 0),y
+1c80 : 85 1f __ STA ADDR + 0
+1c82 : c8 __ __ INY
+1c83 : b1 19 __ LDA (IP + 0),y
+1c85 : 85 20 __ STA ADDR + 1
+1c87 : c8 __ __ INY
+1c88 : b1 19 __ LDA (IP + 0),y
+1c8a : aa __ __ TAX
+1c8b : 84 02 __ STY $02
+1c8d : a0 00 __ LDY #$00
+1c8f : b5 00 __ LDA $00,x
+1c91 : 91 1f __ STA (ADDR + 0),y
+1c93 : a4 02 __ LDY $02
+1c95 : 4c 50 08 JMP $0850 ; (startup + 79)
+1c98 : b1 19 __ LDA (IP + 0),y
+1c9a : aa __ __ TAX
+1c9b : c8 __ __ INY
+1c9c : b1 19 __ LDA (IP + 0),y
+1c9e : 84 02 __ STY $02
+1ca0 : a8 __ __ TAY
+1ca1 : 4c 8f 1c JMP $1c8f ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1ca4 : b1 19 __ LDA (IP + 0),y
+1ca6 : aa __ __ TAX
+1ca7 : 18 __ __ CLC
+1ca8 : a5 1b __ LDA ACCU + 0
+1caa : 75 00 __ ADC $00,x
+1cac : 85 1b __ STA ACCU + 0
+1cae : a5 1c __ LDA ACCU + 1
+1cb0 : 75 01 __ ADC $01,x
+1cb2 : 85 1c __ STA ACCU + 1
+1cb4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1cb7 : b1 19 __ LDA (IP + 0),y
+1cb9 : aa __ __ TAX
+1cba : 38 __ __ SEC
+1cbb : a5 1b __ LDA ACCU + 0
+1cbd : f5 00 __ SBC $00,x
+1cbf : 85 1b __ STA ACCU + 0
+1cc1 : a5 1c __ LDA ACCU + 1
+1cc3 : f5 01 __ SBC $01,x
+1cc5 : 85 1c __ STA ACCU + 1
+1cc7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+1cca : b1 19 __ LDA (IP + 0),y
+1ccc : aa __ __ TAX
+1ccd : a9 00 __ LDA #$00
+1ccf : 85 05 __ STA $05
+1cd1 : 85 06 __ STA $06
+1cd3 : b5 00 __ LDA $00,x
+1cd5 : 85 03 __ STA $03
+1cd7 : b5 01 __ LDA $01,x
+1cd9 : 85 04 __ STA $04
+1cdb : a2 10 __ LDX #$10
+1cdd : 46 04 __ LSR $04
+1cdf : 66 03 __ ROR $03
+1ce1 : 90 0d __ BCC $1cf0
+1ce3 : 18 __ __ CLC
+1ce4 : a5 05 __ LDA $05
+1ce6 : 65 1b __ ADC ACCU + 0
+1ce8 : 85 05 __ STA $05
+1cea : a5 06 __ LDA $06
+1cec : 65 1c __ ADC ACCU + 1
+1cee : 85 06 __ STA $06
+1cf0 : 06 1b __ ASL ACCU + 0
+1cf2 : 26 1c __ ROL ACCU + 1
+1cf4 : ca __ __ DEX
+1cf5 : d0 e6 __ BNE $1cdd
+1cf7 : a5 05 __ LDA $05
+1cf9 : 85 1b __ STA ACCU + 0
+1cfb : a5 06 __ LDA $06
+1cfd : 85 1c __ STA ACCU + 1
+1cff : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1d02 : b1 19 __ LDA (IP + 0),y
+1d04 : aa __ __ TAX
+1d05 : b5 00 __ LDA $00,x
+1d07 : 85 03 __ STA $03
+1d09 : b5 01 __ LDA $01,x
+1d0b : 85 04 __ STA $04
+1d0d : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d10 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1d13 : b1 19 __ LDA (IP + 0),y
+1d15 : aa __ __ TAX
+1d16 : b5 00 __ LDA $00,x
+1d18 : 85 03 __ STA $03
+1d1a : b5 01 __ LDA $01,x
+1d1c : 85 04 __ STA $04
+1d1e : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d21 : a5 05 __ LDA $05
+1d23 : 85 1b __ STA ACCU + 0
+1d25 : a5 06 __ LDA $06
+1d27 : 85 1c __ STA ACCU + 1
+1d29 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1d2c : b1 19 __ LDA (IP + 0),y
+1d2e : aa __ __ TAX
+1d2f : b5 00 __ LDA $00,x
+1d31 : 85 03 __ STA $03
+1d33 : b5 01 __ LDA $01,x
+1d35 : 85 04 __ STA $04
+1d37 : 24 1c __ BIT ACCU + 1
+1d39 : 10 10 __ BPL $1d4b
+1d3b : 20 cb 17 JSR $17cb ; (negaccu + 0)
+1d3e : 24 04 __ BIT $04
+1d40 : 10 10 __ BPL $1d52
+1d42 : 20 d9 17 JSR $17d9 ; (negtmp + 0)
+1d45 : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d48 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d4b : 24 04 __ BIT $04
+1d4d : 10 f6 __ BPL $1d45
+1d4f : 20 d9 17 JSR $17d9 ; (negtmp + 0)
+1d52 : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d55 : 20 cb 17 JSR $17cb ; (negaccu + 0)
+1d58 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1d5b : b1 19 __ LDA (IP + 0),y
+1d5d : aa __ __ TAX
+1d5e : b5 00 __ LDA $00,x
+1d60 : 85 03 __ STA $03
+1d62 : b5 01 __ LDA $01,x
+1d64 : 85 04 __ STA $04
+1d66 : 24 1c __ BIT ACCU + 1
+1d68 : 10 18 __ BPL $1d82
+1d6a : 20 cb 17 JSR $17cb ; (negaccu + 0)
+1d6d : 24 04 __ BIT $04
+1d6f : 10 18 __ BPL $1d89
+1d71 : 20 d9 17 JSR $17d9 ; (negtmp + 0)
+1d74 : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d77 : a5 05 __ LDA $05
+1d79 : 85 1b __ STA ACCU + 0
+1d7b : a5 06 __ LDA $06
+1d7d : 85 1c __ STA ACCU + 1
+1d7f : 4c 50 08 JMP $0850 ; (startup + 79)
+1d82 : 24 04 __ BIT $04
+1d84 : 10 ee __ BPL $1d74
+1d86 : 20 d9 17 JSR $17d9 ; (negtmp + 0)
+1d89 : 20 e7 17 JSR $17e7 ; (divmod + 0)
+1d8c : a5 05 __ LDA $05
+1d8e : 85 1b __ STA ACCU + 0
+1d90 : a5 06 __ LDA $06
+1d92 : 85 1c __ STA ACCU + 1
+1d94 : 20 cb 17 JSR $17cb ; (negaccu + 0)
+1d97 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1d9a : b1 19 __ LDA (IP + 0),y
+1d9c : aa __ __ TAX
+1d9d : 18 __ __ CLC
+1d9e : b5 00 __ LDA $00,x
+1da0 : 65 1b __ ADC ACCU + 0
+1da2 : 95 00 __ STA $00,x
+1da4 : b5 01 __ LDA $01,x
+1da6 : 65 1c __ ADC ACCU + 1
+1da8 : 95 01 __ STA $01,x
+1daa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1dad : b1 19 __ LDA (IP + 0),y
+1daf : c8 __ __ INY
+1db0 : aa __ __ TAX
+1db1 : 18 __ __ CLC
+1db2 : b5 00 __ LDA $00,x
+1db4 : 71 19 __ ADC (IP + 0),y
+1db6 : c8 __ __ INY
+1db7 : 95 00 __ STA $00,x
+1db9 : b5 01 __ LDA $01,x
+1dbb : 71 19 __ ADC (IP + 0),y
+1dbd : 95 01 __ STA $01,x
+1dbf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1dc2 : b1 19 __ LDA (IP + 0),y
+1dc4 : c8 __ __ INY
+1dc5 : aa __ __ TAX
+1dc6 : 38 __ __ SEC
+1dc7 : b1 19 __ LDA (IP + 0),y
+1dc9 : c8 __ __ INY
+1dca : f5 00 __ SBC $00,x
+1dcc : 95 00 __ STA $00,x
+1dce : b1 19 __ LDA (IP + 0),y
+1dd0 : f5 01 __ SBC $01,x
+1dd2 : 95 01 __ STA $01,x
+1dd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1dd7 : b1 19 __ LDA (IP + 0),y
+1dd9 : c8 __ __ INY
+1dda : aa __ __ TAX
+1ddb : b5 00 __ LDA $00,x
+1ddd : 31 19 __ AND (IP + 0),y
+1ddf : c8 __ __ INY
+1de0 : 95 00 __ STA $00,x
+1de2 : b5 01 __ LDA $01,x
+1de4 : 31 19 __ AND (IP + 0),y
+1de6 : 95 01 __ STA $01,x
+1de8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1deb : b1 19 __ LDA (IP + 0),y
+1ded : c8 __ __ INY
+1dee : aa __ __ TAX
+1def : a9 00 __ LDA #$00
+1df1 : 85 05 __ STA $05
+1df3 : 85 06 __ STA $06
+1df5 : b5 00 __ LDA $00,x
+1df7 : 85 03 __ STA $03
+1df9 : b5 01 __ LDA $01,x
+1dfb : 85 04 __ STA $04
+1dfd : b1 19 __ LDA (IP + 0),y
+1dff : 4a __ __ LSR
+1e00 : 85 07 __ STA $07
+1e02 : 90 0d __ BCC $1e11
+1e04 : 18 __ __ CLC
+1e05 : a5 05 __ LDA $05
+1e07 : 65 03 __ ADC $03
+1e09 : 85 05 __ STA $05
+1e0b : a5 06 __ LDA $06
+1e0d : 65 04 __ ADC $04
+1e0f : 85 06 __ STA $06
+1e11 : 06 03 __ ASL $03
+1e13 : 26 04 __ ROL $04
+1e15 : 46 07 __ LSR $07
+1e17 : b0 eb __ BCS $1e04
+1e19 : d0 f6 __ BNE $1e11
+1e1b : a5 05 __ LDA $05
+1e1d : 95 00 __ STA $00,x
+1e1f : a5 06 __ LDA $06
+1e21 : 95 01 __ STA $01,x
+1e23 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1e26 : b1 19 __ LDA (IP + 0),y
+1e28 : c8 __ __ INY
+1e29 : aa __ __ TAX
+1e2a : 18 __ __ CLC
+1e2b : b5 00 __ LDA $00,x
+1e2d : 71 19 __ ADC (IP + 0),y
+1e2f : 95 00 __ STA $00,x
+1e31 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1e34 : b1 19 __ LDA (IP + 0),y
+1e36 : aa __ __ TAX
+1e37 : 38 __ __ SEC
+1e38 : b5 01 __ LDA $01,x
+1e3a : e5 1c __ SBC ACCU + 1
+1e3c : f0 11 __ BEQ $1e4f
+1e3e : 50 02 __ BVC $1e42
+1e40 : 49 80 __ EOR #$80
+1e42 : 30 2a __ BMI $1e6e
+1e44 : 10 33 __ BPL $1e79
+1e46 : b1 19 __ LDA (IP + 0),y
+1e48 : aa __ __ TAX
+1e49 : b5 01 __ LDA $01,x
+1e4b : c5 1c __ CMP ACCU + 1
+1e4d : d0 28 __ BNE $1e77
+1e4f : b5 00 __ LDA $00,x
+1e51 : c5 1b __ CMP ACCU + 0
+1e53 : d0 22 __ BNE $1e77
+1e55 : f0 0e __ BEQ $1e65
+1e57 : b1 19 __ LDA (IP + 0),y
+1e59 : aa __ __ TAX
+1e5a : c8 __ __ INY
+1e5b : b1 19 __ LDA (IP + 0),y
+1e5d : c5 1c __ CMP ACCU + 1
+1e5f : d0 16 __ BNE $1e77
+1e61 : e4 1b __ CPX ACCU + 0
+1e63 : d0 12 __ BNE $1e77
+1e65 : a9 00 __ LDA #$00
+1e67 : 85 1b __ STA ACCU + 0
+1e69 : 85 1c __ STA ACCU + 1
+1e6b : 4c 50 08 JMP $0850 ; (startup + 79)
+1e6e : a9 ff __ LDA #$ff
+1e70 : 85 1b __ STA ACCU + 0
+1e72 : 85 1c __ STA ACCU + 1
+1e74 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e77 : 90 f5 __ BCC $1e6e
+1e79 : a9 01 __ LDA #$01
+1e7b : 85 1b __ STA ACCU + 0
+1e7d : a9 00 __ LDA #$00
+1e7f : 85 1c __ STA ACCU + 1
+1e81 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e84 : b1 19 __ LDA (IP + 0),y
+1e86 : c8 __ __ INY
+1e87 : aa __ __ TAX
+1e88 : b1 19 __ LDA (IP + 0),y
+1e8a : 38 __ __ SEC
+1e8b : e5 1c __ SBC ACCU + 1
+1e8d : d0 af __ BNE $1e3e
+1e8f : e4 1b __ CPX ACCU + 0
+1e91 : d0 e4 __ BNE $1e77
+1e93 : f0 d0 __ BEQ $1e65
+1e95 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1e96 : b1 19 __ LDA (IP + 0),y
+1e98 : aa __ __ TAX
+1e99 : 38 __ __ SEC
+1e9a : b5 00 __ LDA $00,x
+1e9c : e5 1b __ SBC ACCU + 0
+1e9e : f0 19 __ BEQ $1eb9
+1ea0 : 50 02 __ BVC $1ea4
+1ea2 : 49 80 __ EOR #$80
+1ea4 : 30 1c __ BMI $1ec2
+1ea6 : 10 25 __ BPL $1ecd
+1ea8 : b1 19 __ LDA (IP + 0),y
+1eaa : aa __ __ TAX
+1eab : b5 00 __ LDA $00,x
+1ead : c5 1b __ CMP ACCU + 0
+1eaf : d0 1a __ BNE $1ecb
+1eb1 : f0 06 __ BEQ $1eb9
+1eb3 : b1 19 __ LDA (IP + 0),y
+1eb5 : c5 1b __ CMP ACCU + 0
+1eb7 : d0 12 __ BNE $1ecb
+1eb9 : a9 00 __ LDA #$00
+1ebb : 85 1b __ STA ACCU + 0
+1ebd : 85 1c __ STA ACCU + 1
+1ebf : 4c 50 08 JMP $0850 ; (startup + 79)
+1ec2 : a9 ff __ LDA #$ff
+1ec4 : 85 1b __ STA ACCU + 0
+1ec6 : 85 1c __ STA ACCU + 1
+1ec8 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ecb : 90 f5 __ BCC $1ec2
+1ecd : a9 01 __ LDA #$01
+1ecf : 85 1b __ STA ACCU + 0
+1ed1 : a9 00 __ LDA #$00
+1ed3 : 85 1c __ STA ACCU + 1
+1ed5 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ed8 : b1 19 __ LDA (IP + 0),y
+1eda : 38 __ __ SEC
+1edb : e5 1b __ SBC ACCU + 0
+1edd : d0 c1 __ BNE $1ea0
+1edf : f0 d8 __ BEQ $1eb9
+1ee1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1ee2 : 38 __ __ SEC
+1ee3 : a9 00 __ LDA #$00
+1ee5 : e5 1b __ SBC ACCU + 0
+1ee7 : 85 1b __ STA ACCU + 0
+1ee9 : a9 00 __ LDA #$00
+1eeb : e5 1c __ SBC ACCU + 1
+1eed : 85 1c __ STA ACCU + 1
+1eef : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1ef2 : 20 a2 15 JSR $15a2 ; (freg + 0)
+1ef5 : 20 e7 15 JSR $15e7 ; (faddsub + 0)
+1ef8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1efb : 20 a2 15 JSR $15a2 ; (freg + 0)
+1efe : a5 06 __ LDA $06
+1f00 : 49 80 __ EOR #$80
+1f02 : 85 06 __ STA $06
+1f04 : 20 e7 15 JSR $15e7 ; (faddsub + 0)
+1f07 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1f0a : 20 a2 15 JSR $15a2 ; (freg + 0)
+1f0d : 84 02 __ STY $02
+1f0f : 20 af 16 JSR $16af ; (fmul + 0)
+1f12 : a4 02 __ LDY $02
+1f14 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1f17 : 20 a2 15 JSR $15a2 ; (freg + 0)
+1f1a : 20 4d 17 JSR $174d ; (fdiv + 0)
+1f1d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1f20 : b1 19 __ LDA (IP + 0),y
+1f22 : c8 __ __ INY
+1f23 : aa __ __ TAX
+1f24 : a5 1e __ LDA ACCU + 3
+1f26 : 55 03 __ EOR $03,x
+1f28 : 29 80 __ AND #$80
+1f2a : f0 1e __ BEQ $1f4a
+1f2c : a5 1e __ LDA ACCU + 3
+1f2e : 29 7f __ AND #$7f
+1f30 : 05 1d __ ORA ACCU + 2
+1f32 : 05 1c __ ORA ACCU + 1
+1f34 : 05 1b __ ORA ACCU + 0
+1f36 : d0 0c __ BNE $1f44
+1f38 : b5 03 __ LDA $03,x
+1f3a : 29 7f __ AND #$7f
+1f3c : 15 02 __ ORA $02,x
+1f3e : 15 01 __ ORA $01,x
+1f40 : 15 00 __ ORA $00,x
+1f42 : f0 1e __ BEQ $1f62
+1f44 : a5 1e __ LDA ACCU + 3
+1f46 : 30 29 __ BMI $1f71
+1f48 : 10 36 __ BPL $1f80
+1f4a : a5 1e __ LDA ACCU + 3
+1f4c : d5 03 __ CMP $03,x
+1f4e : d0 1b __ BNE $1f6b
+1f50 : a5 1d __ LDA ACCU + 2
+1f52 : d5 02 __ CMP $02,x
+1f54 : d0 15 __ BNE $1f6b
+1f56 : a5 1c __ LDA ACCU + 1
+1f58 : d5 01 __ CMP $01,x
+1f5a : d0 0f __ BNE $1f6b
+1f5c : a5 1b __ LDA ACCU + 0
+1f5e : d5 00 __ CMP $00,x
+1f60 : d0 09 __ BNE $1f6b
+1f62 : a9 00 __ LDA #$00
+1f64 : 85 1b __ STA ACCU + 0
+1f66 : 85 1c __ STA ACCU + 1
+1f68 : 4c 51 08 JMP $0851 ; (startup + 80)
+1f6b : b0 0f __ BCS $1f7c
+1f6d : 24 1e __ BIT ACCU + 3
+1f6f : 30 0f __ BMI $1f80
+1f71 : a9 00 __ LDA #$00
+1f73 : 85 1c __ STA ACCU + 1
+1f75 : a9 01 __ LDA #$01
+1f77 : 85 1b __ STA ACCU + 0
+1f79 : 4c 51 08 JMP $0851 ; (startup + 80)
+1f7c : 24 1e __ BIT ACCU + 3
+1f7e : 30 f1 __ BMI $1f71
+1f80 : a9 ff __ LDA #$ff
+1f82 : 85 1b __ STA ACCU + 0
+1f84 : 85 1c __ STA ACCU + 1
+1f86 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+1f89 : a5 1e __ LDA ACCU + 3
+1f8b : 49 80 __ EOR #$80
+1f8d : 85 1e __ STA ACCU + 3
+1f8f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+1f92 : 20 ae 18 JSR $18ae ; (sint16_to_float + 0)
+1f95 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+1f98 : 20 6c 18 JSR $186c ; (f32_to_i16 + 0)
+1f9b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+1f9e : b1 19 __ LDA (IP + 0),y
+1fa0 : 30 0c __ BMI $1fae
+1fa2 : 38 __ __ SEC
+1fa3 : 65 19 __ ADC IP + 0
+1fa5 : 85 19 __ STA IP + 0
+1fa7 : 90 02 __ BCC $1fab
+1fa9 : e6 1a __ INC IP + 1
+1fab : 4c 51 08 JMP $0851 ; (startup + 80)
+1fae : 38 __ __ SEC
+1faf : 65 19 __ ADC IP + 0
+1fb1 : 85 19 __ STA IP + 0
+1fb3 : b0 02 __ BCS $1fb7
+1fb5 : c6 1a __ DEC IP + 1
+1fb7 : 4c 51 08 JMP $0851 ; (startup + 80)
+1fba : a5 1b __ LDA ACCU + 0
+1fbc : 05 1c __ ORA ACCU + 1
+1fbe : f0 de __ BEQ $1f9e
+1fc0 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fc3 : a5 1b __ LDA ACCU + 0
+1fc5 : 05 1c __ ORA ACCU + 1
+1fc7 : d0 d5 __ BNE $1f9e
+1fc9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fcc : a5 1c __ LDA ACCU + 1
+1fce : 30 04 __ BMI $1fd4
+1fd0 : 05 1b __ ORA ACCU + 0
+1fd2 : d0 ca __ BNE $1f9e
+1fd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fd7 : a5 1c __ LDA ACCU + 1
+1fd9 : 10 c3 __ BPL $1f9e
+1fdb : 4c 50 08 JMP $0850 ; (startup + 79)
+1fde : a5 1c __ LDA ACCU + 1
+1fe0 : 30 bc __ BMI $1f9e
+1fe2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fe5 : a5 1c __ LDA ACCU + 1
+1fe7 : 30 b5 __ BMI $1f9e
+1fe9 : 05 1b __ ORA ACCU + 0
+1feb : f0 b1 __ BEQ $1f9e
+1fed : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1ff0 : 38 __ __ SEC
+1ff1 : b1 19 __ LDA (IP + 0),y
+1ff3 : 65 19 __ ADC IP + 0
+1ff5 : aa __ __ TAX
+1ff6 : c8 __ __ INY
+1ff7 : b1 19 __ LDA (IP + 0),y
+1ff9 : 65 1a __ ADC IP + 1
+1ffb : 85 1a __ STA IP + 1
+1ffd : 86 19 __ STX IP + 0
+1fff : 4c 51 08 JMP $0851 ; (startup + 80)
+2002 : a5 1b __ LDA ACCU + 0
+2004 : 05 1c __ ORA ACCU + 1
+2006 : f0 e8 __ BEQ $1ff0
+2008 : c8 __ __ INY
+2009 : 4c 50 08 JMP $0850 ; (startup + 79)
+200c : a5 1b __ LDA ACCU + 0
+200e : 05 1c __ ORA ACCU + 1
+2010 : d0 de __ BNE $1ff0
+2012 : c8 __ __ INY
+2013 : 4c 50 08 JMP $0850 ; (startup + 79)
+2016 : a5 1c __ LDA ACCU + 1
+2018 : 30 04 __ BMI $201e
+201a : 05 1b __ ORA ACCU + 0
+201c : d0 d2 __ BNE $1ff0
+201e : c8 __ __ INY
+201f : 4c 50 08 JMP $0850 ; (startup + 79)
+2022 : a5 1c __ LDA ACCU + 1
+2024 : 10 ca __ BPL $1ff0
+2026 : c8 __ __ INY
+2027 : 4c 50 08 JMP $0850 ; (startup + 79)
+202a : a5 1c __ LDA ACCU + 1
+202c : 30 c2 __ BMI $1ff0
+202e : c8 __ __ INY
+202f : 4c 50 08 JMP $0850 ; (startup + 79)
+2032 : a5 1c __ LDA ACCU + 1
+2034 : 30 ba __ BMI $1ff0
+2036 : 05 1b __ ORA ACCU + 0
+2038 : f0 b6 __ BEQ $1ff0
+203a : c8 __ __ INY
+203b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+203e : a9 00 __ LDA #$00
+2040 : 2c a9 01 BIT $01a9 
+2043 : 85 1b __ STA ACCU + 0
+2045 : a9 00 __ LDA #$00
+2047 : 85 1c __ STA ACCU + 1
+2049 : 4c 51 08 JMP $0851 ; (startup + 80)
+204c : a5 1b __ LDA ACCU + 0
+204e : 05 1c __ ORA ACCU + 1
+2050 : f0 ef __ BEQ $2041
+2052 : d0 ea __ BNE $203e
+2054 : a5 1b __ LDA ACCU + 0
+2056 : 05 1c __ ORA ACCU + 1
+2058 : d0 e7 __ BNE $2041
+205a : f0 e2 __ BEQ $203e
+205c : a5 1c __ LDA ACCU + 1
+205e : 30 de __ BMI $203e
+2060 : 05 1b __ ORA ACCU + 0
+2062 : d0 dd __ BNE $2041
+2064 : f0 d8 __ BEQ $203e
+2066 : a5 1c __ LDA ACCU + 1
+2068 : 10 d7 __ BPL $2041
+206a : 30 d2 __ BMI $203e
+206c : a5 1c __ LDA ACCU + 1
+206e : 30 d1 __ BMI $2041
+2070 : 10 cc __ BPL $203e
+2072 : a5 1c __ LDA ACCU + 1
+2074 : 30 cb __ BMI $2041
+2076 : 05 1b __ ORA ACCU + 0
+2078 : f0 c7 __ BEQ $2041
+207a : d0 c2 __ BNE $203e
+207c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+207d : b1 19 __ LDA (IP + 0),y
+207f : 8d 93 20 STA $2093 ; (inp_jsr + 22)
+2082 : c8 __ __ INY
+2083 : b1 19 __ LDA (IP + 0),y
+2085 : 8d 94 20 STA $2094 ; (inp_jsr + 23)
+2088 : 98 __ __ TYA
+2089 : 38 __ __ SEC
+208a : 65 19 __ ADC IP + 0
+208c : 85 19 __ STA IP + 0
+208e : 90 02 __ BCC $2092
+2090 : e6 1a __ INC IP + 1
+2092 : 20 00 00 JSR $0000 
+2095 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+2098 : 98 __ __ TYA
+2099 : 18 __ __ CLC
+209a : 65 19 __ ADC IP + 0
+209c : 8d a7 20 STA $20a7 ; (inp_native + 15)
+209f : a5 1a __ LDA IP + 1
+20a1 : 69 00 __ ADC #$00
+20a3 : 8d a8 20 STA $20a8 ; (inp_native + 16)
+20a6 : 20 00 00 JSR $0000 
+20a9 : a0 00 __ LDY #$00
+20ab : b1 23 __ LDA (SP + 0),y
+20ad : 85 19 __ STA IP + 0
+20af : c8 __ __ INY
+20b0 : b1 23 __ LDA (SP + 0),y
+20b2 : 85 1a __ STA IP + 1
+20b4 : 88 __ __ DEY
+20b5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+20b8 : 38 __ __ SEC
+20b9 : a5 23 __ LDA SP + 0
+20bb : f1 19 __ SBC (IP + 0),y
+20bd : c8 __ __ INY
+20be : 85 23 __ STA SP + 0
+20c0 : a5 24 __ LDA SP + 1
+20c2 : f1 19 __ SBC (IP + 0),y
+20c4 : c8 __ __ INY
+20c5 : 85 24 __ STA SP + 1
+20c7 : b1 19 __ LDA (IP + 0),y
+20c9 : 84 02 __ STY $02
+20cb : a8 __ __ TAY
+20cc : a5 25 __ LDA FP + 0
+20ce : 91 23 __ STA (SP + 0),y
+20d0 : c8 __ __ INY
+20d1 : a5 26 __ LDA FP + 1
+20d3 : 91 23 __ STA (SP + 0),y
+20d5 : 98 __ __ TYA
+20d6 : 38 __ __ SEC
+20d7 : 65 23 __ ADC SP + 0
+20d9 : 85 25 __ STA FP + 0
+20db : a9 00 __ LDA #$00
+20dd : 65 24 __ ADC SP + 1
+20df : 85 26 __ STA FP + 1
+20e1 : 88 __ __ DEY
+20e2 : f0 08 __ BEQ $20ec
+20e4 : b9 52 00 LDA $0052,y 
+20e7 : 88 __ __ DEY
+20e8 : 91 23 __ STA (SP + 0),y
+20ea : d0 f8 __ BNE $20e4
+20ec : a4 02 __ LDY $02
+20ee : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+20f1 : b1 19 __ LDA (IP + 0),y
+20f3 : c8 __ __ INY
+20f4 : 84 02 __ STY $02
+20f6 : a8 __ __ TAY
+20f7 : b1 23 __ LDA (SP + 0),y
+20f9 : 85 25 __ STA FP + 0
+20fb : c8 __ __ INY
+20fc : b1 23 __ LDA (SP + 0),y
+20fe : 85 26 __ STA FP + 1
+2100 : 88 __ __ DEY
+2101 : f0 09 __ BEQ $210c
+2103 : 88 __ __ DEY
+2104 : b1 23 __ LDA (SP + 0),y
+2106 : 99 53 00 STA $0053,y 
+2109 : 88 __ __ DEY
+210a : 10 f8 __ BPL $2104
+210c : a4 02 __ LDY $02
+210e : 18 __ __ CLC
+210f : b1 19 __ LDA (IP + 0),y
+2111 : c8 __ __ INY
+2112 : 65 23 __ ADC SP + 0
+2114 : 85 23 __ STA SP + 0
+2116 : b1 19 __ LDA (IP + 0),y
+2118 : c8 __ __ INY
+2119 : 65 24 __ ADC SP + 1
+211b : 85 24 __ STA SP + 1
+211d : a0 01 __ LDY #$01
+211f : b1 23 __ LDA (SP + 0),y
+2121 : 85 1a __ STA IP + 1
+2123 : 88 __ __ DEY
+2124 : b1 23 __ LDA (SP + 0),y
+2126 : 85 19 __ STA IP + 0
+2128 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+212b : b1 19 __ LDA (IP + 0),y
+212d : 85 1f __ STA ADDR + 0
+212f : c8 __ __ INY
+2130 : b1 19 __ LDA (IP + 0),y
+2132 : 85 20 __ STA ADDR + 1
+2134 : c8 __ __ INY
+2135 : 98 __ __ TYA
+2136 : a0 00 __ LDY #$00
+2138 : 18 __ __ CLC
+2139 : 65 19 __ ADC IP + 0
+213b : 91 23 __ STA (SP + 0),y
+213d : c8 __ __ INY
+213e : a5 1a __ LDA IP + 1
+2140 : 69 00 __ ADC #$00
+2142 : 91 23 __ STA (SP + 0),y
+2144 : a5 1f __ LDA ADDR + 0
+2146 : 85 19 __ STA IP + 0
+2148 : a5 20 __ LDA ADDR + 1
+214a : 85 1a __ STA IP + 1
+214c : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+214f : 38 __ __ SEC
+2150 : a5 23 __ LDA SP + 0
+2152 : f1 19 __ SBC (IP + 0),y
+2154 : c8 __ __ INY
+2155 : 85 23 __ STA SP + 0
+2157 : a5 24 __ LDA SP + 1
+2159 : f1 19 __ SBC (IP + 0),y
+215b : 85 24 __ STA SP + 1
+215d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2160 : 18 __ __ CLC
+2161 : b1 19 __ LDA (IP + 0),y
+2163 : c8 __ __ INY
+2164 : 65 23 __ ADC SP + 0
+2166 : 85 23 __ STA SP + 0
+2168 : b1 19 __ LDA (IP + 0),y
+216a : 65 24 __ ADC SP + 1
+216c : 85 24 __ STA SP + 1
+216e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2171 : b1 19 __ LDA (IP + 0),y
+2173 : c8 __ __ INY
+2174 : 8d 82 21 STA $2182 ; (inp_op_extrt + 17)
+2177 : b1 19 __ LDA (IP + 0),y
+2179 : c8 __ __ INY
+217a : 8d 83 21 STA $2183 ; (inp_op_extrt + 18)
+217d : b1 19 __ LDA (IP + 0),y
+217f : c8 __ __ INY
+2180 : aa __ __ TAX
+2181 : 20 00 00 JSR $0000 
+2184 : 4c 51 08 JMP $0851 ; (startup + 80)
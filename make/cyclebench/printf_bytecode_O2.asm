@@ -0,0 +1,3069 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 4f 22 STX $224f ; (spentry + 0)
+0811 : a9 50 __ LDA #$50
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 b4 __ LDA #$b4
+0832 : e9 50 __ SBC #$50
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	LEA	T2, buffer + 0
+0a11:	MOV	2(SP), T2
+0a14:	LEA	T3, $15cb
+0a18:	MOV	4(SP), T3
+0a1b:	MOV	ACCU, #$014b
+0a1f:	MUL	ACCU, T1
+0a21:	ADD	ACCU, #$C180
+0a25:	MOV	6(SP), ACCU
+0a28:	MOV	ACCU, #$0269
+0a2c:	MUL	ACCU, T1
+0a2e:	MOV	8(SP), ACCU
+0a31:	MOV	ACCU, T1
+0a33:	MUL	ACCU, #97
+0a36:	MOV	10(SP), ACCU
+0a39:	MOV	12(SP), T1
+0a3c:	MOV	ACCU, T1
+0a3e:	NEG	ACCU
+0a3f:	MOV	14(SP), ACCU
+0a42:	LEA	T3, $15e0
+0a46:	MOV	16(SP), T3
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	ACCU, T2
+0a4e:	MOV	P0, ACCU
+0a50:	JSR	strlen + 0
+0a53:	ADD	T0, ACCU
+0a55:	MOVUB	ACCU, buffer + 0
+0a59:	BNEF	$0AEB
+0a5c:	ADD	T1, #$0001
+0a60:	MOV	ACCU, T1
+0a62:	CMPS	ACCU, #$0064
+0a65:	BGT	$0A0D
+0a67:	MOV	T1, #0
+0a6a:	LEA	T2, $1616
+0a6e:	LEA	T3, buffer + 0
+0a72:	MOV	2(SP), T3
+0a75:	MOV	4(SP), T2
+0a78:	MOV	ACCU, T1
+0a7a:	CNVSF	ACCU
+0a7b:	MOVD	T6, ACCU
+0a7d:	MOVD	$03, #$3fa00000
+0a83:	MULF	ACCU, $03
+0a85:	MOVD	6(SP), ACCU
+0a88:	MOVD	ACCU, T6
+0a8a:	MOVD	$03, #$bd800000
+0a90:	MULF	ACCU, $03
+0a92:	MOVD	10(SP), ACCU
+0a95:	CALL	sprintf + 0
+0a98:	MOV	ACCU, T3
+0a9a:	MOV	P0, ACCU
+0a9c:	JSR	strlen + 0
+0a9f:	ADD	T1, #$0001
+0aa3:	ADD	T0, ACCU
+0aa5:	MOV	ACCU, T1
+0aa7:	CMPS	ACCU, #$0014
+0aaa:	BGT	$0A72
+0aac:	MOV	2(SP), T3
+0aaf:	LEA	T1, $161f
+0ab3:	MOV	4(SP), T1
+0ab6:	MOV	ACCU, #-123
+0ab9:	MOV	6(SP), ACCU
+0abc:	LEA	T1, $1628
+0ac0:	MOV	8(SP), T1
+0ac3:	MOV	ACCU, #$beef
+0ac7:	MOV	10(SP), ACCU
+0aca:	CALL	sprintf + 0
+0acd:	MOV	ACCU, T3
+0acf:	MOV	P0, ACCU
+0ad1:	LEA	P2, $165c
+0ad5:	JSR	strcmp + 0
+0ad8:	BNE	$0AE1
+0ada:	MOV	ACCU, T0
+0adc:	SEQ
+0add:	MOVB	T4, ACCU
+0adf:	JUMP	$0AE4
+0ae1:	MOV	ACCU, #1
+0ae4:	POP	#$0012
+0ae7:	RETURN	8, 10
+0aeb:	MOV	T2, #0
+0aee:	LEAX	ADDR, buffer + 0 + T2
+0af2:	MOVB	T4, 0(ADDR)
+0af5:	LEAX	ADDR, buffer + 1 + T2
+0af9:	MOVB	ACCU, T4
+0afb:	ADD	T0, ACCU
+0afd:	MOVUB	ACCU, 0(ADDR)
+0b00:	ADD	T2, #$0001
+0b04:	BNE	$0AEE
+0b06:	JUMPF	$0A5C
+--------------------------------------------------------------------
+sprintf:
+0b09:	ENTER	10, 20
+0b0d:	PUSH	#$0002
+0b10:	MOVB	T0, #0
+0b13:	MOV	T1, 12(FP)
+0b16:	MOV	ADDR, T1
+0b18:	MOVB	T2, 0(ADDR)
+0b1b:	MOV	T3, 10(FP)
+0b1e:	MOVB	ACCU, T2
+0b20:	BNE	$0B46
+0b22:	MOVB	ACCU, T0
+0b24:	ADD	ACCU, T3
+0b26:	MOV	T1, ACCU
+0b28:	MOV	ACCU, #0
+0b2b:	MOV	ADDR, T1
+0b2d:	MOVB	0(ADDR), ACCU
+0b30:	MOVB	ACCU, T0
+0b32:	BNE	$0B38
+0b34:	MOV	ACCU, T3
+0b36:	MOV	T1, ACCU
+0b38:	MOV	T3, 10(FP)
+0b3b:	MOV	ACCU, T1
+0b3d:	SUB	ACCU, T3
+0b3f:	POP	#$0002
+0b42:	RETURN	10, 20
+0b46:	LEA	T4, 14(FP)
+0b4a:	ADD	T1, #$0001
+0b4e:	MOVB	ACCU, T2
+0b50:	CMPUB	ACCU, #$0025
+0b52:	BEQ	$0B87
+0b54:	MOVB	ACCU, T0
+0b56:	LEAX	ADDR, T3 + ACCU
+0b58:	MOVB	0(ADDR), T2
+0b5b:	ADDB	T0, #$0001
+0b5e:	MOVB	ACCU, T0
+0b60:	CMPUB	ACCU, #$0028
+0b62:	BLE	$0B6F
+0b64:	MOV	ADDR, T1
+0b66:	MOVB	T5, 0(ADDR)
+0b69:	ADD	T1, #$0001
+0b6d:	JUMP	$0B7F
+0b6f:	MOVB	ACCU, T0
+0b71:	ADD	T3, ACCU
+0b73:	MOVB	T0, #0
+0b76:	MOV	ADDR, T1
+0b78:	MOVB	T5, 0(ADDR)
+0b7b:	ADD	T1, #$0001
+0b7f:	MOVB	ACCU, T5
+0b81:	MOVB	T2, ACCU
+0b83:	BNE	$0B4E
+0b85:	JUMP	$0B22
+0b87:	MOVB	ACCU, T0
+0b89:	BEQ	$0B92
+0b8b:	MOVB	ACCU, T0
+0b8d:	ADD	T3, ACCU
+0b8f:	MOVB	T0, #0
+0b92:	MOV	ADDR, T1
+0b94:	MOVB	T2, 0(ADDR)
+0b97:	MOV	ACCU, #10
+0b9a:	MOV	3(FP), ACCU
+0b9d:	MOV	ACCU, #1
+0ba0:	MOVB	1(FP), ACCU
+0ba3:	MOV	ACCU, #255
+0ba6:	MOVB	2(FP), ACCU
+0ba9:	MOV	ACCU, #32
+0bac:	MOVB	0(FP), ACCU
+0baf:	MOV	ACCU, #0
+0bb2:	MOVB	5(FP), ACCU
+0bb5:	MOVB	6(FP), ACCU
+0bb8:	MOVB	7(FP), ACCU
+0bbb:	ADD	T1, #$0001
+0bbf:	MOVB	ACCU, T2
+0bc1:	CMPUB	ACCU, #$002B
+0bc3:	BEQF	$110B
+0bc6:	MOVB	ACCU, T2
+0bc8:	CMPUB	ACCU, #$0030
+0bca:	BEQF	$10FD
+0bcd:	MOVB	ACCU, T2
+0bcf:	CMPUB	ACCU, #$0023
+0bd1:	BEQF	$10EF
+0bd4:	MOVB	ACCU, T2
+0bd6:	CMPUB	ACCU, #$0030
+0bd8:	BGT	$0BE1
+0bda:	MOVB	ACCU, T2
+0bdc:	CMPUB	ACCU, #$0039
+0bde:	BGEF	$10BE
+0be1:	MOVB	ACCU, T2
+0be3:	CMPUB	ACCU, #$002E
+0be5:	BEQF	$1084
+0be8:	MOVB	ACCU, T2
+0bea:	CMPUB	ACCU, #$0064
+0bec:	BEQF	$0F50
+0bef:	MOVB	ACCU, T2
+0bf1:	CMPUB	ACCU, #$0075
+0bf3:	BEQF	$0E53
+0bf6:	MOVB	ACCU, T2
+0bf8:	CMPUB	ACCU, #$0078
+0bfa:	BEQF	$0D44
+0bfd:	MOVB	ACCU, T2
+0bff:	CMPUB	ACCU, #$006C
+0c01:	BEQF	$0CB9
+0c04:	MOVB	ACCU, T2
+0c06:	CMPUB	ACCU, #$0066
+0c08:	BEQF	$0C8F
+0c0b:	MOVB	ACCU, T2
+0c0d:	CMPUB	ACCU, #$0067
+0c0f:	BEQ	$0C8F
+0c11:	MOVB	ACCU, T2
+0c13:	CMPUB	ACCU, #$0065
+0c15:	BEQ	$0C8F
+0c17:	MOVB	ACCU, T2
+0c19:	CMPUB	ACCU, #$0073
+0c1b:	BEQ	$0C5D
+0c1d:	MOVB	ACCU, T2
+0c1f:	CMPUB	ACCU, #$0063
+0c21:	BEQ	$0C3E
+0c23:	MOVB	ACCU, T2
+0c25:	BEQF	$0B64
+0c28:	MOVB	ACCU, T0
+0c2a:	LEAX	ADDR, T3 + ACCU
+0c2c:	MOVB	0(ADDR), T2
+0c2f:	ADDB	T0, #$0001
+0c32:	MOV	ADDR, T1
+0c34:	MOVB	T5, 0(ADDR)
+0c37:	ADD	T1, #$0001
+0c3b:	JUMPF	$0B7F
+0c3e:	MOVB	ACCU, T0
+0c40:	MOV	ADDR, T4
+0c42:	MOV	T7, 0(ADDR)
+0c45:	LEAX	ADDR, T3 + ACCU
+0c47:	MOVB	0(ADDR), T7
+0c4a:	ADD	T4, #$0002
+0c4e:	ADDB	T0, #$0001
+0c51:	MOV	ADDR, T1
+0c53:	MOVB	T5, 0(ADDR)
+0c56:	ADD	T1, #$0001
+0c5a:	JUMPF	$0B7F
+0c5d:	MOV	ADDR, T4
+0c5f:	MOV	T6, 0(ADDR)
+0c62:	ADD	T4, #$0002
+0c66:	MOV	ADDR, T6
+0c68:	MOVB	T2, 0(ADDR)
+0c6b:	MOVB	ACCU, T2
+0c6d:	BEQF	$0B64
+0c70:	ADD	T6, #$0001
+0c74:	MOV	ADDR, T3
+0c76:	MOVB	0(ADDR), T2
+0c79:	ADD	T3, #$0001
+0c7d:	MOV	ADDR, T6
+0c7f:	MOVB	T5, 0(ADDR)
+0c82:	ADD	T6, #$0001
+0c86:	MOVB	ACCU, T5
+0c88:	MOVB	T2, ACCU
+0c8a:	BNE	$0C74
+0c8c:	JUMPF	$0B64
+0c8f:	LEA	P0, 0(FP)
+0c93:	MOV	ACCU, T3
+0c95:	MOV	P2, ACCU
+0c97:	MOV	ADDR, T4
+0c99:	MOVD	T11, 0(ADDR)
+0c9c:	MOVD	ACCU, T11
+0c9e:	MOVD	P4, ACCU
+0ca0:	MOVB	ACCU, T2
+0ca2:	MOVB	P8, ACCU
+0ca4:	CALL	nformf + 0
+0ca7:	MOV	T0, ACCU
+0ca9:	ADD	T4, #$0004
+0cad:	MOV	ADDR, T1
+0caf:	MOVB	T5, 0(ADDR)
+0cb2:	ADD	T1, #$0001
+0cb6:	JUMPF	$0B7F
+0cb9:	MOV	ADDR, T4
+0cbb:	MOVD	T11, 0(ADDR)
+0cbe:	ADD	T4, #$0004
+0cc2:	MOV	ADDR, T1
+0cc4:	MOVB	T2, 0(ADDR)
+0cc7:	ADD	T1, #$0001
+0ccb:	MOVB	ACCU, T2
+0ccd:	CMPUB	ACCU, #$0064
+0ccf:	BEQ	$0D24
+0cd1:	MOVB	ACCU, T2
+0cd3:	CMPUB	ACCU, #$0075
+0cd5:	BEQ	$0D04
+0cd7:	MOVB	ACCU, T2
+0cd9:	CMPUB	ACCU, #$0078
+0cdb:	BNEF	$0B64
+0cde:	MOV	ACCU, #16
+0ce1:	MOV	3(FP), ACCU
+0ce4:	LEA	P0, 0(FP)
+0ce8:	MOV	ACCU, T3
+0cea:	MOV	P2, ACCU
+0cec:	MOVD	ACCU, T11
+0cee:	MOVD	P4, ACCU
+0cf0:	MOVB	P8, #0
+0cf3:	CALL	nforml + 0
+0cf6:	MOV	T0, ACCU
+0cf8:	MOV	ADDR, T1
+0cfa:	MOVB	T5, 0(ADDR)
+0cfd:	ADD	T1, #$0001
+0d01:	JUMPF	$0B7F
+0d04:	LEA	P0, 0(FP)
+0d08:	MOV	ACCU, T3
+0d0a:	MOV	P2, ACCU
+0d0c:	MOVD	ACCU, T11
+0d0e:	MOVD	P4, ACCU
+0d10:	MOVB	P8, #0
+0d13:	CALL	nforml + 0
+0d16:	MOV	T0, ACCU
+0d18:	MOV	ADDR, T1
+0d1a:	MOVB	T5, 0(ADDR)
+0d1d:	ADD	T1, #$0001
+0d21:	JUMPF	$0B7F
+0d24:	LEA	P0, 0(FP)
+0d28:	MOV	ACCU, T3
+0d2a:	MOV	P2, ACCU
+0d2c:	MOVD	ACCU, T11
+0d2e:	MOVD	P4, ACCU
+0d30:	MOVB	P8, #1
+0d33:	CALL	nforml + 0
+0d36:	MOV	T0, ACCU
+0d38:	MOV	ADDR, T1
+0d3a:	MOVB	T5, 0(ADDR)
+0d3d:	ADD	T1, #$0001
+0d41:	JUMPF	$0B7F
+0d44:	MOV	ACCU, #16
+0d47:	MOV	3(FP), ACCU
+0d4a:	MOV	ACCU, T3
+0d4c:	MOV	T6, ACCU
+0d4e:	MOV	ADDR, T4
+0d50:	MOV	T7, 0(ADDR)
+0d53:	ADD	T4, #$0002
+0d57:	MOVB	T0, #10
+0d5a:	MOV	ACCU, T7
+0d5c:	BNEF	$0E23
+0d5f:	MOVB	T2, 2(FP)
+0d62:	MOVB	ACCU, T2
+0d64:	CMPUB	ACCU, #$00FF
+0d66:	BNEF	$0E13
+0d69:	MOVB	T2, #9
+0d6c:	MOVB	ACCU, T0
+0d6e:	CMPUB	ACCU, #$0009
+0d70:	BGE	$0D85
+0d72:	ADDB	T0, #$00FF
+0d75:	MOVB	ACCU, T0
+0d77:	LEAX	ADDR, T6 + ACCU
+0d79:	MOV	ACCU, #48
+0d7c:	MOVB	0(ADDR), ACCU
+0d7f:	MOVB	ACCU, T2
+0d81:	CMPUB	ACCU, T0
+0d83:	BGT	$0D72
+0d85:	MOVUB	ACCU, 7(FP)
+0d88:	BEQ	$0DAE
+0d8a:	MOV	ACCU, 3(FP)
+0d8d:	CMPU	ACCU, #$0010
+0d90:	BNE	$0DAE
+0d92:	MOVB	ACCU, T0
+0d94:	ADDB	ACCU, #$00FF
+0d97:	MOVB	ACCU, ACCU
+0d99:	LEAX	ADDR, T6 + ACCU
+0d9b:	MOV	ACCU, #88
+0d9e:	MOVB	0(ADDR), ACCU
+0da1:	ADDB	T0, #$00FE
+0da4:	MOVB	ACCU, T0
+0da6:	LEAX	ADDR, T6 + ACCU
+0da8:	MOV	ACCU, #48
+0dab:	MOVB	0(ADDR), ACCU
+0dae:	MOVUB	ACCU, 5(FP)
+0db1:	BEQ	$0DC0
+0db3:	ADDB	T0, #$00FF
+0db6:	MOVB	ACCU, T0
+0db8:	LEAX	ADDR, T6 + ACCU
+0dba:	MOV	ACCU, #43
+0dbd:	MOVB	0(ADDR), ACCU
+0dc0:	MOVUB	T7, 1(FP)
+0dc3:	SUBR	T7, #$000A
+0dc7:	MOVB	ACCU, T0
+0dc9:	MOV	T8, ACCU
+0dcb:	MOV	ACCU, T7
+0dcd:	CMPS	ACCU, T8
+0dcf:	BGT	$0E04
+0dd1:	MOVB	T2, #0
+0dd4:	MOVB	ACCU, T0
+0dd6:	CMPUB	ACCU, #$000A
+0dd8:	BLE	$0DF4
+0dda:	MOVB	ACCU, T0
+0ddc:	LEAX	ADDR, T6 + ACCU
+0dde:	MOVB	T5, 0(ADDR)
+0de1:	MOVB	ACCU, T2
+0de3:	LEAX	ADDR, T6 + ACCU
+0de5:	MOVB	0(ADDR), T5
+0de8:	ADDB	T2, #$0001
+0deb:	ADDB	T0, #$0001
+0dee:	MOVB	ACCU, T0
+0df0:	CMPUB	ACCU, #$000A
+0df2:	BGT	$0DDA
+0df4:	MOV	ADDR, T1
+0df6:	MOVB	T5, 0(ADDR)
+0df9:	ADD	T1, #$0001
+0dfd:	MOVB	ACCU, T2
+0dff:	MOV	T0, ACCU
+0e01:	JUMPF	$0B7F
+0e04:	ADDB	T0, #$00FF
+0e07:	MOVB	ACCU, T0
+0e09:	LEAX	ADDR, T6 + ACCU
+0e0b:	MOVB	T2, 0(FP)
+0e0e:	MOVB	0(ADDR), T2
+0e11:	JUMP	$0DC0
+0e13:	MOVB	ACCU, T2
+0e15:	SUBR	ACCU, #$000A
+0e19:	MOV	T2, ACCU
+0e1b:	CMPUB	ACCU, T0
+0e1d:	BGTF	$0D72
+0e20:	JUMPF	$0D85
+0e23:	MOV	T8, 3(FP)
+0e26:	MOV	ACCU, T7
+0e28:	MODU	ACCU, T8
+0e2a:	MOV	T8, ACCU
+0e2c:	CMPS	ACCU, #$000A
+0e2f:	BLE	$0E37
+0e31:	ADD	T8, #$0030
+0e35:	JUMP	$0E3B
+0e37:	ADD	T8, #$0037
+0e3b:	ADDB	T0, #$00FF
+0e3e:	MOVB	ACCU, T0
+0e40:	LEAX	ADDR, T6 + ACCU
+0e42:	MOVB	0(ADDR), T8
+0e45:	MOV	T8, 3(FP)
+0e48:	MOV	ACCU, T7
+0e4a:	DIVU	ACCU, T8
+0e4c:	MOV	T7, ACCU
+0e4e:	BNE	$0E23
+0e50:	JUMPF	$0D5F
+0e53:	MOV	ACCU, T3
+0e55:	MOV	T6, ACCU
+0e57:	MOV	ADDR, T4
+0e59:	MOV	T7, 0(ADDR)
+0e5c:	ADD	T4, #$0002
+0e60:	MOVB	T0, #10
+0e63:	MOV	ACCU, T7
+0e65:	BNEF	$0F20
+0e68:	MOVB	T2, 2(FP)
+0e6b:	MOVB	ACCU, T2
+0e6d:	CMPUB	ACCU, #$00FF
+0e6f:	BNEF	$0F10
+0e72:	MOVB	T2, #9
+0e75:	MOVB	ACCU, T0
+0e77:	CMPUB	ACCU, #$0009
+0e79:	BGE	$0E8E
+0e7b:	ADDB	T0, #$00FF
+0e7e:	MOVB	ACCU, T0
+0e80:	LEAX	ADDR, T6 + ACCU
+0e82:	MOV	ACCU, #48
+0e85:	MOVB	0(ADDR), ACCU
+0e88:	MOVB	ACCU, T2
+0e8a:	CMPUB	ACCU, T0
+0e8c:	BGT	$0E7B
+0e8e:	MOVUB	ACCU, 7(FP)
+0e91:	BEQ	$0EB7
+0e93:	MOV	ACCU, 3(FP)
+0e96:	CMPU	ACCU, #$0010
+0e99:	BNE	$0EB7
+0e9b:	MOVB	ACCU, T0
+0e9d:	ADDB	ACCU, #$00FF
+0ea0:	MOVB	ACCU, ACCU
+0ea2:	LEAX	ADDR, T6 + ACCU
+0ea4:	MOV	ACCU, #88
+0ea7:	MOVB	0(ADDR), ACCU
+0eaa:	ADDB	T0, #$00FE
+0ead:	MOVB	ACCU, T0
+0eaf:	LEAX	ADDR, T6 + ACCU
+0eb1:	MOV	ACCU, #48
+0eb4:	MOVB	0(ADDR), ACCU
+0eb7:	MOVUB	ACCU, 5(FP)
+0eba:	BEQ	$0EC9
+0ebc:	ADDB	T0, #$00FF
+0ebf:	MOVB	ACCU, T0
+0ec1:	LEAX	ADDR, T6 + ACCU
+0ec3:	MOV	ACCU, #43
+0ec6:	MOVB	0(ADDR), ACCU
+0ec9:	MOVUB	T7, 1(FP)
+0ecc:	SUBR	T7, #$000A
+0ed0:	MOVB	ACCU, T0
+0ed2:	MOV	T8, ACCU
+0ed4:	MOV	ACCU, T7
+0ed6:	CMPS	ACCU, T8
+0ed8:	BGT	$0F01
+0eda:	MOVB	T2, #0
+0edd:	MOVB	ACCU, T0
+0edf:	CMPUB	ACCU, #$000A
+0ee1:	BLEF	$0DF4
+0ee4:	MOVB	ACCU, T0
+0ee6:	LEAX	ADDR, T6 + ACCU
+0ee8:	MOVB	T5, 0(ADDR)
+0eeb:	MOVB	ACCU, T2
+0eed:	LEAX	ADDR, T6 + ACCU
+0eef:	MOVB	0(ADDR), T5
+0ef2:	ADDB	T2, #$0001
+0ef5:	ADDB	T0, #$0001
+0ef8:	MOVB	ACCU, T0
+0efa:	CMPUB	ACCU, #$000A
+0efc:	BGT	$0EE4
+0efe:	JUMPF	$0DF4
+0f01:	ADDB	T0, #$00FF
+0f04:	MOVB	ACCU, T0
+0f06:	LEAX	ADDR, T6 + ACCU
+0f08:	MOVB	T2, 0(FP)
+0f0b:	MOVB	0(ADDR), T2
+0f0e:	JUMP	$0EC9
+0f10:	MOVB	ACCU, T2
+0f12:	SUBR	ACCU, #$000A
+0f16:	MOV	T2, ACCU
+0f18:	CMPUB	ACCU, T0
+0f1a:	BGTF	$0E7B
+0f1d:	JUMPF	$0E8E
+0f20:	MOV	T8, 3(FP)
+0f23:	MOV	ACCU, T7
+0f25:	MODU	ACCU, T8
+0f27:	MOV	T8, ACCU
+0f29:	CMPS	ACCU, #$000A
+0f2c:	BLE	$0F34
+0f2e:	ADD	T8, #$0030
+0f32:	JUMP	$0F38
+0f34:	ADD	T8, #$0037
+0f38:	ADDB	T0, #$00FF
+0f3b:	MOVB	ACCU, T0
+0f3d:	LEAX	ADDR, T6 + ACCU
+0f3f:	MOVB	0(ADDR), T8
+0f42:	MOV	T8, 3(FP)
+0f45:	MOV	ACCU, T7
+0f47:	DIVU	ACCU, T8
+0f49:	MOV	T7, ACCU
+0f4b:	BNE	$0F20
+0f4d:	JUMPF	$0E68
+0f50:	MOV	ACCU, T3
+0f52:	MOV	T6, ACCU
+0f54:	MOV	ADDR, T4
+0f56:	MOV	T7, 0(ADDR)
+0f59:	ADD	T4, #$0002
+0f5d:	MOV	ACCU, T7
+0f5f:	BLTF	$1076
+0f62:	MOV	T8, ACCU
+0f64:	MOVB	T0, #0
+0f67:	MOVB	T2, #10
+0f6a:	MOV	ACCU, T7
+0f6c:	BNEF	$1046
+0f6f:	MOVB	T5, 2(FP)
+0f72:	MOVB	ACCU, T5
+0f74:	CMPUB	ACCU, #$00FF
+0f76:	BNEF	$1036
+0f79:	MOVB	T5, #9
+0f7c:	MOVB	ACCU, T2
+0f7e:	CMPUB	ACCU, #$0009
+0f80:	BGE	$0F95
+0f82:	ADDB	T2, #$00FF
+0f85:	MOVB	ACCU, T2
+0f87:	LEAX	ADDR, T6 + ACCU
+0f89:	MOV	ACCU, #48
+0f8c:	MOVB	0(ADDR), ACCU
+0f8f:	MOVB	ACCU, T5
+0f91:	CMPUB	ACCU, T2
+0f93:	BGT	$0F82
+0f95:	MOVUB	ACCU, 7(FP)
+0f98:	BEQ	$0FBE
+0f9a:	MOV	ACCU, 3(FP)
+0f9d:	CMPU	ACCU, #$0010
+0fa0:	BNE	$0FBE
+0fa2:	MOVB	ACCU, T2
+0fa4:	ADDB	ACCU, #$00FF
+0fa7:	MOVB	ACCU, ACCU
+0fa9:	LEAX	ADDR, T6 + ACCU
+0fab:	MOV	ACCU, #88
+0fae:	MOVB	0(ADDR), ACCU
+0fb1:	ADDB	T2, #$00FE
+0fb4:	MOVB	ACCU, T2
+0fb6:	LEAX	ADDR, T6 + ACCU
+0fb8:	MOV	ACCU, #48
+0fbb:	MOVB	0(ADDR), ACCU
+0fbe:	MOVB	ACCU, T0
+0fc0:	BNE	$1027
+0fc2:	MOVUB	ACCU, 5(FP)
+0fc5:	BEQ	$0FD4
+0fc7:	ADDB	T2, #$00FF
+0fca:	MOVB	ACCU, T2
+0fcc:	LEAX	ADDR, T6 + ACCU
+0fce:	MOV	ACCU, #43
+0fd1:	MOVB	0(ADDR), ACCU
+0fd4:	MOVUB	T7, 1(FP)
+0fd7:	SUBR	T7, #$000A
+0fdb:	MOVB	ACCU, T2
+0fdd:	MOV	T8, ACCU
+0fdf:	MOV	ACCU, T7
+0fe1:	CMPS	ACCU, T8
+0fe3:	BGT	$1018
+0fe5:	MOVB	T0, #0
+0fe8:	MOVB	ACCU, T2
+0fea:	CMPUB	ACCU, #$000A
+0fec:	BLE	$1008
+0fee:	MOVB	ACCU, T2
+0ff0:	LEAX	ADDR, T6 + ACCU
+0ff2:	MOVB	T5, 0(ADDR)
+0ff5:	MOVB	ACCU, T0
+0ff7:	LEAX	ADDR, T6 + ACCU
+0ff9:	MOVB	0(ADDR), T5
+0ffc:	ADDB	T0, #$0001
+0fff:	ADDB	T2, #$0001
+1002:	MOVB	ACCU, T2
+1004:	CMPUB	ACCU, #$000A
+1006:	BGT	$0FEE
+1008:	MOV	ADDR, T1
+100a:	MOVB	T5, 0(ADDR)
+100d:	ADD	T1, #$0001
+1011:	AND	T0, #$00FF
+1015:	JUMPF	$0B7F
+1018:	ADDB	T2, #$00FF
+101b:	MOVB	ACCU, T2
+101d:	LEAX	ADDR, T6 + ACCU
+101f:	MOVB	T0, 0(FP)
+1022:	MOVB	0(ADDR), T0
+1025:	JUMP	$0FD4
+1027:	ADDB	T2, #$00FF
+102a:	MOVB	ACCU, T2
+102c:	LEAX	ADDR, T6 + ACCU
+102e:	MOV	ACCU, #45
+1031:	MOVB	0(ADDR), ACCU
+1034:	JUMP	$0FD4
+1036:	MOVB	ACCU, T5
+1038:	SUBR	ACCU, #$000A
+103c:	MOV	T5, ACCU
+103e:	CMPUB	ACCU, T2
+1040:	BGTF	$0F82
+1043:	JUMPF	$0F95
+1046:	MOV	T7, 3(FP)
+1049:	MOV	ACCU, T8
+104b:	MODU	ACCU, T7
+104d:	MOV	T7, ACCU
+104f:	CMPS	ACCU, #$000A
+1052:	BLE	$105A
+1054:	ADD	T7, #$0030
+1058:	JUMP	$105E
+105a:	ADD	T7, #$0037
+105e:	ADDB	T2, #$00FF
+1061:	MOVB	ACCU, T2
+1063:	LEAX	ADDR, T6 + ACCU
+1065:	MOVB	0(ADDR), T7
+1068:	MOV	T7, 3(FP)
+106b:	MOV	ACCU, T8
+106d:	DIVU	ACCU, T7
+106f:	MOV	T8, ACCU
+1071:	BNE	$1046
+1073:	JUMPF	$0F6F
+1076:	MOVB	T0, #1
+1079:	MOVB	T2, #10
+107c:	NEG	ACCU
+107d:	MOV	T8, ACCU
+107f:	BNE	$1046
+1081:	JUMPF	$0F6F
+1084:	MOV	T6, #0
+1087:	MOV	ADDR, T1
+1089:	MOVB	T2, 0(ADDR)
+108c:	ADD	T1, #$0001
+1090:	MOVB	ACCU, T2
+1092:	CMPUB	ACCU, #$0030
+1094:	BGT	$10B8
+1096:	MOVB	ACCU, T2
+1098:	CMPUB	ACCU, #$0039
+109a:	BLT	$10B8
+109c:	MOVB	ACCU, T2
+109e:	MOV	T7, ACCU
+10a0:	MOV	ADDR, T1
+10a2:	MOVB	T2, 0(ADDR)
+10a5:	ADD	T1, #$0001
+10a9:	MUL	T6, #10
+10ac:	ADD	T6, ACCU
+10ae:	ADD	T6, #$FFD0
+10b2:	MOVB	ACCU, T2
+10b4:	CMPUB	ACCU, #$0030
+10b6:	BLE	$1096
+10b8:	MOVB	2(FP), T6
+10bb:	JUMPF	$0BE8
+10be:	MOV	T6, #0
+10c1:	MOVB	ACCU, T2
+10c3:	CMPUB	ACCU, #$0030
+10c5:	BGT	$10E9
+10c7:	MOVB	ACCU, T2
+10c9:	CMPUB	ACCU, #$0039
+10cb:	BLT	$10E9
+10cd:	MOVB	ACCU, T2
+10cf:	MOV	T7, ACCU
+10d1:	MOV	ADDR, T1
+10d3:	MOVB	T2, 0(ADDR)
+10d6:	ADD	T1, #$0001
+10da:	MUL	T6, #10
+10dd:	ADD	T6, ACCU
+10df:	ADD	T6, #$FFD0
+10e3:	MOVB	ACCU, T2
+10e5:	CMPUB	ACCU, #$0030
+10e7:	BLE	$10C7
+10e9:	MOVB	1(FP), T6
+10ec:	JUMPF	$0BE1
+10ef:	MOV	ACCU, #1
+10f2:	MOVB	7(FP), ACCU
+10f5:	MOV	ADDR, T1
+10f7:	MOVB	T2, 0(ADDR)
+10fa:	JUMPF	$0BBB
+10fd:	MOV	ACCU, #48
+1100:	MOVB	0(FP), ACCU
+1103:	MOV	ADDR, T1
+1105:	MOVB	T2, 0(ADDR)
+1108:	JUMPF	$0BBB
+110b:	MOV	ACCU, #1
+110e:	MOVB	5(FP), ACCU
+1111:	MOV	ADDR, T1
+1113:	MOVB	T2, 0(ADDR)
+1116:	JUMPF	$0BBB
+--------------------------------------------------------------------
+nforml:
+1119:	ENTER	5, 7
+111d:	MOVD	ACCU, P4
+111f:	MOVD	T0, ACCU
+1121:	MOVD	T1, ACCU
+1123:	MOV	ACCU, P2
+1125:	MOV	T2, ACCU
+1127:	MOVB	T3, #0
+112a:	MOVB	ACCU, P8
+112c:	BEQ	$113B
+112e:	MOVD	ACCU, #$00000000
+1134:	EXTRT	T0, inp_op_cmp_s32 + 0
+1138:	BLTF	$1280
+113b:	MOVB	T4, #16
+113e:	MOVD	ACCU, #$00000000
+1144:	EXTRT	T0, inp_op_cmp_u32 + 0
+1148:	BGTF	$1228
+114b:	MOV	ADDR, P0
+114d:	MOVB	T5, 2(ADDR)
+1150:	MOVB	ACCU, T5
+1152:	CMPUB	ACCU, #$00FF
+1154:	BNEF	$1218
+1157:	MOVB	T5, #15
+115a:	MOVB	ACCU, T4
+115c:	CMPUB	ACCU, #$000F
+115e:	BGE	$1173
+1160:	ADDB	T4, #$00FF
+1163:	MOVB	ACCU, T4
+1165:	LEAX	ADDR, T2 + ACCU
+1167:	MOV	ACCU, #48
+116a:	MOVB	0(ADDR), ACCU
+116d:	MOVB	ACCU, T5
+116f:	CMPUB	ACCU, T4
+1171:	BGT	$1160
+1173:	MOV	ACCU, P0
+1175:	MOV	T6, ACCU
+1177:	MOV	ADDR, T6
+1179:	MOVUB	ACCU, 7(ADDR)
+117c:	BEQ	$11A2
+117e:	MOV	ACCU, 3(ADDR)
+1181:	CMPU	ACCU, #$0010
+1184:	BNE	$11A2
+1186:	MOVB	ACCU, T4
+1188:	ADDB	ACCU, #$00FF
+118b:	MOVB	ACCU, ACCU
+118d:	LEAX	ADDR, T2 + ACCU
+118f:	MOV	ACCU, #88
+1192:	MOVB	0(ADDR), ACCU
+1195:	ADDB	T4, #$00FE
+1198:	MOVB	ACCU, T4
+119a:	LEAX	ADDR, T2 + ACCU
+119c:	MOV	ACCU, #48
+119f:	MOVB	0(ADDR), ACCU
+11a2:	MOVB	ACCU, T3
+11a4:	BNE	$1209
+11a6:	MOV	ADDR, T6
+11a8:	MOVUB	ACCU, 5(ADDR)
+11ab:	BEQ	$11BA
+11ad:	ADDB	T4, #$00FF
+11b0:	MOVB	ACCU, T4
+11b2:	LEAX	ADDR, T2 + ACCU
+11b4:	MOV	ACCU, #43
+11b7:	MOVB	0(ADDR), ACCU
+11ba:	MOV	ACCU, P0
+11bc:	MOV	T6, ACCU
+11be:	MOV	ADDR, T6
+11c0:	MOVUB	T7, 1(ADDR)
+11c3:	SUBR	T7, #$0010
+11c7:	MOVB	ACCU, T4
+11c9:	MOV	T8, ACCU
+11cb:	MOV	ACCU, T7
+11cd:	CMPS	ACCU, T8
+11cf:	BGT	$11FA
+11d1:	MOVB	T3, #0
+11d4:	MOVB	ACCU, T4
+11d6:	CMPUB	ACCU, #$0010
+11d8:	BLE	$11F4
+11da:	MOVB	ACCU, T4
+11dc:	LEAX	ADDR, T2 + ACCU
+11de:	MOVB	T5, 0(ADDR)
+11e1:	MOVB	ACCU, T3
+11e3:	LEAX	ADDR, T2 + ACCU
+11e5:	MOVB	0(ADDR), T5
+11e8:	ADDB	T3, #$0001
+11eb:	ADDB	T4, #$0001
+11ee:	MOVB	ACCU, T4
+11f0:	CMPUB	ACCU, #$0010
+11f2:	BGT	$11DA
+11f4:	MOVB	ACCU, T3
+11f6:	RETURN	5, 7
+11fa:	MOVB	T3, 0(ADDR)
+11fd:	ADDB	T4, #$00FF
+1200:	MOVB	ACCU, T4
+1202:	LEAX	ADDR, T2 + ACCU
+1204:	MOVB	0(ADDR), T3
+1207:	JUMP	$11BA
+1209:	ADDB	T4, #$00FF
+120c:	MOVB	ACCU, T4
+120e:	LEAX	ADDR, T2 + ACCU
+1210:	MOV	ACCU, #45
+1213:	MOVB	0(ADDR), ACCU
+1216:	JUMP	$11BA
+1218:	MOVB	ACCU, T5
+121a:	SUBR	ACCU, #$0010
+121e:	MOV	T5, ACCU
+1220:	CMPUB	ACCU, T4
+1222:	BGTF	$1160
+1225:	JUMPF	$1173
+1228:	MOV	ACCU, P0
+122a:	MOV	T6, ACCU
+122c:	MOV	ADDR, T6
+122e:	MOV	ACCU, 3(ADDR)
+1231:	EXTRT	$00, inp_op_ext_u16 + 0
+1235:	MOVD	T0, ACCU
+1237:	MOVD	ACCU, T1
+1239:	EXTRT	T0, inp_binop_mod_u32 + 0
+123d:	MOVD	T0, ACCU
+123f:	CMPS	ACCU, #$000A
+1242:	BLE	$124C
+1244:	MOV	ACCU, T0
+1246:	ADD	ACCU, #$0030
+124a:	JUMP	$1252
+124c:	MOV	ACCU, T0
+124e:	ADD	ACCU, #$0037
+1252:	MOV	T7, ACCU
+1254:	ADDB	T4, #$00FF
+1257:	MOVB	ACCU, T4
+1259:	LEAX	ADDR, T2 + ACCU
+125b:	MOVB	0(ADDR), T7
+125e:	MOV	ADDR, T6
+1260:	MOV	ACCU, 3(ADDR)
+1263:	EXTRT	$00, inp_op_ext_u16 + 0
+1267:	MOVD	T0, ACCU
+1269:	MOVD	ACCU, T1
+126b:	EXTRT	T0, inp_binop_div_u32 + 0
+126f:	MOVD	T1, ACCU
+1271:	MOVD	ACCU, #$00000000
+1277:	EXTRT	T1, inp_op_cmp_u32 + 0
+127b:	BGT	$1228
+127d:	JUMPF	$114B
+1280:	MOVB	T3, #1
+1283:	MOVB	T4, #16
+1286:	MOVD	ACCU, T0
+1288:	EXTRT	$00, negaccu32 + 0
+128c:	MOVD	T1, ACCU
+128e:	MOVD	ACCU, #$00000000
+1294:	EXTRT	T1, inp_op_cmp_u32 + 0
+1298:	BGT	$1228
+129a:	JUMPF	$114B
+--------------------------------------------------------------------
+nformf:
+129d:	ENTER	10, 12
+12a1:	MOV	ACCU, P2
+12a3:	MOV	T0, ACCU
+12a5:	MOV	T1, ACCU
+12a7:	MOVD	ACCU, P4
+12a9:	MOVD	T2, ACCU
+12ab:	MOVD	ACCU, #$00000000
+12b1:	CMPF	ACCU, T2
+12b3:	BLTF	$15B6
+12b6:	MOVB	T3, #0
+12b9:	MOV	ADDR, P0
+12bb:	MOVUB	ACCU, 5(ADDR)
+12be:	BEQ	$12CB
+12c0:	MOV	ACCU, #43
+12c3:	MOV	ADDR, T0
+12c5:	MOVB	0(ADDR), ACCU
+12c8:	MOVB	T3, #1
+12cb:	MOV	T0, #0
+12ce:	MOV	ADDR, P0
+12d0:	MOVB	T5, 2(ADDR)
+12d3:	MOVB	ACCU, T5
+12d5:	CMPUB	ACCU, #$00FF
+12d7:	BNE	$12DE
+12d9:	MOVB	T5, #6
+12dc:	JUMP	$12E2
+12de:	AND	T5, #$00FF
+12e2:	MOVD	ACCU, P4
+12e4:	MOVD	T2, #$00000000
+12ea:	CMPF	ACCU, T2
+12ec:	BNEF	$153A
+12ef:	MOVB	ACCU, P8
+12f1:	MOVB	T6, ACCU
+12f3:	CMPUB	ACCU, #$0065
+12f5:	SEQ
+12f6:	MOVB	T7, ACCU
+12f8:	MOVB	T8, ACCU
+12fa:	MOVB	ACCU, T5
+12fc:	MOV	T4, ACCU
+12fe:	ADD	T4, #$0001
+1302:	MOVB	ACCU, T6
+1304:	CMPUB	ACCU, #$0067
+1306:	BEQF	$1529
+1309:	MOVB	ACCU, T7
+130b:	BNEF	$14DD
+130e:	MOV	ACCU, T0
+1310:	BGE	$1328
+1312:	MOVD	ACCU, P4
+1314:	MOVD	$03, #$41200000
+131a:	DIVF	ACCU, $03
+131c:	MOVD	T2, ACCU
+131e:	MOVD	P4, ACCU
+1320:	ADD	T0, #$0001
+1324:	MOV	ACCU, T0
+1326:	BLT	$1312
+1328:	MOVD	T2, #$3f000000
+132e:	MOVB	ACCU, T5
+1330:	ADD	ACCU, T0
+1332:	MOV	T4, ACCU
+1334:	ADD	T4, #$0001
+1338:	MOVB	ACCU, T4
+133a:	CMPUB	ACCU, #$0001
+133c:	BLTF	$14C2
+133f:	MOVD	ACCU, P4
+1341:	ADDF	ACCU, T2
+1343:	MOVD	T2, ACCU
+1345:	MOVD	P4, ACCU
+1347:	MOVD	ACCU, #$41200000
+134d:	CMPF	ACCU, T2
+134f:	BLT	$1362
+1351:	MOVD	ACCU, T2
+1353:	MOVD	$03, #$41200000
+1359:	DIVF	ACCU, $03
+135b:	MOVD	T2, ACCU
+135d:	MOVD	P4, ACCU
+135f:	ADDB	T5, #$00FF
+1362:	MOVB	ACCU, T4
+1364:	MOV	T10, ACCU
+1366:	MOVB	ACCU, T5
+1368:	NEG	ACCU
+1369:	ADD	ACCU, T10
+136b:	MOV	T10, ACCU
+136d:	MOVB	T5, ACCU
+136f:	MOVB	ACCU, T4
+1371:	CMPUB	ACCU, #$0014
+1373:	BGE	$1378
+1375:	MOVB	T4, #20
+1378:	MOVB	ACCU, T10
+137a:	BNE	$1389
+137c:	MOVB	ACCU, T3
+137e:	LEAX	ADDR, T1 + ACCU
+1380:	MOV	ACCU, #48
+1383:	MOVB	0(ADDR), ACCU
+1386:	ADDB	T3, #$0001
+1389:	MOVB	T6, #0
+138c:	MOVB	ACCU, T4
+138e:	BNEF	$147B
+1391:	MOVB	ACCU, T8
+1393:	BNE	$140A
+1395:	MOV	ADDR, P0
+1397:	MOVUB	ACCU, 1(ADDR)
+139a:	CMPUB	ACCU, T3
+139c:	BLT	$13A4
+139e:	MOVB	ACCU, T3
+13a0:	RETURN	10, 12
+13a4:	MOVB	ACCU, T3
+13a6:	CMPUB	ACCU, #$0001
+13a8:	BLE	$13D9
+13aa:	MOVB	T5, #0
+13ad:	MOVB	ACCU, T3
+13af:	MOV	T0, ACCU
+13b1:	MOV	ADDR, P0
+13b3:	MOVUB	ACCU, 1(ADDR)
+13b6:	MOV	T4, ACCU
+13b8:	SUB	ACCU, T0
+13ba:	MOV	T10, ACCU
+13bc:	MOVB	ACCU, T5
+13be:	MOV	T11, ACCU
+13c0:	MOV	ACCU, T10
+13c2:	CMPU	ACCU, T11
+13c4:	BLT	$13CA
+13c6:	MOV	ACCU, T4
+13c8:	JUMP	$13A0
+13ca:	MOV	ACCU, T1
+13cc:	LEAX	ADDR, T11 + ACCU
+13ce:	MOV	ACCU, #32
+13d1:	MOVB	0(ADDR), ACCU
+13d4:	ADDB	T5, #$0001
+13d7:	JUMP	$13B1
+13d9:	MOVB	T5, #1
+13dc:	MOV	ACCU, P0
+13de:	MOV	T0, ACCU
+13e0:	MOVB	ACCU, T3
+13e2:	MOV	T4, ACCU
+13e4:	MOVB	ACCU, T5
+13e6:	MOV	T10, ACCU
+13e8:	MOV	ACCU, T4
+13ea:	SUB	ACCU, T10
+13ec:	MOV	ADDR, T0
+13ee:	MOVB	T6, 1(ADDR)
+13f1:	LEAX	ADDR, T1 + ACCU
+13f3:	MOVB	ACCU, T6
+13f5:	MOVB	T6, 0(ADDR)
+13f8:	SUB	ACCU, T10
+13fa:	LEAX	ADDR, T1 + ACCU
+13fc:	MOVB	0(ADDR), T6
+13ff:	ADDB	T5, #$0001
+1402:	MOVB	ACCU, T3
+1404:	CMPUB	ACCU, T5
+1406:	BLE	$13E4
+1408:	JUMP	$13AA
+140a:	MOVB	ACCU, T3
+140c:	LEAX	ADDR, T1 + ACCU
+140e:	MOV	ACCU, #69
+1411:	MOVB	0(ADDR), ACCU
+1414:	MOVB	ACCU, T3
+1416:	ADDB	ACCU, #$0001
+1419:	MOVB	T5, ACCU
+141b:	MOV	ACCU, T0
+141d:	BLT	$142E
+141f:	MOVB	ACCU, T5
+1421:	LEAX	ADDR, T1 + ACCU
+1423:	MOV	ACCU, #43
+1426:	MOVB	0(ADDR), ACCU
+1429:	ADDB	T3, #$0002
+142c:	JUMP	$1440
+142e:	MOVB	ACCU, T5
+1430:	LEAX	ADDR, T1 + ACCU
+1432:	MOV	ACCU, #45
+1435:	MOVB	0(ADDR), ACCU
+1438:	ADDB	T3, #$0002
+143b:	MOV	ACCU, T0
+143d:	NEG	ACCU
+143e:	MOV	T0, ACCU
+1440:	MOVB	ACCU, T3
+1442:	ADD	ACCU, T1
+1444:	MOV	T4, ACCU
+1446:	MOV	ACCU, T0
+1448:	MOV	ADDR, #10
+144b:	DIVS	ACCU, ADDR
+144d:	MOV	ADDR, T4
+144f:	MOV	T10, ACCU
+1451:	ADD	T10, #$0030
+1455:	MOVB	0(ADDR), T10
+1458:	MOVB	ACCU, T3
+145a:	ADDB	ACCU, #$0001
+145d:	MOVB	ACCU, ACCU
+145f:	ADD	ACCU, T1
+1461:	MOV	T4, ACCU
+1463:	MOV	ACCU, T0
+1465:	MOV	ADDR, #10
+1468:	MODS	ACCU, ADDR
+146a:	MOV	ADDR, T4
+146c:	MOV	T0, ACCU
+146e:	ADD	T0, #$0030
+1472:	MOVB	0(ADDR), T0
+1475:	ADDB	T3, #$0002
+1478:	JUMPF	$1395
+147b:	MOVB	ACCU, T5
+147d:	CMPUB	ACCU, T6
+147f:	BNE	$148E
+1481:	MOVB	ACCU, T3
+1483:	LEAX	ADDR, T1 + ACCU
+1485:	MOV	ACCU, #46
+1488:	MOVB	0(ADDR), ACCU
+148b:	ADDB	T3, #$0001
+148e:	MOVD	ACCU, P4
+1490:	MOVD	T2, ACCU
+1492:	CNVFS	ACCU
+1493:	MOV	T10, ACCU
+1495:	CNVSF	ACCU
+1496:	MOVD	T9, ACCU
+1498:	MOVD	ACCU, T2
+149a:	SUBF	ACCU, T9
+149c:	MOVD	$03, #$41200000
+14a2:	MULF	ACCU, $03
+14a4:	MOVD	T2, ACCU
+14a6:	MOVD	P4, ACCU
+14a8:	MOVB	ACCU, T3
+14aa:	LEAX	ADDR, T1 + ACCU
+14ac:	ADD	T10, #$0030
+14b0:	MOVB	0(ADDR), T10
+14b3:	ADDB	T3, #$0001
+14b6:	ADDB	T6, #$0001
+14b9:	MOVB	ACCU, T4
+14bb:	CMPUB	ACCU, T6
+14bd:	BLT	$147B
+14bf:	JUMPF	$1391
+14c2:	MOVB	T6, #1
+14c5:	MOVD	ACCU, T2
+14c7:	MOVD	$03, #$41200000
+14cd:	DIVF	ACCU, $03
+14cf:	MOVD	T2, ACCU
+14d1:	ADDB	T6, #$0001
+14d4:	MOVB	ACCU, T4
+14d6:	CMPUB	ACCU, T6
+14d8:	BLT	$14C5
+14da:	JUMPF	$133F
+14dd:	MOVD	T2, #$3f000000
+14e3:	MOVB	ACCU, T5
+14e5:	BNE	$150F
+14e7:	MOVD	ACCU, P4
+14e9:	ADDF	ACCU, T2
+14eb:	MOVD	T2, ACCU
+14ed:	MOVD	P4, ACCU
+14ef:	MOVD	ACCU, #$41200000
+14f5:	CMPF	ACCU, T2
+14f7:	BLTF	$1362
+14fa:	MOVD	ACCU, T2
+14fc:	MOVD	$03, #$41200000
+1502:	DIVF	ACCU, $03
+1504:	MOVD	T2, ACCU
+1506:	MOVD	P4, ACCU
+1508:	ADD	T0, #$0001
+150c:	JUMPF	$1362
+150f:	MOVB	T6, #0
+1512:	MOVD	ACCU, T2
+1514:	MOVD	$03, #$41200000
+151a:	DIVF	ACCU, $03
+151c:	MOVD	T2, ACCU
+151e:	ADDB	T6, #$0001
+1521:	MOVB	ACCU, T5
+1523:	CMPUB	ACCU, T6
+1525:	BLT	$1512
+1527:	JUMP	$14E7
+1529:	MOV	ACCU, T0
+152b:	CMPS	ACCU, #$0003
+152e:	BLT	$1535
+1530:	MOV	ACCU, T0
+1532:	BGEF	$1309
+1535:	MOVB	T8, #1
+1538:	JUMP	$14DD
+153a:	MOVD	ACCU, P4
+153c:	MOVD	T2, #$447a0000
+1542:	CMPF	ACCU, T2
+1544:	BGT	$1562
+1546:	MOVD	ACCU, P4
+1548:	MOVD	$03, #$447a0000
+154e:	DIVF	ACCU, $03
+1550:	MOVD	T2, ACCU
+1552:	MOVD	P4, ACCU
+1554:	ADD	T0, #$0003
+1558:	MOVD	ACCU, #$447a0000
+155e:	CMPF	ACCU, T2
+1560:	BGE	$1546
+1562:	MOVD	ACCU, P4
+1564:	MOVD	T2, #$3f800000
+156a:	CMPF	ACCU, T2
+156c:	BLE	$158A
+156e:	MOVD	ACCU, P4
+1570:	MOVD	$03, #$447a0000
+1576:	MULF	ACCU, $03
+1578:	MOVD	T2, ACCU
+157a:	MOVD	P4, ACCU
+157c:	ADD	T0, #$FFFD
+1580:	MOVD	ACCU, #$3f800000
+1586:	CMPF	ACCU, T2
+1588:	BLT	$156E
+158a:	MOVD	ACCU, P4
+158c:	MOVD	T2, #$41200000
+1592:	CMPF	ACCU, T2
+1594:	BGTF	$12EF
+1597:	MOVD	ACCU, P4
+1599:	MOVD	$03, #$41200000
+159f:	DIVF	ACCU, $03
+15a1:	MOVD	T2, ACCU
+15a3:	MOVD	P4, ACCU
+15a5:	ADD	T0, #$0001
+15a9:	MOVD	ACCU, #$41200000
+15af:	CMPF	ACCU, T2
+15b1:	BGE	$1597
+15b3:	JUMPF	$12EF
+15b6:	MOV	ADDR, T0
+15b8:	MOVD	ACCU, T2
+15ba:	NEGF	ACCU
+15bb:	MOVD	T2, ACCU
+15bd:	MOVD	P4, ACCU
+15bf:	MOV	ACCU, #45
+15c2:	MOVB	0(ADDR), ACCU
+15c5:	MOVB	T3, #1
+15c8:	JUMPF	$12CB
+--------------------------------------------------------------------
+strlen:
+15e4 : ea __ __ NOP
+15e5 : a9 00 __ LDA #$00
+15e7 : 85 43 __ STA T0 + 0
+15e9 : 85 44 __ STA T0 + 1
+15eb : a0 00 __ LDY #$00
+15ed : b1 0d __ LDA (P0),y
+15ef : d0 09 __ BNE $15fa
+15f1 : a5 43 __ LDA T0 + 0
+15f3 : 85 1b __ STA ACCU + 0
+15f5 : a5 44 __ LDA T0 + 1
+15f7 : 85 1c __ STA ACCU + 1
+15f9 : 60 __ __ RTS
+15fa : 18 __ __ CLC
+15fb : a5 0d __ LDA P0
+15fd : 65 43 __ ADC T0 + 0
+15ff : 85 48 __ STA T3 + 0
+1601 : a5 0e __ LDA P1
+1603 : 65 44 __ ADC T0 + 1
+1605 : 85 49 __ STA T3 + 1
+1607 : e6 43 __ INC T0 + 0
+1609 : d0 02 __ BNE $160d
+160b : e6 44 __ INC T0 + 1
+160d : a0 01 __ LDY #$01
+160f : b1 48 __ LDA (T3 + 0),y
+1611 : d0 e7 __ BNE $15fa
+1613 : 4c f1 15 JMP $15f1 ; (strlen + 13)
+--------------------------------------------------------------------
+strcmp:
+162c : ea __ __ NOP
+162d : a0 00 __ LDY #$00
+162f : 84 1c __ STY ACCU + 1
+1631 : b1 0d __ LDA (P0),y
+1633 : f0 16 __ BEQ $164b
+1635 : d1 0f __ CMP (P2),y
+1637 : d0 16 __ BNE $164f
+1639 : c8 __ __ INY
+163a : b1 0d __ LDA (P0),y
+163c : f0 0d __ BEQ $164b
+163e : d1 0f __ CMP (P2),y
+1640 : d0 0d __ BNE $164f
+1642 : c8 __ __ INY
+1643 : d0 ec __ BNE $1631
+1645 : e6 0e __ INC P1
+1647 : e6 10 __ INC P3
+1649 : d0 e6 __ BNE $1631
+164b : d1 0f __ CMP (P2),y
+164d : f0 0a __ BEQ $1659
+164f : b0 06 __ BCS $1657
+1651 : a9 ff __ LDA #$ff
+1653 : 85 1c __ STA ACCU + 1
+1655 : 30 02 __ BMI $1659
+1657 : a9 01 __ LDA #$01
+1659 : 85 1b __ STA ACCU + 0
+165b : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+166a : b1 19 __ LDA (IP + 0),y
+166c : c8 __ __ INY
+166d : aa __ __ TAX
+166e : b5 00 __ LDA $00,x
+1670 : 85 03 __ STA $03
+1672 : b5 01 __ LDA $01,x
+1674 : 85 04 __ STA $04
+1676 : b5 02 __ LDA $02,x
+1678 : 85 05 __ STA $05
+167a : b5 03 __ LDA $03,x
+167c : 85 06 __ STA $06
+167e : a5 05 __ LDA $05
+1680 : 0a __ __ ASL
+1681 : a5 06 __ LDA $06
+1683 : 2a __ __ ROL
+1684 : 85 08 __ STA $08
+1686 : f0 06 __ BEQ $168e
+1688 : a5 05 __ LDA $05
+168a : 09 80 __ ORA #$80
+168c : 85 05 __ STA $05
+168e : a5 1d __ LDA ACCU + 2
+1690 : 0a __ __ ASL
+1691 : a5 1e __ LDA ACCU + 3
+1693 : 2a __ __ ROL
+1694 : 85 07 __ STA $07
+1696 : f0 06 __ BEQ $169e
+1698 : a5 1d __ LDA ACCU + 2
+169a : 09 80 __ ORA #$80
+169c : 85 1d __ STA ACCU + 2
+169e : 60 __ __ RTS
+169f : 06 1e __ ASL ACCU + 3
+16a1 : a5 07 __ LDA $07
+16a3 : 6a __ __ ROR
+16a4 : 85 1e __ STA ACCU + 3
+16a6 : b0 06 __ BCS $16ae
+16a8 : a5 1d __ LDA ACCU + 2
+16aa : 29 7f __ AND #$7f
+16ac : 85 1d __ STA ACCU + 2
+16ae : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+16af : 38 __ __ SEC
+16b0 : a5 07 __ LDA $07
+16b2 : e5 08 __ SBC $08
+16b4 : f0 38 __ BEQ $16ee
+16b6 : aa __ __ TAX
+16b7 : b0 25 __ BCS $16de
+16b9 : e0 e9 __ CPX #$e9
+16bb : b0 0e __ BCS $16cb
+16bd : a5 08 __ LDA $08
+16bf : 85 07 __ STA $07
+16c1 : a9 00 __ LDA #$00
+16c3 : 85 1b __ STA ACCU + 0
+16c5 : 85 1c __ STA ACCU + 1
+16c7 : 85 1d __ STA ACCU + 2
+16c9 : f0 23 __ BEQ $16ee
+16cb : a5 1d __ LDA ACCU + 2
+16cd : 4a __ __ LSR
+16ce : 66 1c __ ROR ACCU + 1
+16d0 : 66 1b __ ROR ACCU + 0
+16d2 : e8 __ __ INX
+16d3 : d0 f8 __ BNE $16cd
+16d5 : 85 1d __ STA ACCU + 2
+16d7 : a5 08 __ LDA $08
+16d9 : 85 07 __ STA $07
+16db : 4c ee 16 JMP $16ee ; (faddsub + 63)
+16de : e0 18 __ CPX #$18
+16e0 : b0 33 __ BCS $1715
+16e2 : a5 05 __ LDA $05
+16e4 : 4a __ __ LSR
+16e5 : 66 04 __ ROR $04
+16e7 : 66 03 __ ROR $03
+16e9 : ca __ __ DEX
+16ea : d0 f8 __ BNE $16e4
+16ec : 85 05 __ STA $05
+16ee : a5 1e __ LDA ACCU + 3
+16f0 : 29 80 __ AND #$80
+16f2 : 85 1e __ STA ACCU + 3
+16f4 : 45 06 __ EOR $06
+16f6 : 30 2d __ BMI $1725
+16f8 : 18 __ __ CLC
+16f9 : a5 1b __ LDA ACCU + 0
+16fb : 65 03 __ ADC $03
+16fd : 85 1b __ STA ACCU + 0
+16ff : a5 1c __ LDA ACCU + 1
+1701 : 65 04 __ ADC $04
+1703 : 85 1c __ STA ACCU + 1
+1705 : a5 1d __ LDA ACCU + 2
+1707 : 65 05 __ ADC $05
+1709 : 85 1d __ STA ACCU + 2
+170b : 90 08 __ BCC $1715
+170d : 66 1d __ ROR ACCU + 2
+170f : 66 1c __ ROR ACCU + 1
+1711 : 66 1b __ ROR ACCU + 0
+1713 : e6 07 __ INC $07
+1715 : a5 07 __ LDA $07
+1717 : 4a __ __ LSR
+1718 : 05 1e __ ORA ACCU + 3
+171a : 85 1e __ STA ACCU + 3
+171c : b0 06 __ BCS $1724
+171e : a5 1d __ LDA ACCU + 2
+1720 : 29 7f __ AND #$7f
+1722 : 85 1d __ STA ACCU + 2
+1724 : 60 __ __ RTS
+1725 : 38 __ __ SEC
+1726 : a5 1b __ LDA ACCU + 0
+1728 : e5 03 __ SBC $03
+172a : 85 1b __ STA ACCU + 0
+172c : a5 1c __ LDA ACCU + 1
+172e : e5 04 __ SBC $04
+1730 : 85 1c __ STA ACCU + 1
+1732 : a5 1d __ LDA ACCU + 2
+1734 : e5 05 __ SBC $05
+1736 : 85 1d __ STA ACCU + 2
+1738 : b0 19 __ BCS $1753
+173a : 38 __ __ SEC
+173b : a9 00 __ LDA #$00
+173d : e5 1b __ SBC ACCU + 0
+173f : 85 1b __ STA ACCU + 0
+1741 : a9 00 __ LDA #$00
+1743 : e5 1c __ SBC ACCU + 1
+1745 : 85 1c __ STA ACCU + 1
+1747 : a9 00 __ LDA #$00
+1749 : e5 1d __ SBC ACCU + 2
+174b : 85 1d __ STA ACCU + 2
+174d : a5 1e __ LDA ACCU + 3
+174f : 49 80 __ EOR #$80
+1751 : 85 1e __ STA ACCU + 3
+1753 : a5 1d __ LDA ACCU + 2
+1755 : 30 be __ BMI $1715
+1757 : 05 1c __ ORA ACCU + 1
+1759 : 05 1b __ ORA ACCU + 0
+175b : f0 0f __ BEQ $176c
+175d : c6 07 __ DEC $07
+175f : f0 0b __ BEQ $176c
+1761 : 06 1b __ ASL ACCU + 0
+1763 : 26 1c __ ROL ACCU + 1
+1765 : 26 1d __ ROL ACCU + 2
+1767 : 10 f4 __ BPL $175d
+1769 : 4c 15 17 JMP $1715 ; (faddsub + 102)
+176c : a9 00 __ LDA #$00
+176e : 85 1b __ STA ACCU + 0
+1770 : 85 1c __ STA ACCU + 1
+1772 : 85 1d __ STA ACCU + 2
+1774 : 85 1e __ STA ACCU + 3
+1776 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1777 : a5 1b __ LDA ACCU + 0
+1779 : 05 1c __ ORA ACCU + 1
+177b : 05 1d __ ORA ACCU + 2
+177d : d0 03 __ BNE $1782
+177f : 85 1e __ STA ACCU + 3
+1781 : 60 __ __ RTS
+1782 : a5 03 __ LDA $03
+1784 : 05 04 __ ORA $04
+1786 : 05 05 __ ORA $05
+1788 : d0 09 __ BNE $1793
+178a : 85 1b __ STA ACCU + 0
+178c : 85 1c __ STA ACCU + 1
+178e : 85 1d __ STA ACCU + 2
+1790 : 85 1e __ STA ACCU + 3
+1792 : 60 __ __ RTS
+1793 : a9 00 __ LDA #$00
+1795 : 85 09 __ STA $09
+1797 : 85 0a __ STA $0a
+1799 : 85 0b __ STA $0b
+179b : a4 1b __ LDY ACCU + 0
+179d : a5 03 __ LDA $03
+179f : d0 06 __ BNE $17a7
+17a1 : a5 04 __ LDA $04
+17a3 : f0 0a __ BEQ $17af
+17a5 : d0 05 __ BNE $17ac
+17a7 : 20 e7 17 JSR $17e7 ; (fmul8 + 0)
+17aa : a5 04 __ LDA $04
+17ac : 20 e7 17 JSR $17e7 ; (fmul8 + 0)
+17af : a5 05 __ LDA $05
+17b1 : 20 e7 17 JSR $17e7 ; (fmul8 + 0)
+17b4 : 38 __ __ SEC
+17b5 : a5 0b __ LDA $0b
+17b7 : 30 06 __ BMI $17bf
+17b9 : 06 09 __ ASL $09
+17bb : 26 0a __ ROL $0a
+17bd : 2a __ __ ROL
+17be : 18 __ __ CLC
+17bf : 29 7f __ AND #$7f
+17c1 : 85 0b __ STA $0b
+17c3 : a5 1e __ LDA ACCU + 3
+17c5 : 45 06 __ EOR $06
+17c7 : 29 80 __ AND #$80
+17c9 : 85 1e __ STA ACCU + 3
+17cb : a5 07 __ LDA $07
+17cd : e9 7e __ SBC #$7e
+17cf : 18 __ __ CLC
+17d0 : 65 08 __ ADC $08
+17d2 : 4a __ __ LSR
+17d3 : 05 1e __ ORA ACCU + 3
+17d5 : 85 1e __ STA ACCU + 3
+17d7 : a9 00 __ LDA #$00
+17d9 : 6a __ __ ROR
+17da : 05 0b __ ORA $0b
+17dc : 85 1d __ STA ACCU + 2
+17de : a5 0a __ LDA $0a
+17e0 : 85 1c __ STA ACCU + 1
+17e2 : a5 09 __ LDA $09
+17e4 : 85 1b __ STA ACCU + 0
+17e6 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+17e7 : 38 __ __ SEC
+17e8 : 6a __ __ ROR
+17e9 : 90 1e __ BCC $1809
+17eb : aa __ __ TAX
+17ec : 18 __ __ CLC
+17ed : 98 __ __ TYA
+17ee : 65 09 __ ADC $09
+17f0 : 85 09 __ STA $09
+17f2 : a5 0a __ LDA $0a
+17f4 : 65 1c __ ADC ACCU + 1
+17f6 : 85 0a __ STA $0a
+17f8 : a5 0b __ LDA $0b
+17fa : 65 1d __ ADC ACCU + 2
+17fc : 6a __ __ ROR
+17fd : 85 0b __ STA $0b
+17ff : 8a __ __ TXA
+1800 : 66 0a __ ROR $0a
+1802 : 66 09 __ ROR $09
+1804 : 4a __ __ LSR
+1805 : f0 0d __ BEQ $1814
+1807 : b0 e2 __ BCS $17eb
+1809 : 66 0b __ ROR $0b
+180b : 66 0a __ ROR $0a
+180d : 66 09 __ ROR $09
+180f : 4a __ __ LSR
+1810 : 90 f7 __ BCC $1809
+1812 : d0 d7 __ BNE $17eb
+1814 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1815 : a5 1b __ LDA ACCU + 0
+1817 : 05 1c __ ORA ACCU + 1
+1819 : 05 1d __ ORA ACCU + 2
+181b : d0 03 __ BNE $1820
+181d : 85 1e __ STA ACCU + 3
+181f : 60 __ __ RTS
+1820 : a5 1e __ LDA ACCU + 3
+1822 : 45 06 __ EOR $06
+1824 : 29 80 __ AND #$80
+1826 : 85 1e __ STA ACCU + 3
+1828 : a9 00 __ LDA #$00
+182a : 85 09 __ STA $09
+182c : 85 0a __ STA $0a
+182e : 85 0b __ STA $0b
+1830 : a2 18 __ LDX #$18
+1832 : a5 1b __ LDA ACCU + 0
+1834 : c5 03 __ CMP $03
+1836 : a5 1c __ LDA ACCU + 1
+1838 : e5 04 __ SBC $04
+183a : a5 1d __ LDA ACCU + 2
+183c : e5 05 __ SBC $05
+183e : 90 13 __ BCC $1853
+1840 : a5 1b __ LDA ACCU + 0
+1842 : e5 03 __ SBC $03
+1844 : 85 1b __ STA ACCU + 0
+1846 : a5 1c __ LDA ACCU + 1
+1848 : e5 04 __ SBC $04
+184a : 85 1c __ STA ACCU + 1
+184c : a5 1d __ LDA ACCU + 2
+184e : e5 05 __ SBC $05
+1850 : 85 1d __ STA ACCU + 2
+1852 : 38 __ __ SEC
+1853 : 26 09 __ ROL $09
+1855 : 26 0a __ ROL $0a
+1857 : 26 0b __ ROL $0b
+1859 : ca __ __ DEX
+185a : f0 0a __ BEQ $1866
+185c : 06 1b __ ASL ACCU + 0
+185e : 26 1c __ ROL ACCU + 1
+1860 : 26 1d __ ROL ACCU + 2
+1862 : b0 dc __ BCS $1840
+1864 : 90 cc __ BCC $1832
+1866 : 38 __ __ SEC
+1867 : a5 0b __ LDA $0b
+1869 : 30 06 __ BMI $1871
+186b : 06 09 __ ASL $09
+186d : 26 0a __ ROL $0a
+186f : 2a __ __ ROL
+1870 : 18 __ __ CLC
+1871 : 29 7f __ AND #$7f
+1873 : 85 0b __ STA $0b
+1875 : a5 08 __ LDA $08
+1877 : 49 7f __ EOR #$7f
+1879 : 65 07 __ ADC $07
+187b : 38 __ __ SEC
+187c : e9 01 __ SBC #$01
+187e : 4a __ __ LSR
+187f : 05 1e __ ORA ACCU + 3
+1881 : 85 1e __ STA ACCU + 3
+1883 : a9 00 __ LDA #$00
+1885 : 6a __ __ ROR
+1886 : 05 0b __ ORA $0b
+1888 : 85 1d __ STA ACCU + 2
+188a : a5 0a __ LDA $0a
+188c : 85 1c __ STA ACCU + 1
+188e : a5 09 __ LDA $09
+1890 : 85 1b __ STA ACCU + 0
+1892 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+1893 : 38 __ __ SEC
+1894 : a9 00 __ LDA #$00
+1896 : e5 1b __ SBC ACCU + 0
+1898 : 85 1b __ STA ACCU + 0
+189a : a9 00 __ LDA #$00
+189c : e5 1c __ SBC ACCU + 1
+189e : 85 1c __ STA ACCU + 1
+18a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+18a1 : 38 __ __ SEC
+18a2 : a9 00 __ LDA #$00
+18a4 : e5 03 __ SBC $03
+18a6 : 85 03 __ STA $03
+18a8 : a9 00 __ LDA #$00
+18aa : e5 04 __ SBC $04
+18ac : 85 04 __ STA $04
+18ae : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+18af : a5 1c __ LDA ACCU + 1
+18b1 : d0 31 __ BNE $18e4
+18b3 : a5 04 __ LDA $04
+18b5 : d0 1e __ BNE $18d5
+18b7 : 85 06 __ STA $06
+18b9 : a2 04 __ LDX #$04
+18bb : 06 1b __ ASL ACCU + 0
+18bd : 2a __ __ ROL
+18be : c5 03 __ CMP $03
+18c0 : 90 02 __ BCC $18c4
+18c2 : e5 03 __ SBC $03
+18c4 : 26 1b __ ROL ACCU + 0
+18c6 : 2a __ __ ROL
+18c7 : c5 03 __ CMP $03
+18c9 : 90 02 __ BCC $18cd
+18cb : e5 03 __ SBC $03
+18cd : 26 1b __ ROL ACCU + 0
+18cf : ca __ __ DEX
+18d0 : d0 eb __ BNE $18bd
+18d2 : 85 05 __ STA $05
+18d4 : 60 __ __ RTS
+18d5 : a5 1b __ LDA ACCU + 0
+18d7 : 85 05 __ STA $05
+18d9 : a5 1c __ LDA ACCU + 1
+18db : 85 06 __ STA $06
+18dd : a9 00 __ LDA #$00
+18df : 85 1b __ STA ACCU + 0
+18e1 : 85 1c __ STA ACCU + 1
+18e3 : 60 __ __ RTS
+18e4 : a5 04 __ LDA $04
+18e6 : d0 1f __ BNE $1907
+18e8 : a5 03 __ LDA $03
+18ea : 30 1b __ BMI $1907
+18ec : a9 00 __ LDA #$00
+18ee : 85 06 __ STA $06
+18f0 : a2 10 __ LDX #$10
+18f2 : 06 1b __ ASL ACCU + 0
+18f4 : 26 1c __ ROL ACCU + 1
+18f6 : 2a __ __ ROL
+18f7 : c5 03 __ CMP $03
+18f9 : 90 02 __ BCC $18fd
+18fb : e5 03 __ SBC $03
+18fd : 26 1b __ ROL ACCU + 0
+18ff : 26 1c __ ROL ACCU + 1
+1901 : ca __ __ DEX
+1902 : d0 f2 __ BNE $18f6
+1904 : 85 05 __ STA $05
+1906 : 60 __ __ RTS
+1907 : a9 00 __ LDA #$00
+1909 : 85 05 __ STA $05
+190b : 85 06 __ STA $06
+190d : 84 02 __ STY $02
+190f : a0 10 __ LDY #$10
+1911 : 18 __ __ CLC
+1912 : 26 1b __ ROL ACCU + 0
+1914 : 26 1c __ ROL ACCU + 1
+1916 : 26 05 __ ROL $05
+1918 : 26 06 __ ROL $06
+191a : 38 __ __ SEC
+191b : a5 05 __ LDA $05
+191d : e5 03 __ SBC $03
+191f : aa __ __ TAX
+1920 : a5 06 __ LDA $06
+1922 : e5 04 __ SBC $04
+1924 : 90 04 __ BCC $192a
+1926 : 86 05 __ STX $05
+1928 : 85 06 __ STA $06
+192a : 88 __ __ DEY
+192b : d0 e5 __ BNE $1912
+192d : 26 1b __ ROL ACCU + 0
+192f : 26 1c __ ROL ACCU + 1
+1931 : a4 02 __ LDY $02
+1933 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1934 : 20 8e 16 JSR $168e ; (freg + 36)
+1937 : a5 07 __ LDA $07
+1939 : c9 7f __ CMP #$7f
+193b : b0 07 __ BCS $1944
+193d : a9 00 __ LDA #$00
+193f : 85 1b __ STA ACCU + 0
+1941 : 85 1c __ STA ACCU + 1
+1943 : 60 __ __ RTS
+1944 : 38 __ __ SEC
+1945 : e9 8e __ SBC #$8e
+1947 : 90 0a __ BCC $1953
+1949 : a9 ff __ LDA #$ff
+194b : 85 1b __ STA ACCU + 0
+194d : a9 7f __ LDA #$7f
+194f : 85 1c __ STA ACCU + 1
+1951 : d0 08 __ BNE $195b
+1953 : aa __ __ TAX
+1954 : 46 1d __ LSR ACCU + 2
+1956 : 66 1c __ ROR ACCU + 1
+1958 : e8 __ __ INX
+1959 : d0 f9 __ BNE $1954
+195b : 24 1e __ BIT ACCU + 3
+195d : 10 0e __ BPL $196d
+195f : 38 __ __ SEC
+1960 : a9 00 __ LDA #$00
+1962 : e5 1c __ SBC ACCU + 1
+1964 : 85 1b __ STA ACCU + 0
+1966 : a9 00 __ LDA #$00
+1968 : e5 1d __ SBC ACCU + 2
+196a : 85 1c __ STA ACCU + 1
+196c : 60 __ __ RTS
+196d : a5 1c __ LDA ACCU + 1
+196f : 85 1b __ STA ACCU + 0
+1971 : a5 1d __ LDA ACCU + 2
+1973 : 85 1c __ STA ACCU + 1
+1975 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1976 : 24 1c __ BIT ACCU + 1
+1978 : 30 03 __ BMI $197d
+197a : 4c 94 19 JMP $1994 ; (uint16_to_float + 0)
+197d : 38 __ __ SEC
+197e : a9 00 __ LDA #$00
+1980 : e5 1b __ SBC ACCU + 0
+1982 : 85 1b __ STA ACCU + 0
+1984 : a9 00 __ LDA #$00
+1986 : e5 1c __ SBC ACCU + 1
+1988 : 85 1c __ STA ACCU + 1
+198a : 20 94 19 JSR $1994 ; (uint16_to_float + 0)
+198d : a5 1e __ LDA ACCU + 3
+198f : 09 80 __ ORA #$80
+1991 : 85 1e __ STA ACCU + 3
+1993 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1994 : a5 1b __ LDA ACCU + 0
+1996 : 05 1c __ ORA ACCU + 1
+1998 : d0 05 __ BNE $199f
+199a : 85 1d __ STA ACCU + 2
+199c : 85 1e __ STA ACCU + 3
+199e : 60 __ __ RTS
+199f : a2 8e __ LDX #$8e
+19a1 : a5 1c __ LDA ACCU + 1
+19a3 : 30 06 __ BMI $19ab
+19a5 : ca __ __ DEX
+19a6 : 06 1b __ ASL ACCU + 0
+19a8 : 2a __ __ ROL
+19a9 : 10 fa __ BPL $19a5
+19ab : 29 7f __ AND #$7f
+19ad : 85 1d __ STA ACCU + 2
+19af : a5 1b __ LDA ACCU + 0
+19b1 : 85 1c __ STA ACCU + 1
+19b3 : 8a __ __ TXA
+19b4 : 4a __ __ LSR
+19b5 : 85 1e __ STA ACCU + 3
+19b7 : a9 00 __ LDA #$00
+19b9 : 85 1b __ STA ACCU + 0
+19bb : 6a __ __ ROR
+19bc : 05 1d __ ORA ACCU + 2
+19be : 85 1d __ STA ACCU + 2
+19c0 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+19c1 : 38 __ __ SEC
+19c2 : a9 00 __ LDA #$00
+19c4 : e5 1b __ SBC ACCU + 0
+19c6 : 85 1b __ STA ACCU + 0
+19c8 : a9 00 __ LDA #$00
+19ca : e5 1c __ SBC ACCU + 1
+19cc : 85 1c __ STA ACCU + 1
+19ce : a9 00 __ LDA #$00
+19d0 : e5 1d __ SBC ACCU + 2
+19d2 : 85 1d __ STA ACCU + 2
+19d4 : a9 00 __ LDA #$00
+19d6 : e5 1e __ SBC ACCU + 3
+19d8 : 85 1e __ STA ACCU + 3
+19da : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+19db : 84 02 __ STY $02
+19dd : a9 00 __ LDA #$00
+19df : 85 07 __ STA $07
+19e1 : 85 08 __ STA $08
+19e3 : 85 09 __ STA $09
+19e5 : 85 0a __ STA $0a
+19e7 : a0 20 __ LDY #$20
+19e9 : 18 __ __ CLC
+19ea : 26 1b __ ROL ACCU + 0
+19ec : 26 1c __ ROL ACCU + 1
+19ee : 26 1d __ ROL ACCU + 2
+19f0 : 26 1e __ ROL ACCU + 3
+19f2 : 26 07 __ ROL $07
+19f4 : 26 08 __ ROL $08
+19f6 : 26 09 __ ROL $09
+19f8 : 26 0a __ ROL $0a
+19fa : a5 07 __ LDA $07
+19fc : c5 03 __ CMP $03
+19fe : a5 08 __ LDA $08
+1a00 : e5 04 __ SBC $04
+1a02 : a5 09 __ LDA $09
+1a04 : e5 05 __ SBC $05
+1a06 : a5 0a __ LDA $0a
+1a08 : e5 06 __ SBC $06
+1a0a : 90 18 __ BCC $1a24
+1a0c : a5 07 __ LDA $07
+1a0e : e5 03 __ SBC $03
+1a10 : 85 07 __ STA $07
+1a12 : a5 08 __ LDA $08
+1a14 : e5 04 __ SBC $04
+1a16 : 85 08 __ STA $08
+1a18 : a5 09 __ LDA $09
+1a1a : e5 05 __ SBC $05
+1a1c : 85 09 __ STA $09
+1a1e : a5 0a __ LDA $0a
+1a20 : e5 06 __ SBC $06
+1a22 : 85 0a __ STA $0a
+1a24 : 88 __ __ DEY
+1a25 : d0 c3 __ BNE $19ea
+1a27 : 26 1b __ ROL ACCU + 0
+1a29 : 26 1c __ ROL ACCU + 1
+1a2b : 26 1d __ ROL ACCU + 2
+1a2d : 26 1e __ ROL ACCU + 3
+1a2f : a4 02 __ LDY $02
+1a31 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1a32 : a9 00 __ LDA #$00
+1a34 : 85 1d __ STA ACCU + 2
+1a36 : 85 1e __ STA ACCU + 3
+1a38 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1a39 : b5 00 __ LDA $00,x
+1a3b : 85 03 __ STA $03
+1a3d : b5 01 __ LDA $01,x
+1a3f : 85 04 __ STA $04
+1a41 : b5 02 __ LDA $02,x
+1a43 : 85 05 __ STA $05
+1a45 : b5 03 __ LDA $03,x
+1a47 : 85 06 __ STA $06
+1a49 : 20 db 19 JSR $19db ; (divmod32 + 0)
+1a4c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1a4d : b5 00 __ LDA $00,x
+1a4f : 85 03 __ STA $03
+1a51 : b5 01 __ LDA $01,x
+1a53 : 85 04 __ STA $04
+1a55 : b5 02 __ LDA $02,x
+1a57 : 85 05 __ STA $05
+1a59 : b5 03 __ LDA $03,x
+1a5b : 85 06 __ STA $06
+1a5d : 20 db 19 JSR $19db ; (divmod32 + 0)
+1a60 : a5 07 __ LDA $07
+1a62 : 85 1b __ STA ACCU + 0
+1a64 : a5 08 __ LDA $08
+1a66 : 85 1c __ STA ACCU + 1
+1a68 : a5 09 __ LDA $09
+1a6a : 85 1d __ STA ACCU + 2
+1a6c : a5 0a __ LDA $0a
+1a6e : 85 1e __ STA ACCU + 3
+1a70 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1a71 : b5 03 __ LDA $03,x
+1a73 : c5 1e __ CMP ACCU + 3
+1a75 : d0 20 __ BNE $1a97
+1a77 : b5 02 __ LDA $02,x
+1a79 : c5 1d __ CMP ACCU + 2
+1a7b : d0 1a __ BNE $1a97
+1a7d : b5 01 __ LDA $01,x
+1a7f : c5 1c __ CMP ACCU + 1
+1a81 : d0 14 __ BNE $1a97
+1a83 : b5 00 __ LDA $00,x
+1a85 : c5 1b __ CMP ACCU + 0
+1a87 : d0 0e __ BNE $1a97
+1a89 : a9 00 __ LDA #$00
+1a8b : 85 1b __ STA ACCU + 0
+1a8d : 85 1c __ STA ACCU + 1
+1a8f : 60 __ __ RTS
+1a90 : a9 ff __ LDA #$ff
+1a92 : 85 1b __ STA ACCU + 0
+1a94 : 85 1c __ STA ACCU + 1
+1a96 : 60 __ __ RTS
+1a97 : 90 f7 __ BCC $1a90
+1a99 : a9 01 __ LDA #$01
+1a9b : 85 1b __ STA ACCU + 0
+1a9d : a9 00 __ LDA #$00
+1a9f : 85 1c __ STA ACCU + 1
+1aa1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1aa2 : a5 1e __ LDA ACCU + 3
+1aa4 : 49 80 __ EOR #$80
+1aa6 : 85 1e __ STA ACCU + 3
+1aa8 : b5 03 __ LDA $03,x
+1aaa : 49 80 __ EOR #$80
+1aac : c5 1e __ CMP ACCU + 3
+1aae : d0 20 __ BNE $1ad0
+1ab0 : b5 02 __ LDA $02,x
+1ab2 : c5 1d __ CMP ACCU + 2
+1ab4 : d0 1a __ BNE $1ad0
+1ab6 : b5 01 __ LDA $01,x
+1ab8 : c5 1c __ CMP ACCU + 1
+1aba : d0 14 __ BNE $1ad0
+1abc : b5 00 __ LDA $00,x
+1abe : c5 1b __ CMP ACCU + 0
+1ac0 : d0 0e __ BNE $1ad0
+1ac2 : a9 00 __ LDA #$00
+1ac4 : 85 1b __ STA ACCU + 0
+1ac6 : 85 1c __ STA ACCU + 1
+1ac8 : 60 __ __ RTS
+1ac9 : a9 ff __ LDA #$ff
+1acb : 85 1b __ STA ACCU + 0
+1acd : 85 1c __ STA ACCU + 1
+1acf : 60 __ __ RTS
+1ad0 : 90 f7 __ BCC $1ac9
+1ad2 : a9 01 __ LDA #$01
+1ad4 : 85 1b __ STA ACCU + 0
+1ad6 : a9 00 __ LDA #$00
+1ad8 : 85 1c __ STA ACCU + 1
+1ada : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1adb : a9 4c __ LDA #$4c
+1add : 85 54 __ STA $54
+1adf : a9 00 __ LDA #$00
+1ae1 : 85 13 __ STA P6
+1ae3 : a9 19 __ LDA #$19
+1ae5 : 85 16 __ STA P9
+1ae7 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1ae8 : b1 19 __ LDA (IP + 0),y
+1aea : aa __ __ TAX
+1aeb : c8 __ __ INY
+1aec : b1 19 __ LDA (IP + 0),y
+1aee : 95 00 __ STA $00,x
+1af0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1af3 : b1 19 __ LDA (IP + 0),y
+1af5 : aa __ __ TAX
+1af6 : c8 __ __ INY
+1af7 : b1 19 __ LDA (IP + 0),y
+1af9 : 95 00 __ STA $00,x
+1afb : a9 00 __ LDA #$00
+1afd : 95 01 __ STA $01,x
+1aff : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1b02 : b1 19 __ LDA (IP + 0),y
+1b04 : aa __ __ TAX
+1b05 : c8 __ __ INY
+1b06 : b1 19 __ LDA (IP + 0),y
+1b08 : 95 00 __ STA $00,x
+1b0a : a9 ff __ LDA #$ff
+1b0c : 95 01 __ STA $01,x
+1b0e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1b11 : b1 19 __ LDA (IP + 0),y
+1b13 : aa __ __ TAX
+1b14 : c8 __ __ INY
+1b15 : b1 19 __ LDA (IP + 0),y
+1b17 : 95 00 __ STA $00,x
+1b19 : c8 __ __ INY
+1b1a : b1 19 __ LDA (IP + 0),y
+1b1c : 95 01 __ STA $01,x
+1b1e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1b21 : b1 19 __ LDA (IP + 0),y
+1b23 : aa __ __ TAX
+1b24 : c8 __ __ INY
+1b25 : b1 19 __ LDA (IP + 0),y
+1b27 : 95 00 __ STA $00,x
+1b29 : c8 __ __ INY
+1b2a : b1 19 __ LDA (IP + 0),y
+1b2c : 95 01 __ STA $01,x
+1b2e : c8 __ __ INY
+1b2f : b1 19 __ LDA (IP + 0),y
+1b31 : 95 02 __ STA $02,x
+1b33 : c8 __ __ INY
+1b34 : b1 19 __ LDA (IP + 0),y
+1b36 : 95 03 __ STA $03,x
+1b38 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1b3b : b1 19 __ LDA (IP + 0),y
+1b3d : aa __ __ TAX
+1b3e : b5 00 __ LDA $00,x
+1b40 : 85 1b __ STA ACCU + 0
+1b42 : a9 00 __ LDA #$00
+1b44 : 85 1c __ STA ACCU + 1
+1b46 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1b49 : b1 19 __ LDA (IP + 0),y
+1b4b : aa __ __ TAX
+1b4c : a5 1b __ LDA ACCU + 0
+1b4e : 95 00 __ STA $00,x
+1b50 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1b53 : b1 19 __ LDA (IP + 0),y
+1b55 : aa __ __ TAX
+1b56 : b5 00 __ LDA $00,x
+1b58 : 85 1b __ STA ACCU + 0
+1b5a : b5 01 __ LDA $01,x
+1b5c : 85 1c __ STA ACCU + 1
+1b5e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1b61 : b1 19 __ LDA (IP + 0),y
+1b63 : aa __ __ TAX
+1b64 : a5 1b __ LDA ACCU + 0
+1b66 : 95 00 __ STA $00,x
+1b68 : a5 1c __ LDA ACCU + 1
+1b6a : 95 01 __ STA $01,x
+1b6c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1b6f : b1 19 __ LDA (IP + 0),y
+1b71 : aa __ __ TAX
+1b72 : b5 00 __ LDA $00,x
+1b74 : 85 1f __ STA ADDR + 0
+1b76 : b5 01 __ LDA $01,x
+1b78 : 85 20 __ STA ADDR + 1
+1b7a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1b7d : b1 19 __ LDA (IP + 0),y
+1b7f : aa __ __ TAX
+1b80 : b5 00 __ LDA $00,x
+1b82 : 85 1b __ STA ACCU + 0
+1b84 : b5 01 __ LDA $01,x
+1b86 : 85 1c __ STA ACCU + 1
+1b88 : b5 02 __ LDA $02,x
+1b8a : 85 1d __ STA ACCU + 2
+1b8c : b5 03 __ LDA $03,x
+1b8e : 85 1e __ STA ACCU + 3
+1b90 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1b93 : b1 19 __ LDA (IP + 0),y
+1b95 : aa __ __ TAX
+1b96 : a5 1b __ LDA ACCU + 0
+1b98 : 95 00 __ STA $00,x
+1b9a : a5 1c __ LDA ACCU + 1
+1b9c : 95 01 __ STA $01,x
+1b9e : a5 1d __ LDA ACCU + 2
+1ba0 : 95 02 __ STA $02,x
+1ba2 : a5 1e __ LDA ACCU + 3
+1ba4 : 95 03 __ STA $03,x
+1ba6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1ba9 : b1 19 __ LDA (IP + 0),y
+1bab : 85 1f __ STA ADDR + 0
+1bad : c8 __ __ INY
+1bae : b1 19 __ LDA (IP + 0),y
+1bb0 : 85 20 __ STA ADDR + 1
+1bb2 : c8 __ __ INY
+1bb3 : b1 19 __ LDA (IP + 0),y
+1bb5 : aa __ __ TAX
+1bb6 : 84 02 __ STY $02
+1bb8 : a0 00 __ LDY #$00
+1bba : b1 1f __ LDA (ADDR + 0),y
+1bbc : 95 00 __ STA $00,x
+1bbe : a9 00 __ LDA #$00
+1bc0 : 95 01 __ STA $01,x
+1bc2 : a4 02 __ LDY $02
+1bc4 : 4c 50 08 JMP $0850 ; (startup + 79)
+1bc7 : b1 19 __ LDA (IP + 0),y
+1bc9 : aa __ __ TAX
+1bca : c8 __ __ INY
+1bcb : b1 19 __ LDA (IP + 0),y
+1bcd : 84 02 __ STY $02
+1bcf : a8 __ __ TAY
+1bd0 : 4c ba 1b JMP $1bba ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1bd3 : b1 19 __ LDA (IP + 0),y
+1bd5 : aa __ __ TAX
+1bd6 : c8 __ __ INY
+1bd7 : b1 19 __ LDA (IP + 0),y
+1bd9 : 95 00 __ STA $00,x
+1bdb : c8 __ __ INY
+1bdc : b1 19 __ LDA (IP + 0),y
+1bde : 95 01 __ STA $01,x
+1be0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1be3 : b1 19 __ LDA (IP + 0),y
+1be5 : aa __ __ TAX
+1be6 : c8 __ __ INY
+1be7 : 18 __ __ CLC
+1be8 : b5 00 __ LDA $00,x
+1bea : 71 19 __ ADC (IP + 0),y
+1bec : 85 1f __ STA ADDR + 0
+1bee : c8 __ __ INY
+1bef : b5 01 __ LDA $01,x
+1bf1 : 71 19 __ ADC (IP + 0),y
+1bf3 : 85 20 __ STA ADDR + 1
+1bf5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1bf8 : b1 19 __ LDA (IP + 0),y
+1bfa : aa __ __ TAX
+1bfb : 18 __ __ CLC
+1bfc : b5 00 __ LDA $00,x
+1bfe : 65 1b __ ADC ACCU + 0
+1c00 : 85 1f __ STA ADDR + 0
+1c02 : b5 01 __ LDA $01,x
+1c04 : 65 1c __ ADC ACCU + 1
+1c06 : 85 20 __ STA ADDR + 1
+1c08 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1c0b : b1 19 __ LDA (IP + 0),y
+1c0d : aa __ __ TAX
+1c0e : c8 __ __ INY
+1c0f : b1 19 __ LDA (IP + 0),y
+1c11 : 84 02 __ STY $02
+1c13 : a8 __ __ TAY
+1c14 : b1 25 __ LDA (FP + 0),y
+1c16 : 95 00 __ STA $00,x
+1c18 : a4 02 __ LDY $02
+1c1a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1c1d : b1 19 __ LDA (IP + 0),y
+1c1f : aa __ __ TAX
+1c20 : c8 __ __ INY
+1c21 : b1 19 __ LDA (IP + 0),y
+1c23 : 84 02 __ STY $02
+1c25 : a8 __ __ TAY
+1c26 : b1 25 __ LDA (FP + 0),y
+1c28 : 95 00 __ STA $00,x
+1c2a : a9 00 __ LDA #$00
+1c2c : 95 01 __ STA $01,x
+1c2e : a4 02 __ LDY $02
+1c30 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1c33 : b1 19 __ LDA (IP + 0),y
+1c35 : aa __ __ TAX
+1c36 : c8 __ __ INY
+1c37 : b1 19 __ LDA (IP + 0),y
+1c39 : 84 02 __ STY $02
+1c3b : a8 __ __ TAY
+1c3c : b1 25 __ LDA (FP + 0),y
+1c3e : 95 00 __ STA $00,x
+1c40 : c8 __ __ INY
+1c41 : b1 25 __ LDA (FP + 0),y
+1c43 : 95 01 __ STA $01,x
+1c45 : a4 02 __ LDY $02
+1c47 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1c4a : b1 19 __ LDA (IP + 0),y
+1c4c : aa __ __ TAX
+1c4d : c8 __ __ INY
+1c4e : b1 19 __ LDA (IP + 0),y
+1c50 : 84 02 __ STY $02
+1c52 : a8 __ __ TAY
+1c53 : b5 00 __ LDA $00,x
+1c55 : 91 25 __ STA (FP + 0),y
+1c57 : a4 02 __ LDY $02
+1c59 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1c5c : b1 19 __ LDA (IP + 0),y
+1c5e : aa __ __ TAX
+1c5f : c8 __ __ INY
+1c60 : b1 19 __ LDA (IP + 0),y
+1c62 : 84 02 __ STY $02
+1c64 : a8 __ __ TAY
+1c65 : b5 00 __ LDA $00,x
+1c67 : 91 25 __ STA (FP + 0),y
+1c69 : c8 __ __ INY
+1c6a : b5 01 __ LDA $01,x
+1c6c : 91 25 __ STA (FP + 0),y
+1c6e : a4 02 __ LDY $02
+1c70 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1c73 : b1 19 __ LDA (IP + 0),y
+1c75 : aa __ __ TAX
+1c76 : c8 __ __ INY
+1c77 : 18 __ __ CLC
+1c78 : b1 19 __ LDA (IP + 0),y
+1c7a : 65 25 __ ADC FP + 0
+1c7c : 95 00 __ STA $00,x
+1c7e : c8 __ __ INY
+1c7f : b1 19 __ LDA (IP + 0),y
+1c81 : 65 26 __ ADC FP + 1
+1c83 : 95 01 __ STA $01,x
+1c85 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1c88 : b1 19 __ LDA (IP + 0),y
+1c8a : aa __ __ TAX
+1c8b : c8 __ __ INY
+1c8c : b1 19 __ LDA (IP + 0),y
+1c8e : 84 02 __ STY $02
+1c90 : a8 __ __ TAY
+1c91 : b5 00 __ LDA $00,x
+1c93 : 91 23 __ STA (SP + 0),y
+1c95 : c8 __ __ INY
+1c96 : b5 01 __ LDA $01,x
+1c98 : 91 23 __ STA (SP + 0),y
+1c9a : a4 02 __ LDY $02
+1c9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1c9f : b1 19 __ LDA (IP + 0),y
+1ca1 : aa __ __ TAX
+1ca2 : c8 __ __ INY
+1ca3 : b1 19 __ LDA (IP + 0),y
+1ca5 : 84 02 __ STY $02
+1ca7 : a8 __ __ TAY
+1ca8 : b5 00 __ LDA $00,x
+1caa : 91 23 __ STA (SP + 0),y
+1cac : c8 __ __ INY
+1cad : b5 01 __ LDA $01,x
+1caf : 91 23 __ STA (SP + 0),y
+1cb1 : c8 __ __ INY
+1cb2 : b5 02 __ LDA $02,x
+1cb4 : 91 23 __ STA (SP + 0),y
+1cb6 : c8 __ __ INY
+1cb7 : b5 03 __ LDA $03,x
+1cb9 : 91 23 __ STA (SP + 0),y
+1cbb : a4 02 __ LDY $02
+1cbd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1cc0 : b1 19 __ LDA (IP + 0),y
+1cc2 : 85 1f __ STA ADDR + 0
+1cc4 : c8 __ __ INY
+1cc5 : b1 19 __ LDA (IP + 0),y
+1cc7 : 85 20 __ STA ADDR + 1
+1cc9 : c8 __ __ INY
+1cca : b1 19 __ LDA (IP + 0),y
+1ccc : aa __ __ TAX
+1ccd : 84 02 __ STY $02
+1ccf : a0 00 __ LDY #$00
+1cd1 : b1 1f __ LDA (ADDR + 0),y
+1cd3 : 95 00 __ STA $00,x
+1cd5 : a4 02 __ LDY $02
+1cd7 : 4c 50 08 JMP $0850 ; (startup + 79)
+1cda : b1 19 __ LDA (IP + 0),y
+1cdc : aa __ __ TAX
+1cdd : c8 __ __ INY
+1cde : b1 19 __ LDA (IP + 0),y
+1ce0 : 84 02 __ STY $02
+1ce2 : a8 __ __ TAY
+1ce3 : 4c d1 1c JMP $1cd1 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1ce6 : b1 19 __ LDA (IP + 0),y
+1ce8 : 85 1f __ STA ADDR + 0
+1cea : c8 __ __ INY
+1ceb : b1 19 __ LDA (IP + 0),y
+1ced : 85 20 __ STA ADDR + 1
+1cef : c8 __ __ INY
+1cf0 : b1 19 __ LDA (IP + 0),y
+1cf2 : aa __ __ TAX
+1cf3 : 84 02 __ STY $02
+1cf5 : a0 00 __ LDY #$00
+1cf7 : b1 1f __ LDA (ADDR + 0),y
+1cf9 : 95 00 __ STA $00,x
+1cfb : c8 __ __ INY
+1cfc : b1 1f __ LDA (ADDR + 0),y
+1cfe : 95 01 __ STA $01,x
+1d00 : a4 02 __ LDY $02
+1d02 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d05 : b1 19 __ LDA (IP + 0),y
+1d07 : aa __ __ TAX
+1d08 : c8 __ __ INY
+1d09 : b1 19 __ LDA (IP + 0),y
+1d0b : 84 02 __ STY $02
+1d0d : a8 __ __ TAY
+1d0e : 4c f7 1c JMP $1cf7 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1d11 : b1 19 __ LDA (IP + 0),y
+1d13 : 85 1f __ STA ADDR + 0
+1d15 : c8 __ __ INY
+1d16 : b1 19 __ LDA (IP + 0),y
+1d18 : 85 20 __ STA ADDR + 1
+1d1a : c8 __ __ INY
+1d1b : b1 19 __ LDA (IP + 0),y
+1d1d : aa __ __ TAX
+1d1e : 84 02 __ STY $02
+1d20 : a0 00 __ LDY #$00
+1d22 : b1 1f __ LDA (ADDR + 0),y
+1d24 : 95 00 __ STA $00,x
+1d26 : c8 __ __ INY
+1d27 : b1 1f __ LDA (ADDR + 0),y
+1d29 : 95 01 __ STA $01,x
+1d2b : c8 __ __ INY
+1d2c : b1 1f __ LDA (ADDR + 0),y
+1d2e : 95 02 __ STA $02,x
+1d30 : c8 __ __ INY
+1d31 : b1 1f __ LDA (ADDR + 0),y
+1d33 : 95 03 __ STA $03,x
+1d35 : a4 02 __ LDY $02
+1d37 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d3a : b1 19 __ LDA (IP + 0),y
+1d3c : aa __ __ TAX
+1d3d : c8 __ __ INY
+1d3e : b1 19 __ LDA (IP + 0),y
+1d40 : 84 02 __ STY $02
+1d42 : a8 __ __ TAY
+1d43 : 4c 22 1d JMP $1d22 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1d46 : b1 19 __ LDA (IP + 0),y
+1d48 : 85 1f __ STA ADDR + 0
+1d4a : c8 __ __ INY
+1d4b : b1 19 __ LDA (IP + 0),y
+1d4d : 85 20 __ STA ADDR + 1
+1d4f : c8 __ __ INY
+1d50 : b1 19 __ LDA (IP + 0),y
+1d52 : aa __ __ TAX
+1d53 : 84 02 __ STY $02
+1d55 : a0 00 __ LDY #$00
+1d57 : b5 00 __ LDA $00,x
+1d59 : 91 1f __ STA (ADDR + 0),y
+1d5b : a4 02 __ LDY $02
+1d5d : 4c 50 08 JMP $0850 ; (startup + 79)
+1d60 : b1 19 __ LDA (IP + 0),y
+1d62 : aa __ __ TAX
+1d63 : c8 __ __ INY
+1d64 : b1 19 __ LDA (IP + 0),y
+1d66 : 84 02 __ STY $02
+1d68 : a8 __ __ TAY
+1d69 : 4c 57 1d JMP $1d57 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1d6c : b1 19 __ LDA (IP + 0),y
+1d6e : aa __ __ TAX
+1d6f : 18 __ __ CLC
+1d70 : a5 1b __ LDA ACCU + 0
+1d72 : 75 00 __ ADC $00,x
+1d74 : 85 1b __ STA ACCU + 0
+1d76 : a5 1c __ LDA ACCU + 1
+1d78 : 75 01 __ ADC $01,x
+1d7a : 85 1c __ STA ACCU + 1
+1d7c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1d7f : b1 19 __ LDA (IP + 0),y
+1d81 : aa __ __ TAX
+1d82 : 38 __ __ SEC
+1d83 : a5 1b __ LDA ACCU + 0
+1d85 : f5 00 __ SBC $00,x
+1d87 : 85 1b __ STA ACCU + 0
+1d89 : a5 1c __ LDA ACCU + 1
+1d8b : f5 01 __ SBC $01,x
+1d8d : 85 1c __ STA ACCU + 1
+1d8f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+1d92 : b1 19 __ LDA (IP + 0),y
+1d94 : aa __ __ TAX
+1d95 : a9 00 __ LDA #$00
+1d97 : 85 05 __ STA $05
+1d99 : 85 06 __ STA $06
+1d9b : b5 00 __ LDA $00,x
+1d9d : 85 03 __ STA $03
+1d9f : b5 01 __ LDA $01,x
+1da1 : 85 04 __ STA $04
+1da3 : a2 10 __ LDX #$10
+1da5 : 46 04 __ LSR $04
+1da7 : 66 03 __ ROR $03
+1da9 : 90 0d __ BCC $1db8
+1dab : 18 __ __ CLC
+1dac : a5 05 __ LDA $05
+1dae : 65 1b __ ADC ACCU + 0
+1db0 : 85 05 __ STA $05
+1db2 : a5 06 __ LDA $06
+1db4 : 65 1c __ ADC ACCU + 1
+1db6 : 85 06 __ STA $06
+1db8 : 06 1b __ ASL ACCU + 0
+1dba : 26 1c __ ROL ACCU + 1
+1dbc : ca __ __ DEX
+1dbd : d0 e6 __ BNE $1da5
+1dbf : a5 05 __ LDA $05
+1dc1 : 85 1b __ STA ACCU + 0
+1dc3 : a5 06 __ LDA $06
+1dc5 : 85 1c __ STA ACCU + 1
+1dc7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1dca : b1 19 __ LDA (IP + 0),y
+1dcc : aa __ __ TAX
+1dcd : b5 00 __ LDA $00,x
+1dcf : 85 03 __ STA $03
+1dd1 : b5 01 __ LDA $01,x
+1dd3 : 85 04 __ STA $04
+1dd5 : 20 af 18 JSR $18af ; (divmod + 0)
+1dd8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1ddb : b1 19 __ LDA (IP + 0),y
+1ddd : aa __ __ TAX
+1dde : b5 00 __ LDA $00,x
+1de0 : 85 03 __ STA $03
+1de2 : b5 01 __ LDA $01,x
+1de4 : 85 04 __ STA $04
+1de6 : 20 af 18 JSR $18af ; (divmod + 0)
+1de9 : a5 05 __ LDA $05
+1deb : 85 1b __ STA ACCU + 0
+1ded : a5 06 __ LDA $06
+1def : 85 1c __ STA ACCU + 1
+1df1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1df4 : b1 19 __ LDA (IP + 0),y
+1df6 : aa __ __ TAX
+1df7 : b5 00 __ LDA $00,x
+1df9 : 85 03 __ STA $03
+1dfb : b5 01 __ LDA $01,x
+1dfd : 85 04 __ STA $04
+1dff : 24 1c __ BIT ACCU + 1
+1e01 : 10 10 __ BPL $1e13
+1e03 : 20 93 18 JSR $1893 ; (negaccu + 0)
+1e06 : 24 04 __ BIT $04
+1e08 : 10 10 __ BPL $1e1a
+1e0a : 20 a1 18 JSR $18a1 ; (negtmp + 0)
+1e0d : 20 af 18 JSR $18af ; (divmod + 0)
+1e10 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e13 : 24 04 __ BIT $04
+1e15 : 10 f6 __ BPL $1e0d
+1e17 : 20 a1 18 JSR $18a1 ; (negtmp + 0)
+1e1a : 20 af 18 JSR $18af ; (divmod + 0)
+1e1d : 20 93 18 JSR $1893 ; (negaccu + 0)
+1e20 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1e23 : b1 19 __ LDA (IP + 0),y
+1e25 : aa __ __ TAX
+1e26 : b5 00 __ LDA $00,x
+1e28 : 85 03 __ STA $03
+1e2a : b5 01 __ LDA $01,x
+1e2c : 85 04 __ STA $04
+1e2e : 24 1c __ BIT ACCU + 1
+1e30 : 10 18 __ BPL $1e4a
+1e32 : 20 93 18 JSR $1893 ; (negaccu + 0)
+1e35 : 24 04 __ BIT $04
+1e37 : 10 18 __ BPL $1e51
+1e39 : 20 a1 18 JSR $18a1 ; (negtmp + 0)
+1e3c : 20 af 18 JSR $18af ; (divmod + 0)
+1e3f : a5 05 __ LDA $05
+1e41 : 85 1b __ STA ACCU + 0
+1e43 : a5 06 __ LDA $06
+1e45 : 85 1c __ STA ACCU + 1
+1e47 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e4a : 24 04 __ BIT $04
+1e4c : 10 ee __ BPL $1e3c
+1e4e : 20 a1 18 JSR $18a1 ; (negtmp + 0)
+1e51 : 20 af 18 JSR $18af ; (divmod + 0)
+1e54 : a5 05 __ LDA $05
+1e56 : 85 1b __ STA ACCU + 0
+1e58 : a5 06 __ LDA $06
+1e5a : 85 1c __ STA ACCU + 1
+1e5c : 20 93 18 JSR $1893 ; (negaccu + 0)
+1e5f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1e62 : b1 19 __ LDA (IP + 0),y
+1e64 : aa __ __ TAX
+1e65 : 18 __ __ CLC
+1e66 : b5 00 __ LDA $00,x
+1e68 : 65 1b __ ADC ACCU + 0
+1e6a : 95 00 __ STA $00,x
+1e6c : b5 01 __ LDA $01,x
+1e6e : 65 1c __ ADC ACCU + 1
+1e70 : 95 01 __ STA $01,x
+1e72 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1e75 : b1 19 __ LDA (IP + 0),y
+1e77 : c8 __ __ INY
+1e78 : aa __ __ TAX
+1e79 : 18 __ __ CLC
+1e7a : b5 00 __ LDA $00,x
+1e7c : 71 19 __ ADC (IP + 0),y
+1e7e : c8 __ __ INY
+1e7f : 95 00 __ STA $00,x
+1e81 : b5 01 __ LDA $01,x
+1e83 : 71 19 __ ADC (IP + 0),y
+1e85 : 95 01 __ STA $01,x
+1e87 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1e8a : b1 19 __ LDA (IP + 0),y
+1e8c : c8 __ __ INY
+1e8d : aa __ __ TAX
+1e8e : 38 __ __ SEC
+1e8f : b1 19 __ LDA (IP + 0),y
+1e91 : c8 __ __ INY
+1e92 : f5 00 __ SBC $00,x
+1e94 : 95 00 __ STA $00,x
+1e96 : b1 19 __ LDA (IP + 0),y
+1e98 : f5 01 __ SBC $01,x
+1e9a : 95 01 __ STA $01,x
+1e9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1e9f : b1 19 __ LDA (IP + 0),y
+1ea1 : c8 __ __ INY
+1ea2 : aa __ __ TAX
+1ea3 : b5 00 __ LDA $00,x
+1ea5 : 31 19 __ AND (IP + 0),y
+1ea7 : c8 __ __ INY
+1ea8 : 95 00 __ STA $00,x
+1eaa : b5 01 __ LDA $01,x
+1eac : 31 19 __ AND (IP + 0),y
+1eae : 95 01 __ STA $01,x
+1eb0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1eb3 : b1 19 __ LDA (IP + 0),y
+1eb5 : c8 __ __ INY
+1eb6 : aa __ __ TAX
+1eb7 : a9 00 __ LDA #$00
+1eb9 : 85 05 __ STA $05
+1ebb : 85 06 __ STA $06
+1ebd : b5 00 __ LDA $00,x
+1ebf : 85 03 __ STA $03
+1ec1 : b5 01 __ LDA $01,x
+1ec3 : 85 04 __ STA $04
+1ec5 : b1 19 __ LDA (IP + 0),y
+1ec7 : 4a __ __ LSR
+1ec8 : 85 07 __ STA $07
+1eca : 90 0d __ BCC $1ed9
+1ecc : 18 __ __ CLC
+1ecd : a5 05 __ LDA $05
+1ecf : 65 03 __ ADC $03
+1ed1 : 85 05 __ STA $05
+1ed3 : a5 06 __ LDA $06
+1ed5 : 65 04 __ ADC $04
+1ed7 : 85 06 __ STA $06
+1ed9 : 06 03 __ ASL $03
+1edb : 26 04 __ ROL $04
+1edd : 46 07 __ LSR $07
+1edf : b0 eb __ BCS $1ecc
+1ee1 : d0 f6 __ BNE $1ed9
+1ee3 : a5 05 __ LDA $05
+1ee5 : 95 00 __ STA $00,x
+1ee7 : a5 06 __ LDA $06
+1ee9 : 95 01 __ STA $01,x
+1eeb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1eee : b1 19 __ LDA (IP + 0),y
+1ef0 : c8 __ __ INY
+1ef1 : aa __ __ TAX
+1ef2 : 18 __ __ CLC
+1ef3 : b5 00 __ LDA $00,x
+1ef5 : 71 19 __ ADC (IP + 0),y
+1ef7 : 95 00 __ STA $00,x
+1ef9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1efc : b1 19 __ LDA (IP + 0),y
+1efe : aa __ __ TAX
+1eff : 38 __ __ SEC
+1f00 : b5 01 __ LDA $01,x
+1f02 : e5 1c __ SBC ACCU + 1
+1f04 : f0 11 __ BEQ $1f17
+1f06 : 50 02 __ BVC $1f0a
+1f08 : 49 80 __ EOR #$80
+1f0a : 30 2a __ BMI $1f36
+1f0c : 10 33 __ BPL $1f41
+1f0e : b1 19 __ LDA (IP + 0),y
+1f10 : aa __ __ TAX
+1f11 : b5 01 __ LDA $01,x
+1f13 : c5 1c __ CMP ACCU + 1
+1f15 : d0 28 __ BNE $1f3f
+1f17 : b5 00 __ LDA $00,x
+1f19 : c5 1b __ CMP ACCU + 0
+1f1b : d0 22 __ BNE $1f3f
+1f1d : f0 0e __ BEQ $1f2d
+1f1f : b1 19 __ LDA (IP + 0),y
+1f21 : aa __ __ TAX
+1f22 : c8 __ __ INY
+1f23 : b1 19 __ LDA (IP + 0),y
+1f25 : c5 1c __ CMP ACCU + 1
+1f27 : d0 16 __ BNE $1f3f
+1f29 : e4 1b __ CPX ACCU + 0
+1f2b : d0 12 __ BNE $1f3f
+1f2d : a9 00 __ LDA #$00
+1f2f : 85 1b __ STA ACCU + 0
+1f31 : 85 1c __ STA ACCU + 1
+1f33 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f36 : a9 ff __ LDA #$ff
+1f38 : 85 1b __ STA ACCU + 0
+1f3a : 85 1c __ STA ACCU + 1
+1f3c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f3f : 90 f5 __ BCC $1f36
+1f41 : a9 01 __ LDA #$01
+1f43 : 85 1b __ STA ACCU + 0
+1f45 : a9 00 __ LDA #$00
+1f47 : 85 1c __ STA ACCU + 1
+1f49 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f4c : b1 19 __ LDA (IP + 0),y
+1f4e : c8 __ __ INY
+1f4f : aa __ __ TAX
+1f50 : b1 19 __ LDA (IP + 0),y
+1f52 : 38 __ __ SEC
+1f53 : e5 1c __ SBC ACCU + 1
+1f55 : d0 af __ BNE $1f06
+1f57 : e4 1b __ CPX ACCU + 0
+1f59 : d0 e4 __ BNE $1f3f
+1f5b : f0 d0 __ BEQ $1f2d
+1f5d : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1f5e : b1 19 __ LDA (IP + 0),y
+1f60 : aa __ __ TAX
+1f61 : 38 __ __ SEC
+1f62 : b5 00 __ LDA $00,x
+1f64 : e5 1b __ SBC ACCU + 0
+1f66 : f0 19 __ BEQ $1f81
+1f68 : 50 02 __ BVC $1f6c
+1f6a : 49 80 __ EOR #$80
+1f6c : 30 1c __ BMI $1f8a
+1f6e : 10 25 __ BPL $1f95
+1f70 : b1 19 __ LDA (IP + 0),y
+1f72 : aa __ __ TAX
+1f73 : b5 00 __ LDA $00,x
+1f75 : c5 1b __ CMP ACCU + 0
+1f77 : d0 1a __ BNE $1f93
+1f79 : f0 06 __ BEQ $1f81
+1f7b : b1 19 __ LDA (IP + 0),y
+1f7d : c5 1b __ CMP ACCU + 0
+1f7f : d0 12 __ BNE $1f93
+1f81 : a9 00 __ LDA #$00
+1f83 : 85 1b __ STA ACCU + 0
+1f85 : 85 1c __ STA ACCU + 1
+1f87 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f8a : a9 ff __ LDA #$ff
+1f8c : 85 1b __ STA ACCU + 0
+1f8e : 85 1c __ STA ACCU + 1
+1f90 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f93 : 90 f5 __ BCC $1f8a
+1f95 : a9 01 __ LDA #$01
+1f97 : 85 1b __ STA ACCU + 0
+1f99 : a9 00 __ LDA #$00
+1f9b : 85 1c __ STA ACCU + 1
+1f9d : 4c 50 08 JMP $0850 ; (startup + 79)
+1fa0 : b1 19 __ LDA (IP + 0),y
+1fa2 : 38 __ __ SEC
+1fa3 : e5 1b __ SBC ACCU + 0
+1fa5 : d0 c1 __ BNE $1f68
+1fa7 : f0 d8 __ BEQ $1f81
+1fa9 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1faa : 38 __ __ SEC
+1fab : a9 00 __ LDA #$00
+1fad : e5 1b __ SBC ACCU + 0
+1faf : 85 1b __ STA ACCU + 0
+1fb1 : a9 00 __ LDA #$00
+1fb3 : e5 1c __ SBC ACCU + 1
+1fb5 : 85 1c __ STA ACCU + 1
+1fb7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1fba : 20 6a 16 JSR $166a ; (freg + 0)
+1fbd : 20 af 16 JSR $16af ; (faddsub + 0)
+1fc0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1fc3 : 20 6a 16 JSR $166a ; (freg + 0)
+1fc6 : a5 06 __ LDA $06
+1fc8 : 49 80 __ EOR #$80
+1fca : 85 06 __ STA $06
+1fcc : 20 af 16 JSR $16af ; (faddsub + 0)
+1fcf : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1fd2 : 20 6a 16 JSR $166a ; (freg + 0)
+1fd5 : 84 02 __ STY $02
+1fd7 : 20 77 17 JSR $1777 ; (fmul + 0)
+1fda : a4 02 __ LDY $02
+1fdc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1fdf : 20 6a 16 JSR $166a ; (freg + 0)
+1fe2 : 20 15 18 JSR $1815 ; (fdiv + 0)
+1fe5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1fe8 : b1 19 __ LDA (IP + 0),y
+1fea : c8 __ __ INY
+1feb : aa __ __ TAX
+1fec : a5 1e __ LDA ACCU + 3
+1fee : 55 03 __ EOR $03,x
+1ff0 : 29 80 __ AND #$80
+1ff2 : f0 1e __ BEQ $2012
+1ff4 : a5 1e __ LDA ACCU + 3
+1ff6 : 29 7f __ AND #$7f
+1ff8 : 05 1d __ ORA ACCU + 2
+1ffa : 05 1c __ ORA ACCU + 1
+1ffc : 05 1b __ ORA ACCU + 0
+1ffe : d0 0c __ BNE $200c
+2000 : b5 03 __ LDA $03,x
+2002 : 29 7f __ AND #$7f
+2004 : 15 02 __ ORA $02,x
+2006 : 15 01 __ ORA $01,x
+2008 : 15 00 __ ORA $00,x
+200a : f0 1e __ BEQ $202a
+200c : a5 1e __ LDA ACCU + 3
+200e : 30 29 __ BMI $2039
+2010 : 10 36 __ BPL $2048
+2012 : a5 1e __ LDA ACCU + 3
+2014 : d5 03 __ CMP $03,x
+2016 : d0 1b __ BNE $2033
+2018 : a5 1d __ LDA ACCU + 2
+201a : d5 02 __ CMP $02,x
+201c : d0 15 __ BNE $2033
+201e : a5 1c __ LDA ACCU + 1
+2020 : d5 01 __ CMP $01,x
+2022 : d0 0f __ BNE $2033
+2024 : a5 1b __ LDA ACCU + 0
+2026 : d5 00 __ CMP $00,x
+2028 : d0 09 __ BNE $2033
+202a : a9 00 __ LDA #$00
+202c : 85 1b __ STA ACCU + 0
+202e : 85 1c __ STA ACCU + 1
+2030 : 4c 51 08 JMP $0851 ; (startup + 80)
+2033 : b0 0f __ BCS $2044
+2035 : 24 1e __ BIT ACCU + 3
+2037 : 30 0f __ BMI $2048
+2039 : a9 00 __ LDA #$00
+203b : 85 1c __ STA ACCU + 1
+203d : a9 01 __ LDA #$01
+203f : 85 1b __ STA ACCU + 0
+2041 : 4c 51 08 JMP $0851 ; (startup + 80)
+2044 : 24 1e __ BIT ACCU + 3
+2046 : 30 f1 __ BMI $2039
+2048 : a9 ff __ LDA #$ff
+204a : 85 1b __ STA ACCU + 0
+204c : 85 1c __ STA ACCU + 1
+204e : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+2051 : a5 1e __ LDA ACCU + 3
+2053 : 49 80 __ EOR #$80
+2055 : 85 1e __ STA ACCU + 3
+2057 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+205a : 20 76 19 JSR $1976 ; (sint16_to_float + 0)
+205d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+2060 : 20 34 19 JSR $1934 ; (f32_to_i16 + 0)
+2063 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+2066 : b1 19 __ LDA (IP + 0),y
+2068 : 30 0c __ BMI $2076
+206a : 38 __ __ SEC
+206b : 65 19 __ ADC IP + 0
+206d : 85 19 __ STA IP + 0
+206f : 90 02 __ BCC $2073
+2071 : e6 1a __ INC IP + 1
+2073 : 4c 51 08 JMP $0851 ; (startup + 80)
+2076 : 38 __ __ SEC
+2077 : 65 19 __ ADC IP + 0
+2079 : 85 19 __ STA IP + 0
+207b : b0 02 __ BCS $207f
+207d : c6 1a __ DEC IP + 1
+207f : 4c 51 08 JMP $0851 ; (startup + 80)
+2082 : a5 1b __ LDA ACCU + 0
+2084 : 05 1c __ ORA ACCU + 1
+2086 : f0 de __ BEQ $2066
+2088 : 4c 50 08 JMP $0850 ; (startup + 79)
+208b : a5 1b __ LDA ACCU + 0
+208d : 05 1c __ ORA ACCU + 1
+208f : d0 d5 __ BNE $2066
+2091 : 4c 50 08 JMP $0850 ; (startup + 79)
+2094 : a5 1c __ LDA ACCU + 1
+2096 : 30 04 __ BMI $209c
+2098 : 05 1b __ ORA ACCU + 0
+209a : d0 ca __ BNE $2066
+209c : 4c 50 08 JMP $0850 ; (startup + 79)
+209f : a5 1c __ LDA ACCU + 1
+20a1 : 10 c3 __ BPL $2066
+20a3 : 4c 50 08 JMP $0850 ; (startup + 79)
+20a6 : a5 1c __ LDA ACCU + 1
+20a8 : 30 bc __ BMI $2066
+20aa : 4c 50 08 JMP $0850 ; (startup + 79)
+20ad : a5 1c __ LDA ACCU + 1
+20af : 30 b5 __ BMI $2066
+20b1 : 05 1b __ ORA ACCU + 0
+20b3 : f0 b1 __ BEQ $2066
+20b5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+20b8 : 38 __ __ SEC
+20b9 : b1 19 __ LDA (IP + 0),y
+20bb : 65 19 __ ADC IP + 0
+20bd : aa __ __ TAX
+20be : c8 __ __ INY
+20bf : b1 19 __ LDA (IP + 0),y
+20c1 : 65 1a __ ADC IP + 1
+20c3 : 85 1a __ STA IP + 1
+20c5 : 86 19 __ STX IP + 0
+20c7 : 4c 51 08 JMP $0851 ; (startup + 80)
+20ca : a5 1b __ LDA ACCU + 0
+20cc : 05 1c __ ORA ACCU + 1
+20ce : f0 e8 __ BEQ $20b8
+20d0 : c8 __ __ INY
+20d1 : 4c 50 08 JMP $0850 ; (startup + 79)
+20d4 : a5 1b __ LDA ACCU + 0
+20d6 : 05 1c __ ORA ACCU + 1
+20d8 : d0 de __ BNE $20b8
+20da : c8 __ __ INY
+20db : 4c 50 08 JMP $0850 ; (startup + 79)
+20de : a5 1c __ LDA ACCU + 1
+20e0 : 30 04 __ BMI $20e6
+20e2 : 05 1b __ ORA ACCU + 0
+20e4 : d0 d2 __ BNE $20b8
+20e6 : c8 __ __ INY
+20e7 : 4c 50 08 JMP $0850 ; (startup + 79)
+20ea : a5 1c __ LDA ACCU + 1
+20ec : 10 ca __ BPL $20b8
+20ee : c8 __ __ INY
+20ef : 4c 50 08 JMP $0850 ; (startup + 79)
+20f2 : a5 1c __ LDA ACCU + 1
+20f4 : 30 c2 __ BMI $20b8
+20f6 : c8 __ __ INY
+20f7 : 4c 50 08 JMP $0850 ; (startup + 79)
+20fa : a5 1c __ LDA ACCU + 1
+20fc : 30 ba __ BMI $20b8
+20fe : 05 1b __ ORA ACCU + 0
+2100 : f0 b6 __ BEQ $20b8
+2102 : c8 __ __ INY
+2103 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2106 : a9 00 __ LDA #$00
+2108 : 2c a9 01 BIT $01a9 
+210b : 85 1b __ STA ACCU + 0
+210d : a9 00 __ LDA #$00
+210f : 85 1c __ STA ACCU + 1
+2111 : 4c 51 08 JMP $0851 ; (startup + 80)
+2114 : a5 1b __ LDA ACCU + 0
+2116 : 05 1c __ ORA ACCU + 1
+2118 : f0 ef __ BEQ $2109
+211a : d0 ea __ BNE $2106
+211c : a5 1b __ LDA ACCU + 0
+211e : 05 1c __ ORA ACCU + 1
+2120 : d0 e7 __ BNE $2109
+2122 : f0 e2 __ BEQ $2106
+2124 : a5 1c __ LDA ACCU + 1
+2126 : 30 de __ BMI $2106
+2128 : 05 1b __ ORA ACCU + 0
+212a : d0 dd __ BNE $2109
+212c : f0 d8 __ BEQ $2106
+212e : a5 1c __ LDA ACCU + 1
+2130 : 10 d7 __ BPL $2109
+2132 : 30 d2 __ BMI $2106
+2134 : a5 1c __ LDA ACCU + 1
+2136 : 30 d1 __ BMI $2109
+2138 : 10 cc __ BPL $2106
+213a : a5 1c __ LDA ACCU + 1
+213c : 30 cb __ BMI $2109
+213e : 05 1b __ ORA ACCU + 0
+2140 : f0 c7 __ BEQ $2109
+2142 : d0 c2 __ BNE $2106
+2144 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+2145 : b1 19 __ LDA (IP + 0),y
+2147 : 8d 5b 21 STA $215b ; (inp_jsr + 22)
+214a : c8 __ __ INY
+214b : b1 19 __ LDA (IP + 0),y
+214d : 8d 5c 21 STA $215c ; (inp_jsr + 23)
+2150 : 98 __ __ TYA
+2151 : 38 __ __ SEC
+2152 : 65 19 __ ADC IP + 0
+2154 : 85 19 __ STA IP + 0
+2156 : 90 02 __ BCC $215a
+2158 : e6 1a __ INC IP + 1
+215a : 20 00 00 JSR $0000 
+215d : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+2160 : 98 __ __ TYA
+2161 : 18 __ __ CLC
+2162 : 65 19 __ ADC IP + 0
+2164 : 8d 6f 21 STA $216f ; (inp_native + 15)
+2167 : a5 1a __ LDA IP + 1
+2169 : 69 00 __ ADC #$00
+216b : 8d 70 21 STA $2170 ; (inp_native + 16)
+216e : 20 00 00 JSR $0000 
+2171 : a0 00 __ LDY #$00
+2173 : b1 23 __ LDA (SP + 0),y
+2175 : 85 19 __ STA IP + 0
+2177 : c8 __ __ INY
+2178 : b1 23 __ LDA (SP + 0),y
+217a : 85 1a __ STA IP + 1
+217c : 88 __ __ DEY
+217d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+2180 : 38 __ __ SEC
+2181 : a5 23 __ LDA SP + 0
+2183 : f1 19 __ SBC (IP + 0),y
+2185 : c8 __ __ INY
+2186 : 85 23 __ STA SP + 0
+2188 : a5 24 __ LDA SP + 1
+218a : f1 19 __ SBC (IP + 0),y
+218c : c8 __ __ INY
+218d : 85 24 __ STA SP + 1
+218f : b1 19 __ LDA (IP + 0),y
+2191 : 84 02 __ STY $02
+2193 : a8 __ __ TAY
+2194 : a5 25 __ LDA FP + 0
+2196 : 91 23 __ STA (SP + 0),y
+2198 : c8 __ __ INY
+2199 : a5 26 __ LDA FP + 1
+219b : 91 23 __ STA (SP + 0),y
+219d : 98 __ __ TYA
+219e : 38 __ __ SEC
+219f : 65 23 __ ADC SP + 0
+21a1 : 85 25 __ STA FP + 0
+21a3 : a9 00 __ LDA #$00
+21a5 : 65 24 __ ADC SP + 1
+21a7 : 85 26 __ STA FP + 1
+21a9 : 88 __ __ DEY
+21aa : f0 08 __ BEQ $21b4
+21ac : b9 52 00 LDA $0052,y 
+21af : 88 __ __ DEY
+21b0 : 91 23 __ STA (SP + 0),y
+21b2 : d0 f8 __ BNE $21ac
+21b4 : a4 02 __ LDY $02
+21b6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+21b9 : b1 19 __ LDA (IP + 0),y
+21bb : c8 __ __ INY
+21bc : 84 02 __ STY $02
+21be : a8 __ __ TAY
+21bf : b1 23 __ LDA (SP + 0),y
+21c1 : 85 25 __ STA FP + 0
+21c3 : c8 __ __ INY
+21c4 : b1 23 __ LDA (SP + 0),y
+21c6 : 85 26 __ STA FP + 1
+21c8 : 88 __ __ DEY
+21c9 : f0 09 __ BEQ $21d4
+21cb : 88 __ __ DEY
+21cc : b1 23 __ LDA (SP + 0),y
+21ce : 99 53 00 STA $0053,y 
+21d1 : 88 __ __ DEY
+21d2 : 10 f8 __ BPL $21cc
+21d4 : a4 02 __ LDY $02
+21d6 : 18 __ __ CLC
+21d7 : b1 19 __ LDA (IP + 0),y
+21d9 : c8 __ __ INY
+21da : 65 23 __ ADC SP + 0
+21dc : 85 23 __ STA SP + 0
+21de : b1 19 __ LDA (IP + 0),y
+21e0 : c8 __ __ INY
+21e1 : 65 24 __ ADC SP + 1
+21e3 : 85 24 __ STA SP + 1
+21e5 : a0 01 __ LDY #$01
+21e7 : b1 23 __ LDA (SP + 0),y
+21e9 : 85 1a __ STA IP + 1
+21eb : 88 __ __ DEY
+21ec : b1 23 __ LDA (SP + 0),y
+21ee : 85 19 __ STA IP + 0
+21f0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+21f3 : b1 19 __ LDA (IP + 0),y
+21f5 : 85 1f __ STA ADDR + 0
+21f7 : c8 __ __ INY
+21f8 : b1 19 __ LDA (IP + 0),y
+21fa : 85 20 __ STA ADDR + 1
+21fc : c8 __ __ INY
+21fd : 98 __ __ TYA
+21fe : a0 00 __ LDY #$00
+2200 : 18 __ __ CLC
+2201 : 65 19 __ ADC IP + 0
+2203 : 91 23 __ STA (SP + 0),y
+2205 : c8 __ __ INY
+2206 : a5 1a __ LDA IP + 1
+2208 : 69 00 __ ADC #$00
+220a : 91 23 __ STA (SP + 0),y
+220c : a5 1f __ LDA ADDR + 0
+220e : 85 19 __ STA IP + 0
+2210 : a5 20 __ LDA ADDR + 1
+2212 : 85 1a __ STA IP + 1
+2214 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2217 : 38 __ __ SEC
+2218 : a5 23 __ LDA SP + 0
+221a : f1 19 __ SBC (IP + 0),y
+221c : c8 __ __ INY
+221d : 85 23 __ STA SP + 0
+221f : a5 24 __ LDA SP + 1
+2221 : f1 19 __ SBC (IP + 0),y
+2223 : 85 24 __ STA SP + 1
+2225 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2228 : 18 __ __ CLC
+2229 : b1 19 __ LDA (IP + 0),y
+222b : c8 __ __ INY
+222c : 65 23 __ ADC SP + 0
+222e : 85 23 __ STA SP + 0
+2230 : b1 19 __ LDA (IP + 0),y
+2232 : 65 24 __ ADC SP + 1
+2234 : 85 24 __ STA SP + 1
+2236 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2239 : b1 19 __ LDA (IP + 0),y
+223b : c8 __ __ INY
+223c : 8d 4a 22 STA $224a ; (inp_op_extrt + 17)
+223f : b1 19 __ LDA (IP + 0),y
+2241 : c8 __ __ INY
+2242 : 8d 4b 22 STA $224b ; (inp_op_extrt + 18)
+2245 : b1 19 __ LDA (IP + 0),y
+2247 : c8 __ __ INY
+2248 : aa __ __ TAX
+2249 : 20 00 00 JSR $0000 
+224c : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,3191 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e cb 23 STX $23cb ; (spentry + 0)
+0811 : a9 cc __ LDA #$cc
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 24 __ LDA #$24
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 30 __ LDA #$30
+0832 : e9 cc __ SBC #$cc
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	4, 6
+0a04:	PUSH	#$0012
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	LEA	T2, buffer + 0
+0a11:	MOV	2(SP), T2
+0a14:	LEA	T2, $1779
+0a18:	MOV	4(SP), T2
+0a1b:	MOV	ACCU, #$014b
+0a1f:	MUL	ACCU, T1
+0a21:	ADD	ACCU, #$C180
+0a25:	MOV	6(SP), ACCU
+0a28:	MOV	ACCU, #$0269
+0a2c:	MUL	ACCU, T1
+0a2e:	MOV	8(SP), ACCU
+0a31:	MOV	ACCU, T1
+0a33:	MUL	ACCU, #97
+0a36:	MOV	10(SP), ACCU
+0a39:	MOV	12(SP), T1
+0a3c:	MOV	ACCU, T1
+0a3e:	NEG	ACCU
+0a3f:	MOV	14(SP), ACCU
+0a42:	LEA	T2, $178e
+0a46:	MOV	16(SP), T2
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	T2, #0
+0a4f:	MOVUB	ACCU, buffer + 0
+0a53:	BNEF	$0B29
+0a56:	MOV	ACCU, T2
+0a58:	ADD	T0, ACCU
+0a5a:	MOVUB	ACCU, buffer + 0
+0a5e:	BNEF	$0B0B
+0a61:	ADD	T1, #$0001
+0a65:	MOV	ACCU, T1
+0a67:	CMPS	ACCU, #$0064
+0a6a:	BGT	$0A0D
+0a6c:	MOV	T1, #0
+0a6f:	LEA	T2, buffer + 0
+0a73:	MOV	2(SP), T2
+0a76:	LEA	T2, $1792
+0a7a:	MOV	4(SP), T2
+0a7d:	MOV	ACCU, T1
+0a7f:	CNVSF	ACCU
+0a80:	MOVD	T6, ACCU
+0a82:	MOVD	$03, #$3fa00000
+0a88:	MULF	ACCU, $03
+0a8a:	MOVD	6(SP), ACCU
+0a8d:	MOVD	ACCU, T6
+0a8f:	MOVD	$03, #$bd800000
+0a95:	MULF	ACCU, $03
+0a97:	MOVD	10(SP), ACCU
+0a9a:	CALL	sprintf + 0
+0a9d:	MOV	T2, #0
+0aa0:	MOVUB	ACCU, buffer + 0
+0aa4:	BNE	$0AF8
+0aa6:	ADD	T1, #$0001
+0aaa:	MOV	ACCU, T2
+0aac:	ADD	T0, ACCU
+0aae:	MOV	ACCU, T1
+0ab0:	CMPS	ACCU, #$0014
+0ab3:	BGT	$0A6F
+0ab5:	LEA	T1, buffer + 0
+0ab9:	MOV	2(SP), T1
+0abc:	LEA	T2, $179b
+0ac0:	MOV	4(SP), T2
+0ac3:	MOV	ACCU, #-123
+0ac6:	MOV	6(SP), ACCU
+0ac9:	LEA	T2, $17a4
+0acd:	MOV	8(SP), T2
+0ad0:	MOV	ACCU, #$beef
+0ad4:	MOV	10(SP), ACCU
+0ad7:	CALL	sprintf + 0
+0ada:	MOV	ACCU, T1
+0adc:	MOV	P0, ACCU
+0ade:	LEA	P2, $17d8
+0ae2:	JSR	strcmp + 0
+0ae5:	BNE	$0AEE
+0ae7:	MOV	ACCU, T0
+0ae9:	SEQ
+0aea:	MOVB	T3, ACCU
+0aec:	JUMP	$0AF1
+0aee:	MOV	ACCU, #1
+0af1:	POP	#$0012
+0af4:	RETURN	4, 6
+0af8:	LEA	T4, buffer + 0
+0afc:	MOV	ACCU, T4
+0afe:	LEAX	ADDR, T2 + ACCU
+0b00:	MOVUB	ACCU, 1(ADDR)
+0b03:	ADD	T2, #$0001
+0b07:	BNE	$0AFC
+0b09:	JUMP	$0AA6
+0b0b:	MOV	T2, #0
+0b0e:	LEAX	ADDR, buffer + 0 + T2
+0b12:	MOVB	T3, 0(ADDR)
+0b15:	LEAX	ADDR, buffer + 1 + T2
+0b19:	MOVB	ACCU, T3
+0b1b:	ADD	T0, ACCU
+0b1d:	MOVUB	ACCU, 0(ADDR)
+0b20:	ADD	T2, #$0001
+0b24:	BNE	$0B0E
+0b26:	JUMPF	$0A61
+0b29:	LEA	T4, buffer + 0
+0b2d:	MOV	ACCU, T4
+0b2f:	LEAX	ADDR, T2 + ACCU
+0b31:	MOVUB	ACCU, 1(ADDR)
+0b34:	ADD	T2, #$0001
+0b38:	BNE	$0B2D
+0b3a:	JUMPF	$0A56
+--------------------------------------------------------------------
+sprintf:
+0b3d:	ENTER	18, 28
+0b41:	PUSH	#$0002
+0b44:	MOVB	T0, #0
+0b47:	MOV	T1, 12(FP)
+0b4a:	MOV	ADDR, T1
+0b4c:	MOVB	T2, 0(ADDR)
+0b4f:	MOV	T3, 10(FP)
+0b52:	MOVB	ACCU, T2
+0b54:	BNE	$0B7A
+0b56:	MOVB	ACCU, T0
+0b58:	ADD	ACCU, T3
+0b5a:	MOV	T1, ACCU
+0b5c:	MOV	ACCU, #0
+0b5f:	MOV	ADDR, T1
+0b61:	MOVB	0(ADDR), ACCU
+0b64:	MOVB	ACCU, T0
+0b66:	BNE	$0B6C
+0b68:	MOV	ACCU, T3
+0b6a:	MOV	T1, ACCU
+0b6c:	MOV	T3, 10(FP)
+0b6f:	MOV	ACCU, T1
+0b71:	SUB	ACCU, T3
+0b73:	POP	#$0002
+0b76:	RETURN	18, 28
+0b7a:	LEA	T4, 14(FP)
+0b7e:	ADD	T1, #$0001
+0b82:	MOVB	ACCU, T2
+0b84:	CMPUB	ACCU, #$0025
+0b86:	BEQ	$0BBB
+0b88:	MOVB	ACCU, T0
+0b8a:	LEAX	ADDR, T3 + ACCU
+0b8c:	MOVB	0(ADDR), T2
+0b8f:	ADDB	T0, #$0001
+0b92:	MOVB	ACCU, T0
+0b94:	CMPUB	ACCU, #$0028
+0b96:	BLE	$0BA3
+0b98:	MOV	ADDR, T1
+0b9a:	MOVB	T5, 0(ADDR)
+0b9d:	ADD	T1, #$0001
+0ba1:	JUMP	$0BB3
+0ba3:	MOVB	ACCU, T0
+0ba5:	ADD	T3, ACCU
+0ba7:	MOVB	T0, #0
+0baa:	MOV	ADDR, T1
+0bac:	MOVB	T5, 0(ADDR)
+0baf:	ADD	T1, #$0001
+0bb3:	MOVB	ACCU, T5
+0bb5:	MOVB	T2, ACCU
+0bb7:	BNE	$0B82
+0bb9:	JUMP	$0B56
+0bbb:	MOVB	ACCU, T0
+0bbd:	BEQ	$0BC6
+0bbf:	MOVB	ACCU, T0
+0bc1:	ADD	T3, ACCU
+0bc3:	MOVB	T0, #0
+0bc6:	MOV	ADDR, T1
+0bc8:	MOVB	T2, 0(ADDR)
+0bcb:	MOV	ACCU, #10
+0bce:	MOV	3(FP), ACCU
+0bd1:	MOV	ACCU, #1
+0bd4:	MOVB	1(FP), ACCU
+0bd7:	MOV	ACCU, #255
+0bda:	MOVB	2(FP), ACCU
+0bdd:	MOV	ACCU, #32
+0be0:	MOVB	0(FP), ACCU
+0be3:	MOV	ACCU, #0
+0be6:	MOVB	5(FP), ACCU
+0be9:	MOVB	6(FP), ACCU
+0bec:	MOVB	7(FP), ACCU
+0bef:	ADD	T1, #$0001
+0bf3:	MOVB	ACCU, T2
+0bf5:	CMPUB	ACCU, #$002B
+0bf7:	BEQF	$176B
+0bfa:	MOVB	ACCU, T2
+0bfc:	CMPUB	ACCU, #$0030
+0bfe:	BEQF	$175D
+0c01:	MOVB	ACCU, T2
+0c03:	CMPUB	ACCU, #$0023
+0c05:	BEQF	$174F
+0c08:	MOVB	ACCU, T2
+0c0a:	CMPUB	ACCU, #$0030
+0c0c:	BGT	$0C15
+0c0e:	MOVB	ACCU, T2
+0c10:	CMPUB	ACCU, #$0039
+0c12:	BGEF	$171E
+0c15:	MOVB	ACCU, T2
+0c17:	CMPUB	ACCU, #$002E
+0c19:	BEQF	$16E4
+0c1c:	MOVB	ACCU, T2
+0c1e:	CMPUB	ACCU, #$0064
+0c20:	BEQF	$15BC
+0c23:	MOVB	ACCU, T2
+0c25:	CMPUB	ACCU, #$0075
+0c27:	BEQF	$14BF
+0c2a:	MOVB	ACCU, T2
+0c2c:	CMPUB	ACCU, #$0078
+0c2e:	BEQF	$13BC
+0c31:	MOVB	ACCU, T2
+0c33:	CMPUB	ACCU, #$006C
+0c35:	BEQF	$0FDF
+0c38:	MOVB	ACCU, T2
+0c3a:	CMPUB	ACCU, #$0066
+0c3c:	BEQF	$0CC3
+0c3f:	MOVB	ACCU, T2
+0c41:	CMPUB	ACCU, #$0067
+0c43:	BEQ	$0CC3
+0c45:	MOVB	ACCU, T2
+0c47:	CMPUB	ACCU, #$0065
+0c49:	BEQ	$0CC3
+0c4b:	MOVB	ACCU, T2
+0c4d:	CMPUB	ACCU, #$0073
+0c4f:	BEQ	$0C91
+0c51:	MOVB	ACCU, T2
+0c53:	CMPUB	ACCU, #$0063
+0c55:	BEQ	$0C72
+0c57:	MOVB	ACCU, T2
+0c59:	BEQF	$0B98
+0c5c:	MOVB	ACCU, T0
+0c5e:	LEAX	ADDR, T3 + ACCU
+0c60:	MOVB	0(ADDR), T2
+0c63:	ADDB	T0, #$0001
+0c66:	MOV	ADDR, T1
+0c68:	MOVB	T5, 0(ADDR)
+0c6b:	ADD	T1, #$0001
+0c6f:	JUMPF	$0BB3
+0c72:	MOVB	ACCU, T0
+0c74:	MOV	ADDR, T4
+0c76:	MOV	T7, 0(ADDR)
+0c79:	LEAX	ADDR, T3 + ACCU
+0c7b:	MOVB	0(ADDR), T7
+0c7e:	ADD	T4, #$0002
+0c82:	ADDB	T0, #$0001
+0c85:	MOV	ADDR, T1
+0c87:	MOVB	T5, 0(ADDR)
+0c8a:	ADD	T1, #$0001
+0c8e:	JUMPF	$0BB3
+0c91:	MOV	ADDR, T4
+0c93:	MOV	T6, 0(ADDR)
+0c96:	ADD	T4, #$0002
+0c9a:	MOV	ADDR, T6
+0c9c:	MOVB	T2, 0(ADDR)
+0c9f:	MOVB	ACCU, T2
+0ca1:	BEQF	$0B98
+0ca4:	ADD	T6, #$0001
+0ca8:	MOV	ADDR, T3
+0caa:	MOVB	0(ADDR), T2
+0cad:	ADD	T3, #$0001
+0cb1:	MOV	ADDR, T6
+0cb3:	MOVB	T5, 0(ADDR)
+0cb6:	ADD	T6, #$0001
+0cba:	MOVB	ACCU, T5
+0cbc:	MOVB	T2, ACCU
+0cbe:	BNE	$0CA8
+0cc0:	JUMPF	$0B98
+0cc3:	MOV	ADDR, T4
+0cc5:	MOVD	T11, 0(ADDR)
+0cc8:	MOVB	ACCU, T2
+0cca:	MOVB	T0, ACCU
+0ccc:	MOV	ACCU, T3
+0cce:	MOV	T6, ACCU
+0cd0:	MOVD	ACCU, #$00000000
+0cd6:	CMPF	ACCU, T11
+0cd8:	BLTF	$0FCC
+0cdb:	MOVB	T2, #0
+0cde:	MOVUB	ACCU, 5(FP)
+0ce1:	BEQ	$0CEE
+0ce3:	MOV	ACCU, #43
+0ce6:	MOV	ADDR, T3
+0ce8:	MOVB	0(ADDR), ACCU
+0ceb:	MOVB	T2, #1
+0cee:	MOV	T7, #0
+0cf1:	MOVB	T5, 2(FP)
+0cf4:	MOVB	ACCU, T5
+0cf6:	CMPUB	ACCU, #$00FF
+0cf8:	BNE	$0CFF
+0cfa:	MOVB	T5, #6
+0cfd:	JUMP	$0D03
+0cff:	AND	T5, #$00FF
+0d03:	MOVD	ACCU, #$00000000
+0d09:	CMPF	ACCU, T11
+0d0b:	BNEF	$0F5C
+0d0e:	MOVB	ACCU, T0
+0d10:	CMPUB	ACCU, #$0065
+0d12:	SEQ
+0d13:	MOVB	T10, ACCU
+0d15:	MOVB	T13, ACCU
+0d17:	MOVB	ACCU, T5
+0d19:	MOV	T8, ACCU
+0d1b:	ADD	T8, #$0001
+0d1f:	MOVB	ACCU, T0
+0d21:	CMPUB	ACCU, #$0067
+0d23:	BEQF	$0F4B
+0d26:	MOVB	ACCU, T10
+0d28:	BNEF	$0F01
+0d2b:	MOV	ACCU, T7
+0d2d:	BGE	$0D43
+0d2f:	MOVD	ACCU, T11
+0d31:	MOVD	$03, #$41200000
+0d37:	DIVF	ACCU, $03
+0d39:	MOVD	T11, ACCU
+0d3b:	ADD	T7, #$0001
+0d3f:	MOV	ACCU, T7
+0d41:	BLT	$0D2F
+0d43:	MOVD	T12, #$3f000000
+0d49:	MOVB	ACCU, T5
+0d4b:	ADD	ACCU, T7
+0d4d:	MOV	T8, ACCU
+0d4f:	ADD	T8, #$0001
+0d53:	MOVB	ACCU, T8
+0d55:	CMPUB	ACCU, #$0001
+0d57:	BLTF	$0EE6
+0d5a:	MOVD	ACCU, T11
+0d5c:	ADDF	ACCU, T12
+0d5e:	MOVD	T11, ACCU
+0d60:	MOVD	T12, ACCU
+0d62:	MOVD	ACCU, #$41200000
+0d68:	CMPF	ACCU, T11
+0d6a:	BLT	$0D7B
+0d6c:	MOVD	ACCU, T11
+0d6e:	MOVD	$03, #$41200000
+0d74:	DIVF	ACCU, $03
+0d76:	MOVD	T12, ACCU
+0d78:	ADDB	T5, #$00FF
+0d7b:	MOVB	ACCU, T8
+0d7d:	MOV	T9, ACCU
+0d7f:	MOVB	ACCU, T5
+0d81:	NEG	ACCU
+0d82:	ADD	ACCU, T9
+0d84:	MOV	T9, ACCU
+0d86:	MOVB	T0, ACCU
+0d88:	MOVB	ACCU, T8
+0d8a:	CMPUB	ACCU, #$0014
+0d8c:	BGE	$0D91
+0d8e:	MOVB	T8, #20
+0d91:	MOVB	ACCU, T9
+0d93:	BNE	$0DA2
+0d95:	MOVB	ACCU, T2
+0d97:	LEAX	ADDR, T6 + ACCU
+0d99:	MOV	ACCU, #48
+0d9c:	MOVB	0(ADDR), ACCU
+0d9f:	ADDB	T2, #$0001
+0da2:	MOVB	T5, #0
+0da5:	MOVB	ACCU, T8
+0da7:	BNEF	$0EA2
+0daa:	MOVB	ACCU, T13
+0dac:	BNE	$0E25
+0dae:	MOVUB	ACCU, 1(FP)
+0db1:	CMPUB	ACCU, T2
+0db3:	BLT	$0DC9
+0db5:	MOVB	ACCU, T2
+0db7:	MOVB	T0, ACCU
+0db9:	ADD	T4, #$0004
+0dbd:	MOV	ADDR, T1
+0dbf:	MOVB	T5, 0(ADDR)
+0dc2:	ADD	T1, #$0001
+0dc6:	JUMPF	$0BB3
+0dc9:	MOVB	ACCU, T2
+0dcb:	CMPUB	ACCU, #$0001
+0dcd:	BLE	$0DFC
+0dcf:	MOVB	T0, #0
+0dd2:	MOVB	ACCU, T2
+0dd4:	MOV	T7, ACCU
+0dd6:	MOVUB	ACCU, 1(FP)
+0dd9:	MOV	T8, ACCU
+0ddb:	SUB	ACCU, T7
+0ddd:	MOV	T9, ACCU
+0ddf:	MOVB	ACCU, T0
+0de1:	MOV	T14, ACCU
+0de3:	MOV	ACCU, T9
+0de5:	CMPU	ACCU, T14
+0de7:	BLT	$0DED
+0de9:	MOV	ACCU, T8
+0deb:	JUMP	$0DB7
+0ded:	MOV	ACCU, T6
+0def:	LEAX	ADDR, T14 + ACCU
+0df1:	MOV	ACCU, #32
+0df4:	MOVB	0(ADDR), ACCU
+0df7:	ADDB	T0, #$0001
+0dfa:	JUMP	$0DD6
+0dfc:	MOVB	T0, #1
+0dff:	MOVB	ACCU, T2
+0e01:	MOV	T7, ACCU
+0e03:	MOVB	ACCU, T0
+0e05:	MOV	T8, ACCU
+0e07:	MOV	ACCU, T7
+0e09:	SUB	ACCU, T8
+0e0b:	LEAX	ADDR, T6 + ACCU
+0e0d:	MOVB	T5, 0(ADDR)
+0e10:	MOVUB	ACCU, 1(FP)
+0e13:	SUB	ACCU, T8
+0e15:	LEAX	ADDR, T6 + ACCU
+0e17:	MOVB	0(ADDR), T5
+0e1a:	ADDB	T0, #$0001
+0e1d:	MOVB	ACCU, T2
+0e1f:	CMPUB	ACCU, T0
+0e21:	BLE	$0E03
+0e23:	JUMP	$0DCF
+0e25:	MOVB	ACCU, T2
+0e27:	LEAX	ADDR, T6 + ACCU
+0e29:	MOV	ACCU, #69
+0e2c:	MOVB	0(ADDR), ACCU
+0e2f:	MOVB	ACCU, T2
+0e31:	ADDB	ACCU, #$0001
+0e34:	MOVB	T0, ACCU
+0e36:	MOV	ACCU, T7
+0e38:	BLT	$0E4D
+0e3a:	MOVB	ACCU, T0
+0e3c:	LEAX	ADDR, T6 + ACCU
+0e3e:	MOV	ACCU, #43
+0e41:	MOVB	0(ADDR), ACCU
+0e44:	MOVB	ACCU, T2
+0e46:	ADDB	ACCU, #$0002
+0e49:	MOVB	T0, ACCU
+0e4b:	JUMP	$0E63
+0e4d:	MOVB	ACCU, T0
+0e4f:	LEAX	ADDR, T6 + ACCU
+0e51:	MOV	ACCU, #45
+0e54:	MOVB	0(ADDR), ACCU
+0e57:	MOVB	ACCU, T2
+0e59:	ADDB	ACCU, #$0002
+0e5c:	MOVB	T0, ACCU
+0e5e:	MOV	ACCU, T7
+0e60:	NEG	ACCU
+0e61:	MOV	T7, ACCU
+0e63:	MOVB	ACCU, T0
+0e65:	ADD	ACCU, T6
+0e67:	MOV	T8, ACCU
+0e69:	MOV	ACCU, T7
+0e6b:	MOV	ADDR, #10
+0e6e:	DIVS	ACCU, ADDR
+0e70:	MOV	ADDR, T8
+0e72:	MOV	T9, ACCU
+0e74:	ADD	T9, #$0030
+0e78:	MOVB	0(ADDR), T9
+0e7b:	MOVB	ACCU, T0
+0e7d:	ADDB	ACCU, #$0001
+0e80:	MOVB	ACCU, ACCU
+0e82:	ADD	ACCU, T6
+0e84:	MOV	T8, ACCU
+0e86:	MOV	ACCU, T7
+0e88:	MOV	ADDR, #10
+0e8b:	MODS	ACCU, ADDR
+0e8d:	MOV	ADDR, T8
+0e8f:	MOV	T7, ACCU
+0e91:	ADD	T7, #$0030
+0e95:	MOVB	0(ADDR), T7
+0e98:	MOVB	ACCU, T0
+0e9a:	ADDB	ACCU, #$0002
+0e9d:	MOVB	T2, ACCU
+0e9f:	JUMPF	$0DAE
+0ea2:	MOVB	ACCU, T0
+0ea4:	CMPUB	ACCU, T5
+0ea6:	BNE	$0EB5
+0ea8:	MOVB	ACCU, T2
+0eaa:	LEAX	ADDR, T6 + ACCU
+0eac:	MOV	ACCU, #46
+0eaf:	MOVB	0(ADDR), ACCU
+0eb2:	ADDB	T2, #$0001
+0eb5:	MOVB	ACCU, T2
+0eb7:	LEAX	ADDR, T6 + ACCU
+0eb9:	MOVD	ACCU, T12
+0ebb:	CNVFS	ACCU
+0ebc:	MOV	T14, ACCU
+0ebe:	ADDB	ACCU, #$0030
+0ec1:	MOVB	0(ADDR), ACCU
+0ec4:	MOV	ACCU, T14
+0ec6:	CNVSF	ACCU
+0ec7:	MOVD	T11, ACCU
+0ec9:	MOVD	ACCU, T12
+0ecb:	SUBF	ACCU, T11
+0ecd:	MOVD	$03, #$41200000
+0ed3:	MULF	ACCU, $03
+0ed5:	MOVD	T12, ACCU
+0ed7:	ADDB	T2, #$0001
+0eda:	ADDB	T5, #$0001
+0edd:	MOVB	ACCU, T8
+0edf:	CMPUB	ACCU, T5
+0ee1:	BLT	$0EA2
+0ee3:	JUMPF	$0DAA
+0ee6:	MOVB	T0, #1
+0ee9:	MOVD	ACCU, T12
+0eeb:	MOVD	$03, #$41200000
+0ef1:	DIVF	ACCU, $03
+0ef3:	MOVD	T12, ACCU
+0ef5:	ADDB	T0, #$0001
+0ef8:	MOVB	ACCU, T8
+0efa:	CMPUB	ACCU, T0
+0efc:	BLT	$0EE9
+0efe:	JUMPF	$0D5A
+0f01:	MOVD	T12, #$3f000000
+0f07:	MOVB	ACCU, T5
+0f09:	BNE	$0F31
+0f0b:	MOVD	ACCU, T11
+0f0d:	ADDF	ACCU, T12
+0f0f:	MOVD	T11, ACCU
+0f11:	MOVD	T12, ACCU
+0f13:	MOVD	ACCU, #$41200000
+0f19:	CMPF	ACCU, T11
+0f1b:	BLTF	$0D7B
+0f1e:	MOVD	ACCU, T11
+0f20:	MOVD	$03, #$41200000
+0f26:	DIVF	ACCU, $03
+0f28:	MOVD	T12, ACCU
+0f2a:	ADD	T7, #$0001
+0f2e:	JUMPF	$0D7B
+0f31:	MOVB	T0, #0
+0f34:	MOVD	ACCU, T12
+0f36:	MOVD	$03, #$41200000
+0f3c:	DIVF	ACCU, $03
+0f3e:	MOVD	T12, ACCU
+0f40:	ADDB	T0, #$0001
+0f43:	MOVB	ACCU, T5
+0f45:	CMPUB	ACCU, T0
+0f47:	BLT	$0F34
+0f49:	JUMP	$0F0B
+0f4b:	MOV	ACCU, T7
+0f4d:	CMPS	ACCU, #$0003
+0f50:	BLT	$0F57
+0f52:	MOV	ACCU, T7
+0f54:	BGEF	$0D26
+0f57:	MOVB	T13, #1
+0f5a:	JUMP	$0F01
+0f5c:	MOVD	ACCU, #$447a0000
+0f62:	CMPF	ACCU, T11
+0f64:	BLT	$0F80
+0f66:	ADD	T7, #$0003
+0f6a:	MOVD	ACCU, T11
+0f6c:	MOVD	$03, #$447a0000
+0f72:	DIVF	ACCU, $03
+0f74:	MOVD	T11, ACCU
+0f76:	MOVD	ACCU, #$447a0000
+0f7c:	CMPF	ACCU, T11
+0f7e:	BGE	$0F66
+0f80:	MOVD	ACCU, #$3f800000
+0f86:	CMPF	ACCU, T11
+0f88:	BGE	$0FA4
+0f8a:	ADD	T7, #$FFFD
+0f8e:	MOVD	ACCU, T11
+0f90:	MOVD	$03, #$447a0000
+0f96:	MULF	ACCU, $03
+0f98:	MOVD	T11, ACCU
+0f9a:	MOVD	ACCU, #$3f800000
+0fa0:	CMPF	ACCU, T11
+0fa2:	BLT	$0F8A
+0fa4:	MOVD	ACCU, #$41200000
+0faa:	CMPF	ACCU, T11
+0fac:	BLTF	$0D0E
+0faf:	ADD	T7, #$0001
+0fb3:	MOVD	ACCU, T11
+0fb5:	MOVD	$03, #$41200000
+0fbb:	DIVF	ACCU, $03
+0fbd:	MOVD	T11, ACCU
+0fbf:	MOVD	ACCU, #$41200000
+0fc5:	CMPF	ACCU, T11
+0fc7:	BGE	$0FAF
+0fc9:	JUMPF	$0D0E
+0fcc:	MOV	ACCU, #45
+0fcf:	MOV	ADDR, T3
+0fd1:	MOVB	0(ADDR), ACCU
+0fd4:	MOVB	T2, #1
+0fd7:	MOVD	ACCU, T11
+0fd9:	NEGF	ACCU
+0fda:	MOVD	T11, ACCU
+0fdc:	JUMPF	$0CEE
+0fdf:	MOV	ADDR, T4
+0fe1:	MOVD	T11, 0(ADDR)
+0fe4:	ADD	T4, #$0004
+0fe8:	MOV	ADDR, T1
+0fea:	MOVB	T2, 0(ADDR)
+0fed:	ADD	T1, #$0001
+0ff1:	MOVB	ACCU, T2
+0ff3:	CMPUB	ACCU, #$0064
+0ff5:	BEQF	$1250
+0ff8:	MOVB	ACCU, T2
+0ffa:	CMPUB	ACCU, #$0075
+0ffc:	BEQF	$1134
+0fff:	MOVB	ACCU, T2
+1001:	CMPUB	ACCU, #$0078
+1003:	BNEF	$0B98
+1006:	MOV	ACCU, #16
+1009:	MOV	3(FP), ACCU
+100c:	MOV	ACCU, T3
+100e:	MOV	T6, ACCU
+1010:	MOVB	T0, #16
+1013:	MOVD	ACCU, #$00000000
+1019:	EXTRT	T11, inp_op_cmp_u32 + 0
+101d:	BGTF	$10E4
+1020:	MOVB	T2, 2(FP)
+1023:	MOVB	ACCU, T2
+1025:	CMPUB	ACCU, #$00FF
+1027:	BNEF	$10D4
+102a:	MOVB	T2, #15
+102d:	MOVB	ACCU, T0
+102f:	CMPUB	ACCU, #$000F
+1031:	BGE	$1046
+1033:	ADDB	T0, #$00FF
+1036:	MOVB	ACCU, T0
+1038:	LEAX	ADDR, T6 + ACCU
+103a:	MOV	ACCU, #48
+103d:	MOVB	0(ADDR), ACCU
+1040:	MOVB	ACCU, T2
+1042:	CMPUB	ACCU, T0
+1044:	BGT	$1033
+1046:	MOVUB	ACCU, 7(FP)
+1049:	BEQ	$106F
+104b:	MOV	ACCU, 3(FP)
+104e:	CMPU	ACCU, #$0010
+1051:	BNE	$106F
+1053:	MOVB	ACCU, T0
+1055:	ADDB	ACCU, #$00FF
+1058:	MOVB	ACCU, ACCU
+105a:	LEAX	ADDR, T6 + ACCU
+105c:	MOV	ACCU, #88
+105f:	MOVB	0(ADDR), ACCU
+1062:	ADDB	T0, #$00FE
+1065:	MOVB	ACCU, T0
+1067:	LEAX	ADDR, T6 + ACCU
+1069:	MOV	ACCU, #48
+106c:	MOVB	0(ADDR), ACCU
+106f:	MOVUB	ACCU, 5(FP)
+1072:	BEQ	$1081
+1074:	ADDB	T0, #$00FF
+1077:	MOVB	ACCU, T0
+1079:	LEAX	ADDR, T6 + ACCU
+107b:	MOV	ACCU, #43
+107e:	MOVB	0(ADDR), ACCU
+1081:	MOVUB	T7, 1(FP)
+1084:	SUBR	T7, #$0010
+1088:	MOVB	ACCU, T0
+108a:	MOV	T8, ACCU
+108c:	MOV	ACCU, T7
+108e:	CMPS	ACCU, T8
+1090:	BGT	$10C5
+1092:	MOVB	T2, #0
+1095:	MOVB	ACCU, T0
+1097:	CMPUB	ACCU, #$0010
+1099:	BLE	$10B5
+109b:	MOVB	ACCU, T0
+109d:	LEAX	ADDR, T6 + ACCU
+109f:	MOVB	T5, 0(ADDR)
+10a2:	MOVB	ACCU, T2
+10a4:	LEAX	ADDR, T6 + ACCU
+10a6:	MOVB	0(ADDR), T5
+10a9:	ADDB	T2, #$0001
+10ac:	ADDB	T0, #$0001
+10af:	MOVB	ACCU, T0
+10b1:	CMPUB	ACCU, #$0010
+10b3:	BGT	$109B
+10b5:	MOV	ADDR, T1
+10b7:	MOVB	T5, 0(ADDR)
+10ba:	ADD	T1, #$0001
+10be:	MOVB	ACCU, T2
+10c0:	MOV	T0, ACCU
+10c2:	JUMPF	$0BB3
+10c5:	ADDB	T0, #$00FF
+10c8:	MOVB	ACCU, T0
+10ca:	LEAX	ADDR, T6 + ACCU
+10cc:	MOVB	T2, 0(FP)
+10cf:	MOVB	0(ADDR), T2
+10d2:	JUMP	$1081
+10d4:	MOVB	ACCU, T2
+10d6:	SUBR	ACCU, #$0010
+10da:	MOV	T2, ACCU
+10dc:	CMPUB	ACCU, T0
+10de:	BGTF	$1033
+10e1:	JUMPF	$1046
+10e4:	MOV	ACCU, 3(FP)
+10e7:	EXTRT	$00, inp_op_ext_u16 + 0
+10eb:	MOVD	T12, ACCU
+10ed:	MOVD	ACCU, T11
+10ef:	EXTRT	T12, inp_binop_mod_u32 + 0
+10f3:	MOVD	T12, ACCU
+10f5:	CMPS	ACCU, #$000A
+10f8:	BLE	$1102
+10fa:	MOV	ACCU, T12
+10fc:	ADD	ACCU, #$0030
+1100:	JUMP	$1108
+1102:	MOV	ACCU, T12
+1104:	ADD	ACCU, #$0037
+1108:	MOV	T7, ACCU
+110a:	ADDB	T0, #$00FF
+110d:	MOVB	ACCU, T0
+110f:	LEAX	ADDR, T6 + ACCU
+1111:	MOVB	0(ADDR), T7
+1114:	MOV	ACCU, 3(FP)
+1117:	EXTRT	$00, inp_op_ext_u16 + 0
+111b:	MOVD	T12, ACCU
+111d:	MOVD	ACCU, T11
+111f:	EXTRT	T12, inp_binop_div_u32 + 0
+1123:	MOVD	T11, ACCU
+1125:	MOVD	ACCU, #$00000000
+112b:	EXTRT	T11, inp_op_cmp_u32 + 0
+112f:	BGT	$10E4
+1131:	JUMPF	$1020
+1134:	MOV	ACCU, T3
+1136:	MOV	T6, ACCU
+1138:	MOVB	T0, #16
+113b:	MOVD	ACCU, #$00000000
+1141:	EXTRT	T11, inp_op_cmp_u32 + 0
+1145:	BGTF	$1200
+1148:	MOVB	T2, 2(FP)
+114b:	MOVB	ACCU, T2
+114d:	CMPUB	ACCU, #$00FF
+114f:	BNEF	$11F0
+1152:	MOVB	T2, #15
+1155:	MOVB	ACCU, T0
+1157:	CMPUB	ACCU, #$000F
+1159:	BGE	$116E
+115b:	ADDB	T0, #$00FF
+115e:	MOVB	ACCU, T0
+1160:	LEAX	ADDR, T6 + ACCU
+1162:	MOV	ACCU, #48
+1165:	MOVB	0(ADDR), ACCU
+1168:	MOVB	ACCU, T2
+116a:	CMPUB	ACCU, T0
+116c:	BGT	$115B
+116e:	MOVUB	ACCU, 7(FP)
+1171:	BEQ	$1197
+1173:	MOV	ACCU, 3(FP)
+1176:	CMPU	ACCU, #$0010
+1179:	BNE	$1197
+117b:	MOVB	ACCU, T0
+117d:	ADDB	ACCU, #$00FF
+1180:	MOVB	ACCU, ACCU
+1182:	LEAX	ADDR, T6 + ACCU
+1184:	MOV	ACCU, #88
+1187:	MOVB	0(ADDR), ACCU
+118a:	ADDB	T0, #$00FE
+118d:	MOVB	ACCU, T0
+118f:	LEAX	ADDR, T6 + ACCU
+1191:	MOV	ACCU, #48
+1194:	MOVB	0(ADDR), ACCU
+1197:	MOVUB	ACCU, 5(FP)
+119a:	BEQ	$11A9
+119c:	ADDB	T0, #$00FF
+119f:	MOVB	ACCU, T0
+11a1:	LEAX	ADDR, T6 + ACCU
+11a3:	MOV	ACCU, #43
+11a6:	MOVB	0(ADDR), ACCU
+11a9:	MOVUB	T7, 1(FP)
+11ac:	SUBR	T7, #$0010
+11b0:	MOVB	ACCU, T0
+11b2:	MOV	T8, ACCU
+11b4:	MOV	ACCU, T7
+11b6:	CMPS	ACCU, T8
+11b8:	BGT	$11E1
+11ba:	MOVB	T2, #0
+11bd:	MOVB	ACCU, T0
+11bf:	CMPUB	ACCU, #$0010
+11c1:	BLEF	$10B5
+11c4:	MOVB	ACCU, T0
+11c6:	LEAX	ADDR, T6 + ACCU
+11c8:	MOVB	T5, 0(ADDR)
+11cb:	MOVB	ACCU, T2
+11cd:	LEAX	ADDR, T6 + ACCU
+11cf:	MOVB	0(ADDR), T5
+11d2:	ADDB	T2, #$0001
+11d5:	ADDB	T0, #$0001
+11d8:	MOVB	ACCU, T0
+11da:	CMPUB	ACCU, #$0010
+11dc:	BGT	$11C4
+11de:	JUMPF	$10B5
+11e1:	ADDB	T0, #$00FF
+11e4:	MOVB	ACCU, T0
+11e6:	LEAX	ADDR, T6 + ACCU
+11e8:	MOVB	T2, 0(FP)
+11eb:	MOVB	0(ADDR), T2
+11ee:	JUMP	$11A9
+11f0:	MOVB	ACCU, T2
+11f2:	SUBR	ACCU, #$0010
+11f6:	MOV	T2, ACCU
+11f8:	CMPUB	ACCU, T0
+11fa:	BGTF	$115B
+11fd:	JUMPF	$116E
+1200:	MOV	ACCU, 3(FP)
+1203:	EXTRT	$00, inp_op_ext_u16 + 0
+1207:	MOVD	T12, ACCU
+1209:	MOVD	ACCU, T11
+120b:	EXTRT	T12, inp_binop_mod_u32 + 0
+120f:	MOVD	T12, ACCU
+1211:	CMPS	ACCU, #$000A
+1214:	BLE	$121E
+1216:	MOV	ACCU, T12
+1218:	ADD	ACCU, #$0030
+121c:	JUMP	$1224
+121e:	MOV	ACCU, T12
+1220:	ADD	ACCU, #$0037
+1224:	MOV	T7, ACCU
+1226:	ADDB	T0, #$00FF
+1229:	MOVB	ACCU, T0
+122b:	LEAX	ADDR, T6 + ACCU
+122d:	MOVB	0(ADDR), T7
+1230:	MOV	ACCU, 3(FP)
+1233:	EXTRT	$00, inp_op_ext_u16 + 0
+1237:	MOVD	T12, ACCU
+1239:	MOVD	ACCU, T11
+123b:	EXTRT	T12, inp_binop_div_u32 + 0
+123f:	MOVD	T11, ACCU
+1241:	MOVD	ACCU, #$00000000
+1247:	EXTRT	T11, inp_op_cmp_u32 + 0
+124b:	BGT	$1200
+124d:	JUMPF	$1148
+1250:	MOV	ACCU, T3
+1252:	MOV	T6, ACCU
+1254:	MOVD	ACCU, #$00000000
+125a:	EXTRT	T11, inp_op_cmp_s32 + 0
+125e:	BLTF	$139F
+1261:	MOVD	ACCU, T11
+1263:	MOVD	T12, ACCU
+1265:	MOVB	T0, #0
+1268:	MOVB	T2, #16
+126b:	MOVD	ACCU, #$00000000
+1271:	EXTRT	T11, inp_op_cmp_u32 + 0
+1275:	BGTF	$134F
+1278:	MOVB	T5, 2(FP)
+127b:	MOVB	ACCU, T5
+127d:	CMPUB	ACCU, #$00FF
+127f:	BNEF	$133F
+1282:	MOVB	T5, #15
+1285:	MOVB	ACCU, T2
+1287:	CMPUB	ACCU, #$000F
+1289:	BGE	$129E
+128b:	ADDB	T2, #$00FF
+128e:	MOVB	ACCU, T2
+1290:	LEAX	ADDR, T6 + ACCU
+1292:	MOV	ACCU, #48
+1295:	MOVB	0(ADDR), ACCU
+1298:	MOVB	ACCU, T5
+129a:	CMPUB	ACCU, T2
+129c:	BGT	$128B
+129e:	MOVUB	ACCU, 7(FP)
+12a1:	BEQ	$12C7
+12a3:	MOV	ACCU, 3(FP)
+12a6:	CMPU	ACCU, #$0010
+12a9:	BNE	$12C7
+12ab:	MOVB	ACCU, T2
+12ad:	ADDB	ACCU, #$00FF
+12b0:	MOVB	ACCU, ACCU
+12b2:	LEAX	ADDR, T6 + ACCU
+12b4:	MOV	ACCU, #88
+12b7:	MOVB	0(ADDR), ACCU
+12ba:	ADDB	T2, #$00FE
+12bd:	MOVB	ACCU, T2
+12bf:	LEAX	ADDR, T6 + ACCU
+12c1:	MOV	ACCU, #48
+12c4:	MOVB	0(ADDR), ACCU
+12c7:	MOVB	ACCU, T0
+12c9:	BNE	$1330
+12cb:	MOVUB	ACCU, 5(FP)
+12ce:	BEQ	$12DD
+12d0:	ADDB	T2, #$00FF
+12d3:	MOVB	ACCU, T2
+12d5:	LEAX	ADDR, T6 + ACCU
+12d7:	MOV	ACCU, #43
+12da:	MOVB	0(ADDR), ACCU
+12dd:	MOVUB	T7, 1(FP)
+12e0:	SUBR	T7, #$0010
+12e4:	MOVB	ACCU, T2
+12e6:	MOV	T8, ACCU
+12e8:	MOV	ACCU, T7
+12ea:	CMPS	ACCU, T8
+12ec:	BGT	$1321
+12ee:	MOVB	T0, #0
+12f1:	MOVB	ACCU, T2
+12f3:	CMPUB	ACCU, #$0010
+12f5:	BLE	$1311
+12f7:	MOVB	ACCU, T2
+12f9:	LEAX	ADDR, T6 + ACCU
+12fb:	MOVB	T5, 0(ADDR)
+12fe:	MOVB	ACCU, T0
+1300:	LEAX	ADDR, T6 + ACCU
+1302:	MOVB	0(ADDR), T5
+1305:	ADDB	T0, #$0001
+1308:	ADDB	T2, #$0001
+130b:	MOVB	ACCU, T2
+130d:	CMPUB	ACCU, #$0010
+130f:	BGT	$12F7
+1311:	MOV	ADDR, T1
+1313:	MOVB	T5, 0(ADDR)
+1316:	ADD	T1, #$0001
+131a:	AND	T0, #$00FF
+131e:	JUMPF	$0BB3
+1321:	ADDB	T2, #$00FF
+1324:	MOVB	ACCU, T2
+1326:	LEAX	ADDR, T6 + ACCU
+1328:	MOVB	T0, 0(FP)
+132b:	MOVB	0(ADDR), T0
+132e:	JUMP	$12DD
+1330:	ADDB	T2, #$00FF
+1333:	MOVB	ACCU, T2
+1335:	LEAX	ADDR, T6 + ACCU
+1337:	MOV	ACCU, #45
+133a:	MOVB	0(ADDR), ACCU
+133d:	JUMP	$12DD
+133f:	MOVB	ACCU, T5
+1341:	SUBR	ACCU, #$0010
+1345:	MOV	T5, ACCU
+1347:	CMPUB	ACCU, T2
+1349:	BGTF	$128B
+134c:	JUMPF	$129E
+134f:	MOV	ACCU, 3(FP)
+1352:	EXTRT	$00, inp_op_ext_u16 + 0
+1356:	MOVD	T11, ACCU
+1358:	MOVD	ACCU, T12
+135a:	EXTRT	T11, inp_binop_mod_u32 + 0
+135e:	MOVD	T11, ACCU
+1360:	CMPS	ACCU, #$000A
+1363:	BLE	$136D
+1365:	MOV	ACCU, T11
+1367:	ADD	ACCU, #$0030
+136b:	JUMP	$1373
+136d:	MOV	ACCU, T11
+136f:	ADD	ACCU, #$0037
+1373:	MOV	T7, ACCU
+1375:	ADDB	T2, #$00FF
+1378:	MOVB	ACCU, T2
+137a:	LEAX	ADDR, T6 + ACCU
+137c:	MOVB	0(ADDR), T7
+137f:	MOV	ACCU, 3(FP)
+1382:	EXTRT	$00, inp_op_ext_u16 + 0
+1386:	MOVD	T11, ACCU
+1388:	MOVD	ACCU, T12
+138a:	EXTRT	T11, inp_binop_div_u32 + 0
+138e:	MOVD	T12, ACCU
+1390:	MOVD	ACCU, #$00000000
+1396:	EXTRT	T12, inp_op_cmp_u32 + 0
+139a:	BGT	$134F
+139c:	JUMPF	$1278
+139f:	MOVB	T0, #1
+13a2:	MOVB	T2, #16
+13a5:	MOVD	ACCU, T11
+13a7:	EXTRT	$00, negaccu32 + 0
+13ab:	MOVD	T12, ACCU
+13ad:	MOVD	ACCU, #$00000000
+13b3:	EXTRT	T12, inp_op_cmp_u32 + 0
+13b7:	BGT	$134F
+13b9:	JUMPF	$1278
+13bc:	MOV	ACCU, #16
+13bf:	MOV	3(FP), ACCU
+13c2:	MOV	ACCU, T3
+13c4:	MOV	T6, ACCU
+13c6:	MOV	ADDR, T4
+13c8:	MOV	T7, 0(ADDR)
+13cb:	ADD	T4, #$0002
+13cf:	MOVB	T0, #10
+13d2:	MOV	ACCU, T7
+13d4:	BNEF	$148F
+13d7:	MOVB	T2, 2(FP)
+13da:	MOVB	ACCU, T2
+13dc:	CMPUB	ACCU, #$00FF
+13de:	BNEF	$147F
+13e1:	MOVB	T2, #9
+13e4:	MOVB	ACCU, T0
+13e6:	CMPUB	ACCU, #$0009
+13e8:	BGE	$13FD
+13ea:	ADDB	T0, #$00FF
+13ed:	MOVB	ACCU, T0
+13ef:	LEAX	ADDR, T6 + ACCU
+13f1:	MOV	ACCU, #48
+13f4:	MOVB	0(ADDR), ACCU
+13f7:	MOVB	ACCU, T2
+13f9:	CMPUB	ACCU, T0
+13fb:	BGT	$13EA
+13fd:	MOVUB	ACCU, 7(FP)
+1400:	BEQ	$1426
+1402:	MOV	ACCU, 3(FP)
+1405:	CMPU	ACCU, #$0010
+1408:	BNE	$1426
+140a:	MOVB	ACCU, T0
+140c:	ADDB	ACCU, #$00FF
+140f:	MOVB	ACCU, ACCU
+1411:	LEAX	ADDR, T6 + ACCU
+1413:	MOV	ACCU, #88
+1416:	MOVB	0(ADDR), ACCU
+1419:	ADDB	T0, #$00FE
+141c:	MOVB	ACCU, T0
+141e:	LEAX	ADDR, T6 + ACCU
+1420:	MOV	ACCU, #48
+1423:	MOVB	0(ADDR), ACCU
+1426:	MOVUB	ACCU, 5(FP)
+1429:	BEQ	$1438
+142b:	ADDB	T0, #$00FF
+142e:	MOVB	ACCU, T0
+1430:	LEAX	ADDR, T6 + ACCU
+1432:	MOV	ACCU, #43
+1435:	MOVB	0(ADDR), ACCU
+1438:	MOVUB	T7, 1(FP)
+143b:	SUBR	T7, #$000A
+143f:	MOVB	ACCU, T0
+1441:	MOV	T8, ACCU
+1443:	MOV	ACCU, T7
+1445:	CMPS	ACCU, T8
+1447:	BGT	$1470
+1449:	MOVB	T2, #0
+144c:	MOVB	ACCU, T0
+144e:	CMPUB	ACCU, #$000A
+1450:	BLEF	$10B5
+1453:	MOVB	ACCU, T0
+1455:	LEAX	ADDR, T6 + ACCU
+1457:	MOVB	T5, 0(ADDR)
+145a:	MOVB	ACCU, T2
+145c:	LEAX	ADDR, T6 + ACCU
+145e:	MOVB	0(ADDR), T5
+1461:	ADDB	T2, #$0001
+1464:	ADDB	T0, #$0001
+1467:	MOVB	ACCU, T0
+1469:	CMPUB	ACCU, #$000A
+146b:	BGT	$1453
+146d:	JUMPF	$10B5
+1470:	ADDB	T0, #$00FF
+1473:	MOVB	ACCU, T0
+1475:	LEAX	ADDR, T6 + ACCU
+1477:	MOVB	T2, 0(FP)
+147a:	MOVB	0(ADDR), T2
+147d:	JUMP	$1438
+147f:	MOVB	ACCU, T2
+1481:	SUBR	ACCU, #$000A
+1485:	MOV	T2, ACCU
+1487:	CMPUB	ACCU, T0
+1489:	BGTF	$13EA
+148c:	JUMPF	$13FD
+148f:	MOV	T8, 3(FP)
+1492:	MOV	ACCU, T7
+1494:	MODU	ACCU, T8
+1496:	MOV	T8, ACCU
+1498:	CMPS	ACCU, #$000A
+149b:	BLE	$14A3
+149d:	ADD	T8, #$0030
+14a1:	JUMP	$14A7
+14a3:	ADD	T8, #$0037
+14a7:	ADDB	T0, #$00FF
+14aa:	MOVB	ACCU, T0
+14ac:	LEAX	ADDR, T6 + ACCU
+14ae:	MOVB	0(ADDR), T8
+14b1:	MOV	T8, 3(FP)
+14b4:	MOV	ACCU, T7
+14b6:	DIVU	ACCU, T8
+14b8:	MOV	T7, ACCU
+14ba:	BNE	$148F
+14bc:	JUMPF	$13D7
+14bf:	MOV	ACCU, T3
+14c1:	MOV	T6, ACCU
+14c3:	MOV	ADDR, T4
+14c5:	MOV	T7, 0(ADDR)
+14c8:	ADD	T4, #$0002
+14cc:	MOVB	T0, #10
+14cf:	MOV	ACCU, T7
+14d1:	BNEF	$158C
+14d4:	MOVB	T2, 2(FP)
+14d7:	MOVB	ACCU, T2
+14d9:	CMPUB	ACCU, #$00FF
+14db:	BNEF	$157C
+14de:	MOVB	T2, #9
+14e1:	MOVB	ACCU, T0
+14e3:	CMPUB	ACCU, #$0009
+14e5:	BGE	$14FA
+14e7:	ADDB	T0, #$00FF
+14ea:	MOVB	ACCU, T0
+14ec:	LEAX	ADDR, T6 + ACCU
+14ee:	MOV	ACCU, #48
+14f1:	MOVB	0(ADDR), ACCU
+14f4:	MOVB	ACCU, T2
+14f6:	CMPUB	ACCU, T0
+14f8:	BGT	$14E7
+14fa:	MOVUB	ACCU, 7(FP)
+14fd:	BEQ	$1523
+14ff:	MOV	ACCU, 3(FP)
+1502:	CMPU	ACCU, #$0010
+1505:	BNE	$1523
+1507:	MOVB	ACCU, T0
+1509:	ADDB	ACCU, #$00FF
+150c:	MOVB	ACCU, ACCU
+150e:	LEAX	ADDR, T6 + ACCU
+1510:	MOV	ACCU, #88
+1513:	MOVB	0(ADDR), ACCU
+1516:	ADDB	T0, #$00FE
+1519:	MOVB	ACCU, T0
+151b:	LEAX	ADDR, T6 + ACCU
+151d:	MOV	ACCU, #48
+1520:	MOVB	0(ADDR), ACCU
+1523:	MOVUB	ACCU, 5(FP)
+1526:	BEQ	$1535
+1528:	ADDB	T0, #$00FF
+152b:	MOVB	ACCU, T0
+152d:	LEAX	ADDR, T6 + ACCU
+152f:	MOV	ACCU, #43
+1532:	MOVB	0(ADDR), ACCU
+1535:	MOVUB	T7, 1(FP)
+1538:	SUBR	T7, #$000A
+153c:	MOVB	ACCU, T0
+153e:	MOV	T8, ACCU
+1540:	MOV	ACCU, T7
+1542:	CMPS	ACCU, T8
+1544:	BGT	$156D
+1546:	MOVB	T2, #0
+1549:	MOVB	ACCU, T0
+154b:	CMPUB	ACCU, #$000A
+154d:	BLEF	$10B5
+1550:	MOVB	ACCU, T0
+1552:	LEAX	ADDR, T6 + ACCU
+1554:	MOVB	T5, 0(ADDR)
+1557:	MOVB	ACCU, T2
+1559:	LEAX	ADDR, T6 + ACCU
+155b:	MOVB	0(ADDR), T5
+155e:	ADDB	T2, #$0001
+1561:	ADDB	T0, #$0001
+1564:	MOVB	ACCU, T0
+1566:	CMPUB	ACCU, #$000A
+1568:	BGT	$1550
+156a:	JUMPF	$10B5
+156d:	ADDB	T0, #$00FF
+1570:	MOVB	ACCU, T0
+1572:	LEAX	ADDR, T6 + ACCU
+1574:	MOVB	T2, 0(FP)
+1577:	MOVB	0(ADDR), T2
+157a:	JUMP	$1535
+157c:	MOVB	ACCU, T2
+157e:	SUBR	ACCU, #$000A
+1582:	MOV	T2, ACCU
+1584:	CMPUB	ACCU, T0
+1586:	BGTF	$14E7
+1589:	JUMPF	$14FA
+158c:	MOV	T8, 3(FP)
+158f:	MOV	ACCU, T7
+1591:	MODU	ACCU, T8
+1593:	MOV	T8, ACCU
+1595:	CMPS	ACCU, #$000A
+1598:	BLE	$15A0
+159a:	ADD	T8, #$0030
+159e:	JUMP	$15A4
+15a0:	ADD	T8, #$0037
+15a4:	ADDB	T0, #$00FF
+15a7:	MOVB	ACCU, T0
+15a9:	LEAX	ADDR, T6 + ACCU
+15ab:	MOVB	0(ADDR), T8
+15ae:	MOV	T8, 3(FP)
+15b1:	MOV	ACCU, T7
+15b3:	DIVU	ACCU, T8
+15b5:	MOV	T7, ACCU
+15b7:	BNE	$158C
+15b9:	JUMPF	$14D4
+15bc:	MOV	ACCU, T3
+15be:	MOV	T6, ACCU
+15c0:	MOV	ADDR, T4
+15c2:	MOV	T7, 0(ADDR)
+15c5:	ADD	T4, #$0002
+15c9:	MOV	ACCU, T7
+15cb:	BLTF	$16D6
+15ce:	MOV	T8, ACCU
+15d0:	MOVB	T0, #0
+15d3:	MOVB	T2, #10
+15d6:	MOV	ACCU, T7
+15d8:	BNEF	$16A6
+15db:	MOVB	T5, 2(FP)
+15de:	MOVB	ACCU, T5
+15e0:	CMPUB	ACCU, #$00FF
+15e2:	BNEF	$1696
+15e5:	MOVB	T5, #9
+15e8:	MOVB	ACCU, T2
+15ea:	CMPUB	ACCU, #$0009
+15ec:	BGE	$1601
+15ee:	ADDB	T2, #$00FF
+15f1:	MOVB	ACCU, T2
+15f3:	LEAX	ADDR, T6 + ACCU
+15f5:	MOV	ACCU, #48
+15f8:	MOVB	0(ADDR), ACCU
+15fb:	MOVB	ACCU, T5
+15fd:	CMPUB	ACCU, T2
+15ff:	BGT	$15EE
+1601:	MOVUB	ACCU, 7(FP)
+1604:	BEQ	$162A
+1606:	MOV	ACCU, 3(FP)
+1609:	CMPU	ACCU, #$0010
+160c:	BNE	$162A
+160e:	MOVB	ACCU, T2
+1610:	ADDB	ACCU, #$00FF
+1613:	MOVB	ACCU, ACCU
+1615:	LEAX	ADDR, T6 + ACCU
+1617:	MOV	ACCU, #88
+161a:	MOVB	0(ADDR), ACCU
+161d:	ADDB	T2, #$00FE
+1620:	MOVB	ACCU, T2
+1622:	LEAX	ADDR, T6 + ACCU
+1624:	MOV	ACCU, #48
+1627:	MOVB	0(ADDR), ACCU
+162a:	MOVB	ACCU, T0
+162c:	BNE	$1687
+162e:	MOVUB	ACCU, 5(FP)
+1631:	BEQ	$1640
+1633:	ADDB	T2, #$00FF
+1636:	MOVB	ACCU, T2
+1638:	LEAX	ADDR, T6 + ACCU
+163a:	MOV	ACCU, #43
+163d:	MOVB	0(ADDR), ACCU
+1640:	MOVUB	T7, 1(FP)
+1643:	SUBR	T7, #$000A
+1647:	MOVB	ACCU, T2
+1649:	MOV	T8, ACCU
+164b:	MOV	ACCU, T7
+164d:	CMPS	ACCU, T8
+164f:	BGT	$1678
+1651:	MOVB	T0, #0
+1654:	MOVB	ACCU, T2
+1656:	CMPUB	ACCU, #$000A
+1658:	BLEF	$1311
+165b:	MOVB	ACCU, T2
+165d:	LEAX	ADDR, T6 + ACCU
+165f:	MOVB	T5, 0(ADDR)
+1662:	MOVB	ACCU, T0
+1664:	LEAX	ADDR, T6 + ACCU
+1666:	MOVB	0(ADDR), T5
+1669:	ADDB	T0, #$0001
+166c:	ADDB	T2, #$0001
+166f:	MOVB	ACCU, T2
+1671:	CMPUB	ACCU, #$000A
+1673:	BGT	$165B
+1675:	JUMPF	$1311
+1678:	ADDB	T2, #$00FF
+167b:	MOVB	ACCU, T2
+167d:	LEAX	ADDR, T6 + ACCU
+167f:	MOVB	T0, 0(FP)
+1682:	MOVB	0(ADDR), T0
+1685:	JUMP	$1640
+1687:	ADDB	T2, #$00FF
+168a:	MOVB	ACCU, T2
+168c:	LEAX	ADDR, T6 + ACCU
+168e:	MOV	ACCU, #45
+1691:	MOVB	0(ADDR), ACCU
+1694:	JUMP	$1640
+1696:	MOVB	ACCU, T5
+1698:	SUBR	ACCU, #$000A
+169c:	MOV	T5, ACCU
+169e:	CMPUB	ACCU, T2
+16a0:	BGTF	$15EE
+16a3:	JUMPF	$1601
+16a6:	MOV	T7, 3(FP)
+16a9:	MOV	ACCU, T8
+16ab:	MODU	ACCU, T7
+16ad:	MOV	T7, ACCU
+16af:	CMPS	ACCU, #$000A
+16b2:	BLE	$16BA
+16b4:	ADD	T7, #$0030
+16b8:	JUMP	$16BE
+16ba:	ADD	T7, #$0037
+16be:	ADDB	T2, #$00FF
+16c1:	MOVB	ACCU, T2
+16c3:	LEAX	ADDR, T6 + ACCU
+16c5:	MOVB	0(ADDR), T7
+16c8:	MOV	T7, 3(FP)
+16cb:	MOV	ACCU, T8
+16cd:	DIVU	ACCU, T7
+16cf:	MOV	T8, ACCU
+16d1:	BNE	$16A6
+16d3:	JUMPF	$15DB
+16d6:	MOVB	T0, #1
+16d9:	MOVB	T2, #10
+16dc:	NEG	ACCU
+16dd:	MOV	T8, ACCU
+16df:	BNE	$16A6
+16e1:	JUMPF	$15DB
+16e4:	MOV	T6, #0
+16e7:	MOV	ADDR, T1
+16e9:	MOVB	T2, 0(ADDR)
+16ec:	ADD	T1, #$0001
+16f0:	MOVB	ACCU, T2
+16f2:	CMPUB	ACCU, #$0030
+16f4:	BGT	$1718
+16f6:	MOVB	ACCU, T2
+16f8:	CMPUB	ACCU, #$0039
+16fa:	BLT	$1718
+16fc:	MOVB	ACCU, T2
+16fe:	MOV	T7, ACCU
+1700:	MOV	ADDR, T1
+1702:	MOVB	T2, 0(ADDR)
+1705:	ADD	T1, #$0001
+1709:	MUL	T6, #10
+170c:	ADD	T6, ACCU
+170e:	ADD	T6, #$FFD0
+1712:	MOVB	ACCU, T2
+1714:	CMPUB	ACCU, #$0030
+1716:	BLE	$16F6
+1718:	MOVB	2(FP), T6
+171b:	JUMPF	$0C1C
+171e:	MOV	T6, #0
+1721:	MOVB	ACCU, T2
+1723:	CMPUB	ACCU, #$0030
+1725:	BGT	$1749
+1727:	MOVB	ACCU, T2
+1729:	CMPUB	ACCU, #$0039
+172b:	BLT	$1749
+172d:	MOVB	ACCU, T2
+172f:	MOV	T7, ACCU
+1731:	MOV	ADDR, T1
+1733:	MOVB	T2, 0(ADDR)
+1736:	ADD	T1, #$0001
+173a:	MUL	T6, #10
+173d:	ADD	T6, ACCU
+173f:	ADD	T6, #$FFD0
+1743:	MOVB	ACCU, T2
+1745:	CMPUB	ACCU, #$0030
+1747:	BLE	$1727
+1749:	MOVB	1(FP), T6
+174c:	JUMPF	$0C15
+174f:	MOV	ACCU, #1
+1752:	MOVB	7(FP), ACCU
+1755:	MOV	ADDR, T1
+1757:	MOVB	T2, 0(ADDR)
+175a:	JUMPF	$0BEF
+175d:	MOV	ACCU, #48
+1760:	MOVB	0(FP), ACCU
+1763:	MOV	ADDR, T1
+1765:	MOVB	T2, 0(ADDR)
+1768:	JUMPF	$0BEF
+176b:	MOV	ACCU, #1
+176e:	MOVB	5(FP), ACCU
+1771:	MOV	ADDR, T1
+1773:	MOVB	T2, 0(ADDR)
+1776:	JUMPF	$0BEF
+--------------------------------------------------------------------
+strcmp:
+17a8 : ea __ __ NOP
+17a9 : a0 00 __ LDY #$00
+17ab : 84 1c __ STY ACCU + 1
+17ad : b1 0d __ LDA (P0),y
+17af : f0 16 __ BEQ $17c7
+17b1 : d1 0f __ CMP (P2),y
+17b3 : d0 16 __ BNE $17cb
+17b5 : c8 __ __ INY
+17b6 : b1 0d __ LDA (P0),y
+17b8 : f0 0d __ BEQ $17c7
+17ba : d1 0f __ CMP (P2),y
+17bc : d0 0d __ BNE $17cb
+17be : c8 __ __ INY
+17bf : d0 ec __ BNE $17ad
+17c1 : e6 0e __ INC P1
+17c3 : e6 10 __ INC P3
+17c5 : d0 e6 __ BNE $17ad
+17c7 : d1 0f __ CMP (P2),y
+17c9 : f0 0a __ BEQ $17d5
+17cb : b0 06 __ BCS $17d3
+17cd : a9 ff __ LDA #$ff
+17cf : 85 1c __ STA ACCU + 1
+17d1 : 30 02 __ BMI $17d5
+17d3 : a9 01 __ LDA #$01
+17d5 : 85 1b __ STA ACCU + 0
+17d7 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+17e6 : b1 19 __ LDA (IP + 0),y
+17e8 : c8 __ __ INY
+17e9 : aa __ __ TAX
+17ea : b5 00 __ LDA $00,x
+17ec : 85 03 __ STA $03
+17ee : b5 01 __ LDA $01,x
+17f0 : 85 04 __ STA $04
+17f2 : b5 02 __ LDA $02,x
+17f4 : 85 05 __ STA $05
+17f6 : b5 03 __ LDA $03,x
+17f8 : 85 06 __ STA $06
+17fa : a5 05 __ LDA $05
+17fc : 0a __ __ ASL
+17fd : a5 06 __ LDA $06
+17ff : 2a __ __ ROL
+1800 : 85 08 __ STA $08
+1802 : f0 06 __ BEQ $180a
+1804 : a5 05 __ LDA $05
+1806 : 09 80 __ ORA #$80
+1808 : 85 05 __ STA $05
+180a : a5 1d __ LDA ACCU + 2
+180c : 0a __ __ ASL
+180d : a5 1e __ LDA ACCU + 3
+180f : 2a __ __ ROL
+1810 : 85 07 __ STA $07
+1812 : f0 06 __ BEQ $181a
+1814 : a5 1d __ LDA ACCU + 2
+1816 : 09 80 __ ORA #$80
+1818 : 85 1d __ STA ACCU + 2
+181a : 60 __ __ RTS
+181b : 06 1e __ ASL ACCU + 3
+181d : a5 07 __ LDA $07
+181f : 6a __ __ ROR
+1820 : 85 1e __ STA ACCU + 3
+1822 : b0 06 __ BCS $182a
+1824 : a5 1d __ LDA ACCU + 2
+1826 : 29 7f __ AND #$7f
+1828 : 85 1d __ STA ACCU + 2
+182a : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+182b : 38 __ __ SEC
+182c : a5 07 __ LDA $07
+182e : e5 08 __ SBC $08
+1830 : f0 38 __ BEQ $186a
+1832 : aa __ __ TAX
+1833 : b0 25 __ BCS $185a
+1835 : e0 e9 __ CPX #$e9
+1837 : b0 0e __ BCS $1847
+1839 : a5 08 __ LDA $08
+183b : 85 07 __ STA $07
+183d : a9 00 __ LDA #$00
+183f : 85 1b __ STA ACCU + 0
+1841 : 85 1c __ STA ACCU + 1
+1843 : 85 1d __ STA ACCU + 2
+1845 : f0 23 __ BEQ $186a
+1847 : a5 1d __ LDA ACCU + 2
+1849 : 4a __ __ LSR
+184a : 66 1c __ ROR ACCU + 1
+184c : 66 1b __ ROR ACCU + 0
+184e : e8 __ __ INX
+184f : d0 f8 __ BNE $1849
+1851 : 85 1d __ STA ACCU + 2
+1853 : a5 08 __ LDA $08
+1855 : 85 07 __ STA $07
+1857 : 4c 6a 18 JMP $186a ; (faddsub + 63)
+185a : e0 18 __ CPX #$18
+185c : b0 33 __ BCS $1891
+185e : a5 05 __ LDA $05
+1860 : 4a __ __ LSR
+1861 : 66 04 __ ROR $04
+1863 : 66 03 __ ROR $03
+1865 : ca __ __ DEX
+1866 : d0 f8 __ BNE $1860
+1868 : 85 05 __ STA $05
+186a : a5 1e __ LDA ACCU + 3
+186c : 29 80 __ AND #$80
+186e : 85 1e __ STA ACCU + 3
+1870 : 45 06 __ EOR $06
+1872 : 30 2d __ BMI $18a1
+1874 : 18 __ __ CLC
+1875 : a5 1b __ LDA ACCU + 0
+1877 : 65 03 __ ADC $03
+1879 : 85 1b __ STA ACCU + 0
+187b : a5 1c __ LDA ACCU + 1
+187d : 65 04 __ ADC $04
+187f : 85 1c __ STA ACCU + 1
+1881 : a5 1d __ LDA ACCU + 2
+1883 : 65 05 __ ADC $05
+1885 : 85 1d __ STA ACCU + 2
+1887 : 90 08 __ BCC $1891
+1889 : 66 1d __ ROR ACCU + 2
+188b : 66 1c __ ROR ACCU + 1
+188d : 66 1b __ ROR ACCU + 0
+188f : e6 07 __ INC $07
+1891 : a5 07 __ LDA $07
+1893 : 4a __ __ LSR
+1894 : 05 1e __ ORA ACCU + 3
+1896 : 85 1e __ STA ACCU + 3
+1898 : b0 06 __ BCS $18a0
+189a : a5 1d __ LDA ACCU + 2
+189c : 29 7f __ AND #$7f
+189e : 85 1d __ STA ACCU + 2
+18a0 : 60 __ __ RTS
+18a1 : 38 __ __ SEC
+18a2 : a5 1b __ LDA ACCU + 0
+18a4 : e5 03 __ SBC $03
+18a6 : 85 1b __ STA ACCU + 0
+18a8 : a5 1c __ LDA ACCU + 1
+18aa : e5 04 __ SBC $04
+18ac : 85 1c __ STA ACCU + 1
+18ae : a5 1d __ LDA ACCU + 2
+18b0 : e5 05 __ SBC $05
+18b2 : 85 1d __ STA ACCU + 2
+18b4 : b0 19 __ BCS $18cf
+18b6 : 38 __ __ SEC
+18b7 : a9 00 __ LDA #$00
+18b9 : e5 1b __ SBC ACCU + 0
+18bb : 85 1b __ STA ACCU + 0
+18bd : a9 00 __ LDA #$00
+18bf : e5 1c __ SBC ACCU + 1
+18c1 : 85 1c __ STA ACCU + 1
+18c3 : a9 00 __ LDA #$00
+18c5 : e5 1d __ SBC ACCU + 2
+18c7 : 85 1d __ STA ACCU + 2
+18c9 : a5 1e __ LDA ACCU + 3
+18cb : 49 80 __ EOR #$80
+18cd : 85 1e __ STA ACCU + 3
+18cf : a5 1d __ LDA ACCU + 2
+18d1 : 30 be __ BMI $1891
+18d3 : 05 1c __ ORA ACCU + 1
+18d5 : 05 1b __ ORA ACCU + 0
+18d7 : f0 0f __ BEQ $18e8
+18d9 : c6 07 __ DEC $07
+18db : f0 0b __ BEQ $18e8
+18dd : 06 1b __ ASL ACCU + 0
+18df : 26 1c __ ROL ACCU + 1
+18e1 : 26 1d __ ROL ACCU + 2
+18e3 : 10 f4 __ BPL $18d9
+18e5 : 4c 91 18 JMP $1891 ; (faddsub + 102)
+18e8 : a9 00 __ LDA #$00
+18ea : 85 1b __ STA ACCU + 0
+18ec : 85 1c __ STA ACCU + 1
+18ee : 85 1d __ STA ACCU + 2
+18f0 : 85 1e __ STA ACCU + 3
+18f2 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+18f3 : a5 1b __ LDA ACCU + 0
+18f5 : 05 1c __ ORA ACCU + 1
+18f7 : 05 1d __ ORA ACCU + 2
+18f9 : d0 03 __ BNE $18fe
+18fb : 85 1e __ STA ACCU + 3
+18fd : 60 __ __ RTS
+18fe : a5 03 __ LDA $03
+1900 : 05 04 __ ORA $04
+1902 : 05 05 __ ORA $05
+1904 : d0 09 __ BNE $190f
+1906 : 85 1b __ STA ACCU + 0
+1908 : 85 1c __ STA ACCU + 1
+190a : 85 1d __ STA ACCU + 2
+190c : 85 1e __ STA ACCU + 3
+190e : 60 __ __ RTS
+190f : a9 00 __ LDA #$00
+1911 : 85 09 __ STA $09
+1913 : 85 0a __ STA $0a
+1915 : 85 0b __ STA $0b
+1917 : a4 1b __ LDY ACCU + 0
+1919 : a5 03 __ LDA $03
+191b : d0 06 __ BNE $1923
+191d : a5 04 __ LDA $04
+191f : f0 0a __ BEQ $192b
+1921 : d0 05 __ BNE $1928
+1923 : 20 63 19 JSR $1963 ; (fmul8 + 0)
+1926 : a5 04 __ LDA $04
+1928 : 20 63 19 JSR $1963 ; (fmul8 + 0)
+192b : a5 05 __ LDA $05
+192d : 20 63 19 JSR $1963 ; (fmul8 + 0)
+1930 : 38 __ __ SEC
+1931 : a5 0b __ LDA $0b
+1933 : 30 06 __ BMI $193b
+1935 : 06 09 __ ASL $09
+1937 : 26 0a __ ROL $0a
+1939 : 2a __ __ ROL
+193a : 18 __ __ CLC
+193b : 29 7f __ AND #$7f
+193d : 85 0b __ STA $0b
+193f : a5 1e __ LDA ACCU + 3
+1941 : 45 06 __ EOR $06
+1943 : 29 80 __ AND #$80
+1945 : 85 1e __ STA ACCU + 3
+1947 : a5 07 __ LDA $07
+1949 : e9 7e __ SBC #$7e
+194b : 18 __ __ CLC
+194c : 65 08 __ ADC $08
+194e : 4a __ __ LSR
+194f : 05 1e __ ORA ACCU + 3
+1951 : 85 1e __ STA ACCU + 3
+1953 : a9 00 __ LDA #$00
+1955 : 6a __ __ ROR
+1956 : 05 0b __ ORA $0b
+1958 : 85 1d __ STA ACCU + 2
+195a : a5 0a __ LDA $0a
+195c : 85 1c __ STA ACCU + 1
+195e : a5 09 __ LDA $09
+1960 : 85 1b __ STA ACCU + 0
+1962 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1963 : 38 __ __ SEC
+1964 : 6a __ __ ROR
+1965 : 90 1e __ BCC $1985
+1967 : aa __ __ TAX
+1968 : 18 __ __ CLC
+1969 : 98 __ __ TYA
+196a : 65 09 __ ADC $09
+196c : 85 09 __ STA $09
+196e : a5 0a __ LDA $0a
+1970 : 65 1c __ ADC ACCU + 1
+1972 : 85 0a __ STA $0a
+1974 : a5 0b __ LDA $0b
+1976 : 65 1d __ ADC ACCU + 2
+1978 : 6a __ __ ROR
+1979 : 85 0b __ STA $0b
+197b : 8a __ __ TXA
+197c : 66 0a __ ROR $0a
+197e : 66 09 __ ROR $09
+1980 : 4a __ __ LSR
+1981 : f0 0d __ BEQ $1990
+1983 : b0 e2 __ BCS $1967
+1985 : 66 0b __ ROR $0b
+1987 : 66 0a __ ROR $0a
+1989 : 66 09 __ ROR $09
+198b : 4a __ __ LSR
+198c : 90 f7 __ BCC $1985
+198e : d0 d7 __ BNE $1967
+1990 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1991 : a5 1b __ LDA ACCU + 0
+1993 : 05 1c __ ORA ACCU + 1
+1995 : 05 1d __ ORA ACCU + 2
+1997 : d0 03 __ BNE $199c
+1999 : 85 1e __ STA ACCU + 3
+199b : 60 __ __ RTS
+199c : a5 1e __ LDA ACCU + 3
+199e : 45 06 __ EOR $06
+19a0 : 29 80 __ AND #$80
+19a2 : 85 1e __ STA ACCU + 3
+19a4 : a9 00 __ LDA #$00
+19a6 : 85 09 __ STA $09
+19a8 : 85 0a __ STA $0a
+19aa : 85 0b __ STA $0b
+19ac : a2 18 __ LDX #$18
+19ae : a5 1b __ LDA ACCU + 0
+19b0 : c5 03 __ CMP $03
+19b2 : a5 1c __ LDA ACCU + 1
+19b4 : e5 04 __ SBC $04
+19b6 : a5 1d __ LDA ACCU + 2
+19b8 : e5 05 __ SBC $05
+19ba : 90 13 __ BCC $19cf
+19bc : a5 1b __ LDA ACCU + 0
+19be : e5 03 __ SBC $03
+19c0 : 85 1b __ STA ACCU + 0
+19c2 : a5 1c __ LDA ACCU + 1
+19c4 : e5 04 __ SBC $04
+19c6 : 85 1c __ STA ACCU + 1
+19c8 : a5 1d __ LDA ACCU + 2
+19ca : e5 05 __ SBC $05
+19cc : 85 1d __ STA ACCU + 2
+19ce : 38 __ __ SEC
+19cf : 26 09 __ ROL $09
+19d1 : 26 0a __ ROL $0a
+19d3 : 26 0b __ ROL $0b
+19d5 : ca __ __ DEX
+19d6 : f0 0a __ BEQ $19e2
+19d8 : 06 1b __ ASL ACCU + 0
+19da : 26 1c __ ROL ACCU + 1
+19dc : 26 1d __ ROL ACCU + 2
+19de : b0 dc __ BCS $19bc
+19e0 : 90 cc __ BCC $19ae
+19e2 : 38 __ __ SEC
+19e3 : a5 0b __ LDA $0b
+19e5 : 30 06 __ BMI $19ed
+19e7 : 06 09 __ ASL $09
+19e9 : 26 0a __ ROL $0a
+19eb : 2a __ __ ROL
+19ec : 18 __ __ CLC
+19ed : 29 7f __ AND #$7f
+19ef : 85 0b __ STA $0b
+19f1 : a5 08 __ LDA $08
+19f3 : 49 7f __ EOR #$7f
+19f5 : 65 07 __ ADC $07
+19f7 : 38 __ __ SEC
+19f8 : e9 01 __ SBC #$01
+19fa : 4a __ __ LSR
+19fb : 05 1e __ ORA ACCU + 3
+19fd : 85 1e __ STA ACCU + 3
+19ff : a9 00 __ LDA #$00
+1a01 : 6a __ __ ROR
+1a02 : 05 0b __ ORA $0b
+1a04 : 85 1d __ STA ACCU + 2
+1a06 : a5 0a __ LDA $0a
+1a08 : 85 1c __ STA ACCU + 1
+1a0a : a5 09 __ LDA $09
+1a0c : 85 1b __ STA ACCU + 0
+1a0e : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+1a0f : 38 __ __ SEC
+1a10 : a9 00 __ LDA #$00
+1a12 : e5 1b __ SBC ACCU + 0
+1a14 : 85 1b __ STA ACCU + 0
+1a16 : a9 00 __ LDA #$00
+1a18 : e5 1c __ SBC ACCU + 1
+1a1a : 85 1c __ STA ACCU + 1
+1a1c : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1a1d : 38 __ __ SEC
+1a1e : a9 00 __ LDA #$00
+1a20 : e5 03 __ SBC $03
+1a22 : 85 03 __ STA $03
+1a24 : a9 00 __ LDA #$00
+1a26 : e5 04 __ SBC $04
+1a28 : 85 04 __ STA $04
+1a2a : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1a2b : a5 1c __ LDA ACCU + 1
+1a2d : d0 31 __ BNE $1a60
+1a2f : a5 04 __ LDA $04
+1a31 : d0 1e __ BNE $1a51
+1a33 : 85 06 __ STA $06
+1a35 : a2 04 __ LDX #$04
+1a37 : 06 1b __ ASL ACCU + 0
+1a39 : 2a __ __ ROL
+1a3a : c5 03 __ CMP $03
+1a3c : 90 02 __ BCC $1a40
+1a3e : e5 03 __ SBC $03
+1a40 : 26 1b __ ROL ACCU + 0
+1a42 : 2a __ __ ROL
+1a43 : c5 03 __ CMP $03
+1a45 : 90 02 __ BCC $1a49
+1a47 : e5 03 __ SBC $03
+1a49 : 26 1b __ ROL ACCU + 0
+1a4b : ca __ __ DEX
+1a4c : d0 eb __ BNE $1a39
+1a4e : 85 05 __ STA $05
+1a50 : 60 __ __ RTS
+1a51 : a5 1b __ LDA ACCU + 0
+1a53 : 85 05 __ STA $05
+1a55 : a5 1c __ LDA ACCU + 1
+1a57 : 85 06 __ STA $06
+1a59 : a9 00 __ LDA #$00
+1a5b : 85 1b __ STA ACCU + 0
+1a5d : 85 1c __ STA ACCU + 1
+1a5f : 60 __ __ RTS
+1a60 : a5 04 __ LDA $04
+1a62 : d0 1f __ BNE $1a83
+1a64 : a5 03 __ LDA $03
+1a66 : 30 1b __ BMI $1a83
+1a68 : a9 00 __ LDA #$00
+1a6a : 85 06 __ STA $06
+1a6c : a2 10 __ LDX #$10
+1a6e : 06 1b __ ASL ACCU + 0
+1a70 : 26 1c __ ROL ACCU + 1
+1a72 : 2a __ __ ROL
+1a73 : c5 03 __ CMP $03
+1a75 : 90 02 __ BCC $1a79
+1a77 : e5 03 __ SBC $03
+1a79 : 26 1b __ ROL ACCU + 0
+1a7b : 26 1c __ ROL ACCU + 1
+1a7d : ca __ __ DEX
+1a7e : d0 f2 __ BNE $1a72
+1a80 : 85 05 __ STA $05
+1a82 : 60 __ __ RTS
+1a83 : a9 00 __ LDA #$00
+1a85 : 85 05 __ STA $05
+1a87 : 85 06 __ STA $06
+1a89 : 84 02 __ STY $02
+1a8b : a0 10 __ LDY #$10
+1a8d : 18 __ __ CLC
+1a8e : 26 1b __ ROL ACCU + 0
+1a90 : 26 1c __ ROL ACCU + 1
+1a92 : 26 05 __ ROL $05
+1a94 : 26 06 __ ROL $06
+1a96 : 38 __ __ SEC
+1a97 : a5 05 __ LDA $05
+1a99 : e5 03 __ SBC $03
+1a9b : aa __ __ TAX
+1a9c : a5 06 __ LDA $06
+1a9e : e5 04 __ SBC $04
+1aa0 : 90 04 __ BCC $1aa6
+1aa2 : 86 05 __ STX $05
+1aa4 : 85 06 __ STA $06
+1aa6 : 88 __ __ DEY
+1aa7 : d0 e5 __ BNE $1a8e
+1aa9 : 26 1b __ ROL ACCU + 0
+1aab : 26 1c __ ROL ACCU + 1
+1aad : a4 02 __ LDY $02
+1aaf : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1ab0 : 20 0a 18 JSR $180a ; (freg + 36)
+1ab3 : a5 07 __ LDA $07
+1ab5 : c9 7f __ CMP #$7f
+1ab7 : b0 07 __ BCS $1ac0
+1ab9 : a9 00 __ LDA #$00
+1abb : 85 1b __ STA ACCU + 0
+1abd : 85 1c __ STA ACCU + 1
+1abf : 60 __ __ RTS
+1ac0 : 38 __ __ SEC
+1ac1 : e9 8e __ SBC #$8e
+1ac3 : 90 0a __ BCC $1acf
+1ac5 : a9 ff __ LDA #$ff
+1ac7 : 85 1b __ STA ACCU + 0
+1ac9 : a9 7f __ LDA #$7f
+1acb : 85 1c __ STA ACCU + 1
+1acd : d0 08 __ BNE $1ad7
+1acf : aa __ __ TAX
+1ad0 : 46 1d __ LSR ACCU + 2
+1ad2 : 66 1c __ ROR ACCU + 1
+1ad4 : e8 __ __ INX
+1ad5 : d0 f9 __ BNE $1ad0
+1ad7 : 24 1e __ BIT ACCU + 3
+1ad9 : 10 0e __ BPL $1ae9
+1adb : 38 __ __ SEC
+1adc : a9 00 __ LDA #$00
+1ade : e5 1c __ SBC ACCU + 1
+1ae0 : 85 1b __ STA ACCU + 0
+1ae2 : a9 00 __ LDA #$00
+1ae4 : e5 1d __ SBC ACCU + 2
+1ae6 : 85 1c __ STA ACCU + 1
+1ae8 : 60 __ __ RTS
+1ae9 : a5 1c __ LDA ACCU + 1
+1aeb : 85 1b __ STA ACCU + 0
+1aed : a5 1d __ LDA ACCU + 2
+1aef : 85 1c __ STA ACCU + 1
+1af1 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1af2 : 24 1c __ BIT ACCU + 1
+1af4 : 30 03 __ BMI $1af9
+1af6 : 4c 10 1b JMP $1b10 ; (uint16_to_float + 0)
+1af9 : 38 __ __ SEC
+1afa : a9 00 __ LDA #$00
+1afc : e5 1b __ SBC ACCU + 0
+1afe : 85 1b __ STA ACCU + 0
+1b00 : a9 00 __ LDA #$00
+1b02 : e5 1c __ SBC ACCU + 1
+1b04 : 85 1c __ STA ACCU + 1
+1b06 : 20 10 1b JSR $1b10 ; (uint16_to_float + 0)
+1b09 : a5 1e __ LDA ACCU + 3
+1b0b : 09 80 __ ORA #$80
+1b0d : 85 1e __ STA ACCU + 3
+1b0f : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1b10 : a5 1b __ LDA ACCU + 0
+1b12 : 05 1c __ ORA ACCU + 1
+1b14 : d0 05 __ BNE $1b1b
+1b16 : 85 1d __ STA ACCU + 2
+1b18 : 85 1e __ STA ACCU + 3
+1b1a : 60 __ __ RTS
+1b1b : a2 8e __ LDX #$8e
+1b1d : a5 1c __ LDA ACCU + 1
+1b1f : 30 06 __ BMI $1b27
+1b21 : ca __ __ DEX
+1b22 : 06 1b __ ASL ACCU + 0
+1b24 : 2a __ __ ROL
+1b25 : 10 fa __ BPL $1b21
+1b27 : 29 7f __ AND #$7f
+1b29 : 85 1d __ STA ACCU + 2
+1b2b : a5 1b __ LDA ACCU + 0
+1b2d : 85 1c __ STA ACCU + 1
+1b2f : 8a __ __ TXA
+1b30 : 4a __ __ LSR
+1b31 : 85 1e __ STA ACCU + 3
+1b33 : a9 00 __ LDA #$00
+1b35 : 85 1b __ STA ACCU + 0
+1b37 : 6a __ __ ROR
+1b38 : 05 1d __ ORA ACCU + 2
+1b3a : 85 1d __ STA ACCU + 2
+1b3c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1b3d : 38 __ __ SEC
+1b3e : a9 00 __ LDA #$00
+1b40 : e5 1b __ SBC ACCU + 0
+1b42 : 85 1b __ STA ACCU + 0
+1b44 : a9 00 __ LDA #$00
+1b46 : e5 1c __ SBC ACCU + 1
+1b48 : 85 1c __ STA ACCU + 1
+1b4a : a9 00 __ LDA #$00
+1b4c : e5 1d __ SBC ACCU + 2
+1b4e : 85 1d __ STA ACCU + 2
+1b50 : a9 00 __ LDA #$00
+1b52 : e5 1e __ SBC ACCU + 3
+1b54 : 85 1e __ STA ACCU + 3
+1b56 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1b57 : 84 02 __ STY $02
+1b59 : a9 00 __ LDA #$00
+1b5b : 85 07 __ STA $07
+1b5d : 85 08 __ STA $08
+1b5f : 85 09 __ STA $09
+1b61 : 85 0a __ STA $0a
+1b63 : a0 20 __ LDY #$20
+1b65 : 18 __ __ CLC
+1b66 : 26 1b __ ROL ACCU + 0
+1b68 : 26 1c __ ROL ACCU + 1
+1b6a : 26 1d __ ROL ACCU + 2
+1b6c : 26 1e __ ROL ACCU + 3
+1b6e : 26 07 __ ROL $07
+1b70 : 26 08 __ ROL $08
+1b72 : 26 09 __ ROL $09
+1b74 : 26 0a __ ROL $0a
+1b76 : a5 07 __ LDA $07
+1b78 : c5 03 __ CMP $03
+1b7a : a5 08 __ LDA $08
+1b7c : e5 04 __ SBC $04
+1b7e : a5 09 __ LDA $09
+1b80 : e5 05 __ SBC $05
+1b82 : a5 0a __ LDA $0a
+1b84 : e5 06 __ SBC $06
+1b86 : 90 18 __ BCC $1ba0
+1b88 : a5 07 __ LDA $07
+1b8a : e5 03 __ SBC $03
+1b8c : 85 07 __ STA $07
+1b8e : a5 08 __ LDA $08
+1b90 : e5 04 __ SBC $04
+1b92 : 85 08 __ STA $08
+1b94 : a5 09 __ LDA $09
+1b96 : e5 05 __ SBC $05
+1b98 : 85 09 __ STA $09
+1b9a : a5 0a __ LDA $0a
+1b9c : e5 06 __ SBC $06
+1b9e : 85 0a __ STA $0a
+1ba0 : 88 __ __ DEY
+1ba1 : d0 c3 __ BNE $1b66
+1ba3 : 26 1b __ ROL ACCU + 0
+1ba5 : 26 1c __ ROL ACCU + 1
+1ba7 : 26 1d __ ROL ACCU + 2
+1ba9 : 26 1e __ ROL ACCU + 3
+1bab : a4 02 __ LDY $02
+1bad : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1bae : a9 00 __ LDA #$00
+1bb0 : 85 1d __ STA ACCU + 2
+1bb2 : 85 1e __ STA ACCU + 3
+1bb4 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1bb5 : b5 00 __ LDA $00,x
+1bb7 : 85 03 __ STA $03
+1bb9 : b5 01 __ LDA $01,x
+1bbb : 85 04 __ STA $04
+1bbd : b5 02 __ LDA $02,x
+1bbf : 85 05 __ STA $05
+1bc1 : b5 03 __ LDA $03,x
+1bc3 : 85 06 __ STA $06
+1bc5 : 20 57 1b JSR $1b57 ; (divmod32 + 0)
+1bc8 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1bc9 : b5 00 __ LDA $00,x
+1bcb : 85 03 __ STA $03
+1bcd : b5 01 __ LDA $01,x
+1bcf : 85 04 __ STA $04
+1bd1 : b5 02 __ LDA $02,x
+1bd3 : 85 05 __ STA $05
+1bd5 : b5 03 __ LDA $03,x
+1bd7 : 85 06 __ STA $06
+1bd9 : 20 57 1b JSR $1b57 ; (divmod32 + 0)
+1bdc : a5 07 __ LDA $07
+1bde : 85 1b __ STA ACCU + 0
+1be0 : a5 08 __ LDA $08
+1be2 : 85 1c __ STA ACCU + 1
+1be4 : a5 09 __ LDA $09
+1be6 : 85 1d __ STA ACCU + 2
+1be8 : a5 0a __ LDA $0a
+1bea : 85 1e __ STA ACCU + 3
+1bec : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1bed : b5 03 __ LDA $03,x
+1bef : c5 1e __ CMP ACCU + 3
+1bf1 : d0 20 __ BNE $1c13
+1bf3 : b5 02 __ LDA $02,x
+1bf5 : c5 1d __ CMP ACCU + 2
+1bf7 : d0 1a __ BNE $1c13
+1bf9 : b5 01 __ LDA $01,x
+1bfb : c5 1c __ CMP ACCU + 1
+1bfd : d0 14 __ BNE $1c13
+1bff : b5 00 __ LDA $00,x
+1c01 : c5 1b __ CMP ACCU + 0
+1c03 : d0 0e __ BNE $1c13
+1c05 : a9 00 __ LDA #$00
+1c07 : 85 1b __ STA ACCU + 0
+1c09 : 85 1c __ STA ACCU + 1
+1c0b : 60 __ __ RTS
+1c0c : a9 ff __ LDA #$ff
+1c0e : 85 1b __ STA ACCU + 0
+1c10 : 85 1c __ STA ACCU + 1
+1c12 : 60 __ __ RTS
+1c13 : 90 f7 __ BCC $1c0c
+1c15 : a9 01 __ LDA #$01
+1c17 : 85 1b __ STA ACCU + 0
+1c19 : a9 00 __ LDA #$00
+1c1b : 85 1c __ STA ACCU + 1
+1c1d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1c1e : a5 1e __ LDA ACCU + 3
+1c20 : 49 80 __ EOR #$80
+1c22 : 85 1e __ STA ACCU + 3
+1c24 : b5 03 __ LDA $03,x
+1c26 : 49 80 __ EOR #$80
+1c28 : c5 1e __ CMP ACCU + 3
+1c2a : d0 20 __ BNE $1c4c
+1c2c : b5 02 __ LDA $02,x
+1c2e : c5 1d __ CMP ACCU + 2
+1c30 : d0 1a __ BNE $1c4c
+1c32 : b5 01 __ LDA $01,x
+1c34 : c5 1c __ CMP ACCU + 1
+1c36 : d0 14 __ BNE $1c4c
+1c38 : b5 00 __ LDA $00,x
+1c3a : c5 1b __ CMP ACCU + 0
+1c3c : d0 0e __ BNE $1c4c
+1c3e : a9 00 __ LDA #$00
+1c40 : 85 1b __ STA ACCU + 0
+1c42 : 85 1c __ STA ACCU + 1
+1c44 : 60 __ __ RTS
+1c45 : a9 ff __ LDA #$ff
+1c47 : 85 1b __ STA ACCU + 0
+1c49 : 85 1c __ STA ACCU + 1
+1c4b : 60 __ __ RTS
+1c4c : 90 f7 __ BCC $1c45
+1c4e : a9 01 __ LDA #$01
+1c50 : 85 1b __ STA ACCU + 0
+1c52 : a9 00 __ LDA #$00
+1c54 : 85 1c __ STA ACCU + 1
+1c56 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c57 : a9 4c __ LDA #$4c
+1c59 : 85 54 __ STA $54
+1c5b : a9 00 __ LDA #$00
+1c5d : 85 13 __ STA P6
+1c5f : a9 19 __ LDA #$19
+1c61 : 85 16 __ STA P9
+1c63 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1c64 : b1 19 __ LDA (IP + 0),y
+1c66 : aa __ __ TAX
+1c67 : c8 __ __ INY
+1c68 : b1 19 __ LDA (IP + 0),y
+1c6a : 95 00 __ STA $00,x
+1c6c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1c6f : b1 19 __ LDA (IP + 0),y
+1c71 : aa __ __ TAX
+1c72 : c8 __ __ INY
+1c73 : b1 19 __ LDA (IP + 0),y
+1c75 : 95 00 __ STA $00,x
+1c77 : a9 00 __ LDA #$00
+1c79 : 95 01 __ STA $01,x
+1c7b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1c7e : b1 19 __ LDA (IP + 0),y
+1c80 : aa __ __ TAX
+1c81 : c8 __ __ INY
+1c82 : b1 19 __ LDA (IP + 0),y
+1c84 : 95 00 __ STA $00,x
+1c86 : a9 ff __ LDA #$ff
+1c88 : 95 01 __ STA $01,x
+1c8a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1c8d : b1 19 __ LDA (IP + 0),y
+1c8f : aa __ __ TAX
+1c90 : c8 __ __ INY
+1c91 : b1 19 __ LDA (IP + 0),y
+1c93 : 95 00 __ STA $00,x
+1c95 : c8 __ __ INY
+1c96 : b1 19 __ LDA (IP + 0),y
+1c98 : 95 01 __ STA $01,x
+1c9a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1c9d : b1 19 __ LDA (IP + 0),y
+1c9f : aa __ __ TAX
+1ca0 : c8 __ __ INY
+1ca1 : b1 19 __ LDA (IP + 0),y
+1ca3 : 95 00 __ STA $00,x
+1ca5 : c8 __ __ INY
+1ca6 : b1 19 __ LDA (IP + 0),y
+1ca8 : 95 01 __ STA $01,x
+1caa : c8 __ __ INY
+1cab : b1 19 __ LDA (IP + 0),y
+1cad : 95 02 __ STA $02,x
+1caf : c8 __ __ INY
+1cb0 : b1 19 __ LDA (IP + 0),y
+1cb2 : 95 03 __ STA $03,x
+1cb4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1cb7 : b1 19 __ LDA (IP + 0),y
+1cb9 : aa __ __ TAX
+1cba : b5 00 __ LDA $00,x
+1cbc : 85 1b __ STA ACCU + 0
+1cbe : a9 00 __ LDA #$00
+1cc0 : 85 1c __ STA ACCU + 1
+1cc2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1cc5 : b1 19 __ LDA (IP + 0),y
+1cc7 : aa __ __ TAX
+1cc8 : a5 1b __ LDA ACCU + 0
+1cca : 95 00 __ STA $00,x
+1ccc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1ccf : b1 19 __ LDA (IP + 0),y
+1cd1 : aa __ __ TAX
+1cd2 : b5 00 __ LDA $00,x
+1cd4 : 85 1b __ STA ACCU + 0
+1cd6 : b5 01 __ LDA $01,x
+1cd8 : 85 1c __ STA ACCU + 1
+1cda : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1cdd : b1 19 __ LDA (IP + 0),y
+1cdf : aa __ __ TAX
+1ce0 : a5 1b __ LDA ACCU + 0
+1ce2 : 95 00 __ STA $00,x
+1ce4 : a5 1c __ LDA ACCU + 1
+1ce6 : 95 01 __ STA $01,x
+1ce8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1ceb : b1 19 __ LDA (IP + 0),y
+1ced : aa __ __ TAX
+1cee : b5 00 __ LDA $00,x
+1cf0 : 85 1f __ STA ADDR + 0
+1cf2 : b5 01 __ LDA $01,x
+1cf4 : 85 20 __ STA ADDR + 1
+1cf6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1cf9 : b1 19 __ LDA (IP + 0),y
+1cfb : aa __ __ TAX
+1cfc : b5 00 __ LDA $00,x
+1cfe : 85 1b __ STA ACCU + 0
+1d00 : b5 01 __ LDA $01,x
+1d02 : 85 1c __ STA ACCU + 1
+1d04 : b5 02 __ LDA $02,x
+1d06 : 85 1d __ STA ACCU + 2
+1d08 : b5 03 __ LDA $03,x
+1d0a : 85 1e __ STA ACCU + 3
+1d0c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1d0f : b1 19 __ LDA (IP + 0),y
+1d11 : aa __ __ TAX
+1d12 : a5 1b __ LDA ACCU + 0
+1d14 : 95 00 __ STA $00,x
+1d16 : a5 1c __ LDA ACCU + 1
+1d18 : 95 01 __ STA $01,x
+1d1a : a5 1d __ LDA ACCU + 2
+1d1c : 95 02 __ STA $02,x
+1d1e : a5 1e __ LDA ACCU + 3
+1d20 : 95 03 __ STA $03,x
+1d22 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1d25 : b1 19 __ LDA (IP + 0),y
+1d27 : 85 1f __ STA ADDR + 0
+1d29 : c8 __ __ INY
+1d2a : b1 19 __ LDA (IP + 0),y
+1d2c : 85 20 __ STA ADDR + 1
+1d2e : c8 __ __ INY
+1d2f : b1 19 __ LDA (IP + 0),y
+1d31 : aa __ __ TAX
+1d32 : 84 02 __ STY $02
+1d34 : a0 00 __ LDY #$00
+1d36 : b1 1f __ LDA (ADDR + 0),y
+1d38 : 95 00 __ STA $00,x
+1d3a : a9 00 __ LDA #$00
+1d3c : 95 01 __ STA $01,x
+1d3e : a4 02 __ LDY $02
+1d40 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d43 : b1 19 __ LDA (IP + 0),y
+1d45 : aa __ __ TAX
+1d46 : c8 __ __ INY
+1d47 : b1 19 __ LDA (IP + 0),y
+1d49 : 84 02 __ STY $02
+1d4b : a8 __ __ TAY
+1d4c : 4c 36 1d JMP $1d36 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1d4f : b1 19 __ LDA (IP + 0),y
+1d51 : aa __ __ TAX
+1d52 : c8 __ __ INY
+1d53 : b1 19 __ LDA (IP + 0),y
+1d55 : 95 00 __ STA $00,x
+1d57 : c8 __ __ INY
+1d58 : b1 19 __ LDA (IP + 0),y
+1d5a : 95 01 __ STA $01,x
+1d5c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1d5f : b1 19 __ LDA (IP + 0),y
+1d61 : aa __ __ TAX
+1d62 : c8 __ __ INY
+1d63 : 18 __ __ CLC
+1d64 : b5 00 __ LDA $00,x
+1d66 : 71 19 __ ADC (IP + 0),y
+1d68 : 85 1f __ STA ADDR + 0
+1d6a : c8 __ __ INY
+1d6b : b5 01 __ LDA $01,x
+1d6d : 71 19 __ ADC (IP + 0),y
+1d6f : 85 20 __ STA ADDR + 1
+1d71 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1d74 : b1 19 __ LDA (IP + 0),y
+1d76 : aa __ __ TAX
+1d77 : 18 __ __ CLC
+1d78 : b5 00 __ LDA $00,x
+1d7a : 65 1b __ ADC ACCU + 0
+1d7c : 85 1f __ STA ADDR + 0
+1d7e : b5 01 __ LDA $01,x
+1d80 : 65 1c __ ADC ACCU + 1
+1d82 : 85 20 __ STA ADDR + 1
+1d84 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1d87 : b1 19 __ LDA (IP + 0),y
+1d89 : aa __ __ TAX
+1d8a : c8 __ __ INY
+1d8b : b1 19 __ LDA (IP + 0),y
+1d8d : 84 02 __ STY $02
+1d8f : a8 __ __ TAY
+1d90 : b1 25 __ LDA (FP + 0),y
+1d92 : 95 00 __ STA $00,x
+1d94 : a4 02 __ LDY $02
+1d96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1d99 : b1 19 __ LDA (IP + 0),y
+1d9b : aa __ __ TAX
+1d9c : c8 __ __ INY
+1d9d : b1 19 __ LDA (IP + 0),y
+1d9f : 84 02 __ STY $02
+1da1 : a8 __ __ TAY
+1da2 : b1 25 __ LDA (FP + 0),y
+1da4 : 95 00 __ STA $00,x
+1da6 : a9 00 __ LDA #$00
+1da8 : 95 01 __ STA $01,x
+1daa : a4 02 __ LDY $02
+1dac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1daf : b1 19 __ LDA (IP + 0),y
+1db1 : aa __ __ TAX
+1db2 : c8 __ __ INY
+1db3 : b1 19 __ LDA (IP + 0),y
+1db5 : 84 02 __ STY $02
+1db7 : a8 __ __ TAY
+1db8 : b1 25 __ LDA (FP + 0),y
+1dba : 95 00 __ STA $00,x
+1dbc : c8 __ __ INY
+1dbd : b1 25 __ LDA (FP + 0),y
+1dbf : 95 01 __ STA $01,x
+1dc1 : a4 02 __ LDY $02
+1dc3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1dc6 : b1 19 __ LDA (IP + 0),y
+1dc8 : aa __ __ TAX
+1dc9 : c8 __ __ INY
+1dca : b1 19 __ LDA (IP + 0),y
+1dcc : 84 02 __ STY $02
+1dce : a8 __ __ TAY
+1dcf : b5 00 __ LDA $00,x
+1dd1 : 91 25 __ STA (FP + 0),y
+1dd3 : a4 02 __ LDY $02
+1dd5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1dd8 : b1 19 __ LDA (IP + 0),y
+1dda : aa __ __ TAX
+1ddb : c8 __ __ INY
+1ddc : b1 19 __ LDA (IP + 0),y
+1dde : 84 02 __ STY $02
+1de0 : a8 __ __ TAY
+1de1 : b5 00 __ LDA $00,x
+1de3 : 91 25 __ STA (FP + 0),y
+1de5 : c8 __ __ INY
+1de6 : b5 01 __ LDA $01,x
+1de8 : 91 25 __ STA (FP + 0),y
+1dea : a4 02 __ LDY $02
+1dec : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1def : b1 19 __ LDA (IP + 0),y
+1df1 : aa __ __ TAX
+1df2 : c8 __ __ INY
+1df3 : 18 __ __ CLC
+1df4 : b1 19 __ LDA (IP + 0),y
+1df6 : 65 25 __ ADC FP + 0
+1df8 : 95 00 __ STA $00,x
+1dfa : c8 __ __ INY
+1dfb : b1 19 __ LDA (IP + 0),y
+1dfd : 65 26 __ ADC FP + 1
+1dff : 95 01 __ STA $01,x
+1e01 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1e04 : b1 19 __ LDA (IP + 0),y
+1e06 : aa __ __ TAX
+1e07 : c8 __ __ INY
+1e08 : b1 19 __ LDA (IP + 0),y
+1e0a : 84 02 __ STY $02
+1e0c : a8 __ __ TAY
+1e0d : b5 00 __ LDA $00,x
+1e0f : 91 23 __ STA (SP + 0),y
+1e11 : c8 __ __ INY
+1e12 : b5 01 __ LDA $01,x
+1e14 : 91 23 __ STA (SP + 0),y
+1e16 : a4 02 __ LDY $02
+1e18 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1e1b : b1 19 __ LDA (IP + 0),y
+1e1d : aa __ __ TAX
+1e1e : c8 __ __ INY
+1e1f : b1 19 __ LDA (IP + 0),y
+1e21 : 84 02 __ STY $02
+1e23 : a8 __ __ TAY
+1e24 : b5 00 __ LDA $00,x
+1e26 : 91 23 __ STA (SP + 0),y
+1e28 : c8 __ __ INY
+1e29 : b5 01 __ LDA $01,x
+1e2b : 91 23 __ STA (SP + 0),y
+1e2d : c8 __ __ INY
+1e2e : b5 02 __ LDA $02,x
+1e30 : 91 23 __ STA (SP + 0),y
+1e32 : c8 __ __ INY
+1e33 : b5 03 __ LDA $03,x
+1e35 : 91 23 __ STA (SP + 0),y
+1e37 : a4 02 __ LDY $02
+1e39 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1e3c : b1 19 __ LDA (IP + 0),y
+1e3e : 85 1f __ STA ADDR + 0
+1e40 : c8 __ __ INY
+1e41 : b1 19 __ LDA (IP + 0),y
+1e43 : 85 20 __ STA ADDR + 1
+1e45 : c8 __ __ INY
+1e46 : b1 19 __ LDA (IP + 0),y
+1e48 : aa __ __ TAX
+1e49 : 84 02 __ STY $02
+1e4b : a0 00 __ LDY #$00
+1e4d : b1 1f __ LDA (ADDR + 0),y
+1e4f : 95 00 __ STA $00,x
+1e51 : a4 02 __ LDY $02
+1e53 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e56 : b1 19 __ LDA (IP + 0),y
+1e58 : aa __ __ TAX
+1e59 : c8 __ __ INY
+1e5a : b1 19 __ LDA (IP + 0),y
+1e5c : 84 02 __ STY $02
+1e5e : a8 __ __ TAY
+1e5f : 4c 4d 1e JMP $1e4d ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1e62 : b1 19 __ LDA (IP + 0),y
+1e64 : 85 1f __ STA ADDR + 0
+1e66 : c8 __ __ INY
+1e67 : b1 19 __ LDA (IP + 0),y
+1e69 : 85 20 __ STA ADDR + 1
+1e6b : c8 __ __ INY
+1e6c : b1 19 __ LDA (IP + 0),y
+1e6e : aa __ __ TAX
+1e6f : 84 02 __ STY $02
+1e71 : a0 00 __ LDY #$00
+1e73 : b1 1f __ LDA (ADDR + 0),y
+1e75 : 95 00 __ STA $00,x
+1e77 : c8 __ __ INY
+1e78 : b1 1f __ LDA (ADDR + 0),y
+1e7a : 95 01 __ STA $01,x
+1e7c : a4 02 __ LDY $02
+1e7e : 4c 50 08 JMP $0850 ; (startup + 79)
+1e81 : b1 19 __ LDA (IP + 0),y
+1e83 : aa __ __ TAX
+1e84 : c8 __ __ INY
+1e85 : b1 19 __ LDA (IP + 0),y
+1e87 : 84 02 __ STY $02
+1e89 : a8 __ __ TAY
+1e8a : 4c 73 1e JMP $1e73 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1e8d : b1 19 __ LDA (IP + 0),y
+1e8f : 85 1f __ STA ADDR + 0
+1e91 : c8 __ __ INY
+1e92 : b1 19 __ LDA (IP + 0),y
+1e94 : 85 20 __ STA ADDR + 1
+1e96 : c8 __ __ INY
+1e97 : b1 19 __ LDA (IP + 0),y
+1e99 : aa __ __ TAX
+1e9a : 84 02 __ STY $02
+1e9c : a0 00 __ LDY #$00
+1e9e : b1 1f __ LDA (ADDR + 0),y
+1ea0 : 95 00 __ STA $00,x
+1ea2 : c8 __ __ INY
+1ea3 : b1 1f __ LDA (ADDR + 0),y
+1ea5 : 95 01 __ STA $01,x
+1ea7 : c8 __ __ INY
+1ea8 : b1 1f __ LDA (ADDR + 0),y
+1eaa : 95 02 __ STA $02,x
+1eac : c8 __ __ INY
+1ead : b1 1f __ LDA (ADDR + 0),y
+1eaf : 95 03 __ STA $03,x
+1eb1 : a4 02 __ LDY $02
+1eb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+1eb6 : b1 19 __ LDA (IP + 0),y
+1eb8 : aa __ __ TAX
+1eb9 : c8 __ __ INY
+1eba : b1 19 __ LDA (IP + 0),y
+1ebc : 84 02 __ STY $02
+1ebe : a8 __ __ TAY
+1ebf : 4c 9e 1e JMP $1e9e ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1ec2 : b1 19 __ LDA (IP + 0),y
+1ec4 : 85 1f __ STA ADDR + 0
+1ec6 : c8 __ __ INY
+1ec7 : b1 19 __ LDA (IP + 0),y
+1ec9 : 85 20 __ STA ADDR + 1
+1ecb : c8 __ __ INY
+1ecc : b1 19 __ LDA (IP + 0),y
+1ece : aa __ __ TAX
+1ecf : 84 02 __ STY $02
+1ed1 : a0 00 __ LDY #$00
+1ed3 : b5 00 __ LDA $00,x
+1ed5 : 91 1f __ STA (ADDR + 0),y
+1ed7 : a4 02 __ LDY $02
+1ed9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1edc : b1 19 __ LDA (IP + 0),y
+1ede : aa __ __ TAX
+1edf : c8 __ __ INY
+1ee0 : b1 19 __ LDA (IP + 0),y
+1ee2 : 84 02 __ STY $02
+1ee4 : a8 __ __ TAY
+1ee5 : 4c d3 1e JMP $1ed3 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1ee8 : b1 19 __ LDA (IP + 0),y
+1eea : aa __ __ TAX
+1eeb : 18 __ __ CLC
+1eec : a5 1b __ LDA ACCU + 0
+1eee : 75 00 __ ADC $00,x
+1ef0 : 85 1b __ STA ACCU + 0
+1ef2 : a5 1c __ LDA ACCU + 1
+1ef4 : 75 01 __ ADC $01,x
+1ef6 : 85 1c __ STA ACCU + 1
+1ef8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1efb : b1 19 __ LDA (IP + 0),y
+1efd : aa __ __ TAX
+1efe : 38 __ __ SEC
+1eff : a5 1b __ LDA ACCU + 0
+1f01 : f5 00 __ SBC $00,x
+1f03 : 85 1b __ STA ACCU + 0
+1f05 : a5 1c __ LDA ACCU + 1
+1f07 : f5 01 __ SBC $01,x
+1f09 : 85 1c __ STA ACCU + 1
+1f0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+1f0e : b1 19 __ LDA (IP + 0),y
+1f10 : aa __ __ TAX
+1f11 : a9 00 __ LDA #$00
+1f13 : 85 05 __ STA $05
+1f15 : 85 06 __ STA $06
+1f17 : b5 00 __ LDA $00,x
+1f19 : 85 03 __ STA $03
+1f1b : b5 01 __ LDA $01,x
+1f1d : 85 04 __ STA $04
+1f1f : a2 10 __ LDX #$10
+1f21 : 46 04 __ LSR $04
+1f23 : 66 03 __ ROR $03
+1f25 : 90 0d __ BCC $1f34
+1f27 : 18 __ __ CLC
+1f28 : a5 05 __ LDA $05
+1f2a : 65 1b __ ADC ACCU + 0
+1f2c : 85 05 __ STA $05
+1f2e : a5 06 __ LDA $06
+1f30 : 65 1c __ ADC ACCU + 1
+1f32 : 85 06 __ STA $06
+1f34 : 06 1b __ ASL ACCU + 0
+1f36 : 26 1c __ ROL ACCU + 1
+1f38 : ca __ __ DEX
+1f39 : d0 e6 __ BNE $1f21
+1f3b : a5 05 __ LDA $05
+1f3d : 85 1b __ STA ACCU + 0
+1f3f : a5 06 __ LDA $06
+1f41 : 85 1c __ STA ACCU + 1
+1f43 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1f46 : b1 19 __ LDA (IP + 0),y
+1f48 : aa __ __ TAX
+1f49 : b5 00 __ LDA $00,x
+1f4b : 85 03 __ STA $03
+1f4d : b5 01 __ LDA $01,x
+1f4f : 85 04 __ STA $04
+1f51 : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1f54 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1f57 : b1 19 __ LDA (IP + 0),y
+1f59 : aa __ __ TAX
+1f5a : b5 00 __ LDA $00,x
+1f5c : 85 03 __ STA $03
+1f5e : b5 01 __ LDA $01,x
+1f60 : 85 04 __ STA $04
+1f62 : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1f65 : a5 05 __ LDA $05
+1f67 : 85 1b __ STA ACCU + 0
+1f69 : a5 06 __ LDA $06
+1f6b : 85 1c __ STA ACCU + 1
+1f6d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1f70 : b1 19 __ LDA (IP + 0),y
+1f72 : aa __ __ TAX
+1f73 : b5 00 __ LDA $00,x
+1f75 : 85 03 __ STA $03
+1f77 : b5 01 __ LDA $01,x
+1f79 : 85 04 __ STA $04
+1f7b : 24 1c __ BIT ACCU + 1
+1f7d : 10 10 __ BPL $1f8f
+1f7f : 20 0f 1a JSR $1a0f ; (negaccu + 0)
+1f82 : 24 04 __ BIT $04
+1f84 : 10 10 __ BPL $1f96
+1f86 : 20 1d 1a JSR $1a1d ; (negtmp + 0)
+1f89 : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1f8c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f8f : 24 04 __ BIT $04
+1f91 : 10 f6 __ BPL $1f89
+1f93 : 20 1d 1a JSR $1a1d ; (negtmp + 0)
+1f96 : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1f99 : 20 0f 1a JSR $1a0f ; (negaccu + 0)
+1f9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1f9f : b1 19 __ LDA (IP + 0),y
+1fa1 : aa __ __ TAX
+1fa2 : b5 00 __ LDA $00,x
+1fa4 : 85 03 __ STA $03
+1fa6 : b5 01 __ LDA $01,x
+1fa8 : 85 04 __ STA $04
+1faa : 24 1c __ BIT ACCU + 1
+1fac : 10 18 __ BPL $1fc6
+1fae : 20 0f 1a JSR $1a0f ; (negaccu + 0)
+1fb1 : 24 04 __ BIT $04
+1fb3 : 10 18 __ BPL $1fcd
+1fb5 : 20 1d 1a JSR $1a1d ; (negtmp + 0)
+1fb8 : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1fbb : a5 05 __ LDA $05
+1fbd : 85 1b __ STA ACCU + 0
+1fbf : a5 06 __ LDA $06
+1fc1 : 85 1c __ STA ACCU + 1
+1fc3 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fc6 : 24 04 __ BIT $04
+1fc8 : 10 ee __ BPL $1fb8
+1fca : 20 1d 1a JSR $1a1d ; (negtmp + 0)
+1fcd : 20 2b 1a JSR $1a2b ; (divmod + 0)
+1fd0 : a5 05 __ LDA $05
+1fd2 : 85 1b __ STA ACCU + 0
+1fd4 : a5 06 __ LDA $06
+1fd6 : 85 1c __ STA ACCU + 1
+1fd8 : 20 0f 1a JSR $1a0f ; (negaccu + 0)
+1fdb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1fde : b1 19 __ LDA (IP + 0),y
+1fe0 : aa __ __ TAX
+1fe1 : 18 __ __ CLC
+1fe2 : b5 00 __ LDA $00,x
+1fe4 : 65 1b __ ADC ACCU + 0
+1fe6 : 95 00 __ STA $00,x
+1fe8 : b5 01 __ LDA $01,x
+1fea : 65 1c __ ADC ACCU + 1
+1fec : 95 01 __ STA $01,x
+1fee : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1ff1 : b1 19 __ LDA (IP + 0),y
+1ff3 : c8 __ __ INY
+1ff4 : aa __ __ TAX
+1ff5 : 18 __ __ CLC
+1ff6 : b5 00 __ LDA $00,x
+1ff8 : 71 19 __ ADC (IP + 0),y
+1ffa : c8 __ __ INY
+1ffb : 95 00 __ STA $00,x
+1ffd : b5 01 __ LDA $01,x
+1fff : 71 19 __ ADC (IP + 0),y
+2001 : 95 01 __ STA $01,x
+2003 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+2006 : b1 19 __ LDA (IP + 0),y
+2008 : c8 __ __ INY
+2009 : aa __ __ TAX
+200a : 38 __ __ SEC
+200b : b1 19 __ LDA (IP + 0),y
+200d : c8 __ __ INY
+200e : f5 00 __ SBC $00,x
+2010 : 95 00 __ STA $00,x
+2012 : b1 19 __ LDA (IP + 0),y
+2014 : f5 01 __ SBC $01,x
+2016 : 95 01 __ STA $01,x
+2018 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+201b : b1 19 __ LDA (IP + 0),y
+201d : c8 __ __ INY
+201e : aa __ __ TAX
+201f : b5 00 __ LDA $00,x
+2021 : 31 19 __ AND (IP + 0),y
+2023 : c8 __ __ INY
+2024 : 95 00 __ STA $00,x
+2026 : b5 01 __ LDA $01,x
+2028 : 31 19 __ AND (IP + 0),y
+202a : 95 01 __ STA $01,x
+202c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+202f : b1 19 __ LDA (IP + 0),y
+2031 : c8 __ __ INY
+2032 : aa __ __ TAX
+2033 : a9 00 __ LDA #$00
+2035 : 85 05 __ STA $05
+2037 : 85 06 __ STA $06
+2039 : b5 00 __ LDA $00,x
+203b : 85 03 __ STA $03
+203d : b5 01 __ LDA $01,x
+203f : 85 04 __ STA $04
+2041 : b1 19 __ LDA (IP + 0),y
+2043 : 4a __ __ LSR
+2044 : 85 07 __ STA $07
+2046 : 90 0d __ BCC $2055
+2048 : 18 __ __ CLC
+2049 : a5 05 __ LDA $05
+204b : 65 03 __ ADC $03
+204d : 85 05 __ STA $05
+204f : a5 06 __ LDA $06
+2051 : 65 04 __ ADC $04
+2053 : 85 06 __ STA $06
+2055 : 06 03 __ ASL $03
+2057 : 26 04 __ ROL $04
+2059 : 46 07 __ LSR $07
+205b : b0 eb __ BCS $2048
+205d : d0 f6 __ BNE $2055
+205f : a5 05 __ LDA $05
+2061 : 95 00 __ STA $00,x
+2063 : a5 06 __ LDA $06
+2065 : 95 01 __ STA $01,x
+2067 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+206a : b1 19 __ LDA (IP + 0),y
+206c : c8 __ __ INY
+206d : aa __ __ TAX
+206e : 18 __ __ CLC
+206f : b5 00 __ LDA $00,x
+2071 : 71 19 __ ADC (IP + 0),y
+2073 : 95 00 __ STA $00,x
+2075 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+2078 : b1 19 __ LDA (IP + 0),y
+207a : aa __ __ TAX
+207b : 38 __ __ SEC
+207c : b5 01 __ LDA $01,x
+207e : e5 1c __ SBC ACCU + 1
+2080 : f0 11 __ BEQ $2093
+2082 : 50 02 __ BVC $2086
+2084 : 49 80 __ EOR #$80
+2086 : 30 2a __ BMI $20b2
+2088 : 10 33 __ BPL $20bd
+208a : b1 19 __ LDA (IP + 0),y
+208c : aa __ __ TAX
+208d : b5 01 __ LDA $01,x
+208f : c5 1c __ CMP ACCU + 1
+2091 : d0 28 __ BNE $20bb
+2093 : b5 00 __ LDA $00,x
+2095 : c5 1b __ CMP ACCU + 0
+2097 : d0 22 __ BNE $20bb
+2099 : f0 0e __ BEQ $20a9
+209b : b1 19 __ LDA (IP + 0),y
+209d : aa __ __ TAX
+209e : c8 __ __ INY
+209f : b1 19 __ LDA (IP + 0),y
+20a1 : c5 1c __ CMP ACCU + 1
+20a3 : d0 16 __ BNE $20bb
+20a5 : e4 1b __ CPX ACCU + 0
+20a7 : d0 12 __ BNE $20bb
+20a9 : a9 00 __ LDA #$00
+20ab : 85 1b __ STA ACCU + 0
+20ad : 85 1c __ STA ACCU + 1
+20af : 4c 50 08 JMP $0850 ; (startup + 79)
+20b2 : a9 ff __ LDA #$ff
+20b4 : 85 1b __ STA ACCU + 0
+20b6 : 85 1c __ STA ACCU + 1
+20b8 : 4c 50 08 JMP $0850 ; (startup + 79)
+20bb : 90 f5 __ BCC $20b2
+20bd : a9 01 __ LDA #$01
+20bf : 85 1b __ STA ACCU + 0
+20c1 : a9 00 __ LDA #$00
+20c3 : 85 1c __ STA ACCU + 1
+20c5 : 4c 50 08 JMP $0850 ; (startup + 79)
+20c8 : b1 19 __ LDA (IP + 0),y
+20ca : c8 __ __ INY
+20cb : aa __ __ TAX
+20cc : b1 19 __ LDA (IP + 0),y
+20ce : 38 __ __ SEC
+20cf : e5 1c __ SBC ACCU + 1
+20d1 : d0 af __ BNE $2082
+20d3 : e4 1b __ CPX ACCU + 0
+20d5 : d0 e4 __ BNE $20bb
+20d7 : f0 d0 __ BEQ $20a9
+20d9 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+20da : b1 19 __ LDA (IP + 0),y
+20dc : aa __ __ TAX
+20dd : 38 __ __ SEC
+20de : b5 00 __ LDA $00,x
+20e0 : e5 1b __ SBC ACCU + 0
+20e2 : f0 19 __ BEQ $20fd
+20e4 : 50 02 __ BVC $20e8
+20e6 : 49 80 __ EOR #$80
+20e8 : 30 1c __ BMI $2106
+20ea : 10 25 __ BPL $2111
+20ec : b1 19 __ LDA (IP + 0),y
+20ee : aa __ __ TAX
+20ef : b5 00 __ LDA $00,x
+20f1 : c5 1b __ CMP ACCU + 0
+20f3 : d0 1a __ BNE $210f
+20f5 : f0 06 __ BEQ $20fd
+20f7 : b1 19 __ LDA (IP + 0),y
+20f9 : c5 1b __ CMP ACCU + 0
+20fb : d0 12 __ BNE $210f
+20fd : a9 00 __ LDA #$00
+20ff : 85 1b __ STA ACCU + 0
+2101 : 85 1c __ STA ACCU + 1
+2103 : 4c 50 08 JMP $0850 ; (startup + 79)
+2106 : a9 ff __ LDA #$ff
+2108 : 85 1b __ STA ACCU + 0
+210a : 85 1c __ STA ACCU + 1
+210c : 4c 50 08 JMP $0850 ; (startup + 79)
+210f : 90 f5 __ BCC $2106
+2111 : a9 01 __ LDA #$01
+2113 : 85 1b __ STA ACCU + 0
+2115 : a9 00 __ LDA #$00
+2117 : 85 1c __ STA ACCU + 1
+2119 : 4c 50 08 JMP $0850 ; (startup + 79)
+211c : b1 19 __ LDA (IP + 0),y
+211e : 38 __ __ SEC
+211f : e5 1b __ SBC ACCU + 0
+2121 : d0 c1 __ BNE $20e4
+2123 : f0 d8 __ BEQ $20fd
+2125 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+2126 : 38 __ __ SEC
+2127 : a9 00 __ LDA #$00
+2129 : e5 1b __ SBC ACCU + 0
+212b : 85 1b __ STA ACCU + 0
+212d : a9 00 __ LDA #$00
+212f : e5 1c __ SBC ACCU + 1
+2131 : 85 1c __ STA ACCU + 1
+2133 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+2136 : 20 e6 17 JSR $17e6 ; (freg + 0)
+2139 : 20 2b 18 JSR $182b ; (faddsub + 0)
+213c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+213f : 20 e6 17 JSR $17e6 ; (freg + 0)
+2142 : a5 06 __ LDA $06
+2144 : 49 80 __ EOR #$80
+2146 : 85 06 __ STA $06
+2148 : 20 2b 18 JSR $182b ; (faddsub + 0)
+214b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+214e : 20 e6 17 JSR $17e6 ; (freg + 0)
+2151 : 84 02 __ STY $02
+2153 : 20 f3 18 JSR $18f3 ; (fmul + 0)
+2156 : a4 02 __ LDY $02
+2158 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+215b : 20 e6 17 JSR $17e6 ; (freg + 0)
+215e : 20 91 19 JSR $1991 ; (fdiv + 0)
+2161 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+2164 : b1 19 __ LDA (IP + 0),y
+2166 : c8 __ __ INY
+2167 : aa __ __ TAX
+2168 : a5 1e __ LDA ACCU + 3
+216a : 55 03 __ EOR $03,x
+216c : 29 80 __ AND #$80
+216e : f0 1e __ BEQ $218e
+2170 : a5 1e __ LDA ACCU + 3
+2172 : 29 7f __ AND #$7f
+2174 : 05 1d __ ORA ACCU + 2
+2176 : 05 1c __ ORA ACCU + 1
+2178 : 05 1b __ ORA ACCU + 0
+217a : d0 0c __ BNE $2188
+217c : b5 03 __ LDA $03,x
+217e : 29 7f __ AND #$7f
+2180 : 15 02 __ ORA $02,x
+2182 : 15 01 __ ORA $01,x
+2184 : 15 00 __ ORA $00,x
+2186 : f0 1e __ BEQ $21a6
+2188 : a5 1e __ LDA ACCU + 3
+218a : 30 29 __ BMI $21b5
+218c : 10 36 __ BPL $21c4
+218e : a5 1e __ LDA ACCU + 3
+2190 : d5 03 __ CMP $03,x
+2192 : d0 1b __ BNE $21af
+2194 : a5 1d __ LDA ACCU + 2
+2196 : d5 02 __ CMP $02,x
+2198 : d0 15 __ BNE $21af
+219a : a5 1c __ LDA ACCU + 1
+219c : d5 01 __ CMP $01,x
+219e : d0 0f __ BNE $21af
+21a0 : a5 1b __ LDA ACCU + 0
+21a2 : d5 00 __ CMP $00,x
+21a4 : d0 09 __ BNE $21af
+21a6 : a9 00 __ LDA #$00
+21a8 : 85 1b __ STA ACCU + 0
+21aa : 85 1c __ STA ACCU + 1
+21ac : 4c 51 08 JMP $0851 ; (startup + 80)
+21af : b0 0f __ BCS $21c0
+21b1 : 24 1e __ BIT ACCU + 3
+21b3 : 30 0f __ BMI $21c4
+21b5 : a9 00 __ LDA #$00
+21b7 : 85 1c __ STA ACCU + 1
+21b9 : a9 01 __ LDA #$01
+21bb : 85 1b __ STA ACCU + 0
+21bd : 4c 51 08 JMP $0851 ; (startup + 80)
+21c0 : 24 1e __ BIT ACCU + 3
+21c2 : 30 f1 __ BMI $21b5
+21c4 : a9 ff __ LDA #$ff
+21c6 : 85 1b __ STA ACCU + 0
+21c8 : 85 1c __ STA ACCU + 1
+21ca : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+21cd : a5 1e __ LDA ACCU + 3
+21cf : 49 80 __ EOR #$80
+21d1 : 85 1e __ STA ACCU + 3
+21d3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+21d6 : 20 f2 1a JSR $1af2 ; (sint16_to_float + 0)
+21d9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+21dc : 20 b0 1a JSR $1ab0 ; (f32_to_i16 + 0)
+21df : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+21e2 : b1 19 __ LDA (IP + 0),y
+21e4 : 30 0c __ BMI $21f2
+21e6 : 38 __ __ SEC
+21e7 : 65 19 __ ADC IP + 0
+21e9 : 85 19 __ STA IP + 0
+21eb : 90 02 __ BCC $21ef
+21ed : e6 1a __ INC IP + 1
+21ef : 4c 51 08 JMP $0851 ; (startup + 80)
+21f2 : 38 __ __ SEC
+21f3 : 65 19 __ ADC IP + 0
+21f5 : 85 19 __ STA IP + 0
+21f7 : b0 02 __ BCS $21fb
+21f9 : c6 1a __ DEC IP + 1
+21fb : 4c 51 08 JMP $0851 ; (startup + 80)
+21fe : a5 1b __ LDA ACCU + 0
+2200 : 05 1c __ ORA ACCU + 1
+2202 : f0 de __ BEQ $21e2
+2204 : 4c 50 08 JMP $0850 ; (startup + 79)
+2207 : a5 1b __ LDA ACCU + 0
+2209 : 05 1c __ ORA ACCU + 1
+220b : d0 d5 __ BNE $21e2
+220d : 4c 50 08 JMP $0850 ; (startup + 79)
+2210 : a5 1c __ LDA ACCU + 1
+2212 : 30 04 __ BMI $2218
+2214 : 05 1b __ ORA ACCU + 0
+2216 : d0 ca __ BNE $21e2
+2218 : 4c 50 08 JMP $0850 ; (startup + 79)
+221b : a5 1c __ LDA ACCU + 1
+221d : 10 c3 __ BPL $21e2
+221f : 4c 50 08 JMP $0850 ; (startup + 79)
+2222 : a5 1c __ LDA ACCU + 1
+2224 : 30 bc __ BMI $21e2
+2226 : 4c 50 08 JMP $0850 ; (startup + 79)
+2229 : a5 1c __ LDA ACCU + 1
+222b : 30 b5 __ BMI $21e2
+222d : 05 1b __ ORA ACCU + 0
+222f : f0 b1 __ BEQ $21e2
+2231 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2234 : 38 __ __ SEC
+2235 : b1 19 __ LDA (IP + 0),y
+2237 : 65 19 __ ADC IP + 0
+2239 : aa __ __ TAX
+223a : c8 __ __ INY
+223b : b1 19 __ LDA (IP + 0),y
+223d : 65 1a __ ADC IP + 1
+223f : 85 1a __ STA IP + 1
+2241 : 86 19 __ STX IP + 0
+2243 : 4c 51 08 JMP $0851 ; (startup + 80)
+2246 : a5 1b __ LDA ACCU + 0
+2248 : 05 1c __ ORA ACCU + 1
+224a : f0 e8 __ BEQ $2234
+224c : c8 __ __ INY
+224d : 4c 50 08 JMP $0850 ; (startup + 79)
+2250 : a5 1b __ LDA ACCU + 0
+2252 : 05 1c __ ORA ACCU + 1
+2254 : d0 de __ BNE $2234
+2256 : c8 __ __ INY
+2257 : 4c 50 08 JMP $0850 ; (startup + 79)
+225a : a5 1c __ LDA ACCU + 1
+225c : 30 04 __ BMI $2262
+225e : 05 1b __ ORA ACCU + 0
+2260 : d0 d2 __ BNE $2234
+2262 : c8 __ __ INY
+2263 : 4c 50 08 JMP $0850 ; (startup + 79)
+2266 : a5 1c __ LDA ACCU + 1
+2268 : 10 ca __ BPL $2234
+226a : c8 __ __ INY
+226b : 4c 50 08 JMP $0850 ; (startup + 79)
+226e : a5 1c __ LDA ACCU + 1
+2270 : 30 c2 __ BMI $2234
+2272 : c8 __ __ INY
+2273 : 4c 50 08 JMP $0850 ; (startup + 79)
+2276 : a5 1c __ LDA ACCU + 1
+2278 : 30 ba __ BMI $2234
+227a : 05 1b __ ORA ACCU + 0
+227c : f0 b6 __ BEQ $2234
+227e : c8 __ __ INY
+227f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2282 : a9 00 __ LDA #$00
+2284 : 2c a9 01 BIT $01a9 
+2287 : 85 1b __ STA ACCU + 0
+2289 : a9 00 __ LDA #$00
+228b : 85 1c __ STA ACCU + 1
+228d : 4c 51 08 JMP $0851 ; (startup + 80)
+2290 : a5 1b __ LDA ACCU + 0
+2292 : 05 1c __ ORA ACCU + 1
+2294 : f0 ef __ BEQ $2285
+2296 : d0 ea __ BNE $2282
+2298 : a5 1b __ LDA ACCU + 0
+229a : 05 1c __ ORA ACCU + 1
+229c : d0 e7 __ BNE $2285
+229e : f0 e2 __ BEQ $2282
+22a0 : a5 1c __ LDA ACCU + 1
+22a2 : 30 de __ BMI $2282
+22a4 : 05 1b __ ORA ACCU + 0
+22a6 : d0 dd __ BNE $2285
+22a8 : f0 d8 __ BEQ $2282
+22aa : a5 1c __ LDA ACCU + 1
+22ac : 10 d7 __ BPL $2285
+22ae : 30 d2 __ BMI $2282
+22b0 : a5 1c __ LDA ACCU + 1
+22b2 : 30 d1 __ BMI $2285
+22b4 : 10 cc __ BPL $2282
+22b6 : a5 1c __ LDA ACCU + 1
+22b8 : 30 cb __ BMI $2285
+22ba : 05 1b __ ORA ACCU + 0
+22bc : f0 c7 __ BEQ $2285
+22be : d0 c2 __ BNE $2282
+22c0 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+22c1 : b1 19 __ LDA (IP + 0),y
+22c3 : 8d d7 22 STA $22d7 ; (inp_jsr + 22)
+22c6 : c8 __ __ INY
+22c7 : b1 19 __ LDA (IP + 0),y
+22c9 : 8d d8 22 STA $22d8 ; (inp_jsr + 23)
+22cc : 98 __ __ TYA
+22cd : 38 __ __ SEC
+22ce : 65 19 __ ADC IP + 0
+22d0 : 85 19 __ STA IP + 0
+22d2 : 90 02 __ BCC $22d6
+22d4 : e6 1a __ INC IP + 1
+22d6 : 20 00 00 JSR $0000 
+22d9 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+22dc : 98 __ __ TYA
+22dd : 18 __ __ CLC
+22de : 65 19 __ ADC IP + 0
+22e0 : 8d eb 22 STA $22eb ; (inp_native + 15)
+22e3 : a5 1a __ LDA IP + 1
+22e5 : 69 00 __ ADC #$00
+22e7 : 8d ec 22 STA $22ec ; (inp_native + 16)
+22ea : 20 00 00 JSR $0000 
+22ed : a0 00 __ LDY #$00
+22ef : b1 23 __ LDA (SP + 0),y
+22f1 : 85 19 __ STA IP + 0
+22f3 : c8 __ __ INY
+22f4 : b1 23 __ LDA (SP + 0),y
+22f6 : 85 1a __ STA IP + 1
+22f8 : 88 __ __ DEY
+22f9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+22fc : 38 __ __ SEC
+22fd : a5 23 __ LDA SP + 0
+22ff : f1 19 __ SBC (IP + 0),y
+2301 : c8 __ __ INY
+2302 : 85 23 __ STA SP + 0
+2304 : a5 24 __ LDA SP + 1
+2306 : f1 19 __ SBC (IP + 0),y
+2308 : c8 __ __ INY
+2309 : 85 24 __ STA SP + 1
+230b : b1 19 __ LDA (IP + 0),y
+230d : 84 02 __ STY $02
+230f : a8 __ __ TAY
+2310 : a5 25 __ LDA FP + 0
+2312 : 91 23 __ STA (SP + 0),y
+2314 : c8 __ __ INY
+2315 : a5 26 __ LDA FP + 1
+2317 : 91 23 __ STA (SP + 0),y
+2319 : 98 __ __ TYA
+231a : 38 __ __ SEC
+231b : 65 23 __ ADC SP + 0
+231d : 85 25 __ STA FP + 0
+231f : a9 00 __ LDA #$00
+2321 : 65 24 __ ADC SP + 1
+2323 : 85 26 __ STA FP + 1
+2325 : 88 __ __ DEY
+2326 : f0 08 __ BEQ $2330
+2328 : b9 52 00 LDA $0052,y 
+232b : 88 __ __ DEY
+232c : 91 23 __ STA (SP + 0),y
+232e : d0 f8 __ BNE $2328
+2330 : a4 02 __ LDY $02
+2332 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2335 : b1 19 __ LDA (IP + 0),y
+2337 : c8 __ __ INY
+2338 : 84 02 __ STY $02
+233a : a8 __ __ TAY
+233b : b1 23 __ LDA (SP + 0),y
+233d : 85 25 __ STA FP + 0
+233f : c8 __ __ INY
+2340 : b1 23 __ LDA (SP + 0),y
+2342 : 85 26 __ STA FP + 1
+2344 : 88 __ __ DEY
+2345 : f0 09 __ BEQ $2350
+2347 : 88 __ __ DEY
+2348 : b1 23 __ LDA (SP + 0),y
+234a : 99 53 00 STA $0053,y 
+234d : 88 __ __ DEY
+234e : 10 f8 __ BPL $2348
+2350 : a4 02 __ LDY $02
+2352 : 18 __ __ CLC
+2353 : b1 19 __ LDA (IP + 0),y
+2355 : c8 __ __ INY
+2356 : 65 23 __ ADC SP + 0
+2358 : 85 23 __ STA SP + 0
+235a : b1 19 __ LDA (IP + 0),y
+235c : c8 __ __ INY
+235d : 65 24 __ ADC SP + 1
+235f : 85 24 __ STA SP + 1
+2361 : a0 01 __ LDY #$01
+2363 : b1 23 __ LDA (SP + 0),y
+2365 : 85 1a __ STA IP + 1
+2367 : 88 __ __ DEY
+2368 : b1 23 __ LDA (SP + 0),y
+236a : 85 19 __ STA IP + 0
+236c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+236f : b1 19 __ LDA (IP + 0),y
+2371 : 85 1f __ STA ADDR + 0
+2373 : c8 __ __ INY
+2374 : b1 19 __ LDA (IP + 0),y
+2376 : 85 20 __ STA ADDR + 1
+2378 : c8 __ __ INY
+2379 : 98 __ __ TYA
+237a : a0 00 __ LDY #$00
+237c : 18 __ __ CLC
+237d : 65 19 __ ADC IP + 0
+237f : 91 23 __ STA (SP + 0),y
+2381 : c8 __ __ INY
+2382 : a5 1a __ LDA IP + 1
+2384 : 69 00 __ ADC #$00
+2386 : 91 23 __ STA (SP + 0),y
+2388 : a5 1f __ LDA ADDR + 0
+238a : 85 19 __ STA IP + 0
+238c : a5 20 __ LDA ADDR + 1
+238e : 85 1a __ STA IP + 1
+2390 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2393 : 38 __ __ SEC
+2394 : a5 23 __ LDA SP + 0
+2396 : f1 19 __ SBC (IP + 0),y
+2398 : c8 __ __ INY
+2399 : 85 23 __ STA SP + 0
+239b : a5 24 __ LDA SP + 1
+239d : f1 19 __ SBC (IP + 0),y
+239f : 85 24 __ STA SP + 1
+23a1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+23a4 : 18 __ __ CLC
+23a5 : b1 19 __ LDA (IP + 0),y
+23a7 : c8 __ __ INY
+23a8 : 65 23 __ ADC SP + 0
+23aa : 85 23 __ STA SP + 0
+23ac : b1 19 __ LDA (IP + 0),y
+23ae : 65 24 __ ADC SP + 1
+23b0 : 85 24 __ STA SP + 1
+23b2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+23b5 : b1 19 __ LDA (IP + 0),y
+23b7 : c8 __ __ INY
+23b8 : 8d c6 23 STA $23c6 ; (inp_op_extrt + 17)
+23bb : b1 19 __ LDA (IP + 0),y
+23bd : c8 __ __ INY
+23be : 8d c7 23 STA $23c7 ; (inp_op_extrt + 18)
+23c1 : b1 19 __ LDA (IP + 0),y
+23c3 : c8 __ __ INY
+23c4 : aa __ __ TAX
+23c5 : 20 00 00 JSR $0000 
+23c8 : 4c 51 08 JMP $0851 ; (startup + 80)
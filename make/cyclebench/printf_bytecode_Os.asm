@@ -0,0 +1,3203 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 8b 23 STX $238b ; (spentry + 0)
+0811 : a9 8d __ LDA #$8d
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 f1 __ LDA #$f1
+0832 : e9 8d __ SBC #$8d
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	LEA	T2, buffer + 0
+0a11:	MOV	2(SP), T2
+0a14:	LEA	T3, $16f5
+0a18:	MOV	4(SP), T3
+0a1b:	MOV	ACCU, #$014b
+0a1f:	MUL	ACCU, T1
+0a21:	ADD	ACCU, #$C180
+0a25:	MOV	6(SP), ACCU
+0a28:	MOV	ACCU, #$0269
+0a2c:	MUL	ACCU, T1
+0a2e:	MOV	8(SP), ACCU
+0a31:	MOV	ACCU, T1
+0a33:	MUL	ACCU, #97
+0a36:	MOV	10(SP), ACCU
+0a39:	MOV	12(SP), T1
+0a3c:	MOV	ACCU, T1
+0a3e:	NEG	ACCU
+0a3f:	MOV	14(SP), ACCU
+0a42:	LEA	T3, $170a
+0a46:	MOV	16(SP), T3
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	ACCU, T2
+0a4e:	MOV	P0, ACCU
+0a50:	JSR	strlen + 0
+0a53:	ADD	T0, ACCU
+0a55:	MOVUB	ACCU, buffer + 0
+0a59:	BNEF	$0AEB
+0a5c:	ADD	T1, #$0001
+0a60:	MOV	ACCU, T1
+0a62:	CMPS	ACCU, #$0064
+0a65:	BGT	$0A0D
+0a67:	MOV	T1, #0
+0a6a:	LEA	T2, $1740
+0a6e:	LEA	T3, buffer + 0
+0a72:	MOV	2(SP), T3
+0a75:	MOV	4(SP), T2
+0a78:	MOV	ACCU, T1
+0a7a:	CNVSF	ACCU
+0a7b:	MOVD	T6, ACCU
+0a7d:	MOVD	$03, #$3fa00000
+0a83:	MULF	ACCU, $03
+0a85:	MOVD	6(SP), ACCU
+0a88:	MOVD	ACCU, T6
+0a8a:	MOVD	$03, #$bd800000
+0a90:	MULF	ACCU, $03
+0a92:	MOVD	10(SP), ACCU
+0a95:	CALL	sprintf + 0
+0a98:	MOV	ACCU, T3
+0a9a:	MOV	P0, ACCU
+0a9c:	JSR	strlen + 0
+0a9f:	ADD	T1, #$0001
+0aa3:	ADD	T0, ACCU
+0aa5:	MOV	ACCU, T1
+0aa7:	CMPS	ACCU, #$0014
+0aaa:	BGT	$0A72
+0aac:	MOV	2(SP), T3
+0aaf:	LEA	T1, $1749
+0ab3:	MOV	4(SP), T1
+0ab6:	MOV	ACCU, #-123
+0ab9:	MOV	6(SP), ACCU
+0abc:	LEA	T1, $1752
+0ac0:	MOV	8(SP), T1
+0ac3:	MOV	ACCU, #$beef
+0ac7:	MOV	10(SP), ACCU
+0aca:	CALL	sprintf + 0
+0acd:	MOV	ACCU, T3
+0acf:	MOV	P0, ACCU
+0ad1:	LEA	P2, $1786
+0ad5:	JSR	strcmp + 0
+0ad8:	BNE	$0AE1
+0ada:	MOV	ACCU, T0
+0adc:	SEQ
+0add:	MOVB	T4, ACCU
+0adf:	JUMP	$0AE4
+0ae1:	MOV	ACCU, #1
+0ae4:	POP	#$0012
+0ae7:	RETURN	8, 10
+0aeb:	MOV	T2, #0
+0aee:	LEAX	ADDR, buffer + 0 + T2
+0af2:	MOVB	T4, 0(ADDR)
+0af5:	LEAX	ADDR, buffer + 1 + T2
+0af9:	MOVB	ACCU, T4
+0afb:	ADD	T0, ACCU
+0afd:	MOVUB	ACCU, 0(ADDR)
+0b00:	ADD	T2, #$0001
+0b04:	BNE	$0AEE
+0b06:	JUMPF	$0A5C
+--------------------------------------------------------------------
+sprintf:
+0b09:	ENTER	0, 2
+0b0d:	PUSH	#$0009
+0b10:	MOV	T0, 2(FP)
+0b13:	MOV	2(SP), T0
+0b16:	MOV	T0, 4(FP)
+0b19:	MOV	4(SP), T0
+0b1c:	LEA	T0, 6(FP)
+0b20:	MOV	6(SP), T0
+0b23:	MOV	ACCU, #0
+0b26:	MOVB	8(SP), ACCU
+0b29:	CALL	sformat + 0
+0b2c:	MOV	T1, 2(FP)
+0b2f:	SUB	ACCU, T1
+0b31:	POP	#$0009
+0b34:	RETURN	0, 2
+--------------------------------------------------------------------
+sformat:
+0b38:	ENTER	10, 20
+0b3c:	PUSH	#$0002
+0b3f:	MOV	T0, 10(FP)
+0b42:	MOVB	T1, #0
+0b45:	MOV	T2, 12(FP)
+0b48:	MOV	ADDR, T2
+0b4a:	MOVB	T3, 0(ADDR)
+0b4d:	MOVB	ACCU, T3
+0b4f:	BNE	$0B80
+0b51:	MOVB	ACCU, T1
+0b53:	ADD	ACCU, T0
+0b55:	MOV	T2, ACCU
+0b57:	MOV	ACCU, #0
+0b5a:	MOV	ADDR, T2
+0b5c:	MOVB	0(ADDR), ACCU
+0b5f:	MOVB	ACCU, T1
+0b61:	BNE	$0B6C
+0b63:	MOV	ACCU, T0
+0b65:	POP	#$0002
+0b68:	RETURN	10, 20
+0b6c:	MOVUB	ACCU, 16(FP)
+0b6f:	BNE	$0B75
+0b71:	MOV	ACCU, T2
+0b73:	JUMP	$0B65
+0b75:	MOV	ACCU, T0
+0b77:	MOV	P0, ACCU
+0b79:	CALL	puts + 0
+0b7c:	MOV	ACCU, T0
+0b7e:	JUMP	$0B65
+0b80:	ADD	T2, #$0001
+0b84:	MOVB	ACCU, T3
+0b86:	CMPUB	ACCU, #$0025
+0b88:	BEQ	$0BE7
+0b8a:	MOVB	ACCU, T1
+0b8c:	LEAX	ADDR, T0 + ACCU
+0b8e:	MOVB	0(ADDR), T3
+0b91:	ADDB	T1, #$0001
+0b94:	MOVB	ACCU, T1
+0b96:	CMPUB	ACCU, #$0028
+0b98:	BLE	$0BAB
+0b9a:	MOV	ADDR, T2
+0b9c:	MOVB	T4, 0(ADDR)
+0b9f:	ADD	T2, #$0001
+0ba3:	MOVB	ACCU, T4
+0ba5:	MOVB	T3, ACCU
+0ba7:	BNE	$0B84
+0ba9:	JUMP	$0B51
+0bab:	MOVB	ACCU, T1
+0bad:	MOV	T5, ACCU
+0baf:	MOVUB	ACCU, 16(FP)
+0bb2:	BNE	$0BC6
+0bb4:	MOV	ACCU, T5
+0bb6:	ADD	T0, ACCU
+0bb8:	MOVB	T1, #0
+0bbb:	MOV	ADDR, T2
+0bbd:	MOVB	T4, 0(ADDR)
+0bc0:	ADD	T2, #$0001
+0bc4:	JUMP	$0BA3
+0bc6:	MOV	ACCU, T0
+0bc8:	ADD	T5, ACCU
+0bca:	MOV	ADDR, T5
+0bcc:	MOV	ACCU, #0
+0bcf:	MOVB	0(ADDR), ACCU
+0bd2:	MOV	ACCU, T0
+0bd4:	MOV	P0, ACCU
+0bd6:	CALL	puts + 0
+0bd9:	MOVB	T1, #0
+0bdc:	MOV	ADDR, T2
+0bde:	MOVB	T4, 0(ADDR)
+0be1:	ADD	T2, #$0001
+0be5:	JUMP	$0BA3
+0be7:	MOVB	ACCU, T1
+0be9:	BNEF	$11D4
+0bec:	MOV	ADDR, T2
+0bee:	MOVB	T3, 0(ADDR)
+0bf1:	MOV	ACCU, #10
+0bf4:	MOV	3(FP), ACCU
+0bf7:	MOV	ACCU, #1
+0bfa:	MOVB	1(FP), ACCU
+0bfd:	MOV	ACCU, #255
+0c00:	MOVB	2(FP), ACCU
+0c03:	MOV	ACCU, #32
+0c06:	MOVB	0(FP), ACCU
+0c09:	MOV	ACCU, #0
+0c0c:	MOVB	5(FP), ACCU
+0c0f:	MOVB	6(FP), ACCU
+0c12:	MOVB	7(FP), ACCU
+0c15:	ADD	T2, #$0001
+0c19:	MOVB	ACCU, T3
+0c1b:	CMPUB	ACCU, #$002B
+0c1d:	BEQF	$11C6
+0c20:	MOVB	ACCU, T3
+0c22:	CMPUB	ACCU, #$0030
+0c24:	BEQF	$11B8
+0c27:	MOVB	ACCU, T3
+0c29:	CMPUB	ACCU, #$0023
+0c2b:	BEQF	$11AA
+0c2e:	MOVB	ACCU, T3
+0c30:	CMPUB	ACCU, #$0030
+0c32:	BGT	$0C3B
+0c34:	MOVB	ACCU, T3
+0c36:	CMPUB	ACCU, #$0039
+0c38:	BGEF	$1179
+0c3b:	MOVB	ACCU, T3
+0c3d:	CMPUB	ACCU, #$002E
+0c3f:	BEQF	$113F
+0c42:	MOVB	ACCU, T3
+0c44:	CMPUB	ACCU, #$0064
+0c46:	BEQF	$1003
+0c49:	MOVB	ACCU, T3
+0c4b:	CMPUB	ACCU, #$0075
+0c4d:	BEQF	$0EFE
+0c50:	MOVB	ACCU, T3
+0c52:	CMPUB	ACCU, #$0078
+0c54:	BEQF	$0DE7
+0c57:	MOVB	ACCU, T3
+0c59:	CMPUB	ACCU, #$006C
+0c5b:	BEQF	$0D4D
+0c5e:	MOVB	ACCU, T3
+0c60:	CMPUB	ACCU, #$0066
+0c62:	BEQF	$0D13
+0c65:	MOVB	ACCU, T3
+0c67:	CMPUB	ACCU, #$0067
+0c69:	BEQF	$0D13
+0c6c:	MOVB	ACCU, T3
+0c6e:	CMPUB	ACCU, #$0065
+0c70:	BEQF	$0D13
+0c73:	MOVB	ACCU, T3
+0c75:	CMPUB	ACCU, #$0073
+0c77:	BEQ	$0CC1
+0c79:	MOVB	ACCU, T3
+0c7b:	CMPUB	ACCU, #$0063
+0c7d:	BEQ	$0C9A
+0c7f:	MOVB	ACCU, T3
+0c81:	BEQF	$0B9A
+0c84:	MOVB	ACCU, T1
+0c86:	LEAX	ADDR, T0 + ACCU
+0c88:	MOVB	0(ADDR), T3
+0c8b:	ADDB	T1, #$0001
+0c8e:	MOV	ADDR, T2
+0c90:	MOVB	T4, 0(ADDR)
+0c93:	ADD	T2, #$0001
+0c97:	JUMPF	$0BA3
+0c9a:	MOV	T5, 14(FP)
+0c9d:	MOV	ACCU, T5
+0c9f:	MOV	ADDR, T5
+0ca1:	MOV	T5, 0(ADDR)
+0ca4:	ADD	ACCU, #$0002
+0ca8:	MOV	14(FP), ACCU
+0cab:	MOVB	ACCU, T1
+0cad:	LEAX	ADDR, T0 + ACCU
+0caf:	MOVB	0(ADDR), T5
+0cb2:	ADDB	T1, #$0001
+0cb5:	MOV	ADDR, T2
+0cb7:	MOVB	T4, 0(ADDR)
+0cba:	ADD	T2, #$0001
+0cbe:	JUMPF	$0BA3
+0cc1:	MOV	T5, 14(FP)
+0cc4:	MOV	ACCU, T5
+0cc6:	MOV	ADDR, T5
+0cc8:	MOV	T5, 0(ADDR)
+0ccb:	ADD	ACCU, #$0002
+0ccf:	MOV	14(FP), ACCU
+0cd2:	MOVUB	ACCU, 16(FP)
+0cd5:	BNE	$0D00
+0cd7:	MOV	ADDR, T5
+0cd9:	MOVB	T3, 0(ADDR)
+0cdc:	MOVB	ACCU, T3
+0cde:	BEQF	$0B9A
+0ce1:	ADD	T5, #$0001
+0ce5:	MOV	ADDR, T0
+0ce7:	MOVB	0(ADDR), T3
+0cea:	ADD	T0, #$0001
+0cee:	MOV	ADDR, T5
+0cf0:	MOVB	T4, 0(ADDR)
+0cf3:	ADD	T5, #$0001
+0cf7:	MOVB	ACCU, T4
+0cf9:	MOVB	T3, ACCU
+0cfb:	BNE	$0CE5
+0cfd:	JUMPF	$0B9A
+0d00:	MOV	ACCU, T5
+0d02:	MOV	P0, ACCU
+0d04:	CALL	puts + 0
+0d07:	MOV	ADDR, T2
+0d09:	MOVB	T4, 0(ADDR)
+0d0c:	ADD	T2, #$0001
+0d10:	JUMPF	$0BA3
+0d13:	LEA	P0, 0(FP)
+0d17:	MOV	ACCU, T0
+0d19:	MOV	P2, ACCU
+0d1b:	MOV	ADDR, 14(FP)
+0d1e:	MOVD	T10, 0(ADDR)
+0d21:	MOVD	ACCU, T10
+0d23:	MOVD	P4, ACCU
+0d25:	MOVB	ACCU, T3
+0d27:	MOVB	P8, ACCU
+0d29:	CALL	nformf + 0
+0d2c:	MOV	T1, ACCU
+0d2e:	MOV	T5, 14(FP)
+0d31:	MOV	ACCU, T5
+0d33:	ADD	ACCU, #$0002
+0d37:	MOV	14(FP), ACCU
+0d3a:	ADD	T5, #$0004
+0d3e:	MOV	14(FP), T5
+0d41:	MOV	ADDR, T2
+0d43:	MOVB	T4, 0(ADDR)
+0d46:	ADD	T2, #$0001
+0d4a:	JUMPF	$0BA3
+0d4d:	MOV	T5, 14(FP)
+0d50:	MOV	ADDR, T5
+0d52:	MOVD	T10, 0(ADDR)
+0d55:	MOV	ACCU, T5
+0d57:	ADD	ACCU, #$0002
+0d5b:	MOV	14(FP), ACCU
+0d5e:	ADD	T5, #$0004
+0d62:	MOV	14(FP), T5
+0d65:	MOV	ADDR, T2
+0d67:	MOVB	T3, 0(ADDR)
+0d6a:	ADD	T2, #$0001
+0d6e:	MOVB	ACCU, T3
+0d70:	CMPUB	ACCU, #$0064
+0d72:	BEQ	$0DC7
+0d74:	MOVB	ACCU, T3
+0d76:	CMPUB	ACCU, #$0075
+0d78:	BEQ	$0DA7
+0d7a:	MOVB	ACCU, T3
+0d7c:	CMPUB	ACCU, #$0078
+0d7e:	BNEF	$0B9A
+0d81:	MOV	ACCU, #16
+0d84:	MOV	3(FP), ACCU
+0d87:	LEA	P0, 0(FP)
+0d8b:	MOV	ACCU, T0
+0d8d:	MOV	P2, ACCU
+0d8f:	MOVD	ACCU, T10
+0d91:	MOVD	P4, ACCU
+0d93:	MOVB	P8, #0
+0d96:	CALL	nforml + 0
+0d99:	MOV	T1, ACCU
+0d9b:	MOV	ADDR, T2
+0d9d:	MOVB	T4, 0(ADDR)
+0da0:	ADD	T2, #$0001
+0da4:	JUMPF	$0BA3
+0da7:	LEA	P0, 0(FP)
+0dab:	MOV	ACCU, T0
+0dad:	MOV	P2, ACCU
+0daf:	MOVD	ACCU, T10
+0db1:	MOVD	P4, ACCU
+0db3:	MOVB	P8, #0
+0db6:	CALL	nforml + 0
+0db9:	MOV	T1, ACCU
+0dbb:	MOV	ADDR, T2
+0dbd:	MOVB	T4, 0(ADDR)
+0dc0:	ADD	T2, #$0001
+0dc4:	JUMPF	$0BA3
+0dc7:	LEA	P0, 0(FP)
+0dcb:	MOV	ACCU, T0
+0dcd:	MOV	P2, ACCU
+0dcf:	MOVD	ACCU, T10
+0dd1:	MOVD	P4, ACCU
+0dd3:	MOVB	P8, #1
+0dd6:	CALL	nforml + 0
+0dd9:	MOV	T1, ACCU
+0ddb:	MOV	ADDR, T2
+0ddd:	MOVB	T4, 0(ADDR)
+0de0:	ADD	T2, #$0001
+0de4:	JUMPF	$0BA3
+0de7:	MOV	ACCU, #16
+0dea:	MOV	3(FP), ACCU
+0ded:	MOV	T5, 14(FP)
+0df0:	MOV	ACCU, T5
+0df2:	MOV	ADDR, T5
+0df4:	MOV	T5, 0(ADDR)
+0df7:	ADD	ACCU, #$0002
+0dfb:	MOV	14(FP), ACCU
+0dfe:	MOV	ACCU, T0
+0e00:	MOV	T6, ACCU
+0e02:	MOVB	T1, #10
+0e05:	MOV	ACCU, T5
+0e07:	BNEF	$0ECE
+0e0a:	MOVB	T3, 2(FP)
+0e0d:	MOVB	ACCU, T3
+0e0f:	CMPUB	ACCU, #$00FF
+0e11:	BNEF	$0EBE
+0e14:	MOVB	T3, #9
+0e17:	MOVB	ACCU, T1
+0e19:	CMPUB	ACCU, #$0009
+0e1b:	BGE	$0E30
+0e1d:	ADDB	T1, #$00FF
+0e20:	MOVB	ACCU, T1
+0e22:	LEAX	ADDR, T6 + ACCU
+0e24:	MOV	ACCU, #48
+0e27:	MOVB	0(ADDR), ACCU
+0e2a:	MOVB	ACCU, T3
+0e2c:	CMPUB	ACCU, T1
+0e2e:	BGT	$0E1D
+0e30:	MOVUB	ACCU, 7(FP)
+0e33:	BEQ	$0E59
+0e35:	MOV	ACCU, 3(FP)
+0e38:	CMPU	ACCU, #$0010
+0e3b:	BNE	$0E59
+0e3d:	MOVB	ACCU, T1
+0e3f:	ADDB	ACCU, #$00FF
+0e42:	MOVB	ACCU, ACCU
+0e44:	LEAX	ADDR, T6 + ACCU
+0e46:	MOV	ACCU, #88
+0e49:	MOVB	0(ADDR), ACCU
+0e4c:	ADDB	T1, #$00FE
+0e4f:	MOVB	ACCU, T1
+0e51:	LEAX	ADDR, T6 + ACCU
+0e53:	MOV	ACCU, #48
+0e56:	MOVB	0(ADDR), ACCU
+0e59:	MOVUB	ACCU, 5(FP)
+0e5c:	BEQ	$0E6B
+0e5e:	ADDB	T1, #$00FF
+0e61:	MOVB	ACCU, T1
+0e63:	LEAX	ADDR, T6 + ACCU
+0e65:	MOV	ACCU, #43
+0e68:	MOVB	0(ADDR), ACCU
+0e6b:	MOVUB	T5, 1(FP)
+0e6e:	SUBR	T5, #$000A
+0e72:	MOVB	ACCU, T1
+0e74:	MOV	T7, ACCU
+0e76:	MOV	ACCU, T5
+0e78:	CMPS	ACCU, T7
+0e7a:	BGT	$0EAF
+0e7c:	MOVB	T3, #0
+0e7f:	MOVB	ACCU, T1
+0e81:	CMPUB	ACCU, #$000A
+0e83:	BLE	$0E9F
+0e85:	MOVB	ACCU, T1
+0e87:	LEAX	ADDR, T6 + ACCU
+0e89:	MOVB	T4, 0(ADDR)
+0e8c:	MOVB	ACCU, T3
+0e8e:	LEAX	ADDR, T6 + ACCU
+0e90:	MOVB	0(ADDR), T4
+0e93:	ADDB	T3, #$0001
+0e96:	ADDB	T1, #$0001
+0e99:	MOVB	ACCU, T1
+0e9b:	CMPUB	ACCU, #$000A
+0e9d:	BGT	$0E85
+0e9f:	MOV	ADDR, T2
+0ea1:	MOVB	T4, 0(ADDR)
+0ea4:	ADD	T2, #$0001
+0ea8:	MOVB	ACCU, T3
+0eaa:	MOV	T1, ACCU
+0eac:	JUMPF	$0BA3
+0eaf:	ADDB	T1, #$00FF
+0eb2:	MOVB	ACCU, T1
+0eb4:	LEAX	ADDR, T6 + ACCU
+0eb6:	MOVB	T3, 0(FP)
+0eb9:	MOVB	0(ADDR), T3
+0ebc:	JUMP	$0E6B
+0ebe:	MOVB	ACCU, T3
+0ec0:	SUBR	ACCU, #$000A
+0ec4:	MOV	T3, ACCU
+0ec6:	CMPUB	ACCU, T1
+0ec8:	BGTF	$0E1D
+0ecb:	JUMPF	$0E30
+0ece:	MOV	T7, 3(FP)
+0ed1:	MOV	ACCU, T5
+0ed3:	MODU	ACCU, T7
+0ed5:	MOV	T7, ACCU
+0ed7:	CMPS	ACCU, #$000A
+0eda:	BLE	$0EE2
+0edc:	ADD	T7, #$0030
+0ee0:	JUMP	$0EE6
+0ee2:	ADD	T7, #$0037
+0ee6:	ADDB	T1, #$00FF
+0ee9:	MOVB	ACCU, T1
+0eeb:	LEAX	ADDR, T6 + ACCU
+0eed:	MOVB	0(ADDR), T7
+0ef0:	MOV	T7, 3(FP)
+0ef3:	MOV	ACCU, T5
+0ef5:	DIVU	ACCU, T7
+0ef7:	MOV	T5, ACCU
+0ef9:	BNE	$0ECE
+0efb:	JUMPF	$0E0A
+0efe:	MOV	T5, 14(FP)
+0f01:	MOV	ACCU, T5
+0f03:	MOV	ADDR, T5
+0f05:	MOV	T5, 0(ADDR)
+0f08:	ADD	ACCU, #$0002
+0f0c:	MOV	14(FP), ACCU
+0f0f:	MOV	ACCU, T0
+0f11:	MOV	T6, ACCU
+0f13:	MOVB	T1, #10
+0f16:	MOV	ACCU, T5
+0f18:	BNEF	$0FD3
+0f1b:	MOVB	T3, 2(FP)
+0f1e:	MOVB	ACCU, T3
+0f20:	CMPUB	ACCU, #$00FF
+0f22:	BNEF	$0FC3
+0f25:	MOVB	T3, #9
+0f28:	MOVB	ACCU, T1
+0f2a:	CMPUB	ACCU, #$0009
+0f2c:	BGE	$0F41
+0f2e:	ADDB	T1, #$00FF
+0f31:	MOVB	ACCU, T1
+0f33:	LEAX	ADDR, T6 + ACCU
+0f35:	MOV	ACCU, #48
+0f38:	MOVB	0(ADDR), ACCU
+0f3b:	MOVB	ACCU, T3
+0f3d:	CMPUB	ACCU, T1
+0f3f:	BGT	$0F2E
+0f41:	MOVUB	ACCU, 7(FP)
+0f44:	BEQ	$0F6A
+0f46:	MOV	ACCU, 3(FP)
+0f49:	CMPU	ACCU, #$0010
+0f4c:	BNE	$0F6A
+0f4e:	MOVB	ACCU, T1
+0f50:	ADDB	ACCU, #$00FF
+0f53:	MOVB	ACCU, ACCU
+0f55:	LEAX	ADDR, T6 + ACCU
+0f57:	MOV	ACCU, #88
+0f5a:	MOVB	0(ADDR), ACCU
+0f5d:	ADDB	T1, #$00FE
+0f60:	MOVB	ACCU, T1
+0f62:	LEAX	ADDR, T6 + ACCU
+0f64:	MOV	ACCU, #48
+0f67:	MOVB	0(ADDR), ACCU
+0f6a:	MOVUB	ACCU, 5(FP)
+0f6d:	BEQ	$0F7C
+0f6f:	ADDB	T1, #$00FF
+0f72:	MOVB	ACCU, T1
+0f74:	LEAX	ADDR, T6 + ACCU
+0f76:	MOV	ACCU, #43
+0f79:	MOVB	0(ADDR), ACCU
+0f7c:	MOVUB	T5, 1(FP)
+0f7f:	SUBR	T5, #$000A
+0f83:	MOVB	ACCU, T1
+0f85:	MOV	T7, ACCU
+0f87:	MOV	ACCU, T5
+0f89:	CMPS	ACCU, T7
+0f8b:	BGT	$0FB4
+0f8d:	MOVB	T3, #0
+0f90:	MOVB	ACCU, T1
+0f92:	CMPUB	ACCU, #$000A
+0f94:	BLEF	$0E9F
+0f97:	MOVB	ACCU, T1
+0f99:	LEAX	ADDR, T6 + ACCU
+0f9b:	MOVB	T4, 0(ADDR)
+0f9e:	MOVB	ACCU, T3
+0fa0:	LEAX	ADDR, T6 + ACCU
+0fa2:	MOVB	0(ADDR), T4
+0fa5:	ADDB	T3, #$0001
+0fa8:	ADDB	T1, #$0001
+0fab:	MOVB	ACCU, T1
+0fad:	CMPUB	ACCU, #$000A
+0faf:	BGT	$0F97
+0fb1:	JUMPF	$0E9F
+0fb4:	ADDB	T1, #$00FF
+0fb7:	MOVB	ACCU, T1
+0fb9:	LEAX	ADDR, T6 + ACCU
+0fbb:	MOVB	T3, 0(FP)
+0fbe:	MOVB	0(ADDR), T3
+0fc1:	JUMP	$0F7C
+0fc3:	MOVB	ACCU, T3
+0fc5:	SUBR	ACCU, #$000A
+0fc9:	MOV	T3, ACCU
+0fcb:	CMPUB	ACCU, T1
+0fcd:	BGTF	$0F2E
+0fd0:	JUMPF	$0F41
+0fd3:	MOV	T7, 3(FP)
+0fd6:	MOV	ACCU, T5
+0fd8:	MODU	ACCU, T7
+0fda:	MOV	T7, ACCU
+0fdc:	CMPS	ACCU, #$000A
+0fdf:	BLE	$0FE7
+0fe1:	ADD	T7, #$0030
+0fe5:	JUMP	$0FEB
+0fe7:	ADD	T7, #$0037
+0feb:	ADDB	T1, #$00FF
+0fee:	MOVB	ACCU, T1
+0ff0:	LEAX	ADDR, T6 + ACCU
+0ff2:	MOVB	0(ADDR), T7
+0ff5:	MOV	T7, 3(FP)
+0ff8:	MOV	ACCU, T5
+0ffa:	DIVU	ACCU, T7
+0ffc:	MOV	T5, ACCU
+0ffe:	BNE	$0FD3
+1000:	JUMPF	$0F1B
+1003:	MOV	T5, 14(FP)
+1006:	MOV	ACCU, T5
+1008:	MOV	ADDR, T5
+100a:	MOV	T5, 0(ADDR)
+100d:	ADD	ACCU, #$0002
+1011:	MOV	14(FP), ACCU
+1014:	MOV	ACCU, T0
+1016:	MOV	T6, ACCU
+1018:	MOV	ACCU, T5
+101a:	BLTF	$1131
+101d:	MOV	T7, ACCU
+101f:	MOVB	T1, #0
+1022:	MOVB	T3, #10
+1025:	MOV	ACCU, T5
+1027:	BNEF	$1101
+102a:	MOVB	T4, 2(FP)
+102d:	MOVB	ACCU, T4
+102f:	CMPUB	ACCU, #$00FF
+1031:	BNEF	$10F1
+1034:	MOVB	T4, #9
+1037:	MOVB	ACCU, T3
+1039:	CMPUB	ACCU, #$0009
+103b:	BGE	$1050
+103d:	ADDB	T3, #$00FF
+1040:	MOVB	ACCU, T3
+1042:	LEAX	ADDR, T6 + ACCU
+1044:	MOV	ACCU, #48
+1047:	MOVB	0(ADDR), ACCU
+104a:	MOVB	ACCU, T4
+104c:	CMPUB	ACCU, T3
+104e:	BGT	$103D
+1050:	MOVUB	ACCU, 7(FP)
+1053:	BEQ	$1079
+1055:	MOV	ACCU, 3(FP)
+1058:	CMPU	ACCU, #$0010
+105b:	BNE	$1079
+105d:	MOVB	ACCU, T3
+105f:	ADDB	ACCU, #$00FF
+1062:	MOVB	ACCU, ACCU
+1064:	LEAX	ADDR, T6 + ACCU
+1066:	MOV	ACCU, #88
+1069:	MOVB	0(ADDR), ACCU
+106c:	ADDB	T3, #$00FE
+106f:	MOVB	ACCU, T3
+1071:	LEAX	ADDR, T6 + ACCU
+1073:	MOV	ACCU, #48
+1076:	MOVB	0(ADDR), ACCU
+1079:	MOVB	ACCU, T1
+107b:	BNE	$10E2
+107d:	MOVUB	ACCU, 5(FP)
+1080:	BEQ	$108F
+1082:	ADDB	T3, #$00FF
+1085:	MOVB	ACCU, T3
+1087:	LEAX	ADDR, T6 + ACCU
+1089:	MOV	ACCU, #43
+108c:	MOVB	0(ADDR), ACCU
+108f:	MOVUB	T5, 1(FP)
+1092:	SUBR	T5, #$000A
+1096:	MOVB	ACCU, T3
+1098:	MOV	T7, ACCU
+109a:	MOV	ACCU, T5
+109c:	CMPS	ACCU, T7
+109e:	BGT	$10D3
+10a0:	MOVB	T1, #0
+10a3:	MOVB	ACCU, T3
+10a5:	CMPUB	ACCU, #$000A
+10a7:	BLE	$10C3
+10a9:	MOVB	ACCU, T3
+10ab:	LEAX	ADDR, T6 + ACCU
+10ad:	MOVB	T4, 0(ADDR)
+10b0:	MOVB	ACCU, T1
+10b2:	LEAX	ADDR, T6 + ACCU
+10b4:	MOVB	0(ADDR), T4
+10b7:	ADDB	T1, #$0001
+10ba:	ADDB	T3, #$0001
+10bd:	MOVB	ACCU, T3
+10bf:	CMPUB	ACCU, #$000A
+10c1:	BGT	$10A9
+10c3:	MOV	ADDR, T2
+10c5:	MOVB	T4, 0(ADDR)
+10c8:	ADD	T2, #$0001
+10cc:	AND	T1, #$00FF
+10d0:	JUMPF	$0BA3
+10d3:	ADDB	T3, #$00FF
+10d6:	MOVB	ACCU, T3
+10d8:	LEAX	ADDR, T6 + ACCU
+10da:	MOVB	T1, 0(FP)
+10dd:	MOVB	0(ADDR), T1
+10e0:	JUMP	$108F
+10e2:	ADDB	T3, #$00FF
+10e5:	MOVB	ACCU, T3
+10e7:	LEAX	ADDR, T6 + ACCU
+10e9:	MOV	ACCU, #45
+10ec:	MOVB	0(ADDR), ACCU
+10ef:	JUMP	$108F
+10f1:	MOVB	ACCU, T4
+10f3:	SUBR	ACCU, #$000A
+10f7:	MOV	T4, ACCU
+10f9:	CMPUB	ACCU, T3
+10fb:	BGTF	$103D
+10fe:	JUMPF	$1050
+1101:	MOV	T5, 3(FP)
+1104:	MOV	ACCU, T7
+1106:	MODU	ACCU, T5
+1108:	MOV	T5, ACCU
+110a:	CMPS	ACCU, #$000A
+110d:	BLE	$1115
+110f:	ADD	T5, #$0030
+1113:	JUMP	$1119
+1115:	ADD	T5, #$0037
+1119:	ADDB	T3, #$00FF
+111c:	MOVB	ACCU, T3
+111e:	LEAX	ADDR, T6 + ACCU
+1120:	MOVB	0(ADDR), T5
+1123:	MOV	T5, 3(FP)
+1126:	MOV	ACCU, T7
+1128:	DIVU	ACCU, T5
+112a:	MOV	T7, ACCU
+112c:	BNE	$1101
+112e:	JUMPF	$102A
+1131:	MOVB	T1, #1
+1134:	MOVB	T3, #10
+1137:	NEG	ACCU
+1138:	MOV	T7, ACCU
+113a:	BNE	$1101
+113c:	JUMPF	$102A
+113f:	MOV	T5, #0
+1142:	MOV	ADDR, T2
+1144:	MOVB	T3, 0(ADDR)
+1147:	ADD	T2, #$0001
+114b:	MOVB	ACCU, T3
+114d:	CMPUB	ACCU, #$0030
+114f:	BGT	$1173
+1151:	MOVB	ACCU, T3
+1153:	CMPUB	ACCU, #$0039
+1155:	BLT	$1173
+1157:	MOVB	ACCU, T3
+1159:	MOV	T6, ACCU
+115b:	MOV	ADDR, T2
+115d:	MOVB	T3, 0(ADDR)
+1160:	ADD	T2, #$0001
+1164:	MUL	T5, #10
+1167:	ADD	T5, ACCU
+1169:	ADD	T5, #$FFD0
+116d:	MOVB	ACCU, T3
+116f:	CMPUB	ACCU, #$0030
+1171:	BLE	$1151
+1173:	MOVB	2(FP), T5
+1176:	JUMPF	$0C42
+1179:	MOV	T5, #0
+117c:	MOVB	ACCU, T3
+117e:	CMPUB	ACCU, #$0030
+1180:	BGT	$11A4
+1182:	MOVB	ACCU, T3
+1184:	CMPUB	ACCU, #$0039
+1186:	BLT	$11A4
+1188:	MOVB	ACCU, T3
+118a:	MOV	T6, ACCU
+118c:	MOV	ADDR, T2
+118e:	MOVB	T3, 0(ADDR)
+1191:	ADD	T2, #$0001
+1195:	MUL	T5, #10
+1198:	ADD	T5, ACCU
+119a:	ADD	T5, #$FFD0
+119e:	MOVB	ACCU, T3
+11a0:	CMPUB	ACCU, #$0030
+11a2:	BLE	$1182
+11a4:	MOVB	1(FP), T5
+11a7:	JUMPF	$0C3B
+11aa:	MOV	ACCU, #1
+11ad:	MOVB	7(FP), ACCU
+11b0:	MOV	ADDR, T2
+11b2:	MOVB	T3, 0(ADDR)
+11b5:	JUMPF	$0C15
+11b8:	MOV	ACCU, #48
+11bb:	MOVB	0(FP), ACCU
+11be:	MOV	ADDR, T2
+11c0:	MOVB	T3, 0(ADDR)
+11c3:	JUMPF	$0C15
+11c6:	MOV	ACCU, #1
+11c9:	MOVB	5(FP), ACCU
+11cc:	MOV	ADDR, T2
+11ce:	MOVB	T3, 0(ADDR)
+11d1:	JUMPF	$0C15
+11d4:	MOVUB	ACCU, 16(FP)
+11d7:	BNE	$11E3
+11d9:	MOVB	ACCU, T1
+11db:	ADD	T0, ACCU
+11dd:	MOVB	T1, #0
+11e0:	JUMPF	$0BEC
+11e3:	MOVB	ACCU, T1
+11e5:	LEAX	ADDR, T0 + ACCU
+11e7:	MOV	ACCU, #0
+11ea:	MOVB	0(ADDR), ACCU
+11ed:	MOV	ACCU, T0
+11ef:	MOV	P0, ACCU
+11f1:	CALL	puts + 0
+11f4:	MOVB	T1, #0
+11f7:	JUMPF	$0BEC
+--------------------------------------------------------------------
+puts:
+11fa:	ENTER	0, 2
+11fe:	JSR	$1205
+1201:	RETURN	0, 2
+--------------------------------------------------------------------
+1205 : a0 00 __ LDY #$00
+1207 : b1 0d __ LDA (P0),y
+1209 : f0 0b __ BEQ $1216
+120b : 20 17 12 JSR $1217 ; (putpch + 0)
+120e : e6 0d __ INC P0
+1210 : d0 f3 __ BNE $1205
+1212 : e6 0e __ INC P1
+1214 : d0 ef __ BNE $1205
+1216 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1217 : ae 8c 23 LDX $238c ; (giocharmap + 0)
+121a : e0 01 __ CPX #$01
+121c : 90 22 __ BCC $1240
+121e : c9 0a __ CMP #$0a
+1220 : d0 02 __ BNE $1224
+1222 : a9 0d __ LDA #$0d
+1224 : e0 02 __ CPX #$02
+1226 : 90 18 __ BCC $1240
+1228 : c9 41 __ CMP #$41
+122a : 90 14 __ BCC $1240
+122c : c9 7b __ CMP #$7b
+122e : b0 10 __ BCS $1240
+1230 : c9 61 __ CMP #$61
+1232 : b0 04 __ BCS $1238
+1234 : c9 5b __ CMP #$5b
+1236 : b0 08 __ BCS $1240
+1238 : 49 20 __ EOR #$20
+123a : e0 03 __ CPX #$03
+123c : f0 02 __ BEQ $1240
+123e : 29 df __ AND #$df
+1240 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+1243:	ENTER	5, 7
+1247:	MOVD	ACCU, P4
+1249:	MOVD	T0, ACCU
+124b:	MOVD	T1, ACCU
+124d:	MOV	ACCU, P2
+124f:	MOV	T2, ACCU
+1251:	MOVB	T3, #0
+1254:	MOVB	ACCU, P8
+1256:	BEQ	$1265
+1258:	MOVD	ACCU, #$00000000
+125e:	EXTRT	T0, inp_op_cmp_s32 + 0
+1262:	BLTF	$13AA
+1265:	MOVB	T4, #16
+1268:	MOVD	ACCU, #$00000000
+126e:	EXTRT	T0, inp_op_cmp_u32 + 0
+1272:	BGTF	$1352
+1275:	MOV	ADDR, P0
+1277:	MOVB	T5, 2(ADDR)
+127a:	MOVB	ACCU, T5
+127c:	CMPUB	ACCU, #$00FF
+127e:	BNEF	$1342
+1281:	MOVB	T5, #15
+1284:	MOVB	ACCU, T4
+1286:	CMPUB	ACCU, #$000F
+1288:	BGE	$129D
+128a:	ADDB	T4, #$00FF
+128d:	MOVB	ACCU, T4
+128f:	LEAX	ADDR, T2 + ACCU
+1291:	MOV	ACCU, #48
+1294:	MOVB	0(ADDR), ACCU
+1297:	MOVB	ACCU, T5
+1299:	CMPUB	ACCU, T4
+129b:	BGT	$128A
+129d:	MOV	ACCU, P0
+129f:	MOV	T6, ACCU
+12a1:	MOV	ADDR, T6
+12a3:	MOVUB	ACCU, 7(ADDR)
+12a6:	BEQ	$12CC
+12a8:	MOV	ACCU, 3(ADDR)
+12ab:	CMPU	ACCU, #$0010
+12ae:	BNE	$12CC
+12b0:	MOVB	ACCU, T4
+12b2:	ADDB	ACCU, #$00FF
+12b5:	MOVB	ACCU, ACCU
+12b7:	LEAX	ADDR, T2 + ACCU
+12b9:	MOV	ACCU, #88
+12bc:	MOVB	0(ADDR), ACCU
+12bf:	ADDB	T4, #$00FE
+12c2:	MOVB	ACCU, T4
+12c4:	LEAX	ADDR, T2 + ACCU
+12c6:	MOV	ACCU, #48
+12c9:	MOVB	0(ADDR), ACCU
+12cc:	MOVB	ACCU, T3
+12ce:	BNE	$1333
+12d0:	MOV	ADDR, T6
+12d2:	MOVUB	ACCU, 5(ADDR)
+12d5:	BEQ	$12E4
+12d7:	ADDB	T4, #$00FF
+12da:	MOVB	ACCU, T4
+12dc:	LEAX	ADDR, T2 + ACCU
+12de:	MOV	ACCU, #43
+12e1:	MOVB	0(ADDR), ACCU
+12e4:	MOV	ACCU, P0
+12e6:	MOV	T6, ACCU
+12e8:	MOV	ADDR, T6
+12ea:	MOVUB	T7, 1(ADDR)
+12ed:	SUBR	T7, #$0010
+12f1:	MOVB	ACCU, T4
+12f3:	MOV	T8, ACCU
+12f5:	MOV	ACCU, T7
+12f7:	CMPS	ACCU, T8
+12f9:	BGT	$1324
+12fb:	MOVB	T3, #0
+12fe:	MOVB	ACCU, T4
+1300:	CMPUB	ACCU, #$0010
+1302:	BLE	$131E
+1304:	MOVB	ACCU, T4
+1306:	LEAX	ADDR, T2 + ACCU
+1308:	MOVB	T5, 0(ADDR)
+130b:	MOVB	ACCU, T3
+130d:	LEAX	ADDR, T2 + ACCU
+130f:	MOVB	0(ADDR), T5
+1312:	ADDB	T3, #$0001
+1315:	ADDB	T4, #$0001
+1318:	MOVB	ACCU, T4
+131a:	CMPUB	ACCU, #$0010
+131c:	BGT	$1304
+131e:	MOVB	ACCU, T3
+1320:	RETURN	5, 7
+1324:	MOVB	T3, 0(ADDR)
+1327:	ADDB	T4, #$00FF
+132a:	MOVB	ACCU, T4
+132c:	LEAX	ADDR, T2 + ACCU
+132e:	MOVB	0(ADDR), T3
+1331:	JUMP	$12E4
+1333:	ADDB	T4, #$00FF
+1336:	MOVB	ACCU, T4
+1338:	LEAX	ADDR, T2 + ACCU
+133a:	MOV	ACCU, #45
+133d:	MOVB	0(ADDR), ACCU
+1340:	JUMP	$12E4
+1342:	MOVB	ACCU, T5
+1344:	SUBR	ACCU, #$0010
+1348:	MOV	T5, ACCU
+134a:	CMPUB	ACCU, T4
+134c:	BGTF	$128A
+134f:	JUMPF	$129D
+1352:	MOV	ACCU, P0
+1354:	MOV	T6, ACCU
+1356:	MOV	ADDR, T6
+1358:	MOV	ACCU, 3(ADDR)
+135b:	EXTRT	$00, inp_op_ext_u16 + 0
+135f:	MOVD	T0, ACCU
+1361:	MOVD	ACCU, T1
+1363:	EXTRT	T0, inp_binop_mod_u32 + 0
+1367:	MOVD	T0, ACCU
+1369:	CMPS	ACCU, #$000A
+136c:	BLE	$1376
+136e:	MOV	ACCU, T0
+1370:	ADD	ACCU, #$0030
+1374:	JUMP	$137C
+1376:	MOV	ACCU, T0
+1378:	ADD	ACCU, #$0037
+137c:	MOV	T7, ACCU
+137e:	ADDB	T4, #$00FF
+1381:	MOVB	ACCU, T4
+1383:	LEAX	ADDR, T2 + ACCU
+1385:	MOVB	0(ADDR), T7
+1388:	MOV	ADDR, T6
+138a:	MOV	ACCU, 3(ADDR)
+138d:	EXTRT	$00, inp_op_ext_u16 + 0
+1391:	MOVD	T0, ACCU
+1393:	MOVD	ACCU, T1
+1395:	EXTRT	T0, inp_binop_div_u32 + 0
+1399:	MOVD	T1, ACCU
+139b:	MOVD	ACCU, #$00000000
+13a1:	EXTRT	T1, inp_op_cmp_u32 + 0
+13a5:	BGT	$1352
+13a7:	JUMPF	$1275
+13aa:	MOVB	T3, #1
+13ad:	MOVB	T4, #16
+13b0:	MOVD	ACCU, T0
+13b2:	EXTRT	$00, negaccu32 + 0
+13b6:	MOVD	T1, ACCU
+13b8:	MOVD	ACCU, #$00000000
+13be:	EXTRT	T1, inp_op_cmp_u32 + 0
+13c2:	BGT	$1352
+13c4:	JUMPF	$1275
+--------------------------------------------------------------------
+nformf:
+13c7:	ENTER	10, 12
+13cb:	MOV	ACCU, P2
+13cd:	MOV	T0, ACCU
+13cf:	MOV	T1, ACCU
+13d1:	MOVD	ACCU, P4
+13d3:	MOVD	T2, ACCU
+13d5:	MOVD	ACCU, #$00000000
+13db:	CMPF	ACCU, T2
+13dd:	BLTF	$16E0
+13e0:	MOVB	T3, #0
+13e3:	MOV	ADDR, P0
+13e5:	MOVUB	ACCU, 5(ADDR)
+13e8:	BEQ	$13F5
+13ea:	MOV	ACCU, #43
+13ed:	MOV	ADDR, T0
+13ef:	MOVB	0(ADDR), ACCU
+13f2:	MOVB	T3, #1
+13f5:	MOV	T0, #0
+13f8:	MOV	ADDR, P0
+13fa:	MOVB	T5, 2(ADDR)
+13fd:	MOVB	ACCU, T5
+13ff:	CMPUB	ACCU, #$00FF
+1401:	BNE	$1408
+1403:	MOVB	T5, #6
+1406:	JUMP	$140C
+1408:	AND	T5, #$00FF
+140c:	MOVD	ACCU, P4
+140e:	MOVD	T2, #$00000000
+1414:	CMPF	ACCU, T2
+1416:	BNEF	$1664
+1419:	MOVB	ACCU, P8
+141b:	MOVB	T6, ACCU
+141d:	CMPUB	ACCU, #$0065
+141f:	SEQ
+1420:	MOVB	T7, ACCU
+1422:	MOVB	T8, ACCU
+1424:	MOVB	ACCU, T5
+1426:	MOV	T4, ACCU
+1428:	ADD	T4, #$0001
+142c:	MOVB	ACCU, T6
+142e:	CMPUB	ACCU, #$0067
+1430:	BEQF	$1653
+1433:	MOVB	ACCU, T7
+1435:	BNEF	$1607
+1438:	MOV	ACCU, T0
+143a:	BGE	$1452
+143c:	MOVD	ACCU, P4
+143e:	MOVD	$03, #$41200000
+1444:	DIVF	ACCU, $03
+1446:	MOVD	T2, ACCU
+1448:	MOVD	P4, ACCU
+144a:	ADD	T0, #$0001
+144e:	MOV	ACCU, T0
+1450:	BLT	$143C
+1452:	MOVD	T2, #$3f000000
+1458:	MOVB	ACCU, T5
+145a:	ADD	ACCU, T0
+145c:	MOV	T4, ACCU
+145e:	ADD	T4, #$0001
+1462:	MOVB	ACCU, T4
+1464:	CMPUB	ACCU, #$0001
+1466:	BLTF	$15EC
+1469:	MOVD	ACCU, P4
+146b:	ADDF	ACCU, T2
+146d:	MOVD	T2, ACCU
+146f:	MOVD	P4, ACCU
+1471:	MOVD	ACCU, #$41200000
+1477:	CMPF	ACCU, T2
+1479:	BLT	$148C
+147b:	MOVD	ACCU, T2
+147d:	MOVD	$03, #$41200000
+1483:	DIVF	ACCU, $03
+1485:	MOVD	T2, ACCU
+1487:	MOVD	P4, ACCU
+1489:	ADDB	T5, #$00FF
+148c:	MOVB	ACCU, T4
+148e:	MOV	T10, ACCU
+1490:	MOVB	ACCU, T5
+1492:	NEG	ACCU
+1493:	ADD	ACCU, T10
+1495:	MOV	T10, ACCU
+1497:	MOVB	T5, ACCU
+1499:	MOVB	ACCU, T4
+149b:	CMPUB	ACCU, #$0014
+149d:	BGE	$14A2
+149f:	MOVB	T4, #20
+14a2:	MOVB	ACCU, T10
+14a4:	BNE	$14B3
+14a6:	MOVB	ACCU, T3
+14a8:	LEAX	ADDR, T1 + ACCU
+14aa:	MOV	ACCU, #48
+14ad:	MOVB	0(ADDR), ACCU
+14b0:	ADDB	T3, #$0001
+14b3:	MOVB	T6, #0
+14b6:	MOVB	ACCU, T4
+14b8:	BNEF	$15A5
+14bb:	MOVB	ACCU, T8
+14bd:	BNE	$1534
+14bf:	MOV	ADDR, P0
+14c1:	MOVUB	ACCU, 1(ADDR)
+14c4:	CMPUB	ACCU, T3
+14c6:	BLT	$14CE
+14c8:	MOVB	ACCU, T3
+14ca:	RETURN	10, 12
+14ce:	MOVB	ACCU, T3
+14d0:	CMPUB	ACCU, #$0001
+14d2:	BLE	$1503
+14d4:	MOVB	T5, #0
+14d7:	MOVB	ACCU, T3
+14d9:	MOV	T0, ACCU
+14db:	MOV	ADDR, P0
+14dd:	MOVUB	ACCU, 1(ADDR)
+14e0:	MOV	T4, ACCU
+14e2:	SUB	ACCU, T0
+14e4:	MOV	T10, ACCU
+14e6:	MOVB	ACCU, T5
+14e8:	MOV	T11, ACCU
+14ea:	MOV	ACCU, T10
+14ec:	CMPU	ACCU, T11
+14ee:	BLT	$14F4
+14f0:	MOV	ACCU, T4
+14f2:	JUMP	$14CA
+14f4:	MOV	ACCU, T1
+14f6:	LEAX	ADDR, T11 + ACCU
+14f8:	MOV	ACCU, #32
+14fb:	MOVB	0(ADDR), ACCU
+14fe:	ADDB	T5, #$0001
+1501:	JUMP	$14DB
+1503:	MOVB	T5, #1
+1506:	MOV	ACCU, P0
+1508:	MOV	T0, ACCU
+150a:	MOVB	ACCU, T3
+150c:	MOV	T4, ACCU
+150e:	MOVB	ACCU, T5
+1510:	MOV	T10, ACCU
+1512:	MOV	ACCU, T4
+1514:	SUB	ACCU, T10
+1516:	MOV	ADDR, T0
+1518:	MOVB	T6, 1(ADDR)
+151b:	LEAX	ADDR, T1 + ACCU
+151d:	MOVB	ACCU, T6
+151f:	MOVB	T6, 0(ADDR)
+1522:	SUB	ACCU, T10
+1524:	LEAX	ADDR, T1 + ACCU
+1526:	MOVB	0(ADDR), T6
+1529:	ADDB	T5, #$0001
+152c:	MOVB	ACCU, T3
+152e:	CMPUB	ACCU, T5
+1530:	BLE	$150E
+1532:	JUMP	$14D4
+1534:	MOVB	ACCU, T3
+1536:	LEAX	ADDR, T1 + ACCU
+1538:	MOV	ACCU, #69
+153b:	MOVB	0(ADDR), ACCU
+153e:	MOVB	ACCU, T3
+1540:	ADDB	ACCU, #$0001
+1543:	MOVB	T5, ACCU
+1545:	MOV	ACCU, T0
+1547:	BLT	$1558
+1549:	MOVB	ACCU, T5
+154b:	LEAX	ADDR, T1 + ACCU
+154d:	MOV	ACCU, #43
+1550:	MOVB	0(ADDR), ACCU
+1553:	ADDB	T3, #$0002
+1556:	JUMP	$156A
+1558:	MOVB	ACCU, T5
+155a:	LEAX	ADDR, T1 + ACCU
+155c:	MOV	ACCU, #45
+155f:	MOVB	0(ADDR), ACCU
+1562:	ADDB	T3, #$0002
+1565:	MOV	ACCU, T0
+1567:	NEG	ACCU
+1568:	MOV	T0, ACCU
+156a:	MOVB	ACCU, T3
+156c:	ADD	ACCU, T1
+156e:	MOV	T4, ACCU
+1570:	MOV	ACCU, T0
+1572:	MOV	ADDR, #10
+1575:	DIVS	ACCU, ADDR
+1577:	MOV	ADDR, T4
+1579:	MOV	T10, ACCU
+157b:	ADD	T10, #$0030
+157f:	MOVB	0(ADDR), T10
+1582:	MOVB	ACCU, T3
+1584:	ADDB	ACCU, #$0001
+1587:	MOVB	ACCU, ACCU
+1589:	ADD	ACCU, T1
+158b:	MOV	T4, ACCU
+158d:	MOV	ACCU, T0
+158f:	MOV	ADDR, #10
+1592:	MODS	ACCU, ADDR
+1594:	MOV	ADDR, T4
+1596:	MOV	T0, ACCU
+1598:	ADD	T0, #$0030
+159c:	MOVB	0(ADDR), T0
+159f:	ADDB	T3, #$0002
+15a2:	JUMPF	$14BF
+15a5:	MOVB	ACCU, T5
+15a7:	CMPUB	ACCU, T6
+15a9:	BNE	$15B8
+15ab:	MOVB	ACCU, T3
+15ad:	LEAX	ADDR, T1 + ACCU
+15af:	MOV	ACCU, #46
+15b2:	MOVB	0(ADDR), ACCU
+15b5:	ADDB	T3, #$0001
+15b8:	MOVD	ACCU, P4
+15ba:	MOVD	T2, ACCU
+15bc:	CNVFS	ACCU
+15bd:	MOV	T10, ACCU
+15bf:	CNVSF	ACCU
+15c0:	MOVD	T9, ACCU
+15c2:	MOVD	ACCU, T2
+15c4:	SUBF	ACCU, T9
+15c6:	MOVD	$03, #$41200000
+15cc:	MULF	ACCU, $03
+15ce:	MOVD	T2, ACCU
+15d0:	MOVD	P4, ACCU
+15d2:	MOVB	ACCU, T3
+15d4:	LEAX	ADDR, T1 + ACCU
+15d6:	ADD	T10, #$0030
+15da:	MOVB	0(ADDR), T10
+15dd:	ADDB	T3, #$0001
+15e0:	ADDB	T6, #$0001
+15e3:	MOVB	ACCU, T4
+15e5:	CMPUB	ACCU, T6
+15e7:	BLT	$15A5
+15e9:	JUMPF	$14BB
+15ec:	MOVB	T6, #1
+15ef:	MOVD	ACCU, T2
+15f1:	MOVD	$03, #$41200000
+15f7:	DIVF	ACCU, $03
+15f9:	MOVD	T2, ACCU
+15fb:	ADDB	T6, #$0001
+15fe:	MOVB	ACCU, T4
+1600:	CMPUB	ACCU, T6
+1602:	BLT	$15EF
+1604:	JUMPF	$1469
+1607:	MOVD	T2, #$3f000000
+160d:	MOVB	ACCU, T5
+160f:	BNE	$1639
+1611:	MOVD	ACCU, P4
+1613:	ADDF	ACCU, T2
+1615:	MOVD	T2, ACCU
+1617:	MOVD	P4, ACCU
+1619:	MOVD	ACCU, #$41200000
+161f:	CMPF	ACCU, T2
+1621:	BLTF	$148C
+1624:	MOVD	ACCU, T2
+1626:	MOVD	$03, #$41200000
+162c:	DIVF	ACCU, $03
+162e:	MOVD	T2, ACCU
+1630:	MOVD	P4, ACCU
+1632:	ADD	T0, #$0001
+1636:	JUMPF	$148C
+1639:	MOVB	T6, #0
+163c:	MOVD	ACCU, T2
+163e:	MOVD	$03, #$41200000
+1644:	DIVF	ACCU, $03
+1646:	MOVD	T2, ACCU
+1648:	ADDB	T6, #$0001
+164b:	MOVB	ACCU, T5
+164d:	CMPUB	ACCU, T6
+164f:	BLT	$163C
+1651:	JUMP	$1611
+1653:	MOV	ACCU, T0
+1655:	CMPS	ACCU, #$0003
+1658:	BLT	$165F
+165a:	MOV	ACCU, T0
+165c:	BGEF	$1433
+165f:	MOVB	T8, #1
+1662:	JUMP	$1607
+1664:	MOVD	ACCU, P4
+1666:	MOVD	T2, #$447a0000
+166c:	CMPF	ACCU, T2
+166e:	BGT	$168C
+1670:	MOVD	ACCU, P4
+1672:	MOVD	$03, #$447a0000
+1678:	DIVF	ACCU, $03
+167a:	MOVD	T2, ACCU
+167c:	MOVD	P4, ACCU
+167e:	ADD	T0, #$0003
+1682:	MOVD	ACCU, #$447a0000
+1688:	CMPF	ACCU, T2
+168a:	BGE	$1670
+168c:	MOVD	ACCU, P4
+168e:	MOVD	T2, #$3f800000
+1694:	CMPF	ACCU, T2
+1696:	BLE	$16B4
+1698:	MOVD	ACCU, P4
+169a:	MOVD	$03, #$447a0000
+16a0:	MULF	ACCU, $03
+16a2:	MOVD	T2, ACCU
+16a4:	MOVD	P4, ACCU
+16a6:	ADD	T0, #$FFFD
+16aa:	MOVD	ACCU, #$3f800000
+16b0:	CMPF	ACCU, T2
+16b2:	BLT	$1698
+16b4:	MOVD	ACCU, P4
+16b6:	MOVD	T2, #$41200000
+16bc:	CMPF	ACCU, T2
+16be:	BGTF	$1419
+16c1:	MOVD	ACCU, P4
+16c3:	MOVD	$03, #$41200000
+16c9:	DIVF	ACCU, $03
+16cb:	MOVD	T2, ACCU
+16cd:	MOVD	P4, ACCU
+16cf:	ADD	T0, #$0001
+16d3:	MOVD	ACCU, #$41200000
+16d9:	CMPF	ACCU, T2
+16db:	BGE	$16C1
+16dd:	JUMPF	$1419
+16e0:	MOV	ADDR, T0
+16e2:	MOVD	ACCU, T2
+16e4:	NEGF	ACCU
+16e5:	MOVD	T2, ACCU
+16e7:	MOVD	P4, ACCU
+16e9:	MOV	ACCU, #45
+16ec:	MOVB	0(ADDR), ACCU
+16ef:	MOVB	T3, #1
+16f2:	JUMPF	$13F5
+--------------------------------------------------------------------
+strlen:
+170e : ea __ __ NOP
+170f : a9 00 __ LDA #$00
+1711 : 85 43 __ STA T0 + 0
+1713 : 85 44 __ STA T0 + 1
+1715 : a0 00 __ LDY #$00
+1717 : b1 0d __ LDA (P0),y
+1719 : d0 09 __ BNE $1724
+171b : a5 43 __ LDA T0 + 0
+171d : 85 1b __ STA ACCU + 0
+171f : a5 44 __ LDA T0 + 1
+1721 : 85 1c __ STA ACCU + 1
+1723 : 60 __ __ RTS
+1724 : 18 __ __ CLC
+1725 : a5 0d __ LDA P0
+1727 : 65 43 __ ADC T0 + 0
+1729 : 85 48 __ STA T3 + 0
+172b : a5 0e __ LDA P1
+172d : 65 44 __ ADC T0 + 1
+172f : 85 49 __ STA T3 + 1
+1731 : e6 43 __ INC T0 + 0
+1733 : d0 02 __ BNE $1737
+1735 : e6 44 __ INC T0 + 1
+1737 : a0 01 __ LDY #$01
+1739 : b1 48 __ LDA (T3 + 0),y
+173b : d0 e7 __ BNE $1724
+173d : 4c 1b 17 JMP $171b ; (strlen + 13)
+--------------------------------------------------------------------
+strcmp:
+1756 : ea __ __ NOP
+1757 : a0 00 __ LDY #$00
+1759 : 84 1c __ STY ACCU + 1
+175b : b1 0d __ LDA (P0),y
+175d : f0 16 __ BEQ $1775
+175f : d1 0f __ CMP (P2),y
+1761 : d0 16 __ BNE $1779
+1763 : c8 __ __ INY
+1764 : b1 0d __ LDA (P0),y
+1766 : f0 0d __ BEQ $1775
+1768 : d1 0f __ CMP (P2),y
+176a : d0 0d __ BNE $1779
+176c : c8 __ __ INY
+176d : d0 ec __ BNE $175b
+176f : e6 0e __ INC P1
+1771 : e6 10 __ INC P3
+1773 : d0 e6 __ BNE $175b
+1775 : d1 0f __ CMP (P2),y
+1777 : f0 0a __ BEQ $1783
+1779 : b0 06 __ BCS $1781
+177b : a9 ff __ LDA #$ff
+177d : 85 1c __ STA ACCU + 1
+177f : 30 02 __ BMI $1783
+1781 : a9 01 __ LDA #$01
+1783 : 85 1b __ STA ACCU + 0
+1785 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1794 : b1 19 __ LDA (IP + 0),y
+1796 : c8 __ __ INY
+1797 : aa __ __ TAX
+1798 : b5 00 __ LDA $00,x
+179a : 85 03 __ STA $03
+179c : b5 01 __ LDA $01,x
+179e : 85 04 __ STA $04
+17a0 : b5 02 __ LDA $02,x
+17a2 : 85 05 __ STA $05
+17a4 : b5 03 __ LDA $03,x
+17a6 : 85 06 __ STA $06
+17a8 : a5 05 __ LDA $05
+17aa : 0a __ __ ASL
+17ab : a5 06 __ LDA $06
+17ad : 2a __ __ ROL
+17ae : 85 08 __ STA $08
+17b0 : f0 06 __ BEQ $17b8
+17b2 : a5 05 __ LDA $05
+17b4 : 09 80 __ ORA #$80
+17b6 : 85 05 __ STA $05
+17b8 : a5 1d __ LDA ACCU + 2
+17ba : 0a __ __ ASL
+17bb : a5 1e __ LDA ACCU + 3
+17bd : 2a __ __ ROL
+17be : 85 07 __ STA $07
+17c0 : f0 06 __ BEQ $17c8
+17c2 : a5 1d __ LDA ACCU + 2
+17c4 : 09 80 __ ORA #$80
+17c6 : 85 1d __ STA ACCU + 2
+17c8 : 60 __ __ RTS
+17c9 : 06 1e __ ASL ACCU + 3
+17cb : a5 07 __ LDA $07
+17cd : 6a __ __ ROR
+17ce : 85 1e __ STA ACCU + 3
+17d0 : b0 06 __ BCS $17d8
+17d2 : a5 1d __ LDA ACCU + 2
+17d4 : 29 7f __ AND #$7f
+17d6 : 85 1d __ STA ACCU + 2
+17d8 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+17d9 : 38 __ __ SEC
+17da : a5 07 __ LDA $07
+17dc : e5 08 __ SBC $08
+17de : f0 38 __ BEQ $1818
+17e0 : aa __ __ TAX
+17e1 : b0 25 __ BCS $1808
+17e3 : e0 e9 __ CPX #$e9
+17e5 : b0 0e __ BCS $17f5
+17e7 : a5 08 __ LDA $08
+17e9 : 85 07 __ STA $07
+17eb : a9 00 __ LDA #$00
+17ed : 85 1b __ STA ACCU + 0
+17ef : 85 1c __ STA ACCU + 1
+17f1 : 85 1d __ STA ACCU + 2
+17f3 : f0 23 __ BEQ $1818
+17f5 : a5 1d __ LDA ACCU + 2
+17f7 : 4a __ __ LSR
+17f8 : 66 1c __ ROR ACCU + 1
+17fa : 66 1b __ ROR ACCU + 0
+17fc : e8 __ __ INX
+17fd : d0 f8 __ BNE $17f7
+17ff : 85 1d __ STA ACCU + 2
+1801 : a5 08 __ LDA $08
+1803 : 85 07 __ STA $07
+1805 : 4c 18 18 JMP $1818 ; (faddsub + 63)
+1808 : e0 18 __ CPX #$18
+180a : b0 33 __ BCS $183f
+180c : a5 05 __ LDA $05
+180e : 4a __ __ LSR
+180f : 66 04 __ ROR $04
+1811 : 66 03 __ ROR $03
+1813 : ca __ __ DEX
+1814 : d0 f8 __ BNE $180e
+1816 : 85 05 __ STA $05
+1818 : a5 1e __ LDA ACCU + 3
+181a : 29 80 __ AND #$80
+181c : 85 1e __ STA ACCU + 3
+181e : 45 06 __ EOR $06
+1820 : 30 2d __ BMI $184f
+1822 : 18 __ __ CLC
+1823 : a5 1b __ LDA ACCU + 0
+1825 : 65 03 __ ADC $03
+1827 : 85 1b __ STA ACCU + 0
+1829 : a5 1c __ LDA ACCU + 1
+182b : 65 04 __ ADC $04
+182d : 85 1c __ STA ACCU + 1
+182f : a5 1d __ LDA ACCU + 2
+1831 : 65 05 __ ADC $05
+1833 : 85 1d __ STA ACCU + 2
+1835 : 90 08 __ BCC $183f
+1837 : 66 1d __ ROR ACCU + 2
+1839 : 66 1c __ ROR ACCU + 1
+183b : 66 1b __ ROR ACCU + 0
+183d : e6 07 __ INC $07
+183f : a5 07 __ LDA $07
+1841 : 4a __ __ LSR
+1842 : 05 1e __ ORA ACCU + 3
+1844 : 85 1e __ STA ACCU + 3
+1846 : b0 06 __ BCS $184e
+1848 : a5 1d __ LDA ACCU + 2
+184a : 29 7f __ AND #$7f
+184c : 85 1d __ STA ACCU + 2
+184e : 60 __ __ RTS
+184f : 38 __ __ SEC
+1850 : a5 1b __ LDA ACCU + 0
+1852 : e5 03 __ SBC $03
+1854 : 85 1b __ STA ACCU + 0
+1856 : a5 1c __ LDA ACCU + 1
+1858 : e5 04 __ SBC $04
+185a : 85 1c __ STA ACCU + 1
+185c : a5 1d __ LDA ACCU + 2
+185e : e5 05 __ SBC $05
+1860 : 85 1d __ STA ACCU + 2
+1862 : b0 19 __ BCS $187d
+1864 : 38 __ __ SEC
+1865 : a9 00 __ LDA #$00
+1867 : e5 1b __ SBC ACCU + 0
+1869 : 85 1b __ STA ACCU + 0
+186b : a9 00 __ LDA #$00
+186d : e5 1c __ SBC ACCU + 1
+186f : 85 1c __ STA ACCU + 1
+1871 : a9 00 __ LDA #$00
+1873 : e5 1d __ SBC ACCU + 2
+1875 : 85 1d __ STA ACCU + 2
+1877 : a5 1e __ LDA ACCU + 3
+1879 : 49 80 __ EOR #$80
+187b : 85 1e __ STA ACCU + 3
+187d : a5 1d __ LDA ACCU + 2
+187f : 30 be __ BMI $183f
+1881 : 05 1c __ ORA ACCU + 1
+1883 : 05 1b __ ORA ACCU + 0
+1885 : f0 0f __ BEQ $1896
+1887 : c6 07 __ DEC $07
+1889 : f0 0b __ BEQ $1896
+188b : 06 1b __ ASL ACCU + 0
+188d : 26 1c __ ROL ACCU + 1
+188f : 26 1d __ ROL ACCU + 2
+1891 : 10 f4 __ BPL $1887
+1893 : 4c 3f 18 JMP $183f ; (faddsub + 102)
+1896 : a9 00 __ LDA #$00
+1898 : 85 1b __ STA ACCU + 0
+189a : 85 1c __ STA ACCU + 1
+189c : 85 1d __ STA ACCU + 2
+189e : 85 1e __ STA ACCU + 3
+18a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+18a1 : a5 1b __ LDA ACCU + 0
+18a3 : 05 1c __ ORA ACCU + 1
+18a5 : 05 1d __ ORA ACCU + 2
+18a7 : d0 03 __ BNE $18ac
+18a9 : 85 1e __ STA ACCU + 3
+18ab : 60 __ __ RTS
+18ac : a5 03 __ LDA $03
+18ae : 05 04 __ ORA $04
+18b0 : 05 05 __ ORA $05
+18b2 : d0 09 __ BNE $18bd
+18b4 : 85 1b __ STA ACCU + 0
+18b6 : 85 1c __ STA ACCU + 1
+18b8 : 85 1d __ STA ACCU + 2
+18ba : 85 1e __ STA ACCU + 3
+18bc : 60 __ __ RTS
+18bd : a9 00 __ LDA #$00
+18bf : 85 09 __ STA $09
+18c1 : 85 0a __ STA $0a
+18c3 : 85 0b __ STA $0b
+18c5 : a4 1b __ LDY ACCU + 0
+18c7 : a5 03 __ LDA $03
+18c9 : d0 06 __ BNE $18d1
+18cb : a5 04 __ LDA $04
+18cd : f0 0a __ BEQ $18d9
+18cf : d0 05 __ BNE $18d6
+18d1 : 20 11 19 JSR $1911 ; (fmul8 + 0)
+18d4 : a5 04 __ LDA $04
+18d6 : 20 11 19 JSR $1911 ; (fmul8 + 0)
+18d9 : a5 05 __ LDA $05
+18db : 20 11 19 JSR $1911 ; (fmul8 + 0)
+18de : 38 __ __ SEC
+18df : a5 0b __ LDA $0b
+18e1 : 30 06 __ BMI $18e9
+18e3 : 06 09 __ ASL $09
+18e5 : 26 0a __ ROL $0a
+18e7 : 2a __ __ ROL
+18e8 : 18 __ __ CLC
+18e9 : 29 7f __ AND #$7f
+18eb : 85 0b __ STA $0b
+18ed : a5 1e __ LDA ACCU + 3
+18ef : 45 06 __ EOR $06
+18f1 : 29 80 __ AND #$80
+18f3 : 85 1e __ STA ACCU + 3
+18f5 : a5 07 __ LDA $07
+18f7 : e9 7e __ SBC #$7e
+18f9 : 18 __ __ CLC
+18fa : 65 08 __ ADC $08
+18fc : 4a __ __ LSR
+18fd : 05 1e __ ORA ACCU + 3
+18ff : 85 1e __ STA ACCU + 3
+1901 : a9 00 __ LDA #$00
+1903 : 6a __ __ ROR
+1904 : 05 0b __ ORA $0b
+1906 : 85 1d __ STA ACCU + 2
+1908 : a5 0a __ LDA $0a
+190a : 85 1c __ STA ACCU + 1
+190c : a5 09 __ LDA $09
+190e : 85 1b __ STA ACCU + 0
+1910 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1911 : 38 __ __ SEC
+1912 : 6a __ __ ROR
+1913 : 90 1e __ BCC $1933
+1915 : aa __ __ TAX
+1916 : 18 __ __ CLC
+1917 : 98 __ __ TYA
+1918 : 65 09 __ ADC $09
+191a : 85 09 __ STA $09
+191c : a5 0a __ LDA $0a
+191e : 65 1c __ ADC ACCU + 1
+1920 : 85 0a __ STA $0a
+1922 : a5 0b __ LDA $0b
+1924 : 65 1d __ ADC ACCU + 2
+1926 : 6a __ __ ROR
+1927 : 85 0b __ STA $0b
+1929 : 8a __ __ TXA
+192a : 66 0a __ ROR $0a
+192c : 66 09 __ ROR $09
+192e : 4a __ __ LSR
+192f : f0 0d __ BEQ $193e
+1931 : b0 e2 __ BCS $1915
+1933 : 66 0b __ ROR $0b
+1935 : 66 0a __ ROR $0a
+1937 : 66 09 __ ROR $09
+1939 : 4a __ __ LSR
+193a : 90 f7 __ BCC $1933
+193c : d0 d7 __ BNE $1915
+193e : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+193f : a5 1b __ LDA ACCU + 0
+1941 : 05 1c __ ORA ACCU + 1
+1943 : 05 1d __ ORA ACCU + 2
+1945 : d0 03 __ BNE $194a
+1947 : 85 1e __ STA ACCU + 3
+1949 : 60 __ __ RTS
+194a : a5 1e __ LDA ACCU + 3
+194c : 45 06 __ EOR $06
+194e : 29 80 __ AND #$80
+1950 : 85 1e __ STA ACCU + 3
+1952 : a9 00 __ LDA #$00
+1954 : 85 09 __ STA $09
+1956 : 85 0a __ STA $0a
+1958 : 85 0b __ STA $0b
+195a : a2 18 __ LDX #$18
+195c : a5 1b __ LDA ACCU + 0
+195e : c5 03 __ CMP $03
+1960 : a5 1c __ LDA ACCU + 1
+1962 : e5 04 __ SBC $04
+1964 : a5 1d __ LDA ACCU + 2
+1966 : e5 05 __ SBC $05
+1968 : 90 13 __ BCC $197d
+196a : a5 1b __ LDA ACCU + 0
+196c : e5 03 __ SBC $03
+196e : 85 1b __ STA ACCU + 0
+1970 : a5 1c __ LDA ACCU + 1
+1972 : e5 04 __ SBC $04
+1974 : 85 1c __ STA ACCU + 1
+1976 : a5 1d __ LDA ACCU + 2
+1978 : e5 05 __ SBC $05
+197a : 85 1d __ STA ACCU + 2
+197c : 38 __ __ SEC
+197d : 26 09 __ ROL $09
+197f : 26 0a __ ROL $0a
+1981 : 26 0b __ ROL $0b
+1983 : ca __ __ DEX
+1984 : f0 0a __ BEQ $1990
+1986 : 06 1b __ ASL ACCU + 0
+1988 : 26 1c __ ROL ACCU + 1
+198a : 26 1d __ ROL ACCU + 2
+198c : b0 dc __ BCS $196a
+198e : 90 cc __ BCC $195c
+1990 : 38 __ __ SEC
+1991 : a5 0b __ LDA $0b
+1993 : 30 06 __ BMI $199b
+1995 : 06 09 __ ASL $09
+1997 : 26 0a __ ROL $0a
+1999 : 2a __ __ ROL
+199a : 18 __ __ CLC
+199b : 29 7f __ AND #$7f
+199d : 85 0b __ STA $0b
+199f : a5 08 __ LDA $08
+19a1 : 49 7f __ EOR #$7f
+19a3 : 65 07 __ ADC $07
+19a5 : 38 __ __ SEC
+19a6 : e9 01 __ SBC #$01
+19a8 : 4a __ __ LSR
+19a9 : 05 1e __ ORA ACCU + 3
+19ab : 85 1e __ STA ACCU + 3
+19ad : a9 00 __ LDA #$00
+19af : 6a __ __ ROR
+19b0 : 05 0b __ ORA $0b
+19b2 : 85 1d __ STA ACCU + 2
+19b4 : a5 0a __ LDA $0a
+19b6 : 85 1c __ STA ACCU + 1
+19b8 : a5 09 __ LDA $09
+19ba : 85 1b __ STA ACCU + 0
+19bc : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+19bd : 38 __ __ SEC
+19be : a9 00 __ LDA #$00
+19c0 : e5 1b __ SBC ACCU + 0
+19c2 : 85 1b __ STA ACCU + 0
+19c4 : a9 00 __ LDA #$00
+19c6 : e5 1c __ SBC ACCU + 1
+19c8 : 85 1c __ STA ACCU + 1
+19ca : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+19cb : 38 __ __ SEC
+19cc : a9 00 __ LDA #$00
+19ce : e5 03 __ SBC $03
+19d0 : 85 03 __ STA $03
+19d2 : a9 00 __ LDA #$00
+19d4 : e5 04 __ SBC $04
+19d6 : 85 04 __ STA $04
+19d8 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+19d9 : a5 1c __ LDA ACCU + 1
+19db : d0 31 __ BNE $1a0e
+19dd : a5 04 __ LDA $04
+19df : d0 1e __ BNE $19ff
+19e1 : 85 06 __ STA $06
+19e3 : a2 04 __ LDX #$04
+19e5 : 06 1b __ ASL ACCU + 0
+19e7 : 2a __ __ ROL
+19e8 : c5 03 __ CMP $03
+19ea : 90 02 __ BCC $19ee
+19ec : e5 03 __ SBC $03
+19ee : 26 1b __ ROL ACCU + 0
+19f0 : 2a __ __ ROL
+19f1 : c5 03 __ CMP $03
+19f3 : 90 02 __ BCC $19f7
+19f5 : e5 03 __ SBC $03
+19f7 : 26 1b __ ROL ACCU + 0
+19f9 : ca __ __ DEX
+19fa : d0 eb __ BNE $19e7
+19fc : 85 05 __ STA $05
+19fe : 60 __ __ RTS
+19ff : a5 1b __ LDA ACCU + 0
+1a01 : 85 05 __ STA $05
+1a03 : a5 1c __ LDA ACCU + 1
+1a05 : 85 06 __ STA $06
+1a07 : a9 00 __ LDA #$00
+1a09 : 85 1b __ STA ACCU + 0
+1a0b : 85 1c __ STA ACCU + 1
+1a0d : 60 __ __ RTS
+1a0e : a5 04 __ LDA $04
+1a10 : d0 1f __ BNE $1a31
+1a12 : a5 03 __ LDA $03
+1a14 : 30 1b __ BMI $1a31
+1a16 : a9 00 __ LDA #$00
+1a18 : 85 06 __ STA $06
+1a1a : a2 10 __ LDX #$10
+1a1c : 06 1b __ ASL ACCU + 0
+1a1e : 26 1c __ ROL ACCU + 1
+1a20 : 2a __ __ ROL
+1a21 : c5 03 __ CMP $03
+1a23 : 90 02 __ BCC $1a27
+1a25 : e5 03 __ SBC $03
+1a27 : 26 1b __ ROL ACCU + 0
+1a29 : 26 1c __ ROL ACCU + 1
+1a2b : ca __ __ DEX
+1a2c : d0 f2 __ BNE $1a20
+1a2e : 85 05 __ STA $05
+1a30 : 60 __ __ RTS
+1a31 : a9 00 __ LDA #$00
+1a33 : 85 05 __ STA $05
+1a35 : 85 06 __ STA $06
+1a37 : 84 02 __ STY $02
+1a39 : a0 10 __ LDY #$10
+1a3b : 18 __ __ CLC
+1a3c : 26 1b __ ROL ACCU + 0
+1a3e : 26 1c __ ROL ACCU + 1
+1a40 : 26 05 __ ROL $05
+1a42 : 26 06 __ ROL $06
+1a44 : 38 __ __ SEC
+1a45 : a5 05 __ LDA $05
+1a47 : e5 03 __ SBC $03
+1a49 : aa __ __ TAX
+1a4a : a5 06 __ LDA $06
+1a4c : e5 04 __ SBC $04
+1a4e : 90 04 __ BCC $1a54
+1a50 : 86 05 __ STX $05
+1a52 : 85 06 __ STA $06
+1a54 : 88 __ __ DEY
+1a55 : d0 e5 __ BNE $1a3c
+1a57 : 26 1b __ ROL ACCU + 0
+1a59 : 26 1c __ ROL ACCU + 1
+1a5b : a4 02 __ LDY $02
+1a5d : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1a5e : 20 b8 17 JSR $17b8 ; (freg + 36)
+1a61 : a5 07 __ LDA $07
+1a63 : c9 7f __ CMP #$7f
+1a65 : b0 07 __ BCS $1a6e
+1a67 : a9 00 __ LDA #$00
+1a69 : 85 1b __ STA ACCU + 0
+1a6b : 85 1c __ STA ACCU + 1
+1a6d : 60 __ __ RTS
+1a6e : 38 __ __ SEC
+1a6f : e9 8e __ SBC #$8e
+1a71 : 90 0a __ BCC $1a7d
+1a73 : a9 ff __ LDA #$ff
+1a75 : 85 1b __ STA ACCU + 0
+1a77 : a9 7f __ LDA #$7f
+1a79 : 85 1c __ STA ACCU + 1
+1a7b : d0 08 __ BNE $1a85
+1a7d : aa __ __ TAX
+1a7e : 46 1d __ LSR ACCU + 2
+1a80 : 66 1c __ ROR ACCU + 1
+1a82 : e8 __ __ INX
+1a83 : d0 f9 __ BNE $1a7e
+1a85 : 24 1e __ BIT ACCU + 3
+1a87 : 10 0e __ BPL $1a97
+1a89 : 38 __ __ SEC
+1a8a : a9 00 __ LDA #$00
+1a8c : e5 1c __ SBC ACCU + 1
+1a8e : 85 1b __ STA ACCU + 0
+1a90 : a9 00 __ LDA #$00
+1a92 : e5 1d __ SBC ACCU + 2
+1a94 : 85 1c __ STA ACCU + 1
+1a96 : 60 __ __ RTS
+1a97 : a5 1c __ LDA ACCU + 1
+1a99 : 85 1b __ STA ACCU + 0
+1a9b : a5 1d __ LDA ACCU + 2
+1a9d : 85 1c __ STA ACCU + 1
+1a9f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1aa0 : 24 1c __ BIT ACCU + 1
+1aa2 : 30 03 __ BMI $1aa7
+1aa4 : 4c be 1a JMP $1abe ; (uint16_to_float + 0)
+1aa7 : 38 __ __ SEC
+1aa8 : a9 00 __ LDA #$00
+1aaa : e5 1b __ SBC ACCU + 0
+1aac : 85 1b __ STA ACCU + 0
+1aae : a9 00 __ LDA #$00
+1ab0 : e5 1c __ SBC ACCU + 1
+1ab2 : 85 1c __ STA ACCU + 1
+1ab4 : 20 be 1a JSR $1abe ; (uint16_to_float + 0)
+1ab7 : a5 1e __ LDA ACCU + 3
+1ab9 : 09 80 __ ORA #$80
+1abb : 85 1e __ STA ACCU + 3
+1abd : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1abe : a5 1b __ LDA ACCU + 0
+1ac0 : 05 1c __ ORA ACCU + 1
+1ac2 : d0 05 __ BNE $1ac9
+1ac4 : 85 1d __ STA ACCU + 2
+1ac6 : 85 1e __ STA ACCU + 3
+1ac8 : 60 __ __ RTS
+1ac9 : a2 8e __ LDX #$8e
+1acb : a5 1c __ LDA ACCU + 1
+1acd : 30 06 __ BMI $1ad5
+1acf : ca __ __ DEX
+1ad0 : 06 1b __ ASL ACCU + 0
+1ad2 : 2a __ __ ROL
+1ad3 : 10 fa __ BPL $1acf
+1ad5 : 29 7f __ AND #$7f
+1ad7 : 85 1d __ STA ACCU + 2
+1ad9 : a5 1b __ LDA ACCU + 0
+1adb : 85 1c __ STA ACCU + 1
+1add : 8a __ __ TXA
+1ade : 4a __ __ LSR
+1adf : 85 1e __ STA ACCU + 3
+1ae1 : a9 00 __ LDA #$00
+1ae3 : 85 1b __ STA ACCU + 0
+1ae5 : 6a __ __ ROR
+1ae6 : 05 1d __ ORA ACCU + 2
+1ae8 : 85 1d __ STA ACCU + 2
+1aea : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1aeb : 38 __ __ SEC
+1aec : a9 00 __ LDA #$00
+1aee : e5 1b __ SBC ACCU + 0
+1af0 : 85 1b __ STA ACCU + 0
+1af2 : a9 00 __ LDA #$00
+1af4 : e5 1c __ SBC ACCU + 1
+1af6 : 85 1c __ STA ACCU + 1
+1af8 : a9 00 __ LDA #$00
+1afa : e5 1d __ SBC ACCU + 2
+1afc : 85 1d __ STA ACCU + 2
+1afe : a9 00 __ LDA #$00
+1b00 : e5 1e __ SBC ACCU + 3
+1b02 : 85 1e __ STA ACCU + 3
+1b04 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1b05 : 84 02 __ STY $02
+1b07 : a9 00 __ LDA #$00
+1b09 : 85 07 __ STA $07
+1b0b : 85 08 __ STA $08
+1b0d : 85 09 __ STA $09
+1b0f : 85 0a __ STA $0a
+1b11 : a0 20 __ LDY #$20
+1b13 : 18 __ __ CLC
+1b14 : 26 1b __ ROL ACCU + 0
+1b16 : 26 1c __ ROL ACCU + 1
+1b18 : 26 1d __ ROL ACCU + 2
+1b1a : 26 1e __ ROL ACCU + 3
+1b1c : 26 07 __ ROL $07
+1b1e : 26 08 __ ROL $08
+1b20 : 26 09 __ ROL $09
+1b22 : 26 0a __ ROL $0a
+1b24 : a5 07 __ LDA $07
+1b26 : c5 03 __ CMP $03
+1b28 : a5 08 __ LDA $08
+1b2a : e5 04 __ SBC $04
+1b2c : a5 09 __ LDA $09
+1b2e : e5 05 __ SBC $05
+1b30 : a5 0a __ LDA $0a
+1b32 : e5 06 __ SBC $06
+1b34 : 90 18 __ BCC $1b4e
+1b36 : a5 07 __ LDA $07
+1b38 : e5 03 __ SBC $03
+1b3a : 85 07 __ STA $07
+1b3c : a5 08 __ LDA $08
+1b3e : e5 04 __ SBC $04
+1b40 : 85 08 __ STA $08
+1b42 : a5 09 __ LDA $09
+1b44 : e5 05 __ SBC $05
+1b46 : 85 09 __ STA $09
+1b48 : a5 0a __ LDA $0a
+1b4a : e5 06 __ SBC $06
+1b4c : 85 0a __ STA $0a
+1b4e : 88 __ __ DEY
+1b4f : d0 c3 __ BNE $1b14
+1b51 : 26 1b __ ROL ACCU + 0
+1b53 : 26 1c __ ROL ACCU + 1
+1b55 : 26 1d __ ROL ACCU + 2
+1b57 : 26 1e __ ROL ACCU + 3
+1b59 : a4 02 __ LDY $02
+1b5b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1b5c : a9 00 __ LDA #$00
+1b5e : 85 1d __ STA ACCU + 2
+1b60 : 85 1e __ STA ACCU + 3
+1b62 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1b63 : b5 00 __ LDA $00,x
+1b65 : 85 03 __ STA $03
+1b67 : b5 01 __ LDA $01,x
+1b69 : 85 04 __ STA $04
+1b6b : b5 02 __ LDA $02,x
+1b6d : 85 05 __ STA $05
+1b6f : b5 03 __ LDA $03,x
+1b71 : 85 06 __ STA $06
+1b73 : 20 05 1b JSR $1b05 ; (divmod32 + 0)
+1b76 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1b77 : b5 00 __ LDA $00,x
+1b79 : 85 03 __ STA $03
+1b7b : b5 01 __ LDA $01,x
+1b7d : 85 04 __ STA $04
+1b7f : b5 02 __ LDA $02,x
+1b81 : 85 05 __ STA $05
+1b83 : b5 03 __ LDA $03,x
+1b85 : 85 06 __ STA $06
+1b87 : 20 05 1b JSR $1b05 ; (divmod32 + 0)
+1b8a : a5 07 __ LDA $07
+1b8c : 85 1b __ STA ACCU + 0
+1b8e : a5 08 __ LDA $08
+1b90 : 85 1c __ STA ACCU + 1
+1b92 : a5 09 __ LDA $09
+1b94 : 85 1d __ STA ACCU + 2
+1b96 : a5 0a __ LDA $0a
+1b98 : 85 1e __ STA ACCU + 3
+1b9a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1b9b : b5 03 __ LDA $03,x
+1b9d : c5 1e __ CMP ACCU + 3
+1b9f : d0 20 __ BNE $1bc1
+1ba1 : b5 02 __ LDA $02,x
+1ba3 : c5 1d __ CMP ACCU + 2
+1ba5 : d0 1a __ BNE $1bc1
+1ba7 : b5 01 __ LDA $01,x
+1ba9 : c5 1c __ CMP ACCU + 1
+1bab : d0 14 __ BNE $1bc1
+1bad : b5 00 __ LDA $00,x
+1baf : c5 1b __ CMP ACCU + 0
+1bb1 : d0 0e __ BNE $1bc1
+1bb3 : a9 00 __ LDA #$00
+1bb5 : 85 1b __ STA ACCU + 0
+1bb7 : 85 1c __ STA ACCU + 1
+1bb9 : 60 __ __ RTS
+1bba : a9 ff __ LDA #$ff
+1bbc : 85 1b __ STA ACCU + 0
+1bbe : 85 1c __ STA ACCU + 1
+1bc0 : 60 __ __ RTS
+1bc1 : 90 f7 __ BCC $1bba
+1bc3 : a9 01 __ LDA #$01
+1bc5 : 85 1b __ STA ACCU + 0
+1bc7 : a9 00 __ LDA #$00
+1bc9 : 85 1c __ STA ACCU + 1
+1bcb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1bcc : a5 1e __ LDA ACCU + 3
+1bce : 49 80 __ EOR #$80
+1bd0 : 85 1e __ STA ACCU + 3
+1bd2 : b5 03 __ LDA $03,x
+1bd4 : 49 80 __ EOR #$80
+1bd6 : c5 1e __ CMP ACCU + 3
+1bd8 : d0 20 __ BNE $1bfa
+1bda : b5 02 __ LDA $02,x
+1bdc : c5 1d __ CMP ACCU + 2
+1bde : d0 1a __ BNE $1bfa
+1be0 : b5 01 __ LDA $01,x
+1be2 : c5 1c __ CMP ACCU + 1
+1be4 : d0 14 __ BNE $1bfa
+1be6 : b5 00 __ LDA $00,x
+1be8 : c5 1b __ CMP ACCU + 0
+1bea : d0 0e __ BNE $1bfa
+1bec : a9 00 __ LDA #$00
+1bee : 85 1b __ STA ACCU + 0
+1bf0 : 85 1c __ STA ACCU + 1
+1bf2 : 60 __ __ RTS
+1bf3 : a9 ff __ LDA #$ff
+1bf5 : 85 1b __ STA ACCU + 0
+1bf7 : 85 1c __ STA ACCU + 1
+1bf9 : 60 __ __ RTS
+1bfa : 90 f7 __ BCC $1bf3
+1bfc : a9 01 __ LDA #$01
+1bfe : 85 1b __ STA ACCU + 0
+1c00 : a9 00 __ LDA #$00
+1c02 : 85 1c __ STA ACCU + 1
+1c04 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c05 : a9 4c __ LDA #$4c
+1c07 : 85 54 __ STA $54
+1c09 : a9 00 __ LDA #$00
+1c0b : 85 13 __ STA P6
+1c0d : a9 19 __ LDA #$19
+1c0f : 85 16 __ STA P9
+1c11 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1c12 : b1 19 __ LDA (IP + 0),y
+1c14 : aa __ __ TAX
+1c15 : c8 __ __ INY
+1c16 : b1 19 __ LDA (IP + 0),y
+1c18 : 95 00 __ STA $00,x
+1c1a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1c1d : b1 19 __ LDA (IP + 0),y
+1c1f : aa __ __ TAX
+1c20 : c8 __ __ INY
+1c21 : b1 19 __ LDA (IP + 0),y
+1c23 : 95 00 __ STA $00,x
+1c25 : a9 00 __ LDA #$00
+1c27 : 95 01 __ STA $01,x
+1c29 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1c2c : b1 19 __ LDA (IP + 0),y
+1c2e : aa __ __ TAX
+1c2f : c8 __ __ INY
+1c30 : b1 19 __ LDA (IP + 0),y
+1c32 : 95 00 __ STA $00,x
+1c34 : a9 ff __ LDA #$ff
+1c36 : 95 01 __ STA $01,x
+1c38 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1c3b : b1 19 __ LDA (IP + 0),y
+1c3d : aa __ __ TAX
+1c3e : c8 __ __ INY
+1c3f : b1 19 __ LDA (IP + 0),y
+1c41 : 95 00 __ STA $00,x
+1c43 : c8 __ __ INY
+1c44 : b1 19 __ LDA (IP + 0),y
+1c46 : 95 01 __ STA $01,x
+1c48 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1c4b : b1 19 __ LDA (IP + 0),y
+1c4d : aa __ __ TAX
+1c4e : c8 __ __ INY
+1c4f : b1 19 __ LDA (IP + 0),y
+1c51 : 95 00 __ STA $00,x
+1c53 : c8 __ __ INY
+1c54 : b1 19 __ LDA (IP + 0),y
+1c56 : 95 01 __ STA $01,x
+1c58 : c8 __ __ INY
+1c59 : b1 19 __ LDA (IP + 0),y
+1c5b : 95 02 __ STA $02,x
+1c5d : c8 __ __ INY
+1c5e : b1 19 __ LDA (IP + 0),y
+1c60 : 95 03 __ STA $03,x
+1c62 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1c65 : b1 19 __ LDA (IP + 0),y
+1c67 : aa __ __ TAX
+1c68 : b5 00 __ LDA $00,x
+1c6a : 85 1b __ STA ACCU + 0
+1c6c : a9 00 __ LDA #$00
+1c6e : 85 1c __ STA ACCU + 1
+1c70 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1c73 : b1 19 __ LDA (IP + 0),y
+1c75 : aa __ __ TAX
+1c76 : a5 1b __ LDA ACCU + 0
+1c78 : 95 00 __ STA $00,x
+1c7a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1c7d : b1 19 __ LDA (IP + 0),y
+1c7f : aa __ __ TAX
+1c80 : b5 00 __ LDA $00,x
+1c82 : 85 1b __ STA ACCU + 0
+1c84 : b5 01 __ LDA $01,x
+1c86 : 85 1c __ STA ACCU + 1
+1c88 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1c8b : b1 19 __ LDA (IP + 0),y
+1c8d : aa __ __ TAX
+1c8e : a5 1b __ LDA ACCU + 0
+1c90 : 95 00 __ STA $00,x
+1c92 : a5 1c __ LDA ACCU + 1
+1c94 : 95 01 __ STA $01,x
+1c96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1c99 : b1 19 __ LDA (IP + 0),y
+1c9b : aa __ __ TAX
+1c9c : b5 00 __ LDA $00,x
+1c9e : 85 1f __ STA ADDR + 0
+1ca0 : b5 01 __ LDA $01,x
+1ca2 : 85 20 __ STA ADDR + 1
+1ca4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1ca7 : b1 19 __ LDA (IP + 0),y
+1ca9 : aa __ __ TAX
+1caa : b5 00 __ LDA $00,x
+1cac : 85 1b __ STA ACCU + 0
+1cae : b5 01 __ LDA $01,x
+1cb0 : 85 1c __ STA ACCU + 1
+1cb2 : b5 02 __ LDA $02,x
+1cb4 : 85 1d __ STA ACCU + 2
+1cb6 : b5 03 __ LDA $03,x
+1cb8 : 85 1e __ STA ACCU + 3
+1cba : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1cbd : b1 19 __ LDA (IP + 0),y
+1cbf : aa __ __ TAX
+1cc0 : a5 1b __ LDA ACCU + 0
+1cc2 : 95 00 __ STA $00,x
+1cc4 : a5 1c __ LDA ACCU + 1
+1cc6 : 95 01 __ STA $01,x
+1cc8 : a5 1d __ LDA ACCU + 2
+1cca : 95 02 __ STA $02,x
+1ccc : a5 1e __ LDA ACCU + 3
+1cce : 95 03 __ STA $03,x
+1cd0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1cd3 : b1 19 __ LDA (IP + 0),y
+1cd5 : 85 1f __ STA ADDR + 0
+1cd7 : c8 __ __ INY
+1cd8 : b1 19 __ LDA (IP + 0),y
+1cda : 85 20 __ STA ADDR + 1
+1cdc : c8 __ __ INY
+1cdd : b1 19 __ LDA (IP + 0),y
+1cdf : aa __ __ TAX
+1ce0 : 84 02 __ STY $02
+1ce2 : a0 00 __ LDY #$00
+1ce4 : b1 1f __ LDA (ADDR + 0),y
+1ce6 : 95 00 __ STA $00,x
+1ce8 : a9 00 __ LDA #$00
+1cea : 95 01 __ STA $01,x
+1cec : a4 02 __ LDY $02
+1cee : 4c 50 08 JMP $0850 ; (startup + 79)
+1cf1 : b1 19 __ LDA (IP + 0),y
+1cf3 : aa __ __ TAX
+1cf4 : c8 __ __ INY
+1cf5 : b1 19 __ LDA (IP + 0),y
+1cf7 : 84 02 __ STY $02
+1cf9 : a8 __ __ TAY
+1cfa : 4c e4 1c JMP $1ce4 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1cfd : b1 19 __ LDA (IP + 0),y
+1cff : aa __ __ TAX
+1d00 : c8 __ __ INY
+1d01 : b1 19 __ LDA (IP + 0),y
+1d03 : 95 00 __ STA $00,x
+1d05 : c8 __ __ INY
+1d06 : b1 19 __ LDA (IP + 0),y
+1d08 : 95 01 __ STA $01,x
+1d0a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1d0d : b1 19 __ LDA (IP + 0),y
+1d0f : aa __ __ TAX
+1d10 : c8 __ __ INY
+1d11 : 18 __ __ CLC
+1d12 : b5 00 __ LDA $00,x
+1d14 : 71 19 __ ADC (IP + 0),y
+1d16 : 85 1f __ STA ADDR + 0
+1d18 : c8 __ __ INY
+1d19 : b5 01 __ LDA $01,x
+1d1b : 71 19 __ ADC (IP + 0),y
+1d1d : 85 20 __ STA ADDR + 1
+1d1f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1d22 : b1 19 __ LDA (IP + 0),y
+1d24 : aa __ __ TAX
+1d25 : 18 __ __ CLC
+1d26 : b5 00 __ LDA $00,x
+1d28 : 65 1b __ ADC ACCU + 0
+1d2a : 85 1f __ STA ADDR + 0
+1d2c : b5 01 __ LDA $01,x
+1d2e : 65 1c __ ADC ACCU + 1
+1d30 : 85 20 __ STA ADDR + 1
+1d32 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1d35 : b1 19 __ LDA (IP + 0),y
+1d37 : aa __ __ TAX
+1d38 : c8 __ __ INY
+1d39 : b1 19 __ LDA (IP + 0),y
+1d3b : 84 02 __ STY $02
+1d3d : a8 __ __ TAY
+1d3e : b1 25 __ LDA (FP + 0),y
+1d40 : 95 00 __ STA $00,x
+1d42 : a4 02 __ LDY $02
+1d44 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1d47 : b1 19 __ LDA (IP + 0),y
+1d49 : aa __ __ TAX
+1d4a : c8 __ __ INY
+1d4b : b1 19 __ LDA (IP + 0),y
+1d4d : 84 02 __ STY $02
+1d4f : a8 __ __ TAY
+1d50 : b1 25 __ LDA (FP + 0),y
+1d52 : 95 00 __ STA $00,x
+1d54 : a9 00 __ LDA #$00
+1d56 : 95 01 __ STA $01,x
+1d58 : a4 02 __ LDY $02
+1d5a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1d5d : b1 19 __ LDA (IP + 0),y
+1d5f : aa __ __ TAX
+1d60 : c8 __ __ INY
+1d61 : b1 19 __ LDA (IP + 0),y
+1d63 : 84 02 __ STY $02
+1d65 : a8 __ __ TAY
+1d66 : b1 25 __ LDA (FP + 0),y
+1d68 : 95 00 __ STA $00,x
+1d6a : c8 __ __ INY
+1d6b : b1 25 __ LDA (FP + 0),y
+1d6d : 95 01 __ STA $01,x
+1d6f : a4 02 __ LDY $02
+1d71 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1d74 : b1 19 __ LDA (IP + 0),y
+1d76 : aa __ __ TAX
+1d77 : c8 __ __ INY
+1d78 : b1 19 __ LDA (IP + 0),y
+1d7a : 84 02 __ STY $02
+1d7c : a8 __ __ TAY
+1d7d : b5 00 __ LDA $00,x
+1d7f : 91 25 __ STA (FP + 0),y
+1d81 : a4 02 __ LDY $02
+1d83 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1d86 : b1 19 __ LDA (IP + 0),y
+1d88 : aa __ __ TAX
+1d89 : c8 __ __ INY
+1d8a : b1 19 __ LDA (IP + 0),y
+1d8c : 84 02 __ STY $02
+1d8e : a8 __ __ TAY
+1d8f : b5 00 __ LDA $00,x
+1d91 : 91 25 __ STA (FP + 0),y
+1d93 : c8 __ __ INY
+1d94 : b5 01 __ LDA $01,x
+1d96 : 91 25 __ STA (FP + 0),y
+1d98 : a4 02 __ LDY $02
+1d9a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1d9d : b1 19 __ LDA (IP + 0),y
+1d9f : aa __ __ TAX
+1da0 : c8 __ __ INY
+1da1 : 18 __ __ CLC
+1da2 : b1 19 __ LDA (IP + 0),y
+1da4 : 65 25 __ ADC FP + 0
+1da6 : 95 00 __ STA $00,x
+1da8 : c8 __ __ INY
+1da9 : b1 19 __ LDA (IP + 0),y
+1dab : 65 26 __ ADC FP + 1
+1dad : 95 01 __ STA $01,x
+1daf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1db2 : b1 19 __ LDA (IP + 0),y
+1db4 : aa __ __ TAX
+1db5 : c8 __ __ INY
+1db6 : b1 19 __ LDA (IP + 0),y
+1db8 : 84 02 __ STY $02
+1dba : a8 __ __ TAY
+1dbb : b5 00 __ LDA $00,x
+1dbd : 91 23 __ STA (SP + 0),y
+1dbf : a4 02 __ LDY $02
+1dc1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1dc4 : b1 19 __ LDA (IP + 0),y
+1dc6 : aa __ __ TAX
+1dc7 : c8 __ __ INY
+1dc8 : b1 19 __ LDA (IP + 0),y
+1dca : 84 02 __ STY $02
+1dcc : a8 __ __ TAY
+1dcd : b5 00 __ LDA $00,x
+1dcf : 91 23 __ STA (SP + 0),y
+1dd1 : c8 __ __ INY
+1dd2 : b5 01 __ LDA $01,x
+1dd4 : 91 23 __ STA (SP + 0),y
+1dd6 : a4 02 __ LDY $02
+1dd8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1ddb : b1 19 __ LDA (IP + 0),y
+1ddd : aa __ __ TAX
+1dde : c8 __ __ INY
+1ddf : b1 19 __ LDA (IP + 0),y
+1de1 : 84 02 __ STY $02
+1de3 : a8 __ __ TAY
+1de4 : b5 00 __ LDA $00,x
+1de6 : 91 23 __ STA (SP + 0),y
+1de8 : c8 __ __ INY
+1de9 : b5 01 __ LDA $01,x
+1deb : 91 23 __ STA (SP + 0),y
+1ded : c8 __ __ INY
+1dee : b5 02 __ LDA $02,x
+1df0 : 91 23 __ STA (SP + 0),y
+1df2 : c8 __ __ INY
+1df3 : b5 03 __ LDA $03,x
+1df5 : 91 23 __ STA (SP + 0),y
+1df7 : a4 02 __ LDY $02
+1df9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1dfc : b1 19 __ LDA (IP + 0),y
+1dfe : 85 1f __ STA ADDR + 0
+1e00 : c8 __ __ INY
+1e01 : b1 19 __ LDA (IP + 0),y
+1e03 : 85 20 __ STA ADDR + 1
+1e05 : c8 __ __ INY
+1e06 : b1 19 __ LDA (IP + 0),y
+1e08 : aa __ __ TAX
+1e09 : 84 02 __ STY $02
+1e0b : a0 00 __ LDY #$00
+1e0d : b1 1f __ LDA (ADDR + 0),y
+1e0f : 95 00 __ STA $00,x
+1e11 : a4 02 __ LDY $02
+1e13 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e16 : b1 19 __ LDA (IP + 0),y
+1e18 : aa __ __ TAX
+1e19 : c8 __ __ INY
+1e1a : b1 19 __ LDA (IP + 0),y
+1e1c : 84 02 __ STY $02
+1e1e : a8 __ __ TAY
+1e1f : 4c 0d 1e JMP $1e0d ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1e22 : b1 19 __ LDA (IP + 0),y
+1e24 : 85 1f __ STA ADDR + 0
+1e26 : c8 __ __ INY
+1e27 : b1 19 __ LDA (IP + 0),y
+1e29 : 85 20 __ STA ADDR + 1
+1e2b : c8 __ __ INY
+1e2c : b1 19 __ LDA (IP + 0),y
+1e2e : aa __ __ TAX
+1e2f : 84 02 __ STY $02
+1e31 : a0 00 __ LDY #$00
+1e33 : b1 1f __ LDA (ADDR + 0),y
+1e35 : 95 00 __ STA $00,x
+1e37 : c8 __ __ INY
+1e38 : b1 1f __ LDA (ADDR + 0),y
+1e3a : 95 01 __ STA $01,x
+1e3c : a4 02 __ LDY $02
+1e3e : 4c 50 08 JMP $0850 ; (startup + 79)
+1e41 : b1 19 __ LDA (IP + 0),y
+1e43 : aa __ __ TAX
+1e44 : c8 __ __ INY
+1e45 : b1 19 __ LDA (IP + 0),y
+1e47 : 84 02 __ STY $02
+1e49 : a8 __ __ TAY
+1e4a : 4c 33 1e JMP $1e33 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1e4d : b1 19 __ LDA (IP + 0),y
+1e4f : 85 1f __ STA ADDR + 0
+1e51 : c8 __ __ INY
+1e52 : b1 19 __ LDA (IP + 0),y
+1e54 : 85 20 __ STA ADDR + 1
+1e56 : c8 __ __ INY
+1e57 : b1 19 __ LDA (IP + 0),y
+1e59 : aa __ __ TAX
+1e5a : 84 02 __ STY $02
+1e5c : a0 00 __ LDY #$00
+1e5e : b1 1f __ LDA (ADDR + 0),y
+1e60 : 95 00 __ STA $00,x
+1e62 : c8 __ __ INY
+1e63 : b1 1f __ LDA (ADDR + 0),y
+1e65 : 95 01 __ STA $01,x
+1e67 : c8 __ __ INY
+1e68 : b1 1f __ LDA (ADDR + 0),y
+1e6a : 95 02 __ STA $02,x
+1e6c : c8 __ __ INY
+1e6d : b1 1f __ LDA (ADDR + 0),y
+1e6f : 95 03 __ STA $03,x
+1e71 : a4 02 __ LDY $02
+1e73 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e76 : b1 19 __ LDA (IP + 0),y
+1e78 : aa __ __ TAX
+1e79 : c8 __ __ INY
+1e7a : b1 19 __ LDA (IP + 0),y
+1e7c : 84 02 __ STY $02
+1e7e : a8 __ __ TAY
+1e7f : 4c 5e 1e JMP $1e5e ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1e82 : b1 19 __ LDA (IP + 0),y
+1e84 : 85 1f __ STA ADDR + 0
+1e86 : c8 __ __ INY
+1e87 : b1 19 __ LDA (IP + 0),y
+1e89 : 85 20 __ STA ADDR + 1
+1e8b : c8 __ __ INY
+1e8c : b1 19 __ LDA (IP + 0),y
+1e8e : aa __ __ TAX
+1e8f : 84 02 __ STY $02
+1e91 : a0 00 __ LDY #$00
+1e93 : b5 00 __ LDA $00,x
+1e95 : 91 1f __ STA (ADDR + 0),y
+1e97 : a4 02 __ LDY $02
+1e99 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e9c : b1 19 __ LDA (IP + 0),y
+1e9e : aa __ __ TAX
+1e9f : c8 __ __ INY
+1ea0 : b1 19 __ LDA (IP + 0),y
+1ea2 : 84 02 __ STY $02
+1ea4 : a8 __ __ TAY
+1ea5 : 4c 93 1e JMP $1e93 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1ea8 : b1 19 __ LDA (IP + 0),y
+1eaa : aa __ __ TAX
+1eab : 18 __ __ CLC
+1eac : a5 1b __ LDA ACCU + 0
+1eae : 75 00 __ ADC $00,x
+1eb0 : 85 1b __ STA ACCU + 0
+1eb2 : a5 1c __ LDA ACCU + 1
+1eb4 : 75 01 __ ADC $01,x
+1eb6 : 85 1c __ STA ACCU + 1
+1eb8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1ebb : b1 19 __ LDA (IP + 0),y
+1ebd : aa __ __ TAX
+1ebe : 38 __ __ SEC
+1ebf : a5 1b __ LDA ACCU + 0
+1ec1 : f5 00 __ SBC $00,x
+1ec3 : 85 1b __ STA ACCU + 0
+1ec5 : a5 1c __ LDA ACCU + 1
+1ec7 : f5 01 __ SBC $01,x
+1ec9 : 85 1c __ STA ACCU + 1
+1ecb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+1ece : b1 19 __ LDA (IP + 0),y
+1ed0 : aa __ __ TAX
+1ed1 : a9 00 __ LDA #$00
+1ed3 : 85 05 __ STA $05
+1ed5 : 85 06 __ STA $06
+1ed7 : b5 00 __ LDA $00,x
+1ed9 : 85 03 __ STA $03
+1edb : b5 01 __ LDA $01,x
+1edd : 85 04 __ STA $04
+1edf : a2 10 __ LDX #$10
+1ee1 : 46 04 __ LSR $04
+1ee3 : 66 03 __ ROR $03
+1ee5 : 90 0d __ BCC $1ef4
+1ee7 : 18 __ __ CLC
+1ee8 : a5 05 __ LDA $05
+1eea : 65 1b __ ADC ACCU + 0
+1eec : 85 05 __ STA $05
+1eee : a5 06 __ LDA $06
+1ef0 : 65 1c __ ADC ACCU + 1
+1ef2 : 85 06 __ STA $06
+1ef4 : 06 1b __ ASL ACCU + 0
+1ef6 : 26 1c __ ROL ACCU + 1
+1ef8 : ca __ __ DEX
+1ef9 : d0 e6 __ BNE $1ee1
+1efb : a5 05 __ LDA $05
+1efd : 85 1b __ STA ACCU + 0
+1eff : a5 06 __ LDA $06
+1f01 : 85 1c __ STA ACCU + 1
+1f03 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1f06 : b1 19 __ LDA (IP + 0),y
+1f08 : aa __ __ TAX
+1f09 : b5 00 __ LDA $00,x
+1f0b : 85 03 __ STA $03
+1f0d : b5 01 __ LDA $01,x
+1f0f : 85 04 __ STA $04
+1f11 : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f14 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1f17 : b1 19 __ LDA (IP + 0),y
+1f19 : aa __ __ TAX
+1f1a : b5 00 __ LDA $00,x
+1f1c : 85 03 __ STA $03
+1f1e : b5 01 __ LDA $01,x
+1f20 : 85 04 __ STA $04
+1f22 : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f25 : a5 05 __ LDA $05
+1f27 : 85 1b __ STA ACCU + 0
+1f29 : a5 06 __ LDA $06
+1f2b : 85 1c __ STA ACCU + 1
+1f2d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1f30 : b1 19 __ LDA (IP + 0),y
+1f32 : aa __ __ TAX
+1f33 : b5 00 __ LDA $00,x
+1f35 : 85 03 __ STA $03
+1f37 : b5 01 __ LDA $01,x
+1f39 : 85 04 __ STA $04
+1f3b : 24 1c __ BIT ACCU + 1
+1f3d : 10 10 __ BPL $1f4f
+1f3f : 20 bd 19 JSR $19bd ; (negaccu + 0)
+1f42 : 24 04 __ BIT $04
+1f44 : 10 10 __ BPL $1f56
+1f46 : 20 cb 19 JSR $19cb ; (negtmp + 0)
+1f49 : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f4c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f4f : 24 04 __ BIT $04
+1f51 : 10 f6 __ BPL $1f49
+1f53 : 20 cb 19 JSR $19cb ; (negtmp + 0)
+1f56 : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f59 : 20 bd 19 JSR $19bd ; (negaccu + 0)
+1f5c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1f5f : b1 19 __ LDA (IP + 0),y
+1f61 : aa __ __ TAX
+1f62 : b5 00 __ LDA $00,x
+1f64 : 85 03 __ STA $03
+1f66 : b5 01 __ LDA $01,x
+1f68 : 85 04 __ STA $04
+1f6a : 24 1c __ BIT ACCU + 1
+1f6c : 10 18 __ BPL $1f86
+1f6e : 20 bd 19 JSR $19bd ; (negaccu + 0)
+1f71 : 24 04 __ BIT $04
+1f73 : 10 18 __ BPL $1f8d
+1f75 : 20 cb 19 JSR $19cb ; (negtmp + 0)
+1f78 : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f7b : a5 05 __ LDA $05
+1f7d : 85 1b __ STA ACCU + 0
+1f7f : a5 06 __ LDA $06
+1f81 : 85 1c __ STA ACCU + 1
+1f83 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f86 : 24 04 __ BIT $04
+1f88 : 10 ee __ BPL $1f78
+1f8a : 20 cb 19 JSR $19cb ; (negtmp + 0)
+1f8d : 20 d9 19 JSR $19d9 ; (divmod + 0)
+1f90 : a5 05 __ LDA $05
+1f92 : 85 1b __ STA ACCU + 0
+1f94 : a5 06 __ LDA $06
+1f96 : 85 1c __ STA ACCU + 1
+1f98 : 20 bd 19 JSR $19bd ; (negaccu + 0)
+1f9b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1f9e : b1 19 __ LDA (IP + 0),y
+1fa0 : aa __ __ TAX
+1fa1 : 18 __ __ CLC
+1fa2 : b5 00 __ LDA $00,x
+1fa4 : 65 1b __ ADC ACCU + 0
+1fa6 : 95 00 __ STA $00,x
+1fa8 : b5 01 __ LDA $01,x
+1faa : 65 1c __ ADC ACCU + 1
+1fac : 95 01 __ STA $01,x
+1fae : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1fb1 : b1 19 __ LDA (IP + 0),y
+1fb3 : c8 __ __ INY
+1fb4 : aa __ __ TAX
+1fb5 : 18 __ __ CLC
+1fb6 : b5 00 __ LDA $00,x
+1fb8 : 71 19 __ ADC (IP + 0),y
+1fba : c8 __ __ INY
+1fbb : 95 00 __ STA $00,x
+1fbd : b5 01 __ LDA $01,x
+1fbf : 71 19 __ ADC (IP + 0),y
+1fc1 : 95 01 __ STA $01,x
+1fc3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1fc6 : b1 19 __ LDA (IP + 0),y
+1fc8 : c8 __ __ INY
+1fc9 : aa __ __ TAX
+1fca : 38 __ __ SEC
+1fcb : b1 19 __ LDA (IP + 0),y
+1fcd : c8 __ __ INY
+1fce : f5 00 __ SBC $00,x
+1fd0 : 95 00 __ STA $00,x
+1fd2 : b1 19 __ LDA (IP + 0),y
+1fd4 : f5 01 __ SBC $01,x
+1fd6 : 95 01 __ STA $01,x
+1fd8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1fdb : b1 19 __ LDA (IP + 0),y
+1fdd : c8 __ __ INY
+1fde : aa __ __ TAX
+1fdf : b5 00 __ LDA $00,x
+1fe1 : 31 19 __ AND (IP + 0),y
+1fe3 : c8 __ __ INY
+1fe4 : 95 00 __ STA $00,x
+1fe6 : b5 01 __ LDA $01,x
+1fe8 : 31 19 __ AND (IP + 0),y
+1fea : 95 01 __ STA $01,x
+1fec : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1fef : b1 19 __ LDA (IP + 0),y
+1ff1 : c8 __ __ INY
+1ff2 : aa __ __ TAX
+1ff3 : a9 00 __ LDA #$00
+1ff5 : 85 05 __ STA $05
+1ff7 : 85 06 __ STA $06
+1ff9 : b5 00 __ LDA $00,x
+1ffb : 85 03 __ STA $03
+1ffd : b5 01 __ LDA $01,x
+1fff : 85 04 __ STA $04
+2001 : b1 19 __ LDA (IP + 0),y
+2003 : 4a __ __ LSR
+2004 : 85 07 __ STA $07
+2006 : 90 0d __ BCC $2015
+2008 : 18 __ __ CLC
+2009 : a5 05 __ LDA $05
+200b : 65 03 __ ADC $03
+200d : 85 05 __ STA $05
+200f : a5 06 __ LDA $06
+2011 : 65 04 __ ADC $04
+2013 : 85 06 __ STA $06
+2015 : 06 03 __ ASL $03
+2017 : 26 04 __ ROL $04
+2019 : 46 07 __ LSR $07
+201b : b0 eb __ BCS $2008
+201d : d0 f6 __ BNE $2015
+201f : a5 05 __ LDA $05
+2021 : 95 00 __ STA $00,x
+2023 : a5 06 __ LDA $06
+2025 : 95 01 __ STA $01,x
+2027 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+202a : b1 19 __ LDA (IP + 0),y
+202c : c8 __ __ INY
+202d : aa __ __ TAX
+202e : 18 __ __ CLC
+202f : b5 00 __ LDA $00,x
+2031 : 71 19 __ ADC (IP + 0),y
+2033 : 95 00 __ STA $00,x
+2035 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+2038 : b1 19 __ LDA (IP + 0),y
+203a : aa __ __ TAX
+203b : 38 __ __ SEC
+203c : b5 01 __ LDA $01,x
+203e : e5 1c __ SBC ACCU + 1
+2040 : f0 11 __ BEQ $2053
+2042 : 50 02 __ BVC $2046
+2044 : 49 80 __ EOR #$80
+2046 : 30 2a __ BMI $2072
+2048 : 10 33 __ BPL $207d
+204a : b1 19 __ LDA (IP + 0),y
+204c : aa __ __ TAX
+204d : b5 01 __ LDA $01,x
+204f : c5 1c __ CMP ACCU + 1
+2051 : d0 28 __ BNE $207b
+2053 : b5 00 __ LDA $00,x
+2055 : c5 1b __ CMP ACCU + 0
+2057 : d0 22 __ BNE $207b
+2059 : f0 0e __ BEQ $2069
+205b : b1 19 __ LDA (IP + 0),y
+205d : aa __ __ TAX
+205e : c8 __ __ INY
+205f : b1 19 __ LDA (IP + 0),y
+2061 : c5 1c __ CMP ACCU + 1
+2063 : d0 16 __ BNE $207b
+2065 : e4 1b __ CPX ACCU + 0
+2067 : d0 12 __ BNE $207b
+2069 : a9 00 __ LDA #$00
+206b : 85 1b __ STA ACCU + 0
+206d : 85 1c __ STA ACCU + 1
+206f : 4c 50 08 JMP $0850 ; (startup + 79)
+2072 : a9 ff __ LDA #$ff
+2074 : 85 1b __ STA ACCU + 0
+2076 : 85 1c __ STA ACCU + 1
+2078 : 4c 50 08 JMP $0850 ; (startup + 79)
+207b : 90 f5 __ BCC $2072
+207d : a9 01 __ LDA #$01
+207f : 85 1b __ STA ACCU + 0
+2081 : a9 00 __ LDA #$00
+2083 : 85 1c __ STA ACCU + 1
+2085 : 4c 50 08 JMP $0850 ; (startup + 79)
+2088 : b1 19 __ LDA (IP + 0),y
+208a : c8 __ __ INY
+208b : aa __ __ TAX
+208c : b1 19 __ LDA (IP + 0),y
+208e : 38 __ __ SEC
+208f : e5 1c __ SBC ACCU + 1
+2091 : d0 af __ BNE $2042
+2093 : e4 1b __ CPX ACCU + 0
+2095 : d0 e4 __ BNE $207b
+2097 : f0 d0 __ BEQ $2069
+2099 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+209a : b1 19 __ LDA (IP + 0),y
+209c : aa __ __ TAX
+209d : 38 __ __ SEC
+209e : b5 00 __ LDA $00,x
+20a0 : e5 1b __ SBC ACCU + 0
+20a2 : f0 19 __ BEQ $20bd
+20a4 : 50 02 __ BVC $20a8
+20a6 : 49 80 __ EOR #$80
+20a8 : 30 1c __ BMI $20c6
+20aa : 10 25 __ BPL $20d1
+20ac : b1 19 __ LDA (IP + 0),y
+20ae : aa __ __ TAX
+20af : b5 00 __ LDA $00,x
+20b1 : c5 1b __ CMP ACCU + 0
+20b3 : d0 1a __ BNE $20cf
+20b5 : f0 06 __ BEQ $20bd
+20b7 : b1 19 __ LDA (IP + 0),y
+20b9 : c5 1b __ CMP ACCU + 0
+20bb : d0 12 __ BNE $20cf
+20bd : a9 00 __ LDA #$00
+20bf : 85 1b __ STA ACCU + 0
+20c1 : 85 1c __ STA ACCU + 1
+20c3 : 4c 50 08 JMP $0850 ; (startup + 79)
+20c6 : a9 ff __ LDA #$ff
+20c8 : 85 1b __ STA ACCU + 0
+20ca : 85 1c __ STA ACCU + 1
+20cc : 4c 50 08 JMP $0850 ; (startup + 79)
+20cf : 90 f5 __ BCC $20c6
+20d1 : a9 01 __ LDA #$01
+20d3 : 85 1b __ STA ACCU + 0
+20d5 : a9 00 __ LDA #$00
+20d7 : 85 1c __ STA ACCU + 1
+20d9 : 4c 50 08 JMP $0850 ; (startup + 79)
+20dc : b1 19 __ LDA (IP + 0),y
+20de : 38 __ __ SEC
+20df : e5 1b __ SBC ACCU + 0
+20e1 : d0 c1 __ BNE $20a4
+20e3 : f0 d8 __ BEQ $20bd
+20e5 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+20e6 : 38 __ __ SEC
+20e7 : a9 00 __ LDA #$00
+20e9 : e5 1b __ SBC ACCU + 0
+20eb : 85 1b __ STA ACCU + 0
+20ed : a9 00 __ LDA #$00
+20ef : e5 1c __ SBC ACCU + 1
+20f1 : 85 1c __ STA ACCU + 1
+20f3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+20f6 : 20 94 17 JSR $1794 ; (freg + 0)
+20f9 : 20 d9 17 JSR $17d9 ; (faddsub + 0)
+20fc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+20ff : 20 94 17 JSR $1794 ; (freg + 0)
+2102 : a5 06 __ LDA $06
+2104 : 49 80 __ EOR #$80
+2106 : 85 06 __ STA $06
+2108 : 20 d9 17 JSR $17d9 ; (faddsub + 0)
+210b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+210e : 20 94 17 JSR $1794 ; (freg + 0)
+2111 : 84 02 __ STY $02
+2113 : 20 a1 18 JSR $18a1 ; (fmul + 0)
+2116 : a4 02 __ LDY $02
+2118 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+211b : 20 94 17 JSR $1794 ; (freg + 0)
+211e : 20 3f 19 JSR $193f ; (fdiv + 0)
+2121 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+2124 : b1 19 __ LDA (IP + 0),y
+2126 : c8 __ __ INY
+2127 : aa __ __ TAX
+2128 : a5 1e __ LDA ACCU + 3
+212a : 55 03 __ EOR $03,x
+212c : 29 80 __ AND #$80
+212e : f0 1e __ BEQ $214e
+2130 : a5 1e __ LDA ACCU + 3
+2132 : 29 7f __ AND #$7f
+2134 : 05 1d __ ORA ACCU + 2
+2136 : 05 1c __ ORA ACCU + 1
+2138 : 05 1b __ ORA ACCU + 0
+213a : d0 0c __ BNE $2148
+213c : b5 03 __ LDA $03,x
+213e : 29 7f __ AND #$7f
+2140 : 15 02 __ ORA $02,x
+2142 : 15 01 __ ORA $01,x
+2144 : 15 00 __ ORA $00,x
+2146 : f0 1e __ BEQ $2166
+2148 : a5 1e __ LDA ACCU + 3
+214a : 30 29 __ BMI $2175
+214c : 10 36 __ BPL $2184
+214e : a5 1e __ LDA ACCU + 3
+2150 : d5 03 __ CMP $03,x
+2152 : d0 1b __ BNE $216f
+2154 : a5 1d __ LDA ACCU + 2
+2156 : d5 02 __ CMP $02,x
+2158 : d0 15 __ BNE $216f
+215a : a5 1c __ LDA ACCU + 1
+215c : d5 01 __ CMP $01,x
+215e : d0 0f __ BNE $216f
+2160 : a5 1b __ LDA ACCU + 0
+2162 : d5 00 __ CMP $00,x
+2164 : d0 09 __ BNE $216f
+2166 : a9 00 __ LDA #$00
+2168 : 85 1b __ STA ACCU + 0
+216a : 85 1c __ STA ACCU + 1
+216c : 4c 51 08 JMP $0851 ; (startup + 80)
+216f : b0 0f __ BCS $2180
+2171 : 24 1e __ BIT ACCU + 3
+2173 : 30 0f __ BMI $2184
+2175 : a9 00 __ LDA #$00
+2177 : 85 1c __ STA ACCU + 1
+2179 : a9 01 __ LDA #$01
+217b : 85 1b __ STA ACCU + 0
+217d : 4c 51 08 JMP $0851 ; (startup + 80)
+2180 : 24 1e __ BIT ACCU + 3
+2182 : 30 f1 __ BMI $2175
+2184 : a9 ff __ LDA #$ff
+2186 : 85 1b __ STA ACCU + 0
+2188 : 85 1c __ STA ACCU + 1
+218a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+218d : a5 1e __ LDA ACCU + 3
+218f : 49 80 __ EOR #$80
+2191 : 85 1e __ STA ACCU + 3
+2193 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+2196 : 20 a0 1a JSR $1aa0 ; (sint16_to_float + 0)
+2199 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+219c : 20 5e 1a JSR $1a5e ; (f32_to_i16 + 0)
+219f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+21a2 : b1 19 __ LDA (IP + 0),y
+21a4 : 30 0c __ BMI $21b2
+21a6 : 38 __ __ SEC
+21a7 : 65 19 __ ADC IP + 0
+21a9 : 85 19 __ STA IP + 0
+21ab : 90 02 __ BCC $21af
+21ad : e6 1a __ INC IP + 1
+21af : 4c 51 08 JMP $0851 ; (startup + 80)
+21b2 : 38 __ __ SEC
+21b3 : 65 19 __ ADC IP + 0
+21b5 : 85 19 __ STA IP + 0
+21b7 : b0 02 __ BCS $21bb
+21b9 : c6 1a __ DEC IP + 1
+21bb : 4c 51 08 JMP $0851 ; (startup + 80)
+21be : a5 1b __ LDA ACCU + 0
+21c0 : 05 1c __ ORA ACCU + 1
+21c2 : f0 de __ BEQ $21a2
+21c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+21c7 : a5 1b __ LDA ACCU + 0
+21c9 : 05 1c __ ORA ACCU + 1
+21cb : d0 d5 __ BNE $21a2
+21cd : 4c 50 08 JMP $0850 ; (startup + 79)
+21d0 : a5 1c __ LDA ACCU + 1
+21d2 : 30 04 __ BMI $21d8
+21d4 : 05 1b __ ORA ACCU + 0
+21d6 : d0 ca __ BNE $21a2
+21d8 : 4c 50 08 JMP $0850 ; (startup + 79)
+21db : a5 1c __ LDA ACCU + 1
+21dd : 10 c3 __ BPL $21a2
+21df : 4c 50 08 JMP $0850 ; (startup + 79)
+21e2 : a5 1c __ LDA ACCU + 1
+21e4 : 30 bc __ BMI $21a2
+21e6 : 4c 50 08 JMP $0850 ; (startup + 79)
+21e9 : a5 1c __ LDA ACCU + 1
+21eb : 30 b5 __ BMI $21a2
+21ed : 05 1b __ ORA ACCU + 0
+21ef : f0 b1 __ BEQ $21a2
+21f1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+21f4 : 38 __ __ SEC
+21f5 : b1 19 __ LDA (IP + 0),y
+21f7 : 65 19 __ ADC IP + 0
+21f9 : aa __ __ TAX
+21fa : c8 __ __ INY
+21fb : b1 19 __ LDA (IP + 0),y
+21fd : 65 1a __ ADC IP + 1
+21ff : 85 1a __ STA IP + 1
+2201 : 86 19 __ STX IP + 0
+2203 : 4c 51 08 JMP $0851 ; (startup + 80)
+2206 : a5 1b __ LDA ACCU + 0
+2208 : 05 1c __ ORA ACCU + 1
+220a : f0 e8 __ BEQ $21f4
+220c : c8 __ __ INY
+220d : 4c 50 08 JMP $0850 ; (startup + 79)
+2210 : a5 1b __ LDA ACCU + 0
+2212 : 05 1c __ ORA ACCU + 1
+2214 : d0 de __ BNE $21f4
+2216 : c8 __ __ INY
+2217 : 4c 50 08 JMP $0850 ; (startup + 79)
+221a : a5 1c __ LDA ACCU + 1
+221c : 30 04 __ BMI $2222
+221e : 05 1b __ ORA ACCU + 0
+2220 : d0 d2 __ BNE $21f4
+2222 : c8 __ __ INY
+2223 : 4c 50 08 JMP $0850 ; (startup + 79)
+2226 : a5 1c __ LDA ACCU + 1
+2228 : 10 ca __ BPL $21f4
+222a : c8 __ __ INY
+222b : 4c 50 08 JMP $0850 ; (startup + 79)
+222e : a5 1c __ LDA ACCU + 1
+2230 : 30 c2 __ BMI $21f4
+2232 : c8 __ __ INY
+2233 : 4c 50 08 JMP $0850 ; (startup + 79)
+2236 : a5 1c __ LDA ACCU + 1
+2238 : 30 ba __ BMI $21f4
+223a : 05 1b __ ORA ACCU + 0
+223c : f0 b6 __ BEQ $21f4
+223e : c8 __ __ INY
+223f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2242 : a9 00 __ LDA #$00
+2244 : 2c a9 01 BIT $01a9 
+2247 : 85 1b __ STA ACCU + 0
+2249 : a9 00 __ LDA #$00
+224b : 85 1c __ STA ACCU + 1
+224d : 4c 51 08 JMP $0851 ; (startup + 80)
+2250 : a5 1b __ LDA ACCU + 0
+2252 : 05 1c __ ORA ACCU + 1
+2254 : f0 ef __ BEQ $2245
+2256 : d0 ea __ BNE $2242
+2258 : a5 1b __ LDA ACCU + 0
+225a : 05 1c __ ORA ACCU + 1
+225c : d0 e7 __ BNE $2245
+225e : f0 e2 __ BEQ $2242
+2260 : a5 1c __ LDA ACCU + 1
+2262 : 30 de __ BMI $2242
+2264 : 05 1b __ ORA ACCU + 0
+2266 : d0 dd __ BNE $2245
+2268 : f0 d8 __ BEQ $2242
+226a : a5 1c __ LDA ACCU + 1
+226c : 10 d7 __ BPL $2245
+226e : 30 d2 __ BMI $2242
+2270 : a5 1c __ LDA ACCU + 1
+2272 : 30 d1 __ BMI $2245
+2274 : 10 cc __ BPL $2242
+2276 : a5 1c __ LDA ACCU + 1
+2278 : 30 cb __ BMI $2245
+227a : 05 1b __ ORA ACCU + 0
+227c : f0 c7 __ BEQ $2245
+227e : d0 c2 __ BNE $2242
+2280 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+2281 : b1 19 __ LDA (IP + 0),y
+2283 : 8d 97 22 STA $2297 ; (inp_jsr + 22)
+2286 : c8 __ __ INY
+2287 : b1 19 __ LDA (IP + 0),y
+2289 : 8d 98 22 STA $2298 ; (inp_jsr + 23)
+228c : 98 __ __ TYA
+228d : 38 __ __ SEC
+228e : 65 19 __ ADC IP + 0
+2290 : 85 19 __ STA IP + 0
+2292 : 90 02 __ BCC $2296
+2294 : e6 1a __ INC IP + 1
+2296 : 20 00 00 JSR $0000 
+2299 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+229c : 98 __ __ TYA
+229d : 18 __ __ CLC
+229e : 65 19 __ ADC IP + 0
+22a0 : 8d ab 22 STA $22ab ; (inp_native + 15)
+22a3 : a5 1a __ LDA IP + 1
+22a5 : 69 00 __ ADC #$00
+22a7 : 8d ac 22 STA $22ac ; (inp_native + 16)
+22aa : 20 00 00 JSR $0000 
+22ad : a0 00 __ LDY #$00
+22af : b1 23 __ LDA (SP + 0),y
+22b1 : 85 19 __ STA IP + 0
+22b3 : c8 __ __ INY
+22b4 : b1 23 __ LDA (SP + 0),y
+22b6 : 85 1a __ STA IP + 1
+22b8 : 88 __ __ DEY
+22b9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+22bc : 38 __ __ SEC
+22bd : a5 23 __ LDA SP + 0
+22bf : f1 19 __ SBC (IP + 0),y
+22c1 : c8 __ __ INY
+22c2 : 85 23 __ STA SP + 0
+22c4 : a5 24 __ LDA SP + 1
+22c6 : f1 19 __ SBC (IP + 0),y
+22c8 : c8 __ __ INY
+22c9 : 85 24 __ STA SP + 1
+22cb : b1 19 __ LDA (IP + 0),y
+22cd : 84 02 __ STY $02
+22cf : a8 __ __ TAY
+22d0 : a5 25 __ LDA FP + 0
+22d2 : 91 23 __ STA (SP + 0),y
+22d4 : c8 __ __ INY
+22d5 : a5 26 __ LDA FP + 1
+22d7 : 91 23 __ STA (SP + 0),y
+22d9 : 98 __ __ TYA
+22da : 38 __ __ SEC
+22db : 65 23 __ ADC SP + 0
+22dd : 85 25 __ STA FP + 0
+22df : a9 00 __ LDA #$00
+22e1 : 65 24 __ ADC SP + 1
+22e3 : 85 26 __ STA FP + 1
+22e5 : 88 __ __ DEY
+22e6 : f0 08 __ BEQ $22f0
+22e8 : b9 52 00 LDA $0052,y 
+22eb : 88 __ __ DEY
+22ec : 91 23 __ STA (SP + 0),y
+22ee : d0 f8 __ BNE $22e8
+22f0 : a4 02 __ LDY $02
+22f2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+22f5 : b1 19 __ LDA (IP + 0),y
+22f7 : c8 __ __ INY
+22f8 : 84 02 __ STY $02
+22fa : a8 __ __ TAY
+22fb : b1 23 __ LDA (SP + 0),y
+22fd : 85 25 __ STA FP + 0
+22ff : c8 __ __ INY
+2300 : b1 23 __ LDA (SP + 0),y
+2302 : 85 26 __ STA FP + 1
+2304 : 88 __ __ DEY
+2305 : f0 09 __ BEQ $2310
+2307 : 88 __ __ DEY
+2308 : b1 23 __ LDA (SP + 0),y
+230a : 99 53 00 STA $0053,y 
+230d : 88 __ __ DEY
+230e : 10 f8 __ BPL $2308
+2310 : a4 02 __ LDY $02
+2312 : 18 __ __ CLC
+2313 : b1 19 __ LDA (IP + 0),y
+2315 : c8 __ __ INY
+2316 : 65 23 __ ADC SP + 0
+2318 : 85 23 __ STA SP + 0
+231a : b1 19 __ LDA (IP + 0),y
+231c : c8 __ __ INY
+231d : 65 24 __ ADC SP + 1
+231f : 85 24 __ STA SP + 1
+2321 : a0 01 __ LDY #$01
+2323 : b1 23 __ LDA (SP + 0),y
+2325 : 85 1a __ STA IP + 1
+2327 : 88 __ __ DEY
+2328 : b1 23 __ LDA (SP + 0),y
+232a : 85 19 __ STA IP + 0
+232c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+232f : b1 19 __ LDA (IP + 0),y
+2331 : 85 1f __ STA ADDR + 0
+2333 : c8 __ __ INY
+2334 : b1 19 __ LDA (IP + 0),y
+2336 : 85 20 __ STA ADDR + 1
+2338 : c8 __ __ INY
+2339 : 98 __ __ TYA
+233a : a0 00 __ LDY #$00
+233c : 18 __ __ CLC
+233d : 65 19 __ ADC IP + 0
+233f : 91 23 __ STA (SP + 0),y
+2341 : c8 __ __ INY
+2342 : a5 1a __ LDA IP + 1
+2344 : 69 00 __ ADC #$00
+2346 : 91 23 __ STA (SP + 0),y
+2348 : a5 1f __ LDA ADDR + 0
+234a : 85 19 __ STA IP + 0
+234c : a5 20 __ LDA ADDR + 1
+234e : 85 1a __ STA IP + 1
+2350 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2353 : 38 __ __ SEC
+2354 : a5 23 __ LDA SP + 0
+2356 : f1 19 __ SBC (IP + 0),y
+2358 : c8 __ __ INY
+2359 : 85 23 __ STA SP + 0
+235b : a5 24 __ LDA SP + 1
+235d : f1 19 __ SBC (IP + 0),y
+235f : 85 24 __ STA SP + 1
+2361 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2364 : 18 __ __ CLC
+2365 : b1 19 __ LDA (IP + 0),y
+2367 : c8 __ __ INY
+2368 : 65 23 __ ADC SP + 0
+236a : 85 23 __ STA SP + 0
+236c : b1 19 __ LDA (IP + 0),y
+236e : 65 24 __ ADC SP + 1
+2370 : 85 24 __ STA SP + 1
+2372 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2375 : b1 19 __ LDA (IP + 0),y
+2377 : c8 __ __ INY
+2378 : 8d 86 23 STA $2386 ; (inp_op_extrt + 17)
+237b : b1 19 __ LDA (IP + 0),y
+237d : c8 __ __ INY
+237e : 8d 87 23 STA $2387 ; (inp_op_extrt + 18)
+2381 : b1 19 __ LDA (IP + 0),y
+2383 : c8 __ __ INY
+2384 : aa __ __ TAX
+2385 : 20 00 00 JSR $0000 
+2388 : 4c 51 08 JMP $0851 ; (startup + 80)
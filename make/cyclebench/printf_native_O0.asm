@@ -0,0 +1,3253 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 42 21 STX $2142 ; (spentry + 0)
+0811 : a9 44 __ LDA #$44
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 a8 __ LDA #$a8
+0832 : e9 44 __ SBC #$44
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 89 1c JMP $1c89 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 07 __ SBC #$07
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 06 __ LDY #$06
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 12 __ SBC #$12
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T0 + 0
+0928 : 85 54 __ STA T0 + 1
+092a : 85 55 __ STA T1 + 0
+092c : 85 56 __ STA T1 + 1
+092e : a9 44 __ LDA #$44
+0930 : a0 02 __ LDY #$02
+0932 : 91 23 __ STA (SP + 0),y
+0934 : a9 21 __ LDA #$21
+0936 : c8 __ __ INY
+0937 : 91 23 __ STA (SP + 0),y
+0939 : a9 ec __ LDA #$ec
+093b : c8 __ __ INY
+093c : 91 23 __ STA (SP + 0),y
+093e : a9 1b __ LDA #$1b
+0940 : c8 __ __ INY
+0941 : 91 23 __ STA (SP + 0),y
+0943 : a5 55 __ LDA T1 + 0
+0945 : 85 1b __ STA ACCU + 0
+0947 : a5 56 __ LDA T1 + 1
+0949 : 85 1c __ STA ACCU + 1
+094b : a9 4b __ LDA #$4b
+094d : 85 03 __ STA $03
+094f : a9 01 __ LDA #$01
+0951 : 85 04 __ STA $04
+0953 : 20 e3 1e JSR $1ee3 ; (mul16 + 0)
+0956 : 38 __ __ SEC
+0957 : a5 05 __ LDA $05
+0959 : e9 80 __ SBC #$80
+095b : a0 06 __ LDY #$06
+095d : 91 23 __ STA (SP + 0),y
+095f : a5 06 __ LDA $06
+0961 : e9 3e __ SBC #$3e
+0963 : c8 __ __ INY
+0964 : 91 23 __ STA (SP + 0),y
+0966 : a5 55 __ LDA T1 + 0
+0968 : 85 1b __ STA ACCU + 0
+096a : a5 56 __ LDA T1 + 1
+096c : 85 1c __ STA ACCU + 1
+096e : a9 69 __ LDA #$69
+0970 : 85 03 __ STA $03
+0972 : a9 02 __ LDA #$02
+0974 : 85 04 __ STA $04
+0976 : 20 e3 1e JSR $1ee3 ; (mul16 + 0)
+0979 : a5 05 __ LDA $05
+097b : a0 08 __ LDY #$08
+097d : 91 23 __ STA (SP + 0),y
+097f : a5 06 __ LDA $06
+0981 : c8 __ __ INY
+0982 : 91 23 __ STA (SP + 0),y
+0984 : a5 55 __ LDA T1 + 0
+0986 : 85 1b __ STA ACCU + 0
+0988 : a5 56 __ LDA T1 + 1
+098a : 85 1c __ STA ACCU + 1
+098c : a9 61 __ LDA #$61
+098e : 85 03 __ STA $03
+0990 : 20 96 1c JSR $1c96 ; (mul16by8 + 0)
+0993 : a5 05 __ LDA $05
+0995 : a0 0a __ LDY #$0a
+0997 : 91 23 __ STA (SP + 0),y
+0999 : a5 06 __ LDA $06
+099b : c8 __ __ INY
+099c : 91 23 __ STA (SP + 0),y
+099e : a5 55 __ LDA T1 + 0
+09a0 : c8 __ __ INY
+09a1 : 91 23 __ STA (SP + 0),y
+09a3 : a5 56 __ LDA T1 + 1
+09a5 : c8 __ __ INY
+09a6 : 91 23 __ STA (SP + 0),y
+09a8 : 38 __ __ SEC
+09a9 : a9 00 __ LDA #$00
+09ab : e5 55 __ SBC T1 + 0
+09ad : c8 __ __ INY
+09ae : 91 23 __ STA (SP + 0),y
+09b0 : a9 00 __ LDA #$00
+09b2 : e5 56 __ SBC T1 + 1
+09b4 : c8 __ __ INY
+09b5 : 91 23 __ STA (SP + 0),y
+09b7 : a9 01 __ LDA #$01
+09b9 : c8 __ __ INY
+09ba : 91 23 __ STA (SP + 0),y
+09bc : a9 1c __ LDA #$1c
+09be : c8 __ __ INY
+09bf : 91 23 __ STA (SP + 0),y
+09c1 : 20 6d 0b JSR $0b6d ; (sprintf + 0)
+09c4 : a9 44 __ LDA #$44
+09c6 : 85 0d __ STA P0
+09c8 : a9 21 __ LDA #$21
+09ca : 85 0e __ STA P1
+09cc : 20 05 1c JSR $1c05 ; (strlen + 0)
+09cf : 18 __ __ CLC
+09d0 : a5 1b __ LDA ACCU + 0
+09d2 : 65 53 __ ADC T0 + 0
+09d4 : 85 53 __ STA T0 + 0
+09d6 : a5 1c __ LDA ACCU + 1
+09d8 : 65 54 __ ADC T0 + 1
+09da : 85 54 __ STA T0 + 1
+09dc : ad 44 21 LDA $2144 ; (buffer + 0)
+09df : f0 03 __ BEQ $09e4
+09e1 : 4c 3b 0b JMP $0b3b ; (main + 571)
+09e4 : e6 55 __ INC T1 + 0
+09e6 : d0 02 __ BNE $09ea
+09e8 : e6 56 __ INC T1 + 1
+09ea : a5 55 __ LDA T1 + 0
+09ec : c9 64 __ CMP #$64
+09ee : b0 03 __ BCS $09f3
+09f0 : 4c 2e 09 JMP $092e ; (main + 46)
+09f3 : a9 00 __ LDA #$00
+09f5 : 85 59 __ STA T4 + 0
+09f7 : a9 44 __ LDA #$44
+09f9 : a0 02 __ LDY #$02
+09fb : 91 23 __ STA (SP + 0),y
+09fd : a9 21 __ LDA #$21
+09ff : c8 __ __ INY
+0a00 : 91 23 __ STA (SP + 0),y
+0a02 : a9 36 __ LDA #$36
+0a04 : c8 __ __ INY
+0a05 : 91 23 __ STA (SP + 0),y
+0a07 : a9 1c __ LDA #$1c
+0a09 : c8 __ __ INY
+0a0a : 91 23 __ STA (SP + 0),y
+0a0c : a5 59 __ LDA T4 + 0
+0a0e : 85 1b __ STA ACCU + 0
+0a10 : a9 00 __ LDA #$00
+0a12 : 85 1c __ STA ACCU + 1
+0a14 : 20 4f 20 JSR $204f ; (sint16_to_float + 0)
+0a17 : a5 1b __ LDA ACCU + 0
+0a19 : 85 47 __ STA T6 + 0
+0a1b : a5 1c __ LDA ACCU + 1
+0a1d : 85 48 __ STA T6 + 1
+0a1f : a5 1d __ LDA ACCU + 2
+0a21 : 85 49 __ STA T6 + 2
+0a23 : a5 1e __ LDA ACCU + 3
+0a25 : 85 4a __ STA T6 + 3
+0a27 : a9 00 __ LDA #$00
+0a29 : 85 03 __ STA $03
+0a2b : 85 04 __ STA $04
+0a2d : a9 a0 __ LDA #$a0
+0a2f : 85 05 __ STA $05
+0a31 : a9 3f __ LDA #$3f
+0a33 : 85 06 __ STA $06
+0a35 : 20 ce 1c JSR $1cce ; (freg + 20)
+0a38 : 20 c7 1d JSR $1dc7 ; (fmul + 0)
+0a3b : a5 1b __ LDA ACCU + 0
+0a3d : a0 06 __ LDY #$06
+0a3f : 91 23 __ STA (SP + 0),y
+0a41 : a5 1c __ LDA ACCU + 1
+0a43 : c8 __ __ INY
+0a44 : 91 23 __ STA (SP + 0),y
+0a46 : a5 1d __ LDA ACCU + 2
+0a48 : c8 __ __ INY
+0a49 : 91 23 __ STA (SP + 0),y
+0a4b : a5 1e __ LDA ACCU + 3
+0a4d : c8 __ __ INY
+0a4e : 91 23 __ STA (SP + 0),y
+0a50 : a5 47 __ LDA T6 + 0
+0a52 : 85 1b __ STA ACCU + 0
+0a54 : a5 48 __ LDA T6 + 1
+0a56 : 85 1c __ STA ACCU + 1
+0a58 : a5 49 __ LDA T6 + 2
+0a5a : 85 1d __ STA ACCU + 2
+0a5c : a5 4a __ LDA T6 + 3
+0a5e : 85 1e __ STA ACCU + 3
+0a60 : a9 00 __ LDA #$00
+0a62 : 85 03 __ STA $03
+0a64 : 85 04 __ STA $04
+0a66 : a9 80 __ LDA #$80
+0a68 : 85 05 __ STA $05
+0a6a : a9 bd __ LDA #$bd
+0a6c : 85 06 __ STA $06
+0a6e : 20 ce 1c JSR $1cce ; (freg + 20)
+0a71 : 20 c7 1d JSR $1dc7 ; (fmul + 0)
+0a74 : a5 1b __ LDA ACCU + 0
+0a76 : a0 0a __ LDY #$0a
+0a78 : 91 23 __ STA (SP + 0),y
+0a7a : a5 1c __ LDA ACCU + 1
+0a7c : c8 __ __ INY
+0a7d : 91 23 __ STA (SP + 0),y
+0a7f : a5 1d __ LDA ACCU + 2
+0a81 : c8 __ __ INY
+0a82 : 91 23 __ STA (SP + 0),y
+0a84 : a5 1e __ LDA ACCU + 3
+0a86 : c8 __ __ INY
+0a87 : 91 23 __ STA (SP + 0),y
+0a89 : 20 6d 0b JSR $0b6d ; (sprintf + 0)
+0a8c : a9 44 __ LDA #$44
+0a8e : 85 0d __ STA P0
+0a90 : a9 21 __ LDA #$21
+0a92 : 85 0e __ STA P1
+0a94 : 20 05 1c JSR $1c05 ; (strlen + 0)
+0a97 : e6 59 __ INC T4 + 0
+0a99 : 18 __ __ CLC
+0a9a : a5 1b __ LDA ACCU + 0
+0a9c : 65 53 __ ADC T0 + 0
+0a9e : 85 53 __ STA T0 + 0
+0aa0 : a5 1c __ LDA ACCU + 1
+0aa2 : 65 54 __ ADC T0 + 1
+0aa4 : 85 54 __ STA T0 + 1
+0aa6 : a5 59 __ LDA T4 + 0
+0aa8 : c9 14 __ CMP #$14
+0aaa : b0 03 __ BCS $0aaf
+0aac : 4c f7 09 JMP $09f7 ; (main + 247)
+0aaf : a9 44 __ LDA #$44
+0ab1 : a0 02 __ LDY #$02
+0ab3 : 91 23 __ STA (SP + 0),y
+0ab5 : a9 21 __ LDA #$21
+0ab7 : c8 __ __ INY
+0ab8 : 91 23 __ STA (SP + 0),y
+0aba : a9 3f __ LDA #$3f
+0abc : c8 __ __ INY
+0abd : 91 23 __ STA (SP + 0),y
+0abf : a9 1c __ LDA #$1c
+0ac1 : c8 __ __ INY
+0ac2 : 91 23 __ STA (SP + 0),y
+0ac4 : a9 85 __ LDA #$85
+0ac6 : c8 __ __ INY
+0ac7 : 91 23 __ STA (SP + 0),y
+0ac9 : a9 ff __ LDA #$ff
+0acb : c8 __ __ INY
+0acc : 91 23 __ STA (SP + 0),y
+0ace : a9 48 __ LDA #$48
+0ad0 : c8 __ __ INY
+0ad1 : 91 23 __ STA (SP + 0),y
+0ad3 : a9 1c __ LDA #$1c
+0ad5 : c8 __ __ INY
+0ad6 : 91 23 __ STA (SP + 0),y
+0ad8 : a9 ef __ LDA #$ef
+0ada : c8 __ __ INY
+0adb : 91 23 __ STA (SP + 0),y
+0add : a9 be __ LDA #$be
+0adf : c8 __ __ INY
+0ae0 : 91 23 __ STA (SP + 0),y
+0ae2 : 20 6d 0b JSR $0b6d ; (sprintf + 0)
+0ae5 : a9 44 __ LDA #$44
+0ae7 : 85 0d __ STA P0
+0ae9 : a9 21 __ LDA #$21
+0aeb : 85 0e __ STA P1
+0aed : a9 7b __ LDA #$7b
+0aef : 85 0f __ STA P2
+0af1 : a9 1c __ LDA #$1c
+0af3 : 85 10 __ STA P3
+0af5 : 20 4c 1c JSR $1c4c ; (strcmp + 0)
+0af8 : a5 1b __ LDA ACCU + 0
+0afa : 05 1c __ ORA ACCU + 1
+0afc : d0 38 __ BNE $0b36
+0afe : a5 53 __ LDA T0 + 0
+0b00 : 05 54 __ ORA T0 + 1
+0b02 : f0 2d __ BEQ $0b31
+0b04 : a9 00 __ LDA #$00
+0b06 : 85 1b __ STA ACCU + 0
+0b08 : a9 00 __ LDA #$00
+0b0a : 85 1c __ STA ACCU + 1
+0b0c : 18 __ __ CLC
+0b0d : a5 23 __ LDA SP + 0
+0b0f : 69 12 __ ADC #$12
+0b11 : 85 23 __ STA SP + 0
+0b13 : a5 24 __ LDA SP + 1
+0b15 : 69 00 __ ADC #$00
+0b17 : 85 24 __ STA SP + 1
+0b19 : a0 06 __ LDY #$06
+0b1b : b1 23 __ LDA (SP + 0),y
+0b1d : 99 53 00 STA $0053,y 
+0b20 : 88 __ __ DEY
+0b21 : 10 f8 __ BPL $0b1b
+0b23 : 18 __ __ CLC
+0b24 : a5 23 __ LDA SP + 0
+0b26 : 69 07 __ ADC #$07
+0b28 : 85 23 __ STA SP + 0
+0b2a : a5 24 __ LDA SP + 1
+0b2c : 69 00 __ ADC #$00
+0b2e : 85 24 __ STA SP + 1
+0b30 : 60 __ __ RTS
+0b31 : a9 01 __ LDA #$01
+0b33 : 4c 06 0b JMP $0b06 ; (main + 518)
+0b36 : a9 01 __ LDA #$01
+0b38 : 4c 06 0b JMP $0b06 ; (main + 518)
+0b3b : a9 00 __ LDA #$00
+0b3d : 85 57 __ STA T2 + 0
+0b3f : 85 58 __ STA T2 + 1
+0b41 : 18 __ __ CLC
+0b42 : a9 45 __ LDA #$45
+0b44 : 65 57 __ ADC T2 + 0
+0b46 : 85 45 __ STA T5 + 0
+0b48 : a9 21 __ LDA #$21
+0b4a : 69 00 __ ADC #$00
+0b4c : 85 46 __ STA T5 + 1
+0b4e : 18 __ __ CLC
+0b4f : a4 57 __ LDY T2 + 0
+0b51 : b9 44 21 LDA $2144,y ; (buffer + 0)
+0b54 : 65 53 __ ADC T0 + 0
+0b56 : 85 53 __ STA T0 + 0
+0b58 : a9 00 __ LDA #$00
+0b5a : 65 54 __ ADC T0 + 1
+0b5c : 85 54 __ STA T0 + 1
+0b5e : a0 00 __ LDY #$00
+0b60 : e6 57 __ INC T2 + 0
+0b62 : d0 02 __ BNE $0b66
+0b64 : e6 58 __ INC T2 + 1
+0b66 : b1 45 __ LDA (T5 + 0),y
+0b68 : d0 d7 __ BNE $0b41
+0b6a : 4c e4 09 JMP $09e4 ; (main + 228)
+--------------------------------------------------------------------
+sprintf:
+0b6d : 38 __ __ SEC
+0b6e : a5 23 __ LDA SP + 0
+0b70 : e9 09 __ SBC #$09
+0b72 : 85 23 __ STA SP + 0
+0b74 : a5 24 __ LDA SP + 1
+0b76 : e9 00 __ SBC #$00
+0b78 : 85 24 __ STA SP + 1
+0b7a : a0 0b __ LDY #$0b
+0b7c : b1 23 __ LDA (SP + 0),y
+0b7e : a0 02 __ LDY #$02
+0b80 : 91 23 __ STA (SP + 0),y
+0b82 : a0 0c __ LDY #$0c
+0b84 : b1 23 __ LDA (SP + 0),y
+0b86 : a0 03 __ LDY #$03
+0b88 : 91 23 __ STA (SP + 0),y
+0b8a : a0 0d __ LDY #$0d
+0b8c : b1 23 __ LDA (SP + 0),y
+0b8e : a0 04 __ LDY #$04
+0b90 : 91 23 __ STA (SP + 0),y
+0b92 : a0 0e __ LDY #$0e
+0b94 : b1 23 __ LDA (SP + 0),y
+0b96 : a0 05 __ LDY #$05
+0b98 : 91 23 __ STA (SP + 0),y
+0b9a : 18 __ __ CLC
+0b9b : a5 23 __ LDA SP + 0
+0b9d : 69 0f __ ADC #$0f
+0b9f : c8 __ __ INY
+0ba0 : 91 23 __ STA (SP + 0),y
+0ba2 : a5 24 __ LDA SP + 1
+0ba4 : 69 00 __ ADC #$00
+0ba6 : c8 __ __ INY
+0ba7 : 91 23 __ STA (SP + 0),y
+0ba9 : a9 00 __ LDA #$00
+0bab : c8 __ __ INY
+0bac : 91 23 __ STA (SP + 0),y
+0bae : 20 d7 0b JSR $0bd7 ; (sformat + 0)
+0bb1 : a0 0b __ LDY #$0b
+0bb3 : b1 23 __ LDA (SP + 0),y
+0bb5 : 85 45 __ STA T1 + 0
+0bb7 : c8 __ __ INY
+0bb8 : b1 23 __ LDA (SP + 0),y
+0bba : 85 46 __ STA T1 + 1
+0bbc : 38 __ __ SEC
+0bbd : a5 1b __ LDA ACCU + 0
+0bbf : e5 45 __ SBC T1 + 0
+0bc1 : 85 1b __ STA ACCU + 0
+0bc3 : a5 1c __ LDA ACCU + 1
+0bc5 : e5 46 __ SBC T1 + 1
+0bc7 : 85 1c __ STA ACCU + 1
+0bc9 : 18 __ __ CLC
+0bca : a5 23 __ LDA SP + 0
+0bcc : 69 09 __ ADC #$09
+0bce : 85 23 __ STA SP + 0
+0bd0 : a5 24 __ LDA SP + 1
+0bd2 : 69 00 __ ADC #$00
+0bd4 : 85 24 __ STA SP + 1
+0bd6 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0bd7 : 38 __ __ SEC
+0bd8 : a5 23 __ LDA SP + 0
+0bda : e9 0e __ SBC #$0e
+0bdc : 85 23 __ STA SP + 0
+0bde : a5 24 __ LDA SP + 1
+0be0 : e9 00 __ SBC #$00
+0be2 : 85 24 __ STA SP + 1
+0be4 : a0 05 __ LDY #$05
+0be6 : b9 53 00 LDA $0053,y 
+0be9 : 91 23 __ STA (SP + 0),y
+0beb : 88 __ __ DEY
+0bec : 10 f8 __ BPL $0be6
+0bee : a0 10 __ LDY #$10
+0bf0 : b1 23 __ LDA (SP + 0),y
+0bf2 : 85 53 __ STA T0 + 0
+0bf4 : c8 __ __ INY
+0bf5 : b1 23 __ LDA (SP + 0),y
+0bf7 : 85 54 __ STA T0 + 1
+0bf9 : a9 00 __ LDA #$00
+0bfb : 85 55 __ STA T1 + 0
+0bfd : c8 __ __ INY
+0bfe : b1 23 __ LDA (SP + 0),y
+0c00 : 85 57 __ STA T2 + 0
+0c02 : c8 __ __ INY
+0c03 : b1 23 __ LDA (SP + 0),y
+0c05 : 85 58 __ STA T2 + 1
+0c07 : a0 00 __ LDY #$00
+0c09 : b1 57 __ LDA (T2 + 0),y
+0c0b : 85 43 __ STA T3 + 0
+0c0d : d0 59 __ BNE $0c68
+0c0f : 18 __ __ CLC
+0c10 : a5 53 __ LDA T0 + 0
+0c12 : 65 55 __ ADC T1 + 0
+0c14 : 85 57 __ STA T2 + 0
+0c16 : a5 54 __ LDA T0 + 1
+0c18 : 69 00 __ ADC #$00
+0c1a : 85 58 __ STA T2 + 1
+0c1c : a9 00 __ LDA #$00
+0c1e : a4 55 __ LDY T1 + 0
+0c20 : 91 53 __ STA (T0 + 0),y
+0c22 : 98 __ __ TYA
+0c23 : d0 20 __ BNE $0c45
+0c25 : a5 53 __ LDA T0 + 0
+0c27 : 85 1b __ STA ACCU + 0
+0c29 : a5 54 __ LDA T0 + 1
+0c2b : 85 1c __ STA ACCU + 1
+0c2d : a0 05 __ LDY #$05
+0c2f : b1 23 __ LDA (SP + 0),y
+0c31 : 99 53 00 STA $0053,y 
+0c34 : 88 __ __ DEY
+0c35 : 10 f8 __ BPL $0c2f
+0c37 : 18 __ __ CLC
+0c38 : a5 23 __ LDA SP + 0
+0c3a : 69 0e __ ADC #$0e
+0c3c : 85 23 __ STA SP + 0
+0c3e : a5 24 __ LDA SP + 1
+0c40 : 69 00 __ ADC #$00
+0c42 : 85 24 __ STA SP + 1
+0c44 : 60 __ __ RTS
+0c45 : a0 16 __ LDY #$16
+0c47 : b1 23 __ LDA (SP + 0),y
+0c49 : d0 09 __ BNE $0c54
+0c4b : a5 57 __ LDA T2 + 0
+0c4d : 85 1b __ STA ACCU + 0
+0c4f : a5 58 __ LDA T2 + 1
+0c51 : 4c 2b 0c JMP $0c2b ; (sformat + 84)
+0c54 : a5 53 __ LDA T0 + 0
+0c56 : 85 0d __ STA P0
+0c58 : a5 54 __ LDA T0 + 1
+0c5a : 85 0e __ STA P1
+0c5c : 20 92 11 JSR $1192 ; (puts + 0)
+0c5f : a5 53 __ LDA T0 + 0
+0c61 : 85 1b __ STA ACCU + 0
+0c63 : a5 54 __ LDA T0 + 1
+0c65 : 4c 2b 0c JMP $0c2b ; (sformat + 84)
+0c68 : e6 57 __ INC T2 + 0
+0c6a : d0 02 __ BNE $0c6e
+0c6c : e6 58 __ INC T2 + 1
+0c6e : a5 43 __ LDA T3 + 0
+0c70 : c9 25 __ CMP #$25
+0c72 : f0 55 __ BEQ $0cc9
+0c74 : a4 55 __ LDY T1 + 0
+0c76 : 91 53 __ STA (T0 + 0),y
+0c78 : e6 55 __ INC T1 + 0
+0c7a : a5 55 __ LDA T1 + 0
+0c7c : c9 28 __ CMP #$28
+0c7e : 90 15 __ BCC $0c95
+0c80 : a0 16 __ LDY #$16
+0c82 : b1 23 __ LDA (SP + 0),y
+0c84 : d0 22 __ BNE $0ca8
+0c86 : 18 __ __ CLC
+0c87 : a5 53 __ LDA T0 + 0
+0c89 : 65 55 __ ADC T1 + 0
+0c8b : 85 53 __ STA T0 + 0
+0c8d : 90 02 __ BCC $0c91
+0c8f : e6 54 __ INC T0 + 1
+0c91 : a9 00 __ LDA #$00
+0c93 : 85 55 __ STA T1 + 0
+0c95 : a0 00 __ LDY #$00
+0c97 : b1 57 __ LDA (T2 + 0),y
+0c99 : aa __ __ TAX
+0c9a : e6 57 __ INC T2 + 0
+0c9c : d0 02 __ BNE $0ca0
+0c9e : e6 58 __ INC T2 + 1
+0ca0 : 8a __ __ TXA
+0ca1 : 86 43 __ STX T3 + 0
+0ca3 : d0 c9 __ BNE $0c6e
+0ca5 : 4c 0f 0c JMP $0c0f ; (sformat + 56)
+0ca8 : 18 __ __ CLC
+0ca9 : a5 53 __ LDA T0 + 0
+0cab : 85 0d __ STA P0
+0cad : 65 55 __ ADC T1 + 0
+0caf : 85 45 __ STA T5 + 0
+0cb1 : a5 54 __ LDA T0 + 1
+0cb3 : 85 0e __ STA P1
+0cb5 : 69 00 __ ADC #$00
+0cb7 : 85 46 __ STA T5 + 1
+0cb9 : a9 00 __ LDA #$00
+0cbb : a0 00 __ LDY #$00
+0cbd : 91 45 __ STA (T5 + 0),y
+0cbf : 20 92 11 JSR $1192 ; (puts + 0)
+0cc2 : a9 00 __ LDA #$00
+0cc4 : 85 55 __ STA T1 + 0
+0cc6 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0cc9 : a5 55 __ LDA T1 + 0
+0ccb : f0 03 __ BEQ $0cd0
+0ccd : 4c 59 11 JMP $1159 ; (sformat + 1410)
+0cd0 : a0 00 __ LDY #$00
+0cd2 : b1 57 __ LDA (T2 + 0),y
+0cd4 : 85 43 __ STA T3 + 0
+0cd6 : a9 0a __ LDA #$0a
+0cd8 : a0 09 __ LDY #$09
+0cda : 91 23 __ STA (SP + 0),y
+0cdc : a9 00 __ LDA #$00
+0cde : c8 __ __ INY
+0cdf : 91 23 __ STA (SP + 0),y
+0ce1 : a9 01 __ LDA #$01
+0ce3 : a0 07 __ LDY #$07
+0ce5 : 91 23 __ STA (SP + 0),y
+0ce7 : a9 ff __ LDA #$ff
+0ce9 : c8 __ __ INY
+0cea : 91 23 __ STA (SP + 0),y
+0cec : a9 20 __ LDA #$20
+0cee : a0 06 __ LDY #$06
+0cf0 : 91 23 __ STA (SP + 0),y
+0cf2 : a9 00 __ LDA #$00
+0cf4 : a0 0b __ LDY #$0b
+0cf6 : 91 23 __ STA (SP + 0),y
+0cf8 : c8 __ __ INY
+0cf9 : 91 23 __ STA (SP + 0),y
+0cfb : c8 __ __ INY
+0cfc : 91 23 __ STA (SP + 0),y
+0cfe : e6 57 __ INC T2 + 0
+0d00 : d0 02 __ BNE $0d04
+0d02 : e6 58 __ INC T2 + 1
+0d04 : a5 43 __ LDA T3 + 0
+0d06 : c9 2b __ CMP #$2b
+0d08 : d0 03 __ BNE $0d0d
+0d0a : 4c 4a 11 JMP $114a ; (sformat + 1395)
+0d0d : c9 30 __ CMP #$30
+0d0f : d0 03 __ BNE $0d14
+0d11 : 4c 3b 11 JMP $113b ; (sformat + 1380)
+0d14 : c9 23 __ CMP #$23
+0d16 : d0 03 __ BNE $0d1b
+0d18 : 4c 2c 11 JMP $112c ; (sformat + 1365)
+0d1b : c9 30 __ CMP #$30
+0d1d : 90 65 __ BCC $0d84
+0d1f : a9 39 __ LDA #$39
+0d21 : c5 43 __ CMP T3 + 0
+0d23 : 90 5f __ BCC $0d84
+0d25 : a9 00 __ LDA #$00
+0d27 : 85 45 __ STA T5 + 0
+0d29 : 85 46 __ STA T5 + 1
+0d2b : a5 43 __ LDA T3 + 0
+0d2d : c9 30 __ CMP #$30
+0d2f : 90 4d __ BCC $0d7e
+0d31 : a9 39 __ LDA #$39
+0d33 : c5 43 __ CMP T3 + 0
+0d35 : 90 47 __ BCC $0d7e
+0d37 : a5 43 __ LDA T3 + 0
+0d39 : 85 47 __ STA T6 + 0
+0d3b : a0 00 __ LDY #$00
+0d3d : b1 57 __ LDA (T2 + 0),y
+0d3f : 85 43 __ STA T3 + 0
+0d41 : e6 57 __ INC T2 + 0
+0d43 : d0 02 __ BNE $0d47
+0d45 : e6 58 __ INC T2 + 1
+0d47 : a5 45 __ LDA T5 + 0
+0d49 : 0a __ __ ASL
+0d4a : 85 07 __ STA $07
+0d4c : a5 46 __ LDA T5 + 1
+0d4e : 2a __ __ ROL
+0d4f : 06 07 __ ASL $07
+0d51 : 2a __ __ ROL
+0d52 : aa __ __ TAX
+0d53 : 18 __ __ CLC
+0d54 : a5 07 __ LDA $07
+0d56 : 65 45 __ ADC T5 + 0
+0d58 : 85 1b __ STA ACCU + 0
+0d5a : 8a __ __ TXA
+0d5b : 65 46 __ ADC T5 + 1
+0d5d : 06 1b __ ASL ACCU + 0
+0d5f : 2a __ __ ROL
+0d60 : 85 1c __ STA ACCU + 1
+0d62 : 18 __ __ CLC
+0d63 : a5 1b __ LDA ACCU + 0
+0d65 : 65 47 __ ADC T6 + 0
+0d67 : aa __ __ TAX
+0d68 : a5 1c __ LDA ACCU + 1
+0d6a : 69 00 __ ADC #$00
+0d6c : a8 __ __ TAY
+0d6d : 38 __ __ SEC
+0d6e : 8a __ __ TXA
+0d6f : e9 30 __ SBC #$30
+0d71 : 85 45 __ STA T5 + 0
+0d73 : 98 __ __ TYA
+0d74 : e9 00 __ SBC #$00
+0d76 : 85 46 __ STA T5 + 1
+0d78 : a5 43 __ LDA T3 + 0
+0d7a : c9 30 __ CMP #$30
+0d7c : b0 b3 __ BCS $0d31
+0d7e : a5 45 __ LDA T5 + 0
+0d80 : a0 07 __ LDY #$07
+0d82 : 91 23 __ STA (SP + 0),y
+0d84 : a5 43 __ LDA T3 + 0
+0d86 : c9 2e __ CMP #$2e
+0d88 : d0 03 __ BNE $0d8d
+0d8a : 4c be 10 JMP $10be ; (sformat + 1255)
+0d8d : a5 43 __ LDA T3 + 0
+0d8f : c9 64 __ CMP #$64
+0d91 : d0 03 __ BNE $0d96
+0d93 : 4c 74 10 JMP $1074 ; (sformat + 1181)
+0d96 : c9 75 __ CMP #$75
+0d98 : d0 03 __ BNE $0d9d
+0d9a : 4c 2a 10 JMP $102a ; (sformat + 1107)
+0d9d : c9 78 __ CMP #$78
+0d9f : d0 03 __ BNE $0da4
+0da1 : 4c d5 0f JMP $0fd5 ; (sformat + 1022)
+0da4 : c9 6c __ CMP #$6c
+0da6 : d0 03 __ BNE $0dab
+0da8 : 4c df 0e JMP $0edf ; (sformat + 776)
+0dab : c9 66 __ CMP #$66
+0dad : d0 03 __ BNE $0db2
+0daf : 4c 75 0e JMP $0e75 ; (sformat + 670)
+0db2 : c9 67 __ CMP #$67
+0db4 : d0 03 __ BNE $0db9
+0db6 : 4c 75 0e JMP $0e75 ; (sformat + 670)
+0db9 : c9 65 __ CMP #$65
+0dbb : d0 03 __ BNE $0dc0
+0dbd : 4c 75 0e JMP $0e75 ; (sformat + 670)
+0dc0 : c9 73 __ CMP #$73
+0dc2 : f0 3f __ BEQ $0e03
+0dc4 : c9 63 __ CMP #$63
+0dc6 : f0 12 __ BEQ $0dda
+0dc8 : 09 00 __ ORA #$00
+0dca : d0 03 __ BNE $0dcf
+0dcc : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0dcf : a5 43 __ LDA T3 + 0
+0dd1 : a4 55 __ LDY T1 + 0
+0dd3 : 91 53 __ STA (T0 + 0),y
+0dd5 : e6 55 __ INC T1 + 0
+0dd7 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0dda : a0 14 __ LDY #$14
+0ddc : b1 23 __ LDA (SP + 0),y
+0dde : 85 45 __ STA T5 + 0
+0de0 : 18 __ __ CLC
+0de1 : 69 02 __ ADC #$02
+0de3 : aa __ __ TAX
+0de4 : c8 __ __ INY
+0de5 : b1 23 __ LDA (SP + 0),y
+0de7 : 85 46 __ STA T5 + 1
+0de9 : 69 00 __ ADC #$00
+0deb : 85 48 __ STA T6 + 1
+0ded : 8a __ __ TXA
+0dee : 88 __ __ DEY
+0def : 91 23 __ STA (SP + 0),y
+0df1 : a5 48 __ LDA T6 + 1
+0df3 : c8 __ __ INY
+0df4 : 91 23 __ STA (SP + 0),y
+0df6 : a0 00 __ LDY #$00
+0df8 : b1 45 __ LDA (T5 + 0),y
+0dfa : a4 55 __ LDY T1 + 0
+0dfc : 91 53 __ STA (T0 + 0),y
+0dfe : e6 55 __ INC T1 + 0
+0e00 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0e03 : a0 14 __ LDY #$14
+0e05 : b1 23 __ LDA (SP + 0),y
+0e07 : 85 45 __ STA T5 + 0
+0e09 : 18 __ __ CLC
+0e0a : 69 02 __ ADC #$02
+0e0c : aa __ __ TAX
+0e0d : c8 __ __ INY
+0e0e : b1 23 __ LDA (SP + 0),y
+0e10 : 85 46 __ STA T5 + 1
+0e12 : 69 00 __ ADC #$00
+0e14 : 85 48 __ STA T6 + 1
+0e16 : 8a __ __ TXA
+0e17 : 88 __ __ DEY
+0e18 : 91 23 __ STA (SP + 0),y
+0e1a : a5 48 __ LDA T6 + 1
+0e1c : c8 __ __ INY
+0e1d : 91 23 __ STA (SP + 0),y
+0e1f : a0 00 __ LDY #$00
+0e21 : b1 45 __ LDA (T5 + 0),y
+0e23 : 85 02 __ STA $02
+0e25 : c8 __ __ INY
+0e26 : b1 45 __ LDA (T5 + 0),y
+0e28 : 85 46 __ STA T5 + 1
+0e2a : a5 02 __ LDA $02
+0e2c : 85 45 __ STA T5 + 0
+0e2e : a0 16 __ LDY #$16
+0e30 : b1 23 __ LDA (SP + 0),y
+0e32 : d0 33 __ BNE $0e67
+0e34 : a0 00 __ LDY #$00
+0e36 : b1 45 __ LDA (T5 + 0),y
+0e38 : 85 43 __ STA T3 + 0
+0e3a : d0 03 __ BNE $0e3f
+0e3c : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0e3f : 18 __ __ CLC
+0e40 : a5 02 __ LDA $02
+0e42 : 69 01 __ ADC #$01
+0e44 : 85 45 __ STA T5 + 0
+0e46 : 90 02 __ BCC $0e4a
+0e48 : e6 46 __ INC T5 + 1
+0e4a : a5 43 __ LDA T3 + 0
+0e4c : a0 00 __ LDY #$00
+0e4e : 91 53 __ STA (T0 + 0),y
+0e50 : e6 53 __ INC T0 + 0
+0e52 : d0 02 __ BNE $0e56
+0e54 : e6 54 __ INC T0 + 1
+0e56 : b1 45 __ LDA (T5 + 0),y
+0e58 : aa __ __ TAX
+0e59 : e6 45 __ INC T5 + 0
+0e5b : d0 02 __ BNE $0e5f
+0e5d : e6 46 __ INC T5 + 1
+0e5f : 8a __ __ TXA
+0e60 : 86 43 __ STX T3 + 0
+0e62 : d0 e6 __ BNE $0e4a
+0e64 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0e67 : a5 02 __ LDA $02
+0e69 : 85 0d __ STA P0
+0e6b : a5 46 __ LDA T5 + 1
+0e6d : 85 0e __ STA P1
+0e6f : 20 92 11 JSR $1192 ; (puts + 0)
+0e72 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0e75 : 18 __ __ CLC
+0e76 : a5 23 __ LDA SP + 0
+0e78 : 69 06 __ ADC #$06
+0e7a : 85 0d __ STA P0
+0e7c : a5 24 __ LDA SP + 1
+0e7e : 69 00 __ ADC #$00
+0e80 : 85 0e __ STA P1
+0e82 : a5 53 __ LDA T0 + 0
+0e84 : 85 0f __ STA P2
+0e86 : a5 54 __ LDA T0 + 1
+0e88 : 85 10 __ STA P3
+0e8a : a0 14 __ LDY #$14
+0e8c : b1 23 __ LDA (SP + 0),y
+0e8e : 85 45 __ STA T5 + 0
+0e90 : c8 __ __ INY
+0e91 : b1 23 __ LDA (SP + 0),y
+0e93 : 85 46 __ STA T5 + 1
+0e95 : a0 00 __ LDY #$00
+0e97 : b1 45 __ LDA (T5 + 0),y
+0e99 : 85 11 __ STA P4
+0e9b : c8 __ __ INY
+0e9c : b1 45 __ LDA (T5 + 0),y
+0e9e : 85 12 __ STA P5
+0ea0 : c8 __ __ INY
+0ea1 : b1 45 __ LDA (T5 + 0),y
+0ea3 : 85 13 __ STA P6
+0ea5 : c8 __ __ INY
+0ea6 : b1 45 __ LDA (T5 + 0),y
+0ea8 : 85 14 __ STA P7
+0eaa : 20 71 15 JSR $1571 ; (nformf + 0)
+0ead : a5 1b __ LDA ACCU + 0
+0eaf : 85 55 __ STA T1 + 0
+0eb1 : a0 14 __ LDY #$14
+0eb3 : b1 23 __ LDA (SP + 0),y
+0eb5 : 85 45 __ STA T5 + 0
+0eb7 : 18 __ __ CLC
+0eb8 : 69 02 __ ADC #$02
+0eba : aa __ __ TAX
+0ebb : c8 __ __ INY
+0ebc : b1 23 __ LDA (SP + 0),y
+0ebe : 85 46 __ STA T5 + 1
+0ec0 : 69 00 __ ADC #$00
+0ec2 : 85 48 __ STA T6 + 1
+0ec4 : 8a __ __ TXA
+0ec5 : 88 __ __ DEY
+0ec6 : 91 23 __ STA (SP + 0),y
+0ec8 : a5 48 __ LDA T6 + 1
+0eca : c8 __ __ INY
+0ecb : 91 23 __ STA (SP + 0),y
+0ecd : 18 __ __ CLC
+0ece : a5 45 __ LDA T5 + 0
+0ed0 : 69 04 __ ADC #$04
+0ed2 : 88 __ __ DEY
+0ed3 : 91 23 __ STA (SP + 0),y
+0ed5 : a5 46 __ LDA T5 + 1
+0ed7 : 69 00 __ ADC #$00
+0ed9 : c8 __ __ INY
+0eda : 91 23 __ STA (SP + 0),y
+0edc : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0edf : a0 14 __ LDY #$14
+0ee1 : b1 23 __ LDA (SP + 0),y
+0ee3 : 85 45 __ STA T5 + 0
+0ee5 : 18 __ __ CLC
+0ee6 : 69 02 __ ADC #$02
+0ee8 : aa __ __ TAX
+0ee9 : c8 __ __ INY
+0eea : b1 23 __ LDA (SP + 0),y
+0eec : 85 46 __ STA T5 + 1
+0eee : a0 00 __ LDY #$00
+0ef0 : b1 45 __ LDA (T5 + 0),y
+0ef2 : 85 49 __ STA T7 + 0
+0ef4 : c8 __ __ INY
+0ef5 : b1 45 __ LDA (T5 + 0),y
+0ef7 : 85 4a __ STA T7 + 1
+0ef9 : c8 __ __ INY
+0efa : b1 45 __ LDA (T5 + 0),y
+0efc : 85 4b __ STA T7 + 2
+0efe : c8 __ __ INY
+0eff : b1 45 __ LDA (T5 + 0),y
+0f01 : 85 4c __ STA T7 + 3
+0f03 : a5 46 __ LDA T5 + 1
+0f05 : 69 00 __ ADC #$00
+0f07 : 85 48 __ STA T6 + 1
+0f09 : 8a __ __ TXA
+0f0a : a0 14 __ LDY #$14
+0f0c : 91 23 __ STA (SP + 0),y
+0f0e : a5 48 __ LDA T6 + 1
+0f10 : c8 __ __ INY
+0f11 : 91 23 __ STA (SP + 0),y
+0f13 : 18 __ __ CLC
+0f14 : a5 45 __ LDA T5 + 0
+0f16 : 69 04 __ ADC #$04
+0f18 : 88 __ __ DEY
+0f19 : 91 23 __ STA (SP + 0),y
+0f1b : a5 46 __ LDA T5 + 1
+0f1d : 69 00 __ ADC #$00
+0f1f : c8 __ __ INY
+0f20 : 91 23 __ STA (SP + 0),y
+0f22 : a0 00 __ LDY #$00
+0f24 : b1 57 __ LDA (T2 + 0),y
+0f26 : aa __ __ TAX
+0f27 : e6 57 __ INC T2 + 0
+0f29 : d0 02 __ BNE $0f2d
+0f2b : e6 58 __ INC T2 + 1
+0f2d : 8a __ __ TXA
+0f2e : e0 64 __ CPX #$64
+0f30 : f0 74 __ BEQ $0fa6
+0f32 : c9 75 __ CMP #$75
+0f34 : f0 41 __ BEQ $0f77
+0f36 : c9 78 __ CMP #$78
+0f38 : f0 03 __ BEQ $0f3d
+0f3a : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0f3d : a9 10 __ LDA #$10
+0f3f : a0 09 __ LDY #$09
+0f41 : 91 23 __ STA (SP + 0),y
+0f43 : a9 00 __ LDA #$00
+0f45 : c8 __ __ INY
+0f46 : 91 23 __ STA (SP + 0),y
+0f48 : 18 __ __ CLC
+0f49 : a5 23 __ LDA SP + 0
+0f4b : 69 06 __ ADC #$06
+0f4d : 85 0d __ STA P0
+0f4f : a5 24 __ LDA SP + 1
+0f51 : 69 00 __ ADC #$00
+0f53 : 85 0e __ STA P1
+0f55 : a5 53 __ LDA T0 + 0
+0f57 : 85 0f __ STA P2
+0f59 : a5 54 __ LDA T0 + 1
+0f5b : 85 10 __ STA P3
+0f5d : a5 49 __ LDA T7 + 0
+0f5f : 85 11 __ STA P4
+0f61 : a5 4a __ LDA T7 + 1
+0f63 : 85 12 __ STA P5
+0f65 : a5 4b __ LDA T7 + 2
+0f67 : 85 13 __ STA P6
+0f69 : a5 4c __ LDA T7 + 3
+0f6b : 85 14 __ STA P7
+0f6d : 20 44 13 JSR $1344 ; (nforml + 0)
+0f70 : a5 1b __ LDA ACCU + 0
+0f72 : 85 55 __ STA T1 + 0
+0f74 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0f77 : 18 __ __ CLC
+0f78 : a5 23 __ LDA SP + 0
+0f7a : 69 06 __ ADC #$06
+0f7c : 85 0d __ STA P0
+0f7e : a5 24 __ LDA SP + 1
+0f80 : 69 00 __ ADC #$00
+0f82 : 85 0e __ STA P1
+0f84 : a5 53 __ LDA T0 + 0
+0f86 : 85 0f __ STA P2
+0f88 : a5 54 __ LDA T0 + 1
+0f8a : 85 10 __ STA P3
+0f8c : a5 49 __ LDA T7 + 0
+0f8e : 85 11 __ STA P4
+0f90 : a5 4a __ LDA T7 + 1
+0f92 : 85 12 __ STA P5
+0f94 : a5 4b __ LDA T7 + 2
+0f96 : 85 13 __ STA P6
+0f98 : a5 4c __ LDA T7 + 3
+0f9a : 85 14 __ STA P7
+0f9c : 20 44 13 JSR $1344 ; (nforml + 0)
+0f9f : a5 1b __ LDA ACCU + 0
+0fa1 : 85 55 __ STA T1 + 0
+0fa3 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0fa6 : 18 __ __ CLC
+0fa7 : a5 23 __ LDA SP + 0
+0fa9 : 69 06 __ ADC #$06
+0fab : 85 0d __ STA P0
+0fad : a5 24 __ LDA SP + 1
+0faf : 69 00 __ ADC #$00
+0fb1 : 85 0e __ STA P1
+0fb3 : a5 53 __ LDA T0 + 0
+0fb5 : 85 0f __ STA P2
+0fb7 : a5 54 __ LDA T0 + 1
+0fb9 : 85 10 __ STA P3
+0fbb : a5 49 __ LDA T7 + 0
+0fbd : 85 11 __ STA P4
+0fbf : a5 4a __ LDA T7 + 1
+0fc1 : 85 12 __ STA P5
+0fc3 : a5 4b __ LDA T7 + 2
+0fc5 : 85 13 __ STA P6
+0fc7 : a5 4c __ LDA T7 + 3
+0fc9 : 85 14 __ STA P7
+0fcb : 20 44 13 JSR $1344 ; (nforml + 0)
+0fce : a5 1b __ LDA ACCU + 0
+0fd0 : 85 55 __ STA T1 + 0
+0fd2 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+0fd5 : a9 10 __ LDA #$10
+0fd7 : a0 09 __ LDY #$09
+0fd9 : 91 23 __ STA (SP + 0),y
+0fdb : a9 00 __ LDA #$00
+0fdd : c8 __ __ INY
+0fde : 91 23 __ STA (SP + 0),y
+0fe0 : 18 __ __ CLC
+0fe1 : a5 23 __ LDA SP + 0
+0fe3 : 69 06 __ ADC #$06
+0fe5 : 85 0d __ STA P0
+0fe7 : a5 24 __ LDA SP + 1
+0fe9 : 69 00 __ ADC #$00
+0feb : 85 0e __ STA P1
+0fed : a5 53 __ LDA T0 + 0
+0fef : 85 0f __ STA P2
+0ff1 : a5 54 __ LDA T0 + 1
+0ff3 : 85 10 __ STA P3
+0ff5 : a0 14 __ LDY #$14
+0ff7 : b1 23 __ LDA (SP + 0),y
+0ff9 : 85 45 __ STA T5 + 0
+0ffb : 18 __ __ CLC
+0ffc : 69 02 __ ADC #$02
+0ffe : aa __ __ TAX
+0fff : c8 __ __ INY
+1000 : b1 23 __ LDA (SP + 0),y
+1002 : 85 46 __ STA T5 + 1
+1004 : 69 00 __ ADC #$00
+1006 : 85 48 __ STA T6 + 1
+1008 : 8a __ __ TXA
+1009 : 88 __ __ DEY
+100a : 91 23 __ STA (SP + 0),y
+100c : a5 48 __ LDA T6 + 1
+100e : c8 __ __ INY
+100f : 91 23 __ STA (SP + 0),y
+1011 : a0 00 __ LDY #$00
+1013 : b1 45 __ LDA (T5 + 0),y
+1015 : 85 11 __ STA P4
+1017 : c8 __ __ INY
+1018 : b1 45 __ LDA (T5 + 0),y
+101a : 85 12 __ STA P5
+101c : a9 00 __ LDA #$00
+101e : 85 13 __ STA P6
+1020 : 20 d0 11 JSR $11d0 ; (nformi + 0)
+1023 : a5 1b __ LDA ACCU + 0
+1025 : 85 55 __ STA T1 + 0
+1027 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+102a : 18 __ __ CLC
+102b : a5 23 __ LDA SP + 0
+102d : 69 06 __ ADC #$06
+102f : 85 0d __ STA P0
+1031 : a5 24 __ LDA SP + 1
+1033 : 69 00 __ ADC #$00
+1035 : 85 0e __ STA P1
+1037 : a5 53 __ LDA T0 + 0
+1039 : 85 0f __ STA P2
+103b : a5 54 __ LDA T0 + 1
+103d : 85 10 __ STA P3
+103f : a0 14 __ LDY #$14
+1041 : b1 23 __ LDA (SP + 0),y
+1043 : 85 45 __ STA T5 + 0
+1045 : 18 __ __ CLC
+1046 : 69 02 __ ADC #$02
+1048 : aa __ __ TAX
+1049 : c8 __ __ INY
+104a : b1 23 __ LDA (SP + 0),y
+104c : 85 46 __ STA T5 + 1
+104e : 69 00 __ ADC #$00
+1050 : 85 48 __ STA T6 + 1
+1052 : 8a __ __ TXA
+1053 : 88 __ __ DEY
+1054 : 91 23 __ STA (SP + 0),y
+1056 : a5 48 __ LDA T6 + 1
+1058 : c8 __ __ INY
+1059 : 91 23 __ STA (SP + 0),y
+105b : a0 00 __ LDY #$00
+105d : b1 45 __ LDA (T5 + 0),y
+105f : 85 11 __ STA P4
+1061 : c8 __ __ INY
+1062 : b1 45 __ LDA (T5 + 0),y
+1064 : 85 12 __ STA P5
+1066 : a9 00 __ LDA #$00
+1068 : 85 13 __ STA P6
+106a : 20 d0 11 JSR $11d0 ; (nformi + 0)
+106d : a5 1b __ LDA ACCU + 0
+106f : 85 55 __ STA T1 + 0
+1071 : 4c 95 0c JMP $0c95 ; (sformat + 190)
+1074 : 18 __ __ CLC
+1075 : a5 23 __ LDA SP + 0
+1077 : 69 06 __ ADC #$06
+1079 : 85 0d __ STA P0
+107b : a5 24 __ LDA SP + 1
+107d : 69 00 __ ADC #$00
+107f : 85 0e __ STA P1
+1081 : a5 53 __ LDA T0 + 0
+1083 : 85 0f __ STA P2
+1085 : a5 54 __ LDA T0 + 1
+1087 : 85 10 __ STA P3
+1089 : a0 14 __ LDY #$14
+108b : b1 23 __ LDA (SP + 0),y
+108d : 85 45 __ STA T5 + 0
+108f : 18 __ __ CLC
+1090 : 69 02 __ ADC #$02
+1092 : aa __ __ TAX
+1093 : c8 __ __ INY
+1094 : b1 23 __ LDA (SP + 0),y
+1096 : 85 46 __ STA T5 + 1
+1098 : 69 00 __ ADC #$00
+109a : 85 48 __ STA T6 + 1
+109c : 8a __ __ TXA
+109d : 88 __ __ DEY
+109e : 91 23 __ STA (SP + 0),y
+10a0 : a5 48 __ LDA T6 + 1
+10a2 : c8 __ __ INY
+10a3 : 91 23 __ STA (SP + 0),y
+10a5 : a0 00 __ LDY #$00
+10a7 : b1 45 __ LDA (T5 + 0),y
+10a9 : 85 11 __ STA P4
+10ab : c8 __ __ INY
+10ac : b1 45 __ LDA (T5 + 0),y
+10ae : 85 12 __ STA P5
+10b0 : a9 01 __ LDA #$01
+10b2 : 85 13 __ STA P6
+10b4 : 20 d0 11 JSR $11d0 ; (nformi + 0)
+10b7 : a5 1b __ LDA ACCU + 0
+10b9 : 85 55 __ STA T1 + 0
+10bb : 4c 95 0c JMP $0c95 ; (sformat + 190)
+10be : a9 00 __ LDA #$00
+10c0 : 85 45 __ STA T5 + 0
+10c2 : 85 46 __ STA T5 + 1
+10c4 : a0 00 __ LDY #$00
+10c6 : b1 57 __ LDA (T2 + 0),y
+10c8 : 85 43 __ STA T3 + 0
+10ca : e6 57 __ INC T2 + 0
+10cc : d0 02 __ BNE $10d0
+10ce : e6 58 __ INC T2 + 1
+10d0 : a5 43 __ LDA T3 + 0
+10d2 : c9 30 __ CMP #$30
+10d4 : 90 4d __ BCC $1123
+10d6 : a9 39 __ LDA #$39
+10d8 : c5 43 __ CMP T3 + 0
+10da : 90 47 __ BCC $1123
+10dc : a5 43 __ LDA T3 + 0
+10de : 85 47 __ STA T6 + 0
+10e0 : a0 00 __ LDY #$00
+10e2 : b1 57 __ LDA (T2 + 0),y
+10e4 : 85 43 __ STA T3 + 0
+10e6 : e6 57 __ INC T2 + 0
+10e8 : d0 02 __ BNE $10ec
+10ea : e6 58 __ INC T2 + 1
+10ec : a5 45 __ LDA T5 + 0
+10ee : 0a __ __ ASL
+10ef : 85 07 __ STA $07
+10f1 : a5 46 __ LDA T5 + 1
+10f3 : 2a __ __ ROL
+10f4 : 06 07 __ ASL $07
+10f6 : 2a __ __ ROL
+10f7 : aa __ __ TAX
+10f8 : 18 __ __ CLC
+10f9 : a5 07 __ LDA $07
+10fb : 65 45 __ ADC T5 + 0
+10fd : 85 1b __ STA ACCU + 0
+10ff : 8a __ __ TXA
+1100 : 65 46 __ ADC T5 + 1
+1102 : 06 1b __ ASL ACCU + 0
+1104 : 2a __ __ ROL
+1105 : 85 1c __ STA ACCU + 1
+1107 : 18 __ __ CLC
+1108 : a5 1b __ LDA ACCU + 0
+110a : 65 47 __ ADC T6 + 0
+110c : aa __ __ TAX
+110d : a5 1c __ LDA ACCU + 1
+110f : 69 00 __ ADC #$00
+1111 : a8 __ __ TAY
+1112 : 38 __ __ SEC
+1113 : 8a __ __ TXA
+1114 : e9 30 __ SBC #$30
+1116 : 85 45 __ STA T5 + 0
+1118 : 98 __ __ TYA
+1119 : e9 00 __ SBC #$00
+111b : 85 46 __ STA T5 + 1
+111d : a5 43 __ LDA T3 + 0
+111f : c9 30 __ CMP #$30
+1121 : b0 b3 __ BCS $10d6
+1123 : a5 45 __ LDA T5 + 0
+1125 : a0 08 __ LDY #$08
+1127 : 91 23 __ STA (SP + 0),y
+1129 : 4c 8d 0d JMP $0d8d ; (sformat + 438)
+112c : a9 01 __ LDA #$01
+112e : a0 0d __ LDY #$0d
+1130 : 91 23 __ STA (SP + 0),y
+1132 : a0 00 __ LDY #$00
+1134 : b1 57 __ LDA (T2 + 0),y
+1136 : 85 43 __ STA T3 + 0
+1138 : 4c fe 0c JMP $0cfe ; (sformat + 295)
+113b : a9 30 __ LDA #$30
+113d : a0 06 __ LDY #$06
+113f : 91 23 __ STA (SP + 0),y
+1141 : a0 00 __ LDY #$00
+1143 : b1 57 __ LDA (T2 + 0),y
+1145 : 85 43 __ STA T3 + 0
+1147 : 4c fe 0c JMP $0cfe ; (sformat + 295)
+114a : a9 01 __ LDA #$01
+114c : a0 0b __ LDY #$0b
+114e : 91 23 __ STA (SP + 0),y
+1150 : a0 00 __ LDY #$00
+1152 : b1 57 __ LDA (T2 + 0),y
+1154 : 85 43 __ STA T3 + 0
+1156 : 4c fe 0c JMP $0cfe ; (sformat + 295)
+1159 : a0 16 __ LDY #$16
+115b : b1 23 __ LDA (SP + 0),y
+115d : d0 12 __ BNE $1171
+115f : 18 __ __ CLC
+1160 : a5 53 __ LDA T0 + 0
+1162 : 65 55 __ ADC T1 + 0
+1164 : 85 53 __ STA T0 + 0
+1166 : 90 02 __ BCC $116a
+1168 : e6 54 __ INC T0 + 1
+116a : a9 00 __ LDA #$00
+116c : 85 55 __ STA T1 + 0
+116e : 4c d0 0c JMP $0cd0 ; (sformat + 249)
+1171 : 18 __ __ CLC
+1172 : a5 53 __ LDA T0 + 0
+1174 : 85 0d __ STA P0
+1176 : 65 55 __ ADC T1 + 0
+1178 : 85 45 __ STA T5 + 0
+117a : a5 54 __ LDA T0 + 1
+117c : 85 0e __ STA P1
+117e : 69 00 __ ADC #$00
+1180 : 85 46 __ STA T5 + 1
+1182 : a9 00 __ LDA #$00
+1184 : a0 00 __ LDY #$00
+1186 : 91 45 __ STA (T5 + 0),y
+1188 : 20 92 11 JSR $1192 ; (puts + 0)
+118b : a9 00 __ LDA #$00
+118d : 85 55 __ STA T1 + 0
+118f : 4c d0 0c JMP $0cd0 ; (sformat + 249)
+--------------------------------------------------------------------
+puts:
+1192 : a0 00 __ LDY #$00
+1194 : b1 0d __ LDA (P0),y
+1196 : f0 0b __ BEQ $11a3
+1198 : 20 a4 11 JSR $11a4 ; (putpch + 0)
+119b : e6 0d __ INC P0
+119d : d0 f3 __ BNE $1192
+119f : e6 0e __ INC P1
+11a1 : d0 ef __ BNE $1192
+11a3 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+11a4 : ae 43 21 LDX $2143 ; (giocharmap + 0)
+11a7 : e0 01 __ CPX #$01
+11a9 : 90 22 __ BCC $11cd
+11ab : c9 0a __ CMP #$0a
+11ad : d0 02 __ BNE $11b1
+11af : a9 0d __ LDA #$0d
+11b1 : e0 02 __ CPX #$02
+11b3 : 90 18 __ BCC $11cd
+11b5 : c9 41 __ CMP #$41
+11b7 : 90 14 __ BCC $11cd
+11b9 : c9 7b __ CMP #$7b
+11bb : b0 10 __ BCS $11cd
+11bd : c9 61 __ CMP #$61
+11bf : b0 04 __ BCS $11c5
+11c1 : c9 5b __ CMP #$5b
+11c3 : b0 08 __ BCS $11cd
+11c5 : 49 20 __ EOR #$20
+11c7 : e0 03 __ CPX #$03
+11c9 : f0 02 __ BEQ $11cd
+11cb : 29 df __ AND #$df
+11cd : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+11d0 : a5 11 __ LDA P4
+11d2 : 85 45 __ STA T1 + 0
+11d4 : a5 12 __ LDA P5
+11d6 : 85 46 __ STA T1 + 1
+11d8 : a9 00 __ LDA #$00
+11da : 85 49 __ STA T3 + 0
+11dc : a5 13 __ LDA P6
+11de : f0 07 __ BEQ $11e7
+11e0 : a5 12 __ LDA P5
+11e2 : 10 03 __ BPL $11e7
+11e4 : 4c 28 13 JMP $1328 ; (nformi + 344)
+11e7 : a9 0a __ LDA #$0a
+11e9 : 85 4a __ STA T4 + 0
+11eb : a5 11 __ LDA P4
+11ed : 05 12 __ ORA P5
+11ef : f0 03 __ BEQ $11f4
+11f1 : 4c ce 12 JMP $12ce ; (nformi + 254)
+11f4 : a0 02 __ LDY #$02
+11f6 : b1 0d __ LDA (P0),y
+11f8 : 85 4b __ STA T5 + 0
+11fa : c9 ff __ CMP #$ff
+11fc : d0 03 __ BNE $1201
+11fe : 4c c0 12 JMP $12c0 ; (nformi + 240)
+1201 : 38 __ __ SEC
+1202 : a9 0a __ LDA #$0a
+1204 : e5 4b __ SBC T5 + 0
+1206 : 85 4b __ STA T5 + 0
+1208 : c5 4a __ CMP T4 + 0
+120a : b0 0e __ BCS $121a
+120c : c6 4a __ DEC T4 + 0
+120e : a9 30 __ LDA #$30
+1210 : a4 4a __ LDY T4 + 0
+1212 : 91 0f __ STA (P2),y
+1214 : a5 4b __ LDA T5 + 0
+1216 : c5 4a __ CMP T4 + 0
+1218 : 90 f2 __ BCC $120c
+121a : a0 07 __ LDY #$07
+121c : b1 0d __ LDA (P0),y
+121e : f0 34 __ BEQ $1254
+1220 : a0 03 __ LDY #$03
+1222 : b1 0d __ LDA (P0),y
+1224 : 85 45 __ STA T1 + 0
+1226 : c8 __ __ INY
+1227 : b1 0d __ LDA (P0),y
+1229 : d0 29 __ BNE $1254
+122b : a5 45 __ LDA T1 + 0
+122d : c9 10 __ CMP #$10
+122f : d0 23 __ BNE $1254
+1231 : 18 __ __ CLC
+1232 : a5 4a __ LDA T4 + 0
+1234 : 69 ff __ ADC #$ff
+1236 : 18 __ __ CLC
+1237 : 65 0f __ ADC P2
+1239 : 85 45 __ STA T1 + 0
+123b : a5 10 __ LDA P3
+123d : 69 00 __ ADC #$00
+123f : 85 46 __ STA T1 + 1
+1241 : a9 58 __ LDA #$58
+1243 : a0 00 __ LDY #$00
+1245 : 91 45 __ STA (T1 + 0),y
+1247 : 18 __ __ CLC
+1248 : a5 4a __ LDA T4 + 0
+124a : 69 fe __ ADC #$fe
+124c : 85 4a __ STA T4 + 0
+124e : a9 30 __ LDA #$30
+1250 : a4 4a __ LDY T4 + 0
+1252 : 91 0f __ STA (P2),y
+1254 : a5 49 __ LDA T3 + 0
+1256 : d0 5d __ BNE $12b5
+1258 : a0 05 __ LDY #$05
+125a : b1 0d __ LDA (P0),y
+125c : f0 08 __ BEQ $1266
+125e : c6 4a __ DEC T4 + 0
+1260 : a9 2b __ LDA #$2b
+1262 : a4 4a __ LDY T4 + 0
+1264 : 91 0f __ STA (P2),y
+1266 : a0 01 __ LDY #$01
+1268 : b1 0d __ LDA (P0),y
+126a : 85 49 __ STA T3 + 0
+126c : 38 __ __ SEC
+126d : a9 0a __ LDA #$0a
+126f : e5 49 __ SBC T3 + 0
+1271 : 85 45 __ STA T1 + 0
+1273 : a9 00 __ LDA #$00
+1275 : e9 00 __ SBC #$00
+1277 : 49 80 __ EOR #$80
+1279 : c9 80 __ CMP #$80
+127b : d0 04 __ BNE $1281
+127d : a5 45 __ LDA T1 + 0
+127f : c5 4a __ CMP T4 + 0
+1281 : 90 25 __ BCC $12a8
+1283 : a9 00 __ LDA #$00
+1285 : 85 49 __ STA T3 + 0
+1287 : a5 4a __ LDA T4 + 0
+1289 : c9 0a __ CMP #$0a
+128b : b0 12 __ BCS $129f
+128d : a4 4a __ LDY T4 + 0
+128f : b1 0f __ LDA (P2),y
+1291 : a4 49 __ LDY T3 + 0
+1293 : 91 0f __ STA (P2),y
+1295 : e6 49 __ INC T3 + 0
+1297 : e6 4a __ INC T4 + 0
+1299 : a5 4a __ LDA T4 + 0
+129b : c9 0a __ CMP #$0a
+129d : 90 ee __ BCC $128d
+129f : a5 49 __ LDA T3 + 0
+12a1 : 85 1b __ STA ACCU + 0
+12a3 : a9 00 __ LDA #$00
+12a5 : 85 1c __ STA ACCU + 1
+12a7 : 60 __ __ RTS
+12a8 : c6 4a __ DEC T4 + 0
+12aa : a0 00 __ LDY #$00
+12ac : b1 0d __ LDA (P0),y
+12ae : a4 4a __ LDY T4 + 0
+12b0 : 91 0f __ STA (P2),y
+12b2 : 4c 66 12 JMP $1266 ; (nformi + 150)
+12b5 : c6 4a __ DEC T4 + 0
+12b7 : a9 2d __ LDA #$2d
+12b9 : a4 4a __ LDY T4 + 0
+12bb : 91 0f __ STA (P2),y
+12bd : 4c 66 12 JMP $1266 ; (nformi + 150)
+12c0 : a9 09 __ LDA #$09
+12c2 : 85 4b __ STA T5 + 0
+12c4 : c5 4a __ CMP T4 + 0
+12c6 : b0 03 __ BCS $12cb
+12c8 : 4c 0c 12 JMP $120c ; (nformi + 60)
+12cb : 4c 1a 12 JMP $121a ; (nformi + 74)
+12ce : a5 45 __ LDA T1 + 0
+12d0 : 85 1b __ STA ACCU + 0
+12d2 : a5 46 __ LDA T1 + 1
+12d4 : 85 1c __ STA ACCU + 1
+12d6 : a0 03 __ LDY #$03
+12d8 : b1 0d __ LDA (P0),y
+12da : 85 03 __ STA $03
+12dc : c8 __ __ INY
+12dd : b1 0d __ LDA (P0),y
+12df : 85 04 __ STA $04
+12e1 : 20 5f 1f JSR $1f5f ; (divmod + 0)
+12e4 : a5 06 __ LDA $06
+12e6 : 10 30 __ BPL $1318
+12e8 : 18 __ __ CLC
+12e9 : a5 05 __ LDA $05
+12eb : 69 30 __ ADC #$30
+12ed : c6 4a __ DEC T4 + 0
+12ef : a4 4a __ LDY T4 + 0
+12f1 : 91 0f __ STA (P2),y
+12f3 : a5 45 __ LDA T1 + 0
+12f5 : 85 1b __ STA ACCU + 0
+12f7 : a5 46 __ LDA T1 + 1
+12f9 : 85 1c __ STA ACCU + 1
+12fb : a0 03 __ LDY #$03
+12fd : b1 0d __ LDA (P0),y
+12ff : 85 03 __ STA $03
+1301 : c8 __ __ INY
+1302 : b1 0d __ LDA (P0),y
+1304 : 85 04 __ STA $04
+1306 : 20 5f 1f JSR $1f5f ; (divmod + 0)
+1309 : a5 1b __ LDA ACCU + 0
+130b : 85 45 __ STA T1 + 0
+130d : a5 1c __ LDA ACCU + 1
+130f : 85 46 __ STA T1 + 1
+1311 : 05 1b __ ORA ACCU + 0
+1313 : d0 b9 __ BNE $12ce
+1315 : 4c f4 11 JMP $11f4 ; (nformi + 36)
+1318 : d0 06 __ BNE $1320
+131a : a5 05 __ LDA $05
+131c : c9 0a __ CMP #$0a
+131e : 90 c8 __ BCC $12e8
+1320 : 18 __ __ CLC
+1321 : a5 05 __ LDA $05
+1323 : 69 37 __ ADC #$37
+1325 : 4c ed 12 JMP $12ed ; (nformi + 285)
+1328 : a9 01 __ LDA #$01
+132a : 85 49 __ STA T3 + 0
+132c : a9 0a __ LDA #$0a
+132e : 85 4a __ STA T4 + 0
+1330 : 38 __ __ SEC
+1331 : a9 00 __ LDA #$00
+1333 : e5 11 __ SBC P4
+1335 : 85 45 __ STA T1 + 0
+1337 : a9 00 __ LDA #$00
+1339 : e5 12 __ SBC P5
+133b : 85 46 __ STA T1 + 1
+133d : 05 45 __ ORA T1 + 0
+133f : d0 8d __ BNE $12ce
+1341 : 4c f4 11 JMP $11f4 ; (nformi + 36)
+--------------------------------------------------------------------
+nforml:
+1344 : 38 __ __ SEC
+1345 : a5 23 __ LDA SP + 0
+1347 : e9 05 __ SBC #$05
+1349 : 85 23 __ STA SP + 0
+134b : a5 24 __ LDA SP + 1
+134d : e9 00 __ SBC #$00
+134f : 85 24 __ STA SP + 1
+1351 : a0 01 __ LDY #$01
+1353 : b9 53 00 LDA $0053,y 
+1356 : 91 23 __ STA (SP + 0),y
+1358 : 88 __ __ DEY
+1359 : 10 f8 __ BPL $1353
+135b : a5 11 __ LDA P4
+135d : 85 47 __ STA T1 + 0
+135f : a5 12 __ LDA P5
+1361 : 85 48 __ STA T1 + 1
+1363 : a5 13 __ LDA P6
+1365 : 85 49 __ STA T1 + 2
+1367 : a5 14 __ LDA P7
+1369 : 85 4a __ STA T1 + 3
+136b : a9 00 __ LDA #$00
+136d : 85 4d __ STA T3 + 0
+136f : a5 15 __ LDA P8
+1371 : f0 03 __ BEQ $1376
+1373 : 4c 1c 15 JMP $151c ; (nforml + 472)
+1376 : a9 10 __ LDA #$10
+1378 : 85 4e __ STA T4 + 0
+137a : a9 00 __ LDA #$00
+137c : c5 14 __ CMP P7
+137e : d0 0a __ BNE $138a
+1380 : c5 13 __ CMP P6
+1382 : d0 06 __ BNE $138a
+1384 : c5 12 __ CMP P5
+1386 : d0 02 __ BNE $138a
+1388 : c5 11 __ CMP P4
+138a : b0 03 __ BCS $138f
+138c : 4c 90 14 JMP $1490 ; (nforml + 332)
+138f : a0 02 __ LDY #$02
+1391 : b1 0d __ LDA (P0),y
+1393 : 85 4f __ STA T5 + 0
+1395 : c9 ff __ CMP #$ff
+1397 : d0 03 __ BNE $139c
+1399 : 4c 82 14 JMP $1482 ; (nforml + 318)
+139c : 38 __ __ SEC
+139d : a9 10 __ LDA #$10
+139f : e5 4f __ SBC T5 + 0
+13a1 : 85 4f __ STA T5 + 0
+13a3 : c5 4e __ CMP T4 + 0
+13a5 : b0 0e __ BCS $13b5
+13a7 : c6 4e __ DEC T4 + 0
+13a9 : a9 30 __ LDA #$30
+13ab : a4 4e __ LDY T4 + 0
+13ad : 91 0f __ STA (P2),y
+13af : a5 4f __ LDA T5 + 0
+13b1 : c5 4e __ CMP T4 + 0
+13b3 : 90 f2 __ BCC $13a7
+13b5 : a0 07 __ LDY #$07
+13b7 : b1 0d __ LDA (P0),y
+13b9 : f0 34 __ BEQ $13ef
+13bb : a0 03 __ LDY #$03
+13bd : b1 0d __ LDA (P0),y
+13bf : 85 53 __ STA T7 + 0
+13c1 : c8 __ __ INY
+13c2 : b1 0d __ LDA (P0),y
+13c4 : d0 29 __ BNE $13ef
+13c6 : a5 53 __ LDA T7 + 0
+13c8 : c9 10 __ CMP #$10
+13ca : d0 23 __ BNE $13ef
+13cc : 18 __ __ CLC
+13cd : a5 4e __ LDA T4 + 0
+13cf : 69 ff __ ADC #$ff
+13d1 : 18 __ __ CLC
+13d2 : 65 0f __ ADC P2
+13d4 : 85 53 __ STA T7 + 0
+13d6 : a5 10 __ LDA P3
+13d8 : 69 00 __ ADC #$00
+13da : 85 54 __ STA T7 + 1
+13dc : a9 58 __ LDA #$58
+13de : a0 00 __ LDY #$00
+13e0 : 91 53 __ STA (T7 + 0),y
+13e2 : 18 __ __ CLC
+13e3 : a5 4e __ LDA T4 + 0
+13e5 : 69 fe __ ADC #$fe
+13e7 : 85 4e __ STA T4 + 0
+13e9 : a9 30 __ LDA #$30
+13eb : a4 4e __ LDY T4 + 0
+13ed : 91 0f __ STA (P2),y
+13ef : a5 4d __ LDA T3 + 0
+13f1 : f0 03 __ BEQ $13f6
+13f3 : 4c 77 14 JMP $1477 ; (nforml + 307)
+13f6 : a0 05 __ LDY #$05
+13f8 : b1 0d __ LDA (P0),y
+13fa : f0 08 __ BEQ $1404
+13fc : c6 4e __ DEC T4 + 0
+13fe : a9 2b __ LDA #$2b
+1400 : a4 4e __ LDY T4 + 0
+1402 : 91 0f __ STA (P2),y
+1404 : a0 01 __ LDY #$01
+1406 : b1 0d __ LDA (P0),y
+1408 : 85 53 __ STA T7 + 0
+140a : 38 __ __ SEC
+140b : a9 10 __ LDA #$10
+140d : e5 53 __ SBC T7 + 0
+140f : 85 53 __ STA T7 + 0
+1411 : a9 00 __ LDA #$00
+1413 : e9 00 __ SBC #$00
+1415 : 49 80 __ EOR #$80
+1417 : c9 80 __ CMP #$80
+1419 : d0 04 __ BNE $141f
+141b : a5 53 __ LDA T7 + 0
+141d : c5 4e __ CMP T4 + 0
+141f : 90 49 __ BCC $146a
+1421 : a9 00 __ LDA #$00
+1423 : 85 4d __ STA T3 + 0
+1425 : a5 4e __ LDA T4 + 0
+1427 : c9 10 __ CMP #$10
+1429 : 90 20 __ BCC $144b
+142b : a5 4d __ LDA T3 + 0
+142d : 85 1b __ STA ACCU + 0
+142f : a9 00 __ LDA #$00
+1431 : 85 1c __ STA ACCU + 1
+1433 : a0 01 __ LDY #$01
+1435 : b1 23 __ LDA (SP + 0),y
+1437 : 99 53 00 STA $0053,y 
+143a : 88 __ __ DEY
+143b : 10 f8 __ BPL $1435
+143d : 18 __ __ CLC
+143e : a5 23 __ LDA SP + 0
+1440 : 69 05 __ ADC #$05
+1442 : 85 23 __ STA SP + 0
+1444 : a5 24 __ LDA SP + 1
+1446 : 69 00 __ ADC #$00
+1448 : 85 24 __ STA SP + 1
+144a : 60 __ __ RTS
+144b : aa __ __ TAX
+144c : 8a __ __ TXA
+144d : 18 __ __ CLC
+144e : 65 0f __ ADC P2
+1450 : 85 51 __ STA T6 + 0
+1452 : a5 10 __ LDA P3
+1454 : 69 00 __ ADC #$00
+1456 : 85 52 __ STA T6 + 1
+1458 : a0 00 __ LDY #$00
+145a : b1 51 __ LDA (T6 + 0),y
+145c : a4 4d __ LDY T3 + 0
+145e : 91 0f __ STA (P2),y
+1460 : e6 4d __ INC T3 + 0
+1462 : e8 __ __ INX
+1463 : e0 10 __ CPX #$10
+1465 : 90 e5 __ BCC $144c
+1467 : 4c 2b 14 JMP $142b ; (nforml + 231)
+146a : c6 4e __ DEC T4 + 0
+146c : a0 00 __ LDY #$00
+146e : b1 0d __ LDA (P0),y
+1470 : a4 4e __ LDY T4 + 0
+1472 : 91 0f __ STA (P2),y
+1474 : 4c 04 14 JMP $1404 ; (nforml + 192)
+1477 : c6 4e __ DEC T4 + 0
+1479 : a9 2d __ LDA #$2d
+147b : a4 4e __ LDY T4 + 0
+147d : 91 0f __ STA (P2),y
+147f : 4c 04 14 JMP $1404 ; (nforml + 192)
+1482 : a9 0f __ LDA #$0f
+1484 : 85 4f __ STA T5 + 0
+1486 : c5 4e __ CMP T4 + 0
+1488 : b0 03 __ BCS $148d
+148a : 4c a7 13 JMP $13a7 ; (nforml + 99)
+148d : 4c b5 13 JMP $13b5 ; (nforml + 113)
+1490 : a0 03 __ LDY #$03
+1492 : b1 0d __ LDA (P0),y
+1494 : 85 03 __ STA $03
+1496 : c8 __ __ INY
+1497 : b1 0d __ LDA (P0),y
+1499 : 85 04 __ STA $04
+149b : a9 00 __ LDA #$00
+149d : 85 05 __ STA $05
+149f : 85 06 __ STA $06
+14a1 : a5 47 __ LDA T1 + 0
+14a3 : 85 1b __ STA ACCU + 0
+14a5 : a5 48 __ LDA T1 + 1
+14a7 : 85 1c __ STA ACCU + 1
+14a9 : a5 49 __ LDA T1 + 2
+14ab : 85 1d __ STA ACCU + 2
+14ad : a5 4a __ LDA T1 + 3
+14af : 85 1e __ STA ACCU + 3
+14b1 : 20 eb 20 JSR $20eb ; (divmod32 + 0)
+14b4 : a5 08 __ LDA $08
+14b6 : 10 54 __ BPL $150c
+14b8 : 18 __ __ CLC
+14b9 : a5 07 __ LDA $07
+14bb : 69 30 __ ADC #$30
+14bd : c6 4e __ DEC T4 + 0
+14bf : a4 4e __ LDY T4 + 0
+14c1 : 91 0f __ STA (P2),y
+14c3 : a0 03 __ LDY #$03
+14c5 : b1 0d __ LDA (P0),y
+14c7 : 85 03 __ STA $03
+14c9 : c8 __ __ INY
+14ca : b1 0d __ LDA (P0),y
+14cc : 85 04 __ STA $04
+14ce : a9 00 __ LDA #$00
+14d0 : 85 05 __ STA $05
+14d2 : 85 06 __ STA $06
+14d4 : a5 47 __ LDA T1 + 0
+14d6 : 85 1b __ STA ACCU + 0
+14d8 : a5 48 __ LDA T1 + 1
+14da : 85 1c __ STA ACCU + 1
+14dc : a5 49 __ LDA T1 + 2
+14de : 85 1d __ STA ACCU + 2
+14e0 : a5 4a __ LDA T1 + 3
+14e2 : 85 1e __ STA ACCU + 3
+14e4 : 20 eb 20 JSR $20eb ; (divmod32 + 0)
+14e7 : a5 1b __ LDA ACCU + 0
+14e9 : 85 47 __ STA T1 + 0
+14eb : a5 1c __ LDA ACCU + 1
+14ed : 85 48 __ STA T1 + 1
+14ef : a5 1d __ LDA ACCU + 2
+14f1 : 85 49 __ STA T1 + 2
+14f3 : a5 1e __ LDA ACCU + 3
+14f5 : 85 4a __ STA T1 + 3
+14f7 : a9 00 __ LDA #$00
+14f9 : c5 1e __ CMP ACCU + 3
+14fb : d0 0a __ BNE $1507
+14fd : c5 1d __ CMP ACCU + 2
+14ff : d0 06 __ BNE $1507
+1501 : c5 1c __ CMP ACCU + 1
+1503 : d0 02 __ BNE $1507
+1505 : c5 1b __ CMP ACCU + 0
+1507 : 90 87 __ BCC $1490
+1509 : 4c 8f 13 JMP $138f ; (nforml + 75)
+150c : d0 06 __ BNE $1514
+150e : a5 07 __ LDA $07
+1510 : c9 0a __ CMP #$0a
+1512 : 90 a4 __ BCC $14b8
+1514 : 18 __ __ CLC
+1515 : a5 07 __ LDA $07
+1517 : 69 37 __ ADC #$37
+1519 : 4c bd 14 JMP $14bd ; (nforml + 377)
+151c : a5 14 __ LDA P7
+151e : 49 80 __ EOR #$80
+1520 : c9 80 __ CMP #$80
+1522 : d0 0f __ BNE $1533
+1524 : a5 13 __ LDA P6
+1526 : c9 00 __ CMP #$00
+1528 : d0 09 __ BNE $1533
+152a : a5 12 __ LDA P5
+152c : c9 00 __ CMP #$00
+152e : d0 03 __ BNE $1533
+1530 : 4c 76 13 JMP $1376 ; (nforml + 50)
+1533 : 90 03 __ BCC $1538
+1535 : 4c 76 13 JMP $1376 ; (nforml + 50)
+1538 : a9 01 __ LDA #$01
+153a : 85 4d __ STA T3 + 0
+153c : a9 10 __ LDA #$10
+153e : 85 4e __ STA T4 + 0
+1540 : 38 __ __ SEC
+1541 : a9 00 __ LDA #$00
+1543 : e5 11 __ SBC P4
+1545 : 85 47 __ STA T1 + 0
+1547 : a9 00 __ LDA #$00
+1549 : e5 12 __ SBC P5
+154b : 85 48 __ STA T1 + 1
+154d : a9 00 __ LDA #$00
+154f : e5 13 __ SBC P6
+1551 : 85 49 __ STA T1 + 2
+1553 : a9 00 __ LDA #$00
+1555 : e5 14 __ SBC P7
+1557 : 85 4a __ STA T1 + 3
+1559 : a9 00 __ LDA #$00
+155b : c5 4a __ CMP T1 + 3
+155d : d0 0a __ BNE $1569
+155f : c5 49 __ CMP T1 + 2
+1561 : d0 06 __ BNE $1569
+1563 : c5 48 __ CMP T1 + 1
+1565 : d0 02 __ BNE $1569
+1567 : c5 47 __ CMP T1 + 0
+1569 : b0 03 __ BCS $156e
+156b : 4c 90 14 JMP $1490 ; (nforml + 332)
+156e : 4c 8f 13 JMP $138f ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+1571 : 38 __ __ SEC
+1572 : a5 23 __ LDA SP + 0
+1574 : e9 0a __ SBC #$0a
+1576 : 85 23 __ STA SP + 0
+1578 : a5 24 __ LDA SP + 1
+157a : e9 00 __ SBC #$00
+157c : 85 24 __ STA SP + 1
+157e : a0 03 __ LDY #$03
+1580 : b9 53 00 LDA $0053,y 
+1583 : 91 23 __ STA (SP + 0),y
+1585 : 88 __ __ DEY
+1586 : 10 f8 __ BPL $1580
+1588 : a9 00 __ LDA #$00
+158a : 85 1b __ STA ACCU + 0
+158c : 85 1c __ STA ACCU + 1
+158e : 85 1d __ STA ACCU + 2
+1590 : 85 1e __ STA ACCU + 3
+1592 : a5 11 __ LDA P4
+1594 : 85 03 __ STA $03
+1596 : a5 12 __ LDA P5
+1598 : 85 04 __ STA $04
+159a : a5 13 __ LDA P6
+159c : 85 05 __ STA $05
+159e : a5 14 __ LDA P7
+15a0 : 85 06 __ STA $06
+15a2 : 20 9a 20 JSR $209a ; (fcmp + 0)
+15a5 : 10 03 __ BPL $15aa
+15a7 : 4c d9 1b JMP $1bd9 ; (nformf + 1640)
+15aa : a9 00 __ LDA #$00
+15ac : 85 4b __ STA T3 + 0
+15ae : a0 05 __ LDY #$05
+15b0 : b1 0d __ LDA (P0),y
+15b2 : f0 0a __ BEQ $15be
+15b4 : a9 2b __ LDA #$2b
+15b6 : a0 00 __ LDY #$00
+15b8 : 91 0f __ STA (P2),y
+15ba : a9 01 __ LDA #$01
+15bc : 85 4b __ STA T3 + 0
+15be : a9 00 __ LDA #$00
+15c0 : 85 43 __ STA T0 + 0
+15c2 : 85 44 __ STA T0 + 1
+15c4 : a0 02 __ LDY #$02
+15c6 : b1 0d __ LDA (P0),y
+15c8 : 85 4e __ STA T5 + 0
+15ca : c9 ff __ CMP #$ff
+15cc : d0 04 __ BNE $15d2
+15ce : a9 06 __ LDA #$06
+15d0 : 85 4e __ STA T5 + 0
+15d2 : a9 00 __ LDA #$00
+15d4 : 85 1b __ STA ACCU + 0
+15d6 : 85 1c __ STA ACCU + 1
+15d8 : 85 1d __ STA ACCU + 2
+15da : 85 1e __ STA ACCU + 3
+15dc : a5 11 __ LDA P4
+15de : 85 03 __ STA $03
+15e0 : a5 12 __ LDA P5
+15e2 : 85 04 __ STA $04
+15e4 : a5 13 __ LDA P6
+15e6 : 85 05 __ STA $05
+15e8 : a5 14 __ LDA P7
+15ea : 85 06 __ STA $06
+15ec : 20 9a 20 JSR $209a ; (fcmp + 0)
+15ef : d0 03 __ BNE $15f4
+15f1 : 4c 78 17 JMP $1778 ; (nformf + 519)
+15f4 : a9 00 __ LDA #$00
+15f6 : 85 1b __ STA ACCU + 0
+15f8 : 85 1c __ STA ACCU + 1
+15fa : a9 7a __ LDA #$7a
+15fc : 85 1d __ STA ACCU + 2
+15fe : a9 44 __ LDA #$44
+1600 : 85 1e __ STA ACCU + 3
+1602 : a5 11 __ LDA P4
+1604 : 85 03 __ STA $03
+1606 : a5 12 __ LDA P5
+1608 : 85 04 __ STA $04
+160a : a5 13 __ LDA P6
+160c : 85 05 __ STA $05
+160e : a5 14 __ LDA P7
+1610 : 85 06 __ STA $06
+1612 : 20 9a 20 JSR $209a ; (fcmp + 0)
+1615 : 30 5a __ BMI $1671
+1617 : a5 11 __ LDA P4
+1619 : 85 1b __ STA ACCU + 0
+161b : a5 12 __ LDA P5
+161d : 85 1c __ STA ACCU + 1
+161f : a5 13 __ LDA P6
+1621 : 85 1d __ STA ACCU + 2
+1623 : a5 14 __ LDA P7
+1625 : 85 1e __ STA ACCU + 3
+1627 : a9 00 __ LDA #$00
+1629 : 85 03 __ STA $03
+162b : 85 04 __ STA $04
+162d : a9 7a __ LDA #$7a
+162f : 85 05 __ STA $05
+1631 : a9 44 __ LDA #$44
+1633 : 85 06 __ STA $06
+1635 : 20 ce 1c JSR $1cce ; (freg + 20)
+1638 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+163b : a5 1b __ LDA ACCU + 0
+163d : 85 11 __ STA P4
+163f : 85 03 __ STA $03
+1641 : a5 1c __ LDA ACCU + 1
+1643 : 85 12 __ STA P5
+1645 : 85 04 __ STA $04
+1647 : a5 1d __ LDA ACCU + 2
+1649 : 85 13 __ STA P6
+164b : 85 05 __ STA $05
+164d : a5 1e __ LDA ACCU + 3
+164f : 85 14 __ STA P7
+1651 : 85 06 __ STA $06
+1653 : 18 __ __ CLC
+1654 : a5 43 __ LDA T0 + 0
+1656 : 69 03 __ ADC #$03
+1658 : 85 43 __ STA T0 + 0
+165a : 90 02 __ BCC $165e
+165c : e6 44 __ INC T0 + 1
+165e : a9 00 __ LDA #$00
+1660 : 85 1b __ STA ACCU + 0
+1662 : 85 1c __ STA ACCU + 1
+1664 : a9 7a __ LDA #$7a
+1666 : 85 1d __ STA ACCU + 2
+1668 : a9 44 __ LDA #$44
+166a : 85 1e __ STA ACCU + 3
+166c : 20 9a 20 JSR $209a ; (fcmp + 0)
+166f : 10 a6 __ BPL $1617
+1671 : a9 00 __ LDA #$00
+1673 : 85 1b __ STA ACCU + 0
+1675 : 85 1c __ STA ACCU + 1
+1677 : a9 80 __ LDA #$80
+1679 : 85 1d __ STA ACCU + 2
+167b : a9 3f __ LDA #$3f
+167d : 85 1e __ STA ACCU + 3
+167f : a5 11 __ LDA P4
+1681 : 85 03 __ STA $03
+1683 : a5 12 __ LDA P5
+1685 : 85 04 __ STA $04
+1687 : a5 13 __ LDA P6
+1689 : 85 05 __ STA $05
+168b : a5 14 __ LDA P7
+168d : 85 06 __ STA $06
+168f : 20 9a 20 JSR $209a ; (fcmp + 0)
+1692 : 10 5c __ BPL $16f0
+1694 : a5 11 __ LDA P4
+1696 : 85 1b __ STA ACCU + 0
+1698 : a5 12 __ LDA P5
+169a : 85 1c __ STA ACCU + 1
+169c : a5 13 __ LDA P6
+169e : 85 1d __ STA ACCU + 2
+16a0 : a5 14 __ LDA P7
+16a2 : 85 1e __ STA ACCU + 3
+16a4 : a9 00 __ LDA #$00
+16a6 : 85 03 __ STA $03
+16a8 : 85 04 __ STA $04
+16aa : a9 7a __ LDA #$7a
+16ac : 85 05 __ STA $05
+16ae : a9 44 __ LDA #$44
+16b0 : 85 06 __ STA $06
+16b2 : 20 ce 1c JSR $1cce ; (freg + 20)
+16b5 : 20 c7 1d JSR $1dc7 ; (fmul + 0)
+16b8 : a5 1b __ LDA ACCU + 0
+16ba : 85 11 __ STA P4
+16bc : 85 03 __ STA $03
+16be : a5 1c __ LDA ACCU + 1
+16c0 : 85 12 __ STA P5
+16c2 : 85 04 __ STA $04
+16c4 : a5 1d __ LDA ACCU + 2
+16c6 : 85 13 __ STA P6
+16c8 : 85 05 __ STA $05
+16ca : a5 1e __ LDA ACCU + 3
+16cc : 85 14 __ STA P7
+16ce : 85 06 __ STA $06
+16d0 : 38 __ __ SEC
+16d1 : a5 43 __ LDA T0 + 0
+16d3 : e9 03 __ SBC #$03
+16d5 : 85 43 __ STA T0 + 0
+16d7 : a5 44 __ LDA T0 + 1
+16d9 : e9 00 __ SBC #$00
+16db : 85 44 __ STA T0 + 1
+16dd : a9 00 __ LDA #$00
+16df : 85 1b __ STA ACCU + 0
+16e1 : 85 1c __ STA ACCU + 1
+16e3 : a9 80 __ LDA #$80
+16e5 : 85 1d __ STA ACCU + 2
+16e7 : a9 3f __ LDA #$3f
+16e9 : 85 1e __ STA ACCU + 3
+16eb : 20 9a 20 JSR $209a ; (fcmp + 0)
+16ee : 30 a4 __ BMI $1694
+16f0 : a9 00 __ LDA #$00
+16f2 : 85 1b __ STA ACCU + 0
+16f4 : 85 1c __ STA ACCU + 1
+16f6 : a9 20 __ LDA #$20
+16f8 : 85 1d __ STA ACCU + 2
+16fa : a9 41 __ LDA #$41
+16fc : 85 1e __ STA ACCU + 3
+16fe : a5 11 __ LDA P4
+1700 : 85 03 __ STA $03
+1702 : a5 12 __ LDA P5
+1704 : 85 04 __ STA $04
+1706 : a5 13 __ LDA P6
+1708 : 85 05 __ STA $05
+170a : a5 14 __ LDA P7
+170c : 85 06 __ STA $06
+170e : 20 9a 20 JSR $209a ; (fcmp + 0)
+1711 : 30 65 __ BMI $1778
+1713 : a5 11 __ LDA P4
+1715 : 85 1b __ STA ACCU + 0
+1717 : a5 12 __ LDA P5
+1719 : 85 1c __ STA ACCU + 1
+171b : a5 13 __ LDA P6
+171d : 85 1d __ STA ACCU + 2
+171f : a5 14 __ LDA P7
+1721 : 85 1e __ STA ACCU + 3
+1723 : a9 00 __ LDA #$00
+1725 : 85 03 __ STA $03
+1727 : 85 04 __ STA $04
+1729 : a9 20 __ LDA #$20
+172b : 85 05 __ STA $05
+172d : a9 41 __ LDA #$41
+172f : 85 06 __ STA $06
+1731 : 20 ce 1c JSR $1cce ; (freg + 20)
+1734 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+1737 : a5 1b __ LDA ACCU + 0
+1739 : 85 11 __ STA P4
+173b : 85 47 __ STA T2 + 0
+173d : a5 1c __ LDA ACCU + 1
+173f : 85 12 __ STA P5
+1741 : 85 48 __ STA T2 + 1
+1743 : a5 1d __ LDA ACCU + 2
+1745 : 85 13 __ STA P6
+1747 : 85 49 __ STA T2 + 2
+1749 : a5 1e __ LDA ACCU + 3
+174b : 85 14 __ STA P7
+174d : 85 4a __ STA T2 + 3
+174f : e6 43 __ INC T0 + 0
+1751 : d0 02 __ BNE $1755
+1753 : e6 44 __ INC T0 + 1
+1755 : a9 00 __ LDA #$00
+1757 : 85 1b __ STA ACCU + 0
+1759 : 85 1c __ STA ACCU + 1
+175b : a9 20 __ LDA #$20
+175d : 85 1d __ STA ACCU + 2
+175f : a9 41 __ LDA #$41
+1761 : 85 1e __ STA ACCU + 3
+1763 : a5 47 __ LDA T2 + 0
+1765 : 85 03 __ STA $03
+1767 : a5 48 __ LDA T2 + 1
+1769 : 85 04 __ STA $04
+176b : a5 49 __ LDA T2 + 2
+176d : 85 05 __ STA $05
+176f : a5 4a __ LDA T2 + 3
+1771 : 85 06 __ STA $06
+1773 : 20 9a 20 JSR $209a ; (fcmp + 0)
+1776 : 10 9b __ BPL $1713
+1778 : a5 15 __ LDA P8
+177a : c9 65 __ CMP #$65
+177c : d0 03 __ BNE $1781
+177e : 4c d4 1b JMP $1bd4 ; (nformf + 1635)
+1781 : a9 00 __ LDA #$00
+1783 : 85 51 __ STA T7 + 0
+1785 : 85 52 __ STA T8 + 0
+1787 : a5 4e __ LDA T5 + 0
+1789 : 85 4c __ STA T4 + 0
+178b : e6 4c __ INC T4 + 0
+178d : a5 15 __ LDA P8
+178f : c9 67 __ CMP #$67
+1791 : d0 03 __ BNE $1796
+1793 : 4c b7 1b JMP $1bb7 ; (nformf + 1606)
+1796 : a5 51 __ LDA T7 + 0
+1798 : f0 03 __ BEQ $179d
+179a : 4c c5 1a JMP $1ac5 ; (nformf + 1364)
+179d : a5 44 __ LDA T0 + 1
+179f : 10 03 __ BPL $17a4
+17a1 : 4c 84 1a JMP $1a84 ; (nformf + 1299)
+17a4 : a9 00 __ LDA #$00
+17a6 : 85 47 __ STA T2 + 0
+17a8 : 85 48 __ STA T2 + 1
+17aa : 85 49 __ STA T2 + 2
+17ac : a9 3f __ LDA #$3f
+17ae : 85 4a __ STA T2 + 3
+17b0 : 18 __ __ CLC
+17b1 : a5 4e __ LDA T5 + 0
+17b3 : 65 43 __ ADC T0 + 0
+17b5 : 85 4c __ STA T4 + 0
+17b7 : e6 4c __ INC T4 + 0
+17b9 : a9 01 __ LDA #$01
+17bb : c5 4c __ CMP T4 + 0
+17bd : b0 03 __ BCS $17c2
+17bf : 4c 43 1a JMP $1a43 ; (nformf + 1234)
+17c2 : a5 11 __ LDA P4
+17c4 : 85 1b __ STA ACCU + 0
+17c6 : a5 12 __ LDA P5
+17c8 : 85 1c __ STA ACCU + 1
+17ca : a5 13 __ LDA P6
+17cc : 85 1d __ STA ACCU + 2
+17ce : a5 14 __ LDA P7
+17d0 : 85 1e __ STA ACCU + 3
+17d2 : a5 47 __ LDA T2 + 0
+17d4 : 85 03 __ STA $03
+17d6 : a5 48 __ LDA T2 + 1
+17d8 : 85 04 __ STA $04
+17da : a5 49 __ LDA T2 + 2
+17dc : 85 05 __ STA $05
+17de : a5 4a __ LDA T2 + 3
+17e0 : 85 06 __ STA $06
+17e2 : 20 ce 1c JSR $1cce ; (freg + 20)
+17e5 : 20 ff 1c JSR $1cff ; (faddsub + 0)
+17e8 : a5 1b __ LDA ACCU + 0
+17ea : 85 11 __ STA P4
+17ec : 85 47 __ STA T2 + 0
+17ee : 85 03 __ STA $03
+17f0 : a5 1c __ LDA ACCU + 1
+17f2 : 85 12 __ STA P5
+17f4 : 85 48 __ STA T2 + 1
+17f6 : 85 04 __ STA $04
+17f8 : a5 1d __ LDA ACCU + 2
+17fa : 85 13 __ STA P6
+17fc : 85 49 __ STA T2 + 2
+17fe : 85 05 __ STA $05
+1800 : a5 1e __ LDA ACCU + 3
+1802 : 85 14 __ STA P7
+1804 : 85 4a __ STA T2 + 3
+1806 : 85 06 __ STA $06
+1808 : a9 00 __ LDA #$00
+180a : 85 1b __ STA ACCU + 0
+180c : 85 1c __ STA ACCU + 1
+180e : a9 20 __ LDA #$20
+1810 : 85 1d __ STA ACCU + 2
+1812 : a9 41 __ LDA #$41
+1814 : 85 1e __ STA ACCU + 3
+1816 : 20 9a 20 JSR $209a ; (fcmp + 0)
+1819 : 30 36 __ BMI $1851
+181b : a5 47 __ LDA T2 + 0
+181d : 85 1b __ STA ACCU + 0
+181f : a5 48 __ LDA T2 + 1
+1821 : 85 1c __ STA ACCU + 1
+1823 : a5 49 __ LDA T2 + 2
+1825 : 85 1d __ STA ACCU + 2
+1827 : a5 4a __ LDA T2 + 3
+1829 : 85 1e __ STA ACCU + 3
+182b : a9 00 __ LDA #$00
+182d : 85 03 __ STA $03
+182f : 85 04 __ STA $04
+1831 : a9 20 __ LDA #$20
+1833 : 85 05 __ STA $05
+1835 : a9 41 __ LDA #$41
+1837 : 85 06 __ STA $06
+1839 : 20 ce 1c JSR $1cce ; (freg + 20)
+183c : 20 65 1e JSR $1e65 ; (fdiv + 0)
+183f : a5 1b __ LDA ACCU + 0
+1841 : 85 11 __ STA P4
+1843 : a5 1c __ LDA ACCU + 1
+1845 : 85 12 __ STA P5
+1847 : a5 1d __ LDA ACCU + 2
+1849 : 85 13 __ STA P6
+184b : a5 1e __ LDA ACCU + 3
+184d : 85 14 __ STA P7
+184f : c6 4e __ DEC T5 + 0
+1851 : 38 __ __ SEC
+1852 : a5 4c __ LDA T4 + 0
+1854 : e5 4e __ SBC T5 + 0
+1856 : 85 53 __ STA T10 + 0
+1858 : 85 4e __ STA T5 + 0
+185a : a9 14 __ LDA #$14
+185c : c5 4c __ CMP T4 + 0
+185e : b0 02 __ BCS $1862
+1860 : 85 4c __ STA T4 + 0
+1862 : a5 53 __ LDA T10 + 0
+1864 : d0 08 __ BNE $186e
+1866 : a9 30 __ LDA #$30
+1868 : a4 4b __ LDY T3 + 0
+186a : 91 0f __ STA (P2),y
+186c : e6 4b __ INC T3 + 0
+186e : a9 00 __ LDA #$00
+1870 : 85 50 __ STA T6 + 0
+1872 : a5 4c __ LDA T4 + 0
+1874 : f0 03 __ BEQ $1879
+1876 : 4c b2 19 JMP $19b2 ; (nformf + 1089)
+1879 : a5 52 __ LDA T8 + 0
+187b : f0 03 __ BEQ $1880
+187d : 4c 32 19 JMP $1932 ; (nformf + 961)
+1880 : a5 4b __ LDA T3 + 0
+1882 : a0 01 __ LDY #$01
+1884 : d1 0d __ CMP (P0),y
+1886 : 90 1e __ BCC $18a6
+1888 : 85 1b __ STA ACCU + 0
+188a : a9 00 __ LDA #$00
+188c : 85 1c __ STA ACCU + 1
+188e : a0 03 __ LDY #$03
+1890 : b1 23 __ LDA (SP + 0),y
+1892 : 99 53 00 STA $0053,y 
+1895 : 88 __ __ DEY
+1896 : 10 f8 __ BPL $1890
+1898 : 18 __ __ CLC
+1899 : a5 23 __ LDA SP + 0
+189b : 69 0a __ ADC #$0a
+189d : 85 23 __ STA SP + 0
+189f : a5 24 __ LDA SP + 1
+18a1 : 69 00 __ ADC #$00
+18a3 : 85 24 __ STA SP + 1
+18a5 : 60 __ __ RTS
+18a6 : c9 01 __ CMP #$01
+18a8 : 90 53 __ BCC $18fd
+18aa : a9 01 __ LDA #$01
+18ac : 85 4e __ STA T5 + 0
+18ae : a5 0d __ LDA P0
+18b0 : 85 43 __ STA T0 + 0
+18b2 : a5 0e __ LDA P1
+18b4 : 85 44 __ STA T0 + 1
+18b6 : a5 4b __ LDA T3 + 0
+18b8 : 85 4c __ STA T4 + 0
+18ba : 38 __ __ SEC
+18bb : a5 4c __ LDA T4 + 0
+18bd : e5 4e __ SBC T5 + 0
+18bf : 85 55 __ STA T11 + 0
+18c1 : a9 00 __ LDA #$00
+18c3 : e9 00 __ SBC #$00
+18c5 : 85 56 __ STA T11 + 1
+18c7 : 18 __ __ CLC
+18c8 : a5 0f __ LDA P2
+18ca : 65 55 __ ADC T11 + 0
+18cc : 85 55 __ STA T11 + 0
+18ce : a5 10 __ LDA P3
+18d0 : 65 56 __ ADC T11 + 1
+18d2 : 85 56 __ STA T11 + 1
+18d4 : a0 01 __ LDY #$01
+18d6 : b1 43 __ LDA (T0 + 0),y
+18d8 : 38 __ __ SEC
+18d9 : e5 4e __ SBC T5 + 0
+18db : 85 53 __ STA T10 + 0
+18dd : a9 00 __ LDA #$00
+18df : e9 00 __ SBC #$00
+18e1 : 85 54 __ STA T10 + 1
+18e3 : 18 __ __ CLC
+18e4 : a5 0f __ LDA P2
+18e6 : 65 53 __ ADC T10 + 0
+18e8 : 85 53 __ STA T10 + 0
+18ea : a5 10 __ LDA P3
+18ec : 65 54 __ ADC T10 + 1
+18ee : 85 54 __ STA T10 + 1
+18f0 : 88 __ __ DEY
+18f1 : b1 55 __ LDA (T11 + 0),y
+18f3 : 91 53 __ STA (T10 + 0),y
+18f5 : e6 4e __ INC T5 + 0
+18f7 : a5 4b __ LDA T3 + 0
+18f9 : c5 4e __ CMP T5 + 0
+18fb : b0 bd __ BCS $18ba
+18fd : a9 00 __ LDA #$00
+18ff : 85 4e __ STA T5 + 0
+1901 : a5 4b __ LDA T3 + 0
+1903 : 85 43 __ STA T0 + 0
+1905 : a0 01 __ LDY #$01
+1907 : b1 0d __ LDA (P0),y
+1909 : 85 4b __ STA T3 + 0
+190b : 38 __ __ SEC
+190c : e5 43 __ SBC T0 + 0
+190e : 85 53 __ STA T10 + 0
+1910 : a9 00 __ LDA #$00
+1912 : e9 00 __ SBC #$00
+1914 : 85 54 __ STA T10 + 1
+1916 : a9 00 __ LDA #$00
+1918 : c5 54 __ CMP T10 + 1
+191a : d0 04 __ BNE $1920
+191c : a5 4e __ LDA T5 + 0
+191e : c5 53 __ CMP T10 + 0
+1920 : 90 05 __ BCC $1927
+1922 : a5 4b __ LDA T3 + 0
+1924 : 4c 88 18 JMP $1888 ; (nformf + 791)
+1927 : a9 20 __ LDA #$20
+1929 : a4 4e __ LDY T5 + 0
+192b : 91 0f __ STA (P2),y
+192d : e6 4e __ INC T5 + 0
+192f : 4c 05 19 JMP $1905 ; (nformf + 916)
+1932 : a9 45 __ LDA #$45
+1934 : a4 4b __ LDY T3 + 0
+1936 : 91 0f __ STA (P2),y
+1938 : c8 __ __ INY
+1939 : a5 44 __ LDA T0 + 1
+193b : 30 5a __ BMI $1997
+193d : a9 2b __ LDA #$2b
+193f : 91 0f __ STA (P2),y
+1941 : 18 __ __ CLC
+1942 : a5 4b __ LDA T3 + 0
+1944 : 69 02 __ ADC #$02
+1946 : 85 4b __ STA T3 + 0
+1948 : a5 43 __ LDA T0 + 0
+194a : 85 1b __ STA ACCU + 0
+194c : a5 44 __ LDA T0 + 1
+194e : 85 1c __ STA ACCU + 1
+1950 : a9 0a __ LDA #$0a
+1952 : 85 03 __ STA $03
+1954 : a9 00 __ LDA #$00
+1956 : 85 04 __ STA $04
+1958 : 20 25 1f JSR $1f25 ; (divs16 + 0)
+195b : 18 __ __ CLC
+195c : a5 1b __ LDA ACCU + 0
+195e : 69 30 __ ADC #$30
+1960 : a4 4b __ LDY T3 + 0
+1962 : 91 0f __ STA (P2),y
+1964 : c8 __ __ INY
+1965 : 98 __ __ TYA
+1966 : 18 __ __ CLC
+1967 : 65 0f __ ADC P2
+1969 : 85 4c __ STA T4 + 0
+196b : a5 10 __ LDA P3
+196d : 69 00 __ ADC #$00
+196f : 85 4d __ STA T4 + 1
+1971 : a5 43 __ LDA T0 + 0
+1973 : 85 1b __ STA ACCU + 0
+1975 : a5 44 __ LDA T0 + 1
+1977 : 85 1c __ STA ACCU + 1
+1979 : a9 0a __ LDA #$0a
+197b : 85 03 __ STA $03
+197d : a9 00 __ LDA #$00
+197f : 85 04 __ STA $04
+1981 : 20 e4 1f JSR $1fe4 ; (mods16 + 0)
+1984 : 18 __ __ CLC
+1985 : a5 05 __ LDA $05
+1987 : 69 30 __ ADC #$30
+1989 : a0 00 __ LDY #$00
+198b : 91 4c __ STA (T4 + 0),y
+198d : 18 __ __ CLC
+198e : a5 4b __ LDA T3 + 0
+1990 : 69 02 __ ADC #$02
+1992 : 85 4b __ STA T3 + 0
+1994 : 4c 80 18 JMP $1880 ; (nformf + 783)
+1997 : a9 2d __ LDA #$2d
+1999 : 91 0f __ STA (P2),y
+199b : 18 __ __ CLC
+199c : a5 4b __ LDA T3 + 0
+199e : 69 02 __ ADC #$02
+19a0 : 85 4b __ STA T3 + 0
+19a2 : 38 __ __ SEC
+19a3 : a9 00 __ LDA #$00
+19a5 : e5 43 __ SBC T0 + 0
+19a7 : 85 43 __ STA T0 + 0
+19a9 : a9 00 __ LDA #$00
+19ab : e5 44 __ SBC T0 + 1
+19ad : 85 44 __ STA T0 + 1
+19af : 4c 48 19 JMP $1948 ; (nformf + 983)
+19b2 : a5 50 __ LDA T6 + 0
+19b4 : c5 4e __ CMP T5 + 0
+19b6 : d0 08 __ BNE $19c0
+19b8 : a9 2e __ LDA #$2e
+19ba : a4 4b __ LDY T3 + 0
+19bc : 91 0f __ STA (P2),y
+19be : e6 4b __ INC T3 + 0
+19c0 : a5 11 __ LDA P4
+19c2 : 85 1b __ STA ACCU + 0
+19c4 : a5 12 __ LDA P5
+19c6 : 85 1c __ STA ACCU + 1
+19c8 : a5 13 __ LDA P6
+19ca : 85 1d __ STA ACCU + 2
+19cc : a5 14 __ LDA P7
+19ce : 85 1e __ STA ACCU + 3
+19d0 : 20 0d 20 JSR $200d ; (f32_to_i16 + 0)
+19d3 : a5 1b __ LDA ACCU + 0
+19d5 : 85 53 __ STA T10 + 0
+19d7 : 20 4f 20 JSR $204f ; (sint16_to_float + 0)
+19da : a5 1b __ LDA ACCU + 0
+19dc : 85 03 __ STA $03
+19de : a5 1c __ LDA ACCU + 1
+19e0 : 85 04 __ STA $04
+19e2 : a5 1d __ LDA ACCU + 2
+19e4 : 85 05 __ STA $05
+19e6 : a5 1e __ LDA ACCU + 3
+19e8 : 85 06 __ STA $06
+19ea : a5 11 __ LDA P4
+19ec : 85 1b __ STA ACCU + 0
+19ee : a5 12 __ LDA P5
+19f0 : 85 1c __ STA ACCU + 1
+19f2 : a5 13 __ LDA P6
+19f4 : 85 1d __ STA ACCU + 2
+19f6 : a5 14 __ LDA P7
+19f8 : 85 1e __ STA ACCU + 3
+19fa : 20 ce 1c JSR $1cce ; (freg + 20)
+19fd : a5 06 __ LDA $06
+19ff : 49 80 __ EOR #$80
+1a01 : 85 06 __ STA $06
+1a03 : 20 ff 1c JSR $1cff ; (faddsub + 0)
+1a06 : a9 00 __ LDA #$00
+1a08 : 85 03 __ STA $03
+1a0a : 85 04 __ STA $04
+1a0c : a9 20 __ LDA #$20
+1a0e : 85 05 __ STA $05
+1a10 : a9 41 __ LDA #$41
+1a12 : 85 06 __ STA $06
+1a14 : 20 ce 1c JSR $1cce ; (freg + 20)
+1a17 : 20 c7 1d JSR $1dc7 ; (fmul + 0)
+1a1a : a5 1b __ LDA ACCU + 0
+1a1c : 85 11 __ STA P4
+1a1e : a5 1c __ LDA ACCU + 1
+1a20 : 85 12 __ STA P5
+1a22 : a5 1d __ LDA ACCU + 2
+1a24 : 85 13 __ STA P6
+1a26 : a5 1e __ LDA ACCU + 3
+1a28 : 85 14 __ STA P7
+1a2a : 18 __ __ CLC
+1a2b : a5 53 __ LDA T10 + 0
+1a2d : 69 30 __ ADC #$30
+1a2f : a4 4b __ LDY T3 + 0
+1a31 : 91 0f __ STA (P2),y
+1a33 : e6 4b __ INC T3 + 0
+1a35 : e6 50 __ INC T6 + 0
+1a37 : a5 50 __ LDA T6 + 0
+1a39 : c5 4c __ CMP T4 + 0
+1a3b : b0 03 __ BCS $1a40
+1a3d : 4c b2 19 JMP $19b2 ; (nformf + 1089)
+1a40 : 4c 79 18 JMP $1879 ; (nformf + 776)
+1a43 : 85 50 __ STA T6 + 0
+1a45 : a5 47 __ LDA T2 + 0
+1a47 : 85 1b __ STA ACCU + 0
+1a49 : a5 48 __ LDA T2 + 1
+1a4b : 85 1c __ STA ACCU + 1
+1a4d : a5 49 __ LDA T2 + 2
+1a4f : 85 1d __ STA ACCU + 2
+1a51 : a5 4a __ LDA T2 + 3
+1a53 : 85 1e __ STA ACCU + 3
+1a55 : a9 00 __ LDA #$00
+1a57 : 85 03 __ STA $03
+1a59 : 85 04 __ STA $04
+1a5b : a9 20 __ LDA #$20
+1a5d : 85 05 __ STA $05
+1a5f : a9 41 __ LDA #$41
+1a61 : 85 06 __ STA $06
+1a63 : 20 ce 1c JSR $1cce ; (freg + 20)
+1a66 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+1a69 : a5 1b __ LDA ACCU + 0
+1a6b : 85 47 __ STA T2 + 0
+1a6d : a5 1c __ LDA ACCU + 1
+1a6f : 85 48 __ STA T2 + 1
+1a71 : a5 1d __ LDA ACCU + 2
+1a73 : 85 49 __ STA T2 + 2
+1a75 : a5 1e __ LDA ACCU + 3
+1a77 : 85 4a __ STA T2 + 3
+1a79 : e6 50 __ INC T6 + 0
+1a7b : a5 50 __ LDA T6 + 0
+1a7d : c5 4c __ CMP T4 + 0
+1a7f : 90 c4 __ BCC $1a45
+1a81 : 4c c2 17 JMP $17c2 ; (nformf + 593)
+1a84 : a5 11 __ LDA P4
+1a86 : 85 1b __ STA ACCU + 0
+1a88 : a5 12 __ LDA P5
+1a8a : 85 1c __ STA ACCU + 1
+1a8c : a5 13 __ LDA P6
+1a8e : 85 1d __ STA ACCU + 2
+1a90 : a5 14 __ LDA P7
+1a92 : 85 1e __ STA ACCU + 3
+1a94 : a9 00 __ LDA #$00
+1a96 : 85 03 __ STA $03
+1a98 : 85 04 __ STA $04
+1a9a : a9 20 __ LDA #$20
+1a9c : 85 05 __ STA $05
+1a9e : a9 41 __ LDA #$41
+1aa0 : 85 06 __ STA $06
+1aa2 : 20 ce 1c JSR $1cce ; (freg + 20)
+1aa5 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+1aa8 : a5 1b __ LDA ACCU + 0
+1aaa : 85 11 __ STA P4
+1aac : a5 1c __ LDA ACCU + 1
+1aae : 85 12 __ STA P5
+1ab0 : a5 1d __ LDA ACCU + 2
+1ab2 : 85 13 __ STA P6
+1ab4 : a5 1e __ LDA ACCU + 3
+1ab6 : 85 14 __ STA P7
+1ab8 : e6 43 __ INC T0 + 0
+1aba : d0 02 __ BNE $1abe
+1abc : e6 44 __ INC T0 + 1
+1abe : a5 44 __ LDA T0 + 1
+1ac0 : 30 c2 __ BMI $1a84
+1ac2 : 4c a4 17 JMP $17a4 ; (nformf + 563)
+1ac5 : a9 00 __ LDA #$00
+1ac7 : 85 47 __ STA T2 + 0
+1ac9 : 85 48 __ STA T2 + 1
+1acb : 85 49 __ STA T2 + 2
+1acd : a9 3f __ LDA #$3f
+1acf : 85 4a __ STA T2 + 3
+1ad1 : a5 4e __ LDA T5 + 0
+1ad3 : f0 03 __ BEQ $1ad8
+1ad5 : 4c 74 1b JMP $1b74 ; (nformf + 1539)
+1ad8 : a5 11 __ LDA P4
+1ada : 85 1b __ STA ACCU + 0
+1adc : a5 12 __ LDA P5
+1ade : 85 1c __ STA ACCU + 1
+1ae0 : a5 13 __ LDA P6
+1ae2 : 85 1d __ STA ACCU + 2
+1ae4 : a5 14 __ LDA P7
+1ae6 : 85 1e __ STA ACCU + 3
+1ae8 : a5 47 __ LDA T2 + 0
+1aea : 85 03 __ STA $03
+1aec : a5 48 __ LDA T2 + 1
+1aee : 85 04 __ STA $04
+1af0 : a5 49 __ LDA T2 + 2
+1af2 : 85 05 __ STA $05
+1af4 : a5 4a __ LDA T2 + 3
+1af6 : 85 06 __ STA $06
+1af8 : 20 ce 1c JSR $1cce ; (freg + 20)
+1afb : 20 ff 1c JSR $1cff ; (faddsub + 0)
+1afe : a5 1b __ LDA ACCU + 0
+1b00 : 85 11 __ STA P4
+1b02 : 85 47 __ STA T2 + 0
+1b04 : 85 03 __ STA $03
+1b06 : a5 1c __ LDA ACCU + 1
+1b08 : 85 12 __ STA P5
+1b0a : 85 48 __ STA T2 + 1
+1b0c : 85 04 __ STA $04
+1b0e : a5 1d __ LDA ACCU + 2
+1b10 : 85 13 __ STA P6
+1b12 : 85 49 __ STA T2 + 2
+1b14 : 85 05 __ STA $05
+1b16 : a5 1e __ LDA ACCU + 3
+1b18 : 85 14 __ STA P7
+1b1a : 85 4a __ STA T2 + 3
+1b1c : 85 06 __ STA $06
+1b1e : a9 00 __ LDA #$00
+1b20 : 85 1b __ STA ACCU + 0
+1b22 : 85 1c __ STA ACCU + 1
+1b24 : a9 20 __ LDA #$20
+1b26 : 85 1d __ STA ACCU + 2
+1b28 : a9 41 __ LDA #$41
+1b2a : 85 1e __ STA ACCU + 3
+1b2c : 20 9a 20 JSR $209a ; (fcmp + 0)
+1b2f : 10 03 __ BPL $1b34
+1b31 : 4c 51 18 JMP $1851 ; (nformf + 736)
+1b34 : a5 47 __ LDA T2 + 0
+1b36 : 85 1b __ STA ACCU + 0
+1b38 : a5 48 __ LDA T2 + 1
+1b3a : 85 1c __ STA ACCU + 1
+1b3c : a5 49 __ LDA T2 + 2
+1b3e : 85 1d __ STA ACCU + 2
+1b40 : a5 4a __ LDA T2 + 3
+1b42 : 85 1e __ STA ACCU + 3
+1b44 : a9 00 __ LDA #$00
+1b46 : 85 03 __ STA $03
+1b48 : 85 04 __ STA $04
+1b4a : a9 20 __ LDA #$20
+1b4c : 85 05 __ STA $05
+1b4e : a9 41 __ LDA #$41
+1b50 : 85 06 __ STA $06
+1b52 : 20 ce 1c JSR $1cce ; (freg + 20)
+1b55 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+1b58 : a5 1b __ LDA ACCU + 0
+1b5a : 85 11 __ STA P4
+1b5c : a5 1c __ LDA ACCU + 1
+1b5e : 85 12 __ STA P5
+1b60 : a5 1d __ LDA ACCU + 2
+1b62 : 85 13 __ STA P6
+1b64 : a5 1e __ LDA ACCU + 3
+1b66 : 85 14 __ STA P7
+1b68 : e6 43 __ INC T0 + 0
+1b6a : f0 03 __ BEQ $1b6f
+1b6c : 4c 51 18 JMP $1851 ; (nformf + 736)
+1b6f : e6 44 __ INC T0 + 1
+1b71 : 4c 51 18 JMP $1851 ; (nformf + 736)
+1b74 : a9 00 __ LDA #$00
+1b76 : 85 50 __ STA T6 + 0
+1b78 : a5 47 __ LDA T2 + 0
+1b7a : 85 1b __ STA ACCU + 0
+1b7c : a5 48 __ LDA T2 + 1
+1b7e : 85 1c __ STA ACCU + 1
+1b80 : a5 49 __ LDA T2 + 2
+1b82 : 85 1d __ STA ACCU + 2
+1b84 : a5 4a __ LDA T2 + 3
+1b86 : 85 1e __ STA ACCU + 3
+1b88 : a9 00 __ LDA #$00
+1b8a : 85 03 __ STA $03
+1b8c : 85 04 __ STA $04
+1b8e : a9 20 __ LDA #$20
+1b90 : 85 05 __ STA $05
+1b92 : a9 41 __ LDA #$41
+1b94 : 85 06 __ STA $06
+1b96 : 20 ce 1c JSR $1cce ; (freg + 20)
+1b99 : 20 65 1e JSR $1e65 ; (fdiv + 0)
+1b9c : a5 1b __ LDA ACCU + 0
+1b9e : 85 47 __ STA T2 + 0
+1ba0 : a5 1c __ LDA ACCU + 1
+1ba2 : 85 48 __ STA T2 + 1
+1ba4 : a5 1d __ LDA ACCU + 2
+1ba6 : 85 49 __ STA T2 + 2
+1ba8 : a5 1e __ LDA ACCU + 3
+1baa : 85 4a __ STA T2 + 3
+1bac : e6 50 __ INC T6 + 0
+1bae : a5 50 __ LDA T6 + 0
+1bb0 : c5 4e __ CMP T5 + 0
+1bb2 : 90 c4 __ BCC $1b78
+1bb4 : 4c d8 1a JMP $1ad8 ; (nformf + 1383)
+1bb7 : a5 44 __ LDA T0 + 1
+1bb9 : 10 0e __ BPL $1bc9
+1bbb : a5 44 __ LDA T0 + 1
+1bbd : 30 03 __ BMI $1bc2
+1bbf : 4c 96 17 JMP $1796 ; (nformf + 549)
+1bc2 : a9 01 __ LDA #$01
+1bc4 : 85 52 __ STA T8 + 0
+1bc6 : 4c c5 1a JMP $1ac5 ; (nformf + 1364)
+1bc9 : d0 f7 __ BNE $1bc2
+1bcb : a9 03 __ LDA #$03
+1bcd : c5 43 __ CMP T0 + 0
+1bcf : 90 f1 __ BCC $1bc2
+1bd1 : 4c bb 1b JMP $1bbb ; (nformf + 1610)
+1bd4 : a9 01 __ LDA #$01
+1bd6 : 4c 83 17 JMP $1783 ; (nformf + 530)
+1bd9 : a5 14 __ LDA P7
+1bdb : 49 80 __ EOR #$80
+1bdd : 85 14 __ STA P7
+1bdf : a9 2d __ LDA #$2d
+1be1 : a0 00 __ LDY #$00
+1be3 : 91 0f __ STA (P2),y
+1be5 : a9 01 __ LDA #$01
+1be7 : 85 4b __ STA T3 + 0
+1be9 : 4c be 15 JMP $15be ; (nformf + 77)
+--------------------------------------------------------------------
+strlen:
+1c05 : a9 00 __ LDA #$00
+1c07 : 85 43 __ STA T0 + 0
+1c09 : 85 44 __ STA T0 + 1
+1c0b : a0 00 __ LDY #$00
+1c0d : b1 0d __ LDA (P0),y
+1c0f : d0 09 __ BNE $1c1a
+1c11 : a5 43 __ LDA T0 + 0
+1c13 : 85 1b __ STA ACCU + 0
+1c15 : a5 44 __ LDA T0 + 1
+1c17 : 85 1c __ STA ACCU + 1
+1c19 : 60 __ __ RTS
+1c1a : 18 __ __ CLC
+1c1b : a5 0d __ LDA P0
+1c1d : 65 43 __ ADC T0 + 0
+1c1f : 85 48 __ STA T3 + 0
+1c21 : a5 0e __ LDA P1
+1c23 : 65 44 __ ADC T0 + 1
+1c25 : 85 49 __ STA T3 + 1
+1c27 : e6 43 __ INC T0 + 0
+1c29 : d0 02 __ BNE $1c2d
+1c2b : e6 44 __ INC T0 + 1
+1c2d : a0 01 __ LDY #$01
+1c2f : b1 48 __ LDA (T3 + 0),y
+1c31 : d0 e7 __ BNE $1c1a
+1c33 : 4c 11 1c JMP $1c11 ; (strlen + 12)
+--------------------------------------------------------------------
+strcmp:
+1c4c : a0 00 __ LDY #$00
+1c4e : 84 1c __ STY ACCU + 1
+1c50 : b1 0d __ LDA (P0),y
+1c52 : f0 16 __ BEQ $1c6a
+1c54 : d1 0f __ CMP (P2),y
+1c56 : d0 16 __ BNE $1c6e
+1c58 : c8 __ __ INY
+1c59 : b1 0d __ LDA (P0),y
+1c5b : f0 0d __ BEQ $1c6a
+1c5d : d1 0f __ CMP (P2),y
+1c5f : d0 0d __ BNE $1c6e
+1c61 : c8 __ __ INY
+1c62 : d0 ec __ BNE $1c50
+1c64 : e6 0e __ INC P1
+1c66 : e6 10 __ INC P3
+1c68 : d0 e6 __ BNE $1c50
+1c6a : d1 0f __ CMP (P2),y
+1c6c : f0 0a __ BEQ $1c78
+1c6e : b0 06 __ BCS $1c76
+1c70 : a9 ff __ LDA #$ff
+1c72 : 85 1c __ STA ACCU + 1
+1c74 : 30 02 __ BMI $1c78
+1c76 : a9 01 __ LDA #$01
+1c78 : 85 1b __ STA ACCU + 0
+1c7a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c89 : a9 4c __ LDA #$4c
+1c8b : 85 54 __ STA $54
+1c8d : a9 00 __ LDA #$00
+1c8f : 85 13 __ STA P6
+1c91 : a9 19 __ LDA #$19
+1c93 : 85 16 __ STA P9
+1c95 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+1c96 : a9 00 __ LDA #$00
+1c98 : 85 05 __ STA $05
+1c9a : 85 06 __ STA $06
+1c9c : a5 03 __ LDA $03
+1c9e : 4a __ __ LSR
+1c9f : 90 0f __ BCC $1cb0
+1ca1 : aa __ __ TAX
+1ca2 : 18 __ __ CLC
+1ca3 : a5 05 __ LDA $05
+1ca5 : 65 1b __ ADC ACCU + 0
+1ca7 : 85 05 __ STA $05
+1ca9 : a5 06 __ LDA $06
+1cab : 65 1c __ ADC ACCU + 1
+1cad : 85 06 __ STA $06
+1caf : 8a __ __ TXA
+1cb0 : 06 1b __ ASL ACCU + 0
+1cb2 : 26 1c __ ROL ACCU + 1
+1cb4 : 4a __ __ LSR
+1cb5 : b0 ea __ BCS $1ca1
+1cb7 : d0 f7 __ BNE $1cb0
+1cb9 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1cba : b1 19 __ LDA (IP + 0),y
+1cbc : c8 __ __ INY
+1cbd : aa __ __ TAX
+1cbe : b5 00 __ LDA $00,x
+1cc0 : 85 03 __ STA $03
+1cc2 : b5 01 __ LDA $01,x
+1cc4 : 85 04 __ STA $04
+1cc6 : b5 02 __ LDA $02,x
+1cc8 : 85 05 __ STA $05
+1cca : b5 03 __ LDA $03,x
+1ccc : 85 06 __ STA $06
+1cce : a5 05 __ LDA $05
+1cd0 : 0a __ __ ASL
+1cd1 : a5 06 __ LDA $06
+1cd3 : 2a __ __ ROL
+1cd4 : 85 08 __ STA $08
+1cd6 : f0 06 __ BEQ $1cde
+1cd8 : a5 05 __ LDA $05
+1cda : 09 80 __ ORA #$80
+1cdc : 85 05 __ STA $05
+1cde : a5 1d __ LDA ACCU + 2
+1ce0 : 0a __ __ ASL
+1ce1 : a5 1e __ LDA ACCU + 3
+1ce3 : 2a __ __ ROL
+1ce4 : 85 07 __ STA $07
+1ce6 : f0 06 __ BEQ $1cee
+1ce8 : a5 1d __ LDA ACCU + 2
+1cea : 09 80 __ ORA #$80
+1cec : 85 1d __ STA ACCU + 2
+1cee : 60 __ __ RTS
+1cef : 06 1e __ ASL ACCU + 3
+1cf1 : a5 07 __ LDA $07
+1cf3 : 6a __ __ ROR
+1cf4 : 85 1e __ STA ACCU + 3
+1cf6 : b0 06 __ BCS $1cfe
+1cf8 : a5 1d __ LDA ACCU + 2
+1cfa : 29 7f __ AND #$7f
+1cfc : 85 1d __ STA ACCU + 2
+1cfe : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1cff : 38 __ __ SEC
+1d00 : a5 07 __ LDA $07
+1d02 : e5 08 __ SBC $08
+1d04 : f0 38 __ BEQ $1d3e
+1d06 : aa __ __ TAX
+1d07 : b0 25 __ BCS $1d2e
+1d09 : e0 e9 __ CPX #$e9
+1d0b : b0 0e __ BCS $1d1b
+1d0d : a5 08 __ LDA $08
+1d0f : 85 07 __ STA $07
+1d11 : a9 00 __ LDA #$00
+1d13 : 85 1b __ STA ACCU + 0
+1d15 : 85 1c __ STA ACCU + 1
+1d17 : 85 1d __ STA ACCU + 2
+1d19 : f0 23 __ BEQ $1d3e
+1d1b : a5 1d __ LDA ACCU + 2
+1d1d : 4a __ __ LSR
+1d1e : 66 1c __ ROR ACCU + 1
+1d20 : 66 1b __ ROR ACCU + 0
+1d22 : e8 __ __ INX
+1d23 : d0 f8 __ BNE $1d1d
+1d25 : 85 1d __ STA ACCU + 2
+1d27 : a5 08 __ LDA $08
+1d29 : 85 07 __ STA $07
+1d2b : 4c 3e 1d JMP $1d3e ; (faddsub + 63)
+1d2e : e0 18 __ CPX #$18
+1d30 : b0 33 __ BCS $1d65
+1d32 : a5 05 __ LDA $05
+1d34 : 4a __ __ LSR
+1d35 : 66 04 __ ROR $04
+1d37 : 66 03 __ ROR $03
+1d39 : ca __ __ DEX
+1d3a : d0 f8 __ BNE $1d34
+1d3c : 85 05 __ STA $05
+1d3e : a5 1e __ LDA ACCU + 3
+1d40 : 29 80 __ AND #$80
+1d42 : 85 1e __ STA ACCU + 3
+1d44 : 45 06 __ EOR $06
+1d46 : 30 2d __ BMI $1d75
+1d48 : 18 __ __ CLC
+1d49 : a5 1b __ LDA ACCU + 0
+1d4b : 65 03 __ ADC $03
+1d4d : 85 1b __ STA ACCU + 0
+1d4f : a5 1c __ LDA ACCU + 1
+1d51 : 65 04 __ ADC $04
+1d53 : 85 1c __ STA ACCU + 1
+1d55 : a5 1d __ LDA ACCU + 2
+1d57 : 65 05 __ ADC $05
+1d59 : 85 1d __ STA ACCU + 2
+1d5b : 90 08 __ BCC $1d65
+1d5d : 66 1d __ ROR ACCU + 2
+1d5f : 66 1c __ ROR ACCU + 1
+1d61 : 66 1b __ ROR ACCU + 0
+1d63 : e6 07 __ INC $07
+1d65 : a5 07 __ LDA $07
+1d67 : 4a __ __ LSR
+1d68 : 05 1e __ ORA ACCU + 3
+1d6a : 85 1e __ STA ACCU + 3
+1d6c : b0 06 __ BCS $1d74
+1d6e : a5 1d __ LDA ACCU + 2
+1d70 : 29 7f __ AND #$7f
+1d72 : 85 1d __ STA ACCU + 2
+1d74 : 60 __ __ RTS
+1d75 : 38 __ __ SEC
+1d76 : a5 1b __ LDA ACCU + 0
+1d78 : e5 03 __ SBC $03
+1d7a : 85 1b __ STA ACCU + 0
+1d7c : a5 1c __ LDA ACCU + 1
+1d7e : e5 04 __ SBC $04
+1d80 : 85 1c __ STA ACCU + 1
+1d82 : a5 1d __ LDA ACCU + 2
+1d84 : e5 05 __ SBC $05
+1d86 : 85 1d __ STA ACCU + 2
+1d88 : b0 19 __ BCS $1da3
+1d8a : 38 __ __ SEC
+1d8b : a9 00 __ LDA #$00
+1d8d : e5 1b __ SBC ACCU + 0
+1d8f : 85 1b __ STA ACCU + 0
+1d91 : a9 00 __ LDA #$00
+1d93 : e5 1c __ SBC ACCU + 1
+1d95 : 85 1c __ STA ACCU + 1
+1d97 : a9 00 __ LDA #$00
+1d99 : e5 1d __ SBC ACCU + 2
+1d9b : 85 1d __ STA ACCU + 2
+1d9d : a5 1e __ LDA ACCU + 3
+1d9f : 49 80 __ EOR #$80
+1da1 : 85 1e __ STA ACCU + 3
+1da3 : a5 1d __ LDA ACCU + 2
+1da5 : 30 be __ BMI $1d65
+1da7 : 05 1c __ ORA ACCU + 1
+1da9 : 05 1b __ ORA ACCU + 0
+1dab : f0 0f __ BEQ $1dbc
+1dad : c6 07 __ DEC $07
+1daf : f0 0b __ BEQ $1dbc
+1db1 : 06 1b __ ASL ACCU + 0
+1db3 : 26 1c __ ROL ACCU + 1
+1db5 : 26 1d __ ROL ACCU + 2
+1db7 : 10 f4 __ BPL $1dad
+1db9 : 4c 65 1d JMP $1d65 ; (faddsub + 102)
+1dbc : a9 00 __ LDA #$00
+1dbe : 85 1b __ STA ACCU + 0
+1dc0 : 85 1c __ STA ACCU + 1
+1dc2 : 85 1d __ STA ACCU + 2
+1dc4 : 85 1e __ STA ACCU + 3
+1dc6 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1dc7 : a5 1b __ LDA ACCU + 0
+1dc9 : 05 1c __ ORA ACCU + 1
+1dcb : 05 1d __ ORA ACCU + 2
+1dcd : d0 03 __ BNE $1dd2
+1dcf : 85 1e __ STA ACCU + 3
+1dd1 : 60 __ __ RTS
+1dd2 : a5 03 __ LDA $03
+1dd4 : 05 04 __ ORA $04
+1dd6 : 05 05 __ ORA $05
+1dd8 : d0 09 __ BNE $1de3
+1dda : 85 1b __ STA ACCU + 0
+1ddc : 85 1c __ STA ACCU + 1
+1dde : 85 1d __ STA ACCU + 2
+1de0 : 85 1e __ STA ACCU + 3
+1de2 : 60 __ __ RTS
+1de3 : a9 00 __ LDA #$00
+1de5 : 85 09 __ STA $09
+1de7 : 85 0a __ STA $0a
+1de9 : 85 0b __ STA $0b
+1deb : a4 1b __ LDY ACCU + 0
+1ded : a5 03 __ LDA $03
+1def : d0 06 __ BNE $1df7
+1df1 : a5 04 __ LDA $04
+1df3 : f0 0a __ BEQ $1dff
+1df5 : d0 05 __ BNE $1dfc
+1df7 : 20 37 1e JSR $1e37 ; (fmul8 + 0)
+1dfa : a5 04 __ LDA $04
+1dfc : 20 37 1e JSR $1e37 ; (fmul8 + 0)
+1dff : a5 05 __ LDA $05
+1e01 : 20 37 1e JSR $1e37 ; (fmul8 + 0)
+1e04 : 38 __ __ SEC
+1e05 : a5 0b __ LDA $0b
+1e07 : 30 06 __ BMI $1e0f
+1e09 : 06 09 __ ASL $09
+1e0b : 26 0a __ ROL $0a
+1e0d : 2a __ __ ROL
+1e0e : 18 __ __ CLC
+1e0f : 29 7f __ AND #$7f
+1e11 : 85 0b __ STA $0b
+1e13 : a5 1e __ LDA ACCU + 3
+1e15 : 45 06 __ EOR $06
+1e17 : 29 80 __ AND #$80
+1e19 : 85 1e __ STA ACCU + 3
+1e1b : a5 07 __ LDA $07
+1e1d : e9 7e __ SBC #$7e
+1e1f : 18 __ __ CLC
+1e20 : 65 08 __ ADC $08
+1e22 : 4a __ __ LSR
+1e23 : 05 1e __ ORA ACCU + 3
+1e25 : 85 1e __ STA ACCU + 3
+1e27 : a9 00 __ LDA #$00
+1e29 : 6a __ __ ROR
+1e2a : 05 0b __ ORA $0b
+1e2c : 85 1d __ STA ACCU + 2
+1e2e : a5 0a __ LDA $0a
+1e30 : 85 1c __ STA ACCU + 1
+1e32 : a5 09 __ LDA $09
+1e34 : 85 1b __ STA ACCU + 0
+1e36 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1e37 : 38 __ __ SEC
+1e38 : 6a __ __ ROR
+1e39 : 90 1e __ BCC $1e59
+1e3b : aa __ __ TAX
+1e3c : 18 __ __ CLC
+1e3d : 98 __ __ TYA
+1e3e : 65 09 __ ADC $09
+1e40 : 85 09 __ STA $09
+1e42 : a5 0a __ LDA $0a
+1e44 : 65 1c __ ADC ACCU + 1
+1e46 : 85 0a __ STA $0a
+1e48 : a5 0b __ LDA $0b
+1e4a : 65 1d __ ADC ACCU + 2
+1e4c : 6a __ __ ROR
+1e4d : 85 0b __ STA $0b
+1e4f : 8a __ __ TXA
+1e50 : 66 0a __ ROR $0a
+1e52 : 66 09 __ ROR $09
+1e54 : 4a __ __ LSR
+1e55 : f0 0d __ BEQ $1e64
+1e57 : b0 e2 __ BCS $1e3b
+1e59 : 66 0b __ ROR $0b
+1e5b : 66 0a __ ROR $0a
+1e5d : 66 09 __ ROR $09
+1e5f : 4a __ __ LSR
+1e60 : 90 f7 __ BCC $1e59
+1e62 : d0 d7 __ BNE $1e3b
+1e64 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1e65 : a5 1b __ LDA ACCU + 0
+1e67 : 05 1c __ ORA ACCU + 1
+1e69 : 05 1d __ ORA ACCU + 2
+1e6b : d0 03 __ BNE $1e70
+1e6d : 85 1e __ STA ACCU + 3
+1e6f : 60 __ __ RTS
+1e70 : a5 1e __ LDA ACCU + 3
+1e72 : 45 06 __ EOR $06
+1e74 : 29 80 __ AND #$80
+1e76 : 85 1e __ STA ACCU + 3
+1e78 : a9 00 __ LDA #$00
+1e7a : 85 09 __ STA $09
+1e7c : 85 0a __ STA $0a
+1e7e : 85 0b __ STA $0b
+1e80 : a2 18 __ LDX #$18
+1e82 : a5 1b __ LDA ACCU + 0
+1e84 : c5 03 __ CMP $03
+1e86 : a5 1c __ LDA ACCU + 1
+1e88 : e5 04 __ SBC $04
+1e8a : a5 1d __ LDA ACCU + 2
+1e8c : e5 05 __ SBC $05
+1e8e : 90 13 __ BCC $1ea3
+1e90 : a5 1b __ LDA ACCU + 0
+1e92 : e5 03 __ SBC $03
+1e94 : 85 1b __ STA ACCU + 0
+1e96 : a5 1c __ LDA ACCU + 1
+1e98 : e5 04 __ SBC $04
+1e9a : 85 1c __ STA ACCU + 1
+1e9c : a5 1d __ LDA ACCU + 2
+1e9e : e5 05 __ SBC $05
+1ea0 : 85 1d __ STA ACCU + 2
+1ea2 : 38 __ __ SEC
+1ea3 : 26 09 __ ROL $09
+1ea5 : 26 0a __ ROL $0a
+1ea7 : 26 0b __ ROL $0b
+1ea9 : ca __ __ DEX
+1eaa : f0 0a __ BEQ $1eb6
+1eac : 06 1b __ ASL ACCU + 0
+1eae : 26 1c __ ROL ACCU + 1
+1eb0 : 26 1d __ ROL ACCU + 2
+1eb2 : b0 dc __ BCS $1e90
+1eb4 : 90 cc __ BCC $1e82
+1eb6 : 38 __ __ SEC
+1eb7 : a5 0b __ LDA $0b
+1eb9 : 30 06 __ BMI $1ec1
+1ebb : 06 09 __ ASL $09
+1ebd : 26 0a __ ROL $0a
+1ebf : 2a __ __ ROL
+1ec0 : 18 __ __ CLC
+1ec1 : 29 7f __ AND #$7f
+1ec3 : 85 0b __ STA $0b
+1ec5 : a5 08 __ LDA $08
+1ec7 : 49 7f __ EOR #$7f
+1ec9 : 65 07 __ ADC $07
+1ecb : 38 __ __ SEC
+1ecc : e9 01 __ SBC #$01
+1ece : 4a __ __ LSR
+1ecf : 05 1e __ ORA ACCU + 3
+1ed1 : 85 1e __ STA ACCU + 3
+1ed3 : a9 00 __ LDA #$00
+1ed5 : 6a __ __ ROR
+1ed6 : 05 0b __ ORA $0b
+1ed8 : 85 1d __ STA ACCU + 2
+1eda : a5 0a __ LDA $0a
+1edc : 85 1c __ STA ACCU + 1
+1ede : a5 09 __ LDA $09
+1ee0 : 85 1b __ STA ACCU + 0
+1ee2 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+1ee3 : a0 00 __ LDY #$00
+1ee5 : 84 06 __ STY $06
+1ee7 : a5 03 __ LDA $03
+1ee9 : a6 04 __ LDX $04
+1eeb : f0 1c __ BEQ $1f09
+1eed : 38 __ __ SEC
+1eee : 6a __ __ ROR
+1eef : 90 0d __ BCC $1efe
+1ef1 : aa __ __ TAX
+1ef2 : 18 __ __ CLC
+1ef3 : 98 __ __ TYA
+1ef4 : 65 1b __ ADC ACCU + 0
+1ef6 : a8 __ __ TAY
+1ef7 : a5 06 __ LDA $06
+1ef9 : 65 1c __ ADC ACCU + 1
+1efb : 85 06 __ STA $06
+1efd : 8a __ __ TXA
+1efe : 06 1b __ ASL ACCU + 0
+1f00 : 26 1c __ ROL ACCU + 1
+1f02 : 4a __ __ LSR
+1f03 : 90 f9 __ BCC $1efe
+1f05 : d0 ea __ BNE $1ef1
+1f07 : a5 04 __ LDA $04
+1f09 : 4a __ __ LSR
+1f0a : 90 0d __ BCC $1f19
+1f0c : aa __ __ TAX
+1f0d : 18 __ __ CLC
+1f0e : 98 __ __ TYA
+1f0f : 65 1b __ ADC ACCU + 0
+1f11 : a8 __ __ TAY
+1f12 : a5 06 __ LDA $06
+1f14 : 65 1c __ ADC ACCU + 1
+1f16 : 85 06 __ STA $06
+1f18 : 8a __ __ TXA
+1f19 : 06 1b __ ASL ACCU + 0
+1f1b : 26 1c __ ROL ACCU + 1
+1f1d : 4a __ __ LSR
+1f1e : b0 ec __ BCS $1f0c
+1f20 : d0 f7 __ BNE $1f19
+1f22 : 84 05 __ STY $05
+1f24 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1f25 : 24 1c __ BIT ACCU + 1
+1f27 : 10 0d __ BPL $1f36
+1f29 : 20 43 1f JSR $1f43 ; (negaccu + 0)
+1f2c : 24 04 __ BIT $04
+1f2e : 10 0d __ BPL $1f3d
+1f30 : 20 51 1f JSR $1f51 ; (negtmp + 0)
+1f33 : 4c 5f 1f JMP $1f5f ; (divmod + 0)
+1f36 : 24 04 __ BIT $04
+1f38 : 10 f9 __ BPL $1f33
+1f3a : 20 51 1f JSR $1f51 ; (negtmp + 0)
+1f3d : 20 5f 1f JSR $1f5f ; (divmod + 0)
+1f40 : 4c 43 1f JMP $1f43 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1f43 : 38 __ __ SEC
+1f44 : a9 00 __ LDA #$00
+1f46 : e5 1b __ SBC ACCU + 0
+1f48 : 85 1b __ STA ACCU + 0
+1f4a : a9 00 __ LDA #$00
+1f4c : e5 1c __ SBC ACCU + 1
+1f4e : 85 1c __ STA ACCU + 1
+1f50 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1f51 : 38 __ __ SEC
+1f52 : a9 00 __ LDA #$00
+1f54 : e5 03 __ SBC $03
+1f56 : 85 03 __ STA $03
+1f58 : a9 00 __ LDA #$00
+1f5a : e5 04 __ SBC $04
+1f5c : 85 04 __ STA $04
+1f5e : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1f5f : a5 1c __ LDA ACCU + 1
+1f61 : d0 31 __ BNE $1f94
+1f63 : a5 04 __ LDA $04
+1f65 : d0 1e __ BNE $1f85
+1f67 : 85 06 __ STA $06
+1f69 : a2 04 __ LDX #$04
+1f6b : 06 1b __ ASL ACCU + 0
+1f6d : 2a __ __ ROL
+1f6e : c5 03 __ CMP $03
+1f70 : 90 02 __ BCC $1f74
+1f72 : e5 03 __ SBC $03
+1f74 : 26 1b __ ROL ACCU + 0
+1f76 : 2a __ __ ROL
+1f77 : c5 03 __ CMP $03
+1f79 : 90 02 __ BCC $1f7d
+1f7b : e5 03 __ SBC $03
+1f7d : 26 1b __ ROL ACCU + 0
+1f7f : ca __ __ DEX
+1f80 : d0 eb __ BNE $1f6d
+1f82 : 85 05 __ STA $05
+1f84 : 60 __ __ RTS
+1f85 : a5 1b __ LDA ACCU + 0
+1f87 : 85 05 __ STA $05
+1f89 : a5 1c __ LDA ACCU + 1
+1f8b : 85 06 __ STA $06
+1f8d : a9 00 __ LDA #$00
+1f8f : 85 1b __ STA ACCU + 0
+1f91 : 85 1c __ STA ACCU + 1
+1f93 : 60 __ __ RTS
+1f94 : a5 04 __ LDA $04
+1f96 : d0 1f __ BNE $1fb7
+1f98 : a5 03 __ LDA $03
+1f9a : 30 1b __ BMI $1fb7
+1f9c : a9 00 __ LDA #$00
+1f9e : 85 06 __ STA $06
+1fa0 : a2 10 __ LDX #$10
+1fa2 : 06 1b __ ASL ACCU + 0
+1fa4 : 26 1c __ ROL ACCU + 1
+1fa6 : 2a __ __ ROL
+1fa7 : c5 03 __ CMP $03
+1fa9 : 90 02 __ BCC $1fad
+1fab : e5 03 __ SBC $03
+1fad : 26 1b __ ROL ACCU + 0
+1faf : 26 1c __ ROL ACCU + 1
+1fb1 : ca __ __ DEX
+1fb2 : d0 f2 __ BNE $1fa6
+1fb4 : 85 05 __ STA $05
+1fb6 : 60 __ __ RTS
+1fb7 : a9 00 __ LDA #$00
+1fb9 : 85 05 __ STA $05
+1fbb : 85 06 __ STA $06
+1fbd : 84 02 __ STY $02
+1fbf : a0 10 __ LDY #$10
+1fc1 : 18 __ __ CLC
+1fc2 : 26 1b __ ROL ACCU + 0
+1fc4 : 26 1c __ ROL ACCU + 1
+1fc6 : 26 05 __ ROL $05
+1fc8 : 26 06 __ ROL $06
+1fca : 38 __ __ SEC
+1fcb : a5 05 __ LDA $05
+1fcd : e5 03 __ SBC $03
+1fcf : aa __ __ TAX
+1fd0 : a5 06 __ LDA $06
+1fd2 : e5 04 __ SBC $04
+1fd4 : 90 04 __ BCC $1fda
+1fd6 : 86 05 __ STX $05
+1fd8 : 85 06 __ STA $06
+1fda : 88 __ __ DEY
+1fdb : d0 e5 __ BNE $1fc2
+1fdd : 26 1b __ ROL ACCU + 0
+1fdf : 26 1c __ ROL ACCU + 1
+1fe1 : a4 02 __ LDY $02
+1fe3 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+1fe4 : 24 1c __ BIT ACCU + 1
+1fe6 : 10 0d __ BPL $1ff5
+1fe8 : 20 43 1f JSR $1f43 ; (negaccu + 0)
+1feb : 24 04 __ BIT $04
+1fed : 10 0d __ BPL $1ffc
+1fef : 20 51 1f JSR $1f51 ; (negtmp + 0)
+1ff2 : 4c 5f 1f JMP $1f5f ; (divmod + 0)
+1ff5 : 24 04 __ BIT $04
+1ff7 : 10 f9 __ BPL $1ff2
+1ff9 : 20 51 1f JSR $1f51 ; (negtmp + 0)
+1ffc : 20 5f 1f JSR $1f5f ; (divmod + 0)
+1fff : 38 __ __ SEC
+2000 : a9 00 __ LDA #$00
+2002 : e5 05 __ SBC $05
+2004 : 85 05 __ STA $05
+2006 : a9 00 __ LDA #$00
+2008 : e5 06 __ SBC $06
+200a : 85 06 __ STA $06
+200c : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+200d : 20 de 1c JSR $1cde ; (freg + 36)
+2010 : a5 07 __ LDA $07
+2012 : c9 7f __ CMP #$7f
+2014 : b0 07 __ BCS $201d
+2016 : a9 00 __ LDA #$00
+2018 : 85 1b __ STA ACCU + 0
+201a : 85 1c __ STA ACCU + 1
+201c : 60 __ __ RTS
+201d : 38 __ __ SEC
+201e : e9 8e __ SBC #$8e
+2020 : 90 0a __ BCC $202c
+2022 : a9 ff __ LDA #$ff
+2024 : 85 1b __ STA ACCU + 0
+2026 : a9 7f __ LDA #$7f
+2028 : 85 1c __ STA ACCU + 1
+202a : d0 08 __ BNE $2034
+202c : aa __ __ TAX
+202d : 46 1d __ LSR ACCU + 2
+202f : 66 1c __ ROR ACCU + 1
+2031 : e8 __ __ INX
+2032 : d0 f9 __ BNE $202d
+2034 : 24 1e __ BIT ACCU + 3
+2036 : 10 0e __ BPL $2046
+2038 : 38 __ __ SEC
+2039 : a9 00 __ LDA #$00
+203b : e5 1c __ SBC ACCU + 1
+203d : 85 1b __ STA ACCU + 0
+203f : a9 00 __ LDA #$00
+2041 : e5 1d __ SBC ACCU + 2
+2043 : 85 1c __ STA ACCU + 1
+2045 : 60 __ __ RTS
+2046 : a5 1c __ LDA ACCU + 1
+2048 : 85 1b __ STA ACCU + 0
+204a : a5 1d __ LDA ACCU + 2
+204c : 85 1c __ STA ACCU + 1
+204e : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+204f : 24 1c __ BIT ACCU + 1
+2051 : 30 03 __ BMI $2056
+2053 : 4c 6d 20 JMP $206d ; (uint16_to_float + 0)
+2056 : 38 __ __ SEC
+2057 : a9 00 __ LDA #$00
+2059 : e5 1b __ SBC ACCU + 0
+205b : 85 1b __ STA ACCU + 0
+205d : a9 00 __ LDA #$00
+205f : e5 1c __ SBC ACCU + 1
+2061 : 85 1c __ STA ACCU + 1
+2063 : 20 6d 20 JSR $206d ; (uint16_to_float + 0)
+2066 : a5 1e __ LDA ACCU + 3
+2068 : 09 80 __ ORA #$80
+206a : 85 1e __ STA ACCU + 3
+206c : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+206d : a5 1b __ LDA ACCU + 0
+206f : 05 1c __ ORA ACCU + 1
+2071 : d0 05 __ BNE $2078
+2073 : 85 1d __ STA ACCU + 2
+2075 : 85 1e __ STA ACCU + 3
+2077 : 60 __ __ RTS
+2078 : a2 8e __ LDX #$8e
+207a : a5 1c __ LDA ACCU + 1
+207c : 30 06 __ BMI $2084
+207e : ca __ __ DEX
+207f : 06 1b __ ASL ACCU + 0
+2081 : 2a __ __ ROL
+2082 : 10 fa __ BPL $207e
+2084 : 29 7f __ AND #$7f
+2086 : 85 1d __ STA ACCU + 2
+2088 : a5 1b __ LDA ACCU + 0
+208a : 85 1c __ STA ACCU + 1
+208c : 8a __ __ TXA
+208d : 4a __ __ LSR
+208e : 85 1e __ STA ACCU + 3
+2090 : a9 00 __ LDA #$00
+2092 : 85 1b __ STA ACCU + 0
+2094 : 6a __ __ ROR
+2095 : 05 1d __ ORA ACCU + 2
+2097 : 85 1d __ STA ACCU + 2
+2099 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+209a : a5 1e __ LDA ACCU + 3
+209c : 45 06 __ EOR $06
+209e : 29 80 __ AND #$80
+20a0 : f0 1e __ BEQ $20c0
+20a2 : a5 1e __ LDA ACCU + 3
+20a4 : 29 7f __ AND #$7f
+20a6 : 05 1d __ ORA ACCU + 2
+20a8 : 05 1c __ ORA ACCU + 1
+20aa : 05 1b __ ORA ACCU + 0
+20ac : d0 0c __ BNE $20ba
+20ae : a5 06 __ LDA $06
+20b0 : 29 7f __ AND #$7f
+20b2 : 05 05 __ ORA $05
+20b4 : 05 04 __ ORA $04
+20b6 : 05 03 __ ORA $03
+20b8 : f0 1e __ BEQ $20d8
+20ba : a5 1e __ LDA ACCU + 3
+20bc : 30 23 __ BMI $20e1
+20be : 10 28 __ BPL $20e8
+20c0 : a5 1e __ LDA ACCU + 3
+20c2 : c5 06 __ CMP $06
+20c4 : d0 15 __ BNE $20db
+20c6 : a5 1d __ LDA ACCU + 2
+20c8 : c5 05 __ CMP $05
+20ca : d0 0f __ BNE $20db
+20cc : a5 1c __ LDA ACCU + 1
+20ce : c5 04 __ CMP $04
+20d0 : d0 09 __ BNE $20db
+20d2 : a5 1b __ LDA ACCU + 0
+20d4 : c5 03 __ CMP $03
+20d6 : d0 03 __ BNE $20db
+20d8 : a9 00 __ LDA #$00
+20da : 60 __ __ RTS
+20db : b0 07 __ BCS $20e4
+20dd : 24 1e __ BIT ACCU + 3
+20df : 30 07 __ BMI $20e8
+20e1 : a9 01 __ LDA #$01
+20e3 : 60 __ __ RTS
+20e4 : 24 1e __ BIT ACCU + 3
+20e6 : 30 f9 __ BMI $20e1
+20e8 : a9 ff __ LDA #$ff
+20ea : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+20eb : 84 02 __ STY $02
+20ed : a9 00 __ LDA #$00
+20ef : 85 07 __ STA $07
+20f1 : 85 08 __ STA $08
+20f3 : 85 09 __ STA $09
+20f5 : 85 0a __ STA $0a
+20f7 : a0 20 __ LDY #$20
+20f9 : 18 __ __ CLC
+20fa : 26 1b __ ROL ACCU + 0
+20fc : 26 1c __ ROL ACCU + 1
+20fe : 26 1d __ ROL ACCU + 2
+2100 : 26 1e __ ROL ACCU + 3
+2102 : 26 07 __ ROL $07
+2104 : 26 08 __ ROL $08
+2106 : 26 09 __ ROL $09
+2108 : 26 0a __ ROL $0a
+210a : a5 07 __ LDA $07
+210c : c5 03 __ CMP $03
+210e : a5 08 __ LDA $08
+2110 : e5 04 __ SBC $04
+2112 : a5 09 __ LDA $09
+2114 : e5 05 __ SBC $05
+2116 : a5 0a __ LDA $0a
+2118 : e5 06 __ SBC $06
+211a : 90 18 __ BCC $2134
+211c : a5 07 __ LDA $07
+211e : e5 03 __ SBC $03
+2120 : 85 07 __ STA $07
+2122 : a5 08 __ LDA $08
+2124 : e5 04 __ SBC $04
+2126 : 85 08 __ STA $08
+2128 : a5 09 __ LDA $09
+212a : e5 05 __ SBC $05
+212c : 85 09 __ STA $09
+212e : a5 0a __ LDA $0a
+2130 : e5 06 __ SBC $06
+2132 : 85 0a __ STA $0a
+2134 : 88 __ __ DEY
+2135 : d0 c3 __ BNE $20fa
+2137 : 26 1b __ ROL ACCU + 0
+2139 : 26 1c __ ROL ACCU + 1
+213b : 26 1d __ ROL ACCU + 2
+213d : 26 1e __ ROL ACCU + 3
+213f : a4 02 __ LDY $02
+2141 : 60 __ __ RTS
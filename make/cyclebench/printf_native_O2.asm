@@ -0,0 +1,3151 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e fd 20 STX $20fd ; (spentry + 0)
+0811 : a9 fe __ LDA #$fe
+0813 : 85 19 __ STA IP + 0
+0815 : a9 20 __ LDA #$20
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 21 __ LDA #$21
+081c : e9 20 __ SBC #$20
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 6a __ LDA #$6a
+0832 : e9 fe __ SBC #$fe
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 44 1c JMP $1c44 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 67 __ STA T0 + 0
+0911 : 85 68 __ STA T0 + 1
+0913 : 85 69 __ STA T1 + 0
+0915 : 85 6a __ STA T1 + 1
+0917 : a9 fe __ LDA #$fe
+0919 : a0 02 __ LDY #$02
+091b : 91 23 __ STA (SP + 0),y
+091d : a9 20 __ LDA #$20
+091f : c8 __ __ INY
+0920 : 91 23 __ STA (SP + 0),y
+0922 : a9 a7 __ LDA #$a7
+0924 : c8 __ __ INY
+0925 : 91 23 __ STA (SP + 0),y
+0927 : a9 1b __ LDA #$1b
+0929 : c8 __ __ INY
+092a : 91 23 __ STA (SP + 0),y
+092c : a5 69 __ LDA T1 + 0
+092e : 85 1b __ STA ACCU + 0
+0930 : a5 6a __ LDA T1 + 1
+0932 : 85 1c __ STA ACCU + 1
+0934 : a9 4b __ LDA #$4b
+0936 : 85 03 __ STA $03
+0938 : a9 01 __ LDA #$01
+093a : 85 04 __ STA $04
+093c : 20 9e 1e JSR $1e9e ; (mul16 + 0)
+093f : 38 __ __ SEC
+0940 : a5 05 __ LDA $05
+0942 : e9 80 __ SBC #$80
+0944 : a0 06 __ LDY #$06
+0946 : 91 23 __ STA (SP + 0),y
+0948 : a5 06 __ LDA $06
+094a : e9 3e __ SBC #$3e
+094c : c8 __ __ INY
+094d : 91 23 __ STA (SP + 0),y
+094f : a5 69 __ LDA T1 + 0
+0951 : 85 1b __ STA ACCU + 0
+0953 : a5 6a __ LDA T1 + 1
+0955 : 85 1c __ STA ACCU + 1
+0957 : a9 69 __ LDA #$69
+0959 : 85 03 __ STA $03
+095b : a9 02 __ LDA #$02
+095d : 85 04 __ STA $04
+095f : 20 9e 1e JSR $1e9e ; (mul16 + 0)
+0962 : a5 05 __ LDA $05
+0964 : a0 08 __ LDY #$08
+0966 : 91 23 __ STA (SP + 0),y
+0968 : a5 06 __ LDA $06
+096a : c8 __ __ INY
+096b : 91 23 __ STA (SP + 0),y
+096d : a5 69 __ LDA T1 + 0
+096f : 85 1b __ STA ACCU + 0
+0971 : a5 6a __ LDA T1 + 1
+0973 : 85 1c __ STA ACCU + 1
+0975 : a9 61 __ LDA #$61
+0977 : 85 03 __ STA $03
+0979 : 20 51 1c JSR $1c51 ; (mul16by8 + 0)
+097c : a5 05 __ LDA $05
+097e : a0 0a __ LDY #$0a
+0980 : 91 23 __ STA (SP + 0),y
+0982 : a5 06 __ LDA $06
+0984 : c8 __ __ INY
+0985 : 91 23 __ STA (SP + 0),y
+0987 : a5 69 __ LDA T1 + 0
+0989 : c8 __ __ INY
+098a : 91 23 __ STA (SP + 0),y
+098c : a5 6a __ LDA T1 + 1
+098e : c8 __ __ INY
+098f : 91 23 __ STA (SP + 0),y
+0991 : 38 __ __ SEC
+0992 : a9 00 __ LDA #$00
+0994 : e5 69 __ SBC T1 + 0
+0996 : c8 __ __ INY
+0997 : 91 23 __ STA (SP + 0),y
+0999 : a9 00 __ LDA #$00
+099b : e5 6a __ SBC T1 + 1
+099d : c8 __ __ INY
+099e : 91 23 __ STA (SP + 0),y
+09a0 : a9 bc __ LDA #$bc
+09a2 : c8 __ __ INY
+09a3 : 91 23 __ STA (SP + 0),y
+09a5 : a9 1b __ LDA #$1b
+09a7 : c8 __ __ INY
+09a8 : 91 23 __ STA (SP + 0),y
+09aa : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+09ad : a9 fe __ LDA #$fe
+09af : 85 0d __ STA P0
+09b1 : a9 20 __ LDA #$20
+09b3 : 85 0e __ STA P1
+09b5 : 20 c0 1b JSR $1bc0 ; (strlen + 0)
+09b8 : 18 __ __ CLC
+09b9 : a5 1b __ LDA ACCU + 0
+09bb : 65 67 __ ADC T0 + 0
+09bd : 85 67 __ STA T0 + 0
+09bf : a5 1c __ LDA ACCU + 1
+09c1 : 65 68 __ ADC T0 + 1
+09c3 : 85 68 __ STA T0 + 1
+09c5 : ad fe 20 LDA $20fe ; (buffer + 0)
+09c8 : f0 03 __ BEQ $09cd
+09ca : 4c 0d 0b JMP $0b0d ; (main + 525)
+09cd : e6 69 __ INC T1 + 0
+09cf : d0 02 __ BNE $09d3
+09d1 : e6 6a __ INC T1 + 1
+09d3 : a5 69 __ LDA T1 + 0
+09d5 : c9 64 __ CMP #$64
+09d7 : b0 03 __ BCS $09dc
+09d9 : 4c 17 09 JMP $0917 ; (main + 23)
+09dc : a9 00 __ LDA #$00
+09de : 85 6d __ STA T4 + 0
+09e0 : a9 fe __ LDA #$fe
+09e2 : a0 02 __ LDY #$02
+09e4 : 91 23 __ STA (SP + 0),y
+09e6 : a9 20 __ LDA #$20
+09e8 : c8 __ __ INY
+09e9 : 91 23 __ STA (SP + 0),y
+09eb : a9 f1 __ LDA #$f1
+09ed : c8 __ __ INY
+09ee : 91 23 __ STA (SP + 0),y
+09f0 : a9 1b __ LDA #$1b
+09f2 : c8 __ __ INY
+09f3 : 91 23 __ STA (SP + 0),y
+09f5 : a5 6d __ LDA T4 + 0
+09f7 : 85 1b __ STA ACCU + 0
+09f9 : a9 00 __ LDA #$00
+09fb : 85 1c __ STA ACCU + 1
+09fd : 20 0a 20 JSR $200a ; (sint16_to_float + 0)
+0a00 : a5 1b __ LDA ACCU + 0
+0a02 : 85 47 __ STA T6 + 0
+0a04 : a5 1c __ LDA ACCU + 1
+0a06 : 85 48 __ STA T6 + 1
+0a08 : a5 1d __ LDA ACCU + 2
+0a0a : 85 49 __ STA T6 + 2
+0a0c : a5 1e __ LDA ACCU + 3
+0a0e : 85 4a __ STA T6 + 3
+0a10 : a9 00 __ LDA #$00
+0a12 : 85 03 __ STA $03
+0a14 : 85 04 __ STA $04
+0a16 : a9 a0 __ LDA #$a0
+0a18 : 85 05 __ STA $05
+0a1a : a9 3f __ LDA #$3f
+0a1c : 85 06 __ STA $06
+0a1e : 20 89 1c JSR $1c89 ; (freg + 20)
+0a21 : 20 82 1d JSR $1d82 ; (fmul + 0)
+0a24 : a5 1b __ LDA ACCU + 0
+0a26 : a0 06 __ LDY #$06
+0a28 : 91 23 __ STA (SP + 0),y
+0a2a : a5 1c __ LDA ACCU + 1
+0a2c : c8 __ __ INY
+0a2d : 91 23 __ STA (SP + 0),y
+0a2f : a5 1d __ LDA ACCU + 2
+0a31 : c8 __ __ INY
+0a32 : 91 23 __ STA (SP + 0),y
+0a34 : a5 1e __ LDA ACCU + 3
+0a36 : c8 __ __ INY
+0a37 : 91 23 __ STA (SP + 0),y
+0a39 : a5 47 __ LDA T6 + 0
+0a3b : 85 1b __ STA ACCU + 0
+0a3d : a5 48 __ LDA T6 + 1
+0a3f : 85 1c __ STA ACCU + 1
+0a41 : a5 49 __ LDA T6 + 2
+0a43 : 85 1d __ STA ACCU + 2
+0a45 : a5 4a __ LDA T6 + 3
+0a47 : 85 1e __ STA ACCU + 3
+0a49 : a9 00 __ LDA #$00
+0a4b : 85 03 __ STA $03
+0a4d : 85 04 __ STA $04
+0a4f : a9 80 __ LDA #$80
+0a51 : 85 05 __ STA $05
+0a53 : a9 bd __ LDA #$bd
+0a55 : 85 06 __ STA $06
+0a57 : 20 89 1c JSR $1c89 ; (freg + 20)
+0a5a : 20 82 1d JSR $1d82 ; (fmul + 0)
+0a5d : a5 1b __ LDA ACCU + 0
+0a5f : a0 0a __ LDY #$0a
+0a61 : 91 23 __ STA (SP + 0),y
+0a63 : a5 1c __ LDA ACCU + 1
+0a65 : c8 __ __ INY
+0a66 : 91 23 __ STA (SP + 0),y
+0a68 : a5 1d __ LDA ACCU + 2
+0a6a : c8 __ __ INY
+0a6b : 91 23 __ STA (SP + 0),y
+0a6d : a5 1e __ LDA ACCU + 3
+0a6f : c8 __ __ INY
+0a70 : 91 23 __ STA (SP + 0),y
+0a72 : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+0a75 : a9 fe __ LDA #$fe
+0a77 : 85 0d __ STA P0
+0a79 : a9 20 __ LDA #$20
+0a7b : 85 0e __ STA P1
+0a7d : 20 c0 1b JSR $1bc0 ; (strlen + 0)
+0a80 : e6 6d __ INC T4 + 0
+0a82 : 18 __ __ CLC
+0a83 : a5 1b __ LDA ACCU + 0
+0a85 : 65 67 __ ADC T0 + 0
+0a87 : 85 67 __ STA T0 + 0
+0a89 : a5 1c __ LDA ACCU + 1
+0a8b : 65 68 __ ADC T0 + 1
+0a8d : 85 68 __ STA T0 + 1
+0a8f : a5 6d __ LDA T4 + 0
+0a91 : c9 14 __ CMP #$14
+0a93 : b0 03 __ BCS $0a98
+0a95 : 4c e0 09 JMP $09e0 ; (main + 224)
+0a98 : a9 fe __ LDA #$fe
+0a9a : a0 02 __ LDY #$02
+0a9c : 91 23 __ STA (SP + 0),y
+0a9e : a9 20 __ LDA #$20
+0aa0 : c8 __ __ INY
+0aa1 : 91 23 __ STA (SP + 0),y
+0aa3 : a9 fa __ LDA #$fa
+0aa5 : c8 __ __ INY
+0aa6 : 91 23 __ STA (SP + 0),y
+0aa8 : a9 1b __ LDA #$1b
+0aaa : c8 __ __ INY
+0aab : 91 23 __ STA (SP + 0),y
+0aad : a9 85 __ LDA #$85
+0aaf : c8 __ __ INY
+0ab0 : 91 23 __ STA (SP + 0),y
+0ab2 : a9 ff __ LDA #$ff
+0ab4 : c8 __ __ INY
+0ab5 : 91 23 __ STA (SP + 0),y
+0ab7 : a9 03 __ LDA #$03
+0ab9 : c8 __ __ INY
+0aba : 91 23 __ STA (SP + 0),y
+0abc : a9 1c __ LDA #$1c
+0abe : c8 __ __ INY
+0abf : 91 23 __ STA (SP + 0),y
+0ac1 : a9 ef __ LDA #$ef
+0ac3 : c8 __ __ INY
+0ac4 : 91 23 __ STA (SP + 0),y
+0ac6 : a9 be __ LDA #$be
+0ac8 : c8 __ __ INY
+0ac9 : 91 23 __ STA (SP + 0),y
+0acb : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+0ace : a9 fe __ LDA #$fe
+0ad0 : 85 0d __ STA P0
+0ad2 : a9 20 __ LDA #$20
+0ad4 : 85 0e __ STA P1
+0ad6 : a9 36 __ LDA #$36
+0ad8 : 85 0f __ STA P2
+0ada : a9 1c __ LDA #$1c
+0adc : 85 10 __ STA P3
+0ade : 20 07 1c JSR $1c07 ; (strcmp + 0)
+0ae1 : a5 1b __ LDA ACCU + 0
+0ae3 : 05 1c __ ORA ACCU + 1
+0ae5 : d0 21 __ BNE $0b08
+0ae7 : a5 67 __ LDA T0 + 0
+0ae9 : 05 68 __ ORA T0 + 1
+0aeb : f0 16 __ BEQ $0b03
+0aed : a9 00 __ LDA #$00
+0aef : 85 1b __ STA ACCU + 0
+0af1 : a9 00 __ LDA #$00
+0af3 : 85 1c __ STA ACCU + 1
+0af5 : 18 __ __ CLC
+0af6 : a5 23 __ LDA SP + 0
+0af8 : 69 12 __ ADC #$12
+0afa : 85 23 __ STA SP + 0
+0afc : a5 24 __ LDA SP + 1
+0afe : 69 00 __ ADC #$00
+0b00 : 85 24 __ STA SP + 1
+0b02 : 60 __ __ RTS
+0b03 : a9 01 __ LDA #$01
+0b05 : 4c ef 0a JMP $0aef ; (main + 495)
+0b08 : a9 01 __ LDA #$01
+0b0a : 4c ef 0a JMP $0aef ; (main + 495)
+0b0d : a9 00 __ LDA #$00
+0b0f : 85 6b __ STA T2 + 0
+0b11 : 85 6c __ STA T2 + 1
+0b13 : 18 __ __ CLC
+0b14 : a9 ff __ LDA #$ff
+0b16 : 65 6b __ ADC T2 + 0
+0b18 : 85 45 __ STA T5 + 0
+0b1a : a9 20 __ LDA #$20
+0b1c : 69 00 __ ADC #$00
+0b1e : 85 46 __ STA T5 + 1
+0b20 : 18 __ __ CLC
+0b21 : a4 6b __ LDY T2 + 0
+0b23 : b9 fe 20 LDA $20fe,y ; (buffer + 0)
+0b26 : 65 67 __ ADC T0 + 0
+0b28 : 85 67 __ STA T0 + 0
+0b2a : a9 00 __ LDA #$00
+0b2c : 65 68 __ ADC T0 + 1
+0b2e : 85 68 __ STA T0 + 1
+0b30 : a0 00 __ LDY #$00
+0b32 : e6 6b __ INC T2 + 0
+0b34 : d0 02 __ BNE $0b38
+0b36 : e6 6c __ INC T2 + 1
+0b38 : b1 45 __ LDA (T5 + 0),y
+0b3a : d0 d7 __ BNE $0b13
+0b3c : 4c cd 09 JMP $09cd ; (main + 205)
+--------------------------------------------------------------------
+sprintf:
+0b3f : a9 00 __ LDA #$00
+0b41 : 85 43 __ STA T0 + 0
+0b43 : a0 04 __ LDY #$04
+0b45 : b1 23 __ LDA (SP + 0),y
+0b47 : 85 5d __ STA T1 + 0
+0b49 : c8 __ __ INY
+0b4a : b1 23 __ LDA (SP + 0),y
+0b4c : 85 5e __ STA T1 + 1
+0b4e : a0 00 __ LDY #$00
+0b50 : b1 5d __ LDA (T1 + 0),y
+0b52 : 85 45 __ STA T2 + 0
+0b54 : a0 02 __ LDY #$02
+0b56 : b1 23 __ LDA (SP + 0),y
+0b58 : 85 5f __ STA T3 + 0
+0b5a : c8 __ __ INY
+0b5b : b1 23 __ LDA (SP + 0),y
+0b5d : 85 60 __ STA T3 + 1
+0b5f : a5 45 __ LDA T2 + 0
+0b61 : d0 37 __ BNE $0b9a
+0b63 : 18 __ __ CLC
+0b64 : a5 5f __ LDA T3 + 0
+0b66 : 65 43 __ ADC T0 + 0
+0b68 : 85 5d __ STA T1 + 0
+0b6a : a5 60 __ LDA T3 + 1
+0b6c : 69 00 __ ADC #$00
+0b6e : 85 5e __ STA T1 + 1
+0b70 : a9 00 __ LDA #$00
+0b72 : a4 43 __ LDY T0 + 0
+0b74 : 91 5f __ STA (T3 + 0),y
+0b76 : 98 __ __ TYA
+0b77 : d0 08 __ BNE $0b81
+0b79 : a5 5f __ LDA T3 + 0
+0b7b : 85 5d __ STA T1 + 0
+0b7d : a5 60 __ LDA T3 + 1
+0b7f : 85 5e __ STA T1 + 1
+0b81 : a0 02 __ LDY #$02
+0b83 : b1 23 __ LDA (SP + 0),y
+0b85 : 85 5f __ STA T3 + 0
+0b87 : c8 __ __ INY
+0b88 : b1 23 __ LDA (SP + 0),y
+0b8a : 85 60 __ STA T3 + 1
+0b8c : 38 __ __ SEC
+0b8d : a5 5d __ LDA T1 + 0
+0b8f : e5 5f __ SBC T3 + 0
+0b91 : 85 1b __ STA ACCU + 0
+0b93 : a5 5e __ LDA T1 + 1
+0b95 : e5 60 __ SBC T3 + 1
+0b97 : 85 1c __ STA ACCU + 1
+0b99 : 60 __ __ RTS
+0b9a : 18 __ __ CLC
+0b9b : a5 23 __ LDA SP + 0
+0b9d : 69 06 __ ADC #$06
+0b9f : 85 61 __ STA T4 + 0
+0ba1 : a5 24 __ LDA SP + 1
+0ba3 : 69 00 __ ADC #$00
+0ba5 : 85 62 __ STA T4 + 1
+0ba7 : e6 5d __ INC T1 + 0
+0ba9 : d0 02 __ BNE $0bad
+0bab : e6 5e __ INC T1 + 1
+0bad : a5 45 __ LDA T2 + 0
+0baf : c9 25 __ CMP #$25
+0bb1 : f0 3d __ BEQ $0bf0
+0bb3 : a4 43 __ LDY T0 + 0
+0bb5 : 91 5f __ STA (T3 + 0),y
+0bb7 : e6 43 __ INC T0 + 0
+0bb9 : a5 43 __ LDA T0 + 0
+0bbb : c9 28 __ CMP #$28
+0bbd : a0 00 __ LDY #$00
+0bbf : 90 20 __ BCC $0be1
+0bc1 : 18 __ __ CLC
+0bc2 : 65 5f __ ADC T3 + 0
+0bc4 : 85 5f __ STA T3 + 0
+0bc6 : 90 02 __ BCC $0bca
+0bc8 : e6 60 __ INC T3 + 1
+0bca : a9 00 __ LDA #$00
+0bcc : 85 43 __ STA T0 + 0
+0bce : b1 5d __ LDA (T1 + 0),y
+0bd0 : 85 47 __ STA T5 + 0
+0bd2 : e6 5d __ INC T1 + 0
+0bd4 : d0 02 __ BNE $0bd8
+0bd6 : e6 5e __ INC T1 + 1
+0bd8 : a5 47 __ LDA T5 + 0
+0bda : 85 45 __ STA T2 + 0
+0bdc : d0 cf __ BNE $0bad
+0bde : 4c 63 0b JMP $0b63 ; (sprintf + 36)
+0be1 : a0 00 __ LDY #$00
+0be3 : b1 5d __ LDA (T1 + 0),y
+0be5 : 85 47 __ STA T5 + 0
+0be7 : e6 5d __ INC T1 + 0
+0be9 : d0 02 __ BNE $0bed
+0beb : e6 5e __ INC T1 + 1
+0bed : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0bf0 : a5 43 __ LDA T0 + 0
+0bf2 : f0 0d __ BEQ $0c01
+0bf4 : 18 __ __ CLC
+0bf5 : 65 5f __ ADC T3 + 0
+0bf7 : 85 5f __ STA T3 + 0
+0bf9 : 90 02 __ BCC $0bfd
+0bfb : e6 60 __ INC T3 + 1
+0bfd : a9 00 __ LDA #$00
+0bff : 85 43 __ STA T0 + 0
+0c01 : a0 00 __ LDY #$00
+0c03 : b1 5d __ LDA (T1 + 0),y
+0c05 : 85 45 __ STA T2 + 0
+0c07 : a9 0a __ LDA #$0a
+0c09 : 8d 65 21 STA $2165 ; (sframe + 3)
+0c0c : a9 00 __ LDA #$00
+0c0e : 8d 66 21 STA $2166 ; (sframe + 4)
+0c11 : a9 01 __ LDA #$01
+0c13 : 8d 63 21 STA $2163 ; (sframe + 1)
+0c16 : a9 ff __ LDA #$ff
+0c18 : 8d 64 21 STA $2164 ; (sframe + 2)
+0c1b : a9 20 __ LDA #$20
+0c1d : 8d 62 21 STA $2162 ; (sframe + 0)
+0c20 : a9 00 __ LDA #$00
+0c22 : 8d 67 21 STA $2167 ; (sframe + 5)
+0c25 : 8d 68 21 STA $2168 ; (sframe + 6)
+0c28 : 8d 69 21 STA $2169 ; (sframe + 7)
+0c2b : e6 5d __ INC T1 + 0
+0c2d : d0 02 __ BNE $0c31
+0c2f : e6 5e __ INC T1 + 1
+0c31 : a5 45 __ LDA T2 + 0
+0c33 : c9 2b __ CMP #$2b
+0c35 : d0 03 __ BNE $0c3a
+0c37 : 4c 50 13 JMP $1350 ; (sprintf + 2065)
+0c3a : c9 30 __ CMP #$30
+0c3c : d0 03 __ BNE $0c41
+0c3e : 4c 42 13 JMP $1342 ; (sprintf + 2051)
+0c41 : c9 23 __ CMP #$23
+0c43 : d0 03 __ BNE $0c48
+0c45 : 4c 34 13 JMP $1334 ; (sprintf + 2037)
+0c48 : c9 30 __ CMP #$30
+0c4a : 90 64 __ BCC $0cb0
+0c4c : a9 39 __ LDA #$39
+0c4e : c5 45 __ CMP T2 + 0
+0c50 : 90 5e __ BCC $0cb0
+0c52 : a9 00 __ LDA #$00
+0c54 : 85 49 __ STA T6 + 0
+0c56 : 85 4a __ STA T6 + 1
+0c58 : a5 45 __ LDA T2 + 0
+0c5a : c9 30 __ CMP #$30
+0c5c : 90 4d __ BCC $0cab
+0c5e : a9 39 __ LDA #$39
+0c60 : c5 45 __ CMP T2 + 0
+0c62 : 90 47 __ BCC $0cab
+0c64 : a5 45 __ LDA T2 + 0
+0c66 : 85 4b __ STA T7 + 0
+0c68 : a0 00 __ LDY #$00
+0c6a : b1 5d __ LDA (T1 + 0),y
+0c6c : 85 45 __ STA T2 + 0
+0c6e : e6 5d __ INC T1 + 0
+0c70 : d0 02 __ BNE $0c74
+0c72 : e6 5e __ INC T1 + 1
+0c74 : a5 49 __ LDA T6 + 0
+0c76 : 0a __ __ ASL
+0c77 : 85 07 __ STA $07
+0c79 : a5 4a __ LDA T6 + 1
+0c7b : 2a __ __ ROL
+0c7c : 06 07 __ ASL $07
+0c7e : 2a __ __ ROL
+0c7f : aa __ __ TAX
+0c80 : 18 __ __ CLC
+0c81 : a5 07 __ LDA $07
+0c83 : 65 49 __ ADC T6 + 0
+0c85 : 85 1b __ STA ACCU + 0
+0c87 : 8a __ __ TXA
+0c88 : 65 4a __ ADC T6 + 1
+0c8a : 06 1b __ ASL ACCU + 0
+0c8c : 2a __ __ ROL
+0c8d : 85 1c __ STA ACCU + 1
+0c8f : 18 __ __ CLC
+0c90 : a5 1b __ LDA ACCU + 0
+0c92 : 65 4b __ ADC T7 + 0
+0c94 : aa __ __ TAX
+0c95 : a5 1c __ LDA ACCU + 1
+0c97 : 69 00 __ ADC #$00
+0c99 : a8 __ __ TAY
+0c9a : 38 __ __ SEC
+0c9b : 8a __ __ TXA
+0c9c : e9 30 __ SBC #$30
+0c9e : 85 49 __ STA T6 + 0
+0ca0 : 98 __ __ TYA
+0ca1 : e9 00 __ SBC #$00
+0ca3 : 85 4a __ STA T6 + 1
+0ca5 : a5 45 __ LDA T2 + 0
+0ca7 : c9 30 __ CMP #$30
+0ca9 : b0 b3 __ BCS $0c5e
+0cab : a5 49 __ LDA T6 + 0
+0cad : 8d 63 21 STA $2163 ; (sframe + 1)
+0cb0 : a5 45 __ LDA T2 + 0
+0cb2 : c9 2e __ CMP #$2e
+0cb4 : d0 03 __ BNE $0cb9
+0cb6 : 4c c7 12 JMP $12c7 ; (sprintf + 1928)
+0cb9 : a5 45 __ LDA T2 + 0
+0cbb : c9 64 __ CMP #$64
+0cbd : d0 03 __ BNE $0cc2
+0cbf : 4c 40 11 JMP $1140 ; (sprintf + 1537)
+0cc2 : c9 75 __ CMP #$75
+0cc4 : d0 03 __ BNE $0cc9
+0cc6 : 4c 00 10 JMP $1000 ; (sprintf + 1217)
+0cc9 : c9 78 __ CMP #$78
+0ccb : d0 03 __ BNE $0cd0
+0ccd : 4c a9 0e JMP $0ea9 ; (sprintf + 874)
+0cd0 : c9 6c __ CMP #$6c
+0cd2 : d0 03 __ BNE $0cd7
+0cd4 : 4c bf 0d JMP $0dbf ; (sprintf + 640)
+0cd7 : c9 66 __ CMP #$66
+0cd9 : d0 03 __ BNE $0cde
+0cdb : 4c 79 0d JMP $0d79 ; (sprintf + 570)
+0cde : c9 67 __ CMP #$67
+0ce0 : d0 03 __ BNE $0ce5
+0ce2 : 4c 79 0d JMP $0d79 ; (sprintf + 570)
+0ce5 : c9 65 __ CMP #$65
+0ce7 : d0 03 __ BNE $0cec
+0ce9 : 4c 79 0d JMP $0d79 ; (sprintf + 570)
+0cec : c9 73 __ CMP #$73
+0cee : f0 46 __ BEQ $0d36
+0cf0 : c9 63 __ CMP #$63
+0cf2 : f0 1e __ BEQ $0d12
+0cf4 : 09 00 __ ORA #$00
+0cf6 : d0 03 __ BNE $0cfb
+0cf8 : 4c e1 0b JMP $0be1 ; (sprintf + 162)
+0cfb : a5 45 __ LDA T2 + 0
+0cfd : a4 43 __ LDY T0 + 0
+0cff : 91 5f __ STA (T3 + 0),y
+0d01 : e6 43 __ INC T0 + 0
+0d03 : a0 00 __ LDY #$00
+0d05 : b1 5d __ LDA (T1 + 0),y
+0d07 : 85 47 __ STA T5 + 0
+0d09 : e6 5d __ INC T1 + 0
+0d0b : d0 02 __ BNE $0d0f
+0d0d : e6 5e __ INC T1 + 1
+0d0f : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0d12 : a0 00 __ LDY #$00
+0d14 : b1 61 __ LDA (T4 + 0),y
+0d16 : a4 43 __ LDY T0 + 0
+0d18 : 91 5f __ STA (T3 + 0),y
+0d1a : 18 __ __ CLC
+0d1b : a5 61 __ LDA T4 + 0
+0d1d : 69 02 __ ADC #$02
+0d1f : 85 61 __ STA T4 + 0
+0d21 : 90 02 __ BCC $0d25
+0d23 : e6 62 __ INC T4 + 1
+0d25 : e6 43 __ INC T0 + 0
+0d27 : a0 00 __ LDY #$00
+0d29 : b1 5d __ LDA (T1 + 0),y
+0d2b : 85 47 __ STA T5 + 0
+0d2d : e6 5d __ INC T1 + 0
+0d2f : d0 02 __ BNE $0d33
+0d31 : e6 5e __ INC T1 + 1
+0d33 : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0d36 : a0 00 __ LDY #$00
+0d38 : b1 61 __ LDA (T4 + 0),y
+0d3a : 85 49 __ STA T6 + 0
+0d3c : c8 __ __ INY
+0d3d : b1 61 __ LDA (T4 + 0),y
+0d3f : 85 4a __ STA T6 + 1
+0d41 : 18 __ __ CLC
+0d42 : a5 61 __ LDA T4 + 0
+0d44 : 69 02 __ ADC #$02
+0d46 : 85 61 __ STA T4 + 0
+0d48 : 90 02 __ BCC $0d4c
+0d4a : e6 62 __ INC T4 + 1
+0d4c : 88 __ __ DEY
+0d4d : b1 49 __ LDA (T6 + 0),y
+0d4f : 85 45 __ STA T2 + 0
+0d51 : d0 03 __ BNE $0d56
+0d53 : 4c e1 0b JMP $0be1 ; (sprintf + 162)
+0d56 : e6 49 __ INC T6 + 0
+0d58 : d0 02 __ BNE $0d5c
+0d5a : e6 4a __ INC T6 + 1
+0d5c : a5 45 __ LDA T2 + 0
+0d5e : a0 00 __ LDY #$00
+0d60 : 91 5f __ STA (T3 + 0),y
+0d62 : e6 5f __ INC T3 + 0
+0d64 : d0 02 __ BNE $0d68
+0d66 : e6 60 __ INC T3 + 1
+0d68 : b1 49 __ LDA (T6 + 0),y
+0d6a : aa __ __ TAX
+0d6b : e6 49 __ INC T6 + 0
+0d6d : d0 02 __ BNE $0d71
+0d6f : e6 4a __ INC T6 + 1
+0d71 : 8a __ __ TXA
+0d72 : 86 45 __ STX T2 + 0
+0d74 : d0 e6 __ BNE $0d5c
+0d76 : 4c e1 0b JMP $0be1 ; (sprintf + 162)
+0d79 : a9 62 __ LDA #$62
+0d7b : 85 0d __ STA P0
+0d7d : a9 21 __ LDA #$21
+0d7f : 85 0e __ STA P1
+0d81 : a5 5f __ LDA T3 + 0
+0d83 : 85 0f __ STA P2
+0d85 : a5 60 __ LDA T3 + 1
+0d87 : 85 10 __ STA P3
+0d89 : a0 00 __ LDY #$00
+0d8b : b1 61 __ LDA (T4 + 0),y
+0d8d : 85 11 __ STA P4
+0d8f : c8 __ __ INY
+0d90 : b1 61 __ LDA (T4 + 0),y
+0d92 : 85 12 __ STA P5
+0d94 : c8 __ __ INY
+0d95 : b1 61 __ LDA (T4 + 0),y
+0d97 : 85 13 __ STA P6
+0d99 : c8 __ __ INY
+0d9a : b1 61 __ LDA (T4 + 0),y
+0d9c : 85 14 __ STA P7
+0d9e : 20 5a 15 JSR $155a ; (nformf + 0)
+0da1 : a5 1b __ LDA ACCU + 0
+0da3 : 85 43 __ STA T0 + 0
+0da5 : 18 __ __ CLC
+0da6 : a5 61 __ LDA T4 + 0
+0da8 : 69 04 __ ADC #$04
+0daa : 85 61 __ STA T4 + 0
+0dac : 90 02 __ BCC $0db0
+0dae : e6 62 __ INC T4 + 1
+0db0 : a0 00 __ LDY #$00
+0db2 : b1 5d __ LDA (T1 + 0),y
+0db4 : 85 47 __ STA T5 + 0
+0db6 : e6 5d __ INC T1 + 0
+0db8 : d0 02 __ BNE $0dbc
+0dba : e6 5e __ INC T1 + 1
+0dbc : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0dbf : a0 00 __ LDY #$00
+0dc1 : b1 61 __ LDA (T4 + 0),y
+0dc3 : 85 63 __ STA T11 + 0
+0dc5 : c8 __ __ INY
+0dc6 : b1 61 __ LDA (T4 + 0),y
+0dc8 : 85 64 __ STA T11 + 1
+0dca : c8 __ __ INY
+0dcb : b1 61 __ LDA (T4 + 0),y
+0dcd : 85 65 __ STA T11 + 2
+0dcf : c8 __ __ INY
+0dd0 : b1 61 __ LDA (T4 + 0),y
+0dd2 : 85 66 __ STA T11 + 3
+0dd4 : 18 __ __ CLC
+0dd5 : a5 61 __ LDA T4 + 0
+0dd7 : 69 04 __ ADC #$04
+0dd9 : 85 61 __ STA T4 + 0
+0ddb : 90 02 __ BCC $0ddf
+0ddd : e6 62 __ INC T4 + 1
+0ddf : a0 00 __ LDY #$00
+0de1 : b1 5d __ LDA (T1 + 0),y
+0de3 : aa __ __ TAX
+0de4 : e6 5d __ INC T1 + 0
+0de6 : d0 02 __ BNE $0dea
+0de8 : e6 5e __ INC T1 + 1
+0dea : 8a __ __ TXA
+0deb : e0 64 __ CPX #$64
+0ded : d0 03 __ BNE $0df2
+0def : 4c 73 0e JMP $0e73 ; (sprintf + 820)
+0df2 : c9 75 __ CMP #$75
+0df4 : f0 47 __ BEQ $0e3d
+0df6 : c9 78 __ CMP #$78
+0df8 : f0 03 __ BEQ $0dfd
+0dfa : 4c e1 0b JMP $0be1 ; (sprintf + 162)
+0dfd : a9 10 __ LDA #$10
+0dff : 8d 65 21 STA $2165 ; (sframe + 3)
+0e02 : a9 00 __ LDA #$00
+0e04 : 8d 66 21 STA $2166 ; (sframe + 4)
+0e07 : a9 62 __ LDA #$62
+0e09 : 85 0d __ STA P0
+0e0b : a9 21 __ LDA #$21
+0e0d : 85 0e __ STA P1
+0e0f : a5 5f __ LDA T3 + 0
+0e11 : 85 0f __ STA P2
+0e13 : a5 60 __ LDA T3 + 1
+0e15 : 85 10 __ STA P3
+0e17 : a5 63 __ LDA T11 + 0
+0e19 : 85 11 __ STA P4
+0e1b : a5 64 __ LDA T11 + 1
+0e1d : 85 12 __ STA P5
+0e1f : a5 65 __ LDA T11 + 2
+0e21 : 85 13 __ STA P6
+0e23 : a5 66 __ LDA T11 + 3
+0e25 : 85 14 __ STA P7
+0e27 : 20 5e 13 JSR $135e ; (nforml + 0)
+0e2a : a5 1b __ LDA ACCU + 0
+0e2c : 85 43 __ STA T0 + 0
+0e2e : a0 00 __ LDY #$00
+0e30 : b1 5d __ LDA (T1 + 0),y
+0e32 : 85 47 __ STA T5 + 0
+0e34 : e6 5d __ INC T1 + 0
+0e36 : d0 02 __ BNE $0e3a
+0e38 : e6 5e __ INC T1 + 1
+0e3a : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0e3d : a9 62 __ LDA #$62
+0e3f : 85 0d __ STA P0
+0e41 : a9 21 __ LDA #$21
+0e43 : 85 0e __ STA P1
+0e45 : a5 5f __ LDA T3 + 0
+0e47 : 85 0f __ STA P2
+0e49 : a5 60 __ LDA T3 + 1
+0e4b : 85 10 __ STA P3
+0e4d : a5 63 __ LDA T11 + 0
+0e4f : 85 11 __ STA P4
+0e51 : a5 64 __ LDA T11 + 1
+0e53 : 85 12 __ STA P5
+0e55 : a5 65 __ LDA T11 + 2
+0e57 : 85 13 __ STA P6
+0e59 : a5 66 __ LDA T11 + 3
+0e5b : 85 14 __ STA P7
+0e5d : 20 5e 13 JSR $135e ; (nforml + 0)
+0e60 : a5 1b __ LDA ACCU + 0
+0e62 : 85 43 __ STA T0 + 0
+0e64 : a0 00 __ LDY #$00
+0e66 : b1 5d __ LDA (T1 + 0),y
+0e68 : 85 47 __ STA T5 + 0
+0e6a : e6 5d __ INC T1 + 0
+0e6c : d0 02 __ BNE $0e70
+0e6e : e6 5e __ INC T1 + 1
+0e70 : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0e73 : a9 62 __ LDA #$62
+0e75 : 85 0d __ STA P0
+0e77 : a9 21 __ LDA #$21
+0e79 : 85 0e __ STA P1
+0e7b : a5 5f __ LDA T3 + 0
+0e7d : 85 0f __ STA P2
+0e7f : a5 60 __ LDA T3 + 1
+0e81 : 85 10 __ STA P3
+0e83 : a5 63 __ LDA T11 + 0
+0e85 : 85 11 __ STA P4
+0e87 : a5 64 __ LDA T11 + 1
+0e89 : 85 12 __ STA P5
+0e8b : a5 65 __ LDA T11 + 2
+0e8d : 85 13 __ STA P6
+0e8f : a5 66 __ LDA T11 + 3
+0e91 : 85 14 __ STA P7
+0e93 : 20 5e 13 JSR $135e ; (nforml + 0)
+0e96 : a5 1b __ LDA ACCU + 0
+0e98 : 85 43 __ STA T0 + 0
+0e9a : a0 00 __ LDY #$00
+0e9c : b1 5d __ LDA (T1 + 0),y
+0e9e : 85 47 __ STA T5 + 0
+0ea0 : e6 5d __ INC T1 + 0
+0ea2 : d0 02 __ BNE $0ea6
+0ea4 : e6 5e __ INC T1 + 1
+0ea6 : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0ea9 : a9 10 __ LDA #$10
+0eab : 8d 65 21 STA $2165 ; (sframe + 3)
+0eae : a9 00 __ LDA #$00
+0eb0 : 8d 66 21 STA $2166 ; (sframe + 4)
+0eb3 : a5 5f __ LDA T3 + 0
+0eb5 : 85 49 __ STA T6 + 0
+0eb7 : a5 60 __ LDA T3 + 1
+0eb9 : 85 4a __ STA T6 + 1
+0ebb : a0 00 __ LDY #$00
+0ebd : b1 61 __ LDA (T4 + 0),y
+0ebf : 85 4b __ STA T7 + 0
+0ec1 : c8 __ __ INY
+0ec2 : b1 61 __ LDA (T4 + 0),y
+0ec4 : 85 4c __ STA T7 + 1
+0ec6 : 18 __ __ CLC
+0ec7 : a5 61 __ LDA T4 + 0
+0ec9 : 69 02 __ ADC #$02
+0ecb : 85 61 __ STA T4 + 0
+0ecd : 90 02 __ BCC $0ed1
+0ecf : e6 62 __ INC T4 + 1
+0ed1 : a9 0a __ LDA #$0a
+0ed3 : 85 43 __ STA T0 + 0
+0ed5 : a5 4b __ LDA T7 + 0
+0ed7 : 05 4c __ ORA T7 + 1
+0ed9 : f0 03 __ BEQ $0ede
+0edb : 4c a8 0f JMP $0fa8 ; (sprintf + 1129)
+0ede : ad 64 21 LDA $2164 ; (sframe + 2)
+0ee1 : c9 ff __ CMP #$ff
+0ee3 : d0 03 __ BNE $0ee8
+0ee5 : 4c 9a 0f JMP $0f9a ; (sprintf + 1115)
+0ee8 : 38 __ __ SEC
+0ee9 : a9 0a __ LDA #$0a
+0eeb : ed 64 21 SBC $2164 ; (sframe + 2)
+0eee : 85 45 __ STA T2 + 0
+0ef0 : c5 43 __ CMP T0 + 0
+0ef2 : b0 0e __ BCS $0f02
+0ef4 : c6 43 __ DEC T0 + 0
+0ef6 : a9 30 __ LDA #$30
+0ef8 : a4 43 __ LDY T0 + 0
+0efa : 91 49 __ STA (T6 + 0),y
+0efc : a5 45 __ LDA T2 + 0
+0efe : c5 43 __ CMP T0 + 0
+0f00 : 90 f2 __ BCC $0ef4
+0f02 : ad 69 21 LDA $2169 ; (sframe + 7)
+0f05 : f0 33 __ BEQ $0f3a
+0f07 : ad 65 21 LDA $2165 ; (sframe + 3)
+0f0a : 85 4b __ STA T7 + 0
+0f0c : ad 66 21 LDA $2166 ; (sframe + 4)
+0f0f : d0 29 __ BNE $0f3a
+0f11 : a5 4b __ LDA T7 + 0
+0f13 : c9 10 __ CMP #$10
+0f15 : d0 23 __ BNE $0f3a
+0f17 : 18 __ __ CLC
+0f18 : a5 43 __ LDA T0 + 0
+0f1a : 69 ff __ ADC #$ff
+0f1c : 18 __ __ CLC
+0f1d : 65 49 __ ADC T6 + 0
+0f1f : 85 4b __ STA T7 + 0
+0f21 : a5 4a __ LDA T6 + 1
+0f23 : 69 00 __ ADC #$00
+0f25 : 85 4c __ STA T7 + 1
+0f27 : a9 58 __ LDA #$58
+0f29 : a0 00 __ LDY #$00
+0f2b : 91 4b __ STA (T7 + 0),y
+0f2d : 18 __ __ CLC
+0f2e : a5 43 __ LDA T0 + 0
+0f30 : 69 fe __ ADC #$fe
+0f32 : 85 43 __ STA T0 + 0
+0f34 : a9 30 __ LDA #$30
+0f36 : a4 43 __ LDY T0 + 0
+0f38 : 91 49 __ STA (T6 + 0),y
+0f3a : ad 67 21 LDA $2167 ; (sframe + 5)
+0f3d : f0 08 __ BEQ $0f47
+0f3f : c6 43 __ DEC T0 + 0
+0f41 : a9 2b __ LDA #$2b
+0f43 : a4 43 __ LDY T0 + 0
+0f45 : 91 49 __ STA (T6 + 0),y
+0f47 : 38 __ __ SEC
+0f48 : a9 0a __ LDA #$0a
+0f4a : ed 63 21 SBC $2163 ; (sframe + 1)
+0f4d : 85 4b __ STA T7 + 0
+0f4f : a9 00 __ LDA #$00
+0f51 : e9 00 __ SBC #$00
+0f53 : 49 80 __ EOR #$80
+0f55 : c9 80 __ CMP #$80
+0f57 : d0 04 __ BNE $0f5d
+0f59 : a5 4b __ LDA T7 + 0
+0f5b : c5 43 __ CMP T0 + 0
+0f5d : 90 2f __ BCC $0f8e
+0f5f : a9 00 __ LDA #$00
+0f61 : 85 45 __ STA T2 + 0
+0f63 : a5 43 __ LDA T0 + 0
+0f65 : c9 0a __ CMP #$0a
+0f67 : b0 12 __ BCS $0f7b
+0f69 : a4 43 __ LDY T0 + 0
+0f6b : b1 49 __ LDA (T6 + 0),y
+0f6d : a4 45 __ LDY T2 + 0
+0f6f : 91 49 __ STA (T6 + 0),y
+0f71 : e6 45 __ INC T2 + 0
+0f73 : e6 43 __ INC T0 + 0
+0f75 : a5 43 __ LDA T0 + 0
+0f77 : c9 0a __ CMP #$0a
+0f79 : 90 ee __ BCC $0f69
+0f7b : a0 00 __ LDY #$00
+0f7d : b1 5d __ LDA (T1 + 0),y
+0f7f : 85 47 __ STA T5 + 0
+0f81 : e6 5d __ INC T1 + 0
+0f83 : d0 02 __ BNE $0f87
+0f85 : e6 5e __ INC T1 + 1
+0f87 : a5 45 __ LDA T2 + 0
+0f89 : 85 43 __ STA T0 + 0
+0f8b : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+0f8e : c6 43 __ DEC T0 + 0
+0f90 : ad 62 21 LDA $2162 ; (sframe + 0)
+0f93 : a4 43 __ LDY T0 + 0
+0f95 : 91 49 __ STA (T6 + 0),y
+0f97 : 4c 47 0f JMP $0f47 ; (sprintf + 1032)
+0f9a : a9 09 __ LDA #$09
+0f9c : 85 45 __ STA T2 + 0
+0f9e : c5 43 __ CMP T0 + 0
+0fa0 : b0 03 __ BCS $0fa5
+0fa2 : 4c f4 0e JMP $0ef4 ; (sprintf + 949)
+0fa5 : 4c 02 0f JMP $0f02 ; (sprintf + 963)
+0fa8 : a5 4b __ LDA T7 + 0
+0faa : 85 1b __ STA ACCU + 0
+0fac : a5 4c __ LDA T7 + 1
+0fae : 85 1c __ STA ACCU + 1
+0fb0 : ad 65 21 LDA $2165 ; (sframe + 3)
+0fb3 : 85 03 __ STA $03
+0fb5 : ad 66 21 LDA $2166 ; (sframe + 4)
+0fb8 : 85 04 __ STA $04
+0fba : 20 1a 1f JSR $1f1a ; (divmod + 0)
+0fbd : a5 06 __ LDA $06
+0fbf : 10 2f __ BPL $0ff0
+0fc1 : 18 __ __ CLC
+0fc2 : a5 05 __ LDA $05
+0fc4 : 69 30 __ ADC #$30
+0fc6 : c6 43 __ DEC T0 + 0
+0fc8 : a4 43 __ LDY T0 + 0
+0fca : 91 49 __ STA (T6 + 0),y
+0fcc : a5 4b __ LDA T7 + 0
+0fce : 85 1b __ STA ACCU + 0
+0fd0 : a5 4c __ LDA T7 + 1
+0fd2 : 85 1c __ STA ACCU + 1
+0fd4 : ad 65 21 LDA $2165 ; (sframe + 3)
+0fd7 : 85 03 __ STA $03
+0fd9 : ad 66 21 LDA $2166 ; (sframe + 4)
+0fdc : 85 04 __ STA $04
+0fde : 20 1a 1f JSR $1f1a ; (divmod + 0)
+0fe1 : a5 1b __ LDA ACCU + 0
+0fe3 : 85 4b __ STA T7 + 0
+0fe5 : a5 1c __ LDA ACCU + 1
+0fe7 : 85 4c __ STA T7 + 1
+0fe9 : 05 1b __ ORA ACCU + 0
+0feb : d0 bb __ BNE $0fa8
+0fed : 4c de 0e JMP $0ede ; (sprintf + 927)
+0ff0 : d0 06 __ BNE $0ff8
+0ff2 : a5 05 __ LDA $05
+0ff4 : c9 0a __ CMP #$0a
+0ff6 : 90 c9 __ BCC $0fc1
+0ff8 : 18 __ __ CLC
+0ff9 : a5 05 __ LDA $05
+0ffb : 69 37 __ ADC #$37
+0ffd : 4c c6 0f JMP $0fc6 ; (sprintf + 1159)
+1000 : a5 5f __ LDA T3 + 0
+1002 : 85 49 __ STA T6 + 0
+1004 : a5 60 __ LDA T3 + 1
+1006 : 85 4a __ STA T6 + 1
+1008 : a0 00 __ LDY #$00
+100a : b1 61 __ LDA (T4 + 0),y
+100c : 85 4b __ STA T7 + 0
+100e : c8 __ __ INY
+100f : b1 61 __ LDA (T4 + 0),y
+1011 : 85 4c __ STA T7 + 1
+1013 : 18 __ __ CLC
+1014 : a5 61 __ LDA T4 + 0
+1016 : 69 02 __ ADC #$02
+1018 : 85 61 __ STA T4 + 0
+101a : 90 02 __ BCC $101e
+101c : e6 62 __ INC T4 + 1
+101e : a9 0a __ LDA #$0a
+1020 : 85 43 __ STA T0 + 0
+1022 : a5 4b __ LDA T7 + 0
+1024 : 05 4c __ ORA T7 + 1
+1026 : f0 03 __ BEQ $102b
+1028 : 4c e8 10 JMP $10e8 ; (sprintf + 1449)
+102b : ad 64 21 LDA $2164 ; (sframe + 2)
+102e : c9 ff __ CMP #$ff
+1030 : d0 03 __ BNE $1035
+1032 : 4c da 10 JMP $10da ; (sprintf + 1435)
+1035 : 38 __ __ SEC
+1036 : a9 0a __ LDA #$0a
+1038 : ed 64 21 SBC $2164 ; (sframe + 2)
+103b : 85 45 __ STA T2 + 0
+103d : c5 43 __ CMP T0 + 0
+103f : b0 0e __ BCS $104f
+1041 : c6 43 __ DEC T0 + 0
+1043 : a9 30 __ LDA #$30
+1045 : a4 43 __ LDY T0 + 0
+1047 : 91 49 __ STA (T6 + 0),y
+1049 : a5 45 __ LDA T2 + 0
+104b : c5 43 __ CMP T0 + 0
+104d : 90 f2 __ BCC $1041
+104f : ad 69 21 LDA $2169 ; (sframe + 7)
+1052 : f0 33 __ BEQ $1087
+1054 : ad 65 21 LDA $2165 ; (sframe + 3)
+1057 : 85 4b __ STA T7 + 0
+1059 : ad 66 21 LDA $2166 ; (sframe + 4)
+105c : d0 29 __ BNE $1087
+105e : a5 4b __ LDA T7 + 0
+1060 : c9 10 __ CMP #$10
+1062 : d0 23 __ BNE $1087
+1064 : 18 __ __ CLC
+1065 : a5 43 __ LDA T0 + 0
+1067 : 69 ff __ ADC #$ff
+1069 : 18 __ __ CLC
+106a : 65 49 __ ADC T6 + 0
+106c : 85 4b __ STA T7 + 0
+106e : a5 4a __ LDA T6 + 1
+1070 : 69 00 __ ADC #$00
+1072 : 85 4c __ STA T7 + 1
+1074 : a9 58 __ LDA #$58
+1076 : a0 00 __ LDY #$00
+1078 : 91 4b __ STA (T7 + 0),y
+107a : 18 __ __ CLC
+107b : a5 43 __ LDA T0 + 0
+107d : 69 fe __ ADC #$fe
+107f : 85 43 __ STA T0 + 0
+1081 : a9 30 __ LDA #$30
+1083 : a4 43 __ LDY T0 + 0
+1085 : 91 49 __ STA (T6 + 0),y
+1087 : ad 67 21 LDA $2167 ; (sframe + 5)
+108a : f0 08 __ BEQ $1094
+108c : c6 43 __ DEC T0 + 0
+108e : a9 2b __ LDA #$2b
+1090 : a4 43 __ LDY T0 + 0
+1092 : 91 49 __ STA (T6 + 0),y
+1094 : 38 __ __ SEC
+1095 : a9 0a __ LDA #$0a
+1097 : ed 63 21 SBC $2163 ; (sframe + 1)
+109a : 85 4b __ STA T7 + 0
+109c : a9 00 __ LDA #$00
+109e : e9 00 __ SBC #$00
+10a0 : 49 80 __ EOR #$80
+10a2 : c9 80 __ CMP #$80
+10a4 : d0 04 __ BNE $10aa
+10a6 : a5 4b __ LDA T7 + 0
+10a8 : c5 43 __ CMP T0 + 0
+10aa : 90 22 __ BCC $10ce
+10ac : a9 00 __ LDA #$00
+10ae : 85 45 __ STA T2 + 0
+10b0 : a5 43 __ LDA T0 + 0
+10b2 : c9 0a __ CMP #$0a
+10b4 : 90 03 __ BCC $10b9
+10b6 : 4c 7b 0f JMP $0f7b ; (sprintf + 1084)
+10b9 : a4 43 __ LDY T0 + 0
+10bb : b1 49 __ LDA (T6 + 0),y
+10bd : a4 45 __ LDY T2 + 0
+10bf : 91 49 __ STA (T6 + 0),y
+10c1 : e6 45 __ INC T2 + 0
+10c3 : e6 43 __ INC T0 + 0
+10c5 : a5 43 __ LDA T0 + 0
+10c7 : c9 0a __ CMP #$0a
+10c9 : 90 ee __ BCC $10b9
+10cb : 4c 7b 0f JMP $0f7b ; (sprintf + 1084)
+10ce : c6 43 __ DEC T0 + 0
+10d0 : ad 62 21 LDA $2162 ; (sframe + 0)
+10d3 : a4 43 __ LDY T0 + 0
+10d5 : 91 49 __ STA (T6 + 0),y
+10d7 : 4c 94 10 JMP $1094 ; (sprintf + 1365)
+10da : a9 09 __ LDA #$09
+10dc : 85 45 __ STA T2 + 0
+10de : c5 43 __ CMP T0 + 0
+10e0 : b0 03 __ BCS $10e5
+10e2 : 4c 41 10 JMP $1041 ; (sprintf + 1282)
+10e5 : 4c 4f 10 JMP $104f ; (sprintf + 1296)
+10e8 : a5 4b __ LDA T7 + 0
+10ea : 85 1b __ STA ACCU + 0
+10ec : a5 4c __ LDA T7 + 1
+10ee : 85 1c __ STA ACCU + 1
+10f0 : ad 65 21 LDA $2165 ; (sframe + 3)
+10f3 : 85 03 __ STA $03
+10f5 : ad 66 21 LDA $2166 ; (sframe + 4)
+10f8 : 85 04 __ STA $04
+10fa : 20 1a 1f JSR $1f1a ; (divmod + 0)
+10fd : a5 06 __ LDA $06
+10ff : 10 2f __ BPL $1130
+1101 : 18 __ __ CLC
+1102 : a5 05 __ LDA $05
+1104 : 69 30 __ ADC #$30
+1106 : c6 43 __ DEC T0 + 0
+1108 : a4 43 __ LDY T0 + 0
+110a : 91 49 __ STA (T6 + 0),y
+110c : a5 4b __ LDA T7 + 0
+110e : 85 1b __ STA ACCU + 0
+1110 : a5 4c __ LDA T7 + 1
+1112 : 85 1c __ STA ACCU + 1
+1114 : ad 65 21 LDA $2165 ; (sframe + 3)
+1117 : 85 03 __ STA $03
+1119 : ad 66 21 LDA $2166 ; (sframe + 4)
+111c : 85 04 __ STA $04
+111e : 20 1a 1f JSR $1f1a ; (divmod + 0)
+1121 : a5 1b __ LDA ACCU + 0
+1123 : 85 4b __ STA T7 + 0
+1125 : a5 1c __ LDA ACCU + 1
+1127 : 85 4c __ STA T7 + 1
+1129 : 05 1b __ ORA ACCU + 0
+112b : d0 bb __ BNE $10e8
+112d : 4c 2b 10 JMP $102b ; (sprintf + 1260)
+1130 : d0 06 __ BNE $1138
+1132 : a5 05 __ LDA $05
+1134 : c9 0a __ CMP #$0a
+1136 : 90 c9 __ BCC $1101
+1138 : 18 __ __ CLC
+1139 : a5 05 __ LDA $05
+113b : 69 37 __ ADC #$37
+113d : 4c 06 11 JMP $1106 ; (sprintf + 1479)
+1140 : a5 5f __ LDA T3 + 0
+1142 : 85 49 __ STA T6 + 0
+1144 : a5 60 __ LDA T3 + 1
+1146 : 85 4a __ STA T6 + 1
+1148 : a0 00 __ LDY #$00
+114a : b1 61 __ LDA (T4 + 0),y
+114c : 85 4b __ STA T7 + 0
+114e : c8 __ __ INY
+114f : b1 61 __ LDA (T4 + 0),y
+1151 : 85 4c __ STA T7 + 1
+1153 : 18 __ __ CLC
+1154 : a5 61 __ LDA T4 + 0
+1156 : 69 02 __ ADC #$02
+1158 : 85 61 __ STA T4 + 0
+115a : 90 02 __ BCC $115e
+115c : e6 62 __ INC T4 + 1
+115e : a5 4c __ LDA T7 + 1
+1160 : 10 03 __ BPL $1165
+1162 : 4c ab 12 JMP $12ab ; (sprintf + 1900)
+1165 : a5 4b __ LDA T7 + 0
+1167 : 85 4d __ STA T8 + 0
+1169 : a5 4c __ LDA T7 + 1
+116b : 85 4e __ STA T8 + 1
+116d : a9 00 __ LDA #$00
+116f : 85 43 __ STA T0 + 0
+1171 : a9 0a __ LDA #$0a
+1173 : 85 45 __ STA T2 + 0
+1175 : a5 4b __ LDA T7 + 0
+1177 : 05 4c __ ORA T7 + 1
+1179 : f0 03 __ BEQ $117e
+117b : 4c 53 12 JMP $1253 ; (sprintf + 1812)
+117e : ad 64 21 LDA $2164 ; (sframe + 2)
+1181 : c9 ff __ CMP #$ff
+1183 : d0 03 __ BNE $1188
+1185 : 4c 45 12 JMP $1245 ; (sprintf + 1798)
+1188 : 38 __ __ SEC
+1189 : a9 0a __ LDA #$0a
+118b : ed 64 21 SBC $2164 ; (sframe + 2)
+118e : 85 47 __ STA T5 + 0
+1190 : c5 45 __ CMP T2 + 0
+1192 : b0 0e __ BCS $11a2
+1194 : c6 45 __ DEC T2 + 0
+1196 : a9 30 __ LDA #$30
+1198 : a4 45 __ LDY T2 + 0
+119a : 91 49 __ STA (T6 + 0),y
+119c : a5 47 __ LDA T5 + 0
+119e : c5 45 __ CMP T2 + 0
+11a0 : 90 f2 __ BCC $1194
+11a2 : ad 69 21 LDA $2169 ; (sframe + 7)
+11a5 : f0 33 __ BEQ $11da
+11a7 : ad 65 21 LDA $2165 ; (sframe + 3)
+11aa : 85 4b __ STA T7 + 0
+11ac : ad 66 21 LDA $2166 ; (sframe + 4)
+11af : d0 29 __ BNE $11da
+11b1 : a5 4b __ LDA T7 + 0
+11b3 : c9 10 __ CMP #$10
+11b5 : d0 23 __ BNE $11da
+11b7 : 18 __ __ CLC
+11b8 : a5 45 __ LDA T2 + 0
+11ba : 69 ff __ ADC #$ff
+11bc : 18 __ __ CLC
+11bd : 65 49 __ ADC T6 + 0
+11bf : 85 4b __ STA T7 + 0
+11c1 : a5 4a __ LDA T6 + 1
+11c3 : 69 00 __ ADC #$00
+11c5 : 85 4c __ STA T7 + 1
+11c7 : a9 58 __ LDA #$58
+11c9 : a0 00 __ LDY #$00
+11cb : 91 4b __ STA (T7 + 0),y
+11cd : 18 __ __ CLC
+11ce : a5 45 __ LDA T2 + 0
+11d0 : 69 fe __ ADC #$fe
+11d2 : 85 45 __ STA T2 + 0
+11d4 : a9 30 __ LDA #$30
+11d6 : a4 45 __ LDY T2 + 0
+11d8 : 91 49 __ STA (T6 + 0),y
+11da : a5 43 __ LDA T0 + 0
+11dc : d0 5c __ BNE $123a
+11de : ad 67 21 LDA $2167 ; (sframe + 5)
+11e1 : f0 08 __ BEQ $11eb
+11e3 : c6 45 __ DEC T2 + 0
+11e5 : a9 2b __ LDA #$2b
+11e7 : a4 45 __ LDY T2 + 0
+11e9 : 91 49 __ STA (T6 + 0),y
+11eb : 38 __ __ SEC
+11ec : a9 0a __ LDA #$0a
+11ee : ed 63 21 SBC $2163 ; (sframe + 1)
+11f1 : 85 4b __ STA T7 + 0
+11f3 : a9 00 __ LDA #$00
+11f5 : e9 00 __ SBC #$00
+11f7 : 49 80 __ EOR #$80
+11f9 : c9 80 __ CMP #$80
+11fb : d0 04 __ BNE $1201
+11fd : a5 4b __ LDA T7 + 0
+11ff : c5 45 __ CMP T2 + 0
+1201 : 90 2b __ BCC $122e
+1203 : a9 00 __ LDA #$00
+1205 : 85 43 __ STA T0 + 0
+1207 : a5 45 __ LDA T2 + 0
+1209 : c9 0a __ CMP #$0a
+120b : b0 12 __ BCS $121f
+120d : a4 45 __ LDY T2 + 0
+120f : b1 49 __ LDA (T6 + 0),y
+1211 : a4 43 __ LDY T0 + 0
+1213 : 91 49 __ STA (T6 + 0),y
+1215 : e6 43 __ INC T0 + 0
+1217 : e6 45 __ INC T2 + 0
+1219 : a5 45 __ LDA T2 + 0
+121b : c9 0a __ CMP #$0a
+121d : 90 ee __ BCC $120d
+121f : a0 00 __ LDY #$00
+1221 : b1 5d __ LDA (T1 + 0),y
+1223 : 85 47 __ STA T5 + 0
+1225 : e6 5d __ INC T1 + 0
+1227 : d0 02 __ BNE $122b
+1229 : e6 5e __ INC T1 + 1
+122b : 4c d8 0b JMP $0bd8 ; (sprintf + 153)
+122e : c6 45 __ DEC T2 + 0
+1230 : ad 62 21 LDA $2162 ; (sframe + 0)
+1233 : a4 45 __ LDY T2 + 0
+1235 : 91 49 __ STA (T6 + 0),y
+1237 : 4c eb 11 JMP $11eb ; (sprintf + 1708)
+123a : c6 45 __ DEC T2 + 0
+123c : a9 2d __ LDA #$2d
+123e : a4 45 __ LDY T2 + 0
+1240 : 91 49 __ STA (T6 + 0),y
+1242 : 4c eb 11 JMP $11eb ; (sprintf + 1708)
+1245 : a9 09 __ LDA #$09
+1247 : 85 47 __ STA T5 + 0
+1249 : c5 45 __ CMP T2 + 0
+124b : b0 03 __ BCS $1250
+124d : 4c 94 11 JMP $1194 ; (sprintf + 1621)
+1250 : 4c a2 11 JMP $11a2 ; (sprintf + 1635)
+1253 : a5 4d __ LDA T8 + 0
+1255 : 85 1b __ STA ACCU + 0
+1257 : a5 4e __ LDA T8 + 1
+1259 : 85 1c __ STA ACCU + 1
+125b : ad 65 21 LDA $2165 ; (sframe + 3)
+125e : 85 03 __ STA $03
+1260 : ad 66 21 LDA $2166 ; (sframe + 4)
+1263 : 85 04 __ STA $04
+1265 : 20 1a 1f JSR $1f1a ; (divmod + 0)
+1268 : a5 06 __ LDA $06
+126a : 10 2f __ BPL $129b
+126c : 18 __ __ CLC
+126d : a5 05 __ LDA $05
+126f : 69 30 __ ADC #$30
+1271 : c6 45 __ DEC T2 + 0
+1273 : a4 45 __ LDY T2 + 0
+1275 : 91 49 __ STA (T6 + 0),y
+1277 : a5 4d __ LDA T8 + 0
+1279 : 85 1b __ STA ACCU + 0
+127b : a5 4e __ LDA T8 + 1
+127d : 85 1c __ STA ACCU + 1
+127f : ad 65 21 LDA $2165 ; (sframe + 3)
+1282 : 85 03 __ STA $03
+1284 : ad 66 21 LDA $2166 ; (sframe + 4)
+1287 : 85 04 __ STA $04
+1289 : 20 1a 1f JSR $1f1a ; (divmod + 0)
+128c : a5 1b __ LDA ACCU + 0
+128e : 85 4d __ STA T8 + 0
+1290 : a5 1c __ LDA ACCU + 1
+1292 : 85 4e __ STA T8 + 1
+1294 : 05 1b __ ORA ACCU + 0
+1296 : d0 bb __ BNE $1253
+1298 : 4c 7e 11 JMP $117e ; (sprintf + 1599)
+129b : d0 06 __ BNE $12a3
+129d : a5 05 __ LDA $05
+129f : c9 0a __ CMP #$0a
+12a1 : 90 c9 __ BCC $126c
+12a3 : 18 __ __ CLC
+12a4 : a5 05 __ LDA $05
+12a6 : 69 37 __ ADC #$37
+12a8 : 4c 71 12 JMP $1271 ; (sprintf + 1842)
+12ab : a9 01 __ LDA #$01
+12ad : 85 43 __ STA T0 + 0
+12af : a9 0a __ LDA #$0a
+12b1 : 85 45 __ STA T2 + 0
+12b3 : 38 __ __ SEC
+12b4 : a9 00 __ LDA #$00
+12b6 : e5 4b __ SBC T7 + 0
+12b8 : 85 4d __ STA T8 + 0
+12ba : a9 00 __ LDA #$00
+12bc : e5 4c __ SBC T7 + 1
+12be : 85 4e __ STA T8 + 1
+12c0 : 05 4d __ ORA T8 + 0
+12c2 : d0 8f __ BNE $1253
+12c4 : 4c 7e 11 JMP $117e ; (sprintf + 1599)
+12c7 : a9 00 __ LDA #$00
+12c9 : 85 49 __ STA T6 + 0
+12cb : 85 4a __ STA T6 + 1
+12cd : a0 00 __ LDY #$00
+12cf : b1 5d __ LDA (T1 + 0),y
+12d1 : 85 45 __ STA T2 + 0
+12d3 : e6 5d __ INC T1 + 0
+12d5 : d0 02 __ BNE $12d9
+12d7 : e6 5e __ INC T1 + 1
+12d9 : a5 45 __ LDA T2 + 0
+12db : c9 30 __ CMP #$30
+12dd : 90 4d __ BCC $132c
+12df : a9 39 __ LDA #$39
+12e1 : c5 45 __ CMP T2 + 0
+12e3 : 90 47 __ BCC $132c
+12e5 : a5 45 __ LDA T2 + 0
+12e7 : 85 4b __ STA T7 + 0
+12e9 : a0 00 __ LDY #$00
+12eb : b1 5d __ LDA (T1 + 0),y
+12ed : 85 45 __ STA T2 + 0
+12ef : e6 5d __ INC T1 + 0
+12f1 : d0 02 __ BNE $12f5
+12f3 : e6 5e __ INC T1 + 1
+12f5 : a5 49 __ LDA T6 + 0
+12f7 : 0a __ __ ASL
+12f8 : 85 07 __ STA $07
+12fa : a5 4a __ LDA T6 + 1
+12fc : 2a __ __ ROL
+12fd : 06 07 __ ASL $07
+12ff : 2a __ __ ROL
+1300 : aa __ __ TAX
+1301 : 18 __ __ CLC
+1302 : a5 07 __ LDA $07
+1304 : 65 49 __ ADC T6 + 0
+1306 : 85 1b __ STA ACCU + 0
+1308 : 8a __ __ TXA
+1309 : 65 4a __ ADC T6 + 1
+130b : 06 1b __ ASL ACCU + 0
+130d : 2a __ __ ROL
+130e : 85 1c __ STA ACCU + 1
+1310 : 18 __ __ CLC
+1311 : a5 1b __ LDA ACCU + 0
+1313 : 65 4b __ ADC T7 + 0
+1315 : aa __ __ TAX
+1316 : a5 1c __ LDA ACCU + 1
+1318 : 69 00 __ ADC #$00
+131a : a8 __ __ TAY
+131b : 38 __ __ SEC
+131c : 8a __ __ TXA
+131d : e9 30 __ SBC #$30
+131f : 85 49 __ STA T6 + 0
+1321 : 98 __ __ TYA
+1322 : e9 00 __ SBC #$00
+1324 : 85 4a __ STA T6 + 1
+1326 : a5 45 __ LDA T2 + 0
+1328 : c9 30 __ CMP #$30
+132a : b0 b3 __ BCS $12df
+132c : a5 49 __ LDA T6 + 0
+132e : 8d 64 21 STA $2164 ; (sframe + 2)
+1331 : 4c b9 0c JMP $0cb9 ; (sprintf + 378)
+1334 : a9 01 __ LDA #$01
+1336 : 8d 69 21 STA $2169 ; (sframe + 7)
+1339 : a0 00 __ LDY #$00
+133b : b1 5d __ LDA (T1 + 0),y
+133d : 85 45 __ STA T2 + 0
+133f : 4c 2b 0c JMP $0c2b ; (sprintf + 236)
+1342 : a9 30 __ LDA #$30
+1344 : 8d 62 21 STA $2162 ; (sframe + 0)
+1347 : a0 00 __ LDY #$00
+1349 : b1 5d __ LDA (T1 + 0),y
+134b : 85 45 __ STA T2 + 0
+134d : 4c 2b 0c JMP $0c2b ; (sprintf + 236)
+1350 : a9 01 __ LDA #$01
+1352 : 8d 67 21 STA $2167 ; (sframe + 5)
+1355 : a0 00 __ LDY #$00
+1357 : b1 5d __ LDA (T1 + 0),y
+1359 : 85 45 __ STA T2 + 0
+135b : 4c 2b 0c JMP $0c2b ; (sprintf + 236)
+--------------------------------------------------------------------
+nforml:
+135e : a5 11 __ LDA P4
+1360 : 85 47 __ STA T1 + 0
+1362 : a5 12 __ LDA P5
+1364 : 85 48 __ STA T1 + 1
+1366 : a5 13 __ LDA P6
+1368 : 85 49 __ STA T1 + 2
+136a : a5 14 __ LDA P7
+136c : 85 4a __ STA T1 + 3
+136e : a9 00 __ LDA #$00
+1370 : 85 4d __ STA T3 + 0
+1372 : a5 15 __ LDA P8
+1374 : f0 03 __ BEQ $1379
+1376 : 4c 05 15 JMP $1505 ; (nforml + 423)
+1379 : a9 10 __ LDA #$10
+137b : 85 4e __ STA T4 + 0
+137d : a9 00 __ LDA #$00
+137f : c5 14 __ CMP P7
+1381 : d0 0a __ BNE $138d
+1383 : c5 13 __ CMP P6
+1385 : d0 06 __ BNE $138d
+1387 : c5 12 __ CMP P5
+1389 : d0 02 __ BNE $138d
+138b : c5 11 __ CMP P4
+138d : b0 03 __ BCS $1392
+138f : 4c 79 14 JMP $1479 ; (nforml + 283)
+1392 : a0 02 __ LDY #$02
+1394 : b1 0d __ LDA (P0),y
+1396 : 85 4f __ STA T5 + 0
+1398 : c9 ff __ CMP #$ff
+139a : d0 03 __ BNE $139f
+139c : 4c 6b 14 JMP $146b ; (nforml + 269)
+139f : 38 __ __ SEC
+13a0 : a9 10 __ LDA #$10
+13a2 : e5 4f __ SBC T5 + 0
+13a4 : 85 4f __ STA T5 + 0
+13a6 : c5 4e __ CMP T4 + 0
+13a8 : b0 0e __ BCS $13b8
+13aa : c6 4e __ DEC T4 + 0
+13ac : a9 30 __ LDA #$30
+13ae : a4 4e __ LDY T4 + 0
+13b0 : 91 0f __ STA (P2),y
+13b2 : a5 4f __ LDA T5 + 0
+13b4 : c5 4e __ CMP T4 + 0
+13b6 : 90 f2 __ BCC $13aa
+13b8 : a0 07 __ LDY #$07
+13ba : b1 0d __ LDA (P0),y
+13bc : f0 34 __ BEQ $13f2
+13be : a0 03 __ LDY #$03
+13c0 : b1 0d __ LDA (P0),y
+13c2 : 85 53 __ STA T7 + 0
+13c4 : c8 __ __ INY
+13c5 : b1 0d __ LDA (P0),y
+13c7 : d0 29 __ BNE $13f2
+13c9 : a5 53 __ LDA T7 + 0
+13cb : c9 10 __ CMP #$10
+13cd : d0 23 __ BNE $13f2
+13cf : 18 __ __ CLC
+13d0 : a5 4e __ LDA T4 + 0
+13d2 : 69 ff __ ADC #$ff
+13d4 : 18 __ __ CLC
+13d5 : 65 0f __ ADC P2
+13d7 : 85 53 __ STA T7 + 0
+13d9 : a5 10 __ LDA P3
+13db : 69 00 __ ADC #$00
+13dd : 85 54 __ STA T7 + 1
+13df : a9 58 __ LDA #$58
+13e1 : a0 00 __ LDY #$00
+13e3 : 91 53 __ STA (T7 + 0),y
+13e5 : 18 __ __ CLC
+13e6 : a5 4e __ LDA T4 + 0
+13e8 : 69 fe __ ADC #$fe
+13ea : 85 4e __ STA T4 + 0
+13ec : a9 30 __ LDA #$30
+13ee : a4 4e __ LDY T4 + 0
+13f0 : 91 0f __ STA (P2),y
+13f2 : a5 4d __ LDA T3 + 0
+13f4 : d0 6a __ BNE $1460
+13f6 : a0 05 __ LDY #$05
+13f8 : b1 0d __ LDA (P0),y
+13fa : f0 08 __ BEQ $1404
+13fc : c6 4e __ DEC T4 + 0
+13fe : a9 2b __ LDA #$2b
+1400 : a4 4e __ LDY T4 + 0
+1402 : 91 0f __ STA (P2),y
+1404 : a0 01 __ LDY #$01
+1406 : b1 0d __ LDA (P0),y
+1408 : 85 53 __ STA T7 + 0
+140a : 38 __ __ SEC
+140b : a9 10 __ LDA #$10
+140d : e5 53 __ SBC T7 + 0
+140f : 85 53 __ STA T7 + 0
+1411 : a9 00 __ LDA #$00
+1413 : e9 00 __ SBC #$00
+1415 : 49 80 __ EOR #$80
+1417 : c9 80 __ CMP #$80
+1419 : d0 04 __ BNE $141f
+141b : a5 53 __ LDA T7 + 0
+141d : c5 4e __ CMP T4 + 0
+141f : 90 32 __ BCC $1453
+1421 : a9 00 __ LDA #$00
+1423 : 85 4d __ STA T3 + 0
+1425 : a5 4e __ LDA T4 + 0
+1427 : c9 10 __ CMP #$10
+1429 : 90 09 __ BCC $1434
+142b : a5 4d __ LDA T3 + 0
+142d : 85 1b __ STA ACCU + 0
+142f : a9 00 __ LDA #$00
+1431 : 85 1c __ STA ACCU + 1
+1433 : 60 __ __ RTS
+1434 : aa __ __ TAX
+1435 : 8a __ __ TXA
+1436 : 18 __ __ CLC
+1437 : 65 0f __ ADC P2
+1439 : 85 51 __ STA T6 + 0
+143b : a5 10 __ LDA P3
+143d : 69 00 __ ADC #$00
+143f : 85 52 __ STA T6 + 1
+1441 : a0 00 __ LDY #$00
+1443 : b1 51 __ LDA (T6 + 0),y
+1445 : a4 4d __ LDY T3 + 0
+1447 : 91 0f __ STA (P2),y
+1449 : e6 4d __ INC T3 + 0
+144b : e8 __ __ INX
+144c : e0 10 __ CPX #$10
+144e : 90 e5 __ BCC $1435
+1450 : 4c 2b 14 JMP $142b ; (nforml + 205)
+1453 : c6 4e __ DEC T4 + 0
+1455 : a0 00 __ LDY #$00
+1457 : b1 0d __ LDA (P0),y
+1459 : a4 4e __ LDY T4 + 0
+145b : 91 0f __ STA (P2),y
+145d : 4c 04 14 JMP $1404 ; (nforml + 166)
+1460 : c6 4e __ DEC T4 + 0
+1462 : a9 2d __ LDA #$2d
+1464 : a4 4e __ LDY T4 + 0
+1466 : 91 0f __ STA (P2),y
+1468 : 4c 04 14 JMP $1404 ; (nforml + 166)
+146b : a9 0f __ LDA #$0f
+146d : 85 4f __ STA T5 + 0
+146f : c5 4e __ CMP T4 + 0
+1471 : b0 03 __ BCS $1476
+1473 : 4c aa 13 JMP $13aa ; (nforml + 76)
+1476 : 4c b8 13 JMP $13b8 ; (nforml + 90)
+1479 : a0 03 __ LDY #$03
+147b : b1 0d __ LDA (P0),y
+147d : 85 03 __ STA $03
+147f : c8 __ __ INY
+1480 : b1 0d __ LDA (P0),y
+1482 : 85 04 __ STA $04
+1484 : a9 00 __ LDA #$00
+1486 : 85 05 __ STA $05
+1488 : 85 06 __ STA $06
+148a : a5 47 __ LDA T1 + 0
+148c : 85 1b __ STA ACCU + 0
+148e : a5 48 __ LDA T1 + 1
+1490 : 85 1c __ STA ACCU + 1
+1492 : a5 49 __ LDA T1 + 2
+1494 : 85 1d __ STA ACCU + 2
+1496 : a5 4a __ LDA T1 + 3
+1498 : 85 1e __ STA ACCU + 3
+149a : 20 a6 20 JSR $20a6 ; (divmod32 + 0)
+149d : a5 08 __ LDA $08
+149f : 10 54 __ BPL $14f5
+14a1 : 18 __ __ CLC
+14a2 : a5 07 __ LDA $07
+14a4 : 69 30 __ ADC #$30
+14a6 : c6 4e __ DEC T4 + 0
+14a8 : a4 4e __ LDY T4 + 0
+14aa : 91 0f __ STA (P2),y
+14ac : a0 03 __ LDY #$03
+14ae : b1 0d __ LDA (P0),y
+14b0 : 85 03 __ STA $03
+14b2 : c8 __ __ INY
+14b3 : b1 0d __ LDA (P0),y
+14b5 : 85 04 __ STA $04
+14b7 : a9 00 __ LDA #$00
+14b9 : 85 05 __ STA $05
+14bb : 85 06 __ STA $06
+14bd : a5 47 __ LDA T1 + 0
+14bf : 85 1b __ STA ACCU + 0
+14c1 : a5 48 __ LDA T1 + 1
+14c3 : 85 1c __ STA ACCU + 1
+14c5 : a5 49 __ LDA T1 + 2
+14c7 : 85 1d __ STA ACCU + 2
+14c9 : a5 4a __ LDA T1 + 3
+14cb : 85 1e __ STA ACCU + 3
+14cd : 20 a6 20 JSR $20a6 ; (divmod32 + 0)
+14d0 : a5 1b __ LDA ACCU + 0
+14d2 : 85 47 __ STA T1 + 0
+14d4 : a5 1c __ LDA ACCU + 1
+14d6 : 85 48 __ STA T1 + 1
+14d8 : a5 1d __ LDA ACCU + 2
+14da : 85 49 __ STA T1 + 2
+14dc : a5 1e __ LDA ACCU + 3
+14de : 85 4a __ STA T1 + 3
+14e0 : a9 00 __ LDA #$00
+14e2 : c5 1e __ CMP ACCU + 3
+14e4 : d0 0a __ BNE $14f0
+14e6 : c5 1d __ CMP ACCU + 2
+14e8 : d0 06 __ BNE $14f0
+14ea : c5 1c __ CMP ACCU + 1
+14ec : d0 02 __ BNE $14f0
+14ee : c5 1b __ CMP ACCU + 0
+14f0 : 90 87 __ BCC $1479
+14f2 : 4c 92 13 JMP $1392 ; (nforml + 52)
+14f5 : d0 06 __ BNE $14fd
+14f7 : a5 07 __ LDA $07
+14f9 : c9 0a __ CMP #$0a
+14fb : 90 a4 __ BCC $14a1
+14fd : 18 __ __ CLC
+14fe : a5 07 __ LDA $07
+1500 : 69 37 __ ADC #$37
+1502 : 4c a6 14 JMP $14a6 ; (nforml + 328)
+1505 : a5 14 __ LDA P7
+1507 : 49 80 __ EOR #$80
+1509 : c9 80 __ CMP #$80
+150b : d0 0f __ BNE $151c
+150d : a5 13 __ LDA P6
+150f : c9 00 __ CMP #$00
+1511 : d0 09 __ BNE $151c
+1513 : a5 12 __ LDA P5
+1515 : c9 00 __ CMP #$00
+1517 : d0 03 __ BNE $151c
+1519 : 4c 79 13 JMP $1379 ; (nforml + 27)
+151c : 90 03 __ BCC $1521
+151e : 4c 79 13 JMP $1379 ; (nforml + 27)
+1521 : a9 01 __ LDA #$01
+1523 : 85 4d __ STA T3 + 0
+1525 : a9 10 __ LDA #$10
+1527 : 85 4e __ STA T4 + 0
+1529 : 38 __ __ SEC
+152a : a9 00 __ LDA #$00
+152c : e5 11 __ SBC P4
+152e : 85 47 __ STA T1 + 0
+1530 : a9 00 __ LDA #$00
+1532 : e5 12 __ SBC P5
+1534 : 85 48 __ STA T1 + 1
+1536 : a9 00 __ LDA #$00
+1538 : e5 13 __ SBC P6
+153a : 85 49 __ STA T1 + 2
+153c : a9 00 __ LDA #$00
+153e : e5 14 __ SBC P7
+1540 : 85 4a __ STA T1 + 3
+1542 : a9 00 __ LDA #$00
+1544 : c5 4a __ CMP T1 + 3
+1546 : d0 0a __ BNE $1552
+1548 : c5 49 __ CMP T1 + 2
+154a : d0 06 __ BNE $1552
+154c : c5 48 __ CMP T1 + 1
+154e : d0 02 __ BNE $1552
+1550 : c5 47 __ CMP T1 + 0
+1552 : b0 03 __ BCS $1557
+1554 : 4c 79 14 JMP $1479 ; (nforml + 283)
+1557 : 4c 92 13 JMP $1392 ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+155a : a9 00 __ LDA #$00
+155c : 85 1b __ STA ACCU + 0
+155e : 85 1c __ STA ACCU + 1
+1560 : 85 1d __ STA ACCU + 2
+1562 : 85 1e __ STA ACCU + 3
+1564 : a5 11 __ LDA P4
+1566 : 85 03 __ STA $03
+1568 : a5 12 __ LDA P5
+156a : 85 04 __ STA $04
+156c : a5 13 __ LDA P6
+156e : 85 05 __ STA $05
+1570 : a5 14 __ LDA P7
+1572 : 85 06 __ STA $06
+1574 : 20 55 20 JSR $2055 ; (fcmp + 0)
+1577 : 10 03 __ BPL $157c
+1579 : 4c 94 1b JMP $1b94 ; (nformf + 1594)
+157c : a9 00 __ LDA #$00
+157e : 85 4b __ STA T3 + 0
+1580 : a0 05 __ LDY #$05
+1582 : b1 0d __ LDA (P0),y
+1584 : f0 0a __ BEQ $1590
+1586 : a9 2b __ LDA #$2b
+1588 : a0 00 __ LDY #$00
+158a : 91 0f __ STA (P2),y
+158c : a9 01 __ LDA #$01
+158e : 85 4b __ STA T3 + 0
+1590 : a9 00 __ LDA #$00
+1592 : 85 43 __ STA T0 + 0
+1594 : 85 44 __ STA T0 + 1
+1596 : a0 02 __ LDY #$02
+1598 : b1 0d __ LDA (P0),y
+159a : 85 4e __ STA T5 + 0
+159c : c9 ff __ CMP #$ff
+159e : d0 04 __ BNE $15a4
+15a0 : a9 06 __ LDA #$06
+15a2 : 85 4e __ STA T5 + 0
+15a4 : a9 00 __ LDA #$00
+15a6 : 85 1b __ STA ACCU + 0
+15a8 : 85 1c __ STA ACCU + 1
+15aa : 85 1d __ STA ACCU + 2
+15ac : 85 1e __ STA ACCU + 3
+15ae : a5 11 __ LDA P4
+15b0 : 85 03 __ STA $03
+15b2 : a5 12 __ LDA P5
+15b4 : 85 04 __ STA $04
+15b6 : a5 13 __ LDA P6
+15b8 : 85 05 __ STA $05
+15ba : a5 14 __ LDA P7
+15bc : 85 06 __ STA $06
+15be : 20 55 20 JSR $2055 ; (fcmp + 0)
+15c1 : d0 03 __ BNE $15c6
+15c3 : 4c 4a 17 JMP $174a ; (nformf + 496)
+15c6 : a9 00 __ LDA #$00
+15c8 : 85 1b __ STA ACCU + 0
+15ca : 85 1c __ STA ACCU + 1
+15cc : a9 7a __ LDA #$7a
+15ce : 85 1d __ STA ACCU + 2
+15d0 : a9 44 __ LDA #$44
+15d2 : 85 1e __ STA ACCU + 3
+15d4 : a5 11 __ LDA P4
+15d6 : 85 03 __ STA $03
+15d8 : a5 12 __ LDA P5
+15da : 85 04 __ STA $04
+15dc : a5 13 __ LDA P6
+15de : 85 05 __ STA $05
+15e0 : a5 14 __ LDA P7
+15e2 : 85 06 __ STA $06
+15e4 : 20 55 20 JSR $2055 ; (fcmp + 0)
+15e7 : 30 5a __ BMI $1643
+15e9 : a5 11 __ LDA P4
+15eb : 85 1b __ STA ACCU + 0
+15ed : a5 12 __ LDA P5
+15ef : 85 1c __ STA ACCU + 1
+15f1 : a5 13 __ LDA P6
+15f3 : 85 1d __ STA ACCU + 2
+15f5 : a5 14 __ LDA P7
+15f7 : 85 1e __ STA ACCU + 3
+15f9 : a9 00 __ LDA #$00
+15fb : 85 03 __ STA $03
+15fd : 85 04 __ STA $04
+15ff : a9 7a __ LDA #$7a
+1601 : 85 05 __ STA $05
+1603 : a9 44 __ LDA #$44
+1605 : 85 06 __ STA $06
+1607 : 20 89 1c JSR $1c89 ; (freg + 20)
+160a : 20 20 1e JSR $1e20 ; (fdiv + 0)
+160d : a5 1b __ LDA ACCU + 0
+160f : 85 11 __ STA P4
+1611 : 85 03 __ STA $03
+1613 : a5 1c __ LDA ACCU + 1
+1615 : 85 12 __ STA P5
+1617 : 85 04 __ STA $04
+1619 : a5 1d __ LDA ACCU + 2
+161b : 85 13 __ STA P6
+161d : 85 05 __ STA $05
+161f : a5 1e __ LDA ACCU + 3
+1621 : 85 14 __ STA P7
+1623 : 85 06 __ STA $06
+1625 : 18 __ __ CLC
+1626 : a5 43 __ LDA T0 + 0
+1628 : 69 03 __ ADC #$03
+162a : 85 43 __ STA T0 + 0
+162c : 90 02 __ BCC $1630
+162e : e6 44 __ INC T0 + 1
+1630 : a9 00 __ LDA #$00
+1632 : 85 1b __ STA ACCU + 0
+1634 : 85 1c __ STA ACCU + 1
+1636 : a9 7a __ LDA #$7a
+1638 : 85 1d __ STA ACCU + 2
+163a : a9 44 __ LDA #$44
+163c : 85 1e __ STA ACCU + 3
+163e : 20 55 20 JSR $2055 ; (fcmp + 0)
+1641 : 10 a6 __ BPL $15e9
+1643 : a9 00 __ LDA #$00
+1645 : 85 1b __ STA ACCU + 0
+1647 : 85 1c __ STA ACCU + 1
+1649 : a9 80 __ LDA #$80
+164b : 85 1d __ STA ACCU + 2
+164d : a9 3f __ LDA #$3f
+164f : 85 1e __ STA ACCU + 3
+1651 : a5 11 __ LDA P4
+1653 : 85 03 __ STA $03
+1655 : a5 12 __ LDA P5
+1657 : 85 04 __ STA $04
+1659 : a5 13 __ LDA P6
+165b : 85 05 __ STA $05
+165d : a5 14 __ LDA P7
+165f : 85 06 __ STA $06
+1661 : 20 55 20 JSR $2055 ; (fcmp + 0)
+1664 : 10 5c __ BPL $16c2
+1666 : a5 11 __ LDA P4
+1668 : 85 1b __ STA ACCU + 0
+166a : a5 12 __ LDA P5
+166c : 85 1c __ STA ACCU + 1
+166e : a5 13 __ LDA P6
+1670 : 85 1d __ STA ACCU + 2
+1672 : a5 14 __ LDA P7
+1674 : 85 1e __ STA ACCU + 3
+1676 : a9 00 __ LDA #$00
+1678 : 85 03 __ STA $03
+167a : 85 04 __ STA $04
+167c : a9 7a __ LDA #$7a
+167e : 85 05 __ STA $05
+1680 : a9 44 __ LDA #$44
+1682 : 85 06 __ STA $06
+1684 : 20 89 1c JSR $1c89 ; (freg + 20)
+1687 : 20 82 1d JSR $1d82 ; (fmul + 0)
+168a : a5 1b __ LDA ACCU + 0
+168c : 85 11 __ STA P4
+168e : 85 03 __ STA $03
+1690 : a5 1c __ LDA ACCU + 1
+1692 : 85 12 __ STA P5
+1694 : 85 04 __ STA $04
+1696 : a5 1d __ LDA ACCU + 2
+1698 : 85 13 __ STA P6
+169a : 85 05 __ STA $05
+169c : a5 1e __ LDA ACCU + 3
+169e : 85 14 __ STA P7
+16a0 : 85 06 __ STA $06
+16a2 : 38 __ __ SEC
+16a3 : a5 43 __ LDA T0 + 0
+16a5 : e9 03 __ SBC #$03
+16a7 : 85 43 __ STA T0 + 0
+16a9 : a5 44 __ LDA T0 + 1
+16ab : e9 00 __ SBC #$00
+16ad : 85 44 __ STA T0 + 1
+16af : a9 00 __ LDA #$00
+16b1 : 85 1b __ STA ACCU + 0
+16b3 : 85 1c __ STA ACCU + 1
+16b5 : a9 80 __ LDA #$80
+16b7 : 85 1d __ STA ACCU + 2
+16b9 : a9 3f __ LDA #$3f
+16bb : 85 1e __ STA ACCU + 3
+16bd : 20 55 20 JSR $2055 ; (fcmp + 0)
+16c0 : 30 a4 __ BMI $1666
+16c2 : a9 00 __ LDA #$00
+16c4 : 85 1b __ STA ACCU + 0
+16c6 : 85 1c __ STA ACCU + 1
+16c8 : a9 20 __ LDA #$20
+16ca : 85 1d __ STA ACCU + 2
+16cc : a9 41 __ LDA #$41
+16ce : 85 1e __ STA ACCU + 3
+16d0 : a5 11 __ LDA P4
+16d2 : 85 03 __ STA $03
+16d4 : a5 12 __ LDA P5
+16d6 : 85 04 __ STA $04
+16d8 : a5 13 __ LDA P6
+16da : 85 05 __ STA $05
+16dc : a5 14 __ LDA P7
+16de : 85 06 __ STA $06
+16e0 : 20 55 20 JSR $2055 ; (fcmp + 0)
+16e3 : 30 65 __ BMI $174a
+16e5 : a5 11 __ LDA P4
+16e7 : 85 1b __ STA ACCU + 0
+16e9 : a5 12 __ LDA P5
+16eb : 85 1c __ STA ACCU + 1
+16ed : a5 13 __ LDA P6
+16ef : 85 1d __ STA ACCU + 2
+16f1 : a5 14 __ LDA P7
+16f3 : 85 1e __ STA ACCU + 3
+16f5 : a9 00 __ LDA #$00
+16f7 : 85 03 __ STA $03
+16f9 : 85 04 __ STA $04
+16fb : a9 20 __ LDA #$20
+16fd : 85 05 __ STA $05
+16ff : a9 41 __ LDA #$41
+1701 : 85 06 __ STA $06
+1703 : 20 89 1c JSR $1c89 ; (freg + 20)
+1706 : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1709 : a5 1b __ LDA ACCU + 0
+170b : 85 11 __ STA P4
+170d : 85 47 __ STA T2 + 0
+170f : a5 1c __ LDA ACCU + 1
+1711 : 85 12 __ STA P5
+1713 : 85 48 __ STA T2 + 1
+1715 : a5 1d __ LDA ACCU + 2
+1717 : 85 13 __ STA P6
+1719 : 85 49 __ STA T2 + 2
+171b : a5 1e __ LDA ACCU + 3
+171d : 85 14 __ STA P7
+171f : 85 4a __ STA T2 + 3
+1721 : e6 43 __ INC T0 + 0
+1723 : d0 02 __ BNE $1727
+1725 : e6 44 __ INC T0 + 1
+1727 : a9 00 __ LDA #$00
+1729 : 85 1b __ STA ACCU + 0
+172b : 85 1c __ STA ACCU + 1
+172d : a9 20 __ LDA #$20
+172f : 85 1d __ STA ACCU + 2
+1731 : a9 41 __ LDA #$41
+1733 : 85 1e __ STA ACCU + 3
+1735 : a5 47 __ LDA T2 + 0
+1737 : 85 03 __ STA $03
+1739 : a5 48 __ LDA T2 + 1
+173b : 85 04 __ STA $04
+173d : a5 49 __ LDA T2 + 2
+173f : 85 05 __ STA $05
+1741 : a5 4a __ LDA T2 + 3
+1743 : 85 06 __ STA $06
+1745 : 20 55 20 JSR $2055 ; (fcmp + 0)
+1748 : 10 9b __ BPL $16e5
+174a : a5 15 __ LDA P8
+174c : c9 65 __ CMP #$65
+174e : d0 03 __ BNE $1753
+1750 : 4c 8f 1b JMP $1b8f ; (nformf + 1589)
+1753 : a9 00 __ LDA #$00
+1755 : 85 51 __ STA T7 + 0
+1757 : 85 52 __ STA T8 + 0
+1759 : a5 4e __ LDA T5 + 0
+175b : 85 4c __ STA T4 + 0
+175d : e6 4c __ INC T4 + 0
+175f : a5 15 __ LDA P8
+1761 : c9 67 __ CMP #$67
+1763 : d0 03 __ BNE $1768
+1765 : 4c 72 1b JMP $1b72 ; (nformf + 1560)
+1768 : a5 51 __ LDA T7 + 0
+176a : f0 03 __ BEQ $176f
+176c : 4c 80 1a JMP $1a80 ; (nformf + 1318)
+176f : a5 44 __ LDA T0 + 1
+1771 : 10 03 __ BPL $1776
+1773 : 4c 3f 1a JMP $1a3f ; (nformf + 1253)
+1776 : a9 00 __ LDA #$00
+1778 : 85 47 __ STA T2 + 0
+177a : 85 48 __ STA T2 + 1
+177c : 85 49 __ STA T2 + 2
+177e : a9 3f __ LDA #$3f
+1780 : 85 4a __ STA T2 + 3
+1782 : 18 __ __ CLC
+1783 : a5 4e __ LDA T5 + 0
+1785 : 65 43 __ ADC T0 + 0
+1787 : 85 4c __ STA T4 + 0
+1789 : e6 4c __ INC T4 + 0
+178b : a9 01 __ LDA #$01
+178d : c5 4c __ CMP T4 + 0
+178f : b0 03 __ BCS $1794
+1791 : 4c fe 19 JMP $19fe ; (nformf + 1188)
+1794 : a5 11 __ LDA P4
+1796 : 85 1b __ STA ACCU + 0
+1798 : a5 12 __ LDA P5
+179a : 85 1c __ STA ACCU + 1
+179c : a5 13 __ LDA P6
+179e : 85 1d __ STA ACCU + 2
+17a0 : a5 14 __ LDA P7
+17a2 : 85 1e __ STA ACCU + 3
+17a4 : a5 47 __ LDA T2 + 0
+17a6 : 85 03 __ STA $03
+17a8 : a5 48 __ LDA T2 + 1
+17aa : 85 04 __ STA $04
+17ac : a5 49 __ LDA T2 + 2
+17ae : 85 05 __ STA $05
+17b0 : a5 4a __ LDA T2 + 3
+17b2 : 85 06 __ STA $06
+17b4 : 20 89 1c JSR $1c89 ; (freg + 20)
+17b7 : 20 ba 1c JSR $1cba ; (faddsub + 0)
+17ba : a5 1b __ LDA ACCU + 0
+17bc : 85 11 __ STA P4
+17be : 85 47 __ STA T2 + 0
+17c0 : 85 03 __ STA $03
+17c2 : a5 1c __ LDA ACCU + 1
+17c4 : 85 12 __ STA P5
+17c6 : 85 48 __ STA T2 + 1
+17c8 : 85 04 __ STA $04
+17ca : a5 1d __ LDA ACCU + 2
+17cc : 85 13 __ STA P6
+17ce : 85 49 __ STA T2 + 2
+17d0 : 85 05 __ STA $05
+17d2 : a5 1e __ LDA ACCU + 3
+17d4 : 85 14 __ STA P7
+17d6 : 85 4a __ STA T2 + 3
+17d8 : 85 06 __ STA $06
+17da : a9 00 __ LDA #$00
+17dc : 85 1b __ STA ACCU + 0
+17de : 85 1c __ STA ACCU + 1
+17e0 : a9 20 __ LDA #$20
+17e2 : 85 1d __ STA ACCU + 2
+17e4 : a9 41 __ LDA #$41
+17e6 : 85 1e __ STA ACCU + 3
+17e8 : 20 55 20 JSR $2055 ; (fcmp + 0)
+17eb : 30 36 __ BMI $1823
+17ed : a5 47 __ LDA T2 + 0
+17ef : 85 1b __ STA ACCU + 0
+17f1 : a5 48 __ LDA T2 + 1
+17f3 : 85 1c __ STA ACCU + 1
+17f5 : a5 49 __ LDA T2 + 2
+17f7 : 85 1d __ STA ACCU + 2
+17f9 : a5 4a __ LDA T2 + 3
+17fb : 85 1e __ STA ACCU + 3
+17fd : a9 00 __ LDA #$00
+17ff : 85 03 __ STA $03
+1801 : 85 04 __ STA $04
+1803 : a9 20 __ LDA #$20
+1805 : 85 05 __ STA $05
+1807 : a9 41 __ LDA #$41
+1809 : 85 06 __ STA $06
+180b : 20 89 1c JSR $1c89 ; (freg + 20)
+180e : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1811 : a5 1b __ LDA ACCU + 0
+1813 : 85 11 __ STA P4
+1815 : a5 1c __ LDA ACCU + 1
+1817 : 85 12 __ STA P5
+1819 : a5 1d __ LDA ACCU + 2
+181b : 85 13 __ STA P6
+181d : a5 1e __ LDA ACCU + 3
+181f : 85 14 __ STA P7
+1821 : c6 4e __ DEC T5 + 0
+1823 : 38 __ __ SEC
+1824 : a5 4c __ LDA T4 + 0
+1826 : e5 4e __ SBC T5 + 0
+1828 : 85 53 __ STA T10 + 0
+182a : 85 4e __ STA T5 + 0
+182c : a9 14 __ LDA #$14
+182e : c5 4c __ CMP T4 + 0
+1830 : b0 02 __ BCS $1834
+1832 : 85 4c __ STA T4 + 0
+1834 : a5 53 __ LDA T10 + 0
+1836 : d0 08 __ BNE $1840
+1838 : a9 30 __ LDA #$30
+183a : a4 4b __ LDY T3 + 0
+183c : 91 0f __ STA (P2),y
+183e : e6 4b __ INC T3 + 0
+1840 : a9 00 __ LDA #$00
+1842 : 85 50 __ STA T6 + 0
+1844 : a5 4c __ LDA T4 + 0
+1846 : f0 03 __ BEQ $184b
+1848 : 4c 6d 19 JMP $196d ; (nformf + 1043)
+184b : a5 52 __ LDA T8 + 0
+184d : f0 03 __ BEQ $1852
+184f : 4c ed 18 JMP $18ed ; (nformf + 915)
+1852 : a5 4b __ LDA T3 + 0
+1854 : a0 01 __ LDY #$01
+1856 : d1 0d __ CMP (P0),y
+1858 : 90 07 __ BCC $1861
+185a : 85 1b __ STA ACCU + 0
+185c : a9 00 __ LDA #$00
+185e : 85 1c __ STA ACCU + 1
+1860 : 60 __ __ RTS
+1861 : c9 01 __ CMP #$01
+1863 : 90 53 __ BCC $18b8
+1865 : a9 01 __ LDA #$01
+1867 : 85 4e __ STA T5 + 0
+1869 : a5 0d __ LDA P0
+186b : 85 43 __ STA T0 + 0
+186d : a5 0e __ LDA P1
+186f : 85 44 __ STA T0 + 1
+1871 : a5 4b __ LDA T3 + 0
+1873 : 85 4c __ STA T4 + 0
+1875 : 38 __ __ SEC
+1876 : a5 4c __ LDA T4 + 0
+1878 : e5 4e __ SBC T5 + 0
+187a : 85 55 __ STA T11 + 0
+187c : a9 00 __ LDA #$00
+187e : e9 00 __ SBC #$00
+1880 : 85 56 __ STA T11 + 1
+1882 : 18 __ __ CLC
+1883 : a5 0f __ LDA P2
+1885 : 65 55 __ ADC T11 + 0
+1887 : 85 55 __ STA T11 + 0
+1889 : a5 10 __ LDA P3
+188b : 65 56 __ ADC T11 + 1
+188d : 85 56 __ STA T11 + 1
+188f : a0 01 __ LDY #$01
+1891 : b1 43 __ LDA (T0 + 0),y
+1893 : 38 __ __ SEC
+1894 : e5 4e __ SBC T5 + 0
+1896 : 85 53 __ STA T10 + 0
+1898 : a9 00 __ LDA #$00
+189a : e9 00 __ SBC #$00
+189c : 85 54 __ STA T10 + 1
+189e : 18 __ __ CLC
+189f : a5 0f __ LDA P2
+18a1 : 65 53 __ ADC T10 + 0
+18a3 : 85 53 __ STA T10 + 0
+18a5 : a5 10 __ LDA P3
+18a7 : 65 54 __ ADC T10 + 1
+18a9 : 85 54 __ STA T10 + 1
+18ab : 88 __ __ DEY
+18ac : b1 55 __ LDA (T11 + 0),y
+18ae : 91 53 __ STA (T10 + 0),y
+18b0 : e6 4e __ INC T5 + 0
+18b2 : a5 4b __ LDA T3 + 0
+18b4 : c5 4e __ CMP T5 + 0
+18b6 : b0 bd __ BCS $1875
+18b8 : a9 00 __ LDA #$00
+18ba : 85 4e __ STA T5 + 0
+18bc : a5 4b __ LDA T3 + 0
+18be : 85 43 __ STA T0 + 0
+18c0 : a0 01 __ LDY #$01
+18c2 : b1 0d __ LDA (P0),y
+18c4 : 85 4b __ STA T3 + 0
+18c6 : 38 __ __ SEC
+18c7 : e5 43 __ SBC T0 + 0
+18c9 : 85 53 __ STA T10 + 0
+18cb : a9 00 __ LDA #$00
+18cd : e9 00 __ SBC #$00
+18cf : 85 54 __ STA T10 + 1
+18d1 : a9 00 __ LDA #$00
+18d3 : c5 54 __ CMP T10 + 1
+18d5 : d0 04 __ BNE $18db
+18d7 : a5 4e __ LDA T5 + 0
+18d9 : c5 53 __ CMP T10 + 0
+18db : 90 05 __ BCC $18e2
+18dd : a5 4b __ LDA T3 + 0
+18df : 4c 5a 18 JMP $185a ; (nformf + 768)
+18e2 : a9 20 __ LDA #$20
+18e4 : a4 4e __ LDY T5 + 0
+18e6 : 91 0f __ STA (P2),y
+18e8 : e6 4e __ INC T5 + 0
+18ea : 4c c0 18 JMP $18c0 ; (nformf + 870)
+18ed : a9 45 __ LDA #$45
+18ef : a4 4b __ LDY T3 + 0
+18f1 : 91 0f __ STA (P2),y
+18f3 : c8 __ __ INY
+18f4 : a5 44 __ LDA T0 + 1
+18f6 : 30 5a __ BMI $1952
+18f8 : a9 2b __ LDA #$2b
+18fa : 91 0f __ STA (P2),y
+18fc : 18 __ __ CLC
+18fd : a5 4b __ LDA T3 + 0
+18ff : 69 02 __ ADC #$02
+1901 : 85 4b __ STA T3 + 0
+1903 : a5 43 __ LDA T0 + 0
+1905 : 85 1b __ STA ACCU + 0
+1907 : a5 44 __ LDA T0 + 1
+1909 : 85 1c __ STA ACCU + 1
+190b : a9 0a __ LDA #$0a
+190d : 85 03 __ STA $03
+190f : a9 00 __ LDA #$00
+1911 : 85 04 __ STA $04
+1913 : 20 e0 1e JSR $1ee0 ; (divs16 + 0)
+1916 : 18 __ __ CLC
+1917 : a5 1b __ LDA ACCU + 0
+1919 : 69 30 __ ADC #$30
+191b : a4 4b __ LDY T3 + 0
+191d : 91 0f __ STA (P2),y
+191f : c8 __ __ INY
+1920 : 98 __ __ TYA
+1921 : 18 __ __ CLC
+1922 : 65 0f __ ADC P2
+1924 : 85 4c __ STA T4 + 0
+1926 : a5 10 __ LDA P3
+1928 : 69 00 __ ADC #$00
+192a : 85 4d __ STA T4 + 1
+192c : a5 43 __ LDA T0 + 0
+192e : 85 1b __ STA ACCU + 0
+1930 : a5 44 __ LDA T0 + 1
+1932 : 85 1c __ STA ACCU + 1
+1934 : a9 0a __ LDA #$0a
+1936 : 85 03 __ STA $03
+1938 : a9 00 __ LDA #$00
+193a : 85 04 __ STA $04
+193c : 20 9f 1f JSR $1f9f ; (mods16 + 0)
+193f : 18 __ __ CLC
+1940 : a5 05 __ LDA $05
+1942 : 69 30 __ ADC #$30
+1944 : a0 00 __ LDY #$00
+1946 : 91 4c __ STA (T4 + 0),y
+1948 : 18 __ __ CLC
+1949 : a5 4b __ LDA T3 + 0
+194b : 69 02 __ ADC #$02
+194d : 85 4b __ STA T3 + 0
+194f : 4c 52 18 JMP $1852 ; (nformf + 760)
+1952 : a9 2d __ LDA #$2d
+1954 : 91 0f __ STA (P2),y
+1956 : 18 __ __ CLC
+1957 : a5 4b __ LDA T3 + 0
+1959 : 69 02 __ ADC #$02
+195b : 85 4b __ STA T3 + 0
+195d : 38 __ __ SEC
+195e : a9 00 __ LDA #$00
+1960 : e5 43 __ SBC T0 + 0
+1962 : 85 43 __ STA T0 + 0
+1964 : a9 00 __ LDA #$00
+1966 : e5 44 __ SBC T0 + 1
+1968 : 85 44 __ STA T0 + 1
+196a : 4c 03 19 JMP $1903 ; (nformf + 937)
+196d : a5 50 __ LDA T6 + 0
+196f : c5 4e __ CMP T5 + 0
+1971 : d0 08 __ BNE $197b
+1973 : a9 2e __ LDA #$2e
+1975 : a4 4b __ LDY T3 + 0
+1977 : 91 0f __ STA (P2),y
+1979 : e6 4b __ INC T3 + 0
+197b : a5 11 __ LDA P4
+197d : 85 1b __ STA ACCU + 0
+197f : a5 12 __ LDA P5
+1981 : 85 1c __ STA ACCU + 1
+1983 : a5 13 __ LDA P6
+1985 : 85 1d __ STA ACCU + 2
+1987 : a5 14 __ LDA P7
+1989 : 85 1e __ STA ACCU + 3
+198b : 20 c8 1f JSR $1fc8 ; (f32_to_i16 + 0)
+198e : a5 1b __ LDA ACCU + 0
+1990 : 85 53 __ STA T10 + 0
+1992 : 20 0a 20 JSR $200a ; (sint16_to_float + 0)
+1995 : a5 1b __ LDA ACCU + 0
+1997 : 85 03 __ STA $03
+1999 : a5 1c __ LDA ACCU + 1
+199b : 85 04 __ STA $04
+199d : a5 1d __ LDA ACCU + 2
+199f : 85 05 __ STA $05
+19a1 : a5 1e __ LDA ACCU + 3
+19a3 : 85 06 __ STA $06
+19a5 : a5 11 __ LDA P4
+19a7 : 85 1b __ STA ACCU + 0
+19a9 : a5 12 __ LDA P5
+19ab : 85 1c __ STA ACCU + 1
+19ad : a5 13 __ LDA P6
+19af : 85 1d __ STA ACCU + 2
+19b1 : a5 14 __ LDA P7
+19b3 : 85 1e __ STA ACCU + 3
+19b5 : 20 89 1c JSR $1c89 ; (freg + 20)
+19b8 : a5 06 __ LDA $06
+19ba : 49 80 __ EOR #$80
+19bc : 85 06 __ STA $06
+19be : 20 ba 1c JSR $1cba ; (faddsub + 0)
+19c1 : a9 00 __ LDA #$00
+19c3 : 85 03 __ STA $03
+19c5 : 85 04 __ STA $04
+19c7 : a9 20 __ LDA #$20
+19c9 : 85 05 __ STA $05
+19cb : a9 41 __ LDA #$41
+19cd : 85 06 __ STA $06
+19cf : 20 89 1c JSR $1c89 ; (freg + 20)
+19d2 : 20 82 1d JSR $1d82 ; (fmul + 0)
+19d5 : a5 1b __ LDA ACCU + 0
+19d7 : 85 11 __ STA P4
+19d9 : a5 1c __ LDA ACCU + 1
+19db : 85 12 __ STA P5
+19dd : a5 1d __ LDA ACCU + 2
+19df : 85 13 __ STA P6
+19e1 : a5 1e __ LDA ACCU + 3
+19e3 : 85 14 __ STA P7
+19e5 : 18 __ __ CLC
+19e6 : a5 53 __ LDA T10 + 0
+19e8 : 69 30 __ ADC #$30
+19ea : a4 4b __ LDY T3 + 0
+19ec : 91 0f __ STA (P2),y
+19ee : e6 4b __ INC T3 + 0
+19f0 : e6 50 __ INC T6 + 0
+19f2 : a5 50 __ LDA T6 + 0
+19f4 : c5 4c __ CMP T4 + 0
+19f6 : b0 03 __ BCS $19fb
+19f8 : 4c 6d 19 JMP $196d ; (nformf + 1043)
+19fb : 4c 4b 18 JMP $184b ; (nformf + 753)
+19fe : 85 50 __ STA T6 + 0
+1a00 : a5 47 __ LDA T2 + 0
+1a02 : 85 1b __ STA ACCU + 0
+1a04 : a5 48 __ LDA T2 + 1
+1a06 : 85 1c __ STA ACCU + 1
+1a08 : a5 49 __ LDA T2 + 2
+1a0a : 85 1d __ STA ACCU + 2
+1a0c : a5 4a __ LDA T2 + 3
+1a0e : 85 1e __ STA ACCU + 3
+1a10 : a9 00 __ LDA #$00
+1a12 : 85 03 __ STA $03
+1a14 : 85 04 __ STA $04
+1a16 : a9 20 __ LDA #$20
+1a18 : 85 05 __ STA $05
+1a1a : a9 41 __ LDA #$41
+1a1c : 85 06 __ STA $06
+1a1e : 20 89 1c JSR $1c89 ; (freg + 20)
+1a21 : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1a24 : a5 1b __ LDA ACCU + 0
+1a26 : 85 47 __ STA T2 + 0
+1a28 : a5 1c __ LDA ACCU + 1
+1a2a : 85 48 __ STA T2 + 1
+1a2c : a5 1d __ LDA ACCU + 2
+1a2e : 85 49 __ STA T2 + 2
+1a30 : a5 1e __ LDA ACCU + 3
+1a32 : 85 4a __ STA T2 + 3
+1a34 : e6 50 __ INC T6 + 0
+1a36 : a5 50 __ LDA T6 + 0
+1a38 : c5 4c __ CMP T4 + 0
+1a3a : 90 c4 __ BCC $1a00
+1a3c : 4c 94 17 JMP $1794 ; (nformf + 570)
+1a3f : a5 11 __ LDA P4
+1a41 : 85 1b __ STA ACCU + 0
+1a43 : a5 12 __ LDA P5
+1a45 : 85 1c __ STA ACCU + 1
+1a47 : a5 13 __ LDA P6
+1a49 : 85 1d __ STA ACCU + 2
+1a4b : a5 14 __ LDA P7
+1a4d : 85 1e __ STA ACCU + 3
+1a4f : a9 00 __ LDA #$00
+1a51 : 85 03 __ STA $03
+1a53 : 85 04 __ STA $04
+1a55 : a9 20 __ LDA #$20
+1a57 : 85 05 __ STA $05
+1a59 : a9 41 __ LDA #$41
+1a5b : 85 06 __ STA $06
+1a5d : 20 89 1c JSR $1c89 ; (freg + 20)
+1a60 : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1a63 : a5 1b __ LDA ACCU + 0
+1a65 : 85 11 __ STA P4
+1a67 : a5 1c __ LDA ACCU + 1
+1a69 : 85 12 __ STA P5
+1a6b : a5 1d __ LDA ACCU + 2
+1a6d : 85 13 __ STA P6
+1a6f : a5 1e __ LDA ACCU + 3
+1a71 : 85 14 __ STA P7
+1a73 : e6 43 __ INC T0 + 0
+1a75 : d0 02 __ BNE $1a79
+1a77 : e6 44 __ INC T0 + 1
+1a79 : a5 44 __ LDA T0 + 1
+1a7b : 30 c2 __ BMI $1a3f
+1a7d : 4c 76 17 JMP $1776 ; (nformf + 540)
+1a80 : a9 00 __ LDA #$00
+1a82 : 85 47 __ STA T2 + 0
+1a84 : 85 48 __ STA T2 + 1
+1a86 : 85 49 __ STA T2 + 2
+1a88 : a9 3f __ LDA #$3f
+1a8a : 85 4a __ STA T2 + 3
+1a8c : a5 4e __ LDA T5 + 0
+1a8e : f0 03 __ BEQ $1a93
+1a90 : 4c 2f 1b JMP $1b2f ; (nformf + 1493)
+1a93 : a5 11 __ LDA P4
+1a95 : 85 1b __ STA ACCU + 0
+1a97 : a5 12 __ LDA P5
+1a99 : 85 1c __ STA ACCU + 1
+1a9b : a5 13 __ LDA P6
+1a9d : 85 1d __ STA ACCU + 2
+1a9f : a5 14 __ LDA P7
+1aa1 : 85 1e __ STA ACCU + 3
+1aa3 : a5 47 __ LDA T2 + 0
+1aa5 : 85 03 __ STA $03
+1aa7 : a5 48 __ LDA T2 + 1
+1aa9 : 85 04 __ STA $04
+1aab : a5 49 __ LDA T2 + 2
+1aad : 85 05 __ STA $05
+1aaf : a5 4a __ LDA T2 + 3
+1ab1 : 85 06 __ STA $06
+1ab3 : 20 89 1c JSR $1c89 ; (freg + 20)
+1ab6 : 20 ba 1c JSR $1cba ; (faddsub + 0)
+1ab9 : a5 1b __ LDA ACCU + 0
+1abb : 85 11 __ STA P4
+1abd : 85 47 __ STA T2 + 0
+1abf : 85 03 __ STA $03
+1ac1 : a5 1c __ LDA ACCU + 1
+1ac3 : 85 12 __ STA P5
+1ac5 : 85 48 __ STA T2 + 1
+1ac7 : 85 04 __ STA $04
+1ac9 : a5 1d __ LDA ACCU + 2
+1acb : 85 13 __ STA P6
+1acd : 85 49 __ STA T2 + 2
+1acf : 85 05 __ STA $05
+1ad1 : a5 1e __ LDA ACCU + 3
+1ad3 : 85 14 __ STA P7
+1ad5 : 85 4a __ STA T2 + 3
+1ad7 : 85 06 __ STA $06
+1ad9 : a9 00 __ LDA #$00
+1adb : 85 1b __ STA ACCU + 0
+1add : 85 1c __ STA ACCU + 1
+1adf : a9 20 __ LDA #$20
+1ae1 : 85 1d __ STA ACCU + 2
+1ae3 : a9 41 __ LDA #$41
+1ae5 : 85 1e __ STA ACCU + 3
+1ae7 : 20 55 20 JSR $2055 ; (fcmp + 0)
+1aea : 10 03 __ BPL $1aef
+1aec : 4c 23 18 JMP $1823 ; (nformf + 713)
+1aef : a5 47 __ LDA T2 + 0
+1af1 : 85 1b __ STA ACCU + 0
+1af3 : a5 48 __ LDA T2 + 1
+1af5 : 85 1c __ STA ACCU + 1
+1af7 : a5 49 __ LDA T2 + 2
+1af9 : 85 1d __ STA ACCU + 2
+1afb : a5 4a __ LDA T2 + 3
+1afd : 85 1e __ STA ACCU + 3
+1aff : a9 00 __ LDA #$00
+1b01 : 85 03 __ STA $03
+1b03 : 85 04 __ STA $04
+1b05 : a9 20 __ LDA #$20
+1b07 : 85 05 __ STA $05
+1b09 : a9 41 __ LDA #$41
+1b0b : 85 06 __ STA $06
+1b0d : 20 89 1c JSR $1c89 ; (freg + 20)
+1b10 : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1b13 : a5 1b __ LDA ACCU + 0
+1b15 : 85 11 __ STA P4
+1b17 : a5 1c __ LDA ACCU + 1
+1b19 : 85 12 __ STA P5
+1b1b : a5 1d __ LDA ACCU + 2
+1b1d : 85 13 __ STA P6
+1b1f : a5 1e __ LDA ACCU + 3
+1b21 : 85 14 __ STA P7
+1b23 : e6 43 __ INC T0 + 0
+1b25 : f0 03 __ BEQ $1b2a
+1b27 : 4c 23 18 JMP $1823 ; (nformf + 713)
+1b2a : e6 44 __ INC T0 + 1
+1b2c : 4c 23 18 JMP $1823 ; (nformf + 713)
+1b2f : a9 00 __ LDA #$00
+1b31 : 85 50 __ STA T6 + 0
+1b33 : a5 47 __ LDA T2 + 0
+1b35 : 85 1b __ STA ACCU + 0
+1b37 : a5 48 __ LDA T2 + 1
+1b39 : 85 1c __ STA ACCU + 1
+1b3b : a5 49 __ LDA T2 + 2
+1b3d : 85 1d __ STA ACCU + 2
+1b3f : a5 4a __ LDA T2 + 3
+1b41 : 85 1e __ STA ACCU + 3
+1b43 : a9 00 __ LDA #$00
+1b45 : 85 03 __ STA $03
+1b47 : 85 04 __ STA $04
+1b49 : a9 20 __ LDA #$20
+1b4b : 85 05 __ STA $05
+1b4d : a9 41 __ LDA #$41
+1b4f : 85 06 __ STA $06
+1b51 : 20 89 1c JSR $1c89 ; (freg + 20)
+1b54 : 20 20 1e JSR $1e20 ; (fdiv + 0)
+1b57 : a5 1b __ LDA ACCU + 0
+1b59 : 85 47 __ STA T2 + 0
+1b5b : a5 1c __ LDA ACCU + 1
+1b5d : 85 48 __ STA T2 + 1
+1b5f : a5 1d __ LDA ACCU + 2
+1b61 : 85 49 __ STA T2 + 2
+1b63 : a5 1e __ LDA ACCU + 3
+1b65 : 85 4a __ STA T2 + 3
+1b67 : e6 50 __ INC T6 + 0
+1b69 : a5 50 __ LDA T6 + 0
+1b6b : c5 4e __ CMP T5 + 0
+1b6d : 90 c4 __ BCC $1b33
+1b6f : 4c 93 1a JMP $1a93 ; (nformf + 1337)
+1b72 : a5 44 __ LDA T0 + 1
+1b74 : 10 0e __ BPL $1b84
+1b76 : a5 44 __ LDA T0 + 1
+1b78 : 30 03 __ BMI $1b7d
+1b7a : 4c 68 17 JMP $1768 ; (nformf + 526)
+1b7d : a9 01 __ LDA #$01
+1b7f : 85 52 __ STA T8 + 0
+1b81 : 4c 80 1a JMP $1a80 ; (nformf + 1318)
+1b84 : d0 f7 __ BNE $1b7d
+1b86 : a9 03 __ LDA #$03
+1b88 : c5 43 __ CMP T0 + 0
+1b8a : 90 f1 __ BCC $1b7d
+1b8c : 4c 76 1b JMP $1b76 ; (nformf + 1564)
+1b8f : a9 01 __ LDA #$01
+1b91 : 4c 55 17 JMP $1755 ; (nformf + 507)
+1b94 : a5 14 __ LDA P7
+1b96 : 49 80 __ EOR #$80
+1b98 : 85 14 __ STA P7
+1b9a : a9 2d __ LDA #$2d
+1b9c : a0 00 __ LDY #$00
+1b9e : 91 0f __ STA (P2),y
+1ba0 : a9 01 __ LDA #$01
+1ba2 : 85 4b __ STA T3 + 0
+1ba4 : 4c 90 15 JMP $1590 ; (nformf + 54)
+--------------------------------------------------------------------
+strlen:
+1bc0 : a9 00 __ LDA #$00
+1bc2 : 85 43 __ STA T0 + 0
+1bc4 : 85 44 __ STA T0 + 1
+1bc6 : a0 00 __ LDY #$00
+1bc8 : b1 0d __ LDA (P0),y
+1bca : d0 09 __ BNE $1bd5
+1bcc : a5 43 __ LDA T0 + 0
+1bce : 85 1b __ STA ACCU + 0
+1bd0 : a5 44 __ LDA T0 + 1
+1bd2 : 85 1c __ STA ACCU + 1
+1bd4 : 60 __ __ RTS
+1bd5 : 18 __ __ CLC
+1bd6 : a5 0d __ LDA P0
+1bd8 : 65 43 __ ADC T0 + 0
+1bda : 85 48 __ STA T3 + 0
+1bdc : a5 0e __ LDA P1
+1bde : 65 44 __ ADC T0 + 1
+1be0 : 85 49 __ STA T3 + 1
+1be2 : e6 43 __ INC T0 + 0
+1be4 : d0 02 __ BNE $1be8
+1be6 : e6 44 __ INC T0 + 1
+1be8 : a0 01 __ LDY #$01
+1bea : b1 48 __ LDA (T3 + 0),y
+1bec : d0 e7 __ BNE $1bd5
+1bee : 4c cc 1b JMP $1bcc ; (strlen + 12)
+--------------------------------------------------------------------
+strcmp:
+1c07 : a0 00 __ LDY #$00
+1c09 : 84 1c __ STY ACCU + 1
+1c0b : b1 0d __ LDA (P0),y
+1c0d : f0 16 __ BEQ $1c25
+1c0f : d1 0f __ CMP (P2),y
+1c11 : d0 16 __ BNE $1c29
+1c13 : c8 __ __ INY
+1c14 : b1 0d __ LDA (P0),y
+1c16 : f0 0d __ BEQ $1c25
+1c18 : d1 0f __ CMP (P2),y
+1c1a : d0 0d __ BNE $1c29
+1c1c : c8 __ __ INY
+1c1d : d0 ec __ BNE $1c0b
+1c1f : e6 0e __ INC P1
+1c21 : e6 10 __ INC P3
+1c23 : d0 e6 __ BNE $1c0b
+1c25 : d1 0f __ CMP (P2),y
+1c27 : f0 0a __ BEQ $1c33
+1c29 : b0 06 __ BCS $1c31
+1c2b : a9 ff __ LDA #$ff
+1c2d : 85 1c __ STA ACCU + 1
+1c2f : 30 02 __ BMI $1c33
+1c31 : a9 01 __ LDA #$01
+1c33 : 85 1b __ STA ACCU + 0
+1c35 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c44 : a9 4c __ LDA #$4c
+1c46 : 85 54 __ STA $54
+1c48 : a9 00 __ LDA #$00
+1c4a : 85 13 __ STA P6
+1c4c : a9 19 __ LDA #$19
+1c4e : 85 16 __ STA P9
+1c50 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+1c51 : a9 00 __ LDA #$00
+1c53 : 85 05 __ STA $05
+1c55 : 85 06 __ STA $06
+1c57 : a5 03 __ LDA $03
+1c59 : 4a __ __ LSR
+1c5a : 90 0f __ BCC $1c6b
+1c5c : aa __ __ TAX
+1c5d : 18 __ __ CLC
+1c5e : a5 05 __ LDA $05
+1c60 : 65 1b __ ADC ACCU + 0
+1c62 : 85 05 __ STA $05
+1c64 : a5 06 __ LDA $06
+1c66 : 65 1c __ ADC ACCU + 1
+1c68 : 85 06 __ STA $06
+1c6a : 8a __ __ TXA
+1c6b : 06 1b __ ASL ACCU + 0
+1c6d : 26 1c __ ROL ACCU + 1
+1c6f : 4a __ __ LSR
+1c70 : b0 ea __ BCS $1c5c
+1c72 : d0 f7 __ BNE $1c6b
+1c74 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1c75 : b1 19 __ LDA (IP + 0),y
+1c77 : c8 __ __ INY
+1c78 : aa __ __ TAX
+1c79 : b5 00 __ LDA $00,x
+1c7b : 85 03 __ STA $03
+1c7d : b5 01 __ LDA $01,x
+1c7f : 85 04 __ STA $04
+1c81 : b5 02 __ LDA $02,x
+1c83 : 85 05 __ STA $05
+1c85 : b5 03 __ LDA $03,x
+1c87 : 85 06 __ STA $06
+1c89 : a5 05 __ LDA $05
+1c8b : 0a __ __ ASL
+1c8c : a5 06 __ LDA $06
+1c8e : 2a __ __ ROL
+1c8f : 85 08 __ STA $08
+1c91 : f0 06 __ BEQ $1c99
+1c93 : a5 05 __ LDA $05
+1c95 : 09 80 __ ORA #$80
+1c97 : 85 05 __ STA $05
+1c99 : a5 1d __ LDA ACCU + 2
+1c9b : 0a __ __ ASL
+1c9c : a5 1e __ LDA ACCU + 3
+1c9e : 2a __ __ ROL
+1c9f : 85 07 __ STA $07
+1ca1 : f0 06 __ BEQ $1ca9
+1ca3 : a5 1d __ LDA ACCU + 2
+1ca5 : 09 80 __ ORA #$80
+1ca7 : 85 1d __ STA ACCU + 2
+1ca9 : 60 __ __ RTS
+1caa : 06 1e __ ASL ACCU + 3
+1cac : a5 07 __ LDA $07
+1cae : 6a __ __ ROR
+1caf : 85 1e __ STA ACCU + 3
+1cb1 : b0 06 __ BCS $1cb9
+1cb3 : a5 1d __ LDA ACCU + 2
+1cb5 : 29 7f __ AND #$7f
+1cb7 : 85 1d __ STA ACCU + 2
+1cb9 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1cba : 38 __ __ SEC
+1cbb : a5 07 __ LDA $07
+1cbd : e5 08 __ SBC $08
+1cbf : f0 38 __ BEQ $1cf9
+1cc1 : aa __ __ TAX
+1cc2 : b0 25 __ BCS $1ce9
+1cc4 : e0 e9 __ CPX #$e9
+1cc6 : b0 0e __ BCS $1cd6
+1cc8 : a5 08 __ LDA $08
+1cca : 85 07 __ STA $07
+1ccc : a9 00 __ LDA #$00
+1cce : 85 1b __ STA ACCU + 0
+1cd0 : 85 1c __ STA ACCU + 1
+1cd2 : 85 1d __ STA ACCU + 2
+1cd4 : f0 23 __ BEQ $1cf9
+1cd6 : a5 1d __ LDA ACCU + 2
+1cd8 : 4a __ __ LSR
+1cd9 : 66 1c __ ROR ACCU + 1
+1cdb : 66 1b __ ROR ACCU + 0
+1cdd : e8 __ __ INX
+1cde : d0 f8 __ BNE $1cd8
+1ce0 : 85 1d __ STA ACCU + 2
+1ce2 : a5 08 __ LDA $08
+1ce4 : 85 07 __ STA $07
+1ce6 : 4c f9 1c JMP $1cf9 ; (faddsub + 63)
+1ce9 : e0 18 __ CPX #$18
+1ceb : b0 33 __ BCS $1d20
+1ced : a5 05 __ LDA $05
+1cef : 4a __ __ LSR
+1cf0 : 66 04 __ ROR $04
+1cf2 : 66 03 __ ROR $03
+1cf4 : ca __ __ DEX
+1cf5 : d0 f8 __ BNE $1cef
+1cf7 : 85 05 __ STA $05
+1cf9 : a5 1e __ LDA ACCU + 3
+1cfb : 29 80 __ AND #$80
+1cfd : 85 1e __ STA ACCU + 3
+1cff : 45 06 __ EOR $06
+1d01 : 30 2d __ BMI $1d30
+1d03 : 18 __ __ CLC
+1d04 : a5 1b __ LDA ACCU + 0
+1d06 : 65 03 __ ADC $03
+1d08 : 85 1b __ STA ACCU + 0
+1d0a : a5 1c __ LDA ACCU + 1
+1d0c : 65 04 __ ADC $04
+1d0e : 85 1c __ STA ACCU + 1
+1d10 : a5 1d __ LDA ACCU + 2
+1d12 : 65 05 __ ADC $05
+1d14 : 85 1d __ STA ACCU + 2
+1d16 : 90 08 __ BCC $1d20
+1d18 : 66 1d __ ROR ACCU + 2
+1d1a : 66 1c __ ROR ACCU + 1
+1d1c : 66 1b __ ROR ACCU + 0
+1d1e : e6 07 __ INC $07
+1d20 : a5 07 __ LDA $07
+1d22 : 4a __ __ LSR
+1d23 : 05 1e __ ORA ACCU + 3
+1d25 : 85 1e __ STA ACCU + 3
+1d27 : b0 06 __ BCS $1d2f
+1d29 : a5 1d __ LDA ACCU + 2
+1d2b : 29 7f __ AND #$7f
+1d2d : 85 1d __ STA ACCU + 2
+1d2f : 60 __ __ RTS
+1d30 : 38 __ __ SEC
+1d31 : a5 1b __ LDA ACCU + 0
+1d33 : e5 03 __ SBC $03
+1d35 : 85 1b __ STA ACCU + 0
+1d37 : a5 1c __ LDA ACCU + 1
+1d39 : e5 04 __ SBC $04
+1d3b : 85 1c __ STA ACCU + 1
+1d3d : a5 1d __ LDA ACCU + 2
+1d3f : e5 05 __ SBC $05
+1d41 : 85 1d __ STA ACCU + 2
+1d43 : b0 19 __ BCS $1d5e
+1d45 : 38 __ __ SEC
+1d46 : a9 00 __ LDA #$00
+1d48 : e5 1b __ SBC ACCU + 0
+1d4a : 85 1b __ STA ACCU + 0
+1d4c : a9 00 __ LDA #$00
+1d4e : e5 1c __ SBC ACCU + 1
+1d50 : 85 1c __ STA ACCU + 1
+1d52 : a9 00 __ LDA #$00
+1d54 : e5 1d __ SBC ACCU + 2
+1d56 : 85 1d __ STA ACCU + 2
+1d58 : a5 1e __ LDA ACCU + 3
+1d5a : 49 80 __ EOR #$80
+1d5c : 85 1e __ STA ACCU + 3
+1d5e : a5 1d __ LDA ACCU + 2
+1d60 : 30 be __ BMI $1d20
+1d62 : 05 1c __ ORA ACCU + 1
+1d64 : 05 1b __ ORA ACCU + 0
+1d66 : f0 0f __ BEQ $1d77
+1d68 : c6 07 __ DEC $07
+1d6a : f0 0b __ BEQ $1d77
+1d6c : 06 1b __ ASL ACCU + 0
+1d6e : 26 1c __ ROL ACCU + 1
+1d70 : 26 1d __ ROL ACCU + 2
+1d72 : 10 f4 __ BPL $1d68
+1d74 : 4c 20 1d JMP $1d20 ; (faddsub + 102)
+1d77 : a9 00 __ LDA #$00
+1d79 : 85 1b __ STA ACCU + 0
+1d7b : 85 1c __ STA ACCU + 1
+1d7d : 85 1d __ STA ACCU + 2
+1d7f : 85 1e __ STA ACCU + 3
+1d81 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1d82 : a5 1b __ LDA ACCU + 0
+1d84 : 05 1c __ ORA ACCU + 1
+1d86 : 05 1d __ ORA ACCU + 2
+1d88 : d0 03 __ BNE $1d8d
+1d8a : 85 1e __ STA ACCU + 3
+1d8c : 60 __ __ RTS
+1d8d : a5 03 __ LDA $03
+1d8f : 05 04 __ ORA $04
+1d91 : 05 05 __ ORA $05
+1d93 : d0 09 __ BNE $1d9e
+1d95 : 85 1b __ STA ACCU + 0
+1d97 : 85 1c __ STA ACCU + 1
+1d99 : 85 1d __ STA ACCU + 2
+1d9b : 85 1e __ STA ACCU + 3
+1d9d : 60 __ __ RTS
+1d9e : a9 00 __ LDA #$00
+1da0 : 85 09 __ STA $09
+1da2 : 85 0a __ STA $0a
+1da4 : 85 0b __ STA $0b
+1da6 : a4 1b __ LDY ACCU + 0
+1da8 : a5 03 __ LDA $03
+1daa : d0 06 __ BNE $1db2
+1dac : a5 04 __ LDA $04
+1dae : f0 0a __ BEQ $1dba
+1db0 : d0 05 __ BNE $1db7
+1db2 : 20 f2 1d JSR $1df2 ; (fmul8 + 0)
+1db5 : a5 04 __ LDA $04
+1db7 : 20 f2 1d JSR $1df2 ; (fmul8 + 0)
+1dba : a5 05 __ LDA $05
+1dbc : 20 f2 1d JSR $1df2 ; (fmul8 + 0)
+1dbf : 38 __ __ SEC
+1dc0 : a5 0b __ LDA $0b
+1dc2 : 30 06 __ BMI $1dca
+1dc4 : 06 09 __ ASL $09
+1dc6 : 26 0a __ ROL $0a
+1dc8 : 2a __ __ ROL
+1dc9 : 18 __ __ CLC
+1dca : 29 7f __ AND #$7f
+1dcc : 85 0b __ STA $0b
+1dce : a5 1e __ LDA ACCU + 3
+1dd0 : 45 06 __ EOR $06
+1dd2 : 29 80 __ AND #$80
+1dd4 : 85 1e __ STA ACCU + 3
+1dd6 : a5 07 __ LDA $07
+1dd8 : e9 7e __ SBC #$7e
+1dda : 18 __ __ CLC
+1ddb : 65 08 __ ADC $08
+1ddd : 4a __ __ LSR
+1dde : 05 1e __ ORA ACCU + 3
+1de0 : 85 1e __ STA ACCU + 3
+1de2 : a9 00 __ LDA #$00
+1de4 : 6a __ __ ROR
+1de5 : 05 0b __ ORA $0b
+1de7 : 85 1d __ STA ACCU + 2
+1de9 : a5 0a __ LDA $0a
+1deb : 85 1c __ STA ACCU + 1
+1ded : a5 09 __ LDA $09
+1def : 85 1b __ STA ACCU + 0
+1df1 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1df2 : 38 __ __ SEC
+1df3 : 6a __ __ ROR
+1df4 : 90 1e __ BCC $1e14
+1df6 : aa __ __ TAX
+1df7 : 18 __ __ CLC
+1df8 : 98 __ __ TYA
+1df9 : 65 09 __ ADC $09
+1dfb : 85 09 __ STA $09
+1dfd : a5 0a __ LDA $0a
+1dff : 65 1c __ ADC ACCU + 1
+1e01 : 85 0a __ STA $0a
+1e03 : a5 0b __ LDA $0b
+1e05 : 65 1d __ ADC ACCU + 2
+1e07 : 6a __ __ ROR
+1e08 : 85 0b __ STA $0b
+1e0a : 8a __ __ TXA
+1e0b : 66 0a __ ROR $0a
+1e0d : 66 09 __ ROR $09
+1e0f : 4a __ __ LSR
+1e10 : f0 0d __ BEQ $1e1f
+1e12 : b0 e2 __ BCS $1df6
+1e14 : 66 0b __ ROR $0b
+1e16 : 66 0a __ ROR $0a
+1e18 : 66 09 __ ROR $09
+1e1a : 4a __ __ LSR
+1e1b : 90 f7 __ BCC $1e14
+1e1d : d0 d7 __ BNE $1df6
+1e1f : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1e20 : a5 1b __ LDA ACCU + 0
+1e22 : 05 1c __ ORA ACCU + 1
+1e24 : 05 1d __ ORA ACCU + 2
+1e26 : d0 03 __ BNE $1e2b
+1e28 : 85 1e __ STA ACCU + 3
+1e2a : 60 __ __ RTS
+1e2b : a5 1e __ LDA ACCU + 3
+1e2d : 45 06 __ EOR $06
+1e2f : 29 80 __ AND #$80
+1e31 : 85 1e __ STA ACCU + 3
+1e33 : a9 00 __ LDA #$00
+1e35 : 85 09 __ STA $09
+1e37 : 85 0a __ STA $0a
+1e39 : 85 0b __ STA $0b
+1e3b : a2 18 __ LDX #$18
+1e3d : a5 1b __ LDA ACCU + 0
+1e3f : c5 03 __ CMP $03
+1e41 : a5 1c __ LDA ACCU + 1
+1e43 : e5 04 __ SBC $04
+1e45 : a5 1d __ LDA ACCU + 2
+1e47 : e5 05 __ SBC $05
+1e49 : 90 13 __ BCC $1e5e
+1e4b : a5 1b __ LDA ACCU + 0
+1e4d : e5 03 __ SBC $03
+1e4f : 85 1b __ STA ACCU + 0
+1e51 : a5 1c __ LDA ACCU + 1
+1e53 : e5 04 __ SBC $04
+1e55 : 85 1c __ STA ACCU + 1
+1e57 : a5 1d __ LDA ACCU + 2
+1e59 : e5 05 __ SBC $05
+1e5b : 85 1d __ STA ACCU + 2
+1e5d : 38 __ __ SEC
+1e5e : 26 09 __ ROL $09
+1e60 : 26 0a __ ROL $0a
+1e62 : 26 0b __ ROL $0b
+1e64 : ca __ __ DEX
+1e65 : f0 0a __ BEQ $1e71
+1e67 : 06 1b __ ASL ACCU + 0
+1e69 : 26 1c __ ROL ACCU + 1
+1e6b : 26 1d __ ROL ACCU + 2
+1e6d : b0 dc __ BCS $1e4b
+1e6f : 90 cc __ BCC $1e3d
+1e71 : 38 __ __ SEC
+1e72 : a5 0b __ LDA $0b
+1e74 : 30 06 __ BMI $1e7c
+1e76 : 06 09 __ ASL $09
+1e78 : 26 0a __ ROL $0a
+1e7a : 2a __ __ ROL
+1e7b : 18 __ __ CLC
+1e7c : 29 7f __ AND #$7f
+1e7e : 85 0b __ STA $0b
+1e80 : a5 08 __ LDA $08
+1e82 : 49 7f __ EOR #$7f
+1e84 : 65 07 __ ADC $07
+1e86 : 38 __ __ SEC
+1e87 : e9 01 __ SBC #$01
+1e89 : 4a __ __ LSR
+1e8a : 05 1e __ ORA ACCU + 3
+1e8c : 85 1e __ STA ACCU + 3
+1e8e : a9 00 __ LDA #$00
+1e90 : 6a __ __ ROR
+1e91 : 05 0b __ ORA $0b
+1e93 : 85 1d __ STA ACCU + 2
+1e95 : a5 0a __ LDA $0a
+1e97 : 85 1c __ STA ACCU + 1
+1e99 : a5 09 __ LDA $09
+1e9b : 85 1b __ STA ACCU + 0
+1e9d : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+1e9e : a0 00 __ LDY #$00
+1ea0 : 84 06 __ STY $06
+1ea2 : a5 03 __ LDA $03
+1ea4 : a6 04 __ LDX $04
+1ea6 : f0 1c __ BEQ $1ec4
+1ea8 : 38 __ __ SEC
+1ea9 : 6a __ __ ROR
+1eaa : 90 0d __ BCC $1eb9
+1eac : aa __ __ TAX
+1ead : 18 __ __ CLC
+1eae : 98 __ __ TYA
+1eaf : 65 1b __ ADC ACCU + 0
+1eb1 : a8 __ __ TAY
+1eb2 : a5 06 __ LDA $06
+1eb4 : 65 1c __ ADC ACCU + 1
+1eb6 : 85 06 __ STA $06
+1eb8 : 8a __ __ TXA
+1eb9 : 06 1b __ ASL ACCU + 0
+1ebb : 26 1c __ ROL ACCU + 1
+1ebd : 4a __ __ LSR
+1ebe : 90 f9 __ BCC $1eb9
+1ec0 : d0 ea __ BNE $1eac
+1ec2 : a5 04 __ LDA $04
+1ec4 : 4a __ __ LSR
+1ec5 : 90 0d __ BCC $1ed4
+1ec7 : aa __ __ TAX
+1ec8 : 18 __ __ CLC
+1ec9 : 98 __ __ TYA
+1eca : 65 1b __ ADC ACCU + 0
+1ecc : a8 __ __ TAY
+1ecd : a5 06 __ LDA $06
+1ecf : 65 1c __ ADC ACCU + 1
+1ed1 : 85 06 __ STA $06
+1ed3 : 8a __ __ TXA
+1ed4 : 06 1b __ ASL ACCU + 0
+1ed6 : 26 1c __ ROL ACCU + 1
+1ed8 : 4a __ __ LSR
+1ed9 : b0 ec __ BCS $1ec7
+1edb : d0 f7 __ BNE $1ed4
+1edd : 84 05 __ STY $05
+1edf : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1ee0 : 24 1c __ BIT ACCU + 1
+1ee2 : 10 0d __ BPL $1ef1
+1ee4 : 20 fe 1e JSR $1efe ; (negaccu + 0)
+1ee7 : 24 04 __ BIT $04
+1ee9 : 10 0d __ BPL $1ef8
+1eeb : 20 0c 1f JSR $1f0c ; (negtmp + 0)
+1eee : 4c 1a 1f JMP $1f1a ; (divmod + 0)
+1ef1 : 24 04 __ BIT $04
+1ef3 : 10 f9 __ BPL $1eee
+1ef5 : 20 0c 1f JSR $1f0c ; (negtmp + 0)
+1ef8 : 20 1a 1f JSR $1f1a ; (divmod + 0)
+1efb : 4c fe 1e JMP $1efe ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1efe : 38 __ __ SEC
+1eff : a9 00 __ LDA #$00
+1f01 : e5 1b __ SBC ACCU + 0
+1f03 : 85 1b __ STA ACCU + 0
+1f05 : a9 00 __ LDA #$00
+1f07 : e5 1c __ SBC ACCU + 1
+1f09 : 85 1c __ STA ACCU + 1
+1f0b : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1f0c : 38 __ __ SEC
+1f0d : a9 00 __ LDA #$00
+1f0f : e5 03 __ SBC $03
+1f11 : 85 03 __ STA $03
+1f13 : a9 00 __ LDA #$00
+1f15 : e5 04 __ SBC $04
+1f17 : 85 04 __ STA $04
+1f19 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1f1a : a5 1c __ LDA ACCU + 1
+1f1c : d0 31 __ BNE $1f4f
+1f1e : a5 04 __ LDA $04
+1f20 : d0 1e __ BNE $1f40
+1f22 : 85 06 __ STA $06
+1f24 : a2 04 __ LDX #$04
+1f26 : 06 1b __ ASL ACCU + 0
+1f28 : 2a __ __ ROL
+1f29 : c5 03 __ CMP $03
+1f2b : 90 02 __ BCC $1f2f
+1f2d : e5 03 __ SBC $03
+1f2f : 26 1b __ ROL ACCU + 0
+1f31 : 2a __ __ ROL
+1f32 : c5 03 __ CMP $03
+1f34 : 90 02 __ BCC $1f38
+1f36 : e5 03 __ SBC $03
+1f38 : 26 1b __ ROL ACCU + 0
+1f3a : ca __ __ DEX
+1f3b : d0 eb __ BNE $1f28
+1f3d : 85 05 __ STA $05
+1f3f : 60 __ __ RTS
+1f40 : a5 1b __ LDA ACCU + 0
+1f42 : 85 05 __ STA $05
+1f44 : a5 1c __ LDA ACCU + 1
+1f46 : 85 06 __ STA $06
+1f48 : a9 00 __ LDA #$00
+1f4a : 85 1b __ STA ACCU + 0
+1f4c : 85 1c __ STA ACCU + 1
+1f4e : 60 __ __ RTS
+1f4f : a5 04 __ LDA $04
+1f51 : d0 1f __ BNE $1f72
+1f53 : a5 03 __ LDA $03
+1f55 : 30 1b __ BMI $1f72
+1f57 : a9 00 __ LDA #$00
+1f59 : 85 06 __ STA $06
+1f5b : a2 10 __ LDX #$10
+1f5d : 06 1b __ ASL ACCU + 0
+1f5f : 26 1c __ ROL ACCU + 1
+1f61 : 2a __ __ ROL
+1f62 : c5 03 __ CMP $03
+1f64 : 90 02 __ BCC $1f68
+1f66 : e5 03 __ SBC $03
+1f68 : 26 1b __ ROL ACCU + 0
+1f6a : 26 1c __ ROL ACCU + 1
+1f6c : ca __ __ DEX
+1f6d : d0 f2 __ BNE $1f61
+1f6f : 85 05 __ STA $05
+1f71 : 60 __ __ RTS
+1f72 : a9 00 __ LDA #$00
+1f74 : 85 05 __ STA $05
+1f76 : 85 06 __ STA $06
+1f78 : 84 02 __ STY $02
+1f7a : a0 10 __ LDY #$10
+1f7c : 18 __ __ CLC
+1f7d : 26 1b __ ROL ACCU + 0
+1f7f : 26 1c __ ROL ACCU + 1
+1f81 : 26 05 __ ROL $05
+1f83 : 26 06 __ ROL $06
+1f85 : 38 __ __ SEC
+1f86 : a5 05 __ LDA $05
+1f88 : e5 03 __ SBC $03
+1f8a : aa __ __ TAX
+1f8b : a5 06 __ LDA $06
+1f8d : e5 04 __ SBC $04
+1f8f : 90 04 __ BCC $1f95
+1f91 : 86 05 __ STX $05
+1f93 : 85 06 __ STA $06
+1f95 : 88 __ __ DEY
+1f96 : d0 e5 __ BNE $1f7d
+1f98 : 26 1b __ ROL ACCU + 0
+1f9a : 26 1c __ ROL ACCU + 1
+1f9c : a4 02 __ LDY $02
+1f9e : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+1f9f : 24 1c __ BIT ACCU + 1
+1fa1 : 10 0d __ BPL $1fb0
+1fa3 : 20 fe 1e JSR $1efe ; (negaccu + 0)
+1fa6 : 24 04 __ BIT $04
+1fa8 : 10 0d __ BPL $1fb7
+1faa : 20 0c 1f JSR $1f0c ; (negtmp + 0)
+1fad : 4c 1a 1f JMP $1f1a ; (divmod + 0)
+1fb0 : 24 04 __ BIT $04
+1fb2 : 10 f9 __ BPL $1fad
+1fb4 : 20 0c 1f JSR $1f0c ; (negtmp + 0)
+1fb7 : 20 1a 1f JSR $1f1a ; (divmod + 0)
+1fba : 38 __ __ SEC
+1fbb : a9 00 __ LDA #$00
+1fbd : e5 05 __ SBC $05
+1fbf : 85 05 __ STA $05
+1fc1 : a9 00 __ LDA #$00
+1fc3 : e5 06 __ SBC $06
+1fc5 : 85 06 __ STA $06
+1fc7 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1fc8 : 20 99 1c JSR $1c99 ; (freg + 36)
+1fcb : a5 07 __ LDA $07
+1fcd : c9 7f __ CMP #$7f
+1fcf : b0 07 __ BCS $1fd8
+1fd1 : a9 00 __ LDA #$00
+1fd3 : 85 1b __ STA ACCU + 0
+1fd5 : 85 1c __ STA ACCU + 1
+1fd7 : 60 __ __ RTS
+1fd8 : 38 __ __ SEC
+1fd9 : e9 8e __ SBC #$8e
+1fdb : 90 0a __ BCC $1fe7
+1fdd : a9 ff __ LDA #$ff
+1fdf : 85 1b __ STA ACCU + 0
+1fe1 : a9 7f __ LDA #$7f
+1fe3 : 85 1c __ STA ACCU + 1
+1fe5 : d0 08 __ BNE $1fef
+1fe7 : aa __ __ TAX
+1fe8 : 46 1d __ LSR ACCU + 2
+1fea : 66 1c __ ROR ACCU + 1
+1fec : e8 __ __ INX
+1fed : d0 f9 __ BNE $1fe8
+1fef : 24 1e __ BIT ACCU + 3
+1ff1 : 10 0e __ BPL $2001
+1ff3 : 38 __ __ SEC
+1ff4 : a9 00 __ LDA #$00
+1ff6 : e5 1c __ SBC ACCU + 1
+1ff8 : 85 1b __ STA ACCU + 0
+1ffa : a9 00 __ LDA #$00
+1ffc : e5 1d __ SBC ACCU + 2
+1ffe : 85 1c __ STA ACCU + 1
+2000 : 60 __ __ RTS
+2001 : a5 1c __ LDA ACCU + 1
+2003 : 85 1b __ STA ACCU + 0
+2005 : a5 1d __ LDA ACCU + 2
+2007 : 85 1c __ STA ACCU + 1
+2009 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+200a : 24 1c __ BIT ACCU + 1
+200c : 30 03 __ BMI $2011
+200e : 4c 28 20 JMP $2028 ; (uint16_to_float + 0)
+2011 : 38 __ __ SEC
+2012 : a9 00 __ LDA #$00
+2014 : e5 1b __ SBC ACCU + 0
+2016 : 85 1b __ STA ACCU + 0
+2018 : a9 00 __ LDA #$00
+201a : e5 1c __ SBC ACCU + 1
+201c : 85 1c __ STA ACCU + 1
+201e : 20 28 20 JSR $2028 ; (uint16_to_float + 0)
+2021 : a5 1e __ LDA ACCU + 3
+2023 : 09 80 __ ORA #$80
+2025 : 85 1e __ STA ACCU + 3
+2027 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+2028 : a5 1b __ LDA ACCU + 0
+202a : 05 1c __ ORA ACCU + 1
+202c : d0 05 __ BNE $2033
+202e : 85 1d __ STA ACCU + 2
+2030 : 85 1e __ STA ACCU + 3
+2032 : 60 __ __ RTS
+2033 : a2 8e __ LDX #$8e
+2035 : a5 1c __ LDA ACCU + 1
+2037 : 30 06 __ BMI $203f
+2039 : ca __ __ DEX
+203a : 06 1b __ ASL ACCU + 0
+203c : 2a __ __ ROL
+203d : 10 fa __ BPL $2039
+203f : 29 7f __ AND #$7f
+2041 : 85 1d __ STA ACCU + 2
+2043 : a5 1b __ LDA ACCU + 0
+2045 : 85 1c __ STA ACCU + 1
+2047 : 8a __ __ TXA
+2048 : 4a __ __ LSR
+2049 : 85 1e __ STA ACCU + 3
+204b : a9 00 __ LDA #$00
+204d : 85 1b __ STA ACCU + 0
+204f : 6a __ __ ROR
+2050 : 05 1d __ ORA ACCU + 2
+2052 : 85 1d __ STA ACCU + 2
+2054 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2055 : a5 1e __ LDA ACCU + 3
+2057 : 45 06 __ EOR $06
+2059 : 29 80 __ AND #$80
+205b : f0 1e __ BEQ $207b
+205d : a5 1e __ LDA ACCU + 3
+205f : 29 7f __ AND #$7f
+2061 : 05 1d __ ORA ACCU + 2
+2063 : 05 1c __ ORA ACCU + 1
+2065 : 05 1b __ ORA ACCU + 0
+2067 : d0 0c __ BNE $2075
+2069 : a5 06 __ LDA $06
+206b : 29 7f __ AND #$7f
+206d : 05 05 __ ORA $05
+206f : 05 04 __ ORA $04
+2071 : 05 03 __ ORA $03
+2073 : f0 1e __ BEQ $2093
+2075 : a5 1e __ LDA ACCU + 3
+2077 : 30 23 __ BMI $209c
+2079 : 10 28 __ BPL $20a3
+207b : a5 1e __ LDA ACCU + 3
+207d : c5 06 __ CMP $06
+207f : d0 15 __ BNE $2096
+2081 : a5 1d __ LDA ACCU + 2
+2083 : c5 05 __ CMP $05
+2085 : d0 0f __ BNE $2096
+2087 : a5 1c __ LDA ACCU + 1
+2089 : c5 04 __ CMP $04
+208b : d0 09 __ BNE $2096
+208d : a5 1b __ LDA ACCU + 0
+208f : c5 03 __ CMP $03
+2091 : d0 03 __ BNE $2096
+2093 : a9 00 __ LDA #$00
+2095 : 60 __ __ RTS
+2096 : b0 07 __ BCS $209f
+2098 : 24 1e __ BIT ACCU + 3
+209a : 30 07 __ BMI $20a3
+209c : a9 01 __ LDA #$01
+209e : 60 __ __ RTS
+209f : 24 1e __ BIT ACCU + 3
+20a1 : 30 f9 __ BMI $209c
+20a3 : a9 ff __ LDA #$ff
+20a5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+20a6 : 84 02 __ STY $02
+20a8 : a9 00 __ LDA #$00
+20aa : 85 07 __ STA $07
+20ac : 85 08 __ STA $08
+20ae : 85 09 __ STA $09
+20b0 : 85 0a __ STA $0a
+20b2 : a0 20 __ LDY #$20
+20b4 : 18 __ __ CLC
+20b5 : 26 1b __ ROL ACCU + 0
+20b7 : 26 1c __ ROL ACCU + 1
+20b9 : 26 1d __ ROL ACCU + 2
+20bb : 26 1e __ ROL ACCU + 3
+20bd : 26 07 __ ROL $07
+20bf : 26 08 __ ROL $08
+20c1 : 26 09 __ ROL $09
+20c3 : 26 0a __ ROL $0a
+20c5 : a5 07 __ LDA $07
+20c7 : c5 03 __ CMP $03
+20c9 : a5 08 __ LDA $08
+20cb : e5 04 __ SBC $04
+20cd : a5 09 __ LDA $09
+20cf : e5 05 __ SBC $05
+20d1 : a5 0a __ LDA $0a
+20d3 : e5 06 __ SBC $06
+20d5 : 90 18 __ BCC $20ef
+20d7 : a5 07 __ LDA $07
+20d9 : e5 03 __ SBC $03
+20db : 85 07 __ STA $07
+20dd : a5 08 __ LDA $08
+20df : e5 04 __ SBC $04
+20e1 : 85 08 __ STA $08
+20e3 : a5 09 __ LDA $09
+20e5 : e5 05 __ SBC $05
+20e7 : 85 09 __ STA $09
+20e9 : a5 0a __ LDA $0a
+20eb : e5 06 __ SBC $06
+20ed : 85 0a __ STA $0a
+20ef : 88 __ __ DEY
+20f0 : d0 c3 __ BNE $20b5
+20f2 : 26 1b __ ROL ACCU + 0
+20f4 : 26 1c __ ROL ACCU + 1
+20f6 : 26 1d __ ROL ACCU + 2
+20f8 : 26 1e __ ROL ACCU + 3
+20fa : a4 02 __ LDY $02
+20fc : 60 __ __ RTS
@@ -0,0 +1,3388 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 1f 23 STX $231f ; (spentry + 0)
+0811 : a9 20 __ LDA #$20
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 8c __ LDA #$8c
+0832 : e9 20 __ SBC #$20
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 66 1e JMP $1e66 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 65 __ STA T0 + 0
+0911 : 85 66 __ STA T0 + 1
+0913 : 85 67 __ STA T1 + 0
+0915 : 85 68 __ STA T1 + 1
+0917 : a9 20 __ LDA #$20
+0919 : a0 02 __ LDY #$02
+091b : 91 23 __ STA (SP + 0),y
+091d : a9 23 __ LDA #$23
+091f : c8 __ __ INY
+0920 : 91 23 __ STA (SP + 0),y
+0922 : a9 fa __ LDA #$fa
+0924 : c8 __ __ INY
+0925 : 91 23 __ STA (SP + 0),y
+0927 : a9 1d __ LDA #$1d
+0929 : c8 __ __ INY
+092a : 91 23 __ STA (SP + 0),y
+092c : a5 67 __ LDA T1 + 0
+092e : 85 1b __ STA ACCU + 0
+0930 : a5 68 __ LDA T1 + 1
+0932 : 85 1c __ STA ACCU + 1
+0934 : a9 4b __ LDA #$4b
+0936 : 85 03 __ STA $03
+0938 : a9 01 __ LDA #$01
+093a : 85 04 __ STA $04
+093c : 20 c0 20 JSR $20c0 ; (mul16 + 0)
+093f : 38 __ __ SEC
+0940 : a5 05 __ LDA $05
+0942 : e9 80 __ SBC #$80
+0944 : a0 06 __ LDY #$06
+0946 : 91 23 __ STA (SP + 0),y
+0948 : a5 06 __ LDA $06
+094a : e9 3e __ SBC #$3e
+094c : c8 __ __ INY
+094d : 91 23 __ STA (SP + 0),y
+094f : a5 67 __ LDA T1 + 0
+0951 : 85 1b __ STA ACCU + 0
+0953 : a5 68 __ LDA T1 + 1
+0955 : 85 1c __ STA ACCU + 1
+0957 : a9 69 __ LDA #$69
+0959 : 85 03 __ STA $03
+095b : a9 02 __ LDA #$02
+095d : 85 04 __ STA $04
+095f : 20 c0 20 JSR $20c0 ; (mul16 + 0)
+0962 : a5 05 __ LDA $05
+0964 : a0 08 __ LDY #$08
+0966 : 91 23 __ STA (SP + 0),y
+0968 : a5 06 __ LDA $06
+096a : c8 __ __ INY
+096b : 91 23 __ STA (SP + 0),y
+096d : a5 67 __ LDA T1 + 0
+096f : 85 1b __ STA ACCU + 0
+0971 : a5 68 __ LDA T1 + 1
+0973 : 85 1c __ STA ACCU + 1
+0975 : a9 61 __ LDA #$61
+0977 : 85 03 __ STA $03
+0979 : 20 73 1e JSR $1e73 ; (mul16by8 + 0)
+097c : a5 05 __ LDA $05
+097e : a0 0a __ LDY #$0a
+0980 : 91 23 __ STA (SP + 0),y
+0982 : a5 06 __ LDA $06
+0984 : c8 __ __ INY
+0985 : 91 23 __ STA (SP + 0),y
+0987 : a5 67 __ LDA T1 + 0
+0989 : c8 __ __ INY
+098a : 91 23 __ STA (SP + 0),y
+098c : a5 68 __ LDA T1 + 1
+098e : c8 __ __ INY
+098f : 91 23 __ STA (SP + 0),y
+0991 : 38 __ __ SEC
+0992 : a9 00 __ LDA #$00
+0994 : e5 67 __ SBC T1 + 0
+0996 : c8 __ __ INY
+0997 : 91 23 __ STA (SP + 0),y
+0999 : a9 00 __ LDA #$00
+099b : e5 68 __ SBC T1 + 1
+099d : c8 __ __ INY
+099e : 91 23 __ STA (SP + 0),y
+09a0 : a9 0f __ LDA #$0f
+09a2 : c8 __ __ INY
+09a3 : 91 23 __ STA (SP + 0),y
+09a5 : a9 1e __ LDA #$1e
+09a7 : c8 __ __ INY
+09a8 : 91 23 __ STA (SP + 0),y
+09aa : 20 7d 0b JSR $0b7d ; (sprintf + 0)
+09ad : a9 00 __ LDA #$00
+09af : 85 43 __ STA T2 + 0
+09b1 : 85 44 __ STA T2 + 1
+09b3 : ad 20 23 LDA $2320 ; (buffer + 0)
+09b6 : f0 03 __ BEQ $09bb
+09b8 : 4c 61 0b JMP $0b61 ; (main + 609)
+09bb : 18 __ __ CLC
+09bc : a5 65 __ LDA T0 + 0
+09be : 65 43 __ ADC T2 + 0
+09c0 : 85 65 __ STA T0 + 0
+09c2 : a5 66 __ LDA T0 + 1
+09c4 : 65 44 __ ADC T2 + 1
+09c6 : 85 66 __ STA T0 + 1
+09c8 : ad 20 23 LDA $2320 ; (buffer + 0)
+09cb : f0 03 __ BEQ $09d0
+09cd : 4c 2f 0b JMP $0b2f ; (main + 559)
+09d0 : e6 67 __ INC T1 + 0
+09d2 : d0 02 __ BNE $09d6
+09d4 : e6 68 __ INC T1 + 1
+09d6 : a5 67 __ LDA T1 + 0
+09d8 : c9 64 __ CMP #$64
+09da : b0 03 __ BCS $09df
+09dc : 4c 17 09 JMP $0917 ; (main + 23)
+09df : a9 00 __ LDA #$00
+09e1 : 85 69 __ STA T3 + 0
+09e3 : a9 20 __ LDA #$20
+09e5 : a0 02 __ LDY #$02
+09e7 : 91 23 __ STA (SP + 0),y
+09e9 : a9 23 __ LDA #$23
+09eb : c8 __ __ INY
+09ec : 91 23 __ STA (SP + 0),y
+09ee : a9 13 __ LDA #$13
+09f0 : c8 __ __ INY
+09f1 : 91 23 __ STA (SP + 0),y
+09f3 : a9 1e __ LDA #$1e
+09f5 : c8 __ __ INY
+09f6 : 91 23 __ STA (SP + 0),y
+09f8 : a5 69 __ LDA T3 + 0
+09fa : 85 1b __ STA ACCU + 0
+09fc : a9 00 __ LDA #$00
+09fe : 85 1c __ STA ACCU + 1
+0a00 : 20 2c 22 JSR $222c ; (sint16_to_float + 0)
+0a03 : a5 1b __ LDA ACCU + 0
+0a05 : 85 49 __ STA T6 + 0
+0a07 : a5 1c __ LDA ACCU + 1
+0a09 : 85 4a __ STA T6 + 1
+0a0b : a5 1d __ LDA ACCU + 2
+0a0d : 85 4b __ STA T6 + 2
+0a0f : a5 1e __ LDA ACCU + 3
+0a11 : 85 4c __ STA T6 + 3
+0a13 : a9 00 __ LDA #$00
+0a15 : 85 03 __ STA $03
+0a17 : 85 04 __ STA $04
+0a19 : a9 a0 __ LDA #$a0
+0a1b : 85 05 __ STA $05
+0a1d : a9 3f __ LDA #$3f
+0a1f : 85 06 __ STA $06
+0a21 : 20 ab 1e JSR $1eab ; (freg + 20)
+0a24 : 20 a4 1f JSR $1fa4 ; (fmul + 0)
+0a27 : a5 1b __ LDA ACCU + 0
+0a29 : a0 06 __ LDY #$06
+0a2b : 91 23 __ STA (SP + 0),y
+0a2d : a5 1c __ LDA ACCU + 1
+0a2f : c8 __ __ INY
+0a30 : 91 23 __ STA (SP + 0),y
+0a32 : a5 1d __ LDA ACCU + 2
+0a34 : c8 __ __ INY
+0a35 : 91 23 __ STA (SP + 0),y
+0a37 : a5 1e __ LDA ACCU + 3
+0a39 : c8 __ __ INY
+0a3a : 91 23 __ STA (SP + 0),y
+0a3c : a5 49 __ LDA T6 + 0
+0a3e : 85 1b __ STA ACCU + 0
+0a40 : a5 4a __ LDA T6 + 1
+0a42 : 85 1c __ STA ACCU + 1
+0a44 : a5 4b __ LDA T6 + 2
+0a46 : 85 1d __ STA ACCU + 2
+0a48 : a5 4c __ LDA T6 + 3
+0a4a : 85 1e __ STA ACCU + 3
+0a4c : a9 00 __ LDA #$00
+0a4e : 85 03 __ STA $03
+0a50 : 85 04 __ STA $04
+0a52 : a9 80 __ LDA #$80
+0a54 : 85 05 __ STA $05
+0a56 : a9 bd __ LDA #$bd
+0a58 : 85 06 __ STA $06
+0a5a : 20 ab 1e JSR $1eab ; (freg + 20)
+0a5d : 20 a4 1f JSR $1fa4 ; (fmul + 0)
+0a60 : a5 1b __ LDA ACCU + 0
+0a62 : a0 0a __ LDY #$0a
+0a64 : 91 23 __ STA (SP + 0),y
+0a66 : a5 1c __ LDA ACCU + 1
+0a68 : c8 __ __ INY
+0a69 : 91 23 __ STA (SP + 0),y
+0a6b : a5 1d __ LDA ACCU + 2
+0a6d : c8 __ __ INY
+0a6e : 91 23 __ STA (SP + 0),y
+0a70 : a5 1e __ LDA ACCU + 3
+0a72 : c8 __ __ INY
+0a73 : 91 23 __ STA (SP + 0),y
+0a75 : 20 7d 0b JSR $0b7d ; (sprintf + 0)
+0a78 : a9 00 __ LDA #$00
+0a7a : 85 67 __ STA T1 + 0
+0a7c : 85 68 __ STA T1 + 1
+0a7e : ad 20 23 LDA $2320 ; (buffer + 0)
+0a81 : f0 03 __ BEQ $0a86
+0a83 : 4c 13 0b JMP $0b13 ; (main + 531)
+0a86 : e6 69 __ INC T3 + 0
+0a88 : 18 __ __ CLC
+0a89 : a5 65 __ LDA T0 + 0
+0a8b : 65 67 __ ADC T1 + 0
+0a8d : 85 65 __ STA T0 + 0
+0a8f : a5 66 __ LDA T0 + 1
+0a91 : 65 68 __ ADC T1 + 1
+0a93 : 85 66 __ STA T0 + 1
+0a95 : a5 69 __ LDA T3 + 0
+0a97 : c9 14 __ CMP #$14
+0a99 : b0 03 __ BCS $0a9e
+0a9b : 4c e3 09 JMP $09e3 ; (main + 227)
+0a9e : a9 20 __ LDA #$20
+0aa0 : a0 02 __ LDY #$02
+0aa2 : 91 23 __ STA (SP + 0),y
+0aa4 : a9 23 __ LDA #$23
+0aa6 : c8 __ __ INY
+0aa7 : 91 23 __ STA (SP + 0),y
+0aa9 : a9 1c __ LDA #$1c
+0aab : c8 __ __ INY
+0aac : 91 23 __ STA (SP + 0),y
+0aae : a9 1e __ LDA #$1e
+0ab0 : c8 __ __ INY
+0ab1 : 91 23 __ STA (SP + 0),y
+0ab3 : a9 85 __ LDA #$85
+0ab5 : c8 __ __ INY
+0ab6 : 91 23 __ STA (SP + 0),y
+0ab8 : a9 ff __ LDA #$ff
+0aba : c8 __ __ INY
+0abb : 91 23 __ STA (SP + 0),y
+0abd : a9 25 __ LDA #$25
+0abf : c8 __ __ INY
+0ac0 : 91 23 __ STA (SP + 0),y
+0ac2 : a9 1e __ LDA #$1e
+0ac4 : c8 __ __ INY
+0ac5 : 91 23 __ STA (SP + 0),y
+0ac7 : a9 ef __ LDA #$ef
+0ac9 : c8 __ __ INY
+0aca : 91 23 __ STA (SP + 0),y
+0acc : a9 be __ LDA #$be
+0ace : c8 __ __ INY
+0acf : 91 23 __ STA (SP + 0),y
+0ad1 : 20 7d 0b JSR $0b7d ; (sprintf + 0)
+0ad4 : a9 20 __ LDA #$20
+0ad6 : 85 0d __ STA P0
+0ad8 : a9 23 __ LDA #$23
+0ada : 85 0e __ STA P1
+0adc : a9 58 __ LDA #$58
+0ade : 85 0f __ STA P2
+0ae0 : a9 1e __ LDA #$1e
+0ae2 : 85 10 __ STA P3
+0ae4 : 20 29 1e JSR $1e29 ; (strcmp + 0)
+0ae7 : a5 1b __ LDA ACCU + 0
+0ae9 : 05 1c __ ORA ACCU + 1
+0aeb : d0 21 __ BNE $0b0e
+0aed : a5 65 __ LDA T0 + 0
+0aef : 05 66 __ ORA T0 + 1
+0af1 : f0 16 __ BEQ $0b09
+0af3 : a9 00 __ LDA #$00
+0af5 : 85 1b __ STA ACCU + 0
+0af7 : a9 00 __ LDA #$00
+0af9 : 85 1c __ STA ACCU + 1
+0afb : 18 __ __ CLC
+0afc : a5 23 __ LDA SP + 0
+0afe : 69 12 __ ADC #$12
+0b00 : 85 23 __ STA SP + 0
+0b02 : a5 24 __ LDA SP + 1
+0b04 : 69 00 __ ADC #$00
+0b06 : 85 24 __ STA SP + 1
+0b08 : 60 __ __ RTS
+0b09 : a9 01 __ LDA #$01
+0b0b : 4c f5 0a JMP $0af5 ; (main + 501)
+0b0e : a9 01 __ LDA #$01
+0b10 : 4c f5 0a JMP $0af5 ; (main + 501)
+0b13 : 18 __ __ CLC
+0b14 : a9 20 __ LDA #$20
+0b16 : 65 67 __ ADC T1 + 0
+0b18 : 85 45 __ STA T4 + 0
+0b1a : a9 23 __ LDA #$23
+0b1c : 65 68 __ ADC T1 + 1
+0b1e : 85 46 __ STA T4 + 1
+0b20 : e6 67 __ INC T1 + 0
+0b22 : d0 02 __ BNE $0b26
+0b24 : e6 68 __ INC T1 + 1
+0b26 : a0 01 __ LDY #$01
+0b28 : b1 45 __ LDA (T4 + 0),y
+0b2a : d0 e7 __ BNE $0b13
+0b2c : 4c 86 0a JMP $0a86 ; (main + 390)
+0b2f : a9 00 __ LDA #$00
+0b31 : 85 43 __ STA T2 + 0
+0b33 : 85 44 __ STA T2 + 1
+0b35 : 18 __ __ CLC
+0b36 : a9 21 __ LDA #$21
+0b38 : 65 43 __ ADC T2 + 0
+0b3a : 85 47 __ STA T5 + 0
+0b3c : a9 23 __ LDA #$23
+0b3e : 69 00 __ ADC #$00
+0b40 : 85 48 __ STA T5 + 1
+0b42 : 18 __ __ CLC
+0b43 : a4 43 __ LDY T2 + 0
+0b45 : b9 20 23 LDA $2320,y ; (buffer + 0)
+0b48 : 65 65 __ ADC T0 + 0
+0b4a : 85 65 __ STA T0 + 0
+0b4c : a9 00 __ LDA #$00
+0b4e : 65 66 __ ADC T0 + 1
+0b50 : 85 66 __ STA T0 + 1
+0b52 : a0 00 __ LDY #$00
+0b54 : e6 43 __ INC T2 + 0
+0b56 : d0 02 __ BNE $0b5a
+0b58 : e6 44 __ INC T2 + 1
+0b5a : b1 47 __ LDA (T5 + 0),y
+0b5c : d0 d7 __ BNE $0b35
+0b5e : 4c d0 09 JMP $09d0 ; (main + 208)
+0b61 : 18 __ __ CLC
+0b62 : a9 20 __ LDA #$20
+0b64 : 65 43 __ ADC T2 + 0
+0b66 : 85 47 __ STA T5 + 0
+0b68 : a9 23 __ LDA #$23
+0b6a : 65 44 __ ADC T2 + 1
+0b6c : 85 48 __ STA T5 + 1
+0b6e : e6 43 __ INC T2 + 0
+0b70 : d0 02 __ BNE $0b74
+0b72 : e6 44 __ INC T2 + 1
+0b74 : a0 01 __ LDY #$01
+0b76 : b1 47 __ LDA (T5 + 0),y
+0b78 : d0 e7 __ BNE $0b61
+0b7a : 4c bb 09 JMP $09bb ; (main + 187)
+--------------------------------------------------------------------
+sprintf:
+0b7d : a9 00 __ LDA #$00
+0b7f : 85 43 __ STA T0 + 0
+0b81 : a0 04 __ LDY #$04
+0b83 : b1 23 __ LDA (SP + 0),y
+0b85 : 85 45 __ STA T1 + 0
+0b87 : c8 __ __ INY
+0b88 : b1 23 __ LDA (SP + 0),y
+0b8a : 85 46 __ STA T1 + 1
+0b8c : a0 00 __ LDY #$00
+0b8e : b1 45 __ LDA (T1 + 0),y
+0b90 : 85 47 __ STA T2 + 0
+0b92 : a0 02 __ LDY #$02
+0b94 : b1 23 __ LDA (SP + 0),y
+0b96 : 85 49 __ STA T3 + 0
+0b98 : c8 __ __ INY
+0b99 : b1 23 __ LDA (SP + 0),y
+0b9b : 85 4a __ STA T3 + 1
+0b9d : a5 47 __ LDA T2 + 0
+0b9f : d0 37 __ BNE $0bd8
+0ba1 : 18 __ __ CLC
+0ba2 : a5 49 __ LDA T3 + 0
+0ba4 : 65 43 __ ADC T0 + 0
+0ba6 : 85 45 __ STA T1 + 0
+0ba8 : a5 4a __ LDA T3 + 1
+0baa : 69 00 __ ADC #$00
+0bac : 85 46 __ STA T1 + 1
+0bae : a9 00 __ LDA #$00
+0bb0 : a4 43 __ LDY T0 + 0
+0bb2 : 91 49 __ STA (T3 + 0),y
+0bb4 : 98 __ __ TYA
+0bb5 : d0 08 __ BNE $0bbf
+0bb7 : a5 49 __ LDA T3 + 0
+0bb9 : 85 45 __ STA T1 + 0
+0bbb : a5 4a __ LDA T3 + 1
+0bbd : 85 46 __ STA T1 + 1
+0bbf : a0 02 __ LDY #$02
+0bc1 : b1 23 __ LDA (SP + 0),y
+0bc3 : 85 49 __ STA T3 + 0
+0bc5 : c8 __ __ INY
+0bc6 : b1 23 __ LDA (SP + 0),y
+0bc8 : 85 4a __ STA T3 + 1
+0bca : 38 __ __ SEC
+0bcb : a5 45 __ LDA T1 + 0
+0bcd : e5 49 __ SBC T3 + 0
+0bcf : 85 1b __ STA ACCU + 0
+0bd1 : a5 46 __ LDA T1 + 1
+0bd3 : e5 4a __ SBC T3 + 1
+0bd5 : 85 1c __ STA ACCU + 1
+0bd7 : 60 __ __ RTS
+0bd8 : 18 __ __ CLC
+0bd9 : a5 23 __ LDA SP + 0
+0bdb : 69 06 __ ADC #$06
+0bdd : 85 4b __ STA T4 + 0
+0bdf : a5 24 __ LDA SP + 1
+0be1 : 69 00 __ ADC #$00
+0be3 : 85 4c __ STA T4 + 1
+0be5 : e6 45 __ INC T1 + 0
+0be7 : d0 02 __ BNE $0beb
+0be9 : e6 46 __ INC T1 + 1
+0beb : a5 47 __ LDA T2 + 0
+0bed : c9 25 __ CMP #$25
+0bef : f0 3d __ BEQ $0c2e
+0bf1 : a4 43 __ LDY T0 + 0
+0bf3 : 91 49 __ STA (T3 + 0),y
+0bf5 : e6 43 __ INC T0 + 0
+0bf7 : a5 43 __ LDA T0 + 0
+0bf9 : c9 28 __ CMP #$28
+0bfb : a0 00 __ LDY #$00
+0bfd : 90 20 __ BCC $0c1f
+0bff : 18 __ __ CLC
+0c00 : 65 49 __ ADC T3 + 0
+0c02 : 85 49 __ STA T3 + 0
+0c04 : 90 02 __ BCC $0c08
+0c06 : e6 4a __ INC T3 + 1
+0c08 : a9 00 __ LDA #$00
+0c0a : 85 43 __ STA T0 + 0
+0c0c : b1 45 __ LDA (T1 + 0),y
+0c0e : 85 4d __ STA T5 + 0
+0c10 : e6 45 __ INC T1 + 0
+0c12 : d0 02 __ BNE $0c16
+0c14 : e6 46 __ INC T1 + 1
+0c16 : a5 4d __ LDA T5 + 0
+0c18 : 85 47 __ STA T2 + 0
+0c1a : d0 cf __ BNE $0beb
+0c1c : 4c a1 0b JMP $0ba1 ; (sprintf + 36)
+0c1f : a0 00 __ LDY #$00
+0c21 : b1 45 __ LDA (T1 + 0),y
+0c23 : 85 4d __ STA T5 + 0
+0c25 : e6 45 __ INC T1 + 0
+0c27 : d0 02 __ BNE $0c2b
+0c29 : e6 46 __ INC T1 + 1
+0c2b : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+0c2e : a5 43 __ LDA T0 + 0
+0c30 : f0 0d __ BEQ $0c3f
+0c32 : 18 __ __ CLC
+0c33 : 65 49 __ ADC T3 + 0
+0c35 : 85 49 __ STA T3 + 0
+0c37 : 90 02 __ BCC $0c3b
+0c39 : e6 4a __ INC T3 + 1
+0c3b : a9 00 __ LDA #$00
+0c3d : 85 43 __ STA T0 + 0
+0c3f : a0 00 __ LDY #$00
+0c41 : b1 45 __ LDA (T1 + 0),y
+0c43 : 85 47 __ STA T2 + 0
+0c45 : a9 0a __ LDA #$0a
+0c47 : 8d 87 23 STA $2387 ; (sframe + 3)
+0c4a : a9 00 __ LDA #$00
+0c4c : 8d 88 23 STA $2388 ; (sframe + 4)
+0c4f : a9 01 __ LDA #$01
+0c51 : 8d 85 23 STA $2385 ; (sframe + 1)
+0c54 : a9 ff __ LDA #$ff
+0c56 : 8d 86 23 STA $2386 ; (sframe + 2)
+0c59 : a9 20 __ LDA #$20
+0c5b : 8d 84 23 STA $2384 ; (sframe + 0)
+0c5e : a9 00 __ LDA #$00
+0c60 : 8d 89 23 STA $2389 ; (sframe + 5)
+0c63 : 8d 8a 23 STA $238a ; (sframe + 6)
+0c66 : 8d 8b 23 STA $238b ; (sframe + 7)
+0c69 : e6 45 __ INC T1 + 0
+0c6b : d0 02 __ BNE $0c6f
+0c6d : e6 46 __ INC T1 + 1
+0c6f : a5 47 __ LDA T2 + 0
+0c71 : c9 2b __ CMP #$2b
+0c73 : d0 03 __ BNE $0c78
+0c75 : 4c ec 1d JMP $1dec ; (sprintf + 4719)
+0c78 : c9 30 __ CMP #$30
+0c7a : d0 03 __ BNE $0c7f
+0c7c : 4c de 1d JMP $1dde ; (sprintf + 4705)
+0c7f : c9 23 __ CMP #$23
+0c81 : d0 03 __ BNE $0c86
+0c83 : 4c d0 1d JMP $1dd0 ; (sprintf + 4691)
+0c86 : c9 30 __ CMP #$30
+0c88 : 90 66 __ BCC $0cf0
+0c8a : a9 39 __ LDA #$39
+0c8c : c5 47 __ CMP T2 + 0
+0c8e : 90 60 __ BCC $0cf0
+0c90 : a9 00 __ LDA #$00
+0c92 : 85 4f __ STA T6 + 0
+0c94 : 85 50 __ STA T6 + 1
+0c96 : a5 47 __ LDA T2 + 0
+0c98 : c9 30 __ CMP #$30
+0c9a : 90 4f __ BCC $0ceb
+0c9c : a9 39 __ LDA #$39
+0c9e : c5 47 __ CMP T2 + 0
+0ca0 : 90 49 __ BCC $0ceb
+0ca2 : a5 47 __ LDA T2 + 0
+0ca4 : 85 51 __ STA T7 + 0
+0ca6 : a0 00 __ LDY #$00
+0ca8 : b1 45 __ LDA (T1 + 0),y
+0caa : 85 47 __ STA T2 + 0
+0cac : e6 45 __ INC T1 + 0
+0cae : d0 02 __ BNE $0cb2
+0cb0 : e6 46 __ INC T1 + 1
+0cb2 : a5 4f __ LDA T6 + 0
+0cb4 : 0a __ __ ASL
+0cb5 : 85 07 __ STA $07
+0cb7 : a5 50 __ LDA T6 + 1
+0cb9 : 2a __ __ ROL
+0cba : 06 07 __ ASL $07
+0cbc : 2a __ __ ROL
+0cbd : 85 08 __ STA $08
+0cbf : 18 __ __ CLC
+0cc0 : a5 07 __ LDA $07
+0cc2 : 65 4f __ ADC T6 + 0
+0cc4 : 85 1b __ STA ACCU + 0
+0cc6 : a5 08 __ LDA $08
+0cc8 : 65 50 __ ADC T6 + 1
+0cca : 06 1b __ ASL ACCU + 0
+0ccc : 2a __ __ ROL
+0ccd : 85 1c __ STA ACCU + 1
+0ccf : 18 __ __ CLC
+0cd0 : a5 1b __ LDA ACCU + 0
+0cd2 : 65 51 __ ADC T7 + 0
+0cd4 : aa __ __ TAX
+0cd5 : a5 1c __ LDA ACCU + 1
+0cd7 : 69 00 __ ADC #$00
+0cd9 : a8 __ __ TAY
+0cda : 38 __ __ SEC
+0cdb : 8a __ __ TXA
+0cdc : e9 30 __ SBC #$30
+0cde : 85 4f __ STA T6 + 0
+0ce0 : 98 __ __ TYA
+0ce1 : e9 00 __ SBC #$00
+0ce3 : 85 50 __ STA T6 + 1
+0ce5 : a5 47 __ LDA T2 + 0
+0ce7 : c9 30 __ CMP #$30
+0ce9 : b0 b1 __ BCS $0c9c
+0ceb : a5 4f __ LDA T6 + 0
+0ced : 8d 85 23 STA $2385 ; (sframe + 1)
+0cf0 : a5 47 __ LDA T2 + 0
+0cf2 : c9 2e __ CMP #$2e
+0cf4 : d0 03 __ BNE $0cf9
+0cf6 : 4c 61 1d JMP $1d61 ; (sprintf + 4580)
+0cf9 : a5 47 __ LDA T2 + 0
+0cfb : c9 64 __ CMP #$64
+0cfd : d0 03 __ BNE $0d02
+0cff : 4c e3 1b JMP $1be3 ; (sprintf + 4198)
+0d02 : c9 75 __ CMP #$75
+0d04 : d0 03 __ BNE $0d09
+0d06 : 4c a3 1a JMP $1aa3 ; (sprintf + 3878)
+0d09 : c9 78 __ CMP #$78
+0d0b : d0 03 __ BNE $0d10
+0d0d : 4c 59 19 JMP $1959 ; (sprintf + 3548)
+0d10 : c9 6c __ CMP #$6c
+0d12 : d0 03 __ BNE $0d17
+0d14 : 4c 16 14 JMP $1416 ; (sprintf + 2201)
+0d17 : c9 66 __ CMP #$66
+0d19 : d0 03 __ BNE $0d1e
+0d1b : 4c b9 0d JMP $0db9 ; (sprintf + 572)
+0d1e : c9 67 __ CMP #$67
+0d20 : d0 03 __ BNE $0d25
+0d22 : 4c b9 0d JMP $0db9 ; (sprintf + 572)
+0d25 : c9 65 __ CMP #$65
+0d27 : d0 03 __ BNE $0d2c
+0d29 : 4c b9 0d JMP $0db9 ; (sprintf + 572)
+0d2c : c9 73 __ CMP #$73
+0d2e : f0 46 __ BEQ $0d76
+0d30 : c9 63 __ CMP #$63
+0d32 : f0 1e __ BEQ $0d52
+0d34 : 09 00 __ ORA #$00
+0d36 : d0 03 __ BNE $0d3b
+0d38 : 4c 1f 0c JMP $0c1f ; (sprintf + 162)
+0d3b : a5 47 __ LDA T2 + 0
+0d3d : a4 43 __ LDY T0 + 0
+0d3f : 91 49 __ STA (T3 + 0),y
+0d41 : e6 43 __ INC T0 + 0
+0d43 : a0 00 __ LDY #$00
+0d45 : b1 45 __ LDA (T1 + 0),y
+0d47 : 85 4d __ STA T5 + 0
+0d49 : e6 45 __ INC T1 + 0
+0d4b : d0 02 __ BNE $0d4f
+0d4d : e6 46 __ INC T1 + 1
+0d4f : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+0d52 : a0 00 __ LDY #$00
+0d54 : b1 4b __ LDA (T4 + 0),y
+0d56 : a4 43 __ LDY T0 + 0
+0d58 : 91 49 __ STA (T3 + 0),y
+0d5a : 18 __ __ CLC
+0d5b : a5 4b __ LDA T4 + 0
+0d5d : 69 02 __ ADC #$02
+0d5f : 85 4b __ STA T4 + 0
+0d61 : 90 02 __ BCC $0d65
+0d63 : e6 4c __ INC T4 + 1
+0d65 : e6 43 __ INC T0 + 0
+0d67 : a0 00 __ LDY #$00
+0d69 : b1 45 __ LDA (T1 + 0),y
+0d6b : 85 4d __ STA T5 + 0
+0d6d : e6 45 __ INC T1 + 0
+0d6f : d0 02 __ BNE $0d73
+0d71 : e6 46 __ INC T1 + 1
+0d73 : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+0d76 : a0 00 __ LDY #$00
+0d78 : b1 4b __ LDA (T4 + 0),y
+0d7a : 85 4f __ STA T6 + 0
+0d7c : c8 __ __ INY
+0d7d : b1 4b __ LDA (T4 + 0),y
+0d7f : 85 50 __ STA T6 + 1
+0d81 : 18 __ __ CLC
+0d82 : a5 4b __ LDA T4 + 0
+0d84 : 69 02 __ ADC #$02
+0d86 : 85 4b __ STA T4 + 0
+0d88 : 90 02 __ BCC $0d8c
+0d8a : e6 4c __ INC T4 + 1
+0d8c : 88 __ __ DEY
+0d8d : b1 4f __ LDA (T6 + 0),y
+0d8f : 85 47 __ STA T2 + 0
+0d91 : d0 03 __ BNE $0d96
+0d93 : 4c 1f 0c JMP $0c1f ; (sprintf + 162)
+0d96 : e6 4f __ INC T6 + 0
+0d98 : d0 02 __ BNE $0d9c
+0d9a : e6 50 __ INC T6 + 1
+0d9c : a5 47 __ LDA T2 + 0
+0d9e : a0 00 __ LDY #$00
+0da0 : 91 49 __ STA (T3 + 0),y
+0da2 : e6 49 __ INC T3 + 0
+0da4 : d0 02 __ BNE $0da8
+0da6 : e6 4a __ INC T3 + 1
+0da8 : b1 4f __ LDA (T6 + 0),y
+0daa : aa __ __ TAX
+0dab : e6 4f __ INC T6 + 0
+0dad : d0 02 __ BNE $0db1
+0daf : e6 50 __ INC T6 + 1
+0db1 : 8a __ __ TXA
+0db2 : 86 47 __ STX T2 + 0
+0db4 : d0 e6 __ BNE $0d9c
+0db6 : 4c 1f 0c JMP $0c1f ; (sprintf + 162)
+0db9 : a0 00 __ LDY #$00
+0dbb : b1 4b __ LDA (T4 + 0),y
+0dbd : 85 58 __ STA T11 + 0
+0dbf : 85 03 __ STA $03
+0dc1 : c8 __ __ INY
+0dc2 : b1 4b __ LDA (T4 + 0),y
+0dc4 : 85 59 __ STA T11 + 1
+0dc6 : 85 04 __ STA $04
+0dc8 : c8 __ __ INY
+0dc9 : b1 4b __ LDA (T4 + 0),y
+0dcb : 85 5a __ STA T11 + 2
+0dcd : 85 05 __ STA $05
+0dcf : c8 __ __ INY
+0dd0 : b1 4b __ LDA (T4 + 0),y
+0dd2 : 85 5b __ STA T11 + 3
+0dd4 : 85 06 __ STA $06
+0dd6 : a5 47 __ LDA T2 + 0
+0dd8 : 85 43 __ STA T0 + 0
+0dda : a5 49 __ LDA T3 + 0
+0ddc : 85 4f __ STA T6 + 0
+0dde : a5 4a __ LDA T3 + 1
+0de0 : 85 50 __ STA T6 + 1
+0de2 : a9 00 __ LDA #$00
+0de4 : 85 1b __ STA ACCU + 0
+0de6 : 85 1c __ STA ACCU + 1
+0de8 : 85 1d __ STA ACCU + 2
+0dea : 85 1e __ STA ACCU + 3
+0dec : 20 77 22 JSR $2277 ; (fcmp + 0)
+0def : 10 03 __ BPL $0df4
+0df1 : 4c 03 14 JMP $1403 ; (sprintf + 2182)
+0df4 : a9 00 __ LDA #$00
+0df6 : 85 47 __ STA T2 + 0
+0df8 : ad 89 23 LDA $2389 ; (sframe + 5)
+0dfb : f0 0a __ BEQ $0e07
+0dfd : a9 2b __ LDA #$2b
+0dff : a0 00 __ LDY #$00
+0e01 : 91 49 __ STA (T3 + 0),y
+0e03 : a9 01 __ LDA #$01
+0e05 : 85 47 __ STA T2 + 0
+0e07 : a9 00 __ LDA #$00
+0e09 : 85 51 __ STA T7 + 0
+0e0b : 85 52 __ STA T7 + 1
+0e0d : ad 86 23 LDA $2386 ; (sframe + 2)
+0e10 : 85 4d __ STA T5 + 0
+0e12 : c9 ff __ CMP #$ff
+0e14 : d0 04 __ BNE $0e1a
+0e16 : a9 06 __ LDA #$06
+0e18 : 85 4d __ STA T5 + 0
+0e1a : a9 00 __ LDA #$00
+0e1c : 85 1b __ STA ACCU + 0
+0e1e : 85 1c __ STA ACCU + 1
+0e20 : 85 1d __ STA ACCU + 2
+0e22 : 85 1e __ STA ACCU + 3
+0e24 : a5 58 __ LDA T11 + 0
+0e26 : 85 03 __ STA $03
+0e28 : a5 59 __ LDA T11 + 1
+0e2a : 85 04 __ STA $04
+0e2c : a5 5a __ LDA T11 + 2
+0e2e : 85 05 __ STA $05
+0e30 : a5 5b __ LDA T11 + 3
+0e32 : 85 06 __ STA $06
+0e34 : 20 77 22 JSR $2277 ; (fcmp + 0)
+0e37 : d0 03 __ BNE $0e3c
+0e39 : 4c b0 0f JMP $0fb0 ; (sprintf + 1075)
+0e3c : a9 00 __ LDA #$00
+0e3e : 85 1b __ STA ACCU + 0
+0e40 : 85 1c __ STA ACCU + 1
+0e42 : a9 7a __ LDA #$7a
+0e44 : 85 1d __ STA ACCU + 2
+0e46 : a9 44 __ LDA #$44
+0e48 : 85 1e __ STA ACCU + 3
+0e4a : a5 58 __ LDA T11 + 0
+0e4c : 85 03 __ STA $03
+0e4e : a5 59 __ LDA T11 + 1
+0e50 : 85 04 __ STA $04
+0e52 : a5 5a __ LDA T11 + 2
+0e54 : 85 05 __ STA $05
+0e56 : a5 5b __ LDA T11 + 3
+0e58 : 85 06 __ STA $06
+0e5a : 20 77 22 JSR $2277 ; (fcmp + 0)
+0e5d : 30 5a __ BMI $0eb9
+0e5f : 18 __ __ CLC
+0e60 : a5 51 __ LDA T7 + 0
+0e62 : 69 03 __ ADC #$03
+0e64 : 85 51 __ STA T7 + 0
+0e66 : 90 02 __ BCC $0e6a
+0e68 : e6 52 __ INC T7 + 1
+0e6a : a5 58 __ LDA T11 + 0
+0e6c : 85 1b __ STA ACCU + 0
+0e6e : a5 59 __ LDA T11 + 1
+0e70 : 85 1c __ STA ACCU + 1
+0e72 : a5 5a __ LDA T11 + 2
+0e74 : 85 1d __ STA ACCU + 2
+0e76 : a5 5b __ LDA T11 + 3
+0e78 : 85 1e __ STA ACCU + 3
+0e7a : a9 00 __ LDA #$00
+0e7c : 85 03 __ STA $03
+0e7e : 85 04 __ STA $04
+0e80 : a9 7a __ LDA #$7a
+0e82 : 85 05 __ STA $05
+0e84 : a9 44 __ LDA #$44
+0e86 : 85 06 __ STA $06
+0e88 : 20 ab 1e JSR $1eab ; (freg + 20)
+0e8b : 20 42 20 JSR $2042 ; (fdiv + 0)
+0e8e : a5 1b __ LDA ACCU + 0
+0e90 : 85 58 __ STA T11 + 0
+0e92 : 85 03 __ STA $03
+0e94 : a5 1c __ LDA ACCU + 1
+0e96 : 85 59 __ STA T11 + 1
+0e98 : 85 04 __ STA $04
+0e9a : a5 1d __ LDA ACCU + 2
+0e9c : 85 5a __ STA T11 + 2
+0e9e : 85 05 __ STA $05
+0ea0 : a5 1e __ LDA ACCU + 3
+0ea2 : 85 5b __ STA T11 + 3
+0ea4 : 85 06 __ STA $06
+0ea6 : a9 00 __ LDA #$00
+0ea8 : 85 1b __ STA ACCU + 0
+0eaa : 85 1c __ STA ACCU + 1
+0eac : a9 7a __ LDA #$7a
+0eae : 85 1d __ STA ACCU + 2
+0eb0 : a9 44 __ LDA #$44
+0eb2 : 85 1e __ STA ACCU + 3
+0eb4 : 20 77 22 JSR $2277 ; (fcmp + 0)
+0eb7 : 10 a6 __ BPL $0e5f
+0eb9 : a9 00 __ LDA #$00
+0ebb : 85 1b __ STA ACCU + 0
+0ebd : 85 1c __ STA ACCU + 1
+0ebf : a9 80 __ LDA #$80
+0ec1 : 85 1d __ STA ACCU + 2
+0ec3 : a9 3f __ LDA #$3f
+0ec5 : 85 1e __ STA ACCU + 3
+0ec7 : a5 58 __ LDA T11 + 0
+0ec9 : 85 03 __ STA $03
+0ecb : a5 59 __ LDA T11 + 1
+0ecd : 85 04 __ STA $04
+0ecf : a5 5a __ LDA T11 + 2
+0ed1 : 85 05 __ STA $05
+0ed3 : a5 5b __ LDA T11 + 3
+0ed5 : 85 06 __ STA $06
+0ed7 : 20 77 22 JSR $2277 ; (fcmp + 0)
+0eda : 10 5c __ BPL $0f38
+0edc : 38 __ __ SEC
+0edd : a5 51 __ LDA T7 + 0
+0edf : e9 03 __ SBC #$03
+0ee1 : 85 51 __ STA T7 + 0
+0ee3 : a5 52 __ LDA T7 + 1
+0ee5 : e9 00 __ SBC #$00
+0ee7 : 85 52 __ STA T7 + 1
+0ee9 : a5 58 __ LDA T11 + 0
+0eeb : 85 1b __ STA ACCU + 0
+0eed : a5 59 __ LDA T11 + 1
+0eef : 85 1c __ STA ACCU + 1
+0ef1 : a5 5a __ LDA T11 + 2
+0ef3 : 85 1d __ STA ACCU + 2
+0ef5 : a5 5b __ LDA T11 + 3
+0ef7 : 85 1e __ STA ACCU + 3
+0ef9 : a9 00 __ LDA #$00
+0efb : 85 03 __ STA $03
+0efd : 85 04 __ STA $04
+0eff : a9 7a __ LDA #$7a
+0f01 : 85 05 __ STA $05
+0f03 : a9 44 __ LDA #$44
+0f05 : 85 06 __ STA $06
+0f07 : 20 ab 1e JSR $1eab ; (freg + 20)
+0f0a : 20 a4 1f JSR $1fa4 ; (fmul + 0)
+0f0d : a5 1b __ LDA ACCU + 0
+0f0f : 85 58 __ STA T11 + 0
+0f11 : 85 03 __ STA $03
+0f13 : a5 1c __ LDA ACCU + 1
+0f15 : 85 59 __ STA T11 + 1
+0f17 : 85 04 __ STA $04
+0f19 : a5 1d __ LDA ACCU + 2
+0f1b : 85 5a __ STA T11 + 2
+0f1d : 85 05 __ STA $05
+0f1f : a5 1e __ LDA ACCU + 3
+0f21 : 85 5b __ STA T11 + 3
+0f23 : 85 06 __ STA $06
+0f25 : a9 00 __ LDA #$00
+0f27 : 85 1b __ STA ACCU + 0
+0f29 : 85 1c __ STA ACCU + 1
+0f2b : a9 80 __ LDA #$80
+0f2d : 85 1d __ STA ACCU + 2
+0f2f : a9 3f __ LDA #$3f
+0f31 : 85 1e __ STA ACCU + 3
+0f33 : 20 77 22 JSR $2277 ; (fcmp + 0)
+0f36 : 30 a4 __ BMI $0edc
+0f38 : a9 00 __ LDA #$00
+0f3a : 85 1b __ STA ACCU + 0
+0f3c : 85 1c __ STA ACCU + 1
+0f3e : a9 20 __ LDA #$20
+0f40 : 85 1d __ STA ACCU + 2
+0f42 : a9 41 __ LDA #$41
+0f44 : 85 1e __ STA ACCU + 3
+0f46 : a5 58 __ LDA T11 + 0
+0f48 : 85 03 __ STA $03
+0f4a : a5 59 __ LDA T11 + 1
+0f4c : 85 04 __ STA $04
+0f4e : a5 5a __ LDA T11 + 2
+0f50 : 85 05 __ STA $05
+0f52 : a5 5b __ LDA T11 + 3
+0f54 : 85 06 __ STA $06
+0f56 : 20 77 22 JSR $2277 ; (fcmp + 0)
+0f59 : 30 55 __ BMI $0fb0
+0f5b : e6 51 __ INC T7 + 0
+0f5d : d0 02 __ BNE $0f61
+0f5f : e6 52 __ INC T7 + 1
+0f61 : a5 58 __ LDA T11 + 0
+0f63 : 85 1b __ STA ACCU + 0
+0f65 : a5 59 __ LDA T11 + 1
+0f67 : 85 1c __ STA ACCU + 1
+0f69 : a5 5a __ LDA T11 + 2
+0f6b : 85 1d __ STA ACCU + 2
+0f6d : a5 5b __ LDA T11 + 3
+0f6f : 85 1e __ STA ACCU + 3
+0f71 : a9 00 __ LDA #$00
+0f73 : 85 03 __ STA $03
+0f75 : 85 04 __ STA $04
+0f77 : a9 20 __ LDA #$20
+0f79 : 85 05 __ STA $05
+0f7b : a9 41 __ LDA #$41
+0f7d : 85 06 __ STA $06
+0f7f : 20 ab 1e JSR $1eab ; (freg + 20)
+0f82 : 20 42 20 JSR $2042 ; (fdiv + 0)
+0f85 : a5 1b __ LDA ACCU + 0
+0f87 : 85 58 __ STA T11 + 0
+0f89 : 85 03 __ STA $03
+0f8b : a5 1c __ LDA ACCU + 1
+0f8d : 85 59 __ STA T11 + 1
+0f8f : 85 04 __ STA $04
+0f91 : a5 1d __ LDA ACCU + 2
+0f93 : 85 5a __ STA T11 + 2
+0f95 : 85 05 __ STA $05
+0f97 : a5 1e __ LDA ACCU + 3
+0f99 : 85 5b __ STA T11 + 3
+0f9b : 85 06 __ STA $06
+0f9d : a9 00 __ LDA #$00
+0f9f : 85 1b __ STA ACCU + 0
+0fa1 : 85 1c __ STA ACCU + 1
+0fa3 : a9 20 __ LDA #$20
+0fa5 : 85 1d __ STA ACCU + 2
+0fa7 : a9 41 __ LDA #$41
+0fa9 : 85 1e __ STA ACCU + 3
+0fab : 20 77 22 JSR $2277 ; (fcmp + 0)
+0fae : 10 ab __ BPL $0f5b
+0fb0 : a5 43 __ LDA T0 + 0
+0fb2 : c9 65 __ CMP #$65
+0fb4 : d0 03 __ BNE $0fb9
+0fb6 : 4c fe 13 JMP $13fe ; (sprintf + 2177)
+0fb9 : a9 00 __ LDA #$00
+0fbb : 85 57 __ STA T10 + 0
+0fbd : 85 60 __ STA T13 + 0
+0fbf : a5 4d __ LDA T5 + 0
+0fc1 : 85 53 __ STA T8 + 0
+0fc3 : e6 53 __ INC T8 + 0
+0fc5 : a5 43 __ LDA T0 + 0
+0fc7 : c9 67 __ CMP #$67
+0fc9 : d0 03 __ BNE $0fce
+0fcb : 4c e1 13 JMP $13e1 ; (sprintf + 2148)
+0fce : a5 57 __ LDA T10 + 0
+0fd0 : f0 03 __ BEQ $0fd5
+0fd2 : 4c ef 12 JMP $12ef ; (sprintf + 1906)
+0fd5 : a5 52 __ LDA T7 + 1
+0fd7 : 10 03 __ BPL $0fdc
+0fd9 : 4c ae 12 JMP $12ae ; (sprintf + 1841)
+0fdc : a9 00 __ LDA #$00
+0fde : 85 5c __ STA T12 + 0
+0fe0 : 85 5d __ STA T12 + 1
+0fe2 : 85 5e __ STA T12 + 2
+0fe4 : a9 3f __ LDA #$3f
+0fe6 : 85 5f __ STA T12 + 3
+0fe8 : 18 __ __ CLC
+0fe9 : a5 4d __ LDA T5 + 0
+0feb : 65 51 __ ADC T7 + 0
+0fed : 85 53 __ STA T8 + 0
+0fef : e6 53 __ INC T8 + 0
+0ff1 : a9 01 __ LDA #$01
+0ff3 : c5 53 __ CMP T8 + 0
+0ff5 : b0 03 __ BCS $0ffa
+0ff7 : 4c 6d 12 JMP $126d ; (sprintf + 1776)
+0ffa : a5 58 __ LDA T11 + 0
+0ffc : 85 1b __ STA ACCU + 0
+0ffe : a5 59 __ LDA T11 + 1
+1000 : 85 1c __ STA ACCU + 1
+1002 : a5 5a __ LDA T11 + 2
+1004 : 85 1d __ STA ACCU + 2
+1006 : a5 5b __ LDA T11 + 3
+1008 : 85 1e __ STA ACCU + 3
+100a : a5 5c __ LDA T12 + 0
+100c : 85 03 __ STA $03
+100e : a5 5d __ LDA T12 + 1
+1010 : 85 04 __ STA $04
+1012 : a5 5e __ LDA T12 + 2
+1014 : 85 05 __ STA $05
+1016 : a5 5f __ LDA T12 + 3
+1018 : 85 06 __ STA $06
+101a : 20 ab 1e JSR $1eab ; (freg + 20)
+101d : 20 dc 1e JSR $1edc ; (faddsub + 0)
+1020 : a5 1b __ LDA ACCU + 0
+1022 : 85 5c __ STA T12 + 0
+1024 : 85 58 __ STA T11 + 0
+1026 : 85 03 __ STA $03
+1028 : a5 1c __ LDA ACCU + 1
+102a : 85 5d __ STA T12 + 1
+102c : 85 59 __ STA T11 + 1
+102e : 85 04 __ STA $04
+1030 : a5 1d __ LDA ACCU + 2
+1032 : 85 5e __ STA T12 + 2
+1034 : 85 5a __ STA T11 + 2
+1036 : 85 05 __ STA $05
+1038 : a5 1e __ LDA ACCU + 3
+103a : 85 5f __ STA T12 + 3
+103c : 85 5b __ STA T11 + 3
+103e : 85 06 __ STA $06
+1040 : a9 00 __ LDA #$00
+1042 : 85 1b __ STA ACCU + 0
+1044 : 85 1c __ STA ACCU + 1
+1046 : a9 20 __ LDA #$20
+1048 : 85 1d __ STA ACCU + 2
+104a : a9 41 __ LDA #$41
+104c : 85 1e __ STA ACCU + 3
+104e : 20 77 22 JSR $2277 ; (fcmp + 0)
+1051 : 30 36 __ BMI $1089
+1053 : a5 58 __ LDA T11 + 0
+1055 : 85 1b __ STA ACCU + 0
+1057 : a5 59 __ LDA T11 + 1
+1059 : 85 1c __ STA ACCU + 1
+105b : a5 5a __ LDA T11 + 2
+105d : 85 1d __ STA ACCU + 2
+105f : a5 5b __ LDA T11 + 3
+1061 : 85 1e __ STA ACCU + 3
+1063 : a9 00 __ LDA #$00
+1065 : 85 03 __ STA $03
+1067 : 85 04 __ STA $04
+1069 : a9 20 __ LDA #$20
+106b : 85 05 __ STA $05
+106d : a9 41 __ LDA #$41
+106f : 85 06 __ STA $06
+1071 : 20 ab 1e JSR $1eab ; (freg + 20)
+1074 : 20 42 20 JSR $2042 ; (fdiv + 0)
+1077 : a5 1b __ LDA ACCU + 0
+1079 : 85 5c __ STA T12 + 0
+107b : a5 1c __ LDA ACCU + 1
+107d : 85 5d __ STA T12 + 1
+107f : a5 1d __ LDA ACCU + 2
+1081 : 85 5e __ STA T12 + 2
+1083 : a5 1e __ LDA ACCU + 3
+1085 : 85 5f __ STA T12 + 3
+1087 : c6 4d __ DEC T5 + 0
+1089 : 38 __ __ SEC
+108a : a5 53 __ LDA T8 + 0
+108c : e5 4d __ SBC T5 + 0
+108e : 85 55 __ STA T9 + 0
+1090 : 85 43 __ STA T0 + 0
+1092 : a9 14 __ LDA #$14
+1094 : c5 53 __ CMP T8 + 0
+1096 : b0 02 __ BCS $109a
+1098 : 85 53 __ STA T8 + 0
+109a : a5 55 __ LDA T9 + 0
+109c : d0 08 __ BNE $10a6
+109e : a9 30 __ LDA #$30
+10a0 : a4 47 __ LDY T2 + 0
+10a2 : 91 4f __ STA (T6 + 0),y
+10a4 : e6 47 __ INC T2 + 0
+10a6 : a9 00 __ LDA #$00
+10a8 : 85 4d __ STA T5 + 0
+10aa : a5 53 __ LDA T8 + 0
+10ac : f0 03 __ BEQ $10b1
+10ae : 4c e0 11 JMP $11e0 ; (sprintf + 1635)
+10b1 : a5 60 __ LDA T13 + 0
+10b3 : f0 03 __ BEQ $10b8
+10b5 : 4c 60 11 JMP $1160 ; (sprintf + 1507)
+10b8 : a5 47 __ LDA T2 + 0
+10ba : cd 85 23 CMP $2385 ; (sframe + 1)
+10bd : 90 1c __ BCC $10db
+10bf : 85 43 __ STA T0 + 0
+10c1 : 18 __ __ CLC
+10c2 : a5 4b __ LDA T4 + 0
+10c4 : 69 04 __ ADC #$04
+10c6 : 85 4b __ STA T4 + 0
+10c8 : 90 02 __ BCC $10cc
+10ca : e6 4c __ INC T4 + 1
+10cc : a0 00 __ LDY #$00
+10ce : b1 45 __ LDA (T1 + 0),y
+10d0 : 85 4d __ STA T5 + 0
+10d2 : e6 45 __ INC T1 + 0
+10d4 : d0 02 __ BNE $10d8
+10d6 : e6 46 __ INC T1 + 1
+10d8 : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+10db : c9 01 __ CMP #$01
+10dd : 90 4b __ BCC $112a
+10df : a9 01 __ LDA #$01
+10e1 : 85 43 __ STA T0 + 0
+10e3 : a5 47 __ LDA T2 + 0
+10e5 : 85 51 __ STA T7 + 0
+10e7 : 38 __ __ SEC
+10e8 : a5 51 __ LDA T7 + 0
+10ea : e5 43 __ SBC T0 + 0
+10ec : 85 55 __ STA T9 + 0
+10ee : a9 00 __ LDA #$00
+10f0 : e9 00 __ SBC #$00
+10f2 : 85 56 __ STA T9 + 1
+10f4 : 18 __ __ CLC
+10f5 : a5 4f __ LDA T6 + 0
+10f7 : 65 55 __ ADC T9 + 0
+10f9 : 85 55 __ STA T9 + 0
+10fb : a5 50 __ LDA T6 + 1
+10fd : 65 56 __ ADC T9 + 1
+10ff : 85 56 __ STA T9 + 1
+1101 : 38 __ __ SEC
+1102 : ad 85 23 LDA $2385 ; (sframe + 1)
+1105 : e5 43 __ SBC T0 + 0
+1107 : 85 53 __ STA T8 + 0
+1109 : a9 00 __ LDA #$00
+110b : e9 00 __ SBC #$00
+110d : 85 54 __ STA T8 + 1
+110f : 18 __ __ CLC
+1110 : a5 4f __ LDA T6 + 0
+1112 : 65 53 __ ADC T8 + 0
+1114 : 85 53 __ STA T8 + 0
+1116 : a5 50 __ LDA T6 + 1
+1118 : 65 54 __ ADC T8 + 1
+111a : 85 54 __ STA T8 + 1
+111c : a0 00 __ LDY #$00
+111e : b1 55 __ LDA (T9 + 0),y
+1120 : 91 53 __ STA (T8 + 0),y
+1122 : e6 43 __ INC T0 + 0
+1124 : a5 47 __ LDA T2 + 0
+1126 : c5 43 __ CMP T0 + 0
+1128 : b0 bd __ BCS $10e7
+112a : a9 00 __ LDA #$00
+112c : 85 43 __ STA T0 + 0
+112e : a5 47 __ LDA T2 + 0
+1130 : 85 51 __ STA T7 + 0
+1132 : ad 85 23 LDA $2385 ; (sframe + 1)
+1135 : 85 47 __ STA T2 + 0
+1137 : 38 __ __ SEC
+1138 : a5 47 __ LDA T2 + 0
+113a : e5 51 __ SBC T7 + 0
+113c : 85 55 __ STA T9 + 0
+113e : a9 00 __ LDA #$00
+1140 : e9 00 __ SBC #$00
+1142 : 85 56 __ STA T9 + 1
+1144 : a9 00 __ LDA #$00
+1146 : c5 56 __ CMP T9 + 1
+1148 : d0 04 __ BNE $114e
+114a : a5 43 __ LDA T0 + 0
+114c : c5 55 __ CMP T9 + 0
+114e : 90 05 __ BCC $1155
+1150 : a5 47 __ LDA T2 + 0
+1152 : 4c bf 10 JMP $10bf ; (sprintf + 1346)
+1155 : a9 20 __ LDA #$20
+1157 : a4 43 __ LDY T0 + 0
+1159 : 91 4f __ STA (T6 + 0),y
+115b : e6 43 __ INC T0 + 0
+115d : 4c 32 11 JMP $1132 ; (sprintf + 1461)
+1160 : a9 45 __ LDA #$45
+1162 : a4 47 __ LDY T2 + 0
+1164 : 91 4f __ STA (T6 + 0),y
+1166 : c8 __ __ INY
+1167 : a5 52 __ LDA T7 + 1
+1169 : 30 5a __ BMI $11c5
+116b : a9 2b __ LDA #$2b
+116d : 91 4f __ STA (T6 + 0),y
+116f : 18 __ __ CLC
+1170 : a5 47 __ LDA T2 + 0
+1172 : 69 02 __ ADC #$02
+1174 : 85 43 __ STA T0 + 0
+1176 : a5 51 __ LDA T7 + 0
+1178 : 85 1b __ STA ACCU + 0
+117a : a5 52 __ LDA T7 + 1
+117c : 85 1c __ STA ACCU + 1
+117e : a9 0a __ LDA #$0a
+1180 : 85 03 __ STA $03
+1182 : a9 00 __ LDA #$00
+1184 : 85 04 __ STA $04
+1186 : 20 02 21 JSR $2102 ; (divs16 + 0)
+1189 : 18 __ __ CLC
+118a : a5 1b __ LDA ACCU + 0
+118c : 69 30 __ ADC #$30
+118e : a4 43 __ LDY T0 + 0
+1190 : 91 4f __ STA (T6 + 0),y
+1192 : c8 __ __ INY
+1193 : 98 __ __ TYA
+1194 : 18 __ __ CLC
+1195 : 65 4f __ ADC T6 + 0
+1197 : 85 53 __ STA T8 + 0
+1199 : a5 50 __ LDA T6 + 1
+119b : 69 00 __ ADC #$00
+119d : 85 54 __ STA T8 + 1
+119f : a5 51 __ LDA T7 + 0
+11a1 : 85 1b __ STA ACCU + 0
+11a3 : a5 52 __ LDA T7 + 1
+11a5 : 85 1c __ STA ACCU + 1
+11a7 : a9 0a __ LDA #$0a
+11a9 : 85 03 __ STA $03
+11ab : a9 00 __ LDA #$00
+11ad : 85 04 __ STA $04
+11af : 20 c1 21 JSR $21c1 ; (mods16 + 0)
+11b2 : 18 __ __ CLC
+11b3 : a5 05 __ LDA $05
+11b5 : 69 30 __ ADC #$30
+11b7 : a0 00 __ LDY #$00
+11b9 : 91 53 __ STA (T8 + 0),y
+11bb : 18 __ __ CLC
+11bc : a5 43 __ LDA T0 + 0
+11be : 69 02 __ ADC #$02
+11c0 : 85 47 __ STA T2 + 0
+11c2 : 4c b8 10 JMP $10b8 ; (sprintf + 1339)
+11c5 : a9 2d __ LDA #$2d
+11c7 : 91 4f __ STA (T6 + 0),y
+11c9 : 18 __ __ CLC
+11ca : a5 47 __ LDA T2 + 0
+11cc : 69 02 __ ADC #$02
+11ce : 85 43 __ STA T0 + 0
+11d0 : 38 __ __ SEC
+11d1 : a9 00 __ LDA #$00
+11d3 : e5 51 __ SBC T7 + 0
+11d5 : 85 51 __ STA T7 + 0
+11d7 : a9 00 __ LDA #$00
+11d9 : e5 52 __ SBC T7 + 1
+11db : 85 52 __ STA T7 + 1
+11dd : 4c 76 11 JMP $1176 ; (sprintf + 1529)
+11e0 : a5 4d __ LDA T5 + 0
+11e2 : c5 43 __ CMP T0 + 0
+11e4 : d0 08 __ BNE $11ee
+11e6 : a9 2e __ LDA #$2e
+11e8 : a4 47 __ LDY T2 + 0
+11ea : 91 4f __ STA (T6 + 0),y
+11ec : e6 47 __ INC T2 + 0
+11ee : a5 5c __ LDA T12 + 0
+11f0 : 85 1b __ STA ACCU + 0
+11f2 : a5 5d __ LDA T12 + 1
+11f4 : 85 1c __ STA ACCU + 1
+11f6 : a5 5e __ LDA T12 + 2
+11f8 : 85 1d __ STA ACCU + 2
+11fa : a5 5f __ LDA T12 + 3
+11fc : 85 1e __ STA ACCU + 3
+11fe : 20 ea 21 JSR $21ea ; (f32_to_i16 + 0)
+1201 : 18 __ __ CLC
+1202 : a5 1b __ LDA ACCU + 0
+1204 : 69 30 __ ADC #$30
+1206 : a4 47 __ LDY T2 + 0
+1208 : 91 4f __ STA (T6 + 0),y
+120a : 20 2c 22 JSR $222c ; (sint16_to_float + 0)
+120d : a5 1b __ LDA ACCU + 0
+120f : 85 03 __ STA $03
+1211 : a5 1c __ LDA ACCU + 1
+1213 : 85 04 __ STA $04
+1215 : a5 1d __ LDA ACCU + 2
+1217 : 85 05 __ STA $05
+1219 : a5 1e __ LDA ACCU + 3
+121b : 85 06 __ STA $06
+121d : a5 5c __ LDA T12 + 0
+121f : 85 1b __ STA ACCU + 0
+1221 : a5 5d __ LDA T12 + 1
+1223 : 85 1c __ STA ACCU + 1
+1225 : a5 5e __ LDA T12 + 2
+1227 : 85 1d __ STA ACCU + 2
+1229 : a5 5f __ LDA T12 + 3
+122b : 85 1e __ STA ACCU + 3
+122d : 20 ab 1e JSR $1eab ; (freg + 20)
+1230 : a5 06 __ LDA $06
+1232 : 49 80 __ EOR #$80
+1234 : 85 06 __ STA $06
+1236 : 20 dc 1e JSR $1edc ; (faddsub + 0)
+1239 : a9 00 __ LDA #$00
+123b : 85 03 __ STA $03
+123d : 85 04 __ STA $04
+123f : a9 20 __ LDA #$20
+1241 : 85 05 __ STA $05
+1243 : a9 41 __ LDA #$41
+1245 : 85 06 __ STA $06
+1247 : 20 ab 1e JSR $1eab ; (freg + 20)
+124a : 20 a4 1f JSR $1fa4 ; (fmul + 0)
+124d : a5 1b __ LDA ACCU + 0
+124f : 85 5c __ STA T12 + 0
+1251 : a5 1c __ LDA ACCU + 1
+1253 : 85 5d __ STA T12 + 1
+1255 : a5 1d __ LDA ACCU + 2
+1257 : 85 5e __ STA T12 + 2
+1259 : a5 1e __ LDA ACCU + 3
+125b : 85 5f __ STA T12 + 3
+125d : e6 47 __ INC T2 + 0
+125f : e6 4d __ INC T5 + 0
+1261 : a5 4d __ LDA T5 + 0
+1263 : c5 53 __ CMP T8 + 0
+1265 : b0 03 __ BCS $126a
+1267 : 4c e0 11 JMP $11e0 ; (sprintf + 1635)
+126a : 4c b1 10 JMP $10b1 ; (sprintf + 1332)
+126d : 85 43 __ STA T0 + 0
+126f : a5 5c __ LDA T12 + 0
+1271 : 85 1b __ STA ACCU + 0
+1273 : a5 5d __ LDA T12 + 1
+1275 : 85 1c __ STA ACCU + 1
+1277 : a5 5e __ LDA T12 + 2
+1279 : 85 1d __ STA ACCU + 2
+127b : a5 5f __ LDA T12 + 3
+127d : 85 1e __ STA ACCU + 3
+127f : a9 00 __ LDA #$00
+1281 : 85 03 __ STA $03
+1283 : 85 04 __ STA $04
+1285 : a9 20 __ LDA #$20
+1287 : 85 05 __ STA $05
+1289 : a9 41 __ LDA #$41
+128b : 85 06 __ STA $06
+128d : 20 ab 1e JSR $1eab ; (freg + 20)
+1290 : 20 42 20 JSR $2042 ; (fdiv + 0)
+1293 : a5 1b __ LDA ACCU + 0
+1295 : 85 5c __ STA T12 + 0
+1297 : a5 1c __ LDA ACCU + 1
+1299 : 85 5d __ STA T12 + 1
+129b : a5 1d __ LDA ACCU + 2
+129d : 85 5e __ STA T12 + 2
+129f : a5 1e __ LDA ACCU + 3
+12a1 : 85 5f __ STA T12 + 3
+12a3 : e6 43 __ INC T0 + 0
+12a5 : a5 43 __ LDA T0 + 0
+12a7 : c5 53 __ CMP T8 + 0
+12a9 : 90 c4 __ BCC $126f
+12ab : 4c fa 0f JMP $0ffa ; (sprintf + 1149)
+12ae : a5 58 __ LDA T11 + 0
+12b0 : 85 1b __ STA ACCU + 0
+12b2 : a5 59 __ LDA T11 + 1
+12b4 : 85 1c __ STA ACCU + 1
+12b6 : a5 5a __ LDA T11 + 2
+12b8 : 85 1d __ STA ACCU + 2
+12ba : a5 5b __ LDA T11 + 3
+12bc : 85 1e __ STA ACCU + 3
+12be : a9 00 __ LDA #$00
+12c0 : 85 03 __ STA $03
+12c2 : 85 04 __ STA $04
+12c4 : a9 20 __ LDA #$20
+12c6 : 85 05 __ STA $05
+12c8 : a9 41 __ LDA #$41
+12ca : 85 06 __ STA $06
+12cc : 20 ab 1e JSR $1eab ; (freg + 20)
+12cf : 20 42 20 JSR $2042 ; (fdiv + 0)
+12d2 : a5 1b __ LDA ACCU + 0
+12d4 : 85 58 __ STA T11 + 0
+12d6 : a5 1c __ LDA ACCU + 1
+12d8 : 85 59 __ STA T11 + 1
+12da : a5 1d __ LDA ACCU + 2
+12dc : 85 5a __ STA T11 + 2
+12de : a5 1e __ LDA ACCU + 3
+12e0 : 85 5b __ STA T11 + 3
+12e2 : e6 51 __ INC T7 + 0
+12e4 : d0 02 __ BNE $12e8
+12e6 : e6 52 __ INC T7 + 1
+12e8 : a5 52 __ LDA T7 + 1
+12ea : 30 c2 __ BMI $12ae
+12ec : 4c dc 0f JMP $0fdc ; (sprintf + 1119)
+12ef : a9 00 __ LDA #$00
+12f1 : 85 5c __ STA T12 + 0
+12f3 : 85 5d __ STA T12 + 1
+12f5 : 85 5e __ STA T12 + 2
+12f7 : a9 3f __ LDA #$3f
+12f9 : 85 5f __ STA T12 + 3
+12fb : a5 4d __ LDA T5 + 0
+12fd : f0 03 __ BEQ $1302
+12ff : 4c 9e 13 JMP $139e ; (sprintf + 2081)
+1302 : a5 58 __ LDA T11 + 0
+1304 : 85 1b __ STA ACCU + 0
+1306 : a5 59 __ LDA T11 + 1
+1308 : 85 1c __ STA ACCU + 1
+130a : a5 5a __ LDA T11 + 2
+130c : 85 1d __ STA ACCU + 2
+130e : a5 5b __ LDA T11 + 3
+1310 : 85 1e __ STA ACCU + 3
+1312 : a5 5c __ LDA T12 + 0
+1314 : 85 03 __ STA $03
+1316 : a5 5d __ LDA T12 + 1
+1318 : 85 04 __ STA $04
+131a : a5 5e __ LDA T12 + 2
+131c : 85 05 __ STA $05
+131e : a5 5f __ LDA T12 + 3
+1320 : 85 06 __ STA $06
+1322 : 20 ab 1e JSR $1eab ; (freg + 20)
+1325 : 20 dc 1e JSR $1edc ; (faddsub + 0)
+1328 : a5 1b __ LDA ACCU + 0
+132a : 85 5c __ STA T12 + 0
+132c : 85 58 __ STA T11 + 0
+132e : 85 03 __ STA $03
+1330 : a5 1c __ LDA ACCU + 1
+1332 : 85 5d __ STA T12 + 1
+1334 : 85 59 __ STA T11 + 1
+1336 : 85 04 __ STA $04
+1338 : a5 1d __ LDA ACCU + 2
+133a : 85 5e __ STA T12 + 2
+133c : 85 5a __ STA T11 + 2
+133e : 85 05 __ STA $05
+1340 : a5 1e __ LDA ACCU + 3
+1342 : 85 5f __ STA T12 + 3
+1344 : 85 5b __ STA T11 + 3
+1346 : 85 06 __ STA $06
+1348 : a9 00 __ LDA #$00
+134a : 85 1b __ STA ACCU + 0
+134c : 85 1c __ STA ACCU + 1
+134e : a9 20 __ LDA #$20
+1350 : 85 1d __ STA ACCU + 2
+1352 : a9 41 __ LDA #$41
+1354 : 85 1e __ STA ACCU + 3
+1356 : 20 77 22 JSR $2277 ; (fcmp + 0)
+1359 : 10 03 __ BPL $135e
+135b : 4c 89 10 JMP $1089 ; (sprintf + 1292)
+135e : a5 58 __ LDA T11 + 0
+1360 : 85 1b __ STA ACCU + 0
+1362 : a5 59 __ LDA T11 + 1
+1364 : 85 1c __ STA ACCU + 1
+1366 : a5 5a __ LDA T11 + 2
+1368 : 85 1d __ STA ACCU + 2
+136a : a5 5b __ LDA T11 + 3
+136c : 85 1e __ STA ACCU + 3
+136e : a9 00 __ LDA #$00
+1370 : 85 03 __ STA $03
+1372 : 85 04 __ STA $04
+1374 : a9 20 __ LDA #$20
+1376 : 85 05 __ STA $05
+1378 : a9 41 __ LDA #$41
+137a : 85 06 __ STA $06
+137c : 20 ab 1e JSR $1eab ; (freg + 20)
+137f : 20 42 20 JSR $2042 ; (fdiv + 0)
+1382 : a5 1b __ LDA ACCU + 0
+1384 : 85 5c __ STA T12 + 0
+1386 : a5 1c __ LDA ACCU + 1
+1388 : 85 5d __ STA T12 + 1
+138a : a5 1d __ LDA ACCU + 2
+138c : 85 5e __ STA T12 + 2
+138e : a5 1e __ LDA ACCU + 3
+1390 : 85 5f __ STA T12 + 3
+1392 : e6 51 __ INC T7 + 0
+1394 : f0 03 __ BEQ $1399
+1396 : 4c 89 10 JMP $1089 ; (sprintf + 1292)
+1399 : e6 52 __ INC T7 + 1
+139b : 4c 89 10 JMP $1089 ; (sprintf + 1292)
+139e : a9 00 __ LDA #$00
+13a0 : 85 43 __ STA T0 + 0
+13a2 : a5 5c __ LDA T12 + 0
+13a4 : 85 1b __ STA ACCU + 0
+13a6 : a5 5d __ LDA T12 + 1
+13a8 : 85 1c __ STA ACCU + 1
+13aa : a5 5e __ LDA T12 + 2
+13ac : 85 1d __ STA ACCU + 2
+13ae : a5 5f __ LDA T12 + 3
+13b0 : 85 1e __ STA ACCU + 3
+13b2 : a9 00 __ LDA #$00
+13b4 : 85 03 __ STA $03
+13b6 : 85 04 __ STA $04
+13b8 : a9 20 __ LDA #$20
+13ba : 85 05 __ STA $05
+13bc : a9 41 __ LDA #$41
+13be : 85 06 __ STA $06
+13c0 : 20 ab 1e JSR $1eab ; (freg + 20)
+13c3 : 20 42 20 JSR $2042 ; (fdiv + 0)
+13c6 : a5 1b __ LDA ACCU + 0
+13c8 : 85 5c __ STA T12 + 0
+13ca : a5 1c __ LDA ACCU + 1
+13cc : 85 5d __ STA T12 + 1
+13ce : a5 1d __ LDA ACCU + 2
+13d0 : 85 5e __ STA T12 + 2
+13d2 : a5 1e __ LDA ACCU + 3
+13d4 : 85 5f __ STA T12 + 3
+13d6 : e6 43 __ INC T0 + 0
+13d8 : a5 43 __ LDA T0 + 0
+13da : c5 4d __ CMP T5 + 0
+13dc : 90 c4 __ BCC $13a2
+13de : 4c 02 13 JMP $1302 ; (sprintf + 1925)
+13e1 : a5 52 __ LDA T7 + 1
+13e3 : 10 0e __ BPL $13f3
+13e5 : a5 52 __ LDA T7 + 1
+13e7 : 30 03 __ BMI $13ec
+13e9 : 4c ce 0f JMP $0fce ; (sprintf + 1105)
+13ec : a9 01 __ LDA #$01
+13ee : 85 60 __ STA T13 + 0
+13f0 : 4c ef 12 JMP $12ef ; (sprintf + 1906)
+13f3 : d0 f7 __ BNE $13ec
+13f5 : a9 03 __ LDA #$03
+13f7 : c5 51 __ CMP T7 + 0
+13f9 : 90 f1 __ BCC $13ec
+13fb : 4c e5 13 JMP $13e5 ; (sprintf + 2152)
+13fe : a9 01 __ LDA #$01
+1400 : 4c bb 0f JMP $0fbb ; (sprintf + 1086)
+1403 : a9 2d __ LDA #$2d
+1405 : a0 00 __ LDY #$00
+1407 : 91 49 __ STA (T3 + 0),y
+1409 : a9 01 __ LDA #$01
+140b : 85 47 __ STA T2 + 0
+140d : a5 5b __ LDA T11 + 3
+140f : 49 80 __ EOR #$80
+1411 : 85 5b __ STA T11 + 3
+1413 : 4c 07 0e JMP $0e07 ; (sprintf + 650)
+1416 : a0 00 __ LDY #$00
+1418 : b1 4b __ LDA (T4 + 0),y
+141a : 85 58 __ STA T11 + 0
+141c : c8 __ __ INY
+141d : b1 4b __ LDA (T4 + 0),y
+141f : 85 59 __ STA T11 + 1
+1421 : c8 __ __ INY
+1422 : b1 4b __ LDA (T4 + 0),y
+1424 : 85 5a __ STA T11 + 2
+1426 : c8 __ __ INY
+1427 : b1 4b __ LDA (T4 + 0),y
+1429 : 85 5b __ STA T11 + 3
+142b : 18 __ __ CLC
+142c : a5 4b __ LDA T4 + 0
+142e : 69 04 __ ADC #$04
+1430 : 85 4b __ STA T4 + 0
+1432 : 90 02 __ BCC $1436
+1434 : e6 4c __ INC T4 + 1
+1436 : a0 00 __ LDY #$00
+1438 : b1 45 __ LDA (T1 + 0),y
+143a : aa __ __ TAX
+143b : e6 45 __ INC T1 + 0
+143d : d0 02 __ BNE $1441
+143f : e6 46 __ INC T1 + 1
+1441 : 8a __ __ TXA
+1442 : e0 64 __ CPX #$64
+1444 : d0 03 __ BNE $1449
+1446 : 4c 3e 17 JMP $173e ; (sprintf + 3009)
+1449 : c9 75 __ CMP #$75
+144b : d0 03 __ BNE $1450
+144d : 4c d6 15 JMP $15d6 ; (sprintf + 2649)
+1450 : c9 78 __ CMP #$78
+1452 : f0 03 __ BEQ $1457
+1454 : 4c 1f 0c JMP $0c1f ; (sprintf + 162)
+1457 : a9 10 __ LDA #$10
+1459 : 8d 87 23 STA $2387 ; (sframe + 3)
+145c : a9 00 __ LDA #$00
+145e : 8d 88 23 STA $2388 ; (sframe + 4)
+1461 : a5 49 __ LDA T3 + 0
+1463 : 85 4f __ STA T6 + 0
+1465 : a5 4a __ LDA T3 + 1
+1467 : 85 50 __ STA T6 + 1
+1469 : a9 10 __ LDA #$10
+146b : 85 43 __ STA T0 + 0
+146d : a9 00 __ LDA #$00
+146f : c5 5b __ CMP T11 + 3
+1471 : d0 0a __ BNE $147d
+1473 : c5 5a __ CMP T11 + 2
+1475 : d0 06 __ BNE $147d
+1477 : c5 59 __ CMP T11 + 1
+1479 : d0 02 __ BNE $147d
+147b : c5 58 __ CMP T11 + 0
+147d : b0 03 __ BCS $1482
+147f : 4c 4c 15 JMP $154c ; (sprintf + 2511)
+1482 : ad 86 23 LDA $2386 ; (sframe + 2)
+1485 : c9 ff __ CMP #$ff
+1487 : d0 03 __ BNE $148c
+1489 : 4c 3e 15 JMP $153e ; (sprintf + 2497)
+148c : 38 __ __ SEC
+148d : a9 10 __ LDA #$10
+148f : ed 86 23 SBC $2386 ; (sframe + 2)
+1492 : 85 47 __ STA T2 + 0
+1494 : c5 43 __ CMP T0 + 0
+1496 : b0 0e __ BCS $14a6
+1498 : c6 43 __ DEC T0 + 0
+149a : a9 30 __ LDA #$30
+149c : a4 43 __ LDY T0 + 0
+149e : 91 4f __ STA (T6 + 0),y
+14a0 : a5 47 __ LDA T2 + 0
+14a2 : c5 43 __ CMP T0 + 0
+14a4 : 90 f2 __ BCC $1498
+14a6 : ad 8b 23 LDA $238b ; (sframe + 7)
+14a9 : f0 33 __ BEQ $14de
+14ab : ad 87 23 LDA $2387 ; (sframe + 3)
+14ae : 85 51 __ STA T7 + 0
+14b0 : ad 88 23 LDA $2388 ; (sframe + 4)
+14b3 : d0 29 __ BNE $14de
+14b5 : a5 51 __ LDA T7 + 0
+14b7 : c9 10 __ CMP #$10
+14b9 : d0 23 __ BNE $14de
+14bb : 18 __ __ CLC
+14bc : a5 43 __ LDA T0 + 0
+14be : 69 ff __ ADC #$ff
+14c0 : 18 __ __ CLC
+14c1 : 65 4f __ ADC T6 + 0
+14c3 : 85 51 __ STA T7 + 0
+14c5 : a5 50 __ LDA T6 + 1
+14c7 : 69 00 __ ADC #$00
+14c9 : 85 52 __ STA T7 + 1
+14cb : a9 58 __ LDA #$58
+14cd : a0 00 __ LDY #$00
+14cf : 91 51 __ STA (T7 + 0),y
+14d1 : 18 __ __ CLC
+14d2 : a5 43 __ LDA T0 + 0
+14d4 : 69 fe __ ADC #$fe
+14d6 : 85 43 __ STA T0 + 0
+14d8 : a9 30 __ LDA #$30
+14da : a4 43 __ LDY T0 + 0
+14dc : 91 4f __ STA (T6 + 0),y
+14de : ad 89 23 LDA $2389 ; (sframe + 5)
+14e1 : f0 08 __ BEQ $14eb
+14e3 : c6 43 __ DEC T0 + 0
+14e5 : a9 2b __ LDA #$2b
+14e7 : a4 43 __ LDY T0 + 0
+14e9 : 91 4f __ STA (T6 + 0),y
+14eb : 38 __ __ SEC
+14ec : a9 10 __ LDA #$10
+14ee : ed 85 23 SBC $2385 ; (sframe + 1)
+14f1 : 85 51 __ STA T7 + 0
+14f3 : a9 00 __ LDA #$00
+14f5 : e9 00 __ SBC #$00
+14f7 : 49 80 __ EOR #$80
+14f9 : c9 80 __ CMP #$80
+14fb : d0 04 __ BNE $1501
+14fd : a5 51 __ LDA T7 + 0
+14ff : c5 43 __ CMP T0 + 0
+1501 : 90 2f __ BCC $1532
+1503 : a9 00 __ LDA #$00
+1505 : 85 47 __ STA T2 + 0
+1507 : a5 43 __ LDA T0 + 0
+1509 : c9 10 __ CMP #$10
+150b : b0 12 __ BCS $151f
+150d : a4 43 __ LDY T0 + 0
+150f : b1 4f __ LDA (T6 + 0),y
+1511 : a4 47 __ LDY T2 + 0
+1513 : 91 4f __ STA (T6 + 0),y
+1515 : e6 47 __ INC T2 + 0
+1517 : e6 43 __ INC T0 + 0
+1519 : a5 43 __ LDA T0 + 0
+151b : c9 10 __ CMP #$10
+151d : 90 ee __ BCC $150d
+151f : a0 00 __ LDY #$00
+1521 : b1 45 __ LDA (T1 + 0),y
+1523 : 85 4d __ STA T5 + 0
+1525 : e6 45 __ INC T1 + 0
+1527 : d0 02 __ BNE $152b
+1529 : e6 46 __ INC T1 + 1
+152b : a5 47 __ LDA T2 + 0
+152d : 85 43 __ STA T0 + 0
+152f : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+1532 : c6 43 __ DEC T0 + 0
+1534 : ad 84 23 LDA $2384 ; (sframe + 0)
+1537 : a4 43 __ LDY T0 + 0
+1539 : 91 4f __ STA (T6 + 0),y
+153b : 4c eb 14 JMP $14eb ; (sprintf + 2414)
+153e : a9 0f __ LDA #$0f
+1540 : 85 47 __ STA T2 + 0
+1542 : c5 43 __ CMP T0 + 0
+1544 : b0 03 __ BCS $1549
+1546 : 4c 98 14 JMP $1498 ; (sprintf + 2331)
+1549 : 4c a6 14 JMP $14a6 ; (sprintf + 2345)
+154c : ad 87 23 LDA $2387 ; (sframe + 3)
+154f : 85 03 __ STA $03
+1551 : ad 88 23 LDA $2388 ; (sframe + 4)
+1554 : 85 04 __ STA $04
+1556 : a5 58 __ LDA T11 + 0
+1558 : 85 1b __ STA ACCU + 0
+155a : a5 59 __ LDA T11 + 1
+155c : 85 1c __ STA ACCU + 1
+155e : a5 5a __ LDA T11 + 2
+1560 : 85 1d __ STA ACCU + 2
+1562 : a5 5b __ LDA T11 + 3
+1564 : 85 1e __ STA ACCU + 3
+1566 : a9 00 __ LDA #$00
+1568 : 85 05 __ STA $05
+156a : 85 06 __ STA $06
+156c : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+156f : a5 08 __ LDA $08
+1571 : 10 53 __ BPL $15c6
+1573 : 18 __ __ CLC
+1574 : a5 07 __ LDA $07
+1576 : 69 30 __ ADC #$30
+1578 : c6 43 __ DEC T0 + 0
+157a : a4 43 __ LDY T0 + 0
+157c : 91 4f __ STA (T6 + 0),y
+157e : ad 87 23 LDA $2387 ; (sframe + 3)
+1581 : 85 03 __ STA $03
+1583 : ad 88 23 LDA $2388 ; (sframe + 4)
+1586 : 85 04 __ STA $04
+1588 : a5 58 __ LDA T11 + 0
+158a : 85 1b __ STA ACCU + 0
+158c : a5 59 __ LDA T11 + 1
+158e : 85 1c __ STA ACCU + 1
+1590 : a5 5a __ LDA T11 + 2
+1592 : 85 1d __ STA ACCU + 2
+1594 : a5 5b __ LDA T11 + 3
+1596 : 85 1e __ STA ACCU + 3
+1598 : a9 00 __ LDA #$00
+159a : 85 05 __ STA $05
+159c : 85 06 __ STA $06
+159e : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+15a1 : a5 1b __ LDA ACCU + 0
+15a3 : 85 58 __ STA T11 + 0
+15a5 : a5 1c __ LDA ACCU + 1
+15a7 : 85 59 __ STA T11 + 1
+15a9 : a5 1d __ LDA ACCU + 2
+15ab : 85 5a __ STA T11 + 2
+15ad : a5 1e __ LDA ACCU + 3
+15af : 85 5b __ STA T11 + 3
+15b1 : a9 00 __ LDA #$00
+15b3 : c5 1e __ CMP ACCU + 3
+15b5 : d0 0a __ BNE $15c1
+15b7 : c5 1d __ CMP ACCU + 2
+15b9 : d0 06 __ BNE $15c1
+15bb : c5 1c __ CMP ACCU + 1
+15bd : d0 02 __ BNE $15c1
+15bf : c5 1b __ CMP ACCU + 0
+15c1 : 90 89 __ BCC $154c
+15c3 : 4c 82 14 JMP $1482 ; (sprintf + 2309)
+15c6 : d0 06 __ BNE $15ce
+15c8 : a5 07 __ LDA $07
+15ca : c9 0a __ CMP #$0a
+15cc : 90 a5 __ BCC $1573
+15ce : 18 __ __ CLC
+15cf : a5 07 __ LDA $07
+15d1 : 69 37 __ ADC #$37
+15d3 : 4c 78 15 JMP $1578 ; (sprintf + 2555)
+15d6 : a5 49 __ LDA T3 + 0
+15d8 : 85 4f __ STA T6 + 0
+15da : a5 4a __ LDA T3 + 1
+15dc : 85 50 __ STA T6 + 1
+15de : a9 10 __ LDA #$10
+15e0 : 85 43 __ STA T0 + 0
+15e2 : a9 00 __ LDA #$00
+15e4 : c5 5b __ CMP T11 + 3
+15e6 : d0 0a __ BNE $15f2
+15e8 : c5 5a __ CMP T11 + 2
+15ea : d0 06 __ BNE $15f2
+15ec : c5 59 __ CMP T11 + 1
+15ee : d0 02 __ BNE $15f2
+15f0 : c5 58 __ CMP T11 + 0
+15f2 : b0 03 __ BCS $15f7
+15f4 : 4c b4 16 JMP $16b4 ; (sprintf + 2871)
+15f7 : ad 86 23 LDA $2386 ; (sframe + 2)
+15fa : c9 ff __ CMP #$ff
+15fc : d0 03 __ BNE $1601
+15fe : 4c a6 16 JMP $16a6 ; (sprintf + 2857)
+1601 : 38 __ __ SEC
+1602 : a9 10 __ LDA #$10
+1604 : ed 86 23 SBC $2386 ; (sframe + 2)
+1607 : 85 47 __ STA T2 + 0
+1609 : c5 43 __ CMP T0 + 0
+160b : b0 0e __ BCS $161b
+160d : c6 43 __ DEC T0 + 0
+160f : a9 30 __ LDA #$30
+1611 : a4 43 __ LDY T0 + 0
+1613 : 91 4f __ STA (T6 + 0),y
+1615 : a5 47 __ LDA T2 + 0
+1617 : c5 43 __ CMP T0 + 0
+1619 : 90 f2 __ BCC $160d
+161b : ad 8b 23 LDA $238b ; (sframe + 7)
+161e : f0 33 __ BEQ $1653
+1620 : ad 87 23 LDA $2387 ; (sframe + 3)
+1623 : 85 51 __ STA T7 + 0
+1625 : ad 88 23 LDA $2388 ; (sframe + 4)
+1628 : d0 29 __ BNE $1653
+162a : a5 51 __ LDA T7 + 0
+162c : c9 10 __ CMP #$10
+162e : d0 23 __ BNE $1653
+1630 : 18 __ __ CLC
+1631 : a5 43 __ LDA T0 + 0
+1633 : 69 ff __ ADC #$ff
+1635 : 18 __ __ CLC
+1636 : 65 4f __ ADC T6 + 0
+1638 : 85 51 __ STA T7 + 0
+163a : a5 50 __ LDA T6 + 1
+163c : 69 00 __ ADC #$00
+163e : 85 52 __ STA T7 + 1
+1640 : a9 58 __ LDA #$58
+1642 : a0 00 __ LDY #$00
+1644 : 91 51 __ STA (T7 + 0),y
+1646 : 18 __ __ CLC
+1647 : a5 43 __ LDA T0 + 0
+1649 : 69 fe __ ADC #$fe
+164b : 85 43 __ STA T0 + 0
+164d : a9 30 __ LDA #$30
+164f : a4 43 __ LDY T0 + 0
+1651 : 91 4f __ STA (T6 + 0),y
+1653 : ad 89 23 LDA $2389 ; (sframe + 5)
+1656 : f0 08 __ BEQ $1660
+1658 : c6 43 __ DEC T0 + 0
+165a : a9 2b __ LDA #$2b
+165c : a4 43 __ LDY T0 + 0
+165e : 91 4f __ STA (T6 + 0),y
+1660 : 38 __ __ SEC
+1661 : a9 10 __ LDA #$10
+1663 : ed 85 23 SBC $2385 ; (sframe + 1)
+1666 : 85 51 __ STA T7 + 0
+1668 : a9 00 __ LDA #$00
+166a : e9 00 __ SBC #$00
+166c : 49 80 __ EOR #$80
+166e : c9 80 __ CMP #$80
+1670 : d0 04 __ BNE $1676
+1672 : a5 51 __ LDA T7 + 0
+1674 : c5 43 __ CMP T0 + 0
+1676 : 90 22 __ BCC $169a
+1678 : a9 00 __ LDA #$00
+167a : 85 47 __ STA T2 + 0
+167c : a5 43 __ LDA T0 + 0
+167e : c9 10 __ CMP #$10
+1680 : 90 03 __ BCC $1685
+1682 : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+1685 : a4 43 __ LDY T0 + 0
+1687 : b1 4f __ LDA (T6 + 0),y
+1689 : a4 47 __ LDY T2 + 0
+168b : 91 4f __ STA (T6 + 0),y
+168d : e6 47 __ INC T2 + 0
+168f : e6 43 __ INC T0 + 0
+1691 : a5 43 __ LDA T0 + 0
+1693 : c9 10 __ CMP #$10
+1695 : 90 ee __ BCC $1685
+1697 : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+169a : c6 43 __ DEC T0 + 0
+169c : ad 84 23 LDA $2384 ; (sframe + 0)
+169f : a4 43 __ LDY T0 + 0
+16a1 : 91 4f __ STA (T6 + 0),y
+16a3 : 4c 60 16 JMP $1660 ; (sprintf + 2787)
+16a6 : a9 0f __ LDA #$0f
+16a8 : 85 47 __ STA T2 + 0
+16aa : c5 43 __ CMP T0 + 0
+16ac : b0 03 __ BCS $16b1
+16ae : 4c 0d 16 JMP $160d ; (sprintf + 2704)
+16b1 : 4c 1b 16 JMP $161b ; (sprintf + 2718)
+16b4 : ad 87 23 LDA $2387 ; (sframe + 3)
+16b7 : 85 03 __ STA $03
+16b9 : ad 88 23 LDA $2388 ; (sframe + 4)
+16bc : 85 04 __ STA $04
+16be : a5 58 __ LDA T11 + 0
+16c0 : 85 1b __ STA ACCU + 0
+16c2 : a5 59 __ LDA T11 + 1
+16c4 : 85 1c __ STA ACCU + 1
+16c6 : a5 5a __ LDA T11 + 2
+16c8 : 85 1d __ STA ACCU + 2
+16ca : a5 5b __ LDA T11 + 3
+16cc : 85 1e __ STA ACCU + 3
+16ce : a9 00 __ LDA #$00
+16d0 : 85 05 __ STA $05
+16d2 : 85 06 __ STA $06
+16d4 : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+16d7 : a5 08 __ LDA $08
+16d9 : 10 53 __ BPL $172e
+16db : 18 __ __ CLC
+16dc : a5 07 __ LDA $07
+16de : 69 30 __ ADC #$30
+16e0 : c6 43 __ DEC T0 + 0
+16e2 : a4 43 __ LDY T0 + 0
+16e4 : 91 4f __ STA (T6 + 0),y
+16e6 : ad 87 23 LDA $2387 ; (sframe + 3)
+16e9 : 85 03 __ STA $03
+16eb : ad 88 23 LDA $2388 ; (sframe + 4)
+16ee : 85 04 __ STA $04
+16f0 : a5 58 __ LDA T11 + 0
+16f2 : 85 1b __ STA ACCU + 0
+16f4 : a5 59 __ LDA T11 + 1
+16f6 : 85 1c __ STA ACCU + 1
+16f8 : a5 5a __ LDA T11 + 2
+16fa : 85 1d __ STA ACCU + 2
+16fc : a5 5b __ LDA T11 + 3
+16fe : 85 1e __ STA ACCU + 3
+1700 : a9 00 __ LDA #$00
+1702 : 85 05 __ STA $05
+1704 : 85 06 __ STA $06
+1706 : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+1709 : a5 1b __ LDA ACCU + 0
+170b : 85 58 __ STA T11 + 0
+170d : a5 1c __ LDA ACCU + 1
+170f : 85 59 __ STA T11 + 1
+1711 : a5 1d __ LDA ACCU + 2
+1713 : 85 5a __ STA T11 + 2
+1715 : a5 1e __ LDA ACCU + 3
+1717 : 85 5b __ STA T11 + 3
+1719 : a9 00 __ LDA #$00
+171b : c5 1e __ CMP ACCU + 3
+171d : d0 0a __ BNE $1729
+171f : c5 1d __ CMP ACCU + 2
+1721 : d0 06 __ BNE $1729
+1723 : c5 1c __ CMP ACCU + 1
+1725 : d0 02 __ BNE $1729
+1727 : c5 1b __ CMP ACCU + 0
+1729 : 90 89 __ BCC $16b4
+172b : 4c f7 15 JMP $15f7 ; (sprintf + 2682)
+172e : d0 06 __ BNE $1736
+1730 : a5 07 __ LDA $07
+1732 : c9 0a __ CMP #$0a
+1734 : 90 a5 __ BCC $16db
+1736 : 18 __ __ CLC
+1737 : a5 07 __ LDA $07
+1739 : 69 37 __ ADC #$37
+173b : 4c e0 16 JMP $16e0 ; (sprintf + 2915)
+173e : a5 49 __ LDA T3 + 0
+1740 : 85 4f __ STA T6 + 0
+1742 : a5 4a __ LDA T3 + 1
+1744 : 85 50 __ STA T6 + 1
+1746 : a5 5b __ LDA T11 + 3
+1748 : 49 80 __ EOR #$80
+174a : c9 80 __ CMP #$80
+174c : f0 03 __ BEQ $1751
+174e : 4c fc 18 JMP $18fc ; (sprintf + 3455)
+1751 : a5 5a __ LDA T11 + 2
+1753 : c9 00 __ CMP #$00
+1755 : f0 03 __ BEQ $175a
+1757 : 4c fc 18 JMP $18fc ; (sprintf + 3455)
+175a : a5 59 __ LDA T11 + 1
+175c : c9 00 __ CMP #$00
+175e : f0 03 __ BEQ $1763
+1760 : 4c fc 18 JMP $18fc ; (sprintf + 3455)
+1763 : a5 58 __ LDA T11 + 0
+1765 : 85 5c __ STA T12 + 0
+1767 : a5 59 __ LDA T11 + 1
+1769 : 85 5d __ STA T12 + 1
+176b : a5 5a __ LDA T11 + 2
+176d : 85 5e __ STA T12 + 2
+176f : a5 5b __ LDA T11 + 3
+1771 : 85 5f __ STA T12 + 3
+1773 : a9 00 __ LDA #$00
+1775 : 85 43 __ STA T0 + 0
+1777 : a9 10 __ LDA #$10
+1779 : 85 47 __ STA T2 + 0
+177b : a9 00 __ LDA #$00
+177d : c5 5b __ CMP T11 + 3
+177f : d0 0a __ BNE $178b
+1781 : c5 5a __ CMP T11 + 2
+1783 : d0 06 __ BNE $178b
+1785 : c5 59 __ CMP T11 + 1
+1787 : d0 02 __ BNE $178b
+1789 : c5 58 __ CMP T11 + 0
+178b : b0 03 __ BCS $1790
+178d : 4c 72 18 JMP $1872 ; (sprintf + 3317)
+1790 : ad 86 23 LDA $2386 ; (sframe + 2)
+1793 : c9 ff __ CMP #$ff
+1795 : d0 03 __ BNE $179a
+1797 : 4c 64 18 JMP $1864 ; (sprintf + 3303)
+179a : 38 __ __ SEC
+179b : a9 10 __ LDA #$10
+179d : ed 86 23 SBC $2386 ; (sframe + 2)
+17a0 : 85 4d __ STA T5 + 0
+17a2 : c5 47 __ CMP T2 + 0
+17a4 : b0 0e __ BCS $17b4
+17a6 : c6 47 __ DEC T2 + 0
+17a8 : a9 30 __ LDA #$30
+17aa : a4 47 __ LDY T2 + 0
+17ac : 91 4f __ STA (T6 + 0),y
+17ae : a5 4d __ LDA T5 + 0
+17b0 : c5 47 __ CMP T2 + 0
+17b2 : 90 f2 __ BCC $17a6
+17b4 : ad 8b 23 LDA $238b ; (sframe + 7)
+17b7 : f0 33 __ BEQ $17ec
+17b9 : ad 87 23 LDA $2387 ; (sframe + 3)
+17bc : 85 51 __ STA T7 + 0
+17be : ad 88 23 LDA $2388 ; (sframe + 4)
+17c1 : d0 29 __ BNE $17ec
+17c3 : a5 51 __ LDA T7 + 0
+17c5 : c9 10 __ CMP #$10
+17c7 : d0 23 __ BNE $17ec
+17c9 : 18 __ __ CLC
+17ca : a5 47 __ LDA T2 + 0
+17cc : 69 ff __ ADC #$ff
+17ce : 18 __ __ CLC
+17cf : 65 4f __ ADC T6 + 0
+17d1 : 85 51 __ STA T7 + 0
+17d3 : a5 50 __ LDA T6 + 1
+17d5 : 69 00 __ ADC #$00
+17d7 : 85 52 __ STA T7 + 1
+17d9 : a9 58 __ LDA #$58
+17db : a0 00 __ LDY #$00
+17dd : 91 51 __ STA (T7 + 0),y
+17df : 18 __ __ CLC
+17e0 : a5 47 __ LDA T2 + 0
+17e2 : 69 fe __ ADC #$fe
+17e4 : 85 47 __ STA T2 + 0
+17e6 : a9 30 __ LDA #$30
+17e8 : a4 47 __ LDY T2 + 0
+17ea : 91 4f __ STA (T6 + 0),y
+17ec : a5 43 __ LDA T0 + 0
+17ee : d0 69 __ BNE $1859
+17f0 : ad 89 23 LDA $2389 ; (sframe + 5)
+17f3 : f0 08 __ BEQ $17fd
+17f5 : c6 47 __ DEC T2 + 0
+17f7 : a9 2b __ LDA #$2b
+17f9 : a4 47 __ LDY T2 + 0
+17fb : 91 4f __ STA (T6 + 0),y
+17fd : 38 __ __ SEC
+17fe : a9 10 __ LDA #$10
+1800 : ed 85 23 SBC $2385 ; (sframe + 1)
+1803 : 85 51 __ STA T7 + 0
+1805 : a9 00 __ LDA #$00
+1807 : e9 00 __ SBC #$00
+1809 : 49 80 __ EOR #$80
+180b : c9 80 __ CMP #$80
+180d : d0 04 __ BNE $1813
+180f : a5 51 __ LDA T7 + 0
+1811 : c5 47 __ CMP T2 + 0
+1813 : 90 38 __ BCC $184d
+1815 : a9 00 __ LDA #$00
+1817 : 85 43 __ STA T0 + 0
+1819 : a5 47 __ LDA T2 + 0
+181b : c9 10 __ CMP #$10
+181d : 90 0f __ BCC $182e
+181f : a0 00 __ LDY #$00
+1821 : b1 45 __ LDA (T1 + 0),y
+1823 : 85 4d __ STA T5 + 0
+1825 : e6 45 __ INC T1 + 0
+1827 : d0 02 __ BNE $182b
+1829 : e6 46 __ INC T1 + 1
+182b : 4c 16 0c JMP $0c16 ; (sprintf + 153)
+182e : aa __ __ TAX
+182f : 8a __ __ TXA
+1830 : 18 __ __ CLC
+1831 : 65 4f __ ADC T6 + 0
+1833 : 85 51 __ STA T7 + 0
+1835 : a5 50 __ LDA T6 + 1
+1837 : 69 00 __ ADC #$00
+1839 : 85 52 __ STA T7 + 1
+183b : a0 00 __ LDY #$00
+183d : b1 51 __ LDA (T7 + 0),y
+183f : a4 43 __ LDY T0 + 0
+1841 : 91 4f __ STA (T6 + 0),y
+1843 : e6 43 __ INC T0 + 0
+1845 : e8 __ __ INX
+1846 : e0 10 __ CPX #$10
+1848 : 90 e5 __ BCC $182f
+184a : 4c 1f 18 JMP $181f ; (sprintf + 3234)
+184d : c6 47 __ DEC T2 + 0
+184f : ad 84 23 LDA $2384 ; (sframe + 0)
+1852 : a4 47 __ LDY T2 + 0
+1854 : 91 4f __ STA (T6 + 0),y
+1856 : 4c fd 17 JMP $17fd ; (sprintf + 3200)
+1859 : c6 47 __ DEC T2 + 0
+185b : a9 2d __ LDA #$2d
+185d : a4 47 __ LDY T2 + 0
+185f : 91 4f __ STA (T6 + 0),y
+1861 : 4c fd 17 JMP $17fd ; (sprintf + 3200)
+1864 : a9 0f __ LDA #$0f
+1866 : 85 4d __ STA T5 + 0
+1868 : c5 47 __ CMP T2 + 0
+186a : b0 03 __ BCS $186f
+186c : 4c a6 17 JMP $17a6 ; (sprintf + 3113)
+186f : 4c b4 17 JMP $17b4 ; (sprintf + 3127)
+1872 : ad 87 23 LDA $2387 ; (sframe + 3)
+1875 : 85 03 __ STA $03
+1877 : ad 88 23 LDA $2388 ; (sframe + 4)
+187a : 85 04 __ STA $04
+187c : a9 00 __ LDA #$00
+187e : 85 05 __ STA $05
+1880 : 85 06 __ STA $06
+1882 : a5 5c __ LDA T12 + 0
+1884 : 85 1b __ STA ACCU + 0
+1886 : a5 5d __ LDA T12 + 1
+1888 : 85 1c __ STA ACCU + 1
+188a : a5 5e __ LDA T12 + 2
+188c : 85 1d __ STA ACCU + 2
+188e : a5 5f __ LDA T12 + 3
+1890 : 85 1e __ STA ACCU + 3
+1892 : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+1895 : a5 08 __ LDA $08
+1897 : 10 53 __ BPL $18ec
+1899 : 18 __ __ CLC
+189a : a5 07 __ LDA $07
+189c : 69 30 __ ADC #$30
+189e : c6 47 __ DEC T2 + 0
+18a0 : a4 47 __ LDY T2 + 0
+18a2 : 91 4f __ STA (T6 + 0),y
+18a4 : ad 87 23 LDA $2387 ; (sframe + 3)
+18a7 : 85 03 __ STA $03
+18a9 : ad 88 23 LDA $2388 ; (sframe + 4)
+18ac : 85 04 __ STA $04
+18ae : a9 00 __ LDA #$00
+18b0 : 85 05 __ STA $05
+18b2 : 85 06 __ STA $06
+18b4 : a5 5c __ LDA T12 + 0
+18b6 : 85 1b __ STA ACCU + 0
+18b8 : a5 5d __ LDA T12 + 1
+18ba : 85 1c __ STA ACCU + 1
+18bc : a5 5e __ LDA T12 + 2
+18be : 85 1d __ STA ACCU + 2
+18c0 : a5 5f __ LDA T12 + 3
+18c2 : 85 1e __ STA ACCU + 3
+18c4 : 20 c8 22 JSR $22c8 ; (divmod32 + 0)
+18c7 : a5 1b __ LDA ACCU + 0
+18c9 : 85 5c __ STA T12 + 0
+18cb : a5 1c __ LDA ACCU + 1
+18cd : 85 5d __ STA T12 + 1
+18cf : a5 1d __ LDA ACCU + 2
+18d1 : 85 5e __ STA T12 + 2
+18d3 : a5 1e __ LDA ACCU + 3
+18d5 : 85 5f __ STA T12 + 3
+18d7 : a9 00 __ LDA #$00
+18d9 : c5 1e __ CMP ACCU + 3
+18db : d0 0a __ BNE $18e7
+18dd : c5 1d __ CMP ACCU + 2
+18df : d0 06 __ BNE $18e7
+18e1 : c5 1c __ CMP ACCU + 1
+18e3 : d0 02 __ BNE $18e7
+18e5 : c5 1b __ CMP ACCU + 0
+18e7 : 90 89 __ BCC $1872
+18e9 : 4c 90 17 JMP $1790 ; (sprintf + 3091)
+18ec : d0 06 __ BNE $18f4
+18ee : a5 07 __ LDA $07
+18f0 : c9 0a __ CMP #$0a
+18f2 : 90 a5 __ BCC $1899
+18f4 : 18 __ __ CLC
+18f5 : a5 07 __ LDA $07
+18f7 : 69 37 __ ADC #$37
+18f9 : 4c 9e 18 JMP $189e ; (sprintf + 3361)
+18fc : 90 22 __ BCC $1920
+18fe : 85 5c __ STA T12 + 0
+1900 : a5 59 __ LDA T11 + 1
+1902 : 85 5d __ STA T12 + 1
+1904 : a5 5a __ LDA T11 + 2
+1906 : 85 5e __ STA T12 + 2
+1908 : a5 5b __ LDA T11 + 3
+190a : 85 5f __ STA T12 + 3
+190c : a9 00 __ LDA #$00
+190e : 85 43 __ STA T0 + 0
+1910 : a9 10 __ LDA #$10
+1912 : 85 47 __ STA T2 + 0
+1914 : a9 00 __ LDA #$00
+1916 : c5 5b __ CMP T11 + 3
+1918 : f0 03 __ BEQ $191d
+191a : 4c 8b 17 JMP $178b ; (sprintf + 3086)
+191d : 4c 81 17 JMP $1781 ; (sprintf + 3076)
+1920 : a9 01 __ LDA #$01
+1922 : 85 43 __ STA T0 + 0
+1924 : a9 10 __ LDA #$10
+1926 : 85 47 __ STA T2 + 0
+1928 : 38 __ __ SEC
+1929 : a9 00 __ LDA #$00
+192b : e5 58 __ SBC T11 + 0
+192d : 85 5c __ STA T12 + 0
+192f : a9 00 __ LDA #$00
+1931 : e5 59 __ SBC T11 + 1
+1933 : 85 5d __ STA T12 + 1
+1935 : a9 00 __ LDA #$00
+1937 : e5 5a __ SBC T11 + 2
+1939 : 85 5e __ STA T12 + 2
+193b : a9 00 __ LDA #$00
+193d : e5 5b __ SBC T11 + 3
+193f : 85 5f __ STA T12 + 3
+1941 : a9 00 __ LDA #$00
+1943 : c5 5f __ CMP T12 + 3
+1945 : d0 0a __ BNE $1951
+1947 : c5 5e __ CMP T12 + 2
+1949 : d0 06 __ BNE $1951
+194b : c5 5d __ CMP T12 + 1
+194d : d0 02 __ BNE $1951
+194f : c5 5c __ CMP T12 + 0
+1951 : b0 03 __ BCS $1956
+1953 : 4c 72 18 JMP $1872 ; (sprintf + 3317)
+1956 : 4c 90 17 JMP $1790 ; (sprintf + 3091)
+1959 : a9 10 __ LDA #$10
+195b : 8d 87 23 STA $2387 ; (sframe + 3)
+195e : a9 00 __ LDA #$00
+1960 : 8d 88 23 STA $2388 ; (sframe + 4)
+1963 : a5 49 __ LDA T3 + 0
+1965 : 85 4f __ STA T6 + 0
+1967 : a5 4a __ LDA T3 + 1
+1969 : 85 50 __ STA T6 + 1
+196b : a0 00 __ LDY #$00
+196d : b1 4b __ LDA (T4 + 0),y
+196f : 85 51 __ STA T7 + 0
+1971 : c8 __ __ INY
+1972 : b1 4b __ LDA (T4 + 0),y
+1974 : 85 52 __ STA T7 + 1
+1976 : 18 __ __ CLC
+1977 : a5 4b __ LDA T4 + 0
+1979 : 69 02 __ ADC #$02
+197b : 85 4b __ STA T4 + 0
+197d : 90 02 __ BCC $1981
+197f : e6 4c __ INC T4 + 1
+1981 : a9 0a __ LDA #$0a
+1983 : 85 43 __ STA T0 + 0
+1985 : a5 51 __ LDA T7 + 0
+1987 : 05 52 __ ORA T7 + 1
+1989 : f0 03 __ BEQ $198e
+198b : 4c 4b 1a JMP $1a4b ; (sprintf + 3790)
+198e : ad 86 23 LDA $2386 ; (sframe + 2)
+1991 : c9 ff __ CMP #$ff
+1993 : d0 03 __ BNE $1998
+1995 : 4c 3d 1a JMP $1a3d ; (sprintf + 3776)
+1998 : 38 __ __ SEC
+1999 : a9 0a __ LDA #$0a
+199b : ed 86 23 SBC $2386 ; (sframe + 2)
+199e : 85 47 __ STA T2 + 0
+19a0 : c5 43 __ CMP T0 + 0
+19a2 : b0 0e __ BCS $19b2
+19a4 : c6 43 __ DEC T0 + 0
+19a6 : a9 30 __ LDA #$30
+19a8 : a4 43 __ LDY T0 + 0
+19aa : 91 4f __ STA (T6 + 0),y
+19ac : a5 47 __ LDA T2 + 0
+19ae : c5 43 __ CMP T0 + 0
+19b0 : 90 f2 __ BCC $19a4
+19b2 : ad 8b 23 LDA $238b ; (sframe + 7)
+19b5 : f0 33 __ BEQ $19ea
+19b7 : ad 87 23 LDA $2387 ; (sframe + 3)
+19ba : 85 51 __ STA T7 + 0
+19bc : ad 88 23 LDA $2388 ; (sframe + 4)
+19bf : d0 29 __ BNE $19ea
+19c1 : a5 51 __ LDA T7 + 0
+19c3 : c9 10 __ CMP #$10
+19c5 : d0 23 __ BNE $19ea
+19c7 : 18 __ __ CLC
+19c8 : a5 43 __ LDA T0 + 0
+19ca : 69 ff __ ADC #$ff
+19cc : 18 __ __ CLC
+19cd : 65 4f __ ADC T6 + 0
+19cf : 85 51 __ STA T7 + 0
+19d1 : a5 50 __ LDA T6 + 1
+19d3 : 69 00 __ ADC #$00
+19d5 : 85 52 __ STA T7 + 1
+19d7 : a9 58 __ LDA #$58
+19d9 : a0 00 __ LDY #$00
+19db : 91 51 __ STA (T7 + 0),y
+19dd : 18 __ __ CLC
+19de : a5 43 __ LDA T0 + 0
+19e0 : 69 fe __ ADC #$fe
+19e2 : 85 43 __ STA T0 + 0
+19e4 : a9 30 __ LDA #$30
+19e6 : a4 43 __ LDY T0 + 0
+19e8 : 91 4f __ STA (T6 + 0),y
+19ea : ad 89 23 LDA $2389 ; (sframe + 5)
+19ed : f0 08 __ BEQ $19f7
+19ef : c6 43 __ DEC T0 + 0
+19f1 : a9 2b __ LDA #$2b
+19f3 : a4 43 __ LDY T0 + 0
+19f5 : 91 4f __ STA (T6 + 0),y
+19f7 : 38 __ __ SEC
+19f8 : a9 0a __ LDA #$0a
+19fa : ed 85 23 SBC $2385 ; (sframe + 1)
+19fd : 85 51 __ STA T7 + 0
+19ff : a9 00 __ LDA #$00
+1a01 : e9 00 __ SBC #$00
+1a03 : 49 80 __ EOR #$80
+1a05 : c9 80 __ CMP #$80
+1a07 : d0 04 __ BNE $1a0d
+1a09 : a5 51 __ LDA T7 + 0
+1a0b : c5 43 __ CMP T0 + 0
+1a0d : 90 22 __ BCC $1a31
+1a0f : a9 00 __ LDA #$00
+1a11 : 85 47 __ STA T2 + 0
+1a13 : a5 43 __ LDA T0 + 0
+1a15 : c9 0a __ CMP #$0a
+1a17 : 90 03 __ BCC $1a1c
+1a19 : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+1a1c : a4 43 __ LDY T0 + 0
+1a1e : b1 4f __ LDA (T6 + 0),y
+1a20 : a4 47 __ LDY T2 + 0
+1a22 : 91 4f __ STA (T6 + 0),y
+1a24 : e6 47 __ INC T2 + 0
+1a26 : e6 43 __ INC T0 + 0
+1a28 : a5 43 __ LDA T0 + 0
+1a2a : c9 0a __ CMP #$0a
+1a2c : 90 ee __ BCC $1a1c
+1a2e : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+1a31 : c6 43 __ DEC T0 + 0
+1a33 : ad 84 23 LDA $2384 ; (sframe + 0)
+1a36 : a4 43 __ LDY T0 + 0
+1a38 : 91 4f __ STA (T6 + 0),y
+1a3a : 4c f7 19 JMP $19f7 ; (sprintf + 3706)
+1a3d : a9 09 __ LDA #$09
+1a3f : 85 47 __ STA T2 + 0
+1a41 : c5 43 __ CMP T0 + 0
+1a43 : b0 03 __ BCS $1a48
+1a45 : 4c a4 19 JMP $19a4 ; (sprintf + 3623)
+1a48 : 4c b2 19 JMP $19b2 ; (sprintf + 3637)
+1a4b : a5 51 __ LDA T7 + 0
+1a4d : 85 1b __ STA ACCU + 0
+1a4f : a5 52 __ LDA T7 + 1
+1a51 : 85 1c __ STA ACCU + 1
+1a53 : ad 87 23 LDA $2387 ; (sframe + 3)
+1a56 : 85 03 __ STA $03
+1a58 : ad 88 23 LDA $2388 ; (sframe + 4)
+1a5b : 85 04 __ STA $04
+1a5d : 20 3c 21 JSR $213c ; (divmod + 0)
+1a60 : a5 06 __ LDA $06
+1a62 : 10 2f __ BPL $1a93
+1a64 : 18 __ __ CLC
+1a65 : a5 05 __ LDA $05
+1a67 : 69 30 __ ADC #$30
+1a69 : c6 43 __ DEC T0 + 0
+1a6b : a4 43 __ LDY T0 + 0
+1a6d : 91 4f __ STA (T6 + 0),y
+1a6f : a5 51 __ LDA T7 + 0
+1a71 : 85 1b __ STA ACCU + 0
+1a73 : a5 52 __ LDA T7 + 1
+1a75 : 85 1c __ STA ACCU + 1
+1a77 : ad 87 23 LDA $2387 ; (sframe + 3)
+1a7a : 85 03 __ STA $03
+1a7c : ad 88 23 LDA $2388 ; (sframe + 4)
+1a7f : 85 04 __ STA $04
+1a81 : 20 3c 21 JSR $213c ; (divmod + 0)
+1a84 : a5 1b __ LDA ACCU + 0
+1a86 : 85 51 __ STA T7 + 0
+1a88 : a5 1c __ LDA ACCU + 1
+1a8a : 85 52 __ STA T7 + 1
+1a8c : 05 1b __ ORA ACCU + 0
+1a8e : d0 bb __ BNE $1a4b
+1a90 : 4c 8e 19 JMP $198e ; (sprintf + 3601)
+1a93 : d0 06 __ BNE $1a9b
+1a95 : a5 05 __ LDA $05
+1a97 : c9 0a __ CMP #$0a
+1a99 : 90 c9 __ BCC $1a64
+1a9b : 18 __ __ CLC
+1a9c : a5 05 __ LDA $05
+1a9e : 69 37 __ ADC #$37
+1aa0 : 4c 69 1a JMP $1a69 ; (sprintf + 3820)
+1aa3 : a5 49 __ LDA T3 + 0
+1aa5 : 85 4f __ STA T6 + 0
+1aa7 : a5 4a __ LDA T3 + 1
+1aa9 : 85 50 __ STA T6 + 1
+1aab : a0 00 __ LDY #$00
+1aad : b1 4b __ LDA (T4 + 0),y
+1aaf : 85 51 __ STA T7 + 0
+1ab1 : c8 __ __ INY
+1ab2 : b1 4b __ LDA (T4 + 0),y
+1ab4 : 85 52 __ STA T7 + 1
+1ab6 : 18 __ __ CLC
+1ab7 : a5 4b __ LDA T4 + 0
+1ab9 : 69 02 __ ADC #$02
+1abb : 85 4b __ STA T4 + 0
+1abd : 90 02 __ BCC $1ac1
+1abf : e6 4c __ INC T4 + 1
+1ac1 : a9 0a __ LDA #$0a
+1ac3 : 85 43 __ STA T0 + 0
+1ac5 : a5 51 __ LDA T7 + 0
+1ac7 : 05 52 __ ORA T7 + 1
+1ac9 : f0 03 __ BEQ $1ace
+1acb : 4c 8b 1b JMP $1b8b ; (sprintf + 4110)
+1ace : ad 86 23 LDA $2386 ; (sframe + 2)
+1ad1 : c9 ff __ CMP #$ff
+1ad3 : d0 03 __ BNE $1ad8
+1ad5 : 4c 7d 1b JMP $1b7d ; (sprintf + 4096)
+1ad8 : 38 __ __ SEC
+1ad9 : a9 0a __ LDA #$0a
+1adb : ed 86 23 SBC $2386 ; (sframe + 2)
+1ade : 85 47 __ STA T2 + 0
+1ae0 : c5 43 __ CMP T0 + 0
+1ae2 : b0 0e __ BCS $1af2
+1ae4 : c6 43 __ DEC T0 + 0
+1ae6 : a9 30 __ LDA #$30
+1ae8 : a4 43 __ LDY T0 + 0
+1aea : 91 4f __ STA (T6 + 0),y
+1aec : a5 47 __ LDA T2 + 0
+1aee : c5 43 __ CMP T0 + 0
+1af0 : 90 f2 __ BCC $1ae4
+1af2 : ad 8b 23 LDA $238b ; (sframe + 7)
+1af5 : f0 33 __ BEQ $1b2a
+1af7 : ad 87 23 LDA $2387 ; (sframe + 3)
+1afa : 85 51 __ STA T7 + 0
+1afc : ad 88 23 LDA $2388 ; (sframe + 4)
+1aff : d0 29 __ BNE $1b2a
+1b01 : a5 51 __ LDA T7 + 0
+1b03 : c9 10 __ CMP #$10
+1b05 : d0 23 __ BNE $1b2a
+1b07 : 18 __ __ CLC
+1b08 : a5 43 __ LDA T0 + 0
+1b0a : 69 ff __ ADC #$ff
+1b0c : 18 __ __ CLC
+1b0d : 65 4f __ ADC T6 + 0
+1b0f : 85 51 __ STA T7 + 0
+1b11 : a5 50 __ LDA T6 + 1
+1b13 : 69 00 __ ADC #$00
+1b15 : 85 52 __ STA T7 + 1
+1b17 : a9 58 __ LDA #$58
+1b19 : a0 00 __ LDY #$00
+1b1b : 91 51 __ STA (T7 + 0),y
+1b1d : 18 __ __ CLC
+1b1e : a5 43 __ LDA T0 + 0
+1b20 : 69 fe __ ADC #$fe
+1b22 : 85 43 __ STA T0 + 0
+1b24 : a9 30 __ LDA #$30
+1b26 : a4 43 __ LDY T0 + 0
+1b28 : 91 4f __ STA (T6 + 0),y
+1b2a : ad 89 23 LDA $2389 ; (sframe + 5)
+1b2d : f0 08 __ BEQ $1b37
+1b2f : c6 43 __ DEC T0 + 0
+1b31 : a9 2b __ LDA #$2b
+1b33 : a4 43 __ LDY T0 + 0
+1b35 : 91 4f __ STA (T6 + 0),y
+1b37 : 38 __ __ SEC
+1b38 : a9 0a __ LDA #$0a
+1b3a : ed 85 23 SBC $2385 ; (sframe + 1)
+1b3d : 85 51 __ STA T7 + 0
+1b3f : a9 00 __ LDA #$00
+1b41 : e9 00 __ SBC #$00
+1b43 : 49 80 __ EOR #$80
+1b45 : c9 80 __ CMP #$80
+1b47 : d0 04 __ BNE $1b4d
+1b49 : a5 51 __ LDA T7 + 0
+1b4b : c5 43 __ CMP T0 + 0
+1b4d : 90 22 __ BCC $1b71
+1b4f : a9 00 __ LDA #$00
+1b51 : 85 47 __ STA T2 + 0
+1b53 : a5 43 __ LDA T0 + 0
+1b55 : c9 0a __ CMP #$0a
+1b57 : 90 03 __ BCC $1b5c
+1b59 : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+1b5c : a4 43 __ LDY T0 + 0
+1b5e : b1 4f __ LDA (T6 + 0),y
+1b60 : a4 47 __ LDY T2 + 0
+1b62 : 91 4f __ STA (T6 + 0),y
+1b64 : e6 47 __ INC T2 + 0
+1b66 : e6 43 __ INC T0 + 0
+1b68 : a5 43 __ LDA T0 + 0
+1b6a : c9 0a __ CMP #$0a
+1b6c : 90 ee __ BCC $1b5c
+1b6e : 4c 1f 15 JMP $151f ; (sprintf + 2466)
+1b71 : c6 43 __ DEC T0 + 0
+1b73 : ad 84 23 LDA $2384 ; (sframe + 0)
+1b76 : a4 43 __ LDY T0 + 0
+1b78 : 91 4f __ STA (T6 + 0),y
+1b7a : 4c 37 1b JMP $1b37 ; (sprintf + 4026)
+1b7d : a9 09 __ LDA #$09
+1b7f : 85 47 __ STA T2 + 0
+1b81 : c5 43 __ CMP T0 + 0
+1b83 : b0 03 __ BCS $1b88
+1b85 : 4c e4 1a JMP $1ae4 ; (sprintf + 3943)
+1b88 : 4c f2 1a JMP $1af2 ; (sprintf + 3957)
+1b8b : a5 51 __ LDA T7 + 0
+1b8d : 85 1b __ STA ACCU + 0
+1b8f : a5 52 __ LDA T7 + 1
+1b91 : 85 1c __ STA ACCU + 1
+1b93 : ad 87 23 LDA $2387 ; (sframe + 3)
+1b96 : 85 03 __ STA $03
+1b98 : ad 88 23 LDA $2388 ; (sframe + 4)
+1b9b : 85 04 __ STA $04
+1b9d : 20 3c 21 JSR $213c ; (divmod + 0)
+1ba0 : a5 06 __ LDA $06
+1ba2 : 10 2f __ BPL $1bd3
+1ba4 : 18 __ __ CLC
+1ba5 : a5 05 __ LDA $05
+1ba7 : 69 30 __ ADC #$30
+1ba9 : c6 43 __ DEC T0 + 0
+1bab : a4 43 __ LDY T0 + 0
+1bad : 91 4f __ STA (T6 + 0),y
+1baf : a5 51 __ LDA T7 + 0
+1bb1 : 85 1b __ STA ACCU + 0
+1bb3 : a5 52 __ LDA T7 + 1
+1bb5 : 85 1c __ STA ACCU + 1
+1bb7 : ad 87 23 LDA $2387 ; (sframe + 3)
+1bba : 85 03 __ STA $03
+1bbc : ad 88 23 LDA $2388 ; (sframe + 4)
+1bbf : 85 04 __ STA $04
+1bc1 : 20 3c 21 JSR $213c ; (divmod + 0)
+1bc4 : a5 1b __ LDA ACCU + 0
+1bc6 : 85 51 __ STA T7 + 0
+1bc8 : a5 1c __ LDA ACCU + 1
+1bca : 85 52 __ STA T7 + 1
+1bcc : 05 1b __ ORA ACCU + 0
+1bce : d0 bb __ BNE $1b8b
+1bd0 : 4c ce 1a JMP $1ace ; (sprintf + 3921)
+1bd3 : d0 06 __ BNE $1bdb
+1bd5 : a5 05 __ LDA $05
+1bd7 : c9 0a __ CMP #$0a
+1bd9 : 90 c9 __ BCC $1ba4
+1bdb : 18 __ __ CLC
+1bdc : a5 05 __ LDA $05
+1bde : 69 37 __ ADC #$37
+1be0 : 4c a9 1b JMP $1ba9 ; (sprintf + 4140)
+1be3 : a5 49 __ LDA T3 + 0
+1be5 : 85 4f __ STA T6 + 0
+1be7 : a5 4a __ LDA T3 + 1
+1be9 : 85 50 __ STA T6 + 1
+1beb : a0 00 __ LDY #$00
+1bed : b1 4b __ LDA (T4 + 0),y
+1bef : 85 51 __ STA T7 + 0
+1bf1 : c8 __ __ INY
+1bf2 : b1 4b __ LDA (T4 + 0),y
+1bf4 : 85 52 __ STA T7 + 1
+1bf6 : 18 __ __ CLC
+1bf7 : a5 4b __ LDA T4 + 0
+1bf9 : 69 02 __ ADC #$02
+1bfb : 85 4b __ STA T4 + 0
+1bfd : 90 02 __ BCC $1c01
+1bff : e6 4c __ INC T4 + 1
+1c01 : a5 52 __ LDA T7 + 1
+1c03 : 10 03 __ BPL $1c08
+1c05 : 4c 45 1d JMP $1d45 ; (sprintf + 4552)
+1c08 : a5 51 __ LDA T7 + 0
+1c0a : 85 53 __ STA T8 + 0
+1c0c : a5 52 __ LDA T7 + 1
+1c0e : 85 54 __ STA T8 + 1
+1c10 : a9 00 __ LDA #$00
+1c12 : 85 43 __ STA T0 + 0
+1c14 : a9 0a __ LDA #$0a
+1c16 : 85 47 __ STA T2 + 0
+1c18 : a5 51 __ LDA T7 + 0
+1c1a : 05 52 __ ORA T7 + 1
+1c1c : f0 03 __ BEQ $1c21
+1c1e : 4c ed 1c JMP $1ced ; (sprintf + 4464)
+1c21 : ad 86 23 LDA $2386 ; (sframe + 2)
+1c24 : c9 ff __ CMP #$ff
+1c26 : d0 03 __ BNE $1c2b
+1c28 : 4c df 1c JMP $1cdf ; (sprintf + 4450)
+1c2b : 38 __ __ SEC
+1c2c : a9 0a __ LDA #$0a
+1c2e : ed 86 23 SBC $2386 ; (sframe + 2)
+1c31 : 85 4d __ STA T5 + 0
+1c33 : c5 47 __ CMP T2 + 0
+1c35 : b0 0e __ BCS $1c45
+1c37 : c6 47 __ DEC T2 + 0
+1c39 : a9 30 __ LDA #$30
+1c3b : a4 47 __ LDY T2 + 0
+1c3d : 91 4f __ STA (T6 + 0),y
+1c3f : a5 4d __ LDA T5 + 0
+1c41 : c5 47 __ CMP T2 + 0
+1c43 : 90 f2 __ BCC $1c37
+1c45 : ad 8b 23 LDA $238b ; (sframe + 7)
+1c48 : f0 33 __ BEQ $1c7d
+1c4a : ad 87 23 LDA $2387 ; (sframe + 3)
+1c4d : 85 51 __ STA T7 + 0
+1c4f : ad 88 23 LDA $2388 ; (sframe + 4)
+1c52 : d0 29 __ BNE $1c7d
+1c54 : a5 51 __ LDA T7 + 0
+1c56 : c9 10 __ CMP #$10
+1c58 : d0 23 __ BNE $1c7d
+1c5a : 18 __ __ CLC
+1c5b : a5 47 __ LDA T2 + 0
+1c5d : 69 ff __ ADC #$ff
+1c5f : 18 __ __ CLC
+1c60 : 65 4f __ ADC T6 + 0
+1c62 : 85 51 __ STA T7 + 0
+1c64 : a5 50 __ LDA T6 + 1
+1c66 : 69 00 __ ADC #$00
+1c68 : 85 52 __ STA T7 + 1
+1c6a : a9 58 __ LDA #$58
+1c6c : a0 00 __ LDY #$00
+1c6e : 91 51 __ STA (T7 + 0),y
+1c70 : 18 __ __ CLC
+1c71 : a5 47 __ LDA T2 + 0
+1c73 : 69 fe __ ADC #$fe
+1c75 : 85 47 __ STA T2 + 0
+1c77 : a9 30 __ LDA #$30
+1c79 : a4 47 __ LDY T2 + 0
+1c7b : 91 4f __ STA (T6 + 0),y
+1c7d : a5 43 __ LDA T0 + 0
+1c7f : d0 53 __ BNE $1cd4
+1c81 : ad 89 23 LDA $2389 ; (sframe + 5)
+1c84 : f0 08 __ BEQ $1c8e
+1c86 : c6 47 __ DEC T2 + 0
+1c88 : a9 2b __ LDA #$2b
+1c8a : a4 47 __ LDY T2 + 0
+1c8c : 91 4f __ STA (T6 + 0),y
+1c8e : 38 __ __ SEC
+1c8f : a9 0a __ LDA #$0a
+1c91 : ed 85 23 SBC $2385 ; (sframe + 1)
+1c94 : 85 51 __ STA T7 + 0
+1c96 : a9 00 __ LDA #$00
+1c98 : e9 00 __ SBC #$00
+1c9a : 49 80 __ EOR #$80
+1c9c : c9 80 __ CMP #$80
+1c9e : d0 04 __ BNE $1ca4
+1ca0 : a5 51 __ LDA T7 + 0
+1ca2 : c5 47 __ CMP T2 + 0
+1ca4 : 90 22 __ BCC $1cc8
+1ca6 : a9 00 __ LDA #$00
+1ca8 : 85 43 __ STA T0 + 0
+1caa : a5 47 __ LDA T2 + 0
+1cac : c9 0a __ CMP #$0a
+1cae : 90 03 __ BCC $1cb3
+1cb0 : 4c 1f 18 JMP $181f ; (sprintf + 3234)
+1cb3 : a4 47 __ LDY T2 + 0
+1cb5 : b1 4f __ LDA (T6 + 0),y
+1cb7 : a4 43 __ LDY T0 + 0
+1cb9 : 91 4f __ STA (T6 + 0),y
+1cbb : e6 43 __ INC T0 + 0
+1cbd : e6 47 __ INC T2 + 0
+1cbf : a5 47 __ LDA T2 + 0
+1cc1 : c9 0a __ CMP #$0a
+1cc3 : 90 ee __ BCC $1cb3
+1cc5 : 4c 1f 18 JMP $181f ; (sprintf + 3234)
+1cc8 : c6 47 __ DEC T2 + 0
+1cca : ad 84 23 LDA $2384 ; (sframe + 0)
+1ccd : a4 47 __ LDY T2 + 0
+1ccf : 91 4f __ STA (T6 + 0),y
+1cd1 : 4c 8e 1c JMP $1c8e ; (sprintf + 4369)
+1cd4 : c6 47 __ DEC T2 + 0
+1cd6 : a9 2d __ LDA #$2d
+1cd8 : a4 47 __ LDY T2 + 0
+1cda : 91 4f __ STA (T6 + 0),y
+1cdc : 4c 8e 1c JMP $1c8e ; (sprintf + 4369)
+1cdf : a9 09 __ LDA #$09
+1ce1 : 85 4d __ STA T5 + 0
+1ce3 : c5 47 __ CMP T2 + 0
+1ce5 : b0 03 __ BCS $1cea
+1ce7 : 4c 37 1c JMP $1c37 ; (sprintf + 4282)
+1cea : 4c 45 1c JMP $1c45 ; (sprintf + 4296)
+1ced : a5 53 __ LDA T8 + 0
+1cef : 85 1b __ STA ACCU + 0
+1cf1 : a5 54 __ LDA T8 + 1
+1cf3 : 85 1c __ STA ACCU + 1
+1cf5 : ad 87 23 LDA $2387 ; (sframe + 3)
+1cf8 : 85 03 __ STA $03
+1cfa : ad 88 23 LDA $2388 ; (sframe + 4)
+1cfd : 85 04 __ STA $04
+1cff : 20 3c 21 JSR $213c ; (divmod + 0)
+1d02 : a5 06 __ LDA $06
+1d04 : 10 2f __ BPL $1d35
+1d06 : 18 __ __ CLC
+1d07 : a5 05 __ LDA $05
+1d09 : 69 30 __ ADC #$30
+1d0b : c6 47 __ DEC T2 + 0
+1d0d : a4 47 __ LDY T2 + 0
+1d0f : 91 4f __ STA (T6 + 0),y
+1d11 : a5 53 __ LDA T8 + 0
+1d13 : 85 1b __ STA ACCU + 0
+1d15 : a5 54 __ LDA T8 + 1
+1d17 : 85 1c __ STA ACCU + 1
+1d19 : ad 87 23 LDA $2387 ; (sframe + 3)
+1d1c : 85 03 __ STA $03
+1d1e : ad 88 23 LDA $2388 ; (sframe + 4)
+1d21 : 85 04 __ STA $04
+1d23 : 20 3c 21 JSR $213c ; (divmod + 0)
+1d26 : a5 1b __ LDA ACCU + 0
+1d28 : 85 53 __ STA T8 + 0
+1d2a : a5 1c __ LDA ACCU + 1
+1d2c : 85 54 __ STA T8 + 1
+1d2e : 05 1b __ ORA ACCU + 0
+1d30 : d0 bb __ BNE $1ced
+1d32 : 4c 21 1c JMP $1c21 ; (sprintf + 4260)
+1d35 : d0 06 __ BNE $1d3d
+1d37 : a5 05 __ LDA $05
+1d39 : c9 0a __ CMP #$0a
+1d3b : 90 c9 __ BCC $1d06
+1d3d : 18 __ __ CLC
+1d3e : a5 05 __ LDA $05
+1d40 : 69 37 __ ADC #$37
+1d42 : 4c 0b 1d JMP $1d0b ; (sprintf + 4494)
+1d45 : a9 01 __ LDA #$01
+1d47 : 85 43 __ STA T0 + 0
+1d49 : a9 0a __ LDA #$0a
+1d4b : 85 47 __ STA T2 + 0
+1d4d : 38 __ __ SEC
+1d4e : a9 00 __ LDA #$00
+1d50 : e5 51 __ SBC T7 + 0
+1d52 : 85 53 __ STA T8 + 0
+1d54 : a9 00 __ LDA #$00
+1d56 : e5 52 __ SBC T7 + 1
+1d58 : 85 54 __ STA T8 + 1
+1d5a : 05 53 __ ORA T8 + 0
+1d5c : d0 8f __ BNE $1ced
+1d5e : 4c 21 1c JMP $1c21 ; (sprintf + 4260)
+1d61 : a9 00 __ LDA #$00
+1d63 : 85 4f __ STA T6 + 0
+1d65 : 85 50 __ STA T6 + 1
+1d67 : a0 00 __ LDY #$00
+1d69 : b1 45 __ LDA (T1 + 0),y
+1d6b : 85 47 __ STA T2 + 0
+1d6d : e6 45 __ INC T1 + 0
+1d6f : d0 02 __ BNE $1d73
+1d71 : e6 46 __ INC T1 + 1
+1d73 : a5 47 __ LDA T2 + 0
+1d75 : c9 30 __ CMP #$30
+1d77 : 90 4f __ BCC $1dc8
+1d79 : a9 39 __ LDA #$39
+1d7b : c5 47 __ CMP T2 + 0
+1d7d : 90 49 __ BCC $1dc8
+1d7f : a5 47 __ LDA T2 + 0
+1d81 : 85 51 __ STA T7 + 0
+1d83 : a0 00 __ LDY #$00
+1d85 : b1 45 __ LDA (T1 + 0),y
+1d87 : 85 47 __ STA T2 + 0
+1d89 : e6 45 __ INC T1 + 0
+1d8b : d0 02 __ BNE $1d8f
+1d8d : e6 46 __ INC T1 + 1
+1d8f : a5 4f __ LDA T6 + 0
+1d91 : 0a __ __ ASL
+1d92 : 85 07 __ STA $07
+1d94 : a5 50 __ LDA T6 + 1
+1d96 : 2a __ __ ROL
+1d97 : 06 07 __ ASL $07
+1d99 : 2a __ __ ROL
+1d9a : 85 08 __ STA $08
+1d9c : 18 __ __ CLC
+1d9d : a5 07 __ LDA $07
+1d9f : 65 4f __ ADC T6 + 0
+1da1 : 85 1b __ STA ACCU + 0
+1da3 : a5 08 __ LDA $08
+1da5 : 65 50 __ ADC T6 + 1
+1da7 : 06 1b __ ASL ACCU + 0
+1da9 : 2a __ __ ROL
+1daa : 85 1c __ STA ACCU + 1
+1dac : 18 __ __ CLC
+1dad : a5 1b __ LDA ACCU + 0
+1daf : 65 51 __ ADC T7 + 0
+1db1 : aa __ __ TAX
+1db2 : a5 1c __ LDA ACCU + 1
+1db4 : 69 00 __ ADC #$00
+1db6 : a8 __ __ TAY
+1db7 : 38 __ __ SEC
+1db8 : 8a __ __ TXA
+1db9 : e9 30 __ SBC #$30
+1dbb : 85 4f __ STA T6 + 0
+1dbd : 98 __ __ TYA
+1dbe : e9 00 __ SBC #$00
+1dc0 : 85 50 __ STA T6 + 1
+1dc2 : a5 47 __ LDA T2 + 0
+1dc4 : c9 30 __ CMP #$30
+1dc6 : b0 b1 __ BCS $1d79
+1dc8 : a5 4f __ LDA T6 + 0
+1dca : 8d 86 23 STA $2386 ; (sframe + 2)
+1dcd : 4c f9 0c JMP $0cf9 ; (sprintf + 380)
+1dd0 : a9 01 __ LDA #$01
+1dd2 : 8d 8b 23 STA $238b ; (sframe + 7)
+1dd5 : a0 00 __ LDY #$00
+1dd7 : b1 45 __ LDA (T1 + 0),y
+1dd9 : 85 47 __ STA T2 + 0
+1ddb : 4c 69 0c JMP $0c69 ; (sprintf + 236)
+1dde : a9 30 __ LDA #$30
+1de0 : 8d 84 23 STA $2384 ; (sframe + 0)
+1de3 : a0 00 __ LDY #$00
+1de5 : b1 45 __ LDA (T1 + 0),y
+1de7 : 85 47 __ STA T2 + 0
+1de9 : 4c 69 0c JMP $0c69 ; (sprintf + 236)
+1dec : a9 01 __ LDA #$01
+1dee : 8d 89 23 STA $2389 ; (sframe + 5)
+1df1 : a0 00 __ LDY #$00
+1df3 : b1 45 __ LDA (T1 + 0),y
+1df5 : 85 47 __ STA T2 + 0
+1df7 : 4c 69 0c JMP $0c69 ; (sprintf + 236)
+--------------------------------------------------------------------
+strcmp:
+1e29 : a0 00 __ LDY #$00
+1e2b : 84 1c __ STY ACCU + 1
+1e2d : b1 0d __ LDA (P0),y
+1e2f : f0 16 __ BEQ $1e47
+1e31 : d1 0f __ CMP (P2),y
+1e33 : d0 16 __ BNE $1e4b
+1e35 : c8 __ __ INY
+1e36 : b1 0d __ LDA (P0),y
+1e38 : f0 0d __ BEQ $1e47
+1e3a : d1 0f __ CMP (P2),y
+1e3c : d0 0d __ BNE $1e4b
+1e3e : c8 __ __ INY
+1e3f : d0 ec __ BNE $1e2d
+1e41 : e6 0e __ INC P1
+1e43 : e6 10 __ INC P3
+1e45 : d0 e6 __ BNE $1e2d
+1e47 : d1 0f __ CMP (P2),y
+1e49 : f0 0a __ BEQ $1e55
+1e4b : b0 06 __ BCS $1e53
+1e4d : a9 ff __ LDA #$ff
+1e4f : 85 1c __ STA ACCU + 1
+1e51 : 30 02 __ BMI $1e55
+1e53 : a9 01 __ LDA #$01
+1e55 : 85 1b __ STA ACCU + 0
+1e57 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1e66 : a9 4c __ LDA #$4c
+1e68 : 85 54 __ STA $54
+1e6a : a9 00 __ LDA #$00
+1e6c : 85 13 __ STA P6
+1e6e : a9 19 __ LDA #$19
+1e70 : 85 16 __ STA P9
+1e72 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+1e73 : a9 00 __ LDA #$00
+1e75 : 85 05 __ STA $05
+1e77 : 85 06 __ STA $06
+1e79 : a5 03 __ LDA $03
+1e7b : 4a __ __ LSR
+1e7c : 90 0f __ BCC $1e8d
+1e7e : aa __ __ TAX
+1e7f : 18 __ __ CLC
+1e80 : a5 05 __ LDA $05
+1e82 : 65 1b __ ADC ACCU + 0
+1e84 : 85 05 __ STA $05
+1e86 : a5 06 __ LDA $06
+1e88 : 65 1c __ ADC ACCU + 1
+1e8a : 85 06 __ STA $06
+1e8c : 8a __ __ TXA
+1e8d : 06 1b __ ASL ACCU + 0
+1e8f : 26 1c __ ROL ACCU + 1
+1e91 : 4a __ __ LSR
+1e92 : b0 ea __ BCS $1e7e
+1e94 : d0 f7 __ BNE $1e8d
+1e96 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1e97 : b1 19 __ LDA (IP + 0),y
+1e99 : c8 __ __ INY
+1e9a : aa __ __ TAX
+1e9b : b5 00 __ LDA $00,x
+1e9d : 85 03 __ STA $03
+1e9f : b5 01 __ LDA $01,x
+1ea1 : 85 04 __ STA $04
+1ea3 : b5 02 __ LDA $02,x
+1ea5 : 85 05 __ STA $05
+1ea7 : b5 03 __ LDA $03,x
+1ea9 : 85 06 __ STA $06
+1eab : a5 05 __ LDA $05
+1ead : 0a __ __ ASL
+1eae : a5 06 __ LDA $06
+1eb0 : 2a __ __ ROL
+1eb1 : 85 08 __ STA $08
+1eb3 : f0 06 __ BEQ $1ebb
+1eb5 : a5 05 __ LDA $05
+1eb7 : 09 80 __ ORA #$80
+1eb9 : 85 05 __ STA $05
+1ebb : a5 1d __ LDA ACCU + 2
+1ebd : 0a __ __ ASL
+1ebe : a5 1e __ LDA ACCU + 3
+1ec0 : 2a __ __ ROL
+1ec1 : 85 07 __ STA $07
+1ec3 : f0 06 __ BEQ $1ecb
+1ec5 : a5 1d __ LDA ACCU + 2
+1ec7 : 09 80 __ ORA #$80
+1ec9 : 85 1d __ STA ACCU + 2
+1ecb : 60 __ __ RTS
+1ecc : 06 1e __ ASL ACCU + 3
+1ece : a5 07 __ LDA $07
+1ed0 : 6a __ __ ROR
+1ed1 : 85 1e __ STA ACCU + 3
+1ed3 : b0 06 __ BCS $1edb
+1ed5 : a5 1d __ LDA ACCU + 2
+1ed7 : 29 7f __ AND #$7f
+1ed9 : 85 1d __ STA ACCU + 2
+1edb : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1edc : 38 __ __ SEC
+1edd : a5 07 __ LDA $07
+1edf : e5 08 __ SBC $08
+1ee1 : f0 38 __ BEQ $1f1b
+1ee3 : aa __ __ TAX
+1ee4 : b0 25 __ BCS $1f0b
+1ee6 : e0 e9 __ CPX #$e9
+1ee8 : b0 0e __ BCS $1ef8
+1eea : a5 08 __ LDA $08
+1eec : 85 07 __ STA $07
+1eee : a9 00 __ LDA #$00
+1ef0 : 85 1b __ STA ACCU + 0
+1ef2 : 85 1c __ STA ACCU + 1
+1ef4 : 85 1d __ STA ACCU + 2
+1ef6 : f0 23 __ BEQ $1f1b
+1ef8 : a5 1d __ LDA ACCU + 2
+1efa : 4a __ __ LSR
+1efb : 66 1c __ ROR ACCU + 1
+1efd : 66 1b __ ROR ACCU + 0
+1eff : e8 __ __ INX
+1f00 : d0 f8 __ BNE $1efa
+1f02 : 85 1d __ STA ACCU + 2
+1f04 : a5 08 __ LDA $08
+1f06 : 85 07 __ STA $07
+1f08 : 4c 1b 1f JMP $1f1b ; (faddsub + 63)
+1f0b : e0 18 __ CPX #$18
+1f0d : b0 33 __ BCS $1f42
+1f0f : a5 05 __ LDA $05
+1f11 : 4a __ __ LSR
+1f12 : 66 04 __ ROR $04
+1f14 : 66 03 __ ROR $03
+1f16 : ca __ __ DEX
+1f17 : d0 f8 __ BNE $1f11
+1f19 : 85 05 __ STA $05
+1f1b : a5 1e __ LDA ACCU + 3
+1f1d : 29 80 __ AND #$80
+1f1f : 85 1e __ STA ACCU + 3
+1f21 : 45 06 __ EOR $06
+1f23 : 30 2d __ BMI $1f52
+1f25 : 18 __ __ CLC
+1f26 : a5 1b __ LDA ACCU + 0
+1f28 : 65 03 __ ADC $03
+1f2a : 85 1b __ STA ACCU + 0
+1f2c : a5 1c __ LDA ACCU + 1
+1f2e : 65 04 __ ADC $04
+1f30 : 85 1c __ STA ACCU + 1
+1f32 : a5 1d __ LDA ACCU + 2
+1f34 : 65 05 __ ADC $05
+1f36 : 85 1d __ STA ACCU + 2
+1f38 : 90 08 __ BCC $1f42
+1f3a : 66 1d __ ROR ACCU + 2
+1f3c : 66 1c __ ROR ACCU + 1
+1f3e : 66 1b __ ROR ACCU + 0
+1f40 : e6 07 __ INC $07
+1f42 : a5 07 __ LDA $07
+1f44 : 4a __ __ LSR
+1f45 : 05 1e __ ORA ACCU + 3
+1f47 : 85 1e __ STA ACCU + 3
+1f49 : b0 06 __ BCS $1f51
+1f4b : a5 1d __ LDA ACCU + 2
+1f4d : 29 7f __ AND #$7f
+1f4f : 85 1d __ STA ACCU + 2
+1f51 : 60 __ __ RTS
+1f52 : 38 __ __ SEC
+1f53 : a5 1b __ LDA ACCU + 0
+1f55 : e5 03 __ SBC $03
+1f57 : 85 1b __ STA ACCU + 0
+1f59 : a5 1c __ LDA ACCU + 1
+1f5b : e5 04 __ SBC $04
+1f5d : 85 1c __ STA ACCU + 1
+1f5f : a5 1d __ LDA ACCU + 2
+1f61 : e5 05 __ SBC $05
+1f63 : 85 1d __ STA ACCU + 2
+1f65 : b0 19 __ BCS $1f80
+1f67 : 38 __ __ SEC
+1f68 : a9 00 __ LDA #$00
+1f6a : e5 1b __ SBC ACCU + 0
+1f6c : 85 1b __ STA ACCU + 0
+1f6e : a9 00 __ LDA #$00
+1f70 : e5 1c __ SBC ACCU + 1
+1f72 : 85 1c __ STA ACCU + 1
+1f74 : a9 00 __ LDA #$00
+1f76 : e5 1d __ SBC ACCU + 2
+1f78 : 85 1d __ STA ACCU + 2
+1f7a : a5 1e __ LDA ACCU + 3
+1f7c : 49 80 __ EOR #$80
+1f7e : 85 1e __ STA ACCU + 3
+1f80 : a5 1d __ LDA ACCU + 2
+1f82 : 30 be __ BMI $1f42
+1f84 : 05 1c __ ORA ACCU + 1
+1f86 : 05 1b __ ORA ACCU + 0
+1f88 : f0 0f __ BEQ $1f99
+1f8a : c6 07 __ DEC $07
+1f8c : f0 0b __ BEQ $1f99
+1f8e : 06 1b __ ASL ACCU + 0
+1f90 : 26 1c __ ROL ACCU + 1
+1f92 : 26 1d __ ROL ACCU + 2
+1f94 : 10 f4 __ BPL $1f8a
+1f96 : 4c 42 1f JMP $1f42 ; (faddsub + 102)
+1f99 : a9 00 __ LDA #$00
+1f9b : 85 1b __ STA ACCU + 0
+1f9d : 85 1c __ STA ACCU + 1
+1f9f : 85 1d __ STA ACCU + 2
+1fa1 : 85 1e __ STA ACCU + 3
+1fa3 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1fa4 : a5 1b __ LDA ACCU + 0
+1fa6 : 05 1c __ ORA ACCU + 1
+1fa8 : 05 1d __ ORA ACCU + 2
+1faa : d0 03 __ BNE $1faf
+1fac : 85 1e __ STA ACCU + 3
+1fae : 60 __ __ RTS
+1faf : a5 03 __ LDA $03
+1fb1 : 05 04 __ ORA $04
+1fb3 : 05 05 __ ORA $05
+1fb5 : d0 09 __ BNE $1fc0
+1fb7 : 85 1b __ STA ACCU + 0
+1fb9 : 85 1c __ STA ACCU + 1
+1fbb : 85 1d __ STA ACCU + 2
+1fbd : 85 1e __ STA ACCU + 3
+1fbf : 60 __ __ RTS
+1fc0 : a9 00 __ LDA #$00
+1fc2 : 85 09 __ STA $09
+1fc4 : 85 0a __ STA $0a
+1fc6 : 85 0b __ STA $0b
+1fc8 : a4 1b __ LDY ACCU + 0
+1fca : a5 03 __ LDA $03
+1fcc : d0 06 __ BNE $1fd4
+1fce : a5 04 __ LDA $04
+1fd0 : f0 0a __ BEQ $1fdc
+1fd2 : d0 05 __ BNE $1fd9
+1fd4 : 20 14 20 JSR $2014 ; (fmul8 + 0)
+1fd7 : a5 04 __ LDA $04
+1fd9 : 20 14 20 JSR $2014 ; (fmul8 + 0)
+1fdc : a5 05 __ LDA $05
+1fde : 20 14 20 JSR $2014 ; (fmul8 + 0)
+1fe1 : 38 __ __ SEC
+1fe2 : a5 0b __ LDA $0b
+1fe4 : 30 06 __ BMI $1fec
+1fe6 : 06 09 __ ASL $09
+1fe8 : 26 0a __ ROL $0a
+1fea : 2a __ __ ROL
+1feb : 18 __ __ CLC
+1fec : 29 7f __ AND #$7f
+1fee : 85 0b __ STA $0b
+1ff0 : a5 1e __ LDA ACCU + 3
+1ff2 : 45 06 __ EOR $06
+1ff4 : 29 80 __ AND #$80
+1ff6 : 85 1e __ STA ACCU + 3
+1ff8 : a5 07 __ LDA $07
+1ffa : e9 7e __ SBC #$7e
+1ffc : 18 __ __ CLC
+1ffd : 65 08 __ ADC $08
+1fff : 4a __ __ LSR
+2000 : 05 1e __ ORA ACCU + 3
+2002 : 85 1e __ STA ACCU + 3
+2004 : a9 00 __ LDA #$00
+2006 : 6a __ __ ROR
+2007 : 05 0b __ ORA $0b
+2009 : 85 1d __ STA ACCU + 2
+200b : a5 0a __ LDA $0a
+200d : 85 1c __ STA ACCU + 1
+200f : a5 09 __ LDA $09
+2011 : 85 1b __ STA ACCU + 0
+2013 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+2014 : 38 __ __ SEC
+2015 : 6a __ __ ROR
+2016 : 90 1e __ BCC $2036
+2018 : aa __ __ TAX
+2019 : 18 __ __ CLC
+201a : 98 __ __ TYA
+201b : 65 09 __ ADC $09
+201d : 85 09 __ STA $09
+201f : a5 0a __ LDA $0a
+2021 : 65 1c __ ADC ACCU + 1
+2023 : 85 0a __ STA $0a
+2025 : a5 0b __ LDA $0b
+2027 : 65 1d __ ADC ACCU + 2
+2029 : 6a __ __ ROR
+202a : 85 0b __ STA $0b
+202c : 8a __ __ TXA
+202d : 66 0a __ ROR $0a
+202f : 66 09 __ ROR $09
+2031 : 4a __ __ LSR
+2032 : f0 0d __ BEQ $2041
+2034 : b0 e2 __ BCS $2018
+2036 : 66 0b __ ROR $0b
+2038 : 66 0a __ ROR $0a
+203a : 66 09 __ ROR $09
+203c : 4a __ __ LSR
+203d : 90 f7 __ BCC $2036
+203f : d0 d7 __ BNE $2018
+2041 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+2042 : a5 1b __ LDA ACCU + 0
+2044 : 05 1c __ ORA ACCU + 1
+2046 : 05 1d __ ORA ACCU + 2
+2048 : d0 03 __ BNE $204d
+204a : 85 1e __ STA ACCU + 3
+204c : 60 __ __ RTS
+204d : a5 1e __ LDA ACCU + 3
+204f : 45 06 __ EOR $06
+2051 : 29 80 __ AND #$80
+2053 : 85 1e __ STA ACCU + 3
+2055 : a9 00 __ LDA #$00
+2057 : 85 09 __ STA $09
+2059 : 85 0a __ STA $0a
+205b : 85 0b __ STA $0b
+205d : a2 18 __ LDX #$18
+205f : a5 1b __ LDA ACCU + 0
+2061 : c5 03 __ CMP $03
+2063 : a5 1c __ LDA ACCU + 1
+2065 : e5 04 __ SBC $04
+2067 : a5 1d __ LDA ACCU + 2
+2069 : e5 05 __ SBC $05
+206b : 90 13 __ BCC $2080
+206d : a5 1b __ LDA ACCU + 0
+206f : e5 03 __ SBC $03
+2071 : 85 1b __ STA ACCU + 0
+2073 : a5 1c __ LDA ACCU + 1
+2075 : e5 04 __ SBC $04
+2077 : 85 1c __ STA ACCU + 1
+2079 : a5 1d __ LDA ACCU + 2
+207b : e5 05 __ SBC $05
+207d : 85 1d __ STA ACCU + 2
+207f : 38 __ __ SEC
+2080 : 26 09 __ ROL $09
+2082 : 26 0a __ ROL $0a
+2084 : 26 0b __ ROL $0b
+2086 : ca __ __ DEX
+2087 : f0 0a __ BEQ $2093
+2089 : 06 1b __ ASL ACCU + 0
+208b : 26 1c __ ROL ACCU + 1
+208d : 26 1d __ ROL ACCU + 2
+208f : b0 dc __ BCS $206d
+2091 : 90 cc __ BCC $205f
+2093 : 38 __ __ SEC
+2094 : a5 0b __ LDA $0b
+2096 : 30 06 __ BMI $209e
+2098 : 06 09 __ ASL $09
+209a : 26 0a __ ROL $0a
+209c : 2a __ __ ROL
+209d : 18 __ __ CLC
+209e : 29 7f __ AND #$7f
+20a0 : 85 0b __ STA $0b
+20a2 : a5 08 __ LDA $08
+20a4 : 49 7f __ EOR #$7f
+20a6 : 65 07 __ ADC $07
+20a8 : 38 __ __ SEC
+20a9 : e9 01 __ SBC #$01
+20ab : 4a __ __ LSR
+20ac : 05 1e __ ORA ACCU + 3
+20ae : 85 1e __ STA ACCU + 3
+20b0 : a9 00 __ LDA #$00
+20b2 : 6a __ __ ROR
+20b3 : 05 0b __ ORA $0b
+20b5 : 85 1d __ STA ACCU + 2
+20b7 : a5 0a __ LDA $0a
+20b9 : 85 1c __ STA ACCU + 1
+20bb : a5 09 __ LDA $09
+20bd : 85 1b __ STA ACCU + 0
+20bf : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+20c0 : a0 00 __ LDY #$00
+20c2 : 84 06 __ STY $06
+20c4 : a5 03 __ LDA $03
+20c6 : a6 04 __ LDX $04
+20c8 : f0 1c __ BEQ $20e6
+20ca : 38 __ __ SEC
+20cb : 6a __ __ ROR
+20cc : 90 0d __ BCC $20db
+20ce : aa __ __ TAX
+20cf : 18 __ __ CLC
+20d0 : 98 __ __ TYA
+20d1 : 65 1b __ ADC ACCU + 0
+20d3 : a8 __ __ TAY
+20d4 : a5 06 __ LDA $06
+20d6 : 65 1c __ ADC ACCU + 1
+20d8 : 85 06 __ STA $06
+20da : 8a __ __ TXA
+20db : 06 1b __ ASL ACCU + 0
+20dd : 26 1c __ ROL ACCU + 1
+20df : 4a __ __ LSR
+20e0 : 90 f9 __ BCC $20db
+20e2 : d0 ea __ BNE $20ce
+20e4 : a5 04 __ LDA $04
+20e6 : 4a __ __ LSR
+20e7 : 90 0d __ BCC $20f6
+20e9 : aa __ __ TAX
+20ea : 18 __ __ CLC
+20eb : 98 __ __ TYA
+20ec : 65 1b __ ADC ACCU + 0
+20ee : a8 __ __ TAY
+20ef : a5 06 __ LDA $06
+20f1 : 65 1c __ ADC ACCU + 1
+20f3 : 85 06 __ STA $06
+20f5 : 8a __ __ TXA
+20f6 : 06 1b __ ASL ACCU + 0
+20f8 : 26 1c __ ROL ACCU + 1
+20fa : 4a __ __ LSR
+20fb : b0 ec __ BCS $20e9
+20fd : d0 f7 __ BNE $20f6
+20ff : 84 05 __ STY $05
+2101 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+2102 : 24 1c __ BIT ACCU + 1
+2104 : 10 0d __ BPL $2113
+2106 : 20 20 21 JSR $2120 ; (negaccu + 0)
+2109 : 24 04 __ BIT $04
+210b : 10 0d __ BPL $211a
+210d : 20 2e 21 JSR $212e ; (negtmp + 0)
+2110 : 4c 3c 21 JMP $213c ; (divmod + 0)
+2113 : 24 04 __ BIT $04
+2115 : 10 f9 __ BPL $2110
+2117 : 20 2e 21 JSR $212e ; (negtmp + 0)
+211a : 20 3c 21 JSR $213c ; (divmod + 0)
+211d : 4c 20 21 JMP $2120 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+2120 : 38 __ __ SEC
+2121 : a9 00 __ LDA #$00
+2123 : e5 1b __ SBC ACCU + 0
+2125 : 85 1b __ STA ACCU + 0
+2127 : a9 00 __ LDA #$00
+2129 : e5 1c __ SBC ACCU + 1
+212b : 85 1c __ STA ACCU + 1
+212d : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+212e : 38 __ __ SEC
+212f : a9 00 __ LDA #$00
+2131 : e5 03 __ SBC $03
+2133 : 85 03 __ STA $03
+2135 : a9 00 __ LDA #$00
+2137 : e5 04 __ SBC $04
+2139 : 85 04 __ STA $04
+213b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+213c : a5 1c __ LDA ACCU + 1
+213e : d0 31 __ BNE $2171
+2140 : a5 04 __ LDA $04
+2142 : d0 1e __ BNE $2162
+2144 : 85 06 __ STA $06
+2146 : a2 04 __ LDX #$04
+2148 : 06 1b __ ASL ACCU + 0
+214a : 2a __ __ ROL
+214b : c5 03 __ CMP $03
+214d : 90 02 __ BCC $2151
+214f : e5 03 __ SBC $03
+2151 : 26 1b __ ROL ACCU + 0
+2153 : 2a __ __ ROL
+2154 : c5 03 __ CMP $03
+2156 : 90 02 __ BCC $215a
+2158 : e5 03 __ SBC $03
+215a : 26 1b __ ROL ACCU + 0
+215c : ca __ __ DEX
+215d : d0 eb __ BNE $214a
+215f : 85 05 __ STA $05
+2161 : 60 __ __ RTS
+2162 : a5 1b __ LDA ACCU + 0
+2164 : 85 05 __ STA $05
+2166 : a5 1c __ LDA ACCU + 1
+2168 : 85 06 __ STA $06
+216a : a9 00 __ LDA #$00
+216c : 85 1b __ STA ACCU + 0
+216e : 85 1c __ STA ACCU + 1
+2170 : 60 __ __ RTS
+2171 : a5 04 __ LDA $04
+2173 : d0 1f __ BNE $2194
+2175 : a5 03 __ LDA $03
+2177 : 30 1b __ BMI $2194
+2179 : a9 00 __ LDA #$00
+217b : 85 06 __ STA $06
+217d : a2 10 __ LDX #$10
+217f : 06 1b __ ASL ACCU + 0
+2181 : 26 1c __ ROL ACCU + 1
+2183 : 2a __ __ ROL
+2184 : c5 03 __ CMP $03
+2186 : 90 02 __ BCC $218a
+2188 : e5 03 __ SBC $03
+218a : 26 1b __ ROL ACCU + 0
+218c : 26 1c __ ROL ACCU + 1
+218e : ca __ __ DEX
+218f : d0 f2 __ BNE $2183
+2191 : 85 05 __ STA $05
+2193 : 60 __ __ RTS
+2194 : a9 00 __ LDA #$00
+2196 : 85 05 __ STA $05
+2198 : 85 06 __ STA $06
+219a : 84 02 __ STY $02
+219c : a0 10 __ LDY #$10
+219e : 18 __ __ CLC
+219f : 26 1b __ ROL ACCU + 0
+21a1 : 26 1c __ ROL ACCU + 1
+21a3 : 26 05 __ ROL $05
+21a5 : 26 06 __ ROL $06
+21a7 : 38 __ __ SEC
+21a8 : a5 05 __ LDA $05
+21aa : e5 03 __ SBC $03
+21ac : aa __ __ TAX
+21ad : a5 06 __ LDA $06
+21af : e5 04 __ SBC $04
+21b1 : 90 04 __ BCC $21b7
+21b3 : 86 05 __ STX $05
+21b5 : 85 06 __ STA $06
+21b7 : 88 __ __ DEY
+21b8 : d0 e5 __ BNE $219f
+21ba : 26 1b __ ROL ACCU + 0
+21bc : 26 1c __ ROL ACCU + 1
+21be : a4 02 __ LDY $02
+21c0 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+21c1 : 24 1c __ BIT ACCU + 1
+21c3 : 10 0d __ BPL $21d2
+21c5 : 20 20 21 JSR $2120 ; (negaccu + 0)
+21c8 : 24 04 __ BIT $04
+21ca : 10 0d __ BPL $21d9
+21cc : 20 2e 21 JSR $212e ; (negtmp + 0)
+21cf : 4c 3c 21 JMP $213c ; (divmod + 0)
+21d2 : 24 04 __ BIT $04
+21d4 : 10 f9 __ BPL $21cf
+21d6 : 20 2e 21 JSR $212e ; (negtmp + 0)
+21d9 : 20 3c 21 JSR $213c ; (divmod + 0)
+21dc : 38 __ __ SEC
+21dd : a9 00 __ LDA #$00
+21df : e5 05 __ SBC $05
+21e1 : 85 05 __ STA $05
+21e3 : a9 00 __ LDA #$00
+21e5 : e5 06 __ SBC $06
+21e7 : 85 06 __ STA $06
+21e9 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+21ea : 20 bb 1e JSR $1ebb ; (freg + 36)
+21ed : a5 07 __ LDA $07
+21ef : c9 7f __ CMP #$7f
+21f1 : b0 07 __ BCS $21fa
+21f3 : a9 00 __ LDA #$00
+21f5 : 85 1b __ STA ACCU + 0
+21f7 : 85 1c __ STA ACCU + 1
+21f9 : 60 __ __ RTS
+21fa : 38 __ __ SEC
+21fb : e9 8e __ SBC #$8e
+21fd : 90 0a __ BCC $2209
+21ff : a9 ff __ LDA #$ff
+2201 : 85 1b __ STA ACCU + 0
+2203 : a9 7f __ LDA #$7f
+2205 : 85 1c __ STA ACCU + 1
+2207 : d0 08 __ BNE $2211
+2209 : aa __ __ TAX
+220a : 46 1d __ LSR ACCU + 2
+220c : 66 1c __ ROR ACCU + 1
+220e : e8 __ __ INX
+220f : d0 f9 __ BNE $220a
+2211 : 24 1e __ BIT ACCU + 3
+2213 : 10 0e __ BPL $2223
+2215 : 38 __ __ SEC
+2216 : a9 00 __ LDA #$00
+2218 : e5 1c __ SBC ACCU + 1
+221a : 85 1b __ STA ACCU + 0
+221c : a9 00 __ LDA #$00
+221e : e5 1d __ SBC ACCU + 2
+2220 : 85 1c __ STA ACCU + 1
+2222 : 60 __ __ RTS
+2223 : a5 1c __ LDA ACCU + 1
+2225 : 85 1b __ STA ACCU + 0
+2227 : a5 1d __ LDA ACCU + 2
+2229 : 85 1c __ STA ACCU + 1
+222b : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+222c : 24 1c __ BIT ACCU + 1
+222e : 30 03 __ BMI $2233
+2230 : 4c 4a 22 JMP $224a ; (uint16_to_float + 0)
+2233 : 38 __ __ SEC
+2234 : a9 00 __ LDA #$00
+2236 : e5 1b __ SBC ACCU + 0
+2238 : 85 1b __ STA ACCU + 0
+223a : a9 00 __ LDA #$00
+223c : e5 1c __ SBC ACCU + 1
+223e : 85 1c __ STA ACCU + 1
+2240 : 20 4a 22 JSR $224a ; (uint16_to_float + 0)
+2243 : a5 1e __ LDA ACCU + 3
+2245 : 09 80 __ ORA #$80
+2247 : 85 1e __ STA ACCU + 3
+2249 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+224a : a5 1b __ LDA ACCU + 0
+224c : 05 1c __ ORA ACCU + 1
+224e : d0 05 __ BNE $2255
+2250 : 85 1d __ STA ACCU + 2
+2252 : 85 1e __ STA ACCU + 3
+2254 : 60 __ __ RTS
+2255 : a2 8e __ LDX #$8e
+2257 : a5 1c __ LDA ACCU + 1
+2259 : 30 06 __ BMI $2261
+225b : ca __ __ DEX
+225c : 06 1b __ ASL ACCU + 0
+225e : 2a __ __ ROL
+225f : 10 fa __ BPL $225b
+2261 : 29 7f __ AND #$7f
+2263 : 85 1d __ STA ACCU + 2
+2265 : a5 1b __ LDA ACCU + 0
+2267 : 85 1c __ STA ACCU + 1
+2269 : 8a __ __ TXA
+226a : 4a __ __ LSR
+226b : 85 1e __ STA ACCU + 3
+226d : a9 00 __ LDA #$00
+226f : 85 1b __ STA ACCU + 0
+2271 : 6a __ __ ROR
+2272 : 05 1d __ ORA ACCU + 2
+2274 : 85 1d __ STA ACCU + 2
+2276 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2277 : a5 1e __ LDA ACCU + 3
+2279 : 45 06 __ EOR $06
+227b : 29 80 __ AND #$80
+227d : f0 1e __ BEQ $229d
+227f : a5 1e __ LDA ACCU + 3
+2281 : 29 7f __ AND #$7f
+2283 : 05 1d __ ORA ACCU + 2
+2285 : 05 1c __ ORA ACCU + 1
+2287 : 05 1b __ ORA ACCU + 0
+2289 : d0 0c __ BNE $2297
+228b : a5 06 __ LDA $06
+228d : 29 7f __ AND #$7f
+228f : 05 05 __ ORA $05
+2291 : 05 04 __ ORA $04
+2293 : 05 03 __ ORA $03
+2295 : f0 1e __ BEQ $22b5
+2297 : a5 1e __ LDA ACCU + 3
+2299 : 30 23 __ BMI $22be
+229b : 10 28 __ BPL $22c5
+229d : a5 1e __ LDA ACCU + 3
+229f : c5 06 __ CMP $06
+22a1 : d0 15 __ BNE $22b8
+22a3 : a5 1d __ LDA ACCU + 2
+22a5 : c5 05 __ CMP $05
+22a7 : d0 0f __ BNE $22b8
+22a9 : a5 1c __ LDA ACCU + 1
+22ab : c5 04 __ CMP $04
+22ad : d0 09 __ BNE $22b8
+22af : a5 1b __ LDA ACCU + 0
+22b1 : c5 03 __ CMP $03
+22b3 : d0 03 __ BNE $22b8
+22b5 : a9 00 __ LDA #$00
+22b7 : 60 __ __ RTS
+22b8 : b0 07 __ BCS $22c1
+22ba : 24 1e __ BIT ACCU + 3
+22bc : 30 07 __ BMI $22c5
+22be : a9 01 __ LDA #$01
+22c0 : 60 __ __ RTS
+22c1 : 24 1e __ BIT ACCU + 3
+22c3 : 30 f9 __ BMI $22be
+22c5 : a9 ff __ LDA #$ff
+22c7 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+22c8 : 84 02 __ STY $02
+22ca : a9 00 __ LDA #$00
+22cc : 85 07 __ STA $07
+22ce : 85 08 __ STA $08
+22d0 : 85 09 __ STA $09
+22d2 : 85 0a __ STA $0a
+22d4 : a0 20 __ LDY #$20
+22d6 : 18 __ __ CLC
+22d7 : 26 1b __ ROL ACCU + 0
+22d9 : 26 1c __ ROL ACCU + 1
+22db : 26 1d __ ROL ACCU + 2
+22dd : 26 1e __ ROL ACCU + 3
+22df : 26 07 __ ROL $07
+22e1 : 26 08 __ ROL $08
+22e3 : 26 09 __ ROL $09
+22e5 : 26 0a __ ROL $0a
+22e7 : a5 07 __ LDA $07
+22e9 : c5 03 __ CMP $03
+22eb : a5 08 __ LDA $08
+22ed : e5 04 __ SBC $04
+22ef : a5 09 __ LDA $09
+22f1 : e5 05 __ SBC $05
+22f3 : a5 0a __ LDA $0a
+22f5 : e5 06 __ SBC $06
+22f7 : 90 18 __ BCC $2311
+22f9 : a5 07 __ LDA $07
+22fb : e5 03 __ SBC $03
+22fd : 85 07 __ STA $07
+22ff : a5 08 __ LDA $08
+2301 : e5 04 __ SBC $04
+2303 : 85 08 __ STA $08
+2305 : a5 09 __ LDA $09
+2307 : e5 05 __ SBC $05
+2309 : 85 09 __ STA $09
+230b : a5 0a __ LDA $0a
+230d : e5 06 __ SBC $06
+230f : 85 0a __ STA $0a
+2311 : 88 __ __ DEY
+2312 : d0 c3 __ BNE $22d7
+2314 : 26 1b __ ROL ACCU + 0
+2316 : 26 1c __ ROL ACCU + 1
+2318 : 26 1d __ ROL ACCU + 2
+231a : 26 1e __ ROL ACCU + 3
+231c : a4 02 __ LDY $02
+231e : 60 __ __ RTS
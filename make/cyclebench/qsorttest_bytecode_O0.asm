@@ -0,0 +1,3124 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 70 22 STX $2270 ; (spentry + 0)
+0811 : a9 74 __ LDA #$74
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 51 __ LDA #$51
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 54 __ LDA #$54
+0832 : e9 74 __ SBC #$74
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	2, 4
+0a04:	PUSH	#$0006
+0a07:	LEA	T0, field + 0
+0a0b:	MOV	2(SP), T0
+0a0e:	MOV	ACCU, #$03e8
+0a12:	MOV	4(SP), ACCU
+0a15:	CALL	init + 0
+0a18:	MOV	2(SP), T0
+0a1b:	MOV	ACCU, #$03e8
+0a1f:	MOV	4(SP), ACCU
+0a22:	CALL	shuffle + 0
+0a25:	MOV	2(SP), T0
+0a28:	MOV	ACCU, #$03e8
+0a2c:	MOV	4(SP), ACCU
+0a2f:	CALL	qsort + 0
+0a32:	MOV	2(SP), T0
+0a35:	MOV	ACCU, #$03e8
+0a39:	MOV	4(SP), ACCU
+0a3c:	CALL	check + 0
+0a3f:	MOV	ACCU, #0
+0a42:	POP	#$0006
+0a45:	RETURN	2, 4
+--------------------------------------------------------------------
+init:
+0a49:	ENTER	8, 10
+0a4d:	PUSH	#$0008
+0a50:	MOV	ACCU, 4(FP)
+0a53:	CMPS	ACCU, #$0000
+0a56:	BLT	$0A5F
+0a58:	POP	#$0008
+0a5b:	RETURN	8, 10
+0a5f:	MOV	T0, #0
+0a62:	MOV	T2, 2(FP)
+0a65:	MOV	T3, 4(FP)
+0a68:	LEA	T4, $148d
+0a6c:	MOV	ADDR, T2
+0a6e:	MOV	0(ADDR), T0
+0a71:	MOV	ACCU, T2
+0a73:	ADD	ACCU, #$0002
+0a77:	MOV	2(SP), ACCU
+0a7a:	MOV	4(SP), T4
+0a7d:	MOV	6(SP), T0
+0a80:	CALL	sprintf + 0
+0a83:	ADD	T2, #$000C
+0a87:	ADD	T0, #$0001
+0a8b:	MOV	ACCU, T3
+0a8d:	CMPS	ACCU, T0
+0a8f:	BLT	$0A6C
+0a91:	JUMP	$0A58
+--------------------------------------------------------------------
+sprintf:
+0a93:	ENTER	0, 2
+0a97:	PUSH	#$0009
+0a9a:	MOV	T0, 2(FP)
+0a9d:	MOV	2(SP), T0
+0aa0:	MOV	T0, 4(FP)
+0aa3:	MOV	4(SP), T0
+0aa6:	LEA	T0, 6(FP)
+0aaa:	MOV	6(SP), T0
+0aad:	MOV	ACCU, #0
+0ab0:	MOVB	8(SP), ACCU
+0ab3:	CALL	sformat + 0
+0ab6:	MOV	T1, 2(FP)
+0ab9:	SUB	ACCU, T1
+0abb:	POP	#$0009
+0abe:	RETURN	0, 2
+--------------------------------------------------------------------
+sformat:
+0ac2:	ENTER	6, 16
+0ac6:	PUSH	#$0002
+0ac9:	MOV	T0, 10(FP)
+0acc:	MOVB	T1, #0
+0acf:	MOV	T2, 12(FP)
+0ad2:	MOV	ADDR, T2
+0ad4:	MOVB	T3, 0(ADDR)
+0ad7:	MOVB	ACCU, T3
+0ad9:	BNE	$0B0A
+0adb:	MOVB	ACCU, T1
+0add:	ADD	ACCU, T0
+0adf:	MOV	T2, ACCU
+0ae1:	MOV	ACCU, #0
+0ae4:	MOV	ADDR, T2
+0ae6:	MOVB	0(ADDR), ACCU
+0ae9:	MOVB	ACCU, T1
+0aeb:	BNE	$0AF6
+0aed:	MOV	ACCU, T0
+0aef:	POP	#$0002
+0af2:	RETURN	6, 16
+0af6:	MOVUB	ACCU, 16(FP)
+0af9:	BNE	$0AFF
+0afb:	MOV	ACCU, T2
+0afd:	JUMP	$0AEF
+0aff:	MOV	ACCU, T0
+0b01:	MOV	P0, ACCU
+0b03:	CALL	puts + 0
+0b06:	MOV	ACCU, T0
+0b08:	JUMP	$0AEF
+0b0a:	ADD	T2, #$0001
+0b0e:	MOVB	ACCU, T3
+0b10:	CMPUB	ACCU, #$0025
+0b12:	BEQ	$0B5F
+0b14:	MOVB	ACCU, T1
+0b16:	LEAX	ADDR, T0 + ACCU
+0b18:	MOVB	0(ADDR), T3
+0b1b:	ADDB	T1, #$0001
+0b1e:	MOVB	ACCU, T1
+0b20:	CMPUB	ACCU, #$0028
+0b22:	BLE	$0B35
+0b24:	MOV	ADDR, T2
+0b26:	MOVB	T4, 0(ADDR)
+0b29:	ADD	T2, #$0001
+0b2d:	MOVB	ACCU, T4
+0b2f:	MOVB	T3, ACCU
+0b31:	BNE	$0B0E
+0b33:	JUMP	$0ADB
+0b35:	MOVB	ACCU, T1
+0b37:	MOV	T5, ACCU
+0b39:	MOVUB	ACCU, 16(FP)
+0b3c:	BNE	$0B47
+0b3e:	MOV	ACCU, T5
+0b40:	ADD	T0, ACCU
+0b42:	MOVB	T1, #0
+0b45:	JUMP	$0B24
+0b47:	MOV	ACCU, T0
+0b49:	ADD	T5, ACCU
+0b4b:	MOV	ADDR, T5
+0b4d:	MOV	ACCU, #0
+0b50:	MOVB	0(ADDR), ACCU
+0b53:	MOV	ACCU, T0
+0b55:	MOV	P0, ACCU
+0b57:	CALL	puts + 0
+0b5a:	MOVB	T1, #0
+0b5d:	JUMP	$0B24
+0b5f:	MOVB	ACCU, T1
+0b61:	BNEF	$0E27
+0b64:	MOV	ADDR, T2
+0b66:	MOVB	T3, 0(ADDR)
+0b69:	MOV	ACCU, #10
+0b6c:	MOV	3(FP), ACCU
+0b6f:	MOV	ACCU, #1
+0b72:	MOVB	1(FP), ACCU
+0b75:	MOV	ACCU, #255
+0b78:	MOVB	2(FP), ACCU
+0b7b:	MOV	ACCU, #32
+0b7e:	MOVB	0(FP), ACCU
+0b81:	MOV	ACCU, #0
+0b84:	MOVB	5(FP), ACCU
+0b87:	MOVB	6(FP), ACCU
+0b8a:	MOVB	7(FP), ACCU
+0b8d:	ADD	T2, #$0001
+0b91:	MOVB	ACCU, T3
+0b93:	CMPUB	ACCU, #$002B
+0b95:	BEQF	$0E19
+0b98:	MOVB	ACCU, T3
+0b9a:	CMPUB	ACCU, #$0030
+0b9c:	BEQF	$0E0B
+0b9f:	MOVB	ACCU, T3
+0ba1:	CMPUB	ACCU, #$0023
+0ba3:	BEQF	$0DFD
+0ba6:	MOVB	ACCU, T3
+0ba8:	CMPUB	ACCU, #$0030
+0baa:	BGT	$0BB3
+0bac:	MOVB	ACCU, T3
+0bae:	CMPUB	ACCU, #$0039
+0bb0:	BGEF	$0DCC
+0bb3:	MOVB	ACCU, T3
+0bb5:	CMPUB	ACCU, #$002E
+0bb7:	BEQF	$0D92
+0bba:	MOVB	ACCU, T3
+0bbc:	CMPUB	ACCU, #$0064
+0bbe:	BEQF	$0D6E
+0bc1:	MOVB	ACCU, T3
+0bc3:	CMPUB	ACCU, #$0075
+0bc5:	BEQF	$0D4A
+0bc8:	MOVB	ACCU, T3
+0bca:	CMPUB	ACCU, #$0078
+0bcc:	BEQF	$0D20
+0bcf:	MOVB	ACCU, T3
+0bd1:	CMPUB	ACCU, #$006C
+0bd3:	BEQF	$0CA1
+0bd6:	MOVB	ACCU, T3
+0bd8:	CMPUB	ACCU, #$0066
+0bda:	BEQF	$0C70
+0bdd:	MOVB	ACCU, T3
+0bdf:	CMPUB	ACCU, #$0067
+0be1:	BEQF	$0C70
+0be4:	MOVB	ACCU, T3
+0be6:	CMPUB	ACCU, #$0065
+0be8:	BEQF	$0C70
+0beb:	MOVB	ACCU, T3
+0bed:	CMPUB	ACCU, #$0073
+0bef:	BEQ	$0C27
+0bf1:	MOVB	ACCU, T3
+0bf3:	CMPUB	ACCU, #$0063
+0bf5:	BEQ	$0C09
+0bf7:	MOVB	ACCU, T3
+0bf9:	BEQF	$0B24
+0bfc:	MOVB	ACCU, T1
+0bfe:	LEAX	ADDR, T0 + ACCU
+0c00:	MOVB	0(ADDR), T3
+0c03:	ADDB	T1, #$0001
+0c06:	JUMPF	$0B24
+0c09:	MOV	T5, 14(FP)
+0c0c:	MOV	ACCU, T5
+0c0e:	MOV	ADDR, T5
+0c10:	MOV	T5, 0(ADDR)
+0c13:	ADD	ACCU, #$0002
+0c17:	MOV	14(FP), ACCU
+0c1a:	MOVB	ACCU, T1
+0c1c:	LEAX	ADDR, T0 + ACCU
+0c1e:	MOVB	0(ADDR), T5
+0c21:	ADDB	T1, #$0001
+0c24:	JUMPF	$0B24
+0c27:	MOV	T5, 14(FP)
+0c2a:	MOV	ACCU, T5
+0c2c:	MOV	ADDR, T5
+0c2e:	MOV	T5, 0(ADDR)
+0c31:	ADD	ACCU, #$0002
+0c35:	MOV	14(FP), ACCU
+0c38:	MOVUB	ACCU, 16(FP)
+0c3b:	BNE	$0C66
+0c3d:	MOV	ADDR, T5
+0c3f:	MOVB	T3, 0(ADDR)
+0c42:	MOVB	ACCU, T3
+0c44:	BEQF	$0B24
+0c47:	ADD	T5, #$0001
+0c4b:	MOV	ADDR, T0
+0c4d:	MOVB	0(ADDR), T3
+0c50:	ADD	T0, #$0001
+0c54:	MOV	ADDR, T5
+0c56:	MOVB	T4, 0(ADDR)
+0c59:	ADD	T5, #$0001
+0c5d:	MOVB	ACCU, T4
+0c5f:	MOVB	T3, ACCU
+0c61:	BNE	$0C4B
+0c63:	JUMPF	$0B24
+0c66:	MOV	ACCU, T5
+0c68:	MOV	P0, ACCU
+0c6a:	CALL	puts + 0
+0c6d:	JUMPF	$0B24
+0c70:	LEA	P0, 0(FP)
+0c74:	MOV	ACCU, T0
+0c76:	MOV	P2, ACCU
+0c78:	MOV	ADDR, 14(FP)
+0c7b:	MOVD	T7, 0(ADDR)
+0c7e:	MOVD	ACCU, T7
+0c80:	MOVD	P4, ACCU
+0c82:	MOVB	ACCU, T3
+0c84:	MOVB	P8, ACCU
+0c86:	CALL	nformf + 0
+0c89:	MOV	T1, ACCU
+0c8b:	MOV	T5, 14(FP)
+0c8e:	MOV	ACCU, T5
+0c90:	ADD	ACCU, #$0002
+0c94:	MOV	14(FP), ACCU
+0c97:	ADD	T5, #$0004
+0c9b:	MOV	14(FP), T5
+0c9e:	JUMPF	$0B24
+0ca1:	MOV	T5, 14(FP)
+0ca4:	MOV	ADDR, T5
+0ca6:	MOVD	T7, 0(ADDR)
+0ca9:	MOV	ACCU, T5
+0cab:	ADD	ACCU, #$0002
+0caf:	MOV	14(FP), ACCU
+0cb2:	ADD	T5, #$0004
+0cb6:	MOV	14(FP), T5
+0cb9:	MOV	ADDR, T2
+0cbb:	MOVB	T3, 0(ADDR)
+0cbe:	ADD	T2, #$0001
+0cc2:	MOVB	ACCU, T3
+0cc4:	CMPUB	ACCU, #$0064
+0cc6:	BEQ	$0D09
+0cc8:	MOVB	ACCU, T3
+0cca:	CMPUB	ACCU, #$0075
+0ccc:	BEQ	$0CF2
+0cce:	MOVB	ACCU, T3
+0cd0:	CMPUB	ACCU, #$0078
+0cd2:	BNEF	$0B24
+0cd5:	MOV	ACCU, #16
+0cd8:	MOV	3(FP), ACCU
+0cdb:	LEA	P0, 0(FP)
+0cdf:	MOV	ACCU, T0
+0ce1:	MOV	P2, ACCU
+0ce3:	MOVD	ACCU, T7
+0ce5:	MOVD	P4, ACCU
+0ce7:	MOVB	P8, #0
+0cea:	CALL	nforml + 0
+0ced:	MOV	T1, ACCU
+0cef:	JUMPF	$0B24
+0cf2:	LEA	P0, 0(FP)
+0cf6:	MOV	ACCU, T0
+0cf8:	MOV	P2, ACCU
+0cfa:	MOVD	ACCU, T7
+0cfc:	MOVD	P4, ACCU
+0cfe:	MOVB	P8, #0
+0d01:	CALL	nforml + 0
+0d04:	MOV	T1, ACCU
+0d06:	JUMPF	$0B24
+0d09:	LEA	P0, 0(FP)
+0d0d:	MOV	ACCU, T0
+0d0f:	MOV	P2, ACCU
+0d11:	MOVD	ACCU, T7
+0d13:	MOVD	P4, ACCU
+0d15:	MOVB	P8, #1
+0d18:	CALL	nforml + 0
+0d1b:	MOV	T1, ACCU
+0d1d:	JUMPF	$0B24
+0d20:	MOV	ACCU, #16
+0d23:	MOV	3(FP), ACCU
+0d26:	LEA	P0, 0(FP)
+0d2a:	MOV	ACCU, T0
+0d2c:	MOV	P2, ACCU
+0d2e:	MOV	T5, 14(FP)
+0d31:	MOV	ACCU, T5
+0d33:	MOV	ADDR, T5
+0d35:	MOV	P4, 0(ADDR)
+0d38:	ADD	ACCU, #$0002
+0d3c:	MOV	14(FP), ACCU
+0d3f:	MOVB	P6, #0
+0d42:	CALL	nformi + 0
+0d45:	MOV	T1, ACCU
+0d47:	JUMPF	$0B24
+0d4a:	LEA	P0, 0(FP)
+0d4e:	MOV	ACCU, T0
+0d50:	MOV	P2, ACCU
+0d52:	MOV	T5, 14(FP)
+0d55:	MOV	ACCU, T5
+0d57:	MOV	ADDR, T5
+0d59:	MOV	P4, 0(ADDR)
+0d5c:	ADD	ACCU, #$0002
+0d60:	MOV	14(FP), ACCU
+0d63:	MOVB	P6, #0
+0d66:	CALL	nformi + 0
+0d69:	MOV	T1, ACCU
+0d6b:	JUMPF	$0B24
+0d6e:	LEA	P0, 0(FP)
+0d72:	MOV	ACCU, T0
+0d74:	MOV	P2, ACCU
+0d76:	MOV	T5, 14(FP)
+0d79:	MOV	ACCU, T5
+0d7b:	MOV	ADDR, T5
+0d7d:	MOV	P4, 0(ADDR)
+0d80:	ADD	ACCU, #$0002
+0d84:	MOV	14(FP), ACCU
+0d87:	MOVB	P6, #1
+0d8a:	CALL	nformi + 0
+0d8d:	MOV	T1, ACCU
+0d8f:	JUMPF	$0B24
+0d92:	MOV	T5, #0
+0d95:	MOV	ADDR, T2
+0d97:	MOVB	T3, 0(ADDR)
+0d9a:	ADD	T2, #$0001
+0d9e:	MOVB	ACCU, T3
+0da0:	CMPUB	ACCU, #$0030
+0da2:	BGT	$0DC6
+0da4:	MOVB	ACCU, T3
+0da6:	CMPUB	ACCU, #$0039
+0da8:	BLT	$0DC6
+0daa:	MOVB	ACCU, T3
+0dac:	MOV	T6, ACCU
+0dae:	MOV	ADDR, T2
+0db0:	MOVB	T3, 0(ADDR)
+0db3:	ADD	T2, #$0001
+0db7:	MUL	T5, #10
+0dba:	ADD	T5, ACCU
+0dbc:	ADD	T5, #$FFD0
+0dc0:	MOVB	ACCU, T3
+0dc2:	CMPUB	ACCU, #$0030
+0dc4:	BLE	$0DA4
+0dc6:	MOVB	2(FP), T5
+0dc9:	JUMPF	$0BBA
+0dcc:	MOV	T5, #0
+0dcf:	MOVB	ACCU, T3
+0dd1:	CMPUB	ACCU, #$0030
+0dd3:	BGT	$0DF7
+0dd5:	MOVB	ACCU, T3
+0dd7:	CMPUB	ACCU, #$0039
+0dd9:	BLT	$0DF7
+0ddb:	MOVB	ACCU, T3
+0ddd:	MOV	T6, ACCU
+0ddf:	MOV	ADDR, T2
+0de1:	MOVB	T3, 0(ADDR)
+0de4:	ADD	T2, #$0001
+0de8:	MUL	T5, #10
+0deb:	ADD	T5, ACCU
+0ded:	ADD	T5, #$FFD0
+0df1:	MOVB	ACCU, T3
+0df3:	CMPUB	ACCU, #$0030
+0df5:	BLE	$0DD5
+0df7:	MOVB	1(FP), T5
+0dfa:	JUMPF	$0BB3
+0dfd:	MOV	ACCU, #1
+0e00:	MOVB	7(FP), ACCU
+0e03:	MOV	ADDR, T2
+0e05:	MOVB	T3, 0(ADDR)
+0e08:	JUMPF	$0B8D
+0e0b:	MOV	ACCU, #48
+0e0e:	MOVB	0(FP), ACCU
+0e11:	MOV	ADDR, T2
+0e13:	MOVB	T3, 0(ADDR)
+0e16:	JUMPF	$0B8D
+0e19:	MOV	ACCU, #1
+0e1c:	MOVB	5(FP), ACCU
+0e1f:	MOV	ADDR, T2
+0e21:	MOVB	T3, 0(ADDR)
+0e24:	JUMPF	$0B8D
+0e27:	MOVUB	ACCU, 16(FP)
+0e2a:	BNE	$0E36
+0e2c:	MOVB	ACCU, T1
+0e2e:	ADD	T0, ACCU
+0e30:	MOVB	T1, #0
+0e33:	JUMPF	$0B64
+0e36:	MOVB	ACCU, T1
+0e38:	LEAX	ADDR, T0 + ACCU
+0e3a:	MOV	ACCU, #0
+0e3d:	MOVB	0(ADDR), ACCU
+0e40:	MOV	ACCU, T0
+0e42:	MOV	P0, ACCU
+0e44:	CALL	puts + 0
+0e47:	MOVB	T1, #0
+0e4a:	JUMPF	$0B64
+--------------------------------------------------------------------
+puts:
+0e4d:	ENTER	0, 2
+0e51:	JSR	$0e58
+0e54:	RETURN	0, 2
+--------------------------------------------------------------------
+0e58 : a0 00 __ LDY #$00
+0e5a : b1 0d __ LDA (P0),y
+0e5c : f0 0b __ BEQ $0e69
+0e5e : 20 6a 0e JSR $0e6a ; (putpch + 0)
+0e61 : e6 0d __ INC P0
+0e63 : d0 f3 __ BNE $0e58
+0e65 : e6 0e __ INC P1
+0e67 : d0 ef __ BNE $0e58
+0e69 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+0e6a : ae 71 22 LDX $2271 ; (giocharmap + 0)
+0e6d : e0 01 __ CPX #$01
+0e6f : 90 22 __ BCC $0e93
+0e71 : c9 0a __ CMP #$0a
+0e73 : d0 02 __ BNE $0e77
+0e75 : a9 0d __ LDA #$0d
+0e77 : e0 02 __ CPX #$02
+0e79 : 90 18 __ BCC $0e93
+0e7b : c9 41 __ CMP #$41
+0e7d : 90 14 __ BCC $0e93
+0e7f : c9 7b __ CMP #$7b
+0e81 : b0 10 __ BCS $0e93
+0e83 : c9 61 __ CMP #$61
+0e85 : b0 04 __ BCS $0e8b
+0e87 : c9 5b __ CMP #$5b
+0e89 : b0 08 __ BCS $0e93
+0e8b : 49 20 __ EOR #$20
+0e8d : e0 03 __ CPX #$03
+0e8f : f0 02 __ BEQ $0e93
+0e91 : 29 df __ AND #$df
+0e93 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+0e96:	ENTER	0, 2
+0e9a:	MOV	ACCU, P4
+0e9c:	MOV	T0, ACCU
+0e9e:	MOV	T1, ACCU
+0ea0:	MOV	ACCU, P2
+0ea2:	MOV	T2, ACCU
+0ea4:	MOVB	T3, #0
+0ea7:	MOVB	ACCU, P6
+0ea9:	BEQ	$0EB0
+0eab:	MOV	ACCU, T0
+0ead:	BLTF	$0FCD
+0eb0:	MOVB	T4, #10
+0eb3:	MOV	ACCU, T0
+0eb5:	BNEF	$0F95
+0eb8:	MOV	ADDR, P0
+0eba:	MOVB	T5, 2(ADDR)
+0ebd:	MOVB	ACCU, T5
+0ebf:	CMPUB	ACCU, #$00FF
+0ec1:	BNEF	$0F85
+0ec4:	MOVB	T5, #9
+0ec7:	MOVB	ACCU, T4
+0ec9:	CMPUB	ACCU, #$0009
+0ecb:	BGE	$0EE0
+0ecd:	ADDB	T4, #$00FF
+0ed0:	MOVB	ACCU, T4
+0ed2:	LEAX	ADDR, T2 + ACCU
+0ed4:	MOV	ACCU, #48
+0ed7:	MOVB	0(ADDR), ACCU
+0eda:	MOVB	ACCU, T5
+0edc:	CMPUB	ACCU, T4
+0ede:	BGT	$0ECD
+0ee0:	MOV	ACCU, P0
+0ee2:	MOV	T0, ACCU
+0ee4:	MOV	ADDR, T0
+0ee6:	MOVUB	ACCU, 7(ADDR)
+0ee9:	BEQ	$0F0F
+0eeb:	MOV	ACCU, 3(ADDR)
+0eee:	CMPU	ACCU, #$0010
+0ef1:	BNE	$0F0F
+0ef3:	MOVB	ACCU, T4
+0ef5:	ADDB	ACCU, #$00FF
+0ef8:	MOVB	ACCU, ACCU
+0efa:	LEAX	ADDR, T2 + ACCU
+0efc:	MOV	ACCU, #88
+0eff:	MOVB	0(ADDR), ACCU
+0f02:	ADDB	T4, #$00FE
+0f05:	MOVB	ACCU, T4
+0f07:	LEAX	ADDR, T2 + ACCU
+0f09:	MOV	ACCU, #48
+0f0c:	MOVB	0(ADDR), ACCU
+0f0f:	MOVB	ACCU, T3
+0f11:	BNE	$0F76
+0f13:	MOV	ADDR, T0
+0f15:	MOVUB	ACCU, 5(ADDR)
+0f18:	BEQ	$0F27
+0f1a:	ADDB	T4, #$00FF
+0f1d:	MOVB	ACCU, T4
+0f1f:	LEAX	ADDR, T2 + ACCU
+0f21:	MOV	ACCU, #43
+0f24:	MOVB	0(ADDR), ACCU
+0f27:	MOV	ACCU, P0
+0f29:	MOV	T0, ACCU
+0f2b:	MOV	ADDR, T0
+0f2d:	MOVUB	T1, 1(ADDR)
+0f30:	SUBR	T1, #$000A
+0f34:	MOVB	ACCU, T4
+0f36:	MOV	T6, ACCU
+0f38:	MOV	ACCU, T1
+0f3a:	CMPS	ACCU, T6
+0f3c:	BGT	$0F67
+0f3e:	MOVB	T3, #0
+0f41:	MOVB	ACCU, T4
+0f43:	CMPUB	ACCU, #$000A
+0f45:	BLE	$0F61
+0f47:	MOVB	ACCU, T4
+0f49:	LEAX	ADDR, T2 + ACCU
+0f4b:	MOVB	T5, 0(ADDR)
+0f4e:	MOVB	ACCU, T3
+0f50:	LEAX	ADDR, T2 + ACCU
+0f52:	MOVB	0(ADDR), T5
+0f55:	ADDB	T3, #$0001
+0f58:	ADDB	T4, #$0001
+0f5b:	MOVB	ACCU, T4
+0f5d:	CMPUB	ACCU, #$000A
+0f5f:	BGT	$0F47
+0f61:	MOVB	ACCU, T3
+0f63:	RETURN	0, 2
+0f67:	MOVB	T3, 0(ADDR)
+0f6a:	ADDB	T4, #$00FF
+0f6d:	MOVB	ACCU, T4
+0f6f:	LEAX	ADDR, T2 + ACCU
+0f71:	MOVB	0(ADDR), T3
+0f74:	JUMP	$0F27
+0f76:	ADDB	T4, #$00FF
+0f79:	MOVB	ACCU, T4
+0f7b:	LEAX	ADDR, T2 + ACCU
+0f7d:	MOV	ACCU, #45
+0f80:	MOVB	0(ADDR), ACCU
+0f83:	JUMP	$0F27
+0f85:	MOVB	ACCU, T5
+0f87:	SUBR	ACCU, #$000A
+0f8b:	MOV	T5, ACCU
+0f8d:	CMPUB	ACCU, T4
+0f8f:	BGTF	$0ECD
+0f92:	JUMPF	$0EE0
+0f95:	MOV	ACCU, P0
+0f97:	MOV	T0, ACCU
+0f99:	MOV	ADDR, T0
+0f9b:	MOV	T6, 3(ADDR)
+0f9e:	MOV	ACCU, T1
+0fa0:	MODU	ACCU, T6
+0fa2:	MOV	T6, ACCU
+0fa4:	CMPS	ACCU, #$000A
+0fa7:	BLE	$0FAF
+0fa9:	ADD	T6, #$0030
+0fad:	JUMP	$0FB3
+0faf:	ADD	T6, #$0037
+0fb3:	ADDB	T4, #$00FF
+0fb6:	MOVB	ACCU, T4
+0fb8:	LEAX	ADDR, T2 + ACCU
+0fba:	MOVB	0(ADDR), T6
+0fbd:	MOV	ADDR, T0
+0fbf:	MOV	T0, 3(ADDR)
+0fc2:	MOV	ACCU, T1
+0fc4:	DIVU	ACCU, T0
+0fc6:	MOV	T1, ACCU
+0fc8:	BNE	$0F95
+0fca:	JUMPF	$0EB8
+0fcd:	MOVB	T3, #1
+0fd0:	MOVB	T4, #10
+0fd3:	NEG	ACCU
+0fd4:	MOV	T1, ACCU
+0fd6:	BNE	$0F95
+0fd8:	JUMPF	$0EB8
+--------------------------------------------------------------------
+nforml:
+0fdb:	ENTER	5, 7
+0fdf:	MOVD	ACCU, P4
+0fe1:	MOVD	T0, ACCU
+0fe3:	MOVD	T1, ACCU
+0fe5:	MOV	ACCU, P2
+0fe7:	MOV	T2, ACCU
+0fe9:	MOVB	T3, #0
+0fec:	MOVB	ACCU, P8
+0fee:	BEQ	$0FFD
+0ff0:	MOVD	ACCU, #$00000000
+0ff6:	EXTRT	T0, inp_op_cmp_s32 + 0
+0ffa:	BLTF	$1142
+0ffd:	MOVB	T4, #16
+1000:	MOVD	ACCU, #$00000000
+1006:	EXTRT	T0, inp_op_cmp_u32 + 0
+100a:	BGTF	$10EA
+100d:	MOV	ADDR, P0
+100f:	MOVB	T5, 2(ADDR)
+1012:	MOVB	ACCU, T5
+1014:	CMPUB	ACCU, #$00FF
+1016:	BNEF	$10DA
+1019:	MOVB	T5, #15
+101c:	MOVB	ACCU, T4
+101e:	CMPUB	ACCU, #$000F
+1020:	BGE	$1035
+1022:	ADDB	T4, #$00FF
+1025:	MOVB	ACCU, T4
+1027:	LEAX	ADDR, T2 + ACCU
+1029:	MOV	ACCU, #48
+102c:	MOVB	0(ADDR), ACCU
+102f:	MOVB	ACCU, T5
+1031:	CMPUB	ACCU, T4
+1033:	BGT	$1022
+1035:	MOV	ACCU, P0
+1037:	MOV	T6, ACCU
+1039:	MOV	ADDR, T6
+103b:	MOVUB	ACCU, 7(ADDR)
+103e:	BEQ	$1064
+1040:	MOV	ACCU, 3(ADDR)
+1043:	CMPU	ACCU, #$0010
+1046:	BNE	$1064
+1048:	MOVB	ACCU, T4
+104a:	ADDB	ACCU, #$00FF
+104d:	MOVB	ACCU, ACCU
+104f:	LEAX	ADDR, T2 + ACCU
+1051:	MOV	ACCU, #88
+1054:	MOVB	0(ADDR), ACCU
+1057:	ADDB	T4, #$00FE
+105a:	MOVB	ACCU, T4
+105c:	LEAX	ADDR, T2 + ACCU
+105e:	MOV	ACCU, #48
+1061:	MOVB	0(ADDR), ACCU
+1064:	MOVB	ACCU, T3
+1066:	BNE	$10CB
+1068:	MOV	ADDR, T6
+106a:	MOVUB	ACCU, 5(ADDR)
+106d:	BEQ	$107C
+106f:	ADDB	T4, #$00FF
+1072:	MOVB	ACCU, T4
+1074:	LEAX	ADDR, T2 + ACCU
+1076:	MOV	ACCU, #43
+1079:	MOVB	0(ADDR), ACCU
+107c:	MOV	ACCU, P0
+107e:	MOV	T6, ACCU
+1080:	MOV	ADDR, T6
+1082:	MOVUB	T7, 1(ADDR)
+1085:	SUBR	T7, #$0010
+1089:	MOVB	ACCU, T4
+108b:	MOV	T8, ACCU
+108d:	MOV	ACCU, T7
+108f:	CMPS	ACCU, T8
+1091:	BGT	$10BC
+1093:	MOVB	T3, #0
+1096:	MOVB	ACCU, T4
+1098:	CMPUB	ACCU, #$0010
+109a:	BLE	$10B6
+109c:	MOVB	ACCU, T4
+109e:	LEAX	ADDR, T2 + ACCU
+10a0:	MOVB	T5, 0(ADDR)
+10a3:	MOVB	ACCU, T3
+10a5:	LEAX	ADDR, T2 + ACCU
+10a7:	MOVB	0(ADDR), T5
+10aa:	ADDB	T3, #$0001
+10ad:	ADDB	T4, #$0001
+10b0:	MOVB	ACCU, T4
+10b2:	CMPUB	ACCU, #$0010
+10b4:	BGT	$109C
+10b6:	MOVB	ACCU, T3
+10b8:	RETURN	5, 7
+10bc:	MOVB	T3, 0(ADDR)
+10bf:	ADDB	T4, #$00FF
+10c2:	MOVB	ACCU, T4
+10c4:	LEAX	ADDR, T2 + ACCU
+10c6:	MOVB	0(ADDR), T3
+10c9:	JUMP	$107C
+10cb:	ADDB	T4, #$00FF
+10ce:	MOVB	ACCU, T4
+10d0:	LEAX	ADDR, T2 + ACCU
+10d2:	MOV	ACCU, #45
+10d5:	MOVB	0(ADDR), ACCU
+10d8:	JUMP	$107C
+10da:	MOVB	ACCU, T5
+10dc:	SUBR	ACCU, #$0010
+10e0:	MOV	T5, ACCU
+10e2:	CMPUB	ACCU, T4
+10e4:	BGTF	$1022
+10e7:	JUMPF	$1035
+10ea:	MOV	ACCU, P0
+10ec:	MOV	T6, ACCU
+10ee:	MOV	ADDR, T6
+10f0:	MOV	ACCU, 3(ADDR)
+10f3:	EXTRT	$00, inp_op_ext_u16 + 0
+10f7:	MOVD	T0, ACCU
+10f9:	MOVD	ACCU, T1
+10fb:	EXTRT	T0, inp_binop_mod_u32 + 0
+10ff:	MOVD	T0, ACCU
+1101:	CMPS	ACCU, #$000A
+1104:	BLE	$110E
+1106:	MOV	ACCU, T0
+1108:	ADD	ACCU, #$0030
+110c:	JUMP	$1114
+110e:	MOV	ACCU, T0
+1110:	ADD	ACCU, #$0037
+1114:	MOV	T7, ACCU
+1116:	ADDB	T4, #$00FF
+1119:	MOVB	ACCU, T4
+111b:	LEAX	ADDR, T2 + ACCU
+111d:	MOVB	0(ADDR), T7
+1120:	MOV	ADDR, T6
+1122:	MOV	ACCU, 3(ADDR)
+1125:	EXTRT	$00, inp_op_ext_u16 + 0
+1129:	MOVD	T0, ACCU
+112b:	MOVD	ACCU, T1
+112d:	EXTRT	T0, inp_binop_div_u32 + 0
+1131:	MOVD	T1, ACCU
+1133:	MOVD	ACCU, #$00000000
+1139:	EXTRT	T1, inp_op_cmp_u32 + 0
+113d:	BGT	$10EA
+113f:	JUMPF	$100D
+1142:	MOVB	T3, #1
+1145:	MOVB	T4, #16
+1148:	MOVD	ACCU, T0
+114a:	EXTRT	$00, negaccu32 + 0
+114e:	MOVD	T1, ACCU
+1150:	MOVD	ACCU, #$00000000
+1156:	EXTRT	T1, inp_op_cmp_u32 + 0
+115a:	BGT	$10EA
+115c:	JUMPF	$100D
+--------------------------------------------------------------------
+nformf:
+115f:	ENTER	10, 12
+1163:	MOV	ACCU, P2
+1165:	MOV	T0, ACCU
+1167:	MOV	T1, ACCU
+1169:	MOVD	ACCU, P4
+116b:	MOVD	T2, ACCU
+116d:	MOVD	ACCU, #$00000000
+1173:	CMPF	ACCU, T2
+1175:	BLTF	$1478
+1178:	MOVB	T3, #0
+117b:	MOV	ADDR, P0
+117d:	MOVUB	ACCU, 5(ADDR)
+1180:	BEQ	$118D
+1182:	MOV	ACCU, #43
+1185:	MOV	ADDR, T0
+1187:	MOVB	0(ADDR), ACCU
+118a:	MOVB	T3, #1
+118d:	MOV	T0, #0
+1190:	MOV	ADDR, P0
+1192:	MOVB	T5, 2(ADDR)
+1195:	MOVB	ACCU, T5
+1197:	CMPUB	ACCU, #$00FF
+1199:	BNE	$11A0
+119b:	MOVB	T5, #6
+119e:	JUMP	$11A4
+11a0:	AND	T5, #$00FF
+11a4:	MOVD	ACCU, P4
+11a6:	MOVD	T2, #$00000000
+11ac:	CMPF	ACCU, T2
+11ae:	BNEF	$13FC
+11b1:	MOVB	ACCU, P8
+11b3:	MOVB	T6, ACCU
+11b5:	CMPUB	ACCU, #$0065
+11b7:	SEQ
+11b8:	MOVB	T7, ACCU
+11ba:	MOVB	T8, ACCU
+11bc:	MOVB	ACCU, T5
+11be:	MOV	T4, ACCU
+11c0:	ADD	T4, #$0001
+11c4:	MOVB	ACCU, T6
+11c6:	CMPUB	ACCU, #$0067
+11c8:	BEQF	$13EB
+11cb:	MOVB	ACCU, T7
+11cd:	BNEF	$139F
+11d0:	MOV	ACCU, T0
+11d2:	BGE	$11EA
+11d4:	MOVD	ACCU, P4
+11d6:	MOVD	$03, #$41200000
+11dc:	DIVF	ACCU, $03
+11de:	MOVD	T2, ACCU
+11e0:	MOVD	P4, ACCU
+11e2:	ADD	T0, #$0001
+11e6:	MOV	ACCU, T0
+11e8:	BLT	$11D4
+11ea:	MOVD	T2, #$3f000000
+11f0:	MOVB	ACCU, T5
+11f2:	ADD	ACCU, T0
+11f4:	MOV	T4, ACCU
+11f6:	ADD	T4, #$0001
+11fa:	MOVB	ACCU, T4
+11fc:	CMPUB	ACCU, #$0001
+11fe:	BLTF	$1384
+1201:	MOVD	ACCU, P4
+1203:	ADDF	ACCU, T2
+1205:	MOVD	T2, ACCU
+1207:	MOVD	P4, ACCU
+1209:	MOVD	ACCU, #$41200000
+120f:	CMPF	ACCU, T2
+1211:	BLT	$1224
+1213:	MOVD	ACCU, T2
+1215:	MOVD	$03, #$41200000
+121b:	DIVF	ACCU, $03
+121d:	MOVD	T2, ACCU
+121f:	MOVD	P4, ACCU
+1221:	ADDB	T5, #$00FF
+1224:	MOVB	ACCU, T4
+1226:	MOV	T10, ACCU
+1228:	MOVB	ACCU, T5
+122a:	NEG	ACCU
+122b:	ADD	ACCU, T10
+122d:	MOV	T10, ACCU
+122f:	MOVB	T5, ACCU
+1231:	MOVB	ACCU, T4
+1233:	CMPUB	ACCU, #$0014
+1235:	BGE	$123A
+1237:	MOVB	T4, #20
+123a:	MOVB	ACCU, T10
+123c:	BNE	$124B
+123e:	MOVB	ACCU, T3
+1240:	LEAX	ADDR, T1 + ACCU
+1242:	MOV	ACCU, #48
+1245:	MOVB	0(ADDR), ACCU
+1248:	ADDB	T3, #$0001
+124b:	MOVB	T6, #0
+124e:	MOVB	ACCU, T4
+1250:	BNEF	$133D
+1253:	MOVB	ACCU, T8
+1255:	BNE	$12CC
+1257:	MOV	ADDR, P0
+1259:	MOVUB	ACCU, 1(ADDR)
+125c:	CMPUB	ACCU, T3
+125e:	BLT	$1266
+1260:	MOVB	ACCU, T3
+1262:	RETURN	10, 12
+1266:	MOVB	ACCU, T3
+1268:	CMPUB	ACCU, #$0001
+126a:	BLE	$129B
+126c:	MOVB	T5, #0
+126f:	MOVB	ACCU, T3
+1271:	MOV	T0, ACCU
+1273:	MOV	ADDR, P0
+1275:	MOVUB	ACCU, 1(ADDR)
+1278:	MOV	T4, ACCU
+127a:	SUB	ACCU, T0
+127c:	MOV	T10, ACCU
+127e:	MOVB	ACCU, T5
+1280:	MOV	T11, ACCU
+1282:	MOV	ACCU, T10
+1284:	CMPU	ACCU, T11
+1286:	BLT	$128C
+1288:	MOV	ACCU, T4
+128a:	JUMP	$1262
+128c:	MOV	ACCU, T1
+128e:	LEAX	ADDR, T11 + ACCU
+1290:	MOV	ACCU, #32
+1293:	MOVB	0(ADDR), ACCU
+1296:	ADDB	T5, #$0001
+1299:	JUMP	$1273
+129b:	MOVB	T5, #1
+129e:	MOV	ACCU, P0
+12a0:	MOV	T0, ACCU
+12a2:	MOVB	ACCU, T3
+12a4:	MOV	T4, ACCU
+12a6:	MOVB	ACCU, T5
+12a8:	MOV	T10, ACCU
+12aa:	MOV	ACCU, T4
+12ac:	SUB	ACCU, T10
+12ae:	MOV	ADDR, T0
+12b0:	MOVB	T6, 1(ADDR)
+12b3:	LEAX	ADDR, T1 + ACCU
+12b5:	MOVB	ACCU, T6
+12b7:	MOVB	T6, 0(ADDR)
+12ba:	SUB	ACCU, T10
+12bc:	LEAX	ADDR, T1 + ACCU
+12be:	MOVB	0(ADDR), T6
+12c1:	ADDB	T5, #$0001
+12c4:	MOVB	ACCU, T3
+12c6:	CMPUB	ACCU, T5
+12c8:	BLE	$12A6
+12ca:	JUMP	$126C
+12cc:	MOVB	ACCU, T3
+12ce:	LEAX	ADDR, T1 + ACCU
+12d0:	MOV	ACCU, #69
+12d3:	MOVB	0(ADDR), ACCU
+12d6:	MOVB	ACCU, T3
+12d8:	ADDB	ACCU, #$0001
+12db:	MOVB	T5, ACCU
+12dd:	MOV	ACCU, T0
+12df:	BLT	$12F0
+12e1:	MOVB	ACCU, T5
+12e3:	LEAX	ADDR, T1 + ACCU
+12e5:	MOV	ACCU, #43
+12e8:	MOVB	0(ADDR), ACCU
+12eb:	ADDB	T3, #$0002
+12ee:	JUMP	$1302
+12f0:	MOVB	ACCU, T5
+12f2:	LEAX	ADDR, T1 + ACCU
+12f4:	MOV	ACCU, #45
+12f7:	MOVB	0(ADDR), ACCU
+12fa:	ADDB	T3, #$0002
+12fd:	MOV	ACCU, T0
+12ff:	NEG	ACCU
+1300:	MOV	T0, ACCU
+1302:	MOVB	ACCU, T3
+1304:	ADD	ACCU, T1
+1306:	MOV	T4, ACCU
+1308:	MOV	ACCU, T0
+130a:	MOV	ADDR, #10
+130d:	DIVS	ACCU, ADDR
+130f:	MOV	ADDR, T4
+1311:	MOV	T10, ACCU
+1313:	ADD	T10, #$0030
+1317:	MOVB	0(ADDR), T10
+131a:	MOVB	ACCU, T3
+131c:	ADDB	ACCU, #$0001
+131f:	MOVB	ACCU, ACCU
+1321:	ADD	ACCU, T1
+1323:	MOV	T4, ACCU
+1325:	MOV	ACCU, T0
+1327:	MOV	ADDR, #10
+132a:	MODS	ACCU, ADDR
+132c:	MOV	ADDR, T4
+132e:	MOV	T0, ACCU
+1330:	ADD	T0, #$0030
+1334:	MOVB	0(ADDR), T0
+1337:	ADDB	T3, #$0002
+133a:	JUMPF	$1257
+133d:	MOVB	ACCU, T5
+133f:	CMPUB	ACCU, T6
+1341:	BNE	$1350
+1343:	MOVB	ACCU, T3
+1345:	LEAX	ADDR, T1 + ACCU
+1347:	MOV	ACCU, #46
+134a:	MOVB	0(ADDR), ACCU
+134d:	ADDB	T3, #$0001
+1350:	MOVD	ACCU, P4
+1352:	MOVD	T2, ACCU
+1354:	CNVFS	ACCU
+1355:	MOV	T10, ACCU
+1357:	CNVSF	ACCU
+1358:	MOVD	T9, ACCU
+135a:	MOVD	ACCU, T2
+135c:	SUBF	ACCU, T9
+135e:	MOVD	$03, #$41200000
+1364:	MULF	ACCU, $03
+1366:	MOVD	T2, ACCU
+1368:	MOVD	P4, ACCU
+136a:	MOVB	ACCU, T3
+136c:	LEAX	ADDR, T1 + ACCU
+136e:	ADD	T10, #$0030
+1372:	MOVB	0(ADDR), T10
+1375:	ADDB	T3, #$0001
+1378:	ADDB	T6, #$0001
+137b:	MOVB	ACCU, T4
+137d:	CMPUB	ACCU, T6
+137f:	BLT	$133D
+1381:	JUMPF	$1253
+1384:	MOVB	T6, #1
+1387:	MOVD	ACCU, T2
+1389:	MOVD	$03, #$41200000
+138f:	DIVF	ACCU, $03
+1391:	MOVD	T2, ACCU
+1393:	ADDB	T6, #$0001
+1396:	MOVB	ACCU, T4
+1398:	CMPUB	ACCU, T6
+139a:	BLT	$1387
+139c:	JUMPF	$1201
+139f:	MOVD	T2, #$3f000000
+13a5:	MOVB	ACCU, T5
+13a7:	BNE	$13D1
+13a9:	MOVD	ACCU, P4
+13ab:	ADDF	ACCU, T2
+13ad:	MOVD	T2, ACCU
+13af:	MOVD	P4, ACCU
+13b1:	MOVD	ACCU, #$41200000
+13b7:	CMPF	ACCU, T2
+13b9:	BLTF	$1224
+13bc:	MOVD	ACCU, T2
+13be:	MOVD	$03, #$41200000
+13c4:	DIVF	ACCU, $03
+13c6:	MOVD	T2, ACCU
+13c8:	MOVD	P4, ACCU
+13ca:	ADD	T0, #$0001
+13ce:	JUMPF	$1224
+13d1:	MOVB	T6, #0
+13d4:	MOVD	ACCU, T2
+13d6:	MOVD	$03, #$41200000
+13dc:	DIVF	ACCU, $03
+13de:	MOVD	T2, ACCU
+13e0:	ADDB	T6, #$0001
+13e3:	MOVB	ACCU, T5
+13e5:	CMPUB	ACCU, T6
+13e7:	BLT	$13D4
+13e9:	JUMP	$13A9
+13eb:	MOV	ACCU, T0
+13ed:	CMPS	ACCU, #$0003
+13f0:	BLT	$13F7
+13f2:	MOV	ACCU, T0
+13f4:	BGEF	$11CB
+13f7:	MOVB	T8, #1
+13fa:	JUMP	$139F
+13fc:	MOVD	ACCU, P4
+13fe:	MOVD	T2, #$447a0000
+1404:	CMPF	ACCU, T2
+1406:	BGT	$1424
+1408:	MOVD	ACCU, P4
+140a:	MOVD	$03, #$447a0000
+1410:	DIVF	ACCU, $03
+1412:	MOVD	T2, ACCU
+1414:	MOVD	P4, ACCU
+1416:	ADD	T0, #$0003
+141a:	MOVD	ACCU, #$447a0000
+1420:	CMPF	ACCU, T2
+1422:	BGE	$1408
+1424:	MOVD	ACCU, P4
+1426:	MOVD	T2, #$3f800000
+142c:	CMPF	ACCU, T2
+142e:	BLE	$144C
+1430:	MOVD	ACCU, P4
+1432:	MOVD	$03, #$447a0000
+1438:	MULF	ACCU, $03
+143a:	MOVD	T2, ACCU
+143c:	MOVD	P4, ACCU
+143e:	ADD	T0, #$FFFD
+1442:	MOVD	ACCU, #$3f800000
+1448:	CMPF	ACCU, T2
+144a:	BLT	$1430
+144c:	MOVD	ACCU, P4
+144e:	MOVD	T2, #$41200000
+1454:	CMPF	ACCU, T2
+1456:	BGTF	$11B1
+1459:	MOVD	ACCU, P4
+145b:	MOVD	$03, #$41200000
+1461:	DIVF	ACCU, $03
+1463:	MOVD	T2, ACCU
+1465:	MOVD	P4, ACCU
+1467:	ADD	T0, #$0001
+146b:	MOVD	ACCU, #$41200000
+1471:	CMPF	ACCU, T2
+1473:	BGE	$1459
+1475:	JUMPF	$11B1
+1478:	MOV	ADDR, T0
+147a:	MOVD	ACCU, T2
+147c:	NEGF	ACCU
+147d:	MOVD	T2, ACCU
+147f:	MOVD	P4, ACCU
+1481:	MOV	ACCU, #45
+1484:	MOVB	0(ADDR), ACCU
+1487:	MOVB	T3, #1
+148a:	JUMPF	$118D
+--------------------------------------------------------------------
+shuffle:
+1492:	ENTER	0, 14
+1496:	PUSH	#$0002
+1499:	MOV	ACCU, 16(FP)
+149c:	CMPS	ACCU, #$0000
+149f:	BLT	$14A8
+14a1:	POP	#$0002
+14a4:	RETURN	0, 14
+14a8:	MOV	T0, 14(FP)
+14ab:	MOV	ACCU, T0
+14ad:	MOV	T2, ACCU
+14af:	MOV	T3, 16(FP)
+14b2:	MOV	ACCU, T3
+14b4:	MUL	ACCU, #12
+14b7:	ADD	ACCU, T0
+14b9:	MOV	T4, ACCU
+14bb:	LEA	T5, 0(FP)
+14bf:	CALL	rand + 0
+14c2:	MOV	T6, ACCU
+14c4:	MOV	ADDR, T5
+14c6:	MOV	ACCU, T2
+14c8:	COPY	#12
+14ca:	MOV	ACCU, T6
+14cc:	MODU	ACCU, T3
+14ce:	MUL	ACCU, #12
+14d1:	ADD	ACCU, T0
+14d3:	MOV	T6, ACCU
+14d5:	MOV	ADDR, T2
+14d7:	COPY	#12
+14d9:	MOV	ADDR, T6
+14db:	MOV	ACCU, T5
+14dd:	COPY	#12
+14df:	ADD	T2, #$000C
+14e3:	MOV	ACCU, T4
+14e5:	CMPU	ACCU, T2
+14e7:	BLT	$14BF
+14e9:	JUMP	$14A1
+--------------------------------------------------------------------
+rand:
+14eb:	ENTER	0, 2
+14ef:	MOV	T0, seed + 0
+14f3:	MOV	ACCU, T0
+14f5:	SHL	ACCU, #7
+14f7:	XOR	ACCU, T0
+14f9:	MOV	T0, ACCU
+14fb:	SHRU	ACCU, #9
+14fd:	XOR	ACCU, T0
+14ff:	MOV	T0, ACCU
+1501:	SHL	ACCU, #8
+1503:	XOR	ACCU, T0
+1505:	MOV	T0, ACCU
+1507:	MOV	seed + 0, T0
+150b:	RETURN	0, 2
+--------------------------------------------------------------------
+qsort:
+150f:	ENTER	4, 20
+1513:	PUSH	#$0006
+1516:	MOV	T0, 18(FP)
+1519:	MOV	ACCU, T0
+151b:	CMPS	ACCU, #$0001
+151e:	BLT	$1527
+1520:	POP	#$0006
+1523:	RETURN	4, 20
+1527:	LEA	ADDR, 0(FP)
+152b:	MOV	ACCU, 16(FP)
+152e:	COPY	#12
+1530:	MOV	T2, #0
+1533:	MOV	ACCU, T0
+1535:	CMPS	ACCU, #$0001
+1538:	BLT	$1575
+153a:	MOV	T0, 16(FP)
+153d:	MOV	ACCU, T2
+153f:	MUL	ACCU, #12
+1542:	LEAX	ADDR, T0 + ACCU
+1544:	LEA	ACCU, 0(FP)
+1548:	COPY	#12
+154a:	MOV	2(SP), T0
+154d:	MOV	4(SP), T2
+1550:	CALL	qsort + 0
+1553:	MOV	T0, 16(FP)
+1556:	MOV	ACCU, T2
+1558:	MUL	ACCU, #12
+155b:	ADD	ACCU, T0
+155d:	ADD	ACCU, #$000C
+1561:	MOV	2(SP), ACCU
+1564:	MOV	ACCU, 18(FP)
+1567:	SUB	ACCU, T2
+1569:	ADD	ACCU, #$FFFF
+156d:	MOV	4(SP), ACCU
+1570:	CALL	qsort + 0
+1573:	JUMP	$1520
+1575:	MOV	T0, #1
+1578:	MOV	T3, 16(FP)
+157b:	MOV	ACCU, T0
+157d:	MUL	ACCU, #12
+1580:	ADD	ACCU, T3
+1582:	ADD	ACCU, #$0002
+1586:	MOV	P0, ACCU
+1588:	LEA	P2, 2(FP)
+158c:	JSR	strcmp + 0
+158f:	BGE	$15B8
+1591:	MOV	T3, 16(FP)
+1594:	MOV	ACCU, T2
+1596:	MUL	ACCU, #12
+1599:	ADD	ACCU, T3
+159b:	MOV	T4, ACCU
+159d:	MOV	ACCU, T0
+159f:	MUL	ACCU, #12
+15a2:	ADD	ACCU, T3
+15a4:	MOV	T3, ACCU
+15a6:	MOV	ADDR, T4
+15a8:	COPY	#12
+15aa:	MOV	ADDR, T3
+15ac:	ADD	T4, #$000C
+15b0:	MOV	ACCU, T4
+15b2:	COPY	#12
+15b4:	ADD	T2, #$0001
+15b8:	MOV	T3, 18(FP)
+15bb:	ADD	T0, #$0001
+15bf:	MOV	ACCU, T3
+15c1:	CMPS	ACCU, T0
+15c3:	BLT	$1578
+15c5:	JUMPF	$153A
+--------------------------------------------------------------------
+strcmp:
+15c8 : ea __ __ NOP
+15c9 : a0 00 __ LDY #$00
+15cb : 84 1c __ STY ACCU + 1
+15cd : b1 0d __ LDA (P0),y
+15cf : f0 16 __ BEQ $15e7
+15d1 : d1 0f __ CMP (P2),y
+15d3 : d0 16 __ BNE $15eb
+15d5 : c8 __ __ INY
+15d6 : b1 0d __ LDA (P0),y
+15d8 : f0 0d __ BEQ $15e7
+15da : d1 0f __ CMP (P2),y
+15dc : d0 0d __ BNE $15eb
+15de : c8 __ __ INY
+15df : d0 ec __ BNE $15cd
+15e1 : e6 0e __ INC P1
+15e3 : e6 10 __ INC P3
+15e5 : d0 e6 __ BNE $15cd
+15e7 : d1 0f __ CMP (P2),y
+15e9 : f0 0a __ BEQ $15f5
+15eb : b0 06 __ BCS $15f3
+15ed : a9 ff __ LDA #$ff
+15ef : 85 1c __ STA ACCU + 1
+15f1 : 30 02 __ BMI $15f5
+15f3 : a9 01 __ LDA #$01
+15f5 : 85 1b __ STA ACCU + 0
+15f7 : 60 __ __ RTS
+--------------------------------------------------------------------
+check:
+15f8:	ENTER	0, 2
+15fc:	PUSH	#$0003
+15ff:	MOV	ACCU, 4(FP)
+1602:	CMPS	ACCU, #$0000
+1605:	BLT	$160E
+1607:	POP	#$0003
+160a:	RETURN	0, 2
+160e:	MOV	T0, #0
+1611:	MOV	T2, 2(FP)
+1614:	MOV	T3, 4(FP)
+1617:	MOV	ADDR, T2
+1619:	MOV	T4, 0(ADDR)
+161c:	MOV	ACCU, T0
+161e:	CMPU	ACCU, T4
+1620:	SEQ
+1621:	MOVB	2(SP), ACCU
+1624:	CALL	assert + 0
+1627:	ADD	T2, #$000C
+162b:	ADD	T0, #$0001
+162f:	MOV	ACCU, T3
+1631:	CMPS	ACCU, T0
+1633:	BLT	$1617
+1635:	JUMP	$1607
+--------------------------------------------------------------------
+assert:
+1637:	ENTER	0, 2
+163b:	PUSH	#$0002
+163e:	MOVUB	ACCU, 2(FP)
+1641:	BNE	$1649
+1643:	MOV	P0, #-1
+1646:	CALL	exit + 0
+1649:	POP	#$0002
+164c:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+1650:	ENTER	0, 2
+1654:	JSR	$165b
+1657:	RETURN	0, 2
+--------------------------------------------------------------------
+165b : a5 0d __ LDA P0
+165d : 85 1b __ STA ACCU + 0
+165f : a5 0e __ LDA P1
+1661 : 85 1c __ STA ACCU + 1
+1663 : ae 70 22 LDX $2270 ; (spentry + 0)
+1666 : 9a __ __ TXS
+1667 : a9 4c __ LDA #$4c
+1669 : 85 54 __ STA $54
+166b : a9 00 __ LDA #$00
+166d : 85 13 __ STA P6
+166f : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1670 : b1 19 __ LDA (IP + 0),y
+1672 : c8 __ __ INY
+1673 : aa __ __ TAX
+1674 : b5 00 __ LDA $00,x
+1676 : 85 03 __ STA $03
+1678 : b5 01 __ LDA $01,x
+167a : 85 04 __ STA $04
+167c : b5 02 __ LDA $02,x
+167e : 85 05 __ STA $05
+1680 : b5 03 __ LDA $03,x
+1682 : 85 06 __ STA $06
+1684 : a5 05 __ LDA $05
+1686 : 0a __ __ ASL
+1687 : a5 06 __ LDA $06
+1689 : 2a __ __ ROL
+168a : 85 08 __ STA $08
+168c : f0 06 __ BEQ $1694
+168e : a5 05 __ LDA $05
+1690 : 09 80 __ ORA #$80
+1692 : 85 05 __ STA $05
+1694 : a5 1d __ LDA ACCU + 2
+1696 : 0a __ __ ASL
+1697 : a5 1e __ LDA ACCU + 3
+1699 : 2a __ __ ROL
+169a : 85 07 __ STA $07
+169c : f0 06 __ BEQ $16a4
+169e : a5 1d __ LDA ACCU + 2
+16a0 : 09 80 __ ORA #$80
+16a2 : 85 1d __ STA ACCU + 2
+16a4 : 60 __ __ RTS
+16a5 : 06 1e __ ASL ACCU + 3
+16a7 : a5 07 __ LDA $07
+16a9 : 6a __ __ ROR
+16aa : 85 1e __ STA ACCU + 3
+16ac : b0 06 __ BCS $16b4
+16ae : a5 1d __ LDA ACCU + 2
+16b0 : 29 7f __ AND #$7f
+16b2 : 85 1d __ STA ACCU + 2
+16b4 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+16b5 : 38 __ __ SEC
+16b6 : a5 07 __ LDA $07
+16b8 : e5 08 __ SBC $08
+16ba : f0 38 __ BEQ $16f4
+16bc : aa __ __ TAX
+16bd : b0 25 __ BCS $16e4
+16bf : e0 e9 __ CPX #$e9
+16c1 : b0 0e __ BCS $16d1
+16c3 : a5 08 __ LDA $08
+16c5 : 85 07 __ STA $07
+16c7 : a9 00 __ LDA #$00
+16c9 : 85 1b __ STA ACCU + 0
+16cb : 85 1c __ STA ACCU + 1
+16cd : 85 1d __ STA ACCU + 2
+16cf : f0 23 __ BEQ $16f4
+16d1 : a5 1d __ LDA ACCU + 2
+16d3 : 4a __ __ LSR
+16d4 : 66 1c __ ROR ACCU + 1
+16d6 : 66 1b __ ROR ACCU + 0
+16d8 : e8 __ __ INX
+16d9 : d0 f8 __ BNE $16d3
+16db : 85 1d __ STA ACCU + 2
+16dd : a5 08 __ LDA $08
+16df : 85 07 __ STA $07
+16e1 : 4c f4 16 JMP $16f4 ; (faddsub + 63)
+16e4 : e0 18 __ CPX #$18
+16e6 : b0 33 __ BCS $171b
+16e8 : a5 05 __ LDA $05
+16ea : 4a __ __ LSR
+16eb : 66 04 __ ROR $04
+16ed : 66 03 __ ROR $03
+16ef : ca __ __ DEX
+16f0 : d0 f8 __ BNE $16ea
+16f2 : 85 05 __ STA $05
+16f4 : a5 1e __ LDA ACCU + 3
+16f6 : 29 80 __ AND #$80
+16f8 : 85 1e __ STA ACCU + 3
+16fa : 45 06 __ EOR $06
+16fc : 30 2d __ BMI $172b
+16fe : 18 __ __ CLC
+16ff : a5 1b __ LDA ACCU + 0
+1701 : 65 03 __ ADC $03
+1703 : 85 1b __ STA ACCU + 0
+1705 : a5 1c __ LDA ACCU + 1
+1707 : 65 04 __ ADC $04
+1709 : 85 1c __ STA ACCU + 1
+170b : a5 1d __ LDA ACCU + 2
+170d : 65 05 __ ADC $05
+170f : 85 1d __ STA ACCU + 2
+1711 : 90 08 __ BCC $171b
+1713 : 66 1d __ ROR ACCU + 2
+1715 : 66 1c __ ROR ACCU + 1
+1717 : 66 1b __ ROR ACCU + 0
+1719 : e6 07 __ INC $07
+171b : a5 07 __ LDA $07
+171d : 4a __ __ LSR
+171e : 05 1e __ ORA ACCU + 3
+1720 : 85 1e __ STA ACCU + 3
+1722 : b0 06 __ BCS $172a
+1724 : a5 1d __ LDA ACCU + 2
+1726 : 29 7f __ AND #$7f
+1728 : 85 1d __ STA ACCU + 2
+172a : 60 __ __ RTS
+172b : 38 __ __ SEC
+172c : a5 1b __ LDA ACCU + 0
+172e : e5 03 __ SBC $03
+1730 : 85 1b __ STA ACCU + 0
+1732 : a5 1c __ LDA ACCU + 1
+1734 : e5 04 __ SBC $04
+1736 : 85 1c __ STA ACCU + 1
+1738 : a5 1d __ LDA ACCU + 2
+173a : e5 05 __ SBC $05
+173c : 85 1d __ STA ACCU + 2
+173e : b0 19 __ BCS $1759
+1740 : 38 __ __ SEC
+1741 : a9 00 __ LDA #$00
+1743 : e5 1b __ SBC ACCU + 0
+1745 : 85 1b __ STA ACCU + 0
+1747 : a9 00 __ LDA #$00
+1749 : e5 1c __ SBC ACCU + 1
+174b : 85 1c __ STA ACCU + 1
+174d : a9 00 __ LDA #$00
+174f : e5 1d __ SBC ACCU + 2
+1751 : 85 1d __ STA ACCU + 2
+1753 : a5 1e __ LDA ACCU + 3
+1755 : 49 80 __ EOR #$80
+1757 : 85 1e __ STA ACCU + 3
+1759 : a5 1d __ LDA ACCU + 2
+175b : 30 be __ BMI $171b
+175d : 05 1c __ ORA ACCU + 1
+175f : 05 1b __ ORA ACCU + 0
+1761 : f0 0f __ BEQ $1772
+1763 : c6 07 __ DEC $07
+1765 : f0 0b __ BEQ $1772
+1767 : 06 1b __ ASL ACCU + 0
+1769 : 26 1c __ ROL ACCU + 1
+176b : 26 1d __ ROL ACCU + 2
+176d : 10 f4 __ BPL $1763
+176f : 4c 1b 17 JMP $171b ; (faddsub + 102)
+1772 : a9 00 __ LDA #$00
+1774 : 85 1b __ STA ACCU + 0
+1776 : 85 1c __ STA ACCU + 1
+1778 : 85 1d __ STA ACCU + 2
+177a : 85 1e __ STA ACCU + 3
+177c : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+177d : a5 1b __ LDA ACCU + 0
+177f : 05 1c __ ORA ACCU + 1
+1781 : 05 1d __ ORA ACCU + 2
+1783 : d0 03 __ BNE $1788
+1785 : 85 1e __ STA ACCU + 3
+1787 : 60 __ __ RTS
+1788 : a5 03 __ LDA $03
+178a : 05 04 __ ORA $04
+178c : 05 05 __ ORA $05
+178e : d0 09 __ BNE $1799
+1790 : 85 1b __ STA ACCU + 0
+1792 : 85 1c __ STA ACCU + 1
+1794 : 85 1d __ STA ACCU + 2
+1796 : 85 1e __ STA ACCU + 3
+1798 : 60 __ __ RTS
+1799 : a9 00 __ LDA #$00
+179b : 85 09 __ STA $09
+179d : 85 0a __ STA $0a
+179f : 85 0b __ STA $0b
+17a1 : a4 1b __ LDY ACCU + 0
+17a3 : a5 03 __ LDA $03
+17a5 : d0 06 __ BNE $17ad
+17a7 : a5 04 __ LDA $04
+17a9 : f0 0a __ BEQ $17b5
+17ab : d0 05 __ BNE $17b2
+17ad : 20 ed 17 JSR $17ed ; (fmul8 + 0)
+17b0 : a5 04 __ LDA $04
+17b2 : 20 ed 17 JSR $17ed ; (fmul8 + 0)
+17b5 : a5 05 __ LDA $05
+17b7 : 20 ed 17 JSR $17ed ; (fmul8 + 0)
+17ba : 38 __ __ SEC
+17bb : a5 0b __ LDA $0b
+17bd : 30 06 __ BMI $17c5
+17bf : 06 09 __ ASL $09
+17c1 : 26 0a __ ROL $0a
+17c3 : 2a __ __ ROL
+17c4 : 18 __ __ CLC
+17c5 : 29 7f __ AND #$7f
+17c7 : 85 0b __ STA $0b
+17c9 : a5 1e __ LDA ACCU + 3
+17cb : 45 06 __ EOR $06
+17cd : 29 80 __ AND #$80
+17cf : 85 1e __ STA ACCU + 3
+17d1 : a5 07 __ LDA $07
+17d3 : e9 7e __ SBC #$7e
+17d5 : 18 __ __ CLC
+17d6 : 65 08 __ ADC $08
+17d8 : 4a __ __ LSR
+17d9 : 05 1e __ ORA ACCU + 3
+17db : 85 1e __ STA ACCU + 3
+17dd : a9 00 __ LDA #$00
+17df : 6a __ __ ROR
+17e0 : 05 0b __ ORA $0b
+17e2 : 85 1d __ STA ACCU + 2
+17e4 : a5 0a __ LDA $0a
+17e6 : 85 1c __ STA ACCU + 1
+17e8 : a5 09 __ LDA $09
+17ea : 85 1b __ STA ACCU + 0
+17ec : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+17ed : 38 __ __ SEC
+17ee : 6a __ __ ROR
+17ef : 90 1e __ BCC $180f
+17f1 : aa __ __ TAX
+17f2 : 18 __ __ CLC
+17f3 : 98 __ __ TYA
+17f4 : 65 09 __ ADC $09
+17f6 : 85 09 __ STA $09
+17f8 : a5 0a __ LDA $0a
+17fa : 65 1c __ ADC ACCU + 1
+17fc : 85 0a __ STA $0a
+17fe : a5 0b __ LDA $0b
+1800 : 65 1d __ ADC ACCU + 2
+1802 : 6a __ __ ROR
+1803 : 85 0b __ STA $0b
+1805 : 8a __ __ TXA
+1806 : 66 0a __ ROR $0a
+1808 : 66 09 __ ROR $09
+180a : 4a __ __ LSR
+180b : f0 0d __ BEQ $181a
+180d : b0 e2 __ BCS $17f1
+180f : 66 0b __ ROR $0b
+1811 : 66 0a __ ROR $0a
+1813 : 66 09 __ ROR $09
+1815 : 4a __ __ LSR
+1816 : 90 f7 __ BCC $180f
+1818 : d0 d7 __ BNE $17f1
+181a : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+181b : a5 1b __ LDA ACCU + 0
+181d : 05 1c __ ORA ACCU + 1
+181f : 05 1d __ ORA ACCU + 2
+1821 : d0 03 __ BNE $1826
+1823 : 85 1e __ STA ACCU + 3
+1825 : 60 __ __ RTS
+1826 : a5 1e __ LDA ACCU + 3
+1828 : 45 06 __ EOR $06
+182a : 29 80 __ AND #$80
+182c : 85 1e __ STA ACCU + 3
+182e : a9 00 __ LDA #$00
+1830 : 85 09 __ STA $09
+1832 : 85 0a __ STA $0a
+1834 : 85 0b __ STA $0b
+1836 : a2 18 __ LDX #$18
+1838 : a5 1b __ LDA ACCU + 0
+183a : c5 03 __ CMP $03
+183c : a5 1c __ LDA ACCU + 1
+183e : e5 04 __ SBC $04
+1840 : a5 1d __ LDA ACCU + 2
+1842 : e5 05 __ SBC $05
+1844 : 90 13 __ BCC $1859
+1846 : a5 1b __ LDA ACCU + 0
+1848 : e5 03 __ SBC $03
+184a : 85 1b __ STA ACCU + 0
+184c : a5 1c __ LDA ACCU + 1
+184e : e5 04 __ SBC $04
+1850 : 85 1c __ STA ACCU + 1
+1852 : a5 1d __ LDA ACCU + 2
+1854 : e5 05 __ SBC $05
+1856 : 85 1d __ STA ACCU + 2
+1858 : 38 __ __ SEC
+1859 : 26 09 __ ROL $09
+185b : 26 0a __ ROL $0a
+185d : 26 0b __ ROL $0b
+185f : ca __ __ DEX
+1860 : f0 0a __ BEQ $186c
+1862 : 06 1b __ ASL ACCU + 0
+1864 : 26 1c __ ROL ACCU + 1
+1866 : 26 1d __ ROL ACCU + 2
+1868 : b0 dc __ BCS $1846
+186a : 90 cc __ BCC $1838
+186c : 38 __ __ SEC
+186d : a5 0b __ LDA $0b
+186f : 30 06 __ BMI $1877
+1871 : 06 09 __ ASL $09
+1873 : 26 0a __ ROL $0a
+1875 : 2a __ __ ROL
+1876 : 18 __ __ CLC
+1877 : 29 7f __ AND #$7f
+1879 : 85 0b __ STA $0b
+187b : a5 08 __ LDA $08
+187d : 49 7f __ EOR #$7f
+187f : 65 07 __ ADC $07
+1881 : 38 __ __ SEC
+1882 : e9 01 __ SBC #$01
+1884 : 4a __ __ LSR
+1885 : 05 1e __ ORA ACCU + 3
+1887 : 85 1e __ STA ACCU + 3
+1889 : a9 00 __ LDA #$00
+188b : 6a __ __ ROR
+188c : 05 0b __ ORA $0b
+188e : 85 1d __ STA ACCU + 2
+1890 : a5 0a __ LDA $0a
+1892 : 85 1c __ STA ACCU + 1
+1894 : a5 09 __ LDA $09
+1896 : 85 1b __ STA ACCU + 0
+1898 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+1899 : 38 __ __ SEC
+189a : a9 00 __ LDA #$00
+189c : e5 1b __ SBC ACCU + 0
+189e : 85 1b __ STA ACCU + 0
+18a0 : a9 00 __ LDA #$00
+18a2 : e5 1c __ SBC ACCU + 1
+18a4 : 85 1c __ STA ACCU + 1
+18a6 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+18a7 : 38 __ __ SEC
+18a8 : a9 00 __ LDA #$00
+18aa : e5 03 __ SBC $03
+18ac : 85 03 __ STA $03
+18ae : a9 00 __ LDA #$00
+18b0 : e5 04 __ SBC $04
+18b2 : 85 04 __ STA $04
+18b4 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+18b5 : a5 1c __ LDA ACCU + 1
+18b7 : d0 31 __ BNE $18ea
+18b9 : a5 04 __ LDA $04
+18bb : d0 1e __ BNE $18db
+18bd : 85 06 __ STA $06
+18bf : a2 04 __ LDX #$04
+18c1 : 06 1b __ ASL ACCU + 0
+18c3 : 2a __ __ ROL
+18c4 : c5 03 __ CMP $03
+18c6 : 90 02 __ BCC $18ca
+18c8 : e5 03 __ SBC $03
+18ca : 26 1b __ ROL ACCU + 0
+18cc : 2a __ __ ROL
+18cd : c5 03 __ CMP $03
+18cf : 90 02 __ BCC $18d3
+18d1 : e5 03 __ SBC $03
+18d3 : 26 1b __ ROL ACCU + 0
+18d5 : ca __ __ DEX
+18d6 : d0 eb __ BNE $18c3
+18d8 : 85 05 __ STA $05
+18da : 60 __ __ RTS
+18db : a5 1b __ LDA ACCU + 0
+18dd : 85 05 __ STA $05
+18df : a5 1c __ LDA ACCU + 1
+18e1 : 85 06 __ STA $06
+18e3 : a9 00 __ LDA #$00
+18e5 : 85 1b __ STA ACCU + 0
+18e7 : 85 1c __ STA ACCU + 1
+18e9 : 60 __ __ RTS
+18ea : a5 04 __ LDA $04
+18ec : d0 1f __ BNE $190d
+18ee : a5 03 __ LDA $03
+18f0 : 30 1b __ BMI $190d
+18f2 : a9 00 __ LDA #$00
+18f4 : 85 06 __ STA $06
+18f6 : a2 10 __ LDX #$10
+18f8 : 06 1b __ ASL ACCU + 0
+18fa : 26 1c __ ROL ACCU + 1
+18fc : 2a __ __ ROL
+18fd : c5 03 __ CMP $03
+18ff : 90 02 __ BCC $1903
+1901 : e5 03 __ SBC $03
+1903 : 26 1b __ ROL ACCU + 0
+1905 : 26 1c __ ROL ACCU + 1
+1907 : ca __ __ DEX
+1908 : d0 f2 __ BNE $18fc
+190a : 85 05 __ STA $05
+190c : 60 __ __ RTS
+190d : a9 00 __ LDA #$00
+190f : 85 05 __ STA $05
+1911 : 85 06 __ STA $06
+1913 : 84 02 __ STY $02
+1915 : a0 10 __ LDY #$10
+1917 : 18 __ __ CLC
+1918 : 26 1b __ ROL ACCU + 0
+191a : 26 1c __ ROL ACCU + 1
+191c : 26 05 __ ROL $05
+191e : 26 06 __ ROL $06
+1920 : 38 __ __ SEC
+1921 : a5 05 __ LDA $05
+1923 : e5 03 __ SBC $03
+1925 : aa __ __ TAX
+1926 : a5 06 __ LDA $06
+1928 : e5 04 __ SBC $04
+192a : 90 04 __ BCC $1930
+192c : 86 05 __ STX $05
+192e : 85 06 __ STA $06
+1930 : 88 __ __ DEY
+1931 : d0 e5 __ BNE $1918
+1933 : 26 1b __ ROL ACCU + 0
+1935 : 26 1c __ ROL ACCU + 1
+1937 : a4 02 __ LDY $02
+1939 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+193a : 20 94 16 JSR $1694 ; (freg + 36)
+193d : a5 07 __ LDA $07
+193f : c9 7f __ CMP #$7f
+1941 : b0 07 __ BCS $194a
+1943 : a9 00 __ LDA #$00
+1945 : 85 1b __ STA ACCU + 0
+1947 : 85 1c __ STA ACCU + 1
+1949 : 60 __ __ RTS
+194a : 38 __ __ SEC
+194b : e9 8e __ SBC #$8e
+194d : 90 0a __ BCC $1959
+194f : a9 ff __ LDA #$ff
+1951 : 85 1b __ STA ACCU + 0
+1953 : a9 7f __ LDA #$7f
+1955 : 85 1c __ STA ACCU + 1
+1957 : d0 08 __ BNE $1961
+1959 : aa __ __ TAX
+195a : 46 1d __ LSR ACCU + 2
+195c : 66 1c __ ROR ACCU + 1
+195e : e8 __ __ INX
+195f : d0 f9 __ BNE $195a
+1961 : 24 1e __ BIT ACCU + 3
+1963 : 10 0e __ BPL $1973
+1965 : 38 __ __ SEC
+1966 : a9 00 __ LDA #$00
+1968 : e5 1c __ SBC ACCU + 1
+196a : 85 1b __ STA ACCU + 0
+196c : a9 00 __ LDA #$00
+196e : e5 1d __ SBC ACCU + 2
+1970 : 85 1c __ STA ACCU + 1
+1972 : 60 __ __ RTS
+1973 : a5 1c __ LDA ACCU + 1
+1975 : 85 1b __ STA ACCU + 0
+1977 : a5 1d __ LDA ACCU + 2
+1979 : 85 1c __ STA ACCU + 1
+197b : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+197c : 24 1c __ BIT ACCU + 1
+197e : 30 03 __ BMI $1983
+1980 : 4c 9a 19 JMP $199a ; (uint16_to_float + 0)
+1983 : 38 __ __ SEC
+1984 : a9 00 __ LDA #$00
+1986 : e5 1b __ SBC ACCU + 0
+1988 : 85 1b __ STA ACCU + 0
+198a : a9 00 __ LDA #$00
+198c : e5 1c __ SBC ACCU + 1
+198e : 85 1c __ STA ACCU + 1
+1990 : 20 9a 19 JSR $199a ; (uint16_to_float + 0)
+1993 : a5 1e __ LDA ACCU + 3
+1995 : 09 80 __ ORA #$80
+1997 : 85 1e __ STA ACCU + 3
+1999 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+199a : a5 1b __ LDA ACCU + 0
+199c : 05 1c __ ORA ACCU + 1
+199e : d0 05 __ BNE $19a5
+19a0 : 85 1d __ STA ACCU + 2
+19a2 : 85 1e __ STA ACCU + 3
+19a4 : 60 __ __ RTS
+19a5 : a2 8e __ LDX #$8e
+19a7 : a5 1c __ LDA ACCU + 1
+19a9 : 30 06 __ BMI $19b1
+19ab : ca __ __ DEX
+19ac : 06 1b __ ASL ACCU + 0
+19ae : 2a __ __ ROL
+19af : 10 fa __ BPL $19ab
+19b1 : 29 7f __ AND #$7f
+19b3 : 85 1d __ STA ACCU + 2
+19b5 : a5 1b __ LDA ACCU + 0
+19b7 : 85 1c __ STA ACCU + 1
+19b9 : 8a __ __ TXA
+19ba : 4a __ __ LSR
+19bb : 85 1e __ STA ACCU + 3
+19bd : a9 00 __ LDA #$00
+19bf : 85 1b __ STA ACCU + 0
+19c1 : 6a __ __ ROR
+19c2 : 05 1d __ ORA ACCU + 2
+19c4 : 85 1d __ STA ACCU + 2
+19c6 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+19c7 : 38 __ __ SEC
+19c8 : a9 00 __ LDA #$00
+19ca : e5 1b __ SBC ACCU + 0
+19cc : 85 1b __ STA ACCU + 0
+19ce : a9 00 __ LDA #$00
+19d0 : e5 1c __ SBC ACCU + 1
+19d2 : 85 1c __ STA ACCU + 1
+19d4 : a9 00 __ LDA #$00
+19d6 : e5 1d __ SBC ACCU + 2
+19d8 : 85 1d __ STA ACCU + 2
+19da : a9 00 __ LDA #$00
+19dc : e5 1e __ SBC ACCU + 3
+19de : 85 1e __ STA ACCU + 3
+19e0 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+19e1 : 84 02 __ STY $02
+19e3 : a9 00 __ LDA #$00
+19e5 : 85 07 __ STA $07
+19e7 : 85 08 __ STA $08
+19e9 : 85 09 __ STA $09
+19eb : 85 0a __ STA $0a
+19ed : a0 20 __ LDY #$20
+19ef : 18 __ __ CLC
+19f0 : 26 1b __ ROL ACCU + 0
+19f2 : 26 1c __ ROL ACCU + 1
+19f4 : 26 1d __ ROL ACCU + 2
+19f6 : 26 1e __ ROL ACCU + 3
+19f8 : 26 07 __ ROL $07
+19fa : 26 08 __ ROL $08
+19fc : 26 09 __ ROL $09
+19fe : 26 0a __ ROL $0a
+1a00 : a5 07 __ LDA $07
+1a02 : c5 03 __ CMP $03
+1a04 : a5 08 __ LDA $08
+1a06 : e5 04 __ SBC $04
+1a08 : a5 09 __ LDA $09
+1a0a : e5 05 __ SBC $05
+1a0c : a5 0a __ LDA $0a
+1a0e : e5 06 __ SBC $06
+1a10 : 90 18 __ BCC $1a2a
+1a12 : a5 07 __ LDA $07
+1a14 : e5 03 __ SBC $03
+1a16 : 85 07 __ STA $07
+1a18 : a5 08 __ LDA $08
+1a1a : e5 04 __ SBC $04
+1a1c : 85 08 __ STA $08
+1a1e : a5 09 __ LDA $09
+1a20 : e5 05 __ SBC $05
+1a22 : 85 09 __ STA $09
+1a24 : a5 0a __ LDA $0a
+1a26 : e5 06 __ SBC $06
+1a28 : 85 0a __ STA $0a
+1a2a : 88 __ __ DEY
+1a2b : d0 c3 __ BNE $19f0
+1a2d : 26 1b __ ROL ACCU + 0
+1a2f : 26 1c __ ROL ACCU + 1
+1a31 : 26 1d __ ROL ACCU + 2
+1a33 : 26 1e __ ROL ACCU + 3
+1a35 : a4 02 __ LDY $02
+1a37 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1a38 : a9 00 __ LDA #$00
+1a3a : 85 1d __ STA ACCU + 2
+1a3c : 85 1e __ STA ACCU + 3
+1a3e : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1a3f : b5 00 __ LDA $00,x
+1a41 : 85 03 __ STA $03
+1a43 : b5 01 __ LDA $01,x
+1a45 : 85 04 __ STA $04
+1a47 : b5 02 __ LDA $02,x
+1a49 : 85 05 __ STA $05
+1a4b : b5 03 __ LDA $03,x
+1a4d : 85 06 __ STA $06
+1a4f : 20 e1 19 JSR $19e1 ; (divmod32 + 0)
+1a52 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1a53 : b5 00 __ LDA $00,x
+1a55 : 85 03 __ STA $03
+1a57 : b5 01 __ LDA $01,x
+1a59 : 85 04 __ STA $04
+1a5b : b5 02 __ LDA $02,x
+1a5d : 85 05 __ STA $05
+1a5f : b5 03 __ LDA $03,x
+1a61 : 85 06 __ STA $06
+1a63 : 20 e1 19 JSR $19e1 ; (divmod32 + 0)
+1a66 : a5 07 __ LDA $07
+1a68 : 85 1b __ STA ACCU + 0
+1a6a : a5 08 __ LDA $08
+1a6c : 85 1c __ STA ACCU + 1
+1a6e : a5 09 __ LDA $09
+1a70 : 85 1d __ STA ACCU + 2
+1a72 : a5 0a __ LDA $0a
+1a74 : 85 1e __ STA ACCU + 3
+1a76 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1a77 : b5 03 __ LDA $03,x
+1a79 : c5 1e __ CMP ACCU + 3
+1a7b : d0 20 __ BNE $1a9d
+1a7d : b5 02 __ LDA $02,x
+1a7f : c5 1d __ CMP ACCU + 2
+1a81 : d0 1a __ BNE $1a9d
+1a83 : b5 01 __ LDA $01,x
+1a85 : c5 1c __ CMP ACCU + 1
+1a87 : d0 14 __ BNE $1a9d
+1a89 : b5 00 __ LDA $00,x
+1a8b : c5 1b __ CMP ACCU + 0
+1a8d : d0 0e __ BNE $1a9d
+1a8f : a9 00 __ LDA #$00
+1a91 : 85 1b __ STA ACCU + 0
+1a93 : 85 1c __ STA ACCU + 1
+1a95 : 60 __ __ RTS
+1a96 : a9 ff __ LDA #$ff
+1a98 : 85 1b __ STA ACCU + 0
+1a9a : 85 1c __ STA ACCU + 1
+1a9c : 60 __ __ RTS
+1a9d : 90 f7 __ BCC $1a96
+1a9f : a9 01 __ LDA #$01
+1aa1 : 85 1b __ STA ACCU + 0
+1aa3 : a9 00 __ LDA #$00
+1aa5 : 85 1c __ STA ACCU + 1
+1aa7 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1aa8 : a5 1e __ LDA ACCU + 3
+1aaa : 49 80 __ EOR #$80
+1aac : 85 1e __ STA ACCU + 3
+1aae : b5 03 __ LDA $03,x
+1ab0 : 49 80 __ EOR #$80
+1ab2 : c5 1e __ CMP ACCU + 3
+1ab4 : d0 20 __ BNE $1ad6
+1ab6 : b5 02 __ LDA $02,x
+1ab8 : c5 1d __ CMP ACCU + 2
+1aba : d0 1a __ BNE $1ad6
+1abc : b5 01 __ LDA $01,x
+1abe : c5 1c __ CMP ACCU + 1
+1ac0 : d0 14 __ BNE $1ad6
+1ac2 : b5 00 __ LDA $00,x
+1ac4 : c5 1b __ CMP ACCU + 0
+1ac6 : d0 0e __ BNE $1ad6
+1ac8 : a9 00 __ LDA #$00
+1aca : 85 1b __ STA ACCU + 0
+1acc : 85 1c __ STA ACCU + 1
+1ace : 60 __ __ RTS
+1acf : a9 ff __ LDA #$ff
+1ad1 : 85 1b __ STA ACCU + 0
+1ad3 : 85 1c __ STA ACCU + 1
+1ad5 : 60 __ __ RTS
+1ad6 : 90 f7 __ BCC $1acf
+1ad8 : a9 01 __ LDA #$01
+1ada : 85 1b __ STA ACCU + 0
+1adc : a9 00 __ LDA #$00
+1ade : 85 1c __ STA ACCU + 1
+1ae0 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1ae1 : a9 4c __ LDA #$4c
+1ae3 : 85 54 __ STA $54
+1ae5 : a9 00 __ LDA #$00
+1ae7 : 85 13 __ STA P6
+1ae9 : a9 19 __ LDA #$19
+1aeb : 85 16 __ STA P9
+1aed : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1aee : b1 19 __ LDA (IP + 0),y
+1af0 : aa __ __ TAX
+1af1 : c8 __ __ INY
+1af2 : b1 19 __ LDA (IP + 0),y
+1af4 : 95 00 __ STA $00,x
+1af6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1af9 : b1 19 __ LDA (IP + 0),y
+1afb : aa __ __ TAX
+1afc : c8 __ __ INY
+1afd : b1 19 __ LDA (IP + 0),y
+1aff : 95 00 __ STA $00,x
+1b01 : a9 00 __ LDA #$00
+1b03 : 95 01 __ STA $01,x
+1b05 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1b08 : b1 19 __ LDA (IP + 0),y
+1b0a : aa __ __ TAX
+1b0b : c8 __ __ INY
+1b0c : b1 19 __ LDA (IP + 0),y
+1b0e : 95 00 __ STA $00,x
+1b10 : a9 ff __ LDA #$ff
+1b12 : 95 01 __ STA $01,x
+1b14 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1b17 : b1 19 __ LDA (IP + 0),y
+1b19 : aa __ __ TAX
+1b1a : c8 __ __ INY
+1b1b : b1 19 __ LDA (IP + 0),y
+1b1d : 95 00 __ STA $00,x
+1b1f : c8 __ __ INY
+1b20 : b1 19 __ LDA (IP + 0),y
+1b22 : 95 01 __ STA $01,x
+1b24 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1b27 : b1 19 __ LDA (IP + 0),y
+1b29 : aa __ __ TAX
+1b2a : c8 __ __ INY
+1b2b : b1 19 __ LDA (IP + 0),y
+1b2d : 95 00 __ STA $00,x
+1b2f : c8 __ __ INY
+1b30 : b1 19 __ LDA (IP + 0),y
+1b32 : 95 01 __ STA $01,x
+1b34 : c8 __ __ INY
+1b35 : b1 19 __ LDA (IP + 0),y
+1b37 : 95 02 __ STA $02,x
+1b39 : c8 __ __ INY
+1b3a : b1 19 __ LDA (IP + 0),y
+1b3c : 95 03 __ STA $03,x
+1b3e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1b41 : b1 19 __ LDA (IP + 0),y
+1b43 : aa __ __ TAX
+1b44 : b5 00 __ LDA $00,x
+1b46 : 85 1b __ STA ACCU + 0
+1b48 : a9 00 __ LDA #$00
+1b4a : 85 1c __ STA ACCU + 1
+1b4c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1b4f : b1 19 __ LDA (IP + 0),y
+1b51 : aa __ __ TAX
+1b52 : a5 1b __ LDA ACCU + 0
+1b54 : 95 00 __ STA $00,x
+1b56 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1b59 : b1 19 __ LDA (IP + 0),y
+1b5b : aa __ __ TAX
+1b5c : b5 00 __ LDA $00,x
+1b5e : 85 1b __ STA ACCU + 0
+1b60 : b5 01 __ LDA $01,x
+1b62 : 85 1c __ STA ACCU + 1
+1b64 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1b67 : b1 19 __ LDA (IP + 0),y
+1b69 : aa __ __ TAX
+1b6a : a5 1b __ LDA ACCU + 0
+1b6c : 95 00 __ STA $00,x
+1b6e : a5 1c __ LDA ACCU + 1
+1b70 : 95 01 __ STA $01,x
+1b72 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1b75 : b1 19 __ LDA (IP + 0),y
+1b77 : aa __ __ TAX
+1b78 : b5 00 __ LDA $00,x
+1b7a : 85 1f __ STA ADDR + 0
+1b7c : b5 01 __ LDA $01,x
+1b7e : 85 20 __ STA ADDR + 1
+1b80 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1b83 : b1 19 __ LDA (IP + 0),y
+1b85 : aa __ __ TAX
+1b86 : b5 00 __ LDA $00,x
+1b88 : 85 1b __ STA ACCU + 0
+1b8a : b5 01 __ LDA $01,x
+1b8c : 85 1c __ STA ACCU + 1
+1b8e : b5 02 __ LDA $02,x
+1b90 : 85 1d __ STA ACCU + 2
+1b92 : b5 03 __ LDA $03,x
+1b94 : 85 1e __ STA ACCU + 3
+1b96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1b99 : b1 19 __ LDA (IP + 0),y
+1b9b : aa __ __ TAX
+1b9c : a5 1b __ LDA ACCU + 0
+1b9e : 95 00 __ STA $00,x
+1ba0 : a5 1c __ LDA ACCU + 1
+1ba2 : 95 01 __ STA $01,x
+1ba4 : a5 1d __ LDA ACCU + 2
+1ba6 : 95 02 __ STA $02,x
+1ba8 : a5 1e __ LDA ACCU + 3
+1baa : 95 03 __ STA $03,x
+1bac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1baf : b1 19 __ LDA (IP + 0),y
+1bb1 : 85 1f __ STA ADDR + 0
+1bb3 : c8 __ __ INY
+1bb4 : b1 19 __ LDA (IP + 0),y
+1bb6 : 85 20 __ STA ADDR + 1
+1bb8 : c8 __ __ INY
+1bb9 : b1 19 __ LDA (IP + 0),y
+1bbb : aa __ __ TAX
+1bbc : 84 02 __ STY $02
+1bbe : a0 00 __ LDY #$00
+1bc0 : b1 1f __ LDA (ADDR + 0),y
+1bc2 : 95 00 __ STA $00,x
+1bc4 : c8 __ __ INY
+1bc5 : b1 1f __ LDA (ADDR + 0),y
+1bc7 : 95 01 __ STA $01,x
+1bc9 : a4 02 __ LDY $02
+1bcb : 4c 50 08 JMP $0850 ; (startup + 79)
+1bce : b1 19 __ LDA (IP + 0),y
+1bd0 : aa __ __ TAX
+1bd1 : c8 __ __ INY
+1bd2 : b1 19 __ LDA (IP + 0),y
+1bd4 : 84 02 __ STY $02
+1bd6 : a8 __ __ TAY
+1bd7 : 4c c0 1b JMP $1bc0 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1bda : b1 19 __ LDA (IP + 0),y
+1bdc : 85 1f __ STA ADDR + 0
+1bde : c8 __ __ INY
+1bdf : b1 19 __ LDA (IP + 0),y
+1be1 : 85 20 __ STA ADDR + 1
+1be3 : c8 __ __ INY
+1be4 : b1 19 __ LDA (IP + 0),y
+1be6 : aa __ __ TAX
+1be7 : 84 02 __ STY $02
+1be9 : a0 00 __ LDY #$00
+1beb : b5 00 __ LDA $00,x
+1bed : 91 1f __ STA (ADDR + 0),y
+1bef : c8 __ __ INY
+1bf0 : b5 01 __ LDA $01,x
+1bf2 : 91 1f __ STA (ADDR + 0),y
+1bf4 : a4 02 __ LDY $02
+1bf6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1bf9 : b1 19 __ LDA (IP + 0),y
+1bfb : aa __ __ TAX
+1bfc : c8 __ __ INY
+1bfd : b1 19 __ LDA (IP + 0),y
+1bff : 84 02 __ STY $02
+1c01 : a8 __ __ TAY
+1c02 : 4c eb 1b JMP $1beb ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1c05 : b1 19 __ LDA (IP + 0),y
+1c07 : aa __ __ TAX
+1c08 : c8 __ __ INY
+1c09 : b1 19 __ LDA (IP + 0),y
+1c0b : 95 00 __ STA $00,x
+1c0d : c8 __ __ INY
+1c0e : b1 19 __ LDA (IP + 0),y
+1c10 : 95 01 __ STA $01,x
+1c12 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1c15 : b1 19 __ LDA (IP + 0),y
+1c17 : aa __ __ TAX
+1c18 : 18 __ __ CLC
+1c19 : b5 00 __ LDA $00,x
+1c1b : 65 1b __ ADC ACCU + 0
+1c1d : 85 1f __ STA ADDR + 0
+1c1f : b5 01 __ LDA $01,x
+1c21 : 65 1c __ ADC ACCU + 1
+1c23 : 85 20 __ STA ADDR + 1
+1c25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1c28 : b1 19 __ LDA (IP + 0),y
+1c2a : aa __ __ TAX
+1c2b : c8 __ __ INY
+1c2c : b1 19 __ LDA (IP + 0),y
+1c2e : 84 02 __ STY $02
+1c30 : a8 __ __ TAY
+1c31 : b1 25 __ LDA (FP + 0),y
+1c33 : 95 00 __ STA $00,x
+1c35 : a9 00 __ LDA #$00
+1c37 : 95 01 __ STA $01,x
+1c39 : a4 02 __ LDY $02
+1c3b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1c3e : b1 19 __ LDA (IP + 0),y
+1c40 : aa __ __ TAX
+1c41 : c8 __ __ INY
+1c42 : b1 19 __ LDA (IP + 0),y
+1c44 : 84 02 __ STY $02
+1c46 : a8 __ __ TAY
+1c47 : b1 25 __ LDA (FP + 0),y
+1c49 : 95 00 __ STA $00,x
+1c4b : c8 __ __ INY
+1c4c : b1 25 __ LDA (FP + 0),y
+1c4e : 95 01 __ STA $01,x
+1c50 : a4 02 __ LDY $02
+1c52 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1c55 : b1 19 __ LDA (IP + 0),y
+1c57 : aa __ __ TAX
+1c58 : c8 __ __ INY
+1c59 : b1 19 __ LDA (IP + 0),y
+1c5b : 84 02 __ STY $02
+1c5d : a8 __ __ TAY
+1c5e : b5 00 __ LDA $00,x
+1c60 : 91 25 __ STA (FP + 0),y
+1c62 : a4 02 __ LDY $02
+1c64 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1c67 : b1 19 __ LDA (IP + 0),y
+1c69 : aa __ __ TAX
+1c6a : c8 __ __ INY
+1c6b : b1 19 __ LDA (IP + 0),y
+1c6d : 84 02 __ STY $02
+1c6f : a8 __ __ TAY
+1c70 : b5 00 __ LDA $00,x
+1c72 : 91 25 __ STA (FP + 0),y
+1c74 : c8 __ __ INY
+1c75 : b5 01 __ LDA $01,x
+1c77 : 91 25 __ STA (FP + 0),y
+1c79 : a4 02 __ LDY $02
+1c7b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1c7e : b1 19 __ LDA (IP + 0),y
+1c80 : aa __ __ TAX
+1c81 : c8 __ __ INY
+1c82 : 18 __ __ CLC
+1c83 : b1 19 __ LDA (IP + 0),y
+1c85 : 65 25 __ ADC FP + 0
+1c87 : 95 00 __ STA $00,x
+1c89 : c8 __ __ INY
+1c8a : b1 19 __ LDA (IP + 0),y
+1c8c : 65 26 __ ADC FP + 1
+1c8e : 95 01 __ STA $01,x
+1c90 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1c93 : b1 19 __ LDA (IP + 0),y
+1c95 : aa __ __ TAX
+1c96 : c8 __ __ INY
+1c97 : b1 19 __ LDA (IP + 0),y
+1c99 : 84 02 __ STY $02
+1c9b : a8 __ __ TAY
+1c9c : b5 00 __ LDA $00,x
+1c9e : 91 23 __ STA (SP + 0),y
+1ca0 : a4 02 __ LDY $02
+1ca2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1ca5 : b1 19 __ LDA (IP + 0),y
+1ca7 : aa __ __ TAX
+1ca8 : c8 __ __ INY
+1ca9 : b1 19 __ LDA (IP + 0),y
+1cab : 84 02 __ STY $02
+1cad : a8 __ __ TAY
+1cae : b5 00 __ LDA $00,x
+1cb0 : 91 23 __ STA (SP + 0),y
+1cb2 : c8 __ __ INY
+1cb3 : b5 01 __ LDA $01,x
+1cb5 : 91 23 __ STA (SP + 0),y
+1cb7 : a4 02 __ LDY $02
+1cb9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1cbc : b1 19 __ LDA (IP + 0),y
+1cbe : 85 1f __ STA ADDR + 0
+1cc0 : c8 __ __ INY
+1cc1 : b1 19 __ LDA (IP + 0),y
+1cc3 : 85 20 __ STA ADDR + 1
+1cc5 : c8 __ __ INY
+1cc6 : b1 19 __ LDA (IP + 0),y
+1cc8 : aa __ __ TAX
+1cc9 : 84 02 __ STY $02
+1ccb : a0 00 __ LDY #$00
+1ccd : b1 1f __ LDA (ADDR + 0),y
+1ccf : 95 00 __ STA $00,x
+1cd1 : a4 02 __ LDY $02
+1cd3 : 4c 50 08 JMP $0850 ; (startup + 79)
+1cd6 : b1 19 __ LDA (IP + 0),y
+1cd8 : aa __ __ TAX
+1cd9 : c8 __ __ INY
+1cda : b1 19 __ LDA (IP + 0),y
+1cdc : 84 02 __ STY $02
+1cde : a8 __ __ TAY
+1cdf : 4c cd 1c JMP $1ccd ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1ce2 : b1 19 __ LDA (IP + 0),y
+1ce4 : 85 1f __ STA ADDR + 0
+1ce6 : c8 __ __ INY
+1ce7 : b1 19 __ LDA (IP + 0),y
+1ce9 : 85 20 __ STA ADDR + 1
+1ceb : c8 __ __ INY
+1cec : b1 19 __ LDA (IP + 0),y
+1cee : aa __ __ TAX
+1cef : 84 02 __ STY $02
+1cf1 : a0 00 __ LDY #$00
+1cf3 : b1 1f __ LDA (ADDR + 0),y
+1cf5 : 95 00 __ STA $00,x
+1cf7 : a9 00 __ LDA #$00
+1cf9 : 95 01 __ STA $01,x
+1cfb : a4 02 __ LDY $02
+1cfd : 4c 50 08 JMP $0850 ; (startup + 79)
+1d00 : b1 19 __ LDA (IP + 0),y
+1d02 : aa __ __ TAX
+1d03 : c8 __ __ INY
+1d04 : b1 19 __ LDA (IP + 0),y
+1d06 : 84 02 __ STY $02
+1d08 : a8 __ __ TAY
+1d09 : 4c f3 1c JMP $1cf3 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1d0c : b1 19 __ LDA (IP + 0),y
+1d0e : 85 1f __ STA ADDR + 0
+1d10 : c8 __ __ INY
+1d11 : b1 19 __ LDA (IP + 0),y
+1d13 : 85 20 __ STA ADDR + 1
+1d15 : c8 __ __ INY
+1d16 : b1 19 __ LDA (IP + 0),y
+1d18 : aa __ __ TAX
+1d19 : 84 02 __ STY $02
+1d1b : a0 00 __ LDY #$00
+1d1d : b1 1f __ LDA (ADDR + 0),y
+1d1f : 95 00 __ STA $00,x
+1d21 : c8 __ __ INY
+1d22 : b1 1f __ LDA (ADDR + 0),y
+1d24 : 95 01 __ STA $01,x
+1d26 : c8 __ __ INY
+1d27 : b1 1f __ LDA (ADDR + 0),y
+1d29 : 95 02 __ STA $02,x
+1d2b : c8 __ __ INY
+1d2c : b1 1f __ LDA (ADDR + 0),y
+1d2e : 95 03 __ STA $03,x
+1d30 : a4 02 __ LDY $02
+1d32 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d35 : b1 19 __ LDA (IP + 0),y
+1d37 : aa __ __ TAX
+1d38 : c8 __ __ INY
+1d39 : b1 19 __ LDA (IP + 0),y
+1d3b : 84 02 __ STY $02
+1d3d : a8 __ __ TAY
+1d3e : 4c 1d 1d JMP $1d1d ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1d41 : b1 19 __ LDA (IP + 0),y
+1d43 : 85 1f __ STA ADDR + 0
+1d45 : c8 __ __ INY
+1d46 : b1 19 __ LDA (IP + 0),y
+1d48 : 85 20 __ STA ADDR + 1
+1d4a : c8 __ __ INY
+1d4b : b1 19 __ LDA (IP + 0),y
+1d4d : aa __ __ TAX
+1d4e : 84 02 __ STY $02
+1d50 : a0 00 __ LDY #$00
+1d52 : b5 00 __ LDA $00,x
+1d54 : 91 1f __ STA (ADDR + 0),y
+1d56 : a4 02 __ LDY $02
+1d58 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d5b : b1 19 __ LDA (IP + 0),y
+1d5d : aa __ __ TAX
+1d5e : c8 __ __ INY
+1d5f : b1 19 __ LDA (IP + 0),y
+1d61 : 84 02 __ STY $02
+1d63 : a8 __ __ TAY
+1d64 : 4c 52 1d JMP $1d52 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1d67 : b1 19 __ LDA (IP + 0),y
+1d69 : aa __ __ TAX
+1d6a : 18 __ __ CLC
+1d6b : a5 1b __ LDA ACCU + 0
+1d6d : 75 00 __ ADC $00,x
+1d6f : 85 1b __ STA ACCU + 0
+1d71 : a5 1c __ LDA ACCU + 1
+1d73 : 75 01 __ ADC $01,x
+1d75 : 85 1c __ STA ACCU + 1
+1d77 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1d7a : b1 19 __ LDA (IP + 0),y
+1d7c : aa __ __ TAX
+1d7d : 38 __ __ SEC
+1d7e : a5 1b __ LDA ACCU + 0
+1d80 : f5 00 __ SBC $00,x
+1d82 : 85 1b __ STA ACCU + 0
+1d84 : a5 1c __ LDA ACCU + 1
+1d86 : f5 01 __ SBC $01,x
+1d88 : 85 1c __ STA ACCU + 1
+1d8a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+1d8d : b1 19 __ LDA (IP + 0),y
+1d8f : aa __ __ TAX
+1d90 : a5 1b __ LDA ACCU + 0
+1d92 : 55 00 __ EOR $00,x
+1d94 : 85 1b __ STA ACCU + 0
+1d96 : a5 1c __ LDA ACCU + 1
+1d98 : 55 01 __ EOR $01,x
+1d9a : 85 1c __ STA ACCU + 1
+1d9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1d9f : b1 19 __ LDA (IP + 0),y
+1da1 : aa __ __ TAX
+1da2 : b5 00 __ LDA $00,x
+1da4 : 85 03 __ STA $03
+1da6 : b5 01 __ LDA $01,x
+1da8 : 85 04 __ STA $04
+1daa : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1dad : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1db0 : b1 19 __ LDA (IP + 0),y
+1db2 : aa __ __ TAX
+1db3 : b5 00 __ LDA $00,x
+1db5 : 85 03 __ STA $03
+1db7 : b5 01 __ LDA $01,x
+1db9 : 85 04 __ STA $04
+1dbb : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1dbe : a5 05 __ LDA $05
+1dc0 : 85 1b __ STA ACCU + 0
+1dc2 : a5 06 __ LDA $06
+1dc4 : 85 1c __ STA ACCU + 1
+1dc6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1dc9 : b1 19 __ LDA (IP + 0),y
+1dcb : aa __ __ TAX
+1dcc : b5 00 __ LDA $00,x
+1dce : 85 03 __ STA $03
+1dd0 : b5 01 __ LDA $01,x
+1dd2 : 85 04 __ STA $04
+1dd4 : 24 1c __ BIT ACCU + 1
+1dd6 : 10 10 __ BPL $1de8
+1dd8 : 20 99 18 JSR $1899 ; (negaccu + 0)
+1ddb : 24 04 __ BIT $04
+1ddd : 10 10 __ BPL $1def
+1ddf : 20 a7 18 JSR $18a7 ; (negtmp + 0)
+1de2 : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1de5 : 4c 50 08 JMP $0850 ; (startup + 79)
+1de8 : 24 04 __ BIT $04
+1dea : 10 f6 __ BPL $1de2
+1dec : 20 a7 18 JSR $18a7 ; (negtmp + 0)
+1def : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1df2 : 20 99 18 JSR $1899 ; (negaccu + 0)
+1df5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1df8 : b1 19 __ LDA (IP + 0),y
+1dfa : aa __ __ TAX
+1dfb : b5 00 __ LDA $00,x
+1dfd : 85 03 __ STA $03
+1dff : b5 01 __ LDA $01,x
+1e01 : 85 04 __ STA $04
+1e03 : 24 1c __ BIT ACCU + 1
+1e05 : 10 18 __ BPL $1e1f
+1e07 : 20 99 18 JSR $1899 ; (negaccu + 0)
+1e0a : 24 04 __ BIT $04
+1e0c : 10 18 __ BPL $1e26
+1e0e : 20 a7 18 JSR $18a7 ; (negtmp + 0)
+1e11 : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1e14 : a5 05 __ LDA $05
+1e16 : 85 1b __ STA ACCU + 0
+1e18 : a5 06 __ LDA $06
+1e1a : 85 1c __ STA ACCU + 1
+1e1c : 4c 50 08 JMP $0850 ; (startup + 79)
+1e1f : 24 04 __ BIT $04
+1e21 : 10 ee __ BPL $1e11
+1e23 : 20 a7 18 JSR $18a7 ; (negtmp + 0)
+1e26 : 20 b5 18 JSR $18b5 ; (divmod + 0)
+1e29 : a5 05 __ LDA $05
+1e2b : 85 1b __ STA ACCU + 0
+1e2d : a5 06 __ LDA $06
+1e2f : 85 1c __ STA ACCU + 1
+1e31 : 20 99 18 JSR $1899 ; (negaccu + 0)
+1e34 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1e37 : b1 19 __ LDA (IP + 0),y
+1e39 : aa __ __ TAX
+1e3a : 18 __ __ CLC
+1e3b : b5 00 __ LDA $00,x
+1e3d : 65 1b __ ADC ACCU + 0
+1e3f : 95 00 __ STA $00,x
+1e41 : b5 01 __ LDA $01,x
+1e43 : 65 1c __ ADC ACCU + 1
+1e45 : 95 01 __ STA $01,x
+1e47 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1e4a : b1 19 __ LDA (IP + 0),y
+1e4c : c8 __ __ INY
+1e4d : aa __ __ TAX
+1e4e : 18 __ __ CLC
+1e4f : b5 00 __ LDA $00,x
+1e51 : 71 19 __ ADC (IP + 0),y
+1e53 : c8 __ __ INY
+1e54 : 95 00 __ STA $00,x
+1e56 : b5 01 __ LDA $01,x
+1e58 : 71 19 __ ADC (IP + 0),y
+1e5a : 95 01 __ STA $01,x
+1e5c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1e5f : b1 19 __ LDA (IP + 0),y
+1e61 : c8 __ __ INY
+1e62 : aa __ __ TAX
+1e63 : 38 __ __ SEC
+1e64 : b1 19 __ LDA (IP + 0),y
+1e66 : c8 __ __ INY
+1e67 : f5 00 __ SBC $00,x
+1e69 : 95 00 __ STA $00,x
+1e6b : b1 19 __ LDA (IP + 0),y
+1e6d : f5 01 __ SBC $01,x
+1e6f : 95 01 __ STA $01,x
+1e71 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1e74 : b1 19 __ LDA (IP + 0),y
+1e76 : c8 __ __ INY
+1e77 : aa __ __ TAX
+1e78 : b5 00 __ LDA $00,x
+1e7a : 31 19 __ AND (IP + 0),y
+1e7c : c8 __ __ INY
+1e7d : 95 00 __ STA $00,x
+1e7f : b5 01 __ LDA $01,x
+1e81 : 31 19 __ AND (IP + 0),y
+1e83 : 95 01 __ STA $01,x
+1e85 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1e88 : b1 19 __ LDA (IP + 0),y
+1e8a : c8 __ __ INY
+1e8b : aa __ __ TAX
+1e8c : a9 00 __ LDA #$00
+1e8e : 85 05 __ STA $05
+1e90 : 85 06 __ STA $06
+1e92 : b5 00 __ LDA $00,x
+1e94 : 85 03 __ STA $03
+1e96 : b5 01 __ LDA $01,x
+1e98 : 85 04 __ STA $04
+1e9a : b1 19 __ LDA (IP + 0),y
+1e9c : 4a __ __ LSR
+1e9d : 85 07 __ STA $07
+1e9f : 90 0d __ BCC $1eae
+1ea1 : 18 __ __ CLC
+1ea2 : a5 05 __ LDA $05
+1ea4 : 65 03 __ ADC $03
+1ea6 : 85 05 __ STA $05
+1ea8 : a5 06 __ LDA $06
+1eaa : 65 04 __ ADC $04
+1eac : 85 06 __ STA $06
+1eae : 06 03 __ ASL $03
+1eb0 : 26 04 __ ROL $04
+1eb2 : 46 07 __ LSR $07
+1eb4 : b0 eb __ BCS $1ea1
+1eb6 : d0 f6 __ BNE $1eae
+1eb8 : a5 05 __ LDA $05
+1eba : 95 00 __ STA $00,x
+1ebc : a5 06 __ LDA $06
+1ebe : 95 01 __ STA $01,x
+1ec0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1ec3 : b1 19 __ LDA (IP + 0),y
+1ec5 : c8 __ __ INY
+1ec6 : aa __ __ TAX
+1ec7 : 18 __ __ CLC
+1ec8 : b5 00 __ LDA $00,x
+1eca : 71 19 __ ADC (IP + 0),y
+1ecc : 95 00 __ STA $00,x
+1ece : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+1ed1 : b1 19 __ LDA (IP + 0),y
+1ed3 : aa __ __ TAX
+1ed4 : b5 00 __ LDA $00,x
+1ed6 : 2c b1 19 BIT $19b1 ; (uint16_to_float + 23)
+1ed9 : 29 0f __ AND #$0f
+1edb : f0 0b __ BEQ $1ee8
+1edd : aa __ __ TAX
+1ede : a5 1c __ LDA ACCU + 1
+1ee0 : 06 1b __ ASL ACCU + 0
+1ee2 : 2a __ __ ROL
+1ee3 : ca __ __ DEX
+1ee4 : d0 fa __ BNE $1ee0
+1ee6 : 85 1c __ STA ACCU + 1
+1ee8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+1eeb : b1 19 __ LDA (IP + 0),y
+1eed : aa __ __ TAX
+1eee : b5 00 __ LDA $00,x
+1ef0 : 2c b1 19 BIT $19b1 ; (uint16_to_float + 23)
+1ef3 : 29 0f __ AND #$0f
+1ef5 : f0 0b __ BEQ $1f02
+1ef7 : aa __ __ TAX
+1ef8 : a5 1c __ LDA ACCU + 1
+1efa : 4a __ __ LSR
+1efb : 66 1b __ ROR ACCU + 0
+1efd : ca __ __ DEX
+1efe : d0 fa __ BNE $1efa
+1f00 : 85 1c __ STA ACCU + 1
+1f02 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1f05 : b1 19 __ LDA (IP + 0),y
+1f07 : aa __ __ TAX
+1f08 : 38 __ __ SEC
+1f09 : b5 01 __ LDA $01,x
+1f0b : e5 1c __ SBC ACCU + 1
+1f0d : f0 11 __ BEQ $1f20
+1f0f : 50 02 __ BVC $1f13
+1f11 : 49 80 __ EOR #$80
+1f13 : 30 2a __ BMI $1f3f
+1f15 : 10 33 __ BPL $1f4a
+1f17 : b1 19 __ LDA (IP + 0),y
+1f19 : aa __ __ TAX
+1f1a : b5 01 __ LDA $01,x
+1f1c : c5 1c __ CMP ACCU + 1
+1f1e : d0 28 __ BNE $1f48
+1f20 : b5 00 __ LDA $00,x
+1f22 : c5 1b __ CMP ACCU + 0
+1f24 : d0 22 __ BNE $1f48
+1f26 : f0 0e __ BEQ $1f36
+1f28 : b1 19 __ LDA (IP + 0),y
+1f2a : aa __ __ TAX
+1f2b : c8 __ __ INY
+1f2c : b1 19 __ LDA (IP + 0),y
+1f2e : c5 1c __ CMP ACCU + 1
+1f30 : d0 16 __ BNE $1f48
+1f32 : e4 1b __ CPX ACCU + 0
+1f34 : d0 12 __ BNE $1f48
+1f36 : a9 00 __ LDA #$00
+1f38 : 85 1b __ STA ACCU + 0
+1f3a : 85 1c __ STA ACCU + 1
+1f3c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f3f : a9 ff __ LDA #$ff
+1f41 : 85 1b __ STA ACCU + 0
+1f43 : 85 1c __ STA ACCU + 1
+1f45 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f48 : 90 f5 __ BCC $1f3f
+1f4a : a9 01 __ LDA #$01
+1f4c : 85 1b __ STA ACCU + 0
+1f4e : a9 00 __ LDA #$00
+1f50 : 85 1c __ STA ACCU + 1
+1f52 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f55 : b1 19 __ LDA (IP + 0),y
+1f57 : c8 __ __ INY
+1f58 : aa __ __ TAX
+1f59 : b1 19 __ LDA (IP + 0),y
+1f5b : 38 __ __ SEC
+1f5c : e5 1c __ SBC ACCU + 1
+1f5e : d0 af __ BNE $1f0f
+1f60 : e4 1b __ CPX ACCU + 0
+1f62 : d0 e4 __ BNE $1f48
+1f64 : f0 d0 __ BEQ $1f36
+1f66 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1f67 : b1 19 __ LDA (IP + 0),y
+1f69 : aa __ __ TAX
+1f6a : 38 __ __ SEC
+1f6b : b5 00 __ LDA $00,x
+1f6d : e5 1b __ SBC ACCU + 0
+1f6f : f0 19 __ BEQ $1f8a
+1f71 : 50 02 __ BVC $1f75
+1f73 : 49 80 __ EOR #$80
+1f75 : 30 1c __ BMI $1f93
+1f77 : 10 25 __ BPL $1f9e
+1f79 : b1 19 __ LDA (IP + 0),y
+1f7b : aa __ __ TAX
+1f7c : b5 00 __ LDA $00,x
+1f7e : c5 1b __ CMP ACCU + 0
+1f80 : d0 1a __ BNE $1f9c
+1f82 : f0 06 __ BEQ $1f8a
+1f84 : b1 19 __ LDA (IP + 0),y
+1f86 : c5 1b __ CMP ACCU + 0
+1f88 : d0 12 __ BNE $1f9c
+1f8a : a9 00 __ LDA #$00
+1f8c : 85 1b __ STA ACCU + 0
+1f8e : 85 1c __ STA ACCU + 1
+1f90 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f93 : a9 ff __ LDA #$ff
+1f95 : 85 1b __ STA ACCU + 0
+1f97 : 85 1c __ STA ACCU + 1
+1f99 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f9c : 90 f5 __ BCC $1f93
+1f9e : a9 01 __ LDA #$01
+1fa0 : 85 1b __ STA ACCU + 0
+1fa2 : a9 00 __ LDA #$00
+1fa4 : 85 1c __ STA ACCU + 1
+1fa6 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fa9 : b1 19 __ LDA (IP + 0),y
+1fab : 38 __ __ SEC
+1fac : e5 1b __ SBC ACCU + 0
+1fae : d0 c1 __ BNE $1f71
+1fb0 : f0 d8 __ BEQ $1f8a
+1fb2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1fb3 : 38 __ __ SEC
+1fb4 : a9 00 __ LDA #$00
+1fb6 : e5 1b __ SBC ACCU + 0
+1fb8 : 85 1b __ STA ACCU + 0
+1fba : a9 00 __ LDA #$00
+1fbc : e5 1c __ SBC ACCU + 1
+1fbe : 85 1c __ STA ACCU + 1
+1fc0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1fc3 : 20 70 16 JSR $1670 ; (freg + 0)
+1fc6 : 20 b5 16 JSR $16b5 ; (faddsub + 0)
+1fc9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1fcc : 20 70 16 JSR $1670 ; (freg + 0)
+1fcf : a5 06 __ LDA $06
+1fd1 : 49 80 __ EOR #$80
+1fd3 : 85 06 __ STA $06
+1fd5 : 20 b5 16 JSR $16b5 ; (faddsub + 0)
+1fd8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1fdb : 20 70 16 JSR $1670 ; (freg + 0)
+1fde : 84 02 __ STY $02
+1fe0 : 20 7d 17 JSR $177d ; (fmul + 0)
+1fe3 : a4 02 __ LDY $02
+1fe5 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1fe8 : 20 70 16 JSR $1670 ; (freg + 0)
+1feb : 20 1b 18 JSR $181b ; (fdiv + 0)
+1fee : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1ff1 : b1 19 __ LDA (IP + 0),y
+1ff3 : c8 __ __ INY
+1ff4 : aa __ __ TAX
+1ff5 : a5 1e __ LDA ACCU + 3
+1ff7 : 55 03 __ EOR $03,x
+1ff9 : 29 80 __ AND #$80
+1ffb : f0 1e __ BEQ $201b
+1ffd : a5 1e __ LDA ACCU + 3
+1fff : 29 7f __ AND #$7f
+2001 : 05 1d __ ORA ACCU + 2
+2003 : 05 1c __ ORA ACCU + 1
+2005 : 05 1b __ ORA ACCU + 0
+2007 : d0 0c __ BNE $2015
+2009 : b5 03 __ LDA $03,x
+200b : 29 7f __ AND #$7f
+200d : 15 02 __ ORA $02,x
+200f : 15 01 __ ORA $01,x
+2011 : 15 00 __ ORA $00,x
+2013 : f0 1e __ BEQ $2033
+2015 : a5 1e __ LDA ACCU + 3
+2017 : 30 29 __ BMI $2042
+2019 : 10 36 __ BPL $2051
+201b : a5 1e __ LDA ACCU + 3
+201d : d5 03 __ CMP $03,x
+201f : d0 1b __ BNE $203c
+2021 : a5 1d __ LDA ACCU + 2
+2023 : d5 02 __ CMP $02,x
+2025 : d0 15 __ BNE $203c
+2027 : a5 1c __ LDA ACCU + 1
+2029 : d5 01 __ CMP $01,x
+202b : d0 0f __ BNE $203c
+202d : a5 1b __ LDA ACCU + 0
+202f : d5 00 __ CMP $00,x
+2031 : d0 09 __ BNE $203c
+2033 : a9 00 __ LDA #$00
+2035 : 85 1b __ STA ACCU + 0
+2037 : 85 1c __ STA ACCU + 1
+2039 : 4c 51 08 JMP $0851 ; (startup + 80)
+203c : b0 0f __ BCS $204d
+203e : 24 1e __ BIT ACCU + 3
+2040 : 30 0f __ BMI $2051
+2042 : a9 00 __ LDA #$00
+2044 : 85 1c __ STA ACCU + 1
+2046 : a9 01 __ LDA #$01
+2048 : 85 1b __ STA ACCU + 0
+204a : 4c 51 08 JMP $0851 ; (startup + 80)
+204d : 24 1e __ BIT ACCU + 3
+204f : 30 f1 __ BMI $2042
+2051 : a9 ff __ LDA #$ff
+2053 : 85 1b __ STA ACCU + 0
+2055 : 85 1c __ STA ACCU + 1
+2057 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+205a : a5 1e __ LDA ACCU + 3
+205c : 49 80 __ EOR #$80
+205e : 85 1e __ STA ACCU + 3
+2060 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+2063 : 20 7c 19 JSR $197c ; (sint16_to_float + 0)
+2066 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+2069 : 20 3a 19 JSR $193a ; (f32_to_i16 + 0)
+206c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+206f : b1 19 __ LDA (IP + 0),y
+2071 : 30 0c __ BMI $207f
+2073 : 38 __ __ SEC
+2074 : 65 19 __ ADC IP + 0
+2076 : 85 19 __ STA IP + 0
+2078 : 90 02 __ BCC $207c
+207a : e6 1a __ INC IP + 1
+207c : 4c 51 08 JMP $0851 ; (startup + 80)
+207f : 38 __ __ SEC
+2080 : 65 19 __ ADC IP + 0
+2082 : 85 19 __ STA IP + 0
+2084 : b0 02 __ BCS $2088
+2086 : c6 1a __ DEC IP + 1
+2088 : 4c 51 08 JMP $0851 ; (startup + 80)
+208b : a5 1b __ LDA ACCU + 0
+208d : 05 1c __ ORA ACCU + 1
+208f : f0 de __ BEQ $206f
+2091 : 4c 50 08 JMP $0850 ; (startup + 79)
+2094 : a5 1b __ LDA ACCU + 0
+2096 : 05 1c __ ORA ACCU + 1
+2098 : d0 d5 __ BNE $206f
+209a : 4c 50 08 JMP $0850 ; (startup + 79)
+209d : a5 1c __ LDA ACCU + 1
+209f : 30 04 __ BMI $20a5
+20a1 : 05 1b __ ORA ACCU + 0
+20a3 : d0 ca __ BNE $206f
+20a5 : 4c 50 08 JMP $0850 ; (startup + 79)
+20a8 : a5 1c __ LDA ACCU + 1
+20aa : 10 c3 __ BPL $206f
+20ac : 4c 50 08 JMP $0850 ; (startup + 79)
+20af : a5 1c __ LDA ACCU + 1
+20b1 : 30 bc __ BMI $206f
+20b3 : 4c 50 08 JMP $0850 ; (startup + 79)
+20b6 : a5 1c __ LDA ACCU + 1
+20b8 : 30 b5 __ BMI $206f
+20ba : 05 1b __ ORA ACCU + 0
+20bc : f0 b1 __ BEQ $206f
+20be : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+20c1 : 38 __ __ SEC
+20c2 : b1 19 __ LDA (IP + 0),y
+20c4 : 65 19 __ ADC IP + 0
+20c6 : aa __ __ TAX
+20c7 : c8 __ __ INY
+20c8 : b1 19 __ LDA (IP + 0),y
+20ca : 65 1a __ ADC IP + 1
+20cc : 85 1a __ STA IP + 1
+20ce : 86 19 __ STX IP + 0
+20d0 : 4c 51 08 JMP $0851 ; (startup + 80)
+20d3 : a5 1b __ LDA ACCU + 0
+20d5 : 05 1c __ ORA ACCU + 1
+20d7 : f0 e8 __ BEQ $20c1
+20d9 : c8 __ __ INY
+20da : 4c 50 08 JMP $0850 ; (startup + 79)
+20dd : a5 1b __ LDA ACCU + 0
+20df : 05 1c __ ORA ACCU + 1
+20e1 : d0 de __ BNE $20c1
+20e3 : c8 __ __ INY
+20e4 : 4c 50 08 JMP $0850 ; (startup + 79)
+20e7 : a5 1c __ LDA ACCU + 1
+20e9 : 30 04 __ BMI $20ef
+20eb : 05 1b __ ORA ACCU + 0
+20ed : d0 d2 __ BNE $20c1
+20ef : c8 __ __ INY
+20f0 : 4c 50 08 JMP $0850 ; (startup + 79)
+20f3 : a5 1c __ LDA ACCU + 1
+20f5 : 10 ca __ BPL $20c1
+20f7 : c8 __ __ INY
+20f8 : 4c 50 08 JMP $0850 ; (startup + 79)
+20fb : a5 1c __ LDA ACCU + 1
+20fd : 30 c2 __ BMI $20c1
+20ff : c8 __ __ INY
+2100 : 4c 50 08 JMP $0850 ; (startup + 79)
+2103 : a5 1c __ LDA ACCU + 1
+2105 : 30 ba __ BMI $20c1
+2107 : 05 1b __ ORA ACCU + 0
+2109 : f0 b6 __ BEQ $20c1
+210b : c8 __ __ INY
+210c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+210f : a9 00 __ LDA #$00
+2111 : 2c a9 01 BIT $01a9 
+2114 : 85 1b __ STA ACCU + 0
+2116 : a9 00 __ LDA #$00
+2118 : 85 1c __ STA ACCU + 1
+211a : 4c 51 08 JMP $0851 ; (startup + 80)
+211d : a5 1b __ LDA ACCU + 0
+211f : 05 1c __ ORA ACCU + 1
+2121 : f0 ef __ BEQ $2112
+2123 : d0 ea __ BNE $210f
+2125 : a5 1b __ LDA ACCU + 0
+2127 : 05 1c __ ORA ACCU + 1
+2129 : d0 e7 __ BNE $2112
+212b : f0 e2 __ BEQ $210f
+212d : a5 1c __ LDA ACCU + 1
+212f : 30 de __ BMI $210f
+2131 : 05 1b __ ORA ACCU + 0
+2133 : d0 dd __ BNE $2112
+2135 : f0 d8 __ BEQ $210f
+2137 : a5 1c __ LDA ACCU + 1
+2139 : 10 d7 __ BPL $2112
+213b : 30 d2 __ BMI $210f
+213d : a5 1c __ LDA ACCU + 1
+213f : 30 d1 __ BMI $2112
+2141 : 10 cc __ BPL $210f
+2143 : a5 1c __ LDA ACCU + 1
+2145 : 30 cb __ BMI $2112
+2147 : 05 1b __ ORA ACCU + 0
+2149 : f0 c7 __ BEQ $2112
+214b : d0 c2 __ BNE $210f
+214d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+214e : b1 19 __ LDA (IP + 0),y
+2150 : 8d 64 21 STA $2164 ; (inp_jsr + 22)
+2153 : c8 __ __ INY
+2154 : b1 19 __ LDA (IP + 0),y
+2156 : 8d 65 21 STA $2165 ; (inp_jsr + 23)
+2159 : 98 __ __ TYA
+215a : 38 __ __ SEC
+215b : 65 19 __ ADC IP + 0
+215d : 85 19 __ STA IP + 0
+215f : 90 02 __ BCC $2163
+2161 : e6 1a __ INC IP + 1
+2163 : 20 00 00 JSR $0000 
+2166 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+2169 : 98 __ __ TYA
+216a : 18 __ __ CLC
+216b : 65 19 __ ADC IP + 0
+216d : 8d 78 21 STA $2178 ; (inp_native + 15)
+2170 : a5 1a __ LDA IP + 1
+2172 : 69 00 __ ADC #$00
+2174 : 8d 79 21 STA $2179 ; (inp_native + 16)
+2177 : 20 00 00 JSR $0000 
+217a : a0 00 __ LDY #$00
+217c : b1 23 __ LDA (SP + 0),y
+217e : 85 19 __ STA IP + 0
+2180 : c8 __ __ INY
+2181 : b1 23 __ LDA (SP + 0),y
+2183 : 85 1a __ STA IP + 1
+2185 : 88 __ __ DEY
+2186 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+2189 : 38 __ __ SEC
+218a : a5 23 __ LDA SP + 0
+218c : f1 19 __ SBC (IP + 0),y
+218e : c8 __ __ INY
+218f : 85 23 __ STA SP + 0
+2191 : a5 24 __ LDA SP + 1
+2193 : f1 19 __ SBC (IP + 0),y
+2195 : c8 __ __ INY
+2196 : 85 24 __ STA SP + 1
+2198 : b1 19 __ LDA (IP + 0),y
+219a : 84 02 __ STY $02
+219c : a8 __ __ TAY
+219d : a5 25 __ LDA FP + 0
+219f : 91 23 __ STA (SP + 0),y
+21a1 : c8 __ __ INY
+21a2 : a5 26 __ LDA FP + 1
+21a4 : 91 23 __ STA (SP + 0),y
+21a6 : 98 __ __ TYA
+21a7 : 38 __ __ SEC
+21a8 : 65 23 __ ADC SP + 0
+21aa : 85 25 __ STA FP + 0
+21ac : a9 00 __ LDA #$00
+21ae : 65 24 __ ADC SP + 1
+21b0 : 85 26 __ STA FP + 1
+21b2 : 88 __ __ DEY
+21b3 : f0 08 __ BEQ $21bd
+21b5 : b9 52 00 LDA $0052,y 
+21b8 : 88 __ __ DEY
+21b9 : 91 23 __ STA (SP + 0),y
+21bb : d0 f8 __ BNE $21b5
+21bd : a4 02 __ LDY $02
+21bf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+21c2 : b1 19 __ LDA (IP + 0),y
+21c4 : c8 __ __ INY
+21c5 : 84 02 __ STY $02
+21c7 : a8 __ __ TAY
+21c8 : b1 23 __ LDA (SP + 0),y
+21ca : 85 25 __ STA FP + 0
+21cc : c8 __ __ INY
+21cd : b1 23 __ LDA (SP + 0),y
+21cf : 85 26 __ STA FP + 1
+21d1 : 88 __ __ DEY
+21d2 : f0 09 __ BEQ $21dd
+21d4 : 88 __ __ DEY
+21d5 : b1 23 __ LDA (SP + 0),y
+21d7 : 99 53 00 STA $0053,y 
+21da : 88 __ __ DEY
+21db : 10 f8 __ BPL $21d5
+21dd : a4 02 __ LDY $02
+21df : 18 __ __ CLC
+21e0 : b1 19 __ LDA (IP + 0),y
+21e2 : c8 __ __ INY
+21e3 : 65 23 __ ADC SP + 0
+21e5 : 85 23 __ STA SP + 0
+21e7 : b1 19 __ LDA (IP + 0),y
+21e9 : c8 __ __ INY
+21ea : 65 24 __ ADC SP + 1
+21ec : 85 24 __ STA SP + 1
+21ee : a0 01 __ LDY #$01
+21f0 : b1 23 __ LDA (SP + 0),y
+21f2 : 85 1a __ STA IP + 1
+21f4 : 88 __ __ DEY
+21f5 : b1 23 __ LDA (SP + 0),y
+21f7 : 85 19 __ STA IP + 0
+21f9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+21fc : b1 19 __ LDA (IP + 0),y
+21fe : 85 1f __ STA ADDR + 0
+2200 : c8 __ __ INY
+2201 : b1 19 __ LDA (IP + 0),y
+2203 : 85 20 __ STA ADDR + 1
+2205 : c8 __ __ INY
+2206 : 98 __ __ TYA
+2207 : a0 00 __ LDY #$00
+2209 : 18 __ __ CLC
+220a : 65 19 __ ADC IP + 0
+220c : 91 23 __ STA (SP + 0),y
+220e : c8 __ __ INY
+220f : a5 1a __ LDA IP + 1
+2211 : 69 00 __ ADC #$00
+2213 : 91 23 __ STA (SP + 0),y
+2215 : a5 1f __ LDA ADDR + 0
+2217 : 85 19 __ STA IP + 0
+2219 : a5 20 __ LDA ADDR + 1
+221b : 85 1a __ STA IP + 1
+221d : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2220 : 38 __ __ SEC
+2221 : a5 23 __ LDA SP + 0
+2223 : f1 19 __ SBC (IP + 0),y
+2225 : c8 __ __ INY
+2226 : 85 23 __ STA SP + 0
+2228 : a5 24 __ LDA SP + 1
+222a : f1 19 __ SBC (IP + 0),y
+222c : 85 24 __ STA SP + 1
+222e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2231 : 18 __ __ CLC
+2232 : b1 19 __ LDA (IP + 0),y
+2234 : c8 __ __ INY
+2235 : 65 23 __ ADC SP + 0
+2237 : 85 23 __ STA SP + 0
+2239 : b1 19 __ LDA (IP + 0),y
+223b : 65 24 __ ADC SP + 1
+223d : 85 24 __ STA SP + 1
+223f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+2242 : b1 19 __ LDA (IP + 0),y
+2244 : 84 02 __ STY $02
+2246 : a8 __ __ TAY
+2247 : 88 __ __ DEY
+2248 : f0 07 __ BEQ $2251
+224a : b1 1b __ LDA (ACCU + 0),y
+224c : 91 1f __ STA (ADDR + 0),y
+224e : 88 __ __ DEY
+224f : d0 f9 __ BNE $224a
+2251 : b1 1b __ LDA (ACCU + 0),y
+2253 : 91 1f __ STA (ADDR + 0),y
+2255 : a4 02 __ LDY $02
+2257 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+225a : b1 19 __ LDA (IP + 0),y
+225c : c8 __ __ INY
+225d : 8d 6b 22 STA $226b ; (inp_op_extrt + 17)
+2260 : b1 19 __ LDA (IP + 0),y
+2262 : c8 __ __ INY
+2263 : 8d 6c 22 STA $226c ; (inp_op_extrt + 18)
+2266 : b1 19 __ LDA (IP + 0),y
+2268 : c8 __ __ INY
+2269 : aa __ __ TAX
+226a : 20 00 00 JSR $0000 
+226d : 4c 51 08 JMP $0851 ; (startup + 80)
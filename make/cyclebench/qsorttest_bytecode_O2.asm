@@ -0,0 +1,3159 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e d8 22 STX $22d8 ; (spentry + 0)
+0811 : a9 db __ LDA #$db
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 51 __ LDA #$51
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 bb __ LDA #$bb
+0832 : e9 db __ SBC #$db
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 22
+0a04:	PUSH	#$0008
+0a07:	LEA	T0, field + 0
+0a0b:	MOV	T1, #0
+0a0e:	LEA	T2, $157b
+0a12:	MOV	ADDR, T0
+0a14:	MOV	0(ADDR), T1
+0a17:	MOV	ACCU, T0
+0a19:	ADD	ACCU, #$0002
+0a1d:	MOV	2(SP), ACCU
+0a20:	MOV	4(SP), T2
+0a23:	MOV	6(SP), T1
+0a26:	CALL	sprintf + 0
+0a29:	ADD	T0, #$000C
+0a2d:	ADD	T1, #$0001
+0a31:	MOV	ACCU, T1
+0a33:	CMPS	ACCU, #$03E8
+0a36:	BGT	$0A12
+0a38:	LEA	T0, field + 0
+0a3c:	MOV	ACCU, T0
+0a3e:	MOV	T1, ACCU
+0a40:	ADD	ACCU, #$2EE0
+0a44:	MOV	T2, ACCU
+0a46:	LEA	T3, 0(FP)
+0a4a:	CALL	rand + 0
+0a4d:	MOV	T5, ACCU
+0a4f:	MOV	ADDR, T3
+0a51:	MOV	ACCU, T1
+0a53:	COPY	#12
+0a55:	MOV	ACCU, T5
+0a57:	MOV	ADDR, #$03e8
+0a5b:	MODU	ACCU, ADDR
+0a5d:	MUL	ACCU, #12
+0a60:	ADD	ACCU, T0
+0a62:	MOV	T5, ACCU
+0a64:	MOV	ADDR, T1
+0a66:	COPY	#12
+0a68:	MOV	ADDR, T5
+0a6a:	MOV	ACCU, T3
+0a6c:	COPY	#12
+0a6e:	ADD	T1, #$000C
+0a72:	MOV	ACCU, T2
+0a74:	CMPU	ACCU, T1
+0a76:	BLT	$0A4A
+0a78:	LEA	T0, field + 0
+0a7c:	MOV	2(SP), T0
+0a7f:	MOV	ACCU, #$03e8
+0a83:	MOV	4(SP), ACCU
+0a86:	CALL	qsort + 0
+0a89:	LEA	T0, field + 0
+0a8d:	MOV	T1, #0
+0a90:	MOV	ADDR, T0
+0a92:	MOV	T2, 0(ADDR)
+0a95:	MOV	ACCU, T1
+0a97:	CMPU	ACCU, T2
+0a99:	SEQ
+0a9a:	MOVB	2(SP), ACCU
+0a9d:	CALL	assert + 0
+0aa0:	ADD	T0, #$000C
+0aa4:	ADD	T1, #$0001
+0aa8:	MOV	ACCU, T1
+0aaa:	CMPS	ACCU, #$03E8
+0aad:	BGT	$0A90
+0aaf:	MOV	ACCU, #0
+0ab2:	POP	#$0008
+0ab5:	RETURN	8, 22
+--------------------------------------------------------------------
+sprintf:
+0ab9:	ENTER	10, 20
+0abd:	PUSH	#$0002
+0ac0:	MOVB	T0, #0
+0ac3:	MOV	T1, 12(FP)
+0ac6:	MOV	ADDR, T1
+0ac8:	MOVB	T2, 0(ADDR)
+0acb:	MOV	T3, 10(FP)
+0ace:	MOVB	ACCU, T2
+0ad0:	BNE	$0AF6
+0ad2:	MOVB	ACCU, T0
+0ad4:	ADD	ACCU, T3
+0ad6:	MOV	T1, ACCU
+0ad8:	MOV	ACCU, #0
+0adb:	MOV	ADDR, T1
+0add:	MOVB	0(ADDR), ACCU
+0ae0:	MOVB	ACCU, T0
+0ae2:	BNE	$0AE8
+0ae4:	MOV	ACCU, T3
+0ae6:	MOV	T1, ACCU
+0ae8:	MOV	T3, 10(FP)
+0aeb:	MOV	ACCU, T1
+0aed:	SUB	ACCU, T3
+0aef:	POP	#$0002
+0af2:	RETURN	10, 20
+0af6:	LEA	T4, 14(FP)
+0afa:	ADD	T1, #$0001
+0afe:	MOVB	ACCU, T2
+0b00:	CMPUB	ACCU, #$0025
+0b02:	BEQ	$0B37
+0b04:	MOVB	ACCU, T0
+0b06:	LEAX	ADDR, T3 + ACCU
+0b08:	MOVB	0(ADDR), T2
+0b0b:	ADDB	T0, #$0001
+0b0e:	MOVB	ACCU, T0
+0b10:	CMPUB	ACCU, #$0028
+0b12:	BLE	$0B1F
+0b14:	MOV	ADDR, T1
+0b16:	MOVB	T5, 0(ADDR)
+0b19:	ADD	T1, #$0001
+0b1d:	JUMP	$0B2F
+0b1f:	MOVB	ACCU, T0
+0b21:	ADD	T3, ACCU
+0b23:	MOVB	T0, #0
+0b26:	MOV	ADDR, T1
+0b28:	MOVB	T5, 0(ADDR)
+0b2b:	ADD	T1, #$0001
+0b2f:	MOVB	ACCU, T5
+0b31:	MOVB	T2, ACCU
+0b33:	BNE	$0AFE
+0b35:	JUMP	$0AD2
+0b37:	MOVB	ACCU, T0
+0b39:	BEQ	$0B42
+0b3b:	MOVB	ACCU, T0
+0b3d:	ADD	T3, ACCU
+0b3f:	MOVB	T0, #0
+0b42:	MOV	ADDR, T1
+0b44:	MOVB	T2, 0(ADDR)
+0b47:	MOV	ACCU, #10
+0b4a:	MOV	3(FP), ACCU
+0b4d:	MOV	ACCU, #1
+0b50:	MOVB	1(FP), ACCU
+0b53:	MOV	ACCU, #255
+0b56:	MOVB	2(FP), ACCU
+0b59:	MOV	ACCU, #32
+0b5c:	MOVB	0(FP), ACCU
+0b5f:	MOV	ACCU, #0
+0b62:	MOVB	5(FP), ACCU
+0b65:	MOVB	6(FP), ACCU
+0b68:	MOVB	7(FP), ACCU
+0b6b:	ADD	T1, #$0001
+0b6f:	MOVB	ACCU, T2
+0b71:	CMPUB	ACCU, #$002B
+0b73:	BEQF	$10BB
+0b76:	MOVB	ACCU, T2
+0b78:	CMPUB	ACCU, #$0030
+0b7a:	BEQF	$10AD
+0b7d:	MOVB	ACCU, T2
+0b7f:	CMPUB	ACCU, #$0023
+0b81:	BEQF	$109F
+0b84:	MOVB	ACCU, T2
+0b86:	CMPUB	ACCU, #$0030
+0b88:	BGT	$0B91
+0b8a:	MOVB	ACCU, T2
+0b8c:	CMPUB	ACCU, #$0039
+0b8e:	BGEF	$106E
+0b91:	MOVB	ACCU, T2
+0b93:	CMPUB	ACCU, #$002E
+0b95:	BEQF	$1034
+0b98:	MOVB	ACCU, T2
+0b9a:	CMPUB	ACCU, #$0064
+0b9c:	BEQF	$0F00
+0b9f:	MOVB	ACCU, T2
+0ba1:	CMPUB	ACCU, #$0075
+0ba3:	BEQF	$0E03
+0ba6:	MOVB	ACCU, T2
+0ba8:	CMPUB	ACCU, #$0078
+0baa:	BEQF	$0CF4
+0bad:	MOVB	ACCU, T2
+0baf:	CMPUB	ACCU, #$006C
+0bb1:	BEQF	$0C69
+0bb4:	MOVB	ACCU, T2
+0bb6:	CMPUB	ACCU, #$0066
+0bb8:	BEQF	$0C3F
+0bbb:	MOVB	ACCU, T2
+0bbd:	CMPUB	ACCU, #$0067
+0bbf:	BEQ	$0C3F
+0bc1:	MOVB	ACCU, T2
+0bc3:	CMPUB	ACCU, #$0065
+0bc5:	BEQ	$0C3F
+0bc7:	MOVB	ACCU, T2
+0bc9:	CMPUB	ACCU, #$0073
+0bcb:	BEQ	$0C0D
+0bcd:	MOVB	ACCU, T2
+0bcf:	CMPUB	ACCU, #$0063
+0bd1:	BEQ	$0BEE
+0bd3:	MOVB	ACCU, T2
+0bd5:	BEQF	$0B14
+0bd8:	MOVB	ACCU, T0
+0bda:	LEAX	ADDR, T3 + ACCU
+0bdc:	MOVB	0(ADDR), T2
+0bdf:	ADDB	T0, #$0001
+0be2:	MOV	ADDR, T1
+0be4:	MOVB	T5, 0(ADDR)
+0be7:	ADD	T1, #$0001
+0beb:	JUMPF	$0B2F
+0bee:	MOVB	ACCU, T0
+0bf0:	MOV	ADDR, T4
+0bf2:	MOV	T7, 0(ADDR)
+0bf5:	LEAX	ADDR, T3 + ACCU
+0bf7:	MOVB	0(ADDR), T7
+0bfa:	ADD	T4, #$0002
+0bfe:	ADDB	T0, #$0001
+0c01:	MOV	ADDR, T1
+0c03:	MOVB	T5, 0(ADDR)
+0c06:	ADD	T1, #$0001
+0c0a:	JUMPF	$0B2F
+0c0d:	MOV	ADDR, T4
+0c0f:	MOV	T6, 0(ADDR)
+0c12:	ADD	T4, #$0002
+0c16:	MOV	ADDR, T6
+0c18:	MOVB	T2, 0(ADDR)
+0c1b:	MOVB	ACCU, T2
+0c1d:	BEQF	$0B14
+0c20:	ADD	T6, #$0001
+0c24:	MOV	ADDR, T3
+0c26:	MOVB	0(ADDR), T2
+0c29:	ADD	T3, #$0001
+0c2d:	MOV	ADDR, T6
+0c2f:	MOVB	T5, 0(ADDR)
+0c32:	ADD	T6, #$0001
+0c36:	MOVB	ACCU, T5
+0c38:	MOVB	T2, ACCU
+0c3a:	BNE	$0C24
+0c3c:	JUMPF	$0B14
+0c3f:	LEA	P0, 0(FP)
+0c43:	MOV	ACCU, T3
+0c45:	MOV	P2, ACCU
+0c47:	MOV	ADDR, T4
+0c49:	MOVD	T11, 0(ADDR)
+0c4c:	MOVD	ACCU, T11
+0c4e:	MOVD	P4, ACCU
+0c50:	MOVB	ACCU, T2
+0c52:	MOVB	P8, ACCU
+0c54:	CALL	nformf + 0
+0c57:	MOV	T0, ACCU
+0c59:	ADD	T4, #$0004
+0c5d:	MOV	ADDR, T1
+0c5f:	MOVB	T5, 0(ADDR)
+0c62:	ADD	T1, #$0001
+0c66:	JUMPF	$0B2F
+0c69:	MOV	ADDR, T4
+0c6b:	MOVD	T11, 0(ADDR)
+0c6e:	ADD	T4, #$0004
+0c72:	MOV	ADDR, T1
+0c74:	MOVB	T2, 0(ADDR)
+0c77:	ADD	T1, #$0001
+0c7b:	MOVB	ACCU, T2
+0c7d:	CMPUB	ACCU, #$0064
+0c7f:	BEQ	$0CD4
+0c81:	MOVB	ACCU, T2
+0c83:	CMPUB	ACCU, #$0075
+0c85:	BEQ	$0CB4
+0c87:	MOVB	ACCU, T2
+0c89:	CMPUB	ACCU, #$0078
+0c8b:	BNEF	$0B14
+0c8e:	MOV	ACCU, #16
+0c91:	MOV	3(FP), ACCU
+0c94:	LEA	P0, 0(FP)
+0c98:	MOV	ACCU, T3
+0c9a:	MOV	P2, ACCU
+0c9c:	MOVD	ACCU, T11
+0c9e:	MOVD	P4, ACCU
+0ca0:	MOVB	P8, #0
+0ca3:	CALL	nforml + 0
+0ca6:	MOV	T0, ACCU
+0ca8:	MOV	ADDR, T1
+0caa:	MOVB	T5, 0(ADDR)
+0cad:	ADD	T1, #$0001
+0cb1:	JUMPF	$0B2F
+0cb4:	LEA	P0, 0(FP)
+0cb8:	MOV	ACCU, T3
+0cba:	MOV	P2, ACCU
+0cbc:	MOVD	ACCU, T11
+0cbe:	MOVD	P4, ACCU
+0cc0:	MOVB	P8, #0
+0cc3:	CALL	nforml + 0
+0cc6:	MOV	T0, ACCU
+0cc8:	MOV	ADDR, T1
+0cca:	MOVB	T5, 0(ADDR)
+0ccd:	ADD	T1, #$0001
+0cd1:	JUMPF	$0B2F
+0cd4:	LEA	P0, 0(FP)
+0cd8:	MOV	ACCU, T3
+0cda:	MOV	P2, ACCU
+0cdc:	MOVD	ACCU, T11
+0cde:	MOVD	P4, ACCU
+0ce0:	MOVB	P8, #1
+0ce3:	CALL	nforml + 0
+0ce6:	MOV	T0, ACCU
+0ce8:	MOV	ADDR, T1
+0cea:	MOVB	T5, 0(ADDR)
+0ced:	ADD	T1, #$0001
+0cf1:	JUMPF	$0B2F
+0cf4:	MOV	ACCU, #16
+0cf7:	MOV	3(FP), ACCU
+0cfa:	MOV	ACCU, T3
+0cfc:	MOV	T6, ACCU
+0cfe:	MOV	ADDR, T4
+0d00:	MOV	T7, 0(ADDR)
+0d03:	ADD	T4, #$0002
+0d07:	MOVB	T0, #10
+0d0a:	MOV	ACCU, T7
+0d0c:	BNEF	$0DD3
+0d0f:	MOVB	T2, 2(FP)
+0d12:	MOVB	ACCU, T2
+0d14:	CMPUB	ACCU, #$00FF
+0d16:	BNEF	$0DC3
+0d19:	MOVB	T2, #9
+0d1c:	MOVB	ACCU, T0
+0d1e:	CMPUB	ACCU, #$0009
+0d20:	BGE	$0D35
+0d22:	ADDB	T0, #$00FF
+0d25:	MOVB	ACCU, T0
+0d27:	LEAX	ADDR, T6 + ACCU
+0d29:	MOV	ACCU, #48
+0d2c:	MOVB	0(ADDR), ACCU
+0d2f:	MOVB	ACCU, T2
+0d31:	CMPUB	ACCU, T0
+0d33:	BGT	$0D22
+0d35:	MOVUB	ACCU, 7(FP)
+0d38:	BEQ	$0D5E
+0d3a:	MOV	ACCU, 3(FP)
+0d3d:	CMPU	ACCU, #$0010
+0d40:	BNE	$0D5E
+0d42:	MOVB	ACCU, T0
+0d44:	ADDB	ACCU, #$00FF
+0d47:	MOVB	ACCU, ACCU
+0d49:	LEAX	ADDR, T6 + ACCU
+0d4b:	MOV	ACCU, #88
+0d4e:	MOVB	0(ADDR), ACCU
+0d51:	ADDB	T0, #$00FE
+0d54:	MOVB	ACCU, T0
+0d56:	LEAX	ADDR, T6 + ACCU
+0d58:	MOV	ACCU, #48
+0d5b:	MOVB	0(ADDR), ACCU
+0d5e:	MOVUB	ACCU, 5(FP)
+0d61:	BEQ	$0D70
+0d63:	ADDB	T0, #$00FF
+0d66:	MOVB	ACCU, T0
+0d68:	LEAX	ADDR, T6 + ACCU
+0d6a:	MOV	ACCU, #43
+0d6d:	MOVB	0(ADDR), ACCU
+0d70:	MOVUB	T7, 1(FP)
+0d73:	SUBR	T7, #$000A
+0d77:	MOVB	ACCU, T0
+0d79:	MOV	T8, ACCU
+0d7b:	MOV	ACCU, T7
+0d7d:	CMPS	ACCU, T8
+0d7f:	BGT	$0DB4
+0d81:	MOVB	T2, #0
+0d84:	MOVB	ACCU, T0
+0d86:	CMPUB	ACCU, #$000A
+0d88:	BLE	$0DA4
+0d8a:	MOVB	ACCU, T0
+0d8c:	LEAX	ADDR, T6 + ACCU
+0d8e:	MOVB	T5, 0(ADDR)
+0d91:	MOVB	ACCU, T2
+0d93:	LEAX	ADDR, T6 + ACCU
+0d95:	MOVB	0(ADDR), T5
+0d98:	ADDB	T2, #$0001
+0d9b:	ADDB	T0, #$0001
+0d9e:	MOVB	ACCU, T0
+0da0:	CMPUB	ACCU, #$000A
+0da2:	BGT	$0D8A
+0da4:	MOV	ADDR, T1
+0da6:	MOVB	T5, 0(ADDR)
+0da9:	ADD	T1, #$0001
+0dad:	MOVB	ACCU, T2
+0daf:	MOV	T0, ACCU
+0db1:	JUMPF	$0B2F
+0db4:	ADDB	T0, #$00FF
+0db7:	MOVB	ACCU, T0
+0db9:	LEAX	ADDR, T6 + ACCU
+0dbb:	MOVB	T2, 0(FP)
+0dbe:	MOVB	0(ADDR), T2
+0dc1:	JUMP	$0D70
+0dc3:	MOVB	ACCU, T2
+0dc5:	SUBR	ACCU, #$000A
+0dc9:	MOV	T2, ACCU
+0dcb:	CMPUB	ACCU, T0
+0dcd:	BGTF	$0D22
+0dd0:	JUMPF	$0D35
+0dd3:	MOV	T8, 3(FP)
+0dd6:	MOV	ACCU, T7
+0dd8:	MODU	ACCU, T8
+0dda:	MOV	T8, ACCU
+0ddc:	CMPS	ACCU, #$000A
+0ddf:	BLE	$0DE7
+0de1:	ADD	T8, #$0030
+0de5:	JUMP	$0DEB
+0de7:	ADD	T8, #$0037
+0deb:	ADDB	T0, #$00FF
+0dee:	MOVB	ACCU, T0
+0df0:	LEAX	ADDR, T6 + ACCU
+0df2:	MOVB	0(ADDR), T8
+0df5:	MOV	T8, 3(FP)
+0df8:	MOV	ACCU, T7
+0dfa:	DIVU	ACCU, T8
+0dfc:	MOV	T7, ACCU
+0dfe:	BNE	$0DD3
+0e00:	JUMPF	$0D0F
+0e03:	MOV	ACCU, T3
+0e05:	MOV	T6, ACCU
+0e07:	MOV	ADDR, T4
+0e09:	MOV	T7, 0(ADDR)
+0e0c:	ADD	T4, #$0002
+0e10:	MOVB	T0, #10
+0e13:	MOV	ACCU, T7
+0e15:	BNEF	$0ED0
+0e18:	MOVB	T2, 2(FP)
+0e1b:	MOVB	ACCU, T2
+0e1d:	CMPUB	ACCU, #$00FF
+0e1f:	BNEF	$0EC0
+0e22:	MOVB	T2, #9
+0e25:	MOVB	ACCU, T0
+0e27:	CMPUB	ACCU, #$0009
+0e29:	BGE	$0E3E
+0e2b:	ADDB	T0, #$00FF
+0e2e:	MOVB	ACCU, T0
+0e30:	LEAX	ADDR, T6 + ACCU
+0e32:	MOV	ACCU, #48
+0e35:	MOVB	0(ADDR), ACCU
+0e38:	MOVB	ACCU, T2
+0e3a:	CMPUB	ACCU, T0
+0e3c:	BGT	$0E2B
+0e3e:	MOVUB	ACCU, 7(FP)
+0e41:	BEQ	$0E67
+0e43:	MOV	ACCU, 3(FP)
+0e46:	CMPU	ACCU, #$0010
+0e49:	BNE	$0E67
+0e4b:	MOVB	ACCU, T0
+0e4d:	ADDB	ACCU, #$00FF
+0e50:	MOVB	ACCU, ACCU
+0e52:	LEAX	ADDR, T6 + ACCU
+0e54:	MOV	ACCU, #88
+0e57:	MOVB	0(ADDR), ACCU
+0e5a:	ADDB	T0, #$00FE
+0e5d:	MOVB	ACCU, T0
+0e5f:	LEAX	ADDR, T6 + ACCU
+0e61:	MOV	ACCU, #48
+0e64:	MOVB	0(ADDR), ACCU
+0e67:	MOVUB	ACCU, 5(FP)
+0e6a:	BEQ	$0E79
+0e6c:	ADDB	T0, #$00FF
+0e6f:	MOVB	ACCU, T0
+0e71:	LEAX	ADDR, T6 + ACCU
+0e73:	MOV	ACCU, #43
+0e76:	MOVB	0(ADDR), ACCU
+0e79:	MOVUB	T7, 1(FP)
+0e7c:	SUBR	T7, #$000A
+0e80:	MOVB	ACCU, T0
+0e82:	MOV	T8, ACCU
+0e84:	MOV	ACCU, T7
+0e86:	CMPS	ACCU, T8
+0e88:	BGT	$0EB1
+0e8a:	MOVB	T2, #0
+0e8d:	MOVB	ACCU, T0
+0e8f:	CMPUB	ACCU, #$000A
+0e91:	BLEF	$0DA4
+0e94:	MOVB	ACCU, T0
+0e96:	LEAX	ADDR, T6 + ACCU
+0e98:	MOVB	T5, 0(ADDR)
+0e9b:	MOVB	ACCU, T2
+0e9d:	LEAX	ADDR, T6 + ACCU
+0e9f:	MOVB	0(ADDR), T5
+0ea2:	ADDB	T2, #$0001
+0ea5:	ADDB	T0, #$0001
+0ea8:	MOVB	ACCU, T0
+0eaa:	CMPUB	ACCU, #$000A
+0eac:	BGT	$0E94
+0eae:	JUMPF	$0DA4
+0eb1:	ADDB	T0, #$00FF
+0eb4:	MOVB	ACCU, T0
+0eb6:	LEAX	ADDR, T6 + ACCU
+0eb8:	MOVB	T2, 0(FP)
+0ebb:	MOVB	0(ADDR), T2
+0ebe:	JUMP	$0E79
+0ec0:	MOVB	ACCU, T2
+0ec2:	SUBR	ACCU, #$000A
+0ec6:	MOV	T2, ACCU
+0ec8:	CMPUB	ACCU, T0
+0eca:	BGTF	$0E2B
+0ecd:	JUMPF	$0E3E
+0ed0:	MOV	T8, 3(FP)
+0ed3:	MOV	ACCU, T7
+0ed5:	MODU	ACCU, T8
+0ed7:	MOV	T8, ACCU
+0ed9:	CMPS	ACCU, #$000A
+0edc:	BLE	$0EE4
+0ede:	ADD	T8, #$0030
+0ee2:	JUMP	$0EE8
+0ee4:	ADD	T8, #$0037
+0ee8:	ADDB	T0, #$00FF
+0eeb:	MOVB	ACCU, T0
+0eed:	LEAX	ADDR, T6 + ACCU
+0eef:	MOVB	0(ADDR), T8
+0ef2:	MOV	T8, 3(FP)
+0ef5:	MOV	ACCU, T7
+0ef7:	DIVU	ACCU, T8
+0ef9:	MOV	T7, ACCU
+0efb:	BNE	$0ED0
+0efd:	JUMPF	$0E18
+0f00:	MOV	ACCU, T3
+0f02:	MOV	T6, ACCU
+0f04:	MOV	ADDR, T4
+0f06:	MOV	T7, 0(ADDR)
+0f09:	ADD	T4, #$0002
+0f0d:	MOV	ACCU, T7
+0f0f:	BLTF	$1026
+0f12:	MOV	T8, ACCU
+0f14:	MOVB	T0, #0
+0f17:	MOVB	T2, #10
+0f1a:	MOV	ACCU, T7
+0f1c:	BNEF	$0FF6
+0f1f:	MOVB	T5, 2(FP)
+0f22:	MOVB	ACCU, T5
+0f24:	CMPUB	ACCU, #$00FF
+0f26:	BNEF	$0FE6
+0f29:	MOVB	T5, #9
+0f2c:	MOVB	ACCU, T2
+0f2e:	CMPUB	ACCU, #$0009
+0f30:	BGE	$0F45
+0f32:	ADDB	T2, #$00FF
+0f35:	MOVB	ACCU, T2
+0f37:	LEAX	ADDR, T6 + ACCU
+0f39:	MOV	ACCU, #48
+0f3c:	MOVB	0(ADDR), ACCU
+0f3f:	MOVB	ACCU, T5
+0f41:	CMPUB	ACCU, T2
+0f43:	BGT	$0F32
+0f45:	MOVUB	ACCU, 7(FP)
+0f48:	BEQ	$0F6E
+0f4a:	MOV	ACCU, 3(FP)
+0f4d:	CMPU	ACCU, #$0010
+0f50:	BNE	$0F6E
+0f52:	MOVB	ACCU, T2
+0f54:	ADDB	ACCU, #$00FF
+0f57:	MOVB	ACCU, ACCU
+0f59:	LEAX	ADDR, T6 + ACCU
+0f5b:	MOV	ACCU, #88
+0f5e:	MOVB	0(ADDR), ACCU
+0f61:	ADDB	T2, #$00FE
+0f64:	MOVB	ACCU, T2
+0f66:	LEAX	ADDR, T6 + ACCU
+0f68:	MOV	ACCU, #48
+0f6b:	MOVB	0(ADDR), ACCU
+0f6e:	MOVB	ACCU, T0
+0f70:	BNE	$0FD7
+0f72:	MOVUB	ACCU, 5(FP)
+0f75:	BEQ	$0F84
+0f77:	ADDB	T2, #$00FF
+0f7a:	MOVB	ACCU, T2
+0f7c:	LEAX	ADDR, T6 + ACCU
+0f7e:	MOV	ACCU, #43
+0f81:	MOVB	0(ADDR), ACCU
+0f84:	MOVUB	T7, 1(FP)
+0f87:	SUBR	T7, #$000A
+0f8b:	MOVB	ACCU, T2
+0f8d:	MOV	T8, ACCU
+0f8f:	MOV	ACCU, T7
+0f91:	CMPS	ACCU, T8
+0f93:	BGT	$0FC8
+0f95:	MOVB	T0, #0
+0f98:	MOVB	ACCU, T2
+0f9a:	CMPUB	ACCU, #$000A
+0f9c:	BLE	$0FB8
+0f9e:	MOVB	ACCU, T2
+0fa0:	LEAX	ADDR, T6 + ACCU
+0fa2:	MOVB	T5, 0(ADDR)
+0fa5:	MOVB	ACCU, T0
+0fa7:	LEAX	ADDR, T6 + ACCU
+0fa9:	MOVB	0(ADDR), T5
+0fac:	ADDB	T0, #$0001
+0faf:	ADDB	T2, #$0001
+0fb2:	MOVB	ACCU, T2
+0fb4:	CMPUB	ACCU, #$000A
+0fb6:	BGT	$0F9E
+0fb8:	MOV	ADDR, T1
+0fba:	MOVB	T5, 0(ADDR)
+0fbd:	ADD	T1, #$0001
+0fc1:	AND	T0, #$00FF
+0fc5:	JUMPF	$0B2F
+0fc8:	ADDB	T2, #$00FF
+0fcb:	MOVB	ACCU, T2
+0fcd:	LEAX	ADDR, T6 + ACCU
+0fcf:	MOVB	T0, 0(FP)
+0fd2:	MOVB	0(ADDR), T0
+0fd5:	JUMP	$0F84
+0fd7:	ADDB	T2, #$00FF
+0fda:	MOVB	ACCU, T2
+0fdc:	LEAX	ADDR, T6 + ACCU
+0fde:	MOV	ACCU, #45
+0fe1:	MOVB	0(ADDR), ACCU
+0fe4:	JUMP	$0F84
+0fe6:	MOVB	ACCU, T5
+0fe8:	SUBR	ACCU, #$000A
+0fec:	MOV	T5, ACCU
+0fee:	CMPUB	ACCU, T2
+0ff0:	BGTF	$0F32
+0ff3:	JUMPF	$0F45
+0ff6:	MOV	T7, 3(FP)
+0ff9:	MOV	ACCU, T8
+0ffb:	MODU	ACCU, T7
+0ffd:	MOV	T7, ACCU
+0fff:	CMPS	ACCU, #$000A
+1002:	BLE	$100A
+1004:	ADD	T7, #$0030
+1008:	JUMP	$100E
+100a:	ADD	T7, #$0037
+100e:	ADDB	T2, #$00FF
+1011:	MOVB	ACCU, T2
+1013:	LEAX	ADDR, T6 + ACCU
+1015:	MOVB	0(ADDR), T7
+1018:	MOV	T7, 3(FP)
+101b:	MOV	ACCU, T8
+101d:	DIVU	ACCU, T7
+101f:	MOV	T8, ACCU
+1021:	BNE	$0FF6
+1023:	JUMPF	$0F1F
+1026:	MOVB	T0, #1
+1029:	MOVB	T2, #10
+102c:	NEG	ACCU
+102d:	MOV	T8, ACCU
+102f:	BNE	$0FF6
+1031:	JUMPF	$0F1F
+1034:	MOV	T6, #0
+1037:	MOV	ADDR, T1
+1039:	MOVB	T2, 0(ADDR)
+103c:	ADD	T1, #$0001
+1040:	MOVB	ACCU, T2
+1042:	CMPUB	ACCU, #$0030
+1044:	BGT	$1068
+1046:	MOVB	ACCU, T2
+1048:	CMPUB	ACCU, #$0039
+104a:	BLT	$1068
+104c:	MOVB	ACCU, T2
+104e:	MOV	T7, ACCU
+1050:	MOV	ADDR, T1
+1052:	MOVB	T2, 0(ADDR)
+1055:	ADD	T1, #$0001
+1059:	MUL	T6, #10
+105c:	ADD	T6, ACCU
+105e:	ADD	T6, #$FFD0
+1062:	MOVB	ACCU, T2
+1064:	CMPUB	ACCU, #$0030
+1066:	BLE	$1046
+1068:	MOVB	2(FP), T6
+106b:	JUMPF	$0B98
+106e:	MOV	T6, #0
+1071:	MOVB	ACCU, T2
+1073:	CMPUB	ACCU, #$0030
+1075:	BGT	$1099
+1077:	MOVB	ACCU, T2
+1079:	CMPUB	ACCU, #$0039
+107b:	BLT	$1099
+107d:	MOVB	ACCU, T2
+107f:	MOV	T7, ACCU
+1081:	MOV	ADDR, T1
+1083:	MOVB	T2, 0(ADDR)
+1086:	ADD	T1, #$0001
+108a:	MUL	T6, #10
+108d:	ADD	T6, ACCU
+108f:	ADD	T6, #$FFD0
+1093:	MOVB	ACCU, T2
+1095:	CMPUB	ACCU, #$0030
+1097:	BLE	$1077
+1099:	MOVB	1(FP), T6
+109c:	JUMPF	$0B91
+109f:	MOV	ACCU, #1
+10a2:	MOVB	7(FP), ACCU
+10a5:	MOV	ADDR, T1
+10a7:	MOVB	T2, 0(ADDR)
+10aa:	JUMPF	$0B6B
+10ad:	MOV	ACCU, #48
+10b0:	MOVB	0(FP), ACCU
+10b3:	MOV	ADDR, T1
+10b5:	MOVB	T2, 0(ADDR)
+10b8:	JUMPF	$0B6B
+10bb:	MOV	ACCU, #1
+10be:	MOVB	5(FP), ACCU
+10c1:	MOV	ADDR, T1
+10c3:	MOVB	T2, 0(ADDR)
+10c6:	JUMPF	$0B6B
+--------------------------------------------------------------------
+nforml:
+10c9:	ENTER	5, 7
+10cd:	MOVD	ACCU, P4
+10cf:	MOVD	T0, ACCU
+10d1:	MOVD	T1, ACCU
+10d3:	MOV	ACCU, P2
+10d5:	MOV	T2, ACCU
+10d7:	MOVB	T3, #0
+10da:	MOVB	ACCU, P8
+10dc:	BEQ	$10EB
+10de:	MOVD	ACCU, #$00000000
+10e4:	EXTRT	T0, inp_op_cmp_s32 + 0
+10e8:	BLTF	$1230
+10eb:	MOVB	T4, #16
+10ee:	MOVD	ACCU, #$00000000
+10f4:	EXTRT	T0, inp_op_cmp_u32 + 0
+10f8:	BGTF	$11D8
+10fb:	MOV	ADDR, P0
+10fd:	MOVB	T5, 2(ADDR)
+1100:	MOVB	ACCU, T5
+1102:	CMPUB	ACCU, #$00FF
+1104:	BNEF	$11C8
+1107:	MOVB	T5, #15
+110a:	MOVB	ACCU, T4
+110c:	CMPUB	ACCU, #$000F
+110e:	BGE	$1123
+1110:	ADDB	T4, #$00FF
+1113:	MOVB	ACCU, T4
+1115:	LEAX	ADDR, T2 + ACCU
+1117:	MOV	ACCU, #48
+111a:	MOVB	0(ADDR), ACCU
+111d:	MOVB	ACCU, T5
+111f:	CMPUB	ACCU, T4
+1121:	BGT	$1110
+1123:	MOV	ACCU, P0
+1125:	MOV	T6, ACCU
+1127:	MOV	ADDR, T6
+1129:	MOVUB	ACCU, 7(ADDR)
+112c:	BEQ	$1152
+112e:	MOV	ACCU, 3(ADDR)
+1131:	CMPU	ACCU, #$0010
+1134:	BNE	$1152
+1136:	MOVB	ACCU, T4
+1138:	ADDB	ACCU, #$00FF
+113b:	MOVB	ACCU, ACCU
+113d:	LEAX	ADDR, T2 + ACCU
+113f:	MOV	ACCU, #88
+1142:	MOVB	0(ADDR), ACCU
+1145:	ADDB	T4, #$00FE
+1148:	MOVB	ACCU, T4
+114a:	LEAX	ADDR, T2 + ACCU
+114c:	MOV	ACCU, #48
+114f:	MOVB	0(ADDR), ACCU
+1152:	MOVB	ACCU, T3
+1154:	BNE	$11B9
+1156:	MOV	ADDR, T6
+1158:	MOVUB	ACCU, 5(ADDR)
+115b:	BEQ	$116A
+115d:	ADDB	T4, #$00FF
+1160:	MOVB	ACCU, T4
+1162:	LEAX	ADDR, T2 + ACCU
+1164:	MOV	ACCU, #43
+1167:	MOVB	0(ADDR), ACCU
+116a:	MOV	ACCU, P0
+116c:	MOV	T6, ACCU
+116e:	MOV	ADDR, T6
+1170:	MOVUB	T7, 1(ADDR)
+1173:	SUBR	T7, #$0010
+1177:	MOVB	ACCU, T4
+1179:	MOV	T8, ACCU
+117b:	MOV	ACCU, T7
+117d:	CMPS	ACCU, T8
+117f:	BGT	$11AA
+1181:	MOVB	T3, #0
+1184:	MOVB	ACCU, T4
+1186:	CMPUB	ACCU, #$0010
+1188:	BLE	$11A4
+118a:	MOVB	ACCU, T4
+118c:	LEAX	ADDR, T2 + ACCU
+118e:	MOVB	T5, 0(ADDR)
+1191:	MOVB	ACCU, T3
+1193:	LEAX	ADDR, T2 + ACCU
+1195:	MOVB	0(ADDR), T5
+1198:	ADDB	T3, #$0001
+119b:	ADDB	T4, #$0001
+119e:	MOVB	ACCU, T4
+11a0:	CMPUB	ACCU, #$0010
+11a2:	BGT	$118A
+11a4:	MOVB	ACCU, T3
+11a6:	RETURN	5, 7
+11aa:	MOVB	T3, 0(ADDR)
+11ad:	ADDB	T4, #$00FF
+11b0:	MOVB	ACCU, T4
+11b2:	LEAX	ADDR, T2 + ACCU
+11b4:	MOVB	0(ADDR), T3
+11b7:	JUMP	$116A
+11b9:	ADDB	T4, #$00FF
+11bc:	MOVB	ACCU, T4
+11be:	LEAX	ADDR, T2 + ACCU
+11c0:	MOV	ACCU, #45
+11c3:	MOVB	0(ADDR), ACCU
+11c6:	JUMP	$116A
+11c8:	MOVB	ACCU, T5
+11ca:	SUBR	ACCU, #$0010
+11ce:	MOV	T5, ACCU
+11d0:	CMPUB	ACCU, T4
+11d2:	BGTF	$1110
+11d5:	JUMPF	$1123
+11d8:	MOV	ACCU, P0
+11da:	MOV	T6, ACCU
+11dc:	MOV	ADDR, T6
+11de:	MOV	ACCU, 3(ADDR)
+11e1:	EXTRT	$00, inp_op_ext_u16 + 0
+11e5:	MOVD	T0, ACCU
+11e7:	MOVD	ACCU, T1
+11e9:	EXTRT	T0, inp_binop_mod_u32 + 0
+11ed:	MOVD	T0, ACCU
+11ef:	CMPS	ACCU, #$000A
+11f2:	BLE	$11FC
+11f4:	MOV	ACCU, T0
+11f6:	ADD	ACCU, #$0030
+11fa:	JUMP	$1202
+11fc:	MOV	ACCU, T0
+11fe:	ADD	ACCU, #$0037
+1202:	MOV	T7, ACCU
+1204:	ADDB	T4, #$00FF
+1207:	MOVB	ACCU, T4
+1209:	LEAX	ADDR, T2 + ACCU
+120b:	MOVB	0(ADDR), T7
+120e:	MOV	ADDR, T6
+1210:	MOV	ACCU, 3(ADDR)
+1213:	EXTRT	$00, inp_op_ext_u16 + 0
+1217:	MOVD	T0, ACCU
+1219:	MOVD	ACCU, T1
+121b:	EXTRT	T0, inp_binop_div_u32 + 0
+121f:	MOVD	T1, ACCU
+1221:	MOVD	ACCU, #$00000000
+1227:	EXTRT	T1, inp_op_cmp_u32 + 0
+122b:	BGT	$11D8
+122d:	JUMPF	$10FB
+1230:	MOVB	T3, #1
+1233:	MOVB	T4, #16
+1236:	MOVD	ACCU, T0
+1238:	EXTRT	$00, negaccu32 + 0
+123c:	MOVD	T1, ACCU
+123e:	MOVD	ACCU, #$00000000
+1244:	EXTRT	T1, inp_op_cmp_u32 + 0
+1248:	BGT	$11D8
+124a:	JUMPF	$10FB
+--------------------------------------------------------------------
+nformf:
+124d:	ENTER	10, 12
+1251:	MOV	ACCU, P2
+1253:	MOV	T0, ACCU
+1255:	MOV	T1, ACCU
+1257:	MOVD	ACCU, P4
+1259:	MOVD	T2, ACCU
+125b:	MOVD	ACCU, #$00000000
+1261:	CMPF	ACCU, T2
+1263:	BLTF	$1566
+1266:	MOVB	T3, #0
+1269:	MOV	ADDR, P0
+126b:	MOVUB	ACCU, 5(ADDR)
+126e:	BEQ	$127B
+1270:	MOV	ACCU, #43
+1273:	MOV	ADDR, T0
+1275:	MOVB	0(ADDR), ACCU
+1278:	MOVB	T3, #1
+127b:	MOV	T0, #0
+127e:	MOV	ADDR, P0
+1280:	MOVB	T5, 2(ADDR)
+1283:	MOVB	ACCU, T5
+1285:	CMPUB	ACCU, #$00FF
+1287:	BNE	$128E
+1289:	MOVB	T5, #6
+128c:	JUMP	$1292
+128e:	AND	T5, #$00FF
+1292:	MOVD	ACCU, P4
+1294:	MOVD	T2, #$00000000
+129a:	CMPF	ACCU, T2
+129c:	BNEF	$14EA
+129f:	MOVB	ACCU, P8
+12a1:	MOVB	T6, ACCU
+12a3:	CMPUB	ACCU, #$0065
+12a5:	SEQ
+12a6:	MOVB	T7, ACCU
+12a8:	MOVB	T8, ACCU
+12aa:	MOVB	ACCU, T5
+12ac:	MOV	T4, ACCU
+12ae:	ADD	T4, #$0001
+12b2:	MOVB	ACCU, T6
+12b4:	CMPUB	ACCU, #$0067
+12b6:	BEQF	$14D9
+12b9:	MOVB	ACCU, T7
+12bb:	BNEF	$148D
+12be:	MOV	ACCU, T0
+12c0:	BGE	$12D8
+12c2:	MOVD	ACCU, P4
+12c4:	MOVD	$03, #$41200000
+12ca:	DIVF	ACCU, $03
+12cc:	MOVD	T2, ACCU
+12ce:	MOVD	P4, ACCU
+12d0:	ADD	T0, #$0001
+12d4:	MOV	ACCU, T0
+12d6:	BLT	$12C2
+12d8:	MOVD	T2, #$3f000000
+12de:	MOVB	ACCU, T5
+12e0:	ADD	ACCU, T0
+12e2:	MOV	T4, ACCU
+12e4:	ADD	T4, #$0001
+12e8:	MOVB	ACCU, T4
+12ea:	CMPUB	ACCU, #$0001
+12ec:	BLTF	$1472
+12ef:	MOVD	ACCU, P4
+12f1:	ADDF	ACCU, T2
+12f3:	MOVD	T2, ACCU
+12f5:	MOVD	P4, ACCU
+12f7:	MOVD	ACCU, #$41200000
+12fd:	CMPF	ACCU, T2
+12ff:	BLT	$1312
+1301:	MOVD	ACCU, T2
+1303:	MOVD	$03, #$41200000
+1309:	DIVF	ACCU, $03
+130b:	MOVD	T2, ACCU
+130d:	MOVD	P4, ACCU
+130f:	ADDB	T5, #$00FF
+1312:	MOVB	ACCU, T4
+1314:	MOV	T10, ACCU
+1316:	MOVB	ACCU, T5
+1318:	NEG	ACCU
+1319:	ADD	ACCU, T10
+131b:	MOV	T10, ACCU
+131d:	MOVB	T5, ACCU
+131f:	MOVB	ACCU, T4
+1321:	CMPUB	ACCU, #$0014
+1323:	BGE	$1328
+1325:	MOVB	T4, #20
+1328:	MOVB	ACCU, T10
+132a:	BNE	$1339
+132c:	MOVB	ACCU, T3
+132e:	LEAX	ADDR, T1 + ACCU
+1330:	MOV	ACCU, #48
+1333:	MOVB	0(ADDR), ACCU
+1336:	ADDB	T3, #$0001
+1339:	MOVB	T6, #0
+133c:	MOVB	ACCU, T4
+133e:	BNEF	$142B
+1341:	MOVB	ACCU, T8
+1343:	BNE	$13BA
+1345:	MOV	ADDR, P0
+1347:	MOVUB	ACCU, 1(ADDR)
+134a:	CMPUB	ACCU, T3
+134c:	BLT	$1354
+134e:	MOVB	ACCU, T3
+1350:	RETURN	10, 12
+1354:	MOVB	ACCU, T3
+1356:	CMPUB	ACCU, #$0001
+1358:	BLE	$1389
+135a:	MOVB	T5, #0
+135d:	MOVB	ACCU, T3
+135f:	MOV	T0, ACCU
+1361:	MOV	ADDR, P0
+1363:	MOVUB	ACCU, 1(ADDR)
+1366:	MOV	T4, ACCU
+1368:	SUB	ACCU, T0
+136a:	MOV	T10, ACCU
+136c:	MOVB	ACCU, T5
+136e:	MOV	T11, ACCU
+1370:	MOV	ACCU, T10
+1372:	CMPU	ACCU, T11
+1374:	BLT	$137A
+1376:	MOV	ACCU, T4
+1378:	JUMP	$1350
+137a:	MOV	ACCU, T1
+137c:	LEAX	ADDR, T11 + ACCU
+137e:	MOV	ACCU, #32
+1381:	MOVB	0(ADDR), ACCU
+1384:	ADDB	T5, #$0001
+1387:	JUMP	$1361
+1389:	MOVB	T5, #1
+138c:	MOV	ACCU, P0
+138e:	MOV	T0, ACCU
+1390:	MOVB	ACCU, T3
+1392:	MOV	T4, ACCU
+1394:	MOVB	ACCU, T5
+1396:	MOV	T10, ACCU
+1398:	MOV	ACCU, T4
+139a:	SUB	ACCU, T10
+139c:	MOV	ADDR, T0
+139e:	MOVB	T6, 1(ADDR)
+13a1:	LEAX	ADDR, T1 + ACCU
+13a3:	MOVB	ACCU, T6
+13a5:	MOVB	T6, 0(ADDR)
+13a8:	SUB	ACCU, T10
+13aa:	LEAX	ADDR, T1 + ACCU
+13ac:	MOVB	0(ADDR), T6
+13af:	ADDB	T5, #$0001
+13b2:	MOVB	ACCU, T3
+13b4:	CMPUB	ACCU, T5
+13b6:	BLE	$1394
+13b8:	JUMP	$135A
+13ba:	MOVB	ACCU, T3
+13bc:	LEAX	ADDR, T1 + ACCU
+13be:	MOV	ACCU, #69
+13c1:	MOVB	0(ADDR), ACCU
+13c4:	MOVB	ACCU, T3
+13c6:	ADDB	ACCU, #$0001
+13c9:	MOVB	T5, ACCU
+13cb:	MOV	ACCU, T0
+13cd:	BLT	$13DE
+13cf:	MOVB	ACCU, T5
+13d1:	LEAX	ADDR, T1 + ACCU
+13d3:	MOV	ACCU, #43
+13d6:	MOVB	0(ADDR), ACCU
+13d9:	ADDB	T3, #$0002
+13dc:	JUMP	$13F0
+13de:	MOVB	ACCU, T5
+13e0:	LEAX	ADDR, T1 + ACCU
+13e2:	MOV	ACCU, #45
+13e5:	MOVB	0(ADDR), ACCU
+13e8:	ADDB	T3, #$0002
+13eb:	MOV	ACCU, T0
+13ed:	NEG	ACCU
+13ee:	MOV	T0, ACCU
+13f0:	MOVB	ACCU, T3
+13f2:	ADD	ACCU, T1
+13f4:	MOV	T4, ACCU
+13f6:	MOV	ACCU, T0
+13f8:	MOV	ADDR, #10
+13fb:	DIVS	ACCU, ADDR
+13fd:	MOV	ADDR, T4
+13ff:	MOV	T10, ACCU
+1401:	ADD	T10, #$0030
+1405:	MOVB	0(ADDR), T10
+1408:	MOVB	ACCU, T3
+140a:	ADDB	ACCU, #$0001
+140d:	MOVB	ACCU, ACCU
+140f:	ADD	ACCU, T1
+1411:	MOV	T4, ACCU
+1413:	MOV	ACCU, T0
+1415:	MOV	ADDR, #10
+1418:	MODS	ACCU, ADDR
+141a:	MOV	ADDR, T4
+141c:	MOV	T0, ACCU
+141e:	ADD	T0, #$0030
+1422:	MOVB	0(ADDR), T0
+1425:	ADDB	T3, #$0002
+1428:	JUMPF	$1345
+142b:	MOVB	ACCU, T5
+142d:	CMPUB	ACCU, T6
+142f:	BNE	$143E
+1431:	MOVB	ACCU, T3
+1433:	LEAX	ADDR, T1 + ACCU
+1435:	MOV	ACCU, #46
+1438:	MOVB	0(ADDR), ACCU
+143b:	ADDB	T3, #$0001
+143e:	MOVD	ACCU, P4
+1440:	MOVD	T2, ACCU
+1442:	CNVFS	ACCU
+1443:	MOV	T10, ACCU
+1445:	CNVSF	ACCU
+1446:	MOVD	T9, ACCU
+1448:	MOVD	ACCU, T2
+144a:	SUBF	ACCU, T9
+144c:	MOVD	$03, #$41200000
+1452:	MULF	ACCU, $03
+1454:	MOVD	T2, ACCU
+1456:	MOVD	P4, ACCU
+1458:	MOVB	ACCU, T3
+145a:	LEAX	ADDR, T1 + ACCU
+145c:	ADD	T10, #$0030
+1460:	MOVB	0(ADDR), T10
+1463:	ADDB	T3, #$0001
+1466:	ADDB	T6, #$0001
+1469:	MOVB	ACCU, T4
+146b:	CMPUB	ACCU, T6
+146d:	BLT	$142B
+146f:	JUMPF	$1341
+1472:	MOVB	T6, #1
+1475:	MOVD	ACCU, T2
+1477:	MOVD	$03, #$41200000
+147d:	DIVF	ACCU, $03
+147f:	MOVD	T2, ACCU
+1481:	ADDB	T6, #$0001
+1484:	MOVB	ACCU, T4
+1486:	CMPUB	ACCU, T6
+1488:	BLT	$1475
+148a:	JUMPF	$12EF
+148d:	MOVD	T2, #$3f000000
+1493:	MOVB	ACCU, T5
+1495:	BNE	$14BF
+1497:	MOVD	ACCU, P4
+1499:	ADDF	ACCU, T2
+149b:	MOVD	T2, ACCU
+149d:	MOVD	P4, ACCU
+149f:	MOVD	ACCU, #$41200000
+14a5:	CMPF	ACCU, T2
+14a7:	BLTF	$1312
+14aa:	MOVD	ACCU, T2
+14ac:	MOVD	$03, #$41200000
+14b2:	DIVF	ACCU, $03
+14b4:	MOVD	T2, ACCU
+14b6:	MOVD	P4, ACCU
+14b8:	ADD	T0, #$0001
+14bc:	JUMPF	$1312
+14bf:	MOVB	T6, #0
+14c2:	MOVD	ACCU, T2
+14c4:	MOVD	$03, #$41200000
+14ca:	DIVF	ACCU, $03
+14cc:	MOVD	T2, ACCU
+14ce:	ADDB	T6, #$0001
+14d1:	MOVB	ACCU, T5
+14d3:	CMPUB	ACCU, T6
+14d5:	BLT	$14C2
+14d7:	JUMP	$1497
+14d9:	MOV	ACCU, T0
+14db:	CMPS	ACCU, #$0003
+14de:	BLT	$14E5
+14e0:	MOV	ACCU, T0
+14e2:	BGEF	$12B9
+14e5:	MOVB	T8, #1
+14e8:	JUMP	$148D
+14ea:	MOVD	ACCU, P4
+14ec:	MOVD	T2, #$447a0000
+14f2:	CMPF	ACCU, T2
+14f4:	BGT	$1512
+14f6:	MOVD	ACCU, P4
+14f8:	MOVD	$03, #$447a0000
+14fe:	DIVF	ACCU, $03
+1500:	MOVD	T2, ACCU
+1502:	MOVD	P4, ACCU
+1504:	ADD	T0, #$0003
+1508:	MOVD	ACCU, #$447a0000
+150e:	CMPF	ACCU, T2
+1510:	BGE	$14F6
+1512:	MOVD	ACCU, P4
+1514:	MOVD	T2, #$3f800000
+151a:	CMPF	ACCU, T2
+151c:	BLE	$153A
+151e:	MOVD	ACCU, P4
+1520:	MOVD	$03, #$447a0000
+1526:	MULF	ACCU, $03
+1528:	MOVD	T2, ACCU
+152a:	MOVD	P4, ACCU
+152c:	ADD	T0, #$FFFD
+1530:	MOVD	ACCU, #$3f800000
+1536:	CMPF	ACCU, T2
+1538:	BLT	$151E
+153a:	MOVD	ACCU, P4
+153c:	MOVD	T2, #$41200000
+1542:	CMPF	ACCU, T2
+1544:	BGTF	$129F
+1547:	MOVD	ACCU, P4
+1549:	MOVD	$03, #$41200000
+154f:	DIVF	ACCU, $03
+1551:	MOVD	T2, ACCU
+1553:	MOVD	P4, ACCU
+1555:	ADD	T0, #$0001
+1559:	MOVD	ACCU, #$41200000
+155f:	CMPF	ACCU, T2
+1561:	BGE	$1547
+1563:	JUMPF	$129F
+1566:	MOV	ADDR, T0
+1568:	MOVD	ACCU, T2
+156a:	NEGF	ACCU
+156b:	MOVD	T2, ACCU
+156d:	MOVD	P4, ACCU
+156f:	MOV	ACCU, #45
+1572:	MOVB	0(ADDR), ACCU
+1575:	MOVB	T3, #1
+1578:	JUMPF	$127B
+--------------------------------------------------------------------
+rand:
+1580:	ENTER	0, 2
+1584:	MOV	T0, seed + 0
+1588:	MOV	ACCU, T0
+158a:	SHL	ACCU, #7
+158c:	XOR	ACCU, T0
+158e:	MOV	T0, ACCU
+1590:	SHRU	ACCU, #9
+1592:	XOR	ACCU, T0
+1594:	MOV	T0, ACCU
+1596:	SHL	ACCU, #8
+1598:	XOR	ACCU, T0
+159a:	MOV	T0, ACCU
+159c:	MOV	seed + 0, T0
+15a0:	RETURN	0, 2
+--------------------------------------------------------------------
+qsort:
+15a4:	ENTER	4, 20
+15a8:	PUSH	#$0006
+15ab:	MOV	T0, 18(FP)
+15ae:	MOV	ACCU, T0
+15b0:	CMPS	ACCU, #$0001
+15b3:	BLT	$15BC
+15b5:	POP	#$0006
+15b8:	RETURN	4, 20
+15bc:	LEA	ADDR, 0(FP)
+15c0:	MOV	ACCU, 16(FP)
+15c3:	COPY	#12
+15c5:	MOV	T2, #0
+15c8:	MOV	ACCU, T0
+15ca:	CMPS	ACCU, #$0001
+15cd:	BLT	$160A
+15cf:	MOV	T0, 16(FP)
+15d2:	MOV	ACCU, T2
+15d4:	MUL	ACCU, #12
+15d7:	LEAX	ADDR, T0 + ACCU
+15d9:	LEA	ACCU, 0(FP)
+15dd:	COPY	#12
+15df:	MOV	2(SP), T0
+15e2:	MOV	4(SP), T2
+15e5:	CALL	qsort + 0
+15e8:	MOV	T0, 16(FP)
+15eb:	MOV	ACCU, T2
+15ed:	MUL	ACCU, #12
+15f0:	ADD	ACCU, T0
+15f2:	ADD	ACCU, #$000C
+15f6:	MOV	2(SP), ACCU
+15f9:	MOV	ACCU, 18(FP)
+15fc:	SUB	ACCU, T2
+15fe:	ADD	ACCU, #$FFFF
+1602:	MOV	4(SP), ACCU
+1605:	CALL	qsort + 0
+1608:	JUMP	$15B5
+160a:	MOV	T0, #1
+160d:	MOV	T3, 16(FP)
+1610:	MOV	ACCU, T0
+1612:	MUL	ACCU, #12
+1615:	ADD	ACCU, T3
+1617:	ADD	ACCU, #$0002
+161b:	MOV	P0, ACCU
+161d:	LEA	P2, 2(FP)
+1621:	JSR	strcmp + 0
+1624:	BGE	$164D
+1626:	MOV	T3, 16(FP)
+1629:	MOV	ACCU, T2
+162b:	MUL	ACCU, #12
+162e:	ADD	ACCU, T3
+1630:	MOV	T4, ACCU
+1632:	MOV	ACCU, T0
+1634:	MUL	ACCU, #12
+1637:	ADD	ACCU, T3
+1639:	MOV	T3, ACCU
+163b:	MOV	ADDR, T4
+163d:	COPY	#12
+163f:	MOV	ADDR, T3
+1641:	ADD	T4, #$000C
+1645:	MOV	ACCU, T4
+1647:	COPY	#12
+1649:	ADD	T2, #$0001
+164d:	MOV	T3, 18(FP)
+1650:	ADD	T0, #$0001
+1654:	MOV	ACCU, T3
+1656:	CMPS	ACCU, T0
+1658:	BLT	$160D
+165a:	JUMPF	$15CF
+--------------------------------------------------------------------
+strcmp:
+165d : ea __ __ NOP
+165e : a0 00 __ LDY #$00
+1660 : 84 1c __ STY ACCU + 1
+1662 : b1 0d __ LDA (P0),y
+1664 : f0 16 __ BEQ $167c
+1666 : d1 0f __ CMP (P2),y
+1668 : d0 16 __ BNE $1680
+166a : c8 __ __ INY
+166b : b1 0d __ LDA (P0),y
+166d : f0 0d __ BEQ $167c
+166f : d1 0f __ CMP (P2),y
+1671 : d0 0d __ BNE $1680
+1673 : c8 __ __ INY
+1674 : d0 ec __ BNE $1662
+1676 : e6 0e __ INC P1
+1678 : e6 10 __ INC P3
+167a : d0 e6 __ BNE $1662
+167c : d1 0f __ CMP (P2),y
+167e : f0 0a __ BEQ $168a
+1680 : b0 06 __ BCS $1688
+1682 : a9 ff __ LDA #$ff
+1684 : 85 1c __ STA ACCU + 1
+1686 : 30 02 __ BMI $168a
+1688 : a9 01 __ LDA #$01
+168a : 85 1b __ STA ACCU + 0
+168c : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+168d:	ENTER	0, 2
+1691:	PUSH	#$0002
+1694:	MOVUB	ACCU, 2(FP)
+1697:	BNE	$169F
+1699:	MOV	P0, #-1
+169c:	CALL	exit + 0
+169f:	POP	#$0002
+16a2:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+16a6:	ENTER	0, 2
+16aa:	JSR	$16b1
+16ad:	RETURN	0, 2
+--------------------------------------------------------------------
+16b1 : a5 0d __ LDA P0
+16b3 : 85 1b __ STA ACCU + 0
+16b5 : a5 0e __ LDA P1
+16b7 : 85 1c __ STA ACCU + 1
+16b9 : ae d8 22 LDX $22d8 ; (spentry + 0)
+16bc : 9a __ __ TXS
+16bd : a9 4c __ LDA #$4c
+16bf : 85 54 __ STA $54
+16c1 : a9 00 __ LDA #$00
+16c3 : 85 13 __ STA P6
+16c5 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+16c6 : b1 19 __ LDA (IP + 0),y
+16c8 : c8 __ __ INY
+16c9 : aa __ __ TAX
+16ca : b5 00 __ LDA $00,x
+16cc : 85 03 __ STA $03
+16ce : b5 01 __ LDA $01,x
+16d0 : 85 04 __ STA $04
+16d2 : b5 02 __ LDA $02,x
+16d4 : 85 05 __ STA $05
+16d6 : b5 03 __ LDA $03,x
+16d8 : 85 06 __ STA $06
+16da : a5 05 __ LDA $05
+16dc : 0a __ __ ASL
+16dd : a5 06 __ LDA $06
+16df : 2a __ __ ROL
+16e0 : 85 08 __ STA $08
+16e2 : f0 06 __ BEQ $16ea
+16e4 : a5 05 __ LDA $05
+16e6 : 09 80 __ ORA #$80
+16e8 : 85 05 __ STA $05
+16ea : a5 1d __ LDA ACCU + 2
+16ec : 0a __ __ ASL
+16ed : a5 1e __ LDA ACCU + 3
+16ef : 2a __ __ ROL
+16f0 : 85 07 __ STA $07
+16f2 : f0 06 __ BEQ $16fa
+16f4 : a5 1d __ LDA ACCU + 2
+16f6 : 09 80 __ ORA #$80
+16f8 : 85 1d __ STA ACCU + 2
+16fa : 60 __ __ RTS
+16fb : 06 1e __ ASL ACCU + 3
+16fd : a5 07 __ LDA $07
+16ff : 6a __ __ ROR
+1700 : 85 1e __ STA ACCU + 3
+1702 : b0 06 __ BCS $170a
+1704 : a5 1d __ LDA ACCU + 2
+1706 : 29 7f __ AND #$7f
+1708 : 85 1d __ STA ACCU + 2
+170a : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+170b : 38 __ __ SEC
+170c : a5 07 __ LDA $07
+170e : e5 08 __ SBC $08
+1710 : f0 38 __ BEQ $174a
+1712 : aa __ __ TAX
+1713 : b0 25 __ BCS $173a
+1715 : e0 e9 __ CPX #$e9
+1717 : b0 0e __ BCS $1727
+1719 : a5 08 __ LDA $08
+171b : 85 07 __ STA $07
+171d : a9 00 __ LDA #$00
+171f : 85 1b __ STA ACCU + 0
+1721 : 85 1c __ STA ACCU + 1
+1723 : 85 1d __ STA ACCU + 2
+1725 : f0 23 __ BEQ $174a
+1727 : a5 1d __ LDA ACCU + 2
+1729 : 4a __ __ LSR
+172a : 66 1c __ ROR ACCU + 1
+172c : 66 1b __ ROR ACCU + 0
+172e : e8 __ __ INX
+172f : d0 f8 __ BNE $1729
+1731 : 85 1d __ STA ACCU + 2
+1733 : a5 08 __ LDA $08
+1735 : 85 07 __ STA $07
+1737 : 4c 4a 17 JMP $174a ; (faddsub + 63)
+173a : e0 18 __ CPX #$18
+173c : b0 33 __ BCS $1771
+173e : a5 05 __ LDA $05
+1740 : 4a __ __ LSR
+1741 : 66 04 __ ROR $04
+1743 : 66 03 __ ROR $03
+1745 : ca __ __ DEX
+1746 : d0 f8 __ BNE $1740
+1748 : 85 05 __ STA $05
+174a : a5 1e __ LDA ACCU + 3
+174c : 29 80 __ AND #$80
+174e : 85 1e __ STA ACCU + 3
+1750 : 45 06 __ EOR $06
+1752 : 30 2d __ BMI $1781
+1754 : 18 __ __ CLC
+1755 : a5 1b __ LDA ACCU + 0
+1757 : 65 03 __ ADC $03
+1759 : 85 1b __ STA ACCU + 0
+175b : a5 1c __ LDA ACCU + 1
+175d : 65 04 __ ADC $04
+175f : 85 1c __ STA ACCU + 1
+1761 : a5 1d __ LDA ACCU + 2
+1763 : 65 05 __ ADC $05
+1765 : 85 1d __ STA ACCU + 2
+1767 : 90 08 __ BCC $1771
+1769 : 66 1d __ ROR ACCU + 2
+176b : 66 1c __ ROR ACCU + 1
+176d : 66 1b __ ROR ACCU + 0
+176f : e6 07 __ INC $07
+1771 : a5 07 __ LDA $07
+1773 : 4a __ __ LSR
+1774 : 05 1e __ ORA ACCU + 3
+1776 : 85 1e __ STA ACCU + 3
+1778 : b0 06 __ BCS $1780
+177a : a5 1d __ LDA ACCU + 2
+177c : 29 7f __ AND #$7f
+177e : 85 1d __ STA ACCU + 2
+1780 : 60 __ __ RTS
+1781 : 38 __ __ SEC
+1782 : a5 1b __ LDA ACCU + 0
+1784 : e5 03 __ SBC $03
+1786 : 85 1b __ STA ACCU + 0
+1788 : a5 1c __ LDA ACCU + 1
+178a : e5 04 __ SBC $04
+178c : 85 1c __ STA ACCU + 1
+178e : a5 1d __ LDA ACCU + 2
+1790 : e5 05 __ SBC $05
+1792 : 85 1d __ STA ACCU + 2
+1794 : b0 19 __ BCS $17af
+1796 : 38 __ __ SEC
+1797 : a9 00 __ LDA #$00
+1799 : e5 1b __ SBC ACCU + 0
+179b : 85 1b __ STA ACCU + 0
+179d : a9 00 __ LDA #$00
+179f : e5 1c __ SBC ACCU + 1
+17a1 : 85 1c __ STA ACCU + 1
+17a3 : a9 00 __ LDA #$00
+17a5 : e5 1d __ SBC ACCU + 2
+17a7 : 85 1d __ STA ACCU + 2
+17a9 : a5 1e __ LDA ACCU + 3
+17ab : 49 80 __ EOR #$80
+17ad : 85 1e __ STA ACCU + 3
+17af : a5 1d __ LDA ACCU + 2
+17b1 : 30 be __ BMI $1771
+17b3 : 05 1c __ ORA ACCU + 1
+17b5 : 05 1b __ ORA ACCU + 0
+17b7 : f0 0f __ BEQ $17c8
+17b9 : c6 07 __ DEC $07
+17bb : f0 0b __ BEQ $17c8
+17bd : 06 1b __ ASL ACCU + 0
+17bf : 26 1c __ ROL ACCU + 1
+17c1 : 26 1d __ ROL ACCU + 2
+17c3 : 10 f4 __ BPL $17b9
+17c5 : 4c 71 17 JMP $1771 ; (faddsub + 102)
+17c8 : a9 00 __ LDA #$00
+17ca : 85 1b __ STA ACCU + 0
+17cc : 85 1c __ STA ACCU + 1
+17ce : 85 1d __ STA ACCU + 2
+17d0 : 85 1e __ STA ACCU + 3
+17d2 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+17d3 : a5 1b __ LDA ACCU + 0
+17d5 : 05 1c __ ORA ACCU + 1
+17d7 : 05 1d __ ORA ACCU + 2
+17d9 : d0 03 __ BNE $17de
+17db : 85 1e __ STA ACCU + 3
+17dd : 60 __ __ RTS
+17de : a5 03 __ LDA $03
+17e0 : 05 04 __ ORA $04
+17e2 : 05 05 __ ORA $05
+17e4 : d0 09 __ BNE $17ef
+17e6 : 85 1b __ STA ACCU + 0
+17e8 : 85 1c __ STA ACCU + 1
+17ea : 85 1d __ STA ACCU + 2
+17ec : 85 1e __ STA ACCU + 3
+17ee : 60 __ __ RTS
+17ef : a9 00 __ LDA #$00
+17f1 : 85 09 __ STA $09
+17f3 : 85 0a __ STA $0a
+17f5 : 85 0b __ STA $0b
+17f7 : a4 1b __ LDY ACCU + 0
+17f9 : a5 03 __ LDA $03
+17fb : d0 06 __ BNE $1803
+17fd : a5 04 __ LDA $04
+17ff : f0 0a __ BEQ $180b
+1801 : d0 05 __ BNE $1808
+1803 : 20 43 18 JSR $1843 ; (fmul8 + 0)
+1806 : a5 04 __ LDA $04
+1808 : 20 43 18 JSR $1843 ; (fmul8 + 0)
+180b : a5 05 __ LDA $05
+180d : 20 43 18 JSR $1843 ; (fmul8 + 0)
+1810 : 38 __ __ SEC
+1811 : a5 0b __ LDA $0b
+1813 : 30 06 __ BMI $181b
+1815 : 06 09 __ ASL $09
+1817 : 26 0a __ ROL $0a
+1819 : 2a __ __ ROL
+181a : 18 __ __ CLC
+181b : 29 7f __ AND #$7f
+181d : 85 0b __ STA $0b
+181f : a5 1e __ LDA ACCU + 3
+1821 : 45 06 __ EOR $06
+1823 : 29 80 __ AND #$80
+1825 : 85 1e __ STA ACCU + 3
+1827 : a5 07 __ LDA $07
+1829 : e9 7e __ SBC #$7e
+182b : 18 __ __ CLC
+182c : 65 08 __ ADC $08
+182e : 4a __ __ LSR
+182f : 05 1e __ ORA ACCU + 3
+1831 : 85 1e __ STA ACCU + 3
+1833 : a9 00 __ LDA #$00
+1835 : 6a __ __ ROR
+1836 : 05 0b __ ORA $0b
+1838 : 85 1d __ STA ACCU + 2
+183a : a5 0a __ LDA $0a
+183c : 85 1c __ STA ACCU + 1
+183e : a5 09 __ LDA $09
+1840 : 85 1b __ STA ACCU + 0
+1842 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1843 : 38 __ __ SEC
+1844 : 6a __ __ ROR
+1845 : 90 1e __ BCC $1865
+1847 : aa __ __ TAX
+1848 : 18 __ __ CLC
+1849 : 98 __ __ TYA
+184a : 65 09 __ ADC $09
+184c : 85 09 __ STA $09
+184e : a5 0a __ LDA $0a
+1850 : 65 1c __ ADC ACCU + 1
+1852 : 85 0a __ STA $0a
+1854 : a5 0b __ LDA $0b
+1856 : 65 1d __ ADC ACCU + 2
+1858 : 6a __ __ ROR
+1859 : 85 0b __ STA $0b
+185b : 8a __ __ TXA
+185c : 66 0a __ ROR $0a
+185e : 66 09 __ ROR $09
+1860 : 4a __ __ LSR
+1861 : f0 0d __ BEQ $1870
+1863 : b0 e2 __ BCS $1847
+1865 : 66 0b __ ROR $0b
+1867 : 66 0a __ ROR $0a
+1869 : 66 09 __ ROR $09
+186b : 4a __ __ LSR
+186c : 90 f7 __ BCC $1865
+186e : d0 d7 __ BNE $1847
+1870 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1871 : a5 1b __ LDA ACCU + 0
+1873 : 05 1c __ ORA ACCU + 1
+1875 : 05 1d __ ORA ACCU + 2
+1877 : d0 03 __ BNE $187c
+1879 : 85 1e __ STA ACCU + 3
+187b : 60 __ __ RTS
+187c : a5 1e __ LDA ACCU + 3
+187e : 45 06 __ EOR $06
+1880 : 29 80 __ AND #$80
+1882 : 85 1e __ STA ACCU + 3
+1884 : a9 00 __ LDA #$00
+1886 : 85 09 __ STA $09
+1888 : 85 0a __ STA $0a
+188a : 85 0b __ STA $0b
+188c : a2 18 __ LDX #$18
+188e : a5 1b __ LDA ACCU + 0
+1890 : c5 03 __ CMP $03
+1892 : a5 1c __ LDA ACCU + 1
+1894 : e5 04 __ SBC $04
+1896 : a5 1d __ LDA ACCU + 2
+1898 : e5 05 __ SBC $05
+189a : 90 13 __ BCC $18af
+189c : a5 1b __ LDA ACCU + 0
+189e : e5 03 __ SBC $03
+18a0 : 85 1b __ STA ACCU + 0
+18a2 : a5 1c __ LDA ACCU + 1
+18a4 : e5 04 __ SBC $04
+18a6 : 85 1c __ STA ACCU + 1
+18a8 : a5 1d __ LDA ACCU + 2
+18aa : e5 05 __ SBC $05
+18ac : 85 1d __ STA ACCU + 2
+18ae : 38 __ __ SEC
+18af : 26 09 __ ROL $09
+18b1 : 26 0a __ ROL $0a
+18b3 : 26 0b __ ROL $0b
+18b5 : ca __ __ DEX
+18b6 : f0 0a __ BEQ $18c2
+18b8 : 06 1b __ ASL ACCU + 0
+18ba : 26 1c __ ROL ACCU + 1
+18bc : 26 1d __ ROL ACCU + 2
+18be : b0 dc __ BCS $189c
+18c0 : 90 cc __ BCC $188e
+18c2 : 38 __ __ SEC
+18c3 : a5 0b __ LDA $0b
+18c5 : 30 06 __ BMI $18cd
+18c7 : 06 09 __ ASL $09
+18c9 : 26 0a __ ROL $0a
+18cb : 2a __ __ ROL
+18cc : 18 __ __ CLC
+18cd : 29 7f __ AND #$7f
+18cf : 85 0b __ STA $0b
+18d1 : a5 08 __ LDA $08
+18d3 : 49 7f __ EOR #$7f
+18d5 : 65 07 __ ADC $07
+18d7 : 38 __ __ SEC
+18d8 : e9 01 __ SBC #$01
+18da : 4a __ __ LSR
+18db : 05 1e __ ORA ACCU + 3
+18dd : 85 1e __ STA ACCU + 3
+18df : a9 00 __ LDA #$00
+18e1 : 6a __ __ ROR
+18e2 : 05 0b __ ORA $0b
+18e4 : 85 1d __ STA ACCU + 2
+18e6 : a5 0a __ LDA $0a
+18e8 : 85 1c __ STA ACCU + 1
+18ea : a5 09 __ LDA $09
+18ec : 85 1b __ STA ACCU + 0
+18ee : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+18ef : 38 __ __ SEC
+18f0 : a9 00 __ LDA #$00
+18f2 : e5 1b __ SBC ACCU + 0
+18f4 : 85 1b __ STA ACCU + 0
+18f6 : a9 00 __ LDA #$00
+18f8 : e5 1c __ SBC ACCU + 1
+18fa : 85 1c __ STA ACCU + 1
+18fc : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+18fd : 38 __ __ SEC
+18fe : a9 00 __ LDA #$00
+1900 : e5 03 __ SBC $03
+1902 : 85 03 __ STA $03
+1904 : a9 00 __ LDA #$00
+1906 : e5 04 __ SBC $04
+1908 : 85 04 __ STA $04
+190a : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+190b : a5 1c __ LDA ACCU + 1
+190d : d0 31 __ BNE $1940
+190f : a5 04 __ LDA $04
+1911 : d0 1e __ BNE $1931
+1913 : 85 06 __ STA $06
+1915 : a2 04 __ LDX #$04
+1917 : 06 1b __ ASL ACCU + 0
+1919 : 2a __ __ ROL
+191a : c5 03 __ CMP $03
+191c : 90 02 __ BCC $1920
+191e : e5 03 __ SBC $03
+1920 : 26 1b __ ROL ACCU + 0
+1922 : 2a __ __ ROL
+1923 : c5 03 __ CMP $03
+1925 : 90 02 __ BCC $1929
+1927 : e5 03 __ SBC $03
+1929 : 26 1b __ ROL ACCU + 0
+192b : ca __ __ DEX
+192c : d0 eb __ BNE $1919
+192e : 85 05 __ STA $05
+1930 : 60 __ __ RTS
+1931 : a5 1b __ LDA ACCU + 0
+1933 : 85 05 __ STA $05
+1935 : a5 1c __ LDA ACCU + 1
+1937 : 85 06 __ STA $06
+1939 : a9 00 __ LDA #$00
+193b : 85 1b __ STA ACCU + 0
+193d : 85 1c __ STA ACCU + 1
+193f : 60 __ __ RTS
+1940 : a5 04 __ LDA $04
+1942 : d0 1f __ BNE $1963
+1944 : a5 03 __ LDA $03
+1946 : 30 1b __ BMI $1963
+1948 : a9 00 __ LDA #$00
+194a : 85 06 __ STA $06
+194c : a2 10 __ LDX #$10
+194e : 06 1b __ ASL ACCU + 0
+1950 : 26 1c __ ROL ACCU + 1
+1952 : 2a __ __ ROL
+1953 : c5 03 __ CMP $03
+1955 : 90 02 __ BCC $1959
+1957 : e5 03 __ SBC $03
+1959 : 26 1b __ ROL ACCU + 0
+195b : 26 1c __ ROL ACCU + 1
+195d : ca __ __ DEX
+195e : d0 f2 __ BNE $1952
+1960 : 85 05 __ STA $05
+1962 : 60 __ __ RTS
+1963 : a9 00 __ LDA #$00
+1965 : 85 05 __ STA $05
+1967 : 85 06 __ STA $06
+1969 : 84 02 __ STY $02
+196b : a0 10 __ LDY #$10
+196d : 18 __ __ CLC
+196e : 26 1b __ ROL ACCU + 0
+1970 : 26 1c __ ROL ACCU + 1
+1972 : 26 05 __ ROL $05
+1974 : 26 06 __ ROL $06
+1976 : 38 __ __ SEC
+1977 : a5 05 __ LDA $05
+1979 : e5 03 __ SBC $03
+197b : aa __ __ TAX
+197c : a5 06 __ LDA $06
+197e : e5 04 __ SBC $04
+1980 : 90 04 __ BCC $1986
+1982 : 86 05 __ STX $05
+1984 : 85 06 __ STA $06
+1986 : 88 __ __ DEY
+1987 : d0 e5 __ BNE $196e
+1989 : 26 1b __ ROL ACCU + 0
+198b : 26 1c __ ROL ACCU + 1
+198d : a4 02 __ LDY $02
+198f : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1990 : 20 ea 16 JSR $16ea ; (freg + 36)
+1993 : a5 07 __ LDA $07
+1995 : c9 7f __ CMP #$7f
+1997 : b0 07 __ BCS $19a0
+1999 : a9 00 __ LDA #$00
+199b : 85 1b __ STA ACCU + 0
+199d : 85 1c __ STA ACCU + 1
+199f : 60 __ __ RTS
+19a0 : 38 __ __ SEC
+19a1 : e9 8e __ SBC #$8e
+19a3 : 90 0a __ BCC $19af
+19a5 : a9 ff __ LDA #$ff
+19a7 : 85 1b __ STA ACCU + 0
+19a9 : a9 7f __ LDA #$7f
+19ab : 85 1c __ STA ACCU + 1
+19ad : d0 08 __ BNE $19b7
+19af : aa __ __ TAX
+19b0 : 46 1d __ LSR ACCU + 2
+19b2 : 66 1c __ ROR ACCU + 1
+19b4 : e8 __ __ INX
+19b5 : d0 f9 __ BNE $19b0
+19b7 : 24 1e __ BIT ACCU + 3
+19b9 : 10 0e __ BPL $19c9
+19bb : 38 __ __ SEC
+19bc : a9 00 __ LDA #$00
+19be : e5 1c __ SBC ACCU + 1
+19c0 : 85 1b __ STA ACCU + 0
+19c2 : a9 00 __ LDA #$00
+19c4 : e5 1d __ SBC ACCU + 2
+19c6 : 85 1c __ STA ACCU + 1
+19c8 : 60 __ __ RTS
+19c9 : a5 1c __ LDA ACCU + 1
+19cb : 85 1b __ STA ACCU + 0
+19cd : a5 1d __ LDA ACCU + 2
+19cf : 85 1c __ STA ACCU + 1
+19d1 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+19d2 : 24 1c __ BIT ACCU + 1
+19d4 : 30 03 __ BMI $19d9
+19d6 : 4c f0 19 JMP $19f0 ; (uint16_to_float + 0)
+19d9 : 38 __ __ SEC
+19da : a9 00 __ LDA #$00
+19dc : e5 1b __ SBC ACCU + 0
+19de : 85 1b __ STA ACCU + 0
+19e0 : a9 00 __ LDA #$00
+19e2 : e5 1c __ SBC ACCU + 1
+19e4 : 85 1c __ STA ACCU + 1
+19e6 : 20 f0 19 JSR $19f0 ; (uint16_to_float + 0)
+19e9 : a5 1e __ LDA ACCU + 3
+19eb : 09 80 __ ORA #$80
+19ed : 85 1e __ STA ACCU + 3
+19ef : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+19f0 : a5 1b __ LDA ACCU + 0
+19f2 : 05 1c __ ORA ACCU + 1
+19f4 : d0 05 __ BNE $19fb
+19f6 : 85 1d __ STA ACCU + 2
+19f8 : 85 1e __ STA ACCU + 3
+19fa : 60 __ __ RTS
+19fb : a2 8e __ LDX #$8e
+19fd : a5 1c __ LDA ACCU + 1
+19ff : 30 06 __ BMI $1a07
+1a01 : ca __ __ DEX
+1a02 : 06 1b __ ASL ACCU + 0
+1a04 : 2a __ __ ROL
+1a05 : 10 fa __ BPL $1a01
+1a07 : 29 7f __ AND #$7f
+1a09 : 85 1d __ STA ACCU + 2
+1a0b : a5 1b __ LDA ACCU + 0
+1a0d : 85 1c __ STA ACCU + 1
+1a0f : 8a __ __ TXA
+1a10 : 4a __ __ LSR
+1a11 : 85 1e __ STA ACCU + 3
+1a13 : a9 00 __ LDA #$00
+1a15 : 85 1b __ STA ACCU + 0
+1a17 : 6a __ __ ROR
+1a18 : 05 1d __ ORA ACCU + 2
+1a1a : 85 1d __ STA ACCU + 2
+1a1c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1a1d : 38 __ __ SEC
+1a1e : a9 00 __ LDA #$00
+1a20 : e5 1b __ SBC ACCU + 0
+1a22 : 85 1b __ STA ACCU + 0
+1a24 : a9 00 __ LDA #$00
+1a26 : e5 1c __ SBC ACCU + 1
+1a28 : 85 1c __ STA ACCU + 1
+1a2a : a9 00 __ LDA #$00
+1a2c : e5 1d __ SBC ACCU + 2
+1a2e : 85 1d __ STA ACCU + 2
+1a30 : a9 00 __ LDA #$00
+1a32 : e5 1e __ SBC ACCU + 3
+1a34 : 85 1e __ STA ACCU + 3
+1a36 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1a37 : 84 02 __ STY $02
+1a39 : a9 00 __ LDA #$00
+1a3b : 85 07 __ STA $07
+1a3d : 85 08 __ STA $08
+1a3f : 85 09 __ STA $09
+1a41 : 85 0a __ STA $0a
+1a43 : a0 20 __ LDY #$20
+1a45 : 18 __ __ CLC
+1a46 : 26 1b __ ROL ACCU + 0
+1a48 : 26 1c __ ROL ACCU + 1
+1a4a : 26 1d __ ROL ACCU + 2
+1a4c : 26 1e __ ROL ACCU + 3
+1a4e : 26 07 __ ROL $07
+1a50 : 26 08 __ ROL $08
+1a52 : 26 09 __ ROL $09
+1a54 : 26 0a __ ROL $0a
+1a56 : a5 07 __ LDA $07
+1a58 : c5 03 __ CMP $03
+1a5a : a5 08 __ LDA $08
+1a5c : e5 04 __ SBC $04
+1a5e : a5 09 __ LDA $09
+1a60 : e5 05 __ SBC $05
+1a62 : a5 0a __ LDA $0a
+1a64 : e5 06 __ SBC $06
+1a66 : 90 18 __ BCC $1a80
+1a68 : a5 07 __ LDA $07
+1a6a : e5 03 __ SBC $03
+1a6c : 85 07 __ STA $07
+1a6e : a5 08 __ LDA $08
+1a70 : e5 04 __ SBC $04
+1a72 : 85 08 __ STA $08
+1a74 : a5 09 __ LDA $09
+1a76 : e5 05 __ SBC $05
+1a78 : 85 09 __ STA $09
+1a7a : a5 0a __ LDA $0a
+1a7c : e5 06 __ SBC $06
+1a7e : 85 0a __ STA $0a
+1a80 : 88 __ __ DEY
+1a81 : d0 c3 __ BNE $1a46
+1a83 : 26 1b __ ROL ACCU + 0
+1a85 : 26 1c __ ROL ACCU + 1
+1a87 : 26 1d __ ROL ACCU + 2
+1a89 : 26 1e __ ROL ACCU + 3
+1a8b : a4 02 __ LDY $02
+1a8d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1a8e : a9 00 __ LDA #$00
+1a90 : 85 1d __ STA ACCU + 2
+1a92 : 85 1e __ STA ACCU + 3
+1a94 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1a95 : b5 00 __ LDA $00,x
+1a97 : 85 03 __ STA $03
+1a99 : b5 01 __ LDA $01,x
+1a9b : 85 04 __ STA $04
+1a9d : b5 02 __ LDA $02,x
+1a9f : 85 05 __ STA $05
+1aa1 : b5 03 __ LDA $03,x
+1aa3 : 85 06 __ STA $06
+1aa5 : 20 37 1a JSR $1a37 ; (divmod32 + 0)
+1aa8 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1aa9 : b5 00 __ LDA $00,x
+1aab : 85 03 __ STA $03
+1aad : b5 01 __ LDA $01,x
+1aaf : 85 04 __ STA $04
+1ab1 : b5 02 __ LDA $02,x
+1ab3 : 85 05 __ STA $05
+1ab5 : b5 03 __ LDA $03,x
+1ab7 : 85 06 __ STA $06
+1ab9 : 20 37 1a JSR $1a37 ; (divmod32 + 0)
+1abc : a5 07 __ LDA $07
+1abe : 85 1b __ STA ACCU + 0
+1ac0 : a5 08 __ LDA $08
+1ac2 : 85 1c __ STA ACCU + 1
+1ac4 : a5 09 __ LDA $09
+1ac6 : 85 1d __ STA ACCU + 2
+1ac8 : a5 0a __ LDA $0a
+1aca : 85 1e __ STA ACCU + 3
+1acc : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1acd : b5 03 __ LDA $03,x
+1acf : c5 1e __ CMP ACCU + 3
+1ad1 : d0 20 __ BNE $1af3
+1ad3 : b5 02 __ LDA $02,x
+1ad5 : c5 1d __ CMP ACCU + 2
+1ad7 : d0 1a __ BNE $1af3
+1ad9 : b5 01 __ LDA $01,x
+1adb : c5 1c __ CMP ACCU + 1
+1add : d0 14 __ BNE $1af3
+1adf : b5 00 __ LDA $00,x
+1ae1 : c5 1b __ CMP ACCU + 0
+1ae3 : d0 0e __ BNE $1af3
+1ae5 : a9 00 __ LDA #$00
+1ae7 : 85 1b __ STA ACCU + 0
+1ae9 : 85 1c __ STA ACCU + 1
+1aeb : 60 __ __ RTS
+1aec : a9 ff __ LDA #$ff
+1aee : 85 1b __ STA ACCU + 0
+1af0 : 85 1c __ STA ACCU + 1
+1af2 : 60 __ __ RTS
+1af3 : 90 f7 __ BCC $1aec
+1af5 : a9 01 __ LDA #$01
+1af7 : 85 1b __ STA ACCU + 0
+1af9 : a9 00 __ LDA #$00
+1afb : 85 1c __ STA ACCU + 1
+1afd : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1afe : a5 1e __ LDA ACCU + 3
+1b00 : 49 80 __ EOR #$80
+1b02 : 85 1e __ STA ACCU + 3
+1b04 : b5 03 __ LDA $03,x
+1b06 : 49 80 __ EOR #$80
+1b08 : c5 1e __ CMP ACCU + 3
+1b0a : d0 20 __ BNE $1b2c
+1b0c : b5 02 __ LDA $02,x
+1b0e : c5 1d __ CMP ACCU + 2
+1b10 : d0 1a __ BNE $1b2c
+1b12 : b5 01 __ LDA $01,x
+1b14 : c5 1c __ CMP ACCU + 1
+1b16 : d0 14 __ BNE $1b2c
+1b18 : b5 00 __ LDA $00,x
+1b1a : c5 1b __ CMP ACCU + 0
+1b1c : d0 0e __ BNE $1b2c
+1b1e : a9 00 __ LDA #$00
+1b20 : 85 1b __ STA ACCU + 0
+1b22 : 85 1c __ STA ACCU + 1
+1b24 : 60 __ __ RTS
+1b25 : a9 ff __ LDA #$ff
+1b27 : 85 1b __ STA ACCU + 0
+1b29 : 85 1c __ STA ACCU + 1
+1b2b : 60 __ __ RTS
+1b2c : 90 f7 __ BCC $1b25
+1b2e : a9 01 __ LDA #$01
+1b30 : 85 1b __ STA ACCU + 0
+1b32 : a9 00 __ LDA #$00
+1b34 : 85 1c __ STA ACCU + 1
+1b36 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1b37 : a9 4c __ LDA #$4c
+1b39 : 85 54 __ STA $54
+1b3b : a9 00 __ LDA #$00
+1b3d : 85 13 __ STA P6
+1b3f : a9 19 __ LDA #$19
+1b41 : 85 16 __ STA P9
+1b43 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1b44 : b1 19 __ LDA (IP + 0),y
+1b46 : aa __ __ TAX
+1b47 : c8 __ __ INY
+1b48 : b1 19 __ LDA (IP + 0),y
+1b4a : 95 00 __ STA $00,x
+1b4c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1b4f : b1 19 __ LDA (IP + 0),y
+1b51 : aa __ __ TAX
+1b52 : c8 __ __ INY
+1b53 : b1 19 __ LDA (IP + 0),y
+1b55 : 95 00 __ STA $00,x
+1b57 : a9 00 __ LDA #$00
+1b59 : 95 01 __ STA $01,x
+1b5b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1b5e : b1 19 __ LDA (IP + 0),y
+1b60 : aa __ __ TAX
+1b61 : c8 __ __ INY
+1b62 : b1 19 __ LDA (IP + 0),y
+1b64 : 95 00 __ STA $00,x
+1b66 : a9 ff __ LDA #$ff
+1b68 : 95 01 __ STA $01,x
+1b6a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1b6d : b1 19 __ LDA (IP + 0),y
+1b6f : aa __ __ TAX
+1b70 : c8 __ __ INY
+1b71 : b1 19 __ LDA (IP + 0),y
+1b73 : 95 00 __ STA $00,x
+1b75 : c8 __ __ INY
+1b76 : b1 19 __ LDA (IP + 0),y
+1b78 : 95 01 __ STA $01,x
+1b7a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1b7d : b1 19 __ LDA (IP + 0),y
+1b7f : aa __ __ TAX
+1b80 : c8 __ __ INY
+1b81 : b1 19 __ LDA (IP + 0),y
+1b83 : 95 00 __ STA $00,x
+1b85 : c8 __ __ INY
+1b86 : b1 19 __ LDA (IP + 0),y
+1b88 : 95 01 __ STA $01,x
+1b8a : c8 __ __ INY
+1b8b : b1 19 __ LDA (IP + 0),y
+1b8d : 95 02 __ STA $02,x
+1b8f : c8 __ __ INY
+1b90 : b1 19 __ LDA (IP + 0),y
+1b92 : 95 03 __ STA $03,x
+1b94 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1b97 : b1 19 __ LDA (IP + 0),y
+1b99 : aa __ __ TAX
+1b9a : b5 00 __ LDA $00,x
+1b9c : 85 1b __ STA ACCU + 0
+1b9e : a9 00 __ LDA #$00
+1ba0 : 85 1c __ STA ACCU + 1
+1ba2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1ba5 : b1 19 __ LDA (IP + 0),y
+1ba7 : aa __ __ TAX
+1ba8 : a5 1b __ LDA ACCU + 0
+1baa : 95 00 __ STA $00,x
+1bac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1baf : b1 19 __ LDA (IP + 0),y
+1bb1 : aa __ __ TAX
+1bb2 : b5 00 __ LDA $00,x
+1bb4 : 85 1b __ STA ACCU + 0
+1bb6 : b5 01 __ LDA $01,x
+1bb8 : 85 1c __ STA ACCU + 1
+1bba : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1bbd : b1 19 __ LDA (IP + 0),y
+1bbf : aa __ __ TAX
+1bc0 : a5 1b __ LDA ACCU + 0
+1bc2 : 95 00 __ STA $00,x
+1bc4 : a5 1c __ LDA ACCU + 1
+1bc6 : 95 01 __ STA $01,x
+1bc8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1bcb : b1 19 __ LDA (IP + 0),y
+1bcd : aa __ __ TAX
+1bce : b5 00 __ LDA $00,x
+1bd0 : 85 1f __ STA ADDR + 0
+1bd2 : b5 01 __ LDA $01,x
+1bd4 : 85 20 __ STA ADDR + 1
+1bd6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1bd9 : b1 19 __ LDA (IP + 0),y
+1bdb : aa __ __ TAX
+1bdc : b5 00 __ LDA $00,x
+1bde : 85 1b __ STA ACCU + 0
+1be0 : b5 01 __ LDA $01,x
+1be2 : 85 1c __ STA ACCU + 1
+1be4 : b5 02 __ LDA $02,x
+1be6 : 85 1d __ STA ACCU + 2
+1be8 : b5 03 __ LDA $03,x
+1bea : 85 1e __ STA ACCU + 3
+1bec : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1bef : b1 19 __ LDA (IP + 0),y
+1bf1 : aa __ __ TAX
+1bf2 : a5 1b __ LDA ACCU + 0
+1bf4 : 95 00 __ STA $00,x
+1bf6 : a5 1c __ LDA ACCU + 1
+1bf8 : 95 01 __ STA $01,x
+1bfa : a5 1d __ LDA ACCU + 2
+1bfc : 95 02 __ STA $02,x
+1bfe : a5 1e __ LDA ACCU + 3
+1c00 : 95 03 __ STA $03,x
+1c02 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1c05 : b1 19 __ LDA (IP + 0),y
+1c07 : 85 1f __ STA ADDR + 0
+1c09 : c8 __ __ INY
+1c0a : b1 19 __ LDA (IP + 0),y
+1c0c : 85 20 __ STA ADDR + 1
+1c0e : c8 __ __ INY
+1c0f : b1 19 __ LDA (IP + 0),y
+1c11 : aa __ __ TAX
+1c12 : 84 02 __ STY $02
+1c14 : a0 00 __ LDY #$00
+1c16 : b1 1f __ LDA (ADDR + 0),y
+1c18 : 95 00 __ STA $00,x
+1c1a : c8 __ __ INY
+1c1b : b1 1f __ LDA (ADDR + 0),y
+1c1d : 95 01 __ STA $01,x
+1c1f : a4 02 __ LDY $02
+1c21 : 4c 50 08 JMP $0850 ; (startup + 79)
+1c24 : b1 19 __ LDA (IP + 0),y
+1c26 : aa __ __ TAX
+1c27 : c8 __ __ INY
+1c28 : b1 19 __ LDA (IP + 0),y
+1c2a : 84 02 __ STY $02
+1c2c : a8 __ __ TAY
+1c2d : 4c 16 1c JMP $1c16 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1c30 : b1 19 __ LDA (IP + 0),y
+1c32 : 85 1f __ STA ADDR + 0
+1c34 : c8 __ __ INY
+1c35 : b1 19 __ LDA (IP + 0),y
+1c37 : 85 20 __ STA ADDR + 1
+1c39 : c8 __ __ INY
+1c3a : b1 19 __ LDA (IP + 0),y
+1c3c : aa __ __ TAX
+1c3d : 84 02 __ STY $02
+1c3f : a0 00 __ LDY #$00
+1c41 : b5 00 __ LDA $00,x
+1c43 : 91 1f __ STA (ADDR + 0),y
+1c45 : c8 __ __ INY
+1c46 : b5 01 __ LDA $01,x
+1c48 : 91 1f __ STA (ADDR + 0),y
+1c4a : a4 02 __ LDY $02
+1c4c : 4c 50 08 JMP $0850 ; (startup + 79)
+1c4f : b1 19 __ LDA (IP + 0),y
+1c51 : aa __ __ TAX
+1c52 : c8 __ __ INY
+1c53 : b1 19 __ LDA (IP + 0),y
+1c55 : 84 02 __ STY $02
+1c57 : a8 __ __ TAY
+1c58 : 4c 41 1c JMP $1c41 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1c5b : b1 19 __ LDA (IP + 0),y
+1c5d : aa __ __ TAX
+1c5e : c8 __ __ INY
+1c5f : b1 19 __ LDA (IP + 0),y
+1c61 : 95 00 __ STA $00,x
+1c63 : c8 __ __ INY
+1c64 : b1 19 __ LDA (IP + 0),y
+1c66 : 95 01 __ STA $01,x
+1c68 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1c6b : b1 19 __ LDA (IP + 0),y
+1c6d : aa __ __ TAX
+1c6e : 18 __ __ CLC
+1c6f : b5 00 __ LDA $00,x
+1c71 : 65 1b __ ADC ACCU + 0
+1c73 : 85 1f __ STA ADDR + 0
+1c75 : b5 01 __ LDA $01,x
+1c77 : 65 1c __ ADC ACCU + 1
+1c79 : 85 20 __ STA ADDR + 1
+1c7b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1c7e : b1 19 __ LDA (IP + 0),y
+1c80 : aa __ __ TAX
+1c81 : c8 __ __ INY
+1c82 : b1 19 __ LDA (IP + 0),y
+1c84 : 84 02 __ STY $02
+1c86 : a8 __ __ TAY
+1c87 : b1 25 __ LDA (FP + 0),y
+1c89 : 95 00 __ STA $00,x
+1c8b : a4 02 __ LDY $02
+1c8d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1c90 : b1 19 __ LDA (IP + 0),y
+1c92 : aa __ __ TAX
+1c93 : c8 __ __ INY
+1c94 : b1 19 __ LDA (IP + 0),y
+1c96 : 84 02 __ STY $02
+1c98 : a8 __ __ TAY
+1c99 : b1 25 __ LDA (FP + 0),y
+1c9b : 95 00 __ STA $00,x
+1c9d : a9 00 __ LDA #$00
+1c9f : 95 01 __ STA $01,x
+1ca1 : a4 02 __ LDY $02
+1ca3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1ca6 : b1 19 __ LDA (IP + 0),y
+1ca8 : aa __ __ TAX
+1ca9 : c8 __ __ INY
+1caa : b1 19 __ LDA (IP + 0),y
+1cac : 84 02 __ STY $02
+1cae : a8 __ __ TAY
+1caf : b1 25 __ LDA (FP + 0),y
+1cb1 : 95 00 __ STA $00,x
+1cb3 : c8 __ __ INY
+1cb4 : b1 25 __ LDA (FP + 0),y
+1cb6 : 95 01 __ STA $01,x
+1cb8 : a4 02 __ LDY $02
+1cba : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1cbd : b1 19 __ LDA (IP + 0),y
+1cbf : aa __ __ TAX
+1cc0 : c8 __ __ INY
+1cc1 : b1 19 __ LDA (IP + 0),y
+1cc3 : 84 02 __ STY $02
+1cc5 : a8 __ __ TAY
+1cc6 : b5 00 __ LDA $00,x
+1cc8 : 91 25 __ STA (FP + 0),y
+1cca : a4 02 __ LDY $02
+1ccc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1ccf : b1 19 __ LDA (IP + 0),y
+1cd1 : aa __ __ TAX
+1cd2 : c8 __ __ INY
+1cd3 : b1 19 __ LDA (IP + 0),y
+1cd5 : 84 02 __ STY $02
+1cd7 : a8 __ __ TAY
+1cd8 : b5 00 __ LDA $00,x
+1cda : 91 25 __ STA (FP + 0),y
+1cdc : c8 __ __ INY
+1cdd : b5 01 __ LDA $01,x
+1cdf : 91 25 __ STA (FP + 0),y
+1ce1 : a4 02 __ LDY $02
+1ce3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1ce6 : b1 19 __ LDA (IP + 0),y
+1ce8 : aa __ __ TAX
+1ce9 : c8 __ __ INY
+1cea : 18 __ __ CLC
+1ceb : b1 19 __ LDA (IP + 0),y
+1ced : 65 25 __ ADC FP + 0
+1cef : 95 00 __ STA $00,x
+1cf1 : c8 __ __ INY
+1cf2 : b1 19 __ LDA (IP + 0),y
+1cf4 : 65 26 __ ADC FP + 1
+1cf6 : 95 01 __ STA $01,x
+1cf8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1cfb : b1 19 __ LDA (IP + 0),y
+1cfd : aa __ __ TAX
+1cfe : c8 __ __ INY
+1cff : b1 19 __ LDA (IP + 0),y
+1d01 : 84 02 __ STY $02
+1d03 : a8 __ __ TAY
+1d04 : b5 00 __ LDA $00,x
+1d06 : 91 23 __ STA (SP + 0),y
+1d08 : a4 02 __ LDY $02
+1d0a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1d0d : b1 19 __ LDA (IP + 0),y
+1d0f : aa __ __ TAX
+1d10 : c8 __ __ INY
+1d11 : b1 19 __ LDA (IP + 0),y
+1d13 : 84 02 __ STY $02
+1d15 : a8 __ __ TAY
+1d16 : b5 00 __ LDA $00,x
+1d18 : 91 23 __ STA (SP + 0),y
+1d1a : c8 __ __ INY
+1d1b : b5 01 __ LDA $01,x
+1d1d : 91 23 __ STA (SP + 0),y
+1d1f : a4 02 __ LDY $02
+1d21 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1d24 : b1 19 __ LDA (IP + 0),y
+1d26 : 85 1f __ STA ADDR + 0
+1d28 : c8 __ __ INY
+1d29 : b1 19 __ LDA (IP + 0),y
+1d2b : 85 20 __ STA ADDR + 1
+1d2d : c8 __ __ INY
+1d2e : b1 19 __ LDA (IP + 0),y
+1d30 : aa __ __ TAX
+1d31 : 84 02 __ STY $02
+1d33 : a0 00 __ LDY #$00
+1d35 : b1 1f __ LDA (ADDR + 0),y
+1d37 : 95 00 __ STA $00,x
+1d39 : a4 02 __ LDY $02
+1d3b : 4c 50 08 JMP $0850 ; (startup + 79)
+1d3e : b1 19 __ LDA (IP + 0),y
+1d40 : aa __ __ TAX
+1d41 : c8 __ __ INY
+1d42 : b1 19 __ LDA (IP + 0),y
+1d44 : 84 02 __ STY $02
+1d46 : a8 __ __ TAY
+1d47 : 4c 35 1d JMP $1d35 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1d4a : b1 19 __ LDA (IP + 0),y
+1d4c : 85 1f __ STA ADDR + 0
+1d4e : c8 __ __ INY
+1d4f : b1 19 __ LDA (IP + 0),y
+1d51 : 85 20 __ STA ADDR + 1
+1d53 : c8 __ __ INY
+1d54 : b1 19 __ LDA (IP + 0),y
+1d56 : aa __ __ TAX
+1d57 : 84 02 __ STY $02
+1d59 : a0 00 __ LDY #$00
+1d5b : b1 1f __ LDA (ADDR + 0),y
+1d5d : 95 00 __ STA $00,x
+1d5f : a9 00 __ LDA #$00
+1d61 : 95 01 __ STA $01,x
+1d63 : a4 02 __ LDY $02
+1d65 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d68 : b1 19 __ LDA (IP + 0),y
+1d6a : aa __ __ TAX
+1d6b : c8 __ __ INY
+1d6c : b1 19 __ LDA (IP + 0),y
+1d6e : 84 02 __ STY $02
+1d70 : a8 __ __ TAY
+1d71 : 4c 5b 1d JMP $1d5b ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1d74 : b1 19 __ LDA (IP + 0),y
+1d76 : 85 1f __ STA ADDR + 0
+1d78 : c8 __ __ INY
+1d79 : b1 19 __ LDA (IP + 0),y
+1d7b : 85 20 __ STA ADDR + 1
+1d7d : c8 __ __ INY
+1d7e : b1 19 __ LDA (IP + 0),y
+1d80 : aa __ __ TAX
+1d81 : 84 02 __ STY $02
+1d83 : a0 00 __ LDY #$00
+1d85 : b1 1f __ LDA (ADDR + 0),y
+1d87 : 95 00 __ STA $00,x
+1d89 : c8 __ __ INY
+1d8a : b1 1f __ LDA (ADDR + 0),y
+1d8c : 95 01 __ STA $01,x
+1d8e : c8 __ __ INY
+1d8f : b1 1f __ LDA (ADDR + 0),y
+1d91 : 95 02 __ STA $02,x
+1d93 : c8 __ __ INY
+1d94 : b1 1f __ LDA (ADDR + 0),y
+1d96 : 95 03 __ STA $03,x
+1d98 : a4 02 __ LDY $02
+1d9a : 4c 50 08 JMP $0850 ; (startup + 79)
+1d9d : b1 19 __ LDA (IP + 0),y
+1d9f : aa __ __ TAX
+1da0 : c8 __ __ INY
+1da1 : b1 19 __ LDA (IP + 0),y
+1da3 : 84 02 __ STY $02
+1da5 : a8 __ __ TAY
+1da6 : 4c 85 1d JMP $1d85 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1da9 : b1 19 __ LDA (IP + 0),y
+1dab : 85 1f __ STA ADDR + 0
+1dad : c8 __ __ INY
+1dae : b1 19 __ LDA (IP + 0),y
+1db0 : 85 20 __ STA ADDR + 1
+1db2 : c8 __ __ INY
+1db3 : b1 19 __ LDA (IP + 0),y
+1db5 : aa __ __ TAX
+1db6 : 84 02 __ STY $02
+1db8 : a0 00 __ LDY #$00
+1dba : b5 00 __ LDA $00,x
+1dbc : 91 1f __ STA (ADDR + 0),y
+1dbe : a4 02 __ LDY $02
+1dc0 : 4c 50 08 JMP $0850 ; (startup + 79)
+1dc3 : b1 19 __ LDA (IP + 0),y
+1dc5 : aa __ __ TAX
+1dc6 : c8 __ __ INY
+1dc7 : b1 19 __ LDA (IP + 0),y
+1dc9 : 84 02 __ STY $02
+1dcb : a8 __ __ TAY
+1dcc : 4c ba 1d JMP $1dba ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1dcf : b1 19 __ LDA (IP + 0),y
+1dd1 : aa __ __ TAX
+1dd2 : 18 __ __ CLC
+1dd3 : a5 1b __ LDA ACCU + 0
+1dd5 : 75 00 __ ADC $00,x
+1dd7 : 85 1b __ STA ACCU + 0
+1dd9 : a5 1c __ LDA ACCU + 1
+1ddb : 75 01 __ ADC $01,x
+1ddd : 85 1c __ STA ACCU + 1
+1ddf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1de2 : b1 19 __ LDA (IP + 0),y
+1de4 : aa __ __ TAX
+1de5 : 38 __ __ SEC
+1de6 : a5 1b __ LDA ACCU + 0
+1de8 : f5 00 __ SBC $00,x
+1dea : 85 1b __ STA ACCU + 0
+1dec : a5 1c __ LDA ACCU + 1
+1dee : f5 01 __ SBC $01,x
+1df0 : 85 1c __ STA ACCU + 1
+1df2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+1df5 : b1 19 __ LDA (IP + 0),y
+1df7 : aa __ __ TAX
+1df8 : a5 1b __ LDA ACCU + 0
+1dfa : 55 00 __ EOR $00,x
+1dfc : 85 1b __ STA ACCU + 0
+1dfe : a5 1c __ LDA ACCU + 1
+1e00 : 55 01 __ EOR $01,x
+1e02 : 85 1c __ STA ACCU + 1
+1e04 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1e07 : b1 19 __ LDA (IP + 0),y
+1e09 : aa __ __ TAX
+1e0a : b5 00 __ LDA $00,x
+1e0c : 85 03 __ STA $03
+1e0e : b5 01 __ LDA $01,x
+1e10 : 85 04 __ STA $04
+1e12 : 20 0b 19 JSR $190b ; (divmod + 0)
+1e15 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1e18 : b1 19 __ LDA (IP + 0),y
+1e1a : aa __ __ TAX
+1e1b : b5 00 __ LDA $00,x
+1e1d : 85 03 __ STA $03
+1e1f : b5 01 __ LDA $01,x
+1e21 : 85 04 __ STA $04
+1e23 : 20 0b 19 JSR $190b ; (divmod + 0)
+1e26 : a5 05 __ LDA $05
+1e28 : 85 1b __ STA ACCU + 0
+1e2a : a5 06 __ LDA $06
+1e2c : 85 1c __ STA ACCU + 1
+1e2e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1e31 : b1 19 __ LDA (IP + 0),y
+1e33 : aa __ __ TAX
+1e34 : b5 00 __ LDA $00,x
+1e36 : 85 03 __ STA $03
+1e38 : b5 01 __ LDA $01,x
+1e3a : 85 04 __ STA $04
+1e3c : 24 1c __ BIT ACCU + 1
+1e3e : 10 10 __ BPL $1e50
+1e40 : 20 ef 18 JSR $18ef ; (negaccu + 0)
+1e43 : 24 04 __ BIT $04
+1e45 : 10 10 __ BPL $1e57
+1e47 : 20 fd 18 JSR $18fd ; (negtmp + 0)
+1e4a : 20 0b 19 JSR $190b ; (divmod + 0)
+1e4d : 4c 50 08 JMP $0850 ; (startup + 79)
+1e50 : 24 04 __ BIT $04
+1e52 : 10 f6 __ BPL $1e4a
+1e54 : 20 fd 18 JSR $18fd ; (negtmp + 0)
+1e57 : 20 0b 19 JSR $190b ; (divmod + 0)
+1e5a : 20 ef 18 JSR $18ef ; (negaccu + 0)
+1e5d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1e60 : b1 19 __ LDA (IP + 0),y
+1e62 : aa __ __ TAX
+1e63 : b5 00 __ LDA $00,x
+1e65 : 85 03 __ STA $03
+1e67 : b5 01 __ LDA $01,x
+1e69 : 85 04 __ STA $04
+1e6b : 24 1c __ BIT ACCU + 1
+1e6d : 10 18 __ BPL $1e87
+1e6f : 20 ef 18 JSR $18ef ; (negaccu + 0)
+1e72 : 24 04 __ BIT $04
+1e74 : 10 18 __ BPL $1e8e
+1e76 : 20 fd 18 JSR $18fd ; (negtmp + 0)
+1e79 : 20 0b 19 JSR $190b ; (divmod + 0)
+1e7c : a5 05 __ LDA $05
+1e7e : 85 1b __ STA ACCU + 0
+1e80 : a5 06 __ LDA $06
+1e82 : 85 1c __ STA ACCU + 1
+1e84 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e87 : 24 04 __ BIT $04
+1e89 : 10 ee __ BPL $1e79
+1e8b : 20 fd 18 JSR $18fd ; (negtmp + 0)
+1e8e : 20 0b 19 JSR $190b ; (divmod + 0)
+1e91 : a5 05 __ LDA $05
+1e93 : 85 1b __ STA ACCU + 0
+1e95 : a5 06 __ LDA $06
+1e97 : 85 1c __ STA ACCU + 1
+1e99 : 20 ef 18 JSR $18ef ; (negaccu + 0)
+1e9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1e9f : b1 19 __ LDA (IP + 0),y
+1ea1 : aa __ __ TAX
+1ea2 : 18 __ __ CLC
+1ea3 : b5 00 __ LDA $00,x
+1ea5 : 65 1b __ ADC ACCU + 0
+1ea7 : 95 00 __ STA $00,x
+1ea9 : b5 01 __ LDA $01,x
+1eab : 65 1c __ ADC ACCU + 1
+1ead : 95 01 __ STA $01,x
+1eaf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1eb2 : b1 19 __ LDA (IP + 0),y
+1eb4 : c8 __ __ INY
+1eb5 : aa __ __ TAX
+1eb6 : 18 __ __ CLC
+1eb7 : b5 00 __ LDA $00,x
+1eb9 : 71 19 __ ADC (IP + 0),y
+1ebb : c8 __ __ INY
+1ebc : 95 00 __ STA $00,x
+1ebe : b5 01 __ LDA $01,x
+1ec0 : 71 19 __ ADC (IP + 0),y
+1ec2 : 95 01 __ STA $01,x
+1ec4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1ec7 : b1 19 __ LDA (IP + 0),y
+1ec9 : c8 __ __ INY
+1eca : aa __ __ TAX
+1ecb : 38 __ __ SEC
+1ecc : b1 19 __ LDA (IP + 0),y
+1ece : c8 __ __ INY
+1ecf : f5 00 __ SBC $00,x
+1ed1 : 95 00 __ STA $00,x
+1ed3 : b1 19 __ LDA (IP + 0),y
+1ed5 : f5 01 __ SBC $01,x
+1ed7 : 95 01 __ STA $01,x
+1ed9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1edc : b1 19 __ LDA (IP + 0),y
+1ede : c8 __ __ INY
+1edf : aa __ __ TAX
+1ee0 : b5 00 __ LDA $00,x
+1ee2 : 31 19 __ AND (IP + 0),y
+1ee4 : c8 __ __ INY
+1ee5 : 95 00 __ STA $00,x
+1ee7 : b5 01 __ LDA $01,x
+1ee9 : 31 19 __ AND (IP + 0),y
+1eeb : 95 01 __ STA $01,x
+1eed : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1ef0 : b1 19 __ LDA (IP + 0),y
+1ef2 : c8 __ __ INY
+1ef3 : aa __ __ TAX
+1ef4 : a9 00 __ LDA #$00
+1ef6 : 85 05 __ STA $05
+1ef8 : 85 06 __ STA $06
+1efa : b5 00 __ LDA $00,x
+1efc : 85 03 __ STA $03
+1efe : b5 01 __ LDA $01,x
+1f00 : 85 04 __ STA $04
+1f02 : b1 19 __ LDA (IP + 0),y
+1f04 : 4a __ __ LSR
+1f05 : 85 07 __ STA $07
+1f07 : 90 0d __ BCC $1f16
+1f09 : 18 __ __ CLC
+1f0a : a5 05 __ LDA $05
+1f0c : 65 03 __ ADC $03
+1f0e : 85 05 __ STA $05
+1f10 : a5 06 __ LDA $06
+1f12 : 65 04 __ ADC $04
+1f14 : 85 06 __ STA $06
+1f16 : 06 03 __ ASL $03
+1f18 : 26 04 __ ROL $04
+1f1a : 46 07 __ LSR $07
+1f1c : b0 eb __ BCS $1f09
+1f1e : d0 f6 __ BNE $1f16
+1f20 : a5 05 __ LDA $05
+1f22 : 95 00 __ STA $00,x
+1f24 : a5 06 __ LDA $06
+1f26 : 95 01 __ STA $01,x
+1f28 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1f2b : b1 19 __ LDA (IP + 0),y
+1f2d : c8 __ __ INY
+1f2e : aa __ __ TAX
+1f2f : 18 __ __ CLC
+1f30 : b5 00 __ LDA $00,x
+1f32 : 71 19 __ ADC (IP + 0),y
+1f34 : 95 00 __ STA $00,x
+1f36 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+1f39 : b1 19 __ LDA (IP + 0),y
+1f3b : aa __ __ TAX
+1f3c : b5 00 __ LDA $00,x
+1f3e : 2c b1 19 BIT $19b1 ; (f32_to_i16 + 33)
+1f41 : 29 0f __ AND #$0f
+1f43 : f0 0b __ BEQ $1f50
+1f45 : aa __ __ TAX
+1f46 : a5 1c __ LDA ACCU + 1
+1f48 : 06 1b __ ASL ACCU + 0
+1f4a : 2a __ __ ROL
+1f4b : ca __ __ DEX
+1f4c : d0 fa __ BNE $1f48
+1f4e : 85 1c __ STA ACCU + 1
+1f50 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+1f53 : b1 19 __ LDA (IP + 0),y
+1f55 : aa __ __ TAX
+1f56 : b5 00 __ LDA $00,x
+1f58 : 2c b1 19 BIT $19b1 ; (f32_to_i16 + 33)
+1f5b : 29 0f __ AND #$0f
+1f5d : f0 0b __ BEQ $1f6a
+1f5f : aa __ __ TAX
+1f60 : a5 1c __ LDA ACCU + 1
+1f62 : 4a __ __ LSR
+1f63 : 66 1b __ ROR ACCU + 0
+1f65 : ca __ __ DEX
+1f66 : d0 fa __ BNE $1f62
+1f68 : 85 1c __ STA ACCU + 1
+1f6a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1f6d : b1 19 __ LDA (IP + 0),y
+1f6f : aa __ __ TAX
+1f70 : 38 __ __ SEC
+1f71 : b5 01 __ LDA $01,x
+1f73 : e5 1c __ SBC ACCU + 1
+1f75 : f0 11 __ BEQ $1f88
+1f77 : 50 02 __ BVC $1f7b
+1f79 : 49 80 __ EOR #$80
+1f7b : 30 2a __ BMI $1fa7
+1f7d : 10 33 __ BPL $1fb2
+1f7f : b1 19 __ LDA (IP + 0),y
+1f81 : aa __ __ TAX
+1f82 : b5 01 __ LDA $01,x
+1f84 : c5 1c __ CMP ACCU + 1
+1f86 : d0 28 __ BNE $1fb0
+1f88 : b5 00 __ LDA $00,x
+1f8a : c5 1b __ CMP ACCU + 0
+1f8c : d0 22 __ BNE $1fb0
+1f8e : f0 0e __ BEQ $1f9e
+1f90 : b1 19 __ LDA (IP + 0),y
+1f92 : aa __ __ TAX
+1f93 : c8 __ __ INY
+1f94 : b1 19 __ LDA (IP + 0),y
+1f96 : c5 1c __ CMP ACCU + 1
+1f98 : d0 16 __ BNE $1fb0
+1f9a : e4 1b __ CPX ACCU + 0
+1f9c : d0 12 __ BNE $1fb0
+1f9e : a9 00 __ LDA #$00
+1fa0 : 85 1b __ STA ACCU + 0
+1fa2 : 85 1c __ STA ACCU + 1
+1fa4 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fa7 : a9 ff __ LDA #$ff
+1fa9 : 85 1b __ STA ACCU + 0
+1fab : 85 1c __ STA ACCU + 1
+1fad : 4c 50 08 JMP $0850 ; (startup + 79)
+1fb0 : 90 f5 __ BCC $1fa7
+1fb2 : a9 01 __ LDA #$01
+1fb4 : 85 1b __ STA ACCU + 0
+1fb6 : a9 00 __ LDA #$00
+1fb8 : 85 1c __ STA ACCU + 1
+1fba : 4c 50 08 JMP $0850 ; (startup + 79)
+1fbd : b1 19 __ LDA (IP + 0),y
+1fbf : c8 __ __ INY
+1fc0 : aa __ __ TAX
+1fc1 : b1 19 __ LDA (IP + 0),y
+1fc3 : 38 __ __ SEC
+1fc4 : e5 1c __ SBC ACCU + 1
+1fc6 : d0 af __ BNE $1f77
+1fc8 : e4 1b __ CPX ACCU + 0
+1fca : d0 e4 __ BNE $1fb0
+1fcc : f0 d0 __ BEQ $1f9e
+1fce : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1fcf : b1 19 __ LDA (IP + 0),y
+1fd1 : aa __ __ TAX
+1fd2 : 38 __ __ SEC
+1fd3 : b5 00 __ LDA $00,x
+1fd5 : e5 1b __ SBC ACCU + 0
+1fd7 : f0 19 __ BEQ $1ff2
+1fd9 : 50 02 __ BVC $1fdd
+1fdb : 49 80 __ EOR #$80
+1fdd : 30 1c __ BMI $1ffb
+1fdf : 10 25 __ BPL $2006
+1fe1 : b1 19 __ LDA (IP + 0),y
+1fe3 : aa __ __ TAX
+1fe4 : b5 00 __ LDA $00,x
+1fe6 : c5 1b __ CMP ACCU + 0
+1fe8 : d0 1a __ BNE $2004
+1fea : f0 06 __ BEQ $1ff2
+1fec : b1 19 __ LDA (IP + 0),y
+1fee : c5 1b __ CMP ACCU + 0
+1ff0 : d0 12 __ BNE $2004
+1ff2 : a9 00 __ LDA #$00
+1ff4 : 85 1b __ STA ACCU + 0
+1ff6 : 85 1c __ STA ACCU + 1
+1ff8 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ffb : a9 ff __ LDA #$ff
+1ffd : 85 1b __ STA ACCU + 0
+1fff : 85 1c __ STA ACCU + 1
+2001 : 4c 50 08 JMP $0850 ; (startup + 79)
+2004 : 90 f5 __ BCC $1ffb
+2006 : a9 01 __ LDA #$01
+2008 : 85 1b __ STA ACCU + 0
+200a : a9 00 __ LDA #$00
+200c : 85 1c __ STA ACCU + 1
+200e : 4c 50 08 JMP $0850 ; (startup + 79)
+2011 : b1 19 __ LDA (IP + 0),y
+2013 : 38 __ __ SEC
+2014 : e5 1b __ SBC ACCU + 0
+2016 : d0 c1 __ BNE $1fd9
+2018 : f0 d8 __ BEQ $1ff2
+201a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+201b : 38 __ __ SEC
+201c : a9 00 __ LDA #$00
+201e : e5 1b __ SBC ACCU + 0
+2020 : 85 1b __ STA ACCU + 0
+2022 : a9 00 __ LDA #$00
+2024 : e5 1c __ SBC ACCU + 1
+2026 : 85 1c __ STA ACCU + 1
+2028 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+202b : 20 c6 16 JSR $16c6 ; (freg + 0)
+202e : 20 0b 17 JSR $170b ; (faddsub + 0)
+2031 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+2034 : 20 c6 16 JSR $16c6 ; (freg + 0)
+2037 : a5 06 __ LDA $06
+2039 : 49 80 __ EOR #$80
+203b : 85 06 __ STA $06
+203d : 20 0b 17 JSR $170b ; (faddsub + 0)
+2040 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+2043 : 20 c6 16 JSR $16c6 ; (freg + 0)
+2046 : 84 02 __ STY $02
+2048 : 20 d3 17 JSR $17d3 ; (fmul + 0)
+204b : a4 02 __ LDY $02
+204d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+2050 : 20 c6 16 JSR $16c6 ; (freg + 0)
+2053 : 20 71 18 JSR $1871 ; (fdiv + 0)
+2056 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+2059 : b1 19 __ LDA (IP + 0),y
+205b : c8 __ __ INY
+205c : aa __ __ TAX
+205d : a5 1e __ LDA ACCU + 3
+205f : 55 03 __ EOR $03,x
+2061 : 29 80 __ AND #$80
+2063 : f0 1e __ BEQ $2083
+2065 : a5 1e __ LDA ACCU + 3
+2067 : 29 7f __ AND #$7f
+2069 : 05 1d __ ORA ACCU + 2
+206b : 05 1c __ ORA ACCU + 1
+206d : 05 1b __ ORA ACCU + 0
+206f : d0 0c __ BNE $207d
+2071 : b5 03 __ LDA $03,x
+2073 : 29 7f __ AND #$7f
+2075 : 15 02 __ ORA $02,x
+2077 : 15 01 __ ORA $01,x
+2079 : 15 00 __ ORA $00,x
+207b : f0 1e __ BEQ $209b
+207d : a5 1e __ LDA ACCU + 3
+207f : 30 29 __ BMI $20aa
+2081 : 10 36 __ BPL $20b9
+2083 : a5 1e __ LDA ACCU + 3
+2085 : d5 03 __ CMP $03,x
+2087 : d0 1b __ BNE $20a4
+2089 : a5 1d __ LDA ACCU + 2
+208b : d5 02 __ CMP $02,x
+208d : d0 15 __ BNE $20a4
+208f : a5 1c __ LDA ACCU + 1
+2091 : d5 01 __ CMP $01,x
+2093 : d0 0f __ BNE $20a4
+2095 : a5 1b __ LDA ACCU + 0
+2097 : d5 00 __ CMP $00,x
+2099 : d0 09 __ BNE $20a4
+209b : a9 00 __ LDA #$00
+209d : 85 1b __ STA ACCU + 0
+209f : 85 1c __ STA ACCU + 1
+20a1 : 4c 51 08 JMP $0851 ; (startup + 80)
+20a4 : b0 0f __ BCS $20b5
+20a6 : 24 1e __ BIT ACCU + 3
+20a8 : 30 0f __ BMI $20b9
+20aa : a9 00 __ LDA #$00
+20ac : 85 1c __ STA ACCU + 1
+20ae : a9 01 __ LDA #$01
+20b0 : 85 1b __ STA ACCU + 0
+20b2 : 4c 51 08 JMP $0851 ; (startup + 80)
+20b5 : 24 1e __ BIT ACCU + 3
+20b7 : 30 f1 __ BMI $20aa
+20b9 : a9 ff __ LDA #$ff
+20bb : 85 1b __ STA ACCU + 0
+20bd : 85 1c __ STA ACCU + 1
+20bf : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+20c2 : a5 1e __ LDA ACCU + 3
+20c4 : 49 80 __ EOR #$80
+20c6 : 85 1e __ STA ACCU + 3
+20c8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+20cb : 20 d2 19 JSR $19d2 ; (sint16_to_float + 0)
+20ce : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+20d1 : 20 90 19 JSR $1990 ; (f32_to_i16 + 0)
+20d4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+20d7 : b1 19 __ LDA (IP + 0),y
+20d9 : 30 0c __ BMI $20e7
+20db : 38 __ __ SEC
+20dc : 65 19 __ ADC IP + 0
+20de : 85 19 __ STA IP + 0
+20e0 : 90 02 __ BCC $20e4
+20e2 : e6 1a __ INC IP + 1
+20e4 : 4c 51 08 JMP $0851 ; (startup + 80)
+20e7 : 38 __ __ SEC
+20e8 : 65 19 __ ADC IP + 0
+20ea : 85 19 __ STA IP + 0
+20ec : b0 02 __ BCS $20f0
+20ee : c6 1a __ DEC IP + 1
+20f0 : 4c 51 08 JMP $0851 ; (startup + 80)
+20f3 : a5 1b __ LDA ACCU + 0
+20f5 : 05 1c __ ORA ACCU + 1
+20f7 : f0 de __ BEQ $20d7
+20f9 : 4c 50 08 JMP $0850 ; (startup + 79)
+20fc : a5 1b __ LDA ACCU + 0
+20fe : 05 1c __ ORA ACCU + 1
+2100 : d0 d5 __ BNE $20d7
+2102 : 4c 50 08 JMP $0850 ; (startup + 79)
+2105 : a5 1c __ LDA ACCU + 1
+2107 : 30 04 __ BMI $210d
+2109 : 05 1b __ ORA ACCU + 0
+210b : d0 ca __ BNE $20d7
+210d : 4c 50 08 JMP $0850 ; (startup + 79)
+2110 : a5 1c __ LDA ACCU + 1
+2112 : 10 c3 __ BPL $20d7
+2114 : 4c 50 08 JMP $0850 ; (startup + 79)
+2117 : a5 1c __ LDA ACCU + 1
+2119 : 30 bc __ BMI $20d7
+211b : 4c 50 08 JMP $0850 ; (startup + 79)
+211e : a5 1c __ LDA ACCU + 1
+2120 : 30 b5 __ BMI $20d7
+2122 : 05 1b __ ORA ACCU + 0
+2124 : f0 b1 __ BEQ $20d7
+2126 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2129 : 38 __ __ SEC
+212a : b1 19 __ LDA (IP + 0),y
+212c : 65 19 __ ADC IP + 0
+212e : aa __ __ TAX
+212f : c8 __ __ INY
+2130 : b1 19 __ LDA (IP + 0),y
+2132 : 65 1a __ ADC IP + 1
+2134 : 85 1a __ STA IP + 1
+2136 : 86 19 __ STX IP + 0
+2138 : 4c 51 08 JMP $0851 ; (startup + 80)
+213b : a5 1b __ LDA ACCU + 0
+213d : 05 1c __ ORA ACCU + 1
+213f : f0 e8 __ BEQ $2129
+2141 : c8 __ __ INY
+2142 : 4c 50 08 JMP $0850 ; (startup + 79)
+2145 : a5 1b __ LDA ACCU + 0
+2147 : 05 1c __ ORA ACCU + 1
+2149 : d0 de __ BNE $2129
+214b : c8 __ __ INY
+214c : 4c 50 08 JMP $0850 ; (startup + 79)
+214f : a5 1c __ LDA ACCU + 1
+2151 : 30 04 __ BMI $2157
+2153 : 05 1b __ ORA ACCU + 0
+2155 : d0 d2 __ BNE $2129
+2157 : c8 __ __ INY
+2158 : 4c 50 08 JMP $0850 ; (startup + 79)
+215b : a5 1c __ LDA ACCU + 1
+215d : 10 ca __ BPL $2129
+215f : c8 __ __ INY
+2160 : 4c 50 08 JMP $0850 ; (startup + 79)
+2163 : a5 1c __ LDA ACCU + 1
+2165 : 30 c2 __ BMI $2129
+2167 : c8 __ __ INY
+2168 : 4c 50 08 JMP $0850 ; (startup + 79)
+216b : a5 1c __ LDA ACCU + 1
+216d : 30 ba __ BMI $2129
+216f : 05 1b __ ORA ACCU + 0
+2171 : f0 b6 __ BEQ $2129
+2173 : c8 __ __ INY
+2174 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2177 : a9 00 __ LDA #$00
+2179 : 2c a9 01 BIT $01a9 
+217c : 85 1b __ STA ACCU + 0
+217e : a9 00 __ LDA #$00
+2180 : 85 1c __ STA ACCU + 1
+2182 : 4c 51 08 JMP $0851 ; (startup + 80)
+2185 : a5 1b __ LDA ACCU + 0
+2187 : 05 1c __ ORA ACCU + 1
+2189 : f0 ef __ BEQ $217a
+218b : d0 ea __ BNE $2177
+218d : a5 1b __ LDA ACCU + 0
+218f : 05 1c __ ORA ACCU + 1
+2191 : d0 e7 __ BNE $217a
+2193 : f0 e2 __ BEQ $2177
+2195 : a5 1c __ LDA ACCU + 1
+2197 : 30 de __ BMI $2177
+2199 : 05 1b __ ORA ACCU + 0
+219b : d0 dd __ BNE $217a
+219d : f0 d8 __ BEQ $2177
+219f : a5 1c __ LDA ACCU + 1
+21a1 : 10 d7 __ BPL $217a
+21a3 : 30 d2 __ BMI $2177
+21a5 : a5 1c __ LDA ACCU + 1
+21a7 : 30 d1 __ BMI $217a
+21a9 : 10 cc __ BPL $2177
+21ab : a5 1c __ LDA ACCU + 1
+21ad : 30 cb __ BMI $217a
+21af : 05 1b __ ORA ACCU + 0
+21b1 : f0 c7 __ BEQ $217a
+21b3 : d0 c2 __ BNE $2177
+21b5 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+21b6 : b1 19 __ LDA (IP + 0),y
+21b8 : 8d cc 21 STA $21cc ; (inp_jsr + 22)
+21bb : c8 __ __ INY
+21bc : b1 19 __ LDA (IP + 0),y
+21be : 8d cd 21 STA $21cd ; (inp_jsr + 23)
+21c1 : 98 __ __ TYA
+21c2 : 38 __ __ SEC
+21c3 : 65 19 __ ADC IP + 0
+21c5 : 85 19 __ STA IP + 0
+21c7 : 90 02 __ BCC $21cb
+21c9 : e6 1a __ INC IP + 1
+21cb : 20 00 00 JSR $0000 
+21ce : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+21d1 : 98 __ __ TYA
+21d2 : 18 __ __ CLC
+21d3 : 65 19 __ ADC IP + 0
+21d5 : 8d e0 21 STA $21e0 ; (inp_native + 15)
+21d8 : a5 1a __ LDA IP + 1
+21da : 69 00 __ ADC #$00
+21dc : 8d e1 21 STA $21e1 ; (inp_native + 16)
+21df : 20 00 00 JSR $0000 
+21e2 : a0 00 __ LDY #$00
+21e4 : b1 23 __ LDA (SP + 0),y
+21e6 : 85 19 __ STA IP + 0
+21e8 : c8 __ __ INY
+21e9 : b1 23 __ LDA (SP + 0),y
+21eb : 85 1a __ STA IP + 1
+21ed : 88 __ __ DEY
+21ee : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+21f1 : 38 __ __ SEC
+21f2 : a5 23 __ LDA SP + 0
+21f4 : f1 19 __ SBC (IP + 0),y
+21f6 : c8 __ __ INY
+21f7 : 85 23 __ STA SP + 0
+21f9 : a5 24 __ LDA SP + 1
+21fb : f1 19 __ SBC (IP + 0),y
+21fd : c8 __ __ INY
+21fe : 85 24 __ STA SP + 1
+2200 : b1 19 __ LDA (IP + 0),y
+2202 : 84 02 __ STY $02
+2204 : a8 __ __ TAY
+2205 : a5 25 __ LDA FP + 0
+2207 : 91 23 __ STA (SP + 0),y
+2209 : c8 __ __ INY
+220a : a5 26 __ LDA FP + 1
+220c : 91 23 __ STA (SP + 0),y
+220e : 98 __ __ TYA
+220f : 38 __ __ SEC
+2210 : 65 23 __ ADC SP + 0
+2212 : 85 25 __ STA FP + 0
+2214 : a9 00 __ LDA #$00
+2216 : 65 24 __ ADC SP + 1
+2218 : 85 26 __ STA FP + 1
+221a : 88 __ __ DEY
+221b : f0 08 __ BEQ $2225
+221d : b9 52 00 LDA $0052,y 
+2220 : 88 __ __ DEY
+2221 : 91 23 __ STA (SP + 0),y
+2223 : d0 f8 __ BNE $221d
+2225 : a4 02 __ LDY $02
+2227 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+222a : b1 19 __ LDA (IP + 0),y
+222c : c8 __ __ INY
+222d : 84 02 __ STY $02
+222f : a8 __ __ TAY
+2230 : b1 23 __ LDA (SP + 0),y
+2232 : 85 25 __ STA FP + 0
+2234 : c8 __ __ INY
+2235 : b1 23 __ LDA (SP + 0),y
+2237 : 85 26 __ STA FP + 1
+2239 : 88 __ __ DEY
+223a : f0 09 __ BEQ $2245
+223c : 88 __ __ DEY
+223d : b1 23 __ LDA (SP + 0),y
+223f : 99 53 00 STA $0053,y 
+2242 : 88 __ __ DEY
+2243 : 10 f8 __ BPL $223d
+2245 : a4 02 __ LDY $02
+2247 : 18 __ __ CLC
+2248 : b1 19 __ LDA (IP + 0),y
+224a : c8 __ __ INY
+224b : 65 23 __ ADC SP + 0
+224d : 85 23 __ STA SP + 0
+224f : b1 19 __ LDA (IP + 0),y
+2251 : c8 __ __ INY
+2252 : 65 24 __ ADC SP + 1
+2254 : 85 24 __ STA SP + 1
+2256 : a0 01 __ LDY #$01
+2258 : b1 23 __ LDA (SP + 0),y
+225a : 85 1a __ STA IP + 1
+225c : 88 __ __ DEY
+225d : b1 23 __ LDA (SP + 0),y
+225f : 85 19 __ STA IP + 0
+2261 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+2264 : b1 19 __ LDA (IP + 0),y
+2266 : 85 1f __ STA ADDR + 0
+2268 : c8 __ __ INY
+2269 : b1 19 __ LDA (IP + 0),y
+226b : 85 20 __ STA ADDR + 1
+226d : c8 __ __ INY
+226e : 98 __ __ TYA
+226f : a0 00 __ LDY #$00
+2271 : 18 __ __ CLC
+2272 : 65 19 __ ADC IP + 0
+2274 : 91 23 __ STA (SP + 0),y
+2276 : c8 __ __ INY
+2277 : a5 1a __ LDA IP + 1
+2279 : 69 00 __ ADC #$00
+227b : 91 23 __ STA (SP + 0),y
+227d : a5 1f __ LDA ADDR + 0
+227f : 85 19 __ STA IP + 0
+2281 : a5 20 __ LDA ADDR + 1
+2283 : 85 1a __ STA IP + 1
+2285 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2288 : 38 __ __ SEC
+2289 : a5 23 __ LDA SP + 0
+228b : f1 19 __ SBC (IP + 0),y
+228d : c8 __ __ INY
+228e : 85 23 __ STA SP + 0
+2290 : a5 24 __ LDA SP + 1
+2292 : f1 19 __ SBC (IP + 0),y
+2294 : 85 24 __ STA SP + 1
+2296 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2299 : 18 __ __ CLC
+229a : b1 19 __ LDA (IP + 0),y
+229c : c8 __ __ INY
+229d : 65 23 __ ADC SP + 0
+229f : 85 23 __ STA SP + 0
+22a1 : b1 19 __ LDA (IP + 0),y
+22a3 : 65 24 __ ADC SP + 1
+22a5 : 85 24 __ STA SP + 1
+22a7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+22aa : b1 19 __ LDA (IP + 0),y
+22ac : 84 02 __ STY $02
+22ae : a8 __ __ TAY
+22af : 88 __ __ DEY
+22b0 : f0 07 __ BEQ $22b9
+22b2 : b1 1b __ LDA (ACCU + 0),y
+22b4 : 91 1f __ STA (ADDR + 0),y
+22b6 : 88 __ __ DEY
+22b7 : d0 f9 __ BNE $22b2
+22b9 : b1 1b __ LDA (ACCU + 0),y
+22bb : 91 1f __ STA (ADDR + 0),y
+22bd : a4 02 __ LDY $02
+22bf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+22c2 : b1 19 __ LDA (IP + 0),y
+22c4 : c8 __ __ INY
+22c5 : 8d d3 22 STA $22d3 ; (inp_op_extrt + 17)
+22c8 : b1 19 __ LDA (IP + 0),y
+22ca : c8 __ __ INY
+22cb : 8d d4 22 STA $22d4 ; (inp_op_extrt + 18)
+22ce : b1 19 __ LDA (IP + 0),y
+22d0 : c8 __ __ INY
+22d1 : aa __ __ TAX
+22d2 : 20 00 00 JSR $0000 
+22d5 : 4c 51 08 JMP $0851 ; (startup + 80)
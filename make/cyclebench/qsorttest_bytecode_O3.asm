@@ -0,0 +1,3239 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e f1 23 STX $23f1 ; (spentry + 0)
+0811 : a9 f4 __ LDA #$f4
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 52 __ LDA #$52
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 d4 __ LDA #$d4
+0832 : e9 f4 __ SBC #$f4
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	6, 20
+0a04:	PUSH	#$0008
+0a07:	LEA	T0, field + 0
+0a0b:	MOV	T1, #0
+0a0e:	LEA	T2, $170d
+0a12:	MOV	ADDR, T0
+0a14:	MOV	0(ADDR), T1
+0a17:	MOV	ACCU, T0
+0a19:	ADD	ACCU, #$0002
+0a1d:	MOV	2(SP), ACCU
+0a20:	MOV	4(SP), T2
+0a23:	MOV	6(SP), T1
+0a26:	CALL	sprintf + 0
+0a29:	ADD	T0, #$000C
+0a2d:	ADD	T1, #$0001
+0a31:	MOV	ACCU, T1
+0a33:	CMPS	ACCU, #$03E8
+0a36:	BGT	$0A12
+0a38:	LEA	T0, field + 0
+0a3c:	MOV	ACCU, T0
+0a3e:	MOV	T1, ACCU
+0a40:	ADD	ACCU, #$2EE0
+0a44:	MOV	T2, ACCU
+0a46:	LEA	T3, 0(FP)
+0a4a:	MOV	T5, seed + 0
+0a4e:	MOV	ACCU, T5
+0a50:	SHL	ACCU, #7
+0a52:	XOR	ACCU, T5
+0a54:	MOV	T5, ACCU
+0a56:	SHRU	ACCU, #9
+0a58:	XOR	ACCU, T5
+0a5a:	MOV	T5, ACCU
+0a5c:	SHL	ACCU, #8
+0a5e:	XOR	ACCU, T5
+0a60:	MOV	T5, ACCU
+0a62:	MOV	seed + 0, T5
+0a66:	MOV	ADDR, T3
+0a68:	MOV	ACCU, T1
+0a6a:	COPY	#12
+0a6c:	MOV	ACCU, T5
+0a6e:	MOV	ADDR, #$03e8
+0a72:	MODU	ACCU, ADDR
+0a74:	MUL	ACCU, #12
+0a77:	ADD	ACCU, T0
+0a79:	MOV	T5, ACCU
+0a7b:	MOV	ADDR, T1
+0a7d:	COPY	#12
+0a7f:	MOV	ADDR, T5
+0a81:	MOV	ACCU, T3
+0a83:	COPY	#12
+0a85:	ADD	T1, #$000C
+0a89:	MOV	ACCU, T2
+0a8b:	CMPU	ACCU, T1
+0a8d:	BLT	$0A4A
+0a8f:	LEA	T0, field + 0
+0a93:	MOV	2(SP), T0
+0a96:	MOV	ACCU, #$03e8
+0a9a:	MOV	4(SP), ACCU
+0a9d:	CALL	qsort + 0
+0aa0:	LEA	T0, field + 0
+0aa4:	MOV	T1, #0
+0aa7:	MOV	ADDR, T0
+0aa9:	MOV	T2, 0(ADDR)
+0aac:	MOV	ACCU, T1
+0aae:	CMPU	ACCU, T2
+0ab0:	BEQ	$0AB8
+0ab2:	MOV	P0, #-1
+0ab5:	CALL	exit + 0
+0ab8:	ADD	T0, #$000C
+0abc:	ADD	T1, #$0001
+0ac0:	MOV	ACCU, T1
+0ac2:	CMPS	ACCU, #$03E8
+0ac5:	BGT	$0AA7
+0ac7:	MOV	ACCU, #0
+0aca:	POP	#$0008
+0acd:	RETURN	6, 20
+--------------------------------------------------------------------
+sprintf:
+0ad1:	ENTER	18, 28
+0ad5:	PUSH	#$0002
+0ad8:	MOVB	T0, #0
+0adb:	MOV	T1, 12(FP)
+0ade:	MOV	ADDR, T1
+0ae0:	MOVB	T2, 0(ADDR)
+0ae3:	MOV	T3, 10(FP)
+0ae6:	MOVB	ACCU, T2
+0ae8:	BNE	$0B0E
+0aea:	MOVB	ACCU, T0
+0aec:	ADD	ACCU, T3
+0aee:	MOV	T1, ACCU
+0af0:	MOV	ACCU, #0
+0af3:	MOV	ADDR, T1
+0af5:	MOVB	0(ADDR), ACCU
+0af8:	MOVB	ACCU, T0
+0afa:	BNE	$0B00
+0afc:	MOV	ACCU, T3
+0afe:	MOV	T1, ACCU
+0b00:	MOV	T3, 10(FP)
+0b03:	MOV	ACCU, T1
+0b05:	SUB	ACCU, T3
+0b07:	POP	#$0002
+0b0a:	RETURN	18, 28
+0b0e:	LEA	T4, 14(FP)
+0b12:	ADD	T1, #$0001
+0b16:	MOVB	ACCU, T2
+0b18:	CMPUB	ACCU, #$0025
+0b1a:	BEQ	$0B4F
+0b1c:	MOVB	ACCU, T0
+0b1e:	LEAX	ADDR, T3 + ACCU
+0b20:	MOVB	0(ADDR), T2
+0b23:	ADDB	T0, #$0001
+0b26:	MOVB	ACCU, T0
+0b28:	CMPUB	ACCU, #$0028
+0b2a:	BLE	$0B37
+0b2c:	MOV	ADDR, T1
+0b2e:	MOVB	T5, 0(ADDR)
+0b31:	ADD	T1, #$0001
+0b35:	JUMP	$0B47
+0b37:	MOVB	ACCU, T0
+0b39:	ADD	T3, ACCU
+0b3b:	MOVB	T0, #0
+0b3e:	MOV	ADDR, T1
+0b40:	MOVB	T5, 0(ADDR)
+0b43:	ADD	T1, #$0001
+0b47:	MOVB	ACCU, T5
+0b49:	MOVB	T2, ACCU
+0b4b:	BNE	$0B16
+0b4d:	JUMP	$0AEA
+0b4f:	MOVB	ACCU, T0
+0b51:	BEQ	$0B5A
+0b53:	MOVB	ACCU, T0
+0b55:	ADD	T3, ACCU
+0b57:	MOVB	T0, #0
+0b5a:	MOV	ADDR, T1
+0b5c:	MOVB	T2, 0(ADDR)
+0b5f:	MOV	ACCU, #10
+0b62:	MOV	3(FP), ACCU
+0b65:	MOV	ACCU, #1
+0b68:	MOVB	1(FP), ACCU
+0b6b:	MOV	ACCU, #255
+0b6e:	MOVB	2(FP), ACCU
+0b71:	MOV	ACCU, #32
+0b74:	MOVB	0(FP), ACCU
+0b77:	MOV	ACCU, #0
+0b7a:	MOVB	5(FP), ACCU
+0b7d:	MOVB	6(FP), ACCU
+0b80:	MOVB	7(FP), ACCU
+0b83:	ADD	T1, #$0001
+0b87:	MOVB	ACCU, T2
+0b89:	CMPUB	ACCU, #$002B
+0b8b:	BEQF	$16FF
+0b8e:	MOVB	ACCU, T2
+0b90:	CMPUB	ACCU, #$0030
+0b92:	BEQF	$16F1
+0b95:	MOVB	ACCU, T2
+0b97:	CMPUB	ACCU, #$0023
+0b99:	BEQF	$16E3
+0b9c:	MOVB	ACCU, T2
+0b9e:	CMPUB	ACCU, #$0030
+0ba0:	BGT	$0BA9
+0ba2:	MOVB	ACCU, T2
+0ba4:	CMPUB	ACCU, #$0039
+0ba6:	BGEF	$16B2
+0ba9:	MOVB	ACCU, T2
+0bab:	CMPUB	ACCU, #$002E
+0bad:	BEQF	$1678
+0bb0:	MOVB	ACCU, T2
+0bb2:	CMPUB	ACCU, #$0064
+0bb4:	BEQF	$1550
+0bb7:	MOVB	ACCU, T2
+0bb9:	CMPUB	ACCU, #$0075
+0bbb:	BEQF	$1453
+0bbe:	MOVB	ACCU, T2
+0bc0:	CMPUB	ACCU, #$0078
+0bc2:	BEQF	$1350
+0bc5:	MOVB	ACCU, T2
+0bc7:	CMPUB	ACCU, #$006C
+0bc9:	BEQF	$0F73
+0bcc:	MOVB	ACCU, T2
+0bce:	CMPUB	ACCU, #$0066
+0bd0:	BEQF	$0C57
+0bd3:	MOVB	ACCU, T2
+0bd5:	CMPUB	ACCU, #$0067
+0bd7:	BEQ	$0C57
+0bd9:	MOVB	ACCU, T2
+0bdb:	CMPUB	ACCU, #$0065
+0bdd:	BEQ	$0C57
+0bdf:	MOVB	ACCU, T2
+0be1:	CMPUB	ACCU, #$0073
+0be3:	BEQ	$0C25
+0be5:	MOVB	ACCU, T2
+0be7:	CMPUB	ACCU, #$0063
+0be9:	BEQ	$0C06
+0beb:	MOVB	ACCU, T2
+0bed:	BEQF	$0B2C
+0bf0:	MOVB	ACCU, T0
+0bf2:	LEAX	ADDR, T3 + ACCU
+0bf4:	MOVB	0(ADDR), T2
+0bf7:	ADDB	T0, #$0001
+0bfa:	MOV	ADDR, T1
+0bfc:	MOVB	T5, 0(ADDR)
+0bff:	ADD	T1, #$0001
+0c03:	JUMPF	$0B47
+0c06:	MOVB	ACCU, T0
+0c08:	MOV	ADDR, T4
+0c0a:	MOV	T7, 0(ADDR)
+0c0d:	LEAX	ADDR, T3 + ACCU
+0c0f:	MOVB	0(ADDR), T7
+0c12:	ADD	T4, #$0002
+0c16:	ADDB	T0, #$0001
+0c19:	MOV	ADDR, T1
+0c1b:	MOVB	T5, 0(ADDR)
+0c1e:	ADD	T1, #$0001
+0c22:	JUMPF	$0B47
+0c25:	MOV	ADDR, T4
+0c27:	MOV	T6, 0(ADDR)
+0c2a:	ADD	T4, #$0002
+0c2e:	MOV	ADDR, T6
+0c30:	MOVB	T2, 0(ADDR)
+0c33:	MOVB	ACCU, T2
+0c35:	BEQF	$0B2C
+0c38:	ADD	T6, #$0001
+0c3c:	MOV	ADDR, T3
+0c3e:	MOVB	0(ADDR), T2
+0c41:	ADD	T3, #$0001
+0c45:	MOV	ADDR, T6
+0c47:	MOVB	T5, 0(ADDR)
+0c4a:	ADD	T6, #$0001
+0c4e:	MOVB	ACCU, T5
+0c50:	MOVB	T2, ACCU
+0c52:	BNE	$0C3C
+0c54:	JUMPF	$0B2C
+0c57:	MOV	ADDR, T4
+0c59:	MOVD	T11, 0(ADDR)
+0c5c:	MOVB	ACCU, T2
+0c5e:	MOVB	T0, ACCU
+0c60:	MOV	ACCU, T3
+0c62:	MOV	T6, ACCU
+0c64:	MOVD	ACCU, #$00000000
+0c6a:	CMPF	ACCU, T11
+0c6c:	BLTF	$0F60
+0c6f:	MOVB	T2, #0
+0c72:	MOVUB	ACCU, 5(FP)
+0c75:	BEQ	$0C82
+0c77:	MOV	ACCU, #43
+0c7a:	MOV	ADDR, T3
+0c7c:	MOVB	0(ADDR), ACCU
+0c7f:	MOVB	T2, #1
+0c82:	MOV	T7, #0
+0c85:	MOVB	T5, 2(FP)
+0c88:	MOVB	ACCU, T5
+0c8a:	CMPUB	ACCU, #$00FF
+0c8c:	BNE	$0C93
+0c8e:	MOVB	T5, #6
+0c91:	JUMP	$0C97
+0c93:	AND	T5, #$00FF
+0c97:	MOVD	ACCU, #$00000000
+0c9d:	CMPF	ACCU, T11
+0c9f:	BNEF	$0EF0
+0ca2:	MOVB	ACCU, T0
+0ca4:	CMPUB	ACCU, #$0065
+0ca6:	SEQ
+0ca7:	MOVB	T10, ACCU
+0ca9:	MOVB	T13, ACCU
+0cab:	MOVB	ACCU, T5
+0cad:	MOV	T8, ACCU
+0caf:	ADD	T8, #$0001
+0cb3:	MOVB	ACCU, T0
+0cb5:	CMPUB	ACCU, #$0067
+0cb7:	BEQF	$0EDF
+0cba:	MOVB	ACCU, T10
+0cbc:	BNEF	$0E95
+0cbf:	MOV	ACCU, T7
+0cc1:	BGE	$0CD7
+0cc3:	MOVD	ACCU, T11
+0cc5:	MOVD	$03, #$41200000
+0ccb:	DIVF	ACCU, $03
+0ccd:	MOVD	T11, ACCU
+0ccf:	ADD	T7, #$0001
+0cd3:	MOV	ACCU, T7
+0cd5:	BLT	$0CC3
+0cd7:	MOVD	T12, #$3f000000
+0cdd:	MOVB	ACCU, T5
+0cdf:	ADD	ACCU, T7
+0ce1:	MOV	T8, ACCU
+0ce3:	ADD	T8, #$0001
+0ce7:	MOVB	ACCU, T8
+0ce9:	CMPUB	ACCU, #$0001
+0ceb:	BLTF	$0E7A
+0cee:	MOVD	ACCU, T11
+0cf0:	ADDF	ACCU, T12
+0cf2:	MOVD	T11, ACCU
+0cf4:	MOVD	T12, ACCU
+0cf6:	MOVD	ACCU, #$41200000
+0cfc:	CMPF	ACCU, T11
+0cfe:	BLT	$0D0F
+0d00:	MOVD	ACCU, T11
+0d02:	MOVD	$03, #$41200000
+0d08:	DIVF	ACCU, $03
+0d0a:	MOVD	T12, ACCU
+0d0c:	ADDB	T5, #$00FF
+0d0f:	MOVB	ACCU, T8
+0d11:	MOV	T9, ACCU
+0d13:	MOVB	ACCU, T5
+0d15:	NEG	ACCU
+0d16:	ADD	ACCU, T9
+0d18:	MOV	T9, ACCU
+0d1a:	MOVB	T0, ACCU
+0d1c:	MOVB	ACCU, T8
+0d1e:	CMPUB	ACCU, #$0014
+0d20:	BGE	$0D25
+0d22:	MOVB	T8, #20
+0d25:	MOVB	ACCU, T9
+0d27:	BNE	$0D36
+0d29:	MOVB	ACCU, T2
+0d2b:	LEAX	ADDR, T6 + ACCU
+0d2d:	MOV	ACCU, #48
+0d30:	MOVB	0(ADDR), ACCU
+0d33:	ADDB	T2, #$0001
+0d36:	MOVB	T5, #0
+0d39:	MOVB	ACCU, T8
+0d3b:	BNEF	$0E36
+0d3e:	MOVB	ACCU, T13
+0d40:	BNE	$0DB9
+0d42:	MOVUB	ACCU, 1(FP)
+0d45:	CMPUB	ACCU, T2
+0d47:	BLT	$0D5D
+0d49:	MOVB	ACCU, T2
+0d4b:	MOVB	T0, ACCU
+0d4d:	ADD	T4, #$0004
+0d51:	MOV	ADDR, T1
+0d53:	MOVB	T5, 0(ADDR)
+0d56:	ADD	T1, #$0001
+0d5a:	JUMPF	$0B47
+0d5d:	MOVB	ACCU, T2
+0d5f:	CMPUB	ACCU, #$0001
+0d61:	BLE	$0D90
+0d63:	MOVB	T0, #0
+0d66:	MOVB	ACCU, T2
+0d68:	MOV	T7, ACCU
+0d6a:	MOVUB	ACCU, 1(FP)
+0d6d:	MOV	T8, ACCU
+0d6f:	SUB	ACCU, T7
+0d71:	MOV	T9, ACCU
+0d73:	MOVB	ACCU, T0
+0d75:	MOV	T14, ACCU
+0d77:	MOV	ACCU, T9
+0d79:	CMPU	ACCU, T14
+0d7b:	BLT	$0D81
+0d7d:	MOV	ACCU, T8
+0d7f:	JUMP	$0D4B
+0d81:	MOV	ACCU, T6
+0d83:	LEAX	ADDR, T14 + ACCU
+0d85:	MOV	ACCU, #32
+0d88:	MOVB	0(ADDR), ACCU
+0d8b:	ADDB	T0, #$0001
+0d8e:	JUMP	$0D6A
+0d90:	MOVB	T0, #1
+0d93:	MOVB	ACCU, T2
+0d95:	MOV	T7, ACCU
+0d97:	MOVB	ACCU, T0
+0d99:	MOV	T8, ACCU
+0d9b:	MOV	ACCU, T7
+0d9d:	SUB	ACCU, T8
+0d9f:	LEAX	ADDR, T6 + ACCU
+0da1:	MOVB	T5, 0(ADDR)
+0da4:	MOVUB	ACCU, 1(FP)
+0da7:	SUB	ACCU, T8
+0da9:	LEAX	ADDR, T6 + ACCU
+0dab:	MOVB	0(ADDR), T5
+0dae:	ADDB	T0, #$0001
+0db1:	MOVB	ACCU, T2
+0db3:	CMPUB	ACCU, T0
+0db5:	BLE	$0D97
+0db7:	JUMP	$0D63
+0db9:	MOVB	ACCU, T2
+0dbb:	LEAX	ADDR, T6 + ACCU
+0dbd:	MOV	ACCU, #69
+0dc0:	MOVB	0(ADDR), ACCU
+0dc3:	MOVB	ACCU, T2
+0dc5:	ADDB	ACCU, #$0001
+0dc8:	MOVB	T0, ACCU
+0dca:	MOV	ACCU, T7
+0dcc:	BLT	$0DE1
+0dce:	MOVB	ACCU, T0
+0dd0:	LEAX	ADDR, T6 + ACCU
+0dd2:	MOV	ACCU, #43
+0dd5:	MOVB	0(ADDR), ACCU
+0dd8:	MOVB	ACCU, T2
+0dda:	ADDB	ACCU, #$0002
+0ddd:	MOVB	T0, ACCU
+0ddf:	JUMP	$0DF7
+0de1:	MOVB	ACCU, T0
+0de3:	LEAX	ADDR, T6 + ACCU
+0de5:	MOV	ACCU, #45
+0de8:	MOVB	0(ADDR), ACCU
+0deb:	MOVB	ACCU, T2
+0ded:	ADDB	ACCU, #$0002
+0df0:	MOVB	T0, ACCU
+0df2:	MOV	ACCU, T7
+0df4:	NEG	ACCU
+0df5:	MOV	T7, ACCU
+0df7:	MOVB	ACCU, T0
+0df9:	ADD	ACCU, T6
+0dfb:	MOV	T8, ACCU
+0dfd:	MOV	ACCU, T7
+0dff:	MOV	ADDR, #10
+0e02:	DIVS	ACCU, ADDR
+0e04:	MOV	ADDR, T8
+0e06:	MOV	T9, ACCU
+0e08:	ADD	T9, #$0030
+0e0c:	MOVB	0(ADDR), T9
+0e0f:	MOVB	ACCU, T0
+0e11:	ADDB	ACCU, #$0001
+0e14:	MOVB	ACCU, ACCU
+0e16:	ADD	ACCU, T6
+0e18:	MOV	T8, ACCU
+0e1a:	MOV	ACCU, T7
+0e1c:	MOV	ADDR, #10
+0e1f:	MODS	ACCU, ADDR
+0e21:	MOV	ADDR, T8
+0e23:	MOV	T7, ACCU
+0e25:	ADD	T7, #$0030
+0e29:	MOVB	0(ADDR), T7
+0e2c:	MOVB	ACCU, T0
+0e2e:	ADDB	ACCU, #$0002
+0e31:	MOVB	T2, ACCU
+0e33:	JUMPF	$0D42
+0e36:	MOVB	ACCU, T0
+0e38:	CMPUB	ACCU, T5
+0e3a:	BNE	$0E49
+0e3c:	MOVB	ACCU, T2
+0e3e:	LEAX	ADDR, T6 + ACCU
+0e40:	MOV	ACCU, #46
+0e43:	MOVB	0(ADDR), ACCU
+0e46:	ADDB	T2, #$0001
+0e49:	MOVB	ACCU, T2
+0e4b:	LEAX	ADDR, T6 + ACCU
+0e4d:	MOVD	ACCU, T12
+0e4f:	CNVFS	ACCU
+0e50:	MOV	T14, ACCU
+0e52:	ADDB	ACCU, #$0030
+0e55:	MOVB	0(ADDR), ACCU
+0e58:	MOV	ACCU, T14
+0e5a:	CNVSF	ACCU
+0e5b:	MOVD	T11, ACCU
+0e5d:	MOVD	ACCU, T12
+0e5f:	SUBF	ACCU, T11
+0e61:	MOVD	$03, #$41200000
+0e67:	MULF	ACCU, $03
+0e69:	MOVD	T12, ACCU
+0e6b:	ADDB	T2, #$0001
+0e6e:	ADDB	T5, #$0001
+0e71:	MOVB	ACCU, T8
+0e73:	CMPUB	ACCU, T5
+0e75:	BLT	$0E36
+0e77:	JUMPF	$0D3E
+0e7a:	MOVB	T0, #1
+0e7d:	MOVD	ACCU, T12
+0e7f:	MOVD	$03, #$41200000
+0e85:	DIVF	ACCU, $03
+0e87:	MOVD	T12, ACCU
+0e89:	ADDB	T0, #$0001
+0e8c:	MOVB	ACCU, T8
+0e8e:	CMPUB	ACCU, T0
+0e90:	BLT	$0E7D
+0e92:	JUMPF	$0CEE
+0e95:	MOVD	T12, #$3f000000
+0e9b:	MOVB	ACCU, T5
+0e9d:	BNE	$0EC5
+0e9f:	MOVD	ACCU, T11
+0ea1:	ADDF	ACCU, T12
+0ea3:	MOVD	T11, ACCU
+0ea5:	MOVD	T12, ACCU
+0ea7:	MOVD	ACCU, #$41200000
+0ead:	CMPF	ACCU, T11
+0eaf:	BLTF	$0D0F
+0eb2:	MOVD	ACCU, T11
+0eb4:	MOVD	$03, #$41200000
+0eba:	DIVF	ACCU, $03
+0ebc:	MOVD	T12, ACCU
+0ebe:	ADD	T7, #$0001
+0ec2:	JUMPF	$0D0F
+0ec5:	MOVB	T0, #0
+0ec8:	MOVD	ACCU, T12
+0eca:	MOVD	$03, #$41200000
+0ed0:	DIVF	ACCU, $03
+0ed2:	MOVD	T12, ACCU
+0ed4:	ADDB	T0, #$0001
+0ed7:	MOVB	ACCU, T5
+0ed9:	CMPUB	ACCU, T0
+0edb:	BLT	$0EC8
+0edd:	JUMP	$0E9F
+0edf:	MOV	ACCU, T7
+0ee1:	CMPS	ACCU, #$0003
+0ee4:	BLT	$0EEB
+0ee6:	MOV	ACCU, T7
+0ee8:	BGEF	$0CBA
+0eeb:	MOVB	T13, #1
+0eee:	JUMP	$0E95
+0ef0:	MOVD	ACCU, #$447a0000
+0ef6:	CMPF	ACCU, T11
+0ef8:	BLT	$0F14
+0efa:	ADD	T7, #$0003
+0efe:	MOVD	ACCU, T11
+0f00:	MOVD	$03, #$447a0000
+0f06:	DIVF	ACCU, $03
+0f08:	MOVD	T11, ACCU
+0f0a:	MOVD	ACCU, #$447a0000
+0f10:	CMPF	ACCU, T11
+0f12:	BGE	$0EFA
+0f14:	MOVD	ACCU, #$3f800000
+0f1a:	CMPF	ACCU, T11
+0f1c:	BGE	$0F38
+0f1e:	ADD	T7, #$FFFD
+0f22:	MOVD	ACCU, T11
+0f24:	MOVD	$03, #$447a0000
+0f2a:	MULF	ACCU, $03
+0f2c:	MOVD	T11, ACCU
+0f2e:	MOVD	ACCU, #$3f800000
+0f34:	CMPF	ACCU, T11
+0f36:	BLT	$0F1E
+0f38:	MOVD	ACCU, #$41200000
+0f3e:	CMPF	ACCU, T11
+0f40:	BLTF	$0CA2
+0f43:	ADD	T7, #$0001
+0f47:	MOVD	ACCU, T11
+0f49:	MOVD	$03, #$41200000
+0f4f:	DIVF	ACCU, $03
+0f51:	MOVD	T11, ACCU
+0f53:	MOVD	ACCU, #$41200000
+0f59:	CMPF	ACCU, T11
+0f5b:	BGE	$0F43
+0f5d:	JUMPF	$0CA2
+0f60:	MOV	ACCU, #45
+0f63:	MOV	ADDR, T3
+0f65:	MOVB	0(ADDR), ACCU
+0f68:	MOVB	T2, #1
+0f6b:	MOVD	ACCU, T11
+0f6d:	NEGF	ACCU
+0f6e:	MOVD	T11, ACCU
+0f70:	JUMPF	$0C82
+0f73:	MOV	ADDR, T4
+0f75:	MOVD	T11, 0(ADDR)
+0f78:	ADD	T4, #$0004
+0f7c:	MOV	ADDR, T1
+0f7e:	MOVB	T2, 0(ADDR)
+0f81:	ADD	T1, #$0001
+0f85:	MOVB	ACCU, T2
+0f87:	CMPUB	ACCU, #$0064
+0f89:	BEQF	$11E4
+0f8c:	MOVB	ACCU, T2
+0f8e:	CMPUB	ACCU, #$0075
+0f90:	BEQF	$10C8
+0f93:	MOVB	ACCU, T2
+0f95:	CMPUB	ACCU, #$0078
+0f97:	BNEF	$0B2C
+0f9a:	MOV	ACCU, #16
+0f9d:	MOV	3(FP), ACCU
+0fa0:	MOV	ACCU, T3
+0fa2:	MOV	T6, ACCU
+0fa4:	MOVB	T0, #16
+0fa7:	MOVD	ACCU, #$00000000
+0fad:	EXTRT	T11, inp_op_cmp_u32 + 0
+0fb1:	BGTF	$1078
+0fb4:	MOVB	T2, 2(FP)
+0fb7:	MOVB	ACCU, T2
+0fb9:	CMPUB	ACCU, #$00FF
+0fbb:	BNEF	$1068
+0fbe:	MOVB	T2, #15
+0fc1:	MOVB	ACCU, T0
+0fc3:	CMPUB	ACCU, #$000F
+0fc5:	BGE	$0FDA
+0fc7:	ADDB	T0, #$00FF
+0fca:	MOVB	ACCU, T0
+0fcc:	LEAX	ADDR, T6 + ACCU
+0fce:	MOV	ACCU, #48
+0fd1:	MOVB	0(ADDR), ACCU
+0fd4:	MOVB	ACCU, T2
+0fd6:	CMPUB	ACCU, T0
+0fd8:	BGT	$0FC7
+0fda:	MOVUB	ACCU, 7(FP)
+0fdd:	BEQ	$1003
+0fdf:	MOV	ACCU, 3(FP)
+0fe2:	CMPU	ACCU, #$0010
+0fe5:	BNE	$1003
+0fe7:	MOVB	ACCU, T0
+0fe9:	ADDB	ACCU, #$00FF
+0fec:	MOVB	ACCU, ACCU
+0fee:	LEAX	ADDR, T6 + ACCU
+0ff0:	MOV	ACCU, #88
+0ff3:	MOVB	0(ADDR), ACCU
+0ff6:	ADDB	T0, #$00FE
+0ff9:	MOVB	ACCU, T0
+0ffb:	LEAX	ADDR, T6 + ACCU
+0ffd:	MOV	ACCU, #48
+1000:	MOVB	0(ADDR), ACCU
+1003:	MOVUB	ACCU, 5(FP)
+1006:	BEQ	$1015
+1008:	ADDB	T0, #$00FF
+100b:	MOVB	ACCU, T0
+100d:	LEAX	ADDR, T6 + ACCU
+100f:	MOV	ACCU, #43
+1012:	MOVB	0(ADDR), ACCU
+1015:	MOVUB	T7, 1(FP)
+1018:	SUBR	T7, #$0010
+101c:	MOVB	ACCU, T0
+101e:	MOV	T8, ACCU
+1020:	MOV	ACCU, T7
+1022:	CMPS	ACCU, T8
+1024:	BGT	$1059
+1026:	MOVB	T2, #0
+1029:	MOVB	ACCU, T0
+102b:	CMPUB	ACCU, #$0010
+102d:	BLE	$1049
+102f:	MOVB	ACCU, T0
+1031:	LEAX	ADDR, T6 + ACCU
+1033:	MOVB	T5, 0(ADDR)
+1036:	MOVB	ACCU, T2
+1038:	LEAX	ADDR, T6 + ACCU
+103a:	MOVB	0(ADDR), T5
+103d:	ADDB	T2, #$0001
+1040:	ADDB	T0, #$0001
+1043:	MOVB	ACCU, T0
+1045:	CMPUB	ACCU, #$0010
+1047:	BGT	$102F
+1049:	MOV	ADDR, T1
+104b:	MOVB	T5, 0(ADDR)
+104e:	ADD	T1, #$0001
+1052:	MOVB	ACCU, T2
+1054:	MOV	T0, ACCU
+1056:	JUMPF	$0B47
+1059:	ADDB	T0, #$00FF
+105c:	MOVB	ACCU, T0
+105e:	LEAX	ADDR, T6 + ACCU
+1060:	MOVB	T2, 0(FP)
+1063:	MOVB	0(ADDR), T2
+1066:	JUMP	$1015
+1068:	MOVB	ACCU, T2
+106a:	SUBR	ACCU, #$0010
+106e:	MOV	T2, ACCU
+1070:	CMPUB	ACCU, T0
+1072:	BGTF	$0FC7
+1075:	JUMPF	$0FDA
+1078:	MOV	ACCU, 3(FP)
+107b:	EXTRT	$00, inp_op_ext_u16 + 0
+107f:	MOVD	T12, ACCU
+1081:	MOVD	ACCU, T11
+1083:	EXTRT	T12, inp_binop_mod_u32 + 0
+1087:	MOVD	T12, ACCU
+1089:	CMPS	ACCU, #$000A
+108c:	BLE	$1096
+108e:	MOV	ACCU, T12
+1090:	ADD	ACCU, #$0030
+1094:	JUMP	$109C
+1096:	MOV	ACCU, T12
+1098:	ADD	ACCU, #$0037
+109c:	MOV	T7, ACCU
+109e:	ADDB	T0, #$00FF
+10a1:	MOVB	ACCU, T0
+10a3:	LEAX	ADDR, T6 + ACCU
+10a5:	MOVB	0(ADDR), T7
+10a8:	MOV	ACCU, 3(FP)
+10ab:	EXTRT	$00, inp_op_ext_u16 + 0
+10af:	MOVD	T12, ACCU
+10b1:	MOVD	ACCU, T11
+10b3:	EXTRT	T12, inp_binop_div_u32 + 0
+10b7:	MOVD	T11, ACCU
+10b9:	MOVD	ACCU, #$00000000
+10bf:	EXTRT	T11, inp_op_cmp_u32 + 0
+10c3:	BGT	$1078
+10c5:	JUMPF	$0FB4
+10c8:	MOV	ACCU, T3
+10ca:	MOV	T6, ACCU
+10cc:	MOVB	T0, #16
+10cf:	MOVD	ACCU, #$00000000
+10d5:	EXTRT	T11, inp_op_cmp_u32 + 0
+10d9:	BGTF	$1194
+10dc:	MOVB	T2, 2(FP)
+10df:	MOVB	ACCU, T2
+10e1:	CMPUB	ACCU, #$00FF
+10e3:	BNEF	$1184
+10e6:	MOVB	T2, #15
+10e9:	MOVB	ACCU, T0
+10eb:	CMPUB	ACCU, #$000F
+10ed:	BGE	$1102
+10ef:	ADDB	T0, #$00FF
+10f2:	MOVB	ACCU, T0
+10f4:	LEAX	ADDR, T6 + ACCU
+10f6:	MOV	ACCU, #48
+10f9:	MOVB	0(ADDR), ACCU
+10fc:	MOVB	ACCU, T2
+10fe:	CMPUB	ACCU, T0
+1100:	BGT	$10EF
+1102:	MOVUB	ACCU, 7(FP)
+1105:	BEQ	$112B
+1107:	MOV	ACCU, 3(FP)
+110a:	CMPU	ACCU, #$0010
+110d:	BNE	$112B
+110f:	MOVB	ACCU, T0
+1111:	ADDB	ACCU, #$00FF
+1114:	MOVB	ACCU, ACCU
+1116:	LEAX	ADDR, T6 + ACCU
+1118:	MOV	ACCU, #88
+111b:	MOVB	0(ADDR), ACCU
+111e:	ADDB	T0, #$00FE
+1121:	MOVB	ACCU, T0
+1123:	LEAX	ADDR, T6 + ACCU
+1125:	MOV	ACCU, #48
+1128:	MOVB	0(ADDR), ACCU
+112b:	MOVUB	ACCU, 5(FP)
+112e:	BEQ	$113D
+1130:	ADDB	T0, #$00FF
+1133:	MOVB	ACCU, T0
+1135:	LEAX	ADDR, T6 + ACCU
+1137:	MOV	ACCU, #43
+113a:	MOVB	0(ADDR), ACCU
+113d:	MOVUB	T7, 1(FP)
+1140:	SUBR	T7, #$0010
+1144:	MOVB	ACCU, T0
+1146:	MOV	T8, ACCU
+1148:	MOV	ACCU, T7
+114a:	CMPS	ACCU, T8
+114c:	BGT	$1175
+114e:	MOVB	T2, #0
+1151:	MOVB	ACCU, T0
+1153:	CMPUB	ACCU, #$0010
+1155:	BLEF	$1049
+1158:	MOVB	ACCU, T0
+115a:	LEAX	ADDR, T6 + ACCU
+115c:	MOVB	T5, 0(ADDR)
+115f:	MOVB	ACCU, T2
+1161:	LEAX	ADDR, T6 + ACCU
+1163:	MOVB	0(ADDR), T5
+1166:	ADDB	T2, #$0001
+1169:	ADDB	T0, #$0001
+116c:	MOVB	ACCU, T0
+116e:	CMPUB	ACCU, #$0010
+1170:	BGT	$1158
+1172:	JUMPF	$1049
+1175:	ADDB	T0, #$00FF
+1178:	MOVB	ACCU, T0
+117a:	LEAX	ADDR, T6 + ACCU
+117c:	MOVB	T2, 0(FP)
+117f:	MOVB	0(ADDR), T2
+1182:	JUMP	$113D
+1184:	MOVB	ACCU, T2
+1186:	SUBR	ACCU, #$0010
+118a:	MOV	T2, ACCU
+118c:	CMPUB	ACCU, T0
+118e:	BGTF	$10EF
+1191:	JUMPF	$1102
+1194:	MOV	ACCU, 3(FP)
+1197:	EXTRT	$00, inp_op_ext_u16 + 0
+119b:	MOVD	T12, ACCU
+119d:	MOVD	ACCU, T11
+119f:	EXTRT	T12, inp_binop_mod_u32 + 0
+11a3:	MOVD	T12, ACCU
+11a5:	CMPS	ACCU, #$000A
+11a8:	BLE	$11B2
+11aa:	MOV	ACCU, T12
+11ac:	ADD	ACCU, #$0030
+11b0:	JUMP	$11B8
+11b2:	MOV	ACCU, T12
+11b4:	ADD	ACCU, #$0037
+11b8:	MOV	T7, ACCU
+11ba:	ADDB	T0, #$00FF
+11bd:	MOVB	ACCU, T0
+11bf:	LEAX	ADDR, T6 + ACCU
+11c1:	MOVB	0(ADDR), T7
+11c4:	MOV	ACCU, 3(FP)
+11c7:	EXTRT	$00, inp_op_ext_u16 + 0
+11cb:	MOVD	T12, ACCU
+11cd:	MOVD	ACCU, T11
+11cf:	EXTRT	T12, inp_binop_div_u32 + 0
+11d3:	MOVD	T11, ACCU
+11d5:	MOVD	ACCU, #$00000000
+11db:	EXTRT	T11, inp_op_cmp_u32 + 0
+11df:	BGT	$1194
+11e1:	JUMPF	$10DC
+11e4:	MOV	ACCU, T3
+11e6:	MOV	T6, ACCU
+11e8:	MOVD	ACCU, #$00000000
+11ee:	EXTRT	T11, inp_op_cmp_s32 + 0
+11f2:	BLTF	$1333
+11f5:	MOVD	ACCU, T11
+11f7:	MOVD	T12, ACCU
+11f9:	MOVB	T0, #0
+11fc:	MOVB	T2, #16
+11ff:	MOVD	ACCU, #$00000000
+1205:	EXTRT	T11, inp_op_cmp_u32 + 0
+1209:	BGTF	$12E3
+120c:	MOVB	T5, 2(FP)
+120f:	MOVB	ACCU, T5
+1211:	CMPUB	ACCU, #$00FF
+1213:	BNEF	$12D3
+1216:	MOVB	T5, #15
+1219:	MOVB	ACCU, T2
+121b:	CMPUB	ACCU, #$000F
+121d:	BGE	$1232
+121f:	ADDB	T2, #$00FF
+1222:	MOVB	ACCU, T2
+1224:	LEAX	ADDR, T6 + ACCU
+1226:	MOV	ACCU, #48
+1229:	MOVB	0(ADDR), ACCU
+122c:	MOVB	ACCU, T5
+122e:	CMPUB	ACCU, T2
+1230:	BGT	$121F
+1232:	MOVUB	ACCU, 7(FP)
+1235:	BEQ	$125B
+1237:	MOV	ACCU, 3(FP)
+123a:	CMPU	ACCU, #$0010
+123d:	BNE	$125B
+123f:	MOVB	ACCU, T2
+1241:	ADDB	ACCU, #$00FF
+1244:	MOVB	ACCU, ACCU
+1246:	LEAX	ADDR, T6 + ACCU
+1248:	MOV	ACCU, #88
+124b:	MOVB	0(ADDR), ACCU
+124e:	ADDB	T2, #$00FE
+1251:	MOVB	ACCU, T2
+1253:	LEAX	ADDR, T6 + ACCU
+1255:	MOV	ACCU, #48
+1258:	MOVB	0(ADDR), ACCU
+125b:	MOVB	ACCU, T0
+125d:	BNE	$12C4
+125f:	MOVUB	ACCU, 5(FP)
+1262:	BEQ	$1271
+1264:	ADDB	T2, #$00FF
+1267:	MOVB	ACCU, T2
+1269:	LEAX	ADDR, T6 + ACCU
+126b:	MOV	ACCU, #43
+126e:	MOVB	0(ADDR), ACCU
+1271:	MOVUB	T7, 1(FP)
+1274:	SUBR	T7, #$0010
+1278:	MOVB	ACCU, T2
+127a:	MOV	T8, ACCU
+127c:	MOV	ACCU, T7
+127e:	CMPS	ACCU, T8
+1280:	BGT	$12B5
+1282:	MOVB	T0, #0
+1285:	MOVB	ACCU, T2
+1287:	CMPUB	ACCU, #$0010
+1289:	BLE	$12A5
+128b:	MOVB	ACCU, T2
+128d:	LEAX	ADDR, T6 + ACCU
+128f:	MOVB	T5, 0(ADDR)
+1292:	MOVB	ACCU, T0
+1294:	LEAX	ADDR, T6 + ACCU
+1296:	MOVB	0(ADDR), T5
+1299:	ADDB	T0, #$0001
+129c:	ADDB	T2, #$0001
+129f:	MOVB	ACCU, T2
+12a1:	CMPUB	ACCU, #$0010
+12a3:	BGT	$128B
+12a5:	MOV	ADDR, T1
+12a7:	MOVB	T5, 0(ADDR)
+12aa:	ADD	T1, #$0001
+12ae:	AND	T0, #$00FF
+12b2:	JUMPF	$0B47
+12b5:	ADDB	T2, #$00FF
+12b8:	MOVB	ACCU, T2
+12ba:	LEAX	ADDR, T6 + ACCU
+12bc:	MOVB	T0, 0(FP)
+12bf:	MOVB	0(ADDR), T0
+12c2:	JUMP	$1271
+12c4:	ADDB	T2, #$00FF
+12c7:	MOVB	ACCU, T2
+12c9:	LEAX	ADDR, T6 + ACCU
+12cb:	MOV	ACCU, #45
+12ce:	MOVB	0(ADDR), ACCU
+12d1:	JUMP	$1271
+12d3:	MOVB	ACCU, T5
+12d5:	SUBR	ACCU, #$0010
+12d9:	MOV	T5, ACCU
+12db:	CMPUB	ACCU, T2
+12dd:	BGTF	$121F
+12e0:	JUMPF	$1232
+12e3:	MOV	ACCU, 3(FP)
+12e6:	EXTRT	$00, inp_op_ext_u16 + 0
+12ea:	MOVD	T11, ACCU
+12ec:	MOVD	ACCU, T12
+12ee:	EXTRT	T11, inp_binop_mod_u32 + 0
+12f2:	MOVD	T11, ACCU
+12f4:	CMPS	ACCU, #$000A
+12f7:	BLE	$1301
+12f9:	MOV	ACCU, T11
+12fb:	ADD	ACCU, #$0030
+12ff:	JUMP	$1307
+1301:	MOV	ACCU, T11
+1303:	ADD	ACCU, #$0037
+1307:	MOV	T7, ACCU
+1309:	ADDB	T2, #$00FF
+130c:	MOVB	ACCU, T2
+130e:	LEAX	ADDR, T6 + ACCU
+1310:	MOVB	0(ADDR), T7
+1313:	MOV	ACCU, 3(FP)
+1316:	EXTRT	$00, inp_op_ext_u16 + 0
+131a:	MOVD	T11, ACCU
+131c:	MOVD	ACCU, T12
+131e:	EXTRT	T11, inp_binop_div_u32 + 0
+1322:	MOVD	T12, ACCU
+1324:	MOVD	ACCU, #$00000000
+132a:	EXTRT	T12, inp_op_cmp_u32 + 0
+132e:	BGT	$12E3
+1330:	JUMPF	$120C
+1333:	MOVB	T0, #1
+1336:	MOVB	T2, #16
+1339:	MOVD	ACCU, T11
+133b:	EXTRT	$00, negaccu32 + 0
+133f:	MOVD	T12, ACCU
+1341:	MOVD	ACCU, #$00000000
+1347:	EXTRT	T12, inp_op_cmp_u32 + 0
+134b:	BGT	$12E3
+134d:	JUMPF	$120C
+1350:	MOV	ACCU, #16
+1353:	MOV	3(FP), ACCU
+1356:	MOV	ACCU, T3
+1358:	MOV	T6, ACCU
+135a:	MOV	ADDR, T4
+135c:	MOV	T7, 0(ADDR)
+135f:	ADD	T4, #$0002
+1363:	MOVB	T0, #10
+1366:	MOV	ACCU, T7
+1368:	BNEF	$1423
+136b:	MOVB	T2, 2(FP)
+136e:	MOVB	ACCU, T2
+1370:	CMPUB	ACCU, #$00FF
+1372:	BNEF	$1413
+1375:	MOVB	T2, #9
+1378:	MOVB	ACCU, T0
+137a:	CMPUB	ACCU, #$0009
+137c:	BGE	$1391
+137e:	ADDB	T0, #$00FF
+1381:	MOVB	ACCU, T0
+1383:	LEAX	ADDR, T6 + ACCU
+1385:	MOV	ACCU, #48
+1388:	MOVB	0(ADDR), ACCU
+138b:	MOVB	ACCU, T2
+138d:	CMPUB	ACCU, T0
+138f:	BGT	$137E
+1391:	MOVUB	ACCU, 7(FP)
+1394:	BEQ	$13BA
+1396:	MOV	ACCU, 3(FP)
+1399:	CMPU	ACCU, #$0010
+139c:	BNE	$13BA
+139e:	MOVB	ACCU, T0
+13a0:	ADDB	ACCU, #$00FF
+13a3:	MOVB	ACCU, ACCU
+13a5:	LEAX	ADDR, T6 + ACCU
+13a7:	MOV	ACCU, #88
+13aa:	MOVB	0(ADDR), ACCU
+13ad:	ADDB	T0, #$00FE
+13b0:	MOVB	ACCU, T0
+13b2:	LEAX	ADDR, T6 + ACCU
+13b4:	MOV	ACCU, #48
+13b7:	MOVB	0(ADDR), ACCU
+13ba:	MOVUB	ACCU, 5(FP)
+13bd:	BEQ	$13CC
+13bf:	ADDB	T0, #$00FF
+13c2:	MOVB	ACCU, T0
+13c4:	LEAX	ADDR, T6 + ACCU
+13c6:	MOV	ACCU, #43
+13c9:	MOVB	0(ADDR), ACCU
+13cc:	MOVUB	T7, 1(FP)
+13cf:	SUBR	T7, #$000A
+13d3:	MOVB	ACCU, T0
+13d5:	MOV	T8, ACCU
+13d7:	MOV	ACCU, T7
+13d9:	CMPS	ACCU, T8
+13db:	BGT	$1404
+13dd:	MOVB	T2, #0
+13e0:	MOVB	ACCU, T0
+13e2:	CMPUB	ACCU, #$000A
+13e4:	BLEF	$1049
+13e7:	MOVB	ACCU, T0
+13e9:	LEAX	ADDR, T6 + ACCU
+13eb:	MOVB	T5, 0(ADDR)
+13ee:	MOVB	ACCU, T2
+13f0:	LEAX	ADDR, T6 + ACCU
+13f2:	MOVB	0(ADDR), T5
+13f5:	ADDB	T2, #$0001
+13f8:	ADDB	T0, #$0001
+13fb:	MOVB	ACCU, T0
+13fd:	CMPUB	ACCU, #$000A
+13ff:	BGT	$13E7
+1401:	JUMPF	$1049
+1404:	ADDB	T0, #$00FF
+1407:	MOVB	ACCU, T0
+1409:	LEAX	ADDR, T6 + ACCU
+140b:	MOVB	T2, 0(FP)
+140e:	MOVB	0(ADDR), T2
+1411:	JUMP	$13CC
+1413:	MOVB	ACCU, T2
+1415:	SUBR	ACCU, #$000A
+1419:	MOV	T2, ACCU
+141b:	CMPUB	ACCU, T0
+141d:	BGTF	$137E
+1420:	JUMPF	$1391
+1423:	MOV	T8, 3(FP)
+1426:	MOV	ACCU, T7
+1428:	MODU	ACCU, T8
+142a:	MOV	T8, ACCU
+142c:	CMPS	ACCU, #$000A
+142f:	BLE	$1437
+1431:	ADD	T8, #$0030
+1435:	JUMP	$143B
+1437:	ADD	T8, #$0037
+143b:	ADDB	T0, #$00FF
+143e:	MOVB	ACCU, T0
+1440:	LEAX	ADDR, T6 + ACCU
+1442:	MOVB	0(ADDR), T8
+1445:	MOV	T8, 3(FP)
+1448:	MOV	ACCU, T7
+144a:	DIVU	ACCU, T8
+144c:	MOV	T7, ACCU
+144e:	BNE	$1423
+1450:	JUMPF	$136B
+1453:	MOV	ACCU, T3
+1455:	MOV	T6, ACCU
+1457:	MOV	ADDR, T4
+1459:	MOV	T7, 0(ADDR)
+145c:	ADD	T4, #$0002
+1460:	MOVB	T0, #10
+1463:	MOV	ACCU, T7
+1465:	BNEF	$1520
+1468:	MOVB	T2, 2(FP)
+146b:	MOVB	ACCU, T2
+146d:	CMPUB	ACCU, #$00FF
+146f:	BNEF	$1510
+1472:	MOVB	T2, #9
+1475:	MOVB	ACCU, T0
+1477:	CMPUB	ACCU, #$0009
+1479:	BGE	$148E
+147b:	ADDB	T0, #$00FF
+147e:	MOVB	ACCU, T0
+1480:	LEAX	ADDR, T6 + ACCU
+1482:	MOV	ACCU, #48
+1485:	MOVB	0(ADDR), ACCU
+1488:	MOVB	ACCU, T2
+148a:	CMPUB	ACCU, T0
+148c:	BGT	$147B
+148e:	MOVUB	ACCU, 7(FP)
+1491:	BEQ	$14B7
+1493:	MOV	ACCU, 3(FP)
+1496:	CMPU	ACCU, #$0010
+1499:	BNE	$14B7
+149b:	MOVB	ACCU, T0
+149d:	ADDB	ACCU, #$00FF
+14a0:	MOVB	ACCU, ACCU
+14a2:	LEAX	ADDR, T6 + ACCU
+14a4:	MOV	ACCU, #88
+14a7:	MOVB	0(ADDR), ACCU
+14aa:	ADDB	T0, #$00FE
+14ad:	MOVB	ACCU, T0
+14af:	LEAX	ADDR, T6 + ACCU
+14b1:	MOV	ACCU, #48
+14b4:	MOVB	0(ADDR), ACCU
+14b7:	MOVUB	ACCU, 5(FP)
+14ba:	BEQ	$14C9
+14bc:	ADDB	T0, #$00FF
+14bf:	MOVB	ACCU, T0
+14c1:	LEAX	ADDR, T6 + ACCU
+14c3:	MOV	ACCU, #43
+14c6:	MOVB	0(ADDR), ACCU
+14c9:	MOVUB	T7, 1(FP)
+14cc:	SUBR	T7, #$000A
+14d0:	MOVB	ACCU, T0
+14d2:	MOV	T8, ACCU
+14d4:	MOV	ACCU, T7
+14d6:	CMPS	ACCU, T8
+14d8:	BGT	$1501
+14da:	MOVB	T2, #0
+14dd:	MOVB	ACCU, T0
+14df:	CMPUB	ACCU, #$000A
+14e1:	BLEF	$1049
+14e4:	MOVB	ACCU, T0
+14e6:	LEAX	ADDR, T6 + ACCU
+14e8:	MOVB	T5, 0(ADDR)
+14eb:	MOVB	ACCU, T2
+14ed:	LEAX	ADDR, T6 + ACCU
+14ef:	MOVB	0(ADDR), T5
+14f2:	ADDB	T2, #$0001
+14f5:	ADDB	T0, #$0001
+14f8:	MOVB	ACCU, T0
+14fa:	CMPUB	ACCU, #$000A
+14fc:	BGT	$14E4
+14fe:	JUMPF	$1049
+1501:	ADDB	T0, #$00FF
+1504:	MOVB	ACCU, T0
+1506:	LEAX	ADDR, T6 + ACCU
+1508:	MOVB	T2, 0(FP)
+150b:	MOVB	0(ADDR), T2
+150e:	JUMP	$14C9
+1510:	MOVB	ACCU, T2
+1512:	SUBR	ACCU, #$000A
+1516:	MOV	T2, ACCU
+1518:	CMPUB	ACCU, T0
+151a:	BGTF	$147B
+151d:	JUMPF	$148E
+1520:	MOV	T8, 3(FP)
+1523:	MOV	ACCU, T7
+1525:	MODU	ACCU, T8
+1527:	MOV	T8, ACCU
+1529:	CMPS	ACCU, #$000A
+152c:	BLE	$1534
+152e:	ADD	T8, #$0030
+1532:	JUMP	$1538
+1534:	ADD	T8, #$0037
+1538:	ADDB	T0, #$00FF
+153b:	MOVB	ACCU, T0
+153d:	LEAX	ADDR, T6 + ACCU
+153f:	MOVB	0(ADDR), T8
+1542:	MOV	T8, 3(FP)
+1545:	MOV	ACCU, T7
+1547:	DIVU	ACCU, T8
+1549:	MOV	T7, ACCU
+154b:	BNE	$1520
+154d:	JUMPF	$1468
+1550:	MOV	ACCU, T3
+1552:	MOV	T6, ACCU
+1554:	MOV	ADDR, T4
+1556:	MOV	T7, 0(ADDR)
+1559:	ADD	T4, #$0002
+155d:	MOV	ACCU, T7
+155f:	BLTF	$166A
+1562:	MOV	T8, ACCU
+1564:	MOVB	T0, #0
+1567:	MOVB	T2, #10
+156a:	MOV	ACCU, T7
+156c:	BNEF	$163A
+156f:	MOVB	T5, 2(FP)
+1572:	MOVB	ACCU, T5
+1574:	CMPUB	ACCU, #$00FF
+1576:	BNEF	$162A
+1579:	MOVB	T5, #9
+157c:	MOVB	ACCU, T2
+157e:	CMPUB	ACCU, #$0009
+1580:	BGE	$1595
+1582:	ADDB	T2, #$00FF
+1585:	MOVB	ACCU, T2
+1587:	LEAX	ADDR, T6 + ACCU
+1589:	MOV	ACCU, #48
+158c:	MOVB	0(ADDR), ACCU
+158f:	MOVB	ACCU, T5
+1591:	CMPUB	ACCU, T2
+1593:	BGT	$1582
+1595:	MOVUB	ACCU, 7(FP)
+1598:	BEQ	$15BE
+159a:	MOV	ACCU, 3(FP)
+159d:	CMPU	ACCU, #$0010
+15a0:	BNE	$15BE
+15a2:	MOVB	ACCU, T2
+15a4:	ADDB	ACCU, #$00FF
+15a7:	MOVB	ACCU, ACCU
+15a9:	LEAX	ADDR, T6 + ACCU
+15ab:	MOV	ACCU, #88
+15ae:	MOVB	0(ADDR), ACCU
+15b1:	ADDB	T2, #$00FE
+15b4:	MOVB	ACCU, T2
+15b6:	LEAX	ADDR, T6 + ACCU
+15b8:	MOV	ACCU, #48
+15bb:	MOVB	0(ADDR), ACCU
+15be:	MOVB	ACCU, T0
+15c0:	BNE	$161B
+15c2:	MOVUB	ACCU, 5(FP)
+15c5:	BEQ	$15D4
+15c7:	ADDB	T2, #$00FF
+15ca:	MOVB	ACCU, T2
+15cc:	LEAX	ADDR, T6 + ACCU
+15ce:	MOV	ACCU, #43
+15d1:	MOVB	0(ADDR), ACCU
+15d4:	MOVUB	T7, 1(FP)
+15d7:	SUBR	T7, #$000A
+15db:	MOVB	ACCU, T2
+15dd:	MOV	T8, ACCU
+15df:	MOV	ACCU, T7
+15e1:	CMPS	ACCU, T8
+15e3:	BGT	$160C
+15e5:	MOVB	T0, #0
+15e8:	MOVB	ACCU, T2
+15ea:	CMPUB	ACCU, #$000A
+15ec:	BLEF	$12A5
+15ef:	MOVB	ACCU, T2
+15f1:	LEAX	ADDR, T6 + ACCU
+15f3:	MOVB	T5, 0(ADDR)
+15f6:	MOVB	ACCU, T0
+15f8:	LEAX	ADDR, T6 + ACCU
+15fa:	MOVB	0(ADDR), T5
+15fd:	ADDB	T0, #$0001
+1600:	ADDB	T2, #$0001
+1603:	MOVB	ACCU, T2
+1605:	CMPUB	ACCU, #$000A
+1607:	BGT	$15EF
+1609:	JUMPF	$12A5
+160c:	ADDB	T2, #$00FF
+160f:	MOVB	ACCU, T2
+1611:	LEAX	ADDR, T6 + ACCU
+1613:	MOVB	T0, 0(FP)
+1616:	MOVB	0(ADDR), T0
+1619:	JUMP	$15D4
+161b:	ADDB	T2, #$00FF
+161e:	MOVB	ACCU, T2
+1620:	LEAX	ADDR, T6 + ACCU
+1622:	MOV	ACCU, #45
+1625:	MOVB	0(ADDR), ACCU
+1628:	JUMP	$15D4
+162a:	MOVB	ACCU, T5
+162c:	SUBR	ACCU, #$000A
+1630:	MOV	T5, ACCU
+1632:	CMPUB	ACCU, T2
+1634:	BGTF	$1582
+1637:	JUMPF	$1595
+163a:	MOV	T7, 3(FP)
+163d:	MOV	ACCU, T8
+163f:	MODU	ACCU, T7
+1641:	MOV	T7, ACCU
+1643:	CMPS	ACCU, #$000A
+1646:	BLE	$164E
+1648:	ADD	T7, #$0030
+164c:	JUMP	$1652
+164e:	ADD	T7, #$0037
+1652:	ADDB	T2, #$00FF
+1655:	MOVB	ACCU, T2
+1657:	LEAX	ADDR, T6 + ACCU
+1659:	MOVB	0(ADDR), T7
+165c:	MOV	T7, 3(FP)
+165f:	MOV	ACCU, T8
+1661:	DIVU	ACCU, T7
+1663:	MOV	T8, ACCU
+1665:	BNE	$163A
+1667:	JUMPF	$156F
+166a:	MOVB	T0, #1
+166d:	MOVB	T2, #10
+1670:	NEG	ACCU
+1671:	MOV	T8, ACCU
+1673:	BNE	$163A
+1675:	JUMPF	$156F
+1678:	MOV	T6, #0
+167b:	MOV	ADDR, T1
+167d:	MOVB	T2, 0(ADDR)
+1680:	ADD	T1, #$0001
+1684:	MOVB	ACCU, T2
+1686:	CMPUB	ACCU, #$0030
+1688:	BGT	$16AC
+168a:	MOVB	ACCU, T2
+168c:	CMPUB	ACCU, #$0039
+168e:	BLT	$16AC
+1690:	MOVB	ACCU, T2
+1692:	MOV	T7, ACCU
+1694:	MOV	ADDR, T1
+1696:	MOVB	T2, 0(ADDR)
+1699:	ADD	T1, #$0001
+169d:	MUL	T6, #10
+16a0:	ADD	T6, ACCU
+16a2:	ADD	T6, #$FFD0
+16a6:	MOVB	ACCU, T2
+16a8:	CMPUB	ACCU, #$0030
+16aa:	BLE	$168A
+16ac:	MOVB	2(FP), T6
+16af:	JUMPF	$0BB0
+16b2:	MOV	T6, #0
+16b5:	MOVB	ACCU, T2
+16b7:	CMPUB	ACCU, #$0030
+16b9:	BGT	$16DD
+16bb:	MOVB	ACCU, T2
+16bd:	CMPUB	ACCU, #$0039
+16bf:	BLT	$16DD
+16c1:	MOVB	ACCU, T2
+16c3:	MOV	T7, ACCU
+16c5:	MOV	ADDR, T1
+16c7:	MOVB	T2, 0(ADDR)
+16ca:	ADD	T1, #$0001
+16ce:	MUL	T6, #10
+16d1:	ADD	T6, ACCU
+16d3:	ADD	T6, #$FFD0
+16d7:	MOVB	ACCU, T2
+16d9:	CMPUB	ACCU, #$0030
+16db:	BLE	$16BB
+16dd:	MOVB	1(FP), T6
+16e0:	JUMPF	$0BA9
+16e3:	MOV	ACCU, #1
+16e6:	MOVB	7(FP), ACCU
+16e9:	MOV	ADDR, T1
+16eb:	MOVB	T2, 0(ADDR)
+16ee:	JUMPF	$0B83
+16f1:	MOV	ACCU, #48
+16f4:	MOVB	0(FP), ACCU
+16f7:	MOV	ADDR, T1
+16f9:	MOVB	T2, 0(ADDR)
+16fc:	JUMPF	$0B83
+16ff:	MOV	ACCU, #1
+1702:	MOVB	5(FP), ACCU
+1705:	MOV	ADDR, T1
+1707:	MOVB	T2, 0(ADDR)
+170a:	JUMPF	$0B83
+--------------------------------------------------------------------
+qsort:
+1712:	ENTER	4, 20
+1716:	PUSH	#$0006
+1719:	MOV	T0, 18(FP)
+171c:	MOV	ACCU, T0
+171e:	CMPS	ACCU, #$0001
+1721:	BLT	$172A
+1723:	POP	#$0006
+1726:	RETURN	4, 20
+172a:	LEA	ADDR, 0(FP)
+172e:	MOV	ACCU, 16(FP)
+1731:	COPY	#12
+1733:	MOV	T2, #0
+1736:	MOV	ACCU, T0
+1738:	CMPS	ACCU, #$0001
+173b:	BLT	$1778
+173d:	MOV	T0, 16(FP)
+1740:	MOV	ACCU, T2
+1742:	MUL	ACCU, #12
+1745:	LEAX	ADDR, T0 + ACCU
+1747:	LEA	ACCU, 0(FP)
+174b:	COPY	#12
+174d:	MOV	2(SP), T0
+1750:	MOV	4(SP), T2
+1753:	CALL	qsort + 0
+1756:	MOV	T0, 16(FP)
+1759:	MOV	ACCU, T2
+175b:	MUL	ACCU, #12
+175e:	ADD	ACCU, T0
+1760:	ADD	ACCU, #$000C
+1764:	MOV	2(SP), ACCU
+1767:	MOV	ACCU, 18(FP)
+176a:	SUB	ACCU, T2
+176c:	ADD	ACCU, #$FFFF
+1770:	MOV	4(SP), ACCU
+1773:	CALL	qsort + 0
+1776:	JUMP	$1723
+1778:	MOV	T0, #1
+177b:	MOV	T3, 16(FP)
+177e:	MOV	ACCU, T0
+1780:	MUL	ACCU, #12
+1783:	ADD	ACCU, T3
+1785:	ADD	ACCU, #$0002
+1789:	MOV	P0, ACCU
+178b:	LEA	P2, 2(FP)
+178f:	JSR	strcmp + 0
+1792:	BGE	$17BB
+1794:	MOV	T3, 16(FP)
+1797:	MOV	ACCU, T2
+1799:	MUL	ACCU, #12
+179c:	ADD	ACCU, T3
+179e:	MOV	T4, ACCU
+17a0:	MOV	ACCU, T0
+17a2:	MUL	ACCU, #12
+17a5:	ADD	ACCU, T3
+17a7:	MOV	T3, ACCU
+17a9:	MOV	ADDR, T4
+17ab:	COPY	#12
+17ad:	MOV	ADDR, T3
+17af:	ADD	T4, #$000C
+17b3:	MOV	ACCU, T4
+17b5:	COPY	#12
+17b7:	ADD	T2, #$0001
+17bb:	MOV	T3, 18(FP)
+17be:	ADD	T0, #$0001
+17c2:	MOV	ACCU, T3
+17c4:	CMPS	ACCU, T0
+17c6:	BLT	$177B
+17c8:	JUMPF	$173D
+--------------------------------------------------------------------
+strcmp:
+17cb : ea __ __ NOP
+17cc : a0 00 __ LDY #$00
+17ce : 84 1c __ STY ACCU + 1
+17d0 : b1 0d __ LDA (P0),y
+17d2 : f0 16 __ BEQ $17ea
+17d4 : d1 0f __ CMP (P2),y
+17d6 : d0 16 __ BNE $17ee
+17d8 : c8 __ __ INY
+17d9 : b1 0d __ LDA (P0),y
+17db : f0 0d __ BEQ $17ea
+17dd : d1 0f __ CMP (P2),y
+17df : d0 0d __ BNE $17ee
+17e1 : c8 __ __ INY
+17e2 : d0 ec __ BNE $17d0
+17e4 : e6 0e __ INC P1
+17e6 : e6 10 __ INC P3
+17e8 : d0 e6 __ BNE $17d0
+17ea : d1 0f __ CMP (P2),y
+17ec : f0 0a __ BEQ $17f8
+17ee : b0 06 __ BCS $17f6
+17f0 : a9 ff __ LDA #$ff
+17f2 : 85 1c __ STA ACCU + 1
+17f4 : 30 02 __ BMI $17f8
+17f6 : a9 01 __ LDA #$01
+17f8 : 85 1b __ STA ACCU + 0
+17fa : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+17fb:	ENTER	0, 2
+17ff:	JSR	$1806
+1802:	RETURN	0, 2
+--------------------------------------------------------------------
+1806 : a5 0d __ LDA P0
+1808 : 85 1b __ STA ACCU + 0
+180a : a5 0e __ LDA P1
+180c : 85 1c __ STA ACCU + 1
+180e : ae f1 23 LDX $23f1 ; (spentry + 0)
+1811 : 9a __ __ TXS
+1812 : a9 4c __ LDA #$4c
+1814 : 85 54 __ STA $54
+1816 : a9 00 __ LDA #$00
+1818 : 85 13 __ STA P6
+181a : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+181b : b1 19 __ LDA (IP + 0),y
+181d : c8 __ __ INY
+181e : aa __ __ TAX
+181f : b5 00 __ LDA $00,x
+1821 : 85 03 __ STA $03
+1823 : b5 01 __ LDA $01,x
+1825 : 85 04 __ STA $04
+1827 : b5 02 __ LDA $02,x
+1829 : 85 05 __ STA $05
+182b : b5 03 __ LDA $03,x
+182d : 85 06 __ STA $06
+182f : a5 05 __ LDA $05
+1831 : 0a __ __ ASL
+1832 : a5 06 __ LDA $06
+1834 : 2a __ __ ROL
+1835 : 85 08 __ STA $08
+1837 : f0 06 __ BEQ $183f
+1839 : a5 05 __ LDA $05
+183b : 09 80 __ ORA #$80
+183d : 85 05 __ STA $05
+183f : a5 1d __ LDA ACCU + 2
+1841 : 0a __ __ ASL
+1842 : a5 1e __ LDA ACCU + 3
+1844 : 2a __ __ ROL
+1845 : 85 07 __ STA $07
+1847 : f0 06 __ BEQ $184f
+1849 : a5 1d __ LDA ACCU + 2
+184b : 09 80 __ ORA #$80
+184d : 85 1d __ STA ACCU + 2
+184f : 60 __ __ RTS
+1850 : 06 1e __ ASL ACCU + 3
+1852 : a5 07 __ LDA $07
+1854 : 6a __ __ ROR
+1855 : 85 1e __ STA ACCU + 3
+1857 : b0 06 __ BCS $185f
+1859 : a5 1d __ LDA ACCU + 2
+185b : 29 7f __ AND #$7f
+185d : 85 1d __ STA ACCU + 2
+185f : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1860 : 38 __ __ SEC
+1861 : a5 07 __ LDA $07
+1863 : e5 08 __ SBC $08
+1865 : f0 38 __ BEQ $189f
+1867 : aa __ __ TAX
+1868 : b0 25 __ BCS $188f
+186a : e0 e9 __ CPX #$e9
+186c : b0 0e __ BCS $187c
+186e : a5 08 __ LDA $08
+1870 : 85 07 __ STA $07
+1872 : a9 00 __ LDA #$00
+1874 : 85 1b __ STA ACCU + 0
+1876 : 85 1c __ STA ACCU + 1
+1878 : 85 1d __ STA ACCU + 2
+187a : f0 23 __ BEQ $189f
+187c : a5 1d __ LDA ACCU + 2
+187e : 4a __ __ LSR
+187f : 66 1c __ ROR ACCU + 1
+1881 : 66 1b __ ROR ACCU + 0
+1883 : e8 __ __ INX
+1884 : d0 f8 __ BNE $187e
+1886 : 85 1d __ STA ACCU + 2
+1888 : a5 08 __ LDA $08
+188a : 85 07 __ STA $07
+188c : 4c 9f 18 JMP $189f ; (faddsub + 63)
+188f : e0 18 __ CPX #$18
+1891 : b0 33 __ BCS $18c6
+1893 : a5 05 __ LDA $05
+1895 : 4a __ __ LSR
+1896 : 66 04 __ ROR $04
+1898 : 66 03 __ ROR $03
+189a : ca __ __ DEX
+189b : d0 f8 __ BNE $1895
+189d : 85 05 __ STA $05
+189f : a5 1e __ LDA ACCU + 3
+18a1 : 29 80 __ AND #$80
+18a3 : 85 1e __ STA ACCU + 3
+18a5 : 45 06 __ EOR $06
+18a7 : 30 2d __ BMI $18d6
+18a9 : 18 __ __ CLC
+18aa : a5 1b __ LDA ACCU + 0
+18ac : 65 03 __ ADC $03
+18ae : 85 1b __ STA ACCU + 0
+18b0 : a5 1c __ LDA ACCU + 1
+18b2 : 65 04 __ ADC $04
+18b4 : 85 1c __ STA ACCU + 1
+18b6 : a5 1d __ LDA ACCU + 2
+18b8 : 65 05 __ ADC $05
+18ba : 85 1d __ STA ACCU + 2
+18bc : 90 08 __ BCC $18c6
+18be : 66 1d __ ROR ACCU + 2
+18c0 : 66 1c __ ROR ACCU + 1
+18c2 : 66 1b __ ROR ACCU + 0
+18c4 : e6 07 __ INC $07
+18c6 : a5 07 __ LDA $07
+18c8 : 4a __ __ LSR
+18c9 : 05 1e __ ORA ACCU + 3
+18cb : 85 1e __ STA ACCU + 3
+18cd : b0 06 __ BCS $18d5
+18cf : a5 1d __ LDA ACCU + 2
+18d1 : 29 7f __ AND #$7f
+18d3 : 85 1d __ STA ACCU + 2
+18d5 : 60 __ __ RTS
+18d6 : 38 __ __ SEC
+18d7 : a5 1b __ LDA ACCU + 0
+18d9 : e5 03 __ SBC $03
+18db : 85 1b __ STA ACCU + 0
+18dd : a5 1c __ LDA ACCU + 1
+18df : e5 04 __ SBC $04
+18e1 : 85 1c __ STA ACCU + 1
+18e3 : a5 1d __ LDA ACCU + 2
+18e5 : e5 05 __ SBC $05
+18e7 : 85 1d __ STA ACCU + 2
+18e9 : b0 19 __ BCS $1904
+18eb : 38 __ __ SEC
+18ec : a9 00 __ LDA #$00
+18ee : e5 1b __ SBC ACCU + 0
+18f0 : 85 1b __ STA ACCU + 0
+18f2 : a9 00 __ LDA #$00
+18f4 : e5 1c __ SBC ACCU + 1
+18f6 : 85 1c __ STA ACCU + 1
+18f8 : a9 00 __ LDA #$00
+18fa : e5 1d __ SBC ACCU + 2
+18fc : 85 1d __ STA ACCU + 2
+18fe : a5 1e __ LDA ACCU + 3
+1900 : 49 80 __ EOR #$80
+1902 : 85 1e __ STA ACCU + 3
+1904 : a5 1d __ LDA ACCU + 2
+1906 : 30 be __ BMI $18c6
+1908 : 05 1c __ ORA ACCU + 1
+190a : 05 1b __ ORA ACCU + 0
+190c : f0 0f __ BEQ $191d
+190e : c6 07 __ DEC $07
+1910 : f0 0b __ BEQ $191d
+1912 : 06 1b __ ASL ACCU + 0
+1914 : 26 1c __ ROL ACCU + 1
+1916 : 26 1d __ ROL ACCU + 2
+1918 : 10 f4 __ BPL $190e
+191a : 4c c6 18 JMP $18c6 ; (faddsub + 102)
+191d : a9 00 __ LDA #$00
+191f : 85 1b __ STA ACCU + 0
+1921 : 85 1c __ STA ACCU + 1
+1923 : 85 1d __ STA ACCU + 2
+1925 : 85 1e __ STA ACCU + 3
+1927 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1928 : a5 1b __ LDA ACCU + 0
+192a : 05 1c __ ORA ACCU + 1
+192c : 05 1d __ ORA ACCU + 2
+192e : d0 03 __ BNE $1933
+1930 : 85 1e __ STA ACCU + 3
+1932 : 60 __ __ RTS
+1933 : a5 03 __ LDA $03
+1935 : 05 04 __ ORA $04
+1937 : 05 05 __ ORA $05
+1939 : d0 09 __ BNE $1944
+193b : 85 1b __ STA ACCU + 0
+193d : 85 1c __ STA ACCU + 1
+193f : 85 1d __ STA ACCU + 2
+1941 : 85 1e __ STA ACCU + 3
+1943 : 60 __ __ RTS
+1944 : a9 00 __ LDA #$00
+1946 : 85 09 __ STA $09
+1948 : 85 0a __ STA $0a
+194a : 85 0b __ STA $0b
+194c : a4 1b __ LDY ACCU + 0
+194e : a5 03 __ LDA $03
+1950 : d0 06 __ BNE $1958
+1952 : a5 04 __ LDA $04
+1954 : f0 0a __ BEQ $1960
+1956 : d0 05 __ BNE $195d
+1958 : 20 98 19 JSR $1998 ; (fmul8 + 0)
+195b : a5 04 __ LDA $04
+195d : 20 98 19 JSR $1998 ; (fmul8 + 0)
+1960 : a5 05 __ LDA $05
+1962 : 20 98 19 JSR $1998 ; (fmul8 + 0)
+1965 : 38 __ __ SEC
+1966 : a5 0b __ LDA $0b
+1968 : 30 06 __ BMI $1970
+196a : 06 09 __ ASL $09
+196c : 26 0a __ ROL $0a
+196e : 2a __ __ ROL
+196f : 18 __ __ CLC
+1970 : 29 7f __ AND #$7f
+1972 : 85 0b __ STA $0b
+1974 : a5 1e __ LDA ACCU + 3
+1976 : 45 06 __ EOR $06
+1978 : 29 80 __ AND #$80
+197a : 85 1e __ STA ACCU + 3
+197c : a5 07 __ LDA $07
+197e : e9 7e __ SBC #$7e
+1980 : 18 __ __ CLC
+1981 : 65 08 __ ADC $08
+1983 : 4a __ __ LSR
+1984 : 05 1e __ ORA ACCU + 3
+1986 : 85 1e __ STA ACCU + 3
+1988 : a9 00 __ LDA #$00
+198a : 6a __ __ ROR
+198b : 05 0b __ ORA $0b
+198d : 85 1d __ STA ACCU + 2
+198f : a5 0a __ LDA $0a
+1991 : 85 1c __ STA ACCU + 1
+1993 : a5 09 __ LDA $09
+1995 : 85 1b __ STA ACCU + 0
+1997 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1998 : 38 __ __ SEC
+1999 : 6a __ __ ROR
+199a : 90 1e __ BCC $19ba
+199c : aa __ __ TAX
+199d : 18 __ __ CLC
+199e : 98 __ __ TYA
+199f : 65 09 __ ADC $09
+19a1 : 85 09 __ STA $09
+19a3 : a5 0a __ LDA $0a
+19a5 : 65 1c __ ADC ACCU + 1
+19a7 : 85 0a __ STA $0a
+19a9 : a5 0b __ LDA $0b
+19ab : 65 1d __ ADC ACCU + 2
+19ad : 6a __ __ ROR
+19ae : 85 0b __ STA $0b
+19b0 : 8a __ __ TXA
+19b1 : 66 0a __ ROR $0a
+19b3 : 66 09 __ ROR $09
+19b5 : 4a __ __ LSR
+19b6 : f0 0d __ BEQ $19c5
+19b8 : b0 e2 __ BCS $199c
+19ba : 66 0b __ ROR $0b
+19bc : 66 0a __ ROR $0a
+19be : 66 09 __ ROR $09
+19c0 : 4a __ __ LSR
+19c1 : 90 f7 __ BCC $19ba
+19c3 : d0 d7 __ BNE $199c
+19c5 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+19c6 : a5 1b __ LDA ACCU + 0
+19c8 : 05 1c __ ORA ACCU + 1
+19ca : 05 1d __ ORA ACCU + 2
+19cc : d0 03 __ BNE $19d1
+19ce : 85 1e __ STA ACCU + 3
+19d0 : 60 __ __ RTS
+19d1 : a5 1e __ LDA ACCU + 3
+19d3 : 45 06 __ EOR $06
+19d5 : 29 80 __ AND #$80
+19d7 : 85 1e __ STA ACCU + 3
+19d9 : a9 00 __ LDA #$00
+19db : 85 09 __ STA $09
+19dd : 85 0a __ STA $0a
+19df : 85 0b __ STA $0b
+19e1 : a2 18 __ LDX #$18
+19e3 : a5 1b __ LDA ACCU + 0
+19e5 : c5 03 __ CMP $03
+19e7 : a5 1c __ LDA ACCU + 1
+19e9 : e5 04 __ SBC $04
+19eb : a5 1d __ LDA ACCU + 2
+19ed : e5 05 __ SBC $05
+19ef : 90 13 __ BCC $1a04
+19f1 : a5 1b __ LDA ACCU + 0
+19f3 : e5 03 __ SBC $03
+19f5 : 85 1b __ STA ACCU + 0
+19f7 : a5 1c __ LDA ACCU + 1
+19f9 : e5 04 __ SBC $04
+19fb : 85 1c __ STA ACCU + 1
+19fd : a5 1d __ LDA ACCU + 2
+19ff : e5 05 __ SBC $05
+1a01 : 85 1d __ STA ACCU + 2
+1a03 : 38 __ __ SEC
+1a04 : 26 09 __ ROL $09
+1a06 : 26 0a __ ROL $0a
+1a08 : 26 0b __ ROL $0b
+1a0a : ca __ __ DEX
+1a0b : f0 0a __ BEQ $1a17
+1a0d : 06 1b __ ASL ACCU + 0
+1a0f : 26 1c __ ROL ACCU + 1
+1a11 : 26 1d __ ROL ACCU + 2
+1a13 : b0 dc __ BCS $19f1
+1a15 : 90 cc __ BCC $19e3
+1a17 : 38 __ __ SEC
+1a18 : a5 0b __ LDA $0b
+1a1a : 30 06 __ BMI $1a22
+1a1c : 06 09 __ ASL $09
+1a1e : 26 0a __ ROL $0a
+1a20 : 2a __ __ ROL
+1a21 : 18 __ __ CLC
+1a22 : 29 7f __ AND #$7f
+1a24 : 85 0b __ STA $0b
+1a26 : a5 08 __ LDA $08
+1a28 : 49 7f __ EOR #$7f
+1a2a : 65 07 __ ADC $07
+1a2c : 38 __ __ SEC
+1a2d : e9 01 __ SBC #$01
+1a2f : 4a __ __ LSR
+1a30 : 05 1e __ ORA ACCU + 3
+1a32 : 85 1e __ STA ACCU + 3
+1a34 : a9 00 __ LDA #$00
+1a36 : 6a __ __ ROR
+1a37 : 05 0b __ ORA $0b
+1a39 : 85 1d __ STA ACCU + 2
+1a3b : a5 0a __ LDA $0a
+1a3d : 85 1c __ STA ACCU + 1
+1a3f : a5 09 __ LDA $09
+1a41 : 85 1b __ STA ACCU + 0
+1a43 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+1a44 : 38 __ __ SEC
+1a45 : a9 00 __ LDA #$00
+1a47 : e5 1b __ SBC ACCU + 0
+1a49 : 85 1b __ STA ACCU + 0
+1a4b : a9 00 __ LDA #$00
+1a4d : e5 1c __ SBC ACCU + 1
+1a4f : 85 1c __ STA ACCU + 1
+1a51 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1a52 : 38 __ __ SEC
+1a53 : a9 00 __ LDA #$00
+1a55 : e5 03 __ SBC $03
+1a57 : 85 03 __ STA $03
+1a59 : a9 00 __ LDA #$00
+1a5b : e5 04 __ SBC $04
+1a5d : 85 04 __ STA $04
+1a5f : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1a60 : a5 1c __ LDA ACCU + 1
+1a62 : d0 31 __ BNE $1a95
+1a64 : a5 04 __ LDA $04
+1a66 : d0 1e __ BNE $1a86
+1a68 : 85 06 __ STA $06
+1a6a : a2 04 __ LDX #$04
+1a6c : 06 1b __ ASL ACCU + 0
+1a6e : 2a __ __ ROL
+1a6f : c5 03 __ CMP $03
+1a71 : 90 02 __ BCC $1a75
+1a73 : e5 03 __ SBC $03
+1a75 : 26 1b __ ROL ACCU + 0
+1a77 : 2a __ __ ROL
+1a78 : c5 03 __ CMP $03
+1a7a : 90 02 __ BCC $1a7e
+1a7c : e5 03 __ SBC $03
+1a7e : 26 1b __ ROL ACCU + 0
+1a80 : ca __ __ DEX
+1a81 : d0 eb __ BNE $1a6e
+1a83 : 85 05 __ STA $05
+1a85 : 60 __ __ RTS
+1a86 : a5 1b __ LDA ACCU + 0
+1a88 : 85 05 __ STA $05
+1a8a : a5 1c __ LDA ACCU + 1
+1a8c : 85 06 __ STA $06
+1a8e : a9 00 __ LDA #$00
+1a90 : 85 1b __ STA ACCU + 0
+1a92 : 85 1c __ STA ACCU + 1
+1a94 : 60 __ __ RTS
+1a95 : a5 04 __ LDA $04
+1a97 : d0 1f __ BNE $1ab8
+1a99 : a5 03 __ LDA $03
+1a9b : 30 1b __ BMI $1ab8
+1a9d : a9 00 __ LDA #$00
+1a9f : 85 06 __ STA $06
+1aa1 : a2 10 __ LDX #$10
+1aa3 : 06 1b __ ASL ACCU + 0
+1aa5 : 26 1c __ ROL ACCU + 1
+1aa7 : 2a __ __ ROL
+1aa8 : c5 03 __ CMP $03
+1aaa : 90 02 __ BCC $1aae
+1aac : e5 03 __ SBC $03
+1aae : 26 1b __ ROL ACCU + 0
+1ab0 : 26 1c __ ROL ACCU + 1
+1ab2 : ca __ __ DEX
+1ab3 : d0 f2 __ BNE $1aa7
+1ab5 : 85 05 __ STA $05
+1ab7 : 60 __ __ RTS
+1ab8 : a9 00 __ LDA #$00
+1aba : 85 05 __ STA $05
+1abc : 85 06 __ STA $06
+1abe : 84 02 __ STY $02
+1ac0 : a0 10 __ LDY #$10
+1ac2 : 18 __ __ CLC
+1ac3 : 26 1b __ ROL ACCU + 0
+1ac5 : 26 1c __ ROL ACCU + 1
+1ac7 : 26 05 __ ROL $05
+1ac9 : 26 06 __ ROL $06
+1acb : 38 __ __ SEC
+1acc : a5 05 __ LDA $05
+1ace : e5 03 __ SBC $03
+1ad0 : aa __ __ TAX
+1ad1 : a5 06 __ LDA $06
+1ad3 : e5 04 __ SBC $04
+1ad5 : 90 04 __ BCC $1adb
+1ad7 : 86 05 __ STX $05
+1ad9 : 85 06 __ STA $06
+1adb : 88 __ __ DEY
+1adc : d0 e5 __ BNE $1ac3
+1ade : 26 1b __ ROL ACCU + 0
+1ae0 : 26 1c __ ROL ACCU + 1
+1ae2 : a4 02 __ LDY $02
+1ae4 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1ae5 : 20 3f 18 JSR $183f ; (freg + 36)
+1ae8 : a5 07 __ LDA $07
+1aea : c9 7f __ CMP #$7f
+1aec : b0 07 __ BCS $1af5
+1aee : a9 00 __ LDA #$00
+1af0 : 85 1b __ STA ACCU + 0
+1af2 : 85 1c __ STA ACCU + 1
+1af4 : 60 __ __ RTS
+1af5 : 38 __ __ SEC
+1af6 : e9 8e __ SBC #$8e
+1af8 : 90 0a __ BCC $1b04
+1afa : a9 ff __ LDA #$ff
+1afc : 85 1b __ STA ACCU + 0
+1afe : a9 7f __ LDA #$7f
+1b00 : 85 1c __ STA ACCU + 1
+1b02 : d0 08 __ BNE $1b0c
+1b04 : aa __ __ TAX
+1b05 : 46 1d __ LSR ACCU + 2
+1b07 : 66 1c __ ROR ACCU + 1
+1b09 : e8 __ __ INX
+1b0a : d0 f9 __ BNE $1b05
+1b0c : 24 1e __ BIT ACCU + 3
+1b0e : 10 0e __ BPL $1b1e
+1b10 : 38 __ __ SEC
+1b11 : a9 00 __ LDA #$00
+1b13 : e5 1c __ SBC ACCU + 1
+1b15 : 85 1b __ STA ACCU + 0
+1b17 : a9 00 __ LDA #$00
+1b19 : e5 1d __ SBC ACCU + 2
+1b1b : 85 1c __ STA ACCU + 1
+1b1d : 60 __ __ RTS
+1b1e : a5 1c __ LDA ACCU + 1
+1b20 : 85 1b __ STA ACCU + 0
+1b22 : a5 1d __ LDA ACCU + 2
+1b24 : 85 1c __ STA ACCU + 1
+1b26 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1b27 : 24 1c __ BIT ACCU + 1
+1b29 : 30 03 __ BMI $1b2e
+1b2b : 4c 45 1b JMP $1b45 ; (uint16_to_float + 0)
+1b2e : 38 __ __ SEC
+1b2f : a9 00 __ LDA #$00
+1b31 : e5 1b __ SBC ACCU + 0
+1b33 : 85 1b __ STA ACCU + 0
+1b35 : a9 00 __ LDA #$00
+1b37 : e5 1c __ SBC ACCU + 1
+1b39 : 85 1c __ STA ACCU + 1
+1b3b : 20 45 1b JSR $1b45 ; (uint16_to_float + 0)
+1b3e : a5 1e __ LDA ACCU + 3
+1b40 : 09 80 __ ORA #$80
+1b42 : 85 1e __ STA ACCU + 3
+1b44 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1b45 : a5 1b __ LDA ACCU + 0
+1b47 : 05 1c __ ORA ACCU + 1
+1b49 : d0 05 __ BNE $1b50
+1b4b : 85 1d __ STA ACCU + 2
+1b4d : 85 1e __ STA ACCU + 3
+1b4f : 60 __ __ RTS
+1b50 : a2 8e __ LDX #$8e
+1b52 : a5 1c __ LDA ACCU + 1
+1b54 : 30 06 __ BMI $1b5c
+1b56 : ca __ __ DEX
+1b57 : 06 1b __ ASL ACCU + 0
+1b59 : 2a __ __ ROL
+1b5a : 10 fa __ BPL $1b56
+1b5c : 29 7f __ AND #$7f
+1b5e : 85 1d __ STA ACCU + 2
+1b60 : a5 1b __ LDA ACCU + 0
+1b62 : 85 1c __ STA ACCU + 1
+1b64 : 8a __ __ TXA
+1b65 : 4a __ __ LSR
+1b66 : 85 1e __ STA ACCU + 3
+1b68 : a9 00 __ LDA #$00
+1b6a : 85 1b __ STA ACCU + 0
+1b6c : 6a __ __ ROR
+1b6d : 05 1d __ ORA ACCU + 2
+1b6f : 85 1d __ STA ACCU + 2
+1b71 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1b72 : 38 __ __ SEC
+1b73 : a9 00 __ LDA #$00
+1b75 : e5 1b __ SBC ACCU + 0
+1b77 : 85 1b __ STA ACCU + 0
+1b79 : a9 00 __ LDA #$00
+1b7b : e5 1c __ SBC ACCU + 1
+1b7d : 85 1c __ STA ACCU + 1
+1b7f : a9 00 __ LDA #$00
+1b81 : e5 1d __ SBC ACCU + 2
+1b83 : 85 1d __ STA ACCU + 2
+1b85 : a9 00 __ LDA #$00
+1b87 : e5 1e __ SBC ACCU + 3
+1b89 : 85 1e __ STA ACCU + 3
+1b8b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1b8c : 84 02 __ STY $02
+1b8e : a9 00 __ LDA #$00
+1b90 : 85 07 __ STA $07
+1b92 : 85 08 __ STA $08
+1b94 : 85 09 __ STA $09
+1b96 : 85 0a __ STA $0a
+1b98 : a0 20 __ LDY #$20
+1b9a : 18 __ __ CLC
+1b9b : 26 1b __ ROL ACCU + 0
+1b9d : 26 1c __ ROL ACCU + 1
+1b9f : 26 1d __ ROL ACCU + 2
+1ba1 : 26 1e __ ROL ACCU + 3
+1ba3 : 26 07 __ ROL $07
+1ba5 : 26 08 __ ROL $08
+1ba7 : 26 09 __ ROL $09
+1ba9 : 26 0a __ ROL $0a
+1bab : a5 07 __ LDA $07
+1bad : c5 03 __ CMP $03
+1baf : a5 08 __ LDA $08
+1bb1 : e5 04 __ SBC $04
+1bb3 : a5 09 __ LDA $09
+1bb5 : e5 05 __ SBC $05
+1bb7 : a5 0a __ LDA $0a
+1bb9 : e5 06 __ SBC $06
+1bbb : 90 18 __ BCC $1bd5
+1bbd : a5 07 __ LDA $07
+1bbf : e5 03 __ SBC $03
+1bc1 : 85 07 __ STA $07
+1bc3 : a5 08 __ LDA $08
+1bc5 : e5 04 __ SBC $04
+1bc7 : 85 08 __ STA $08
+1bc9 : a5 09 __ LDA $09
+1bcb : e5 05 __ SBC $05
+1bcd : 85 09 __ STA $09
+1bcf : a5 0a __ LDA $0a
+1bd1 : e5 06 __ SBC $06
+1bd3 : 85 0a __ STA $0a
+1bd5 : 88 __ __ DEY
+1bd6 : d0 c3 __ BNE $1b9b
+1bd8 : 26 1b __ ROL ACCU + 0
+1bda : 26 1c __ ROL ACCU + 1
+1bdc : 26 1d __ ROL ACCU + 2
+1bde : 26 1e __ ROL ACCU + 3
+1be0 : a4 02 __ LDY $02
+1be2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1be3 : a9 00 __ LDA #$00
+1be5 : 85 1d __ STA ACCU + 2
+1be7 : 85 1e __ STA ACCU + 3
+1be9 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1bea : b5 00 __ LDA $00,x
+1bec : 85 03 __ STA $03
+1bee : b5 01 __ LDA $01,x
+1bf0 : 85 04 __ STA $04
+1bf2 : b5 02 __ LDA $02,x
+1bf4 : 85 05 __ STA $05
+1bf6 : b5 03 __ LDA $03,x
+1bf8 : 85 06 __ STA $06
+1bfa : 20 8c 1b JSR $1b8c ; (divmod32 + 0)
+1bfd : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1bfe : b5 00 __ LDA $00,x
+1c00 : 85 03 __ STA $03
+1c02 : b5 01 __ LDA $01,x
+1c04 : 85 04 __ STA $04
+1c06 : b5 02 __ LDA $02,x
+1c08 : 85 05 __ STA $05
+1c0a : b5 03 __ LDA $03,x
+1c0c : 85 06 __ STA $06
+1c0e : 20 8c 1b JSR $1b8c ; (divmod32 + 0)
+1c11 : a5 07 __ LDA $07
+1c13 : 85 1b __ STA ACCU + 0
+1c15 : a5 08 __ LDA $08
+1c17 : 85 1c __ STA ACCU + 1
+1c19 : a5 09 __ LDA $09
+1c1b : 85 1d __ STA ACCU + 2
+1c1d : a5 0a __ LDA $0a
+1c1f : 85 1e __ STA ACCU + 3
+1c21 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1c22 : b5 03 __ LDA $03,x
+1c24 : c5 1e __ CMP ACCU + 3
+1c26 : d0 20 __ BNE $1c48
+1c28 : b5 02 __ LDA $02,x
+1c2a : c5 1d __ CMP ACCU + 2
+1c2c : d0 1a __ BNE $1c48
+1c2e : b5 01 __ LDA $01,x
+1c30 : c5 1c __ CMP ACCU + 1
+1c32 : d0 14 __ BNE $1c48
+1c34 : b5 00 __ LDA $00,x
+1c36 : c5 1b __ CMP ACCU + 0
+1c38 : d0 0e __ BNE $1c48
+1c3a : a9 00 __ LDA #$00
+1c3c : 85 1b __ STA ACCU + 0
+1c3e : 85 1c __ STA ACCU + 1
+1c40 : 60 __ __ RTS
+1c41 : a9 ff __ LDA #$ff
+1c43 : 85 1b __ STA ACCU + 0
+1c45 : 85 1c __ STA ACCU + 1
+1c47 : 60 __ __ RTS
+1c48 : 90 f7 __ BCC $1c41
+1c4a : a9 01 __ LDA #$01
+1c4c : 85 1b __ STA ACCU + 0
+1c4e : a9 00 __ LDA #$00
+1c50 : 85 1c __ STA ACCU + 1
+1c52 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1c53 : a5 1e __ LDA ACCU + 3
+1c55 : 49 80 __ EOR #$80
+1c57 : 85 1e __ STA ACCU + 3
+1c59 : b5 03 __ LDA $03,x
+1c5b : 49 80 __ EOR #$80
+1c5d : c5 1e __ CMP ACCU + 3
+1c5f : d0 20 __ BNE $1c81
+1c61 : b5 02 __ LDA $02,x
+1c63 : c5 1d __ CMP ACCU + 2
+1c65 : d0 1a __ BNE $1c81
+1c67 : b5 01 __ LDA $01,x
+1c69 : c5 1c __ CMP ACCU + 1
+1c6b : d0 14 __ BNE $1c81
+1c6d : b5 00 __ LDA $00,x
+1c6f : c5 1b __ CMP ACCU + 0
+1c71 : d0 0e __ BNE $1c81
+1c73 : a9 00 __ LDA #$00
+1c75 : 85 1b __ STA ACCU + 0
+1c77 : 85 1c __ STA ACCU + 1
+1c79 : 60 __ __ RTS
+1c7a : a9 ff __ LDA #$ff
+1c7c : 85 1b __ STA ACCU + 0
+1c7e : 85 1c __ STA ACCU + 1
+1c80 : 60 __ __ RTS
+1c81 : 90 f7 __ BCC $1c7a
+1c83 : a9 01 __ LDA #$01
+1c85 : 85 1b __ STA ACCU + 0
+1c87 : a9 00 __ LDA #$00
+1c89 : 85 1c __ STA ACCU + 1
+1c8b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c8c : a9 4c __ LDA #$4c
+1c8e : 85 54 __ STA $54
+1c90 : a9 00 __ LDA #$00
+1c92 : 85 13 __ STA P6
+1c94 : a9 19 __ LDA #$19
+1c96 : 85 16 __ STA P9
+1c98 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1c99 : b1 19 __ LDA (IP + 0),y
+1c9b : aa __ __ TAX
+1c9c : c8 __ __ INY
+1c9d : b1 19 __ LDA (IP + 0),y
+1c9f : 95 00 __ STA $00,x
+1ca1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1ca4 : b1 19 __ LDA (IP + 0),y
+1ca6 : aa __ __ TAX
+1ca7 : c8 __ __ INY
+1ca8 : b1 19 __ LDA (IP + 0),y
+1caa : 95 00 __ STA $00,x
+1cac : a9 00 __ LDA #$00
+1cae : 95 01 __ STA $01,x
+1cb0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1cb3 : b1 19 __ LDA (IP + 0),y
+1cb5 : aa __ __ TAX
+1cb6 : c8 __ __ INY
+1cb7 : b1 19 __ LDA (IP + 0),y
+1cb9 : 95 00 __ STA $00,x
+1cbb : a9 ff __ LDA #$ff
+1cbd : 95 01 __ STA $01,x
+1cbf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1cc2 : b1 19 __ LDA (IP + 0),y
+1cc4 : aa __ __ TAX
+1cc5 : c8 __ __ INY
+1cc6 : b1 19 __ LDA (IP + 0),y
+1cc8 : 95 00 __ STA $00,x
+1cca : c8 __ __ INY
+1ccb : b1 19 __ LDA (IP + 0),y
+1ccd : 95 01 __ STA $01,x
+1ccf : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1cd2 : b1 19 __ LDA (IP + 0),y
+1cd4 : aa __ __ TAX
+1cd5 : c8 __ __ INY
+1cd6 : b1 19 __ LDA (IP + 0),y
+1cd8 : 95 00 __ STA $00,x
+1cda : c8 __ __ INY
+1cdb : b1 19 __ LDA (IP + 0),y
+1cdd : 95 01 __ STA $01,x
+1cdf : c8 __ __ INY
+1ce0 : b1 19 __ LDA (IP + 0),y
+1ce2 : 95 02 __ STA $02,x
+1ce4 : c8 __ __ INY
+1ce5 : b1 19 __ LDA (IP + 0),y
+1ce7 : 95 03 __ STA $03,x
+1ce9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1cec : b1 19 __ LDA (IP + 0),y
+1cee : aa __ __ TAX
+1cef : b5 00 __ LDA $00,x
+1cf1 : 85 1b __ STA ACCU + 0
+1cf3 : a9 00 __ LDA #$00
+1cf5 : 85 1c __ STA ACCU + 1
+1cf7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1cfa : b1 19 __ LDA (IP + 0),y
+1cfc : aa __ __ TAX
+1cfd : a5 1b __ LDA ACCU + 0
+1cff : 95 00 __ STA $00,x
+1d01 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1d04 : b1 19 __ LDA (IP + 0),y
+1d06 : aa __ __ TAX
+1d07 : b5 00 __ LDA $00,x
+1d09 : 85 1b __ STA ACCU + 0
+1d0b : b5 01 __ LDA $01,x
+1d0d : 85 1c __ STA ACCU + 1
+1d0f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1d12 : b1 19 __ LDA (IP + 0),y
+1d14 : aa __ __ TAX
+1d15 : a5 1b __ LDA ACCU + 0
+1d17 : 95 00 __ STA $00,x
+1d19 : a5 1c __ LDA ACCU + 1
+1d1b : 95 01 __ STA $01,x
+1d1d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1d20 : b1 19 __ LDA (IP + 0),y
+1d22 : aa __ __ TAX
+1d23 : b5 00 __ LDA $00,x
+1d25 : 85 1f __ STA ADDR + 0
+1d27 : b5 01 __ LDA $01,x
+1d29 : 85 20 __ STA ADDR + 1
+1d2b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1d2e : b1 19 __ LDA (IP + 0),y
+1d30 : aa __ __ TAX
+1d31 : b5 00 __ LDA $00,x
+1d33 : 85 1b __ STA ACCU + 0
+1d35 : b5 01 __ LDA $01,x
+1d37 : 85 1c __ STA ACCU + 1
+1d39 : b5 02 __ LDA $02,x
+1d3b : 85 1d __ STA ACCU + 2
+1d3d : b5 03 __ LDA $03,x
+1d3f : 85 1e __ STA ACCU + 3
+1d41 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1d44 : b1 19 __ LDA (IP + 0),y
+1d46 : aa __ __ TAX
+1d47 : a5 1b __ LDA ACCU + 0
+1d49 : 95 00 __ STA $00,x
+1d4b : a5 1c __ LDA ACCU + 1
+1d4d : 95 01 __ STA $01,x
+1d4f : a5 1d __ LDA ACCU + 2
+1d51 : 95 02 __ STA $02,x
+1d53 : a5 1e __ LDA ACCU + 3
+1d55 : 95 03 __ STA $03,x
+1d57 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1d5a : b1 19 __ LDA (IP + 0),y
+1d5c : 85 1f __ STA ADDR + 0
+1d5e : c8 __ __ INY
+1d5f : b1 19 __ LDA (IP + 0),y
+1d61 : 85 20 __ STA ADDR + 1
+1d63 : c8 __ __ INY
+1d64 : b1 19 __ LDA (IP + 0),y
+1d66 : aa __ __ TAX
+1d67 : 84 02 __ STY $02
+1d69 : a0 00 __ LDY #$00
+1d6b : b1 1f __ LDA (ADDR + 0),y
+1d6d : 95 00 __ STA $00,x
+1d6f : c8 __ __ INY
+1d70 : b1 1f __ LDA (ADDR + 0),y
+1d72 : 95 01 __ STA $01,x
+1d74 : a4 02 __ LDY $02
+1d76 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d79 : b1 19 __ LDA (IP + 0),y
+1d7b : aa __ __ TAX
+1d7c : c8 __ __ INY
+1d7d : b1 19 __ LDA (IP + 0),y
+1d7f : 84 02 __ STY $02
+1d81 : a8 __ __ TAY
+1d82 : 4c 6b 1d JMP $1d6b ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1d85 : b1 19 __ LDA (IP + 0),y
+1d87 : 85 1f __ STA ADDR + 0
+1d89 : c8 __ __ INY
+1d8a : b1 19 __ LDA (IP + 0),y
+1d8c : 85 20 __ STA ADDR + 1
+1d8e : c8 __ __ INY
+1d8f : b1 19 __ LDA (IP + 0),y
+1d91 : aa __ __ TAX
+1d92 : 84 02 __ STY $02
+1d94 : a0 00 __ LDY #$00
+1d96 : b5 00 __ LDA $00,x
+1d98 : 91 1f __ STA (ADDR + 0),y
+1d9a : c8 __ __ INY
+1d9b : b5 01 __ LDA $01,x
+1d9d : 91 1f __ STA (ADDR + 0),y
+1d9f : a4 02 __ LDY $02
+1da1 : 4c 50 08 JMP $0850 ; (startup + 79)
+1da4 : b1 19 __ LDA (IP + 0),y
+1da6 : aa __ __ TAX
+1da7 : c8 __ __ INY
+1da8 : b1 19 __ LDA (IP + 0),y
+1daa : 84 02 __ STY $02
+1dac : a8 __ __ TAY
+1dad : 4c 96 1d JMP $1d96 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1db0 : b1 19 __ LDA (IP + 0),y
+1db2 : aa __ __ TAX
+1db3 : c8 __ __ INY
+1db4 : b1 19 __ LDA (IP + 0),y
+1db6 : 95 00 __ STA $00,x
+1db8 : c8 __ __ INY
+1db9 : b1 19 __ LDA (IP + 0),y
+1dbb : 95 01 __ STA $01,x
+1dbd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1dc0 : b1 19 __ LDA (IP + 0),y
+1dc2 : aa __ __ TAX
+1dc3 : 18 __ __ CLC
+1dc4 : b5 00 __ LDA $00,x
+1dc6 : 65 1b __ ADC ACCU + 0
+1dc8 : 85 1f __ STA ADDR + 0
+1dca : b5 01 __ LDA $01,x
+1dcc : 65 1c __ ADC ACCU + 1
+1dce : 85 20 __ STA ADDR + 1
+1dd0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1dd3 : b1 19 __ LDA (IP + 0),y
+1dd5 : aa __ __ TAX
+1dd6 : c8 __ __ INY
+1dd7 : b1 19 __ LDA (IP + 0),y
+1dd9 : 84 02 __ STY $02
+1ddb : a8 __ __ TAY
+1ddc : b1 25 __ LDA (FP + 0),y
+1dde : 95 00 __ STA $00,x
+1de0 : a4 02 __ LDY $02
+1de2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1de5 : b1 19 __ LDA (IP + 0),y
+1de7 : aa __ __ TAX
+1de8 : c8 __ __ INY
+1de9 : b1 19 __ LDA (IP + 0),y
+1deb : 84 02 __ STY $02
+1ded : a8 __ __ TAY
+1dee : b1 25 __ LDA (FP + 0),y
+1df0 : 95 00 __ STA $00,x
+1df2 : a9 00 __ LDA #$00
+1df4 : 95 01 __ STA $01,x
+1df6 : a4 02 __ LDY $02
+1df8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1dfb : b1 19 __ LDA (IP + 0),y
+1dfd : aa __ __ TAX
+1dfe : c8 __ __ INY
+1dff : b1 19 __ LDA (IP + 0),y
+1e01 : 84 02 __ STY $02
+1e03 : a8 __ __ TAY
+1e04 : b1 25 __ LDA (FP + 0),y
+1e06 : 95 00 __ STA $00,x
+1e08 : c8 __ __ INY
+1e09 : b1 25 __ LDA (FP + 0),y
+1e0b : 95 01 __ STA $01,x
+1e0d : a4 02 __ LDY $02
+1e0f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1e12 : b1 19 __ LDA (IP + 0),y
+1e14 : aa __ __ TAX
+1e15 : c8 __ __ INY
+1e16 : b1 19 __ LDA (IP + 0),y
+1e18 : 84 02 __ STY $02
+1e1a : a8 __ __ TAY
+1e1b : b5 00 __ LDA $00,x
+1e1d : 91 25 __ STA (FP + 0),y
+1e1f : a4 02 __ LDY $02
+1e21 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1e24 : b1 19 __ LDA (IP + 0),y
+1e26 : aa __ __ TAX
+1e27 : c8 __ __ INY
+1e28 : b1 19 __ LDA (IP + 0),y
+1e2a : 84 02 __ STY $02
+1e2c : a8 __ __ TAY
+1e2d : b5 00 __ LDA $00,x
+1e2f : 91 25 __ STA (FP + 0),y
+1e31 : c8 __ __ INY
+1e32 : b5 01 __ LDA $01,x
+1e34 : 91 25 __ STA (FP + 0),y
+1e36 : a4 02 __ LDY $02
+1e38 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1e3b : b1 19 __ LDA (IP + 0),y
+1e3d : aa __ __ TAX
+1e3e : c8 __ __ INY
+1e3f : 18 __ __ CLC
+1e40 : b1 19 __ LDA (IP + 0),y
+1e42 : 65 25 __ ADC FP + 0
+1e44 : 95 00 __ STA $00,x
+1e46 : c8 __ __ INY
+1e47 : b1 19 __ LDA (IP + 0),y
+1e49 : 65 26 __ ADC FP + 1
+1e4b : 95 01 __ STA $01,x
+1e4d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1e50 : b1 19 __ LDA (IP + 0),y
+1e52 : aa __ __ TAX
+1e53 : c8 __ __ INY
+1e54 : b1 19 __ LDA (IP + 0),y
+1e56 : 84 02 __ STY $02
+1e58 : a8 __ __ TAY
+1e59 : b5 00 __ LDA $00,x
+1e5b : 91 23 __ STA (SP + 0),y
+1e5d : c8 __ __ INY
+1e5e : b5 01 __ LDA $01,x
+1e60 : 91 23 __ STA (SP + 0),y
+1e62 : a4 02 __ LDY $02
+1e64 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1e67 : b1 19 __ LDA (IP + 0),y
+1e69 : 85 1f __ STA ADDR + 0
+1e6b : c8 __ __ INY
+1e6c : b1 19 __ LDA (IP + 0),y
+1e6e : 85 20 __ STA ADDR + 1
+1e70 : c8 __ __ INY
+1e71 : b1 19 __ LDA (IP + 0),y
+1e73 : aa __ __ TAX
+1e74 : 84 02 __ STY $02
+1e76 : a0 00 __ LDY #$00
+1e78 : b1 1f __ LDA (ADDR + 0),y
+1e7a : 95 00 __ STA $00,x
+1e7c : a4 02 __ LDY $02
+1e7e : 4c 50 08 JMP $0850 ; (startup + 79)
+1e81 : b1 19 __ LDA (IP + 0),y
+1e83 : aa __ __ TAX
+1e84 : c8 __ __ INY
+1e85 : b1 19 __ LDA (IP + 0),y
+1e87 : 84 02 __ STY $02
+1e89 : a8 __ __ TAY
+1e8a : 4c 78 1e JMP $1e78 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1e8d : b1 19 __ LDA (IP + 0),y
+1e8f : 85 1f __ STA ADDR + 0
+1e91 : c8 __ __ INY
+1e92 : b1 19 __ LDA (IP + 0),y
+1e94 : 85 20 __ STA ADDR + 1
+1e96 : c8 __ __ INY
+1e97 : b1 19 __ LDA (IP + 0),y
+1e99 : aa __ __ TAX
+1e9a : 84 02 __ STY $02
+1e9c : a0 00 __ LDY #$00
+1e9e : b1 1f __ LDA (ADDR + 0),y
+1ea0 : 95 00 __ STA $00,x
+1ea2 : c8 __ __ INY
+1ea3 : b1 1f __ LDA (ADDR + 0),y
+1ea5 : 95 01 __ STA $01,x
+1ea7 : c8 __ __ INY
+1ea8 : b1 1f __ LDA (ADDR + 0),y
+1eaa : 95 02 __ STA $02,x
+1eac : c8 __ __ INY
+1ead : b1 1f __ LDA (ADDR + 0),y
+1eaf : 95 03 __ STA $03,x
+1eb1 : a4 02 __ LDY $02
+1eb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+1eb6 : b1 19 __ LDA (IP + 0),y
+1eb8 : aa __ __ TAX
+1eb9 : c8 __ __ INY
+1eba : b1 19 __ LDA (IP + 0),y
+1ebc : 84 02 __ STY $02
+1ebe : a8 __ __ TAY
+1ebf : 4c 9e 1e JMP $1e9e ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1ec2 : b1 19 __ LDA (IP + 0),y
+1ec4 : 85 1f __ STA ADDR + 0
+1ec6 : c8 __ __ INY
+1ec7 : b1 19 __ LDA (IP + 0),y
+1ec9 : 85 20 __ STA ADDR + 1
+1ecb : c8 __ __ INY
+1ecc : b1 19 __ LDA (IP + 0),y
+1ece : aa __ __ TAX
+1ecf : 84 02 __ STY $02
+1ed1 : a0 00 __ LDY #$00
+1ed3 : b5 00 __ LDA $00,x
+1ed5 : 91 1f __ STA (ADDR + 0),y
+1ed7 : a4 02 __ LDY $02
+1ed9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1edc : b1 19 __ LDA (IP + 0),y
+1ede : aa __ __ TAX
+1edf : c8 __ __ INY
+1ee0 : b1 19 __ LDA (IP + 0),y
+1ee2 : 84 02 __ STY $02
+1ee4 : a8 __ __ TAY
+1ee5 : 4c d3 1e JMP $1ed3 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1ee8 : b1 19 __ LDA (IP + 0),y
+1eea : aa __ __ TAX
+1eeb : 18 __ __ CLC
+1eec : a5 1b __ LDA ACCU + 0
+1eee : 75 00 __ ADC $00,x
+1ef0 : 85 1b __ STA ACCU + 0
+1ef2 : a5 1c __ LDA ACCU + 1
+1ef4 : 75 01 __ ADC $01,x
+1ef6 : 85 1c __ STA ACCU + 1
+1ef8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1efb : b1 19 __ LDA (IP + 0),y
+1efd : aa __ __ TAX
+1efe : 38 __ __ SEC
+1eff : a5 1b __ LDA ACCU + 0
+1f01 : f5 00 __ SBC $00,x
+1f03 : 85 1b __ STA ACCU + 0
+1f05 : a5 1c __ LDA ACCU + 1
+1f07 : f5 01 __ SBC $01,x
+1f09 : 85 1c __ STA ACCU + 1
+1f0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+1f0e : b1 19 __ LDA (IP + 0),y
+1f10 : aa __ __ TAX
+1f11 : a5 1b __ LDA ACCU + 0
+1f13 : 55 00 __ EOR $00,x
+1f15 : 85 1b __ STA ACCU + 0
+1f17 : a5 1c __ LDA ACCU + 1
+1f19 : 55 01 __ EOR $01,x
+1f1b : 85 1c __ STA ACCU + 1
+1f1d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1f20 : b1 19 __ LDA (IP + 0),y
+1f22 : aa __ __ TAX
+1f23 : b5 00 __ LDA $00,x
+1f25 : 85 03 __ STA $03
+1f27 : b5 01 __ LDA $01,x
+1f29 : 85 04 __ STA $04
+1f2b : 20 60 1a JSR $1a60 ; (divmod + 0)
+1f2e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1f31 : b1 19 __ LDA (IP + 0),y
+1f33 : aa __ __ TAX
+1f34 : b5 00 __ LDA $00,x
+1f36 : 85 03 __ STA $03
+1f38 : b5 01 __ LDA $01,x
+1f3a : 85 04 __ STA $04
+1f3c : 20 60 1a JSR $1a60 ; (divmod + 0)
+1f3f : a5 05 __ LDA $05
+1f41 : 85 1b __ STA ACCU + 0
+1f43 : a5 06 __ LDA $06
+1f45 : 85 1c __ STA ACCU + 1
+1f47 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1f4a : b1 19 __ LDA (IP + 0),y
+1f4c : aa __ __ TAX
+1f4d : b5 00 __ LDA $00,x
+1f4f : 85 03 __ STA $03
+1f51 : b5 01 __ LDA $01,x
+1f53 : 85 04 __ STA $04
+1f55 : 24 1c __ BIT ACCU + 1
+1f57 : 10 10 __ BPL $1f69
+1f59 : 20 44 1a JSR $1a44 ; (negaccu + 0)
+1f5c : 24 04 __ BIT $04
+1f5e : 10 10 __ BPL $1f70
+1f60 : 20 52 1a JSR $1a52 ; (negtmp + 0)
+1f63 : 20 60 1a JSR $1a60 ; (divmod + 0)
+1f66 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f69 : 24 04 __ BIT $04
+1f6b : 10 f6 __ BPL $1f63
+1f6d : 20 52 1a JSR $1a52 ; (negtmp + 0)
+1f70 : 20 60 1a JSR $1a60 ; (divmod + 0)
+1f73 : 20 44 1a JSR $1a44 ; (negaccu + 0)
+1f76 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1f79 : b1 19 __ LDA (IP + 0),y
+1f7b : aa __ __ TAX
+1f7c : b5 00 __ LDA $00,x
+1f7e : 85 03 __ STA $03
+1f80 : b5 01 __ LDA $01,x
+1f82 : 85 04 __ STA $04
+1f84 : 24 1c __ BIT ACCU + 1
+1f86 : 10 18 __ BPL $1fa0
+1f88 : 20 44 1a JSR $1a44 ; (negaccu + 0)
+1f8b : 24 04 __ BIT $04
+1f8d : 10 18 __ BPL $1fa7
+1f8f : 20 52 1a JSR $1a52 ; (negtmp + 0)
+1f92 : 20 60 1a JSR $1a60 ; (divmod + 0)
+1f95 : a5 05 __ LDA $05
+1f97 : 85 1b __ STA ACCU + 0
+1f99 : a5 06 __ LDA $06
+1f9b : 85 1c __ STA ACCU + 1
+1f9d : 4c 50 08 JMP $0850 ; (startup + 79)
+1fa0 : 24 04 __ BIT $04
+1fa2 : 10 ee __ BPL $1f92
+1fa4 : 20 52 1a JSR $1a52 ; (negtmp + 0)
+1fa7 : 20 60 1a JSR $1a60 ; (divmod + 0)
+1faa : a5 05 __ LDA $05
+1fac : 85 1b __ STA ACCU + 0
+1fae : a5 06 __ LDA $06
+1fb0 : 85 1c __ STA ACCU + 1
+1fb2 : 20 44 1a JSR $1a44 ; (negaccu + 0)
+1fb5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1fb8 : b1 19 __ LDA (IP + 0),y
+1fba : aa __ __ TAX
+1fbb : 18 __ __ CLC
+1fbc : b5 00 __ LDA $00,x
+1fbe : 65 1b __ ADC ACCU + 0
+1fc0 : 95 00 __ STA $00,x
+1fc2 : b5 01 __ LDA $01,x
+1fc4 : 65 1c __ ADC ACCU + 1
+1fc6 : 95 01 __ STA $01,x
+1fc8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1fcb : b1 19 __ LDA (IP + 0),y
+1fcd : c8 __ __ INY
+1fce : aa __ __ TAX
+1fcf : 18 __ __ CLC
+1fd0 : b5 00 __ LDA $00,x
+1fd2 : 71 19 __ ADC (IP + 0),y
+1fd4 : c8 __ __ INY
+1fd5 : 95 00 __ STA $00,x
+1fd7 : b5 01 __ LDA $01,x
+1fd9 : 71 19 __ ADC (IP + 0),y
+1fdb : 95 01 __ STA $01,x
+1fdd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1fe0 : b1 19 __ LDA (IP + 0),y
+1fe2 : c8 __ __ INY
+1fe3 : aa __ __ TAX
+1fe4 : 38 __ __ SEC
+1fe5 : b1 19 __ LDA (IP + 0),y
+1fe7 : c8 __ __ INY
+1fe8 : f5 00 __ SBC $00,x
+1fea : 95 00 __ STA $00,x
+1fec : b1 19 __ LDA (IP + 0),y
+1fee : f5 01 __ SBC $01,x
+1ff0 : 95 01 __ STA $01,x
+1ff2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1ff5 : b1 19 __ LDA (IP + 0),y
+1ff7 : c8 __ __ INY
+1ff8 : aa __ __ TAX
+1ff9 : b5 00 __ LDA $00,x
+1ffb : 31 19 __ AND (IP + 0),y
+1ffd : c8 __ __ INY
+1ffe : 95 00 __ STA $00,x
+2000 : b5 01 __ LDA $01,x
+2002 : 31 19 __ AND (IP + 0),y
+2004 : 95 01 __ STA $01,x
+2006 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+2009 : b1 19 __ LDA (IP + 0),y
+200b : c8 __ __ INY
+200c : aa __ __ TAX
+200d : a9 00 __ LDA #$00
+200f : 85 05 __ STA $05
+2011 : 85 06 __ STA $06
+2013 : b5 00 __ LDA $00,x
+2015 : 85 03 __ STA $03
+2017 : b5 01 __ LDA $01,x
+2019 : 85 04 __ STA $04
+201b : b1 19 __ LDA (IP + 0),y
+201d : 4a __ __ LSR
+201e : 85 07 __ STA $07
+2020 : 90 0d __ BCC $202f
+2022 : 18 __ __ CLC
+2023 : a5 05 __ LDA $05
+2025 : 65 03 __ ADC $03
+2027 : 85 05 __ STA $05
+2029 : a5 06 __ LDA $06
+202b : 65 04 __ ADC $04
+202d : 85 06 __ STA $06
+202f : 06 03 __ ASL $03
+2031 : 26 04 __ ROL $04
+2033 : 46 07 __ LSR $07
+2035 : b0 eb __ BCS $2022
+2037 : d0 f6 __ BNE $202f
+2039 : a5 05 __ LDA $05
+203b : 95 00 __ STA $00,x
+203d : a5 06 __ LDA $06
+203f : 95 01 __ STA $01,x
+2041 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+2044 : b1 19 __ LDA (IP + 0),y
+2046 : c8 __ __ INY
+2047 : aa __ __ TAX
+2048 : 18 __ __ CLC
+2049 : b5 00 __ LDA $00,x
+204b : 71 19 __ ADC (IP + 0),y
+204d : 95 00 __ STA $00,x
+204f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+2052 : b1 19 __ LDA (IP + 0),y
+2054 : aa __ __ TAX
+2055 : b5 00 __ LDA $00,x
+2057 : 2c b1 19 BIT $19b1 ; (fmul8 + 25)
+205a : 29 0f __ AND #$0f
+205c : f0 0b __ BEQ $2069
+205e : aa __ __ TAX
+205f : a5 1c __ LDA ACCU + 1
+2061 : 06 1b __ ASL ACCU + 0
+2063 : 2a __ __ ROL
+2064 : ca __ __ DEX
+2065 : d0 fa __ BNE $2061
+2067 : 85 1c __ STA ACCU + 1
+2069 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+206c : b1 19 __ LDA (IP + 0),y
+206e : aa __ __ TAX
+206f : b5 00 __ LDA $00,x
+2071 : 2c b1 19 BIT $19b1 ; (fmul8 + 25)
+2074 : 29 0f __ AND #$0f
+2076 : f0 0b __ BEQ $2083
+2078 : aa __ __ TAX
+2079 : a5 1c __ LDA ACCU + 1
+207b : 4a __ __ LSR
+207c : 66 1b __ ROR ACCU + 0
+207e : ca __ __ DEX
+207f : d0 fa __ BNE $207b
+2081 : 85 1c __ STA ACCU + 1
+2083 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+2086 : b1 19 __ LDA (IP + 0),y
+2088 : aa __ __ TAX
+2089 : 38 __ __ SEC
+208a : b5 01 __ LDA $01,x
+208c : e5 1c __ SBC ACCU + 1
+208e : f0 11 __ BEQ $20a1
+2090 : 50 02 __ BVC $2094
+2092 : 49 80 __ EOR #$80
+2094 : 30 2a __ BMI $20c0
+2096 : 10 33 __ BPL $20cb
+2098 : b1 19 __ LDA (IP + 0),y
+209a : aa __ __ TAX
+209b : b5 01 __ LDA $01,x
+209d : c5 1c __ CMP ACCU + 1
+209f : d0 28 __ BNE $20c9
+20a1 : b5 00 __ LDA $00,x
+20a3 : c5 1b __ CMP ACCU + 0
+20a5 : d0 22 __ BNE $20c9
+20a7 : f0 0e __ BEQ $20b7
+20a9 : b1 19 __ LDA (IP + 0),y
+20ab : aa __ __ TAX
+20ac : c8 __ __ INY
+20ad : b1 19 __ LDA (IP + 0),y
+20af : c5 1c __ CMP ACCU + 1
+20b1 : d0 16 __ BNE $20c9
+20b3 : e4 1b __ CPX ACCU + 0
+20b5 : d0 12 __ BNE $20c9
+20b7 : a9 00 __ LDA #$00
+20b9 : 85 1b __ STA ACCU + 0
+20bb : 85 1c __ STA ACCU + 1
+20bd : 4c 50 08 JMP $0850 ; (startup + 79)
+20c0 : a9 ff __ LDA #$ff
+20c2 : 85 1b __ STA ACCU + 0
+20c4 : 85 1c __ STA ACCU + 1
+20c6 : 4c 50 08 JMP $0850 ; (startup + 79)
+20c9 : 90 f5 __ BCC $20c0
+20cb : a9 01 __ LDA #$01
+20cd : 85 1b __ STA ACCU + 0
+20cf : a9 00 __ LDA #$00
+20d1 : 85 1c __ STA ACCU + 1
+20d3 : 4c 50 08 JMP $0850 ; (startup + 79)
+20d6 : b1 19 __ LDA (IP + 0),y
+20d8 : c8 __ __ INY
+20d9 : aa __ __ TAX
+20da : b1 19 __ LDA (IP + 0),y
+20dc : 38 __ __ SEC
+20dd : e5 1c __ SBC ACCU + 1
+20df : d0 af __ BNE $2090
+20e1 : e4 1b __ CPX ACCU + 0
+20e3 : d0 e4 __ BNE $20c9
+20e5 : f0 d0 __ BEQ $20b7
+20e7 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+20e8 : b1 19 __ LDA (IP + 0),y
+20ea : aa __ __ TAX
+20eb : 38 __ __ SEC
+20ec : b5 00 __ LDA $00,x
+20ee : e5 1b __ SBC ACCU + 0
+20f0 : f0 19 __ BEQ $210b
+20f2 : 50 02 __ BVC $20f6
+20f4 : 49 80 __ EOR #$80
+20f6 : 30 1c __ BMI $2114
+20f8 : 10 25 __ BPL $211f
+20fa : b1 19 __ LDA (IP + 0),y
+20fc : aa __ __ TAX
+20fd : b5 00 __ LDA $00,x
+20ff : c5 1b __ CMP ACCU + 0
+2101 : d0 1a __ BNE $211d
+2103 : f0 06 __ BEQ $210b
+2105 : b1 19 __ LDA (IP + 0),y
+2107 : c5 1b __ CMP ACCU + 0
+2109 : d0 12 __ BNE $211d
+210b : a9 00 __ LDA #$00
+210d : 85 1b __ STA ACCU + 0
+210f : 85 1c __ STA ACCU + 1
+2111 : 4c 50 08 JMP $0850 ; (startup + 79)
+2114 : a9 ff __ LDA #$ff
+2116 : 85 1b __ STA ACCU + 0
+2118 : 85 1c __ STA ACCU + 1
+211a : 4c 50 08 JMP $0850 ; (startup + 79)
+211d : 90 f5 __ BCC $2114
+211f : a9 01 __ LDA #$01
+2121 : 85 1b __ STA ACCU + 0
+2123 : a9 00 __ LDA #$00
+2125 : 85 1c __ STA ACCU + 1
+2127 : 4c 50 08 JMP $0850 ; (startup + 79)
+212a : b1 19 __ LDA (IP + 0),y
+212c : 38 __ __ SEC
+212d : e5 1b __ SBC ACCU + 0
+212f : d0 c1 __ BNE $20f2
+2131 : f0 d8 __ BEQ $210b
+2133 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+2134 : 38 __ __ SEC
+2135 : a9 00 __ LDA #$00
+2137 : e5 1b __ SBC ACCU + 0
+2139 : 85 1b __ STA ACCU + 0
+213b : a9 00 __ LDA #$00
+213d : e5 1c __ SBC ACCU + 1
+213f : 85 1c __ STA ACCU + 1
+2141 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+2144 : 20 1b 18 JSR $181b ; (freg + 0)
+2147 : 20 60 18 JSR $1860 ; (faddsub + 0)
+214a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+214d : 20 1b 18 JSR $181b ; (freg + 0)
+2150 : a5 06 __ LDA $06
+2152 : 49 80 __ EOR #$80
+2154 : 85 06 __ STA $06
+2156 : 20 60 18 JSR $1860 ; (faddsub + 0)
+2159 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+215c : 20 1b 18 JSR $181b ; (freg + 0)
+215f : 84 02 __ STY $02
+2161 : 20 28 19 JSR $1928 ; (fmul + 0)
+2164 : a4 02 __ LDY $02
+2166 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+2169 : 20 1b 18 JSR $181b ; (freg + 0)
+216c : 20 c6 19 JSR $19c6 ; (fdiv + 0)
+216f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+2172 : b1 19 __ LDA (IP + 0),y
+2174 : c8 __ __ INY
+2175 : aa __ __ TAX
+2176 : a5 1e __ LDA ACCU + 3
+2178 : 55 03 __ EOR $03,x
+217a : 29 80 __ AND #$80
+217c : f0 1e __ BEQ $219c
+217e : a5 1e __ LDA ACCU + 3
+2180 : 29 7f __ AND #$7f
+2182 : 05 1d __ ORA ACCU + 2
+2184 : 05 1c __ ORA ACCU + 1
+2186 : 05 1b __ ORA ACCU + 0
+2188 : d0 0c __ BNE $2196
+218a : b5 03 __ LDA $03,x
+218c : 29 7f __ AND #$7f
+218e : 15 02 __ ORA $02,x
+2190 : 15 01 __ ORA $01,x
+2192 : 15 00 __ ORA $00,x
+2194 : f0 1e __ BEQ $21b4
+2196 : a5 1e __ LDA ACCU + 3
+2198 : 30 29 __ BMI $21c3
+219a : 10 36 __ BPL $21d2
+219c : a5 1e __ LDA ACCU + 3
+219e : d5 03 __ CMP $03,x
+21a0 : d0 1b __ BNE $21bd
+21a2 : a5 1d __ LDA ACCU + 2
+21a4 : d5 02 __ CMP $02,x
+21a6 : d0 15 __ BNE $21bd
+21a8 : a5 1c __ LDA ACCU + 1
+21aa : d5 01 __ CMP $01,x
+21ac : d0 0f __ BNE $21bd
+21ae : a5 1b __ LDA ACCU + 0
+21b0 : d5 00 __ CMP $00,x
+21b2 : d0 09 __ BNE $21bd
+21b4 : a9 00 __ LDA #$00
+21b6 : 85 1b __ STA ACCU + 0
+21b8 : 85 1c __ STA ACCU + 1
+21ba : 4c 51 08 JMP $0851 ; (startup + 80)
+21bd : b0 0f __ BCS $21ce
+21bf : 24 1e __ BIT ACCU + 3
+21c1 : 30 0f __ BMI $21d2
+21c3 : a9 00 __ LDA #$00
+21c5 : 85 1c __ STA ACCU + 1
+21c7 : a9 01 __ LDA #$01
+21c9 : 85 1b __ STA ACCU + 0
+21cb : 4c 51 08 JMP $0851 ; (startup + 80)
+21ce : 24 1e __ BIT ACCU + 3
+21d0 : 30 f1 __ BMI $21c3
+21d2 : a9 ff __ LDA #$ff
+21d4 : 85 1b __ STA ACCU + 0
+21d6 : 85 1c __ STA ACCU + 1
+21d8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+21db : a5 1e __ LDA ACCU + 3
+21dd : 49 80 __ EOR #$80
+21df : 85 1e __ STA ACCU + 3
+21e1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+21e4 : 20 27 1b JSR $1b27 ; (sint16_to_float + 0)
+21e7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+21ea : 20 e5 1a JSR $1ae5 ; (f32_to_i16 + 0)
+21ed : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+21f0 : b1 19 __ LDA (IP + 0),y
+21f2 : 30 0c __ BMI $2200
+21f4 : 38 __ __ SEC
+21f5 : 65 19 __ ADC IP + 0
+21f7 : 85 19 __ STA IP + 0
+21f9 : 90 02 __ BCC $21fd
+21fb : e6 1a __ INC IP + 1
+21fd : 4c 51 08 JMP $0851 ; (startup + 80)
+2200 : 38 __ __ SEC
+2201 : 65 19 __ ADC IP + 0
+2203 : 85 19 __ STA IP + 0
+2205 : b0 02 __ BCS $2209
+2207 : c6 1a __ DEC IP + 1
+2209 : 4c 51 08 JMP $0851 ; (startup + 80)
+220c : a5 1b __ LDA ACCU + 0
+220e : 05 1c __ ORA ACCU + 1
+2210 : f0 de __ BEQ $21f0
+2212 : 4c 50 08 JMP $0850 ; (startup + 79)
+2215 : a5 1b __ LDA ACCU + 0
+2217 : 05 1c __ ORA ACCU + 1
+2219 : d0 d5 __ BNE $21f0
+221b : 4c 50 08 JMP $0850 ; (startup + 79)
+221e : a5 1c __ LDA ACCU + 1
+2220 : 30 04 __ BMI $2226
+2222 : 05 1b __ ORA ACCU + 0
+2224 : d0 ca __ BNE $21f0
+2226 : 4c 50 08 JMP $0850 ; (startup + 79)
+2229 : a5 1c __ LDA ACCU + 1
+222b : 10 c3 __ BPL $21f0
+222d : 4c 50 08 JMP $0850 ; (startup + 79)
+2230 : a5 1c __ LDA ACCU + 1
+2232 : 30 bc __ BMI $21f0
+2234 : 4c 50 08 JMP $0850 ; (startup + 79)
+2237 : a5 1c __ LDA ACCU + 1
+2239 : 30 b5 __ BMI $21f0
+223b : 05 1b __ ORA ACCU + 0
+223d : f0 b1 __ BEQ $21f0
+223f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2242 : 38 __ __ SEC
+2243 : b1 19 __ LDA (IP + 0),y
+2245 : 65 19 __ ADC IP + 0
+2247 : aa __ __ TAX
+2248 : c8 __ __ INY
+2249 : b1 19 __ LDA (IP + 0),y
+224b : 65 1a __ ADC IP + 1
+224d : 85 1a __ STA IP + 1
+224f : 86 19 __ STX IP + 0
+2251 : 4c 51 08 JMP $0851 ; (startup + 80)
+2254 : a5 1b __ LDA ACCU + 0
+2256 : 05 1c __ ORA ACCU + 1
+2258 : f0 e8 __ BEQ $2242
+225a : c8 __ __ INY
+225b : 4c 50 08 JMP $0850 ; (startup + 79)
+225e : a5 1b __ LDA ACCU + 0
+2260 : 05 1c __ ORA ACCU + 1
+2262 : d0 de __ BNE $2242
+2264 : c8 __ __ INY
+2265 : 4c 50 08 JMP $0850 ; (startup + 79)
+2268 : a5 1c __ LDA ACCU + 1
+226a : 30 04 __ BMI $2270
+226c : 05 1b __ ORA ACCU + 0
+226e : d0 d2 __ BNE $2242
+2270 : c8 __ __ INY
+2271 : 4c 50 08 JMP $0850 ; (startup + 79)
+2274 : a5 1c __ LDA ACCU + 1
+2276 : 10 ca __ BPL $2242
+2278 : c8 __ __ INY
+2279 : 4c 50 08 JMP $0850 ; (startup + 79)
+227c : a5 1c __ LDA ACCU + 1
+227e : 30 c2 __ BMI $2242
+2280 : c8 __ __ INY
+2281 : 4c 50 08 JMP $0850 ; (startup + 79)
+2284 : a5 1c __ LDA ACCU + 1
+2286 : 30 ba __ BMI $2242
+2288 : 05 1b __ ORA ACCU + 0
+228a : f0 b6 __ BEQ $2242
+228c : c8 __ __ INY
+228d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2290 : a9 00 __ LDA #$00
+2292 : 2c a9 01 BIT $01a9 
+2295 : 85 1b __ STA ACCU + 0
+2297 : a9 00 __ LDA #$00
+2299 : 85 1c __ STA ACCU + 1
+229b : 4c 51 08 JMP $0851 ; (startup + 80)
+229e : a5 1b __ LDA ACCU + 0
+22a0 : 05 1c __ ORA ACCU + 1
+22a2 : f0 ef __ BEQ $2293
+22a4 : d0 ea __ BNE $2290
+22a6 : a5 1b __ LDA ACCU + 0
+22a8 : 05 1c __ ORA ACCU + 1
+22aa : d0 e7 __ BNE $2293
+22ac : f0 e2 __ BEQ $2290
+22ae : a5 1c __ LDA ACCU + 1
+22b0 : 30 de __ BMI $2290
+22b2 : 05 1b __ ORA ACCU + 0
+22b4 : d0 dd __ BNE $2293
+22b6 : f0 d8 __ BEQ $2290
+22b8 : a5 1c __ LDA ACCU + 1
+22ba : 10 d7 __ BPL $2293
+22bc : 30 d2 __ BMI $2290
+22be : a5 1c __ LDA ACCU + 1
+22c0 : 30 d1 __ BMI $2293
+22c2 : 10 cc __ BPL $2290
+22c4 : a5 1c __ LDA ACCU + 1
+22c6 : 30 cb __ BMI $2293
+22c8 : 05 1b __ ORA ACCU + 0
+22ca : f0 c7 __ BEQ $2293
+22cc : d0 c2 __ BNE $2290
+22ce : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+22cf : b1 19 __ LDA (IP + 0),y
+22d1 : 8d e5 22 STA $22e5 ; (inp_jsr + 22)
+22d4 : c8 __ __ INY
+22d5 : b1 19 __ LDA (IP + 0),y
+22d7 : 8d e6 22 STA $22e6 ; (inp_jsr + 23)
+22da : 98 __ __ TYA
+22db : 38 __ __ SEC
+22dc : 65 19 __ ADC IP + 0
+22de : 85 19 __ STA IP + 0
+22e0 : 90 02 __ BCC $22e4
+22e2 : e6 1a __ INC IP + 1
+22e4 : 20 00 00 JSR $0000 
+22e7 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+22ea : 98 __ __ TYA
+22eb : 18 __ __ CLC
+22ec : 65 19 __ ADC IP + 0
+22ee : 8d f9 22 STA $22f9 ; (inp_native + 15)
+22f1 : a5 1a __ LDA IP + 1
+22f3 : 69 00 __ ADC #$00
+22f5 : 8d fa 22 STA $22fa ; (inp_native + 16)
+22f8 : 20 00 00 JSR $0000 
+22fb : a0 00 __ LDY #$00
+22fd : b1 23 __ LDA (SP + 0),y
+22ff : 85 19 __ STA IP + 0
+2301 : c8 __ __ INY
+2302 : b1 23 __ LDA (SP + 0),y
+2304 : 85 1a __ STA IP + 1
+2306 : 88 __ __ DEY
+2307 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+230a : 38 __ __ SEC
+230b : a5 23 __ LDA SP + 0
+230d : f1 19 __ SBC (IP + 0),y
+230f : c8 __ __ INY
+2310 : 85 23 __ STA SP + 0
+2312 : a5 24 __ LDA SP + 1
+2314 : f1 19 __ SBC (IP + 0),y
+2316 : c8 __ __ INY
+2317 : 85 24 __ STA SP + 1
+2319 : b1 19 __ LDA (IP + 0),y
+231b : 84 02 __ STY $02
+231d : a8 __ __ TAY
+231e : a5 25 __ LDA FP + 0
+2320 : 91 23 __ STA (SP + 0),y
+2322 : c8 __ __ INY
+2323 : a5 26 __ LDA FP + 1
+2325 : 91 23 __ STA (SP + 0),y
+2327 : 98 __ __ TYA
+2328 : 38 __ __ SEC
+2329 : 65 23 __ ADC SP + 0
+232b : 85 25 __ STA FP + 0
+232d : a9 00 __ LDA #$00
+232f : 65 24 __ ADC SP + 1
+2331 : 85 26 __ STA FP + 1
+2333 : 88 __ __ DEY
+2334 : f0 08 __ BEQ $233e
+2336 : b9 52 00 LDA $0052,y 
+2339 : 88 __ __ DEY
+233a : 91 23 __ STA (SP + 0),y
+233c : d0 f8 __ BNE $2336
+233e : a4 02 __ LDY $02
+2340 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2343 : b1 19 __ LDA (IP + 0),y
+2345 : c8 __ __ INY
+2346 : 84 02 __ STY $02
+2348 : a8 __ __ TAY
+2349 : b1 23 __ LDA (SP + 0),y
+234b : 85 25 __ STA FP + 0
+234d : c8 __ __ INY
+234e : b1 23 __ LDA (SP + 0),y
+2350 : 85 26 __ STA FP + 1
+2352 : 88 __ __ DEY
+2353 : f0 09 __ BEQ $235e
+2355 : 88 __ __ DEY
+2356 : b1 23 __ LDA (SP + 0),y
+2358 : 99 53 00 STA $0053,y 
+235b : 88 __ __ DEY
+235c : 10 f8 __ BPL $2356
+235e : a4 02 __ LDY $02
+2360 : 18 __ __ CLC
+2361 : b1 19 __ LDA (IP + 0),y
+2363 : c8 __ __ INY
+2364 : 65 23 __ ADC SP + 0
+2366 : 85 23 __ STA SP + 0
+2368 : b1 19 __ LDA (IP + 0),y
+236a : c8 __ __ INY
+236b : 65 24 __ ADC SP + 1
+236d : 85 24 __ STA SP + 1
+236f : a0 01 __ LDY #$01
+2371 : b1 23 __ LDA (SP + 0),y
+2373 : 85 1a __ STA IP + 1
+2375 : 88 __ __ DEY
+2376 : b1 23 __ LDA (SP + 0),y
+2378 : 85 19 __ STA IP + 0
+237a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+237d : b1 19 __ LDA (IP + 0),y
+237f : 85 1f __ STA ADDR + 0
+2381 : c8 __ __ INY
+2382 : b1 19 __ LDA (IP + 0),y
+2384 : 85 20 __ STA ADDR + 1
+2386 : c8 __ __ INY
+2387 : 98 __ __ TYA
+2388 : a0 00 __ LDY #$00
+238a : 18 __ __ CLC
+238b : 65 19 __ ADC IP + 0
+238d : 91 23 __ STA (SP + 0),y
+238f : c8 __ __ INY
+2390 : a5 1a __ LDA IP + 1
+2392 : 69 00 __ ADC #$00
+2394 : 91 23 __ STA (SP + 0),y
+2396 : a5 1f __ LDA ADDR + 0
+2398 : 85 19 __ STA IP + 0
+239a : a5 20 __ LDA ADDR + 1
+239c : 85 1a __ STA IP + 1
+239e : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+23a1 : 38 __ __ SEC
+23a2 : a5 23 __ LDA SP + 0
+23a4 : f1 19 __ SBC (IP + 0),y
+23a6 : c8 __ __ INY
+23a7 : 85 23 __ STA SP + 0
+23a9 : a5 24 __ LDA SP + 1
+23ab : f1 19 __ SBC (IP + 0),y
+23ad : 85 24 __ STA SP + 1
+23af : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+23b2 : 18 __ __ CLC
+23b3 : b1 19 __ LDA (IP + 0),y
+23b5 : c8 __ __ INY
+23b6 : 65 23 __ ADC SP + 0
+23b8 : 85 23 __ STA SP + 0
+23ba : b1 19 __ LDA (IP + 0),y
+23bc : 65 24 __ ADC SP + 1
+23be : 85 24 __ STA SP + 1
+23c0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+23c3 : b1 19 __ LDA (IP + 0),y
+23c5 : 84 02 __ STY $02
+23c7 : a8 __ __ TAY
+23c8 : 88 __ __ DEY
+23c9 : f0 07 __ BEQ $23d2
+23cb : b1 1b __ LDA (ACCU + 0),y
+23cd : 91 1f __ STA (ADDR + 0),y
+23cf : 88 __ __ DEY
+23d0 : d0 f9 __ BNE $23cb
+23d2 : b1 1b __ LDA (ACCU + 0),y
+23d4 : 91 1f __ STA (ADDR + 0),y
+23d6 : a4 02 __ LDY $02
+23d8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+23db : b1 19 __ LDA (IP + 0),y
+23dd : c8 __ __ INY
+23de : 8d ec 23 STA $23ec ; (inp_op_extrt + 17)
+23e1 : b1 19 __ LDA (IP + 0),y
+23e3 : c8 __ __ INY
+23e4 : 8d ed 23 STA $23ed ; (inp_op_extrt + 18)
+23e7 : b1 19 __ LDA (IP + 0),y
+23e9 : c8 __ __ INY
+23ea : aa __ __ TAX
+23eb : 20 00 00 JSR $0000 
+23ee : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,3630 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 83 23 STX $2383 ; (spentry + 0)
+0811 : a9 87 __ LDA #$87
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 52 __ LDA #$52
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 67 __ LDA #$67
+0832 : e9 87 __ SBC #$87
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 30 1f JMP $1f30 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 02 __ SBC #$02
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : 38 __ __ SEC
+090e : a5 23 __ LDA SP + 0
+0910 : e9 06 __ SBC #$06
+0912 : 85 23 __ STA SP + 0
+0914 : a5 24 __ LDA SP + 1
+0916 : e9 00 __ SBC #$00
+0918 : 85 24 __ STA SP + 1
+091a : a9 87 __ LDA #$87
+091c : a0 02 __ LDY #$02
+091e : 91 23 __ STA (SP + 0),y
+0920 : a9 23 __ LDA #$23
+0922 : c8 __ __ INY
+0923 : 91 23 __ STA (SP + 0),y
+0925 : a9 e8 __ LDA #$e8
+0927 : c8 __ __ INY
+0928 : 91 23 __ STA (SP + 0),y
+092a : a9 03 __ LDA #$03
+092c : c8 __ __ INY
+092d : 91 23 __ STA (SP + 0),y
+092f : 20 9b 09 JSR $099b ; (init + 0)
+0932 : a9 87 __ LDA #$87
+0934 : a0 02 __ LDY #$02
+0936 : 91 23 __ STA (SP + 0),y
+0938 : a9 23 __ LDA #$23
+093a : c8 __ __ INY
+093b : 91 23 __ STA (SP + 0),y
+093d : a9 e8 __ LDA #$e8
+093f : c8 __ __ INY
+0940 : 91 23 __ STA (SP + 0),y
+0942 : a9 03 __ LDA #$03
+0944 : c8 __ __ INY
+0945 : 91 23 __ STA (SP + 0),y
+0947 : 20 eb 1a JSR $1aeb ; (shuffle + 0)
+094a : a9 87 __ LDA #$87
+094c : a0 02 __ LDY #$02
+094e : 91 23 __ STA (SP + 0),y
+0950 : a9 23 __ LDA #$23
+0952 : c8 __ __ INY
+0953 : 91 23 __ STA (SP + 0),y
+0955 : a9 e8 __ LDA #$e8
+0957 : c8 __ __ INY
+0958 : 91 23 __ STA (SP + 0),y
+095a : a9 03 __ LDA #$03
+095c : c8 __ __ INY
+095d : 91 23 __ STA (SP + 0),y
+095f : 20 fb 1b JSR $1bfb ; (qsort + 0)
+0962 : a9 87 __ LDA #$87
+0964 : a0 02 __ LDY #$02
+0966 : 91 23 __ STA (SP + 0),y
+0968 : a9 23 __ LDA #$23
+096a : c8 __ __ INY
+096b : 91 23 __ STA (SP + 0),y
+096d : a9 e8 __ LDA #$e8
+096f : c8 __ __ INY
+0970 : 91 23 __ STA (SP + 0),y
+0972 : a9 03 __ LDA #$03
+0974 : c8 __ __ INY
+0975 : 91 23 __ STA (SP + 0),y
+0977 : 20 7d 1e JSR $1e7d ; (check + 0)
+097a : a9 00 __ LDA #$00
+097c : 85 1b __ STA ACCU + 0
+097e : 85 1c __ STA ACCU + 1
+0980 : 18 __ __ CLC
+0981 : a5 23 __ LDA SP + 0
+0983 : 69 06 __ ADC #$06
+0985 : 85 23 __ STA SP + 0
+0987 : a5 24 __ LDA SP + 1
+0989 : 69 00 __ ADC #$00
+098b : 85 24 __ STA SP + 1
+098d : 18 __ __ CLC
+098e : a5 23 __ LDA SP + 0
+0990 : 69 02 __ ADC #$02
+0992 : 85 23 __ STA SP + 0
+0994 : a5 24 __ LDA SP + 1
+0996 : 69 00 __ ADC #$00
+0998 : 85 24 __ STA SP + 1
+099a : 60 __ __ RTS
+--------------------------------------------------------------------
+init:
+099b : 38 __ __ SEC
+099c : a5 23 __ LDA SP + 0
+099e : e9 08 __ SBC #$08
+09a0 : 85 23 __ STA SP + 0
+09a2 : a5 24 __ LDA SP + 1
+09a4 : e9 00 __ SBC #$00
+09a6 : 85 24 __ STA SP + 1
+09a8 : a0 05 __ LDY #$05
+09aa : b9 53 00 LDA $0053,y 
+09ad : 91 23 __ STA (SP + 0),y
+09af : 88 __ __ DEY
+09b0 : 10 f8 __ BPL $09aa
+09b2 : 38 __ __ SEC
+09b3 : a5 23 __ LDA SP + 0
+09b5 : e9 08 __ SBC #$08
+09b7 : 85 23 __ STA SP + 0
+09b9 : a5 24 __ LDA SP + 1
+09bb : e9 00 __ SBC #$00
+09bd : 85 24 __ STA SP + 1
+09bf : a0 14 __ LDY #$14
+09c1 : b1 23 __ LDA (SP + 0),y
+09c3 : 85 53 __ STA T0 + 0
+09c5 : c8 __ __ INY
+09c6 : b1 23 __ LDA (SP + 0),y
+09c8 : 30 04 __ BMI $09ce
+09ca : 05 53 __ ORA T0 + 0
+09cc : d0 25 __ BNE $09f3
+09ce : 18 __ __ CLC
+09cf : a5 23 __ LDA SP + 0
+09d1 : 69 08 __ ADC #$08
+09d3 : 85 23 __ STA SP + 0
+09d5 : a5 24 __ LDA SP + 1
+09d7 : 69 00 __ ADC #$00
+09d9 : 85 24 __ STA SP + 1
+09db : a0 05 __ LDY #$05
+09dd : b1 23 __ LDA (SP + 0),y
+09df : 99 53 00 STA $0053,y 
+09e2 : 88 __ __ DEY
+09e3 : 10 f8 __ BPL $09dd
+09e5 : 18 __ __ CLC
+09e6 : a5 23 __ LDA SP + 0
+09e8 : 69 08 __ ADC #$08
+09ea : 85 23 __ STA SP + 0
+09ec : a5 24 __ LDA SP + 1
+09ee : 69 00 __ ADC #$00
+09f0 : 85 24 __ STA SP + 1
+09f2 : 60 __ __ RTS
+09f3 : a9 00 __ LDA #$00
+09f5 : 85 53 __ STA T0 + 0
+09f7 : 85 54 __ STA T0 + 1
+09f9 : a0 12 __ LDY #$12
+09fb : b1 23 __ LDA (SP + 0),y
+09fd : 85 55 __ STA T2 + 0
+09ff : c8 __ __ INY
+0a00 : b1 23 __ LDA (SP + 0),y
+0a02 : 85 56 __ STA T2 + 1
+0a04 : c8 __ __ INY
+0a05 : b1 23 __ LDA (SP + 0),y
+0a07 : 85 57 __ STA T3 + 0
+0a09 : c8 __ __ INY
+0a0a : b1 23 __ LDA (SP + 0),y
+0a0c : 85 58 __ STA T3 + 1
+0a0e : a5 53 __ LDA T0 + 0
+0a10 : a0 00 __ LDY #$00
+0a12 : 91 55 __ STA (T2 + 0),y
+0a14 : a5 54 __ LDA T0 + 1
+0a16 : c8 __ __ INY
+0a17 : 91 55 __ STA (T2 + 0),y
+0a19 : 18 __ __ CLC
+0a1a : a5 55 __ LDA T2 + 0
+0a1c : 69 02 __ ADC #$02
+0a1e : c8 __ __ INY
+0a1f : 91 23 __ STA (SP + 0),y
+0a21 : a5 56 __ LDA T2 + 1
+0a23 : 69 00 __ ADC #$00
+0a25 : c8 __ __ INY
+0a26 : 91 23 __ STA (SP + 0),y
+0a28 : a9 e6 __ LDA #$e6
+0a2a : c8 __ __ INY
+0a2b : 91 23 __ STA (SP + 0),y
+0a2d : a9 1a __ LDA #$1a
+0a2f : c8 __ __ INY
+0a30 : 91 23 __ STA (SP + 0),y
+0a32 : a5 53 __ LDA T0 + 0
+0a34 : c8 __ __ INY
+0a35 : 91 23 __ STA (SP + 0),y
+0a37 : a5 54 __ LDA T0 + 1
+0a39 : c8 __ __ INY
+0a3a : 91 23 __ STA (SP + 0),y
+0a3c : 20 67 0a JSR $0a67 ; (sprintf + 0)
+0a3f : 18 __ __ CLC
+0a40 : a5 55 __ LDA T2 + 0
+0a42 : 69 0c __ ADC #$0c
+0a44 : 85 55 __ STA T2 + 0
+0a46 : 90 02 __ BCC $0a4a
+0a48 : e6 56 __ INC T2 + 1
+0a4a : e6 53 __ INC T0 + 0
+0a4c : d0 02 __ BNE $0a50
+0a4e : e6 54 __ INC T0 + 1
+0a50 : a5 58 __ LDA T3 + 1
+0a52 : 49 80 __ EOR #$80
+0a54 : 85 03 __ STA $03
+0a56 : a5 54 __ LDA T0 + 1
+0a58 : 49 80 __ EOR #$80
+0a5a : c5 03 __ CMP $03
+0a5c : d0 04 __ BNE $0a62
+0a5e : a5 53 __ LDA T0 + 0
+0a60 : c5 57 __ CMP T3 + 0
+0a62 : 90 aa __ BCC $0a0e
+0a64 : 4c ce 09 JMP $09ce ; (init + 51)
+--------------------------------------------------------------------
+sprintf:
+0a67 : 38 __ __ SEC
+0a68 : a5 23 __ LDA SP + 0
+0a6a : e9 09 __ SBC #$09
+0a6c : 85 23 __ STA SP + 0
+0a6e : a5 24 __ LDA SP + 1
+0a70 : e9 00 __ SBC #$00
+0a72 : 85 24 __ STA SP + 1
+0a74 : a0 0b __ LDY #$0b
+0a76 : b1 23 __ LDA (SP + 0),y
+0a78 : a0 02 __ LDY #$02
+0a7a : 91 23 __ STA (SP + 0),y
+0a7c : a0 0c __ LDY #$0c
+0a7e : b1 23 __ LDA (SP + 0),y
+0a80 : a0 03 __ LDY #$03
+0a82 : 91 23 __ STA (SP + 0),y
+0a84 : a0 0d __ LDY #$0d
+0a86 : b1 23 __ LDA (SP + 0),y
+0a88 : a0 04 __ LDY #$04
+0a8a : 91 23 __ STA (SP + 0),y
+0a8c : a0 0e __ LDY #$0e
+0a8e : b1 23 __ LDA (SP + 0),y
+0a90 : a0 05 __ LDY #$05
+0a92 : 91 23 __ STA (SP + 0),y
+0a94 : 18 __ __ CLC
+0a95 : a5 23 __ LDA SP + 0
+0a97 : 69 0f __ ADC #$0f
+0a99 : c8 __ __ INY
+0a9a : 91 23 __ STA (SP + 0),y
+0a9c : a5 24 __ LDA SP + 1
+0a9e : 69 00 __ ADC #$00
+0aa0 : c8 __ __ INY
+0aa1 : 91 23 __ STA (SP + 0),y
+0aa3 : a9 00 __ LDA #$00
+0aa5 : c8 __ __ INY
+0aa6 : 91 23 __ STA (SP + 0),y
+0aa8 : 20 d1 0a JSR $0ad1 ; (sformat + 0)
+0aab : a0 0b __ LDY #$0b
+0aad : b1 23 __ LDA (SP + 0),y
+0aaf : 85 45 __ STA T1 + 0
+0ab1 : c8 __ __ INY
+0ab2 : b1 23 __ LDA (SP + 0),y
+0ab4 : 85 46 __ STA T1 + 1
+0ab6 : 38 __ __ SEC
+0ab7 : a5 1b __ LDA ACCU + 0
+0ab9 : e5 45 __ SBC T1 + 0
+0abb : 85 1b __ STA ACCU + 0
+0abd : a5 1c __ LDA ACCU + 1
+0abf : e5 46 __ SBC T1 + 1
+0ac1 : 85 1c __ STA ACCU + 1
+0ac3 : 18 __ __ CLC
+0ac4 : a5 23 __ LDA SP + 0
+0ac6 : 69 09 __ ADC #$09
+0ac8 : 85 23 __ STA SP + 0
+0aca : a5 24 __ LDA SP + 1
+0acc : 69 00 __ ADC #$00
+0ace : 85 24 __ STA SP + 1
+0ad0 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0ad1 : 38 __ __ SEC
+0ad2 : a5 23 __ LDA SP + 0
+0ad4 : e9 0e __ SBC #$0e
+0ad6 : 85 23 __ STA SP + 0
+0ad8 : a5 24 __ LDA SP + 1
+0ada : e9 00 __ SBC #$00
+0adc : 85 24 __ STA SP + 1
+0ade : a0 05 __ LDY #$05
+0ae0 : b9 53 00 LDA $0053,y 
+0ae3 : 91 23 __ STA (SP + 0),y
+0ae5 : 88 __ __ DEY
+0ae6 : 10 f8 __ BPL $0ae0
+0ae8 : a0 10 __ LDY #$10
+0aea : b1 23 __ LDA (SP + 0),y
+0aec : 85 53 __ STA T0 + 0
+0aee : c8 __ __ INY
+0aef : b1 23 __ LDA (SP + 0),y
+0af1 : 85 54 __ STA T0 + 1
+0af3 : a9 00 __ LDA #$00
+0af5 : 85 55 __ STA T1 + 0
+0af7 : c8 __ __ INY
+0af8 : b1 23 __ LDA (SP + 0),y
+0afa : 85 57 __ STA T2 + 0
+0afc : c8 __ __ INY
+0afd : b1 23 __ LDA (SP + 0),y
+0aff : 85 58 __ STA T2 + 1
+0b01 : a0 00 __ LDY #$00
+0b03 : b1 57 __ LDA (T2 + 0),y
+0b05 : 85 43 __ STA T3 + 0
+0b07 : d0 59 __ BNE $0b62
+0b09 : 18 __ __ CLC
+0b0a : a5 53 __ LDA T0 + 0
+0b0c : 65 55 __ ADC T1 + 0
+0b0e : 85 57 __ STA T2 + 0
+0b10 : a5 54 __ LDA T0 + 1
+0b12 : 69 00 __ ADC #$00
+0b14 : 85 58 __ STA T2 + 1
+0b16 : a9 00 __ LDA #$00
+0b18 : a4 55 __ LDY T1 + 0
+0b1a : 91 53 __ STA (T0 + 0),y
+0b1c : 98 __ __ TYA
+0b1d : d0 20 __ BNE $0b3f
+0b1f : a5 53 __ LDA T0 + 0
+0b21 : 85 1b __ STA ACCU + 0
+0b23 : a5 54 __ LDA T0 + 1
+0b25 : 85 1c __ STA ACCU + 1
+0b27 : a0 05 __ LDY #$05
+0b29 : b1 23 __ LDA (SP + 0),y
+0b2b : 99 53 00 STA $0053,y 
+0b2e : 88 __ __ DEY
+0b2f : 10 f8 __ BPL $0b29
+0b31 : 18 __ __ CLC
+0b32 : a5 23 __ LDA SP + 0
+0b34 : 69 0e __ ADC #$0e
+0b36 : 85 23 __ STA SP + 0
+0b38 : a5 24 __ LDA SP + 1
+0b3a : 69 00 __ ADC #$00
+0b3c : 85 24 __ STA SP + 1
+0b3e : 60 __ __ RTS
+0b3f : a0 16 __ LDY #$16
+0b41 : b1 23 __ LDA (SP + 0),y
+0b43 : d0 09 __ BNE $0b4e
+0b45 : a5 57 __ LDA T2 + 0
+0b47 : 85 1b __ STA ACCU + 0
+0b49 : a5 58 __ LDA T2 + 1
+0b4b : 4c 25 0b JMP $0b25 ; (sformat + 84)
+0b4e : a5 53 __ LDA T0 + 0
+0b50 : 85 0d __ STA P0
+0b52 : a5 54 __ LDA T0 + 1
+0b54 : 85 0e __ STA P1
+0b56 : 20 8c 10 JSR $108c ; (puts + 0)
+0b59 : a5 53 __ LDA T0 + 0
+0b5b : 85 1b __ STA ACCU + 0
+0b5d : a5 54 __ LDA T0 + 1
+0b5f : 4c 25 0b JMP $0b25 ; (sformat + 84)
+0b62 : e6 57 __ INC T2 + 0
+0b64 : d0 02 __ BNE $0b68
+0b66 : e6 58 __ INC T2 + 1
+0b68 : a5 43 __ LDA T3 + 0
+0b6a : c9 25 __ CMP #$25
+0b6c : f0 55 __ BEQ $0bc3
+0b6e : a4 55 __ LDY T1 + 0
+0b70 : 91 53 __ STA (T0 + 0),y
+0b72 : e6 55 __ INC T1 + 0
+0b74 : a5 55 __ LDA T1 + 0
+0b76 : c9 28 __ CMP #$28
+0b78 : 90 15 __ BCC $0b8f
+0b7a : a0 16 __ LDY #$16
+0b7c : b1 23 __ LDA (SP + 0),y
+0b7e : d0 22 __ BNE $0ba2
+0b80 : 18 __ __ CLC
+0b81 : a5 53 __ LDA T0 + 0
+0b83 : 65 55 __ ADC T1 + 0
+0b85 : 85 53 __ STA T0 + 0
+0b87 : 90 02 __ BCC $0b8b
+0b89 : e6 54 __ INC T0 + 1
+0b8b : a9 00 __ LDA #$00
+0b8d : 85 55 __ STA T1 + 0
+0b8f : a0 00 __ LDY #$00
+0b91 : b1 57 __ LDA (T2 + 0),y
+0b93 : aa __ __ TAX
+0b94 : e6 57 __ INC T2 + 0
+0b96 : d0 02 __ BNE $0b9a
+0b98 : e6 58 __ INC T2 + 1
+0b9a : 8a __ __ TXA
+0b9b : 86 43 __ STX T3 + 0
+0b9d : d0 c9 __ BNE $0b68
+0b9f : 4c 09 0b JMP $0b09 ; (sformat + 56)
+0ba2 : 18 __ __ CLC
+0ba3 : a5 53 __ LDA T0 + 0
+0ba5 : 85 0d __ STA P0
+0ba7 : 65 55 __ ADC T1 + 0
+0ba9 : 85 45 __ STA T5 + 0
+0bab : a5 54 __ LDA T0 + 1
+0bad : 85 0e __ STA P1
+0baf : 69 00 __ ADC #$00
+0bb1 : 85 46 __ STA T5 + 1
+0bb3 : a9 00 __ LDA #$00
+0bb5 : a0 00 __ LDY #$00
+0bb7 : 91 45 __ STA (T5 + 0),y
+0bb9 : 20 8c 10 JSR $108c ; (puts + 0)
+0bbc : a9 00 __ LDA #$00
+0bbe : 85 55 __ STA T1 + 0
+0bc0 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0bc3 : a5 55 __ LDA T1 + 0
+0bc5 : f0 03 __ BEQ $0bca
+0bc7 : 4c 53 10 JMP $1053 ; (sformat + 1410)
+0bca : a0 00 __ LDY #$00
+0bcc : b1 57 __ LDA (T2 + 0),y
+0bce : 85 43 __ STA T3 + 0
+0bd0 : a9 0a __ LDA #$0a
+0bd2 : a0 09 __ LDY #$09
+0bd4 : 91 23 __ STA (SP + 0),y
+0bd6 : a9 00 __ LDA #$00
+0bd8 : c8 __ __ INY
+0bd9 : 91 23 __ STA (SP + 0),y
+0bdb : a9 01 __ LDA #$01
+0bdd : a0 07 __ LDY #$07
+0bdf : 91 23 __ STA (SP + 0),y
+0be1 : a9 ff __ LDA #$ff
+0be3 : c8 __ __ INY
+0be4 : 91 23 __ STA (SP + 0),y
+0be6 : a9 20 __ LDA #$20
+0be8 : a0 06 __ LDY #$06
+0bea : 91 23 __ STA (SP + 0),y
+0bec : a9 00 __ LDA #$00
+0bee : a0 0b __ LDY #$0b
+0bf0 : 91 23 __ STA (SP + 0),y
+0bf2 : c8 __ __ INY
+0bf3 : 91 23 __ STA (SP + 0),y
+0bf5 : c8 __ __ INY
+0bf6 : 91 23 __ STA (SP + 0),y
+0bf8 : e6 57 __ INC T2 + 0
+0bfa : d0 02 __ BNE $0bfe
+0bfc : e6 58 __ INC T2 + 1
+0bfe : a5 43 __ LDA T3 + 0
+0c00 : c9 2b __ CMP #$2b
+0c02 : d0 03 __ BNE $0c07
+0c04 : 4c 44 10 JMP $1044 ; (sformat + 1395)
+0c07 : c9 30 __ CMP #$30
+0c09 : d0 03 __ BNE $0c0e
+0c0b : 4c 35 10 JMP $1035 ; (sformat + 1380)
+0c0e : c9 23 __ CMP #$23
+0c10 : d0 03 __ BNE $0c15
+0c12 : 4c 26 10 JMP $1026 ; (sformat + 1365)
+0c15 : c9 30 __ CMP #$30
+0c17 : 90 65 __ BCC $0c7e
+0c19 : a9 39 __ LDA #$39
+0c1b : c5 43 __ CMP T3 + 0
+0c1d : 90 5f __ BCC $0c7e
+0c1f : a9 00 __ LDA #$00
+0c21 : 85 45 __ STA T5 + 0
+0c23 : 85 46 __ STA T5 + 1
+0c25 : a5 43 __ LDA T3 + 0
+0c27 : c9 30 __ CMP #$30
+0c29 : 90 4d __ BCC $0c78
+0c2b : a9 39 __ LDA #$39
+0c2d : c5 43 __ CMP T3 + 0
+0c2f : 90 47 __ BCC $0c78
+0c31 : a5 43 __ LDA T3 + 0
+0c33 : 85 47 __ STA T6 + 0
+0c35 : a0 00 __ LDY #$00
+0c37 : b1 57 __ LDA (T2 + 0),y
+0c39 : 85 43 __ STA T3 + 0
+0c3b : e6 57 __ INC T2 + 0
+0c3d : d0 02 __ BNE $0c41
+0c3f : e6 58 __ INC T2 + 1
+0c41 : a5 45 __ LDA T5 + 0
+0c43 : 0a __ __ ASL
+0c44 : 85 07 __ STA $07
+0c46 : a5 46 __ LDA T5 + 1
+0c48 : 2a __ __ ROL
+0c49 : 06 07 __ ASL $07
+0c4b : 2a __ __ ROL
+0c4c : aa __ __ TAX
+0c4d : 18 __ __ CLC
+0c4e : a5 07 __ LDA $07
+0c50 : 65 45 __ ADC T5 + 0
+0c52 : 85 1b __ STA ACCU + 0
+0c54 : 8a __ __ TXA
+0c55 : 65 46 __ ADC T5 + 1
+0c57 : 06 1b __ ASL ACCU + 0
+0c59 : 2a __ __ ROL
+0c5a : 85 1c __ STA ACCU + 1
+0c5c : 18 __ __ CLC
+0c5d : a5 1b __ LDA ACCU + 0
+0c5f : 65 47 __ ADC T6 + 0
+0c61 : aa __ __ TAX
+0c62 : a5 1c __ LDA ACCU + 1
+0c64 : 69 00 __ ADC #$00
+0c66 : a8 __ __ TAY
+0c67 : 38 __ __ SEC
+0c68 : 8a __ __ TXA
+0c69 : e9 30 __ SBC #$30
+0c6b : 85 45 __ STA T5 + 0
+0c6d : 98 __ __ TYA
+0c6e : e9 00 __ SBC #$00
+0c70 : 85 46 __ STA T5 + 1
+0c72 : a5 43 __ LDA T3 + 0
+0c74 : c9 30 __ CMP #$30
+0c76 : b0 b3 __ BCS $0c2b
+0c78 : a5 45 __ LDA T5 + 0
+0c7a : a0 07 __ LDY #$07
+0c7c : 91 23 __ STA (SP + 0),y
+0c7e : a5 43 __ LDA T3 + 0
+0c80 : c9 2e __ CMP #$2e
+0c82 : d0 03 __ BNE $0c87
+0c84 : 4c b8 0f JMP $0fb8 ; (sformat + 1255)
+0c87 : a5 43 __ LDA T3 + 0
+0c89 : c9 64 __ CMP #$64
+0c8b : d0 03 __ BNE $0c90
+0c8d : 4c 6e 0f JMP $0f6e ; (sformat + 1181)
+0c90 : c9 75 __ CMP #$75
+0c92 : d0 03 __ BNE $0c97
+0c94 : 4c 24 0f JMP $0f24 ; (sformat + 1107)
+0c97 : c9 78 __ CMP #$78
+0c99 : d0 03 __ BNE $0c9e
+0c9b : 4c cf 0e JMP $0ecf ; (sformat + 1022)
+0c9e : c9 6c __ CMP #$6c
+0ca0 : d0 03 __ BNE $0ca5
+0ca2 : 4c d9 0d JMP $0dd9 ; (sformat + 776)
+0ca5 : c9 66 __ CMP #$66
+0ca7 : d0 03 __ BNE $0cac
+0ca9 : 4c 6f 0d JMP $0d6f ; (sformat + 670)
+0cac : c9 67 __ CMP #$67
+0cae : d0 03 __ BNE $0cb3
+0cb0 : 4c 6f 0d JMP $0d6f ; (sformat + 670)
+0cb3 : c9 65 __ CMP #$65
+0cb5 : d0 03 __ BNE $0cba
+0cb7 : 4c 6f 0d JMP $0d6f ; (sformat + 670)
+0cba : c9 73 __ CMP #$73
+0cbc : f0 3f __ BEQ $0cfd
+0cbe : c9 63 __ CMP #$63
+0cc0 : f0 12 __ BEQ $0cd4
+0cc2 : 09 00 __ ORA #$00
+0cc4 : d0 03 __ BNE $0cc9
+0cc6 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0cc9 : a5 43 __ LDA T3 + 0
+0ccb : a4 55 __ LDY T1 + 0
+0ccd : 91 53 __ STA (T0 + 0),y
+0ccf : e6 55 __ INC T1 + 0
+0cd1 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0cd4 : a0 14 __ LDY #$14
+0cd6 : b1 23 __ LDA (SP + 0),y
+0cd8 : 85 45 __ STA T5 + 0
+0cda : 18 __ __ CLC
+0cdb : 69 02 __ ADC #$02
+0cdd : aa __ __ TAX
+0cde : c8 __ __ INY
+0cdf : b1 23 __ LDA (SP + 0),y
+0ce1 : 85 46 __ STA T5 + 1
+0ce3 : 69 00 __ ADC #$00
+0ce5 : 85 48 __ STA T6 + 1
+0ce7 : 8a __ __ TXA
+0ce8 : 88 __ __ DEY
+0ce9 : 91 23 __ STA (SP + 0),y
+0ceb : a5 48 __ LDA T6 + 1
+0ced : c8 __ __ INY
+0cee : 91 23 __ STA (SP + 0),y
+0cf0 : a0 00 __ LDY #$00
+0cf2 : b1 45 __ LDA (T5 + 0),y
+0cf4 : a4 55 __ LDY T1 + 0
+0cf6 : 91 53 __ STA (T0 + 0),y
+0cf8 : e6 55 __ INC T1 + 0
+0cfa : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0cfd : a0 14 __ LDY #$14
+0cff : b1 23 __ LDA (SP + 0),y
+0d01 : 85 45 __ STA T5 + 0
+0d03 : 18 __ __ CLC
+0d04 : 69 02 __ ADC #$02
+0d06 : aa __ __ TAX
+0d07 : c8 __ __ INY
+0d08 : b1 23 __ LDA (SP + 0),y
+0d0a : 85 46 __ STA T5 + 1
+0d0c : 69 00 __ ADC #$00
+0d0e : 85 48 __ STA T6 + 1
+0d10 : 8a __ __ TXA
+0d11 : 88 __ __ DEY
+0d12 : 91 23 __ STA (SP + 0),y
+0d14 : a5 48 __ LDA T6 + 1
+0d16 : c8 __ __ INY
+0d17 : 91 23 __ STA (SP + 0),y
+0d19 : a0 00 __ LDY #$00
+0d1b : b1 45 __ LDA (T5 + 0),y
+0d1d : 85 02 __ STA $02
+0d1f : c8 __ __ INY
+0d20 : b1 45 __ LDA (T5 + 0),y
+0d22 : 85 46 __ STA T5 + 1
+0d24 : a5 02 __ LDA $02
+0d26 : 85 45 __ STA T5 + 0
+0d28 : a0 16 __ LDY #$16
+0d2a : b1 23 __ LDA (SP + 0),y
+0d2c : d0 33 __ BNE $0d61
+0d2e : a0 00 __ LDY #$00
+0d30 : b1 45 __ LDA (T5 + 0),y
+0d32 : 85 43 __ STA T3 + 0
+0d34 : d0 03 __ BNE $0d39
+0d36 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0d39 : 18 __ __ CLC
+0d3a : a5 02 __ LDA $02
+0d3c : 69 01 __ ADC #$01
+0d3e : 85 45 __ STA T5 + 0
+0d40 : 90 02 __ BCC $0d44
+0d42 : e6 46 __ INC T5 + 1
+0d44 : a5 43 __ LDA T3 + 0
+0d46 : a0 00 __ LDY #$00
+0d48 : 91 53 __ STA (T0 + 0),y
+0d4a : e6 53 __ INC T0 + 0
+0d4c : d0 02 __ BNE $0d50
+0d4e : e6 54 __ INC T0 + 1
+0d50 : b1 45 __ LDA (T5 + 0),y
+0d52 : aa __ __ TAX
+0d53 : e6 45 __ INC T5 + 0
+0d55 : d0 02 __ BNE $0d59
+0d57 : e6 46 __ INC T5 + 1
+0d59 : 8a __ __ TXA
+0d5a : 86 43 __ STX T3 + 0
+0d5c : d0 e6 __ BNE $0d44
+0d5e : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0d61 : a5 02 __ LDA $02
+0d63 : 85 0d __ STA P0
+0d65 : a5 46 __ LDA T5 + 1
+0d67 : 85 0e __ STA P1
+0d69 : 20 8c 10 JSR $108c ; (puts + 0)
+0d6c : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0d6f : 18 __ __ CLC
+0d70 : a5 23 __ LDA SP + 0
+0d72 : 69 06 __ ADC #$06
+0d74 : 85 0d __ STA P0
+0d76 : a5 24 __ LDA SP + 1
+0d78 : 69 00 __ ADC #$00
+0d7a : 85 0e __ STA P1
+0d7c : a5 53 __ LDA T0 + 0
+0d7e : 85 0f __ STA P2
+0d80 : a5 54 __ LDA T0 + 1
+0d82 : 85 10 __ STA P3
+0d84 : a0 14 __ LDY #$14
+0d86 : b1 23 __ LDA (SP + 0),y
+0d88 : 85 45 __ STA T5 + 0
+0d8a : c8 __ __ INY
+0d8b : b1 23 __ LDA (SP + 0),y
+0d8d : 85 46 __ STA T5 + 1
+0d8f : a0 00 __ LDY #$00
+0d91 : b1 45 __ LDA (T5 + 0),y
+0d93 : 85 11 __ STA P4
+0d95 : c8 __ __ INY
+0d96 : b1 45 __ LDA (T5 + 0),y
+0d98 : 85 12 __ STA P5
+0d9a : c8 __ __ INY
+0d9b : b1 45 __ LDA (T5 + 0),y
+0d9d : 85 13 __ STA P6
+0d9f : c8 __ __ INY
+0da0 : b1 45 __ LDA (T5 + 0),y
+0da2 : 85 14 __ STA P7
+0da4 : 20 6b 14 JSR $146b ; (nformf + 0)
+0da7 : a5 1b __ LDA ACCU + 0
+0da9 : 85 55 __ STA T1 + 0
+0dab : a0 14 __ LDY #$14
+0dad : b1 23 __ LDA (SP + 0),y
+0daf : 85 45 __ STA T5 + 0
+0db1 : 18 __ __ CLC
+0db2 : 69 02 __ ADC #$02
+0db4 : aa __ __ TAX
+0db5 : c8 __ __ INY
+0db6 : b1 23 __ LDA (SP + 0),y
+0db8 : 85 46 __ STA T5 + 1
+0dba : 69 00 __ ADC #$00
+0dbc : 85 48 __ STA T6 + 1
+0dbe : 8a __ __ TXA
+0dbf : 88 __ __ DEY
+0dc0 : 91 23 __ STA (SP + 0),y
+0dc2 : a5 48 __ LDA T6 + 1
+0dc4 : c8 __ __ INY
+0dc5 : 91 23 __ STA (SP + 0),y
+0dc7 : 18 __ __ CLC
+0dc8 : a5 45 __ LDA T5 + 0
+0dca : 69 04 __ ADC #$04
+0dcc : 88 __ __ DEY
+0dcd : 91 23 __ STA (SP + 0),y
+0dcf : a5 46 __ LDA T5 + 1
+0dd1 : 69 00 __ ADC #$00
+0dd3 : c8 __ __ INY
+0dd4 : 91 23 __ STA (SP + 0),y
+0dd6 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0dd9 : a0 14 __ LDY #$14
+0ddb : b1 23 __ LDA (SP + 0),y
+0ddd : 85 45 __ STA T5 + 0
+0ddf : 18 __ __ CLC
+0de0 : 69 02 __ ADC #$02
+0de2 : aa __ __ TAX
+0de3 : c8 __ __ INY
+0de4 : b1 23 __ LDA (SP + 0),y
+0de6 : 85 46 __ STA T5 + 1
+0de8 : a0 00 __ LDY #$00
+0dea : b1 45 __ LDA (T5 + 0),y
+0dec : 85 49 __ STA T7 + 0
+0dee : c8 __ __ INY
+0def : b1 45 __ LDA (T5 + 0),y
+0df1 : 85 4a __ STA T7 + 1
+0df3 : c8 __ __ INY
+0df4 : b1 45 __ LDA (T5 + 0),y
+0df6 : 85 4b __ STA T7 + 2
+0df8 : c8 __ __ INY
+0df9 : b1 45 __ LDA (T5 + 0),y
+0dfb : 85 4c __ STA T7 + 3
+0dfd : a5 46 __ LDA T5 + 1
+0dff : 69 00 __ ADC #$00
+0e01 : 85 48 __ STA T6 + 1
+0e03 : 8a __ __ TXA
+0e04 : a0 14 __ LDY #$14
+0e06 : 91 23 __ STA (SP + 0),y
+0e08 : a5 48 __ LDA T6 + 1
+0e0a : c8 __ __ INY
+0e0b : 91 23 __ STA (SP + 0),y
+0e0d : 18 __ __ CLC
+0e0e : a5 45 __ LDA T5 + 0
+0e10 : 69 04 __ ADC #$04
+0e12 : 88 __ __ DEY
+0e13 : 91 23 __ STA (SP + 0),y
+0e15 : a5 46 __ LDA T5 + 1
+0e17 : 69 00 __ ADC #$00
+0e19 : c8 __ __ INY
+0e1a : 91 23 __ STA (SP + 0),y
+0e1c : a0 00 __ LDY #$00
+0e1e : b1 57 __ LDA (T2 + 0),y
+0e20 : aa __ __ TAX
+0e21 : e6 57 __ INC T2 + 0
+0e23 : d0 02 __ BNE $0e27
+0e25 : e6 58 __ INC T2 + 1
+0e27 : 8a __ __ TXA
+0e28 : e0 64 __ CPX #$64
+0e2a : f0 74 __ BEQ $0ea0
+0e2c : c9 75 __ CMP #$75
+0e2e : f0 41 __ BEQ $0e71
+0e30 : c9 78 __ CMP #$78
+0e32 : f0 03 __ BEQ $0e37
+0e34 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0e37 : a9 10 __ LDA #$10
+0e39 : a0 09 __ LDY #$09
+0e3b : 91 23 __ STA (SP + 0),y
+0e3d : a9 00 __ LDA #$00
+0e3f : c8 __ __ INY
+0e40 : 91 23 __ STA (SP + 0),y
+0e42 : 18 __ __ CLC
+0e43 : a5 23 __ LDA SP + 0
+0e45 : 69 06 __ ADC #$06
+0e47 : 85 0d __ STA P0
+0e49 : a5 24 __ LDA SP + 1
+0e4b : 69 00 __ ADC #$00
+0e4d : 85 0e __ STA P1
+0e4f : a5 53 __ LDA T0 + 0
+0e51 : 85 0f __ STA P2
+0e53 : a5 54 __ LDA T0 + 1
+0e55 : 85 10 __ STA P3
+0e57 : a5 49 __ LDA T7 + 0
+0e59 : 85 11 __ STA P4
+0e5b : a5 4a __ LDA T7 + 1
+0e5d : 85 12 __ STA P5
+0e5f : a5 4b __ LDA T7 + 2
+0e61 : 85 13 __ STA P6
+0e63 : a5 4c __ LDA T7 + 3
+0e65 : 85 14 __ STA P7
+0e67 : 20 3e 12 JSR $123e ; (nforml + 0)
+0e6a : a5 1b __ LDA ACCU + 0
+0e6c : 85 55 __ STA T1 + 0
+0e6e : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0e71 : 18 __ __ CLC
+0e72 : a5 23 __ LDA SP + 0
+0e74 : 69 06 __ ADC #$06
+0e76 : 85 0d __ STA P0
+0e78 : a5 24 __ LDA SP + 1
+0e7a : 69 00 __ ADC #$00
+0e7c : 85 0e __ STA P1
+0e7e : a5 53 __ LDA T0 + 0
+0e80 : 85 0f __ STA P2
+0e82 : a5 54 __ LDA T0 + 1
+0e84 : 85 10 __ STA P3
+0e86 : a5 49 __ LDA T7 + 0
+0e88 : 85 11 __ STA P4
+0e8a : a5 4a __ LDA T7 + 1
+0e8c : 85 12 __ STA P5
+0e8e : a5 4b __ LDA T7 + 2
+0e90 : 85 13 __ STA P6
+0e92 : a5 4c __ LDA T7 + 3
+0e94 : 85 14 __ STA P7
+0e96 : 20 3e 12 JSR $123e ; (nforml + 0)
+0e99 : a5 1b __ LDA ACCU + 0
+0e9b : 85 55 __ STA T1 + 0
+0e9d : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0ea0 : 18 __ __ CLC
+0ea1 : a5 23 __ LDA SP + 0
+0ea3 : 69 06 __ ADC #$06
+0ea5 : 85 0d __ STA P0
+0ea7 : a5 24 __ LDA SP + 1
+0ea9 : 69 00 __ ADC #$00
+0eab : 85 0e __ STA P1
+0ead : a5 53 __ LDA T0 + 0
+0eaf : 85 0f __ STA P2
+0eb1 : a5 54 __ LDA T0 + 1
+0eb3 : 85 10 __ STA P3
+0eb5 : a5 49 __ LDA T7 + 0
+0eb7 : 85 11 __ STA P4
+0eb9 : a5 4a __ LDA T7 + 1
+0ebb : 85 12 __ STA P5
+0ebd : a5 4b __ LDA T7 + 2
+0ebf : 85 13 __ STA P6
+0ec1 : a5 4c __ LDA T7 + 3
+0ec3 : 85 14 __ STA P7
+0ec5 : 20 3e 12 JSR $123e ; (nforml + 0)
+0ec8 : a5 1b __ LDA ACCU + 0
+0eca : 85 55 __ STA T1 + 0
+0ecc : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0ecf : a9 10 __ LDA #$10
+0ed1 : a0 09 __ LDY #$09
+0ed3 : 91 23 __ STA (SP + 0),y
+0ed5 : a9 00 __ LDA #$00
+0ed7 : c8 __ __ INY
+0ed8 : 91 23 __ STA (SP + 0),y
+0eda : 18 __ __ CLC
+0edb : a5 23 __ LDA SP + 0
+0edd : 69 06 __ ADC #$06
+0edf : 85 0d __ STA P0
+0ee1 : a5 24 __ LDA SP + 1
+0ee3 : 69 00 __ ADC #$00
+0ee5 : 85 0e __ STA P1
+0ee7 : a5 53 __ LDA T0 + 0
+0ee9 : 85 0f __ STA P2
+0eeb : a5 54 __ LDA T0 + 1
+0eed : 85 10 __ STA P3
+0eef : a0 14 __ LDY #$14
+0ef1 : b1 23 __ LDA (SP + 0),y
+0ef3 : 85 45 __ STA T5 + 0
+0ef5 : 18 __ __ CLC
+0ef6 : 69 02 __ ADC #$02
+0ef8 : aa __ __ TAX
+0ef9 : c8 __ __ INY
+0efa : b1 23 __ LDA (SP + 0),y
+0efc : 85 46 __ STA T5 + 1
+0efe : 69 00 __ ADC #$00
+0f00 : 85 48 __ STA T6 + 1
+0f02 : 8a __ __ TXA
+0f03 : 88 __ __ DEY
+0f04 : 91 23 __ STA (SP + 0),y
+0f06 : a5 48 __ LDA T6 + 1
+0f08 : c8 __ __ INY
+0f09 : 91 23 __ STA (SP + 0),y
+0f0b : a0 00 __ LDY #$00
+0f0d : b1 45 __ LDA (T5 + 0),y
+0f0f : 85 11 __ STA P4
+0f11 : c8 __ __ INY
+0f12 : b1 45 __ LDA (T5 + 0),y
+0f14 : 85 12 __ STA P5
+0f16 : a9 00 __ LDA #$00
+0f18 : 85 13 __ STA P6
+0f1a : 20 ca 10 JSR $10ca ; (nformi + 0)
+0f1d : a5 1b __ LDA ACCU + 0
+0f1f : 85 55 __ STA T1 + 0
+0f21 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0f24 : 18 __ __ CLC
+0f25 : a5 23 __ LDA SP + 0
+0f27 : 69 06 __ ADC #$06
+0f29 : 85 0d __ STA P0
+0f2b : a5 24 __ LDA SP + 1
+0f2d : 69 00 __ ADC #$00
+0f2f : 85 0e __ STA P1
+0f31 : a5 53 __ LDA T0 + 0
+0f33 : 85 0f __ STA P2
+0f35 : a5 54 __ LDA T0 + 1
+0f37 : 85 10 __ STA P3
+0f39 : a0 14 __ LDY #$14
+0f3b : b1 23 __ LDA (SP + 0),y
+0f3d : 85 45 __ STA T5 + 0
+0f3f : 18 __ __ CLC
+0f40 : 69 02 __ ADC #$02
+0f42 : aa __ __ TAX
+0f43 : c8 __ __ INY
+0f44 : b1 23 __ LDA (SP + 0),y
+0f46 : 85 46 __ STA T5 + 1
+0f48 : 69 00 __ ADC #$00
+0f4a : 85 48 __ STA T6 + 1
+0f4c : 8a __ __ TXA
+0f4d : 88 __ __ DEY
+0f4e : 91 23 __ STA (SP + 0),y
+0f50 : a5 48 __ LDA T6 + 1
+0f52 : c8 __ __ INY
+0f53 : 91 23 __ STA (SP + 0),y
+0f55 : a0 00 __ LDY #$00
+0f57 : b1 45 __ LDA (T5 + 0),y
+0f59 : 85 11 __ STA P4
+0f5b : c8 __ __ INY
+0f5c : b1 45 __ LDA (T5 + 0),y
+0f5e : 85 12 __ STA P5
+0f60 : a9 00 __ LDA #$00
+0f62 : 85 13 __ STA P6
+0f64 : 20 ca 10 JSR $10ca ; (nformi + 0)
+0f67 : a5 1b __ LDA ACCU + 0
+0f69 : 85 55 __ STA T1 + 0
+0f6b : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0f6e : 18 __ __ CLC
+0f6f : a5 23 __ LDA SP + 0
+0f71 : 69 06 __ ADC #$06
+0f73 : 85 0d __ STA P0
+0f75 : a5 24 __ LDA SP + 1
+0f77 : 69 00 __ ADC #$00
+0f79 : 85 0e __ STA P1
+0f7b : a5 53 __ LDA T0 + 0
+0f7d : 85 0f __ STA P2
+0f7f : a5 54 __ LDA T0 + 1
+0f81 : 85 10 __ STA P3
+0f83 : a0 14 __ LDY #$14
+0f85 : b1 23 __ LDA (SP + 0),y
+0f87 : 85 45 __ STA T5 + 0
+0f89 : 18 __ __ CLC
+0f8a : 69 02 __ ADC #$02
+0f8c : aa __ __ TAX
+0f8d : c8 __ __ INY
+0f8e : b1 23 __ LDA (SP + 0),y
+0f90 : 85 46 __ STA T5 + 1
+0f92 : 69 00 __ ADC #$00
+0f94 : 85 48 __ STA T6 + 1
+0f96 : 8a __ __ TXA
+0f97 : 88 __ __ DEY
+0f98 : 91 23 __ STA (SP + 0),y
+0f9a : a5 48 __ LDA T6 + 1
+0f9c : c8 __ __ INY
+0f9d : 91 23 __ STA (SP + 0),y
+0f9f : a0 00 __ LDY #$00
+0fa1 : b1 45 __ LDA (T5 + 0),y
+0fa3 : 85 11 __ STA P4
+0fa5 : c8 __ __ INY
+0fa6 : b1 45 __ LDA (T5 + 0),y
+0fa8 : 85 12 __ STA P5
+0faa : a9 01 __ LDA #$01
+0fac : 85 13 __ STA P6
+0fae : 20 ca 10 JSR $10ca ; (nformi + 0)
+0fb1 : a5 1b __ LDA ACCU + 0
+0fb3 : 85 55 __ STA T1 + 0
+0fb5 : 4c 8f 0b JMP $0b8f ; (sformat + 190)
+0fb8 : a9 00 __ LDA #$00
+0fba : 85 45 __ STA T5 + 0
+0fbc : 85 46 __ STA T5 + 1
+0fbe : a0 00 __ LDY #$00
+0fc0 : b1 57 __ LDA (T2 + 0),y
+0fc2 : 85 43 __ STA T3 + 0
+0fc4 : e6 57 __ INC T2 + 0
+0fc6 : d0 02 __ BNE $0fca
+0fc8 : e6 58 __ INC T2 + 1
+0fca : a5 43 __ LDA T3 + 0
+0fcc : c9 30 __ CMP #$30
+0fce : 90 4d __ BCC $101d
+0fd0 : a9 39 __ LDA #$39
+0fd2 : c5 43 __ CMP T3 + 0
+0fd4 : 90 47 __ BCC $101d
+0fd6 : a5 43 __ LDA T3 + 0
+0fd8 : 85 47 __ STA T6 + 0
+0fda : a0 00 __ LDY #$00
+0fdc : b1 57 __ LDA (T2 + 0),y
+0fde : 85 43 __ STA T3 + 0
+0fe0 : e6 57 __ INC T2 + 0
+0fe2 : d0 02 __ BNE $0fe6
+0fe4 : e6 58 __ INC T2 + 1
+0fe6 : a5 45 __ LDA T5 + 0
+0fe8 : 0a __ __ ASL
+0fe9 : 85 07 __ STA $07
+0feb : a5 46 __ LDA T5 + 1
+0fed : 2a __ __ ROL
+0fee : 06 07 __ ASL $07
+0ff0 : 2a __ __ ROL
+0ff1 : aa __ __ TAX
+0ff2 : 18 __ __ CLC
+0ff3 : a5 07 __ LDA $07
+0ff5 : 65 45 __ ADC T5 + 0
+0ff7 : 85 1b __ STA ACCU + 0
+0ff9 : 8a __ __ TXA
+0ffa : 65 46 __ ADC T5 + 1
+0ffc : 06 1b __ ASL ACCU + 0
+0ffe : 2a __ __ ROL
+0fff : 85 1c __ STA ACCU + 1
+1001 : 18 __ __ CLC
+1002 : a5 1b __ LDA ACCU + 0
+1004 : 65 47 __ ADC T6 + 0
+1006 : aa __ __ TAX
+1007 : a5 1c __ LDA ACCU + 1
+1009 : 69 00 __ ADC #$00
+100b : a8 __ __ TAY
+100c : 38 __ __ SEC
+100d : 8a __ __ TXA
+100e : e9 30 __ SBC #$30
+1010 : 85 45 __ STA T5 + 0
+1012 : 98 __ __ TYA
+1013 : e9 00 __ SBC #$00
+1015 : 85 46 __ STA T5 + 1
+1017 : a5 43 __ LDA T3 + 0
+1019 : c9 30 __ CMP #$30
+101b : b0 b3 __ BCS $0fd0
+101d : a5 45 __ LDA T5 + 0
+101f : a0 08 __ LDY #$08
+1021 : 91 23 __ STA (SP + 0),y
+1023 : 4c 87 0c JMP $0c87 ; (sformat + 438)
+1026 : a9 01 __ LDA #$01
+1028 : a0 0d __ LDY #$0d
+102a : 91 23 __ STA (SP + 0),y
+102c : a0 00 __ LDY #$00
+102e : b1 57 __ LDA (T2 + 0),y
+1030 : 85 43 __ STA T3 + 0
+1032 : 4c f8 0b JMP $0bf8 ; (sformat + 295)
+1035 : a9 30 __ LDA #$30
+1037 : a0 06 __ LDY #$06
+1039 : 91 23 __ STA (SP + 0),y
+103b : a0 00 __ LDY #$00
+103d : b1 57 __ LDA (T2 + 0),y
+103f : 85 43 __ STA T3 + 0
+1041 : 4c f8 0b JMP $0bf8 ; (sformat + 295)
+1044 : a9 01 __ LDA #$01
+1046 : a0 0b __ LDY #$0b
+1048 : 91 23 __ STA (SP + 0),y
+104a : a0 00 __ LDY #$00
+104c : b1 57 __ LDA (T2 + 0),y
+104e : 85 43 __ STA T3 + 0
+1050 : 4c f8 0b JMP $0bf8 ; (sformat + 295)
+1053 : a0 16 __ LDY #$16
+1055 : b1 23 __ LDA (SP + 0),y
+1057 : d0 12 __ BNE $106b
+1059 : 18 __ __ CLC
+105a : a5 53 __ LDA T0 + 0
+105c : 65 55 __ ADC T1 + 0
+105e : 85 53 __ STA T0 + 0
+1060 : 90 02 __ BCC $1064
+1062 : e6 54 __ INC T0 + 1
+1064 : a9 00 __ LDA #$00
+1066 : 85 55 __ STA T1 + 0
+1068 : 4c ca 0b JMP $0bca ; (sformat + 249)
+106b : 18 __ __ CLC
+106c : a5 53 __ LDA T0 + 0
+106e : 85 0d __ STA P0
+1070 : 65 55 __ ADC T1 + 0
+1072 : 85 45 __ STA T5 + 0
+1074 : a5 54 __ LDA T0 + 1
+1076 : 85 0e __ STA P1
+1078 : 69 00 __ ADC #$00
+107a : 85 46 __ STA T5 + 1
+107c : a9 00 __ LDA #$00
+107e : a0 00 __ LDY #$00
+1080 : 91 45 __ STA (T5 + 0),y
+1082 : 20 8c 10 JSR $108c ; (puts + 0)
+1085 : a9 00 __ LDA #$00
+1087 : 85 55 __ STA T1 + 0
+1089 : 4c ca 0b JMP $0bca ; (sformat + 249)
+--------------------------------------------------------------------
+puts:
+108c : a0 00 __ LDY #$00
+108e : b1 0d __ LDA (P0),y
+1090 : f0 0b __ BEQ $109d
+1092 : 20 9e 10 JSR $109e ; (putpch + 0)
+1095 : e6 0d __ INC P0
+1097 : d0 f3 __ BNE $108c
+1099 : e6 0e __ INC P1
+109b : d0 ef __ BNE $108c
+109d : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+109e : ae 84 23 LDX $2384 ; (giocharmap + 0)
+10a1 : e0 01 __ CPX #$01
+10a3 : 90 22 __ BCC $10c7
+10a5 : c9 0a __ CMP #$0a
+10a7 : d0 02 __ BNE $10ab
+10a9 : a9 0d __ LDA #$0d
+10ab : e0 02 __ CPX #$02
+10ad : 90 18 __ BCC $10c7
+10af : c9 41 __ CMP #$41
+10b1 : 90 14 __ BCC $10c7
+10b3 : c9 7b __ CMP #$7b
+10b5 : b0 10 __ BCS $10c7
+10b7 : c9 61 __ CMP #$61
+10b9 : b0 04 __ BCS $10bf
+10bb : c9 5b __ CMP #$5b
+10bd : b0 08 __ BCS $10c7
+10bf : 49 20 __ EOR #$20
+10c1 : e0 03 __ CPX #$03
+10c3 : f0 02 __ BEQ $10c7
+10c5 : 29 df __ AND #$df
+10c7 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nformi:
+10ca : a5 11 __ LDA P4
+10cc : 85 45 __ STA T1 + 0
+10ce : a5 12 __ LDA P5
+10d0 : 85 46 __ STA T1 + 1
+10d2 : a9 00 __ LDA #$00
+10d4 : 85 49 __ STA T3 + 0
+10d6 : a5 13 __ LDA P6
+10d8 : f0 07 __ BEQ $10e1
+10da : a5 12 __ LDA P5
+10dc : 10 03 __ BPL $10e1
+10de : 4c 22 12 JMP $1222 ; (nformi + 344)
+10e1 : a9 0a __ LDA #$0a
+10e3 : 85 4a __ STA T4 + 0
+10e5 : a5 11 __ LDA P4
+10e7 : 05 12 __ ORA P5
+10e9 : f0 03 __ BEQ $10ee
+10eb : 4c c8 11 JMP $11c8 ; (nformi + 254)
+10ee : a0 02 __ LDY #$02
+10f0 : b1 0d __ LDA (P0),y
+10f2 : 85 4b __ STA T5 + 0
+10f4 : c9 ff __ CMP #$ff
+10f6 : d0 03 __ BNE $10fb
+10f8 : 4c ba 11 JMP $11ba ; (nformi + 240)
+10fb : 38 __ __ SEC
+10fc : a9 0a __ LDA #$0a
+10fe : e5 4b __ SBC T5 + 0
+1100 : 85 4b __ STA T5 + 0
+1102 : c5 4a __ CMP T4 + 0
+1104 : b0 0e __ BCS $1114
+1106 : c6 4a __ DEC T4 + 0
+1108 : a9 30 __ LDA #$30
+110a : a4 4a __ LDY T4 + 0
+110c : 91 0f __ STA (P2),y
+110e : a5 4b __ LDA T5 + 0
+1110 : c5 4a __ CMP T4 + 0
+1112 : 90 f2 __ BCC $1106
+1114 : a0 07 __ LDY #$07
+1116 : b1 0d __ LDA (P0),y
+1118 : f0 34 __ BEQ $114e
+111a : a0 03 __ LDY #$03
+111c : b1 0d __ LDA (P0),y
+111e : 85 45 __ STA T1 + 0
+1120 : c8 __ __ INY
+1121 : b1 0d __ LDA (P0),y
+1123 : d0 29 __ BNE $114e
+1125 : a5 45 __ LDA T1 + 0
+1127 : c9 10 __ CMP #$10
+1129 : d0 23 __ BNE $114e
+112b : 18 __ __ CLC
+112c : a5 4a __ LDA T4 + 0
+112e : 69 ff __ ADC #$ff
+1130 : 18 __ __ CLC
+1131 : 65 0f __ ADC P2
+1133 : 85 45 __ STA T1 + 0
+1135 : a5 10 __ LDA P3
+1137 : 69 00 __ ADC #$00
+1139 : 85 46 __ STA T1 + 1
+113b : a9 58 __ LDA #$58
+113d : a0 00 __ LDY #$00
+113f : 91 45 __ STA (T1 + 0),y
+1141 : 18 __ __ CLC
+1142 : a5 4a __ LDA T4 + 0
+1144 : 69 fe __ ADC #$fe
+1146 : 85 4a __ STA T4 + 0
+1148 : a9 30 __ LDA #$30
+114a : a4 4a __ LDY T4 + 0
+114c : 91 0f __ STA (P2),y
+114e : a5 49 __ LDA T3 + 0
+1150 : d0 5d __ BNE $11af
+1152 : a0 05 __ LDY #$05
+1154 : b1 0d __ LDA (P0),y
+1156 : f0 08 __ BEQ $1160
+1158 : c6 4a __ DEC T4 + 0
+115a : a9 2b __ LDA #$2b
+115c : a4 4a __ LDY T4 + 0
+115e : 91 0f __ STA (P2),y
+1160 : a0 01 __ LDY #$01
+1162 : b1 0d __ LDA (P0),y
+1164 : 85 49 __ STA T3 + 0
+1166 : 38 __ __ SEC
+1167 : a9 0a __ LDA #$0a
+1169 : e5 49 __ SBC T3 + 0
+116b : 85 45 __ STA T1 + 0
+116d : a9 00 __ LDA #$00
+116f : e9 00 __ SBC #$00
+1171 : 49 80 __ EOR #$80
+1173 : c9 80 __ CMP #$80
+1175 : d0 04 __ BNE $117b
+1177 : a5 45 __ LDA T1 + 0
+1179 : c5 4a __ CMP T4 + 0
+117b : 90 25 __ BCC $11a2
+117d : a9 00 __ LDA #$00
+117f : 85 49 __ STA T3 + 0
+1181 : a5 4a __ LDA T4 + 0
+1183 : c9 0a __ CMP #$0a
+1185 : b0 12 __ BCS $1199
+1187 : a4 4a __ LDY T4 + 0
+1189 : b1 0f __ LDA (P2),y
+118b : a4 49 __ LDY T3 + 0
+118d : 91 0f __ STA (P2),y
+118f : e6 49 __ INC T3 + 0
+1191 : e6 4a __ INC T4 + 0
+1193 : a5 4a __ LDA T4 + 0
+1195 : c9 0a __ CMP #$0a
+1197 : 90 ee __ BCC $1187
+1199 : a5 49 __ LDA T3 + 0
+119b : 85 1b __ STA ACCU + 0
+119d : a9 00 __ LDA #$00
+119f : 85 1c __ STA ACCU + 1
+11a1 : 60 __ __ RTS
+11a2 : c6 4a __ DEC T4 + 0
+11a4 : a0 00 __ LDY #$00
+11a6 : b1 0d __ LDA (P0),y
+11a8 : a4 4a __ LDY T4 + 0
+11aa : 91 0f __ STA (P2),y
+11ac : 4c 60 11 JMP $1160 ; (nformi + 150)
+11af : c6 4a __ DEC T4 + 0
+11b1 : a9 2d __ LDA #$2d
+11b3 : a4 4a __ LDY T4 + 0
+11b5 : 91 0f __ STA (P2),y
+11b7 : 4c 60 11 JMP $1160 ; (nformi + 150)
+11ba : a9 09 __ LDA #$09
+11bc : 85 4b __ STA T5 + 0
+11be : c5 4a __ CMP T4 + 0
+11c0 : b0 03 __ BCS $11c5
+11c2 : 4c 06 11 JMP $1106 ; (nformi + 60)
+11c5 : 4c 14 11 JMP $1114 ; (nformi + 74)
+11c8 : a5 45 __ LDA T1 + 0
+11ca : 85 1b __ STA ACCU + 0
+11cc : a5 46 __ LDA T1 + 1
+11ce : 85 1c __ STA ACCU + 1
+11d0 : a0 03 __ LDY #$03
+11d2 : b1 0d __ LDA (P0),y
+11d4 : 85 03 __ STA $03
+11d6 : c8 __ __ INY
+11d7 : b1 0d __ LDA (P0),y
+11d9 : 85 04 __ STA $04
+11db : 20 a0 21 JSR $21a0 ; (divmod + 0)
+11de : a5 06 __ LDA $06
+11e0 : 10 30 __ BPL $1212
+11e2 : 18 __ __ CLC
+11e3 : a5 05 __ LDA $05
+11e5 : 69 30 __ ADC #$30
+11e7 : c6 4a __ DEC T4 + 0
+11e9 : a4 4a __ LDY T4 + 0
+11eb : 91 0f __ STA (P2),y
+11ed : a5 45 __ LDA T1 + 0
+11ef : 85 1b __ STA ACCU + 0
+11f1 : a5 46 __ LDA T1 + 1
+11f3 : 85 1c __ STA ACCU + 1
+11f5 : a0 03 __ LDY #$03
+11f7 : b1 0d __ LDA (P0),y
+11f9 : 85 03 __ STA $03
+11fb : c8 __ __ INY
+11fc : b1 0d __ LDA (P0),y
+11fe : 85 04 __ STA $04
+1200 : 20 a0 21 JSR $21a0 ; (divmod + 0)
+1203 : a5 1b __ LDA ACCU + 0
+1205 : 85 45 __ STA T1 + 0
+1207 : a5 1c __ LDA ACCU + 1
+1209 : 85 46 __ STA T1 + 1
+120b : 05 1b __ ORA ACCU + 0
+120d : d0 b9 __ BNE $11c8
+120f : 4c ee 10 JMP $10ee ; (nformi + 36)
+1212 : d0 06 __ BNE $121a
+1214 : a5 05 __ LDA $05
+1216 : c9 0a __ CMP #$0a
+1218 : 90 c8 __ BCC $11e2
+121a : 18 __ __ CLC
+121b : a5 05 __ LDA $05
+121d : 69 37 __ ADC #$37
+121f : 4c e7 11 JMP $11e7 ; (nformi + 285)
+1222 : a9 01 __ LDA #$01
+1224 : 85 49 __ STA T3 + 0
+1226 : a9 0a __ LDA #$0a
+1228 : 85 4a __ STA T4 + 0
+122a : 38 __ __ SEC
+122b : a9 00 __ LDA #$00
+122d : e5 11 __ SBC P4
+122f : 85 45 __ STA T1 + 0
+1231 : a9 00 __ LDA #$00
+1233 : e5 12 __ SBC P5
+1235 : 85 46 __ STA T1 + 1
+1237 : 05 45 __ ORA T1 + 0
+1239 : d0 8d __ BNE $11c8
+123b : 4c ee 10 JMP $10ee ; (nformi + 36)
+--------------------------------------------------------------------
+nforml:
+123e : 38 __ __ SEC
+123f : a5 23 __ LDA SP + 0
+1241 : e9 05 __ SBC #$05
+1243 : 85 23 __ STA SP + 0
+1245 : a5 24 __ LDA SP + 1
+1247 : e9 00 __ SBC #$00
+1249 : 85 24 __ STA SP + 1
+124b : a0 01 __ LDY #$01
+124d : b9 53 00 LDA $0053,y 
+1250 : 91 23 __ STA (SP + 0),y
+1252 : 88 __ __ DEY
+1253 : 10 f8 __ BPL $124d
+1255 : a5 11 __ LDA P4
+1257 : 85 47 __ STA T1 + 0
+1259 : a5 12 __ LDA P5
+125b : 85 48 __ STA T1 + 1
+125d : a5 13 __ LDA P6
+125f : 85 49 __ STA T1 + 2
+1261 : a5 14 __ LDA P7
+1263 : 85 4a __ STA T1 + 3
+1265 : a9 00 __ LDA #$00
+1267 : 85 4d __ STA T3 + 0
+1269 : a5 15 __ LDA P8
+126b : f0 03 __ BEQ $1270
+126d : 4c 16 14 JMP $1416 ; (nforml + 472)
+1270 : a9 10 __ LDA #$10
+1272 : 85 4e __ STA T4 + 0
+1274 : a9 00 __ LDA #$00
+1276 : c5 14 __ CMP P7
+1278 : d0 0a __ BNE $1284
+127a : c5 13 __ CMP P6
+127c : d0 06 __ BNE $1284
+127e : c5 12 __ CMP P5
+1280 : d0 02 __ BNE $1284
+1282 : c5 11 __ CMP P4
+1284 : b0 03 __ BCS $1289
+1286 : 4c 8a 13 JMP $138a ; (nforml + 332)
+1289 : a0 02 __ LDY #$02
+128b : b1 0d __ LDA (P0),y
+128d : 85 4f __ STA T5 + 0
+128f : c9 ff __ CMP #$ff
+1291 : d0 03 __ BNE $1296
+1293 : 4c 7c 13 JMP $137c ; (nforml + 318)
+1296 : 38 __ __ SEC
+1297 : a9 10 __ LDA #$10
+1299 : e5 4f __ SBC T5 + 0
+129b : 85 4f __ STA T5 + 0
+129d : c5 4e __ CMP T4 + 0
+129f : b0 0e __ BCS $12af
+12a1 : c6 4e __ DEC T4 + 0
+12a3 : a9 30 __ LDA #$30
+12a5 : a4 4e __ LDY T4 + 0
+12a7 : 91 0f __ STA (P2),y
+12a9 : a5 4f __ LDA T5 + 0
+12ab : c5 4e __ CMP T4 + 0
+12ad : 90 f2 __ BCC $12a1
+12af : a0 07 __ LDY #$07
+12b1 : b1 0d __ LDA (P0),y
+12b3 : f0 34 __ BEQ $12e9
+12b5 : a0 03 __ LDY #$03
+12b7 : b1 0d __ LDA (P0),y
+12b9 : 85 53 __ STA T7 + 0
+12bb : c8 __ __ INY
+12bc : b1 0d __ LDA (P0),y
+12be : d0 29 __ BNE $12e9
+12c0 : a5 53 __ LDA T7 + 0
+12c2 : c9 10 __ CMP #$10
+12c4 : d0 23 __ BNE $12e9
+12c6 : 18 __ __ CLC
+12c7 : a5 4e __ LDA T4 + 0
+12c9 : 69 ff __ ADC #$ff
+12cb : 18 __ __ CLC
+12cc : 65 0f __ ADC P2
+12ce : 85 53 __ STA T7 + 0
+12d0 : a5 10 __ LDA P3
+12d2 : 69 00 __ ADC #$00
+12d4 : 85 54 __ STA T7 + 1
+12d6 : a9 58 __ LDA #$58
+12d8 : a0 00 __ LDY #$00
+12da : 91 53 __ STA (T7 + 0),y
+12dc : 18 __ __ CLC
+12dd : a5 4e __ LDA T4 + 0
+12df : 69 fe __ ADC #$fe
+12e1 : 85 4e __ STA T4 + 0
+12e3 : a9 30 __ LDA #$30
+12e5 : a4 4e __ LDY T4 + 0
+12e7 : 91 0f __ STA (P2),y
+12e9 : a5 4d __ LDA T3 + 0
+12eb : f0 03 __ BEQ $12f0
+12ed : 4c 71 13 JMP $1371 ; (nforml + 307)
+12f0 : a0 05 __ LDY #$05
+12f2 : b1 0d __ LDA (P0),y
+12f4 : f0 08 __ BEQ $12fe
+12f6 : c6 4e __ DEC T4 + 0
+12f8 : a9 2b __ LDA #$2b
+12fa : a4 4e __ LDY T4 + 0
+12fc : 91 0f __ STA (P2),y
+12fe : a0 01 __ LDY #$01
+1300 : b1 0d __ LDA (P0),y
+1302 : 85 53 __ STA T7 + 0
+1304 : 38 __ __ SEC
+1305 : a9 10 __ LDA #$10
+1307 : e5 53 __ SBC T7 + 0
+1309 : 85 53 __ STA T7 + 0
+130b : a9 00 __ LDA #$00
+130d : e9 00 __ SBC #$00
+130f : 49 80 __ EOR #$80
+1311 : c9 80 __ CMP #$80
+1313 : d0 04 __ BNE $1319
+1315 : a5 53 __ LDA T7 + 0
+1317 : c5 4e __ CMP T4 + 0
+1319 : 90 49 __ BCC $1364
+131b : a9 00 __ LDA #$00
+131d : 85 4d __ STA T3 + 0
+131f : a5 4e __ LDA T4 + 0
+1321 : c9 10 __ CMP #$10
+1323 : 90 20 __ BCC $1345
+1325 : a5 4d __ LDA T3 + 0
+1327 : 85 1b __ STA ACCU + 0
+1329 : a9 00 __ LDA #$00
+132b : 85 1c __ STA ACCU + 1
+132d : a0 01 __ LDY #$01
+132f : b1 23 __ LDA (SP + 0),y
+1331 : 99 53 00 STA $0053,y 
+1334 : 88 __ __ DEY
+1335 : 10 f8 __ BPL $132f
+1337 : 18 __ __ CLC
+1338 : a5 23 __ LDA SP + 0
+133a : 69 05 __ ADC #$05
+133c : 85 23 __ STA SP + 0
+133e : a5 24 __ LDA SP + 1
+1340 : 69 00 __ ADC #$00
+1342 : 85 24 __ STA SP + 1
+1344 : 60 __ __ RTS
+1345 : aa __ __ TAX
+1346 : 8a __ __ TXA
+1347 : 18 __ __ CLC
+1348 : 65 0f __ ADC P2
+134a : 85 51 __ STA T6 + 0
+134c : a5 10 __ LDA P3
+134e : 69 00 __ ADC #$00
+1350 : 85 52 __ STA T6 + 1
+1352 : a0 00 __ LDY #$00
+1354 : b1 51 __ LDA (T6 + 0),y
+1356 : a4 4d __ LDY T3 + 0
+1358 : 91 0f __ STA (P2),y
+135a : e6 4d __ INC T3 + 0
+135c : e8 __ __ INX
+135d : e0 10 __ CPX #$10
+135f : 90 e5 __ BCC $1346
+1361 : 4c 25 13 JMP $1325 ; (nforml + 231)
+1364 : c6 4e __ DEC T4 + 0
+1366 : a0 00 __ LDY #$00
+1368 : b1 0d __ LDA (P0),y
+136a : a4 4e __ LDY T4 + 0
+136c : 91 0f __ STA (P2),y
+136e : 4c fe 12 JMP $12fe ; (nforml + 192)
+1371 : c6 4e __ DEC T4 + 0
+1373 : a9 2d __ LDA #$2d
+1375 : a4 4e __ LDY T4 + 0
+1377 : 91 0f __ STA (P2),y
+1379 : 4c fe 12 JMP $12fe ; (nforml + 192)
+137c : a9 0f __ LDA #$0f
+137e : 85 4f __ STA T5 + 0
+1380 : c5 4e __ CMP T4 + 0
+1382 : b0 03 __ BCS $1387
+1384 : 4c a1 12 JMP $12a1 ; (nforml + 99)
+1387 : 4c af 12 JMP $12af ; (nforml + 113)
+138a : a0 03 __ LDY #$03
+138c : b1 0d __ LDA (P0),y
+138e : 85 03 __ STA $03
+1390 : c8 __ __ INY
+1391 : b1 0d __ LDA (P0),y
+1393 : 85 04 __ STA $04
+1395 : a9 00 __ LDA #$00
+1397 : 85 05 __ STA $05
+1399 : 85 06 __ STA $06
+139b : a5 47 __ LDA T1 + 0
+139d : 85 1b __ STA ACCU + 0
+139f : a5 48 __ LDA T1 + 1
+13a1 : 85 1c __ STA ACCU + 1
+13a3 : a5 49 __ LDA T1 + 2
+13a5 : 85 1d __ STA ACCU + 2
+13a7 : a5 4a __ LDA T1 + 3
+13a9 : 85 1e __ STA ACCU + 3
+13ab : 20 2c 23 JSR $232c ; (divmod32 + 0)
+13ae : a5 08 __ LDA $08
+13b0 : 10 54 __ BPL $1406
+13b2 : 18 __ __ CLC
+13b3 : a5 07 __ LDA $07
+13b5 : 69 30 __ ADC #$30
+13b7 : c6 4e __ DEC T4 + 0
+13b9 : a4 4e __ LDY T4 + 0
+13bb : 91 0f __ STA (P2),y
+13bd : a0 03 __ LDY #$03
+13bf : b1 0d __ LDA (P0),y
+13c1 : 85 03 __ STA $03
+13c3 : c8 __ __ INY
+13c4 : b1 0d __ LDA (P0),y
+13c6 : 85 04 __ STA $04
+13c8 : a9 00 __ LDA #$00
+13ca : 85 05 __ STA $05
+13cc : 85 06 __ STA $06
+13ce : a5 47 __ LDA T1 + 0
+13d0 : 85 1b __ STA ACCU + 0
+13d2 : a5 48 __ LDA T1 + 1
+13d4 : 85 1c __ STA ACCU + 1
+13d6 : a5 49 __ LDA T1 + 2
+13d8 : 85 1d __ STA ACCU + 2
+13da : a5 4a __ LDA T1 + 3
+13dc : 85 1e __ STA ACCU + 3
+13de : 20 2c 23 JSR $232c ; (divmod32 + 0)
+13e1 : a5 1b __ LDA ACCU + 0
+13e3 : 85 47 __ STA T1 + 0
+13e5 : a5 1c __ LDA ACCU + 1
+13e7 : 85 48 __ STA T1 + 1
+13e9 : a5 1d __ LDA ACCU + 2
+13eb : 85 49 __ STA T1 + 2
+13ed : a5 1e __ LDA ACCU + 3
+13ef : 85 4a __ STA T1 + 3
+13f1 : a9 00 __ LDA #$00
+13f3 : c5 1e __ CMP ACCU + 3
+13f5 : d0 0a __ BNE $1401
+13f7 : c5 1d __ CMP ACCU + 2
+13f9 : d0 06 __ BNE $1401
+13fb : c5 1c __ CMP ACCU + 1
+13fd : d0 02 __ BNE $1401
+13ff : c5 1b __ CMP ACCU + 0
+1401 : 90 87 __ BCC $138a
+1403 : 4c 89 12 JMP $1289 ; (nforml + 75)
+1406 : d0 06 __ BNE $140e
+1408 : a5 07 __ LDA $07
+140a : c9 0a __ CMP #$0a
+140c : 90 a4 __ BCC $13b2
+140e : 18 __ __ CLC
+140f : a5 07 __ LDA $07
+1411 : 69 37 __ ADC #$37
+1413 : 4c b7 13 JMP $13b7 ; (nforml + 377)
+1416 : a5 14 __ LDA P7
+1418 : 49 80 __ EOR #$80
+141a : c9 80 __ CMP #$80
+141c : d0 0f __ BNE $142d
+141e : a5 13 __ LDA P6
+1420 : c9 00 __ CMP #$00
+1422 : d0 09 __ BNE $142d
+1424 : a5 12 __ LDA P5
+1426 : c9 00 __ CMP #$00
+1428 : d0 03 __ BNE $142d
+142a : 4c 70 12 JMP $1270 ; (nforml + 50)
+142d : 90 03 __ BCC $1432
+142f : 4c 70 12 JMP $1270 ; (nforml + 50)
+1432 : a9 01 __ LDA #$01
+1434 : 85 4d __ STA T3 + 0
+1436 : a9 10 __ LDA #$10
+1438 : 85 4e __ STA T4 + 0
+143a : 38 __ __ SEC
+143b : a9 00 __ LDA #$00
+143d : e5 11 __ SBC P4
+143f : 85 47 __ STA T1 + 0
+1441 : a9 00 __ LDA #$00
+1443 : e5 12 __ SBC P5
+1445 : 85 48 __ STA T1 + 1
+1447 : a9 00 __ LDA #$00
+1449 : e5 13 __ SBC P6
+144b : 85 49 __ STA T1 + 2
+144d : a9 00 __ LDA #$00
+144f : e5 14 __ SBC P7
+1451 : 85 4a __ STA T1 + 3
+1453 : a9 00 __ LDA #$00
+1455 : c5 4a __ CMP T1 + 3
+1457 : d0 0a __ BNE $1463
+1459 : c5 49 __ CMP T1 + 2
+145b : d0 06 __ BNE $1463
+145d : c5 48 __ CMP T1 + 1
+145f : d0 02 __ BNE $1463
+1461 : c5 47 __ CMP T1 + 0
+1463 : b0 03 __ BCS $1468
+1465 : 4c 8a 13 JMP $138a ; (nforml + 332)
+1468 : 4c 89 12 JMP $1289 ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+146b : 38 __ __ SEC
+146c : a5 23 __ LDA SP + 0
+146e : e9 0a __ SBC #$0a
+1470 : 85 23 __ STA SP + 0
+1472 : a5 24 __ LDA SP + 1
+1474 : e9 00 __ SBC #$00
+1476 : 85 24 __ STA SP + 1
+1478 : a0 03 __ LDY #$03
+147a : b9 53 00 LDA $0053,y 
+147d : 91 23 __ STA (SP + 0),y
+147f : 88 __ __ DEY
+1480 : 10 f8 __ BPL $147a
+1482 : a9 00 __ LDA #$00
+1484 : 85 1b __ STA ACCU + 0
+1486 : 85 1c __ STA ACCU + 1
+1488 : 85 1d __ STA ACCU + 2
+148a : 85 1e __ STA ACCU + 3
+148c : a5 11 __ LDA P4
+148e : 85 03 __ STA $03
+1490 : a5 12 __ LDA P5
+1492 : 85 04 __ STA $04
+1494 : a5 13 __ LDA P6
+1496 : 85 05 __ STA $05
+1498 : a5 14 __ LDA P7
+149a : 85 06 __ STA $06
+149c : 20 db 22 JSR $22db ; (fcmp + 0)
+149f : 10 03 __ BPL $14a4
+14a1 : 4c d3 1a JMP $1ad3 ; (nformf + 1640)
+14a4 : a9 00 __ LDA #$00
+14a6 : 85 4b __ STA T3 + 0
+14a8 : a0 05 __ LDY #$05
+14aa : b1 0d __ LDA (P0),y
+14ac : f0 0a __ BEQ $14b8
+14ae : a9 2b __ LDA #$2b
+14b0 : a0 00 __ LDY #$00
+14b2 : 91 0f __ STA (P2),y
+14b4 : a9 01 __ LDA #$01
+14b6 : 85 4b __ STA T3 + 0
+14b8 : a9 00 __ LDA #$00
+14ba : 85 43 __ STA T0 + 0
+14bc : 85 44 __ STA T0 + 1
+14be : a0 02 __ LDY #$02
+14c0 : b1 0d __ LDA (P0),y
+14c2 : 85 4e __ STA T5 + 0
+14c4 : c9 ff __ CMP #$ff
+14c6 : d0 04 __ BNE $14cc
+14c8 : a9 06 __ LDA #$06
+14ca : 85 4e __ STA T5 + 0
+14cc : a9 00 __ LDA #$00
+14ce : 85 1b __ STA ACCU + 0
+14d0 : 85 1c __ STA ACCU + 1
+14d2 : 85 1d __ STA ACCU + 2
+14d4 : 85 1e __ STA ACCU + 3
+14d6 : a5 11 __ LDA P4
+14d8 : 85 03 __ STA $03
+14da : a5 12 __ LDA P5
+14dc : 85 04 __ STA $04
+14de : a5 13 __ LDA P6
+14e0 : 85 05 __ STA $05
+14e2 : a5 14 __ LDA P7
+14e4 : 85 06 __ STA $06
+14e6 : 20 db 22 JSR $22db ; (fcmp + 0)
+14e9 : d0 03 __ BNE $14ee
+14eb : 4c 72 16 JMP $1672 ; (nformf + 519)
+14ee : a9 00 __ LDA #$00
+14f0 : 85 1b __ STA ACCU + 0
+14f2 : 85 1c __ STA ACCU + 1
+14f4 : a9 7a __ LDA #$7a
+14f6 : 85 1d __ STA ACCU + 2
+14f8 : a9 44 __ LDA #$44
+14fa : 85 1e __ STA ACCU + 3
+14fc : a5 11 __ LDA P4
+14fe : 85 03 __ STA $03
+1500 : a5 12 __ LDA P5
+1502 : 85 04 __ STA $04
+1504 : a5 13 __ LDA P6
+1506 : 85 05 __ STA $05
+1508 : a5 14 __ LDA P7
+150a : 85 06 __ STA $06
+150c : 20 db 22 JSR $22db ; (fcmp + 0)
+150f : 30 5a __ BMI $156b
+1511 : a5 11 __ LDA P4
+1513 : 85 1b __ STA ACCU + 0
+1515 : a5 12 __ LDA P5
+1517 : 85 1c __ STA ACCU + 1
+1519 : a5 13 __ LDA P6
+151b : 85 1d __ STA ACCU + 2
+151d : a5 14 __ LDA P7
+151f : 85 1e __ STA ACCU + 3
+1521 : a9 00 __ LDA #$00
+1523 : 85 03 __ STA $03
+1525 : 85 04 __ STA $04
+1527 : a9 7a __ LDA #$7a
+1529 : 85 05 __ STA $05
+152b : a9 44 __ LDA #$44
+152d : 85 06 __ STA $06
+152f : 20 51 1f JSR $1f51 ; (freg + 20)
+1532 : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1535 : a5 1b __ LDA ACCU + 0
+1537 : 85 11 __ STA P4
+1539 : 85 03 __ STA $03
+153b : a5 1c __ LDA ACCU + 1
+153d : 85 12 __ STA P5
+153f : 85 04 __ STA $04
+1541 : a5 1d __ LDA ACCU + 2
+1543 : 85 13 __ STA P6
+1545 : 85 05 __ STA $05
+1547 : a5 1e __ LDA ACCU + 3
+1549 : 85 14 __ STA P7
+154b : 85 06 __ STA $06
+154d : 18 __ __ CLC
+154e : a5 43 __ LDA T0 + 0
+1550 : 69 03 __ ADC #$03
+1552 : 85 43 __ STA T0 + 0
+1554 : 90 02 __ BCC $1558
+1556 : e6 44 __ INC T0 + 1
+1558 : a9 00 __ LDA #$00
+155a : 85 1b __ STA ACCU + 0
+155c : 85 1c __ STA ACCU + 1
+155e : a9 7a __ LDA #$7a
+1560 : 85 1d __ STA ACCU + 2
+1562 : a9 44 __ LDA #$44
+1564 : 85 1e __ STA ACCU + 3
+1566 : 20 db 22 JSR $22db ; (fcmp + 0)
+1569 : 10 a6 __ BPL $1511
+156b : a9 00 __ LDA #$00
+156d : 85 1b __ STA ACCU + 0
+156f : 85 1c __ STA ACCU + 1
+1571 : a9 80 __ LDA #$80
+1573 : 85 1d __ STA ACCU + 2
+1575 : a9 3f __ LDA #$3f
+1577 : 85 1e __ STA ACCU + 3
+1579 : a5 11 __ LDA P4
+157b : 85 03 __ STA $03
+157d : a5 12 __ LDA P5
+157f : 85 04 __ STA $04
+1581 : a5 13 __ LDA P6
+1583 : 85 05 __ STA $05
+1585 : a5 14 __ LDA P7
+1587 : 85 06 __ STA $06
+1589 : 20 db 22 JSR $22db ; (fcmp + 0)
+158c : 10 5c __ BPL $15ea
+158e : a5 11 __ LDA P4
+1590 : 85 1b __ STA ACCU + 0
+1592 : a5 12 __ LDA P5
+1594 : 85 1c __ STA ACCU + 1
+1596 : a5 13 __ LDA P6
+1598 : 85 1d __ STA ACCU + 2
+159a : a5 14 __ LDA P7
+159c : 85 1e __ STA ACCU + 3
+159e : a9 00 __ LDA #$00
+15a0 : 85 03 __ STA $03
+15a2 : 85 04 __ STA $04
+15a4 : a9 7a __ LDA #$7a
+15a6 : 85 05 __ STA $05
+15a8 : a9 44 __ LDA #$44
+15aa : 85 06 __ STA $06
+15ac : 20 51 1f JSR $1f51 ; (freg + 20)
+15af : 20 4a 20 JSR $204a ; (fmul + 0)
+15b2 : a5 1b __ LDA ACCU + 0
+15b4 : 85 11 __ STA P4
+15b6 : 85 03 __ STA $03
+15b8 : a5 1c __ LDA ACCU + 1
+15ba : 85 12 __ STA P5
+15bc : 85 04 __ STA $04
+15be : a5 1d __ LDA ACCU + 2
+15c0 : 85 13 __ STA P6
+15c2 : 85 05 __ STA $05
+15c4 : a5 1e __ LDA ACCU + 3
+15c6 : 85 14 __ STA P7
+15c8 : 85 06 __ STA $06
+15ca : 38 __ __ SEC
+15cb : a5 43 __ LDA T0 + 0
+15cd : e9 03 __ SBC #$03
+15cf : 85 43 __ STA T0 + 0
+15d1 : a5 44 __ LDA T0 + 1
+15d3 : e9 00 __ SBC #$00
+15d5 : 85 44 __ STA T0 + 1
+15d7 : a9 00 __ LDA #$00
+15d9 : 85 1b __ STA ACCU + 0
+15db : 85 1c __ STA ACCU + 1
+15dd : a9 80 __ LDA #$80
+15df : 85 1d __ STA ACCU + 2
+15e1 : a9 3f __ LDA #$3f
+15e3 : 85 1e __ STA ACCU + 3
+15e5 : 20 db 22 JSR $22db ; (fcmp + 0)
+15e8 : 30 a4 __ BMI $158e
+15ea : a9 00 __ LDA #$00
+15ec : 85 1b __ STA ACCU + 0
+15ee : 85 1c __ STA ACCU + 1
+15f0 : a9 20 __ LDA #$20
+15f2 : 85 1d __ STA ACCU + 2
+15f4 : a9 41 __ LDA #$41
+15f6 : 85 1e __ STA ACCU + 3
+15f8 : a5 11 __ LDA P4
+15fa : 85 03 __ STA $03
+15fc : a5 12 __ LDA P5
+15fe : 85 04 __ STA $04
+1600 : a5 13 __ LDA P6
+1602 : 85 05 __ STA $05
+1604 : a5 14 __ LDA P7
+1606 : 85 06 __ STA $06
+1608 : 20 db 22 JSR $22db ; (fcmp + 0)
+160b : 30 65 __ BMI $1672
+160d : a5 11 __ LDA P4
+160f : 85 1b __ STA ACCU + 0
+1611 : a5 12 __ LDA P5
+1613 : 85 1c __ STA ACCU + 1
+1615 : a5 13 __ LDA P6
+1617 : 85 1d __ STA ACCU + 2
+1619 : a5 14 __ LDA P7
+161b : 85 1e __ STA ACCU + 3
+161d : a9 00 __ LDA #$00
+161f : 85 03 __ STA $03
+1621 : 85 04 __ STA $04
+1623 : a9 20 __ LDA #$20
+1625 : 85 05 __ STA $05
+1627 : a9 41 __ LDA #$41
+1629 : 85 06 __ STA $06
+162b : 20 51 1f JSR $1f51 ; (freg + 20)
+162e : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1631 : a5 1b __ LDA ACCU + 0
+1633 : 85 11 __ STA P4
+1635 : 85 47 __ STA T2 + 0
+1637 : a5 1c __ LDA ACCU + 1
+1639 : 85 12 __ STA P5
+163b : 85 48 __ STA T2 + 1
+163d : a5 1d __ LDA ACCU + 2
+163f : 85 13 __ STA P6
+1641 : 85 49 __ STA T2 + 2
+1643 : a5 1e __ LDA ACCU + 3
+1645 : 85 14 __ STA P7
+1647 : 85 4a __ STA T2 + 3
+1649 : e6 43 __ INC T0 + 0
+164b : d0 02 __ BNE $164f
+164d : e6 44 __ INC T0 + 1
+164f : a9 00 __ LDA #$00
+1651 : 85 1b __ STA ACCU + 0
+1653 : 85 1c __ STA ACCU + 1
+1655 : a9 20 __ LDA #$20
+1657 : 85 1d __ STA ACCU + 2
+1659 : a9 41 __ LDA #$41
+165b : 85 1e __ STA ACCU + 3
+165d : a5 47 __ LDA T2 + 0
+165f : 85 03 __ STA $03
+1661 : a5 48 __ LDA T2 + 1
+1663 : 85 04 __ STA $04
+1665 : a5 49 __ LDA T2 + 2
+1667 : 85 05 __ STA $05
+1669 : a5 4a __ LDA T2 + 3
+166b : 85 06 __ STA $06
+166d : 20 db 22 JSR $22db ; (fcmp + 0)
+1670 : 10 9b __ BPL $160d
+1672 : a5 15 __ LDA P8
+1674 : c9 65 __ CMP #$65
+1676 : d0 03 __ BNE $167b
+1678 : 4c ce 1a JMP $1ace ; (nformf + 1635)
+167b : a9 00 __ LDA #$00
+167d : 85 51 __ STA T7 + 0
+167f : 85 52 __ STA T8 + 0
+1681 : a5 4e __ LDA T5 + 0
+1683 : 85 4c __ STA T4 + 0
+1685 : e6 4c __ INC T4 + 0
+1687 : a5 15 __ LDA P8
+1689 : c9 67 __ CMP #$67
+168b : d0 03 __ BNE $1690
+168d : 4c b1 1a JMP $1ab1 ; (nformf + 1606)
+1690 : a5 51 __ LDA T7 + 0
+1692 : f0 03 __ BEQ $1697
+1694 : 4c bf 19 JMP $19bf ; (nformf + 1364)
+1697 : a5 44 __ LDA T0 + 1
+1699 : 10 03 __ BPL $169e
+169b : 4c 7e 19 JMP $197e ; (nformf + 1299)
+169e : a9 00 __ LDA #$00
+16a0 : 85 47 __ STA T2 + 0
+16a2 : 85 48 __ STA T2 + 1
+16a4 : 85 49 __ STA T2 + 2
+16a6 : a9 3f __ LDA #$3f
+16a8 : 85 4a __ STA T2 + 3
+16aa : 18 __ __ CLC
+16ab : a5 4e __ LDA T5 + 0
+16ad : 65 43 __ ADC T0 + 0
+16af : 85 4c __ STA T4 + 0
+16b1 : e6 4c __ INC T4 + 0
+16b3 : a9 01 __ LDA #$01
+16b5 : c5 4c __ CMP T4 + 0
+16b7 : b0 03 __ BCS $16bc
+16b9 : 4c 3d 19 JMP $193d ; (nformf + 1234)
+16bc : a5 11 __ LDA P4
+16be : 85 1b __ STA ACCU + 0
+16c0 : a5 12 __ LDA P5
+16c2 : 85 1c __ STA ACCU + 1
+16c4 : a5 13 __ LDA P6
+16c6 : 85 1d __ STA ACCU + 2
+16c8 : a5 14 __ LDA P7
+16ca : 85 1e __ STA ACCU + 3
+16cc : a5 47 __ LDA T2 + 0
+16ce : 85 03 __ STA $03
+16d0 : a5 48 __ LDA T2 + 1
+16d2 : 85 04 __ STA $04
+16d4 : a5 49 __ LDA T2 + 2
+16d6 : 85 05 __ STA $05
+16d8 : a5 4a __ LDA T2 + 3
+16da : 85 06 __ STA $06
+16dc : 20 51 1f JSR $1f51 ; (freg + 20)
+16df : 20 82 1f JSR $1f82 ; (faddsub + 0)
+16e2 : a5 1b __ LDA ACCU + 0
+16e4 : 85 11 __ STA P4
+16e6 : 85 47 __ STA T2 + 0
+16e8 : 85 03 __ STA $03
+16ea : a5 1c __ LDA ACCU + 1
+16ec : 85 12 __ STA P5
+16ee : 85 48 __ STA T2 + 1
+16f0 : 85 04 __ STA $04
+16f2 : a5 1d __ LDA ACCU + 2
+16f4 : 85 13 __ STA P6
+16f6 : 85 49 __ STA T2 + 2
+16f8 : 85 05 __ STA $05
+16fa : a5 1e __ LDA ACCU + 3
+16fc : 85 14 __ STA P7
+16fe : 85 4a __ STA T2 + 3
+1700 : 85 06 __ STA $06
+1702 : a9 00 __ LDA #$00
+1704 : 85 1b __ STA ACCU + 0
+1706 : 85 1c __ STA ACCU + 1
+1708 : a9 20 __ LDA #$20
+170a : 85 1d __ STA ACCU + 2
+170c : a9 41 __ LDA #$41
+170e : 85 1e __ STA ACCU + 3
+1710 : 20 db 22 JSR $22db ; (fcmp + 0)
+1713 : 30 36 __ BMI $174b
+1715 : a5 47 __ LDA T2 + 0
+1717 : 85 1b __ STA ACCU + 0
+1719 : a5 48 __ LDA T2 + 1
+171b : 85 1c __ STA ACCU + 1
+171d : a5 49 __ LDA T2 + 2
+171f : 85 1d __ STA ACCU + 2
+1721 : a5 4a __ LDA T2 + 3
+1723 : 85 1e __ STA ACCU + 3
+1725 : a9 00 __ LDA #$00
+1727 : 85 03 __ STA $03
+1729 : 85 04 __ STA $04
+172b : a9 20 __ LDA #$20
+172d : 85 05 __ STA $05
+172f : a9 41 __ LDA #$41
+1731 : 85 06 __ STA $06
+1733 : 20 51 1f JSR $1f51 ; (freg + 20)
+1736 : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1739 : a5 1b __ LDA ACCU + 0
+173b : 85 11 __ STA P4
+173d : a5 1c __ LDA ACCU + 1
+173f : 85 12 __ STA P5
+1741 : a5 1d __ LDA ACCU + 2
+1743 : 85 13 __ STA P6
+1745 : a5 1e __ LDA ACCU + 3
+1747 : 85 14 __ STA P7
+1749 : c6 4e __ DEC T5 + 0
+174b : 38 __ __ SEC
+174c : a5 4c __ LDA T4 + 0
+174e : e5 4e __ SBC T5 + 0
+1750 : 85 53 __ STA T10 + 0
+1752 : 85 4e __ STA T5 + 0
+1754 : a9 14 __ LDA #$14
+1756 : c5 4c __ CMP T4 + 0
+1758 : b0 02 __ BCS $175c
+175a : 85 4c __ STA T4 + 0
+175c : a5 53 __ LDA T10 + 0
+175e : d0 08 __ BNE $1768
+1760 : a9 30 __ LDA #$30
+1762 : a4 4b __ LDY T3 + 0
+1764 : 91 0f __ STA (P2),y
+1766 : e6 4b __ INC T3 + 0
+1768 : a9 00 __ LDA #$00
+176a : 85 50 __ STA T6 + 0
+176c : a5 4c __ LDA T4 + 0
+176e : f0 03 __ BEQ $1773
+1770 : 4c ac 18 JMP $18ac ; (nformf + 1089)
+1773 : a5 52 __ LDA T8 + 0
+1775 : f0 03 __ BEQ $177a
+1777 : 4c 2c 18 JMP $182c ; (nformf + 961)
+177a : a5 4b __ LDA T3 + 0
+177c : a0 01 __ LDY #$01
+177e : d1 0d __ CMP (P0),y
+1780 : 90 1e __ BCC $17a0
+1782 : 85 1b __ STA ACCU + 0
+1784 : a9 00 __ LDA #$00
+1786 : 85 1c __ STA ACCU + 1
+1788 : a0 03 __ LDY #$03
+178a : b1 23 __ LDA (SP + 0),y
+178c : 99 53 00 STA $0053,y 
+178f : 88 __ __ DEY
+1790 : 10 f8 __ BPL $178a
+1792 : 18 __ __ CLC
+1793 : a5 23 __ LDA SP + 0
+1795 : 69 0a __ ADC #$0a
+1797 : 85 23 __ STA SP + 0
+1799 : a5 24 __ LDA SP + 1
+179b : 69 00 __ ADC #$00
+179d : 85 24 __ STA SP + 1
+179f : 60 __ __ RTS
+17a0 : c9 01 __ CMP #$01
+17a2 : 90 53 __ BCC $17f7
+17a4 : a9 01 __ LDA #$01
+17a6 : 85 4e __ STA T5 + 0
+17a8 : a5 0d __ LDA P0
+17aa : 85 43 __ STA T0 + 0
+17ac : a5 0e __ LDA P1
+17ae : 85 44 __ STA T0 + 1
+17b0 : a5 4b __ LDA T3 + 0
+17b2 : 85 4c __ STA T4 + 0
+17b4 : 38 __ __ SEC
+17b5 : a5 4c __ LDA T4 + 0
+17b7 : e5 4e __ SBC T5 + 0
+17b9 : 85 55 __ STA T11 + 0
+17bb : a9 00 __ LDA #$00
+17bd : e9 00 __ SBC #$00
+17bf : 85 56 __ STA T11 + 1
+17c1 : 18 __ __ CLC
+17c2 : a5 0f __ LDA P2
+17c4 : 65 55 __ ADC T11 + 0
+17c6 : 85 55 __ STA T11 + 0
+17c8 : a5 10 __ LDA P3
+17ca : 65 56 __ ADC T11 + 1
+17cc : 85 56 __ STA T11 + 1
+17ce : a0 01 __ LDY #$01
+17d0 : b1 43 __ LDA (T0 + 0),y
+17d2 : 38 __ __ SEC
+17d3 : e5 4e __ SBC T5 + 0
+17d5 : 85 53 __ STA T10 + 0
+17d7 : a9 00 __ LDA #$00
+17d9 : e9 00 __ SBC #$00
+17db : 85 54 __ STA T10 + 1
+17dd : 18 __ __ CLC
+17de : a5 0f __ LDA P2
+17e0 : 65 53 __ ADC T10 + 0
+17e2 : 85 53 __ STA T10 + 0
+17e4 : a5 10 __ LDA P3
+17e6 : 65 54 __ ADC T10 + 1
+17e8 : 85 54 __ STA T10 + 1
+17ea : 88 __ __ DEY
+17eb : b1 55 __ LDA (T11 + 0),y
+17ed : 91 53 __ STA (T10 + 0),y
+17ef : e6 4e __ INC T5 + 0
+17f1 : a5 4b __ LDA T3 + 0
+17f3 : c5 4e __ CMP T5 + 0
+17f5 : b0 bd __ BCS $17b4
+17f7 : a9 00 __ LDA #$00
+17f9 : 85 4e __ STA T5 + 0
+17fb : a5 4b __ LDA T3 + 0
+17fd : 85 43 __ STA T0 + 0
+17ff : a0 01 __ LDY #$01
+1801 : b1 0d __ LDA (P0),y
+1803 : 85 4b __ STA T3 + 0
+1805 : 38 __ __ SEC
+1806 : e5 43 __ SBC T0 + 0
+1808 : 85 53 __ STA T10 + 0
+180a : a9 00 __ LDA #$00
+180c : e9 00 __ SBC #$00
+180e : 85 54 __ STA T10 + 1
+1810 : a9 00 __ LDA #$00
+1812 : c5 54 __ CMP T10 + 1
+1814 : d0 04 __ BNE $181a
+1816 : a5 4e __ LDA T5 + 0
+1818 : c5 53 __ CMP T10 + 0
+181a : 90 05 __ BCC $1821
+181c : a5 4b __ LDA T3 + 0
+181e : 4c 82 17 JMP $1782 ; (nformf + 791)
+1821 : a9 20 __ LDA #$20
+1823 : a4 4e __ LDY T5 + 0
+1825 : 91 0f __ STA (P2),y
+1827 : e6 4e __ INC T5 + 0
+1829 : 4c ff 17 JMP $17ff ; (nformf + 916)
+182c : a9 45 __ LDA #$45
+182e : a4 4b __ LDY T3 + 0
+1830 : 91 0f __ STA (P2),y
+1832 : c8 __ __ INY
+1833 : a5 44 __ LDA T0 + 1
+1835 : 30 5a __ BMI $1891
+1837 : a9 2b __ LDA #$2b
+1839 : 91 0f __ STA (P2),y
+183b : 18 __ __ CLC
+183c : a5 4b __ LDA T3 + 0
+183e : 69 02 __ ADC #$02
+1840 : 85 4b __ STA T3 + 0
+1842 : a5 43 __ LDA T0 + 0
+1844 : 85 1b __ STA ACCU + 0
+1846 : a5 44 __ LDA T0 + 1
+1848 : 85 1c __ STA ACCU + 1
+184a : a9 0a __ LDA #$0a
+184c : 85 03 __ STA $03
+184e : a9 00 __ LDA #$00
+1850 : 85 04 __ STA $04
+1852 : 20 66 21 JSR $2166 ; (divs16 + 0)
+1855 : 18 __ __ CLC
+1856 : a5 1b __ LDA ACCU + 0
+1858 : 69 30 __ ADC #$30
+185a : a4 4b __ LDY T3 + 0
+185c : 91 0f __ STA (P2),y
+185e : c8 __ __ INY
+185f : 98 __ __ TYA
+1860 : 18 __ __ CLC
+1861 : 65 0f __ ADC P2
+1863 : 85 4c __ STA T4 + 0
+1865 : a5 10 __ LDA P3
+1867 : 69 00 __ ADC #$00
+1869 : 85 4d __ STA T4 + 1
+186b : a5 43 __ LDA T0 + 0
+186d : 85 1b __ STA ACCU + 0
+186f : a5 44 __ LDA T0 + 1
+1871 : 85 1c __ STA ACCU + 1
+1873 : a9 0a __ LDA #$0a
+1875 : 85 03 __ STA $03
+1877 : a9 00 __ LDA #$00
+1879 : 85 04 __ STA $04
+187b : 20 25 22 JSR $2225 ; (mods16 + 0)
+187e : 18 __ __ CLC
+187f : a5 05 __ LDA $05
+1881 : 69 30 __ ADC #$30
+1883 : a0 00 __ LDY #$00
+1885 : 91 4c __ STA (T4 + 0),y
+1887 : 18 __ __ CLC
+1888 : a5 4b __ LDA T3 + 0
+188a : 69 02 __ ADC #$02
+188c : 85 4b __ STA T3 + 0
+188e : 4c 7a 17 JMP $177a ; (nformf + 783)
+1891 : a9 2d __ LDA #$2d
+1893 : 91 0f __ STA (P2),y
+1895 : 18 __ __ CLC
+1896 : a5 4b __ LDA T3 + 0
+1898 : 69 02 __ ADC #$02
+189a : 85 4b __ STA T3 + 0
+189c : 38 __ __ SEC
+189d : a9 00 __ LDA #$00
+189f : e5 43 __ SBC T0 + 0
+18a1 : 85 43 __ STA T0 + 0
+18a3 : a9 00 __ LDA #$00
+18a5 : e5 44 __ SBC T0 + 1
+18a7 : 85 44 __ STA T0 + 1
+18a9 : 4c 42 18 JMP $1842 ; (nformf + 983)
+18ac : a5 50 __ LDA T6 + 0
+18ae : c5 4e __ CMP T5 + 0
+18b0 : d0 08 __ BNE $18ba
+18b2 : a9 2e __ LDA #$2e
+18b4 : a4 4b __ LDY T3 + 0
+18b6 : 91 0f __ STA (P2),y
+18b8 : e6 4b __ INC T3 + 0
+18ba : a5 11 __ LDA P4
+18bc : 85 1b __ STA ACCU + 0
+18be : a5 12 __ LDA P5
+18c0 : 85 1c __ STA ACCU + 1
+18c2 : a5 13 __ LDA P6
+18c4 : 85 1d __ STA ACCU + 2
+18c6 : a5 14 __ LDA P7
+18c8 : 85 1e __ STA ACCU + 3
+18ca : 20 4e 22 JSR $224e ; (f32_to_i16 + 0)
+18cd : a5 1b __ LDA ACCU + 0
+18cf : 85 53 __ STA T10 + 0
+18d1 : 20 90 22 JSR $2290 ; (sint16_to_float + 0)
+18d4 : a5 1b __ LDA ACCU + 0
+18d6 : 85 03 __ STA $03
+18d8 : a5 1c __ LDA ACCU + 1
+18da : 85 04 __ STA $04
+18dc : a5 1d __ LDA ACCU + 2
+18de : 85 05 __ STA $05
+18e0 : a5 1e __ LDA ACCU + 3
+18e2 : 85 06 __ STA $06
+18e4 : a5 11 __ LDA P4
+18e6 : 85 1b __ STA ACCU + 0
+18e8 : a5 12 __ LDA P5
+18ea : 85 1c __ STA ACCU + 1
+18ec : a5 13 __ LDA P6
+18ee : 85 1d __ STA ACCU + 2
+18f0 : a5 14 __ LDA P7
+18f2 : 85 1e __ STA ACCU + 3
+18f4 : 20 51 1f JSR $1f51 ; (freg + 20)
+18f7 : a5 06 __ LDA $06
+18f9 : 49 80 __ EOR #$80
+18fb : 85 06 __ STA $06
+18fd : 20 82 1f JSR $1f82 ; (faddsub + 0)
+1900 : a9 00 __ LDA #$00
+1902 : 85 03 __ STA $03
+1904 : 85 04 __ STA $04
+1906 : a9 20 __ LDA #$20
+1908 : 85 05 __ STA $05
+190a : a9 41 __ LDA #$41
+190c : 85 06 __ STA $06
+190e : 20 51 1f JSR $1f51 ; (freg + 20)
+1911 : 20 4a 20 JSR $204a ; (fmul + 0)
+1914 : a5 1b __ LDA ACCU + 0
+1916 : 85 11 __ STA P4
+1918 : a5 1c __ LDA ACCU + 1
+191a : 85 12 __ STA P5
+191c : a5 1d __ LDA ACCU + 2
+191e : 85 13 __ STA P6
+1920 : a5 1e __ LDA ACCU + 3
+1922 : 85 14 __ STA P7
+1924 : 18 __ __ CLC
+1925 : a5 53 __ LDA T10 + 0
+1927 : 69 30 __ ADC #$30
+1929 : a4 4b __ LDY T3 + 0
+192b : 91 0f __ STA (P2),y
+192d : e6 4b __ INC T3 + 0
+192f : e6 50 __ INC T6 + 0
+1931 : a5 50 __ LDA T6 + 0
+1933 : c5 4c __ CMP T4 + 0
+1935 : b0 03 __ BCS $193a
+1937 : 4c ac 18 JMP $18ac ; (nformf + 1089)
+193a : 4c 73 17 JMP $1773 ; (nformf + 776)
+193d : 85 50 __ STA T6 + 0
+193f : a5 47 __ LDA T2 + 0
+1941 : 85 1b __ STA ACCU + 0
+1943 : a5 48 __ LDA T2 + 1
+1945 : 85 1c __ STA ACCU + 1
+1947 : a5 49 __ LDA T2 + 2
+1949 : 85 1d __ STA ACCU + 2
+194b : a5 4a __ LDA T2 + 3
+194d : 85 1e __ STA ACCU + 3
+194f : a9 00 __ LDA #$00
+1951 : 85 03 __ STA $03
+1953 : 85 04 __ STA $04
+1955 : a9 20 __ LDA #$20
+1957 : 85 05 __ STA $05
+1959 : a9 41 __ LDA #$41
+195b : 85 06 __ STA $06
+195d : 20 51 1f JSR $1f51 ; (freg + 20)
+1960 : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1963 : a5 1b __ LDA ACCU + 0
+1965 : 85 47 __ STA T2 + 0
+1967 : a5 1c __ LDA ACCU + 1
+1969 : 85 48 __ STA T2 + 1
+196b : a5 1d __ LDA ACCU + 2
+196d : 85 49 __ STA T2 + 2
+196f : a5 1e __ LDA ACCU + 3
+1971 : 85 4a __ STA T2 + 3
+1973 : e6 50 __ INC T6 + 0
+1975 : a5 50 __ LDA T6 + 0
+1977 : c5 4c __ CMP T4 + 0
+1979 : 90 c4 __ BCC $193f
+197b : 4c bc 16 JMP $16bc ; (nformf + 593)
+197e : a5 11 __ LDA P4
+1980 : 85 1b __ STA ACCU + 0
+1982 : a5 12 __ LDA P5
+1984 : 85 1c __ STA ACCU + 1
+1986 : a5 13 __ LDA P6
+1988 : 85 1d __ STA ACCU + 2
+198a : a5 14 __ LDA P7
+198c : 85 1e __ STA ACCU + 3
+198e : a9 00 __ LDA #$00
+1990 : 85 03 __ STA $03
+1992 : 85 04 __ STA $04
+1994 : a9 20 __ LDA #$20
+1996 : 85 05 __ STA $05
+1998 : a9 41 __ LDA #$41
+199a : 85 06 __ STA $06
+199c : 20 51 1f JSR $1f51 ; (freg + 20)
+199f : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+19a2 : a5 1b __ LDA ACCU + 0
+19a4 : 85 11 __ STA P4
+19a6 : a5 1c __ LDA ACCU + 1
+19a8 : 85 12 __ STA P5
+19aa : a5 1d __ LDA ACCU + 2
+19ac : 85 13 __ STA P6
+19ae : a5 1e __ LDA ACCU + 3
+19b0 : 85 14 __ STA P7
+19b2 : e6 43 __ INC T0 + 0
+19b4 : d0 02 __ BNE $19b8
+19b6 : e6 44 __ INC T0 + 1
+19b8 : a5 44 __ LDA T0 + 1
+19ba : 30 c2 __ BMI $197e
+19bc : 4c 9e 16 JMP $169e ; (nformf + 563)
+19bf : a9 00 __ LDA #$00
+19c1 : 85 47 __ STA T2 + 0
+19c3 : 85 48 __ STA T2 + 1
+19c5 : 85 49 __ STA T2 + 2
+19c7 : a9 3f __ LDA #$3f
+19c9 : 85 4a __ STA T2 + 3
+19cb : a5 4e __ LDA T5 + 0
+19cd : f0 03 __ BEQ $19d2
+19cf : 4c 6e 1a JMP $1a6e ; (nformf + 1539)
+19d2 : a5 11 __ LDA P4
+19d4 : 85 1b __ STA ACCU + 0
+19d6 : a5 12 __ LDA P5
+19d8 : 85 1c __ STA ACCU + 1
+19da : a5 13 __ LDA P6
+19dc : 85 1d __ STA ACCU + 2
+19de : a5 14 __ LDA P7
+19e0 : 85 1e __ STA ACCU + 3
+19e2 : a5 47 __ LDA T2 + 0
+19e4 : 85 03 __ STA $03
+19e6 : a5 48 __ LDA T2 + 1
+19e8 : 85 04 __ STA $04
+19ea : a5 49 __ LDA T2 + 2
+19ec : 85 05 __ STA $05
+19ee : a5 4a __ LDA T2 + 3
+19f0 : 85 06 __ STA $06
+19f2 : 20 51 1f JSR $1f51 ; (freg + 20)
+19f5 : 20 82 1f JSR $1f82 ; (faddsub + 0)
+19f8 : a5 1b __ LDA ACCU + 0
+19fa : 85 11 __ STA P4
+19fc : 85 47 __ STA T2 + 0
+19fe : 85 03 __ STA $03
+1a00 : a5 1c __ LDA ACCU + 1
+1a02 : 85 12 __ STA P5
+1a04 : 85 48 __ STA T2 + 1
+1a06 : 85 04 __ STA $04
+1a08 : a5 1d __ LDA ACCU + 2
+1a0a : 85 13 __ STA P6
+1a0c : 85 49 __ STA T2 + 2
+1a0e : 85 05 __ STA $05
+1a10 : a5 1e __ LDA ACCU + 3
+1a12 : 85 14 __ STA P7
+1a14 : 85 4a __ STA T2 + 3
+1a16 : 85 06 __ STA $06
+1a18 : a9 00 __ LDA #$00
+1a1a : 85 1b __ STA ACCU + 0
+1a1c : 85 1c __ STA ACCU + 1
+1a1e : a9 20 __ LDA #$20
+1a20 : 85 1d __ STA ACCU + 2
+1a22 : a9 41 __ LDA #$41
+1a24 : 85 1e __ STA ACCU + 3
+1a26 : 20 db 22 JSR $22db ; (fcmp + 0)
+1a29 : 10 03 __ BPL $1a2e
+1a2b : 4c 4b 17 JMP $174b ; (nformf + 736)
+1a2e : a5 47 __ LDA T2 + 0
+1a30 : 85 1b __ STA ACCU + 0
+1a32 : a5 48 __ LDA T2 + 1
+1a34 : 85 1c __ STA ACCU + 1
+1a36 : a5 49 __ LDA T2 + 2
+1a38 : 85 1d __ STA ACCU + 2
+1a3a : a5 4a __ LDA T2 + 3
+1a3c : 85 1e __ STA ACCU + 3
+1a3e : a9 00 __ LDA #$00
+1a40 : 85 03 __ STA $03
+1a42 : 85 04 __ STA $04
+1a44 : a9 20 __ LDA #$20
+1a46 : 85 05 __ STA $05
+1a48 : a9 41 __ LDA #$41
+1a4a : 85 06 __ STA $06
+1a4c : 20 51 1f JSR $1f51 ; (freg + 20)
+1a4f : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1a52 : a5 1b __ LDA ACCU + 0
+1a54 : 85 11 __ STA P4
+1a56 : a5 1c __ LDA ACCU + 1
+1a58 : 85 12 __ STA P5
+1a5a : a5 1d __ LDA ACCU + 2
+1a5c : 85 13 __ STA P6
+1a5e : a5 1e __ LDA ACCU + 3
+1a60 : 85 14 __ STA P7
+1a62 : e6 43 __ INC T0 + 0
+1a64 : f0 03 __ BEQ $1a69
+1a66 : 4c 4b 17 JMP $174b ; (nformf + 736)
+1a69 : e6 44 __ INC T0 + 1
+1a6b : 4c 4b 17 JMP $174b ; (nformf + 736)
+1a6e : a9 00 __ LDA #$00
+1a70 : 85 50 __ STA T6 + 0
+1a72 : a5 47 __ LDA T2 + 0
+1a74 : 85 1b __ STA ACCU + 0
+1a76 : a5 48 __ LDA T2 + 1
+1a78 : 85 1c __ STA ACCU + 1
+1a7a : a5 49 __ LDA T2 + 2
+1a7c : 85 1d __ STA ACCU + 2
+1a7e : a5 4a __ LDA T2 + 3
+1a80 : 85 1e __ STA ACCU + 3
+1a82 : a9 00 __ LDA #$00
+1a84 : 85 03 __ STA $03
+1a86 : 85 04 __ STA $04
+1a88 : a9 20 __ LDA #$20
+1a8a : 85 05 __ STA $05
+1a8c : a9 41 __ LDA #$41
+1a8e : 85 06 __ STA $06
+1a90 : 20 51 1f JSR $1f51 ; (freg + 20)
+1a93 : 20 e8 20 JSR $20e8 ; (fdiv + 0)
+1a96 : a5 1b __ LDA ACCU + 0
+1a98 : 85 47 __ STA T2 + 0
+1a9a : a5 1c __ LDA ACCU + 1
+1a9c : 85 48 __ STA T2 + 1
+1a9e : a5 1d __ LDA ACCU + 2
+1aa0 : 85 49 __ STA T2 + 2
+1aa2 : a5 1e __ LDA ACCU + 3
+1aa4 : 85 4a __ STA T2 + 3
+1aa6 : e6 50 __ INC T6 + 0
+1aa8 : a5 50 __ LDA T6 + 0
+1aaa : c5 4e __ CMP T5 + 0
+1aac : 90 c4 __ BCC $1a72
+1aae : 4c d2 19 JMP $19d2 ; (nformf + 1383)
+1ab1 : a5 44 __ LDA T0 + 1
+1ab3 : 10 0e __ BPL $1ac3
+1ab5 : a5 44 __ LDA T0 + 1
+1ab7 : 30 03 __ BMI $1abc
+1ab9 : 4c 90 16 JMP $1690 ; (nformf + 549)
+1abc : a9 01 __ LDA #$01
+1abe : 85 52 __ STA T8 + 0
+1ac0 : 4c bf 19 JMP $19bf ; (nformf + 1364)
+1ac3 : d0 f7 __ BNE $1abc
+1ac5 : a9 03 __ LDA #$03
+1ac7 : c5 43 __ CMP T0 + 0
+1ac9 : 90 f1 __ BCC $1abc
+1acb : 4c b5 1a JMP $1ab5 ; (nformf + 1610)
+1ace : a9 01 __ LDA #$01
+1ad0 : 4c 7d 16 JMP $167d ; (nformf + 530)
+1ad3 : a5 14 __ LDA P7
+1ad5 : 49 80 __ EOR #$80
+1ad7 : 85 14 __ STA P7
+1ad9 : a9 2d __ LDA #$2d
+1adb : a0 00 __ LDY #$00
+1add : 91 0f __ STA (P2),y
+1adf : a9 01 __ LDA #$01
+1ae1 : 85 4b __ STA T3 + 0
+1ae3 : 4c b8 14 JMP $14b8 ; (nformf + 77)
+--------------------------------------------------------------------
+shuffle:
+1aeb : 38 __ __ SEC
+1aec : a5 23 __ LDA SP + 0
+1aee : e9 0c __ SBC #$0c
+1af0 : 85 23 __ STA SP + 0
+1af2 : a5 24 __ LDA SP + 1
+1af4 : e9 00 __ SBC #$00
+1af6 : 85 24 __ STA SP + 1
+1af8 : a0 10 __ LDY #$10
+1afa : b1 23 __ LDA (SP + 0),y
+1afc : 85 47 __ STA T0 + 0
+1afe : c8 __ __ INY
+1aff : b1 23 __ LDA (SP + 0),y
+1b01 : 30 04 __ BMI $1b07
+1b03 : 05 47 __ ORA T0 + 0
+1b05 : d0 0e __ BNE $1b15
+1b07 : 18 __ __ CLC
+1b08 : a5 23 __ LDA SP + 0
+1b0a : 69 0c __ ADC #$0c
+1b0c : 85 23 __ STA SP + 0
+1b0e : a5 24 __ LDA SP + 1
+1b10 : 69 00 __ ADC #$00
+1b12 : 85 24 __ STA SP + 1
+1b14 : 60 __ __ RTS
+1b15 : a0 0e __ LDY #$0e
+1b17 : b1 23 __ LDA (SP + 0),y
+1b19 : 85 47 __ STA T0 + 0
+1b1b : 85 49 __ STA T2 + 0
+1b1d : c8 __ __ INY
+1b1e : b1 23 __ LDA (SP + 0),y
+1b20 : 85 48 __ STA T0 + 1
+1b22 : 85 4a __ STA T2 + 1
+1b24 : c8 __ __ INY
+1b25 : b1 23 __ LDA (SP + 0),y
+1b27 : 85 4b __ STA T3 + 0
+1b29 : 0a __ __ ASL
+1b2a : aa __ __ TAX
+1b2b : c8 __ __ INY
+1b2c : b1 23 __ LDA (SP + 0),y
+1b2e : 85 4c __ STA T3 + 1
+1b30 : 2a __ __ ROL
+1b31 : a8 __ __ TAY
+1b32 : 18 __ __ CLC
+1b33 : 8a __ __ TXA
+1b34 : 65 4b __ ADC T3 + 0
+1b36 : 85 1b __ STA ACCU + 0
+1b38 : 98 __ __ TYA
+1b39 : 65 4c __ ADC T3 + 1
+1b3b : 06 1b __ ASL ACCU + 0
+1b3d : 2a __ __ ROL
+1b3e : 06 1b __ ASL ACCU + 0
+1b40 : 2a __ __ ROL
+1b41 : 85 1c __ STA ACCU + 1
+1b43 : 18 __ __ CLC
+1b44 : a5 47 __ LDA T0 + 0
+1b46 : 65 1b __ ADC ACCU + 0
+1b48 : 85 4d __ STA T4 + 0
+1b4a : a5 48 __ LDA T0 + 1
+1b4c : 65 1c __ ADC ACCU + 1
+1b4e : 85 4e __ STA T4 + 1
+1b50 : a5 23 __ LDA SP + 0
+1b52 : 85 4f __ STA T5 + 0
+1b54 : a5 24 __ LDA SP + 1
+1b56 : 85 50 __ STA T5 + 1
+1b58 : 20 d1 1b JSR $1bd1 ; (rand + 0)
+1b5b : a5 1b __ LDA ACCU + 0
+1b5d : 85 44 __ STA T6 + 0
+1b5f : a5 1c __ LDA ACCU + 1
+1b61 : 85 45 __ STA T6 + 1
+1b63 : a0 0b __ LDY #$0b
+1b65 : b1 49 __ LDA (T2 + 0),y
+1b67 : 91 4f __ STA (T5 + 0),y
+1b69 : 88 __ __ DEY
+1b6a : 10 f9 __ BPL $1b65
+1b6c : a5 44 __ LDA T6 + 0
+1b6e : 85 1b __ STA ACCU + 0
+1b70 : a5 45 __ LDA T6 + 1
+1b72 : 85 1c __ STA ACCU + 1
+1b74 : a5 4b __ LDA T3 + 0
+1b76 : 85 03 __ STA $03
+1b78 : a5 4c __ LDA T3 + 1
+1b7a : 85 04 __ STA $04
+1b7c : 20 a0 21 JSR $21a0 ; (divmod + 0)
+1b7f : a5 05 __ LDA $05
+1b81 : 0a __ __ ASL
+1b82 : aa __ __ TAX
+1b83 : a5 06 __ LDA $06
+1b85 : 2a __ __ ROL
+1b86 : a8 __ __ TAY
+1b87 : 18 __ __ CLC
+1b88 : 8a __ __ TXA
+1b89 : 65 05 __ ADC $05
+1b8b : 85 1b __ STA ACCU + 0
+1b8d : 98 __ __ TYA
+1b8e : 65 06 __ ADC $06
+1b90 : 06 1b __ ASL ACCU + 0
+1b92 : 2a __ __ ROL
+1b93 : 06 1b __ ASL ACCU + 0
+1b95 : 2a __ __ ROL
+1b96 : 85 1c __ STA ACCU + 1
+1b98 : 18 __ __ CLC
+1b99 : a5 47 __ LDA T0 + 0
+1b9b : 65 1b __ ADC ACCU + 0
+1b9d : 85 44 __ STA T6 + 0
+1b9f : a5 48 __ LDA T0 + 1
+1ba1 : 65 1c __ ADC ACCU + 1
+1ba3 : 85 45 __ STA T6 + 1
+1ba5 : a0 0b __ LDY #$0b
+1ba7 : b1 44 __ LDA (T6 + 0),y
+1ba9 : 91 49 __ STA (T2 + 0),y
+1bab : 88 __ __ DEY
+1bac : 10 f9 __ BPL $1ba7
+1bae : a0 0b __ LDY #$0b
+1bb0 : b1 4f __ LDA (T5 + 0),y
+1bb2 : 91 44 __ STA (T6 + 0),y
+1bb4 : 88 __ __ DEY
+1bb5 : 10 f9 __ BPL $1bb0
+1bb7 : 18 __ __ CLC
+1bb8 : a5 49 __ LDA T2 + 0
+1bba : 69 0c __ ADC #$0c
+1bbc : 85 49 __ STA T2 + 0
+1bbe : a5 4a __ LDA T2 + 1
+1bc0 : 69 00 __ ADC #$00
+1bc2 : 85 4a __ STA T2 + 1
+1bc4 : c5 4e __ CMP T4 + 1
+1bc6 : d0 04 __ BNE $1bcc
+1bc8 : a5 49 __ LDA T2 + 0
+1bca : c5 4d __ CMP T4 + 0
+1bcc : 90 8a __ BCC $1b58
+1bce : 4c 07 1b JMP $1b07 ; (shuffle + 28)
+--------------------------------------------------------------------
+rand:
+1bd1 : ad 86 23 LDA $2386 ; (seed + 1)
+1bd4 : 4a __ __ LSR
+1bd5 : ad 85 23 LDA $2385 ; (seed + 0)
+1bd8 : 6a __ __ ROR
+1bd9 : aa __ __ TAX
+1bda : a9 00 __ LDA #$00
+1bdc : 6a __ __ ROR
+1bdd : 4d 85 23 EOR $2385 ; (seed + 0)
+1be0 : 85 43 __ STA T0 + 0
+1be2 : 8a __ __ TXA
+1be3 : 4d 86 23 EOR $2386 ; (seed + 1)
+1be6 : 85 44 __ STA T0 + 1
+1be8 : 4a __ __ LSR
+1be9 : 45 43 __ EOR T0 + 0
+1beb : aa __ __ TAX
+1bec : 85 1b __ STA ACCU + 0
+1bee : 45 44 __ EOR T0 + 1
+1bf0 : a8 __ __ TAY
+1bf1 : 8e 85 23 STX $2385 ; (seed + 0)
+1bf4 : 98 __ __ TYA
+1bf5 : 84 1c __ STY ACCU + 1
+1bf7 : 8d 86 23 STA $2386 ; (seed + 1)
+1bfa : 60 __ __ RTS
+--------------------------------------------------------------------
+qsort:
+1bfb : 38 __ __ SEC
+1bfc : a5 23 __ LDA SP + 0
+1bfe : e9 12 __ SBC #$12
+1c00 : 85 23 __ STA SP + 0
+1c02 : a5 24 __ LDA SP + 1
+1c04 : e9 00 __ SBC #$00
+1c06 : 85 24 __ STA SP + 1
+1c08 : a0 03 __ LDY #$03
+1c0a : b9 53 00 LDA $0053,y 
+1c0d : 91 23 __ STA (SP + 0),y
+1c0f : 88 __ __ DEY
+1c10 : 10 f8 __ BPL $1c0a
+1c12 : 38 __ __ SEC
+1c13 : a5 23 __ LDA SP + 0
+1c15 : e9 06 __ SBC #$06
+1c17 : 85 23 __ STA SP + 0
+1c19 : a5 24 __ LDA SP + 1
+1c1b : e9 00 __ SBC #$00
+1c1d : 85 24 __ STA SP + 1
+1c1f : a0 1c __ LDY #$1c
+1c21 : b1 23 __ LDA (SP + 0),y
+1c23 : 85 53 __ STA T0 + 0
+1c25 : c8 __ __ INY
+1c26 : b1 23 __ LDA (SP + 0),y
+1c28 : 85 54 __ STA T0 + 1
+1c2a : 10 25 __ BPL $1c51
+1c2c : 18 __ __ CLC
+1c2d : a5 23 __ LDA SP + 0
+1c2f : 69 06 __ ADC #$06
+1c31 : 85 23 __ STA SP + 0
+1c33 : a5 24 __ LDA SP + 1
+1c35 : 69 00 __ ADC #$00
+1c37 : 85 24 __ STA SP + 1
+1c39 : a0 03 __ LDY #$03
+1c3b : b1 23 __ LDA (SP + 0),y
+1c3d : 99 53 00 STA $0053,y 
+1c40 : 88 __ __ DEY
+1c41 : 10 f8 __ BPL $1c3b
+1c43 : 18 __ __ CLC
+1c44 : a5 23 __ LDA SP + 0
+1c46 : 69 12 __ ADC #$12
+1c48 : 85 23 __ STA SP + 0
+1c4a : a5 24 __ LDA SP + 1
+1c4c : 69 00 __ ADC #$00
+1c4e : 85 24 __ STA SP + 1
+1c50 : 60 __ __ RTS
+1c51 : d0 06 __ BNE $1c59
+1c53 : a9 01 __ LDA #$01
+1c55 : c5 53 __ CMP T0 + 0
+1c57 : b0 d3 __ BCS $1c2c
+1c59 : 18 __ __ CLC
+1c5a : a5 23 __ LDA SP + 0
+1c5c : 69 0a __ ADC #$0a
+1c5e : 85 55 __ STA T2 + 0
+1c60 : a5 24 __ LDA SP + 1
+1c62 : 69 00 __ ADC #$00
+1c64 : 85 56 __ STA T2 + 1
+1c66 : a0 1a __ LDY #$1a
+1c68 : b1 23 __ LDA (SP + 0),y
+1c6a : 85 44 __ STA T3 + 0
+1c6c : c8 __ __ INY
+1c6d : b1 23 __ LDA (SP + 0),y
+1c6f : 85 45 __ STA T3 + 1
+1c71 : a0 0b __ LDY #$0b
+1c73 : b1 44 __ LDA (T3 + 0),y
+1c75 : 91 55 __ STA (T2 + 0),y
+1c77 : 88 __ __ DEY
+1c78 : 10 f9 __ BPL $1c73
+1c7a : a9 00 __ LDA #$00
+1c7c : 85 55 __ STA T2 + 0
+1c7e : 85 56 __ STA T2 + 1
+1c80 : a5 54 __ LDA T0 + 1
+1c82 : 30 03 __ BMI $1c87
+1c84 : 4c 49 1d JMP $1d49 ; (qsort + 334)
+1c87 : a0 1a __ LDY #$1a
+1c89 : b1 23 __ LDA (SP + 0),y
+1c8b : 85 53 __ STA T0 + 0
+1c8d : c8 __ __ INY
+1c8e : b1 23 __ LDA (SP + 0),y
+1c90 : 85 54 __ STA T0 + 1
+1c92 : a5 55 __ LDA T2 + 0
+1c94 : 0a __ __ ASL
+1c95 : aa __ __ TAX
+1c96 : a5 56 __ LDA T2 + 1
+1c98 : 2a __ __ ROL
+1c99 : a8 __ __ TAY
+1c9a : 18 __ __ CLC
+1c9b : 8a __ __ TXA
+1c9c : 65 55 __ ADC T2 + 0
+1c9e : 85 1b __ STA ACCU + 0
+1ca0 : 98 __ __ TYA
+1ca1 : 65 56 __ ADC T2 + 1
+1ca3 : 06 1b __ ASL ACCU + 0
+1ca5 : 2a __ __ ROL
+1ca6 : 06 1b __ ASL ACCU + 0
+1ca8 : 2a __ __ ROL
+1ca9 : 85 1c __ STA ACCU + 1
+1cab : 18 __ __ CLC
+1cac : a5 53 __ LDA T0 + 0
+1cae : 65 1b __ ADC ACCU + 0
+1cb0 : 85 44 __ STA T3 + 0
+1cb2 : a5 54 __ LDA T0 + 1
+1cb4 : 65 1c __ ADC ACCU + 1
+1cb6 : 85 45 __ STA T3 + 1
+1cb8 : 18 __ __ CLC
+1cb9 : a5 23 __ LDA SP + 0
+1cbb : 69 0a __ ADC #$0a
+1cbd : 85 46 __ STA T4 + 0
+1cbf : a5 24 __ LDA SP + 1
+1cc1 : 69 00 __ ADC #$00
+1cc3 : 85 47 __ STA T4 + 1
+1cc5 : a0 0b __ LDY #$0b
+1cc7 : b1 46 __ LDA (T4 + 0),y
+1cc9 : 91 44 __ STA (T3 + 0),y
+1ccb : 88 __ __ DEY
+1ccc : 10 f9 __ BPL $1cc7
+1cce : a5 53 __ LDA T0 + 0
+1cd0 : a0 02 __ LDY #$02
+1cd2 : 91 23 __ STA (SP + 0),y
+1cd4 : a5 54 __ LDA T0 + 1
+1cd6 : c8 __ __ INY
+1cd7 : 91 23 __ STA (SP + 0),y
+1cd9 : a5 55 __ LDA T2 + 0
+1cdb : c8 __ __ INY
+1cdc : 91 23 __ STA (SP + 0),y
+1cde : a5 56 __ LDA T2 + 1
+1ce0 : c8 __ __ INY
+1ce1 : 91 23 __ STA (SP + 0),y
+1ce3 : 20 fb 1b JSR $1bfb ; (qsort + 0)
+1ce6 : a0 1a __ LDY #$1a
+1ce8 : b1 23 __ LDA (SP + 0),y
+1cea : 85 53 __ STA T0 + 0
+1cec : c8 __ __ INY
+1ced : b1 23 __ LDA (SP + 0),y
+1cef : 85 54 __ STA T0 + 1
+1cf1 : a5 55 __ LDA T2 + 0
+1cf3 : 0a __ __ ASL
+1cf4 : aa __ __ TAX
+1cf5 : a5 56 __ LDA T2 + 1
+1cf7 : 2a __ __ ROL
+1cf8 : a8 __ __ TAY
+1cf9 : 18 __ __ CLC
+1cfa : 8a __ __ TXA
+1cfb : 65 55 __ ADC T2 + 0
+1cfd : 85 1b __ STA ACCU + 0
+1cff : 98 __ __ TYA
+1d00 : 65 56 __ ADC T2 + 1
+1d02 : 06 1b __ ASL ACCU + 0
+1d04 : 2a __ __ ROL
+1d05 : 06 1b __ ASL ACCU + 0
+1d07 : 2a __ __ ROL
+1d08 : 85 1c __ STA ACCU + 1
+1d0a : 18 __ __ CLC
+1d0b : a5 53 __ LDA T0 + 0
+1d0d : 65 1b __ ADC ACCU + 0
+1d0f : aa __ __ TAX
+1d10 : a5 54 __ LDA T0 + 1
+1d12 : 65 1c __ ADC ACCU + 1
+1d14 : 85 54 __ STA T0 + 1
+1d16 : 18 __ __ CLC
+1d17 : 8a __ __ TXA
+1d18 : 69 0c __ ADC #$0c
+1d1a : a0 02 __ LDY #$02
+1d1c : 91 23 __ STA (SP + 0),y
+1d1e : a5 54 __ LDA T0 + 1
+1d20 : 69 00 __ ADC #$00
+1d22 : c8 __ __ INY
+1d23 : 91 23 __ STA (SP + 0),y
+1d25 : a0 1c __ LDY #$1c
+1d27 : b1 23 __ LDA (SP + 0),y
+1d29 : 38 __ __ SEC
+1d2a : e5 55 __ SBC T2 + 0
+1d2c : aa __ __ TAX
+1d2d : c8 __ __ INY
+1d2e : b1 23 __ LDA (SP + 0),y
+1d30 : e5 56 __ SBC T2 + 1
+1d32 : 85 54 __ STA T0 + 1
+1d34 : 38 __ __ SEC
+1d35 : 8a __ __ TXA
+1d36 : e9 01 __ SBC #$01
+1d38 : a0 04 __ LDY #$04
+1d3a : 91 23 __ STA (SP + 0),y
+1d3c : a5 54 __ LDA T0 + 1
+1d3e : e9 00 __ SBC #$00
+1d40 : c8 __ __ INY
+1d41 : 91 23 __ STA (SP + 0),y
+1d43 : 20 fb 1b JSR $1bfb ; (qsort + 0)
+1d46 : 4c 2c 1c JMP $1c2c ; (qsort + 49)
+1d49 : d0 09 __ BNE $1d54
+1d4b : a9 01 __ LDA #$01
+1d4d : c5 53 __ CMP T0 + 0
+1d4f : 90 03 __ BCC $1d54
+1d51 : 4c 87 1c JMP $1c87 ; (qsort + 140)
+1d54 : a9 01 __ LDA #$01
+1d56 : 85 53 __ STA T0 + 0
+1d58 : a9 00 __ LDA #$00
+1d5a : 85 54 __ STA T0 + 1
+1d5c : a0 1a __ LDY #$1a
+1d5e : b1 23 __ LDA (SP + 0),y
+1d60 : 85 44 __ STA T3 + 0
+1d62 : c8 __ __ INY
+1d63 : b1 23 __ LDA (SP + 0),y
+1d65 : 85 45 __ STA T3 + 1
+1d67 : a5 53 __ LDA T0 + 0
+1d69 : 0a __ __ ASL
+1d6a : aa __ __ TAX
+1d6b : a5 54 __ LDA T0 + 1
+1d6d : 2a __ __ ROL
+1d6e : a8 __ __ TAY
+1d6f : 18 __ __ CLC
+1d70 : 8a __ __ TXA
+1d71 : 65 53 __ ADC T0 + 0
+1d73 : 85 1b __ STA ACCU + 0
+1d75 : 98 __ __ TYA
+1d76 : 65 54 __ ADC T0 + 1
+1d78 : 06 1b __ ASL ACCU + 0
+1d7a : 2a __ __ ROL
+1d7b : 06 1b __ ASL ACCU + 0
+1d7d : 2a __ __ ROL
+1d7e : 85 1c __ STA ACCU + 1
+1d80 : 18 __ __ CLC
+1d81 : a5 44 __ LDA T3 + 0
+1d83 : 65 1b __ ADC ACCU + 0
+1d85 : aa __ __ TAX
+1d86 : a5 45 __ LDA T3 + 1
+1d88 : 65 1c __ ADC ACCU + 1
+1d8a : a8 __ __ TAY
+1d8b : 18 __ __ CLC
+1d8c : 8a __ __ TXA
+1d8d : 69 02 __ ADC #$02
+1d8f : 85 0d __ STA P0
+1d91 : 98 __ __ TYA
+1d92 : 69 00 __ ADC #$00
+1d94 : 85 0e __ STA P1
+1d96 : 18 __ __ CLC
+1d97 : a5 23 __ LDA SP + 0
+1d99 : 69 0c __ ADC #$0c
+1d9b : 85 0f __ STA P2
+1d9d : a5 24 __ LDA SP + 1
+1d9f : 69 00 __ ADC #$00
+1da1 : 85 10 __ STA P3
+1da3 : 20 4e 1e JSR $1e4e ; (strcmp + 0)
+1da6 : a5 1c __ LDA ACCU + 1
+1da8 : 30 24 __ BMI $1dce
+1daa : a0 1c __ LDY #$1c
+1dac : b1 23 __ LDA (SP + 0),y
+1dae : 85 44 __ STA T3 + 0
+1db0 : c8 __ __ INY
+1db1 : b1 23 __ LDA (SP + 0),y
+1db3 : e6 53 __ INC T0 + 0
+1db5 : d0 02 __ BNE $1db9
+1db7 : e6 54 __ INC T0 + 1
+1db9 : 49 80 __ EOR #$80
+1dbb : 85 03 __ STA $03
+1dbd : a5 54 __ LDA T0 + 1
+1dbf : 49 80 __ EOR #$80
+1dc1 : c5 03 __ CMP $03
+1dc3 : d0 04 __ BNE $1dc9
+1dc5 : a5 53 __ LDA T0 + 0
+1dc7 : c5 44 __ CMP T3 + 0
+1dc9 : 90 91 __ BCC $1d5c
+1dcb : 4c 87 1c JMP $1c87 ; (qsort + 140)
+1dce : a0 1a __ LDY #$1a
+1dd0 : b1 23 __ LDA (SP + 0),y
+1dd2 : 85 44 __ STA T3 + 0
+1dd4 : c8 __ __ INY
+1dd5 : b1 23 __ LDA (SP + 0),y
+1dd7 : 85 45 __ STA T3 + 1
+1dd9 : a5 55 __ LDA T2 + 0
+1ddb : 0a __ __ ASL
+1ddc : aa __ __ TAX
+1ddd : a5 56 __ LDA T2 + 1
+1ddf : 2a __ __ ROL
+1de0 : a8 __ __ TAY
+1de1 : 18 __ __ CLC
+1de2 : 8a __ __ TXA
+1de3 : 65 55 __ ADC T2 + 0
+1de5 : 85 1b __ STA ACCU + 0
+1de7 : 98 __ __ TYA
+1de8 : 65 56 __ ADC T2 + 1
+1dea : 06 1b __ ASL ACCU + 0
+1dec : 2a __ __ ROL
+1ded : 06 1b __ ASL ACCU + 0
+1def : 2a __ __ ROL
+1df0 : 85 1c __ STA ACCU + 1
+1df2 : 18 __ __ CLC
+1df3 : a5 44 __ LDA T3 + 0
+1df5 : 65 1b __ ADC ACCU + 0
+1df7 : 85 46 __ STA T4 + 0
+1df9 : a5 45 __ LDA T3 + 1
+1dfb : 65 1c __ ADC ACCU + 1
+1dfd : 85 47 __ STA T4 + 1
+1dff : a5 53 __ LDA T0 + 0
+1e01 : 0a __ __ ASL
+1e02 : aa __ __ TAX
+1e03 : a5 54 __ LDA T0 + 1
+1e05 : 2a __ __ ROL
+1e06 : a8 __ __ TAY
+1e07 : 18 __ __ CLC
+1e08 : 8a __ __ TXA
+1e09 : 65 53 __ ADC T0 + 0
+1e0b : 85 1b __ STA ACCU + 0
+1e0d : 98 __ __ TYA
+1e0e : 65 54 __ ADC T0 + 1
+1e10 : 06 1b __ ASL ACCU + 0
+1e12 : 2a __ __ ROL
+1e13 : 06 1b __ ASL ACCU + 0
+1e15 : 2a __ __ ROL
+1e16 : 85 1c __ STA ACCU + 1
+1e18 : 18 __ __ CLC
+1e19 : a5 44 __ LDA T3 + 0
+1e1b : 65 1b __ ADC ACCU + 0
+1e1d : 85 44 __ STA T3 + 0
+1e1f : a5 45 __ LDA T3 + 1
+1e21 : 65 1c __ ADC ACCU + 1
+1e23 : 85 45 __ STA T3 + 1
+1e25 : a0 0b __ LDY #$0b
+1e27 : b1 44 __ LDA (T3 + 0),y
+1e29 : 91 46 __ STA (T4 + 0),y
+1e2b : 88 __ __ DEY
+1e2c : 10 f9 __ BPL $1e27
+1e2e : 18 __ __ CLC
+1e2f : a5 46 __ LDA T4 + 0
+1e31 : 69 0c __ ADC #$0c
+1e33 : 85 46 __ STA T4 + 0
+1e35 : 90 02 __ BCC $1e39
+1e37 : e6 47 __ INC T4 + 1
+1e39 : a0 0b __ LDY #$0b
+1e3b : b1 46 __ LDA (T4 + 0),y
+1e3d : 91 44 __ STA (T3 + 0),y
+1e3f : 88 __ __ DEY
+1e40 : 10 f9 __ BPL $1e3b
+1e42 : e6 55 __ INC T2 + 0
+1e44 : f0 03 __ BEQ $1e49
+1e46 : 4c aa 1d JMP $1daa ; (qsort + 431)
+1e49 : e6 56 __ INC T2 + 1
+1e4b : 4c aa 1d JMP $1daa ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+1e4e : a0 00 __ LDY #$00
+1e50 : 84 1c __ STY ACCU + 1
+1e52 : b1 0d __ LDA (P0),y
+1e54 : f0 16 __ BEQ $1e6c
+1e56 : d1 0f __ CMP (P2),y
+1e58 : d0 16 __ BNE $1e70
+1e5a : c8 __ __ INY
+1e5b : b1 0d __ LDA (P0),y
+1e5d : f0 0d __ BEQ $1e6c
+1e5f : d1 0f __ CMP (P2),y
+1e61 : d0 0d __ BNE $1e70
+1e63 : c8 __ __ INY
+1e64 : d0 ec __ BNE $1e52
+1e66 : e6 0e __ INC P1
+1e68 : e6 10 __ INC P3
+1e6a : d0 e6 __ BNE $1e52
+1e6c : d1 0f __ CMP (P2),y
+1e6e : f0 0a __ BEQ $1e7a
+1e70 : b0 06 __ BCS $1e78
+1e72 : a9 ff __ LDA #$ff
+1e74 : 85 1c __ STA ACCU + 1
+1e76 : 30 02 __ BMI $1e7a
+1e78 : a9 01 __ LDA #$01
+1e7a : 85 1b __ STA ACCU + 0
+1e7c : 60 __ __ RTS
+--------------------------------------------------------------------
+check:
+1e7d : 38 __ __ SEC
+1e7e : a5 23 __ LDA SP + 0
+1e80 : e9 03 __ SBC #$03
+1e82 : 85 23 __ STA SP + 0
+1e84 : a5 24 __ LDA SP + 1
+1e86 : e9 00 __ SBC #$00
+1e88 : 85 24 __ STA SP + 1
+1e8a : a0 07 __ LDY #$07
+1e8c : b1 23 __ LDA (SP + 0),y
+1e8e : 85 44 __ STA T0 + 0
+1e90 : c8 __ __ INY
+1e91 : b1 23 __ LDA (SP + 0),y
+1e93 : 30 04 __ BMI $1e99
+1e95 : 05 44 __ ORA T0 + 0
+1e97 : d0 0e __ BNE $1ea7
+1e99 : 18 __ __ CLC
+1e9a : a5 23 __ LDA SP + 0
+1e9c : 69 03 __ ADC #$03
+1e9e : 85 23 __ STA SP + 0
+1ea0 : a5 24 __ LDA SP + 1
+1ea2 : 69 00 __ ADC #$00
+1ea4 : 85 24 __ STA SP + 1
+1ea6 : 60 __ __ RTS
+1ea7 : a9 00 __ LDA #$00
+1ea9 : 85 44 __ STA T0 + 0
+1eab : 85 45 __ STA T0 + 1
+1ead : a0 05 __ LDY #$05
+1eaf : b1 23 __ LDA (SP + 0),y
+1eb1 : 85 46 __ STA T2 + 0
+1eb3 : c8 __ __ INY
+1eb4 : b1 23 __ LDA (SP + 0),y
+1eb6 : 85 47 __ STA T2 + 1
+1eb8 : c8 __ __ INY
+1eb9 : b1 23 __ LDA (SP + 0),y
+1ebb : 85 48 __ STA T3 + 0
+1ebd : c8 __ __ INY
+1ebe : b1 23 __ LDA (SP + 0),y
+1ec0 : 85 49 __ STA T3 + 1
+1ec2 : a0 00 __ LDY #$00
+1ec4 : b1 46 __ LDA (T2 + 0),y
+1ec6 : 85 4a __ STA T4 + 0
+1ec8 : c8 __ __ INY
+1ec9 : b1 46 __ LDA (T2 + 0),y
+1ecb : c5 45 __ CMP T0 + 1
+1ecd : d0 06 __ BNE $1ed5
+1ecf : a5 4a __ LDA T4 + 0
+1ed1 : c5 44 __ CMP T0 + 0
+1ed3 : f0 31 __ BEQ $1f06
+1ed5 : a9 00 __ LDA #$00
+1ed7 : a0 02 __ LDY #$02
+1ed9 : 91 23 __ STA (SP + 0),y
+1edb : 20 0b 1f JSR $1f0b ; (assert + 0)
+1ede : 18 __ __ CLC
+1edf : a5 46 __ LDA T2 + 0
+1ee1 : 69 0c __ ADC #$0c
+1ee3 : 85 46 __ STA T2 + 0
+1ee5 : 90 02 __ BCC $1ee9
+1ee7 : e6 47 __ INC T2 + 1
+1ee9 : e6 44 __ INC T0 + 0
+1eeb : d0 02 __ BNE $1eef
+1eed : e6 45 __ INC T0 + 1
+1eef : a5 49 __ LDA T3 + 1
+1ef1 : 49 80 __ EOR #$80
+1ef3 : 85 03 __ STA $03
+1ef5 : a5 45 __ LDA T0 + 1
+1ef7 : 49 80 __ EOR #$80
+1ef9 : c5 03 __ CMP $03
+1efb : d0 04 __ BNE $1f01
+1efd : a5 44 __ LDA T0 + 0
+1eff : c5 48 __ CMP T3 + 0
+1f01 : 90 bf __ BCC $1ec2
+1f03 : 4c 99 1e JMP $1e99 ; (check + 28)
+1f06 : a9 01 __ LDA #$01
+1f08 : 4c d7 1e JMP $1ed7 ; (check + 90)
+--------------------------------------------------------------------
+assert:
+1f0b : a0 02 __ LDY #$02
+1f0d : b1 23 __ LDA (SP + 0),y
+1f0f : d0 09 __ BNE $1f1a
+1f11 : a9 ff __ LDA #$ff
+1f13 : 85 0d __ STA P0
+1f15 : 85 0e __ STA P1
+1f17 : 20 1b 1f JSR $1f1b ; (exit + 0)
+1f1a : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1f1b : a5 0d __ LDA P0
+1f1d : 85 1b __ STA ACCU + 0
+1f1f : a5 0e __ LDA P1
+1f21 : 85 1c __ STA ACCU + 1
+1f23 : ae 83 23 LDX $2383 ; (spentry + 0)
+1f26 : 9a __ __ TXS
+1f27 : a9 4c __ LDA #$4c
+1f29 : 85 54 __ STA $54
+1f2b : a9 00 __ LDA #$00
+1f2d : 85 13 __ STA P6
+1f2f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1f30 : a9 4c __ LDA #$4c
+1f32 : 85 54 __ STA $54
+1f34 : a9 00 __ LDA #$00
+1f36 : 85 13 __ STA P6
+1f38 : a9 19 __ LDA #$19
+1f3a : 85 16 __ STA P9
+1f3c : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1f3d : b1 19 __ LDA (IP + 0),y
+1f3f : c8 __ __ INY
+1f40 : aa __ __ TAX
+1f41 : b5 00 __ LDA $00,x
+1f43 : 85 03 __ STA $03
+1f45 : b5 01 __ LDA $01,x
+1f47 : 85 04 __ STA $04
+1f49 : b5 02 __ LDA $02,x
+1f4b : 85 05 __ STA $05
+1f4d : b5 03 __ LDA $03,x
+1f4f : 85 06 __ STA $06
+1f51 : a5 05 __ LDA $05
+1f53 : 0a __ __ ASL
+1f54 : a5 06 __ LDA $06
+1f56 : 2a __ __ ROL
+1f57 : 85 08 __ STA $08
+1f59 : f0 06 __ BEQ $1f61
+1f5b : a5 05 __ LDA $05
+1f5d : 09 80 __ ORA #$80
+1f5f : 85 05 __ STA $05
+1f61 : a5 1d __ LDA ACCU + 2
+1f63 : 0a __ __ ASL
+1f64 : a5 1e __ LDA ACCU + 3
+1f66 : 2a __ __ ROL
+1f67 : 85 07 __ STA $07
+1f69 : f0 06 __ BEQ $1f71
+1f6b : a5 1d __ LDA ACCU + 2
+1f6d : 09 80 __ ORA #$80
+1f6f : 85 1d __ STA ACCU + 2
+1f71 : 60 __ __ RTS
+1f72 : 06 1e __ ASL ACCU + 3
+1f74 : a5 07 __ LDA $07
+1f76 : 6a __ __ ROR
+1f77 : 85 1e __ STA ACCU + 3
+1f79 : b0 06 __ BCS $1f81
+1f7b : a5 1d __ LDA ACCU + 2
+1f7d : 29 7f __ AND #$7f
+1f7f : 85 1d __ STA ACCU + 2
+1f81 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1f82 : 38 __ __ SEC
+1f83 : a5 07 __ LDA $07
+1f85 : e5 08 __ SBC $08
+1f87 : f0 38 __ BEQ $1fc1
+1f89 : aa __ __ TAX
+1f8a : b0 25 __ BCS $1fb1
+1f8c : e0 e9 __ CPX #$e9
+1f8e : b0 0e __ BCS $1f9e
+1f90 : a5 08 __ LDA $08
+1f92 : 85 07 __ STA $07
+1f94 : a9 00 __ LDA #$00
+1f96 : 85 1b __ STA ACCU + 0
+1f98 : 85 1c __ STA ACCU + 1
+1f9a : 85 1d __ STA ACCU + 2
+1f9c : f0 23 __ BEQ $1fc1
+1f9e : a5 1d __ LDA ACCU + 2
+1fa0 : 4a __ __ LSR
+1fa1 : 66 1c __ ROR ACCU + 1
+1fa3 : 66 1b __ ROR ACCU + 0
+1fa5 : e8 __ __ INX
+1fa6 : d0 f8 __ BNE $1fa0
+1fa8 : 85 1d __ STA ACCU + 2
+1faa : a5 08 __ LDA $08
+1fac : 85 07 __ STA $07
+1fae : 4c c1 1f JMP $1fc1 ; (faddsub + 63)
+1fb1 : e0 18 __ CPX #$18
+1fb3 : b0 33 __ BCS $1fe8
+1fb5 : a5 05 __ LDA $05
+1fb7 : 4a __ __ LSR
+1fb8 : 66 04 __ ROR $04
+1fba : 66 03 __ ROR $03
+1fbc : ca __ __ DEX
+1fbd : d0 f8 __ BNE $1fb7
+1fbf : 85 05 __ STA $05
+1fc1 : a5 1e __ LDA ACCU + 3
+1fc3 : 29 80 __ AND #$80
+1fc5 : 85 1e __ STA ACCU + 3
+1fc7 : 45 06 __ EOR $06
+1fc9 : 30 2d __ BMI $1ff8
+1fcb : 18 __ __ CLC
+1fcc : a5 1b __ LDA ACCU + 0
+1fce : 65 03 __ ADC $03
+1fd0 : 85 1b __ STA ACCU + 0
+1fd2 : a5 1c __ LDA ACCU + 1
+1fd4 : 65 04 __ ADC $04
+1fd6 : 85 1c __ STA ACCU + 1
+1fd8 : a5 1d __ LDA ACCU + 2
+1fda : 65 05 __ ADC $05
+1fdc : 85 1d __ STA ACCU + 2
+1fde : 90 08 __ BCC $1fe8
+1fe0 : 66 1d __ ROR ACCU + 2
+1fe2 : 66 1c __ ROR ACCU + 1
+1fe4 : 66 1b __ ROR ACCU + 0
+1fe6 : e6 07 __ INC $07
+1fe8 : a5 07 __ LDA $07
+1fea : 4a __ __ LSR
+1feb : 05 1e __ ORA ACCU + 3
+1fed : 85 1e __ STA ACCU + 3
+1fef : b0 06 __ BCS $1ff7
+1ff1 : a5 1d __ LDA ACCU + 2
+1ff3 : 29 7f __ AND #$7f
+1ff5 : 85 1d __ STA ACCU + 2
+1ff7 : 60 __ __ RTS
+1ff8 : 38 __ __ SEC
+1ff9 : a5 1b __ LDA ACCU + 0
+1ffb : e5 03 __ SBC $03
+1ffd : 85 1b __ STA ACCU + 0
+1fff : a5 1c __ LDA ACCU + 1
+2001 : e5 04 __ SBC $04
+2003 : 85 1c __ STA ACCU + 1
+2005 : a5 1d __ LDA ACCU + 2
+2007 : e5 05 __ SBC $05
+2009 : 85 1d __ STA ACCU + 2
+200b : b0 19 __ BCS $2026
+200d : 38 __ __ SEC
+200e : a9 00 __ LDA #$00
+2010 : e5 1b __ SBC ACCU + 0
+2012 : 85 1b __ STA ACCU + 0
+2014 : a9 00 __ LDA #$00
+2016 : e5 1c __ SBC ACCU + 1
+2018 : 85 1c __ STA ACCU + 1
+201a : a9 00 __ LDA #$00
+201c : e5 1d __ SBC ACCU + 2
+201e : 85 1d __ STA ACCU + 2
+2020 : a5 1e __ LDA ACCU + 3
+2022 : 49 80 __ EOR #$80
+2024 : 85 1e __ STA ACCU + 3
+2026 : a5 1d __ LDA ACCU + 2
+2028 : 30 be __ BMI $1fe8
+202a : 05 1c __ ORA ACCU + 1
+202c : 05 1b __ ORA ACCU + 0
+202e : f0 0f __ BEQ $203f
+2030 : c6 07 __ DEC $07
+2032 : f0 0b __ BEQ $203f
+2034 : 06 1b __ ASL ACCU + 0
+2036 : 26 1c __ ROL ACCU + 1
+2038 : 26 1d __ ROL ACCU + 2
+203a : 10 f4 __ BPL $2030
+203c : 4c e8 1f JMP $1fe8 ; (faddsub + 102)
+203f : a9 00 __ LDA #$00
+2041 : 85 1b __ STA ACCU + 0
+2043 : 85 1c __ STA ACCU + 1
+2045 : 85 1d __ STA ACCU + 2
+2047 : 85 1e __ STA ACCU + 3
+2049 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+204a : a5 1b __ LDA ACCU + 0
+204c : 05 1c __ ORA ACCU + 1
+204e : 05 1d __ ORA ACCU + 2
+2050 : d0 03 __ BNE $2055
+2052 : 85 1e __ STA ACCU + 3
+2054 : 60 __ __ RTS
+2055 : a5 03 __ LDA $03
+2057 : 05 04 __ ORA $04
+2059 : 05 05 __ ORA $05
+205b : d0 09 __ BNE $2066
+205d : 85 1b __ STA ACCU + 0
+205f : 85 1c __ STA ACCU + 1
+2061 : 85 1d __ STA ACCU + 2
+2063 : 85 1e __ STA ACCU + 3
+2065 : 60 __ __ RTS
+2066 : a9 00 __ LDA #$00
+2068 : 85 09 __ STA $09
+206a : 85 0a __ STA $0a
+206c : 85 0b __ STA $0b
+206e : a4 1b __ LDY ACCU + 0
+2070 : a5 03 __ LDA $03
+2072 : d0 06 __ BNE $207a
+2074 : a5 04 __ LDA $04
+2076 : f0 0a __ BEQ $2082
+2078 : d0 05 __ BNE $207f
+207a : 20 ba 20 JSR $20ba ; (fmul8 + 0)
+207d : a5 04 __ LDA $04
+207f : 20 ba 20 JSR $20ba ; (fmul8 + 0)
+2082 : a5 05 __ LDA $05
+2084 : 20 ba 20 JSR $20ba ; (fmul8 + 0)
+2087 : 38 __ __ SEC
+2088 : a5 0b __ LDA $0b
+208a : 30 06 __ BMI $2092
+208c : 06 09 __ ASL $09
+208e : 26 0a __ ROL $0a
+2090 : 2a __ __ ROL
+2091 : 18 __ __ CLC
+2092 : 29 7f __ AND #$7f
+2094 : 85 0b __ STA $0b
+2096 : a5 1e __ LDA ACCU + 3
+2098 : 45 06 __ EOR $06
+209a : 29 80 __ AND #$80
+209c : 85 1e __ STA ACCU + 3
+209e : a5 07 __ LDA $07
+20a0 : e9 7e __ SBC #$7e
+20a2 : 18 __ __ CLC
+20a3 : 65 08 __ ADC $08
+20a5 : 4a __ __ LSR
+20a6 : 05 1e __ ORA ACCU + 3
+20a8 : 85 1e __ STA ACCU + 3
+20aa : a9 00 __ LDA #$00
+20ac : 6a __ __ ROR
+20ad : 05 0b __ ORA $0b
+20af : 85 1d __ STA ACCU + 2
+20b1 : a5 0a __ LDA $0a
+20b3 : 85 1c __ STA ACCU + 1
+20b5 : a5 09 __ LDA $09
+20b7 : 85 1b __ STA ACCU + 0
+20b9 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+20ba : 38 __ __ SEC
+20bb : 6a __ __ ROR
+20bc : 90 1e __ BCC $20dc
+20be : aa __ __ TAX
+20bf : 18 __ __ CLC
+20c0 : 98 __ __ TYA
+20c1 : 65 09 __ ADC $09
+20c3 : 85 09 __ STA $09
+20c5 : a5 0a __ LDA $0a
+20c7 : 65 1c __ ADC ACCU + 1
+20c9 : 85 0a __ STA $0a
+20cb : a5 0b __ LDA $0b
+20cd : 65 1d __ ADC ACCU + 2
+20cf : 6a __ __ ROR
+20d0 : 85 0b __ STA $0b
+20d2 : 8a __ __ TXA
+20d3 : 66 0a __ ROR $0a
+20d5 : 66 09 __ ROR $09
+20d7 : 4a __ __ LSR
+20d8 : f0 0d __ BEQ $20e7
+20da : b0 e2 __ BCS $20be
+20dc : 66 0b __ ROR $0b
+20de : 66 0a __ ROR $0a
+20e0 : 66 09 __ ROR $09
+20e2 : 4a __ __ LSR
+20e3 : 90 f7 __ BCC $20dc
+20e5 : d0 d7 __ BNE $20be
+20e7 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+20e8 : a5 1b __ LDA ACCU + 0
+20ea : 05 1c __ ORA ACCU + 1
+20ec : 05 1d __ ORA ACCU + 2
+20ee : d0 03 __ BNE $20f3
+20f0 : 85 1e __ STA ACCU + 3
+20f2 : 60 __ __ RTS
+20f3 : a5 1e __ LDA ACCU + 3
+20f5 : 45 06 __ EOR $06
+20f7 : 29 80 __ AND #$80
+20f9 : 85 1e __ STA ACCU + 3
+20fb : a9 00 __ LDA #$00
+20fd : 85 09 __ STA $09
+20ff : 85 0a __ STA $0a
+2101 : 85 0b __ STA $0b
+2103 : a2 18 __ LDX #$18
+2105 : a5 1b __ LDA ACCU + 0
+2107 : c5 03 __ CMP $03
+2109 : a5 1c __ LDA ACCU + 1
+210b : e5 04 __ SBC $04
+210d : a5 1d __ LDA ACCU + 2
+210f : e5 05 __ SBC $05
+2111 : 90 13 __ BCC $2126
+2113 : a5 1b __ LDA ACCU + 0
+2115 : e5 03 __ SBC $03
+2117 : 85 1b __ STA ACCU + 0
+2119 : a5 1c __ LDA ACCU + 1
+211b : e5 04 __ SBC $04
+211d : 85 1c __ STA ACCU + 1
+211f : a5 1d __ LDA ACCU + 2
+2121 : e5 05 __ SBC $05
+2123 : 85 1d __ STA ACCU + 2
+2125 : 38 __ __ SEC
+2126 : 26 09 __ ROL $09
+2128 : 26 0a __ ROL $0a
+212a : 26 0b __ ROL $0b
+212c : ca __ __ DEX
+212d : f0 0a __ BEQ $2139
+212f : 06 1b __ ASL ACCU + 0
+2131 : 26 1c __ ROL ACCU + 1
+2133 : 26 1d __ ROL ACCU + 2
+2135 : b0 dc __ BCS $2113
+2137 : 90 cc __ BCC $2105
+2139 : 38 __ __ SEC
+213a : a5 0b __ LDA $0b
+213c : 30 06 __ BMI $2144
+213e : 06 09 __ ASL $09
+2140 : 26 0a __ ROL $0a
+2142 : 2a __ __ ROL
+2143 : 18 __ __ CLC
+2144 : 29 7f __ AND #$7f
+2146 : 85 0b __ STA $0b
+2148 : a5 08 __ LDA $08
+214a : 49 7f __ EOR #$7f
+214c : 65 07 __ ADC $07
+214e : 38 __ __ SEC
+214f : e9 01 __ SBC #$01
+2151 : 4a __ __ LSR
+2152 : 05 1e __ ORA ACCU + 3
+2154 : 85 1e __ STA ACCU + 3
+2156 : a9 00 __ LDA #$00
+2158 : 6a __ __ ROR
+2159 : 05 0b __ ORA $0b
+215b : 85 1d __ STA ACCU + 2
+215d : a5 0a __ LDA $0a
+215f : 85 1c __ STA ACCU + 1
+2161 : a5 09 __ LDA $09
+2163 : 85 1b __ STA ACCU + 0
+2165 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+2166 : 24 1c __ BIT ACCU + 1
+2168 : 10 0d __ BPL $2177
+216a : 20 84 21 JSR $2184 ; (negaccu + 0)
+216d : 24 04 __ BIT $04
+216f : 10 0d __ BPL $217e
+2171 : 20 92 21 JSR $2192 ; (negtmp + 0)
+2174 : 4c a0 21 JMP $21a0 ; (divmod + 0)
+2177 : 24 04 __ BIT $04
+2179 : 10 f9 __ BPL $2174
+217b : 20 92 21 JSR $2192 ; (negtmp + 0)
+217e : 20 a0 21 JSR $21a0 ; (divmod + 0)
+2181 : 4c 84 21 JMP $2184 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+2184 : 38 __ __ SEC
+2185 : a9 00 __ LDA #$00
+2187 : e5 1b __ SBC ACCU + 0
+2189 : 85 1b __ STA ACCU + 0
+218b : a9 00 __ LDA #$00
+218d : e5 1c __ SBC ACCU + 1
+218f : 85 1c __ STA ACCU + 1
+2191 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+2192 : 38 __ __ SEC
+2193 : a9 00 __ LDA #$00
+2195 : e5 03 __ SBC $03
+2197 : 85 03 __ STA $03
+2199 : a9 00 __ LDA #$00
+219b : e5 04 __ SBC $04
+219d : 85 04 __ STA $04
+219f : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+21a0 : a5 1c __ LDA ACCU + 1
+21a2 : d0 31 __ BNE $21d5
+21a4 : a5 04 __ LDA $04
+21a6 : d0 1e __ BNE $21c6
+21a8 : 85 06 __ STA $06
+21aa : a2 04 __ LDX #$04
+21ac : 06 1b __ ASL ACCU + 0
+21ae : 2a __ __ ROL
+21af : c5 03 __ CMP $03
+21b1 : 90 02 __ BCC $21b5
+21b3 : e5 03 __ SBC $03
+21b5 : 26 1b __ ROL ACCU + 0
+21b7 : 2a __ __ ROL
+21b8 : c5 03 __ CMP $03
+21ba : 90 02 __ BCC $21be
+21bc : e5 03 __ SBC $03
+21be : 26 1b __ ROL ACCU + 0
+21c0 : ca __ __ DEX
+21c1 : d0 eb __ BNE $21ae
+21c3 : 85 05 __ STA $05
+21c5 : 60 __ __ RTS
+21c6 : a5 1b __ LDA ACCU + 0
+21c8 : 85 05 __ STA $05
+21ca : a5 1c __ LDA ACCU + 1
+21cc : 85 06 __ STA $06
+21ce : a9 00 __ LDA #$00
+21d0 : 85 1b __ STA ACCU + 0
+21d2 : 85 1c __ STA ACCU + 1
+21d4 : 60 __ __ RTS
+21d5 : a5 04 __ LDA $04
+21d7 : d0 1f __ BNE $21f8
+21d9 : a5 03 __ LDA $03
+21db : 30 1b __ BMI $21f8
+21dd : a9 00 __ LDA #$00
+21df : 85 06 __ STA $06
+21e1 : a2 10 __ LDX #$10
+21e3 : 06 1b __ ASL ACCU + 0
+21e5 : 26 1c __ ROL ACCU + 1
+21e7 : 2a __ __ ROL
+21e8 : c5 03 __ CMP $03
+21ea : 90 02 __ BCC $21ee
+21ec : e5 03 __ SBC $03
+21ee : 26 1b __ ROL ACCU + 0
+21f0 : 26 1c __ ROL ACCU + 1
+21f2 : ca __ __ DEX
+21f3 : d0 f2 __ BNE $21e7
+21f5 : 85 05 __ STA $05
+21f7 : 60 __ __ RTS
+21f8 : a9 00 __ LDA #$00
+21fa : 85 05 __ STA $05
+21fc : 85 06 __ STA $06
+21fe : 84 02 __ STY $02
+2200 : a0 10 __ LDY #$10
+2202 : 18 __ __ CLC
+2203 : 26 1b __ ROL ACCU + 0
+2205 : 26 1c __ ROL ACCU + 1
+2207 : 26 05 __ ROL $05
+2209 : 26 06 __ ROL $06
+220b : 38 __ __ SEC
+220c : a5 05 __ LDA $05
+220e : e5 03 __ SBC $03
+2210 : aa __ __ TAX
+2211 : a5 06 __ LDA $06
+2213 : e5 04 __ SBC $04
+2215 : 90 04 __ BCC $221b
+2217 : 86 05 __ STX $05
+2219 : 85 06 __ STA $06
+221b : 88 __ __ DEY
+221c : d0 e5 __ BNE $2203
+221e : 26 1b __ ROL ACCU + 0
+2220 : 26 1c __ ROL ACCU + 1
+2222 : a4 02 __ LDY $02
+2224 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2225 : 24 1c __ BIT ACCU + 1
+2227 : 10 0d __ BPL $2236
+2229 : 20 84 21 JSR $2184 ; (negaccu + 0)
+222c : 24 04 __ BIT $04
+222e : 10 0d __ BPL $223d
+2230 : 20 92 21 JSR $2192 ; (negtmp + 0)
+2233 : 4c a0 21 JMP $21a0 ; (divmod + 0)
+2236 : 24 04 __ BIT $04
+2238 : 10 f9 __ BPL $2233
+223a : 20 92 21 JSR $2192 ; (negtmp + 0)
+223d : 20 a0 21 JSR $21a0 ; (divmod + 0)
+2240 : 38 __ __ SEC
+2241 : a9 00 __ LDA #$00
+2243 : e5 05 __ SBC $05
+2245 : 85 05 __ STA $05
+2247 : a9 00 __ LDA #$00
+2249 : e5 06 __ SBC $06
+224b : 85 06 __ STA $06
+224d : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+224e : 20 61 1f JSR $1f61 ; (freg + 36)
+2251 : a5 07 __ LDA $07
+2253 : c9 7f __ CMP #$7f
+2255 : b0 07 __ BCS $225e
+2257 : a9 00 __ LDA #$00
+2259 : 85 1b __ STA ACCU + 0
+225b : 85 1c __ STA ACCU + 1
+225d : 60 __ __ RTS
+225e : 38 __ __ SEC
+225f : e9 8e __ SBC #$8e
+2261 : 90 0a __ BCC $226d
+2263 : a9 ff __ LDA #$ff
+2265 : 85 1b __ STA ACCU + 0
+2267 : a9 7f __ LDA #$7f
+2269 : 85 1c __ STA ACCU + 1
+226b : d0 08 __ BNE $2275
+226d : aa __ __ TAX
+226e : 46 1d __ LSR ACCU + 2
+2270 : 66 1c __ ROR ACCU + 1
+2272 : e8 __ __ INX
+2273 : d0 f9 __ BNE $226e
+2275 : 24 1e __ BIT ACCU + 3
+2277 : 10 0e __ BPL $2287
+2279 : 38 __ __ SEC
+227a : a9 00 __ LDA #$00
+227c : e5 1c __ SBC ACCU + 1
+227e : 85 1b __ STA ACCU + 0
+2280 : a9 00 __ LDA #$00
+2282 : e5 1d __ SBC ACCU + 2
+2284 : 85 1c __ STA ACCU + 1
+2286 : 60 __ __ RTS
+2287 : a5 1c __ LDA ACCU + 1
+2289 : 85 1b __ STA ACCU + 0
+228b : a5 1d __ LDA ACCU + 2
+228d : 85 1c __ STA ACCU + 1
+228f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2290 : 24 1c __ BIT ACCU + 1
+2292 : 30 03 __ BMI $2297
+2294 : 4c ae 22 JMP $22ae ; (uint16_to_float + 0)
+2297 : 38 __ __ SEC
+2298 : a9 00 __ LDA #$00
+229a : e5 1b __ SBC ACCU + 0
+229c : 85 1b __ STA ACCU + 0
+229e : a9 00 __ LDA #$00
+22a0 : e5 1c __ SBC ACCU + 1
+22a2 : 85 1c __ STA ACCU + 1
+22a4 : 20 ae 22 JSR $22ae ; (uint16_to_float + 0)
+22a7 : a5 1e __ LDA ACCU + 3
+22a9 : 09 80 __ ORA #$80
+22ab : 85 1e __ STA ACCU + 3
+22ad : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+22ae : a5 1b __ LDA ACCU + 0
+22b0 : 05 1c __ ORA ACCU + 1
+22b2 : d0 05 __ BNE $22b9
+22b4 : 85 1d __ STA ACCU + 2
+22b6 : 85 1e __ STA ACCU + 3
+22b8 : 60 __ __ RTS
+22b9 : a2 8e __ LDX #$8e
+22bb : a5 1c __ LDA ACCU + 1
+22bd : 30 06 __ BMI $22c5
+22bf : ca __ __ DEX
+22c0 : 06 1b __ ASL ACCU + 0
+22c2 : 2a __ __ ROL
+22c3 : 10 fa __ BPL $22bf
+22c5 : 29 7f __ AND #$7f
+22c7 : 85 1d __ STA ACCU + 2
+22c9 : a5 1b __ LDA ACCU + 0
+22cb : 85 1c __ STA ACCU + 1
+22cd : 8a __ __ TXA
+22ce : 4a __ __ LSR
+22cf : 85 1e __ STA ACCU + 3
+22d1 : a9 00 __ LDA #$00
+22d3 : 85 1b __ STA ACCU + 0
+22d5 : 6a __ __ ROR
+22d6 : 05 1d __ ORA ACCU + 2
+22d8 : 85 1d __ STA ACCU + 2
+22da : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+22db : a5 1e __ LDA ACCU + 3
+22dd : 45 06 __ EOR $06
+22df : 29 80 __ AND #$80
+22e1 : f0 1e __ BEQ $2301
+22e3 : a5 1e __ LDA ACCU + 3
+22e5 : 29 7f __ AND #$7f
+22e7 : 05 1d __ ORA ACCU + 2
+22e9 : 05 1c __ ORA ACCU + 1
+22eb : 05 1b __ ORA ACCU + 0
+22ed : d0 0c __ BNE $22fb
+22ef : a5 06 __ LDA $06
+22f1 : 29 7f __ AND #$7f
+22f3 : 05 05 __ ORA $05
+22f5 : 05 04 __ ORA $04
+22f7 : 05 03 __ ORA $03
+22f9 : f0 1e __ BEQ $2319
+22fb : a5 1e __ LDA ACCU + 3
+22fd : 30 23 __ BMI $2322
+22ff : 10 28 __ BPL $2329
+2301 : a5 1e __ LDA ACCU + 3
+2303 : c5 06 __ CMP $06
+2305 : d0 15 __ BNE $231c
+2307 : a5 1d __ LDA ACCU + 2
+2309 : c5 05 __ CMP $05
+230b : d0 0f __ BNE $231c
+230d : a5 1c __ LDA ACCU + 1
+230f : c5 04 __ CMP $04
+2311 : d0 09 __ BNE $231c
+2313 : a5 1b __ LDA ACCU + 0
+2315 : c5 03 __ CMP $03
+2317 : d0 03 __ BNE $231c
+2319 : a9 00 __ LDA #$00
+231b : 60 __ __ RTS
+231c : b0 07 __ BCS $2325
+231e : 24 1e __ BIT ACCU + 3
+2320 : 30 07 __ BMI $2329
+2322 : a9 01 __ LDA #$01
+2324 : 60 __ __ RTS
+2325 : 24 1e __ BIT ACCU + 3
+2327 : 30 f9 __ BMI $2322
+2329 : a9 ff __ LDA #$ff
+232b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+232c : 84 02 __ STY $02
+232e : a9 00 __ LDA #$00
+2330 : 85 07 __ STA $07
+2332 : 85 08 __ STA $08
+2334 : 85 09 __ STA $09
+2336 : 85 0a __ STA $0a
+2338 : a0 20 __ LDY #$20
+233a : 18 __ __ CLC
+233b : 26 1b __ ROL ACCU + 0
+233d : 26 1c __ ROL ACCU + 1
+233f : 26 1d __ ROL ACCU + 2
+2341 : 26 1e __ ROL ACCU + 3
+2343 : 26 07 __ ROL $07
+2345 : 26 08 __ ROL $08
+2347 : 26 09 __ ROL $09
+2349 : 26 0a __ ROL $0a
+234b : a5 07 __ LDA $07
+234d : c5 03 __ CMP $03
+234f : a5 08 __ LDA $08
+2351 : e5 04 __ SBC $04
+2353 : a5 09 __ LDA $09
+2355 : e5 05 __ SBC $05
+2357 : a5 0a __ LDA $0a
+2359 : e5 06 __ SBC $06
+235b : 90 18 __ BCC $2375
+235d : a5 07 __ LDA $07
+235f : e5 03 __ SBC $03
+2361 : 85 07 __ STA $07
+2363 : a5 08 __ LDA $08
+2365 : e5 04 __ SBC $04
+2367 : 85 08 __ STA $08
+2369 : a5 09 __ LDA $09
+236b : e5 05 __ SBC $05
+236d : 85 09 __ STA $09
+236f : a5 0a __ LDA $0a
+2371 : e5 06 __ SBC $06
+2373 : 85 0a __ STA $0a
+2375 : 88 __ __ DEY
+2376 : d0 c3 __ BNE $233b
+2378 : 26 1b __ ROL ACCU + 0
+237a : 26 1c __ ROL ACCU + 1
+237c : 26 1d __ ROL ACCU + 2
+237e : 26 1e __ ROL ACCU + 3
+2380 : a4 02 __ LDY $02
+2382 : 60 __ __ RTS
@@ -0,0 +1,3755 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e d6 24 STX $24d6 ; (spentry + 0)
+0811 : a9 da __ LDA #$da
+0813 : 85 19 __ STA IP + 0
+0815 : a9 24 __ LDA #$24
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 53 __ LDA #$53
+081c : e9 24 __ SBC #$24
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c6 __ LDA #$c6
+0832 : e9 da __ SBC #$da
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 83 20 JMP $2083 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 06 __ SBC #$06
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 da __ LDA #$da
+090f : a0 02 __ LDY #$02
+0911 : 91 23 __ STA (SP + 0),y
+0913 : a9 24 __ LDA #$24
+0915 : c8 __ __ INY
+0916 : 91 23 __ STA (SP + 0),y
+0918 : a9 e8 __ LDA #$e8
+091a : c8 __ __ INY
+091b : 91 23 __ STA (SP + 0),y
+091d : a9 03 __ LDA #$03
+091f : c8 __ __ INY
+0920 : 91 23 __ STA (SP + 0),y
+0922 : 20 81 09 JSR $0981 ; (init + 0)
+0925 : a9 da __ LDA #$da
+0927 : a0 02 __ LDY #$02
+0929 : 91 23 __ STA (SP + 0),y
+092b : a9 24 __ LDA #$24
+092d : c8 __ __ INY
+092e : 91 23 __ STA (SP + 0),y
+0930 : a9 e8 __ LDA #$e8
+0932 : c8 __ __ INY
+0933 : 91 23 __ STA (SP + 0),y
+0935 : a9 03 __ LDA #$03
+0937 : c8 __ __ INY
+0938 : 91 23 __ STA (SP + 0),y
+093a : 20 5e 1c JSR $1c5e ; (shuffle + 0)
+093d : a9 da __ LDA #$da
+093f : a0 02 __ LDY #$02
+0941 : 91 23 __ STA (SP + 0),y
+0943 : a9 24 __ LDA #$24
+0945 : c8 __ __ INY
+0946 : 91 23 __ STA (SP + 0),y
+0948 : a9 e8 __ LDA #$e8
+094a : c8 __ __ INY
+094b : 91 23 __ STA (SP + 0),y
+094d : a9 03 __ LDA #$03
+094f : c8 __ __ INY
+0950 : 91 23 __ STA (SP + 0),y
+0952 : 20 4e 1d JSR $1d4e ; (qsort + 0)
+0955 : a9 da __ LDA #$da
+0957 : a0 02 __ LDY #$02
+0959 : 91 23 __ STA (SP + 0),y
+095b : a9 24 __ LDA #$24
+095d : c8 __ __ INY
+095e : 91 23 __ STA (SP + 0),y
+0960 : a9 e8 __ LDA #$e8
+0962 : c8 __ __ INY
+0963 : 91 23 __ STA (SP + 0),y
+0965 : a9 03 __ LDA #$03
+0967 : c8 __ __ INY
+0968 : 91 23 __ STA (SP + 0),y
+096a : 20 d0 1f JSR $1fd0 ; (check + 0)
+096d : a9 00 __ LDA #$00
+096f : 85 1b __ STA ACCU + 0
+0971 : 85 1c __ STA ACCU + 1
+0973 : 18 __ __ CLC
+0974 : a5 23 __ LDA SP + 0
+0976 : 69 06 __ ADC #$06
+0978 : 85 23 __ STA SP + 0
+097a : a5 24 __ LDA SP + 1
+097c : 69 00 __ ADC #$00
+097e : 85 24 __ STA SP + 1
+0980 : 60 __ __ RTS
+--------------------------------------------------------------------
+init:
+0981 : 38 __ __ SEC
+0982 : a5 23 __ LDA SP + 0
+0984 : e9 08 __ SBC #$08
+0986 : 85 23 __ STA SP + 0
+0988 : a5 24 __ LDA SP + 1
+098a : e9 00 __ SBC #$00
+098c : 85 24 __ STA SP + 1
+098e : a0 0c __ LDY #$0c
+0990 : b1 23 __ LDA (SP + 0),y
+0992 : 85 67 __ STA T0 + 0
+0994 : c8 __ __ INY
+0995 : b1 23 __ LDA (SP + 0),y
+0997 : 30 04 __ BMI $099d
+0999 : 05 67 __ ORA T0 + 0
+099b : d0 0e __ BNE $09ab
+099d : 18 __ __ CLC
+099e : a5 23 __ LDA SP + 0
+09a0 : 69 08 __ ADC #$08
+09a2 : 85 23 __ STA SP + 0
+09a4 : a5 24 __ LDA SP + 1
+09a6 : 69 00 __ ADC #$00
+09a8 : 85 24 __ STA SP + 1
+09aa : 60 __ __ RTS
+09ab : a9 00 __ LDA #$00
+09ad : 85 67 __ STA T0 + 0
+09af : 85 68 __ STA T0 + 1
+09b1 : a0 0a __ LDY #$0a
+09b3 : b1 23 __ LDA (SP + 0),y
+09b5 : 85 69 __ STA T2 + 0
+09b7 : c8 __ __ INY
+09b8 : b1 23 __ LDA (SP + 0),y
+09ba : 85 6a __ STA T2 + 1
+09bc : c8 __ __ INY
+09bd : b1 23 __ LDA (SP + 0),y
+09bf : 85 6b __ STA T3 + 0
+09c1 : c8 __ __ INY
+09c2 : b1 23 __ LDA (SP + 0),y
+09c4 : 85 6c __ STA T3 + 1
+09c6 : a5 67 __ LDA T0 + 0
+09c8 : a0 00 __ LDY #$00
+09ca : 91 69 __ STA (T2 + 0),y
+09cc : a5 68 __ LDA T0 + 1
+09ce : c8 __ __ INY
+09cf : 91 69 __ STA (T2 + 0),y
+09d1 : 18 __ __ CLC
+09d2 : a5 69 __ LDA T2 + 0
+09d4 : 69 02 __ ADC #$02
+09d6 : c8 __ __ INY
+09d7 : 91 23 __ STA (SP + 0),y
+09d9 : a5 6a __ LDA T2 + 1
+09db : 69 00 __ ADC #$00
+09dd : c8 __ __ INY
+09de : 91 23 __ STA (SP + 0),y
+09e0 : a9 59 __ LDA #$59
+09e2 : c8 __ __ INY
+09e3 : 91 23 __ STA (SP + 0),y
+09e5 : a9 1c __ LDA #$1c
+09e7 : c8 __ __ INY
+09e8 : 91 23 __ STA (SP + 0),y
+09ea : a5 67 __ LDA T0 + 0
+09ec : c8 __ __ INY
+09ed : 91 23 __ STA (SP + 0),y
+09ef : a5 68 __ LDA T0 + 1
+09f1 : c8 __ __ INY
+09f2 : 91 23 __ STA (SP + 0),y
+09f4 : 20 1f 0a JSR $0a1f ; (sprintf + 0)
+09f7 : 18 __ __ CLC
+09f8 : a5 69 __ LDA T2 + 0
+09fa : 69 0c __ ADC #$0c
+09fc : 85 69 __ STA T2 + 0
+09fe : 90 02 __ BCC $0a02
+0a00 : e6 6a __ INC T2 + 1
+0a02 : e6 67 __ INC T0 + 0
+0a04 : d0 02 __ BNE $0a08
+0a06 : e6 68 __ INC T0 + 1
+0a08 : a5 6c __ LDA T3 + 1
+0a0a : 49 80 __ EOR #$80
+0a0c : 85 03 __ STA $03
+0a0e : a5 68 __ LDA T0 + 1
+0a10 : 49 80 __ EOR #$80
+0a12 : c5 03 __ CMP $03
+0a14 : d0 04 __ BNE $0a1a
+0a16 : a5 67 __ LDA T0 + 0
+0a18 : c5 6b __ CMP T3 + 0
+0a1a : 90 aa __ BCC $09c6
+0a1c : 4c 9d 09 JMP $099d ; (init + 28)
+--------------------------------------------------------------------
+sprintf:
+0a1f : 38 __ __ SEC
+0a20 : a5 23 __ LDA SP + 0
+0a22 : e9 09 __ SBC #$09
+0a24 : 85 23 __ STA SP + 0
+0a26 : a5 24 __ LDA SP + 1
+0a28 : e9 00 __ SBC #$00
+0a2a : 85 24 __ STA SP + 1
+0a2c : a0 0b __ LDY #$0b
+0a2e : b1 23 __ LDA (SP + 0),y
+0a30 : a0 02 __ LDY #$02
+0a32 : 91 23 __ STA (SP + 0),y
+0a34 : a0 0c __ LDY #$0c
+0a36 : b1 23 __ LDA (SP + 0),y
+0a38 : a0 03 __ LDY #$03
+0a3a : 91 23 __ STA (SP + 0),y
+0a3c : a0 0d __ LDY #$0d
+0a3e : b1 23 __ LDA (SP + 0),y
+0a40 : a0 04 __ LDY #$04
+0a42 : 91 23 __ STA (SP + 0),y
+0a44 : a0 0e __ LDY #$0e
+0a46 : b1 23 __ LDA (SP + 0),y
+0a48 : a0 05 __ LDY #$05
+0a4a : 91 23 __ STA (SP + 0),y
+0a4c : 18 __ __ CLC
+0a4d : a5 23 __ LDA SP + 0
+0a4f : 69 0f __ ADC #$0f
+0a51 : c8 __ __ INY
+0a52 : 91 23 __ STA (SP + 0),y
+0a54 : a5 24 __ LDA SP + 1
+0a56 : 69 00 __ ADC #$00
+0a58 : c8 __ __ INY
+0a59 : 91 23 __ STA (SP + 0),y
+0a5b : a9 00 __ LDA #$00
+0a5d : c8 __ __ INY
+0a5e : 91 23 __ STA (SP + 0),y
+0a60 : 20 89 0a JSR $0a89 ; (sformat + 0)
+0a63 : a0 0b __ LDY #$0b
+0a65 : b1 23 __ LDA (SP + 0),y
+0a67 : 85 45 __ STA T1 + 0
+0a69 : c8 __ __ INY
+0a6a : b1 23 __ LDA (SP + 0),y
+0a6c : 85 46 __ STA T1 + 1
+0a6e : 38 __ __ SEC
+0a6f : a5 1b __ LDA ACCU + 0
+0a71 : e5 45 __ SBC T1 + 0
+0a73 : 85 1b __ STA ACCU + 0
+0a75 : a5 1c __ LDA ACCU + 1
+0a77 : e5 46 __ SBC T1 + 1
+0a79 : 85 1c __ STA ACCU + 1
+0a7b : 18 __ __ CLC
+0a7c : a5 23 __ LDA SP + 0
+0a7e : 69 09 __ ADC #$09
+0a80 : 85 23 __ STA SP + 0
+0a82 : a5 24 __ LDA SP + 1
+0a84 : 69 00 __ ADC #$00
+0a86 : 85 24 __ STA SP + 1
+0a88 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0a89 : a0 02 __ LDY #$02
+0a8b : b1 23 __ LDA (SP + 0),y
+0a8d : 85 5d __ STA T0 + 0
+0a8f : c8 __ __ INY
+0a90 : b1 23 __ LDA (SP + 0),y
+0a92 : 85 5e __ STA T0 + 1
+0a94 : a9 00 __ LDA #$00
+0a96 : 85 5f __ STA T1 + 0
+0a98 : c8 __ __ INY
+0a99 : b1 23 __ LDA (SP + 0),y
+0a9b : 85 61 __ STA T2 + 0
+0a9d : c8 __ __ INY
+0a9e : b1 23 __ LDA (SP + 0),y
+0aa0 : 85 62 __ STA T2 + 1
+0aa2 : a0 00 __ LDY #$00
+0aa4 : b1 61 __ LDA (T2 + 0),y
+0aa6 : 85 43 __ STA T3 + 0
+0aa8 : d0 42 __ BNE $0aec
+0aaa : 18 __ __ CLC
+0aab : a5 5d __ LDA T0 + 0
+0aad : 65 5f __ ADC T1 + 0
+0aaf : 85 61 __ STA T2 + 0
+0ab1 : a5 5e __ LDA T0 + 1
+0ab3 : 69 00 __ ADC #$00
+0ab5 : 85 62 __ STA T2 + 1
+0ab7 : a9 00 __ LDA #$00
+0ab9 : a4 5f __ LDY T1 + 0
+0abb : 91 5d __ STA (T0 + 0),y
+0abd : 98 __ __ TYA
+0abe : d0 09 __ BNE $0ac9
+0ac0 : a5 5d __ LDA T0 + 0
+0ac2 : 85 1b __ STA ACCU + 0
+0ac4 : a5 5e __ LDA T0 + 1
+0ac6 : 85 1c __ STA ACCU + 1
+0ac8 : 60 __ __ RTS
+0ac9 : a0 08 __ LDY #$08
+0acb : b1 23 __ LDA (SP + 0),y
+0acd : d0 09 __ BNE $0ad8
+0acf : a5 61 __ LDA T2 + 0
+0ad1 : 85 1b __ STA ACCU + 0
+0ad3 : a5 62 __ LDA T2 + 1
+0ad5 : 4c c6 0a JMP $0ac6 ; (sformat + 61)
+0ad8 : a5 5d __ LDA T0 + 0
+0ada : 85 0d __ STA P0
+0adc : a5 5e __ LDA T0 + 1
+0ade : 85 0e __ STA P1
+0ae0 : 20 d2 13 JSR $13d2 ; (puts + 0)
+0ae3 : a5 5d __ LDA T0 + 0
+0ae5 : 85 1b __ STA ACCU + 0
+0ae7 : a5 5e __ LDA T0 + 1
+0ae9 : 4c c6 0a JMP $0ac6 ; (sformat + 61)
+0aec : e6 61 __ INC T2 + 0
+0aee : d0 02 __ BNE $0af2
+0af0 : e6 62 __ INC T2 + 1
+0af2 : a5 43 __ LDA T3 + 0
+0af4 : c9 25 __ CMP #$25
+0af6 : f0 72 __ BEQ $0b6a
+0af8 : a4 5f __ LDY T1 + 0
+0afa : 91 5d __ STA (T0 + 0),y
+0afc : e6 5f __ INC T1 + 0
+0afe : a5 5f __ LDA T1 + 0
+0b00 : c9 28 __ CMP #$28
+0b02 : 90 57 __ BCC $0b5b
+0b04 : a0 08 __ LDY #$08
+0b06 : b1 23 __ LDA (SP + 0),y
+0b08 : d0 24 __ BNE $0b2e
+0b0a : 18 __ __ CLC
+0b0b : a5 5d __ LDA T0 + 0
+0b0d : 65 5f __ ADC T1 + 0
+0b0f : 85 5d __ STA T0 + 0
+0b11 : 90 02 __ BCC $0b15
+0b13 : e6 5e __ INC T0 + 1
+0b15 : a9 00 __ LDA #$00
+0b17 : 85 5f __ STA T1 + 0
+0b19 : a0 00 __ LDY #$00
+0b1b : b1 61 __ LDA (T2 + 0),y
+0b1d : 85 45 __ STA T4 + 0
+0b1f : e6 61 __ INC T2 + 0
+0b21 : d0 02 __ BNE $0b25
+0b23 : e6 62 __ INC T2 + 1
+0b25 : a5 45 __ LDA T4 + 0
+0b27 : 85 43 __ STA T3 + 0
+0b29 : d0 c7 __ BNE $0af2
+0b2b : 4c aa 0a JMP $0aaa ; (sformat + 33)
+0b2e : 18 __ __ CLC
+0b2f : a5 5d __ LDA T0 + 0
+0b31 : 85 0d __ STA P0
+0b33 : 65 5f __ ADC T1 + 0
+0b35 : 85 47 __ STA T5 + 0
+0b37 : a5 5e __ LDA T0 + 1
+0b39 : 85 0e __ STA P1
+0b3b : 69 00 __ ADC #$00
+0b3d : 85 48 __ STA T5 + 1
+0b3f : a9 00 __ LDA #$00
+0b41 : a0 00 __ LDY #$00
+0b43 : 91 47 __ STA (T5 + 0),y
+0b45 : 20 d2 13 JSR $13d2 ; (puts + 0)
+0b48 : a9 00 __ LDA #$00
+0b4a : 85 5f __ STA T1 + 0
+0b4c : a0 00 __ LDY #$00
+0b4e : b1 61 __ LDA (T2 + 0),y
+0b50 : 85 45 __ STA T4 + 0
+0b52 : e6 61 __ INC T2 + 0
+0b54 : d0 02 __ BNE $0b58
+0b56 : e6 62 __ INC T2 + 1
+0b58 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0b5b : a0 00 __ LDY #$00
+0b5d : b1 61 __ LDA (T2 + 0),y
+0b5f : 85 45 __ STA T4 + 0
+0b61 : e6 61 __ INC T2 + 0
+0b63 : d0 02 __ BNE $0b67
+0b65 : e6 62 __ INC T2 + 1
+0b67 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0b6a : a5 5f __ LDA T1 + 0
+0b6c : f0 03 __ BEQ $0b71
+0b6e : 4c 99 13 JMP $1399 ; (sformat + 2320)
+0b71 : a0 00 __ LDY #$00
+0b73 : b1 61 __ LDA (T2 + 0),y
+0b75 : 85 43 __ STA T3 + 0
+0b77 : a9 0a __ LDA #$0a
+0b79 : 8d bd 53 STA $53bd ; (sframe + 3)
+0b7c : a9 00 __ LDA #$00
+0b7e : 8d be 53 STA $53be ; (sframe + 4)
+0b81 : a9 01 __ LDA #$01
+0b83 : 8d bb 53 STA $53bb ; (sframe + 1)
+0b86 : a9 ff __ LDA #$ff
+0b88 : 8d bc 53 STA $53bc ; (sframe + 2)
+0b8b : a9 20 __ LDA #$20
+0b8d : 8d ba 53 STA $53ba ; (sframe + 0)
+0b90 : a9 00 __ LDA #$00
+0b92 : 8d bf 53 STA $53bf ; (sframe + 5)
+0b95 : 8d c0 53 STA $53c0 ; (sframe + 6)
+0b98 : 8d c1 53 STA $53c1 ; (sframe + 7)
+0b9b : e6 61 __ INC T2 + 0
+0b9d : d0 02 __ BNE $0ba1
+0b9f : e6 62 __ INC T2 + 1
+0ba1 : a5 43 __ LDA T3 + 0
+0ba3 : c9 2b __ CMP #$2b
+0ba5 : d0 03 __ BNE $0baa
+0ba7 : 4c 8b 13 JMP $138b ; (sformat + 2306)
+0baa : c9 30 __ CMP #$30
+0bac : d0 03 __ BNE $0bb1
+0bae : 4c 7d 13 JMP $137d ; (sformat + 2292)
+0bb1 : c9 23 __ CMP #$23
+0bb3 : d0 03 __ BNE $0bb8
+0bb5 : 4c 6f 13 JMP $136f ; (sformat + 2278)
+0bb8 : c9 30 __ CMP #$30
+0bba : 90 64 __ BCC $0c20
+0bbc : a9 39 __ LDA #$39
+0bbe : c5 43 __ CMP T3 + 0
+0bc0 : 90 5e __ BCC $0c20
+0bc2 : a9 00 __ LDA #$00
+0bc4 : 85 47 __ STA T5 + 0
+0bc6 : 85 48 __ STA T5 + 1
+0bc8 : a5 43 __ LDA T3 + 0
+0bca : c9 30 __ CMP #$30
+0bcc : 90 4d __ BCC $0c1b
+0bce : a9 39 __ LDA #$39
+0bd0 : c5 43 __ CMP T3 + 0
+0bd2 : 90 47 __ BCC $0c1b
+0bd4 : a5 43 __ LDA T3 + 0
+0bd6 : 85 49 __ STA T6 + 0
+0bd8 : a0 00 __ LDY #$00
+0bda : b1 61 __ LDA (T2 + 0),y
+0bdc : 85 43 __ STA T3 + 0
+0bde : e6 61 __ INC T2 + 0
+0be0 : d0 02 __ BNE $0be4
+0be2 : e6 62 __ INC T2 + 1
+0be4 : a5 47 __ LDA T5 + 0
+0be6 : 0a __ __ ASL
+0be7 : 85 07 __ STA $07
+0be9 : a5 48 __ LDA T5 + 1
+0beb : 2a __ __ ROL
+0bec : 06 07 __ ASL $07
+0bee : 2a __ __ ROL
+0bef : aa __ __ TAX
+0bf0 : 18 __ __ CLC
+0bf1 : a5 07 __ LDA $07
+0bf3 : 65 47 __ ADC T5 + 0
+0bf5 : 85 1b __ STA ACCU + 0
+0bf7 : 8a __ __ TXA
+0bf8 : 65 48 __ ADC T5 + 1
+0bfa : 06 1b __ ASL ACCU + 0
+0bfc : 2a __ __ ROL
+0bfd : 85 1c __ STA ACCU + 1
+0bff : 18 __ __ CLC
+0c00 : a5 1b __ LDA ACCU + 0
+0c02 : 65 49 __ ADC T6 + 0
+0c04 : aa __ __ TAX
+0c05 : a5 1c __ LDA ACCU + 1
+0c07 : 69 00 __ ADC #$00
+0c09 : a8 __ __ TAY
+0c0a : 38 __ __ SEC
+0c0b : 8a __ __ TXA
+0c0c : e9 30 __ SBC #$30
+0c0e : 85 47 __ STA T5 + 0
+0c10 : 98 __ __ TYA
+0c11 : e9 00 __ SBC #$00
+0c13 : 85 48 __ STA T5 + 1
+0c15 : a5 43 __ LDA T3 + 0
+0c17 : c9 30 __ CMP #$30
+0c19 : b0 b3 __ BCS $0bce
+0c1b : a5 47 __ LDA T5 + 0
+0c1d : 8d bb 53 STA $53bb ; (sframe + 1)
+0c20 : a5 43 __ LDA T3 + 0
+0c22 : c9 2e __ CMP #$2e
+0c24 : d0 03 __ BNE $0c29
+0c26 : 4c 02 13 JMP $1302 ; (sformat + 2169)
+0c29 : a5 43 __ LDA T3 + 0
+0c2b : c9 64 __ CMP #$64
+0c2d : d0 03 __ BNE $0c32
+0c2f : 4c 6c 11 JMP $116c ; (sformat + 1763)
+0c32 : c9 75 __ CMP #$75
+0c34 : d0 03 __ BNE $0c39
+0c36 : 4c 1b 10 JMP $101b ; (sformat + 1426)
+0c39 : c9 78 __ CMP #$78
+0c3b : d0 03 __ BNE $0c40
+0c3d : 4c b3 0e JMP $0eb3 ; (sformat + 1066)
+0c40 : c9 6c __ CMP #$6c
+0c42 : d0 03 __ BNE $0c47
+0c44 : 4c a6 0d JMP $0da6 ; (sformat + 797)
+0c47 : c9 66 __ CMP #$66
+0c49 : d0 03 __ BNE $0c4e
+0c4b : 4c 35 0d JMP $0d35 ; (sformat + 684)
+0c4e : c9 67 __ CMP #$67
+0c50 : d0 03 __ BNE $0c55
+0c52 : 4c 35 0d JMP $0d35 ; (sformat + 684)
+0c55 : c9 65 __ CMP #$65
+0c57 : d0 03 __ BNE $0c5c
+0c59 : 4c 35 0d JMP $0d35 ; (sformat + 684)
+0c5c : c9 73 __ CMP #$73
+0c5e : f0 57 __ BEQ $0cb7
+0c60 : c9 63 __ CMP #$63
+0c62 : f0 1e __ BEQ $0c82
+0c64 : 09 00 __ ORA #$00
+0c66 : d0 03 __ BNE $0c6b
+0c68 : 4c 5b 0b JMP $0b5b ; (sformat + 210)
+0c6b : a5 43 __ LDA T3 + 0
+0c6d : a4 5f __ LDY T1 + 0
+0c6f : 91 5d __ STA (T0 + 0),y
+0c71 : e6 5f __ INC T1 + 0
+0c73 : a0 00 __ LDY #$00
+0c75 : b1 61 __ LDA (T2 + 0),y
+0c77 : 85 45 __ STA T4 + 0
+0c79 : e6 61 __ INC T2 + 0
+0c7b : d0 02 __ BNE $0c7f
+0c7d : e6 62 __ INC T2 + 1
+0c7f : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0c82 : a0 06 __ LDY #$06
+0c84 : b1 23 __ LDA (SP + 0),y
+0c86 : 85 47 __ STA T5 + 0
+0c88 : 18 __ __ CLC
+0c89 : 69 02 __ ADC #$02
+0c8b : aa __ __ TAX
+0c8c : c8 __ __ INY
+0c8d : b1 23 __ LDA (SP + 0),y
+0c8f : 85 48 __ STA T5 + 1
+0c91 : 69 00 __ ADC #$00
+0c93 : 85 4a __ STA T6 + 1
+0c95 : 8a __ __ TXA
+0c96 : 88 __ __ DEY
+0c97 : 91 23 __ STA (SP + 0),y
+0c99 : a5 4a __ LDA T6 + 1
+0c9b : c8 __ __ INY
+0c9c : 91 23 __ STA (SP + 0),y
+0c9e : a0 00 __ LDY #$00
+0ca0 : b1 47 __ LDA (T5 + 0),y
+0ca2 : a4 5f __ LDY T1 + 0
+0ca4 : 91 5d __ STA (T0 + 0),y
+0ca6 : e6 5f __ INC T1 + 0
+0ca8 : a0 00 __ LDY #$00
+0caa : b1 61 __ LDA (T2 + 0),y
+0cac : 85 45 __ STA T4 + 0
+0cae : e6 61 __ INC T2 + 0
+0cb0 : d0 02 __ BNE $0cb4
+0cb2 : e6 62 __ INC T2 + 1
+0cb4 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0cb7 : a0 06 __ LDY #$06
+0cb9 : b1 23 __ LDA (SP + 0),y
+0cbb : 85 47 __ STA T5 + 0
+0cbd : 18 __ __ CLC
+0cbe : 69 02 __ ADC #$02
+0cc0 : aa __ __ TAX
+0cc1 : c8 __ __ INY
+0cc2 : b1 23 __ LDA (SP + 0),y
+0cc4 : 85 48 __ STA T5 + 1
+0cc6 : 69 00 __ ADC #$00
+0cc8 : 85 4a __ STA T6 + 1
+0cca : 8a __ __ TXA
+0ccb : 88 __ __ DEY
+0ccc : 91 23 __ STA (SP + 0),y
+0cce : a5 4a __ LDA T6 + 1
+0cd0 : c8 __ __ INY
+0cd1 : 91 23 __ STA (SP + 0),y
+0cd3 : a0 00 __ LDY #$00
+0cd5 : b1 47 __ LDA (T5 + 0),y
+0cd7 : 85 02 __ STA $02
+0cd9 : c8 __ __ INY
+0cda : b1 47 __ LDA (T5 + 0),y
+0cdc : 85 48 __ STA T5 + 1
+0cde : a5 02 __ LDA $02
+0ce0 : 85 47 __ STA T5 + 0
+0ce2 : a0 08 __ LDY #$08
+0ce4 : b1 23 __ LDA (SP + 0),y
+0ce6 : d0 33 __ BNE $0d1b
+0ce8 : a0 00 __ LDY #$00
+0cea : b1 47 __ LDA (T5 + 0),y
+0cec : 85 43 __ STA T3 + 0
+0cee : d0 03 __ BNE $0cf3
+0cf0 : 4c 5b 0b JMP $0b5b ; (sformat + 210)
+0cf3 : 18 __ __ CLC
+0cf4 : a5 02 __ LDA $02
+0cf6 : 69 01 __ ADC #$01
+0cf8 : 85 47 __ STA T5 + 0
+0cfa : 90 02 __ BCC $0cfe
+0cfc : e6 48 __ INC T5 + 1
+0cfe : a5 43 __ LDA T3 + 0
+0d00 : a0 00 __ LDY #$00
+0d02 : 91 5d __ STA (T0 + 0),y
+0d04 : e6 5d __ INC T0 + 0
+0d06 : d0 02 __ BNE $0d0a
+0d08 : e6 5e __ INC T0 + 1
+0d0a : b1 47 __ LDA (T5 + 0),y
+0d0c : aa __ __ TAX
+0d0d : e6 47 __ INC T5 + 0
+0d0f : d0 02 __ BNE $0d13
+0d11 : e6 48 __ INC T5 + 1
+0d13 : 8a __ __ TXA
+0d14 : 86 43 __ STX T3 + 0
+0d16 : d0 e6 __ BNE $0cfe
+0d18 : 4c 5b 0b JMP $0b5b ; (sformat + 210)
+0d1b : a5 02 __ LDA $02
+0d1d : 85 0d __ STA P0
+0d1f : a5 48 __ LDA T5 + 1
+0d21 : 85 0e __ STA P1
+0d23 : 20 d2 13 JSR $13d2 ; (puts + 0)
+0d26 : a0 00 __ LDY #$00
+0d28 : b1 61 __ LDA (T2 + 0),y
+0d2a : 85 45 __ STA T4 + 0
+0d2c : e6 61 __ INC T2 + 0
+0d2e : d0 02 __ BNE $0d32
+0d30 : e6 62 __ INC T2 + 1
+0d32 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0d35 : a9 ba __ LDA #$ba
+0d37 : 85 0d __ STA P0
+0d39 : a9 53 __ LDA #$53
+0d3b : 85 0e __ STA P1
+0d3d : a5 5d __ LDA T0 + 0
+0d3f : 85 0f __ STA P2
+0d41 : a5 5e __ LDA T0 + 1
+0d43 : 85 10 __ STA P3
+0d45 : a0 06 __ LDY #$06
+0d47 : b1 23 __ LDA (SP + 0),y
+0d49 : 85 47 __ STA T5 + 0
+0d4b : c8 __ __ INY
+0d4c : b1 23 __ LDA (SP + 0),y
+0d4e : 85 48 __ STA T5 + 1
+0d50 : a0 00 __ LDY #$00
+0d52 : b1 47 __ LDA (T5 + 0),y
+0d54 : 85 11 __ STA P4
+0d56 : c8 __ __ INY
+0d57 : b1 47 __ LDA (T5 + 0),y
+0d59 : 85 12 __ STA P5
+0d5b : c8 __ __ INY
+0d5c : b1 47 __ LDA (T5 + 0),y
+0d5e : 85 13 __ STA P6
+0d60 : c8 __ __ INY
+0d61 : b1 47 __ LDA (T5 + 0),y
+0d63 : 85 14 __ STA P7
+0d65 : 20 0c 16 JSR $160c ; (nformf + 0)
+0d68 : a5 1b __ LDA ACCU + 0
+0d6a : 85 5f __ STA T1 + 0
+0d6c : a0 06 __ LDY #$06
+0d6e : b1 23 __ LDA (SP + 0),y
+0d70 : 85 47 __ STA T5 + 0
+0d72 : 18 __ __ CLC
+0d73 : 69 02 __ ADC #$02
+0d75 : aa __ __ TAX
+0d76 : c8 __ __ INY
+0d77 : b1 23 __ LDA (SP + 0),y
+0d79 : 85 48 __ STA T5 + 1
+0d7b : 69 00 __ ADC #$00
+0d7d : 85 4a __ STA T6 + 1
+0d7f : 8a __ __ TXA
+0d80 : 88 __ __ DEY
+0d81 : 91 23 __ STA (SP + 0),y
+0d83 : a5 4a __ LDA T6 + 1
+0d85 : c8 __ __ INY
+0d86 : 91 23 __ STA (SP + 0),y
+0d88 : 18 __ __ CLC
+0d89 : a5 47 __ LDA T5 + 0
+0d8b : 69 04 __ ADC #$04
+0d8d : 88 __ __ DEY
+0d8e : 91 23 __ STA (SP + 0),y
+0d90 : a5 48 __ LDA T5 + 1
+0d92 : 69 00 __ ADC #$00
+0d94 : c8 __ __ INY
+0d95 : 91 23 __ STA (SP + 0),y
+0d97 : a0 00 __ LDY #$00
+0d99 : b1 61 __ LDA (T2 + 0),y
+0d9b : 85 45 __ STA T4 + 0
+0d9d : e6 61 __ INC T2 + 0
+0d9f : d0 02 __ BNE $0da3
+0da1 : e6 62 __ INC T2 + 1
+0da3 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0da6 : a0 06 __ LDY #$06
+0da8 : b1 23 __ LDA (SP + 0),y
+0daa : 85 47 __ STA T5 + 0
+0dac : 18 __ __ CLC
+0dad : 69 02 __ ADC #$02
+0daf : aa __ __ TAX
+0db0 : c8 __ __ INY
+0db1 : b1 23 __ LDA (SP + 0),y
+0db3 : 85 48 __ STA T5 + 1
+0db5 : a0 00 __ LDY #$00
+0db7 : b1 47 __ LDA (T5 + 0),y
+0db9 : 85 63 __ STA T10 + 0
+0dbb : c8 __ __ INY
+0dbc : b1 47 __ LDA (T5 + 0),y
+0dbe : 85 64 __ STA T10 + 1
+0dc0 : c8 __ __ INY
+0dc1 : b1 47 __ LDA (T5 + 0),y
+0dc3 : 85 65 __ STA T10 + 2
+0dc5 : c8 __ __ INY
+0dc6 : b1 47 __ LDA (T5 + 0),y
+0dc8 : 85 66 __ STA T10 + 3
+0dca : a5 48 __ LDA T5 + 1
+0dcc : 69 00 __ ADC #$00
+0dce : 85 4a __ STA T6 + 1
+0dd0 : 8a __ __ TXA
+0dd1 : a0 06 __ LDY #$06
+0dd3 : 91 23 __ STA (SP + 0),y
+0dd5 : a5 4a __ LDA T6 + 1
+0dd7 : c8 __ __ INY
+0dd8 : 91 23 __ STA (SP + 0),y
+0dda : 18 __ __ CLC
+0ddb : a5 47 __ LDA T5 + 0
+0ddd : 69 04 __ ADC #$04
+0ddf : 88 __ __ DEY
+0de0 : 91 23 __ STA (SP + 0),y
+0de2 : a5 48 __ LDA T5 + 1
+0de4 : 69 00 __ ADC #$00
+0de6 : c8 __ __ INY
+0de7 : 91 23 __ STA (SP + 0),y
+0de9 : a0 00 __ LDY #$00
+0deb : b1 61 __ LDA (T2 + 0),y
+0ded : aa __ __ TAX
+0dee : e6 61 __ INC T2 + 0
+0df0 : d0 02 __ BNE $0df4
+0df2 : e6 62 __ INC T2 + 1
+0df4 : 8a __ __ TXA
+0df5 : e0 64 __ CPX #$64
+0df7 : d0 03 __ BNE $0dfc
+0df9 : 4c 7d 0e JMP $0e7d ; (sformat + 1012)
+0dfc : c9 75 __ CMP #$75
+0dfe : f0 47 __ BEQ $0e47
+0e00 : c9 78 __ CMP #$78
+0e02 : f0 03 __ BEQ $0e07
+0e04 : 4c 5b 0b JMP $0b5b ; (sformat + 210)
+0e07 : a9 10 __ LDA #$10
+0e09 : 8d bd 53 STA $53bd ; (sframe + 3)
+0e0c : a9 00 __ LDA #$00
+0e0e : 8d be 53 STA $53be ; (sframe + 4)
+0e11 : a9 ba __ LDA #$ba
+0e13 : 85 0d __ STA P0
+0e15 : a9 53 __ LDA #$53
+0e17 : 85 0e __ STA P1
+0e19 : a5 5d __ LDA T0 + 0
+0e1b : 85 0f __ STA P2
+0e1d : a5 5e __ LDA T0 + 1
+0e1f : 85 10 __ STA P3
+0e21 : a5 63 __ LDA T10 + 0
+0e23 : 85 11 __ STA P4
+0e25 : a5 64 __ LDA T10 + 1
+0e27 : 85 12 __ STA P5
+0e29 : a5 65 __ LDA T10 + 2
+0e2b : 85 13 __ STA P6
+0e2d : a5 66 __ LDA T10 + 3
+0e2f : 85 14 __ STA P7
+0e31 : 20 10 14 JSR $1410 ; (nforml + 0)
+0e34 : a5 1b __ LDA ACCU + 0
+0e36 : 85 5f __ STA T1 + 0
+0e38 : a0 00 __ LDY #$00
+0e3a : b1 61 __ LDA (T2 + 0),y
+0e3c : 85 45 __ STA T4 + 0
+0e3e : e6 61 __ INC T2 + 0
+0e40 : d0 02 __ BNE $0e44
+0e42 : e6 62 __ INC T2 + 1
+0e44 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0e47 : a9 ba __ LDA #$ba
+0e49 : 85 0d __ STA P0
+0e4b : a9 53 __ LDA #$53
+0e4d : 85 0e __ STA P1
+0e4f : a5 5d __ LDA T0 + 0
+0e51 : 85 0f __ STA P2
+0e53 : a5 5e __ LDA T0 + 1
+0e55 : 85 10 __ STA P3
+0e57 : a5 63 __ LDA T10 + 0
+0e59 : 85 11 __ STA P4
+0e5b : a5 64 __ LDA T10 + 1
+0e5d : 85 12 __ STA P5
+0e5f : a5 65 __ LDA T10 + 2
+0e61 : 85 13 __ STA P6
+0e63 : a5 66 __ LDA T10 + 3
+0e65 : 85 14 __ STA P7
+0e67 : 20 10 14 JSR $1410 ; (nforml + 0)
+0e6a : a5 1b __ LDA ACCU + 0
+0e6c : 85 5f __ STA T1 + 0
+0e6e : a0 00 __ LDY #$00
+0e70 : b1 61 __ LDA (T2 + 0),y
+0e72 : 85 45 __ STA T4 + 0
+0e74 : e6 61 __ INC T2 + 0
+0e76 : d0 02 __ BNE $0e7a
+0e78 : e6 62 __ INC T2 + 1
+0e7a : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0e7d : a9 ba __ LDA #$ba
+0e7f : 85 0d __ STA P0
+0e81 : a9 53 __ LDA #$53
+0e83 : 85 0e __ STA P1
+0e85 : a5 5d __ LDA T0 + 0
+0e87 : 85 0f __ STA P2
+0e89 : a5 5e __ LDA T0 + 1
+0e8b : 85 10 __ STA P3
+0e8d : a5 63 __ LDA T10 + 0
+0e8f : 85 11 __ STA P4
+0e91 : a5 64 __ LDA T10 + 1
+0e93 : 85 12 __ STA P5
+0e95 : a5 65 __ LDA T10 + 2
+0e97 : 85 13 __ STA P6
+0e99 : a5 66 __ LDA T10 + 3
+0e9b : 85 14 __ STA P7
+0e9d : 20 10 14 JSR $1410 ; (nforml + 0)
+0ea0 : a5 1b __ LDA ACCU + 0
+0ea2 : 85 5f __ STA T1 + 0
+0ea4 : a0 00 __ LDY #$00
+0ea6 : b1 61 __ LDA (T2 + 0),y
+0ea8 : 85 45 __ STA T4 + 0
+0eaa : e6 61 __ INC T2 + 0
+0eac : d0 02 __ BNE $0eb0
+0eae : e6 62 __ INC T2 + 1
+0eb0 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0eb3 : a9 10 __ LDA #$10
+0eb5 : 8d bd 53 STA $53bd ; (sframe + 3)
+0eb8 : a9 00 __ LDA #$00
+0eba : 8d be 53 STA $53be ; (sframe + 4)
+0ebd : a0 06 __ LDY #$06
+0ebf : b1 23 __ LDA (SP + 0),y
+0ec1 : 85 47 __ STA T5 + 0
+0ec3 : 18 __ __ CLC
+0ec4 : 69 02 __ ADC #$02
+0ec6 : aa __ __ TAX
+0ec7 : c8 __ __ INY
+0ec8 : b1 23 __ LDA (SP + 0),y
+0eca : 85 48 __ STA T5 + 1
+0ecc : 69 00 __ ADC #$00
+0ece : 85 4a __ STA T6 + 1
+0ed0 : 8a __ __ TXA
+0ed1 : 88 __ __ DEY
+0ed2 : 91 23 __ STA (SP + 0),y
+0ed4 : a5 4a __ LDA T6 + 1
+0ed6 : c8 __ __ INY
+0ed7 : 91 23 __ STA (SP + 0),y
+0ed9 : a5 5d __ LDA T0 + 0
+0edb : 85 49 __ STA T6 + 0
+0edd : a5 5e __ LDA T0 + 1
+0edf : 85 4a __ STA T6 + 1
+0ee1 : a9 0a __ LDA #$0a
+0ee3 : 85 5f __ STA T1 + 0
+0ee5 : a0 00 __ LDY #$00
+0ee7 : b1 47 __ LDA (T5 + 0),y
+0ee9 : aa __ __ TAX
+0eea : c8 __ __ INY
+0eeb : b1 47 __ LDA (T5 + 0),y
+0eed : 86 47 __ STX T5 + 0
+0eef : 85 48 __ STA T5 + 1
+0ef1 : 8a __ __ TXA
+0ef2 : 05 48 __ ORA T5 + 1
+0ef4 : f0 03 __ BEQ $0ef9
+0ef6 : 4c c3 0f JMP $0fc3 ; (sformat + 1338)
+0ef9 : ad bc 53 LDA $53bc ; (sframe + 2)
+0efc : c9 ff __ CMP #$ff
+0efe : d0 03 __ BNE $0f03
+0f00 : 4c b5 0f JMP $0fb5 ; (sformat + 1324)
+0f03 : 38 __ __ SEC
+0f04 : a9 0a __ LDA #$0a
+0f06 : ed bc 53 SBC $53bc ; (sframe + 2)
+0f09 : 85 43 __ STA T3 + 0
+0f0b : c5 5f __ CMP T1 + 0
+0f0d : b0 0e __ BCS $0f1d
+0f0f : c6 5f __ DEC T1 + 0
+0f11 : a9 30 __ LDA #$30
+0f13 : a4 5f __ LDY T1 + 0
+0f15 : 91 49 __ STA (T6 + 0),y
+0f17 : a5 43 __ LDA T3 + 0
+0f19 : c5 5f __ CMP T1 + 0
+0f1b : 90 f2 __ BCC $0f0f
+0f1d : ad c1 53 LDA $53c1 ; (sframe + 7)
+0f20 : f0 33 __ BEQ $0f55
+0f22 : ad bd 53 LDA $53bd ; (sframe + 3)
+0f25 : 85 47 __ STA T5 + 0
+0f27 : ad be 53 LDA $53be ; (sframe + 4)
+0f2a : d0 29 __ BNE $0f55
+0f2c : a5 47 __ LDA T5 + 0
+0f2e : c9 10 __ CMP #$10
+0f30 : d0 23 __ BNE $0f55
+0f32 : 18 __ __ CLC
+0f33 : a5 5f __ LDA T1 + 0
+0f35 : 69 ff __ ADC #$ff
+0f37 : 18 __ __ CLC
+0f38 : 65 49 __ ADC T6 + 0
+0f3a : 85 47 __ STA T5 + 0
+0f3c : a5 4a __ LDA T6 + 1
+0f3e : 69 00 __ ADC #$00
+0f40 : 85 48 __ STA T5 + 1
+0f42 : a9 58 __ LDA #$58
+0f44 : a0 00 __ LDY #$00
+0f46 : 91 47 __ STA (T5 + 0),y
+0f48 : 18 __ __ CLC
+0f49 : a5 5f __ LDA T1 + 0
+0f4b : 69 fe __ ADC #$fe
+0f4d : 85 5f __ STA T1 + 0
+0f4f : a9 30 __ LDA #$30
+0f51 : a4 5f __ LDY T1 + 0
+0f53 : 91 49 __ STA (T6 + 0),y
+0f55 : ad bf 53 LDA $53bf ; (sframe + 5)
+0f58 : f0 08 __ BEQ $0f62
+0f5a : c6 5f __ DEC T1 + 0
+0f5c : a9 2b __ LDA #$2b
+0f5e : a4 5f __ LDY T1 + 0
+0f60 : 91 49 __ STA (T6 + 0),y
+0f62 : 38 __ __ SEC
+0f63 : a9 0a __ LDA #$0a
+0f65 : ed bb 53 SBC $53bb ; (sframe + 1)
+0f68 : 85 47 __ STA T5 + 0
+0f6a : a9 00 __ LDA #$00
+0f6c : e9 00 __ SBC #$00
+0f6e : 49 80 __ EOR #$80
+0f70 : c9 80 __ CMP #$80
+0f72 : d0 04 __ BNE $0f78
+0f74 : a5 47 __ LDA T5 + 0
+0f76 : c5 5f __ CMP T1 + 0
+0f78 : 90 2f __ BCC $0fa9
+0f7a : a9 00 __ LDA #$00
+0f7c : 85 43 __ STA T3 + 0
+0f7e : a5 5f __ LDA T1 + 0
+0f80 : c9 0a __ CMP #$0a
+0f82 : b0 12 __ BCS $0f96
+0f84 : a4 5f __ LDY T1 + 0
+0f86 : b1 49 __ LDA (T6 + 0),y
+0f88 : a4 43 __ LDY T3 + 0
+0f8a : 91 49 __ STA (T6 + 0),y
+0f8c : e6 43 __ INC T3 + 0
+0f8e : e6 5f __ INC T1 + 0
+0f90 : a5 5f __ LDA T1 + 0
+0f92 : c9 0a __ CMP #$0a
+0f94 : 90 ee __ BCC $0f84
+0f96 : a0 00 __ LDY #$00
+0f98 : b1 61 __ LDA (T2 + 0),y
+0f9a : 85 45 __ STA T4 + 0
+0f9c : e6 61 __ INC T2 + 0
+0f9e : d0 02 __ BNE $0fa2
+0fa0 : e6 62 __ INC T2 + 1
+0fa2 : a5 43 __ LDA T3 + 0
+0fa4 : 85 5f __ STA T1 + 0
+0fa6 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+0fa9 : c6 5f __ DEC T1 + 0
+0fab : ad ba 53 LDA $53ba ; (sframe + 0)
+0fae : a4 5f __ LDY T1 + 0
+0fb0 : 91 49 __ STA (T6 + 0),y
+0fb2 : 4c 62 0f JMP $0f62 ; (sformat + 1241)
+0fb5 : a9 09 __ LDA #$09
+0fb7 : 85 43 __ STA T3 + 0
+0fb9 : c5 5f __ CMP T1 + 0
+0fbb : b0 03 __ BCS $0fc0
+0fbd : 4c 0f 0f JMP $0f0f ; (sformat + 1158)
+0fc0 : 4c 1d 0f JMP $0f1d ; (sformat + 1172)
+0fc3 : a5 47 __ LDA T5 + 0
+0fc5 : 85 1b __ STA ACCU + 0
+0fc7 : a5 48 __ LDA T5 + 1
+0fc9 : 85 1c __ STA ACCU + 1
+0fcb : ad bd 53 LDA $53bd ; (sframe + 3)
+0fce : 85 03 __ STA $03
+0fd0 : ad be 53 LDA $53be ; (sframe + 4)
+0fd3 : 85 04 __ STA $04
+0fd5 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+0fd8 : a5 06 __ LDA $06
+0fda : 10 2f __ BPL $100b
+0fdc : 18 __ __ CLC
+0fdd : a5 05 __ LDA $05
+0fdf : 69 30 __ ADC #$30
+0fe1 : c6 5f __ DEC T1 + 0
+0fe3 : a4 5f __ LDY T1 + 0
+0fe5 : 91 49 __ STA (T6 + 0),y
+0fe7 : a5 47 __ LDA T5 + 0
+0fe9 : 85 1b __ STA ACCU + 0
+0feb : a5 48 __ LDA T5 + 1
+0fed : 85 1c __ STA ACCU + 1
+0fef : ad bd 53 LDA $53bd ; (sframe + 3)
+0ff2 : 85 03 __ STA $03
+0ff4 : ad be 53 LDA $53be ; (sframe + 4)
+0ff7 : 85 04 __ STA $04
+0ff9 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+0ffc : a5 1b __ LDA ACCU + 0
+0ffe : 85 47 __ STA T5 + 0
+1000 : a5 1c __ LDA ACCU + 1
+1002 : 85 48 __ STA T5 + 1
+1004 : 05 1b __ ORA ACCU + 0
+1006 : d0 bb __ BNE $0fc3
+1008 : 4c f9 0e JMP $0ef9 ; (sformat + 1136)
+100b : d0 06 __ BNE $1013
+100d : a5 05 __ LDA $05
+100f : c9 0a __ CMP #$0a
+1011 : 90 c9 __ BCC $0fdc
+1013 : 18 __ __ CLC
+1014 : a5 05 __ LDA $05
+1016 : 69 37 __ ADC #$37
+1018 : 4c e1 0f JMP $0fe1 ; (sformat + 1368)
+101b : a0 06 __ LDY #$06
+101d : b1 23 __ LDA (SP + 0),y
+101f : 85 47 __ STA T5 + 0
+1021 : 18 __ __ CLC
+1022 : 69 02 __ ADC #$02
+1024 : aa __ __ TAX
+1025 : c8 __ __ INY
+1026 : b1 23 __ LDA (SP + 0),y
+1028 : 85 48 __ STA T5 + 1
+102a : 69 00 __ ADC #$00
+102c : 85 4a __ STA T6 + 1
+102e : 8a __ __ TXA
+102f : 88 __ __ DEY
+1030 : 91 23 __ STA (SP + 0),y
+1032 : a5 4a __ LDA T6 + 1
+1034 : c8 __ __ INY
+1035 : 91 23 __ STA (SP + 0),y
+1037 : a5 5d __ LDA T0 + 0
+1039 : 85 49 __ STA T6 + 0
+103b : a5 5e __ LDA T0 + 1
+103d : 85 4a __ STA T6 + 1
+103f : a9 0a __ LDA #$0a
+1041 : 85 5f __ STA T1 + 0
+1043 : a0 00 __ LDY #$00
+1045 : b1 47 __ LDA (T5 + 0),y
+1047 : aa __ __ TAX
+1048 : c8 __ __ INY
+1049 : b1 47 __ LDA (T5 + 0),y
+104b : 86 47 __ STX T5 + 0
+104d : 85 48 __ STA T5 + 1
+104f : 8a __ __ TXA
+1050 : 05 48 __ ORA T5 + 1
+1052 : f0 03 __ BEQ $1057
+1054 : 4c 14 11 JMP $1114 ; (sformat + 1675)
+1057 : ad bc 53 LDA $53bc ; (sframe + 2)
+105a : c9 ff __ CMP #$ff
+105c : d0 03 __ BNE $1061
+105e : 4c 06 11 JMP $1106 ; (sformat + 1661)
+1061 : 38 __ __ SEC
+1062 : a9 0a __ LDA #$0a
+1064 : ed bc 53 SBC $53bc ; (sframe + 2)
+1067 : 85 43 __ STA T3 + 0
+1069 : c5 5f __ CMP T1 + 0
+106b : b0 0e __ BCS $107b
+106d : c6 5f __ DEC T1 + 0
+106f : a9 30 __ LDA #$30
+1071 : a4 5f __ LDY T1 + 0
+1073 : 91 49 __ STA (T6 + 0),y
+1075 : a5 43 __ LDA T3 + 0
+1077 : c5 5f __ CMP T1 + 0
+1079 : 90 f2 __ BCC $106d
+107b : ad c1 53 LDA $53c1 ; (sframe + 7)
+107e : f0 33 __ BEQ $10b3
+1080 : ad bd 53 LDA $53bd ; (sframe + 3)
+1083 : 85 47 __ STA T5 + 0
+1085 : ad be 53 LDA $53be ; (sframe + 4)
+1088 : d0 29 __ BNE $10b3
+108a : a5 47 __ LDA T5 + 0
+108c : c9 10 __ CMP #$10
+108e : d0 23 __ BNE $10b3
+1090 : 18 __ __ CLC
+1091 : a5 5f __ LDA T1 + 0
+1093 : 69 ff __ ADC #$ff
+1095 : 18 __ __ CLC
+1096 : 65 49 __ ADC T6 + 0
+1098 : 85 47 __ STA T5 + 0
+109a : a5 4a __ LDA T6 + 1
+109c : 69 00 __ ADC #$00
+109e : 85 48 __ STA T5 + 1
+10a0 : a9 58 __ LDA #$58
+10a2 : a0 00 __ LDY #$00
+10a4 : 91 47 __ STA (T5 + 0),y
+10a6 : 18 __ __ CLC
+10a7 : a5 5f __ LDA T1 + 0
+10a9 : 69 fe __ ADC #$fe
+10ab : 85 5f __ STA T1 + 0
+10ad : a9 30 __ LDA #$30
+10af : a4 5f __ LDY T1 + 0
+10b1 : 91 49 __ STA (T6 + 0),y
+10b3 : ad bf 53 LDA $53bf ; (sframe + 5)
+10b6 : f0 08 __ BEQ $10c0
+10b8 : c6 5f __ DEC T1 + 0
+10ba : a9 2b __ LDA #$2b
+10bc : a4 5f __ LDY T1 + 0
+10be : 91 49 __ STA (T6 + 0),y
+10c0 : 38 __ __ SEC
+10c1 : a9 0a __ LDA #$0a
+10c3 : ed bb 53 SBC $53bb ; (sframe + 1)
+10c6 : 85 47 __ STA T5 + 0
+10c8 : a9 00 __ LDA #$00
+10ca : e9 00 __ SBC #$00
+10cc : 49 80 __ EOR #$80
+10ce : c9 80 __ CMP #$80
+10d0 : d0 04 __ BNE $10d6
+10d2 : a5 47 __ LDA T5 + 0
+10d4 : c5 5f __ CMP T1 + 0
+10d6 : 90 22 __ BCC $10fa
+10d8 : a9 00 __ LDA #$00
+10da : 85 43 __ STA T3 + 0
+10dc : a5 5f __ LDA T1 + 0
+10de : c9 0a __ CMP #$0a
+10e0 : 90 03 __ BCC $10e5
+10e2 : 4c 96 0f JMP $0f96 ; (sformat + 1293)
+10e5 : a4 5f __ LDY T1 + 0
+10e7 : b1 49 __ LDA (T6 + 0),y
+10e9 : a4 43 __ LDY T3 + 0
+10eb : 91 49 __ STA (T6 + 0),y
+10ed : e6 43 __ INC T3 + 0
+10ef : e6 5f __ INC T1 + 0
+10f1 : a5 5f __ LDA T1 + 0
+10f3 : c9 0a __ CMP #$0a
+10f5 : 90 ee __ BCC $10e5
+10f7 : 4c 96 0f JMP $0f96 ; (sformat + 1293)
+10fa : c6 5f __ DEC T1 + 0
+10fc : ad ba 53 LDA $53ba ; (sframe + 0)
+10ff : a4 5f __ LDY T1 + 0
+1101 : 91 49 __ STA (T6 + 0),y
+1103 : 4c c0 10 JMP $10c0 ; (sformat + 1591)
+1106 : a9 09 __ LDA #$09
+1108 : 85 43 __ STA T3 + 0
+110a : c5 5f __ CMP T1 + 0
+110c : b0 03 __ BCS $1111
+110e : 4c 6d 10 JMP $106d ; (sformat + 1508)
+1111 : 4c 7b 10 JMP $107b ; (sformat + 1522)
+1114 : a5 47 __ LDA T5 + 0
+1116 : 85 1b __ STA ACCU + 0
+1118 : a5 48 __ LDA T5 + 1
+111a : 85 1c __ STA ACCU + 1
+111c : ad bd 53 LDA $53bd ; (sframe + 3)
+111f : 85 03 __ STA $03
+1121 : ad be 53 LDA $53be ; (sframe + 4)
+1124 : 85 04 __ STA $04
+1126 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+1129 : a5 06 __ LDA $06
+112b : 10 2f __ BPL $115c
+112d : 18 __ __ CLC
+112e : a5 05 __ LDA $05
+1130 : 69 30 __ ADC #$30
+1132 : c6 5f __ DEC T1 + 0
+1134 : a4 5f __ LDY T1 + 0
+1136 : 91 49 __ STA (T6 + 0),y
+1138 : a5 47 __ LDA T5 + 0
+113a : 85 1b __ STA ACCU + 0
+113c : a5 48 __ LDA T5 + 1
+113e : 85 1c __ STA ACCU + 1
+1140 : ad bd 53 LDA $53bd ; (sframe + 3)
+1143 : 85 03 __ STA $03
+1145 : ad be 53 LDA $53be ; (sframe + 4)
+1148 : 85 04 __ STA $04
+114a : 20 f3 22 JSR $22f3 ; (divmod + 0)
+114d : a5 1b __ LDA ACCU + 0
+114f : 85 47 __ STA T5 + 0
+1151 : a5 1c __ LDA ACCU + 1
+1153 : 85 48 __ STA T5 + 1
+1155 : 05 1b __ ORA ACCU + 0
+1157 : d0 bb __ BNE $1114
+1159 : 4c 57 10 JMP $1057 ; (sformat + 1486)
+115c : d0 06 __ BNE $1164
+115e : a5 05 __ LDA $05
+1160 : c9 0a __ CMP #$0a
+1162 : 90 c9 __ BCC $112d
+1164 : 18 __ __ CLC
+1165 : a5 05 __ LDA $05
+1167 : 69 37 __ ADC #$37
+1169 : 4c 32 11 JMP $1132 ; (sformat + 1705)
+116c : a0 06 __ LDY #$06
+116e : b1 23 __ LDA (SP + 0),y
+1170 : 85 47 __ STA T5 + 0
+1172 : 18 __ __ CLC
+1173 : 69 02 __ ADC #$02
+1175 : aa __ __ TAX
+1176 : c8 __ __ INY
+1177 : b1 23 __ LDA (SP + 0),y
+1179 : 85 48 __ STA T5 + 1
+117b : 69 00 __ ADC #$00
+117d : 85 4a __ STA T6 + 1
+117f : 8a __ __ TXA
+1180 : 88 __ __ DEY
+1181 : 91 23 __ STA (SP + 0),y
+1183 : a5 4a __ LDA T6 + 1
+1185 : c8 __ __ INY
+1186 : 91 23 __ STA (SP + 0),y
+1188 : a5 5d __ LDA T0 + 0
+118a : 85 49 __ STA T6 + 0
+118c : a5 5e __ LDA T0 + 1
+118e : 85 4a __ STA T6 + 1
+1190 : a0 00 __ LDY #$00
+1192 : b1 47 __ LDA (T5 + 0),y
+1194 : 85 02 __ STA $02
+1196 : c8 __ __ INY
+1197 : b1 47 __ LDA (T5 + 0),y
+1199 : 85 48 __ STA T5 + 1
+119b : 10 03 __ BPL $11a0
+119d : 4c e6 12 JMP $12e6 ; (sformat + 2141)
+11a0 : a5 02 __ LDA $02
+11a2 : 85 4b __ STA T7 + 0
+11a4 : a5 48 __ LDA T5 + 1
+11a6 : 85 4c __ STA T7 + 1
+11a8 : a9 00 __ LDA #$00
+11aa : 85 5f __ STA T1 + 0
+11ac : a9 0a __ LDA #$0a
+11ae : 85 43 __ STA T3 + 0
+11b0 : a5 02 __ LDA $02
+11b2 : 05 48 __ ORA T5 + 1
+11b4 : f0 03 __ BEQ $11b9
+11b6 : 4c 8e 12 JMP $128e ; (sformat + 2053)
+11b9 : ad bc 53 LDA $53bc ; (sframe + 2)
+11bc : c9 ff __ CMP #$ff
+11be : d0 03 __ BNE $11c3
+11c0 : 4c 80 12 JMP $1280 ; (sformat + 2039)
+11c3 : 38 __ __ SEC
+11c4 : a9 0a __ LDA #$0a
+11c6 : ed bc 53 SBC $53bc ; (sframe + 2)
+11c9 : 85 45 __ STA T4 + 0
+11cb : c5 43 __ CMP T3 + 0
+11cd : b0 0e __ BCS $11dd
+11cf : c6 43 __ DEC T3 + 0
+11d1 : a9 30 __ LDA #$30
+11d3 : a4 43 __ LDY T3 + 0
+11d5 : 91 49 __ STA (T6 + 0),y
+11d7 : a5 45 __ LDA T4 + 0
+11d9 : c5 43 __ CMP T3 + 0
+11db : 90 f2 __ BCC $11cf
+11dd : ad c1 53 LDA $53c1 ; (sframe + 7)
+11e0 : f0 33 __ BEQ $1215
+11e2 : ad bd 53 LDA $53bd ; (sframe + 3)
+11e5 : 85 47 __ STA T5 + 0
+11e7 : ad be 53 LDA $53be ; (sframe + 4)
+11ea : d0 29 __ BNE $1215
+11ec : a5 47 __ LDA T5 + 0
+11ee : c9 10 __ CMP #$10
+11f0 : d0 23 __ BNE $1215
+11f2 : 18 __ __ CLC
+11f3 : a5 43 __ LDA T3 + 0
+11f5 : 69 ff __ ADC #$ff
+11f7 : 18 __ __ CLC
+11f8 : 65 49 __ ADC T6 + 0
+11fa : 85 47 __ STA T5 + 0
+11fc : a5 4a __ LDA T6 + 1
+11fe : 69 00 __ ADC #$00
+1200 : 85 48 __ STA T5 + 1
+1202 : a9 58 __ LDA #$58
+1204 : a0 00 __ LDY #$00
+1206 : 91 47 __ STA (T5 + 0),y
+1208 : 18 __ __ CLC
+1209 : a5 43 __ LDA T3 + 0
+120b : 69 fe __ ADC #$fe
+120d : 85 43 __ STA T3 + 0
+120f : a9 30 __ LDA #$30
+1211 : a4 43 __ LDY T3 + 0
+1213 : 91 49 __ STA (T6 + 0),y
+1215 : a5 5f __ LDA T1 + 0
+1217 : d0 5c __ BNE $1275
+1219 : ad bf 53 LDA $53bf ; (sframe + 5)
+121c : f0 08 __ BEQ $1226
+121e : c6 43 __ DEC T3 + 0
+1220 : a9 2b __ LDA #$2b
+1222 : a4 43 __ LDY T3 + 0
+1224 : 91 49 __ STA (T6 + 0),y
+1226 : 38 __ __ SEC
+1227 : a9 0a __ LDA #$0a
+1229 : ed bb 53 SBC $53bb ; (sframe + 1)
+122c : 85 47 __ STA T5 + 0
+122e : a9 00 __ LDA #$00
+1230 : e9 00 __ SBC #$00
+1232 : 49 80 __ EOR #$80
+1234 : c9 80 __ CMP #$80
+1236 : d0 04 __ BNE $123c
+1238 : a5 47 __ LDA T5 + 0
+123a : c5 43 __ CMP T3 + 0
+123c : 90 2b __ BCC $1269
+123e : a9 00 __ LDA #$00
+1240 : 85 5f __ STA T1 + 0
+1242 : a5 43 __ LDA T3 + 0
+1244 : c9 0a __ CMP #$0a
+1246 : b0 12 __ BCS $125a
+1248 : a4 43 __ LDY T3 + 0
+124a : b1 49 __ LDA (T6 + 0),y
+124c : a4 5f __ LDY T1 + 0
+124e : 91 49 __ STA (T6 + 0),y
+1250 : e6 5f __ INC T1 + 0
+1252 : e6 43 __ INC T3 + 0
+1254 : a5 43 __ LDA T3 + 0
+1256 : c9 0a __ CMP #$0a
+1258 : 90 ee __ BCC $1248
+125a : a0 00 __ LDY #$00
+125c : b1 61 __ LDA (T2 + 0),y
+125e : 85 45 __ STA T4 + 0
+1260 : e6 61 __ INC T2 + 0
+1262 : d0 02 __ BNE $1266
+1264 : e6 62 __ INC T2 + 1
+1266 : 4c 25 0b JMP $0b25 ; (sformat + 156)
+1269 : c6 43 __ DEC T3 + 0
+126b : ad ba 53 LDA $53ba ; (sframe + 0)
+126e : a4 43 __ LDY T3 + 0
+1270 : 91 49 __ STA (T6 + 0),y
+1272 : 4c 26 12 JMP $1226 ; (sformat + 1949)
+1275 : c6 43 __ DEC T3 + 0
+1277 : a9 2d __ LDA #$2d
+1279 : a4 43 __ LDY T3 + 0
+127b : 91 49 __ STA (T6 + 0),y
+127d : 4c 26 12 JMP $1226 ; (sformat + 1949)
+1280 : a9 09 __ LDA #$09
+1282 : 85 45 __ STA T4 + 0
+1284 : c5 43 __ CMP T3 + 0
+1286 : b0 03 __ BCS $128b
+1288 : 4c cf 11 JMP $11cf ; (sformat + 1862)
+128b : 4c dd 11 JMP $11dd ; (sformat + 1876)
+128e : a5 4b __ LDA T7 + 0
+1290 : 85 1b __ STA ACCU + 0
+1292 : a5 4c __ LDA T7 + 1
+1294 : 85 1c __ STA ACCU + 1
+1296 : ad bd 53 LDA $53bd ; (sframe + 3)
+1299 : 85 03 __ STA $03
+129b : ad be 53 LDA $53be ; (sframe + 4)
+129e : 85 04 __ STA $04
+12a0 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+12a3 : a5 06 __ LDA $06
+12a5 : 10 2f __ BPL $12d6
+12a7 : 18 __ __ CLC
+12a8 : a5 05 __ LDA $05
+12aa : 69 30 __ ADC #$30
+12ac : c6 43 __ DEC T3 + 0
+12ae : a4 43 __ LDY T3 + 0
+12b0 : 91 49 __ STA (T6 + 0),y
+12b2 : a5 4b __ LDA T7 + 0
+12b4 : 85 1b __ STA ACCU + 0
+12b6 : a5 4c __ LDA T7 + 1
+12b8 : 85 1c __ STA ACCU + 1
+12ba : ad bd 53 LDA $53bd ; (sframe + 3)
+12bd : 85 03 __ STA $03
+12bf : ad be 53 LDA $53be ; (sframe + 4)
+12c2 : 85 04 __ STA $04
+12c4 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+12c7 : a5 1b __ LDA ACCU + 0
+12c9 : 85 4b __ STA T7 + 0
+12cb : a5 1c __ LDA ACCU + 1
+12cd : 85 4c __ STA T7 + 1
+12cf : 05 1b __ ORA ACCU + 0
+12d1 : d0 bb __ BNE $128e
+12d3 : 4c b9 11 JMP $11b9 ; (sformat + 1840)
+12d6 : d0 06 __ BNE $12de
+12d8 : a5 05 __ LDA $05
+12da : c9 0a __ CMP #$0a
+12dc : 90 c9 __ BCC $12a7
+12de : 18 __ __ CLC
+12df : a5 05 __ LDA $05
+12e1 : 69 37 __ ADC #$37
+12e3 : 4c ac 12 JMP $12ac ; (sformat + 2083)
+12e6 : a9 01 __ LDA #$01
+12e8 : 85 5f __ STA T1 + 0
+12ea : a9 0a __ LDA #$0a
+12ec : 85 43 __ STA T3 + 0
+12ee : 38 __ __ SEC
+12ef : a9 00 __ LDA #$00
+12f1 : e5 02 __ SBC $02
+12f3 : 85 4b __ STA T7 + 0
+12f5 : a9 00 __ LDA #$00
+12f7 : e5 48 __ SBC T5 + 1
+12f9 : 85 4c __ STA T7 + 1
+12fb : 05 4b __ ORA T7 + 0
+12fd : d0 8f __ BNE $128e
+12ff : 4c b9 11 JMP $11b9 ; (sformat + 1840)
+1302 : a9 00 __ LDA #$00
+1304 : 85 47 __ STA T5 + 0
+1306 : 85 48 __ STA T5 + 1
+1308 : a0 00 __ LDY #$00
+130a : b1 61 __ LDA (T2 + 0),y
+130c : 85 43 __ STA T3 + 0
+130e : e6 61 __ INC T2 + 0
+1310 : d0 02 __ BNE $1314
+1312 : e6 62 __ INC T2 + 1
+1314 : a5 43 __ LDA T3 + 0
+1316 : c9 30 __ CMP #$30
+1318 : 90 4d __ BCC $1367
+131a : a9 39 __ LDA #$39
+131c : c5 43 __ CMP T3 + 0
+131e : 90 47 __ BCC $1367
+1320 : a5 43 __ LDA T3 + 0
+1322 : 85 49 __ STA T6 + 0
+1324 : a0 00 __ LDY #$00
+1326 : b1 61 __ LDA (T2 + 0),y
+1328 : 85 43 __ STA T3 + 0
+132a : e6 61 __ INC T2 + 0
+132c : d0 02 __ BNE $1330
+132e : e6 62 __ INC T2 + 1
+1330 : a5 47 __ LDA T5 + 0
+1332 : 0a __ __ ASL
+1333 : 85 07 __ STA $07
+1335 : a5 48 __ LDA T5 + 1
+1337 : 2a __ __ ROL
+1338 : 06 07 __ ASL $07
+133a : 2a __ __ ROL
+133b : aa __ __ TAX
+133c : 18 __ __ CLC
+133d : a5 07 __ LDA $07
+133f : 65 47 __ ADC T5 + 0
+1341 : 85 1b __ STA ACCU + 0
+1343 : 8a __ __ TXA
+1344 : 65 48 __ ADC T5 + 1
+1346 : 06 1b __ ASL ACCU + 0
+1348 : 2a __ __ ROL
+1349 : 85 1c __ STA ACCU + 1
+134b : 18 __ __ CLC
+134c : a5 1b __ LDA ACCU + 0
+134e : 65 49 __ ADC T6 + 0
+1350 : aa __ __ TAX
+1351 : a5 1c __ LDA ACCU + 1
+1353 : 69 00 __ ADC #$00
+1355 : a8 __ __ TAY
+1356 : 38 __ __ SEC
+1357 : 8a __ __ TXA
+1358 : e9 30 __ SBC #$30
+135a : 85 47 __ STA T5 + 0
+135c : 98 __ __ TYA
+135d : e9 00 __ SBC #$00
+135f : 85 48 __ STA T5 + 1
+1361 : a5 43 __ LDA T3 + 0
+1363 : c9 30 __ CMP #$30
+1365 : b0 b3 __ BCS $131a
+1367 : a5 47 __ LDA T5 + 0
+1369 : 8d bc 53 STA $53bc ; (sframe + 2)
+136c : 4c 29 0c JMP $0c29 ; (sformat + 416)
+136f : a9 01 __ LDA #$01
+1371 : 8d c1 53 STA $53c1 ; (sframe + 7)
+1374 : a0 00 __ LDY #$00
+1376 : b1 61 __ LDA (T2 + 0),y
+1378 : 85 43 __ STA T3 + 0
+137a : 4c 9b 0b JMP $0b9b ; (sformat + 274)
+137d : a9 30 __ LDA #$30
+137f : 8d ba 53 STA $53ba ; (sframe + 0)
+1382 : a0 00 __ LDY #$00
+1384 : b1 61 __ LDA (T2 + 0),y
+1386 : 85 43 __ STA T3 + 0
+1388 : 4c 9b 0b JMP $0b9b ; (sformat + 274)
+138b : a9 01 __ LDA #$01
+138d : 8d bf 53 STA $53bf ; (sframe + 5)
+1390 : a0 00 __ LDY #$00
+1392 : b1 61 __ LDA (T2 + 0),y
+1394 : 85 43 __ STA T3 + 0
+1396 : 4c 9b 0b JMP $0b9b ; (sformat + 274)
+1399 : a0 08 __ LDY #$08
+139b : b1 23 __ LDA (SP + 0),y
+139d : d0 12 __ BNE $13b1
+139f : 18 __ __ CLC
+13a0 : a5 5d __ LDA T0 + 0
+13a2 : 65 5f __ ADC T1 + 0
+13a4 : 85 5d __ STA T0 + 0
+13a6 : 90 02 __ BCC $13aa
+13a8 : e6 5e __ INC T0 + 1
+13aa : a9 00 __ LDA #$00
+13ac : 85 5f __ STA T1 + 0
+13ae : 4c 71 0b JMP $0b71 ; (sformat + 232)
+13b1 : 18 __ __ CLC
+13b2 : a5 5d __ LDA T0 + 0
+13b4 : 85 0d __ STA P0
+13b6 : 65 5f __ ADC T1 + 0
+13b8 : 85 47 __ STA T5 + 0
+13ba : a5 5e __ LDA T0 + 1
+13bc : 85 0e __ STA P1
+13be : 69 00 __ ADC #$00
+13c0 : 85 48 __ STA T5 + 1
+13c2 : a9 00 __ LDA #$00
+13c4 : a0 00 __ LDY #$00
+13c6 : 91 47 __ STA (T5 + 0),y
+13c8 : 20 d2 13 JSR $13d2 ; (puts + 0)
+13cb : a9 00 __ LDA #$00
+13cd : 85 5f __ STA T1 + 0
+13cf : 4c 71 0b JMP $0b71 ; (sformat + 232)
+--------------------------------------------------------------------
+puts:
+13d2 : a0 00 __ LDY #$00
+13d4 : b1 0d __ LDA (P0),y
+13d6 : f0 0b __ BEQ $13e3
+13d8 : 20 e4 13 JSR $13e4 ; (putpch + 0)
+13db : e6 0d __ INC P0
+13dd : d0 f3 __ BNE $13d2
+13df : e6 0e __ INC P1
+13e1 : d0 ef __ BNE $13d2
+13e3 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+13e4 : ae d7 24 LDX $24d7 ; (giocharmap + 0)
+13e7 : e0 01 __ CPX #$01
+13e9 : 90 22 __ BCC $140d
+13eb : c9 0a __ CMP #$0a
+13ed : d0 02 __ BNE $13f1
+13ef : a9 0d __ LDA #$0d
+13f1 : e0 02 __ CPX #$02
+13f3 : 90 18 __ BCC $140d
+13f5 : c9 41 __ CMP #$41
+13f7 : 90 14 __ BCC $140d
+13f9 : c9 7b __ CMP #$7b
+13fb : b0 10 __ BCS $140d
+13fd : c9 61 __ CMP #$61
+13ff : b0 04 __ BCS $1405
+1401 : c9 5b __ CMP #$5b
+1403 : b0 08 __ BCS $140d
+1405 : 49 20 __ EOR #$20
+1407 : e0 03 __ CPX #$03
+1409 : f0 02 __ BEQ $140d
+140b : 29 df __ AND #$df
+140d : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+1410 : a5 11 __ LDA P4
+1412 : 85 47 __ STA T1 + 0
+1414 : a5 12 __ LDA P5
+1416 : 85 48 __ STA T1 + 1
+1418 : a5 13 __ LDA P6
+141a : 85 49 __ STA T1 + 2
+141c : a5 14 __ LDA P7
+141e : 85 4a __ STA T1 + 3
+1420 : a9 00 __ LDA #$00
+1422 : 85 4d __ STA T3 + 0
+1424 : a5 15 __ LDA P8
+1426 : f0 03 __ BEQ $142b
+1428 : 4c b7 15 JMP $15b7 ; (nforml + 423)
+142b : a9 10 __ LDA #$10
+142d : 85 4e __ STA T4 + 0
+142f : a9 00 __ LDA #$00
+1431 : c5 14 __ CMP P7
+1433 : d0 0a __ BNE $143f
+1435 : c5 13 __ CMP P6
+1437 : d0 06 __ BNE $143f
+1439 : c5 12 __ CMP P5
+143b : d0 02 __ BNE $143f
+143d : c5 11 __ CMP P4
+143f : b0 03 __ BCS $1444
+1441 : 4c 2b 15 JMP $152b ; (nforml + 283)
+1444 : a0 02 __ LDY #$02
+1446 : b1 0d __ LDA (P0),y
+1448 : 85 4f __ STA T5 + 0
+144a : c9 ff __ CMP #$ff
+144c : d0 03 __ BNE $1451
+144e : 4c 1d 15 JMP $151d ; (nforml + 269)
+1451 : 38 __ __ SEC
+1452 : a9 10 __ LDA #$10
+1454 : e5 4f __ SBC T5 + 0
+1456 : 85 4f __ STA T5 + 0
+1458 : c5 4e __ CMP T4 + 0
+145a : b0 0e __ BCS $146a
+145c : c6 4e __ DEC T4 + 0
+145e : a9 30 __ LDA #$30
+1460 : a4 4e __ LDY T4 + 0
+1462 : 91 0f __ STA (P2),y
+1464 : a5 4f __ LDA T5 + 0
+1466 : c5 4e __ CMP T4 + 0
+1468 : 90 f2 __ BCC $145c
+146a : a0 07 __ LDY #$07
+146c : b1 0d __ LDA (P0),y
+146e : f0 34 __ BEQ $14a4
+1470 : a0 03 __ LDY #$03
+1472 : b1 0d __ LDA (P0),y
+1474 : 85 53 __ STA T7 + 0
+1476 : c8 __ __ INY
+1477 : b1 0d __ LDA (P0),y
+1479 : d0 29 __ BNE $14a4
+147b : a5 53 __ LDA T7 + 0
+147d : c9 10 __ CMP #$10
+147f : d0 23 __ BNE $14a4
+1481 : 18 __ __ CLC
+1482 : a5 4e __ LDA T4 + 0
+1484 : 69 ff __ ADC #$ff
+1486 : 18 __ __ CLC
+1487 : 65 0f __ ADC P2
+1489 : 85 53 __ STA T7 + 0
+148b : a5 10 __ LDA P3
+148d : 69 00 __ ADC #$00
+148f : 85 54 __ STA T7 + 1
+1491 : a9 58 __ LDA #$58
+1493 : a0 00 __ LDY #$00
+1495 : 91 53 __ STA (T7 + 0),y
+1497 : 18 __ __ CLC
+1498 : a5 4e __ LDA T4 + 0
+149a : 69 fe __ ADC #$fe
+149c : 85 4e __ STA T4 + 0
+149e : a9 30 __ LDA #$30
+14a0 : a4 4e __ LDY T4 + 0
+14a2 : 91 0f __ STA (P2),y
+14a4 : a5 4d __ LDA T3 + 0
+14a6 : d0 6a __ BNE $1512
+14a8 : a0 05 __ LDY #$05
+14aa : b1 0d __ LDA (P0),y
+14ac : f0 08 __ BEQ $14b6
+14ae : c6 4e __ DEC T4 + 0
+14b0 : a9 2b __ LDA #$2b
+14b2 : a4 4e __ LDY T4 + 0
+14b4 : 91 0f __ STA (P2),y
+14b6 : a0 01 __ LDY #$01
+14b8 : b1 0d __ LDA (P0),y
+14ba : 85 53 __ STA T7 + 0
+14bc : 38 __ __ SEC
+14bd : a9 10 __ LDA #$10
+14bf : e5 53 __ SBC T7 + 0
+14c1 : 85 53 __ STA T7 + 0
+14c3 : a9 00 __ LDA #$00
+14c5 : e9 00 __ SBC #$00
+14c7 : 49 80 __ EOR #$80
+14c9 : c9 80 __ CMP #$80
+14cb : d0 04 __ BNE $14d1
+14cd : a5 53 __ LDA T7 + 0
+14cf : c5 4e __ CMP T4 + 0
+14d1 : 90 32 __ BCC $1505
+14d3 : a9 00 __ LDA #$00
+14d5 : 85 4d __ STA T3 + 0
+14d7 : a5 4e __ LDA T4 + 0
+14d9 : c9 10 __ CMP #$10
+14db : 90 09 __ BCC $14e6
+14dd : a5 4d __ LDA T3 + 0
+14df : 85 1b __ STA ACCU + 0
+14e1 : a9 00 __ LDA #$00
+14e3 : 85 1c __ STA ACCU + 1
+14e5 : 60 __ __ RTS
+14e6 : aa __ __ TAX
+14e7 : 8a __ __ TXA
+14e8 : 18 __ __ CLC
+14e9 : 65 0f __ ADC P2
+14eb : 85 51 __ STA T6 + 0
+14ed : a5 10 __ LDA P3
+14ef : 69 00 __ ADC #$00
+14f1 : 85 52 __ STA T6 + 1
+14f3 : a0 00 __ LDY #$00
+14f5 : b1 51 __ LDA (T6 + 0),y
+14f7 : a4 4d __ LDY T3 + 0
+14f9 : 91 0f __ STA (P2),y
+14fb : e6 4d __ INC T3 + 0
+14fd : e8 __ __ INX
+14fe : e0 10 __ CPX #$10
+1500 : 90 e5 __ BCC $14e7
+1502 : 4c dd 14 JMP $14dd ; (nforml + 205)
+1505 : c6 4e __ DEC T4 + 0
+1507 : a0 00 __ LDY #$00
+1509 : b1 0d __ LDA (P0),y
+150b : a4 4e __ LDY T4 + 0
+150d : 91 0f __ STA (P2),y
+150f : 4c b6 14 JMP $14b6 ; (nforml + 166)
+1512 : c6 4e __ DEC T4 + 0
+1514 : a9 2d __ LDA #$2d
+1516 : a4 4e __ LDY T4 + 0
+1518 : 91 0f __ STA (P2),y
+151a : 4c b6 14 JMP $14b6 ; (nforml + 166)
+151d : a9 0f __ LDA #$0f
+151f : 85 4f __ STA T5 + 0
+1521 : c5 4e __ CMP T4 + 0
+1523 : b0 03 __ BCS $1528
+1525 : 4c 5c 14 JMP $145c ; (nforml + 76)
+1528 : 4c 6a 14 JMP $146a ; (nforml + 90)
+152b : a0 03 __ LDY #$03
+152d : b1 0d __ LDA (P0),y
+152f : 85 03 __ STA $03
+1531 : c8 __ __ INY
+1532 : b1 0d __ LDA (P0),y
+1534 : 85 04 __ STA $04
+1536 : a9 00 __ LDA #$00
+1538 : 85 05 __ STA $05
+153a : 85 06 __ STA $06
+153c : a5 47 __ LDA T1 + 0
+153e : 85 1b __ STA ACCU + 0
+1540 : a5 48 __ LDA T1 + 1
+1542 : 85 1c __ STA ACCU + 1
+1544 : a5 49 __ LDA T1 + 2
+1546 : 85 1d __ STA ACCU + 2
+1548 : a5 4a __ LDA T1 + 3
+154a : 85 1e __ STA ACCU + 3
+154c : 20 7f 24 JSR $247f ; (divmod32 + 0)
+154f : a5 08 __ LDA $08
+1551 : 10 54 __ BPL $15a7
+1553 : 18 __ __ CLC
+1554 : a5 07 __ LDA $07
+1556 : 69 30 __ ADC #$30
+1558 : c6 4e __ DEC T4 + 0
+155a : a4 4e __ LDY T4 + 0
+155c : 91 0f __ STA (P2),y
+155e : a0 03 __ LDY #$03
+1560 : b1 0d __ LDA (P0),y
+1562 : 85 03 __ STA $03
+1564 : c8 __ __ INY
+1565 : b1 0d __ LDA (P0),y
+1567 : 85 04 __ STA $04
+1569 : a9 00 __ LDA #$00
+156b : 85 05 __ STA $05
+156d : 85 06 __ STA $06
+156f : a5 47 __ LDA T1 + 0
+1571 : 85 1b __ STA ACCU + 0
+1573 : a5 48 __ LDA T1 + 1
+1575 : 85 1c __ STA ACCU + 1
+1577 : a5 49 __ LDA T1 + 2
+1579 : 85 1d __ STA ACCU + 2
+157b : a5 4a __ LDA T1 + 3
+157d : 85 1e __ STA ACCU + 3
+157f : 20 7f 24 JSR $247f ; (divmod32 + 0)
+1582 : a5 1b __ LDA ACCU + 0
+1584 : 85 47 __ STA T1 + 0
+1586 : a5 1c __ LDA ACCU + 1
+1588 : 85 48 __ STA T1 + 1
+158a : a5 1d __ LDA ACCU + 2
+158c : 85 49 __ STA T1 + 2
+158e : a5 1e __ LDA ACCU + 3
+1590 : 85 4a __ STA T1 + 3
+1592 : a9 00 __ LDA #$00
+1594 : c5 1e __ CMP ACCU + 3
+1596 : d0 0a __ BNE $15a2
+1598 : c5 1d __ CMP ACCU + 2
+159a : d0 06 __ BNE $15a2
+159c : c5 1c __ CMP ACCU + 1
+159e : d0 02 __ BNE $15a2
+15a0 : c5 1b __ CMP ACCU + 0
+15a2 : 90 87 __ BCC $152b
+15a4 : 4c 44 14 JMP $1444 ; (nforml + 52)
+15a7 : d0 06 __ BNE $15af
+15a9 : a5 07 __ LDA $07
+15ab : c9 0a __ CMP #$0a
+15ad : 90 a4 __ BCC $1553
+15af : 18 __ __ CLC
+15b0 : a5 07 __ LDA $07
+15b2 : 69 37 __ ADC #$37
+15b4 : 4c 58 15 JMP $1558 ; (nforml + 328)
+15b7 : a5 14 __ LDA P7
+15b9 : 49 80 __ EOR #$80
+15bb : c9 80 __ CMP #$80
+15bd : d0 0f __ BNE $15ce
+15bf : a5 13 __ LDA P6
+15c1 : c9 00 __ CMP #$00
+15c3 : d0 09 __ BNE $15ce
+15c5 : a5 12 __ LDA P5
+15c7 : c9 00 __ CMP #$00
+15c9 : d0 03 __ BNE $15ce
+15cb : 4c 2b 14 JMP $142b ; (nforml + 27)
+15ce : 90 03 __ BCC $15d3
+15d0 : 4c 2b 14 JMP $142b ; (nforml + 27)
+15d3 : a9 01 __ LDA #$01
+15d5 : 85 4d __ STA T3 + 0
+15d7 : a9 10 __ LDA #$10
+15d9 : 85 4e __ STA T4 + 0
+15db : 38 __ __ SEC
+15dc : a9 00 __ LDA #$00
+15de : e5 11 __ SBC P4
+15e0 : 85 47 __ STA T1 + 0
+15e2 : a9 00 __ LDA #$00
+15e4 : e5 12 __ SBC P5
+15e6 : 85 48 __ STA T1 + 1
+15e8 : a9 00 __ LDA #$00
+15ea : e5 13 __ SBC P6
+15ec : 85 49 __ STA T1 + 2
+15ee : a9 00 __ LDA #$00
+15f0 : e5 14 __ SBC P7
+15f2 : 85 4a __ STA T1 + 3
+15f4 : a9 00 __ LDA #$00
+15f6 : c5 4a __ CMP T1 + 3
+15f8 : d0 0a __ BNE $1604
+15fa : c5 49 __ CMP T1 + 2
+15fc : d0 06 __ BNE $1604
+15fe : c5 48 __ CMP T1 + 1
+1600 : d0 02 __ BNE $1604
+1602 : c5 47 __ CMP T1 + 0
+1604 : b0 03 __ BCS $1609
+1606 : 4c 2b 15 JMP $152b ; (nforml + 283)
+1609 : 4c 44 14 JMP $1444 ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+160c : a9 00 __ LDA #$00
+160e : 85 1b __ STA ACCU + 0
+1610 : 85 1c __ STA ACCU + 1
+1612 : 85 1d __ STA ACCU + 2
+1614 : 85 1e __ STA ACCU + 3
+1616 : a5 11 __ LDA P4
+1618 : 85 03 __ STA $03
+161a : a5 12 __ LDA P5
+161c : 85 04 __ STA $04
+161e : a5 13 __ LDA P6
+1620 : 85 05 __ STA $05
+1622 : a5 14 __ LDA P7
+1624 : 85 06 __ STA $06
+1626 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1629 : 10 03 __ BPL $162e
+162b : 4c 46 1c JMP $1c46 ; (nformf + 1594)
+162e : a9 00 __ LDA #$00
+1630 : 85 4b __ STA T3 + 0
+1632 : a0 05 __ LDY #$05
+1634 : b1 0d __ LDA (P0),y
+1636 : f0 0a __ BEQ $1642
+1638 : a9 2b __ LDA #$2b
+163a : a0 00 __ LDY #$00
+163c : 91 0f __ STA (P2),y
+163e : a9 01 __ LDA #$01
+1640 : 85 4b __ STA T3 + 0
+1642 : a9 00 __ LDA #$00
+1644 : 85 43 __ STA T0 + 0
+1646 : 85 44 __ STA T0 + 1
+1648 : a0 02 __ LDY #$02
+164a : b1 0d __ LDA (P0),y
+164c : 85 4e __ STA T5 + 0
+164e : c9 ff __ CMP #$ff
+1650 : d0 04 __ BNE $1656
+1652 : a9 06 __ LDA #$06
+1654 : 85 4e __ STA T5 + 0
+1656 : a9 00 __ LDA #$00
+1658 : 85 1b __ STA ACCU + 0
+165a : 85 1c __ STA ACCU + 1
+165c : 85 1d __ STA ACCU + 2
+165e : 85 1e __ STA ACCU + 3
+1660 : a5 11 __ LDA P4
+1662 : 85 03 __ STA $03
+1664 : a5 12 __ LDA P5
+1666 : 85 04 __ STA $04
+1668 : a5 13 __ LDA P6
+166a : 85 05 __ STA $05
+166c : a5 14 __ LDA P7
+166e : 85 06 __ STA $06
+1670 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1673 : d0 03 __ BNE $1678
+1675 : 4c fc 17 JMP $17fc ; (nformf + 496)
+1678 : a9 00 __ LDA #$00
+167a : 85 1b __ STA ACCU + 0
+167c : 85 1c __ STA ACCU + 1
+167e : a9 7a __ LDA #$7a
+1680 : 85 1d __ STA ACCU + 2
+1682 : a9 44 __ LDA #$44
+1684 : 85 1e __ STA ACCU + 3
+1686 : a5 11 __ LDA P4
+1688 : 85 03 __ STA $03
+168a : a5 12 __ LDA P5
+168c : 85 04 __ STA $04
+168e : a5 13 __ LDA P6
+1690 : 85 05 __ STA $05
+1692 : a5 14 __ LDA P7
+1694 : 85 06 __ STA $06
+1696 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1699 : 30 5a __ BMI $16f5
+169b : a5 11 __ LDA P4
+169d : 85 1b __ STA ACCU + 0
+169f : a5 12 __ LDA P5
+16a1 : 85 1c __ STA ACCU + 1
+16a3 : a5 13 __ LDA P6
+16a5 : 85 1d __ STA ACCU + 2
+16a7 : a5 14 __ LDA P7
+16a9 : 85 1e __ STA ACCU + 3
+16ab : a9 00 __ LDA #$00
+16ad : 85 03 __ STA $03
+16af : 85 04 __ STA $04
+16b1 : a9 7a __ LDA #$7a
+16b3 : 85 05 __ STA $05
+16b5 : a9 44 __ LDA #$44
+16b7 : 85 06 __ STA $06
+16b9 : 20 a4 20 JSR $20a4 ; (freg + 20)
+16bc : 20 3b 22 JSR $223b ; (fdiv + 0)
+16bf : a5 1b __ LDA ACCU + 0
+16c1 : 85 11 __ STA P4
+16c3 : 85 03 __ STA $03
+16c5 : a5 1c __ LDA ACCU + 1
+16c7 : 85 12 __ STA P5
+16c9 : 85 04 __ STA $04
+16cb : a5 1d __ LDA ACCU + 2
+16cd : 85 13 __ STA P6
+16cf : 85 05 __ STA $05
+16d1 : a5 1e __ LDA ACCU + 3
+16d3 : 85 14 __ STA P7
+16d5 : 85 06 __ STA $06
+16d7 : 18 __ __ CLC
+16d8 : a5 43 __ LDA T0 + 0
+16da : 69 03 __ ADC #$03
+16dc : 85 43 __ STA T0 + 0
+16de : 90 02 __ BCC $16e2
+16e0 : e6 44 __ INC T0 + 1
+16e2 : a9 00 __ LDA #$00
+16e4 : 85 1b __ STA ACCU + 0
+16e6 : 85 1c __ STA ACCU + 1
+16e8 : a9 7a __ LDA #$7a
+16ea : 85 1d __ STA ACCU + 2
+16ec : a9 44 __ LDA #$44
+16ee : 85 1e __ STA ACCU + 3
+16f0 : 20 2e 24 JSR $242e ; (fcmp + 0)
+16f3 : 10 a6 __ BPL $169b
+16f5 : a9 00 __ LDA #$00
+16f7 : 85 1b __ STA ACCU + 0
+16f9 : 85 1c __ STA ACCU + 1
+16fb : a9 80 __ LDA #$80
+16fd : 85 1d __ STA ACCU + 2
+16ff : a9 3f __ LDA #$3f
+1701 : 85 1e __ STA ACCU + 3
+1703 : a5 11 __ LDA P4
+1705 : 85 03 __ STA $03
+1707 : a5 12 __ LDA P5
+1709 : 85 04 __ STA $04
+170b : a5 13 __ LDA P6
+170d : 85 05 __ STA $05
+170f : a5 14 __ LDA P7
+1711 : 85 06 __ STA $06
+1713 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1716 : 10 5c __ BPL $1774
+1718 : a5 11 __ LDA P4
+171a : 85 1b __ STA ACCU + 0
+171c : a5 12 __ LDA P5
+171e : 85 1c __ STA ACCU + 1
+1720 : a5 13 __ LDA P6
+1722 : 85 1d __ STA ACCU + 2
+1724 : a5 14 __ LDA P7
+1726 : 85 1e __ STA ACCU + 3
+1728 : a9 00 __ LDA #$00
+172a : 85 03 __ STA $03
+172c : 85 04 __ STA $04
+172e : a9 7a __ LDA #$7a
+1730 : 85 05 __ STA $05
+1732 : a9 44 __ LDA #$44
+1734 : 85 06 __ STA $06
+1736 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1739 : 20 9d 21 JSR $219d ; (fmul + 0)
+173c : a5 1b __ LDA ACCU + 0
+173e : 85 11 __ STA P4
+1740 : 85 03 __ STA $03
+1742 : a5 1c __ LDA ACCU + 1
+1744 : 85 12 __ STA P5
+1746 : 85 04 __ STA $04
+1748 : a5 1d __ LDA ACCU + 2
+174a : 85 13 __ STA P6
+174c : 85 05 __ STA $05
+174e : a5 1e __ LDA ACCU + 3
+1750 : 85 14 __ STA P7
+1752 : 85 06 __ STA $06
+1754 : 38 __ __ SEC
+1755 : a5 43 __ LDA T0 + 0
+1757 : e9 03 __ SBC #$03
+1759 : 85 43 __ STA T0 + 0
+175b : a5 44 __ LDA T0 + 1
+175d : e9 00 __ SBC #$00
+175f : 85 44 __ STA T0 + 1
+1761 : a9 00 __ LDA #$00
+1763 : 85 1b __ STA ACCU + 0
+1765 : 85 1c __ STA ACCU + 1
+1767 : a9 80 __ LDA #$80
+1769 : 85 1d __ STA ACCU + 2
+176b : a9 3f __ LDA #$3f
+176d : 85 1e __ STA ACCU + 3
+176f : 20 2e 24 JSR $242e ; (fcmp + 0)
+1772 : 30 a4 __ BMI $1718
+1774 : a9 00 __ LDA #$00
+1776 : 85 1b __ STA ACCU + 0
+1778 : 85 1c __ STA ACCU + 1
+177a : a9 20 __ LDA #$20
+177c : 85 1d __ STA ACCU + 2
+177e : a9 41 __ LDA #$41
+1780 : 85 1e __ STA ACCU + 3
+1782 : a5 11 __ LDA P4
+1784 : 85 03 __ STA $03
+1786 : a5 12 __ LDA P5
+1788 : 85 04 __ STA $04
+178a : a5 13 __ LDA P6
+178c : 85 05 __ STA $05
+178e : a5 14 __ LDA P7
+1790 : 85 06 __ STA $06
+1792 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1795 : 30 65 __ BMI $17fc
+1797 : a5 11 __ LDA P4
+1799 : 85 1b __ STA ACCU + 0
+179b : a5 12 __ LDA P5
+179d : 85 1c __ STA ACCU + 1
+179f : a5 13 __ LDA P6
+17a1 : 85 1d __ STA ACCU + 2
+17a3 : a5 14 __ LDA P7
+17a5 : 85 1e __ STA ACCU + 3
+17a7 : a9 00 __ LDA #$00
+17a9 : 85 03 __ STA $03
+17ab : 85 04 __ STA $04
+17ad : a9 20 __ LDA #$20
+17af : 85 05 __ STA $05
+17b1 : a9 41 __ LDA #$41
+17b3 : 85 06 __ STA $06
+17b5 : 20 a4 20 JSR $20a4 ; (freg + 20)
+17b8 : 20 3b 22 JSR $223b ; (fdiv + 0)
+17bb : a5 1b __ LDA ACCU + 0
+17bd : 85 11 __ STA P4
+17bf : 85 47 __ STA T2 + 0
+17c1 : a5 1c __ LDA ACCU + 1
+17c3 : 85 12 __ STA P5
+17c5 : 85 48 __ STA T2 + 1
+17c7 : a5 1d __ LDA ACCU + 2
+17c9 : 85 13 __ STA P6
+17cb : 85 49 __ STA T2 + 2
+17cd : a5 1e __ LDA ACCU + 3
+17cf : 85 14 __ STA P7
+17d1 : 85 4a __ STA T2 + 3
+17d3 : e6 43 __ INC T0 + 0
+17d5 : d0 02 __ BNE $17d9
+17d7 : e6 44 __ INC T0 + 1
+17d9 : a9 00 __ LDA #$00
+17db : 85 1b __ STA ACCU + 0
+17dd : 85 1c __ STA ACCU + 1
+17df : a9 20 __ LDA #$20
+17e1 : 85 1d __ STA ACCU + 2
+17e3 : a9 41 __ LDA #$41
+17e5 : 85 1e __ STA ACCU + 3
+17e7 : a5 47 __ LDA T2 + 0
+17e9 : 85 03 __ STA $03
+17eb : a5 48 __ LDA T2 + 1
+17ed : 85 04 __ STA $04
+17ef : a5 49 __ LDA T2 + 2
+17f1 : 85 05 __ STA $05
+17f3 : a5 4a __ LDA T2 + 3
+17f5 : 85 06 __ STA $06
+17f7 : 20 2e 24 JSR $242e ; (fcmp + 0)
+17fa : 10 9b __ BPL $1797
+17fc : a5 15 __ LDA P8
+17fe : c9 65 __ CMP #$65
+1800 : d0 03 __ BNE $1805
+1802 : 4c 41 1c JMP $1c41 ; (nformf + 1589)
+1805 : a9 00 __ LDA #$00
+1807 : 85 51 __ STA T7 + 0
+1809 : 85 52 __ STA T8 + 0
+180b : a5 4e __ LDA T5 + 0
+180d : 85 4c __ STA T4 + 0
+180f : e6 4c __ INC T4 + 0
+1811 : a5 15 __ LDA P8
+1813 : c9 67 __ CMP #$67
+1815 : d0 03 __ BNE $181a
+1817 : 4c 24 1c JMP $1c24 ; (nformf + 1560)
+181a : a5 51 __ LDA T7 + 0
+181c : f0 03 __ BEQ $1821
+181e : 4c 32 1b JMP $1b32 ; (nformf + 1318)
+1821 : a5 44 __ LDA T0 + 1
+1823 : 10 03 __ BPL $1828
+1825 : 4c f1 1a JMP $1af1 ; (nformf + 1253)
+1828 : a9 00 __ LDA #$00
+182a : 85 47 __ STA T2 + 0
+182c : 85 48 __ STA T2 + 1
+182e : 85 49 __ STA T2 + 2
+1830 : a9 3f __ LDA #$3f
+1832 : 85 4a __ STA T2 + 3
+1834 : 18 __ __ CLC
+1835 : a5 4e __ LDA T5 + 0
+1837 : 65 43 __ ADC T0 + 0
+1839 : 85 4c __ STA T4 + 0
+183b : e6 4c __ INC T4 + 0
+183d : a9 01 __ LDA #$01
+183f : c5 4c __ CMP T4 + 0
+1841 : b0 03 __ BCS $1846
+1843 : 4c b0 1a JMP $1ab0 ; (nformf + 1188)
+1846 : a5 11 __ LDA P4
+1848 : 85 1b __ STA ACCU + 0
+184a : a5 12 __ LDA P5
+184c : 85 1c __ STA ACCU + 1
+184e : a5 13 __ LDA P6
+1850 : 85 1d __ STA ACCU + 2
+1852 : a5 14 __ LDA P7
+1854 : 85 1e __ STA ACCU + 3
+1856 : a5 47 __ LDA T2 + 0
+1858 : 85 03 __ STA $03
+185a : a5 48 __ LDA T2 + 1
+185c : 85 04 __ STA $04
+185e : a5 49 __ LDA T2 + 2
+1860 : 85 05 __ STA $05
+1862 : a5 4a __ LDA T2 + 3
+1864 : 85 06 __ STA $06
+1866 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1869 : 20 d5 20 JSR $20d5 ; (faddsub + 0)
+186c : a5 1b __ LDA ACCU + 0
+186e : 85 11 __ STA P4
+1870 : 85 47 __ STA T2 + 0
+1872 : 85 03 __ STA $03
+1874 : a5 1c __ LDA ACCU + 1
+1876 : 85 12 __ STA P5
+1878 : 85 48 __ STA T2 + 1
+187a : 85 04 __ STA $04
+187c : a5 1d __ LDA ACCU + 2
+187e : 85 13 __ STA P6
+1880 : 85 49 __ STA T2 + 2
+1882 : 85 05 __ STA $05
+1884 : a5 1e __ LDA ACCU + 3
+1886 : 85 14 __ STA P7
+1888 : 85 4a __ STA T2 + 3
+188a : 85 06 __ STA $06
+188c : a9 00 __ LDA #$00
+188e : 85 1b __ STA ACCU + 0
+1890 : 85 1c __ STA ACCU + 1
+1892 : a9 20 __ LDA #$20
+1894 : 85 1d __ STA ACCU + 2
+1896 : a9 41 __ LDA #$41
+1898 : 85 1e __ STA ACCU + 3
+189a : 20 2e 24 JSR $242e ; (fcmp + 0)
+189d : 30 36 __ BMI $18d5
+189f : a5 47 __ LDA T2 + 0
+18a1 : 85 1b __ STA ACCU + 0
+18a3 : a5 48 __ LDA T2 + 1
+18a5 : 85 1c __ STA ACCU + 1
+18a7 : a5 49 __ LDA T2 + 2
+18a9 : 85 1d __ STA ACCU + 2
+18ab : a5 4a __ LDA T2 + 3
+18ad : 85 1e __ STA ACCU + 3
+18af : a9 00 __ LDA #$00
+18b1 : 85 03 __ STA $03
+18b3 : 85 04 __ STA $04
+18b5 : a9 20 __ LDA #$20
+18b7 : 85 05 __ STA $05
+18b9 : a9 41 __ LDA #$41
+18bb : 85 06 __ STA $06
+18bd : 20 a4 20 JSR $20a4 ; (freg + 20)
+18c0 : 20 3b 22 JSR $223b ; (fdiv + 0)
+18c3 : a5 1b __ LDA ACCU + 0
+18c5 : 85 11 __ STA P4
+18c7 : a5 1c __ LDA ACCU + 1
+18c9 : 85 12 __ STA P5
+18cb : a5 1d __ LDA ACCU + 2
+18cd : 85 13 __ STA P6
+18cf : a5 1e __ LDA ACCU + 3
+18d1 : 85 14 __ STA P7
+18d3 : c6 4e __ DEC T5 + 0
+18d5 : 38 __ __ SEC
+18d6 : a5 4c __ LDA T4 + 0
+18d8 : e5 4e __ SBC T5 + 0
+18da : 85 53 __ STA T10 + 0
+18dc : 85 4e __ STA T5 + 0
+18de : a9 14 __ LDA #$14
+18e0 : c5 4c __ CMP T4 + 0
+18e2 : b0 02 __ BCS $18e6
+18e4 : 85 4c __ STA T4 + 0
+18e6 : a5 53 __ LDA T10 + 0
+18e8 : d0 08 __ BNE $18f2
+18ea : a9 30 __ LDA #$30
+18ec : a4 4b __ LDY T3 + 0
+18ee : 91 0f __ STA (P2),y
+18f0 : e6 4b __ INC T3 + 0
+18f2 : a9 00 __ LDA #$00
+18f4 : 85 50 __ STA T6 + 0
+18f6 : a5 4c __ LDA T4 + 0
+18f8 : f0 03 __ BEQ $18fd
+18fa : 4c 1f 1a JMP $1a1f ; (nformf + 1043)
+18fd : a5 52 __ LDA T8 + 0
+18ff : f0 03 __ BEQ $1904
+1901 : 4c 9f 19 JMP $199f ; (nformf + 915)
+1904 : a5 4b __ LDA T3 + 0
+1906 : a0 01 __ LDY #$01
+1908 : d1 0d __ CMP (P0),y
+190a : 90 07 __ BCC $1913
+190c : 85 1b __ STA ACCU + 0
+190e : a9 00 __ LDA #$00
+1910 : 85 1c __ STA ACCU + 1
+1912 : 60 __ __ RTS
+1913 : c9 01 __ CMP #$01
+1915 : 90 53 __ BCC $196a
+1917 : a9 01 __ LDA #$01
+1919 : 85 4e __ STA T5 + 0
+191b : a5 0d __ LDA P0
+191d : 85 43 __ STA T0 + 0
+191f : a5 0e __ LDA P1
+1921 : 85 44 __ STA T0 + 1
+1923 : a5 4b __ LDA T3 + 0
+1925 : 85 4c __ STA T4 + 0
+1927 : 38 __ __ SEC
+1928 : a5 4c __ LDA T4 + 0
+192a : e5 4e __ SBC T5 + 0
+192c : 85 55 __ STA T11 + 0
+192e : a9 00 __ LDA #$00
+1930 : e9 00 __ SBC #$00
+1932 : 85 56 __ STA T11 + 1
+1934 : 18 __ __ CLC
+1935 : a5 0f __ LDA P2
+1937 : 65 55 __ ADC T11 + 0
+1939 : 85 55 __ STA T11 + 0
+193b : a5 10 __ LDA P3
+193d : 65 56 __ ADC T11 + 1
+193f : 85 56 __ STA T11 + 1
+1941 : a0 01 __ LDY #$01
+1943 : b1 43 __ LDA (T0 + 0),y
+1945 : 38 __ __ SEC
+1946 : e5 4e __ SBC T5 + 0
+1948 : 85 53 __ STA T10 + 0
+194a : a9 00 __ LDA #$00
+194c : e9 00 __ SBC #$00
+194e : 85 54 __ STA T10 + 1
+1950 : 18 __ __ CLC
+1951 : a5 0f __ LDA P2
+1953 : 65 53 __ ADC T10 + 0
+1955 : 85 53 __ STA T10 + 0
+1957 : a5 10 __ LDA P3
+1959 : 65 54 __ ADC T10 + 1
+195b : 85 54 __ STA T10 + 1
+195d : 88 __ __ DEY
+195e : b1 55 __ LDA (T11 + 0),y
+1960 : 91 53 __ STA (T10 + 0),y
+1962 : e6 4e __ INC T5 + 0
+1964 : a5 4b __ LDA T3 + 0
+1966 : c5 4e __ CMP T5 + 0
+1968 : b0 bd __ BCS $1927
+196a : a9 00 __ LDA #$00
+196c : 85 4e __ STA T5 + 0
+196e : a5 4b __ LDA T3 + 0
+1970 : 85 43 __ STA T0 + 0
+1972 : a0 01 __ LDY #$01
+1974 : b1 0d __ LDA (P0),y
+1976 : 85 4b __ STA T3 + 0
+1978 : 38 __ __ SEC
+1979 : e5 43 __ SBC T0 + 0
+197b : 85 53 __ STA T10 + 0
+197d : a9 00 __ LDA #$00
+197f : e9 00 __ SBC #$00
+1981 : 85 54 __ STA T10 + 1
+1983 : a9 00 __ LDA #$00
+1985 : c5 54 __ CMP T10 + 1
+1987 : d0 04 __ BNE $198d
+1989 : a5 4e __ LDA T5 + 0
+198b : c5 53 __ CMP T10 + 0
+198d : 90 05 __ BCC $1994
+198f : a5 4b __ LDA T3 + 0
+1991 : 4c 0c 19 JMP $190c ; (nformf + 768)
+1994 : a9 20 __ LDA #$20
+1996 : a4 4e __ LDY T5 + 0
+1998 : 91 0f __ STA (P2),y
+199a : e6 4e __ INC T5 + 0
+199c : 4c 72 19 JMP $1972 ; (nformf + 870)
+199f : a9 45 __ LDA #$45
+19a1 : a4 4b __ LDY T3 + 0
+19a3 : 91 0f __ STA (P2),y
+19a5 : c8 __ __ INY
+19a6 : a5 44 __ LDA T0 + 1
+19a8 : 30 5a __ BMI $1a04
+19aa : a9 2b __ LDA #$2b
+19ac : 91 0f __ STA (P2),y
+19ae : 18 __ __ CLC
+19af : a5 4b __ LDA T3 + 0
+19b1 : 69 02 __ ADC #$02
+19b3 : 85 4b __ STA T3 + 0
+19b5 : a5 43 __ LDA T0 + 0
+19b7 : 85 1b __ STA ACCU + 0
+19b9 : a5 44 __ LDA T0 + 1
+19bb : 85 1c __ STA ACCU + 1
+19bd : a9 0a __ LDA #$0a
+19bf : 85 03 __ STA $03
+19c1 : a9 00 __ LDA #$00
+19c3 : 85 04 __ STA $04
+19c5 : 20 b9 22 JSR $22b9 ; (divs16 + 0)
+19c8 : 18 __ __ CLC
+19c9 : a5 1b __ LDA ACCU + 0
+19cb : 69 30 __ ADC #$30
+19cd : a4 4b __ LDY T3 + 0
+19cf : 91 0f __ STA (P2),y
+19d1 : c8 __ __ INY
+19d2 : 98 __ __ TYA
+19d3 : 18 __ __ CLC
+19d4 : 65 0f __ ADC P2
+19d6 : 85 4c __ STA T4 + 0
+19d8 : a5 10 __ LDA P3
+19da : 69 00 __ ADC #$00
+19dc : 85 4d __ STA T4 + 1
+19de : a5 43 __ LDA T0 + 0
+19e0 : 85 1b __ STA ACCU + 0
+19e2 : a5 44 __ LDA T0 + 1
+19e4 : 85 1c __ STA ACCU + 1
+19e6 : a9 0a __ LDA #$0a
+19e8 : 85 03 __ STA $03
+19ea : a9 00 __ LDA #$00
+19ec : 85 04 __ STA $04
+19ee : 20 78 23 JSR $2378 ; (mods16 + 0)
+19f1 : 18 __ __ CLC
+19f2 : a5 05 __ LDA $05
+19f4 : 69 30 __ ADC #$30
+19f6 : a0 00 __ LDY #$00
+19f8 : 91 4c __ STA (T4 + 0),y
+19fa : 18 __ __ CLC
+19fb : a5 4b __ LDA T3 + 0
+19fd : 69 02 __ ADC #$02
+19ff : 85 4b __ STA T3 + 0
+1a01 : 4c 04 19 JMP $1904 ; (nformf + 760)
+1a04 : a9 2d __ LDA #$2d
+1a06 : 91 0f __ STA (P2),y
+1a08 : 18 __ __ CLC
+1a09 : a5 4b __ LDA T3 + 0
+1a0b : 69 02 __ ADC #$02
+1a0d : 85 4b __ STA T3 + 0
+1a0f : 38 __ __ SEC
+1a10 : a9 00 __ LDA #$00
+1a12 : e5 43 __ SBC T0 + 0
+1a14 : 85 43 __ STA T0 + 0
+1a16 : a9 00 __ LDA #$00
+1a18 : e5 44 __ SBC T0 + 1
+1a1a : 85 44 __ STA T0 + 1
+1a1c : 4c b5 19 JMP $19b5 ; (nformf + 937)
+1a1f : a5 50 __ LDA T6 + 0
+1a21 : c5 4e __ CMP T5 + 0
+1a23 : d0 08 __ BNE $1a2d
+1a25 : a9 2e __ LDA #$2e
+1a27 : a4 4b __ LDY T3 + 0
+1a29 : 91 0f __ STA (P2),y
+1a2b : e6 4b __ INC T3 + 0
+1a2d : a5 11 __ LDA P4
+1a2f : 85 1b __ STA ACCU + 0
+1a31 : a5 12 __ LDA P5
+1a33 : 85 1c __ STA ACCU + 1
+1a35 : a5 13 __ LDA P6
+1a37 : 85 1d __ STA ACCU + 2
+1a39 : a5 14 __ LDA P7
+1a3b : 85 1e __ STA ACCU + 3
+1a3d : 20 a1 23 JSR $23a1 ; (f32_to_i16 + 0)
+1a40 : a5 1b __ LDA ACCU + 0
+1a42 : 85 53 __ STA T10 + 0
+1a44 : 20 e3 23 JSR $23e3 ; (sint16_to_float + 0)
+1a47 : a5 1b __ LDA ACCU + 0
+1a49 : 85 03 __ STA $03
+1a4b : a5 1c __ LDA ACCU + 1
+1a4d : 85 04 __ STA $04
+1a4f : a5 1d __ LDA ACCU + 2
+1a51 : 85 05 __ STA $05
+1a53 : a5 1e __ LDA ACCU + 3
+1a55 : 85 06 __ STA $06
+1a57 : a5 11 __ LDA P4
+1a59 : 85 1b __ STA ACCU + 0
+1a5b : a5 12 __ LDA P5
+1a5d : 85 1c __ STA ACCU + 1
+1a5f : a5 13 __ LDA P6
+1a61 : 85 1d __ STA ACCU + 2
+1a63 : a5 14 __ LDA P7
+1a65 : 85 1e __ STA ACCU + 3
+1a67 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1a6a : a5 06 __ LDA $06
+1a6c : 49 80 __ EOR #$80
+1a6e : 85 06 __ STA $06
+1a70 : 20 d5 20 JSR $20d5 ; (faddsub + 0)
+1a73 : a9 00 __ LDA #$00
+1a75 : 85 03 __ STA $03
+1a77 : 85 04 __ STA $04
+1a79 : a9 20 __ LDA #$20
+1a7b : 85 05 __ STA $05
+1a7d : a9 41 __ LDA #$41
+1a7f : 85 06 __ STA $06
+1a81 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1a84 : 20 9d 21 JSR $219d ; (fmul + 0)
+1a87 : a5 1b __ LDA ACCU + 0
+1a89 : 85 11 __ STA P4
+1a8b : a5 1c __ LDA ACCU + 1
+1a8d : 85 12 __ STA P5
+1a8f : a5 1d __ LDA ACCU + 2
+1a91 : 85 13 __ STA P6
+1a93 : a5 1e __ LDA ACCU + 3
+1a95 : 85 14 __ STA P7
+1a97 : 18 __ __ CLC
+1a98 : a5 53 __ LDA T10 + 0
+1a9a : 69 30 __ ADC #$30
+1a9c : a4 4b __ LDY T3 + 0
+1a9e : 91 0f __ STA (P2),y
+1aa0 : e6 4b __ INC T3 + 0
+1aa2 : e6 50 __ INC T6 + 0
+1aa4 : a5 50 __ LDA T6 + 0
+1aa6 : c5 4c __ CMP T4 + 0
+1aa8 : b0 03 __ BCS $1aad
+1aaa : 4c 1f 1a JMP $1a1f ; (nformf + 1043)
+1aad : 4c fd 18 JMP $18fd ; (nformf + 753)
+1ab0 : 85 50 __ STA T6 + 0
+1ab2 : a5 47 __ LDA T2 + 0
+1ab4 : 85 1b __ STA ACCU + 0
+1ab6 : a5 48 __ LDA T2 + 1
+1ab8 : 85 1c __ STA ACCU + 1
+1aba : a5 49 __ LDA T2 + 2
+1abc : 85 1d __ STA ACCU + 2
+1abe : a5 4a __ LDA T2 + 3
+1ac0 : 85 1e __ STA ACCU + 3
+1ac2 : a9 00 __ LDA #$00
+1ac4 : 85 03 __ STA $03
+1ac6 : 85 04 __ STA $04
+1ac8 : a9 20 __ LDA #$20
+1aca : 85 05 __ STA $05
+1acc : a9 41 __ LDA #$41
+1ace : 85 06 __ STA $06
+1ad0 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1ad3 : 20 3b 22 JSR $223b ; (fdiv + 0)
+1ad6 : a5 1b __ LDA ACCU + 0
+1ad8 : 85 47 __ STA T2 + 0
+1ada : a5 1c __ LDA ACCU + 1
+1adc : 85 48 __ STA T2 + 1
+1ade : a5 1d __ LDA ACCU + 2
+1ae0 : 85 49 __ STA T2 + 2
+1ae2 : a5 1e __ LDA ACCU + 3
+1ae4 : 85 4a __ STA T2 + 3
+1ae6 : e6 50 __ INC T6 + 0
+1ae8 : a5 50 __ LDA T6 + 0
+1aea : c5 4c __ CMP T4 + 0
+1aec : 90 c4 __ BCC $1ab2
+1aee : 4c 46 18 JMP $1846 ; (nformf + 570)
+1af1 : a5 11 __ LDA P4
+1af3 : 85 1b __ STA ACCU + 0
+1af5 : a5 12 __ LDA P5
+1af7 : 85 1c __ STA ACCU + 1
+1af9 : a5 13 __ LDA P6
+1afb : 85 1d __ STA ACCU + 2
+1afd : a5 14 __ LDA P7
+1aff : 85 1e __ STA ACCU + 3
+1b01 : a9 00 __ LDA #$00
+1b03 : 85 03 __ STA $03
+1b05 : 85 04 __ STA $04
+1b07 : a9 20 __ LDA #$20
+1b09 : 85 05 __ STA $05
+1b0b : a9 41 __ LDA #$41
+1b0d : 85 06 __ STA $06
+1b0f : 20 a4 20 JSR $20a4 ; (freg + 20)
+1b12 : 20 3b 22 JSR $223b ; (fdiv + 0)
+1b15 : a5 1b __ LDA ACCU + 0
+1b17 : 85 11 __ STA P4
+1b19 : a5 1c __ LDA ACCU + 1
+1b1b : 85 12 __ STA P5
+1b1d : a5 1d __ LDA ACCU + 2
+1b1f : 85 13 __ STA P6
+1b21 : a5 1e __ LDA ACCU + 3
+1b23 : 85 14 __ STA P7
+1b25 : e6 43 __ INC T0 + 0
+1b27 : d0 02 __ BNE $1b2b
+1b29 : e6 44 __ INC T0 + 1
+1b2b : a5 44 __ LDA T0 + 1
+1b2d : 30 c2 __ BMI $1af1
+1b2f : 4c 28 18 JMP $1828 ; (nformf + 540)
+1b32 : a9 00 __ LDA #$00
+1b34 : 85 47 __ STA T2 + 0
+1b36 : 85 48 __ STA T2 + 1
+1b38 : 85 49 __ STA T2 + 2
+1b3a : a9 3f __ LDA #$3f
+1b3c : 85 4a __ STA T2 + 3
+1b3e : a5 4e __ LDA T5 + 0
+1b40 : f0 03 __ BEQ $1b45
+1b42 : 4c e1 1b JMP $1be1 ; (nformf + 1493)
+1b45 : a5 11 __ LDA P4
+1b47 : 85 1b __ STA ACCU + 0
+1b49 : a5 12 __ LDA P5
+1b4b : 85 1c __ STA ACCU + 1
+1b4d : a5 13 __ LDA P6
+1b4f : 85 1d __ STA ACCU + 2
+1b51 : a5 14 __ LDA P7
+1b53 : 85 1e __ STA ACCU + 3
+1b55 : a5 47 __ LDA T2 + 0
+1b57 : 85 03 __ STA $03
+1b59 : a5 48 __ LDA T2 + 1
+1b5b : 85 04 __ STA $04
+1b5d : a5 49 __ LDA T2 + 2
+1b5f : 85 05 __ STA $05
+1b61 : a5 4a __ LDA T2 + 3
+1b63 : 85 06 __ STA $06
+1b65 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1b68 : 20 d5 20 JSR $20d5 ; (faddsub + 0)
+1b6b : a5 1b __ LDA ACCU + 0
+1b6d : 85 11 __ STA P4
+1b6f : 85 47 __ STA T2 + 0
+1b71 : 85 03 __ STA $03
+1b73 : a5 1c __ LDA ACCU + 1
+1b75 : 85 12 __ STA P5
+1b77 : 85 48 __ STA T2 + 1
+1b79 : 85 04 __ STA $04
+1b7b : a5 1d __ LDA ACCU + 2
+1b7d : 85 13 __ STA P6
+1b7f : 85 49 __ STA T2 + 2
+1b81 : 85 05 __ STA $05
+1b83 : a5 1e __ LDA ACCU + 3
+1b85 : 85 14 __ STA P7
+1b87 : 85 4a __ STA T2 + 3
+1b89 : 85 06 __ STA $06
+1b8b : a9 00 __ LDA #$00
+1b8d : 85 1b __ STA ACCU + 0
+1b8f : 85 1c __ STA ACCU + 1
+1b91 : a9 20 __ LDA #$20
+1b93 : 85 1d __ STA ACCU + 2
+1b95 : a9 41 __ LDA #$41
+1b97 : 85 1e __ STA ACCU + 3
+1b99 : 20 2e 24 JSR $242e ; (fcmp + 0)
+1b9c : 10 03 __ BPL $1ba1
+1b9e : 4c d5 18 JMP $18d5 ; (nformf + 713)
+1ba1 : a5 47 __ LDA T2 + 0
+1ba3 : 85 1b __ STA ACCU + 0
+1ba5 : a5 48 __ LDA T2 + 1
+1ba7 : 85 1c __ STA ACCU + 1
+1ba9 : a5 49 __ LDA T2 + 2
+1bab : 85 1d __ STA ACCU + 2
+1bad : a5 4a __ LDA T2 + 3
+1baf : 85 1e __ STA ACCU + 3
+1bb1 : a9 00 __ LDA #$00
+1bb3 : 85 03 __ STA $03
+1bb5 : 85 04 __ STA $04
+1bb7 : a9 20 __ LDA #$20
+1bb9 : 85 05 __ STA $05
+1bbb : a9 41 __ LDA #$41
+1bbd : 85 06 __ STA $06
+1bbf : 20 a4 20 JSR $20a4 ; (freg + 20)
+1bc2 : 20 3b 22 JSR $223b ; (fdiv + 0)
+1bc5 : a5 1b __ LDA ACCU + 0
+1bc7 : 85 11 __ STA P4
+1bc9 : a5 1c __ LDA ACCU + 1
+1bcb : 85 12 __ STA P5
+1bcd : a5 1d __ LDA ACCU + 2
+1bcf : 85 13 __ STA P6
+1bd1 : a5 1e __ LDA ACCU + 3
+1bd3 : 85 14 __ STA P7
+1bd5 : e6 43 __ INC T0 + 0
+1bd7 : f0 03 __ BEQ $1bdc
+1bd9 : 4c d5 18 JMP $18d5 ; (nformf + 713)
+1bdc : e6 44 __ INC T0 + 1
+1bde : 4c d5 18 JMP $18d5 ; (nformf + 713)
+1be1 : a9 00 __ LDA #$00
+1be3 : 85 50 __ STA T6 + 0
+1be5 : a5 47 __ LDA T2 + 0
+1be7 : 85 1b __ STA ACCU + 0
+1be9 : a5 48 __ LDA T2 + 1
+1beb : 85 1c __ STA ACCU + 1
+1bed : a5 49 __ LDA T2 + 2
+1bef : 85 1d __ STA ACCU + 2
+1bf1 : a5 4a __ LDA T2 + 3
+1bf3 : 85 1e __ STA ACCU + 3
+1bf5 : a9 00 __ LDA #$00
+1bf7 : 85 03 __ STA $03
+1bf9 : 85 04 __ STA $04
+1bfb : a9 20 __ LDA #$20
+1bfd : 85 05 __ STA $05
+1bff : a9 41 __ LDA #$41
+1c01 : 85 06 __ STA $06
+1c03 : 20 a4 20 JSR $20a4 ; (freg + 20)
+1c06 : 20 3b 22 JSR $223b ; (fdiv + 0)
+1c09 : a5 1b __ LDA ACCU + 0
+1c0b : 85 47 __ STA T2 + 0
+1c0d : a5 1c __ LDA ACCU + 1
+1c0f : 85 48 __ STA T2 + 1
+1c11 : a5 1d __ LDA ACCU + 2
+1c13 : 85 49 __ STA T2 + 2
+1c15 : a5 1e __ LDA ACCU + 3
+1c17 : 85 4a __ STA T2 + 3
+1c19 : e6 50 __ INC T6 + 0
+1c1b : a5 50 __ LDA T6 + 0
+1c1d : c5 4e __ CMP T5 + 0
+1c1f : 90 c4 __ BCC $1be5
+1c21 : 4c 45 1b JMP $1b45 ; (nformf + 1337)
+1c24 : a5 44 __ LDA T0 + 1
+1c26 : 10 0e __ BPL $1c36
+1c28 : a5 44 __ LDA T0 + 1
+1c2a : 30 03 __ BMI $1c2f
+1c2c : 4c 1a 18 JMP $181a ; (nformf + 526)
+1c2f : a9 01 __ LDA #$01
+1c31 : 85 52 __ STA T8 + 0
+1c33 : 4c 32 1b JMP $1b32 ; (nformf + 1318)
+1c36 : d0 f7 __ BNE $1c2f
+1c38 : a9 03 __ LDA #$03
+1c3a : c5 43 __ CMP T0 + 0
+1c3c : 90 f1 __ BCC $1c2f
+1c3e : 4c 28 1c JMP $1c28 ; (nformf + 1564)
+1c41 : a9 01 __ LDA #$01
+1c43 : 4c 07 18 JMP $1807 ; (nformf + 507)
+1c46 : a5 14 __ LDA P7
+1c48 : 49 80 __ EOR #$80
+1c4a : 85 14 __ STA P7
+1c4c : a9 2d __ LDA #$2d
+1c4e : a0 00 __ LDY #$00
+1c50 : 91 0f __ STA (P2),y
+1c52 : a9 01 __ LDA #$01
+1c54 : 85 4b __ STA T3 + 0
+1c56 : 4c 42 16 JMP $1642 ; (nformf + 54)
+--------------------------------------------------------------------
+shuffle:
+1c5e : a0 04 __ LDY #$04
+1c60 : b1 23 __ LDA (SP + 0),y
+1c62 : 85 47 __ STA T0 + 0
+1c64 : c8 __ __ INY
+1c65 : b1 23 __ LDA (SP + 0),y
+1c67 : 30 04 __ BMI $1c6d
+1c69 : 05 47 __ ORA T0 + 0
+1c6b : d0 01 __ BNE $1c6e
+1c6d : 60 __ __ RTS
+1c6e : a0 02 __ LDY #$02
+1c70 : b1 23 __ LDA (SP + 0),y
+1c72 : 85 47 __ STA T0 + 0
+1c74 : 85 49 __ STA T2 + 0
+1c76 : c8 __ __ INY
+1c77 : b1 23 __ LDA (SP + 0),y
+1c79 : 85 48 __ STA T0 + 1
+1c7b : 85 4a __ STA T2 + 1
+1c7d : c8 __ __ INY
+1c7e : b1 23 __ LDA (SP + 0),y
+1c80 : 85 4b __ STA T3 + 0
+1c82 : 0a __ __ ASL
+1c83 : aa __ __ TAX
+1c84 : c8 __ __ INY
+1c85 : b1 23 __ LDA (SP + 0),y
+1c87 : 85 4c __ STA T3 + 1
+1c89 : 2a __ __ ROL
+1c8a : a8 __ __ TAY
+1c8b : 18 __ __ CLC
+1c8c : 8a __ __ TXA
+1c8d : 65 4b __ ADC T3 + 0
+1c8f : 85 1b __ STA ACCU + 0
+1c91 : 98 __ __ TYA
+1c92 : 65 4c __ ADC T3 + 1
+1c94 : 06 1b __ ASL ACCU + 0
+1c96 : 2a __ __ ROL
+1c97 : 06 1b __ ASL ACCU + 0
+1c99 : 2a __ __ ROL
+1c9a : 85 1c __ STA ACCU + 1
+1c9c : 18 __ __ CLC
+1c9d : a5 47 __ LDA T0 + 0
+1c9f : 65 1b __ ADC ACCU + 0
+1ca1 : 85 4d __ STA T4 + 0
+1ca3 : a5 48 __ LDA T0 + 1
+1ca5 : 65 1c __ ADC ACCU + 1
+1ca7 : 85 4e __ STA T4 + 1
+1ca9 : 20 24 1d JSR $1d24 ; (rand + 0)
+1cac : a5 1b __ LDA ACCU + 0
+1cae : 85 44 __ STA T6 + 0
+1cb0 : a5 1c __ LDA ACCU + 1
+1cb2 : 85 45 __ STA T6 + 1
+1cb4 : a0 0b __ LDY #$0b
+1cb6 : b1 49 __ LDA (T2 + 0),y
+1cb8 : 99 ba 53 STA $53ba,y ; (sframe + 0)
+1cbb : 88 __ __ DEY
+1cbc : 10 f8 __ BPL $1cb6
+1cbe : a5 44 __ LDA T6 + 0
+1cc0 : 85 1b __ STA ACCU + 0
+1cc2 : a5 45 __ LDA T6 + 1
+1cc4 : 85 1c __ STA ACCU + 1
+1cc6 : a5 4b __ LDA T3 + 0
+1cc8 : 85 03 __ STA $03
+1cca : a5 4c __ LDA T3 + 1
+1ccc : 85 04 __ STA $04
+1cce : 20 f3 22 JSR $22f3 ; (divmod + 0)
+1cd1 : a5 05 __ LDA $05
+1cd3 : 0a __ __ ASL
+1cd4 : aa __ __ TAX
+1cd5 : a5 06 __ LDA $06
+1cd7 : 2a __ __ ROL
+1cd8 : a8 __ __ TAY
+1cd9 : 18 __ __ CLC
+1cda : 8a __ __ TXA
+1cdb : 65 05 __ ADC $05
+1cdd : 85 1b __ STA ACCU + 0
+1cdf : 98 __ __ TYA
+1ce0 : 65 06 __ ADC $06
+1ce2 : 06 1b __ ASL ACCU + 0
+1ce4 : 2a __ __ ROL
+1ce5 : 06 1b __ ASL ACCU + 0
+1ce7 : 2a __ __ ROL
+1ce8 : 85 1c __ STA ACCU + 1
+1cea : 18 __ __ CLC
+1ceb : a5 47 __ LDA T0 + 0
+1ced : 65 1b __ ADC ACCU + 0
+1cef : 85 44 __ STA T6 + 0
+1cf1 : a5 48 __ LDA T0 + 1
+1cf3 : 65 1c __ ADC ACCU + 1
+1cf5 : 85 45 __ STA T6 + 1
+1cf7 : a0 0b __ LDY #$0b
+1cf9 : b1 44 __ LDA (T6 + 0),y
+1cfb : 91 49 __ STA (T2 + 0),y
+1cfd : 88 __ __ DEY
+1cfe : 10 f9 __ BPL $1cf9
+1d00 : a0 0b __ LDY #$0b
+1d02 : b9 ba 53 LDA $53ba,y ; (sframe + 0)
+1d05 : 91 44 __ STA (T6 + 0),y
+1d07 : 88 __ __ DEY
+1d08 : 10 f8 __ BPL $1d02
+1d0a : 18 __ __ CLC
+1d0b : a5 49 __ LDA T2 + 0
+1d0d : 69 0c __ ADC #$0c
+1d0f : 85 49 __ STA T2 + 0
+1d11 : a5 4a __ LDA T2 + 1
+1d13 : 69 00 __ ADC #$00
+1d15 : 85 4a __ STA T2 + 1
+1d17 : c5 4e __ CMP T4 + 1
+1d19 : d0 04 __ BNE $1d1f
+1d1b : a5 49 __ LDA T2 + 0
+1d1d : c5 4d __ CMP T4 + 0
+1d1f : 90 88 __ BCC $1ca9
+1d21 : 4c 6d 1c JMP $1c6d ; (shuffle + 15)
+--------------------------------------------------------------------
+rand:
+1d24 : ad d9 24 LDA $24d9 ; (seed + 1)
+1d27 : 4a __ __ LSR
+1d28 : ad d8 24 LDA $24d8 ; (seed + 0)
+1d2b : 6a __ __ ROR
+1d2c : aa __ __ TAX
+1d2d : a9 00 __ LDA #$00
+1d2f : 6a __ __ ROR
+1d30 : 4d d8 24 EOR $24d8 ; (seed + 0)
+1d33 : 85 43 __ STA T0 + 0
+1d35 : 8a __ __ TXA
+1d36 : 4d d9 24 EOR $24d9 ; (seed + 1)
+1d39 : 85 44 __ STA T0 + 1
+1d3b : 4a __ __ LSR
+1d3c : 45 43 __ EOR T0 + 0
+1d3e : aa __ __ TAX
+1d3f : 85 1b __ STA ACCU + 0
+1d41 : 45 44 __ EOR T0 + 1
+1d43 : a8 __ __ TAY
+1d44 : 8e d8 24 STX $24d8 ; (seed + 0)
+1d47 : 98 __ __ TYA
+1d48 : 84 1c __ STY ACCU + 1
+1d4a : 8d d9 24 STA $24d9 ; (seed + 1)
+1d4d : 60 __ __ RTS
+--------------------------------------------------------------------
+qsort:
+1d4e : 38 __ __ SEC
+1d4f : a5 23 __ LDA SP + 0
+1d51 : e9 12 __ SBC #$12
+1d53 : 85 23 __ STA SP + 0
+1d55 : a5 24 __ LDA SP + 1
+1d57 : e9 00 __ SBC #$00
+1d59 : 85 24 __ STA SP + 1
+1d5b : a0 03 __ LDY #$03
+1d5d : b9 53 00 LDA $0053,y 
+1d60 : 91 23 __ STA (SP + 0),y
+1d62 : 88 __ __ DEY
+1d63 : 10 f8 __ BPL $1d5d
+1d65 : 38 __ __ SEC
+1d66 : a5 23 __ LDA SP + 0
+1d68 : e9 06 __ SBC #$06
+1d6a : 85 23 __ STA SP + 0
+1d6c : a5 24 __ LDA SP + 1
+1d6e : e9 00 __ SBC #$00
+1d70 : 85 24 __ STA SP + 1
+1d72 : a0 1c __ LDY #$1c
+1d74 : b1 23 __ LDA (SP + 0),y
+1d76 : 85 53 __ STA T0 + 0
+1d78 : c8 __ __ INY
+1d79 : b1 23 __ LDA (SP + 0),y
+1d7b : 85 54 __ STA T0 + 1
+1d7d : 10 25 __ BPL $1da4
+1d7f : 18 __ __ CLC
+1d80 : a5 23 __ LDA SP + 0
+1d82 : 69 06 __ ADC #$06
+1d84 : 85 23 __ STA SP + 0
+1d86 : a5 24 __ LDA SP + 1
+1d88 : 69 00 __ ADC #$00
+1d8a : 85 24 __ STA SP + 1
+1d8c : a0 03 __ LDY #$03
+1d8e : b1 23 __ LDA (SP + 0),y
+1d90 : 99 53 00 STA $0053,y 
+1d93 : 88 __ __ DEY
+1d94 : 10 f8 __ BPL $1d8e
+1d96 : 18 __ __ CLC
+1d97 : a5 23 __ LDA SP + 0
+1d99 : 69 12 __ ADC #$12
+1d9b : 85 23 __ STA SP + 0
+1d9d : a5 24 __ LDA SP + 1
+1d9f : 69 00 __ ADC #$00
+1da1 : 85 24 __ STA SP + 1
+1da3 : 60 __ __ RTS
+1da4 : d0 06 __ BNE $1dac
+1da6 : a9 01 __ LDA #$01
+1da8 : c5 53 __ CMP T0 + 0
+1daa : b0 d3 __ BCS $1d7f
+1dac : 18 __ __ CLC
+1dad : a5 23 __ LDA SP + 0
+1daf : 69 0a __ ADC #$0a
+1db1 : 85 55 __ STA T2 + 0
+1db3 : a5 24 __ LDA SP + 1
+1db5 : 69 00 __ ADC #$00
+1db7 : 85 56 __ STA T2 + 1
+1db9 : a0 1a __ LDY #$1a
+1dbb : b1 23 __ LDA (SP + 0),y
+1dbd : 85 44 __ STA T3 + 0
+1dbf : c8 __ __ INY
+1dc0 : b1 23 __ LDA (SP + 0),y
+1dc2 : 85 45 __ STA T3 + 1
+1dc4 : a0 0b __ LDY #$0b
+1dc6 : b1 44 __ LDA (T3 + 0),y
+1dc8 : 91 55 __ STA (T2 + 0),y
+1dca : 88 __ __ DEY
+1dcb : 10 f9 __ BPL $1dc6
+1dcd : a9 00 __ LDA #$00
+1dcf : 85 55 __ STA T2 + 0
+1dd1 : 85 56 __ STA T2 + 1
+1dd3 : a5 54 __ LDA T0 + 1
+1dd5 : 30 03 __ BMI $1dda
+1dd7 : 4c 9c 1e JMP $1e9c ; (qsort + 334)
+1dda : a0 1a __ LDY #$1a
+1ddc : b1 23 __ LDA (SP + 0),y
+1dde : 85 53 __ STA T0 + 0
+1de0 : c8 __ __ INY
+1de1 : b1 23 __ LDA (SP + 0),y
+1de3 : 85 54 __ STA T0 + 1
+1de5 : a5 55 __ LDA T2 + 0
+1de7 : 0a __ __ ASL
+1de8 : aa __ __ TAX
+1de9 : a5 56 __ LDA T2 + 1
+1deb : 2a __ __ ROL
+1dec : a8 __ __ TAY
+1ded : 18 __ __ CLC
+1dee : 8a __ __ TXA
+1def : 65 55 __ ADC T2 + 0
+1df1 : 85 1b __ STA ACCU + 0
+1df3 : 98 __ __ TYA
+1df4 : 65 56 __ ADC T2 + 1
+1df6 : 06 1b __ ASL ACCU + 0
+1df8 : 2a __ __ ROL
+1df9 : 06 1b __ ASL ACCU + 0
+1dfb : 2a __ __ ROL
+1dfc : 85 1c __ STA ACCU + 1
+1dfe : 18 __ __ CLC
+1dff : a5 53 __ LDA T0 + 0
+1e01 : 65 1b __ ADC ACCU + 0
+1e03 : 85 44 __ STA T3 + 0
+1e05 : a5 54 __ LDA T0 + 1
+1e07 : 65 1c __ ADC ACCU + 1
+1e09 : 85 45 __ STA T3 + 1
+1e0b : 18 __ __ CLC
+1e0c : a5 23 __ LDA SP + 0
+1e0e : 69 0a __ ADC #$0a
+1e10 : 85 46 __ STA T4 + 0
+1e12 : a5 24 __ LDA SP + 1
+1e14 : 69 00 __ ADC #$00
+1e16 : 85 47 __ STA T4 + 1
+1e18 : a0 0b __ LDY #$0b
+1e1a : b1 46 __ LDA (T4 + 0),y
+1e1c : 91 44 __ STA (T3 + 0),y
+1e1e : 88 __ __ DEY
+1e1f : 10 f9 __ BPL $1e1a
+1e21 : a5 53 __ LDA T0 + 0
+1e23 : a0 02 __ LDY #$02
+1e25 : 91 23 __ STA (SP + 0),y
+1e27 : a5 54 __ LDA T0 + 1
+1e29 : c8 __ __ INY
+1e2a : 91 23 __ STA (SP + 0),y
+1e2c : a5 55 __ LDA T2 + 0
+1e2e : c8 __ __ INY
+1e2f : 91 23 __ STA (SP + 0),y
+1e31 : a5 56 __ LDA T2 + 1
+1e33 : c8 __ __ INY
+1e34 : 91 23 __ STA (SP + 0),y
+1e36 : 20 4e 1d JSR $1d4e ; (qsort + 0)
+1e39 : a0 1a __ LDY #$1a
+1e3b : b1 23 __ LDA (SP + 0),y
+1e3d : 85 53 __ STA T0 + 0
+1e3f : c8 __ __ INY
+1e40 : b1 23 __ LDA (SP + 0),y
+1e42 : 85 54 __ STA T0 + 1
+1e44 : a5 55 __ LDA T2 + 0
+1e46 : 0a __ __ ASL
+1e47 : aa __ __ TAX
+1e48 : a5 56 __ LDA T2 + 1
+1e4a : 2a __ __ ROL
+1e4b : a8 __ __ TAY
+1e4c : 18 __ __ CLC
+1e4d : 8a __ __ TXA
+1e4e : 65 55 __ ADC T2 + 0
+1e50 : 85 1b __ STA ACCU + 0
+1e52 : 98 __ __ TYA
+1e53 : 65 56 __ ADC T2 + 1
+1e55 : 06 1b __ ASL ACCU + 0
+1e57 : 2a __ __ ROL
+1e58 : 06 1b __ ASL ACCU + 0
+1e5a : 2a __ __ ROL
+1e5b : 85 1c __ STA ACCU + 1
+1e5d : 18 __ __ CLC
+1e5e : a5 53 __ LDA T0 + 0
+1e60 : 65 1b __ ADC ACCU + 0
+1e62 : aa __ __ TAX
+1e63 : a5 54 __ LDA T0 + 1
+1e65 : 65 1c __ ADC ACCU + 1
+1e67 : 85 54 __ STA T0 + 1
+1e69 : 18 __ __ CLC
+1e6a : 8a __ __ TXA
+1e6b : 69 0c __ ADC #$0c
+1e6d : a0 02 __ LDY #$02
+1e6f : 91 23 __ STA (SP + 0),y
+1e71 : a5 54 __ LDA T0 + 1
+1e73 : 69 00 __ ADC #$00
+1e75 : c8 __ __ INY
+1e76 : 91 23 __ STA (SP + 0),y
+1e78 : a0 1c __ LDY #$1c
+1e7a : b1 23 __ LDA (SP + 0),y
+1e7c : 38 __ __ SEC
+1e7d : e5 55 __ SBC T2 + 0
+1e7f : aa __ __ TAX
+1e80 : c8 __ __ INY
+1e81 : b1 23 __ LDA (SP + 0),y
+1e83 : e5 56 __ SBC T2 + 1
+1e85 : 85 54 __ STA T0 + 1
+1e87 : 38 __ __ SEC
+1e88 : 8a __ __ TXA
+1e89 : e9 01 __ SBC #$01
+1e8b : a0 04 __ LDY #$04
+1e8d : 91 23 __ STA (SP + 0),y
+1e8f : a5 54 __ LDA T0 + 1
+1e91 : e9 00 __ SBC #$00
+1e93 : c8 __ __ INY
+1e94 : 91 23 __ STA (SP + 0),y
+1e96 : 20 4e 1d JSR $1d4e ; (qsort + 0)
+1e99 : 4c 7f 1d JMP $1d7f ; (qsort + 49)
+1e9c : d0 09 __ BNE $1ea7
+1e9e : a9 01 __ LDA #$01
+1ea0 : c5 53 __ CMP T0 + 0
+1ea2 : 90 03 __ BCC $1ea7
+1ea4 : 4c da 1d JMP $1dda ; (qsort + 140)
+1ea7 : a9 01 __ LDA #$01
+1ea9 : 85 53 __ STA T0 + 0
+1eab : a9 00 __ LDA #$00
+1ead : 85 54 __ STA T0 + 1
+1eaf : a0 1a __ LDY #$1a
+1eb1 : b1 23 __ LDA (SP + 0),y
+1eb3 : 85 44 __ STA T3 + 0
+1eb5 : c8 __ __ INY
+1eb6 : b1 23 __ LDA (SP + 0),y
+1eb8 : 85 45 __ STA T3 + 1
+1eba : a5 53 __ LDA T0 + 0
+1ebc : 0a __ __ ASL
+1ebd : aa __ __ TAX
+1ebe : a5 54 __ LDA T0 + 1
+1ec0 : 2a __ __ ROL
+1ec1 : a8 __ __ TAY
+1ec2 : 18 __ __ CLC
+1ec3 : 8a __ __ TXA
+1ec4 : 65 53 __ ADC T0 + 0
+1ec6 : 85 1b __ STA ACCU + 0
+1ec8 : 98 __ __ TYA
+1ec9 : 65 54 __ ADC T0 + 1
+1ecb : 06 1b __ ASL ACCU + 0
+1ecd : 2a __ __ ROL
+1ece : 06 1b __ ASL ACCU + 0
+1ed0 : 2a __ __ ROL
+1ed1 : 85 1c __ STA ACCU + 1
+1ed3 : 18 __ __ CLC
+1ed4 : a5 44 __ LDA T3 + 0
+1ed6 : 65 1b __ ADC ACCU + 0
+1ed8 : aa __ __ TAX
+1ed9 : a5 45 __ LDA T3 + 1
+1edb : 65 1c __ ADC ACCU + 1
+1edd : a8 __ __ TAY
+1ede : 18 __ __ CLC
+1edf : 8a __ __ TXA
+1ee0 : 69 02 __ ADC #$02
+1ee2 : 85 0d __ STA P0
+1ee4 : 98 __ __ TYA
+1ee5 : 69 00 __ ADC #$00
+1ee7 : 85 0e __ STA P1
+1ee9 : 18 __ __ CLC
+1eea : a5 23 __ LDA SP + 0
+1eec : 69 0c __ ADC #$0c
+1eee : 85 0f __ STA P2
+1ef0 : a5 24 __ LDA SP + 1
+1ef2 : 69 00 __ ADC #$00
+1ef4 : 85 10 __ STA P3
+1ef6 : 20 a1 1f JSR $1fa1 ; (strcmp + 0)
+1ef9 : a5 1c __ LDA ACCU + 1
+1efb : 30 24 __ BMI $1f21
+1efd : a0 1c __ LDY #$1c
+1eff : b1 23 __ LDA (SP + 0),y
+1f01 : 85 44 __ STA T3 + 0
+1f03 : c8 __ __ INY
+1f04 : b1 23 __ LDA (SP + 0),y
+1f06 : e6 53 __ INC T0 + 0
+1f08 : d0 02 __ BNE $1f0c
+1f0a : e6 54 __ INC T0 + 1
+1f0c : 49 80 __ EOR #$80
+1f0e : 85 03 __ STA $03
+1f10 : a5 54 __ LDA T0 + 1
+1f12 : 49 80 __ EOR #$80
+1f14 : c5 03 __ CMP $03
+1f16 : d0 04 __ BNE $1f1c
+1f18 : a5 53 __ LDA T0 + 0
+1f1a : c5 44 __ CMP T3 + 0
+1f1c : 90 91 __ BCC $1eaf
+1f1e : 4c da 1d JMP $1dda ; (qsort + 140)
+1f21 : a0 1a __ LDY #$1a
+1f23 : b1 23 __ LDA (SP + 0),y
+1f25 : 85 44 __ STA T3 + 0
+1f27 : c8 __ __ INY
+1f28 : b1 23 __ LDA (SP + 0),y
+1f2a : 85 45 __ STA T3 + 1
+1f2c : a5 55 __ LDA T2 + 0
+1f2e : 0a __ __ ASL
+1f2f : aa __ __ TAX
+1f30 : a5 56 __ LDA T2 + 1
+1f32 : 2a __ __ ROL
+1f33 : a8 __ __ TAY
+1f34 : 18 __ __ CLC
+1f35 : 8a __ __ TXA
+1f36 : 65 55 __ ADC T2 + 0
+1f38 : 85 1b __ STA ACCU + 0
+1f3a : 98 __ __ TYA
+1f3b : 65 56 __ ADC T2 + 1
+1f3d : 06 1b __ ASL ACCU + 0
+1f3f : 2a __ __ ROL
+1f40 : 06 1b __ ASL ACCU + 0
+1f42 : 2a __ __ ROL
+1f43 : 85 1c __ STA ACCU + 1
+1f45 : 18 __ __ CLC
+1f46 : a5 44 __ LDA T3 + 0
+1f48 : 65 1b __ ADC ACCU + 0
+1f4a : 85 46 __ STA T4 + 0
+1f4c : a5 45 __ LDA T3 + 1
+1f4e : 65 1c __ ADC ACCU + 1
+1f50 : 85 47 __ STA T4 + 1
+1f52 : a5 53 __ LDA T0 + 0
+1f54 : 0a __ __ ASL
+1f55 : aa __ __ TAX
+1f56 : a5 54 __ LDA T0 + 1
+1f58 : 2a __ __ ROL
+1f59 : a8 __ __ TAY
+1f5a : 18 __ __ CLC
+1f5b : 8a __ __ TXA
+1f5c : 65 53 __ ADC T0 + 0
+1f5e : 85 1b __ STA ACCU + 0
+1f60 : 98 __ __ TYA
+1f61 : 65 54 __ ADC T0 + 1
+1f63 : 06 1b __ ASL ACCU + 0
+1f65 : 2a __ __ ROL
+1f66 : 06 1b __ ASL ACCU + 0
+1f68 : 2a __ __ ROL
+1f69 : 85 1c __ STA ACCU + 1
+1f6b : 18 __ __ CLC
+1f6c : a5 44 __ LDA T3 + 0
+1f6e : 65 1b __ ADC ACCU + 0
+1f70 : 85 44 __ STA T3 + 0
+1f72 : a5 45 __ LDA T3 + 1
+1f74 : 65 1c __ ADC ACCU + 1
+1f76 : 85 45 __ STA T3 + 1
+1f78 : a0 0b __ LDY #$0b
+1f7a : b1 44 __ LDA (T3 + 0),y
+1f7c : 91 46 __ STA (T4 + 0),y
+1f7e : 88 __ __ DEY
+1f7f : 10 f9 __ BPL $1f7a
+1f81 : 18 __ __ CLC
+1f82 : a5 46 __ LDA T4 + 0
+1f84 : 69 0c __ ADC #$0c
+1f86 : 85 46 __ STA T4 + 0
+1f88 : 90 02 __ BCC $1f8c
+1f8a : e6 47 __ INC T4 + 1
+1f8c : a0 0b __ LDY #$0b
+1f8e : b1 46 __ LDA (T4 + 0),y
+1f90 : 91 44 __ STA (T3 + 0),y
+1f92 : 88 __ __ DEY
+1f93 : 10 f9 __ BPL $1f8e
+1f95 : e6 55 __ INC T2 + 0
+1f97 : f0 03 __ BEQ $1f9c
+1f99 : 4c fd 1e JMP $1efd ; (qsort + 431)
+1f9c : e6 56 __ INC T2 + 1
+1f9e : 4c fd 1e JMP $1efd ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+1fa1 : a0 00 __ LDY #$00
+1fa3 : 84 1c __ STY ACCU + 1
+1fa5 : b1 0d __ LDA (P0),y
+1fa7 : f0 16 __ BEQ $1fbf
+1fa9 : d1 0f __ CMP (P2),y
+1fab : d0 16 __ BNE $1fc3
+1fad : c8 __ __ INY
+1fae : b1 0d __ LDA (P0),y
+1fb0 : f0 0d __ BEQ $1fbf
+1fb2 : d1 0f __ CMP (P2),y
+1fb4 : d0 0d __ BNE $1fc3
+1fb6 : c8 __ __ INY
+1fb7 : d0 ec __ BNE $1fa5
+1fb9 : e6 0e __ INC P1
+1fbb : e6 10 __ INC P3
+1fbd : d0 e6 __ BNE $1fa5
+1fbf : d1 0f __ CMP (P2),y
+1fc1 : f0 0a __ BEQ $1fcd
+1fc3 : b0 06 __ BCS $1fcb
+1fc5 : a9 ff __ LDA #$ff
+1fc7 : 85 1c __ STA ACCU + 1
+1fc9 : 30 02 __ BMI $1fcd
+1fcb : a9 01 __ LDA #$01
+1fcd : 85 1b __ STA ACCU + 0
+1fcf : 60 __ __ RTS
+--------------------------------------------------------------------
+check:
+1fd0 : 38 __ __ SEC
+1fd1 : a5 23 __ LDA SP + 0
+1fd3 : e9 03 __ SBC #$03
+1fd5 : 85 23 __ STA SP + 0
+1fd7 : a5 24 __ LDA SP + 1
+1fd9 : e9 00 __ SBC #$00
+1fdb : 85 24 __ STA SP + 1
+1fdd : a0 07 __ LDY #$07
+1fdf : b1 23 __ LDA (SP + 0),y
+1fe1 : 85 44 __ STA T0 + 0
+1fe3 : c8 __ __ INY
+1fe4 : b1 23 __ LDA (SP + 0),y
+1fe6 : 30 04 __ BMI $1fec
+1fe8 : 05 44 __ ORA T0 + 0
+1fea : d0 0e __ BNE $1ffa
+1fec : 18 __ __ CLC
+1fed : a5 23 __ LDA SP + 0
+1fef : 69 03 __ ADC #$03
+1ff1 : 85 23 __ STA SP + 0
+1ff3 : a5 24 __ LDA SP + 1
+1ff5 : 69 00 __ ADC #$00
+1ff7 : 85 24 __ STA SP + 1
+1ff9 : 60 __ __ RTS
+1ffa : a9 00 __ LDA #$00
+1ffc : 85 44 __ STA T0 + 0
+1ffe : 85 45 __ STA T0 + 1
+2000 : a0 05 __ LDY #$05
+2002 : b1 23 __ LDA (SP + 0),y
+2004 : 85 46 __ STA T2 + 0
+2006 : c8 __ __ INY
+2007 : b1 23 __ LDA (SP + 0),y
+2009 : 85 47 __ STA T2 + 1
+200b : c8 __ __ INY
+200c : b1 23 __ LDA (SP + 0),y
+200e : 85 48 __ STA T3 + 0
+2010 : c8 __ __ INY
+2011 : b1 23 __ LDA (SP + 0),y
+2013 : 85 49 __ STA T3 + 1
+2015 : a0 00 __ LDY #$00
+2017 : b1 46 __ LDA (T2 + 0),y
+2019 : 85 4a __ STA T4 + 0
+201b : c8 __ __ INY
+201c : b1 46 __ LDA (T2 + 0),y
+201e : c5 45 __ CMP T0 + 1
+2020 : d0 06 __ BNE $2028
+2022 : a5 4a __ LDA T4 + 0
+2024 : c5 44 __ CMP T0 + 0
+2026 : f0 31 __ BEQ $2059
+2028 : a9 00 __ LDA #$00
+202a : a0 02 __ LDY #$02
+202c : 91 23 __ STA (SP + 0),y
+202e : 20 5e 20 JSR $205e ; (assert + 0)
+2031 : 18 __ __ CLC
+2032 : a5 46 __ LDA T2 + 0
+2034 : 69 0c __ ADC #$0c
+2036 : 85 46 __ STA T2 + 0
+2038 : 90 02 __ BCC $203c
+203a : e6 47 __ INC T2 + 1
+203c : e6 44 __ INC T0 + 0
+203e : d0 02 __ BNE $2042
+2040 : e6 45 __ INC T0 + 1
+2042 : a5 49 __ LDA T3 + 1
+2044 : 49 80 __ EOR #$80
+2046 : 85 03 __ STA $03
+2048 : a5 45 __ LDA T0 + 1
+204a : 49 80 __ EOR #$80
+204c : c5 03 __ CMP $03
+204e : d0 04 __ BNE $2054
+2050 : a5 44 __ LDA T0 + 0
+2052 : c5 48 __ CMP T3 + 0
+2054 : 90 bf __ BCC $2015
+2056 : 4c ec 1f JMP $1fec ; (check + 28)
+2059 : a9 01 __ LDA #$01
+205b : 4c 2a 20 JMP $202a ; (check + 90)
+--------------------------------------------------------------------
+assert:
+205e : a0 02 __ LDY #$02
+2060 : b1 23 __ LDA (SP + 0),y
+2062 : d0 09 __ BNE $206d
+2064 : a9 ff __ LDA #$ff
+2066 : 85 0d __ STA P0
+2068 : 85 0e __ STA P1
+206a : 20 6e 20 JSR $206e ; (exit + 0)
+206d : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+206e : a5 0d __ LDA P0
+2070 : 85 1b __ STA ACCU + 0
+2072 : a5 0e __ LDA P1
+2074 : 85 1c __ STA ACCU + 1
+2076 : ae d6 24 LDX $24d6 ; (spentry + 0)
+2079 : 9a __ __ TXS
+207a : a9 4c __ LDA #$4c
+207c : 85 54 __ STA $54
+207e : a9 00 __ LDA #$00
+2080 : 85 13 __ STA P6
+2082 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+2083 : a9 4c __ LDA #$4c
+2085 : 85 54 __ STA $54
+2087 : a9 00 __ LDA #$00
+2089 : 85 13 __ STA P6
+208b : a9 19 __ LDA #$19
+208d : 85 16 __ STA P9
+208f : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+2090 : b1 19 __ LDA (IP + 0),y
+2092 : c8 __ __ INY
+2093 : aa __ __ TAX
+2094 : b5 00 __ LDA $00,x
+2096 : 85 03 __ STA $03
+2098 : b5 01 __ LDA $01,x
+209a : 85 04 __ STA $04
+209c : b5 02 __ LDA $02,x
+209e : 85 05 __ STA $05
+20a0 : b5 03 __ LDA $03,x
+20a2 : 85 06 __ STA $06
+20a4 : a5 05 __ LDA $05
+20a6 : 0a __ __ ASL
+20a7 : a5 06 __ LDA $06
+20a9 : 2a __ __ ROL
+20aa : 85 08 __ STA $08
+20ac : f0 06 __ BEQ $20b4
+20ae : a5 05 __ LDA $05
+20b0 : 09 80 __ ORA #$80
+20b2 : 85 05 __ STA $05
+20b4 : a5 1d __ LDA ACCU + 2
+20b6 : 0a __ __ ASL
+20b7 : a5 1e __ LDA ACCU + 3
+20b9 : 2a __ __ ROL
+20ba : 85 07 __ STA $07
+20bc : f0 06 __ BEQ $20c4
+20be : a5 1d __ LDA ACCU + 2
+20c0 : 09 80 __ ORA #$80
+20c2 : 85 1d __ STA ACCU + 2
+20c4 : 60 __ __ RTS
+20c5 : 06 1e __ ASL ACCU + 3
+20c7 : a5 07 __ LDA $07
+20c9 : 6a __ __ ROR
+20ca : 85 1e __ STA ACCU + 3
+20cc : b0 06 __ BCS $20d4
+20ce : a5 1d __ LDA ACCU + 2
+20d0 : 29 7f __ AND #$7f
+20d2 : 85 1d __ STA ACCU + 2
+20d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+20d5 : 38 __ __ SEC
+20d6 : a5 07 __ LDA $07
+20d8 : e5 08 __ SBC $08
+20da : f0 38 __ BEQ $2114
+20dc : aa __ __ TAX
+20dd : b0 25 __ BCS $2104
+20df : e0 e9 __ CPX #$e9
+20e1 : b0 0e __ BCS $20f1
+20e3 : a5 08 __ LDA $08
+20e5 : 85 07 __ STA $07
+20e7 : a9 00 __ LDA #$00
+20e9 : 85 1b __ STA ACCU + 0
+20eb : 85 1c __ STA ACCU + 1
+20ed : 85 1d __ STA ACCU + 2
+20ef : f0 23 __ BEQ $2114
+20f1 : a5 1d __ LDA ACCU + 2
+20f3 : 4a __ __ LSR
+20f4 : 66 1c __ ROR ACCU + 1
+20f6 : 66 1b __ ROR ACCU + 0
+20f8 : e8 __ __ INX
+20f9 : d0 f8 __ BNE $20f3
+20fb : 85 1d __ STA ACCU + 2
+20fd : a5 08 __ LDA $08
+20ff : 85 07 __ STA $07
+2101 : 4c 14 21 JMP $2114 ; (faddsub + 63)
+2104 : e0 18 __ CPX #$18
+2106 : b0 33 __ BCS $213b
+2108 : a5 05 __ LDA $05
+210a : 4a __ __ LSR
+210b : 66 04 __ ROR $04
+210d : 66 03 __ ROR $03
+210f : ca __ __ DEX
+2110 : d0 f8 __ BNE $210a
+2112 : 85 05 __ STA $05
+2114 : a5 1e __ LDA ACCU + 3
+2116 : 29 80 __ AND #$80
+2118 : 85 1e __ STA ACCU + 3
+211a : 45 06 __ EOR $06
+211c : 30 2d __ BMI $214b
+211e : 18 __ __ CLC
+211f : a5 1b __ LDA ACCU + 0
+2121 : 65 03 __ ADC $03
+2123 : 85 1b __ STA ACCU + 0
+2125 : a5 1c __ LDA ACCU + 1
+2127 : 65 04 __ ADC $04
+2129 : 85 1c __ STA ACCU + 1
+212b : a5 1d __ LDA ACCU + 2
+212d : 65 05 __ ADC $05
+212f : 85 1d __ STA ACCU + 2
+2131 : 90 08 __ BCC $213b
+2133 : 66 1d __ ROR ACCU + 2
+2135 : 66 1c __ ROR ACCU + 1
+2137 : 66 1b __ ROR ACCU + 0
+2139 : e6 07 __ INC $07
+213b : a5 07 __ LDA $07
+213d : 4a __ __ LSR
+213e : 05 1e __ ORA ACCU + 3
+2140 : 85 1e __ STA ACCU + 3
+2142 : b0 06 __ BCS $214a
+2144 : a5 1d __ LDA ACCU + 2
+2146 : 29 7f __ AND #$7f
+2148 : 85 1d __ STA ACCU + 2
+214a : 60 __ __ RTS
+214b : 38 __ __ SEC
+214c : a5 1b __ LDA ACCU + 0
+214e : e5 03 __ SBC $03
+2150 : 85 1b __ STA ACCU + 0
+2152 : a5 1c __ LDA ACCU + 1
+2154 : e5 04 __ SBC $04
+2156 : 85 1c __ STA ACCU + 1
+2158 : a5 1d __ LDA ACCU + 2
+215a : e5 05 __ SBC $05
+215c : 85 1d __ STA ACCU + 2
+215e : b0 19 __ BCS $2179
+2160 : 38 __ __ SEC
+2161 : a9 00 __ LDA #$00
+2163 : e5 1b __ SBC ACCU + 0
+2165 : 85 1b __ STA ACCU + 0
+2167 : a9 00 __ LDA #$00
+2169 : e5 1c __ SBC ACCU + 1
+216b : 85 1c __ STA ACCU + 1
+216d : a9 00 __ LDA #$00
+216f : e5 1d __ SBC ACCU + 2
+2171 : 85 1d __ STA ACCU + 2
+2173 : a5 1e __ LDA ACCU + 3
+2175 : 49 80 __ EOR #$80
+2177 : 85 1e __ STA ACCU + 3
+2179 : a5 1d __ LDA ACCU + 2
+217b : 30 be __ BMI $213b
+217d : 05 1c __ ORA ACCU + 1
+217f : 05 1b __ ORA ACCU + 0
+2181 : f0 0f __ BEQ $2192
+2183 : c6 07 __ DEC $07
+2185 : f0 0b __ BEQ $2192
+2187 : 06 1b __ ASL ACCU + 0
+2189 : 26 1c __ ROL ACCU + 1
+218b : 26 1d __ ROL ACCU + 2
+218d : 10 f4 __ BPL $2183
+218f : 4c 3b 21 JMP $213b ; (faddsub + 102)
+2192 : a9 00 __ LDA #$00
+2194 : 85 1b __ STA ACCU + 0
+2196 : 85 1c __ STA ACCU + 1
+2198 : 85 1d __ STA ACCU + 2
+219a : 85 1e __ STA ACCU + 3
+219c : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+219d : a5 1b __ LDA ACCU + 0
+219f : 05 1c __ ORA ACCU + 1
+21a1 : 05 1d __ ORA ACCU + 2
+21a3 : d0 03 __ BNE $21a8
+21a5 : 85 1e __ STA ACCU + 3
+21a7 : 60 __ __ RTS
+21a8 : a5 03 __ LDA $03
+21aa : 05 04 __ ORA $04
+21ac : 05 05 __ ORA $05
+21ae : d0 09 __ BNE $21b9
+21b0 : 85 1b __ STA ACCU + 0
+21b2 : 85 1c __ STA ACCU + 1
+21b4 : 85 1d __ STA ACCU + 2
+21b6 : 85 1e __ STA ACCU + 3
+21b8 : 60 __ __ RTS
+21b9 : a9 00 __ LDA #$00
+21bb : 85 09 __ STA $09
+21bd : 85 0a __ STA $0a
+21bf : 85 0b __ STA $0b
+21c1 : a4 1b __ LDY ACCU + 0
+21c3 : a5 03 __ LDA $03
+21c5 : d0 06 __ BNE $21cd
+21c7 : a5 04 __ LDA $04
+21c9 : f0 0a __ BEQ $21d5
+21cb : d0 05 __ BNE $21d2
+21cd : 20 0d 22 JSR $220d ; (fmul8 + 0)
+21d0 : a5 04 __ LDA $04
+21d2 : 20 0d 22 JSR $220d ; (fmul8 + 0)
+21d5 : a5 05 __ LDA $05
+21d7 : 20 0d 22 JSR $220d ; (fmul8 + 0)
+21da : 38 __ __ SEC
+21db : a5 0b __ LDA $0b
+21dd : 30 06 __ BMI $21e5
+21df : 06 09 __ ASL $09
+21e1 : 26 0a __ ROL $0a
+21e3 : 2a __ __ ROL
+21e4 : 18 __ __ CLC
+21e5 : 29 7f __ AND #$7f
+21e7 : 85 0b __ STA $0b
+21e9 : a5 1e __ LDA ACCU + 3
+21eb : 45 06 __ EOR $06
+21ed : 29 80 __ AND #$80
+21ef : 85 1e __ STA ACCU + 3
+21f1 : a5 07 __ LDA $07
+21f3 : e9 7e __ SBC #$7e
+21f5 : 18 __ __ CLC
+21f6 : 65 08 __ ADC $08
+21f8 : 4a __ __ LSR
+21f9 : 05 1e __ ORA ACCU + 3
+21fb : 85 1e __ STA ACCU + 3
+21fd : a9 00 __ LDA #$00
+21ff : 6a __ __ ROR
+2200 : 05 0b __ ORA $0b
+2202 : 85 1d __ STA ACCU + 2
+2204 : a5 0a __ LDA $0a
+2206 : 85 1c __ STA ACCU + 1
+2208 : a5 09 __ LDA $09
+220a : 85 1b __ STA ACCU + 0
+220c : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+220d : 38 __ __ SEC
+220e : 6a __ __ ROR
+220f : 90 1e __ BCC $222f
+2211 : aa __ __ TAX
+2212 : 18 __ __ CLC
+2213 : 98 __ __ TYA
+2214 : 65 09 __ ADC $09
+2216 : 85 09 __ STA $09
+2218 : a5 0a __ LDA $0a
+221a : 65 1c __ ADC ACCU + 1
+221c : 85 0a __ STA $0a
+221e : a5 0b __ LDA $0b
+2220 : 65 1d __ ADC ACCU + 2
+2222 : 6a __ __ ROR
+2223 : 85 0b __ STA $0b
+2225 : 8a __ __ TXA
+2226 : 66 0a __ ROR $0a
+2228 : 66 09 __ ROR $09
+222a : 4a __ __ LSR
+222b : f0 0d __ BEQ $223a
+222d : b0 e2 __ BCS $2211
+222f : 66 0b __ ROR $0b
+2231 : 66 0a __ ROR $0a
+2233 : 66 09 __ ROR $09
+2235 : 4a __ __ LSR
+2236 : 90 f7 __ BCC $222f
+2238 : d0 d7 __ BNE $2211
+223a : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+223b : a5 1b __ LDA ACCU + 0
+223d : 05 1c __ ORA ACCU + 1
+223f : 05 1d __ ORA ACCU + 2
+2241 : d0 03 __ BNE $2246
+2243 : 85 1e __ STA ACCU + 3
+2245 : 60 __ __ RTS
+2246 : a5 1e __ LDA ACCU + 3
+2248 : 45 06 __ EOR $06
+224a : 29 80 __ AND #$80
+224c : 85 1e __ STA ACCU + 3
+224e : a9 00 __ LDA #$00
+2250 : 85 09 __ STA $09
+2252 : 85 0a __ STA $0a
+2254 : 85 0b __ STA $0b
+2256 : a2 18 __ LDX #$18
+2258 : a5 1b __ LDA ACCU + 0
+225a : c5 03 __ CMP $03
+225c : a5 1c __ LDA ACCU + 1
+225e : e5 04 __ SBC $04
+2260 : a5 1d __ LDA ACCU + 2
+2262 : e5 05 __ SBC $05
+2264 : 90 13 __ BCC $2279
+2266 : a5 1b __ LDA ACCU + 0
+2268 : e5 03 __ SBC $03
+226a : 85 1b __ STA ACCU + 0
+226c : a5 1c __ LDA ACCU + 1
+226e : e5 04 __ SBC $04
+2270 : 85 1c __ STA ACCU + 1
+2272 : a5 1d __ LDA ACCU + 2
+2274 : e5 05 __ SBC $05
+2276 : 85 1d __ STA ACCU + 2
+2278 : 38 __ __ SEC
+2279 : 26 09 __ ROL $09
+227b : 26 0a __ ROL $0a
+227d : 26 0b __ ROL $0b
+227f : ca __ __ DEX
+2280 : f0 0a __ BEQ $228c
+2282 : 06 1b __ ASL ACCU + 0
+2284 : 26 1c __ ROL ACCU + 1
+2286 : 26 1d __ ROL ACCU + 2
+2288 : b0 dc __ BCS $2266
+228a : 90 cc __ BCC $2258
+228c : 38 __ __ SEC
+228d : a5 0b __ LDA $0b
+228f : 30 06 __ BMI $2297
+2291 : 06 09 __ ASL $09
+2293 : 26 0a __ ROL $0a
+2295 : 2a __ __ ROL
+2296 : 18 __ __ CLC
+2297 : 29 7f __ AND #$7f
+2299 : 85 0b __ STA $0b
+229b : a5 08 __ LDA $08
+229d : 49 7f __ EOR #$7f
+229f : 65 07 __ ADC $07
+22a1 : 38 __ __ SEC
+22a2 : e9 01 __ SBC #$01
+22a4 : 4a __ __ LSR
+22a5 : 05 1e __ ORA ACCU + 3
+22a7 : 85 1e __ STA ACCU + 3
+22a9 : a9 00 __ LDA #$00
+22ab : 6a __ __ ROR
+22ac : 05 0b __ ORA $0b
+22ae : 85 1d __ STA ACCU + 2
+22b0 : a5 0a __ LDA $0a
+22b2 : 85 1c __ STA ACCU + 1
+22b4 : a5 09 __ LDA $09
+22b6 : 85 1b __ STA ACCU + 0
+22b8 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+22b9 : 24 1c __ BIT ACCU + 1
+22bb : 10 0d __ BPL $22ca
+22bd : 20 d7 22 JSR $22d7 ; (negaccu + 0)
+22c0 : 24 04 __ BIT $04
+22c2 : 10 0d __ BPL $22d1
+22c4 : 20 e5 22 JSR $22e5 ; (negtmp + 0)
+22c7 : 4c f3 22 JMP $22f3 ; (divmod + 0)
+22ca : 24 04 __ BIT $04
+22cc : 10 f9 __ BPL $22c7
+22ce : 20 e5 22 JSR $22e5 ; (negtmp + 0)
+22d1 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+22d4 : 4c d7 22 JMP $22d7 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+22d7 : 38 __ __ SEC
+22d8 : a9 00 __ LDA #$00
+22da : e5 1b __ SBC ACCU + 0
+22dc : 85 1b __ STA ACCU + 0
+22de : a9 00 __ LDA #$00
+22e0 : e5 1c __ SBC ACCU + 1
+22e2 : 85 1c __ STA ACCU + 1
+22e4 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+22e5 : 38 __ __ SEC
+22e6 : a9 00 __ LDA #$00
+22e8 : e5 03 __ SBC $03
+22ea : 85 03 __ STA $03
+22ec : a9 00 __ LDA #$00
+22ee : e5 04 __ SBC $04
+22f0 : 85 04 __ STA $04
+22f2 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+22f3 : a5 1c __ LDA ACCU + 1
+22f5 : d0 31 __ BNE $2328
+22f7 : a5 04 __ LDA $04
+22f9 : d0 1e __ BNE $2319
+22fb : 85 06 __ STA $06
+22fd : a2 04 __ LDX #$04
+22ff : 06 1b __ ASL ACCU + 0
+2301 : 2a __ __ ROL
+2302 : c5 03 __ CMP $03
+2304 : 90 02 __ BCC $2308
+2306 : e5 03 __ SBC $03
+2308 : 26 1b __ ROL ACCU + 0
+230a : 2a __ __ ROL
+230b : c5 03 __ CMP $03
+230d : 90 02 __ BCC $2311
+230f : e5 03 __ SBC $03
+2311 : 26 1b __ ROL ACCU + 0
+2313 : ca __ __ DEX
+2314 : d0 eb __ BNE $2301
+2316 : 85 05 __ STA $05
+2318 : 60 __ __ RTS
+2319 : a5 1b __ LDA ACCU + 0
+231b : 85 05 __ STA $05
+231d : a5 1c __ LDA ACCU + 1
+231f : 85 06 __ STA $06
+2321 : a9 00 __ LDA #$00
+2323 : 85 1b __ STA ACCU + 0
+2325 : 85 1c __ STA ACCU + 1
+2327 : 60 __ __ RTS
+2328 : a5 04 __ LDA $04
+232a : d0 1f __ BNE $234b
+232c : a5 03 __ LDA $03
+232e : 30 1b __ BMI $234b
+2330 : a9 00 __ LDA #$00
+2332 : 85 06 __ STA $06
+2334 : a2 10 __ LDX #$10
+2336 : 06 1b __ ASL ACCU + 0
+2338 : 26 1c __ ROL ACCU + 1
+233a : 2a __ __ ROL
+233b : c5 03 __ CMP $03
+233d : 90 02 __ BCC $2341
+233f : e5 03 __ SBC $03
+2341 : 26 1b __ ROL ACCU + 0
+2343 : 26 1c __ ROL ACCU + 1
+2345 : ca __ __ DEX
+2346 : d0 f2 __ BNE $233a
+2348 : 85 05 __ STA $05
+234a : 60 __ __ RTS
+234b : a9 00 __ LDA #$00
+234d : 85 05 __ STA $05
+234f : 85 06 __ STA $06
+2351 : 84 02 __ STY $02
+2353 : a0 10 __ LDY #$10
+2355 : 18 __ __ CLC
+2356 : 26 1b __ ROL ACCU + 0
+2358 : 26 1c __ ROL ACCU + 1
+235a : 26 05 __ ROL $05
+235c : 26 06 __ ROL $06
+235e : 38 __ __ SEC
+235f : a5 05 __ LDA $05
+2361 : e5 03 __ SBC $03
+2363 : aa __ __ TAX
+2364 : a5 06 __ LDA $06
+2366 : e5 04 __ SBC $04
+2368 : 90 04 __ BCC $236e
+236a : 86 05 __ STX $05
+236c : 85 06 __ STA $06
+236e : 88 __ __ DEY
+236f : d0 e5 __ BNE $2356
+2371 : 26 1b __ ROL ACCU + 0
+2373 : 26 1c __ ROL ACCU + 1
+2375 : a4 02 __ LDY $02
+2377 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2378 : 24 1c __ BIT ACCU + 1
+237a : 10 0d __ BPL $2389
+237c : 20 d7 22 JSR $22d7 ; (negaccu + 0)
+237f : 24 04 __ BIT $04
+2381 : 10 0d __ BPL $2390
+2383 : 20 e5 22 JSR $22e5 ; (negtmp + 0)
+2386 : 4c f3 22 JMP $22f3 ; (divmod + 0)
+2389 : 24 04 __ BIT $04
+238b : 10 f9 __ BPL $2386
+238d : 20 e5 22 JSR $22e5 ; (negtmp + 0)
+2390 : 20 f3 22 JSR $22f3 ; (divmod + 0)
+2393 : 38 __ __ SEC
+2394 : a9 00 __ LDA #$00
+2396 : e5 05 __ SBC $05
+2398 : 85 05 __ STA $05
+239a : a9 00 __ LDA #$00
+239c : e5 06 __ SBC $06
+239e : 85 06 __ STA $06
+23a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+23a1 : 20 b4 20 JSR $20b4 ; (freg + 36)
+23a4 : a5 07 __ LDA $07
+23a6 : c9 7f __ CMP #$7f
+23a8 : b0 07 __ BCS $23b1
+23aa : a9 00 __ LDA #$00
+23ac : 85 1b __ STA ACCU + 0
+23ae : 85 1c __ STA ACCU + 1
+23b0 : 60 __ __ RTS
+23b1 : 38 __ __ SEC
+23b2 : e9 8e __ SBC #$8e
+23b4 : 90 0a __ BCC $23c0
+23b6 : a9 ff __ LDA #$ff
+23b8 : 85 1b __ STA ACCU + 0
+23ba : a9 7f __ LDA #$7f
+23bc : 85 1c __ STA ACCU + 1
+23be : d0 08 __ BNE $23c8
+23c0 : aa __ __ TAX
+23c1 : 46 1d __ LSR ACCU + 2
+23c3 : 66 1c __ ROR ACCU + 1
+23c5 : e8 __ __ INX
+23c6 : d0 f9 __ BNE $23c1
+23c8 : 24 1e __ BIT ACCU + 3
+23ca : 10 0e __ BPL $23da
+23cc : 38 __ __ SEC
+23cd : a9 00 __ LDA #$00
+23cf : e5 1c __ SBC ACCU + 1
+23d1 : 85 1b __ STA ACCU + 0
+23d3 : a9 00 __ LDA #$00
+23d5 : e5 1d __ SBC ACCU + 2
+23d7 : 85 1c __ STA ACCU + 1
+23d9 : 60 __ __ RTS
+23da : a5 1c __ LDA ACCU + 1
+23dc : 85 1b __ STA ACCU + 0
+23de : a5 1d __ LDA ACCU + 2
+23e0 : 85 1c __ STA ACCU + 1
+23e2 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+23e3 : 24 1c __ BIT ACCU + 1
+23e5 : 30 03 __ BMI $23ea
+23e7 : 4c 01 24 JMP $2401 ; (uint16_to_float + 0)
+23ea : 38 __ __ SEC
+23eb : a9 00 __ LDA #$00
+23ed : e5 1b __ SBC ACCU + 0
+23ef : 85 1b __ STA ACCU + 0
+23f1 : a9 00 __ LDA #$00
+23f3 : e5 1c __ SBC ACCU + 1
+23f5 : 85 1c __ STA ACCU + 1
+23f7 : 20 01 24 JSR $2401 ; (uint16_to_float + 0)
+23fa : a5 1e __ LDA ACCU + 3
+23fc : 09 80 __ ORA #$80
+23fe : 85 1e __ STA ACCU + 3
+2400 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+2401 : a5 1b __ LDA ACCU + 0
+2403 : 05 1c __ ORA ACCU + 1
+2405 : d0 05 __ BNE $240c
+2407 : 85 1d __ STA ACCU + 2
+2409 : 85 1e __ STA ACCU + 3
+240b : 60 __ __ RTS
+240c : a2 8e __ LDX #$8e
+240e : a5 1c __ LDA ACCU + 1
+2410 : 30 06 __ BMI $2418
+2412 : ca __ __ DEX
+2413 : 06 1b __ ASL ACCU + 0
+2415 : 2a __ __ ROL
+2416 : 10 fa __ BPL $2412
+2418 : 29 7f __ AND #$7f
+241a : 85 1d __ STA ACCU + 2
+241c : a5 1b __ LDA ACCU + 0
+241e : 85 1c __ STA ACCU + 1
+2420 : 8a __ __ TXA
+2421 : 4a __ __ LSR
+2422 : 85 1e __ STA ACCU + 3
+2424 : a9 00 __ LDA #$00
+2426 : 85 1b __ STA ACCU + 0
+2428 : 6a __ __ ROR
+2429 : 05 1d __ ORA ACCU + 2
+242b : 85 1d __ STA ACCU + 2
+242d : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+242e : a5 1e __ LDA ACCU + 3
+2430 : 45 06 __ EOR $06
+2432 : 29 80 __ AND #$80
+2434 : f0 1e __ BEQ $2454
+2436 : a5 1e __ LDA ACCU + 3
+2438 : 29 7f __ AND #$7f
+243a : 05 1d __ ORA ACCU + 2
+243c : 05 1c __ ORA ACCU + 1
+243e : 05 1b __ ORA ACCU + 0
+2440 : d0 0c __ BNE $244e
+2442 : a5 06 __ LDA $06
+2444 : 29 7f __ AND #$7f
+2446 : 05 05 __ ORA $05
+2448 : 05 04 __ ORA $04
+244a : 05 03 __ ORA $03
+244c : f0 1e __ BEQ $246c
+244e : a5 1e __ LDA ACCU + 3
+2450 : 30 23 __ BMI $2475
+2452 : 10 28 __ BPL $247c
+2454 : a5 1e __ LDA ACCU + 3
+2456 : c5 06 __ CMP $06
+2458 : d0 15 __ BNE $246f
+245a : a5 1d __ LDA ACCU + 2
+245c : c5 05 __ CMP $05
+245e : d0 0f __ BNE $246f
+2460 : a5 1c __ LDA ACCU + 1
+2462 : c5 04 __ CMP $04
+2464 : d0 09 __ BNE $246f
+2466 : a5 1b __ LDA ACCU + 0
+2468 : c5 03 __ CMP $03
+246a : d0 03 __ BNE $246f
+246c : a9 00 __ LDA #$00
+246e : 60 __ __ RTS
+246f : b0 07 __ BCS $2478
+2471 : 24 1e __ BIT ACCU + 3
+2473 : 30 07 __ BMI $247c
+2475 : a9 01 __ LDA #$01
+2477 : 60 __ __ RTS
+2478 : 24 1e __ BIT ACCU + 3
+247a : 30 f9 __ BMI $2475
+247c : a9 ff __ LDA #$ff
+247e : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+247f : 84 02 __ STY $02
+2481 : a9 00 __ LDA #$00
+2483 : 85 07 __ STA $07
+2485 : 85 08 __ STA $08
+2487 : 85 09 __ STA $09
+2489 : 85 0a __ STA $0a
+248b : a0 20 __ LDY #$20
+248d : 18 __ __ CLC
+248e : 26 1b __ ROL ACCU + 0
+2490 : 26 1c __ ROL ACCU + 1
+2492 : 26 1d __ ROL ACCU + 2
+2494 : 26 1e __ ROL ACCU + 3
+2496 : 26 07 __ ROL $07
+2498 : 26 08 __ ROL $08
+249a : 26 09 __ ROL $09
+249c : 26 0a __ ROL $0a
+249e : a5 07 __ LDA $07
+24a0 : c5 03 __ CMP $03
+24a2 : a5 08 __ LDA $08
+24a4 : e5 04 __ SBC $04
+24a6 : a5 09 __ LDA $09
+24a8 : e5 05 __ SBC $05
+24aa : a5 0a __ LDA $0a
+24ac : e5 06 __ SBC $06
+24ae : 90 18 __ BCC $24c8
+24b0 : a5 07 __ LDA $07
+24b2 : e5 03 __ SBC $03
+24b4 : 85 07 __ STA $07
+24b6 : a5 08 __ LDA $08
+24b8 : e5 04 __ SBC $04
+24ba : 85 08 __ STA $08
+24bc : a5 09 __ LDA $09
+24be : e5 05 __ SBC $05
+24c0 : 85 09 __ STA $09
+24c2 : a5 0a __ LDA $0a
+24c4 : e5 06 __ SBC $06
+24c6 : 85 0a __ STA $0a
+24c8 : 88 __ __ DEY
+24c9 : d0 c3 __ BNE $248e
+24cb : 26 1b __ ROL ACCU + 0
+24cd : 26 1c __ ROL ACCU + 1
+24cf : 26 1d __ ROL ACCU + 2
+24d1 : 26 1e __ ROL ACCU + 3
+24d3 : a4 02 __ LDY $02
+24d5 : 60 __ __ RTS
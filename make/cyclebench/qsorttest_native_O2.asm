@@ -0,0 +1,3346 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 03 22 STX $2203 ; (spentry + 0)
+0811 : a9 06 __ LDA #$06
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 50 __ LDA #$50
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 fa __ LDA #$fa
+0832 : e9 06 __ SBC #$06
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c b0 1d JMP $1db0 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 08 __ SBC #$08
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 06 __ LDA #$06
+090f : 85 67 __ STA T0 + 0
+0911 : a9 22 __ LDA #$22
+0913 : 85 68 __ STA T0 + 1
+0915 : a9 00 __ LDA #$00
+0917 : 85 69 __ STA T1 + 0
+0919 : 85 6a __ STA T1 + 1
+091b : a5 69 __ LDA T1 + 0
+091d : a0 00 __ LDY #$00
+091f : 91 67 __ STA (T0 + 0),y
+0921 : a5 6a __ LDA T1 + 1
+0923 : c8 __ __ INY
+0924 : 91 67 __ STA (T0 + 0),y
+0926 : 18 __ __ CLC
+0927 : a5 67 __ LDA T0 + 0
+0929 : 69 02 __ ADC #$02
+092b : c8 __ __ INY
+092c : 91 23 __ STA (SP + 0),y
+092e : a5 68 __ LDA T0 + 1
+0930 : 69 00 __ ADC #$00
+0932 : c8 __ __ INY
+0933 : 91 23 __ STA (SP + 0),y
+0935 : a9 da __ LDA #$da
+0937 : c8 __ __ INY
+0938 : 91 23 __ STA (SP + 0),y
+093a : a9 1a __ LDA #$1a
+093c : c8 __ __ INY
+093d : 91 23 __ STA (SP + 0),y
+093f : a5 69 __ LDA T1 + 0
+0941 : c8 __ __ INY
+0942 : 91 23 __ STA (SP + 0),y
+0944 : a5 6a __ LDA T1 + 1
+0946 : c8 __ __ INY
+0947 : 91 23 __ STA (SP + 0),y
+0949 : 20 72 0a JSR $0a72 ; (sprintf + 0)
+094c : 18 __ __ CLC
+094d : a5 67 __ LDA T0 + 0
+094f : 69 0c __ ADC #$0c
+0951 : 85 67 __ STA T0 + 0
+0953 : 90 02 __ BCC $0957
+0955 : e6 68 __ INC T0 + 1
+0957 : e6 69 __ INC T1 + 0
+0959 : d0 02 __ BNE $095d
+095b : e6 6a __ INC T1 + 1
+095d : a5 6a __ LDA T1 + 1
+095f : 49 80 __ EOR #$80
+0961 : c9 83 __ CMP #$83
+0963 : d0 04 __ BNE $0969
+0965 : a5 69 __ LDA T1 + 0
+0967 : c9 e8 __ CMP #$e8
+0969 : 90 b0 __ BCC $091b
+096b : a9 06 __ LDA #$06
+096d : 85 69 __ STA T1 + 0
+096f : a9 22 __ LDA #$22
+0971 : 85 6a __ STA T1 + 1
+0973 : 18 __ __ CLC
+0974 : a9 06 __ LDA #$06
+0976 : 69 e0 __ ADC #$e0
+0978 : 85 6b __ STA T2 + 0
+097a : a9 22 __ LDA #$22
+097c : 69 2e __ ADC #$2e
+097e : 85 6c __ STA T2 + 1
+0980 : 20 df 1a JSR $1adf ; (rand + 0)
+0983 : a5 1b __ LDA ACCU + 0
+0985 : 85 44 __ STA T5 + 0
+0987 : a5 1c __ LDA ACCU + 1
+0989 : 85 45 __ STA T5 + 1
+098b : a0 0b __ LDY #$0b
+098d : b1 69 __ LDA (T1 + 0),y
+098f : 99 e6 50 STA $50e6,y ; (sframe + 0)
+0992 : 88 __ __ DEY
+0993 : 10 f8 __ BPL $098d
+0995 : a5 44 __ LDA T5 + 0
+0997 : 85 1b __ STA ACCU + 0
+0999 : a5 45 __ LDA T5 + 1
+099b : 85 1c __ STA ACCU + 1
+099d : a9 e8 __ LDA #$e8
+099f : 85 03 __ STA $03
+09a1 : a9 03 __ LDA #$03
+09a3 : 85 04 __ STA $04
+09a5 : 20 20 20 JSR $2020 ; (divmod + 0)
+09a8 : a5 05 __ LDA $05
+09aa : 0a __ __ ASL
+09ab : aa __ __ TAX
+09ac : a5 06 __ LDA $06
+09ae : 2a __ __ ROL
+09af : a8 __ __ TAY
+09b0 : 18 __ __ CLC
+09b1 : 8a __ __ TXA
+09b2 : 65 05 __ ADC $05
+09b4 : 85 1b __ STA ACCU + 0
+09b6 : 98 __ __ TYA
+09b7 : 65 06 __ ADC $06
+09b9 : 06 1b __ ASL ACCU + 0
+09bb : 2a __ __ ROL
+09bc : 06 1b __ ASL ACCU + 0
+09be : 2a __ __ ROL
+09bf : 85 1c __ STA ACCU + 1
+09c1 : 18 __ __ CLC
+09c2 : a9 06 __ LDA #$06
+09c4 : 65 1b __ ADC ACCU + 0
+09c6 : 85 44 __ STA T5 + 0
+09c8 : a9 22 __ LDA #$22
+09ca : 65 1c __ ADC ACCU + 1
+09cc : 85 45 __ STA T5 + 1
+09ce : a0 0b __ LDY #$0b
+09d0 : b1 44 __ LDA (T5 + 0),y
+09d2 : 91 69 __ STA (T1 + 0),y
+09d4 : 88 __ __ DEY
+09d5 : 10 f9 __ BPL $09d0
+09d7 : a0 0b __ LDY #$0b
+09d9 : b9 e6 50 LDA $50e6,y ; (sframe + 0)
+09dc : 91 44 __ STA (T5 + 0),y
+09de : 88 __ __ DEY
+09df : 10 f8 __ BPL $09d9
+09e1 : 18 __ __ CLC
+09e2 : a5 69 __ LDA T1 + 0
+09e4 : 69 0c __ ADC #$0c
+09e6 : 85 69 __ STA T1 + 0
+09e8 : a5 6a __ LDA T1 + 1
+09ea : 69 00 __ ADC #$00
+09ec : 85 6a __ STA T1 + 1
+09ee : c5 6c __ CMP T2 + 1
+09f0 : d0 04 __ BNE $09f6
+09f2 : a5 69 __ LDA T1 + 0
+09f4 : c5 6b __ CMP T2 + 0
+09f6 : 90 88 __ BCC $0980
+09f8 : a9 06 __ LDA #$06
+09fa : a0 02 __ LDY #$02
+09fc : 91 23 __ STA (SP + 0),y
+09fe : a9 22 __ LDA #$22
+0a00 : c8 __ __ INY
+0a01 : 91 23 __ STA (SP + 0),y
+0a03 : a9 e8 __ LDA #$e8
+0a05 : c8 __ __ INY
+0a06 : 91 23 __ STA (SP + 0),y
+0a08 : a9 03 __ LDA #$03
+0a0a : c8 __ __ INY
+0a0b : 91 23 __ STA (SP + 0),y
+0a0d : 20 09 1b JSR $1b09 ; (qsort + 0)
+0a10 : a9 06 __ LDA #$06
+0a12 : 85 67 __ STA T0 + 0
+0a14 : a9 22 __ LDA #$22
+0a16 : 85 68 __ STA T0 + 1
+0a18 : a9 00 __ LDA #$00
+0a1a : 85 69 __ STA T1 + 0
+0a1c : 85 6a __ STA T1 + 1
+0a1e : a0 00 __ LDY #$00
+0a20 : b1 67 __ LDA (T0 + 0),y
+0a22 : 85 6b __ STA T2 + 0
+0a24 : c8 __ __ INY
+0a25 : b1 67 __ LDA (T0 + 0),y
+0a27 : c5 6a __ CMP T1 + 1
+0a29 : d0 06 __ BNE $0a31
+0a2b : a5 6b __ LDA T2 + 0
+0a2d : c5 69 __ CMP T1 + 0
+0a2f : f0 3c __ BEQ $0a6d
+0a31 : a9 00 __ LDA #$00
+0a33 : a0 02 __ LDY #$02
+0a35 : 91 23 __ STA (SP + 0),y
+0a37 : 20 8b 1d JSR $1d8b ; (assert + 0)
+0a3a : 18 __ __ CLC
+0a3b : a5 67 __ LDA T0 + 0
+0a3d : 69 0c __ ADC #$0c
+0a3f : 85 67 __ STA T0 + 0
+0a41 : 90 02 __ BCC $0a45
+0a43 : e6 68 __ INC T0 + 1
+0a45 : e6 69 __ INC T1 + 0
+0a47 : d0 02 __ BNE $0a4b
+0a49 : e6 6a __ INC T1 + 1
+0a4b : a5 6a __ LDA T1 + 1
+0a4d : 49 80 __ EOR #$80
+0a4f : c9 83 __ CMP #$83
+0a51 : d0 04 __ BNE $0a57
+0a53 : a5 69 __ LDA T1 + 0
+0a55 : c9 e8 __ CMP #$e8
+0a57 : 90 c5 __ BCC $0a1e
+0a59 : a9 00 __ LDA #$00
+0a5b : 85 1b __ STA ACCU + 0
+0a5d : 85 1c __ STA ACCU + 1
+0a5f : 18 __ __ CLC
+0a60 : a5 23 __ LDA SP + 0
+0a62 : 69 08 __ ADC #$08
+0a64 : 85 23 __ STA SP + 0
+0a66 : a5 24 __ LDA SP + 1
+0a68 : 69 00 __ ADC #$00
+0a6a : 85 24 __ STA SP + 1
+0a6c : 60 __ __ RTS
+0a6d : a9 01 __ LDA #$01
+0a6f : 4c 33 0a JMP $0a33 ; (main + 307)
+--------------------------------------------------------------------
+sprintf:
+0a72 : a9 00 __ LDA #$00
+0a74 : 85 43 __ STA T0 + 0
+0a76 : a0 04 __ LDY #$04
+0a78 : b1 23 __ LDA (SP + 0),y
+0a7a : 85 5d __ STA T1 + 0
+0a7c : c8 __ __ INY
+0a7d : b1 23 __ LDA (SP + 0),y
+0a7f : 85 5e __ STA T1 + 1
+0a81 : a0 00 __ LDY #$00
+0a83 : b1 5d __ LDA (T1 + 0),y
+0a85 : 85 45 __ STA T2 + 0
+0a87 : a0 02 __ LDY #$02
+0a89 : b1 23 __ LDA (SP + 0),y
+0a8b : 85 5f __ STA T3 + 0
+0a8d : c8 __ __ INY
+0a8e : b1 23 __ LDA (SP + 0),y
+0a90 : 85 60 __ STA T3 + 1
+0a92 : a5 45 __ LDA T2 + 0
+0a94 : d0 37 __ BNE $0acd
+0a96 : 18 __ __ CLC
+0a97 : a5 5f __ LDA T3 + 0
+0a99 : 65 43 __ ADC T0 + 0
+0a9b : 85 5d __ STA T1 + 0
+0a9d : a5 60 __ LDA T3 + 1
+0a9f : 69 00 __ ADC #$00
+0aa1 : 85 5e __ STA T1 + 1
+0aa3 : a9 00 __ LDA #$00
+0aa5 : a4 43 __ LDY T0 + 0
+0aa7 : 91 5f __ STA (T3 + 0),y
+0aa9 : 98 __ __ TYA
+0aaa : d0 08 __ BNE $0ab4
+0aac : a5 5f __ LDA T3 + 0
+0aae : 85 5d __ STA T1 + 0
+0ab0 : a5 60 __ LDA T3 + 1
+0ab2 : 85 5e __ STA T1 + 1
+0ab4 : a0 02 __ LDY #$02
+0ab6 : b1 23 __ LDA (SP + 0),y
+0ab8 : 85 5f __ STA T3 + 0
+0aba : c8 __ __ INY
+0abb : b1 23 __ LDA (SP + 0),y
+0abd : 85 60 __ STA T3 + 1
+0abf : 38 __ __ SEC
+0ac0 : a5 5d __ LDA T1 + 0
+0ac2 : e5 5f __ SBC T3 + 0
+0ac4 : 85 1b __ STA ACCU + 0
+0ac6 : a5 5e __ LDA T1 + 1
+0ac8 : e5 60 __ SBC T3 + 1
+0aca : 85 1c __ STA ACCU + 1
+0acc : 60 __ __ RTS
+0acd : 18 __ __ CLC
+0ace : a5 23 __ LDA SP + 0
+0ad0 : 69 06 __ ADC #$06
+0ad2 : 85 61 __ STA T4 + 0
+0ad4 : a5 24 __ LDA SP + 1
+0ad6 : 69 00 __ ADC #$00
+0ad8 : 85 62 __ STA T4 + 1
+0ada : e6 5d __ INC T1 + 0
+0adc : d0 02 __ BNE $0ae0
+0ade : e6 5e __ INC T1 + 1
+0ae0 : a5 45 __ LDA T2 + 0
+0ae2 : c9 25 __ CMP #$25
+0ae4 : f0 3d __ BEQ $0b23
+0ae6 : a4 43 __ LDY T0 + 0
+0ae8 : 91 5f __ STA (T3 + 0),y
+0aea : e6 43 __ INC T0 + 0
+0aec : a5 43 __ LDA T0 + 0
+0aee : c9 28 __ CMP #$28
+0af0 : a0 00 __ LDY #$00
+0af2 : 90 20 __ BCC $0b14
+0af4 : 18 __ __ CLC
+0af5 : 65 5f __ ADC T3 + 0
+0af7 : 85 5f __ STA T3 + 0
+0af9 : 90 02 __ BCC $0afd
+0afb : e6 60 __ INC T3 + 1
+0afd : a9 00 __ LDA #$00
+0aff : 85 43 __ STA T0 + 0
+0b01 : b1 5d __ LDA (T1 + 0),y
+0b03 : 85 47 __ STA T5 + 0
+0b05 : e6 5d __ INC T1 + 0
+0b07 : d0 02 __ BNE $0b0b
+0b09 : e6 5e __ INC T1 + 1
+0b0b : a5 47 __ LDA T5 + 0
+0b0d : 85 45 __ STA T2 + 0
+0b0f : d0 cf __ BNE $0ae0
+0b11 : 4c 96 0a JMP $0a96 ; (sprintf + 36)
+0b14 : a0 00 __ LDY #$00
+0b16 : b1 5d __ LDA (T1 + 0),y
+0b18 : 85 47 __ STA T5 + 0
+0b1a : e6 5d __ INC T1 + 0
+0b1c : d0 02 __ BNE $0b20
+0b1e : e6 5e __ INC T1 + 1
+0b20 : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0b23 : a5 43 __ LDA T0 + 0
+0b25 : f0 0d __ BEQ $0b34
+0b27 : 18 __ __ CLC
+0b28 : 65 5f __ ADC T3 + 0
+0b2a : 85 5f __ STA T3 + 0
+0b2c : 90 02 __ BCC $0b30
+0b2e : e6 60 __ INC T3 + 1
+0b30 : a9 00 __ LDA #$00
+0b32 : 85 43 __ STA T0 + 0
+0b34 : a0 00 __ LDY #$00
+0b36 : b1 5d __ LDA (T1 + 0),y
+0b38 : 85 45 __ STA T2 + 0
+0b3a : a9 0a __ LDA #$0a
+0b3c : 8d f5 50 STA $50f5 ; (sframe + 15)
+0b3f : a9 00 __ LDA #$00
+0b41 : 8d f6 50 STA $50f6 ; (sframe + 16)
+0b44 : a9 01 __ LDA #$01
+0b46 : 8d f3 50 STA $50f3 ; (sframe + 13)
+0b49 : a9 ff __ LDA #$ff
+0b4b : 8d f4 50 STA $50f4 ; (sframe + 14)
+0b4e : a9 20 __ LDA #$20
+0b50 : 8d f2 50 STA $50f2 ; (sframe + 12)
+0b53 : a9 00 __ LDA #$00
+0b55 : 8d f7 50 STA $50f7 ; (sframe + 17)
+0b58 : 8d f8 50 STA $50f8 ; (sframe + 18)
+0b5b : 8d f9 50 STA $50f9 ; (sframe + 19)
+0b5e : e6 5d __ INC T1 + 0
+0b60 : d0 02 __ BNE $0b64
+0b62 : e6 5e __ INC T1 + 1
+0b64 : a5 45 __ LDA T2 + 0
+0b66 : c9 2b __ CMP #$2b
+0b68 : d0 03 __ BNE $0b6d
+0b6a : 4c 83 12 JMP $1283 ; (sprintf + 2065)
+0b6d : c9 30 __ CMP #$30
+0b6f : d0 03 __ BNE $0b74
+0b71 : 4c 75 12 JMP $1275 ; (sprintf + 2051)
+0b74 : c9 23 __ CMP #$23
+0b76 : d0 03 __ BNE $0b7b
+0b78 : 4c 67 12 JMP $1267 ; (sprintf + 2037)
+0b7b : c9 30 __ CMP #$30
+0b7d : 90 64 __ BCC $0be3
+0b7f : a9 39 __ LDA #$39
+0b81 : c5 45 __ CMP T2 + 0
+0b83 : 90 5e __ BCC $0be3
+0b85 : a9 00 __ LDA #$00
+0b87 : 85 49 __ STA T6 + 0
+0b89 : 85 4a __ STA T6 + 1
+0b8b : a5 45 __ LDA T2 + 0
+0b8d : c9 30 __ CMP #$30
+0b8f : 90 4d __ BCC $0bde
+0b91 : a9 39 __ LDA #$39
+0b93 : c5 45 __ CMP T2 + 0
+0b95 : 90 47 __ BCC $0bde
+0b97 : a5 45 __ LDA T2 + 0
+0b99 : 85 4b __ STA T7 + 0
+0b9b : a0 00 __ LDY #$00
+0b9d : b1 5d __ LDA (T1 + 0),y
+0b9f : 85 45 __ STA T2 + 0
+0ba1 : e6 5d __ INC T1 + 0
+0ba3 : d0 02 __ BNE $0ba7
+0ba5 : e6 5e __ INC T1 + 1
+0ba7 : a5 49 __ LDA T6 + 0
+0ba9 : 0a __ __ ASL
+0baa : 85 07 __ STA $07
+0bac : a5 4a __ LDA T6 + 1
+0bae : 2a __ __ ROL
+0baf : 06 07 __ ASL $07
+0bb1 : 2a __ __ ROL
+0bb2 : aa __ __ TAX
+0bb3 : 18 __ __ CLC
+0bb4 : a5 07 __ LDA $07
+0bb6 : 65 49 __ ADC T6 + 0
+0bb8 : 85 1b __ STA ACCU + 0
+0bba : 8a __ __ TXA
+0bbb : 65 4a __ ADC T6 + 1
+0bbd : 06 1b __ ASL ACCU + 0
+0bbf : 2a __ __ ROL
+0bc0 : 85 1c __ STA ACCU + 1
+0bc2 : 18 __ __ CLC
+0bc3 : a5 1b __ LDA ACCU + 0
+0bc5 : 65 4b __ ADC T7 + 0
+0bc7 : aa __ __ TAX
+0bc8 : a5 1c __ LDA ACCU + 1
+0bca : 69 00 __ ADC #$00
+0bcc : a8 __ __ TAY
+0bcd : 38 __ __ SEC
+0bce : 8a __ __ TXA
+0bcf : e9 30 __ SBC #$30
+0bd1 : 85 49 __ STA T6 + 0
+0bd3 : 98 __ __ TYA
+0bd4 : e9 00 __ SBC #$00
+0bd6 : 85 4a __ STA T6 + 1
+0bd8 : a5 45 __ LDA T2 + 0
+0bda : c9 30 __ CMP #$30
+0bdc : b0 b3 __ BCS $0b91
+0bde : a5 49 __ LDA T6 + 0
+0be0 : 8d f3 50 STA $50f3 ; (sframe + 13)
+0be3 : a5 45 __ LDA T2 + 0
+0be5 : c9 2e __ CMP #$2e
+0be7 : d0 03 __ BNE $0bec
+0be9 : 4c fa 11 JMP $11fa ; (sprintf + 1928)
+0bec : a5 45 __ LDA T2 + 0
+0bee : c9 64 __ CMP #$64
+0bf0 : d0 03 __ BNE $0bf5
+0bf2 : 4c 73 10 JMP $1073 ; (sprintf + 1537)
+0bf5 : c9 75 __ CMP #$75
+0bf7 : d0 03 __ BNE $0bfc
+0bf9 : 4c 33 0f JMP $0f33 ; (sprintf + 1217)
+0bfc : c9 78 __ CMP #$78
+0bfe : d0 03 __ BNE $0c03
+0c00 : 4c dc 0d JMP $0ddc ; (sprintf + 874)
+0c03 : c9 6c __ CMP #$6c
+0c05 : d0 03 __ BNE $0c0a
+0c07 : 4c f2 0c JMP $0cf2 ; (sprintf + 640)
+0c0a : c9 66 __ CMP #$66
+0c0c : d0 03 __ BNE $0c11
+0c0e : 4c ac 0c JMP $0cac ; (sprintf + 570)
+0c11 : c9 67 __ CMP #$67
+0c13 : d0 03 __ BNE $0c18
+0c15 : 4c ac 0c JMP $0cac ; (sprintf + 570)
+0c18 : c9 65 __ CMP #$65
+0c1a : d0 03 __ BNE $0c1f
+0c1c : 4c ac 0c JMP $0cac ; (sprintf + 570)
+0c1f : c9 73 __ CMP #$73
+0c21 : f0 46 __ BEQ $0c69
+0c23 : c9 63 __ CMP #$63
+0c25 : f0 1e __ BEQ $0c45
+0c27 : 09 00 __ ORA #$00
+0c29 : d0 03 __ BNE $0c2e
+0c2b : 4c 14 0b JMP $0b14 ; (sprintf + 162)
+0c2e : a5 45 __ LDA T2 + 0
+0c30 : a4 43 __ LDY T0 + 0
+0c32 : 91 5f __ STA (T3 + 0),y
+0c34 : e6 43 __ INC T0 + 0
+0c36 : a0 00 __ LDY #$00
+0c38 : b1 5d __ LDA (T1 + 0),y
+0c3a : 85 47 __ STA T5 + 0
+0c3c : e6 5d __ INC T1 + 0
+0c3e : d0 02 __ BNE $0c42
+0c40 : e6 5e __ INC T1 + 1
+0c42 : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0c45 : a0 00 __ LDY #$00
+0c47 : b1 61 __ LDA (T4 + 0),y
+0c49 : a4 43 __ LDY T0 + 0
+0c4b : 91 5f __ STA (T3 + 0),y
+0c4d : 18 __ __ CLC
+0c4e : a5 61 __ LDA T4 + 0
+0c50 : 69 02 __ ADC #$02
+0c52 : 85 61 __ STA T4 + 0
+0c54 : 90 02 __ BCC $0c58
+0c56 : e6 62 __ INC T4 + 1
+0c58 : e6 43 __ INC T0 + 0
+0c5a : a0 00 __ LDY #$00
+0c5c : b1 5d __ LDA (T1 + 0),y
+0c5e : 85 47 __ STA T5 + 0
+0c60 : e6 5d __ INC T1 + 0
+0c62 : d0 02 __ BNE $0c66
+0c64 : e6 5e __ INC T1 + 1
+0c66 : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0c69 : a0 00 __ LDY #$00
+0c6b : b1 61 __ LDA (T4 + 0),y
+0c6d : 85 49 __ STA T6 + 0
+0c6f : c8 __ __ INY
+0c70 : b1 61 __ LDA (T4 + 0),y
+0c72 : 85 4a __ STA T6 + 1
+0c74 : 18 __ __ CLC
+0c75 : a5 61 __ LDA T4 + 0
+0c77 : 69 02 __ ADC #$02
+0c79 : 85 61 __ STA T4 + 0
+0c7b : 90 02 __ BCC $0c7f
+0c7d : e6 62 __ INC T4 + 1
+0c7f : 88 __ __ DEY
+0c80 : b1 49 __ LDA (T6 + 0),y
+0c82 : 85 45 __ STA T2 + 0
+0c84 : d0 03 __ BNE $0c89
+0c86 : 4c 14 0b JMP $0b14 ; (sprintf + 162)
+0c89 : e6 49 __ INC T6 + 0
+0c8b : d0 02 __ BNE $0c8f
+0c8d : e6 4a __ INC T6 + 1
+0c8f : a5 45 __ LDA T2 + 0
+0c91 : a0 00 __ LDY #$00
+0c93 : 91 5f __ STA (T3 + 0),y
+0c95 : e6 5f __ INC T3 + 0
+0c97 : d0 02 __ BNE $0c9b
+0c99 : e6 60 __ INC T3 + 1
+0c9b : b1 49 __ LDA (T6 + 0),y
+0c9d : aa __ __ TAX
+0c9e : e6 49 __ INC T6 + 0
+0ca0 : d0 02 __ BNE $0ca4
+0ca2 : e6 4a __ INC T6 + 1
+0ca4 : 8a __ __ TXA
+0ca5 : 86 45 __ STX T2 + 0
+0ca7 : d0 e6 __ BNE $0c8f
+0ca9 : 4c 14 0b JMP $0b14 ; (sprintf + 162)
+0cac : a9 f2 __ LDA #$f2
+0cae : 85 0d __ STA P0
+0cb0 : a9 50 __ LDA #$50
+0cb2 : 85 0e __ STA P1
+0cb4 : a5 5f __ LDA T3 + 0
+0cb6 : 85 0f __ STA P2
+0cb8 : a5 60 __ LDA T3 + 1
+0cba : 85 10 __ STA P3
+0cbc : a0 00 __ LDY #$00
+0cbe : b1 61 __ LDA (T4 + 0),y
+0cc0 : 85 11 __ STA P4
+0cc2 : c8 __ __ INY
+0cc3 : b1 61 __ LDA (T4 + 0),y
+0cc5 : 85 12 __ STA P5
+0cc7 : c8 __ __ INY
+0cc8 : b1 61 __ LDA (T4 + 0),y
+0cca : 85 13 __ STA P6
+0ccc : c8 __ __ INY
+0ccd : b1 61 __ LDA (T4 + 0),y
+0ccf : 85 14 __ STA P7
+0cd1 : 20 8d 14 JSR $148d ; (nformf + 0)
+0cd4 : a5 1b __ LDA ACCU + 0
+0cd6 : 85 43 __ STA T0 + 0
+0cd8 : 18 __ __ CLC
+0cd9 : a5 61 __ LDA T4 + 0
+0cdb : 69 04 __ ADC #$04
+0cdd : 85 61 __ STA T4 + 0
+0cdf : 90 02 __ BCC $0ce3
+0ce1 : e6 62 __ INC T4 + 1
+0ce3 : a0 00 __ LDY #$00
+0ce5 : b1 5d __ LDA (T1 + 0),y
+0ce7 : 85 47 __ STA T5 + 0
+0ce9 : e6 5d __ INC T1 + 0
+0ceb : d0 02 __ BNE $0cef
+0ced : e6 5e __ INC T1 + 1
+0cef : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0cf2 : a0 00 __ LDY #$00
+0cf4 : b1 61 __ LDA (T4 + 0),y
+0cf6 : 85 63 __ STA T11 + 0
+0cf8 : c8 __ __ INY
+0cf9 : b1 61 __ LDA (T4 + 0),y
+0cfb : 85 64 __ STA T11 + 1
+0cfd : c8 __ __ INY
+0cfe : b1 61 __ LDA (T4 + 0),y
+0d00 : 85 65 __ STA T11 + 2
+0d02 : c8 __ __ INY
+0d03 : b1 61 __ LDA (T4 + 0),y
+0d05 : 85 66 __ STA T11 + 3
+0d07 : 18 __ __ CLC
+0d08 : a5 61 __ LDA T4 + 0
+0d0a : 69 04 __ ADC #$04
+0d0c : 85 61 __ STA T4 + 0
+0d0e : 90 02 __ BCC $0d12
+0d10 : e6 62 __ INC T4 + 1
+0d12 : a0 00 __ LDY #$00
+0d14 : b1 5d __ LDA (T1 + 0),y
+0d16 : aa __ __ TAX
+0d17 : e6 5d __ INC T1 + 0
+0d19 : d0 02 __ BNE $0d1d
+0d1b : e6 5e __ INC T1 + 1
+0d1d : 8a __ __ TXA
+0d1e : e0 64 __ CPX #$64
+0d20 : d0 03 __ BNE $0d25
+0d22 : 4c a6 0d JMP $0da6 ; (sprintf + 820)
+0d25 : c9 75 __ CMP #$75
+0d27 : f0 47 __ BEQ $0d70
+0d29 : c9 78 __ CMP #$78
+0d2b : f0 03 __ BEQ $0d30
+0d2d : 4c 14 0b JMP $0b14 ; (sprintf + 162)
+0d30 : a9 10 __ LDA #$10
+0d32 : 8d f5 50 STA $50f5 ; (sframe + 15)
+0d35 : a9 00 __ LDA #$00
+0d37 : 8d f6 50 STA $50f6 ; (sframe + 16)
+0d3a : a9 f2 __ LDA #$f2
+0d3c : 85 0d __ STA P0
+0d3e : a9 50 __ LDA #$50
+0d40 : 85 0e __ STA P1
+0d42 : a5 5f __ LDA T3 + 0
+0d44 : 85 0f __ STA P2
+0d46 : a5 60 __ LDA T3 + 1
+0d48 : 85 10 __ STA P3
+0d4a : a5 63 __ LDA T11 + 0
+0d4c : 85 11 __ STA P4
+0d4e : a5 64 __ LDA T11 + 1
+0d50 : 85 12 __ STA P5
+0d52 : a5 65 __ LDA T11 + 2
+0d54 : 85 13 __ STA P6
+0d56 : a5 66 __ LDA T11 + 3
+0d58 : 85 14 __ STA P7
+0d5a : 20 91 12 JSR $1291 ; (nforml + 0)
+0d5d : a5 1b __ LDA ACCU + 0
+0d5f : 85 43 __ STA T0 + 0
+0d61 : a0 00 __ LDY #$00
+0d63 : b1 5d __ LDA (T1 + 0),y
+0d65 : 85 47 __ STA T5 + 0
+0d67 : e6 5d __ INC T1 + 0
+0d69 : d0 02 __ BNE $0d6d
+0d6b : e6 5e __ INC T1 + 1
+0d6d : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0d70 : a9 f2 __ LDA #$f2
+0d72 : 85 0d __ STA P0
+0d74 : a9 50 __ LDA #$50
+0d76 : 85 0e __ STA P1
+0d78 : a5 5f __ LDA T3 + 0
+0d7a : 85 0f __ STA P2
+0d7c : a5 60 __ LDA T3 + 1
+0d7e : 85 10 __ STA P3
+0d80 : a5 63 __ LDA T11 + 0
+0d82 : 85 11 __ STA P4
+0d84 : a5 64 __ LDA T11 + 1
+0d86 : 85 12 __ STA P5
+0d88 : a5 65 __ LDA T11 + 2
+0d8a : 85 13 __ STA P6
+0d8c : a5 66 __ LDA T11 + 3
+0d8e : 85 14 __ STA P7
+0d90 : 20 91 12 JSR $1291 ; (nforml + 0)
+0d93 : a5 1b __ LDA ACCU + 0
+0d95 : 85 43 __ STA T0 + 0
+0d97 : a0 00 __ LDY #$00
+0d99 : b1 5d __ LDA (T1 + 0),y
+0d9b : 85 47 __ STA T5 + 0
+0d9d : e6 5d __ INC T1 + 0
+0d9f : d0 02 __ BNE $0da3
+0da1 : e6 5e __ INC T1 + 1
+0da3 : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0da6 : a9 f2 __ LDA #$f2
+0da8 : 85 0d __ STA P0
+0daa : a9 50 __ LDA #$50
+0dac : 85 0e __ STA P1
+0dae : a5 5f __ LDA T3 + 0
+0db0 : 85 0f __ STA P2
+0db2 : a5 60 __ LDA T3 + 1
+0db4 : 85 10 __ STA P3
+0db6 : a5 63 __ LDA T11 + 0
+0db8 : 85 11 __ STA P4
+0dba : a5 64 __ LDA T11 + 1
+0dbc : 85 12 __ STA P5
+0dbe : a5 65 __ LDA T11 + 2
+0dc0 : 85 13 __ STA P6
+0dc2 : a5 66 __ LDA T11 + 3
+0dc4 : 85 14 __ STA P7
+0dc6 : 20 91 12 JSR $1291 ; (nforml + 0)
+0dc9 : a5 1b __ LDA ACCU + 0
+0dcb : 85 43 __ STA T0 + 0
+0dcd : a0 00 __ LDY #$00
+0dcf : b1 5d __ LDA (T1 + 0),y
+0dd1 : 85 47 __ STA T5 + 0
+0dd3 : e6 5d __ INC T1 + 0
+0dd5 : d0 02 __ BNE $0dd9
+0dd7 : e6 5e __ INC T1 + 1
+0dd9 : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0ddc : a9 10 __ LDA #$10
+0dde : 8d f5 50 STA $50f5 ; (sframe + 15)
+0de1 : a9 00 __ LDA #$00
+0de3 : 8d f6 50 STA $50f6 ; (sframe + 16)
+0de6 : a5 5f __ LDA T3 + 0
+0de8 : 85 49 __ STA T6 + 0
+0dea : a5 60 __ LDA T3 + 1
+0dec : 85 4a __ STA T6 + 1
+0dee : a0 00 __ LDY #$00
+0df0 : b1 61 __ LDA (T4 + 0),y
+0df2 : 85 4b __ STA T7 + 0
+0df4 : c8 __ __ INY
+0df5 : b1 61 __ LDA (T4 + 0),y
+0df7 : 85 4c __ STA T7 + 1
+0df9 : 18 __ __ CLC
+0dfa : a5 61 __ LDA T4 + 0
+0dfc : 69 02 __ ADC #$02
+0dfe : 85 61 __ STA T4 + 0
+0e00 : 90 02 __ BCC $0e04
+0e02 : e6 62 __ INC T4 + 1
+0e04 : a9 0a __ LDA #$0a
+0e06 : 85 43 __ STA T0 + 0
+0e08 : a5 4b __ LDA T7 + 0
+0e0a : 05 4c __ ORA T7 + 1
+0e0c : f0 03 __ BEQ $0e11
+0e0e : 4c db 0e JMP $0edb ; (sprintf + 1129)
+0e11 : ad f4 50 LDA $50f4 ; (sframe + 14)
+0e14 : c9 ff __ CMP #$ff
+0e16 : d0 03 __ BNE $0e1b
+0e18 : 4c cd 0e JMP $0ecd ; (sprintf + 1115)
+0e1b : 38 __ __ SEC
+0e1c : a9 0a __ LDA #$0a
+0e1e : ed f4 50 SBC $50f4 ; (sframe + 14)
+0e21 : 85 45 __ STA T2 + 0
+0e23 : c5 43 __ CMP T0 + 0
+0e25 : b0 0e __ BCS $0e35
+0e27 : c6 43 __ DEC T0 + 0
+0e29 : a9 30 __ LDA #$30
+0e2b : a4 43 __ LDY T0 + 0
+0e2d : 91 49 __ STA (T6 + 0),y
+0e2f : a5 45 __ LDA T2 + 0
+0e31 : c5 43 __ CMP T0 + 0
+0e33 : 90 f2 __ BCC $0e27
+0e35 : ad f9 50 LDA $50f9 ; (sframe + 19)
+0e38 : f0 33 __ BEQ $0e6d
+0e3a : ad f5 50 LDA $50f5 ; (sframe + 15)
+0e3d : 85 4b __ STA T7 + 0
+0e3f : ad f6 50 LDA $50f6 ; (sframe + 16)
+0e42 : d0 29 __ BNE $0e6d
+0e44 : a5 4b __ LDA T7 + 0
+0e46 : c9 10 __ CMP #$10
+0e48 : d0 23 __ BNE $0e6d
+0e4a : 18 __ __ CLC
+0e4b : a5 43 __ LDA T0 + 0
+0e4d : 69 ff __ ADC #$ff
+0e4f : 18 __ __ CLC
+0e50 : 65 49 __ ADC T6 + 0
+0e52 : 85 4b __ STA T7 + 0
+0e54 : a5 4a __ LDA T6 + 1
+0e56 : 69 00 __ ADC #$00
+0e58 : 85 4c __ STA T7 + 1
+0e5a : a9 58 __ LDA #$58
+0e5c : a0 00 __ LDY #$00
+0e5e : 91 4b __ STA (T7 + 0),y
+0e60 : 18 __ __ CLC
+0e61 : a5 43 __ LDA T0 + 0
+0e63 : 69 fe __ ADC #$fe
+0e65 : 85 43 __ STA T0 + 0
+0e67 : a9 30 __ LDA #$30
+0e69 : a4 43 __ LDY T0 + 0
+0e6b : 91 49 __ STA (T6 + 0),y
+0e6d : ad f7 50 LDA $50f7 ; (sframe + 17)
+0e70 : f0 08 __ BEQ $0e7a
+0e72 : c6 43 __ DEC T0 + 0
+0e74 : a9 2b __ LDA #$2b
+0e76 : a4 43 __ LDY T0 + 0
+0e78 : 91 49 __ STA (T6 + 0),y
+0e7a : 38 __ __ SEC
+0e7b : a9 0a __ LDA #$0a
+0e7d : ed f3 50 SBC $50f3 ; (sframe + 13)
+0e80 : 85 4b __ STA T7 + 0
+0e82 : a9 00 __ LDA #$00
+0e84 : e9 00 __ SBC #$00
+0e86 : 49 80 __ EOR #$80
+0e88 : c9 80 __ CMP #$80
+0e8a : d0 04 __ BNE $0e90
+0e8c : a5 4b __ LDA T7 + 0
+0e8e : c5 43 __ CMP T0 + 0
+0e90 : 90 2f __ BCC $0ec1
+0e92 : a9 00 __ LDA #$00
+0e94 : 85 45 __ STA T2 + 0
+0e96 : a5 43 __ LDA T0 + 0
+0e98 : c9 0a __ CMP #$0a
+0e9a : b0 12 __ BCS $0eae
+0e9c : a4 43 __ LDY T0 + 0
+0e9e : b1 49 __ LDA (T6 + 0),y
+0ea0 : a4 45 __ LDY T2 + 0
+0ea2 : 91 49 __ STA (T6 + 0),y
+0ea4 : e6 45 __ INC T2 + 0
+0ea6 : e6 43 __ INC T0 + 0
+0ea8 : a5 43 __ LDA T0 + 0
+0eaa : c9 0a __ CMP #$0a
+0eac : 90 ee __ BCC $0e9c
+0eae : a0 00 __ LDY #$00
+0eb0 : b1 5d __ LDA (T1 + 0),y
+0eb2 : 85 47 __ STA T5 + 0
+0eb4 : e6 5d __ INC T1 + 0
+0eb6 : d0 02 __ BNE $0eba
+0eb8 : e6 5e __ INC T1 + 1
+0eba : a5 45 __ LDA T2 + 0
+0ebc : 85 43 __ STA T0 + 0
+0ebe : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+0ec1 : c6 43 __ DEC T0 + 0
+0ec3 : ad f2 50 LDA $50f2 ; (sframe + 12)
+0ec6 : a4 43 __ LDY T0 + 0
+0ec8 : 91 49 __ STA (T6 + 0),y
+0eca : 4c 7a 0e JMP $0e7a ; (sprintf + 1032)
+0ecd : a9 09 __ LDA #$09
+0ecf : 85 45 __ STA T2 + 0
+0ed1 : c5 43 __ CMP T0 + 0
+0ed3 : b0 03 __ BCS $0ed8
+0ed5 : 4c 27 0e JMP $0e27 ; (sprintf + 949)
+0ed8 : 4c 35 0e JMP $0e35 ; (sprintf + 963)
+0edb : a5 4b __ LDA T7 + 0
+0edd : 85 1b __ STA ACCU + 0
+0edf : a5 4c __ LDA T7 + 1
+0ee1 : 85 1c __ STA ACCU + 1
+0ee3 : ad f5 50 LDA $50f5 ; (sframe + 15)
+0ee6 : 85 03 __ STA $03
+0ee8 : ad f6 50 LDA $50f6 ; (sframe + 16)
+0eeb : 85 04 __ STA $04
+0eed : 20 20 20 JSR $2020 ; (divmod + 0)
+0ef0 : a5 06 __ LDA $06
+0ef2 : 10 2f __ BPL $0f23
+0ef4 : 18 __ __ CLC
+0ef5 : a5 05 __ LDA $05
+0ef7 : 69 30 __ ADC #$30
+0ef9 : c6 43 __ DEC T0 + 0
+0efb : a4 43 __ LDY T0 + 0
+0efd : 91 49 __ STA (T6 + 0),y
+0eff : a5 4b __ LDA T7 + 0
+0f01 : 85 1b __ STA ACCU + 0
+0f03 : a5 4c __ LDA T7 + 1
+0f05 : 85 1c __ STA ACCU + 1
+0f07 : ad f5 50 LDA $50f5 ; (sframe + 15)
+0f0a : 85 03 __ STA $03
+0f0c : ad f6 50 LDA $50f6 ; (sframe + 16)
+0f0f : 85 04 __ STA $04
+0f11 : 20 20 20 JSR $2020 ; (divmod + 0)
+0f14 : a5 1b __ LDA ACCU + 0
+0f16 : 85 4b __ STA T7 + 0
+0f18 : a5 1c __ LDA ACCU + 1
+0f1a : 85 4c __ STA T7 + 1
+0f1c : 05 1b __ ORA ACCU + 0
+0f1e : d0 bb __ BNE $0edb
+0f20 : 4c 11 0e JMP $0e11 ; (sprintf + 927)
+0f23 : d0 06 __ BNE $0f2b
+0f25 : a5 05 __ LDA $05
+0f27 : c9 0a __ CMP #$0a
+0f29 : 90 c9 __ BCC $0ef4
+0f2b : 18 __ __ CLC
+0f2c : a5 05 __ LDA $05
+0f2e : 69 37 __ ADC #$37
+0f30 : 4c f9 0e JMP $0ef9 ; (sprintf + 1159)
+0f33 : a5 5f __ LDA T3 + 0
+0f35 : 85 49 __ STA T6 + 0
+0f37 : a5 60 __ LDA T3 + 1
+0f39 : 85 4a __ STA T6 + 1
+0f3b : a0 00 __ LDY #$00
+0f3d : b1 61 __ LDA (T4 + 0),y
+0f3f : 85 4b __ STA T7 + 0
+0f41 : c8 __ __ INY
+0f42 : b1 61 __ LDA (T4 + 0),y
+0f44 : 85 4c __ STA T7 + 1
+0f46 : 18 __ __ CLC
+0f47 : a5 61 __ LDA T4 + 0
+0f49 : 69 02 __ ADC #$02
+0f4b : 85 61 __ STA T4 + 0
+0f4d : 90 02 __ BCC $0f51
+0f4f : e6 62 __ INC T4 + 1
+0f51 : a9 0a __ LDA #$0a
+0f53 : 85 43 __ STA T0 + 0
+0f55 : a5 4b __ LDA T7 + 0
+0f57 : 05 4c __ ORA T7 + 1
+0f59 : f0 03 __ BEQ $0f5e
+0f5b : 4c 1b 10 JMP $101b ; (sprintf + 1449)
+0f5e : ad f4 50 LDA $50f4 ; (sframe + 14)
+0f61 : c9 ff __ CMP #$ff
+0f63 : d0 03 __ BNE $0f68
+0f65 : 4c 0d 10 JMP $100d ; (sprintf + 1435)
+0f68 : 38 __ __ SEC
+0f69 : a9 0a __ LDA #$0a
+0f6b : ed f4 50 SBC $50f4 ; (sframe + 14)
+0f6e : 85 45 __ STA T2 + 0
+0f70 : c5 43 __ CMP T0 + 0
+0f72 : b0 0e __ BCS $0f82
+0f74 : c6 43 __ DEC T0 + 0
+0f76 : a9 30 __ LDA #$30
+0f78 : a4 43 __ LDY T0 + 0
+0f7a : 91 49 __ STA (T6 + 0),y
+0f7c : a5 45 __ LDA T2 + 0
+0f7e : c5 43 __ CMP T0 + 0
+0f80 : 90 f2 __ BCC $0f74
+0f82 : ad f9 50 LDA $50f9 ; (sframe + 19)
+0f85 : f0 33 __ BEQ $0fba
+0f87 : ad f5 50 LDA $50f5 ; (sframe + 15)
+0f8a : 85 4b __ STA T7 + 0
+0f8c : ad f6 50 LDA $50f6 ; (sframe + 16)
+0f8f : d0 29 __ BNE $0fba
+0f91 : a5 4b __ LDA T7 + 0
+0f93 : c9 10 __ CMP #$10
+0f95 : d0 23 __ BNE $0fba
+0f97 : 18 __ __ CLC
+0f98 : a5 43 __ LDA T0 + 0
+0f9a : 69 ff __ ADC #$ff
+0f9c : 18 __ __ CLC
+0f9d : 65 49 __ ADC T6 + 0
+0f9f : 85 4b __ STA T7 + 0
+0fa1 : a5 4a __ LDA T6 + 1
+0fa3 : 69 00 __ ADC #$00
+0fa5 : 85 4c __ STA T7 + 1
+0fa7 : a9 58 __ LDA #$58
+0fa9 : a0 00 __ LDY #$00
+0fab : 91 4b __ STA (T7 + 0),y
+0fad : 18 __ __ CLC
+0fae : a5 43 __ LDA T0 + 0
+0fb0 : 69 fe __ ADC #$fe
+0fb2 : 85 43 __ STA T0 + 0
+0fb4 : a9 30 __ LDA #$30
+0fb6 : a4 43 __ LDY T0 + 0
+0fb8 : 91 49 __ STA (T6 + 0),y
+0fba : ad f7 50 LDA $50f7 ; (sframe + 17)
+0fbd : f0 08 __ BEQ $0fc7
+0fbf : c6 43 __ DEC T0 + 0
+0fc1 : a9 2b __ LDA #$2b
+0fc3 : a4 43 __ LDY T0 + 0
+0fc5 : 91 49 __ STA (T6 + 0),y
+0fc7 : 38 __ __ SEC
+0fc8 : a9 0a __ LDA #$0a
+0fca : ed f3 50 SBC $50f3 ; (sframe + 13)
+0fcd : 85 4b __ STA T7 + 0
+0fcf : a9 00 __ LDA #$00
+0fd1 : e9 00 __ SBC #$00
+0fd3 : 49 80 __ EOR #$80
+0fd5 : c9 80 __ CMP #$80
+0fd7 : d0 04 __ BNE $0fdd
+0fd9 : a5 4b __ LDA T7 + 0
+0fdb : c5 43 __ CMP T0 + 0
+0fdd : 90 22 __ BCC $1001
+0fdf : a9 00 __ LDA #$00
+0fe1 : 85 45 __ STA T2 + 0
+0fe3 : a5 43 __ LDA T0 + 0
+0fe5 : c9 0a __ CMP #$0a
+0fe7 : 90 03 __ BCC $0fec
+0fe9 : 4c ae 0e JMP $0eae ; (sprintf + 1084)
+0fec : a4 43 __ LDY T0 + 0
+0fee : b1 49 __ LDA (T6 + 0),y
+0ff0 : a4 45 __ LDY T2 + 0
+0ff2 : 91 49 __ STA (T6 + 0),y
+0ff4 : e6 45 __ INC T2 + 0
+0ff6 : e6 43 __ INC T0 + 0
+0ff8 : a5 43 __ LDA T0 + 0
+0ffa : c9 0a __ CMP #$0a
+0ffc : 90 ee __ BCC $0fec
+0ffe : 4c ae 0e JMP $0eae ; (sprintf + 1084)
+1001 : c6 43 __ DEC T0 + 0
+1003 : ad f2 50 LDA $50f2 ; (sframe + 12)
+1006 : a4 43 __ LDY T0 + 0
+1008 : 91 49 __ STA (T6 + 0),y
+100a : 4c c7 0f JMP $0fc7 ; (sprintf + 1365)
+100d : a9 09 __ LDA #$09
+100f : 85 45 __ STA T2 + 0
+1011 : c5 43 __ CMP T0 + 0
+1013 : b0 03 __ BCS $1018
+1015 : 4c 74 0f JMP $0f74 ; (sprintf + 1282)
+1018 : 4c 82 0f JMP $0f82 ; (sprintf + 1296)
+101b : a5 4b __ LDA T7 + 0
+101d : 85 1b __ STA ACCU + 0
+101f : a5 4c __ LDA T7 + 1
+1021 : 85 1c __ STA ACCU + 1
+1023 : ad f5 50 LDA $50f5 ; (sframe + 15)
+1026 : 85 03 __ STA $03
+1028 : ad f6 50 LDA $50f6 ; (sframe + 16)
+102b : 85 04 __ STA $04
+102d : 20 20 20 JSR $2020 ; (divmod + 0)
+1030 : a5 06 __ LDA $06
+1032 : 10 2f __ BPL $1063
+1034 : 18 __ __ CLC
+1035 : a5 05 __ LDA $05
+1037 : 69 30 __ ADC #$30
+1039 : c6 43 __ DEC T0 + 0
+103b : a4 43 __ LDY T0 + 0
+103d : 91 49 __ STA (T6 + 0),y
+103f : a5 4b __ LDA T7 + 0
+1041 : 85 1b __ STA ACCU + 0
+1043 : a5 4c __ LDA T7 + 1
+1045 : 85 1c __ STA ACCU + 1
+1047 : ad f5 50 LDA $50f5 ; (sframe + 15)
+104a : 85 03 __ STA $03
+104c : ad f6 50 LDA $50f6 ; (sframe + 16)
+104f : 85 04 __ STA $04
+1051 : 20 20 20 JSR $2020 ; (divmod + 0)
+1054 : a5 1b __ LDA ACCU + 0
+1056 : 85 4b __ STA T7 + 0
+1058 : a5 1c __ LDA ACCU + 1
+105a : 85 4c __ STA T7 + 1
+105c : 05 1b __ ORA ACCU + 0
+105e : d0 bb __ BNE $101b
+1060 : 4c 5e 0f JMP $0f5e ; (sprintf + 1260)
+1063 : d0 06 __ BNE $106b
+1065 : a5 05 __ LDA $05
+1067 : c9 0a __ CMP #$0a
+1069 : 90 c9 __ BCC $1034
+106b : 18 __ __ CLC
+106c : a5 05 __ LDA $05
+106e : 69 37 __ ADC #$37
+1070 : 4c 39 10 JMP $1039 ; (sprintf + 1479)
+1073 : a5 5f __ LDA T3 + 0
+1075 : 85 49 __ STA T6 + 0
+1077 : a5 60 __ LDA T3 + 1
+1079 : 85 4a __ STA T6 + 1
+107b : a0 00 __ LDY #$00
+107d : b1 61 __ LDA (T4 + 0),y
+107f : 85 4b __ STA T7 + 0
+1081 : c8 __ __ INY
+1082 : b1 61 __ LDA (T4 + 0),y
+1084 : 85 4c __ STA T7 + 1
+1086 : 18 __ __ CLC
+1087 : a5 61 __ LDA T4 + 0
+1089 : 69 02 __ ADC #$02
+108b : 85 61 __ STA T4 + 0
+108d : 90 02 __ BCC $1091
+108f : e6 62 __ INC T4 + 1
+1091 : a5 4c __ LDA T7 + 1
+1093 : 10 03 __ BPL $1098
+1095 : 4c de 11 JMP $11de ; (sprintf + 1900)
+1098 : a5 4b __ LDA T7 + 0
+109a : 85 4d __ STA T8 + 0
+109c : a5 4c __ LDA T7 + 1
+109e : 85 4e __ STA T8 + 1
+10a0 : a9 00 __ LDA #$00
+10a2 : 85 43 __ STA T0 + 0
+10a4 : a9 0a __ LDA #$0a
+10a6 : 85 45 __ STA T2 + 0
+10a8 : a5 4b __ LDA T7 + 0
+10aa : 05 4c __ ORA T7 + 1
+10ac : f0 03 __ BEQ $10b1
+10ae : 4c 86 11 JMP $1186 ; (sprintf + 1812)
+10b1 : ad f4 50 LDA $50f4 ; (sframe + 14)
+10b4 : c9 ff __ CMP #$ff
+10b6 : d0 03 __ BNE $10bb
+10b8 : 4c 78 11 JMP $1178 ; (sprintf + 1798)
+10bb : 38 __ __ SEC
+10bc : a9 0a __ LDA #$0a
+10be : ed f4 50 SBC $50f4 ; (sframe + 14)
+10c1 : 85 47 __ STA T5 + 0
+10c3 : c5 45 __ CMP T2 + 0
+10c5 : b0 0e __ BCS $10d5
+10c7 : c6 45 __ DEC T2 + 0
+10c9 : a9 30 __ LDA #$30
+10cb : a4 45 __ LDY T2 + 0
+10cd : 91 49 __ STA (T6 + 0),y
+10cf : a5 47 __ LDA T5 + 0
+10d1 : c5 45 __ CMP T2 + 0
+10d3 : 90 f2 __ BCC $10c7
+10d5 : ad f9 50 LDA $50f9 ; (sframe + 19)
+10d8 : f0 33 __ BEQ $110d
+10da : ad f5 50 LDA $50f5 ; (sframe + 15)
+10dd : 85 4b __ STA T7 + 0
+10df : ad f6 50 LDA $50f6 ; (sframe + 16)
+10e2 : d0 29 __ BNE $110d
+10e4 : a5 4b __ LDA T7 + 0
+10e6 : c9 10 __ CMP #$10
+10e8 : d0 23 __ BNE $110d
+10ea : 18 __ __ CLC
+10eb : a5 45 __ LDA T2 + 0
+10ed : 69 ff __ ADC #$ff
+10ef : 18 __ __ CLC
+10f0 : 65 49 __ ADC T6 + 0
+10f2 : 85 4b __ STA T7 + 0
+10f4 : a5 4a __ LDA T6 + 1
+10f6 : 69 00 __ ADC #$00
+10f8 : 85 4c __ STA T7 + 1
+10fa : a9 58 __ LDA #$58
+10fc : a0 00 __ LDY #$00
+10fe : 91 4b __ STA (T7 + 0),y
+1100 : 18 __ __ CLC
+1101 : a5 45 __ LDA T2 + 0
+1103 : 69 fe __ ADC #$fe
+1105 : 85 45 __ STA T2 + 0
+1107 : a9 30 __ LDA #$30
+1109 : a4 45 __ LDY T2 + 0
+110b : 91 49 __ STA (T6 + 0),y
+110d : a5 43 __ LDA T0 + 0
+110f : d0 5c __ BNE $116d
+1111 : ad f7 50 LDA $50f7 ; (sframe + 17)
+1114 : f0 08 __ BEQ $111e
+1116 : c6 45 __ DEC T2 + 0
+1118 : a9 2b __ LDA #$2b
+111a : a4 45 __ LDY T2 + 0
+111c : 91 49 __ STA (T6 + 0),y
+111e : 38 __ __ SEC
+111f : a9 0a __ LDA #$0a
+1121 : ed f3 50 SBC $50f3 ; (sframe + 13)
+1124 : 85 4b __ STA T7 + 0
+1126 : a9 00 __ LDA #$00
+1128 : e9 00 __ SBC #$00
+112a : 49 80 __ EOR #$80
+112c : c9 80 __ CMP #$80
+112e : d0 04 __ BNE $1134
+1130 : a5 4b __ LDA T7 + 0
+1132 : c5 45 __ CMP T2 + 0
+1134 : 90 2b __ BCC $1161
+1136 : a9 00 __ LDA #$00
+1138 : 85 43 __ STA T0 + 0
+113a : a5 45 __ LDA T2 + 0
+113c : c9 0a __ CMP #$0a
+113e : b0 12 __ BCS $1152
+1140 : a4 45 __ LDY T2 + 0
+1142 : b1 49 __ LDA (T6 + 0),y
+1144 : a4 43 __ LDY T0 + 0
+1146 : 91 49 __ STA (T6 + 0),y
+1148 : e6 43 __ INC T0 + 0
+114a : e6 45 __ INC T2 + 0
+114c : a5 45 __ LDA T2 + 0
+114e : c9 0a __ CMP #$0a
+1150 : 90 ee __ BCC $1140
+1152 : a0 00 __ LDY #$00
+1154 : b1 5d __ LDA (T1 + 0),y
+1156 : 85 47 __ STA T5 + 0
+1158 : e6 5d __ INC T1 + 0
+115a : d0 02 __ BNE $115e
+115c : e6 5e __ INC T1 + 1
+115e : 4c 0b 0b JMP $0b0b ; (sprintf + 153)
+1161 : c6 45 __ DEC T2 + 0
+1163 : ad f2 50 LDA $50f2 ; (sframe + 12)
+1166 : a4 45 __ LDY T2 + 0
+1168 : 91 49 __ STA (T6 + 0),y
+116a : 4c 1e 11 JMP $111e ; (sprintf + 1708)
+116d : c6 45 __ DEC T2 + 0
+116f : a9 2d __ LDA #$2d
+1171 : a4 45 __ LDY T2 + 0
+1173 : 91 49 __ STA (T6 + 0),y
+1175 : 4c 1e 11 JMP $111e ; (sprintf + 1708)
+1178 : a9 09 __ LDA #$09
+117a : 85 47 __ STA T5 + 0
+117c : c5 45 __ CMP T2 + 0
+117e : b0 03 __ BCS $1183
+1180 : 4c c7 10 JMP $10c7 ; (sprintf + 1621)
+1183 : 4c d5 10 JMP $10d5 ; (sprintf + 1635)
+1186 : a5 4d __ LDA T8 + 0
+1188 : 85 1b __ STA ACCU + 0
+118a : a5 4e __ LDA T8 + 1
+118c : 85 1c __ STA ACCU + 1
+118e : ad f5 50 LDA $50f5 ; (sframe + 15)
+1191 : 85 03 __ STA $03
+1193 : ad f6 50 LDA $50f6 ; (sframe + 16)
+1196 : 85 04 __ STA $04
+1198 : 20 20 20 JSR $2020 ; (divmod + 0)
+119b : a5 06 __ LDA $06
+119d : 10 2f __ BPL $11ce
+119f : 18 __ __ CLC
+11a0 : a5 05 __ LDA $05
+11a2 : 69 30 __ ADC #$30
+11a4 : c6 45 __ DEC T2 + 0
+11a6 : a4 45 __ LDY T2 + 0
+11a8 : 91 49 __ STA (T6 + 0),y
+11aa : a5 4d __ LDA T8 + 0
+11ac : 85 1b __ STA ACCU + 0
+11ae : a5 4e __ LDA T8 + 1
+11b0 : 85 1c __ STA ACCU + 1
+11b2 : ad f5 50 LDA $50f5 ; (sframe + 15)
+11b5 : 85 03 __ STA $03
+11b7 : ad f6 50 LDA $50f6 ; (sframe + 16)
+11ba : 85 04 __ STA $04
+11bc : 20 20 20 JSR $2020 ; (divmod + 0)
+11bf : a5 1b __ LDA ACCU + 0
+11c1 : 85 4d __ STA T8 + 0
+11c3 : a5 1c __ LDA ACCU + 1
+11c5 : 85 4e __ STA T8 + 1
+11c7 : 05 1b __ ORA ACCU + 0
+11c9 : d0 bb __ BNE $1186
+11cb : 4c b1 10 JMP $10b1 ; (sprintf + 1599)
+11ce : d0 06 __ BNE $11d6
+11d0 : a5 05 __ LDA $05
+11d2 : c9 0a __ CMP #$0a
+11d4 : 90 c9 __ BCC $119f
+11d6 : 18 __ __ CLC
+11d7 : a5 05 __ LDA $05
+11d9 : 69 37 __ ADC #$37
+11db : 4c a4 11 JMP $11a4 ; (sprintf + 1842)
+11de : a9 01 __ LDA #$01
+11e0 : 85 43 __ STA T0 + 0
+11e2 : a9 0a __ LDA #$0a
+11e4 : 85 45 __ STA T2 + 0
+11e6 : 38 __ __ SEC
+11e7 : a9 00 __ LDA #$00
+11e9 : e5 4b __ SBC T7 + 0
+11eb : 85 4d __ STA T8 + 0
+11ed : a9 00 __ LDA #$00
+11ef : e5 4c __ SBC T7 + 1
+11f1 : 85 4e __ STA T8 + 1
+11f3 : 05 4d __ ORA T8 + 0
+11f5 : d0 8f __ BNE $1186
+11f7 : 4c b1 10 JMP $10b1 ; (sprintf + 1599)
+11fa : a9 00 __ LDA #$00
+11fc : 85 49 __ STA T6 + 0
+11fe : 85 4a __ STA T6 + 1
+1200 : a0 00 __ LDY #$00
+1202 : b1 5d __ LDA (T1 + 0),y
+1204 : 85 45 __ STA T2 + 0
+1206 : e6 5d __ INC T1 + 0
+1208 : d0 02 __ BNE $120c
+120a : e6 5e __ INC T1 + 1
+120c : a5 45 __ LDA T2 + 0
+120e : c9 30 __ CMP #$30
+1210 : 90 4d __ BCC $125f
+1212 : a9 39 __ LDA #$39
+1214 : c5 45 __ CMP T2 + 0
+1216 : 90 47 __ BCC $125f
+1218 : a5 45 __ LDA T2 + 0
+121a : 85 4b __ STA T7 + 0
+121c : a0 00 __ LDY #$00
+121e : b1 5d __ LDA (T1 + 0),y
+1220 : 85 45 __ STA T2 + 0
+1222 : e6 5d __ INC T1 + 0
+1224 : d0 02 __ BNE $1228
+1226 : e6 5e __ INC T1 + 1
+1228 : a5 49 __ LDA T6 + 0
+122a : 0a __ __ ASL
+122b : 85 07 __ STA $07
+122d : a5 4a __ LDA T6 + 1
+122f : 2a __ __ ROL
+1230 : 06 07 __ ASL $07
+1232 : 2a __ __ ROL
+1233 : aa __ __ TAX
+1234 : 18 __ __ CLC
+1235 : a5 07 __ LDA $07
+1237 : 65 49 __ ADC T6 + 0
+1239 : 85 1b __ STA ACCU + 0
+123b : 8a __ __ TXA
+123c : 65 4a __ ADC T6 + 1
+123e : 06 1b __ ASL ACCU + 0
+1240 : 2a __ __ ROL
+1241 : 85 1c __ STA ACCU + 1
+1243 : 18 __ __ CLC
+1244 : a5 1b __ LDA ACCU + 0
+1246 : 65 4b __ ADC T7 + 0
+1248 : aa __ __ TAX
+1249 : a5 1c __ LDA ACCU + 1
+124b : 69 00 __ ADC #$00
+124d : a8 __ __ TAY
+124e : 38 __ __ SEC
+124f : 8a __ __ TXA
+1250 : e9 30 __ SBC #$30
+1252 : 85 49 __ STA T6 + 0
+1254 : 98 __ __ TYA
+1255 : e9 00 __ SBC #$00
+1257 : 85 4a __ STA T6 + 1
+1259 : a5 45 __ LDA T2 + 0
+125b : c9 30 __ CMP #$30
+125d : b0 b3 __ BCS $1212
+125f : a5 49 __ LDA T6 + 0
+1261 : 8d f4 50 STA $50f4 ; (sframe + 14)
+1264 : 4c ec 0b JMP $0bec ; (sprintf + 378)
+1267 : a9 01 __ LDA #$01
+1269 : 8d f9 50 STA $50f9 ; (sframe + 19)
+126c : a0 00 __ LDY #$00
+126e : b1 5d __ LDA (T1 + 0),y
+1270 : 85 45 __ STA T2 + 0
+1272 : 4c 5e 0b JMP $0b5e ; (sprintf + 236)
+1275 : a9 30 __ LDA #$30
+1277 : 8d f2 50 STA $50f2 ; (sframe + 12)
+127a : a0 00 __ LDY #$00
+127c : b1 5d __ LDA (T1 + 0),y
+127e : 85 45 __ STA T2 + 0
+1280 : 4c 5e 0b JMP $0b5e ; (sprintf + 236)
+1283 : a9 01 __ LDA #$01
+1285 : 8d f7 50 STA $50f7 ; (sframe + 17)
+1288 : a0 00 __ LDY #$00
+128a : b1 5d __ LDA (T1 + 0),y
+128c : 85 45 __ STA T2 + 0
+128e : 4c 5e 0b JMP $0b5e ; (sprintf + 236)
+--------------------------------------------------------------------
+nforml:
+1291 : a5 11 __ LDA P4
+1293 : 85 47 __ STA T1 + 0
+1295 : a5 12 __ LDA P5
+1297 : 85 48 __ STA T1 + 1
+1299 : a5 13 __ LDA P6
+129b : 85 49 __ STA T1 + 2
+129d : a5 14 __ LDA P7
+129f : 85 4a __ STA T1 + 3
+12a1 : a9 00 __ LDA #$00
+12a3 : 85 4d __ STA T3 + 0
+12a5 : a5 15 __ LDA P8
+12a7 : f0 03 __ BEQ $12ac
+12a9 : 4c 38 14 JMP $1438 ; (nforml + 423)
+12ac : a9 10 __ LDA #$10
+12ae : 85 4e __ STA T4 + 0
+12b0 : a9 00 __ LDA #$00
+12b2 : c5 14 __ CMP P7
+12b4 : d0 0a __ BNE $12c0
+12b6 : c5 13 __ CMP P6
+12b8 : d0 06 __ BNE $12c0
+12ba : c5 12 __ CMP P5
+12bc : d0 02 __ BNE $12c0
+12be : c5 11 __ CMP P4
+12c0 : b0 03 __ BCS $12c5
+12c2 : 4c ac 13 JMP $13ac ; (nforml + 283)
+12c5 : a0 02 __ LDY #$02
+12c7 : b1 0d __ LDA (P0),y
+12c9 : 85 4f __ STA T5 + 0
+12cb : c9 ff __ CMP #$ff
+12cd : d0 03 __ BNE $12d2
+12cf : 4c 9e 13 JMP $139e ; (nforml + 269)
+12d2 : 38 __ __ SEC
+12d3 : a9 10 __ LDA #$10
+12d5 : e5 4f __ SBC T5 + 0
+12d7 : 85 4f __ STA T5 + 0
+12d9 : c5 4e __ CMP T4 + 0
+12db : b0 0e __ BCS $12eb
+12dd : c6 4e __ DEC T4 + 0
+12df : a9 30 __ LDA #$30
+12e1 : a4 4e __ LDY T4 + 0
+12e3 : 91 0f __ STA (P2),y
+12e5 : a5 4f __ LDA T5 + 0
+12e7 : c5 4e __ CMP T4 + 0
+12e9 : 90 f2 __ BCC $12dd
+12eb : a0 07 __ LDY #$07
+12ed : b1 0d __ LDA (P0),y
+12ef : f0 34 __ BEQ $1325
+12f1 : a0 03 __ LDY #$03
+12f3 : b1 0d __ LDA (P0),y
+12f5 : 85 53 __ STA T7 + 0
+12f7 : c8 __ __ INY
+12f8 : b1 0d __ LDA (P0),y
+12fa : d0 29 __ BNE $1325
+12fc : a5 53 __ LDA T7 + 0
+12fe : c9 10 __ CMP #$10
+1300 : d0 23 __ BNE $1325
+1302 : 18 __ __ CLC
+1303 : a5 4e __ LDA T4 + 0
+1305 : 69 ff __ ADC #$ff
+1307 : 18 __ __ CLC
+1308 : 65 0f __ ADC P2
+130a : 85 53 __ STA T7 + 0
+130c : a5 10 __ LDA P3
+130e : 69 00 __ ADC #$00
+1310 : 85 54 __ STA T7 + 1
+1312 : a9 58 __ LDA #$58
+1314 : a0 00 __ LDY #$00
+1316 : 91 53 __ STA (T7 + 0),y
+1318 : 18 __ __ CLC
+1319 : a5 4e __ LDA T4 + 0
+131b : 69 fe __ ADC #$fe
+131d : 85 4e __ STA T4 + 0
+131f : a9 30 __ LDA #$30
+1321 : a4 4e __ LDY T4 + 0
+1323 : 91 0f __ STA (P2),y
+1325 : a5 4d __ LDA T3 + 0
+1327 : d0 6a __ BNE $1393
+1329 : a0 05 __ LDY #$05
+132b : b1 0d __ LDA (P0),y
+132d : f0 08 __ BEQ $1337
+132f : c6 4e __ DEC T4 + 0
+1331 : a9 2b __ LDA #$2b
+1333 : a4 4e __ LDY T4 + 0
+1335 : 91 0f __ STA (P2),y
+1337 : a0 01 __ LDY #$01
+1339 : b1 0d __ LDA (P0),y
+133b : 85 53 __ STA T7 + 0
+133d : 38 __ __ SEC
+133e : a9 10 __ LDA #$10
+1340 : e5 53 __ SBC T7 + 0
+1342 : 85 53 __ STA T7 + 0
+1344 : a9 00 __ LDA #$00
+1346 : e9 00 __ SBC #$00
+1348 : 49 80 __ EOR #$80
+134a : c9 80 __ CMP #$80
+134c : d0 04 __ BNE $1352
+134e : a5 53 __ LDA T7 + 0
+1350 : c5 4e __ CMP T4 + 0
+1352 : 90 32 __ BCC $1386
+1354 : a9 00 __ LDA #$00
+1356 : 85 4d __ STA T3 + 0
+1358 : a5 4e __ LDA T4 + 0
+135a : c9 10 __ CMP #$10
+135c : 90 09 __ BCC $1367
+135e : a5 4d __ LDA T3 + 0
+1360 : 85 1b __ STA ACCU + 0
+1362 : a9 00 __ LDA #$00
+1364 : 85 1c __ STA ACCU + 1
+1366 : 60 __ __ RTS
+1367 : aa __ __ TAX
+1368 : 8a __ __ TXA
+1369 : 18 __ __ CLC
+136a : 65 0f __ ADC P2
+136c : 85 51 __ STA T6 + 0
+136e : a5 10 __ LDA P3
+1370 : 69 00 __ ADC #$00
+1372 : 85 52 __ STA T6 + 1
+1374 : a0 00 __ LDY #$00
+1376 : b1 51 __ LDA (T6 + 0),y
+1378 : a4 4d __ LDY T3 + 0
+137a : 91 0f __ STA (P2),y
+137c : e6 4d __ INC T3 + 0
+137e : e8 __ __ INX
+137f : e0 10 __ CPX #$10
+1381 : 90 e5 __ BCC $1368
+1383 : 4c 5e 13 JMP $135e ; (nforml + 205)
+1386 : c6 4e __ DEC T4 + 0
+1388 : a0 00 __ LDY #$00
+138a : b1 0d __ LDA (P0),y
+138c : a4 4e __ LDY T4 + 0
+138e : 91 0f __ STA (P2),y
+1390 : 4c 37 13 JMP $1337 ; (nforml + 166)
+1393 : c6 4e __ DEC T4 + 0
+1395 : a9 2d __ LDA #$2d
+1397 : a4 4e __ LDY T4 + 0
+1399 : 91 0f __ STA (P2),y
+139b : 4c 37 13 JMP $1337 ; (nforml + 166)
+139e : a9 0f __ LDA #$0f
+13a0 : 85 4f __ STA T5 + 0
+13a2 : c5 4e __ CMP T4 + 0
+13a4 : b0 03 __ BCS $13a9
+13a6 : 4c dd 12 JMP $12dd ; (nforml + 76)
+13a9 : 4c eb 12 JMP $12eb ; (nforml + 90)
+13ac : a0 03 __ LDY #$03
+13ae : b1 0d __ LDA (P0),y
+13b0 : 85 03 __ STA $03
+13b2 : c8 __ __ INY
+13b3 : b1 0d __ LDA (P0),y
+13b5 : 85 04 __ STA $04
+13b7 : a9 00 __ LDA #$00
+13b9 : 85 05 __ STA $05
+13bb : 85 06 __ STA $06
+13bd : a5 47 __ LDA T1 + 0
+13bf : 85 1b __ STA ACCU + 0
+13c1 : a5 48 __ LDA T1 + 1
+13c3 : 85 1c __ STA ACCU + 1
+13c5 : a5 49 __ LDA T1 + 2
+13c7 : 85 1d __ STA ACCU + 2
+13c9 : a5 4a __ LDA T1 + 3
+13cb : 85 1e __ STA ACCU + 3
+13cd : 20 ac 21 JSR $21ac ; (divmod32 + 0)
+13d0 : a5 08 __ LDA $08
+13d2 : 10 54 __ BPL $1428
+13d4 : 18 __ __ CLC
+13d5 : a5 07 __ LDA $07
+13d7 : 69 30 __ ADC #$30
+13d9 : c6 4e __ DEC T4 + 0
+13db : a4 4e __ LDY T4 + 0
+13dd : 91 0f __ STA (P2),y
+13df : a0 03 __ LDY #$03
+13e1 : b1 0d __ LDA (P0),y
+13e3 : 85 03 __ STA $03
+13e5 : c8 __ __ INY
+13e6 : b1 0d __ LDA (P0),y
+13e8 : 85 04 __ STA $04
+13ea : a9 00 __ LDA #$00
+13ec : 85 05 __ STA $05
+13ee : 85 06 __ STA $06
+13f0 : a5 47 __ LDA T1 + 0
+13f2 : 85 1b __ STA ACCU + 0
+13f4 : a5 48 __ LDA T1 + 1
+13f6 : 85 1c __ STA ACCU + 1
+13f8 : a5 49 __ LDA T1 + 2
+13fa : 85 1d __ STA ACCU + 2
+13fc : a5 4a __ LDA T1 + 3
+13fe : 85 1e __ STA ACCU + 3
+1400 : 20 ac 21 JSR $21ac ; (divmod32 + 0)
+1403 : a5 1b __ LDA ACCU + 0
+1405 : 85 47 __ STA T1 + 0
+1407 : a5 1c __ LDA ACCU + 1
+1409 : 85 48 __ STA T1 + 1
+140b : a5 1d __ LDA ACCU + 2
+140d : 85 49 __ STA T1 + 2
+140f : a5 1e __ LDA ACCU + 3
+1411 : 85 4a __ STA T1 + 3
+1413 : a9 00 __ LDA #$00
+1415 : c5 1e __ CMP ACCU + 3
+1417 : d0 0a __ BNE $1423
+1419 : c5 1d __ CMP ACCU + 2
+141b : d0 06 __ BNE $1423
+141d : c5 1c __ CMP ACCU + 1
+141f : d0 02 __ BNE $1423
+1421 : c5 1b __ CMP ACCU + 0
+1423 : 90 87 __ BCC $13ac
+1425 : 4c c5 12 JMP $12c5 ; (nforml + 52)
+1428 : d0 06 __ BNE $1430
+142a : a5 07 __ LDA $07
+142c : c9 0a __ CMP #$0a
+142e : 90 a4 __ BCC $13d4
+1430 : 18 __ __ CLC
+1431 : a5 07 __ LDA $07
+1433 : 69 37 __ ADC #$37
+1435 : 4c d9 13 JMP $13d9 ; (nforml + 328)
+1438 : a5 14 __ LDA P7
+143a : 49 80 __ EOR #$80
+143c : c9 80 __ CMP #$80
+143e : d0 0f __ BNE $144f
+1440 : a5 13 __ LDA P6
+1442 : c9 00 __ CMP #$00
+1444 : d0 09 __ BNE $144f
+1446 : a5 12 __ LDA P5
+1448 : c9 00 __ CMP #$00
+144a : d0 03 __ BNE $144f
+144c : 4c ac 12 JMP $12ac ; (nforml + 27)
+144f : 90 03 __ BCC $1454
+1451 : 4c ac 12 JMP $12ac ; (nforml + 27)
+1454 : a9 01 __ LDA #$01
+1456 : 85 4d __ STA T3 + 0
+1458 : a9 10 __ LDA #$10
+145a : 85 4e __ STA T4 + 0
+145c : 38 __ __ SEC
+145d : a9 00 __ LDA #$00
+145f : e5 11 __ SBC P4
+1461 : 85 47 __ STA T1 + 0
+1463 : a9 00 __ LDA #$00
+1465 : e5 12 __ SBC P5
+1467 : 85 48 __ STA T1 + 1
+1469 : a9 00 __ LDA #$00
+146b : e5 13 __ SBC P6
+146d : 85 49 __ STA T1 + 2
+146f : a9 00 __ LDA #$00
+1471 : e5 14 __ SBC P7
+1473 : 85 4a __ STA T1 + 3
+1475 : a9 00 __ LDA #$00
+1477 : c5 4a __ CMP T1 + 3
+1479 : d0 0a __ BNE $1485
+147b : c5 49 __ CMP T1 + 2
+147d : d0 06 __ BNE $1485
+147f : c5 48 __ CMP T1 + 1
+1481 : d0 02 __ BNE $1485
+1483 : c5 47 __ CMP T1 + 0
+1485 : b0 03 __ BCS $148a
+1487 : 4c ac 13 JMP $13ac ; (nforml + 283)
+148a : 4c c5 12 JMP $12c5 ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+148d : a9 00 __ LDA #$00
+148f : 85 1b __ STA ACCU + 0
+1491 : 85 1c __ STA ACCU + 1
+1493 : 85 1d __ STA ACCU + 2
+1495 : 85 1e __ STA ACCU + 3
+1497 : a5 11 __ LDA P4
+1499 : 85 03 __ STA $03
+149b : a5 12 __ LDA P5
+149d : 85 04 __ STA $04
+149f : a5 13 __ LDA P6
+14a1 : 85 05 __ STA $05
+14a3 : a5 14 __ LDA P7
+14a5 : 85 06 __ STA $06
+14a7 : 20 5b 21 JSR $215b ; (fcmp + 0)
+14aa : 10 03 __ BPL $14af
+14ac : 4c c7 1a JMP $1ac7 ; (nformf + 1594)
+14af : a9 00 __ LDA #$00
+14b1 : 85 4b __ STA T3 + 0
+14b3 : a0 05 __ LDY #$05
+14b5 : b1 0d __ LDA (P0),y
+14b7 : f0 0a __ BEQ $14c3
+14b9 : a9 2b __ LDA #$2b
+14bb : a0 00 __ LDY #$00
+14bd : 91 0f __ STA (P2),y
+14bf : a9 01 __ LDA #$01
+14c1 : 85 4b __ STA T3 + 0
+14c3 : a9 00 __ LDA #$00
+14c5 : 85 43 __ STA T0 + 0
+14c7 : 85 44 __ STA T0 + 1
+14c9 : a0 02 __ LDY #$02
+14cb : b1 0d __ LDA (P0),y
+14cd : 85 4e __ STA T5 + 0
+14cf : c9 ff __ CMP #$ff
+14d1 : d0 04 __ BNE $14d7
+14d3 : a9 06 __ LDA #$06
+14d5 : 85 4e __ STA T5 + 0
+14d7 : a9 00 __ LDA #$00
+14d9 : 85 1b __ STA ACCU + 0
+14db : 85 1c __ STA ACCU + 1
+14dd : 85 1d __ STA ACCU + 2
+14df : 85 1e __ STA ACCU + 3
+14e1 : a5 11 __ LDA P4
+14e3 : 85 03 __ STA $03
+14e5 : a5 12 __ LDA P5
+14e7 : 85 04 __ STA $04
+14e9 : a5 13 __ LDA P6
+14eb : 85 05 __ STA $05
+14ed : a5 14 __ LDA P7
+14ef : 85 06 __ STA $06
+14f1 : 20 5b 21 JSR $215b ; (fcmp + 0)
+14f4 : d0 03 __ BNE $14f9
+14f6 : 4c 7d 16 JMP $167d ; (nformf + 496)
+14f9 : a9 00 __ LDA #$00
+14fb : 85 1b __ STA ACCU + 0
+14fd : 85 1c __ STA ACCU + 1
+14ff : a9 7a __ LDA #$7a
+1501 : 85 1d __ STA ACCU + 2
+1503 : a9 44 __ LDA #$44
+1505 : 85 1e __ STA ACCU + 3
+1507 : a5 11 __ LDA P4
+1509 : 85 03 __ STA $03
+150b : a5 12 __ LDA P5
+150d : 85 04 __ STA $04
+150f : a5 13 __ LDA P6
+1511 : 85 05 __ STA $05
+1513 : a5 14 __ LDA P7
+1515 : 85 06 __ STA $06
+1517 : 20 5b 21 JSR $215b ; (fcmp + 0)
+151a : 30 5a __ BMI $1576
+151c : a5 11 __ LDA P4
+151e : 85 1b __ STA ACCU + 0
+1520 : a5 12 __ LDA P5
+1522 : 85 1c __ STA ACCU + 1
+1524 : a5 13 __ LDA P6
+1526 : 85 1d __ STA ACCU + 2
+1528 : a5 14 __ LDA P7
+152a : 85 1e __ STA ACCU + 3
+152c : a9 00 __ LDA #$00
+152e : 85 03 __ STA $03
+1530 : 85 04 __ STA $04
+1532 : a9 7a __ LDA #$7a
+1534 : 85 05 __ STA $05
+1536 : a9 44 __ LDA #$44
+1538 : 85 06 __ STA $06
+153a : 20 d1 1d JSR $1dd1 ; (freg + 20)
+153d : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1540 : a5 1b __ LDA ACCU + 0
+1542 : 85 11 __ STA P4
+1544 : 85 03 __ STA $03
+1546 : a5 1c __ LDA ACCU + 1
+1548 : 85 12 __ STA P5
+154a : 85 04 __ STA $04
+154c : a5 1d __ LDA ACCU + 2
+154e : 85 13 __ STA P6
+1550 : 85 05 __ STA $05
+1552 : a5 1e __ LDA ACCU + 3
+1554 : 85 14 __ STA P7
+1556 : 85 06 __ STA $06
+1558 : 18 __ __ CLC
+1559 : a5 43 __ LDA T0 + 0
+155b : 69 03 __ ADC #$03
+155d : 85 43 __ STA T0 + 0
+155f : 90 02 __ BCC $1563
+1561 : e6 44 __ INC T0 + 1
+1563 : a9 00 __ LDA #$00
+1565 : 85 1b __ STA ACCU + 0
+1567 : 85 1c __ STA ACCU + 1
+1569 : a9 7a __ LDA #$7a
+156b : 85 1d __ STA ACCU + 2
+156d : a9 44 __ LDA #$44
+156f : 85 1e __ STA ACCU + 3
+1571 : 20 5b 21 JSR $215b ; (fcmp + 0)
+1574 : 10 a6 __ BPL $151c
+1576 : a9 00 __ LDA #$00
+1578 : 85 1b __ STA ACCU + 0
+157a : 85 1c __ STA ACCU + 1
+157c : a9 80 __ LDA #$80
+157e : 85 1d __ STA ACCU + 2
+1580 : a9 3f __ LDA #$3f
+1582 : 85 1e __ STA ACCU + 3
+1584 : a5 11 __ LDA P4
+1586 : 85 03 __ STA $03
+1588 : a5 12 __ LDA P5
+158a : 85 04 __ STA $04
+158c : a5 13 __ LDA P6
+158e : 85 05 __ STA $05
+1590 : a5 14 __ LDA P7
+1592 : 85 06 __ STA $06
+1594 : 20 5b 21 JSR $215b ; (fcmp + 0)
+1597 : 10 5c __ BPL $15f5
+1599 : a5 11 __ LDA P4
+159b : 85 1b __ STA ACCU + 0
+159d : a5 12 __ LDA P5
+159f : 85 1c __ STA ACCU + 1
+15a1 : a5 13 __ LDA P6
+15a3 : 85 1d __ STA ACCU + 2
+15a5 : a5 14 __ LDA P7
+15a7 : 85 1e __ STA ACCU + 3
+15a9 : a9 00 __ LDA #$00
+15ab : 85 03 __ STA $03
+15ad : 85 04 __ STA $04
+15af : a9 7a __ LDA #$7a
+15b1 : 85 05 __ STA $05
+15b3 : a9 44 __ LDA #$44
+15b5 : 85 06 __ STA $06
+15b7 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+15ba : 20 ca 1e JSR $1eca ; (fmul + 0)
+15bd : a5 1b __ LDA ACCU + 0
+15bf : 85 11 __ STA P4
+15c1 : 85 03 __ STA $03
+15c3 : a5 1c __ LDA ACCU + 1
+15c5 : 85 12 __ STA P5
+15c7 : 85 04 __ STA $04
+15c9 : a5 1d __ LDA ACCU + 2
+15cb : 85 13 __ STA P6
+15cd : 85 05 __ STA $05
+15cf : a5 1e __ LDA ACCU + 3
+15d1 : 85 14 __ STA P7
+15d3 : 85 06 __ STA $06
+15d5 : 38 __ __ SEC
+15d6 : a5 43 __ LDA T0 + 0
+15d8 : e9 03 __ SBC #$03
+15da : 85 43 __ STA T0 + 0
+15dc : a5 44 __ LDA T0 + 1
+15de : e9 00 __ SBC #$00
+15e0 : 85 44 __ STA T0 + 1
+15e2 : a9 00 __ LDA #$00
+15e4 : 85 1b __ STA ACCU + 0
+15e6 : 85 1c __ STA ACCU + 1
+15e8 : a9 80 __ LDA #$80
+15ea : 85 1d __ STA ACCU + 2
+15ec : a9 3f __ LDA #$3f
+15ee : 85 1e __ STA ACCU + 3
+15f0 : 20 5b 21 JSR $215b ; (fcmp + 0)
+15f3 : 30 a4 __ BMI $1599
+15f5 : a9 00 __ LDA #$00
+15f7 : 85 1b __ STA ACCU + 0
+15f9 : 85 1c __ STA ACCU + 1
+15fb : a9 20 __ LDA #$20
+15fd : 85 1d __ STA ACCU + 2
+15ff : a9 41 __ LDA #$41
+1601 : 85 1e __ STA ACCU + 3
+1603 : a5 11 __ LDA P4
+1605 : 85 03 __ STA $03
+1607 : a5 12 __ LDA P5
+1609 : 85 04 __ STA $04
+160b : a5 13 __ LDA P6
+160d : 85 05 __ STA $05
+160f : a5 14 __ LDA P7
+1611 : 85 06 __ STA $06
+1613 : 20 5b 21 JSR $215b ; (fcmp + 0)
+1616 : 30 65 __ BMI $167d
+1618 : a5 11 __ LDA P4
+161a : 85 1b __ STA ACCU + 0
+161c : a5 12 __ LDA P5
+161e : 85 1c __ STA ACCU + 1
+1620 : a5 13 __ LDA P6
+1622 : 85 1d __ STA ACCU + 2
+1624 : a5 14 __ LDA P7
+1626 : 85 1e __ STA ACCU + 3
+1628 : a9 00 __ LDA #$00
+162a : 85 03 __ STA $03
+162c : 85 04 __ STA $04
+162e : a9 20 __ LDA #$20
+1630 : 85 05 __ STA $05
+1632 : a9 41 __ LDA #$41
+1634 : 85 06 __ STA $06
+1636 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1639 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+163c : a5 1b __ LDA ACCU + 0
+163e : 85 11 __ STA P4
+1640 : 85 47 __ STA T2 + 0
+1642 : a5 1c __ LDA ACCU + 1
+1644 : 85 12 __ STA P5
+1646 : 85 48 __ STA T2 + 1
+1648 : a5 1d __ LDA ACCU + 2
+164a : 85 13 __ STA P6
+164c : 85 49 __ STA T2 + 2
+164e : a5 1e __ LDA ACCU + 3
+1650 : 85 14 __ STA P7
+1652 : 85 4a __ STA T2 + 3
+1654 : e6 43 __ INC T0 + 0
+1656 : d0 02 __ BNE $165a
+1658 : e6 44 __ INC T0 + 1
+165a : a9 00 __ LDA #$00
+165c : 85 1b __ STA ACCU + 0
+165e : 85 1c __ STA ACCU + 1
+1660 : a9 20 __ LDA #$20
+1662 : 85 1d __ STA ACCU + 2
+1664 : a9 41 __ LDA #$41
+1666 : 85 1e __ STA ACCU + 3
+1668 : a5 47 __ LDA T2 + 0
+166a : 85 03 __ STA $03
+166c : a5 48 __ LDA T2 + 1
+166e : 85 04 __ STA $04
+1670 : a5 49 __ LDA T2 + 2
+1672 : 85 05 __ STA $05
+1674 : a5 4a __ LDA T2 + 3
+1676 : 85 06 __ STA $06
+1678 : 20 5b 21 JSR $215b ; (fcmp + 0)
+167b : 10 9b __ BPL $1618
+167d : a5 15 __ LDA P8
+167f : c9 65 __ CMP #$65
+1681 : d0 03 __ BNE $1686
+1683 : 4c c2 1a JMP $1ac2 ; (nformf + 1589)
+1686 : a9 00 __ LDA #$00
+1688 : 85 51 __ STA T7 + 0
+168a : 85 52 __ STA T8 + 0
+168c : a5 4e __ LDA T5 + 0
+168e : 85 4c __ STA T4 + 0
+1690 : e6 4c __ INC T4 + 0
+1692 : a5 15 __ LDA P8
+1694 : c9 67 __ CMP #$67
+1696 : d0 03 __ BNE $169b
+1698 : 4c a5 1a JMP $1aa5 ; (nformf + 1560)
+169b : a5 51 __ LDA T7 + 0
+169d : f0 03 __ BEQ $16a2
+169f : 4c b3 19 JMP $19b3 ; (nformf + 1318)
+16a2 : a5 44 __ LDA T0 + 1
+16a4 : 10 03 __ BPL $16a9
+16a6 : 4c 72 19 JMP $1972 ; (nformf + 1253)
+16a9 : a9 00 __ LDA #$00
+16ab : 85 47 __ STA T2 + 0
+16ad : 85 48 __ STA T2 + 1
+16af : 85 49 __ STA T2 + 2
+16b1 : a9 3f __ LDA #$3f
+16b3 : 85 4a __ STA T2 + 3
+16b5 : 18 __ __ CLC
+16b6 : a5 4e __ LDA T5 + 0
+16b8 : 65 43 __ ADC T0 + 0
+16ba : 85 4c __ STA T4 + 0
+16bc : e6 4c __ INC T4 + 0
+16be : a9 01 __ LDA #$01
+16c0 : c5 4c __ CMP T4 + 0
+16c2 : b0 03 __ BCS $16c7
+16c4 : 4c 31 19 JMP $1931 ; (nformf + 1188)
+16c7 : a5 11 __ LDA P4
+16c9 : 85 1b __ STA ACCU + 0
+16cb : a5 12 __ LDA P5
+16cd : 85 1c __ STA ACCU + 1
+16cf : a5 13 __ LDA P6
+16d1 : 85 1d __ STA ACCU + 2
+16d3 : a5 14 __ LDA P7
+16d5 : 85 1e __ STA ACCU + 3
+16d7 : a5 47 __ LDA T2 + 0
+16d9 : 85 03 __ STA $03
+16db : a5 48 __ LDA T2 + 1
+16dd : 85 04 __ STA $04
+16df : a5 49 __ LDA T2 + 2
+16e1 : 85 05 __ STA $05
+16e3 : a5 4a __ LDA T2 + 3
+16e5 : 85 06 __ STA $06
+16e7 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+16ea : 20 02 1e JSR $1e02 ; (faddsub + 0)
+16ed : a5 1b __ LDA ACCU + 0
+16ef : 85 11 __ STA P4
+16f1 : 85 47 __ STA T2 + 0
+16f3 : 85 03 __ STA $03
+16f5 : a5 1c __ LDA ACCU + 1
+16f7 : 85 12 __ STA P5
+16f9 : 85 48 __ STA T2 + 1
+16fb : 85 04 __ STA $04
+16fd : a5 1d __ LDA ACCU + 2
+16ff : 85 13 __ STA P6
+1701 : 85 49 __ STA T2 + 2
+1703 : 85 05 __ STA $05
+1705 : a5 1e __ LDA ACCU + 3
+1707 : 85 14 __ STA P7
+1709 : 85 4a __ STA T2 + 3
+170b : 85 06 __ STA $06
+170d : a9 00 __ LDA #$00
+170f : 85 1b __ STA ACCU + 0
+1711 : 85 1c __ STA ACCU + 1
+1713 : a9 20 __ LDA #$20
+1715 : 85 1d __ STA ACCU + 2
+1717 : a9 41 __ LDA #$41
+1719 : 85 1e __ STA ACCU + 3
+171b : 20 5b 21 JSR $215b ; (fcmp + 0)
+171e : 30 36 __ BMI $1756
+1720 : a5 47 __ LDA T2 + 0
+1722 : 85 1b __ STA ACCU + 0
+1724 : a5 48 __ LDA T2 + 1
+1726 : 85 1c __ STA ACCU + 1
+1728 : a5 49 __ LDA T2 + 2
+172a : 85 1d __ STA ACCU + 2
+172c : a5 4a __ LDA T2 + 3
+172e : 85 1e __ STA ACCU + 3
+1730 : a9 00 __ LDA #$00
+1732 : 85 03 __ STA $03
+1734 : 85 04 __ STA $04
+1736 : a9 20 __ LDA #$20
+1738 : 85 05 __ STA $05
+173a : a9 41 __ LDA #$41
+173c : 85 06 __ STA $06
+173e : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1741 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1744 : a5 1b __ LDA ACCU + 0
+1746 : 85 11 __ STA P4
+1748 : a5 1c __ LDA ACCU + 1
+174a : 85 12 __ STA P5
+174c : a5 1d __ LDA ACCU + 2
+174e : 85 13 __ STA P6
+1750 : a5 1e __ LDA ACCU + 3
+1752 : 85 14 __ STA P7
+1754 : c6 4e __ DEC T5 + 0
+1756 : 38 __ __ SEC
+1757 : a5 4c __ LDA T4 + 0
+1759 : e5 4e __ SBC T5 + 0
+175b : 85 53 __ STA T10 + 0
+175d : 85 4e __ STA T5 + 0
+175f : a9 14 __ LDA #$14
+1761 : c5 4c __ CMP T4 + 0
+1763 : b0 02 __ BCS $1767
+1765 : 85 4c __ STA T4 + 0
+1767 : a5 53 __ LDA T10 + 0
+1769 : d0 08 __ BNE $1773
+176b : a9 30 __ LDA #$30
+176d : a4 4b __ LDY T3 + 0
+176f : 91 0f __ STA (P2),y
+1771 : e6 4b __ INC T3 + 0
+1773 : a9 00 __ LDA #$00
+1775 : 85 50 __ STA T6 + 0
+1777 : a5 4c __ LDA T4 + 0
+1779 : f0 03 __ BEQ $177e
+177b : 4c a0 18 JMP $18a0 ; (nformf + 1043)
+177e : a5 52 __ LDA T8 + 0
+1780 : f0 03 __ BEQ $1785
+1782 : 4c 20 18 JMP $1820 ; (nformf + 915)
+1785 : a5 4b __ LDA T3 + 0
+1787 : a0 01 __ LDY #$01
+1789 : d1 0d __ CMP (P0),y
+178b : 90 07 __ BCC $1794
+178d : 85 1b __ STA ACCU + 0
+178f : a9 00 __ LDA #$00
+1791 : 85 1c __ STA ACCU + 1
+1793 : 60 __ __ RTS
+1794 : c9 01 __ CMP #$01
+1796 : 90 53 __ BCC $17eb
+1798 : a9 01 __ LDA #$01
+179a : 85 4e __ STA T5 + 0
+179c : a5 0d __ LDA P0
+179e : 85 43 __ STA T0 + 0
+17a0 : a5 0e __ LDA P1
+17a2 : 85 44 __ STA T0 + 1
+17a4 : a5 4b __ LDA T3 + 0
+17a6 : 85 4c __ STA T4 + 0
+17a8 : 38 __ __ SEC
+17a9 : a5 4c __ LDA T4 + 0
+17ab : e5 4e __ SBC T5 + 0
+17ad : 85 55 __ STA T11 + 0
+17af : a9 00 __ LDA #$00
+17b1 : e9 00 __ SBC #$00
+17b3 : 85 56 __ STA T11 + 1
+17b5 : 18 __ __ CLC
+17b6 : a5 0f __ LDA P2
+17b8 : 65 55 __ ADC T11 + 0
+17ba : 85 55 __ STA T11 + 0
+17bc : a5 10 __ LDA P3
+17be : 65 56 __ ADC T11 + 1
+17c0 : 85 56 __ STA T11 + 1
+17c2 : a0 01 __ LDY #$01
+17c4 : b1 43 __ LDA (T0 + 0),y
+17c6 : 38 __ __ SEC
+17c7 : e5 4e __ SBC T5 + 0
+17c9 : 85 53 __ STA T10 + 0
+17cb : a9 00 __ LDA #$00
+17cd : e9 00 __ SBC #$00
+17cf : 85 54 __ STA T10 + 1
+17d1 : 18 __ __ CLC
+17d2 : a5 0f __ LDA P2
+17d4 : 65 53 __ ADC T10 + 0
+17d6 : 85 53 __ STA T10 + 0
+17d8 : a5 10 __ LDA P3
+17da : 65 54 __ ADC T10 + 1
+17dc : 85 54 __ STA T10 + 1
+17de : 88 __ __ DEY
+17df : b1 55 __ LDA (T11 + 0),y
+17e1 : 91 53 __ STA (T10 + 0),y
+17e3 : e6 4e __ INC T5 + 0
+17e5 : a5 4b __ LDA T3 + 0
+17e7 : c5 4e __ CMP T5 + 0
+17e9 : b0 bd __ BCS $17a8
+17eb : a9 00 __ LDA #$00
+17ed : 85 4e __ STA T5 + 0
+17ef : a5 4b __ LDA T3 + 0
+17f1 : 85 43 __ STA T0 + 0
+17f3 : a0 01 __ LDY #$01
+17f5 : b1 0d __ LDA (P0),y
+17f7 : 85 4b __ STA T3 + 0
+17f9 : 38 __ __ SEC
+17fa : e5 43 __ SBC T0 + 0
+17fc : 85 53 __ STA T10 + 0
+17fe : a9 00 __ LDA #$00
+1800 : e9 00 __ SBC #$00
+1802 : 85 54 __ STA T10 + 1
+1804 : a9 00 __ LDA #$00
+1806 : c5 54 __ CMP T10 + 1
+1808 : d0 04 __ BNE $180e
+180a : a5 4e __ LDA T5 + 0
+180c : c5 53 __ CMP T10 + 0
+180e : 90 05 __ BCC $1815
+1810 : a5 4b __ LDA T3 + 0
+1812 : 4c 8d 17 JMP $178d ; (nformf + 768)
+1815 : a9 20 __ LDA #$20
+1817 : a4 4e __ LDY T5 + 0
+1819 : 91 0f __ STA (P2),y
+181b : e6 4e __ INC T5 + 0
+181d : 4c f3 17 JMP $17f3 ; (nformf + 870)
+1820 : a9 45 __ LDA #$45
+1822 : a4 4b __ LDY T3 + 0
+1824 : 91 0f __ STA (P2),y
+1826 : c8 __ __ INY
+1827 : a5 44 __ LDA T0 + 1
+1829 : 30 5a __ BMI $1885
+182b : a9 2b __ LDA #$2b
+182d : 91 0f __ STA (P2),y
+182f : 18 __ __ CLC
+1830 : a5 4b __ LDA T3 + 0
+1832 : 69 02 __ ADC #$02
+1834 : 85 4b __ STA T3 + 0
+1836 : a5 43 __ LDA T0 + 0
+1838 : 85 1b __ STA ACCU + 0
+183a : a5 44 __ LDA T0 + 1
+183c : 85 1c __ STA ACCU + 1
+183e : a9 0a __ LDA #$0a
+1840 : 85 03 __ STA $03
+1842 : a9 00 __ LDA #$00
+1844 : 85 04 __ STA $04
+1846 : 20 e6 1f JSR $1fe6 ; (divs16 + 0)
+1849 : 18 __ __ CLC
+184a : a5 1b __ LDA ACCU + 0
+184c : 69 30 __ ADC #$30
+184e : a4 4b __ LDY T3 + 0
+1850 : 91 0f __ STA (P2),y
+1852 : c8 __ __ INY
+1853 : 98 __ __ TYA
+1854 : 18 __ __ CLC
+1855 : 65 0f __ ADC P2
+1857 : 85 4c __ STA T4 + 0
+1859 : a5 10 __ LDA P3
+185b : 69 00 __ ADC #$00
+185d : 85 4d __ STA T4 + 1
+185f : a5 43 __ LDA T0 + 0
+1861 : 85 1b __ STA ACCU + 0
+1863 : a5 44 __ LDA T0 + 1
+1865 : 85 1c __ STA ACCU + 1
+1867 : a9 0a __ LDA #$0a
+1869 : 85 03 __ STA $03
+186b : a9 00 __ LDA #$00
+186d : 85 04 __ STA $04
+186f : 20 a5 20 JSR $20a5 ; (mods16 + 0)
+1872 : 18 __ __ CLC
+1873 : a5 05 __ LDA $05
+1875 : 69 30 __ ADC #$30
+1877 : a0 00 __ LDY #$00
+1879 : 91 4c __ STA (T4 + 0),y
+187b : 18 __ __ CLC
+187c : a5 4b __ LDA T3 + 0
+187e : 69 02 __ ADC #$02
+1880 : 85 4b __ STA T3 + 0
+1882 : 4c 85 17 JMP $1785 ; (nformf + 760)
+1885 : a9 2d __ LDA #$2d
+1887 : 91 0f __ STA (P2),y
+1889 : 18 __ __ CLC
+188a : a5 4b __ LDA T3 + 0
+188c : 69 02 __ ADC #$02
+188e : 85 4b __ STA T3 + 0
+1890 : 38 __ __ SEC
+1891 : a9 00 __ LDA #$00
+1893 : e5 43 __ SBC T0 + 0
+1895 : 85 43 __ STA T0 + 0
+1897 : a9 00 __ LDA #$00
+1899 : e5 44 __ SBC T0 + 1
+189b : 85 44 __ STA T0 + 1
+189d : 4c 36 18 JMP $1836 ; (nformf + 937)
+18a0 : a5 50 __ LDA T6 + 0
+18a2 : c5 4e __ CMP T5 + 0
+18a4 : d0 08 __ BNE $18ae
+18a6 : a9 2e __ LDA #$2e
+18a8 : a4 4b __ LDY T3 + 0
+18aa : 91 0f __ STA (P2),y
+18ac : e6 4b __ INC T3 + 0
+18ae : a5 11 __ LDA P4
+18b0 : 85 1b __ STA ACCU + 0
+18b2 : a5 12 __ LDA P5
+18b4 : 85 1c __ STA ACCU + 1
+18b6 : a5 13 __ LDA P6
+18b8 : 85 1d __ STA ACCU + 2
+18ba : a5 14 __ LDA P7
+18bc : 85 1e __ STA ACCU + 3
+18be : 20 ce 20 JSR $20ce ; (f32_to_i16 + 0)
+18c1 : a5 1b __ LDA ACCU + 0
+18c3 : 85 53 __ STA T10 + 0
+18c5 : 20 10 21 JSR $2110 ; (sint16_to_float + 0)
+18c8 : a5 1b __ LDA ACCU + 0
+18ca : 85 03 __ STA $03
+18cc : a5 1c __ LDA ACCU + 1
+18ce : 85 04 __ STA $04
+18d0 : a5 1d __ LDA ACCU + 2
+18d2 : 85 05 __ STA $05
+18d4 : a5 1e __ LDA ACCU + 3
+18d6 : 85 06 __ STA $06
+18d8 : a5 11 __ LDA P4
+18da : 85 1b __ STA ACCU + 0
+18dc : a5 12 __ LDA P5
+18de : 85 1c __ STA ACCU + 1
+18e0 : a5 13 __ LDA P6
+18e2 : 85 1d __ STA ACCU + 2
+18e4 : a5 14 __ LDA P7
+18e6 : 85 1e __ STA ACCU + 3
+18e8 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+18eb : a5 06 __ LDA $06
+18ed : 49 80 __ EOR #$80
+18ef : 85 06 __ STA $06
+18f1 : 20 02 1e JSR $1e02 ; (faddsub + 0)
+18f4 : a9 00 __ LDA #$00
+18f6 : 85 03 __ STA $03
+18f8 : 85 04 __ STA $04
+18fa : a9 20 __ LDA #$20
+18fc : 85 05 __ STA $05
+18fe : a9 41 __ LDA #$41
+1900 : 85 06 __ STA $06
+1902 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1905 : 20 ca 1e JSR $1eca ; (fmul + 0)
+1908 : a5 1b __ LDA ACCU + 0
+190a : 85 11 __ STA P4
+190c : a5 1c __ LDA ACCU + 1
+190e : 85 12 __ STA P5
+1910 : a5 1d __ LDA ACCU + 2
+1912 : 85 13 __ STA P6
+1914 : a5 1e __ LDA ACCU + 3
+1916 : 85 14 __ STA P7
+1918 : 18 __ __ CLC
+1919 : a5 53 __ LDA T10 + 0
+191b : 69 30 __ ADC #$30
+191d : a4 4b __ LDY T3 + 0
+191f : 91 0f __ STA (P2),y
+1921 : e6 4b __ INC T3 + 0
+1923 : e6 50 __ INC T6 + 0
+1925 : a5 50 __ LDA T6 + 0
+1927 : c5 4c __ CMP T4 + 0
+1929 : b0 03 __ BCS $192e
+192b : 4c a0 18 JMP $18a0 ; (nformf + 1043)
+192e : 4c 7e 17 JMP $177e ; (nformf + 753)
+1931 : 85 50 __ STA T6 + 0
+1933 : a5 47 __ LDA T2 + 0
+1935 : 85 1b __ STA ACCU + 0
+1937 : a5 48 __ LDA T2 + 1
+1939 : 85 1c __ STA ACCU + 1
+193b : a5 49 __ LDA T2 + 2
+193d : 85 1d __ STA ACCU + 2
+193f : a5 4a __ LDA T2 + 3
+1941 : 85 1e __ STA ACCU + 3
+1943 : a9 00 __ LDA #$00
+1945 : 85 03 __ STA $03
+1947 : 85 04 __ STA $04
+1949 : a9 20 __ LDA #$20
+194b : 85 05 __ STA $05
+194d : a9 41 __ LDA #$41
+194f : 85 06 __ STA $06
+1951 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1954 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1957 : a5 1b __ LDA ACCU + 0
+1959 : 85 47 __ STA T2 + 0
+195b : a5 1c __ LDA ACCU + 1
+195d : 85 48 __ STA T2 + 1
+195f : a5 1d __ LDA ACCU + 2
+1961 : 85 49 __ STA T2 + 2
+1963 : a5 1e __ LDA ACCU + 3
+1965 : 85 4a __ STA T2 + 3
+1967 : e6 50 __ INC T6 + 0
+1969 : a5 50 __ LDA T6 + 0
+196b : c5 4c __ CMP T4 + 0
+196d : 90 c4 __ BCC $1933
+196f : 4c c7 16 JMP $16c7 ; (nformf + 570)
+1972 : a5 11 __ LDA P4
+1974 : 85 1b __ STA ACCU + 0
+1976 : a5 12 __ LDA P5
+1978 : 85 1c __ STA ACCU + 1
+197a : a5 13 __ LDA P6
+197c : 85 1d __ STA ACCU + 2
+197e : a5 14 __ LDA P7
+1980 : 85 1e __ STA ACCU + 3
+1982 : a9 00 __ LDA #$00
+1984 : 85 03 __ STA $03
+1986 : 85 04 __ STA $04
+1988 : a9 20 __ LDA #$20
+198a : 85 05 __ STA $05
+198c : a9 41 __ LDA #$41
+198e : 85 06 __ STA $06
+1990 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1993 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1996 : a5 1b __ LDA ACCU + 0
+1998 : 85 11 __ STA P4
+199a : a5 1c __ LDA ACCU + 1
+199c : 85 12 __ STA P5
+199e : a5 1d __ LDA ACCU + 2
+19a0 : 85 13 __ STA P6
+19a2 : a5 1e __ LDA ACCU + 3
+19a4 : 85 14 __ STA P7
+19a6 : e6 43 __ INC T0 + 0
+19a8 : d0 02 __ BNE $19ac
+19aa : e6 44 __ INC T0 + 1
+19ac : a5 44 __ LDA T0 + 1
+19ae : 30 c2 __ BMI $1972
+19b0 : 4c a9 16 JMP $16a9 ; (nformf + 540)
+19b3 : a9 00 __ LDA #$00
+19b5 : 85 47 __ STA T2 + 0
+19b7 : 85 48 __ STA T2 + 1
+19b9 : 85 49 __ STA T2 + 2
+19bb : a9 3f __ LDA #$3f
+19bd : 85 4a __ STA T2 + 3
+19bf : a5 4e __ LDA T5 + 0
+19c1 : f0 03 __ BEQ $19c6
+19c3 : 4c 62 1a JMP $1a62 ; (nformf + 1493)
+19c6 : a5 11 __ LDA P4
+19c8 : 85 1b __ STA ACCU + 0
+19ca : a5 12 __ LDA P5
+19cc : 85 1c __ STA ACCU + 1
+19ce : a5 13 __ LDA P6
+19d0 : 85 1d __ STA ACCU + 2
+19d2 : a5 14 __ LDA P7
+19d4 : 85 1e __ STA ACCU + 3
+19d6 : a5 47 __ LDA T2 + 0
+19d8 : 85 03 __ STA $03
+19da : a5 48 __ LDA T2 + 1
+19dc : 85 04 __ STA $04
+19de : a5 49 __ LDA T2 + 2
+19e0 : 85 05 __ STA $05
+19e2 : a5 4a __ LDA T2 + 3
+19e4 : 85 06 __ STA $06
+19e6 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+19e9 : 20 02 1e JSR $1e02 ; (faddsub + 0)
+19ec : a5 1b __ LDA ACCU + 0
+19ee : 85 11 __ STA P4
+19f0 : 85 47 __ STA T2 + 0
+19f2 : 85 03 __ STA $03
+19f4 : a5 1c __ LDA ACCU + 1
+19f6 : 85 12 __ STA P5
+19f8 : 85 48 __ STA T2 + 1
+19fa : 85 04 __ STA $04
+19fc : a5 1d __ LDA ACCU + 2
+19fe : 85 13 __ STA P6
+1a00 : 85 49 __ STA T2 + 2
+1a02 : 85 05 __ STA $05
+1a04 : a5 1e __ LDA ACCU + 3
+1a06 : 85 14 __ STA P7
+1a08 : 85 4a __ STA T2 + 3
+1a0a : 85 06 __ STA $06
+1a0c : a9 00 __ LDA #$00
+1a0e : 85 1b __ STA ACCU + 0
+1a10 : 85 1c __ STA ACCU + 1
+1a12 : a9 20 __ LDA #$20
+1a14 : 85 1d __ STA ACCU + 2
+1a16 : a9 41 __ LDA #$41
+1a18 : 85 1e __ STA ACCU + 3
+1a1a : 20 5b 21 JSR $215b ; (fcmp + 0)
+1a1d : 10 03 __ BPL $1a22
+1a1f : 4c 56 17 JMP $1756 ; (nformf + 713)
+1a22 : a5 47 __ LDA T2 + 0
+1a24 : 85 1b __ STA ACCU + 0
+1a26 : a5 48 __ LDA T2 + 1
+1a28 : 85 1c __ STA ACCU + 1
+1a2a : a5 49 __ LDA T2 + 2
+1a2c : 85 1d __ STA ACCU + 2
+1a2e : a5 4a __ LDA T2 + 3
+1a30 : 85 1e __ STA ACCU + 3
+1a32 : a9 00 __ LDA #$00
+1a34 : 85 03 __ STA $03
+1a36 : 85 04 __ STA $04
+1a38 : a9 20 __ LDA #$20
+1a3a : 85 05 __ STA $05
+1a3c : a9 41 __ LDA #$41
+1a3e : 85 06 __ STA $06
+1a40 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1a43 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1a46 : a5 1b __ LDA ACCU + 0
+1a48 : 85 11 __ STA P4
+1a4a : a5 1c __ LDA ACCU + 1
+1a4c : 85 12 __ STA P5
+1a4e : a5 1d __ LDA ACCU + 2
+1a50 : 85 13 __ STA P6
+1a52 : a5 1e __ LDA ACCU + 3
+1a54 : 85 14 __ STA P7
+1a56 : e6 43 __ INC T0 + 0
+1a58 : f0 03 __ BEQ $1a5d
+1a5a : 4c 56 17 JMP $1756 ; (nformf + 713)
+1a5d : e6 44 __ INC T0 + 1
+1a5f : 4c 56 17 JMP $1756 ; (nformf + 713)
+1a62 : a9 00 __ LDA #$00
+1a64 : 85 50 __ STA T6 + 0
+1a66 : a5 47 __ LDA T2 + 0
+1a68 : 85 1b __ STA ACCU + 0
+1a6a : a5 48 __ LDA T2 + 1
+1a6c : 85 1c __ STA ACCU + 1
+1a6e : a5 49 __ LDA T2 + 2
+1a70 : 85 1d __ STA ACCU + 2
+1a72 : a5 4a __ LDA T2 + 3
+1a74 : 85 1e __ STA ACCU + 3
+1a76 : a9 00 __ LDA #$00
+1a78 : 85 03 __ STA $03
+1a7a : 85 04 __ STA $04
+1a7c : a9 20 __ LDA #$20
+1a7e : 85 05 __ STA $05
+1a80 : a9 41 __ LDA #$41
+1a82 : 85 06 __ STA $06
+1a84 : 20 d1 1d JSR $1dd1 ; (freg + 20)
+1a87 : 20 68 1f JSR $1f68 ; (fdiv + 0)
+1a8a : a5 1b __ LDA ACCU + 0
+1a8c : 85 47 __ STA T2 + 0
+1a8e : a5 1c __ LDA ACCU + 1
+1a90 : 85 48 __ STA T2 + 1
+1a92 : a5 1d __ LDA ACCU + 2
+1a94 : 85 49 __ STA T2 + 2
+1a96 : a5 1e __ LDA ACCU + 3
+1a98 : 85 4a __ STA T2 + 3
+1a9a : e6 50 __ INC T6 + 0
+1a9c : a5 50 __ LDA T6 + 0
+1a9e : c5 4e __ CMP T5 + 0
+1aa0 : 90 c4 __ BCC $1a66
+1aa2 : 4c c6 19 JMP $19c6 ; (nformf + 1337)
+1aa5 : a5 44 __ LDA T0 + 1
+1aa7 : 10 0e __ BPL $1ab7
+1aa9 : a5 44 __ LDA T0 + 1
+1aab : 30 03 __ BMI $1ab0
+1aad : 4c 9b 16 JMP $169b ; (nformf + 526)
+1ab0 : a9 01 __ LDA #$01
+1ab2 : 85 52 __ STA T8 + 0
+1ab4 : 4c b3 19 JMP $19b3 ; (nformf + 1318)
+1ab7 : d0 f7 __ BNE $1ab0
+1ab9 : a9 03 __ LDA #$03
+1abb : c5 43 __ CMP T0 + 0
+1abd : 90 f1 __ BCC $1ab0
+1abf : 4c a9 1a JMP $1aa9 ; (nformf + 1564)
+1ac2 : a9 01 __ LDA #$01
+1ac4 : 4c 88 16 JMP $1688 ; (nformf + 507)
+1ac7 : a5 14 __ LDA P7
+1ac9 : 49 80 __ EOR #$80
+1acb : 85 14 __ STA P7
+1acd : a9 2d __ LDA #$2d
+1acf : a0 00 __ LDY #$00
+1ad1 : 91 0f __ STA (P2),y
+1ad3 : a9 01 __ LDA #$01
+1ad5 : 85 4b __ STA T3 + 0
+1ad7 : 4c c3 14 JMP $14c3 ; (nformf + 54)
+--------------------------------------------------------------------
+rand:
+1adf : ad 05 22 LDA $2205 ; (seed + 1)
+1ae2 : 4a __ __ LSR
+1ae3 : ad 04 22 LDA $2204 ; (seed + 0)
+1ae6 : 6a __ __ ROR
+1ae7 : aa __ __ TAX
+1ae8 : a9 00 __ LDA #$00
+1aea : 6a __ __ ROR
+1aeb : 4d 04 22 EOR $2204 ; (seed + 0)
+1aee : 85 43 __ STA T0 + 0
+1af0 : 8a __ __ TXA
+1af1 : 4d 05 22 EOR $2205 ; (seed + 1)
+1af4 : 85 44 __ STA T0 + 1
+1af6 : 4a __ __ LSR
+1af7 : 45 43 __ EOR T0 + 0
+1af9 : aa __ __ TAX
+1afa : 85 1b __ STA ACCU + 0
+1afc : 45 44 __ EOR T0 + 1
+1afe : a8 __ __ TAY
+1aff : 8e 04 22 STX $2204 ; (seed + 0)
+1b02 : 98 __ __ TYA
+1b03 : 84 1c __ STY ACCU + 1
+1b05 : 8d 05 22 STA $2205 ; (seed + 1)
+1b08 : 60 __ __ RTS
+--------------------------------------------------------------------
+qsort:
+1b09 : 38 __ __ SEC
+1b0a : a5 23 __ LDA SP + 0
+1b0c : e9 12 __ SBC #$12
+1b0e : 85 23 __ STA SP + 0
+1b10 : a5 24 __ LDA SP + 1
+1b12 : e9 00 __ SBC #$00
+1b14 : 85 24 __ STA SP + 1
+1b16 : a0 03 __ LDY #$03
+1b18 : b9 53 00 LDA $0053,y 
+1b1b : 91 23 __ STA (SP + 0),y
+1b1d : 88 __ __ DEY
+1b1e : 10 f8 __ BPL $1b18
+1b20 : 38 __ __ SEC
+1b21 : a5 23 __ LDA SP + 0
+1b23 : e9 06 __ SBC #$06
+1b25 : 85 23 __ STA SP + 0
+1b27 : a5 24 __ LDA SP + 1
+1b29 : e9 00 __ SBC #$00
+1b2b : 85 24 __ STA SP + 1
+1b2d : a0 1c __ LDY #$1c
+1b2f : b1 23 __ LDA (SP + 0),y
+1b31 : 85 53 __ STA T0 + 0
+1b33 : c8 __ __ INY
+1b34 : b1 23 __ LDA (SP + 0),y
+1b36 : 85 54 __ STA T0 + 1
+1b38 : 10 25 __ BPL $1b5f
+1b3a : 18 __ __ CLC
+1b3b : a5 23 __ LDA SP + 0
+1b3d : 69 06 __ ADC #$06
+1b3f : 85 23 __ STA SP + 0
+1b41 : a5 24 __ LDA SP + 1
+1b43 : 69 00 __ ADC #$00
+1b45 : 85 24 __ STA SP + 1
+1b47 : a0 03 __ LDY #$03
+1b49 : b1 23 __ LDA (SP + 0),y
+1b4b : 99 53 00 STA $0053,y 
+1b4e : 88 __ __ DEY
+1b4f : 10 f8 __ BPL $1b49
+1b51 : 18 __ __ CLC
+1b52 : a5 23 __ LDA SP + 0
+1b54 : 69 12 __ ADC #$12
+1b56 : 85 23 __ STA SP + 0
+1b58 : a5 24 __ LDA SP + 1
+1b5a : 69 00 __ ADC #$00
+1b5c : 85 24 __ STA SP + 1
+1b5e : 60 __ __ RTS
+1b5f : d0 06 __ BNE $1b67
+1b61 : a9 01 __ LDA #$01
+1b63 : c5 53 __ CMP T0 + 0
+1b65 : b0 d3 __ BCS $1b3a
+1b67 : 18 __ __ CLC
+1b68 : a5 23 __ LDA SP + 0
+1b6a : 69 0a __ ADC #$0a
+1b6c : 85 55 __ STA T2 + 0
+1b6e : a5 24 __ LDA SP + 1
+1b70 : 69 00 __ ADC #$00
+1b72 : 85 56 __ STA T2 + 1
+1b74 : a0 1a __ LDY #$1a
+1b76 : b1 23 __ LDA (SP + 0),y
+1b78 : 85 44 __ STA T3 + 0
+1b7a : c8 __ __ INY
+1b7b : b1 23 __ LDA (SP + 0),y
+1b7d : 85 45 __ STA T3 + 1
+1b7f : a0 0b __ LDY #$0b
+1b81 : b1 44 __ LDA (T3 + 0),y
+1b83 : 91 55 __ STA (T2 + 0),y
+1b85 : 88 __ __ DEY
+1b86 : 10 f9 __ BPL $1b81
+1b88 : a9 00 __ LDA #$00
+1b8a : 85 55 __ STA T2 + 0
+1b8c : 85 56 __ STA T2 + 1
+1b8e : a5 54 __ LDA T0 + 1
+1b90 : 30 03 __ BMI $1b95
+1b92 : 4c 57 1c JMP $1c57 ; (qsort + 334)
+1b95 : a0 1a __ LDY #$1a
+1b97 : b1 23 __ LDA (SP + 0),y
+1b99 : 85 53 __ STA T0 + 0
+1b9b : c8 __ __ INY
+1b9c : b1 23 __ LDA (SP + 0),y
+1b9e : 85 54 __ STA T0 + 1
+1ba0 : a5 55 __ LDA T2 + 0
+1ba2 : 0a __ __ ASL
+1ba3 : aa __ __ TAX
+1ba4 : a5 56 __ LDA T2 + 1
+1ba6 : 2a __ __ ROL
+1ba7 : a8 __ __ TAY
+1ba8 : 18 __ __ CLC
+1ba9 : 8a __ __ TXA
+1baa : 65 55 __ ADC T2 + 0
+1bac : 85 1b __ STA ACCU + 0
+1bae : 98 __ __ TYA
+1baf : 65 56 __ ADC T2 + 1
+1bb1 : 06 1b __ ASL ACCU + 0
+1bb3 : 2a __ __ ROL
+1bb4 : 06 1b __ ASL ACCU + 0
+1bb6 : 2a __ __ ROL
+1bb7 : 85 1c __ STA ACCU + 1
+1bb9 : 18 __ __ CLC
+1bba : a5 53 __ LDA T0 + 0
+1bbc : 65 1b __ ADC ACCU + 0
+1bbe : 85 44 __ STA T3 + 0
+1bc0 : a5 54 __ LDA T0 + 1
+1bc2 : 65 1c __ ADC ACCU + 1
+1bc4 : 85 45 __ STA T3 + 1
+1bc6 : 18 __ __ CLC
+1bc7 : a5 23 __ LDA SP + 0
+1bc9 : 69 0a __ ADC #$0a
+1bcb : 85 46 __ STA T4 + 0
+1bcd : a5 24 __ LDA SP + 1
+1bcf : 69 00 __ ADC #$00
+1bd1 : 85 47 __ STA T4 + 1
+1bd3 : a0 0b __ LDY #$0b
+1bd5 : b1 46 __ LDA (T4 + 0),y
+1bd7 : 91 44 __ STA (T3 + 0),y
+1bd9 : 88 __ __ DEY
+1bda : 10 f9 __ BPL $1bd5
+1bdc : a5 53 __ LDA T0 + 0
+1bde : a0 02 __ LDY #$02
+1be0 : 91 23 __ STA (SP + 0),y
+1be2 : a5 54 __ LDA T0 + 1
+1be4 : c8 __ __ INY
+1be5 : 91 23 __ STA (SP + 0),y
+1be7 : a5 55 __ LDA T2 + 0
+1be9 : c8 __ __ INY
+1bea : 91 23 __ STA (SP + 0),y
+1bec : a5 56 __ LDA T2 + 1
+1bee : c8 __ __ INY
+1bef : 91 23 __ STA (SP + 0),y
+1bf1 : 20 09 1b JSR $1b09 ; (qsort + 0)
+1bf4 : a0 1a __ LDY #$1a
+1bf6 : b1 23 __ LDA (SP + 0),y
+1bf8 : 85 53 __ STA T0 + 0
+1bfa : c8 __ __ INY
+1bfb : b1 23 __ LDA (SP + 0),y
+1bfd : 85 54 __ STA T0 + 1
+1bff : a5 55 __ LDA T2 + 0
+1c01 : 0a __ __ ASL
+1c02 : aa __ __ TAX
+1c03 : a5 56 __ LDA T2 + 1
+1c05 : 2a __ __ ROL
+1c06 : a8 __ __ TAY
+1c07 : 18 __ __ CLC
+1c08 : 8a __ __ TXA
+1c09 : 65 55 __ ADC T2 + 0
+1c0b : 85 1b __ STA ACCU + 0
+1c0d : 98 __ __ TYA
+1c0e : 65 56 __ ADC T2 + 1
+1c10 : 06 1b __ ASL ACCU + 0
+1c12 : 2a __ __ ROL
+1c13 : 06 1b __ ASL ACCU + 0
+1c15 : 2a __ __ ROL
+1c16 : 85 1c __ STA ACCU + 1
+1c18 : 18 __ __ CLC
+1c19 : a5 53 __ LDA T0 + 0
+1c1b : 65 1b __ ADC ACCU + 0
+1c1d : aa __ __ TAX
+1c1e : a5 54 __ LDA T0 + 1
+1c20 : 65 1c __ ADC ACCU + 1
+1c22 : 85 54 __ STA T0 + 1
+1c24 : 18 __ __ CLC
+1c25 : 8a __ __ TXA
+1c26 : 69 0c __ ADC #$0c
+1c28 : a0 02 __ LDY #$02
+1c2a : 91 23 __ STA (SP + 0),y
+1c2c : a5 54 __ LDA T0 + 1
+1c2e : 69 00 __ ADC #$00
+1c30 : c8 __ __ INY
+1c31 : 91 23 __ STA (SP + 0),y
+1c33 : a0 1c __ LDY #$1c
+1c35 : b1 23 __ LDA (SP + 0),y
+1c37 : 38 __ __ SEC
+1c38 : e5 55 __ SBC T2 + 0
+1c3a : aa __ __ TAX
+1c3b : c8 __ __ INY
+1c3c : b1 23 __ LDA (SP + 0),y
+1c3e : e5 56 __ SBC T2 + 1
+1c40 : 85 54 __ STA T0 + 1
+1c42 : 38 __ __ SEC
+1c43 : 8a __ __ TXA
+1c44 : e9 01 __ SBC #$01
+1c46 : a0 04 __ LDY #$04
+1c48 : 91 23 __ STA (SP + 0),y
+1c4a : a5 54 __ LDA T0 + 1
+1c4c : e9 00 __ SBC #$00
+1c4e : c8 __ __ INY
+1c4f : 91 23 __ STA (SP + 0),y
+1c51 : 20 09 1b JSR $1b09 ; (qsort + 0)
+1c54 : 4c 3a 1b JMP $1b3a ; (qsort + 49)
+1c57 : d0 09 __ BNE $1c62
+1c59 : a9 01 __ LDA #$01
+1c5b : c5 53 __ CMP T0 + 0
+1c5d : 90 03 __ BCC $1c62
+1c5f : 4c 95 1b JMP $1b95 ; (qsort + 140)
+1c62 : a9 01 __ LDA #$01
+1c64 : 85 53 __ STA T0 + 0
+1c66 : a9 00 __ LDA #$00
+1c68 : 85 54 __ STA T0 + 1
+1c6a : a0 1a __ LDY #$1a
+1c6c : b1 23 __ LDA (SP + 0),y
+1c6e : 85 44 __ STA T3 + 0
+1c70 : c8 __ __ INY
+1c71 : b1 23 __ LDA (SP + 0),y
+1c73 : 85 45 __ STA T3 + 1
+1c75 : a5 53 __ LDA T0 + 0
+1c77 : 0a __ __ ASL
+1c78 : aa __ __ TAX
+1c79 : a5 54 __ LDA T0 + 1
+1c7b : 2a __ __ ROL
+1c7c : a8 __ __ TAY
+1c7d : 18 __ __ CLC
+1c7e : 8a __ __ TXA
+1c7f : 65 53 __ ADC T0 + 0
+1c81 : 85 1b __ STA ACCU + 0
+1c83 : 98 __ __ TYA
+1c84 : 65 54 __ ADC T0 + 1
+1c86 : 06 1b __ ASL ACCU + 0
+1c88 : 2a __ __ ROL
+1c89 : 06 1b __ ASL ACCU + 0
+1c8b : 2a __ __ ROL
+1c8c : 85 1c __ STA ACCU + 1
+1c8e : 18 __ __ CLC
+1c8f : a5 44 __ LDA T3 + 0
+1c91 : 65 1b __ ADC ACCU + 0
+1c93 : aa __ __ TAX
+1c94 : a5 45 __ LDA T3 + 1
+1c96 : 65 1c __ ADC ACCU + 1
+1c98 : a8 __ __ TAY
+1c99 : 18 __ __ CLC
+1c9a : 8a __ __ TXA
+1c9b : 69 02 __ ADC #$02
+1c9d : 85 0d __ STA P0
+1c9f : 98 __ __ TYA
+1ca0 : 69 00 __ ADC #$00
+1ca2 : 85 0e __ STA P1
+1ca4 : 18 __ __ CLC
+1ca5 : a5 23 __ LDA SP + 0
+1ca7 : 69 0c __ ADC #$0c
+1ca9 : 85 0f __ STA P2
+1cab : a5 24 __ LDA SP + 1
+1cad : 69 00 __ ADC #$00
+1caf : 85 10 __ STA P3
+1cb1 : 20 5c 1d JSR $1d5c ; (strcmp + 0)
+1cb4 : a5 1c __ LDA ACCU + 1
+1cb6 : 30 24 __ BMI $1cdc
+1cb8 : a0 1c __ LDY #$1c
+1cba : b1 23 __ LDA (SP + 0),y
+1cbc : 85 44 __ STA T3 + 0
+1cbe : c8 __ __ INY
+1cbf : b1 23 __ LDA (SP + 0),y
+1cc1 : e6 53 __ INC T0 + 0
+1cc3 : d0 02 __ BNE $1cc7
+1cc5 : e6 54 __ INC T0 + 1
+1cc7 : 49 80 __ EOR #$80
+1cc9 : 85 03 __ STA $03
+1ccb : a5 54 __ LDA T0 + 1
+1ccd : 49 80 __ EOR #$80
+1ccf : c5 03 __ CMP $03
+1cd1 : d0 04 __ BNE $1cd7
+1cd3 : a5 53 __ LDA T0 + 0
+1cd5 : c5 44 __ CMP T3 + 0
+1cd7 : 90 91 __ BCC $1c6a
+1cd9 : 4c 95 1b JMP $1b95 ; (qsort + 140)
+1cdc : a0 1a __ LDY #$1a
+1cde : b1 23 __ LDA (SP + 0),y
+1ce0 : 85 44 __ STA T3 + 0
+1ce2 : c8 __ __ INY
+1ce3 : b1 23 __ LDA (SP + 0),y
+1ce5 : 85 45 __ STA T3 + 1
+1ce7 : a5 55 __ LDA T2 + 0
+1ce9 : 0a __ __ ASL
+1cea : aa __ __ TAX
+1ceb : a5 56 __ LDA T2 + 1
+1ced : 2a __ __ ROL
+1cee : a8 __ __ TAY
+1cef : 18 __ __ CLC
+1cf0 : 8a __ __ TXA
+1cf1 : 65 55 __ ADC T2 + 0
+1cf3 : 85 1b __ STA ACCU + 0
+1cf5 : 98 __ __ TYA
+1cf6 : 65 56 __ ADC T2 + 1
+1cf8 : 06 1b __ ASL ACCU + 0
+1cfa : 2a __ __ ROL
+1cfb : 06 1b __ ASL ACCU + 0
+1cfd : 2a __ __ ROL
+1cfe : 85 1c __ STA ACCU + 1
+1d00 : 18 __ __ CLC
+1d01 : a5 44 __ LDA T3 + 0
+1d03 : 65 1b __ ADC ACCU + 0
+1d05 : 85 46 __ STA T4 + 0
+1d07 : a5 45 __ LDA T3 + 1
+1d09 : 65 1c __ ADC ACCU + 1
+1d0b : 85 47 __ STA T4 + 1
+1d0d : a5 53 __ LDA T0 + 0
+1d0f : 0a __ __ ASL
+1d10 : aa __ __ TAX
+1d11 : a5 54 __ LDA T0 + 1
+1d13 : 2a __ __ ROL
+1d14 : a8 __ __ TAY
+1d15 : 18 __ __ CLC
+1d16 : 8a __ __ TXA
+1d17 : 65 53 __ ADC T0 + 0
+1d19 : 85 1b __ STA ACCU + 0
+1d1b : 98 __ __ TYA
+1d1c : 65 54 __ ADC T0 + 1
+1d1e : 06 1b __ ASL ACCU + 0
+1d20 : 2a __ __ ROL
+1d21 : 06 1b __ ASL ACCU + 0
+1d23 : 2a __ __ ROL
+1d24 : 85 1c __ STA ACCU + 1
+1d26 : 18 __ __ CLC
+1d27 : a5 44 __ LDA T3 + 0
+1d29 : 65 1b __ ADC ACCU + 0
+1d2b : 85 44 __ STA T3 + 0
+1d2d : a5 45 __ LDA T3 + 1
+1d2f : 65 1c __ ADC ACCU + 1
+1d31 : 85 45 __ STA T3 + 1
+1d33 : a0 0b __ LDY #$0b
+1d35 : b1 44 __ LDA (T3 + 0),y
+1d37 : 91 46 __ STA (T4 + 0),y
+1d39 : 88 __ __ DEY
+1d3a : 10 f9 __ BPL $1d35
+1d3c : 18 __ __ CLC
+1d3d : a5 46 __ LDA T4 + 0
+1d3f : 69 0c __ ADC #$0c
+1d41 : 85 46 __ STA T4 + 0
+1d43 : 90 02 __ BCC $1d47
+1d45 : e6 47 __ INC T4 + 1
+1d47 : a0 0b __ LDY #$0b
+1d49 : b1 46 __ LDA (T4 + 0),y
+1d4b : 91 44 __ STA (T3 + 0),y
+1d4d : 88 __ __ DEY
+1d4e : 10 f9 __ BPL $1d49
+1d50 : e6 55 __ INC T2 + 0
+1d52 : f0 03 __ BEQ $1d57
+1d54 : 4c b8 1c JMP $1cb8 ; (qsort + 431)
+1d57 : e6 56 __ INC T2 + 1
+1d59 : 4c b8 1c JMP $1cb8 ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+1d5c : a0 00 __ LDY #$00
+1d5e : 84 1c __ STY ACCU + 1
+1d60 : b1 0d __ LDA (P0),y
+1d62 : f0 16 __ BEQ $1d7a
+1d64 : d1 0f __ CMP (P2),y
+1d66 : d0 16 __ BNE $1d7e
+1d68 : c8 __ __ INY
+1d69 : b1 0d __ LDA (P0),y
+1d6b : f0 0d __ BEQ $1d7a
+1d6d : d1 0f __ CMP (P2),y
+1d6f : d0 0d __ BNE $1d7e
+1d71 : c8 __ __ INY
+1d72 : d0 ec __ BNE $1d60
+1d74 : e6 0e __ INC P1
+1d76 : e6 10 __ INC P3
+1d78 : d0 e6 __ BNE $1d60
+1d7a : d1 0f __ CMP (P2),y
+1d7c : f0 0a __ BEQ $1d88
+1d7e : b0 06 __ BCS $1d86
+1d80 : a9 ff __ LDA #$ff
+1d82 : 85 1c __ STA ACCU + 1
+1d84 : 30 02 __ BMI $1d88
+1d86 : a9 01 __ LDA #$01
+1d88 : 85 1b __ STA ACCU + 0
+1d8a : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+1d8b : a0 02 __ LDY #$02
+1d8d : b1 23 __ LDA (SP + 0),y
+1d8f : d0 09 __ BNE $1d9a
+1d91 : a9 ff __ LDA #$ff
+1d93 : 85 0d __ STA P0
+1d95 : 85 0e __ STA P1
+1d97 : 20 9b 1d JSR $1d9b ; (exit + 0)
+1d9a : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1d9b : a5 0d __ LDA P0
+1d9d : 85 1b __ STA ACCU + 0
+1d9f : a5 0e __ LDA P1
+1da1 : 85 1c __ STA ACCU + 1
+1da3 : ae 03 22 LDX $2203 ; (spentry + 0)
+1da6 : 9a __ __ TXS
+1da7 : a9 4c __ LDA #$4c
+1da9 : 85 54 __ STA $54
+1dab : a9 00 __ LDA #$00
+1dad : 85 13 __ STA P6
+1daf : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1db0 : a9 4c __ LDA #$4c
+1db2 : 85 54 __ STA $54
+1db4 : a9 00 __ LDA #$00
+1db6 : 85 13 __ STA P6
+1db8 : a9 19 __ LDA #$19
+1dba : 85 16 __ STA P9
+1dbc : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1dbd : b1 19 __ LDA (IP + 0),y
+1dbf : c8 __ __ INY
+1dc0 : aa __ __ TAX
+1dc1 : b5 00 __ LDA $00,x
+1dc3 : 85 03 __ STA $03
+1dc5 : b5 01 __ LDA $01,x
+1dc7 : 85 04 __ STA $04
+1dc9 : b5 02 __ LDA $02,x
+1dcb : 85 05 __ STA $05
+1dcd : b5 03 __ LDA $03,x
+1dcf : 85 06 __ STA $06
+1dd1 : a5 05 __ LDA $05
+1dd3 : 0a __ __ ASL
+1dd4 : a5 06 __ LDA $06
+1dd6 : 2a __ __ ROL
+1dd7 : 85 08 __ STA $08
+1dd9 : f0 06 __ BEQ $1de1
+1ddb : a5 05 __ LDA $05
+1ddd : 09 80 __ ORA #$80
+1ddf : 85 05 __ STA $05
+1de1 : a5 1d __ LDA ACCU + 2
+1de3 : 0a __ __ ASL
+1de4 : a5 1e __ LDA ACCU + 3
+1de6 : 2a __ __ ROL
+1de7 : 85 07 __ STA $07
+1de9 : f0 06 __ BEQ $1df1
+1deb : a5 1d __ LDA ACCU + 2
+1ded : 09 80 __ ORA #$80
+1def : 85 1d __ STA ACCU + 2
+1df1 : 60 __ __ RTS
+1df2 : 06 1e __ ASL ACCU + 3
+1df4 : a5 07 __ LDA $07
+1df6 : 6a __ __ ROR
+1df7 : 85 1e __ STA ACCU + 3
+1df9 : b0 06 __ BCS $1e01
+1dfb : a5 1d __ LDA ACCU + 2
+1dfd : 29 7f __ AND #$7f
+1dff : 85 1d __ STA ACCU + 2
+1e01 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1e02 : 38 __ __ SEC
+1e03 : a5 07 __ LDA $07
+1e05 : e5 08 __ SBC $08
+1e07 : f0 38 __ BEQ $1e41
+1e09 : aa __ __ TAX
+1e0a : b0 25 __ BCS $1e31
+1e0c : e0 e9 __ CPX #$e9
+1e0e : b0 0e __ BCS $1e1e
+1e10 : a5 08 __ LDA $08
+1e12 : 85 07 __ STA $07
+1e14 : a9 00 __ LDA #$00
+1e16 : 85 1b __ STA ACCU + 0
+1e18 : 85 1c __ STA ACCU + 1
+1e1a : 85 1d __ STA ACCU + 2
+1e1c : f0 23 __ BEQ $1e41
+1e1e : a5 1d __ LDA ACCU + 2
+1e20 : 4a __ __ LSR
+1e21 : 66 1c __ ROR ACCU + 1
+1e23 : 66 1b __ ROR ACCU + 0
+1e25 : e8 __ __ INX
+1e26 : d0 f8 __ BNE $1e20
+1e28 : 85 1d __ STA ACCU + 2
+1e2a : a5 08 __ LDA $08
+1e2c : 85 07 __ STA $07
+1e2e : 4c 41 1e JMP $1e41 ; (faddsub + 63)
+1e31 : e0 18 __ CPX #$18
+1e33 : b0 33 __ BCS $1e68
+1e35 : a5 05 __ LDA $05
+1e37 : 4a __ __ LSR
+1e38 : 66 04 __ ROR $04
+1e3a : 66 03 __ ROR $03
+1e3c : ca __ __ DEX
+1e3d : d0 f8 __ BNE $1e37
+1e3f : 85 05 __ STA $05
+1e41 : a5 1e __ LDA ACCU + 3
+1e43 : 29 80 __ AND #$80
+1e45 : 85 1e __ STA ACCU + 3
+1e47 : 45 06 __ EOR $06
+1e49 : 30 2d __ BMI $1e78
+1e4b : 18 __ __ CLC
+1e4c : a5 1b __ LDA ACCU + 0
+1e4e : 65 03 __ ADC $03
+1e50 : 85 1b __ STA ACCU + 0
+1e52 : a5 1c __ LDA ACCU + 1
+1e54 : 65 04 __ ADC $04
+1e56 : 85 1c __ STA ACCU + 1
+1e58 : a5 1d __ LDA ACCU + 2
+1e5a : 65 05 __ ADC $05
+1e5c : 85 1d __ STA ACCU + 2
+1e5e : 90 08 __ BCC $1e68
+1e60 : 66 1d __ ROR ACCU + 2
+1e62 : 66 1c __ ROR ACCU + 1
+1e64 : 66 1b __ ROR ACCU + 0
+1e66 : e6 07 __ INC $07
+1e68 : a5 07 __ LDA $07
+1e6a : 4a __ __ LSR
+1e6b : 05 1e __ ORA ACCU + 3
+1e6d : 85 1e __ STA ACCU + 3
+1e6f : b0 06 __ BCS $1e77
+1e71 : a5 1d __ LDA ACCU + 2
+1e73 : 29 7f __ AND #$7f
+1e75 : 85 1d __ STA ACCU + 2
+1e77 : 60 __ __ RTS
+1e78 : 38 __ __ SEC
+1e79 : a5 1b __ LDA ACCU + 0
+1e7b : e5 03 __ SBC $03
+1e7d : 85 1b __ STA ACCU + 0
+1e7f : a5 1c __ LDA ACCU + 1
+1e81 : e5 04 __ SBC $04
+1e83 : 85 1c __ STA ACCU + 1
+1e85 : a5 1d __ LDA ACCU + 2
+1e87 : e5 05 __ SBC $05
+1e89 : 85 1d __ STA ACCU + 2
+1e8b : b0 19 __ BCS $1ea6
+1e8d : 38 __ __ SEC
+1e8e : a9 00 __ LDA #$00
+1e90 : e5 1b __ SBC ACCU + 0
+1e92 : 85 1b __ STA ACCU + 0
+1e94 : a9 00 __ LDA #$00
+1e96 : e5 1c __ SBC ACCU + 1
+1e98 : 85 1c __ STA ACCU + 1
+1e9a : a9 00 __ LDA #$00
+1e9c : e5 1d __ SBC ACCU + 2
+1e9e : 85 1d __ STA ACCU + 2
+1ea0 : a5 1e __ LDA ACCU + 3
+1ea2 : 49 80 __ EOR #$80
+1ea4 : 85 1e __ STA ACCU + 3
+1ea6 : a5 1d __ LDA ACCU + 2
+1ea8 : 30 be __ BMI $1e68
+1eaa : 05 1c __ ORA ACCU + 1
+1eac : 05 1b __ ORA ACCU + 0
+1eae : f0 0f __ BEQ $1ebf
+1eb0 : c6 07 __ DEC $07
+1eb2 : f0 0b __ BEQ $1ebf
+1eb4 : 06 1b __ ASL ACCU + 0
+1eb6 : 26 1c __ ROL ACCU + 1
+1eb8 : 26 1d __ ROL ACCU + 2
+1eba : 10 f4 __ BPL $1eb0
+1ebc : 4c 68 1e JMP $1e68 ; (faddsub + 102)
+1ebf : a9 00 __ LDA #$00
+1ec1 : 85 1b __ STA ACCU + 0
+1ec3 : 85 1c __ STA ACCU + 1
+1ec5 : 85 1d __ STA ACCU + 2
+1ec7 : 85 1e __ STA ACCU + 3
+1ec9 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1eca : a5 1b __ LDA ACCU + 0
+1ecc : 05 1c __ ORA ACCU + 1
+1ece : 05 1d __ ORA ACCU + 2
+1ed0 : d0 03 __ BNE $1ed5
+1ed2 : 85 1e __ STA ACCU + 3
+1ed4 : 60 __ __ RTS
+1ed5 : a5 03 __ LDA $03
+1ed7 : 05 04 __ ORA $04
+1ed9 : 05 05 __ ORA $05
+1edb : d0 09 __ BNE $1ee6
+1edd : 85 1b __ STA ACCU + 0
+1edf : 85 1c __ STA ACCU + 1
+1ee1 : 85 1d __ STA ACCU + 2
+1ee3 : 85 1e __ STA ACCU + 3
+1ee5 : 60 __ __ RTS
+1ee6 : a9 00 __ LDA #$00
+1ee8 : 85 09 __ STA $09
+1eea : 85 0a __ STA $0a
+1eec : 85 0b __ STA $0b
+1eee : a4 1b __ LDY ACCU + 0
+1ef0 : a5 03 __ LDA $03
+1ef2 : d0 06 __ BNE $1efa
+1ef4 : a5 04 __ LDA $04
+1ef6 : f0 0a __ BEQ $1f02
+1ef8 : d0 05 __ BNE $1eff
+1efa : 20 3a 1f JSR $1f3a ; (fmul8 + 0)
+1efd : a5 04 __ LDA $04
+1eff : 20 3a 1f JSR $1f3a ; (fmul8 + 0)
+1f02 : a5 05 __ LDA $05
+1f04 : 20 3a 1f JSR $1f3a ; (fmul8 + 0)
+1f07 : 38 __ __ SEC
+1f08 : a5 0b __ LDA $0b
+1f0a : 30 06 __ BMI $1f12
+1f0c : 06 09 __ ASL $09
+1f0e : 26 0a __ ROL $0a
+1f10 : 2a __ __ ROL
+1f11 : 18 __ __ CLC
+1f12 : 29 7f __ AND #$7f
+1f14 : 85 0b __ STA $0b
+1f16 : a5 1e __ LDA ACCU + 3
+1f18 : 45 06 __ EOR $06
+1f1a : 29 80 __ AND #$80
+1f1c : 85 1e __ STA ACCU + 3
+1f1e : a5 07 __ LDA $07
+1f20 : e9 7e __ SBC #$7e
+1f22 : 18 __ __ CLC
+1f23 : 65 08 __ ADC $08
+1f25 : 4a __ __ LSR
+1f26 : 05 1e __ ORA ACCU + 3
+1f28 : 85 1e __ STA ACCU + 3
+1f2a : a9 00 __ LDA #$00
+1f2c : 6a __ __ ROR
+1f2d : 05 0b __ ORA $0b
+1f2f : 85 1d __ STA ACCU + 2
+1f31 : a5 0a __ LDA $0a
+1f33 : 85 1c __ STA ACCU + 1
+1f35 : a5 09 __ LDA $09
+1f37 : 85 1b __ STA ACCU + 0
+1f39 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1f3a : 38 __ __ SEC
+1f3b : 6a __ __ ROR
+1f3c : 90 1e __ BCC $1f5c
+1f3e : aa __ __ TAX
+1f3f : 18 __ __ CLC
+1f40 : 98 __ __ TYA
+1f41 : 65 09 __ ADC $09
+1f43 : 85 09 __ STA $09
+1f45 : a5 0a __ LDA $0a
+1f47 : 65 1c __ ADC ACCU + 1
+1f49 : 85 0a __ STA $0a
+1f4b : a5 0b __ LDA $0b
+1f4d : 65 1d __ ADC ACCU + 2
+1f4f : 6a __ __ ROR
+1f50 : 85 0b __ STA $0b
+1f52 : 8a __ __ TXA
+1f53 : 66 0a __ ROR $0a
+1f55 : 66 09 __ ROR $09
+1f57 : 4a __ __ LSR
+1f58 : f0 0d __ BEQ $1f67
+1f5a : b0 e2 __ BCS $1f3e
+1f5c : 66 0b __ ROR $0b
+1f5e : 66 0a __ ROR $0a
+1f60 : 66 09 __ ROR $09
+1f62 : 4a __ __ LSR
+1f63 : 90 f7 __ BCC $1f5c
+1f65 : d0 d7 __ BNE $1f3e
+1f67 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1f68 : a5 1b __ LDA ACCU + 0
+1f6a : 05 1c __ ORA ACCU + 1
+1f6c : 05 1d __ ORA ACCU + 2
+1f6e : d0 03 __ BNE $1f73
+1f70 : 85 1e __ STA ACCU + 3
+1f72 : 60 __ __ RTS
+1f73 : a5 1e __ LDA ACCU + 3
+1f75 : 45 06 __ EOR $06
+1f77 : 29 80 __ AND #$80
+1f79 : 85 1e __ STA ACCU + 3
+1f7b : a9 00 __ LDA #$00
+1f7d : 85 09 __ STA $09
+1f7f : 85 0a __ STA $0a
+1f81 : 85 0b __ STA $0b
+1f83 : a2 18 __ LDX #$18
+1f85 : a5 1b __ LDA ACCU + 0
+1f87 : c5 03 __ CMP $03
+1f89 : a5 1c __ LDA ACCU + 1
+1f8b : e5 04 __ SBC $04
+1f8d : a5 1d __ LDA ACCU + 2
+1f8f : e5 05 __ SBC $05
+1f91 : 90 13 __ BCC $1fa6
+1f93 : a5 1b __ LDA ACCU + 0
+1f95 : e5 03 __ SBC $03
+1f97 : 85 1b __ STA ACCU + 0
+1f99 : a5 1c __ LDA ACCU + 1
+1f9b : e5 04 __ SBC $04
+1f9d : 85 1c __ STA ACCU + 1
+1f9f : a5 1d __ LDA ACCU + 2
+1fa1 : e5 05 __ SBC $05
+1fa3 : 85 1d __ STA ACCU + 2
+1fa5 : 38 __ __ SEC
+1fa6 : 26 09 __ ROL $09
+1fa8 : 26 0a __ ROL $0a
+1faa : 26 0b __ ROL $0b
+1fac : ca __ __ DEX
+1fad : f0 0a __ BEQ $1fb9
+1faf : 06 1b __ ASL ACCU + 0
+1fb1 : 26 1c __ ROL ACCU + 1
+1fb3 : 26 1d __ ROL ACCU + 2
+1fb5 : b0 dc __ BCS $1f93
+1fb7 : 90 cc __ BCC $1f85
+1fb9 : 38 __ __ SEC
+1fba : a5 0b __ LDA $0b
+1fbc : 30 06 __ BMI $1fc4
+1fbe : 06 09 __ ASL $09
+1fc0 : 26 0a __ ROL $0a
+1fc2 : 2a __ __ ROL
+1fc3 : 18 __ __ CLC
+1fc4 : 29 7f __ AND #$7f
+1fc6 : 85 0b __ STA $0b
+1fc8 : a5 08 __ LDA $08
+1fca : 49 7f __ EOR #$7f
+1fcc : 65 07 __ ADC $07
+1fce : 38 __ __ SEC
+1fcf : e9 01 __ SBC #$01
+1fd1 : 4a __ __ LSR
+1fd2 : 05 1e __ ORA ACCU + 3
+1fd4 : 85 1e __ STA ACCU + 3
+1fd6 : a9 00 __ LDA #$00
+1fd8 : 6a __ __ ROR
+1fd9 : 05 0b __ ORA $0b
+1fdb : 85 1d __ STA ACCU + 2
+1fdd : a5 0a __ LDA $0a
+1fdf : 85 1c __ STA ACCU + 1
+1fe1 : a5 09 __ LDA $09
+1fe3 : 85 1b __ STA ACCU + 0
+1fe5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1fe6 : 24 1c __ BIT ACCU + 1
+1fe8 : 10 0d __ BPL $1ff7
+1fea : 20 04 20 JSR $2004 ; (negaccu + 0)
+1fed : 24 04 __ BIT $04
+1fef : 10 0d __ BPL $1ffe
+1ff1 : 20 12 20 JSR $2012 ; (negtmp + 0)
+1ff4 : 4c 20 20 JMP $2020 ; (divmod + 0)
+1ff7 : 24 04 __ BIT $04
+1ff9 : 10 f9 __ BPL $1ff4
+1ffb : 20 12 20 JSR $2012 ; (negtmp + 0)
+1ffe : 20 20 20 JSR $2020 ; (divmod + 0)
+2001 : 4c 04 20 JMP $2004 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+2004 : 38 __ __ SEC
+2005 : a9 00 __ LDA #$00
+2007 : e5 1b __ SBC ACCU + 0
+2009 : 85 1b __ STA ACCU + 0
+200b : a9 00 __ LDA #$00
+200d : e5 1c __ SBC ACCU + 1
+200f : 85 1c __ STA ACCU + 1
+2011 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+2012 : 38 __ __ SEC
+2013 : a9 00 __ LDA #$00
+2015 : e5 03 __ SBC $03
+2017 : 85 03 __ STA $03
+2019 : a9 00 __ LDA #$00
+201b : e5 04 __ SBC $04
+201d : 85 04 __ STA $04
+201f : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+2020 : a5 1c __ LDA ACCU + 1
+2022 : d0 31 __ BNE $2055
+2024 : a5 04 __ LDA $04
+2026 : d0 1e __ BNE $2046
+2028 : 85 06 __ STA $06
+202a : a2 04 __ LDX #$04
+202c : 06 1b __ ASL ACCU + 0
+202e : 2a __ __ ROL
+202f : c5 03 __ CMP $03
+2031 : 90 02 __ BCC $2035
+2033 : e5 03 __ SBC $03
+2035 : 26 1b __ ROL ACCU + 0
+2037 : 2a __ __ ROL
+2038 : c5 03 __ CMP $03
+203a : 90 02 __ BCC $203e
+203c : e5 03 __ SBC $03
+203e : 26 1b __ ROL ACCU + 0
+2040 : ca __ __ DEX
+2041 : d0 eb __ BNE $202e
+2043 : 85 05 __ STA $05
+2045 : 60 __ __ RTS
+2046 : a5 1b __ LDA ACCU + 0
+2048 : 85 05 __ STA $05
+204a : a5 1c __ LDA ACCU + 1
+204c : 85 06 __ STA $06
+204e : a9 00 __ LDA #$00
+2050 : 85 1b __ STA ACCU + 0
+2052 : 85 1c __ STA ACCU + 1
+2054 : 60 __ __ RTS
+2055 : a5 04 __ LDA $04
+2057 : d0 1f __ BNE $2078
+2059 : a5 03 __ LDA $03
+205b : 30 1b __ BMI $2078
+205d : a9 00 __ LDA #$00
+205f : 85 06 __ STA $06
+2061 : a2 10 __ LDX #$10
+2063 : 06 1b __ ASL ACCU + 0
+2065 : 26 1c __ ROL ACCU + 1
+2067 : 2a __ __ ROL
+2068 : c5 03 __ CMP $03
+206a : 90 02 __ BCC $206e
+206c : e5 03 __ SBC $03
+206e : 26 1b __ ROL ACCU + 0
+2070 : 26 1c __ ROL ACCU + 1
+2072 : ca __ __ DEX
+2073 : d0 f2 __ BNE $2067
+2075 : 85 05 __ STA $05
+2077 : 60 __ __ RTS
+2078 : a9 00 __ LDA #$00
+207a : 85 05 __ STA $05
+207c : 85 06 __ STA $06
+207e : 84 02 __ STY $02
+2080 : a0 10 __ LDY #$10
+2082 : 18 __ __ CLC
+2083 : 26 1b __ ROL ACCU + 0
+2085 : 26 1c __ ROL ACCU + 1
+2087 : 26 05 __ ROL $05
+2089 : 26 06 __ ROL $06
+208b : 38 __ __ SEC
+208c : a5 05 __ LDA $05
+208e : e5 03 __ SBC $03
+2090 : aa __ __ TAX
+2091 : a5 06 __ LDA $06
+2093 : e5 04 __ SBC $04
+2095 : 90 04 __ BCC $209b
+2097 : 86 05 __ STX $05
+2099 : 85 06 __ STA $06
+209b : 88 __ __ DEY
+209c : d0 e5 __ BNE $2083
+209e : 26 1b __ ROL ACCU + 0
+20a0 : 26 1c __ ROL ACCU + 1
+20a2 : a4 02 __ LDY $02
+20a4 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+20a5 : 24 1c __ BIT ACCU + 1
+20a7 : 10 0d __ BPL $20b6
+20a9 : 20 04 20 JSR $2004 ; (negaccu + 0)
+20ac : 24 04 __ BIT $04
+20ae : 10 0d __ BPL $20bd
+20b0 : 20 12 20 JSR $2012 ; (negtmp + 0)
+20b3 : 4c 20 20 JMP $2020 ; (divmod + 0)
+20b6 : 24 04 __ BIT $04
+20b8 : 10 f9 __ BPL $20b3
+20ba : 20 12 20 JSR $2012 ; (negtmp + 0)
+20bd : 20 20 20 JSR $2020 ; (divmod + 0)
+20c0 : 38 __ __ SEC
+20c1 : a9 00 __ LDA #$00
+20c3 : e5 05 __ SBC $05
+20c5 : 85 05 __ STA $05
+20c7 : a9 00 __ LDA #$00
+20c9 : e5 06 __ SBC $06
+20cb : 85 06 __ STA $06
+20cd : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+20ce : 20 e1 1d JSR $1de1 ; (freg + 36)
+20d1 : a5 07 __ LDA $07
+20d3 : c9 7f __ CMP #$7f
+20d5 : b0 07 __ BCS $20de
+20d7 : a9 00 __ LDA #$00
+20d9 : 85 1b __ STA ACCU + 0
+20db : 85 1c __ STA ACCU + 1
+20dd : 60 __ __ RTS
+20de : 38 __ __ SEC
+20df : e9 8e __ SBC #$8e
+20e1 : 90 0a __ BCC $20ed
+20e3 : a9 ff __ LDA #$ff
+20e5 : 85 1b __ STA ACCU + 0
+20e7 : a9 7f __ LDA #$7f
+20e9 : 85 1c __ STA ACCU + 1
+20eb : d0 08 __ BNE $20f5
+20ed : aa __ __ TAX
+20ee : 46 1d __ LSR ACCU + 2
+20f0 : 66 1c __ ROR ACCU + 1
+20f2 : e8 __ __ INX
+20f3 : d0 f9 __ BNE $20ee
+20f5 : 24 1e __ BIT ACCU + 3
+20f7 : 10 0e __ BPL $2107
+20f9 : 38 __ __ SEC
+20fa : a9 00 __ LDA #$00
+20fc : e5 1c __ SBC ACCU + 1
+20fe : 85 1b __ STA ACCU + 0
+2100 : a9 00 __ LDA #$00
+2102 : e5 1d __ SBC ACCU + 2
+2104 : 85 1c __ STA ACCU + 1
+2106 : 60 __ __ RTS
+2107 : a5 1c __ LDA ACCU + 1
+2109 : 85 1b __ STA ACCU + 0
+210b : a5 1d __ LDA ACCU + 2
+210d : 85 1c __ STA ACCU + 1
+210f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2110 : 24 1c __ BIT ACCU + 1
+2112 : 30 03 __ BMI $2117
+2114 : 4c 2e 21 JMP $212e ; (uint16_to_float + 0)
+2117 : 38 __ __ SEC
+2118 : a9 00 __ LDA #$00
+211a : e5 1b __ SBC ACCU + 0
+211c : 85 1b __ STA ACCU + 0
+211e : a9 00 __ LDA #$00
+2120 : e5 1c __ SBC ACCU + 1
+2122 : 85 1c __ STA ACCU + 1
+2124 : 20 2e 21 JSR $212e ; (uint16_to_float + 0)
+2127 : a5 1e __ LDA ACCU + 3
+2129 : 09 80 __ ORA #$80
+212b : 85 1e __ STA ACCU + 3
+212d : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+212e : a5 1b __ LDA ACCU + 0
+2130 : 05 1c __ ORA ACCU + 1
+2132 : d0 05 __ BNE $2139
+2134 : 85 1d __ STA ACCU + 2
+2136 : 85 1e __ STA ACCU + 3
+2138 : 60 __ __ RTS
+2139 : a2 8e __ LDX #$8e
+213b : a5 1c __ LDA ACCU + 1
+213d : 30 06 __ BMI $2145
+213f : ca __ __ DEX
+2140 : 06 1b __ ASL ACCU + 0
+2142 : 2a __ __ ROL
+2143 : 10 fa __ BPL $213f
+2145 : 29 7f __ AND #$7f
+2147 : 85 1d __ STA ACCU + 2
+2149 : a5 1b __ LDA ACCU + 0
+214b : 85 1c __ STA ACCU + 1
+214d : 8a __ __ TXA
+214e : 4a __ __ LSR
+214f : 85 1e __ STA ACCU + 3
+2151 : a9 00 __ LDA #$00
+2153 : 85 1b __ STA ACCU + 0
+2155 : 6a __ __ ROR
+2156 : 05 1d __ ORA ACCU + 2
+2158 : 85 1d __ STA ACCU + 2
+215a : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+215b : a5 1e __ LDA ACCU + 3
+215d : 45 06 __ EOR $06
+215f : 29 80 __ AND #$80
+2161 : f0 1e __ BEQ $2181
+2163 : a5 1e __ LDA ACCU + 3
+2165 : 29 7f __ AND #$7f
+2167 : 05 1d __ ORA ACCU + 2
+2169 : 05 1c __ ORA ACCU + 1
+216b : 05 1b __ ORA ACCU + 0
+216d : d0 0c __ BNE $217b
+216f : a5 06 __ LDA $06
+2171 : 29 7f __ AND #$7f
+2173 : 05 05 __ ORA $05
+2175 : 05 04 __ ORA $04
+2177 : 05 03 __ ORA $03
+2179 : f0 1e __ BEQ $2199
+217b : a5 1e __ LDA ACCU + 3
+217d : 30 23 __ BMI $21a2
+217f : 10 28 __ BPL $21a9
+2181 : a5 1e __ LDA ACCU + 3
+2183 : c5 06 __ CMP $06
+2185 : d0 15 __ BNE $219c
+2187 : a5 1d __ LDA ACCU + 2
+2189 : c5 05 __ CMP $05
+218b : d0 0f __ BNE $219c
+218d : a5 1c __ LDA ACCU + 1
+218f : c5 04 __ CMP $04
+2191 : d0 09 __ BNE $219c
+2193 : a5 1b __ LDA ACCU + 0
+2195 : c5 03 __ CMP $03
+2197 : d0 03 __ BNE $219c
+2199 : a9 00 __ LDA #$00
+219b : 60 __ __ RTS
+219c : b0 07 __ BCS $21a5
+219e : 24 1e __ BIT ACCU + 3
+21a0 : 30 07 __ BMI $21a9
+21a2 : a9 01 __ LDA #$01
+21a4 : 60 __ __ RTS
+21a5 : 24 1e __ BIT ACCU + 3
+21a7 : 30 f9 __ BMI $21a2
+21a9 : a9 ff __ LDA #$ff
+21ab : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+21ac : 84 02 __ STY $02
+21ae : a9 00 __ LDA #$00
+21b0 : 85 07 __ STA $07
+21b2 : 85 08 __ STA $08
+21b4 : 85 09 __ STA $09
+21b6 : 85 0a __ STA $0a
+21b8 : a0 20 __ LDY #$20
+21ba : 18 __ __ CLC
+21bb : 26 1b __ ROL ACCU + 0
+21bd : 26 1c __ ROL ACCU + 1
+21bf : 26 1d __ ROL ACCU + 2
+21c1 : 26 1e __ ROL ACCU + 3
+21c3 : 26 07 __ ROL $07
+21c5 : 26 08 __ ROL $08
+21c7 : 26 09 __ ROL $09
+21c9 : 26 0a __ ROL $0a
+21cb : a5 07 __ LDA $07
+21cd : c5 03 __ CMP $03
+21cf : a5 08 __ LDA $08
+21d1 : e5 04 __ SBC $04
+21d3 : a5 09 __ LDA $09
+21d5 : e5 05 __ SBC $05
+21d7 : a5 0a __ LDA $0a
+21d9 : e5 06 __ SBC $06
+21db : 90 18 __ BCC $21f5
+21dd : a5 07 __ LDA $07
+21df : e5 03 __ SBC $03
+21e1 : 85 07 __ STA $07
+21e3 : a5 08 __ LDA $08
+21e5 : e5 04 __ SBC $04
+21e7 : 85 08 __ STA $08
+21e9 : a5 09 __ LDA $09
+21eb : e5 05 __ SBC $05
+21ed : 85 09 __ STA $09
+21ef : a5 0a __ LDA $0a
+21f1 : e5 06 __ SBC $06
+21f3 : 85 0a __ STA $0a
+21f5 : 88 __ __ DEY
+21f6 : d0 c3 __ BNE $21bb
+21f8 : 26 1b __ ROL ACCU + 0
+21fa : 26 1c __ ROL ACCU + 1
+21fc : 26 1d __ ROL ACCU + 2
+21fe : 26 1e __ ROL ACCU + 3
+2200 : a4 02 __ LDY $02
+2202 : 60 __ __ RTS
@@ -0,0 +1,3558 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e f7 23 STX $23f7 ; (spentry + 0)
+0811 : a9 fa __ LDA #$fa
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 52 __ LDA #$52
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ee __ LDA #$ee
+0832 : e9 fa __ SBC #$fa
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c a4 1f JMP $1fa4 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 08 __ SBC #$08
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 fa __ LDA #$fa
+090f : 85 65 __ STA T0 + 0
+0911 : a9 23 __ LDA #$23
+0913 : 85 66 __ STA T0 + 1
+0915 : a9 00 __ LDA #$00
+0917 : 85 67 __ STA T1 + 0
+0919 : 85 68 __ STA T1 + 1
+091b : a5 67 __ LDA T1 + 0
+091d : a0 00 __ LDY #$00
+091f : 91 65 __ STA (T0 + 0),y
+0921 : a5 68 __ LDA T1 + 1
+0923 : c8 __ __ INY
+0924 : 91 65 __ STA (T0 + 0),y
+0926 : 18 __ __ CLC
+0927 : a5 65 __ LDA T0 + 0
+0929 : 69 02 __ ADC #$02
+092b : c8 __ __ INY
+092c : 91 23 __ STA (SP + 0),y
+092e : a5 66 __ LDA T0 + 1
+0930 : 69 00 __ ADC #$00
+0932 : c8 __ __ INY
+0933 : 91 23 __ STA (SP + 0),y
+0935 : a9 08 __ LDA #$08
+0937 : c8 __ __ INY
+0938 : 91 23 __ STA (SP + 0),y
+093a : a9 1d __ LDA #$1d
+093c : c8 __ __ INY
+093d : 91 23 __ STA (SP + 0),y
+093f : a5 67 __ LDA T1 + 0
+0941 : c8 __ __ INY
+0942 : 91 23 __ STA (SP + 0),y
+0944 : a5 68 __ LDA T1 + 1
+0946 : c8 __ __ INY
+0947 : 91 23 __ STA (SP + 0),y
+0949 : 20 8b 0a JSR $0a8b ; (sprintf + 0)
+094c : 18 __ __ CLC
+094d : a5 65 __ LDA T0 + 0
+094f : 69 0c __ ADC #$0c
+0951 : 85 65 __ STA T0 + 0
+0953 : 90 02 __ BCC $0957
+0955 : e6 66 __ INC T0 + 1
+0957 : e6 67 __ INC T1 + 0
+0959 : d0 02 __ BNE $095d
+095b : e6 68 __ INC T1 + 1
+095d : a5 68 __ LDA T1 + 1
+095f : 49 80 __ EOR #$80
+0961 : c9 83 __ CMP #$83
+0963 : d0 04 __ BNE $0969
+0965 : a5 67 __ LDA T1 + 0
+0967 : c9 e8 __ CMP #$e8
+0969 : 90 b0 __ BCC $091b
+096b : a9 fa __ LDA #$fa
+096d : 85 67 __ STA T1 + 0
+096f : a9 23 __ LDA #$23
+0971 : 85 68 __ STA T1 + 1
+0973 : 18 __ __ CLC
+0974 : a9 fa __ LDA #$fa
+0976 : 69 e0 __ ADC #$e0
+0978 : 85 69 __ STA T2 + 0
+097a : a9 23 __ LDA #$23
+097c : 69 2e __ ADC #$2e
+097e : 85 6a __ STA T2 + 1
+0980 : ad f9 23 LDA $23f9 ; (seed + 1)
+0983 : 4a __ __ LSR
+0984 : ad f8 23 LDA $23f8 ; (seed + 0)
+0987 : 6a __ __ ROR
+0988 : aa __ __ TAX
+0989 : a9 00 __ LDA #$00
+098b : 6a __ __ ROR
+098c : 4d f8 23 EOR $23f8 ; (seed + 0)
+098f : 85 46 __ STA T5 + 0
+0991 : 8a __ __ TXA
+0992 : 4d f9 23 EOR $23f9 ; (seed + 1)
+0995 : 85 47 __ STA T5 + 1
+0997 : 4a __ __ LSR
+0998 : 45 46 __ EOR T5 + 0
+099a : 85 46 __ STA T5 + 0
+099c : 8d f8 23 STA $23f8 ; (seed + 0)
+099f : 45 47 __ EOR T5 + 1
+09a1 : 85 47 __ STA T5 + 1
+09a3 : 8d f9 23 STA $23f9 ; (seed + 1)
+09a6 : a0 0b __ LDY #$0b
+09a8 : b1 67 __ LDA (T1 + 0),y
+09aa : 99 da 52 STA $52da,y ; (sframe + 0)
+09ad : 88 __ __ DEY
+09ae : 10 f8 __ BPL $09a8
+09b0 : a5 46 __ LDA T5 + 0
+09b2 : 85 1b __ STA ACCU + 0
+09b4 : a5 47 __ LDA T5 + 1
+09b6 : 85 1c __ STA ACCU + 1
+09b8 : a9 e8 __ LDA #$e8
+09ba : 85 03 __ STA $03
+09bc : a9 03 __ LDA #$03
+09be : 85 04 __ STA $04
+09c0 : 20 14 22 JSR $2214 ; (divmod + 0)
+09c3 : a5 05 __ LDA $05
+09c5 : 0a __ __ ASL
+09c6 : aa __ __ TAX
+09c7 : a5 06 __ LDA $06
+09c9 : 2a __ __ ROL
+09ca : a8 __ __ TAY
+09cb : 18 __ __ CLC
+09cc : 8a __ __ TXA
+09cd : 65 05 __ ADC $05
+09cf : 85 1b __ STA ACCU + 0
+09d1 : 98 __ __ TYA
+09d2 : 65 06 __ ADC $06
+09d4 : 06 1b __ ASL ACCU + 0
+09d6 : 2a __ __ ROL
+09d7 : 06 1b __ ASL ACCU + 0
+09d9 : 2a __ __ ROL
+09da : 85 1c __ STA ACCU + 1
+09dc : 18 __ __ CLC
+09dd : a9 fa __ LDA #$fa
+09df : 65 1b __ ADC ACCU + 0
+09e1 : 85 46 __ STA T5 + 0
+09e3 : a9 23 __ LDA #$23
+09e5 : 65 1c __ ADC ACCU + 1
+09e7 : 85 47 __ STA T5 + 1
+09e9 : a0 0b __ LDY #$0b
+09eb : b1 46 __ LDA (T5 + 0),y
+09ed : 91 67 __ STA (T1 + 0),y
+09ef : 88 __ __ DEY
+09f0 : 10 f9 __ BPL $09eb
+09f2 : a0 0b __ LDY #$0b
+09f4 : b9 da 52 LDA $52da,y ; (sframe + 0)
+09f7 : 91 46 __ STA (T5 + 0),y
+09f9 : 88 __ __ DEY
+09fa : 10 f8 __ BPL $09f4
+09fc : 18 __ __ CLC
+09fd : a5 67 __ LDA T1 + 0
+09ff : 69 0c __ ADC #$0c
+0a01 : 85 67 __ STA T1 + 0
+0a03 : a5 68 __ LDA T1 + 1
+0a05 : 69 00 __ ADC #$00
+0a07 : 85 68 __ STA T1 + 1
+0a09 : c5 6a __ CMP T2 + 1
+0a0b : d0 04 __ BNE $0a11
+0a0d : a5 67 __ LDA T1 + 0
+0a0f : c5 69 __ CMP T2 + 0
+0a11 : b0 03 __ BCS $0a16
+0a13 : 4c 80 09 JMP $0980 ; (main + 128)
+0a16 : a9 fa __ LDA #$fa
+0a18 : a0 02 __ LDY #$02
+0a1a : 91 23 __ STA (SP + 0),y
+0a1c : a9 23 __ LDA #$23
+0a1e : c8 __ __ INY
+0a1f : 91 23 __ STA (SP + 0),y
+0a21 : a9 e8 __ LDA #$e8
+0a23 : c8 __ __ INY
+0a24 : 91 23 __ STA (SP + 0),y
+0a26 : a9 03 __ LDA #$03
+0a28 : c8 __ __ INY
+0a29 : 91 23 __ STA (SP + 0),y
+0a2b : 20 0d 1d JSR $1d0d ; (qsort + 0)
+0a2e : a9 fa __ LDA #$fa
+0a30 : 85 65 __ STA T0 + 0
+0a32 : a9 23 __ LDA #$23
+0a34 : 85 66 __ STA T0 + 1
+0a36 : a9 00 __ LDA #$00
+0a38 : 85 67 __ STA T1 + 0
+0a3a : 85 68 __ STA T1 + 1
+0a3c : a0 00 __ LDY #$00
+0a3e : b1 65 __ LDA (T0 + 0),y
+0a40 : 85 69 __ STA T2 + 0
+0a42 : c8 __ __ INY
+0a43 : b1 65 __ LDA (T0 + 0),y
+0a45 : c5 68 __ CMP T1 + 1
+0a47 : d0 06 __ BNE $0a4f
+0a49 : a5 69 __ LDA T2 + 0
+0a4b : c5 67 __ CMP T1 + 0
+0a4d : f0 09 __ BEQ $0a58
+0a4f : a9 ff __ LDA #$ff
+0a51 : 85 0d __ STA P0
+0a53 : 85 0e __ STA P1
+0a55 : 20 8f 1f JSR $1f8f ; (exit + 0)
+0a58 : 18 __ __ CLC
+0a59 : a5 65 __ LDA T0 + 0
+0a5b : 69 0c __ ADC #$0c
+0a5d : 85 65 __ STA T0 + 0
+0a5f : 90 02 __ BCC $0a63
+0a61 : e6 66 __ INC T0 + 1
+0a63 : e6 67 __ INC T1 + 0
+0a65 : d0 02 __ BNE $0a69
+0a67 : e6 68 __ INC T1 + 1
+0a69 : a5 68 __ LDA T1 + 1
+0a6b : 49 80 __ EOR #$80
+0a6d : c9 83 __ CMP #$83
+0a6f : d0 04 __ BNE $0a75
+0a71 : a5 67 __ LDA T1 + 0
+0a73 : c9 e8 __ CMP #$e8
+0a75 : 90 c5 __ BCC $0a3c
+0a77 : a9 00 __ LDA #$00
+0a79 : 85 1b __ STA ACCU + 0
+0a7b : 85 1c __ STA ACCU + 1
+0a7d : 18 __ __ CLC
+0a7e : a5 23 __ LDA SP + 0
+0a80 : 69 08 __ ADC #$08
+0a82 : 85 23 __ STA SP + 0
+0a84 : a5 24 __ LDA SP + 1
+0a86 : 69 00 __ ADC #$00
+0a88 : 85 24 __ STA SP + 1
+0a8a : 60 __ __ RTS
+--------------------------------------------------------------------
+sprintf:
+0a8b : a9 00 __ LDA #$00
+0a8d : 85 43 __ STA T0 + 0
+0a8f : a0 04 __ LDY #$04
+0a91 : b1 23 __ LDA (SP + 0),y
+0a93 : 85 45 __ STA T1 + 0
+0a95 : c8 __ __ INY
+0a96 : b1 23 __ LDA (SP + 0),y
+0a98 : 85 46 __ STA T1 + 1
+0a9a : a0 00 __ LDY #$00
+0a9c : b1 45 __ LDA (T1 + 0),y
+0a9e : 85 47 __ STA T2 + 0
+0aa0 : a0 02 __ LDY #$02
+0aa2 : b1 23 __ LDA (SP + 0),y
+0aa4 : 85 49 __ STA T3 + 0
+0aa6 : c8 __ __ INY
+0aa7 : b1 23 __ LDA (SP + 0),y
+0aa9 : 85 4a __ STA T3 + 1
+0aab : a5 47 __ LDA T2 + 0
+0aad : d0 37 __ BNE $0ae6
+0aaf : 18 __ __ CLC
+0ab0 : a5 49 __ LDA T3 + 0
+0ab2 : 65 43 __ ADC T0 + 0
+0ab4 : 85 45 __ STA T1 + 0
+0ab6 : a5 4a __ LDA T3 + 1
+0ab8 : 69 00 __ ADC #$00
+0aba : 85 46 __ STA T1 + 1
+0abc : a9 00 __ LDA #$00
+0abe : a4 43 __ LDY T0 + 0
+0ac0 : 91 49 __ STA (T3 + 0),y
+0ac2 : 98 __ __ TYA
+0ac3 : d0 08 __ BNE $0acd
+0ac5 : a5 49 __ LDA T3 + 0
+0ac7 : 85 45 __ STA T1 + 0
+0ac9 : a5 4a __ LDA T3 + 1
+0acb : 85 46 __ STA T1 + 1
+0acd : a0 02 __ LDY #$02
+0acf : b1 23 __ LDA (SP + 0),y
+0ad1 : 85 49 __ STA T3 + 0
+0ad3 : c8 __ __ INY
+0ad4 : b1 23 __ LDA (SP + 0),y
+0ad6 : 85 4a __ STA T3 + 1
+0ad8 : 38 __ __ SEC
+0ad9 : a5 45 __ LDA T1 + 0
+0adb : e5 49 __ SBC T3 + 0
+0add : 85 1b __ STA ACCU + 0
+0adf : a5 46 __ LDA T1 + 1
+0ae1 : e5 4a __ SBC T3 + 1
+0ae3 : 85 1c __ STA ACCU + 1
+0ae5 : 60 __ __ RTS
+0ae6 : 18 __ __ CLC
+0ae7 : a5 23 __ LDA SP + 0
+0ae9 : 69 06 __ ADC #$06
+0aeb : 85 4b __ STA T4 + 0
+0aed : a5 24 __ LDA SP + 1
+0aef : 69 00 __ ADC #$00
+0af1 : 85 4c __ STA T4 + 1
+0af3 : e6 45 __ INC T1 + 0
+0af5 : d0 02 __ BNE $0af9
+0af7 : e6 46 __ INC T1 + 1
+0af9 : a5 47 __ LDA T2 + 0
+0afb : c9 25 __ CMP #$25
+0afd : f0 3d __ BEQ $0b3c
+0aff : a4 43 __ LDY T0 + 0
+0b01 : 91 49 __ STA (T3 + 0),y
+0b03 : e6 43 __ INC T0 + 0
+0b05 : a5 43 __ LDA T0 + 0
+0b07 : c9 28 __ CMP #$28
+0b09 : a0 00 __ LDY #$00
+0b0b : 90 20 __ BCC $0b2d
+0b0d : 18 __ __ CLC
+0b0e : 65 49 __ ADC T3 + 0
+0b10 : 85 49 __ STA T3 + 0
+0b12 : 90 02 __ BCC $0b16
+0b14 : e6 4a __ INC T3 + 1
+0b16 : a9 00 __ LDA #$00
+0b18 : 85 43 __ STA T0 + 0
+0b1a : b1 45 __ LDA (T1 + 0),y
+0b1c : 85 4d __ STA T5 + 0
+0b1e : e6 45 __ INC T1 + 0
+0b20 : d0 02 __ BNE $0b24
+0b22 : e6 46 __ INC T1 + 1
+0b24 : a5 4d __ LDA T5 + 0
+0b26 : 85 47 __ STA T2 + 0
+0b28 : d0 cf __ BNE $0af9
+0b2a : 4c af 0a JMP $0aaf ; (sprintf + 36)
+0b2d : a0 00 __ LDY #$00
+0b2f : b1 45 __ LDA (T1 + 0),y
+0b31 : 85 4d __ STA T5 + 0
+0b33 : e6 45 __ INC T1 + 0
+0b35 : d0 02 __ BNE $0b39
+0b37 : e6 46 __ INC T1 + 1
+0b39 : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+0b3c : a5 43 __ LDA T0 + 0
+0b3e : f0 0d __ BEQ $0b4d
+0b40 : 18 __ __ CLC
+0b41 : 65 49 __ ADC T3 + 0
+0b43 : 85 49 __ STA T3 + 0
+0b45 : 90 02 __ BCC $0b49
+0b47 : e6 4a __ INC T3 + 1
+0b49 : a9 00 __ LDA #$00
+0b4b : 85 43 __ STA T0 + 0
+0b4d : a0 00 __ LDY #$00
+0b4f : b1 45 __ LDA (T1 + 0),y
+0b51 : 85 47 __ STA T2 + 0
+0b53 : a9 0a __ LDA #$0a
+0b55 : 8d e9 52 STA $52e9 ; (sframe + 15)
+0b58 : a9 00 __ LDA #$00
+0b5a : 8d ea 52 STA $52ea ; (sframe + 16)
+0b5d : a9 01 __ LDA #$01
+0b5f : 8d e7 52 STA $52e7 ; (sframe + 13)
+0b62 : a9 ff __ LDA #$ff
+0b64 : 8d e8 52 STA $52e8 ; (sframe + 14)
+0b67 : a9 20 __ LDA #$20
+0b69 : 8d e6 52 STA $52e6 ; (sframe + 12)
+0b6c : a9 00 __ LDA #$00
+0b6e : 8d eb 52 STA $52eb ; (sframe + 17)
+0b71 : 8d ec 52 STA $52ec ; (sframe + 18)
+0b74 : 8d ed 52 STA $52ed ; (sframe + 19)
+0b77 : e6 45 __ INC T1 + 0
+0b79 : d0 02 __ BNE $0b7d
+0b7b : e6 46 __ INC T1 + 1
+0b7d : a5 47 __ LDA T2 + 0
+0b7f : c9 2b __ CMP #$2b
+0b81 : d0 03 __ BNE $0b86
+0b83 : 4c fa 1c JMP $1cfa ; (sprintf + 4719)
+0b86 : c9 30 __ CMP #$30
+0b88 : d0 03 __ BNE $0b8d
+0b8a : 4c ec 1c JMP $1cec ; (sprintf + 4705)
+0b8d : c9 23 __ CMP #$23
+0b8f : d0 03 __ BNE $0b94
+0b91 : 4c de 1c JMP $1cde ; (sprintf + 4691)
+0b94 : c9 30 __ CMP #$30
+0b96 : 90 66 __ BCC $0bfe
+0b98 : a9 39 __ LDA #$39
+0b9a : c5 47 __ CMP T2 + 0
+0b9c : 90 60 __ BCC $0bfe
+0b9e : a9 00 __ LDA #$00
+0ba0 : 85 4f __ STA T6 + 0
+0ba2 : 85 50 __ STA T6 + 1
+0ba4 : a5 47 __ LDA T2 + 0
+0ba6 : c9 30 __ CMP #$30
+0ba8 : 90 4f __ BCC $0bf9
+0baa : a9 39 __ LDA #$39
+0bac : c5 47 __ CMP T2 + 0
+0bae : 90 49 __ BCC $0bf9
+0bb0 : a5 47 __ LDA T2 + 0
+0bb2 : 85 51 __ STA T7 + 0
+0bb4 : a0 00 __ LDY #$00
+0bb6 : b1 45 __ LDA (T1 + 0),y
+0bb8 : 85 47 __ STA T2 + 0
+0bba : e6 45 __ INC T1 + 0
+0bbc : d0 02 __ BNE $0bc0
+0bbe : e6 46 __ INC T1 + 1
+0bc0 : a5 4f __ LDA T6 + 0
+0bc2 : 0a __ __ ASL
+0bc3 : 85 07 __ STA $07
+0bc5 : a5 50 __ LDA T6 + 1
+0bc7 : 2a __ __ ROL
+0bc8 : 06 07 __ ASL $07
+0bca : 2a __ __ ROL
+0bcb : 85 08 __ STA $08
+0bcd : 18 __ __ CLC
+0bce : a5 07 __ LDA $07
+0bd0 : 65 4f __ ADC T6 + 0
+0bd2 : 85 1b __ STA ACCU + 0
+0bd4 : a5 08 __ LDA $08
+0bd6 : 65 50 __ ADC T6 + 1
+0bd8 : 06 1b __ ASL ACCU + 0
+0bda : 2a __ __ ROL
+0bdb : 85 1c __ STA ACCU + 1
+0bdd : 18 __ __ CLC
+0bde : a5 1b __ LDA ACCU + 0
+0be0 : 65 51 __ ADC T7 + 0
+0be2 : aa __ __ TAX
+0be3 : a5 1c __ LDA ACCU + 1
+0be5 : 69 00 __ ADC #$00
+0be7 : a8 __ __ TAY
+0be8 : 38 __ __ SEC
+0be9 : 8a __ __ TXA
+0bea : e9 30 __ SBC #$30
+0bec : 85 4f __ STA T6 + 0
+0bee : 98 __ __ TYA
+0bef : e9 00 __ SBC #$00
+0bf1 : 85 50 __ STA T6 + 1
+0bf3 : a5 47 __ LDA T2 + 0
+0bf5 : c9 30 __ CMP #$30
+0bf7 : b0 b1 __ BCS $0baa
+0bf9 : a5 4f __ LDA T6 + 0
+0bfb : 8d e7 52 STA $52e7 ; (sframe + 13)
+0bfe : a5 47 __ LDA T2 + 0
+0c00 : c9 2e __ CMP #$2e
+0c02 : d0 03 __ BNE $0c07
+0c04 : 4c 6f 1c JMP $1c6f ; (sprintf + 4580)
+0c07 : a5 47 __ LDA T2 + 0
+0c09 : c9 64 __ CMP #$64
+0c0b : d0 03 __ BNE $0c10
+0c0d : 4c f1 1a JMP $1af1 ; (sprintf + 4198)
+0c10 : c9 75 __ CMP #$75
+0c12 : d0 03 __ BNE $0c17
+0c14 : 4c b1 19 JMP $19b1 ; (sprintf + 3878)
+0c17 : c9 78 __ CMP #$78
+0c19 : d0 03 __ BNE $0c1e
+0c1b : 4c 67 18 JMP $1867 ; (sprintf + 3548)
+0c1e : c9 6c __ CMP #$6c
+0c20 : d0 03 __ BNE $0c25
+0c22 : 4c 24 13 JMP $1324 ; (sprintf + 2201)
+0c25 : c9 66 __ CMP #$66
+0c27 : d0 03 __ BNE $0c2c
+0c29 : 4c c7 0c JMP $0cc7 ; (sprintf + 572)
+0c2c : c9 67 __ CMP #$67
+0c2e : d0 03 __ BNE $0c33
+0c30 : 4c c7 0c JMP $0cc7 ; (sprintf + 572)
+0c33 : c9 65 __ CMP #$65
+0c35 : d0 03 __ BNE $0c3a
+0c37 : 4c c7 0c JMP $0cc7 ; (sprintf + 572)
+0c3a : c9 73 __ CMP #$73
+0c3c : f0 46 __ BEQ $0c84
+0c3e : c9 63 __ CMP #$63
+0c40 : f0 1e __ BEQ $0c60
+0c42 : 09 00 __ ORA #$00
+0c44 : d0 03 __ BNE $0c49
+0c46 : 4c 2d 0b JMP $0b2d ; (sprintf + 162)
+0c49 : a5 47 __ LDA T2 + 0
+0c4b : a4 43 __ LDY T0 + 0
+0c4d : 91 49 __ STA (T3 + 0),y
+0c4f : e6 43 __ INC T0 + 0
+0c51 : a0 00 __ LDY #$00
+0c53 : b1 45 __ LDA (T1 + 0),y
+0c55 : 85 4d __ STA T5 + 0
+0c57 : e6 45 __ INC T1 + 0
+0c59 : d0 02 __ BNE $0c5d
+0c5b : e6 46 __ INC T1 + 1
+0c5d : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+0c60 : a0 00 __ LDY #$00
+0c62 : b1 4b __ LDA (T4 + 0),y
+0c64 : a4 43 __ LDY T0 + 0
+0c66 : 91 49 __ STA (T3 + 0),y
+0c68 : 18 __ __ CLC
+0c69 : a5 4b __ LDA T4 + 0
+0c6b : 69 02 __ ADC #$02
+0c6d : 85 4b __ STA T4 + 0
+0c6f : 90 02 __ BCC $0c73
+0c71 : e6 4c __ INC T4 + 1
+0c73 : e6 43 __ INC T0 + 0
+0c75 : a0 00 __ LDY #$00
+0c77 : b1 45 __ LDA (T1 + 0),y
+0c79 : 85 4d __ STA T5 + 0
+0c7b : e6 45 __ INC T1 + 0
+0c7d : d0 02 __ BNE $0c81
+0c7f : e6 46 __ INC T1 + 1
+0c81 : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+0c84 : a0 00 __ LDY #$00
+0c86 : b1 4b __ LDA (T4 + 0),y
+0c88 : 85 4f __ STA T6 + 0
+0c8a : c8 __ __ INY
+0c8b : b1 4b __ LDA (T4 + 0),y
+0c8d : 85 50 __ STA T6 + 1
+0c8f : 18 __ __ CLC
+0c90 : a5 4b __ LDA T4 + 0
+0c92 : 69 02 __ ADC #$02
+0c94 : 85 4b __ STA T4 + 0
+0c96 : 90 02 __ BCC $0c9a
+0c98 : e6 4c __ INC T4 + 1
+0c9a : 88 __ __ DEY
+0c9b : b1 4f __ LDA (T6 + 0),y
+0c9d : 85 47 __ STA T2 + 0
+0c9f : d0 03 __ BNE $0ca4
+0ca1 : 4c 2d 0b JMP $0b2d ; (sprintf + 162)
+0ca4 : e6 4f __ INC T6 + 0
+0ca6 : d0 02 __ BNE $0caa
+0ca8 : e6 50 __ INC T6 + 1
+0caa : a5 47 __ LDA T2 + 0
+0cac : a0 00 __ LDY #$00
+0cae : 91 49 __ STA (T3 + 0),y
+0cb0 : e6 49 __ INC T3 + 0
+0cb2 : d0 02 __ BNE $0cb6
+0cb4 : e6 4a __ INC T3 + 1
+0cb6 : b1 4f __ LDA (T6 + 0),y
+0cb8 : aa __ __ TAX
+0cb9 : e6 4f __ INC T6 + 0
+0cbb : d0 02 __ BNE $0cbf
+0cbd : e6 50 __ INC T6 + 1
+0cbf : 8a __ __ TXA
+0cc0 : 86 47 __ STX T2 + 0
+0cc2 : d0 e6 __ BNE $0caa
+0cc4 : 4c 2d 0b JMP $0b2d ; (sprintf + 162)
+0cc7 : a0 00 __ LDY #$00
+0cc9 : b1 4b __ LDA (T4 + 0),y
+0ccb : 85 58 __ STA T11 + 0
+0ccd : 85 03 __ STA $03
+0ccf : c8 __ __ INY
+0cd0 : b1 4b __ LDA (T4 + 0),y
+0cd2 : 85 59 __ STA T11 + 1
+0cd4 : 85 04 __ STA $04
+0cd6 : c8 __ __ INY
+0cd7 : b1 4b __ LDA (T4 + 0),y
+0cd9 : 85 5a __ STA T11 + 2
+0cdb : 85 05 __ STA $05
+0cdd : c8 __ __ INY
+0cde : b1 4b __ LDA (T4 + 0),y
+0ce0 : 85 5b __ STA T11 + 3
+0ce2 : 85 06 __ STA $06
+0ce4 : a5 47 __ LDA T2 + 0
+0ce6 : 85 43 __ STA T0 + 0
+0ce8 : a5 49 __ LDA T3 + 0
+0cea : 85 4f __ STA T6 + 0
+0cec : a5 4a __ LDA T3 + 1
+0cee : 85 50 __ STA T6 + 1
+0cf0 : a9 00 __ LDA #$00
+0cf2 : 85 1b __ STA ACCU + 0
+0cf4 : 85 1c __ STA ACCU + 1
+0cf6 : 85 1d __ STA ACCU + 2
+0cf8 : 85 1e __ STA ACCU + 3
+0cfa : 20 4f 23 JSR $234f ; (fcmp + 0)
+0cfd : 10 03 __ BPL $0d02
+0cff : 4c 11 13 JMP $1311 ; (sprintf + 2182)
+0d02 : a9 00 __ LDA #$00
+0d04 : 85 47 __ STA T2 + 0
+0d06 : ad eb 52 LDA $52eb ; (sframe + 17)
+0d09 : f0 0a __ BEQ $0d15
+0d0b : a9 2b __ LDA #$2b
+0d0d : a0 00 __ LDY #$00
+0d0f : 91 49 __ STA (T3 + 0),y
+0d11 : a9 01 __ LDA #$01
+0d13 : 85 47 __ STA T2 + 0
+0d15 : a9 00 __ LDA #$00
+0d17 : 85 51 __ STA T7 + 0
+0d19 : 85 52 __ STA T7 + 1
+0d1b : ad e8 52 LDA $52e8 ; (sframe + 14)
+0d1e : 85 4d __ STA T5 + 0
+0d20 : c9 ff __ CMP #$ff
+0d22 : d0 04 __ BNE $0d28
+0d24 : a9 06 __ LDA #$06
+0d26 : 85 4d __ STA T5 + 0
+0d28 : a9 00 __ LDA #$00
+0d2a : 85 1b __ STA ACCU + 0
+0d2c : 85 1c __ STA ACCU + 1
+0d2e : 85 1d __ STA ACCU + 2
+0d30 : 85 1e __ STA ACCU + 3
+0d32 : a5 58 __ LDA T11 + 0
+0d34 : 85 03 __ STA $03
+0d36 : a5 59 __ LDA T11 + 1
+0d38 : 85 04 __ STA $04
+0d3a : a5 5a __ LDA T11 + 2
+0d3c : 85 05 __ STA $05
+0d3e : a5 5b __ LDA T11 + 3
+0d40 : 85 06 __ STA $06
+0d42 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0d45 : d0 03 __ BNE $0d4a
+0d47 : 4c be 0e JMP $0ebe ; (sprintf + 1075)
+0d4a : a9 00 __ LDA #$00
+0d4c : 85 1b __ STA ACCU + 0
+0d4e : 85 1c __ STA ACCU + 1
+0d50 : a9 7a __ LDA #$7a
+0d52 : 85 1d __ STA ACCU + 2
+0d54 : a9 44 __ LDA #$44
+0d56 : 85 1e __ STA ACCU + 3
+0d58 : a5 58 __ LDA T11 + 0
+0d5a : 85 03 __ STA $03
+0d5c : a5 59 __ LDA T11 + 1
+0d5e : 85 04 __ STA $04
+0d60 : a5 5a __ LDA T11 + 2
+0d62 : 85 05 __ STA $05
+0d64 : a5 5b __ LDA T11 + 3
+0d66 : 85 06 __ STA $06
+0d68 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0d6b : 30 5a __ BMI $0dc7
+0d6d : 18 __ __ CLC
+0d6e : a5 51 __ LDA T7 + 0
+0d70 : 69 03 __ ADC #$03
+0d72 : 85 51 __ STA T7 + 0
+0d74 : 90 02 __ BCC $0d78
+0d76 : e6 52 __ INC T7 + 1
+0d78 : a5 58 __ LDA T11 + 0
+0d7a : 85 1b __ STA ACCU + 0
+0d7c : a5 59 __ LDA T11 + 1
+0d7e : 85 1c __ STA ACCU + 1
+0d80 : a5 5a __ LDA T11 + 2
+0d82 : 85 1d __ STA ACCU + 2
+0d84 : a5 5b __ LDA T11 + 3
+0d86 : 85 1e __ STA ACCU + 3
+0d88 : a9 00 __ LDA #$00
+0d8a : 85 03 __ STA $03
+0d8c : 85 04 __ STA $04
+0d8e : a9 7a __ LDA #$7a
+0d90 : 85 05 __ STA $05
+0d92 : a9 44 __ LDA #$44
+0d94 : 85 06 __ STA $06
+0d96 : 20 c5 1f JSR $1fc5 ; (freg + 20)
+0d99 : 20 5c 21 JSR $215c ; (fdiv + 0)
+0d9c : a5 1b __ LDA ACCU + 0
+0d9e : 85 58 __ STA T11 + 0
+0da0 : 85 03 __ STA $03
+0da2 : a5 1c __ LDA ACCU + 1
+0da4 : 85 59 __ STA T11 + 1
+0da6 : 85 04 __ STA $04
+0da8 : a5 1d __ LDA ACCU + 2
+0daa : 85 5a __ STA T11 + 2
+0dac : 85 05 __ STA $05
+0dae : a5 1e __ LDA ACCU + 3
+0db0 : 85 5b __ STA T11 + 3
+0db2 : 85 06 __ STA $06
+0db4 : a9 00 __ LDA #$00
+0db6 : 85 1b __ STA ACCU + 0
+0db8 : 85 1c __ STA ACCU + 1
+0dba : a9 7a __ LDA #$7a
+0dbc : 85 1d __ STA ACCU + 2
+0dbe : a9 44 __ LDA #$44
+0dc0 : 85 1e __ STA ACCU + 3
+0dc2 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0dc5 : 10 a6 __ BPL $0d6d
+0dc7 : a9 00 __ LDA #$00
+0dc9 : 85 1b __ STA ACCU + 0
+0dcb : 85 1c __ STA ACCU + 1
+0dcd : a9 80 __ LDA #$80
+0dcf : 85 1d __ STA ACCU + 2
+0dd1 : a9 3f __ LDA #$3f
+0dd3 : 85 1e __ STA ACCU + 3
+0dd5 : a5 58 __ LDA T11 + 0
+0dd7 : 85 03 __ STA $03
+0dd9 : a5 59 __ LDA T11 + 1
+0ddb : 85 04 __ STA $04
+0ddd : a5 5a __ LDA T11 + 2
+0ddf : 85 05 __ STA $05
+0de1 : a5 5b __ LDA T11 + 3
+0de3 : 85 06 __ STA $06
+0de5 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0de8 : 10 5c __ BPL $0e46
+0dea : 38 __ __ SEC
+0deb : a5 51 __ LDA T7 + 0
+0ded : e9 03 __ SBC #$03
+0def : 85 51 __ STA T7 + 0
+0df1 : a5 52 __ LDA T7 + 1
+0df3 : e9 00 __ SBC #$00
+0df5 : 85 52 __ STA T7 + 1
+0df7 : a5 58 __ LDA T11 + 0
+0df9 : 85 1b __ STA ACCU + 0
+0dfb : a5 59 __ LDA T11 + 1
+0dfd : 85 1c __ STA ACCU + 1
+0dff : a5 5a __ LDA T11 + 2
+0e01 : 85 1d __ STA ACCU + 2
+0e03 : a5 5b __ LDA T11 + 3
+0e05 : 85 1e __ STA ACCU + 3
+0e07 : a9 00 __ LDA #$00
+0e09 : 85 03 __ STA $03
+0e0b : 85 04 __ STA $04
+0e0d : a9 7a __ LDA #$7a
+0e0f : 85 05 __ STA $05
+0e11 : a9 44 __ LDA #$44
+0e13 : 85 06 __ STA $06
+0e15 : 20 c5 1f JSR $1fc5 ; (freg + 20)
+0e18 : 20 be 20 JSR $20be ; (fmul + 0)
+0e1b : a5 1b __ LDA ACCU + 0
+0e1d : 85 58 __ STA T11 + 0
+0e1f : 85 03 __ STA $03
+0e21 : a5 1c __ LDA ACCU + 1
+0e23 : 85 59 __ STA T11 + 1
+0e25 : 85 04 __ STA $04
+0e27 : a5 1d __ LDA ACCU + 2
+0e29 : 85 5a __ STA T11 + 2
+0e2b : 85 05 __ STA $05
+0e2d : a5 1e __ LDA ACCU + 3
+0e2f : 85 5b __ STA T11 + 3
+0e31 : 85 06 __ STA $06
+0e33 : a9 00 __ LDA #$00
+0e35 : 85 1b __ STA ACCU + 0
+0e37 : 85 1c __ STA ACCU + 1
+0e39 : a9 80 __ LDA #$80
+0e3b : 85 1d __ STA ACCU + 2
+0e3d : a9 3f __ LDA #$3f
+0e3f : 85 1e __ STA ACCU + 3
+0e41 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0e44 : 30 a4 __ BMI $0dea
+0e46 : a9 00 __ LDA #$00
+0e48 : 85 1b __ STA ACCU + 0
+0e4a : 85 1c __ STA ACCU + 1
+0e4c : a9 20 __ LDA #$20
+0e4e : 85 1d __ STA ACCU + 2
+0e50 : a9 41 __ LDA #$41
+0e52 : 85 1e __ STA ACCU + 3
+0e54 : a5 58 __ LDA T11 + 0
+0e56 : 85 03 __ STA $03
+0e58 : a5 59 __ LDA T11 + 1
+0e5a : 85 04 __ STA $04
+0e5c : a5 5a __ LDA T11 + 2
+0e5e : 85 05 __ STA $05
+0e60 : a5 5b __ LDA T11 + 3
+0e62 : 85 06 __ STA $06
+0e64 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0e67 : 30 55 __ BMI $0ebe
+0e69 : e6 51 __ INC T7 + 0
+0e6b : d0 02 __ BNE $0e6f
+0e6d : e6 52 __ INC T7 + 1
+0e6f : a5 58 __ LDA T11 + 0
+0e71 : 85 1b __ STA ACCU + 0
+0e73 : a5 59 __ LDA T11 + 1
+0e75 : 85 1c __ STA ACCU + 1
+0e77 : a5 5a __ LDA T11 + 2
+0e79 : 85 1d __ STA ACCU + 2
+0e7b : a5 5b __ LDA T11 + 3
+0e7d : 85 1e __ STA ACCU + 3
+0e7f : a9 00 __ LDA #$00
+0e81 : 85 03 __ STA $03
+0e83 : 85 04 __ STA $04
+0e85 : a9 20 __ LDA #$20
+0e87 : 85 05 __ STA $05
+0e89 : a9 41 __ LDA #$41
+0e8b : 85 06 __ STA $06
+0e8d : 20 c5 1f JSR $1fc5 ; (freg + 20)
+0e90 : 20 5c 21 JSR $215c ; (fdiv + 0)
+0e93 : a5 1b __ LDA ACCU + 0
+0e95 : 85 58 __ STA T11 + 0
+0e97 : 85 03 __ STA $03
+0e99 : a5 1c __ LDA ACCU + 1
+0e9b : 85 59 __ STA T11 + 1
+0e9d : 85 04 __ STA $04
+0e9f : a5 1d __ LDA ACCU + 2
+0ea1 : 85 5a __ STA T11 + 2
+0ea3 : 85 05 __ STA $05
+0ea5 : a5 1e __ LDA ACCU + 3
+0ea7 : 85 5b __ STA T11 + 3
+0ea9 : 85 06 __ STA $06
+0eab : a9 00 __ LDA #$00
+0ead : 85 1b __ STA ACCU + 0
+0eaf : 85 1c __ STA ACCU + 1
+0eb1 : a9 20 __ LDA #$20
+0eb3 : 85 1d __ STA ACCU + 2
+0eb5 : a9 41 __ LDA #$41
+0eb7 : 85 1e __ STA ACCU + 3
+0eb9 : 20 4f 23 JSR $234f ; (fcmp + 0)
+0ebc : 10 ab __ BPL $0e69
+0ebe : a5 43 __ LDA T0 + 0
+0ec0 : c9 65 __ CMP #$65
+0ec2 : d0 03 __ BNE $0ec7
+0ec4 : 4c 0c 13 JMP $130c ; (sprintf + 2177)
+0ec7 : a9 00 __ LDA #$00
+0ec9 : 85 57 __ STA T10 + 0
+0ecb : 85 60 __ STA T13 + 0
+0ecd : a5 4d __ LDA T5 + 0
+0ecf : 85 53 __ STA T8 + 0
+0ed1 : e6 53 __ INC T8 + 0
+0ed3 : a5 43 __ LDA T0 + 0
+0ed5 : c9 67 __ CMP #$67
+0ed7 : d0 03 __ BNE $0edc
+0ed9 : 4c ef 12 JMP $12ef ; (sprintf + 2148)
+0edc : a5 57 __ LDA T10 + 0
+0ede : f0 03 __ BEQ $0ee3
+0ee0 : 4c fd 11 JMP $11fd ; (sprintf + 1906)
+0ee3 : a5 52 __ LDA T7 + 1
+0ee5 : 10 03 __ BPL $0eea
+0ee7 : 4c bc 11 JMP $11bc ; (sprintf + 1841)
+0eea : a9 00 __ LDA #$00
+0eec : 85 5c __ STA T12 + 0
+0eee : 85 5d __ STA T12 + 1
+0ef0 : 85 5e __ STA T12 + 2
+0ef2 : a9 3f __ LDA #$3f
+0ef4 : 85 5f __ STA T12 + 3
+0ef6 : 18 __ __ CLC
+0ef7 : a5 4d __ LDA T5 + 0
+0ef9 : 65 51 __ ADC T7 + 0
+0efb : 85 53 __ STA T8 + 0
+0efd : e6 53 __ INC T8 + 0
+0eff : a9 01 __ LDA #$01
+0f01 : c5 53 __ CMP T8 + 0
+0f03 : b0 03 __ BCS $0f08
+0f05 : 4c 7b 11 JMP $117b ; (sprintf + 1776)
+0f08 : a5 58 __ LDA T11 + 0
+0f0a : 85 1b __ STA ACCU + 0
+0f0c : a5 59 __ LDA T11 + 1
+0f0e : 85 1c __ STA ACCU + 1
+0f10 : a5 5a __ LDA T11 + 2
+0f12 : 85 1d __ STA ACCU + 2
+0f14 : a5 5b __ LDA T11 + 3
+0f16 : 85 1e __ STA ACCU + 3
+0f18 : a5 5c __ LDA T12 + 0
+0f1a : 85 03 __ STA $03
+0f1c : a5 5d __ LDA T12 + 1
+0f1e : 85 04 __ STA $04
+0f20 : a5 5e __ LDA T12 + 2
+0f22 : 85 05 __ STA $05
+0f24 : a5 5f __ LDA T12 + 3
+0f26 : 85 06 __ STA $06
+0f28 : 20 c5 1f JSR $1fc5 ; (freg + 20)
+0f2b : 20 f6 1f JSR $1ff6 ; (faddsub + 0)
+0f2e : a5 1b __ LDA ACCU + 0
+0f30 : 85 5c __ STA T12 + 0
+0f32 : 85 58 __ STA T11 + 0
+0f34 : 85 03 __ STA $03
+0f36 : a5 1c __ LDA ACCU + 1
+0f38 : 85 5d __ STA T12 + 1
+0f3a : 85 59 __ STA T11 + 1
+0f3c : 85 04 __ STA $04
+0f3e : a5 1d __ LDA ACCU + 2
+0f40 : 85 5e __ STA T12 + 2
+0f42 : 85 5a __ STA T11 + 2
+0f44 : 85 05 __ STA $05
+0f46 : a5 1e __ LDA ACCU + 3
+0f48 : 85 5f __ STA T12 + 3
+0f4a : 85 5b __ STA T11 + 3
+0f4c : 85 06 __ STA $06
+0f4e : a9 00 __ LDA #$00
+0f50 : 85 1b __ STA ACCU + 0
+0f52 : 85 1c __ STA ACCU + 1
+0f54 : a9 20 __ LDA #$20
+0f56 : 85 1d __ STA ACCU + 2
+0f58 : a9 41 __ LDA #$41
+0f5a : 85 1e __ STA ACCU + 3
+0f5c : 20 4f 23 JSR $234f ; (fcmp + 0)
+0f5f : 30 36 __ BMI $0f97
+0f61 : a5 58 __ LDA T11 + 0
+0f63 : 85 1b __ STA ACCU + 0
+0f65 : a5 59 __ LDA T11 + 1
+0f67 : 85 1c __ STA ACCU + 1
+0f69 : a5 5a __ LDA T11 + 2
+0f6b : 85 1d __ STA ACCU + 2
+0f6d : a5 5b __ LDA T11 + 3
+0f6f : 85 1e __ STA ACCU + 3
+0f71 : a9 00 __ LDA #$00
+0f73 : 85 03 __ STA $03
+0f75 : 85 04 __ STA $04
+0f77 : a9 20 __ LDA #$20
+0f79 : 85 05 __ STA $05
+0f7b : a9 41 __ LDA #$41
+0f7d : 85 06 __ STA $06
+0f7f : 20 c5 1f JSR $1fc5 ; (freg + 20)
+0f82 : 20 5c 21 JSR $215c ; (fdiv + 0)
+0f85 : a5 1b __ LDA ACCU + 0
+0f87 : 85 5c __ STA T12 + 0
+0f89 : a5 1c __ LDA ACCU + 1
+0f8b : 85 5d __ STA T12 + 1
+0f8d : a5 1d __ LDA ACCU + 2
+0f8f : 85 5e __ STA T12 + 2
+0f91 : a5 1e __ LDA ACCU + 3
+0f93 : 85 5f __ STA T12 + 3
+0f95 : c6 4d __ DEC T5 + 0
+0f97 : 38 __ __ SEC
+0f98 : a5 53 __ LDA T8 + 0
+0f9a : e5 4d __ SBC T5 + 0
+0f9c : 85 55 __ STA T9 + 0
+0f9e : 85 43 __ STA T0 + 0
+0fa0 : a9 14 __ LDA #$14
+0fa2 : c5 53 __ CMP T8 + 0
+0fa4 : b0 02 __ BCS $0fa8
+0fa6 : 85 53 __ STA T8 + 0
+0fa8 : a5 55 __ LDA T9 + 0
+0faa : d0 08 __ BNE $0fb4
+0fac : a9 30 __ LDA #$30
+0fae : a4 47 __ LDY T2 + 0
+0fb0 : 91 4f __ STA (T6 + 0),y
+0fb2 : e6 47 __ INC T2 + 0
+0fb4 : a9 00 __ LDA #$00
+0fb6 : 85 4d __ STA T5 + 0
+0fb8 : a5 53 __ LDA T8 + 0
+0fba : f0 03 __ BEQ $0fbf
+0fbc : 4c ee 10 JMP $10ee ; (sprintf + 1635)
+0fbf : a5 60 __ LDA T13 + 0
+0fc1 : f0 03 __ BEQ $0fc6
+0fc3 : 4c 6e 10 JMP $106e ; (sprintf + 1507)
+0fc6 : a5 47 __ LDA T2 + 0
+0fc8 : cd e7 52 CMP $52e7 ; (sframe + 13)
+0fcb : 90 1c __ BCC $0fe9
+0fcd : 85 43 __ STA T0 + 0
+0fcf : 18 __ __ CLC
+0fd0 : a5 4b __ LDA T4 + 0
+0fd2 : 69 04 __ ADC #$04
+0fd4 : 85 4b __ STA T4 + 0
+0fd6 : 90 02 __ BCC $0fda
+0fd8 : e6 4c __ INC T4 + 1
+0fda : a0 00 __ LDY #$00
+0fdc : b1 45 __ LDA (T1 + 0),y
+0fde : 85 4d __ STA T5 + 0
+0fe0 : e6 45 __ INC T1 + 0
+0fe2 : d0 02 __ BNE $0fe6
+0fe4 : e6 46 __ INC T1 + 1
+0fe6 : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+0fe9 : c9 01 __ CMP #$01
+0feb : 90 4b __ BCC $1038
+0fed : a9 01 __ LDA #$01
+0fef : 85 43 __ STA T0 + 0
+0ff1 : a5 47 __ LDA T2 + 0
+0ff3 : 85 51 __ STA T7 + 0
+0ff5 : 38 __ __ SEC
+0ff6 : a5 51 __ LDA T7 + 0
+0ff8 : e5 43 __ SBC T0 + 0
+0ffa : 85 55 __ STA T9 + 0
+0ffc : a9 00 __ LDA #$00
+0ffe : e9 00 __ SBC #$00
+1000 : 85 56 __ STA T9 + 1
+1002 : 18 __ __ CLC
+1003 : a5 4f __ LDA T6 + 0
+1005 : 65 55 __ ADC T9 + 0
+1007 : 85 55 __ STA T9 + 0
+1009 : a5 50 __ LDA T6 + 1
+100b : 65 56 __ ADC T9 + 1
+100d : 85 56 __ STA T9 + 1
+100f : 38 __ __ SEC
+1010 : ad e7 52 LDA $52e7 ; (sframe + 13)
+1013 : e5 43 __ SBC T0 + 0
+1015 : 85 53 __ STA T8 + 0
+1017 : a9 00 __ LDA #$00
+1019 : e9 00 __ SBC #$00
+101b : 85 54 __ STA T8 + 1
+101d : 18 __ __ CLC
+101e : a5 4f __ LDA T6 + 0
+1020 : 65 53 __ ADC T8 + 0
+1022 : 85 53 __ STA T8 + 0
+1024 : a5 50 __ LDA T6 + 1
+1026 : 65 54 __ ADC T8 + 1
+1028 : 85 54 __ STA T8 + 1
+102a : a0 00 __ LDY #$00
+102c : b1 55 __ LDA (T9 + 0),y
+102e : 91 53 __ STA (T8 + 0),y
+1030 : e6 43 __ INC T0 + 0
+1032 : a5 47 __ LDA T2 + 0
+1034 : c5 43 __ CMP T0 + 0
+1036 : b0 bd __ BCS $0ff5
+1038 : a9 00 __ LDA #$00
+103a : 85 43 __ STA T0 + 0
+103c : a5 47 __ LDA T2 + 0
+103e : 85 51 __ STA T7 + 0
+1040 : ad e7 52 LDA $52e7 ; (sframe + 13)
+1043 : 85 47 __ STA T2 + 0
+1045 : 38 __ __ SEC
+1046 : a5 47 __ LDA T2 + 0
+1048 : e5 51 __ SBC T7 + 0
+104a : 85 55 __ STA T9 + 0
+104c : a9 00 __ LDA #$00
+104e : e9 00 __ SBC #$00
+1050 : 85 56 __ STA T9 + 1
+1052 : a9 00 __ LDA #$00
+1054 : c5 56 __ CMP T9 + 1
+1056 : d0 04 __ BNE $105c
+1058 : a5 43 __ LDA T0 + 0
+105a : c5 55 __ CMP T9 + 0
+105c : 90 05 __ BCC $1063
+105e : a5 47 __ LDA T2 + 0
+1060 : 4c cd 0f JMP $0fcd ; (sprintf + 1346)
+1063 : a9 20 __ LDA #$20
+1065 : a4 43 __ LDY T0 + 0
+1067 : 91 4f __ STA (T6 + 0),y
+1069 : e6 43 __ INC T0 + 0
+106b : 4c 40 10 JMP $1040 ; (sprintf + 1461)
+106e : a9 45 __ LDA #$45
+1070 : a4 47 __ LDY T2 + 0
+1072 : 91 4f __ STA (T6 + 0),y
+1074 : c8 __ __ INY
+1075 : a5 52 __ LDA T7 + 1
+1077 : 30 5a __ BMI $10d3
+1079 : a9 2b __ LDA #$2b
+107b : 91 4f __ STA (T6 + 0),y
+107d : 18 __ __ CLC
+107e : a5 47 __ LDA T2 + 0
+1080 : 69 02 __ ADC #$02
+1082 : 85 43 __ STA T0 + 0
+1084 : a5 51 __ LDA T7 + 0
+1086 : 85 1b __ STA ACCU + 0
+1088 : a5 52 __ LDA T7 + 1
+108a : 85 1c __ STA ACCU + 1
+108c : a9 0a __ LDA #$0a
+108e : 85 03 __ STA $03
+1090 : a9 00 __ LDA #$00
+1092 : 85 04 __ STA $04
+1094 : 20 da 21 JSR $21da ; (divs16 + 0)
+1097 : 18 __ __ CLC
+1098 : a5 1b __ LDA ACCU + 0
+109a : 69 30 __ ADC #$30
+109c : a4 43 __ LDY T0 + 0
+109e : 91 4f __ STA (T6 + 0),y
+10a0 : c8 __ __ INY
+10a1 : 98 __ __ TYA
+10a2 : 18 __ __ CLC
+10a3 : 65 4f __ ADC T6 + 0
+10a5 : 85 53 __ STA T8 + 0
+10a7 : a5 50 __ LDA T6 + 1
+10a9 : 69 00 __ ADC #$00
+10ab : 85 54 __ STA T8 + 1
+10ad : a5 51 __ LDA T7 + 0
+10af : 85 1b __ STA ACCU + 0
+10b1 : a5 52 __ LDA T7 + 1
+10b3 : 85 1c __ STA ACCU + 1
+10b5 : a9 0a __ LDA #$0a
+10b7 : 85 03 __ STA $03
+10b9 : a9 00 __ LDA #$00
+10bb : 85 04 __ STA $04
+10bd : 20 99 22 JSR $2299 ; (mods16 + 0)
+10c0 : 18 __ __ CLC
+10c1 : a5 05 __ LDA $05
+10c3 : 69 30 __ ADC #$30
+10c5 : a0 00 __ LDY #$00
+10c7 : 91 53 __ STA (T8 + 0),y
+10c9 : 18 __ __ CLC
+10ca : a5 43 __ LDA T0 + 0
+10cc : 69 02 __ ADC #$02
+10ce : 85 47 __ STA T2 + 0
+10d0 : 4c c6 0f JMP $0fc6 ; (sprintf + 1339)
+10d3 : a9 2d __ LDA #$2d
+10d5 : 91 4f __ STA (T6 + 0),y
+10d7 : 18 __ __ CLC
+10d8 : a5 47 __ LDA T2 + 0
+10da : 69 02 __ ADC #$02
+10dc : 85 43 __ STA T0 + 0
+10de : 38 __ __ SEC
+10df : a9 00 __ LDA #$00
+10e1 : e5 51 __ SBC T7 + 0
+10e3 : 85 51 __ STA T7 + 0
+10e5 : a9 00 __ LDA #$00
+10e7 : e5 52 __ SBC T7 + 1
+10e9 : 85 52 __ STA T7 + 1
+10eb : 4c 84 10 JMP $1084 ; (sprintf + 1529)
+10ee : a5 4d __ LDA T5 + 0
+10f0 : c5 43 __ CMP T0 + 0
+10f2 : d0 08 __ BNE $10fc
+10f4 : a9 2e __ LDA #$2e
+10f6 : a4 47 __ LDY T2 + 0
+10f8 : 91 4f __ STA (T6 + 0),y
+10fa : e6 47 __ INC T2 + 0
+10fc : a5 5c __ LDA T12 + 0
+10fe : 85 1b __ STA ACCU + 0
+1100 : a5 5d __ LDA T12 + 1
+1102 : 85 1c __ STA ACCU + 1
+1104 : a5 5e __ LDA T12 + 2
+1106 : 85 1d __ STA ACCU + 2
+1108 : a5 5f __ LDA T12 + 3
+110a : 85 1e __ STA ACCU + 3
+110c : 20 c2 22 JSR $22c2 ; (f32_to_i16 + 0)
+110f : 18 __ __ CLC
+1110 : a5 1b __ LDA ACCU + 0
+1112 : 69 30 __ ADC #$30
+1114 : a4 47 __ LDY T2 + 0
+1116 : 91 4f __ STA (T6 + 0),y
+1118 : 20 04 23 JSR $2304 ; (sint16_to_float + 0)
+111b : a5 1b __ LDA ACCU + 0
+111d : 85 03 __ STA $03
+111f : a5 1c __ LDA ACCU + 1
+1121 : 85 04 __ STA $04
+1123 : a5 1d __ LDA ACCU + 2
+1125 : 85 05 __ STA $05
+1127 : a5 1e __ LDA ACCU + 3
+1129 : 85 06 __ STA $06
+112b : a5 5c __ LDA T12 + 0
+112d : 85 1b __ STA ACCU + 0
+112f : a5 5d __ LDA T12 + 1
+1131 : 85 1c __ STA ACCU + 1
+1133 : a5 5e __ LDA T12 + 2
+1135 : 85 1d __ STA ACCU + 2
+1137 : a5 5f __ LDA T12 + 3
+1139 : 85 1e __ STA ACCU + 3
+113b : 20 c5 1f JSR $1fc5 ; (freg + 20)
+113e : a5 06 __ LDA $06
+1140 : 49 80 __ EOR #$80
+1142 : 85 06 __ STA $06
+1144 : 20 f6 1f JSR $1ff6 ; (faddsub + 0)
+1147 : a9 00 __ LDA #$00
+1149 : 85 03 __ STA $03
+114b : 85 04 __ STA $04
+114d : a9 20 __ LDA #$20
+114f : 85 05 __ STA $05
+1151 : a9 41 __ LDA #$41
+1153 : 85 06 __ STA $06
+1155 : 20 c5 1f JSR $1fc5 ; (freg + 20)
+1158 : 20 be 20 JSR $20be ; (fmul + 0)
+115b : a5 1b __ LDA ACCU + 0
+115d : 85 5c __ STA T12 + 0
+115f : a5 1c __ LDA ACCU + 1
+1161 : 85 5d __ STA T12 + 1
+1163 : a5 1d __ LDA ACCU + 2
+1165 : 85 5e __ STA T12 + 2
+1167 : a5 1e __ LDA ACCU + 3
+1169 : 85 5f __ STA T12 + 3
+116b : e6 47 __ INC T2 + 0
+116d : e6 4d __ INC T5 + 0
+116f : a5 4d __ LDA T5 + 0
+1171 : c5 53 __ CMP T8 + 0
+1173 : b0 03 __ BCS $1178
+1175 : 4c ee 10 JMP $10ee ; (sprintf + 1635)
+1178 : 4c bf 0f JMP $0fbf ; (sprintf + 1332)
+117b : 85 43 __ STA T0 + 0
+117d : a5 5c __ LDA T12 + 0
+117f : 85 1b __ STA ACCU + 0
+1181 : a5 5d __ LDA T12 + 1
+1183 : 85 1c __ STA ACCU + 1
+1185 : a5 5e __ LDA T12 + 2
+1187 : 85 1d __ STA ACCU + 2
+1189 : a5 5f __ LDA T12 + 3
+118b : 85 1e __ STA ACCU + 3
+118d : a9 00 __ LDA #$00
+118f : 85 03 __ STA $03
+1191 : 85 04 __ STA $04
+1193 : a9 20 __ LDA #$20
+1195 : 85 05 __ STA $05
+1197 : a9 41 __ LDA #$41
+1199 : 85 06 __ STA $06
+119b : 20 c5 1f JSR $1fc5 ; (freg + 20)
+119e : 20 5c 21 JSR $215c ; (fdiv + 0)
+11a1 : a5 1b __ LDA ACCU + 0
+11a3 : 85 5c __ STA T12 + 0
+11a5 : a5 1c __ LDA ACCU + 1
+11a7 : 85 5d __ STA T12 + 1
+11a9 : a5 1d __ LDA ACCU + 2
+11ab : 85 5e __ STA T12 + 2
+11ad : a5 1e __ LDA ACCU + 3
+11af : 85 5f __ STA T12 + 3
+11b1 : e6 43 __ INC T0 + 0
+11b3 : a5 43 __ LDA T0 + 0
+11b5 : c5 53 __ CMP T8 + 0
+11b7 : 90 c4 __ BCC $117d
+11b9 : 4c 08 0f JMP $0f08 ; (sprintf + 1149)
+11bc : a5 58 __ LDA T11 + 0
+11be : 85 1b __ STA ACCU + 0
+11c0 : a5 59 __ LDA T11 + 1
+11c2 : 85 1c __ STA ACCU + 1
+11c4 : a5 5a __ LDA T11 + 2
+11c6 : 85 1d __ STA ACCU + 2
+11c8 : a5 5b __ LDA T11 + 3
+11ca : 85 1e __ STA ACCU + 3
+11cc : a9 00 __ LDA #$00
+11ce : 85 03 __ STA $03
+11d0 : 85 04 __ STA $04
+11d2 : a9 20 __ LDA #$20
+11d4 : 85 05 __ STA $05
+11d6 : a9 41 __ LDA #$41
+11d8 : 85 06 __ STA $06
+11da : 20 c5 1f JSR $1fc5 ; (freg + 20)
+11dd : 20 5c 21 JSR $215c ; (fdiv + 0)
+11e0 : a5 1b __ LDA ACCU + 0
+11e2 : 85 58 __ STA T11 + 0
+11e4 : a5 1c __ LDA ACCU + 1
+11e6 : 85 59 __ STA T11 + 1
+11e8 : a5 1d __ LDA ACCU + 2
+11ea : 85 5a __ STA T11 + 2
+11ec : a5 1e __ LDA ACCU + 3
+11ee : 85 5b __ STA T11 + 3
+11f0 : e6 51 __ INC T7 + 0
+11f2 : d0 02 __ BNE $11f6
+11f4 : e6 52 __ INC T7 + 1
+11f6 : a5 52 __ LDA T7 + 1
+11f8 : 30 c2 __ BMI $11bc
+11fa : 4c ea 0e JMP $0eea ; (sprintf + 1119)
+11fd : a9 00 __ LDA #$00
+11ff : 85 5c __ STA T12 + 0
+1201 : 85 5d __ STA T12 + 1
+1203 : 85 5e __ STA T12 + 2
+1205 : a9 3f __ LDA #$3f
+1207 : 85 5f __ STA T12 + 3
+1209 : a5 4d __ LDA T5 + 0
+120b : f0 03 __ BEQ $1210
+120d : 4c ac 12 JMP $12ac ; (sprintf + 2081)
+1210 : a5 58 __ LDA T11 + 0
+1212 : 85 1b __ STA ACCU + 0
+1214 : a5 59 __ LDA T11 + 1
+1216 : 85 1c __ STA ACCU + 1
+1218 : a5 5a __ LDA T11 + 2
+121a : 85 1d __ STA ACCU + 2
+121c : a5 5b __ LDA T11 + 3
+121e : 85 1e __ STA ACCU + 3
+1220 : a5 5c __ LDA T12 + 0
+1222 : 85 03 __ STA $03
+1224 : a5 5d __ LDA T12 + 1
+1226 : 85 04 __ STA $04
+1228 : a5 5e __ LDA T12 + 2
+122a : 85 05 __ STA $05
+122c : a5 5f __ LDA T12 + 3
+122e : 85 06 __ STA $06
+1230 : 20 c5 1f JSR $1fc5 ; (freg + 20)
+1233 : 20 f6 1f JSR $1ff6 ; (faddsub + 0)
+1236 : a5 1b __ LDA ACCU + 0
+1238 : 85 5c __ STA T12 + 0
+123a : 85 58 __ STA T11 + 0
+123c : 85 03 __ STA $03
+123e : a5 1c __ LDA ACCU + 1
+1240 : 85 5d __ STA T12 + 1
+1242 : 85 59 __ STA T11 + 1
+1244 : 85 04 __ STA $04
+1246 : a5 1d __ LDA ACCU + 2
+1248 : 85 5e __ STA T12 + 2
+124a : 85 5a __ STA T11 + 2
+124c : 85 05 __ STA $05
+124e : a5 1e __ LDA ACCU + 3
+1250 : 85 5f __ STA T12 + 3
+1252 : 85 5b __ STA T11 + 3
+1254 : 85 06 __ STA $06
+1256 : a9 00 __ LDA #$00
+1258 : 85 1b __ STA ACCU + 0
+125a : 85 1c __ STA ACCU + 1
+125c : a9 20 __ LDA #$20
+125e : 85 1d __ STA ACCU + 2
+1260 : a9 41 __ LDA #$41
+1262 : 85 1e __ STA ACCU + 3
+1264 : 20 4f 23 JSR $234f ; (fcmp + 0)
+1267 : 10 03 __ BPL $126c
+1269 : 4c 97 0f JMP $0f97 ; (sprintf + 1292)
+126c : a5 58 __ LDA T11 + 0
+126e : 85 1b __ STA ACCU + 0
+1270 : a5 59 __ LDA T11 + 1
+1272 : 85 1c __ STA ACCU + 1
+1274 : a5 5a __ LDA T11 + 2
+1276 : 85 1d __ STA ACCU + 2
+1278 : a5 5b __ LDA T11 + 3
+127a : 85 1e __ STA ACCU + 3
+127c : a9 00 __ LDA #$00
+127e : 85 03 __ STA $03
+1280 : 85 04 __ STA $04
+1282 : a9 20 __ LDA #$20
+1284 : 85 05 __ STA $05
+1286 : a9 41 __ LDA #$41
+1288 : 85 06 __ STA $06
+128a : 20 c5 1f JSR $1fc5 ; (freg + 20)
+128d : 20 5c 21 JSR $215c ; (fdiv + 0)
+1290 : a5 1b __ LDA ACCU + 0
+1292 : 85 5c __ STA T12 + 0
+1294 : a5 1c __ LDA ACCU + 1
+1296 : 85 5d __ STA T12 + 1
+1298 : a5 1d __ LDA ACCU + 2
+129a : 85 5e __ STA T12 + 2
+129c : a5 1e __ LDA ACCU + 3
+129e : 85 5f __ STA T12 + 3
+12a0 : e6 51 __ INC T7 + 0
+12a2 : f0 03 __ BEQ $12a7
+12a4 : 4c 97 0f JMP $0f97 ; (sprintf + 1292)
+12a7 : e6 52 __ INC T7 + 1
+12a9 : 4c 97 0f JMP $0f97 ; (sprintf + 1292)
+12ac : a9 00 __ LDA #$00
+12ae : 85 43 __ STA T0 + 0
+12b0 : a5 5c __ LDA T12 + 0
+12b2 : 85 1b __ STA ACCU + 0
+12b4 : a5 5d __ LDA T12 + 1
+12b6 : 85 1c __ STA ACCU + 1
+12b8 : a5 5e __ LDA T12 + 2
+12ba : 85 1d __ STA ACCU + 2
+12bc : a5 5f __ LDA T12 + 3
+12be : 85 1e __ STA ACCU + 3
+12c0 : a9 00 __ LDA #$00
+12c2 : 85 03 __ STA $03
+12c4 : 85 04 __ STA $04
+12c6 : a9 20 __ LDA #$20
+12c8 : 85 05 __ STA $05
+12ca : a9 41 __ LDA #$41
+12cc : 85 06 __ STA $06
+12ce : 20 c5 1f JSR $1fc5 ; (freg + 20)
+12d1 : 20 5c 21 JSR $215c ; (fdiv + 0)
+12d4 : a5 1b __ LDA ACCU + 0
+12d6 : 85 5c __ STA T12 + 0
+12d8 : a5 1c __ LDA ACCU + 1
+12da : 85 5d __ STA T12 + 1
+12dc : a5 1d __ LDA ACCU + 2
+12de : 85 5e __ STA T12 + 2
+12e0 : a5 1e __ LDA ACCU + 3
+12e2 : 85 5f __ STA T12 + 3
+12e4 : e6 43 __ INC T0 + 0
+12e6 : a5 43 __ LDA T0 + 0
+12e8 : c5 4d __ CMP T5 + 0
+12ea : 90 c4 __ BCC $12b0
+12ec : 4c 10 12 JMP $1210 ; (sprintf + 1925)
+12ef : a5 52 __ LDA T7 + 1
+12f1 : 10 0e __ BPL $1301
+12f3 : a5 52 __ LDA T7 + 1
+12f5 : 30 03 __ BMI $12fa
+12f7 : 4c dc 0e JMP $0edc ; (sprintf + 1105)
+12fa : a9 01 __ LDA #$01
+12fc : 85 60 __ STA T13 + 0
+12fe : 4c fd 11 JMP $11fd ; (sprintf + 1906)
+1301 : d0 f7 __ BNE $12fa
+1303 : a9 03 __ LDA #$03
+1305 : c5 51 __ CMP T7 + 0
+1307 : 90 f1 __ BCC $12fa
+1309 : 4c f3 12 JMP $12f3 ; (sprintf + 2152)
+130c : a9 01 __ LDA #$01
+130e : 4c c9 0e JMP $0ec9 ; (sprintf + 1086)
+1311 : a9 2d __ LDA #$2d
+1313 : a0 00 __ LDY #$00
+1315 : 91 49 __ STA (T3 + 0),y
+1317 : a9 01 __ LDA #$01
+1319 : 85 47 __ STA T2 + 0
+131b : a5 5b __ LDA T11 + 3
+131d : 49 80 __ EOR #$80
+131f : 85 5b __ STA T11 + 3
+1321 : 4c 15 0d JMP $0d15 ; (sprintf + 650)
+1324 : a0 00 __ LDY #$00
+1326 : b1 4b __ LDA (T4 + 0),y
+1328 : 85 58 __ STA T11 + 0
+132a : c8 __ __ INY
+132b : b1 4b __ LDA (T4 + 0),y
+132d : 85 59 __ STA T11 + 1
+132f : c8 __ __ INY
+1330 : b1 4b __ LDA (T4 + 0),y
+1332 : 85 5a __ STA T11 + 2
+1334 : c8 __ __ INY
+1335 : b1 4b __ LDA (T4 + 0),y
+1337 : 85 5b __ STA T11 + 3
+1339 : 18 __ __ CLC
+133a : a5 4b __ LDA T4 + 0
+133c : 69 04 __ ADC #$04
+133e : 85 4b __ STA T4 + 0
+1340 : 90 02 __ BCC $1344
+1342 : e6 4c __ INC T4 + 1
+1344 : a0 00 __ LDY #$00
+1346 : b1 45 __ LDA (T1 + 0),y
+1348 : aa __ __ TAX
+1349 : e6 45 __ INC T1 + 0
+134b : d0 02 __ BNE $134f
+134d : e6 46 __ INC T1 + 1
+134f : 8a __ __ TXA
+1350 : e0 64 __ CPX #$64
+1352 : d0 03 __ BNE $1357
+1354 : 4c 4c 16 JMP $164c ; (sprintf + 3009)
+1357 : c9 75 __ CMP #$75
+1359 : d0 03 __ BNE $135e
+135b : 4c e4 14 JMP $14e4 ; (sprintf + 2649)
+135e : c9 78 __ CMP #$78
+1360 : f0 03 __ BEQ $1365
+1362 : 4c 2d 0b JMP $0b2d ; (sprintf + 162)
+1365 : a9 10 __ LDA #$10
+1367 : 8d e9 52 STA $52e9 ; (sframe + 15)
+136a : a9 00 __ LDA #$00
+136c : 8d ea 52 STA $52ea ; (sframe + 16)
+136f : a5 49 __ LDA T3 + 0
+1371 : 85 4f __ STA T6 + 0
+1373 : a5 4a __ LDA T3 + 1
+1375 : 85 50 __ STA T6 + 1
+1377 : a9 10 __ LDA #$10
+1379 : 85 43 __ STA T0 + 0
+137b : a9 00 __ LDA #$00
+137d : c5 5b __ CMP T11 + 3
+137f : d0 0a __ BNE $138b
+1381 : c5 5a __ CMP T11 + 2
+1383 : d0 06 __ BNE $138b
+1385 : c5 59 __ CMP T11 + 1
+1387 : d0 02 __ BNE $138b
+1389 : c5 58 __ CMP T11 + 0
+138b : b0 03 __ BCS $1390
+138d : 4c 5a 14 JMP $145a ; (sprintf + 2511)
+1390 : ad e8 52 LDA $52e8 ; (sframe + 14)
+1393 : c9 ff __ CMP #$ff
+1395 : d0 03 __ BNE $139a
+1397 : 4c 4c 14 JMP $144c ; (sprintf + 2497)
+139a : 38 __ __ SEC
+139b : a9 10 __ LDA #$10
+139d : ed e8 52 SBC $52e8 ; (sframe + 14)
+13a0 : 85 47 __ STA T2 + 0
+13a2 : c5 43 __ CMP T0 + 0
+13a4 : b0 0e __ BCS $13b4
+13a6 : c6 43 __ DEC T0 + 0
+13a8 : a9 30 __ LDA #$30
+13aa : a4 43 __ LDY T0 + 0
+13ac : 91 4f __ STA (T6 + 0),y
+13ae : a5 47 __ LDA T2 + 0
+13b0 : c5 43 __ CMP T0 + 0
+13b2 : 90 f2 __ BCC $13a6
+13b4 : ad ed 52 LDA $52ed ; (sframe + 19)
+13b7 : f0 33 __ BEQ $13ec
+13b9 : ad e9 52 LDA $52e9 ; (sframe + 15)
+13bc : 85 51 __ STA T7 + 0
+13be : ad ea 52 LDA $52ea ; (sframe + 16)
+13c1 : d0 29 __ BNE $13ec
+13c3 : a5 51 __ LDA T7 + 0
+13c5 : c9 10 __ CMP #$10
+13c7 : d0 23 __ BNE $13ec
+13c9 : 18 __ __ CLC
+13ca : a5 43 __ LDA T0 + 0
+13cc : 69 ff __ ADC #$ff
+13ce : 18 __ __ CLC
+13cf : 65 4f __ ADC T6 + 0
+13d1 : 85 51 __ STA T7 + 0
+13d3 : a5 50 __ LDA T6 + 1
+13d5 : 69 00 __ ADC #$00
+13d7 : 85 52 __ STA T7 + 1
+13d9 : a9 58 __ LDA #$58
+13db : a0 00 __ LDY #$00
+13dd : 91 51 __ STA (T7 + 0),y
+13df : 18 __ __ CLC
+13e0 : a5 43 __ LDA T0 + 0
+13e2 : 69 fe __ ADC #$fe
+13e4 : 85 43 __ STA T0 + 0
+13e6 : a9 30 __ LDA #$30
+13e8 : a4 43 __ LDY T0 + 0
+13ea : 91 4f __ STA (T6 + 0),y
+13ec : ad eb 52 LDA $52eb ; (sframe + 17)
+13ef : f0 08 __ BEQ $13f9
+13f1 : c6 43 __ DEC T0 + 0
+13f3 : a9 2b __ LDA #$2b
+13f5 : a4 43 __ LDY T0 + 0
+13f7 : 91 4f __ STA (T6 + 0),y
+13f9 : 38 __ __ SEC
+13fa : a9 10 __ LDA #$10
+13fc : ed e7 52 SBC $52e7 ; (sframe + 13)
+13ff : 85 51 __ STA T7 + 0
+1401 : a9 00 __ LDA #$00
+1403 : e9 00 __ SBC #$00
+1405 : 49 80 __ EOR #$80
+1407 : c9 80 __ CMP #$80
+1409 : d0 04 __ BNE $140f
+140b : a5 51 __ LDA T7 + 0
+140d : c5 43 __ CMP T0 + 0
+140f : 90 2f __ BCC $1440
+1411 : a9 00 __ LDA #$00
+1413 : 85 47 __ STA T2 + 0
+1415 : a5 43 __ LDA T0 + 0
+1417 : c9 10 __ CMP #$10
+1419 : b0 12 __ BCS $142d
+141b : a4 43 __ LDY T0 + 0
+141d : b1 4f __ LDA (T6 + 0),y
+141f : a4 47 __ LDY T2 + 0
+1421 : 91 4f __ STA (T6 + 0),y
+1423 : e6 47 __ INC T2 + 0
+1425 : e6 43 __ INC T0 + 0
+1427 : a5 43 __ LDA T0 + 0
+1429 : c9 10 __ CMP #$10
+142b : 90 ee __ BCC $141b
+142d : a0 00 __ LDY #$00
+142f : b1 45 __ LDA (T1 + 0),y
+1431 : 85 4d __ STA T5 + 0
+1433 : e6 45 __ INC T1 + 0
+1435 : d0 02 __ BNE $1439
+1437 : e6 46 __ INC T1 + 1
+1439 : a5 47 __ LDA T2 + 0
+143b : 85 43 __ STA T0 + 0
+143d : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+1440 : c6 43 __ DEC T0 + 0
+1442 : ad e6 52 LDA $52e6 ; (sframe + 12)
+1445 : a4 43 __ LDY T0 + 0
+1447 : 91 4f __ STA (T6 + 0),y
+1449 : 4c f9 13 JMP $13f9 ; (sprintf + 2414)
+144c : a9 0f __ LDA #$0f
+144e : 85 47 __ STA T2 + 0
+1450 : c5 43 __ CMP T0 + 0
+1452 : b0 03 __ BCS $1457
+1454 : 4c a6 13 JMP $13a6 ; (sprintf + 2331)
+1457 : 4c b4 13 JMP $13b4 ; (sprintf + 2345)
+145a : ad e9 52 LDA $52e9 ; (sframe + 15)
+145d : 85 03 __ STA $03
+145f : ad ea 52 LDA $52ea ; (sframe + 16)
+1462 : 85 04 __ STA $04
+1464 : a5 58 __ LDA T11 + 0
+1466 : 85 1b __ STA ACCU + 0
+1468 : a5 59 __ LDA T11 + 1
+146a : 85 1c __ STA ACCU + 1
+146c : a5 5a __ LDA T11 + 2
+146e : 85 1d __ STA ACCU + 2
+1470 : a5 5b __ LDA T11 + 3
+1472 : 85 1e __ STA ACCU + 3
+1474 : a9 00 __ LDA #$00
+1476 : 85 05 __ STA $05
+1478 : 85 06 __ STA $06
+147a : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+147d : a5 08 __ LDA $08
+147f : 10 53 __ BPL $14d4
+1481 : 18 __ __ CLC
+1482 : a5 07 __ LDA $07
+1484 : 69 30 __ ADC #$30
+1486 : c6 43 __ DEC T0 + 0
+1488 : a4 43 __ LDY T0 + 0
+148a : 91 4f __ STA (T6 + 0),y
+148c : ad e9 52 LDA $52e9 ; (sframe + 15)
+148f : 85 03 __ STA $03
+1491 : ad ea 52 LDA $52ea ; (sframe + 16)
+1494 : 85 04 __ STA $04
+1496 : a5 58 __ LDA T11 + 0
+1498 : 85 1b __ STA ACCU + 0
+149a : a5 59 __ LDA T11 + 1
+149c : 85 1c __ STA ACCU + 1
+149e : a5 5a __ LDA T11 + 2
+14a0 : 85 1d __ STA ACCU + 2
+14a2 : a5 5b __ LDA T11 + 3
+14a4 : 85 1e __ STA ACCU + 3
+14a6 : a9 00 __ LDA #$00
+14a8 : 85 05 __ STA $05
+14aa : 85 06 __ STA $06
+14ac : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+14af : a5 1b __ LDA ACCU + 0
+14b1 : 85 58 __ STA T11 + 0
+14b3 : a5 1c __ LDA ACCU + 1
+14b5 : 85 59 __ STA T11 + 1
+14b7 : a5 1d __ LDA ACCU + 2
+14b9 : 85 5a __ STA T11 + 2
+14bb : a5 1e __ LDA ACCU + 3
+14bd : 85 5b __ STA T11 + 3
+14bf : a9 00 __ LDA #$00
+14c1 : c5 1e __ CMP ACCU + 3
+14c3 : d0 0a __ BNE $14cf
+14c5 : c5 1d __ CMP ACCU + 2
+14c7 : d0 06 __ BNE $14cf
+14c9 : c5 1c __ CMP ACCU + 1
+14cb : d0 02 __ BNE $14cf
+14cd : c5 1b __ CMP ACCU + 0
+14cf : 90 89 __ BCC $145a
+14d1 : 4c 90 13 JMP $1390 ; (sprintf + 2309)
+14d4 : d0 06 __ BNE $14dc
+14d6 : a5 07 __ LDA $07
+14d8 : c9 0a __ CMP #$0a
+14da : 90 a5 __ BCC $1481
+14dc : 18 __ __ CLC
+14dd : a5 07 __ LDA $07
+14df : 69 37 __ ADC #$37
+14e1 : 4c 86 14 JMP $1486 ; (sprintf + 2555)
+14e4 : a5 49 __ LDA T3 + 0
+14e6 : 85 4f __ STA T6 + 0
+14e8 : a5 4a __ LDA T3 + 1
+14ea : 85 50 __ STA T6 + 1
+14ec : a9 10 __ LDA #$10
+14ee : 85 43 __ STA T0 + 0
+14f0 : a9 00 __ LDA #$00
+14f2 : c5 5b __ CMP T11 + 3
+14f4 : d0 0a __ BNE $1500
+14f6 : c5 5a __ CMP T11 + 2
+14f8 : d0 06 __ BNE $1500
+14fa : c5 59 __ CMP T11 + 1
+14fc : d0 02 __ BNE $1500
+14fe : c5 58 __ CMP T11 + 0
+1500 : b0 03 __ BCS $1505
+1502 : 4c c2 15 JMP $15c2 ; (sprintf + 2871)
+1505 : ad e8 52 LDA $52e8 ; (sframe + 14)
+1508 : c9 ff __ CMP #$ff
+150a : d0 03 __ BNE $150f
+150c : 4c b4 15 JMP $15b4 ; (sprintf + 2857)
+150f : 38 __ __ SEC
+1510 : a9 10 __ LDA #$10
+1512 : ed e8 52 SBC $52e8 ; (sframe + 14)
+1515 : 85 47 __ STA T2 + 0
+1517 : c5 43 __ CMP T0 + 0
+1519 : b0 0e __ BCS $1529
+151b : c6 43 __ DEC T0 + 0
+151d : a9 30 __ LDA #$30
+151f : a4 43 __ LDY T0 + 0
+1521 : 91 4f __ STA (T6 + 0),y
+1523 : a5 47 __ LDA T2 + 0
+1525 : c5 43 __ CMP T0 + 0
+1527 : 90 f2 __ BCC $151b
+1529 : ad ed 52 LDA $52ed ; (sframe + 19)
+152c : f0 33 __ BEQ $1561
+152e : ad e9 52 LDA $52e9 ; (sframe + 15)
+1531 : 85 51 __ STA T7 + 0
+1533 : ad ea 52 LDA $52ea ; (sframe + 16)
+1536 : d0 29 __ BNE $1561
+1538 : a5 51 __ LDA T7 + 0
+153a : c9 10 __ CMP #$10
+153c : d0 23 __ BNE $1561
+153e : 18 __ __ CLC
+153f : a5 43 __ LDA T0 + 0
+1541 : 69 ff __ ADC #$ff
+1543 : 18 __ __ CLC
+1544 : 65 4f __ ADC T6 + 0
+1546 : 85 51 __ STA T7 + 0
+1548 : a5 50 __ LDA T6 + 1
+154a : 69 00 __ ADC #$00
+154c : 85 52 __ STA T7 + 1
+154e : a9 58 __ LDA #$58
+1550 : a0 00 __ LDY #$00
+1552 : 91 51 __ STA (T7 + 0),y
+1554 : 18 __ __ CLC
+1555 : a5 43 __ LDA T0 + 0
+1557 : 69 fe __ ADC #$fe
+1559 : 85 43 __ STA T0 + 0
+155b : a9 30 __ LDA #$30
+155d : a4 43 __ LDY T0 + 0
+155f : 91 4f __ STA (T6 + 0),y
+1561 : ad eb 52 LDA $52eb ; (sframe + 17)
+1564 : f0 08 __ BEQ $156e
+1566 : c6 43 __ DEC T0 + 0
+1568 : a9 2b __ LDA #$2b
+156a : a4 43 __ LDY T0 + 0
+156c : 91 4f __ STA (T6 + 0),y
+156e : 38 __ __ SEC
+156f : a9 10 __ LDA #$10
+1571 : ed e7 52 SBC $52e7 ; (sframe + 13)
+1574 : 85 51 __ STA T7 + 0
+1576 : a9 00 __ LDA #$00
+1578 : e9 00 __ SBC #$00
+157a : 49 80 __ EOR #$80
+157c : c9 80 __ CMP #$80
+157e : d0 04 __ BNE $1584
+1580 : a5 51 __ LDA T7 + 0
+1582 : c5 43 __ CMP T0 + 0
+1584 : 90 22 __ BCC $15a8
+1586 : a9 00 __ LDA #$00
+1588 : 85 47 __ STA T2 + 0
+158a : a5 43 __ LDA T0 + 0
+158c : c9 10 __ CMP #$10
+158e : 90 03 __ BCC $1593
+1590 : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+1593 : a4 43 __ LDY T0 + 0
+1595 : b1 4f __ LDA (T6 + 0),y
+1597 : a4 47 __ LDY T2 + 0
+1599 : 91 4f __ STA (T6 + 0),y
+159b : e6 47 __ INC T2 + 0
+159d : e6 43 __ INC T0 + 0
+159f : a5 43 __ LDA T0 + 0
+15a1 : c9 10 __ CMP #$10
+15a3 : 90 ee __ BCC $1593
+15a5 : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+15a8 : c6 43 __ DEC T0 + 0
+15aa : ad e6 52 LDA $52e6 ; (sframe + 12)
+15ad : a4 43 __ LDY T0 + 0
+15af : 91 4f __ STA (T6 + 0),y
+15b1 : 4c 6e 15 JMP $156e ; (sprintf + 2787)
+15b4 : a9 0f __ LDA #$0f
+15b6 : 85 47 __ STA T2 + 0
+15b8 : c5 43 __ CMP T0 + 0
+15ba : b0 03 __ BCS $15bf
+15bc : 4c 1b 15 JMP $151b ; (sprintf + 2704)
+15bf : 4c 29 15 JMP $1529 ; (sprintf + 2718)
+15c2 : ad e9 52 LDA $52e9 ; (sframe + 15)
+15c5 : 85 03 __ STA $03
+15c7 : ad ea 52 LDA $52ea ; (sframe + 16)
+15ca : 85 04 __ STA $04
+15cc : a5 58 __ LDA T11 + 0
+15ce : 85 1b __ STA ACCU + 0
+15d0 : a5 59 __ LDA T11 + 1
+15d2 : 85 1c __ STA ACCU + 1
+15d4 : a5 5a __ LDA T11 + 2
+15d6 : 85 1d __ STA ACCU + 2
+15d8 : a5 5b __ LDA T11 + 3
+15da : 85 1e __ STA ACCU + 3
+15dc : a9 00 __ LDA #$00
+15de : 85 05 __ STA $05
+15e0 : 85 06 __ STA $06
+15e2 : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+15e5 : a5 08 __ LDA $08
+15e7 : 10 53 __ BPL $163c
+15e9 : 18 __ __ CLC
+15ea : a5 07 __ LDA $07
+15ec : 69 30 __ ADC #$30
+15ee : c6 43 __ DEC T0 + 0
+15f0 : a4 43 __ LDY T0 + 0
+15f2 : 91 4f __ STA (T6 + 0),y
+15f4 : ad e9 52 LDA $52e9 ; (sframe + 15)
+15f7 : 85 03 __ STA $03
+15f9 : ad ea 52 LDA $52ea ; (sframe + 16)
+15fc : 85 04 __ STA $04
+15fe : a5 58 __ LDA T11 + 0
+1600 : 85 1b __ STA ACCU + 0
+1602 : a5 59 __ LDA T11 + 1
+1604 : 85 1c __ STA ACCU + 1
+1606 : a5 5a __ LDA T11 + 2
+1608 : 85 1d __ STA ACCU + 2
+160a : a5 5b __ LDA T11 + 3
+160c : 85 1e __ STA ACCU + 3
+160e : a9 00 __ LDA #$00
+1610 : 85 05 __ STA $05
+1612 : 85 06 __ STA $06
+1614 : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+1617 : a5 1b __ LDA ACCU + 0
+1619 : 85 58 __ STA T11 + 0
+161b : a5 1c __ LDA ACCU + 1
+161d : 85 59 __ STA T11 + 1
+161f : a5 1d __ LDA ACCU + 2
+1621 : 85 5a __ STA T11 + 2
+1623 : a5 1e __ LDA ACCU + 3
+1625 : 85 5b __ STA T11 + 3
+1627 : a9 00 __ LDA #$00
+1629 : c5 1e __ CMP ACCU + 3
+162b : d0 0a __ BNE $1637
+162d : c5 1d __ CMP ACCU + 2
+162f : d0 06 __ BNE $1637
+1631 : c5 1c __ CMP ACCU + 1
+1633 : d0 02 __ BNE $1637
+1635 : c5 1b __ CMP ACCU + 0
+1637 : 90 89 __ BCC $15c2
+1639 : 4c 05 15 JMP $1505 ; (sprintf + 2682)
+163c : d0 06 __ BNE $1644
+163e : a5 07 __ LDA $07
+1640 : c9 0a __ CMP #$0a
+1642 : 90 a5 __ BCC $15e9
+1644 : 18 __ __ CLC
+1645 : a5 07 __ LDA $07
+1647 : 69 37 __ ADC #$37
+1649 : 4c ee 15 JMP $15ee ; (sprintf + 2915)
+164c : a5 49 __ LDA T3 + 0
+164e : 85 4f __ STA T6 + 0
+1650 : a5 4a __ LDA T3 + 1
+1652 : 85 50 __ STA T6 + 1
+1654 : a5 5b __ LDA T11 + 3
+1656 : 49 80 __ EOR #$80
+1658 : c9 80 __ CMP #$80
+165a : f0 03 __ BEQ $165f
+165c : 4c 0a 18 JMP $180a ; (sprintf + 3455)
+165f : a5 5a __ LDA T11 + 2
+1661 : c9 00 __ CMP #$00
+1663 : f0 03 __ BEQ $1668
+1665 : 4c 0a 18 JMP $180a ; (sprintf + 3455)
+1668 : a5 59 __ LDA T11 + 1
+166a : c9 00 __ CMP #$00
+166c : f0 03 __ BEQ $1671
+166e : 4c 0a 18 JMP $180a ; (sprintf + 3455)
+1671 : a5 58 __ LDA T11 + 0
+1673 : 85 5c __ STA T12 + 0
+1675 : a5 59 __ LDA T11 + 1
+1677 : 85 5d __ STA T12 + 1
+1679 : a5 5a __ LDA T11 + 2
+167b : 85 5e __ STA T12 + 2
+167d : a5 5b __ LDA T11 + 3
+167f : 85 5f __ STA T12 + 3
+1681 : a9 00 __ LDA #$00
+1683 : 85 43 __ STA T0 + 0
+1685 : a9 10 __ LDA #$10
+1687 : 85 47 __ STA T2 + 0
+1689 : a9 00 __ LDA #$00
+168b : c5 5b __ CMP T11 + 3
+168d : d0 0a __ BNE $1699
+168f : c5 5a __ CMP T11 + 2
+1691 : d0 06 __ BNE $1699
+1693 : c5 59 __ CMP T11 + 1
+1695 : d0 02 __ BNE $1699
+1697 : c5 58 __ CMP T11 + 0
+1699 : b0 03 __ BCS $169e
+169b : 4c 80 17 JMP $1780 ; (sprintf + 3317)
+169e : ad e8 52 LDA $52e8 ; (sframe + 14)
+16a1 : c9 ff __ CMP #$ff
+16a3 : d0 03 __ BNE $16a8
+16a5 : 4c 72 17 JMP $1772 ; (sprintf + 3303)
+16a8 : 38 __ __ SEC
+16a9 : a9 10 __ LDA #$10
+16ab : ed e8 52 SBC $52e8 ; (sframe + 14)
+16ae : 85 4d __ STA T5 + 0
+16b0 : c5 47 __ CMP T2 + 0
+16b2 : b0 0e __ BCS $16c2
+16b4 : c6 47 __ DEC T2 + 0
+16b6 : a9 30 __ LDA #$30
+16b8 : a4 47 __ LDY T2 + 0
+16ba : 91 4f __ STA (T6 + 0),y
+16bc : a5 4d __ LDA T5 + 0
+16be : c5 47 __ CMP T2 + 0
+16c0 : 90 f2 __ BCC $16b4
+16c2 : ad ed 52 LDA $52ed ; (sframe + 19)
+16c5 : f0 33 __ BEQ $16fa
+16c7 : ad e9 52 LDA $52e9 ; (sframe + 15)
+16ca : 85 51 __ STA T7 + 0
+16cc : ad ea 52 LDA $52ea ; (sframe + 16)
+16cf : d0 29 __ BNE $16fa
+16d1 : a5 51 __ LDA T7 + 0
+16d3 : c9 10 __ CMP #$10
+16d5 : d0 23 __ BNE $16fa
+16d7 : 18 __ __ CLC
+16d8 : a5 47 __ LDA T2 + 0
+16da : 69 ff __ ADC #$ff
+16dc : 18 __ __ CLC
+16dd : 65 4f __ ADC T6 + 0
+16df : 85 51 __ STA T7 + 0
+16e1 : a5 50 __ LDA T6 + 1
+16e3 : 69 00 __ ADC #$00
+16e5 : 85 52 __ STA T7 + 1
+16e7 : a9 58 __ LDA #$58
+16e9 : a0 00 __ LDY #$00
+16eb : 91 51 __ STA (T7 + 0),y
+16ed : 18 __ __ CLC
+16ee : a5 47 __ LDA T2 + 0
+16f0 : 69 fe __ ADC #$fe
+16f2 : 85 47 __ STA T2 + 0
+16f4 : a9 30 __ LDA #$30
+16f6 : a4 47 __ LDY T2 + 0
+16f8 : 91 4f __ STA (T6 + 0),y
+16fa : a5 43 __ LDA T0 + 0
+16fc : d0 69 __ BNE $1767
+16fe : ad eb 52 LDA $52eb ; (sframe + 17)
+1701 : f0 08 __ BEQ $170b
+1703 : c6 47 __ DEC T2 + 0
+1705 : a9 2b __ LDA #$2b
+1707 : a4 47 __ LDY T2 + 0
+1709 : 91 4f __ STA (T6 + 0),y
+170b : 38 __ __ SEC
+170c : a9 10 __ LDA #$10
+170e : ed e7 52 SBC $52e7 ; (sframe + 13)
+1711 : 85 51 __ STA T7 + 0
+1713 : a9 00 __ LDA #$00
+1715 : e9 00 __ SBC #$00
+1717 : 49 80 __ EOR #$80
+1719 : c9 80 __ CMP #$80
+171b : d0 04 __ BNE $1721
+171d : a5 51 __ LDA T7 + 0
+171f : c5 47 __ CMP T2 + 0
+1721 : 90 38 __ BCC $175b
+1723 : a9 00 __ LDA #$00
+1725 : 85 43 __ STA T0 + 0
+1727 : a5 47 __ LDA T2 + 0
+1729 : c9 10 __ CMP #$10
+172b : 90 0f __ BCC $173c
+172d : a0 00 __ LDY #$00
+172f : b1 45 __ LDA (T1 + 0),y
+1731 : 85 4d __ STA T5 + 0
+1733 : e6 45 __ INC T1 + 0
+1735 : d0 02 __ BNE $1739
+1737 : e6 46 __ INC T1 + 1
+1739 : 4c 24 0b JMP $0b24 ; (sprintf + 153)
+173c : aa __ __ TAX
+173d : 8a __ __ TXA
+173e : 18 __ __ CLC
+173f : 65 4f __ ADC T6 + 0
+1741 : 85 51 __ STA T7 + 0
+1743 : a5 50 __ LDA T6 + 1
+1745 : 69 00 __ ADC #$00
+1747 : 85 52 __ STA T7 + 1
+1749 : a0 00 __ LDY #$00
+174b : b1 51 __ LDA (T7 + 0),y
+174d : a4 43 __ LDY T0 + 0
+174f : 91 4f __ STA (T6 + 0),y
+1751 : e6 43 __ INC T0 + 0
+1753 : e8 __ __ INX
+1754 : e0 10 __ CPX #$10
+1756 : 90 e5 __ BCC $173d
+1758 : 4c 2d 17 JMP $172d ; (sprintf + 3234)
+175b : c6 47 __ DEC T2 + 0
+175d : ad e6 52 LDA $52e6 ; (sframe + 12)
+1760 : a4 47 __ LDY T2 + 0
+1762 : 91 4f __ STA (T6 + 0),y
+1764 : 4c 0b 17 JMP $170b ; (sprintf + 3200)
+1767 : c6 47 __ DEC T2 + 0
+1769 : a9 2d __ LDA #$2d
+176b : a4 47 __ LDY T2 + 0
+176d : 91 4f __ STA (T6 + 0),y
+176f : 4c 0b 17 JMP $170b ; (sprintf + 3200)
+1772 : a9 0f __ LDA #$0f
+1774 : 85 4d __ STA T5 + 0
+1776 : c5 47 __ CMP T2 + 0
+1778 : b0 03 __ BCS $177d
+177a : 4c b4 16 JMP $16b4 ; (sprintf + 3113)
+177d : 4c c2 16 JMP $16c2 ; (sprintf + 3127)
+1780 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1783 : 85 03 __ STA $03
+1785 : ad ea 52 LDA $52ea ; (sframe + 16)
+1788 : 85 04 __ STA $04
+178a : a9 00 __ LDA #$00
+178c : 85 05 __ STA $05
+178e : 85 06 __ STA $06
+1790 : a5 5c __ LDA T12 + 0
+1792 : 85 1b __ STA ACCU + 0
+1794 : a5 5d __ LDA T12 + 1
+1796 : 85 1c __ STA ACCU + 1
+1798 : a5 5e __ LDA T12 + 2
+179a : 85 1d __ STA ACCU + 2
+179c : a5 5f __ LDA T12 + 3
+179e : 85 1e __ STA ACCU + 3
+17a0 : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+17a3 : a5 08 __ LDA $08
+17a5 : 10 53 __ BPL $17fa
+17a7 : 18 __ __ CLC
+17a8 : a5 07 __ LDA $07
+17aa : 69 30 __ ADC #$30
+17ac : c6 47 __ DEC T2 + 0
+17ae : a4 47 __ LDY T2 + 0
+17b0 : 91 4f __ STA (T6 + 0),y
+17b2 : ad e9 52 LDA $52e9 ; (sframe + 15)
+17b5 : 85 03 __ STA $03
+17b7 : ad ea 52 LDA $52ea ; (sframe + 16)
+17ba : 85 04 __ STA $04
+17bc : a9 00 __ LDA #$00
+17be : 85 05 __ STA $05
+17c0 : 85 06 __ STA $06
+17c2 : a5 5c __ LDA T12 + 0
+17c4 : 85 1b __ STA ACCU + 0
+17c6 : a5 5d __ LDA T12 + 1
+17c8 : 85 1c __ STA ACCU + 1
+17ca : a5 5e __ LDA T12 + 2
+17cc : 85 1d __ STA ACCU + 2
+17ce : a5 5f __ LDA T12 + 3
+17d0 : 85 1e __ STA ACCU + 3
+17d2 : 20 a0 23 JSR $23a0 ; (divmod32 + 0)
+17d5 : a5 1b __ LDA ACCU + 0
+17d7 : 85 5c __ STA T12 + 0
+17d9 : a5 1c __ LDA ACCU + 1
+17db : 85 5d __ STA T12 + 1
+17dd : a5 1d __ LDA ACCU + 2
+17df : 85 5e __ STA T12 + 2
+17e1 : a5 1e __ LDA ACCU + 3
+17e3 : 85 5f __ STA T12 + 3
+17e5 : a9 00 __ LDA #$00
+17e7 : c5 1e __ CMP ACCU + 3
+17e9 : d0 0a __ BNE $17f5
+17eb : c5 1d __ CMP ACCU + 2
+17ed : d0 06 __ BNE $17f5
+17ef : c5 1c __ CMP ACCU + 1
+17f1 : d0 02 __ BNE $17f5
+17f3 : c5 1b __ CMP ACCU + 0
+17f5 : 90 89 __ BCC $1780
+17f7 : 4c 9e 16 JMP $169e ; (sprintf + 3091)
+17fa : d0 06 __ BNE $1802
+17fc : a5 07 __ LDA $07
+17fe : c9 0a __ CMP #$0a
+1800 : 90 a5 __ BCC $17a7
+1802 : 18 __ __ CLC
+1803 : a5 07 __ LDA $07
+1805 : 69 37 __ ADC #$37
+1807 : 4c ac 17 JMP $17ac ; (sprintf + 3361)
+180a : 90 22 __ BCC $182e
+180c : 85 5c __ STA T12 + 0
+180e : a5 59 __ LDA T11 + 1
+1810 : 85 5d __ STA T12 + 1
+1812 : a5 5a __ LDA T11 + 2
+1814 : 85 5e __ STA T12 + 2
+1816 : a5 5b __ LDA T11 + 3
+1818 : 85 5f __ STA T12 + 3
+181a : a9 00 __ LDA #$00
+181c : 85 43 __ STA T0 + 0
+181e : a9 10 __ LDA #$10
+1820 : 85 47 __ STA T2 + 0
+1822 : a9 00 __ LDA #$00
+1824 : c5 5b __ CMP T11 + 3
+1826 : f0 03 __ BEQ $182b
+1828 : 4c 99 16 JMP $1699 ; (sprintf + 3086)
+182b : 4c 8f 16 JMP $168f ; (sprintf + 3076)
+182e : a9 01 __ LDA #$01
+1830 : 85 43 __ STA T0 + 0
+1832 : a9 10 __ LDA #$10
+1834 : 85 47 __ STA T2 + 0
+1836 : 38 __ __ SEC
+1837 : a9 00 __ LDA #$00
+1839 : e5 58 __ SBC T11 + 0
+183b : 85 5c __ STA T12 + 0
+183d : a9 00 __ LDA #$00
+183f : e5 59 __ SBC T11 + 1
+1841 : 85 5d __ STA T12 + 1
+1843 : a9 00 __ LDA #$00
+1845 : e5 5a __ SBC T11 + 2
+1847 : 85 5e __ STA T12 + 2
+1849 : a9 00 __ LDA #$00
+184b : e5 5b __ SBC T11 + 3
+184d : 85 5f __ STA T12 + 3
+184f : a9 00 __ LDA #$00
+1851 : c5 5f __ CMP T12 + 3
+1853 : d0 0a __ BNE $185f
+1855 : c5 5e __ CMP T12 + 2
+1857 : d0 06 __ BNE $185f
+1859 : c5 5d __ CMP T12 + 1
+185b : d0 02 __ BNE $185f
+185d : c5 5c __ CMP T12 + 0
+185f : b0 03 __ BCS $1864
+1861 : 4c 80 17 JMP $1780 ; (sprintf + 3317)
+1864 : 4c 9e 16 JMP $169e ; (sprintf + 3091)
+1867 : a9 10 __ LDA #$10
+1869 : 8d e9 52 STA $52e9 ; (sframe + 15)
+186c : a9 00 __ LDA #$00
+186e : 8d ea 52 STA $52ea ; (sframe + 16)
+1871 : a5 49 __ LDA T3 + 0
+1873 : 85 4f __ STA T6 + 0
+1875 : a5 4a __ LDA T3 + 1
+1877 : 85 50 __ STA T6 + 1
+1879 : a0 00 __ LDY #$00
+187b : b1 4b __ LDA (T4 + 0),y
+187d : 85 51 __ STA T7 + 0
+187f : c8 __ __ INY
+1880 : b1 4b __ LDA (T4 + 0),y
+1882 : 85 52 __ STA T7 + 1
+1884 : 18 __ __ CLC
+1885 : a5 4b __ LDA T4 + 0
+1887 : 69 02 __ ADC #$02
+1889 : 85 4b __ STA T4 + 0
+188b : 90 02 __ BCC $188f
+188d : e6 4c __ INC T4 + 1
+188f : a9 0a __ LDA #$0a
+1891 : 85 43 __ STA T0 + 0
+1893 : a5 51 __ LDA T7 + 0
+1895 : 05 52 __ ORA T7 + 1
+1897 : f0 03 __ BEQ $189c
+1899 : 4c 59 19 JMP $1959 ; (sprintf + 3790)
+189c : ad e8 52 LDA $52e8 ; (sframe + 14)
+189f : c9 ff __ CMP #$ff
+18a1 : d0 03 __ BNE $18a6
+18a3 : 4c 4b 19 JMP $194b ; (sprintf + 3776)
+18a6 : 38 __ __ SEC
+18a7 : a9 0a __ LDA #$0a
+18a9 : ed e8 52 SBC $52e8 ; (sframe + 14)
+18ac : 85 47 __ STA T2 + 0
+18ae : c5 43 __ CMP T0 + 0
+18b0 : b0 0e __ BCS $18c0
+18b2 : c6 43 __ DEC T0 + 0
+18b4 : a9 30 __ LDA #$30
+18b6 : a4 43 __ LDY T0 + 0
+18b8 : 91 4f __ STA (T6 + 0),y
+18ba : a5 47 __ LDA T2 + 0
+18bc : c5 43 __ CMP T0 + 0
+18be : 90 f2 __ BCC $18b2
+18c0 : ad ed 52 LDA $52ed ; (sframe + 19)
+18c3 : f0 33 __ BEQ $18f8
+18c5 : ad e9 52 LDA $52e9 ; (sframe + 15)
+18c8 : 85 51 __ STA T7 + 0
+18ca : ad ea 52 LDA $52ea ; (sframe + 16)
+18cd : d0 29 __ BNE $18f8
+18cf : a5 51 __ LDA T7 + 0
+18d1 : c9 10 __ CMP #$10
+18d3 : d0 23 __ BNE $18f8
+18d5 : 18 __ __ CLC
+18d6 : a5 43 __ LDA T0 + 0
+18d8 : 69 ff __ ADC #$ff
+18da : 18 __ __ CLC
+18db : 65 4f __ ADC T6 + 0
+18dd : 85 51 __ STA T7 + 0
+18df : a5 50 __ LDA T6 + 1
+18e1 : 69 00 __ ADC #$00
+18e3 : 85 52 __ STA T7 + 1
+18e5 : a9 58 __ LDA #$58
+18e7 : a0 00 __ LDY #$00
+18e9 : 91 51 __ STA (T7 + 0),y
+18eb : 18 __ __ CLC
+18ec : a5 43 __ LDA T0 + 0
+18ee : 69 fe __ ADC #$fe
+18f0 : 85 43 __ STA T0 + 0
+18f2 : a9 30 __ LDA #$30
+18f4 : a4 43 __ LDY T0 + 0
+18f6 : 91 4f __ STA (T6 + 0),y
+18f8 : ad eb 52 LDA $52eb ; (sframe + 17)
+18fb : f0 08 __ BEQ $1905
+18fd : c6 43 __ DEC T0 + 0
+18ff : a9 2b __ LDA #$2b
+1901 : a4 43 __ LDY T0 + 0
+1903 : 91 4f __ STA (T6 + 0),y
+1905 : 38 __ __ SEC
+1906 : a9 0a __ LDA #$0a
+1908 : ed e7 52 SBC $52e7 ; (sframe + 13)
+190b : 85 51 __ STA T7 + 0
+190d : a9 00 __ LDA #$00
+190f : e9 00 __ SBC #$00
+1911 : 49 80 __ EOR #$80
+1913 : c9 80 __ CMP #$80
+1915 : d0 04 __ BNE $191b
+1917 : a5 51 __ LDA T7 + 0
+1919 : c5 43 __ CMP T0 + 0
+191b : 90 22 __ BCC $193f
+191d : a9 00 __ LDA #$00
+191f : 85 47 __ STA T2 + 0
+1921 : a5 43 __ LDA T0 + 0
+1923 : c9 0a __ CMP #$0a
+1925 : 90 03 __ BCC $192a
+1927 : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+192a : a4 43 __ LDY T0 + 0
+192c : b1 4f __ LDA (T6 + 0),y
+192e : a4 47 __ LDY T2 + 0
+1930 : 91 4f __ STA (T6 + 0),y
+1932 : e6 47 __ INC T2 + 0
+1934 : e6 43 __ INC T0 + 0
+1936 : a5 43 __ LDA T0 + 0
+1938 : c9 0a __ CMP #$0a
+193a : 90 ee __ BCC $192a
+193c : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+193f : c6 43 __ DEC T0 + 0
+1941 : ad e6 52 LDA $52e6 ; (sframe + 12)
+1944 : a4 43 __ LDY T0 + 0
+1946 : 91 4f __ STA (T6 + 0),y
+1948 : 4c 05 19 JMP $1905 ; (sprintf + 3706)
+194b : a9 09 __ LDA #$09
+194d : 85 47 __ STA T2 + 0
+194f : c5 43 __ CMP T0 + 0
+1951 : b0 03 __ BCS $1956
+1953 : 4c b2 18 JMP $18b2 ; (sprintf + 3623)
+1956 : 4c c0 18 JMP $18c0 ; (sprintf + 3637)
+1959 : a5 51 __ LDA T7 + 0
+195b : 85 1b __ STA ACCU + 0
+195d : a5 52 __ LDA T7 + 1
+195f : 85 1c __ STA ACCU + 1
+1961 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1964 : 85 03 __ STA $03
+1966 : ad ea 52 LDA $52ea ; (sframe + 16)
+1969 : 85 04 __ STA $04
+196b : 20 14 22 JSR $2214 ; (divmod + 0)
+196e : a5 06 __ LDA $06
+1970 : 10 2f __ BPL $19a1
+1972 : 18 __ __ CLC
+1973 : a5 05 __ LDA $05
+1975 : 69 30 __ ADC #$30
+1977 : c6 43 __ DEC T0 + 0
+1979 : a4 43 __ LDY T0 + 0
+197b : 91 4f __ STA (T6 + 0),y
+197d : a5 51 __ LDA T7 + 0
+197f : 85 1b __ STA ACCU + 0
+1981 : a5 52 __ LDA T7 + 1
+1983 : 85 1c __ STA ACCU + 1
+1985 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1988 : 85 03 __ STA $03
+198a : ad ea 52 LDA $52ea ; (sframe + 16)
+198d : 85 04 __ STA $04
+198f : 20 14 22 JSR $2214 ; (divmod + 0)
+1992 : a5 1b __ LDA ACCU + 0
+1994 : 85 51 __ STA T7 + 0
+1996 : a5 1c __ LDA ACCU + 1
+1998 : 85 52 __ STA T7 + 1
+199a : 05 1b __ ORA ACCU + 0
+199c : d0 bb __ BNE $1959
+199e : 4c 9c 18 JMP $189c ; (sprintf + 3601)
+19a1 : d0 06 __ BNE $19a9
+19a3 : a5 05 __ LDA $05
+19a5 : c9 0a __ CMP #$0a
+19a7 : 90 c9 __ BCC $1972
+19a9 : 18 __ __ CLC
+19aa : a5 05 __ LDA $05
+19ac : 69 37 __ ADC #$37
+19ae : 4c 77 19 JMP $1977 ; (sprintf + 3820)
+19b1 : a5 49 __ LDA T3 + 0
+19b3 : 85 4f __ STA T6 + 0
+19b5 : a5 4a __ LDA T3 + 1
+19b7 : 85 50 __ STA T6 + 1
+19b9 : a0 00 __ LDY #$00
+19bb : b1 4b __ LDA (T4 + 0),y
+19bd : 85 51 __ STA T7 + 0
+19bf : c8 __ __ INY
+19c0 : b1 4b __ LDA (T4 + 0),y
+19c2 : 85 52 __ STA T7 + 1
+19c4 : 18 __ __ CLC
+19c5 : a5 4b __ LDA T4 + 0
+19c7 : 69 02 __ ADC #$02
+19c9 : 85 4b __ STA T4 + 0
+19cb : 90 02 __ BCC $19cf
+19cd : e6 4c __ INC T4 + 1
+19cf : a9 0a __ LDA #$0a
+19d1 : 85 43 __ STA T0 + 0
+19d3 : a5 51 __ LDA T7 + 0
+19d5 : 05 52 __ ORA T7 + 1
+19d7 : f0 03 __ BEQ $19dc
+19d9 : 4c 99 1a JMP $1a99 ; (sprintf + 4110)
+19dc : ad e8 52 LDA $52e8 ; (sframe + 14)
+19df : c9 ff __ CMP #$ff
+19e1 : d0 03 __ BNE $19e6
+19e3 : 4c 8b 1a JMP $1a8b ; (sprintf + 4096)
+19e6 : 38 __ __ SEC
+19e7 : a9 0a __ LDA #$0a
+19e9 : ed e8 52 SBC $52e8 ; (sframe + 14)
+19ec : 85 47 __ STA T2 + 0
+19ee : c5 43 __ CMP T0 + 0
+19f0 : b0 0e __ BCS $1a00
+19f2 : c6 43 __ DEC T0 + 0
+19f4 : a9 30 __ LDA #$30
+19f6 : a4 43 __ LDY T0 + 0
+19f8 : 91 4f __ STA (T6 + 0),y
+19fa : a5 47 __ LDA T2 + 0
+19fc : c5 43 __ CMP T0 + 0
+19fe : 90 f2 __ BCC $19f2
+1a00 : ad ed 52 LDA $52ed ; (sframe + 19)
+1a03 : f0 33 __ BEQ $1a38
+1a05 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1a08 : 85 51 __ STA T7 + 0
+1a0a : ad ea 52 LDA $52ea ; (sframe + 16)
+1a0d : d0 29 __ BNE $1a38
+1a0f : a5 51 __ LDA T7 + 0
+1a11 : c9 10 __ CMP #$10
+1a13 : d0 23 __ BNE $1a38
+1a15 : 18 __ __ CLC
+1a16 : a5 43 __ LDA T0 + 0
+1a18 : 69 ff __ ADC #$ff
+1a1a : 18 __ __ CLC
+1a1b : 65 4f __ ADC T6 + 0
+1a1d : 85 51 __ STA T7 + 0
+1a1f : a5 50 __ LDA T6 + 1
+1a21 : 69 00 __ ADC #$00
+1a23 : 85 52 __ STA T7 + 1
+1a25 : a9 58 __ LDA #$58
+1a27 : a0 00 __ LDY #$00
+1a29 : 91 51 __ STA (T7 + 0),y
+1a2b : 18 __ __ CLC
+1a2c : a5 43 __ LDA T0 + 0
+1a2e : 69 fe __ ADC #$fe
+1a30 : 85 43 __ STA T0 + 0
+1a32 : a9 30 __ LDA #$30
+1a34 : a4 43 __ LDY T0 + 0
+1a36 : 91 4f __ STA (T6 + 0),y
+1a38 : ad eb 52 LDA $52eb ; (sframe + 17)
+1a3b : f0 08 __ BEQ $1a45
+1a3d : c6 43 __ DEC T0 + 0
+1a3f : a9 2b __ LDA #$2b
+1a41 : a4 43 __ LDY T0 + 0
+1a43 : 91 4f __ STA (T6 + 0),y
+1a45 : 38 __ __ SEC
+1a46 : a9 0a __ LDA #$0a
+1a48 : ed e7 52 SBC $52e7 ; (sframe + 13)
+1a4b : 85 51 __ STA T7 + 0
+1a4d : a9 00 __ LDA #$00
+1a4f : e9 00 __ SBC #$00
+1a51 : 49 80 __ EOR #$80
+1a53 : c9 80 __ CMP #$80
+1a55 : d0 04 __ BNE $1a5b
+1a57 : a5 51 __ LDA T7 + 0
+1a59 : c5 43 __ CMP T0 + 0
+1a5b : 90 22 __ BCC $1a7f
+1a5d : a9 00 __ LDA #$00
+1a5f : 85 47 __ STA T2 + 0
+1a61 : a5 43 __ LDA T0 + 0
+1a63 : c9 0a __ CMP #$0a
+1a65 : 90 03 __ BCC $1a6a
+1a67 : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+1a6a : a4 43 __ LDY T0 + 0
+1a6c : b1 4f __ LDA (T6 + 0),y
+1a6e : a4 47 __ LDY T2 + 0
+1a70 : 91 4f __ STA (T6 + 0),y
+1a72 : e6 47 __ INC T2 + 0
+1a74 : e6 43 __ INC T0 + 0
+1a76 : a5 43 __ LDA T0 + 0
+1a78 : c9 0a __ CMP #$0a
+1a7a : 90 ee __ BCC $1a6a
+1a7c : 4c 2d 14 JMP $142d ; (sprintf + 2466)
+1a7f : c6 43 __ DEC T0 + 0
+1a81 : ad e6 52 LDA $52e6 ; (sframe + 12)
+1a84 : a4 43 __ LDY T0 + 0
+1a86 : 91 4f __ STA (T6 + 0),y
+1a88 : 4c 45 1a JMP $1a45 ; (sprintf + 4026)
+1a8b : a9 09 __ LDA #$09
+1a8d : 85 47 __ STA T2 + 0
+1a8f : c5 43 __ CMP T0 + 0
+1a91 : b0 03 __ BCS $1a96
+1a93 : 4c f2 19 JMP $19f2 ; (sprintf + 3943)
+1a96 : 4c 00 1a JMP $1a00 ; (sprintf + 3957)
+1a99 : a5 51 __ LDA T7 + 0
+1a9b : 85 1b __ STA ACCU + 0
+1a9d : a5 52 __ LDA T7 + 1
+1a9f : 85 1c __ STA ACCU + 1
+1aa1 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1aa4 : 85 03 __ STA $03
+1aa6 : ad ea 52 LDA $52ea ; (sframe + 16)
+1aa9 : 85 04 __ STA $04
+1aab : 20 14 22 JSR $2214 ; (divmod + 0)
+1aae : a5 06 __ LDA $06
+1ab0 : 10 2f __ BPL $1ae1
+1ab2 : 18 __ __ CLC
+1ab3 : a5 05 __ LDA $05
+1ab5 : 69 30 __ ADC #$30
+1ab7 : c6 43 __ DEC T0 + 0
+1ab9 : a4 43 __ LDY T0 + 0
+1abb : 91 4f __ STA (T6 + 0),y
+1abd : a5 51 __ LDA T7 + 0
+1abf : 85 1b __ STA ACCU + 0
+1ac1 : a5 52 __ LDA T7 + 1
+1ac3 : 85 1c __ STA ACCU + 1
+1ac5 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1ac8 : 85 03 __ STA $03
+1aca : ad ea 52 LDA $52ea ; (sframe + 16)
+1acd : 85 04 __ STA $04
+1acf : 20 14 22 JSR $2214 ; (divmod + 0)
+1ad2 : a5 1b __ LDA ACCU + 0
+1ad4 : 85 51 __ STA T7 + 0
+1ad6 : a5 1c __ LDA ACCU + 1
+1ad8 : 85 52 __ STA T7 + 1
+1ada : 05 1b __ ORA ACCU + 0
+1adc : d0 bb __ BNE $1a99
+1ade : 4c dc 19 JMP $19dc ; (sprintf + 3921)
+1ae1 : d0 06 __ BNE $1ae9
+1ae3 : a5 05 __ LDA $05
+1ae5 : c9 0a __ CMP #$0a
+1ae7 : 90 c9 __ BCC $1ab2
+1ae9 : 18 __ __ CLC
+1aea : a5 05 __ LDA $05
+1aec : 69 37 __ ADC #$37
+1aee : 4c b7 1a JMP $1ab7 ; (sprintf + 4140)
+1af1 : a5 49 __ LDA T3 + 0
+1af3 : 85 4f __ STA T6 + 0
+1af5 : a5 4a __ LDA T3 + 1
+1af7 : 85 50 __ STA T6 + 1
+1af9 : a0 00 __ LDY #$00
+1afb : b1 4b __ LDA (T4 + 0),y
+1afd : 85 51 __ STA T7 + 0
+1aff : c8 __ __ INY
+1b00 : b1 4b __ LDA (T4 + 0),y
+1b02 : 85 52 __ STA T7 + 1
+1b04 : 18 __ __ CLC
+1b05 : a5 4b __ LDA T4 + 0
+1b07 : 69 02 __ ADC #$02
+1b09 : 85 4b __ STA T4 + 0
+1b0b : 90 02 __ BCC $1b0f
+1b0d : e6 4c __ INC T4 + 1
+1b0f : a5 52 __ LDA T7 + 1
+1b11 : 10 03 __ BPL $1b16
+1b13 : 4c 53 1c JMP $1c53 ; (sprintf + 4552)
+1b16 : a5 51 __ LDA T7 + 0
+1b18 : 85 53 __ STA T8 + 0
+1b1a : a5 52 __ LDA T7 + 1
+1b1c : 85 54 __ STA T8 + 1
+1b1e : a9 00 __ LDA #$00
+1b20 : 85 43 __ STA T0 + 0
+1b22 : a9 0a __ LDA #$0a
+1b24 : 85 47 __ STA T2 + 0
+1b26 : a5 51 __ LDA T7 + 0
+1b28 : 05 52 __ ORA T7 + 1
+1b2a : f0 03 __ BEQ $1b2f
+1b2c : 4c fb 1b JMP $1bfb ; (sprintf + 4464)
+1b2f : ad e8 52 LDA $52e8 ; (sframe + 14)
+1b32 : c9 ff __ CMP #$ff
+1b34 : d0 03 __ BNE $1b39
+1b36 : 4c ed 1b JMP $1bed ; (sprintf + 4450)
+1b39 : 38 __ __ SEC
+1b3a : a9 0a __ LDA #$0a
+1b3c : ed e8 52 SBC $52e8 ; (sframe + 14)
+1b3f : 85 4d __ STA T5 + 0
+1b41 : c5 47 __ CMP T2 + 0
+1b43 : b0 0e __ BCS $1b53
+1b45 : c6 47 __ DEC T2 + 0
+1b47 : a9 30 __ LDA #$30
+1b49 : a4 47 __ LDY T2 + 0
+1b4b : 91 4f __ STA (T6 + 0),y
+1b4d : a5 4d __ LDA T5 + 0
+1b4f : c5 47 __ CMP T2 + 0
+1b51 : 90 f2 __ BCC $1b45
+1b53 : ad ed 52 LDA $52ed ; (sframe + 19)
+1b56 : f0 33 __ BEQ $1b8b
+1b58 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1b5b : 85 51 __ STA T7 + 0
+1b5d : ad ea 52 LDA $52ea ; (sframe + 16)
+1b60 : d0 29 __ BNE $1b8b
+1b62 : a5 51 __ LDA T7 + 0
+1b64 : c9 10 __ CMP #$10
+1b66 : d0 23 __ BNE $1b8b
+1b68 : 18 __ __ CLC
+1b69 : a5 47 __ LDA T2 + 0
+1b6b : 69 ff __ ADC #$ff
+1b6d : 18 __ __ CLC
+1b6e : 65 4f __ ADC T6 + 0
+1b70 : 85 51 __ STA T7 + 0
+1b72 : a5 50 __ LDA T6 + 1
+1b74 : 69 00 __ ADC #$00
+1b76 : 85 52 __ STA T7 + 1
+1b78 : a9 58 __ LDA #$58
+1b7a : a0 00 __ LDY #$00
+1b7c : 91 51 __ STA (T7 + 0),y
+1b7e : 18 __ __ CLC
+1b7f : a5 47 __ LDA T2 + 0
+1b81 : 69 fe __ ADC #$fe
+1b83 : 85 47 __ STA T2 + 0
+1b85 : a9 30 __ LDA #$30
+1b87 : a4 47 __ LDY T2 + 0
+1b89 : 91 4f __ STA (T6 + 0),y
+1b8b : a5 43 __ LDA T0 + 0
+1b8d : d0 53 __ BNE $1be2
+1b8f : ad eb 52 LDA $52eb ; (sframe + 17)
+1b92 : f0 08 __ BEQ $1b9c
+1b94 : c6 47 __ DEC T2 + 0
+1b96 : a9 2b __ LDA #$2b
+1b98 : a4 47 __ LDY T2 + 0
+1b9a : 91 4f __ STA (T6 + 0),y
+1b9c : 38 __ __ SEC
+1b9d : a9 0a __ LDA #$0a
+1b9f : ed e7 52 SBC $52e7 ; (sframe + 13)
+1ba2 : 85 51 __ STA T7 + 0
+1ba4 : a9 00 __ LDA #$00
+1ba6 : e9 00 __ SBC #$00
+1ba8 : 49 80 __ EOR #$80
+1baa : c9 80 __ CMP #$80
+1bac : d0 04 __ BNE $1bb2
+1bae : a5 51 __ LDA T7 + 0
+1bb0 : c5 47 __ CMP T2 + 0
+1bb2 : 90 22 __ BCC $1bd6
+1bb4 : a9 00 __ LDA #$00
+1bb6 : 85 43 __ STA T0 + 0
+1bb8 : a5 47 __ LDA T2 + 0
+1bba : c9 0a __ CMP #$0a
+1bbc : 90 03 __ BCC $1bc1
+1bbe : 4c 2d 17 JMP $172d ; (sprintf + 3234)
+1bc1 : a4 47 __ LDY T2 + 0
+1bc3 : b1 4f __ LDA (T6 + 0),y
+1bc5 : a4 43 __ LDY T0 + 0
+1bc7 : 91 4f __ STA (T6 + 0),y
+1bc9 : e6 43 __ INC T0 + 0
+1bcb : e6 47 __ INC T2 + 0
+1bcd : a5 47 __ LDA T2 + 0
+1bcf : c9 0a __ CMP #$0a
+1bd1 : 90 ee __ BCC $1bc1
+1bd3 : 4c 2d 17 JMP $172d ; (sprintf + 3234)
+1bd6 : c6 47 __ DEC T2 + 0
+1bd8 : ad e6 52 LDA $52e6 ; (sframe + 12)
+1bdb : a4 47 __ LDY T2 + 0
+1bdd : 91 4f __ STA (T6 + 0),y
+1bdf : 4c 9c 1b JMP $1b9c ; (sprintf + 4369)
+1be2 : c6 47 __ DEC T2 + 0
+1be4 : a9 2d __ LDA #$2d
+1be6 : a4 47 __ LDY T2 + 0
+1be8 : 91 4f __ STA (T6 + 0),y
+1bea : 4c 9c 1b JMP $1b9c ; (sprintf + 4369)
+1bed : a9 09 __ LDA #$09
+1bef : 85 4d __ STA T5 + 0
+1bf1 : c5 47 __ CMP T2 + 0
+1bf3 : b0 03 __ BCS $1bf8
+1bf5 : 4c 45 1b JMP $1b45 ; (sprintf + 4282)
+1bf8 : 4c 53 1b JMP $1b53 ; (sprintf + 4296)
+1bfb : a5 53 __ LDA T8 + 0
+1bfd : 85 1b __ STA ACCU + 0
+1bff : a5 54 __ LDA T8 + 1
+1c01 : 85 1c __ STA ACCU + 1
+1c03 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1c06 : 85 03 __ STA $03
+1c08 : ad ea 52 LDA $52ea ; (sframe + 16)
+1c0b : 85 04 __ STA $04
+1c0d : 20 14 22 JSR $2214 ; (divmod + 0)
+1c10 : a5 06 __ LDA $06
+1c12 : 10 2f __ BPL $1c43
+1c14 : 18 __ __ CLC
+1c15 : a5 05 __ LDA $05
+1c17 : 69 30 __ ADC #$30
+1c19 : c6 47 __ DEC T2 + 0
+1c1b : a4 47 __ LDY T2 + 0
+1c1d : 91 4f __ STA (T6 + 0),y
+1c1f : a5 53 __ LDA T8 + 0
+1c21 : 85 1b __ STA ACCU + 0
+1c23 : a5 54 __ LDA T8 + 1
+1c25 : 85 1c __ STA ACCU + 1
+1c27 : ad e9 52 LDA $52e9 ; (sframe + 15)
+1c2a : 85 03 __ STA $03
+1c2c : ad ea 52 LDA $52ea ; (sframe + 16)
+1c2f : 85 04 __ STA $04
+1c31 : 20 14 22 JSR $2214 ; (divmod + 0)
+1c34 : a5 1b __ LDA ACCU + 0
+1c36 : 85 53 __ STA T8 + 0
+1c38 : a5 1c __ LDA ACCU + 1
+1c3a : 85 54 __ STA T8 + 1
+1c3c : 05 1b __ ORA ACCU + 0
+1c3e : d0 bb __ BNE $1bfb
+1c40 : 4c 2f 1b JMP $1b2f ; (sprintf + 4260)
+1c43 : d0 06 __ BNE $1c4b
+1c45 : a5 05 __ LDA $05
+1c47 : c9 0a __ CMP #$0a
+1c49 : 90 c9 __ BCC $1c14
+1c4b : 18 __ __ CLC
+1c4c : a5 05 __ LDA $05
+1c4e : 69 37 __ ADC #$37
+1c50 : 4c 19 1c JMP $1c19 ; (sprintf + 4494)
+1c53 : a9 01 __ LDA #$01
+1c55 : 85 43 __ STA T0 + 0
+1c57 : a9 0a __ LDA #$0a
+1c59 : 85 47 __ STA T2 + 0
+1c5b : 38 __ __ SEC
+1c5c : a9 00 __ LDA #$00
+1c5e : e5 51 __ SBC T7 + 0
+1c60 : 85 53 __ STA T8 + 0
+1c62 : a9 00 __ LDA #$00
+1c64 : e5 52 __ SBC T7 + 1
+1c66 : 85 54 __ STA T8 + 1
+1c68 : 05 53 __ ORA T8 + 0
+1c6a : d0 8f __ BNE $1bfb
+1c6c : 4c 2f 1b JMP $1b2f ; (sprintf + 4260)
+1c6f : a9 00 __ LDA #$00
+1c71 : 85 4f __ STA T6 + 0
+1c73 : 85 50 __ STA T6 + 1
+1c75 : a0 00 __ LDY #$00
+1c77 : b1 45 __ LDA (T1 + 0),y
+1c79 : 85 47 __ STA T2 + 0
+1c7b : e6 45 __ INC T1 + 0
+1c7d : d0 02 __ BNE $1c81
+1c7f : e6 46 __ INC T1 + 1
+1c81 : a5 47 __ LDA T2 + 0
+1c83 : c9 30 __ CMP #$30
+1c85 : 90 4f __ BCC $1cd6
+1c87 : a9 39 __ LDA #$39
+1c89 : c5 47 __ CMP T2 + 0
+1c8b : 90 49 __ BCC $1cd6
+1c8d : a5 47 __ LDA T2 + 0
+1c8f : 85 51 __ STA T7 + 0
+1c91 : a0 00 __ LDY #$00
+1c93 : b1 45 __ LDA (T1 + 0),y
+1c95 : 85 47 __ STA T2 + 0
+1c97 : e6 45 __ INC T1 + 0
+1c99 : d0 02 __ BNE $1c9d
+1c9b : e6 46 __ INC T1 + 1
+1c9d : a5 4f __ LDA T6 + 0
+1c9f : 0a __ __ ASL
+1ca0 : 85 07 __ STA $07
+1ca2 : a5 50 __ LDA T6 + 1
+1ca4 : 2a __ __ ROL
+1ca5 : 06 07 __ ASL $07
+1ca7 : 2a __ __ ROL
+1ca8 : 85 08 __ STA $08
+1caa : 18 __ __ CLC
+1cab : a5 07 __ LDA $07
+1cad : 65 4f __ ADC T6 + 0
+1caf : 85 1b __ STA ACCU + 0
+1cb1 : a5 08 __ LDA $08
+1cb3 : 65 50 __ ADC T6 + 1
+1cb5 : 06 1b __ ASL ACCU + 0
+1cb7 : 2a __ __ ROL
+1cb8 : 85 1c __ STA ACCU + 1
+1cba : 18 __ __ CLC
+1cbb : a5 1b __ LDA ACCU + 0
+1cbd : 65 51 __ ADC T7 + 0
+1cbf : aa __ __ TAX
+1cc0 : a5 1c __ LDA ACCU + 1
+1cc2 : 69 00 __ ADC #$00
+1cc4 : a8 __ __ TAY
+1cc5 : 38 __ __ SEC
+1cc6 : 8a __ __ TXA
+1cc7 : e9 30 __ SBC #$30
+1cc9 : 85 4f __ STA T6 + 0
+1ccb : 98 __ __ TYA
+1ccc : e9 00 __ SBC #$00
+1cce : 85 50 __ STA T6 + 1
+1cd0 : a5 47 __ LDA T2 + 0
+1cd2 : c9 30 __ CMP #$30
+1cd4 : b0 b1 __ BCS $1c87
+1cd6 : a5 4f __ LDA T6 + 0
+1cd8 : 8d e8 52 STA $52e8 ; (sframe + 14)
+1cdb : 4c 07 0c JMP $0c07 ; (sprintf + 380)
+1cde : a9 01 __ LDA #$01
+1ce0 : 8d ed 52 STA $52ed ; (sframe + 19)
+1ce3 : a0 00 __ LDY #$00
+1ce5 : b1 45 __ LDA (T1 + 0),y
+1ce7 : 85 47 __ STA T2 + 0
+1ce9 : 4c 77 0b JMP $0b77 ; (sprintf + 236)
+1cec : a9 30 __ LDA #$30
+1cee : 8d e6 52 STA $52e6 ; (sframe + 12)
+1cf1 : a0 00 __ LDY #$00
+1cf3 : b1 45 __ LDA (T1 + 0),y
+1cf5 : 85 47 __ STA T2 + 0
+1cf7 : 4c 77 0b JMP $0b77 ; (sprintf + 236)
+1cfa : a9 01 __ LDA #$01
+1cfc : 8d eb 52 STA $52eb ; (sframe + 17)
+1cff : a0 00 __ LDY #$00
+1d01 : b1 45 __ LDA (T1 + 0),y
+1d03 : 85 47 __ STA T2 + 0
+1d05 : 4c 77 0b JMP $0b77 ; (sprintf + 236)
+--------------------------------------------------------------------
+qsort:
+1d0d : 38 __ __ SEC
+1d0e : a5 23 __ LDA SP + 0
+1d10 : e9 12 __ SBC #$12
+1d12 : 85 23 __ STA SP + 0
+1d14 : a5 24 __ LDA SP + 1
+1d16 : e9 00 __ SBC #$00
+1d18 : 85 24 __ STA SP + 1
+1d1a : a0 03 __ LDY #$03
+1d1c : b9 53 00 LDA $0053,y 
+1d1f : 91 23 __ STA (SP + 0),y
+1d21 : 88 __ __ DEY
+1d22 : 10 f8 __ BPL $1d1c
+1d24 : 38 __ __ SEC
+1d25 : a5 23 __ LDA SP + 0
+1d27 : e9 06 __ SBC #$06
+1d29 : 85 23 __ STA SP + 0
+1d2b : a5 24 __ LDA SP + 1
+1d2d : e9 00 __ SBC #$00
+1d2f : 85 24 __ STA SP + 1
+1d31 : a0 1c __ LDY #$1c
+1d33 : b1 23 __ LDA (SP + 0),y
+1d35 : 85 53 __ STA T0 + 0
+1d37 : c8 __ __ INY
+1d38 : b1 23 __ LDA (SP + 0),y
+1d3a : 85 54 __ STA T0 + 1
+1d3c : 10 25 __ BPL $1d63
+1d3e : 18 __ __ CLC
+1d3f : a5 23 __ LDA SP + 0
+1d41 : 69 06 __ ADC #$06
+1d43 : 85 23 __ STA SP + 0
+1d45 : a5 24 __ LDA SP + 1
+1d47 : 69 00 __ ADC #$00
+1d49 : 85 24 __ STA SP + 1
+1d4b : a0 03 __ LDY #$03
+1d4d : b1 23 __ LDA (SP + 0),y
+1d4f : 99 53 00 STA $0053,y 
+1d52 : 88 __ __ DEY
+1d53 : 10 f8 __ BPL $1d4d
+1d55 : 18 __ __ CLC
+1d56 : a5 23 __ LDA SP + 0
+1d58 : 69 12 __ ADC #$12
+1d5a : 85 23 __ STA SP + 0
+1d5c : a5 24 __ LDA SP + 1
+1d5e : 69 00 __ ADC #$00
+1d60 : 85 24 __ STA SP + 1
+1d62 : 60 __ __ RTS
+1d63 : d0 06 __ BNE $1d6b
+1d65 : a9 01 __ LDA #$01
+1d67 : c5 53 __ CMP T0 + 0
+1d69 : b0 d3 __ BCS $1d3e
+1d6b : 18 __ __ CLC
+1d6c : a5 23 __ LDA SP + 0
+1d6e : 69 0a __ ADC #$0a
+1d70 : 85 55 __ STA T2 + 0
+1d72 : a5 24 __ LDA SP + 1
+1d74 : 69 00 __ ADC #$00
+1d76 : 85 56 __ STA T2 + 1
+1d78 : a0 1a __ LDY #$1a
+1d7a : b1 23 __ LDA (SP + 0),y
+1d7c : 85 44 __ STA T3 + 0
+1d7e : c8 __ __ INY
+1d7f : b1 23 __ LDA (SP + 0),y
+1d81 : 85 45 __ STA T3 + 1
+1d83 : a0 0b __ LDY #$0b
+1d85 : b1 44 __ LDA (T3 + 0),y
+1d87 : 91 55 __ STA (T2 + 0),y
+1d89 : 88 __ __ DEY
+1d8a : 10 f9 __ BPL $1d85
+1d8c : a9 00 __ LDA #$00
+1d8e : 85 55 __ STA T2 + 0
+1d90 : 85 56 __ STA T2 + 1
+1d92 : a5 54 __ LDA T0 + 1
+1d94 : 30 03 __ BMI $1d99
+1d96 : 4c 5b 1e JMP $1e5b ; (qsort + 334)
+1d99 : a0 1a __ LDY #$1a
+1d9b : b1 23 __ LDA (SP + 0),y
+1d9d : 85 53 __ STA T0 + 0
+1d9f : c8 __ __ INY
+1da0 : b1 23 __ LDA (SP + 0),y
+1da2 : 85 54 __ STA T0 + 1
+1da4 : a5 55 __ LDA T2 + 0
+1da6 : 0a __ __ ASL
+1da7 : aa __ __ TAX
+1da8 : a5 56 __ LDA T2 + 1
+1daa : 2a __ __ ROL
+1dab : a8 __ __ TAY
+1dac : 18 __ __ CLC
+1dad : 8a __ __ TXA
+1dae : 65 55 __ ADC T2 + 0
+1db0 : 85 1b __ STA ACCU + 0
+1db2 : 98 __ __ TYA
+1db3 : 65 56 __ ADC T2 + 1
+1db5 : 06 1b __ ASL ACCU + 0
+1db7 : 2a __ __ ROL
+1db8 : 06 1b __ ASL ACCU + 0
+1dba : 2a __ __ ROL
+1dbb : 85 1c __ STA ACCU + 1
+1dbd : 18 __ __ CLC
+1dbe : a5 53 __ LDA T0 + 0
+1dc0 : 65 1b __ ADC ACCU + 0
+1dc2 : 85 44 __ STA T3 + 0
+1dc4 : a5 54 __ LDA T0 + 1
+1dc6 : 65 1c __ ADC ACCU + 1
+1dc8 : 85 45 __ STA T3 + 1
+1dca : 18 __ __ CLC
+1dcb : a5 23 __ LDA SP + 0
+1dcd : 69 0a __ ADC #$0a
+1dcf : 85 46 __ STA T4 + 0
+1dd1 : a5 24 __ LDA SP + 1
+1dd3 : 69 00 __ ADC #$00
+1dd5 : 85 47 __ STA T4 + 1
+1dd7 : a0 0b __ LDY #$0b
+1dd9 : b1 46 __ LDA (T4 + 0),y
+1ddb : 91 44 __ STA (T3 + 0),y
+1ddd : 88 __ __ DEY
+1dde : 10 f9 __ BPL $1dd9
+1de0 : a5 53 __ LDA T0 + 0
+1de2 : a0 02 __ LDY #$02
+1de4 : 91 23 __ STA (SP + 0),y
+1de6 : a5 54 __ LDA T0 + 1
+1de8 : c8 __ __ INY
+1de9 : 91 23 __ STA (SP + 0),y
+1deb : a5 55 __ LDA T2 + 0
+1ded : c8 __ __ INY
+1dee : 91 23 __ STA (SP + 0),y
+1df0 : a5 56 __ LDA T2 + 1
+1df2 : c8 __ __ INY
+1df3 : 91 23 __ STA (SP + 0),y
+1df5 : 20 0d 1d JSR $1d0d ; (qsort + 0)
+1df8 : a0 1a __ LDY #$1a
+1dfa : b1 23 __ LDA (SP + 0),y
+1dfc : 85 53 __ STA T0 + 0
+1dfe : c8 __ __ INY
+1dff : b1 23 __ LDA (SP + 0),y
+1e01 : 85 54 __ STA T0 + 1
+1e03 : a5 55 __ LDA T2 + 0
+1e05 : 0a __ __ ASL
+1e06 : aa __ __ TAX
+1e07 : a5 56 __ LDA T2 + 1
+1e09 : 2a __ __ ROL
+1e0a : a8 __ __ TAY
+1e0b : 18 __ __ CLC
+1e0c : 8a __ __ TXA
+1e0d : 65 55 __ ADC T2 + 0
+1e0f : 85 1b __ STA ACCU + 0
+1e11 : 98 __ __ TYA
+1e12 : 65 56 __ ADC T2 + 1
+1e14 : 06 1b __ ASL ACCU + 0
+1e16 : 2a __ __ ROL
+1e17 : 06 1b __ ASL ACCU + 0
+1e19 : 2a __ __ ROL
+1e1a : 85 1c __ STA ACCU + 1
+1e1c : 18 __ __ CLC
+1e1d : a5 53 __ LDA T0 + 0
+1e1f : 65 1b __ ADC ACCU + 0
+1e21 : aa __ __ TAX
+1e22 : a5 54 __ LDA T0 + 1
+1e24 : 65 1c __ ADC ACCU + 1
+1e26 : 85 54 __ STA T0 + 1
+1e28 : 18 __ __ CLC
+1e29 : 8a __ __ TXA
+1e2a : 69 0c __ ADC #$0c
+1e2c : a0 02 __ LDY #$02
+1e2e : 91 23 __ STA (SP + 0),y
+1e30 : a5 54 __ LDA T0 + 1
+1e32 : 69 00 __ ADC #$00
+1e34 : c8 __ __ INY
+1e35 : 91 23 __ STA (SP + 0),y
+1e37 : a0 1c __ LDY #$1c
+1e39 : b1 23 __ LDA (SP + 0),y
+1e3b : 38 __ __ SEC
+1e3c : e5 55 __ SBC T2 + 0
+1e3e : aa __ __ TAX
+1e3f : c8 __ __ INY
+1e40 : b1 23 __ LDA (SP + 0),y
+1e42 : e5 56 __ SBC T2 + 1
+1e44 : 85 54 __ STA T0 + 1
+1e46 : 38 __ __ SEC
+1e47 : 8a __ __ TXA
+1e48 : e9 01 __ SBC #$01
+1e4a : a0 04 __ LDY #$04
+1e4c : 91 23 __ STA (SP + 0),y
+1e4e : a5 54 __ LDA T0 + 1
+1e50 : e9 00 __ SBC #$00
+1e52 : c8 __ __ INY
+1e53 : 91 23 __ STA (SP + 0),y
+1e55 : 20 0d 1d JSR $1d0d ; (qsort + 0)
+1e58 : 4c 3e 1d JMP $1d3e ; (qsort + 49)
+1e5b : d0 09 __ BNE $1e66
+1e5d : a9 01 __ LDA #$01
+1e5f : c5 53 __ CMP T0 + 0
+1e61 : 90 03 __ BCC $1e66
+1e63 : 4c 99 1d JMP $1d99 ; (qsort + 140)
+1e66 : a9 01 __ LDA #$01
+1e68 : 85 53 __ STA T0 + 0
+1e6a : a9 00 __ LDA #$00
+1e6c : 85 54 __ STA T0 + 1
+1e6e : a0 1a __ LDY #$1a
+1e70 : b1 23 __ LDA (SP + 0),y
+1e72 : 85 44 __ STA T3 + 0
+1e74 : c8 __ __ INY
+1e75 : b1 23 __ LDA (SP + 0),y
+1e77 : 85 45 __ STA T3 + 1
+1e79 : a5 53 __ LDA T0 + 0
+1e7b : 0a __ __ ASL
+1e7c : aa __ __ TAX
+1e7d : a5 54 __ LDA T0 + 1
+1e7f : 2a __ __ ROL
+1e80 : a8 __ __ TAY
+1e81 : 18 __ __ CLC
+1e82 : 8a __ __ TXA
+1e83 : 65 53 __ ADC T0 + 0
+1e85 : 85 1b __ STA ACCU + 0
+1e87 : 98 __ __ TYA
+1e88 : 65 54 __ ADC T0 + 1
+1e8a : 06 1b __ ASL ACCU + 0
+1e8c : 2a __ __ ROL
+1e8d : 06 1b __ ASL ACCU + 0
+1e8f : 2a __ __ ROL
+1e90 : 85 1c __ STA ACCU + 1
+1e92 : 18 __ __ CLC
+1e93 : a5 44 __ LDA T3 + 0
+1e95 : 65 1b __ ADC ACCU + 0
+1e97 : aa __ __ TAX
+1e98 : a5 45 __ LDA T3 + 1
+1e9a : 65 1c __ ADC ACCU + 1
+1e9c : a8 __ __ TAY
+1e9d : 18 __ __ CLC
+1e9e : 8a __ __ TXA
+1e9f : 69 02 __ ADC #$02
+1ea1 : 85 0d __ STA P0
+1ea3 : 98 __ __ TYA
+1ea4 : 69 00 __ ADC #$00
+1ea6 : 85 0e __ STA P1
+1ea8 : 18 __ __ CLC
+1ea9 : a5 23 __ LDA SP + 0
+1eab : 69 0c __ ADC #$0c
+1ead : 85 0f __ STA P2
+1eaf : a5 24 __ LDA SP + 1
+1eb1 : 69 00 __ ADC #$00
+1eb3 : 85 10 __ STA P3
+1eb5 : 20 60 1f JSR $1f60 ; (strcmp + 0)
+1eb8 : a5 1c __ LDA ACCU + 1
+1eba : 30 24 __ BMI $1ee0
+1ebc : a0 1c __ LDY #$1c
+1ebe : b1 23 __ LDA (SP + 0),y
+1ec0 : 85 44 __ STA T3 + 0
+1ec2 : c8 __ __ INY
+1ec3 : b1 23 __ LDA (SP + 0),y
+1ec5 : e6 53 __ INC T0 + 0
+1ec7 : d0 02 __ BNE $1ecb
+1ec9 : e6 54 __ INC T0 + 1
+1ecb : 49 80 __ EOR #$80
+1ecd : 85 03 __ STA $03
+1ecf : a5 54 __ LDA T0 + 1
+1ed1 : 49 80 __ EOR #$80
+1ed3 : c5 03 __ CMP $03
+1ed5 : d0 04 __ BNE $1edb
+1ed7 : a5 53 __ LDA T0 + 0
+1ed9 : c5 44 __ CMP T3 + 0
+1edb : 90 91 __ BCC $1e6e
+1edd : 4c 99 1d JMP $1d99 ; (qsort + 140)
+1ee0 : a0 1a __ LDY #$1a
+1ee2 : b1 23 __ LDA (SP + 0),y
+1ee4 : 85 44 __ STA T3 + 0
+1ee6 : c8 __ __ INY
+1ee7 : b1 23 __ LDA (SP + 0),y
+1ee9 : 85 45 __ STA T3 + 1
+1eeb : a5 55 __ LDA T2 + 0
+1eed : 0a __ __ ASL
+1eee : aa __ __ TAX
+1eef : a5 56 __ LDA T2 + 1
+1ef1 : 2a __ __ ROL
+1ef2 : a8 __ __ TAY
+1ef3 : 18 __ __ CLC
+1ef4 : 8a __ __ TXA
+1ef5 : 65 55 __ ADC T2 + 0
+1ef7 : 85 1b __ STA ACCU + 0
+1ef9 : 98 __ __ TYA
+1efa : 65 56 __ ADC T2 + 1
+1efc : 06 1b __ ASL ACCU + 0
+1efe : 2a __ __ ROL
+1eff : 06 1b __ ASL ACCU + 0
+1f01 : 2a __ __ ROL
+1f02 : 85 1c __ STA ACCU + 1
+1f04 : 18 __ __ CLC
+1f05 : a5 44 __ LDA T3 + 0
+1f07 : 65 1b __ ADC ACCU + 0
+1f09 : 85 46 __ STA T4 + 0
+1f0b : a5 45 __ LDA T3 + 1
+1f0d : 65 1c __ ADC ACCU + 1
+1f0f : 85 47 __ STA T4 + 1
+1f11 : a5 53 __ LDA T0 + 0
+1f13 : 0a __ __ ASL
+1f14 : aa __ __ TAX
+1f15 : a5 54 __ LDA T0 + 1
+1f17 : 2a __ __ ROL
+1f18 : a8 __ __ TAY
+1f19 : 18 __ __ CLC
+1f1a : 8a __ __ TXA
+1f1b : 65 53 __ ADC T0 + 0
+1f1d : 85 1b __ STA ACCU + 0
+1f1f : 98 __ __ TYA
+1f20 : 65 54 __ ADC T0 + 1
+1f22 : 06 1b __ ASL ACCU + 0
+1f24 : 2a __ __ ROL
+1f25 : 06 1b __ ASL ACCU + 0
+1f27 : 2a __ __ ROL
+1f28 : 85 1c __ STA ACCU + 1
+1f2a : 18 __ __ CLC
+1f2b : a5 44 __ LDA T3 + 0
+1f2d : 65 1b __ ADC ACCU + 0
+1f2f : 85 44 __ STA T3 + 0
+1f31 : a5 45 __ LDA T3 + 1
+1f33 : 65 1c __ ADC ACCU + 1
+1f35 : 85 45 __ STA T3 + 1
+1f37 : a0 0b __ LDY #$0b
+1f39 : b1 44 __ LDA (T3 + 0),y
+1f3b : 91 46 __ STA (T4 + 0),y
+1f3d : 88 __ __ DEY
+1f3e : 10 f9 __ BPL $1f39
+1f40 : 18 __ __ CLC
+1f41 : a5 46 __ LDA T4 + 0
+1f43 : 69 0c __ ADC #$0c
+1f45 : 85 46 __ STA T4 + 0
+1f47 : 90 02 __ BCC $1f4b
+1f49 : e6 47 __ INC T4 + 1
+1f4b : a0 0b __ LDY #$0b
+1f4d : b1 46 __ LDA (T4 + 0),y
+1f4f : 91 44 __ STA (T3 + 0),y
+1f51 : 88 __ __ DEY
+1f52 : 10 f9 __ BPL $1f4d
+1f54 : e6 55 __ INC T2 + 0
+1f56 : f0 03 __ BEQ $1f5b
+1f58 : 4c bc 1e JMP $1ebc ; (qsort + 431)
+1f5b : e6 56 __ INC T2 + 1
+1f5d : 4c bc 1e JMP $1ebc ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+1f60 : a0 00 __ LDY #$00
+1f62 : 84 1c __ STY ACCU + 1
+1f64 : b1 0d __ LDA (P0),y
+1f66 : f0 16 __ BEQ $1f7e
+1f68 : d1 0f __ CMP (P2),y
+1f6a : d0 16 __ BNE $1f82
+1f6c : c8 __ __ INY
+1f6d : b1 0d __ LDA (P0),y
+1f6f : f0 0d __ BEQ $1f7e
+1f71 : d1 0f __ CMP (P2),y
+1f73 : d0 0d __ BNE $1f82
+1f75 : c8 __ __ INY
+1f76 : d0 ec __ BNE $1f64
+1f78 : e6 0e __ INC P1
+1f7a : e6 10 __ INC P3
+1f7c : d0 e6 __ BNE $1f64
+1f7e : d1 0f __ CMP (P2),y
+1f80 : f0 0a __ BEQ $1f8c
+1f82 : b0 06 __ BCS $1f8a
+1f84 : a9 ff __ LDA #$ff
+1f86 : 85 1c __ STA ACCU + 1
+1f88 : 30 02 __ BMI $1f8c
+1f8a : a9 01 __ LDA #$01
+1f8c : 85 1b __ STA ACCU + 0
+1f8e : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1f8f : a5 0d __ LDA P0
+1f91 : 85 1b __ STA ACCU + 0
+1f93 : a5 0e __ LDA P1
+1f95 : 85 1c __ STA ACCU + 1
+1f97 : ae f7 23 LDX $23f7 ; (spentry + 0)
+1f9a : 9a __ __ TXS
+1f9b : a9 4c __ LDA #$4c
+1f9d : 85 54 __ STA $54
+1f9f : a9 00 __ LDA #$00
+1fa1 : 85 13 __ STA P6
+1fa3 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1fa4 : a9 4c __ LDA #$4c
+1fa6 : 85 54 __ STA $54
+1fa8 : a9 00 __ LDA #$00
+1faa : 85 13 __ STA P6
+1fac : a9 19 __ LDA #$19
+1fae : 85 16 __ STA P9
+1fb0 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1fb1 : b1 19 __ LDA (IP + 0),y
+1fb3 : c8 __ __ INY
+1fb4 : aa __ __ TAX
+1fb5 : b5 00 __ LDA $00,x
+1fb7 : 85 03 __ STA $03
+1fb9 : b5 01 __ LDA $01,x
+1fbb : 85 04 __ STA $04
+1fbd : b5 02 __ LDA $02,x
+1fbf : 85 05 __ STA $05
+1fc1 : b5 03 __ LDA $03,x
+1fc3 : 85 06 __ STA $06
+1fc5 : a5 05 __ LDA $05
+1fc7 : 0a __ __ ASL
+1fc8 : a5 06 __ LDA $06
+1fca : 2a __ __ ROL
+1fcb : 85 08 __ STA $08
+1fcd : f0 06 __ BEQ $1fd5
+1fcf : a5 05 __ LDA $05
+1fd1 : 09 80 __ ORA #$80
+1fd3 : 85 05 __ STA $05
+1fd5 : a5 1d __ LDA ACCU + 2
+1fd7 : 0a __ __ ASL
+1fd8 : a5 1e __ LDA ACCU + 3
+1fda : 2a __ __ ROL
+1fdb : 85 07 __ STA $07
+1fdd : f0 06 __ BEQ $1fe5
+1fdf : a5 1d __ LDA ACCU + 2
+1fe1 : 09 80 __ ORA #$80
+1fe3 : 85 1d __ STA ACCU + 2
+1fe5 : 60 __ __ RTS
+1fe6 : 06 1e __ ASL ACCU + 3
+1fe8 : a5 07 __ LDA $07
+1fea : 6a __ __ ROR
+1feb : 85 1e __ STA ACCU + 3
+1fed : b0 06 __ BCS $1ff5
+1fef : a5 1d __ LDA ACCU + 2
+1ff1 : 29 7f __ AND #$7f
+1ff3 : 85 1d __ STA ACCU + 2
+1ff5 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1ff6 : 38 __ __ SEC
+1ff7 : a5 07 __ LDA $07
+1ff9 : e5 08 __ SBC $08
+1ffb : f0 38 __ BEQ $2035
+1ffd : aa __ __ TAX
+1ffe : b0 25 __ BCS $2025
+2000 : e0 e9 __ CPX #$e9
+2002 : b0 0e __ BCS $2012
+2004 : a5 08 __ LDA $08
+2006 : 85 07 __ STA $07
+2008 : a9 00 __ LDA #$00
+200a : 85 1b __ STA ACCU + 0
+200c : 85 1c __ STA ACCU + 1
+200e : 85 1d __ STA ACCU + 2
+2010 : f0 23 __ BEQ $2035
+2012 : a5 1d __ LDA ACCU + 2
+2014 : 4a __ __ LSR
+2015 : 66 1c __ ROR ACCU + 1
+2017 : 66 1b __ ROR ACCU + 0
+2019 : e8 __ __ INX
+201a : d0 f8 __ BNE $2014
+201c : 85 1d __ STA ACCU + 2
+201e : a5 08 __ LDA $08
+2020 : 85 07 __ STA $07
+2022 : 4c 35 20 JMP $2035 ; (faddsub + 63)
+2025 : e0 18 __ CPX #$18
+2027 : b0 33 __ BCS $205c
+2029 : a5 05 __ LDA $05
+202b : 4a __ __ LSR
+202c : 66 04 __ ROR $04
+202e : 66 03 __ ROR $03
+2030 : ca __ __ DEX
+2031 : d0 f8 __ BNE $202b
+2033 : 85 05 __ STA $05
+2035 : a5 1e __ LDA ACCU + 3
+2037 : 29 80 __ AND #$80
+2039 : 85 1e __ STA ACCU + 3
+203b : 45 06 __ EOR $06
+203d : 30 2d __ BMI $206c
+203f : 18 __ __ CLC
+2040 : a5 1b __ LDA ACCU + 0
+2042 : 65 03 __ ADC $03
+2044 : 85 1b __ STA ACCU + 0
+2046 : a5 1c __ LDA ACCU + 1
+2048 : 65 04 __ ADC $04
+204a : 85 1c __ STA ACCU + 1
+204c : a5 1d __ LDA ACCU + 2
+204e : 65 05 __ ADC $05
+2050 : 85 1d __ STA ACCU + 2
+2052 : 90 08 __ BCC $205c
+2054 : 66 1d __ ROR ACCU + 2
+2056 : 66 1c __ ROR ACCU + 1
+2058 : 66 1b __ ROR ACCU + 0
+205a : e6 07 __ INC $07
+205c : a5 07 __ LDA $07
+205e : 4a __ __ LSR
+205f : 05 1e __ ORA ACCU + 3
+2061 : 85 1e __ STA ACCU + 3
+2063 : b0 06 __ BCS $206b
+2065 : a5 1d __ LDA ACCU + 2
+2067 : 29 7f __ AND #$7f
+2069 : 85 1d __ STA ACCU + 2
+206b : 60 __ __ RTS
+206c : 38 __ __ SEC
+206d : a5 1b __ LDA ACCU + 0
+206f : e5 03 __ SBC $03
+2071 : 85 1b __ STA ACCU + 0
+2073 : a5 1c __ LDA ACCU + 1
+2075 : e5 04 __ SBC $04
+2077 : 85 1c __ STA ACCU + 1
+2079 : a5 1d __ LDA ACCU + 2
+207b : e5 05 __ SBC $05
+207d : 85 1d __ STA ACCU + 2
+207f : b0 19 __ BCS $209a
+2081 : 38 __ __ SEC
+2082 : a9 00 __ LDA #$00
+2084 : e5 1b __ SBC ACCU + 0
+2086 : 85 1b __ STA ACCU + 0
+2088 : a9 00 __ LDA #$00
+208a : e5 1c __ SBC ACCU + 1
+208c : 85 1c __ STA ACCU + 1
+208e : a9 00 __ LDA #$00
+2090 : e5 1d __ SBC ACCU + 2
+2092 : 85 1d __ STA ACCU + 2
+2094 : a5 1e __ LDA ACCU + 3
+2096 : 49 80 __ EOR #$80
+2098 : 85 1e __ STA ACCU + 3
+209a : a5 1d __ LDA ACCU + 2
+209c : 30 be __ BMI $205c
+209e : 05 1c __ ORA ACCU + 1
+20a0 : 05 1b __ ORA ACCU + 0
+20a2 : f0 0f __ BEQ $20b3
+20a4 : c6 07 __ DEC $07
+20a6 : f0 0b __ BEQ $20b3
+20a8 : 06 1b __ ASL ACCU + 0
+20aa : 26 1c __ ROL ACCU + 1
+20ac : 26 1d __ ROL ACCU + 2
+20ae : 10 f4 __ BPL $20a4
+20b0 : 4c 5c 20 JMP $205c ; (faddsub + 102)
+20b3 : a9 00 __ LDA #$00
+20b5 : 85 1b __ STA ACCU + 0
+20b7 : 85 1c __ STA ACCU + 1
+20b9 : 85 1d __ STA ACCU + 2
+20bb : 85 1e __ STA ACCU + 3
+20bd : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+20be : a5 1b __ LDA ACCU + 0
+20c0 : 05 1c __ ORA ACCU + 1
+20c2 : 05 1d __ ORA ACCU + 2
+20c4 : d0 03 __ BNE $20c9
+20c6 : 85 1e __ STA ACCU + 3
+20c8 : 60 __ __ RTS
+20c9 : a5 03 __ LDA $03
+20cb : 05 04 __ ORA $04
+20cd : 05 05 __ ORA $05
+20cf : d0 09 __ BNE $20da
+20d1 : 85 1b __ STA ACCU + 0
+20d3 : 85 1c __ STA ACCU + 1
+20d5 : 85 1d __ STA ACCU + 2
+20d7 : 85 1e __ STA ACCU + 3
+20d9 : 60 __ __ RTS
+20da : a9 00 __ LDA #$00
+20dc : 85 09 __ STA $09
+20de : 85 0a __ STA $0a
+20e0 : 85 0b __ STA $0b
+20e2 : a4 1b __ LDY ACCU + 0
+20e4 : a5 03 __ LDA $03
+20e6 : d0 06 __ BNE $20ee
+20e8 : a5 04 __ LDA $04
+20ea : f0 0a __ BEQ $20f6
+20ec : d0 05 __ BNE $20f3
+20ee : 20 2e 21 JSR $212e ; (fmul8 + 0)
+20f1 : a5 04 __ LDA $04
+20f3 : 20 2e 21 JSR $212e ; (fmul8 + 0)
+20f6 : a5 05 __ LDA $05
+20f8 : 20 2e 21 JSR $212e ; (fmul8 + 0)
+20fb : 38 __ __ SEC
+20fc : a5 0b __ LDA $0b
+20fe : 30 06 __ BMI $2106
+2100 : 06 09 __ ASL $09
+2102 : 26 0a __ ROL $0a
+2104 : 2a __ __ ROL
+2105 : 18 __ __ CLC
+2106 : 29 7f __ AND #$7f
+2108 : 85 0b __ STA $0b
+210a : a5 1e __ LDA ACCU + 3
+210c : 45 06 __ EOR $06
+210e : 29 80 __ AND #$80
+2110 : 85 1e __ STA ACCU + 3
+2112 : a5 07 __ LDA $07
+2114 : e9 7e __ SBC #$7e
+2116 : 18 __ __ CLC
+2117 : 65 08 __ ADC $08
+2119 : 4a __ __ LSR
+211a : 05 1e __ ORA ACCU + 3
+211c : 85 1e __ STA ACCU + 3
+211e : a9 00 __ LDA #$00
+2120 : 6a __ __ ROR
+2121 : 05 0b __ ORA $0b
+2123 : 85 1d __ STA ACCU + 2
+2125 : a5 0a __ LDA $0a
+2127 : 85 1c __ STA ACCU + 1
+2129 : a5 09 __ LDA $09
+212b : 85 1b __ STA ACCU + 0
+212d : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+212e : 38 __ __ SEC
+212f : 6a __ __ ROR
+2130 : 90 1e __ BCC $2150
+2132 : aa __ __ TAX
+2133 : 18 __ __ CLC
+2134 : 98 __ __ TYA
+2135 : 65 09 __ ADC $09
+2137 : 85 09 __ STA $09
+2139 : a5 0a __ LDA $0a
+213b : 65 1c __ ADC ACCU + 1
+213d : 85 0a __ STA $0a
+213f : a5 0b __ LDA $0b
+2141 : 65 1d __ ADC ACCU + 2
+2143 : 6a __ __ ROR
+2144 : 85 0b __ STA $0b
+2146 : 8a __ __ TXA
+2147 : 66 0a __ ROR $0a
+2149 : 66 09 __ ROR $09
+214b : 4a __ __ LSR
+214c : f0 0d __ BEQ $215b
+214e : b0 e2 __ BCS $2132
+2150 : 66 0b __ ROR $0b
+2152 : 66 0a __ ROR $0a
+2154 : 66 09 __ ROR $09
+2156 : 4a __ __ LSR
+2157 : 90 f7 __ BCC $2150
+2159 : d0 d7 __ BNE $2132
+215b : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+215c : a5 1b __ LDA ACCU + 0
+215e : 05 1c __ ORA ACCU + 1
+2160 : 05 1d __ ORA ACCU + 2
+2162 : d0 03 __ BNE $2167
+2164 : 85 1e __ STA ACCU + 3
+2166 : 60 __ __ RTS
+2167 : a5 1e __ LDA ACCU + 3
+2169 : 45 06 __ EOR $06
+216b : 29 80 __ AND #$80
+216d : 85 1e __ STA ACCU + 3
+216f : a9 00 __ LDA #$00
+2171 : 85 09 __ STA $09
+2173 : 85 0a __ STA $0a
+2175 : 85 0b __ STA $0b
+2177 : a2 18 __ LDX #$18
+2179 : a5 1b __ LDA ACCU + 0
+217b : c5 03 __ CMP $03
+217d : a5 1c __ LDA ACCU + 1
+217f : e5 04 __ SBC $04
+2181 : a5 1d __ LDA ACCU + 2
+2183 : e5 05 __ SBC $05
+2185 : 90 13 __ BCC $219a
+2187 : a5 1b __ LDA ACCU + 0
+2189 : e5 03 __ SBC $03
+218b : 85 1b __ STA ACCU + 0
+218d : a5 1c __ LDA ACCU + 1
+218f : e5 04 __ SBC $04
+2191 : 85 1c __ STA ACCU + 1
+2193 : a5 1d __ LDA ACCU + 2
+2195 : e5 05 __ SBC $05
+2197 : 85 1d __ STA ACCU + 2
+2199 : 38 __ __ SEC
+219a : 26 09 __ ROL $09
+219c : 26 0a __ ROL $0a
+219e : 26 0b __ ROL $0b
+21a0 : ca __ __ DEX
+21a1 : f0 0a __ BEQ $21ad
+21a3 : 06 1b __ ASL ACCU + 0
+21a5 : 26 1c __ ROL ACCU + 1
+21a7 : 26 1d __ ROL ACCU + 2
+21a9 : b0 dc __ BCS $2187
+21ab : 90 cc __ BCC $2179
+21ad : 38 __ __ SEC
+21ae : a5 0b __ LDA $0b
+21b0 : 30 06 __ BMI $21b8
+21b2 : 06 09 __ ASL $09
+21b4 : 26 0a __ ROL $0a
+21b6 : 2a __ __ ROL
+21b7 : 18 __ __ CLC
+21b8 : 29 7f __ AND #$7f
+21ba : 85 0b __ STA $0b
+21bc : a5 08 __ LDA $08
+21be : 49 7f __ EOR #$7f
+21c0 : 65 07 __ ADC $07
+21c2 : 38 __ __ SEC
+21c3 : e9 01 __ SBC #$01
+21c5 : 4a __ __ LSR
+21c6 : 05 1e __ ORA ACCU + 3
+21c8 : 85 1e __ STA ACCU + 3
+21ca : a9 00 __ LDA #$00
+21cc : 6a __ __ ROR
+21cd : 05 0b __ ORA $0b
+21cf : 85 1d __ STA ACCU + 2
+21d1 : a5 0a __ LDA $0a
+21d3 : 85 1c __ STA ACCU + 1
+21d5 : a5 09 __ LDA $09
+21d7 : 85 1b __ STA ACCU + 0
+21d9 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+21da : 24 1c __ BIT ACCU + 1
+21dc : 10 0d __ BPL $21eb
+21de : 20 f8 21 JSR $21f8 ; (negaccu + 0)
+21e1 : 24 04 __ BIT $04
+21e3 : 10 0d __ BPL $21f2
+21e5 : 20 06 22 JSR $2206 ; (negtmp + 0)
+21e8 : 4c 14 22 JMP $2214 ; (divmod + 0)
+21eb : 24 04 __ BIT $04
+21ed : 10 f9 __ BPL $21e8
+21ef : 20 06 22 JSR $2206 ; (negtmp + 0)
+21f2 : 20 14 22 JSR $2214 ; (divmod + 0)
+21f5 : 4c f8 21 JMP $21f8 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+21f8 : 38 __ __ SEC
+21f9 : a9 00 __ LDA #$00
+21fb : e5 1b __ SBC ACCU + 0
+21fd : 85 1b __ STA ACCU + 0
+21ff : a9 00 __ LDA #$00
+2201 : e5 1c __ SBC ACCU + 1
+2203 : 85 1c __ STA ACCU + 1
+2205 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+2206 : 38 __ __ SEC
+2207 : a9 00 __ LDA #$00
+2209 : e5 03 __ SBC $03
+220b : 85 03 __ STA $03
+220d : a9 00 __ LDA #$00
+220f : e5 04 __ SBC $04
+2211 : 85 04 __ STA $04
+2213 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+2214 : a5 1c __ LDA ACCU + 1
+2216 : d0 31 __ BNE $2249
+2218 : a5 04 __ LDA $04
+221a : d0 1e __ BNE $223a
+221c : 85 06 __ STA $06
+221e : a2 04 __ LDX #$04
+2220 : 06 1b __ ASL ACCU + 0
+2222 : 2a __ __ ROL
+2223 : c5 03 __ CMP $03
+2225 : 90 02 __ BCC $2229
+2227 : e5 03 __ SBC $03
+2229 : 26 1b __ ROL ACCU + 0
+222b : 2a __ __ ROL
+222c : c5 03 __ CMP $03
+222e : 90 02 __ BCC $2232
+2230 : e5 03 __ SBC $03
+2232 : 26 1b __ ROL ACCU + 0
+2234 : ca __ __ DEX
+2235 : d0 eb __ BNE $2222
+2237 : 85 05 __ STA $05
+2239 : 60 __ __ RTS
+223a : a5 1b __ LDA ACCU + 0
+223c : 85 05 __ STA $05
+223e : a5 1c __ LDA ACCU + 1
+2240 : 85 06 __ STA $06
+2242 : a9 00 __ LDA #$00
+2244 : 85 1b __ STA ACCU + 0
+2246 : 85 1c __ STA ACCU + 1
+2248 : 60 __ __ RTS
+2249 : a5 04 __ LDA $04
+224b : d0 1f __ BNE $226c
+224d : a5 03 __ LDA $03
+224f : 30 1b __ BMI $226c
+2251 : a9 00 __ LDA #$00
+2253 : 85 06 __ STA $06
+2255 : a2 10 __ LDX #$10
+2257 : 06 1b __ ASL ACCU + 0
+2259 : 26 1c __ ROL ACCU + 1
+225b : 2a __ __ ROL
+225c : c5 03 __ CMP $03
+225e : 90 02 __ BCC $2262
+2260 : e5 03 __ SBC $03
+2262 : 26 1b __ ROL ACCU + 0
+2264 : 26 1c __ ROL ACCU + 1
+2266 : ca __ __ DEX
+2267 : d0 f2 __ BNE $225b
+2269 : 85 05 __ STA $05
+226b : 60 __ __ RTS
+226c : a9 00 __ LDA #$00
+226e : 85 05 __ STA $05
+2270 : 85 06 __ STA $06
+2272 : 84 02 __ STY $02
+2274 : a0 10 __ LDY #$10
+2276 : 18 __ __ CLC
+2277 : 26 1b __ ROL ACCU + 0
+2279 : 26 1c __ ROL ACCU + 1
+227b : 26 05 __ ROL $05
+227d : 26 06 __ ROL $06
+227f : 38 __ __ SEC
+2280 : a5 05 __ LDA $05
+2282 : e5 03 __ SBC $03
+2284 : aa __ __ TAX
+2285 : a5 06 __ LDA $06
+2287 : e5 04 __ SBC $04
+2289 : 90 04 __ BCC $228f
+228b : 86 05 __ STX $05
+228d : 85 06 __ STA $06
+228f : 88 __ __ DEY
+2290 : d0 e5 __ BNE $2277
+2292 : 26 1b __ ROL ACCU + 0
+2294 : 26 1c __ ROL ACCU + 1
+2296 : a4 02 __ LDY $02
+2298 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2299 : 24 1c __ BIT ACCU + 1
+229b : 10 0d __ BPL $22aa
+229d : 20 f8 21 JSR $21f8 ; (negaccu + 0)
+22a0 : 24 04 __ BIT $04
+22a2 : 10 0d __ BPL $22b1
+22a4 : 20 06 22 JSR $2206 ; (negtmp + 0)
+22a7 : 4c 14 22 JMP $2214 ; (divmod + 0)
+22aa : 24 04 __ BIT $04
+22ac : 10 f9 __ BPL $22a7
+22ae : 20 06 22 JSR $2206 ; (negtmp + 0)
+22b1 : 20 14 22 JSR $2214 ; (divmod + 0)
+22b4 : 38 __ __ SEC
+22b5 : a9 00 __ LDA #$00
+22b7 : e5 05 __ SBC $05
+22b9 : 85 05 __ STA $05
+22bb : a9 00 __ LDA #$00
+22bd : e5 06 __ SBC $06
+22bf : 85 06 __ STA $06
+22c1 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+22c2 : 20 d5 1f JSR $1fd5 ; (freg + 36)
+22c5 : a5 07 __ LDA $07
+22c7 : c9 7f __ CMP #$7f
+22c9 : b0 07 __ BCS $22d2
+22cb : a9 00 __ LDA #$00
+22cd : 85 1b __ STA ACCU + 0
+22cf : 85 1c __ STA ACCU + 1
+22d1 : 60 __ __ RTS
+22d2 : 38 __ __ SEC
+22d3 : e9 8e __ SBC #$8e
+22d5 : 90 0a __ BCC $22e1
+22d7 : a9 ff __ LDA #$ff
+22d9 : 85 1b __ STA ACCU + 0
+22db : a9 7f __ LDA #$7f
+22dd : 85 1c __ STA ACCU + 1
+22df : d0 08 __ BNE $22e9
+22e1 : aa __ __ TAX
+22e2 : 46 1d __ LSR ACCU + 2
+22e4 : 66 1c __ ROR ACCU + 1
+22e6 : e8 __ __ INX
+22e7 : d0 f9 __ BNE $22e2
+22e9 : 24 1e __ BIT ACCU + 3
+22eb : 10 0e __ BPL $22fb
+22ed : 38 __ __ SEC
+22ee : a9 00 __ LDA #$00
+22f0 : e5 1c __ SBC ACCU + 1
+22f2 : 85 1b __ STA ACCU + 0
+22f4 : a9 00 __ LDA #$00
+22f6 : e5 1d __ SBC ACCU + 2
+22f8 : 85 1c __ STA ACCU + 1
+22fa : 60 __ __ RTS
+22fb : a5 1c __ LDA ACCU + 1
+22fd : 85 1b __ STA ACCU + 0
+22ff : a5 1d __ LDA ACCU + 2
+2301 : 85 1c __ STA ACCU + 1
+2303 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2304 : 24 1c __ BIT ACCU + 1
+2306 : 30 03 __ BMI $230b
+2308 : 4c 22 23 JMP $2322 ; (uint16_to_float + 0)
+230b : 38 __ __ SEC
+230c : a9 00 __ LDA #$00
+230e : e5 1b __ SBC ACCU + 0
+2310 : 85 1b __ STA ACCU + 0
+2312 : a9 00 __ LDA #$00
+2314 : e5 1c __ SBC ACCU + 1
+2316 : 85 1c __ STA ACCU + 1
+2318 : 20 22 23 JSR $2322 ; (uint16_to_float + 0)
+231b : a5 1e __ LDA ACCU + 3
+231d : 09 80 __ ORA #$80
+231f : 85 1e __ STA ACCU + 3
+2321 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+2322 : a5 1b __ LDA ACCU + 0
+2324 : 05 1c __ ORA ACCU + 1
+2326 : d0 05 __ BNE $232d
+2328 : 85 1d __ STA ACCU + 2
+232a : 85 1e __ STA ACCU + 3
+232c : 60 __ __ RTS
+232d : a2 8e __ LDX #$8e
+232f : a5 1c __ LDA ACCU + 1
+2331 : 30 06 __ BMI $2339
+2333 : ca __ __ DEX
+2334 : 06 1b __ ASL ACCU + 0
+2336 : 2a __ __ ROL
+2337 : 10 fa __ BPL $2333
+2339 : 29 7f __ AND #$7f
+233b : 85 1d __ STA ACCU + 2
+233d : a5 1b __ LDA ACCU + 0
+233f : 85 1c __ STA ACCU + 1
+2341 : 8a __ __ TXA
+2342 : 4a __ __ LSR
+2343 : 85 1e __ STA ACCU + 3
+2345 : a9 00 __ LDA #$00
+2347 : 85 1b __ STA ACCU + 0
+2349 : 6a __ __ ROR
+234a : 05 1d __ ORA ACCU + 2
+234c : 85 1d __ STA ACCU + 2
+234e : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+234f : a5 1e __ LDA ACCU + 3
+2351 : 45 06 __ EOR $06
+2353 : 29 80 __ AND #$80
+2355 : f0 1e __ BEQ $2375
+2357 : a5 1e __ LDA ACCU + 3
+2359 : 29 7f __ AND #$7f
+235b : 05 1d __ ORA ACCU + 2
+235d : 05 1c __ ORA ACCU + 1
+235f : 05 1b __ ORA ACCU + 0
+2361 : d0 0c __ BNE $236f
+2363 : a5 06 __ LDA $06
+2365 : 29 7f __ AND #$7f
+2367 : 05 05 __ ORA $05
+2369 : 05 04 __ ORA $04
+236b : 05 03 __ ORA $03
+236d : f0 1e __ BEQ $238d
+236f : a5 1e __ LDA ACCU + 3
+2371 : 30 23 __ BMI $2396
+2373 : 10 28 __ BPL $239d
+2375 : a5 1e __ LDA ACCU + 3
+2377 : c5 06 __ CMP $06
+2379 : d0 15 __ BNE $2390
+237b : a5 1d __ LDA ACCU + 2
+237d : c5 05 __ CMP $05
+237f : d0 0f __ BNE $2390
+2381 : a5 1c __ LDA ACCU + 1
+2383 : c5 04 __ CMP $04
+2385 : d0 09 __ BNE $2390
+2387 : a5 1b __ LDA ACCU + 0
+2389 : c5 03 __ CMP $03
+238b : d0 03 __ BNE $2390
+238d : a9 00 __ LDA #$00
+238f : 60 __ __ RTS
+2390 : b0 07 __ BCS $2399
+2392 : 24 1e __ BIT ACCU + 3
+2394 : 30 07 __ BMI $239d
+2396 : a9 01 __ LDA #$01
+2398 : 60 __ __ RTS
+2399 : 24 1e __ BIT ACCU + 3
+239b : 30 f9 __ BMI $2396
+239d : a9 ff __ LDA #$ff
+239f : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+23a0 : 84 02 __ STY $02
+23a2 : a9 00 __ LDA #$00
+23a4 : 85 07 __ STA $07
+23a6 : 85 08 __ STA $08
+23a8 : 85 09 __ STA $09
+23aa : 85 0a __ STA $0a
+23ac : a0 20 __ LDY #$20
+23ae : 18 __ __ CLC
+23af : 26 1b __ ROL ACCU + 0
+23b1 : 26 1c __ ROL ACCU + 1
+23b3 : 26 1d __ ROL ACCU + 2
+23b5 : 26 1e __ ROL ACCU + 3
+23b7 : 26 07 __ ROL $07
+23b9 : 26 08 __ ROL $08
+23bb : 26 09 __ ROL $09
+23bd : 26 0a __ ROL $0a
+23bf : a5 07 __ LDA $07
+23c1 : c5 03 __ CMP $03
+23c3 : a5 08 __ LDA $08
+23c5 : e5 04 __ SBC $04
+23c7 : a5 09 __ LDA $09
+23c9 : e5 05 __ SBC $05
+23cb : a5 0a __ LDA $0a
+23cd : e5 06 __ SBC $06
+23cf : 90 18 __ BCC $23e9
+23d1 : a5 07 __ LDA $07
+23d3 : e5 03 __ SBC $03
+23d5 : 85 07 __ STA $07
+23d7 : a5 08 __ LDA $08
+23d9 : e5 04 __ SBC $04
+23db : 85 08 __ STA $08
+23dd : a5 09 __ LDA $09
+23df : e5 05 __ SBC $05
+23e1 : 85 09 __ STA $09
+23e3 : a5 0a __ LDA $0a
+23e5 : e5 06 __ SBC $06
+23e7 : 85 0a __ STA $0a
+23e9 : 88 __ __ DEY
+23ea : d0 c3 __ BNE $23af
+23ec : 26 1b __ ROL ACCU + 0
+23ee : 26 1c __ ROL ACCU + 1
+23f0 : 26 1d __ ROL ACCU + 2
+23f2 : 26 1e __ ROL ACCU + 3
+23f4 : a4 02 __ LDY $02
+23f6 : 60 __ __ RTS
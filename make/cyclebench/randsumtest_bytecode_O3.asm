@@ -0,0 +1,607 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e b5 0d STX $0db5 ; (spentry + 0)
+0811 : a9 b8 __ LDA #$b8
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0d __ LDA #$0d
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0d __ LDA #$0d
+081c : e9 0d __ SBC #$0d
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 b8 __ LDA #$b8
+0832 : e9 b8 __ SBC #$b8
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 2
+0a04:	PUSH	#$0002
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	MOV	T2, seed + 0
+0a14:	MOV	ACCU, T2
+0a16:	SHL	ACCU, #7
+0a18:	XOR	ACCU, T2
+0a1a:	MOV	T2, ACCU
+0a1c:	SHRU	ACCU, #9
+0a1e:	XOR	ACCU, T2
+0a20:	MOV	T2, ACCU
+0a22:	SHL	ACCU, #8
+0a24:	XOR	ACCU, T2
+0a26:	MOV	T2, ACCU
+0a28:	MOV	seed + 0, T2
+0a2c:	ADD	T1, #$0001
+0a30:	EXTRT	$00, inp_op_ext_u16 + 0
+0a34:	EXTRT	T0, inp_op_addr_32 + 0
+0a38:	MOVD	T0, ACCU
+0a3a:	MOV	ACCU, T1
+0a3c:	CMPU	ACCU, #$03E8
+0a3f:	BGT	$0A10
+0a41:	MOVD	ACCU, #$01eab02e
+0a47:	EXTRT	T0, inp_op_cmp_u32 + 0
+0a4b:	BEQ	$0A53
+0a4d:	MOV	P0, #-1
+0a50:	CALL	exit + 0
+0a53:	MOV	ACCU, #0
+0a56:	POP	#$0002
+0a59:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+0a5d:	ENTER	0, 2
+0a61:	JSR	$0a68
+0a64:	RETURN	0, 2
+--------------------------------------------------------------------
+0a68 : a5 0d __ LDA P0
+0a6a : 85 1b __ STA ACCU + 0
+0a6c : a5 0e __ LDA P1
+0a6e : 85 1c __ STA ACCU + 1
+0a70 : ae b5 0d LDX $0db5 ; (spentry + 0)
+0a73 : 9a __ __ TXS
+0a74 : a9 4c __ LDA #$4c
+0a76 : 85 54 __ STA $54
+0a78 : a9 00 __ LDA #$00
+0a7a : 85 13 __ STA P6
+0a7c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+0a7d : a9 00 __ LDA #$00
+0a7f : 85 1d __ STA ACCU + 2
+0a81 : 85 1e __ STA ACCU + 3
+0a83 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_addr_32:
+0a84 : 18 __ __ CLC
+0a85 : a5 1b __ LDA ACCU + 0
+0a87 : 75 00 __ ADC $00,x
+0a89 : 85 1b __ STA ACCU + 0
+0a8b : a5 1c __ LDA ACCU + 1
+0a8d : 75 01 __ ADC $01,x
+0a8f : 85 1c __ STA ACCU + 1
+0a91 : a5 1d __ LDA ACCU + 2
+0a93 : 75 02 __ ADC $02,x
+0a95 : 85 1d __ STA ACCU + 2
+0a97 : a5 1e __ LDA ACCU + 3
+0a99 : 75 03 __ ADC $03,x
+0a9b : 85 1e __ STA ACCU + 3
+0a9d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+0a9e : b5 03 __ LDA $03,x
+0aa0 : c5 1e __ CMP ACCU + 3
+0aa2 : d0 20 __ BNE $0ac4
+0aa4 : b5 02 __ LDA $02,x
+0aa6 : c5 1d __ CMP ACCU + 2
+0aa8 : d0 1a __ BNE $0ac4
+0aaa : b5 01 __ LDA $01,x
+0aac : c5 1c __ CMP ACCU + 1
+0aae : d0 14 __ BNE $0ac4
+0ab0 : b5 00 __ LDA $00,x
+0ab2 : c5 1b __ CMP ACCU + 0
+0ab4 : d0 0e __ BNE $0ac4
+0ab6 : a9 00 __ LDA #$00
+0ab8 : 85 1b __ STA ACCU + 0
+0aba : 85 1c __ STA ACCU + 1
+0abc : 60 __ __ RTS
+0abd : a9 ff __ LDA #$ff
+0abf : 85 1b __ STA ACCU + 0
+0ac1 : 85 1c __ STA ACCU + 1
+0ac3 : 60 __ __ RTS
+0ac4 : 90 f7 __ BCC $0abd
+0ac6 : a9 01 __ LDA #$01
+0ac8 : 85 1b __ STA ACCU + 0
+0aca : a9 00 __ LDA #$00
+0acc : 85 1c __ STA ACCU + 1
+0ace : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0acf : a9 4c __ LDA #$4c
+0ad1 : 85 54 __ STA $54
+0ad3 : a9 00 __ LDA #$00
+0ad5 : 85 13 __ STA P6
+0ad7 : a9 19 __ LDA #$19
+0ad9 : 85 16 __ STA P9
+0adb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0adc : b1 19 __ LDA (IP + 0),y
+0ade : aa __ __ TAX
+0adf : c8 __ __ INY
+0ae0 : b1 19 __ LDA (IP + 0),y
+0ae2 : 95 00 __ STA $00,x
+0ae4 : a9 00 __ LDA #$00
+0ae6 : 95 01 __ STA $01,x
+0ae8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+0aeb : b1 19 __ LDA (IP + 0),y
+0aed : aa __ __ TAX
+0aee : c8 __ __ INY
+0aef : b1 19 __ LDA (IP + 0),y
+0af1 : 95 00 __ STA $00,x
+0af3 : a9 ff __ LDA #$ff
+0af5 : 95 01 __ STA $01,x
+0af7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+0afa : b1 19 __ LDA (IP + 0),y
+0afc : aa __ __ TAX
+0afd : c8 __ __ INY
+0afe : b1 19 __ LDA (IP + 0),y
+0b00 : 95 00 __ STA $00,x
+0b02 : c8 __ __ INY
+0b03 : b1 19 __ LDA (IP + 0),y
+0b05 : 95 01 __ STA $01,x
+0b07 : c8 __ __ INY
+0b08 : b1 19 __ LDA (IP + 0),y
+0b0a : 95 02 __ STA $02,x
+0b0c : c8 __ __ INY
+0b0d : b1 19 __ LDA (IP + 0),y
+0b0f : 95 03 __ STA $03,x
+0b11 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0b14 : b1 19 __ LDA (IP + 0),y
+0b16 : aa __ __ TAX
+0b17 : b5 00 __ LDA $00,x
+0b19 : 85 1b __ STA ACCU + 0
+0b1b : b5 01 __ LDA $01,x
+0b1d : 85 1c __ STA ACCU + 1
+0b1f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0b22 : b1 19 __ LDA (IP + 0),y
+0b24 : aa __ __ TAX
+0b25 : a5 1b __ LDA ACCU + 0
+0b27 : 95 00 __ STA $00,x
+0b29 : a5 1c __ LDA ACCU + 1
+0b2b : 95 01 __ STA $01,x
+0b2d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+0b30 : b1 19 __ LDA (IP + 0),y
+0b32 : aa __ __ TAX
+0b33 : a5 1b __ LDA ACCU + 0
+0b35 : 95 00 __ STA $00,x
+0b37 : a5 1c __ LDA ACCU + 1
+0b39 : 95 01 __ STA $01,x
+0b3b : a5 1d __ LDA ACCU + 2
+0b3d : 95 02 __ STA $02,x
+0b3f : a5 1e __ LDA ACCU + 3
+0b41 : 95 03 __ STA $03,x
+0b43 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0b46 : b1 19 __ LDA (IP + 0),y
+0b48 : 85 1f __ STA ADDR + 0
+0b4a : c8 __ __ INY
+0b4b : b1 19 __ LDA (IP + 0),y
+0b4d : 85 20 __ STA ADDR + 1
+0b4f : c8 __ __ INY
+0b50 : b1 19 __ LDA (IP + 0),y
+0b52 : aa __ __ TAX
+0b53 : 84 02 __ STY $02
+0b55 : a0 00 __ LDY #$00
+0b57 : b1 1f __ LDA (ADDR + 0),y
+0b59 : 95 00 __ STA $00,x
+0b5b : c8 __ __ INY
+0b5c : b1 1f __ LDA (ADDR + 0),y
+0b5e : 95 01 __ STA $01,x
+0b60 : a4 02 __ LDY $02
+0b62 : 4c 50 08 JMP $0850 ; (startup + 79)
+0b65 : b1 19 __ LDA (IP + 0),y
+0b67 : aa __ __ TAX
+0b68 : c8 __ __ INY
+0b69 : b1 19 __ LDA (IP + 0),y
+0b6b : 84 02 __ STY $02
+0b6d : a8 __ __ TAY
+0b6e : 4c 57 0b JMP $0b57 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+0b71 : b1 19 __ LDA (IP + 0),y
+0b73 : 85 1f __ STA ADDR + 0
+0b75 : c8 __ __ INY
+0b76 : b1 19 __ LDA (IP + 0),y
+0b78 : 85 20 __ STA ADDR + 1
+0b7a : c8 __ __ INY
+0b7b : b1 19 __ LDA (IP + 0),y
+0b7d : aa __ __ TAX
+0b7e : 84 02 __ STY $02
+0b80 : a0 00 __ LDY #$00
+0b82 : b5 00 __ LDA $00,x
+0b84 : 91 1f __ STA (ADDR + 0),y
+0b86 : c8 __ __ INY
+0b87 : b5 01 __ LDA $01,x
+0b89 : 91 1f __ STA (ADDR + 0),y
+0b8b : a4 02 __ LDY $02
+0b8d : 4c 50 08 JMP $0850 ; (startup + 79)
+0b90 : b1 19 __ LDA (IP + 0),y
+0b92 : aa __ __ TAX
+0b93 : c8 __ __ INY
+0b94 : b1 19 __ LDA (IP + 0),y
+0b96 : 84 02 __ STY $02
+0b98 : a8 __ __ TAY
+0b99 : 4c 82 0b JMP $0b82 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+0b9c : b1 19 __ LDA (IP + 0),y
+0b9e : aa __ __ TAX
+0b9f : a5 1b __ LDA ACCU + 0
+0ba1 : 55 00 __ EOR $00,x
+0ba3 : 85 1b __ STA ACCU + 0
+0ba5 : a5 1c __ LDA ACCU + 1
+0ba7 : 55 01 __ EOR $01,x
+0ba9 : 85 1c __ STA ACCU + 1
+0bab : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0bae : b1 19 __ LDA (IP + 0),y
+0bb0 : c8 __ __ INY
+0bb1 : aa __ __ TAX
+0bb2 : 18 __ __ CLC
+0bb3 : b5 00 __ LDA $00,x
+0bb5 : 71 19 __ ADC (IP + 0),y
+0bb7 : c8 __ __ INY
+0bb8 : 95 00 __ STA $00,x
+0bba : b5 01 __ LDA $01,x
+0bbc : 71 19 __ ADC (IP + 0),y
+0bbe : 95 01 __ STA $01,x
+0bc0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0bc3 : b1 19 __ LDA (IP + 0),y
+0bc5 : aa __ __ TAX
+0bc6 : b5 00 __ LDA $00,x
+0bc8 : 2c b1 19 BIT $19b1 
+0bcb : 29 0f __ AND #$0f
+0bcd : f0 0b __ BEQ $0bda
+0bcf : aa __ __ TAX
+0bd0 : a5 1c __ LDA ACCU + 1
+0bd2 : 06 1b __ ASL ACCU + 0
+0bd4 : 2a __ __ ROL
+0bd5 : ca __ __ DEX
+0bd6 : d0 fa __ BNE $0bd2
+0bd8 : 85 1c __ STA ACCU + 1
+0bda : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+0bdd : b1 19 __ LDA (IP + 0),y
+0bdf : aa __ __ TAX
+0be0 : b5 00 __ LDA $00,x
+0be2 : 2c b1 19 BIT $19b1 
+0be5 : 29 0f __ AND #$0f
+0be7 : f0 0b __ BEQ $0bf4
+0be9 : aa __ __ TAX
+0bea : a5 1c __ LDA ACCU + 1
+0bec : 4a __ __ LSR
+0bed : 66 1b __ ROR ACCU + 0
+0bef : ca __ __ DEX
+0bf0 : d0 fa __ BNE $0bec
+0bf2 : 85 1c __ STA ACCU + 1
+0bf4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0bf7 : b1 19 __ LDA (IP + 0),y
+0bf9 : aa __ __ TAX
+0bfa : 38 __ __ SEC
+0bfb : b5 01 __ LDA $01,x
+0bfd : e5 1c __ SBC ACCU + 1
+0bff : f0 11 __ BEQ $0c12
+0c01 : 50 02 __ BVC $0c05
+0c03 : 49 80 __ EOR #$80
+0c05 : 30 2a __ BMI $0c31
+0c07 : 10 33 __ BPL $0c3c
+0c09 : b1 19 __ LDA (IP + 0),y
+0c0b : aa __ __ TAX
+0c0c : b5 01 __ LDA $01,x
+0c0e : c5 1c __ CMP ACCU + 1
+0c10 : d0 28 __ BNE $0c3a
+0c12 : b5 00 __ LDA $00,x
+0c14 : c5 1b __ CMP ACCU + 0
+0c16 : d0 22 __ BNE $0c3a
+0c18 : f0 0e __ BEQ $0c28
+0c1a : b1 19 __ LDA (IP + 0),y
+0c1c : aa __ __ TAX
+0c1d : c8 __ __ INY
+0c1e : b1 19 __ LDA (IP + 0),y
+0c20 : c5 1c __ CMP ACCU + 1
+0c22 : d0 16 __ BNE $0c3a
+0c24 : e4 1b __ CPX ACCU + 0
+0c26 : d0 12 __ BNE $0c3a
+0c28 : a9 00 __ LDA #$00
+0c2a : 85 1b __ STA ACCU + 0
+0c2c : 85 1c __ STA ACCU + 1
+0c2e : 4c 50 08 JMP $0850 ; (startup + 79)
+0c31 : a9 ff __ LDA #$ff
+0c33 : 85 1b __ STA ACCU + 0
+0c35 : 85 1c __ STA ACCU + 1
+0c37 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c3a : 90 f5 __ BCC $0c31
+0c3c : a9 01 __ LDA #$01
+0c3e : 85 1b __ STA ACCU + 0
+0c40 : a9 00 __ LDA #$00
+0c42 : 85 1c __ STA ACCU + 1
+0c44 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c47 : b1 19 __ LDA (IP + 0),y
+0c49 : c8 __ __ INY
+0c4a : aa __ __ TAX
+0c4b : b1 19 __ LDA (IP + 0),y
+0c4d : 38 __ __ SEC
+0c4e : e5 1c __ SBC ACCU + 1
+0c50 : d0 af __ BNE $0c01
+0c52 : e4 1b __ CPX ACCU + 0
+0c54 : d0 e4 __ BNE $0c3a
+0c56 : f0 d0 __ BEQ $0c28
+0c58 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+0c59 : b1 19 __ LDA (IP + 0),y
+0c5b : 30 0c __ BMI $0c69
+0c5d : 38 __ __ SEC
+0c5e : 65 19 __ ADC IP + 0
+0c60 : 85 19 __ STA IP + 0
+0c62 : 90 02 __ BCC $0c66
+0c64 : e6 1a __ INC IP + 1
+0c66 : 4c 51 08 JMP $0851 ; (startup + 80)
+0c69 : 38 __ __ SEC
+0c6a : 65 19 __ ADC IP + 0
+0c6c : 85 19 __ STA IP + 0
+0c6e : b0 02 __ BCS $0c72
+0c70 : c6 1a __ DEC IP + 1
+0c72 : 4c 51 08 JMP $0851 ; (startup + 80)
+0c75 : a5 1b __ LDA ACCU + 0
+0c77 : 05 1c __ ORA ACCU + 1
+0c79 : f0 de __ BEQ $0c59
+0c7b : 4c 50 08 JMP $0850 ; (startup + 79)
+0c7e : a5 1b __ LDA ACCU + 0
+0c80 : 05 1c __ ORA ACCU + 1
+0c82 : d0 d5 __ BNE $0c59
+0c84 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c87 : a5 1c __ LDA ACCU + 1
+0c89 : 30 04 __ BMI $0c8f
+0c8b : 05 1b __ ORA ACCU + 0
+0c8d : d0 ca __ BNE $0c59
+0c8f : 4c 50 08 JMP $0850 ; (startup + 79)
+0c92 : a5 1c __ LDA ACCU + 1
+0c94 : 10 c3 __ BPL $0c59
+0c96 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c99 : a5 1c __ LDA ACCU + 1
+0c9b : 30 bc __ BMI $0c59
+0c9d : 4c 50 08 JMP $0850 ; (startup + 79)
+0ca0 : a5 1c __ LDA ACCU + 1
+0ca2 : 30 b5 __ BMI $0c59
+0ca4 : 05 1b __ ORA ACCU + 0
+0ca6 : f0 b1 __ BEQ $0c59
+0ca8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+0cab : b1 19 __ LDA (IP + 0),y
+0cad : 8d c1 0c STA $0cc1 ; (inp_jsr + 22)
+0cb0 : c8 __ __ INY
+0cb1 : b1 19 __ LDA (IP + 0),y
+0cb3 : 8d c2 0c STA $0cc2 ; (inp_jsr + 23)
+0cb6 : 98 __ __ TYA
+0cb7 : 38 __ __ SEC
+0cb8 : 65 19 __ ADC IP + 0
+0cba : 85 19 __ STA IP + 0
+0cbc : 90 02 __ BCC $0cc0
+0cbe : e6 1a __ INC IP + 1
+0cc0 : 20 00 00 JSR $0000 
+0cc3 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+0cc6 : 98 __ __ TYA
+0cc7 : 18 __ __ CLC
+0cc8 : 65 19 __ ADC IP + 0
+0cca : 8d d5 0c STA $0cd5 ; (inp_native + 15)
+0ccd : a5 1a __ LDA IP + 1
+0ccf : 69 00 __ ADC #$00
+0cd1 : 8d d6 0c STA $0cd6 ; (inp_native + 16)
+0cd4 : 20 00 00 JSR $0000 
+0cd7 : a0 00 __ LDY #$00
+0cd9 : b1 23 __ LDA (SP + 0),y
+0cdb : 85 19 __ STA IP + 0
+0cdd : c8 __ __ INY
+0cde : b1 23 __ LDA (SP + 0),y
+0ce0 : 85 1a __ STA IP + 1
+0ce2 : 88 __ __ DEY
+0ce3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+0ce6 : 38 __ __ SEC
+0ce7 : a5 23 __ LDA SP + 0
+0ce9 : f1 19 __ SBC (IP + 0),y
+0ceb : c8 __ __ INY
+0cec : 85 23 __ STA SP + 0
+0cee : a5 24 __ LDA SP + 1
+0cf0 : f1 19 __ SBC (IP + 0),y
+0cf2 : c8 __ __ INY
+0cf3 : 85 24 __ STA SP + 1
+0cf5 : b1 19 __ LDA (IP + 0),y
+0cf7 : 84 02 __ STY $02
+0cf9 : a8 __ __ TAY
+0cfa : a5 25 __ LDA FP + 0
+0cfc : 91 23 __ STA (SP + 0),y
+0cfe : c8 __ __ INY
+0cff : a5 26 __ LDA FP + 1
+0d01 : 91 23 __ STA (SP + 0),y
+0d03 : 98 __ __ TYA
+0d04 : 38 __ __ SEC
+0d05 : 65 23 __ ADC SP + 0
+0d07 : 85 25 __ STA FP + 0
+0d09 : a9 00 __ LDA #$00
+0d0b : 65 24 __ ADC SP + 1
+0d0d : 85 26 __ STA FP + 1
+0d0f : 88 __ __ DEY
+0d10 : f0 08 __ BEQ $0d1a
+0d12 : b9 52 00 LDA $0052,y 
+0d15 : 88 __ __ DEY
+0d16 : 91 23 __ STA (SP + 0),y
+0d18 : d0 f8 __ BNE $0d12
+0d1a : a4 02 __ LDY $02
+0d1c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+0d1f : b1 19 __ LDA (IP + 0),y
+0d21 : c8 __ __ INY
+0d22 : 84 02 __ STY $02
+0d24 : a8 __ __ TAY
+0d25 : b1 23 __ LDA (SP + 0),y
+0d27 : 85 25 __ STA FP + 0
+0d29 : c8 __ __ INY
+0d2a : b1 23 __ LDA (SP + 0),y
+0d2c : 85 26 __ STA FP + 1
+0d2e : 88 __ __ DEY
+0d2f : f0 09 __ BEQ $0d3a
+0d31 : 88 __ __ DEY
+0d32 : b1 23 __ LDA (SP + 0),y
+0d34 : 99 53 00 STA $0053,y 
+0d37 : 88 __ __ DEY
+0d38 : 10 f8 __ BPL $0d32
+0d3a : a4 02 __ LDY $02
+0d3c : 18 __ __ CLC
+0d3d : b1 19 __ LDA (IP + 0),y
+0d3f : c8 __ __ INY
+0d40 : 65 23 __ ADC SP + 0
+0d42 : 85 23 __ STA SP + 0
+0d44 : b1 19 __ LDA (IP + 0),y
+0d46 : c8 __ __ INY
+0d47 : 65 24 __ ADC SP + 1
+0d49 : 85 24 __ STA SP + 1
+0d4b : a0 01 __ LDY #$01
+0d4d : b1 23 __ LDA (SP + 0),y
+0d4f : 85 1a __ STA IP + 1
+0d51 : 88 __ __ DEY
+0d52 : b1 23 __ LDA (SP + 0),y
+0d54 : 85 19 __ STA IP + 0
+0d56 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+0d59 : b1 19 __ LDA (IP + 0),y
+0d5b : 85 1f __ STA ADDR + 0
+0d5d : c8 __ __ INY
+0d5e : b1 19 __ LDA (IP + 0),y
+0d60 : 85 20 __ STA ADDR + 1
+0d62 : c8 __ __ INY
+0d63 : 98 __ __ TYA
+0d64 : a0 00 __ LDY #$00
+0d66 : 18 __ __ CLC
+0d67 : 65 19 __ ADC IP + 0
+0d69 : 91 23 __ STA (SP + 0),y
+0d6b : c8 __ __ INY
+0d6c : a5 1a __ LDA IP + 1
+0d6e : 69 00 __ ADC #$00
+0d70 : 91 23 __ STA (SP + 0),y
+0d72 : a5 1f __ LDA ADDR + 0
+0d74 : 85 19 __ STA IP + 0
+0d76 : a5 20 __ LDA ADDR + 1
+0d78 : 85 1a __ STA IP + 1
+0d7a : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+0d7d : 38 __ __ SEC
+0d7e : a5 23 __ LDA SP + 0
+0d80 : f1 19 __ SBC (IP + 0),y
+0d82 : c8 __ __ INY
+0d83 : 85 23 __ STA SP + 0
+0d85 : a5 24 __ LDA SP + 1
+0d87 : f1 19 __ SBC (IP + 0),y
+0d89 : 85 24 __ STA SP + 1
+0d8b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+0d8e : 18 __ __ CLC
+0d8f : b1 19 __ LDA (IP + 0),y
+0d91 : c8 __ __ INY
+0d92 : 65 23 __ ADC SP + 0
+0d94 : 85 23 __ STA SP + 0
+0d96 : b1 19 __ LDA (IP + 0),y
+0d98 : 65 24 __ ADC SP + 1
+0d9a : 85 24 __ STA SP + 1
+0d9c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+0d9f : b1 19 __ LDA (IP + 0),y
+0da1 : c8 __ __ INY
+0da2 : 8d b0 0d STA $0db0 ; (inp_op_extrt + 17)
+0da5 : b1 19 __ LDA (IP + 0),y
+0da7 : c8 __ __ INY
+0da8 : 8d b1 0d STA $0db1 ; (inp_op_extrt + 18)
+0dab : b1 19 __ LDA (IP + 0),y
+0dad : c8 __ __ INY
+0dae : aa __ __ TAX
+0daf : 20 00 00 JSR $0000 
+0db2 : 4c 51 08 JMP $0851 ; (startup + 80)
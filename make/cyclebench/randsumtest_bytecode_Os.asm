@@ -0,0 +1,681 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 3f 0e STX $0e3f ; (spentry + 0)
+0811 : a9 42 __ LDA #$42
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0e __ LDA #$0e
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0e __ LDA #$0e
+081c : e9 0e __ SBC #$0e
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 42 __ LDA #$42
+0832 : e9 42 __ SBC #$42
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 2
+0a04:	PUSH	#$0003
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	CALL	rand + 0
+0a13:	ADD	T1, #$0001
+0a17:	EXTRT	$00, inp_op_ext_u16 + 0
+0a1b:	EXTRT	T0, inp_op_addr_32 + 0
+0a1f:	MOVD	T0, ACCU
+0a21:	MOV	ACCU, T1
+0a23:	CMPU	ACCU, #$03E8
+0a26:	BGT	$0A10
+0a28:	MOVD	ACCU, #$01eab02e
+0a2e:	EXTRT	T0, inp_op_cmp_u32 + 0
+0a32:	SEQ
+0a33:	MOVB	2(SP), ACCU
+0a36:	CALL	assert + 0
+0a39:	MOV	ACCU, #0
+0a3c:	POP	#$0003
+0a3f:	RETURN	0, 2
+--------------------------------------------------------------------
+rand:
+0a43:	ENTER	0, 2
+0a47:	MOV	T0, seed + 0
+0a4b:	MOV	ACCU, T0
+0a4d:	SHL	ACCU, #7
+0a4f:	XOR	ACCU, T0
+0a51:	MOV	T0, ACCU
+0a53:	SHRU	ACCU, #9
+0a55:	XOR	ACCU, T0
+0a57:	MOV	T0, ACCU
+0a59:	SHL	ACCU, #8
+0a5b:	XOR	ACCU, T0
+0a5d:	MOV	T0, ACCU
+0a5f:	MOV	seed + 0, T0
+0a63:	RETURN	0, 2
+--------------------------------------------------------------------
+assert:
+0a67:	ENTER	0, 2
+0a6b:	PUSH	#$0002
+0a6e:	MOVUB	ACCU, 2(FP)
+0a71:	BNE	$0A79
+0a73:	MOV	P0, #-1
+0a76:	CALL	exit + 0
+0a79:	POP	#$0002
+0a7c:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+0a80:	ENTER	0, 2
+0a84:	JSR	$0a8b
+0a87:	RETURN	0, 2
+--------------------------------------------------------------------
+0a8b : a5 0d __ LDA P0
+0a8d : 85 1b __ STA ACCU + 0
+0a8f : a5 0e __ LDA P1
+0a91 : 85 1c __ STA ACCU + 1
+0a93 : ae 3f 0e LDX $0e3f ; (spentry + 0)
+0a96 : 9a __ __ TXS
+0a97 : a9 4c __ LDA #$4c
+0a99 : 85 54 __ STA $54
+0a9b : a9 00 __ LDA #$00
+0a9d : 85 13 __ STA P6
+0a9f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+0aa0 : a9 00 __ LDA #$00
+0aa2 : 85 1d __ STA ACCU + 2
+0aa4 : 85 1e __ STA ACCU + 3
+0aa6 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_addr_32:
+0aa7 : 18 __ __ CLC
+0aa8 : a5 1b __ LDA ACCU + 0
+0aaa : 75 00 __ ADC $00,x
+0aac : 85 1b __ STA ACCU + 0
+0aae : a5 1c __ LDA ACCU + 1
+0ab0 : 75 01 __ ADC $01,x
+0ab2 : 85 1c __ STA ACCU + 1
+0ab4 : a5 1d __ LDA ACCU + 2
+0ab6 : 75 02 __ ADC $02,x
+0ab8 : 85 1d __ STA ACCU + 2
+0aba : a5 1e __ LDA ACCU + 3
+0abc : 75 03 __ ADC $03,x
+0abe : 85 1e __ STA ACCU + 3
+0ac0 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+0ac1 : b5 03 __ LDA $03,x
+0ac3 : c5 1e __ CMP ACCU + 3
+0ac5 : d0 20 __ BNE $0ae7
+0ac7 : b5 02 __ LDA $02,x
+0ac9 : c5 1d __ CMP ACCU + 2
+0acb : d0 1a __ BNE $0ae7
+0acd : b5 01 __ LDA $01,x
+0acf : c5 1c __ CMP ACCU + 1
+0ad1 : d0 14 __ BNE $0ae7
+0ad3 : b5 00 __ LDA $00,x
+0ad5 : c5 1b __ CMP ACCU + 0
+0ad7 : d0 0e __ BNE $0ae7
+0ad9 : a9 00 __ LDA #$00
+0adb : 85 1b __ STA ACCU + 0
+0add : 85 1c __ STA ACCU + 1
+0adf : 60 __ __ RTS
+0ae0 : a9 ff __ LDA #$ff
+0ae2 : 85 1b __ STA ACCU + 0
+0ae4 : 85 1c __ STA ACCU + 1
+0ae6 : 60 __ __ RTS
+0ae7 : 90 f7 __ BCC $0ae0
+0ae9 : a9 01 __ LDA #$01
+0aeb : 85 1b __ STA ACCU + 0
+0aed : a9 00 __ LDA #$00
+0aef : 85 1c __ STA ACCU + 1
+0af1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0af2 : a9 4c __ LDA #$4c
+0af4 : 85 54 __ STA $54
+0af6 : a9 00 __ LDA #$00
+0af8 : 85 13 __ STA P6
+0afa : a9 19 __ LDA #$19
+0afc : 85 16 __ STA P9
+0afe : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0aff : b1 19 __ LDA (IP + 0),y
+0b01 : aa __ __ TAX
+0b02 : c8 __ __ INY
+0b03 : b1 19 __ LDA (IP + 0),y
+0b05 : 95 00 __ STA $00,x
+0b07 : a9 00 __ LDA #$00
+0b09 : 95 01 __ STA $01,x
+0b0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+0b0e : b1 19 __ LDA (IP + 0),y
+0b10 : aa __ __ TAX
+0b11 : c8 __ __ INY
+0b12 : b1 19 __ LDA (IP + 0),y
+0b14 : 95 00 __ STA $00,x
+0b16 : a9 ff __ LDA #$ff
+0b18 : 95 01 __ STA $01,x
+0b1a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+0b1d : b1 19 __ LDA (IP + 0),y
+0b1f : aa __ __ TAX
+0b20 : c8 __ __ INY
+0b21 : b1 19 __ LDA (IP + 0),y
+0b23 : 95 00 __ STA $00,x
+0b25 : c8 __ __ INY
+0b26 : b1 19 __ LDA (IP + 0),y
+0b28 : 95 01 __ STA $01,x
+0b2a : c8 __ __ INY
+0b2b : b1 19 __ LDA (IP + 0),y
+0b2d : 95 02 __ STA $02,x
+0b2f : c8 __ __ INY
+0b30 : b1 19 __ LDA (IP + 0),y
+0b32 : 95 03 __ STA $03,x
+0b34 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0b37 : b1 19 __ LDA (IP + 0),y
+0b39 : aa __ __ TAX
+0b3a : b5 00 __ LDA $00,x
+0b3c : 85 1b __ STA ACCU + 0
+0b3e : b5 01 __ LDA $01,x
+0b40 : 85 1c __ STA ACCU + 1
+0b42 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0b45 : b1 19 __ LDA (IP + 0),y
+0b47 : aa __ __ TAX
+0b48 : a5 1b __ LDA ACCU + 0
+0b4a : 95 00 __ STA $00,x
+0b4c : a5 1c __ LDA ACCU + 1
+0b4e : 95 01 __ STA $01,x
+0b50 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+0b53 : b1 19 __ LDA (IP + 0),y
+0b55 : aa __ __ TAX
+0b56 : a5 1b __ LDA ACCU + 0
+0b58 : 95 00 __ STA $00,x
+0b5a : a5 1c __ LDA ACCU + 1
+0b5c : 95 01 __ STA $01,x
+0b5e : a5 1d __ LDA ACCU + 2
+0b60 : 95 02 __ STA $02,x
+0b62 : a5 1e __ LDA ACCU + 3
+0b64 : 95 03 __ STA $03,x
+0b66 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0b69 : b1 19 __ LDA (IP + 0),y
+0b6b : 85 1f __ STA ADDR + 0
+0b6d : c8 __ __ INY
+0b6e : b1 19 __ LDA (IP + 0),y
+0b70 : 85 20 __ STA ADDR + 1
+0b72 : c8 __ __ INY
+0b73 : b1 19 __ LDA (IP + 0),y
+0b75 : aa __ __ TAX
+0b76 : 84 02 __ STY $02
+0b78 : a0 00 __ LDY #$00
+0b7a : b1 1f __ LDA (ADDR + 0),y
+0b7c : 95 00 __ STA $00,x
+0b7e : c8 __ __ INY
+0b7f : b1 1f __ LDA (ADDR + 0),y
+0b81 : 95 01 __ STA $01,x
+0b83 : a4 02 __ LDY $02
+0b85 : 4c 50 08 JMP $0850 ; (startup + 79)
+0b88 : b1 19 __ LDA (IP + 0),y
+0b8a : aa __ __ TAX
+0b8b : c8 __ __ INY
+0b8c : b1 19 __ LDA (IP + 0),y
+0b8e : 84 02 __ STY $02
+0b90 : a8 __ __ TAY
+0b91 : 4c 7a 0b JMP $0b7a ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+0b94 : b1 19 __ LDA (IP + 0),y
+0b96 : 85 1f __ STA ADDR + 0
+0b98 : c8 __ __ INY
+0b99 : b1 19 __ LDA (IP + 0),y
+0b9b : 85 20 __ STA ADDR + 1
+0b9d : c8 __ __ INY
+0b9e : b1 19 __ LDA (IP + 0),y
+0ba0 : aa __ __ TAX
+0ba1 : 84 02 __ STY $02
+0ba3 : a0 00 __ LDY #$00
+0ba5 : b5 00 __ LDA $00,x
+0ba7 : 91 1f __ STA (ADDR + 0),y
+0ba9 : c8 __ __ INY
+0baa : b5 01 __ LDA $01,x
+0bac : 91 1f __ STA (ADDR + 0),y
+0bae : a4 02 __ LDY $02
+0bb0 : 4c 50 08 JMP $0850 ; (startup + 79)
+0bb3 : b1 19 __ LDA (IP + 0),y
+0bb5 : aa __ __ TAX
+0bb6 : c8 __ __ INY
+0bb7 : b1 19 __ LDA (IP + 0),y
+0bb9 : 84 02 __ STY $02
+0bbb : a8 __ __ TAY
+0bbc : 4c a5 0b JMP $0ba5 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_local_u8:
+0bbf : b1 19 __ LDA (IP + 0),y
+0bc1 : aa __ __ TAX
+0bc2 : c8 __ __ INY
+0bc3 : b1 19 __ LDA (IP + 0),y
+0bc5 : 84 02 __ STY $02
+0bc7 : a8 __ __ TAY
+0bc8 : b1 25 __ LDA (FP + 0),y
+0bca : 95 00 __ STA $00,x
+0bcc : a9 00 __ LDA #$00
+0bce : 95 01 __ STA $01,x
+0bd0 : a4 02 __ LDY $02
+0bd2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+0bd5 : b1 19 __ LDA (IP + 0),y
+0bd7 : aa __ __ TAX
+0bd8 : c8 __ __ INY
+0bd9 : b1 19 __ LDA (IP + 0),y
+0bdb : 84 02 __ STY $02
+0bdd : a8 __ __ TAY
+0bde : b5 00 __ LDA $00,x
+0be0 : 91 23 __ STA (SP + 0),y
+0be2 : a4 02 __ LDY $02
+0be4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+0be7 : b1 19 __ LDA (IP + 0),y
+0be9 : aa __ __ TAX
+0bea : a5 1b __ LDA ACCU + 0
+0bec : 55 00 __ EOR $00,x
+0bee : 85 1b __ STA ACCU + 0
+0bf0 : a5 1c __ LDA ACCU + 1
+0bf2 : 55 01 __ EOR $01,x
+0bf4 : 85 1c __ STA ACCU + 1
+0bf6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0bf9 : b1 19 __ LDA (IP + 0),y
+0bfb : c8 __ __ INY
+0bfc : aa __ __ TAX
+0bfd : 18 __ __ CLC
+0bfe : b5 00 __ LDA $00,x
+0c00 : 71 19 __ ADC (IP + 0),y
+0c02 : c8 __ __ INY
+0c03 : 95 00 __ STA $00,x
+0c05 : b5 01 __ LDA $01,x
+0c07 : 71 19 __ ADC (IP + 0),y
+0c09 : 95 01 __ STA $01,x
+0c0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0c0e : b1 19 __ LDA (IP + 0),y
+0c10 : aa __ __ TAX
+0c11 : b5 00 __ LDA $00,x
+0c13 : 2c b1 19 BIT $19b1 
+0c16 : 29 0f __ AND #$0f
+0c18 : f0 0b __ BEQ $0c25
+0c1a : aa __ __ TAX
+0c1b : a5 1c __ LDA ACCU + 1
+0c1d : 06 1b __ ASL ACCU + 0
+0c1f : 2a __ __ ROL
+0c20 : ca __ __ DEX
+0c21 : d0 fa __ BNE $0c1d
+0c23 : 85 1c __ STA ACCU + 1
+0c25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+0c28 : b1 19 __ LDA (IP + 0),y
+0c2a : aa __ __ TAX
+0c2b : b5 00 __ LDA $00,x
+0c2d : 2c b1 19 BIT $19b1 
+0c30 : 29 0f __ AND #$0f
+0c32 : f0 0b __ BEQ $0c3f
+0c34 : aa __ __ TAX
+0c35 : a5 1c __ LDA ACCU + 1
+0c37 : 4a __ __ LSR
+0c38 : 66 1b __ ROR ACCU + 0
+0c3a : ca __ __ DEX
+0c3b : d0 fa __ BNE $0c37
+0c3d : 85 1c __ STA ACCU + 1
+0c3f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0c42 : b1 19 __ LDA (IP + 0),y
+0c44 : aa __ __ TAX
+0c45 : 38 __ __ SEC
+0c46 : b5 01 __ LDA $01,x
+0c48 : e5 1c __ SBC ACCU + 1
+0c4a : f0 11 __ BEQ $0c5d
+0c4c : 50 02 __ BVC $0c50
+0c4e : 49 80 __ EOR #$80
+0c50 : 30 2a __ BMI $0c7c
+0c52 : 10 33 __ BPL $0c87
+0c54 : b1 19 __ LDA (IP + 0),y
+0c56 : aa __ __ TAX
+0c57 : b5 01 __ LDA $01,x
+0c59 : c5 1c __ CMP ACCU + 1
+0c5b : d0 28 __ BNE $0c85
+0c5d : b5 00 __ LDA $00,x
+0c5f : c5 1b __ CMP ACCU + 0
+0c61 : d0 22 __ BNE $0c85
+0c63 : f0 0e __ BEQ $0c73
+0c65 : b1 19 __ LDA (IP + 0),y
+0c67 : aa __ __ TAX
+0c68 : c8 __ __ INY
+0c69 : b1 19 __ LDA (IP + 0),y
+0c6b : c5 1c __ CMP ACCU + 1
+0c6d : d0 16 __ BNE $0c85
+0c6f : e4 1b __ CPX ACCU + 0
+0c71 : d0 12 __ BNE $0c85
+0c73 : a9 00 __ LDA #$00
+0c75 : 85 1b __ STA ACCU + 0
+0c77 : 85 1c __ STA ACCU + 1
+0c79 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c7c : a9 ff __ LDA #$ff
+0c7e : 85 1b __ STA ACCU + 0
+0c80 : 85 1c __ STA ACCU + 1
+0c82 : 4c 50 08 JMP $0850 ; (startup + 79)
+0c85 : 90 f5 __ BCC $0c7c
+0c87 : a9 01 __ LDA #$01
+0c89 : 85 1b __ STA ACCU + 0
+0c8b : a9 00 __ LDA #$00
+0c8d : 85 1c __ STA ACCU + 1
+0c8f : 4c 50 08 JMP $0850 ; (startup + 79)
+0c92 : b1 19 __ LDA (IP + 0),y
+0c94 : c8 __ __ INY
+0c95 : aa __ __ TAX
+0c96 : b1 19 __ LDA (IP + 0),y
+0c98 : 38 __ __ SEC
+0c99 : e5 1c __ SBC ACCU + 1
+0c9b : d0 af __ BNE $0c4c
+0c9d : e4 1b __ CPX ACCU + 0
+0c9f : d0 e4 __ BNE $0c85
+0ca1 : f0 d0 __ BEQ $0c73
+0ca3 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+0ca4 : b1 19 __ LDA (IP + 0),y
+0ca6 : 30 0c __ BMI $0cb4
+0ca8 : 38 __ __ SEC
+0ca9 : 65 19 __ ADC IP + 0
+0cab : 85 19 __ STA IP + 0
+0cad : 90 02 __ BCC $0cb1
+0caf : e6 1a __ INC IP + 1
+0cb1 : 4c 51 08 JMP $0851 ; (startup + 80)
+0cb4 : 38 __ __ SEC
+0cb5 : 65 19 __ ADC IP + 0
+0cb7 : 85 19 __ STA IP + 0
+0cb9 : b0 02 __ BCS $0cbd
+0cbb : c6 1a __ DEC IP + 1
+0cbd : 4c 51 08 JMP $0851 ; (startup + 80)
+0cc0 : a5 1b __ LDA ACCU + 0
+0cc2 : 05 1c __ ORA ACCU + 1
+0cc4 : f0 de __ BEQ $0ca4
+0cc6 : 4c 50 08 JMP $0850 ; (startup + 79)
+0cc9 : a5 1b __ LDA ACCU + 0
+0ccb : 05 1c __ ORA ACCU + 1
+0ccd : d0 d5 __ BNE $0ca4
+0ccf : 4c 50 08 JMP $0850 ; (startup + 79)
+0cd2 : a5 1c __ LDA ACCU + 1
+0cd4 : 30 04 __ BMI $0cda
+0cd6 : 05 1b __ ORA ACCU + 0
+0cd8 : d0 ca __ BNE $0ca4
+0cda : 4c 50 08 JMP $0850 ; (startup + 79)
+0cdd : a5 1c __ LDA ACCU + 1
+0cdf : 10 c3 __ BPL $0ca4
+0ce1 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ce4 : a5 1c __ LDA ACCU + 1
+0ce6 : 30 bc __ BMI $0ca4
+0ce8 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ceb : a5 1c __ LDA ACCU + 1
+0ced : 30 b5 __ BMI $0ca4
+0cef : 05 1b __ ORA ACCU + 0
+0cf1 : f0 b1 __ BEQ $0ca4
+0cf3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+0cf6 : a9 00 __ LDA #$00
+0cf8 : 2c a9 01 BIT $01a9 
+0cfb : 85 1b __ STA ACCU + 0
+0cfd : a9 00 __ LDA #$00
+0cff : 85 1c __ STA ACCU + 1
+0d01 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d04 : a5 1b __ LDA ACCU + 0
+0d06 : 05 1c __ ORA ACCU + 1
+0d08 : f0 ef __ BEQ $0cf9
+0d0a : d0 ea __ BNE $0cf6
+0d0c : a5 1b __ LDA ACCU + 0
+0d0e : 05 1c __ ORA ACCU + 1
+0d10 : d0 e7 __ BNE $0cf9
+0d12 : f0 e2 __ BEQ $0cf6
+0d14 : a5 1c __ LDA ACCU + 1
+0d16 : 30 de __ BMI $0cf6
+0d18 : 05 1b __ ORA ACCU + 0
+0d1a : d0 dd __ BNE $0cf9
+0d1c : f0 d8 __ BEQ $0cf6
+0d1e : a5 1c __ LDA ACCU + 1
+0d20 : 10 d7 __ BPL $0cf9
+0d22 : 30 d2 __ BMI $0cf6
+0d24 : a5 1c __ LDA ACCU + 1
+0d26 : 30 d1 __ BMI $0cf9
+0d28 : 10 cc __ BPL $0cf6
+0d2a : a5 1c __ LDA ACCU + 1
+0d2c : 30 cb __ BMI $0cf9
+0d2e : 05 1b __ ORA ACCU + 0
+0d30 : f0 c7 __ BEQ $0cf9
+0d32 : d0 c2 __ BNE $0cf6
+0d34 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+0d35 : b1 19 __ LDA (IP + 0),y
+0d37 : 8d 4b 0d STA $0d4b ; (inp_jsr + 22)
+0d3a : c8 __ __ INY
+0d3b : b1 19 __ LDA (IP + 0),y
+0d3d : 8d 4c 0d STA $0d4c ; (inp_jsr + 23)
+0d40 : 98 __ __ TYA
+0d41 : 38 __ __ SEC
+0d42 : 65 19 __ ADC IP + 0
+0d44 : 85 19 __ STA IP + 0
+0d46 : 90 02 __ BCC $0d4a
+0d48 : e6 1a __ INC IP + 1
+0d4a : 20 00 00 JSR $0000 
+0d4d : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+0d50 : 98 __ __ TYA
+0d51 : 18 __ __ CLC
+0d52 : 65 19 __ ADC IP + 0
+0d54 : 8d 5f 0d STA $0d5f ; (inp_native + 15)
+0d57 : a5 1a __ LDA IP + 1
+0d59 : 69 00 __ ADC #$00
+0d5b : 8d 60 0d STA $0d60 ; (inp_native + 16)
+0d5e : 20 00 00 JSR $0000 
+0d61 : a0 00 __ LDY #$00
+0d63 : b1 23 __ LDA (SP + 0),y
+0d65 : 85 19 __ STA IP + 0
+0d67 : c8 __ __ INY
+0d68 : b1 23 __ LDA (SP + 0),y
+0d6a : 85 1a __ STA IP + 1
+0d6c : 88 __ __ DEY
+0d6d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+0d70 : 38 __ __ SEC
+0d71 : a5 23 __ LDA SP + 0
+0d73 : f1 19 __ SBC (IP + 0),y
+0d75 : c8 __ __ INY
+0d76 : 85 23 __ STA SP + 0
+0d78 : a5 24 __ LDA SP + 1
+0d7a : f1 19 __ SBC (IP + 0),y
+0d7c : c8 __ __ INY
+0d7d : 85 24 __ STA SP + 1
+0d7f : b1 19 __ LDA (IP + 0),y
+0d81 : 84 02 __ STY $02
+0d83 : a8 __ __ TAY
+0d84 : a5 25 __ LDA FP + 0
+0d86 : 91 23 __ STA (SP + 0),y
+0d88 : c8 __ __ INY
+0d89 : a5 26 __ LDA FP + 1
+0d8b : 91 23 __ STA (SP + 0),y
+0d8d : 98 __ __ TYA
+0d8e : 38 __ __ SEC
+0d8f : 65 23 __ ADC SP + 0
+0d91 : 85 25 __ STA FP + 0
+0d93 : a9 00 __ LDA #$00
+0d95 : 65 24 __ ADC SP + 1
+0d97 : 85 26 __ STA FP + 1
+0d99 : 88 __ __ DEY
+0d9a : f0 08 __ BEQ $0da4
+0d9c : b9 52 00 LDA $0052,y 
+0d9f : 88 __ __ DEY
+0da0 : 91 23 __ STA (SP + 0),y
+0da2 : d0 f8 __ BNE $0d9c
+0da4 : a4 02 __ LDY $02
+0da6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+0da9 : b1 19 __ LDA (IP + 0),y
+0dab : c8 __ __ INY
+0dac : 84 02 __ STY $02
+0dae : a8 __ __ TAY
+0daf : b1 23 __ LDA (SP + 0),y
+0db1 : 85 25 __ STA FP + 0
+0db3 : c8 __ __ INY
+0db4 : b1 23 __ LDA (SP + 0),y
+0db6 : 85 26 __ STA FP + 1
+0db8 : 88 __ __ DEY
+0db9 : f0 09 __ BEQ $0dc4
+0dbb : 88 __ __ DEY
+0dbc : b1 23 __ LDA (SP + 0),y
+0dbe : 99 53 00 STA $0053,y 
+0dc1 : 88 __ __ DEY
+0dc2 : 10 f8 __ BPL $0dbc
+0dc4 : a4 02 __ LDY $02
+0dc6 : 18 __ __ CLC
+0dc7 : b1 19 __ LDA (IP + 0),y
+0dc9 : c8 __ __ INY
+0dca : 65 23 __ ADC SP + 0
+0dcc : 85 23 __ STA SP + 0
+0dce : b1 19 __ LDA (IP + 0),y
+0dd0 : c8 __ __ INY
+0dd1 : 65 24 __ ADC SP + 1
+0dd3 : 85 24 __ STA SP + 1
+0dd5 : a0 01 __ LDY #$01
+0dd7 : b1 23 __ LDA (SP + 0),y
+0dd9 : 85 1a __ STA IP + 1
+0ddb : 88 __ __ DEY
+0ddc : b1 23 __ LDA (SP + 0),y
+0dde : 85 19 __ STA IP + 0
+0de0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+0de3 : b1 19 __ LDA (IP + 0),y
+0de5 : 85 1f __ STA ADDR + 0
+0de7 : c8 __ __ INY
+0de8 : b1 19 __ LDA (IP + 0),y
+0dea : 85 20 __ STA ADDR + 1
+0dec : c8 __ __ INY
+0ded : 98 __ __ TYA
+0dee : a0 00 __ LDY #$00
+0df0 : 18 __ __ CLC
+0df1 : 65 19 __ ADC IP + 0
+0df3 : 91 23 __ STA (SP + 0),y
+0df5 : c8 __ __ INY
+0df6 : a5 1a __ LDA IP + 1
+0df8 : 69 00 __ ADC #$00
+0dfa : 91 23 __ STA (SP + 0),y
+0dfc : a5 1f __ LDA ADDR + 0
+0dfe : 85 19 __ STA IP + 0
+0e00 : a5 20 __ LDA ADDR + 1
+0e02 : 85 1a __ STA IP + 1
+0e04 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+0e07 : 38 __ __ SEC
+0e08 : a5 23 __ LDA SP + 0
+0e0a : f1 19 __ SBC (IP + 0),y
+0e0c : c8 __ __ INY
+0e0d : 85 23 __ STA SP + 0
+0e0f : a5 24 __ LDA SP + 1
+0e11 : f1 19 __ SBC (IP + 0),y
+0e13 : 85 24 __ STA SP + 1
+0e15 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+0e18 : 18 __ __ CLC
+0e19 : b1 19 __ LDA (IP + 0),y
+0e1b : c8 __ __ INY
+0e1c : 65 23 __ ADC SP + 0
+0e1e : 85 23 __ STA SP + 0
+0e20 : b1 19 __ LDA (IP + 0),y
+0e22 : 65 24 __ ADC SP + 1
+0e24 : 85 24 __ STA SP + 1
+0e26 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+0e29 : b1 19 __ LDA (IP + 0),y
+0e2b : c8 __ __ INY
+0e2c : 8d 3a 0e STA $0e3a ; (inp_op_extrt + 17)
+0e2f : b1 19 __ LDA (IP + 0),y
+0e31 : c8 __ __ INY
+0e32 : 8d 3b 0e STA $0e3b ; (inp_op_extrt + 18)
+0e35 : b1 19 __ LDA (IP + 0),y
+0e37 : c8 __ __ INY
+0e38 : aa __ __ TAX
+0e39 : 20 00 00 JSR $0000 
+0e3c : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,138 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e a9 09 STX $09a9 ; (spentry + 0)
+0811 : a9 ac __ LDA #$ac
+0813 : 85 19 __ STA IP + 0
+0815 : a9 09 __ LDA #$09
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 09 __ LDA #$09
+081c : e9 09 __ SBC #$09
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ac __ LDA #$ac
+0832 : e9 ac __ SBC #$ac
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 9c 09 JMP $099c ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : a9 00 __ LDA #$00
+0902 : 85 43 __ STA T0 + 0
+0904 : 85 44 __ STA T0 + 1
+0906 : 85 45 __ STA T0 + 2
+0908 : 85 46 __ STA T0 + 3
+090a : 85 47 __ STA T1 + 0
+090c : 85 48 __ STA T1 + 1
+090e : ad ab 09 LDA $09ab ; (seed + 1)
+0911 : 4a __ __ LSR
+0912 : ad aa 09 LDA $09aa ; (seed + 0)
+0915 : 6a __ __ ROR
+0916 : aa __ __ TAX
+0917 : a9 00 __ LDA #$00
+0919 : 6a __ __ ROR
+091a : 4d aa 09 EOR $09aa ; (seed + 0)
+091d : 85 49 __ STA T2 + 0
+091f : 8a __ __ TXA
+0920 : 4d ab 09 EOR $09ab ; (seed + 1)
+0923 : 85 4a __ STA T2 + 1
+0925 : 4a __ __ LSR
+0926 : 45 49 __ EOR T2 + 0
+0928 : 85 49 __ STA T2 + 0
+092a : 8d aa 09 STA $09aa ; (seed + 0)
+092d : 45 4a __ EOR T2 + 1
+092f : 85 4a __ STA T2 + 1
+0931 : 8d ab 09 STA $09ab ; (seed + 1)
+0934 : e6 47 __ INC T1 + 0
+0936 : d0 02 __ BNE $093a
+0938 : e6 48 __ INC T1 + 1
+093a : 18 __ __ CLC
+093b : a5 49 __ LDA T2 + 0
+093d : 65 43 __ ADC T0 + 0
+093f : 85 43 __ STA T0 + 0
+0941 : a5 4a __ LDA T2 + 1
+0943 : 65 44 __ ADC T0 + 1
+0945 : 85 44 __ STA T0 + 1
+0947 : a9 00 __ LDA #$00
+0949 : 65 45 __ ADC T0 + 2
+094b : 85 45 __ STA T0 + 2
+094d : a9 00 __ LDA #$00
+094f : 65 46 __ ADC T0 + 3
+0951 : 85 46 __ STA T0 + 3
+0953 : a5 48 __ LDA T1 + 1
+0955 : c9 03 __ CMP #$03
+0957 : d0 04 __ BNE $095d
+0959 : a5 47 __ LDA T1 + 0
+095b : c9 e8 __ CMP #$e8
+095d : 90 af __ BCC $090e
+095f : a5 46 __ LDA T0 + 3
+0961 : c9 01 __ CMP #$01
+0963 : d0 12 __ BNE $0977
+0965 : a5 45 __ LDA T0 + 2
+0967 : c9 ea __ CMP #$ea
+0969 : d0 0c __ BNE $0977
+096b : a5 44 __ LDA T0 + 1
+096d : c9 b0 __ CMP #$b0
+096f : d0 06 __ BNE $0977
+0971 : a5 43 __ LDA T0 + 0
+0973 : c9 2e __ CMP #$2e
+0975 : f0 09 __ BEQ $0980
+0977 : a9 ff __ LDA #$ff
+0979 : 85 0d __ STA P0
+097b : 85 0e __ STA P1
+097d : 20 87 09 JSR $0987 ; (exit + 0)
+0980 : a9 00 __ LDA #$00
+0982 : 85 1b __ STA ACCU + 0
+0984 : 85 1c __ STA ACCU + 1
+0986 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+0987 : a5 0d __ LDA P0
+0989 : 85 1b __ STA ACCU + 0
+098b : a5 0e __ LDA P1
+098d : 85 1c __ STA ACCU + 1
+098f : ae a9 09 LDX $09a9 ; (spentry + 0)
+0992 : 9a __ __ TXS
+0993 : a9 4c __ LDA #$4c
+0995 : 85 54 __ STA $54
+0997 : a9 00 __ LDA #$00
+0999 : 85 13 __ STA P6
+099b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+099c : a9 4c __ LDA #$4c
+099e : 85 54 __ STA $54
+09a0 : a9 00 __ LDA #$00
+09a2 : 85 13 __ STA P6
+09a4 : a9 19 __ LDA #$19
+09a6 : 85 16 __ STA P9
+09a8 : 60 __ __ RTS
@@ -0,0 +1,171 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e df 09 STX $09df ; (spentry + 0)
+0811 : a9 e2 __ LDA #$e2
+0813 : 85 19 __ STA IP + 0
+0815 : a9 09 __ LDA #$09
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 09 __ LDA #$09
+081c : e9 09 __ SBC #$09
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 e2 __ LDA #$e2
+0832 : e9 e2 __ SBC #$e2
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c d2 09 JMP $09d2 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 03 __ SBC #$03
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 47 __ STA T0 + 0
+0911 : 85 48 __ STA T0 + 1
+0913 : 85 49 __ STA T0 + 2
+0915 : 85 4a __ STA T0 + 3
+0917 : 85 4b __ STA T1 + 0
+0919 : 85 4c __ STA T1 + 1
+091b : 20 83 09 JSR $0983 ; (rand + 0)
+091e : e6 4b __ INC T1 + 0
+0920 : d0 02 __ BNE $0924
+0922 : e6 4c __ INC T1 + 1
+0924 : 18 __ __ CLC
+0925 : a5 1b __ LDA ACCU + 0
+0927 : 65 47 __ ADC T0 + 0
+0929 : 85 47 __ STA T0 + 0
+092b : a5 1c __ LDA ACCU + 1
+092d : 65 48 __ ADC T0 + 1
+092f : 85 48 __ STA T0 + 1
+0931 : a9 00 __ LDA #$00
+0933 : 65 49 __ ADC T0 + 2
+0935 : 85 49 __ STA T0 + 2
+0937 : a9 00 __ LDA #$00
+0939 : 65 4a __ ADC T0 + 3
+093b : 85 4a __ STA T0 + 3
+093d : a5 4c __ LDA T1 + 1
+093f : c9 03 __ CMP #$03
+0941 : d0 04 __ BNE $0947
+0943 : a5 4b __ LDA T1 + 0
+0945 : c9 e8 __ CMP #$e8
+0947 : 90 d2 __ BCC $091b
+0949 : a5 4a __ LDA T0 + 3
+094b : c9 01 __ CMP #$01
+094d : d0 12 __ BNE $0961
+094f : a5 49 __ LDA T0 + 2
+0951 : c9 ea __ CMP #$ea
+0953 : d0 0c __ BNE $0961
+0955 : a5 48 __ LDA T0 + 1
+0957 : c9 b0 __ CMP #$b0
+0959 : d0 06 __ BNE $0961
+095b : a5 47 __ LDA T0 + 0
+095d : c9 2e __ CMP #$2e
+095f : f0 1d __ BEQ $097e
+0961 : a9 00 __ LDA #$00
+0963 : a0 02 __ LDY #$02
+0965 : 91 23 __ STA (SP + 0),y
+0967 : 20 ad 09 JSR $09ad ; (assert + 0)
+096a : a9 00 __ LDA #$00
+096c : 85 1b __ STA ACCU + 0
+096e : 85 1c __ STA ACCU + 1
+0970 : 18 __ __ CLC
+0971 : a5 23 __ LDA SP + 0
+0973 : 69 03 __ ADC #$03
+0975 : 85 23 __ STA SP + 0
+0977 : a5 24 __ LDA SP + 1
+0979 : 69 00 __ ADC #$00
+097b : 85 24 __ STA SP + 1
+097d : 60 __ __ RTS
+097e : a9 01 __ LDA #$01
+0980 : 4c 63 09 JMP $0963 ; (main + 99)
+--------------------------------------------------------------------
+rand:
+0983 : ad e1 09 LDA $09e1 ; (seed + 1)
+0986 : 4a __ __ LSR
+0987 : ad e0 09 LDA $09e0 ; (seed + 0)
+098a : 6a __ __ ROR
+098b : aa __ __ TAX
+098c : a9 00 __ LDA #$00
+098e : 6a __ __ ROR
+098f : 4d e0 09 EOR $09e0 ; (seed + 0)
+0992 : 85 43 __ STA T0 + 0
+0994 : 8a __ __ TXA
+0995 : 4d e1 09 EOR $09e1 ; (seed + 1)
+0998 : 85 44 __ STA T0 + 1
+099a : 4a __ __ LSR
+099b : 45 43 __ EOR T0 + 0
+099d : aa __ __ TAX
+099e : 85 1b __ STA ACCU + 0
+09a0 : 45 44 __ EOR T0 + 1
+09a2 : a8 __ __ TAY
+09a3 : 8e e0 09 STX $09e0 ; (seed + 0)
+09a6 : 98 __ __ TYA
+09a7 : 84 1c __ STY ACCU + 1
+09a9 : 8d e1 09 STA $09e1 ; (seed + 1)
+09ac : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+09ad : a0 02 __ LDY #$02
+09af : b1 23 __ LDA (SP + 0),y
+09b1 : d0 09 __ BNE $09bc
+09b3 : a9 ff __ LDA #$ff
+09b5 : 85 0d __ STA P0
+09b7 : 85 0e __ STA P1
+09b9 : 20 bd 09 JSR $09bd ; (exit + 0)
+09bc : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+09bd : a5 0d __ LDA P0
+09bf : 85 1b __ STA ACCU + 0
+09c1 : a5 0e __ LDA P1
+09c3 : 85 1c __ STA ACCU + 1
+09c5 : ae df 09 LDX $09df ; (spentry + 0)
+09c8 : 9a __ __ TXS
+09c9 : a9 4c __ LDA #$4c
+09cb : 85 54 __ STA $54
+09cd : a9 00 __ LDA #$00
+09cf : 85 13 __ STA P6
+09d1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+09d2 : a9 4c __ LDA #$4c
+09d4 : 85 54 __ STA $54
+09d6 : a9 00 __ LDA #$00
+09d8 : 85 13 __ STA P6
+09da : a9 19 __ LDA #$19
+09dc : 85 16 __ STA P9
+09de : 60 __ __ RTS
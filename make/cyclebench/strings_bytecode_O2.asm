@@ -0,0 +1,998 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 2b 11 STX $112b ; (spentry + 0)
+0811 : a9 4e __ LDA #$4e
+0813 : 85 19 __ STA IP + 0
+0815 : a9 11 __ LDA #$11
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 13 __ LDA #$13
+081c : e9 11 __ SBC #$11
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 4e __ LDA #$4e
+0832 : e9 4e __ SBC #$4e
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	6, 24
+0a04:	PUSH	#$0002
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	MOV	ACCU, #0
+0a10:	MOVB	buffer + 0, ACCU
+0a14:	LEA	T2, buffer + 0
+0a18:	LEA	T3, text + 0
+0a1c:	LEA	T4, $0c29
+0a20:	LEA	T5, buffer + 0
+0a24:	MOV	ACCU, T5
+0a26:	MOV	P0, ACCU
+0a28:	MOV	ADDR, T3
+0a2a:	MOV	P2, 0(ADDR)
+0a2d:	JSR	strcat + 0
+0a30:	MOV	ACCU, T5
+0a32:	MOV	P0, ACCU
+0a34:	MOV	ACCU, T4
+0a36:	MOV	P2, ACCU
+0a38:	JSR	strcat + 0
+0a3b:	ADD	T3, #$0002
+0a3f:	MOV	ACCU, T2
+0a41:	CMPU	ACCU, T3
+0a43:	BLT	$0A24
+0a45:	MOV	T2, #0
+0a48:	MOVUB	ACCU, buffer + 0
+0a4c:	BNEF	$0B77
+0a4f:	MOV	ACCU, T2
+0a51:	ADD	T0, ACCU
+0a53:	MOV	T2, #0
+0a56:	MOVUB	ACCU, buffer + 0
+0a5a:	BNEF	$0B54
+0a5d:	MOV	ACCU, T2
+0a5f:	ADD	T0, ACCU
+0a61:	MOV	T2, #0
+0a64:	LEA	T3, words + 0
+0a68:	MOV	ACCU, T2
+0a6a:	MUL	ACCU, #5
+0a6d:	ADD	ACCU, T1
+0a6f:	MOV	ADDR, #17
+0a72:	MODS	ACCU, ADDR
+0a74:	SHL	ACCU, #1
+0a76:	LEA	T4, text + 0
+0a7a:	ADD	T4, ACCU
+0a7c:	MOV	ADDR, T4
+0a7e:	MOV	T4, 0(ADDR)
+0a81:	MOV	ADDR, T3
+0a83:	MOV	ACCU, T4
+0a85:	STRCPY
+0a86:	ADD	T3, #$0010
+0a8a:	ADD	T2, #$0001
+0a8e:	MOV	ACCU, T2
+0a90:	CMPS	ACCU, #$0010
+0a93:	BGT	$0A68
+0a95:	MOV	T2, #1
+0a98:	LEA	T3, words + 16
+0a9c:	LEA	ADDR, 0(FP)
+0aa0:	MOV	ACCU, T3
+0aa2:	STRCPY
+0aa3:	MOV	ACCU, T2
+0aa5:	MOV	T4, ACCU
+0aa7:	BGT	$0B12
+0aa9:	MUL	T4, #16
+0aac:	LEAX	ADDR, words + 0 + T4
+0ab0:	LEA	ACCU, 0(FP)
+0ab4:	STRCPY
+0ab5:	ADD	T3, #$0010
+0ab9:	ADD	T2, #$0001
+0abd:	MOV	ACCU, T2
+0abf:	CMPS	ACCU, #$0010
+0ac2:	BGT	$0A9C
+0ac4:	LEA	T2, words + 240
+0ac8:	LEA	T3, words + 16
+0acc:	LEA	T4, words + 0
+0ad0:	MOV	ACCU, T4
+0ad2:	MOV	P0, ACCU
+0ad4:	MOV	ACCU, T3
+0ad6:	MOV	P2, ACCU
+0ad8:	JSR	strcmp + 0
+0adb:	BGT	$0B0D
+0add:	ADD	T4, #$0010
+0ae1:	ADD	T3, #$0010
+0ae5:	MOV	ACCU, T2
+0ae7:	CMPU	ACCU, T4
+0ae9:	BLT	$0AD0
+0aeb:	ADD	T1, #$0001
+0aef:	MOV	ACCU, T1
+0af1:	CMPS	ACCU, #$0014
+0af4:	BGTF	$0A0D
+0af7:	MOV	ACCU, T0
+0af9:	CMPU	ACCU, #$071C
+0afc:	BNE	$0B03
+0afe:	MOV	ACCU, #0
+0b01:	JUMP	$0B06
+0b03:	MOV	ACCU, #2
+0b06:	POP	#$0002
+0b09:	RETURN	6, 24
+0b0d:	MOV	ACCU, #1
+0b10:	JUMP	$0B06
+0b12:	MOV	ACCU, T2
+0b14:	ADD	ACCU, #$FFFF
+0b18:	MOV	T5, ACCU
+0b1a:	MUL	T5, #16
+0b1d:	LEA	ACCU, words + 0
+0b21:	ADD	T5, ACCU
+0b23:	MOV	ACCU, T2
+0b25:	MUL	ACCU, #16
+0b28:	LEA	T6, words + 0
+0b2c:	ADD	T6, ACCU
+0b2e:	MOV	ACCU, T5
+0b30:	MOV	P0, ACCU
+0b32:	LEA	P2, 0(FP)
+0b36:	JSR	strcmp + 0
+0b39:	BLEF	$0AA9
+0b3c:	MOV	ADDR, T6
+0b3e:	MOV	ACCU, T5
+0b40:	STRCPY
+0b41:	ADD	T5, #$FFF0
+0b45:	ADD	T6, #$FFF0
+0b49:	ADD	T4, #$FFFF
+0b4d:	MOV	ACCU, T4
+0b4f:	BGT	$0B2E
+0b51:	JUMPF	$0AA9
+0b54:	LEA	T3, buffer + 0
+0b58:	MOV	ACCU, T3
+0b5a:	MOV	T4, ACCU
+0b5c:	MOV	ADDR, T3
+0b5e:	MOVUB	ACCU, 0(ADDR)
+0b61:	CMPUB	ACCU, #$006F
+0b63:	BNE	$0B69
+0b65:	ADD	T2, #$0001
+0b69:	ADD	T3, #$0001
+0b6d:	MOV	ADDR, T4
+0b6f:	MOVUB	ACCU, 1(ADDR)
+0b72:	BNE	$0B58
+0b74:	JUMPF	$0A5D
+0b77:	LEA	T3, buffer + 0
+0b7b:	MOV	ACCU, T3
+0b7d:	LEAX	ADDR, T2 + ACCU
+0b7f:	MOVUB	ACCU, 1(ADDR)
+0b82:	ADD	T2, #$0001
+0b86:	BNE	$0B7B
+0b88:	JUMPF	$0A4F
+--------------------------------------------------------------------
+strcat:
+0b8b : ea __ __ NOP
+0b8c : a5 0f __ LDA P2
+0b8e : 85 43 __ STA T0 + 0
+0b90 : a5 10 __ LDA P3
+0b92 : 85 44 __ STA T0 + 1
+0b94 : a5 0d __ LDA P0
+0b96 : 85 45 __ STA T1 + 0
+0b98 : a5 0e __ LDA P1
+0b9a : 85 46 __ STA T1 + 1
+0b9c : a0 00 __ LDY #$00
+0b9e : b1 0d __ LDA (P0),y
+0ba0 : f0 14 __ BEQ $0bb6
+0ba2 : a5 45 __ LDA T1 + 0
+0ba4 : 85 48 __ STA T3 + 0
+0ba6 : a5 46 __ LDA T1 + 1
+0ba8 : 85 49 __ STA T3 + 1
+0baa : e6 45 __ INC T1 + 0
+0bac : d0 02 __ BNE $0bb0
+0bae : e6 46 __ INC T1 + 1
+0bb0 : a0 01 __ LDY #$01
+0bb2 : b1 48 __ LDA (T3 + 0),y
+0bb4 : d0 ec __ BNE $0ba2
+0bb6 : a0 00 __ LDY #$00
+0bb8 : b1 43 __ LDA (T0 + 0),y
+0bba : aa __ __ TAX
+0bbb : 91 45 __ STA (T1 + 0),y
+0bbd : e6 45 __ INC T1 + 0
+0bbf : d0 02 __ BNE $0bc3
+0bc1 : e6 46 __ INC T1 + 1
+0bc3 : e6 43 __ INC T0 + 0
+0bc5 : d0 02 __ BNE $0bc9
+0bc7 : e6 44 __ INC T0 + 1
+0bc9 : 8a __ __ TXA
+0bca : d0 ea __ BNE $0bb6
+0bcc : a5 0d __ LDA P0
+0bce : 85 1b __ STA ACCU + 0
+0bd0 : a5 0e __ LDA P1
+0bd2 : 85 1c __ STA ACCU + 1
+0bd4 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0c2b : ea __ __ NOP
+0c2c : a0 00 __ LDY #$00
+0c2e : 84 1c __ STY ACCU + 1
+0c30 : b1 0d __ LDA (P0),y
+0c32 : f0 16 __ BEQ $0c4a
+0c34 : d1 0f __ CMP (P2),y
+0c36 : d0 16 __ BNE $0c4e
+0c38 : c8 __ __ INY
+0c39 : b1 0d __ LDA (P0),y
+0c3b : f0 0d __ BEQ $0c4a
+0c3d : d1 0f __ CMP (P2),y
+0c3f : d0 0d __ BNE $0c4e
+0c41 : c8 __ __ INY
+0c42 : d0 ec __ BNE $0c30
+0c44 : e6 0e __ INC P1
+0c46 : e6 10 __ INC P3
+0c48 : d0 e6 __ BNE $0c30
+0c4a : d1 0f __ CMP (P2),y
+0c4c : f0 0a __ BEQ $0c58
+0c4e : b0 06 __ BCS $0c56
+0c50 : a9 ff __ LDA #$ff
+0c52 : 85 1c __ STA ACCU + 1
+0c54 : 30 02 __ BMI $0c58
+0c56 : a9 01 __ LDA #$01
+0c58 : 85 1b __ STA ACCU + 0
+0c5a : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0c5b : 38 __ __ SEC
+0c5c : a9 00 __ LDA #$00
+0c5e : e5 1b __ SBC ACCU + 0
+0c60 : 85 1b __ STA ACCU + 0
+0c62 : a9 00 __ LDA #$00
+0c64 : e5 1c __ SBC ACCU + 1
+0c66 : 85 1c __ STA ACCU + 1
+0c68 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0c69 : 38 __ __ SEC
+0c6a : a9 00 __ LDA #$00
+0c6c : e5 03 __ SBC $03
+0c6e : 85 03 __ STA $03
+0c70 : a9 00 __ LDA #$00
+0c72 : e5 04 __ SBC $04
+0c74 : 85 04 __ STA $04
+0c76 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0c77 : a5 1c __ LDA ACCU + 1
+0c79 : d0 31 __ BNE $0cac
+0c7b : a5 04 __ LDA $04
+0c7d : d0 1e __ BNE $0c9d
+0c7f : 85 06 __ STA $06
+0c81 : a2 04 __ LDX #$04
+0c83 : 06 1b __ ASL ACCU + 0
+0c85 : 2a __ __ ROL
+0c86 : c5 03 __ CMP $03
+0c88 : 90 02 __ BCC $0c8c
+0c8a : e5 03 __ SBC $03
+0c8c : 26 1b __ ROL ACCU + 0
+0c8e : 2a __ __ ROL
+0c8f : c5 03 __ CMP $03
+0c91 : 90 02 __ BCC $0c95
+0c93 : e5 03 __ SBC $03
+0c95 : 26 1b __ ROL ACCU + 0
+0c97 : ca __ __ DEX
+0c98 : d0 eb __ BNE $0c85
+0c9a : 85 05 __ STA $05
+0c9c : 60 __ __ RTS
+0c9d : a5 1b __ LDA ACCU + 0
+0c9f : 85 05 __ STA $05
+0ca1 : a5 1c __ LDA ACCU + 1
+0ca3 : 85 06 __ STA $06
+0ca5 : a9 00 __ LDA #$00
+0ca7 : 85 1b __ STA ACCU + 0
+0ca9 : 85 1c __ STA ACCU + 1
+0cab : 60 __ __ RTS
+0cac : a5 04 __ LDA $04
+0cae : d0 1f __ BNE $0ccf
+0cb0 : a5 03 __ LDA $03
+0cb2 : 30 1b __ BMI $0ccf
+0cb4 : a9 00 __ LDA #$00
+0cb6 : 85 06 __ STA $06
+0cb8 : a2 10 __ LDX #$10
+0cba : 06 1b __ ASL ACCU + 0
+0cbc : 26 1c __ ROL ACCU + 1
+0cbe : 2a __ __ ROL
+0cbf : c5 03 __ CMP $03
+0cc1 : 90 02 __ BCC $0cc5
+0cc3 : e5 03 __ SBC $03
+0cc5 : 26 1b __ ROL ACCU + 0
+0cc7 : 26 1c __ ROL ACCU + 1
+0cc9 : ca __ __ DEX
+0cca : d0 f2 __ BNE $0cbe
+0ccc : 85 05 __ STA $05
+0cce : 60 __ __ RTS
+0ccf : a9 00 __ LDA #$00
+0cd1 : 85 05 __ STA $05
+0cd3 : 85 06 __ STA $06
+0cd5 : 84 02 __ STY $02
+0cd7 : a0 10 __ LDY #$10
+0cd9 : 18 __ __ CLC
+0cda : 26 1b __ ROL ACCU + 0
+0cdc : 26 1c __ ROL ACCU + 1
+0cde : 26 05 __ ROL $05
+0ce0 : 26 06 __ ROL $06
+0ce2 : 38 __ __ SEC
+0ce3 : a5 05 __ LDA $05
+0ce5 : e5 03 __ SBC $03
+0ce7 : aa __ __ TAX
+0ce8 : a5 06 __ LDA $06
+0cea : e5 04 __ SBC $04
+0cec : 90 04 __ BCC $0cf2
+0cee : 86 05 __ STX $05
+0cf0 : 85 06 __ STA $06
+0cf2 : 88 __ __ DEY
+0cf3 : d0 e5 __ BNE $0cda
+0cf5 : 26 1b __ ROL ACCU + 0
+0cf7 : 26 1c __ ROL ACCU + 1
+0cf9 : a4 02 __ LDY $02
+0cfb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0cfc : a9 4c __ LDA #$4c
+0cfe : 85 54 __ STA $54
+0d00 : a9 00 __ LDA #$00
+0d02 : 85 13 __ STA P6
+0d04 : a9 19 __ LDA #$19
+0d06 : 85 16 __ STA P9
+0d08 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0d09 : b1 19 __ LDA (IP + 0),y
+0d0b : aa __ __ TAX
+0d0c : c8 __ __ INY
+0d0d : b1 19 __ LDA (IP + 0),y
+0d0f : 95 00 __ STA $00,x
+0d11 : a9 00 __ LDA #$00
+0d13 : 95 01 __ STA $01,x
+0d15 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0d18 : b1 19 __ LDA (IP + 0),y
+0d1a : aa __ __ TAX
+0d1b : b5 00 __ LDA $00,x
+0d1d : 85 1b __ STA ACCU + 0
+0d1f : b5 01 __ LDA $01,x
+0d21 : 85 1c __ STA ACCU + 1
+0d23 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0d26 : b1 19 __ LDA (IP + 0),y
+0d28 : aa __ __ TAX
+0d29 : a5 1b __ LDA ACCU + 0
+0d2b : 95 00 __ STA $00,x
+0d2d : a5 1c __ LDA ACCU + 1
+0d2f : 95 01 __ STA $01,x
+0d31 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0d34 : b1 19 __ LDA (IP + 0),y
+0d36 : aa __ __ TAX
+0d37 : b5 00 __ LDA $00,x
+0d39 : 85 1f __ STA ADDR + 0
+0d3b : b5 01 __ LDA $01,x
+0d3d : 85 20 __ STA ADDR + 1
+0d3f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0d42 : b1 19 __ LDA (IP + 0),y
+0d44 : 85 1f __ STA ADDR + 0
+0d46 : c8 __ __ INY
+0d47 : b1 19 __ LDA (IP + 0),y
+0d49 : 85 20 __ STA ADDR + 1
+0d4b : c8 __ __ INY
+0d4c : b1 19 __ LDA (IP + 0),y
+0d4e : aa __ __ TAX
+0d4f : 84 02 __ STY $02
+0d51 : a0 00 __ LDY #$00
+0d53 : b1 1f __ LDA (ADDR + 0),y
+0d55 : 95 00 __ STA $00,x
+0d57 : a9 00 __ LDA #$00
+0d59 : 95 01 __ STA $01,x
+0d5b : a4 02 __ LDY $02
+0d5d : 4c 50 08 JMP $0850 ; (startup + 79)
+0d60 : b1 19 __ LDA (IP + 0),y
+0d62 : aa __ __ TAX
+0d63 : c8 __ __ INY
+0d64 : b1 19 __ LDA (IP + 0),y
+0d66 : 84 02 __ STY $02
+0d68 : a8 __ __ TAY
+0d69 : 4c 53 0d JMP $0d53 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0d6c : b1 19 __ LDA (IP + 0),y
+0d6e : 85 1f __ STA ADDR + 0
+0d70 : c8 __ __ INY
+0d71 : b1 19 __ LDA (IP + 0),y
+0d73 : 85 20 __ STA ADDR + 1
+0d75 : c8 __ __ INY
+0d76 : b1 19 __ LDA (IP + 0),y
+0d78 : aa __ __ TAX
+0d79 : 84 02 __ STY $02
+0d7b : a0 00 __ LDY #$00
+0d7d : b5 00 __ LDA $00,x
+0d7f : 91 1f __ STA (ADDR + 0),y
+0d81 : a4 02 __ LDY $02
+0d83 : 4c 50 08 JMP $0850 ; (startup + 79)
+0d86 : b1 19 __ LDA (IP + 0),y
+0d88 : aa __ __ TAX
+0d89 : c8 __ __ INY
+0d8a : b1 19 __ LDA (IP + 0),y
+0d8c : 84 02 __ STY $02
+0d8e : a8 __ __ TAY
+0d8f : 4c 7d 0d JMP $0d7d ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+0d92 : b1 19 __ LDA (IP + 0),y
+0d94 : aa __ __ TAX
+0d95 : c8 __ __ INY
+0d96 : b1 19 __ LDA (IP + 0),y
+0d98 : 95 00 __ STA $00,x
+0d9a : c8 __ __ INY
+0d9b : b1 19 __ LDA (IP + 0),y
+0d9d : 95 01 __ STA $01,x
+0d9f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+0da2 : b1 19 __ LDA (IP + 0),y
+0da4 : aa __ __ TAX
+0da5 : c8 __ __ INY
+0da6 : 18 __ __ CLC
+0da7 : b5 00 __ LDA $00,x
+0da9 : 71 19 __ ADC (IP + 0),y
+0dab : 85 1f __ STA ADDR + 0
+0dad : c8 __ __ INY
+0dae : b5 01 __ LDA $01,x
+0db0 : 71 19 __ ADC (IP + 0),y
+0db2 : 85 20 __ STA ADDR + 1
+0db4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+0db7 : b1 19 __ LDA (IP + 0),y
+0db9 : aa __ __ TAX
+0dba : 18 __ __ CLC
+0dbb : b5 00 __ LDA $00,x
+0dbd : 65 1b __ ADC ACCU + 0
+0dbf : 85 1f __ STA ADDR + 0
+0dc1 : b5 01 __ LDA $01,x
+0dc3 : 65 1c __ ADC ACCU + 1
+0dc5 : 85 20 __ STA ADDR + 1
+0dc7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+0dca : b1 19 __ LDA (IP + 0),y
+0dcc : aa __ __ TAX
+0dcd : c8 __ __ INY
+0dce : 18 __ __ CLC
+0dcf : b1 19 __ LDA (IP + 0),y
+0dd1 : 65 25 __ ADC FP + 0
+0dd3 : 95 00 __ STA $00,x
+0dd5 : c8 __ __ INY
+0dd6 : b1 19 __ LDA (IP + 0),y
+0dd8 : 65 26 __ ADC FP + 1
+0dda : 95 01 __ STA $01,x
+0ddc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0ddf : b1 19 __ LDA (IP + 0),y
+0de1 : 85 1f __ STA ADDR + 0
+0de3 : c8 __ __ INY
+0de4 : b1 19 __ LDA (IP + 0),y
+0de6 : 85 20 __ STA ADDR + 1
+0de8 : c8 __ __ INY
+0de9 : b1 19 __ LDA (IP + 0),y
+0deb : aa __ __ TAX
+0dec : 84 02 __ STY $02
+0dee : a0 00 __ LDY #$00
+0df0 : b1 1f __ LDA (ADDR + 0),y
+0df2 : 95 00 __ STA $00,x
+0df4 : c8 __ __ INY
+0df5 : b1 1f __ LDA (ADDR + 0),y
+0df7 : 95 01 __ STA $01,x
+0df9 : a4 02 __ LDY $02
+0dfb : 4c 50 08 JMP $0850 ; (startup + 79)
+0dfe : b1 19 __ LDA (IP + 0),y
+0e00 : aa __ __ TAX
+0e01 : c8 __ __ INY
+0e02 : b1 19 __ LDA (IP + 0),y
+0e04 : 84 02 __ STY $02
+0e06 : a8 __ __ TAY
+0e07 : 4c f0 0d JMP $0df0 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+0e0a : b1 19 __ LDA (IP + 0),y
+0e0c : aa __ __ TAX
+0e0d : 18 __ __ CLC
+0e0e : a5 1b __ LDA ACCU + 0
+0e10 : 75 00 __ ADC $00,x
+0e12 : 85 1b __ STA ACCU + 0
+0e14 : a5 1c __ LDA ACCU + 1
+0e16 : 75 01 __ ADC $01,x
+0e18 : 85 1c __ STA ACCU + 1
+0e1a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+0e1d : b1 19 __ LDA (IP + 0),y
+0e1f : aa __ __ TAX
+0e20 : b5 00 __ LDA $00,x
+0e22 : 85 03 __ STA $03
+0e24 : b5 01 __ LDA $01,x
+0e26 : 85 04 __ STA $04
+0e28 : 24 1c __ BIT ACCU + 1
+0e2a : 10 18 __ BPL $0e44
+0e2c : 20 5b 0c JSR $0c5b ; (negaccu + 0)
+0e2f : 24 04 __ BIT $04
+0e31 : 10 18 __ BPL $0e4b
+0e33 : 20 69 0c JSR $0c69 ; (negtmp + 0)
+0e36 : 20 77 0c JSR $0c77 ; (divmod + 0)
+0e39 : a5 05 __ LDA $05
+0e3b : 85 1b __ STA ACCU + 0
+0e3d : a5 06 __ LDA $06
+0e3f : 85 1c __ STA ACCU + 1
+0e41 : 4c 50 08 JMP $0850 ; (startup + 79)
+0e44 : 24 04 __ BIT $04
+0e46 : 10 ee __ BPL $0e36
+0e48 : 20 69 0c JSR $0c69 ; (negtmp + 0)
+0e4b : 20 77 0c JSR $0c77 ; (divmod + 0)
+0e4e : a5 05 __ LDA $05
+0e50 : 85 1b __ STA ACCU + 0
+0e52 : a5 06 __ LDA $06
+0e54 : 85 1c __ STA ACCU + 1
+0e56 : 20 5b 0c JSR $0c5b ; (negaccu + 0)
+0e59 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+0e5c : b1 19 __ LDA (IP + 0),y
+0e5e : aa __ __ TAX
+0e5f : 18 __ __ CLC
+0e60 : b5 00 __ LDA $00,x
+0e62 : 65 1b __ ADC ACCU + 0
+0e64 : 95 00 __ STA $00,x
+0e66 : b5 01 __ LDA $01,x
+0e68 : 65 1c __ ADC ACCU + 1
+0e6a : 95 01 __ STA $01,x
+0e6c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0e6f : b1 19 __ LDA (IP + 0),y
+0e71 : c8 __ __ INY
+0e72 : aa __ __ TAX
+0e73 : 18 __ __ CLC
+0e74 : b5 00 __ LDA $00,x
+0e76 : 71 19 __ ADC (IP + 0),y
+0e78 : c8 __ __ INY
+0e79 : 95 00 __ STA $00,x
+0e7b : b5 01 __ LDA $01,x
+0e7d : 71 19 __ ADC (IP + 0),y
+0e7f : 95 01 __ STA $01,x
+0e81 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+0e84 : b1 19 __ LDA (IP + 0),y
+0e86 : c8 __ __ INY
+0e87 : aa __ __ TAX
+0e88 : a9 00 __ LDA #$00
+0e8a : 85 05 __ STA $05
+0e8c : 85 06 __ STA $06
+0e8e : b5 00 __ LDA $00,x
+0e90 : 85 03 __ STA $03
+0e92 : b5 01 __ LDA $01,x
+0e94 : 85 04 __ STA $04
+0e96 : b1 19 __ LDA (IP + 0),y
+0e98 : 4a __ __ LSR
+0e99 : 85 07 __ STA $07
+0e9b : 90 0d __ BCC $0eaa
+0e9d : 18 __ __ CLC
+0e9e : a5 05 __ LDA $05
+0ea0 : 65 03 __ ADC $03
+0ea2 : 85 05 __ STA $05
+0ea4 : a5 06 __ LDA $06
+0ea6 : 65 04 __ ADC $04
+0ea8 : 85 06 __ STA $06
+0eaa : 06 03 __ ASL $03
+0eac : 26 04 __ ROL $04
+0eae : 46 07 __ LSR $07
+0eb0 : b0 eb __ BCS $0e9d
+0eb2 : d0 f6 __ BNE $0eaa
+0eb4 : a5 05 __ LDA $05
+0eb6 : 95 00 __ STA $00,x
+0eb8 : a5 06 __ LDA $06
+0eba : 95 01 __ STA $01,x
+0ebc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0ebf : b1 19 __ LDA (IP + 0),y
+0ec1 : aa __ __ TAX
+0ec2 : b5 00 __ LDA $00,x
+0ec4 : 2c b1 19 BIT $19b1 
+0ec7 : 29 0f __ AND #$0f
+0ec9 : f0 0b __ BEQ $0ed6
+0ecb : aa __ __ TAX
+0ecc : a5 1c __ LDA ACCU + 1
+0ece : 06 1b __ ASL ACCU + 0
+0ed0 : 2a __ __ ROL
+0ed1 : ca __ __ DEX
+0ed2 : d0 fa __ BNE $0ece
+0ed4 : 85 1c __ STA ACCU + 1
+0ed6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0ed9 : b1 19 __ LDA (IP + 0),y
+0edb : aa __ __ TAX
+0edc : 38 __ __ SEC
+0edd : b5 01 __ LDA $01,x
+0edf : e5 1c __ SBC ACCU + 1
+0ee1 : f0 11 __ BEQ $0ef4
+0ee3 : 50 02 __ BVC $0ee7
+0ee5 : 49 80 __ EOR #$80
+0ee7 : 30 2a __ BMI $0f13
+0ee9 : 10 33 __ BPL $0f1e
+0eeb : b1 19 __ LDA (IP + 0),y
+0eed : aa __ __ TAX
+0eee : b5 01 __ LDA $01,x
+0ef0 : c5 1c __ CMP ACCU + 1
+0ef2 : d0 28 __ BNE $0f1c
+0ef4 : b5 00 __ LDA $00,x
+0ef6 : c5 1b __ CMP ACCU + 0
+0ef8 : d0 22 __ BNE $0f1c
+0efa : f0 0e __ BEQ $0f0a
+0efc : b1 19 __ LDA (IP + 0),y
+0efe : aa __ __ TAX
+0eff : c8 __ __ INY
+0f00 : b1 19 __ LDA (IP + 0),y
+0f02 : c5 1c __ CMP ACCU + 1
+0f04 : d0 16 __ BNE $0f1c
+0f06 : e4 1b __ CPX ACCU + 0
+0f08 : d0 12 __ BNE $0f1c
+0f0a : a9 00 __ LDA #$00
+0f0c : 85 1b __ STA ACCU + 0
+0f0e : 85 1c __ STA ACCU + 1
+0f10 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f13 : a9 ff __ LDA #$ff
+0f15 : 85 1b __ STA ACCU + 0
+0f17 : 85 1c __ STA ACCU + 1
+0f19 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f1c : 90 f5 __ BCC $0f13
+0f1e : a9 01 __ LDA #$01
+0f20 : 85 1b __ STA ACCU + 0
+0f22 : a9 00 __ LDA #$00
+0f24 : 85 1c __ STA ACCU + 1
+0f26 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f29 : b1 19 __ LDA (IP + 0),y
+0f2b : c8 __ __ INY
+0f2c : aa __ __ TAX
+0f2d : b1 19 __ LDA (IP + 0),y
+0f2f : 38 __ __ SEC
+0f30 : e5 1c __ SBC ACCU + 1
+0f32 : d0 af __ BNE $0ee3
+0f34 : e4 1b __ CPX ACCU + 0
+0f36 : d0 e4 __ BNE $0f1c
+0f38 : f0 d0 __ BEQ $0f0a
+0f3a : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+0f3b : b1 19 __ LDA (IP + 0),y
+0f3d : aa __ __ TAX
+0f3e : 38 __ __ SEC
+0f3f : b5 00 __ LDA $00,x
+0f41 : e5 1b __ SBC ACCU + 0
+0f43 : f0 19 __ BEQ $0f5e
+0f45 : 50 02 __ BVC $0f49
+0f47 : 49 80 __ EOR #$80
+0f49 : 30 1c __ BMI $0f67
+0f4b : 10 25 __ BPL $0f72
+0f4d : b1 19 __ LDA (IP + 0),y
+0f4f : aa __ __ TAX
+0f50 : b5 00 __ LDA $00,x
+0f52 : c5 1b __ CMP ACCU + 0
+0f54 : d0 1a __ BNE $0f70
+0f56 : f0 06 __ BEQ $0f5e
+0f58 : b1 19 __ LDA (IP + 0),y
+0f5a : c5 1b __ CMP ACCU + 0
+0f5c : d0 12 __ BNE $0f70
+0f5e : a9 00 __ LDA #$00
+0f60 : 85 1b __ STA ACCU + 0
+0f62 : 85 1c __ STA ACCU + 1
+0f64 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f67 : a9 ff __ LDA #$ff
+0f69 : 85 1b __ STA ACCU + 0
+0f6b : 85 1c __ STA ACCU + 1
+0f6d : 4c 50 08 JMP $0850 ; (startup + 79)
+0f70 : 90 f5 __ BCC $0f67
+0f72 : a9 01 __ LDA #$01
+0f74 : 85 1b __ STA ACCU + 0
+0f76 : a9 00 __ LDA #$00
+0f78 : 85 1c __ STA ACCU + 1
+0f7a : 4c 50 08 JMP $0850 ; (startup + 79)
+0f7d : b1 19 __ LDA (IP + 0),y
+0f7f : 38 __ __ SEC
+0f80 : e5 1b __ SBC ACCU + 0
+0f82 : d0 c1 __ BNE $0f45
+0f84 : f0 d8 __ BEQ $0f5e
+0f86 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+0f87 : b1 19 __ LDA (IP + 0),y
+0f89 : 30 0c __ BMI $0f97
+0f8b : 38 __ __ SEC
+0f8c : 65 19 __ ADC IP + 0
+0f8e : 85 19 __ STA IP + 0
+0f90 : 90 02 __ BCC $0f94
+0f92 : e6 1a __ INC IP + 1
+0f94 : 4c 51 08 JMP $0851 ; (startup + 80)
+0f97 : 38 __ __ SEC
+0f98 : 65 19 __ ADC IP + 0
+0f9a : 85 19 __ STA IP + 0
+0f9c : b0 02 __ BCS $0fa0
+0f9e : c6 1a __ DEC IP + 1
+0fa0 : 4c 51 08 JMP $0851 ; (startup + 80)
+0fa3 : a5 1b __ LDA ACCU + 0
+0fa5 : 05 1c __ ORA ACCU + 1
+0fa7 : f0 de __ BEQ $0f87
+0fa9 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fac : a5 1b __ LDA ACCU + 0
+0fae : 05 1c __ ORA ACCU + 1
+0fb0 : d0 d5 __ BNE $0f87
+0fb2 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fb5 : a5 1c __ LDA ACCU + 1
+0fb7 : 30 04 __ BMI $0fbd
+0fb9 : 05 1b __ ORA ACCU + 0
+0fbb : d0 ca __ BNE $0f87
+0fbd : 4c 50 08 JMP $0850 ; (startup + 79)
+0fc0 : a5 1c __ LDA ACCU + 1
+0fc2 : 10 c3 __ BPL $0f87
+0fc4 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fc7 : a5 1c __ LDA ACCU + 1
+0fc9 : 30 bc __ BMI $0f87
+0fcb : 4c 50 08 JMP $0850 ; (startup + 79)
+0fce : a5 1c __ LDA ACCU + 1
+0fd0 : 30 b5 __ BMI $0f87
+0fd2 : 05 1b __ ORA ACCU + 0
+0fd4 : f0 b1 __ BEQ $0f87
+0fd6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+0fd9 : 38 __ __ SEC
+0fda : b1 19 __ LDA (IP + 0),y
+0fdc : 65 19 __ ADC IP + 0
+0fde : aa __ __ TAX
+0fdf : c8 __ __ INY
+0fe0 : b1 19 __ LDA (IP + 0),y
+0fe2 : 65 1a __ ADC IP + 1
+0fe4 : 85 1a __ STA IP + 1
+0fe6 : 86 19 __ STX IP + 0
+0fe8 : 4c 51 08 JMP $0851 ; (startup + 80)
+0feb : a5 1b __ LDA ACCU + 0
+0fed : 05 1c __ ORA ACCU + 1
+0fef : f0 e8 __ BEQ $0fd9
+0ff1 : c8 __ __ INY
+0ff2 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ff5 : a5 1b __ LDA ACCU + 0
+0ff7 : 05 1c __ ORA ACCU + 1
+0ff9 : d0 de __ BNE $0fd9
+0ffb : c8 __ __ INY
+0ffc : 4c 50 08 JMP $0850 ; (startup + 79)
+0fff : a5 1c __ LDA ACCU + 1
+1001 : 30 04 __ BMI $1007
+1003 : 05 1b __ ORA ACCU + 0
+1005 : d0 d2 __ BNE $0fd9
+1007 : c8 __ __ INY
+1008 : 4c 50 08 JMP $0850 ; (startup + 79)
+100b : a5 1c __ LDA ACCU + 1
+100d : 10 ca __ BPL $0fd9
+100f : c8 __ __ INY
+1010 : 4c 50 08 JMP $0850 ; (startup + 79)
+1013 : a5 1c __ LDA ACCU + 1
+1015 : 30 c2 __ BMI $0fd9
+1017 : c8 __ __ INY
+1018 : 4c 50 08 JMP $0850 ; (startup + 79)
+101b : a5 1c __ LDA ACCU + 1
+101d : 30 ba __ BMI $0fd9
+101f : 05 1b __ ORA ACCU + 0
+1021 : f0 b6 __ BEQ $0fd9
+1023 : c8 __ __ INY
+1024 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+1027 : b1 19 __ LDA (IP + 0),y
+1029 : 8d 3d 10 STA $103d ; (inp_jsr + 22)
+102c : c8 __ __ INY
+102d : b1 19 __ LDA (IP + 0),y
+102f : 8d 3e 10 STA $103e ; (inp_jsr + 23)
+1032 : 98 __ __ TYA
+1033 : 38 __ __ SEC
+1034 : 65 19 __ ADC IP + 0
+1036 : 85 19 __ STA IP + 0
+1038 : 90 02 __ BCC $103c
+103a : e6 1a __ INC IP + 1
+103c : 20 00 00 JSR $0000 
+103f : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+1042 : 98 __ __ TYA
+1043 : 18 __ __ CLC
+1044 : 65 19 __ ADC IP + 0
+1046 : 8d 51 10 STA $1051 ; (inp_native + 15)
+1049 : a5 1a __ LDA IP + 1
+104b : 69 00 __ ADC #$00
+104d : 8d 52 10 STA $1052 ; (inp_native + 16)
+1050 : 20 00 00 JSR $0000 
+1053 : a0 00 __ LDY #$00
+1055 : b1 23 __ LDA (SP + 0),y
+1057 : 85 19 __ STA IP + 0
+1059 : c8 __ __ INY
+105a : b1 23 __ LDA (SP + 0),y
+105c : 85 1a __ STA IP + 1
+105e : 88 __ __ DEY
+105f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+1062 : 38 __ __ SEC
+1063 : a5 23 __ LDA SP + 0
+1065 : f1 19 __ SBC (IP + 0),y
+1067 : c8 __ __ INY
+1068 : 85 23 __ STA SP + 0
+106a : a5 24 __ LDA SP + 1
+106c : f1 19 __ SBC (IP + 0),y
+106e : c8 __ __ INY
+106f : 85 24 __ STA SP + 1
+1071 : b1 19 __ LDA (IP + 0),y
+1073 : 84 02 __ STY $02
+1075 : a8 __ __ TAY
+1076 : a5 25 __ LDA FP + 0
+1078 : 91 23 __ STA (SP + 0),y
+107a : c8 __ __ INY
+107b : a5 26 __ LDA FP + 1
+107d : 91 23 __ STA (SP + 0),y
+107f : 98 __ __ TYA
+1080 : 38 __ __ SEC
+1081 : 65 23 __ ADC SP + 0
+1083 : 85 25 __ STA FP + 0
+1085 : a9 00 __ LDA #$00
+1087 : 65 24 __ ADC SP + 1
+1089 : 85 26 __ STA FP + 1
+108b : 88 __ __ DEY
+108c : f0 08 __ BEQ $1096
+108e : b9 52 00 LDA $0052,y 
+1091 : 88 __ __ DEY
+1092 : 91 23 __ STA (SP + 0),y
+1094 : d0 f8 __ BNE $108e
+1096 : a4 02 __ LDY $02
+1098 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+109b : b1 19 __ LDA (IP + 0),y
+109d : c8 __ __ INY
+109e : 84 02 __ STY $02
+10a0 : a8 __ __ TAY
+10a1 : b1 23 __ LDA (SP + 0),y
+10a3 : 85 25 __ STA FP + 0
+10a5 : c8 __ __ INY
+10a6 : b1 23 __ LDA (SP + 0),y
+10a8 : 85 26 __ STA FP + 1
+10aa : 88 __ __ DEY
+10ab : f0 09 __ BEQ $10b6
+10ad : 88 __ __ DEY
+10ae : b1 23 __ LDA (SP + 0),y
+10b0 : 99 53 00 STA $0053,y 
+10b3 : 88 __ __ DEY
+10b4 : 10 f8 __ BPL $10ae
+10b6 : a4 02 __ LDY $02
+10b8 : 18 __ __ CLC
+10b9 : b1 19 __ LDA (IP + 0),y
+10bb : c8 __ __ INY
+10bc : 65 23 __ ADC SP + 0
+10be : 85 23 __ STA SP + 0
+10c0 : b1 19 __ LDA (IP + 0),y
+10c2 : c8 __ __ INY
+10c3 : 65 24 __ ADC SP + 1
+10c5 : 85 24 __ STA SP + 1
+10c7 : a0 01 __ LDY #$01
+10c9 : b1 23 __ LDA (SP + 0),y
+10cb : 85 1a __ STA IP + 1
+10cd : 88 __ __ DEY
+10ce : b1 23 __ LDA (SP + 0),y
+10d0 : 85 19 __ STA IP + 0
+10d2 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+10d5 : b1 19 __ LDA (IP + 0),y
+10d7 : 85 1f __ STA ADDR + 0
+10d9 : c8 __ __ INY
+10da : b1 19 __ LDA (IP + 0),y
+10dc : 85 20 __ STA ADDR + 1
+10de : c8 __ __ INY
+10df : 98 __ __ TYA
+10e0 : a0 00 __ LDY #$00
+10e2 : 18 __ __ CLC
+10e3 : 65 19 __ ADC IP + 0
+10e5 : 91 23 __ STA (SP + 0),y
+10e7 : c8 __ __ INY
+10e8 : a5 1a __ LDA IP + 1
+10ea : 69 00 __ ADC #$00
+10ec : 91 23 __ STA (SP + 0),y
+10ee : a5 1f __ LDA ADDR + 0
+10f0 : 85 19 __ STA IP + 0
+10f2 : a5 20 __ LDA ADDR + 1
+10f4 : 85 1a __ STA IP + 1
+10f6 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+10f9 : 38 __ __ SEC
+10fa : a5 23 __ LDA SP + 0
+10fc : f1 19 __ SBC (IP + 0),y
+10fe : c8 __ __ INY
+10ff : 85 23 __ STA SP + 0
+1101 : a5 24 __ LDA SP + 1
+1103 : f1 19 __ SBC (IP + 0),y
+1105 : 85 24 __ STA SP + 1
+1107 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+110a : 18 __ __ CLC
+110b : b1 19 __ LDA (IP + 0),y
+110d : c8 __ __ INY
+110e : 65 23 __ ADC SP + 0
+1110 : 85 23 __ STA SP + 0
+1112 : b1 19 __ LDA (IP + 0),y
+1114 : 65 24 __ ADC SP + 1
+1116 : 85 24 __ STA SP + 1
+1118 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+111b : 84 02 __ STY $02
+111d : a0 ff __ LDY #$ff
+111f : c8 __ __ INY
+1120 : b1 1b __ LDA (ACCU + 0),y
+1122 : 91 1f __ STA (ADDR + 0),y
+1124 : d0 f9 __ BNE $111f
+1126 : a4 02 __ LDY $02
+1128 : 4c 51 08 JMP $0851 ; (startup + 80)
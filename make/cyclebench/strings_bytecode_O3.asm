@@ -0,0 +1,1010 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 55 11 STX $1155 ; (spentry + 0)
+0811 : a9 78 __ LDA #$78
+0813 : 85 19 __ STA IP + 0
+0815 : a9 11 __ LDA #$11
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 13 __ LDA #$13
+081c : e9 11 __ SBC #$11
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 78 __ LDA #$78
+0832 : e9 78 __ SBC #$78
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	2, 20
+0a04:	PUSH	#$0002
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	MOV	ACCU, #0
+0a10:	MOVB	buffer + 0, ACCU
+0a14:	LEA	T2, buffer + 0
+0a18:	LEA	T3, text + 0
+0a1c:	LEA	T4, buffer + 0
+0a20:	MOV	ADDR, T3
+0a22:	MOV	T5, 0(ADDR)
+0a25:	MOVUB	ACCU, buffer + 0
+0a29:	BEQ	$0A36
+0a2b:	MOV	ADDR, T4
+0a2d:	MOVUB	ACCU, 1(ADDR)
+0a30:	ADD	T4, #$0001
+0a34:	BNE	$0A2B
+0a36:	MOV	ADDR, T5
+0a38:	MOVB	T6, 0(ADDR)
+0a3b:	MOV	ADDR, T4
+0a3d:	MOVB	0(ADDR), T6
+0a40:	ADD	T4, #$0001
+0a44:	ADD	T5, #$0001
+0a48:	MOVB	ACCU, T6
+0a4a:	BNE	$0A36
+0a4c:	LEA	T4, buffer + 0
+0a50:	LEA	T5, $0c1f
+0a54:	MOVUB	ACCU, buffer + 0
+0a58:	BEQ	$0A65
+0a5a:	MOV	ADDR, T4
+0a5c:	MOVUB	ACCU, 1(ADDR)
+0a5f:	ADD	T4, #$0001
+0a63:	BNE	$0A5A
+0a65:	MOV	ADDR, T5
+0a67:	MOVB	T6, 0(ADDR)
+0a6a:	MOV	ADDR, T4
+0a6c:	MOVB	0(ADDR), T6
+0a6f:	ADD	T4, #$0001
+0a73:	ADD	T5, #$0001
+0a77:	MOVB	ACCU, T6
+0a79:	BNE	$0A65
+0a7b:	ADD	T3, #$0002
+0a7f:	MOV	ACCU, T2
+0a81:	CMPU	ACCU, T3
+0a83:	BLT	$0A1C
+0a85:	MOV	T2, #0
+0a88:	MOVUB	ACCU, buffer + 0
+0a8c:	BNEF	$0BB7
+0a8f:	MOV	ACCU, T2
+0a91:	ADD	T0, ACCU
+0a93:	MOV	T2, #0
+0a96:	MOVUB	ACCU, buffer + 0
+0a9a:	BNEF	$0B94
+0a9d:	MOV	ACCU, T2
+0a9f:	ADD	T0, ACCU
+0aa1:	MOV	T2, #0
+0aa4:	LEA	T3, words + 0
+0aa8:	MOV	ACCU, T2
+0aaa:	MUL	ACCU, #5
+0aad:	ADD	ACCU, T1
+0aaf:	MOV	ADDR, #17
+0ab2:	MODS	ACCU, ADDR
+0ab4:	SHL	ACCU, #1
+0ab6:	LEA	T4, text + 0
+0aba:	ADD	T4, ACCU
+0abc:	MOV	ADDR, T4
+0abe:	MOV	T4, 0(ADDR)
+0ac1:	MOV	ADDR, T3
+0ac3:	MOV	ACCU, T4
+0ac5:	STRCPY
+0ac6:	ADD	T3, #$0010
+0aca:	ADD	T2, #$0001
+0ace:	MOV	ACCU, T2
+0ad0:	CMPS	ACCU, #$0010
+0ad3:	BGT	$0AA8
+0ad5:	MOV	T2, #1
+0ad8:	LEA	T3, words + 16
+0adc:	LEA	ADDR, 0(FP)
+0ae0:	MOV	ACCU, T3
+0ae2:	STRCPY
+0ae3:	MOV	ACCU, T2
+0ae5:	MOV	T4, ACCU
+0ae7:	BGT	$0B52
+0ae9:	MUL	T4, #16
+0aec:	LEAX	ADDR, words + 0 + T4
+0af0:	LEA	ACCU, 0(FP)
+0af4:	STRCPY
+0af5:	ADD	T3, #$0010
+0af9:	ADD	T2, #$0001
+0afd:	MOV	ACCU, T2
+0aff:	CMPS	ACCU, #$0010
+0b02:	BGT	$0ADC
+0b04:	LEA	T2, words + 240
+0b08:	LEA	T3, words + 16
+0b0c:	LEA	T4, words + 0
+0b10:	MOV	ACCU, T4
+0b12:	MOV	P0, ACCU
+0b14:	MOV	ACCU, T3
+0b16:	MOV	P2, ACCU
+0b18:	JSR	strcmp + 0
+0b1b:	BGT	$0B4D
+0b1d:	ADD	T4, #$0010
+0b21:	ADD	T3, #$0010
+0b25:	MOV	ACCU, T2
+0b27:	CMPU	ACCU, T4
+0b29:	BLT	$0B10
+0b2b:	ADD	T1, #$0001
+0b2f:	MOV	ACCU, T1
+0b31:	CMPS	ACCU, #$0014
+0b34:	BGTF	$0A0D
+0b37:	MOV	ACCU, T0
+0b39:	CMPU	ACCU, #$071C
+0b3c:	BNE	$0B43
+0b3e:	MOV	ACCU, #0
+0b41:	JUMP	$0B46
+0b43:	MOV	ACCU, #2
+0b46:	POP	#$0002
+0b49:	RETURN	2, 20
+0b4d:	MOV	ACCU, #1
+0b50:	JUMP	$0B46
+0b52:	MOV	ACCU, T2
+0b54:	ADD	ACCU, #$FFFF
+0b58:	MOV	T5, ACCU
+0b5a:	MUL	T5, #16
+0b5d:	LEA	ACCU, words + 0
+0b61:	ADD	T5, ACCU
+0b63:	MOV	ACCU, T2
+0b65:	MUL	ACCU, #16
+0b68:	LEA	T7, words + 0
+0b6c:	ADD	T7, ACCU
+0b6e:	MOV	ACCU, T5
+0b70:	MOV	P0, ACCU
+0b72:	LEA	P2, 0(FP)
+0b76:	JSR	strcmp + 0
+0b79:	BLEF	$0AE9
+0b7c:	MOV	ADDR, T7
+0b7e:	MOV	ACCU, T5
+0b80:	STRCPY
+0b81:	ADD	T5, #$FFF0
+0b85:	ADD	T7, #$FFF0
+0b89:	ADD	T4, #$FFFF
+0b8d:	MOV	ACCU, T4
+0b8f:	BGT	$0B6E
+0b91:	JUMPF	$0AE9
+0b94:	LEA	T3, buffer + 0
+0b98:	MOV	ACCU, T3
+0b9a:	MOV	T4, ACCU
+0b9c:	MOV	ADDR, T3
+0b9e:	MOVUB	ACCU, 0(ADDR)
+0ba1:	CMPUB	ACCU, #$006F
+0ba3:	BNE	$0BA9
+0ba5:	ADD	T2, #$0001
+0ba9:	ADD	T3, #$0001
+0bad:	MOV	ADDR, T4
+0baf:	MOVUB	ACCU, 1(ADDR)
+0bb2:	BNE	$0B98
+0bb4:	JUMPF	$0A9D
+0bb7:	LEA	T3, buffer + 0
+0bbb:	MOV	ACCU, T3
+0bbd:	LEAX	ADDR, T2 + ACCU
+0bbf:	MOVUB	ACCU, 1(ADDR)
+0bc2:	ADD	T2, #$0001
+0bc6:	BNE	$0BBB
+0bc8:	JUMPF	$0A8F
+--------------------------------------------------------------------
+strcmp:
+0c21 : ea __ __ NOP
+0c22 : a0 00 __ LDY #$00
+0c24 : 84 1c __ STY ACCU + 1
+0c26 : b1 0d __ LDA (P0),y
+0c28 : f0 16 __ BEQ $0c40
+0c2a : d1 0f __ CMP (P2),y
+0c2c : d0 16 __ BNE $0c44
+0c2e : c8 __ __ INY
+0c2f : b1 0d __ LDA (P0),y
+0c31 : f0 0d __ BEQ $0c40
+0c33 : d1 0f __ CMP (P2),y
+0c35 : d0 0d __ BNE $0c44
+0c37 : c8 __ __ INY
+0c38 : d0 ec __ BNE $0c26
+0c3a : e6 0e __ INC P1
+0c3c : e6 10 __ INC P3
+0c3e : d0 e6 __ BNE $0c26
+0c40 : d1 0f __ CMP (P2),y
+0c42 : f0 0a __ BEQ $0c4e
+0c44 : b0 06 __ BCS $0c4c
+0c46 : a9 ff __ LDA #$ff
+0c48 : 85 1c __ STA ACCU + 1
+0c4a : 30 02 __ BMI $0c4e
+0c4c : a9 01 __ LDA #$01
+0c4e : 85 1b __ STA ACCU + 0
+0c50 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0c51 : 38 __ __ SEC
+0c52 : a9 00 __ LDA #$00
+0c54 : e5 1b __ SBC ACCU + 0
+0c56 : 85 1b __ STA ACCU + 0
+0c58 : a9 00 __ LDA #$00
+0c5a : e5 1c __ SBC ACCU + 1
+0c5c : 85 1c __ STA ACCU + 1
+0c5e : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0c5f : 38 __ __ SEC
+0c60 : a9 00 __ LDA #$00
+0c62 : e5 03 __ SBC $03
+0c64 : 85 03 __ STA $03
+0c66 : a9 00 __ LDA #$00
+0c68 : e5 04 __ SBC $04
+0c6a : 85 04 __ STA $04
+0c6c : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0c6d : a5 1c __ LDA ACCU + 1
+0c6f : d0 31 __ BNE $0ca2
+0c71 : a5 04 __ LDA $04
+0c73 : d0 1e __ BNE $0c93
+0c75 : 85 06 __ STA $06
+0c77 : a2 04 __ LDX #$04
+0c79 : 06 1b __ ASL ACCU + 0
+0c7b : 2a __ __ ROL
+0c7c : c5 03 __ CMP $03
+0c7e : 90 02 __ BCC $0c82
+0c80 : e5 03 __ SBC $03
+0c82 : 26 1b __ ROL ACCU + 0
+0c84 : 2a __ __ ROL
+0c85 : c5 03 __ CMP $03
+0c87 : 90 02 __ BCC $0c8b
+0c89 : e5 03 __ SBC $03
+0c8b : 26 1b __ ROL ACCU + 0
+0c8d : ca __ __ DEX
+0c8e : d0 eb __ BNE $0c7b
+0c90 : 85 05 __ STA $05
+0c92 : 60 __ __ RTS
+0c93 : a5 1b __ LDA ACCU + 0
+0c95 : 85 05 __ STA $05
+0c97 : a5 1c __ LDA ACCU + 1
+0c99 : 85 06 __ STA $06
+0c9b : a9 00 __ LDA #$00
+0c9d : 85 1b __ STA ACCU + 0
+0c9f : 85 1c __ STA ACCU + 1
+0ca1 : 60 __ __ RTS
+0ca2 : a5 04 __ LDA $04
+0ca4 : d0 1f __ BNE $0cc5
+0ca6 : a5 03 __ LDA $03
+0ca8 : 30 1b __ BMI $0cc5
+0caa : a9 00 __ LDA #$00
+0cac : 85 06 __ STA $06
+0cae : a2 10 __ LDX #$10
+0cb0 : 06 1b __ ASL ACCU + 0
+0cb2 : 26 1c __ ROL ACCU + 1
+0cb4 : 2a __ __ ROL
+0cb5 : c5 03 __ CMP $03
+0cb7 : 90 02 __ BCC $0cbb
+0cb9 : e5 03 __ SBC $03
+0cbb : 26 1b __ ROL ACCU + 0
+0cbd : 26 1c __ ROL ACCU + 1
+0cbf : ca __ __ DEX
+0cc0 : d0 f2 __ BNE $0cb4
+0cc2 : 85 05 __ STA $05
+0cc4 : 60 __ __ RTS
+0cc5 : a9 00 __ LDA #$00
+0cc7 : 85 05 __ STA $05
+0cc9 : 85 06 __ STA $06
+0ccb : 84 02 __ STY $02
+0ccd : a0 10 __ LDY #$10
+0ccf : 18 __ __ CLC
+0cd0 : 26 1b __ ROL ACCU + 0
+0cd2 : 26 1c __ ROL ACCU + 1
+0cd4 : 26 05 __ ROL $05
+0cd6 : 26 06 __ ROL $06
+0cd8 : 38 __ __ SEC
+0cd9 : a5 05 __ LDA $05
+0cdb : e5 03 __ SBC $03
+0cdd : aa __ __ TAX
+0cde : a5 06 __ LDA $06
+0ce0 : e5 04 __ SBC $04
+0ce2 : 90 04 __ BCC $0ce8
+0ce4 : 86 05 __ STX $05
+0ce6 : 85 06 __ STA $06
+0ce8 : 88 __ __ DEY
+0ce9 : d0 e5 __ BNE $0cd0
+0ceb : 26 1b __ ROL ACCU + 0
+0ced : 26 1c __ ROL ACCU + 1
+0cef : a4 02 __ LDY $02
+0cf1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0cf2 : a9 4c __ LDA #$4c
+0cf4 : 85 54 __ STA $54
+0cf6 : a9 00 __ LDA #$00
+0cf8 : 85 13 __ STA P6
+0cfa : a9 19 __ LDA #$19
+0cfc : 85 16 __ STA P9
+0cfe : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_p8:
+0cff : b1 19 __ LDA (IP + 0),y
+0d01 : aa __ __ TAX
+0d02 : c8 __ __ INY
+0d03 : b1 19 __ LDA (IP + 0),y
+0d05 : 95 00 __ STA $00,x
+0d07 : a9 00 __ LDA #$00
+0d09 : 95 01 __ STA $01,x
+0d0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0d0e : b1 19 __ LDA (IP + 0),y
+0d10 : aa __ __ TAX
+0d11 : b5 00 __ LDA $00,x
+0d13 : 85 1b __ STA ACCU + 0
+0d15 : a9 00 __ LDA #$00
+0d17 : 85 1c __ STA ACCU + 1
+0d19 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0d1c : b1 19 __ LDA (IP + 0),y
+0d1e : aa __ __ TAX
+0d1f : b5 00 __ LDA $00,x
+0d21 : 85 1b __ STA ACCU + 0
+0d23 : b5 01 __ LDA $01,x
+0d25 : 85 1c __ STA ACCU + 1
+0d27 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0d2a : b1 19 __ LDA (IP + 0),y
+0d2c : aa __ __ TAX
+0d2d : a5 1b __ LDA ACCU + 0
+0d2f : 95 00 __ STA $00,x
+0d31 : a5 1c __ LDA ACCU + 1
+0d33 : 95 01 __ STA $01,x
+0d35 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0d38 : b1 19 __ LDA (IP + 0),y
+0d3a : aa __ __ TAX
+0d3b : b5 00 __ LDA $00,x
+0d3d : 85 1f __ STA ADDR + 0
+0d3f : b5 01 __ LDA $01,x
+0d41 : 85 20 __ STA ADDR + 1
+0d43 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0d46 : b1 19 __ LDA (IP + 0),y
+0d48 : 85 1f __ STA ADDR + 0
+0d4a : c8 __ __ INY
+0d4b : b1 19 __ LDA (IP + 0),y
+0d4d : 85 20 __ STA ADDR + 1
+0d4f : c8 __ __ INY
+0d50 : b1 19 __ LDA (IP + 0),y
+0d52 : aa __ __ TAX
+0d53 : 84 02 __ STY $02
+0d55 : a0 00 __ LDY #$00
+0d57 : b1 1f __ LDA (ADDR + 0),y
+0d59 : 95 00 __ STA $00,x
+0d5b : a9 00 __ LDA #$00
+0d5d : 95 01 __ STA $01,x
+0d5f : a4 02 __ LDY $02
+0d61 : 4c 50 08 JMP $0850 ; (startup + 79)
+0d64 : b1 19 __ LDA (IP + 0),y
+0d66 : aa __ __ TAX
+0d67 : c8 __ __ INY
+0d68 : b1 19 __ LDA (IP + 0),y
+0d6a : 84 02 __ STY $02
+0d6c : a8 __ __ TAY
+0d6d : 4c 57 0d JMP $0d57 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0d70 : b1 19 __ LDA (IP + 0),y
+0d72 : 85 1f __ STA ADDR + 0
+0d74 : c8 __ __ INY
+0d75 : b1 19 __ LDA (IP + 0),y
+0d77 : 85 20 __ STA ADDR + 1
+0d79 : c8 __ __ INY
+0d7a : b1 19 __ LDA (IP + 0),y
+0d7c : aa __ __ TAX
+0d7d : 84 02 __ STY $02
+0d7f : a0 00 __ LDY #$00
+0d81 : b5 00 __ LDA $00,x
+0d83 : 91 1f __ STA (ADDR + 0),y
+0d85 : a4 02 __ LDY $02
+0d87 : 4c 50 08 JMP $0850 ; (startup + 79)
+0d8a : b1 19 __ LDA (IP + 0),y
+0d8c : aa __ __ TAX
+0d8d : c8 __ __ INY
+0d8e : b1 19 __ LDA (IP + 0),y
+0d90 : 84 02 __ STY $02
+0d92 : a8 __ __ TAY
+0d93 : 4c 81 0d JMP $0d81 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+0d96 : b1 19 __ LDA (IP + 0),y
+0d98 : aa __ __ TAX
+0d99 : c8 __ __ INY
+0d9a : b1 19 __ LDA (IP + 0),y
+0d9c : 95 00 __ STA $00,x
+0d9e : c8 __ __ INY
+0d9f : b1 19 __ LDA (IP + 0),y
+0da1 : 95 01 __ STA $01,x
+0da3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+0da6 : b1 19 __ LDA (IP + 0),y
+0da8 : aa __ __ TAX
+0da9 : c8 __ __ INY
+0daa : 18 __ __ CLC
+0dab : b5 00 __ LDA $00,x
+0dad : 71 19 __ ADC (IP + 0),y
+0daf : 85 1f __ STA ADDR + 0
+0db1 : c8 __ __ INY
+0db2 : b5 01 __ LDA $01,x
+0db4 : 71 19 __ ADC (IP + 0),y
+0db6 : 85 20 __ STA ADDR + 1
+0db8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+0dbb : b1 19 __ LDA (IP + 0),y
+0dbd : aa __ __ TAX
+0dbe : 18 __ __ CLC
+0dbf : b5 00 __ LDA $00,x
+0dc1 : 65 1b __ ADC ACCU + 0
+0dc3 : 85 1f __ STA ADDR + 0
+0dc5 : b5 01 __ LDA $01,x
+0dc7 : 65 1c __ ADC ACCU + 1
+0dc9 : 85 20 __ STA ADDR + 1
+0dcb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+0dce : b1 19 __ LDA (IP + 0),y
+0dd0 : aa __ __ TAX
+0dd1 : c8 __ __ INY
+0dd2 : 18 __ __ CLC
+0dd3 : b1 19 __ LDA (IP + 0),y
+0dd5 : 65 25 __ ADC FP + 0
+0dd7 : 95 00 __ STA $00,x
+0dd9 : c8 __ __ INY
+0dda : b1 19 __ LDA (IP + 0),y
+0ddc : 65 26 __ ADC FP + 1
+0dde : 95 01 __ STA $01,x
+0de0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+0de3 : b1 19 __ LDA (IP + 0),y
+0de5 : 85 1f __ STA ADDR + 0
+0de7 : c8 __ __ INY
+0de8 : b1 19 __ LDA (IP + 0),y
+0dea : 85 20 __ STA ADDR + 1
+0dec : c8 __ __ INY
+0ded : b1 19 __ LDA (IP + 0),y
+0def : aa __ __ TAX
+0df0 : 84 02 __ STY $02
+0df2 : a0 00 __ LDY #$00
+0df4 : b1 1f __ LDA (ADDR + 0),y
+0df6 : 95 00 __ STA $00,x
+0df8 : a4 02 __ LDY $02
+0dfa : 4c 50 08 JMP $0850 ; (startup + 79)
+0dfd : b1 19 __ LDA (IP + 0),y
+0dff : aa __ __ TAX
+0e00 : c8 __ __ INY
+0e01 : b1 19 __ LDA (IP + 0),y
+0e03 : 84 02 __ STY $02
+0e05 : a8 __ __ TAY
+0e06 : 4c f4 0d JMP $0df4 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0e09 : b1 19 __ LDA (IP + 0),y
+0e0b : 85 1f __ STA ADDR + 0
+0e0d : c8 __ __ INY
+0e0e : b1 19 __ LDA (IP + 0),y
+0e10 : 85 20 __ STA ADDR + 1
+0e12 : c8 __ __ INY
+0e13 : b1 19 __ LDA (IP + 0),y
+0e15 : aa __ __ TAX
+0e16 : 84 02 __ STY $02
+0e18 : a0 00 __ LDY #$00
+0e1a : b1 1f __ LDA (ADDR + 0),y
+0e1c : 95 00 __ STA $00,x
+0e1e : c8 __ __ INY
+0e1f : b1 1f __ LDA (ADDR + 0),y
+0e21 : 95 01 __ STA $01,x
+0e23 : a4 02 __ LDY $02
+0e25 : 4c 50 08 JMP $0850 ; (startup + 79)
+0e28 : b1 19 __ LDA (IP + 0),y
+0e2a : aa __ __ TAX
+0e2b : c8 __ __ INY
+0e2c : b1 19 __ LDA (IP + 0),y
+0e2e : 84 02 __ STY $02
+0e30 : a8 __ __ TAY
+0e31 : 4c 1a 0e JMP $0e1a ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+0e34 : b1 19 __ LDA (IP + 0),y
+0e36 : aa __ __ TAX
+0e37 : 18 __ __ CLC
+0e38 : a5 1b __ LDA ACCU + 0
+0e3a : 75 00 __ ADC $00,x
+0e3c : 85 1b __ STA ACCU + 0
+0e3e : a5 1c __ LDA ACCU + 1
+0e40 : 75 01 __ ADC $01,x
+0e42 : 85 1c __ STA ACCU + 1
+0e44 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+0e47 : b1 19 __ LDA (IP + 0),y
+0e49 : aa __ __ TAX
+0e4a : b5 00 __ LDA $00,x
+0e4c : 85 03 __ STA $03
+0e4e : b5 01 __ LDA $01,x
+0e50 : 85 04 __ STA $04
+0e52 : 24 1c __ BIT ACCU + 1
+0e54 : 10 18 __ BPL $0e6e
+0e56 : 20 51 0c JSR $0c51 ; (negaccu + 0)
+0e59 : 24 04 __ BIT $04
+0e5b : 10 18 __ BPL $0e75
+0e5d : 20 5f 0c JSR $0c5f ; (negtmp + 0)
+0e60 : 20 6d 0c JSR $0c6d ; (divmod + 0)
+0e63 : a5 05 __ LDA $05
+0e65 : 85 1b __ STA ACCU + 0
+0e67 : a5 06 __ LDA $06
+0e69 : 85 1c __ STA ACCU + 1
+0e6b : 4c 50 08 JMP $0850 ; (startup + 79)
+0e6e : 24 04 __ BIT $04
+0e70 : 10 ee __ BPL $0e60
+0e72 : 20 5f 0c JSR $0c5f ; (negtmp + 0)
+0e75 : 20 6d 0c JSR $0c6d ; (divmod + 0)
+0e78 : a5 05 __ LDA $05
+0e7a : 85 1b __ STA ACCU + 0
+0e7c : a5 06 __ LDA $06
+0e7e : 85 1c __ STA ACCU + 1
+0e80 : 20 51 0c JSR $0c51 ; (negaccu + 0)
+0e83 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+0e86 : b1 19 __ LDA (IP + 0),y
+0e88 : aa __ __ TAX
+0e89 : 18 __ __ CLC
+0e8a : b5 00 __ LDA $00,x
+0e8c : 65 1b __ ADC ACCU + 0
+0e8e : 95 00 __ STA $00,x
+0e90 : b5 01 __ LDA $01,x
+0e92 : 65 1c __ ADC ACCU + 1
+0e94 : 95 01 __ STA $01,x
+0e96 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0e99 : b1 19 __ LDA (IP + 0),y
+0e9b : c8 __ __ INY
+0e9c : aa __ __ TAX
+0e9d : 18 __ __ CLC
+0e9e : b5 00 __ LDA $00,x
+0ea0 : 71 19 __ ADC (IP + 0),y
+0ea2 : c8 __ __ INY
+0ea3 : 95 00 __ STA $00,x
+0ea5 : b5 01 __ LDA $01,x
+0ea7 : 71 19 __ ADC (IP + 0),y
+0ea9 : 95 01 __ STA $01,x
+0eab : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+0eae : b1 19 __ LDA (IP + 0),y
+0eb0 : c8 __ __ INY
+0eb1 : aa __ __ TAX
+0eb2 : a9 00 __ LDA #$00
+0eb4 : 85 05 __ STA $05
+0eb6 : 85 06 __ STA $06
+0eb8 : b5 00 __ LDA $00,x
+0eba : 85 03 __ STA $03
+0ebc : b5 01 __ LDA $01,x
+0ebe : 85 04 __ STA $04
+0ec0 : b1 19 __ LDA (IP + 0),y
+0ec2 : 4a __ __ LSR
+0ec3 : 85 07 __ STA $07
+0ec5 : 90 0d __ BCC $0ed4
+0ec7 : 18 __ __ CLC
+0ec8 : a5 05 __ LDA $05
+0eca : 65 03 __ ADC $03
+0ecc : 85 05 __ STA $05
+0ece : a5 06 __ LDA $06
+0ed0 : 65 04 __ ADC $04
+0ed2 : 85 06 __ STA $06
+0ed4 : 06 03 __ ASL $03
+0ed6 : 26 04 __ ROL $04
+0ed8 : 46 07 __ LSR $07
+0eda : b0 eb __ BCS $0ec7
+0edc : d0 f6 __ BNE $0ed4
+0ede : a5 05 __ LDA $05
+0ee0 : 95 00 __ STA $00,x
+0ee2 : a5 06 __ LDA $06
+0ee4 : 95 01 __ STA $01,x
+0ee6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0ee9 : b1 19 __ LDA (IP + 0),y
+0eeb : aa __ __ TAX
+0eec : b5 00 __ LDA $00,x
+0eee : 2c b1 19 BIT $19b1 
+0ef1 : 29 0f __ AND #$0f
+0ef3 : f0 0b __ BEQ $0f00
+0ef5 : aa __ __ TAX
+0ef6 : a5 1c __ LDA ACCU + 1
+0ef8 : 06 1b __ ASL ACCU + 0
+0efa : 2a __ __ ROL
+0efb : ca __ __ DEX
+0efc : d0 fa __ BNE $0ef8
+0efe : 85 1c __ STA ACCU + 1
+0f00 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0f03 : b1 19 __ LDA (IP + 0),y
+0f05 : aa __ __ TAX
+0f06 : 38 __ __ SEC
+0f07 : b5 01 __ LDA $01,x
+0f09 : e5 1c __ SBC ACCU + 1
+0f0b : f0 11 __ BEQ $0f1e
+0f0d : 50 02 __ BVC $0f11
+0f0f : 49 80 __ EOR #$80
+0f11 : 30 2a __ BMI $0f3d
+0f13 : 10 33 __ BPL $0f48
+0f15 : b1 19 __ LDA (IP + 0),y
+0f17 : aa __ __ TAX
+0f18 : b5 01 __ LDA $01,x
+0f1a : c5 1c __ CMP ACCU + 1
+0f1c : d0 28 __ BNE $0f46
+0f1e : b5 00 __ LDA $00,x
+0f20 : c5 1b __ CMP ACCU + 0
+0f22 : d0 22 __ BNE $0f46
+0f24 : f0 0e __ BEQ $0f34
+0f26 : b1 19 __ LDA (IP + 0),y
+0f28 : aa __ __ TAX
+0f29 : c8 __ __ INY
+0f2a : b1 19 __ LDA (IP + 0),y
+0f2c : c5 1c __ CMP ACCU + 1
+0f2e : d0 16 __ BNE $0f46
+0f30 : e4 1b __ CPX ACCU + 0
+0f32 : d0 12 __ BNE $0f46
+0f34 : a9 00 __ LDA #$00
+0f36 : 85 1b __ STA ACCU + 0
+0f38 : 85 1c __ STA ACCU + 1
+0f3a : 4c 50 08 JMP $0850 ; (startup + 79)
+0f3d : a9 ff __ LDA #$ff
+0f3f : 85 1b __ STA ACCU + 0
+0f41 : 85 1c __ STA ACCU + 1
+0f43 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f46 : 90 f5 __ BCC $0f3d
+0f48 : a9 01 __ LDA #$01
+0f4a : 85 1b __ STA ACCU + 0
+0f4c : a9 00 __ LDA #$00
+0f4e : 85 1c __ STA ACCU + 1
+0f50 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f53 : b1 19 __ LDA (IP + 0),y
+0f55 : c8 __ __ INY
+0f56 : aa __ __ TAX
+0f57 : b1 19 __ LDA (IP + 0),y
+0f59 : 38 __ __ SEC
+0f5a : e5 1c __ SBC ACCU + 1
+0f5c : d0 af __ BNE $0f0d
+0f5e : e4 1b __ CPX ACCU + 0
+0f60 : d0 e4 __ BNE $0f46
+0f62 : f0 d0 __ BEQ $0f34
+0f64 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+0f65 : b1 19 __ LDA (IP + 0),y
+0f67 : aa __ __ TAX
+0f68 : 38 __ __ SEC
+0f69 : b5 00 __ LDA $00,x
+0f6b : e5 1b __ SBC ACCU + 0
+0f6d : f0 19 __ BEQ $0f88
+0f6f : 50 02 __ BVC $0f73
+0f71 : 49 80 __ EOR #$80
+0f73 : 30 1c __ BMI $0f91
+0f75 : 10 25 __ BPL $0f9c
+0f77 : b1 19 __ LDA (IP + 0),y
+0f79 : aa __ __ TAX
+0f7a : b5 00 __ LDA $00,x
+0f7c : c5 1b __ CMP ACCU + 0
+0f7e : d0 1a __ BNE $0f9a
+0f80 : f0 06 __ BEQ $0f88
+0f82 : b1 19 __ LDA (IP + 0),y
+0f84 : c5 1b __ CMP ACCU + 0
+0f86 : d0 12 __ BNE $0f9a
+0f88 : a9 00 __ LDA #$00
+0f8a : 85 1b __ STA ACCU + 0
+0f8c : 85 1c __ STA ACCU + 1
+0f8e : 4c 50 08 JMP $0850 ; (startup + 79)
+0f91 : a9 ff __ LDA #$ff
+0f93 : 85 1b __ STA ACCU + 0
+0f95 : 85 1c __ STA ACCU + 1
+0f97 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f9a : 90 f5 __ BCC $0f91
+0f9c : a9 01 __ LDA #$01
+0f9e : 85 1b __ STA ACCU + 0
+0fa0 : a9 00 __ LDA #$00
+0fa2 : 85 1c __ STA ACCU + 1
+0fa4 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fa7 : b1 19 __ LDA (IP + 0),y
+0fa9 : 38 __ __ SEC
+0faa : e5 1b __ SBC ACCU + 0
+0fac : d0 c1 __ BNE $0f6f
+0fae : f0 d8 __ BEQ $0f88
+0fb0 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+0fb1 : b1 19 __ LDA (IP + 0),y
+0fb3 : 30 0c __ BMI $0fc1
+0fb5 : 38 __ __ SEC
+0fb6 : 65 19 __ ADC IP + 0
+0fb8 : 85 19 __ STA IP + 0
+0fba : 90 02 __ BCC $0fbe
+0fbc : e6 1a __ INC IP + 1
+0fbe : 4c 51 08 JMP $0851 ; (startup + 80)
+0fc1 : 38 __ __ SEC
+0fc2 : 65 19 __ ADC IP + 0
+0fc4 : 85 19 __ STA IP + 0
+0fc6 : b0 02 __ BCS $0fca
+0fc8 : c6 1a __ DEC IP + 1
+0fca : 4c 51 08 JMP $0851 ; (startup + 80)
+0fcd : a5 1b __ LDA ACCU + 0
+0fcf : 05 1c __ ORA ACCU + 1
+0fd1 : f0 de __ BEQ $0fb1
+0fd3 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fd6 : a5 1b __ LDA ACCU + 0
+0fd8 : 05 1c __ ORA ACCU + 1
+0fda : d0 d5 __ BNE $0fb1
+0fdc : 4c 50 08 JMP $0850 ; (startup + 79)
+0fdf : a5 1c __ LDA ACCU + 1
+0fe1 : 30 04 __ BMI $0fe7
+0fe3 : 05 1b __ ORA ACCU + 0
+0fe5 : d0 ca __ BNE $0fb1
+0fe7 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fea : a5 1c __ LDA ACCU + 1
+0fec : 10 c3 __ BPL $0fb1
+0fee : 4c 50 08 JMP $0850 ; (startup + 79)
+0ff1 : a5 1c __ LDA ACCU + 1
+0ff3 : 30 bc __ BMI $0fb1
+0ff5 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ff8 : a5 1c __ LDA ACCU + 1
+0ffa : 30 b5 __ BMI $0fb1
+0ffc : 05 1b __ ORA ACCU + 0
+0ffe : f0 b1 __ BEQ $0fb1
+1000 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1003 : 38 __ __ SEC
+1004 : b1 19 __ LDA (IP + 0),y
+1006 : 65 19 __ ADC IP + 0
+1008 : aa __ __ TAX
+1009 : c8 __ __ INY
+100a : b1 19 __ LDA (IP + 0),y
+100c : 65 1a __ ADC IP + 1
+100e : 85 1a __ STA IP + 1
+1010 : 86 19 __ STX IP + 0
+1012 : 4c 51 08 JMP $0851 ; (startup + 80)
+1015 : a5 1b __ LDA ACCU + 0
+1017 : 05 1c __ ORA ACCU + 1
+1019 : f0 e8 __ BEQ $1003
+101b : c8 __ __ INY
+101c : 4c 50 08 JMP $0850 ; (startup + 79)
+101f : a5 1b __ LDA ACCU + 0
+1021 : 05 1c __ ORA ACCU + 1
+1023 : d0 de __ BNE $1003
+1025 : c8 __ __ INY
+1026 : 4c 50 08 JMP $0850 ; (startup + 79)
+1029 : a5 1c __ LDA ACCU + 1
+102b : 30 04 __ BMI $1031
+102d : 05 1b __ ORA ACCU + 0
+102f : d0 d2 __ BNE $1003
+1031 : c8 __ __ INY
+1032 : 4c 50 08 JMP $0850 ; (startup + 79)
+1035 : a5 1c __ LDA ACCU + 1
+1037 : 10 ca __ BPL $1003
+1039 : c8 __ __ INY
+103a : 4c 50 08 JMP $0850 ; (startup + 79)
+103d : a5 1c __ LDA ACCU + 1
+103f : 30 c2 __ BMI $1003
+1041 : c8 __ __ INY
+1042 : 4c 50 08 JMP $0850 ; (startup + 79)
+1045 : a5 1c __ LDA ACCU + 1
+1047 : 30 ba __ BMI $1003
+1049 : 05 1b __ ORA ACCU + 0
+104b : f0 b6 __ BEQ $1003
+104d : c8 __ __ INY
+104e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+1051 : b1 19 __ LDA (IP + 0),y
+1053 : 8d 67 10 STA $1067 ; (inp_jsr + 22)
+1056 : c8 __ __ INY
+1057 : b1 19 __ LDA (IP + 0),y
+1059 : 8d 68 10 STA $1068 ; (inp_jsr + 23)
+105c : 98 __ __ TYA
+105d : 38 __ __ SEC
+105e : 65 19 __ ADC IP + 0
+1060 : 85 19 __ STA IP + 0
+1062 : 90 02 __ BCC $1066
+1064 : e6 1a __ INC IP + 1
+1066 : 20 00 00 JSR $0000 
+1069 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+106c : 98 __ __ TYA
+106d : 18 __ __ CLC
+106e : 65 19 __ ADC IP + 0
+1070 : 8d 7b 10 STA $107b ; (inp_native + 15)
+1073 : a5 1a __ LDA IP + 1
+1075 : 69 00 __ ADC #$00
+1077 : 8d 7c 10 STA $107c ; (inp_native + 16)
+107a : 20 00 00 JSR $0000 
+107d : a0 00 __ LDY #$00
+107f : b1 23 __ LDA (SP + 0),y
+1081 : 85 19 __ STA IP + 0
+1083 : c8 __ __ INY
+1084 : b1 23 __ LDA (SP + 0),y
+1086 : 85 1a __ STA IP + 1
+1088 : 88 __ __ DEY
+1089 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+108c : 38 __ __ SEC
+108d : a5 23 __ LDA SP + 0
+108f : f1 19 __ SBC (IP + 0),y
+1091 : c8 __ __ INY
+1092 : 85 23 __ STA SP + 0
+1094 : a5 24 __ LDA SP + 1
+1096 : f1 19 __ SBC (IP + 0),y
+1098 : c8 __ __ INY
+1099 : 85 24 __ STA SP + 1
+109b : b1 19 __ LDA (IP + 0),y
+109d : 84 02 __ STY $02
+109f : a8 __ __ TAY
+10a0 : a5 25 __ LDA FP + 0
+10a2 : 91 23 __ STA (SP + 0),y
+10a4 : c8 __ __ INY
+10a5 : a5 26 __ LDA FP + 1
+10a7 : 91 23 __ STA (SP + 0),y
+10a9 : 98 __ __ TYA
+10aa : 38 __ __ SEC
+10ab : 65 23 __ ADC SP + 0
+10ad : 85 25 __ STA FP + 0
+10af : a9 00 __ LDA #$00
+10b1 : 65 24 __ ADC SP + 1
+10b3 : 85 26 __ STA FP + 1
+10b5 : 88 __ __ DEY
+10b6 : f0 08 __ BEQ $10c0
+10b8 : b9 52 00 LDA $0052,y 
+10bb : 88 __ __ DEY
+10bc : 91 23 __ STA (SP + 0),y
+10be : d0 f8 __ BNE $10b8
+10c0 : a4 02 __ LDY $02
+10c2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+10c5 : b1 19 __ LDA (IP + 0),y
+10c7 : c8 __ __ INY
+10c8 : 84 02 __ STY $02
+10ca : a8 __ __ TAY
+10cb : b1 23 __ LDA (SP + 0),y
+10cd : 85 25 __ STA FP + 0
+10cf : c8 __ __ INY
+10d0 : b1 23 __ LDA (SP + 0),y
+10d2 : 85 26 __ STA FP + 1
+10d4 : 88 __ __ DEY
+10d5 : f0 09 __ BEQ $10e0
+10d7 : 88 __ __ DEY
+10d8 : b1 23 __ LDA (SP + 0),y
+10da : 99 53 00 STA $0053,y 
+10dd : 88 __ __ DEY
+10de : 10 f8 __ BPL $10d8
+10e0 : a4 02 __ LDY $02
+10e2 : 18 __ __ CLC
+10e3 : b1 19 __ LDA (IP + 0),y
+10e5 : c8 __ __ INY
+10e6 : 65 23 __ ADC SP + 0
+10e8 : 85 23 __ STA SP + 0
+10ea : b1 19 __ LDA (IP + 0),y
+10ec : c8 __ __ INY
+10ed : 65 24 __ ADC SP + 1
+10ef : 85 24 __ STA SP + 1
+10f1 : a0 01 __ LDY #$01
+10f3 : b1 23 __ LDA (SP + 0),y
+10f5 : 85 1a __ STA IP + 1
+10f7 : 88 __ __ DEY
+10f8 : b1 23 __ LDA (SP + 0),y
+10fa : 85 19 __ STA IP + 0
+10fc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+10ff : b1 19 __ LDA (IP + 0),y
+1101 : 85 1f __ STA ADDR + 0
+1103 : c8 __ __ INY
+1104 : b1 19 __ LDA (IP + 0),y
+1106 : 85 20 __ STA ADDR + 1
+1108 : c8 __ __ INY
+1109 : 98 __ __ TYA
+110a : a0 00 __ LDY #$00
+110c : 18 __ __ CLC
+110d : 65 19 __ ADC IP + 0
+110f : 91 23 __ STA (SP + 0),y
+1111 : c8 __ __ INY
+1112 : a5 1a __ LDA IP + 1
+1114 : 69 00 __ ADC #$00
+1116 : 91 23 __ STA (SP + 0),y
+1118 : a5 1f __ LDA ADDR + 0
+111a : 85 19 __ STA IP + 0
+111c : a5 20 __ LDA ADDR + 1
+111e : 85 1a __ STA IP + 1
+1120 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+1123 : 38 __ __ SEC
+1124 : a5 23 __ LDA SP + 0
+1126 : f1 19 __ SBC (IP + 0),y
+1128 : c8 __ __ INY
+1129 : 85 23 __ STA SP + 0
+112b : a5 24 __ LDA SP + 1
+112d : f1 19 __ SBC (IP + 0),y
+112f : 85 24 __ STA SP + 1
+1131 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+1134 : 18 __ __ CLC
+1135 : b1 19 __ LDA (IP + 0),y
+1137 : c8 __ __ INY
+1138 : 65 23 __ ADC SP + 0
+113a : 85 23 __ STA SP + 0
+113c : b1 19 __ LDA (IP + 0),y
+113e : 65 24 __ ADC SP + 1
+1140 : 85 24 __ STA SP + 1
+1142 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+1145 : 84 02 __ STY $02
+1147 : a0 ff __ LDY #$ff
+1149 : c8 __ __ INY
+114a : b1 1b __ LDA (ACCU + 0),y
+114c : 91 1f __ STA (ADDR + 0),y
+114e : d0 f9 __ BNE $1149
+1150 : a4 02 __ LDY $02
+1152 : 4c 51 08 JMP $0851 ; (startup + 80)
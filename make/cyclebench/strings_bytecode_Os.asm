@@ -0,0 +1,1109 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e e4 11 STX $11e4 ; (spentry + 0)
+0811 : a9 07 __ LDA #$07
+0813 : 85 19 __ STA IP + 0
+0815 : a9 12 __ LDA #$12
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 14 __ LDA #$14
+081c : e9 12 __ SBC #$12
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 07 __ LDA #$07
+0832 : e9 07 __ SBC #$07
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	10, 12
+0a04:	PUSH	#$0004
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	MOV	ACCU, #0
+0a10:	MOVB	buffer + 0, ACCU
+0a14:	LEA	T2, buffer + 0
+0a18:	LEA	T3, text + 0
+0a1c:	LEA	T4, $0b8b
+0a20:	LEA	T5, buffer + 0
+0a24:	MOV	ACCU, T5
+0a26:	MOV	P0, ACCU
+0a28:	MOV	ADDR, T3
+0a2a:	MOV	P2, 0(ADDR)
+0a2d:	JSR	strcat + 0
+0a30:	MOV	ACCU, T5
+0a32:	MOV	P0, ACCU
+0a34:	MOV	ACCU, T4
+0a36:	MOV	P2, ACCU
+0a38:	JSR	strcat + 0
+0a3b:	ADD	T3, #$0002
+0a3f:	MOV	ACCU, T2
+0a41:	CMPU	ACCU, T3
+0a43:	BLT	$0A24
+0a45:	MOV	ACCU, T5
+0a47:	MOV	P0, ACCU
+0a49:	JSR	strlen + 0
+0a4c:	MOV	T2, ACCU
+0a4e:	MOV	ACCU, T5
+0a50:	MOV	P0, ACCU
+0a52:	MOVB	P2, #111
+0a55:	CALL	count + 0
+0a58:	MOV	T3, ACCU
+0a5a:	MOV	ACCU, T2
+0a5c:	ADD	ACCU, T0
+0a5e:	ADD	ACCU, T3
+0a60:	MOV	T0, ACCU
+0a62:	MOV	T2, #0
+0a65:	LEA	T3, words + 0
+0a69:	MOV	ACCU, T2
+0a6b:	MUL	ACCU, #5
+0a6e:	ADD	ACCU, T1
+0a70:	MOV	ADDR, #17
+0a73:	MODS	ACCU, ADDR
+0a75:	SHL	ACCU, #1
+0a77:	LEA	T4, text + 0
+0a7b:	ADD	T4, ACCU
+0a7d:	MOV	ADDR, T4
+0a7f:	MOV	T4, 0(ADDR)
+0a82:	MOV	ADDR, T3
+0a84:	MOV	ACCU, T4
+0a86:	STRCPY
+0a87:	ADD	T3, #$0010
+0a8b:	ADD	T2, #$0001
+0a8f:	MOV	ACCU, T2
+0a91:	CMPS	ACCU, #$0010
+0a94:	BGT	$0A69
+0a96:	MOV	ACCU, #16
+0a99:	MOV	2(SP), ACCU
+0a9c:	CALL	sort + 0
+0a9f:	LEA	T2, words + 240
+0aa3:	LEA	T3, words + 16
+0aa7:	LEA	T4, words + 0
+0aab:	MOV	ACCU, T4
+0aad:	MOV	P0, ACCU
+0aaf:	MOV	ACCU, T3
+0ab1:	MOV	P2, ACCU
+0ab3:	JSR	strcmp + 0
+0ab6:	BGT	$0AE8
+0ab8:	ADD	T4, #$0010
+0abc:	ADD	T3, #$0010
+0ac0:	MOV	ACCU, T2
+0ac2:	CMPU	ACCU, T4
+0ac4:	BLT	$0AAB
+0ac6:	ADD	T1, #$0001
+0aca:	MOV	ACCU, T1
+0acc:	CMPS	ACCU, #$0014
+0acf:	BGTF	$0A0D
+0ad2:	MOV	ACCU, T0
+0ad4:	CMPU	ACCU, #$071C
+0ad7:	BNE	$0ADE
+0ad9:	MOV	ACCU, #0
+0adc:	JUMP	$0AE1
+0ade:	MOV	ACCU, #2
+0ae1:	POP	#$0004
+0ae4:	RETURN	10, 12
+0ae8:	MOV	ACCU, #1
+0aeb:	JUMP	$0AE1
+--------------------------------------------------------------------
+strcat:
+0aed : ea __ __ NOP
+0aee : a5 0f __ LDA P2
+0af0 : 85 43 __ STA T0 + 0
+0af2 : a5 10 __ LDA P3
+0af4 : 85 44 __ STA T0 + 1
+0af6 : a5 0d __ LDA P0
+0af8 : 85 45 __ STA T1 + 0
+0afa : a5 0e __ LDA P1
+0afc : 85 46 __ STA T1 + 1
+0afe : a0 00 __ LDY #$00
+0b00 : b1 0d __ LDA (P0),y
+0b02 : f0 14 __ BEQ $0b18
+0b04 : a5 45 __ LDA T1 + 0
+0b06 : 85 48 __ STA T3 + 0
+0b08 : a5 46 __ LDA T1 + 1
+0b0a : 85 49 __ STA T3 + 1
+0b0c : e6 45 __ INC T1 + 0
+0b0e : d0 02 __ BNE $0b12
+0b10 : e6 46 __ INC T1 + 1
+0b12 : a0 01 __ LDY #$01
+0b14 : b1 48 __ LDA (T3 + 0),y
+0b16 : d0 ec __ BNE $0b04
+0b18 : a0 00 __ LDY #$00
+0b1a : b1 43 __ LDA (T0 + 0),y
+0b1c : aa __ __ TAX
+0b1d : 91 45 __ STA (T1 + 0),y
+0b1f : e6 45 __ INC T1 + 0
+0b21 : d0 02 __ BNE $0b25
+0b23 : e6 46 __ INC T1 + 1
+0b25 : e6 43 __ INC T0 + 0
+0b27 : d0 02 __ BNE $0b2b
+0b29 : e6 44 __ INC T0 + 1
+0b2b : 8a __ __ TXA
+0b2c : d0 ea __ BNE $0b18
+0b2e : a5 0d __ LDA P0
+0b30 : 85 1b __ STA ACCU + 0
+0b32 : a5 0e __ LDA P1
+0b34 : 85 1c __ STA ACCU + 1
+0b36 : 60 __ __ RTS
+--------------------------------------------------------------------
+strlen:
+0b8d : ea __ __ NOP
+0b8e : a9 00 __ LDA #$00
+0b90 : 85 43 __ STA T0 + 0
+0b92 : 85 44 __ STA T0 + 1
+0b94 : a0 00 __ LDY #$00
+0b96 : b1 0d __ LDA (P0),y
+0b98 : d0 09 __ BNE $0ba3
+0b9a : a5 43 __ LDA T0 + 0
+0b9c : 85 1b __ STA ACCU + 0
+0b9e : a5 44 __ LDA T0 + 1
+0ba0 : 85 1c __ STA ACCU + 1
+0ba2 : 60 __ __ RTS
+0ba3 : 18 __ __ CLC
+0ba4 : a5 0d __ LDA P0
+0ba6 : 65 43 __ ADC T0 + 0
+0ba8 : 85 48 __ STA T3 + 0
+0baa : a5 0e __ LDA P1
+0bac : 65 44 __ ADC T0 + 1
+0bae : 85 49 __ STA T3 + 1
+0bb0 : e6 43 __ INC T0 + 0
+0bb2 : d0 02 __ BNE $0bb6
+0bb4 : e6 44 __ INC T0 + 1
+0bb6 : a0 01 __ LDY #$01
+0bb8 : b1 48 __ LDA (T3 + 0),y
+0bba : d0 e7 __ BNE $0ba3
+0bbc : 4c 9a 0b JMP $0b9a ; (strlen + 13)
+--------------------------------------------------------------------
+count:
+0bbf:	ENTER	0, 2
+0bc3:	MOV	T0, #0
+0bc6:	MOV	ADDR, P0
+0bc8:	MOVUB	ACCU, 0(ADDR)
+0bcb:	BNE	$0BD3
+0bcd:	MOV	ACCU, T0
+0bcf:	RETURN	0, 2
+0bd3:	MOV	ACCU, P0
+0bd5:	MOV	T1, ACCU
+0bd7:	MOV	ADDR, T1
+0bd9:	MOVB	T2, 0(ADDR)
+0bdc:	MOVB	ACCU, P2
+0bde:	CMPUB	ACCU, T2
+0be0:	BEQ	$0BEC
+0be2:	MOV	ACCU, T1
+0be4:	ADD	ACCU, #$0001
+0be8:	MOV	P0, ACCU
+0bea:	JUMP	$0BF8
+0bec:	MOV	ACCU, T1
+0bee:	ADD	ACCU, #$0001
+0bf2:	MOV	P0, ACCU
+0bf4:	ADD	T0, #$0001
+0bf8:	MOV	ADDR, T1
+0bfa:	MOVUB	ACCU, 1(ADDR)
+0bfd:	BNE	$0BD3
+0bff:	JUMP	$0BCD
+--------------------------------------------------------------------
+sort:
+0c01:	ENTER	0, 18
+0c05:	PUSH	#$0002
+0c08:	MOV	ACCU, 18(FP)
+0c0b:	CMPS	ACCU, #$0001
+0c0e:	BLT	$0C17
+0c10:	POP	#$0002
+0c13:	RETURN	0, 18
+0c17:	MOV	T0, #1
+0c1a:	LEA	T2, words + 16
+0c1e:	LEA	ADDR, 0(FP)
+0c22:	MOV	ACCU, T2
+0c24:	STRCPY
+0c25:	MOV	ACCU, T0
+0c27:	MOV	T3, ACCU
+0c29:	BGT	$0C4A
+0c2b:	MUL	T3, #16
+0c2e:	LEAX	ADDR, words + 0 + T3
+0c32:	LEA	ACCU, 0(FP)
+0c36:	STRCPY
+0c37:	MOV	T3, 18(FP)
+0c3a:	ADD	T2, #$0010
+0c3e:	ADD	T0, #$0001
+0c42:	MOV	ACCU, T3
+0c44:	CMPS	ACCU, T0
+0c46:	BLT	$0C1E
+0c48:	JUMP	$0C10
+0c4a:	MOV	ACCU, T0
+0c4c:	ADD	ACCU, #$FFFF
+0c50:	MOV	T4, ACCU
+0c52:	MUL	T4, #16
+0c55:	LEA	ACCU, words + 0
+0c59:	ADD	T4, ACCU
+0c5b:	MOV	ACCU, T0
+0c5d:	MUL	ACCU, #16
+0c60:	LEA	T5, words + 0
+0c64:	ADD	T5, ACCU
+0c66:	MOV	ACCU, T4
+0c68:	MOV	P0, ACCU
+0c6a:	LEA	P2, 0(FP)
+0c6e:	JSR	strcmp + 0
+0c71:	BLE	$0C2B
+0c73:	MOV	ADDR, T5
+0c75:	MOV	ACCU, T4
+0c77:	STRCPY
+0c78:	ADD	T4, #$FFF0
+0c7c:	ADD	T5, #$FFF0
+0c80:	ADD	T3, #$FFFF
+0c84:	MOV	ACCU, T3
+0c86:	BGT	$0C66
+0c88:	JUMP	$0C2B
+--------------------------------------------------------------------
+strcmp:
+0c8a : ea __ __ NOP
+0c8b : a0 00 __ LDY #$00
+0c8d : 84 1c __ STY ACCU + 1
+0c8f : b1 0d __ LDA (P0),y
+0c91 : f0 16 __ BEQ $0ca9
+0c93 : d1 0f __ CMP (P2),y
+0c95 : d0 16 __ BNE $0cad
+0c97 : c8 __ __ INY
+0c98 : b1 0d __ LDA (P0),y
+0c9a : f0 0d __ BEQ $0ca9
+0c9c : d1 0f __ CMP (P2),y
+0c9e : d0 0d __ BNE $0cad
+0ca0 : c8 __ __ INY
+0ca1 : d0 ec __ BNE $0c8f
+0ca3 : e6 0e __ INC P1
+0ca5 : e6 10 __ INC P3
+0ca7 : d0 e6 __ BNE $0c8f
+0ca9 : d1 0f __ CMP (P2),y
+0cab : f0 0a __ BEQ $0cb7
+0cad : b0 06 __ BCS $0cb5
+0caf : a9 ff __ LDA #$ff
+0cb1 : 85 1c __ STA ACCU + 1
+0cb3 : 30 02 __ BMI $0cb7
+0cb5 : a9 01 __ LDA #$01
+0cb7 : 85 1b __ STA ACCU + 0
+0cb9 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0cba : 38 __ __ SEC
+0cbb : a9 00 __ LDA #$00
+0cbd : e5 1b __ SBC ACCU + 0
+0cbf : 85 1b __ STA ACCU + 0
+0cc1 : a9 00 __ LDA #$00
+0cc3 : e5 1c __ SBC ACCU + 1
+0cc5 : 85 1c __ STA ACCU + 1
+0cc7 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0cc8 : 38 __ __ SEC
+0cc9 : a9 00 __ LDA #$00
+0ccb : e5 03 __ SBC $03
+0ccd : 85 03 __ STA $03
+0ccf : a9 00 __ LDA #$00
+0cd1 : e5 04 __ SBC $04
+0cd3 : 85 04 __ STA $04
+0cd5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0cd6 : a5 1c __ LDA ACCU + 1
+0cd8 : d0 31 __ BNE $0d0b
+0cda : a5 04 __ LDA $04
+0cdc : d0 1e __ BNE $0cfc
+0cde : 85 06 __ STA $06
+0ce0 : a2 04 __ LDX #$04
+0ce2 : 06 1b __ ASL ACCU + 0
+0ce4 : 2a __ __ ROL
+0ce5 : c5 03 __ CMP $03
+0ce7 : 90 02 __ BCC $0ceb
+0ce9 : e5 03 __ SBC $03
+0ceb : 26 1b __ ROL ACCU + 0
+0ced : 2a __ __ ROL
+0cee : c5 03 __ CMP $03
+0cf0 : 90 02 __ BCC $0cf4
+0cf2 : e5 03 __ SBC $03
+0cf4 : 26 1b __ ROL ACCU + 0
+0cf6 : ca __ __ DEX
+0cf7 : d0 eb __ BNE $0ce4
+0cf9 : 85 05 __ STA $05
+0cfb : 60 __ __ RTS
+0cfc : a5 1b __ LDA ACCU + 0
+0cfe : 85 05 __ STA $05
+0d00 : a5 1c __ LDA ACCU + 1
+0d02 : 85 06 __ STA $06
+0d04 : a9 00 __ LDA #$00
+0d06 : 85 1b __ STA ACCU + 0
+0d08 : 85 1c __ STA ACCU + 1
+0d0a : 60 __ __ RTS
+0d0b : a5 04 __ LDA $04
+0d0d : d0 1f __ BNE $0d2e
+0d0f : a5 03 __ LDA $03
+0d11 : 30 1b __ BMI $0d2e
+0d13 : a9 00 __ LDA #$00
+0d15 : 85 06 __ STA $06
+0d17 : a2 10 __ LDX #$10
+0d19 : 06 1b __ ASL ACCU + 0
+0d1b : 26 1c __ ROL ACCU + 1
+0d1d : 2a __ __ ROL
+0d1e : c5 03 __ CMP $03
+0d20 : 90 02 __ BCC $0d24
+0d22 : e5 03 __ SBC $03
+0d24 : 26 1b __ ROL ACCU + 0
+0d26 : 26 1c __ ROL ACCU + 1
+0d28 : ca __ __ DEX
+0d29 : d0 f2 __ BNE $0d1d
+0d2b : 85 05 __ STA $05
+0d2d : 60 __ __ RTS
+0d2e : a9 00 __ LDA #$00
+0d30 : 85 05 __ STA $05
+0d32 : 85 06 __ STA $06
+0d34 : 84 02 __ STY $02
+0d36 : a0 10 __ LDY #$10
+0d38 : 18 __ __ CLC
+0d39 : 26 1b __ ROL ACCU + 0
+0d3b : 26 1c __ ROL ACCU + 1
+0d3d : 26 05 __ ROL $05
+0d3f : 26 06 __ ROL $06
+0d41 : 38 __ __ SEC
+0d42 : a5 05 __ LDA $05
+0d44 : e5 03 __ SBC $03
+0d46 : aa __ __ TAX
+0d47 : a5 06 __ LDA $06
+0d49 : e5 04 __ SBC $04
+0d4b : 90 04 __ BCC $0d51
+0d4d : 86 05 __ STX $05
+0d4f : 85 06 __ STA $06
+0d51 : 88 __ __ DEY
+0d52 : d0 e5 __ BNE $0d39
+0d54 : 26 1b __ ROL ACCU + 0
+0d56 : 26 1c __ ROL ACCU + 1
+0d58 : a4 02 __ LDY $02
+0d5a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0d5b : a9 4c __ LDA #$4c
+0d5d : 85 54 __ STA $54
+0d5f : a9 00 __ LDA #$00
+0d61 : 85 13 __ STA P6
+0d63 : a9 19 __ LDA #$19
+0d65 : 85 16 __ STA P9
+0d67 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+0d68 : b1 19 __ LDA (IP + 0),y
+0d6a : aa __ __ TAX
+0d6b : c8 __ __ INY
+0d6c : b1 19 __ LDA (IP + 0),y
+0d6e : 95 00 __ STA $00,x
+0d70 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+0d73 : b1 19 __ LDA (IP + 0),y
+0d75 : aa __ __ TAX
+0d76 : c8 __ __ INY
+0d77 : b1 19 __ LDA (IP + 0),y
+0d79 : 95 00 __ STA $00,x
+0d7b : a9 00 __ LDA #$00
+0d7d : 95 01 __ STA $01,x
+0d7f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0d82 : b1 19 __ LDA (IP + 0),y
+0d84 : aa __ __ TAX
+0d85 : b5 00 __ LDA $00,x
+0d87 : 85 1b __ STA ACCU + 0
+0d89 : a9 00 __ LDA #$00
+0d8b : 85 1c __ STA ACCU + 1
+0d8d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0d90 : b1 19 __ LDA (IP + 0),y
+0d92 : aa __ __ TAX
+0d93 : b5 00 __ LDA $00,x
+0d95 : 85 1b __ STA ACCU + 0
+0d97 : b5 01 __ LDA $01,x
+0d99 : 85 1c __ STA ACCU + 1
+0d9b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0d9e : b1 19 __ LDA (IP + 0),y
+0da0 : aa __ __ TAX
+0da1 : a5 1b __ LDA ACCU + 0
+0da3 : 95 00 __ STA $00,x
+0da5 : a5 1c __ LDA ACCU + 1
+0da7 : 95 01 __ STA $01,x
+0da9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0dac : b1 19 __ LDA (IP + 0),y
+0dae : aa __ __ TAX
+0daf : b5 00 __ LDA $00,x
+0db1 : 85 1f __ STA ADDR + 0
+0db3 : b5 01 __ LDA $01,x
+0db5 : 85 20 __ STA ADDR + 1
+0db7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0dba : b1 19 __ LDA (IP + 0),y
+0dbc : 85 1f __ STA ADDR + 0
+0dbe : c8 __ __ INY
+0dbf : b1 19 __ LDA (IP + 0),y
+0dc1 : 85 20 __ STA ADDR + 1
+0dc3 : c8 __ __ INY
+0dc4 : b1 19 __ LDA (IP + 0),y
+0dc6 : aa __ __ TAX
+0dc7 : 84 02 __ STY $02
+0dc9 : a0 00 __ LDY #$00
+0dcb : b5 00 __ LDA $00,x
+0dcd : 91 1f __ STA (ADDR + 0),y
+0dcf : a4 02 __ LDY $02
+0dd1 : 4c 50 08 JMP $0850 ; (startup + 79)
+0dd4 : b1 19 __ LDA (IP + 0),y
+0dd6 : aa __ __ TAX
+0dd7 : c8 __ __ INY
+0dd8 : b1 19 __ LDA (IP + 0),y
+0dda : 84 02 __ STY $02
+0ddc : a8 __ __ TAY
+0ddd : 4c cb 0d JMP $0dcb ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+0de0 : b1 19 __ LDA (IP + 0),y
+0de2 : aa __ __ TAX
+0de3 : c8 __ __ INY
+0de4 : b1 19 __ LDA (IP + 0),y
+0de6 : 95 00 __ STA $00,x
+0de8 : c8 __ __ INY
+0de9 : b1 19 __ LDA (IP + 0),y
+0deb : 95 01 __ STA $01,x
+0ded : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+0df0 : b1 19 __ LDA (IP + 0),y
+0df2 : aa __ __ TAX
+0df3 : c8 __ __ INY
+0df4 : 18 __ __ CLC
+0df5 : b5 00 __ LDA $00,x
+0df7 : 71 19 __ ADC (IP + 0),y
+0df9 : 85 1f __ STA ADDR + 0
+0dfb : c8 __ __ INY
+0dfc : b5 01 __ LDA $01,x
+0dfe : 71 19 __ ADC (IP + 0),y
+0e00 : 85 20 __ STA ADDR + 1
+0e02 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+0e05 : b1 19 __ LDA (IP + 0),y
+0e07 : aa __ __ TAX
+0e08 : c8 __ __ INY
+0e09 : b1 19 __ LDA (IP + 0),y
+0e0b : 84 02 __ STY $02
+0e0d : a8 __ __ TAY
+0e0e : b1 25 __ LDA (FP + 0),y
+0e10 : 95 00 __ STA $00,x
+0e12 : c8 __ __ INY
+0e13 : b1 25 __ LDA (FP + 0),y
+0e15 : 95 01 __ STA $01,x
+0e17 : a4 02 __ LDY $02
+0e19 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+0e1c : b1 19 __ LDA (IP + 0),y
+0e1e : aa __ __ TAX
+0e1f : c8 __ __ INY
+0e20 : 18 __ __ CLC
+0e21 : b1 19 __ LDA (IP + 0),y
+0e23 : 65 25 __ ADC FP + 0
+0e25 : 95 00 __ STA $00,x
+0e27 : c8 __ __ INY
+0e28 : b1 19 __ LDA (IP + 0),y
+0e2a : 65 26 __ ADC FP + 1
+0e2c : 95 01 __ STA $01,x
+0e2e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+0e31 : b1 19 __ LDA (IP + 0),y
+0e33 : aa __ __ TAX
+0e34 : c8 __ __ INY
+0e35 : b1 19 __ LDA (IP + 0),y
+0e37 : 84 02 __ STY $02
+0e39 : a8 __ __ TAY
+0e3a : b5 00 __ LDA $00,x
+0e3c : 91 23 __ STA (SP + 0),y
+0e3e : c8 __ __ INY
+0e3f : b5 01 __ LDA $01,x
+0e41 : 91 23 __ STA (SP + 0),y
+0e43 : a4 02 __ LDY $02
+0e45 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+0e48 : b1 19 __ LDA (IP + 0),y
+0e4a : 85 1f __ STA ADDR + 0
+0e4c : c8 __ __ INY
+0e4d : b1 19 __ LDA (IP + 0),y
+0e4f : 85 20 __ STA ADDR + 1
+0e51 : c8 __ __ INY
+0e52 : b1 19 __ LDA (IP + 0),y
+0e54 : aa __ __ TAX
+0e55 : 84 02 __ STY $02
+0e57 : a0 00 __ LDY #$00
+0e59 : b1 1f __ LDA (ADDR + 0),y
+0e5b : 95 00 __ STA $00,x
+0e5d : a4 02 __ LDY $02
+0e5f : 4c 50 08 JMP $0850 ; (startup + 79)
+0e62 : b1 19 __ LDA (IP + 0),y
+0e64 : aa __ __ TAX
+0e65 : c8 __ __ INY
+0e66 : b1 19 __ LDA (IP + 0),y
+0e68 : 84 02 __ STY $02
+0e6a : a8 __ __ TAY
+0e6b : 4c 59 0e JMP $0e59 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0e6e : b1 19 __ LDA (IP + 0),y
+0e70 : 85 1f __ STA ADDR + 0
+0e72 : c8 __ __ INY
+0e73 : b1 19 __ LDA (IP + 0),y
+0e75 : 85 20 __ STA ADDR + 1
+0e77 : c8 __ __ INY
+0e78 : b1 19 __ LDA (IP + 0),y
+0e7a : aa __ __ TAX
+0e7b : 84 02 __ STY $02
+0e7d : a0 00 __ LDY #$00
+0e7f : b1 1f __ LDA (ADDR + 0),y
+0e81 : 95 00 __ STA $00,x
+0e83 : a9 00 __ LDA #$00
+0e85 : 95 01 __ STA $01,x
+0e87 : a4 02 __ LDY $02
+0e89 : 4c 50 08 JMP $0850 ; (startup + 79)
+0e8c : b1 19 __ LDA (IP + 0),y
+0e8e : aa __ __ TAX
+0e8f : c8 __ __ INY
+0e90 : b1 19 __ LDA (IP + 0),y
+0e92 : 84 02 __ STY $02
+0e94 : a8 __ __ TAY
+0e95 : 4c 7f 0e JMP $0e7f ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0e98 : b1 19 __ LDA (IP + 0),y
+0e9a : 85 1f __ STA ADDR + 0
+0e9c : c8 __ __ INY
+0e9d : b1 19 __ LDA (IP + 0),y
+0e9f : 85 20 __ STA ADDR + 1
+0ea1 : c8 __ __ INY
+0ea2 : b1 19 __ LDA (IP + 0),y
+0ea4 : aa __ __ TAX
+0ea5 : 84 02 __ STY $02
+0ea7 : a0 00 __ LDY #$00
+0ea9 : b1 1f __ LDA (ADDR + 0),y
+0eab : 95 00 __ STA $00,x
+0ead : c8 __ __ INY
+0eae : b1 1f __ LDA (ADDR + 0),y
+0eb0 : 95 01 __ STA $01,x
+0eb2 : a4 02 __ LDY $02
+0eb4 : 4c 50 08 JMP $0850 ; (startup + 79)
+0eb7 : b1 19 __ LDA (IP + 0),y
+0eb9 : aa __ __ TAX
+0eba : c8 __ __ INY
+0ebb : b1 19 __ LDA (IP + 0),y
+0ebd : 84 02 __ STY $02
+0ebf : a8 __ __ TAY
+0ec0 : 4c a9 0e JMP $0ea9 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+0ec3 : b1 19 __ LDA (IP + 0),y
+0ec5 : aa __ __ TAX
+0ec6 : 18 __ __ CLC
+0ec7 : a5 1b __ LDA ACCU + 0
+0ec9 : 75 00 __ ADC $00,x
+0ecb : 85 1b __ STA ACCU + 0
+0ecd : a5 1c __ LDA ACCU + 1
+0ecf : 75 01 __ ADC $01,x
+0ed1 : 85 1c __ STA ACCU + 1
+0ed3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+0ed6 : b1 19 __ LDA (IP + 0),y
+0ed8 : aa __ __ TAX
+0ed9 : b5 00 __ LDA $00,x
+0edb : 85 03 __ STA $03
+0edd : b5 01 __ LDA $01,x
+0edf : 85 04 __ STA $04
+0ee1 : 24 1c __ BIT ACCU + 1
+0ee3 : 10 18 __ BPL $0efd
+0ee5 : 20 ba 0c JSR $0cba ; (negaccu + 0)
+0ee8 : 24 04 __ BIT $04
+0eea : 10 18 __ BPL $0f04
+0eec : 20 c8 0c JSR $0cc8 ; (negtmp + 0)
+0eef : 20 d6 0c JSR $0cd6 ; (divmod + 0)
+0ef2 : a5 05 __ LDA $05
+0ef4 : 85 1b __ STA ACCU + 0
+0ef6 : a5 06 __ LDA $06
+0ef8 : 85 1c __ STA ACCU + 1
+0efa : 4c 50 08 JMP $0850 ; (startup + 79)
+0efd : 24 04 __ BIT $04
+0eff : 10 ee __ BPL $0eef
+0f01 : 20 c8 0c JSR $0cc8 ; (negtmp + 0)
+0f04 : 20 d6 0c JSR $0cd6 ; (divmod + 0)
+0f07 : a5 05 __ LDA $05
+0f09 : 85 1b __ STA ACCU + 0
+0f0b : a5 06 __ LDA $06
+0f0d : 85 1c __ STA ACCU + 1
+0f0f : 20 ba 0c JSR $0cba ; (negaccu + 0)
+0f12 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+0f15 : b1 19 __ LDA (IP + 0),y
+0f17 : aa __ __ TAX
+0f18 : 18 __ __ CLC
+0f19 : b5 00 __ LDA $00,x
+0f1b : 65 1b __ ADC ACCU + 0
+0f1d : 95 00 __ STA $00,x
+0f1f : b5 01 __ LDA $01,x
+0f21 : 65 1c __ ADC ACCU + 1
+0f23 : 95 01 __ STA $01,x
+0f25 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0f28 : b1 19 __ LDA (IP + 0),y
+0f2a : c8 __ __ INY
+0f2b : aa __ __ TAX
+0f2c : 18 __ __ CLC
+0f2d : b5 00 __ LDA $00,x
+0f2f : 71 19 __ ADC (IP + 0),y
+0f31 : c8 __ __ INY
+0f32 : 95 00 __ STA $00,x
+0f34 : b5 01 __ LDA $01,x
+0f36 : 71 19 __ ADC (IP + 0),y
+0f38 : 95 01 __ STA $01,x
+0f3a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+0f3d : b1 19 __ LDA (IP + 0),y
+0f3f : c8 __ __ INY
+0f40 : aa __ __ TAX
+0f41 : a9 00 __ LDA #$00
+0f43 : 85 05 __ STA $05
+0f45 : 85 06 __ STA $06
+0f47 : b5 00 __ LDA $00,x
+0f49 : 85 03 __ STA $03
+0f4b : b5 01 __ LDA $01,x
+0f4d : 85 04 __ STA $04
+0f4f : b1 19 __ LDA (IP + 0),y
+0f51 : 4a __ __ LSR
+0f52 : 85 07 __ STA $07
+0f54 : 90 0d __ BCC $0f63
+0f56 : 18 __ __ CLC
+0f57 : a5 05 __ LDA $05
+0f59 : 65 03 __ ADC $03
+0f5b : 85 05 __ STA $05
+0f5d : a5 06 __ LDA $06
+0f5f : 65 04 __ ADC $04
+0f61 : 85 06 __ STA $06
+0f63 : 06 03 __ ASL $03
+0f65 : 26 04 __ ROL $04
+0f67 : 46 07 __ LSR $07
+0f69 : b0 eb __ BCS $0f56
+0f6b : d0 f6 __ BNE $0f63
+0f6d : a5 05 __ LDA $05
+0f6f : 95 00 __ STA $00,x
+0f71 : a5 06 __ LDA $06
+0f73 : 95 01 __ STA $01,x
+0f75 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0f78 : b1 19 __ LDA (IP + 0),y
+0f7a : aa __ __ TAX
+0f7b : b5 00 __ LDA $00,x
+0f7d : 2c b1 19 BIT $19b1 
+0f80 : 29 0f __ AND #$0f
+0f82 : f0 0b __ BEQ $0f8f
+0f84 : aa __ __ TAX
+0f85 : a5 1c __ LDA ACCU + 1
+0f87 : 06 1b __ ASL ACCU + 0
+0f89 : 2a __ __ ROL
+0f8a : ca __ __ DEX
+0f8b : d0 fa __ BNE $0f87
+0f8d : 85 1c __ STA ACCU + 1
+0f8f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0f92 : b1 19 __ LDA (IP + 0),y
+0f94 : aa __ __ TAX
+0f95 : 38 __ __ SEC
+0f96 : b5 01 __ LDA $01,x
+0f98 : e5 1c __ SBC ACCU + 1
+0f9a : f0 11 __ BEQ $0fad
+0f9c : 50 02 __ BVC $0fa0
+0f9e : 49 80 __ EOR #$80
+0fa0 : 30 2a __ BMI $0fcc
+0fa2 : 10 33 __ BPL $0fd7
+0fa4 : b1 19 __ LDA (IP + 0),y
+0fa6 : aa __ __ TAX
+0fa7 : b5 01 __ LDA $01,x
+0fa9 : c5 1c __ CMP ACCU + 1
+0fab : d0 28 __ BNE $0fd5
+0fad : b5 00 __ LDA $00,x
+0faf : c5 1b __ CMP ACCU + 0
+0fb1 : d0 22 __ BNE $0fd5
+0fb3 : f0 0e __ BEQ $0fc3
+0fb5 : b1 19 __ LDA (IP + 0),y
+0fb7 : aa __ __ TAX
+0fb8 : c8 __ __ INY
+0fb9 : b1 19 __ LDA (IP + 0),y
+0fbb : c5 1c __ CMP ACCU + 1
+0fbd : d0 16 __ BNE $0fd5
+0fbf : e4 1b __ CPX ACCU + 0
+0fc1 : d0 12 __ BNE $0fd5
+0fc3 : a9 00 __ LDA #$00
+0fc5 : 85 1b __ STA ACCU + 0
+0fc7 : 85 1c __ STA ACCU + 1
+0fc9 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fcc : a9 ff __ LDA #$ff
+0fce : 85 1b __ STA ACCU + 0
+0fd0 : 85 1c __ STA ACCU + 1
+0fd2 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fd5 : 90 f5 __ BCC $0fcc
+0fd7 : a9 01 __ LDA #$01
+0fd9 : 85 1b __ STA ACCU + 0
+0fdb : a9 00 __ LDA #$00
+0fdd : 85 1c __ STA ACCU + 1
+0fdf : 4c 50 08 JMP $0850 ; (startup + 79)
+0fe2 : b1 19 __ LDA (IP + 0),y
+0fe4 : c8 __ __ INY
+0fe5 : aa __ __ TAX
+0fe6 : b1 19 __ LDA (IP + 0),y
+0fe8 : 38 __ __ SEC
+0fe9 : e5 1c __ SBC ACCU + 1
+0feb : d0 af __ BNE $0f9c
+0fed : e4 1b __ CPX ACCU + 0
+0fef : d0 e4 __ BNE $0fd5
+0ff1 : f0 d0 __ BEQ $0fc3
+0ff3 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+0ff4 : b1 19 __ LDA (IP + 0),y
+0ff6 : aa __ __ TAX
+0ff7 : 38 __ __ SEC
+0ff8 : b5 00 __ LDA $00,x
+0ffa : e5 1b __ SBC ACCU + 0
+0ffc : f0 19 __ BEQ $1017
+0ffe : 50 02 __ BVC $1002
+1000 : 49 80 __ EOR #$80
+1002 : 30 1c __ BMI $1020
+1004 : 10 25 __ BPL $102b
+1006 : b1 19 __ LDA (IP + 0),y
+1008 : aa __ __ TAX
+1009 : b5 00 __ LDA $00,x
+100b : c5 1b __ CMP ACCU + 0
+100d : d0 1a __ BNE $1029
+100f : f0 06 __ BEQ $1017
+1011 : b1 19 __ LDA (IP + 0),y
+1013 : c5 1b __ CMP ACCU + 0
+1015 : d0 12 __ BNE $1029
+1017 : a9 00 __ LDA #$00
+1019 : 85 1b __ STA ACCU + 0
+101b : 85 1c __ STA ACCU + 1
+101d : 4c 50 08 JMP $0850 ; (startup + 79)
+1020 : a9 ff __ LDA #$ff
+1022 : 85 1b __ STA ACCU + 0
+1024 : 85 1c __ STA ACCU + 1
+1026 : 4c 50 08 JMP $0850 ; (startup + 79)
+1029 : 90 f5 __ BCC $1020
+102b : a9 01 __ LDA #$01
+102d : 85 1b __ STA ACCU + 0
+102f : a9 00 __ LDA #$00
+1031 : 85 1c __ STA ACCU + 1
+1033 : 4c 50 08 JMP $0850 ; (startup + 79)
+1036 : b1 19 __ LDA (IP + 0),y
+1038 : 38 __ __ SEC
+1039 : e5 1b __ SBC ACCU + 0
+103b : d0 c1 __ BNE $0ffe
+103d : f0 d8 __ BEQ $1017
+103f : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+1040 : b1 19 __ LDA (IP + 0),y
+1042 : 30 0c __ BMI $1050
+1044 : 38 __ __ SEC
+1045 : 65 19 __ ADC IP + 0
+1047 : 85 19 __ STA IP + 0
+1049 : 90 02 __ BCC $104d
+104b : e6 1a __ INC IP + 1
+104d : 4c 51 08 JMP $0851 ; (startup + 80)
+1050 : 38 __ __ SEC
+1051 : 65 19 __ ADC IP + 0
+1053 : 85 19 __ STA IP + 0
+1055 : b0 02 __ BCS $1059
+1057 : c6 1a __ DEC IP + 1
+1059 : 4c 51 08 JMP $0851 ; (startup + 80)
+105c : a5 1b __ LDA ACCU + 0
+105e : 05 1c __ ORA ACCU + 1
+1060 : f0 de __ BEQ $1040
+1062 : 4c 50 08 JMP $0850 ; (startup + 79)
+1065 : a5 1b __ LDA ACCU + 0
+1067 : 05 1c __ ORA ACCU + 1
+1069 : d0 d5 __ BNE $1040
+106b : 4c 50 08 JMP $0850 ; (startup + 79)
+106e : a5 1c __ LDA ACCU + 1
+1070 : 30 04 __ BMI $1076
+1072 : 05 1b __ ORA ACCU + 0
+1074 : d0 ca __ BNE $1040
+1076 : 4c 50 08 JMP $0850 ; (startup + 79)
+1079 : a5 1c __ LDA ACCU + 1
+107b : 10 c3 __ BPL $1040
+107d : 4c 50 08 JMP $0850 ; (startup + 79)
+1080 : a5 1c __ LDA ACCU + 1
+1082 : 30 bc __ BMI $1040
+1084 : 4c 50 08 JMP $0850 ; (startup + 79)
+1087 : a5 1c __ LDA ACCU + 1
+1089 : 30 b5 __ BMI $1040
+108b : 05 1b __ ORA ACCU + 0
+108d : f0 b1 __ BEQ $1040
+108f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1092 : 38 __ __ SEC
+1093 : b1 19 __ LDA (IP + 0),y
+1095 : 65 19 __ ADC IP + 0
+1097 : aa __ __ TAX
+1098 : c8 __ __ INY
+1099 : b1 19 __ LDA (IP + 0),y
+109b : 65 1a __ ADC IP + 1
+109d : 85 1a __ STA IP + 1
+109f : 86 19 __ STX IP + 0
+10a1 : 4c 51 08 JMP $0851 ; (startup + 80)
+10a4 : a5 1b __ LDA ACCU + 0
+10a6 : 05 1c __ ORA ACCU + 1
+10a8 : f0 e8 __ BEQ $1092
+10aa : c8 __ __ INY
+10ab : 4c 50 08 JMP $0850 ; (startup + 79)
+10ae : a5 1b __ LDA ACCU + 0
+10b0 : 05 1c __ ORA ACCU + 1
+10b2 : d0 de __ BNE $1092
+10b4 : c8 __ __ INY
+10b5 : 4c 50 08 JMP $0850 ; (startup + 79)
+10b8 : a5 1c __ LDA ACCU + 1
+10ba : 30 04 __ BMI $10c0
+10bc : 05 1b __ ORA ACCU + 0
+10be : d0 d2 __ BNE $1092
+10c0 : c8 __ __ INY
+10c1 : 4c 50 08 JMP $0850 ; (startup + 79)
+10c4 : a5 1c __ LDA ACCU + 1
+10c6 : 10 ca __ BPL $1092
+10c8 : c8 __ __ INY
+10c9 : 4c 50 08 JMP $0850 ; (startup + 79)
+10cc : a5 1c __ LDA ACCU + 1
+10ce : 30 c2 __ BMI $1092
+10d0 : c8 __ __ INY
+10d1 : 4c 50 08 JMP $0850 ; (startup + 79)
+10d4 : a5 1c __ LDA ACCU + 1
+10d6 : 30 ba __ BMI $1092
+10d8 : 05 1b __ ORA ACCU + 0
+10da : f0 b6 __ BEQ $1092
+10dc : c8 __ __ INY
+10dd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+10e0 : b1 19 __ LDA (IP + 0),y
+10e2 : 8d f6 10 STA $10f6 ; (inp_jsr + 22)
+10e5 : c8 __ __ INY
+10e6 : b1 19 __ LDA (IP + 0),y
+10e8 : 8d f7 10 STA $10f7 ; (inp_jsr + 23)
+10eb : 98 __ __ TYA
+10ec : 38 __ __ SEC
+10ed : 65 19 __ ADC IP + 0
+10ef : 85 19 __ STA IP + 0
+10f1 : 90 02 __ BCC $10f5
+10f3 : e6 1a __ INC IP + 1
+10f5 : 20 00 00 JSR $0000 
+10f8 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+10fb : 98 __ __ TYA
+10fc : 18 __ __ CLC
+10fd : 65 19 __ ADC IP + 0
+10ff : 8d 0a 11 STA $110a ; (inp_native + 15)
+1102 : a5 1a __ LDA IP + 1
+1104 : 69 00 __ ADC #$00
+1106 : 8d 0b 11 STA $110b ; (inp_native + 16)
+1109 : 20 00 00 JSR $0000 
+110c : a0 00 __ LDY #$00
+110e : b1 23 __ LDA (SP + 0),y
+1110 : 85 19 __ STA IP + 0
+1112 : c8 __ __ INY
+1113 : b1 23 __ LDA (SP + 0),y
+1115 : 85 1a __ STA IP + 1
+1117 : 88 __ __ DEY
+1118 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+111b : 38 __ __ SEC
+111c : a5 23 __ LDA SP + 0
+111e : f1 19 __ SBC (IP + 0),y
+1120 : c8 __ __ INY
+1121 : 85 23 __ STA SP + 0
+1123 : a5 24 __ LDA SP + 1
+1125 : f1 19 __ SBC (IP + 0),y
+1127 : c8 __ __ INY
+1128 : 85 24 __ STA SP + 1
+112a : b1 19 __ LDA (IP + 0),y
+112c : 84 02 __ STY $02
+112e : a8 __ __ TAY
+112f : a5 25 __ LDA FP + 0
+1131 : 91 23 __ STA (SP + 0),y
+1133 : c8 __ __ INY
+1134 : a5 26 __ LDA FP + 1
+1136 : 91 23 __ STA (SP + 0),y
+1138 : 98 __ __ TYA
+1139 : 38 __ __ SEC
+113a : 65 23 __ ADC SP + 0
+113c : 85 25 __ STA FP + 0
+113e : a9 00 __ LDA #$00
+1140 : 65 24 __ ADC SP + 1
+1142 : 85 26 __ STA FP + 1
+1144 : 88 __ __ DEY
+1145 : f0 08 __ BEQ $114f
+1147 : b9 52 00 LDA $0052,y 
+114a : 88 __ __ DEY
+114b : 91 23 __ STA (SP + 0),y
+114d : d0 f8 __ BNE $1147
+114f : a4 02 __ LDY $02
+1151 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+1154 : b1 19 __ LDA (IP + 0),y
+1156 : c8 __ __ INY
+1157 : 84 02 __ STY $02
+1159 : a8 __ __ TAY
+115a : b1 23 __ LDA (SP + 0),y
+115c : 85 25 __ STA FP + 0
+115e : c8 __ __ INY
+115f : b1 23 __ LDA (SP + 0),y
+1161 : 85 26 __ STA FP + 1
+1163 : 88 __ __ DEY
+1164 : f0 09 __ BEQ $116f
+1166 : 88 __ __ DEY
+1167 : b1 23 __ LDA (SP + 0),y
+1169 : 99 53 00 STA $0053,y 
+116c : 88 __ __ DEY
+116d : 10 f8 __ BPL $1167
+116f : a4 02 __ LDY $02
+1171 : 18 __ __ CLC
+1172 : b1 19 __ LDA (IP + 0),y
+1174 : c8 __ __ INY
+1175 : 65 23 __ ADC SP + 0
+1177 : 85 23 __ STA SP + 0
+1179 : b1 19 __ LDA (IP + 0),y
+117b : c8 __ __ INY
+117c : 65 24 __ ADC SP + 1
+117e : 85 24 __ STA SP + 1
+1180 : a0 01 __ LDY #$01
+1182 : b1 23 __ LDA (SP + 0),y
+1184 : 85 1a __ STA IP + 1
+1186 : 88 __ __ DEY
+1187 : b1 23 __ LDA (SP + 0),y
+1189 : 85 19 __ STA IP + 0
+118b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+118e : b1 19 __ LDA (IP + 0),y
+1190 : 85 1f __ STA ADDR + 0
+1192 : c8 __ __ INY
+1193 : b1 19 __ LDA (IP + 0),y
+1195 : 85 20 __ STA ADDR + 1
+1197 : c8 __ __ INY
+1198 : 98 __ __ TYA
+1199 : a0 00 __ LDY #$00
+119b : 18 __ __ CLC
+119c : 65 19 __ ADC IP + 0
+119e : 91 23 __ STA (SP + 0),y
+11a0 : c8 __ __ INY
+11a1 : a5 1a __ LDA IP + 1
+11a3 : 69 00 __ ADC #$00
+11a5 : 91 23 __ STA (SP + 0),y
+11a7 : a5 1f __ LDA ADDR + 0
+11a9 : 85 19 __ STA IP + 0
+11ab : a5 20 __ LDA ADDR + 1
+11ad : 85 1a __ STA IP + 1
+11af : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+11b2 : 38 __ __ SEC
+11b3 : a5 23 __ LDA SP + 0
+11b5 : f1 19 __ SBC (IP + 0),y
+11b7 : c8 __ __ INY
+11b8 : 85 23 __ STA SP + 0
+11ba : a5 24 __ LDA SP + 1
+11bc : f1 19 __ SBC (IP + 0),y
+11be : 85 24 __ STA SP + 1
+11c0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+11c3 : 18 __ __ CLC
+11c4 : b1 19 __ LDA (IP + 0),y
+11c6 : c8 __ __ INY
+11c7 : 65 23 __ ADC SP + 0
+11c9 : 85 23 __ STA SP + 0
+11cb : b1 19 __ LDA (IP + 0),y
+11cd : 65 24 __ ADC SP + 1
+11cf : 85 24 __ STA SP + 1
+11d1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+11d4 : 84 02 __ STY $02
+11d6 : a0 ff __ LDY #$ff
+11d8 : c8 __ __ INY
+11d9 : b1 1b __ LDA (ACCU + 0),y
+11db : 91 1f __ STA (ADDR + 0),y
+11dd : d0 f9 __ BNE $11d8
+11df : a4 02 __ LDY $02
+11e1 : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,710 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 24 0e STX $0e24 ; (spentry + 0)
+0811 : a9 47 __ LDA #$47
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0e __ LDA #$0e
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 10 __ LDA #$10
+081c : e9 0e __ SBC #$0e
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 47 __ LDA #$47
+0832 : e9 47 __ SBC #$47
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 4d 0d JMP $0d4d ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 07 __ SBC #$07
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 06 __ LDY #$06
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 04 __ SBC #$04
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 50 __ STA T0 + 0
+0928 : 85 51 __ STA T0 + 1
+092a : 85 52 __ STA T1 + 0
+092c : a9 00 __ LDA #$00
+092e : 8d 47 0e STA $0e47 ; (buffer + 0)
+0931 : 85 53 __ STA T2 + 0
+0933 : a9 47 __ LDA #$47
+0935 : 85 0d __ STA P0
+0937 : a9 0e __ LDA #$0e
+0939 : 85 0e __ STA P1
+093b : a5 53 __ LDA T2 + 0
+093d : 0a __ __ ASL
+093e : a8 __ __ TAY
+093f : b9 25 0e LDA $0e25,y ; (text + 0)
+0942 : 85 0f __ STA P2
+0944 : b9 26 0e LDA $0e26,y ; (text + 1)
+0947 : 85 10 __ STA P3
+0949 : 20 9f 0a JSR $0a9f ; (strcat + 0)
+094c : a9 47 __ LDA #$47
+094e : 85 0d __ STA P0
+0950 : a9 0e __ LDA #$0e
+0952 : 85 0e __ STA P1
+0954 : a9 3c __ LDA #$3c
+0956 : 85 0f __ STA P2
+0958 : a9 0b __ LDA #$0b
+095a : 85 10 __ STA P3
+095c : 20 9f 0a JSR $0a9f ; (strcat + 0)
+095f : e6 53 __ INC T2 + 0
+0961 : a5 53 __ LDA T2 + 0
+0963 : c9 11 __ CMP #$11
+0965 : 90 cc __ BCC $0933
+0967 : a9 47 __ LDA #$47
+0969 : 85 0d __ STA P0
+096b : a9 0e __ LDA #$0e
+096d : 85 0e __ STA P1
+096f : 20 3e 0b JSR $0b3e ; (strlen + 0)
+0972 : a5 1b __ LDA ACCU + 0
+0974 : 85 54 __ STA T3 + 0
+0976 : a5 1c __ LDA ACCU + 1
+0978 : 85 55 __ STA T3 + 1
+097a : a9 47 __ LDA #$47
+097c : 85 0d __ STA P0
+097e : a9 0e __ LDA #$0e
+0980 : 85 0e __ STA P1
+0982 : a9 6f __ LDA #$6f
+0984 : 85 0f __ STA P2
+0986 : 20 6f 0b JSR $0b6f ; (count + 0)
+0989 : 18 __ __ CLC
+098a : a5 50 __ LDA T0 + 0
+098c : 65 54 __ ADC T3 + 0
+098e : aa __ __ TAX
+098f : a5 51 __ LDA T0 + 1
+0991 : 65 55 __ ADC T3 + 1
+0993 : a8 __ __ TAY
+0994 : 18 __ __ CLC
+0995 : 8a __ __ TXA
+0996 : 65 1b __ ADC ACCU + 0
+0998 : 85 50 __ STA T0 + 0
+099a : 98 __ __ TYA
+099b : 65 1c __ ADC ACCU + 1
+099d : 85 51 __ STA T0 + 1
+099f : a9 00 __ LDA #$00
+09a1 : 85 53 __ STA T2 + 0
+09a3 : a9 47 __ LDA #$47
+09a5 : 85 54 __ STA T3 + 0
+09a7 : a9 0f __ LDA #$0f
+09a9 : 85 55 __ STA T3 + 1
+09ab : a5 53 __ LDA T2 + 0
+09ad : 0a __ __ ASL
+09ae : 0a __ __ ASL
+09af : 18 __ __ CLC
+09b0 : 65 53 __ ADC T2 + 0
+09b2 : 18 __ __ CLC
+09b3 : 65 52 __ ADC T1 + 0
+09b5 : 85 1b __ STA ACCU + 0
+09b7 : a9 00 __ LDA #$00
+09b9 : 85 1c __ STA ACCU + 1
+09bb : a9 11 __ LDA #$11
+09bd : 85 03 __ STA $03
+09bf : a9 00 __ LDA #$00
+09c1 : 85 04 __ STA $04
+09c3 : 20 fb 0d JSR $0dfb ; (mods16 + 0)
+09c6 : a5 05 __ LDA $05
+09c8 : 0a __ __ ASL
+09c9 : a8 __ __ TAY
+09ca : b9 25 0e LDA $0e25,y ; (text + 0)
+09cd : 85 56 __ STA T4 + 0
+09cf : b9 26 0e LDA $0e26,y ; (text + 1)
+09d2 : 85 57 __ STA T4 + 1
+09d4 : a0 ff __ LDY #$ff
+09d6 : c8 __ __ INY
+09d7 : b1 56 __ LDA (T4 + 0),y
+09d9 : 91 54 __ STA (T3 + 0),y
+09db : d0 f9 __ BNE $09d6
+09dd : 18 __ __ CLC
+09de : a5 54 __ LDA T3 + 0
+09e0 : 69 10 __ ADC #$10
+09e2 : 85 54 __ STA T3 + 0
+09e4 : 90 02 __ BCC $09e8
+09e6 : e6 55 __ INC T3 + 1
+09e8 : e6 53 __ INC T2 + 0
+09ea : a5 53 __ LDA T2 + 0
+09ec : c9 10 __ CMP #$10
+09ee : 90 bb __ BCC $09ab
+09f0 : a9 10 __ LDA #$10
+09f2 : a0 02 __ LDY #$02
+09f4 : 91 23 __ STA (SP + 0),y
+09f6 : a9 00 __ LDA #$00
+09f8 : c8 __ __ INY
+09f9 : 91 23 __ STA (SP + 0),y
+09fb : 20 b5 0b JSR $0bb5 ; (sort + 0)
+09fe : a9 57 __ LDA #$57
+0a00 : 85 56 __ STA T4 + 0
+0a02 : a9 0f __ LDA #$0f
+0a04 : 85 57 __ STA T4 + 1
+0a06 : a9 47 __ LDA #$47
+0a08 : 85 58 __ STA T5 + 0
+0a0a : a9 0f __ LDA #$0f
+0a0c : 85 59 __ STA T5 + 1
+0a0e : a5 58 __ LDA T5 + 0
+0a10 : 85 0d __ STA P0
+0a12 : a5 59 __ LDA T5 + 1
+0a14 : 85 0e __ STA P1
+0a16 : a5 56 __ LDA T4 + 0
+0a18 : 85 0f __ STA P2
+0a1a : a5 57 __ LDA T4 + 1
+0a1c : 85 10 __ STA P3
+0a1e : 20 1e 0d JSR $0d1e ; (strcmp + 0)
+0a21 : a5 1c __ LDA ACCU + 1
+0a23 : 30 04 __ BMI $0a29
+0a25 : 05 1b __ ORA ACCU + 0
+0a27 : d0 6d __ BNE $0a96
+0a29 : 18 __ __ CLC
+0a2a : a5 58 __ LDA T5 + 0
+0a2c : 69 10 __ ADC #$10
+0a2e : 85 58 __ STA T5 + 0
+0a30 : 90 02 __ BCC $0a34
+0a32 : e6 59 __ INC T5 + 1
+0a34 : 18 __ __ CLC
+0a35 : a5 56 __ LDA T4 + 0
+0a37 : 69 10 __ ADC #$10
+0a39 : 85 56 __ STA T4 + 0
+0a3b : 90 02 __ BCC $0a3f
+0a3d : e6 57 __ INC T4 + 1
+0a3f : a5 59 __ LDA T5 + 1
+0a41 : c9 10 __ CMP #$10
+0a43 : d0 04 __ BNE $0a49
+0a45 : a5 58 __ LDA T5 + 0
+0a47 : c9 37 __ CMP #$37
+0a49 : 90 c3 __ BCC $0a0e
+0a4b : e6 52 __ INC T1 + 0
+0a4d : a5 52 __ LDA T1 + 0
+0a4f : c9 14 __ CMP #$14
+0a51 : b0 03 __ BCS $0a56
+0a53 : 4c 2c 09 JMP $092c ; (main + 44)
+0a56 : a5 51 __ LDA T0 + 1
+0a58 : c9 07 __ CMP #$07
+0a5a : d0 06 __ BNE $0a62
+0a5c : a5 50 __ LDA T0 + 0
+0a5e : c9 1c __ CMP #$1c
+0a60 : f0 2d __ BEQ $0a8f
+0a62 : a9 02 __ LDA #$02
+0a64 : 85 1b __ STA ACCU + 0
+0a66 : a9 00 __ LDA #$00
+0a68 : 85 1c __ STA ACCU + 1
+0a6a : 18 __ __ CLC
+0a6b : a5 23 __ LDA SP + 0
+0a6d : 69 04 __ ADC #$04
+0a6f : 85 23 __ STA SP + 0
+0a71 : a5 24 __ LDA SP + 1
+0a73 : 69 00 __ ADC #$00
+0a75 : 85 24 __ STA SP + 1
+0a77 : a0 06 __ LDY #$06
+0a79 : b1 23 __ LDA (SP + 0),y
+0a7b : 99 53 00 STA $0053,y 
+0a7e : 88 __ __ DEY
+0a7f : 10 f8 __ BPL $0a79
+0a81 : 18 __ __ CLC
+0a82 : a5 23 __ LDA SP + 0
+0a84 : 69 07 __ ADC #$07
+0a86 : 85 23 __ STA SP + 0
+0a88 : a5 24 __ LDA SP + 1
+0a8a : 69 00 __ ADC #$00
+0a8c : 85 24 __ STA SP + 1
+0a8e : 60 __ __ RTS
+0a8f : a9 00 __ LDA #$00
+0a91 : 85 1b __ STA ACCU + 0
+0a93 : 4c 68 0a JMP $0a68 ; (main + 360)
+0a96 : a9 01 __ LDA #$01
+0a98 : 85 1b __ STA ACCU + 0
+0a9a : a9 00 __ LDA #$00
+0a9c : 4c 68 0a JMP $0a68 ; (main + 360)
+--------------------------------------------------------------------
+strcat:
+0a9f : a5 0f __ LDA P2
+0aa1 : 85 43 __ STA T0 + 0
+0aa3 : a5 10 __ LDA P3
+0aa5 : 85 44 __ STA T0 + 1
+0aa7 : a5 0d __ LDA P0
+0aa9 : 85 45 __ STA T1 + 0
+0aab : a5 0e __ LDA P1
+0aad : 85 46 __ STA T1 + 1
+0aaf : a0 00 __ LDY #$00
+0ab1 : b1 0d __ LDA (P0),y
+0ab3 : f0 14 __ BEQ $0ac9
+0ab5 : a5 45 __ LDA T1 + 0
+0ab7 : 85 48 __ STA T3 + 0
+0ab9 : a5 46 __ LDA T1 + 1
+0abb : 85 49 __ STA T3 + 1
+0abd : e6 45 __ INC T1 + 0
+0abf : d0 02 __ BNE $0ac3
+0ac1 : e6 46 __ INC T1 + 1
+0ac3 : a0 01 __ LDY #$01
+0ac5 : b1 48 __ LDA (T3 + 0),y
+0ac7 : d0 ec __ BNE $0ab5
+0ac9 : a0 00 __ LDY #$00
+0acb : b1 43 __ LDA (T0 + 0),y
+0acd : aa __ __ TAX
+0ace : 91 45 __ STA (T1 + 0),y
+0ad0 : e6 45 __ INC T1 + 0
+0ad2 : d0 02 __ BNE $0ad6
+0ad4 : e6 46 __ INC T1 + 1
+0ad6 : e6 43 __ INC T0 + 0
+0ad8 : d0 02 __ BNE $0adc
+0ada : e6 44 __ INC T0 + 1
+0adc : 8a __ __ TXA
+0add : d0 ea __ BNE $0ac9
+0adf : a5 0d __ LDA P0
+0ae1 : 85 1b __ STA ACCU + 0
+0ae3 : a5 0e __ LDA P1
+0ae5 : 85 1c __ STA ACCU + 1
+0ae7 : 60 __ __ RTS
+--------------------------------------------------------------------
+strlen:
+0b3e : a9 00 __ LDA #$00
+0b40 : 85 43 __ STA T0 + 0
+0b42 : 85 44 __ STA T0 + 1
+0b44 : a0 00 __ LDY #$00
+0b46 : b1 0d __ LDA (P0),y
+0b48 : d0 09 __ BNE $0b53
+0b4a : a5 43 __ LDA T0 + 0
+0b4c : 85 1b __ STA ACCU + 0
+0b4e : a5 44 __ LDA T0 + 1
+0b50 : 85 1c __ STA ACCU + 1
+0b52 : 60 __ __ RTS
+0b53 : 18 __ __ CLC
+0b54 : a5 0d __ LDA P0
+0b56 : 65 43 __ ADC T0 + 0
+0b58 : 85 48 __ STA T3 + 0
+0b5a : a5 0e __ LDA P1
+0b5c : 65 44 __ ADC T0 + 1
+0b5e : 85 49 __ STA T3 + 1
+0b60 : e6 43 __ INC T0 + 0
+0b62 : d0 02 __ BNE $0b66
+0b64 : e6 44 __ INC T0 + 1
+0b66 : a0 01 __ LDY #$01
+0b68 : b1 48 __ LDA (T3 + 0),y
+0b6a : d0 e7 __ BNE $0b53
+0b6c : 4c 4a 0b JMP $0b4a ; (strlen + 12)
+--------------------------------------------------------------------
+count:
+0b6f : a9 00 __ LDA #$00
+0b71 : aa __ __ TAX
+0b72 : 85 44 __ STA T0 + 1
+0b74 : a0 00 __ LDY #$00
+0b76 : b1 0d __ LDA (P0),y
+0b78 : d0 07 __ BNE $0b81
+0b7a : 86 1b __ STX ACCU + 0
+0b7c : a5 44 __ LDA T0 + 1
+0b7e : 85 1c __ STA ACCU + 1
+0b80 : 60 __ __ RTS
+0b81 : a5 0d __ LDA P0
+0b83 : 85 45 __ STA T1 + 0
+0b85 : a5 0e __ LDA P1
+0b87 : 85 46 __ STA T1 + 1
+0b89 : a0 00 __ LDY #$00
+0b8b : b1 0d __ LDA (P0),y
+0b8d : c5 0f __ CMP P2
+0b8f : f0 0f __ BEQ $0ba0
+0b91 : e6 0d __ INC P0
+0b93 : d0 02 __ BNE $0b97
+0b95 : e6 0e __ INC P1
+0b97 : a0 01 __ LDY #$01
+0b99 : b1 45 __ LDA (T1 + 0),y
+0b9b : d0 e4 __ BNE $0b81
+0b9d : 4c 7a 0b JMP $0b7a ; (count + 11)
+0ba0 : 18 __ __ CLC
+0ba1 : a5 0d __ LDA P0
+0ba3 : 69 01 __ ADC #$01
+0ba5 : 85 0d __ STA P0
+0ba7 : a5 0e __ LDA P1
+0ba9 : 69 00 __ ADC #$00
+0bab : 85 0e __ STA P1
+0bad : e8 __ __ INX
+0bae : d0 e7 __ BNE $0b97
+0bb0 : e6 44 __ INC T0 + 1
+0bb2 : 4c 97 0b JMP $0b97 ; (count + 40)
+--------------------------------------------------------------------
+sort:
+0bb5 : 38 __ __ SEC
+0bb6 : a5 23 __ LDA SP + 0
+0bb8 : e9 10 __ SBC #$10
+0bba : 85 23 __ STA SP + 0
+0bbc : a5 24 __ LDA SP + 1
+0bbe : e9 00 __ SBC #$00
+0bc0 : 85 24 __ STA SP + 1
+0bc2 : a0 12 __ LDY #$12
+0bc4 : b1 23 __ LDA (SP + 0),y
+0bc6 : 85 43 __ STA T0 + 0
+0bc8 : c8 __ __ INY
+0bc9 : b1 23 __ LDA (SP + 0),y
+0bcb : 10 0e __ BPL $0bdb
+0bcd : 18 __ __ CLC
+0bce : a5 23 __ LDA SP + 0
+0bd0 : 69 10 __ ADC #$10
+0bd2 : 85 23 __ STA SP + 0
+0bd4 : a5 24 __ LDA SP + 1
+0bd6 : 69 00 __ ADC #$00
+0bd8 : 85 24 __ STA SP + 1
+0bda : 60 __ __ RTS
+0bdb : d0 06 __ BNE $0be3
+0bdd : a9 01 __ LDA #$01
+0bdf : c5 43 __ CMP T0 + 0
+0be1 : b0 ea __ BCS $0bcd
+0be3 : a9 01 __ LDA #$01
+0be5 : 85 43 __ STA T0 + 0
+0be7 : a9 00 __ LDA #$00
+0be9 : 85 44 __ STA T0 + 1
+0beb : a9 57 __ LDA #$57
+0bed : 85 46 __ STA T2 + 0
+0bef : a9 0f __ LDA #$0f
+0bf1 : 85 47 __ STA T2 + 1
+0bf3 : a5 23 __ LDA SP + 0
+0bf5 : 85 48 __ STA T3 + 0
+0bf7 : a5 24 __ LDA SP + 1
+0bf9 : 85 49 __ STA T3 + 1
+0bfb : a0 ff __ LDY #$ff
+0bfd : c8 __ __ INY
+0bfe : b1 46 __ LDA (T2 + 0),y
+0c00 : 91 48 __ STA (T3 + 0),y
+0c02 : d0 f9 __ BNE $0bfd
+0c04 : a5 43 __ LDA T0 + 0
+0c06 : 85 48 __ STA T3 + 0
+0c08 : a5 44 __ LDA T0 + 1
+0c0a : 85 49 __ STA T3 + 1
+0c0c : 30 04 __ BMI $0c12
+0c0e : 05 43 __ ORA T0 + 0
+0c10 : d0 68 __ BNE $0c7a
+0c12 : a5 48 __ LDA T3 + 0
+0c14 : 85 1b __ STA ACCU + 0
+0c16 : a5 49 __ LDA T3 + 1
+0c18 : 06 1b __ ASL ACCU + 0
+0c1a : 2a __ __ ROL
+0c1b : 06 1b __ ASL ACCU + 0
+0c1d : 2a __ __ ROL
+0c1e : 06 1b __ ASL ACCU + 0
+0c20 : 2a __ __ ROL
+0c21 : 06 1b __ ASL ACCU + 0
+0c23 : 2a __ __ ROL
+0c24 : 85 1c __ STA ACCU + 1
+0c26 : 18 __ __ CLC
+0c27 : a9 47 __ LDA #$47
+0c29 : 65 1b __ ADC ACCU + 0
+0c2b : 85 48 __ STA T3 + 0
+0c2d : a9 0f __ LDA #$0f
+0c2f : 65 1c __ ADC ACCU + 1
+0c31 : 85 49 __ STA T3 + 1
+0c33 : a5 23 __ LDA SP + 0
+0c35 : 85 4a __ STA T4 + 0
+0c37 : a5 24 __ LDA SP + 1
+0c39 : 85 4b __ STA T4 + 1
+0c3b : a0 ff __ LDY #$ff
+0c3d : c8 __ __ INY
+0c3e : b1 4a __ LDA (T4 + 0),y
+0c40 : 91 48 __ STA (T3 + 0),y
+0c42 : d0 f9 __ BNE $0c3d
+0c44 : a0 12 __ LDY #$12
+0c46 : b1 23 __ LDA (SP + 0),y
+0c48 : 85 48 __ STA T3 + 0
+0c4a : c8 __ __ INY
+0c4b : b1 23 __ LDA (SP + 0),y
+0c4d : 85 49 __ STA T3 + 1
+0c4f : 18 __ __ CLC
+0c50 : a5 46 __ LDA T2 + 0
+0c52 : 69 10 __ ADC #$10
+0c54 : 85 46 __ STA T2 + 0
+0c56 : 90 02 __ BCC $0c5a
+0c58 : e6 47 __ INC T2 + 1
+0c5a : e6 43 __ INC T0 + 0
+0c5c : d0 02 __ BNE $0c60
+0c5e : e6 44 __ INC T0 + 1
+0c60 : a5 49 __ LDA T3 + 1
+0c62 : 49 80 __ EOR #$80
+0c64 : 85 03 __ STA $03
+0c66 : a5 44 __ LDA T0 + 1
+0c68 : 49 80 __ EOR #$80
+0c6a : c5 03 __ CMP $03
+0c6c : d0 04 __ BNE $0c72
+0c6e : a5 43 __ LDA T0 + 0
+0c70 : c5 48 __ CMP T3 + 0
+0c72 : b0 03 __ BCS $0c77
+0c74 : 4c f3 0b JMP $0bf3 ; (sort + 62)
+0c77 : 4c cd 0b JMP $0bcd ; (sort + 24)
+0c7a : 38 __ __ SEC
+0c7b : a5 43 __ LDA T0 + 0
+0c7d : e9 01 __ SBC #$01
+0c7f : 85 1b __ STA ACCU + 0
+0c81 : a5 44 __ LDA T0 + 1
+0c83 : e9 00 __ SBC #$00
+0c85 : 06 1b __ ASL ACCU + 0
+0c87 : 2a __ __ ROL
+0c88 : 06 1b __ ASL ACCU + 0
+0c8a : 2a __ __ ROL
+0c8b : 06 1b __ ASL ACCU + 0
+0c8d : 2a __ __ ROL
+0c8e : 06 1b __ ASL ACCU + 0
+0c90 : 2a __ __ ROL
+0c91 : 85 1c __ STA ACCU + 1
+0c93 : 18 __ __ CLC
+0c94 : a9 47 __ LDA #$47
+0c96 : 65 1b __ ADC ACCU + 0
+0c98 : 85 4a __ STA T4 + 0
+0c9a : a9 0f __ LDA #$0f
+0c9c : 65 1c __ ADC ACCU + 1
+0c9e : 85 4b __ STA T4 + 1
+0ca0 : a5 43 __ LDA T0 + 0
+0ca2 : 85 1b __ STA ACCU + 0
+0ca4 : a5 44 __ LDA T0 + 1
+0ca6 : 06 1b __ ASL ACCU + 0
+0ca8 : 2a __ __ ROL
+0ca9 : 06 1b __ ASL ACCU + 0
+0cab : 2a __ __ ROL
+0cac : 06 1b __ ASL ACCU + 0
+0cae : 2a __ __ ROL
+0caf : 06 1b __ ASL ACCU + 0
+0cb1 : 2a __ __ ROL
+0cb2 : 85 1c __ STA ACCU + 1
+0cb4 : 18 __ __ CLC
+0cb5 : a9 47 __ LDA #$47
+0cb7 : 65 1b __ ADC ACCU + 0
+0cb9 : 85 4c __ STA T5 + 0
+0cbb : a9 0f __ LDA #$0f
+0cbd : 65 1c __ ADC ACCU + 1
+0cbf : 85 4d __ STA T5 + 1
+0cc1 : a5 4a __ LDA T4 + 0
+0cc3 : 85 0d __ STA P0
+0cc5 : a5 4b __ LDA T4 + 1
+0cc7 : 85 0e __ STA P1
+0cc9 : a5 23 __ LDA SP + 0
+0ccb : 85 0f __ STA P2
+0ccd : a5 24 __ LDA SP + 1
+0ccf : 85 10 __ STA P3
+0cd1 : 20 1e 0d JSR $0d1e ; (strcmp + 0)
+0cd4 : a5 1c __ LDA ACCU + 1
+0cd6 : 10 03 __ BPL $0cdb
+0cd8 : 4c 12 0c JMP $0c12 ; (sort + 93)
+0cdb : 05 1b __ ORA ACCU + 0
+0cdd : d0 03 __ BNE $0ce2
+0cdf : 4c 12 0c JMP $0c12 ; (sort + 93)
+0ce2 : a0 ff __ LDY #$ff
+0ce4 : c8 __ __ INY
+0ce5 : b1 4a __ LDA (T4 + 0),y
+0ce7 : 91 4c __ STA (T5 + 0),y
+0ce9 : d0 f9 __ BNE $0ce4
+0ceb : 18 __ __ CLC
+0cec : a5 4a __ LDA T4 + 0
+0cee : 69 f0 __ ADC #$f0
+0cf0 : 85 4a __ STA T4 + 0
+0cf2 : a5 4b __ LDA T4 + 1
+0cf4 : 69 ff __ ADC #$ff
+0cf6 : 85 4b __ STA T4 + 1
+0cf8 : 18 __ __ CLC
+0cf9 : a5 4c __ LDA T5 + 0
+0cfb : 69 f0 __ ADC #$f0
+0cfd : 85 4c __ STA T5 + 0
+0cff : a5 4d __ LDA T5 + 1
+0d01 : 69 ff __ ADC #$ff
+0d03 : 85 4d __ STA T5 + 1
+0d05 : 18 __ __ CLC
+0d06 : a5 48 __ LDA T3 + 0
+0d08 : 69 ff __ ADC #$ff
+0d0a : 85 48 __ STA T3 + 0
+0d0c : a5 49 __ LDA T3 + 1
+0d0e : 69 ff __ ADC #$ff
+0d10 : 85 49 __ STA T3 + 1
+0d12 : 10 03 __ BPL $0d17
+0d14 : 4c 12 0c JMP $0c12 ; (sort + 93)
+0d17 : 05 48 __ ORA T3 + 0
+0d19 : d0 a6 __ BNE $0cc1
+0d1b : 4c 12 0c JMP $0c12 ; (sort + 93)
+--------------------------------------------------------------------
+strcmp:
+0d1e : a0 00 __ LDY #$00
+0d20 : 84 1c __ STY ACCU + 1
+0d22 : b1 0d __ LDA (P0),y
+0d24 : f0 16 __ BEQ $0d3c
+0d26 : d1 0f __ CMP (P2),y
+0d28 : d0 16 __ BNE $0d40
+0d2a : c8 __ __ INY
+0d2b : b1 0d __ LDA (P0),y
+0d2d : f0 0d __ BEQ $0d3c
+0d2f : d1 0f __ CMP (P2),y
+0d31 : d0 0d __ BNE $0d40
+0d33 : c8 __ __ INY
+0d34 : d0 ec __ BNE $0d22
+0d36 : e6 0e __ INC P1
+0d38 : e6 10 __ INC P3
+0d3a : d0 e6 __ BNE $0d22
+0d3c : d1 0f __ CMP (P2),y
+0d3e : f0 0a __ BEQ $0d4a
+0d40 : b0 06 __ BCS $0d48
+0d42 : a9 ff __ LDA #$ff
+0d44 : 85 1c __ STA ACCU + 1
+0d46 : 30 02 __ BMI $0d4a
+0d48 : a9 01 __ LDA #$01
+0d4a : 85 1b __ STA ACCU + 0
+0d4c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0d4d : a9 4c __ LDA #$4c
+0d4f : 85 54 __ STA $54
+0d51 : a9 00 __ LDA #$00
+0d53 : 85 13 __ STA P6
+0d55 : a9 19 __ LDA #$19
+0d57 : 85 16 __ STA P9
+0d59 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0d5a : 38 __ __ SEC
+0d5b : a9 00 __ LDA #$00
+0d5d : e5 1b __ SBC ACCU + 0
+0d5f : 85 1b __ STA ACCU + 0
+0d61 : a9 00 __ LDA #$00
+0d63 : e5 1c __ SBC ACCU + 1
+0d65 : 85 1c __ STA ACCU + 1
+0d67 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0d68 : 38 __ __ SEC
+0d69 : a9 00 __ LDA #$00
+0d6b : e5 03 __ SBC $03
+0d6d : 85 03 __ STA $03
+0d6f : a9 00 __ LDA #$00
+0d71 : e5 04 __ SBC $04
+0d73 : 85 04 __ STA $04
+0d75 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0d76 : a5 1c __ LDA ACCU + 1
+0d78 : d0 31 __ BNE $0dab
+0d7a : a5 04 __ LDA $04
+0d7c : d0 1e __ BNE $0d9c
+0d7e : 85 06 __ STA $06
+0d80 : a2 04 __ LDX #$04
+0d82 : 06 1b __ ASL ACCU + 0
+0d84 : 2a __ __ ROL
+0d85 : c5 03 __ CMP $03
+0d87 : 90 02 __ BCC $0d8b
+0d89 : e5 03 __ SBC $03
+0d8b : 26 1b __ ROL ACCU + 0
+0d8d : 2a __ __ ROL
+0d8e : c5 03 __ CMP $03
+0d90 : 90 02 __ BCC $0d94
+0d92 : e5 03 __ SBC $03
+0d94 : 26 1b __ ROL ACCU + 0
+0d96 : ca __ __ DEX
+0d97 : d0 eb __ BNE $0d84
+0d99 : 85 05 __ STA $05
+0d9b : 60 __ __ RTS
+0d9c : a5 1b __ LDA ACCU + 0
+0d9e : 85 05 __ STA $05
+0da0 : a5 1c __ LDA ACCU + 1
+0da2 : 85 06 __ STA $06
+0da4 : a9 00 __ LDA #$00
+0da6 : 85 1b __ STA ACCU + 0
+0da8 : 85 1c __ STA ACCU + 1
+0daa : 60 __ __ RTS
+0dab : a5 04 __ LDA $04
+0dad : d0 1f __ BNE $0dce
+0daf : a5 03 __ LDA $03
+0db1 : 30 1b __ BMI $0dce
+0db3 : a9 00 __ LDA #$00
+0db5 : 85 06 __ STA $06
+0db7 : a2 10 __ LDX #$10
+0db9 : 06 1b __ ASL ACCU + 0
+0dbb : 26 1c __ ROL ACCU + 1
+0dbd : 2a __ __ ROL
+0dbe : c5 03 __ CMP $03
+0dc0 : 90 02 __ BCC $0dc4
+0dc2 : e5 03 __ SBC $03
+0dc4 : 26 1b __ ROL ACCU + 0
+0dc6 : 26 1c __ ROL ACCU + 1
+0dc8 : ca __ __ DEX
+0dc9 : d0 f2 __ BNE $0dbd
+0dcb : 85 05 __ STA $05
+0dcd : 60 __ __ RTS
+0dce : a9 00 __ LDA #$00
+0dd0 : 85 05 __ STA $05
+0dd2 : 85 06 __ STA $06
+0dd4 : 84 02 __ STY $02
+0dd6 : a0 10 __ LDY #$10
+0dd8 : 18 __ __ CLC
+0dd9 : 26 1b __ ROL ACCU + 0
+0ddb : 26 1c __ ROL ACCU + 1
+0ddd : 26 05 __ ROL $05
+0ddf : 26 06 __ ROL $06
+0de1 : 38 __ __ SEC
+0de2 : a5 05 __ LDA $05
+0de4 : e5 03 __ SBC $03
+0de6 : aa __ __ TAX
+0de7 : a5 06 __ LDA $06
+0de9 : e5 04 __ SBC $04
+0deb : 90 04 __ BCC $0df1
+0ded : 86 05 __ STX $05
+0def : 85 06 __ STA $06
+0df1 : 88 __ __ DEY
+0df2 : d0 e5 __ BNE $0dd9
+0df4 : 26 1b __ ROL ACCU + 0
+0df6 : 26 1c __ ROL ACCU + 1
+0df8 : a4 02 __ LDY $02
+0dfa : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+0dfb : 24 1c __ BIT ACCU + 1
+0dfd : 10 0d __ BPL $0e0c
+0dff : 20 5a 0d JSR $0d5a ; (negaccu + 0)
+0e02 : 24 04 __ BIT $04
+0e04 : 10 0d __ BPL $0e13
+0e06 : 20 68 0d JSR $0d68 ; (negtmp + 0)
+0e09 : 4c 76 0d JMP $0d76 ; (divmod + 0)
+0e0c : 24 04 __ BIT $04
+0e0e : 10 f9 __ BPL $0e09
+0e10 : 20 68 0d JSR $0d68 ; (negtmp + 0)
+0e13 : 20 76 0d JSR $0d76 ; (divmod + 0)
+0e16 : 38 __ __ SEC
+0e17 : a9 00 __ LDA #$00
+0e19 : e5 05 __ SBC $05
+0e1b : 85 05 __ STA $05
+0e1d : a9 00 __ LDA #$00
+0e1f : e5 06 __ SBC $06
+0e21 : 85 06 __ STA $06
+0e23 : 60 __ __ RTS
@@ -0,0 +1,663 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e cb 0d STX $0dcb ; (spentry + 0)
+0811 : a9 ee __ LDA #$ee
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0d __ LDA #$0d
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0f __ LDA #$0f
+081c : e9 0d __ SBC #$0d
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 fe __ LDA #$fe
+0832 : e9 ee __ SBC #$ee
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c f4 0c JMP $0cf4 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 04 __ SBC #$04
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 50 __ STA T0 + 0
+0911 : 85 51 __ STA T0 + 1
+0913 : 85 52 __ STA T1 + 0
+0915 : a9 00 __ LDA #$00
+0917 : 8d ee 0d STA $0dee ; (buffer + 0)
+091a : 85 53 __ STA T2 + 0
+091c : a9 ee __ LDA #$ee
+091e : 85 0d __ STA P0
+0920 : a9 0d __ LDA #$0d
+0922 : 85 0e __ STA P1
+0924 : a5 53 __ LDA T2 + 0
+0926 : 0a __ __ ASL
+0927 : a8 __ __ TAY
+0928 : b9 cc 0d LDA $0dcc,y ; (text + 0)
+092b : 85 0f __ STA P2
+092d : b9 cd 0d LDA $0dcd,y ; (text + 1)
+0930 : 85 10 __ STA P3
+0932 : 20 71 0a JSR $0a71 ; (strcat + 0)
+0935 : a9 ee __ LDA #$ee
+0937 : 85 0d __ STA P0
+0939 : a9 0d __ LDA #$0d
+093b : 85 0e __ STA P1
+093d : a9 0e __ LDA #$0e
+093f : 85 0f __ STA P2
+0941 : a9 0b __ LDA #$0b
+0943 : 85 10 __ STA P3
+0945 : 20 71 0a JSR $0a71 ; (strcat + 0)
+0948 : e6 53 __ INC T2 + 0
+094a : a5 53 __ LDA T2 + 0
+094c : c9 11 __ CMP #$11
+094e : 90 cc __ BCC $091c
+0950 : a9 ee __ LDA #$ee
+0952 : 85 0d __ STA P0
+0954 : a9 0d __ LDA #$0d
+0956 : 85 0e __ STA P1
+0958 : 20 10 0b JSR $0b10 ; (strlen + 0)
+095b : a5 1b __ LDA ACCU + 0
+095d : 85 54 __ STA T3 + 0
+095f : a5 1c __ LDA ACCU + 1
+0961 : 85 55 __ STA T3 + 1
+0963 : a9 ee __ LDA #$ee
+0965 : 85 0d __ STA P0
+0967 : a9 0d __ LDA #$0d
+0969 : 85 0e __ STA P1
+096b : a9 6f __ LDA #$6f
+096d : 85 0f __ STA P2
+096f : 20 41 0b JSR $0b41 ; (count + 0)
+0972 : 18 __ __ CLC
+0973 : a5 50 __ LDA T0 + 0
+0975 : 65 54 __ ADC T3 + 0
+0977 : aa __ __ TAX
+0978 : a5 51 __ LDA T0 + 1
+097a : 65 55 __ ADC T3 + 1
+097c : a8 __ __ TAY
+097d : 18 __ __ CLC
+097e : 8a __ __ TXA
+097f : 65 1b __ ADC ACCU + 0
+0981 : 85 50 __ STA T0 + 0
+0983 : 98 __ __ TYA
+0984 : 65 1c __ ADC ACCU + 1
+0986 : 85 51 __ STA T0 + 1
+0988 : a9 00 __ LDA #$00
+098a : 85 53 __ STA T2 + 0
+098c : a9 ee __ LDA #$ee
+098e : 85 54 __ STA T3 + 0
+0990 : a9 0e __ LDA #$0e
+0992 : 85 55 __ STA T3 + 1
+0994 : a5 53 __ LDA T2 + 0
+0996 : 0a __ __ ASL
+0997 : 0a __ __ ASL
+0998 : 18 __ __ CLC
+0999 : 65 53 __ ADC T2 + 0
+099b : 18 __ __ CLC
+099c : 65 52 __ ADC T1 + 0
+099e : 85 1b __ STA ACCU + 0
+09a0 : a9 00 __ LDA #$00
+09a2 : 85 1c __ STA ACCU + 1
+09a4 : a9 11 __ LDA #$11
+09a6 : 85 03 __ STA $03
+09a8 : a9 00 __ LDA #$00
+09aa : 85 04 __ STA $04
+09ac : 20 a2 0d JSR $0da2 ; (mods16 + 0)
+09af : a5 05 __ LDA $05
+09b1 : 0a __ __ ASL
+09b2 : a8 __ __ TAY
+09b3 : b9 cc 0d LDA $0dcc,y ; (text + 0)
+09b6 : 85 56 __ STA T4 + 0
+09b8 : b9 cd 0d LDA $0dcd,y ; (text + 1)
+09bb : 85 57 __ STA T4 + 1
+09bd : a0 ff __ LDY #$ff
+09bf : c8 __ __ INY
+09c0 : b1 56 __ LDA (T4 + 0),y
+09c2 : 91 54 __ STA (T3 + 0),y
+09c4 : d0 f9 __ BNE $09bf
+09c6 : 18 __ __ CLC
+09c7 : a5 54 __ LDA T3 + 0
+09c9 : 69 10 __ ADC #$10
+09cb : 85 54 __ STA T3 + 0
+09cd : 90 02 __ BCC $09d1
+09cf : e6 55 __ INC T3 + 1
+09d1 : e6 53 __ INC T2 + 0
+09d3 : a5 53 __ LDA T2 + 0
+09d5 : c9 10 __ CMP #$10
+09d7 : 90 bb __ BCC $0994
+09d9 : a9 10 __ LDA #$10
+09db : a0 02 __ LDY #$02
+09dd : 91 23 __ STA (SP + 0),y
+09df : a9 00 __ LDA #$00
+09e1 : c8 __ __ INY
+09e2 : 91 23 __ STA (SP + 0),y
+09e4 : 20 87 0b JSR $0b87 ; (sort + 0)
+09e7 : a9 fe __ LDA #$fe
+09e9 : 85 56 __ STA T4 + 0
+09eb : a9 0e __ LDA #$0e
+09ed : 85 57 __ STA T4 + 1
+09ef : a9 ee __ LDA #$ee
+09f1 : 85 58 __ STA T5 + 0
+09f3 : a9 0e __ LDA #$0e
+09f5 : 85 59 __ STA T5 + 1
+09f7 : a5 58 __ LDA T5 + 0
+09f9 : 85 0d __ STA P0
+09fb : a5 59 __ LDA T5 + 1
+09fd : 85 0e __ STA P1
+09ff : a5 56 __ LDA T4 + 0
+0a01 : 85 0f __ STA P2
+0a03 : a5 57 __ LDA T4 + 1
+0a05 : 85 10 __ STA P3
+0a07 : 20 c5 0c JSR $0cc5 ; (strcmp + 0)
+0a0a : a5 1c __ LDA ACCU + 1
+0a0c : 30 04 __ BMI $0a12
+0a0e : 05 1b __ ORA ACCU + 0
+0a10 : d0 56 __ BNE $0a68
+0a12 : 18 __ __ CLC
+0a13 : a5 58 __ LDA T5 + 0
+0a15 : 69 10 __ ADC #$10
+0a17 : 85 58 __ STA T5 + 0
+0a19 : 90 02 __ BCC $0a1d
+0a1b : e6 59 __ INC T5 + 1
+0a1d : 18 __ __ CLC
+0a1e : a5 56 __ LDA T4 + 0
+0a20 : 69 10 __ ADC #$10
+0a22 : 85 56 __ STA T4 + 0
+0a24 : 90 02 __ BCC $0a28
+0a26 : e6 57 __ INC T4 + 1
+0a28 : a5 59 __ LDA T5 + 1
+0a2a : c9 0f __ CMP #$0f
+0a2c : d0 04 __ BNE $0a32
+0a2e : a5 58 __ LDA T5 + 0
+0a30 : c9 de __ CMP #$de
+0a32 : 90 c3 __ BCC $09f7
+0a34 : e6 52 __ INC T1 + 0
+0a36 : a5 52 __ LDA T1 + 0
+0a38 : c9 14 __ CMP #$14
+0a3a : b0 03 __ BCS $0a3f
+0a3c : 4c 15 09 JMP $0915 ; (main + 21)
+0a3f : a5 51 __ LDA T0 + 1
+0a41 : c9 07 __ CMP #$07
+0a43 : d0 06 __ BNE $0a4b
+0a45 : a5 50 __ LDA T0 + 0
+0a47 : c9 1c __ CMP #$1c
+0a49 : f0 16 __ BEQ $0a61
+0a4b : a9 02 __ LDA #$02
+0a4d : 85 1b __ STA ACCU + 0
+0a4f : a9 00 __ LDA #$00
+0a51 : 85 1c __ STA ACCU + 1
+0a53 : 18 __ __ CLC
+0a54 : a5 23 __ LDA SP + 0
+0a56 : 69 04 __ ADC #$04
+0a58 : 85 23 __ STA SP + 0
+0a5a : a5 24 __ LDA SP + 1
+0a5c : 69 00 __ ADC #$00
+0a5e : 85 24 __ STA SP + 1
+0a60 : 60 __ __ RTS
+0a61 : a9 00 __ LDA #$00
+0a63 : 85 1b __ STA ACCU + 0
+0a65 : 4c 51 0a JMP $0a51 ; (main + 337)
+0a68 : a9 01 __ LDA #$01
+0a6a : 85 1b __ STA ACCU + 0
+0a6c : a9 00 __ LDA #$00
+0a6e : 4c 51 0a JMP $0a51 ; (main + 337)
+--------------------------------------------------------------------
+strcat:
+0a71 : a5 0f __ LDA P2
+0a73 : 85 43 __ STA T0 + 0
+0a75 : a5 10 __ LDA P3
+0a77 : 85 44 __ STA T0 + 1
+0a79 : a5 0d __ LDA P0
+0a7b : 85 45 __ STA T1 + 0
+0a7d : a5 0e __ LDA P1
+0a7f : 85 46 __ STA T1 + 1
+0a81 : a0 00 __ LDY #$00
+0a83 : b1 0d __ LDA (P0),y
+0a85 : f0 14 __ BEQ $0a9b
+0a87 : a5 45 __ LDA T1 + 0
+0a89 : 85 48 __ STA T3 + 0
+0a8b : a5 46 __ LDA T1 + 1
+0a8d : 85 49 __ STA T3 + 1
+0a8f : e6 45 __ INC T1 + 0
+0a91 : d0 02 __ BNE $0a95
+0a93 : e6 46 __ INC T1 + 1
+0a95 : a0 01 __ LDY #$01
+0a97 : b1 48 __ LDA (T3 + 0),y
+0a99 : d0 ec __ BNE $0a87
+0a9b : a0 00 __ LDY #$00
+0a9d : b1 43 __ LDA (T0 + 0),y
+0a9f : aa __ __ TAX
+0aa0 : 91 45 __ STA (T1 + 0),y
+0aa2 : e6 45 __ INC T1 + 0
+0aa4 : d0 02 __ BNE $0aa8
+0aa6 : e6 46 __ INC T1 + 1
+0aa8 : e6 43 __ INC T0 + 0
+0aaa : d0 02 __ BNE $0aae
+0aac : e6 44 __ INC T0 + 1
+0aae : 8a __ __ TXA
+0aaf : d0 ea __ BNE $0a9b
+0ab1 : a5 0d __ LDA P0
+0ab3 : 85 1b __ STA ACCU + 0
+0ab5 : a5 0e __ LDA P1
+0ab7 : 85 1c __ STA ACCU + 1
+0ab9 : 60 __ __ RTS
+--------------------------------------------------------------------
+strlen:
+0b10 : a9 00 __ LDA #$00
+0b12 : 85 43 __ STA T0 + 0
+0b14 : 85 44 __ STA T0 + 1
+0b16 : a0 00 __ LDY #$00
+0b18 : b1 0d __ LDA (P0),y
+0b1a : d0 09 __ BNE $0b25
+0b1c : a5 43 __ LDA T0 + 0
+0b1e : 85 1b __ STA ACCU + 0
+0b20 : a5 44 __ LDA T0 + 1
+0b22 : 85 1c __ STA ACCU + 1
+0b24 : 60 __ __ RTS
+0b25 : 18 __ __ CLC
+0b26 : a5 0d __ LDA P0
+0b28 : 65 43 __ ADC T0 + 0
+0b2a : 85 48 __ STA T3 + 0
+0b2c : a5 0e __ LDA P1
+0b2e : 65 44 __ ADC T0 + 1
+0b30 : 85 49 __ STA T3 + 1
+0b32 : e6 43 __ INC T0 + 0
+0b34 : d0 02 __ BNE $0b38
+0b36 : e6 44 __ INC T0 + 1
+0b38 : a0 01 __ LDY #$01
+0b3a : b1 48 __ LDA (T3 + 0),y
+0b3c : d0 e7 __ BNE $0b25
+0b3e : 4c 1c 0b JMP $0b1c ; (strlen + 12)
+--------------------------------------------------------------------
+count:
+0b41 : a9 00 __ LDA #$00
+0b43 : aa __ __ TAX
+0b44 : 85 44 __ STA T0 + 1
+0b46 : a0 00 __ LDY #$00
+0b48 : b1 0d __ LDA (P0),y
+0b4a : d0 07 __ BNE $0b53
+0b4c : 86 1b __ STX ACCU + 0
+0b4e : a5 44 __ LDA T0 + 1
+0b50 : 85 1c __ STA ACCU + 1
+0b52 : 60 __ __ RTS
+0b53 : a5 0d __ LDA P0
+0b55 : 85 45 __ STA T1 + 0
+0b57 : a5 0e __ LDA P1
+0b59 : 85 46 __ STA T1 + 1
+0b5b : a0 00 __ LDY #$00
+0b5d : b1 0d __ LDA (P0),y
+0b5f : c5 0f __ CMP P2
+0b61 : f0 0f __ BEQ $0b72
+0b63 : e6 0d __ INC P0
+0b65 : d0 02 __ BNE $0b69
+0b67 : e6 0e __ INC P1
+0b69 : a0 01 __ LDY #$01
+0b6b : b1 45 __ LDA (T1 + 0),y
+0b6d : d0 e4 __ BNE $0b53
+0b6f : 4c 4c 0b JMP $0b4c ; (count + 11)
+0b72 : 18 __ __ CLC
+0b73 : a5 0d __ LDA P0
+0b75 : 69 01 __ ADC #$01
+0b77 : 85 0d __ STA P0
+0b79 : a5 0e __ LDA P1
+0b7b : 69 00 __ ADC #$00
+0b7d : 85 0e __ STA P1
+0b7f : e8 __ __ INX
+0b80 : d0 e7 __ BNE $0b69
+0b82 : e6 44 __ INC T0 + 1
+0b84 : 4c 69 0b JMP $0b69 ; (count + 40)
+--------------------------------------------------------------------
+sort:
+0b87 : a0 02 __ LDY #$02
+0b89 : b1 23 __ LDA (SP + 0),y
+0b8b : 85 43 __ STA T0 + 0
+0b8d : c8 __ __ INY
+0b8e : b1 23 __ LDA (SP + 0),y
+0b90 : 10 01 __ BPL $0b93
+0b92 : 60 __ __ RTS
+0b93 : d0 06 __ BNE $0b9b
+0b95 : a9 01 __ LDA #$01
+0b97 : c5 43 __ CMP T0 + 0
+0b99 : b0 f7 __ BCS $0b92
+0b9b : a9 01 __ LDA #$01
+0b9d : 85 43 __ STA T0 + 0
+0b9f : a9 00 __ LDA #$00
+0ba1 : 85 44 __ STA T0 + 1
+0ba3 : a9 fe __ LDA #$fe
+0ba5 : 85 46 __ STA T2 + 0
+0ba7 : a9 0e __ LDA #$0e
+0ba9 : 85 47 __ STA T2 + 1
+0bab : a0 ff __ LDY #$ff
+0bad : c8 __ __ INY
+0bae : b1 46 __ LDA (T2 + 0),y
+0bb0 : 99 ee 0f STA $0fee,y ; (sframe + 0)
+0bb3 : d0 f8 __ BNE $0bad
+0bb5 : a5 43 __ LDA T0 + 0
+0bb7 : 85 48 __ STA T3 + 0
+0bb9 : a5 44 __ LDA T0 + 1
+0bbb : 85 49 __ STA T3 + 1
+0bbd : 30 04 __ BMI $0bc3
+0bbf : 05 43 __ ORA T0 + 0
+0bc1 : d0 5e __ BNE $0c21
+0bc3 : a5 48 __ LDA T3 + 0
+0bc5 : 85 1b __ STA ACCU + 0
+0bc7 : a5 49 __ LDA T3 + 1
+0bc9 : 06 1b __ ASL ACCU + 0
+0bcb : 2a __ __ ROL
+0bcc : 06 1b __ ASL ACCU + 0
+0bce : 2a __ __ ROL
+0bcf : 06 1b __ ASL ACCU + 0
+0bd1 : 2a __ __ ROL
+0bd2 : 06 1b __ ASL ACCU + 0
+0bd4 : 2a __ __ ROL
+0bd5 : 85 1c __ STA ACCU + 1
+0bd7 : 18 __ __ CLC
+0bd8 : a9 ee __ LDA #$ee
+0bda : 65 1b __ ADC ACCU + 0
+0bdc : 85 48 __ STA T3 + 0
+0bde : a9 0e __ LDA #$0e
+0be0 : 65 1c __ ADC ACCU + 1
+0be2 : 85 49 __ STA T3 + 1
+0be4 : a0 ff __ LDY #$ff
+0be6 : c8 __ __ INY
+0be7 : b9 ee 0f LDA $0fee,y ; (sframe + 0)
+0bea : 91 48 __ STA (T3 + 0),y
+0bec : d0 f8 __ BNE $0be6
+0bee : a0 02 __ LDY #$02
+0bf0 : b1 23 __ LDA (SP + 0),y
+0bf2 : 85 48 __ STA T3 + 0
+0bf4 : c8 __ __ INY
+0bf5 : b1 23 __ LDA (SP + 0),y
+0bf7 : 85 49 __ STA T3 + 1
+0bf9 : 18 __ __ CLC
+0bfa : a5 46 __ LDA T2 + 0
+0bfc : 69 10 __ ADC #$10
+0bfe : 85 46 __ STA T2 + 0
+0c00 : 90 02 __ BCC $0c04
+0c02 : e6 47 __ INC T2 + 1
+0c04 : e6 43 __ INC T0 + 0
+0c06 : d0 02 __ BNE $0c0a
+0c08 : e6 44 __ INC T0 + 1
+0c0a : a5 49 __ LDA T3 + 1
+0c0c : 49 80 __ EOR #$80
+0c0e : 85 03 __ STA $03
+0c10 : a5 44 __ LDA T0 + 1
+0c12 : 49 80 __ EOR #$80
+0c14 : c5 03 __ CMP $03
+0c16 : d0 04 __ BNE $0c1c
+0c18 : a5 43 __ LDA T0 + 0
+0c1a : c5 48 __ CMP T3 + 0
+0c1c : 90 8d __ BCC $0bab
+0c1e : 4c 92 0b JMP $0b92 ; (sort + 11)
+0c21 : 38 __ __ SEC
+0c22 : a5 43 __ LDA T0 + 0
+0c24 : e9 01 __ SBC #$01
+0c26 : 85 1b __ STA ACCU + 0
+0c28 : a5 44 __ LDA T0 + 1
+0c2a : e9 00 __ SBC #$00
+0c2c : 06 1b __ ASL ACCU + 0
+0c2e : 2a __ __ ROL
+0c2f : 06 1b __ ASL ACCU + 0
+0c31 : 2a __ __ ROL
+0c32 : 06 1b __ ASL ACCU + 0
+0c34 : 2a __ __ ROL
+0c35 : 06 1b __ ASL ACCU + 0
+0c37 : 2a __ __ ROL
+0c38 : 85 1c __ STA ACCU + 1
+0c3a : 18 __ __ CLC
+0c3b : a9 ee __ LDA #$ee
+0c3d : 65 1b __ ADC ACCU + 0
+0c3f : 85 4a __ STA T4 + 0
+0c41 : a9 0e __ LDA #$0e
+0c43 : 65 1c __ ADC ACCU + 1
+0c45 : 85 4b __ STA T4 + 1
+0c47 : a5 43 __ LDA T0 + 0
+0c49 : 85 1b __ STA ACCU + 0
+0c4b : a5 44 __ LDA T0 + 1
+0c4d : 06 1b __ ASL ACCU + 0
+0c4f : 2a __ __ ROL
+0c50 : 06 1b __ ASL ACCU + 0
+0c52 : 2a __ __ ROL
+0c53 : 06 1b __ ASL ACCU + 0
+0c55 : 2a __ __ ROL
+0c56 : 06 1b __ ASL ACCU + 0
+0c58 : 2a __ __ ROL
+0c59 : 85 1c __ STA ACCU + 1
+0c5b : 18 __ __ CLC
+0c5c : a9 ee __ LDA #$ee
+0c5e : 65 1b __ ADC ACCU + 0
+0c60 : 85 4c __ STA T5 + 0
+0c62 : a9 0e __ LDA #$0e
+0c64 : 65 1c __ ADC ACCU + 1
+0c66 : 85 4d __ STA T5 + 1
+0c68 : a5 4a __ LDA T4 + 0
+0c6a : 85 0d __ STA P0
+0c6c : a5 4b __ LDA T4 + 1
+0c6e : 85 0e __ STA P1
+0c70 : a9 ee __ LDA #$ee
+0c72 : 85 0f __ STA P2
+0c74 : a9 0f __ LDA #$0f
+0c76 : 85 10 __ STA P3
+0c78 : 20 c5 0c JSR $0cc5 ; (strcmp + 0)
+0c7b : a5 1c __ LDA ACCU + 1
+0c7d : 10 03 __ BPL $0c82
+0c7f : 4c c3 0b JMP $0bc3 ; (sort + 60)
+0c82 : 05 1b __ ORA ACCU + 0
+0c84 : d0 03 __ BNE $0c89
+0c86 : 4c c3 0b JMP $0bc3 ; (sort + 60)
+0c89 : a0 ff __ LDY #$ff
+0c8b : c8 __ __ INY
+0c8c : b1 4a __ LDA (T4 + 0),y
+0c8e : 91 4c __ STA (T5 + 0),y
+0c90 : d0 f9 __ BNE $0c8b
+0c92 : 18 __ __ CLC
+0c93 : a5 4a __ LDA T4 + 0
+0c95 : 69 f0 __ ADC #$f0
+0c97 : 85 4a __ STA T4 + 0
+0c99 : a5 4b __ LDA T4 + 1
+0c9b : 69 ff __ ADC #$ff
+0c9d : 85 4b __ STA T4 + 1
+0c9f : 18 __ __ CLC
+0ca0 : a5 4c __ LDA T5 + 0
+0ca2 : 69 f0 __ ADC #$f0
+0ca4 : 85 4c __ STA T5 + 0
+0ca6 : a5 4d __ LDA T5 + 1
+0ca8 : 69 ff __ ADC #$ff
+0caa : 85 4d __ STA T5 + 1
+0cac : 18 __ __ CLC
+0cad : a5 48 __ LDA T3 + 0
+0caf : 69 ff __ ADC #$ff
+0cb1 : 85 48 __ STA T3 + 0
+0cb3 : a5 49 __ LDA T3 + 1
+0cb5 : 69 ff __ ADC #$ff
+0cb7 : 85 49 __ STA T3 + 1
+0cb9 : 10 03 __ BPL $0cbe
+0cbb : 4c c3 0b JMP $0bc3 ; (sort + 60)
+0cbe : 05 48 __ ORA T3 + 0
+0cc0 : d0 a6 __ BNE $0c68
+0cc2 : 4c c3 0b JMP $0bc3 ; (sort + 60)
+--------------------------------------------------------------------
+strcmp:
+0cc5 : a0 00 __ LDY #$00
+0cc7 : 84 1c __ STY ACCU + 1
+0cc9 : b1 0d __ LDA (P0),y
+0ccb : f0 16 __ BEQ $0ce3
+0ccd : d1 0f __ CMP (P2),y
+0ccf : d0 16 __ BNE $0ce7
+0cd1 : c8 __ __ INY
+0cd2 : b1 0d __ LDA (P0),y
+0cd4 : f0 0d __ BEQ $0ce3
+0cd6 : d1 0f __ CMP (P2),y
+0cd8 : d0 0d __ BNE $0ce7
+0cda : c8 __ __ INY
+0cdb : d0 ec __ BNE $0cc9
+0cdd : e6 0e __ INC P1
+0cdf : e6 10 __ INC P3
+0ce1 : d0 e6 __ BNE $0cc9
+0ce3 : d1 0f __ CMP (P2),y
+0ce5 : f0 0a __ BEQ $0cf1
+0ce7 : b0 06 __ BCS $0cef
+0ce9 : a9 ff __ LDA #$ff
+0ceb : 85 1c __ STA ACCU + 1
+0ced : 30 02 __ BMI $0cf1
+0cef : a9 01 __ LDA #$01
+0cf1 : 85 1b __ STA ACCU + 0
+0cf3 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0cf4 : a9 4c __ LDA #$4c
+0cf6 : 85 54 __ STA $54
+0cf8 : a9 00 __ LDA #$00
+0cfa : 85 13 __ STA P6
+0cfc : a9 19 __ LDA #$19
+0cfe : 85 16 __ STA P9
+0d00 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0d01 : 38 __ __ SEC
+0d02 : a9 00 __ LDA #$00
+0d04 : e5 1b __ SBC ACCU + 0
+0d06 : 85 1b __ STA ACCU + 0
+0d08 : a9 00 __ LDA #$00
+0d0a : e5 1c __ SBC ACCU + 1
+0d0c : 85 1c __ STA ACCU + 1
+0d0e : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0d0f : 38 __ __ SEC
+0d10 : a9 00 __ LDA #$00
+0d12 : e5 03 __ SBC $03
+0d14 : 85 03 __ STA $03
+0d16 : a9 00 __ LDA #$00
+0d18 : e5 04 __ SBC $04
+0d1a : 85 04 __ STA $04
+0d1c : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0d1d : a5 1c __ LDA ACCU + 1
+0d1f : d0 31 __ BNE $0d52
+0d21 : a5 04 __ LDA $04
+0d23 : d0 1e __ BNE $0d43
+0d25 : 85 06 __ STA $06
+0d27 : a2 04 __ LDX #$04
+0d29 : 06 1b __ ASL ACCU + 0
+0d2b : 2a __ __ ROL
+0d2c : c5 03 __ CMP $03
+0d2e : 90 02 __ BCC $0d32
+0d30 : e5 03 __ SBC $03
+0d32 : 26 1b __ ROL ACCU + 0
+0d34 : 2a __ __ ROL
+0d35 : c5 03 __ CMP $03
+0d37 : 90 02 __ BCC $0d3b
+0d39 : e5 03 __ SBC $03
+0d3b : 26 1b __ ROL ACCU + 0
+0d3d : ca __ __ DEX
+0d3e : d0 eb __ BNE $0d2b
+0d40 : 85 05 __ STA $05
+0d42 : 60 __ __ RTS
+0d43 : a5 1b __ LDA ACCU + 0
+0d45 : 85 05 __ STA $05
+0d47 : a5 1c __ LDA ACCU + 1
+0d49 : 85 06 __ STA $06
+0d4b : a9 00 __ LDA #$00
+0d4d : 85 1b __ STA ACCU + 0
+0d4f : 85 1c __ STA ACCU + 1
+0d51 : 60 __ __ RTS
+0d52 : a5 04 __ LDA $04
+0d54 : d0 1f __ BNE $0d75
+0d56 : a5 03 __ LDA $03
+0d58 : 30 1b __ BMI $0d75
+0d5a : a9 00 __ LDA #$00
+0d5c : 85 06 __ STA $06
+0d5e : a2 10 __ LDX #$10
+0d60 : 06 1b __ ASL ACCU + 0
+0d62 : 26 1c __ ROL ACCU + 1
+0d64 : 2a __ __ ROL
+0d65 : c5 03 __ CMP $03
+0d67 : 90 02 __ BCC $0d6b
+0d69 : e5 03 __ SBC $03
+0d6b : 26 1b __ ROL ACCU + 0
+0d6d : 26 1c __ ROL ACCU + 1
+0d6f : ca __ __ DEX
+0d70 : d0 f2 __ BNE $0d64
+0d72 : 85 05 __ STA $05
+0d74 : 60 __ __ RTS
+0d75 : a9 00 __ LDA #$00
+0d77 : 85 05 __ STA $05
+0d79 : 85 06 __ STA $06
+0d7b : 84 02 __ STY $02
+0d7d : a0 10 __ LDY #$10
+0d7f : 18 __ __ CLC
+0d80 : 26 1b __ ROL ACCU + 0
+0d82 : 26 1c __ ROL ACCU + 1
+0d84 : 26 05 __ ROL $05
+0d86 : 26 06 __ ROL $06
+0d88 : 38 __ __ SEC
+0d89 : a5 05 __ LDA $05
+0d8b : e5 03 __ SBC $03
+0d8d : aa __ __ TAX
+0d8e : a5 06 __ LDA $06
+0d90 : e5 04 __ SBC $04
+0d92 : 90 04 __ BCC $0d98
+0d94 : 86 05 __ STX $05
+0d96 : 85 06 __ STA $06
+0d98 : 88 __ __ DEY
+0d99 : d0 e5 __ BNE $0d80
+0d9b : 26 1b __ ROL ACCU + 0
+0d9d : 26 1c __ ROL ACCU + 1
+0d9f : a4 02 __ LDY $02
+0da1 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+0da2 : 24 1c __ BIT ACCU + 1
+0da4 : 10 0d __ BPL $0db3
+0da6 : 20 01 0d JSR $0d01 ; (negaccu + 0)
+0da9 : 24 04 __ BIT $04
+0dab : 10 0d __ BPL $0dba
+0dad : 20 0f 0d JSR $0d0f ; (negtmp + 0)
+0db0 : 4c 1d 0d JMP $0d1d ; (divmod + 0)
+0db3 : 24 04 __ BIT $04
+0db5 : 10 f9 __ BPL $0db0
+0db7 : 20 0f 0d JSR $0d0f ; (negtmp + 0)
+0dba : 20 1d 0d JSR $0d1d ; (divmod + 0)
+0dbd : 38 __ __ SEC
+0dbe : a9 00 __ LDA #$00
+0dc0 : e5 05 __ SBC $05
+0dc2 : 85 05 __ STA $05
+0dc4 : a9 00 __ LDA #$00
+0dc6 : e5 06 __ SBC $06
+0dc8 : 85 06 __ STA $06
+0dca : 60 __ __ RTS
@@ -0,0 +1,574 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 31 0d STX $0d31 ; (spentry + 0)
+0811 : a9 54 __ LDA #$54
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0d __ LDA #$0d
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0f __ LDA #$0f
+081c : e9 0d __ SBC #$0d
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 64 __ LDA #$64
+0832 : e9 54 __ SBC #$54
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 5a 0c JMP $0c5a ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : a9 00 __ LDA #$00
+0902 : 85 4a __ STA T0 + 0
+0904 : 85 4b __ STA T0 + 1
+0906 : 85 4c __ STA T1 + 0
+0908 : a9 00 __ LDA #$00
+090a : 8d 54 0d STA $0d54 ; (buffer + 0)
+090d : 85 4d __ STA T2 + 0
+090f : a9 54 __ LDA #$54
+0911 : 85 0d __ STA P0
+0913 : a9 0d __ LDA #$0d
+0915 : 85 0e __ STA P1
+0917 : a5 4d __ LDA T2 + 0
+0919 : 0a __ __ ASL
+091a : a8 __ __ TAY
+091b : b9 32 0d LDA $0d32,y ; (text + 0)
+091e : 85 0f __ STA P2
+0920 : b9 33 0d LDA $0d33,y ; (text + 1)
+0923 : 85 10 __ STA P3
+0925 : 20 8c 0b JSR $0b8c ; (strcat + 0)
+0928 : a9 54 __ LDA #$54
+092a : 85 0d __ STA P0
+092c : a9 0d __ LDA #$0d
+092e : 85 0e __ STA P1
+0930 : a9 29 __ LDA #$29
+0932 : 85 0f __ STA P2
+0934 : a9 0c __ LDA #$0c
+0936 : 85 10 __ STA P3
+0938 : 20 8c 0b JSR $0b8c ; (strcat + 0)
+093b : e6 4d __ INC T2 + 0
+093d : a5 4d __ LDA T2 + 0
+093f : c9 11 __ CMP #$11
+0941 : 90 cc __ BCC $090f
+0943 : a9 00 __ LDA #$00
+0945 : 85 4e __ STA T3 + 0
+0947 : 85 4f __ STA T3 + 1
+0949 : ad 54 0d LDA $0d54 ; (buffer + 0)
+094c : f0 03 __ BEQ $0951
+094e : 4c 70 0b JMP $0b70 ; (main + 624)
+0951 : 18 __ __ CLC
+0952 : a5 4a __ LDA T0 + 0
+0954 : 65 4e __ ADC T3 + 0
+0956 : 85 4a __ STA T0 + 0
+0958 : a5 4b __ LDA T0 + 1
+095a : 65 4f __ ADC T3 + 1
+095c : 85 4b __ STA T0 + 1
+095e : a9 00 __ LDA #$00
+0960 : 85 4e __ STA T3 + 0
+0962 : 85 4f __ STA T3 + 1
+0964 : ad 54 0d LDA $0d54 ; (buffer + 0)
+0967 : f0 03 __ BEQ $096c
+0969 : 4c 43 0b JMP $0b43 ; (main + 579)
+096c : 18 __ __ CLC
+096d : a5 4a __ LDA T0 + 0
+096f : 65 4e __ ADC T3 + 0
+0971 : 85 4a __ STA T0 + 0
+0973 : a5 4b __ LDA T0 + 1
+0975 : 65 4f __ ADC T3 + 1
+0977 : 85 4b __ STA T0 + 1
+0979 : a9 00 __ LDA #$00
+097b : 85 4d __ STA T2 + 0
+097d : a9 54 __ LDA #$54
+097f : 85 4e __ STA T3 + 0
+0981 : a9 0e __ LDA #$0e
+0983 : 85 4f __ STA T3 + 1
+0985 : a5 4d __ LDA T2 + 0
+0987 : 0a __ __ ASL
+0988 : 0a __ __ ASL
+0989 : 18 __ __ CLC
+098a : 65 4d __ ADC T2 + 0
+098c : 18 __ __ CLC
+098d : 65 4c __ ADC T1 + 0
+098f : 85 1b __ STA ACCU + 0
+0991 : a9 00 __ LDA #$00
+0993 : 85 1c __ STA ACCU + 1
+0995 : a9 11 __ LDA #$11
+0997 : 85 03 __ STA $03
+0999 : a9 00 __ LDA #$00
+099b : 85 04 __ STA $04
+099d : 20 08 0d JSR $0d08 ; (mods16 + 0)
+09a0 : a5 05 __ LDA $05
+09a2 : 0a __ __ ASL
+09a3 : a8 __ __ TAY
+09a4 : b9 32 0d LDA $0d32,y ; (text + 0)
+09a7 : 85 50 __ STA T4 + 0
+09a9 : b9 33 0d LDA $0d33,y ; (text + 1)
+09ac : 85 51 __ STA T4 + 1
+09ae : a0 ff __ LDY #$ff
+09b0 : c8 __ __ INY
+09b1 : b1 50 __ LDA (T4 + 0),y
+09b3 : 91 4e __ STA (T3 + 0),y
+09b5 : d0 f9 __ BNE $09b0
+09b7 : 18 __ __ CLC
+09b8 : a5 4e __ LDA T3 + 0
+09ba : 69 10 __ ADC #$10
+09bc : 85 4e __ STA T3 + 0
+09be : 90 02 __ BCC $09c2
+09c0 : e6 4f __ INC T3 + 1
+09c2 : e6 4d __ INC T2 + 0
+09c4 : a5 4d __ LDA T2 + 0
+09c6 : c9 10 __ CMP #$10
+09c8 : 90 bb __ BCC $0985
+09ca : a9 01 __ LDA #$01
+09cc : 85 4d __ STA T2 + 0
+09ce : a9 64 __ LDA #$64
+09d0 : 85 4e __ STA T3 + 0
+09d2 : a9 0e __ LDA #$0e
+09d4 : 85 4f __ STA T3 + 1
+09d6 : a0 ff __ LDY #$ff
+09d8 : c8 __ __ INY
+09d9 : b1 4e __ LDA (T3 + 0),y
+09db : 99 54 0f STA $0f54,y ; (sframe + 0)
+09de : d0 f8 __ BNE $09d8
+09e0 : a5 4d __ LDA T2 + 0
+09e2 : 85 50 __ STA T4 + 0
+09e4 : a9 00 __ LDA #$00
+09e6 : 85 51 __ STA T4 + 1
+09e8 : a5 4d __ LDA T2 + 0
+09ea : f0 03 __ BEQ $09ef
+09ec : 4c aa 0a JMP $0aaa ; (main + 426)
+09ef : a5 50 __ LDA T4 + 0
+09f1 : 85 1b __ STA ACCU + 0
+09f3 : a5 51 __ LDA T4 + 1
+09f5 : 06 1b __ ASL ACCU + 0
+09f7 : 2a __ __ ROL
+09f8 : 06 1b __ ASL ACCU + 0
+09fa : 2a __ __ ROL
+09fb : 06 1b __ ASL ACCU + 0
+09fd : 2a __ __ ROL
+09fe : 06 1b __ ASL ACCU + 0
+0a00 : 2a __ __ ROL
+0a01 : 85 1c __ STA ACCU + 1
+0a03 : 18 __ __ CLC
+0a04 : a9 54 __ LDA #$54
+0a06 : 65 1b __ ADC ACCU + 0
+0a08 : 85 50 __ STA T4 + 0
+0a0a : a9 0e __ LDA #$0e
+0a0c : 65 1c __ ADC ACCU + 1
+0a0e : 85 51 __ STA T4 + 1
+0a10 : a0 ff __ LDY #$ff
+0a12 : c8 __ __ INY
+0a13 : b9 54 0f LDA $0f54,y ; (sframe + 0)
+0a16 : 91 50 __ STA (T4 + 0),y
+0a18 : d0 f8 __ BNE $0a12
+0a1a : 18 __ __ CLC
+0a1b : a5 4e __ LDA T3 + 0
+0a1d : 69 10 __ ADC #$10
+0a1f : 85 4e __ STA T3 + 0
+0a21 : 90 02 __ BCC $0a25
+0a23 : e6 4f __ INC T3 + 1
+0a25 : e6 4d __ INC T2 + 0
+0a27 : a5 4d __ LDA T2 + 0
+0a29 : c9 10 __ CMP #$10
+0a2b : 90 a9 __ BCC $09d6
+0a2d : a9 64 __ LDA #$64
+0a2f : 85 50 __ STA T4 + 0
+0a31 : a9 0e __ LDA #$0e
+0a33 : 85 51 __ STA T4 + 1
+0a35 : a9 54 __ LDA #$54
+0a37 : 85 53 __ STA T5 + 0
+0a39 : a9 0e __ LDA #$0e
+0a3b : 85 54 __ STA T5 + 1
+0a3d : a5 53 __ LDA T5 + 0
+0a3f : 85 0d __ STA P0
+0a41 : a5 54 __ LDA T5 + 1
+0a43 : 85 0e __ STA P1
+0a45 : a5 50 __ LDA T4 + 0
+0a47 : 85 0f __ STA P2
+0a49 : a5 51 __ LDA T4 + 1
+0a4b : 85 10 __ STA P3
+0a4d : 20 2b 0c JSR $0c2b ; (strcmp + 0)
+0a50 : a5 1c __ LDA ACCU + 1
+0a52 : 30 04 __ BMI $0a58
+0a54 : 05 1b __ ORA ACCU + 0
+0a56 : d0 49 __ BNE $0aa1
+0a58 : 18 __ __ CLC
+0a59 : a5 53 __ LDA T5 + 0
+0a5b : 69 10 __ ADC #$10
+0a5d : 85 53 __ STA T5 + 0
+0a5f : 90 02 __ BCC $0a63
+0a61 : e6 54 __ INC T5 + 1
+0a63 : 18 __ __ CLC
+0a64 : a5 50 __ LDA T4 + 0
+0a66 : 69 10 __ ADC #$10
+0a68 : 85 50 __ STA T4 + 0
+0a6a : 90 02 __ BCC $0a6e
+0a6c : e6 51 __ INC T4 + 1
+0a6e : a5 54 __ LDA T5 + 1
+0a70 : c9 0f __ CMP #$0f
+0a72 : d0 04 __ BNE $0a78
+0a74 : a5 53 __ LDA T5 + 0
+0a76 : c9 44 __ CMP #$44
+0a78 : 90 c3 __ BCC $0a3d
+0a7a : e6 4c __ INC T1 + 0
+0a7c : a5 4c __ LDA T1 + 0
+0a7e : c9 14 __ CMP #$14
+0a80 : b0 03 __ BCS $0a85
+0a82 : 4c 08 09 JMP $0908 ; (main + 8)
+0a85 : a5 4b __ LDA T0 + 1
+0a87 : c9 07 __ CMP #$07
+0a89 : d0 06 __ BNE $0a91
+0a8b : a5 4a __ LDA T0 + 0
+0a8d : c9 1c __ CMP #$1c
+0a8f : f0 09 __ BEQ $0a9a
+0a91 : a9 02 __ LDA #$02
+0a93 : 85 1b __ STA ACCU + 0
+0a95 : a9 00 __ LDA #$00
+0a97 : 85 1c __ STA ACCU + 1
+0a99 : 60 __ __ RTS
+0a9a : a9 00 __ LDA #$00
+0a9c : 85 1b __ STA ACCU + 0
+0a9e : 4c 97 0a JMP $0a97 ; (main + 407)
+0aa1 : a9 01 __ LDA #$01
+0aa3 : 85 1b __ STA ACCU + 0
+0aa5 : a9 00 __ LDA #$00
+0aa7 : 4c 97 0a JMP $0a97 ; (main + 407)
+0aaa : 38 __ __ SEC
+0aab : e9 01 __ SBC #$01
+0aad : 0a __ __ ASL
+0aae : 85 1b __ STA ACCU + 0
+0ab0 : a9 00 __ LDA #$00
+0ab2 : 2a __ __ ROL
+0ab3 : 06 1b __ ASL ACCU + 0
+0ab5 : 2a __ __ ROL
+0ab6 : 06 1b __ ASL ACCU + 0
+0ab8 : 2a __ __ ROL
+0ab9 : 06 1b __ ASL ACCU + 0
+0abb : 2a __ __ ROL
+0abc : 85 1c __ STA ACCU + 1
+0abe : 18 __ __ CLC
+0abf : a9 54 __ LDA #$54
+0ac1 : 65 1b __ ADC ACCU + 0
+0ac3 : 85 53 __ STA T5 + 0
+0ac5 : a9 0e __ LDA #$0e
+0ac7 : 65 1c __ ADC ACCU + 1
+0ac9 : 85 54 __ STA T5 + 1
+0acb : a5 4d __ LDA T2 + 0
+0acd : 0a __ __ ASL
+0ace : 85 1b __ STA ACCU + 0
+0ad0 : a9 00 __ LDA #$00
+0ad2 : 2a __ __ ROL
+0ad3 : 06 1b __ ASL ACCU + 0
+0ad5 : 2a __ __ ROL
+0ad6 : 06 1b __ ASL ACCU + 0
+0ad8 : 2a __ __ ROL
+0ad9 : 06 1b __ ASL ACCU + 0
+0adb : 2a __ __ ROL
+0adc : 85 1c __ STA ACCU + 1
+0ade : 18 __ __ CLC
+0adf : a9 54 __ LDA #$54
+0ae1 : 65 1b __ ADC ACCU + 0
+0ae3 : 85 55 __ STA T7 + 0
+0ae5 : a9 0e __ LDA #$0e
+0ae7 : 65 1c __ ADC ACCU + 1
+0ae9 : 85 56 __ STA T7 + 1
+0aeb : a5 53 __ LDA T5 + 0
+0aed : 85 0d __ STA P0
+0aef : a5 54 __ LDA T5 + 1
+0af1 : 85 0e __ STA P1
+0af3 : a9 54 __ LDA #$54
+0af5 : 85 0f __ STA P2
+0af7 : a9 0f __ LDA #$0f
+0af9 : 85 10 __ STA P3
+0afb : 20 2b 0c JSR $0c2b ; (strcmp + 0)
+0afe : a5 1c __ LDA ACCU + 1
+0b00 : 10 03 __ BPL $0b05
+0b02 : 4c ef 09 JMP $09ef ; (main + 239)
+0b05 : 05 1b __ ORA ACCU + 0
+0b07 : d0 03 __ BNE $0b0c
+0b09 : 4c ef 09 JMP $09ef ; (main + 239)
+0b0c : a0 ff __ LDY #$ff
+0b0e : c8 __ __ INY
+0b0f : b1 53 __ LDA (T5 + 0),y
+0b11 : 91 55 __ STA (T7 + 0),y
+0b13 : d0 f9 __ BNE $0b0e
+0b15 : 18 __ __ CLC
+0b16 : a5 53 __ LDA T5 + 0
+0b18 : 69 f0 __ ADC #$f0
+0b1a : 85 53 __ STA T5 + 0
+0b1c : a5 54 __ LDA T5 + 1
+0b1e : 69 ff __ ADC #$ff
+0b20 : 85 54 __ STA T5 + 1
+0b22 : 18 __ __ CLC
+0b23 : a5 55 __ LDA T7 + 0
+0b25 : 69 f0 __ ADC #$f0
+0b27 : 85 55 __ STA T7 + 0
+0b29 : a5 56 __ LDA T7 + 1
+0b2b : 69 ff __ ADC #$ff
+0b2d : 85 56 __ STA T7 + 1
+0b2f : 18 __ __ CLC
+0b30 : a5 50 __ LDA T4 + 0
+0b32 : 69 ff __ ADC #$ff
+0b34 : 85 50 __ STA T4 + 0
+0b36 : a5 51 __ LDA T4 + 1
+0b38 : 69 ff __ ADC #$ff
+0b3a : 85 51 __ STA T4 + 1
+0b3c : a5 50 __ LDA T4 + 0
+0b3e : d0 ab __ BNE $0aeb
+0b40 : 4c ef 09 JMP $09ef ; (main + 239)
+0b43 : a9 54 __ LDA #$54
+0b45 : 85 50 __ STA T4 + 0
+0b47 : a9 0d __ LDA #$0d
+0b49 : 85 51 __ STA T4 + 1
+0b4b : a5 50 __ LDA T4 + 0
+0b4d : 85 53 __ STA T5 + 0
+0b4f : a5 51 __ LDA T4 + 1
+0b51 : 85 54 __ STA T5 + 1
+0b53 : a0 00 __ LDY #$00
+0b55 : b1 50 __ LDA (T4 + 0),y
+0b57 : c9 6f __ CMP #$6f
+0b59 : d0 06 __ BNE $0b61
+0b5b : e6 4e __ INC T3 + 0
+0b5d : d0 02 __ BNE $0b61
+0b5f : e6 4f __ INC T3 + 1
+0b61 : e6 50 __ INC T4 + 0
+0b63 : d0 02 __ BNE $0b67
+0b65 : e6 51 __ INC T4 + 1
+0b67 : a0 01 __ LDY #$01
+0b69 : b1 53 __ LDA (T5 + 0),y
+0b6b : d0 de __ BNE $0b4b
+0b6d : 4c 6c 09 JMP $096c ; (main + 108)
+0b70 : 18 __ __ CLC
+0b71 : a9 54 __ LDA #$54
+0b73 : 65 4e __ ADC T3 + 0
+0b75 : 85 53 __ STA T5 + 0
+0b77 : a9 0d __ LDA #$0d
+0b79 : 65 4f __ ADC T3 + 1
+0b7b : 85 54 __ STA T5 + 1
+0b7d : e6 4e __ INC T3 + 0
+0b7f : d0 02 __ BNE $0b83
+0b81 : e6 4f __ INC T3 + 1
+0b83 : a0 01 __ LDY #$01
+0b85 : b1 53 __ LDA (T5 + 0),y
+0b87 : d0 e7 __ BNE $0b70
+0b89 : 4c 51 09 JMP $0951 ; (main + 81)
+--------------------------------------------------------------------
+strcat:
+0b8c : a5 0f __ LDA P2
+0b8e : 85 43 __ STA T0 + 0
+0b90 : a5 10 __ LDA P3
+0b92 : 85 44 __ STA T0 + 1
+0b94 : a5 0d __ LDA P0
+0b96 : 85 45 __ STA T1 + 0
+0b98 : a5 0e __ LDA P1
+0b9a : 85 46 __ STA T1 + 1
+0b9c : a0 00 __ LDY #$00
+0b9e : b1 0d __ LDA (P0),y
+0ba0 : f0 14 __ BEQ $0bb6
+0ba2 : a5 45 __ LDA T1 + 0
+0ba4 : 85 48 __ STA T3 + 0
+0ba6 : a5 46 __ LDA T1 + 1
+0ba8 : 85 49 __ STA T3 + 1
+0baa : e6 45 __ INC T1 + 0
+0bac : d0 02 __ BNE $0bb0
+0bae : e6 46 __ INC T1 + 1
+0bb0 : a0 01 __ LDY #$01
+0bb2 : b1 48 __ LDA (T3 + 0),y
+0bb4 : d0 ec __ BNE $0ba2
+0bb6 : a0 00 __ LDY #$00
+0bb8 : b1 43 __ LDA (T0 + 0),y
+0bba : aa __ __ TAX
+0bbb : 91 45 __ STA (T1 + 0),y
+0bbd : e6 45 __ INC T1 + 0
+0bbf : d0 02 __ BNE $0bc3
+0bc1 : e6 46 __ INC T1 + 1
+0bc3 : e6 43 __ INC T0 + 0
+0bc5 : d0 02 __ BNE $0bc9
+0bc7 : e6 44 __ INC T0 + 1
+0bc9 : 8a __ __ TXA
+0bca : d0 ea __ BNE $0bb6
+0bcc : a5 0d __ LDA P0
+0bce : 85 1b __ STA ACCU + 0
+0bd0 : a5 0e __ LDA P1
+0bd2 : 85 1c __ STA ACCU + 1
+0bd4 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0c2b : a0 00 __ LDY #$00
+0c2d : 84 1c __ STY ACCU + 1
+0c2f : b1 0d __ LDA (P0),y
+0c31 : f0 16 __ BEQ $0c49
+0c33 : d1 0f __ CMP (P2),y
+0c35 : d0 16 __ BNE $0c4d
+0c37 : c8 __ __ INY
+0c38 : b1 0d __ LDA (P0),y
+0c3a : f0 0d __ BEQ $0c49
+0c3c : d1 0f __ CMP (P2),y
+0c3e : d0 0d __ BNE $0c4d
+0c40 : c8 __ __ INY
+0c41 : d0 ec __ BNE $0c2f
+0c43 : e6 0e __ INC P1
+0c45 : e6 10 __ INC P3
+0c47 : d0 e6 __ BNE $0c2f
+0c49 : d1 0f __ CMP (P2),y
+0c4b : f0 0a __ BEQ $0c57
+0c4d : b0 06 __ BCS $0c55
+0c4f : a9 ff __ LDA #$ff
+0c51 : 85 1c __ STA ACCU + 1
+0c53 : 30 02 __ BMI $0c57
+0c55 : a9 01 __ LDA #$01
+0c57 : 85 1b __ STA ACCU + 0
+0c59 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0c5a : a9 4c __ LDA #$4c
+0c5c : 85 54 __ STA $54
+0c5e : a9 00 __ LDA #$00
+0c60 : 85 13 __ STA P6
+0c62 : a9 19 __ LDA #$19
+0c64 : 85 16 __ STA P9
+0c66 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0c67 : 38 __ __ SEC
+0c68 : a9 00 __ LDA #$00
+0c6a : e5 1b __ SBC ACCU + 0
+0c6c : 85 1b __ STA ACCU + 0
+0c6e : a9 00 __ LDA #$00
+0c70 : e5 1c __ SBC ACCU + 1
+0c72 : 85 1c __ STA ACCU + 1
+0c74 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0c75 : 38 __ __ SEC
+0c76 : a9 00 __ LDA #$00
+0c78 : e5 03 __ SBC $03
+0c7a : 85 03 __ STA $03
+0c7c : a9 00 __ LDA #$00
+0c7e : e5 04 __ SBC $04
+0c80 : 85 04 __ STA $04
+0c82 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0c83 : a5 1c __ LDA ACCU + 1
+0c85 : d0 31 __ BNE $0cb8
+0c87 : a5 04 __ LDA $04
+0c89 : d0 1e __ BNE $0ca9
+0c8b : 85 06 __ STA $06
+0c8d : a2 04 __ LDX #$04
+0c8f : 06 1b __ ASL ACCU + 0
+0c91 : 2a __ __ ROL
+0c92 : c5 03 __ CMP $03
+0c94 : 90 02 __ BCC $0c98
+0c96 : e5 03 __ SBC $03
+0c98 : 26 1b __ ROL ACCU + 0
+0c9a : 2a __ __ ROL
+0c9b : c5 03 __ CMP $03
+0c9d : 90 02 __ BCC $0ca1
+0c9f : e5 03 __ SBC $03
+0ca1 : 26 1b __ ROL ACCU + 0
+0ca3 : ca __ __ DEX
+0ca4 : d0 eb __ BNE $0c91
+0ca6 : 85 05 __ STA $05
+0ca8 : 60 __ __ RTS
+0ca9 : a5 1b __ LDA ACCU + 0
+0cab : 85 05 __ STA $05
+0cad : a5 1c __ LDA ACCU + 1
+0caf : 85 06 __ STA $06
+0cb1 : a9 00 __ LDA #$00
+0cb3 : 85 1b __ STA ACCU + 0
+0cb5 : 85 1c __ STA ACCU + 1
+0cb7 : 60 __ __ RTS
+0cb8 : a5 04 __ LDA $04
+0cba : d0 1f __ BNE $0cdb
+0cbc : a5 03 __ LDA $03
+0cbe : 30 1b __ BMI $0cdb
+0cc0 : a9 00 __ LDA #$00
+0cc2 : 85 06 __ STA $06
+0cc4 : a2 10 __ LDX #$10
+0cc6 : 06 1b __ ASL ACCU + 0
+0cc8 : 26 1c __ ROL ACCU + 1
+0cca : 2a __ __ ROL
+0ccb : c5 03 __ CMP $03
+0ccd : 90 02 __ BCC $0cd1
+0ccf : e5 03 __ SBC $03
+0cd1 : 26 1b __ ROL ACCU + 0
+0cd3 : 26 1c __ ROL ACCU + 1
+0cd5 : ca __ __ DEX
+0cd6 : d0 f2 __ BNE $0cca
+0cd8 : 85 05 __ STA $05
+0cda : 60 __ __ RTS
+0cdb : a9 00 __ LDA #$00
+0cdd : 85 05 __ STA $05
+0cdf : 85 06 __ STA $06
+0ce1 : 84 02 __ STY $02
+0ce3 : a0 10 __ LDY #$10
+0ce5 : 18 __ __ CLC
+0ce6 : 26 1b __ ROL ACCU + 0
+0ce8 : 26 1c __ ROL ACCU + 1
+0cea : 26 05 __ ROL $05
+0cec : 26 06 __ ROL $06
+0cee : 38 __ __ SEC
+0cef : a5 05 __ LDA $05
+0cf1 : e5 03 __ SBC $03
+0cf3 : aa __ __ TAX
+0cf4 : a5 06 __ LDA $06
+0cf6 : e5 04 __ SBC $04
+0cf8 : 90 04 __ BCC $0cfe
+0cfa : 86 05 __ STX $05
+0cfc : 85 06 __ STA $06
+0cfe : 88 __ __ DEY
+0cff : d0 e5 __ BNE $0ce6
+0d01 : 26 1b __ ROL ACCU + 0
+0d03 : 26 1c __ ROL ACCU + 1
+0d05 : a4 02 __ LDY $02
+0d07 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+0d08 : 24 1c __ BIT ACCU + 1
+0d0a : 10 0d __ BPL $0d19
+0d0c : 20 67 0c JSR $0c67 ; (negaccu + 0)
+0d0f : 24 04 __ BIT $04
+0d11 : 10 0d __ BPL $0d20
+0d13 : 20 75 0c JSR $0c75 ; (negtmp + 0)
+0d16 : 4c 83 0c JMP $0c83 ; (divmod + 0)
+0d19 : 24 04 __ BIT $04
+0d1b : 10 f9 __ BPL $0d16
+0d1d : 20 75 0c JSR $0c75 ; (negtmp + 0)
+0d20 : 20 83 0c JSR $0c83 ; (divmod + 0)
+0d23 : 38 __ __ SEC
+0d24 : a9 00 __ LDA #$00
+0d26 : e5 05 __ SBC $05
+0d28 : 85 05 __ STA $05
+0d2a : a9 00 __ LDA #$00
+0d2c : e5 06 __ SBC $06
+0d2e : 85 06 __ STA $06
+0d30 : 60 __ __ RTS
@@ -0,0 +1,581 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 43 0d STX $0d43 ; (spentry + 0)
+0811 : a9 66 __ LDA #$66
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0d __ LDA #$0d
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 0f __ LDA #$0f
+081c : e9 0d __ SBC #$0d
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 76 __ LDA #$76
+0832 : e9 66 __ SBC #$66
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 6c 0c JMP $0c6c ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : a9 00 __ LDA #$00
+0902 : 85 43 __ STA T0 + 0
+0904 : 85 44 __ STA T0 + 1
+0906 : 85 45 __ STA T1 + 0
+0908 : a9 00 __ LDA #$00
+090a : 8d 66 0d STA $0d66 ; (buffer + 0)
+090d : 85 46 __ STA T2 + 0
+090f : a5 46 __ LDA T2 + 0
+0911 : 0a __ __ ASL
+0912 : a8 __ __ TAY
+0913 : a9 66 __ LDA #$66
+0915 : 85 49 __ STA T4 + 0
+0917 : a9 0d __ LDA #$0d
+0919 : 85 4a __ STA T4 + 1
+091b : b9 44 0d LDA $0d44,y ; (text + 0)
+091e : 85 47 __ STA T3 + 0
+0920 : b9 45 0d LDA $0d45,y ; (text + 1)
+0923 : 85 48 __ STA T3 + 1
+0925 : ad 66 0d LDA $0d66 ; (buffer + 0)
+0928 : f0 14 __ BEQ $093e
+092a : a5 49 __ LDA T4 + 0
+092c : 85 4c __ STA T6 + 0
+092e : a5 4a __ LDA T4 + 1
+0930 : 85 4d __ STA T6 + 1
+0932 : e6 49 __ INC T4 + 0
+0934 : d0 02 __ BNE $0938
+0936 : e6 4a __ INC T4 + 1
+0938 : a0 01 __ LDY #$01
+093a : b1 4c __ LDA (T6 + 0),y
+093c : d0 ec __ BNE $092a
+093e : a0 00 __ LDY #$00
+0940 : b1 47 __ LDA (T3 + 0),y
+0942 : aa __ __ TAX
+0943 : 91 49 __ STA (T4 + 0),y
+0945 : e6 49 __ INC T4 + 0
+0947 : d0 02 __ BNE $094b
+0949 : e6 4a __ INC T4 + 1
+094b : e6 47 __ INC T3 + 0
+094d : d0 02 __ BNE $0951
+094f : e6 48 __ INC T3 + 1
+0951 : 8a __ __ TXA
+0952 : d0 ea __ BNE $093e
+0954 : a9 66 __ LDA #$66
+0956 : 85 47 __ STA T3 + 0
+0958 : a9 0d __ LDA #$0d
+095a : 85 48 __ STA T3 + 1
+095c : a9 3b __ LDA #$3b
+095e : 85 49 __ STA T4 + 0
+0960 : a9 0c __ LDA #$0c
+0962 : 85 4a __ STA T4 + 1
+0964 : ad 66 0d LDA $0d66 ; (buffer + 0)
+0967 : f0 14 __ BEQ $097d
+0969 : a5 47 __ LDA T3 + 0
+096b : 85 4c __ STA T6 + 0
+096d : a5 48 __ LDA T3 + 1
+096f : 85 4d __ STA T6 + 1
+0971 : e6 47 __ INC T3 + 0
+0973 : d0 02 __ BNE $0977
+0975 : e6 48 __ INC T3 + 1
+0977 : a0 01 __ LDY #$01
+0979 : b1 4c __ LDA (T6 + 0),y
+097b : d0 ec __ BNE $0969
+097d : a0 00 __ LDY #$00
+097f : b1 49 __ LDA (T4 + 0),y
+0981 : aa __ __ TAX
+0982 : 91 47 __ STA (T3 + 0),y
+0984 : e6 47 __ INC T3 + 0
+0986 : d0 02 __ BNE $098a
+0988 : e6 48 __ INC T3 + 1
+098a : e6 49 __ INC T4 + 0
+098c : d0 02 __ BNE $0990
+098e : e6 4a __ INC T4 + 1
+0990 : 8a __ __ TXA
+0991 : d0 ea __ BNE $097d
+0993 : e6 46 __ INC T2 + 0
+0995 : a5 46 __ LDA T2 + 0
+0997 : c9 11 __ CMP #$11
+0999 : b0 03 __ BCS $099e
+099b : 4c 0f 09 JMP $090f ; (main + 15)
+099e : a9 00 __ LDA #$00
+09a0 : 85 47 __ STA T3 + 0
+09a2 : 85 48 __ STA T3 + 1
+09a4 : ad 66 0d LDA $0d66 ; (buffer + 0)
+09a7 : f0 03 __ BEQ $09ac
+09a9 : 4c cb 0b JMP $0bcb ; (main + 715)
+09ac : 18 __ __ CLC
+09ad : a5 43 __ LDA T0 + 0
+09af : 65 47 __ ADC T3 + 0
+09b1 : 85 43 __ STA T0 + 0
+09b3 : a5 44 __ LDA T0 + 1
+09b5 : 65 48 __ ADC T3 + 1
+09b7 : 85 44 __ STA T0 + 1
+09b9 : a9 00 __ LDA #$00
+09bb : 85 47 __ STA T3 + 0
+09bd : 85 48 __ STA T3 + 1
+09bf : ad 66 0d LDA $0d66 ; (buffer + 0)
+09c2 : f0 03 __ BEQ $09c7
+09c4 : 4c 9e 0b JMP $0b9e ; (main + 670)
+09c7 : 18 __ __ CLC
+09c8 : a5 43 __ LDA T0 + 0
+09ca : 65 47 __ ADC T3 + 0
+09cc : 85 43 __ STA T0 + 0
+09ce : a5 44 __ LDA T0 + 1
+09d0 : 65 48 __ ADC T3 + 1
+09d2 : 85 44 __ STA T0 + 1
+09d4 : a9 00 __ LDA #$00
+09d6 : 85 46 __ STA T2 + 0
+09d8 : a9 66 __ LDA #$66
+09da : 85 47 __ STA T3 + 0
+09dc : a9 0e __ LDA #$0e
+09de : 85 48 __ STA T3 + 1
+09e0 : a5 46 __ LDA T2 + 0
+09e2 : 0a __ __ ASL
+09e3 : 0a __ __ ASL
+09e4 : 18 __ __ CLC
+09e5 : 65 46 __ ADC T2 + 0
+09e7 : 18 __ __ CLC
+09e8 : 65 45 __ ADC T1 + 0
+09ea : 85 1b __ STA ACCU + 0
+09ec : a9 00 __ LDA #$00
+09ee : 85 1c __ STA ACCU + 1
+09f0 : a9 11 __ LDA #$11
+09f2 : 85 03 __ STA $03
+09f4 : a9 00 __ LDA #$00
+09f6 : 85 04 __ STA $04
+09f8 : 20 1a 0d JSR $0d1a ; (mods16 + 0)
+09fb : a5 05 __ LDA $05
+09fd : 0a __ __ ASL
+09fe : a8 __ __ TAY
+09ff : b9 44 0d LDA $0d44,y ; (text + 0)
+0a02 : 85 49 __ STA T4 + 0
+0a04 : b9 45 0d LDA $0d45,y ; (text + 1)
+0a07 : 85 4a __ STA T4 + 1
+0a09 : a0 ff __ LDY #$ff
+0a0b : c8 __ __ INY
+0a0c : b1 49 __ LDA (T4 + 0),y
+0a0e : 91 47 __ STA (T3 + 0),y
+0a10 : d0 f9 __ BNE $0a0b
+0a12 : 18 __ __ CLC
+0a13 : a5 47 __ LDA T3 + 0
+0a15 : 69 10 __ ADC #$10
+0a17 : 85 47 __ STA T3 + 0
+0a19 : 90 02 __ BCC $0a1d
+0a1b : e6 48 __ INC T3 + 1
+0a1d : e6 46 __ INC T2 + 0
+0a1f : a5 46 __ LDA T2 + 0
+0a21 : c9 10 __ CMP #$10
+0a23 : 90 bb __ BCC $09e0
+0a25 : a9 01 __ LDA #$01
+0a27 : 85 46 __ STA T2 + 0
+0a29 : a9 76 __ LDA #$76
+0a2b : 85 47 __ STA T3 + 0
+0a2d : a9 0e __ LDA #$0e
+0a2f : 85 48 __ STA T3 + 1
+0a31 : a0 ff __ LDY #$ff
+0a33 : c8 __ __ INY
+0a34 : b1 47 __ LDA (T3 + 0),y
+0a36 : 99 66 0f STA $0f66,y ; (sframe + 0)
+0a39 : d0 f8 __ BNE $0a33
+0a3b : a5 46 __ LDA T2 + 0
+0a3d : 85 49 __ STA T4 + 0
+0a3f : a9 00 __ LDA #$00
+0a41 : 85 4a __ STA T4 + 1
+0a43 : a5 46 __ LDA T2 + 0
+0a45 : f0 03 __ BEQ $0a4a
+0a47 : 4c 05 0b JMP $0b05 ; (main + 517)
+0a4a : a5 49 __ LDA T4 + 0
+0a4c : 85 1b __ STA ACCU + 0
+0a4e : a5 4a __ LDA T4 + 1
+0a50 : 06 1b __ ASL ACCU + 0
+0a52 : 2a __ __ ROL
+0a53 : 06 1b __ ASL ACCU + 0
+0a55 : 2a __ __ ROL
+0a56 : 06 1b __ ASL ACCU + 0
+0a58 : 2a __ __ ROL
+0a59 : 06 1b __ ASL ACCU + 0
+0a5b : 2a __ __ ROL
+0a5c : 85 1c __ STA ACCU + 1
+0a5e : 18 __ __ CLC
+0a5f : a9 66 __ LDA #$66
+0a61 : 65 1b __ ADC ACCU + 0
+0a63 : 85 49 __ STA T4 + 0
+0a65 : a9 0e __ LDA #$0e
+0a67 : 65 1c __ ADC ACCU + 1
+0a69 : 85 4a __ STA T4 + 1
+0a6b : a0 ff __ LDY #$ff
+0a6d : c8 __ __ INY
+0a6e : b9 66 0f LDA $0f66,y ; (sframe + 0)
+0a71 : 91 49 __ STA (T4 + 0),y
+0a73 : d0 f8 __ BNE $0a6d
+0a75 : 18 __ __ CLC
+0a76 : a5 47 __ LDA T3 + 0
+0a78 : 69 10 __ ADC #$10
+0a7a : 85 47 __ STA T3 + 0
+0a7c : 90 02 __ BCC $0a80
+0a7e : e6 48 __ INC T3 + 1
+0a80 : e6 46 __ INC T2 + 0
+0a82 : a5 46 __ LDA T2 + 0
+0a84 : c9 10 __ CMP #$10
+0a86 : 90 a9 __ BCC $0a31
+0a88 : a9 76 __ LDA #$76
+0a8a : 85 49 __ STA T4 + 0
+0a8c : a9 0e __ LDA #$0e
+0a8e : 85 4a __ STA T4 + 1
+0a90 : a9 66 __ LDA #$66
+0a92 : 85 4c __ STA T6 + 0
+0a94 : a9 0e __ LDA #$0e
+0a96 : 85 4d __ STA T6 + 1
+0a98 : a5 4c __ LDA T6 + 0
+0a9a : 85 0d __ STA P0
+0a9c : a5 4d __ LDA T6 + 1
+0a9e : 85 0e __ STA P1
+0aa0 : a5 49 __ LDA T4 + 0
+0aa2 : 85 0f __ STA P2
+0aa4 : a5 4a __ LDA T4 + 1
+0aa6 : 85 10 __ STA P3
+0aa8 : 20 3d 0c JSR $0c3d ; (strcmp + 0)
+0aab : a5 1c __ LDA ACCU + 1
+0aad : 30 04 __ BMI $0ab3
+0aaf : 05 1b __ ORA ACCU + 0
+0ab1 : d0 49 __ BNE $0afc
+0ab3 : 18 __ __ CLC
+0ab4 : a5 4c __ LDA T6 + 0
+0ab6 : 69 10 __ ADC #$10
+0ab8 : 85 4c __ STA T6 + 0
+0aba : 90 02 __ BCC $0abe
+0abc : e6 4d __ INC T6 + 1
+0abe : 18 __ __ CLC
+0abf : a5 49 __ LDA T4 + 0
+0ac1 : 69 10 __ ADC #$10
+0ac3 : 85 49 __ STA T4 + 0
+0ac5 : 90 02 __ BCC $0ac9
+0ac7 : e6 4a __ INC T4 + 1
+0ac9 : a5 4d __ LDA T6 + 1
+0acb : c9 0f __ CMP #$0f
+0acd : d0 04 __ BNE $0ad3
+0acf : a5 4c __ LDA T6 + 0
+0ad1 : c9 56 __ CMP #$56
+0ad3 : 90 c3 __ BCC $0a98
+0ad5 : e6 45 __ INC T1 + 0
+0ad7 : a5 45 __ LDA T1 + 0
+0ad9 : c9 14 __ CMP #$14
+0adb : b0 03 __ BCS $0ae0
+0add : 4c 08 09 JMP $0908 ; (main + 8)
+0ae0 : a5 44 __ LDA T0 + 1
+0ae2 : c9 07 __ CMP #$07
+0ae4 : d0 06 __ BNE $0aec
+0ae6 : a5 43 __ LDA T0 + 0
+0ae8 : c9 1c __ CMP #$1c
+0aea : f0 09 __ BEQ $0af5
+0aec : a9 02 __ LDA #$02
+0aee : 85 1b __ STA ACCU + 0
+0af0 : a9 00 __ LDA #$00
+0af2 : 85 1c __ STA ACCU + 1
+0af4 : 60 __ __ RTS
+0af5 : a9 00 __ LDA #$00
+0af7 : 85 1b __ STA ACCU + 0
+0af9 : 4c f2 0a JMP $0af2 ; (main + 498)
+0afc : a9 01 __ LDA #$01
+0afe : 85 1b __ STA ACCU + 0
+0b00 : a9 00 __ LDA #$00
+0b02 : 4c f2 0a JMP $0af2 ; (main + 498)
+0b05 : 38 __ __ SEC
+0b06 : e9 01 __ SBC #$01
+0b08 : 0a __ __ ASL
+0b09 : 85 1b __ STA ACCU + 0
+0b0b : a9 00 __ LDA #$00
+0b0d : 2a __ __ ROL
+0b0e : 06 1b __ ASL ACCU + 0
+0b10 : 2a __ __ ROL
+0b11 : 06 1b __ ASL ACCU + 0
+0b13 : 2a __ __ ROL
+0b14 : 06 1b __ ASL ACCU + 0
+0b16 : 2a __ __ ROL
+0b17 : 85 1c __ STA ACCU + 1
+0b19 : 18 __ __ CLC
+0b1a : a9 66 __ LDA #$66
+0b1c : 65 1b __ ADC ACCU + 0
+0b1e : 85 4c __ STA T6 + 0
+0b20 : a9 0e __ LDA #$0e
+0b22 : 65 1c __ ADC ACCU + 1
+0b24 : 85 4d __ STA T6 + 1
+0b26 : a5 46 __ LDA T2 + 0
+0b28 : 0a __ __ ASL
+0b29 : 85 1b __ STA ACCU + 0
+0b2b : a9 00 __ LDA #$00
+0b2d : 2a __ __ ROL
+0b2e : 06 1b __ ASL ACCU + 0
+0b30 : 2a __ __ ROL
+0b31 : 06 1b __ ASL ACCU + 0
+0b33 : 2a __ __ ROL
+0b34 : 06 1b __ ASL ACCU + 0
+0b36 : 2a __ __ ROL
+0b37 : 85 1c __ STA ACCU + 1
+0b39 : 18 __ __ CLC
+0b3a : a9 66 __ LDA #$66
+0b3c : 65 1b __ ADC ACCU + 0
+0b3e : 85 4e __ STA T7 + 0
+0b40 : a9 0e __ LDA #$0e
+0b42 : 65 1c __ ADC ACCU + 1
+0b44 : 85 4f __ STA T7 + 1
+0b46 : a5 4c __ LDA T6 + 0
+0b48 : 85 0d __ STA P0
+0b4a : a5 4d __ LDA T6 + 1
+0b4c : 85 0e __ STA P1
+0b4e : a9 66 __ LDA #$66
+0b50 : 85 0f __ STA P2
+0b52 : a9 0f __ LDA #$0f
+0b54 : 85 10 __ STA P3
+0b56 : 20 3d 0c JSR $0c3d ; (strcmp + 0)
+0b59 : a5 1c __ LDA ACCU + 1
+0b5b : 10 03 __ BPL $0b60
+0b5d : 4c 4a 0a JMP $0a4a ; (main + 330)
+0b60 : 05 1b __ ORA ACCU + 0
+0b62 : d0 03 __ BNE $0b67
+0b64 : 4c 4a 0a JMP $0a4a ; (main + 330)
+0b67 : a0 ff __ LDY #$ff
+0b69 : c8 __ __ INY
+0b6a : b1 4c __ LDA (T6 + 0),y
+0b6c : 91 4e __ STA (T7 + 0),y
+0b6e : d0 f9 __ BNE $0b69
+0b70 : 18 __ __ CLC
+0b71 : a5 4c __ LDA T6 + 0
+0b73 : 69 f0 __ ADC #$f0
+0b75 : 85 4c __ STA T6 + 0
+0b77 : a5 4d __ LDA T6 + 1
+0b79 : 69 ff __ ADC #$ff
+0b7b : 85 4d __ STA T6 + 1
+0b7d : 18 __ __ CLC
+0b7e : a5 4e __ LDA T7 + 0
+0b80 : 69 f0 __ ADC #$f0
+0b82 : 85 4e __ STA T7 + 0
+0b84 : a5 4f __ LDA T7 + 1
+0b86 : 69 ff __ ADC #$ff
+0b88 : 85 4f __ STA T7 + 1
+0b8a : 18 __ __ CLC
+0b8b : a5 49 __ LDA T4 + 0
+0b8d : 69 ff __ ADC #$ff
+0b8f : 85 49 __ STA T4 + 0
+0b91 : a5 4a __ LDA T4 + 1
+0b93 : 69 ff __ ADC #$ff
+0b95 : 85 4a __ STA T4 + 1
+0b97 : a5 49 __ LDA T4 + 0
+0b99 : d0 ab __ BNE $0b46
+0b9b : 4c 4a 0a JMP $0a4a ; (main + 330)
+0b9e : a9 66 __ LDA #$66
+0ba0 : 85 49 __ STA T4 + 0
+0ba2 : a9 0d __ LDA #$0d
+0ba4 : 85 4a __ STA T4 + 1
+0ba6 : a5 49 __ LDA T4 + 0
+0ba8 : 85 4c __ STA T6 + 0
+0baa : a5 4a __ LDA T4 + 1
+0bac : 85 4d __ STA T6 + 1
+0bae : a0 00 __ LDY #$00
+0bb0 : b1 49 __ LDA (T4 + 0),y
+0bb2 : c9 6f __ CMP #$6f
+0bb4 : d0 06 __ BNE $0bbc
+0bb6 : e6 47 __ INC T3 + 0
+0bb8 : d0 02 __ BNE $0bbc
+0bba : e6 48 __ INC T3 + 1
+0bbc : e6 49 __ INC T4 + 0
+0bbe : d0 02 __ BNE $0bc2
+0bc0 : e6 4a __ INC T4 + 1
+0bc2 : a0 01 __ LDY #$01
+0bc4 : b1 4c __ LDA (T6 + 0),y
+0bc6 : d0 de __ BNE $0ba6
+0bc8 : 4c c7 09 JMP $09c7 ; (main + 199)
+0bcb : 18 __ __ CLC
+0bcc : a9 66 __ LDA #$66
+0bce : 65 47 __ ADC T3 + 0
+0bd0 : 85 4c __ STA T6 + 0
+0bd2 : a9 0d __ LDA #$0d
+0bd4 : 65 48 __ ADC T3 + 1
+0bd6 : 85 4d __ STA T6 + 1
+0bd8 : e6 47 __ INC T3 + 0
+0bda : d0 02 __ BNE $0bde
+0bdc : e6 48 __ INC T3 + 1
+0bde : a0 01 __ LDY #$01
+0be0 : b1 4c __ LDA (T6 + 0),y
+0be2 : d0 e7 __ BNE $0bcb
+0be4 : 4c ac 09 JMP $09ac ; (main + 172)
+--------------------------------------------------------------------
+strcmp:
+0c3d : a0 00 __ LDY #$00
+0c3f : 84 1c __ STY ACCU + 1
+0c41 : b1 0d __ LDA (P0),y
+0c43 : f0 16 __ BEQ $0c5b
+0c45 : d1 0f __ CMP (P2),y
+0c47 : d0 16 __ BNE $0c5f
+0c49 : c8 __ __ INY
+0c4a : b1 0d __ LDA (P0),y
+0c4c : f0 0d __ BEQ $0c5b
+0c4e : d1 0f __ CMP (P2),y
+0c50 : d0 0d __ BNE $0c5f
+0c52 : c8 __ __ INY
+0c53 : d0 ec __ BNE $0c41
+0c55 : e6 0e __ INC P1
+0c57 : e6 10 __ INC P3
+0c59 : d0 e6 __ BNE $0c41
+0c5b : d1 0f __ CMP (P2),y
+0c5d : f0 0a __ BEQ $0c69
+0c5f : b0 06 __ BCS $0c67
+0c61 : a9 ff __ LDA #$ff
+0c63 : 85 1c __ STA ACCU + 1
+0c65 : 30 02 __ BMI $0c69
+0c67 : a9 01 __ LDA #$01
+0c69 : 85 1b __ STA ACCU + 0
+0c6b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0c6c : a9 4c __ LDA #$4c
+0c6e : 85 54 __ STA $54
+0c70 : a9 00 __ LDA #$00
+0c72 : 85 13 __ STA P6
+0c74 : a9 19 __ LDA #$19
+0c76 : 85 16 __ STA P9
+0c78 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0c79 : 38 __ __ SEC
+0c7a : a9 00 __ LDA #$00
+0c7c : e5 1b __ SBC ACCU + 0
+0c7e : 85 1b __ STA ACCU + 0
+0c80 : a9 00 __ LDA #$00
+0c82 : e5 1c __ SBC ACCU + 1
+0c84 : 85 1c __ STA ACCU + 1
+0c86 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0c87 : 38 __ __ SEC
+0c88 : a9 00 __ LDA #$00
+0c8a : e5 03 __ SBC $03
+0c8c : 85 03 __ STA $03
+0c8e : a9 00 __ LDA #$00
+0c90 : e5 04 __ SBC $04
+0c92 : 85 04 __ STA $04
+0c94 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0c95 : a5 1c __ LDA ACCU + 1
+0c97 : d0 31 __ BNE $0cca
+0c99 : a5 04 __ LDA $04
+0c9b : d0 1e __ BNE $0cbb
+0c9d : 85 06 __ STA $06
+0c9f : a2 04 __ LDX #$04
+0ca1 : 06 1b __ ASL ACCU + 0
+0ca3 : 2a __ __ ROL
+0ca4 : c5 03 __ CMP $03
+0ca6 : 90 02 __ BCC $0caa
+0ca8 : e5 03 __ SBC $03
+0caa : 26 1b __ ROL ACCU + 0
+0cac : 2a __ __ ROL
+0cad : c5 03 __ CMP $03
+0caf : 90 02 __ BCC $0cb3
+0cb1 : e5 03 __ SBC $03
+0cb3 : 26 1b __ ROL ACCU + 0
+0cb5 : ca __ __ DEX
+0cb6 : d0 eb __ BNE $0ca3
+0cb8 : 85 05 __ STA $05
+0cba : 60 __ __ RTS
+0cbb : a5 1b __ LDA ACCU + 0
+0cbd : 85 05 __ STA $05
+0cbf : a5 1c __ LDA ACCU + 1
+0cc1 : 85 06 __ STA $06
+0cc3 : a9 00 __ LDA #$00
+0cc5 : 85 1b __ STA ACCU + 0
+0cc7 : 85 1c __ STA ACCU + 1
+0cc9 : 60 __ __ RTS
+0cca : a5 04 __ LDA $04
+0ccc : d0 1f __ BNE $0ced
+0cce : a5 03 __ LDA $03
+0cd0 : 30 1b __ BMI $0ced
+0cd2 : a9 00 __ LDA #$00
+0cd4 : 85 06 __ STA $06
+0cd6 : a2 10 __ LDX #$10
+0cd8 : 06 1b __ ASL ACCU + 0
+0cda : 26 1c __ ROL ACCU + 1
+0cdc : 2a __ __ ROL
+0cdd : c5 03 __ CMP $03
+0cdf : 90 02 __ BCC $0ce3
+0ce1 : e5 03 __ SBC $03
+0ce3 : 26 1b __ ROL ACCU + 0
+0ce5 : 26 1c __ ROL ACCU + 1
+0ce7 : ca __ __ DEX
+0ce8 : d0 f2 __ BNE $0cdc
+0cea : 85 05 __ STA $05
+0cec : 60 __ __ RTS
+0ced : a9 00 __ LDA #$00
+0cef : 85 05 __ STA $05
+0cf1 : 85 06 __ STA $06
+0cf3 : 84 02 __ STY $02
+0cf5 : a0 10 __ LDY #$10
+0cf7 : 18 __ __ CLC
+0cf8 : 26 1b __ ROL ACCU + 0
+0cfa : 26 1c __ ROL ACCU + 1
+0cfc : 26 05 __ ROL $05
+0cfe : 26 06 __ ROL $06
+0d00 : 38 __ __ SEC
+0d01 : a5 05 __ LDA $05
+0d03 : e5 03 __ SBC $03
+0d05 : aa __ __ TAX
+0d06 : a5 06 __ LDA $06
+0d08 : e5 04 __ SBC $04
+0d0a : 90 04 __ BCC $0d10
+0d0c : 86 05 __ STX $05
+0d0e : 85 06 __ STA $06
+0d10 : 88 __ __ DEY
+0d11 : d0 e5 __ BNE $0cf8
+0d13 : 26 1b __ ROL ACCU + 0
+0d15 : 26 1c __ ROL ACCU + 1
+0d17 : a4 02 __ LDY $02
+0d19 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+0d1a : 24 1c __ BIT ACCU + 1
+0d1c : 10 0d __ BPL $0d2b
+0d1e : 20 79 0c JSR $0c79 ; (negaccu + 0)
+0d21 : 24 04 __ BIT $04
+0d23 : 10 0d __ BPL $0d32
+0d25 : 20 87 0c JSR $0c87 ; (negtmp + 0)
+0d28 : 4c 95 0c JMP $0c95 ; (divmod + 0)
+0d2b : 24 04 __ BIT $04
+0d2d : 10 f9 __ BPL $0d28
+0d2f : 20 87 0c JSR $0c87 ; (negtmp + 0)
+0d32 : 20 95 0c JSR $0c95 ; (divmod + 0)
+0d35 : 38 __ __ SEC
+0d36 : a9 00 __ LDA #$00
+0d38 : e5 05 __ SBC $05
+0d3a : 85 05 __ STA $05
+0d3c : a9 00 __ LDA #$00
+0d3e : e5 06 __ SBC $06
+0d40 : 85 06 __ STA $06
+0d42 : 60 __ __ RTS
@@ -0,0 +1,1459 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 86 15 STX $1586 ; (spentry + 0)
+0811 : a9 87 __ LDA #$87
+0813 : 85 19 __ STA IP + 0
+0815 : a9 15 __ LDA #$15
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 29 __ LDA #$29
+081c : e9 15 __ SBC #$15
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c6 __ LDA #$c6
+0832 : e9 87 __ SBC #$87
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	7, 74
+0a04:	PUSH	#$0004
+0a07:	LEA	T0, Next_Glob_Rec + 0
+0a0b:	MOV	Next_Ptr_Glob + 0, T0
+0a0f:	LEA	T1, Glob_Rec + 0
+0a13:	MOV	Ptr_Glob + 0, T1
+0a17:	MOV	Glob_Rec + 0, T0
+0a1b:	MOV	ACCU, #0
+0a1e:	MOVB	Glob_Rec + 2, ACCU
+0a22:	MOV	ACCU, #2
+0a25:	MOVB	Glob_Rec + 3, ACCU
+0a29:	MOV	ACCU, #40
+0a2c:	MOV	Glob_Rec + 4, ACCU
+0a30:	LEA	ADDR, Glob_Rec + 6
+0a34:	LEA	ACCU, $0d99
+0a38:	STRCPY
+0a39:	LEA	ADDR, 3(FP)
+0a3d:	LEA	ACCU, $0db8
+0a41:	STRCPY
+0a42:	MOV	ACCU, #10
+0a45:	MOV	Arr_2_Glob + 814, ACCU
+0a49:	MOV	T0, #1
+0a4c:	MOV	ACCU, #65
+0a4f:	MOVB	Ch_1_Glob + 0, ACCU
+0a53:	MOV	ACCU, #1
+0a56:	MOVB	Bool_Glob + 0, ACCU
+0a5a:	MOV	ACCU, #66
+0a5d:	MOVB	Ch_2_Glob + 0, ACCU
+0a61:	LEA	ADDR, 34(FP)
+0a65:	LEA	ACCU, $0dd7
+0a69:	STRCPY
+0a6a:	MOV	ACCU, #1
+0a6d:	MOVB	2(FP), ACCU
+0a70:	MOV	T1, #2
+0a73:	MOV	T2, #3
+0a76:	LEA	T3, 3(FP)
+0a7a:	LEA	T4, 34(FP)
+0a7e:	MOV	T5, #2
+0a81:	MOVB	T6, #65
+0a84:	MOV	ACCU, T3
+0a86:	LEAX	ADDR, T5 + ACCU
+0a88:	MOVB	P0, 0(ADDR)
+0a8b:	MOV	ACCU, T4
+0a8d:	LEAX	ADDR, T5 + ACCU
+0a8f:	MOVB	P1, 1(ADDR)
+0a92:	CALL	Func_1 + 0
+0a95:	MOVB	ACCU, ACCU
+0a97:	BNE	$0AA0
+0a99:	MOVB	T6, #65
+0a9c:	ADD	T5, #$0001
+0aa0:	MOV	ACCU, T5
+0aa2:	CMPS	ACCU, #$0002
+0aa5:	BGE	$0A84
+0aa7:	MOVB	ACCU, T6
+0aa9:	CMPUB	ACCU, #$0057
+0aab:	BGT	$0AB6
+0aad:	MOVB	ACCU, T6
+0aaf:	CMPUB	ACCU, #$005A
+0ab1:	BLE	$0AB6
+0ab3:	MOV	T5, #7
+0ab6:	MOVB	ACCU, T6
+0ab8:	CMPUB	ACCU, #$0052
+0aba:	BEQF	$0D93
+0abd:	MOV	ACCU, T3
+0abf:	MOV	P0, ACCU
+0ac1:	MOV	ACCU, T4
+0ac3:	MOV	P2, ACCU
+0ac5:	JSR	strcmp + 0
+0ac8:	BGT	$0ACF
+0aca:	MOV	ACCU, #1
+0acd:	JUMP	$0ADC
+0acf:	MOV	ACCU, T5
+0ad1:	ADD	ACCU, #$0007
+0ad5:	MOV	Int_Glob + 0, ACCU
+0ad9:	MOV	ACCU, #0
+0adc:	MOVB	Bool_Glob + 0, ACCU
+0ae0:	MOV	ACCU, T2
+0ae2:	CMPS	ACCU, T1
+0ae4:	BLTF	$0D69
+0ae7:	MOV	ACCU, T1
+0ae9:	SHL	ACCU, #1
+0aeb:	MOV	T3, ACCU
+0aed:	LEAX	ADDR, Arr_1_Glob + 10 + T3
+0af1:	MOV	T5, 0(FP)
+0af4:	MOV	0(ADDR), T5
+0af7:	LEAX	ADDR, Arr_1_Glob + 12 + T3
+0afb:	MOV	0(ADDR), T5
+0afe:	LEAX	ADDR, Arr_1_Glob + 70 + T3
+0b02:	MOV	ACCU, T1
+0b04:	ADD	ACCU, #$0005
+0b08:	MOV	T4, ACCU
+0b0a:	MOV	0(ADDR), T4
+0b0d:	LEA	T3, Arr_1_Glob + 0
+0b11:	LEA	T5, Arr_2_Glob + 0
+0b15:	MOV	ACCU, T1
+0b17:	ADD	ACCU, #$0006
+0b1b:	CMPS	ACCU, T4
+0b1d:	BLEF	$0D40
+0b20:	MOV	ACCU, T4
+0b22:	MUL	ACCU, #50
+0b25:	ADD	ACCU, T4
+0b27:	ADD	ACCU, #$FFFF
+0b2b:	SHL	ACCU, #1
+0b2d:	LEAX	ADDR, T5 + ACCU
+0b2f:	MOV	T9, 0(ADDR)
+0b32:	ADD	T9, #$0001
+0b36:	MOV	0(ADDR), T9
+0b39:	MOV	ACCU, T4
+0b3b:	SHL	ACCU, #1
+0b3d:	LEAX	ADDR, T3 + ACCU
+0b3f:	MOV	T3, 0(ADDR)
+0b42:	MOV	ACCU, T4
+0b44:	ADD	ACCU, #$0014
+0b48:	MUL	ACCU, #50
+0b4b:	ADD	ACCU, T4
+0b4d:	SHL	ACCU, #1
+0b4f:	LEAX	ADDR, T5 + ACCU
+0b51:	MOV	0(ADDR), T3
+0b54:	MOV	ACCU, #5
+0b57:	MOV	Int_Glob + 0, ACCU
+0b5b:	MOV	T3, Ptr_Glob + 0
+0b5f:	MOV	ADDR, T3
+0b61:	MOV	T4, 0(ADDR)
+0b64:	MOV	T5, 0(ADDR)
+0b67:	MOV	ADDR, T5
+0b69:	MOV	ACCU, T3
+0b6b:	COPY	#37
+0b6d:	MOV	ACCU, #5
+0b70:	MOV	ADDR, T3
+0b72:	MOV	4(ADDR), ACCU
+0b75:	MOV	ADDR, T4
+0b77:	MOV	4(ADDR), ACCU
+0b7a:	MOV	ADDR, T3
+0b7c:	MOV	T5, 0(ADDR)
+0b7f:	MOV	ADDR, T4
+0b81:	MOV	0(ADDR), T5
+0b84:	MOV	2(SP), T4
+0b87:	CALL	Proc_3 + 0
+0b8a:	MOV	ADDR, T4
+0b8c:	MOVUB	ACCU, 2(ADDR)
+0b8f:	BEQ	$0B9A
+0b91:	MOV	ADDR, T3
+0b93:	MOV	ACCU, 0(ADDR)
+0b96:	COPY	#37
+0b98:	JUMP	$0BCF
+0b9a:	MOV	ACCU, #6
+0b9d:	MOV	4(ADDR), ACCU
+0ba0:	MOV	ADDR, T3
+0ba2:	MOVB	P0, 3(ADDR)
+0ba5:	MOV	ACCU, T4
+0ba7:	ADD	ACCU, #$0003
+0bab:	MOV	P1, ACCU
+0bad:	CALL	Proc_6 + 0
+0bb0:	MOV	T3, Ptr_Glob + 0
+0bb4:	MOV	ADDR, T3
+0bb6:	MOV	T3, 0(ADDR)
+0bb9:	MOV	ADDR, T4
+0bbb:	MOV	0(ADDR), T3
+0bbe:	MOV	P0, 4(ADDR)
+0bc1:	MOV	P2, #10
+0bc4:	MOV	ACCU, T4
+0bc6:	ADD	ACCU, #$0004
+0bca:	MOV	P4, ACCU
+0bcc:	CALL	Proc_7 + 0
+0bcf:	MOVB	T6, #65
+0bd2:	MOVUB	ACCU, Ch_2_Glob + 0
+0bd6:	CMPUB	ACCU, #$0041
+0bd8:	BLEF	$0D00
+0bdb:	MOVB	T6, Ch_1_Glob + 0
+0bdf:	MOV	ACCU, T2
+0be1:	MUL	ACCU, T1
+0be3:	MOV	T1, ACCU
+0be5:	MOV	T2, 0(FP)
+0be8:	DIVS	ACCU, T2
+0bea:	MOV	T3, ACCU
+0bec:	ADD	ACCU, #$000A
+0bf0:	MOV	T4, ACCU
+0bf2:	MOV	ACCU, T1
+0bf4:	SUB	ACCU, T2
+0bf6:	MUL	ACCU, #7
+0bf9:	SUB	ACCU, T3
+0bfb:	MOV	T1, ACCU
+0bfd:	MOVB	ACCU, T6
+0bff:	CMPUB	ACCU, #$0041
+0c01:	BEQF	$0CEF
+0c04:	MOVB	T6, #1
+0c07:	MOVB	ACCU, T6
+0c09:	BNEF	$0CE6
+0c0c:	ADD	T0, #$0001
+0c10:	MOV	ACCU, T0
+0c12:	CMPS	ACCU, #$01F4
+0c15:	BGEF	$0A4C
+0c18:	MOV	ACCU, Int_Glob + 0
+0c1c:	CMPU	ACCU, #$0005
+0c1f:	BNEF	$0CE1
+0c22:	MOVUB	ACCU, Bool_Glob + 0
+0c26:	BEQF	$0CE1
+0c29:	MOVUB	ACCU, Ch_1_Glob + 0
+0c2d:	CMPUB	ACCU, #$0041
+0c2f:	BNEF	$0CE1
+0c32:	MOVUB	ACCU, Ch_2_Glob + 0
+0c36:	CMPUB	ACCU, #$0042
+0c38:	BNEF	$0CE1
+0c3b:	MOV	ACCU, Arr_1_Glob + 16
+0c3f:	CMPU	ACCU, #$0007
+0c42:	BNEF	$0CDC
+0c45:	MOV	ACCU, Arr_2_Glob + 814
+0c49:	CMPU	ACCU, #$01FE
+0c4c:	BNEF	$0CDC
+0c4f:	MOV	T0, Ptr_Glob + 0
+0c53:	MOV	ADDR, T0
+0c55:	MOVUB	ACCU, 2(ADDR)
+0c58:	BNE	$0CD7
+0c5a:	MOVUB	ACCU, 3(ADDR)
+0c5d:	CMPUB	ACCU, #$0002
+0c5f:	BNE	$0CD7
+0c61:	MOV	ACCU, 4(ADDR)
+0c64:	CMPU	ACCU, #$0011
+0c67:	BNE	$0CD7
+0c69:	MOV	T2, Next_Ptr_Glob + 0
+0c6d:	MOV	ADDR, T2
+0c6f:	MOVUB	ACCU, 2(ADDR)
+0c72:	BNE	$0CD2
+0c74:	MOVUB	ACCU, 3(ADDR)
+0c77:	CMPUB	ACCU, #$0001
+0c79:	BNE	$0CD2
+0c7b:	MOV	ACCU, 4(ADDR)
+0c7e:	CMPU	ACCU, #$0012
+0c81:	BNE	$0CD2
+0c83:	MOV	ACCU, T3
+0c85:	CMPU	ACCU, #$0005
+0c88:	BNE	$0CCD
+0c8a:	MOV	ACCU, T1
+0c8c:	CMPU	ACCU, #$000D
+0c8f:	BNE	$0CCD
+0c91:	MOV	ACCU, 0(FP)
+0c94:	CMPU	ACCU, #$0007
+0c97:	BNE	$0CCD
+0c99:	MOVUB	ACCU, 2(FP)
+0c9c:	CMPUB	ACCU, #$0001
+0c9e:	BNE	$0CCD
+0ca0:	ADD	T0, #$0006
+0ca4:	MOV	ACCU, T0
+0ca6:	MOV	P0, ACCU
+0ca8:	LEA	P2, $0f24
+0cac:	JSR	strcmp + 0
+0caf:	BNE	$0CC3
+0cb1:	LEA	P0, 34(FP)
+0cb5:	LEA	P2, $0f43
+0cb9:	JSR	strcmp + 0
+0cbc:	BNE	$0CC3
+0cbe:	MOV	ACCU, #0
+0cc1:	JUMP	$0CC6
+0cc3:	MOV	ACCU, #6
+0cc6:	POP	#$0004
+0cc9:	RETURN	7, 74
+0ccd:	MOV	ACCU, #5
+0cd0:	JUMP	$0CC6
+0cd2:	MOV	ACCU, #4
+0cd5:	JUMP	$0CC6
+0cd7:	MOV	ACCU, #3
+0cda:	JUMP	$0CC6
+0cdc:	MOV	ACCU, #2
+0cdf:	JUMP	$0CC6
+0ce1:	MOV	ACCU, #1
+0ce4:	JUMP	$0CC6
+0ce6:	MOVUB	ACCU, Ch_1_Glob + 0
+0cea:	CMPUB	ACCU, #$0041
+0cec:	BNEF	$0C07
+0cef:	MOV	ACCU, T4
+0cf1:	ADD	ACCU, #$FFFF
+0cf5:	MOV	T3, Int_Glob + 0
+0cf9:	SUB	ACCU, T3
+0cfb:	MOV	T3, ACCU
+0cfd:	JUMPF	$0C0C
+0d00:	MOVB	T8, 2(FP)
+0d03:	MOVB	ACCU, T6
+0d05:	MOVB	P0, ACCU
+0d07:	MOVB	P1, #67
+0d0a:	CALL	Func_1 + 0
+0d0d:	CMPUB	ACCU, T8
+0d0f:	BNE	$0D30
+0d11:	LEA	T2, 2(FP)
+0d15:	MOVB	P0, #0
+0d18:	MOV	ACCU, T2
+0d1a:	MOV	P1, ACCU
+0d1c:	CALL	Proc_6 + 0
+0d1f:	LEA	ADDR, 34(FP)
+0d23:	LEA	ACCU, $0f05
+0d27:	STRCPY
+0d28:	MOV	Int_Glob + 0, T0
+0d2c:	MOV	ACCU, T0
+0d2e:	MOV	T2, ACCU
+0d30:	MOVB	T8, Ch_2_Glob + 0
+0d34:	ADDB	T6, #$0001
+0d37:	MOVB	ACCU, T8
+0d39:	CMPUB	ACCU, T6
+0d3b:	BLE	$0D00
+0d3d:	JUMPF	$0BDB
+0d40:	MOV	ACCU, T4
+0d42:	MOV	T7, ACCU
+0d44:	ADD	ACCU, #$0001
+0d48:	MOV	T9, ACCU
+0d4a:	MOV	ACCU, T4
+0d4c:	MUL	ACCU, #50
+0d4f:	MOV	T10, ACCU
+0d51:	MOV	ACCU, T10
+0d53:	ADD	ACCU, T7
+0d55:	SHL	ACCU, #1
+0d57:	LEAX	ADDR, T5 + ACCU
+0d59:	MOV	0(ADDR), T4
+0d5c:	ADD	T7, #$0001
+0d60:	MOV	ACCU, T9
+0d62:	CMPS	ACCU, T7
+0d64:	BLE	$0D51
+0d66:	JUMPF	$0B20
+0d69:	LEA	T3, 0(FP)
+0d6d:	MOV	ACCU, T1
+0d6f:	MUL	ACCU, #5
+0d72:	SUB	ACCU, T2
+0d74:	MOV	0(FP), ACCU
+0d77:	MOV	ACCU, T1
+0d79:	MOV	P0, ACCU
+0d7b:	MOV	ACCU, T2
+0d7d:	MOV	P2, ACCU
+0d7f:	MOV	ACCU, T3
+0d81:	MOV	P4, ACCU
+0d83:	CALL	Proc_7 + 0
+0d86:	ADD	T1, #$0001
+0d8a:	MOV	ACCU, T2
+0d8c:	CMPS	ACCU, T1
+0d8e:	BLT	$0D6D
+0d90:	JUMPF	$0AE7
+0d93:	MOV	ACCU, #0
+0d96:	JUMPF	$0ADC
+--------------------------------------------------------------------
+Func_1:
+0df6:	ENTER	0, 2
+0dfa:	MOVB	ACCU, P0
+0dfc:	MOVB	T0, ACCU
+0dfe:	MOVB	ACCU, P1
+0e00:	CMPUB	ACCU, T0
+0e02:	BNE	$0E0D
+0e04:	MOVB	Ch_1_Glob + 0, T0
+0e08:	MOV	ACCU, #1
+0e0b:	JUMP	$0E10
+0e0d:	MOV	ACCU, #0
+0e10:	RETURN	0, 2
+--------------------------------------------------------------------
+strcmp:
+0e14 : ea __ __ NOP
+0e15 : a0 00 __ LDY #$00
+0e17 : 84 1c __ STY ACCU + 1
+0e19 : b1 0d __ LDA (P0),y
+0e1b : f0 16 __ BEQ $0e33
+0e1d : d1 0f __ CMP (P2),y
+0e1f : d0 16 __ BNE $0e37
+0e21 : c8 __ __ INY
+0e22 : b1 0d __ LDA (P0),y
+0e24 : f0 0d __ BEQ $0e33
+0e26 : d1 0f __ CMP (P2),y
+0e28 : d0 0d __ BNE $0e37
+0e2a : c8 __ __ INY
+0e2b : d0 ec __ BNE $0e19
+0e2d : e6 0e __ INC P1
+0e2f : e6 10 __ INC P3
+0e31 : d0 e6 __ BNE $0e19
+0e33 : d1 0f __ CMP (P2),y
+0e35 : f0 0a __ BEQ $0e41
+0e37 : b0 06 __ BCS $0e3f
+0e39 : a9 ff __ LDA #$ff
+0e3b : 85 1c __ STA ACCU + 1
+0e3d : 30 02 __ BMI $0e41
+0e3f : a9 01 __ LDA #$01
+0e41 : 85 1b __ STA ACCU + 0
+0e43 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+0e44:	ENTER	0, 2
+0e48:	MOV	ACCU, P0
+0e4a:	MOV	T0, ACCU
+0e4c:	ADD	T0, #$0002
+0e50:	MOV	ACCU, P2
+0e52:	ADD	T0, ACCU
+0e54:	MOV	ADDR, P4
+0e56:	MOV	0(ADDR), T0
+0e59:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_3:
+0e5d:	ENTER	0, 2
+0e61:	PUSH	#$0002
+0e64:	MOV	T0, Ptr_Glob + 0
+0e68:	MOV	ACCU, T0
+0e6a:	BEQ	$0E77
+0e6c:	MOV	ADDR, T0
+0e6e:	MOV	T1, 0(ADDR)
+0e71:	MOV	ADDR, 2(FP)
+0e74:	MOV	0(ADDR), T1
+0e77:	MOV	P0, #10
+0e7a:	MOV	P2, Int_Glob + 0
+0e7e:	ADD	T0, #$0004
+0e82:	MOV	ACCU, T0
+0e84:	MOV	P4, ACCU
+0e86:	CALL	Proc_7 + 0
+0e89:	POP	#$0002
+0e8c:	RETURN	0, 2
+--------------------------------------------------------------------
+Proc_6:
+0e90:	ENTER	0, 2
+0e94:	MOVB	ACCU, P0
+0e96:	MOVB	T0, ACCU
+0e98:	MOV	ACCU, P1
+0e9a:	MOV	T1, ACCU
+0e9c:	MOV	ADDR, T1
+0e9e:	MOVB	0(ADDR), T0
+0ea1:	MOVB	ACCU, T0
+0ea3:	CMPUB	ACCU, #$0002
+0ea5:	BEQ	$0EAD
+0ea7:	MOV	ACCU, #3
+0eaa:	MOVB	0(ADDR), ACCU
+0ead:	MOVB	T2, #3
+0eb0:	MOVB	ACCU, T0
+0eb2:	CMPUB	ACCU, #$0003
+0eb4:	BEQ	$0ECA
+0eb6:	MOVB	ACCU, T2
+0eb8:	CMPUB	ACCU, T0
+0eba:	BLT	$0ECE
+0ebc:	MOVB	ACCU, T0
+0ebe:	CMPUB	ACCU, #$0004
+0ec0:	BNE	$0ECA
+0ec2:	MOV	ACCU, #2
+0ec5:	MOV	ADDR, T1
+0ec7:	MOVB	0(ADDR), ACCU
+0eca:	RETURN	0, 2
+0ece:	MOVB	ACCU, T0
+0ed0:	BEQ	$0EFB
+0ed2:	MOVB	ACCU, T0
+0ed4:	CMPUB	ACCU, #$0001
+0ed6:	BEQ	$0EE8
+0ed8:	MOVB	ACCU, T0
+0eda:	CMPUB	ACCU, #$0002
+0edc:	BNE	$0ECA
+0ede:	MOV	ACCU, #1
+0ee1:	MOV	ADDR, T1
+0ee3:	MOVB	0(ADDR), ACCU
+0ee6:	JUMP	$0ECA
+0ee8:	MOV	ACCU, Int_Glob + 0
+0eec:	CMPS	ACCU, #$0064
+0eef:	BLT	$0EFB
+0ef1:	MOV	ACCU, #3
+0ef4:	MOV	ADDR, T1
+0ef6:	MOVB	0(ADDR), ACCU
+0ef9:	JUMP	$0ECA
+0efb:	MOV	ACCU, #0
+0efe:	MOV	ADDR, T1
+0f00:	MOVB	0(ADDR), ACCU
+0f03:	JUMP	$0ECA
+--------------------------------------------------------------------
+negaccu:
+0f62 : 38 __ __ SEC
+0f63 : a9 00 __ LDA #$00
+0f65 : e5 1b __ SBC ACCU + 0
+0f67 : 85 1b __ STA ACCU + 0
+0f69 : a9 00 __ LDA #$00
+0f6b : e5 1c __ SBC ACCU + 1
+0f6d : 85 1c __ STA ACCU + 1
+0f6f : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0f70 : 38 __ __ SEC
+0f71 : a9 00 __ LDA #$00
+0f73 : e5 03 __ SBC $03
+0f75 : 85 03 __ STA $03
+0f77 : a9 00 __ LDA #$00
+0f79 : e5 04 __ SBC $04
+0f7b : 85 04 __ STA $04
+0f7d : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0f7e : a5 1c __ LDA ACCU + 1
+0f80 : d0 31 __ BNE $0fb3
+0f82 : a5 04 __ LDA $04
+0f84 : d0 1e __ BNE $0fa4
+0f86 : 85 06 __ STA $06
+0f88 : a2 04 __ LDX #$04
+0f8a : 06 1b __ ASL ACCU + 0
+0f8c : 2a __ __ ROL
+0f8d : c5 03 __ CMP $03
+0f8f : 90 02 __ BCC $0f93
+0f91 : e5 03 __ SBC $03
+0f93 : 26 1b __ ROL ACCU + 0
+0f95 : 2a __ __ ROL
+0f96 : c5 03 __ CMP $03
+0f98 : 90 02 __ BCC $0f9c
+0f9a : e5 03 __ SBC $03
+0f9c : 26 1b __ ROL ACCU + 0
+0f9e : ca __ __ DEX
+0f9f : d0 eb __ BNE $0f8c
+0fa1 : 85 05 __ STA $05
+0fa3 : 60 __ __ RTS
+0fa4 : a5 1b __ LDA ACCU + 0
+0fa6 : 85 05 __ STA $05
+0fa8 : a5 1c __ LDA ACCU + 1
+0faa : 85 06 __ STA $06
+0fac : a9 00 __ LDA #$00
+0fae : 85 1b __ STA ACCU + 0
+0fb0 : 85 1c __ STA ACCU + 1
+0fb2 : 60 __ __ RTS
+0fb3 : a5 04 __ LDA $04
+0fb5 : d0 1f __ BNE $0fd6
+0fb7 : a5 03 __ LDA $03
+0fb9 : 30 1b __ BMI $0fd6
+0fbb : a9 00 __ LDA #$00
+0fbd : 85 06 __ STA $06
+0fbf : a2 10 __ LDX #$10
+0fc1 : 06 1b __ ASL ACCU + 0
+0fc3 : 26 1c __ ROL ACCU + 1
+0fc5 : 2a __ __ ROL
+0fc6 : c5 03 __ CMP $03
+0fc8 : 90 02 __ BCC $0fcc
+0fca : e5 03 __ SBC $03
+0fcc : 26 1b __ ROL ACCU + 0
+0fce : 26 1c __ ROL ACCU + 1
+0fd0 : ca __ __ DEX
+0fd1 : d0 f2 __ BNE $0fc5
+0fd3 : 85 05 __ STA $05
+0fd5 : 60 __ __ RTS
+0fd6 : a9 00 __ LDA #$00
+0fd8 : 85 05 __ STA $05
+0fda : 85 06 __ STA $06
+0fdc : 84 02 __ STY $02
+0fde : a0 10 __ LDY #$10
+0fe0 : 18 __ __ CLC
+0fe1 : 26 1b __ ROL ACCU + 0
+0fe3 : 26 1c __ ROL ACCU + 1
+0fe5 : 26 05 __ ROL $05
+0fe7 : 26 06 __ ROL $06
+0fe9 : 38 __ __ SEC
+0fea : a5 05 __ LDA $05
+0fec : e5 03 __ SBC $03
+0fee : aa __ __ TAX
+0fef : a5 06 __ LDA $06
+0ff1 : e5 04 __ SBC $04
+0ff3 : 90 04 __ BCC $0ff9
+0ff5 : 86 05 __ STX $05
+0ff7 : 85 06 __ STA $06
+0ff9 : 88 __ __ DEY
+0ffa : d0 e5 __ BNE $0fe1
+0ffc : 26 1b __ ROL ACCU + 0
+0ffe : 26 1c __ ROL ACCU + 1
+1000 : a4 02 __ LDY $02
+1002 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1003 : a9 4c __ LDA #$4c
+1005 : 85 54 __ STA $54
+1007 : a9 00 __ LDA #$00
+1009 : 85 13 __ STA P6
+100b : a9 19 __ LDA #$19
+100d : 85 16 __ STA P9
+100f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1010 : b1 19 __ LDA (IP + 0),y
+1012 : aa __ __ TAX
+1013 : c8 __ __ INY
+1014 : b1 19 __ LDA (IP + 0),y
+1016 : 95 00 __ STA $00,x
+1018 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+101b : b1 19 __ LDA (IP + 0),y
+101d : aa __ __ TAX
+101e : c8 __ __ INY
+101f : b1 19 __ LDA (IP + 0),y
+1021 : 95 00 __ STA $00,x
+1023 : a9 00 __ LDA #$00
+1025 : 95 01 __ STA $01,x
+1027 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+102a : b1 19 __ LDA (IP + 0),y
+102c : aa __ __ TAX
+102d : b5 00 __ LDA $00,x
+102f : 85 1b __ STA ACCU + 0
+1031 : a9 00 __ LDA #$00
+1033 : 85 1c __ STA ACCU + 1
+1035 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1038 : b1 19 __ LDA (IP + 0),y
+103a : aa __ __ TAX
+103b : a5 1b __ LDA ACCU + 0
+103d : 95 00 __ STA $00,x
+103f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1042 : b1 19 __ LDA (IP + 0),y
+1044 : aa __ __ TAX
+1045 : b5 00 __ LDA $00,x
+1047 : 85 1b __ STA ACCU + 0
+1049 : b5 01 __ LDA $01,x
+104b : 85 1c __ STA ACCU + 1
+104d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1050 : b1 19 __ LDA (IP + 0),y
+1052 : aa __ __ TAX
+1053 : a5 1b __ LDA ACCU + 0
+1055 : 95 00 __ STA $00,x
+1057 : a5 1c __ LDA ACCU + 1
+1059 : 95 01 __ STA $01,x
+105b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+105e : b1 19 __ LDA (IP + 0),y
+1060 : aa __ __ TAX
+1061 : b5 00 __ LDA $00,x
+1063 : 85 1f __ STA ADDR + 0
+1065 : b5 01 __ LDA $01,x
+1067 : 85 20 __ STA ADDR + 1
+1069 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+106c : b1 19 __ LDA (IP + 0),y
+106e : 85 1f __ STA ADDR + 0
+1070 : c8 __ __ INY
+1071 : b1 19 __ LDA (IP + 0),y
+1073 : 85 20 __ STA ADDR + 1
+1075 : c8 __ __ INY
+1076 : b1 19 __ LDA (IP + 0),y
+1078 : aa __ __ TAX
+1079 : 84 02 __ STY $02
+107b : a0 00 __ LDY #$00
+107d : b1 1f __ LDA (ADDR + 0),y
+107f : 95 00 __ STA $00,x
+1081 : a4 02 __ LDY $02
+1083 : 4c 50 08 JMP $0850 ; (startup + 79)
+1086 : b1 19 __ LDA (IP + 0),y
+1088 : aa __ __ TAX
+1089 : c8 __ __ INY
+108a : b1 19 __ LDA (IP + 0),y
+108c : 84 02 __ STY $02
+108e : a8 __ __ TAY
+108f : 4c 7d 10 JMP $107d ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1092 : b1 19 __ LDA (IP + 0),y
+1094 : 85 1f __ STA ADDR + 0
+1096 : c8 __ __ INY
+1097 : b1 19 __ LDA (IP + 0),y
+1099 : 85 20 __ STA ADDR + 1
+109b : c8 __ __ INY
+109c : b1 19 __ LDA (IP + 0),y
+109e : aa __ __ TAX
+109f : 84 02 __ STY $02
+10a1 : a0 00 __ LDY #$00
+10a3 : b1 1f __ LDA (ADDR + 0),y
+10a5 : 95 00 __ STA $00,x
+10a7 : a9 00 __ LDA #$00
+10a9 : 95 01 __ STA $01,x
+10ab : a4 02 __ LDY $02
+10ad : 4c 50 08 JMP $0850 ; (startup + 79)
+10b0 : b1 19 __ LDA (IP + 0),y
+10b2 : aa __ __ TAX
+10b3 : c8 __ __ INY
+10b4 : b1 19 __ LDA (IP + 0),y
+10b6 : 84 02 __ STY $02
+10b8 : a8 __ __ TAY
+10b9 : 4c a3 10 JMP $10a3 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+10bc : b1 19 __ LDA (IP + 0),y
+10be : 85 1f __ STA ADDR + 0
+10c0 : c8 __ __ INY
+10c1 : b1 19 __ LDA (IP + 0),y
+10c3 : 85 20 __ STA ADDR + 1
+10c5 : c8 __ __ INY
+10c6 : b1 19 __ LDA (IP + 0),y
+10c8 : aa __ __ TAX
+10c9 : 84 02 __ STY $02
+10cb : a0 00 __ LDY #$00
+10cd : b1 1f __ LDA (ADDR + 0),y
+10cf : 95 00 __ STA $00,x
+10d1 : c8 __ __ INY
+10d2 : b1 1f __ LDA (ADDR + 0),y
+10d4 : 95 01 __ STA $01,x
+10d6 : a4 02 __ LDY $02
+10d8 : 4c 50 08 JMP $0850 ; (startup + 79)
+10db : b1 19 __ LDA (IP + 0),y
+10dd : aa __ __ TAX
+10de : c8 __ __ INY
+10df : b1 19 __ LDA (IP + 0),y
+10e1 : 84 02 __ STY $02
+10e3 : a8 __ __ TAY
+10e4 : 4c cd 10 JMP $10cd ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+10e7 : b1 19 __ LDA (IP + 0),y
+10e9 : 85 1f __ STA ADDR + 0
+10eb : c8 __ __ INY
+10ec : b1 19 __ LDA (IP + 0),y
+10ee : 85 20 __ STA ADDR + 1
+10f0 : c8 __ __ INY
+10f1 : b1 19 __ LDA (IP + 0),y
+10f3 : aa __ __ TAX
+10f4 : 84 02 __ STY $02
+10f6 : a0 00 __ LDY #$00
+10f8 : b5 00 __ LDA $00,x
+10fa : 91 1f __ STA (ADDR + 0),y
+10fc : a4 02 __ LDY $02
+10fe : 4c 50 08 JMP $0850 ; (startup + 79)
+1101 : b1 19 __ LDA (IP + 0),y
+1103 : aa __ __ TAX
+1104 : c8 __ __ INY
+1105 : b1 19 __ LDA (IP + 0),y
+1107 : 84 02 __ STY $02
+1109 : a8 __ __ TAY
+110a : 4c f8 10 JMP $10f8 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+110d : b1 19 __ LDA (IP + 0),y
+110f : 85 1f __ STA ADDR + 0
+1111 : c8 __ __ INY
+1112 : b1 19 __ LDA (IP + 0),y
+1114 : 85 20 __ STA ADDR + 1
+1116 : c8 __ __ INY
+1117 : b1 19 __ LDA (IP + 0),y
+1119 : aa __ __ TAX
+111a : 84 02 __ STY $02
+111c : a0 00 __ LDY #$00
+111e : b5 00 __ LDA $00,x
+1120 : 91 1f __ STA (ADDR + 0),y
+1122 : c8 __ __ INY
+1123 : b5 01 __ LDA $01,x
+1125 : 91 1f __ STA (ADDR + 0),y
+1127 : a4 02 __ LDY $02
+1129 : 4c 50 08 JMP $0850 ; (startup + 79)
+112c : b1 19 __ LDA (IP + 0),y
+112e : aa __ __ TAX
+112f : c8 __ __ INY
+1130 : b1 19 __ LDA (IP + 0),y
+1132 : 84 02 __ STY $02
+1134 : a8 __ __ TAY
+1135 : 4c 1e 11 JMP $111e ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1138 : b1 19 __ LDA (IP + 0),y
+113a : aa __ __ TAX
+113b : c8 __ __ INY
+113c : b1 19 __ LDA (IP + 0),y
+113e : 95 00 __ STA $00,x
+1140 : c8 __ __ INY
+1141 : b1 19 __ LDA (IP + 0),y
+1143 : 95 01 __ STA $01,x
+1145 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1148 : b1 19 __ LDA (IP + 0),y
+114a : aa __ __ TAX
+114b : c8 __ __ INY
+114c : 18 __ __ CLC
+114d : b5 00 __ LDA $00,x
+114f : 71 19 __ ADC (IP + 0),y
+1151 : 85 1f __ STA ADDR + 0
+1153 : c8 __ __ INY
+1154 : b5 01 __ LDA $01,x
+1156 : 71 19 __ ADC (IP + 0),y
+1158 : 85 20 __ STA ADDR + 1
+115a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+115d : b1 19 __ LDA (IP + 0),y
+115f : aa __ __ TAX
+1160 : 18 __ __ CLC
+1161 : b5 00 __ LDA $00,x
+1163 : 65 1b __ ADC ACCU + 0
+1165 : 85 1f __ STA ADDR + 0
+1167 : b5 01 __ LDA $01,x
+1169 : 65 1c __ ADC ACCU + 1
+116b : 85 20 __ STA ADDR + 1
+116d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1170 : b1 19 __ LDA (IP + 0),y
+1172 : aa __ __ TAX
+1173 : c8 __ __ INY
+1174 : b1 19 __ LDA (IP + 0),y
+1176 : 84 02 __ STY $02
+1178 : a8 __ __ TAY
+1179 : b1 25 __ LDA (FP + 0),y
+117b : 95 00 __ STA $00,x
+117d : a4 02 __ LDY $02
+117f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1182 : b1 19 __ LDA (IP + 0),y
+1184 : aa __ __ TAX
+1185 : c8 __ __ INY
+1186 : b1 19 __ LDA (IP + 0),y
+1188 : 84 02 __ STY $02
+118a : a8 __ __ TAY
+118b : b1 25 __ LDA (FP + 0),y
+118d : 95 00 __ STA $00,x
+118f : a9 00 __ LDA #$00
+1191 : 95 01 __ STA $01,x
+1193 : a4 02 __ LDY $02
+1195 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1198 : b1 19 __ LDA (IP + 0),y
+119a : aa __ __ TAX
+119b : c8 __ __ INY
+119c : b1 19 __ LDA (IP + 0),y
+119e : 84 02 __ STY $02
+11a0 : a8 __ __ TAY
+11a1 : b1 25 __ LDA (FP + 0),y
+11a3 : 95 00 __ STA $00,x
+11a5 : c8 __ __ INY
+11a6 : b1 25 __ LDA (FP + 0),y
+11a8 : 95 01 __ STA $01,x
+11aa : a4 02 __ LDY $02
+11ac : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+11af : b1 19 __ LDA (IP + 0),y
+11b1 : aa __ __ TAX
+11b2 : c8 __ __ INY
+11b3 : b1 19 __ LDA (IP + 0),y
+11b5 : 84 02 __ STY $02
+11b7 : a8 __ __ TAY
+11b8 : b5 00 __ LDA $00,x
+11ba : 91 25 __ STA (FP + 0),y
+11bc : a4 02 __ LDY $02
+11be : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+11c1 : b1 19 __ LDA (IP + 0),y
+11c3 : aa __ __ TAX
+11c4 : c8 __ __ INY
+11c5 : b1 19 __ LDA (IP + 0),y
+11c7 : 84 02 __ STY $02
+11c9 : a8 __ __ TAY
+11ca : b5 00 __ LDA $00,x
+11cc : 91 25 __ STA (FP + 0),y
+11ce : c8 __ __ INY
+11cf : b5 01 __ LDA $01,x
+11d1 : 91 25 __ STA (FP + 0),y
+11d3 : a4 02 __ LDY $02
+11d5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+11d8 : b1 19 __ LDA (IP + 0),y
+11da : aa __ __ TAX
+11db : c8 __ __ INY
+11dc : 18 __ __ CLC
+11dd : b1 19 __ LDA (IP + 0),y
+11df : 65 25 __ ADC FP + 0
+11e1 : 95 00 __ STA $00,x
+11e3 : c8 __ __ INY
+11e4 : b1 19 __ LDA (IP + 0),y
+11e6 : 65 26 __ ADC FP + 1
+11e8 : 95 01 __ STA $01,x
+11ea : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+11ed : b1 19 __ LDA (IP + 0),y
+11ef : aa __ __ TAX
+11f0 : c8 __ __ INY
+11f1 : b1 19 __ LDA (IP + 0),y
+11f3 : 84 02 __ STY $02
+11f5 : a8 __ __ TAY
+11f6 : b5 00 __ LDA $00,x
+11f8 : 91 23 __ STA (SP + 0),y
+11fa : c8 __ __ INY
+11fb : b5 01 __ LDA $01,x
+11fd : 91 23 __ STA (SP + 0),y
+11ff : a4 02 __ LDY $02
+1201 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1204 : b1 19 __ LDA (IP + 0),y
+1206 : aa __ __ TAX
+1207 : 18 __ __ CLC
+1208 : a5 1b __ LDA ACCU + 0
+120a : 75 00 __ ADC $00,x
+120c : 85 1b __ STA ACCU + 0
+120e : a5 1c __ LDA ACCU + 1
+1210 : 75 01 __ ADC $01,x
+1212 : 85 1c __ STA ACCU + 1
+1214 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1217 : b1 19 __ LDA (IP + 0),y
+1219 : aa __ __ TAX
+121a : 38 __ __ SEC
+121b : a5 1b __ LDA ACCU + 0
+121d : f5 00 __ SBC $00,x
+121f : 85 1b __ STA ACCU + 0
+1221 : a5 1c __ LDA ACCU + 1
+1223 : f5 01 __ SBC $01,x
+1225 : 85 1c __ STA ACCU + 1
+1227 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+122a : b1 19 __ LDA (IP + 0),y
+122c : aa __ __ TAX
+122d : a9 00 __ LDA #$00
+122f : 85 05 __ STA $05
+1231 : 85 06 __ STA $06
+1233 : b5 00 __ LDA $00,x
+1235 : 85 03 __ STA $03
+1237 : b5 01 __ LDA $01,x
+1239 : 85 04 __ STA $04
+123b : a2 10 __ LDX #$10
+123d : 46 04 __ LSR $04
+123f : 66 03 __ ROR $03
+1241 : 90 0d __ BCC $1250
+1243 : 18 __ __ CLC
+1244 : a5 05 __ LDA $05
+1246 : 65 1b __ ADC ACCU + 0
+1248 : 85 05 __ STA $05
+124a : a5 06 __ LDA $06
+124c : 65 1c __ ADC ACCU + 1
+124e : 85 06 __ STA $06
+1250 : 06 1b __ ASL ACCU + 0
+1252 : 26 1c __ ROL ACCU + 1
+1254 : ca __ __ DEX
+1255 : d0 e6 __ BNE $123d
+1257 : a5 05 __ LDA $05
+1259 : 85 1b __ STA ACCU + 0
+125b : a5 06 __ LDA $06
+125d : 85 1c __ STA ACCU + 1
+125f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1262 : b1 19 __ LDA (IP + 0),y
+1264 : aa __ __ TAX
+1265 : b5 00 __ LDA $00,x
+1267 : 85 03 __ STA $03
+1269 : b5 01 __ LDA $01,x
+126b : 85 04 __ STA $04
+126d : 24 1c __ BIT ACCU + 1
+126f : 10 10 __ BPL $1281
+1271 : 20 62 0f JSR $0f62 ; (negaccu + 0)
+1274 : 24 04 __ BIT $04
+1276 : 10 10 __ BPL $1288
+1278 : 20 70 0f JSR $0f70 ; (negtmp + 0)
+127b : 20 7e 0f JSR $0f7e ; (divmod + 0)
+127e : 4c 50 08 JMP $0850 ; (startup + 79)
+1281 : 24 04 __ BIT $04
+1283 : 10 f6 __ BPL $127b
+1285 : 20 70 0f JSR $0f70 ; (negtmp + 0)
+1288 : 20 7e 0f JSR $0f7e ; (divmod + 0)
+128b : 20 62 0f JSR $0f62 ; (negaccu + 0)
+128e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1291 : b1 19 __ LDA (IP + 0),y
+1293 : aa __ __ TAX
+1294 : 18 __ __ CLC
+1295 : b5 00 __ LDA $00,x
+1297 : 65 1b __ ADC ACCU + 0
+1299 : 95 00 __ STA $00,x
+129b : b5 01 __ LDA $01,x
+129d : 65 1c __ ADC ACCU + 1
+129f : 95 01 __ STA $01,x
+12a1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+12a4 : b1 19 __ LDA (IP + 0),y
+12a6 : c8 __ __ INY
+12a7 : aa __ __ TAX
+12a8 : 18 __ __ CLC
+12a9 : b5 00 __ LDA $00,x
+12ab : 71 19 __ ADC (IP + 0),y
+12ad : c8 __ __ INY
+12ae : 95 00 __ STA $00,x
+12b0 : b5 01 __ LDA $01,x
+12b2 : 71 19 __ ADC (IP + 0),y
+12b4 : 95 01 __ STA $01,x
+12b6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+12b9 : b1 19 __ LDA (IP + 0),y
+12bb : c8 __ __ INY
+12bc : aa __ __ TAX
+12bd : a9 00 __ LDA #$00
+12bf : 85 05 __ STA $05
+12c1 : 85 06 __ STA $06
+12c3 : b5 00 __ LDA $00,x
+12c5 : 85 03 __ STA $03
+12c7 : b5 01 __ LDA $01,x
+12c9 : 85 04 __ STA $04
+12cb : b1 19 __ LDA (IP + 0),y
+12cd : 4a __ __ LSR
+12ce : 85 07 __ STA $07
+12d0 : 90 0d __ BCC $12df
+12d2 : 18 __ __ CLC
+12d3 : a5 05 __ LDA $05
+12d5 : 65 03 __ ADC $03
+12d7 : 85 05 __ STA $05
+12d9 : a5 06 __ LDA $06
+12db : 65 04 __ ADC $04
+12dd : 85 06 __ STA $06
+12df : 06 03 __ ASL $03
+12e1 : 26 04 __ ROL $04
+12e3 : 46 07 __ LSR $07
+12e5 : b0 eb __ BCS $12d2
+12e7 : d0 f6 __ BNE $12df
+12e9 : a5 05 __ LDA $05
+12eb : 95 00 __ STA $00,x
+12ed : a5 06 __ LDA $06
+12ef : 95 01 __ STA $01,x
+12f1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+12f4 : b1 19 __ LDA (IP + 0),y
+12f6 : c8 __ __ INY
+12f7 : aa __ __ TAX
+12f8 : 18 __ __ CLC
+12f9 : b5 00 __ LDA $00,x
+12fb : 71 19 __ ADC (IP + 0),y
+12fd : 95 00 __ STA $00,x
+12ff : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+1302 : b1 19 __ LDA (IP + 0),y
+1304 : aa __ __ TAX
+1305 : b5 00 __ LDA $00,x
+1307 : 2c b1 19 BIT $19b1 ; (Arr_2_Glob + 988)
+130a : 29 0f __ AND #$0f
+130c : f0 0b __ BEQ $1319
+130e : aa __ __ TAX
+130f : a5 1c __ LDA ACCU + 1
+1311 : 06 1b __ ASL ACCU + 0
+1313 : 2a __ __ ROL
+1314 : ca __ __ DEX
+1315 : d0 fa __ BNE $1311
+1317 : 85 1c __ STA ACCU + 1
+1319 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+131c : b1 19 __ LDA (IP + 0),y
+131e : aa __ __ TAX
+131f : 38 __ __ SEC
+1320 : b5 01 __ LDA $01,x
+1322 : e5 1c __ SBC ACCU + 1
+1324 : f0 11 __ BEQ $1337
+1326 : 50 02 __ BVC $132a
+1328 : 49 80 __ EOR #$80
+132a : 30 2a __ BMI $1356
+132c : 10 33 __ BPL $1361
+132e : b1 19 __ LDA (IP + 0),y
+1330 : aa __ __ TAX
+1331 : b5 01 __ LDA $01,x
+1333 : c5 1c __ CMP ACCU + 1
+1335 : d0 28 __ BNE $135f
+1337 : b5 00 __ LDA $00,x
+1339 : c5 1b __ CMP ACCU + 0
+133b : d0 22 __ BNE $135f
+133d : f0 0e __ BEQ $134d
+133f : b1 19 __ LDA (IP + 0),y
+1341 : aa __ __ TAX
+1342 : c8 __ __ INY
+1343 : b1 19 __ LDA (IP + 0),y
+1345 : c5 1c __ CMP ACCU + 1
+1347 : d0 16 __ BNE $135f
+1349 : e4 1b __ CPX ACCU + 0
+134b : d0 12 __ BNE $135f
+134d : a9 00 __ LDA #$00
+134f : 85 1b __ STA ACCU + 0
+1351 : 85 1c __ STA ACCU + 1
+1353 : 4c 50 08 JMP $0850 ; (startup + 79)
+1356 : a9 ff __ LDA #$ff
+1358 : 85 1b __ STA ACCU + 0
+135a : 85 1c __ STA ACCU + 1
+135c : 4c 50 08 JMP $0850 ; (startup + 79)
+135f : 90 f5 __ BCC $1356
+1361 : a9 01 __ LDA #$01
+1363 : 85 1b __ STA ACCU + 0
+1365 : a9 00 __ LDA #$00
+1367 : 85 1c __ STA ACCU + 1
+1369 : 4c 50 08 JMP $0850 ; (startup + 79)
+136c : b1 19 __ LDA (IP + 0),y
+136e : c8 __ __ INY
+136f : aa __ __ TAX
+1370 : b1 19 __ LDA (IP + 0),y
+1372 : 38 __ __ SEC
+1373 : e5 1c __ SBC ACCU + 1
+1375 : d0 af __ BNE $1326
+1377 : e4 1b __ CPX ACCU + 0
+1379 : d0 e4 __ BNE $135f
+137b : f0 d0 __ BEQ $134d
+137d : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+137e : b1 19 __ LDA (IP + 0),y
+1380 : aa __ __ TAX
+1381 : 38 __ __ SEC
+1382 : b5 00 __ LDA $00,x
+1384 : e5 1b __ SBC ACCU + 0
+1386 : f0 19 __ BEQ $13a1
+1388 : 50 02 __ BVC $138c
+138a : 49 80 __ EOR #$80
+138c : 30 1c __ BMI $13aa
+138e : 10 25 __ BPL $13b5
+1390 : b1 19 __ LDA (IP + 0),y
+1392 : aa __ __ TAX
+1393 : b5 00 __ LDA $00,x
+1395 : c5 1b __ CMP ACCU + 0
+1397 : d0 1a __ BNE $13b3
+1399 : f0 06 __ BEQ $13a1
+139b : b1 19 __ LDA (IP + 0),y
+139d : c5 1b __ CMP ACCU + 0
+139f : d0 12 __ BNE $13b3
+13a1 : a9 00 __ LDA #$00
+13a3 : 85 1b __ STA ACCU + 0
+13a5 : 85 1c __ STA ACCU + 1
+13a7 : 4c 50 08 JMP $0850 ; (startup + 79)
+13aa : a9 ff __ LDA #$ff
+13ac : 85 1b __ STA ACCU + 0
+13ae : 85 1c __ STA ACCU + 1
+13b0 : 4c 50 08 JMP $0850 ; (startup + 79)
+13b3 : 90 f5 __ BCC $13aa
+13b5 : a9 01 __ LDA #$01
+13b7 : 85 1b __ STA ACCU + 0
+13b9 : a9 00 __ LDA #$00
+13bb : 85 1c __ STA ACCU + 1
+13bd : 4c 50 08 JMP $0850 ; (startup + 79)
+13c0 : b1 19 __ LDA (IP + 0),y
+13c2 : 38 __ __ SEC
+13c3 : e5 1b __ SBC ACCU + 0
+13c5 : d0 c1 __ BNE $1388
+13c7 : f0 d8 __ BEQ $13a1
+13c9 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+13ca : b1 19 __ LDA (IP + 0),y
+13cc : 30 0c __ BMI $13da
+13ce : 38 __ __ SEC
+13cf : 65 19 __ ADC IP + 0
+13d1 : 85 19 __ STA IP + 0
+13d3 : 90 02 __ BCC $13d7
+13d5 : e6 1a __ INC IP + 1
+13d7 : 4c 51 08 JMP $0851 ; (startup + 80)
+13da : 38 __ __ SEC
+13db : 65 19 __ ADC IP + 0
+13dd : 85 19 __ STA IP + 0
+13df : b0 02 __ BCS $13e3
+13e1 : c6 1a __ DEC IP + 1
+13e3 : 4c 51 08 JMP $0851 ; (startup + 80)
+13e6 : a5 1b __ LDA ACCU + 0
+13e8 : 05 1c __ ORA ACCU + 1
+13ea : f0 de __ BEQ $13ca
+13ec : 4c 50 08 JMP $0850 ; (startup + 79)
+13ef : a5 1b __ LDA ACCU + 0
+13f1 : 05 1c __ ORA ACCU + 1
+13f3 : d0 d5 __ BNE $13ca
+13f5 : 4c 50 08 JMP $0850 ; (startup + 79)
+13f8 : a5 1c __ LDA ACCU + 1
+13fa : 30 04 __ BMI $1400
+13fc : 05 1b __ ORA ACCU + 0
+13fe : d0 ca __ BNE $13ca
+1400 : 4c 50 08 JMP $0850 ; (startup + 79)
+1403 : a5 1c __ LDA ACCU + 1
+1405 : 10 c3 __ BPL $13ca
+1407 : 4c 50 08 JMP $0850 ; (startup + 79)
+140a : a5 1c __ LDA ACCU + 1
+140c : 30 bc __ BMI $13ca
+140e : 4c 50 08 JMP $0850 ; (startup + 79)
+1411 : a5 1c __ LDA ACCU + 1
+1413 : 30 b5 __ BMI $13ca
+1415 : 05 1b __ ORA ACCU + 0
+1417 : f0 b1 __ BEQ $13ca
+1419 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+141c : 38 __ __ SEC
+141d : b1 19 __ LDA (IP + 0),y
+141f : 65 19 __ ADC IP + 0
+1421 : aa __ __ TAX
+1422 : c8 __ __ INY
+1423 : b1 19 __ LDA (IP + 0),y
+1425 : 65 1a __ ADC IP + 1
+1427 : 85 1a __ STA IP + 1
+1429 : 86 19 __ STX IP + 0
+142b : 4c 51 08 JMP $0851 ; (startup + 80)
+142e : a5 1b __ LDA ACCU + 0
+1430 : 05 1c __ ORA ACCU + 1
+1432 : f0 e8 __ BEQ $141c
+1434 : c8 __ __ INY
+1435 : 4c 50 08 JMP $0850 ; (startup + 79)
+1438 : a5 1b __ LDA ACCU + 0
+143a : 05 1c __ ORA ACCU + 1
+143c : d0 de __ BNE $141c
+143e : c8 __ __ INY
+143f : 4c 50 08 JMP $0850 ; (startup + 79)
+1442 : a5 1c __ LDA ACCU + 1
+1444 : 30 04 __ BMI $144a
+1446 : 05 1b __ ORA ACCU + 0
+1448 : d0 d2 __ BNE $141c
+144a : c8 __ __ INY
+144b : 4c 50 08 JMP $0850 ; (startup + 79)
+144e : a5 1c __ LDA ACCU + 1
+1450 : 10 ca __ BPL $141c
+1452 : c8 __ __ INY
+1453 : 4c 50 08 JMP $0850 ; (startup + 79)
+1456 : a5 1c __ LDA ACCU + 1
+1458 : 30 c2 __ BMI $141c
+145a : c8 __ __ INY
+145b : 4c 50 08 JMP $0850 ; (startup + 79)
+145e : a5 1c __ LDA ACCU + 1
+1460 : 30 ba __ BMI $141c
+1462 : 05 1b __ ORA ACCU + 0
+1464 : f0 b6 __ BEQ $141c
+1466 : c8 __ __ INY
+1467 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+146a : b1 19 __ LDA (IP + 0),y
+146c : 8d 80 14 STA $1480 ; (inp_jsr + 22)
+146f : c8 __ __ INY
+1470 : b1 19 __ LDA (IP + 0),y
+1472 : 8d 81 14 STA $1481 ; (inp_jsr + 23)
+1475 : 98 __ __ TYA
+1476 : 38 __ __ SEC
+1477 : 65 19 __ ADC IP + 0
+1479 : 85 19 __ STA IP + 0
+147b : 90 02 __ BCC $147f
+147d : e6 1a __ INC IP + 1
+147f : 20 00 00 JSR $0000 
+1482 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+1485 : 98 __ __ TYA
+1486 : 18 __ __ CLC
+1487 : 65 19 __ ADC IP + 0
+1489 : 8d 94 14 STA $1494 ; (inp_native + 15)
+148c : a5 1a __ LDA IP + 1
+148e : 69 00 __ ADC #$00
+1490 : 8d 95 14 STA $1495 ; (inp_native + 16)
+1493 : 20 00 00 JSR $0000 
+1496 : a0 00 __ LDY #$00
+1498 : b1 23 __ LDA (SP + 0),y
+149a : 85 19 __ STA IP + 0
+149c : c8 __ __ INY
+149d : b1 23 __ LDA (SP + 0),y
+149f : 85 1a __ STA IP + 1
+14a1 : 88 __ __ DEY
+14a2 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+14a5 : 38 __ __ SEC
+14a6 : a5 23 __ LDA SP + 0
+14a8 : f1 19 __ SBC (IP + 0),y
+14aa : c8 __ __ INY
+14ab : 85 23 __ STA SP + 0
+14ad : a5 24 __ LDA SP + 1
+14af : f1 19 __ SBC (IP + 0),y
+14b1 : c8 __ __ INY
+14b2 : 85 24 __ STA SP + 1
+14b4 : b1 19 __ LDA (IP + 0),y
+14b6 : 84 02 __ STY $02
+14b8 : a8 __ __ TAY
+14b9 : a5 25 __ LDA FP + 0
+14bb : 91 23 __ STA (SP + 0),y
+14bd : c8 __ __ INY
+14be : a5 26 __ LDA FP + 1
+14c0 : 91 23 __ STA (SP + 0),y
+14c2 : 98 __ __ TYA
+14c3 : 38 __ __ SEC
+14c4 : 65 23 __ ADC SP + 0
+14c6 : 85 25 __ STA FP + 0
+14c8 : a9 00 __ LDA #$00
+14ca : 65 24 __ ADC SP + 1
+14cc : 85 26 __ STA FP + 1
+14ce : 88 __ __ DEY
+14cf : f0 08 __ BEQ $14d9
+14d1 : b9 52 00 LDA $0052,y 
+14d4 : 88 __ __ DEY
+14d5 : 91 23 __ STA (SP + 0),y
+14d7 : d0 f8 __ BNE $14d1
+14d9 : a4 02 __ LDY $02
+14db : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+14de : b1 19 __ LDA (IP + 0),y
+14e0 : c8 __ __ INY
+14e1 : 84 02 __ STY $02
+14e3 : a8 __ __ TAY
+14e4 : b1 23 __ LDA (SP + 0),y
+14e6 : 85 25 __ STA FP + 0
+14e8 : c8 __ __ INY
+14e9 : b1 23 __ LDA (SP + 0),y
+14eb : 85 26 __ STA FP + 1
+14ed : 88 __ __ DEY
+14ee : f0 09 __ BEQ $14f9
+14f0 : 88 __ __ DEY
+14f1 : b1 23 __ LDA (SP + 0),y
+14f3 : 99 53 00 STA $0053,y 
+14f6 : 88 __ __ DEY
+14f7 : 10 f8 __ BPL $14f1
+14f9 : a4 02 __ LDY $02
+14fb : 18 __ __ CLC
+14fc : b1 19 __ LDA (IP + 0),y
+14fe : c8 __ __ INY
+14ff : 65 23 __ ADC SP + 0
+1501 : 85 23 __ STA SP + 0
+1503 : b1 19 __ LDA (IP + 0),y
+1505 : c8 __ __ INY
+1506 : 65 24 __ ADC SP + 1
+1508 : 85 24 __ STA SP + 1
+150a : a0 01 __ LDY #$01
+150c : b1 23 __ LDA (SP + 0),y
+150e : 85 1a __ STA IP + 1
+1510 : 88 __ __ DEY
+1511 : b1 23 __ LDA (SP + 0),y
+1513 : 85 19 __ STA IP + 0
+1515 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+1518 : b1 19 __ LDA (IP + 0),y
+151a : 85 1f __ STA ADDR + 0
+151c : c8 __ __ INY
+151d : b1 19 __ LDA (IP + 0),y
+151f : 85 20 __ STA ADDR + 1
+1521 : c8 __ __ INY
+1522 : 98 __ __ TYA
+1523 : a0 00 __ LDY #$00
+1525 : 18 __ __ CLC
+1526 : 65 19 __ ADC IP + 0
+1528 : 91 23 __ STA (SP + 0),y
+152a : c8 __ __ INY
+152b : a5 1a __ LDA IP + 1
+152d : 69 00 __ ADC #$00
+152f : 91 23 __ STA (SP + 0),y
+1531 : a5 1f __ LDA ADDR + 0
+1533 : 85 19 __ STA IP + 0
+1535 : a5 20 __ LDA ADDR + 1
+1537 : 85 1a __ STA IP + 1
+1539 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+153c : 38 __ __ SEC
+153d : a5 23 __ LDA SP + 0
+153f : f1 19 __ SBC (IP + 0),y
+1541 : c8 __ __ INY
+1542 : 85 23 __ STA SP + 0
+1544 : a5 24 __ LDA SP + 1
+1546 : f1 19 __ SBC (IP + 0),y
+1548 : 85 24 __ STA SP + 1
+154a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+154d : 18 __ __ CLC
+154e : b1 19 __ LDA (IP + 0),y
+1550 : c8 __ __ INY
+1551 : 65 23 __ ADC SP + 0
+1553 : 85 23 __ STA SP + 0
+1555 : b1 19 __ LDA (IP + 0),y
+1557 : 65 24 __ ADC SP + 1
+1559 : 85 24 __ STA SP + 1
+155b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+155e : b1 19 __ LDA (IP + 0),y
+1560 : 84 02 __ STY $02
+1562 : a8 __ __ TAY
+1563 : 88 __ __ DEY
+1564 : f0 07 __ BEQ $156d
+1566 : b1 1b __ LDA (ACCU + 0),y
+1568 : 91 1f __ STA (ADDR + 0),y
+156a : 88 __ __ DEY
+156b : d0 f9 __ BNE $1566
+156d : b1 1b __ LDA (ACCU + 0),y
+156f : 91 1f __ STA (ADDR + 0),y
+1571 : a4 02 __ LDY $02
+1573 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+1576 : 84 02 __ STY $02
+1578 : a0 ff __ LDY #$ff
+157a : c8 __ __ INY
+157b : b1 1b __ LDA (ACCU + 0),y
+157d : 91 1f __ STA (ADDR + 0),y
+157f : d0 f9 __ BNE $157a
+1581 : a4 02 __ LDY $02
+1583 : 4c 51 08 JMP $0851 ; (startup + 80)
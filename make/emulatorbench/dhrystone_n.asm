@@ -0,0 +1,1273 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e bc 12 STX $12bc ; (spentry + 0)
+0811 : a9 bd __ LDA #$bd
+0813 : 85 19 __ STA IP + 0
+0815 : a9 12 __ LDA #$12
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 26 __ LDA #$26
+081c : e9 12 __ SBC #$12
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 fc __ LDA #$fc
+0832 : e9 bd __ SBC #$bd
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c ae 11 JMP $11ae ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 4a __ SBC #$4a
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 07 __ LDY #$07
+090f : a5 25 __ LDA FP + 0
+0911 : 91 23 __ STA (SP + 0),y
+0913 : c8 __ __ INY
+0914 : a5 26 __ LDA FP + 1
+0916 : 91 23 __ STA (SP + 0),y
+0918 : 88 __ __ DEY
+0919 : 88 __ __ DEY
+091a : b9 53 00 LDA $0053,y 
+091d : 91 23 __ STA (SP + 0),y
+091f : 88 __ __ DEY
+0920 : 10 f8 __ BPL $091a
+0922 : 18 __ __ CLC
+0923 : a5 23 __ LDA SP + 0
+0925 : 69 09 __ ADC #$09
+0927 : 85 25 __ STA FP + 0
+0929 : a5 24 __ LDA SP + 1
+092b : 69 00 __ ADC #$00
+092d : 85 26 __ STA FP + 1
+092f : 38 __ __ SEC
+0930 : a5 23 __ LDA SP + 0
+0932 : e9 04 __ SBC #$04
+0934 : 85 23 __ STA SP + 0
+0936 : a5 24 __ LDA SP + 1
+0938 : e9 00 __ SBC #$00
+093a : 85 24 __ STA SP + 1
+093c : a9 bd __ LDA #$bd
+093e : 8d e2 12 STA $12e2 ; (Next_Ptr_Glob + 0)
+0941 : a9 12 __ LDA #$12
+0943 : 8d e3 12 STA $12e3 ; (Next_Ptr_Glob + 1)
+0946 : a9 e4 __ LDA #$e4
+0948 : 8d 09 13 STA $1309 ; (Ptr_Glob + 0)
+094b : a9 12 __ LDA #$12
+094d : 8d 0a 13 STA $130a ; (Ptr_Glob + 1)
+0950 : a9 bd __ LDA #$bd
+0952 : 8d e4 12 STA $12e4 ; (Glob_Rec + 0)
+0955 : a9 12 __ LDA #$12
+0957 : 8d e5 12 STA $12e5 ; (Glob_Rec + 1)
+095a : a9 00 __ LDA #$00
+095c : 8d e6 12 STA $12e6 ; (Glob_Rec + 2)
+095f : a9 02 __ LDA #$02
+0961 : 8d e7 12 STA $12e7 ; (Glob_Rec + 3)
+0964 : a9 28 __ LDA #$28
+0966 : 8d e8 12 STA $12e8 ; (Glob_Rec + 4)
+0969 : a9 00 __ LDA #$00
+096b : 8d e9 12 STA $12e9 ; (Glob_Rec + 5)
+096e : a0 ff __ LDY #$ff
+0970 : c8 __ __ INY
+0971 : b9 ec 0f LDA $0fec,y 
+0974 : 99 ea 12 STA $12ea,y ; (Glob_Rec + 6)
+0977 : d0 f7 __ BNE $0970
+0979 : 18 __ __ CLC
+097a : a5 25 __ LDA FP + 0
+097c : 69 03 __ ADC #$03
+097e : 85 4a __ STA T0 + 0
+0980 : a5 26 __ LDA FP + 1
+0982 : 69 00 __ ADC #$00
+0984 : 85 4b __ STA T0 + 1
+0986 : a0 ff __ LDY #$ff
+0988 : c8 __ __ INY
+0989 : b9 0b 10 LDA $100b,y 
+098c : 91 4a __ STA (T0 + 0),y
+098e : d0 f8 __ BNE $0988
+0990 : a9 0a __ LDA #$0a
+0992 : 8d 39 16 STA $1639 ; (Arr_2_Glob + 814)
+0995 : a9 00 __ LDA #$00
+0997 : 8d 3a 16 STA $163a ; (Arr_2_Glob + 815)
+099a : a9 01 __ LDA #$01
+099c : 85 4a __ STA T0 + 0
+099e : a9 00 __ LDA #$00
+09a0 : 85 4b __ STA T0 + 1
+09a2 : a9 41 __ LDA #$41
+09a4 : 8d 93 26 STA $2693 ; (Ch_1_Glob + 0)
+09a7 : a9 01 __ LDA #$01
+09a9 : 8d 94 26 STA $2694 ; (Bool_Glob + 0)
+09ac : a9 42 __ LDA #$42
+09ae : 8d 95 26 STA $2695 ; (Ch_2_Glob + 0)
+09b1 : 18 __ __ CLC
+09b2 : a5 25 __ LDA FP + 0
+09b4 : 69 22 __ ADC #$22
+09b6 : 85 4c __ STA T1 + 0
+09b8 : a5 26 __ LDA FP + 1
+09ba : 69 00 __ ADC #$00
+09bc : 85 4d __ STA T1 + 1
+09be : a0 ff __ LDY #$ff
+09c0 : c8 __ __ INY
+09c1 : b9 2a 10 LDA $102a,y 
+09c4 : 91 4c __ STA (T1 + 0),y
+09c6 : d0 f8 __ BNE $09c0
+09c8 : a9 01 __ LDA #$01
+09ca : a0 02 __ LDY #$02
+09cc : 91 25 __ STA (FP + 0),y
+09ce : a9 02 __ LDA #$02
+09d0 : 85 4c __ STA T1 + 0
+09d2 : a9 00 __ LDA #$00
+09d4 : 85 4d __ STA T1 + 1
+09d6 : a9 03 __ LDA #$03
+09d8 : 85 4e __ STA T2 + 0
+09da : a9 00 __ LDA #$00
+09dc : 85 4f __ STA T2 + 1
+09de : 18 __ __ CLC
+09df : a5 25 __ LDA FP + 0
+09e1 : 69 03 __ ADC #$03
+09e3 : 85 50 __ STA T3 + 0
+09e5 : a5 26 __ LDA FP + 1
+09e7 : 69 00 __ ADC #$00
+09e9 : 85 51 __ STA T3 + 1
+09eb : 18 __ __ CLC
+09ec : a5 25 __ LDA FP + 0
+09ee : 69 22 __ ADC #$22
+09f0 : 85 53 __ STA T4 + 0
+09f2 : a5 26 __ LDA FP + 1
+09f4 : 69 00 __ ADC #$00
+09f6 : 85 54 __ STA T4 + 1
+09f8 : a9 02 __ LDA #$02
+09fa : 85 55 __ STA T5 + 0
+09fc : a9 00 __ LDA #$00
+09fe : 85 56 __ STA T5 + 1
+0a00 : 18 __ __ CLC
+0a01 : a5 50 __ LDA T3 + 0
+0a03 : 65 55 __ ADC T5 + 0
+0a05 : 85 43 __ STA T7 + 0
+0a07 : a5 51 __ LDA T3 + 1
+0a09 : 65 56 __ ADC T5 + 1
+0a0b : 85 44 __ STA T7 + 1
+0a0d : a0 00 __ LDY #$00
+0a0f : b1 43 __ LDA (T7 + 0),y
+0a11 : 85 0d __ STA P0
+0a13 : 18 __ __ CLC
+0a14 : a5 53 __ LDA T4 + 0
+0a16 : 65 55 __ ADC T5 + 0
+0a18 : 85 43 __ STA T7 + 0
+0a1a : a5 54 __ LDA T4 + 1
+0a1c : 65 56 __ ADC T5 + 1
+0a1e : 85 44 __ STA T7 + 1
+0a20 : c8 __ __ INY
+0a21 : b1 43 __ LDA (T7 + 0),y
+0a23 : 85 0e __ STA P1
+0a25 : 20 49 10 JSR $1049 ; (Func_1 + 0)
+0a28 : a5 1b __ LDA ACCU + 0
+0a2a : d0 06 __ BNE $0a32
+0a2c : e6 55 __ INC T5 + 0
+0a2e : d0 02 __ BNE $0a32
+0a30 : e6 56 __ INC T5 + 1
+0a32 : a5 56 __ LDA T5 + 1
+0a34 : 30 ca __ BMI $0a00
+0a36 : d0 06 __ BNE $0a3e
+0a38 : a9 02 __ LDA #$02
+0a3a : c5 55 __ CMP T5 + 0
+0a3c : b0 c2 __ BCS $0a00
+0a3e : a5 50 __ LDA T3 + 0
+0a40 : 85 0d __ STA P0
+0a42 : a5 51 __ LDA T3 + 1
+0a44 : 85 0e __ STA P1
+0a46 : a5 53 __ LDA T4 + 0
+0a48 : 85 0f __ STA P2
+0a4a : a5 54 __ LDA T4 + 1
+0a4c : 85 10 __ STA P3
+0a4e : 20 62 10 JSR $1062 ; (strcmp + 0)
+0a51 : a5 1c __ LDA ACCU + 1
+0a53 : 30 07 __ BMI $0a5c
+0a55 : 05 1b __ ORA ACCU + 0
+0a57 : f0 03 __ BEQ $0a5c
+0a59 : 4c d8 0f JMP $0fd8 ; (main + 1752)
+0a5c : a9 01 __ LDA #$01
+0a5e : 8d 94 26 STA $2694 ; (Bool_Glob + 0)
+0a61 : a5 25 __ LDA FP + 0
+0a63 : 85 50 __ STA T3 + 0
+0a65 : a5 26 __ LDA FP + 1
+0a67 : 85 51 __ STA T3 + 1
+0a69 : a5 4c __ LDA T1 + 0
+0a6b : 85 0d __ STA P0
+0a6d : 0a __ __ ASL
+0a6e : 85 07 __ STA $07
+0a70 : a5 4d __ LDA T1 + 1
+0a72 : 85 0e __ STA P1
+0a74 : 2a __ __ ROL
+0a75 : 06 07 __ ASL $07
+0a77 : 2a __ __ ROL
+0a78 : aa __ __ TAX
+0a79 : 18 __ __ CLC
+0a7a : a5 07 __ LDA $07
+0a7c : 65 4c __ ADC T1 + 0
+0a7e : 85 1b __ STA ACCU + 0
+0a80 : 8a __ __ TXA
+0a81 : 65 4d __ ADC T1 + 1
+0a83 : 85 1c __ STA ACCU + 1
+0a85 : 38 __ __ SEC
+0a86 : a5 1b __ LDA ACCU + 0
+0a88 : e9 03 __ SBC #$03
+0a8a : a0 00 __ LDY #$00
+0a8c : 91 25 __ STA (FP + 0),y
+0a8e : a5 1c __ LDA ACCU + 1
+0a90 : e9 00 __ SBC #$00
+0a92 : c8 __ __ INY
+0a93 : 91 25 __ STA (FP + 0),y
+0a95 : a9 03 __ LDA #$03
+0a97 : 85 0f __ STA P2
+0a99 : a9 00 __ LDA #$00
+0a9b : 85 10 __ STA P3
+0a9d : a5 50 __ LDA T3 + 0
+0a9f : 85 11 __ STA P4
+0aa1 : a5 51 __ LDA T3 + 1
+0aa3 : 85 12 __ STA P5
+0aa5 : 20 91 10 JSR $1091 ; (Proc_7 + 0)
+0aa8 : e6 4c __ INC T1 + 0
+0aaa : d0 02 __ BNE $0aae
+0aac : e6 4d __ INC T1 + 1
+0aae : a5 4d __ LDA T1 + 1
+0ab0 : 49 80 __ EOR #$80
+0ab2 : c9 80 __ CMP #$80
+0ab4 : d0 04 __ BNE $0aba
+0ab6 : a5 4c __ LDA T1 + 0
+0ab8 : c9 03 __ CMP #$03
+0aba : 90 ad __ BCC $0a69
+0abc : a5 4c __ LDA T1 + 0
+0abe : 0a __ __ ASL
+0abf : 85 50 __ STA T3 + 0
+0ac1 : a0 00 __ LDY #$00
+0ac3 : b1 25 __ LDA (FP + 0),y
+0ac5 : aa __ __ TAX
+0ac6 : c8 __ __ INY
+0ac7 : b1 25 __ LDA (FP + 0),y
+0ac9 : 85 56 __ STA T5 + 1
+0acb : 8a __ __ TXA
+0acc : a4 50 __ LDY T3 + 0
+0ace : 99 a2 26 STA $26a2,y ; (Arr_1_Glob + 10)
+0ad1 : a5 56 __ LDA T5 + 1
+0ad3 : 99 a3 26 STA $26a3,y ; (Arr_1_Glob + 11)
+0ad6 : 8a __ __ TXA
+0ad7 : 99 a4 26 STA $26a4,y ; (Arr_1_Glob + 12)
+0ada : a5 56 __ LDA T5 + 1
+0adc : 99 a5 26 STA $26a5,y ; (Arr_1_Glob + 13)
+0adf : 18 __ __ CLC
+0ae0 : a5 4c __ LDA T1 + 0
+0ae2 : 69 05 __ ADC #$05
+0ae4 : 85 53 __ STA T4 + 0
+0ae6 : 99 de 26 STA $26de,y ; (Arr_1_Glob + 70)
+0ae9 : a5 4d __ LDA T1 + 1
+0aeb : 69 00 __ ADC #$00
+0aed : 85 54 __ STA T4 + 1
+0aef : 99 df 26 STA $26df,y ; (Arr_1_Glob + 71)
+0af2 : 18 __ __ CLC
+0af3 : a5 4c __ LDA T1 + 0
+0af5 : 69 06 __ ADC #$06
+0af7 : 85 43 __ STA T7 + 0
+0af9 : a5 4d __ LDA T1 + 1
+0afb : 69 00 __ ADC #$00
+0afd : aa __ __ TAX
+0afe : a5 54 __ LDA T4 + 1
+0b00 : 49 80 __ EOR #$80
+0b02 : 85 03 __ STA $03
+0b04 : 8a __ __ TXA
+0b05 : 49 80 __ EOR #$80
+0b07 : c5 03 __ CMP $03
+0b09 : d0 04 __ BNE $0b0f
+0b0b : a5 43 __ LDA T7 + 0
+0b0d : c5 53 __ CMP T4 + 0
+0b0f : b0 03 __ BCS $0b14
+0b11 : 4c 99 0b JMP $0b99 ; (main + 665)
+0b14 : a5 53 __ LDA T4 + 0
+0b16 : 85 43 __ STA T7 + 0
+0b18 : a5 54 __ LDA T4 + 1
+0b1a : 85 44 __ STA T7 + 1
+0b1c : 18 __ __ CLC
+0b1d : a5 53 __ LDA T4 + 0
+0b1f : 69 01 __ ADC #$01
+0b21 : 85 45 __ STA T9 + 0
+0b23 : a5 54 __ LDA T4 + 1
+0b25 : 69 00 __ ADC #$00
+0b27 : 85 46 __ STA T9 + 1
+0b29 : a5 53 __ LDA T4 + 0
+0b2b : 0a __ __ ASL
+0b2c : aa __ __ TAX
+0b2d : a5 54 __ LDA T4 + 1
+0b2f : 2a __ __ ROL
+0b30 : a8 __ __ TAY
+0b31 : 18 __ __ CLC
+0b32 : 8a __ __ TXA
+0b33 : 65 53 __ ADC T4 + 0
+0b35 : aa __ __ TAX
+0b36 : 98 __ __ TYA
+0b37 : 65 54 __ ADC T4 + 1
+0b39 : 85 03 __ STA $03
+0b3b : 8a __ __ TXA
+0b3c : 0a __ __ ASL
+0b3d : 26 03 __ ROL $03
+0b3f : 0a __ __ ASL
+0b40 : 26 03 __ ROL $03
+0b42 : 0a __ __ ASL
+0b43 : 26 03 __ ROL $03
+0b45 : 18 __ __ CLC
+0b46 : 65 53 __ ADC T4 + 0
+0b48 : 85 1b __ STA ACCU + 0
+0b4a : a5 03 __ LDA $03
+0b4c : 65 54 __ ADC T4 + 1
+0b4e : 06 1b __ ASL ACCU + 0
+0b50 : 2a __ __ ROL
+0b51 : 85 48 __ STA T10 + 1
+0b53 : a5 1b __ LDA ACCU + 0
+0b55 : 85 47 __ STA T10 + 0
+0b57 : 18 __ __ CLC
+0b58 : a5 47 __ LDA T10 + 0
+0b5a : 65 43 __ ADC T7 + 0
+0b5c : 85 58 __ STA T11 + 0
+0b5e : a5 48 __ LDA T10 + 1
+0b60 : 65 44 __ ADC T7 + 1
+0b62 : 06 58 __ ASL T11 + 0
+0b64 : 2a __ __ ROL
+0b65 : 85 59 __ STA T11 + 1
+0b67 : 18 __ __ CLC
+0b68 : a9 0b __ LDA #$0b
+0b6a : 65 58 __ ADC T11 + 0
+0b6c : 85 58 __ STA T11 + 0
+0b6e : a9 13 __ LDA #$13
+0b70 : 65 59 __ ADC T11 + 1
+0b72 : 85 59 __ STA T11 + 1
+0b74 : a5 53 __ LDA T4 + 0
+0b76 : a0 00 __ LDY #$00
+0b78 : 91 58 __ STA (T11 + 0),y
+0b7a : a5 54 __ LDA T4 + 1
+0b7c : c8 __ __ INY
+0b7d : 91 58 __ STA (T11 + 0),y
+0b7f : e6 43 __ INC T7 + 0
+0b81 : d0 02 __ BNE $0b85
+0b83 : e6 44 __ INC T7 + 1
+0b85 : a5 44 __ LDA T7 + 1
+0b87 : 49 80 __ EOR #$80
+0b89 : 85 03 __ STA $03
+0b8b : a5 46 __ LDA T9 + 1
+0b8d : 49 80 __ EOR #$80
+0b8f : c5 03 __ CMP $03
+0b91 : d0 04 __ BNE $0b97
+0b93 : a5 45 __ LDA T9 + 0
+0b95 : c5 43 __ CMP T7 + 0
+0b97 : b0 be __ BCS $0b57
+0b99 : a5 53 __ LDA T4 + 0
+0b9b : 0a __ __ ASL
+0b9c : aa __ __ TAX
+0b9d : a5 54 __ LDA T4 + 1
+0b9f : 2a __ __ ROL
+0ba0 : a8 __ __ TAY
+0ba1 : 18 __ __ CLC
+0ba2 : 8a __ __ TXA
+0ba3 : 65 53 __ ADC T4 + 0
+0ba5 : aa __ __ TAX
+0ba6 : 98 __ __ TYA
+0ba7 : 65 54 __ ADC T4 + 1
+0ba9 : 85 03 __ STA $03
+0bab : 8a __ __ TXA
+0bac : 0a __ __ ASL
+0bad : 26 03 __ ROL $03
+0baf : 0a __ __ ASL
+0bb0 : 26 03 __ ROL $03
+0bb2 : 0a __ __ ASL
+0bb3 : 26 03 __ ROL $03
+0bb5 : 18 __ __ CLC
+0bb6 : 65 53 __ ADC T4 + 0
+0bb8 : 85 1b __ STA ACCU + 0
+0bba : a5 03 __ LDA $03
+0bbc : 65 54 __ ADC T4 + 1
+0bbe : 06 1b __ ASL ACCU + 0
+0bc0 : 2a __ __ ROL
+0bc1 : 85 1c __ STA ACCU + 1
+0bc3 : 18 __ __ CLC
+0bc4 : a5 1b __ LDA ACCU + 0
+0bc6 : 65 53 __ ADC T4 + 0
+0bc8 : aa __ __ TAX
+0bc9 : a5 1c __ LDA ACCU + 1
+0bcb : 65 54 __ ADC T4 + 1
+0bcd : a8 __ __ TAY
+0bce : 38 __ __ SEC
+0bcf : 8a __ __ TXA
+0bd0 : e9 01 __ SBC #$01
+0bd2 : 85 43 __ STA T7 + 0
+0bd4 : 98 __ __ TYA
+0bd5 : e9 00 __ SBC #$00
+0bd7 : 06 43 __ ASL T7 + 0
+0bd9 : 2a __ __ ROL
+0bda : 85 44 __ STA T7 + 1
+0bdc : 18 __ __ CLC
+0bdd : a9 0b __ LDA #$0b
+0bdf : 65 43 __ ADC T7 + 0
+0be1 : 85 43 __ STA T7 + 0
+0be3 : a9 13 __ LDA #$13
+0be5 : 65 44 __ ADC T7 + 1
+0be7 : 85 44 __ STA T7 + 1
+0be9 : 18 __ __ CLC
+0bea : a0 00 __ LDY #$00
+0bec : b1 43 __ LDA (T7 + 0),y
+0bee : 69 01 __ ADC #$01
+0bf0 : 91 43 __ STA (T7 + 0),y
+0bf2 : c8 __ __ INY
+0bf3 : b1 43 __ LDA (T7 + 0),y
+0bf5 : 69 00 __ ADC #$00
+0bf7 : 91 43 __ STA (T7 + 0),y
+0bf9 : a5 53 __ LDA T4 + 0
+0bfb : 0a __ __ ASL
+0bfc : 85 43 __ STA T7 + 0
+0bfe : a5 54 __ LDA T4 + 1
+0c00 : 2a __ __ ROL
+0c01 : 85 44 __ STA T7 + 1
+0c03 : 18 __ __ CLC
+0c04 : a9 98 __ LDA #$98
+0c06 : 65 43 __ ADC T7 + 0
+0c08 : 85 50 __ STA T3 + 0
+0c0a : a9 26 __ LDA #$26
+0c0c : 65 44 __ ADC T7 + 1
+0c0e : 85 51 __ STA T3 + 1
+0c10 : 18 __ __ CLC
+0c11 : a5 53 __ LDA T4 + 0
+0c13 : 69 14 __ ADC #$14
+0c15 : 85 43 __ STA T7 + 0
+0c17 : a5 54 __ LDA T4 + 1
+0c19 : 69 00 __ ADC #$00
+0c1b : 85 44 __ STA T7 + 1
+0c1d : a5 43 __ LDA T7 + 0
+0c1f : 0a __ __ ASL
+0c20 : aa __ __ TAX
+0c21 : a5 44 __ LDA T7 + 1
+0c23 : 2a __ __ ROL
+0c24 : a8 __ __ TAY
+0c25 : 18 __ __ CLC
+0c26 : 8a __ __ TXA
+0c27 : 65 43 __ ADC T7 + 0
+0c29 : aa __ __ TAX
+0c2a : 98 __ __ TYA
+0c2b : 65 44 __ ADC T7 + 1
+0c2d : 85 03 __ STA $03
+0c2f : 8a __ __ TXA
+0c30 : 0a __ __ ASL
+0c31 : 26 03 __ ROL $03
+0c33 : 0a __ __ ASL
+0c34 : 26 03 __ ROL $03
+0c36 : 0a __ __ ASL
+0c37 : 26 03 __ ROL $03
+0c39 : 18 __ __ CLC
+0c3a : 65 43 __ ADC T7 + 0
+0c3c : 85 1b __ STA ACCU + 0
+0c3e : a5 03 __ LDA $03
+0c40 : 65 44 __ ADC T7 + 1
+0c42 : 06 1b __ ASL ACCU + 0
+0c44 : 2a __ __ ROL
+0c45 : 85 1c __ STA ACCU + 1
+0c47 : 18 __ __ CLC
+0c48 : a5 1b __ LDA ACCU + 0
+0c4a : 65 53 __ ADC T4 + 0
+0c4c : 85 53 __ STA T4 + 0
+0c4e : a5 1c __ LDA ACCU + 1
+0c50 : 65 54 __ ADC T4 + 1
+0c52 : 06 53 __ ASL T4 + 0
+0c54 : 2a __ __ ROL
+0c55 : 85 54 __ STA T4 + 1
+0c57 : 18 __ __ CLC
+0c58 : a9 0b __ LDA #$0b
+0c5a : 65 53 __ ADC T4 + 0
+0c5c : 85 53 __ STA T4 + 0
+0c5e : a9 13 __ LDA #$13
+0c60 : 65 54 __ ADC T4 + 1
+0c62 : 85 54 __ STA T4 + 1
+0c64 : a0 00 __ LDY #$00
+0c66 : b1 50 __ LDA (T3 + 0),y
+0c68 : 91 53 __ STA (T4 + 0),y
+0c6a : c8 __ __ INY
+0c6b : b1 50 __ LDA (T3 + 0),y
+0c6d : 91 53 __ STA (T4 + 0),y
+0c6f : a9 05 __ LDA #$05
+0c71 : 8d 96 26 STA $2696 ; (Int_Glob + 0)
+0c74 : a9 00 __ LDA #$00
+0c76 : 8d 97 26 STA $2697 ; (Int_Glob + 1)
+0c79 : ad 09 13 LDA $1309 ; (Ptr_Glob + 0)
+0c7c : 85 50 __ STA T3 + 0
+0c7e : ad 0a 13 LDA $130a ; (Ptr_Glob + 1)
+0c81 : 85 51 __ STA T3 + 1
+0c83 : 88 __ __ DEY
+0c84 : b1 50 __ LDA (T3 + 0),y
+0c86 : 85 53 __ STA T4 + 0
+0c88 : c8 __ __ INY
+0c89 : b1 50 __ LDA (T3 + 0),y
+0c8b : 85 54 __ STA T4 + 1
+0c8d : 88 __ __ DEY
+0c8e : b1 50 __ LDA (T3 + 0),y
+0c90 : 85 55 __ STA T5 + 0
+0c92 : c8 __ __ INY
+0c93 : b1 50 __ LDA (T3 + 0),y
+0c95 : 85 56 __ STA T5 + 1
+0c97 : a0 24 __ LDY #$24
+0c99 : b1 50 __ LDA (T3 + 0),y
+0c9b : 91 55 __ STA (T5 + 0),y
+0c9d : 88 __ __ DEY
+0c9e : 10 f9 __ BPL $0c99
+0ca0 : a9 05 __ LDA #$05
+0ca2 : a0 04 __ LDY #$04
+0ca4 : 91 50 __ STA (T3 + 0),y
+0ca6 : a9 00 __ LDA #$00
+0ca8 : c8 __ __ INY
+0ca9 : 91 50 __ STA (T3 + 0),y
+0cab : a9 05 __ LDA #$05
+0cad : 88 __ __ DEY
+0cae : 91 53 __ STA (T4 + 0),y
+0cb0 : a9 00 __ LDA #$00
+0cb2 : c8 __ __ INY
+0cb3 : 91 53 __ STA (T4 + 0),y
+0cb5 : a0 00 __ LDY #$00
+0cb7 : b1 50 __ LDA (T3 + 0),y
+0cb9 : 91 53 __ STA (T4 + 0),y
+0cbb : c8 __ __ INY
+0cbc : b1 50 __ LDA (T3 + 0),y
+0cbe : 91 53 __ STA (T4 + 0),y
+0cc0 : a5 53 __ LDA T4 + 0
+0cc2 : c8 __ __ INY
+0cc3 : 91 23 __ STA (SP + 0),y
+0cc5 : a5 54 __ LDA T4 + 1
+0cc7 : c8 __ __ INY
+0cc8 : 91 23 __ STA (SP + 0),y
+0cca : 20 af 10 JSR $10af ; (Proc_3 + 0)
+0ccd : a0 02 __ LDY #$02
+0ccf : b1 53 __ LDA (T4 + 0),y
+0cd1 : d0 03 __ BNE $0cd6
+0cd3 : 4c 7c 0f JMP $0f7c ; (main + 1660)
+0cd6 : a0 00 __ LDY #$00
+0cd8 : b1 50 __ LDA (T3 + 0),y
+0cda : 85 53 __ STA T4 + 0
+0cdc : c8 __ __ INY
+0cdd : b1 50 __ LDA (T3 + 0),y
+0cdf : 85 54 __ STA T4 + 1
+0ce1 : a0 24 __ LDY #$24
+0ce3 : b1 53 __ LDA (T4 + 0),y
+0ce5 : 91 50 __ STA (T3 + 0),y
+0ce7 : 88 __ __ DEY
+0ce8 : 10 f9 __ BPL $0ce3
+0cea : a9 41 __ LDA #$41
+0cec : 85 52 __ STA T6 + 0
+0cee : ad 95 26 LDA $2695 ; (Ch_2_Glob + 0)
+0cf1 : c9 41 __ CMP #$41
+0cf3 : 90 23 __ BCC $0d18
+0cf5 : a0 02 __ LDY #$02
+0cf7 : b1 25 __ LDA (FP + 0),y
+0cf9 : 85 57 __ STA T8 + 0
+0cfb : a5 52 __ LDA T6 + 0
+0cfd : 85 0d __ STA P0
+0cff : a9 43 __ LDA #$43
+0d01 : 85 0e __ STA P1
+0d03 : 20 49 10 JSR $1049 ; (Func_1 + 0)
+0d06 : a5 57 __ LDA T8 + 0
+0d08 : c5 1b __ CMP ACCU + 0
+0d0a : d0 03 __ BNE $0d0f
+0d0c : 4c 40 0f JMP $0f40 ; (main + 1600)
+0d0f : ae 95 26 LDX $2695 ; (Ch_2_Glob + 0)
+0d12 : e6 52 __ INC T6 + 0
+0d14 : e4 52 __ CPX T6 + 0
+0d16 : b0 dd __ BCS $0cf5
+0d18 : ad 93 26 LDA $2693 ; (Ch_1_Glob + 0)
+0d1b : 85 52 __ STA T6 + 0
+0d1d : a5 4e __ LDA T2 + 0
+0d1f : 85 1b __ STA ACCU + 0
+0d21 : a5 4f __ LDA T2 + 1
+0d23 : 85 1c __ STA ACCU + 1
+0d25 : a5 4c __ LDA T1 + 0
+0d27 : 85 03 __ STA $03
+0d29 : a5 4d __ LDA T1 + 1
+0d2b : 85 04 __ STA $04
+0d2d : 20 bb 11 JSR $11bb ; (mul16 + 0)
+0d30 : a5 05 __ LDA $05
+0d32 : 85 1b __ STA ACCU + 0
+0d34 : 85 4c __ STA T1 + 0
+0d36 : a5 06 __ LDA $06
+0d38 : 85 1c __ STA ACCU + 1
+0d3a : 85 4d __ STA T1 + 1
+0d3c : a0 00 __ LDY #$00
+0d3e : b1 25 __ LDA (FP + 0),y
+0d40 : 85 4e __ STA T2 + 0
+0d42 : 85 03 __ STA $03
+0d44 : c8 __ __ INY
+0d45 : b1 25 __ LDA (FP + 0),y
+0d47 : 85 4f __ STA T2 + 1
+0d49 : 85 04 __ STA $04
+0d4b : 20 fd 11 JSR $11fd ; (divs16 + 0)
+0d4e : a5 1b __ LDA ACCU + 0
+0d50 : 85 50 __ STA T3 + 0
+0d52 : a5 1c __ LDA ACCU + 1
+0d54 : 85 51 __ STA T3 + 1
+0d56 : 18 __ __ CLC
+0d57 : a5 1b __ LDA ACCU + 0
+0d59 : 69 0a __ ADC #$0a
+0d5b : 85 53 __ STA T4 + 0
+0d5d : a5 1c __ LDA ACCU + 1
+0d5f : 69 00 __ ADC #$00
+0d61 : 85 54 __ STA T4 + 1
+0d63 : 38 __ __ SEC
+0d64 : a5 4c __ LDA T1 + 0
+0d66 : e5 4e __ SBC T2 + 0
+0d68 : 85 4c __ STA T1 + 0
+0d6a : a5 4d __ LDA T1 + 1
+0d6c : e5 4f __ SBC T2 + 1
+0d6e : 85 4d __ STA T1 + 1
+0d70 : a5 4c __ LDA T1 + 0
+0d72 : 0a __ __ ASL
+0d73 : 85 07 __ STA $07
+0d75 : a5 4d __ LDA T1 + 1
+0d77 : 2a __ __ ROL
+0d78 : 06 07 __ ASL $07
+0d7a : 2a __ __ ROL
+0d7b : 06 07 __ ASL $07
+0d7d : 2a __ __ ROL
+0d7e : aa __ __ TAX
+0d7f : 38 __ __ SEC
+0d80 : a5 07 __ LDA $07
+0d82 : e5 4c __ SBC T1 + 0
+0d84 : 85 1b __ STA ACCU + 0
+0d86 : 8a __ __ TXA
+0d87 : e5 4d __ SBC T1 + 1
+0d89 : 85 1c __ STA ACCU + 1
+0d8b : 38 __ __ SEC
+0d8c : a5 1b __ LDA ACCU + 0
+0d8e : e5 50 __ SBC T3 + 0
+0d90 : 85 4c __ STA T1 + 0
+0d92 : a5 1c __ LDA ACCU + 1
+0d94 : e5 51 __ SBC T3 + 1
+0d96 : 85 4d __ STA T1 + 1
+0d98 : a5 52 __ LDA T6 + 0
+0d9a : c9 41 __ CMP #$41
+0d9c : f0 07 __ BEQ $0da5
+0d9e : ad 93 26 LDA $2693 ; (Ch_1_Glob + 0)
+0da1 : c9 41 __ CMP #$41
+0da3 : d0 f9 __ BNE $0d9e
+0da5 : 38 __ __ SEC
+0da6 : a5 53 __ LDA T4 + 0
+0da8 : e9 01 __ SBC #$01
+0daa : aa __ __ TAX
+0dab : a5 54 __ LDA T4 + 1
+0dad : e9 00 __ SBC #$00
+0daf : a8 __ __ TAY
+0db0 : 38 __ __ SEC
+0db1 : 8a __ __ TXA
+0db2 : ed 96 26 SBC $2696 ; (Int_Glob + 0)
+0db5 : 85 50 __ STA T3 + 0
+0db7 : 98 __ __ TYA
+0db8 : ed 97 26 SBC $2697 ; (Int_Glob + 1)
+0dbb : 85 51 __ STA T3 + 1
+0dbd : e6 4a __ INC T0 + 0
+0dbf : d0 02 __ BNE $0dc3
+0dc1 : e6 4b __ INC T0 + 1
+0dc3 : a5 4b __ LDA T0 + 1
+0dc5 : 49 80 __ EOR #$80
+0dc7 : c9 81 __ CMP #$81
+0dc9 : d0 04 __ BNE $0dcf
+0dcb : a5 4a __ LDA T0 + 0
+0dcd : c9 f5 __ CMP #$f5
+0dcf : b0 03 __ BCS $0dd4
+0dd1 : 4c a2 09 JMP $09a2 ; (main + 162)
+0dd4 : ad 96 26 LDA $2696 ; (Int_Glob + 0)
+0dd7 : 85 4a __ STA T0 + 0
+0dd9 : ad 97 26 LDA $2697 ; (Int_Glob + 1)
+0ddc : d0 19 __ BNE $0df7
+0dde : a5 4a __ LDA T0 + 0
+0de0 : c9 05 __ CMP #$05
+0de2 : d0 13 __ BNE $0df7
+0de4 : ad 94 26 LDA $2694 ; (Bool_Glob + 0)
+0de7 : f0 0e __ BEQ $0df7
+0de9 : ad 93 26 LDA $2693 ; (Ch_1_Glob + 0)
+0dec : c9 41 __ CMP #$41
+0dee : d0 07 __ BNE $0df7
+0df0 : ad 95 26 LDA $2695 ; (Ch_2_Glob + 0)
+0df3 : c9 42 __ CMP #$42
+0df5 : f0 38 __ BEQ $0e2f
+0df7 : a9 01 __ LDA #$01
+0df9 : 85 1b __ STA ACCU + 0
+0dfb : a9 00 __ LDA #$00
+0dfd : 85 1c __ STA ACCU + 1
+0dff : 18 __ __ CLC
+0e00 : a5 23 __ LDA SP + 0
+0e02 : 69 04 __ ADC #$04
+0e04 : 85 23 __ STA SP + 0
+0e06 : a5 24 __ LDA SP + 1
+0e08 : 69 00 __ ADC #$00
+0e0a : 85 24 __ STA SP + 1
+0e0c : a0 07 __ LDY #$07
+0e0e : b1 23 __ LDA (SP + 0),y
+0e10 : 85 25 __ STA FP + 0
+0e12 : c8 __ __ INY
+0e13 : b1 23 __ LDA (SP + 0),y
+0e15 : 85 26 __ STA FP + 1
+0e17 : 88 __ __ DEY
+0e18 : 88 __ __ DEY
+0e19 : b1 23 __ LDA (SP + 0),y
+0e1b : 99 53 00 STA $0053,y 
+0e1e : 88 __ __ DEY
+0e1f : 10 f8 __ BPL $0e19
+0e21 : 18 __ __ CLC
+0e22 : a5 23 __ LDA SP + 0
+0e24 : 69 4a __ ADC #$4a
+0e26 : 85 23 __ STA SP + 0
+0e28 : a5 24 __ LDA SP + 1
+0e2a : 69 00 __ ADC #$00
+0e2c : 85 24 __ STA SP + 1
+0e2e : 60 __ __ RTS
+0e2f : ad a8 26 LDA $26a8 ; (Arr_1_Glob + 16)
+0e32 : 85 4a __ STA T0 + 0
+0e34 : ad a9 26 LDA $26a9 ; (Arr_1_Glob + 17)
+0e37 : d0 18 __ BNE $0e51
+0e39 : a5 4a __ LDA T0 + 0
+0e3b : c9 07 __ CMP #$07
+0e3d : d0 12 __ BNE $0e51
+0e3f : ad 39 16 LDA $1639 ; (Arr_2_Glob + 814)
+0e42 : 85 4a __ STA T0 + 0
+0e44 : ad 3a 16 LDA $163a ; (Arr_2_Glob + 815)
+0e47 : c9 01 __ CMP #$01
+0e49 : d0 06 __ BNE $0e51
+0e4b : a5 4a __ LDA T0 + 0
+0e4d : c9 fe __ CMP #$fe
+0e4f : f0 09 __ BEQ $0e5a
+0e51 : a9 02 __ LDA #$02
+0e53 : 85 1b __ STA ACCU + 0
+0e55 : a9 00 __ LDA #$00
+0e57 : 4c fd 0d JMP $0dfd ; (main + 1277)
+0e5a : ad 09 13 LDA $1309 ; (Ptr_Glob + 0)
+0e5d : 85 4a __ STA T0 + 0
+0e5f : ad 0a 13 LDA $130a ; (Ptr_Glob + 1)
+0e62 : 85 4b __ STA T0 + 1
+0e64 : a0 02 __ LDY #$02
+0e66 : b1 4a __ LDA (T0 + 0),y
+0e68 : d0 19 __ BNE $0e83
+0e6a : a0 03 __ LDY #$03
+0e6c : b1 4a __ LDA (T0 + 0),y
+0e6e : c9 02 __ CMP #$02
+0e70 : d0 11 __ BNE $0e83
+0e72 : a0 04 __ LDY #$04
+0e74 : b1 4a __ LDA (T0 + 0),y
+0e76 : 85 4e __ STA T2 + 0
+0e78 : c8 __ __ INY
+0e79 : b1 4a __ LDA (T0 + 0),y
+0e7b : d0 06 __ BNE $0e83
+0e7d : a5 4e __ LDA T2 + 0
+0e7f : c9 11 __ CMP #$11
+0e81 : f0 09 __ BEQ $0e8c
+0e83 : a9 03 __ LDA #$03
+0e85 : 85 1b __ STA ACCU + 0
+0e87 : a9 00 __ LDA #$00
+0e89 : 4c fd 0d JMP $0dfd ; (main + 1277)
+0e8c : ad e2 12 LDA $12e2 ; (Next_Ptr_Glob + 0)
+0e8f : 85 4e __ STA T2 + 0
+0e91 : ad e3 12 LDA $12e3 ; (Next_Ptr_Glob + 1)
+0e94 : 85 4f __ STA T2 + 1
+0e96 : a0 02 __ LDY #$02
+0e98 : b1 4e __ LDA (T2 + 0),y
+0e9a : d0 19 __ BNE $0eb5
+0e9c : a0 03 __ LDY #$03
+0e9e : b1 4e __ LDA (T2 + 0),y
+0ea0 : c9 01 __ CMP #$01
+0ea2 : d0 11 __ BNE $0eb5
+0ea4 : a0 04 __ LDY #$04
+0ea6 : b1 4e __ LDA (T2 + 0),y
+0ea8 : 85 02 __ STA $02
+0eaa : c8 __ __ INY
+0eab : b1 4e __ LDA (T2 + 0),y
+0ead : d0 06 __ BNE $0eb5
+0eaf : a5 02 __ LDA $02
+0eb1 : c9 12 __ CMP #$12
+0eb3 : f0 09 __ BEQ $0ebe
+0eb5 : a9 04 __ LDA #$04
+0eb7 : 85 1b __ STA ACCU + 0
+0eb9 : a9 00 __ LDA #$00
+0ebb : 4c fd 0d JMP $0dfd ; (main + 1277)
+0ebe : a5 51 __ LDA T3 + 1
+0ec0 : d0 29 __ BNE $0eeb
+0ec2 : a5 50 __ LDA T3 + 0
+0ec4 : c9 05 __ CMP #$05
+0ec6 : d0 23 __ BNE $0eeb
+0ec8 : a5 4d __ LDA T1 + 1
+0eca : d0 1f __ BNE $0eeb
+0ecc : a5 4c __ LDA T1 + 0
+0ece : c9 0d __ CMP #$0d
+0ed0 : d0 19 __ BNE $0eeb
+0ed2 : a0 00 __ LDY #$00
+0ed4 : b1 25 __ LDA (FP + 0),y
+0ed6 : 85 4c __ STA T1 + 0
+0ed8 : c8 __ __ INY
+0ed9 : b1 25 __ LDA (FP + 0),y
+0edb : d0 0e __ BNE $0eeb
+0edd : a5 4c __ LDA T1 + 0
+0edf : c9 07 __ CMP #$07
+0ee1 : d0 08 __ BNE $0eeb
+0ee3 : a0 02 __ LDY #$02
+0ee5 : b1 25 __ LDA (FP + 0),y
+0ee7 : c9 01 __ CMP #$01
+0ee9 : f0 09 __ BEQ $0ef4
+0eeb : a9 05 __ LDA #$05
+0eed : 85 1b __ STA ACCU + 0
+0eef : a9 00 __ LDA #$00
+0ef1 : 4c fd 0d JMP $0dfd ; (main + 1277)
+0ef4 : 18 __ __ CLC
+0ef5 : a5 4a __ LDA T0 + 0
+0ef7 : 69 06 __ ADC #$06
+0ef9 : 85 0d __ STA P0
+0efb : a5 4b __ LDA T0 + 1
+0efd : 69 00 __ ADC #$00
+0eff : 85 0e __ STA P1
+0f01 : a9 70 __ LDA #$70
+0f03 : 85 0f __ STA P2
+0f05 : a9 11 __ LDA #$11
+0f07 : 85 10 __ STA P3
+0f09 : 20 62 10 JSR $1062 ; (strcmp + 0)
+0f0c : a5 1b __ LDA ACCU + 0
+0f0e : 05 1c __ ORA ACCU + 1
+0f10 : d0 25 __ BNE $0f37
+0f12 : 18 __ __ CLC
+0f13 : a5 25 __ LDA FP + 0
+0f15 : 69 22 __ ADC #$22
+0f17 : 85 0d __ STA P0
+0f19 : a5 26 __ LDA FP + 1
+0f1b : 69 00 __ ADC #$00
+0f1d : 85 0e __ STA P1
+0f1f : a9 8f __ LDA #$8f
+0f21 : 85 0f __ STA P2
+0f23 : a9 11 __ LDA #$11
+0f25 : 85 10 __ STA P3
+0f27 : 20 62 10 JSR $1062 ; (strcmp + 0)
+0f2a : a5 1b __ LDA ACCU + 0
+0f2c : 05 1c __ ORA ACCU + 1
+0f2e : d0 07 __ BNE $0f37
+0f30 : a9 00 __ LDA #$00
+0f32 : 85 1b __ STA ACCU + 0
+0f34 : 4c fd 0d JMP $0dfd ; (main + 1277)
+0f37 : a9 06 __ LDA #$06
+0f39 : 85 1b __ STA ACCU + 0
+0f3b : a9 00 __ LDA #$00
+0f3d : 4c fd 0d JMP $0dfd ; (main + 1277)
+0f40 : 18 __ __ CLC
+0f41 : a5 25 __ LDA FP + 0
+0f43 : 69 02 __ ADC #$02
+0f45 : 85 0e __ STA P1
+0f47 : a5 26 __ LDA FP + 1
+0f49 : 69 00 __ ADC #$00
+0f4b : 85 0f __ STA P2
+0f4d : a9 00 __ LDA #$00
+0f4f : 85 0d __ STA P0
+0f51 : 20 01 11 JSR $1101 ; (Proc_6 + 0)
+0f54 : 18 __ __ CLC
+0f55 : a5 25 __ LDA FP + 0
+0f57 : 69 22 __ ADC #$22
+0f59 : 85 4e __ STA T2 + 0
+0f5b : a5 26 __ LDA FP + 1
+0f5d : 69 00 __ ADC #$00
+0f5f : 85 4f __ STA T2 + 1
+0f61 : a0 ff __ LDY #$ff
+0f63 : c8 __ __ INY
+0f64 : b9 51 11 LDA $1151,y 
+0f67 : 91 4e __ STA (T2 + 0),y
+0f69 : d0 f8 __ BNE $0f63
+0f6b : a5 4a __ LDA T0 + 0
+0f6d : 85 4e __ STA T2 + 0
+0f6f : 8d 96 26 STA $2696 ; (Int_Glob + 0)
+0f72 : a5 4b __ LDA T0 + 1
+0f74 : 85 4f __ STA T2 + 1
+0f76 : 8d 97 26 STA $2697 ; (Int_Glob + 1)
+0f79 : 4c 0f 0d JMP $0d0f ; (main + 1039)
+0f7c : a9 06 __ LDA #$06
+0f7e : a0 04 __ LDY #$04
+0f80 : 91 53 __ STA (T4 + 0),y
+0f82 : a9 00 __ LDA #$00
+0f84 : c8 __ __ INY
+0f85 : 91 53 __ STA (T4 + 0),y
+0f87 : a0 03 __ LDY #$03
+0f89 : b1 50 __ LDA (T3 + 0),y
+0f8b : 85 0d __ STA P0
+0f8d : 18 __ __ CLC
+0f8e : a5 53 __ LDA T4 + 0
+0f90 : 69 03 __ ADC #$03
+0f92 : 85 0e __ STA P1
+0f94 : a5 54 __ LDA T4 + 1
+0f96 : 69 00 __ ADC #$00
+0f98 : 85 0f __ STA P2
+0f9a : 20 01 11 JSR $1101 ; (Proc_6 + 0)
+0f9d : ad 09 13 LDA $1309 ; (Ptr_Glob + 0)
+0fa0 : 85 50 __ STA T3 + 0
+0fa2 : ad 0a 13 LDA $130a ; (Ptr_Glob + 1)
+0fa5 : 85 51 __ STA T3 + 1
+0fa7 : a0 00 __ LDY #$00
+0fa9 : b1 50 __ LDA (T3 + 0),y
+0fab : 91 53 __ STA (T4 + 0),y
+0fad : c8 __ __ INY
+0fae : b1 50 __ LDA (T3 + 0),y
+0fb0 : 91 53 __ STA (T4 + 0),y
+0fb2 : a0 04 __ LDY #$04
+0fb4 : b1 53 __ LDA (T4 + 0),y
+0fb6 : 85 0d __ STA P0
+0fb8 : c8 __ __ INY
+0fb9 : b1 53 __ LDA (T4 + 0),y
+0fbb : 85 0e __ STA P1
+0fbd : a9 0a __ LDA #$0a
+0fbf : 85 0f __ STA P2
+0fc1 : a9 00 __ LDA #$00
+0fc3 : 85 10 __ STA P3
+0fc5 : 18 __ __ CLC
+0fc6 : a5 53 __ LDA T4 + 0
+0fc8 : 69 04 __ ADC #$04
+0fca : 85 11 __ STA P4
+0fcc : a5 54 __ LDA T4 + 1
+0fce : 69 00 __ ADC #$00
+0fd0 : 85 12 __ STA P5
+0fd2 : 20 91 10 JSR $1091 ; (Proc_7 + 0)
+0fd5 : 4c ea 0c JMP $0cea ; (main + 1002)
+0fd8 : 18 __ __ CLC
+0fd9 : a5 55 __ LDA T5 + 0
+0fdb : 69 07 __ ADC #$07
+0fdd : 8d 96 26 STA $2696 ; (Int_Glob + 0)
+0fe0 : a5 56 __ LDA T5 + 1
+0fe2 : 69 00 __ ADC #$00
+0fe4 : 8d 97 26 STA $2697 ; (Int_Glob + 1)
+0fe7 : a9 00 __ LDA #$00
+0fe9 : 4c 5e 0a JMP $0a5e ; (main + 350)
+--------------------------------------------------------------------
+Func_1:
+1049 : a5 0d __ LDA P0
+104b : c5 0e __ CMP P1
+104d : f0 07 __ BEQ $1056
+104f : a9 00 __ LDA #$00
+1051 : 85 1b __ STA ACCU + 0
+1053 : 85 1c __ STA ACCU + 1
+1055 : 60 __ __ RTS
+1056 : 8d 93 26 STA $2693 ; (Ch_1_Glob + 0)
+1059 : a9 01 __ LDA #$01
+105b : 85 1b __ STA ACCU + 0
+105d : a9 00 __ LDA #$00
+105f : 4c 53 10 JMP $1053 ; (Func_1 + 10)
+--------------------------------------------------------------------
+strcmp:
+1062 : a0 00 __ LDY #$00
+1064 : 84 1c __ STY ACCU + 1
+1066 : b1 0d __ LDA (P0),y
+1068 : f0 16 __ BEQ $1080
+106a : d1 0f __ CMP (P2),y
+106c : d0 16 __ BNE $1084
+106e : c8 __ __ INY
+106f : b1 0d __ LDA (P0),y
+1071 : f0 0d __ BEQ $1080
+1073 : d1 0f __ CMP (P2),y
+1075 : d0 0d __ BNE $1084
+1077 : c8 __ __ INY
+1078 : d0 ec __ BNE $1066
+107a : e6 0e __ INC P1
+107c : e6 10 __ INC P3
+107e : d0 e6 __ BNE $1066
+1080 : d1 0f __ CMP (P2),y
+1082 : f0 0a __ BEQ $108e
+1084 : b0 06 __ BCS $108c
+1086 : a9 ff __ LDA #$ff
+1088 : 85 1c __ STA ACCU + 1
+108a : 30 02 __ BMI $108e
+108c : a9 01 __ LDA #$01
+108e : 85 1b __ STA ACCU + 0
+1090 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_7:
+1091 : 18 __ __ CLC
+1092 : a5 0d __ LDA P0
+1094 : 69 02 __ ADC #$02
+1096 : 85 43 __ STA T0 + 0
+1098 : a5 0e __ LDA P1
+109a : 69 00 __ ADC #$00
+109c : 85 44 __ STA T0 + 1
+109e : 18 __ __ CLC
+109f : a5 0f __ LDA P2
+10a1 : 65 43 __ ADC T0 + 0
+10a3 : a0 00 __ LDY #$00
+10a5 : 91 11 __ STA (P4),y
+10a7 : a5 10 __ LDA P3
+10a9 : 65 44 __ ADC T0 + 1
+10ab : c8 __ __ INY
+10ac : 91 11 __ STA (P4),y
+10ae : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_3:
+10af : ad 09 13 LDA $1309 ; (Ptr_Glob + 0)
+10b2 : 85 43 __ STA T0 + 0
+10b4 : ad 0a 13 LDA $130a ; (Ptr_Glob + 1)
+10b7 : 85 44 __ STA T0 + 1
+10b9 : a5 43 __ LDA T0 + 0
+10bb : 0d 0a 13 ORA $130a ; (Ptr_Glob + 1)
+10be : f0 1e __ BEQ $10de
+10c0 : a0 00 __ LDY #$00
+10c2 : b1 43 __ LDA (T0 + 0),y
+10c4 : aa __ __ TAX
+10c5 : c8 __ __ INY
+10c6 : b1 43 __ LDA (T0 + 0),y
+10c8 : 85 46 __ STA T1 + 1
+10ca : c8 __ __ INY
+10cb : b1 23 __ LDA (SP + 0),y
+10cd : 85 47 __ STA T2 + 0
+10cf : c8 __ __ INY
+10d0 : b1 23 __ LDA (SP + 0),y
+10d2 : 85 48 __ STA T2 + 1
+10d4 : 8a __ __ TXA
+10d5 : a0 00 __ LDY #$00
+10d7 : 91 47 __ STA (T2 + 0),y
+10d9 : a5 46 __ LDA T1 + 1
+10db : c8 __ __ INY
+10dc : 91 47 __ STA (T2 + 0),y
+10de : a9 0a __ LDA #$0a
+10e0 : 85 0d __ STA P0
+10e2 : a9 00 __ LDA #$00
+10e4 : 85 0e __ STA P1
+10e6 : ad 96 26 LDA $2696 ; (Int_Glob + 0)
+10e9 : 85 0f __ STA P2
+10eb : ad 97 26 LDA $2697 ; (Int_Glob + 1)
+10ee : 85 10 __ STA P3
+10f0 : 18 __ __ CLC
+10f1 : a5 43 __ LDA T0 + 0
+10f3 : 69 04 __ ADC #$04
+10f5 : 85 11 __ STA P4
+10f7 : a5 44 __ LDA T0 + 1
+10f9 : 69 00 __ ADC #$00
+10fb : 85 12 __ STA P5
+10fd : 20 91 10 JSR $1091 ; (Proc_7 + 0)
+1100 : 60 __ __ RTS
+--------------------------------------------------------------------
+Proc_6:
+1101 : a6 0d __ LDX P0
+1103 : 8a __ __ TXA
+1104 : a0 00 __ LDY #$00
+1106 : 91 0e __ STA (P1),y
+1108 : c9 02 __ CMP #$02
+110a : f0 04 __ BEQ $1110
+110c : a9 03 __ LDA #$03
+110e : 91 0e __ STA (P1),y
+1110 : 8a __ __ TXA
+1111 : e0 03 __ CPX #$03
+1113 : f0 0c __ BEQ $1121
+1115 : c9 03 __ CMP #$03
+1117 : 90 09 __ BCC $1122
+1119 : c9 04 __ CMP #$04
+111b : d0 04 __ BNE $1121
+111d : a9 02 __ LDA #$02
+111f : 91 0e __ STA (P1),y
+1121 : 60 __ __ RTS
+1122 : 09 00 __ ORA #$00
+1124 : f0 24 __ BEQ $114a
+1126 : c9 01 __ CMP #$01
+1128 : f0 0b __ BEQ $1135
+112a : c9 02 __ CMP #$02
+112c : d0 f3 __ BNE $1121
+112e : a9 01 __ LDA #$01
+1130 : 91 0e __ STA (P1),y
+1132 : 4c 21 11 JMP $1121 ; (Proc_6 + 32)
+1135 : ad 97 26 LDA $2697 ; (Int_Glob + 1)
+1138 : 10 07 __ BPL $1141
+113a : a9 03 __ LDA #$03
+113c : 91 0e __ STA (P1),y
+113e : 4c 21 11 JMP $1121 ; (Proc_6 + 32)
+1141 : d0 07 __ BNE $114a
+1143 : a9 64 __ LDA #$64
+1145 : cd 96 26 CMP $2696 ; (Int_Glob + 0)
+1148 : b0 f0 __ BCS $113a
+114a : a9 00 __ LDA #$00
+114c : 91 0e __ STA (P1),y
+114e : 4c 21 11 JMP $1121 ; (Proc_6 + 32)
+--------------------------------------------------------------------
+inp_exit:
+11ae : a9 4c __ LDA #$4c
+11b0 : 85 54 __ STA $54
+11b2 : a9 00 __ LDA #$00
+11b4 : 85 13 __ STA P6
+11b6 : a9 19 __ LDA #$19
+11b8 : 85 16 __ STA P9
+11ba : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+11bb : a0 00 __ LDY #$00
+11bd : 84 06 __ STY $06
+11bf : a5 03 __ LDA $03
+11c1 : a6 04 __ LDX $04
+11c3 : f0 1c __ BEQ $11e1
+11c5 : 38 __ __ SEC
+11c6 : 6a __ __ ROR
+11c7 : 90 0d __ BCC $11d6
+11c9 : aa __ __ TAX
+11ca : 18 __ __ CLC
+11cb : 98 __ __ TYA
+11cc : 65 1b __ ADC ACCU + 0
+11ce : a8 __ __ TAY
+11cf : a5 06 __ LDA $06
+11d1 : 65 1c __ ADC ACCU + 1
+11d3 : 85 06 __ STA $06
+11d5 : 8a __ __ TXA
+11d6 : 06 1b __ ASL ACCU + 0
+11d8 : 26 1c __ ROL ACCU + 1
+11da : 4a __ __ LSR
+11db : 90 f9 __ BCC $11d6
+11dd : d0 ea __ BNE $11c9
+11df : a5 04 __ LDA $04
+11e1 : 4a __ __ LSR
+11e2 : 90 0d __ BCC $11f1
+11e4 : aa __ __ TAX
+11e5 : 18 __ __ CLC
+11e6 : 98 __ __ TYA
+11e7 : 65 1b __ ADC ACCU + 0
+11e9 : a8 __ __ TAY
+11ea : a5 06 __ LDA $06
+11ec : 65 1c __ ADC ACCU + 1
+11ee : 85 06 __ STA $06
+11f0 : 8a __ __ TXA
+11f1 : 06 1b __ ASL ACCU + 0
+11f3 : 26 1c __ ROL ACCU + 1
+11f5 : 4a __ __ LSR
+11f6 : b0 ec __ BCS $11e4
+11f8 : d0 f7 __ BNE $11f1
+11fa : 84 05 __ STY $05
+11fc : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+11fd : 24 1c __ BIT ACCU + 1
+11ff : 10 0d __ BPL $120e
+1201 : 20 1b 12 JSR $121b ; (negaccu + 0)
+1204 : 24 04 __ BIT $04
+1206 : 10 0d __ BPL $1215
+1208 : 20 29 12 JSR $1229 ; (negtmp + 0)
+120b : 4c 37 12 JMP $1237 ; (divmod + 0)
+120e : 24 04 __ BIT $04
+1210 : 10 f9 __ BPL $120b
+1212 : 20 29 12 JSR $1229 ; (negtmp + 0)
+1215 : 20 37 12 JSR $1237 ; (divmod + 0)
+1218 : 4c 1b 12 JMP $121b ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+121b : 38 __ __ SEC
+121c : a9 00 __ LDA #$00
+121e : e5 1b __ SBC ACCU + 0
+1220 : 85 1b __ STA ACCU + 0
+1222 : a9 00 __ LDA #$00
+1224 : e5 1c __ SBC ACCU + 1
+1226 : 85 1c __ STA ACCU + 1
+1228 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1229 : 38 __ __ SEC
+122a : a9 00 __ LDA #$00
+122c : e5 03 __ SBC $03
+122e : 85 03 __ STA $03
+1230 : a9 00 __ LDA #$00
+1232 : e5 04 __ SBC $04
+1234 : 85 04 __ STA $04
+1236 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1237 : a5 1c __ LDA ACCU + 1
+1239 : d0 31 __ BNE $126c
+123b : a5 04 __ LDA $04
+123d : d0 1e __ BNE $125d
+123f : 85 06 __ STA $06
+1241 : a2 04 __ LDX #$04
+1243 : 06 1b __ ASL ACCU + 0
+1245 : 2a __ __ ROL
+1246 : c5 03 __ CMP $03
+1248 : 90 02 __ BCC $124c
+124a : e5 03 __ SBC $03
+124c : 26 1b __ ROL ACCU + 0
+124e : 2a __ __ ROL
+124f : c5 03 __ CMP $03
+1251 : 90 02 __ BCC $1255
+1253 : e5 03 __ SBC $03
+1255 : 26 1b __ ROL ACCU + 0
+1257 : ca __ __ DEX
+1258 : d0 eb __ BNE $1245
+125a : 85 05 __ STA $05
+125c : 60 __ __ RTS
+125d : a5 1b __ LDA ACCU + 0
+125f : 85 05 __ STA $05
+1261 : a5 1c __ LDA ACCU + 1
+1263 : 85 06 __ STA $06
+1265 : a9 00 __ LDA #$00
+1267 : 85 1b __ STA ACCU + 0
+1269 : 85 1c __ STA ACCU + 1
+126b : 60 __ __ RTS
+126c : a5 04 __ LDA $04
+126e : d0 1f __ BNE $128f
+1270 : a5 03 __ LDA $03
+1272 : 30 1b __ BMI $128f
+1274 : a9 00 __ LDA #$00
+1276 : 85 06 __ STA $06
+1278 : a2 10 __ LDX #$10
+127a : 06 1b __ ASL ACCU + 0
+127c : 26 1c __ ROL ACCU + 1
+127e : 2a __ __ ROL
+127f : c5 03 __ CMP $03
+1281 : 90 02 __ BCC $1285
+1283 : e5 03 __ SBC $03
+1285 : 26 1b __ ROL ACCU + 0
+1287 : 26 1c __ ROL ACCU + 1
+1289 : ca __ __ DEX
+128a : d0 f2 __ BNE $127e
+128c : 85 05 __ STA $05
+128e : 60 __ __ RTS
+128f : a9 00 __ LDA #$00
+1291 : 85 05 __ STA $05
+1293 : 85 06 __ STA $06
+1295 : 84 02 __ STY $02
+1297 : a0 10 __ LDY #$10
+1299 : 18 __ __ CLC
+129a : 26 1b __ ROL ACCU + 0
+129c : 26 1c __ ROL ACCU + 1
+129e : 26 05 __ ROL $05
+12a0 : 26 06 __ ROL $06
+12a2 : 38 __ __ SEC
+12a3 : a5 05 __ LDA $05
+12a5 : e5 03 __ SBC $03
+12a7 : aa __ __ TAX
+12a8 : a5 06 __ LDA $06
+12aa : e5 04 __ SBC $04
+12ac : 90 04 __ BCC $12b2
+12ae : 86 05 __ STX $05
+12b0 : 85 06 __ STA $06
+12b2 : 88 __ __ DEY
+12b3 : d0 e5 __ BNE $129a
+12b5 : 26 1b __ ROL ACCU + 0
+12b7 : 26 1c __ ROL ACCU + 1
+12b9 : a4 02 __ LDY $02
+12bb : 60 __ __ RTS
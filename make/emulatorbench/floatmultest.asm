@@ -0,0 +1,3075 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 4a 22 STX $224a ; (spentry + 0)
+0811 : a9 54 __ LDA #$54
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 54 __ LDA #$54
+0832 : e9 54 __ SBC #$54
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOVD	T0, #$00000000
+0a0d:	MOV	T1, #0
+0a10:	LEA	T2, $1654
+0a14:	MOV	2(SP), T2
+0a17:	MOV	4(SP), T1
+0a1a:	MOVD	T3, c + 0
+0a1e:	MOV	ACCU, T1
+0a20:	CNVSF	ACCU
+0a21:	MULF	ACCU, T3
+0a23:	MOVD	T3, ACCU
+0a25:	MOVD	6(SP), T3
+0a28:	MOVD	10(SP), T0
+0a2b:	SUBF	ACCU, T0
+0a2d:	MOVD	14(SP), ACCU
+0a30:	CALL	printf + 0
+0a33:	MOVD	T3, c + 0
+0a37:	MOV	ACCU, T1
+0a39:	CNVSF	ACCU
+0a3a:	MULF	ACCU, T3
+0a3c:	MOVD	T3, ACCU
+0a3e:	MOVD	ACCU, T0
+0a40:	CMPF	ACCU, T3
+0a42:	SEQ
+0a43:	MOVB	2(SP), ACCU
+0a46:	CALL	assert + 0
+0a49:	MOVD	ACCU, c + 0
+0a4d:	ADDF	ACCU, T0
+0a4f:	MOVD	T0, ACCU
+0a51:	ADD	T1, #$0001
+0a55:	MOV	ACCU, T1
+0a57:	CMPS	ACCU, #$0032
+0a5a:	BGT	$0A14
+0a5c:	MOVD	T0, d + 0
+0a60:	MOV	T1, #1
+0a63:	LEA	T2, $169a
+0a67:	MOV	2(SP), T2
+0a6a:	MOV	4(SP), T1
+0a6d:	MOVD	T3, d + 0
+0a71:	MOV	ACCU, T1
+0a73:	CNVSF	ACCU
+0a74:	MOVD	T4, ACCU
+0a76:	MULF	ACCU, T3
+0a78:	MOVD	T3, ACCU
+0a7a:	MOVD	6(SP), T3
+0a7d:	MOVD	10(SP), T0
+0a80:	SUBF	ACCU, T0
+0a82:	ABSF	ACCU
+0a83:	DIVF	ACCU, T4
+0a85:	MOVD	14(SP), ACCU
+0a88:	CALL	printf + 0
+0a8b:	MOVD	T3, d + 0
+0a8f:	MOV	ACCU, T1
+0a91:	CNVSF	ACCU
+0a92:	MOVD	T4, ACCU
+0a94:	MULF	ACCU, T3
+0a96:	SUBF	ACCU, T0
+0a98:	ABSF	ACCU
+0a99:	MOVD	T3, ACCU
+0a9b:	MOVD	ACCU, T4
+0a9d:	MOVD	$03, #$358637bd
+0aa3:	MULF	ACCU, $03
+0aa5:	CMPF	ACCU, T3
+0aa7:	SLT
+0aa8:	MOVB	2(SP), ACCU
+0aab:	CALL	assert + 0
+0aae:	MOVD	ACCU, d + 0
+0ab2:	ADDF	ACCU, T0
+0ab4:	MOVD	T0, ACCU
+0ab6:	ADD	T1, #$0001
+0aba:	MOV	ACCU, T1
+0abc:	CMPS	ACCU, #$0032
+0abf:	BGT	$0A67
+0ac1:	MOV	ACCU, #0
+0ac4:	POP	#$0012
+0ac7:	RETURN	8, 10
+--------------------------------------------------------------------
+printf:
+0acb:	ENTER	9, 69
+0acf:	PUSH	#$0002
+0ad2:	MOVB	T0, #1
+0ad5:	LEA	T1, 0(FP)
+0ad9:	MOVB	T2, #0
+0adc:	MOV	T3, 60(FP)
+0adf:	MOV	ADDR, T3
+0ae1:	MOVB	T4, 0(ADDR)
+0ae4:	MOVB	ACCU, T4
+0ae6:	BNE	$0B08
+0ae8:	MOVB	ACCU, T2
+0aea:	LEAX	ADDR, T1 + ACCU
+0aec:	MOV	ACCU, #0
+0aef:	MOVB	0(ADDR), ACCU
+0af2:	MOVB	ACCU, T2
+0af4:	BEQ	$0B01
+0af6:	MOVB	ACCU, T0
+0af8:	BEQ	$0B01
+0afa:	MOV	ACCU, T1
+0afc:	MOV	P0, ACCU
+0afe:	CALL	puts + 0
+0b01:	POP	#$0002
+0b04:	RETURN	9, 69
+0b08:	LEA	T5, 62(FP)
+0b0c:	ADD	T3, #$0001
+0b10:	MOVB	ACCU, T4
+0b12:	CMPUB	ACCU, #$0025
+0b14:	BEQ	$0B72
+0b16:	MOVB	ACCU, T2
+0b18:	LEAX	ADDR, T1 + ACCU
+0b1a:	MOVB	0(ADDR), T4
+0b1d:	ADDB	T2, #$0001
+0b20:	MOVB	ACCU, T2
+0b22:	CMPUB	ACCU, #$0028
+0b24:	BLE	$0B37
+0b26:	MOV	ADDR, T3
+0b28:	MOVB	T6, 0(ADDR)
+0b2b:	ADD	T3, #$0001
+0b2f:	MOVB	ACCU, T6
+0b31:	MOVB	T4, ACCU
+0b33:	BNE	$0B10
+0b35:	JUMP	$0AE8
+0b37:	MOVB	ACCU, T2
+0b39:	MOV	T7, ACCU
+0b3b:	MOVB	ACCU, T0
+0b3d:	BNE	$0B51
+0b3f:	MOV	ACCU, T7
+0b41:	ADD	T1, ACCU
+0b43:	MOVB	T2, #0
+0b46:	MOV	ADDR, T3
+0b48:	MOVB	T6, 0(ADDR)
+0b4b:	ADD	T3, #$0001
+0b4f:	JUMP	$0B2F
+0b51:	MOV	ACCU, T1
+0b53:	ADD	T7, ACCU
+0b55:	MOV	ADDR, T7
+0b57:	MOV	ACCU, #0
+0b5a:	MOVB	0(ADDR), ACCU
+0b5d:	MOV	ACCU, T1
+0b5f:	MOV	P0, ACCU
+0b61:	CALL	puts + 0
+0b64:	MOVB	T2, #0
+0b67:	MOV	ADDR, T3
+0b69:	MOVB	T6, 0(ADDR)
+0b6c:	ADD	T3, #$0001
+0b70:	JUMP	$0B2F
+0b72:	MOVB	ACCU, T2
+0b74:	BNEF	$1137
+0b77:	MOV	ADDR, T3
+0b79:	MOVB	T4, 0(ADDR)
+0b7c:	MOV	ACCU, #10
+0b7f:	MOV	53(FP), ACCU
+0b82:	MOV	ACCU, #1
+0b85:	MOVB	51(FP), ACCU
+0b88:	MOV	ACCU, #255
+0b8b:	MOVB	52(FP), ACCU
+0b8e:	MOV	ACCU, #32
+0b91:	MOVB	50(FP), ACCU
+0b94:	MOV	ACCU, #0
+0b97:	MOVB	55(FP), ACCU
+0b9a:	MOVB	56(FP), ACCU
+0b9d:	MOVB	57(FP), ACCU
+0ba0:	ADD	T3, #$0001
+0ba4:	MOVB	ACCU, T4
+0ba6:	CMPUB	ACCU, #$002B
+0ba8:	BEQF	$1129
+0bab:	MOVB	ACCU, T4
+0bad:	CMPUB	ACCU, #$0030
+0baf:	BEQF	$111B
+0bb2:	MOVB	ACCU, T4
+0bb4:	CMPUB	ACCU, #$0023
+0bb6:	BEQF	$110D
+0bb9:	MOVB	ACCU, T4
+0bbb:	CMPUB	ACCU, #$0030
+0bbd:	BGT	$0BC6
+0bbf:	MOVB	ACCU, T4
+0bc1:	CMPUB	ACCU, #$0039
+0bc3:	BGEF	$10DC
+0bc6:	MOVB	ACCU, T4
+0bc8:	CMPUB	ACCU, #$002E
+0bca:	BEQF	$10A2
+0bcd:	MOVB	ACCU, T4
+0bcf:	CMPUB	ACCU, #$0064
+0bd1:	BEQF	$0F7A
+0bd4:	MOVB	ACCU, T4
+0bd6:	CMPUB	ACCU, #$0075
+0bd8:	BEQF	$0E67
+0bdb:	MOVB	ACCU, T4
+0bdd:	CMPUB	ACCU, #$0078
+0bdf:	BEQF	$0D42
+0be2:	MOVB	ACCU, T4
+0be4:	CMPUB	ACCU, #$006C
+0be6:	BEQF	$0CB7
+0be9:	MOVB	ACCU, T4
+0beb:	CMPUB	ACCU, #$0066
+0bed:	BEQF	$0C8D
+0bf0:	MOVB	ACCU, T4
+0bf2:	CMPUB	ACCU, #$0067
+0bf4:	BEQF	$0C8D
+0bf7:	MOVB	ACCU, T4
+0bf9:	CMPUB	ACCU, #$0065
+0bfb:	BEQF	$0C8D
+0bfe:	MOVB	ACCU, T4
+0c00:	CMPUB	ACCU, #$0073
+0c02:	BEQ	$0C44
+0c04:	MOVB	ACCU, T4
+0c06:	CMPUB	ACCU, #$0063
+0c08:	BEQ	$0C25
+0c0a:	MOVB	ACCU, T4
+0c0c:	BEQF	$0B26
+0c0f:	MOVB	ACCU, T2
+0c11:	LEAX	ADDR, T1 + ACCU
+0c13:	MOVB	0(ADDR), T4
+0c16:	ADDB	T2, #$0001
+0c19:	MOV	ADDR, T3
+0c1b:	MOVB	T6, 0(ADDR)
+0c1e:	ADD	T3, #$0001
+0c22:	JUMPF	$0B2F
+0c25:	MOVB	ACCU, T2
+0c27:	MOV	ADDR, T5
+0c29:	MOV	T8, 0(ADDR)
+0c2c:	LEAX	ADDR, T1 + ACCU
+0c2e:	MOVB	0(ADDR), T8
+0c31:	ADD	T5, #$0002
+0c35:	ADDB	T2, #$0001
+0c38:	MOV	ADDR, T3
+0c3a:	MOVB	T6, 0(ADDR)
+0c3d:	ADD	T3, #$0001
+0c41:	JUMPF	$0B2F
+0c44:	MOV	ADDR, T5
+0c46:	MOV	T7, 0(ADDR)
+0c49:	ADD	T5, #$0002
+0c4d:	MOVB	ACCU, T0
+0c4f:	BNE	$0C7A
+0c51:	MOV	ADDR, T7
+0c53:	MOVB	T4, 0(ADDR)
+0c56:	MOVB	ACCU, T4
+0c58:	BEQF	$0B26
+0c5b:	ADD	T7, #$0001
+0c5f:	MOV	ADDR, T1
+0c61:	MOVB	0(ADDR), T4
+0c64:	ADD	T1, #$0001
+0c68:	MOV	ADDR, T7
+0c6a:	MOVB	T6, 0(ADDR)
+0c6d:	ADD	T7, #$0001
+0c71:	MOVB	ACCU, T6
+0c73:	MOVB	T4, ACCU
+0c75:	BNE	$0C5F
+0c77:	JUMPF	$0B26
+0c7a:	MOV	ACCU, T7
+0c7c:	MOV	P0, ACCU
+0c7e:	CALL	puts + 0
+0c81:	MOV	ADDR, T3
+0c83:	MOVB	T6, 0(ADDR)
+0c86:	ADD	T3, #$0001
+0c8a:	JUMPF	$0B2F
+0c8d:	LEA	P0, 50(FP)
+0c91:	MOV	ACCU, T1
+0c93:	MOV	P2, ACCU
+0c95:	MOV	ADDR, T5
+0c97:	MOVD	T12, 0(ADDR)
+0c9a:	MOVD	ACCU, T12
+0c9c:	MOVD	P4, ACCU
+0c9e:	MOVB	ACCU, T4
+0ca0:	MOVB	P8, ACCU
+0ca2:	CALL	nformf + 0
+0ca5:	MOV	T2, ACCU
+0ca7:	ADD	T5, #$0004
+0cab:	MOV	ADDR, T3
+0cad:	MOVB	T6, 0(ADDR)
+0cb0:	ADD	T3, #$0001
+0cb4:	JUMPF	$0B2F
+0cb7:	MOV	ADDR, T5
+0cb9:	MOVD	T12, 0(ADDR)
+0cbc:	ADD	T5, #$0004
+0cc0:	MOV	ADDR, T3
+0cc2:	MOVB	T4, 0(ADDR)
+0cc5:	ADD	T3, #$0001
+0cc9:	MOVB	ACCU, T4
+0ccb:	CMPUB	ACCU, #$0064
+0ccd:	BEQ	$0D22
+0ccf:	MOVB	ACCU, T4
+0cd1:	CMPUB	ACCU, #$0075
+0cd3:	BEQ	$0D02
+0cd5:	MOVB	ACCU, T4
+0cd7:	CMPUB	ACCU, #$0078
+0cd9:	BNEF	$0B26
+0cdc:	MOV	ACCU, #16
+0cdf:	MOV	53(FP), ACCU
+0ce2:	LEA	P0, 50(FP)
+0ce6:	MOV	ACCU, T1
+0ce8:	MOV	P2, ACCU
+0cea:	MOVD	ACCU, T12
+0cec:	MOVD	P4, ACCU
+0cee:	MOVB	P8, #0
+0cf1:	CALL	nforml + 0
+0cf4:	MOV	T2, ACCU
+0cf6:	MOV	ADDR, T3
+0cf8:	MOVB	T6, 0(ADDR)
+0cfb:	ADD	T3, #$0001
+0cff:	JUMPF	$0B2F
+0d02:	LEA	P0, 50(FP)
+0d06:	MOV	ACCU, T1
+0d08:	MOV	P2, ACCU
+0d0a:	MOVD	ACCU, T12
+0d0c:	MOVD	P4, ACCU
+0d0e:	MOVB	P8, #0
+0d11:	CALL	nforml + 0
+0d14:	MOV	T2, ACCU
+0d16:	MOV	ADDR, T3
+0d18:	MOVB	T6, 0(ADDR)
+0d1b:	ADD	T3, #$0001
+0d1f:	JUMPF	$0B2F
+0d22:	LEA	P0, 50(FP)
+0d26:	MOV	ACCU, T1
+0d28:	MOV	P2, ACCU
+0d2a:	MOVD	ACCU, T12
+0d2c:	MOVD	P4, ACCU
+0d2e:	MOVB	P8, #1
+0d31:	CALL	nforml + 0
+0d34:	MOV	T2, ACCU
+0d36:	MOV	ADDR, T3
+0d38:	MOVB	T6, 0(ADDR)
+0d3b:	ADD	T3, #$0001
+0d3f:	JUMPF	$0B2F
+0d42:	MOV	ACCU, #16
+0d45:	MOV	53(FP), ACCU
+0d48:	MOV	ACCU, T1
+0d4a:	MOV	T7, ACCU
+0d4c:	MOV	ADDR, T5
+0d4e:	MOV	T8, 0(ADDR)
+0d51:	ADD	T5, #$0002
+0d55:	MOVB	T2, #0
+0d58:	MOVB	T4, #10
+0d5b:	MOV	ACCU, T8
+0d5d:	BNEF	$0E37
+0d60:	MOVB	T6, 52(FP)
+0d63:	MOVB	ACCU, T6
+0d65:	CMPUB	ACCU, #$00FF
+0d67:	BNEF	$0E27
+0d6a:	MOVB	T6, #9
+0d6d:	MOVB	ACCU, T4
+0d6f:	CMPUB	ACCU, #$0009
+0d71:	BGE	$0D86
+0d73:	ADDB	T4, #$00FF
+0d76:	MOVB	ACCU, T4
+0d78:	LEAX	ADDR, T7 + ACCU
+0d7a:	MOV	ACCU, #48
+0d7d:	MOVB	0(ADDR), ACCU
+0d80:	MOVB	ACCU, T6
+0d82:	CMPUB	ACCU, T4
+0d84:	BGT	$0D73
+0d86:	MOVUB	ACCU, 57(FP)
+0d89:	BEQ	$0DAF
+0d8b:	MOV	ACCU, 53(FP)
+0d8e:	CMPU	ACCU, #$0010
+0d91:	BNE	$0DAF
+0d93:	MOVB	ACCU, T4
+0d95:	ADDB	ACCU, #$00FF
+0d98:	MOVB	ACCU, ACCU
+0d9a:	LEAX	ADDR, T7 + ACCU
+0d9c:	MOV	ACCU, #88
+0d9f:	MOVB	0(ADDR), ACCU
+0da2:	ADDB	T4, #$00FE
+0da5:	MOVB	ACCU, T4
+0da7:	LEAX	ADDR, T7 + ACCU
+0da9:	MOV	ACCU, #48
+0dac:	MOVB	0(ADDR), ACCU
+0daf:	MOVB	ACCU, T2
+0db1:	BNE	$0E18
+0db3:	MOVUB	ACCU, 55(FP)
+0db6:	BEQ	$0DC5
+0db8:	ADDB	T4, #$00FF
+0dbb:	MOVB	ACCU, T4
+0dbd:	LEAX	ADDR, T7 + ACCU
+0dbf:	MOV	ACCU, #43
+0dc2:	MOVB	0(ADDR), ACCU
+0dc5:	MOVUB	T8, 51(FP)
+0dc8:	SUBR	T8, #$000A
+0dcc:	MOVB	ACCU, T4
+0dce:	MOV	T9, ACCU
+0dd0:	MOV	ACCU, T8
+0dd2:	CMPS	ACCU, T9
+0dd4:	BGT	$0E09
+0dd6:	MOVB	T2, #0
+0dd9:	MOVB	ACCU, T4
+0ddb:	CMPUB	ACCU, #$000A
+0ddd:	BLE	$0DF9
+0ddf:	MOVB	ACCU, T4
+0de1:	LEAX	ADDR, T7 + ACCU
+0de3:	MOVB	T6, 0(ADDR)
+0de6:	MOVB	ACCU, T2
+0de8:	LEAX	ADDR, T7 + ACCU
+0dea:	MOVB	0(ADDR), T6
+0ded:	ADDB	T2, #$0001
+0df0:	ADDB	T4, #$0001
+0df3:	MOVB	ACCU, T4
+0df5:	CMPUB	ACCU, #$000A
+0df7:	BGT	$0DDF
+0df9:	MOV	ADDR, T3
+0dfb:	MOVB	T6, 0(ADDR)
+0dfe:	ADD	T3, #$0001
+0e02:	AND	T2, #$00FF
+0e06:	JUMPF	$0B2F
+0e09:	ADDB	T4, #$00FF
+0e0c:	MOVB	ACCU, T4
+0e0e:	LEAX	ADDR, T7 + ACCU
+0e10:	MOVB	T2, 50(FP)
+0e13:	MOVB	0(ADDR), T2
+0e16:	JUMP	$0DC5
+0e18:	ADDB	T4, #$00FF
+0e1b:	MOVB	ACCU, T4
+0e1d:	LEAX	ADDR, T7 + ACCU
+0e1f:	MOV	ACCU, #45
+0e22:	MOVB	0(ADDR), ACCU
+0e25:	JUMP	$0DC5
+0e27:	MOVB	ACCU, T6
+0e29:	SUBR	ACCU, #$000A
+0e2d:	MOV	T6, ACCU
+0e2f:	CMPUB	ACCU, T4
+0e31:	BGTF	$0D73
+0e34:	JUMPF	$0D86
+0e37:	MOV	T9, 53(FP)
+0e3a:	MOV	ACCU, T8
+0e3c:	MODU	ACCU, T9
+0e3e:	MOV	T9, ACCU
+0e40:	CMPS	ACCU, #$000A
+0e43:	BLE	$0E4B
+0e45:	ADD	T9, #$0030
+0e49:	JUMP	$0E4F
+0e4b:	ADD	T9, #$0037
+0e4f:	ADDB	T4, #$00FF
+0e52:	MOVB	ACCU, T4
+0e54:	LEAX	ADDR, T7 + ACCU
+0e56:	MOVB	0(ADDR), T9
+0e59:	MOV	T9, 53(FP)
+0e5c:	MOV	ACCU, T8
+0e5e:	DIVU	ACCU, T9
+0e60:	MOV	T8, ACCU
+0e62:	BNE	$0E37
+0e64:	JUMPF	$0D60
+0e67:	MOV	ACCU, T1
+0e69:	MOV	T7, ACCU
+0e6b:	MOV	ADDR, T5
+0e6d:	MOV	T8, 0(ADDR)
+0e70:	ADD	T5, #$0002
+0e74:	MOVB	T2, #0
+0e77:	MOVB	T4, #10
+0e7a:	MOV	ACCU, T8
+0e7c:	BNEF	$0F4A
+0e7f:	MOVB	T6, 52(FP)
+0e82:	MOVB	ACCU, T6
+0e84:	CMPUB	ACCU, #$00FF
+0e86:	BNEF	$0F3A
+0e89:	MOVB	T6, #9
+0e8c:	MOVB	ACCU, T4
+0e8e:	CMPUB	ACCU, #$0009
+0e90:	BGE	$0EA5
+0e92:	ADDB	T4, #$00FF
+0e95:	MOVB	ACCU, T4
+0e97:	LEAX	ADDR, T7 + ACCU
+0e99:	MOV	ACCU, #48
+0e9c:	MOVB	0(ADDR), ACCU
+0e9f:	MOVB	ACCU, T6
+0ea1:	CMPUB	ACCU, T4
+0ea3:	BGT	$0E92
+0ea5:	MOVUB	ACCU, 57(FP)
+0ea8:	BEQ	$0ECE
+0eaa:	MOV	ACCU, 53(FP)
+0ead:	CMPU	ACCU, #$0010
+0eb0:	BNE	$0ECE
+0eb2:	MOVB	ACCU, T4
+0eb4:	ADDB	ACCU, #$00FF
+0eb7:	MOVB	ACCU, ACCU
+0eb9:	LEAX	ADDR, T7 + ACCU
+0ebb:	MOV	ACCU, #88
+0ebe:	MOVB	0(ADDR), ACCU
+0ec1:	ADDB	T4, #$00FE
+0ec4:	MOVB	ACCU, T4
+0ec6:	LEAX	ADDR, T7 + ACCU
+0ec8:	MOV	ACCU, #48
+0ecb:	MOVB	0(ADDR), ACCU
+0ece:	MOVB	ACCU, T2
+0ed0:	BNE	$0F2B
+0ed2:	MOVUB	ACCU, 55(FP)
+0ed5:	BEQ	$0EE4
+0ed7:	ADDB	T4, #$00FF
+0eda:	MOVB	ACCU, T4
+0edc:	LEAX	ADDR, T7 + ACCU
+0ede:	MOV	ACCU, #43
+0ee1:	MOVB	0(ADDR), ACCU
+0ee4:	MOVUB	T8, 51(FP)
+0ee7:	SUBR	T8, #$000A
+0eeb:	MOVB	ACCU, T4
+0eed:	MOV	T9, ACCU
+0eef:	MOV	ACCU, T8
+0ef1:	CMPS	ACCU, T9
+0ef3:	BGT	$0F1C
+0ef5:	MOVB	T2, #0
+0ef8:	MOVB	ACCU, T4
+0efa:	CMPUB	ACCU, #$000A
+0efc:	BLEF	$0DF9
+0eff:	MOVB	ACCU, T4
+0f01:	LEAX	ADDR, T7 + ACCU
+0f03:	MOVB	T6, 0(ADDR)
+0f06:	MOVB	ACCU, T2
+0f08:	LEAX	ADDR, T7 + ACCU
+0f0a:	MOVB	0(ADDR), T6
+0f0d:	ADDB	T2, #$0001
+0f10:	ADDB	T4, #$0001
+0f13:	MOVB	ACCU, T4
+0f15:	CMPUB	ACCU, #$000A
+0f17:	BGT	$0EFF
+0f19:	JUMPF	$0DF9
+0f1c:	ADDB	T4, #$00FF
+0f1f:	MOVB	ACCU, T4
+0f21:	LEAX	ADDR, T7 + ACCU
+0f23:	MOVB	T2, 50(FP)
+0f26:	MOVB	0(ADDR), T2
+0f29:	JUMP	$0EE4
+0f2b:	ADDB	T4, #$00FF
+0f2e:	MOVB	ACCU, T4
+0f30:	LEAX	ADDR, T7 + ACCU
+0f32:	MOV	ACCU, #45
+0f35:	MOVB	0(ADDR), ACCU
+0f38:	JUMP	$0EE4
+0f3a:	MOVB	ACCU, T6
+0f3c:	SUBR	ACCU, #$000A
+0f40:	MOV	T6, ACCU
+0f42:	CMPUB	ACCU, T4
+0f44:	BGTF	$0E92
+0f47:	JUMPF	$0EA5
+0f4a:	MOV	T9, 53(FP)
+0f4d:	MOV	ACCU, T8
+0f4f:	MODU	ACCU, T9
+0f51:	MOV	T9, ACCU
+0f53:	CMPS	ACCU, #$000A
+0f56:	BLE	$0F5E
+0f58:	ADD	T9, #$0030
+0f5c:	JUMP	$0F62
+0f5e:	ADD	T9, #$0037
+0f62:	ADDB	T4, #$00FF
+0f65:	MOVB	ACCU, T4
+0f67:	LEAX	ADDR, T7 + ACCU
+0f69:	MOVB	0(ADDR), T9
+0f6c:	MOV	T9, 53(FP)
+0f6f:	MOV	ACCU, T8
+0f71:	DIVU	ACCU, T9
+0f73:	MOV	T8, ACCU
+0f75:	BNE	$0F4A
+0f77:	JUMPF	$0E7F
+0f7a:	MOV	ACCU, T1
+0f7c:	MOV	T7, ACCU
+0f7e:	MOV	ADDR, T5
+0f80:	MOV	T8, 0(ADDR)
+0f83:	ADD	T5, #$0002
+0f87:	MOV	ACCU, T8
+0f89:	BLTF	$1094
+0f8c:	MOV	T9, ACCU
+0f8e:	MOVB	T2, #0
+0f91:	MOVB	T4, #10
+0f94:	MOV	ACCU, T8
+0f96:	BNEF	$1064
+0f99:	MOVB	T6, 52(FP)
+0f9c:	MOVB	ACCU, T6
+0f9e:	CMPUB	ACCU, #$00FF
+0fa0:	BNEF	$1054
+0fa3:	MOVB	T6, #9
+0fa6:	MOVB	ACCU, T4
+0fa8:	CMPUB	ACCU, #$0009
+0faa:	BGE	$0FBF
+0fac:	ADDB	T4, #$00FF
+0faf:	MOVB	ACCU, T4
+0fb1:	LEAX	ADDR, T7 + ACCU
+0fb3:	MOV	ACCU, #48
+0fb6:	MOVB	0(ADDR), ACCU
+0fb9:	MOVB	ACCU, T6
+0fbb:	CMPUB	ACCU, T4
+0fbd:	BGT	$0FAC
+0fbf:	MOVUB	ACCU, 57(FP)
+0fc2:	BEQ	$0FE8
+0fc4:	MOV	ACCU, 53(FP)
+0fc7:	CMPU	ACCU, #$0010
+0fca:	BNE	$0FE8
+0fcc:	MOVB	ACCU, T4
+0fce:	ADDB	ACCU, #$00FF
+0fd1:	MOVB	ACCU, ACCU
+0fd3:	LEAX	ADDR, T7 + ACCU
+0fd5:	MOV	ACCU, #88
+0fd8:	MOVB	0(ADDR), ACCU
+0fdb:	ADDB	T4, #$00FE
+0fde:	MOVB	ACCU, T4
+0fe0:	LEAX	ADDR, T7 + ACCU
+0fe2:	MOV	ACCU, #48
+0fe5:	MOVB	0(ADDR), ACCU
+0fe8:	MOVB	ACCU, T2
+0fea:	BNE	$1045
+0fec:	MOVUB	ACCU, 55(FP)
+0fef:	BEQ	$0FFE
+0ff1:	ADDB	T4, #$00FF
+0ff4:	MOVB	ACCU, T4
+0ff6:	LEAX	ADDR, T7 + ACCU
+0ff8:	MOV	ACCU, #43
+0ffb:	MOVB	0(ADDR), ACCU
+0ffe:	MOVUB	T8, 51(FP)
+1001:	SUBR	T8, #$000A
+1005:	MOVB	ACCU, T4
+1007:	MOV	T9, ACCU
+1009:	MOV	ACCU, T8
+100b:	CMPS	ACCU, T9
+100d:	BGT	$1036
+100f:	MOVB	T2, #0
+1012:	MOVB	ACCU, T4
+1014:	CMPUB	ACCU, #$000A
+1016:	BLEF	$0DF9
+1019:	MOVB	ACCU, T4
+101b:	LEAX	ADDR, T7 + ACCU
+101d:	MOVB	T6, 0(ADDR)
+1020:	MOVB	ACCU, T2
+1022:	LEAX	ADDR, T7 + ACCU
+1024:	MOVB	0(ADDR), T6
+1027:	ADDB	T2, #$0001
+102a:	ADDB	T4, #$0001
+102d:	MOVB	ACCU, T4
+102f:	CMPUB	ACCU, #$000A
+1031:	BGT	$1019
+1033:	JUMPF	$0DF9
+1036:	ADDB	T4, #$00FF
+1039:	MOVB	ACCU, T4
+103b:	LEAX	ADDR, T7 + ACCU
+103d:	MOVB	T2, 50(FP)
+1040:	MOVB	0(ADDR), T2
+1043:	JUMP	$0FFE
+1045:	ADDB	T4, #$00FF
+1048:	MOVB	ACCU, T4
+104a:	LEAX	ADDR, T7 + ACCU
+104c:	MOV	ACCU, #45
+104f:	MOVB	0(ADDR), ACCU
+1052:	JUMP	$0FFE
+1054:	MOVB	ACCU, T6
+1056:	SUBR	ACCU, #$000A
+105a:	MOV	T6, ACCU
+105c:	CMPUB	ACCU, T4
+105e:	BGTF	$0FAC
+1061:	JUMPF	$0FBF
+1064:	MOV	T8, 53(FP)
+1067:	MOV	ACCU, T9
+1069:	MODU	ACCU, T8
+106b:	MOV	T8, ACCU
+106d:	CMPS	ACCU, #$000A
+1070:	BLE	$1078
+1072:	ADD	T8, #$0030
+1076:	JUMP	$107C
+1078:	ADD	T8, #$0037
+107c:	ADDB	T4, #$00FF
+107f:	MOVB	ACCU, T4
+1081:	LEAX	ADDR, T7 + ACCU
+1083:	MOVB	0(ADDR), T8
+1086:	MOV	T8, 53(FP)
+1089:	MOV	ACCU, T9
+108b:	DIVU	ACCU, T8
+108d:	MOV	T9, ACCU
+108f:	BNE	$1064
+1091:	JUMPF	$0F99
+1094:	MOVB	T2, #1
+1097:	MOVB	T4, #10
+109a:	NEG	ACCU
+109b:	MOV	T9, ACCU
+109d:	BNE	$1064
+109f:	JUMPF	$0F99
+10a2:	MOV	T7, #0
+10a5:	MOV	ADDR, T3
+10a7:	MOVB	T4, 0(ADDR)
+10aa:	ADD	T3, #$0001
+10ae:	MOVB	ACCU, T4
+10b0:	CMPUB	ACCU, #$0030
+10b2:	BGT	$10D6
+10b4:	MOVB	ACCU, T4
+10b6:	CMPUB	ACCU, #$0039
+10b8:	BLT	$10D6
+10ba:	MOVB	ACCU, T4
+10bc:	MOV	T8, ACCU
+10be:	MOV	ADDR, T3
+10c0:	MOVB	T4, 0(ADDR)
+10c3:	ADD	T3, #$0001
+10c7:	MUL	T7, #10
+10ca:	ADD	T7, ACCU
+10cc:	ADD	T7, #$FFD0
+10d0:	MOVB	ACCU, T4
+10d2:	CMPUB	ACCU, #$0030
+10d4:	BLE	$10B4
+10d6:	MOVB	52(FP), T7
+10d9:	JUMPF	$0BCD
+10dc:	MOV	T7, #0
+10df:	MOVB	ACCU, T4
+10e1:	CMPUB	ACCU, #$0030
+10e3:	BGT	$1107
+10e5:	MOVB	ACCU, T4
+10e7:	CMPUB	ACCU, #$0039
+10e9:	BLT	$1107
+10eb:	MOVB	ACCU, T4
+10ed:	MOV	T8, ACCU
+10ef:	MOV	ADDR, T3
+10f1:	MOVB	T4, 0(ADDR)
+10f4:	ADD	T3, #$0001
+10f8:	MUL	T7, #10
+10fb:	ADD	T7, ACCU
+10fd:	ADD	T7, #$FFD0
+1101:	MOVB	ACCU, T4
+1103:	CMPUB	ACCU, #$0030
+1105:	BLE	$10E5
+1107:	MOVB	51(FP), T7
+110a:	JUMPF	$0BC6
+110d:	MOV	ACCU, #1
+1110:	MOVB	57(FP), ACCU
+1113:	MOV	ADDR, T3
+1115:	MOVB	T4, 0(ADDR)
+1118:	JUMPF	$0BA0
+111b:	MOV	ACCU, #48
+111e:	MOVB	50(FP), ACCU
+1121:	MOV	ADDR, T3
+1123:	MOVB	T4, 0(ADDR)
+1126:	JUMPF	$0BA0
+1129:	MOV	ACCU, #1
+112c:	MOVB	55(FP), ACCU
+112f:	MOV	ADDR, T3
+1131:	MOVB	T4, 0(ADDR)
+1134:	JUMPF	$0BA0
+1137:	MOVB	ACCU, T0
+1139:	BNE	$1145
+113b:	MOVB	ACCU, T2
+113d:	ADD	T1, ACCU
+113f:	MOVB	T2, #0
+1142:	JUMPF	$0B77
+1145:	MOVB	ACCU, T2
+1147:	LEAX	ADDR, T1 + ACCU
+1149:	MOV	ACCU, #0
+114c:	MOVB	0(ADDR), ACCU
+114f:	MOV	ACCU, T1
+1151:	MOV	P0, ACCU
+1153:	CALL	puts + 0
+1156:	MOVB	T2, #0
+1159:	JUMPF	$0B77
+--------------------------------------------------------------------
+puts:
+115c:	ENTER	0, 2
+1160:	JSR	$1167
+1163:	RETURN	0, 2
+--------------------------------------------------------------------
+1167 : a0 00 __ LDY #$00
+1169 : b1 0d __ LDA (P0),y
+116b : f0 0b __ BEQ $1178
+116d : 20 79 11 JSR $1179 ; (putpch + 0)
+1170 : e6 0d __ INC P0
+1172 : d0 f3 __ BNE $1167
+1174 : e6 0e __ INC P1
+1176 : d0 ef __ BNE $1167
+1178 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1179 : ae 4b 22 LDX $224b ; (giocharmap + 0)
+117c : e0 01 __ CPX #$01
+117e : 90 22 __ BCC $11a2
+1180 : c9 0a __ CMP #$0a
+1182 : d0 02 __ BNE $1186
+1184 : a9 0d __ LDA #$0d
+1186 : e0 02 __ CPX #$02
+1188 : 90 18 __ BCC $11a2
+118a : c9 41 __ CMP #$41
+118c : 90 14 __ BCC $11a2
+118e : c9 7b __ CMP #$7b
+1190 : b0 10 __ BCS $11a2
+1192 : c9 61 __ CMP #$61
+1194 : b0 04 __ BCS $119a
+1196 : c9 5b __ CMP #$5b
+1198 : b0 08 __ BCS $11a2
+119a : 49 20 __ EOR #$20
+119c : e0 03 __ CPX #$03
+119e : f0 02 __ BEQ $11a2
+11a0 : 29 df __ AND #$df
+11a2 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+11a5:	ENTER	5, 7
+11a9:	MOVD	ACCU, P4
+11ab:	MOVD	T0, ACCU
+11ad:	MOVD	T1, ACCU
+11af:	MOV	ACCU, P2
+11b1:	MOV	T2, ACCU
+11b3:	MOVB	T3, #0
+11b6:	MOVB	ACCU, P8
+11b8:	BEQ	$11C7
+11ba:	MOVD	ACCU, #$00000000
+11c0:	EXTRT	T0, inp_op_cmp_s32 + 0
+11c4:	BLTF	$130C
+11c7:	MOVB	T4, #16
+11ca:	MOVD	ACCU, #$00000000
+11d0:	EXTRT	T0, inp_op_cmp_u32 + 0
+11d4:	BGTF	$12B4
+11d7:	MOV	ADDR, P0
+11d9:	MOVB	T5, 2(ADDR)
+11dc:	MOVB	ACCU, T5
+11de:	CMPUB	ACCU, #$00FF
+11e0:	BNEF	$12A4
+11e3:	MOVB	T5, #15
+11e6:	MOVB	ACCU, T4
+11e8:	CMPUB	ACCU, #$000F
+11ea:	BGE	$11FF
+11ec:	ADDB	T4, #$00FF
+11ef:	MOVB	ACCU, T4
+11f1:	LEAX	ADDR, T2 + ACCU
+11f3:	MOV	ACCU, #48
+11f6:	MOVB	0(ADDR), ACCU
+11f9:	MOVB	ACCU, T5
+11fb:	CMPUB	ACCU, T4
+11fd:	BGT	$11EC
+11ff:	MOV	ACCU, P0
+1201:	MOV	T6, ACCU
+1203:	MOV	ADDR, T6
+1205:	MOVUB	ACCU, 7(ADDR)
+1208:	BEQ	$122E
+120a:	MOV	ACCU, 3(ADDR)
+120d:	CMPU	ACCU, #$0010
+1210:	BNE	$122E
+1212:	MOVB	ACCU, T4
+1214:	ADDB	ACCU, #$00FF
+1217:	MOVB	ACCU, ACCU
+1219:	LEAX	ADDR, T2 + ACCU
+121b:	MOV	ACCU, #88
+121e:	MOVB	0(ADDR), ACCU
+1221:	ADDB	T4, #$00FE
+1224:	MOVB	ACCU, T4
+1226:	LEAX	ADDR, T2 + ACCU
+1228:	MOV	ACCU, #48
+122b:	MOVB	0(ADDR), ACCU
+122e:	MOVB	ACCU, T3
+1230:	BNE	$1295
+1232:	MOV	ADDR, T6
+1234:	MOVUB	ACCU, 5(ADDR)
+1237:	BEQ	$1246
+1239:	ADDB	T4, #$00FF
+123c:	MOVB	ACCU, T4
+123e:	LEAX	ADDR, T2 + ACCU
+1240:	MOV	ACCU, #43
+1243:	MOVB	0(ADDR), ACCU
+1246:	MOV	ACCU, P0
+1248:	MOV	T6, ACCU
+124a:	MOV	ADDR, T6
+124c:	MOVUB	T7, 1(ADDR)
+124f:	SUBR	T7, #$0010
+1253:	MOVB	ACCU, T4
+1255:	MOV	T8, ACCU
+1257:	MOV	ACCU, T7
+1259:	CMPS	ACCU, T8
+125b:	BGT	$1286
+125d:	MOVB	T3, #0
+1260:	MOVB	ACCU, T4
+1262:	CMPUB	ACCU, #$0010
+1264:	BLE	$1280
+1266:	MOVB	ACCU, T4
+1268:	LEAX	ADDR, T2 + ACCU
+126a:	MOVB	T5, 0(ADDR)
+126d:	MOVB	ACCU, T3
+126f:	LEAX	ADDR, T2 + ACCU
+1271:	MOVB	0(ADDR), T5
+1274:	ADDB	T3, #$0001
+1277:	ADDB	T4, #$0001
+127a:	MOVB	ACCU, T4
+127c:	CMPUB	ACCU, #$0010
+127e:	BGT	$1266
+1280:	MOVB	ACCU, T3
+1282:	RETURN	5, 7
+1286:	MOVB	T3, 0(ADDR)
+1289:	ADDB	T4, #$00FF
+128c:	MOVB	ACCU, T4
+128e:	LEAX	ADDR, T2 + ACCU
+1290:	MOVB	0(ADDR), T3
+1293:	JUMP	$1246
+1295:	ADDB	T4, #$00FF
+1298:	MOVB	ACCU, T4
+129a:	LEAX	ADDR, T2 + ACCU
+129c:	MOV	ACCU, #45
+129f:	MOVB	0(ADDR), ACCU
+12a2:	JUMP	$1246
+12a4:	MOVB	ACCU, T5
+12a6:	SUBR	ACCU, #$0010
+12aa:	MOV	T5, ACCU
+12ac:	CMPUB	ACCU, T4
+12ae:	BGTF	$11EC
+12b1:	JUMPF	$11FF
+12b4:	MOV	ACCU, P0
+12b6:	MOV	T6, ACCU
+12b8:	MOV	ADDR, T6
+12ba:	MOV	ACCU, 3(ADDR)
+12bd:	EXTRT	$00, inp_op_ext_u16 + 0
+12c1:	MOVD	T0, ACCU
+12c3:	MOVD	ACCU, T1
+12c5:	EXTRT	T0, inp_binop_mod_u32 + 0
+12c9:	MOVD	T0, ACCU
+12cb:	CMPS	ACCU, #$000A
+12ce:	BLE	$12D8
+12d0:	MOV	ACCU, T0
+12d2:	ADD	ACCU, #$0030
+12d6:	JUMP	$12DE
+12d8:	MOV	ACCU, T0
+12da:	ADD	ACCU, #$0037
+12de:	MOV	T7, ACCU
+12e0:	ADDB	T4, #$00FF
+12e3:	MOVB	ACCU, T4
+12e5:	LEAX	ADDR, T2 + ACCU
+12e7:	MOVB	0(ADDR), T7
+12ea:	MOV	ADDR, T6
+12ec:	MOV	ACCU, 3(ADDR)
+12ef:	EXTRT	$00, inp_op_ext_u16 + 0
+12f3:	MOVD	T0, ACCU
+12f5:	MOVD	ACCU, T1
+12f7:	EXTRT	T0, inp_binop_div_u32 + 0
+12fb:	MOVD	T1, ACCU
+12fd:	MOVD	ACCU, #$00000000
+1303:	EXTRT	T1, inp_op_cmp_u32 + 0
+1307:	BGT	$12B4
+1309:	JUMPF	$11D7
+130c:	MOVB	T3, #1
+130f:	MOVB	T4, #16
+1312:	MOVD	ACCU, T0
+1314:	EXTRT	$00, negaccu32 + 0
+1318:	MOVD	T1, ACCU
+131a:	MOVD	ACCU, #$00000000
+1320:	EXTRT	T1, inp_op_cmp_u32 + 0
+1324:	BGT	$12B4
+1326:	JUMPF	$11D7
+--------------------------------------------------------------------
+nformf:
+1329:	ENTER	10, 12
+132d:	MOV	ACCU, P2
+132f:	MOV	T0, ACCU
+1331:	MOV	T1, ACCU
+1333:	MOVD	ACCU, P4
+1335:	MOVD	T2, ACCU
+1337:	MOVD	ACCU, #$00000000
+133d:	CMPF	ACCU, T2
+133f:	BLTF	$163F
+1342:	MOVB	T3, #0
+1345:	MOV	ADDR, P0
+1347:	MOVUB	ACCU, 5(ADDR)
+134a:	BEQ	$1357
+134c:	MOV	ACCU, #43
+134f:	MOV	ADDR, T0
+1351:	MOVB	0(ADDR), ACCU
+1354:	MOVB	T3, #1
+1357:	MOV	T0, #0
+135a:	MOV	ADDR, P0
+135c:	MOVB	T5, 2(ADDR)
+135f:	MOVB	ACCU, T5
+1361:	CMPUB	ACCU, #$00FF
+1363:	BNE	$136A
+1365:	MOVB	T5, #6
+1368:	JUMP	$136E
+136a:	AND	T5, #$00FF
+136e:	MOVD	ACCU, P4
+1370:	MOVD	T2, #$00000000
+1376:	CMPF	ACCU, T2
+1378:	BNEF	$15C3
+137b:	MOVB	ACCU, P8
+137d:	MOVB	T6, ACCU
+137f:	CMPUB	ACCU, #$0065
+1381:	SEQ
+1382:	MOVB	T7, ACCU
+1384:	MOVB	T8, ACCU
+1386:	MOVB	ACCU, T5
+1388:	MOV	T4, ACCU
+138a:	ADD	T4, #$0001
+138e:	MOVB	ACCU, T6
+1390:	CMPUB	ACCU, #$0067
+1392:	BEQF	$15B2
+1395:	MOVB	ACCU, T7
+1397:	BNEF	$1566
+139a:	MOV	ACCU, T0
+139c:	BGE	$13B4
+139e:	MOVD	ACCU, P4
+13a0:	MOVD	$03, #$41200000
+13a6:	DIVF	ACCU, $03
+13a8:	MOVD	T2, ACCU
+13aa:	MOVD	P4, ACCU
+13ac:	ADD	T0, #$0001
+13b0:	MOV	ACCU, T0
+13b2:	BLT	$139E
+13b4:	MOVD	T2, #$3f000000
+13ba:	MOVB	ACCU, T5
+13bc:	ADD	ACCU, T0
+13be:	MOV	T4, ACCU
+13c0:	ADD	T4, #$0001
+13c4:	MOVB	ACCU, T4
+13c6:	CMPUB	ACCU, #$0001
+13c8:	BLTF	$154B
+13cb:	MOVD	ACCU, P4
+13cd:	ADDF	ACCU, T2
+13cf:	MOVD	T2, ACCU
+13d1:	MOVD	P4, ACCU
+13d3:	MOVD	ACCU, #$41200000
+13d9:	CMPF	ACCU, T2
+13db:	BLT	$13EE
+13dd:	MOVD	ACCU, T2
+13df:	MOVD	$03, #$41200000
+13e5:	DIVF	ACCU, $03
+13e7:	MOVD	T2, ACCU
+13e9:	MOVD	P4, ACCU
+13eb:	ADDB	T5, #$00FF
+13ee:	MOVB	ACCU, T4
+13f0:	MOV	T10, ACCU
+13f2:	MOVB	ACCU, T5
+13f4:	NEG	ACCU
+13f5:	ADD	ACCU, T10
+13f7:	MOV	T10, ACCU
+13f9:	MOVB	T5, ACCU
+13fb:	MOVB	ACCU, T4
+13fd:	CMPUB	ACCU, #$0014
+13ff:	BGE	$1404
+1401:	MOVB	T4, #20
+1404:	MOVB	ACCU, T10
+1406:	BNE	$1415
+1408:	MOVB	ACCU, T3
+140a:	LEAX	ADDR, T1 + ACCU
+140c:	MOV	ACCU, #48
+140f:	MOVB	0(ADDR), ACCU
+1412:	ADDB	T3, #$0001
+1415:	MOVB	T6, #0
+1418:	MOVB	ACCU, T4
+141a:	BNEF	$1504
+141d:	MOVB	ACCU, T8
+141f:	BNE	$1493
+1421:	MOV	ADDR, P0
+1423:	MOVUB	ACCU, 1(ADDR)
+1426:	CMPUB	ACCU, T3
+1428:	BLT	$1430
+142a:	MOVB	ACCU, T3
+142c:	RETURN	10, 12
+1430:	MOVB	ACCU, T3
+1432:	CMPUB	ACCU, #$0001
+1434:	BLE	$1462
+1436:	MOVB	T5, #0
+1439:	MOV	ADDR, P0
+143b:	MOVUB	T0, 1(ADDR)
+143e:	MOVB	ACCU, T3
+1440:	NEG	ACCU
+1441:	ADD	ACCU, T0
+1443:	MOV	T4, ACCU
+1445:	MOVB	ACCU, T5
+1447:	MOV	T10, ACCU
+1449:	MOV	ACCU, T4
+144b:	CMPU	ACCU, T10
+144d:	BLT	$1453
+144f:	MOV	ACCU, T0
+1451:	JUMP	$142C
+1453:	MOV	ACCU, T1
+1455:	LEAX	ADDR, T10 + ACCU
+1457:	MOV	ACCU, #32
+145a:	MOVB	0(ADDR), ACCU
+145d:	ADDB	T5, #$0001
+1460:	JUMP	$1439
+1462:	MOVB	T5, #1
+1465:	MOV	ACCU, P0
+1467:	MOV	T0, ACCU
+1469:	MOVB	ACCU, T3
+146b:	MOV	T4, ACCU
+146d:	MOVB	ACCU, T5
+146f:	MOV	T10, ACCU
+1471:	MOV	ACCU, T4
+1473:	SUB	ACCU, T10
+1475:	MOV	ADDR, T0
+1477:	MOVB	T6, 1(ADDR)
+147a:	LEAX	ADDR, T1 + ACCU
+147c:	MOVB	ACCU, T6
+147e:	MOVB	T6, 0(ADDR)
+1481:	SUB	ACCU, T10
+1483:	LEAX	ADDR, T1 + ACCU
+1485:	MOVB	0(ADDR), T6
+1488:	ADDB	T5, #$0001
+148b:	MOVB	ACCU, T3
+148d:	CMPUB	ACCU, T5
+148f:	BLE	$146D
+1491:	JUMP	$1436
+1493:	MOVB	ACCU, T3
+1495:	LEAX	ADDR, T1 + ACCU
+1497:	MOV	ACCU, #69
+149a:	MOVB	0(ADDR), ACCU
+149d:	MOVB	ACCU, T3
+149f:	ADDB	ACCU, #$0001
+14a2:	MOVB	T5, ACCU
+14a4:	MOV	ACCU, T0
+14a6:	BLT	$14B7
+14a8:	MOVB	ACCU, T5
+14aa:	LEAX	ADDR, T1 + ACCU
+14ac:	MOV	ACCU, #43
+14af:	MOVB	0(ADDR), ACCU
+14b2:	ADDB	T3, #$0002
+14b5:	JUMP	$14C9
+14b7:	MOVB	ACCU, T5
+14b9:	LEAX	ADDR, T1 + ACCU
+14bb:	MOV	ACCU, #45
+14be:	MOVB	0(ADDR), ACCU
+14c1:	ADDB	T3, #$0002
+14c4:	MOV	ACCU, T0
+14c6:	NEG	ACCU
+14c7:	MOV	T0, ACCU
+14c9:	MOVB	ACCU, T3
+14cb:	ADD	ACCU, T1
+14cd:	MOV	T4, ACCU
+14cf:	MOV	ACCU, T0
+14d1:	MOV	ADDR, #10
+14d4:	DIVS	ACCU, ADDR
+14d6:	MOV	ADDR, T4
+14d8:	MOV	T10, ACCU
+14da:	ADD	T10, #$0030
+14de:	MOVB	0(ADDR), T10
+14e1:	MOVB	ACCU, T3
+14e3:	ADDB	ACCU, #$0001
+14e6:	MOVB	ACCU, ACCU
+14e8:	ADD	ACCU, T1
+14ea:	MOV	T4, ACCU
+14ec:	MOV	ACCU, T0
+14ee:	MOV	ADDR, #10
+14f1:	MODS	ACCU, ADDR
+14f3:	MOV	ADDR, T4
+14f5:	MOV	T0, ACCU
+14f7:	ADD	T0, #$0030
+14fb:	MOVB	0(ADDR), T0
+14fe:	ADDB	T3, #$0002
+1501:	JUMPF	$1421
+1504:	MOVB	ACCU, T5
+1506:	CMPUB	ACCU, T6
+1508:	BNE	$1517
+150a:	MOVB	ACCU, T3
+150c:	LEAX	ADDR, T1 + ACCU
+150e:	MOV	ACCU, #46
+1511:	MOVB	0(ADDR), ACCU
+1514:	ADDB	T3, #$0001
+1517:	MOVD	ACCU, P4
+1519:	MOVD	T2, ACCU
+151b:	CNVFS	ACCU
+151c:	MOV	T10, ACCU
+151e:	CNVSF	ACCU
+151f:	MOVD	T9, ACCU
+1521:	MOVD	ACCU, T2
+1523:	SUBF	ACCU, T9
+1525:	MOVD	$03, #$41200000
+152b:	MULF	ACCU, $03
+152d:	MOVD	T2, ACCU
+152f:	MOVD	P4, ACCU
+1531:	MOVB	ACCU, T3
+1533:	LEAX	ADDR, T1 + ACCU
+1535:	ADD	T10, #$0030
+1539:	MOVB	0(ADDR), T10
+153c:	ADDB	T3, #$0001
+153f:	ADDB	T6, #$0001
+1542:	MOVB	ACCU, T4
+1544:	CMPUB	ACCU, T6
+1546:	BLT	$1504
+1548:	JUMPF	$141D
+154b:	MOVB	T6, #1
+154e:	MOVD	ACCU, T2
+1550:	MOVD	$03, #$41200000
+1556:	DIVF	ACCU, $03
+1558:	MOVD	T2, ACCU
+155a:	ADDB	T6, #$0001
+155d:	MOVB	ACCU, T4
+155f:	CMPUB	ACCU, T6
+1561:	BLT	$154E
+1563:	JUMPF	$13CB
+1566:	MOVD	T2, #$3f000000
+156c:	MOVB	ACCU, T5
+156e:	BNE	$1598
+1570:	MOVD	ACCU, P4
+1572:	ADDF	ACCU, T2
+1574:	MOVD	T2, ACCU
+1576:	MOVD	P4, ACCU
+1578:	MOVD	ACCU, #$41200000
+157e:	CMPF	ACCU, T2
+1580:	BLTF	$13EE
+1583:	MOVD	ACCU, T2
+1585:	MOVD	$03, #$41200000
+158b:	DIVF	ACCU, $03
+158d:	MOVD	T2, ACCU
+158f:	MOVD	P4, ACCU
+1591:	ADD	T0, #$0001
+1595:	JUMPF	$13EE
+1598:	MOVB	T6, #0
+159b:	MOVD	ACCU, T2
+159d:	MOVD	$03, #$41200000
+15a3:	DIVF	ACCU, $03
+15a5:	MOVD	T2, ACCU
+15a7:	ADDB	T6, #$0001
+15aa:	MOVB	ACCU, T5
+15ac:	CMPUB	ACCU, T6
+15ae:	BLT	$159B
+15b0:	JUMP	$1570
+15b2:	MOV	ACCU, T0
+15b4:	CMPS	ACCU, #$0003
+15b7:	BLT	$15BE
+15b9:	MOV	ACCU, T0
+15bb:	BGEF	$1395
+15be:	MOVB	T8, #1
+15c1:	JUMP	$1566
+15c3:	MOVD	ACCU, P4
+15c5:	MOVD	T2, #$447a0000
+15cb:	CMPF	ACCU, T2
+15cd:	BGT	$15EB
+15cf:	MOVD	ACCU, P4
+15d1:	MOVD	$03, #$447a0000
+15d7:	DIVF	ACCU, $03
+15d9:	MOVD	T2, ACCU
+15db:	MOVD	P4, ACCU
+15dd:	ADD	T0, #$0003
+15e1:	MOVD	ACCU, #$447a0000
+15e7:	CMPF	ACCU, T2
+15e9:	BGE	$15CF
+15eb:	MOVD	ACCU, P4
+15ed:	MOVD	T2, #$3f800000
+15f3:	CMPF	ACCU, T2
+15f5:	BLE	$1613
+15f7:	MOVD	ACCU, P4
+15f9:	MOVD	$03, #$447a0000
+15ff:	MULF	ACCU, $03
+1601:	MOVD	T2, ACCU
+1603:	MOVD	P4, ACCU
+1605:	ADD	T0, #$FFFD
+1609:	MOVD	ACCU, #$3f800000
+160f:	CMPF	ACCU, T2
+1611:	BLT	$15F7
+1613:	MOVD	ACCU, P4
+1615:	MOVD	T2, #$41200000
+161b:	CMPF	ACCU, T2
+161d:	BGTF	$137B
+1620:	MOVD	ACCU, P4
+1622:	MOVD	$03, #$41200000
+1628:	DIVF	ACCU, $03
+162a:	MOVD	T2, ACCU
+162c:	MOVD	P4, ACCU
+162e:	ADD	T0, #$0001
+1632:	MOVD	ACCU, #$41200000
+1638:	CMPF	ACCU, T2
+163a:	BGE	$1620
+163c:	JUMPF	$137B
+163f:	MOV	ADDR, T0
+1641:	MOVD	ACCU, T2
+1643:	NEGF	ACCU
+1644:	MOVD	T2, ACCU
+1646:	MOVD	P4, ACCU
+1648:	MOV	ACCU, #45
+164b:	MOVB	0(ADDR), ACCU
+164e:	MOVB	T3, #1
+1651:	JUMPF	$1357
+--------------------------------------------------------------------
+assert:
+1661:	ENTER	0, 2
+1665:	PUSH	#$0002
+1668:	MOVUB	ACCU, 2(FP)
+166b:	BNE	$1673
+166d:	MOV	P0, #-1
+1670:	CALL	exit + 0
+1673:	POP	#$0002
+1676:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+167a:	ENTER	0, 2
+167e:	JSR	$1685
+1681:	RETURN	0, 2
+--------------------------------------------------------------------
+1685 : a5 0d __ LDA P0
+1687 : 85 1b __ STA ACCU + 0
+1689 : a5 0e __ LDA P1
+168b : 85 1c __ STA ACCU + 1
+168d : ae 4a 22 LDX $224a ; (spentry + 0)
+1690 : 9a __ __ TXS
+1691 : a9 4c __ LDA #$4c
+1693 : 85 54 __ STA $54
+1695 : a9 00 __ LDA #$00
+1697 : 85 13 __ STA P6
+1699 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+16a7 : b1 19 __ LDA (IP + 0),y
+16a9 : c8 __ __ INY
+16aa : aa __ __ TAX
+16ab : b5 00 __ LDA $00,x
+16ad : 85 03 __ STA $03
+16af : b5 01 __ LDA $01,x
+16b1 : 85 04 __ STA $04
+16b3 : b5 02 __ LDA $02,x
+16b5 : 85 05 __ STA $05
+16b7 : b5 03 __ LDA $03,x
+16b9 : 85 06 __ STA $06
+16bb : a5 05 __ LDA $05
+16bd : 0a __ __ ASL
+16be : a5 06 __ LDA $06
+16c0 : 2a __ __ ROL
+16c1 : 85 08 __ STA $08
+16c3 : f0 06 __ BEQ $16cb
+16c5 : a5 05 __ LDA $05
+16c7 : 09 80 __ ORA #$80
+16c9 : 85 05 __ STA $05
+16cb : a5 1d __ LDA ACCU + 2
+16cd : 0a __ __ ASL
+16ce : a5 1e __ LDA ACCU + 3
+16d0 : 2a __ __ ROL
+16d1 : 85 07 __ STA $07
+16d3 : f0 06 __ BEQ $16db
+16d5 : a5 1d __ LDA ACCU + 2
+16d7 : 09 80 __ ORA #$80
+16d9 : 85 1d __ STA ACCU + 2
+16db : 60 __ __ RTS
+16dc : 06 1e __ ASL ACCU + 3
+16de : a5 07 __ LDA $07
+16e0 : 6a __ __ ROR
+16e1 : 85 1e __ STA ACCU + 3
+16e3 : b0 06 __ BCS $16eb
+16e5 : a5 1d __ LDA ACCU + 2
+16e7 : 29 7f __ AND #$7f
+16e9 : 85 1d __ STA ACCU + 2
+16eb : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+16ec : 38 __ __ SEC
+16ed : a5 07 __ LDA $07
+16ef : e5 08 __ SBC $08
+16f1 : f0 38 __ BEQ $172b
+16f3 : aa __ __ TAX
+16f4 : b0 25 __ BCS $171b
+16f6 : e0 e9 __ CPX #$e9
+16f8 : b0 0e __ BCS $1708
+16fa : a5 08 __ LDA $08
+16fc : 85 07 __ STA $07
+16fe : a9 00 __ LDA #$00
+1700 : 85 1b __ STA ACCU + 0
+1702 : 85 1c __ STA ACCU + 1
+1704 : 85 1d __ STA ACCU + 2
+1706 : f0 23 __ BEQ $172b
+1708 : a5 1d __ LDA ACCU + 2
+170a : 4a __ __ LSR
+170b : 66 1c __ ROR ACCU + 1
+170d : 66 1b __ ROR ACCU + 0
+170f : e8 __ __ INX
+1710 : d0 f8 __ BNE $170a
+1712 : 85 1d __ STA ACCU + 2
+1714 : a5 08 __ LDA $08
+1716 : 85 07 __ STA $07
+1718 : 4c 2b 17 JMP $172b ; (faddsub + 63)
+171b : e0 18 __ CPX #$18
+171d : b0 33 __ BCS $1752
+171f : a5 05 __ LDA $05
+1721 : 4a __ __ LSR
+1722 : 66 04 __ ROR $04
+1724 : 66 03 __ ROR $03
+1726 : ca __ __ DEX
+1727 : d0 f8 __ BNE $1721
+1729 : 85 05 __ STA $05
+172b : a5 1e __ LDA ACCU + 3
+172d : 29 80 __ AND #$80
+172f : 85 1e __ STA ACCU + 3
+1731 : 45 06 __ EOR $06
+1733 : 30 2d __ BMI $1762
+1735 : 18 __ __ CLC
+1736 : a5 1b __ LDA ACCU + 0
+1738 : 65 03 __ ADC $03
+173a : 85 1b __ STA ACCU + 0
+173c : a5 1c __ LDA ACCU + 1
+173e : 65 04 __ ADC $04
+1740 : 85 1c __ STA ACCU + 1
+1742 : a5 1d __ LDA ACCU + 2
+1744 : 65 05 __ ADC $05
+1746 : 85 1d __ STA ACCU + 2
+1748 : 90 08 __ BCC $1752
+174a : 66 1d __ ROR ACCU + 2
+174c : 66 1c __ ROR ACCU + 1
+174e : 66 1b __ ROR ACCU + 0
+1750 : e6 07 __ INC $07
+1752 : a5 07 __ LDA $07
+1754 : 4a __ __ LSR
+1755 : 05 1e __ ORA ACCU + 3
+1757 : 85 1e __ STA ACCU + 3
+1759 : b0 06 __ BCS $1761
+175b : a5 1d __ LDA ACCU + 2
+175d : 29 7f __ AND #$7f
+175f : 85 1d __ STA ACCU + 2
+1761 : 60 __ __ RTS
+1762 : 38 __ __ SEC
+1763 : a5 1b __ LDA ACCU + 0
+1765 : e5 03 __ SBC $03
+1767 : 85 1b __ STA ACCU + 0
+1769 : a5 1c __ LDA ACCU + 1
+176b : e5 04 __ SBC $04
+176d : 85 1c __ STA ACCU + 1
+176f : a5 1d __ LDA ACCU + 2
+1771 : e5 05 __ SBC $05
+1773 : 85 1d __ STA ACCU + 2
+1775 : b0 19 __ BCS $1790
+1777 : 38 __ __ SEC
+1778 : a9 00 __ LDA #$00
+177a : e5 1b __ SBC ACCU + 0
+177c : 85 1b __ STA ACCU + 0
+177e : a9 00 __ LDA #$00
+1780 : e5 1c __ SBC ACCU + 1
+1782 : 85 1c __ STA ACCU + 1
+1784 : a9 00 __ LDA #$00
+1786 : e5 1d __ SBC ACCU + 2
+1788 : 85 1d __ STA ACCU + 2
+178a : a5 1e __ LDA ACCU + 3
+178c : 49 80 __ EOR #$80
+178e : 85 1e __ STA ACCU + 3
+1790 : a5 1d __ LDA ACCU + 2
+1792 : 30 be __ BMI $1752
+1794 : 05 1c __ ORA ACCU + 1
+1796 : 05 1b __ ORA ACCU + 0
+1798 : f0 0f __ BEQ $17a9
+179a : c6 07 __ DEC $07
+179c : f0 0b __ BEQ $17a9
+179e : 06 1b __ ASL ACCU + 0
+17a0 : 26 1c __ ROL ACCU + 1
+17a2 : 26 1d __ ROL ACCU + 2
+17a4 : 10 f4 __ BPL $179a
+17a6 : 4c 52 17 JMP $1752 ; (faddsub + 102)
+17a9 : a9 00 __ LDA #$00
+17ab : 85 1b __ STA ACCU + 0
+17ad : 85 1c __ STA ACCU + 1
+17af : 85 1d __ STA ACCU + 2
+17b1 : 85 1e __ STA ACCU + 3
+17b3 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+17b4 : a5 1b __ LDA ACCU + 0
+17b6 : 05 1c __ ORA ACCU + 1
+17b8 : 05 1d __ ORA ACCU + 2
+17ba : d0 03 __ BNE $17bf
+17bc : 85 1e __ STA ACCU + 3
+17be : 60 __ __ RTS
+17bf : a5 03 __ LDA $03
+17c1 : 05 04 __ ORA $04
+17c3 : 05 05 __ ORA $05
+17c5 : d0 09 __ BNE $17d0
+17c7 : 85 1b __ STA ACCU + 0
+17c9 : 85 1c __ STA ACCU + 1
+17cb : 85 1d __ STA ACCU + 2
+17cd : 85 1e __ STA ACCU + 3
+17cf : 60 __ __ RTS
+17d0 : a9 00 __ LDA #$00
+17d2 : 85 09 __ STA $09
+17d4 : 85 0a __ STA $0a
+17d6 : 85 0b __ STA $0b
+17d8 : a4 1b __ LDY ACCU + 0
+17da : a5 03 __ LDA $03
+17dc : d0 06 __ BNE $17e4
+17de : a5 04 __ LDA $04
+17e0 : f0 0a __ BEQ $17ec
+17e2 : d0 05 __ BNE $17e9
+17e4 : 20 24 18 JSR $1824 ; (fmul8 + 0)
+17e7 : a5 04 __ LDA $04
+17e9 : 20 24 18 JSR $1824 ; (fmul8 + 0)
+17ec : a5 05 __ LDA $05
+17ee : 20 24 18 JSR $1824 ; (fmul8 + 0)
+17f1 : 38 __ __ SEC
+17f2 : a5 0b __ LDA $0b
+17f4 : 30 06 __ BMI $17fc
+17f6 : 06 09 __ ASL $09
+17f8 : 26 0a __ ROL $0a
+17fa : 2a __ __ ROL
+17fb : 18 __ __ CLC
+17fc : 29 7f __ AND #$7f
+17fe : 85 0b __ STA $0b
+1800 : a5 1e __ LDA ACCU + 3
+1802 : 45 06 __ EOR $06
+1804 : 29 80 __ AND #$80
+1806 : 85 1e __ STA ACCU + 3
+1808 : a5 07 __ LDA $07
+180a : e9 7e __ SBC #$7e
+180c : 18 __ __ CLC
+180d : 65 08 __ ADC $08
+180f : 4a __ __ LSR
+1810 : 05 1e __ ORA ACCU + 3
+1812 : 85 1e __ STA ACCU + 3
+1814 : a9 00 __ LDA #$00
+1816 : 6a __ __ ROR
+1817 : 05 0b __ ORA $0b
+1819 : 85 1d __ STA ACCU + 2
+181b : a5 0a __ LDA $0a
+181d : 85 1c __ STA ACCU + 1
+181f : a5 09 __ LDA $09
+1821 : 85 1b __ STA ACCU + 0
+1823 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1824 : 38 __ __ SEC
+1825 : 6a __ __ ROR
+1826 : 90 1e __ BCC $1846
+1828 : aa __ __ TAX
+1829 : 18 __ __ CLC
+182a : 98 __ __ TYA
+182b : 65 09 __ ADC $09
+182d : 85 09 __ STA $09
+182f : a5 0a __ LDA $0a
+1831 : 65 1c __ ADC ACCU + 1
+1833 : 85 0a __ STA $0a
+1835 : a5 0b __ LDA $0b
+1837 : 65 1d __ ADC ACCU + 2
+1839 : 6a __ __ ROR
+183a : 85 0b __ STA $0b
+183c : 8a __ __ TXA
+183d : 66 0a __ ROR $0a
+183f : 66 09 __ ROR $09
+1841 : 4a __ __ LSR
+1842 : f0 0d __ BEQ $1851
+1844 : b0 e2 __ BCS $1828
+1846 : 66 0b __ ROR $0b
+1848 : 66 0a __ ROR $0a
+184a : 66 09 __ ROR $09
+184c : 4a __ __ LSR
+184d : 90 f7 __ BCC $1846
+184f : d0 d7 __ BNE $1828
+1851 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1852 : a5 1b __ LDA ACCU + 0
+1854 : 05 1c __ ORA ACCU + 1
+1856 : 05 1d __ ORA ACCU + 2
+1858 : d0 03 __ BNE $185d
+185a : 85 1e __ STA ACCU + 3
+185c : 60 __ __ RTS
+185d : a5 1e __ LDA ACCU + 3
+185f : 45 06 __ EOR $06
+1861 : 29 80 __ AND #$80
+1863 : 85 1e __ STA ACCU + 3
+1865 : a9 00 __ LDA #$00
+1867 : 85 09 __ STA $09
+1869 : 85 0a __ STA $0a
+186b : 85 0b __ STA $0b
+186d : a2 18 __ LDX #$18
+186f : a5 1b __ LDA ACCU + 0
+1871 : c5 03 __ CMP $03
+1873 : a5 1c __ LDA ACCU + 1
+1875 : e5 04 __ SBC $04
+1877 : a5 1d __ LDA ACCU + 2
+1879 : e5 05 __ SBC $05
+187b : 90 13 __ BCC $1890
+187d : a5 1b __ LDA ACCU + 0
+187f : e5 03 __ SBC $03
+1881 : 85 1b __ STA ACCU + 0
+1883 : a5 1c __ LDA ACCU + 1
+1885 : e5 04 __ SBC $04
+1887 : 85 1c __ STA ACCU + 1
+1889 : a5 1d __ LDA ACCU + 2
+188b : e5 05 __ SBC $05
+188d : 85 1d __ STA ACCU + 2
+188f : 38 __ __ SEC
+1890 : 26 09 __ ROL $09
+1892 : 26 0a __ ROL $0a
+1894 : 26 0b __ ROL $0b
+1896 : ca __ __ DEX
+1897 : f0 0a __ BEQ $18a3
+1899 : 06 1b __ ASL ACCU + 0
+189b : 26 1c __ ROL ACCU + 1
+189d : 26 1d __ ROL ACCU + 2
+189f : b0 dc __ BCS $187d
+18a1 : 90 cc __ BCC $186f
+18a3 : 38 __ __ SEC
+18a4 : a5 0b __ LDA $0b
+18a6 : 30 06 __ BMI $18ae
+18a8 : 06 09 __ ASL $09
+18aa : 26 0a __ ROL $0a
+18ac : 2a __ __ ROL
+18ad : 18 __ __ CLC
+18ae : 29 7f __ AND #$7f
+18b0 : 85 0b __ STA $0b
+18b2 : a5 08 __ LDA $08
+18b4 : 49 7f __ EOR #$7f
+18b6 : 65 07 __ ADC $07
+18b8 : 38 __ __ SEC
+18b9 : e9 01 __ SBC #$01
+18bb : 4a __ __ LSR
+18bc : 05 1e __ ORA ACCU + 3
+18be : 85 1e __ STA ACCU + 3
+18c0 : a9 00 __ LDA #$00
+18c2 : 6a __ __ ROR
+18c3 : 05 0b __ ORA $0b
+18c5 : 85 1d __ STA ACCU + 2
+18c7 : a5 0a __ LDA $0a
+18c9 : 85 1c __ STA ACCU + 1
+18cb : a5 09 __ LDA $09
+18cd : 85 1b __ STA ACCU + 0
+18cf : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+18d0 : 38 __ __ SEC
+18d1 : a9 00 __ LDA #$00
+18d3 : e5 1b __ SBC ACCU + 0
+18d5 : 85 1b __ STA ACCU + 0
+18d7 : a9 00 __ LDA #$00
+18d9 : e5 1c __ SBC ACCU + 1
+18db : 85 1c __ STA ACCU + 1
+18dd : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+18de : 38 __ __ SEC
+18df : a9 00 __ LDA #$00
+18e1 : e5 03 __ SBC $03
+18e3 : 85 03 __ STA $03
+18e5 : a9 00 __ LDA #$00
+18e7 : e5 04 __ SBC $04
+18e9 : 85 04 __ STA $04
+18eb : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+18ec : a5 1c __ LDA ACCU + 1
+18ee : d0 31 __ BNE $1921
+18f0 : a5 04 __ LDA $04
+18f2 : d0 1e __ BNE $1912
+18f4 : 85 06 __ STA $06
+18f6 : a2 04 __ LDX #$04
+18f8 : 06 1b __ ASL ACCU + 0
+18fa : 2a __ __ ROL
+18fb : c5 03 __ CMP $03
+18fd : 90 02 __ BCC $1901
+18ff : e5 03 __ SBC $03
+1901 : 26 1b __ ROL ACCU + 0
+1903 : 2a __ __ ROL
+1904 : c5 03 __ CMP $03
+1906 : 90 02 __ BCC $190a
+1908 : e5 03 __ SBC $03
+190a : 26 1b __ ROL ACCU + 0
+190c : ca __ __ DEX
+190d : d0 eb __ BNE $18fa
+190f : 85 05 __ STA $05
+1911 : 60 __ __ RTS
+1912 : a5 1b __ LDA ACCU + 0
+1914 : 85 05 __ STA $05
+1916 : a5 1c __ LDA ACCU + 1
+1918 : 85 06 __ STA $06
+191a : a9 00 __ LDA #$00
+191c : 85 1b __ STA ACCU + 0
+191e : 85 1c __ STA ACCU + 1
+1920 : 60 __ __ RTS
+1921 : a5 04 __ LDA $04
+1923 : d0 1f __ BNE $1944
+1925 : a5 03 __ LDA $03
+1927 : 30 1b __ BMI $1944
+1929 : a9 00 __ LDA #$00
+192b : 85 06 __ STA $06
+192d : a2 10 __ LDX #$10
+192f : 06 1b __ ASL ACCU + 0
+1931 : 26 1c __ ROL ACCU + 1
+1933 : 2a __ __ ROL
+1934 : c5 03 __ CMP $03
+1936 : 90 02 __ BCC $193a
+1938 : e5 03 __ SBC $03
+193a : 26 1b __ ROL ACCU + 0
+193c : 26 1c __ ROL ACCU + 1
+193e : ca __ __ DEX
+193f : d0 f2 __ BNE $1933
+1941 : 85 05 __ STA $05
+1943 : 60 __ __ RTS
+1944 : a9 00 __ LDA #$00
+1946 : 85 05 __ STA $05
+1948 : 85 06 __ STA $06
+194a : 84 02 __ STY $02
+194c : a0 10 __ LDY #$10
+194e : 18 __ __ CLC
+194f : 26 1b __ ROL ACCU + 0
+1951 : 26 1c __ ROL ACCU + 1
+1953 : 26 05 __ ROL $05
+1955 : 26 06 __ ROL $06
+1957 : 38 __ __ SEC
+1958 : a5 05 __ LDA $05
+195a : e5 03 __ SBC $03
+195c : aa __ __ TAX
+195d : a5 06 __ LDA $06
+195f : e5 04 __ SBC $04
+1961 : 90 04 __ BCC $1967
+1963 : 86 05 __ STX $05
+1965 : 85 06 __ STA $06
+1967 : 88 __ __ DEY
+1968 : d0 e5 __ BNE $194f
+196a : 26 1b __ ROL ACCU + 0
+196c : 26 1c __ ROL ACCU + 1
+196e : a4 02 __ LDY $02
+1970 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1971 : 20 cb 16 JSR $16cb ; (freg + 36)
+1974 : a5 07 __ LDA $07
+1976 : c9 7f __ CMP #$7f
+1978 : b0 07 __ BCS $1981
+197a : a9 00 __ LDA #$00
+197c : 85 1b __ STA ACCU + 0
+197e : 85 1c __ STA ACCU + 1
+1980 : 60 __ __ RTS
+1981 : 38 __ __ SEC
+1982 : e9 8e __ SBC #$8e
+1984 : 90 0a __ BCC $1990
+1986 : a9 ff __ LDA #$ff
+1988 : 85 1b __ STA ACCU + 0
+198a : a9 7f __ LDA #$7f
+198c : 85 1c __ STA ACCU + 1
+198e : d0 08 __ BNE $1998
+1990 : aa __ __ TAX
+1991 : 46 1d __ LSR ACCU + 2
+1993 : 66 1c __ ROR ACCU + 1
+1995 : e8 __ __ INX
+1996 : d0 f9 __ BNE $1991
+1998 : 24 1e __ BIT ACCU + 3
+199a : 10 0e __ BPL $19aa
+199c : 38 __ __ SEC
+199d : a9 00 __ LDA #$00
+199f : e5 1c __ SBC ACCU + 1
+19a1 : 85 1b __ STA ACCU + 0
+19a3 : a9 00 __ LDA #$00
+19a5 : e5 1d __ SBC ACCU + 2
+19a7 : 85 1c __ STA ACCU + 1
+19a9 : 60 __ __ RTS
+19aa : a5 1c __ LDA ACCU + 1
+19ac : 85 1b __ STA ACCU + 0
+19ae : a5 1d __ LDA ACCU + 2
+19b0 : 85 1c __ STA ACCU + 1
+19b2 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+19b3 : 24 1c __ BIT ACCU + 1
+19b5 : 30 03 __ BMI $19ba
+19b7 : 4c d1 19 JMP $19d1 ; (uint16_to_float + 0)
+19ba : 38 __ __ SEC
+19bb : a9 00 __ LDA #$00
+19bd : e5 1b __ SBC ACCU + 0
+19bf : 85 1b __ STA ACCU + 0
+19c1 : a9 00 __ LDA #$00
+19c3 : e5 1c __ SBC ACCU + 1
+19c5 : 85 1c __ STA ACCU + 1
+19c7 : 20 d1 19 JSR $19d1 ; (uint16_to_float + 0)
+19ca : a5 1e __ LDA ACCU + 3
+19cc : 09 80 __ ORA #$80
+19ce : 85 1e __ STA ACCU + 3
+19d0 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+19d1 : a5 1b __ LDA ACCU + 0
+19d3 : 05 1c __ ORA ACCU + 1
+19d5 : d0 05 __ BNE $19dc
+19d7 : 85 1d __ STA ACCU + 2
+19d9 : 85 1e __ STA ACCU + 3
+19db : 60 __ __ RTS
+19dc : a2 8e __ LDX #$8e
+19de : a5 1c __ LDA ACCU + 1
+19e0 : 30 06 __ BMI $19e8
+19e2 : ca __ __ DEX
+19e3 : 06 1b __ ASL ACCU + 0
+19e5 : 2a __ __ ROL
+19e6 : 10 fa __ BPL $19e2
+19e8 : 29 7f __ AND #$7f
+19ea : 85 1d __ STA ACCU + 2
+19ec : a5 1b __ LDA ACCU + 0
+19ee : 85 1c __ STA ACCU + 1
+19f0 : 8a __ __ TXA
+19f1 : 4a __ __ LSR
+19f2 : 85 1e __ STA ACCU + 3
+19f4 : a9 00 __ LDA #$00
+19f6 : 85 1b __ STA ACCU + 0
+19f8 : 6a __ __ ROR
+19f9 : 05 1d __ ORA ACCU + 2
+19fb : 85 1d __ STA ACCU + 2
+19fd : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+19fe : 38 __ __ SEC
+19ff : a9 00 __ LDA #$00
+1a01 : e5 1b __ SBC ACCU + 0
+1a03 : 85 1b __ STA ACCU + 0
+1a05 : a9 00 __ LDA #$00
+1a07 : e5 1c __ SBC ACCU + 1
+1a09 : 85 1c __ STA ACCU + 1
+1a0b : a9 00 __ LDA #$00
+1a0d : e5 1d __ SBC ACCU + 2
+1a0f : 85 1d __ STA ACCU + 2
+1a11 : a9 00 __ LDA #$00
+1a13 : e5 1e __ SBC ACCU + 3
+1a15 : 85 1e __ STA ACCU + 3
+1a17 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1a18 : 84 02 __ STY $02
+1a1a : a9 00 __ LDA #$00
+1a1c : 85 07 __ STA $07
+1a1e : 85 08 __ STA $08
+1a20 : 85 09 __ STA $09
+1a22 : 85 0a __ STA $0a
+1a24 : a0 20 __ LDY #$20
+1a26 : 18 __ __ CLC
+1a27 : 26 1b __ ROL ACCU + 0
+1a29 : 26 1c __ ROL ACCU + 1
+1a2b : 26 1d __ ROL ACCU + 2
+1a2d : 26 1e __ ROL ACCU + 3
+1a2f : 26 07 __ ROL $07
+1a31 : 26 08 __ ROL $08
+1a33 : 26 09 __ ROL $09
+1a35 : 26 0a __ ROL $0a
+1a37 : a5 07 __ LDA $07
+1a39 : c5 03 __ CMP $03
+1a3b : a5 08 __ LDA $08
+1a3d : e5 04 __ SBC $04
+1a3f : a5 09 __ LDA $09
+1a41 : e5 05 __ SBC $05
+1a43 : a5 0a __ LDA $0a
+1a45 : e5 06 __ SBC $06
+1a47 : 90 18 __ BCC $1a61
+1a49 : a5 07 __ LDA $07
+1a4b : e5 03 __ SBC $03
+1a4d : 85 07 __ STA $07
+1a4f : a5 08 __ LDA $08
+1a51 : e5 04 __ SBC $04
+1a53 : 85 08 __ STA $08
+1a55 : a5 09 __ LDA $09
+1a57 : e5 05 __ SBC $05
+1a59 : 85 09 __ STA $09
+1a5b : a5 0a __ LDA $0a
+1a5d : e5 06 __ SBC $06
+1a5f : 85 0a __ STA $0a
+1a61 : 88 __ __ DEY
+1a62 : d0 c3 __ BNE $1a27
+1a64 : 26 1b __ ROL ACCU + 0
+1a66 : 26 1c __ ROL ACCU + 1
+1a68 : 26 1d __ ROL ACCU + 2
+1a6a : 26 1e __ ROL ACCU + 3
+1a6c : a4 02 __ LDY $02
+1a6e : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1a6f : a9 00 __ LDA #$00
+1a71 : 85 1d __ STA ACCU + 2
+1a73 : 85 1e __ STA ACCU + 3
+1a75 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1a76 : b5 00 __ LDA $00,x
+1a78 : 85 03 __ STA $03
+1a7a : b5 01 __ LDA $01,x
+1a7c : 85 04 __ STA $04
+1a7e : b5 02 __ LDA $02,x
+1a80 : 85 05 __ STA $05
+1a82 : b5 03 __ LDA $03,x
+1a84 : 85 06 __ STA $06
+1a86 : 20 18 1a JSR $1a18 ; (divmod32 + 0)
+1a89 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1a8a : b5 00 __ LDA $00,x
+1a8c : 85 03 __ STA $03
+1a8e : b5 01 __ LDA $01,x
+1a90 : 85 04 __ STA $04
+1a92 : b5 02 __ LDA $02,x
+1a94 : 85 05 __ STA $05
+1a96 : b5 03 __ LDA $03,x
+1a98 : 85 06 __ STA $06
+1a9a : 20 18 1a JSR $1a18 ; (divmod32 + 0)
+1a9d : a5 07 __ LDA $07
+1a9f : 85 1b __ STA ACCU + 0
+1aa1 : a5 08 __ LDA $08
+1aa3 : 85 1c __ STA ACCU + 1
+1aa5 : a5 09 __ LDA $09
+1aa7 : 85 1d __ STA ACCU + 2
+1aa9 : a5 0a __ LDA $0a
+1aab : 85 1e __ STA ACCU + 3
+1aad : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1aae : b5 03 __ LDA $03,x
+1ab0 : c5 1e __ CMP ACCU + 3
+1ab2 : d0 20 __ BNE $1ad4
+1ab4 : b5 02 __ LDA $02,x
+1ab6 : c5 1d __ CMP ACCU + 2
+1ab8 : d0 1a __ BNE $1ad4
+1aba : b5 01 __ LDA $01,x
+1abc : c5 1c __ CMP ACCU + 1
+1abe : d0 14 __ BNE $1ad4
+1ac0 : b5 00 __ LDA $00,x
+1ac2 : c5 1b __ CMP ACCU + 0
+1ac4 : d0 0e __ BNE $1ad4
+1ac6 : a9 00 __ LDA #$00
+1ac8 : 85 1b __ STA ACCU + 0
+1aca : 85 1c __ STA ACCU + 1
+1acc : 60 __ __ RTS
+1acd : a9 ff __ LDA #$ff
+1acf : 85 1b __ STA ACCU + 0
+1ad1 : 85 1c __ STA ACCU + 1
+1ad3 : 60 __ __ RTS
+1ad4 : 90 f7 __ BCC $1acd
+1ad6 : a9 01 __ LDA #$01
+1ad8 : 85 1b __ STA ACCU + 0
+1ada : a9 00 __ LDA #$00
+1adc : 85 1c __ STA ACCU + 1
+1ade : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1adf : a5 1e __ LDA ACCU + 3
+1ae1 : 49 80 __ EOR #$80
+1ae3 : 85 1e __ STA ACCU + 3
+1ae5 : b5 03 __ LDA $03,x
+1ae7 : 49 80 __ EOR #$80
+1ae9 : c5 1e __ CMP ACCU + 3
+1aeb : d0 20 __ BNE $1b0d
+1aed : b5 02 __ LDA $02,x
+1aef : c5 1d __ CMP ACCU + 2
+1af1 : d0 1a __ BNE $1b0d
+1af3 : b5 01 __ LDA $01,x
+1af5 : c5 1c __ CMP ACCU + 1
+1af7 : d0 14 __ BNE $1b0d
+1af9 : b5 00 __ LDA $00,x
+1afb : c5 1b __ CMP ACCU + 0
+1afd : d0 0e __ BNE $1b0d
+1aff : a9 00 __ LDA #$00
+1b01 : 85 1b __ STA ACCU + 0
+1b03 : 85 1c __ STA ACCU + 1
+1b05 : 60 __ __ RTS
+1b06 : a9 ff __ LDA #$ff
+1b08 : 85 1b __ STA ACCU + 0
+1b0a : 85 1c __ STA ACCU + 1
+1b0c : 60 __ __ RTS
+1b0d : 90 f7 __ BCC $1b06
+1b0f : a9 01 __ LDA #$01
+1b11 : 85 1b __ STA ACCU + 0
+1b13 : a9 00 __ LDA #$00
+1b15 : 85 1c __ STA ACCU + 1
+1b17 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1b18 : a9 4c __ LDA #$4c
+1b1a : 85 54 __ STA $54
+1b1c : a9 00 __ LDA #$00
+1b1e : 85 13 __ STA P6
+1b20 : a9 19 __ LDA #$19
+1b22 : 85 16 __ STA P9
+1b24 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1b25 : b1 19 __ LDA (IP + 0),y
+1b27 : aa __ __ TAX
+1b28 : c8 __ __ INY
+1b29 : b1 19 __ LDA (IP + 0),y
+1b2b : 95 00 __ STA $00,x
+1b2d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1b30 : b1 19 __ LDA (IP + 0),y
+1b32 : aa __ __ TAX
+1b33 : c8 __ __ INY
+1b34 : b1 19 __ LDA (IP + 0),y
+1b36 : 95 00 __ STA $00,x
+1b38 : a9 00 __ LDA #$00
+1b3a : 95 01 __ STA $01,x
+1b3c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1b3f : b1 19 __ LDA (IP + 0),y
+1b41 : aa __ __ TAX
+1b42 : c8 __ __ INY
+1b43 : b1 19 __ LDA (IP + 0),y
+1b45 : 95 00 __ STA $00,x
+1b47 : a9 ff __ LDA #$ff
+1b49 : 95 01 __ STA $01,x
+1b4b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1b4e : b1 19 __ LDA (IP + 0),y
+1b50 : aa __ __ TAX
+1b51 : c8 __ __ INY
+1b52 : b1 19 __ LDA (IP + 0),y
+1b54 : 95 00 __ STA $00,x
+1b56 : c8 __ __ INY
+1b57 : b1 19 __ LDA (IP + 0),y
+1b59 : 95 01 __ STA $01,x
+1b5b : c8 __ __ INY
+1b5c : b1 19 __ LDA (IP + 0),y
+1b5e : 95 02 __ STA $02,x
+1b60 : c8 __ __ INY
+1b61 : b1 19 __ LDA (IP + 0),y
+1b63 : 95 03 __ STA $03,x
+1b65 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1b68 : b1 19 __ LDA (IP + 0),y
+1b6a : aa __ __ TAX
+1b6b : b5 00 __ LDA $00,x
+1b6d : 85 1b __ STA ACCU + 0
+1b6f : a9 00 __ LDA #$00
+1b71 : 85 1c __ STA ACCU + 1
+1b73 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1b76 : b1 19 __ LDA (IP + 0),y
+1b78 : aa __ __ TAX
+1b79 : a5 1b __ LDA ACCU + 0
+1b7b : 95 00 __ STA $00,x
+1b7d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1b80 : b1 19 __ LDA (IP + 0),y
+1b82 : aa __ __ TAX
+1b83 : b5 00 __ LDA $00,x
+1b85 : 85 1b __ STA ACCU + 0
+1b87 : b5 01 __ LDA $01,x
+1b89 : 85 1c __ STA ACCU + 1
+1b8b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1b8e : b1 19 __ LDA (IP + 0),y
+1b90 : aa __ __ TAX
+1b91 : a5 1b __ LDA ACCU + 0
+1b93 : 95 00 __ STA $00,x
+1b95 : a5 1c __ LDA ACCU + 1
+1b97 : 95 01 __ STA $01,x
+1b99 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1b9c : b1 19 __ LDA (IP + 0),y
+1b9e : aa __ __ TAX
+1b9f : b5 00 __ LDA $00,x
+1ba1 : 85 1f __ STA ADDR + 0
+1ba3 : b5 01 __ LDA $01,x
+1ba5 : 85 20 __ STA ADDR + 1
+1ba7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1baa : b1 19 __ LDA (IP + 0),y
+1bac : aa __ __ TAX
+1bad : b5 00 __ LDA $00,x
+1baf : 85 1b __ STA ACCU + 0
+1bb1 : b5 01 __ LDA $01,x
+1bb3 : 85 1c __ STA ACCU + 1
+1bb5 : b5 02 __ LDA $02,x
+1bb7 : 85 1d __ STA ACCU + 2
+1bb9 : b5 03 __ LDA $03,x
+1bbb : 85 1e __ STA ACCU + 3
+1bbd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1bc0 : b1 19 __ LDA (IP + 0),y
+1bc2 : aa __ __ TAX
+1bc3 : a5 1b __ LDA ACCU + 0
+1bc5 : 95 00 __ STA $00,x
+1bc7 : a5 1c __ LDA ACCU + 1
+1bc9 : 95 01 __ STA $01,x
+1bcb : a5 1d __ LDA ACCU + 2
+1bcd : 95 02 __ STA $02,x
+1bcf : a5 1e __ LDA ACCU + 3
+1bd1 : 95 03 __ STA $03,x
+1bd3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1bd6 : b1 19 __ LDA (IP + 0),y
+1bd8 : 85 1f __ STA ADDR + 0
+1bda : c8 __ __ INY
+1bdb : b1 19 __ LDA (IP + 0),y
+1bdd : 85 20 __ STA ADDR + 1
+1bdf : c8 __ __ INY
+1be0 : b1 19 __ LDA (IP + 0),y
+1be2 : aa __ __ TAX
+1be3 : 84 02 __ STY $02
+1be5 : a0 00 __ LDY #$00
+1be7 : b1 1f __ LDA (ADDR + 0),y
+1be9 : 95 00 __ STA $00,x
+1beb : c8 __ __ INY
+1bec : b1 1f __ LDA (ADDR + 0),y
+1bee : 95 01 __ STA $01,x
+1bf0 : c8 __ __ INY
+1bf1 : b1 1f __ LDA (ADDR + 0),y
+1bf3 : 95 02 __ STA $02,x
+1bf5 : c8 __ __ INY
+1bf6 : b1 1f __ LDA (ADDR + 0),y
+1bf8 : 95 03 __ STA $03,x
+1bfa : a4 02 __ LDY $02
+1bfc : 4c 50 08 JMP $0850 ; (startup + 79)
+1bff : b1 19 __ LDA (IP + 0),y
+1c01 : aa __ __ TAX
+1c02 : c8 __ __ INY
+1c03 : b1 19 __ LDA (IP + 0),y
+1c05 : 84 02 __ STY $02
+1c07 : a8 __ __ TAY
+1c08 : 4c e7 1b JMP $1be7 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1c0b : b1 19 __ LDA (IP + 0),y
+1c0d : aa __ __ TAX
+1c0e : c8 __ __ INY
+1c0f : b1 19 __ LDA (IP + 0),y
+1c11 : 95 00 __ STA $00,x
+1c13 : c8 __ __ INY
+1c14 : b1 19 __ LDA (IP + 0),y
+1c16 : 95 01 __ STA $01,x
+1c18 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1c1b : b1 19 __ LDA (IP + 0),y
+1c1d : aa __ __ TAX
+1c1e : 18 __ __ CLC
+1c1f : b5 00 __ LDA $00,x
+1c21 : 65 1b __ ADC ACCU + 0
+1c23 : 85 1f __ STA ADDR + 0
+1c25 : b5 01 __ LDA $01,x
+1c27 : 65 1c __ ADC ACCU + 1
+1c29 : 85 20 __ STA ADDR + 1
+1c2b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1c2e : b1 19 __ LDA (IP + 0),y
+1c30 : aa __ __ TAX
+1c31 : c8 __ __ INY
+1c32 : b1 19 __ LDA (IP + 0),y
+1c34 : 84 02 __ STY $02
+1c36 : a8 __ __ TAY
+1c37 : b1 25 __ LDA (FP + 0),y
+1c39 : 95 00 __ STA $00,x
+1c3b : a4 02 __ LDY $02
+1c3d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1c40 : b1 19 __ LDA (IP + 0),y
+1c42 : aa __ __ TAX
+1c43 : c8 __ __ INY
+1c44 : b1 19 __ LDA (IP + 0),y
+1c46 : 84 02 __ STY $02
+1c48 : a8 __ __ TAY
+1c49 : b1 25 __ LDA (FP + 0),y
+1c4b : 95 00 __ STA $00,x
+1c4d : a9 00 __ LDA #$00
+1c4f : 95 01 __ STA $01,x
+1c51 : a4 02 __ LDY $02
+1c53 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1c56 : b1 19 __ LDA (IP + 0),y
+1c58 : aa __ __ TAX
+1c59 : c8 __ __ INY
+1c5a : b1 19 __ LDA (IP + 0),y
+1c5c : 84 02 __ STY $02
+1c5e : a8 __ __ TAY
+1c5f : b1 25 __ LDA (FP + 0),y
+1c61 : 95 00 __ STA $00,x
+1c63 : c8 __ __ INY
+1c64 : b1 25 __ LDA (FP + 0),y
+1c66 : 95 01 __ STA $01,x
+1c68 : a4 02 __ LDY $02
+1c6a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1c6d : b1 19 __ LDA (IP + 0),y
+1c6f : aa __ __ TAX
+1c70 : c8 __ __ INY
+1c71 : b1 19 __ LDA (IP + 0),y
+1c73 : 84 02 __ STY $02
+1c75 : a8 __ __ TAY
+1c76 : b5 00 __ LDA $00,x
+1c78 : 91 25 __ STA (FP + 0),y
+1c7a : a4 02 __ LDY $02
+1c7c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1c7f : b1 19 __ LDA (IP + 0),y
+1c81 : aa __ __ TAX
+1c82 : c8 __ __ INY
+1c83 : b1 19 __ LDA (IP + 0),y
+1c85 : 84 02 __ STY $02
+1c87 : a8 __ __ TAY
+1c88 : b5 00 __ LDA $00,x
+1c8a : 91 25 __ STA (FP + 0),y
+1c8c : c8 __ __ INY
+1c8d : b5 01 __ LDA $01,x
+1c8f : 91 25 __ STA (FP + 0),y
+1c91 : a4 02 __ LDY $02
+1c93 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1c96 : b1 19 __ LDA (IP + 0),y
+1c98 : aa __ __ TAX
+1c99 : c8 __ __ INY
+1c9a : 18 __ __ CLC
+1c9b : b1 19 __ LDA (IP + 0),y
+1c9d : 65 25 __ ADC FP + 0
+1c9f : 95 00 __ STA $00,x
+1ca1 : c8 __ __ INY
+1ca2 : b1 19 __ LDA (IP + 0),y
+1ca4 : 65 26 __ ADC FP + 1
+1ca6 : 95 01 __ STA $01,x
+1ca8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1cab : b1 19 __ LDA (IP + 0),y
+1cad : aa __ __ TAX
+1cae : c8 __ __ INY
+1caf : b1 19 __ LDA (IP + 0),y
+1cb1 : 84 02 __ STY $02
+1cb3 : a8 __ __ TAY
+1cb4 : b5 00 __ LDA $00,x
+1cb6 : 91 23 __ STA (SP + 0),y
+1cb8 : a4 02 __ LDY $02
+1cba : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1cbd : b1 19 __ LDA (IP + 0),y
+1cbf : aa __ __ TAX
+1cc0 : c8 __ __ INY
+1cc1 : b1 19 __ LDA (IP + 0),y
+1cc3 : 84 02 __ STY $02
+1cc5 : a8 __ __ TAY
+1cc6 : b5 00 __ LDA $00,x
+1cc8 : 91 23 __ STA (SP + 0),y
+1cca : c8 __ __ INY
+1ccb : b5 01 __ LDA $01,x
+1ccd : 91 23 __ STA (SP + 0),y
+1ccf : a4 02 __ LDY $02
+1cd1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1cd4 : b1 19 __ LDA (IP + 0),y
+1cd6 : aa __ __ TAX
+1cd7 : c8 __ __ INY
+1cd8 : b1 19 __ LDA (IP + 0),y
+1cda : 84 02 __ STY $02
+1cdc : a8 __ __ TAY
+1cdd : b5 00 __ LDA $00,x
+1cdf : 91 23 __ STA (SP + 0),y
+1ce1 : c8 __ __ INY
+1ce2 : b5 01 __ LDA $01,x
+1ce4 : 91 23 __ STA (SP + 0),y
+1ce6 : c8 __ __ INY
+1ce7 : b5 02 __ LDA $02,x
+1ce9 : 91 23 __ STA (SP + 0),y
+1ceb : c8 __ __ INY
+1cec : b5 03 __ LDA $03,x
+1cee : 91 23 __ STA (SP + 0),y
+1cf0 : a4 02 __ LDY $02
+1cf2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1cf5 : b1 19 __ LDA (IP + 0),y
+1cf7 : 85 1f __ STA ADDR + 0
+1cf9 : c8 __ __ INY
+1cfa : b1 19 __ LDA (IP + 0),y
+1cfc : 85 20 __ STA ADDR + 1
+1cfe : c8 __ __ INY
+1cff : b1 19 __ LDA (IP + 0),y
+1d01 : aa __ __ TAX
+1d02 : 84 02 __ STY $02
+1d04 : a0 00 __ LDY #$00
+1d06 : b1 1f __ LDA (ADDR + 0),y
+1d08 : 95 00 __ STA $00,x
+1d0a : a4 02 __ LDY $02
+1d0c : 4c 50 08 JMP $0850 ; (startup + 79)
+1d0f : b1 19 __ LDA (IP + 0),y
+1d11 : aa __ __ TAX
+1d12 : c8 __ __ INY
+1d13 : b1 19 __ LDA (IP + 0),y
+1d15 : 84 02 __ STY $02
+1d17 : a8 __ __ TAY
+1d18 : 4c 06 1d JMP $1d06 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1d1b : b1 19 __ LDA (IP + 0),y
+1d1d : 85 1f __ STA ADDR + 0
+1d1f : c8 __ __ INY
+1d20 : b1 19 __ LDA (IP + 0),y
+1d22 : 85 20 __ STA ADDR + 1
+1d24 : c8 __ __ INY
+1d25 : b1 19 __ LDA (IP + 0),y
+1d27 : aa __ __ TAX
+1d28 : 84 02 __ STY $02
+1d2a : a0 00 __ LDY #$00
+1d2c : b1 1f __ LDA (ADDR + 0),y
+1d2e : 95 00 __ STA $00,x
+1d30 : a9 00 __ LDA #$00
+1d32 : 95 01 __ STA $01,x
+1d34 : a4 02 __ LDY $02
+1d36 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d39 : b1 19 __ LDA (IP + 0),y
+1d3b : aa __ __ TAX
+1d3c : c8 __ __ INY
+1d3d : b1 19 __ LDA (IP + 0),y
+1d3f : 84 02 __ STY $02
+1d41 : a8 __ __ TAY
+1d42 : 4c 2c 1d JMP $1d2c ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1d45 : b1 19 __ LDA (IP + 0),y
+1d47 : 85 1f __ STA ADDR + 0
+1d49 : c8 __ __ INY
+1d4a : b1 19 __ LDA (IP + 0),y
+1d4c : 85 20 __ STA ADDR + 1
+1d4e : c8 __ __ INY
+1d4f : b1 19 __ LDA (IP + 0),y
+1d51 : aa __ __ TAX
+1d52 : 84 02 __ STY $02
+1d54 : a0 00 __ LDY #$00
+1d56 : b1 1f __ LDA (ADDR + 0),y
+1d58 : 95 00 __ STA $00,x
+1d5a : c8 __ __ INY
+1d5b : b1 1f __ LDA (ADDR + 0),y
+1d5d : 95 01 __ STA $01,x
+1d5f : a4 02 __ LDY $02
+1d61 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d64 : b1 19 __ LDA (IP + 0),y
+1d66 : aa __ __ TAX
+1d67 : c8 __ __ INY
+1d68 : b1 19 __ LDA (IP + 0),y
+1d6a : 84 02 __ STY $02
+1d6c : a8 __ __ TAY
+1d6d : 4c 56 1d JMP $1d56 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1d70 : b1 19 __ LDA (IP + 0),y
+1d72 : 85 1f __ STA ADDR + 0
+1d74 : c8 __ __ INY
+1d75 : b1 19 __ LDA (IP + 0),y
+1d77 : 85 20 __ STA ADDR + 1
+1d79 : c8 __ __ INY
+1d7a : b1 19 __ LDA (IP + 0),y
+1d7c : aa __ __ TAX
+1d7d : 84 02 __ STY $02
+1d7f : a0 00 __ LDY #$00
+1d81 : b5 00 __ LDA $00,x
+1d83 : 91 1f __ STA (ADDR + 0),y
+1d85 : a4 02 __ LDY $02
+1d87 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d8a : b1 19 __ LDA (IP + 0),y
+1d8c : aa __ __ TAX
+1d8d : c8 __ __ INY
+1d8e : b1 19 __ LDA (IP + 0),y
+1d90 : 84 02 __ STY $02
+1d92 : a8 __ __ TAY
+1d93 : 4c 81 1d JMP $1d81 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1d96 : b1 19 __ LDA (IP + 0),y
+1d98 : aa __ __ TAX
+1d99 : 18 __ __ CLC
+1d9a : a5 1b __ LDA ACCU + 0
+1d9c : 75 00 __ ADC $00,x
+1d9e : 85 1b __ STA ACCU + 0
+1da0 : a5 1c __ LDA ACCU + 1
+1da2 : 75 01 __ ADC $01,x
+1da4 : 85 1c __ STA ACCU + 1
+1da6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1da9 : b1 19 __ LDA (IP + 0),y
+1dab : aa __ __ TAX
+1dac : 38 __ __ SEC
+1dad : a5 1b __ LDA ACCU + 0
+1daf : f5 00 __ SBC $00,x
+1db1 : 85 1b __ STA ACCU + 0
+1db3 : a5 1c __ LDA ACCU + 1
+1db5 : f5 01 __ SBC $01,x
+1db7 : 85 1c __ STA ACCU + 1
+1db9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1dbc : b1 19 __ LDA (IP + 0),y
+1dbe : aa __ __ TAX
+1dbf : b5 00 __ LDA $00,x
+1dc1 : 85 03 __ STA $03
+1dc3 : b5 01 __ LDA $01,x
+1dc5 : 85 04 __ STA $04
+1dc7 : 20 ec 18 JSR $18ec ; (divmod + 0)
+1dca : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1dcd : b1 19 __ LDA (IP + 0),y
+1dcf : aa __ __ TAX
+1dd0 : b5 00 __ LDA $00,x
+1dd2 : 85 03 __ STA $03
+1dd4 : b5 01 __ LDA $01,x
+1dd6 : 85 04 __ STA $04
+1dd8 : 20 ec 18 JSR $18ec ; (divmod + 0)
+1ddb : a5 05 __ LDA $05
+1ddd : 85 1b __ STA ACCU + 0
+1ddf : a5 06 __ LDA $06
+1de1 : 85 1c __ STA ACCU + 1
+1de3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1de6 : b1 19 __ LDA (IP + 0),y
+1de8 : aa __ __ TAX
+1de9 : b5 00 __ LDA $00,x
+1deb : 85 03 __ STA $03
+1ded : b5 01 __ LDA $01,x
+1def : 85 04 __ STA $04
+1df1 : 24 1c __ BIT ACCU + 1
+1df3 : 10 10 __ BPL $1e05
+1df5 : 20 d0 18 JSR $18d0 ; (negaccu + 0)
+1df8 : 24 04 __ BIT $04
+1dfa : 10 10 __ BPL $1e0c
+1dfc : 20 de 18 JSR $18de ; (negtmp + 0)
+1dff : 20 ec 18 JSR $18ec ; (divmod + 0)
+1e02 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e05 : 24 04 __ BIT $04
+1e07 : 10 f6 __ BPL $1dff
+1e09 : 20 de 18 JSR $18de ; (negtmp + 0)
+1e0c : 20 ec 18 JSR $18ec ; (divmod + 0)
+1e0f : 20 d0 18 JSR $18d0 ; (negaccu + 0)
+1e12 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1e15 : b1 19 __ LDA (IP + 0),y
+1e17 : aa __ __ TAX
+1e18 : b5 00 __ LDA $00,x
+1e1a : 85 03 __ STA $03
+1e1c : b5 01 __ LDA $01,x
+1e1e : 85 04 __ STA $04
+1e20 : 24 1c __ BIT ACCU + 1
+1e22 : 10 18 __ BPL $1e3c
+1e24 : 20 d0 18 JSR $18d0 ; (negaccu + 0)
+1e27 : 24 04 __ BIT $04
+1e29 : 10 18 __ BPL $1e43
+1e2b : 20 de 18 JSR $18de ; (negtmp + 0)
+1e2e : 20 ec 18 JSR $18ec ; (divmod + 0)
+1e31 : a5 05 __ LDA $05
+1e33 : 85 1b __ STA ACCU + 0
+1e35 : a5 06 __ LDA $06
+1e37 : 85 1c __ STA ACCU + 1
+1e39 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e3c : 24 04 __ BIT $04
+1e3e : 10 ee __ BPL $1e2e
+1e40 : 20 de 18 JSR $18de ; (negtmp + 0)
+1e43 : 20 ec 18 JSR $18ec ; (divmod + 0)
+1e46 : a5 05 __ LDA $05
+1e48 : 85 1b __ STA ACCU + 0
+1e4a : a5 06 __ LDA $06
+1e4c : 85 1c __ STA ACCU + 1
+1e4e : 20 d0 18 JSR $18d0 ; (negaccu + 0)
+1e51 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1e54 : b1 19 __ LDA (IP + 0),y
+1e56 : aa __ __ TAX
+1e57 : 18 __ __ CLC
+1e58 : b5 00 __ LDA $00,x
+1e5a : 65 1b __ ADC ACCU + 0
+1e5c : 95 00 __ STA $00,x
+1e5e : b5 01 __ LDA $01,x
+1e60 : 65 1c __ ADC ACCU + 1
+1e62 : 95 01 __ STA $01,x
+1e64 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1e67 : b1 19 __ LDA (IP + 0),y
+1e69 : c8 __ __ INY
+1e6a : aa __ __ TAX
+1e6b : 18 __ __ CLC
+1e6c : b5 00 __ LDA $00,x
+1e6e : 71 19 __ ADC (IP + 0),y
+1e70 : c8 __ __ INY
+1e71 : 95 00 __ STA $00,x
+1e73 : b5 01 __ LDA $01,x
+1e75 : 71 19 __ ADC (IP + 0),y
+1e77 : 95 01 __ STA $01,x
+1e79 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1e7c : b1 19 __ LDA (IP + 0),y
+1e7e : c8 __ __ INY
+1e7f : aa __ __ TAX
+1e80 : 38 __ __ SEC
+1e81 : b1 19 __ LDA (IP + 0),y
+1e83 : c8 __ __ INY
+1e84 : f5 00 __ SBC $00,x
+1e86 : 95 00 __ STA $00,x
+1e88 : b1 19 __ LDA (IP + 0),y
+1e8a : f5 01 __ SBC $01,x
+1e8c : 95 01 __ STA $01,x
+1e8e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1e91 : b1 19 __ LDA (IP + 0),y
+1e93 : c8 __ __ INY
+1e94 : aa __ __ TAX
+1e95 : b5 00 __ LDA $00,x
+1e97 : 31 19 __ AND (IP + 0),y
+1e99 : c8 __ __ INY
+1e9a : 95 00 __ STA $00,x
+1e9c : b5 01 __ LDA $01,x
+1e9e : 31 19 __ AND (IP + 0),y
+1ea0 : 95 01 __ STA $01,x
+1ea2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1ea5 : b1 19 __ LDA (IP + 0),y
+1ea7 : c8 __ __ INY
+1ea8 : aa __ __ TAX
+1ea9 : a9 00 __ LDA #$00
+1eab : 85 05 __ STA $05
+1ead : 85 06 __ STA $06
+1eaf : b5 00 __ LDA $00,x
+1eb1 : 85 03 __ STA $03
+1eb3 : b5 01 __ LDA $01,x
+1eb5 : 85 04 __ STA $04
+1eb7 : b1 19 __ LDA (IP + 0),y
+1eb9 : 4a __ __ LSR
+1eba : 85 07 __ STA $07
+1ebc : 90 0d __ BCC $1ecb
+1ebe : 18 __ __ CLC
+1ebf : a5 05 __ LDA $05
+1ec1 : 65 03 __ ADC $03
+1ec3 : 85 05 __ STA $05
+1ec5 : a5 06 __ LDA $06
+1ec7 : 65 04 __ ADC $04
+1ec9 : 85 06 __ STA $06
+1ecb : 06 03 __ ASL $03
+1ecd : 26 04 __ ROL $04
+1ecf : 46 07 __ LSR $07
+1ed1 : b0 eb __ BCS $1ebe
+1ed3 : d0 f6 __ BNE $1ecb
+1ed5 : a5 05 __ LDA $05
+1ed7 : 95 00 __ STA $00,x
+1ed9 : a5 06 __ LDA $06
+1edb : 95 01 __ STA $01,x
+1edd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1ee0 : b1 19 __ LDA (IP + 0),y
+1ee2 : c8 __ __ INY
+1ee3 : aa __ __ TAX
+1ee4 : 18 __ __ CLC
+1ee5 : b5 00 __ LDA $00,x
+1ee7 : 71 19 __ ADC (IP + 0),y
+1ee9 : 95 00 __ STA $00,x
+1eeb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1eee : b1 19 __ LDA (IP + 0),y
+1ef0 : aa __ __ TAX
+1ef1 : 38 __ __ SEC
+1ef2 : b5 01 __ LDA $01,x
+1ef4 : e5 1c __ SBC ACCU + 1
+1ef6 : f0 11 __ BEQ $1f09
+1ef8 : 50 02 __ BVC $1efc
+1efa : 49 80 __ EOR #$80
+1efc : 30 2a __ BMI $1f28
+1efe : 10 33 __ BPL $1f33
+1f00 : b1 19 __ LDA (IP + 0),y
+1f02 : aa __ __ TAX
+1f03 : b5 01 __ LDA $01,x
+1f05 : c5 1c __ CMP ACCU + 1
+1f07 : d0 28 __ BNE $1f31
+1f09 : b5 00 __ LDA $00,x
+1f0b : c5 1b __ CMP ACCU + 0
+1f0d : d0 22 __ BNE $1f31
+1f0f : f0 0e __ BEQ $1f1f
+1f11 : b1 19 __ LDA (IP + 0),y
+1f13 : aa __ __ TAX
+1f14 : c8 __ __ INY
+1f15 : b1 19 __ LDA (IP + 0),y
+1f17 : c5 1c __ CMP ACCU + 1
+1f19 : d0 16 __ BNE $1f31
+1f1b : e4 1b __ CPX ACCU + 0
+1f1d : d0 12 __ BNE $1f31
+1f1f : a9 00 __ LDA #$00
+1f21 : 85 1b __ STA ACCU + 0
+1f23 : 85 1c __ STA ACCU + 1
+1f25 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f28 : a9 ff __ LDA #$ff
+1f2a : 85 1b __ STA ACCU + 0
+1f2c : 85 1c __ STA ACCU + 1
+1f2e : 4c 50 08 JMP $0850 ; (startup + 79)
+1f31 : 90 f5 __ BCC $1f28
+1f33 : a9 01 __ LDA #$01
+1f35 : 85 1b __ STA ACCU + 0
+1f37 : a9 00 __ LDA #$00
+1f39 : 85 1c __ STA ACCU + 1
+1f3b : 4c 50 08 JMP $0850 ; (startup + 79)
+1f3e : b1 19 __ LDA (IP + 0),y
+1f40 : c8 __ __ INY
+1f41 : aa __ __ TAX
+1f42 : b1 19 __ LDA (IP + 0),y
+1f44 : 38 __ __ SEC
+1f45 : e5 1c __ SBC ACCU + 1
+1f47 : d0 af __ BNE $1ef8
+1f49 : e4 1b __ CPX ACCU + 0
+1f4b : d0 e4 __ BNE $1f31
+1f4d : f0 d0 __ BEQ $1f1f
+1f4f : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+1f50 : b1 19 __ LDA (IP + 0),y
+1f52 : aa __ __ TAX
+1f53 : 38 __ __ SEC
+1f54 : b5 00 __ LDA $00,x
+1f56 : e5 1b __ SBC ACCU + 0
+1f58 : f0 19 __ BEQ $1f73
+1f5a : 50 02 __ BVC $1f5e
+1f5c : 49 80 __ EOR #$80
+1f5e : 30 1c __ BMI $1f7c
+1f60 : 10 25 __ BPL $1f87
+1f62 : b1 19 __ LDA (IP + 0),y
+1f64 : aa __ __ TAX
+1f65 : b5 00 __ LDA $00,x
+1f67 : c5 1b __ CMP ACCU + 0
+1f69 : d0 1a __ BNE $1f85
+1f6b : f0 06 __ BEQ $1f73
+1f6d : b1 19 __ LDA (IP + 0),y
+1f6f : c5 1b __ CMP ACCU + 0
+1f71 : d0 12 __ BNE $1f85
+1f73 : a9 00 __ LDA #$00
+1f75 : 85 1b __ STA ACCU + 0
+1f77 : 85 1c __ STA ACCU + 1
+1f79 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f7c : a9 ff __ LDA #$ff
+1f7e : 85 1b __ STA ACCU + 0
+1f80 : 85 1c __ STA ACCU + 1
+1f82 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f85 : 90 f5 __ BCC $1f7c
+1f87 : a9 01 __ LDA #$01
+1f89 : 85 1b __ STA ACCU + 0
+1f8b : a9 00 __ LDA #$00
+1f8d : 85 1c __ STA ACCU + 1
+1f8f : 4c 50 08 JMP $0850 ; (startup + 79)
+1f92 : b1 19 __ LDA (IP + 0),y
+1f94 : 38 __ __ SEC
+1f95 : e5 1b __ SBC ACCU + 0
+1f97 : d0 c1 __ BNE $1f5a
+1f99 : f0 d8 __ BEQ $1f73
+1f9b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+1f9c : 38 __ __ SEC
+1f9d : a9 00 __ LDA #$00
+1f9f : e5 1b __ SBC ACCU + 0
+1fa1 : 85 1b __ STA ACCU + 0
+1fa3 : a9 00 __ LDA #$00
+1fa5 : e5 1c __ SBC ACCU + 1
+1fa7 : 85 1c __ STA ACCU + 1
+1fa9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+1fac : 20 a7 16 JSR $16a7 ; (freg + 0)
+1faf : 20 ec 16 JSR $16ec ; (faddsub + 0)
+1fb2 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+1fb5 : 20 a7 16 JSR $16a7 ; (freg + 0)
+1fb8 : a5 06 __ LDA $06
+1fba : 49 80 __ EOR #$80
+1fbc : 85 06 __ STA $06
+1fbe : 20 ec 16 JSR $16ec ; (faddsub + 0)
+1fc1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+1fc4 : 20 a7 16 JSR $16a7 ; (freg + 0)
+1fc7 : 84 02 __ STY $02
+1fc9 : 20 b4 17 JSR $17b4 ; (fmul + 0)
+1fcc : a4 02 __ LDY $02
+1fce : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+1fd1 : 20 a7 16 JSR $16a7 ; (freg + 0)
+1fd4 : 20 52 18 JSR $1852 ; (fdiv + 0)
+1fd7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+1fda : b1 19 __ LDA (IP + 0),y
+1fdc : c8 __ __ INY
+1fdd : aa __ __ TAX
+1fde : a5 1e __ LDA ACCU + 3
+1fe0 : 55 03 __ EOR $03,x
+1fe2 : 29 80 __ AND #$80
+1fe4 : f0 1e __ BEQ $2004
+1fe6 : a5 1e __ LDA ACCU + 3
+1fe8 : 29 7f __ AND #$7f
+1fea : 05 1d __ ORA ACCU + 2
+1fec : 05 1c __ ORA ACCU + 1
+1fee : 05 1b __ ORA ACCU + 0
+1ff0 : d0 0c __ BNE $1ffe
+1ff2 : b5 03 __ LDA $03,x
+1ff4 : 29 7f __ AND #$7f
+1ff6 : 15 02 __ ORA $02,x
+1ff8 : 15 01 __ ORA $01,x
+1ffa : 15 00 __ ORA $00,x
+1ffc : f0 1e __ BEQ $201c
+1ffe : a5 1e __ LDA ACCU + 3
+2000 : 30 29 __ BMI $202b
+2002 : 10 36 __ BPL $203a
+2004 : a5 1e __ LDA ACCU + 3
+2006 : d5 03 __ CMP $03,x
+2008 : d0 1b __ BNE $2025
+200a : a5 1d __ LDA ACCU + 2
+200c : d5 02 __ CMP $02,x
+200e : d0 15 __ BNE $2025
+2010 : a5 1c __ LDA ACCU + 1
+2012 : d5 01 __ CMP $01,x
+2014 : d0 0f __ BNE $2025
+2016 : a5 1b __ LDA ACCU + 0
+2018 : d5 00 __ CMP $00,x
+201a : d0 09 __ BNE $2025
+201c : a9 00 __ LDA #$00
+201e : 85 1b __ STA ACCU + 0
+2020 : 85 1c __ STA ACCU + 1
+2022 : 4c 51 08 JMP $0851 ; (startup + 80)
+2025 : b0 0f __ BCS $2036
+2027 : 24 1e __ BIT ACCU + 3
+2029 : 30 0f __ BMI $203a
+202b : a9 00 __ LDA #$00
+202d : 85 1c __ STA ACCU + 1
+202f : a9 01 __ LDA #$01
+2031 : 85 1b __ STA ACCU + 0
+2033 : 4c 51 08 JMP $0851 ; (startup + 80)
+2036 : 24 1e __ BIT ACCU + 3
+2038 : 30 f1 __ BMI $202b
+203a : a9 ff __ LDA #$ff
+203c : 85 1b __ STA ACCU + 0
+203e : 85 1c __ STA ACCU + 1
+2040 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+2043 : a5 1e __ LDA ACCU + 3
+2045 : 49 80 __ EOR #$80
+2047 : 85 1e __ STA ACCU + 3
+2049 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_abs_f32:
+204c : a5 1e __ LDA ACCU + 3
+204e : 29 7f __ AND #$7f
+2050 : 85 1e __ STA ACCU + 3
+2052 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+2055 : 20 b3 19 JSR $19b3 ; (sint16_to_float + 0)
+2058 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+205b : 20 71 19 JSR $1971 ; (f32_to_i16 + 0)
+205e : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+2061 : b1 19 __ LDA (IP + 0),y
+2063 : 30 0c __ BMI $2071
+2065 : 38 __ __ SEC
+2066 : 65 19 __ ADC IP + 0
+2068 : 85 19 __ STA IP + 0
+206a : 90 02 __ BCC $206e
+206c : e6 1a __ INC IP + 1
+206e : 4c 51 08 JMP $0851 ; (startup + 80)
+2071 : 38 __ __ SEC
+2072 : 65 19 __ ADC IP + 0
+2074 : 85 19 __ STA IP + 0
+2076 : b0 02 __ BCS $207a
+2078 : c6 1a __ DEC IP + 1
+207a : 4c 51 08 JMP $0851 ; (startup + 80)
+207d : a5 1b __ LDA ACCU + 0
+207f : 05 1c __ ORA ACCU + 1
+2081 : f0 de __ BEQ $2061
+2083 : 4c 50 08 JMP $0850 ; (startup + 79)
+2086 : a5 1b __ LDA ACCU + 0
+2088 : 05 1c __ ORA ACCU + 1
+208a : d0 d5 __ BNE $2061
+208c : 4c 50 08 JMP $0850 ; (startup + 79)
+208f : a5 1c __ LDA ACCU + 1
+2091 : 30 04 __ BMI $2097
+2093 : 05 1b __ ORA ACCU + 0
+2095 : d0 ca __ BNE $2061
+2097 : 4c 50 08 JMP $0850 ; (startup + 79)
+209a : a5 1c __ LDA ACCU + 1
+209c : 10 c3 __ BPL $2061
+209e : 4c 50 08 JMP $0850 ; (startup + 79)
+20a1 : a5 1c __ LDA ACCU + 1
+20a3 : 30 bc __ BMI $2061
+20a5 : 4c 50 08 JMP $0850 ; (startup + 79)
+20a8 : a5 1c __ LDA ACCU + 1
+20aa : 30 b5 __ BMI $2061
+20ac : 05 1b __ ORA ACCU + 0
+20ae : f0 b1 __ BEQ $2061
+20b0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+20b3 : 38 __ __ SEC
+20b4 : b1 19 __ LDA (IP + 0),y
+20b6 : 65 19 __ ADC IP + 0
+20b8 : aa __ __ TAX
+20b9 : c8 __ __ INY
+20ba : b1 19 __ LDA (IP + 0),y
+20bc : 65 1a __ ADC IP + 1
+20be : 85 1a __ STA IP + 1
+20c0 : 86 19 __ STX IP + 0
+20c2 : 4c 51 08 JMP $0851 ; (startup + 80)
+20c5 : a5 1b __ LDA ACCU + 0
+20c7 : 05 1c __ ORA ACCU + 1
+20c9 : f0 e8 __ BEQ $20b3
+20cb : c8 __ __ INY
+20cc : 4c 50 08 JMP $0850 ; (startup + 79)
+20cf : a5 1b __ LDA ACCU + 0
+20d1 : 05 1c __ ORA ACCU + 1
+20d3 : d0 de __ BNE $20b3
+20d5 : c8 __ __ INY
+20d6 : 4c 50 08 JMP $0850 ; (startup + 79)
+20d9 : a5 1c __ LDA ACCU + 1
+20db : 30 04 __ BMI $20e1
+20dd : 05 1b __ ORA ACCU + 0
+20df : d0 d2 __ BNE $20b3
+20e1 : c8 __ __ INY
+20e2 : 4c 50 08 JMP $0850 ; (startup + 79)
+20e5 : a5 1c __ LDA ACCU + 1
+20e7 : 10 ca __ BPL $20b3
+20e9 : c8 __ __ INY
+20ea : 4c 50 08 JMP $0850 ; (startup + 79)
+20ed : a5 1c __ LDA ACCU + 1
+20ef : 30 c2 __ BMI $20b3
+20f1 : c8 __ __ INY
+20f2 : 4c 50 08 JMP $0850 ; (startup + 79)
+20f5 : a5 1c __ LDA ACCU + 1
+20f7 : 30 ba __ BMI $20b3
+20f9 : 05 1b __ ORA ACCU + 0
+20fb : f0 b6 __ BEQ $20b3
+20fd : c8 __ __ INY
+20fe : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2101 : a9 00 __ LDA #$00
+2103 : 2c a9 01 BIT $01a9 
+2106 : 85 1b __ STA ACCU + 0
+2108 : a9 00 __ LDA #$00
+210a : 85 1c __ STA ACCU + 1
+210c : 4c 51 08 JMP $0851 ; (startup + 80)
+210f : a5 1b __ LDA ACCU + 0
+2111 : 05 1c __ ORA ACCU + 1
+2113 : f0 ef __ BEQ $2104
+2115 : d0 ea __ BNE $2101
+2117 : a5 1b __ LDA ACCU + 0
+2119 : 05 1c __ ORA ACCU + 1
+211b : d0 e7 __ BNE $2104
+211d : f0 e2 __ BEQ $2101
+211f : a5 1c __ LDA ACCU + 1
+2121 : 30 de __ BMI $2101
+2123 : 05 1b __ ORA ACCU + 0
+2125 : d0 dd __ BNE $2104
+2127 : f0 d8 __ BEQ $2101
+2129 : a5 1c __ LDA ACCU + 1
+212b : 10 d7 __ BPL $2104
+212d : 30 d2 __ BMI $2101
+212f : a5 1c __ LDA ACCU + 1
+2131 : 30 d1 __ BMI $2104
+2133 : 10 cc __ BPL $2101
+2135 : a5 1c __ LDA ACCU + 1
+2137 : 30 cb __ BMI $2104
+2139 : 05 1b __ ORA ACCU + 0
+213b : f0 c7 __ BEQ $2104
+213d : d0 c2 __ BNE $2101
+213f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+2140 : b1 19 __ LDA (IP + 0),y
+2142 : 8d 56 21 STA $2156 ; (inp_jsr + 22)
+2145 : c8 __ __ INY
+2146 : b1 19 __ LDA (IP + 0),y
+2148 : 8d 57 21 STA $2157 ; (inp_jsr + 23)
+214b : 98 __ __ TYA
+214c : 38 __ __ SEC
+214d : 65 19 __ ADC IP + 0
+214f : 85 19 __ STA IP + 0
+2151 : 90 02 __ BCC $2155
+2153 : e6 1a __ INC IP + 1
+2155 : 20 00 00 JSR $0000 
+2158 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+215b : 98 __ __ TYA
+215c : 18 __ __ CLC
+215d : 65 19 __ ADC IP + 0
+215f : 8d 6a 21 STA $216a ; (inp_native + 15)
+2162 : a5 1a __ LDA IP + 1
+2164 : 69 00 __ ADC #$00
+2166 : 8d 6b 21 STA $216b ; (inp_native + 16)
+2169 : 20 00 00 JSR $0000 
+216c : a0 00 __ LDY #$00
+216e : b1 23 __ LDA (SP + 0),y
+2170 : 85 19 __ STA IP + 0
+2172 : c8 __ __ INY
+2173 : b1 23 __ LDA (SP + 0),y
+2175 : 85 1a __ STA IP + 1
+2177 : 88 __ __ DEY
+2178 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+217b : 38 __ __ SEC
+217c : a5 23 __ LDA SP + 0
+217e : f1 19 __ SBC (IP + 0),y
+2180 : c8 __ __ INY
+2181 : 85 23 __ STA SP + 0
+2183 : a5 24 __ LDA SP + 1
+2185 : f1 19 __ SBC (IP + 0),y
+2187 : c8 __ __ INY
+2188 : 85 24 __ STA SP + 1
+218a : b1 19 __ LDA (IP + 0),y
+218c : 84 02 __ STY $02
+218e : a8 __ __ TAY
+218f : a5 25 __ LDA FP + 0
+2191 : 91 23 __ STA (SP + 0),y
+2193 : c8 __ __ INY
+2194 : a5 26 __ LDA FP + 1
+2196 : 91 23 __ STA (SP + 0),y
+2198 : 98 __ __ TYA
+2199 : 38 __ __ SEC
+219a : 65 23 __ ADC SP + 0
+219c : 85 25 __ STA FP + 0
+219e : a9 00 __ LDA #$00
+21a0 : 65 24 __ ADC SP + 1
+21a2 : 85 26 __ STA FP + 1
+21a4 : 88 __ __ DEY
+21a5 : f0 08 __ BEQ $21af
+21a7 : b9 52 00 LDA $0052,y 
+21aa : 88 __ __ DEY
+21ab : 91 23 __ STA (SP + 0),y
+21ad : d0 f8 __ BNE $21a7
+21af : a4 02 __ LDY $02
+21b1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+21b4 : b1 19 __ LDA (IP + 0),y
+21b6 : c8 __ __ INY
+21b7 : 84 02 __ STY $02
+21b9 : a8 __ __ TAY
+21ba : b1 23 __ LDA (SP + 0),y
+21bc : 85 25 __ STA FP + 0
+21be : c8 __ __ INY
+21bf : b1 23 __ LDA (SP + 0),y
+21c1 : 85 26 __ STA FP + 1
+21c3 : 88 __ __ DEY
+21c4 : f0 09 __ BEQ $21cf
+21c6 : 88 __ __ DEY
+21c7 : b1 23 __ LDA (SP + 0),y
+21c9 : 99 53 00 STA $0053,y 
+21cc : 88 __ __ DEY
+21cd : 10 f8 __ BPL $21c7
+21cf : a4 02 __ LDY $02
+21d1 : 18 __ __ CLC
+21d2 : b1 19 __ LDA (IP + 0),y
+21d4 : c8 __ __ INY
+21d5 : 65 23 __ ADC SP + 0
+21d7 : 85 23 __ STA SP + 0
+21d9 : b1 19 __ LDA (IP + 0),y
+21db : c8 __ __ INY
+21dc : 65 24 __ ADC SP + 1
+21de : 85 24 __ STA SP + 1
+21e0 : a0 01 __ LDY #$01
+21e2 : b1 23 __ LDA (SP + 0),y
+21e4 : 85 1a __ STA IP + 1
+21e6 : 88 __ __ DEY
+21e7 : b1 23 __ LDA (SP + 0),y
+21e9 : 85 19 __ STA IP + 0
+21eb : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+21ee : b1 19 __ LDA (IP + 0),y
+21f0 : 85 1f __ STA ADDR + 0
+21f2 : c8 __ __ INY
+21f3 : b1 19 __ LDA (IP + 0),y
+21f5 : 85 20 __ STA ADDR + 1
+21f7 : c8 __ __ INY
+21f8 : 98 __ __ TYA
+21f9 : a0 00 __ LDY #$00
+21fb : 18 __ __ CLC
+21fc : 65 19 __ ADC IP + 0
+21fe : 91 23 __ STA (SP + 0),y
+2200 : c8 __ __ INY
+2201 : a5 1a __ LDA IP + 1
+2203 : 69 00 __ ADC #$00
+2205 : 91 23 __ STA (SP + 0),y
+2207 : a5 1f __ LDA ADDR + 0
+2209 : 85 19 __ STA IP + 0
+220b : a5 20 __ LDA ADDR + 1
+220d : 85 1a __ STA IP + 1
+220f : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2212 : 38 __ __ SEC
+2213 : a5 23 __ LDA SP + 0
+2215 : f1 19 __ SBC (IP + 0),y
+2217 : c8 __ __ INY
+2218 : 85 23 __ STA SP + 0
+221a : a5 24 __ LDA SP + 1
+221c : f1 19 __ SBC (IP + 0),y
+221e : 85 24 __ STA SP + 1
+2220 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2223 : 18 __ __ CLC
+2224 : b1 19 __ LDA (IP + 0),y
+2226 : c8 __ __ INY
+2227 : 65 23 __ ADC SP + 0
+2229 : 85 23 __ STA SP + 0
+222b : b1 19 __ LDA (IP + 0),y
+222d : 65 24 __ ADC SP + 1
+222f : 85 24 __ STA SP + 1
+2231 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2234 : b1 19 __ LDA (IP + 0),y
+2236 : c8 __ __ INY
+2237 : 8d 45 22 STA $2245 ; (inp_op_extrt + 17)
+223a : b1 19 __ LDA (IP + 0),y
+223c : c8 __ __ INY
+223d : 8d 46 22 STA $2246 ; (inp_op_extrt + 18)
+2240 : b1 19 __ LDA (IP + 0),y
+2242 : c8 __ __ INY
+2243 : aa __ __ TAX
+2244 : 20 00 00 JSR $0000 
+2247 : 4c 51 08 JMP $0851 ; (startup + 80)
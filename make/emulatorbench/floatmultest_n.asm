@@ -0,0 +1,3319 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 2c 22 STX $222c ; (spentry + 0)
+0811 : a9 36 __ LDA #$36
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 36 __ LDA #$36
+0832 : e9 36 __ SBC #$36
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c d9 1d JMP $1dd9 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 08 __ SBC #$08
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 05 __ LDY #$05
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 12 __ SBC #$12
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T0 + 0
+0928 : 85 54 __ STA T0 + 1
+092a : 85 55 __ STA T0 + 2
+092c : 85 56 __ STA T0 + 3
+092e : 85 57 __ STA T1 + 0
+0930 : 85 58 __ STA T1 + 1
+0932 : a9 9a __ LDA #$9a
+0934 : a0 02 __ LDY #$02
+0936 : 91 23 __ STA (SP + 0),y
+0938 : a9 1d __ LDA #$1d
+093a : c8 __ __ INY
+093b : 91 23 __ STA (SP + 0),y
+093d : a5 57 __ LDA T1 + 0
+093f : 85 1b __ STA ACCU + 0
+0941 : c8 __ __ INY
+0942 : 91 23 __ STA (SP + 0),y
+0944 : a5 58 __ LDA T1 + 1
+0946 : 85 1c __ STA ACCU + 1
+0948 : c8 __ __ INY
+0949 : 91 23 __ STA (SP + 0),y
+094b : ad 2e 22 LDA $222e ; (c + 0)
+094e : 85 43 __ STA T3 + 0
+0950 : ad 2f 22 LDA $222f ; (c + 1)
+0953 : 85 44 __ STA T3 + 1
+0955 : ad 30 22 LDA $2230 ; (c + 2)
+0958 : 85 45 __ STA T3 + 2
+095a : ad 31 22 LDA $2231 ; (c + 3)
+095d : 85 46 __ STA T3 + 3
+095f : 20 39 21 JSR $2139 ; (sint16_to_float + 0)
+0962 : a5 43 __ LDA T3 + 0
+0964 : 85 03 __ STA $03
+0966 : a5 44 __ LDA T3 + 1
+0968 : 85 04 __ STA $04
+096a : a5 45 __ LDA T3 + 2
+096c : 85 05 __ STA $05
+096e : a5 46 __ LDA T3 + 3
+0970 : 85 06 __ STA $06
+0972 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0975 : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+0978 : a5 1b __ LDA ACCU + 0
+097a : a0 06 __ LDY #$06
+097c : 91 23 __ STA (SP + 0),y
+097e : a5 1c __ LDA ACCU + 1
+0980 : c8 __ __ INY
+0981 : 91 23 __ STA (SP + 0),y
+0983 : a5 1d __ LDA ACCU + 2
+0985 : c8 __ __ INY
+0986 : 91 23 __ STA (SP + 0),y
+0988 : a5 1e __ LDA ACCU + 3
+098a : c8 __ __ INY
+098b : 91 23 __ STA (SP + 0),y
+098d : a5 53 __ LDA T0 + 0
+098f : 85 03 __ STA $03
+0991 : c8 __ __ INY
+0992 : 91 23 __ STA (SP + 0),y
+0994 : a5 54 __ LDA T0 + 1
+0996 : 85 04 __ STA $04
+0998 : c8 __ __ INY
+0999 : 91 23 __ STA (SP + 0),y
+099b : a5 55 __ LDA T0 + 2
+099d : 85 05 __ STA $05
+099f : c8 __ __ INY
+09a0 : 91 23 __ STA (SP + 0),y
+09a2 : a5 56 __ LDA T0 + 3
+09a4 : 85 06 __ STA $06
+09a6 : c8 __ __ INY
+09a7 : 91 23 __ STA (SP + 0),y
+09a9 : 20 fa 1d JSR $1dfa ; (freg + 20)
+09ac : a5 06 __ LDA $06
+09ae : 49 80 __ EOR #$80
+09b0 : 85 06 __ STA $06
+09b2 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+09b5 : a5 1b __ LDA ACCU + 0
+09b7 : a0 0e __ LDY #$0e
+09b9 : 91 23 __ STA (SP + 0),y
+09bb : a5 1c __ LDA ACCU + 1
+09bd : c8 __ __ INY
+09be : 91 23 __ STA (SP + 0),y
+09c0 : a5 1d __ LDA ACCU + 2
+09c2 : c8 __ __ INY
+09c3 : 91 23 __ STA (SP + 0),y
+09c5 : a5 1e __ LDA ACCU + 3
+09c7 : c8 __ __ INY
+09c8 : 91 23 __ STA (SP + 0),y
+09ca : 20 a9 0c JSR $0ca9 ; (printf + 0)
+09cd : ad 2e 22 LDA $222e ; (c + 0)
+09d0 : 85 43 __ STA T3 + 0
+09d2 : ad 2f 22 LDA $222f ; (c + 1)
+09d5 : 85 44 __ STA T3 + 1
+09d7 : ad 30 22 LDA $2230 ; (c + 2)
+09da : 85 45 __ STA T3 + 2
+09dc : ad 31 22 LDA $2231 ; (c + 3)
+09df : 85 46 __ STA T3 + 3
+09e1 : a5 57 __ LDA T1 + 0
+09e3 : 85 1b __ STA ACCU + 0
+09e5 : a5 58 __ LDA T1 + 1
+09e7 : 85 1c __ STA ACCU + 1
+09e9 : 20 39 21 JSR $2139 ; (sint16_to_float + 0)
+09ec : a5 43 __ LDA T3 + 0
+09ee : 85 03 __ STA $03
+09f0 : a5 44 __ LDA T3 + 1
+09f2 : 85 04 __ STA $04
+09f4 : a5 45 __ LDA T3 + 2
+09f6 : 85 05 __ STA $05
+09f8 : a5 46 __ LDA T3 + 3
+09fa : 85 06 __ STA $06
+09fc : 20 fa 1d JSR $1dfa ; (freg + 20)
+09ff : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+0a02 : a5 1b __ LDA ACCU + 0
+0a04 : 85 03 __ STA $03
+0a06 : a5 1c __ LDA ACCU + 1
+0a08 : 85 04 __ STA $04
+0a0a : a5 1d __ LDA ACCU + 2
+0a0c : 85 05 __ STA $05
+0a0e : a5 1e __ LDA ACCU + 3
+0a10 : 85 06 __ STA $06
+0a12 : a5 53 __ LDA T0 + 0
+0a14 : 85 1b __ STA ACCU + 0
+0a16 : a5 54 __ LDA T0 + 1
+0a18 : 85 1c __ STA ACCU + 1
+0a1a : a5 55 __ LDA T0 + 2
+0a1c : 85 1d __ STA ACCU + 2
+0a1e : a5 56 __ LDA T0 + 3
+0a20 : 85 1e __ STA ACCU + 3
+0a22 : 20 84 21 JSR $2184 ; (fcmp + 0)
+0a25 : d0 03 __ BNE $0a2a
+0a27 : 4c a4 0c JMP $0ca4 ; (main + 932)
+0a2a : a9 00 __ LDA #$00
+0a2c : a0 02 __ LDY #$02
+0a2e : 91 23 __ STA (SP + 0),y
+0a30 : 20 a7 1d JSR $1da7 ; (assert + 0)
+0a33 : ad 2e 22 LDA $222e ; (c + 0)
+0a36 : 85 1b __ STA ACCU + 0
+0a38 : ad 2f 22 LDA $222f ; (c + 1)
+0a3b : 85 1c __ STA ACCU + 1
+0a3d : ad 30 22 LDA $2230 ; (c + 2)
+0a40 : 85 1d __ STA ACCU + 2
+0a42 : ad 31 22 LDA $2231 ; (c + 3)
+0a45 : 85 1e __ STA ACCU + 3
+0a47 : a5 53 __ LDA T0 + 0
+0a49 : 85 03 __ STA $03
+0a4b : a5 54 __ LDA T0 + 1
+0a4d : 85 04 __ STA $04
+0a4f : a5 55 __ LDA T0 + 2
+0a51 : 85 05 __ STA $05
+0a53 : a5 56 __ LDA T0 + 3
+0a55 : 85 06 __ STA $06
+0a57 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0a5a : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+0a5d : a5 1b __ LDA ACCU + 0
+0a5f : 85 53 __ STA T0 + 0
+0a61 : a5 1c __ LDA ACCU + 1
+0a63 : 85 54 __ STA T0 + 1
+0a65 : a5 1d __ LDA ACCU + 2
+0a67 : 85 55 __ STA T0 + 2
+0a69 : a5 1e __ LDA ACCU + 3
+0a6b : 85 56 __ STA T0 + 3
+0a6d : e6 57 __ INC T1 + 0
+0a6f : d0 02 __ BNE $0a73
+0a71 : e6 58 __ INC T1 + 1
+0a73 : a5 58 __ LDA T1 + 1
+0a75 : 10 03 __ BPL $0a7a
+0a77 : 4c 32 09 JMP $0932 ; (main + 50)
+0a7a : d0 09 __ BNE $0a85
+0a7c : a5 57 __ LDA T1 + 0
+0a7e : c9 32 __ CMP #$32
+0a80 : b0 03 __ BCS $0a85
+0a82 : 4c 32 09 JMP $0932 ; (main + 50)
+0a85 : ad 32 22 LDA $2232 ; (d + 0)
+0a88 : 85 53 __ STA T0 + 0
+0a8a : ad 33 22 LDA $2233 ; (d + 1)
+0a8d : 85 54 __ STA T0 + 1
+0a8f : ad 34 22 LDA $2234 ; (d + 2)
+0a92 : 85 55 __ STA T0 + 2
+0a94 : ad 35 22 LDA $2235 ; (d + 3)
+0a97 : 85 56 __ STA T0 + 3
+0a99 : a9 01 __ LDA #$01
+0a9b : 85 57 __ STA T1 + 0
+0a9d : a9 00 __ LDA #$00
+0a9f : 85 58 __ STA T1 + 1
+0aa1 : a9 cc __ LDA #$cc
+0aa3 : a0 02 __ LDY #$02
+0aa5 : 91 23 __ STA (SP + 0),y
+0aa7 : a9 1d __ LDA #$1d
+0aa9 : c8 __ __ INY
+0aaa : 91 23 __ STA (SP + 0),y
+0aac : a5 57 __ LDA T1 + 0
+0aae : 85 1b __ STA ACCU + 0
+0ab0 : c8 __ __ INY
+0ab1 : 91 23 __ STA (SP + 0),y
+0ab3 : a5 58 __ LDA T1 + 1
+0ab5 : 85 1c __ STA ACCU + 1
+0ab7 : c8 __ __ INY
+0ab8 : 91 23 __ STA (SP + 0),y
+0aba : ad 32 22 LDA $2232 ; (d + 0)
+0abd : 85 43 __ STA T3 + 0
+0abf : ad 33 22 LDA $2233 ; (d + 1)
+0ac2 : 85 44 __ STA T3 + 1
+0ac4 : ad 34 22 LDA $2234 ; (d + 2)
+0ac7 : 85 45 __ STA T3 + 2
+0ac9 : ad 35 22 LDA $2235 ; (d + 3)
+0acc : 85 46 __ STA T3 + 3
+0ace : 20 39 21 JSR $2139 ; (sint16_to_float + 0)
+0ad1 : a5 1b __ LDA ACCU + 0
+0ad3 : 85 47 __ STA T4 + 0
+0ad5 : a5 1c __ LDA ACCU + 1
+0ad7 : 85 48 __ STA T4 + 1
+0ad9 : a5 1d __ LDA ACCU + 2
+0adb : 85 49 __ STA T4 + 2
+0add : a5 1e __ LDA ACCU + 3
+0adf : 85 4a __ STA T4 + 3
+0ae1 : a5 43 __ LDA T3 + 0
+0ae3 : 85 03 __ STA $03
+0ae5 : a5 44 __ LDA T3 + 1
+0ae7 : 85 04 __ STA $04
+0ae9 : a5 45 __ LDA T3 + 2
+0aeb : 85 05 __ STA $05
+0aed : a5 46 __ LDA T3 + 3
+0aef : 85 06 __ STA $06
+0af1 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0af4 : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+0af7 : a5 1b __ LDA ACCU + 0
+0af9 : a0 06 __ LDY #$06
+0afb : 91 23 __ STA (SP + 0),y
+0afd : a5 1c __ LDA ACCU + 1
+0aff : c8 __ __ INY
+0b00 : 91 23 __ STA (SP + 0),y
+0b02 : a5 1d __ LDA ACCU + 2
+0b04 : c8 __ __ INY
+0b05 : 91 23 __ STA (SP + 0),y
+0b07 : a5 1e __ LDA ACCU + 3
+0b09 : c8 __ __ INY
+0b0a : 91 23 __ STA (SP + 0),y
+0b0c : a5 53 __ LDA T0 + 0
+0b0e : 85 03 __ STA $03
+0b10 : c8 __ __ INY
+0b11 : 91 23 __ STA (SP + 0),y
+0b13 : a5 54 __ LDA T0 + 1
+0b15 : 85 04 __ STA $04
+0b17 : c8 __ __ INY
+0b18 : 91 23 __ STA (SP + 0),y
+0b1a : a5 55 __ LDA T0 + 2
+0b1c : 85 05 __ STA $05
+0b1e : c8 __ __ INY
+0b1f : 91 23 __ STA (SP + 0),y
+0b21 : a5 56 __ LDA T0 + 3
+0b23 : 85 06 __ STA $06
+0b25 : c8 __ __ INY
+0b26 : 91 23 __ STA (SP + 0),y
+0b28 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0b2b : a5 06 __ LDA $06
+0b2d : 49 80 __ EOR #$80
+0b2f : 85 06 __ STA $06
+0b31 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+0b34 : a5 1e __ LDA ACCU + 3
+0b36 : 29 7f __ AND #$7f
+0b38 : 85 1e __ STA ACCU + 3
+0b3a : a5 47 __ LDA T4 + 0
+0b3c : 85 03 __ STA $03
+0b3e : a5 48 __ LDA T4 + 1
+0b40 : 85 04 __ STA $04
+0b42 : a5 49 __ LDA T4 + 2
+0b44 : 85 05 __ STA $05
+0b46 : a5 4a __ LDA T4 + 3
+0b48 : 85 06 __ STA $06
+0b4a : 20 fa 1d JSR $1dfa ; (freg + 20)
+0b4d : 20 91 1f JSR $1f91 ; (fdiv + 0)
+0b50 : a5 1b __ LDA ACCU + 0
+0b52 : a0 0e __ LDY #$0e
+0b54 : 91 23 __ STA (SP + 0),y
+0b56 : a5 1c __ LDA ACCU + 1
+0b58 : c8 __ __ INY
+0b59 : 91 23 __ STA (SP + 0),y
+0b5b : a5 1d __ LDA ACCU + 2
+0b5d : c8 __ __ INY
+0b5e : 91 23 __ STA (SP + 0),y
+0b60 : a5 1e __ LDA ACCU + 3
+0b62 : c8 __ __ INY
+0b63 : 91 23 __ STA (SP + 0),y
+0b65 : 20 a9 0c JSR $0ca9 ; (printf + 0)
+0b68 : ad 32 22 LDA $2232 ; (d + 0)
+0b6b : 85 43 __ STA T3 + 0
+0b6d : ad 33 22 LDA $2233 ; (d + 1)
+0b70 : 85 44 __ STA T3 + 1
+0b72 : ad 34 22 LDA $2234 ; (d + 2)
+0b75 : 85 45 __ STA T3 + 2
+0b77 : ad 35 22 LDA $2235 ; (d + 3)
+0b7a : 85 46 __ STA T3 + 3
+0b7c : a5 57 __ LDA T1 + 0
+0b7e : 85 1b __ STA ACCU + 0
+0b80 : a5 58 __ LDA T1 + 1
+0b82 : 85 1c __ STA ACCU + 1
+0b84 : 20 39 21 JSR $2139 ; (sint16_to_float + 0)
+0b87 : a5 1b __ LDA ACCU + 0
+0b89 : 85 47 __ STA T4 + 0
+0b8b : a5 1c __ LDA ACCU + 1
+0b8d : 85 48 __ STA T4 + 1
+0b8f : a5 1d __ LDA ACCU + 2
+0b91 : 85 49 __ STA T4 + 2
+0b93 : a5 1e __ LDA ACCU + 3
+0b95 : 85 4a __ STA T4 + 3
+0b97 : a5 43 __ LDA T3 + 0
+0b99 : 85 03 __ STA $03
+0b9b : a5 44 __ LDA T3 + 1
+0b9d : 85 04 __ STA $04
+0b9f : a5 45 __ LDA T3 + 2
+0ba1 : 85 05 __ STA $05
+0ba3 : a5 46 __ LDA T3 + 3
+0ba5 : 85 06 __ STA $06
+0ba7 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0baa : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+0bad : a5 53 __ LDA T0 + 0
+0baf : 85 03 __ STA $03
+0bb1 : a5 54 __ LDA T0 + 1
+0bb3 : 85 04 __ STA $04
+0bb5 : a5 55 __ LDA T0 + 2
+0bb7 : 85 05 __ STA $05
+0bb9 : a5 56 __ LDA T0 + 3
+0bbb : 85 06 __ STA $06
+0bbd : 20 fa 1d JSR $1dfa ; (freg + 20)
+0bc0 : a5 06 __ LDA $06
+0bc2 : 49 80 __ EOR #$80
+0bc4 : 85 06 __ STA $06
+0bc6 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+0bc9 : a5 1b __ LDA ACCU + 0
+0bcb : 85 43 __ STA T3 + 0
+0bcd : a5 1c __ LDA ACCU + 1
+0bcf : 85 44 __ STA T3 + 1
+0bd1 : a5 1d __ LDA ACCU + 2
+0bd3 : 85 45 __ STA T3 + 2
+0bd5 : a5 1e __ LDA ACCU + 3
+0bd7 : 29 7f __ AND #$7f
+0bd9 : 85 46 __ STA T3 + 3
+0bdb : a5 47 __ LDA T4 + 0
+0bdd : 85 1b __ STA ACCU + 0
+0bdf : a5 48 __ LDA T4 + 1
+0be1 : 85 1c __ STA ACCU + 1
+0be3 : a5 49 __ LDA T4 + 2
+0be5 : 85 1d __ STA ACCU + 2
+0be7 : a5 4a __ LDA T4 + 3
+0be9 : 85 1e __ STA ACCU + 3
+0beb : a9 bd __ LDA #$bd
+0bed : 85 03 __ STA $03
+0bef : a9 37 __ LDA #$37
+0bf1 : 85 04 __ STA $04
+0bf3 : a9 86 __ LDA #$86
+0bf5 : 85 05 __ STA $05
+0bf7 : a9 35 __ LDA #$35
+0bf9 : 85 06 __ STA $06
+0bfb : 20 fa 1d JSR $1dfa ; (freg + 20)
+0bfe : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+0c01 : a5 43 __ LDA T3 + 0
+0c03 : 85 03 __ STA $03
+0c05 : a5 44 __ LDA T3 + 1
+0c07 : 85 04 __ STA $04
+0c09 : a5 45 __ LDA T3 + 2
+0c0b : 85 05 __ STA $05
+0c0d : a5 46 __ LDA T3 + 3
+0c0f : 85 06 __ STA $06
+0c11 : 20 84 21 JSR $2184 ; (fcmp + 0)
+0c14 : 10 03 __ BPL $0c19
+0c16 : 4c 9f 0c JMP $0c9f ; (main + 927)
+0c19 : a9 00 __ LDA #$00
+0c1b : a0 02 __ LDY #$02
+0c1d : 91 23 __ STA (SP + 0),y
+0c1f : 20 a7 1d JSR $1da7 ; (assert + 0)
+0c22 : ad 32 22 LDA $2232 ; (d + 0)
+0c25 : 85 1b __ STA ACCU + 0
+0c27 : ad 33 22 LDA $2233 ; (d + 1)
+0c2a : 85 1c __ STA ACCU + 1
+0c2c : ad 34 22 LDA $2234 ; (d + 2)
+0c2f : 85 1d __ STA ACCU + 2
+0c31 : ad 35 22 LDA $2235 ; (d + 3)
+0c34 : 85 1e __ STA ACCU + 3
+0c36 : a5 53 __ LDA T0 + 0
+0c38 : 85 03 __ STA $03
+0c3a : a5 54 __ LDA T0 + 1
+0c3c : 85 04 __ STA $04
+0c3e : a5 55 __ LDA T0 + 2
+0c40 : 85 05 __ STA $05
+0c42 : a5 56 __ LDA T0 + 3
+0c44 : 85 06 __ STA $06
+0c46 : 20 fa 1d JSR $1dfa ; (freg + 20)
+0c49 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+0c4c : a5 1b __ LDA ACCU + 0
+0c4e : 85 53 __ STA T0 + 0
+0c50 : a5 1c __ LDA ACCU + 1
+0c52 : 85 54 __ STA T0 + 1
+0c54 : a5 1d __ LDA ACCU + 2
+0c56 : 85 55 __ STA T0 + 2
+0c58 : a5 1e __ LDA ACCU + 3
+0c5a : 85 56 __ STA T0 + 3
+0c5c : e6 57 __ INC T1 + 0
+0c5e : d0 02 __ BNE $0c62
+0c60 : e6 58 __ INC T1 + 1
+0c62 : a5 58 __ LDA T1 + 1
+0c64 : 10 03 __ BPL $0c69
+0c66 : 4c a1 0a JMP $0aa1 ; (main + 417)
+0c69 : d0 09 __ BNE $0c74
+0c6b : a5 57 __ LDA T1 + 0
+0c6d : c9 32 __ CMP #$32
+0c6f : b0 03 __ BCS $0c74
+0c71 : 4c a1 0a JMP $0aa1 ; (main + 417)
+0c74 : a9 00 __ LDA #$00
+0c76 : 85 1b __ STA ACCU + 0
+0c78 : 85 1c __ STA ACCU + 1
+0c7a : 18 __ __ CLC
+0c7b : a5 23 __ LDA SP + 0
+0c7d : 69 12 __ ADC #$12
+0c7f : 85 23 __ STA SP + 0
+0c81 : a5 24 __ LDA SP + 1
+0c83 : 69 00 __ ADC #$00
+0c85 : 85 24 __ STA SP + 1
+0c87 : a0 05 __ LDY #$05
+0c89 : b1 23 __ LDA (SP + 0),y
+0c8b : 99 53 00 STA $0053,y 
+0c8e : 88 __ __ DEY
+0c8f : 10 f8 __ BPL $0c89
+0c91 : 18 __ __ CLC
+0c92 : a5 23 __ LDA SP + 0
+0c94 : 69 08 __ ADC #$08
+0c96 : 85 23 __ STA SP + 0
+0c98 : a5 24 __ LDA SP + 1
+0c9a : 69 00 __ ADC #$00
+0c9c : 85 24 __ STA SP + 1
+0c9e : 60 __ __ RTS
+0c9f : a9 01 __ LDA #$01
+0ca1 : 4c 1b 0c JMP $0c1b ; (main + 795)
+0ca4 : a9 01 __ LDA #$01
+0ca6 : 4c 2c 0a JMP $0a2c ; (main + 300)
+--------------------------------------------------------------------
+printf:
+0ca9 : 38 __ __ SEC
+0caa : a5 23 __ LDA SP + 0
+0cac : e9 45 __ SBC #$45
+0cae : 85 23 __ STA SP + 0
+0cb0 : a5 24 __ LDA SP + 1
+0cb2 : e9 00 __ SBC #$00
+0cb4 : 85 24 __ STA SP + 1
+0cb6 : a0 08 __ LDY #$08
+0cb8 : a5 25 __ LDA FP + 0
+0cba : 91 23 __ STA (SP + 0),y
+0cbc : c8 __ __ INY
+0cbd : a5 26 __ LDA FP + 1
+0cbf : 91 23 __ STA (SP + 0),y
+0cc1 : 88 __ __ DEY
+0cc2 : 88 __ __ DEY
+0cc3 : b9 53 00 LDA $0053,y 
+0cc6 : 91 23 __ STA (SP + 0),y
+0cc8 : 88 __ __ DEY
+0cc9 : 10 f8 __ BPL $0cc3
+0ccb : 18 __ __ CLC
+0ccc : a5 23 __ LDA SP + 0
+0cce : 69 0b __ ADC #$0b
+0cd0 : 85 25 __ STA FP + 0
+0cd2 : a5 24 __ LDA SP + 1
+0cd4 : 69 00 __ ADC #$00
+0cd6 : 85 26 __ STA FP + 1
+0cd8 : a5 25 __ LDA FP + 0
+0cda : 85 53 __ STA T1 + 0
+0cdc : a5 26 __ LDA FP + 1
+0cde : 85 54 __ STA T1 + 1
+0ce0 : a9 00 __ LDA #$00
+0ce2 : 85 55 __ STA T2 + 0
+0ce4 : a0 3c __ LDY #$3c
+0ce6 : b1 25 __ LDA (FP + 0),y
+0ce8 : 85 57 __ STA T3 + 0
+0cea : c8 __ __ INY
+0ceb : b1 25 __ LDA (FP + 0),y
+0ced : 85 58 __ STA T3 + 1
+0cef : a0 00 __ LDY #$00
+0cf1 : b1 57 __ LDA (T3 + 0),y
+0cf3 : 85 43 __ STA T4 + 0
+0cf5 : d0 37 __ BNE $0d2e
+0cf7 : a9 00 __ LDA #$00
+0cf9 : a4 55 __ LDY T2 + 0
+0cfb : 91 53 __ STA (T1 + 0),y
+0cfd : 98 __ __ TYA
+0cfe : f0 0b __ BEQ $0d0b
+0d00 : a5 53 __ LDA T1 + 0
+0d02 : 85 0d __ STA P0
+0d04 : a5 54 __ LDA T1 + 1
+0d06 : 85 0e __ STA P1
+0d08 : 20 b8 14 JSR $14b8 ; (puts + 0)
+0d0b : a0 08 __ LDY #$08
+0d0d : b1 23 __ LDA (SP + 0),y
+0d0f : 85 25 __ STA FP + 0
+0d11 : c8 __ __ INY
+0d12 : b1 23 __ LDA (SP + 0),y
+0d14 : 85 26 __ STA FP + 1
+0d16 : 88 __ __ DEY
+0d17 : 88 __ __ DEY
+0d18 : b1 23 __ LDA (SP + 0),y
+0d1a : 99 53 00 STA $0053,y 
+0d1d : 88 __ __ DEY
+0d1e : 10 f8 __ BPL $0d18
+0d20 : 18 __ __ CLC
+0d21 : a5 23 __ LDA SP + 0
+0d23 : 69 45 __ ADC #$45
+0d25 : 85 23 __ STA SP + 0
+0d27 : a5 24 __ LDA SP + 1
+0d29 : 69 00 __ ADC #$00
+0d2b : 85 24 __ STA SP + 1
+0d2d : 60 __ __ RTS
+0d2e : 18 __ __ CLC
+0d2f : a5 25 __ LDA FP + 0
+0d31 : 69 3e __ ADC #$3e
+0d33 : 85 59 __ STA T5 + 0
+0d35 : a5 26 __ LDA FP + 1
+0d37 : 69 00 __ ADC #$00
+0d39 : 85 5a __ STA T5 + 1
+0d3b : e6 57 __ INC T3 + 0
+0d3d : d0 02 __ BNE $0d41
+0d3f : e6 58 __ INC T3 + 1
+0d41 : a5 43 __ LDA T4 + 0
+0d43 : c9 25 __ CMP #$25
+0d45 : f0 3d __ BEQ $0d84
+0d47 : a4 55 __ LDY T2 + 0
+0d49 : 91 53 __ STA (T1 + 0),y
+0d4b : e6 55 __ INC T2 + 0
+0d4d : a5 55 __ LDA T2 + 0
+0d4f : c9 28 __ CMP #$28
+0d51 : a0 00 __ LDY #$00
+0d53 : 90 1c __ BCC $0d71
+0d55 : 18 __ __ CLC
+0d56 : a5 53 __ LDA T1 + 0
+0d58 : 85 0d __ STA P0
+0d5a : 65 55 __ ADC T2 + 0
+0d5c : 85 46 __ STA T7 + 0
+0d5e : a5 54 __ LDA T1 + 1
+0d60 : 85 0e __ STA P1
+0d62 : 69 00 __ ADC #$00
+0d64 : 85 47 __ STA T7 + 1
+0d66 : a9 00 __ LDA #$00
+0d68 : 91 46 __ STA (T7 + 0),y
+0d6a : 20 b8 14 JSR $14b8 ; (puts + 0)
+0d6d : a9 00 __ LDA #$00
+0d6f : 85 55 __ STA T2 + 0
+0d71 : a0 00 __ LDY #$00
+0d73 : b1 57 __ LDA (T3 + 0),y
+0d75 : aa __ __ TAX
+0d76 : e6 57 __ INC T3 + 0
+0d78 : d0 02 __ BNE $0d7c
+0d7a : e6 58 __ INC T3 + 1
+0d7c : 8a __ __ TXA
+0d7d : 86 43 __ STX T4 + 0
+0d7f : d0 c0 __ BNE $0d41
+0d81 : 4c f7 0c JMP $0cf7 ; (printf + 78)
+0d84 : a5 55 __ LDA T2 + 0
+0d86 : f0 1e __ BEQ $0da6
+0d88 : 18 __ __ CLC
+0d89 : a5 53 __ LDA T1 + 0
+0d8b : 85 0d __ STA P0
+0d8d : 65 55 __ ADC T2 + 0
+0d8f : 85 46 __ STA T7 + 0
+0d91 : a5 54 __ LDA T1 + 1
+0d93 : 85 0e __ STA P1
+0d95 : 69 00 __ ADC #$00
+0d97 : 85 47 __ STA T7 + 1
+0d99 : a9 00 __ LDA #$00
+0d9b : a0 00 __ LDY #$00
+0d9d : 91 46 __ STA (T7 + 0),y
+0d9f : 20 b8 14 JSR $14b8 ; (puts + 0)
+0da2 : a9 00 __ LDA #$00
+0da4 : 85 55 __ STA T2 + 0
+0da6 : a0 00 __ LDY #$00
+0da8 : b1 57 __ LDA (T3 + 0),y
+0daa : 85 43 __ STA T4 + 0
+0dac : a9 0a __ LDA #$0a
+0dae : a0 35 __ LDY #$35
+0db0 : 91 25 __ STA (FP + 0),y
+0db2 : a9 00 __ LDA #$00
+0db4 : c8 __ __ INY
+0db5 : 91 25 __ STA (FP + 0),y
+0db7 : a9 01 __ LDA #$01
+0db9 : a0 33 __ LDY #$33
+0dbb : 91 25 __ STA (FP + 0),y
+0dbd : a9 ff __ LDA #$ff
+0dbf : c8 __ __ INY
+0dc0 : 91 25 __ STA (FP + 0),y
+0dc2 : a9 20 __ LDA #$20
+0dc4 : a0 32 __ LDY #$32
+0dc6 : 91 25 __ STA (FP + 0),y
+0dc8 : a9 00 __ LDA #$00
+0dca : a0 37 __ LDY #$37
+0dcc : 91 25 __ STA (FP + 0),y
+0dce : c8 __ __ INY
+0dcf : 91 25 __ STA (FP + 0),y
+0dd1 : c8 __ __ INY
+0dd2 : 91 25 __ STA (FP + 0),y
+0dd4 : e6 57 __ INC T3 + 0
+0dd6 : d0 02 __ BNE $0dda
+0dd8 : e6 58 __ INC T3 + 1
+0dda : a5 43 __ LDA T4 + 0
+0ddc : c9 2b __ CMP #$2b
+0dde : d0 03 __ BNE $0de3
+0de0 : 4c a9 14 JMP $14a9 ; (printf + 2048)
+0de3 : c9 30 __ CMP #$30
+0de5 : d0 03 __ BNE $0dea
+0de7 : 4c 9a 14 JMP $149a ; (printf + 2033)
+0dea : c9 23 __ CMP #$23
+0dec : d0 03 __ BNE $0df1
+0dee : 4c 8b 14 JMP $148b ; (printf + 2018)
+0df1 : c9 30 __ CMP #$30
+0df3 : 90 65 __ BCC $0e5a
+0df5 : a9 39 __ LDA #$39
+0df7 : c5 43 __ CMP T4 + 0
+0df9 : 90 5f __ BCC $0e5a
+0dfb : a9 00 __ LDA #$00
+0dfd : 85 46 __ STA T7 + 0
+0dff : 85 47 __ STA T7 + 1
+0e01 : a5 43 __ LDA T4 + 0
+0e03 : c9 30 __ CMP #$30
+0e05 : 90 4d __ BCC $0e54
+0e07 : a9 39 __ LDA #$39
+0e09 : c5 43 __ CMP T4 + 0
+0e0b : 90 47 __ BCC $0e54
+0e0d : a5 43 __ LDA T4 + 0
+0e0f : 85 48 __ STA T8 + 0
+0e11 : a0 00 __ LDY #$00
+0e13 : b1 57 __ LDA (T3 + 0),y
+0e15 : 85 43 __ STA T4 + 0
+0e17 : e6 57 __ INC T3 + 0
+0e19 : d0 02 __ BNE $0e1d
+0e1b : e6 58 __ INC T3 + 1
+0e1d : a5 46 __ LDA T7 + 0
+0e1f : 0a __ __ ASL
+0e20 : 85 07 __ STA $07
+0e22 : a5 47 __ LDA T7 + 1
+0e24 : 2a __ __ ROL
+0e25 : 06 07 __ ASL $07
+0e27 : 2a __ __ ROL
+0e28 : aa __ __ TAX
+0e29 : 18 __ __ CLC
+0e2a : a5 07 __ LDA $07
+0e2c : 65 46 __ ADC T7 + 0
+0e2e : 85 1b __ STA ACCU + 0
+0e30 : 8a __ __ TXA
+0e31 : 65 47 __ ADC T7 + 1
+0e33 : 06 1b __ ASL ACCU + 0
+0e35 : 2a __ __ ROL
+0e36 : 85 1c __ STA ACCU + 1
+0e38 : 18 __ __ CLC
+0e39 : a5 1b __ LDA ACCU + 0
+0e3b : 65 48 __ ADC T8 + 0
+0e3d : aa __ __ TAX
+0e3e : a5 1c __ LDA ACCU + 1
+0e40 : 69 00 __ ADC #$00
+0e42 : a8 __ __ TAY
+0e43 : 38 __ __ SEC
+0e44 : 8a __ __ TXA
+0e45 : e9 30 __ SBC #$30
+0e47 : 85 46 __ STA T7 + 0
+0e49 : 98 __ __ TYA
+0e4a : e9 00 __ SBC #$00
+0e4c : 85 47 __ STA T7 + 1
+0e4e : a5 43 __ LDA T4 + 0
+0e50 : c9 30 __ CMP #$30
+0e52 : b0 b3 __ BCS $0e07
+0e54 : a5 46 __ LDA T7 + 0
+0e56 : a0 33 __ LDY #$33
+0e58 : 91 25 __ STA (FP + 0),y
+0e5a : a5 43 __ LDA T4 + 0
+0e5c : c9 2e __ CMP #$2e
+0e5e : d0 03 __ BNE $0e63
+0e60 : 4c 1d 14 JMP $141d ; (printf + 1908)
+0e63 : a5 43 __ LDA T4 + 0
+0e65 : c9 64 __ CMP #$64
+0e67 : d0 03 __ BNE $0e6c
+0e69 : 4c 92 12 JMP $1292 ; (printf + 1513)
+0e6c : c9 75 __ CMP #$75
+0e6e : d0 03 __ BNE $0e73
+0e70 : 4c 45 11 JMP $1145 ; (printf + 1180)
+0e73 : c9 78 __ CMP #$78
+0e75 : d0 03 __ BNE $0e7a
+0e77 : 4c ed 0f JMP $0fed ; (printf + 836)
+0e7a : c9 6c __ CMP #$6c
+0e7c : d0 03 __ BNE $0e81
+0e7e : 4c 1a 0f JMP $0f1a ; (printf + 625)
+0e81 : c9 66 __ CMP #$66
+0e83 : f0 56 __ BEQ $0edb
+0e85 : c9 67 __ CMP #$67
+0e87 : f0 52 __ BEQ $0edb
+0e89 : c9 65 __ CMP #$65
+0e8b : f0 4e __ BEQ $0edb
+0e8d : c9 73 __ CMP #$73
+0e8f : f0 2e __ BEQ $0ebf
+0e91 : c9 63 __ CMP #$63
+0e93 : f0 12 __ BEQ $0ea7
+0e95 : 09 00 __ ORA #$00
+0e97 : d0 03 __ BNE $0e9c
+0e99 : 4c 71 0d JMP $0d71 ; (printf + 200)
+0e9c : a5 43 __ LDA T4 + 0
+0e9e : a4 55 __ LDY T2 + 0
+0ea0 : 91 53 __ STA (T1 + 0),y
+0ea2 : e6 55 __ INC T2 + 0
+0ea4 : 4c 71 0d JMP $0d71 ; (printf + 200)
+0ea7 : a0 00 __ LDY #$00
+0ea9 : b1 59 __ LDA (T5 + 0),y
+0eab : a4 55 __ LDY T2 + 0
+0ead : 91 53 __ STA (T1 + 0),y
+0eaf : 18 __ __ CLC
+0eb0 : a5 59 __ LDA T5 + 0
+0eb2 : 69 02 __ ADC #$02
+0eb4 : 85 59 __ STA T5 + 0
+0eb6 : 90 02 __ BCC $0eba
+0eb8 : e6 5a __ INC T5 + 1
+0eba : e6 55 __ INC T2 + 0
+0ebc : 4c 71 0d JMP $0d71 ; (printf + 200)
+0ebf : a0 00 __ LDY #$00
+0ec1 : b1 59 __ LDA (T5 + 0),y
+0ec3 : 85 0d __ STA P0
+0ec5 : c8 __ __ INY
+0ec6 : b1 59 __ LDA (T5 + 0),y
+0ec8 : 85 0e __ STA P1
+0eca : 18 __ __ CLC
+0ecb : a5 59 __ LDA T5 + 0
+0ecd : 69 02 __ ADC #$02
+0ecf : 85 59 __ STA T5 + 0
+0ed1 : 90 02 __ BCC $0ed5
+0ed3 : e6 5a __ INC T5 + 1
+0ed5 : 20 b8 14 JSR $14b8 ; (puts + 0)
+0ed8 : 4c 71 0d JMP $0d71 ; (printf + 200)
+0edb : 18 __ __ CLC
+0edc : a5 25 __ LDA FP + 0
+0ede : 69 32 __ ADC #$32
+0ee0 : 85 0d __ STA P0
+0ee2 : a5 26 __ LDA FP + 1
+0ee4 : 69 00 __ ADC #$00
+0ee6 : 85 0e __ STA P1
+0ee8 : a5 53 __ LDA T1 + 0
+0eea : 85 0f __ STA P2
+0eec : a5 54 __ LDA T1 + 1
+0eee : 85 10 __ STA P3
+0ef0 : a0 00 __ LDY #$00
+0ef2 : b1 59 __ LDA (T5 + 0),y
+0ef4 : 85 11 __ STA P4
+0ef6 : c8 __ __ INY
+0ef7 : b1 59 __ LDA (T5 + 0),y
+0ef9 : 85 12 __ STA P5
+0efb : c8 __ __ INY
+0efc : b1 59 __ LDA (T5 + 0),y
+0efe : 85 13 __ STA P6
+0f00 : c8 __ __ INY
+0f01 : b1 59 __ LDA (T5 + 0),y
+0f03 : 85 14 __ STA P7
+0f05 : 20 23 17 JSR $1723 ; (nformf + 0)
+0f08 : a5 1b __ LDA ACCU + 0
+0f0a : 85 55 __ STA T2 + 0
+0f0c : 18 __ __ CLC
+0f0d : a5 59 __ LDA T5 + 0
+0f0f : 69 04 __ ADC #$04
+0f11 : 85 59 __ STA T5 + 0
+0f13 : 90 02 __ BCC $0f17
+0f15 : e6 5a __ INC T5 + 1
+0f17 : 4c 71 0d JMP $0d71 ; (printf + 200)
+0f1a : a0 00 __ LDY #$00
+0f1c : b1 59 __ LDA (T5 + 0),y
+0f1e : 85 4f __ STA T12 + 0
+0f20 : c8 __ __ INY
+0f21 : b1 59 __ LDA (T5 + 0),y
+0f23 : 85 50 __ STA T12 + 1
+0f25 : c8 __ __ INY
+0f26 : b1 59 __ LDA (T5 + 0),y
+0f28 : 85 51 __ STA T12 + 2
+0f2a : c8 __ __ INY
+0f2b : b1 59 __ LDA (T5 + 0),y
+0f2d : 85 52 __ STA T12 + 3
+0f2f : 18 __ __ CLC
+0f30 : a5 59 __ LDA T5 + 0
+0f32 : 69 04 __ ADC #$04
+0f34 : 85 59 __ STA T5 + 0
+0f36 : 90 02 __ BCC $0f3a
+0f38 : e6 5a __ INC T5 + 1
+0f3a : a0 00 __ LDY #$00
+0f3c : b1 57 __ LDA (T3 + 0),y
+0f3e : aa __ __ TAX
+0f3f : e6 57 __ INC T3 + 0
+0f41 : d0 02 __ BNE $0f45
+0f43 : e6 58 __ INC T3 + 1
+0f45 : 8a __ __ TXA
+0f46 : e0 64 __ CPX #$64
+0f48 : f0 74 __ BEQ $0fbe
+0f4a : c9 75 __ CMP #$75
+0f4c : f0 41 __ BEQ $0f8f
+0f4e : c9 78 __ CMP #$78
+0f50 : f0 03 __ BEQ $0f55
+0f52 : 4c 71 0d JMP $0d71 ; (printf + 200)
+0f55 : a9 10 __ LDA #$10
+0f57 : a0 35 __ LDY #$35
+0f59 : 91 25 __ STA (FP + 0),y
+0f5b : a9 00 __ LDA #$00
+0f5d : c8 __ __ INY
+0f5e : 91 25 __ STA (FP + 0),y
+0f60 : 18 __ __ CLC
+0f61 : a5 25 __ LDA FP + 0
+0f63 : 69 32 __ ADC #$32
+0f65 : 85 0d __ STA P0
+0f67 : a5 26 __ LDA FP + 1
+0f69 : 69 00 __ ADC #$00
+0f6b : 85 0e __ STA P1
+0f6d : a5 53 __ LDA T1 + 0
+0f6f : 85 0f __ STA P2
+0f71 : a5 54 __ LDA T1 + 1
+0f73 : 85 10 __ STA P3
+0f75 : a5 4f __ LDA T12 + 0
+0f77 : 85 11 __ STA P4
+0f79 : a5 50 __ LDA T12 + 1
+0f7b : 85 12 __ STA P5
+0f7d : a5 51 __ LDA T12 + 2
+0f7f : 85 13 __ STA P6
+0f81 : a5 52 __ LDA T12 + 3
+0f83 : 85 14 __ STA P7
+0f85 : 20 f6 14 JSR $14f6 ; (nforml + 0)
+0f88 : a5 1b __ LDA ACCU + 0
+0f8a : 85 55 __ STA T2 + 0
+0f8c : 4c 71 0d JMP $0d71 ; (printf + 200)
+0f8f : 18 __ __ CLC
+0f90 : a5 25 __ LDA FP + 0
+0f92 : 69 32 __ ADC #$32
+0f94 : 85 0d __ STA P0
+0f96 : a5 26 __ LDA FP + 1
+0f98 : 69 00 __ ADC #$00
+0f9a : 85 0e __ STA P1
+0f9c : a5 53 __ LDA T1 + 0
+0f9e : 85 0f __ STA P2
+0fa0 : a5 54 __ LDA T1 + 1
+0fa2 : 85 10 __ STA P3
+0fa4 : a5 4f __ LDA T12 + 0
+0fa6 : 85 11 __ STA P4
+0fa8 : a5 50 __ LDA T12 + 1
+0faa : 85 12 __ STA P5
+0fac : a5 51 __ LDA T12 + 2
+0fae : 85 13 __ STA P6
+0fb0 : a5 52 __ LDA T12 + 3
+0fb2 : 85 14 __ STA P7
+0fb4 : 20 f6 14 JSR $14f6 ; (nforml + 0)
+0fb7 : a5 1b __ LDA ACCU + 0
+0fb9 : 85 55 __ STA T2 + 0
+0fbb : 4c 71 0d JMP $0d71 ; (printf + 200)
+0fbe : 18 __ __ CLC
+0fbf : a5 25 __ LDA FP + 0
+0fc1 : 69 32 __ ADC #$32
+0fc3 : 85 0d __ STA P0
+0fc5 : a5 26 __ LDA FP + 1
+0fc7 : 69 00 __ ADC #$00
+0fc9 : 85 0e __ STA P1
+0fcb : a5 53 __ LDA T1 + 0
+0fcd : 85 0f __ STA P2
+0fcf : a5 54 __ LDA T1 + 1
+0fd1 : 85 10 __ STA P3
+0fd3 : a5 4f __ LDA T12 + 0
+0fd5 : 85 11 __ STA P4
+0fd7 : a5 50 __ LDA T12 + 1
+0fd9 : 85 12 __ STA P5
+0fdb : a5 51 __ LDA T12 + 2
+0fdd : 85 13 __ STA P6
+0fdf : a5 52 __ LDA T12 + 3
+0fe1 : 85 14 __ STA P7
+0fe3 : 20 f6 14 JSR $14f6 ; (nforml + 0)
+0fe6 : a5 1b __ LDA ACCU + 0
+0fe8 : 85 55 __ STA T2 + 0
+0fea : 4c 71 0d JMP $0d71 ; (printf + 200)
+0fed : a9 10 __ LDA #$10
+0fef : a0 35 __ LDY #$35
+0ff1 : 91 25 __ STA (FP + 0),y
+0ff3 : a9 00 __ LDA #$00
+0ff5 : c8 __ __ INY
+0ff6 : 91 25 __ STA (FP + 0),y
+0ff8 : a5 53 __ LDA T1 + 0
+0ffa : 85 46 __ STA T7 + 0
+0ffc : a5 54 __ LDA T1 + 1
+0ffe : 85 47 __ STA T7 + 1
+1000 : a0 00 __ LDY #$00
+1002 : b1 59 __ LDA (T5 + 0),y
+1004 : 85 48 __ STA T8 + 0
+1006 : c8 __ __ INY
+1007 : b1 59 __ LDA (T5 + 0),y
+1009 : 85 49 __ STA T8 + 1
+100b : 18 __ __ CLC
+100c : a5 59 __ LDA T5 + 0
+100e : 69 02 __ ADC #$02
+1010 : 85 59 __ STA T5 + 0
+1012 : 90 02 __ BCC $1016
+1014 : e6 5a __ INC T5 + 1
+1016 : a9 0a __ LDA #$0a
+1018 : 85 43 __ STA T4 + 0
+101a : a5 48 __ LDA T8 + 0
+101c : 05 49 __ ORA T8 + 1
+101e : f0 03 __ BEQ $1023
+1020 : 4c eb 10 JMP $10eb ; (printf + 1090)
+1023 : a0 34 __ LDY #$34
+1025 : b1 25 __ LDA (FP + 0),y
+1027 : 85 44 __ STA T6 + 0
+1029 : c9 ff __ CMP #$ff
+102b : d0 03 __ BNE $1030
+102d : 4c dd 10 JMP $10dd ; (printf + 1076)
+1030 : 38 __ __ SEC
+1031 : a9 0a __ LDA #$0a
+1033 : e5 44 __ SBC T6 + 0
+1035 : 85 44 __ STA T6 + 0
+1037 : c5 43 __ CMP T4 + 0
+1039 : b0 0e __ BCS $1049
+103b : c6 43 __ DEC T4 + 0
+103d : a9 30 __ LDA #$30
+103f : a4 43 __ LDY T4 + 0
+1041 : 91 46 __ STA (T7 + 0),y
+1043 : a5 44 __ LDA T6 + 0
+1045 : c5 43 __ CMP T4 + 0
+1047 : 90 f2 __ BCC $103b
+1049 : a0 39 __ LDY #$39
+104b : b1 25 __ LDA (FP + 0),y
+104d : f0 34 __ BEQ $1083
+104f : a0 35 __ LDY #$35
+1051 : b1 25 __ LDA (FP + 0),y
+1053 : 85 48 __ STA T8 + 0
+1055 : c8 __ __ INY
+1056 : b1 25 __ LDA (FP + 0),y
+1058 : d0 29 __ BNE $1083
+105a : a5 48 __ LDA T8 + 0
+105c : c9 10 __ CMP #$10
+105e : d0 23 __ BNE $1083
+1060 : 18 __ __ CLC
+1061 : a5 43 __ LDA T4 + 0
+1063 : 69 ff __ ADC #$ff
+1065 : 18 __ __ CLC
+1066 : 65 46 __ ADC T7 + 0
+1068 : 85 48 __ STA T8 + 0
+106a : a5 47 __ LDA T7 + 1
+106c : 69 00 __ ADC #$00
+106e : 85 49 __ STA T8 + 1
+1070 : a9 58 __ LDA #$58
+1072 : a0 00 __ LDY #$00
+1074 : 91 48 __ STA (T8 + 0),y
+1076 : 18 __ __ CLC
+1077 : a5 43 __ LDA T4 + 0
+1079 : 69 fe __ ADC #$fe
+107b : 85 43 __ STA T4 + 0
+107d : a9 30 __ LDA #$30
+107f : a4 43 __ LDY T4 + 0
+1081 : 91 46 __ STA (T7 + 0),y
+1083 : a0 37 __ LDY #$37
+1085 : b1 25 __ LDA (FP + 0),y
+1087 : f0 08 __ BEQ $1091
+1089 : c6 43 __ DEC T4 + 0
+108b : a9 2b __ LDA #$2b
+108d : a4 43 __ LDY T4 + 0
+108f : 91 46 __ STA (T7 + 0),y
+1091 : a0 33 __ LDY #$33
+1093 : b1 25 __ LDA (FP + 0),y
+1095 : 85 55 __ STA T2 + 0
+1097 : 38 __ __ SEC
+1098 : a9 0a __ LDA #$0a
+109a : e5 55 __ SBC T2 + 0
+109c : 85 48 __ STA T8 + 0
+109e : a9 00 __ LDA #$00
+10a0 : e9 00 __ SBC #$00
+10a2 : 49 80 __ EOR #$80
+10a4 : c9 80 __ CMP #$80
+10a6 : d0 04 __ BNE $10ac
+10a8 : a5 48 __ LDA T8 + 0
+10aa : c5 43 __ CMP T4 + 0
+10ac : 90 22 __ BCC $10d0
+10ae : a9 00 __ LDA #$00
+10b0 : 85 55 __ STA T2 + 0
+10b2 : a5 43 __ LDA T4 + 0
+10b4 : c9 0a __ CMP #$0a
+10b6 : 90 03 __ BCC $10bb
+10b8 : 4c 71 0d JMP $0d71 ; (printf + 200)
+10bb : a4 43 __ LDY T4 + 0
+10bd : b1 46 __ LDA (T7 + 0),y
+10bf : a4 55 __ LDY T2 + 0
+10c1 : 91 46 __ STA (T7 + 0),y
+10c3 : e6 55 __ INC T2 + 0
+10c5 : e6 43 __ INC T4 + 0
+10c7 : a5 43 __ LDA T4 + 0
+10c9 : c9 0a __ CMP #$0a
+10cb : 90 ee __ BCC $10bb
+10cd : 4c 71 0d JMP $0d71 ; (printf + 200)
+10d0 : c6 43 __ DEC T4 + 0
+10d2 : a0 32 __ LDY #$32
+10d4 : b1 25 __ LDA (FP + 0),y
+10d6 : a4 43 __ LDY T4 + 0
+10d8 : 91 46 __ STA (T7 + 0),y
+10da : 4c 91 10 JMP $1091 ; (printf + 1000)
+10dd : a9 09 __ LDA #$09
+10df : 85 44 __ STA T6 + 0
+10e1 : c5 43 __ CMP T4 + 0
+10e3 : b0 03 __ BCS $10e8
+10e5 : 4c 3b 10 JMP $103b ; (printf + 914)
+10e8 : 4c 49 10 JMP $1049 ; (printf + 928)
+10eb : a5 48 __ LDA T8 + 0
+10ed : 85 1b __ STA ACCU + 0
+10ef : a5 49 __ LDA T8 + 1
+10f1 : 85 1c __ STA ACCU + 1
+10f3 : a0 35 __ LDY #$35
+10f5 : b1 25 __ LDA (FP + 0),y
+10f7 : 85 03 __ STA $03
+10f9 : c8 __ __ INY
+10fa : b1 25 __ LDA (FP + 0),y
+10fc : 85 04 __ STA $04
+10fe : 20 49 20 JSR $2049 ; (divmod + 0)
+1101 : a5 06 __ LDA $06
+1103 : 10 30 __ BPL $1135
+1105 : 18 __ __ CLC
+1106 : a5 05 __ LDA $05
+1108 : 69 30 __ ADC #$30
+110a : c6 43 __ DEC T4 + 0
+110c : a4 43 __ LDY T4 + 0
+110e : 91 46 __ STA (T7 + 0),y
+1110 : a5 48 __ LDA T8 + 0
+1112 : 85 1b __ STA ACCU + 0
+1114 : a5 49 __ LDA T8 + 1
+1116 : 85 1c __ STA ACCU + 1
+1118 : a0 35 __ LDY #$35
+111a : b1 25 __ LDA (FP + 0),y
+111c : 85 03 __ STA $03
+111e : c8 __ __ INY
+111f : b1 25 __ LDA (FP + 0),y
+1121 : 85 04 __ STA $04
+1123 : 20 49 20 JSR $2049 ; (divmod + 0)
+1126 : a5 1b __ LDA ACCU + 0
+1128 : 85 48 __ STA T8 + 0
+112a : a5 1c __ LDA ACCU + 1
+112c : 85 49 __ STA T8 + 1
+112e : 05 1b __ ORA ACCU + 0
+1130 : d0 b9 __ BNE $10eb
+1132 : 4c 23 10 JMP $1023 ; (printf + 890)
+1135 : d0 06 __ BNE $113d
+1137 : a5 05 __ LDA $05
+1139 : c9 0a __ CMP #$0a
+113b : 90 c8 __ BCC $1105
+113d : 18 __ __ CLC
+113e : a5 05 __ LDA $05
+1140 : 69 37 __ ADC #$37
+1142 : 4c 0a 11 JMP $110a ; (printf + 1121)
+1145 : a5 53 __ LDA T1 + 0
+1147 : 85 46 __ STA T7 + 0
+1149 : a5 54 __ LDA T1 + 1
+114b : 85 47 __ STA T7 + 1
+114d : a0 00 __ LDY #$00
+114f : b1 59 __ LDA (T5 + 0),y
+1151 : 85 48 __ STA T8 + 0
+1153 : c8 __ __ INY
+1154 : b1 59 __ LDA (T5 + 0),y
+1156 : 85 49 __ STA T8 + 1
+1158 : 18 __ __ CLC
+1159 : a5 59 __ LDA T5 + 0
+115b : 69 02 __ ADC #$02
+115d : 85 59 __ STA T5 + 0
+115f : 90 02 __ BCC $1163
+1161 : e6 5a __ INC T5 + 1
+1163 : a9 0a __ LDA #$0a
+1165 : 85 43 __ STA T4 + 0
+1167 : a5 48 __ LDA T8 + 0
+1169 : 05 49 __ ORA T8 + 1
+116b : f0 03 __ BEQ $1170
+116d : 4c 38 12 JMP $1238 ; (printf + 1423)
+1170 : a0 34 __ LDY #$34
+1172 : b1 25 __ LDA (FP + 0),y
+1174 : 85 44 __ STA T6 + 0
+1176 : c9 ff __ CMP #$ff
+1178 : d0 03 __ BNE $117d
+117a : 4c 2a 12 JMP $122a ; (printf + 1409)
+117d : 38 __ __ SEC
+117e : a9 0a __ LDA #$0a
+1180 : e5 44 __ SBC T6 + 0
+1182 : 85 44 __ STA T6 + 0
+1184 : c5 43 __ CMP T4 + 0
+1186 : b0 0e __ BCS $1196
+1188 : c6 43 __ DEC T4 + 0
+118a : a9 30 __ LDA #$30
+118c : a4 43 __ LDY T4 + 0
+118e : 91 46 __ STA (T7 + 0),y
+1190 : a5 44 __ LDA T6 + 0
+1192 : c5 43 __ CMP T4 + 0
+1194 : 90 f2 __ BCC $1188
+1196 : a0 39 __ LDY #$39
+1198 : b1 25 __ LDA (FP + 0),y
+119a : f0 34 __ BEQ $11d0
+119c : a0 35 __ LDY #$35
+119e : b1 25 __ LDA (FP + 0),y
+11a0 : 85 48 __ STA T8 + 0
+11a2 : c8 __ __ INY
+11a3 : b1 25 __ LDA (FP + 0),y
+11a5 : d0 29 __ BNE $11d0
+11a7 : a5 48 __ LDA T8 + 0
+11a9 : c9 10 __ CMP #$10
+11ab : d0 23 __ BNE $11d0
+11ad : 18 __ __ CLC
+11ae : a5 43 __ LDA T4 + 0
+11b0 : 69 ff __ ADC #$ff
+11b2 : 18 __ __ CLC
+11b3 : 65 46 __ ADC T7 + 0
+11b5 : 85 48 __ STA T8 + 0
+11b7 : a5 47 __ LDA T7 + 1
+11b9 : 69 00 __ ADC #$00
+11bb : 85 49 __ STA T8 + 1
+11bd : a9 58 __ LDA #$58
+11bf : a0 00 __ LDY #$00
+11c1 : 91 48 __ STA (T8 + 0),y
+11c3 : 18 __ __ CLC
+11c4 : a5 43 __ LDA T4 + 0
+11c6 : 69 fe __ ADC #$fe
+11c8 : 85 43 __ STA T4 + 0
+11ca : a9 30 __ LDA #$30
+11cc : a4 43 __ LDY T4 + 0
+11ce : 91 46 __ STA (T7 + 0),y
+11d0 : a0 37 __ LDY #$37
+11d2 : b1 25 __ LDA (FP + 0),y
+11d4 : f0 08 __ BEQ $11de
+11d6 : c6 43 __ DEC T4 + 0
+11d8 : a9 2b __ LDA #$2b
+11da : a4 43 __ LDY T4 + 0
+11dc : 91 46 __ STA (T7 + 0),y
+11de : a0 33 __ LDY #$33
+11e0 : b1 25 __ LDA (FP + 0),y
+11e2 : 85 55 __ STA T2 + 0
+11e4 : 38 __ __ SEC
+11e5 : a9 0a __ LDA #$0a
+11e7 : e5 55 __ SBC T2 + 0
+11e9 : 85 48 __ STA T8 + 0
+11eb : a9 00 __ LDA #$00
+11ed : e9 00 __ SBC #$00
+11ef : 49 80 __ EOR #$80
+11f1 : c9 80 __ CMP #$80
+11f3 : d0 04 __ BNE $11f9
+11f5 : a5 48 __ LDA T8 + 0
+11f7 : c5 43 __ CMP T4 + 0
+11f9 : 90 22 __ BCC $121d
+11fb : a9 00 __ LDA #$00
+11fd : 85 55 __ STA T2 + 0
+11ff : a5 43 __ LDA T4 + 0
+1201 : c9 0a __ CMP #$0a
+1203 : 90 03 __ BCC $1208
+1205 : 4c 71 0d JMP $0d71 ; (printf + 200)
+1208 : a4 43 __ LDY T4 + 0
+120a : b1 46 __ LDA (T7 + 0),y
+120c : a4 55 __ LDY T2 + 0
+120e : 91 46 __ STA (T7 + 0),y
+1210 : e6 55 __ INC T2 + 0
+1212 : e6 43 __ INC T4 + 0
+1214 : a5 43 __ LDA T4 + 0
+1216 : c9 0a __ CMP #$0a
+1218 : 90 ee __ BCC $1208
+121a : 4c 71 0d JMP $0d71 ; (printf + 200)
+121d : c6 43 __ DEC T4 + 0
+121f : a0 32 __ LDY #$32
+1221 : b1 25 __ LDA (FP + 0),y
+1223 : a4 43 __ LDY T4 + 0
+1225 : 91 46 __ STA (T7 + 0),y
+1227 : 4c de 11 JMP $11de ; (printf + 1333)
+122a : a9 09 __ LDA #$09
+122c : 85 44 __ STA T6 + 0
+122e : c5 43 __ CMP T4 + 0
+1230 : b0 03 __ BCS $1235
+1232 : 4c 88 11 JMP $1188 ; (printf + 1247)
+1235 : 4c 96 11 JMP $1196 ; (printf + 1261)
+1238 : a5 48 __ LDA T8 + 0
+123a : 85 1b __ STA ACCU + 0
+123c : a5 49 __ LDA T8 + 1
+123e : 85 1c __ STA ACCU + 1
+1240 : a0 35 __ LDY #$35
+1242 : b1 25 __ LDA (FP + 0),y
+1244 : 85 03 __ STA $03
+1246 : c8 __ __ INY
+1247 : b1 25 __ LDA (FP + 0),y
+1249 : 85 04 __ STA $04
+124b : 20 49 20 JSR $2049 ; (divmod + 0)
+124e : a5 06 __ LDA $06
+1250 : 10 30 __ BPL $1282
+1252 : 18 __ __ CLC
+1253 : a5 05 __ LDA $05
+1255 : 69 30 __ ADC #$30
+1257 : c6 43 __ DEC T4 + 0
+1259 : a4 43 __ LDY T4 + 0
+125b : 91 46 __ STA (T7 + 0),y
+125d : a5 48 __ LDA T8 + 0
+125f : 85 1b __ STA ACCU + 0
+1261 : a5 49 __ LDA T8 + 1
+1263 : 85 1c __ STA ACCU + 1
+1265 : a0 35 __ LDY #$35
+1267 : b1 25 __ LDA (FP + 0),y
+1269 : 85 03 __ STA $03
+126b : c8 __ __ INY
+126c : b1 25 __ LDA (FP + 0),y
+126e : 85 04 __ STA $04
+1270 : 20 49 20 JSR $2049 ; (divmod + 0)
+1273 : a5 1b __ LDA ACCU + 0
+1275 : 85 48 __ STA T8 + 0
+1277 : a5 1c __ LDA ACCU + 1
+1279 : 85 49 __ STA T8 + 1
+127b : 05 1b __ ORA ACCU + 0
+127d : d0 b9 __ BNE $1238
+127f : 4c 70 11 JMP $1170 ; (printf + 1223)
+1282 : d0 06 __ BNE $128a
+1284 : a5 05 __ LDA $05
+1286 : c9 0a __ CMP #$0a
+1288 : 90 c8 __ BCC $1252
+128a : 18 __ __ CLC
+128b : a5 05 __ LDA $05
+128d : 69 37 __ ADC #$37
+128f : 4c 57 12 JMP $1257 ; (printf + 1454)
+1292 : a5 53 __ LDA T1 + 0
+1294 : 85 46 __ STA T7 + 0
+1296 : a5 54 __ LDA T1 + 1
+1298 : 85 47 __ STA T7 + 1
+129a : a0 00 __ LDY #$00
+129c : b1 59 __ LDA (T5 + 0),y
+129e : 85 48 __ STA T8 + 0
+12a0 : c8 __ __ INY
+12a1 : b1 59 __ LDA (T5 + 0),y
+12a3 : 85 49 __ STA T8 + 1
+12a5 : 18 __ __ CLC
+12a6 : a5 59 __ LDA T5 + 0
+12a8 : 69 02 __ ADC #$02
+12aa : 85 59 __ STA T5 + 0
+12ac : 90 02 __ BCC $12b0
+12ae : e6 5a __ INC T5 + 1
+12b0 : a5 49 __ LDA T8 + 1
+12b2 : 10 03 __ BPL $12b7
+12b4 : 4c 01 14 JMP $1401 ; (printf + 1880)
+12b7 : a5 48 __ LDA T8 + 0
+12b9 : 85 4a __ STA T9 + 0
+12bb : a5 49 __ LDA T8 + 1
+12bd : 85 4b __ STA T9 + 1
+12bf : a9 00 __ LDA #$00
+12c1 : 85 55 __ STA T2 + 0
+12c3 : a9 0a __ LDA #$0a
+12c5 : 85 43 __ STA T4 + 0
+12c7 : a5 48 __ LDA T8 + 0
+12c9 : 05 49 __ ORA T8 + 1
+12cb : f0 03 __ BEQ $12d0
+12cd : 4c a7 13 JMP $13a7 ; (printf + 1790)
+12d0 : a0 34 __ LDY #$34
+12d2 : b1 25 __ LDA (FP + 0),y
+12d4 : 85 44 __ STA T6 + 0
+12d6 : c9 ff __ CMP #$ff
+12d8 : d0 03 __ BNE $12dd
+12da : 4c 99 13 JMP $1399 ; (printf + 1776)
+12dd : 38 __ __ SEC
+12de : a9 0a __ LDA #$0a
+12e0 : e5 44 __ SBC T6 + 0
+12e2 : 85 44 __ STA T6 + 0
+12e4 : c5 43 __ CMP T4 + 0
+12e6 : b0 0e __ BCS $12f6
+12e8 : c6 43 __ DEC T4 + 0
+12ea : a9 30 __ LDA #$30
+12ec : a4 43 __ LDY T4 + 0
+12ee : 91 46 __ STA (T7 + 0),y
+12f0 : a5 44 __ LDA T6 + 0
+12f2 : c5 43 __ CMP T4 + 0
+12f4 : 90 f2 __ BCC $12e8
+12f6 : a0 39 __ LDY #$39
+12f8 : b1 25 __ LDA (FP + 0),y
+12fa : f0 34 __ BEQ $1330
+12fc : a0 35 __ LDY #$35
+12fe : b1 25 __ LDA (FP + 0),y
+1300 : 85 48 __ STA T8 + 0
+1302 : c8 __ __ INY
+1303 : b1 25 __ LDA (FP + 0),y
+1305 : d0 29 __ BNE $1330
+1307 : a5 48 __ LDA T8 + 0
+1309 : c9 10 __ CMP #$10
+130b : d0 23 __ BNE $1330
+130d : 18 __ __ CLC
+130e : a5 43 __ LDA T4 + 0
+1310 : 69 ff __ ADC #$ff
+1312 : 18 __ __ CLC
+1313 : 65 46 __ ADC T7 + 0
+1315 : 85 48 __ STA T8 + 0
+1317 : a5 47 __ LDA T7 + 1
+1319 : 69 00 __ ADC #$00
+131b : 85 49 __ STA T8 + 1
+131d : a9 58 __ LDA #$58
+131f : a0 00 __ LDY #$00
+1321 : 91 48 __ STA (T8 + 0),y
+1323 : 18 __ __ CLC
+1324 : a5 43 __ LDA T4 + 0
+1326 : 69 fe __ ADC #$fe
+1328 : 85 43 __ STA T4 + 0
+132a : a9 30 __ LDA #$30
+132c : a4 43 __ LDY T4 + 0
+132e : 91 46 __ STA (T7 + 0),y
+1330 : a5 55 __ LDA T2 + 0
+1332 : d0 5a __ BNE $138e
+1334 : a0 37 __ LDY #$37
+1336 : b1 25 __ LDA (FP + 0),y
+1338 : f0 08 __ BEQ $1342
+133a : c6 43 __ DEC T4 + 0
+133c : a9 2b __ LDA #$2b
+133e : a4 43 __ LDY T4 + 0
+1340 : 91 46 __ STA (T7 + 0),y
+1342 : a0 33 __ LDY #$33
+1344 : b1 25 __ LDA (FP + 0),y
+1346 : 85 55 __ STA T2 + 0
+1348 : 38 __ __ SEC
+1349 : a9 0a __ LDA #$0a
+134b : e5 55 __ SBC T2 + 0
+134d : 85 48 __ STA T8 + 0
+134f : a9 00 __ LDA #$00
+1351 : e9 00 __ SBC #$00
+1353 : 49 80 __ EOR #$80
+1355 : c9 80 __ CMP #$80
+1357 : d0 04 __ BNE $135d
+1359 : a5 48 __ LDA T8 + 0
+135b : c5 43 __ CMP T4 + 0
+135d : 90 22 __ BCC $1381
+135f : a9 00 __ LDA #$00
+1361 : 85 55 __ STA T2 + 0
+1363 : a5 43 __ LDA T4 + 0
+1365 : c9 0a __ CMP #$0a
+1367 : 90 03 __ BCC $136c
+1369 : 4c 71 0d JMP $0d71 ; (printf + 200)
+136c : a4 43 __ LDY T4 + 0
+136e : b1 46 __ LDA (T7 + 0),y
+1370 : a4 55 __ LDY T2 + 0
+1372 : 91 46 __ STA (T7 + 0),y
+1374 : e6 55 __ INC T2 + 0
+1376 : e6 43 __ INC T4 + 0
+1378 : a5 43 __ LDA T4 + 0
+137a : c9 0a __ CMP #$0a
+137c : 90 ee __ BCC $136c
+137e : 4c 71 0d JMP $0d71 ; (printf + 200)
+1381 : c6 43 __ DEC T4 + 0
+1383 : a0 32 __ LDY #$32
+1385 : b1 25 __ LDA (FP + 0),y
+1387 : a4 43 __ LDY T4 + 0
+1389 : 91 46 __ STA (T7 + 0),y
+138b : 4c 42 13 JMP $1342 ; (printf + 1689)
+138e : c6 43 __ DEC T4 + 0
+1390 : a9 2d __ LDA #$2d
+1392 : a4 43 __ LDY T4 + 0
+1394 : 91 46 __ STA (T7 + 0),y
+1396 : 4c 42 13 JMP $1342 ; (printf + 1689)
+1399 : a9 09 __ LDA #$09
+139b : 85 44 __ STA T6 + 0
+139d : c5 43 __ CMP T4 + 0
+139f : b0 03 __ BCS $13a4
+13a1 : 4c e8 12 JMP $12e8 ; (printf + 1599)
+13a4 : 4c f6 12 JMP $12f6 ; (printf + 1613)
+13a7 : a5 4a __ LDA T9 + 0
+13a9 : 85 1b __ STA ACCU + 0
+13ab : a5 4b __ LDA T9 + 1
+13ad : 85 1c __ STA ACCU + 1
+13af : a0 35 __ LDY #$35
+13b1 : b1 25 __ LDA (FP + 0),y
+13b3 : 85 03 __ STA $03
+13b5 : c8 __ __ INY
+13b6 : b1 25 __ LDA (FP + 0),y
+13b8 : 85 04 __ STA $04
+13ba : 20 49 20 JSR $2049 ; (divmod + 0)
+13bd : a5 06 __ LDA $06
+13bf : 10 30 __ BPL $13f1
+13c1 : 18 __ __ CLC
+13c2 : a5 05 __ LDA $05
+13c4 : 69 30 __ ADC #$30
+13c6 : c6 43 __ DEC T4 + 0
+13c8 : a4 43 __ LDY T4 + 0
+13ca : 91 46 __ STA (T7 + 0),y
+13cc : a5 4a __ LDA T9 + 0
+13ce : 85 1b __ STA ACCU + 0
+13d0 : a5 4b __ LDA T9 + 1
+13d2 : 85 1c __ STA ACCU + 1
+13d4 : a0 35 __ LDY #$35
+13d6 : b1 25 __ LDA (FP + 0),y
+13d8 : 85 03 __ STA $03
+13da : c8 __ __ INY
+13db : b1 25 __ LDA (FP + 0),y
+13dd : 85 04 __ STA $04
+13df : 20 49 20 JSR $2049 ; (divmod + 0)
+13e2 : a5 1b __ LDA ACCU + 0
+13e4 : 85 4a __ STA T9 + 0
+13e6 : a5 1c __ LDA ACCU + 1
+13e8 : 85 4b __ STA T9 + 1
+13ea : 05 1b __ ORA ACCU + 0
+13ec : d0 b9 __ BNE $13a7
+13ee : 4c d0 12 JMP $12d0 ; (printf + 1575)
+13f1 : d0 06 __ BNE $13f9
+13f3 : a5 05 __ LDA $05
+13f5 : c9 0a __ CMP #$0a
+13f7 : 90 c8 __ BCC $13c1
+13f9 : 18 __ __ CLC
+13fa : a5 05 __ LDA $05
+13fc : 69 37 __ ADC #$37
+13fe : 4c c6 13 JMP $13c6 ; (printf + 1821)
+1401 : a9 01 __ LDA #$01
+1403 : 85 55 __ STA T2 + 0
+1405 : a9 0a __ LDA #$0a
+1407 : 85 43 __ STA T4 + 0
+1409 : 38 __ __ SEC
+140a : a9 00 __ LDA #$00
+140c : e5 48 __ SBC T8 + 0
+140e : 85 4a __ STA T9 + 0
+1410 : a9 00 __ LDA #$00
+1412 : e5 49 __ SBC T8 + 1
+1414 : 85 4b __ STA T9 + 1
+1416 : 05 4a __ ORA T9 + 0
+1418 : d0 8d __ BNE $13a7
+141a : 4c d0 12 JMP $12d0 ; (printf + 1575)
+141d : a9 00 __ LDA #$00
+141f : 85 46 __ STA T7 + 0
+1421 : 85 47 __ STA T7 + 1
+1423 : a0 00 __ LDY #$00
+1425 : b1 57 __ LDA (T3 + 0),y
+1427 : 85 43 __ STA T4 + 0
+1429 : e6 57 __ INC T3 + 0
+142b : d0 02 __ BNE $142f
+142d : e6 58 __ INC T3 + 1
+142f : a5 43 __ LDA T4 + 0
+1431 : c9 30 __ CMP #$30
+1433 : 90 4d __ BCC $1482
+1435 : a9 39 __ LDA #$39
+1437 : c5 43 __ CMP T4 + 0
+1439 : 90 47 __ BCC $1482
+143b : a5 43 __ LDA T4 + 0
+143d : 85 48 __ STA T8 + 0
+143f : a0 00 __ LDY #$00
+1441 : b1 57 __ LDA (T3 + 0),y
+1443 : 85 43 __ STA T4 + 0
+1445 : e6 57 __ INC T3 + 0
+1447 : d0 02 __ BNE $144b
+1449 : e6 58 __ INC T3 + 1
+144b : a5 46 __ LDA T7 + 0
+144d : 0a __ __ ASL
+144e : 85 07 __ STA $07
+1450 : a5 47 __ LDA T7 + 1
+1452 : 2a __ __ ROL
+1453 : 06 07 __ ASL $07
+1455 : 2a __ __ ROL
+1456 : aa __ __ TAX
+1457 : 18 __ __ CLC
+1458 : a5 07 __ LDA $07
+145a : 65 46 __ ADC T7 + 0
+145c : 85 1b __ STA ACCU + 0
+145e : 8a __ __ TXA
+145f : 65 47 __ ADC T7 + 1
+1461 : 06 1b __ ASL ACCU + 0
+1463 : 2a __ __ ROL
+1464 : 85 1c __ STA ACCU + 1
+1466 : 18 __ __ CLC
+1467 : a5 1b __ LDA ACCU + 0
+1469 : 65 48 __ ADC T8 + 0
+146b : aa __ __ TAX
+146c : a5 1c __ LDA ACCU + 1
+146e : 69 00 __ ADC #$00
+1470 : a8 __ __ TAY
+1471 : 38 __ __ SEC
+1472 : 8a __ __ TXA
+1473 : e9 30 __ SBC #$30
+1475 : 85 46 __ STA T7 + 0
+1477 : 98 __ __ TYA
+1478 : e9 00 __ SBC #$00
+147a : 85 47 __ STA T7 + 1
+147c : a5 43 __ LDA T4 + 0
+147e : c9 30 __ CMP #$30
+1480 : b0 b3 __ BCS $1435
+1482 : a5 46 __ LDA T7 + 0
+1484 : a0 34 __ LDY #$34
+1486 : 91 25 __ STA (FP + 0),y
+1488 : 4c 63 0e JMP $0e63 ; (printf + 442)
+148b : a9 01 __ LDA #$01
+148d : a0 39 __ LDY #$39
+148f : 91 25 __ STA (FP + 0),y
+1491 : a0 00 __ LDY #$00
+1493 : b1 57 __ LDA (T3 + 0),y
+1495 : 85 43 __ STA T4 + 0
+1497 : 4c d4 0d JMP $0dd4 ; (printf + 299)
+149a : a9 30 __ LDA #$30
+149c : a0 32 __ LDY #$32
+149e : 91 25 __ STA (FP + 0),y
+14a0 : a0 00 __ LDY #$00
+14a2 : b1 57 __ LDA (T3 + 0),y
+14a4 : 85 43 __ STA T4 + 0
+14a6 : 4c d4 0d JMP $0dd4 ; (printf + 299)
+14a9 : a9 01 __ LDA #$01
+14ab : a0 37 __ LDY #$37
+14ad : 91 25 __ STA (FP + 0),y
+14af : a0 00 __ LDY #$00
+14b1 : b1 57 __ LDA (T3 + 0),y
+14b3 : 85 43 __ STA T4 + 0
+14b5 : 4c d4 0d JMP $0dd4 ; (printf + 299)
+--------------------------------------------------------------------
+puts:
+14b8 : a0 00 __ LDY #$00
+14ba : b1 0d __ LDA (P0),y
+14bc : f0 0b __ BEQ $14c9
+14be : 20 ca 14 JSR $14ca ; (putpch + 0)
+14c1 : e6 0d __ INC P0
+14c3 : d0 f3 __ BNE $14b8
+14c5 : e6 0e __ INC P1
+14c7 : d0 ef __ BNE $14b8
+14c9 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+14ca : ae 2d 22 LDX $222d ; (giocharmap + 0)
+14cd : e0 01 __ CPX #$01
+14cf : 90 22 __ BCC $14f3
+14d1 : c9 0a __ CMP #$0a
+14d3 : d0 02 __ BNE $14d7
+14d5 : a9 0d __ LDA #$0d
+14d7 : e0 02 __ CPX #$02
+14d9 : 90 18 __ BCC $14f3
+14db : c9 41 __ CMP #$41
+14dd : 90 14 __ BCC $14f3
+14df : c9 7b __ CMP #$7b
+14e1 : b0 10 __ BCS $14f3
+14e3 : c9 61 __ CMP #$61
+14e5 : b0 04 __ BCS $14eb
+14e7 : c9 5b __ CMP #$5b
+14e9 : b0 08 __ BCS $14f3
+14eb : 49 20 __ EOR #$20
+14ed : e0 03 __ CPX #$03
+14ef : f0 02 __ BEQ $14f3
+14f1 : 29 df __ AND #$df
+14f3 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+14f6 : 38 __ __ SEC
+14f7 : a5 23 __ LDA SP + 0
+14f9 : e9 05 __ SBC #$05
+14fb : 85 23 __ STA SP + 0
+14fd : a5 24 __ LDA SP + 1
+14ff : e9 00 __ SBC #$00
+1501 : 85 24 __ STA SP + 1
+1503 : a0 01 __ LDY #$01
+1505 : b9 53 00 LDA $0053,y 
+1508 : 91 23 __ STA (SP + 0),y
+150a : 88 __ __ DEY
+150b : 10 f8 __ BPL $1505
+150d : a5 11 __ LDA P4
+150f : 85 47 __ STA T1 + 0
+1511 : a5 12 __ LDA P5
+1513 : 85 48 __ STA T1 + 1
+1515 : a5 13 __ LDA P6
+1517 : 85 49 __ STA T1 + 2
+1519 : a5 14 __ LDA P7
+151b : 85 4a __ STA T1 + 3
+151d : a9 00 __ LDA #$00
+151f : 85 4d __ STA T3 + 0
+1521 : a5 15 __ LDA P8
+1523 : f0 03 __ BEQ $1528
+1525 : 4c ce 16 JMP $16ce ; (nforml + 472)
+1528 : a9 10 __ LDA #$10
+152a : 85 4e __ STA T4 + 0
+152c : a9 00 __ LDA #$00
+152e : c5 14 __ CMP P7
+1530 : d0 0a __ BNE $153c
+1532 : c5 13 __ CMP P6
+1534 : d0 06 __ BNE $153c
+1536 : c5 12 __ CMP P5
+1538 : d0 02 __ BNE $153c
+153a : c5 11 __ CMP P4
+153c : b0 03 __ BCS $1541
+153e : 4c 42 16 JMP $1642 ; (nforml + 332)
+1541 : a0 02 __ LDY #$02
+1543 : b1 0d __ LDA (P0),y
+1545 : 85 4f __ STA T5 + 0
+1547 : c9 ff __ CMP #$ff
+1549 : d0 03 __ BNE $154e
+154b : 4c 34 16 JMP $1634 ; (nforml + 318)
+154e : 38 __ __ SEC
+154f : a9 10 __ LDA #$10
+1551 : e5 4f __ SBC T5 + 0
+1553 : 85 4f __ STA T5 + 0
+1555 : c5 4e __ CMP T4 + 0
+1557 : b0 0e __ BCS $1567
+1559 : c6 4e __ DEC T4 + 0
+155b : a9 30 __ LDA #$30
+155d : a4 4e __ LDY T4 + 0
+155f : 91 0f __ STA (P2),y
+1561 : a5 4f __ LDA T5 + 0
+1563 : c5 4e __ CMP T4 + 0
+1565 : 90 f2 __ BCC $1559
+1567 : a0 07 __ LDY #$07
+1569 : b1 0d __ LDA (P0),y
+156b : f0 34 __ BEQ $15a1
+156d : a0 03 __ LDY #$03
+156f : b1 0d __ LDA (P0),y
+1571 : 85 53 __ STA T7 + 0
+1573 : c8 __ __ INY
+1574 : b1 0d __ LDA (P0),y
+1576 : d0 29 __ BNE $15a1
+1578 : a5 53 __ LDA T7 + 0
+157a : c9 10 __ CMP #$10
+157c : d0 23 __ BNE $15a1
+157e : 18 __ __ CLC
+157f : a5 4e __ LDA T4 + 0
+1581 : 69 ff __ ADC #$ff
+1583 : 18 __ __ CLC
+1584 : 65 0f __ ADC P2
+1586 : 85 53 __ STA T7 + 0
+1588 : a5 10 __ LDA P3
+158a : 69 00 __ ADC #$00
+158c : 85 54 __ STA T7 + 1
+158e : a9 58 __ LDA #$58
+1590 : a0 00 __ LDY #$00
+1592 : 91 53 __ STA (T7 + 0),y
+1594 : 18 __ __ CLC
+1595 : a5 4e __ LDA T4 + 0
+1597 : 69 fe __ ADC #$fe
+1599 : 85 4e __ STA T4 + 0
+159b : a9 30 __ LDA #$30
+159d : a4 4e __ LDY T4 + 0
+159f : 91 0f __ STA (P2),y
+15a1 : a5 4d __ LDA T3 + 0
+15a3 : f0 03 __ BEQ $15a8
+15a5 : 4c 29 16 JMP $1629 ; (nforml + 307)
+15a8 : a0 05 __ LDY #$05
+15aa : b1 0d __ LDA (P0),y
+15ac : f0 08 __ BEQ $15b6
+15ae : c6 4e __ DEC T4 + 0
+15b0 : a9 2b __ LDA #$2b
+15b2 : a4 4e __ LDY T4 + 0
+15b4 : 91 0f __ STA (P2),y
+15b6 : a0 01 __ LDY #$01
+15b8 : b1 0d __ LDA (P0),y
+15ba : 85 53 __ STA T7 + 0
+15bc : 38 __ __ SEC
+15bd : a9 10 __ LDA #$10
+15bf : e5 53 __ SBC T7 + 0
+15c1 : 85 53 __ STA T7 + 0
+15c3 : a9 00 __ LDA #$00
+15c5 : e9 00 __ SBC #$00
+15c7 : 49 80 __ EOR #$80
+15c9 : c9 80 __ CMP #$80
+15cb : d0 04 __ BNE $15d1
+15cd : a5 53 __ LDA T7 + 0
+15cf : c5 4e __ CMP T4 + 0
+15d1 : 90 49 __ BCC $161c
+15d3 : a9 00 __ LDA #$00
+15d5 : 85 4d __ STA T3 + 0
+15d7 : a5 4e __ LDA T4 + 0
+15d9 : c9 10 __ CMP #$10
+15db : 90 20 __ BCC $15fd
+15dd : a5 4d __ LDA T3 + 0
+15df : 85 1b __ STA ACCU + 0
+15e1 : a9 00 __ LDA #$00
+15e3 : 85 1c __ STA ACCU + 1
+15e5 : a0 01 __ LDY #$01
+15e7 : b1 23 __ LDA (SP + 0),y
+15e9 : 99 53 00 STA $0053,y 
+15ec : 88 __ __ DEY
+15ed : 10 f8 __ BPL $15e7
+15ef : 18 __ __ CLC
+15f0 : a5 23 __ LDA SP + 0
+15f2 : 69 05 __ ADC #$05
+15f4 : 85 23 __ STA SP + 0
+15f6 : a5 24 __ LDA SP + 1
+15f8 : 69 00 __ ADC #$00
+15fa : 85 24 __ STA SP + 1
+15fc : 60 __ __ RTS
+15fd : aa __ __ TAX
+15fe : 8a __ __ TXA
+15ff : 18 __ __ CLC
+1600 : 65 0f __ ADC P2
+1602 : 85 51 __ STA T6 + 0
+1604 : a5 10 __ LDA P3
+1606 : 69 00 __ ADC #$00
+1608 : 85 52 __ STA T6 + 1
+160a : a0 00 __ LDY #$00
+160c : b1 51 __ LDA (T6 + 0),y
+160e : a4 4d __ LDY T3 + 0
+1610 : 91 0f __ STA (P2),y
+1612 : e6 4d __ INC T3 + 0
+1614 : e8 __ __ INX
+1615 : e0 10 __ CPX #$10
+1617 : 90 e5 __ BCC $15fe
+1619 : 4c dd 15 JMP $15dd ; (nforml + 231)
+161c : c6 4e __ DEC T4 + 0
+161e : a0 00 __ LDY #$00
+1620 : b1 0d __ LDA (P0),y
+1622 : a4 4e __ LDY T4 + 0
+1624 : 91 0f __ STA (P2),y
+1626 : 4c b6 15 JMP $15b6 ; (nforml + 192)
+1629 : c6 4e __ DEC T4 + 0
+162b : a9 2d __ LDA #$2d
+162d : a4 4e __ LDY T4 + 0
+162f : 91 0f __ STA (P2),y
+1631 : 4c b6 15 JMP $15b6 ; (nforml + 192)
+1634 : a9 0f __ LDA #$0f
+1636 : 85 4f __ STA T5 + 0
+1638 : c5 4e __ CMP T4 + 0
+163a : b0 03 __ BCS $163f
+163c : 4c 59 15 JMP $1559 ; (nforml + 99)
+163f : 4c 67 15 JMP $1567 ; (nforml + 113)
+1642 : a0 03 __ LDY #$03
+1644 : b1 0d __ LDA (P0),y
+1646 : 85 03 __ STA $03
+1648 : c8 __ __ INY
+1649 : b1 0d __ LDA (P0),y
+164b : 85 04 __ STA $04
+164d : a9 00 __ LDA #$00
+164f : 85 05 __ STA $05
+1651 : 85 06 __ STA $06
+1653 : a5 47 __ LDA T1 + 0
+1655 : 85 1b __ STA ACCU + 0
+1657 : a5 48 __ LDA T1 + 1
+1659 : 85 1c __ STA ACCU + 1
+165b : a5 49 __ LDA T1 + 2
+165d : 85 1d __ STA ACCU + 2
+165f : a5 4a __ LDA T1 + 3
+1661 : 85 1e __ STA ACCU + 3
+1663 : 20 d5 21 JSR $21d5 ; (divmod32 + 0)
+1666 : a5 08 __ LDA $08
+1668 : 10 54 __ BPL $16be
+166a : 18 __ __ CLC
+166b : a5 07 __ LDA $07
+166d : 69 30 __ ADC #$30
+166f : c6 4e __ DEC T4 + 0
+1671 : a4 4e __ LDY T4 + 0
+1673 : 91 0f __ STA (P2),y
+1675 : a0 03 __ LDY #$03
+1677 : b1 0d __ LDA (P0),y
+1679 : 85 03 __ STA $03
+167b : c8 __ __ INY
+167c : b1 0d __ LDA (P0),y
+167e : 85 04 __ STA $04
+1680 : a9 00 __ LDA #$00
+1682 : 85 05 __ STA $05
+1684 : 85 06 __ STA $06
+1686 : a5 47 __ LDA T1 + 0
+1688 : 85 1b __ STA ACCU + 0
+168a : a5 48 __ LDA T1 + 1
+168c : 85 1c __ STA ACCU + 1
+168e : a5 49 __ LDA T1 + 2
+1690 : 85 1d __ STA ACCU + 2
+1692 : a5 4a __ LDA T1 + 3
+1694 : 85 1e __ STA ACCU + 3
+1696 : 20 d5 21 JSR $21d5 ; (divmod32 + 0)
+1699 : a5 1b __ LDA ACCU + 0
+169b : 85 47 __ STA T1 + 0
+169d : a5 1c __ LDA ACCU + 1
+169f : 85 48 __ STA T1 + 1
+16a1 : a5 1d __ LDA ACCU + 2
+16a3 : 85 49 __ STA T1 + 2
+16a5 : a5 1e __ LDA ACCU + 3
+16a7 : 85 4a __ STA T1 + 3
+16a9 : a9 00 __ LDA #$00
+16ab : c5 1e __ CMP ACCU + 3
+16ad : d0 0a __ BNE $16b9
+16af : c5 1d __ CMP ACCU + 2
+16b1 : d0 06 __ BNE $16b9
+16b3 : c5 1c __ CMP ACCU + 1
+16b5 : d0 02 __ BNE $16b9
+16b7 : c5 1b __ CMP ACCU + 0
+16b9 : 90 87 __ BCC $1642
+16bb : 4c 41 15 JMP $1541 ; (nforml + 75)
+16be : d0 06 __ BNE $16c6
+16c0 : a5 07 __ LDA $07
+16c2 : c9 0a __ CMP #$0a
+16c4 : 90 a4 __ BCC $166a
+16c6 : 18 __ __ CLC
+16c7 : a5 07 __ LDA $07
+16c9 : 69 37 __ ADC #$37
+16cb : 4c 6f 16 JMP $166f ; (nforml + 377)
+16ce : a5 14 __ LDA P7
+16d0 : 49 80 __ EOR #$80
+16d2 : c9 80 __ CMP #$80
+16d4 : d0 0f __ BNE $16e5
+16d6 : a5 13 __ LDA P6
+16d8 : c9 00 __ CMP #$00
+16da : d0 09 __ BNE $16e5
+16dc : a5 12 __ LDA P5
+16de : c9 00 __ CMP #$00
+16e0 : d0 03 __ BNE $16e5
+16e2 : 4c 28 15 JMP $1528 ; (nforml + 50)
+16e5 : 90 03 __ BCC $16ea
+16e7 : 4c 28 15 JMP $1528 ; (nforml + 50)
+16ea : a9 01 __ LDA #$01
+16ec : 85 4d __ STA T3 + 0
+16ee : a9 10 __ LDA #$10
+16f0 : 85 4e __ STA T4 + 0
+16f2 : 38 __ __ SEC
+16f3 : a9 00 __ LDA #$00
+16f5 : e5 11 __ SBC P4
+16f7 : 85 47 __ STA T1 + 0
+16f9 : a9 00 __ LDA #$00
+16fb : e5 12 __ SBC P5
+16fd : 85 48 __ STA T1 + 1
+16ff : a9 00 __ LDA #$00
+1701 : e5 13 __ SBC P6
+1703 : 85 49 __ STA T1 + 2
+1705 : a9 00 __ LDA #$00
+1707 : e5 14 __ SBC P7
+1709 : 85 4a __ STA T1 + 3
+170b : a9 00 __ LDA #$00
+170d : c5 4a __ CMP T1 + 3
+170f : d0 0a __ BNE $171b
+1711 : c5 49 __ CMP T1 + 2
+1713 : d0 06 __ BNE $171b
+1715 : c5 48 __ CMP T1 + 1
+1717 : d0 02 __ BNE $171b
+1719 : c5 47 __ CMP T1 + 0
+171b : b0 03 __ BCS $1720
+171d : 4c 42 16 JMP $1642 ; (nforml + 332)
+1720 : 4c 41 15 JMP $1541 ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+1723 : 38 __ __ SEC
+1724 : a5 23 __ LDA SP + 0
+1726 : e9 0a __ SBC #$0a
+1728 : 85 23 __ STA SP + 0
+172a : a5 24 __ LDA SP + 1
+172c : e9 00 __ SBC #$00
+172e : 85 24 __ STA SP + 1
+1730 : a0 03 __ LDY #$03
+1732 : b9 53 00 LDA $0053,y 
+1735 : 91 23 __ STA (SP + 0),y
+1737 : 88 __ __ DEY
+1738 : 10 f8 __ BPL $1732
+173a : a9 00 __ LDA #$00
+173c : 85 1b __ STA ACCU + 0
+173e : 85 1c __ STA ACCU + 1
+1740 : 85 1d __ STA ACCU + 2
+1742 : 85 1e __ STA ACCU + 3
+1744 : a5 11 __ LDA P4
+1746 : 85 03 __ STA $03
+1748 : a5 12 __ LDA P5
+174a : 85 04 __ STA $04
+174c : a5 13 __ LDA P6
+174e : 85 05 __ STA $05
+1750 : a5 14 __ LDA P7
+1752 : 85 06 __ STA $06
+1754 : 20 84 21 JSR $2184 ; (fcmp + 0)
+1757 : 10 03 __ BPL $175c
+1759 : 4c 87 1d JMP $1d87 ; (nformf + 1636)
+175c : a9 00 __ LDA #$00
+175e : 85 4b __ STA T3 + 0
+1760 : a0 05 __ LDY #$05
+1762 : b1 0d __ LDA (P0),y
+1764 : f0 0a __ BEQ $1770
+1766 : a9 2b __ LDA #$2b
+1768 : a0 00 __ LDY #$00
+176a : 91 0f __ STA (P2),y
+176c : a9 01 __ LDA #$01
+176e : 85 4b __ STA T3 + 0
+1770 : a9 00 __ LDA #$00
+1772 : 85 43 __ STA T0 + 0
+1774 : 85 44 __ STA T0 + 1
+1776 : a0 02 __ LDY #$02
+1778 : b1 0d __ LDA (P0),y
+177a : 85 4e __ STA T5 + 0
+177c : c9 ff __ CMP #$ff
+177e : d0 04 __ BNE $1784
+1780 : a9 06 __ LDA #$06
+1782 : 85 4e __ STA T5 + 0
+1784 : a9 00 __ LDA #$00
+1786 : 85 1b __ STA ACCU + 0
+1788 : 85 1c __ STA ACCU + 1
+178a : 85 1d __ STA ACCU + 2
+178c : 85 1e __ STA ACCU + 3
+178e : a5 11 __ LDA P4
+1790 : 85 03 __ STA $03
+1792 : a5 12 __ LDA P5
+1794 : 85 04 __ STA $04
+1796 : a5 13 __ LDA P6
+1798 : 85 05 __ STA $05
+179a : a5 14 __ LDA P7
+179c : 85 06 __ STA $06
+179e : 20 84 21 JSR $2184 ; (fcmp + 0)
+17a1 : d0 03 __ BNE $17a6
+17a3 : 4c 2a 19 JMP $192a ; (nformf + 519)
+17a6 : a9 00 __ LDA #$00
+17a8 : 85 1b __ STA ACCU + 0
+17aa : 85 1c __ STA ACCU + 1
+17ac : a9 7a __ LDA #$7a
+17ae : 85 1d __ STA ACCU + 2
+17b0 : a9 44 __ LDA #$44
+17b2 : 85 1e __ STA ACCU + 3
+17b4 : a5 11 __ LDA P4
+17b6 : 85 03 __ STA $03
+17b8 : a5 12 __ LDA P5
+17ba : 85 04 __ STA $04
+17bc : a5 13 __ LDA P6
+17be : 85 05 __ STA $05
+17c0 : a5 14 __ LDA P7
+17c2 : 85 06 __ STA $06
+17c4 : 20 84 21 JSR $2184 ; (fcmp + 0)
+17c7 : 30 5a __ BMI $1823
+17c9 : a5 11 __ LDA P4
+17cb : 85 1b __ STA ACCU + 0
+17cd : a5 12 __ LDA P5
+17cf : 85 1c __ STA ACCU + 1
+17d1 : a5 13 __ LDA P6
+17d3 : 85 1d __ STA ACCU + 2
+17d5 : a5 14 __ LDA P7
+17d7 : 85 1e __ STA ACCU + 3
+17d9 : a9 00 __ LDA #$00
+17db : 85 03 __ STA $03
+17dd : 85 04 __ STA $04
+17df : a9 7a __ LDA #$7a
+17e1 : 85 05 __ STA $05
+17e3 : a9 44 __ LDA #$44
+17e5 : 85 06 __ STA $06
+17e7 : 20 fa 1d JSR $1dfa ; (freg + 20)
+17ea : 20 91 1f JSR $1f91 ; (fdiv + 0)
+17ed : a5 1b __ LDA ACCU + 0
+17ef : 85 11 __ STA P4
+17f1 : 85 03 __ STA $03
+17f3 : a5 1c __ LDA ACCU + 1
+17f5 : 85 12 __ STA P5
+17f7 : 85 04 __ STA $04
+17f9 : a5 1d __ LDA ACCU + 2
+17fb : 85 13 __ STA P6
+17fd : 85 05 __ STA $05
+17ff : a5 1e __ LDA ACCU + 3
+1801 : 85 14 __ STA P7
+1803 : 85 06 __ STA $06
+1805 : 18 __ __ CLC
+1806 : a5 43 __ LDA T0 + 0
+1808 : 69 03 __ ADC #$03
+180a : 85 43 __ STA T0 + 0
+180c : 90 02 __ BCC $1810
+180e : e6 44 __ INC T0 + 1
+1810 : a9 00 __ LDA #$00
+1812 : 85 1b __ STA ACCU + 0
+1814 : 85 1c __ STA ACCU + 1
+1816 : a9 7a __ LDA #$7a
+1818 : 85 1d __ STA ACCU + 2
+181a : a9 44 __ LDA #$44
+181c : 85 1e __ STA ACCU + 3
+181e : 20 84 21 JSR $2184 ; (fcmp + 0)
+1821 : 10 a6 __ BPL $17c9
+1823 : a9 00 __ LDA #$00
+1825 : 85 1b __ STA ACCU + 0
+1827 : 85 1c __ STA ACCU + 1
+1829 : a9 80 __ LDA #$80
+182b : 85 1d __ STA ACCU + 2
+182d : a9 3f __ LDA #$3f
+182f : 85 1e __ STA ACCU + 3
+1831 : a5 11 __ LDA P4
+1833 : 85 03 __ STA $03
+1835 : a5 12 __ LDA P5
+1837 : 85 04 __ STA $04
+1839 : a5 13 __ LDA P6
+183b : 85 05 __ STA $05
+183d : a5 14 __ LDA P7
+183f : 85 06 __ STA $06
+1841 : 20 84 21 JSR $2184 ; (fcmp + 0)
+1844 : 10 5c __ BPL $18a2
+1846 : a5 11 __ LDA P4
+1848 : 85 1b __ STA ACCU + 0
+184a : a5 12 __ LDA P5
+184c : 85 1c __ STA ACCU + 1
+184e : a5 13 __ LDA P6
+1850 : 85 1d __ STA ACCU + 2
+1852 : a5 14 __ LDA P7
+1854 : 85 1e __ STA ACCU + 3
+1856 : a9 00 __ LDA #$00
+1858 : 85 03 __ STA $03
+185a : 85 04 __ STA $04
+185c : a9 7a __ LDA #$7a
+185e : 85 05 __ STA $05
+1860 : a9 44 __ LDA #$44
+1862 : 85 06 __ STA $06
+1864 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1867 : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+186a : a5 1b __ LDA ACCU + 0
+186c : 85 11 __ STA P4
+186e : 85 03 __ STA $03
+1870 : a5 1c __ LDA ACCU + 1
+1872 : 85 12 __ STA P5
+1874 : 85 04 __ STA $04
+1876 : a5 1d __ LDA ACCU + 2
+1878 : 85 13 __ STA P6
+187a : 85 05 __ STA $05
+187c : a5 1e __ LDA ACCU + 3
+187e : 85 14 __ STA P7
+1880 : 85 06 __ STA $06
+1882 : 38 __ __ SEC
+1883 : a5 43 __ LDA T0 + 0
+1885 : e9 03 __ SBC #$03
+1887 : 85 43 __ STA T0 + 0
+1889 : a5 44 __ LDA T0 + 1
+188b : e9 00 __ SBC #$00
+188d : 85 44 __ STA T0 + 1
+188f : a9 00 __ LDA #$00
+1891 : 85 1b __ STA ACCU + 0
+1893 : 85 1c __ STA ACCU + 1
+1895 : a9 80 __ LDA #$80
+1897 : 85 1d __ STA ACCU + 2
+1899 : a9 3f __ LDA #$3f
+189b : 85 1e __ STA ACCU + 3
+189d : 20 84 21 JSR $2184 ; (fcmp + 0)
+18a0 : 30 a4 __ BMI $1846
+18a2 : a9 00 __ LDA #$00
+18a4 : 85 1b __ STA ACCU + 0
+18a6 : 85 1c __ STA ACCU + 1
+18a8 : a9 20 __ LDA #$20
+18aa : 85 1d __ STA ACCU + 2
+18ac : a9 41 __ LDA #$41
+18ae : 85 1e __ STA ACCU + 3
+18b0 : a5 11 __ LDA P4
+18b2 : 85 03 __ STA $03
+18b4 : a5 12 __ LDA P5
+18b6 : 85 04 __ STA $04
+18b8 : a5 13 __ LDA P6
+18ba : 85 05 __ STA $05
+18bc : a5 14 __ LDA P7
+18be : 85 06 __ STA $06
+18c0 : 20 84 21 JSR $2184 ; (fcmp + 0)
+18c3 : 30 65 __ BMI $192a
+18c5 : a5 11 __ LDA P4
+18c7 : 85 1b __ STA ACCU + 0
+18c9 : a5 12 __ LDA P5
+18cb : 85 1c __ STA ACCU + 1
+18cd : a5 13 __ LDA P6
+18cf : 85 1d __ STA ACCU + 2
+18d1 : a5 14 __ LDA P7
+18d3 : 85 1e __ STA ACCU + 3
+18d5 : a9 00 __ LDA #$00
+18d7 : 85 03 __ STA $03
+18d9 : 85 04 __ STA $04
+18db : a9 20 __ LDA #$20
+18dd : 85 05 __ STA $05
+18df : a9 41 __ LDA #$41
+18e1 : 85 06 __ STA $06
+18e3 : 20 fa 1d JSR $1dfa ; (freg + 20)
+18e6 : 20 91 1f JSR $1f91 ; (fdiv + 0)
+18e9 : a5 1b __ LDA ACCU + 0
+18eb : 85 11 __ STA P4
+18ed : 85 47 __ STA T2 + 0
+18ef : a5 1c __ LDA ACCU + 1
+18f1 : 85 12 __ STA P5
+18f3 : 85 48 __ STA T2 + 1
+18f5 : a5 1d __ LDA ACCU + 2
+18f7 : 85 13 __ STA P6
+18f9 : 85 49 __ STA T2 + 2
+18fb : a5 1e __ LDA ACCU + 3
+18fd : 85 14 __ STA P7
+18ff : 85 4a __ STA T2 + 3
+1901 : e6 43 __ INC T0 + 0
+1903 : d0 02 __ BNE $1907
+1905 : e6 44 __ INC T0 + 1
+1907 : a9 00 __ LDA #$00
+1909 : 85 1b __ STA ACCU + 0
+190b : 85 1c __ STA ACCU + 1
+190d : a9 20 __ LDA #$20
+190f : 85 1d __ STA ACCU + 2
+1911 : a9 41 __ LDA #$41
+1913 : 85 1e __ STA ACCU + 3
+1915 : a5 47 __ LDA T2 + 0
+1917 : 85 03 __ STA $03
+1919 : a5 48 __ LDA T2 + 1
+191b : 85 04 __ STA $04
+191d : a5 49 __ LDA T2 + 2
+191f : 85 05 __ STA $05
+1921 : a5 4a __ LDA T2 + 3
+1923 : 85 06 __ STA $06
+1925 : 20 84 21 JSR $2184 ; (fcmp + 0)
+1928 : 10 9b __ BPL $18c5
+192a : a5 15 __ LDA P8
+192c : c9 65 __ CMP #$65
+192e : d0 03 __ BNE $1933
+1930 : 4c 82 1d JMP $1d82 ; (nformf + 1631)
+1933 : a9 00 __ LDA #$00
+1935 : 85 51 __ STA T7 + 0
+1937 : 85 52 __ STA T8 + 0
+1939 : a5 4e __ LDA T5 + 0
+193b : 85 4c __ STA T4 + 0
+193d : e6 4c __ INC T4 + 0
+193f : a5 15 __ LDA P8
+1941 : c9 67 __ CMP #$67
+1943 : d0 03 __ BNE $1948
+1945 : 4c 65 1d JMP $1d65 ; (nformf + 1602)
+1948 : a5 51 __ LDA T7 + 0
+194a : f0 03 __ BEQ $194f
+194c : 4c 73 1c JMP $1c73 ; (nformf + 1360)
+194f : a5 44 __ LDA T0 + 1
+1951 : 10 03 __ BPL $1956
+1953 : 4c 32 1c JMP $1c32 ; (nformf + 1295)
+1956 : a9 00 __ LDA #$00
+1958 : 85 47 __ STA T2 + 0
+195a : 85 48 __ STA T2 + 1
+195c : 85 49 __ STA T2 + 2
+195e : a9 3f __ LDA #$3f
+1960 : 85 4a __ STA T2 + 3
+1962 : 18 __ __ CLC
+1963 : a5 4e __ LDA T5 + 0
+1965 : 65 43 __ ADC T0 + 0
+1967 : 85 4c __ STA T4 + 0
+1969 : e6 4c __ INC T4 + 0
+196b : a9 01 __ LDA #$01
+196d : c5 4c __ CMP T4 + 0
+196f : b0 03 __ BCS $1974
+1971 : 4c f1 1b JMP $1bf1 ; (nformf + 1230)
+1974 : a5 11 __ LDA P4
+1976 : 85 1b __ STA ACCU + 0
+1978 : a5 12 __ LDA P5
+197a : 85 1c __ STA ACCU + 1
+197c : a5 13 __ LDA P6
+197e : 85 1d __ STA ACCU + 2
+1980 : a5 14 __ LDA P7
+1982 : 85 1e __ STA ACCU + 3
+1984 : a5 47 __ LDA T2 + 0
+1986 : 85 03 __ STA $03
+1988 : a5 48 __ LDA T2 + 1
+198a : 85 04 __ STA $04
+198c : a5 49 __ LDA T2 + 2
+198e : 85 05 __ STA $05
+1990 : a5 4a __ LDA T2 + 3
+1992 : 85 06 __ STA $06
+1994 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1997 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+199a : a5 1b __ LDA ACCU + 0
+199c : 85 11 __ STA P4
+199e : 85 47 __ STA T2 + 0
+19a0 : 85 03 __ STA $03
+19a2 : a5 1c __ LDA ACCU + 1
+19a4 : 85 12 __ STA P5
+19a6 : 85 48 __ STA T2 + 1
+19a8 : 85 04 __ STA $04
+19aa : a5 1d __ LDA ACCU + 2
+19ac : 85 13 __ STA P6
+19ae : 85 49 __ STA T2 + 2
+19b0 : 85 05 __ STA $05
+19b2 : a5 1e __ LDA ACCU + 3
+19b4 : 85 14 __ STA P7
+19b6 : 85 4a __ STA T2 + 3
+19b8 : 85 06 __ STA $06
+19ba : a9 00 __ LDA #$00
+19bc : 85 1b __ STA ACCU + 0
+19be : 85 1c __ STA ACCU + 1
+19c0 : a9 20 __ LDA #$20
+19c2 : 85 1d __ STA ACCU + 2
+19c4 : a9 41 __ LDA #$41
+19c6 : 85 1e __ STA ACCU + 3
+19c8 : 20 84 21 JSR $2184 ; (fcmp + 0)
+19cb : 30 36 __ BMI $1a03
+19cd : a5 47 __ LDA T2 + 0
+19cf : 85 1b __ STA ACCU + 0
+19d1 : a5 48 __ LDA T2 + 1
+19d3 : 85 1c __ STA ACCU + 1
+19d5 : a5 49 __ LDA T2 + 2
+19d7 : 85 1d __ STA ACCU + 2
+19d9 : a5 4a __ LDA T2 + 3
+19db : 85 1e __ STA ACCU + 3
+19dd : a9 00 __ LDA #$00
+19df : 85 03 __ STA $03
+19e1 : 85 04 __ STA $04
+19e3 : a9 20 __ LDA #$20
+19e5 : 85 05 __ STA $05
+19e7 : a9 41 __ LDA #$41
+19e9 : 85 06 __ STA $06
+19eb : 20 fa 1d JSR $1dfa ; (freg + 20)
+19ee : 20 91 1f JSR $1f91 ; (fdiv + 0)
+19f1 : a5 1b __ LDA ACCU + 0
+19f3 : 85 11 __ STA P4
+19f5 : a5 1c __ LDA ACCU + 1
+19f7 : 85 12 __ STA P5
+19f9 : a5 1d __ LDA ACCU + 2
+19fb : 85 13 __ STA P6
+19fd : a5 1e __ LDA ACCU + 3
+19ff : 85 14 __ STA P7
+1a01 : c6 4e __ DEC T5 + 0
+1a03 : 38 __ __ SEC
+1a04 : a5 4c __ LDA T4 + 0
+1a06 : e5 4e __ SBC T5 + 0
+1a08 : 85 53 __ STA T10 + 0
+1a0a : 85 4e __ STA T5 + 0
+1a0c : a9 14 __ LDA #$14
+1a0e : c5 4c __ CMP T4 + 0
+1a10 : b0 02 __ BCS $1a14
+1a12 : 85 4c __ STA T4 + 0
+1a14 : a5 53 __ LDA T10 + 0
+1a16 : d0 08 __ BNE $1a20
+1a18 : a9 30 __ LDA #$30
+1a1a : a4 4b __ LDY T3 + 0
+1a1c : 91 0f __ STA (P2),y
+1a1e : e6 4b __ INC T3 + 0
+1a20 : a9 00 __ LDA #$00
+1a22 : 85 50 __ STA T6 + 0
+1a24 : a5 4c __ LDA T4 + 0
+1a26 : f0 03 __ BEQ $1a2b
+1a28 : 4c 60 1b JMP $1b60 ; (nformf + 1085)
+1a2b : a5 52 __ LDA T8 + 0
+1a2d : f0 03 __ BEQ $1a32
+1a2f : 4c e0 1a JMP $1ae0 ; (nformf + 957)
+1a32 : a5 4b __ LDA T3 + 0
+1a34 : a0 01 __ LDY #$01
+1a36 : d1 0d __ CMP (P0),y
+1a38 : 90 1e __ BCC $1a58
+1a3a : 85 1b __ STA ACCU + 0
+1a3c : a9 00 __ LDA #$00
+1a3e : 85 1c __ STA ACCU + 1
+1a40 : a0 03 __ LDY #$03
+1a42 : b1 23 __ LDA (SP + 0),y
+1a44 : 99 53 00 STA $0053,y 
+1a47 : 88 __ __ DEY
+1a48 : 10 f8 __ BPL $1a42
+1a4a : 18 __ __ CLC
+1a4b : a5 23 __ LDA SP + 0
+1a4d : 69 0a __ ADC #$0a
+1a4f : 85 23 __ STA SP + 0
+1a51 : a5 24 __ LDA SP + 1
+1a53 : 69 00 __ ADC #$00
+1a55 : 85 24 __ STA SP + 1
+1a57 : 60 __ __ RTS
+1a58 : c9 01 __ CMP #$01
+1a5a : 90 53 __ BCC $1aaf
+1a5c : a9 01 __ LDA #$01
+1a5e : 85 4e __ STA T5 + 0
+1a60 : a5 0d __ LDA P0
+1a62 : 85 43 __ STA T0 + 0
+1a64 : a5 0e __ LDA P1
+1a66 : 85 44 __ STA T0 + 1
+1a68 : a5 4b __ LDA T3 + 0
+1a6a : 85 4c __ STA T4 + 0
+1a6c : 38 __ __ SEC
+1a6d : a5 4c __ LDA T4 + 0
+1a6f : e5 4e __ SBC T5 + 0
+1a71 : 85 55 __ STA T11 + 0
+1a73 : a9 00 __ LDA #$00
+1a75 : e9 00 __ SBC #$00
+1a77 : 85 56 __ STA T11 + 1
+1a79 : 18 __ __ CLC
+1a7a : a5 0f __ LDA P2
+1a7c : 65 55 __ ADC T11 + 0
+1a7e : 85 55 __ STA T11 + 0
+1a80 : a5 10 __ LDA P3
+1a82 : 65 56 __ ADC T11 + 1
+1a84 : 85 56 __ STA T11 + 1
+1a86 : a0 01 __ LDY #$01
+1a88 : b1 43 __ LDA (T0 + 0),y
+1a8a : 38 __ __ SEC
+1a8b : e5 4e __ SBC T5 + 0
+1a8d : 85 53 __ STA T10 + 0
+1a8f : a9 00 __ LDA #$00
+1a91 : e9 00 __ SBC #$00
+1a93 : 85 54 __ STA T10 + 1
+1a95 : 18 __ __ CLC
+1a96 : a5 0f __ LDA P2
+1a98 : 65 53 __ ADC T10 + 0
+1a9a : 85 53 __ STA T10 + 0
+1a9c : a5 10 __ LDA P3
+1a9e : 65 54 __ ADC T10 + 1
+1aa0 : 85 54 __ STA T10 + 1
+1aa2 : 88 __ __ DEY
+1aa3 : b1 55 __ LDA (T11 + 0),y
+1aa5 : 91 53 __ STA (T10 + 0),y
+1aa7 : e6 4e __ INC T5 + 0
+1aa9 : a5 4b __ LDA T3 + 0
+1aab : c5 4e __ CMP T5 + 0
+1aad : b0 bd __ BCS $1a6c
+1aaf : a9 00 __ LDA #$00
+1ab1 : 85 4e __ STA T5 + 0
+1ab3 : a0 01 __ LDY #$01
+1ab5 : b1 0d __ LDA (P0),y
+1ab7 : 85 50 __ STA T6 + 0
+1ab9 : 38 __ __ SEC
+1aba : e5 4b __ SBC T3 + 0
+1abc : 85 4c __ STA T4 + 0
+1abe : a9 00 __ LDA #$00
+1ac0 : e9 00 __ SBC #$00
+1ac2 : 85 4d __ STA T4 + 1
+1ac4 : a9 00 __ LDA #$00
+1ac6 : c5 4d __ CMP T4 + 1
+1ac8 : d0 04 __ BNE $1ace
+1aca : a5 4e __ LDA T5 + 0
+1acc : c5 4c __ CMP T4 + 0
+1ace : 90 05 __ BCC $1ad5
+1ad0 : a5 50 __ LDA T6 + 0
+1ad2 : 4c 3a 1a JMP $1a3a ; (nformf + 791)
+1ad5 : a9 20 __ LDA #$20
+1ad7 : a4 4e __ LDY T5 + 0
+1ad9 : 91 0f __ STA (P2),y
+1adb : e6 4e __ INC T5 + 0
+1add : 4c b3 1a JMP $1ab3 ; (nformf + 912)
+1ae0 : a9 45 __ LDA #$45
+1ae2 : a4 4b __ LDY T3 + 0
+1ae4 : 91 0f __ STA (P2),y
+1ae6 : c8 __ __ INY
+1ae7 : a5 44 __ LDA T0 + 1
+1ae9 : 30 5a __ BMI $1b45
+1aeb : a9 2b __ LDA #$2b
+1aed : 91 0f __ STA (P2),y
+1aef : 18 __ __ CLC
+1af0 : a5 4b __ LDA T3 + 0
+1af2 : 69 02 __ ADC #$02
+1af4 : 85 4b __ STA T3 + 0
+1af6 : a5 43 __ LDA T0 + 0
+1af8 : 85 1b __ STA ACCU + 0
+1afa : a5 44 __ LDA T0 + 1
+1afc : 85 1c __ STA ACCU + 1
+1afe : a9 0a __ LDA #$0a
+1b00 : 85 03 __ STA $03
+1b02 : a9 00 __ LDA #$00
+1b04 : 85 04 __ STA $04
+1b06 : 20 0f 20 JSR $200f ; (divs16 + 0)
+1b09 : 18 __ __ CLC
+1b0a : a5 1b __ LDA ACCU + 0
+1b0c : 69 30 __ ADC #$30
+1b0e : a4 4b __ LDY T3 + 0
+1b10 : 91 0f __ STA (P2),y
+1b12 : c8 __ __ INY
+1b13 : 98 __ __ TYA
+1b14 : 18 __ __ CLC
+1b15 : 65 0f __ ADC P2
+1b17 : 85 4c __ STA T4 + 0
+1b19 : a5 10 __ LDA P3
+1b1b : 69 00 __ ADC #$00
+1b1d : 85 4d __ STA T4 + 1
+1b1f : a5 43 __ LDA T0 + 0
+1b21 : 85 1b __ STA ACCU + 0
+1b23 : a5 44 __ LDA T0 + 1
+1b25 : 85 1c __ STA ACCU + 1
+1b27 : a9 0a __ LDA #$0a
+1b29 : 85 03 __ STA $03
+1b2b : a9 00 __ LDA #$00
+1b2d : 85 04 __ STA $04
+1b2f : 20 ce 20 JSR $20ce ; (mods16 + 0)
+1b32 : 18 __ __ CLC
+1b33 : a5 05 __ LDA $05
+1b35 : 69 30 __ ADC #$30
+1b37 : a0 00 __ LDY #$00
+1b39 : 91 4c __ STA (T4 + 0),y
+1b3b : 18 __ __ CLC
+1b3c : a5 4b __ LDA T3 + 0
+1b3e : 69 02 __ ADC #$02
+1b40 : 85 4b __ STA T3 + 0
+1b42 : 4c 32 1a JMP $1a32 ; (nformf + 783)
+1b45 : a9 2d __ LDA #$2d
+1b47 : 91 0f __ STA (P2),y
+1b49 : 18 __ __ CLC
+1b4a : a5 4b __ LDA T3 + 0
+1b4c : 69 02 __ ADC #$02
+1b4e : 85 4b __ STA T3 + 0
+1b50 : 38 __ __ SEC
+1b51 : a9 00 __ LDA #$00
+1b53 : e5 43 __ SBC T0 + 0
+1b55 : 85 43 __ STA T0 + 0
+1b57 : a9 00 __ LDA #$00
+1b59 : e5 44 __ SBC T0 + 1
+1b5b : 85 44 __ STA T0 + 1
+1b5d : 4c f6 1a JMP $1af6 ; (nformf + 979)
+1b60 : a5 50 __ LDA T6 + 0
+1b62 : c5 4e __ CMP T5 + 0
+1b64 : d0 08 __ BNE $1b6e
+1b66 : a9 2e __ LDA #$2e
+1b68 : a4 4b __ LDY T3 + 0
+1b6a : 91 0f __ STA (P2),y
+1b6c : e6 4b __ INC T3 + 0
+1b6e : a5 11 __ LDA P4
+1b70 : 85 1b __ STA ACCU + 0
+1b72 : a5 12 __ LDA P5
+1b74 : 85 1c __ STA ACCU + 1
+1b76 : a5 13 __ LDA P6
+1b78 : 85 1d __ STA ACCU + 2
+1b7a : a5 14 __ LDA P7
+1b7c : 85 1e __ STA ACCU + 3
+1b7e : 20 f7 20 JSR $20f7 ; (f32_to_i16 + 0)
+1b81 : a5 1b __ LDA ACCU + 0
+1b83 : 85 53 __ STA T10 + 0
+1b85 : 20 39 21 JSR $2139 ; (sint16_to_float + 0)
+1b88 : a5 1b __ LDA ACCU + 0
+1b8a : 85 03 __ STA $03
+1b8c : a5 1c __ LDA ACCU + 1
+1b8e : 85 04 __ STA $04
+1b90 : a5 1d __ LDA ACCU + 2
+1b92 : 85 05 __ STA $05
+1b94 : a5 1e __ LDA ACCU + 3
+1b96 : 85 06 __ STA $06
+1b98 : a5 11 __ LDA P4
+1b9a : 85 1b __ STA ACCU + 0
+1b9c : a5 12 __ LDA P5
+1b9e : 85 1c __ STA ACCU + 1
+1ba0 : a5 13 __ LDA P6
+1ba2 : 85 1d __ STA ACCU + 2
+1ba4 : a5 14 __ LDA P7
+1ba6 : 85 1e __ STA ACCU + 3
+1ba8 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1bab : a5 06 __ LDA $06
+1bad : 49 80 __ EOR #$80
+1baf : 85 06 __ STA $06
+1bb1 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+1bb4 : a9 00 __ LDA #$00
+1bb6 : 85 03 __ STA $03
+1bb8 : 85 04 __ STA $04
+1bba : a9 20 __ LDA #$20
+1bbc : 85 05 __ STA $05
+1bbe : a9 41 __ LDA #$41
+1bc0 : 85 06 __ STA $06
+1bc2 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1bc5 : 20 f3 1e JSR $1ef3 ; (fmul + 0)
+1bc8 : a5 1b __ LDA ACCU + 0
+1bca : 85 11 __ STA P4
+1bcc : a5 1c __ LDA ACCU + 1
+1bce : 85 12 __ STA P5
+1bd0 : a5 1d __ LDA ACCU + 2
+1bd2 : 85 13 __ STA P6
+1bd4 : a5 1e __ LDA ACCU + 3
+1bd6 : 85 14 __ STA P7
+1bd8 : 18 __ __ CLC
+1bd9 : a5 53 __ LDA T10 + 0
+1bdb : 69 30 __ ADC #$30
+1bdd : a4 4b __ LDY T3 + 0
+1bdf : 91 0f __ STA (P2),y
+1be1 : e6 4b __ INC T3 + 0
+1be3 : e6 50 __ INC T6 + 0
+1be5 : a5 50 __ LDA T6 + 0
+1be7 : c5 4c __ CMP T4 + 0
+1be9 : b0 03 __ BCS $1bee
+1beb : 4c 60 1b JMP $1b60 ; (nformf + 1085)
+1bee : 4c 2b 1a JMP $1a2b ; (nformf + 776)
+1bf1 : 85 50 __ STA T6 + 0
+1bf3 : a5 47 __ LDA T2 + 0
+1bf5 : 85 1b __ STA ACCU + 0
+1bf7 : a5 48 __ LDA T2 + 1
+1bf9 : 85 1c __ STA ACCU + 1
+1bfb : a5 49 __ LDA T2 + 2
+1bfd : 85 1d __ STA ACCU + 2
+1bff : a5 4a __ LDA T2 + 3
+1c01 : 85 1e __ STA ACCU + 3
+1c03 : a9 00 __ LDA #$00
+1c05 : 85 03 __ STA $03
+1c07 : 85 04 __ STA $04
+1c09 : a9 20 __ LDA #$20
+1c0b : 85 05 __ STA $05
+1c0d : a9 41 __ LDA #$41
+1c0f : 85 06 __ STA $06
+1c11 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1c14 : 20 91 1f JSR $1f91 ; (fdiv + 0)
+1c17 : a5 1b __ LDA ACCU + 0
+1c19 : 85 47 __ STA T2 + 0
+1c1b : a5 1c __ LDA ACCU + 1
+1c1d : 85 48 __ STA T2 + 1
+1c1f : a5 1d __ LDA ACCU + 2
+1c21 : 85 49 __ STA T2 + 2
+1c23 : a5 1e __ LDA ACCU + 3
+1c25 : 85 4a __ STA T2 + 3
+1c27 : e6 50 __ INC T6 + 0
+1c29 : a5 50 __ LDA T6 + 0
+1c2b : c5 4c __ CMP T4 + 0
+1c2d : 90 c4 __ BCC $1bf3
+1c2f : 4c 74 19 JMP $1974 ; (nformf + 593)
+1c32 : a5 11 __ LDA P4
+1c34 : 85 1b __ STA ACCU + 0
+1c36 : a5 12 __ LDA P5
+1c38 : 85 1c __ STA ACCU + 1
+1c3a : a5 13 __ LDA P6
+1c3c : 85 1d __ STA ACCU + 2
+1c3e : a5 14 __ LDA P7
+1c40 : 85 1e __ STA ACCU + 3
+1c42 : a9 00 __ LDA #$00
+1c44 : 85 03 __ STA $03
+1c46 : 85 04 __ STA $04
+1c48 : a9 20 __ LDA #$20
+1c4a : 85 05 __ STA $05
+1c4c : a9 41 __ LDA #$41
+1c4e : 85 06 __ STA $06
+1c50 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1c53 : 20 91 1f JSR $1f91 ; (fdiv + 0)
+1c56 : a5 1b __ LDA ACCU + 0
+1c58 : 85 11 __ STA P4
+1c5a : a5 1c __ LDA ACCU + 1
+1c5c : 85 12 __ STA P5
+1c5e : a5 1d __ LDA ACCU + 2
+1c60 : 85 13 __ STA P6
+1c62 : a5 1e __ LDA ACCU + 3
+1c64 : 85 14 __ STA P7
+1c66 : e6 43 __ INC T0 + 0
+1c68 : d0 02 __ BNE $1c6c
+1c6a : e6 44 __ INC T0 + 1
+1c6c : a5 44 __ LDA T0 + 1
+1c6e : 30 c2 __ BMI $1c32
+1c70 : 4c 56 19 JMP $1956 ; (nformf + 563)
+1c73 : a9 00 __ LDA #$00
+1c75 : 85 47 __ STA T2 + 0
+1c77 : 85 48 __ STA T2 + 1
+1c79 : 85 49 __ STA T2 + 2
+1c7b : a9 3f __ LDA #$3f
+1c7d : 85 4a __ STA T2 + 3
+1c7f : a5 4e __ LDA T5 + 0
+1c81 : f0 03 __ BEQ $1c86
+1c83 : 4c 22 1d JMP $1d22 ; (nformf + 1535)
+1c86 : a5 11 __ LDA P4
+1c88 : 85 1b __ STA ACCU + 0
+1c8a : a5 12 __ LDA P5
+1c8c : 85 1c __ STA ACCU + 1
+1c8e : a5 13 __ LDA P6
+1c90 : 85 1d __ STA ACCU + 2
+1c92 : a5 14 __ LDA P7
+1c94 : 85 1e __ STA ACCU + 3
+1c96 : a5 47 __ LDA T2 + 0
+1c98 : 85 03 __ STA $03
+1c9a : a5 48 __ LDA T2 + 1
+1c9c : 85 04 __ STA $04
+1c9e : a5 49 __ LDA T2 + 2
+1ca0 : 85 05 __ STA $05
+1ca2 : a5 4a __ LDA T2 + 3
+1ca4 : 85 06 __ STA $06
+1ca6 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1ca9 : 20 2b 1e JSR $1e2b ; (faddsub + 0)
+1cac : a5 1b __ LDA ACCU + 0
+1cae : 85 11 __ STA P4
+1cb0 : 85 47 __ STA T2 + 0
+1cb2 : 85 03 __ STA $03
+1cb4 : a5 1c __ LDA ACCU + 1
+1cb6 : 85 12 __ STA P5
+1cb8 : 85 48 __ STA T2 + 1
+1cba : 85 04 __ STA $04
+1cbc : a5 1d __ LDA ACCU + 2
+1cbe : 85 13 __ STA P6
+1cc0 : 85 49 __ STA T2 + 2
+1cc2 : 85 05 __ STA $05
+1cc4 : a5 1e __ LDA ACCU + 3
+1cc6 : 85 14 __ STA P7
+1cc8 : 85 4a __ STA T2 + 3
+1cca : 85 06 __ STA $06
+1ccc : a9 00 __ LDA #$00
+1cce : 85 1b __ STA ACCU + 0
+1cd0 : 85 1c __ STA ACCU + 1
+1cd2 : a9 20 __ LDA #$20
+1cd4 : 85 1d __ STA ACCU + 2
+1cd6 : a9 41 __ LDA #$41
+1cd8 : 85 1e __ STA ACCU + 3
+1cda : 20 84 21 JSR $2184 ; (fcmp + 0)
+1cdd : 10 03 __ BPL $1ce2
+1cdf : 4c 03 1a JMP $1a03 ; (nformf + 736)
+1ce2 : a5 47 __ LDA T2 + 0
+1ce4 : 85 1b __ STA ACCU + 0
+1ce6 : a5 48 __ LDA T2 + 1
+1ce8 : 85 1c __ STA ACCU + 1
+1cea : a5 49 __ LDA T2 + 2
+1cec : 85 1d __ STA ACCU + 2
+1cee : a5 4a __ LDA T2 + 3
+1cf0 : 85 1e __ STA ACCU + 3
+1cf2 : a9 00 __ LDA #$00
+1cf4 : 85 03 __ STA $03
+1cf6 : 85 04 __ STA $04
+1cf8 : a9 20 __ LDA #$20
+1cfa : 85 05 __ STA $05
+1cfc : a9 41 __ LDA #$41
+1cfe : 85 06 __ STA $06
+1d00 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1d03 : 20 91 1f JSR $1f91 ; (fdiv + 0)
+1d06 : a5 1b __ LDA ACCU + 0
+1d08 : 85 11 __ STA P4
+1d0a : a5 1c __ LDA ACCU + 1
+1d0c : 85 12 __ STA P5
+1d0e : a5 1d __ LDA ACCU + 2
+1d10 : 85 13 __ STA P6
+1d12 : a5 1e __ LDA ACCU + 3
+1d14 : 85 14 __ STA P7
+1d16 : e6 43 __ INC T0 + 0
+1d18 : f0 03 __ BEQ $1d1d
+1d1a : 4c 03 1a JMP $1a03 ; (nformf + 736)
+1d1d : e6 44 __ INC T0 + 1
+1d1f : 4c 03 1a JMP $1a03 ; (nformf + 736)
+1d22 : a9 00 __ LDA #$00
+1d24 : 85 50 __ STA T6 + 0
+1d26 : a5 47 __ LDA T2 + 0
+1d28 : 85 1b __ STA ACCU + 0
+1d2a : a5 48 __ LDA T2 + 1
+1d2c : 85 1c __ STA ACCU + 1
+1d2e : a5 49 __ LDA T2 + 2
+1d30 : 85 1d __ STA ACCU + 2
+1d32 : a5 4a __ LDA T2 + 3
+1d34 : 85 1e __ STA ACCU + 3
+1d36 : a9 00 __ LDA #$00
+1d38 : 85 03 __ STA $03
+1d3a : 85 04 __ STA $04
+1d3c : a9 20 __ LDA #$20
+1d3e : 85 05 __ STA $05
+1d40 : a9 41 __ LDA #$41
+1d42 : 85 06 __ STA $06
+1d44 : 20 fa 1d JSR $1dfa ; (freg + 20)
+1d47 : 20 91 1f JSR $1f91 ; (fdiv + 0)
+1d4a : a5 1b __ LDA ACCU + 0
+1d4c : 85 47 __ STA T2 + 0
+1d4e : a5 1c __ LDA ACCU + 1
+1d50 : 85 48 __ STA T2 + 1
+1d52 : a5 1d __ LDA ACCU + 2
+1d54 : 85 49 __ STA T2 + 2
+1d56 : a5 1e __ LDA ACCU + 3
+1d58 : 85 4a __ STA T2 + 3
+1d5a : e6 50 __ INC T6 + 0
+1d5c : a5 50 __ LDA T6 + 0
+1d5e : c5 4e __ CMP T5 + 0
+1d60 : 90 c4 __ BCC $1d26
+1d62 : 4c 86 1c JMP $1c86 ; (nformf + 1379)
+1d65 : a5 44 __ LDA T0 + 1
+1d67 : 10 0e __ BPL $1d77
+1d69 : a5 44 __ LDA T0 + 1
+1d6b : 30 03 __ BMI $1d70
+1d6d : 4c 48 19 JMP $1948 ; (nformf + 549)
+1d70 : a9 01 __ LDA #$01
+1d72 : 85 52 __ STA T8 + 0
+1d74 : 4c 73 1c JMP $1c73 ; (nformf + 1360)
+1d77 : d0 f7 __ BNE $1d70
+1d79 : a9 03 __ LDA #$03
+1d7b : c5 43 __ CMP T0 + 0
+1d7d : 90 f1 __ BCC $1d70
+1d7f : 4c 69 1d JMP $1d69 ; (nformf + 1606)
+1d82 : a9 01 __ LDA #$01
+1d84 : 4c 35 19 JMP $1935 ; (nformf + 530)
+1d87 : a5 14 __ LDA P7
+1d89 : 49 80 __ EOR #$80
+1d8b : 85 14 __ STA P7
+1d8d : a9 2d __ LDA #$2d
+1d8f : a0 00 __ LDY #$00
+1d91 : 91 0f __ STA (P2),y
+1d93 : a9 01 __ LDA #$01
+1d95 : 85 4b __ STA T3 + 0
+1d97 : 4c 70 17 JMP $1770 ; (nformf + 77)
+--------------------------------------------------------------------
+assert:
+1da7 : a0 02 __ LDY #$02
+1da9 : b1 23 __ LDA (SP + 0),y
+1dab : d0 09 __ BNE $1db6
+1dad : a9 ff __ LDA #$ff
+1daf : 85 0d __ STA P0
+1db1 : 85 0e __ STA P1
+1db3 : 20 b7 1d JSR $1db7 ; (exit + 0)
+1db6 : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1db7 : a5 0d __ LDA P0
+1db9 : 85 1b __ STA ACCU + 0
+1dbb : a5 0e __ LDA P1
+1dbd : 85 1c __ STA ACCU + 1
+1dbf : ae 2c 22 LDX $222c ; (spentry + 0)
+1dc2 : 9a __ __ TXS
+1dc3 : a9 4c __ LDA #$4c
+1dc5 : 85 54 __ STA $54
+1dc7 : a9 00 __ LDA #$00
+1dc9 : 85 13 __ STA P6
+1dcb : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1dd9 : a9 4c __ LDA #$4c
+1ddb : 85 54 __ STA $54
+1ddd : a9 00 __ LDA #$00
+1ddf : 85 13 __ STA P6
+1de1 : a9 19 __ LDA #$19
+1de3 : 85 16 __ STA P9
+1de5 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1de6 : b1 19 __ LDA (IP + 0),y
+1de8 : c8 __ __ INY
+1de9 : aa __ __ TAX
+1dea : b5 00 __ LDA $00,x
+1dec : 85 03 __ STA $03
+1dee : b5 01 __ LDA $01,x
+1df0 : 85 04 __ STA $04
+1df2 : b5 02 __ LDA $02,x
+1df4 : 85 05 __ STA $05
+1df6 : b5 03 __ LDA $03,x
+1df8 : 85 06 __ STA $06
+1dfa : a5 05 __ LDA $05
+1dfc : 0a __ __ ASL
+1dfd : a5 06 __ LDA $06
+1dff : 2a __ __ ROL
+1e00 : 85 08 __ STA $08
+1e02 : f0 06 __ BEQ $1e0a
+1e04 : a5 05 __ LDA $05
+1e06 : 09 80 __ ORA #$80
+1e08 : 85 05 __ STA $05
+1e0a : a5 1d __ LDA ACCU + 2
+1e0c : 0a __ __ ASL
+1e0d : a5 1e __ LDA ACCU + 3
+1e0f : 2a __ __ ROL
+1e10 : 85 07 __ STA $07
+1e12 : f0 06 __ BEQ $1e1a
+1e14 : a5 1d __ LDA ACCU + 2
+1e16 : 09 80 __ ORA #$80
+1e18 : 85 1d __ STA ACCU + 2
+1e1a : 60 __ __ RTS
+1e1b : 06 1e __ ASL ACCU + 3
+1e1d : a5 07 __ LDA $07
+1e1f : 6a __ __ ROR
+1e20 : 85 1e __ STA ACCU + 3
+1e22 : b0 06 __ BCS $1e2a
+1e24 : a5 1d __ LDA ACCU + 2
+1e26 : 29 7f __ AND #$7f
+1e28 : 85 1d __ STA ACCU + 2
+1e2a : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1e2b : 38 __ __ SEC
+1e2c : a5 07 __ LDA $07
+1e2e : e5 08 __ SBC $08
+1e30 : f0 38 __ BEQ $1e6a
+1e32 : aa __ __ TAX
+1e33 : b0 25 __ BCS $1e5a
+1e35 : e0 e9 __ CPX #$e9
+1e37 : b0 0e __ BCS $1e47
+1e39 : a5 08 __ LDA $08
+1e3b : 85 07 __ STA $07
+1e3d : a9 00 __ LDA #$00
+1e3f : 85 1b __ STA ACCU + 0
+1e41 : 85 1c __ STA ACCU + 1
+1e43 : 85 1d __ STA ACCU + 2
+1e45 : f0 23 __ BEQ $1e6a
+1e47 : a5 1d __ LDA ACCU + 2
+1e49 : 4a __ __ LSR
+1e4a : 66 1c __ ROR ACCU + 1
+1e4c : 66 1b __ ROR ACCU + 0
+1e4e : e8 __ __ INX
+1e4f : d0 f8 __ BNE $1e49
+1e51 : 85 1d __ STA ACCU + 2
+1e53 : a5 08 __ LDA $08
+1e55 : 85 07 __ STA $07
+1e57 : 4c 6a 1e JMP $1e6a ; (faddsub + 63)
+1e5a : e0 18 __ CPX #$18
+1e5c : b0 33 __ BCS $1e91
+1e5e : a5 05 __ LDA $05
+1e60 : 4a __ __ LSR
+1e61 : 66 04 __ ROR $04
+1e63 : 66 03 __ ROR $03
+1e65 : ca __ __ DEX
+1e66 : d0 f8 __ BNE $1e60
+1e68 : 85 05 __ STA $05
+1e6a : a5 1e __ LDA ACCU + 3
+1e6c : 29 80 __ AND #$80
+1e6e : 85 1e __ STA ACCU + 3
+1e70 : 45 06 __ EOR $06
+1e72 : 30 2d __ BMI $1ea1
+1e74 : 18 __ __ CLC
+1e75 : a5 1b __ LDA ACCU + 0
+1e77 : 65 03 __ ADC $03
+1e79 : 85 1b __ STA ACCU + 0
+1e7b : a5 1c __ LDA ACCU + 1
+1e7d : 65 04 __ ADC $04
+1e7f : 85 1c __ STA ACCU + 1
+1e81 : a5 1d __ LDA ACCU + 2
+1e83 : 65 05 __ ADC $05
+1e85 : 85 1d __ STA ACCU + 2
+1e87 : 90 08 __ BCC $1e91
+1e89 : 66 1d __ ROR ACCU + 2
+1e8b : 66 1c __ ROR ACCU + 1
+1e8d : 66 1b __ ROR ACCU + 0
+1e8f : e6 07 __ INC $07
+1e91 : a5 07 __ LDA $07
+1e93 : 4a __ __ LSR
+1e94 : 05 1e __ ORA ACCU + 3
+1e96 : 85 1e __ STA ACCU + 3
+1e98 : b0 06 __ BCS $1ea0
+1e9a : a5 1d __ LDA ACCU + 2
+1e9c : 29 7f __ AND #$7f
+1e9e : 85 1d __ STA ACCU + 2
+1ea0 : 60 __ __ RTS
+1ea1 : 38 __ __ SEC
+1ea2 : a5 1b __ LDA ACCU + 0
+1ea4 : e5 03 __ SBC $03
+1ea6 : 85 1b __ STA ACCU + 0
+1ea8 : a5 1c __ LDA ACCU + 1
+1eaa : e5 04 __ SBC $04
+1eac : 85 1c __ STA ACCU + 1
+1eae : a5 1d __ LDA ACCU + 2
+1eb0 : e5 05 __ SBC $05
+1eb2 : 85 1d __ STA ACCU + 2
+1eb4 : b0 19 __ BCS $1ecf
+1eb6 : 38 __ __ SEC
+1eb7 : a9 00 __ LDA #$00
+1eb9 : e5 1b __ SBC ACCU + 0
+1ebb : 85 1b __ STA ACCU + 0
+1ebd : a9 00 __ LDA #$00
+1ebf : e5 1c __ SBC ACCU + 1
+1ec1 : 85 1c __ STA ACCU + 1
+1ec3 : a9 00 __ LDA #$00
+1ec5 : e5 1d __ SBC ACCU + 2
+1ec7 : 85 1d __ STA ACCU + 2
+1ec9 : a5 1e __ LDA ACCU + 3
+1ecb : 49 80 __ EOR #$80
+1ecd : 85 1e __ STA ACCU + 3
+1ecf : a5 1d __ LDA ACCU + 2
+1ed1 : 30 be __ BMI $1e91
+1ed3 : 05 1c __ ORA ACCU + 1
+1ed5 : 05 1b __ ORA ACCU + 0
+1ed7 : f0 0f __ BEQ $1ee8
+1ed9 : c6 07 __ DEC $07
+1edb : f0 0b __ BEQ $1ee8
+1edd : 06 1b __ ASL ACCU + 0
+1edf : 26 1c __ ROL ACCU + 1
+1ee1 : 26 1d __ ROL ACCU + 2
+1ee3 : 10 f4 __ BPL $1ed9
+1ee5 : 4c 91 1e JMP $1e91 ; (faddsub + 102)
+1ee8 : a9 00 __ LDA #$00
+1eea : 85 1b __ STA ACCU + 0
+1eec : 85 1c __ STA ACCU + 1
+1eee : 85 1d __ STA ACCU + 2
+1ef0 : 85 1e __ STA ACCU + 3
+1ef2 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1ef3 : a5 1b __ LDA ACCU + 0
+1ef5 : 05 1c __ ORA ACCU + 1
+1ef7 : 05 1d __ ORA ACCU + 2
+1ef9 : d0 03 __ BNE $1efe
+1efb : 85 1e __ STA ACCU + 3
+1efd : 60 __ __ RTS
+1efe : a5 03 __ LDA $03
+1f00 : 05 04 __ ORA $04
+1f02 : 05 05 __ ORA $05
+1f04 : d0 09 __ BNE $1f0f
+1f06 : 85 1b __ STA ACCU + 0
+1f08 : 85 1c __ STA ACCU + 1
+1f0a : 85 1d __ STA ACCU + 2
+1f0c : 85 1e __ STA ACCU + 3
+1f0e : 60 __ __ RTS
+1f0f : a9 00 __ LDA #$00
+1f11 : 85 09 __ STA $09
+1f13 : 85 0a __ STA $0a
+1f15 : 85 0b __ STA $0b
+1f17 : a4 1b __ LDY ACCU + 0
+1f19 : a5 03 __ LDA $03
+1f1b : d0 06 __ BNE $1f23
+1f1d : a5 04 __ LDA $04
+1f1f : f0 0a __ BEQ $1f2b
+1f21 : d0 05 __ BNE $1f28
+1f23 : 20 63 1f JSR $1f63 ; (fmul8 + 0)
+1f26 : a5 04 __ LDA $04
+1f28 : 20 63 1f JSR $1f63 ; (fmul8 + 0)
+1f2b : a5 05 __ LDA $05
+1f2d : 20 63 1f JSR $1f63 ; (fmul8 + 0)
+1f30 : 38 __ __ SEC
+1f31 : a5 0b __ LDA $0b
+1f33 : 30 06 __ BMI $1f3b
+1f35 : 06 09 __ ASL $09
+1f37 : 26 0a __ ROL $0a
+1f39 : 2a __ __ ROL
+1f3a : 18 __ __ CLC
+1f3b : 29 7f __ AND #$7f
+1f3d : 85 0b __ STA $0b
+1f3f : a5 1e __ LDA ACCU + 3
+1f41 : 45 06 __ EOR $06
+1f43 : 29 80 __ AND #$80
+1f45 : 85 1e __ STA ACCU + 3
+1f47 : a5 07 __ LDA $07
+1f49 : e9 7e __ SBC #$7e
+1f4b : 18 __ __ CLC
+1f4c : 65 08 __ ADC $08
+1f4e : 4a __ __ LSR
+1f4f : 05 1e __ ORA ACCU + 3
+1f51 : 85 1e __ STA ACCU + 3
+1f53 : a9 00 __ LDA #$00
+1f55 : 6a __ __ ROR
+1f56 : 05 0b __ ORA $0b
+1f58 : 85 1d __ STA ACCU + 2
+1f5a : a5 0a __ LDA $0a
+1f5c : 85 1c __ STA ACCU + 1
+1f5e : a5 09 __ LDA $09
+1f60 : 85 1b __ STA ACCU + 0
+1f62 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1f63 : 38 __ __ SEC
+1f64 : 6a __ __ ROR
+1f65 : 90 1e __ BCC $1f85
+1f67 : aa __ __ TAX
+1f68 : 18 __ __ CLC
+1f69 : 98 __ __ TYA
+1f6a : 65 09 __ ADC $09
+1f6c : 85 09 __ STA $09
+1f6e : a5 0a __ LDA $0a
+1f70 : 65 1c __ ADC ACCU + 1
+1f72 : 85 0a __ STA $0a
+1f74 : a5 0b __ LDA $0b
+1f76 : 65 1d __ ADC ACCU + 2
+1f78 : 6a __ __ ROR
+1f79 : 85 0b __ STA $0b
+1f7b : 8a __ __ TXA
+1f7c : 66 0a __ ROR $0a
+1f7e : 66 09 __ ROR $09
+1f80 : 4a __ __ LSR
+1f81 : f0 0d __ BEQ $1f90
+1f83 : b0 e2 __ BCS $1f67
+1f85 : 66 0b __ ROR $0b
+1f87 : 66 0a __ ROR $0a
+1f89 : 66 09 __ ROR $09
+1f8b : 4a __ __ LSR
+1f8c : 90 f7 __ BCC $1f85
+1f8e : d0 d7 __ BNE $1f67
+1f90 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1f91 : a5 1b __ LDA ACCU + 0
+1f93 : 05 1c __ ORA ACCU + 1
+1f95 : 05 1d __ ORA ACCU + 2
+1f97 : d0 03 __ BNE $1f9c
+1f99 : 85 1e __ STA ACCU + 3
+1f9b : 60 __ __ RTS
+1f9c : a5 1e __ LDA ACCU + 3
+1f9e : 45 06 __ EOR $06
+1fa0 : 29 80 __ AND #$80
+1fa2 : 85 1e __ STA ACCU + 3
+1fa4 : a9 00 __ LDA #$00
+1fa6 : 85 09 __ STA $09
+1fa8 : 85 0a __ STA $0a
+1faa : 85 0b __ STA $0b
+1fac : a2 18 __ LDX #$18
+1fae : a5 1b __ LDA ACCU + 0
+1fb0 : c5 03 __ CMP $03
+1fb2 : a5 1c __ LDA ACCU + 1
+1fb4 : e5 04 __ SBC $04
+1fb6 : a5 1d __ LDA ACCU + 2
+1fb8 : e5 05 __ SBC $05
+1fba : 90 13 __ BCC $1fcf
+1fbc : a5 1b __ LDA ACCU + 0
+1fbe : e5 03 __ SBC $03
+1fc0 : 85 1b __ STA ACCU + 0
+1fc2 : a5 1c __ LDA ACCU + 1
+1fc4 : e5 04 __ SBC $04
+1fc6 : 85 1c __ STA ACCU + 1
+1fc8 : a5 1d __ LDA ACCU + 2
+1fca : e5 05 __ SBC $05
+1fcc : 85 1d __ STA ACCU + 2
+1fce : 38 __ __ SEC
+1fcf : 26 09 __ ROL $09
+1fd1 : 26 0a __ ROL $0a
+1fd3 : 26 0b __ ROL $0b
+1fd5 : ca __ __ DEX
+1fd6 : f0 0a __ BEQ $1fe2
+1fd8 : 06 1b __ ASL ACCU + 0
+1fda : 26 1c __ ROL ACCU + 1
+1fdc : 26 1d __ ROL ACCU + 2
+1fde : b0 dc __ BCS $1fbc
+1fe0 : 90 cc __ BCC $1fae
+1fe2 : 38 __ __ SEC
+1fe3 : a5 0b __ LDA $0b
+1fe5 : 30 06 __ BMI $1fed
+1fe7 : 06 09 __ ASL $09
+1fe9 : 26 0a __ ROL $0a
+1feb : 2a __ __ ROL
+1fec : 18 __ __ CLC
+1fed : 29 7f __ AND #$7f
+1fef : 85 0b __ STA $0b
+1ff1 : a5 08 __ LDA $08
+1ff3 : 49 7f __ EOR #$7f
+1ff5 : 65 07 __ ADC $07
+1ff7 : 38 __ __ SEC
+1ff8 : e9 01 __ SBC #$01
+1ffa : 4a __ __ LSR
+1ffb : 05 1e __ ORA ACCU + 3
+1ffd : 85 1e __ STA ACCU + 3
+1fff : a9 00 __ LDA #$00
+2001 : 6a __ __ ROR
+2002 : 05 0b __ ORA $0b
+2004 : 85 1d __ STA ACCU + 2
+2006 : a5 0a __ LDA $0a
+2008 : 85 1c __ STA ACCU + 1
+200a : a5 09 __ LDA $09
+200c : 85 1b __ STA ACCU + 0
+200e : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+200f : 24 1c __ BIT ACCU + 1
+2011 : 10 0d __ BPL $2020
+2013 : 20 2d 20 JSR $202d ; (negaccu + 0)
+2016 : 24 04 __ BIT $04
+2018 : 10 0d __ BPL $2027
+201a : 20 3b 20 JSR $203b ; (negtmp + 0)
+201d : 4c 49 20 JMP $2049 ; (divmod + 0)
+2020 : 24 04 __ BIT $04
+2022 : 10 f9 __ BPL $201d
+2024 : 20 3b 20 JSR $203b ; (negtmp + 0)
+2027 : 20 49 20 JSR $2049 ; (divmod + 0)
+202a : 4c 2d 20 JMP $202d ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+202d : 38 __ __ SEC
+202e : a9 00 __ LDA #$00
+2030 : e5 1b __ SBC ACCU + 0
+2032 : 85 1b __ STA ACCU + 0
+2034 : a9 00 __ LDA #$00
+2036 : e5 1c __ SBC ACCU + 1
+2038 : 85 1c __ STA ACCU + 1
+203a : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+203b : 38 __ __ SEC
+203c : a9 00 __ LDA #$00
+203e : e5 03 __ SBC $03
+2040 : 85 03 __ STA $03
+2042 : a9 00 __ LDA #$00
+2044 : e5 04 __ SBC $04
+2046 : 85 04 __ STA $04
+2048 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+2049 : a5 1c __ LDA ACCU + 1
+204b : d0 31 __ BNE $207e
+204d : a5 04 __ LDA $04
+204f : d0 1e __ BNE $206f
+2051 : 85 06 __ STA $06
+2053 : a2 04 __ LDX #$04
+2055 : 06 1b __ ASL ACCU + 0
+2057 : 2a __ __ ROL
+2058 : c5 03 __ CMP $03
+205a : 90 02 __ BCC $205e
+205c : e5 03 __ SBC $03
+205e : 26 1b __ ROL ACCU + 0
+2060 : 2a __ __ ROL
+2061 : c5 03 __ CMP $03
+2063 : 90 02 __ BCC $2067
+2065 : e5 03 __ SBC $03
+2067 : 26 1b __ ROL ACCU + 0
+2069 : ca __ __ DEX
+206a : d0 eb __ BNE $2057
+206c : 85 05 __ STA $05
+206e : 60 __ __ RTS
+206f : a5 1b __ LDA ACCU + 0
+2071 : 85 05 __ STA $05
+2073 : a5 1c __ LDA ACCU + 1
+2075 : 85 06 __ STA $06
+2077 : a9 00 __ LDA #$00
+2079 : 85 1b __ STA ACCU + 0
+207b : 85 1c __ STA ACCU + 1
+207d : 60 __ __ RTS
+207e : a5 04 __ LDA $04
+2080 : d0 1f __ BNE $20a1
+2082 : a5 03 __ LDA $03
+2084 : 30 1b __ BMI $20a1
+2086 : a9 00 __ LDA #$00
+2088 : 85 06 __ STA $06
+208a : a2 10 __ LDX #$10
+208c : 06 1b __ ASL ACCU + 0
+208e : 26 1c __ ROL ACCU + 1
+2090 : 2a __ __ ROL
+2091 : c5 03 __ CMP $03
+2093 : 90 02 __ BCC $2097
+2095 : e5 03 __ SBC $03
+2097 : 26 1b __ ROL ACCU + 0
+2099 : 26 1c __ ROL ACCU + 1
+209b : ca __ __ DEX
+209c : d0 f2 __ BNE $2090
+209e : 85 05 __ STA $05
+20a0 : 60 __ __ RTS
+20a1 : a9 00 __ LDA #$00
+20a3 : 85 05 __ STA $05
+20a5 : 85 06 __ STA $06
+20a7 : 84 02 __ STY $02
+20a9 : a0 10 __ LDY #$10
+20ab : 18 __ __ CLC
+20ac : 26 1b __ ROL ACCU + 0
+20ae : 26 1c __ ROL ACCU + 1
+20b0 : 26 05 __ ROL $05
+20b2 : 26 06 __ ROL $06
+20b4 : 38 __ __ SEC
+20b5 : a5 05 __ LDA $05
+20b7 : e5 03 __ SBC $03
+20b9 : aa __ __ TAX
+20ba : a5 06 __ LDA $06
+20bc : e5 04 __ SBC $04
+20be : 90 04 __ BCC $20c4
+20c0 : 86 05 __ STX $05
+20c2 : 85 06 __ STA $06
+20c4 : 88 __ __ DEY
+20c5 : d0 e5 __ BNE $20ac
+20c7 : 26 1b __ ROL ACCU + 0
+20c9 : 26 1c __ ROL ACCU + 1
+20cb : a4 02 __ LDY $02
+20cd : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+20ce : 24 1c __ BIT ACCU + 1
+20d0 : 10 0d __ BPL $20df
+20d2 : 20 2d 20 JSR $202d ; (negaccu + 0)
+20d5 : 24 04 __ BIT $04
+20d7 : 10 0d __ BPL $20e6
+20d9 : 20 3b 20 JSR $203b ; (negtmp + 0)
+20dc : 4c 49 20 JMP $2049 ; (divmod + 0)
+20df : 24 04 __ BIT $04
+20e1 : 10 f9 __ BPL $20dc
+20e3 : 20 3b 20 JSR $203b ; (negtmp + 0)
+20e6 : 20 49 20 JSR $2049 ; (divmod + 0)
+20e9 : 38 __ __ SEC
+20ea : a9 00 __ LDA #$00
+20ec : e5 05 __ SBC $05
+20ee : 85 05 __ STA $05
+20f0 : a9 00 __ LDA #$00
+20f2 : e5 06 __ SBC $06
+20f4 : 85 06 __ STA $06
+20f6 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+20f7 : 20 0a 1e JSR $1e0a ; (freg + 36)
+20fa : a5 07 __ LDA $07
+20fc : c9 7f __ CMP #$7f
+20fe : b0 07 __ BCS $2107
+2100 : a9 00 __ LDA #$00
+2102 : 85 1b __ STA ACCU + 0
+2104 : 85 1c __ STA ACCU + 1
+2106 : 60 __ __ RTS
+2107 : 38 __ __ SEC
+2108 : e9 8e __ SBC #$8e
+210a : 90 0a __ BCC $2116
+210c : a9 ff __ LDA #$ff
+210e : 85 1b __ STA ACCU + 0
+2110 : a9 7f __ LDA #$7f
+2112 : 85 1c __ STA ACCU + 1
+2114 : d0 08 __ BNE $211e
+2116 : aa __ __ TAX
+2117 : 46 1d __ LSR ACCU + 2
+2119 : 66 1c __ ROR ACCU + 1
+211b : e8 __ __ INX
+211c : d0 f9 __ BNE $2117
+211e : 24 1e __ BIT ACCU + 3
+2120 : 10 0e __ BPL $2130
+2122 : 38 __ __ SEC
+2123 : a9 00 __ LDA #$00
+2125 : e5 1c __ SBC ACCU + 1
+2127 : 85 1b __ STA ACCU + 0
+2129 : a9 00 __ LDA #$00
+212b : e5 1d __ SBC ACCU + 2
+212d : 85 1c __ STA ACCU + 1
+212f : 60 __ __ RTS
+2130 : a5 1c __ LDA ACCU + 1
+2132 : 85 1b __ STA ACCU + 0
+2134 : a5 1d __ LDA ACCU + 2
+2136 : 85 1c __ STA ACCU + 1
+2138 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+2139 : 24 1c __ BIT ACCU + 1
+213b : 30 03 __ BMI $2140
+213d : 4c 57 21 JMP $2157 ; (uint16_to_float + 0)
+2140 : 38 __ __ SEC
+2141 : a9 00 __ LDA #$00
+2143 : e5 1b __ SBC ACCU + 0
+2145 : 85 1b __ STA ACCU + 0
+2147 : a9 00 __ LDA #$00
+2149 : e5 1c __ SBC ACCU + 1
+214b : 85 1c __ STA ACCU + 1
+214d : 20 57 21 JSR $2157 ; (uint16_to_float + 0)
+2150 : a5 1e __ LDA ACCU + 3
+2152 : 09 80 __ ORA #$80
+2154 : 85 1e __ STA ACCU + 3
+2156 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+2157 : a5 1b __ LDA ACCU + 0
+2159 : 05 1c __ ORA ACCU + 1
+215b : d0 05 __ BNE $2162
+215d : 85 1d __ STA ACCU + 2
+215f : 85 1e __ STA ACCU + 3
+2161 : 60 __ __ RTS
+2162 : a2 8e __ LDX #$8e
+2164 : a5 1c __ LDA ACCU + 1
+2166 : 30 06 __ BMI $216e
+2168 : ca __ __ DEX
+2169 : 06 1b __ ASL ACCU + 0
+216b : 2a __ __ ROL
+216c : 10 fa __ BPL $2168
+216e : 29 7f __ AND #$7f
+2170 : 85 1d __ STA ACCU + 2
+2172 : a5 1b __ LDA ACCU + 0
+2174 : 85 1c __ STA ACCU + 1
+2176 : 8a __ __ TXA
+2177 : 4a __ __ LSR
+2178 : 85 1e __ STA ACCU + 3
+217a : a9 00 __ LDA #$00
+217c : 85 1b __ STA ACCU + 0
+217e : 6a __ __ ROR
+217f : 05 1d __ ORA ACCU + 2
+2181 : 85 1d __ STA ACCU + 2
+2183 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2184 : a5 1e __ LDA ACCU + 3
+2186 : 45 06 __ EOR $06
+2188 : 29 80 __ AND #$80
+218a : f0 1e __ BEQ $21aa
+218c : a5 1e __ LDA ACCU + 3
+218e : 29 7f __ AND #$7f
+2190 : 05 1d __ ORA ACCU + 2
+2192 : 05 1c __ ORA ACCU + 1
+2194 : 05 1b __ ORA ACCU + 0
+2196 : d0 0c __ BNE $21a4
+2198 : a5 06 __ LDA $06
+219a : 29 7f __ AND #$7f
+219c : 05 05 __ ORA $05
+219e : 05 04 __ ORA $04
+21a0 : 05 03 __ ORA $03
+21a2 : f0 1e __ BEQ $21c2
+21a4 : a5 1e __ LDA ACCU + 3
+21a6 : 30 23 __ BMI $21cb
+21a8 : 10 28 __ BPL $21d2
+21aa : a5 1e __ LDA ACCU + 3
+21ac : c5 06 __ CMP $06
+21ae : d0 15 __ BNE $21c5
+21b0 : a5 1d __ LDA ACCU + 2
+21b2 : c5 05 __ CMP $05
+21b4 : d0 0f __ BNE $21c5
+21b6 : a5 1c __ LDA ACCU + 1
+21b8 : c5 04 __ CMP $04
+21ba : d0 09 __ BNE $21c5
+21bc : a5 1b __ LDA ACCU + 0
+21be : c5 03 __ CMP $03
+21c0 : d0 03 __ BNE $21c5
+21c2 : a9 00 __ LDA #$00
+21c4 : 60 __ __ RTS
+21c5 : b0 07 __ BCS $21ce
+21c7 : 24 1e __ BIT ACCU + 3
+21c9 : 30 07 __ BMI $21d2
+21cb : a9 01 __ LDA #$01
+21cd : 60 __ __ RTS
+21ce : 24 1e __ BIT ACCU + 3
+21d0 : 30 f9 __ BMI $21cb
+21d2 : a9 ff __ LDA #$ff
+21d4 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+21d5 : 84 02 __ STY $02
+21d7 : a9 00 __ LDA #$00
+21d9 : 85 07 __ STA $07
+21db : 85 08 __ STA $08
+21dd : 85 09 __ STA $09
+21df : 85 0a __ STA $0a
+21e1 : a0 20 __ LDY #$20
+21e3 : 18 __ __ CLC
+21e4 : 26 1b __ ROL ACCU + 0
+21e6 : 26 1c __ ROL ACCU + 1
+21e8 : 26 1d __ ROL ACCU + 2
+21ea : 26 1e __ ROL ACCU + 3
+21ec : 26 07 __ ROL $07
+21ee : 26 08 __ ROL $08
+21f0 : 26 09 __ ROL $09
+21f2 : 26 0a __ ROL $0a
+21f4 : a5 07 __ LDA $07
+21f6 : c5 03 __ CMP $03
+21f8 : a5 08 __ LDA $08
+21fa : e5 04 __ SBC $04
+21fc : a5 09 __ LDA $09
+21fe : e5 05 __ SBC $05
+2200 : a5 0a __ LDA $0a
+2202 : e5 06 __ SBC $06
+2204 : 90 18 __ BCC $221e
+2206 : a5 07 __ LDA $07
+2208 : e5 03 __ SBC $03
+220a : 85 07 __ STA $07
+220c : a5 08 __ LDA $08
+220e : e5 04 __ SBC $04
+2210 : 85 08 __ STA $08
+2212 : a5 09 __ LDA $09
+2214 : e5 05 __ SBC $05
+2216 : 85 09 __ STA $09
+2218 : a5 0a __ LDA $0a
+221a : e5 06 __ SBC $06
+221c : 85 0a __ STA $0a
+221e : 88 __ __ DEY
+221f : d0 c3 __ BNE $21e4
+2221 : 26 1b __ ROL ACCU + 0
+2223 : 26 1c __ ROL ACCU + 1
+2225 : 26 1d __ ROL ACCU + 2
+2227 : 26 1e __ ROL ACCU + 3
+2229 : a4 02 __ LDY $02
+222b : 60 __ __ RTS
@@ -0,0 +1,3166 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 2a 23 STX $232a ; (spentry + 0)
+0811 : a9 2c __ LDA #$2c
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 90 __ LDA #$90
+0832 : e9 2c __ SBC #$2c
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 10
+0a04:	PUSH	#$0012
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	LEA	T2, buffer + 0
+0a11:	MOV	2(SP), T2
+0a14:	LEA	T3, $16a6
+0a18:	MOV	4(SP), T3
+0a1b:	MOV	ACCU, #$014b
+0a1f:	MUL	ACCU, T1
+0a21:	ADD	ACCU, #$C180
+0a25:	MOV	6(SP), ACCU
+0a28:	MOV	ACCU, #$0269
+0a2c:	MUL	ACCU, T1
+0a2e:	MOV	8(SP), ACCU
+0a31:	MOV	ACCU, T1
+0a33:	MUL	ACCU, #97
+0a36:	MOV	10(SP), ACCU
+0a39:	MOV	12(SP), T1
+0a3c:	MOV	ACCU, T1
+0a3e:	NEG	ACCU
+0a3f:	MOV	14(SP), ACCU
+0a42:	LEA	T3, $16bb
+0a46:	MOV	16(SP), T3
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	ACCU, T2
+0a4e:	MOV	P0, ACCU
+0a50:	JSR	strlen + 0
+0a53:	ADD	T0, ACCU
+0a55:	MOVUB	ACCU, buffer + 0
+0a59:	BNEF	$0AEB
+0a5c:	ADD	T1, #$0001
+0a60:	MOV	ACCU, T1
+0a62:	CMPS	ACCU, #$0064
+0a65:	BGT	$0A0D
+0a67:	MOV	T1, #0
+0a6a:	LEA	T2, $16f1
+0a6e:	LEA	T3, buffer + 0
+0a72:	MOV	2(SP), T3
+0a75:	MOV	4(SP), T2
+0a78:	MOV	ACCU, T1
+0a7a:	CNVSF	ACCU
+0a7b:	MOVD	T6, ACCU
+0a7d:	MOVD	$03, #$3fa00000
+0a83:	MULF	ACCU, $03
+0a85:	MOVD	6(SP), ACCU
+0a88:	MOVD	ACCU, T6
+0a8a:	MOVD	$03, #$bd800000
+0a90:	MULF	ACCU, $03
+0a92:	MOVD	10(SP), ACCU
+0a95:	CALL	sprintf + 0
+0a98:	MOV	ACCU, T3
+0a9a:	MOV	P0, ACCU
+0a9c:	JSR	strlen + 0
+0a9f:	ADD	T1, #$0001
+0aa3:	ADD	T0, ACCU
+0aa5:	MOV	ACCU, T1
+0aa7:	CMPS	ACCU, #$0014
+0aaa:	BGT	$0A72
+0aac:	MOV	2(SP), T3
+0aaf:	LEA	T1, $16fa
+0ab3:	MOV	4(SP), T1
+0ab6:	MOV	ACCU, #-123
+0ab9:	MOV	6(SP), ACCU
+0abc:	LEA	T1, $1703
+0ac0:	MOV	8(SP), T1
+0ac3:	MOV	ACCU, #$beef
+0ac7:	MOV	10(SP), ACCU
+0aca:	CALL	sprintf + 0
+0acd:	MOV	ACCU, T3
+0acf:	MOV	P0, ACCU
+0ad1:	LEA	P2, $1737
+0ad5:	JSR	strcmp + 0
+0ad8:	BNE	$0AE1
+0ada:	MOV	ACCU, T0
+0adc:	SEQ
+0add:	MOVB	T4, ACCU
+0adf:	JUMP	$0AE4
+0ae1:	MOV	ACCU, #1
+0ae4:	POP	#$0012
+0ae7:	RETURN	8, 10
+0aeb:	MOV	T2, #0
+0aee:	LEAX	ADDR, buffer + 0 + T2
+0af2:	MOVB	T4, 0(ADDR)
+0af5:	LEAX	ADDR, buffer + 1 + T2
+0af9:	MOVB	ACCU, T4
+0afb:	ADD	T0, ACCU
+0afd:	MOVUB	ACCU, 0(ADDR)
+0b00:	ADD	T2, #$0001
+0b04:	BNE	$0AEE
+0b06:	JUMPF	$0A5C
+--------------------------------------------------------------------
+sprintf:
+0b09:	ENTER	9, 19
+0b0d:	PUSH	#$0002
+0b10:	MOVB	T0, #0
+0b13:	MOVB	T1, #0
+0b16:	MOV	T2, 12(FP)
+0b19:	MOV	ADDR, T2
+0b1b:	MOVB	T3, 0(ADDR)
+0b1e:	MOV	T4, 10(FP)
+0b21:	MOVB	ACCU, T3
+0b23:	BNE	$0B5A
+0b25:	MOVB	ACCU, T1
+0b27:	ADD	ACCU, T4
+0b29:	MOV	T2, ACCU
+0b2b:	MOV	ACCU, #0
+0b2e:	MOV	ADDR, T2
+0b30:	MOVB	0(ADDR), ACCU
+0b33:	MOVB	ACCU, T1
+0b35:	BNE	$0B49
+0b37:	MOV	ACCU, T4
+0b39:	MOV	T2, ACCU
+0b3b:	MOV	T4, 10(FP)
+0b3e:	MOV	ACCU, T2
+0b40:	SUB	ACCU, T4
+0b42:	POP	#$0002
+0b45:	RETURN	9, 19
+0b49:	MOVB	ACCU, T0
+0b4b:	BEQ	$0B3B
+0b4d:	MOV	ACCU, T4
+0b4f:	MOV	P0, ACCU
+0b51:	CALL	puts + 0
+0b54:	MOV	ACCU, T4
+0b56:	MOV	T2, ACCU
+0b58:	JUMP	$0B3B
+0b5a:	LEA	T5, 14(FP)
+0b5e:	ADD	T2, #$0001
+0b62:	MOVB	ACCU, T3
+0b64:	CMPUB	ACCU, #$0025
+0b66:	BEQ	$0BC4
+0b68:	MOVB	ACCU, T1
+0b6a:	LEAX	ADDR, T4 + ACCU
+0b6c:	MOVB	0(ADDR), T3
+0b6f:	ADDB	T1, #$0001
+0b72:	MOVB	ACCU, T1
+0b74:	CMPUB	ACCU, #$0028
+0b76:	BLE	$0B89
+0b78:	MOV	ADDR, T2
+0b7a:	MOVB	T6, 0(ADDR)
+0b7d:	ADD	T2, #$0001
+0b81:	MOVB	ACCU, T6
+0b83:	MOVB	T3, ACCU
+0b85:	BNE	$0B62
+0b87:	JUMP	$0B25
+0b89:	MOVB	ACCU, T1
+0b8b:	MOV	T7, ACCU
+0b8d:	MOVB	ACCU, T0
+0b8f:	BNE	$0BA3
+0b91:	MOV	ACCU, T7
+0b93:	ADD	T4, ACCU
+0b95:	MOVB	T1, #0
+0b98:	MOV	ADDR, T2
+0b9a:	MOVB	T6, 0(ADDR)
+0b9d:	ADD	T2, #$0001
+0ba1:	JUMP	$0B81
+0ba3:	MOV	ACCU, T4
+0ba5:	ADD	T7, ACCU
+0ba7:	MOV	ADDR, T7
+0ba9:	MOV	ACCU, #0
+0bac:	MOVB	0(ADDR), ACCU
+0baf:	MOV	ACCU, T4
+0bb1:	MOV	P0, ACCU
+0bb3:	CALL	puts + 0
+0bb6:	MOVB	T1, #0
+0bb9:	MOV	ADDR, T2
+0bbb:	MOVB	T6, 0(ADDR)
+0bbe:	ADD	T2, #$0001
+0bc2:	JUMP	$0B81
+0bc4:	MOVB	ACCU, T1
+0bc6:	BNEF	$1189
+0bc9:	MOV	ADDR, T2
+0bcb:	MOVB	T3, 0(ADDR)
+0bce:	MOV	ACCU, #10
+0bd1:	MOV	3(FP), ACCU
+0bd4:	MOV	ACCU, #1
+0bd7:	MOVB	1(FP), ACCU
+0bda:	MOV	ACCU, #255
+0bdd:	MOVB	2(FP), ACCU
+0be0:	MOV	ACCU, #32
+0be3:	MOVB	0(FP), ACCU
+0be6:	MOV	ACCU, #0
+0be9:	MOVB	5(FP), ACCU
+0bec:	MOVB	6(FP), ACCU
+0bef:	MOVB	7(FP), ACCU
+0bf2:	ADD	T2, #$0001
+0bf6:	MOVB	ACCU, T3
+0bf8:	CMPUB	ACCU, #$002B
+0bfa:	BEQF	$117B
+0bfd:	MOVB	ACCU, T3
+0bff:	CMPUB	ACCU, #$0030
+0c01:	BEQF	$116D
+0c04:	MOVB	ACCU, T3
+0c06:	CMPUB	ACCU, #$0023
+0c08:	BEQF	$115F
+0c0b:	MOVB	ACCU, T3
+0c0d:	CMPUB	ACCU, #$0030
+0c0f:	BGT	$0C18
+0c11:	MOVB	ACCU, T3
+0c13:	CMPUB	ACCU, #$0039
+0c15:	BGEF	$112E
+0c18:	MOVB	ACCU, T3
+0c1a:	CMPUB	ACCU, #$002E
+0c1c:	BEQF	$10F4
+0c1f:	MOVB	ACCU, T3
+0c21:	CMPUB	ACCU, #$0064
+0c23:	BEQF	$0FCC
+0c26:	MOVB	ACCU, T3
+0c28:	CMPUB	ACCU, #$0075
+0c2a:	BEQF	$0EB9
+0c2d:	MOVB	ACCU, T3
+0c2f:	CMPUB	ACCU, #$0078
+0c31:	BEQF	$0D94
+0c34:	MOVB	ACCU, T3
+0c36:	CMPUB	ACCU, #$006C
+0c38:	BEQF	$0D09
+0c3b:	MOVB	ACCU, T3
+0c3d:	CMPUB	ACCU, #$0066
+0c3f:	BEQF	$0CDF
+0c42:	MOVB	ACCU, T3
+0c44:	CMPUB	ACCU, #$0067
+0c46:	BEQF	$0CDF
+0c49:	MOVB	ACCU, T3
+0c4b:	CMPUB	ACCU, #$0065
+0c4d:	BEQF	$0CDF
+0c50:	MOVB	ACCU, T3
+0c52:	CMPUB	ACCU, #$0073
+0c54:	BEQ	$0C96
+0c56:	MOVB	ACCU, T3
+0c58:	CMPUB	ACCU, #$0063
+0c5a:	BEQ	$0C77
+0c5c:	MOVB	ACCU, T3
+0c5e:	BEQF	$0B78
+0c61:	MOVB	ACCU, T1
+0c63:	LEAX	ADDR, T4 + ACCU
+0c65:	MOVB	0(ADDR), T3
+0c68:	ADDB	T1, #$0001
+0c6b:	MOV	ADDR, T2
+0c6d:	MOVB	T6, 0(ADDR)
+0c70:	ADD	T2, #$0001
+0c74:	JUMPF	$0B81
+0c77:	MOVB	ACCU, T1
+0c79:	MOV	ADDR, T5
+0c7b:	MOV	T8, 0(ADDR)
+0c7e:	LEAX	ADDR, T4 + ACCU
+0c80:	MOVB	0(ADDR), T8
+0c83:	ADD	T5, #$0002
+0c87:	ADDB	T1, #$0001
+0c8a:	MOV	ADDR, T2
+0c8c:	MOVB	T6, 0(ADDR)
+0c8f:	ADD	T2, #$0001
+0c93:	JUMPF	$0B81
+0c96:	MOV	ADDR, T5
+0c98:	MOV	T7, 0(ADDR)
+0c9b:	ADD	T5, #$0002
+0c9f:	MOVB	ACCU, T0
+0ca1:	BNE	$0CCC
+0ca3:	MOV	ADDR, T7
+0ca5:	MOVB	T3, 0(ADDR)
+0ca8:	MOVB	ACCU, T3
+0caa:	BEQF	$0B78
+0cad:	ADD	T7, #$0001
+0cb1:	MOV	ADDR, T4
+0cb3:	MOVB	0(ADDR), T3
+0cb6:	ADD	T4, #$0001
+0cba:	MOV	ADDR, T7
+0cbc:	MOVB	T6, 0(ADDR)
+0cbf:	ADD	T7, #$0001
+0cc3:	MOVB	ACCU, T6
+0cc5:	MOVB	T3, ACCU
+0cc7:	BNE	$0CB1
+0cc9:	JUMPF	$0B78
+0ccc:	MOV	ACCU, T7
+0cce:	MOV	P0, ACCU
+0cd0:	CALL	puts + 0
+0cd3:	MOV	ADDR, T2
+0cd5:	MOVB	T6, 0(ADDR)
+0cd8:	ADD	T2, #$0001
+0cdc:	JUMPF	$0B81
+0cdf:	LEA	P0, 0(FP)
+0ce3:	MOV	ACCU, T4
+0ce5:	MOV	P2, ACCU
+0ce7:	MOV	ADDR, T5
+0ce9:	MOVD	T12, 0(ADDR)
+0cec:	MOVD	ACCU, T12
+0cee:	MOVD	P4, ACCU
+0cf0:	MOVB	ACCU, T3
+0cf2:	MOVB	P8, ACCU
+0cf4:	CALL	nformf + 0
+0cf7:	MOV	T1, ACCU
+0cf9:	ADD	T5, #$0004
+0cfd:	MOV	ADDR, T2
+0cff:	MOVB	T6, 0(ADDR)
+0d02:	ADD	T2, #$0001
+0d06:	JUMPF	$0B81
+0d09:	MOV	ADDR, T5
+0d0b:	MOVD	T12, 0(ADDR)
+0d0e:	ADD	T5, #$0004
+0d12:	MOV	ADDR, T2
+0d14:	MOVB	T3, 0(ADDR)
+0d17:	ADD	T2, #$0001
+0d1b:	MOVB	ACCU, T3
+0d1d:	CMPUB	ACCU, #$0064
+0d1f:	BEQ	$0D74
+0d21:	MOVB	ACCU, T3
+0d23:	CMPUB	ACCU, #$0075
+0d25:	BEQ	$0D54
+0d27:	MOVB	ACCU, T3
+0d29:	CMPUB	ACCU, #$0078
+0d2b:	BNEF	$0B78
+0d2e:	MOV	ACCU, #16
+0d31:	MOV	3(FP), ACCU
+0d34:	LEA	P0, 0(FP)
+0d38:	MOV	ACCU, T4
+0d3a:	MOV	P2, ACCU
+0d3c:	MOVD	ACCU, T12
+0d3e:	MOVD	P4, ACCU
+0d40:	MOVB	P8, #0
+0d43:	CALL	nforml + 0
+0d46:	MOV	T1, ACCU
+0d48:	MOV	ADDR, T2
+0d4a:	MOVB	T6, 0(ADDR)
+0d4d:	ADD	T2, #$0001
+0d51:	JUMPF	$0B81
+0d54:	LEA	P0, 0(FP)
+0d58:	MOV	ACCU, T4
+0d5a:	MOV	P2, ACCU
+0d5c:	MOVD	ACCU, T12
+0d5e:	MOVD	P4, ACCU
+0d60:	MOVB	P8, #0
+0d63:	CALL	nforml + 0
+0d66:	MOV	T1, ACCU
+0d68:	MOV	ADDR, T2
+0d6a:	MOVB	T6, 0(ADDR)
+0d6d:	ADD	T2, #$0001
+0d71:	JUMPF	$0B81
+0d74:	LEA	P0, 0(FP)
+0d78:	MOV	ACCU, T4
+0d7a:	MOV	P2, ACCU
+0d7c:	MOVD	ACCU, T12
+0d7e:	MOVD	P4, ACCU
+0d80:	MOVB	P8, #1
+0d83:	CALL	nforml + 0
+0d86:	MOV	T1, ACCU
+0d88:	MOV	ADDR, T2
+0d8a:	MOVB	T6, 0(ADDR)
+0d8d:	ADD	T2, #$0001
+0d91:	JUMPF	$0B81
+0d94:	MOV	ACCU, #16
+0d97:	MOV	3(FP), ACCU
+0d9a:	MOV	ACCU, T4
+0d9c:	MOV	T7, ACCU
+0d9e:	MOV	ADDR, T5
+0da0:	MOV	T8, 0(ADDR)
+0da3:	ADD	T5, #$0002
+0da7:	MOVB	T1, #0
+0daa:	MOVB	T3, #10
+0dad:	MOV	ACCU, T8
+0daf:	BNEF	$0E89
+0db2:	MOVB	T6, 2(FP)
+0db5:	MOVB	ACCU, T6
+0db7:	CMPUB	ACCU, #$00FF
+0db9:	BNEF	$0E79
+0dbc:	MOVB	T6, #9
+0dbf:	MOVB	ACCU, T3
+0dc1:	CMPUB	ACCU, #$0009
+0dc3:	BGE	$0DD8
+0dc5:	ADDB	T3, #$00FF
+0dc8:	MOVB	ACCU, T3
+0dca:	LEAX	ADDR, T7 + ACCU
+0dcc:	MOV	ACCU, #48
+0dcf:	MOVB	0(ADDR), ACCU
+0dd2:	MOVB	ACCU, T6
+0dd4:	CMPUB	ACCU, T3
+0dd6:	BGT	$0DC5
+0dd8:	MOVUB	ACCU, 7(FP)
+0ddb:	BEQ	$0E01
+0ddd:	MOV	ACCU, 3(FP)
+0de0:	CMPU	ACCU, #$0010
+0de3:	BNE	$0E01
+0de5:	MOVB	ACCU, T3
+0de7:	ADDB	ACCU, #$00FF
+0dea:	MOVB	ACCU, ACCU
+0dec:	LEAX	ADDR, T7 + ACCU
+0dee:	MOV	ACCU, #88
+0df1:	MOVB	0(ADDR), ACCU
+0df4:	ADDB	T3, #$00FE
+0df7:	MOVB	ACCU, T3
+0df9:	LEAX	ADDR, T7 + ACCU
+0dfb:	MOV	ACCU, #48
+0dfe:	MOVB	0(ADDR), ACCU
+0e01:	MOVB	ACCU, T1
+0e03:	BNE	$0E6A
+0e05:	MOVUB	ACCU, 5(FP)
+0e08:	BEQ	$0E17
+0e0a:	ADDB	T3, #$00FF
+0e0d:	MOVB	ACCU, T3
+0e0f:	LEAX	ADDR, T7 + ACCU
+0e11:	MOV	ACCU, #43
+0e14:	MOVB	0(ADDR), ACCU
+0e17:	MOVUB	T8, 1(FP)
+0e1a:	SUBR	T8, #$000A
+0e1e:	MOVB	ACCU, T3
+0e20:	MOV	T9, ACCU
+0e22:	MOV	ACCU, T8
+0e24:	CMPS	ACCU, T9
+0e26:	BGT	$0E5B
+0e28:	MOVB	T1, #0
+0e2b:	MOVB	ACCU, T3
+0e2d:	CMPUB	ACCU, #$000A
+0e2f:	BLE	$0E4B
+0e31:	MOVB	ACCU, T3
+0e33:	LEAX	ADDR, T7 + ACCU
+0e35:	MOVB	T6, 0(ADDR)
+0e38:	MOVB	ACCU, T1
+0e3a:	LEAX	ADDR, T7 + ACCU
+0e3c:	MOVB	0(ADDR), T6
+0e3f:	ADDB	T1, #$0001
+0e42:	ADDB	T3, #$0001
+0e45:	MOVB	ACCU, T3
+0e47:	CMPUB	ACCU, #$000A
+0e49:	BGT	$0E31
+0e4b:	MOV	ADDR, T2
+0e4d:	MOVB	T6, 0(ADDR)
+0e50:	ADD	T2, #$0001
+0e54:	AND	T1, #$00FF
+0e58:	JUMPF	$0B81
+0e5b:	ADDB	T3, #$00FF
+0e5e:	MOVB	ACCU, T3
+0e60:	LEAX	ADDR, T7 + ACCU
+0e62:	MOVB	T1, 0(FP)
+0e65:	MOVB	0(ADDR), T1
+0e68:	JUMP	$0E17
+0e6a:	ADDB	T3, #$00FF
+0e6d:	MOVB	ACCU, T3
+0e6f:	LEAX	ADDR, T7 + ACCU
+0e71:	MOV	ACCU, #45
+0e74:	MOVB	0(ADDR), ACCU
+0e77:	JUMP	$0E17
+0e79:	MOVB	ACCU, T6
+0e7b:	SUBR	ACCU, #$000A
+0e7f:	MOV	T6, ACCU
+0e81:	CMPUB	ACCU, T3
+0e83:	BGTF	$0DC5
+0e86:	JUMPF	$0DD8
+0e89:	MOV	T9, 3(FP)
+0e8c:	MOV	ACCU, T8
+0e8e:	MODU	ACCU, T9
+0e90:	MOV	T9, ACCU
+0e92:	CMPS	ACCU, #$000A
+0e95:	BLE	$0E9D
+0e97:	ADD	T9, #$0030
+0e9b:	JUMP	$0EA1
+0e9d:	ADD	T9, #$0037
+0ea1:	ADDB	T3, #$00FF
+0ea4:	MOVB	ACCU, T3
+0ea6:	LEAX	ADDR, T7 + ACCU
+0ea8:	MOVB	0(ADDR), T9
+0eab:	MOV	T9, 3(FP)
+0eae:	MOV	ACCU, T8
+0eb0:	DIVU	ACCU, T9
+0eb2:	MOV	T8, ACCU
+0eb4:	BNE	$0E89
+0eb6:	JUMPF	$0DB2
+0eb9:	MOV	ACCU, T4
+0ebb:	MOV	T7, ACCU
+0ebd:	MOV	ADDR, T5
+0ebf:	MOV	T8, 0(ADDR)
+0ec2:	ADD	T5, #$0002
+0ec6:	MOVB	T1, #0
+0ec9:	MOVB	T3, #10
+0ecc:	MOV	ACCU, T8
+0ece:	BNEF	$0F9C
+0ed1:	MOVB	T6, 2(FP)
+0ed4:	MOVB	ACCU, T6
+0ed6:	CMPUB	ACCU, #$00FF
+0ed8:	BNEF	$0F8C
+0edb:	MOVB	T6, #9
+0ede:	MOVB	ACCU, T3
+0ee0:	CMPUB	ACCU, #$0009
+0ee2:	BGE	$0EF7
+0ee4:	ADDB	T3, #$00FF
+0ee7:	MOVB	ACCU, T3
+0ee9:	LEAX	ADDR, T7 + ACCU
+0eeb:	MOV	ACCU, #48
+0eee:	MOVB	0(ADDR), ACCU
+0ef1:	MOVB	ACCU, T6
+0ef3:	CMPUB	ACCU, T3
+0ef5:	BGT	$0EE4
+0ef7:	MOVUB	ACCU, 7(FP)
+0efa:	BEQ	$0F20
+0efc:	MOV	ACCU, 3(FP)
+0eff:	CMPU	ACCU, #$0010
+0f02:	BNE	$0F20
+0f04:	MOVB	ACCU, T3
+0f06:	ADDB	ACCU, #$00FF
+0f09:	MOVB	ACCU, ACCU
+0f0b:	LEAX	ADDR, T7 + ACCU
+0f0d:	MOV	ACCU, #88
+0f10:	MOVB	0(ADDR), ACCU
+0f13:	ADDB	T3, #$00FE
+0f16:	MOVB	ACCU, T3
+0f18:	LEAX	ADDR, T7 + ACCU
+0f1a:	MOV	ACCU, #48
+0f1d:	MOVB	0(ADDR), ACCU
+0f20:	MOVB	ACCU, T1
+0f22:	BNE	$0F7D
+0f24:	MOVUB	ACCU, 5(FP)
+0f27:	BEQ	$0F36
+0f29:	ADDB	T3, #$00FF
+0f2c:	MOVB	ACCU, T3
+0f2e:	LEAX	ADDR, T7 + ACCU
+0f30:	MOV	ACCU, #43
+0f33:	MOVB	0(ADDR), ACCU
+0f36:	MOVUB	T8, 1(FP)
+0f39:	SUBR	T8, #$000A
+0f3d:	MOVB	ACCU, T3
+0f3f:	MOV	T9, ACCU
+0f41:	MOV	ACCU, T8
+0f43:	CMPS	ACCU, T9
+0f45:	BGT	$0F6E
+0f47:	MOVB	T1, #0
+0f4a:	MOVB	ACCU, T3
+0f4c:	CMPUB	ACCU, #$000A
+0f4e:	BLEF	$0E4B
+0f51:	MOVB	ACCU, T3
+0f53:	LEAX	ADDR, T7 + ACCU
+0f55:	MOVB	T6, 0(ADDR)
+0f58:	MOVB	ACCU, T1
+0f5a:	LEAX	ADDR, T7 + ACCU
+0f5c:	MOVB	0(ADDR), T6
+0f5f:	ADDB	T1, #$0001
+0f62:	ADDB	T3, #$0001
+0f65:	MOVB	ACCU, T3
+0f67:	CMPUB	ACCU, #$000A
+0f69:	BGT	$0F51
+0f6b:	JUMPF	$0E4B
+0f6e:	ADDB	T3, #$00FF
+0f71:	MOVB	ACCU, T3
+0f73:	LEAX	ADDR, T7 + ACCU
+0f75:	MOVB	T1, 0(FP)
+0f78:	MOVB	0(ADDR), T1
+0f7b:	JUMP	$0F36
+0f7d:	ADDB	T3, #$00FF
+0f80:	MOVB	ACCU, T3
+0f82:	LEAX	ADDR, T7 + ACCU
+0f84:	MOV	ACCU, #45
+0f87:	MOVB	0(ADDR), ACCU
+0f8a:	JUMP	$0F36
+0f8c:	MOVB	ACCU, T6
+0f8e:	SUBR	ACCU, #$000A
+0f92:	MOV	T6, ACCU
+0f94:	CMPUB	ACCU, T3
+0f96:	BGTF	$0EE4
+0f99:	JUMPF	$0EF7
+0f9c:	MOV	T9, 3(FP)
+0f9f:	MOV	ACCU, T8
+0fa1:	MODU	ACCU, T9
+0fa3:	MOV	T9, ACCU
+0fa5:	CMPS	ACCU, #$000A
+0fa8:	BLE	$0FB0
+0faa:	ADD	T9, #$0030
+0fae:	JUMP	$0FB4
+0fb0:	ADD	T9, #$0037
+0fb4:	ADDB	T3, #$00FF
+0fb7:	MOVB	ACCU, T3
+0fb9:	LEAX	ADDR, T7 + ACCU
+0fbb:	MOVB	0(ADDR), T9
+0fbe:	MOV	T9, 3(FP)
+0fc1:	MOV	ACCU, T8
+0fc3:	DIVU	ACCU, T9
+0fc5:	MOV	T8, ACCU
+0fc7:	BNE	$0F9C
+0fc9:	JUMPF	$0ED1
+0fcc:	MOV	ACCU, T4
+0fce:	MOV	T7, ACCU
+0fd0:	MOV	ADDR, T5
+0fd2:	MOV	T8, 0(ADDR)
+0fd5:	ADD	T5, #$0002
+0fd9:	MOV	ACCU, T8
+0fdb:	BLTF	$10E6
+0fde:	MOV	T9, ACCU
+0fe0:	MOVB	T1, #0
+0fe3:	MOVB	T3, #10
+0fe6:	MOV	ACCU, T8
+0fe8:	BNEF	$10B6
+0feb:	MOVB	T6, 2(FP)
+0fee:	MOVB	ACCU, T6
+0ff0:	CMPUB	ACCU, #$00FF
+0ff2:	BNEF	$10A6
+0ff5:	MOVB	T6, #9
+0ff8:	MOVB	ACCU, T3
+0ffa:	CMPUB	ACCU, #$0009
+0ffc:	BGE	$1011
+0ffe:	ADDB	T3, #$00FF
+1001:	MOVB	ACCU, T3
+1003:	LEAX	ADDR, T7 + ACCU
+1005:	MOV	ACCU, #48
+1008:	MOVB	0(ADDR), ACCU
+100b:	MOVB	ACCU, T6
+100d:	CMPUB	ACCU, T3
+100f:	BGT	$0FFE
+1011:	MOVUB	ACCU, 7(FP)
+1014:	BEQ	$103A
+1016:	MOV	ACCU, 3(FP)
+1019:	CMPU	ACCU, #$0010
+101c:	BNE	$103A
+101e:	MOVB	ACCU, T3
+1020:	ADDB	ACCU, #$00FF
+1023:	MOVB	ACCU, ACCU
+1025:	LEAX	ADDR, T7 + ACCU
+1027:	MOV	ACCU, #88
+102a:	MOVB	0(ADDR), ACCU
+102d:	ADDB	T3, #$00FE
+1030:	MOVB	ACCU, T3
+1032:	LEAX	ADDR, T7 + ACCU
+1034:	MOV	ACCU, #48
+1037:	MOVB	0(ADDR), ACCU
+103a:	MOVB	ACCU, T1
+103c:	BNE	$1097
+103e:	MOVUB	ACCU, 5(FP)
+1041:	BEQ	$1050
+1043:	ADDB	T3, #$00FF
+1046:	MOVB	ACCU, T3
+1048:	LEAX	ADDR, T7 + ACCU
+104a:	MOV	ACCU, #43
+104d:	MOVB	0(ADDR), ACCU
+1050:	MOVUB	T8, 1(FP)
+1053:	SUBR	T8, #$000A
+1057:	MOVB	ACCU, T3
+1059:	MOV	T9, ACCU
+105b:	MOV	ACCU, T8
+105d:	CMPS	ACCU, T9
+105f:	BGT	$1088
+1061:	MOVB	T1, #0
+1064:	MOVB	ACCU, T3
+1066:	CMPUB	ACCU, #$000A
+1068:	BLEF	$0E4B
+106b:	MOVB	ACCU, T3
+106d:	LEAX	ADDR, T7 + ACCU
+106f:	MOVB	T6, 0(ADDR)
+1072:	MOVB	ACCU, T1
+1074:	LEAX	ADDR, T7 + ACCU
+1076:	MOVB	0(ADDR), T6
+1079:	ADDB	T1, #$0001
+107c:	ADDB	T3, #$0001
+107f:	MOVB	ACCU, T3
+1081:	CMPUB	ACCU, #$000A
+1083:	BGT	$106B
+1085:	JUMPF	$0E4B
+1088:	ADDB	T3, #$00FF
+108b:	MOVB	ACCU, T3
+108d:	LEAX	ADDR, T7 + ACCU
+108f:	MOVB	T1, 0(FP)
+1092:	MOVB	0(ADDR), T1
+1095:	JUMP	$1050
+1097:	ADDB	T3, #$00FF
+109a:	MOVB	ACCU, T3
+109c:	LEAX	ADDR, T7 + ACCU
+109e:	MOV	ACCU, #45
+10a1:	MOVB	0(ADDR), ACCU
+10a4:	JUMP	$1050
+10a6:	MOVB	ACCU, T6
+10a8:	SUBR	ACCU, #$000A
+10ac:	MOV	T6, ACCU
+10ae:	CMPUB	ACCU, T3
+10b0:	BGTF	$0FFE
+10b3:	JUMPF	$1011
+10b6:	MOV	T8, 3(FP)
+10b9:	MOV	ACCU, T9
+10bb:	MODU	ACCU, T8
+10bd:	MOV	T8, ACCU
+10bf:	CMPS	ACCU, #$000A
+10c2:	BLE	$10CA
+10c4:	ADD	T8, #$0030
+10c8:	JUMP	$10CE
+10ca:	ADD	T8, #$0037
+10ce:	ADDB	T3, #$00FF
+10d1:	MOVB	ACCU, T3
+10d3:	LEAX	ADDR, T7 + ACCU
+10d5:	MOVB	0(ADDR), T8
+10d8:	MOV	T8, 3(FP)
+10db:	MOV	ACCU, T9
+10dd:	DIVU	ACCU, T8
+10df:	MOV	T9, ACCU
+10e1:	BNE	$10B6
+10e3:	JUMPF	$0FEB
+10e6:	MOVB	T1, #1
+10e9:	MOVB	T3, #10
+10ec:	NEG	ACCU
+10ed:	MOV	T9, ACCU
+10ef:	BNE	$10B6
+10f1:	JUMPF	$0FEB
+10f4:	MOV	T7, #0
+10f7:	MOV	ADDR, T2
+10f9:	MOVB	T3, 0(ADDR)
+10fc:	ADD	T2, #$0001
+1100:	MOVB	ACCU, T3
+1102:	CMPUB	ACCU, #$0030
+1104:	BGT	$1128
+1106:	MOVB	ACCU, T3
+1108:	CMPUB	ACCU, #$0039
+110a:	BLT	$1128
+110c:	MOVB	ACCU, T3
+110e:	MOV	T8, ACCU
+1110:	MOV	ADDR, T2
+1112:	MOVB	T3, 0(ADDR)
+1115:	ADD	T2, #$0001
+1119:	MUL	T7, #10
+111c:	ADD	T7, ACCU
+111e:	ADD	T7, #$FFD0
+1122:	MOVB	ACCU, T3
+1124:	CMPUB	ACCU, #$0030
+1126:	BLE	$1106
+1128:	MOVB	2(FP), T7
+112b:	JUMPF	$0C1F
+112e:	MOV	T7, #0
+1131:	MOVB	ACCU, T3
+1133:	CMPUB	ACCU, #$0030
+1135:	BGT	$1159
+1137:	MOVB	ACCU, T3
+1139:	CMPUB	ACCU, #$0039
+113b:	BLT	$1159
+113d:	MOVB	ACCU, T3
+113f:	MOV	T8, ACCU
+1141:	MOV	ADDR, T2
+1143:	MOVB	T3, 0(ADDR)
+1146:	ADD	T2, #$0001
+114a:	MUL	T7, #10
+114d:	ADD	T7, ACCU
+114f:	ADD	T7, #$FFD0
+1153:	MOVB	ACCU, T3
+1155:	CMPUB	ACCU, #$0030
+1157:	BLE	$1137
+1159:	MOVB	1(FP), T7
+115c:	JUMPF	$0C18
+115f:	MOV	ACCU, #1
+1162:	MOVB	7(FP), ACCU
+1165:	MOV	ADDR, T2
+1167:	MOVB	T3, 0(ADDR)
+116a:	JUMPF	$0BF2
+116d:	MOV	ACCU, #48
+1170:	MOVB	0(FP), ACCU
+1173:	MOV	ADDR, T2
+1175:	MOVB	T3, 0(ADDR)
+1178:	JUMPF	$0BF2
+117b:	MOV	ACCU, #1
+117e:	MOVB	5(FP), ACCU
+1181:	MOV	ADDR, T2
+1183:	MOVB	T3, 0(ADDR)
+1186:	JUMPF	$0BF2
+1189:	MOVB	ACCU, T0
+118b:	BNE	$1197
+118d:	MOVB	ACCU, T1
+118f:	ADD	T4, ACCU
+1191:	MOVB	T1, #0
+1194:	JUMPF	$0BC9
+1197:	MOVB	ACCU, T1
+1199:	LEAX	ADDR, T4 + ACCU
+119b:	MOV	ACCU, #0
+119e:	MOVB	0(ADDR), ACCU
+11a1:	MOV	ACCU, T4
+11a3:	MOV	P0, ACCU
+11a5:	CALL	puts + 0
+11a8:	MOVB	T1, #0
+11ab:	JUMPF	$0BC9
+--------------------------------------------------------------------
+puts:
+11ae:	ENTER	0, 2
+11b2:	JSR	$11b9
+11b5:	RETURN	0, 2
+--------------------------------------------------------------------
+11b9 : a0 00 __ LDY #$00
+11bb : b1 0d __ LDA (P0),y
+11bd : f0 0b __ BEQ $11ca
+11bf : 20 cb 11 JSR $11cb ; (putpch + 0)
+11c2 : e6 0d __ INC P0
+11c4 : d0 f3 __ BNE $11b9
+11c6 : e6 0e __ INC P1
+11c8 : d0 ef __ BNE $11b9
+11ca : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+11cb : ae 2b 23 LDX $232b ; (giocharmap + 0)
+11ce : e0 01 __ CPX #$01
+11d0 : 90 22 __ BCC $11f4
+11d2 : c9 0a __ CMP #$0a
+11d4 : d0 02 __ BNE $11d8
+11d6 : a9 0d __ LDA #$0d
+11d8 : e0 02 __ CPX #$02
+11da : 90 18 __ BCC $11f4
+11dc : c9 41 __ CMP #$41
+11de : 90 14 __ BCC $11f4
+11e0 : c9 7b __ CMP #$7b
+11e2 : b0 10 __ BCS $11f4
+11e4 : c9 61 __ CMP #$61
+11e6 : b0 04 __ BCS $11ec
+11e8 : c9 5b __ CMP #$5b
+11ea : b0 08 __ BCS $11f4
+11ec : 49 20 __ EOR #$20
+11ee : e0 03 __ CPX #$03
+11f0 : f0 02 __ BEQ $11f4
+11f2 : 29 df __ AND #$df
+11f4 : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+11f7:	ENTER	5, 7
+11fb:	MOVD	ACCU, P4
+11fd:	MOVD	T0, ACCU
+11ff:	MOVD	T1, ACCU
+1201:	MOV	ACCU, P2
+1203:	MOV	T2, ACCU
+1205:	MOVB	T3, #0
+1208:	MOVB	ACCU, P8
+120a:	BEQ	$1219
+120c:	MOVD	ACCU, #$00000000
+1212:	EXTRT	T0, inp_op_cmp_s32 + 0
+1216:	BLTF	$135E
+1219:	MOVB	T4, #16
+121c:	MOVD	ACCU, #$00000000
+1222:	EXTRT	T0, inp_op_cmp_u32 + 0
+1226:	BGTF	$1306
+1229:	MOV	ADDR, P0
+122b:	MOVB	T5, 2(ADDR)
+122e:	MOVB	ACCU, T5
+1230:	CMPUB	ACCU, #$00FF
+1232:	BNEF	$12F6
+1235:	MOVB	T5, #15
+1238:	MOVB	ACCU, T4
+123a:	CMPUB	ACCU, #$000F
+123c:	BGE	$1251
+123e:	ADDB	T4, #$00FF
+1241:	MOVB	ACCU, T4
+1243:	LEAX	ADDR, T2 + ACCU
+1245:	MOV	ACCU, #48
+1248:	MOVB	0(ADDR), ACCU
+124b:	MOVB	ACCU, T5
+124d:	CMPUB	ACCU, T4
+124f:	BGT	$123E
+1251:	MOV	ACCU, P0
+1253:	MOV	T6, ACCU
+1255:	MOV	ADDR, T6
+1257:	MOVUB	ACCU, 7(ADDR)
+125a:	BEQ	$1280
+125c:	MOV	ACCU, 3(ADDR)
+125f:	CMPU	ACCU, #$0010
+1262:	BNE	$1280
+1264:	MOVB	ACCU, T4
+1266:	ADDB	ACCU, #$00FF
+1269:	MOVB	ACCU, ACCU
+126b:	LEAX	ADDR, T2 + ACCU
+126d:	MOV	ACCU, #88
+1270:	MOVB	0(ADDR), ACCU
+1273:	ADDB	T4, #$00FE
+1276:	MOVB	ACCU, T4
+1278:	LEAX	ADDR, T2 + ACCU
+127a:	MOV	ACCU, #48
+127d:	MOVB	0(ADDR), ACCU
+1280:	MOVB	ACCU, T3
+1282:	BNE	$12E7
+1284:	MOV	ADDR, T6
+1286:	MOVUB	ACCU, 5(ADDR)
+1289:	BEQ	$1298
+128b:	ADDB	T4, #$00FF
+128e:	MOVB	ACCU, T4
+1290:	LEAX	ADDR, T2 + ACCU
+1292:	MOV	ACCU, #43
+1295:	MOVB	0(ADDR), ACCU
+1298:	MOV	ACCU, P0
+129a:	MOV	T6, ACCU
+129c:	MOV	ADDR, T6
+129e:	MOVUB	T7, 1(ADDR)
+12a1:	SUBR	T7, #$0010
+12a5:	MOVB	ACCU, T4
+12a7:	MOV	T8, ACCU
+12a9:	MOV	ACCU, T7
+12ab:	CMPS	ACCU, T8
+12ad:	BGT	$12D8
+12af:	MOVB	T3, #0
+12b2:	MOVB	ACCU, T4
+12b4:	CMPUB	ACCU, #$0010
+12b6:	BLE	$12D2
+12b8:	MOVB	ACCU, T4
+12ba:	LEAX	ADDR, T2 + ACCU
+12bc:	MOVB	T5, 0(ADDR)
+12bf:	MOVB	ACCU, T3
+12c1:	LEAX	ADDR, T2 + ACCU
+12c3:	MOVB	0(ADDR), T5
+12c6:	ADDB	T3, #$0001
+12c9:	ADDB	T4, #$0001
+12cc:	MOVB	ACCU, T4
+12ce:	CMPUB	ACCU, #$0010
+12d0:	BGT	$12B8
+12d2:	MOVB	ACCU, T3
+12d4:	RETURN	5, 7
+12d8:	MOVB	T3, 0(ADDR)
+12db:	ADDB	T4, #$00FF
+12de:	MOVB	ACCU, T4
+12e0:	LEAX	ADDR, T2 + ACCU
+12e2:	MOVB	0(ADDR), T3
+12e5:	JUMP	$1298
+12e7:	ADDB	T4, #$00FF
+12ea:	MOVB	ACCU, T4
+12ec:	LEAX	ADDR, T2 + ACCU
+12ee:	MOV	ACCU, #45
+12f1:	MOVB	0(ADDR), ACCU
+12f4:	JUMP	$1298
+12f6:	MOVB	ACCU, T5
+12f8:	SUBR	ACCU, #$0010
+12fc:	MOV	T5, ACCU
+12fe:	CMPUB	ACCU, T4
+1300:	BGTF	$123E
+1303:	JUMPF	$1251
+1306:	MOV	ACCU, P0
+1308:	MOV	T6, ACCU
+130a:	MOV	ADDR, T6
+130c:	MOV	ACCU, 3(ADDR)
+130f:	EXTRT	$00, inp_op_ext_u16 + 0
+1313:	MOVD	T0, ACCU
+1315:	MOVD	ACCU, T1
+1317:	EXTRT	T0, inp_binop_mod_u32 + 0
+131b:	MOVD	T0, ACCU
+131d:	CMPS	ACCU, #$000A
+1320:	BLE	$132A
+1322:	MOV	ACCU, T0
+1324:	ADD	ACCU, #$0030
+1328:	JUMP	$1330
+132a:	MOV	ACCU, T0
+132c:	ADD	ACCU, #$0037
+1330:	MOV	T7, ACCU
+1332:	ADDB	T4, #$00FF
+1335:	MOVB	ACCU, T4
+1337:	LEAX	ADDR, T2 + ACCU
+1339:	MOVB	0(ADDR), T7
+133c:	MOV	ADDR, T6
+133e:	MOV	ACCU, 3(ADDR)
+1341:	EXTRT	$00, inp_op_ext_u16 + 0
+1345:	MOVD	T0, ACCU
+1347:	MOVD	ACCU, T1
+1349:	EXTRT	T0, inp_binop_div_u32 + 0
+134d:	MOVD	T1, ACCU
+134f:	MOVD	ACCU, #$00000000
+1355:	EXTRT	T1, inp_op_cmp_u32 + 0
+1359:	BGT	$1306
+135b:	JUMPF	$1229
+135e:	MOVB	T3, #1
+1361:	MOVB	T4, #16
+1364:	MOVD	ACCU, T0
+1366:	EXTRT	$00, negaccu32 + 0
+136a:	MOVD	T1, ACCU
+136c:	MOVD	ACCU, #$00000000
+1372:	EXTRT	T1, inp_op_cmp_u32 + 0
+1376:	BGT	$1306
+1378:	JUMPF	$1229
+--------------------------------------------------------------------
+nformf:
+137b:	ENTER	10, 12
+137f:	MOV	ACCU, P2
+1381:	MOV	T0, ACCU
+1383:	MOV	T1, ACCU
+1385:	MOVD	ACCU, P4
+1387:	MOVD	T2, ACCU
+1389:	MOVD	ACCU, #$00000000
+138f:	CMPF	ACCU, T2
+1391:	BLTF	$1691
+1394:	MOVB	T3, #0
+1397:	MOV	ADDR, P0
+1399:	MOVUB	ACCU, 5(ADDR)
+139c:	BEQ	$13A9
+139e:	MOV	ACCU, #43
+13a1:	MOV	ADDR, T0
+13a3:	MOVB	0(ADDR), ACCU
+13a6:	MOVB	T3, #1
+13a9:	MOV	T0, #0
+13ac:	MOV	ADDR, P0
+13ae:	MOVB	T5, 2(ADDR)
+13b1:	MOVB	ACCU, T5
+13b3:	CMPUB	ACCU, #$00FF
+13b5:	BNE	$13BC
+13b7:	MOVB	T5, #6
+13ba:	JUMP	$13C0
+13bc:	AND	T5, #$00FF
+13c0:	MOVD	ACCU, P4
+13c2:	MOVD	T2, #$00000000
+13c8:	CMPF	ACCU, T2
+13ca:	BNEF	$1615
+13cd:	MOVB	ACCU, P8
+13cf:	MOVB	T6, ACCU
+13d1:	CMPUB	ACCU, #$0065
+13d3:	SEQ
+13d4:	MOVB	T7, ACCU
+13d6:	MOVB	T8, ACCU
+13d8:	MOVB	ACCU, T5
+13da:	MOV	T4, ACCU
+13dc:	ADD	T4, #$0001
+13e0:	MOVB	ACCU, T6
+13e2:	CMPUB	ACCU, #$0067
+13e4:	BEQF	$1604
+13e7:	MOVB	ACCU, T7
+13e9:	BNEF	$15B8
+13ec:	MOV	ACCU, T0
+13ee:	BGE	$1406
+13f0:	MOVD	ACCU, P4
+13f2:	MOVD	$03, #$41200000
+13f8:	DIVF	ACCU, $03
+13fa:	MOVD	T2, ACCU
+13fc:	MOVD	P4, ACCU
+13fe:	ADD	T0, #$0001
+1402:	MOV	ACCU, T0
+1404:	BLT	$13F0
+1406:	MOVD	T2, #$3f000000
+140c:	MOVB	ACCU, T5
+140e:	ADD	ACCU, T0
+1410:	MOV	T4, ACCU
+1412:	ADD	T4, #$0001
+1416:	MOVB	ACCU, T4
+1418:	CMPUB	ACCU, #$0001
+141a:	BLTF	$159D
+141d:	MOVD	ACCU, P4
+141f:	ADDF	ACCU, T2
+1421:	MOVD	T2, ACCU
+1423:	MOVD	P4, ACCU
+1425:	MOVD	ACCU, #$41200000
+142b:	CMPF	ACCU, T2
+142d:	BLT	$1440
+142f:	MOVD	ACCU, T2
+1431:	MOVD	$03, #$41200000
+1437:	DIVF	ACCU, $03
+1439:	MOVD	T2, ACCU
+143b:	MOVD	P4, ACCU
+143d:	ADDB	T5, #$00FF
+1440:	MOVB	ACCU, T4
+1442:	MOV	T10, ACCU
+1444:	MOVB	ACCU, T5
+1446:	NEG	ACCU
+1447:	ADD	ACCU, T10
+1449:	MOV	T10, ACCU
+144b:	MOVB	T5, ACCU
+144d:	MOVB	ACCU, T4
+144f:	CMPUB	ACCU, #$0014
+1451:	BGE	$1456
+1453:	MOVB	T4, #20
+1456:	MOVB	ACCU, T10
+1458:	BNE	$1467
+145a:	MOVB	ACCU, T3
+145c:	LEAX	ADDR, T1 + ACCU
+145e:	MOV	ACCU, #48
+1461:	MOVB	0(ADDR), ACCU
+1464:	ADDB	T3, #$0001
+1467:	MOVB	T6, #0
+146a:	MOVB	ACCU, T4
+146c:	BNEF	$1556
+146f:	MOVB	ACCU, T8
+1471:	BNE	$14E5
+1473:	MOV	ADDR, P0
+1475:	MOVUB	ACCU, 1(ADDR)
+1478:	CMPUB	ACCU, T3
+147a:	BLT	$1482
+147c:	MOVB	ACCU, T3
+147e:	RETURN	10, 12
+1482:	MOVB	ACCU, T3
+1484:	CMPUB	ACCU, #$0001
+1486:	BLE	$14B4
+1488:	MOVB	T5, #0
+148b:	MOV	ADDR, P0
+148d:	MOVUB	T0, 1(ADDR)
+1490:	MOVB	ACCU, T3
+1492:	NEG	ACCU
+1493:	ADD	ACCU, T0
+1495:	MOV	T4, ACCU
+1497:	MOVB	ACCU, T5
+1499:	MOV	T10, ACCU
+149b:	MOV	ACCU, T4
+149d:	CMPU	ACCU, T10
+149f:	BLT	$14A5
+14a1:	MOV	ACCU, T0
+14a3:	JUMP	$147E
+14a5:	MOV	ACCU, T1
+14a7:	LEAX	ADDR, T10 + ACCU
+14a9:	MOV	ACCU, #32
+14ac:	MOVB	0(ADDR), ACCU
+14af:	ADDB	T5, #$0001
+14b2:	JUMP	$148B
+14b4:	MOVB	T5, #1
+14b7:	MOV	ACCU, P0
+14b9:	MOV	T0, ACCU
+14bb:	MOVB	ACCU, T3
+14bd:	MOV	T4, ACCU
+14bf:	MOVB	ACCU, T5
+14c1:	MOV	T10, ACCU
+14c3:	MOV	ACCU, T4
+14c5:	SUB	ACCU, T10
+14c7:	MOV	ADDR, T0
+14c9:	MOVB	T6, 1(ADDR)
+14cc:	LEAX	ADDR, T1 + ACCU
+14ce:	MOVB	ACCU, T6
+14d0:	MOVB	T6, 0(ADDR)
+14d3:	SUB	ACCU, T10
+14d5:	LEAX	ADDR, T1 + ACCU
+14d7:	MOVB	0(ADDR), T6
+14da:	ADDB	T5, #$0001
+14dd:	MOVB	ACCU, T3
+14df:	CMPUB	ACCU, T5
+14e1:	BLE	$14BF
+14e3:	JUMP	$1488
+14e5:	MOVB	ACCU, T3
+14e7:	LEAX	ADDR, T1 + ACCU
+14e9:	MOV	ACCU, #69
+14ec:	MOVB	0(ADDR), ACCU
+14ef:	MOVB	ACCU, T3
+14f1:	ADDB	ACCU, #$0001
+14f4:	MOVB	T5, ACCU
+14f6:	MOV	ACCU, T0
+14f8:	BLT	$1509
+14fa:	MOVB	ACCU, T5
+14fc:	LEAX	ADDR, T1 + ACCU
+14fe:	MOV	ACCU, #43
+1501:	MOVB	0(ADDR), ACCU
+1504:	ADDB	T3, #$0002
+1507:	JUMP	$151B
+1509:	MOVB	ACCU, T5
+150b:	LEAX	ADDR, T1 + ACCU
+150d:	MOV	ACCU, #45
+1510:	MOVB	0(ADDR), ACCU
+1513:	ADDB	T3, #$0002
+1516:	MOV	ACCU, T0
+1518:	NEG	ACCU
+1519:	MOV	T0, ACCU
+151b:	MOVB	ACCU, T3
+151d:	ADD	ACCU, T1
+151f:	MOV	T4, ACCU
+1521:	MOV	ACCU, T0
+1523:	MOV	ADDR, #10
+1526:	DIVS	ACCU, ADDR
+1528:	MOV	ADDR, T4
+152a:	MOV	T10, ACCU
+152c:	ADD	T10, #$0030
+1530:	MOVB	0(ADDR), T10
+1533:	MOVB	ACCU, T3
+1535:	ADDB	ACCU, #$0001
+1538:	MOVB	ACCU, ACCU
+153a:	ADD	ACCU, T1
+153c:	MOV	T4, ACCU
+153e:	MOV	ACCU, T0
+1540:	MOV	ADDR, #10
+1543:	MODS	ACCU, ADDR
+1545:	MOV	ADDR, T4
+1547:	MOV	T0, ACCU
+1549:	ADD	T0, #$0030
+154d:	MOVB	0(ADDR), T0
+1550:	ADDB	T3, #$0002
+1553:	JUMPF	$1473
+1556:	MOVB	ACCU, T5
+1558:	CMPUB	ACCU, T6
+155a:	BNE	$1569
+155c:	MOVB	ACCU, T3
+155e:	LEAX	ADDR, T1 + ACCU
+1560:	MOV	ACCU, #46
+1563:	MOVB	0(ADDR), ACCU
+1566:	ADDB	T3, #$0001
+1569:	MOVD	ACCU, P4
+156b:	MOVD	T2, ACCU
+156d:	CNVFS	ACCU
+156e:	MOV	T10, ACCU
+1570:	CNVSF	ACCU
+1571:	MOVD	T9, ACCU
+1573:	MOVD	ACCU, T2
+1575:	SUBF	ACCU, T9
+1577:	MOVD	$03, #$41200000
+157d:	MULF	ACCU, $03
+157f:	MOVD	T2, ACCU
+1581:	MOVD	P4, ACCU
+1583:	MOVB	ACCU, T3
+1585:	LEAX	ADDR, T1 + ACCU
+1587:	ADD	T10, #$0030
+158b:	MOVB	0(ADDR), T10
+158e:	ADDB	T3, #$0001
+1591:	ADDB	T6, #$0001
+1594:	MOVB	ACCU, T4
+1596:	CMPUB	ACCU, T6
+1598:	BLT	$1556
+159a:	JUMPF	$146F
+159d:	MOVB	T6, #1
+15a0:	MOVD	ACCU, T2
+15a2:	MOVD	$03, #$41200000
+15a8:	DIVF	ACCU, $03
+15aa:	MOVD	T2, ACCU
+15ac:	ADDB	T6, #$0001
+15af:	MOVB	ACCU, T4
+15b1:	CMPUB	ACCU, T6
+15b3:	BLT	$15A0
+15b5:	JUMPF	$141D
+15b8:	MOVD	T2, #$3f000000
+15be:	MOVB	ACCU, T5
+15c0:	BNE	$15EA
+15c2:	MOVD	ACCU, P4
+15c4:	ADDF	ACCU, T2
+15c6:	MOVD	T2, ACCU
+15c8:	MOVD	P4, ACCU
+15ca:	MOVD	ACCU, #$41200000
+15d0:	CMPF	ACCU, T2
+15d2:	BLTF	$1440
+15d5:	MOVD	ACCU, T2
+15d7:	MOVD	$03, #$41200000
+15dd:	DIVF	ACCU, $03
+15df:	MOVD	T2, ACCU
+15e1:	MOVD	P4, ACCU
+15e3:	ADD	T0, #$0001
+15e7:	JUMPF	$1440
+15ea:	MOVB	T6, #0
+15ed:	MOVD	ACCU, T2
+15ef:	MOVD	$03, #$41200000
+15f5:	DIVF	ACCU, $03
+15f7:	MOVD	T2, ACCU
+15f9:	ADDB	T6, #$0001
+15fc:	MOVB	ACCU, T5
+15fe:	CMPUB	ACCU, T6
+1600:	BLT	$15ED
+1602:	JUMP	$15C2
+1604:	MOV	ACCU, T0
+1606:	CMPS	ACCU, #$0003
+1609:	BLT	$1610
+160b:	MOV	ACCU, T0
+160d:	BGEF	$13E7
+1610:	MOVB	T8, #1
+1613:	JUMP	$15B8
+1615:	MOVD	ACCU, P4
+1617:	MOVD	T2, #$447a0000
+161d:	CMPF	ACCU, T2
+161f:	BGT	$163D
+1621:	MOVD	ACCU, P4
+1623:	MOVD	$03, #$447a0000
+1629:	DIVF	ACCU, $03
+162b:	MOVD	T2, ACCU
+162d:	MOVD	P4, ACCU
+162f:	ADD	T0, #$0003
+1633:	MOVD	ACCU, #$447a0000
+1639:	CMPF	ACCU, T2
+163b:	BGE	$1621
+163d:	MOVD	ACCU, P4
+163f:	MOVD	T2, #$3f800000
+1645:	CMPF	ACCU, T2
+1647:	BLE	$1665
+1649:	MOVD	ACCU, P4
+164b:	MOVD	$03, #$447a0000
+1651:	MULF	ACCU, $03
+1653:	MOVD	T2, ACCU
+1655:	MOVD	P4, ACCU
+1657:	ADD	T0, #$FFFD
+165b:	MOVD	ACCU, #$3f800000
+1661:	CMPF	ACCU, T2
+1663:	BLT	$1649
+1665:	MOVD	ACCU, P4
+1667:	MOVD	T2, #$41200000
+166d:	CMPF	ACCU, T2
+166f:	BGTF	$13CD
+1672:	MOVD	ACCU, P4
+1674:	MOVD	$03, #$41200000
+167a:	DIVF	ACCU, $03
+167c:	MOVD	T2, ACCU
+167e:	MOVD	P4, ACCU
+1680:	ADD	T0, #$0001
+1684:	MOVD	ACCU, #$41200000
+168a:	CMPF	ACCU, T2
+168c:	BGE	$1672
+168e:	JUMPF	$13CD
+1691:	MOV	ADDR, T0
+1693:	MOVD	ACCU, T2
+1695:	NEGF	ACCU
+1696:	MOVD	T2, ACCU
+1698:	MOVD	P4, ACCU
+169a:	MOV	ACCU, #45
+169d:	MOVB	0(ADDR), ACCU
+16a0:	MOVB	T3, #1
+16a3:	JUMPF	$13A9
+--------------------------------------------------------------------
+strlen:
+16bf : ea __ __ NOP
+16c0 : a9 00 __ LDA #$00
+16c2 : 85 43 __ STA T0 + 0
+16c4 : 85 44 __ STA T0 + 1
+16c6 : a0 00 __ LDY #$00
+16c8 : b1 0d __ LDA (P0),y
+16ca : d0 09 __ BNE $16d5
+16cc : a5 43 __ LDA T0 + 0
+16ce : 85 1b __ STA ACCU + 0
+16d0 : a5 44 __ LDA T0 + 1
+16d2 : 85 1c __ STA ACCU + 1
+16d4 : 60 __ __ RTS
+16d5 : 18 __ __ CLC
+16d6 : a5 0d __ LDA P0
+16d8 : 65 43 __ ADC T0 + 0
+16da : 85 48 __ STA T3 + 0
+16dc : a5 0e __ LDA P1
+16de : 65 44 __ ADC T0 + 1
+16e0 : 85 49 __ STA T3 + 1
+16e2 : e6 43 __ INC T0 + 0
+16e4 : d0 02 __ BNE $16e8
+16e6 : e6 44 __ INC T0 + 1
+16e8 : a0 01 __ LDY #$01
+16ea : b1 48 __ LDA (T3 + 0),y
+16ec : d0 e7 __ BNE $16d5
+16ee : 4c cc 16 JMP $16cc ; (strlen + 13)
+--------------------------------------------------------------------
+strcmp:
+1707 : ea __ __ NOP
+1708 : a0 00 __ LDY #$00
+170a : 84 1c __ STY ACCU + 1
+170c : b1 0d __ LDA (P0),y
+170e : f0 16 __ BEQ $1726
+1710 : d1 0f __ CMP (P2),y
+1712 : d0 16 __ BNE $172a
+1714 : c8 __ __ INY
+1715 : b1 0d __ LDA (P0),y
+1717 : f0 0d __ BEQ $1726
+1719 : d1 0f __ CMP (P2),y
+171b : d0 0d __ BNE $172a
+171d : c8 __ __ INY
+171e : d0 ec __ BNE $170c
+1720 : e6 0e __ INC P1
+1722 : e6 10 __ INC P3
+1724 : d0 e6 __ BNE $170c
+1726 : d1 0f __ CMP (P2),y
+1728 : f0 0a __ BEQ $1734
+172a : b0 06 __ BCS $1732
+172c : a9 ff __ LDA #$ff
+172e : 85 1c __ STA ACCU + 1
+1730 : 30 02 __ BMI $1734
+1732 : a9 01 __ LDA #$01
+1734 : 85 1b __ STA ACCU + 0
+1736 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1745 : b1 19 __ LDA (IP + 0),y
+1747 : c8 __ __ INY
+1748 : aa __ __ TAX
+1749 : b5 00 __ LDA $00,x
+174b : 85 03 __ STA $03
+174d : b5 01 __ LDA $01,x
+174f : 85 04 __ STA $04
+1751 : b5 02 __ LDA $02,x
+1753 : 85 05 __ STA $05
+1755 : b5 03 __ LDA $03,x
+1757 : 85 06 __ STA $06
+1759 : a5 05 __ LDA $05
+175b : 0a __ __ ASL
+175c : a5 06 __ LDA $06
+175e : 2a __ __ ROL
+175f : 85 08 __ STA $08
+1761 : f0 06 __ BEQ $1769
+1763 : a5 05 __ LDA $05
+1765 : 09 80 __ ORA #$80
+1767 : 85 05 __ STA $05
+1769 : a5 1d __ LDA ACCU + 2
+176b : 0a __ __ ASL
+176c : a5 1e __ LDA ACCU + 3
+176e : 2a __ __ ROL
+176f : 85 07 __ STA $07
+1771 : f0 06 __ BEQ $1779
+1773 : a5 1d __ LDA ACCU + 2
+1775 : 09 80 __ ORA #$80
+1777 : 85 1d __ STA ACCU + 2
+1779 : 60 __ __ RTS
+177a : 06 1e __ ASL ACCU + 3
+177c : a5 07 __ LDA $07
+177e : 6a __ __ ROR
+177f : 85 1e __ STA ACCU + 3
+1781 : b0 06 __ BCS $1789
+1783 : a5 1d __ LDA ACCU + 2
+1785 : 29 7f __ AND #$7f
+1787 : 85 1d __ STA ACCU + 2
+1789 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+178a : 38 __ __ SEC
+178b : a5 07 __ LDA $07
+178d : e5 08 __ SBC $08
+178f : f0 38 __ BEQ $17c9
+1791 : aa __ __ TAX
+1792 : b0 25 __ BCS $17b9
+1794 : e0 e9 __ CPX #$e9
+1796 : b0 0e __ BCS $17a6
+1798 : a5 08 __ LDA $08
+179a : 85 07 __ STA $07
+179c : a9 00 __ LDA #$00
+179e : 85 1b __ STA ACCU + 0
+17a0 : 85 1c __ STA ACCU + 1
+17a2 : 85 1d __ STA ACCU + 2
+17a4 : f0 23 __ BEQ $17c9
+17a6 : a5 1d __ LDA ACCU + 2
+17a8 : 4a __ __ LSR
+17a9 : 66 1c __ ROR ACCU + 1
+17ab : 66 1b __ ROR ACCU + 0
+17ad : e8 __ __ INX
+17ae : d0 f8 __ BNE $17a8
+17b0 : 85 1d __ STA ACCU + 2
+17b2 : a5 08 __ LDA $08
+17b4 : 85 07 __ STA $07
+17b6 : 4c c9 17 JMP $17c9 ; (faddsub + 63)
+17b9 : e0 18 __ CPX #$18
+17bb : b0 33 __ BCS $17f0
+17bd : a5 05 __ LDA $05
+17bf : 4a __ __ LSR
+17c0 : 66 04 __ ROR $04
+17c2 : 66 03 __ ROR $03
+17c4 : ca __ __ DEX
+17c5 : d0 f8 __ BNE $17bf
+17c7 : 85 05 __ STA $05
+17c9 : a5 1e __ LDA ACCU + 3
+17cb : 29 80 __ AND #$80
+17cd : 85 1e __ STA ACCU + 3
+17cf : 45 06 __ EOR $06
+17d1 : 30 2d __ BMI $1800
+17d3 : 18 __ __ CLC
+17d4 : a5 1b __ LDA ACCU + 0
+17d6 : 65 03 __ ADC $03
+17d8 : 85 1b __ STA ACCU + 0
+17da : a5 1c __ LDA ACCU + 1
+17dc : 65 04 __ ADC $04
+17de : 85 1c __ STA ACCU + 1
+17e0 : a5 1d __ LDA ACCU + 2
+17e2 : 65 05 __ ADC $05
+17e4 : 85 1d __ STA ACCU + 2
+17e6 : 90 08 __ BCC $17f0
+17e8 : 66 1d __ ROR ACCU + 2
+17ea : 66 1c __ ROR ACCU + 1
+17ec : 66 1b __ ROR ACCU + 0
+17ee : e6 07 __ INC $07
+17f0 : a5 07 __ LDA $07
+17f2 : 4a __ __ LSR
+17f3 : 05 1e __ ORA ACCU + 3
+17f5 : 85 1e __ STA ACCU + 3
+17f7 : b0 06 __ BCS $17ff
+17f9 : a5 1d __ LDA ACCU + 2
+17fb : 29 7f __ AND #$7f
+17fd : 85 1d __ STA ACCU + 2
+17ff : 60 __ __ RTS
+1800 : 38 __ __ SEC
+1801 : a5 1b __ LDA ACCU + 0
+1803 : e5 03 __ SBC $03
+1805 : 85 1b __ STA ACCU + 0
+1807 : a5 1c __ LDA ACCU + 1
+1809 : e5 04 __ SBC $04
+180b : 85 1c __ STA ACCU + 1
+180d : a5 1d __ LDA ACCU + 2
+180f : e5 05 __ SBC $05
+1811 : 85 1d __ STA ACCU + 2
+1813 : b0 19 __ BCS $182e
+1815 : 38 __ __ SEC
+1816 : a9 00 __ LDA #$00
+1818 : e5 1b __ SBC ACCU + 0
+181a : 85 1b __ STA ACCU + 0
+181c : a9 00 __ LDA #$00
+181e : e5 1c __ SBC ACCU + 1
+1820 : 85 1c __ STA ACCU + 1
+1822 : a9 00 __ LDA #$00
+1824 : e5 1d __ SBC ACCU + 2
+1826 : 85 1d __ STA ACCU + 2
+1828 : a5 1e __ LDA ACCU + 3
+182a : 49 80 __ EOR #$80
+182c : 85 1e __ STA ACCU + 3
+182e : a5 1d __ LDA ACCU + 2
+1830 : 30 be __ BMI $17f0
+1832 : 05 1c __ ORA ACCU + 1
+1834 : 05 1b __ ORA ACCU + 0
+1836 : f0 0f __ BEQ $1847
+1838 : c6 07 __ DEC $07
+183a : f0 0b __ BEQ $1847
+183c : 06 1b __ ASL ACCU + 0
+183e : 26 1c __ ROL ACCU + 1
+1840 : 26 1d __ ROL ACCU + 2
+1842 : 10 f4 __ BPL $1838
+1844 : 4c f0 17 JMP $17f0 ; (faddsub + 102)
+1847 : a9 00 __ LDA #$00
+1849 : 85 1b __ STA ACCU + 0
+184b : 85 1c __ STA ACCU + 1
+184d : 85 1d __ STA ACCU + 2
+184f : 85 1e __ STA ACCU + 3
+1851 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1852 : a5 1b __ LDA ACCU + 0
+1854 : 05 1c __ ORA ACCU + 1
+1856 : 05 1d __ ORA ACCU + 2
+1858 : d0 03 __ BNE $185d
+185a : 85 1e __ STA ACCU + 3
+185c : 60 __ __ RTS
+185d : a5 03 __ LDA $03
+185f : 05 04 __ ORA $04
+1861 : 05 05 __ ORA $05
+1863 : d0 09 __ BNE $186e
+1865 : 85 1b __ STA ACCU + 0
+1867 : 85 1c __ STA ACCU + 1
+1869 : 85 1d __ STA ACCU + 2
+186b : 85 1e __ STA ACCU + 3
+186d : 60 __ __ RTS
+186e : a9 00 __ LDA #$00
+1870 : 85 09 __ STA $09
+1872 : 85 0a __ STA $0a
+1874 : 85 0b __ STA $0b
+1876 : a4 1b __ LDY ACCU + 0
+1878 : a5 03 __ LDA $03
+187a : d0 06 __ BNE $1882
+187c : a5 04 __ LDA $04
+187e : f0 0a __ BEQ $188a
+1880 : d0 05 __ BNE $1887
+1882 : 20 c2 18 JSR $18c2 ; (fmul8 + 0)
+1885 : a5 04 __ LDA $04
+1887 : 20 c2 18 JSR $18c2 ; (fmul8 + 0)
+188a : a5 05 __ LDA $05
+188c : 20 c2 18 JSR $18c2 ; (fmul8 + 0)
+188f : 38 __ __ SEC
+1890 : a5 0b __ LDA $0b
+1892 : 30 06 __ BMI $189a
+1894 : 06 09 __ ASL $09
+1896 : 26 0a __ ROL $0a
+1898 : 2a __ __ ROL
+1899 : 18 __ __ CLC
+189a : 29 7f __ AND #$7f
+189c : 85 0b __ STA $0b
+189e : a5 1e __ LDA ACCU + 3
+18a0 : 45 06 __ EOR $06
+18a2 : 29 80 __ AND #$80
+18a4 : 85 1e __ STA ACCU + 3
+18a6 : a5 07 __ LDA $07
+18a8 : e9 7e __ SBC #$7e
+18aa : 18 __ __ CLC
+18ab : 65 08 __ ADC $08
+18ad : 4a __ __ LSR
+18ae : 05 1e __ ORA ACCU + 3
+18b0 : 85 1e __ STA ACCU + 3
+18b2 : a9 00 __ LDA #$00
+18b4 : 6a __ __ ROR
+18b5 : 05 0b __ ORA $0b
+18b7 : 85 1d __ STA ACCU + 2
+18b9 : a5 0a __ LDA $0a
+18bb : 85 1c __ STA ACCU + 1
+18bd : a5 09 __ LDA $09
+18bf : 85 1b __ STA ACCU + 0
+18c1 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+18c2 : 38 __ __ SEC
+18c3 : 6a __ __ ROR
+18c4 : 90 1e __ BCC $18e4
+18c6 : aa __ __ TAX
+18c7 : 18 __ __ CLC
+18c8 : 98 __ __ TYA
+18c9 : 65 09 __ ADC $09
+18cb : 85 09 __ STA $09
+18cd : a5 0a __ LDA $0a
+18cf : 65 1c __ ADC ACCU + 1
+18d1 : 85 0a __ STA $0a
+18d3 : a5 0b __ LDA $0b
+18d5 : 65 1d __ ADC ACCU + 2
+18d7 : 6a __ __ ROR
+18d8 : 85 0b __ STA $0b
+18da : 8a __ __ TXA
+18db : 66 0a __ ROR $0a
+18dd : 66 09 __ ROR $09
+18df : 4a __ __ LSR
+18e0 : f0 0d __ BEQ $18ef
+18e2 : b0 e2 __ BCS $18c6
+18e4 : 66 0b __ ROR $0b
+18e6 : 66 0a __ ROR $0a
+18e8 : 66 09 __ ROR $09
+18ea : 4a __ __ LSR
+18eb : 90 f7 __ BCC $18e4
+18ed : d0 d7 __ BNE $18c6
+18ef : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+18f0 : a5 1b __ LDA ACCU + 0
+18f2 : 05 1c __ ORA ACCU + 1
+18f4 : 05 1d __ ORA ACCU + 2
+18f6 : d0 03 __ BNE $18fb
+18f8 : 85 1e __ STA ACCU + 3
+18fa : 60 __ __ RTS
+18fb : a5 1e __ LDA ACCU + 3
+18fd : 45 06 __ EOR $06
+18ff : 29 80 __ AND #$80
+1901 : 85 1e __ STA ACCU + 3
+1903 : a9 00 __ LDA #$00
+1905 : 85 09 __ STA $09
+1907 : 85 0a __ STA $0a
+1909 : 85 0b __ STA $0b
+190b : a2 18 __ LDX #$18
+190d : a5 1b __ LDA ACCU + 0
+190f : c5 03 __ CMP $03
+1911 : a5 1c __ LDA ACCU + 1
+1913 : e5 04 __ SBC $04
+1915 : a5 1d __ LDA ACCU + 2
+1917 : e5 05 __ SBC $05
+1919 : 90 13 __ BCC $192e
+191b : a5 1b __ LDA ACCU + 0
+191d : e5 03 __ SBC $03
+191f : 85 1b __ STA ACCU + 0
+1921 : a5 1c __ LDA ACCU + 1
+1923 : e5 04 __ SBC $04
+1925 : 85 1c __ STA ACCU + 1
+1927 : a5 1d __ LDA ACCU + 2
+1929 : e5 05 __ SBC $05
+192b : 85 1d __ STA ACCU + 2
+192d : 38 __ __ SEC
+192e : 26 09 __ ROL $09
+1930 : 26 0a __ ROL $0a
+1932 : 26 0b __ ROL $0b
+1934 : ca __ __ DEX
+1935 : f0 0a __ BEQ $1941
+1937 : 06 1b __ ASL ACCU + 0
+1939 : 26 1c __ ROL ACCU + 1
+193b : 26 1d __ ROL ACCU + 2
+193d : b0 dc __ BCS $191b
+193f : 90 cc __ BCC $190d
+1941 : 38 __ __ SEC
+1942 : a5 0b __ LDA $0b
+1944 : 30 06 __ BMI $194c
+1946 : 06 09 __ ASL $09
+1948 : 26 0a __ ROL $0a
+194a : 2a __ __ ROL
+194b : 18 __ __ CLC
+194c : 29 7f __ AND #$7f
+194e : 85 0b __ STA $0b
+1950 : a5 08 __ LDA $08
+1952 : 49 7f __ EOR #$7f
+1954 : 65 07 __ ADC $07
+1956 : 38 __ __ SEC
+1957 : e9 01 __ SBC #$01
+1959 : 4a __ __ LSR
+195a : 05 1e __ ORA ACCU + 3
+195c : 85 1e __ STA ACCU + 3
+195e : a9 00 __ LDA #$00
+1960 : 6a __ __ ROR
+1961 : 05 0b __ ORA $0b
+1963 : 85 1d __ STA ACCU + 2
+1965 : a5 0a __ LDA $0a
+1967 : 85 1c __ STA ACCU + 1
+1969 : a5 09 __ LDA $09
+196b : 85 1b __ STA ACCU + 0
+196d : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+196e : 38 __ __ SEC
+196f : a9 00 __ LDA #$00
+1971 : e5 1b __ SBC ACCU + 0
+1973 : 85 1b __ STA ACCU + 0
+1975 : a9 00 __ LDA #$00
+1977 : e5 1c __ SBC ACCU + 1
+1979 : 85 1c __ STA ACCU + 1
+197b : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+197c : 38 __ __ SEC
+197d : a9 00 __ LDA #$00
+197f : e5 03 __ SBC $03
+1981 : 85 03 __ STA $03
+1983 : a9 00 __ LDA #$00
+1985 : e5 04 __ SBC $04
+1987 : 85 04 __ STA $04
+1989 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+198a : a5 1c __ LDA ACCU + 1
+198c : d0 31 __ BNE $19bf
+198e : a5 04 __ LDA $04
+1990 : d0 1e __ BNE $19b0
+1992 : 85 06 __ STA $06
+1994 : a2 04 __ LDX #$04
+1996 : 06 1b __ ASL ACCU + 0
+1998 : 2a __ __ ROL
+1999 : c5 03 __ CMP $03
+199b : 90 02 __ BCC $199f
+199d : e5 03 __ SBC $03
+199f : 26 1b __ ROL ACCU + 0
+19a1 : 2a __ __ ROL
+19a2 : c5 03 __ CMP $03
+19a4 : 90 02 __ BCC $19a8
+19a6 : e5 03 __ SBC $03
+19a8 : 26 1b __ ROL ACCU + 0
+19aa : ca __ __ DEX
+19ab : d0 eb __ BNE $1998
+19ad : 85 05 __ STA $05
+19af : 60 __ __ RTS
+19b0 : a5 1b __ LDA ACCU + 0
+19b2 : 85 05 __ STA $05
+19b4 : a5 1c __ LDA ACCU + 1
+19b6 : 85 06 __ STA $06
+19b8 : a9 00 __ LDA #$00
+19ba : 85 1b __ STA ACCU + 0
+19bc : 85 1c __ STA ACCU + 1
+19be : 60 __ __ RTS
+19bf : a5 04 __ LDA $04
+19c1 : d0 1f __ BNE $19e2
+19c3 : a5 03 __ LDA $03
+19c5 : 30 1b __ BMI $19e2
+19c7 : a9 00 __ LDA #$00
+19c9 : 85 06 __ STA $06
+19cb : a2 10 __ LDX #$10
+19cd : 06 1b __ ASL ACCU + 0
+19cf : 26 1c __ ROL ACCU + 1
+19d1 : 2a __ __ ROL
+19d2 : c5 03 __ CMP $03
+19d4 : 90 02 __ BCC $19d8
+19d6 : e5 03 __ SBC $03
+19d8 : 26 1b __ ROL ACCU + 0
+19da : 26 1c __ ROL ACCU + 1
+19dc : ca __ __ DEX
+19dd : d0 f2 __ BNE $19d1
+19df : 85 05 __ STA $05
+19e1 : 60 __ __ RTS
+19e2 : a9 00 __ LDA #$00
+19e4 : 85 05 __ STA $05
+19e6 : 85 06 __ STA $06
+19e8 : 84 02 __ STY $02
+19ea : a0 10 __ LDY #$10
+19ec : 18 __ __ CLC
+19ed : 26 1b __ ROL ACCU + 0
+19ef : 26 1c __ ROL ACCU + 1
+19f1 : 26 05 __ ROL $05
+19f3 : 26 06 __ ROL $06
+19f5 : 38 __ __ SEC
+19f6 : a5 05 __ LDA $05
+19f8 : e5 03 __ SBC $03
+19fa : aa __ __ TAX
+19fb : a5 06 __ LDA $06
+19fd : e5 04 __ SBC $04
+19ff : 90 04 __ BCC $1a05
+1a01 : 86 05 __ STX $05
+1a03 : 85 06 __ STA $06
+1a05 : 88 __ __ DEY
+1a06 : d0 e5 __ BNE $19ed
+1a08 : 26 1b __ ROL ACCU + 0
+1a0a : 26 1c __ ROL ACCU + 1
+1a0c : a4 02 __ LDY $02
+1a0e : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1a0f : 20 69 17 JSR $1769 ; (freg + 36)
+1a12 : a5 07 __ LDA $07
+1a14 : c9 7f __ CMP #$7f
+1a16 : b0 07 __ BCS $1a1f
+1a18 : a9 00 __ LDA #$00
+1a1a : 85 1b __ STA ACCU + 0
+1a1c : 85 1c __ STA ACCU + 1
+1a1e : 60 __ __ RTS
+1a1f : 38 __ __ SEC
+1a20 : e9 8e __ SBC #$8e
+1a22 : 90 0a __ BCC $1a2e
+1a24 : a9 ff __ LDA #$ff
+1a26 : 85 1b __ STA ACCU + 0
+1a28 : a9 7f __ LDA #$7f
+1a2a : 85 1c __ STA ACCU + 1
+1a2c : d0 08 __ BNE $1a36
+1a2e : aa __ __ TAX
+1a2f : 46 1d __ LSR ACCU + 2
+1a31 : 66 1c __ ROR ACCU + 1
+1a33 : e8 __ __ INX
+1a34 : d0 f9 __ BNE $1a2f
+1a36 : 24 1e __ BIT ACCU + 3
+1a38 : 10 0e __ BPL $1a48
+1a3a : 38 __ __ SEC
+1a3b : a9 00 __ LDA #$00
+1a3d : e5 1c __ SBC ACCU + 1
+1a3f : 85 1b __ STA ACCU + 0
+1a41 : a9 00 __ LDA #$00
+1a43 : e5 1d __ SBC ACCU + 2
+1a45 : 85 1c __ STA ACCU + 1
+1a47 : 60 __ __ RTS
+1a48 : a5 1c __ LDA ACCU + 1
+1a4a : 85 1b __ STA ACCU + 0
+1a4c : a5 1d __ LDA ACCU + 2
+1a4e : 85 1c __ STA ACCU + 1
+1a50 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1a51 : 24 1c __ BIT ACCU + 1
+1a53 : 30 03 __ BMI $1a58
+1a55 : 4c 6f 1a JMP $1a6f ; (uint16_to_float + 0)
+1a58 : 38 __ __ SEC
+1a59 : a9 00 __ LDA #$00
+1a5b : e5 1b __ SBC ACCU + 0
+1a5d : 85 1b __ STA ACCU + 0
+1a5f : a9 00 __ LDA #$00
+1a61 : e5 1c __ SBC ACCU + 1
+1a63 : 85 1c __ STA ACCU + 1
+1a65 : 20 6f 1a JSR $1a6f ; (uint16_to_float + 0)
+1a68 : a5 1e __ LDA ACCU + 3
+1a6a : 09 80 __ ORA #$80
+1a6c : 85 1e __ STA ACCU + 3
+1a6e : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1a6f : a5 1b __ LDA ACCU + 0
+1a71 : 05 1c __ ORA ACCU + 1
+1a73 : d0 05 __ BNE $1a7a
+1a75 : 85 1d __ STA ACCU + 2
+1a77 : 85 1e __ STA ACCU + 3
+1a79 : 60 __ __ RTS
+1a7a : a2 8e __ LDX #$8e
+1a7c : a5 1c __ LDA ACCU + 1
+1a7e : 30 06 __ BMI $1a86
+1a80 : ca __ __ DEX
+1a81 : 06 1b __ ASL ACCU + 0
+1a83 : 2a __ __ ROL
+1a84 : 10 fa __ BPL $1a80
+1a86 : 29 7f __ AND #$7f
+1a88 : 85 1d __ STA ACCU + 2
+1a8a : a5 1b __ LDA ACCU + 0
+1a8c : 85 1c __ STA ACCU + 1
+1a8e : 8a __ __ TXA
+1a8f : 4a __ __ LSR
+1a90 : 85 1e __ STA ACCU + 3
+1a92 : a9 00 __ LDA #$00
+1a94 : 85 1b __ STA ACCU + 0
+1a96 : 6a __ __ ROR
+1a97 : 05 1d __ ORA ACCU + 2
+1a99 : 85 1d __ STA ACCU + 2
+1a9b : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1a9c : 38 __ __ SEC
+1a9d : a9 00 __ LDA #$00
+1a9f : e5 1b __ SBC ACCU + 0
+1aa1 : 85 1b __ STA ACCU + 0
+1aa3 : a9 00 __ LDA #$00
+1aa5 : e5 1c __ SBC ACCU + 1
+1aa7 : 85 1c __ STA ACCU + 1
+1aa9 : a9 00 __ LDA #$00
+1aab : e5 1d __ SBC ACCU + 2
+1aad : 85 1d __ STA ACCU + 2
+1aaf : a9 00 __ LDA #$00
+1ab1 : e5 1e __ SBC ACCU + 3
+1ab3 : 85 1e __ STA ACCU + 3
+1ab5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1ab6 : 84 02 __ STY $02
+1ab8 : a9 00 __ LDA #$00
+1aba : 85 07 __ STA $07
+1abc : 85 08 __ STA $08
+1abe : 85 09 __ STA $09
+1ac0 : 85 0a __ STA $0a
+1ac2 : a0 20 __ LDY #$20
+1ac4 : 18 __ __ CLC
+1ac5 : 26 1b __ ROL ACCU + 0
+1ac7 : 26 1c __ ROL ACCU + 1
+1ac9 : 26 1d __ ROL ACCU + 2
+1acb : 26 1e __ ROL ACCU + 3
+1acd : 26 07 __ ROL $07
+1acf : 26 08 __ ROL $08
+1ad1 : 26 09 __ ROL $09
+1ad3 : 26 0a __ ROL $0a
+1ad5 : a5 07 __ LDA $07
+1ad7 : c5 03 __ CMP $03
+1ad9 : a5 08 __ LDA $08
+1adb : e5 04 __ SBC $04
+1add : a5 09 __ LDA $09
+1adf : e5 05 __ SBC $05
+1ae1 : a5 0a __ LDA $0a
+1ae3 : e5 06 __ SBC $06
+1ae5 : 90 18 __ BCC $1aff
+1ae7 : a5 07 __ LDA $07
+1ae9 : e5 03 __ SBC $03
+1aeb : 85 07 __ STA $07
+1aed : a5 08 __ LDA $08
+1aef : e5 04 __ SBC $04
+1af1 : 85 08 __ STA $08
+1af3 : a5 09 __ LDA $09
+1af5 : e5 05 __ SBC $05
+1af7 : 85 09 __ STA $09
+1af9 : a5 0a __ LDA $0a
+1afb : e5 06 __ SBC $06
+1afd : 85 0a __ STA $0a
+1aff : 88 __ __ DEY
+1b00 : d0 c3 __ BNE $1ac5
+1b02 : 26 1b __ ROL ACCU + 0
+1b04 : 26 1c __ ROL ACCU + 1
+1b06 : 26 1d __ ROL ACCU + 2
+1b08 : 26 1e __ ROL ACCU + 3
+1b0a : a4 02 __ LDY $02
+1b0c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1b0d : a9 00 __ LDA #$00
+1b0f : 85 1d __ STA ACCU + 2
+1b11 : 85 1e __ STA ACCU + 3
+1b13 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1b14 : b5 00 __ LDA $00,x
+1b16 : 85 03 __ STA $03
+1b18 : b5 01 __ LDA $01,x
+1b1a : 85 04 __ STA $04
+1b1c : b5 02 __ LDA $02,x
+1b1e : 85 05 __ STA $05
+1b20 : b5 03 __ LDA $03,x
+1b22 : 85 06 __ STA $06
+1b24 : 20 b6 1a JSR $1ab6 ; (divmod32 + 0)
+1b27 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1b28 : b5 00 __ LDA $00,x
+1b2a : 85 03 __ STA $03
+1b2c : b5 01 __ LDA $01,x
+1b2e : 85 04 __ STA $04
+1b30 : b5 02 __ LDA $02,x
+1b32 : 85 05 __ STA $05
+1b34 : b5 03 __ LDA $03,x
+1b36 : 85 06 __ STA $06
+1b38 : 20 b6 1a JSR $1ab6 ; (divmod32 + 0)
+1b3b : a5 07 __ LDA $07
+1b3d : 85 1b __ STA ACCU + 0
+1b3f : a5 08 __ LDA $08
+1b41 : 85 1c __ STA ACCU + 1
+1b43 : a5 09 __ LDA $09
+1b45 : 85 1d __ STA ACCU + 2
+1b47 : a5 0a __ LDA $0a
+1b49 : 85 1e __ STA ACCU + 3
+1b4b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1b4c : b5 03 __ LDA $03,x
+1b4e : c5 1e __ CMP ACCU + 3
+1b50 : d0 20 __ BNE $1b72
+1b52 : b5 02 __ LDA $02,x
+1b54 : c5 1d __ CMP ACCU + 2
+1b56 : d0 1a __ BNE $1b72
+1b58 : b5 01 __ LDA $01,x
+1b5a : c5 1c __ CMP ACCU + 1
+1b5c : d0 14 __ BNE $1b72
+1b5e : b5 00 __ LDA $00,x
+1b60 : c5 1b __ CMP ACCU + 0
+1b62 : d0 0e __ BNE $1b72
+1b64 : a9 00 __ LDA #$00
+1b66 : 85 1b __ STA ACCU + 0
+1b68 : 85 1c __ STA ACCU + 1
+1b6a : 60 __ __ RTS
+1b6b : a9 ff __ LDA #$ff
+1b6d : 85 1b __ STA ACCU + 0
+1b6f : 85 1c __ STA ACCU + 1
+1b71 : 60 __ __ RTS
+1b72 : 90 f7 __ BCC $1b6b
+1b74 : a9 01 __ LDA #$01
+1b76 : 85 1b __ STA ACCU + 0
+1b78 : a9 00 __ LDA #$00
+1b7a : 85 1c __ STA ACCU + 1
+1b7c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1b7d : a5 1e __ LDA ACCU + 3
+1b7f : 49 80 __ EOR #$80
+1b81 : 85 1e __ STA ACCU + 3
+1b83 : b5 03 __ LDA $03,x
+1b85 : 49 80 __ EOR #$80
+1b87 : c5 1e __ CMP ACCU + 3
+1b89 : d0 20 __ BNE $1bab
+1b8b : b5 02 __ LDA $02,x
+1b8d : c5 1d __ CMP ACCU + 2
+1b8f : d0 1a __ BNE $1bab
+1b91 : b5 01 __ LDA $01,x
+1b93 : c5 1c __ CMP ACCU + 1
+1b95 : d0 14 __ BNE $1bab
+1b97 : b5 00 __ LDA $00,x
+1b99 : c5 1b __ CMP ACCU + 0
+1b9b : d0 0e __ BNE $1bab
+1b9d : a9 00 __ LDA #$00
+1b9f : 85 1b __ STA ACCU + 0
+1ba1 : 85 1c __ STA ACCU + 1
+1ba3 : 60 __ __ RTS
+1ba4 : a9 ff __ LDA #$ff
+1ba6 : 85 1b __ STA ACCU + 0
+1ba8 : 85 1c __ STA ACCU + 1
+1baa : 60 __ __ RTS
+1bab : 90 f7 __ BCC $1ba4
+1bad : a9 01 __ LDA #$01
+1baf : 85 1b __ STA ACCU + 0
+1bb1 : a9 00 __ LDA #$00
+1bb3 : 85 1c __ STA ACCU + 1
+1bb5 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1bb6 : a9 4c __ LDA #$4c
+1bb8 : 85 54 __ STA $54
+1bba : a9 00 __ LDA #$00
+1bbc : 85 13 __ STA P6
+1bbe : a9 19 __ LDA #$19
+1bc0 : 85 16 __ STA P9
+1bc2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1bc3 : b1 19 __ LDA (IP + 0),y
+1bc5 : aa __ __ TAX
+1bc6 : c8 __ __ INY
+1bc7 : b1 19 __ LDA (IP + 0),y
+1bc9 : 95 00 __ STA $00,x
+1bcb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1bce : b1 19 __ LDA (IP + 0),y
+1bd0 : aa __ __ TAX
+1bd1 : c8 __ __ INY
+1bd2 : b1 19 __ LDA (IP + 0),y
+1bd4 : 95 00 __ STA $00,x
+1bd6 : a9 00 __ LDA #$00
+1bd8 : 95 01 __ STA $01,x
+1bda : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1bdd : b1 19 __ LDA (IP + 0),y
+1bdf : aa __ __ TAX
+1be0 : c8 __ __ INY
+1be1 : b1 19 __ LDA (IP + 0),y
+1be3 : 95 00 __ STA $00,x
+1be5 : a9 ff __ LDA #$ff
+1be7 : 95 01 __ STA $01,x
+1be9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1bec : b1 19 __ LDA (IP + 0),y
+1bee : aa __ __ TAX
+1bef : c8 __ __ INY
+1bf0 : b1 19 __ LDA (IP + 0),y
+1bf2 : 95 00 __ STA $00,x
+1bf4 : c8 __ __ INY
+1bf5 : b1 19 __ LDA (IP + 0),y
+1bf7 : 95 01 __ STA $01,x
+1bf9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1bfc : b1 19 __ LDA (IP + 0),y
+1bfe : aa __ __ TAX
+1bff : c8 __ __ INY
+1c00 : b1 19 __ LDA (IP + 0),y
+1c02 : 95 00 __ STA $00,x
+1c04 : c8 __ __ INY
+1c05 : b1 19 __ LDA (IP + 0),y
+1c07 : 95 01 __ STA $01,x
+1c09 : c8 __ __ INY
+1c0a : b1 19 __ LDA (IP + 0),y
+1c0c : 95 02 __ STA $02,x
+1c0e : c8 __ __ INY
+1c0f : b1 19 __ LDA (IP + 0),y
+1c11 : 95 03 __ STA $03,x
+1c13 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1c16 : b1 19 __ LDA (IP + 0),y
+1c18 : aa __ __ TAX
+1c19 : b5 00 __ LDA $00,x
+1c1b : 85 1b __ STA ACCU + 0
+1c1d : a9 00 __ LDA #$00
+1c1f : 85 1c __ STA ACCU + 1
+1c21 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1c24 : b1 19 __ LDA (IP + 0),y
+1c26 : aa __ __ TAX
+1c27 : a5 1b __ LDA ACCU + 0
+1c29 : 95 00 __ STA $00,x
+1c2b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1c2e : b1 19 __ LDA (IP + 0),y
+1c30 : aa __ __ TAX
+1c31 : b5 00 __ LDA $00,x
+1c33 : 85 1b __ STA ACCU + 0
+1c35 : b5 01 __ LDA $01,x
+1c37 : 85 1c __ STA ACCU + 1
+1c39 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1c3c : b1 19 __ LDA (IP + 0),y
+1c3e : aa __ __ TAX
+1c3f : a5 1b __ LDA ACCU + 0
+1c41 : 95 00 __ STA $00,x
+1c43 : a5 1c __ LDA ACCU + 1
+1c45 : 95 01 __ STA $01,x
+1c47 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1c4a : b1 19 __ LDA (IP + 0),y
+1c4c : aa __ __ TAX
+1c4d : b5 00 __ LDA $00,x
+1c4f : 85 1f __ STA ADDR + 0
+1c51 : b5 01 __ LDA $01,x
+1c53 : 85 20 __ STA ADDR + 1
+1c55 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1c58 : b1 19 __ LDA (IP + 0),y
+1c5a : aa __ __ TAX
+1c5b : b5 00 __ LDA $00,x
+1c5d : 85 1b __ STA ACCU + 0
+1c5f : b5 01 __ LDA $01,x
+1c61 : 85 1c __ STA ACCU + 1
+1c63 : b5 02 __ LDA $02,x
+1c65 : 85 1d __ STA ACCU + 2
+1c67 : b5 03 __ LDA $03,x
+1c69 : 85 1e __ STA ACCU + 3
+1c6b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1c6e : b1 19 __ LDA (IP + 0),y
+1c70 : aa __ __ TAX
+1c71 : a5 1b __ LDA ACCU + 0
+1c73 : 95 00 __ STA $00,x
+1c75 : a5 1c __ LDA ACCU + 1
+1c77 : 95 01 __ STA $01,x
+1c79 : a5 1d __ LDA ACCU + 2
+1c7b : 95 02 __ STA $02,x
+1c7d : a5 1e __ LDA ACCU + 3
+1c7f : 95 03 __ STA $03,x
+1c81 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1c84 : b1 19 __ LDA (IP + 0),y
+1c86 : 85 1f __ STA ADDR + 0
+1c88 : c8 __ __ INY
+1c89 : b1 19 __ LDA (IP + 0),y
+1c8b : 85 20 __ STA ADDR + 1
+1c8d : c8 __ __ INY
+1c8e : b1 19 __ LDA (IP + 0),y
+1c90 : aa __ __ TAX
+1c91 : 84 02 __ STY $02
+1c93 : a0 00 __ LDY #$00
+1c95 : b1 1f __ LDA (ADDR + 0),y
+1c97 : 95 00 __ STA $00,x
+1c99 : a9 00 __ LDA #$00
+1c9b : 95 01 __ STA $01,x
+1c9d : a4 02 __ LDY $02
+1c9f : 4c 50 08 JMP $0850 ; (startup + 79)
+1ca2 : b1 19 __ LDA (IP + 0),y
+1ca4 : aa __ __ TAX
+1ca5 : c8 __ __ INY
+1ca6 : b1 19 __ LDA (IP + 0),y
+1ca8 : 84 02 __ STY $02
+1caa : a8 __ __ TAY
+1cab : 4c 95 1c JMP $1c95 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1cae : b1 19 __ LDA (IP + 0),y
+1cb0 : aa __ __ TAX
+1cb1 : c8 __ __ INY
+1cb2 : b1 19 __ LDA (IP + 0),y
+1cb4 : 95 00 __ STA $00,x
+1cb6 : c8 __ __ INY
+1cb7 : b1 19 __ LDA (IP + 0),y
+1cb9 : 95 01 __ STA $01,x
+1cbb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+1cbe : b1 19 __ LDA (IP + 0),y
+1cc0 : aa __ __ TAX
+1cc1 : c8 __ __ INY
+1cc2 : 18 __ __ CLC
+1cc3 : b5 00 __ LDA $00,x
+1cc5 : 71 19 __ ADC (IP + 0),y
+1cc7 : 85 1f __ STA ADDR + 0
+1cc9 : c8 __ __ INY
+1cca : b5 01 __ LDA $01,x
+1ccc : 71 19 __ ADC (IP + 0),y
+1cce : 85 20 __ STA ADDR + 1
+1cd0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1cd3 : b1 19 __ LDA (IP + 0),y
+1cd5 : aa __ __ TAX
+1cd6 : 18 __ __ CLC
+1cd7 : b5 00 __ LDA $00,x
+1cd9 : 65 1b __ ADC ACCU + 0
+1cdb : 85 1f __ STA ADDR + 0
+1cdd : b5 01 __ LDA $01,x
+1cdf : 65 1c __ ADC ACCU + 1
+1ce1 : 85 20 __ STA ADDR + 1
+1ce3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1ce6 : b1 19 __ LDA (IP + 0),y
+1ce8 : aa __ __ TAX
+1ce9 : c8 __ __ INY
+1cea : b1 19 __ LDA (IP + 0),y
+1cec : 84 02 __ STY $02
+1cee : a8 __ __ TAY
+1cef : b1 25 __ LDA (FP + 0),y
+1cf1 : 95 00 __ STA $00,x
+1cf3 : a4 02 __ LDY $02
+1cf5 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1cf8 : b1 19 __ LDA (IP + 0),y
+1cfa : aa __ __ TAX
+1cfb : c8 __ __ INY
+1cfc : b1 19 __ LDA (IP + 0),y
+1cfe : 84 02 __ STY $02
+1d00 : a8 __ __ TAY
+1d01 : b1 25 __ LDA (FP + 0),y
+1d03 : 95 00 __ STA $00,x
+1d05 : a9 00 __ LDA #$00
+1d07 : 95 01 __ STA $01,x
+1d09 : a4 02 __ LDY $02
+1d0b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1d0e : b1 19 __ LDA (IP + 0),y
+1d10 : aa __ __ TAX
+1d11 : c8 __ __ INY
+1d12 : b1 19 __ LDA (IP + 0),y
+1d14 : 84 02 __ STY $02
+1d16 : a8 __ __ TAY
+1d17 : b1 25 __ LDA (FP + 0),y
+1d19 : 95 00 __ STA $00,x
+1d1b : c8 __ __ INY
+1d1c : b1 25 __ LDA (FP + 0),y
+1d1e : 95 01 __ STA $01,x
+1d20 : a4 02 __ LDY $02
+1d22 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1d25 : b1 19 __ LDA (IP + 0),y
+1d27 : aa __ __ TAX
+1d28 : c8 __ __ INY
+1d29 : b1 19 __ LDA (IP + 0),y
+1d2b : 84 02 __ STY $02
+1d2d : a8 __ __ TAY
+1d2e : b5 00 __ LDA $00,x
+1d30 : 91 25 __ STA (FP + 0),y
+1d32 : a4 02 __ LDY $02
+1d34 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1d37 : b1 19 __ LDA (IP + 0),y
+1d39 : aa __ __ TAX
+1d3a : c8 __ __ INY
+1d3b : b1 19 __ LDA (IP + 0),y
+1d3d : 84 02 __ STY $02
+1d3f : a8 __ __ TAY
+1d40 : b5 00 __ LDA $00,x
+1d42 : 91 25 __ STA (FP + 0),y
+1d44 : c8 __ __ INY
+1d45 : b5 01 __ LDA $01,x
+1d47 : 91 25 __ STA (FP + 0),y
+1d49 : a4 02 __ LDY $02
+1d4b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1d4e : b1 19 __ LDA (IP + 0),y
+1d50 : aa __ __ TAX
+1d51 : c8 __ __ INY
+1d52 : 18 __ __ CLC
+1d53 : b1 19 __ LDA (IP + 0),y
+1d55 : 65 25 __ ADC FP + 0
+1d57 : 95 00 __ STA $00,x
+1d59 : c8 __ __ INY
+1d5a : b1 19 __ LDA (IP + 0),y
+1d5c : 65 26 __ ADC FP + 1
+1d5e : 95 01 __ STA $01,x
+1d60 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1d63 : b1 19 __ LDA (IP + 0),y
+1d65 : aa __ __ TAX
+1d66 : c8 __ __ INY
+1d67 : b1 19 __ LDA (IP + 0),y
+1d69 : 84 02 __ STY $02
+1d6b : a8 __ __ TAY
+1d6c : b5 00 __ LDA $00,x
+1d6e : 91 23 __ STA (SP + 0),y
+1d70 : c8 __ __ INY
+1d71 : b5 01 __ LDA $01,x
+1d73 : 91 23 __ STA (SP + 0),y
+1d75 : a4 02 __ LDY $02
+1d77 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_32:
+1d7a : b1 19 __ LDA (IP + 0),y
+1d7c : aa __ __ TAX
+1d7d : c8 __ __ INY
+1d7e : b1 19 __ LDA (IP + 0),y
+1d80 : 84 02 __ STY $02
+1d82 : a8 __ __ TAY
+1d83 : b5 00 __ LDA $00,x
+1d85 : 91 23 __ STA (SP + 0),y
+1d87 : c8 __ __ INY
+1d88 : b5 01 __ LDA $01,x
+1d8a : 91 23 __ STA (SP + 0),y
+1d8c : c8 __ __ INY
+1d8d : b5 02 __ LDA $02,x
+1d8f : 91 23 __ STA (SP + 0),y
+1d91 : c8 __ __ INY
+1d92 : b5 03 __ LDA $03,x
+1d94 : 91 23 __ STA (SP + 0),y
+1d96 : a4 02 __ LDY $02
+1d98 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1d9b : b1 19 __ LDA (IP + 0),y
+1d9d : 85 1f __ STA ADDR + 0
+1d9f : c8 __ __ INY
+1da0 : b1 19 __ LDA (IP + 0),y
+1da2 : 85 20 __ STA ADDR + 1
+1da4 : c8 __ __ INY
+1da5 : b1 19 __ LDA (IP + 0),y
+1da7 : aa __ __ TAX
+1da8 : 84 02 __ STY $02
+1daa : a0 00 __ LDY #$00
+1dac : b1 1f __ LDA (ADDR + 0),y
+1dae : 95 00 __ STA $00,x
+1db0 : a4 02 __ LDY $02
+1db2 : 4c 50 08 JMP $0850 ; (startup + 79)
+1db5 : b1 19 __ LDA (IP + 0),y
+1db7 : aa __ __ TAX
+1db8 : c8 __ __ INY
+1db9 : b1 19 __ LDA (IP + 0),y
+1dbb : 84 02 __ STY $02
+1dbd : a8 __ __ TAY
+1dbe : 4c ac 1d JMP $1dac ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1dc1 : b1 19 __ LDA (IP + 0),y
+1dc3 : 85 1f __ STA ADDR + 0
+1dc5 : c8 __ __ INY
+1dc6 : b1 19 __ LDA (IP + 0),y
+1dc8 : 85 20 __ STA ADDR + 1
+1dca : c8 __ __ INY
+1dcb : b1 19 __ LDA (IP + 0),y
+1dcd : aa __ __ TAX
+1dce : 84 02 __ STY $02
+1dd0 : a0 00 __ LDY #$00
+1dd2 : b1 1f __ LDA (ADDR + 0),y
+1dd4 : 95 00 __ STA $00,x
+1dd6 : c8 __ __ INY
+1dd7 : b1 1f __ LDA (ADDR + 0),y
+1dd9 : 95 01 __ STA $01,x
+1ddb : a4 02 __ LDY $02
+1ddd : 4c 50 08 JMP $0850 ; (startup + 79)
+1de0 : b1 19 __ LDA (IP + 0),y
+1de2 : aa __ __ TAX
+1de3 : c8 __ __ INY
+1de4 : b1 19 __ LDA (IP + 0),y
+1de6 : 84 02 __ STY $02
+1de8 : a8 __ __ TAY
+1de9 : 4c d2 1d JMP $1dd2 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1dec : b1 19 __ LDA (IP + 0),y
+1dee : 85 1f __ STA ADDR + 0
+1df0 : c8 __ __ INY
+1df1 : b1 19 __ LDA (IP + 0),y
+1df3 : 85 20 __ STA ADDR + 1
+1df5 : c8 __ __ INY
+1df6 : b1 19 __ LDA (IP + 0),y
+1df8 : aa __ __ TAX
+1df9 : 84 02 __ STY $02
+1dfb : a0 00 __ LDY #$00
+1dfd : b1 1f __ LDA (ADDR + 0),y
+1dff : 95 00 __ STA $00,x
+1e01 : c8 __ __ INY
+1e02 : b1 1f __ LDA (ADDR + 0),y
+1e04 : 95 01 __ STA $01,x
+1e06 : c8 __ __ INY
+1e07 : b1 1f __ LDA (ADDR + 0),y
+1e09 : 95 02 __ STA $02,x
+1e0b : c8 __ __ INY
+1e0c : b1 1f __ LDA (ADDR + 0),y
+1e0e : 95 03 __ STA $03,x
+1e10 : a4 02 __ LDY $02
+1e12 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e15 : b1 19 __ LDA (IP + 0),y
+1e17 : aa __ __ TAX
+1e18 : c8 __ __ INY
+1e19 : b1 19 __ LDA (IP + 0),y
+1e1b : 84 02 __ STY $02
+1e1d : a8 __ __ TAY
+1e1e : 4c fd 1d JMP $1dfd ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1e21 : b1 19 __ LDA (IP + 0),y
+1e23 : 85 1f __ STA ADDR + 0
+1e25 : c8 __ __ INY
+1e26 : b1 19 __ LDA (IP + 0),y
+1e28 : 85 20 __ STA ADDR + 1
+1e2a : c8 __ __ INY
+1e2b : b1 19 __ LDA (IP + 0),y
+1e2d : aa __ __ TAX
+1e2e : 84 02 __ STY $02
+1e30 : a0 00 __ LDY #$00
+1e32 : b5 00 __ LDA $00,x
+1e34 : 91 1f __ STA (ADDR + 0),y
+1e36 : a4 02 __ LDY $02
+1e38 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e3b : b1 19 __ LDA (IP + 0),y
+1e3d : aa __ __ TAX
+1e3e : c8 __ __ INY
+1e3f : b1 19 __ LDA (IP + 0),y
+1e41 : 84 02 __ STY $02
+1e43 : a8 __ __ TAY
+1e44 : 4c 32 1e JMP $1e32 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1e47 : b1 19 __ LDA (IP + 0),y
+1e49 : aa __ __ TAX
+1e4a : 18 __ __ CLC
+1e4b : a5 1b __ LDA ACCU + 0
+1e4d : 75 00 __ ADC $00,x
+1e4f : 85 1b __ STA ACCU + 0
+1e51 : a5 1c __ LDA ACCU + 1
+1e53 : 75 01 __ ADC $01,x
+1e55 : 85 1c __ STA ACCU + 1
+1e57 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1e5a : b1 19 __ LDA (IP + 0),y
+1e5c : aa __ __ TAX
+1e5d : 38 __ __ SEC
+1e5e : a5 1b __ LDA ACCU + 0
+1e60 : f5 00 __ SBC $00,x
+1e62 : 85 1b __ STA ACCU + 0
+1e64 : a5 1c __ LDA ACCU + 1
+1e66 : f5 01 __ SBC $01,x
+1e68 : 85 1c __ STA ACCU + 1
+1e6a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_mulr_16:
+1e6d : b1 19 __ LDA (IP + 0),y
+1e6f : aa __ __ TAX
+1e70 : a9 00 __ LDA #$00
+1e72 : 85 05 __ STA $05
+1e74 : 85 06 __ STA $06
+1e76 : b5 00 __ LDA $00,x
+1e78 : 85 03 __ STA $03
+1e7a : b5 01 __ LDA $01,x
+1e7c : 85 04 __ STA $04
+1e7e : a2 10 __ LDX #$10
+1e80 : 46 04 __ LSR $04
+1e82 : 66 03 __ ROR $03
+1e84 : 90 0d __ BCC $1e93
+1e86 : 18 __ __ CLC
+1e87 : a5 05 __ LDA $05
+1e89 : 65 1b __ ADC ACCU + 0
+1e8b : 85 05 __ STA $05
+1e8d : a5 06 __ LDA $06
+1e8f : 65 1c __ ADC ACCU + 1
+1e91 : 85 06 __ STA $06
+1e93 : 06 1b __ ASL ACCU + 0
+1e95 : 26 1c __ ROL ACCU + 1
+1e97 : ca __ __ DEX
+1e98 : d0 e6 __ BNE $1e80
+1e9a : a5 05 __ LDA $05
+1e9c : 85 1b __ STA ACCU + 0
+1e9e : a5 06 __ LDA $06
+1ea0 : 85 1c __ STA ACCU + 1
+1ea2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1ea5 : b1 19 __ LDA (IP + 0),y
+1ea7 : aa __ __ TAX
+1ea8 : b5 00 __ LDA $00,x
+1eaa : 85 03 __ STA $03
+1eac : b5 01 __ LDA $01,x
+1eae : 85 04 __ STA $04
+1eb0 : 20 8a 19 JSR $198a ; (divmod + 0)
+1eb3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1eb6 : b1 19 __ LDA (IP + 0),y
+1eb8 : aa __ __ TAX
+1eb9 : b5 00 __ LDA $00,x
+1ebb : 85 03 __ STA $03
+1ebd : b5 01 __ LDA $01,x
+1ebf : 85 04 __ STA $04
+1ec1 : 20 8a 19 JSR $198a ; (divmod + 0)
+1ec4 : a5 05 __ LDA $05
+1ec6 : 85 1b __ STA ACCU + 0
+1ec8 : a5 06 __ LDA $06
+1eca : 85 1c __ STA ACCU + 1
+1ecc : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1ecf : b1 19 __ LDA (IP + 0),y
+1ed1 : aa __ __ TAX
+1ed2 : b5 00 __ LDA $00,x
+1ed4 : 85 03 __ STA $03
+1ed6 : b5 01 __ LDA $01,x
+1ed8 : 85 04 __ STA $04
+1eda : 24 1c __ BIT ACCU + 1
+1edc : 10 10 __ BPL $1eee
+1ede : 20 6e 19 JSR $196e ; (negaccu + 0)
+1ee1 : 24 04 __ BIT $04
+1ee3 : 10 10 __ BPL $1ef5
+1ee5 : 20 7c 19 JSR $197c ; (negtmp + 0)
+1ee8 : 20 8a 19 JSR $198a ; (divmod + 0)
+1eeb : 4c 50 08 JMP $0850 ; (startup + 79)
+1eee : 24 04 __ BIT $04
+1ef0 : 10 f6 __ BPL $1ee8
+1ef2 : 20 7c 19 JSR $197c ; (negtmp + 0)
+1ef5 : 20 8a 19 JSR $198a ; (divmod + 0)
+1ef8 : 20 6e 19 JSR $196e ; (negaccu + 0)
+1efb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1efe : b1 19 __ LDA (IP + 0),y
+1f00 : aa __ __ TAX
+1f01 : b5 00 __ LDA $00,x
+1f03 : 85 03 __ STA $03
+1f05 : b5 01 __ LDA $01,x
+1f07 : 85 04 __ STA $04
+1f09 : 24 1c __ BIT ACCU + 1
+1f0b : 10 18 __ BPL $1f25
+1f0d : 20 6e 19 JSR $196e ; (negaccu + 0)
+1f10 : 24 04 __ BIT $04
+1f12 : 10 18 __ BPL $1f2c
+1f14 : 20 7c 19 JSR $197c ; (negtmp + 0)
+1f17 : 20 8a 19 JSR $198a ; (divmod + 0)
+1f1a : a5 05 __ LDA $05
+1f1c : 85 1b __ STA ACCU + 0
+1f1e : a5 06 __ LDA $06
+1f20 : 85 1c __ STA ACCU + 1
+1f22 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f25 : 24 04 __ BIT $04
+1f27 : 10 ee __ BPL $1f17
+1f29 : 20 7c 19 JSR $197c ; (negtmp + 0)
+1f2c : 20 8a 19 JSR $198a ; (divmod + 0)
+1f2f : a5 05 __ LDA $05
+1f31 : 85 1b __ STA ACCU + 0
+1f33 : a5 06 __ LDA $06
+1f35 : 85 1c __ STA ACCU + 1
+1f37 : 20 6e 19 JSR $196e ; (negaccu + 0)
+1f3a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1f3d : b1 19 __ LDA (IP + 0),y
+1f3f : aa __ __ TAX
+1f40 : 18 __ __ CLC
+1f41 : b5 00 __ LDA $00,x
+1f43 : 65 1b __ ADC ACCU + 0
+1f45 : 95 00 __ STA $00,x
+1f47 : b5 01 __ LDA $01,x
+1f49 : 65 1c __ ADC ACCU + 1
+1f4b : 95 01 __ STA $01,x
+1f4d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1f50 : b1 19 __ LDA (IP + 0),y
+1f52 : c8 __ __ INY
+1f53 : aa __ __ TAX
+1f54 : 18 __ __ CLC
+1f55 : b5 00 __ LDA $00,x
+1f57 : 71 19 __ ADC (IP + 0),y
+1f59 : c8 __ __ INY
+1f5a : 95 00 __ STA $00,x
+1f5c : b5 01 __ LDA $01,x
+1f5e : 71 19 __ ADC (IP + 0),y
+1f60 : 95 01 __ STA $01,x
+1f62 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1f65 : b1 19 __ LDA (IP + 0),y
+1f67 : c8 __ __ INY
+1f68 : aa __ __ TAX
+1f69 : 38 __ __ SEC
+1f6a : b1 19 __ LDA (IP + 0),y
+1f6c : c8 __ __ INY
+1f6d : f5 00 __ SBC $00,x
+1f6f : 95 00 __ STA $00,x
+1f71 : b1 19 __ LDA (IP + 0),y
+1f73 : f5 01 __ SBC $01,x
+1f75 : 95 01 __ STA $01,x
+1f77 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1f7a : b1 19 __ LDA (IP + 0),y
+1f7c : c8 __ __ INY
+1f7d : aa __ __ TAX
+1f7e : b5 00 __ LDA $00,x
+1f80 : 31 19 __ AND (IP + 0),y
+1f82 : c8 __ __ INY
+1f83 : 95 00 __ STA $00,x
+1f85 : b5 01 __ LDA $01,x
+1f87 : 31 19 __ AND (IP + 0),y
+1f89 : 95 01 __ STA $01,x
+1f8b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1f8e : b1 19 __ LDA (IP + 0),y
+1f90 : c8 __ __ INY
+1f91 : aa __ __ TAX
+1f92 : a9 00 __ LDA #$00
+1f94 : 85 05 __ STA $05
+1f96 : 85 06 __ STA $06
+1f98 : b5 00 __ LDA $00,x
+1f9a : 85 03 __ STA $03
+1f9c : b5 01 __ LDA $01,x
+1f9e : 85 04 __ STA $04
+1fa0 : b1 19 __ LDA (IP + 0),y
+1fa2 : 4a __ __ LSR
+1fa3 : 85 07 __ STA $07
+1fa5 : 90 0d __ BCC $1fb4
+1fa7 : 18 __ __ CLC
+1fa8 : a5 05 __ LDA $05
+1faa : 65 03 __ ADC $03
+1fac : 85 05 __ STA $05
+1fae : a5 06 __ LDA $06
+1fb0 : 65 04 __ ADC $04
+1fb2 : 85 06 __ STA $06
+1fb4 : 06 03 __ ASL $03
+1fb6 : 26 04 __ ROL $04
+1fb8 : 46 07 __ LSR $07
+1fba : b0 eb __ BCS $1fa7
+1fbc : d0 f6 __ BNE $1fb4
+1fbe : a5 05 __ LDA $05
+1fc0 : 95 00 __ STA $00,x
+1fc2 : a5 06 __ LDA $06
+1fc4 : 95 01 __ STA $01,x
+1fc6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+1fc9 : b1 19 __ LDA (IP + 0),y
+1fcb : c8 __ __ INY
+1fcc : aa __ __ TAX
+1fcd : 18 __ __ CLC
+1fce : b5 00 __ LDA $00,x
+1fd0 : 71 19 __ ADC (IP + 0),y
+1fd2 : 95 00 __ STA $00,x
+1fd4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+1fd7 : b1 19 __ LDA (IP + 0),y
+1fd9 : aa __ __ TAX
+1fda : 38 __ __ SEC
+1fdb : b5 01 __ LDA $01,x
+1fdd : e5 1c __ SBC ACCU + 1
+1fdf : f0 11 __ BEQ $1ff2
+1fe1 : 50 02 __ BVC $1fe5
+1fe3 : 49 80 __ EOR #$80
+1fe5 : 30 2a __ BMI $2011
+1fe7 : 10 33 __ BPL $201c
+1fe9 : b1 19 __ LDA (IP + 0),y
+1feb : aa __ __ TAX
+1fec : b5 01 __ LDA $01,x
+1fee : c5 1c __ CMP ACCU + 1
+1ff0 : d0 28 __ BNE $201a
+1ff2 : b5 00 __ LDA $00,x
+1ff4 : c5 1b __ CMP ACCU + 0
+1ff6 : d0 22 __ BNE $201a
+1ff8 : f0 0e __ BEQ $2008
+1ffa : b1 19 __ LDA (IP + 0),y
+1ffc : aa __ __ TAX
+1ffd : c8 __ __ INY
+1ffe : b1 19 __ LDA (IP + 0),y
+2000 : c5 1c __ CMP ACCU + 1
+2002 : d0 16 __ BNE $201a
+2004 : e4 1b __ CPX ACCU + 0
+2006 : d0 12 __ BNE $201a
+2008 : a9 00 __ LDA #$00
+200a : 85 1b __ STA ACCU + 0
+200c : 85 1c __ STA ACCU + 1
+200e : 4c 50 08 JMP $0850 ; (startup + 79)
+2011 : a9 ff __ LDA #$ff
+2013 : 85 1b __ STA ACCU + 0
+2015 : 85 1c __ STA ACCU + 1
+2017 : 4c 50 08 JMP $0850 ; (startup + 79)
+201a : 90 f5 __ BCC $2011
+201c : a9 01 __ LDA #$01
+201e : 85 1b __ STA ACCU + 0
+2020 : a9 00 __ LDA #$00
+2022 : 85 1c __ STA ACCU + 1
+2024 : 4c 50 08 JMP $0850 ; (startup + 79)
+2027 : b1 19 __ LDA (IP + 0),y
+2029 : c8 __ __ INY
+202a : aa __ __ TAX
+202b : b1 19 __ LDA (IP + 0),y
+202d : 38 __ __ SEC
+202e : e5 1c __ SBC ACCU + 1
+2030 : d0 af __ BNE $1fe1
+2032 : e4 1b __ CPX ACCU + 0
+2034 : d0 e4 __ BNE $201a
+2036 : f0 d0 __ BEQ $2008
+2038 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+2039 : b1 19 __ LDA (IP + 0),y
+203b : aa __ __ TAX
+203c : 38 __ __ SEC
+203d : b5 00 __ LDA $00,x
+203f : e5 1b __ SBC ACCU + 0
+2041 : f0 19 __ BEQ $205c
+2043 : 50 02 __ BVC $2047
+2045 : 49 80 __ EOR #$80
+2047 : 30 1c __ BMI $2065
+2049 : 10 25 __ BPL $2070
+204b : b1 19 __ LDA (IP + 0),y
+204d : aa __ __ TAX
+204e : b5 00 __ LDA $00,x
+2050 : c5 1b __ CMP ACCU + 0
+2052 : d0 1a __ BNE $206e
+2054 : f0 06 __ BEQ $205c
+2056 : b1 19 __ LDA (IP + 0),y
+2058 : c5 1b __ CMP ACCU + 0
+205a : d0 12 __ BNE $206e
+205c : a9 00 __ LDA #$00
+205e : 85 1b __ STA ACCU + 0
+2060 : 85 1c __ STA ACCU + 1
+2062 : 4c 50 08 JMP $0850 ; (startup + 79)
+2065 : a9 ff __ LDA #$ff
+2067 : 85 1b __ STA ACCU + 0
+2069 : 85 1c __ STA ACCU + 1
+206b : 4c 50 08 JMP $0850 ; (startup + 79)
+206e : 90 f5 __ BCC $2065
+2070 : a9 01 __ LDA #$01
+2072 : 85 1b __ STA ACCU + 0
+2074 : a9 00 __ LDA #$00
+2076 : 85 1c __ STA ACCU + 1
+2078 : 4c 50 08 JMP $0850 ; (startup + 79)
+207b : b1 19 __ LDA (IP + 0),y
+207d : 38 __ __ SEC
+207e : e5 1b __ SBC ACCU + 0
+2080 : d0 c1 __ BNE $2043
+2082 : f0 d8 __ BEQ $205c
+2084 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+2085 : 38 __ __ SEC
+2086 : a9 00 __ LDA #$00
+2088 : e5 1b __ SBC ACCU + 0
+208a : 85 1b __ STA ACCU + 0
+208c : a9 00 __ LDA #$00
+208e : e5 1c __ SBC ACCU + 1
+2090 : 85 1c __ STA ACCU + 1
+2092 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+2095 : 20 45 17 JSR $1745 ; (freg + 0)
+2098 : 20 8a 17 JSR $178a ; (faddsub + 0)
+209b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+209e : 20 45 17 JSR $1745 ; (freg + 0)
+20a1 : a5 06 __ LDA $06
+20a3 : 49 80 __ EOR #$80
+20a5 : 85 06 __ STA $06
+20a7 : 20 8a 17 JSR $178a ; (faddsub + 0)
+20aa : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+20ad : 20 45 17 JSR $1745 ; (freg + 0)
+20b0 : 84 02 __ STY $02
+20b2 : 20 52 18 JSR $1852 ; (fmul + 0)
+20b5 : a4 02 __ LDY $02
+20b7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+20ba : 20 45 17 JSR $1745 ; (freg + 0)
+20bd : 20 f0 18 JSR $18f0 ; (fdiv + 0)
+20c0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+20c3 : b1 19 __ LDA (IP + 0),y
+20c5 : c8 __ __ INY
+20c6 : aa __ __ TAX
+20c7 : a5 1e __ LDA ACCU + 3
+20c9 : 55 03 __ EOR $03,x
+20cb : 29 80 __ AND #$80
+20cd : f0 1e __ BEQ $20ed
+20cf : a5 1e __ LDA ACCU + 3
+20d1 : 29 7f __ AND #$7f
+20d3 : 05 1d __ ORA ACCU + 2
+20d5 : 05 1c __ ORA ACCU + 1
+20d7 : 05 1b __ ORA ACCU + 0
+20d9 : d0 0c __ BNE $20e7
+20db : b5 03 __ LDA $03,x
+20dd : 29 7f __ AND #$7f
+20df : 15 02 __ ORA $02,x
+20e1 : 15 01 __ ORA $01,x
+20e3 : 15 00 __ ORA $00,x
+20e5 : f0 1e __ BEQ $2105
+20e7 : a5 1e __ LDA ACCU + 3
+20e9 : 30 29 __ BMI $2114
+20eb : 10 36 __ BPL $2123
+20ed : a5 1e __ LDA ACCU + 3
+20ef : d5 03 __ CMP $03,x
+20f1 : d0 1b __ BNE $210e
+20f3 : a5 1d __ LDA ACCU + 2
+20f5 : d5 02 __ CMP $02,x
+20f7 : d0 15 __ BNE $210e
+20f9 : a5 1c __ LDA ACCU + 1
+20fb : d5 01 __ CMP $01,x
+20fd : d0 0f __ BNE $210e
+20ff : a5 1b __ LDA ACCU + 0
+2101 : d5 00 __ CMP $00,x
+2103 : d0 09 __ BNE $210e
+2105 : a9 00 __ LDA #$00
+2107 : 85 1b __ STA ACCU + 0
+2109 : 85 1c __ STA ACCU + 1
+210b : 4c 51 08 JMP $0851 ; (startup + 80)
+210e : b0 0f __ BCS $211f
+2110 : 24 1e __ BIT ACCU + 3
+2112 : 30 0f __ BMI $2123
+2114 : a9 00 __ LDA #$00
+2116 : 85 1c __ STA ACCU + 1
+2118 : a9 01 __ LDA #$01
+211a : 85 1b __ STA ACCU + 0
+211c : 4c 51 08 JMP $0851 ; (startup + 80)
+211f : 24 1e __ BIT ACCU + 3
+2121 : 30 f1 __ BMI $2114
+2123 : a9 ff __ LDA #$ff
+2125 : 85 1b __ STA ACCU + 0
+2127 : 85 1c __ STA ACCU + 1
+2129 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+212c : a5 1e __ LDA ACCU + 3
+212e : 49 80 __ EOR #$80
+2130 : 85 1e __ STA ACCU + 3
+2132 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+2135 : 20 51 1a JSR $1a51 ; (sint16_to_float + 0)
+2138 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+213b : 20 0f 1a JSR $1a0f ; (f32_to_i16 + 0)
+213e : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+2141 : b1 19 __ LDA (IP + 0),y
+2143 : 30 0c __ BMI $2151
+2145 : 38 __ __ SEC
+2146 : 65 19 __ ADC IP + 0
+2148 : 85 19 __ STA IP + 0
+214a : 90 02 __ BCC $214e
+214c : e6 1a __ INC IP + 1
+214e : 4c 51 08 JMP $0851 ; (startup + 80)
+2151 : 38 __ __ SEC
+2152 : 65 19 __ ADC IP + 0
+2154 : 85 19 __ STA IP + 0
+2156 : b0 02 __ BCS $215a
+2158 : c6 1a __ DEC IP + 1
+215a : 4c 51 08 JMP $0851 ; (startup + 80)
+215d : a5 1b __ LDA ACCU + 0
+215f : 05 1c __ ORA ACCU + 1
+2161 : f0 de __ BEQ $2141
+2163 : 4c 50 08 JMP $0850 ; (startup + 79)
+2166 : a5 1b __ LDA ACCU + 0
+2168 : 05 1c __ ORA ACCU + 1
+216a : d0 d5 __ BNE $2141
+216c : 4c 50 08 JMP $0850 ; (startup + 79)
+216f : a5 1c __ LDA ACCU + 1
+2171 : 30 04 __ BMI $2177
+2173 : 05 1b __ ORA ACCU + 0
+2175 : d0 ca __ BNE $2141
+2177 : 4c 50 08 JMP $0850 ; (startup + 79)
+217a : a5 1c __ LDA ACCU + 1
+217c : 10 c3 __ BPL $2141
+217e : 4c 50 08 JMP $0850 ; (startup + 79)
+2181 : a5 1c __ LDA ACCU + 1
+2183 : 30 bc __ BMI $2141
+2185 : 4c 50 08 JMP $0850 ; (startup + 79)
+2188 : a5 1c __ LDA ACCU + 1
+218a : 30 b5 __ BMI $2141
+218c : 05 1b __ ORA ACCU + 0
+218e : f0 b1 __ BEQ $2141
+2190 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+2193 : 38 __ __ SEC
+2194 : b1 19 __ LDA (IP + 0),y
+2196 : 65 19 __ ADC IP + 0
+2198 : aa __ __ TAX
+2199 : c8 __ __ INY
+219a : b1 19 __ LDA (IP + 0),y
+219c : 65 1a __ ADC IP + 1
+219e : 85 1a __ STA IP + 1
+21a0 : 86 19 __ STX IP + 0
+21a2 : 4c 51 08 JMP $0851 ; (startup + 80)
+21a5 : a5 1b __ LDA ACCU + 0
+21a7 : 05 1c __ ORA ACCU + 1
+21a9 : f0 e8 __ BEQ $2193
+21ab : c8 __ __ INY
+21ac : 4c 50 08 JMP $0850 ; (startup + 79)
+21af : a5 1b __ LDA ACCU + 0
+21b1 : 05 1c __ ORA ACCU + 1
+21b3 : d0 de __ BNE $2193
+21b5 : c8 __ __ INY
+21b6 : 4c 50 08 JMP $0850 ; (startup + 79)
+21b9 : a5 1c __ LDA ACCU + 1
+21bb : 30 04 __ BMI $21c1
+21bd : 05 1b __ ORA ACCU + 0
+21bf : d0 d2 __ BNE $2193
+21c1 : c8 __ __ INY
+21c2 : 4c 50 08 JMP $0850 ; (startup + 79)
+21c5 : a5 1c __ LDA ACCU + 1
+21c7 : 10 ca __ BPL $2193
+21c9 : c8 __ __ INY
+21ca : 4c 50 08 JMP $0850 ; (startup + 79)
+21cd : a5 1c __ LDA ACCU + 1
+21cf : 30 c2 __ BMI $2193
+21d1 : c8 __ __ INY
+21d2 : 4c 50 08 JMP $0850 ; (startup + 79)
+21d5 : a5 1c __ LDA ACCU + 1
+21d7 : 30 ba __ BMI $2193
+21d9 : 05 1b __ ORA ACCU + 0
+21db : f0 b6 __ BEQ $2193
+21dd : c8 __ __ INY
+21de : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+21e1 : a9 00 __ LDA #$00
+21e3 : 2c a9 01 BIT $01a9 
+21e6 : 85 1b __ STA ACCU + 0
+21e8 : a9 00 __ LDA #$00
+21ea : 85 1c __ STA ACCU + 1
+21ec : 4c 51 08 JMP $0851 ; (startup + 80)
+21ef : a5 1b __ LDA ACCU + 0
+21f1 : 05 1c __ ORA ACCU + 1
+21f3 : f0 ef __ BEQ $21e4
+21f5 : d0 ea __ BNE $21e1
+21f7 : a5 1b __ LDA ACCU + 0
+21f9 : 05 1c __ ORA ACCU + 1
+21fb : d0 e7 __ BNE $21e4
+21fd : f0 e2 __ BEQ $21e1
+21ff : a5 1c __ LDA ACCU + 1
+2201 : 30 de __ BMI $21e1
+2203 : 05 1b __ ORA ACCU + 0
+2205 : d0 dd __ BNE $21e4
+2207 : f0 d8 __ BEQ $21e1
+2209 : a5 1c __ LDA ACCU + 1
+220b : 10 d7 __ BPL $21e4
+220d : 30 d2 __ BMI $21e1
+220f : a5 1c __ LDA ACCU + 1
+2211 : 30 d1 __ BMI $21e4
+2213 : 10 cc __ BPL $21e1
+2215 : a5 1c __ LDA ACCU + 1
+2217 : 30 cb __ BMI $21e4
+2219 : 05 1b __ ORA ACCU + 0
+221b : f0 c7 __ BEQ $21e4
+221d : d0 c2 __ BNE $21e1
+221f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+2220 : b1 19 __ LDA (IP + 0),y
+2222 : 8d 36 22 STA $2236 ; (inp_jsr + 22)
+2225 : c8 __ __ INY
+2226 : b1 19 __ LDA (IP + 0),y
+2228 : 8d 37 22 STA $2237 ; (inp_jsr + 23)
+222b : 98 __ __ TYA
+222c : 38 __ __ SEC
+222d : 65 19 __ ADC IP + 0
+222f : 85 19 __ STA IP + 0
+2231 : 90 02 __ BCC $2235
+2233 : e6 1a __ INC IP + 1
+2235 : 20 00 00 JSR $0000 
+2238 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+223b : 98 __ __ TYA
+223c : 18 __ __ CLC
+223d : 65 19 __ ADC IP + 0
+223f : 8d 4a 22 STA $224a ; (inp_native + 15)
+2242 : a5 1a __ LDA IP + 1
+2244 : 69 00 __ ADC #$00
+2246 : 8d 4b 22 STA $224b ; (inp_native + 16)
+2249 : 20 00 00 JSR $0000 
+224c : a0 00 __ LDY #$00
+224e : b1 23 __ LDA (SP + 0),y
+2250 : 85 19 __ STA IP + 0
+2252 : c8 __ __ INY
+2253 : b1 23 __ LDA (SP + 0),y
+2255 : 85 1a __ STA IP + 1
+2257 : 88 __ __ DEY
+2258 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+225b : 38 __ __ SEC
+225c : a5 23 __ LDA SP + 0
+225e : f1 19 __ SBC (IP + 0),y
+2260 : c8 __ __ INY
+2261 : 85 23 __ STA SP + 0
+2263 : a5 24 __ LDA SP + 1
+2265 : f1 19 __ SBC (IP + 0),y
+2267 : c8 __ __ INY
+2268 : 85 24 __ STA SP + 1
+226a : b1 19 __ LDA (IP + 0),y
+226c : 84 02 __ STY $02
+226e : a8 __ __ TAY
+226f : a5 25 __ LDA FP + 0
+2271 : 91 23 __ STA (SP + 0),y
+2273 : c8 __ __ INY
+2274 : a5 26 __ LDA FP + 1
+2276 : 91 23 __ STA (SP + 0),y
+2278 : 98 __ __ TYA
+2279 : 38 __ __ SEC
+227a : 65 23 __ ADC SP + 0
+227c : 85 25 __ STA FP + 0
+227e : a9 00 __ LDA #$00
+2280 : 65 24 __ ADC SP + 1
+2282 : 85 26 __ STA FP + 1
+2284 : 88 __ __ DEY
+2285 : f0 08 __ BEQ $228f
+2287 : b9 52 00 LDA $0052,y 
+228a : 88 __ __ DEY
+228b : 91 23 __ STA (SP + 0),y
+228d : d0 f8 __ BNE $2287
+228f : a4 02 __ LDY $02
+2291 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+2294 : b1 19 __ LDA (IP + 0),y
+2296 : c8 __ __ INY
+2297 : 84 02 __ STY $02
+2299 : a8 __ __ TAY
+229a : b1 23 __ LDA (SP + 0),y
+229c : 85 25 __ STA FP + 0
+229e : c8 __ __ INY
+229f : b1 23 __ LDA (SP + 0),y
+22a1 : 85 26 __ STA FP + 1
+22a3 : 88 __ __ DEY
+22a4 : f0 09 __ BEQ $22af
+22a6 : 88 __ __ DEY
+22a7 : b1 23 __ LDA (SP + 0),y
+22a9 : 99 53 00 STA $0053,y 
+22ac : 88 __ __ DEY
+22ad : 10 f8 __ BPL $22a7
+22af : a4 02 __ LDY $02
+22b1 : 18 __ __ CLC
+22b2 : b1 19 __ LDA (IP + 0),y
+22b4 : c8 __ __ INY
+22b5 : 65 23 __ ADC SP + 0
+22b7 : 85 23 __ STA SP + 0
+22b9 : b1 19 __ LDA (IP + 0),y
+22bb : c8 __ __ INY
+22bc : 65 24 __ ADC SP + 1
+22be : 85 24 __ STA SP + 1
+22c0 : a0 01 __ LDY #$01
+22c2 : b1 23 __ LDA (SP + 0),y
+22c4 : 85 1a __ STA IP + 1
+22c6 : 88 __ __ DEY
+22c7 : b1 23 __ LDA (SP + 0),y
+22c9 : 85 19 __ STA IP + 0
+22cb : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+22ce : b1 19 __ LDA (IP + 0),y
+22d0 : 85 1f __ STA ADDR + 0
+22d2 : c8 __ __ INY
+22d3 : b1 19 __ LDA (IP + 0),y
+22d5 : 85 20 __ STA ADDR + 1
+22d7 : c8 __ __ INY
+22d8 : 98 __ __ TYA
+22d9 : a0 00 __ LDY #$00
+22db : 18 __ __ CLC
+22dc : 65 19 __ ADC IP + 0
+22de : 91 23 __ STA (SP + 0),y
+22e0 : c8 __ __ INY
+22e1 : a5 1a __ LDA IP + 1
+22e3 : 69 00 __ ADC #$00
+22e5 : 91 23 __ STA (SP + 0),y
+22e7 : a5 1f __ LDA ADDR + 0
+22e9 : 85 19 __ STA IP + 0
+22eb : a5 20 __ LDA ADDR + 1
+22ed : 85 1a __ STA IP + 1
+22ef : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+22f2 : 38 __ __ SEC
+22f3 : a5 23 __ LDA SP + 0
+22f5 : f1 19 __ SBC (IP + 0),y
+22f7 : c8 __ __ INY
+22f8 : 85 23 __ STA SP + 0
+22fa : a5 24 __ LDA SP + 1
+22fc : f1 19 __ SBC (IP + 0),y
+22fe : 85 24 __ STA SP + 1
+2300 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2303 : 18 __ __ CLC
+2304 : b1 19 __ LDA (IP + 0),y
+2306 : c8 __ __ INY
+2307 : 65 23 __ ADC SP + 0
+2309 : 85 23 __ STA SP + 0
+230b : b1 19 __ LDA (IP + 0),y
+230d : 65 24 __ ADC SP + 1
+230f : 85 24 __ STA SP + 1
+2311 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+2314 : b1 19 __ LDA (IP + 0),y
+2316 : c8 __ __ INY
+2317 : 8d 25 23 STA $2325 ; (inp_op_extrt + 17)
+231a : b1 19 __ LDA (IP + 0),y
+231c : c8 __ __ INY
+231d : 8d 26 23 STA $2326 ; (inp_op_extrt + 18)
+2320 : b1 19 __ LDA (IP + 0),y
+2322 : c8 __ __ INY
+2323 : aa __ __ TAX
+2324 : 20 00 00 JSR $0000 
+2327 : 4c 51 08 JMP $0851 ; (startup + 80)
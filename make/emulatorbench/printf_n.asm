@@ -0,0 +1,3279 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e ad 21 STX $21ad ; (spentry + 0)
+0811 : a9 ae __ LDA #$ae
+0813 : 85 19 __ STA IP + 0
+0815 : a9 21 __ LDA #$21
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 22 __ LDA #$22
+081c : e9 21 __ SBC #$21
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 12 __ LDA #$12
+0832 : e9 ae __ SBC #$ae
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c f4 1c JMP $1cf4 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 08 __ SBC #$08
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 05 __ LDY #$05
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 12 __ SBC #$12
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T0 + 0
+0928 : 85 54 __ STA T0 + 1
+092a : 85 55 __ STA T1 + 0
+092c : 85 56 __ STA T1 + 1
+092e : a9 ae __ LDA #$ae
+0930 : a0 02 __ LDY #$02
+0932 : 91 23 __ STA (SP + 0),y
+0934 : a9 21 __ LDA #$21
+0936 : c8 __ __ INY
+0937 : 91 23 __ STA (SP + 0),y
+0939 : a9 57 __ LDA #$57
+093b : c8 __ __ INY
+093c : 91 23 __ STA (SP + 0),y
+093e : a9 1c __ LDA #$1c
+0940 : c8 __ __ INY
+0941 : 91 23 __ STA (SP + 0),y
+0943 : a5 55 __ LDA T1 + 0
+0945 : 85 1b __ STA ACCU + 0
+0947 : a5 56 __ LDA T1 + 1
+0949 : 85 1c __ STA ACCU + 1
+094b : a9 4b __ LDA #$4b
+094d : 85 03 __ STA $03
+094f : a9 01 __ LDA #$01
+0951 : 85 04 __ STA $04
+0953 : 20 4e 1f JSR $1f4e ; (mul16 + 0)
+0956 : 38 __ __ SEC
+0957 : a5 05 __ LDA $05
+0959 : e9 80 __ SBC #$80
+095b : a0 06 __ LDY #$06
+095d : 91 23 __ STA (SP + 0),y
+095f : a5 06 __ LDA $06
+0961 : e9 3e __ SBC #$3e
+0963 : c8 __ __ INY
+0964 : 91 23 __ STA (SP + 0),y
+0966 : a5 55 __ LDA T1 + 0
+0968 : 85 1b __ STA ACCU + 0
+096a : a5 56 __ LDA T1 + 1
+096c : 85 1c __ STA ACCU + 1
+096e : a9 69 __ LDA #$69
+0970 : 85 03 __ STA $03
+0972 : a9 02 __ LDA #$02
+0974 : 85 04 __ STA $04
+0976 : 20 4e 1f JSR $1f4e ; (mul16 + 0)
+0979 : a5 05 __ LDA $05
+097b : a0 08 __ LDY #$08
+097d : 91 23 __ STA (SP + 0),y
+097f : a5 06 __ LDA $06
+0981 : c8 __ __ INY
+0982 : 91 23 __ STA (SP + 0),y
+0984 : a5 55 __ LDA T1 + 0
+0986 : 85 1b __ STA ACCU + 0
+0988 : a5 56 __ LDA T1 + 1
+098a : 85 1c __ STA ACCU + 1
+098c : a9 61 __ LDA #$61
+098e : 85 03 __ STA $03
+0990 : 20 01 1d JSR $1d01 ; (mul16by8 + 0)
+0993 : a5 05 __ LDA $05
+0995 : a0 0a __ LDY #$0a
+0997 : 91 23 __ STA (SP + 0),y
+0999 : a5 06 __ LDA $06
+099b : c8 __ __ INY
+099c : 91 23 __ STA (SP + 0),y
+099e : a5 55 __ LDA T1 + 0
+09a0 : c8 __ __ INY
+09a1 : 91 23 __ STA (SP + 0),y
+09a3 : a5 56 __ LDA T1 + 1
+09a5 : c8 __ __ INY
+09a6 : 91 23 __ STA (SP + 0),y
+09a8 : 38 __ __ SEC
+09a9 : a9 00 __ LDA #$00
+09ab : e5 55 __ SBC T1 + 0
+09ad : c8 __ __ INY
+09ae : 91 23 __ STA (SP + 0),y
+09b0 : a9 00 __ LDA #$00
+09b2 : e5 56 __ SBC T1 + 1
+09b4 : c8 __ __ INY
+09b5 : 91 23 __ STA (SP + 0),y
+09b7 : a9 6c __ LDA #$6c
+09b9 : c8 __ __ INY
+09ba : 91 23 __ STA (SP + 0),y
+09bc : a9 1c __ LDA #$1c
+09be : c8 __ __ INY
+09bf : 91 23 __ STA (SP + 0),y
+09c1 : 20 85 0b JSR $0b85 ; (sprintf + 0)
+09c4 : a9 ae __ LDA #$ae
+09c6 : 85 0d __ STA P0
+09c8 : a9 21 __ LDA #$21
+09ca : 85 0e __ STA P1
+09cc : 20 70 1c JSR $1c70 ; (strlen + 0)
+09cf : 18 __ __ CLC
+09d0 : a5 1b __ LDA ACCU + 0
+09d2 : 65 53 __ ADC T0 + 0
+09d4 : 85 53 __ STA T0 + 0
+09d6 : a5 1c __ LDA ACCU + 1
+09d8 : 65 54 __ ADC T0 + 1
+09da : 85 54 __ STA T0 + 1
+09dc : ad ae 21 LDA $21ae ; (buffer + 0)
+09df : f0 03 __ BEQ $09e4
+09e1 : 4c 53 0b JMP $0b53 ; (main + 595)
+09e4 : e6 55 __ INC T1 + 0
+09e6 : d0 02 __ BNE $09ea
+09e8 : e6 56 __ INC T1 + 1
+09ea : a5 56 __ LDA T1 + 1
+09ec : 10 03 __ BPL $09f1
+09ee : 4c 2e 09 JMP $092e ; (main + 46)
+09f1 : d0 09 __ BNE $09fc
+09f3 : a5 55 __ LDA T1 + 0
+09f5 : c9 64 __ CMP #$64
+09f7 : b0 03 __ BCS $09fc
+09f9 : 4c 2e 09 JMP $092e ; (main + 46)
+09fc : a9 00 __ LDA #$00
+09fe : 85 55 __ STA T1 + 0
+0a00 : 85 56 __ STA T1 + 1
+0a02 : a9 ae __ LDA #$ae
+0a04 : a0 02 __ LDY #$02
+0a06 : 91 23 __ STA (SP + 0),y
+0a08 : a9 21 __ LDA #$21
+0a0a : c8 __ __ INY
+0a0b : 91 23 __ STA (SP + 0),y
+0a0d : a9 a1 __ LDA #$a1
+0a0f : c8 __ __ INY
+0a10 : 91 23 __ STA (SP + 0),y
+0a12 : a9 1c __ LDA #$1c
+0a14 : c8 __ __ INY
+0a15 : 91 23 __ STA (SP + 0),y
+0a17 : a5 55 __ LDA T1 + 0
+0a19 : 85 1b __ STA ACCU + 0
+0a1b : a5 56 __ LDA T1 + 1
+0a1d : 85 1c __ STA ACCU + 1
+0a1f : 20 ba 20 JSR $20ba ; (sint16_to_float + 0)
+0a22 : a5 1b __ LDA ACCU + 0
+0a24 : 85 46 __ STA T6 + 0
+0a26 : a5 1c __ LDA ACCU + 1
+0a28 : 85 47 __ STA T6 + 1
+0a2a : a5 1d __ LDA ACCU + 2
+0a2c : 85 48 __ STA T6 + 2
+0a2e : a5 1e __ LDA ACCU + 3
+0a30 : 85 49 __ STA T6 + 3
+0a32 : a9 00 __ LDA #$00
+0a34 : 85 03 __ STA $03
+0a36 : 85 04 __ STA $04
+0a38 : a9 a0 __ LDA #$a0
+0a3a : 85 05 __ STA $05
+0a3c : a9 3f __ LDA #$3f
+0a3e : 85 06 __ STA $06
+0a40 : 20 39 1d JSR $1d39 ; (freg + 20)
+0a43 : 20 32 1e JSR $1e32 ; (fmul + 0)
+0a46 : a5 1b __ LDA ACCU + 0
+0a48 : a0 06 __ LDY #$06
+0a4a : 91 23 __ STA (SP + 0),y
+0a4c : a5 1c __ LDA ACCU + 1
+0a4e : c8 __ __ INY
+0a4f : 91 23 __ STA (SP + 0),y
+0a51 : a5 1d __ LDA ACCU + 2
+0a53 : c8 __ __ INY
+0a54 : 91 23 __ STA (SP + 0),y
+0a56 : a5 1e __ LDA ACCU + 3
+0a58 : c8 __ __ INY
+0a59 : 91 23 __ STA (SP + 0),y
+0a5b : a5 46 __ LDA T6 + 0
+0a5d : 85 1b __ STA ACCU + 0
+0a5f : a5 47 __ LDA T6 + 1
+0a61 : 85 1c __ STA ACCU + 1
+0a63 : a5 48 __ LDA T6 + 2
+0a65 : 85 1d __ STA ACCU + 2
+0a67 : a5 49 __ LDA T6 + 3
+0a69 : 85 1e __ STA ACCU + 3
+0a6b : a9 00 __ LDA #$00
+0a6d : 85 03 __ STA $03
+0a6f : 85 04 __ STA $04
+0a71 : a9 80 __ LDA #$80
+0a73 : 85 05 __ STA $05
+0a75 : a9 bd __ LDA #$bd
+0a77 : 85 06 __ STA $06
+0a79 : 20 39 1d JSR $1d39 ; (freg + 20)
+0a7c : 20 32 1e JSR $1e32 ; (fmul + 0)
+0a7f : a5 1b __ LDA ACCU + 0
+0a81 : a0 0a __ LDY #$0a
+0a83 : 91 23 __ STA (SP + 0),y
+0a85 : a5 1c __ LDA ACCU + 1
+0a87 : c8 __ __ INY
+0a88 : 91 23 __ STA (SP + 0),y
+0a8a : a5 1d __ LDA ACCU + 2
+0a8c : c8 __ __ INY
+0a8d : 91 23 __ STA (SP + 0),y
+0a8f : a5 1e __ LDA ACCU + 3
+0a91 : c8 __ __ INY
+0a92 : 91 23 __ STA (SP + 0),y
+0a94 : 20 85 0b JSR $0b85 ; (sprintf + 0)
+0a97 : a9 ae __ LDA #$ae
+0a99 : 85 0d __ STA P0
+0a9b : a9 21 __ LDA #$21
+0a9d : 85 0e __ STA P1
+0a9f : 20 70 1c JSR $1c70 ; (strlen + 0)
+0aa2 : e6 55 __ INC T1 + 0
+0aa4 : d0 02 __ BNE $0aa8
+0aa6 : e6 56 __ INC T1 + 1
+0aa8 : 18 __ __ CLC
+0aa9 : a5 1b __ LDA ACCU + 0
+0aab : 65 53 __ ADC T0 + 0
+0aad : 85 53 __ STA T0 + 0
+0aaf : a5 1c __ LDA ACCU + 1
+0ab1 : 65 54 __ ADC T0 + 1
+0ab3 : 85 54 __ STA T0 + 1
+0ab5 : a5 56 __ LDA T1 + 1
+0ab7 : 10 03 __ BPL $0abc
+0ab9 : 4c 02 0a JMP $0a02 ; (main + 258)
+0abc : d0 09 __ BNE $0ac7
+0abe : a5 55 __ LDA T1 + 0
+0ac0 : c9 14 __ CMP #$14
+0ac2 : b0 03 __ BCS $0ac7
+0ac4 : 4c 02 0a JMP $0a02 ; (main + 258)
+0ac7 : a9 ae __ LDA #$ae
+0ac9 : a0 02 __ LDY #$02
+0acb : 91 23 __ STA (SP + 0),y
+0acd : a9 21 __ LDA #$21
+0acf : c8 __ __ INY
+0ad0 : 91 23 __ STA (SP + 0),y
+0ad2 : a9 aa __ LDA #$aa
+0ad4 : c8 __ __ INY
+0ad5 : 91 23 __ STA (SP + 0),y
+0ad7 : a9 1c __ LDA #$1c
+0ad9 : c8 __ __ INY
+0ada : 91 23 __ STA (SP + 0),y
+0adc : a9 85 __ LDA #$85
+0ade : c8 __ __ INY
+0adf : 91 23 __ STA (SP + 0),y
+0ae1 : a9 ff __ LDA #$ff
+0ae3 : c8 __ __ INY
+0ae4 : 91 23 __ STA (SP + 0),y
+0ae6 : a9 b3 __ LDA #$b3
+0ae8 : c8 __ __ INY
+0ae9 : 91 23 __ STA (SP + 0),y
+0aeb : a9 1c __ LDA #$1c
+0aed : c8 __ __ INY
+0aee : 91 23 __ STA (SP + 0),y
+0af0 : a9 ef __ LDA #$ef
+0af2 : c8 __ __ INY
+0af3 : 91 23 __ STA (SP + 0),y
+0af5 : a9 be __ LDA #$be
+0af7 : c8 __ __ INY
+0af8 : 91 23 __ STA (SP + 0),y
+0afa : 20 85 0b JSR $0b85 ; (sprintf + 0)
+0afd : a9 ae __ LDA #$ae
+0aff : 85 0d __ STA P0
+0b01 : a9 21 __ LDA #$21
+0b03 : 85 0e __ STA P1
+0b05 : a9 e6 __ LDA #$e6
+0b07 : 85 0f __ STA P2
+0b09 : a9 1c __ LDA #$1c
+0b0b : 85 10 __ STA P3
+0b0d : 20 b7 1c JSR $1cb7 ; (strcmp + 0)
+0b10 : a5 1b __ LDA ACCU + 0
+0b12 : 05 1c __ ORA ACCU + 1
+0b14 : d0 38 __ BNE $0b4e
+0b16 : a5 53 __ LDA T0 + 0
+0b18 : 05 54 __ ORA T0 + 1
+0b1a : f0 2d __ BEQ $0b49
+0b1c : a9 00 __ LDA #$00
+0b1e : 85 1b __ STA ACCU + 0
+0b20 : a9 00 __ LDA #$00
+0b22 : 85 1c __ STA ACCU + 1
+0b24 : 18 __ __ CLC
+0b25 : a5 23 __ LDA SP + 0
+0b27 : 69 12 __ ADC #$12
+0b29 : 85 23 __ STA SP + 0
+0b2b : a5 24 __ LDA SP + 1
+0b2d : 69 00 __ ADC #$00
+0b2f : 85 24 __ STA SP + 1
+0b31 : a0 05 __ LDY #$05
+0b33 : b1 23 __ LDA (SP + 0),y
+0b35 : 99 53 00 STA $0053,y 
+0b38 : 88 __ __ DEY
+0b39 : 10 f8 __ BPL $0b33
+0b3b : 18 __ __ CLC
+0b3c : a5 23 __ LDA SP + 0
+0b3e : 69 08 __ ADC #$08
+0b40 : 85 23 __ STA SP + 0
+0b42 : a5 24 __ LDA SP + 1
+0b44 : 69 00 __ ADC #$00
+0b46 : 85 24 __ STA SP + 1
+0b48 : 60 __ __ RTS
+0b49 : a9 01 __ LDA #$01
+0b4b : 4c 1e 0b JMP $0b1e ; (main + 542)
+0b4e : a9 01 __ LDA #$01
+0b50 : 4c 1e 0b JMP $0b1e ; (main + 542)
+0b53 : a9 00 __ LDA #$00
+0b55 : 85 57 __ STA T2 + 0
+0b57 : 85 58 __ STA T2 + 1
+0b59 : 18 __ __ CLC
+0b5a : a9 af __ LDA #$af
+0b5c : 65 57 __ ADC T2 + 0
+0b5e : 85 44 __ STA T5 + 0
+0b60 : a9 21 __ LDA #$21
+0b62 : 69 00 __ ADC #$00
+0b64 : 85 45 __ STA T5 + 1
+0b66 : 18 __ __ CLC
+0b67 : a4 57 __ LDY T2 + 0
+0b69 : b9 ae 21 LDA $21ae,y ; (buffer + 0)
+0b6c : 65 53 __ ADC T0 + 0
+0b6e : 85 53 __ STA T0 + 0
+0b70 : a9 00 __ LDA #$00
+0b72 : 65 54 __ ADC T0 + 1
+0b74 : 85 54 __ STA T0 + 1
+0b76 : a0 00 __ LDY #$00
+0b78 : e6 57 __ INC T2 + 0
+0b7a : d0 02 __ BNE $0b7e
+0b7c : e6 58 __ INC T2 + 1
+0b7e : b1 44 __ LDA (T5 + 0),y
+0b80 : d0 d7 __ BNE $0b59
+0b82 : 4c e4 09 JMP $09e4 ; (main + 228)
+--------------------------------------------------------------------
+sprintf:
+0b85 : 38 __ __ SEC
+0b86 : a5 23 __ LDA SP + 0
+0b88 : e9 11 __ SBC #$11
+0b8a : 85 23 __ STA SP + 0
+0b8c : a5 24 __ LDA SP + 1
+0b8e : e9 00 __ SBC #$00
+0b90 : 85 24 __ STA SP + 1
+0b92 : a0 07 __ LDY #$07
+0b94 : b9 53 00 LDA $0053,y 
+0b97 : 91 23 __ STA (SP + 0),y
+0b99 : 88 __ __ DEY
+0b9a : 10 f8 __ BPL $0b94
+0b9c : a9 00 __ LDA #$00
+0b9e : 85 53 __ STA T1 + 0
+0ba0 : a0 15 __ LDY #$15
+0ba2 : b1 23 __ LDA (SP + 0),y
+0ba4 : 85 55 __ STA T2 + 0
+0ba6 : c8 __ __ INY
+0ba7 : b1 23 __ LDA (SP + 0),y
+0ba9 : 85 56 __ STA T2 + 1
+0bab : a0 00 __ LDY #$00
+0bad : b1 55 __ LDA (T2 + 0),y
+0baf : 85 43 __ STA T3 + 0
+0bb1 : a0 13 __ LDY #$13
+0bb3 : b1 23 __ LDA (SP + 0),y
+0bb5 : 85 57 __ STA T4 + 0
+0bb7 : c8 __ __ INY
+0bb8 : b1 23 __ LDA (SP + 0),y
+0bba : 85 58 __ STA T4 + 1
+0bbc : a5 43 __ LDA T3 + 0
+0bbe : d0 4e __ BNE $0c0e
+0bc0 : 18 __ __ CLC
+0bc1 : a5 57 __ LDA T4 + 0
+0bc3 : 65 53 __ ADC T1 + 0
+0bc5 : 85 55 __ STA T2 + 0
+0bc7 : a5 58 __ LDA T4 + 1
+0bc9 : 69 00 __ ADC #$00
+0bcb : 85 56 __ STA T2 + 1
+0bcd : a9 00 __ LDA #$00
+0bcf : a4 53 __ LDY T1 + 0
+0bd1 : 91 57 __ STA (T4 + 0),y
+0bd3 : 98 __ __ TYA
+0bd4 : d0 08 __ BNE $0bde
+0bd6 : a5 57 __ LDA T4 + 0
+0bd8 : 85 55 __ STA T2 + 0
+0bda : a5 58 __ LDA T4 + 1
+0bdc : 85 56 __ STA T2 + 1
+0bde : a0 13 __ LDY #$13
+0be0 : b1 23 __ LDA (SP + 0),y
+0be2 : 85 57 __ STA T4 + 0
+0be4 : c8 __ __ INY
+0be5 : b1 23 __ LDA (SP + 0),y
+0be7 : 85 58 __ STA T4 + 1
+0be9 : 38 __ __ SEC
+0bea : a5 55 __ LDA T2 + 0
+0bec : e5 57 __ SBC T4 + 0
+0bee : 85 1b __ STA ACCU + 0
+0bf0 : a5 56 __ LDA T2 + 1
+0bf2 : e5 58 __ SBC T4 + 1
+0bf4 : 85 1c __ STA ACCU + 1
+0bf6 : a0 07 __ LDY #$07
+0bf8 : b1 23 __ LDA (SP + 0),y
+0bfa : 99 53 00 STA $0053,y 
+0bfd : 88 __ __ DEY
+0bfe : 10 f8 __ BPL $0bf8
+0c00 : 18 __ __ CLC
+0c01 : a5 23 __ LDA SP + 0
+0c03 : 69 11 __ ADC #$11
+0c05 : 85 23 __ STA SP + 0
+0c07 : a5 24 __ LDA SP + 1
+0c09 : 69 00 __ ADC #$00
+0c0b : 85 24 __ STA SP + 1
+0c0d : 60 __ __ RTS
+0c0e : 18 __ __ CLC
+0c0f : a5 23 __ LDA SP + 0
+0c11 : 69 17 __ ADC #$17
+0c13 : 85 59 __ STA T5 + 0
+0c15 : a5 24 __ LDA SP + 1
+0c17 : 69 00 __ ADC #$00
+0c19 : 85 5a __ STA T5 + 1
+0c1b : e6 55 __ INC T2 + 0
+0c1d : d0 02 __ BNE $0c21
+0c1f : e6 56 __ INC T2 + 1
+0c21 : a5 43 __ LDA T3 + 0
+0c23 : c9 25 __ CMP #$25
+0c25 : f0 31 __ BEQ $0c58
+0c27 : a4 53 __ LDY T1 + 0
+0c29 : 91 57 __ STA (T4 + 0),y
+0c2b : e6 53 __ INC T1 + 0
+0c2d : a5 53 __ LDA T1 + 0
+0c2f : c9 28 __ CMP #$28
+0c31 : a0 00 __ LDY #$00
+0c33 : 90 1e __ BCC $0c53
+0c35 : 18 __ __ CLC
+0c36 : 65 57 __ ADC T4 + 0
+0c38 : 85 57 __ STA T4 + 0
+0c3a : 90 02 __ BCC $0c3e
+0c3c : e6 58 __ INC T4 + 1
+0c3e : a9 00 __ LDA #$00
+0c40 : 85 53 __ STA T1 + 0
+0c42 : b1 55 __ LDA (T2 + 0),y
+0c44 : aa __ __ TAX
+0c45 : e6 55 __ INC T2 + 0
+0c47 : d0 02 __ BNE $0c4b
+0c49 : e6 56 __ INC T2 + 1
+0c4b : 8a __ __ TXA
+0c4c : 86 43 __ STX T3 + 0
+0c4e : d0 d1 __ BNE $0c21
+0c50 : 4c c0 0b JMP $0bc0 ; (sprintf + 59)
+0c53 : a0 00 __ LDY #$00
+0c55 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0c58 : a5 53 __ LDA T1 + 0
+0c5a : f0 0d __ BEQ $0c69
+0c5c : 18 __ __ CLC
+0c5d : 65 57 __ ADC T4 + 0
+0c5f : 85 57 __ STA T4 + 0
+0c61 : 90 02 __ BCC $0c65
+0c63 : e6 58 __ INC T4 + 1
+0c65 : a9 00 __ LDA #$00
+0c67 : 85 53 __ STA T1 + 0
+0c69 : a0 00 __ LDY #$00
+0c6b : b1 55 __ LDA (T2 + 0),y
+0c6d : 85 43 __ STA T3 + 0
+0c6f : a9 0a __ LDA #$0a
+0c71 : a0 0c __ LDY #$0c
+0c73 : 91 23 __ STA (SP + 0),y
+0c75 : a9 00 __ LDA #$00
+0c77 : c8 __ __ INY
+0c78 : 91 23 __ STA (SP + 0),y
+0c7a : a9 01 __ LDA #$01
+0c7c : a0 0a __ LDY #$0a
+0c7e : 91 23 __ STA (SP + 0),y
+0c80 : a9 ff __ LDA #$ff
+0c82 : c8 __ __ INY
+0c83 : 91 23 __ STA (SP + 0),y
+0c85 : a9 20 __ LDA #$20
+0c87 : a0 09 __ LDY #$09
+0c89 : 91 23 __ STA (SP + 0),y
+0c8b : a9 00 __ LDA #$00
+0c8d : a0 0e __ LDY #$0e
+0c8f : 91 23 __ STA (SP + 0),y
+0c91 : c8 __ __ INY
+0c92 : 91 23 __ STA (SP + 0),y
+0c94 : c8 __ __ INY
+0c95 : 91 23 __ STA (SP + 0),y
+0c97 : e6 55 __ INC T2 + 0
+0c99 : d0 02 __ BNE $0c9d
+0c9b : e6 56 __ INC T2 + 1
+0c9d : a5 43 __ LDA T3 + 0
+0c9f : c9 2b __ CMP #$2b
+0ca1 : d0 03 __ BNE $0ca6
+0ca3 : 4c a4 13 JMP $13a4 ; (sprintf + 2079)
+0ca6 : c9 30 __ CMP #$30
+0ca8 : d0 03 __ BNE $0cad
+0caa : 4c 95 13 JMP $1395 ; (sprintf + 2064)
+0cad : c9 23 __ CMP #$23
+0caf : d0 03 __ BNE $0cb4
+0cb1 : 4c 86 13 JMP $1386 ; (sprintf + 2049)
+0cb4 : c9 30 __ CMP #$30
+0cb6 : 90 65 __ BCC $0d1d
+0cb8 : a9 39 __ LDA #$39
+0cba : c5 43 __ CMP T3 + 0
+0cbc : 90 5f __ BCC $0d1d
+0cbe : a9 00 __ LDA #$00
+0cc0 : 85 46 __ STA T7 + 0
+0cc2 : 85 47 __ STA T7 + 1
+0cc4 : a5 43 __ LDA T3 + 0
+0cc6 : c9 30 __ CMP #$30
+0cc8 : 90 4d __ BCC $0d17
+0cca : a9 39 __ LDA #$39
+0ccc : c5 43 __ CMP T3 + 0
+0cce : 90 47 __ BCC $0d17
+0cd0 : a5 43 __ LDA T3 + 0
+0cd2 : 85 48 __ STA T8 + 0
+0cd4 : a0 00 __ LDY #$00
+0cd6 : b1 55 __ LDA (T2 + 0),y
+0cd8 : 85 43 __ STA T3 + 0
+0cda : e6 55 __ INC T2 + 0
+0cdc : d0 02 __ BNE $0ce0
+0cde : e6 56 __ INC T2 + 1
+0ce0 : a5 46 __ LDA T7 + 0
+0ce2 : 0a __ __ ASL
+0ce3 : 85 07 __ STA $07
+0ce5 : a5 47 __ LDA T7 + 1
+0ce7 : 2a __ __ ROL
+0ce8 : 06 07 __ ASL $07
+0cea : 2a __ __ ROL
+0ceb : aa __ __ TAX
+0cec : 18 __ __ CLC
+0ced : a5 07 __ LDA $07
+0cef : 65 46 __ ADC T7 + 0
+0cf1 : 85 1b __ STA ACCU + 0
+0cf3 : 8a __ __ TXA
+0cf4 : 65 47 __ ADC T7 + 1
+0cf6 : 06 1b __ ASL ACCU + 0
+0cf8 : 2a __ __ ROL
+0cf9 : 85 1c __ STA ACCU + 1
+0cfb : 18 __ __ CLC
+0cfc : a5 1b __ LDA ACCU + 0
+0cfe : 65 48 __ ADC T8 + 0
+0d00 : aa __ __ TAX
+0d01 : a5 1c __ LDA ACCU + 1
+0d03 : 69 00 __ ADC #$00
+0d05 : a8 __ __ TAY
+0d06 : 38 __ __ SEC
+0d07 : 8a __ __ TXA
+0d08 : e9 30 __ SBC #$30
+0d0a : 85 46 __ STA T7 + 0
+0d0c : 98 __ __ TYA
+0d0d : e9 00 __ SBC #$00
+0d0f : 85 47 __ STA T7 + 1
+0d11 : a5 43 __ LDA T3 + 0
+0d13 : c9 30 __ CMP #$30
+0d15 : b0 b3 __ BCS $0cca
+0d17 : a5 46 __ LDA T7 + 0
+0d19 : a0 0a __ LDY #$0a
+0d1b : 91 23 __ STA (SP + 0),y
+0d1d : a5 43 __ LDA T3 + 0
+0d1f : c9 2e __ CMP #$2e
+0d21 : d0 03 __ BNE $0d26
+0d23 : 4c 18 13 JMP $1318 ; (sprintf + 1939)
+0d26 : a5 43 __ LDA T3 + 0
+0d28 : c9 64 __ CMP #$64
+0d2a : d0 03 __ BNE $0d2f
+0d2c : 4c 8d 11 JMP $118d ; (sprintf + 1544)
+0d2f : c9 75 __ CMP #$75
+0d31 : d0 03 __ BNE $0d36
+0d33 : 4c 40 10 JMP $1040 ; (sprintf + 1211)
+0d36 : c9 78 __ CMP #$78
+0d38 : d0 03 __ BNE $0d3d
+0d3a : 4c e9 0e JMP $0ee9 ; (sprintf + 868)
+0d3d : c9 6c __ CMP #$6c
+0d3f : d0 03 __ BNE $0d44
+0d41 : 4c 10 0e JMP $0e10 ; (sprintf + 651)
+0d44 : c9 66 __ CMP #$66
+0d46 : d0 03 __ BNE $0d4b
+0d48 : 4c cf 0d JMP $0dcf ; (sprintf + 586)
+0d4b : c9 67 __ CMP #$67
+0d4d : d0 03 __ BNE $0d52
+0d4f : 4c cf 0d JMP $0dcf ; (sprintf + 586)
+0d52 : c9 65 __ CMP #$65
+0d54 : f0 79 __ BEQ $0dcf
+0d56 : c9 73 __ CMP #$73
+0d58 : f0 32 __ BEQ $0d8c
+0d5a : c9 63 __ CMP #$63
+0d5c : f0 14 __ BEQ $0d72
+0d5e : 09 00 __ ORA #$00
+0d60 : d0 03 __ BNE $0d65
+0d62 : 4c 53 0c JMP $0c53 ; (sprintf + 206)
+0d65 : a5 43 __ LDA T3 + 0
+0d67 : a4 53 __ LDY T1 + 0
+0d69 : 91 57 __ STA (T4 + 0),y
+0d6b : e6 53 __ INC T1 + 0
+0d6d : a0 00 __ LDY #$00
+0d6f : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0d72 : a0 00 __ LDY #$00
+0d74 : b1 59 __ LDA (T5 + 0),y
+0d76 : a4 53 __ LDY T1 + 0
+0d78 : 91 57 __ STA (T4 + 0),y
+0d7a : 18 __ __ CLC
+0d7b : a5 59 __ LDA T5 + 0
+0d7d : 69 02 __ ADC #$02
+0d7f : 85 59 __ STA T5 + 0
+0d81 : 90 02 __ BCC $0d85
+0d83 : e6 5a __ INC T5 + 1
+0d85 : e6 53 __ INC T1 + 0
+0d87 : a0 00 __ LDY #$00
+0d89 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0d8c : a0 00 __ LDY #$00
+0d8e : b1 59 __ LDA (T5 + 0),y
+0d90 : 85 46 __ STA T7 + 0
+0d92 : c8 __ __ INY
+0d93 : b1 59 __ LDA (T5 + 0),y
+0d95 : 85 47 __ STA T7 + 1
+0d97 : 18 __ __ CLC
+0d98 : a5 59 __ LDA T5 + 0
+0d9a : 69 02 __ ADC #$02
+0d9c : 85 59 __ STA T5 + 0
+0d9e : 90 02 __ BCC $0da2
+0da0 : e6 5a __ INC T5 + 1
+0da2 : 88 __ __ DEY
+0da3 : b1 46 __ LDA (T7 + 0),y
+0da5 : 85 43 __ STA T3 + 0
+0da7 : d0 03 __ BNE $0dac
+0da9 : 4c 53 0c JMP $0c53 ; (sprintf + 206)
+0dac : e6 46 __ INC T7 + 0
+0dae : d0 02 __ BNE $0db2
+0db0 : e6 47 __ INC T7 + 1
+0db2 : a5 43 __ LDA T3 + 0
+0db4 : a0 00 __ LDY #$00
+0db6 : 91 57 __ STA (T4 + 0),y
+0db8 : e6 57 __ INC T4 + 0
+0dba : d0 02 __ BNE $0dbe
+0dbc : e6 58 __ INC T4 + 1
+0dbe : b1 46 __ LDA (T7 + 0),y
+0dc0 : aa __ __ TAX
+0dc1 : e6 46 __ INC T7 + 0
+0dc3 : d0 02 __ BNE $0dc7
+0dc5 : e6 47 __ INC T7 + 1
+0dc7 : 8a __ __ TXA
+0dc8 : 86 43 __ STX T3 + 0
+0dca : d0 e6 __ BNE $0db2
+0dcc : 4c 53 0c JMP $0c53 ; (sprintf + 206)
+0dcf : 18 __ __ CLC
+0dd0 : a5 23 __ LDA SP + 0
+0dd2 : 69 09 __ ADC #$09
+0dd4 : 85 0d __ STA P0
+0dd6 : a5 24 __ LDA SP + 1
+0dd8 : 69 00 __ ADC #$00
+0dda : 85 0e __ STA P1
+0ddc : a5 57 __ LDA T4 + 0
+0dde : 85 0f __ STA P2
+0de0 : a5 58 __ LDA T4 + 1
+0de2 : 85 10 __ STA P3
+0de4 : a0 00 __ LDY #$00
+0de6 : b1 59 __ LDA (T5 + 0),y
+0de8 : 85 11 __ STA P4
+0dea : c8 __ __ INY
+0deb : b1 59 __ LDA (T5 + 0),y
+0ded : 85 12 __ STA P5
+0def : c8 __ __ INY
+0df0 : b1 59 __ LDA (T5 + 0),y
+0df2 : 85 13 __ STA P6
+0df4 : c8 __ __ INY
+0df5 : b1 59 __ LDA (T5 + 0),y
+0df7 : 85 14 __ STA P7
+0df9 : 20 e0 15 JSR $15e0 ; (nformf + 0)
+0dfc : a5 1b __ LDA ACCU + 0
+0dfe : 85 53 __ STA T1 + 0
+0e00 : 18 __ __ CLC
+0e01 : a5 59 __ LDA T5 + 0
+0e03 : 69 04 __ ADC #$04
+0e05 : 85 59 __ STA T5 + 0
+0e07 : 90 02 __ BCC $0e0b
+0e09 : e6 5a __ INC T5 + 1
+0e0b : a0 00 __ LDY #$00
+0e0d : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0e10 : a0 00 __ LDY #$00
+0e12 : b1 59 __ LDA (T5 + 0),y
+0e14 : 85 4f __ STA T12 + 0
+0e16 : c8 __ __ INY
+0e17 : b1 59 __ LDA (T5 + 0),y
+0e19 : 85 50 __ STA T12 + 1
+0e1b : c8 __ __ INY
+0e1c : b1 59 __ LDA (T5 + 0),y
+0e1e : 85 51 __ STA T12 + 2
+0e20 : c8 __ __ INY
+0e21 : b1 59 __ LDA (T5 + 0),y
+0e23 : 85 52 __ STA T12 + 3
+0e25 : 18 __ __ CLC
+0e26 : a5 59 __ LDA T5 + 0
+0e28 : 69 04 __ ADC #$04
+0e2a : 85 59 __ STA T5 + 0
+0e2c : 90 02 __ BCC $0e30
+0e2e : e6 5a __ INC T5 + 1
+0e30 : a0 00 __ LDY #$00
+0e32 : b1 55 __ LDA (T2 + 0),y
+0e34 : aa __ __ TAX
+0e35 : e6 55 __ INC T2 + 0
+0e37 : d0 02 __ BNE $0e3b
+0e39 : e6 56 __ INC T2 + 1
+0e3b : 8a __ __ TXA
+0e3c : e0 64 __ CPX #$64
+0e3e : f0 78 __ BEQ $0eb8
+0e40 : c9 75 __ CMP #$75
+0e42 : f0 43 __ BEQ $0e87
+0e44 : c9 78 __ CMP #$78
+0e46 : f0 03 __ BEQ $0e4b
+0e48 : 4c 53 0c JMP $0c53 ; (sprintf + 206)
+0e4b : a9 10 __ LDA #$10
+0e4d : a0 0c __ LDY #$0c
+0e4f : 91 23 __ STA (SP + 0),y
+0e51 : a9 00 __ LDA #$00
+0e53 : c8 __ __ INY
+0e54 : 91 23 __ STA (SP + 0),y
+0e56 : 18 __ __ CLC
+0e57 : a5 23 __ LDA SP + 0
+0e59 : 69 09 __ ADC #$09
+0e5b : 85 0d __ STA P0
+0e5d : a5 24 __ LDA SP + 1
+0e5f : 69 00 __ ADC #$00
+0e61 : 85 0e __ STA P1
+0e63 : a5 57 __ LDA T4 + 0
+0e65 : 85 0f __ STA P2
+0e67 : a5 58 __ LDA T4 + 1
+0e69 : 85 10 __ STA P3
+0e6b : a5 4f __ LDA T12 + 0
+0e6d : 85 11 __ STA P4
+0e6f : a5 50 __ LDA T12 + 1
+0e71 : 85 12 __ STA P5
+0e73 : a5 51 __ LDA T12 + 2
+0e75 : 85 13 __ STA P6
+0e77 : a5 52 __ LDA T12 + 3
+0e79 : 85 14 __ STA P7
+0e7b : 20 b3 13 JSR $13b3 ; (nforml + 0)
+0e7e : a5 1b __ LDA ACCU + 0
+0e80 : 85 53 __ STA T1 + 0
+0e82 : a0 00 __ LDY #$00
+0e84 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0e87 : 18 __ __ CLC
+0e88 : a5 23 __ LDA SP + 0
+0e8a : 69 09 __ ADC #$09
+0e8c : 85 0d __ STA P0
+0e8e : a5 24 __ LDA SP + 1
+0e90 : 69 00 __ ADC #$00
+0e92 : 85 0e __ STA P1
+0e94 : a5 57 __ LDA T4 + 0
+0e96 : 85 0f __ STA P2
+0e98 : a5 58 __ LDA T4 + 1
+0e9a : 85 10 __ STA P3
+0e9c : a5 4f __ LDA T12 + 0
+0e9e : 85 11 __ STA P4
+0ea0 : a5 50 __ LDA T12 + 1
+0ea2 : 85 12 __ STA P5
+0ea4 : a5 51 __ LDA T12 + 2
+0ea6 : 85 13 __ STA P6
+0ea8 : a5 52 __ LDA T12 + 3
+0eaa : 85 14 __ STA P7
+0eac : 20 b3 13 JSR $13b3 ; (nforml + 0)
+0eaf : a5 1b __ LDA ACCU + 0
+0eb1 : 85 53 __ STA T1 + 0
+0eb3 : a0 00 __ LDY #$00
+0eb5 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0eb8 : 18 __ __ CLC
+0eb9 : a5 23 __ LDA SP + 0
+0ebb : 69 09 __ ADC #$09
+0ebd : 85 0d __ STA P0
+0ebf : a5 24 __ LDA SP + 1
+0ec1 : 69 00 __ ADC #$00
+0ec3 : 85 0e __ STA P1
+0ec5 : a5 57 __ LDA T4 + 0
+0ec7 : 85 0f __ STA P2
+0ec9 : a5 58 __ LDA T4 + 1
+0ecb : 85 10 __ STA P3
+0ecd : a5 4f __ LDA T12 + 0
+0ecf : 85 11 __ STA P4
+0ed1 : a5 50 __ LDA T12 + 1
+0ed3 : 85 12 __ STA P5
+0ed5 : a5 51 __ LDA T12 + 2
+0ed7 : 85 13 __ STA P6
+0ed9 : a5 52 __ LDA T12 + 3
+0edb : 85 14 __ STA P7
+0edd : 20 b3 13 JSR $13b3 ; (nforml + 0)
+0ee0 : a5 1b __ LDA ACCU + 0
+0ee2 : 85 53 __ STA T1 + 0
+0ee4 : a0 00 __ LDY #$00
+0ee6 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0ee9 : a9 10 __ LDA #$10
+0eeb : a0 0c __ LDY #$0c
+0eed : 91 23 __ STA (SP + 0),y
+0eef : a9 00 __ LDA #$00
+0ef1 : c8 __ __ INY
+0ef2 : 91 23 __ STA (SP + 0),y
+0ef4 : a5 57 __ LDA T4 + 0
+0ef6 : 85 46 __ STA T7 + 0
+0ef8 : a5 58 __ LDA T4 + 1
+0efa : 85 47 __ STA T7 + 1
+0efc : a0 00 __ LDY #$00
+0efe : b1 59 __ LDA (T5 + 0),y
+0f00 : 85 48 __ STA T8 + 0
+0f02 : c8 __ __ INY
+0f03 : b1 59 __ LDA (T5 + 0),y
+0f05 : 85 49 __ STA T8 + 1
+0f07 : 18 __ __ CLC
+0f08 : a5 59 __ LDA T5 + 0
+0f0a : 69 02 __ ADC #$02
+0f0c : 85 59 __ STA T5 + 0
+0f0e : 90 02 __ BCC $0f12
+0f10 : e6 5a __ INC T5 + 1
+0f12 : a9 0a __ LDA #$0a
+0f14 : 85 43 __ STA T3 + 0
+0f16 : a5 48 __ LDA T8 + 0
+0f18 : 05 49 __ ORA T8 + 1
+0f1a : f0 03 __ BEQ $0f1f
+0f1c : 4c e6 0f JMP $0fe6 ; (sprintf + 1121)
+0f1f : a0 0b __ LDY #$0b
+0f21 : b1 23 __ LDA (SP + 0),y
+0f23 : 85 44 __ STA T6 + 0
+0f25 : c9 ff __ CMP #$ff
+0f27 : d0 03 __ BNE $0f2c
+0f29 : 4c d8 0f JMP $0fd8 ; (sprintf + 1107)
+0f2c : 38 __ __ SEC
+0f2d : a9 0a __ LDA #$0a
+0f2f : e5 44 __ SBC T6 + 0
+0f31 : 85 44 __ STA T6 + 0
+0f33 : c5 43 __ CMP T3 + 0
+0f35 : b0 0e __ BCS $0f45
+0f37 : c6 43 __ DEC T3 + 0
+0f39 : a9 30 __ LDA #$30
+0f3b : a4 43 __ LDY T3 + 0
+0f3d : 91 46 __ STA (T7 + 0),y
+0f3f : a5 44 __ LDA T6 + 0
+0f41 : c5 43 __ CMP T3 + 0
+0f43 : 90 f2 __ BCC $0f37
+0f45 : a0 10 __ LDY #$10
+0f47 : b1 23 __ LDA (SP + 0),y
+0f49 : f0 34 __ BEQ $0f7f
+0f4b : a0 0c __ LDY #$0c
+0f4d : b1 23 __ LDA (SP + 0),y
+0f4f : 85 48 __ STA T8 + 0
+0f51 : c8 __ __ INY
+0f52 : b1 23 __ LDA (SP + 0),y
+0f54 : d0 29 __ BNE $0f7f
+0f56 : a5 48 __ LDA T8 + 0
+0f58 : c9 10 __ CMP #$10
+0f5a : d0 23 __ BNE $0f7f
+0f5c : 18 __ __ CLC
+0f5d : a5 43 __ LDA T3 + 0
+0f5f : 69 ff __ ADC #$ff
+0f61 : 18 __ __ CLC
+0f62 : 65 46 __ ADC T7 + 0
+0f64 : 85 48 __ STA T8 + 0
+0f66 : a5 47 __ LDA T7 + 1
+0f68 : 69 00 __ ADC #$00
+0f6a : 85 49 __ STA T8 + 1
+0f6c : a9 58 __ LDA #$58
+0f6e : a0 00 __ LDY #$00
+0f70 : 91 48 __ STA (T8 + 0),y
+0f72 : 18 __ __ CLC
+0f73 : a5 43 __ LDA T3 + 0
+0f75 : 69 fe __ ADC #$fe
+0f77 : 85 43 __ STA T3 + 0
+0f79 : a9 30 __ LDA #$30
+0f7b : a4 43 __ LDY T3 + 0
+0f7d : 91 46 __ STA (T7 + 0),y
+0f7f : a0 0e __ LDY #$0e
+0f81 : b1 23 __ LDA (SP + 0),y
+0f83 : f0 08 __ BEQ $0f8d
+0f85 : c6 43 __ DEC T3 + 0
+0f87 : a9 2b __ LDA #$2b
+0f89 : a4 43 __ LDY T3 + 0
+0f8b : 91 46 __ STA (T7 + 0),y
+0f8d : a0 0a __ LDY #$0a
+0f8f : b1 23 __ LDA (SP + 0),y
+0f91 : 85 53 __ STA T1 + 0
+0f93 : 38 __ __ SEC
+0f94 : a9 0a __ LDA #$0a
+0f96 : e5 53 __ SBC T1 + 0
+0f98 : 85 48 __ STA T8 + 0
+0f9a : a9 00 __ LDA #$00
+0f9c : e9 00 __ SBC #$00
+0f9e : 49 80 __ EOR #$80
+0fa0 : c9 80 __ CMP #$80
+0fa2 : d0 04 __ BNE $0fa8
+0fa4 : a5 48 __ LDA T8 + 0
+0fa6 : c5 43 __ CMP T3 + 0
+0fa8 : 90 21 __ BCC $0fcb
+0faa : a9 00 __ LDA #$00
+0fac : 85 53 __ STA T1 + 0
+0fae : a5 43 __ LDA T3 + 0
+0fb0 : c9 0a __ CMP #$0a
+0fb2 : b0 12 __ BCS $0fc6
+0fb4 : a4 43 __ LDY T3 + 0
+0fb6 : b1 46 __ LDA (T7 + 0),y
+0fb8 : a4 53 __ LDY T1 + 0
+0fba : 91 46 __ STA (T7 + 0),y
+0fbc : e6 53 __ INC T1 + 0
+0fbe : e6 43 __ INC T3 + 0
+0fc0 : a5 43 __ LDA T3 + 0
+0fc2 : c9 0a __ CMP #$0a
+0fc4 : 90 ee __ BCC $0fb4
+0fc6 : a0 00 __ LDY #$00
+0fc8 : 4c 42 0c JMP $0c42 ; (sprintf + 189)
+0fcb : c6 43 __ DEC T3 + 0
+0fcd : a0 09 __ LDY #$09
+0fcf : b1 23 __ LDA (SP + 0),y
+0fd1 : a4 43 __ LDY T3 + 0
+0fd3 : 91 46 __ STA (T7 + 0),y
+0fd5 : 4c 8d 0f JMP $0f8d ; (sprintf + 1032)
+0fd8 : a9 09 __ LDA #$09
+0fda : 85 44 __ STA T6 + 0
+0fdc : c5 43 __ CMP T3 + 0
+0fde : b0 03 __ BCS $0fe3
+0fe0 : 4c 37 0f JMP $0f37 ; (sprintf + 946)
+0fe3 : 4c 45 0f JMP $0f45 ; (sprintf + 960)
+0fe6 : a5 48 __ LDA T8 + 0
+0fe8 : 85 1b __ STA ACCU + 0
+0fea : a5 49 __ LDA T8 + 1
+0fec : 85 1c __ STA ACCU + 1
+0fee : a0 0c __ LDY #$0c
+0ff0 : b1 23 __ LDA (SP + 0),y
+0ff2 : 85 03 __ STA $03
+0ff4 : c8 __ __ INY
+0ff5 : b1 23 __ LDA (SP + 0),y
+0ff7 : 85 04 __ STA $04
+0ff9 : 20 ca 1f JSR $1fca ; (divmod + 0)
+0ffc : a5 06 __ LDA $06
+0ffe : 10 30 __ BPL $1030
+1000 : 18 __ __ CLC
+1001 : a5 05 __ LDA $05
+1003 : 69 30 __ ADC #$30
+1005 : c6 43 __ DEC T3 + 0
+1007 : a4 43 __ LDY T3 + 0
+1009 : 91 46 __ STA (T7 + 0),y
+100b : a5 48 __ LDA T8 + 0
+100d : 85 1b __ STA ACCU + 0
+100f : a5 49 __ LDA T8 + 1
+1011 : 85 1c __ STA ACCU + 1
+1013 : a0 0c __ LDY #$0c
+1015 : b1 23 __ LDA (SP + 0),y
+1017 : 85 03 __ STA $03
+1019 : c8 __ __ INY
+101a : b1 23 __ LDA (SP + 0),y
+101c : 85 04 __ STA $04
+101e : 20 ca 1f JSR $1fca ; (divmod + 0)
+1021 : a5 1b __ LDA ACCU + 0
+1023 : 85 48 __ STA T8 + 0
+1025 : a5 1c __ LDA ACCU + 1
+1027 : 85 49 __ STA T8 + 1
+1029 : 05 1b __ ORA ACCU + 0
+102b : d0 b9 __ BNE $0fe6
+102d : 4c 1f 0f JMP $0f1f ; (sprintf + 922)
+1030 : d0 06 __ BNE $1038
+1032 : a5 05 __ LDA $05
+1034 : c9 0a __ CMP #$0a
+1036 : 90 c8 __ BCC $1000
+1038 : 18 __ __ CLC
+1039 : a5 05 __ LDA $05
+103b : 69 37 __ ADC #$37
+103d : 4c 05 10 JMP $1005 ; (sprintf + 1152)
+1040 : a5 57 __ LDA T4 + 0
+1042 : 85 46 __ STA T7 + 0
+1044 : a5 58 __ LDA T4 + 1
+1046 : 85 47 __ STA T7 + 1
+1048 : a0 00 __ LDY #$00
+104a : b1 59 __ LDA (T5 + 0),y
+104c : 85 48 __ STA T8 + 0
+104e : c8 __ __ INY
+104f : b1 59 __ LDA (T5 + 0),y
+1051 : 85 49 __ STA T8 + 1
+1053 : 18 __ __ CLC
+1054 : a5 59 __ LDA T5 + 0
+1056 : 69 02 __ ADC #$02
+1058 : 85 59 __ STA T5 + 0
+105a : 90 02 __ BCC $105e
+105c : e6 5a __ INC T5 + 1
+105e : a9 0a __ LDA #$0a
+1060 : 85 43 __ STA T3 + 0
+1062 : a5 48 __ LDA T8 + 0
+1064 : 05 49 __ ORA T8 + 1
+1066 : f0 03 __ BEQ $106b
+1068 : 4c 33 11 JMP $1133 ; (sprintf + 1454)
+106b : a0 0b __ LDY #$0b
+106d : b1 23 __ LDA (SP + 0),y
+106f : 85 44 __ STA T6 + 0
+1071 : c9 ff __ CMP #$ff
+1073 : d0 03 __ BNE $1078
+1075 : 4c 25 11 JMP $1125 ; (sprintf + 1440)
+1078 : 38 __ __ SEC
+1079 : a9 0a __ LDA #$0a
+107b : e5 44 __ SBC T6 + 0
+107d : 85 44 __ STA T6 + 0
+107f : c5 43 __ CMP T3 + 0
+1081 : b0 0e __ BCS $1091
+1083 : c6 43 __ DEC T3 + 0
+1085 : a9 30 __ LDA #$30
+1087 : a4 43 __ LDY T3 + 0
+1089 : 91 46 __ STA (T7 + 0),y
+108b : a5 44 __ LDA T6 + 0
+108d : c5 43 __ CMP T3 + 0
+108f : 90 f2 __ BCC $1083
+1091 : a0 10 __ LDY #$10
+1093 : b1 23 __ LDA (SP + 0),y
+1095 : f0 34 __ BEQ $10cb
+1097 : a0 0c __ LDY #$0c
+1099 : b1 23 __ LDA (SP + 0),y
+109b : 85 48 __ STA T8 + 0
+109d : c8 __ __ INY
+109e : b1 23 __ LDA (SP + 0),y
+10a0 : d0 29 __ BNE $10cb
+10a2 : a5 48 __ LDA T8 + 0
+10a4 : c9 10 __ CMP #$10
+10a6 : d0 23 __ BNE $10cb
+10a8 : 18 __ __ CLC
+10a9 : a5 43 __ LDA T3 + 0
+10ab : 69 ff __ ADC #$ff
+10ad : 18 __ __ CLC
+10ae : 65 46 __ ADC T7 + 0
+10b0 : 85 48 __ STA T8 + 0
+10b2 : a5 47 __ LDA T7 + 1
+10b4 : 69 00 __ ADC #$00
+10b6 : 85 49 __ STA T8 + 1
+10b8 : a9 58 __ LDA #$58
+10ba : a0 00 __ LDY #$00
+10bc : 91 48 __ STA (T8 + 0),y
+10be : 18 __ __ CLC
+10bf : a5 43 __ LDA T3 + 0
+10c1 : 69 fe __ ADC #$fe
+10c3 : 85 43 __ STA T3 + 0
+10c5 : a9 30 __ LDA #$30
+10c7 : a4 43 __ LDY T3 + 0
+10c9 : 91 46 __ STA (T7 + 0),y
+10cb : a0 0e __ LDY #$0e
+10cd : b1 23 __ LDA (SP + 0),y
+10cf : f0 08 __ BEQ $10d9
+10d1 : c6 43 __ DEC T3 + 0
+10d3 : a9 2b __ LDA #$2b
+10d5 : a4 43 __ LDY T3 + 0
+10d7 : 91 46 __ STA (T7 + 0),y
+10d9 : a0 0a __ LDY #$0a
+10db : b1 23 __ LDA (SP + 0),y
+10dd : 85 53 __ STA T1 + 0
+10df : 38 __ __ SEC
+10e0 : a9 0a __ LDA #$0a
+10e2 : e5 53 __ SBC T1 + 0
+10e4 : 85 48 __ STA T8 + 0
+10e6 : a9 00 __ LDA #$00
+10e8 : e9 00 __ SBC #$00
+10ea : 49 80 __ EOR #$80
+10ec : c9 80 __ CMP #$80
+10ee : d0 04 __ BNE $10f4
+10f0 : a5 48 __ LDA T8 + 0
+10f2 : c5 43 __ CMP T3 + 0
+10f4 : 90 22 __ BCC $1118
+10f6 : a9 00 __ LDA #$00
+10f8 : 85 53 __ STA T1 + 0
+10fa : a5 43 __ LDA T3 + 0
+10fc : c9 0a __ CMP #$0a
+10fe : 90 03 __ BCC $1103
+1100 : 4c c6 0f JMP $0fc6 ; (sprintf + 1089)
+1103 : a4 43 __ LDY T3 + 0
+1105 : b1 46 __ LDA (T7 + 0),y
+1107 : a4 53 __ LDY T1 + 0
+1109 : 91 46 __ STA (T7 + 0),y
+110b : e6 53 __ INC T1 + 0
+110d : e6 43 __ INC T3 + 0
+110f : a5 43 __ LDA T3 + 0
+1111 : c9 0a __ CMP #$0a
+1113 : 90 ee __ BCC $1103
+1115 : 4c c6 0f JMP $0fc6 ; (sprintf + 1089)
+1118 : c6 43 __ DEC T3 + 0
+111a : a0 09 __ LDY #$09
+111c : b1 23 __ LDA (SP + 0),y
+111e : a4 43 __ LDY T3 + 0
+1120 : 91 46 __ STA (T7 + 0),y
+1122 : 4c d9 10 JMP $10d9 ; (sprintf + 1364)
+1125 : a9 09 __ LDA #$09
+1127 : 85 44 __ STA T6 + 0
+1129 : c5 43 __ CMP T3 + 0
+112b : b0 03 __ BCS $1130
+112d : 4c 83 10 JMP $1083 ; (sprintf + 1278)
+1130 : 4c 91 10 JMP $1091 ; (sprintf + 1292)
+1133 : a5 48 __ LDA T8 + 0
+1135 : 85 1b __ STA ACCU + 0
+1137 : a5 49 __ LDA T8 + 1
+1139 : 85 1c __ STA ACCU + 1
+113b : a0 0c __ LDY #$0c
+113d : b1 23 __ LDA (SP + 0),y
+113f : 85 03 __ STA $03
+1141 : c8 __ __ INY
+1142 : b1 23 __ LDA (SP + 0),y
+1144 : 85 04 __ STA $04
+1146 : 20 ca 1f JSR $1fca ; (divmod + 0)
+1149 : a5 06 __ LDA $06
+114b : 10 30 __ BPL $117d
+114d : 18 __ __ CLC
+114e : a5 05 __ LDA $05
+1150 : 69 30 __ ADC #$30
+1152 : c6 43 __ DEC T3 + 0
+1154 : a4 43 __ LDY T3 + 0
+1156 : 91 46 __ STA (T7 + 0),y
+1158 : a5 48 __ LDA T8 + 0
+115a : 85 1b __ STA ACCU + 0
+115c : a5 49 __ LDA T8 + 1
+115e : 85 1c __ STA ACCU + 1
+1160 : a0 0c __ LDY #$0c
+1162 : b1 23 __ LDA (SP + 0),y
+1164 : 85 03 __ STA $03
+1166 : c8 __ __ INY
+1167 : b1 23 __ LDA (SP + 0),y
+1169 : 85 04 __ STA $04
+116b : 20 ca 1f JSR $1fca ; (divmod + 0)
+116e : a5 1b __ LDA ACCU + 0
+1170 : 85 48 __ STA T8 + 0
+1172 : a5 1c __ LDA ACCU + 1
+1174 : 85 49 __ STA T8 + 1
+1176 : 05 1b __ ORA ACCU + 0
+1178 : d0 b9 __ BNE $1133
+117a : 4c 6b 10 JMP $106b ; (sprintf + 1254)
+117d : d0 06 __ BNE $1185
+117f : a5 05 __ LDA $05
+1181 : c9 0a __ CMP #$0a
+1183 : 90 c8 __ BCC $114d
+1185 : 18 __ __ CLC
+1186 : a5 05 __ LDA $05
+1188 : 69 37 __ ADC #$37
+118a : 4c 52 11 JMP $1152 ; (sprintf + 1485)
+118d : a5 57 __ LDA T4 + 0
+118f : 85 46 __ STA T7 + 0
+1191 : a5 58 __ LDA T4 + 1
+1193 : 85 47 __ STA T7 + 1
+1195 : a0 00 __ LDY #$00
+1197 : b1 59 __ LDA (T5 + 0),y
+1199 : 85 48 __ STA T8 + 0
+119b : c8 __ __ INY
+119c : b1 59 __ LDA (T5 + 0),y
+119e : 85 49 __ STA T8 + 1
+11a0 : 18 __ __ CLC
+11a1 : a5 59 __ LDA T5 + 0
+11a3 : 69 02 __ ADC #$02
+11a5 : 85 59 __ STA T5 + 0
+11a7 : 90 02 __ BCC $11ab
+11a9 : e6 5a __ INC T5 + 1
+11ab : a5 49 __ LDA T8 + 1
+11ad : 10 03 __ BPL $11b2
+11af : 4c fc 12 JMP $12fc ; (sprintf + 1911)
+11b2 : a5 48 __ LDA T8 + 0
+11b4 : 85 4a __ STA T9 + 0
+11b6 : a5 49 __ LDA T8 + 1
+11b8 : 85 4b __ STA T9 + 1
+11ba : a9 00 __ LDA #$00
+11bc : 85 53 __ STA T1 + 0
+11be : a9 0a __ LDA #$0a
+11c0 : 85 43 __ STA T3 + 0
+11c2 : a5 48 __ LDA T8 + 0
+11c4 : 05 49 __ ORA T8 + 1
+11c6 : f0 03 __ BEQ $11cb
+11c8 : 4c a2 12 JMP $12a2 ; (sprintf + 1821)
+11cb : a0 0b __ LDY #$0b
+11cd : b1 23 __ LDA (SP + 0),y
+11cf : 85 44 __ STA T6 + 0
+11d1 : c9 ff __ CMP #$ff
+11d3 : d0 03 __ BNE $11d8
+11d5 : 4c 94 12 JMP $1294 ; (sprintf + 1807)
+11d8 : 38 __ __ SEC
+11d9 : a9 0a __ LDA #$0a
+11db : e5 44 __ SBC T6 + 0
+11dd : 85 44 __ STA T6 + 0
+11df : c5 43 __ CMP T3 + 0
+11e1 : b0 0e __ BCS $11f1
+11e3 : c6 43 __ DEC T3 + 0
+11e5 : a9 30 __ LDA #$30
+11e7 : a4 43 __ LDY T3 + 0
+11e9 : 91 46 __ STA (T7 + 0),y
+11eb : a5 44 __ LDA T6 + 0
+11ed : c5 43 __ CMP T3 + 0
+11ef : 90 f2 __ BCC $11e3
+11f1 : a0 10 __ LDY #$10
+11f3 : b1 23 __ LDA (SP + 0),y
+11f5 : f0 34 __ BEQ $122b
+11f7 : a0 0c __ LDY #$0c
+11f9 : b1 23 __ LDA (SP + 0),y
+11fb : 85 48 __ STA T8 + 0
+11fd : c8 __ __ INY
+11fe : b1 23 __ LDA (SP + 0),y
+1200 : d0 29 __ BNE $122b
+1202 : a5 48 __ LDA T8 + 0
+1204 : c9 10 __ CMP #$10
+1206 : d0 23 __ BNE $122b
+1208 : 18 __ __ CLC
+1209 : a5 43 __ LDA T3 + 0
+120b : 69 ff __ ADC #$ff
+120d : 18 __ __ CLC
+120e : 65 46 __ ADC T7 + 0
+1210 : 85 48 __ STA T8 + 0
+1212 : a5 47 __ LDA T7 + 1
+1214 : 69 00 __ ADC #$00
+1216 : 85 49 __ STA T8 + 1
+1218 : a9 58 __ LDA #$58
+121a : a0 00 __ LDY #$00
+121c : 91 48 __ STA (T8 + 0),y
+121e : 18 __ __ CLC
+121f : a5 43 __ LDA T3 + 0
+1221 : 69 fe __ ADC #$fe
+1223 : 85 43 __ STA T3 + 0
+1225 : a9 30 __ LDA #$30
+1227 : a4 43 __ LDY T3 + 0
+1229 : 91 46 __ STA (T7 + 0),y
+122b : a5 53 __ LDA T1 + 0
+122d : d0 5a __ BNE $1289
+122f : a0 0e __ LDY #$0e
+1231 : b1 23 __ LDA (SP + 0),y
+1233 : f0 08 __ BEQ $123d
+1235 : c6 43 __ DEC T3 + 0
+1237 : a9 2b __ LDA #$2b
+1239 : a4 43 __ LDY T3 + 0
+123b : 91 46 __ STA (T7 + 0),y
+123d : a0 0a __ LDY #$0a
+123f : b1 23 __ LDA (SP + 0),y
+1241 : 85 53 __ STA T1 + 0
+1243 : 38 __ __ SEC
+1244 : a9 0a __ LDA #$0a
+1246 : e5 53 __ SBC T1 + 0
+1248 : 85 48 __ STA T8 + 0
+124a : a9 00 __ LDA #$00
+124c : e9 00 __ SBC #$00
+124e : 49 80 __ EOR #$80
+1250 : c9 80 __ CMP #$80
+1252 : d0 04 __ BNE $1258
+1254 : a5 48 __ LDA T8 + 0
+1256 : c5 43 __ CMP T3 + 0
+1258 : 90 22 __ BCC $127c
+125a : a9 00 __ LDA #$00
+125c : 85 53 __ STA T1 + 0
+125e : a5 43 __ LDA T3 + 0
+1260 : c9 0a __ CMP #$0a
+1262 : 90 03 __ BCC $1267
+1264 : 4c c6 0f JMP $0fc6 ; (sprintf + 1089)
+1267 : a4 43 __ LDY T3 + 0
+1269 : b1 46 __ LDA (T7 + 0),y
+126b : a4 53 __ LDY T1 + 0
+126d : 91 46 __ STA (T7 + 0),y
+126f : e6 53 __ INC T1 + 0
+1271 : e6 43 __ INC T3 + 0
+1273 : a5 43 __ LDA T3 + 0
+1275 : c9 0a __ CMP #$0a
+1277 : 90 ee __ BCC $1267
+1279 : 4c c6 0f JMP $0fc6 ; (sprintf + 1089)
+127c : c6 43 __ DEC T3 + 0
+127e : a0 09 __ LDY #$09
+1280 : b1 23 __ LDA (SP + 0),y
+1282 : a4 43 __ LDY T3 + 0
+1284 : 91 46 __ STA (T7 + 0),y
+1286 : 4c 3d 12 JMP $123d ; (sprintf + 1720)
+1289 : c6 43 __ DEC T3 + 0
+128b : a9 2d __ LDA #$2d
+128d : a4 43 __ LDY T3 + 0
+128f : 91 46 __ STA (T7 + 0),y
+1291 : 4c 3d 12 JMP $123d ; (sprintf + 1720)
+1294 : a9 09 __ LDA #$09
+1296 : 85 44 __ STA T6 + 0
+1298 : c5 43 __ CMP T3 + 0
+129a : b0 03 __ BCS $129f
+129c : 4c e3 11 JMP $11e3 ; (sprintf + 1630)
+129f : 4c f1 11 JMP $11f1 ; (sprintf + 1644)
+12a2 : a5 4a __ LDA T9 + 0
+12a4 : 85 1b __ STA ACCU + 0
+12a6 : a5 4b __ LDA T9 + 1
+12a8 : 85 1c __ STA ACCU + 1
+12aa : a0 0c __ LDY #$0c
+12ac : b1 23 __ LDA (SP + 0),y
+12ae : 85 03 __ STA $03
+12b0 : c8 __ __ INY
+12b1 : b1 23 __ LDA (SP + 0),y
+12b3 : 85 04 __ STA $04
+12b5 : 20 ca 1f JSR $1fca ; (divmod + 0)
+12b8 : a5 06 __ LDA $06
+12ba : 10 30 __ BPL $12ec
+12bc : 18 __ __ CLC
+12bd : a5 05 __ LDA $05
+12bf : 69 30 __ ADC #$30
+12c1 : c6 43 __ DEC T3 + 0
+12c3 : a4 43 __ LDY T3 + 0
+12c5 : 91 46 __ STA (T7 + 0),y
+12c7 : a5 4a __ LDA T9 + 0
+12c9 : 85 1b __ STA ACCU + 0
+12cb : a5 4b __ LDA T9 + 1
+12cd : 85 1c __ STA ACCU + 1
+12cf : a0 0c __ LDY #$0c
+12d1 : b1 23 __ LDA (SP + 0),y
+12d3 : 85 03 __ STA $03
+12d5 : c8 __ __ INY
+12d6 : b1 23 __ LDA (SP + 0),y
+12d8 : 85 04 __ STA $04
+12da : 20 ca 1f JSR $1fca ; (divmod + 0)
+12dd : a5 1b __ LDA ACCU + 0
+12df : 85 4a __ STA T9 + 0
+12e1 : a5 1c __ LDA ACCU + 1
+12e3 : 85 4b __ STA T9 + 1
+12e5 : 05 1b __ ORA ACCU + 0
+12e7 : d0 b9 __ BNE $12a2
+12e9 : 4c cb 11 JMP $11cb ; (sprintf + 1606)
+12ec : d0 06 __ BNE $12f4
+12ee : a5 05 __ LDA $05
+12f0 : c9 0a __ CMP #$0a
+12f2 : 90 c8 __ BCC $12bc
+12f4 : 18 __ __ CLC
+12f5 : a5 05 __ LDA $05
+12f7 : 69 37 __ ADC #$37
+12f9 : 4c c1 12 JMP $12c1 ; (sprintf + 1852)
+12fc : a9 01 __ LDA #$01
+12fe : 85 53 __ STA T1 + 0
+1300 : a9 0a __ LDA #$0a
+1302 : 85 43 __ STA T3 + 0
+1304 : 38 __ __ SEC
+1305 : a9 00 __ LDA #$00
+1307 : e5 48 __ SBC T8 + 0
+1309 : 85 4a __ STA T9 + 0
+130b : a9 00 __ LDA #$00
+130d : e5 49 __ SBC T8 + 1
+130f : 85 4b __ STA T9 + 1
+1311 : 05 4a __ ORA T9 + 0
+1313 : d0 8d __ BNE $12a2
+1315 : 4c cb 11 JMP $11cb ; (sprintf + 1606)
+1318 : a9 00 __ LDA #$00
+131a : 85 46 __ STA T7 + 0
+131c : 85 47 __ STA T7 + 1
+131e : a0 00 __ LDY #$00
+1320 : b1 55 __ LDA (T2 + 0),y
+1322 : 85 43 __ STA T3 + 0
+1324 : e6 55 __ INC T2 + 0
+1326 : d0 02 __ BNE $132a
+1328 : e6 56 __ INC T2 + 1
+132a : a5 43 __ LDA T3 + 0
+132c : c9 30 __ CMP #$30
+132e : 90 4d __ BCC $137d
+1330 : a9 39 __ LDA #$39
+1332 : c5 43 __ CMP T3 + 0
+1334 : 90 47 __ BCC $137d
+1336 : a5 43 __ LDA T3 + 0
+1338 : 85 48 __ STA T8 + 0
+133a : a0 00 __ LDY #$00
+133c : b1 55 __ LDA (T2 + 0),y
+133e : 85 43 __ STA T3 + 0
+1340 : e6 55 __ INC T2 + 0
+1342 : d0 02 __ BNE $1346
+1344 : e6 56 __ INC T2 + 1
+1346 : a5 46 __ LDA T7 + 0
+1348 : 0a __ __ ASL
+1349 : 85 07 __ STA $07
+134b : a5 47 __ LDA T7 + 1
+134d : 2a __ __ ROL
+134e : 06 07 __ ASL $07
+1350 : 2a __ __ ROL
+1351 : aa __ __ TAX
+1352 : 18 __ __ CLC
+1353 : a5 07 __ LDA $07
+1355 : 65 46 __ ADC T7 + 0
+1357 : 85 1b __ STA ACCU + 0
+1359 : 8a __ __ TXA
+135a : 65 47 __ ADC T7 + 1
+135c : 06 1b __ ASL ACCU + 0
+135e : 2a __ __ ROL
+135f : 85 1c __ STA ACCU + 1
+1361 : 18 __ __ CLC
+1362 : a5 1b __ LDA ACCU + 0
+1364 : 65 48 __ ADC T8 + 0
+1366 : aa __ __ TAX
+1367 : a5 1c __ LDA ACCU + 1
+1369 : 69 00 __ ADC #$00
+136b : a8 __ __ TAY
+136c : 38 __ __ SEC
+136d : 8a __ __ TXA
+136e : e9 30 __ SBC #$30
+1370 : 85 46 __ STA T7 + 0
+1372 : 98 __ __ TYA
+1373 : e9 00 __ SBC #$00
+1375 : 85 47 __ STA T7 + 1
+1377 : a5 43 __ LDA T3 + 0
+1379 : c9 30 __ CMP #$30
+137b : b0 b3 __ BCS $1330
+137d : a5 46 __ LDA T7 + 0
+137f : a0 0b __ LDY #$0b
+1381 : 91 23 __ STA (SP + 0),y
+1383 : 4c 26 0d JMP $0d26 ; (sprintf + 417)
+1386 : a9 01 __ LDA #$01
+1388 : a0 10 __ LDY #$10
+138a : 91 23 __ STA (SP + 0),y
+138c : a0 00 __ LDY #$00
+138e : b1 55 __ LDA (T2 + 0),y
+1390 : 85 43 __ STA T3 + 0
+1392 : 4c 97 0c JMP $0c97 ; (sprintf + 274)
+1395 : a9 30 __ LDA #$30
+1397 : a0 09 __ LDY #$09
+1399 : 91 23 __ STA (SP + 0),y
+139b : a0 00 __ LDY #$00
+139d : b1 55 __ LDA (T2 + 0),y
+139f : 85 43 __ STA T3 + 0
+13a1 : 4c 97 0c JMP $0c97 ; (sprintf + 274)
+13a4 : a9 01 __ LDA #$01
+13a6 : a0 0e __ LDY #$0e
+13a8 : 91 23 __ STA (SP + 0),y
+13aa : a0 00 __ LDY #$00
+13ac : b1 55 __ LDA (T2 + 0),y
+13ae : 85 43 __ STA T3 + 0
+13b0 : 4c 97 0c JMP $0c97 ; (sprintf + 274)
+--------------------------------------------------------------------
+nforml:
+13b3 : 38 __ __ SEC
+13b4 : a5 23 __ LDA SP + 0
+13b6 : e9 05 __ SBC #$05
+13b8 : 85 23 __ STA SP + 0
+13ba : a5 24 __ LDA SP + 1
+13bc : e9 00 __ SBC #$00
+13be : 85 24 __ STA SP + 1
+13c0 : a0 01 __ LDY #$01
+13c2 : b9 53 00 LDA $0053,y 
+13c5 : 91 23 __ STA (SP + 0),y
+13c7 : 88 __ __ DEY
+13c8 : 10 f8 __ BPL $13c2
+13ca : a5 11 __ LDA P4
+13cc : 85 47 __ STA T1 + 0
+13ce : a5 12 __ LDA P5
+13d0 : 85 48 __ STA T1 + 1
+13d2 : a5 13 __ LDA P6
+13d4 : 85 49 __ STA T1 + 2
+13d6 : a5 14 __ LDA P7
+13d8 : 85 4a __ STA T1 + 3
+13da : a9 00 __ LDA #$00
+13dc : 85 4d __ STA T3 + 0
+13de : a5 15 __ LDA P8
+13e0 : f0 03 __ BEQ $13e5
+13e2 : 4c 8b 15 JMP $158b ; (nforml + 472)
+13e5 : a9 10 __ LDA #$10
+13e7 : 85 4e __ STA T4 + 0
+13e9 : a9 00 __ LDA #$00
+13eb : c5 14 __ CMP P7
+13ed : d0 0a __ BNE $13f9
+13ef : c5 13 __ CMP P6
+13f1 : d0 06 __ BNE $13f9
+13f3 : c5 12 __ CMP P5
+13f5 : d0 02 __ BNE $13f9
+13f7 : c5 11 __ CMP P4
+13f9 : b0 03 __ BCS $13fe
+13fb : 4c ff 14 JMP $14ff ; (nforml + 332)
+13fe : a0 02 __ LDY #$02
+1400 : b1 0d __ LDA (P0),y
+1402 : 85 4f __ STA T5 + 0
+1404 : c9 ff __ CMP #$ff
+1406 : d0 03 __ BNE $140b
+1408 : 4c f1 14 JMP $14f1 ; (nforml + 318)
+140b : 38 __ __ SEC
+140c : a9 10 __ LDA #$10
+140e : e5 4f __ SBC T5 + 0
+1410 : 85 4f __ STA T5 + 0
+1412 : c5 4e __ CMP T4 + 0
+1414 : b0 0e __ BCS $1424
+1416 : c6 4e __ DEC T4 + 0
+1418 : a9 30 __ LDA #$30
+141a : a4 4e __ LDY T4 + 0
+141c : 91 0f __ STA (P2),y
+141e : a5 4f __ LDA T5 + 0
+1420 : c5 4e __ CMP T4 + 0
+1422 : 90 f2 __ BCC $1416
+1424 : a0 07 __ LDY #$07
+1426 : b1 0d __ LDA (P0),y
+1428 : f0 34 __ BEQ $145e
+142a : a0 03 __ LDY #$03
+142c : b1 0d __ LDA (P0),y
+142e : 85 53 __ STA T7 + 0
+1430 : c8 __ __ INY
+1431 : b1 0d __ LDA (P0),y
+1433 : d0 29 __ BNE $145e
+1435 : a5 53 __ LDA T7 + 0
+1437 : c9 10 __ CMP #$10
+1439 : d0 23 __ BNE $145e
+143b : 18 __ __ CLC
+143c : a5 4e __ LDA T4 + 0
+143e : 69 ff __ ADC #$ff
+1440 : 18 __ __ CLC
+1441 : 65 0f __ ADC P2
+1443 : 85 53 __ STA T7 + 0
+1445 : a5 10 __ LDA P3
+1447 : 69 00 __ ADC #$00
+1449 : 85 54 __ STA T7 + 1
+144b : a9 58 __ LDA #$58
+144d : a0 00 __ LDY #$00
+144f : 91 53 __ STA (T7 + 0),y
+1451 : 18 __ __ CLC
+1452 : a5 4e __ LDA T4 + 0
+1454 : 69 fe __ ADC #$fe
+1456 : 85 4e __ STA T4 + 0
+1458 : a9 30 __ LDA #$30
+145a : a4 4e __ LDY T4 + 0
+145c : 91 0f __ STA (P2),y
+145e : a5 4d __ LDA T3 + 0
+1460 : f0 03 __ BEQ $1465
+1462 : 4c e6 14 JMP $14e6 ; (nforml + 307)
+1465 : a0 05 __ LDY #$05
+1467 : b1 0d __ LDA (P0),y
+1469 : f0 08 __ BEQ $1473
+146b : c6 4e __ DEC T4 + 0
+146d : a9 2b __ LDA #$2b
+146f : a4 4e __ LDY T4 + 0
+1471 : 91 0f __ STA (P2),y
+1473 : a0 01 __ LDY #$01
+1475 : b1 0d __ LDA (P0),y
+1477 : 85 53 __ STA T7 + 0
+1479 : 38 __ __ SEC
+147a : a9 10 __ LDA #$10
+147c : e5 53 __ SBC T7 + 0
+147e : 85 53 __ STA T7 + 0
+1480 : a9 00 __ LDA #$00
+1482 : e9 00 __ SBC #$00
+1484 : 49 80 __ EOR #$80
+1486 : c9 80 __ CMP #$80
+1488 : d0 04 __ BNE $148e
+148a : a5 53 __ LDA T7 + 0
+148c : c5 4e __ CMP T4 + 0
+148e : 90 49 __ BCC $14d9
+1490 : a9 00 __ LDA #$00
+1492 : 85 4d __ STA T3 + 0
+1494 : a5 4e __ LDA T4 + 0
+1496 : c9 10 __ CMP #$10
+1498 : 90 20 __ BCC $14ba
+149a : a5 4d __ LDA T3 + 0
+149c : 85 1b __ STA ACCU + 0
+149e : a9 00 __ LDA #$00
+14a0 : 85 1c __ STA ACCU + 1
+14a2 : a0 01 __ LDY #$01
+14a4 : b1 23 __ LDA (SP + 0),y
+14a6 : 99 53 00 STA $0053,y 
+14a9 : 88 __ __ DEY
+14aa : 10 f8 __ BPL $14a4
+14ac : 18 __ __ CLC
+14ad : a5 23 __ LDA SP + 0
+14af : 69 05 __ ADC #$05
+14b1 : 85 23 __ STA SP + 0
+14b3 : a5 24 __ LDA SP + 1
+14b5 : 69 00 __ ADC #$00
+14b7 : 85 24 __ STA SP + 1
+14b9 : 60 __ __ RTS
+14ba : aa __ __ TAX
+14bb : 8a __ __ TXA
+14bc : 18 __ __ CLC
+14bd : 65 0f __ ADC P2
+14bf : 85 51 __ STA T6 + 0
+14c1 : a5 10 __ LDA P3
+14c3 : 69 00 __ ADC #$00
+14c5 : 85 52 __ STA T6 + 1
+14c7 : a0 00 __ LDY #$00
+14c9 : b1 51 __ LDA (T6 + 0),y
+14cb : a4 4d __ LDY T3 + 0
+14cd : 91 0f __ STA (P2),y
+14cf : e6 4d __ INC T3 + 0
+14d1 : e8 __ __ INX
+14d2 : e0 10 __ CPX #$10
+14d4 : 90 e5 __ BCC $14bb
+14d6 : 4c 9a 14 JMP $149a ; (nforml + 231)
+14d9 : c6 4e __ DEC T4 + 0
+14db : a0 00 __ LDY #$00
+14dd : b1 0d __ LDA (P0),y
+14df : a4 4e __ LDY T4 + 0
+14e1 : 91 0f __ STA (P2),y
+14e3 : 4c 73 14 JMP $1473 ; (nforml + 192)
+14e6 : c6 4e __ DEC T4 + 0
+14e8 : a9 2d __ LDA #$2d
+14ea : a4 4e __ LDY T4 + 0
+14ec : 91 0f __ STA (P2),y
+14ee : 4c 73 14 JMP $1473 ; (nforml + 192)
+14f1 : a9 0f __ LDA #$0f
+14f3 : 85 4f __ STA T5 + 0
+14f5 : c5 4e __ CMP T4 + 0
+14f7 : b0 03 __ BCS $14fc
+14f9 : 4c 16 14 JMP $1416 ; (nforml + 99)
+14fc : 4c 24 14 JMP $1424 ; (nforml + 113)
+14ff : a0 03 __ LDY #$03
+1501 : b1 0d __ LDA (P0),y
+1503 : 85 03 __ STA $03
+1505 : c8 __ __ INY
+1506 : b1 0d __ LDA (P0),y
+1508 : 85 04 __ STA $04
+150a : a9 00 __ LDA #$00
+150c : 85 05 __ STA $05
+150e : 85 06 __ STA $06
+1510 : a5 47 __ LDA T1 + 0
+1512 : 85 1b __ STA ACCU + 0
+1514 : a5 48 __ LDA T1 + 1
+1516 : 85 1c __ STA ACCU + 1
+1518 : a5 49 __ LDA T1 + 2
+151a : 85 1d __ STA ACCU + 2
+151c : a5 4a __ LDA T1 + 3
+151e : 85 1e __ STA ACCU + 3
+1520 : 20 56 21 JSR $2156 ; (divmod32 + 0)
+1523 : a5 08 __ LDA $08
+1525 : 10 54 __ BPL $157b
+1527 : 18 __ __ CLC
+1528 : a5 07 __ LDA $07
+152a : 69 30 __ ADC #$30
+152c : c6 4e __ DEC T4 + 0
+152e : a4 4e __ LDY T4 + 0
+1530 : 91 0f __ STA (P2),y
+1532 : a0 03 __ LDY #$03
+1534 : b1 0d __ LDA (P0),y
+1536 : 85 03 __ STA $03
+1538 : c8 __ __ INY
+1539 : b1 0d __ LDA (P0),y
+153b : 85 04 __ STA $04
+153d : a9 00 __ LDA #$00
+153f : 85 05 __ STA $05
+1541 : 85 06 __ STA $06
+1543 : a5 47 __ LDA T1 + 0
+1545 : 85 1b __ STA ACCU + 0
+1547 : a5 48 __ LDA T1 + 1
+1549 : 85 1c __ STA ACCU + 1
+154b : a5 49 __ LDA T1 + 2
+154d : 85 1d __ STA ACCU + 2
+154f : a5 4a __ LDA T1 + 3
+1551 : 85 1e __ STA ACCU + 3
+1553 : 20 56 21 JSR $2156 ; (divmod32 + 0)
+1556 : a5 1b __ LDA ACCU + 0
+1558 : 85 47 __ STA T1 + 0
+155a : a5 1c __ LDA ACCU + 1
+155c : 85 48 __ STA T1 + 1
+155e : a5 1d __ LDA ACCU + 2
+1560 : 85 49 __ STA T1 + 2
+1562 : a5 1e __ LDA ACCU + 3
+1564 : 85 4a __ STA T1 + 3
+1566 : a9 00 __ LDA #$00
+1568 : c5 1e __ CMP ACCU + 3
+156a : d0 0a __ BNE $1576
+156c : c5 1d __ CMP ACCU + 2
+156e : d0 06 __ BNE $1576
+1570 : c5 1c __ CMP ACCU + 1
+1572 : d0 02 __ BNE $1576
+1574 : c5 1b __ CMP ACCU + 0
+1576 : 90 87 __ BCC $14ff
+1578 : 4c fe 13 JMP $13fe ; (nforml + 75)
+157b : d0 06 __ BNE $1583
+157d : a5 07 __ LDA $07
+157f : c9 0a __ CMP #$0a
+1581 : 90 a4 __ BCC $1527
+1583 : 18 __ __ CLC
+1584 : a5 07 __ LDA $07
+1586 : 69 37 __ ADC #$37
+1588 : 4c 2c 15 JMP $152c ; (nforml + 377)
+158b : a5 14 __ LDA P7
+158d : 49 80 __ EOR #$80
+158f : c9 80 __ CMP #$80
+1591 : d0 0f __ BNE $15a2
+1593 : a5 13 __ LDA P6
+1595 : c9 00 __ CMP #$00
+1597 : d0 09 __ BNE $15a2
+1599 : a5 12 __ LDA P5
+159b : c9 00 __ CMP #$00
+159d : d0 03 __ BNE $15a2
+159f : 4c e5 13 JMP $13e5 ; (nforml + 50)
+15a2 : 90 03 __ BCC $15a7
+15a4 : 4c e5 13 JMP $13e5 ; (nforml + 50)
+15a7 : a9 01 __ LDA #$01
+15a9 : 85 4d __ STA T3 + 0
+15ab : a9 10 __ LDA #$10
+15ad : 85 4e __ STA T4 + 0
+15af : 38 __ __ SEC
+15b0 : a9 00 __ LDA #$00
+15b2 : e5 11 __ SBC P4
+15b4 : 85 47 __ STA T1 + 0
+15b6 : a9 00 __ LDA #$00
+15b8 : e5 12 __ SBC P5
+15ba : 85 48 __ STA T1 + 1
+15bc : a9 00 __ LDA #$00
+15be : e5 13 __ SBC P6
+15c0 : 85 49 __ STA T1 + 2
+15c2 : a9 00 __ LDA #$00
+15c4 : e5 14 __ SBC P7
+15c6 : 85 4a __ STA T1 + 3
+15c8 : a9 00 __ LDA #$00
+15ca : c5 4a __ CMP T1 + 3
+15cc : d0 0a __ BNE $15d8
+15ce : c5 49 __ CMP T1 + 2
+15d0 : d0 06 __ BNE $15d8
+15d2 : c5 48 __ CMP T1 + 1
+15d4 : d0 02 __ BNE $15d8
+15d6 : c5 47 __ CMP T1 + 0
+15d8 : b0 03 __ BCS $15dd
+15da : 4c ff 14 JMP $14ff ; (nforml + 332)
+15dd : 4c fe 13 JMP $13fe ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+15e0 : 38 __ __ SEC
+15e1 : a5 23 __ LDA SP + 0
+15e3 : e9 0a __ SBC #$0a
+15e5 : 85 23 __ STA SP + 0
+15e7 : a5 24 __ LDA SP + 1
+15e9 : e9 00 __ SBC #$00
+15eb : 85 24 __ STA SP + 1
+15ed : a0 03 __ LDY #$03
+15ef : b9 53 00 LDA $0053,y 
+15f2 : 91 23 __ STA (SP + 0),y
+15f4 : 88 __ __ DEY
+15f5 : 10 f8 __ BPL $15ef
+15f7 : a9 00 __ LDA #$00
+15f9 : 85 1b __ STA ACCU + 0
+15fb : 85 1c __ STA ACCU + 1
+15fd : 85 1d __ STA ACCU + 2
+15ff : 85 1e __ STA ACCU + 3
+1601 : a5 11 __ LDA P4
+1603 : 85 03 __ STA $03
+1605 : a5 12 __ LDA P5
+1607 : 85 04 __ STA $04
+1609 : a5 13 __ LDA P6
+160b : 85 05 __ STA $05
+160d : a5 14 __ LDA P7
+160f : 85 06 __ STA $06
+1611 : 20 05 21 JSR $2105 ; (fcmp + 0)
+1614 : 10 03 __ BPL $1619
+1616 : 4c 44 1c JMP $1c44 ; (nformf + 1636)
+1619 : a9 00 __ LDA #$00
+161b : 85 4b __ STA T3 + 0
+161d : a0 05 __ LDY #$05
+161f : b1 0d __ LDA (P0),y
+1621 : f0 0a __ BEQ $162d
+1623 : a9 2b __ LDA #$2b
+1625 : a0 00 __ LDY #$00
+1627 : 91 0f __ STA (P2),y
+1629 : a9 01 __ LDA #$01
+162b : 85 4b __ STA T3 + 0
+162d : a9 00 __ LDA #$00
+162f : 85 43 __ STA T0 + 0
+1631 : 85 44 __ STA T0 + 1
+1633 : a0 02 __ LDY #$02
+1635 : b1 0d __ LDA (P0),y
+1637 : 85 4e __ STA T5 + 0
+1639 : c9 ff __ CMP #$ff
+163b : d0 04 __ BNE $1641
+163d : a9 06 __ LDA #$06
+163f : 85 4e __ STA T5 + 0
+1641 : a9 00 __ LDA #$00
+1643 : 85 1b __ STA ACCU + 0
+1645 : 85 1c __ STA ACCU + 1
+1647 : 85 1d __ STA ACCU + 2
+1649 : 85 1e __ STA ACCU + 3
+164b : a5 11 __ LDA P4
+164d : 85 03 __ STA $03
+164f : a5 12 __ LDA P5
+1651 : 85 04 __ STA $04
+1653 : a5 13 __ LDA P6
+1655 : 85 05 __ STA $05
+1657 : a5 14 __ LDA P7
+1659 : 85 06 __ STA $06
+165b : 20 05 21 JSR $2105 ; (fcmp + 0)
+165e : d0 03 __ BNE $1663
+1660 : 4c e7 17 JMP $17e7 ; (nformf + 519)
+1663 : a9 00 __ LDA #$00
+1665 : 85 1b __ STA ACCU + 0
+1667 : 85 1c __ STA ACCU + 1
+1669 : a9 7a __ LDA #$7a
+166b : 85 1d __ STA ACCU + 2
+166d : a9 44 __ LDA #$44
+166f : 85 1e __ STA ACCU + 3
+1671 : a5 11 __ LDA P4
+1673 : 85 03 __ STA $03
+1675 : a5 12 __ LDA P5
+1677 : 85 04 __ STA $04
+1679 : a5 13 __ LDA P6
+167b : 85 05 __ STA $05
+167d : a5 14 __ LDA P7
+167f : 85 06 __ STA $06
+1681 : 20 05 21 JSR $2105 ; (fcmp + 0)
+1684 : 30 5a __ BMI $16e0
+1686 : a5 11 __ LDA P4
+1688 : 85 1b __ STA ACCU + 0
+168a : a5 12 __ LDA P5
+168c : 85 1c __ STA ACCU + 1
+168e : a5 13 __ LDA P6
+1690 : 85 1d __ STA ACCU + 2
+1692 : a5 14 __ LDA P7
+1694 : 85 1e __ STA ACCU + 3
+1696 : a9 00 __ LDA #$00
+1698 : 85 03 __ STA $03
+169a : 85 04 __ STA $04
+169c : a9 7a __ LDA #$7a
+169e : 85 05 __ STA $05
+16a0 : a9 44 __ LDA #$44
+16a2 : 85 06 __ STA $06
+16a4 : 20 39 1d JSR $1d39 ; (freg + 20)
+16a7 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+16aa : a5 1b __ LDA ACCU + 0
+16ac : 85 11 __ STA P4
+16ae : 85 03 __ STA $03
+16b0 : a5 1c __ LDA ACCU + 1
+16b2 : 85 12 __ STA P5
+16b4 : 85 04 __ STA $04
+16b6 : a5 1d __ LDA ACCU + 2
+16b8 : 85 13 __ STA P6
+16ba : 85 05 __ STA $05
+16bc : a5 1e __ LDA ACCU + 3
+16be : 85 14 __ STA P7
+16c0 : 85 06 __ STA $06
+16c2 : 18 __ __ CLC
+16c3 : a5 43 __ LDA T0 + 0
+16c5 : 69 03 __ ADC #$03
+16c7 : 85 43 __ STA T0 + 0
+16c9 : 90 02 __ BCC $16cd
+16cb : e6 44 __ INC T0 + 1
+16cd : a9 00 __ LDA #$00
+16cf : 85 1b __ STA ACCU + 0
+16d1 : 85 1c __ STA ACCU + 1
+16d3 : a9 7a __ LDA #$7a
+16d5 : 85 1d __ STA ACCU + 2
+16d7 : a9 44 __ LDA #$44
+16d9 : 85 1e __ STA ACCU + 3
+16db : 20 05 21 JSR $2105 ; (fcmp + 0)
+16de : 10 a6 __ BPL $1686
+16e0 : a9 00 __ LDA #$00
+16e2 : 85 1b __ STA ACCU + 0
+16e4 : 85 1c __ STA ACCU + 1
+16e6 : a9 80 __ LDA #$80
+16e8 : 85 1d __ STA ACCU + 2
+16ea : a9 3f __ LDA #$3f
+16ec : 85 1e __ STA ACCU + 3
+16ee : a5 11 __ LDA P4
+16f0 : 85 03 __ STA $03
+16f2 : a5 12 __ LDA P5
+16f4 : 85 04 __ STA $04
+16f6 : a5 13 __ LDA P6
+16f8 : 85 05 __ STA $05
+16fa : a5 14 __ LDA P7
+16fc : 85 06 __ STA $06
+16fe : 20 05 21 JSR $2105 ; (fcmp + 0)
+1701 : 10 5c __ BPL $175f
+1703 : a5 11 __ LDA P4
+1705 : 85 1b __ STA ACCU + 0
+1707 : a5 12 __ LDA P5
+1709 : 85 1c __ STA ACCU + 1
+170b : a5 13 __ LDA P6
+170d : 85 1d __ STA ACCU + 2
+170f : a5 14 __ LDA P7
+1711 : 85 1e __ STA ACCU + 3
+1713 : a9 00 __ LDA #$00
+1715 : 85 03 __ STA $03
+1717 : 85 04 __ STA $04
+1719 : a9 7a __ LDA #$7a
+171b : 85 05 __ STA $05
+171d : a9 44 __ LDA #$44
+171f : 85 06 __ STA $06
+1721 : 20 39 1d JSR $1d39 ; (freg + 20)
+1724 : 20 32 1e JSR $1e32 ; (fmul + 0)
+1727 : a5 1b __ LDA ACCU + 0
+1729 : 85 11 __ STA P4
+172b : 85 03 __ STA $03
+172d : a5 1c __ LDA ACCU + 1
+172f : 85 12 __ STA P5
+1731 : 85 04 __ STA $04
+1733 : a5 1d __ LDA ACCU + 2
+1735 : 85 13 __ STA P6
+1737 : 85 05 __ STA $05
+1739 : a5 1e __ LDA ACCU + 3
+173b : 85 14 __ STA P7
+173d : 85 06 __ STA $06
+173f : 38 __ __ SEC
+1740 : a5 43 __ LDA T0 + 0
+1742 : e9 03 __ SBC #$03
+1744 : 85 43 __ STA T0 + 0
+1746 : a5 44 __ LDA T0 + 1
+1748 : e9 00 __ SBC #$00
+174a : 85 44 __ STA T0 + 1
+174c : a9 00 __ LDA #$00
+174e : 85 1b __ STA ACCU + 0
+1750 : 85 1c __ STA ACCU + 1
+1752 : a9 80 __ LDA #$80
+1754 : 85 1d __ STA ACCU + 2
+1756 : a9 3f __ LDA #$3f
+1758 : 85 1e __ STA ACCU + 3
+175a : 20 05 21 JSR $2105 ; (fcmp + 0)
+175d : 30 a4 __ BMI $1703
+175f : a9 00 __ LDA #$00
+1761 : 85 1b __ STA ACCU + 0
+1763 : 85 1c __ STA ACCU + 1
+1765 : a9 20 __ LDA #$20
+1767 : 85 1d __ STA ACCU + 2
+1769 : a9 41 __ LDA #$41
+176b : 85 1e __ STA ACCU + 3
+176d : a5 11 __ LDA P4
+176f : 85 03 __ STA $03
+1771 : a5 12 __ LDA P5
+1773 : 85 04 __ STA $04
+1775 : a5 13 __ LDA P6
+1777 : 85 05 __ STA $05
+1779 : a5 14 __ LDA P7
+177b : 85 06 __ STA $06
+177d : 20 05 21 JSR $2105 ; (fcmp + 0)
+1780 : 30 65 __ BMI $17e7
+1782 : a5 11 __ LDA P4
+1784 : 85 1b __ STA ACCU + 0
+1786 : a5 12 __ LDA P5
+1788 : 85 1c __ STA ACCU + 1
+178a : a5 13 __ LDA P6
+178c : 85 1d __ STA ACCU + 2
+178e : a5 14 __ LDA P7
+1790 : 85 1e __ STA ACCU + 3
+1792 : a9 00 __ LDA #$00
+1794 : 85 03 __ STA $03
+1796 : 85 04 __ STA $04
+1798 : a9 20 __ LDA #$20
+179a : 85 05 __ STA $05
+179c : a9 41 __ LDA #$41
+179e : 85 06 __ STA $06
+17a0 : 20 39 1d JSR $1d39 ; (freg + 20)
+17a3 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+17a6 : a5 1b __ LDA ACCU + 0
+17a8 : 85 11 __ STA P4
+17aa : 85 47 __ STA T2 + 0
+17ac : a5 1c __ LDA ACCU + 1
+17ae : 85 12 __ STA P5
+17b0 : 85 48 __ STA T2 + 1
+17b2 : a5 1d __ LDA ACCU + 2
+17b4 : 85 13 __ STA P6
+17b6 : 85 49 __ STA T2 + 2
+17b8 : a5 1e __ LDA ACCU + 3
+17ba : 85 14 __ STA P7
+17bc : 85 4a __ STA T2 + 3
+17be : e6 43 __ INC T0 + 0
+17c0 : d0 02 __ BNE $17c4
+17c2 : e6 44 __ INC T0 + 1
+17c4 : a9 00 __ LDA #$00
+17c6 : 85 1b __ STA ACCU + 0
+17c8 : 85 1c __ STA ACCU + 1
+17ca : a9 20 __ LDA #$20
+17cc : 85 1d __ STA ACCU + 2
+17ce : a9 41 __ LDA #$41
+17d0 : 85 1e __ STA ACCU + 3
+17d2 : a5 47 __ LDA T2 + 0
+17d4 : 85 03 __ STA $03
+17d6 : a5 48 __ LDA T2 + 1
+17d8 : 85 04 __ STA $04
+17da : a5 49 __ LDA T2 + 2
+17dc : 85 05 __ STA $05
+17de : a5 4a __ LDA T2 + 3
+17e0 : 85 06 __ STA $06
+17e2 : 20 05 21 JSR $2105 ; (fcmp + 0)
+17e5 : 10 9b __ BPL $1782
+17e7 : a5 15 __ LDA P8
+17e9 : c9 65 __ CMP #$65
+17eb : d0 03 __ BNE $17f0
+17ed : 4c 3f 1c JMP $1c3f ; (nformf + 1631)
+17f0 : a9 00 __ LDA #$00
+17f2 : 85 51 __ STA T7 + 0
+17f4 : 85 52 __ STA T8 + 0
+17f6 : a5 4e __ LDA T5 + 0
+17f8 : 85 4c __ STA T4 + 0
+17fa : e6 4c __ INC T4 + 0
+17fc : a5 15 __ LDA P8
+17fe : c9 67 __ CMP #$67
+1800 : d0 03 __ BNE $1805
+1802 : 4c 22 1c JMP $1c22 ; (nformf + 1602)
+1805 : a5 51 __ LDA T7 + 0
+1807 : f0 03 __ BEQ $180c
+1809 : 4c 30 1b JMP $1b30 ; (nformf + 1360)
+180c : a5 44 __ LDA T0 + 1
+180e : 10 03 __ BPL $1813
+1810 : 4c ef 1a JMP $1aef ; (nformf + 1295)
+1813 : a9 00 __ LDA #$00
+1815 : 85 47 __ STA T2 + 0
+1817 : 85 48 __ STA T2 + 1
+1819 : 85 49 __ STA T2 + 2
+181b : a9 3f __ LDA #$3f
+181d : 85 4a __ STA T2 + 3
+181f : 18 __ __ CLC
+1820 : a5 4e __ LDA T5 + 0
+1822 : 65 43 __ ADC T0 + 0
+1824 : 85 4c __ STA T4 + 0
+1826 : e6 4c __ INC T4 + 0
+1828 : a9 01 __ LDA #$01
+182a : c5 4c __ CMP T4 + 0
+182c : b0 03 __ BCS $1831
+182e : 4c ae 1a JMP $1aae ; (nformf + 1230)
+1831 : a5 11 __ LDA P4
+1833 : 85 1b __ STA ACCU + 0
+1835 : a5 12 __ LDA P5
+1837 : 85 1c __ STA ACCU + 1
+1839 : a5 13 __ LDA P6
+183b : 85 1d __ STA ACCU + 2
+183d : a5 14 __ LDA P7
+183f : 85 1e __ STA ACCU + 3
+1841 : a5 47 __ LDA T2 + 0
+1843 : 85 03 __ STA $03
+1845 : a5 48 __ LDA T2 + 1
+1847 : 85 04 __ STA $04
+1849 : a5 49 __ LDA T2 + 2
+184b : 85 05 __ STA $05
+184d : a5 4a __ LDA T2 + 3
+184f : 85 06 __ STA $06
+1851 : 20 39 1d JSR $1d39 ; (freg + 20)
+1854 : 20 6a 1d JSR $1d6a ; (faddsub + 0)
+1857 : a5 1b __ LDA ACCU + 0
+1859 : 85 11 __ STA P4
+185b : 85 47 __ STA T2 + 0
+185d : 85 03 __ STA $03
+185f : a5 1c __ LDA ACCU + 1
+1861 : 85 12 __ STA P5
+1863 : 85 48 __ STA T2 + 1
+1865 : 85 04 __ STA $04
+1867 : a5 1d __ LDA ACCU + 2
+1869 : 85 13 __ STA P6
+186b : 85 49 __ STA T2 + 2
+186d : 85 05 __ STA $05
+186f : a5 1e __ LDA ACCU + 3
+1871 : 85 14 __ STA P7
+1873 : 85 4a __ STA T2 + 3
+1875 : 85 06 __ STA $06
+1877 : a9 00 __ LDA #$00
+1879 : 85 1b __ STA ACCU + 0
+187b : 85 1c __ STA ACCU + 1
+187d : a9 20 __ LDA #$20
+187f : 85 1d __ STA ACCU + 2
+1881 : a9 41 __ LDA #$41
+1883 : 85 1e __ STA ACCU + 3
+1885 : 20 05 21 JSR $2105 ; (fcmp + 0)
+1888 : 30 36 __ BMI $18c0
+188a : a5 47 __ LDA T2 + 0
+188c : 85 1b __ STA ACCU + 0
+188e : a5 48 __ LDA T2 + 1
+1890 : 85 1c __ STA ACCU + 1
+1892 : a5 49 __ LDA T2 + 2
+1894 : 85 1d __ STA ACCU + 2
+1896 : a5 4a __ LDA T2 + 3
+1898 : 85 1e __ STA ACCU + 3
+189a : a9 00 __ LDA #$00
+189c : 85 03 __ STA $03
+189e : 85 04 __ STA $04
+18a0 : a9 20 __ LDA #$20
+18a2 : 85 05 __ STA $05
+18a4 : a9 41 __ LDA #$41
+18a6 : 85 06 __ STA $06
+18a8 : 20 39 1d JSR $1d39 ; (freg + 20)
+18ab : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+18ae : a5 1b __ LDA ACCU + 0
+18b0 : 85 11 __ STA P4
+18b2 : a5 1c __ LDA ACCU + 1
+18b4 : 85 12 __ STA P5
+18b6 : a5 1d __ LDA ACCU + 2
+18b8 : 85 13 __ STA P6
+18ba : a5 1e __ LDA ACCU + 3
+18bc : 85 14 __ STA P7
+18be : c6 4e __ DEC T5 + 0
+18c0 : 38 __ __ SEC
+18c1 : a5 4c __ LDA T4 + 0
+18c3 : e5 4e __ SBC T5 + 0
+18c5 : 85 53 __ STA T10 + 0
+18c7 : 85 4e __ STA T5 + 0
+18c9 : a9 14 __ LDA #$14
+18cb : c5 4c __ CMP T4 + 0
+18cd : b0 02 __ BCS $18d1
+18cf : 85 4c __ STA T4 + 0
+18d1 : a5 53 __ LDA T10 + 0
+18d3 : d0 08 __ BNE $18dd
+18d5 : a9 30 __ LDA #$30
+18d7 : a4 4b __ LDY T3 + 0
+18d9 : 91 0f __ STA (P2),y
+18db : e6 4b __ INC T3 + 0
+18dd : a9 00 __ LDA #$00
+18df : 85 50 __ STA T6 + 0
+18e1 : a5 4c __ LDA T4 + 0
+18e3 : f0 03 __ BEQ $18e8
+18e5 : 4c 1d 1a JMP $1a1d ; (nformf + 1085)
+18e8 : a5 52 __ LDA T8 + 0
+18ea : f0 03 __ BEQ $18ef
+18ec : 4c 9d 19 JMP $199d ; (nformf + 957)
+18ef : a5 4b __ LDA T3 + 0
+18f1 : a0 01 __ LDY #$01
+18f3 : d1 0d __ CMP (P0),y
+18f5 : 90 1e __ BCC $1915
+18f7 : 85 1b __ STA ACCU + 0
+18f9 : a9 00 __ LDA #$00
+18fb : 85 1c __ STA ACCU + 1
+18fd : a0 03 __ LDY #$03
+18ff : b1 23 __ LDA (SP + 0),y
+1901 : 99 53 00 STA $0053,y 
+1904 : 88 __ __ DEY
+1905 : 10 f8 __ BPL $18ff
+1907 : 18 __ __ CLC
+1908 : a5 23 __ LDA SP + 0
+190a : 69 0a __ ADC #$0a
+190c : 85 23 __ STA SP + 0
+190e : a5 24 __ LDA SP + 1
+1910 : 69 00 __ ADC #$00
+1912 : 85 24 __ STA SP + 1
+1914 : 60 __ __ RTS
+1915 : c9 01 __ CMP #$01
+1917 : 90 53 __ BCC $196c
+1919 : a9 01 __ LDA #$01
+191b : 85 4e __ STA T5 + 0
+191d : a5 0d __ LDA P0
+191f : 85 43 __ STA T0 + 0
+1921 : a5 0e __ LDA P1
+1923 : 85 44 __ STA T0 + 1
+1925 : a5 4b __ LDA T3 + 0
+1927 : 85 4c __ STA T4 + 0
+1929 : 38 __ __ SEC
+192a : a5 4c __ LDA T4 + 0
+192c : e5 4e __ SBC T5 + 0
+192e : 85 55 __ STA T11 + 0
+1930 : a9 00 __ LDA #$00
+1932 : e9 00 __ SBC #$00
+1934 : 85 56 __ STA T11 + 1
+1936 : 18 __ __ CLC
+1937 : a5 0f __ LDA P2
+1939 : 65 55 __ ADC T11 + 0
+193b : 85 55 __ STA T11 + 0
+193d : a5 10 __ LDA P3
+193f : 65 56 __ ADC T11 + 1
+1941 : 85 56 __ STA T11 + 1
+1943 : a0 01 __ LDY #$01
+1945 : b1 43 __ LDA (T0 + 0),y
+1947 : 38 __ __ SEC
+1948 : e5 4e __ SBC T5 + 0
+194a : 85 53 __ STA T10 + 0
+194c : a9 00 __ LDA #$00
+194e : e9 00 __ SBC #$00
+1950 : 85 54 __ STA T10 + 1
+1952 : 18 __ __ CLC
+1953 : a5 0f __ LDA P2
+1955 : 65 53 __ ADC T10 + 0
+1957 : 85 53 __ STA T10 + 0
+1959 : a5 10 __ LDA P3
+195b : 65 54 __ ADC T10 + 1
+195d : 85 54 __ STA T10 + 1
+195f : 88 __ __ DEY
+1960 : b1 55 __ LDA (T11 + 0),y
+1962 : 91 53 __ STA (T10 + 0),y
+1964 : e6 4e __ INC T5 + 0
+1966 : a5 4b __ LDA T3 + 0
+1968 : c5 4e __ CMP T5 + 0
+196a : b0 bd __ BCS $1929
+196c : a9 00 __ LDA #$00
+196e : 85 4e __ STA T5 + 0
+1970 : a0 01 __ LDY #$01
+1972 : b1 0d __ LDA (P0),y
+1974 : 85 50 __ STA T6 + 0
+1976 : 38 __ __ SEC
+1977 : e5 4b __ SBC T3 + 0
+1979 : 85 4c __ STA T4 + 0
+197b : a9 00 __ LDA #$00
+197d : e9 00 __ SBC #$00
+197f : 85 4d __ STA T4 + 1
+1981 : a9 00 __ LDA #$00
+1983 : c5 4d __ CMP T4 + 1
+1985 : d0 04 __ BNE $198b
+1987 : a5 4e __ LDA T5 + 0
+1989 : c5 4c __ CMP T4 + 0
+198b : 90 05 __ BCC $1992
+198d : a5 50 __ LDA T6 + 0
+198f : 4c f7 18 JMP $18f7 ; (nformf + 791)
+1992 : a9 20 __ LDA #$20
+1994 : a4 4e __ LDY T5 + 0
+1996 : 91 0f __ STA (P2),y
+1998 : e6 4e __ INC T5 + 0
+199a : 4c 70 19 JMP $1970 ; (nformf + 912)
+199d : a9 45 __ LDA #$45
+199f : a4 4b __ LDY T3 + 0
+19a1 : 91 0f __ STA (P2),y
+19a3 : c8 __ __ INY
+19a4 : a5 44 __ LDA T0 + 1
+19a6 : 30 5a __ BMI $1a02
+19a8 : a9 2b __ LDA #$2b
+19aa : 91 0f __ STA (P2),y
+19ac : 18 __ __ CLC
+19ad : a5 4b __ LDA T3 + 0
+19af : 69 02 __ ADC #$02
+19b1 : 85 4b __ STA T3 + 0
+19b3 : a5 43 __ LDA T0 + 0
+19b5 : 85 1b __ STA ACCU + 0
+19b7 : a5 44 __ LDA T0 + 1
+19b9 : 85 1c __ STA ACCU + 1
+19bb : a9 0a __ LDA #$0a
+19bd : 85 03 __ STA $03
+19bf : a9 00 __ LDA #$00
+19c1 : 85 04 __ STA $04
+19c3 : 20 90 1f JSR $1f90 ; (divs16 + 0)
+19c6 : 18 __ __ CLC
+19c7 : a5 1b __ LDA ACCU + 0
+19c9 : 69 30 __ ADC #$30
+19cb : a4 4b __ LDY T3 + 0
+19cd : 91 0f __ STA (P2),y
+19cf : c8 __ __ INY
+19d0 : 98 __ __ TYA
+19d1 : 18 __ __ CLC
+19d2 : 65 0f __ ADC P2
+19d4 : 85 4c __ STA T4 + 0
+19d6 : a5 10 __ LDA P3
+19d8 : 69 00 __ ADC #$00
+19da : 85 4d __ STA T4 + 1
+19dc : a5 43 __ LDA T0 + 0
+19de : 85 1b __ STA ACCU + 0
+19e0 : a5 44 __ LDA T0 + 1
+19e2 : 85 1c __ STA ACCU + 1
+19e4 : a9 0a __ LDA #$0a
+19e6 : 85 03 __ STA $03
+19e8 : a9 00 __ LDA #$00
+19ea : 85 04 __ STA $04
+19ec : 20 4f 20 JSR $204f ; (mods16 + 0)
+19ef : 18 __ __ CLC
+19f0 : a5 05 __ LDA $05
+19f2 : 69 30 __ ADC #$30
+19f4 : a0 00 __ LDY #$00
+19f6 : 91 4c __ STA (T4 + 0),y
+19f8 : 18 __ __ CLC
+19f9 : a5 4b __ LDA T3 + 0
+19fb : 69 02 __ ADC #$02
+19fd : 85 4b __ STA T3 + 0
+19ff : 4c ef 18 JMP $18ef ; (nformf + 783)
+1a02 : a9 2d __ LDA #$2d
+1a04 : 91 0f __ STA (P2),y
+1a06 : 18 __ __ CLC
+1a07 : a5 4b __ LDA T3 + 0
+1a09 : 69 02 __ ADC #$02
+1a0b : 85 4b __ STA T3 + 0
+1a0d : 38 __ __ SEC
+1a0e : a9 00 __ LDA #$00
+1a10 : e5 43 __ SBC T0 + 0
+1a12 : 85 43 __ STA T0 + 0
+1a14 : a9 00 __ LDA #$00
+1a16 : e5 44 __ SBC T0 + 1
+1a18 : 85 44 __ STA T0 + 1
+1a1a : 4c b3 19 JMP $19b3 ; (nformf + 979)
+1a1d : a5 50 __ LDA T6 + 0
+1a1f : c5 4e __ CMP T5 + 0
+1a21 : d0 08 __ BNE $1a2b
+1a23 : a9 2e __ LDA #$2e
+1a25 : a4 4b __ LDY T3 + 0
+1a27 : 91 0f __ STA (P2),y
+1a29 : e6 4b __ INC T3 + 0
+1a2b : a5 11 __ LDA P4
+1a2d : 85 1b __ STA ACCU + 0
+1a2f : a5 12 __ LDA P5
+1a31 : 85 1c __ STA ACCU + 1
+1a33 : a5 13 __ LDA P6
+1a35 : 85 1d __ STA ACCU + 2
+1a37 : a5 14 __ LDA P7
+1a39 : 85 1e __ STA ACCU + 3
+1a3b : 20 78 20 JSR $2078 ; (f32_to_i16 + 0)
+1a3e : a5 1b __ LDA ACCU + 0
+1a40 : 85 53 __ STA T10 + 0
+1a42 : 20 ba 20 JSR $20ba ; (sint16_to_float + 0)
+1a45 : a5 1b __ LDA ACCU + 0
+1a47 : 85 03 __ STA $03
+1a49 : a5 1c __ LDA ACCU + 1
+1a4b : 85 04 __ STA $04
+1a4d : a5 1d __ LDA ACCU + 2
+1a4f : 85 05 __ STA $05
+1a51 : a5 1e __ LDA ACCU + 3
+1a53 : 85 06 __ STA $06
+1a55 : a5 11 __ LDA P4
+1a57 : 85 1b __ STA ACCU + 0
+1a59 : a5 12 __ LDA P5
+1a5b : 85 1c __ STA ACCU + 1
+1a5d : a5 13 __ LDA P6
+1a5f : 85 1d __ STA ACCU + 2
+1a61 : a5 14 __ LDA P7
+1a63 : 85 1e __ STA ACCU + 3
+1a65 : 20 39 1d JSR $1d39 ; (freg + 20)
+1a68 : a5 06 __ LDA $06
+1a6a : 49 80 __ EOR #$80
+1a6c : 85 06 __ STA $06
+1a6e : 20 6a 1d JSR $1d6a ; (faddsub + 0)
+1a71 : a9 00 __ LDA #$00
+1a73 : 85 03 __ STA $03
+1a75 : 85 04 __ STA $04
+1a77 : a9 20 __ LDA #$20
+1a79 : 85 05 __ STA $05
+1a7b : a9 41 __ LDA #$41
+1a7d : 85 06 __ STA $06
+1a7f : 20 39 1d JSR $1d39 ; (freg + 20)
+1a82 : 20 32 1e JSR $1e32 ; (fmul + 0)
+1a85 : a5 1b __ LDA ACCU + 0
+1a87 : 85 11 __ STA P4
+1a89 : a5 1c __ LDA ACCU + 1
+1a8b : 85 12 __ STA P5
+1a8d : a5 1d __ LDA ACCU + 2
+1a8f : 85 13 __ STA P6
+1a91 : a5 1e __ LDA ACCU + 3
+1a93 : 85 14 __ STA P7
+1a95 : 18 __ __ CLC
+1a96 : a5 53 __ LDA T10 + 0
+1a98 : 69 30 __ ADC #$30
+1a9a : a4 4b __ LDY T3 + 0
+1a9c : 91 0f __ STA (P2),y
+1a9e : e6 4b __ INC T3 + 0
+1aa0 : e6 50 __ INC T6 + 0
+1aa2 : a5 50 __ LDA T6 + 0
+1aa4 : c5 4c __ CMP T4 + 0
+1aa6 : b0 03 __ BCS $1aab
+1aa8 : 4c 1d 1a JMP $1a1d ; (nformf + 1085)
+1aab : 4c e8 18 JMP $18e8 ; (nformf + 776)
+1aae : 85 50 __ STA T6 + 0
+1ab0 : a5 47 __ LDA T2 + 0
+1ab2 : 85 1b __ STA ACCU + 0
+1ab4 : a5 48 __ LDA T2 + 1
+1ab6 : 85 1c __ STA ACCU + 1
+1ab8 : a5 49 __ LDA T2 + 2
+1aba : 85 1d __ STA ACCU + 2
+1abc : a5 4a __ LDA T2 + 3
+1abe : 85 1e __ STA ACCU + 3
+1ac0 : a9 00 __ LDA #$00
+1ac2 : 85 03 __ STA $03
+1ac4 : 85 04 __ STA $04
+1ac6 : a9 20 __ LDA #$20
+1ac8 : 85 05 __ STA $05
+1aca : a9 41 __ LDA #$41
+1acc : 85 06 __ STA $06
+1ace : 20 39 1d JSR $1d39 ; (freg + 20)
+1ad1 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+1ad4 : a5 1b __ LDA ACCU + 0
+1ad6 : 85 47 __ STA T2 + 0
+1ad8 : a5 1c __ LDA ACCU + 1
+1ada : 85 48 __ STA T2 + 1
+1adc : a5 1d __ LDA ACCU + 2
+1ade : 85 49 __ STA T2 + 2
+1ae0 : a5 1e __ LDA ACCU + 3
+1ae2 : 85 4a __ STA T2 + 3
+1ae4 : e6 50 __ INC T6 + 0
+1ae6 : a5 50 __ LDA T6 + 0
+1ae8 : c5 4c __ CMP T4 + 0
+1aea : 90 c4 __ BCC $1ab0
+1aec : 4c 31 18 JMP $1831 ; (nformf + 593)
+1aef : a5 11 __ LDA P4
+1af1 : 85 1b __ STA ACCU + 0
+1af3 : a5 12 __ LDA P5
+1af5 : 85 1c __ STA ACCU + 1
+1af7 : a5 13 __ LDA P6
+1af9 : 85 1d __ STA ACCU + 2
+1afb : a5 14 __ LDA P7
+1afd : 85 1e __ STA ACCU + 3
+1aff : a9 00 __ LDA #$00
+1b01 : 85 03 __ STA $03
+1b03 : 85 04 __ STA $04
+1b05 : a9 20 __ LDA #$20
+1b07 : 85 05 __ STA $05
+1b09 : a9 41 __ LDA #$41
+1b0b : 85 06 __ STA $06
+1b0d : 20 39 1d JSR $1d39 ; (freg + 20)
+1b10 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+1b13 : a5 1b __ LDA ACCU + 0
+1b15 : 85 11 __ STA P4
+1b17 : a5 1c __ LDA ACCU + 1
+1b19 : 85 12 __ STA P5
+1b1b : a5 1d __ LDA ACCU + 2
+1b1d : 85 13 __ STA P6
+1b1f : a5 1e __ LDA ACCU + 3
+1b21 : 85 14 __ STA P7
+1b23 : e6 43 __ INC T0 + 0
+1b25 : d0 02 __ BNE $1b29
+1b27 : e6 44 __ INC T0 + 1
+1b29 : a5 44 __ LDA T0 + 1
+1b2b : 30 c2 __ BMI $1aef
+1b2d : 4c 13 18 JMP $1813 ; (nformf + 563)
+1b30 : a9 00 __ LDA #$00
+1b32 : 85 47 __ STA T2 + 0
+1b34 : 85 48 __ STA T2 + 1
+1b36 : 85 49 __ STA T2 + 2
+1b38 : a9 3f __ LDA #$3f
+1b3a : 85 4a __ STA T2 + 3
+1b3c : a5 4e __ LDA T5 + 0
+1b3e : f0 03 __ BEQ $1b43
+1b40 : 4c df 1b JMP $1bdf ; (nformf + 1535)
+1b43 : a5 11 __ LDA P4
+1b45 : 85 1b __ STA ACCU + 0
+1b47 : a5 12 __ LDA P5
+1b49 : 85 1c __ STA ACCU + 1
+1b4b : a5 13 __ LDA P6
+1b4d : 85 1d __ STA ACCU + 2
+1b4f : a5 14 __ LDA P7
+1b51 : 85 1e __ STA ACCU + 3
+1b53 : a5 47 __ LDA T2 + 0
+1b55 : 85 03 __ STA $03
+1b57 : a5 48 __ LDA T2 + 1
+1b59 : 85 04 __ STA $04
+1b5b : a5 49 __ LDA T2 + 2
+1b5d : 85 05 __ STA $05
+1b5f : a5 4a __ LDA T2 + 3
+1b61 : 85 06 __ STA $06
+1b63 : 20 39 1d JSR $1d39 ; (freg + 20)
+1b66 : 20 6a 1d JSR $1d6a ; (faddsub + 0)
+1b69 : a5 1b __ LDA ACCU + 0
+1b6b : 85 11 __ STA P4
+1b6d : 85 47 __ STA T2 + 0
+1b6f : 85 03 __ STA $03
+1b71 : a5 1c __ LDA ACCU + 1
+1b73 : 85 12 __ STA P5
+1b75 : 85 48 __ STA T2 + 1
+1b77 : 85 04 __ STA $04
+1b79 : a5 1d __ LDA ACCU + 2
+1b7b : 85 13 __ STA P6
+1b7d : 85 49 __ STA T2 + 2
+1b7f : 85 05 __ STA $05
+1b81 : a5 1e __ LDA ACCU + 3
+1b83 : 85 14 __ STA P7
+1b85 : 85 4a __ STA T2 + 3
+1b87 : 85 06 __ STA $06
+1b89 : a9 00 __ LDA #$00
+1b8b : 85 1b __ STA ACCU + 0
+1b8d : 85 1c __ STA ACCU + 1
+1b8f : a9 20 __ LDA #$20
+1b91 : 85 1d __ STA ACCU + 2
+1b93 : a9 41 __ LDA #$41
+1b95 : 85 1e __ STA ACCU + 3
+1b97 : 20 05 21 JSR $2105 ; (fcmp + 0)
+1b9a : 10 03 __ BPL $1b9f
+1b9c : 4c c0 18 JMP $18c0 ; (nformf + 736)
+1b9f : a5 47 __ LDA T2 + 0
+1ba1 : 85 1b __ STA ACCU + 0
+1ba3 : a5 48 __ LDA T2 + 1
+1ba5 : 85 1c __ STA ACCU + 1
+1ba7 : a5 49 __ LDA T2 + 2
+1ba9 : 85 1d __ STA ACCU + 2
+1bab : a5 4a __ LDA T2 + 3
+1bad : 85 1e __ STA ACCU + 3
+1baf : a9 00 __ LDA #$00
+1bb1 : 85 03 __ STA $03
+1bb3 : 85 04 __ STA $04
+1bb5 : a9 20 __ LDA #$20
+1bb7 : 85 05 __ STA $05
+1bb9 : a9 41 __ LDA #$41
+1bbb : 85 06 __ STA $06
+1bbd : 20 39 1d JSR $1d39 ; (freg + 20)
+1bc0 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+1bc3 : a5 1b __ LDA ACCU + 0
+1bc5 : 85 11 __ STA P4
+1bc7 : a5 1c __ LDA ACCU + 1
+1bc9 : 85 12 __ STA P5
+1bcb : a5 1d __ LDA ACCU + 2
+1bcd : 85 13 __ STA P6
+1bcf : a5 1e __ LDA ACCU + 3
+1bd1 : 85 14 __ STA P7
+1bd3 : e6 43 __ INC T0 + 0
+1bd5 : f0 03 __ BEQ $1bda
+1bd7 : 4c c0 18 JMP $18c0 ; (nformf + 736)
+1bda : e6 44 __ INC T0 + 1
+1bdc : 4c c0 18 JMP $18c0 ; (nformf + 736)
+1bdf : a9 00 __ LDA #$00
+1be1 : 85 50 __ STA T6 + 0
+1be3 : a5 47 __ LDA T2 + 0
+1be5 : 85 1b __ STA ACCU + 0
+1be7 : a5 48 __ LDA T2 + 1
+1be9 : 85 1c __ STA ACCU + 1
+1beb : a5 49 __ LDA T2 + 2
+1bed : 85 1d __ STA ACCU + 2
+1bef : a5 4a __ LDA T2 + 3
+1bf1 : 85 1e __ STA ACCU + 3
+1bf3 : a9 00 __ LDA #$00
+1bf5 : 85 03 __ STA $03
+1bf7 : 85 04 __ STA $04
+1bf9 : a9 20 __ LDA #$20
+1bfb : 85 05 __ STA $05
+1bfd : a9 41 __ LDA #$41
+1bff : 85 06 __ STA $06
+1c01 : 20 39 1d JSR $1d39 ; (freg + 20)
+1c04 : 20 d0 1e JSR $1ed0 ; (fdiv + 0)
+1c07 : a5 1b __ LDA ACCU + 0
+1c09 : 85 47 __ STA T2 + 0
+1c0b : a5 1c __ LDA ACCU + 1
+1c0d : 85 48 __ STA T2 + 1
+1c0f : a5 1d __ LDA ACCU + 2
+1c11 : 85 49 __ STA T2 + 2
+1c13 : a5 1e __ LDA ACCU + 3
+1c15 : 85 4a __ STA T2 + 3
+1c17 : e6 50 __ INC T6 + 0
+1c19 : a5 50 __ LDA T6 + 0
+1c1b : c5 4e __ CMP T5 + 0
+1c1d : 90 c4 __ BCC $1be3
+1c1f : 4c 43 1b JMP $1b43 ; (nformf + 1379)
+1c22 : a5 44 __ LDA T0 + 1
+1c24 : 10 0e __ BPL $1c34
+1c26 : a5 44 __ LDA T0 + 1
+1c28 : 30 03 __ BMI $1c2d
+1c2a : 4c 05 18 JMP $1805 ; (nformf + 549)
+1c2d : a9 01 __ LDA #$01
+1c2f : 85 52 __ STA T8 + 0
+1c31 : 4c 30 1b JMP $1b30 ; (nformf + 1360)
+1c34 : d0 f7 __ BNE $1c2d
+1c36 : a9 03 __ LDA #$03
+1c38 : c5 43 __ CMP T0 + 0
+1c3a : 90 f1 __ BCC $1c2d
+1c3c : 4c 26 1c JMP $1c26 ; (nformf + 1606)
+1c3f : a9 01 __ LDA #$01
+1c41 : 4c f2 17 JMP $17f2 ; (nformf + 530)
+1c44 : a5 14 __ LDA P7
+1c46 : 49 80 __ EOR #$80
+1c48 : 85 14 __ STA P7
+1c4a : a9 2d __ LDA #$2d
+1c4c : a0 00 __ LDY #$00
+1c4e : 91 0f __ STA (P2),y
+1c50 : a9 01 __ LDA #$01
+1c52 : 85 4b __ STA T3 + 0
+1c54 : 4c 2d 16 JMP $162d ; (nformf + 77)
+--------------------------------------------------------------------
+strlen:
+1c70 : a9 00 __ LDA #$00
+1c72 : 85 43 __ STA T0 + 0
+1c74 : 85 44 __ STA T0 + 1
+1c76 : a0 00 __ LDY #$00
+1c78 : b1 0d __ LDA (P0),y
+1c7a : d0 09 __ BNE $1c85
+1c7c : a5 43 __ LDA T0 + 0
+1c7e : 85 1b __ STA ACCU + 0
+1c80 : a5 44 __ LDA T0 + 1
+1c82 : 85 1c __ STA ACCU + 1
+1c84 : 60 __ __ RTS
+1c85 : 18 __ __ CLC
+1c86 : a5 0d __ LDA P0
+1c88 : 65 43 __ ADC T0 + 0
+1c8a : 85 48 __ STA T3 + 0
+1c8c : a5 0e __ LDA P1
+1c8e : 65 44 __ ADC T0 + 1
+1c90 : 85 49 __ STA T3 + 1
+1c92 : e6 43 __ INC T0 + 0
+1c94 : d0 02 __ BNE $1c98
+1c96 : e6 44 __ INC T0 + 1
+1c98 : a0 01 __ LDY #$01
+1c9a : b1 48 __ LDA (T3 + 0),y
+1c9c : d0 e7 __ BNE $1c85
+1c9e : 4c 7c 1c JMP $1c7c ; (strlen + 12)
+--------------------------------------------------------------------
+strcmp:
+1cb7 : a0 00 __ LDY #$00
+1cb9 : 84 1c __ STY ACCU + 1
+1cbb : b1 0d __ LDA (P0),y
+1cbd : f0 16 __ BEQ $1cd5
+1cbf : d1 0f __ CMP (P2),y
+1cc1 : d0 16 __ BNE $1cd9
+1cc3 : c8 __ __ INY
+1cc4 : b1 0d __ LDA (P0),y
+1cc6 : f0 0d __ BEQ $1cd5
+1cc8 : d1 0f __ CMP (P2),y
+1cca : d0 0d __ BNE $1cd9
+1ccc : c8 __ __ INY
+1ccd : d0 ec __ BNE $1cbb
+1ccf : e6 0e __ INC P1
+1cd1 : e6 10 __ INC P3
+1cd3 : d0 e6 __ BNE $1cbb
+1cd5 : d1 0f __ CMP (P2),y
+1cd7 : f0 0a __ BEQ $1ce3
+1cd9 : b0 06 __ BCS $1ce1
+1cdb : a9 ff __ LDA #$ff
+1cdd : 85 1c __ STA ACCU + 1
+1cdf : 30 02 __ BMI $1ce3
+1ce1 : a9 01 __ LDA #$01
+1ce3 : 85 1b __ STA ACCU + 0
+1ce5 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1cf4 : a9 4c __ LDA #$4c
+1cf6 : 85 54 __ STA $54
+1cf8 : a9 00 __ LDA #$00
+1cfa : 85 13 __ STA P6
+1cfc : a9 19 __ LDA #$19
+1cfe : 85 16 __ STA P9
+1d00 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+1d01 : a9 00 __ LDA #$00
+1d03 : 85 05 __ STA $05
+1d05 : 85 06 __ STA $06
+1d07 : a5 03 __ LDA $03
+1d09 : 4a __ __ LSR
+1d0a : 90 0f __ BCC $1d1b
+1d0c : aa __ __ TAX
+1d0d : 18 __ __ CLC
+1d0e : a5 05 __ LDA $05
+1d10 : 65 1b __ ADC ACCU + 0
+1d12 : 85 05 __ STA $05
+1d14 : a5 06 __ LDA $06
+1d16 : 65 1c __ ADC ACCU + 1
+1d18 : 85 06 __ STA $06
+1d1a : 8a __ __ TXA
+1d1b : 06 1b __ ASL ACCU + 0
+1d1d : 26 1c __ ROL ACCU + 1
+1d1f : 4a __ __ LSR
+1d20 : b0 ea __ BCS $1d0c
+1d22 : d0 f7 __ BNE $1d1b
+1d24 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1d25 : b1 19 __ LDA (IP + 0),y
+1d27 : c8 __ __ INY
+1d28 : aa __ __ TAX
+1d29 : b5 00 __ LDA $00,x
+1d2b : 85 03 __ STA $03
+1d2d : b5 01 __ LDA $01,x
+1d2f : 85 04 __ STA $04
+1d31 : b5 02 __ LDA $02,x
+1d33 : 85 05 __ STA $05
+1d35 : b5 03 __ LDA $03,x
+1d37 : 85 06 __ STA $06
+1d39 : a5 05 __ LDA $05
+1d3b : 0a __ __ ASL
+1d3c : a5 06 __ LDA $06
+1d3e : 2a __ __ ROL
+1d3f : 85 08 __ STA $08
+1d41 : f0 06 __ BEQ $1d49
+1d43 : a5 05 __ LDA $05
+1d45 : 09 80 __ ORA #$80
+1d47 : 85 05 __ STA $05
+1d49 : a5 1d __ LDA ACCU + 2
+1d4b : 0a __ __ ASL
+1d4c : a5 1e __ LDA ACCU + 3
+1d4e : 2a __ __ ROL
+1d4f : 85 07 __ STA $07
+1d51 : f0 06 __ BEQ $1d59
+1d53 : a5 1d __ LDA ACCU + 2
+1d55 : 09 80 __ ORA #$80
+1d57 : 85 1d __ STA ACCU + 2
+1d59 : 60 __ __ RTS
+1d5a : 06 1e __ ASL ACCU + 3
+1d5c : a5 07 __ LDA $07
+1d5e : 6a __ __ ROR
+1d5f : 85 1e __ STA ACCU + 3
+1d61 : b0 06 __ BCS $1d69
+1d63 : a5 1d __ LDA ACCU + 2
+1d65 : 29 7f __ AND #$7f
+1d67 : 85 1d __ STA ACCU + 2
+1d69 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1d6a : 38 __ __ SEC
+1d6b : a5 07 __ LDA $07
+1d6d : e5 08 __ SBC $08
+1d6f : f0 38 __ BEQ $1da9
+1d71 : aa __ __ TAX
+1d72 : b0 25 __ BCS $1d99
+1d74 : e0 e9 __ CPX #$e9
+1d76 : b0 0e __ BCS $1d86
+1d78 : a5 08 __ LDA $08
+1d7a : 85 07 __ STA $07
+1d7c : a9 00 __ LDA #$00
+1d7e : 85 1b __ STA ACCU + 0
+1d80 : 85 1c __ STA ACCU + 1
+1d82 : 85 1d __ STA ACCU + 2
+1d84 : f0 23 __ BEQ $1da9
+1d86 : a5 1d __ LDA ACCU + 2
+1d88 : 4a __ __ LSR
+1d89 : 66 1c __ ROR ACCU + 1
+1d8b : 66 1b __ ROR ACCU + 0
+1d8d : e8 __ __ INX
+1d8e : d0 f8 __ BNE $1d88
+1d90 : 85 1d __ STA ACCU + 2
+1d92 : a5 08 __ LDA $08
+1d94 : 85 07 __ STA $07
+1d96 : 4c a9 1d JMP $1da9 ; (faddsub + 63)
+1d99 : e0 18 __ CPX #$18
+1d9b : b0 33 __ BCS $1dd0
+1d9d : a5 05 __ LDA $05
+1d9f : 4a __ __ LSR
+1da0 : 66 04 __ ROR $04
+1da2 : 66 03 __ ROR $03
+1da4 : ca __ __ DEX
+1da5 : d0 f8 __ BNE $1d9f
+1da7 : 85 05 __ STA $05
+1da9 : a5 1e __ LDA ACCU + 3
+1dab : 29 80 __ AND #$80
+1dad : 85 1e __ STA ACCU + 3
+1daf : 45 06 __ EOR $06
+1db1 : 30 2d __ BMI $1de0
+1db3 : 18 __ __ CLC
+1db4 : a5 1b __ LDA ACCU + 0
+1db6 : 65 03 __ ADC $03
+1db8 : 85 1b __ STA ACCU + 0
+1dba : a5 1c __ LDA ACCU + 1
+1dbc : 65 04 __ ADC $04
+1dbe : 85 1c __ STA ACCU + 1
+1dc0 : a5 1d __ LDA ACCU + 2
+1dc2 : 65 05 __ ADC $05
+1dc4 : 85 1d __ STA ACCU + 2
+1dc6 : 90 08 __ BCC $1dd0
+1dc8 : 66 1d __ ROR ACCU + 2
+1dca : 66 1c __ ROR ACCU + 1
+1dcc : 66 1b __ ROR ACCU + 0
+1dce : e6 07 __ INC $07
+1dd0 : a5 07 __ LDA $07
+1dd2 : 4a __ __ LSR
+1dd3 : 05 1e __ ORA ACCU + 3
+1dd5 : 85 1e __ STA ACCU + 3
+1dd7 : b0 06 __ BCS $1ddf
+1dd9 : a5 1d __ LDA ACCU + 2
+1ddb : 29 7f __ AND #$7f
+1ddd : 85 1d __ STA ACCU + 2
+1ddf : 60 __ __ RTS
+1de0 : 38 __ __ SEC
+1de1 : a5 1b __ LDA ACCU + 0
+1de3 : e5 03 __ SBC $03
+1de5 : 85 1b __ STA ACCU + 0
+1de7 : a5 1c __ LDA ACCU + 1
+1de9 : e5 04 __ SBC $04
+1deb : 85 1c __ STA ACCU + 1
+1ded : a5 1d __ LDA ACCU + 2
+1def : e5 05 __ SBC $05
+1df1 : 85 1d __ STA ACCU + 2
+1df3 : b0 19 __ BCS $1e0e
+1df5 : 38 __ __ SEC
+1df6 : a9 00 __ LDA #$00
+1df8 : e5 1b __ SBC ACCU + 0
+1dfa : 85 1b __ STA ACCU + 0
+1dfc : a9 00 __ LDA #$00
+1dfe : e5 1c __ SBC ACCU + 1
+1e00 : 85 1c __ STA ACCU + 1
+1e02 : a9 00 __ LDA #$00
+1e04 : e5 1d __ SBC ACCU + 2
+1e06 : 85 1d __ STA ACCU + 2
+1e08 : a5 1e __ LDA ACCU + 3
+1e0a : 49 80 __ EOR #$80
+1e0c : 85 1e __ STA ACCU + 3
+1e0e : a5 1d __ LDA ACCU + 2
+1e10 : 30 be __ BMI $1dd0
+1e12 : 05 1c __ ORA ACCU + 1
+1e14 : 05 1b __ ORA ACCU + 0
+1e16 : f0 0f __ BEQ $1e27
+1e18 : c6 07 __ DEC $07
+1e1a : f0 0b __ BEQ $1e27
+1e1c : 06 1b __ ASL ACCU + 0
+1e1e : 26 1c __ ROL ACCU + 1
+1e20 : 26 1d __ ROL ACCU + 2
+1e22 : 10 f4 __ BPL $1e18
+1e24 : 4c d0 1d JMP $1dd0 ; (faddsub + 102)
+1e27 : a9 00 __ LDA #$00
+1e29 : 85 1b __ STA ACCU + 0
+1e2b : 85 1c __ STA ACCU + 1
+1e2d : 85 1d __ STA ACCU + 2
+1e2f : 85 1e __ STA ACCU + 3
+1e31 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1e32 : a5 1b __ LDA ACCU + 0
+1e34 : 05 1c __ ORA ACCU + 1
+1e36 : 05 1d __ ORA ACCU + 2
+1e38 : d0 03 __ BNE $1e3d
+1e3a : 85 1e __ STA ACCU + 3
+1e3c : 60 __ __ RTS
+1e3d : a5 03 __ LDA $03
+1e3f : 05 04 __ ORA $04
+1e41 : 05 05 __ ORA $05
+1e43 : d0 09 __ BNE $1e4e
+1e45 : 85 1b __ STA ACCU + 0
+1e47 : 85 1c __ STA ACCU + 1
+1e49 : 85 1d __ STA ACCU + 2
+1e4b : 85 1e __ STA ACCU + 3
+1e4d : 60 __ __ RTS
+1e4e : a9 00 __ LDA #$00
+1e50 : 85 09 __ STA $09
+1e52 : 85 0a __ STA $0a
+1e54 : 85 0b __ STA $0b
+1e56 : a4 1b __ LDY ACCU + 0
+1e58 : a5 03 __ LDA $03
+1e5a : d0 06 __ BNE $1e62
+1e5c : a5 04 __ LDA $04
+1e5e : f0 0a __ BEQ $1e6a
+1e60 : d0 05 __ BNE $1e67
+1e62 : 20 a2 1e JSR $1ea2 ; (fmul8 + 0)
+1e65 : a5 04 __ LDA $04
+1e67 : 20 a2 1e JSR $1ea2 ; (fmul8 + 0)
+1e6a : a5 05 __ LDA $05
+1e6c : 20 a2 1e JSR $1ea2 ; (fmul8 + 0)
+1e6f : 38 __ __ SEC
+1e70 : a5 0b __ LDA $0b
+1e72 : 30 06 __ BMI $1e7a
+1e74 : 06 09 __ ASL $09
+1e76 : 26 0a __ ROL $0a
+1e78 : 2a __ __ ROL
+1e79 : 18 __ __ CLC
+1e7a : 29 7f __ AND #$7f
+1e7c : 85 0b __ STA $0b
+1e7e : a5 1e __ LDA ACCU + 3
+1e80 : 45 06 __ EOR $06
+1e82 : 29 80 __ AND #$80
+1e84 : 85 1e __ STA ACCU + 3
+1e86 : a5 07 __ LDA $07
+1e88 : e9 7e __ SBC #$7e
+1e8a : 18 __ __ CLC
+1e8b : 65 08 __ ADC $08
+1e8d : 4a __ __ LSR
+1e8e : 05 1e __ ORA ACCU + 3
+1e90 : 85 1e __ STA ACCU + 3
+1e92 : a9 00 __ LDA #$00
+1e94 : 6a __ __ ROR
+1e95 : 05 0b __ ORA $0b
+1e97 : 85 1d __ STA ACCU + 2
+1e99 : a5 0a __ LDA $0a
+1e9b : 85 1c __ STA ACCU + 1
+1e9d : a5 09 __ LDA $09
+1e9f : 85 1b __ STA ACCU + 0
+1ea1 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1ea2 : 38 __ __ SEC
+1ea3 : 6a __ __ ROR
+1ea4 : 90 1e __ BCC $1ec4
+1ea6 : aa __ __ TAX
+1ea7 : 18 __ __ CLC
+1ea8 : 98 __ __ TYA
+1ea9 : 65 09 __ ADC $09
+1eab : 85 09 __ STA $09
+1ead : a5 0a __ LDA $0a
+1eaf : 65 1c __ ADC ACCU + 1
+1eb1 : 85 0a __ STA $0a
+1eb3 : a5 0b __ LDA $0b
+1eb5 : 65 1d __ ADC ACCU + 2
+1eb7 : 6a __ __ ROR
+1eb8 : 85 0b __ STA $0b
+1eba : 8a __ __ TXA
+1ebb : 66 0a __ ROR $0a
+1ebd : 66 09 __ ROR $09
+1ebf : 4a __ __ LSR
+1ec0 : f0 0d __ BEQ $1ecf
+1ec2 : b0 e2 __ BCS $1ea6
+1ec4 : 66 0b __ ROR $0b
+1ec6 : 66 0a __ ROR $0a
+1ec8 : 66 09 __ ROR $09
+1eca : 4a __ __ LSR
+1ecb : 90 f7 __ BCC $1ec4
+1ecd : d0 d7 __ BNE $1ea6
+1ecf : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1ed0 : a5 1b __ LDA ACCU + 0
+1ed2 : 05 1c __ ORA ACCU + 1
+1ed4 : 05 1d __ ORA ACCU + 2
+1ed6 : d0 03 __ BNE $1edb
+1ed8 : 85 1e __ STA ACCU + 3
+1eda : 60 __ __ RTS
+1edb : a5 1e __ LDA ACCU + 3
+1edd : 45 06 __ EOR $06
+1edf : 29 80 __ AND #$80
+1ee1 : 85 1e __ STA ACCU + 3
+1ee3 : a9 00 __ LDA #$00
+1ee5 : 85 09 __ STA $09
+1ee7 : 85 0a __ STA $0a
+1ee9 : 85 0b __ STA $0b
+1eeb : a2 18 __ LDX #$18
+1eed : a5 1b __ LDA ACCU + 0
+1eef : c5 03 __ CMP $03
+1ef1 : a5 1c __ LDA ACCU + 1
+1ef3 : e5 04 __ SBC $04
+1ef5 : a5 1d __ LDA ACCU + 2
+1ef7 : e5 05 __ SBC $05
+1ef9 : 90 13 __ BCC $1f0e
+1efb : a5 1b __ LDA ACCU + 0
+1efd : e5 03 __ SBC $03
+1eff : 85 1b __ STA ACCU + 0
+1f01 : a5 1c __ LDA ACCU + 1
+1f03 : e5 04 __ SBC $04
+1f05 : 85 1c __ STA ACCU + 1
+1f07 : a5 1d __ LDA ACCU + 2
+1f09 : e5 05 __ SBC $05
+1f0b : 85 1d __ STA ACCU + 2
+1f0d : 38 __ __ SEC
+1f0e : 26 09 __ ROL $09
+1f10 : 26 0a __ ROL $0a
+1f12 : 26 0b __ ROL $0b
+1f14 : ca __ __ DEX
+1f15 : f0 0a __ BEQ $1f21
+1f17 : 06 1b __ ASL ACCU + 0
+1f19 : 26 1c __ ROL ACCU + 1
+1f1b : 26 1d __ ROL ACCU + 2
+1f1d : b0 dc __ BCS $1efb
+1f1f : 90 cc __ BCC $1eed
+1f21 : 38 __ __ SEC
+1f22 : a5 0b __ LDA $0b
+1f24 : 30 06 __ BMI $1f2c
+1f26 : 06 09 __ ASL $09
+1f28 : 26 0a __ ROL $0a
+1f2a : 2a __ __ ROL
+1f2b : 18 __ __ CLC
+1f2c : 29 7f __ AND #$7f
+1f2e : 85 0b __ STA $0b
+1f30 : a5 08 __ LDA $08
+1f32 : 49 7f __ EOR #$7f
+1f34 : 65 07 __ ADC $07
+1f36 : 38 __ __ SEC
+1f37 : e9 01 __ SBC #$01
+1f39 : 4a __ __ LSR
+1f3a : 05 1e __ ORA ACCU + 3
+1f3c : 85 1e __ STA ACCU + 3
+1f3e : a9 00 __ LDA #$00
+1f40 : 6a __ __ ROR
+1f41 : 05 0b __ ORA $0b
+1f43 : 85 1d __ STA ACCU + 2
+1f45 : a5 0a __ LDA $0a
+1f47 : 85 1c __ STA ACCU + 1
+1f49 : a5 09 __ LDA $09
+1f4b : 85 1b __ STA ACCU + 0
+1f4d : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+1f4e : a0 00 __ LDY #$00
+1f50 : 84 06 __ STY $06
+1f52 : a5 03 __ LDA $03
+1f54 : a6 04 __ LDX $04
+1f56 : f0 1c __ BEQ $1f74
+1f58 : 38 __ __ SEC
+1f59 : 6a __ __ ROR
+1f5a : 90 0d __ BCC $1f69
+1f5c : aa __ __ TAX
+1f5d : 18 __ __ CLC
+1f5e : 98 __ __ TYA
+1f5f : 65 1b __ ADC ACCU + 0
+1f61 : a8 __ __ TAY
+1f62 : a5 06 __ LDA $06
+1f64 : 65 1c __ ADC ACCU + 1
+1f66 : 85 06 __ STA $06
+1f68 : 8a __ __ TXA
+1f69 : 06 1b __ ASL ACCU + 0
+1f6b : 26 1c __ ROL ACCU + 1
+1f6d : 4a __ __ LSR
+1f6e : 90 f9 __ BCC $1f69
+1f70 : d0 ea __ BNE $1f5c
+1f72 : a5 04 __ LDA $04
+1f74 : 4a __ __ LSR
+1f75 : 90 0d __ BCC $1f84
+1f77 : aa __ __ TAX
+1f78 : 18 __ __ CLC
+1f79 : 98 __ __ TYA
+1f7a : 65 1b __ ADC ACCU + 0
+1f7c : a8 __ __ TAY
+1f7d : a5 06 __ LDA $06
+1f7f : 65 1c __ ADC ACCU + 1
+1f81 : 85 06 __ STA $06
+1f83 : 8a __ __ TXA
+1f84 : 06 1b __ ASL ACCU + 0
+1f86 : 26 1c __ ROL ACCU + 1
+1f88 : 4a __ __ LSR
+1f89 : b0 ec __ BCS $1f77
+1f8b : d0 f7 __ BNE $1f84
+1f8d : 84 05 __ STY $05
+1f8f : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+1f90 : 24 1c __ BIT ACCU + 1
+1f92 : 10 0d __ BPL $1fa1
+1f94 : 20 ae 1f JSR $1fae ; (negaccu + 0)
+1f97 : 24 04 __ BIT $04
+1f99 : 10 0d __ BPL $1fa8
+1f9b : 20 bc 1f JSR $1fbc ; (negtmp + 0)
+1f9e : 4c ca 1f JMP $1fca ; (divmod + 0)
+1fa1 : 24 04 __ BIT $04
+1fa3 : 10 f9 __ BPL $1f9e
+1fa5 : 20 bc 1f JSR $1fbc ; (negtmp + 0)
+1fa8 : 20 ca 1f JSR $1fca ; (divmod + 0)
+1fab : 4c ae 1f JMP $1fae ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+1fae : 38 __ __ SEC
+1faf : a9 00 __ LDA #$00
+1fb1 : e5 1b __ SBC ACCU + 0
+1fb3 : 85 1b __ STA ACCU + 0
+1fb5 : a9 00 __ LDA #$00
+1fb7 : e5 1c __ SBC ACCU + 1
+1fb9 : 85 1c __ STA ACCU + 1
+1fbb : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1fbc : 38 __ __ SEC
+1fbd : a9 00 __ LDA #$00
+1fbf : e5 03 __ SBC $03
+1fc1 : 85 03 __ STA $03
+1fc3 : a9 00 __ LDA #$00
+1fc5 : e5 04 __ SBC $04
+1fc7 : 85 04 __ STA $04
+1fc9 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1fca : a5 1c __ LDA ACCU + 1
+1fcc : d0 31 __ BNE $1fff
+1fce : a5 04 __ LDA $04
+1fd0 : d0 1e __ BNE $1ff0
+1fd2 : 85 06 __ STA $06
+1fd4 : a2 04 __ LDX #$04
+1fd6 : 06 1b __ ASL ACCU + 0
+1fd8 : 2a __ __ ROL
+1fd9 : c5 03 __ CMP $03
+1fdb : 90 02 __ BCC $1fdf
+1fdd : e5 03 __ SBC $03
+1fdf : 26 1b __ ROL ACCU + 0
+1fe1 : 2a __ __ ROL
+1fe2 : c5 03 __ CMP $03
+1fe4 : 90 02 __ BCC $1fe8
+1fe6 : e5 03 __ SBC $03
+1fe8 : 26 1b __ ROL ACCU + 0
+1fea : ca __ __ DEX
+1feb : d0 eb __ BNE $1fd8
+1fed : 85 05 __ STA $05
+1fef : 60 __ __ RTS
+1ff0 : a5 1b __ LDA ACCU + 0
+1ff2 : 85 05 __ STA $05
+1ff4 : a5 1c __ LDA ACCU + 1
+1ff6 : 85 06 __ STA $06
+1ff8 : a9 00 __ LDA #$00
+1ffa : 85 1b __ STA ACCU + 0
+1ffc : 85 1c __ STA ACCU + 1
+1ffe : 60 __ __ RTS
+1fff : a5 04 __ LDA $04
+2001 : d0 1f __ BNE $2022
+2003 : a5 03 __ LDA $03
+2005 : 30 1b __ BMI $2022
+2007 : a9 00 __ LDA #$00
+2009 : 85 06 __ STA $06
+200b : a2 10 __ LDX #$10
+200d : 06 1b __ ASL ACCU + 0
+200f : 26 1c __ ROL ACCU + 1
+2011 : 2a __ __ ROL
+2012 : c5 03 __ CMP $03
+2014 : 90 02 __ BCC $2018
+2016 : e5 03 __ SBC $03
+2018 : 26 1b __ ROL ACCU + 0
+201a : 26 1c __ ROL ACCU + 1
+201c : ca __ __ DEX
+201d : d0 f2 __ BNE $2011
+201f : 85 05 __ STA $05
+2021 : 60 __ __ RTS
+2022 : a9 00 __ LDA #$00
+2024 : 85 05 __ STA $05
+2026 : 85 06 __ STA $06
+2028 : 84 02 __ STY $02
+202a : a0 10 __ LDY #$10
+202c : 18 __ __ CLC
+202d : 26 1b __ ROL ACCU + 0
+202f : 26 1c __ ROL ACCU + 1
+2031 : 26 05 __ ROL $05
+2033 : 26 06 __ ROL $06
+2035 : 38 __ __ SEC
+2036 : a5 05 __ LDA $05
+2038 : e5 03 __ SBC $03
+203a : aa __ __ TAX
+203b : a5 06 __ LDA $06
+203d : e5 04 __ SBC $04
+203f : 90 04 __ BCC $2045
+2041 : 86 05 __ STX $05
+2043 : 85 06 __ STA $06
+2045 : 88 __ __ DEY
+2046 : d0 e5 __ BNE $202d
+2048 : 26 1b __ ROL ACCU + 0
+204a : 26 1c __ ROL ACCU + 1
+204c : a4 02 __ LDY $02
+204e : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+204f : 24 1c __ BIT ACCU + 1
+2051 : 10 0d __ BPL $2060
+2053 : 20 ae 1f JSR $1fae ; (negaccu + 0)
+2056 : 24 04 __ BIT $04
+2058 : 10 0d __ BPL $2067
+205a : 20 bc 1f JSR $1fbc ; (negtmp + 0)
+205d : 4c ca 1f JMP $1fca ; (divmod + 0)
+2060 : 24 04 __ BIT $04
+2062 : 10 f9 __ BPL $205d
+2064 : 20 bc 1f JSR $1fbc ; (negtmp + 0)
+2067 : 20 ca 1f JSR $1fca ; (divmod + 0)
+206a : 38 __ __ SEC
+206b : a9 00 __ LDA #$00
+206d : e5 05 __ SBC $05
+206f : 85 05 __ STA $05
+2071 : a9 00 __ LDA #$00
+2073 : e5 06 __ SBC $06
+2075 : 85 06 __ STA $06
+2077 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+2078 : 20 49 1d JSR $1d49 ; (freg + 36)
+207b : a5 07 __ LDA $07
+207d : c9 7f __ CMP #$7f
+207f : b0 07 __ BCS $2088
+2081 : a9 00 __ LDA #$00
+2083 : 85 1b __ STA ACCU + 0
+2085 : 85 1c __ STA ACCU + 1
+2087 : 60 __ __ RTS
+2088 : 38 __ __ SEC
+2089 : e9 8e __ SBC #$8e
+208b : 90 0a __ BCC $2097
+208d : a9 ff __ LDA #$ff
+208f : 85 1b __ STA ACCU + 0
+2091 : a9 7f __ LDA #$7f
+2093 : 85 1c __ STA ACCU + 1
+2095 : d0 08 __ BNE $209f
+2097 : aa __ __ TAX
+2098 : 46 1d __ LSR ACCU + 2
+209a : 66 1c __ ROR ACCU + 1
+209c : e8 __ __ INX
+209d : d0 f9 __ BNE $2098
+209f : 24 1e __ BIT ACCU + 3
+20a1 : 10 0e __ BPL $20b1
+20a3 : 38 __ __ SEC
+20a4 : a9 00 __ LDA #$00
+20a6 : e5 1c __ SBC ACCU + 1
+20a8 : 85 1b __ STA ACCU + 0
+20aa : a9 00 __ LDA #$00
+20ac : e5 1d __ SBC ACCU + 2
+20ae : 85 1c __ STA ACCU + 1
+20b0 : 60 __ __ RTS
+20b1 : a5 1c __ LDA ACCU + 1
+20b3 : 85 1b __ STA ACCU + 0
+20b5 : a5 1d __ LDA ACCU + 2
+20b7 : 85 1c __ STA ACCU + 1
+20b9 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+20ba : 24 1c __ BIT ACCU + 1
+20bc : 30 03 __ BMI $20c1
+20be : 4c d8 20 JMP $20d8 ; (uint16_to_float + 0)
+20c1 : 38 __ __ SEC
+20c2 : a9 00 __ LDA #$00
+20c4 : e5 1b __ SBC ACCU + 0
+20c6 : 85 1b __ STA ACCU + 0
+20c8 : a9 00 __ LDA #$00
+20ca : e5 1c __ SBC ACCU + 1
+20cc : 85 1c __ STA ACCU + 1
+20ce : 20 d8 20 JSR $20d8 ; (uint16_to_float + 0)
+20d1 : a5 1e __ LDA ACCU + 3
+20d3 : 09 80 __ ORA #$80
+20d5 : 85 1e __ STA ACCU + 3
+20d7 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+20d8 : a5 1b __ LDA ACCU + 0
+20da : 05 1c __ ORA ACCU + 1
+20dc : d0 05 __ BNE $20e3
+20de : 85 1d __ STA ACCU + 2
+20e0 : 85 1e __ STA ACCU + 3
+20e2 : 60 __ __ RTS
+20e3 : a2 8e __ LDX #$8e
+20e5 : a5 1c __ LDA ACCU + 1
+20e7 : 30 06 __ BMI $20ef
+20e9 : ca __ __ DEX
+20ea : 06 1b __ ASL ACCU + 0
+20ec : 2a __ __ ROL
+20ed : 10 fa __ BPL $20e9
+20ef : 29 7f __ AND #$7f
+20f1 : 85 1d __ STA ACCU + 2
+20f3 : a5 1b __ LDA ACCU + 0
+20f5 : 85 1c __ STA ACCU + 1
+20f7 : 8a __ __ TXA
+20f8 : 4a __ __ LSR
+20f9 : 85 1e __ STA ACCU + 3
+20fb : a9 00 __ LDA #$00
+20fd : 85 1b __ STA ACCU + 0
+20ff : 6a __ __ ROR
+2100 : 05 1d __ ORA ACCU + 2
+2102 : 85 1d __ STA ACCU + 2
+2104 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2105 : a5 1e __ LDA ACCU + 3
+2107 : 45 06 __ EOR $06
+2109 : 29 80 __ AND #$80
+210b : f0 1e __ BEQ $212b
+210d : a5 1e __ LDA ACCU + 3
+210f : 29 7f __ AND #$7f
+2111 : 05 1d __ ORA ACCU + 2
+2113 : 05 1c __ ORA ACCU + 1
+2115 : 05 1b __ ORA ACCU + 0
+2117 : d0 0c __ BNE $2125
+2119 : a5 06 __ LDA $06
+211b : 29 7f __ AND #$7f
+211d : 05 05 __ ORA $05
+211f : 05 04 __ ORA $04
+2121 : 05 03 __ ORA $03
+2123 : f0 1e __ BEQ $2143
+2125 : a5 1e __ LDA ACCU + 3
+2127 : 30 23 __ BMI $214c
+2129 : 10 28 __ BPL $2153
+212b : a5 1e __ LDA ACCU + 3
+212d : c5 06 __ CMP $06
+212f : d0 15 __ BNE $2146
+2131 : a5 1d __ LDA ACCU + 2
+2133 : c5 05 __ CMP $05
+2135 : d0 0f __ BNE $2146
+2137 : a5 1c __ LDA ACCU + 1
+2139 : c5 04 __ CMP $04
+213b : d0 09 __ BNE $2146
+213d : a5 1b __ LDA ACCU + 0
+213f : c5 03 __ CMP $03
+2141 : d0 03 __ BNE $2146
+2143 : a9 00 __ LDA #$00
+2145 : 60 __ __ RTS
+2146 : b0 07 __ BCS $214f
+2148 : 24 1e __ BIT ACCU + 3
+214a : 30 07 __ BMI $2153
+214c : a9 01 __ LDA #$01
+214e : 60 __ __ RTS
+214f : 24 1e __ BIT ACCU + 3
+2151 : 30 f9 __ BMI $214c
+2153 : a9 ff __ LDA #$ff
+2155 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+2156 : 84 02 __ STY $02
+2158 : a9 00 __ LDA #$00
+215a : 85 07 __ STA $07
+215c : 85 08 __ STA $08
+215e : 85 09 __ STA $09
+2160 : 85 0a __ STA $0a
+2162 : a0 20 __ LDY #$20
+2164 : 18 __ __ CLC
+2165 : 26 1b __ ROL ACCU + 0
+2167 : 26 1c __ ROL ACCU + 1
+2169 : 26 1d __ ROL ACCU + 2
+216b : 26 1e __ ROL ACCU + 3
+216d : 26 07 __ ROL $07
+216f : 26 08 __ ROL $08
+2171 : 26 09 __ ROL $09
+2173 : 26 0a __ ROL $0a
+2175 : a5 07 __ LDA $07
+2177 : c5 03 __ CMP $03
+2179 : a5 08 __ LDA $08
+217b : e5 04 __ SBC $04
+217d : a5 09 __ LDA $09
+217f : e5 05 __ SBC $05
+2181 : a5 0a __ LDA $0a
+2183 : e5 06 __ SBC $06
+2185 : 90 18 __ BCC $219f
+2187 : a5 07 __ LDA $07
+2189 : e5 03 __ SBC $03
+218b : 85 07 __ STA $07
+218d : a5 08 __ LDA $08
+218f : e5 04 __ SBC $04
+2191 : 85 08 __ STA $08
+2193 : a5 09 __ LDA $09
+2195 : e5 05 __ SBC $05
+2197 : 85 09 __ STA $09
+2199 : a5 0a __ LDA $0a
+219b : e5 06 __ SBC $06
+219d : 85 0a __ STA $0a
+219f : 88 __ __ DEY
+21a0 : d0 c3 __ BNE $2165
+21a2 : 26 1b __ ROL ACCU + 0
+21a4 : 26 1c __ ROL ACCU + 1
+21a6 : 26 1d __ ROL ACCU + 2
+21a8 : 26 1e __ ROL ACCU + 3
+21aa : a4 02 __ LDY $02
+21ac : 60 __ __ RTS
@@ -0,0 +1,3261 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e bd 23 STX $23bd ; (spentry + 0)
+0811 : a9 c1 __ LDA #$c1
+0813 : 85 19 __ STA IP + 0
+0815 : a9 23 __ LDA #$23
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 52 __ LDA #$52
+081c : e9 23 __ SBC #$23
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 a1 __ LDA #$a1
+0832 : e9 c1 __ SBC #$c1
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	8, 22
+0a04:	PUSH	#$0008
+0a07:	LEA	T0, field + 0
+0a0b:	MOV	T1, #$03e8
+0a0f:	MOV	T2, #0
+0a12:	LEA	T3, $1660
+0a16:	MOV	ACCU, T2
+0a18:	MUL	ACCU, #12
+0a1b:	ADD	ACCU, T0
+0a1d:	MOV	T4, ACCU
+0a1f:	MOV	ADDR, T4
+0a21:	MOV	0(ADDR), T2
+0a24:	ADD	T4, #$0002
+0a28:	MOV	2(SP), T4
+0a2b:	MOV	4(SP), T3
+0a2e:	MOV	6(SP), T2
+0a31:	CALL	sprintf + 0
+0a34:	ADD	T2, #$0001
+0a38:	MOV	ACCU, T1
+0a3a:	CMPS	ACCU, T2
+0a3c:	BLT	$0A16
+0a3e:	LEA	T0, field + 0
+0a42:	MOV	T1, #$03e8
+0a46:	MOV	T2, #0
+0a49:	LEA	T3, 0(FP)
+0a4d:	CALL	rand + 0
+0a50:	MOV	T4, ACCU
+0a52:	MOV	ACCU, T2
+0a54:	MUL	ACCU, #12
+0a57:	ADD	ACCU, T0
+0a59:	MOV	T6, ACCU
+0a5b:	MOV	ADDR, T3
+0a5d:	COPY	#12
+0a5f:	MOV	ADDR, T6
+0a61:	MOV	ACCU, T4
+0a63:	MODU	ACCU, T1
+0a65:	MUL	ACCU, #12
+0a68:	ADD	ACCU, T0
+0a6a:	MOV	T4, ACCU
+0a6c:	COPY	#12
+0a6e:	MOV	ADDR, T4
+0a70:	MOV	ACCU, T3
+0a72:	COPY	#12
+0a74:	ADD	T2, #$0001
+0a78:	MOV	ACCU, T1
+0a7a:	CMPS	ACCU, T2
+0a7c:	BLT	$0A4D
+0a7e:	LEA	T0, field + 0
+0a82:	MOV	2(SP), T0
+0a85:	MOV	ACCU, #$03e8
+0a89:	MOV	4(SP), ACCU
+0a8c:	CALL	qsort + 0
+0a8f:	LEA	T0, field + 0
+0a93:	MOV	T1, #$03e8
+0a97:	MOV	T2, #0
+0a9a:	MOV	ACCU, T2
+0a9c:	MUL	ACCU, #12
+0a9f:	LEAX	ADDR, T0 + ACCU
+0aa1:	MOV	T3, 0(ADDR)
+0aa4:	MOV	ACCU, T2
+0aa6:	CMPU	ACCU, T3
+0aa8:	SEQ
+0aa9:	MOVB	2(SP), ACCU
+0aac:	CALL	assert + 0
+0aaf:	ADD	T2, #$0001
+0ab3:	MOV	ACCU, T1
+0ab5:	CMPS	ACCU, T2
+0ab7:	BLT	$0A9A
+0ab9:	MOV	ACCU, #0
+0abc:	POP	#$0008
+0abf:	RETURN	8, 22
+--------------------------------------------------------------------
+sprintf:
+0ac3:	ENTER	9, 19
+0ac7:	PUSH	#$0002
+0aca:	MOVB	T0, #0
+0acd:	MOVB	T1, #0
+0ad0:	MOV	T2, 12(FP)
+0ad3:	MOV	ADDR, T2
+0ad5:	MOVB	T3, 0(ADDR)
+0ad8:	MOV	T4, 10(FP)
+0adb:	MOVB	ACCU, T3
+0add:	BNE	$0B14
+0adf:	MOVB	ACCU, T1
+0ae1:	ADD	ACCU, T4
+0ae3:	MOV	T2, ACCU
+0ae5:	MOV	ACCU, #0
+0ae8:	MOV	ADDR, T2
+0aea:	MOVB	0(ADDR), ACCU
+0aed:	MOVB	ACCU, T1
+0aef:	BNE	$0B03
+0af1:	MOV	ACCU, T4
+0af3:	MOV	T2, ACCU
+0af5:	MOV	T4, 10(FP)
+0af8:	MOV	ACCU, T2
+0afa:	SUB	ACCU, T4
+0afc:	POP	#$0002
+0aff:	RETURN	9, 19
+0b03:	MOVB	ACCU, T0
+0b05:	BEQ	$0AF5
+0b07:	MOV	ACCU, T4
+0b09:	MOV	P0, ACCU
+0b0b:	CALL	puts + 0
+0b0e:	MOV	ACCU, T4
+0b10:	MOV	T2, ACCU
+0b12:	JUMP	$0AF5
+0b14:	LEA	T5, 14(FP)
+0b18:	ADD	T2, #$0001
+0b1c:	MOVB	ACCU, T3
+0b1e:	CMPUB	ACCU, #$0025
+0b20:	BEQ	$0B7E
+0b22:	MOVB	ACCU, T1
+0b24:	LEAX	ADDR, T4 + ACCU
+0b26:	MOVB	0(ADDR), T3
+0b29:	ADDB	T1, #$0001
+0b2c:	MOVB	ACCU, T1
+0b2e:	CMPUB	ACCU, #$0028
+0b30:	BLE	$0B43
+0b32:	MOV	ADDR, T2
+0b34:	MOVB	T6, 0(ADDR)
+0b37:	ADD	T2, #$0001
+0b3b:	MOVB	ACCU, T6
+0b3d:	MOVB	T3, ACCU
+0b3f:	BNE	$0B1C
+0b41:	JUMP	$0ADF
+0b43:	MOVB	ACCU, T1
+0b45:	MOV	T7, ACCU
+0b47:	MOVB	ACCU, T0
+0b49:	BNE	$0B5D
+0b4b:	MOV	ACCU, T7
+0b4d:	ADD	T4, ACCU
+0b4f:	MOVB	T1, #0
+0b52:	MOV	ADDR, T2
+0b54:	MOVB	T6, 0(ADDR)
+0b57:	ADD	T2, #$0001
+0b5b:	JUMP	$0B3B
+0b5d:	MOV	ACCU, T4
+0b5f:	ADD	T7, ACCU
+0b61:	MOV	ADDR, T7
+0b63:	MOV	ACCU, #0
+0b66:	MOVB	0(ADDR), ACCU
+0b69:	MOV	ACCU, T4
+0b6b:	MOV	P0, ACCU
+0b6d:	CALL	puts + 0
+0b70:	MOVB	T1, #0
+0b73:	MOV	ADDR, T2
+0b75:	MOVB	T6, 0(ADDR)
+0b78:	ADD	T2, #$0001
+0b7c:	JUMP	$0B3B
+0b7e:	MOVB	ACCU, T1
+0b80:	BNEF	$1143
+0b83:	MOV	ADDR, T2
+0b85:	MOVB	T3, 0(ADDR)
+0b88:	MOV	ACCU, #10
+0b8b:	MOV	3(FP), ACCU
+0b8e:	MOV	ACCU, #1
+0b91:	MOVB	1(FP), ACCU
+0b94:	MOV	ACCU, #255
+0b97:	MOVB	2(FP), ACCU
+0b9a:	MOV	ACCU, #32
+0b9d:	MOVB	0(FP), ACCU
+0ba0:	MOV	ACCU, #0
+0ba3:	MOVB	5(FP), ACCU
+0ba6:	MOVB	6(FP), ACCU
+0ba9:	MOVB	7(FP), ACCU
+0bac:	ADD	T2, #$0001
+0bb0:	MOVB	ACCU, T3
+0bb2:	CMPUB	ACCU, #$002B
+0bb4:	BEQF	$1135
+0bb7:	MOVB	ACCU, T3
+0bb9:	CMPUB	ACCU, #$0030
+0bbb:	BEQF	$1127
+0bbe:	MOVB	ACCU, T3
+0bc0:	CMPUB	ACCU, #$0023
+0bc2:	BEQF	$1119
+0bc5:	MOVB	ACCU, T3
+0bc7:	CMPUB	ACCU, #$0030
+0bc9:	BGT	$0BD2
+0bcb:	MOVB	ACCU, T3
+0bcd:	CMPUB	ACCU, #$0039
+0bcf:	BGEF	$10E8
+0bd2:	MOVB	ACCU, T3
+0bd4:	CMPUB	ACCU, #$002E
+0bd6:	BEQF	$10AE
+0bd9:	MOVB	ACCU, T3
+0bdb:	CMPUB	ACCU, #$0064
+0bdd:	BEQF	$0F86
+0be0:	MOVB	ACCU, T3
+0be2:	CMPUB	ACCU, #$0075
+0be4:	BEQF	$0E73
+0be7:	MOVB	ACCU, T3
+0be9:	CMPUB	ACCU, #$0078
+0beb:	BEQF	$0D4E
+0bee:	MOVB	ACCU, T3
+0bf0:	CMPUB	ACCU, #$006C
+0bf2:	BEQF	$0CC3
+0bf5:	MOVB	ACCU, T3
+0bf7:	CMPUB	ACCU, #$0066
+0bf9:	BEQF	$0C99
+0bfc:	MOVB	ACCU, T3
+0bfe:	CMPUB	ACCU, #$0067
+0c00:	BEQF	$0C99
+0c03:	MOVB	ACCU, T3
+0c05:	CMPUB	ACCU, #$0065
+0c07:	BEQF	$0C99
+0c0a:	MOVB	ACCU, T3
+0c0c:	CMPUB	ACCU, #$0073
+0c0e:	BEQ	$0C50
+0c10:	MOVB	ACCU, T3
+0c12:	CMPUB	ACCU, #$0063
+0c14:	BEQ	$0C31
+0c16:	MOVB	ACCU, T3
+0c18:	BEQF	$0B32
+0c1b:	MOVB	ACCU, T1
+0c1d:	LEAX	ADDR, T4 + ACCU
+0c1f:	MOVB	0(ADDR), T3
+0c22:	ADDB	T1, #$0001
+0c25:	MOV	ADDR, T2
+0c27:	MOVB	T6, 0(ADDR)
+0c2a:	ADD	T2, #$0001
+0c2e:	JUMPF	$0B3B
+0c31:	MOVB	ACCU, T1
+0c33:	MOV	ADDR, T5
+0c35:	MOV	T8, 0(ADDR)
+0c38:	LEAX	ADDR, T4 + ACCU
+0c3a:	MOVB	0(ADDR), T8
+0c3d:	ADD	T5, #$0002
+0c41:	ADDB	T1, #$0001
+0c44:	MOV	ADDR, T2
+0c46:	MOVB	T6, 0(ADDR)
+0c49:	ADD	T2, #$0001
+0c4d:	JUMPF	$0B3B
+0c50:	MOV	ADDR, T5
+0c52:	MOV	T7, 0(ADDR)
+0c55:	ADD	T5, #$0002
+0c59:	MOVB	ACCU, T0
+0c5b:	BNE	$0C86
+0c5d:	MOV	ADDR, T7
+0c5f:	MOVB	T3, 0(ADDR)
+0c62:	MOVB	ACCU, T3
+0c64:	BEQF	$0B32
+0c67:	ADD	T7, #$0001
+0c6b:	MOV	ADDR, T4
+0c6d:	MOVB	0(ADDR), T3
+0c70:	ADD	T4, #$0001
+0c74:	MOV	ADDR, T7
+0c76:	MOVB	T6, 0(ADDR)
+0c79:	ADD	T7, #$0001
+0c7d:	MOVB	ACCU, T6
+0c7f:	MOVB	T3, ACCU
+0c81:	BNE	$0C6B
+0c83:	JUMPF	$0B32
+0c86:	MOV	ACCU, T7
+0c88:	MOV	P0, ACCU
+0c8a:	CALL	puts + 0
+0c8d:	MOV	ADDR, T2
+0c8f:	MOVB	T6, 0(ADDR)
+0c92:	ADD	T2, #$0001
+0c96:	JUMPF	$0B3B
+0c99:	LEA	P0, 0(FP)
+0c9d:	MOV	ACCU, T4
+0c9f:	MOV	P2, ACCU
+0ca1:	MOV	ADDR, T5
+0ca3:	MOVD	T12, 0(ADDR)
+0ca6:	MOVD	ACCU, T12
+0ca8:	MOVD	P4, ACCU
+0caa:	MOVB	ACCU, T3
+0cac:	MOVB	P8, ACCU
+0cae:	CALL	nformf + 0
+0cb1:	MOV	T1, ACCU
+0cb3:	ADD	T5, #$0004
+0cb7:	MOV	ADDR, T2
+0cb9:	MOVB	T6, 0(ADDR)
+0cbc:	ADD	T2, #$0001
+0cc0:	JUMPF	$0B3B
+0cc3:	MOV	ADDR, T5
+0cc5:	MOVD	T12, 0(ADDR)
+0cc8:	ADD	T5, #$0004
+0ccc:	MOV	ADDR, T2
+0cce:	MOVB	T3, 0(ADDR)
+0cd1:	ADD	T2, #$0001
+0cd5:	MOVB	ACCU, T3
+0cd7:	CMPUB	ACCU, #$0064
+0cd9:	BEQ	$0D2E
+0cdb:	MOVB	ACCU, T3
+0cdd:	CMPUB	ACCU, #$0075
+0cdf:	BEQ	$0D0E
+0ce1:	MOVB	ACCU, T3
+0ce3:	CMPUB	ACCU, #$0078
+0ce5:	BNEF	$0B32
+0ce8:	MOV	ACCU, #16
+0ceb:	MOV	3(FP), ACCU
+0cee:	LEA	P0, 0(FP)
+0cf2:	MOV	ACCU, T4
+0cf4:	MOV	P2, ACCU
+0cf6:	MOVD	ACCU, T12
+0cf8:	MOVD	P4, ACCU
+0cfa:	MOVB	P8, #0
+0cfd:	CALL	nforml + 0
+0d00:	MOV	T1, ACCU
+0d02:	MOV	ADDR, T2
+0d04:	MOVB	T6, 0(ADDR)
+0d07:	ADD	T2, #$0001
+0d0b:	JUMPF	$0B3B
+0d0e:	LEA	P0, 0(FP)
+0d12:	MOV	ACCU, T4
+0d14:	MOV	P2, ACCU
+0d16:	MOVD	ACCU, T12
+0d18:	MOVD	P4, ACCU
+0d1a:	MOVB	P8, #0
+0d1d:	CALL	nforml + 0
+0d20:	MOV	T1, ACCU
+0d22:	MOV	ADDR, T2
+0d24:	MOVB	T6, 0(ADDR)
+0d27:	ADD	T2, #$0001
+0d2b:	JUMPF	$0B3B
+0d2e:	LEA	P0, 0(FP)
+0d32:	MOV	ACCU, T4
+0d34:	MOV	P2, ACCU
+0d36:	MOVD	ACCU, T12
+0d38:	MOVD	P4, ACCU
+0d3a:	MOVB	P8, #1
+0d3d:	CALL	nforml + 0
+0d40:	MOV	T1, ACCU
+0d42:	MOV	ADDR, T2
+0d44:	MOVB	T6, 0(ADDR)
+0d47:	ADD	T2, #$0001
+0d4b:	JUMPF	$0B3B
+0d4e:	MOV	ACCU, #16
+0d51:	MOV	3(FP), ACCU
+0d54:	MOV	ACCU, T4
+0d56:	MOV	T7, ACCU
+0d58:	MOV	ADDR, T5
+0d5a:	MOV	T8, 0(ADDR)
+0d5d:	ADD	T5, #$0002
+0d61:	MOVB	T1, #0
+0d64:	MOVB	T3, #10
+0d67:	MOV	ACCU, T8
+0d69:	BNEF	$0E43
+0d6c:	MOVB	T6, 2(FP)
+0d6f:	MOVB	ACCU, T6
+0d71:	CMPUB	ACCU, #$00FF
+0d73:	BNEF	$0E33
+0d76:	MOVB	T6, #9
+0d79:	MOVB	ACCU, T3
+0d7b:	CMPUB	ACCU, #$0009
+0d7d:	BGE	$0D92
+0d7f:	ADDB	T3, #$00FF
+0d82:	MOVB	ACCU, T3
+0d84:	LEAX	ADDR, T7 + ACCU
+0d86:	MOV	ACCU, #48
+0d89:	MOVB	0(ADDR), ACCU
+0d8c:	MOVB	ACCU, T6
+0d8e:	CMPUB	ACCU, T3
+0d90:	BGT	$0D7F
+0d92:	MOVUB	ACCU, 7(FP)
+0d95:	BEQ	$0DBB
+0d97:	MOV	ACCU, 3(FP)
+0d9a:	CMPU	ACCU, #$0010
+0d9d:	BNE	$0DBB
+0d9f:	MOVB	ACCU, T3
+0da1:	ADDB	ACCU, #$00FF
+0da4:	MOVB	ACCU, ACCU
+0da6:	LEAX	ADDR, T7 + ACCU
+0da8:	MOV	ACCU, #88
+0dab:	MOVB	0(ADDR), ACCU
+0dae:	ADDB	T3, #$00FE
+0db1:	MOVB	ACCU, T3
+0db3:	LEAX	ADDR, T7 + ACCU
+0db5:	MOV	ACCU, #48
+0db8:	MOVB	0(ADDR), ACCU
+0dbb:	MOVB	ACCU, T1
+0dbd:	BNE	$0E24
+0dbf:	MOVUB	ACCU, 5(FP)
+0dc2:	BEQ	$0DD1
+0dc4:	ADDB	T3, #$00FF
+0dc7:	MOVB	ACCU, T3
+0dc9:	LEAX	ADDR, T7 + ACCU
+0dcb:	MOV	ACCU, #43
+0dce:	MOVB	0(ADDR), ACCU
+0dd1:	MOVUB	T8, 1(FP)
+0dd4:	SUBR	T8, #$000A
+0dd8:	MOVB	ACCU, T3
+0dda:	MOV	T9, ACCU
+0ddc:	MOV	ACCU, T8
+0dde:	CMPS	ACCU, T9
+0de0:	BGT	$0E15
+0de2:	MOVB	T1, #0
+0de5:	MOVB	ACCU, T3
+0de7:	CMPUB	ACCU, #$000A
+0de9:	BLE	$0E05
+0deb:	MOVB	ACCU, T3
+0ded:	LEAX	ADDR, T7 + ACCU
+0def:	MOVB	T6, 0(ADDR)
+0df2:	MOVB	ACCU, T1
+0df4:	LEAX	ADDR, T7 + ACCU
+0df6:	MOVB	0(ADDR), T6
+0df9:	ADDB	T1, #$0001
+0dfc:	ADDB	T3, #$0001
+0dff:	MOVB	ACCU, T3
+0e01:	CMPUB	ACCU, #$000A
+0e03:	BGT	$0DEB
+0e05:	MOV	ADDR, T2
+0e07:	MOVB	T6, 0(ADDR)
+0e0a:	ADD	T2, #$0001
+0e0e:	AND	T1, #$00FF
+0e12:	JUMPF	$0B3B
+0e15:	ADDB	T3, #$00FF
+0e18:	MOVB	ACCU, T3
+0e1a:	LEAX	ADDR, T7 + ACCU
+0e1c:	MOVB	T1, 0(FP)
+0e1f:	MOVB	0(ADDR), T1
+0e22:	JUMP	$0DD1
+0e24:	ADDB	T3, #$00FF
+0e27:	MOVB	ACCU, T3
+0e29:	LEAX	ADDR, T7 + ACCU
+0e2b:	MOV	ACCU, #45
+0e2e:	MOVB	0(ADDR), ACCU
+0e31:	JUMP	$0DD1
+0e33:	MOVB	ACCU, T6
+0e35:	SUBR	ACCU, #$000A
+0e39:	MOV	T6, ACCU
+0e3b:	CMPUB	ACCU, T3
+0e3d:	BGTF	$0D7F
+0e40:	JUMPF	$0D92
+0e43:	MOV	T9, 3(FP)
+0e46:	MOV	ACCU, T8
+0e48:	MODU	ACCU, T9
+0e4a:	MOV	T9, ACCU
+0e4c:	CMPS	ACCU, #$000A
+0e4f:	BLE	$0E57
+0e51:	ADD	T9, #$0030
+0e55:	JUMP	$0E5B
+0e57:	ADD	T9, #$0037
+0e5b:	ADDB	T3, #$00FF
+0e5e:	MOVB	ACCU, T3
+0e60:	LEAX	ADDR, T7 + ACCU
+0e62:	MOVB	0(ADDR), T9
+0e65:	MOV	T9, 3(FP)
+0e68:	MOV	ACCU, T8
+0e6a:	DIVU	ACCU, T9
+0e6c:	MOV	T8, ACCU
+0e6e:	BNE	$0E43
+0e70:	JUMPF	$0D6C
+0e73:	MOV	ACCU, T4
+0e75:	MOV	T7, ACCU
+0e77:	MOV	ADDR, T5
+0e79:	MOV	T8, 0(ADDR)
+0e7c:	ADD	T5, #$0002
+0e80:	MOVB	T1, #0
+0e83:	MOVB	T3, #10
+0e86:	MOV	ACCU, T8
+0e88:	BNEF	$0F56
+0e8b:	MOVB	T6, 2(FP)
+0e8e:	MOVB	ACCU, T6
+0e90:	CMPUB	ACCU, #$00FF
+0e92:	BNEF	$0F46
+0e95:	MOVB	T6, #9
+0e98:	MOVB	ACCU, T3
+0e9a:	CMPUB	ACCU, #$0009
+0e9c:	BGE	$0EB1
+0e9e:	ADDB	T3, #$00FF
+0ea1:	MOVB	ACCU, T3
+0ea3:	LEAX	ADDR, T7 + ACCU
+0ea5:	MOV	ACCU, #48
+0ea8:	MOVB	0(ADDR), ACCU
+0eab:	MOVB	ACCU, T6
+0ead:	CMPUB	ACCU, T3
+0eaf:	BGT	$0E9E
+0eb1:	MOVUB	ACCU, 7(FP)
+0eb4:	BEQ	$0EDA
+0eb6:	MOV	ACCU, 3(FP)
+0eb9:	CMPU	ACCU, #$0010
+0ebc:	BNE	$0EDA
+0ebe:	MOVB	ACCU, T3
+0ec0:	ADDB	ACCU, #$00FF
+0ec3:	MOVB	ACCU, ACCU
+0ec5:	LEAX	ADDR, T7 + ACCU
+0ec7:	MOV	ACCU, #88
+0eca:	MOVB	0(ADDR), ACCU
+0ecd:	ADDB	T3, #$00FE
+0ed0:	MOVB	ACCU, T3
+0ed2:	LEAX	ADDR, T7 + ACCU
+0ed4:	MOV	ACCU, #48
+0ed7:	MOVB	0(ADDR), ACCU
+0eda:	MOVB	ACCU, T1
+0edc:	BNE	$0F37
+0ede:	MOVUB	ACCU, 5(FP)
+0ee1:	BEQ	$0EF0
+0ee3:	ADDB	T3, #$00FF
+0ee6:	MOVB	ACCU, T3
+0ee8:	LEAX	ADDR, T7 + ACCU
+0eea:	MOV	ACCU, #43
+0eed:	MOVB	0(ADDR), ACCU
+0ef0:	MOVUB	T8, 1(FP)
+0ef3:	SUBR	T8, #$000A
+0ef7:	MOVB	ACCU, T3
+0ef9:	MOV	T9, ACCU
+0efb:	MOV	ACCU, T8
+0efd:	CMPS	ACCU, T9
+0eff:	BGT	$0F28
+0f01:	MOVB	T1, #0
+0f04:	MOVB	ACCU, T3
+0f06:	CMPUB	ACCU, #$000A
+0f08:	BLEF	$0E05
+0f0b:	MOVB	ACCU, T3
+0f0d:	LEAX	ADDR, T7 + ACCU
+0f0f:	MOVB	T6, 0(ADDR)
+0f12:	MOVB	ACCU, T1
+0f14:	LEAX	ADDR, T7 + ACCU
+0f16:	MOVB	0(ADDR), T6
+0f19:	ADDB	T1, #$0001
+0f1c:	ADDB	T3, #$0001
+0f1f:	MOVB	ACCU, T3
+0f21:	CMPUB	ACCU, #$000A
+0f23:	BGT	$0F0B
+0f25:	JUMPF	$0E05
+0f28:	ADDB	T3, #$00FF
+0f2b:	MOVB	ACCU, T3
+0f2d:	LEAX	ADDR, T7 + ACCU
+0f2f:	MOVB	T1, 0(FP)
+0f32:	MOVB	0(ADDR), T1
+0f35:	JUMP	$0EF0
+0f37:	ADDB	T3, #$00FF
+0f3a:	MOVB	ACCU, T3
+0f3c:	LEAX	ADDR, T7 + ACCU
+0f3e:	MOV	ACCU, #45
+0f41:	MOVB	0(ADDR), ACCU
+0f44:	JUMP	$0EF0
+0f46:	MOVB	ACCU, T6
+0f48:	SUBR	ACCU, #$000A
+0f4c:	MOV	T6, ACCU
+0f4e:	CMPUB	ACCU, T3
+0f50:	BGTF	$0E9E
+0f53:	JUMPF	$0EB1
+0f56:	MOV	T9, 3(FP)
+0f59:	MOV	ACCU, T8
+0f5b:	MODU	ACCU, T9
+0f5d:	MOV	T9, ACCU
+0f5f:	CMPS	ACCU, #$000A
+0f62:	BLE	$0F6A
+0f64:	ADD	T9, #$0030
+0f68:	JUMP	$0F6E
+0f6a:	ADD	T9, #$0037
+0f6e:	ADDB	T3, #$00FF
+0f71:	MOVB	ACCU, T3
+0f73:	LEAX	ADDR, T7 + ACCU
+0f75:	MOVB	0(ADDR), T9
+0f78:	MOV	T9, 3(FP)
+0f7b:	MOV	ACCU, T8
+0f7d:	DIVU	ACCU, T9
+0f7f:	MOV	T8, ACCU
+0f81:	BNE	$0F56
+0f83:	JUMPF	$0E8B
+0f86:	MOV	ACCU, T4
+0f88:	MOV	T7, ACCU
+0f8a:	MOV	ADDR, T5
+0f8c:	MOV	T8, 0(ADDR)
+0f8f:	ADD	T5, #$0002
+0f93:	MOV	ACCU, T8
+0f95:	BLTF	$10A0
+0f98:	MOV	T9, ACCU
+0f9a:	MOVB	T1, #0
+0f9d:	MOVB	T3, #10
+0fa0:	MOV	ACCU, T8
+0fa2:	BNEF	$1070
+0fa5:	MOVB	T6, 2(FP)
+0fa8:	MOVB	ACCU, T6
+0faa:	CMPUB	ACCU, #$00FF
+0fac:	BNEF	$1060
+0faf:	MOVB	T6, #9
+0fb2:	MOVB	ACCU, T3
+0fb4:	CMPUB	ACCU, #$0009
+0fb6:	BGE	$0FCB
+0fb8:	ADDB	T3, #$00FF
+0fbb:	MOVB	ACCU, T3
+0fbd:	LEAX	ADDR, T7 + ACCU
+0fbf:	MOV	ACCU, #48
+0fc2:	MOVB	0(ADDR), ACCU
+0fc5:	MOVB	ACCU, T6
+0fc7:	CMPUB	ACCU, T3
+0fc9:	BGT	$0FB8
+0fcb:	MOVUB	ACCU, 7(FP)
+0fce:	BEQ	$0FF4
+0fd0:	MOV	ACCU, 3(FP)
+0fd3:	CMPU	ACCU, #$0010
+0fd6:	BNE	$0FF4
+0fd8:	MOVB	ACCU, T3
+0fda:	ADDB	ACCU, #$00FF
+0fdd:	MOVB	ACCU, ACCU
+0fdf:	LEAX	ADDR, T7 + ACCU
+0fe1:	MOV	ACCU, #88
+0fe4:	MOVB	0(ADDR), ACCU
+0fe7:	ADDB	T3, #$00FE
+0fea:	MOVB	ACCU, T3
+0fec:	LEAX	ADDR, T7 + ACCU
+0fee:	MOV	ACCU, #48
+0ff1:	MOVB	0(ADDR), ACCU
+0ff4:	MOVB	ACCU, T1
+0ff6:	BNE	$1051
+0ff8:	MOVUB	ACCU, 5(FP)
+0ffb:	BEQ	$100A
+0ffd:	ADDB	T3, #$00FF
+1000:	MOVB	ACCU, T3
+1002:	LEAX	ADDR, T7 + ACCU
+1004:	MOV	ACCU, #43
+1007:	MOVB	0(ADDR), ACCU
+100a:	MOVUB	T8, 1(FP)
+100d:	SUBR	T8, #$000A
+1011:	MOVB	ACCU, T3
+1013:	MOV	T9, ACCU
+1015:	MOV	ACCU, T8
+1017:	CMPS	ACCU, T9
+1019:	BGT	$1042
+101b:	MOVB	T1, #0
+101e:	MOVB	ACCU, T3
+1020:	CMPUB	ACCU, #$000A
+1022:	BLEF	$0E05
+1025:	MOVB	ACCU, T3
+1027:	LEAX	ADDR, T7 + ACCU
+1029:	MOVB	T6, 0(ADDR)
+102c:	MOVB	ACCU, T1
+102e:	LEAX	ADDR, T7 + ACCU
+1030:	MOVB	0(ADDR), T6
+1033:	ADDB	T1, #$0001
+1036:	ADDB	T3, #$0001
+1039:	MOVB	ACCU, T3
+103b:	CMPUB	ACCU, #$000A
+103d:	BGT	$1025
+103f:	JUMPF	$0E05
+1042:	ADDB	T3, #$00FF
+1045:	MOVB	ACCU, T3
+1047:	LEAX	ADDR, T7 + ACCU
+1049:	MOVB	T1, 0(FP)
+104c:	MOVB	0(ADDR), T1
+104f:	JUMP	$100A
+1051:	ADDB	T3, #$00FF
+1054:	MOVB	ACCU, T3
+1056:	LEAX	ADDR, T7 + ACCU
+1058:	MOV	ACCU, #45
+105b:	MOVB	0(ADDR), ACCU
+105e:	JUMP	$100A
+1060:	MOVB	ACCU, T6
+1062:	SUBR	ACCU, #$000A
+1066:	MOV	T6, ACCU
+1068:	CMPUB	ACCU, T3
+106a:	BGTF	$0FB8
+106d:	JUMPF	$0FCB
+1070:	MOV	T8, 3(FP)
+1073:	MOV	ACCU, T9
+1075:	MODU	ACCU, T8
+1077:	MOV	T8, ACCU
+1079:	CMPS	ACCU, #$000A
+107c:	BLE	$1084
+107e:	ADD	T8, #$0030
+1082:	JUMP	$1088
+1084:	ADD	T8, #$0037
+1088:	ADDB	T3, #$00FF
+108b:	MOVB	ACCU, T3
+108d:	LEAX	ADDR, T7 + ACCU
+108f:	MOVB	0(ADDR), T8
+1092:	MOV	T8, 3(FP)
+1095:	MOV	ACCU, T9
+1097:	DIVU	ACCU, T8
+1099:	MOV	T9, ACCU
+109b:	BNE	$1070
+109d:	JUMPF	$0FA5
+10a0:	MOVB	T1, #1
+10a3:	MOVB	T3, #10
+10a6:	NEG	ACCU
+10a7:	MOV	T9, ACCU
+10a9:	BNE	$1070
+10ab:	JUMPF	$0FA5
+10ae:	MOV	T7, #0
+10b1:	MOV	ADDR, T2
+10b3:	MOVB	T3, 0(ADDR)
+10b6:	ADD	T2, #$0001
+10ba:	MOVB	ACCU, T3
+10bc:	CMPUB	ACCU, #$0030
+10be:	BGT	$10E2
+10c0:	MOVB	ACCU, T3
+10c2:	CMPUB	ACCU, #$0039
+10c4:	BLT	$10E2
+10c6:	MOVB	ACCU, T3
+10c8:	MOV	T8, ACCU
+10ca:	MOV	ADDR, T2
+10cc:	MOVB	T3, 0(ADDR)
+10cf:	ADD	T2, #$0001
+10d3:	MUL	T7, #10
+10d6:	ADD	T7, ACCU
+10d8:	ADD	T7, #$FFD0
+10dc:	MOVB	ACCU, T3
+10de:	CMPUB	ACCU, #$0030
+10e0:	BLE	$10C0
+10e2:	MOVB	2(FP), T7
+10e5:	JUMPF	$0BD9
+10e8:	MOV	T7, #0
+10eb:	MOVB	ACCU, T3
+10ed:	CMPUB	ACCU, #$0030
+10ef:	BGT	$1113
+10f1:	MOVB	ACCU, T3
+10f3:	CMPUB	ACCU, #$0039
+10f5:	BLT	$1113
+10f7:	MOVB	ACCU, T3
+10f9:	MOV	T8, ACCU
+10fb:	MOV	ADDR, T2
+10fd:	MOVB	T3, 0(ADDR)
+1100:	ADD	T2, #$0001
+1104:	MUL	T7, #10
+1107:	ADD	T7, ACCU
+1109:	ADD	T7, #$FFD0
+110d:	MOVB	ACCU, T3
+110f:	CMPUB	ACCU, #$0030
+1111:	BLE	$10F1
+1113:	MOVB	1(FP), T7
+1116:	JUMPF	$0BD2
+1119:	MOV	ACCU, #1
+111c:	MOVB	7(FP), ACCU
+111f:	MOV	ADDR, T2
+1121:	MOVB	T3, 0(ADDR)
+1124:	JUMPF	$0BAC
+1127:	MOV	ACCU, #48
+112a:	MOVB	0(FP), ACCU
+112d:	MOV	ADDR, T2
+112f:	MOVB	T3, 0(ADDR)
+1132:	JUMPF	$0BAC
+1135:	MOV	ACCU, #1
+1138:	MOVB	5(FP), ACCU
+113b:	MOV	ADDR, T2
+113d:	MOVB	T3, 0(ADDR)
+1140:	JUMPF	$0BAC
+1143:	MOVB	ACCU, T0
+1145:	BNE	$1151
+1147:	MOVB	ACCU, T1
+1149:	ADD	T4, ACCU
+114b:	MOVB	T1, #0
+114e:	JUMPF	$0B83
+1151:	MOVB	ACCU, T1
+1153:	LEAX	ADDR, T4 + ACCU
+1155:	MOV	ACCU, #0
+1158:	MOVB	0(ADDR), ACCU
+115b:	MOV	ACCU, T4
+115d:	MOV	P0, ACCU
+115f:	CALL	puts + 0
+1162:	MOVB	T1, #0
+1165:	JUMPF	$0B83
+--------------------------------------------------------------------
+puts:
+1168:	ENTER	0, 2
+116c:	JSR	$1173
+116f:	RETURN	0, 2
+--------------------------------------------------------------------
+1173 : a0 00 __ LDY #$00
+1175 : b1 0d __ LDA (P0),y
+1177 : f0 0b __ BEQ $1184
+1179 : 20 85 11 JSR $1185 ; (putpch + 0)
+117c : e6 0d __ INC P0
+117e : d0 f3 __ BNE $1173
+1180 : e6 0e __ INC P1
+1182 : d0 ef __ BNE $1173
+1184 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1185 : ae be 23 LDX $23be ; (giocharmap + 0)
+1188 : e0 01 __ CPX #$01
+118a : 90 22 __ BCC $11ae
+118c : c9 0a __ CMP #$0a
+118e : d0 02 __ BNE $1192
+1190 : a9 0d __ LDA #$0d
+1192 : e0 02 __ CPX #$02
+1194 : 90 18 __ BCC $11ae
+1196 : c9 41 __ CMP #$41
+1198 : 90 14 __ BCC $11ae
+119a : c9 7b __ CMP #$7b
+119c : b0 10 __ BCS $11ae
+119e : c9 61 __ CMP #$61
+11a0 : b0 04 __ BCS $11a6
+11a2 : c9 5b __ CMP #$5b
+11a4 : b0 08 __ BCS $11ae
+11a6 : 49 20 __ EOR #$20
+11a8 : e0 03 __ CPX #$03
+11aa : f0 02 __ BEQ $11ae
+11ac : 29 df __ AND #$df
+11ae : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+11b1:	ENTER	5, 7
+11b5:	MOVD	ACCU, P4
+11b7:	MOVD	T0, ACCU
+11b9:	MOVD	T1, ACCU
+11bb:	MOV	ACCU, P2
+11bd:	MOV	T2, ACCU
+11bf:	MOVB	T3, #0
+11c2:	MOVB	ACCU, P8
+11c4:	BEQ	$11D3
+11c6:	MOVD	ACCU, #$00000000
+11cc:	EXTRT	T0, inp_op_cmp_s32 + 0
+11d0:	BLTF	$1318
+11d3:	MOVB	T4, #16
+11d6:	MOVD	ACCU, #$00000000
+11dc:	EXTRT	T0, inp_op_cmp_u32 + 0
+11e0:	BGTF	$12C0
+11e3:	MOV	ADDR, P0
+11e5:	MOVB	T5, 2(ADDR)
+11e8:	MOVB	ACCU, T5
+11ea:	CMPUB	ACCU, #$00FF
+11ec:	BNEF	$12B0
+11ef:	MOVB	T5, #15
+11f2:	MOVB	ACCU, T4
+11f4:	CMPUB	ACCU, #$000F
+11f6:	BGE	$120B
+11f8:	ADDB	T4, #$00FF
+11fb:	MOVB	ACCU, T4
+11fd:	LEAX	ADDR, T2 + ACCU
+11ff:	MOV	ACCU, #48
+1202:	MOVB	0(ADDR), ACCU
+1205:	MOVB	ACCU, T5
+1207:	CMPUB	ACCU, T4
+1209:	BGT	$11F8
+120b:	MOV	ACCU, P0
+120d:	MOV	T6, ACCU
+120f:	MOV	ADDR, T6
+1211:	MOVUB	ACCU, 7(ADDR)
+1214:	BEQ	$123A
+1216:	MOV	ACCU, 3(ADDR)
+1219:	CMPU	ACCU, #$0010
+121c:	BNE	$123A
+121e:	MOVB	ACCU, T4
+1220:	ADDB	ACCU, #$00FF
+1223:	MOVB	ACCU, ACCU
+1225:	LEAX	ADDR, T2 + ACCU
+1227:	MOV	ACCU, #88
+122a:	MOVB	0(ADDR), ACCU
+122d:	ADDB	T4, #$00FE
+1230:	MOVB	ACCU, T4
+1232:	LEAX	ADDR, T2 + ACCU
+1234:	MOV	ACCU, #48
+1237:	MOVB	0(ADDR), ACCU
+123a:	MOVB	ACCU, T3
+123c:	BNE	$12A1
+123e:	MOV	ADDR, T6
+1240:	MOVUB	ACCU, 5(ADDR)
+1243:	BEQ	$1252
+1245:	ADDB	T4, #$00FF
+1248:	MOVB	ACCU, T4
+124a:	LEAX	ADDR, T2 + ACCU
+124c:	MOV	ACCU, #43
+124f:	MOVB	0(ADDR), ACCU
+1252:	MOV	ACCU, P0
+1254:	MOV	T6, ACCU
+1256:	MOV	ADDR, T6
+1258:	MOVUB	T7, 1(ADDR)
+125b:	SUBR	T7, #$0010
+125f:	MOVB	ACCU, T4
+1261:	MOV	T8, ACCU
+1263:	MOV	ACCU, T7
+1265:	CMPS	ACCU, T8
+1267:	BGT	$1292
+1269:	MOVB	T3, #0
+126c:	MOVB	ACCU, T4
+126e:	CMPUB	ACCU, #$0010
+1270:	BLE	$128C
+1272:	MOVB	ACCU, T4
+1274:	LEAX	ADDR, T2 + ACCU
+1276:	MOVB	T5, 0(ADDR)
+1279:	MOVB	ACCU, T3
+127b:	LEAX	ADDR, T2 + ACCU
+127d:	MOVB	0(ADDR), T5
+1280:	ADDB	T3, #$0001
+1283:	ADDB	T4, #$0001
+1286:	MOVB	ACCU, T4
+1288:	CMPUB	ACCU, #$0010
+128a:	BGT	$1272
+128c:	MOVB	ACCU, T3
+128e:	RETURN	5, 7
+1292:	MOVB	T3, 0(ADDR)
+1295:	ADDB	T4, #$00FF
+1298:	MOVB	ACCU, T4
+129a:	LEAX	ADDR, T2 + ACCU
+129c:	MOVB	0(ADDR), T3
+129f:	JUMP	$1252
+12a1:	ADDB	T4, #$00FF
+12a4:	MOVB	ACCU, T4
+12a6:	LEAX	ADDR, T2 + ACCU
+12a8:	MOV	ACCU, #45
+12ab:	MOVB	0(ADDR), ACCU
+12ae:	JUMP	$1252
+12b0:	MOVB	ACCU, T5
+12b2:	SUBR	ACCU, #$0010
+12b6:	MOV	T5, ACCU
+12b8:	CMPUB	ACCU, T4
+12ba:	BGTF	$11F8
+12bd:	JUMPF	$120B
+12c0:	MOV	ACCU, P0
+12c2:	MOV	T6, ACCU
+12c4:	MOV	ADDR, T6
+12c6:	MOV	ACCU, 3(ADDR)
+12c9:	EXTRT	$00, inp_op_ext_u16 + 0
+12cd:	MOVD	T0, ACCU
+12cf:	MOVD	ACCU, T1
+12d1:	EXTRT	T0, inp_binop_mod_u32 + 0
+12d5:	MOVD	T0, ACCU
+12d7:	CMPS	ACCU, #$000A
+12da:	BLE	$12E4
+12dc:	MOV	ACCU, T0
+12de:	ADD	ACCU, #$0030
+12e2:	JUMP	$12EA
+12e4:	MOV	ACCU, T0
+12e6:	ADD	ACCU, #$0037
+12ea:	MOV	T7, ACCU
+12ec:	ADDB	T4, #$00FF
+12ef:	MOVB	ACCU, T4
+12f1:	LEAX	ADDR, T2 + ACCU
+12f3:	MOVB	0(ADDR), T7
+12f6:	MOV	ADDR, T6
+12f8:	MOV	ACCU, 3(ADDR)
+12fb:	EXTRT	$00, inp_op_ext_u16 + 0
+12ff:	MOVD	T0, ACCU
+1301:	MOVD	ACCU, T1
+1303:	EXTRT	T0, inp_binop_div_u32 + 0
+1307:	MOVD	T1, ACCU
+1309:	MOVD	ACCU, #$00000000
+130f:	EXTRT	T1, inp_op_cmp_u32 + 0
+1313:	BGT	$12C0
+1315:	JUMPF	$11E3
+1318:	MOVB	T3, #1
+131b:	MOVB	T4, #16
+131e:	MOVD	ACCU, T0
+1320:	EXTRT	$00, negaccu32 + 0
+1324:	MOVD	T1, ACCU
+1326:	MOVD	ACCU, #$00000000
+132c:	EXTRT	T1, inp_op_cmp_u32 + 0
+1330:	BGT	$12C0
+1332:	JUMPF	$11E3
+--------------------------------------------------------------------
+nformf:
+1335:	ENTER	10, 12
+1339:	MOV	ACCU, P2
+133b:	MOV	T0, ACCU
+133d:	MOV	T1, ACCU
+133f:	MOVD	ACCU, P4
+1341:	MOVD	T2, ACCU
+1343:	MOVD	ACCU, #$00000000
+1349:	CMPF	ACCU, T2
+134b:	BLTF	$164B
+134e:	MOVB	T3, #0
+1351:	MOV	ADDR, P0
+1353:	MOVUB	ACCU, 5(ADDR)
+1356:	BEQ	$1363
+1358:	MOV	ACCU, #43
+135b:	MOV	ADDR, T0
+135d:	MOVB	0(ADDR), ACCU
+1360:	MOVB	T3, #1
+1363:	MOV	T0, #0
+1366:	MOV	ADDR, P0
+1368:	MOVB	T5, 2(ADDR)
+136b:	MOVB	ACCU, T5
+136d:	CMPUB	ACCU, #$00FF
+136f:	BNE	$1376
+1371:	MOVB	T5, #6
+1374:	JUMP	$137A
+1376:	AND	T5, #$00FF
+137a:	MOVD	ACCU, P4
+137c:	MOVD	T2, #$00000000
+1382:	CMPF	ACCU, T2
+1384:	BNEF	$15CF
+1387:	MOVB	ACCU, P8
+1389:	MOVB	T6, ACCU
+138b:	CMPUB	ACCU, #$0065
+138d:	SEQ
+138e:	MOVB	T7, ACCU
+1390:	MOVB	T8, ACCU
+1392:	MOVB	ACCU, T5
+1394:	MOV	T4, ACCU
+1396:	ADD	T4, #$0001
+139a:	MOVB	ACCU, T6
+139c:	CMPUB	ACCU, #$0067
+139e:	BEQF	$15BE
+13a1:	MOVB	ACCU, T7
+13a3:	BNEF	$1572
+13a6:	MOV	ACCU, T0
+13a8:	BGE	$13C0
+13aa:	MOVD	ACCU, P4
+13ac:	MOVD	$03, #$41200000
+13b2:	DIVF	ACCU, $03
+13b4:	MOVD	T2, ACCU
+13b6:	MOVD	P4, ACCU
+13b8:	ADD	T0, #$0001
+13bc:	MOV	ACCU, T0
+13be:	BLT	$13AA
+13c0:	MOVD	T2, #$3f000000
+13c6:	MOVB	ACCU, T5
+13c8:	ADD	ACCU, T0
+13ca:	MOV	T4, ACCU
+13cc:	ADD	T4, #$0001
+13d0:	MOVB	ACCU, T4
+13d2:	CMPUB	ACCU, #$0001
+13d4:	BLTF	$1557
+13d7:	MOVD	ACCU, P4
+13d9:	ADDF	ACCU, T2
+13db:	MOVD	T2, ACCU
+13dd:	MOVD	P4, ACCU
+13df:	MOVD	ACCU, #$41200000
+13e5:	CMPF	ACCU, T2
+13e7:	BLT	$13FA
+13e9:	MOVD	ACCU, T2
+13eb:	MOVD	$03, #$41200000
+13f1:	DIVF	ACCU, $03
+13f3:	MOVD	T2, ACCU
+13f5:	MOVD	P4, ACCU
+13f7:	ADDB	T5, #$00FF
+13fa:	MOVB	ACCU, T4
+13fc:	MOV	T10, ACCU
+13fe:	MOVB	ACCU, T5
+1400:	NEG	ACCU
+1401:	ADD	ACCU, T10
+1403:	MOV	T10, ACCU
+1405:	MOVB	T5, ACCU
+1407:	MOVB	ACCU, T4
+1409:	CMPUB	ACCU, #$0014
+140b:	BGE	$1410
+140d:	MOVB	T4, #20
+1410:	MOVB	ACCU, T10
+1412:	BNE	$1421
+1414:	MOVB	ACCU, T3
+1416:	LEAX	ADDR, T1 + ACCU
+1418:	MOV	ACCU, #48
+141b:	MOVB	0(ADDR), ACCU
+141e:	ADDB	T3, #$0001
+1421:	MOVB	T6, #0
+1424:	MOVB	ACCU, T4
+1426:	BNEF	$1510
+1429:	MOVB	ACCU, T8
+142b:	BNE	$149F
+142d:	MOV	ADDR, P0
+142f:	MOVUB	ACCU, 1(ADDR)
+1432:	CMPUB	ACCU, T3
+1434:	BLT	$143C
+1436:	MOVB	ACCU, T3
+1438:	RETURN	10, 12
+143c:	MOVB	ACCU, T3
+143e:	CMPUB	ACCU, #$0001
+1440:	BLE	$146E
+1442:	MOVB	T5, #0
+1445:	MOV	ADDR, P0
+1447:	MOVUB	T0, 1(ADDR)
+144a:	MOVB	ACCU, T3
+144c:	NEG	ACCU
+144d:	ADD	ACCU, T0
+144f:	MOV	T4, ACCU
+1451:	MOVB	ACCU, T5
+1453:	MOV	T10, ACCU
+1455:	MOV	ACCU, T4
+1457:	CMPU	ACCU, T10
+1459:	BLT	$145F
+145b:	MOV	ACCU, T0
+145d:	JUMP	$1438
+145f:	MOV	ACCU, T1
+1461:	LEAX	ADDR, T10 + ACCU
+1463:	MOV	ACCU, #32
+1466:	MOVB	0(ADDR), ACCU
+1469:	ADDB	T5, #$0001
+146c:	JUMP	$1445
+146e:	MOVB	T5, #1
+1471:	MOV	ACCU, P0
+1473:	MOV	T0, ACCU
+1475:	MOVB	ACCU, T3
+1477:	MOV	T4, ACCU
+1479:	MOVB	ACCU, T5
+147b:	MOV	T10, ACCU
+147d:	MOV	ACCU, T4
+147f:	SUB	ACCU, T10
+1481:	MOV	ADDR, T0
+1483:	MOVB	T6, 1(ADDR)
+1486:	LEAX	ADDR, T1 + ACCU
+1488:	MOVB	ACCU, T6
+148a:	MOVB	T6, 0(ADDR)
+148d:	SUB	ACCU, T10
+148f:	LEAX	ADDR, T1 + ACCU
+1491:	MOVB	0(ADDR), T6
+1494:	ADDB	T5, #$0001
+1497:	MOVB	ACCU, T3
+1499:	CMPUB	ACCU, T5
+149b:	BLE	$1479
+149d:	JUMP	$1442
+149f:	MOVB	ACCU, T3
+14a1:	LEAX	ADDR, T1 + ACCU
+14a3:	MOV	ACCU, #69
+14a6:	MOVB	0(ADDR), ACCU
+14a9:	MOVB	ACCU, T3
+14ab:	ADDB	ACCU, #$0001
+14ae:	MOVB	T5, ACCU
+14b0:	MOV	ACCU, T0
+14b2:	BLT	$14C3
+14b4:	MOVB	ACCU, T5
+14b6:	LEAX	ADDR, T1 + ACCU
+14b8:	MOV	ACCU, #43
+14bb:	MOVB	0(ADDR), ACCU
+14be:	ADDB	T3, #$0002
+14c1:	JUMP	$14D5
+14c3:	MOVB	ACCU, T5
+14c5:	LEAX	ADDR, T1 + ACCU
+14c7:	MOV	ACCU, #45
+14ca:	MOVB	0(ADDR), ACCU
+14cd:	ADDB	T3, #$0002
+14d0:	MOV	ACCU, T0
+14d2:	NEG	ACCU
+14d3:	MOV	T0, ACCU
+14d5:	MOVB	ACCU, T3
+14d7:	ADD	ACCU, T1
+14d9:	MOV	T4, ACCU
+14db:	MOV	ACCU, T0
+14dd:	MOV	ADDR, #10
+14e0:	DIVS	ACCU, ADDR
+14e2:	MOV	ADDR, T4
+14e4:	MOV	T10, ACCU
+14e6:	ADD	T10, #$0030
+14ea:	MOVB	0(ADDR), T10
+14ed:	MOVB	ACCU, T3
+14ef:	ADDB	ACCU, #$0001
+14f2:	MOVB	ACCU, ACCU
+14f4:	ADD	ACCU, T1
+14f6:	MOV	T4, ACCU
+14f8:	MOV	ACCU, T0
+14fa:	MOV	ADDR, #10
+14fd:	MODS	ACCU, ADDR
+14ff:	MOV	ADDR, T4
+1501:	MOV	T0, ACCU
+1503:	ADD	T0, #$0030
+1507:	MOVB	0(ADDR), T0
+150a:	ADDB	T3, #$0002
+150d:	JUMPF	$142D
+1510:	MOVB	ACCU, T5
+1512:	CMPUB	ACCU, T6
+1514:	BNE	$1523
+1516:	MOVB	ACCU, T3
+1518:	LEAX	ADDR, T1 + ACCU
+151a:	MOV	ACCU, #46
+151d:	MOVB	0(ADDR), ACCU
+1520:	ADDB	T3, #$0001
+1523:	MOVD	ACCU, P4
+1525:	MOVD	T2, ACCU
+1527:	CNVFS	ACCU
+1528:	MOV	T10, ACCU
+152a:	CNVSF	ACCU
+152b:	MOVD	T9, ACCU
+152d:	MOVD	ACCU, T2
+152f:	SUBF	ACCU, T9
+1531:	MOVD	$03, #$41200000
+1537:	MULF	ACCU, $03
+1539:	MOVD	T2, ACCU
+153b:	MOVD	P4, ACCU
+153d:	MOVB	ACCU, T3
+153f:	LEAX	ADDR, T1 + ACCU
+1541:	ADD	T10, #$0030
+1545:	MOVB	0(ADDR), T10
+1548:	ADDB	T3, #$0001
+154b:	ADDB	T6, #$0001
+154e:	MOVB	ACCU, T4
+1550:	CMPUB	ACCU, T6
+1552:	BLT	$1510
+1554:	JUMPF	$1429
+1557:	MOVB	T6, #1
+155a:	MOVD	ACCU, T2
+155c:	MOVD	$03, #$41200000
+1562:	DIVF	ACCU, $03
+1564:	MOVD	T2, ACCU
+1566:	ADDB	T6, #$0001
+1569:	MOVB	ACCU, T4
+156b:	CMPUB	ACCU, T6
+156d:	BLT	$155A
+156f:	JUMPF	$13D7
+1572:	MOVD	T2, #$3f000000
+1578:	MOVB	ACCU, T5
+157a:	BNE	$15A4
+157c:	MOVD	ACCU, P4
+157e:	ADDF	ACCU, T2
+1580:	MOVD	T2, ACCU
+1582:	MOVD	P4, ACCU
+1584:	MOVD	ACCU, #$41200000
+158a:	CMPF	ACCU, T2
+158c:	BLTF	$13FA
+158f:	MOVD	ACCU, T2
+1591:	MOVD	$03, #$41200000
+1597:	DIVF	ACCU, $03
+1599:	MOVD	T2, ACCU
+159b:	MOVD	P4, ACCU
+159d:	ADD	T0, #$0001
+15a1:	JUMPF	$13FA
+15a4:	MOVB	T6, #0
+15a7:	MOVD	ACCU, T2
+15a9:	MOVD	$03, #$41200000
+15af:	DIVF	ACCU, $03
+15b1:	MOVD	T2, ACCU
+15b3:	ADDB	T6, #$0001
+15b6:	MOVB	ACCU, T5
+15b8:	CMPUB	ACCU, T6
+15ba:	BLT	$15A7
+15bc:	JUMP	$157C
+15be:	MOV	ACCU, T0
+15c0:	CMPS	ACCU, #$0003
+15c3:	BLT	$15CA
+15c5:	MOV	ACCU, T0
+15c7:	BGEF	$13A1
+15ca:	MOVB	T8, #1
+15cd:	JUMP	$1572
+15cf:	MOVD	ACCU, P4
+15d1:	MOVD	T2, #$447a0000
+15d7:	CMPF	ACCU, T2
+15d9:	BGT	$15F7
+15db:	MOVD	ACCU, P4
+15dd:	MOVD	$03, #$447a0000
+15e3:	DIVF	ACCU, $03
+15e5:	MOVD	T2, ACCU
+15e7:	MOVD	P4, ACCU
+15e9:	ADD	T0, #$0003
+15ed:	MOVD	ACCU, #$447a0000
+15f3:	CMPF	ACCU, T2
+15f5:	BGE	$15DB
+15f7:	MOVD	ACCU, P4
+15f9:	MOVD	T2, #$3f800000
+15ff:	CMPF	ACCU, T2
+1601:	BLE	$161F
+1603:	MOVD	ACCU, P4
+1605:	MOVD	$03, #$447a0000
+160b:	MULF	ACCU, $03
+160d:	MOVD	T2, ACCU
+160f:	MOVD	P4, ACCU
+1611:	ADD	T0, #$FFFD
+1615:	MOVD	ACCU, #$3f800000
+161b:	CMPF	ACCU, T2
+161d:	BLT	$1603
+161f:	MOVD	ACCU, P4
+1621:	MOVD	T2, #$41200000
+1627:	CMPF	ACCU, T2
+1629:	BGTF	$1387
+162c:	MOVD	ACCU, P4
+162e:	MOVD	$03, #$41200000
+1634:	DIVF	ACCU, $03
+1636:	MOVD	T2, ACCU
+1638:	MOVD	P4, ACCU
+163a:	ADD	T0, #$0001
+163e:	MOVD	ACCU, #$41200000
+1644:	CMPF	ACCU, T2
+1646:	BGE	$162C
+1648:	JUMPF	$1387
+164b:	MOV	ADDR, T0
+164d:	MOVD	ACCU, T2
+164f:	NEGF	ACCU
+1650:	MOVD	T2, ACCU
+1652:	MOVD	P4, ACCU
+1654:	MOV	ACCU, #45
+1657:	MOVB	0(ADDR), ACCU
+165a:	MOVB	T3, #1
+165d:	JUMPF	$1363
+--------------------------------------------------------------------
+rand:
+1665:	ENTER	0, 2
+1669:	MOV	T0, seed + 0
+166d:	MOV	ACCU, T0
+166f:	SHL	ACCU, #7
+1671:	XOR	ACCU, T0
+1673:	MOV	T0, ACCU
+1675:	SHRU	ACCU, #9
+1677:	XOR	ACCU, T0
+1679:	MOV	T0, ACCU
+167b:	SHL	ACCU, #8
+167d:	XOR	ACCU, T0
+167f:	MOV	T0, ACCU
+1681:	MOV	seed + 0, T0
+1685:	RETURN	0, 2
+--------------------------------------------------------------------
+qsort:
+1689:	ENTER	4, 20
+168d:	PUSH	#$0006
+1690:	MOV	T0, 18(FP)
+1693:	MOV	ACCU, T0
+1695:	CMPS	ACCU, #$0001
+1698:	BLT	$16A1
+169a:	POP	#$0006
+169d:	RETURN	4, 20
+16a1:	LEA	ADDR, 0(FP)
+16a5:	MOV	ACCU, 16(FP)
+16a8:	COPY	#12
+16aa:	MOV	T2, #0
+16ad:	MOV	ACCU, T0
+16af:	CMPS	ACCU, #$0001
+16b2:	BLT	$16EF
+16b4:	MOV	T0, 16(FP)
+16b7:	MOV	ACCU, T2
+16b9:	MUL	ACCU, #12
+16bc:	LEAX	ADDR, T0 + ACCU
+16be:	LEA	ACCU, 0(FP)
+16c2:	COPY	#12
+16c4:	MOV	2(SP), T0
+16c7:	MOV	4(SP), T2
+16ca:	CALL	qsort + 0
+16cd:	MOV	T0, 16(FP)
+16d0:	MOV	ACCU, T2
+16d2:	MUL	ACCU, #12
+16d5:	ADD	ACCU, T0
+16d7:	ADD	ACCU, #$000C
+16db:	MOV	2(SP), ACCU
+16de:	MOV	ACCU, 18(FP)
+16e1:	SUB	ACCU, T2
+16e3:	ADD	ACCU, #$FFFF
+16e7:	MOV	4(SP), ACCU
+16ea:	CALL	qsort + 0
+16ed:	JUMP	$169A
+16ef:	MOV	T0, #1
+16f2:	MOV	T3, 16(FP)
+16f5:	MOV	ACCU, T0
+16f7:	MUL	ACCU, #12
+16fa:	ADD	ACCU, T3
+16fc:	ADD	ACCU, #$0002
+1700:	MOV	P0, ACCU
+1702:	LEA	P2, 2(FP)
+1706:	JSR	strcmp + 0
+1709:	BGE	$1732
+170b:	MOV	T3, 16(FP)
+170e:	MOV	ACCU, T2
+1710:	MUL	ACCU, #12
+1713:	ADD	ACCU, T3
+1715:	MOV	T4, ACCU
+1717:	MOV	ACCU, T0
+1719:	MUL	ACCU, #12
+171c:	ADD	ACCU, T3
+171e:	MOV	T3, ACCU
+1720:	MOV	ADDR, T4
+1722:	COPY	#12
+1724:	MOV	ADDR, T3
+1726:	ADD	T4, #$000C
+172a:	MOV	ACCU, T4
+172c:	COPY	#12
+172e:	ADD	T2, #$0001
+1732:	MOV	T3, 18(FP)
+1735:	ADD	T0, #$0001
+1739:	MOV	ACCU, T3
+173b:	CMPS	ACCU, T0
+173d:	BLT	$16F2
+173f:	JUMPF	$16B4
+--------------------------------------------------------------------
+strcmp:
+1742 : ea __ __ NOP
+1743 : a0 00 __ LDY #$00
+1745 : 84 1c __ STY ACCU + 1
+1747 : b1 0d __ LDA (P0),y
+1749 : f0 16 __ BEQ $1761
+174b : d1 0f __ CMP (P2),y
+174d : d0 16 __ BNE $1765
+174f : c8 __ __ INY
+1750 : b1 0d __ LDA (P0),y
+1752 : f0 0d __ BEQ $1761
+1754 : d1 0f __ CMP (P2),y
+1756 : d0 0d __ BNE $1765
+1758 : c8 __ __ INY
+1759 : d0 ec __ BNE $1747
+175b : e6 0e __ INC P1
+175d : e6 10 __ INC P3
+175f : d0 e6 __ BNE $1747
+1761 : d1 0f __ CMP (P2),y
+1763 : f0 0a __ BEQ $176f
+1765 : b0 06 __ BCS $176d
+1767 : a9 ff __ LDA #$ff
+1769 : 85 1c __ STA ACCU + 1
+176b : 30 02 __ BMI $176f
+176d : a9 01 __ LDA #$01
+176f : 85 1b __ STA ACCU + 0
+1771 : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+1772:	ENTER	0, 2
+1776:	PUSH	#$0002
+1779:	MOVUB	ACCU, 2(FP)
+177c:	BNE	$1784
+177e:	MOV	P0, #-1
+1781:	CALL	exit + 0
+1784:	POP	#$0002
+1787:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+178b:	ENTER	0, 2
+178f:	JSR	$1796
+1792:	RETURN	0, 2
+--------------------------------------------------------------------
+1796 : a5 0d __ LDA P0
+1798 : 85 1b __ STA ACCU + 0
+179a : a5 0e __ LDA P1
+179c : 85 1c __ STA ACCU + 1
+179e : ae bd 23 LDX $23bd ; (spentry + 0)
+17a1 : 9a __ __ TXS
+17a2 : a9 4c __ LDA #$4c
+17a4 : 85 54 __ STA $54
+17a6 : a9 00 __ LDA #$00
+17a8 : 85 13 __ STA P6
+17aa : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+17ab : b1 19 __ LDA (IP + 0),y
+17ad : c8 __ __ INY
+17ae : aa __ __ TAX
+17af : b5 00 __ LDA $00,x
+17b1 : 85 03 __ STA $03
+17b3 : b5 01 __ LDA $01,x
+17b5 : 85 04 __ STA $04
+17b7 : b5 02 __ LDA $02,x
+17b9 : 85 05 __ STA $05
+17bb : b5 03 __ LDA $03,x
+17bd : 85 06 __ STA $06
+17bf : a5 05 __ LDA $05
+17c1 : 0a __ __ ASL
+17c2 : a5 06 __ LDA $06
+17c4 : 2a __ __ ROL
+17c5 : 85 08 __ STA $08
+17c7 : f0 06 __ BEQ $17cf
+17c9 : a5 05 __ LDA $05
+17cb : 09 80 __ ORA #$80
+17cd : 85 05 __ STA $05
+17cf : a5 1d __ LDA ACCU + 2
+17d1 : 0a __ __ ASL
+17d2 : a5 1e __ LDA ACCU + 3
+17d4 : 2a __ __ ROL
+17d5 : 85 07 __ STA $07
+17d7 : f0 06 __ BEQ $17df
+17d9 : a5 1d __ LDA ACCU + 2
+17db : 09 80 __ ORA #$80
+17dd : 85 1d __ STA ACCU + 2
+17df : 60 __ __ RTS
+17e0 : 06 1e __ ASL ACCU + 3
+17e2 : a5 07 __ LDA $07
+17e4 : 6a __ __ ROR
+17e5 : 85 1e __ STA ACCU + 3
+17e7 : b0 06 __ BCS $17ef
+17e9 : a5 1d __ LDA ACCU + 2
+17eb : 29 7f __ AND #$7f
+17ed : 85 1d __ STA ACCU + 2
+17ef : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+17f0 : 38 __ __ SEC
+17f1 : a5 07 __ LDA $07
+17f3 : e5 08 __ SBC $08
+17f5 : f0 38 __ BEQ $182f
+17f7 : aa __ __ TAX
+17f8 : b0 25 __ BCS $181f
+17fa : e0 e9 __ CPX #$e9
+17fc : b0 0e __ BCS $180c
+17fe : a5 08 __ LDA $08
+1800 : 85 07 __ STA $07
+1802 : a9 00 __ LDA #$00
+1804 : 85 1b __ STA ACCU + 0
+1806 : 85 1c __ STA ACCU + 1
+1808 : 85 1d __ STA ACCU + 2
+180a : f0 23 __ BEQ $182f
+180c : a5 1d __ LDA ACCU + 2
+180e : 4a __ __ LSR
+180f : 66 1c __ ROR ACCU + 1
+1811 : 66 1b __ ROR ACCU + 0
+1813 : e8 __ __ INX
+1814 : d0 f8 __ BNE $180e
+1816 : 85 1d __ STA ACCU + 2
+1818 : a5 08 __ LDA $08
+181a : 85 07 __ STA $07
+181c : 4c 2f 18 JMP $182f ; (faddsub + 63)
+181f : e0 18 __ CPX #$18
+1821 : b0 33 __ BCS $1856
+1823 : a5 05 __ LDA $05
+1825 : 4a __ __ LSR
+1826 : 66 04 __ ROR $04
+1828 : 66 03 __ ROR $03
+182a : ca __ __ DEX
+182b : d0 f8 __ BNE $1825
+182d : 85 05 __ STA $05
+182f : a5 1e __ LDA ACCU + 3
+1831 : 29 80 __ AND #$80
+1833 : 85 1e __ STA ACCU + 3
+1835 : 45 06 __ EOR $06
+1837 : 30 2d __ BMI $1866
+1839 : 18 __ __ CLC
+183a : a5 1b __ LDA ACCU + 0
+183c : 65 03 __ ADC $03
+183e : 85 1b __ STA ACCU + 0
+1840 : a5 1c __ LDA ACCU + 1
+1842 : 65 04 __ ADC $04
+1844 : 85 1c __ STA ACCU + 1
+1846 : a5 1d __ LDA ACCU + 2
+1848 : 65 05 __ ADC $05
+184a : 85 1d __ STA ACCU + 2
+184c : 90 08 __ BCC $1856
+184e : 66 1d __ ROR ACCU + 2
+1850 : 66 1c __ ROR ACCU + 1
+1852 : 66 1b __ ROR ACCU + 0
+1854 : e6 07 __ INC $07
+1856 : a5 07 __ LDA $07
+1858 : 4a __ __ LSR
+1859 : 05 1e __ ORA ACCU + 3
+185b : 85 1e __ STA ACCU + 3
+185d : b0 06 __ BCS $1865
+185f : a5 1d __ LDA ACCU + 2
+1861 : 29 7f __ AND #$7f
+1863 : 85 1d __ STA ACCU + 2
+1865 : 60 __ __ RTS
+1866 : 38 __ __ SEC
+1867 : a5 1b __ LDA ACCU + 0
+1869 : e5 03 __ SBC $03
+186b : 85 1b __ STA ACCU + 0
+186d : a5 1c __ LDA ACCU + 1
+186f : e5 04 __ SBC $04
+1871 : 85 1c __ STA ACCU + 1
+1873 : a5 1d __ LDA ACCU + 2
+1875 : e5 05 __ SBC $05
+1877 : 85 1d __ STA ACCU + 2
+1879 : b0 19 __ BCS $1894
+187b : 38 __ __ SEC
+187c : a9 00 __ LDA #$00
+187e : e5 1b __ SBC ACCU + 0
+1880 : 85 1b __ STA ACCU + 0
+1882 : a9 00 __ LDA #$00
+1884 : e5 1c __ SBC ACCU + 1
+1886 : 85 1c __ STA ACCU + 1
+1888 : a9 00 __ LDA #$00
+188a : e5 1d __ SBC ACCU + 2
+188c : 85 1d __ STA ACCU + 2
+188e : a5 1e __ LDA ACCU + 3
+1890 : 49 80 __ EOR #$80
+1892 : 85 1e __ STA ACCU + 3
+1894 : a5 1d __ LDA ACCU + 2
+1896 : 30 be __ BMI $1856
+1898 : 05 1c __ ORA ACCU + 1
+189a : 05 1b __ ORA ACCU + 0
+189c : f0 0f __ BEQ $18ad
+189e : c6 07 __ DEC $07
+18a0 : f0 0b __ BEQ $18ad
+18a2 : 06 1b __ ASL ACCU + 0
+18a4 : 26 1c __ ROL ACCU + 1
+18a6 : 26 1d __ ROL ACCU + 2
+18a8 : 10 f4 __ BPL $189e
+18aa : 4c 56 18 JMP $1856 ; (faddsub + 102)
+18ad : a9 00 __ LDA #$00
+18af : 85 1b __ STA ACCU + 0
+18b1 : 85 1c __ STA ACCU + 1
+18b3 : 85 1d __ STA ACCU + 2
+18b5 : 85 1e __ STA ACCU + 3
+18b7 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+18b8 : a5 1b __ LDA ACCU + 0
+18ba : 05 1c __ ORA ACCU + 1
+18bc : 05 1d __ ORA ACCU + 2
+18be : d0 03 __ BNE $18c3
+18c0 : 85 1e __ STA ACCU + 3
+18c2 : 60 __ __ RTS
+18c3 : a5 03 __ LDA $03
+18c5 : 05 04 __ ORA $04
+18c7 : 05 05 __ ORA $05
+18c9 : d0 09 __ BNE $18d4
+18cb : 85 1b __ STA ACCU + 0
+18cd : 85 1c __ STA ACCU + 1
+18cf : 85 1d __ STA ACCU + 2
+18d1 : 85 1e __ STA ACCU + 3
+18d3 : 60 __ __ RTS
+18d4 : a9 00 __ LDA #$00
+18d6 : 85 09 __ STA $09
+18d8 : 85 0a __ STA $0a
+18da : 85 0b __ STA $0b
+18dc : a4 1b __ LDY ACCU + 0
+18de : a5 03 __ LDA $03
+18e0 : d0 06 __ BNE $18e8
+18e2 : a5 04 __ LDA $04
+18e4 : f0 0a __ BEQ $18f0
+18e6 : d0 05 __ BNE $18ed
+18e8 : 20 28 19 JSR $1928 ; (fmul8 + 0)
+18eb : a5 04 __ LDA $04
+18ed : 20 28 19 JSR $1928 ; (fmul8 + 0)
+18f0 : a5 05 __ LDA $05
+18f2 : 20 28 19 JSR $1928 ; (fmul8 + 0)
+18f5 : 38 __ __ SEC
+18f6 : a5 0b __ LDA $0b
+18f8 : 30 06 __ BMI $1900
+18fa : 06 09 __ ASL $09
+18fc : 26 0a __ ROL $0a
+18fe : 2a __ __ ROL
+18ff : 18 __ __ CLC
+1900 : 29 7f __ AND #$7f
+1902 : 85 0b __ STA $0b
+1904 : a5 1e __ LDA ACCU + 3
+1906 : 45 06 __ EOR $06
+1908 : 29 80 __ AND #$80
+190a : 85 1e __ STA ACCU + 3
+190c : a5 07 __ LDA $07
+190e : e9 7e __ SBC #$7e
+1910 : 18 __ __ CLC
+1911 : 65 08 __ ADC $08
+1913 : 4a __ __ LSR
+1914 : 05 1e __ ORA ACCU + 3
+1916 : 85 1e __ STA ACCU + 3
+1918 : a9 00 __ LDA #$00
+191a : 6a __ __ ROR
+191b : 05 0b __ ORA $0b
+191d : 85 1d __ STA ACCU + 2
+191f : a5 0a __ LDA $0a
+1921 : 85 1c __ STA ACCU + 1
+1923 : a5 09 __ LDA $09
+1925 : 85 1b __ STA ACCU + 0
+1927 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1928 : 38 __ __ SEC
+1929 : 6a __ __ ROR
+192a : 90 1e __ BCC $194a
+192c : aa __ __ TAX
+192d : 18 __ __ CLC
+192e : 98 __ __ TYA
+192f : 65 09 __ ADC $09
+1931 : 85 09 __ STA $09
+1933 : a5 0a __ LDA $0a
+1935 : 65 1c __ ADC ACCU + 1
+1937 : 85 0a __ STA $0a
+1939 : a5 0b __ LDA $0b
+193b : 65 1d __ ADC ACCU + 2
+193d : 6a __ __ ROR
+193e : 85 0b __ STA $0b
+1940 : 8a __ __ TXA
+1941 : 66 0a __ ROR $0a
+1943 : 66 09 __ ROR $09
+1945 : 4a __ __ LSR
+1946 : f0 0d __ BEQ $1955
+1948 : b0 e2 __ BCS $192c
+194a : 66 0b __ ROR $0b
+194c : 66 0a __ ROR $0a
+194e : 66 09 __ ROR $09
+1950 : 4a __ __ LSR
+1951 : 90 f7 __ BCC $194a
+1953 : d0 d7 __ BNE $192c
+1955 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1956 : a5 1b __ LDA ACCU + 0
+1958 : 05 1c __ ORA ACCU + 1
+195a : 05 1d __ ORA ACCU + 2
+195c : d0 03 __ BNE $1961
+195e : 85 1e __ STA ACCU + 3
+1960 : 60 __ __ RTS
+1961 : a5 1e __ LDA ACCU + 3
+1963 : 45 06 __ EOR $06
+1965 : 29 80 __ AND #$80
+1967 : 85 1e __ STA ACCU + 3
+1969 : a9 00 __ LDA #$00
+196b : 85 09 __ STA $09
+196d : 85 0a __ STA $0a
+196f : 85 0b __ STA $0b
+1971 : a2 18 __ LDX #$18
+1973 : a5 1b __ LDA ACCU + 0
+1975 : c5 03 __ CMP $03
+1977 : a5 1c __ LDA ACCU + 1
+1979 : e5 04 __ SBC $04
+197b : a5 1d __ LDA ACCU + 2
+197d : e5 05 __ SBC $05
+197f : 90 13 __ BCC $1994
+1981 : a5 1b __ LDA ACCU + 0
+1983 : e5 03 __ SBC $03
+1985 : 85 1b __ STA ACCU + 0
+1987 : a5 1c __ LDA ACCU + 1
+1989 : e5 04 __ SBC $04
+198b : 85 1c __ STA ACCU + 1
+198d : a5 1d __ LDA ACCU + 2
+198f : e5 05 __ SBC $05
+1991 : 85 1d __ STA ACCU + 2
+1993 : 38 __ __ SEC
+1994 : 26 09 __ ROL $09
+1996 : 26 0a __ ROL $0a
+1998 : 26 0b __ ROL $0b
+199a : ca __ __ DEX
+199b : f0 0a __ BEQ $19a7
+199d : 06 1b __ ASL ACCU + 0
+199f : 26 1c __ ROL ACCU + 1
+19a1 : 26 1d __ ROL ACCU + 2
+19a3 : b0 dc __ BCS $1981
+19a5 : 90 cc __ BCC $1973
+19a7 : 38 __ __ SEC
+19a8 : a5 0b __ LDA $0b
+19aa : 30 06 __ BMI $19b2
+19ac : 06 09 __ ASL $09
+19ae : 26 0a __ ROL $0a
+19b0 : 2a __ __ ROL
+19b1 : 18 __ __ CLC
+19b2 : 29 7f __ AND #$7f
+19b4 : 85 0b __ STA $0b
+19b6 : a5 08 __ LDA $08
+19b8 : 49 7f __ EOR #$7f
+19ba : 65 07 __ ADC $07
+19bc : 38 __ __ SEC
+19bd : e9 01 __ SBC #$01
+19bf : 4a __ __ LSR
+19c0 : 05 1e __ ORA ACCU + 3
+19c2 : 85 1e __ STA ACCU + 3
+19c4 : a9 00 __ LDA #$00
+19c6 : 6a __ __ ROR
+19c7 : 05 0b __ ORA $0b
+19c9 : 85 1d __ STA ACCU + 2
+19cb : a5 0a __ LDA $0a
+19cd : 85 1c __ STA ACCU + 1
+19cf : a5 09 __ LDA $09
+19d1 : 85 1b __ STA ACCU + 0
+19d3 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+19d4 : 38 __ __ SEC
+19d5 : a9 00 __ LDA #$00
+19d7 : e5 1b __ SBC ACCU + 0
+19d9 : 85 1b __ STA ACCU + 0
+19db : a9 00 __ LDA #$00
+19dd : e5 1c __ SBC ACCU + 1
+19df : 85 1c __ STA ACCU + 1
+19e1 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+19e2 : 38 __ __ SEC
+19e3 : a9 00 __ LDA #$00
+19e5 : e5 03 __ SBC $03
+19e7 : 85 03 __ STA $03
+19e9 : a9 00 __ LDA #$00
+19eb : e5 04 __ SBC $04
+19ed : 85 04 __ STA $04
+19ef : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+19f0 : a5 1c __ LDA ACCU + 1
+19f2 : d0 31 __ BNE $1a25
+19f4 : a5 04 __ LDA $04
+19f6 : d0 1e __ BNE $1a16
+19f8 : 85 06 __ STA $06
+19fa : a2 04 __ LDX #$04
+19fc : 06 1b __ ASL ACCU + 0
+19fe : 2a __ __ ROL
+19ff : c5 03 __ CMP $03
+1a01 : 90 02 __ BCC $1a05
+1a03 : e5 03 __ SBC $03
+1a05 : 26 1b __ ROL ACCU + 0
+1a07 : 2a __ __ ROL
+1a08 : c5 03 __ CMP $03
+1a0a : 90 02 __ BCC $1a0e
+1a0c : e5 03 __ SBC $03
+1a0e : 26 1b __ ROL ACCU + 0
+1a10 : ca __ __ DEX
+1a11 : d0 eb __ BNE $19fe
+1a13 : 85 05 __ STA $05
+1a15 : 60 __ __ RTS
+1a16 : a5 1b __ LDA ACCU + 0
+1a18 : 85 05 __ STA $05
+1a1a : a5 1c __ LDA ACCU + 1
+1a1c : 85 06 __ STA $06
+1a1e : a9 00 __ LDA #$00
+1a20 : 85 1b __ STA ACCU + 0
+1a22 : 85 1c __ STA ACCU + 1
+1a24 : 60 __ __ RTS
+1a25 : a5 04 __ LDA $04
+1a27 : d0 1f __ BNE $1a48
+1a29 : a5 03 __ LDA $03
+1a2b : 30 1b __ BMI $1a48
+1a2d : a9 00 __ LDA #$00
+1a2f : 85 06 __ STA $06
+1a31 : a2 10 __ LDX #$10
+1a33 : 06 1b __ ASL ACCU + 0
+1a35 : 26 1c __ ROL ACCU + 1
+1a37 : 2a __ __ ROL
+1a38 : c5 03 __ CMP $03
+1a3a : 90 02 __ BCC $1a3e
+1a3c : e5 03 __ SBC $03
+1a3e : 26 1b __ ROL ACCU + 0
+1a40 : 26 1c __ ROL ACCU + 1
+1a42 : ca __ __ DEX
+1a43 : d0 f2 __ BNE $1a37
+1a45 : 85 05 __ STA $05
+1a47 : 60 __ __ RTS
+1a48 : a9 00 __ LDA #$00
+1a4a : 85 05 __ STA $05
+1a4c : 85 06 __ STA $06
+1a4e : 84 02 __ STY $02
+1a50 : a0 10 __ LDY #$10
+1a52 : 18 __ __ CLC
+1a53 : 26 1b __ ROL ACCU + 0
+1a55 : 26 1c __ ROL ACCU + 1
+1a57 : 26 05 __ ROL $05
+1a59 : 26 06 __ ROL $06
+1a5b : 38 __ __ SEC
+1a5c : a5 05 __ LDA $05
+1a5e : e5 03 __ SBC $03
+1a60 : aa __ __ TAX
+1a61 : a5 06 __ LDA $06
+1a63 : e5 04 __ SBC $04
+1a65 : 90 04 __ BCC $1a6b
+1a67 : 86 05 __ STX $05
+1a69 : 85 06 __ STA $06
+1a6b : 88 __ __ DEY
+1a6c : d0 e5 __ BNE $1a53
+1a6e : 26 1b __ ROL ACCU + 0
+1a70 : 26 1c __ ROL ACCU + 1
+1a72 : a4 02 __ LDY $02
+1a74 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1a75 : 20 cf 17 JSR $17cf ; (freg + 36)
+1a78 : a5 07 __ LDA $07
+1a7a : c9 7f __ CMP #$7f
+1a7c : b0 07 __ BCS $1a85
+1a7e : a9 00 __ LDA #$00
+1a80 : 85 1b __ STA ACCU + 0
+1a82 : 85 1c __ STA ACCU + 1
+1a84 : 60 __ __ RTS
+1a85 : 38 __ __ SEC
+1a86 : e9 8e __ SBC #$8e
+1a88 : 90 0a __ BCC $1a94
+1a8a : a9 ff __ LDA #$ff
+1a8c : 85 1b __ STA ACCU + 0
+1a8e : a9 7f __ LDA #$7f
+1a90 : 85 1c __ STA ACCU + 1
+1a92 : d0 08 __ BNE $1a9c
+1a94 : aa __ __ TAX
+1a95 : 46 1d __ LSR ACCU + 2
+1a97 : 66 1c __ ROR ACCU + 1
+1a99 : e8 __ __ INX
+1a9a : d0 f9 __ BNE $1a95
+1a9c : 24 1e __ BIT ACCU + 3
+1a9e : 10 0e __ BPL $1aae
+1aa0 : 38 __ __ SEC
+1aa1 : a9 00 __ LDA #$00
+1aa3 : e5 1c __ SBC ACCU + 1
+1aa5 : 85 1b __ STA ACCU + 0
+1aa7 : a9 00 __ LDA #$00
+1aa9 : e5 1d __ SBC ACCU + 2
+1aab : 85 1c __ STA ACCU + 1
+1aad : 60 __ __ RTS
+1aae : a5 1c __ LDA ACCU + 1
+1ab0 : 85 1b __ STA ACCU + 0
+1ab2 : a5 1d __ LDA ACCU + 2
+1ab4 : 85 1c __ STA ACCU + 1
+1ab6 : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1ab7 : 24 1c __ BIT ACCU + 1
+1ab9 : 30 03 __ BMI $1abe
+1abb : 4c d5 1a JMP $1ad5 ; (uint16_to_float + 0)
+1abe : 38 __ __ SEC
+1abf : a9 00 __ LDA #$00
+1ac1 : e5 1b __ SBC ACCU + 0
+1ac3 : 85 1b __ STA ACCU + 0
+1ac5 : a9 00 __ LDA #$00
+1ac7 : e5 1c __ SBC ACCU + 1
+1ac9 : 85 1c __ STA ACCU + 1
+1acb : 20 d5 1a JSR $1ad5 ; (uint16_to_float + 0)
+1ace : a5 1e __ LDA ACCU + 3
+1ad0 : 09 80 __ ORA #$80
+1ad2 : 85 1e __ STA ACCU + 3
+1ad4 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1ad5 : a5 1b __ LDA ACCU + 0
+1ad7 : 05 1c __ ORA ACCU + 1
+1ad9 : d0 05 __ BNE $1ae0
+1adb : 85 1d __ STA ACCU + 2
+1add : 85 1e __ STA ACCU + 3
+1adf : 60 __ __ RTS
+1ae0 : a2 8e __ LDX #$8e
+1ae2 : a5 1c __ LDA ACCU + 1
+1ae4 : 30 06 __ BMI $1aec
+1ae6 : ca __ __ DEX
+1ae7 : 06 1b __ ASL ACCU + 0
+1ae9 : 2a __ __ ROL
+1aea : 10 fa __ BPL $1ae6
+1aec : 29 7f __ AND #$7f
+1aee : 85 1d __ STA ACCU + 2
+1af0 : a5 1b __ LDA ACCU + 0
+1af2 : 85 1c __ STA ACCU + 1
+1af4 : 8a __ __ TXA
+1af5 : 4a __ __ LSR
+1af6 : 85 1e __ STA ACCU + 3
+1af8 : a9 00 __ LDA #$00
+1afa : 85 1b __ STA ACCU + 0
+1afc : 6a __ __ ROR
+1afd : 05 1d __ ORA ACCU + 2
+1aff : 85 1d __ STA ACCU + 2
+1b01 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1b02 : 38 __ __ SEC
+1b03 : a9 00 __ LDA #$00
+1b05 : e5 1b __ SBC ACCU + 0
+1b07 : 85 1b __ STA ACCU + 0
+1b09 : a9 00 __ LDA #$00
+1b0b : e5 1c __ SBC ACCU + 1
+1b0d : 85 1c __ STA ACCU + 1
+1b0f : a9 00 __ LDA #$00
+1b11 : e5 1d __ SBC ACCU + 2
+1b13 : 85 1d __ STA ACCU + 2
+1b15 : a9 00 __ LDA #$00
+1b17 : e5 1e __ SBC ACCU + 3
+1b19 : 85 1e __ STA ACCU + 3
+1b1b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1b1c : 84 02 __ STY $02
+1b1e : a9 00 __ LDA #$00
+1b20 : 85 07 __ STA $07
+1b22 : 85 08 __ STA $08
+1b24 : 85 09 __ STA $09
+1b26 : 85 0a __ STA $0a
+1b28 : a0 20 __ LDY #$20
+1b2a : 18 __ __ CLC
+1b2b : 26 1b __ ROL ACCU + 0
+1b2d : 26 1c __ ROL ACCU + 1
+1b2f : 26 1d __ ROL ACCU + 2
+1b31 : 26 1e __ ROL ACCU + 3
+1b33 : 26 07 __ ROL $07
+1b35 : 26 08 __ ROL $08
+1b37 : 26 09 __ ROL $09
+1b39 : 26 0a __ ROL $0a
+1b3b : a5 07 __ LDA $07
+1b3d : c5 03 __ CMP $03
+1b3f : a5 08 __ LDA $08
+1b41 : e5 04 __ SBC $04
+1b43 : a5 09 __ LDA $09
+1b45 : e5 05 __ SBC $05
+1b47 : a5 0a __ LDA $0a
+1b49 : e5 06 __ SBC $06
+1b4b : 90 18 __ BCC $1b65
+1b4d : a5 07 __ LDA $07
+1b4f : e5 03 __ SBC $03
+1b51 : 85 07 __ STA $07
+1b53 : a5 08 __ LDA $08
+1b55 : e5 04 __ SBC $04
+1b57 : 85 08 __ STA $08
+1b59 : a5 09 __ LDA $09
+1b5b : e5 05 __ SBC $05
+1b5d : 85 09 __ STA $09
+1b5f : a5 0a __ LDA $0a
+1b61 : e5 06 __ SBC $06
+1b63 : 85 0a __ STA $0a
+1b65 : 88 __ __ DEY
+1b66 : d0 c3 __ BNE $1b2b
+1b68 : 26 1b __ ROL ACCU + 0
+1b6a : 26 1c __ ROL ACCU + 1
+1b6c : 26 1d __ ROL ACCU + 2
+1b6e : 26 1e __ ROL ACCU + 3
+1b70 : a4 02 __ LDY $02
+1b72 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1b73 : a9 00 __ LDA #$00
+1b75 : 85 1d __ STA ACCU + 2
+1b77 : 85 1e __ STA ACCU + 3
+1b79 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1b7a : b5 00 __ LDA $00,x
+1b7c : 85 03 __ STA $03
+1b7e : b5 01 __ LDA $01,x
+1b80 : 85 04 __ STA $04
+1b82 : b5 02 __ LDA $02,x
+1b84 : 85 05 __ STA $05
+1b86 : b5 03 __ LDA $03,x
+1b88 : 85 06 __ STA $06
+1b8a : 20 1c 1b JSR $1b1c ; (divmod32 + 0)
+1b8d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1b8e : b5 00 __ LDA $00,x
+1b90 : 85 03 __ STA $03
+1b92 : b5 01 __ LDA $01,x
+1b94 : 85 04 __ STA $04
+1b96 : b5 02 __ LDA $02,x
+1b98 : 85 05 __ STA $05
+1b9a : b5 03 __ LDA $03,x
+1b9c : 85 06 __ STA $06
+1b9e : 20 1c 1b JSR $1b1c ; (divmod32 + 0)
+1ba1 : a5 07 __ LDA $07
+1ba3 : 85 1b __ STA ACCU + 0
+1ba5 : a5 08 __ LDA $08
+1ba7 : 85 1c __ STA ACCU + 1
+1ba9 : a5 09 __ LDA $09
+1bab : 85 1d __ STA ACCU + 2
+1bad : a5 0a __ LDA $0a
+1baf : 85 1e __ STA ACCU + 3
+1bb1 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1bb2 : b5 03 __ LDA $03,x
+1bb4 : c5 1e __ CMP ACCU + 3
+1bb6 : d0 20 __ BNE $1bd8
+1bb8 : b5 02 __ LDA $02,x
+1bba : c5 1d __ CMP ACCU + 2
+1bbc : d0 1a __ BNE $1bd8
+1bbe : b5 01 __ LDA $01,x
+1bc0 : c5 1c __ CMP ACCU + 1
+1bc2 : d0 14 __ BNE $1bd8
+1bc4 : b5 00 __ LDA $00,x
+1bc6 : c5 1b __ CMP ACCU + 0
+1bc8 : d0 0e __ BNE $1bd8
+1bca : a9 00 __ LDA #$00
+1bcc : 85 1b __ STA ACCU + 0
+1bce : 85 1c __ STA ACCU + 1
+1bd0 : 60 __ __ RTS
+1bd1 : a9 ff __ LDA #$ff
+1bd3 : 85 1b __ STA ACCU + 0
+1bd5 : 85 1c __ STA ACCU + 1
+1bd7 : 60 __ __ RTS
+1bd8 : 90 f7 __ BCC $1bd1
+1bda : a9 01 __ LDA #$01
+1bdc : 85 1b __ STA ACCU + 0
+1bde : a9 00 __ LDA #$00
+1be0 : 85 1c __ STA ACCU + 1
+1be2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1be3 : a5 1e __ LDA ACCU + 3
+1be5 : 49 80 __ EOR #$80
+1be7 : 85 1e __ STA ACCU + 3
+1be9 : b5 03 __ LDA $03,x
+1beb : 49 80 __ EOR #$80
+1bed : c5 1e __ CMP ACCU + 3
+1bef : d0 20 __ BNE $1c11
+1bf1 : b5 02 __ LDA $02,x
+1bf3 : c5 1d __ CMP ACCU + 2
+1bf5 : d0 1a __ BNE $1c11
+1bf7 : b5 01 __ LDA $01,x
+1bf9 : c5 1c __ CMP ACCU + 1
+1bfb : d0 14 __ BNE $1c11
+1bfd : b5 00 __ LDA $00,x
+1bff : c5 1b __ CMP ACCU + 0
+1c01 : d0 0e __ BNE $1c11
+1c03 : a9 00 __ LDA #$00
+1c05 : 85 1b __ STA ACCU + 0
+1c07 : 85 1c __ STA ACCU + 1
+1c09 : 60 __ __ RTS
+1c0a : a9 ff __ LDA #$ff
+1c0c : 85 1b __ STA ACCU + 0
+1c0e : 85 1c __ STA ACCU + 1
+1c10 : 60 __ __ RTS
+1c11 : 90 f7 __ BCC $1c0a
+1c13 : a9 01 __ LDA #$01
+1c15 : 85 1b __ STA ACCU + 0
+1c17 : a9 00 __ LDA #$00
+1c19 : 85 1c __ STA ACCU + 1
+1c1b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1c1c : a9 4c __ LDA #$4c
+1c1e : 85 54 __ STA $54
+1c20 : a9 00 __ LDA #$00
+1c22 : 85 13 __ STA P6
+1c24 : a9 19 __ LDA #$19
+1c26 : 85 16 __ STA P9
+1c28 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1c29 : b1 19 __ LDA (IP + 0),y
+1c2b : aa __ __ TAX
+1c2c : c8 __ __ INY
+1c2d : b1 19 __ LDA (IP + 0),y
+1c2f : 95 00 __ STA $00,x
+1c31 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1c34 : b1 19 __ LDA (IP + 0),y
+1c36 : aa __ __ TAX
+1c37 : c8 __ __ INY
+1c38 : b1 19 __ LDA (IP + 0),y
+1c3a : 95 00 __ STA $00,x
+1c3c : a9 00 __ LDA #$00
+1c3e : 95 01 __ STA $01,x
+1c40 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1c43 : b1 19 __ LDA (IP + 0),y
+1c45 : aa __ __ TAX
+1c46 : c8 __ __ INY
+1c47 : b1 19 __ LDA (IP + 0),y
+1c49 : 95 00 __ STA $00,x
+1c4b : a9 ff __ LDA #$ff
+1c4d : 95 01 __ STA $01,x
+1c4f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1c52 : b1 19 __ LDA (IP + 0),y
+1c54 : aa __ __ TAX
+1c55 : c8 __ __ INY
+1c56 : b1 19 __ LDA (IP + 0),y
+1c58 : 95 00 __ STA $00,x
+1c5a : c8 __ __ INY
+1c5b : b1 19 __ LDA (IP + 0),y
+1c5d : 95 01 __ STA $01,x
+1c5f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1c62 : b1 19 __ LDA (IP + 0),y
+1c64 : aa __ __ TAX
+1c65 : c8 __ __ INY
+1c66 : b1 19 __ LDA (IP + 0),y
+1c68 : 95 00 __ STA $00,x
+1c6a : c8 __ __ INY
+1c6b : b1 19 __ LDA (IP + 0),y
+1c6d : 95 01 __ STA $01,x
+1c6f : c8 __ __ INY
+1c70 : b1 19 __ LDA (IP + 0),y
+1c72 : 95 02 __ STA $02,x
+1c74 : c8 __ __ INY
+1c75 : b1 19 __ LDA (IP + 0),y
+1c77 : 95 03 __ STA $03,x
+1c79 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1c7c : b1 19 __ LDA (IP + 0),y
+1c7e : aa __ __ TAX
+1c7f : b5 00 __ LDA $00,x
+1c81 : 85 1b __ STA ACCU + 0
+1c83 : a9 00 __ LDA #$00
+1c85 : 85 1c __ STA ACCU + 1
+1c87 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1c8a : b1 19 __ LDA (IP + 0),y
+1c8c : aa __ __ TAX
+1c8d : a5 1b __ LDA ACCU + 0
+1c8f : 95 00 __ STA $00,x
+1c91 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1c94 : b1 19 __ LDA (IP + 0),y
+1c96 : aa __ __ TAX
+1c97 : b5 00 __ LDA $00,x
+1c99 : 85 1b __ STA ACCU + 0
+1c9b : b5 01 __ LDA $01,x
+1c9d : 85 1c __ STA ACCU + 1
+1c9f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1ca2 : b1 19 __ LDA (IP + 0),y
+1ca4 : aa __ __ TAX
+1ca5 : a5 1b __ LDA ACCU + 0
+1ca7 : 95 00 __ STA $00,x
+1ca9 : a5 1c __ LDA ACCU + 1
+1cab : 95 01 __ STA $01,x
+1cad : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1cb0 : b1 19 __ LDA (IP + 0),y
+1cb2 : aa __ __ TAX
+1cb3 : b5 00 __ LDA $00,x
+1cb5 : 85 1f __ STA ADDR + 0
+1cb7 : b5 01 __ LDA $01,x
+1cb9 : 85 20 __ STA ADDR + 1
+1cbb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1cbe : b1 19 __ LDA (IP + 0),y
+1cc0 : aa __ __ TAX
+1cc1 : b5 00 __ LDA $00,x
+1cc3 : 85 1b __ STA ACCU + 0
+1cc5 : b5 01 __ LDA $01,x
+1cc7 : 85 1c __ STA ACCU + 1
+1cc9 : b5 02 __ LDA $02,x
+1ccb : 85 1d __ STA ACCU + 2
+1ccd : b5 03 __ LDA $03,x
+1ccf : 85 1e __ STA ACCU + 3
+1cd1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1cd4 : b1 19 __ LDA (IP + 0),y
+1cd6 : aa __ __ TAX
+1cd7 : a5 1b __ LDA ACCU + 0
+1cd9 : 95 00 __ STA $00,x
+1cdb : a5 1c __ LDA ACCU + 1
+1cdd : 95 01 __ STA $01,x
+1cdf : a5 1d __ LDA ACCU + 2
+1ce1 : 95 02 __ STA $02,x
+1ce3 : a5 1e __ LDA ACCU + 3
+1ce5 : 95 03 __ STA $03,x
+1ce7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1cea : b1 19 __ LDA (IP + 0),y
+1cec : 85 1f __ STA ADDR + 0
+1cee : c8 __ __ INY
+1cef : b1 19 __ LDA (IP + 0),y
+1cf1 : 85 20 __ STA ADDR + 1
+1cf3 : c8 __ __ INY
+1cf4 : b1 19 __ LDA (IP + 0),y
+1cf6 : aa __ __ TAX
+1cf7 : 84 02 __ STY $02
+1cf9 : a0 00 __ LDY #$00
+1cfb : b1 1f __ LDA (ADDR + 0),y
+1cfd : 95 00 __ STA $00,x
+1cff : c8 __ __ INY
+1d00 : b1 1f __ LDA (ADDR + 0),y
+1d02 : 95 01 __ STA $01,x
+1d04 : a4 02 __ LDY $02
+1d06 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d09 : b1 19 __ LDA (IP + 0),y
+1d0b : aa __ __ TAX
+1d0c : c8 __ __ INY
+1d0d : b1 19 __ LDA (IP + 0),y
+1d0f : 84 02 __ STY $02
+1d11 : a8 __ __ TAY
+1d12 : 4c fb 1c JMP $1cfb ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1d15 : b1 19 __ LDA (IP + 0),y
+1d17 : 85 1f __ STA ADDR + 0
+1d19 : c8 __ __ INY
+1d1a : b1 19 __ LDA (IP + 0),y
+1d1c : 85 20 __ STA ADDR + 1
+1d1e : c8 __ __ INY
+1d1f : b1 19 __ LDA (IP + 0),y
+1d21 : aa __ __ TAX
+1d22 : 84 02 __ STY $02
+1d24 : a0 00 __ LDY #$00
+1d26 : b5 00 __ LDA $00,x
+1d28 : 91 1f __ STA (ADDR + 0),y
+1d2a : c8 __ __ INY
+1d2b : b5 01 __ LDA $01,x
+1d2d : 91 1f __ STA (ADDR + 0),y
+1d2f : a4 02 __ LDY $02
+1d31 : 4c 50 08 JMP $0850 ; (startup + 79)
+1d34 : b1 19 __ LDA (IP + 0),y
+1d36 : aa __ __ TAX
+1d37 : c8 __ __ INY
+1d38 : b1 19 __ LDA (IP + 0),y
+1d3a : 84 02 __ STY $02
+1d3c : a8 __ __ TAY
+1d3d : 4c 26 1d JMP $1d26 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1d40 : b1 19 __ LDA (IP + 0),y
+1d42 : aa __ __ TAX
+1d43 : c8 __ __ INY
+1d44 : b1 19 __ LDA (IP + 0),y
+1d46 : 95 00 __ STA $00,x
+1d48 : c8 __ __ INY
+1d49 : b1 19 __ LDA (IP + 0),y
+1d4b : 95 01 __ STA $01,x
+1d4d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1d50 : b1 19 __ LDA (IP + 0),y
+1d52 : aa __ __ TAX
+1d53 : 18 __ __ CLC
+1d54 : b5 00 __ LDA $00,x
+1d56 : 65 1b __ ADC ACCU + 0
+1d58 : 85 1f __ STA ADDR + 0
+1d5a : b5 01 __ LDA $01,x
+1d5c : 65 1c __ ADC ACCU + 1
+1d5e : 85 20 __ STA ADDR + 1
+1d60 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1d63 : b1 19 __ LDA (IP + 0),y
+1d65 : aa __ __ TAX
+1d66 : c8 __ __ INY
+1d67 : b1 19 __ LDA (IP + 0),y
+1d69 : 84 02 __ STY $02
+1d6b : a8 __ __ TAY
+1d6c : b1 25 __ LDA (FP + 0),y
+1d6e : 95 00 __ STA $00,x
+1d70 : a4 02 __ LDY $02
+1d72 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1d75 : b1 19 __ LDA (IP + 0),y
+1d77 : aa __ __ TAX
+1d78 : c8 __ __ INY
+1d79 : b1 19 __ LDA (IP + 0),y
+1d7b : 84 02 __ STY $02
+1d7d : a8 __ __ TAY
+1d7e : b1 25 __ LDA (FP + 0),y
+1d80 : 95 00 __ STA $00,x
+1d82 : a9 00 __ LDA #$00
+1d84 : 95 01 __ STA $01,x
+1d86 : a4 02 __ LDY $02
+1d88 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1d8b : b1 19 __ LDA (IP + 0),y
+1d8d : aa __ __ TAX
+1d8e : c8 __ __ INY
+1d8f : b1 19 __ LDA (IP + 0),y
+1d91 : 84 02 __ STY $02
+1d93 : a8 __ __ TAY
+1d94 : b1 25 __ LDA (FP + 0),y
+1d96 : 95 00 __ STA $00,x
+1d98 : c8 __ __ INY
+1d99 : b1 25 __ LDA (FP + 0),y
+1d9b : 95 01 __ STA $01,x
+1d9d : a4 02 __ LDY $02
+1d9f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1da2 : b1 19 __ LDA (IP + 0),y
+1da4 : aa __ __ TAX
+1da5 : c8 __ __ INY
+1da6 : b1 19 __ LDA (IP + 0),y
+1da8 : 84 02 __ STY $02
+1daa : a8 __ __ TAY
+1dab : b5 00 __ LDA $00,x
+1dad : 91 25 __ STA (FP + 0),y
+1daf : a4 02 __ LDY $02
+1db1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1db4 : b1 19 __ LDA (IP + 0),y
+1db6 : aa __ __ TAX
+1db7 : c8 __ __ INY
+1db8 : b1 19 __ LDA (IP + 0),y
+1dba : 84 02 __ STY $02
+1dbc : a8 __ __ TAY
+1dbd : b5 00 __ LDA $00,x
+1dbf : 91 25 __ STA (FP + 0),y
+1dc1 : c8 __ __ INY
+1dc2 : b5 01 __ LDA $01,x
+1dc4 : 91 25 __ STA (FP + 0),y
+1dc6 : a4 02 __ LDY $02
+1dc8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1dcb : b1 19 __ LDA (IP + 0),y
+1dcd : aa __ __ TAX
+1dce : c8 __ __ INY
+1dcf : 18 __ __ CLC
+1dd0 : b1 19 __ LDA (IP + 0),y
+1dd2 : 65 25 __ ADC FP + 0
+1dd4 : 95 00 __ STA $00,x
+1dd6 : c8 __ __ INY
+1dd7 : b1 19 __ LDA (IP + 0),y
+1dd9 : 65 26 __ ADC FP + 1
+1ddb : 95 01 __ STA $01,x
+1ddd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1de0 : b1 19 __ LDA (IP + 0),y
+1de2 : aa __ __ TAX
+1de3 : c8 __ __ INY
+1de4 : b1 19 __ LDA (IP + 0),y
+1de6 : 84 02 __ STY $02
+1de8 : a8 __ __ TAY
+1de9 : b5 00 __ LDA $00,x
+1deb : 91 23 __ STA (SP + 0),y
+1ded : a4 02 __ LDY $02
+1def : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1df2 : b1 19 __ LDA (IP + 0),y
+1df4 : aa __ __ TAX
+1df5 : c8 __ __ INY
+1df6 : b1 19 __ LDA (IP + 0),y
+1df8 : 84 02 __ STY $02
+1dfa : a8 __ __ TAY
+1dfb : b5 00 __ LDA $00,x
+1dfd : 91 23 __ STA (SP + 0),y
+1dff : c8 __ __ INY
+1e00 : b5 01 __ LDA $01,x
+1e02 : 91 23 __ STA (SP + 0),y
+1e04 : a4 02 __ LDY $02
+1e06 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1e09 : b1 19 __ LDA (IP + 0),y
+1e0b : 85 1f __ STA ADDR + 0
+1e0d : c8 __ __ INY
+1e0e : b1 19 __ LDA (IP + 0),y
+1e10 : 85 20 __ STA ADDR + 1
+1e12 : c8 __ __ INY
+1e13 : b1 19 __ LDA (IP + 0),y
+1e15 : aa __ __ TAX
+1e16 : 84 02 __ STY $02
+1e18 : a0 00 __ LDY #$00
+1e1a : b1 1f __ LDA (ADDR + 0),y
+1e1c : 95 00 __ STA $00,x
+1e1e : a4 02 __ LDY $02
+1e20 : 4c 50 08 JMP $0850 ; (startup + 79)
+1e23 : b1 19 __ LDA (IP + 0),y
+1e25 : aa __ __ TAX
+1e26 : c8 __ __ INY
+1e27 : b1 19 __ LDA (IP + 0),y
+1e29 : 84 02 __ STY $02
+1e2b : a8 __ __ TAY
+1e2c : 4c 1a 1e JMP $1e1a ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1e2f : b1 19 __ LDA (IP + 0),y
+1e31 : 85 1f __ STA ADDR + 0
+1e33 : c8 __ __ INY
+1e34 : b1 19 __ LDA (IP + 0),y
+1e36 : 85 20 __ STA ADDR + 1
+1e38 : c8 __ __ INY
+1e39 : b1 19 __ LDA (IP + 0),y
+1e3b : aa __ __ TAX
+1e3c : 84 02 __ STY $02
+1e3e : a0 00 __ LDY #$00
+1e40 : b1 1f __ LDA (ADDR + 0),y
+1e42 : 95 00 __ STA $00,x
+1e44 : a9 00 __ LDA #$00
+1e46 : 95 01 __ STA $01,x
+1e48 : a4 02 __ LDY $02
+1e4a : 4c 50 08 JMP $0850 ; (startup + 79)
+1e4d : b1 19 __ LDA (IP + 0),y
+1e4f : aa __ __ TAX
+1e50 : c8 __ __ INY
+1e51 : b1 19 __ LDA (IP + 0),y
+1e53 : 84 02 __ STY $02
+1e55 : a8 __ __ TAY
+1e56 : 4c 40 1e JMP $1e40 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1e59 : b1 19 __ LDA (IP + 0),y
+1e5b : 85 1f __ STA ADDR + 0
+1e5d : c8 __ __ INY
+1e5e : b1 19 __ LDA (IP + 0),y
+1e60 : 85 20 __ STA ADDR + 1
+1e62 : c8 __ __ INY
+1e63 : b1 19 __ LDA (IP + 0),y
+1e65 : aa __ __ TAX
+1e66 : 84 02 __ STY $02
+1e68 : a0 00 __ LDY #$00
+1e6a : b1 1f __ LDA (ADDR + 0),y
+1e6c : 95 00 __ STA $00,x
+1e6e : c8 __ __ INY
+1e6f : b1 1f __ LDA (ADDR + 0),y
+1e71 : 95 01 __ STA $01,x
+1e73 : c8 __ __ INY
+1e74 : b1 1f __ LDA (ADDR + 0),y
+1e76 : 95 02 __ STA $02,x
+1e78 : c8 __ __ INY
+1e79 : b1 1f __ LDA (ADDR + 0),y
+1e7b : 95 03 __ STA $03,x
+1e7d : a4 02 __ LDY $02
+1e7f : 4c 50 08 JMP $0850 ; (startup + 79)
+1e82 : b1 19 __ LDA (IP + 0),y
+1e84 : aa __ __ TAX
+1e85 : c8 __ __ INY
+1e86 : b1 19 __ LDA (IP + 0),y
+1e88 : 84 02 __ STY $02
+1e8a : a8 __ __ TAY
+1e8b : 4c 6a 1e JMP $1e6a ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1e8e : b1 19 __ LDA (IP + 0),y
+1e90 : 85 1f __ STA ADDR + 0
+1e92 : c8 __ __ INY
+1e93 : b1 19 __ LDA (IP + 0),y
+1e95 : 85 20 __ STA ADDR + 1
+1e97 : c8 __ __ INY
+1e98 : b1 19 __ LDA (IP + 0),y
+1e9a : aa __ __ TAX
+1e9b : 84 02 __ STY $02
+1e9d : a0 00 __ LDY #$00
+1e9f : b5 00 __ LDA $00,x
+1ea1 : 91 1f __ STA (ADDR + 0),y
+1ea3 : a4 02 __ LDY $02
+1ea5 : 4c 50 08 JMP $0850 ; (startup + 79)
+1ea8 : b1 19 __ LDA (IP + 0),y
+1eaa : aa __ __ TAX
+1eab : c8 __ __ INY
+1eac : b1 19 __ LDA (IP + 0),y
+1eae : 84 02 __ STY $02
+1eb0 : a8 __ __ TAY
+1eb1 : 4c 9f 1e JMP $1e9f ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1eb4 : b1 19 __ LDA (IP + 0),y
+1eb6 : aa __ __ TAX
+1eb7 : 18 __ __ CLC
+1eb8 : a5 1b __ LDA ACCU + 0
+1eba : 75 00 __ ADC $00,x
+1ebc : 85 1b __ STA ACCU + 0
+1ebe : a5 1c __ LDA ACCU + 1
+1ec0 : 75 01 __ ADC $01,x
+1ec2 : 85 1c __ STA ACCU + 1
+1ec4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1ec7 : b1 19 __ LDA (IP + 0),y
+1ec9 : aa __ __ TAX
+1eca : 38 __ __ SEC
+1ecb : a5 1b __ LDA ACCU + 0
+1ecd : f5 00 __ SBC $00,x
+1ecf : 85 1b __ STA ACCU + 0
+1ed1 : a5 1c __ LDA ACCU + 1
+1ed3 : f5 01 __ SBC $01,x
+1ed5 : 85 1c __ STA ACCU + 1
+1ed7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+1eda : b1 19 __ LDA (IP + 0),y
+1edc : aa __ __ TAX
+1edd : a5 1b __ LDA ACCU + 0
+1edf : 55 00 __ EOR $00,x
+1ee1 : 85 1b __ STA ACCU + 0
+1ee3 : a5 1c __ LDA ACCU + 1
+1ee5 : 55 01 __ EOR $01,x
+1ee7 : 85 1c __ STA ACCU + 1
+1ee9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1eec : b1 19 __ LDA (IP + 0),y
+1eee : aa __ __ TAX
+1eef : b5 00 __ LDA $00,x
+1ef1 : 85 03 __ STA $03
+1ef3 : b5 01 __ LDA $01,x
+1ef5 : 85 04 __ STA $04
+1ef7 : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1efa : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1efd : b1 19 __ LDA (IP + 0),y
+1eff : aa __ __ TAX
+1f00 : b5 00 __ LDA $00,x
+1f02 : 85 03 __ STA $03
+1f04 : b5 01 __ LDA $01,x
+1f06 : 85 04 __ STA $04
+1f08 : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1f0b : a5 05 __ LDA $05
+1f0d : 85 1b __ STA ACCU + 0
+1f0f : a5 06 __ LDA $06
+1f11 : 85 1c __ STA ACCU + 1
+1f13 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1f16 : b1 19 __ LDA (IP + 0),y
+1f18 : aa __ __ TAX
+1f19 : b5 00 __ LDA $00,x
+1f1b : 85 03 __ STA $03
+1f1d : b5 01 __ LDA $01,x
+1f1f : 85 04 __ STA $04
+1f21 : 24 1c __ BIT ACCU + 1
+1f23 : 10 10 __ BPL $1f35
+1f25 : 20 d4 19 JSR $19d4 ; (negaccu + 0)
+1f28 : 24 04 __ BIT $04
+1f2a : 10 10 __ BPL $1f3c
+1f2c : 20 e2 19 JSR $19e2 ; (negtmp + 0)
+1f2f : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1f32 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f35 : 24 04 __ BIT $04
+1f37 : 10 f6 __ BPL $1f2f
+1f39 : 20 e2 19 JSR $19e2 ; (negtmp + 0)
+1f3c : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1f3f : 20 d4 19 JSR $19d4 ; (negaccu + 0)
+1f42 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1f45 : b1 19 __ LDA (IP + 0),y
+1f47 : aa __ __ TAX
+1f48 : b5 00 __ LDA $00,x
+1f4a : 85 03 __ STA $03
+1f4c : b5 01 __ LDA $01,x
+1f4e : 85 04 __ STA $04
+1f50 : 24 1c __ BIT ACCU + 1
+1f52 : 10 18 __ BPL $1f6c
+1f54 : 20 d4 19 JSR $19d4 ; (negaccu + 0)
+1f57 : 24 04 __ BIT $04
+1f59 : 10 18 __ BPL $1f73
+1f5b : 20 e2 19 JSR $19e2 ; (negtmp + 0)
+1f5e : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1f61 : a5 05 __ LDA $05
+1f63 : 85 1b __ STA ACCU + 0
+1f65 : a5 06 __ LDA $06
+1f67 : 85 1c __ STA ACCU + 1
+1f69 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f6c : 24 04 __ BIT $04
+1f6e : 10 ee __ BPL $1f5e
+1f70 : 20 e2 19 JSR $19e2 ; (negtmp + 0)
+1f73 : 20 f0 19 JSR $19f0 ; (divmod + 0)
+1f76 : a5 05 __ LDA $05
+1f78 : 85 1b __ STA ACCU + 0
+1f7a : a5 06 __ LDA $06
+1f7c : 85 1c __ STA ACCU + 1
+1f7e : 20 d4 19 JSR $19d4 ; (negaccu + 0)
+1f81 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+1f84 : b1 19 __ LDA (IP + 0),y
+1f86 : aa __ __ TAX
+1f87 : 18 __ __ CLC
+1f88 : b5 00 __ LDA $00,x
+1f8a : 65 1b __ ADC ACCU + 0
+1f8c : 95 00 __ STA $00,x
+1f8e : b5 01 __ LDA $01,x
+1f90 : 65 1c __ ADC ACCU + 1
+1f92 : 95 01 __ STA $01,x
+1f94 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+1f97 : b1 19 __ LDA (IP + 0),y
+1f99 : c8 __ __ INY
+1f9a : aa __ __ TAX
+1f9b : 18 __ __ CLC
+1f9c : b5 00 __ LDA $00,x
+1f9e : 71 19 __ ADC (IP + 0),y
+1fa0 : c8 __ __ INY
+1fa1 : 95 00 __ STA $00,x
+1fa3 : b5 01 __ LDA $01,x
+1fa5 : 71 19 __ ADC (IP + 0),y
+1fa7 : 95 01 __ STA $01,x
+1fa9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+1fac : b1 19 __ LDA (IP + 0),y
+1fae : c8 __ __ INY
+1faf : aa __ __ TAX
+1fb0 : 38 __ __ SEC
+1fb1 : b1 19 __ LDA (IP + 0),y
+1fb3 : c8 __ __ INY
+1fb4 : f5 00 __ SBC $00,x
+1fb6 : 95 00 __ STA $00,x
+1fb8 : b1 19 __ LDA (IP + 0),y
+1fba : f5 01 __ SBC $01,x
+1fbc : 95 01 __ STA $01,x
+1fbe : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+1fc1 : b1 19 __ LDA (IP + 0),y
+1fc3 : c8 __ __ INY
+1fc4 : aa __ __ TAX
+1fc5 : b5 00 __ LDA $00,x
+1fc7 : 31 19 __ AND (IP + 0),y
+1fc9 : c8 __ __ INY
+1fca : 95 00 __ STA $00,x
+1fcc : b5 01 __ LDA $01,x
+1fce : 31 19 __ AND (IP + 0),y
+1fd0 : 95 01 __ STA $01,x
+1fd2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+1fd5 : b1 19 __ LDA (IP + 0),y
+1fd7 : c8 __ __ INY
+1fd8 : aa __ __ TAX
+1fd9 : a9 00 __ LDA #$00
+1fdb : 85 05 __ STA $05
+1fdd : 85 06 __ STA $06
+1fdf : b5 00 __ LDA $00,x
+1fe1 : 85 03 __ STA $03
+1fe3 : b5 01 __ LDA $01,x
+1fe5 : 85 04 __ STA $04
+1fe7 : b1 19 __ LDA (IP + 0),y
+1fe9 : 4a __ __ LSR
+1fea : 85 07 __ STA $07
+1fec : 90 0d __ BCC $1ffb
+1fee : 18 __ __ CLC
+1fef : a5 05 __ LDA $05
+1ff1 : 65 03 __ ADC $03
+1ff3 : 85 05 __ STA $05
+1ff5 : a5 06 __ LDA $06
+1ff7 : 65 04 __ ADC $04
+1ff9 : 85 06 __ STA $06
+1ffb : 06 03 __ ASL $03
+1ffd : 26 04 __ ROL $04
+1fff : 46 07 __ LSR $07
+2001 : b0 eb __ BCS $1fee
+2003 : d0 f6 __ BNE $1ffb
+2005 : a5 05 __ LDA $05
+2007 : 95 00 __ STA $00,x
+2009 : a5 06 __ LDA $06
+200b : 95 01 __ STA $01,x
+200d : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+2010 : b1 19 __ LDA (IP + 0),y
+2012 : c8 __ __ INY
+2013 : aa __ __ TAX
+2014 : 18 __ __ CLC
+2015 : b5 00 __ LDA $00,x
+2017 : 71 19 __ ADC (IP + 0),y
+2019 : 95 00 __ STA $00,x
+201b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+201e : b1 19 __ LDA (IP + 0),y
+2020 : aa __ __ TAX
+2021 : b5 00 __ LDA $00,x
+2023 : 2c b1 19 BIT $19b1 ; (fdiv + 91)
+2026 : 29 0f __ AND #$0f
+2028 : f0 0b __ BEQ $2035
+202a : aa __ __ TAX
+202b : a5 1c __ LDA ACCU + 1
+202d : 06 1b __ ASL ACCU + 0
+202f : 2a __ __ ROL
+2030 : ca __ __ DEX
+2031 : d0 fa __ BNE $202d
+2033 : 85 1c __ STA ACCU + 1
+2035 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+2038 : b1 19 __ LDA (IP + 0),y
+203a : aa __ __ TAX
+203b : b5 00 __ LDA $00,x
+203d : 2c b1 19 BIT $19b1 ; (fdiv + 91)
+2040 : 29 0f __ AND #$0f
+2042 : f0 0b __ BEQ $204f
+2044 : aa __ __ TAX
+2045 : a5 1c __ LDA ACCU + 1
+2047 : 4a __ __ LSR
+2048 : 66 1b __ ROR ACCU + 0
+204a : ca __ __ DEX
+204b : d0 fa __ BNE $2047
+204d : 85 1c __ STA ACCU + 1
+204f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+2052 : b1 19 __ LDA (IP + 0),y
+2054 : aa __ __ TAX
+2055 : 38 __ __ SEC
+2056 : b5 01 __ LDA $01,x
+2058 : e5 1c __ SBC ACCU + 1
+205a : f0 11 __ BEQ $206d
+205c : 50 02 __ BVC $2060
+205e : 49 80 __ EOR #$80
+2060 : 30 2a __ BMI $208c
+2062 : 10 33 __ BPL $2097
+2064 : b1 19 __ LDA (IP + 0),y
+2066 : aa __ __ TAX
+2067 : b5 01 __ LDA $01,x
+2069 : c5 1c __ CMP ACCU + 1
+206b : d0 28 __ BNE $2095
+206d : b5 00 __ LDA $00,x
+206f : c5 1b __ CMP ACCU + 0
+2071 : d0 22 __ BNE $2095
+2073 : f0 0e __ BEQ $2083
+2075 : b1 19 __ LDA (IP + 0),y
+2077 : aa __ __ TAX
+2078 : c8 __ __ INY
+2079 : b1 19 __ LDA (IP + 0),y
+207b : c5 1c __ CMP ACCU + 1
+207d : d0 16 __ BNE $2095
+207f : e4 1b __ CPX ACCU + 0
+2081 : d0 12 __ BNE $2095
+2083 : a9 00 __ LDA #$00
+2085 : 85 1b __ STA ACCU + 0
+2087 : 85 1c __ STA ACCU + 1
+2089 : 4c 50 08 JMP $0850 ; (startup + 79)
+208c : a9 ff __ LDA #$ff
+208e : 85 1b __ STA ACCU + 0
+2090 : 85 1c __ STA ACCU + 1
+2092 : 4c 50 08 JMP $0850 ; (startup + 79)
+2095 : 90 f5 __ BCC $208c
+2097 : a9 01 __ LDA #$01
+2099 : 85 1b __ STA ACCU + 0
+209b : a9 00 __ LDA #$00
+209d : 85 1c __ STA ACCU + 1
+209f : 4c 50 08 JMP $0850 ; (startup + 79)
+20a2 : b1 19 __ LDA (IP + 0),y
+20a4 : c8 __ __ INY
+20a5 : aa __ __ TAX
+20a6 : b1 19 __ LDA (IP + 0),y
+20a8 : 38 __ __ SEC
+20a9 : e5 1c __ SBC ACCU + 1
+20ab : d0 af __ BNE $205c
+20ad : e4 1b __ CPX ACCU + 0
+20af : d0 e4 __ BNE $2095
+20b1 : f0 d0 __ BEQ $2083
+20b3 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+20b4 : b1 19 __ LDA (IP + 0),y
+20b6 : aa __ __ TAX
+20b7 : 38 __ __ SEC
+20b8 : b5 00 __ LDA $00,x
+20ba : e5 1b __ SBC ACCU + 0
+20bc : f0 19 __ BEQ $20d7
+20be : 50 02 __ BVC $20c2
+20c0 : 49 80 __ EOR #$80
+20c2 : 30 1c __ BMI $20e0
+20c4 : 10 25 __ BPL $20eb
+20c6 : b1 19 __ LDA (IP + 0),y
+20c8 : aa __ __ TAX
+20c9 : b5 00 __ LDA $00,x
+20cb : c5 1b __ CMP ACCU + 0
+20cd : d0 1a __ BNE $20e9
+20cf : f0 06 __ BEQ $20d7
+20d1 : b1 19 __ LDA (IP + 0),y
+20d3 : c5 1b __ CMP ACCU + 0
+20d5 : d0 12 __ BNE $20e9
+20d7 : a9 00 __ LDA #$00
+20d9 : 85 1b __ STA ACCU + 0
+20db : 85 1c __ STA ACCU + 1
+20dd : 4c 50 08 JMP $0850 ; (startup + 79)
+20e0 : a9 ff __ LDA #$ff
+20e2 : 85 1b __ STA ACCU + 0
+20e4 : 85 1c __ STA ACCU + 1
+20e6 : 4c 50 08 JMP $0850 ; (startup + 79)
+20e9 : 90 f5 __ BCC $20e0
+20eb : a9 01 __ LDA #$01
+20ed : 85 1b __ STA ACCU + 0
+20ef : a9 00 __ LDA #$00
+20f1 : 85 1c __ STA ACCU + 1
+20f3 : 4c 50 08 JMP $0850 ; (startup + 79)
+20f6 : b1 19 __ LDA (IP + 0),y
+20f8 : 38 __ __ SEC
+20f9 : e5 1b __ SBC ACCU + 0
+20fb : d0 c1 __ BNE $20be
+20fd : f0 d8 __ BEQ $20d7
+20ff : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+2100 : 38 __ __ SEC
+2101 : a9 00 __ LDA #$00
+2103 : e5 1b __ SBC ACCU + 0
+2105 : 85 1b __ STA ACCU + 0
+2107 : a9 00 __ LDA #$00
+2109 : e5 1c __ SBC ACCU + 1
+210b : 85 1c __ STA ACCU + 1
+210d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+2110 : 20 ab 17 JSR $17ab ; (freg + 0)
+2113 : 20 f0 17 JSR $17f0 ; (faddsub + 0)
+2116 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+2119 : 20 ab 17 JSR $17ab ; (freg + 0)
+211c : a5 06 __ LDA $06
+211e : 49 80 __ EOR #$80
+2120 : 85 06 __ STA $06
+2122 : 20 f0 17 JSR $17f0 ; (faddsub + 0)
+2125 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+2128 : 20 ab 17 JSR $17ab ; (freg + 0)
+212b : 84 02 __ STY $02
+212d : 20 b8 18 JSR $18b8 ; (fmul + 0)
+2130 : a4 02 __ LDY $02
+2132 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+2135 : 20 ab 17 JSR $17ab ; (freg + 0)
+2138 : 20 56 19 JSR $1956 ; (fdiv + 0)
+213b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+213e : b1 19 __ LDA (IP + 0),y
+2140 : c8 __ __ INY
+2141 : aa __ __ TAX
+2142 : a5 1e __ LDA ACCU + 3
+2144 : 55 03 __ EOR $03,x
+2146 : 29 80 __ AND #$80
+2148 : f0 1e __ BEQ $2168
+214a : a5 1e __ LDA ACCU + 3
+214c : 29 7f __ AND #$7f
+214e : 05 1d __ ORA ACCU + 2
+2150 : 05 1c __ ORA ACCU + 1
+2152 : 05 1b __ ORA ACCU + 0
+2154 : d0 0c __ BNE $2162
+2156 : b5 03 __ LDA $03,x
+2158 : 29 7f __ AND #$7f
+215a : 15 02 __ ORA $02,x
+215c : 15 01 __ ORA $01,x
+215e : 15 00 __ ORA $00,x
+2160 : f0 1e __ BEQ $2180
+2162 : a5 1e __ LDA ACCU + 3
+2164 : 30 29 __ BMI $218f
+2166 : 10 36 __ BPL $219e
+2168 : a5 1e __ LDA ACCU + 3
+216a : d5 03 __ CMP $03,x
+216c : d0 1b __ BNE $2189
+216e : a5 1d __ LDA ACCU + 2
+2170 : d5 02 __ CMP $02,x
+2172 : d0 15 __ BNE $2189
+2174 : a5 1c __ LDA ACCU + 1
+2176 : d5 01 __ CMP $01,x
+2178 : d0 0f __ BNE $2189
+217a : a5 1b __ LDA ACCU + 0
+217c : d5 00 __ CMP $00,x
+217e : d0 09 __ BNE $2189
+2180 : a9 00 __ LDA #$00
+2182 : 85 1b __ STA ACCU + 0
+2184 : 85 1c __ STA ACCU + 1
+2186 : 4c 51 08 JMP $0851 ; (startup + 80)
+2189 : b0 0f __ BCS $219a
+218b : 24 1e __ BIT ACCU + 3
+218d : 30 0f __ BMI $219e
+218f : a9 00 __ LDA #$00
+2191 : 85 1c __ STA ACCU + 1
+2193 : a9 01 __ LDA #$01
+2195 : 85 1b __ STA ACCU + 0
+2197 : 4c 51 08 JMP $0851 ; (startup + 80)
+219a : 24 1e __ BIT ACCU + 3
+219c : 30 f1 __ BMI $218f
+219e : a9 ff __ LDA #$ff
+21a0 : 85 1b __ STA ACCU + 0
+21a2 : 85 1c __ STA ACCU + 1
+21a4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+21a7 : a5 1e __ LDA ACCU + 3
+21a9 : 49 80 __ EOR #$80
+21ab : 85 1e __ STA ACCU + 3
+21ad : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+21b0 : 20 b7 1a JSR $1ab7 ; (sint16_to_float + 0)
+21b3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+21b6 : 20 75 1a JSR $1a75 ; (f32_to_i16 + 0)
+21b9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+21bc : b1 19 __ LDA (IP + 0),y
+21be : 30 0c __ BMI $21cc
+21c0 : 38 __ __ SEC
+21c1 : 65 19 __ ADC IP + 0
+21c3 : 85 19 __ STA IP + 0
+21c5 : 90 02 __ BCC $21c9
+21c7 : e6 1a __ INC IP + 1
+21c9 : 4c 51 08 JMP $0851 ; (startup + 80)
+21cc : 38 __ __ SEC
+21cd : 65 19 __ ADC IP + 0
+21cf : 85 19 __ STA IP + 0
+21d1 : b0 02 __ BCS $21d5
+21d3 : c6 1a __ DEC IP + 1
+21d5 : 4c 51 08 JMP $0851 ; (startup + 80)
+21d8 : a5 1b __ LDA ACCU + 0
+21da : 05 1c __ ORA ACCU + 1
+21dc : f0 de __ BEQ $21bc
+21de : 4c 50 08 JMP $0850 ; (startup + 79)
+21e1 : a5 1b __ LDA ACCU + 0
+21e3 : 05 1c __ ORA ACCU + 1
+21e5 : d0 d5 __ BNE $21bc
+21e7 : 4c 50 08 JMP $0850 ; (startup + 79)
+21ea : a5 1c __ LDA ACCU + 1
+21ec : 30 04 __ BMI $21f2
+21ee : 05 1b __ ORA ACCU + 0
+21f0 : d0 ca __ BNE $21bc
+21f2 : 4c 50 08 JMP $0850 ; (startup + 79)
+21f5 : a5 1c __ LDA ACCU + 1
+21f7 : 10 c3 __ BPL $21bc
+21f9 : 4c 50 08 JMP $0850 ; (startup + 79)
+21fc : a5 1c __ LDA ACCU + 1
+21fe : 30 bc __ BMI $21bc
+2200 : 4c 50 08 JMP $0850 ; (startup + 79)
+2203 : a5 1c __ LDA ACCU + 1
+2205 : 30 b5 __ BMI $21bc
+2207 : 05 1b __ ORA ACCU + 0
+2209 : f0 b1 __ BEQ $21bc
+220b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+220e : 38 __ __ SEC
+220f : b1 19 __ LDA (IP + 0),y
+2211 : 65 19 __ ADC IP + 0
+2213 : aa __ __ TAX
+2214 : c8 __ __ INY
+2215 : b1 19 __ LDA (IP + 0),y
+2217 : 65 1a __ ADC IP + 1
+2219 : 85 1a __ STA IP + 1
+221b : 86 19 __ STX IP + 0
+221d : 4c 51 08 JMP $0851 ; (startup + 80)
+2220 : a5 1b __ LDA ACCU + 0
+2222 : 05 1c __ ORA ACCU + 1
+2224 : f0 e8 __ BEQ $220e
+2226 : c8 __ __ INY
+2227 : 4c 50 08 JMP $0850 ; (startup + 79)
+222a : a5 1b __ LDA ACCU + 0
+222c : 05 1c __ ORA ACCU + 1
+222e : d0 de __ BNE $220e
+2230 : c8 __ __ INY
+2231 : 4c 50 08 JMP $0850 ; (startup + 79)
+2234 : a5 1c __ LDA ACCU + 1
+2236 : 30 04 __ BMI $223c
+2238 : 05 1b __ ORA ACCU + 0
+223a : d0 d2 __ BNE $220e
+223c : c8 __ __ INY
+223d : 4c 50 08 JMP $0850 ; (startup + 79)
+2240 : a5 1c __ LDA ACCU + 1
+2242 : 10 ca __ BPL $220e
+2244 : c8 __ __ INY
+2245 : 4c 50 08 JMP $0850 ; (startup + 79)
+2248 : a5 1c __ LDA ACCU + 1
+224a : 30 c2 __ BMI $220e
+224c : c8 __ __ INY
+224d : 4c 50 08 JMP $0850 ; (startup + 79)
+2250 : a5 1c __ LDA ACCU + 1
+2252 : 30 ba __ BMI $220e
+2254 : 05 1b __ ORA ACCU + 0
+2256 : f0 b6 __ BEQ $220e
+2258 : c8 __ __ INY
+2259 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+225c : a9 00 __ LDA #$00
+225e : 2c a9 01 BIT $01a9 
+2261 : 85 1b __ STA ACCU + 0
+2263 : a9 00 __ LDA #$00
+2265 : 85 1c __ STA ACCU + 1
+2267 : 4c 51 08 JMP $0851 ; (startup + 80)
+226a : a5 1b __ LDA ACCU + 0
+226c : 05 1c __ ORA ACCU + 1
+226e : f0 ef __ BEQ $225f
+2270 : d0 ea __ BNE $225c
+2272 : a5 1b __ LDA ACCU + 0
+2274 : 05 1c __ ORA ACCU + 1
+2276 : d0 e7 __ BNE $225f
+2278 : f0 e2 __ BEQ $225c
+227a : a5 1c __ LDA ACCU + 1
+227c : 30 de __ BMI $225c
+227e : 05 1b __ ORA ACCU + 0
+2280 : d0 dd __ BNE $225f
+2282 : f0 d8 __ BEQ $225c
+2284 : a5 1c __ LDA ACCU + 1
+2286 : 10 d7 __ BPL $225f
+2288 : 30 d2 __ BMI $225c
+228a : a5 1c __ LDA ACCU + 1
+228c : 30 d1 __ BMI $225f
+228e : 10 cc __ BPL $225c
+2290 : a5 1c __ LDA ACCU + 1
+2292 : 30 cb __ BMI $225f
+2294 : 05 1b __ ORA ACCU + 0
+2296 : f0 c7 __ BEQ $225f
+2298 : d0 c2 __ BNE $225c
+229a : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+229b : b1 19 __ LDA (IP + 0),y
+229d : 8d b1 22 STA $22b1 ; (inp_jsr + 22)
+22a0 : c8 __ __ INY
+22a1 : b1 19 __ LDA (IP + 0),y
+22a3 : 8d b2 22 STA $22b2 ; (inp_jsr + 23)
+22a6 : 98 __ __ TYA
+22a7 : 38 __ __ SEC
+22a8 : 65 19 __ ADC IP + 0
+22aa : 85 19 __ STA IP + 0
+22ac : 90 02 __ BCC $22b0
+22ae : e6 1a __ INC IP + 1
+22b0 : 20 00 00 JSR $0000 
+22b3 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+22b6 : 98 __ __ TYA
+22b7 : 18 __ __ CLC
+22b8 : 65 19 __ ADC IP + 0
+22ba : 8d c5 22 STA $22c5 ; (inp_native + 15)
+22bd : a5 1a __ LDA IP + 1
+22bf : 69 00 __ ADC #$00
+22c1 : 8d c6 22 STA $22c6 ; (inp_native + 16)
+22c4 : 20 00 00 JSR $0000 
+22c7 : a0 00 __ LDY #$00
+22c9 : b1 23 __ LDA (SP + 0),y
+22cb : 85 19 __ STA IP + 0
+22cd : c8 __ __ INY
+22ce : b1 23 __ LDA (SP + 0),y
+22d0 : 85 1a __ STA IP + 1
+22d2 : 88 __ __ DEY
+22d3 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+22d6 : 38 __ __ SEC
+22d7 : a5 23 __ LDA SP + 0
+22d9 : f1 19 __ SBC (IP + 0),y
+22db : c8 __ __ INY
+22dc : 85 23 __ STA SP + 0
+22de : a5 24 __ LDA SP + 1
+22e0 : f1 19 __ SBC (IP + 0),y
+22e2 : c8 __ __ INY
+22e3 : 85 24 __ STA SP + 1
+22e5 : b1 19 __ LDA (IP + 0),y
+22e7 : 84 02 __ STY $02
+22e9 : a8 __ __ TAY
+22ea : a5 25 __ LDA FP + 0
+22ec : 91 23 __ STA (SP + 0),y
+22ee : c8 __ __ INY
+22ef : a5 26 __ LDA FP + 1
+22f1 : 91 23 __ STA (SP + 0),y
+22f3 : 98 __ __ TYA
+22f4 : 38 __ __ SEC
+22f5 : 65 23 __ ADC SP + 0
+22f7 : 85 25 __ STA FP + 0
+22f9 : a9 00 __ LDA #$00
+22fb : 65 24 __ ADC SP + 1
+22fd : 85 26 __ STA FP + 1
+22ff : 88 __ __ DEY
+2300 : f0 08 __ BEQ $230a
+2302 : b9 52 00 LDA $0052,y 
+2305 : 88 __ __ DEY
+2306 : 91 23 __ STA (SP + 0),y
+2308 : d0 f8 __ BNE $2302
+230a : a4 02 __ LDY $02
+230c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+230f : b1 19 __ LDA (IP + 0),y
+2311 : c8 __ __ INY
+2312 : 84 02 __ STY $02
+2314 : a8 __ __ TAY
+2315 : b1 23 __ LDA (SP + 0),y
+2317 : 85 25 __ STA FP + 0
+2319 : c8 __ __ INY
+231a : b1 23 __ LDA (SP + 0),y
+231c : 85 26 __ STA FP + 1
+231e : 88 __ __ DEY
+231f : f0 09 __ BEQ $232a
+2321 : 88 __ __ DEY
+2322 : b1 23 __ LDA (SP + 0),y
+2324 : 99 53 00 STA $0053,y 
+2327 : 88 __ __ DEY
+2328 : 10 f8 __ BPL $2322
+232a : a4 02 __ LDY $02
+232c : 18 __ __ CLC
+232d : b1 19 __ LDA (IP + 0),y
+232f : c8 __ __ INY
+2330 : 65 23 __ ADC SP + 0
+2332 : 85 23 __ STA SP + 0
+2334 : b1 19 __ LDA (IP + 0),y
+2336 : c8 __ __ INY
+2337 : 65 24 __ ADC SP + 1
+2339 : 85 24 __ STA SP + 1
+233b : a0 01 __ LDY #$01
+233d : b1 23 __ LDA (SP + 0),y
+233f : 85 1a __ STA IP + 1
+2341 : 88 __ __ DEY
+2342 : b1 23 __ LDA (SP + 0),y
+2344 : 85 19 __ STA IP + 0
+2346 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+2349 : b1 19 __ LDA (IP + 0),y
+234b : 85 1f __ STA ADDR + 0
+234d : c8 __ __ INY
+234e : b1 19 __ LDA (IP + 0),y
+2350 : 85 20 __ STA ADDR + 1
+2352 : c8 __ __ INY
+2353 : 98 __ __ TYA
+2354 : a0 00 __ LDY #$00
+2356 : 18 __ __ CLC
+2357 : 65 19 __ ADC IP + 0
+2359 : 91 23 __ STA (SP + 0),y
+235b : c8 __ __ INY
+235c : a5 1a __ LDA IP + 1
+235e : 69 00 __ ADC #$00
+2360 : 91 23 __ STA (SP + 0),y
+2362 : a5 1f __ LDA ADDR + 0
+2364 : 85 19 __ STA IP + 0
+2366 : a5 20 __ LDA ADDR + 1
+2368 : 85 1a __ STA IP + 1
+236a : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+236d : 38 __ __ SEC
+236e : a5 23 __ LDA SP + 0
+2370 : f1 19 __ SBC (IP + 0),y
+2372 : c8 __ __ INY
+2373 : 85 23 __ STA SP + 0
+2375 : a5 24 __ LDA SP + 1
+2377 : f1 19 __ SBC (IP + 0),y
+2379 : 85 24 __ STA SP + 1
+237b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+237e : 18 __ __ CLC
+237f : b1 19 __ LDA (IP + 0),y
+2381 : c8 __ __ INY
+2382 : 65 23 __ ADC SP + 0
+2384 : 85 23 __ STA SP + 0
+2386 : b1 19 __ LDA (IP + 0),y
+2388 : 65 24 __ ADC SP + 1
+238a : 85 24 __ STA SP + 1
+238c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+238f : b1 19 __ LDA (IP + 0),y
+2391 : 84 02 __ STY $02
+2393 : a8 __ __ TAY
+2394 : 88 __ __ DEY
+2395 : f0 07 __ BEQ $239e
+2397 : b1 1b __ LDA (ACCU + 0),y
+2399 : 91 1f __ STA (ADDR + 0),y
+239b : 88 __ __ DEY
+239c : d0 f9 __ BNE $2397
+239e : b1 1b __ LDA (ACCU + 0),y
+23a0 : 91 1f __ STA (ADDR + 0),y
+23a2 : a4 02 __ LDY $02
+23a4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+23a7 : b1 19 __ LDA (IP + 0),y
+23a9 : c8 __ __ INY
+23aa : 8d b8 23 STA $23b8 ; (inp_op_extrt + 17)
+23ad : b1 19 __ LDA (IP + 0),y
+23af : c8 __ __ INY
+23b0 : 8d b9 23 STA $23b9 ; (inp_op_extrt + 18)
+23b3 : b1 19 __ LDA (IP + 0),y
+23b5 : c8 __ __ INY
+23b6 : aa __ __ TAX
+23b7 : 20 00 00 JSR $0000 
+23ba : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,3513 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e e3 22 STX $22e3 ; (spentry + 0)
+0811 : a9 e6 __ LDA #$e6
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 51 __ LDA #$51
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 c6 __ LDA #$c6
+0832 : e9 e6 __ SBC #$e6
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 90 1e JMP $1e90 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 14 __ SBC #$14
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 03 __ LDY #$03
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : 38 __ __ SEC
+0918 : a5 23 __ LDA SP + 0
+091a : e9 08 __ SBC #$08
+091c : 85 23 __ STA SP + 0
+091e : a5 24 __ LDA SP + 1
+0920 : e9 00 __ SBC #$00
+0922 : 85 24 __ STA SP + 1
+0924 : a9 00 __ LDA #$00
+0926 : 85 53 __ STA T2 + 0
+0928 : 85 54 __ STA T2 + 1
+092a : a5 53 __ LDA T2 + 0
+092c : 0a __ __ ASL
+092d : aa __ __ TAX
+092e : a5 54 __ LDA T2 + 1
+0930 : 2a __ __ ROL
+0931 : a8 __ __ TAY
+0932 : 18 __ __ CLC
+0933 : 8a __ __ TXA
+0934 : 65 53 __ ADC T2 + 0
+0936 : 85 1b __ STA ACCU + 0
+0938 : 98 __ __ TYA
+0939 : 65 54 __ ADC T2 + 1
+093b : 06 1b __ ASL ACCU + 0
+093d : 2a __ __ ROL
+093e : 06 1b __ ASL ACCU + 0
+0940 : 2a __ __ ROL
+0941 : 85 1c __ STA ACCU + 1
+0943 : 18 __ __ CLC
+0944 : a9 e6 __ LDA #$e6
+0946 : 65 1b __ ADC ACCU + 0
+0948 : 85 43 __ STA T4 + 0
+094a : a9 22 __ LDA #$22
+094c : 65 1c __ ADC ACCU + 1
+094e : 85 44 __ STA T4 + 1
+0950 : a5 53 __ LDA T2 + 0
+0952 : a0 00 __ LDY #$00
+0954 : 91 43 __ STA (T4 + 0),y
+0956 : a5 54 __ LDA T2 + 1
+0958 : c8 __ __ INY
+0959 : 91 43 __ STA (T4 + 0),y
+095b : 18 __ __ CLC
+095c : a5 43 __ LDA T4 + 0
+095e : 69 02 __ ADC #$02
+0960 : c8 __ __ INY
+0961 : 91 23 __ STA (SP + 0),y
+0963 : a5 44 __ LDA T4 + 1
+0965 : 69 00 __ ADC #$00
+0967 : c8 __ __ INY
+0968 : 91 23 __ STA (SP + 0),y
+096a : a9 ba __ LDA #$ba
+096c : c8 __ __ INY
+096d : 91 23 __ STA (SP + 0),y
+096f : a9 1b __ LDA #$1b
+0971 : c8 __ __ INY
+0972 : 91 23 __ STA (SP + 0),y
+0974 : a5 53 __ LDA T2 + 0
+0976 : c8 __ __ INY
+0977 : 91 23 __ STA (SP + 0),y
+0979 : a5 54 __ LDA T2 + 1
+097b : c8 __ __ INY
+097c : 91 23 __ STA (SP + 0),y
+097e : 20 e8 0a JSR $0ae8 ; (sprintf + 0)
+0981 : e6 53 __ INC T2 + 0
+0983 : d0 02 __ BNE $0987
+0985 : e6 54 __ INC T2 + 1
+0987 : a5 54 __ LDA T2 + 1
+0989 : 49 80 __ EOR #$80
+098b : c9 83 __ CMP #$83
+098d : d0 04 __ BNE $0993
+098f : a5 53 __ LDA T2 + 0
+0991 : c9 e8 __ CMP #$e8
+0993 : 90 95 __ BCC $092a
+0995 : a9 00 __ LDA #$00
+0997 : 85 53 __ STA T2 + 0
+0999 : 85 54 __ STA T2 + 1
+099b : 18 __ __ CLC
+099c : a5 23 __ LDA SP + 0
+099e : 69 10 __ ADC #$10
+09a0 : 85 55 __ STA T3 + 0
+09a2 : a5 24 __ LDA SP + 1
+09a4 : 69 00 __ ADC #$00
+09a6 : 85 56 __ STA T3 + 1
+09a8 : 20 bf 1b JSR $1bbf ; (rand + 0)
+09ab : a5 1b __ LDA ACCU + 0
+09ad : 85 43 __ STA T4 + 0
+09af : a5 1c __ LDA ACCU + 1
+09b1 : 85 44 __ STA T4 + 1
+09b3 : a5 53 __ LDA T2 + 0
+09b5 : 0a __ __ ASL
+09b6 : aa __ __ TAX
+09b7 : a5 54 __ LDA T2 + 1
+09b9 : 2a __ __ ROL
+09ba : a8 __ __ TAY
+09bb : 18 __ __ CLC
+09bc : 8a __ __ TXA
+09bd : 65 53 __ ADC T2 + 0
+09bf : 85 1b __ STA ACCU + 0
+09c1 : 98 __ __ TYA
+09c2 : 65 54 __ ADC T2 + 1
+09c4 : 06 1b __ ASL ACCU + 0
+09c6 : 2a __ __ ROL
+09c7 : 06 1b __ ASL ACCU + 0
+09c9 : 2a __ __ ROL
+09ca : 85 1c __ STA ACCU + 1
+09cc : 18 __ __ CLC
+09cd : a9 e6 __ LDA #$e6
+09cf : 65 1b __ ADC ACCU + 0
+09d1 : 85 46 __ STA T6 + 0
+09d3 : a9 22 __ LDA #$22
+09d5 : 65 1c __ ADC ACCU + 1
+09d7 : 85 47 __ STA T6 + 1
+09d9 : a0 0b __ LDY #$0b
+09db : b1 46 __ LDA (T6 + 0),y
+09dd : 91 55 __ STA (T3 + 0),y
+09df : 88 __ __ DEY
+09e0 : 10 f9 __ BPL $09db
+09e2 : a5 43 __ LDA T4 + 0
+09e4 : 85 1b __ STA ACCU + 0
+09e6 : a5 44 __ LDA T4 + 1
+09e8 : 85 1c __ STA ACCU + 1
+09ea : a9 e8 __ LDA #$e8
+09ec : 85 03 __ STA $03
+09ee : a9 03 __ LDA #$03
+09f0 : 85 04 __ STA $04
+09f2 : 20 00 21 JSR $2100 ; (divmod + 0)
+09f5 : a5 05 __ LDA $05
+09f7 : 0a __ __ ASL
+09f8 : aa __ __ TAX
+09f9 : a5 06 __ LDA $06
+09fb : 2a __ __ ROL
+09fc : a8 __ __ TAY
+09fd : 18 __ __ CLC
+09fe : 8a __ __ TXA
+09ff : 65 05 __ ADC $05
+0a01 : 85 1b __ STA ACCU + 0
+0a03 : 98 __ __ TYA
+0a04 : 65 06 __ ADC $06
+0a06 : 06 1b __ ASL ACCU + 0
+0a08 : 2a __ __ ROL
+0a09 : 06 1b __ ASL ACCU + 0
+0a0b : 2a __ __ ROL
+0a0c : 85 1c __ STA ACCU + 1
+0a0e : 18 __ __ CLC
+0a0f : a9 e6 __ LDA #$e6
+0a11 : 65 1b __ ADC ACCU + 0
+0a13 : 85 43 __ STA T4 + 0
+0a15 : a9 22 __ LDA #$22
+0a17 : 65 1c __ ADC ACCU + 1
+0a19 : 85 44 __ STA T4 + 1
+0a1b : a0 0b __ LDY #$0b
+0a1d : b1 43 __ LDA (T4 + 0),y
+0a1f : 91 46 __ STA (T6 + 0),y
+0a21 : 88 __ __ DEY
+0a22 : 10 f9 __ BPL $0a1d
+0a24 : a0 0b __ LDY #$0b
+0a26 : b1 55 __ LDA (T3 + 0),y
+0a28 : 91 43 __ STA (T4 + 0),y
+0a2a : 88 __ __ DEY
+0a2b : 10 f9 __ BPL $0a26
+0a2d : e6 53 __ INC T2 + 0
+0a2f : d0 02 __ BNE $0a33
+0a31 : e6 54 __ INC T2 + 1
+0a33 : a5 54 __ LDA T2 + 1
+0a35 : 49 80 __ EOR #$80
+0a37 : c9 83 __ CMP #$83
+0a39 : d0 04 __ BNE $0a3f
+0a3b : a5 53 __ LDA T2 + 0
+0a3d : c9 e8 __ CMP #$e8
+0a3f : b0 03 __ BCS $0a44
+0a41 : 4c a8 09 JMP $09a8 ; (main + 168)
+0a44 : a9 e6 __ LDA #$e6
+0a46 : a0 02 __ LDY #$02
+0a48 : 91 23 __ STA (SP + 0),y
+0a4a : a9 22 __ LDA #$22
+0a4c : c8 __ __ INY
+0a4d : 91 23 __ STA (SP + 0),y
+0a4f : a9 e8 __ LDA #$e8
+0a51 : c8 __ __ INY
+0a52 : 91 23 __ STA (SP + 0),y
+0a54 : a9 03 __ LDA #$03
+0a56 : c8 __ __ INY
+0a57 : 91 23 __ STA (SP + 0),y
+0a59 : 20 e9 1b JSR $1be9 ; (qsort + 0)
+0a5c : a9 00 __ LDA #$00
+0a5e : 85 53 __ STA T2 + 0
+0a60 : 85 54 __ STA T2 + 1
+0a62 : a5 53 __ LDA T2 + 0
+0a64 : 0a __ __ ASL
+0a65 : aa __ __ TAX
+0a66 : a5 54 __ LDA T2 + 1
+0a68 : 2a __ __ ROL
+0a69 : a8 __ __ TAY
+0a6a : 18 __ __ CLC
+0a6b : 8a __ __ TXA
+0a6c : 65 53 __ ADC T2 + 0
+0a6e : 85 1b __ STA ACCU + 0
+0a70 : 98 __ __ TYA
+0a71 : 65 54 __ ADC T2 + 1
+0a73 : 06 1b __ ASL ACCU + 0
+0a75 : 2a __ __ ROL
+0a76 : 06 1b __ ASL ACCU + 0
+0a78 : 2a __ __ ROL
+0a79 : 85 1c __ STA ACCU + 1
+0a7b : 18 __ __ CLC
+0a7c : a9 e6 __ LDA #$e6
+0a7e : 65 1b __ ADC ACCU + 0
+0a80 : 85 55 __ STA T3 + 0
+0a82 : a9 22 __ LDA #$22
+0a84 : 65 1c __ ADC ACCU + 1
+0a86 : 85 56 __ STA T3 + 1
+0a88 : a0 00 __ LDY #$00
+0a8a : b1 55 __ LDA (T3 + 0),y
+0a8c : 85 02 __ STA $02
+0a8e : c8 __ __ INY
+0a8f : b1 55 __ LDA (T3 + 0),y
+0a91 : c5 54 __ CMP T2 + 1
+0a93 : d0 06 __ BNE $0a9b
+0a95 : a5 02 __ LDA $02
+0a97 : c5 53 __ CMP T2 + 0
+0a99 : f0 48 __ BEQ $0ae3
+0a9b : a9 00 __ LDA #$00
+0a9d : a0 02 __ LDY #$02
+0a9f : 91 23 __ STA (SP + 0),y
+0aa1 : 20 6b 1e JSR $1e6b ; (assert + 0)
+0aa4 : e6 53 __ INC T2 + 0
+0aa6 : d0 02 __ BNE $0aaa
+0aa8 : e6 54 __ INC T2 + 1
+0aaa : a5 54 __ LDA T2 + 1
+0aac : 49 80 __ EOR #$80
+0aae : c9 83 __ CMP #$83
+0ab0 : d0 04 __ BNE $0ab6
+0ab2 : a5 53 __ LDA T2 + 0
+0ab4 : c9 e8 __ CMP #$e8
+0ab6 : 90 aa __ BCC $0a62
+0ab8 : a9 00 __ LDA #$00
+0aba : 85 1b __ STA ACCU + 0
+0abc : 85 1c __ STA ACCU + 1
+0abe : 18 __ __ CLC
+0abf : a5 23 __ LDA SP + 0
+0ac1 : 69 08 __ ADC #$08
+0ac3 : 85 23 __ STA SP + 0
+0ac5 : a5 24 __ LDA SP + 1
+0ac7 : 69 00 __ ADC #$00
+0ac9 : 85 24 __ STA SP + 1
+0acb : a0 03 __ LDY #$03
+0acd : b1 23 __ LDA (SP + 0),y
+0acf : 99 53 00 STA $0053,y 
+0ad2 : 88 __ __ DEY
+0ad3 : 10 f8 __ BPL $0acd
+0ad5 : 18 __ __ CLC
+0ad6 : a5 23 __ LDA SP + 0
+0ad8 : 69 14 __ ADC #$14
+0ada : 85 23 __ STA SP + 0
+0adc : a5 24 __ LDA SP + 1
+0ade : 69 00 __ ADC #$00
+0ae0 : 85 24 __ STA SP + 1
+0ae2 : 60 __ __ RTS
+0ae3 : a9 01 __ LDA #$01
+0ae5 : 4c 9d 0a JMP $0a9d ; (main + 413)
+--------------------------------------------------------------------
+sprintf:
+0ae8 : 38 __ __ SEC
+0ae9 : a5 23 __ LDA SP + 0
+0aeb : e9 11 __ SBC #$11
+0aed : 85 23 __ STA SP + 0
+0aef : a5 24 __ LDA SP + 1
+0af1 : e9 00 __ SBC #$00
+0af3 : 85 24 __ STA SP + 1
+0af5 : a0 07 __ LDY #$07
+0af7 : b9 53 00 LDA $0053,y 
+0afa : 91 23 __ STA (SP + 0),y
+0afc : 88 __ __ DEY
+0afd : 10 f8 __ BPL $0af7
+0aff : a9 00 __ LDA #$00
+0b01 : 85 53 __ STA T1 + 0
+0b03 : a0 15 __ LDY #$15
+0b05 : b1 23 __ LDA (SP + 0),y
+0b07 : 85 55 __ STA T2 + 0
+0b09 : c8 __ __ INY
+0b0a : b1 23 __ LDA (SP + 0),y
+0b0c : 85 56 __ STA T2 + 1
+0b0e : a0 00 __ LDY #$00
+0b10 : b1 55 __ LDA (T2 + 0),y
+0b12 : 85 43 __ STA T3 + 0
+0b14 : a0 13 __ LDY #$13
+0b16 : b1 23 __ LDA (SP + 0),y
+0b18 : 85 57 __ STA T4 + 0
+0b1a : c8 __ __ INY
+0b1b : b1 23 __ LDA (SP + 0),y
+0b1d : 85 58 __ STA T4 + 1
+0b1f : a5 43 __ LDA T3 + 0
+0b21 : d0 4e __ BNE $0b71
+0b23 : 18 __ __ CLC
+0b24 : a5 57 __ LDA T4 + 0
+0b26 : 65 53 __ ADC T1 + 0
+0b28 : 85 55 __ STA T2 + 0
+0b2a : a5 58 __ LDA T4 + 1
+0b2c : 69 00 __ ADC #$00
+0b2e : 85 56 __ STA T2 + 1
+0b30 : a9 00 __ LDA #$00
+0b32 : a4 53 __ LDY T1 + 0
+0b34 : 91 57 __ STA (T4 + 0),y
+0b36 : 98 __ __ TYA
+0b37 : d0 08 __ BNE $0b41
+0b39 : a5 57 __ LDA T4 + 0
+0b3b : 85 55 __ STA T2 + 0
+0b3d : a5 58 __ LDA T4 + 1
+0b3f : 85 56 __ STA T2 + 1
+0b41 : a0 13 __ LDY #$13
+0b43 : b1 23 __ LDA (SP + 0),y
+0b45 : 85 57 __ STA T4 + 0
+0b47 : c8 __ __ INY
+0b48 : b1 23 __ LDA (SP + 0),y
+0b4a : 85 58 __ STA T4 + 1
+0b4c : 38 __ __ SEC
+0b4d : a5 55 __ LDA T2 + 0
+0b4f : e5 57 __ SBC T4 + 0
+0b51 : 85 1b __ STA ACCU + 0
+0b53 : a5 56 __ LDA T2 + 1
+0b55 : e5 58 __ SBC T4 + 1
+0b57 : 85 1c __ STA ACCU + 1
+0b59 : a0 07 __ LDY #$07
+0b5b : b1 23 __ LDA (SP + 0),y
+0b5d : 99 53 00 STA $0053,y 
+0b60 : 88 __ __ DEY
+0b61 : 10 f8 __ BPL $0b5b
+0b63 : 18 __ __ CLC
+0b64 : a5 23 __ LDA SP + 0
+0b66 : 69 11 __ ADC #$11
+0b68 : 85 23 __ STA SP + 0
+0b6a : a5 24 __ LDA SP + 1
+0b6c : 69 00 __ ADC #$00
+0b6e : 85 24 __ STA SP + 1
+0b70 : 60 __ __ RTS
+0b71 : 18 __ __ CLC
+0b72 : a5 23 __ LDA SP + 0
+0b74 : 69 17 __ ADC #$17
+0b76 : 85 59 __ STA T5 + 0
+0b78 : a5 24 __ LDA SP + 1
+0b7a : 69 00 __ ADC #$00
+0b7c : 85 5a __ STA T5 + 1
+0b7e : e6 55 __ INC T2 + 0
+0b80 : d0 02 __ BNE $0b84
+0b82 : e6 56 __ INC T2 + 1
+0b84 : a5 43 __ LDA T3 + 0
+0b86 : c9 25 __ CMP #$25
+0b88 : f0 31 __ BEQ $0bbb
+0b8a : a4 53 __ LDY T1 + 0
+0b8c : 91 57 __ STA (T4 + 0),y
+0b8e : e6 53 __ INC T1 + 0
+0b90 : a5 53 __ LDA T1 + 0
+0b92 : c9 28 __ CMP #$28
+0b94 : a0 00 __ LDY #$00
+0b96 : 90 1e __ BCC $0bb6
+0b98 : 18 __ __ CLC
+0b99 : 65 57 __ ADC T4 + 0
+0b9b : 85 57 __ STA T4 + 0
+0b9d : 90 02 __ BCC $0ba1
+0b9f : e6 58 __ INC T4 + 1
+0ba1 : a9 00 __ LDA #$00
+0ba3 : 85 53 __ STA T1 + 0
+0ba5 : b1 55 __ LDA (T2 + 0),y
+0ba7 : aa __ __ TAX
+0ba8 : e6 55 __ INC T2 + 0
+0baa : d0 02 __ BNE $0bae
+0bac : e6 56 __ INC T2 + 1
+0bae : 8a __ __ TXA
+0baf : 86 43 __ STX T3 + 0
+0bb1 : d0 d1 __ BNE $0b84
+0bb3 : 4c 23 0b JMP $0b23 ; (sprintf + 59)
+0bb6 : a0 00 __ LDY #$00
+0bb8 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0bbb : a5 53 __ LDA T1 + 0
+0bbd : f0 0d __ BEQ $0bcc
+0bbf : 18 __ __ CLC
+0bc0 : 65 57 __ ADC T4 + 0
+0bc2 : 85 57 __ STA T4 + 0
+0bc4 : 90 02 __ BCC $0bc8
+0bc6 : e6 58 __ INC T4 + 1
+0bc8 : a9 00 __ LDA #$00
+0bca : 85 53 __ STA T1 + 0
+0bcc : a0 00 __ LDY #$00
+0bce : b1 55 __ LDA (T2 + 0),y
+0bd0 : 85 43 __ STA T3 + 0
+0bd2 : a9 0a __ LDA #$0a
+0bd4 : a0 0c __ LDY #$0c
+0bd6 : 91 23 __ STA (SP + 0),y
+0bd8 : a9 00 __ LDA #$00
+0bda : c8 __ __ INY
+0bdb : 91 23 __ STA (SP + 0),y
+0bdd : a9 01 __ LDA #$01
+0bdf : a0 0a __ LDY #$0a
+0be1 : 91 23 __ STA (SP + 0),y
+0be3 : a9 ff __ LDA #$ff
+0be5 : c8 __ __ INY
+0be6 : 91 23 __ STA (SP + 0),y
+0be8 : a9 20 __ LDA #$20
+0bea : a0 09 __ LDY #$09
+0bec : 91 23 __ STA (SP + 0),y
+0bee : a9 00 __ LDA #$00
+0bf0 : a0 0e __ LDY #$0e
+0bf2 : 91 23 __ STA (SP + 0),y
+0bf4 : c8 __ __ INY
+0bf5 : 91 23 __ STA (SP + 0),y
+0bf7 : c8 __ __ INY
+0bf8 : 91 23 __ STA (SP + 0),y
+0bfa : e6 55 __ INC T2 + 0
+0bfc : d0 02 __ BNE $0c00
+0bfe : e6 56 __ INC T2 + 1
+0c00 : a5 43 __ LDA T3 + 0
+0c02 : c9 2b __ CMP #$2b
+0c04 : d0 03 __ BNE $0c09
+0c06 : 4c 07 13 JMP $1307 ; (sprintf + 2079)
+0c09 : c9 30 __ CMP #$30
+0c0b : d0 03 __ BNE $0c10
+0c0d : 4c f8 12 JMP $12f8 ; (sprintf + 2064)
+0c10 : c9 23 __ CMP #$23
+0c12 : d0 03 __ BNE $0c17
+0c14 : 4c e9 12 JMP $12e9 ; (sprintf + 2049)
+0c17 : c9 30 __ CMP #$30
+0c19 : 90 65 __ BCC $0c80
+0c1b : a9 39 __ LDA #$39
+0c1d : c5 43 __ CMP T3 + 0
+0c1f : 90 5f __ BCC $0c80
+0c21 : a9 00 __ LDA #$00
+0c23 : 85 46 __ STA T7 + 0
+0c25 : 85 47 __ STA T7 + 1
+0c27 : a5 43 __ LDA T3 + 0
+0c29 : c9 30 __ CMP #$30
+0c2b : 90 4d __ BCC $0c7a
+0c2d : a9 39 __ LDA #$39
+0c2f : c5 43 __ CMP T3 + 0
+0c31 : 90 47 __ BCC $0c7a
+0c33 : a5 43 __ LDA T3 + 0
+0c35 : 85 48 __ STA T8 + 0
+0c37 : a0 00 __ LDY #$00
+0c39 : b1 55 __ LDA (T2 + 0),y
+0c3b : 85 43 __ STA T3 + 0
+0c3d : e6 55 __ INC T2 + 0
+0c3f : d0 02 __ BNE $0c43
+0c41 : e6 56 __ INC T2 + 1
+0c43 : a5 46 __ LDA T7 + 0
+0c45 : 0a __ __ ASL
+0c46 : 85 07 __ STA $07
+0c48 : a5 47 __ LDA T7 + 1
+0c4a : 2a __ __ ROL
+0c4b : 06 07 __ ASL $07
+0c4d : 2a __ __ ROL
+0c4e : aa __ __ TAX
+0c4f : 18 __ __ CLC
+0c50 : a5 07 __ LDA $07
+0c52 : 65 46 __ ADC T7 + 0
+0c54 : 85 1b __ STA ACCU + 0
+0c56 : 8a __ __ TXA
+0c57 : 65 47 __ ADC T7 + 1
+0c59 : 06 1b __ ASL ACCU + 0
+0c5b : 2a __ __ ROL
+0c5c : 85 1c __ STA ACCU + 1
+0c5e : 18 __ __ CLC
+0c5f : a5 1b __ LDA ACCU + 0
+0c61 : 65 48 __ ADC T8 + 0
+0c63 : aa __ __ TAX
+0c64 : a5 1c __ LDA ACCU + 1
+0c66 : 69 00 __ ADC #$00
+0c68 : a8 __ __ TAY
+0c69 : 38 __ __ SEC
+0c6a : 8a __ __ TXA
+0c6b : e9 30 __ SBC #$30
+0c6d : 85 46 __ STA T7 + 0
+0c6f : 98 __ __ TYA
+0c70 : e9 00 __ SBC #$00
+0c72 : 85 47 __ STA T7 + 1
+0c74 : a5 43 __ LDA T3 + 0
+0c76 : c9 30 __ CMP #$30
+0c78 : b0 b3 __ BCS $0c2d
+0c7a : a5 46 __ LDA T7 + 0
+0c7c : a0 0a __ LDY #$0a
+0c7e : 91 23 __ STA (SP + 0),y
+0c80 : a5 43 __ LDA T3 + 0
+0c82 : c9 2e __ CMP #$2e
+0c84 : d0 03 __ BNE $0c89
+0c86 : 4c 7b 12 JMP $127b ; (sprintf + 1939)
+0c89 : a5 43 __ LDA T3 + 0
+0c8b : c9 64 __ CMP #$64
+0c8d : d0 03 __ BNE $0c92
+0c8f : 4c f0 10 JMP $10f0 ; (sprintf + 1544)
+0c92 : c9 75 __ CMP #$75
+0c94 : d0 03 __ BNE $0c99
+0c96 : 4c a3 0f JMP $0fa3 ; (sprintf + 1211)
+0c99 : c9 78 __ CMP #$78
+0c9b : d0 03 __ BNE $0ca0
+0c9d : 4c 4c 0e JMP $0e4c ; (sprintf + 868)
+0ca0 : c9 6c __ CMP #$6c
+0ca2 : d0 03 __ BNE $0ca7
+0ca4 : 4c 73 0d JMP $0d73 ; (sprintf + 651)
+0ca7 : c9 66 __ CMP #$66
+0ca9 : d0 03 __ BNE $0cae
+0cab : 4c 32 0d JMP $0d32 ; (sprintf + 586)
+0cae : c9 67 __ CMP #$67
+0cb0 : d0 03 __ BNE $0cb5
+0cb2 : 4c 32 0d JMP $0d32 ; (sprintf + 586)
+0cb5 : c9 65 __ CMP #$65
+0cb7 : f0 79 __ BEQ $0d32
+0cb9 : c9 73 __ CMP #$73
+0cbb : f0 32 __ BEQ $0cef
+0cbd : c9 63 __ CMP #$63
+0cbf : f0 14 __ BEQ $0cd5
+0cc1 : 09 00 __ ORA #$00
+0cc3 : d0 03 __ BNE $0cc8
+0cc5 : 4c b6 0b JMP $0bb6 ; (sprintf + 206)
+0cc8 : a5 43 __ LDA T3 + 0
+0cca : a4 53 __ LDY T1 + 0
+0ccc : 91 57 __ STA (T4 + 0),y
+0cce : e6 53 __ INC T1 + 0
+0cd0 : a0 00 __ LDY #$00
+0cd2 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0cd5 : a0 00 __ LDY #$00
+0cd7 : b1 59 __ LDA (T5 + 0),y
+0cd9 : a4 53 __ LDY T1 + 0
+0cdb : 91 57 __ STA (T4 + 0),y
+0cdd : 18 __ __ CLC
+0cde : a5 59 __ LDA T5 + 0
+0ce0 : 69 02 __ ADC #$02
+0ce2 : 85 59 __ STA T5 + 0
+0ce4 : 90 02 __ BCC $0ce8
+0ce6 : e6 5a __ INC T5 + 1
+0ce8 : e6 53 __ INC T1 + 0
+0cea : a0 00 __ LDY #$00
+0cec : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0cef : a0 00 __ LDY #$00
+0cf1 : b1 59 __ LDA (T5 + 0),y
+0cf3 : 85 46 __ STA T7 + 0
+0cf5 : c8 __ __ INY
+0cf6 : b1 59 __ LDA (T5 + 0),y
+0cf8 : 85 47 __ STA T7 + 1
+0cfa : 18 __ __ CLC
+0cfb : a5 59 __ LDA T5 + 0
+0cfd : 69 02 __ ADC #$02
+0cff : 85 59 __ STA T5 + 0
+0d01 : 90 02 __ BCC $0d05
+0d03 : e6 5a __ INC T5 + 1
+0d05 : 88 __ __ DEY
+0d06 : b1 46 __ LDA (T7 + 0),y
+0d08 : 85 43 __ STA T3 + 0
+0d0a : d0 03 __ BNE $0d0f
+0d0c : 4c b6 0b JMP $0bb6 ; (sprintf + 206)
+0d0f : e6 46 __ INC T7 + 0
+0d11 : d0 02 __ BNE $0d15
+0d13 : e6 47 __ INC T7 + 1
+0d15 : a5 43 __ LDA T3 + 0
+0d17 : a0 00 __ LDY #$00
+0d19 : 91 57 __ STA (T4 + 0),y
+0d1b : e6 57 __ INC T4 + 0
+0d1d : d0 02 __ BNE $0d21
+0d1f : e6 58 __ INC T4 + 1
+0d21 : b1 46 __ LDA (T7 + 0),y
+0d23 : aa __ __ TAX
+0d24 : e6 46 __ INC T7 + 0
+0d26 : d0 02 __ BNE $0d2a
+0d28 : e6 47 __ INC T7 + 1
+0d2a : 8a __ __ TXA
+0d2b : 86 43 __ STX T3 + 0
+0d2d : d0 e6 __ BNE $0d15
+0d2f : 4c b6 0b JMP $0bb6 ; (sprintf + 206)
+0d32 : 18 __ __ CLC
+0d33 : a5 23 __ LDA SP + 0
+0d35 : 69 09 __ ADC #$09
+0d37 : 85 0d __ STA P0
+0d39 : a5 24 __ LDA SP + 1
+0d3b : 69 00 __ ADC #$00
+0d3d : 85 0e __ STA P1
+0d3f : a5 57 __ LDA T4 + 0
+0d41 : 85 0f __ STA P2
+0d43 : a5 58 __ LDA T4 + 1
+0d45 : 85 10 __ STA P3
+0d47 : a0 00 __ LDY #$00
+0d49 : b1 59 __ LDA (T5 + 0),y
+0d4b : 85 11 __ STA P4
+0d4d : c8 __ __ INY
+0d4e : b1 59 __ LDA (T5 + 0),y
+0d50 : 85 12 __ STA P5
+0d52 : c8 __ __ INY
+0d53 : b1 59 __ LDA (T5 + 0),y
+0d55 : 85 13 __ STA P6
+0d57 : c8 __ __ INY
+0d58 : b1 59 __ LDA (T5 + 0),y
+0d5a : 85 14 __ STA P7
+0d5c : 20 43 15 JSR $1543 ; (nformf + 0)
+0d5f : a5 1b __ LDA ACCU + 0
+0d61 : 85 53 __ STA T1 + 0
+0d63 : 18 __ __ CLC
+0d64 : a5 59 __ LDA T5 + 0
+0d66 : 69 04 __ ADC #$04
+0d68 : 85 59 __ STA T5 + 0
+0d6a : 90 02 __ BCC $0d6e
+0d6c : e6 5a __ INC T5 + 1
+0d6e : a0 00 __ LDY #$00
+0d70 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0d73 : a0 00 __ LDY #$00
+0d75 : b1 59 __ LDA (T5 + 0),y
+0d77 : 85 4f __ STA T12 + 0
+0d79 : c8 __ __ INY
+0d7a : b1 59 __ LDA (T5 + 0),y
+0d7c : 85 50 __ STA T12 + 1
+0d7e : c8 __ __ INY
+0d7f : b1 59 __ LDA (T5 + 0),y
+0d81 : 85 51 __ STA T12 + 2
+0d83 : c8 __ __ INY
+0d84 : b1 59 __ LDA (T5 + 0),y
+0d86 : 85 52 __ STA T12 + 3
+0d88 : 18 __ __ CLC
+0d89 : a5 59 __ LDA T5 + 0
+0d8b : 69 04 __ ADC #$04
+0d8d : 85 59 __ STA T5 + 0
+0d8f : 90 02 __ BCC $0d93
+0d91 : e6 5a __ INC T5 + 1
+0d93 : a0 00 __ LDY #$00
+0d95 : b1 55 __ LDA (T2 + 0),y
+0d97 : aa __ __ TAX
+0d98 : e6 55 __ INC T2 + 0
+0d9a : d0 02 __ BNE $0d9e
+0d9c : e6 56 __ INC T2 + 1
+0d9e : 8a __ __ TXA
+0d9f : e0 64 __ CPX #$64
+0da1 : f0 78 __ BEQ $0e1b
+0da3 : c9 75 __ CMP #$75
+0da5 : f0 43 __ BEQ $0dea
+0da7 : c9 78 __ CMP #$78
+0da9 : f0 03 __ BEQ $0dae
+0dab : 4c b6 0b JMP $0bb6 ; (sprintf + 206)
+0dae : a9 10 __ LDA #$10
+0db0 : a0 0c __ LDY #$0c
+0db2 : 91 23 __ STA (SP + 0),y
+0db4 : a9 00 __ LDA #$00
+0db6 : c8 __ __ INY
+0db7 : 91 23 __ STA (SP + 0),y
+0db9 : 18 __ __ CLC
+0dba : a5 23 __ LDA SP + 0
+0dbc : 69 09 __ ADC #$09
+0dbe : 85 0d __ STA P0
+0dc0 : a5 24 __ LDA SP + 1
+0dc2 : 69 00 __ ADC #$00
+0dc4 : 85 0e __ STA P1
+0dc6 : a5 57 __ LDA T4 + 0
+0dc8 : 85 0f __ STA P2
+0dca : a5 58 __ LDA T4 + 1
+0dcc : 85 10 __ STA P3
+0dce : a5 4f __ LDA T12 + 0
+0dd0 : 85 11 __ STA P4
+0dd2 : a5 50 __ LDA T12 + 1
+0dd4 : 85 12 __ STA P5
+0dd6 : a5 51 __ LDA T12 + 2
+0dd8 : 85 13 __ STA P6
+0dda : a5 52 __ LDA T12 + 3
+0ddc : 85 14 __ STA P7
+0dde : 20 16 13 JSR $1316 ; (nforml + 0)
+0de1 : a5 1b __ LDA ACCU + 0
+0de3 : 85 53 __ STA T1 + 0
+0de5 : a0 00 __ LDY #$00
+0de7 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0dea : 18 __ __ CLC
+0deb : a5 23 __ LDA SP + 0
+0ded : 69 09 __ ADC #$09
+0def : 85 0d __ STA P0
+0df1 : a5 24 __ LDA SP + 1
+0df3 : 69 00 __ ADC #$00
+0df5 : 85 0e __ STA P1
+0df7 : a5 57 __ LDA T4 + 0
+0df9 : 85 0f __ STA P2
+0dfb : a5 58 __ LDA T4 + 1
+0dfd : 85 10 __ STA P3
+0dff : a5 4f __ LDA T12 + 0
+0e01 : 85 11 __ STA P4
+0e03 : a5 50 __ LDA T12 + 1
+0e05 : 85 12 __ STA P5
+0e07 : a5 51 __ LDA T12 + 2
+0e09 : 85 13 __ STA P6
+0e0b : a5 52 __ LDA T12 + 3
+0e0d : 85 14 __ STA P7
+0e0f : 20 16 13 JSR $1316 ; (nforml + 0)
+0e12 : a5 1b __ LDA ACCU + 0
+0e14 : 85 53 __ STA T1 + 0
+0e16 : a0 00 __ LDY #$00
+0e18 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0e1b : 18 __ __ CLC
+0e1c : a5 23 __ LDA SP + 0
+0e1e : 69 09 __ ADC #$09
+0e20 : 85 0d __ STA P0
+0e22 : a5 24 __ LDA SP + 1
+0e24 : 69 00 __ ADC #$00
+0e26 : 85 0e __ STA P1
+0e28 : a5 57 __ LDA T4 + 0
+0e2a : 85 0f __ STA P2
+0e2c : a5 58 __ LDA T4 + 1
+0e2e : 85 10 __ STA P3
+0e30 : a5 4f __ LDA T12 + 0
+0e32 : 85 11 __ STA P4
+0e34 : a5 50 __ LDA T12 + 1
+0e36 : 85 12 __ STA P5
+0e38 : a5 51 __ LDA T12 + 2
+0e3a : 85 13 __ STA P6
+0e3c : a5 52 __ LDA T12 + 3
+0e3e : 85 14 __ STA P7
+0e40 : 20 16 13 JSR $1316 ; (nforml + 0)
+0e43 : a5 1b __ LDA ACCU + 0
+0e45 : 85 53 __ STA T1 + 0
+0e47 : a0 00 __ LDY #$00
+0e49 : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0e4c : a9 10 __ LDA #$10
+0e4e : a0 0c __ LDY #$0c
+0e50 : 91 23 __ STA (SP + 0),y
+0e52 : a9 00 __ LDA #$00
+0e54 : c8 __ __ INY
+0e55 : 91 23 __ STA (SP + 0),y
+0e57 : a5 57 __ LDA T4 + 0
+0e59 : 85 46 __ STA T7 + 0
+0e5b : a5 58 __ LDA T4 + 1
+0e5d : 85 47 __ STA T7 + 1
+0e5f : a0 00 __ LDY #$00
+0e61 : b1 59 __ LDA (T5 + 0),y
+0e63 : 85 48 __ STA T8 + 0
+0e65 : c8 __ __ INY
+0e66 : b1 59 __ LDA (T5 + 0),y
+0e68 : 85 49 __ STA T8 + 1
+0e6a : 18 __ __ CLC
+0e6b : a5 59 __ LDA T5 + 0
+0e6d : 69 02 __ ADC #$02
+0e6f : 85 59 __ STA T5 + 0
+0e71 : 90 02 __ BCC $0e75
+0e73 : e6 5a __ INC T5 + 1
+0e75 : a9 0a __ LDA #$0a
+0e77 : 85 43 __ STA T3 + 0
+0e79 : a5 48 __ LDA T8 + 0
+0e7b : 05 49 __ ORA T8 + 1
+0e7d : f0 03 __ BEQ $0e82
+0e7f : 4c 49 0f JMP $0f49 ; (sprintf + 1121)
+0e82 : a0 0b __ LDY #$0b
+0e84 : b1 23 __ LDA (SP + 0),y
+0e86 : 85 44 __ STA T6 + 0
+0e88 : c9 ff __ CMP #$ff
+0e8a : d0 03 __ BNE $0e8f
+0e8c : 4c 3b 0f JMP $0f3b ; (sprintf + 1107)
+0e8f : 38 __ __ SEC
+0e90 : a9 0a __ LDA #$0a
+0e92 : e5 44 __ SBC T6 + 0
+0e94 : 85 44 __ STA T6 + 0
+0e96 : c5 43 __ CMP T3 + 0
+0e98 : b0 0e __ BCS $0ea8
+0e9a : c6 43 __ DEC T3 + 0
+0e9c : a9 30 __ LDA #$30
+0e9e : a4 43 __ LDY T3 + 0
+0ea0 : 91 46 __ STA (T7 + 0),y
+0ea2 : a5 44 __ LDA T6 + 0
+0ea4 : c5 43 __ CMP T3 + 0
+0ea6 : 90 f2 __ BCC $0e9a
+0ea8 : a0 10 __ LDY #$10
+0eaa : b1 23 __ LDA (SP + 0),y
+0eac : f0 34 __ BEQ $0ee2
+0eae : a0 0c __ LDY #$0c
+0eb0 : b1 23 __ LDA (SP + 0),y
+0eb2 : 85 48 __ STA T8 + 0
+0eb4 : c8 __ __ INY
+0eb5 : b1 23 __ LDA (SP + 0),y
+0eb7 : d0 29 __ BNE $0ee2
+0eb9 : a5 48 __ LDA T8 + 0
+0ebb : c9 10 __ CMP #$10
+0ebd : d0 23 __ BNE $0ee2
+0ebf : 18 __ __ CLC
+0ec0 : a5 43 __ LDA T3 + 0
+0ec2 : 69 ff __ ADC #$ff
+0ec4 : 18 __ __ CLC
+0ec5 : 65 46 __ ADC T7 + 0
+0ec7 : 85 48 __ STA T8 + 0
+0ec9 : a5 47 __ LDA T7 + 1
+0ecb : 69 00 __ ADC #$00
+0ecd : 85 49 __ STA T8 + 1
+0ecf : a9 58 __ LDA #$58
+0ed1 : a0 00 __ LDY #$00
+0ed3 : 91 48 __ STA (T8 + 0),y
+0ed5 : 18 __ __ CLC
+0ed6 : a5 43 __ LDA T3 + 0
+0ed8 : 69 fe __ ADC #$fe
+0eda : 85 43 __ STA T3 + 0
+0edc : a9 30 __ LDA #$30
+0ede : a4 43 __ LDY T3 + 0
+0ee0 : 91 46 __ STA (T7 + 0),y
+0ee2 : a0 0e __ LDY #$0e
+0ee4 : b1 23 __ LDA (SP + 0),y
+0ee6 : f0 08 __ BEQ $0ef0
+0ee8 : c6 43 __ DEC T3 + 0
+0eea : a9 2b __ LDA #$2b
+0eec : a4 43 __ LDY T3 + 0
+0eee : 91 46 __ STA (T7 + 0),y
+0ef0 : a0 0a __ LDY #$0a
+0ef2 : b1 23 __ LDA (SP + 0),y
+0ef4 : 85 53 __ STA T1 + 0
+0ef6 : 38 __ __ SEC
+0ef7 : a9 0a __ LDA #$0a
+0ef9 : e5 53 __ SBC T1 + 0
+0efb : 85 48 __ STA T8 + 0
+0efd : a9 00 __ LDA #$00
+0eff : e9 00 __ SBC #$00
+0f01 : 49 80 __ EOR #$80
+0f03 : c9 80 __ CMP #$80
+0f05 : d0 04 __ BNE $0f0b
+0f07 : a5 48 __ LDA T8 + 0
+0f09 : c5 43 __ CMP T3 + 0
+0f0b : 90 21 __ BCC $0f2e
+0f0d : a9 00 __ LDA #$00
+0f0f : 85 53 __ STA T1 + 0
+0f11 : a5 43 __ LDA T3 + 0
+0f13 : c9 0a __ CMP #$0a
+0f15 : b0 12 __ BCS $0f29
+0f17 : a4 43 __ LDY T3 + 0
+0f19 : b1 46 __ LDA (T7 + 0),y
+0f1b : a4 53 __ LDY T1 + 0
+0f1d : 91 46 __ STA (T7 + 0),y
+0f1f : e6 53 __ INC T1 + 0
+0f21 : e6 43 __ INC T3 + 0
+0f23 : a5 43 __ LDA T3 + 0
+0f25 : c9 0a __ CMP #$0a
+0f27 : 90 ee __ BCC $0f17
+0f29 : a0 00 __ LDY #$00
+0f2b : 4c a5 0b JMP $0ba5 ; (sprintf + 189)
+0f2e : c6 43 __ DEC T3 + 0
+0f30 : a0 09 __ LDY #$09
+0f32 : b1 23 __ LDA (SP + 0),y
+0f34 : a4 43 __ LDY T3 + 0
+0f36 : 91 46 __ STA (T7 + 0),y
+0f38 : 4c f0 0e JMP $0ef0 ; (sprintf + 1032)
+0f3b : a9 09 __ LDA #$09
+0f3d : 85 44 __ STA T6 + 0
+0f3f : c5 43 __ CMP T3 + 0
+0f41 : b0 03 __ BCS $0f46
+0f43 : 4c 9a 0e JMP $0e9a ; (sprintf + 946)
+0f46 : 4c a8 0e JMP $0ea8 ; (sprintf + 960)
+0f49 : a5 48 __ LDA T8 + 0
+0f4b : 85 1b __ STA ACCU + 0
+0f4d : a5 49 __ LDA T8 + 1
+0f4f : 85 1c __ STA ACCU + 1
+0f51 : a0 0c __ LDY #$0c
+0f53 : b1 23 __ LDA (SP + 0),y
+0f55 : 85 03 __ STA $03
+0f57 : c8 __ __ INY
+0f58 : b1 23 __ LDA (SP + 0),y
+0f5a : 85 04 __ STA $04
+0f5c : 20 00 21 JSR $2100 ; (divmod + 0)
+0f5f : a5 06 __ LDA $06
+0f61 : 10 30 __ BPL $0f93
+0f63 : 18 __ __ CLC
+0f64 : a5 05 __ LDA $05
+0f66 : 69 30 __ ADC #$30
+0f68 : c6 43 __ DEC T3 + 0
+0f6a : a4 43 __ LDY T3 + 0
+0f6c : 91 46 __ STA (T7 + 0),y
+0f6e : a5 48 __ LDA T8 + 0
+0f70 : 85 1b __ STA ACCU + 0
+0f72 : a5 49 __ LDA T8 + 1
+0f74 : 85 1c __ STA ACCU + 1
+0f76 : a0 0c __ LDY #$0c
+0f78 : b1 23 __ LDA (SP + 0),y
+0f7a : 85 03 __ STA $03
+0f7c : c8 __ __ INY
+0f7d : b1 23 __ LDA (SP + 0),y
+0f7f : 85 04 __ STA $04
+0f81 : 20 00 21 JSR $2100 ; (divmod + 0)
+0f84 : a5 1b __ LDA ACCU + 0
+0f86 : 85 48 __ STA T8 + 0
+0f88 : a5 1c __ LDA ACCU + 1
+0f8a : 85 49 __ STA T8 + 1
+0f8c : 05 1b __ ORA ACCU + 0
+0f8e : d0 b9 __ BNE $0f49
+0f90 : 4c 82 0e JMP $0e82 ; (sprintf + 922)
+0f93 : d0 06 __ BNE $0f9b
+0f95 : a5 05 __ LDA $05
+0f97 : c9 0a __ CMP #$0a
+0f99 : 90 c8 __ BCC $0f63
+0f9b : 18 __ __ CLC
+0f9c : a5 05 __ LDA $05
+0f9e : 69 37 __ ADC #$37
+0fa0 : 4c 68 0f JMP $0f68 ; (sprintf + 1152)
+0fa3 : a5 57 __ LDA T4 + 0
+0fa5 : 85 46 __ STA T7 + 0
+0fa7 : a5 58 __ LDA T4 + 1
+0fa9 : 85 47 __ STA T7 + 1
+0fab : a0 00 __ LDY #$00
+0fad : b1 59 __ LDA (T5 + 0),y
+0faf : 85 48 __ STA T8 + 0
+0fb1 : c8 __ __ INY
+0fb2 : b1 59 __ LDA (T5 + 0),y
+0fb4 : 85 49 __ STA T8 + 1
+0fb6 : 18 __ __ CLC
+0fb7 : a5 59 __ LDA T5 + 0
+0fb9 : 69 02 __ ADC #$02
+0fbb : 85 59 __ STA T5 + 0
+0fbd : 90 02 __ BCC $0fc1
+0fbf : e6 5a __ INC T5 + 1
+0fc1 : a9 0a __ LDA #$0a
+0fc3 : 85 43 __ STA T3 + 0
+0fc5 : a5 48 __ LDA T8 + 0
+0fc7 : 05 49 __ ORA T8 + 1
+0fc9 : f0 03 __ BEQ $0fce
+0fcb : 4c 96 10 JMP $1096 ; (sprintf + 1454)
+0fce : a0 0b __ LDY #$0b
+0fd0 : b1 23 __ LDA (SP + 0),y
+0fd2 : 85 44 __ STA T6 + 0
+0fd4 : c9 ff __ CMP #$ff
+0fd6 : d0 03 __ BNE $0fdb
+0fd8 : 4c 88 10 JMP $1088 ; (sprintf + 1440)
+0fdb : 38 __ __ SEC
+0fdc : a9 0a __ LDA #$0a
+0fde : e5 44 __ SBC T6 + 0
+0fe0 : 85 44 __ STA T6 + 0
+0fe2 : c5 43 __ CMP T3 + 0
+0fe4 : b0 0e __ BCS $0ff4
+0fe6 : c6 43 __ DEC T3 + 0
+0fe8 : a9 30 __ LDA #$30
+0fea : a4 43 __ LDY T3 + 0
+0fec : 91 46 __ STA (T7 + 0),y
+0fee : a5 44 __ LDA T6 + 0
+0ff0 : c5 43 __ CMP T3 + 0
+0ff2 : 90 f2 __ BCC $0fe6
+0ff4 : a0 10 __ LDY #$10
+0ff6 : b1 23 __ LDA (SP + 0),y
+0ff8 : f0 34 __ BEQ $102e
+0ffa : a0 0c __ LDY #$0c
+0ffc : b1 23 __ LDA (SP + 0),y
+0ffe : 85 48 __ STA T8 + 0
+1000 : c8 __ __ INY
+1001 : b1 23 __ LDA (SP + 0),y
+1003 : d0 29 __ BNE $102e
+1005 : a5 48 __ LDA T8 + 0
+1007 : c9 10 __ CMP #$10
+1009 : d0 23 __ BNE $102e
+100b : 18 __ __ CLC
+100c : a5 43 __ LDA T3 + 0
+100e : 69 ff __ ADC #$ff
+1010 : 18 __ __ CLC
+1011 : 65 46 __ ADC T7 + 0
+1013 : 85 48 __ STA T8 + 0
+1015 : a5 47 __ LDA T7 + 1
+1017 : 69 00 __ ADC #$00
+1019 : 85 49 __ STA T8 + 1
+101b : a9 58 __ LDA #$58
+101d : a0 00 __ LDY #$00
+101f : 91 48 __ STA (T8 + 0),y
+1021 : 18 __ __ CLC
+1022 : a5 43 __ LDA T3 + 0
+1024 : 69 fe __ ADC #$fe
+1026 : 85 43 __ STA T3 + 0
+1028 : a9 30 __ LDA #$30
+102a : a4 43 __ LDY T3 + 0
+102c : 91 46 __ STA (T7 + 0),y
+102e : a0 0e __ LDY #$0e
+1030 : b1 23 __ LDA (SP + 0),y
+1032 : f0 08 __ BEQ $103c
+1034 : c6 43 __ DEC T3 + 0
+1036 : a9 2b __ LDA #$2b
+1038 : a4 43 __ LDY T3 + 0
+103a : 91 46 __ STA (T7 + 0),y
+103c : a0 0a __ LDY #$0a
+103e : b1 23 __ LDA (SP + 0),y
+1040 : 85 53 __ STA T1 + 0
+1042 : 38 __ __ SEC
+1043 : a9 0a __ LDA #$0a
+1045 : e5 53 __ SBC T1 + 0
+1047 : 85 48 __ STA T8 + 0
+1049 : a9 00 __ LDA #$00
+104b : e9 00 __ SBC #$00
+104d : 49 80 __ EOR #$80
+104f : c9 80 __ CMP #$80
+1051 : d0 04 __ BNE $1057
+1053 : a5 48 __ LDA T8 + 0
+1055 : c5 43 __ CMP T3 + 0
+1057 : 90 22 __ BCC $107b
+1059 : a9 00 __ LDA #$00
+105b : 85 53 __ STA T1 + 0
+105d : a5 43 __ LDA T3 + 0
+105f : c9 0a __ CMP #$0a
+1061 : 90 03 __ BCC $1066
+1063 : 4c 29 0f JMP $0f29 ; (sprintf + 1089)
+1066 : a4 43 __ LDY T3 + 0
+1068 : b1 46 __ LDA (T7 + 0),y
+106a : a4 53 __ LDY T1 + 0
+106c : 91 46 __ STA (T7 + 0),y
+106e : e6 53 __ INC T1 + 0
+1070 : e6 43 __ INC T3 + 0
+1072 : a5 43 __ LDA T3 + 0
+1074 : c9 0a __ CMP #$0a
+1076 : 90 ee __ BCC $1066
+1078 : 4c 29 0f JMP $0f29 ; (sprintf + 1089)
+107b : c6 43 __ DEC T3 + 0
+107d : a0 09 __ LDY #$09
+107f : b1 23 __ LDA (SP + 0),y
+1081 : a4 43 __ LDY T3 + 0
+1083 : 91 46 __ STA (T7 + 0),y
+1085 : 4c 3c 10 JMP $103c ; (sprintf + 1364)
+1088 : a9 09 __ LDA #$09
+108a : 85 44 __ STA T6 + 0
+108c : c5 43 __ CMP T3 + 0
+108e : b0 03 __ BCS $1093
+1090 : 4c e6 0f JMP $0fe6 ; (sprintf + 1278)
+1093 : 4c f4 0f JMP $0ff4 ; (sprintf + 1292)
+1096 : a5 48 __ LDA T8 + 0
+1098 : 85 1b __ STA ACCU + 0
+109a : a5 49 __ LDA T8 + 1
+109c : 85 1c __ STA ACCU + 1
+109e : a0 0c __ LDY #$0c
+10a0 : b1 23 __ LDA (SP + 0),y
+10a2 : 85 03 __ STA $03
+10a4 : c8 __ __ INY
+10a5 : b1 23 __ LDA (SP + 0),y
+10a7 : 85 04 __ STA $04
+10a9 : 20 00 21 JSR $2100 ; (divmod + 0)
+10ac : a5 06 __ LDA $06
+10ae : 10 30 __ BPL $10e0
+10b0 : 18 __ __ CLC
+10b1 : a5 05 __ LDA $05
+10b3 : 69 30 __ ADC #$30
+10b5 : c6 43 __ DEC T3 + 0
+10b7 : a4 43 __ LDY T3 + 0
+10b9 : 91 46 __ STA (T7 + 0),y
+10bb : a5 48 __ LDA T8 + 0
+10bd : 85 1b __ STA ACCU + 0
+10bf : a5 49 __ LDA T8 + 1
+10c1 : 85 1c __ STA ACCU + 1
+10c3 : a0 0c __ LDY #$0c
+10c5 : b1 23 __ LDA (SP + 0),y
+10c7 : 85 03 __ STA $03
+10c9 : c8 __ __ INY
+10ca : b1 23 __ LDA (SP + 0),y
+10cc : 85 04 __ STA $04
+10ce : 20 00 21 JSR $2100 ; (divmod + 0)
+10d1 : a5 1b __ LDA ACCU + 0
+10d3 : 85 48 __ STA T8 + 0
+10d5 : a5 1c __ LDA ACCU + 1
+10d7 : 85 49 __ STA T8 + 1
+10d9 : 05 1b __ ORA ACCU + 0
+10db : d0 b9 __ BNE $1096
+10dd : 4c ce 0f JMP $0fce ; (sprintf + 1254)
+10e0 : d0 06 __ BNE $10e8
+10e2 : a5 05 __ LDA $05
+10e4 : c9 0a __ CMP #$0a
+10e6 : 90 c8 __ BCC $10b0
+10e8 : 18 __ __ CLC
+10e9 : a5 05 __ LDA $05
+10eb : 69 37 __ ADC #$37
+10ed : 4c b5 10 JMP $10b5 ; (sprintf + 1485)
+10f0 : a5 57 __ LDA T4 + 0
+10f2 : 85 46 __ STA T7 + 0
+10f4 : a5 58 __ LDA T4 + 1
+10f6 : 85 47 __ STA T7 + 1
+10f8 : a0 00 __ LDY #$00
+10fa : b1 59 __ LDA (T5 + 0),y
+10fc : 85 48 __ STA T8 + 0
+10fe : c8 __ __ INY
+10ff : b1 59 __ LDA (T5 + 0),y
+1101 : 85 49 __ STA T8 + 1
+1103 : 18 __ __ CLC
+1104 : a5 59 __ LDA T5 + 0
+1106 : 69 02 __ ADC #$02
+1108 : 85 59 __ STA T5 + 0
+110a : 90 02 __ BCC $110e
+110c : e6 5a __ INC T5 + 1
+110e : a5 49 __ LDA T8 + 1
+1110 : 10 03 __ BPL $1115
+1112 : 4c 5f 12 JMP $125f ; (sprintf + 1911)
+1115 : a5 48 __ LDA T8 + 0
+1117 : 85 4a __ STA T9 + 0
+1119 : a5 49 __ LDA T8 + 1
+111b : 85 4b __ STA T9 + 1
+111d : a9 00 __ LDA #$00
+111f : 85 53 __ STA T1 + 0
+1121 : a9 0a __ LDA #$0a
+1123 : 85 43 __ STA T3 + 0
+1125 : a5 48 __ LDA T8 + 0
+1127 : 05 49 __ ORA T8 + 1
+1129 : f0 03 __ BEQ $112e
+112b : 4c 05 12 JMP $1205 ; (sprintf + 1821)
+112e : a0 0b __ LDY #$0b
+1130 : b1 23 __ LDA (SP + 0),y
+1132 : 85 44 __ STA T6 + 0
+1134 : c9 ff __ CMP #$ff
+1136 : d0 03 __ BNE $113b
+1138 : 4c f7 11 JMP $11f7 ; (sprintf + 1807)
+113b : 38 __ __ SEC
+113c : a9 0a __ LDA #$0a
+113e : e5 44 __ SBC T6 + 0
+1140 : 85 44 __ STA T6 + 0
+1142 : c5 43 __ CMP T3 + 0
+1144 : b0 0e __ BCS $1154
+1146 : c6 43 __ DEC T3 + 0
+1148 : a9 30 __ LDA #$30
+114a : a4 43 __ LDY T3 + 0
+114c : 91 46 __ STA (T7 + 0),y
+114e : a5 44 __ LDA T6 + 0
+1150 : c5 43 __ CMP T3 + 0
+1152 : 90 f2 __ BCC $1146
+1154 : a0 10 __ LDY #$10
+1156 : b1 23 __ LDA (SP + 0),y
+1158 : f0 34 __ BEQ $118e
+115a : a0 0c __ LDY #$0c
+115c : b1 23 __ LDA (SP + 0),y
+115e : 85 48 __ STA T8 + 0
+1160 : c8 __ __ INY
+1161 : b1 23 __ LDA (SP + 0),y
+1163 : d0 29 __ BNE $118e
+1165 : a5 48 __ LDA T8 + 0
+1167 : c9 10 __ CMP #$10
+1169 : d0 23 __ BNE $118e
+116b : 18 __ __ CLC
+116c : a5 43 __ LDA T3 + 0
+116e : 69 ff __ ADC #$ff
+1170 : 18 __ __ CLC
+1171 : 65 46 __ ADC T7 + 0
+1173 : 85 48 __ STA T8 + 0
+1175 : a5 47 __ LDA T7 + 1
+1177 : 69 00 __ ADC #$00
+1179 : 85 49 __ STA T8 + 1
+117b : a9 58 __ LDA #$58
+117d : a0 00 __ LDY #$00
+117f : 91 48 __ STA (T8 + 0),y
+1181 : 18 __ __ CLC
+1182 : a5 43 __ LDA T3 + 0
+1184 : 69 fe __ ADC #$fe
+1186 : 85 43 __ STA T3 + 0
+1188 : a9 30 __ LDA #$30
+118a : a4 43 __ LDY T3 + 0
+118c : 91 46 __ STA (T7 + 0),y
+118e : a5 53 __ LDA T1 + 0
+1190 : d0 5a __ BNE $11ec
+1192 : a0 0e __ LDY #$0e
+1194 : b1 23 __ LDA (SP + 0),y
+1196 : f0 08 __ BEQ $11a0
+1198 : c6 43 __ DEC T3 + 0
+119a : a9 2b __ LDA #$2b
+119c : a4 43 __ LDY T3 + 0
+119e : 91 46 __ STA (T7 + 0),y
+11a0 : a0 0a __ LDY #$0a
+11a2 : b1 23 __ LDA (SP + 0),y
+11a4 : 85 53 __ STA T1 + 0
+11a6 : 38 __ __ SEC
+11a7 : a9 0a __ LDA #$0a
+11a9 : e5 53 __ SBC T1 + 0
+11ab : 85 48 __ STA T8 + 0
+11ad : a9 00 __ LDA #$00
+11af : e9 00 __ SBC #$00
+11b1 : 49 80 __ EOR #$80
+11b3 : c9 80 __ CMP #$80
+11b5 : d0 04 __ BNE $11bb
+11b7 : a5 48 __ LDA T8 + 0
+11b9 : c5 43 __ CMP T3 + 0
+11bb : 90 22 __ BCC $11df
+11bd : a9 00 __ LDA #$00
+11bf : 85 53 __ STA T1 + 0
+11c1 : a5 43 __ LDA T3 + 0
+11c3 : c9 0a __ CMP #$0a
+11c5 : 90 03 __ BCC $11ca
+11c7 : 4c 29 0f JMP $0f29 ; (sprintf + 1089)
+11ca : a4 43 __ LDY T3 + 0
+11cc : b1 46 __ LDA (T7 + 0),y
+11ce : a4 53 __ LDY T1 + 0
+11d0 : 91 46 __ STA (T7 + 0),y
+11d2 : e6 53 __ INC T1 + 0
+11d4 : e6 43 __ INC T3 + 0
+11d6 : a5 43 __ LDA T3 + 0
+11d8 : c9 0a __ CMP #$0a
+11da : 90 ee __ BCC $11ca
+11dc : 4c 29 0f JMP $0f29 ; (sprintf + 1089)
+11df : c6 43 __ DEC T3 + 0
+11e1 : a0 09 __ LDY #$09
+11e3 : b1 23 __ LDA (SP + 0),y
+11e5 : a4 43 __ LDY T3 + 0
+11e7 : 91 46 __ STA (T7 + 0),y
+11e9 : 4c a0 11 JMP $11a0 ; (sprintf + 1720)
+11ec : c6 43 __ DEC T3 + 0
+11ee : a9 2d __ LDA #$2d
+11f0 : a4 43 __ LDY T3 + 0
+11f2 : 91 46 __ STA (T7 + 0),y
+11f4 : 4c a0 11 JMP $11a0 ; (sprintf + 1720)
+11f7 : a9 09 __ LDA #$09
+11f9 : 85 44 __ STA T6 + 0
+11fb : c5 43 __ CMP T3 + 0
+11fd : b0 03 __ BCS $1202
+11ff : 4c 46 11 JMP $1146 ; (sprintf + 1630)
+1202 : 4c 54 11 JMP $1154 ; (sprintf + 1644)
+1205 : a5 4a __ LDA T9 + 0
+1207 : 85 1b __ STA ACCU + 0
+1209 : a5 4b __ LDA T9 + 1
+120b : 85 1c __ STA ACCU + 1
+120d : a0 0c __ LDY #$0c
+120f : b1 23 __ LDA (SP + 0),y
+1211 : 85 03 __ STA $03
+1213 : c8 __ __ INY
+1214 : b1 23 __ LDA (SP + 0),y
+1216 : 85 04 __ STA $04
+1218 : 20 00 21 JSR $2100 ; (divmod + 0)
+121b : a5 06 __ LDA $06
+121d : 10 30 __ BPL $124f
+121f : 18 __ __ CLC
+1220 : a5 05 __ LDA $05
+1222 : 69 30 __ ADC #$30
+1224 : c6 43 __ DEC T3 + 0
+1226 : a4 43 __ LDY T3 + 0
+1228 : 91 46 __ STA (T7 + 0),y
+122a : a5 4a __ LDA T9 + 0
+122c : 85 1b __ STA ACCU + 0
+122e : a5 4b __ LDA T9 + 1
+1230 : 85 1c __ STA ACCU + 1
+1232 : a0 0c __ LDY #$0c
+1234 : b1 23 __ LDA (SP + 0),y
+1236 : 85 03 __ STA $03
+1238 : c8 __ __ INY
+1239 : b1 23 __ LDA (SP + 0),y
+123b : 85 04 __ STA $04
+123d : 20 00 21 JSR $2100 ; (divmod + 0)
+1240 : a5 1b __ LDA ACCU + 0
+1242 : 85 4a __ STA T9 + 0
+1244 : a5 1c __ LDA ACCU + 1
+1246 : 85 4b __ STA T9 + 1
+1248 : 05 1b __ ORA ACCU + 0
+124a : d0 b9 __ BNE $1205
+124c : 4c 2e 11 JMP $112e ; (sprintf + 1606)
+124f : d0 06 __ BNE $1257
+1251 : a5 05 __ LDA $05
+1253 : c9 0a __ CMP #$0a
+1255 : 90 c8 __ BCC $121f
+1257 : 18 __ __ CLC
+1258 : a5 05 __ LDA $05
+125a : 69 37 __ ADC #$37
+125c : 4c 24 12 JMP $1224 ; (sprintf + 1852)
+125f : a9 01 __ LDA #$01
+1261 : 85 53 __ STA T1 + 0
+1263 : a9 0a __ LDA #$0a
+1265 : 85 43 __ STA T3 + 0
+1267 : 38 __ __ SEC
+1268 : a9 00 __ LDA #$00
+126a : e5 48 __ SBC T8 + 0
+126c : 85 4a __ STA T9 + 0
+126e : a9 00 __ LDA #$00
+1270 : e5 49 __ SBC T8 + 1
+1272 : 85 4b __ STA T9 + 1
+1274 : 05 4a __ ORA T9 + 0
+1276 : d0 8d __ BNE $1205
+1278 : 4c 2e 11 JMP $112e ; (sprintf + 1606)
+127b : a9 00 __ LDA #$00
+127d : 85 46 __ STA T7 + 0
+127f : 85 47 __ STA T7 + 1
+1281 : a0 00 __ LDY #$00
+1283 : b1 55 __ LDA (T2 + 0),y
+1285 : 85 43 __ STA T3 + 0
+1287 : e6 55 __ INC T2 + 0
+1289 : d0 02 __ BNE $128d
+128b : e6 56 __ INC T2 + 1
+128d : a5 43 __ LDA T3 + 0
+128f : c9 30 __ CMP #$30
+1291 : 90 4d __ BCC $12e0
+1293 : a9 39 __ LDA #$39
+1295 : c5 43 __ CMP T3 + 0
+1297 : 90 47 __ BCC $12e0
+1299 : a5 43 __ LDA T3 + 0
+129b : 85 48 __ STA T8 + 0
+129d : a0 00 __ LDY #$00
+129f : b1 55 __ LDA (T2 + 0),y
+12a1 : 85 43 __ STA T3 + 0
+12a3 : e6 55 __ INC T2 + 0
+12a5 : d0 02 __ BNE $12a9
+12a7 : e6 56 __ INC T2 + 1
+12a9 : a5 46 __ LDA T7 + 0
+12ab : 0a __ __ ASL
+12ac : 85 07 __ STA $07
+12ae : a5 47 __ LDA T7 + 1
+12b0 : 2a __ __ ROL
+12b1 : 06 07 __ ASL $07
+12b3 : 2a __ __ ROL
+12b4 : aa __ __ TAX
+12b5 : 18 __ __ CLC
+12b6 : a5 07 __ LDA $07
+12b8 : 65 46 __ ADC T7 + 0
+12ba : 85 1b __ STA ACCU + 0
+12bc : 8a __ __ TXA
+12bd : 65 47 __ ADC T7 + 1
+12bf : 06 1b __ ASL ACCU + 0
+12c1 : 2a __ __ ROL
+12c2 : 85 1c __ STA ACCU + 1
+12c4 : 18 __ __ CLC
+12c5 : a5 1b __ LDA ACCU + 0
+12c7 : 65 48 __ ADC T8 + 0
+12c9 : aa __ __ TAX
+12ca : a5 1c __ LDA ACCU + 1
+12cc : 69 00 __ ADC #$00
+12ce : a8 __ __ TAY
+12cf : 38 __ __ SEC
+12d0 : 8a __ __ TXA
+12d1 : e9 30 __ SBC #$30
+12d3 : 85 46 __ STA T7 + 0
+12d5 : 98 __ __ TYA
+12d6 : e9 00 __ SBC #$00
+12d8 : 85 47 __ STA T7 + 1
+12da : a5 43 __ LDA T3 + 0
+12dc : c9 30 __ CMP #$30
+12de : b0 b3 __ BCS $1293
+12e0 : a5 46 __ LDA T7 + 0
+12e2 : a0 0b __ LDY #$0b
+12e4 : 91 23 __ STA (SP + 0),y
+12e6 : 4c 89 0c JMP $0c89 ; (sprintf + 417)
+12e9 : a9 01 __ LDA #$01
+12eb : a0 10 __ LDY #$10
+12ed : 91 23 __ STA (SP + 0),y
+12ef : a0 00 __ LDY #$00
+12f1 : b1 55 __ LDA (T2 + 0),y
+12f3 : 85 43 __ STA T3 + 0
+12f5 : 4c fa 0b JMP $0bfa ; (sprintf + 274)
+12f8 : a9 30 __ LDA #$30
+12fa : a0 09 __ LDY #$09
+12fc : 91 23 __ STA (SP + 0),y
+12fe : a0 00 __ LDY #$00
+1300 : b1 55 __ LDA (T2 + 0),y
+1302 : 85 43 __ STA T3 + 0
+1304 : 4c fa 0b JMP $0bfa ; (sprintf + 274)
+1307 : a9 01 __ LDA #$01
+1309 : a0 0e __ LDY #$0e
+130b : 91 23 __ STA (SP + 0),y
+130d : a0 00 __ LDY #$00
+130f : b1 55 __ LDA (T2 + 0),y
+1311 : 85 43 __ STA T3 + 0
+1313 : 4c fa 0b JMP $0bfa ; (sprintf + 274)
+--------------------------------------------------------------------
+nforml:
+1316 : 38 __ __ SEC
+1317 : a5 23 __ LDA SP + 0
+1319 : e9 05 __ SBC #$05
+131b : 85 23 __ STA SP + 0
+131d : a5 24 __ LDA SP + 1
+131f : e9 00 __ SBC #$00
+1321 : 85 24 __ STA SP + 1
+1323 : a0 01 __ LDY #$01
+1325 : b9 53 00 LDA $0053,y 
+1328 : 91 23 __ STA (SP + 0),y
+132a : 88 __ __ DEY
+132b : 10 f8 __ BPL $1325
+132d : a5 11 __ LDA P4
+132f : 85 47 __ STA T1 + 0
+1331 : a5 12 __ LDA P5
+1333 : 85 48 __ STA T1 + 1
+1335 : a5 13 __ LDA P6
+1337 : 85 49 __ STA T1 + 2
+1339 : a5 14 __ LDA P7
+133b : 85 4a __ STA T1 + 3
+133d : a9 00 __ LDA #$00
+133f : 85 4d __ STA T3 + 0
+1341 : a5 15 __ LDA P8
+1343 : f0 03 __ BEQ $1348
+1345 : 4c ee 14 JMP $14ee ; (nforml + 472)
+1348 : a9 10 __ LDA #$10
+134a : 85 4e __ STA T4 + 0
+134c : a9 00 __ LDA #$00
+134e : c5 14 __ CMP P7
+1350 : d0 0a __ BNE $135c
+1352 : c5 13 __ CMP P6
+1354 : d0 06 __ BNE $135c
+1356 : c5 12 __ CMP P5
+1358 : d0 02 __ BNE $135c
+135a : c5 11 __ CMP P4
+135c : b0 03 __ BCS $1361
+135e : 4c 62 14 JMP $1462 ; (nforml + 332)
+1361 : a0 02 __ LDY #$02
+1363 : b1 0d __ LDA (P0),y
+1365 : 85 4f __ STA T5 + 0
+1367 : c9 ff __ CMP #$ff
+1369 : d0 03 __ BNE $136e
+136b : 4c 54 14 JMP $1454 ; (nforml + 318)
+136e : 38 __ __ SEC
+136f : a9 10 __ LDA #$10
+1371 : e5 4f __ SBC T5 + 0
+1373 : 85 4f __ STA T5 + 0
+1375 : c5 4e __ CMP T4 + 0
+1377 : b0 0e __ BCS $1387
+1379 : c6 4e __ DEC T4 + 0
+137b : a9 30 __ LDA #$30
+137d : a4 4e __ LDY T4 + 0
+137f : 91 0f __ STA (P2),y
+1381 : a5 4f __ LDA T5 + 0
+1383 : c5 4e __ CMP T4 + 0
+1385 : 90 f2 __ BCC $1379
+1387 : a0 07 __ LDY #$07
+1389 : b1 0d __ LDA (P0),y
+138b : f0 34 __ BEQ $13c1
+138d : a0 03 __ LDY #$03
+138f : b1 0d __ LDA (P0),y
+1391 : 85 53 __ STA T7 + 0
+1393 : c8 __ __ INY
+1394 : b1 0d __ LDA (P0),y
+1396 : d0 29 __ BNE $13c1
+1398 : a5 53 __ LDA T7 + 0
+139a : c9 10 __ CMP #$10
+139c : d0 23 __ BNE $13c1
+139e : 18 __ __ CLC
+139f : a5 4e __ LDA T4 + 0
+13a1 : 69 ff __ ADC #$ff
+13a3 : 18 __ __ CLC
+13a4 : 65 0f __ ADC P2
+13a6 : 85 53 __ STA T7 + 0
+13a8 : a5 10 __ LDA P3
+13aa : 69 00 __ ADC #$00
+13ac : 85 54 __ STA T7 + 1
+13ae : a9 58 __ LDA #$58
+13b0 : a0 00 __ LDY #$00
+13b2 : 91 53 __ STA (T7 + 0),y
+13b4 : 18 __ __ CLC
+13b5 : a5 4e __ LDA T4 + 0
+13b7 : 69 fe __ ADC #$fe
+13b9 : 85 4e __ STA T4 + 0
+13bb : a9 30 __ LDA #$30
+13bd : a4 4e __ LDY T4 + 0
+13bf : 91 0f __ STA (P2),y
+13c1 : a5 4d __ LDA T3 + 0
+13c3 : f0 03 __ BEQ $13c8
+13c5 : 4c 49 14 JMP $1449 ; (nforml + 307)
+13c8 : a0 05 __ LDY #$05
+13ca : b1 0d __ LDA (P0),y
+13cc : f0 08 __ BEQ $13d6
+13ce : c6 4e __ DEC T4 + 0
+13d0 : a9 2b __ LDA #$2b
+13d2 : a4 4e __ LDY T4 + 0
+13d4 : 91 0f __ STA (P2),y
+13d6 : a0 01 __ LDY #$01
+13d8 : b1 0d __ LDA (P0),y
+13da : 85 53 __ STA T7 + 0
+13dc : 38 __ __ SEC
+13dd : a9 10 __ LDA #$10
+13df : e5 53 __ SBC T7 + 0
+13e1 : 85 53 __ STA T7 + 0
+13e3 : a9 00 __ LDA #$00
+13e5 : e9 00 __ SBC #$00
+13e7 : 49 80 __ EOR #$80
+13e9 : c9 80 __ CMP #$80
+13eb : d0 04 __ BNE $13f1
+13ed : a5 53 __ LDA T7 + 0
+13ef : c5 4e __ CMP T4 + 0
+13f1 : 90 49 __ BCC $143c
+13f3 : a9 00 __ LDA #$00
+13f5 : 85 4d __ STA T3 + 0
+13f7 : a5 4e __ LDA T4 + 0
+13f9 : c9 10 __ CMP #$10
+13fb : 90 20 __ BCC $141d
+13fd : a5 4d __ LDA T3 + 0
+13ff : 85 1b __ STA ACCU + 0
+1401 : a9 00 __ LDA #$00
+1403 : 85 1c __ STA ACCU + 1
+1405 : a0 01 __ LDY #$01
+1407 : b1 23 __ LDA (SP + 0),y
+1409 : 99 53 00 STA $0053,y 
+140c : 88 __ __ DEY
+140d : 10 f8 __ BPL $1407
+140f : 18 __ __ CLC
+1410 : a5 23 __ LDA SP + 0
+1412 : 69 05 __ ADC #$05
+1414 : 85 23 __ STA SP + 0
+1416 : a5 24 __ LDA SP + 1
+1418 : 69 00 __ ADC #$00
+141a : 85 24 __ STA SP + 1
+141c : 60 __ __ RTS
+141d : aa __ __ TAX
+141e : 8a __ __ TXA
+141f : 18 __ __ CLC
+1420 : 65 0f __ ADC P2
+1422 : 85 51 __ STA T6 + 0
+1424 : a5 10 __ LDA P3
+1426 : 69 00 __ ADC #$00
+1428 : 85 52 __ STA T6 + 1
+142a : a0 00 __ LDY #$00
+142c : b1 51 __ LDA (T6 + 0),y
+142e : a4 4d __ LDY T3 + 0
+1430 : 91 0f __ STA (P2),y
+1432 : e6 4d __ INC T3 + 0
+1434 : e8 __ __ INX
+1435 : e0 10 __ CPX #$10
+1437 : 90 e5 __ BCC $141e
+1439 : 4c fd 13 JMP $13fd ; (nforml + 231)
+143c : c6 4e __ DEC T4 + 0
+143e : a0 00 __ LDY #$00
+1440 : b1 0d __ LDA (P0),y
+1442 : a4 4e __ LDY T4 + 0
+1444 : 91 0f __ STA (P2),y
+1446 : 4c d6 13 JMP $13d6 ; (nforml + 192)
+1449 : c6 4e __ DEC T4 + 0
+144b : a9 2d __ LDA #$2d
+144d : a4 4e __ LDY T4 + 0
+144f : 91 0f __ STA (P2),y
+1451 : 4c d6 13 JMP $13d6 ; (nforml + 192)
+1454 : a9 0f __ LDA #$0f
+1456 : 85 4f __ STA T5 + 0
+1458 : c5 4e __ CMP T4 + 0
+145a : b0 03 __ BCS $145f
+145c : 4c 79 13 JMP $1379 ; (nforml + 99)
+145f : 4c 87 13 JMP $1387 ; (nforml + 113)
+1462 : a0 03 __ LDY #$03
+1464 : b1 0d __ LDA (P0),y
+1466 : 85 03 __ STA $03
+1468 : c8 __ __ INY
+1469 : b1 0d __ LDA (P0),y
+146b : 85 04 __ STA $04
+146d : a9 00 __ LDA #$00
+146f : 85 05 __ STA $05
+1471 : 85 06 __ STA $06
+1473 : a5 47 __ LDA T1 + 0
+1475 : 85 1b __ STA ACCU + 0
+1477 : a5 48 __ LDA T1 + 1
+1479 : 85 1c __ STA ACCU + 1
+147b : a5 49 __ LDA T1 + 2
+147d : 85 1d __ STA ACCU + 2
+147f : a5 4a __ LDA T1 + 3
+1481 : 85 1e __ STA ACCU + 3
+1483 : 20 8c 22 JSR $228c ; (divmod32 + 0)
+1486 : a5 08 __ LDA $08
+1488 : 10 54 __ BPL $14de
+148a : 18 __ __ CLC
+148b : a5 07 __ LDA $07
+148d : 69 30 __ ADC #$30
+148f : c6 4e __ DEC T4 + 0
+1491 : a4 4e __ LDY T4 + 0
+1493 : 91 0f __ STA (P2),y
+1495 : a0 03 __ LDY #$03
+1497 : b1 0d __ LDA (P0),y
+1499 : 85 03 __ STA $03
+149b : c8 __ __ INY
+149c : b1 0d __ LDA (P0),y
+149e : 85 04 __ STA $04
+14a0 : a9 00 __ LDA #$00
+14a2 : 85 05 __ STA $05
+14a4 : 85 06 __ STA $06
+14a6 : a5 47 __ LDA T1 + 0
+14a8 : 85 1b __ STA ACCU + 0
+14aa : a5 48 __ LDA T1 + 1
+14ac : 85 1c __ STA ACCU + 1
+14ae : a5 49 __ LDA T1 + 2
+14b0 : 85 1d __ STA ACCU + 2
+14b2 : a5 4a __ LDA T1 + 3
+14b4 : 85 1e __ STA ACCU + 3
+14b6 : 20 8c 22 JSR $228c ; (divmod32 + 0)
+14b9 : a5 1b __ LDA ACCU + 0
+14bb : 85 47 __ STA T1 + 0
+14bd : a5 1c __ LDA ACCU + 1
+14bf : 85 48 __ STA T1 + 1
+14c1 : a5 1d __ LDA ACCU + 2
+14c3 : 85 49 __ STA T1 + 2
+14c5 : a5 1e __ LDA ACCU + 3
+14c7 : 85 4a __ STA T1 + 3
+14c9 : a9 00 __ LDA #$00
+14cb : c5 1e __ CMP ACCU + 3
+14cd : d0 0a __ BNE $14d9
+14cf : c5 1d __ CMP ACCU + 2
+14d1 : d0 06 __ BNE $14d9
+14d3 : c5 1c __ CMP ACCU + 1
+14d5 : d0 02 __ BNE $14d9
+14d7 : c5 1b __ CMP ACCU + 0
+14d9 : 90 87 __ BCC $1462
+14db : 4c 61 13 JMP $1361 ; (nforml + 75)
+14de : d0 06 __ BNE $14e6
+14e0 : a5 07 __ LDA $07
+14e2 : c9 0a __ CMP #$0a
+14e4 : 90 a4 __ BCC $148a
+14e6 : 18 __ __ CLC
+14e7 : a5 07 __ LDA $07
+14e9 : 69 37 __ ADC #$37
+14eb : 4c 8f 14 JMP $148f ; (nforml + 377)
+14ee : a5 14 __ LDA P7
+14f0 : 49 80 __ EOR #$80
+14f2 : c9 80 __ CMP #$80
+14f4 : d0 0f __ BNE $1505
+14f6 : a5 13 __ LDA P6
+14f8 : c9 00 __ CMP #$00
+14fa : d0 09 __ BNE $1505
+14fc : a5 12 __ LDA P5
+14fe : c9 00 __ CMP #$00
+1500 : d0 03 __ BNE $1505
+1502 : 4c 48 13 JMP $1348 ; (nforml + 50)
+1505 : 90 03 __ BCC $150a
+1507 : 4c 48 13 JMP $1348 ; (nforml + 50)
+150a : a9 01 __ LDA #$01
+150c : 85 4d __ STA T3 + 0
+150e : a9 10 __ LDA #$10
+1510 : 85 4e __ STA T4 + 0
+1512 : 38 __ __ SEC
+1513 : a9 00 __ LDA #$00
+1515 : e5 11 __ SBC P4
+1517 : 85 47 __ STA T1 + 0
+1519 : a9 00 __ LDA #$00
+151b : e5 12 __ SBC P5
+151d : 85 48 __ STA T1 + 1
+151f : a9 00 __ LDA #$00
+1521 : e5 13 __ SBC P6
+1523 : 85 49 __ STA T1 + 2
+1525 : a9 00 __ LDA #$00
+1527 : e5 14 __ SBC P7
+1529 : 85 4a __ STA T1 + 3
+152b : a9 00 __ LDA #$00
+152d : c5 4a __ CMP T1 + 3
+152f : d0 0a __ BNE $153b
+1531 : c5 49 __ CMP T1 + 2
+1533 : d0 06 __ BNE $153b
+1535 : c5 48 __ CMP T1 + 1
+1537 : d0 02 __ BNE $153b
+1539 : c5 47 __ CMP T1 + 0
+153b : b0 03 __ BCS $1540
+153d : 4c 62 14 JMP $1462 ; (nforml + 332)
+1540 : 4c 61 13 JMP $1361 ; (nforml + 75)
+--------------------------------------------------------------------
+nformf:
+1543 : 38 __ __ SEC
+1544 : a5 23 __ LDA SP + 0
+1546 : e9 0a __ SBC #$0a
+1548 : 85 23 __ STA SP + 0
+154a : a5 24 __ LDA SP + 1
+154c : e9 00 __ SBC #$00
+154e : 85 24 __ STA SP + 1
+1550 : a0 03 __ LDY #$03
+1552 : b9 53 00 LDA $0053,y 
+1555 : 91 23 __ STA (SP + 0),y
+1557 : 88 __ __ DEY
+1558 : 10 f8 __ BPL $1552
+155a : a9 00 __ LDA #$00
+155c : 85 1b __ STA ACCU + 0
+155e : 85 1c __ STA ACCU + 1
+1560 : 85 1d __ STA ACCU + 2
+1562 : 85 1e __ STA ACCU + 3
+1564 : a5 11 __ LDA P4
+1566 : 85 03 __ STA $03
+1568 : a5 12 __ LDA P5
+156a : 85 04 __ STA $04
+156c : a5 13 __ LDA P6
+156e : 85 05 __ STA $05
+1570 : a5 14 __ LDA P7
+1572 : 85 06 __ STA $06
+1574 : 20 3b 22 JSR $223b ; (fcmp + 0)
+1577 : 10 03 __ BPL $157c
+1579 : 4c a7 1b JMP $1ba7 ; (nformf + 1636)
+157c : a9 00 __ LDA #$00
+157e : 85 4b __ STA T3 + 0
+1580 : a0 05 __ LDY #$05
+1582 : b1 0d __ LDA (P0),y
+1584 : f0 0a __ BEQ $1590
+1586 : a9 2b __ LDA #$2b
+1588 : a0 00 __ LDY #$00
+158a : 91 0f __ STA (P2),y
+158c : a9 01 __ LDA #$01
+158e : 85 4b __ STA T3 + 0
+1590 : a9 00 __ LDA #$00
+1592 : 85 43 __ STA T0 + 0
+1594 : 85 44 __ STA T0 + 1
+1596 : a0 02 __ LDY #$02
+1598 : b1 0d __ LDA (P0),y
+159a : 85 4e __ STA T5 + 0
+159c : c9 ff __ CMP #$ff
+159e : d0 04 __ BNE $15a4
+15a0 : a9 06 __ LDA #$06
+15a2 : 85 4e __ STA T5 + 0
+15a4 : a9 00 __ LDA #$00
+15a6 : 85 1b __ STA ACCU + 0
+15a8 : 85 1c __ STA ACCU + 1
+15aa : 85 1d __ STA ACCU + 2
+15ac : 85 1e __ STA ACCU + 3
+15ae : a5 11 __ LDA P4
+15b0 : 85 03 __ STA $03
+15b2 : a5 12 __ LDA P5
+15b4 : 85 04 __ STA $04
+15b6 : a5 13 __ LDA P6
+15b8 : 85 05 __ STA $05
+15ba : a5 14 __ LDA P7
+15bc : 85 06 __ STA $06
+15be : 20 3b 22 JSR $223b ; (fcmp + 0)
+15c1 : d0 03 __ BNE $15c6
+15c3 : 4c 4a 17 JMP $174a ; (nformf + 519)
+15c6 : a9 00 __ LDA #$00
+15c8 : 85 1b __ STA ACCU + 0
+15ca : 85 1c __ STA ACCU + 1
+15cc : a9 7a __ LDA #$7a
+15ce : 85 1d __ STA ACCU + 2
+15d0 : a9 44 __ LDA #$44
+15d2 : 85 1e __ STA ACCU + 3
+15d4 : a5 11 __ LDA P4
+15d6 : 85 03 __ STA $03
+15d8 : a5 12 __ LDA P5
+15da : 85 04 __ STA $04
+15dc : a5 13 __ LDA P6
+15de : 85 05 __ STA $05
+15e0 : a5 14 __ LDA P7
+15e2 : 85 06 __ STA $06
+15e4 : 20 3b 22 JSR $223b ; (fcmp + 0)
+15e7 : 30 5a __ BMI $1643
+15e9 : a5 11 __ LDA P4
+15eb : 85 1b __ STA ACCU + 0
+15ed : a5 12 __ LDA P5
+15ef : 85 1c __ STA ACCU + 1
+15f1 : a5 13 __ LDA P6
+15f3 : 85 1d __ STA ACCU + 2
+15f5 : a5 14 __ LDA P7
+15f7 : 85 1e __ STA ACCU + 3
+15f9 : a9 00 __ LDA #$00
+15fb : 85 03 __ STA $03
+15fd : 85 04 __ STA $04
+15ff : a9 7a __ LDA #$7a
+1601 : 85 05 __ STA $05
+1603 : a9 44 __ LDA #$44
+1605 : 85 06 __ STA $06
+1607 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+160a : 20 48 20 JSR $2048 ; (fdiv + 0)
+160d : a5 1b __ LDA ACCU + 0
+160f : 85 11 __ STA P4
+1611 : 85 03 __ STA $03
+1613 : a5 1c __ LDA ACCU + 1
+1615 : 85 12 __ STA P5
+1617 : 85 04 __ STA $04
+1619 : a5 1d __ LDA ACCU + 2
+161b : 85 13 __ STA P6
+161d : 85 05 __ STA $05
+161f : a5 1e __ LDA ACCU + 3
+1621 : 85 14 __ STA P7
+1623 : 85 06 __ STA $06
+1625 : 18 __ __ CLC
+1626 : a5 43 __ LDA T0 + 0
+1628 : 69 03 __ ADC #$03
+162a : 85 43 __ STA T0 + 0
+162c : 90 02 __ BCC $1630
+162e : e6 44 __ INC T0 + 1
+1630 : a9 00 __ LDA #$00
+1632 : 85 1b __ STA ACCU + 0
+1634 : 85 1c __ STA ACCU + 1
+1636 : a9 7a __ LDA #$7a
+1638 : 85 1d __ STA ACCU + 2
+163a : a9 44 __ LDA #$44
+163c : 85 1e __ STA ACCU + 3
+163e : 20 3b 22 JSR $223b ; (fcmp + 0)
+1641 : 10 a6 __ BPL $15e9
+1643 : a9 00 __ LDA #$00
+1645 : 85 1b __ STA ACCU + 0
+1647 : 85 1c __ STA ACCU + 1
+1649 : a9 80 __ LDA #$80
+164b : 85 1d __ STA ACCU + 2
+164d : a9 3f __ LDA #$3f
+164f : 85 1e __ STA ACCU + 3
+1651 : a5 11 __ LDA P4
+1653 : 85 03 __ STA $03
+1655 : a5 12 __ LDA P5
+1657 : 85 04 __ STA $04
+1659 : a5 13 __ LDA P6
+165b : 85 05 __ STA $05
+165d : a5 14 __ LDA P7
+165f : 85 06 __ STA $06
+1661 : 20 3b 22 JSR $223b ; (fcmp + 0)
+1664 : 10 5c __ BPL $16c2
+1666 : a5 11 __ LDA P4
+1668 : 85 1b __ STA ACCU + 0
+166a : a5 12 __ LDA P5
+166c : 85 1c __ STA ACCU + 1
+166e : a5 13 __ LDA P6
+1670 : 85 1d __ STA ACCU + 2
+1672 : a5 14 __ LDA P7
+1674 : 85 1e __ STA ACCU + 3
+1676 : a9 00 __ LDA #$00
+1678 : 85 03 __ STA $03
+167a : 85 04 __ STA $04
+167c : a9 7a __ LDA #$7a
+167e : 85 05 __ STA $05
+1680 : a9 44 __ LDA #$44
+1682 : 85 06 __ STA $06
+1684 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1687 : 20 aa 1f JSR $1faa ; (fmul + 0)
+168a : a5 1b __ LDA ACCU + 0
+168c : 85 11 __ STA P4
+168e : 85 03 __ STA $03
+1690 : a5 1c __ LDA ACCU + 1
+1692 : 85 12 __ STA P5
+1694 : 85 04 __ STA $04
+1696 : a5 1d __ LDA ACCU + 2
+1698 : 85 13 __ STA P6
+169a : 85 05 __ STA $05
+169c : a5 1e __ LDA ACCU + 3
+169e : 85 14 __ STA P7
+16a0 : 85 06 __ STA $06
+16a2 : 38 __ __ SEC
+16a3 : a5 43 __ LDA T0 + 0
+16a5 : e9 03 __ SBC #$03
+16a7 : 85 43 __ STA T0 + 0
+16a9 : a5 44 __ LDA T0 + 1
+16ab : e9 00 __ SBC #$00
+16ad : 85 44 __ STA T0 + 1
+16af : a9 00 __ LDA #$00
+16b1 : 85 1b __ STA ACCU + 0
+16b3 : 85 1c __ STA ACCU + 1
+16b5 : a9 80 __ LDA #$80
+16b7 : 85 1d __ STA ACCU + 2
+16b9 : a9 3f __ LDA #$3f
+16bb : 85 1e __ STA ACCU + 3
+16bd : 20 3b 22 JSR $223b ; (fcmp + 0)
+16c0 : 30 a4 __ BMI $1666
+16c2 : a9 00 __ LDA #$00
+16c4 : 85 1b __ STA ACCU + 0
+16c6 : 85 1c __ STA ACCU + 1
+16c8 : a9 20 __ LDA #$20
+16ca : 85 1d __ STA ACCU + 2
+16cc : a9 41 __ LDA #$41
+16ce : 85 1e __ STA ACCU + 3
+16d0 : a5 11 __ LDA P4
+16d2 : 85 03 __ STA $03
+16d4 : a5 12 __ LDA P5
+16d6 : 85 04 __ STA $04
+16d8 : a5 13 __ LDA P6
+16da : 85 05 __ STA $05
+16dc : a5 14 __ LDA P7
+16de : 85 06 __ STA $06
+16e0 : 20 3b 22 JSR $223b ; (fcmp + 0)
+16e3 : 30 65 __ BMI $174a
+16e5 : a5 11 __ LDA P4
+16e7 : 85 1b __ STA ACCU + 0
+16e9 : a5 12 __ LDA P5
+16eb : 85 1c __ STA ACCU + 1
+16ed : a5 13 __ LDA P6
+16ef : 85 1d __ STA ACCU + 2
+16f1 : a5 14 __ LDA P7
+16f3 : 85 1e __ STA ACCU + 3
+16f5 : a9 00 __ LDA #$00
+16f7 : 85 03 __ STA $03
+16f9 : 85 04 __ STA $04
+16fb : a9 20 __ LDA #$20
+16fd : 85 05 __ STA $05
+16ff : a9 41 __ LDA #$41
+1701 : 85 06 __ STA $06
+1703 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1706 : 20 48 20 JSR $2048 ; (fdiv + 0)
+1709 : a5 1b __ LDA ACCU + 0
+170b : 85 11 __ STA P4
+170d : 85 47 __ STA T2 + 0
+170f : a5 1c __ LDA ACCU + 1
+1711 : 85 12 __ STA P5
+1713 : 85 48 __ STA T2 + 1
+1715 : a5 1d __ LDA ACCU + 2
+1717 : 85 13 __ STA P6
+1719 : 85 49 __ STA T2 + 2
+171b : a5 1e __ LDA ACCU + 3
+171d : 85 14 __ STA P7
+171f : 85 4a __ STA T2 + 3
+1721 : e6 43 __ INC T0 + 0
+1723 : d0 02 __ BNE $1727
+1725 : e6 44 __ INC T0 + 1
+1727 : a9 00 __ LDA #$00
+1729 : 85 1b __ STA ACCU + 0
+172b : 85 1c __ STA ACCU + 1
+172d : a9 20 __ LDA #$20
+172f : 85 1d __ STA ACCU + 2
+1731 : a9 41 __ LDA #$41
+1733 : 85 1e __ STA ACCU + 3
+1735 : a5 47 __ LDA T2 + 0
+1737 : 85 03 __ STA $03
+1739 : a5 48 __ LDA T2 + 1
+173b : 85 04 __ STA $04
+173d : a5 49 __ LDA T2 + 2
+173f : 85 05 __ STA $05
+1741 : a5 4a __ LDA T2 + 3
+1743 : 85 06 __ STA $06
+1745 : 20 3b 22 JSR $223b ; (fcmp + 0)
+1748 : 10 9b __ BPL $16e5
+174a : a5 15 __ LDA P8
+174c : c9 65 __ CMP #$65
+174e : d0 03 __ BNE $1753
+1750 : 4c a2 1b JMP $1ba2 ; (nformf + 1631)
+1753 : a9 00 __ LDA #$00
+1755 : 85 51 __ STA T7 + 0
+1757 : 85 52 __ STA T8 + 0
+1759 : a5 4e __ LDA T5 + 0
+175b : 85 4c __ STA T4 + 0
+175d : e6 4c __ INC T4 + 0
+175f : a5 15 __ LDA P8
+1761 : c9 67 __ CMP #$67
+1763 : d0 03 __ BNE $1768
+1765 : 4c 85 1b JMP $1b85 ; (nformf + 1602)
+1768 : a5 51 __ LDA T7 + 0
+176a : f0 03 __ BEQ $176f
+176c : 4c 93 1a JMP $1a93 ; (nformf + 1360)
+176f : a5 44 __ LDA T0 + 1
+1771 : 10 03 __ BPL $1776
+1773 : 4c 52 1a JMP $1a52 ; (nformf + 1295)
+1776 : a9 00 __ LDA #$00
+1778 : 85 47 __ STA T2 + 0
+177a : 85 48 __ STA T2 + 1
+177c : 85 49 __ STA T2 + 2
+177e : a9 3f __ LDA #$3f
+1780 : 85 4a __ STA T2 + 3
+1782 : 18 __ __ CLC
+1783 : a5 4e __ LDA T5 + 0
+1785 : 65 43 __ ADC T0 + 0
+1787 : 85 4c __ STA T4 + 0
+1789 : e6 4c __ INC T4 + 0
+178b : a9 01 __ LDA #$01
+178d : c5 4c __ CMP T4 + 0
+178f : b0 03 __ BCS $1794
+1791 : 4c 11 1a JMP $1a11 ; (nformf + 1230)
+1794 : a5 11 __ LDA P4
+1796 : 85 1b __ STA ACCU + 0
+1798 : a5 12 __ LDA P5
+179a : 85 1c __ STA ACCU + 1
+179c : a5 13 __ LDA P6
+179e : 85 1d __ STA ACCU + 2
+17a0 : a5 14 __ LDA P7
+17a2 : 85 1e __ STA ACCU + 3
+17a4 : a5 47 __ LDA T2 + 0
+17a6 : 85 03 __ STA $03
+17a8 : a5 48 __ LDA T2 + 1
+17aa : 85 04 __ STA $04
+17ac : a5 49 __ LDA T2 + 2
+17ae : 85 05 __ STA $05
+17b0 : a5 4a __ LDA T2 + 3
+17b2 : 85 06 __ STA $06
+17b4 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+17b7 : 20 e2 1e JSR $1ee2 ; (faddsub + 0)
+17ba : a5 1b __ LDA ACCU + 0
+17bc : 85 11 __ STA P4
+17be : 85 47 __ STA T2 + 0
+17c0 : 85 03 __ STA $03
+17c2 : a5 1c __ LDA ACCU + 1
+17c4 : 85 12 __ STA P5
+17c6 : 85 48 __ STA T2 + 1
+17c8 : 85 04 __ STA $04
+17ca : a5 1d __ LDA ACCU + 2
+17cc : 85 13 __ STA P6
+17ce : 85 49 __ STA T2 + 2
+17d0 : 85 05 __ STA $05
+17d2 : a5 1e __ LDA ACCU + 3
+17d4 : 85 14 __ STA P7
+17d6 : 85 4a __ STA T2 + 3
+17d8 : 85 06 __ STA $06
+17da : a9 00 __ LDA #$00
+17dc : 85 1b __ STA ACCU + 0
+17de : 85 1c __ STA ACCU + 1
+17e0 : a9 20 __ LDA #$20
+17e2 : 85 1d __ STA ACCU + 2
+17e4 : a9 41 __ LDA #$41
+17e6 : 85 1e __ STA ACCU + 3
+17e8 : 20 3b 22 JSR $223b ; (fcmp + 0)
+17eb : 30 36 __ BMI $1823
+17ed : a5 47 __ LDA T2 + 0
+17ef : 85 1b __ STA ACCU + 0
+17f1 : a5 48 __ LDA T2 + 1
+17f3 : 85 1c __ STA ACCU + 1
+17f5 : a5 49 __ LDA T2 + 2
+17f7 : 85 1d __ STA ACCU + 2
+17f9 : a5 4a __ LDA T2 + 3
+17fb : 85 1e __ STA ACCU + 3
+17fd : a9 00 __ LDA #$00
+17ff : 85 03 __ STA $03
+1801 : 85 04 __ STA $04
+1803 : a9 20 __ LDA #$20
+1805 : 85 05 __ STA $05
+1807 : a9 41 __ LDA #$41
+1809 : 85 06 __ STA $06
+180b : 20 b1 1e JSR $1eb1 ; (freg + 20)
+180e : 20 48 20 JSR $2048 ; (fdiv + 0)
+1811 : a5 1b __ LDA ACCU + 0
+1813 : 85 11 __ STA P4
+1815 : a5 1c __ LDA ACCU + 1
+1817 : 85 12 __ STA P5
+1819 : a5 1d __ LDA ACCU + 2
+181b : 85 13 __ STA P6
+181d : a5 1e __ LDA ACCU + 3
+181f : 85 14 __ STA P7
+1821 : c6 4e __ DEC T5 + 0
+1823 : 38 __ __ SEC
+1824 : a5 4c __ LDA T4 + 0
+1826 : e5 4e __ SBC T5 + 0
+1828 : 85 53 __ STA T10 + 0
+182a : 85 4e __ STA T5 + 0
+182c : a9 14 __ LDA #$14
+182e : c5 4c __ CMP T4 + 0
+1830 : b0 02 __ BCS $1834
+1832 : 85 4c __ STA T4 + 0
+1834 : a5 53 __ LDA T10 + 0
+1836 : d0 08 __ BNE $1840
+1838 : a9 30 __ LDA #$30
+183a : a4 4b __ LDY T3 + 0
+183c : 91 0f __ STA (P2),y
+183e : e6 4b __ INC T3 + 0
+1840 : a9 00 __ LDA #$00
+1842 : 85 50 __ STA T6 + 0
+1844 : a5 4c __ LDA T4 + 0
+1846 : f0 03 __ BEQ $184b
+1848 : 4c 80 19 JMP $1980 ; (nformf + 1085)
+184b : a5 52 __ LDA T8 + 0
+184d : f0 03 __ BEQ $1852
+184f : 4c 00 19 JMP $1900 ; (nformf + 957)
+1852 : a5 4b __ LDA T3 + 0
+1854 : a0 01 __ LDY #$01
+1856 : d1 0d __ CMP (P0),y
+1858 : 90 1e __ BCC $1878
+185a : 85 1b __ STA ACCU + 0
+185c : a9 00 __ LDA #$00
+185e : 85 1c __ STA ACCU + 1
+1860 : a0 03 __ LDY #$03
+1862 : b1 23 __ LDA (SP + 0),y
+1864 : 99 53 00 STA $0053,y 
+1867 : 88 __ __ DEY
+1868 : 10 f8 __ BPL $1862
+186a : 18 __ __ CLC
+186b : a5 23 __ LDA SP + 0
+186d : 69 0a __ ADC #$0a
+186f : 85 23 __ STA SP + 0
+1871 : a5 24 __ LDA SP + 1
+1873 : 69 00 __ ADC #$00
+1875 : 85 24 __ STA SP + 1
+1877 : 60 __ __ RTS
+1878 : c9 01 __ CMP #$01
+187a : 90 53 __ BCC $18cf
+187c : a9 01 __ LDA #$01
+187e : 85 4e __ STA T5 + 0
+1880 : a5 0d __ LDA P0
+1882 : 85 43 __ STA T0 + 0
+1884 : a5 0e __ LDA P1
+1886 : 85 44 __ STA T0 + 1
+1888 : a5 4b __ LDA T3 + 0
+188a : 85 4c __ STA T4 + 0
+188c : 38 __ __ SEC
+188d : a5 4c __ LDA T4 + 0
+188f : e5 4e __ SBC T5 + 0
+1891 : 85 55 __ STA T11 + 0
+1893 : a9 00 __ LDA #$00
+1895 : e9 00 __ SBC #$00
+1897 : 85 56 __ STA T11 + 1
+1899 : 18 __ __ CLC
+189a : a5 0f __ LDA P2
+189c : 65 55 __ ADC T11 + 0
+189e : 85 55 __ STA T11 + 0
+18a0 : a5 10 __ LDA P3
+18a2 : 65 56 __ ADC T11 + 1
+18a4 : 85 56 __ STA T11 + 1
+18a6 : a0 01 __ LDY #$01
+18a8 : b1 43 __ LDA (T0 + 0),y
+18aa : 38 __ __ SEC
+18ab : e5 4e __ SBC T5 + 0
+18ad : 85 53 __ STA T10 + 0
+18af : a9 00 __ LDA #$00
+18b1 : e9 00 __ SBC #$00
+18b3 : 85 54 __ STA T10 + 1
+18b5 : 18 __ __ CLC
+18b6 : a5 0f __ LDA P2
+18b8 : 65 53 __ ADC T10 + 0
+18ba : 85 53 __ STA T10 + 0
+18bc : a5 10 __ LDA P3
+18be : 65 54 __ ADC T10 + 1
+18c0 : 85 54 __ STA T10 + 1
+18c2 : 88 __ __ DEY
+18c3 : b1 55 __ LDA (T11 + 0),y
+18c5 : 91 53 __ STA (T10 + 0),y
+18c7 : e6 4e __ INC T5 + 0
+18c9 : a5 4b __ LDA T3 + 0
+18cb : c5 4e __ CMP T5 + 0
+18cd : b0 bd __ BCS $188c
+18cf : a9 00 __ LDA #$00
+18d1 : 85 4e __ STA T5 + 0
+18d3 : a0 01 __ LDY #$01
+18d5 : b1 0d __ LDA (P0),y
+18d7 : 85 50 __ STA T6 + 0
+18d9 : 38 __ __ SEC
+18da : e5 4b __ SBC T3 + 0
+18dc : 85 4c __ STA T4 + 0
+18de : a9 00 __ LDA #$00
+18e0 : e9 00 __ SBC #$00
+18e2 : 85 4d __ STA T4 + 1
+18e4 : a9 00 __ LDA #$00
+18e6 : c5 4d __ CMP T4 + 1
+18e8 : d0 04 __ BNE $18ee
+18ea : a5 4e __ LDA T5 + 0
+18ec : c5 4c __ CMP T4 + 0
+18ee : 90 05 __ BCC $18f5
+18f0 : a5 50 __ LDA T6 + 0
+18f2 : 4c 5a 18 JMP $185a ; (nformf + 791)
+18f5 : a9 20 __ LDA #$20
+18f7 : a4 4e __ LDY T5 + 0
+18f9 : 91 0f __ STA (P2),y
+18fb : e6 4e __ INC T5 + 0
+18fd : 4c d3 18 JMP $18d3 ; (nformf + 912)
+1900 : a9 45 __ LDA #$45
+1902 : a4 4b __ LDY T3 + 0
+1904 : 91 0f __ STA (P2),y
+1906 : c8 __ __ INY
+1907 : a5 44 __ LDA T0 + 1
+1909 : 30 5a __ BMI $1965
+190b : a9 2b __ LDA #$2b
+190d : 91 0f __ STA (P2),y
+190f : 18 __ __ CLC
+1910 : a5 4b __ LDA T3 + 0
+1912 : 69 02 __ ADC #$02
+1914 : 85 4b __ STA T3 + 0
+1916 : a5 43 __ LDA T0 + 0
+1918 : 85 1b __ STA ACCU + 0
+191a : a5 44 __ LDA T0 + 1
+191c : 85 1c __ STA ACCU + 1
+191e : a9 0a __ LDA #$0a
+1920 : 85 03 __ STA $03
+1922 : a9 00 __ LDA #$00
+1924 : 85 04 __ STA $04
+1926 : 20 c6 20 JSR $20c6 ; (divs16 + 0)
+1929 : 18 __ __ CLC
+192a : a5 1b __ LDA ACCU + 0
+192c : 69 30 __ ADC #$30
+192e : a4 4b __ LDY T3 + 0
+1930 : 91 0f __ STA (P2),y
+1932 : c8 __ __ INY
+1933 : 98 __ __ TYA
+1934 : 18 __ __ CLC
+1935 : 65 0f __ ADC P2
+1937 : 85 4c __ STA T4 + 0
+1939 : a5 10 __ LDA P3
+193b : 69 00 __ ADC #$00
+193d : 85 4d __ STA T4 + 1
+193f : a5 43 __ LDA T0 + 0
+1941 : 85 1b __ STA ACCU + 0
+1943 : a5 44 __ LDA T0 + 1
+1945 : 85 1c __ STA ACCU + 1
+1947 : a9 0a __ LDA #$0a
+1949 : 85 03 __ STA $03
+194b : a9 00 __ LDA #$00
+194d : 85 04 __ STA $04
+194f : 20 85 21 JSR $2185 ; (mods16 + 0)
+1952 : 18 __ __ CLC
+1953 : a5 05 __ LDA $05
+1955 : 69 30 __ ADC #$30
+1957 : a0 00 __ LDY #$00
+1959 : 91 4c __ STA (T4 + 0),y
+195b : 18 __ __ CLC
+195c : a5 4b __ LDA T3 + 0
+195e : 69 02 __ ADC #$02
+1960 : 85 4b __ STA T3 + 0
+1962 : 4c 52 18 JMP $1852 ; (nformf + 783)
+1965 : a9 2d __ LDA #$2d
+1967 : 91 0f __ STA (P2),y
+1969 : 18 __ __ CLC
+196a : a5 4b __ LDA T3 + 0
+196c : 69 02 __ ADC #$02
+196e : 85 4b __ STA T3 + 0
+1970 : 38 __ __ SEC
+1971 : a9 00 __ LDA #$00
+1973 : e5 43 __ SBC T0 + 0
+1975 : 85 43 __ STA T0 + 0
+1977 : a9 00 __ LDA #$00
+1979 : e5 44 __ SBC T0 + 1
+197b : 85 44 __ STA T0 + 1
+197d : 4c 16 19 JMP $1916 ; (nformf + 979)
+1980 : a5 50 __ LDA T6 + 0
+1982 : c5 4e __ CMP T5 + 0
+1984 : d0 08 __ BNE $198e
+1986 : a9 2e __ LDA #$2e
+1988 : a4 4b __ LDY T3 + 0
+198a : 91 0f __ STA (P2),y
+198c : e6 4b __ INC T3 + 0
+198e : a5 11 __ LDA P4
+1990 : 85 1b __ STA ACCU + 0
+1992 : a5 12 __ LDA P5
+1994 : 85 1c __ STA ACCU + 1
+1996 : a5 13 __ LDA P6
+1998 : 85 1d __ STA ACCU + 2
+199a : a5 14 __ LDA P7
+199c : 85 1e __ STA ACCU + 3
+199e : 20 ae 21 JSR $21ae ; (f32_to_i16 + 0)
+19a1 : a5 1b __ LDA ACCU + 0
+19a3 : 85 53 __ STA T10 + 0
+19a5 : 20 f0 21 JSR $21f0 ; (sint16_to_float + 0)
+19a8 : a5 1b __ LDA ACCU + 0
+19aa : 85 03 __ STA $03
+19ac : a5 1c __ LDA ACCU + 1
+19ae : 85 04 __ STA $04
+19b0 : a5 1d __ LDA ACCU + 2
+19b2 : 85 05 __ STA $05
+19b4 : a5 1e __ LDA ACCU + 3
+19b6 : 85 06 __ STA $06
+19b8 : a5 11 __ LDA P4
+19ba : 85 1b __ STA ACCU + 0
+19bc : a5 12 __ LDA P5
+19be : 85 1c __ STA ACCU + 1
+19c0 : a5 13 __ LDA P6
+19c2 : 85 1d __ STA ACCU + 2
+19c4 : a5 14 __ LDA P7
+19c6 : 85 1e __ STA ACCU + 3
+19c8 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+19cb : a5 06 __ LDA $06
+19cd : 49 80 __ EOR #$80
+19cf : 85 06 __ STA $06
+19d1 : 20 e2 1e JSR $1ee2 ; (faddsub + 0)
+19d4 : a9 00 __ LDA #$00
+19d6 : 85 03 __ STA $03
+19d8 : 85 04 __ STA $04
+19da : a9 20 __ LDA #$20
+19dc : 85 05 __ STA $05
+19de : a9 41 __ LDA #$41
+19e0 : 85 06 __ STA $06
+19e2 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+19e5 : 20 aa 1f JSR $1faa ; (fmul + 0)
+19e8 : a5 1b __ LDA ACCU + 0
+19ea : 85 11 __ STA P4
+19ec : a5 1c __ LDA ACCU + 1
+19ee : 85 12 __ STA P5
+19f0 : a5 1d __ LDA ACCU + 2
+19f2 : 85 13 __ STA P6
+19f4 : a5 1e __ LDA ACCU + 3
+19f6 : 85 14 __ STA P7
+19f8 : 18 __ __ CLC
+19f9 : a5 53 __ LDA T10 + 0
+19fb : 69 30 __ ADC #$30
+19fd : a4 4b __ LDY T3 + 0
+19ff : 91 0f __ STA (P2),y
+1a01 : e6 4b __ INC T3 + 0
+1a03 : e6 50 __ INC T6 + 0
+1a05 : a5 50 __ LDA T6 + 0
+1a07 : c5 4c __ CMP T4 + 0
+1a09 : b0 03 __ BCS $1a0e
+1a0b : 4c 80 19 JMP $1980 ; (nformf + 1085)
+1a0e : 4c 4b 18 JMP $184b ; (nformf + 776)
+1a11 : 85 50 __ STA T6 + 0
+1a13 : a5 47 __ LDA T2 + 0
+1a15 : 85 1b __ STA ACCU + 0
+1a17 : a5 48 __ LDA T2 + 1
+1a19 : 85 1c __ STA ACCU + 1
+1a1b : a5 49 __ LDA T2 + 2
+1a1d : 85 1d __ STA ACCU + 2
+1a1f : a5 4a __ LDA T2 + 3
+1a21 : 85 1e __ STA ACCU + 3
+1a23 : a9 00 __ LDA #$00
+1a25 : 85 03 __ STA $03
+1a27 : 85 04 __ STA $04
+1a29 : a9 20 __ LDA #$20
+1a2b : 85 05 __ STA $05
+1a2d : a9 41 __ LDA #$41
+1a2f : 85 06 __ STA $06
+1a31 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1a34 : 20 48 20 JSR $2048 ; (fdiv + 0)
+1a37 : a5 1b __ LDA ACCU + 0
+1a39 : 85 47 __ STA T2 + 0
+1a3b : a5 1c __ LDA ACCU + 1
+1a3d : 85 48 __ STA T2 + 1
+1a3f : a5 1d __ LDA ACCU + 2
+1a41 : 85 49 __ STA T2 + 2
+1a43 : a5 1e __ LDA ACCU + 3
+1a45 : 85 4a __ STA T2 + 3
+1a47 : e6 50 __ INC T6 + 0
+1a49 : a5 50 __ LDA T6 + 0
+1a4b : c5 4c __ CMP T4 + 0
+1a4d : 90 c4 __ BCC $1a13
+1a4f : 4c 94 17 JMP $1794 ; (nformf + 593)
+1a52 : a5 11 __ LDA P4
+1a54 : 85 1b __ STA ACCU + 0
+1a56 : a5 12 __ LDA P5
+1a58 : 85 1c __ STA ACCU + 1
+1a5a : a5 13 __ LDA P6
+1a5c : 85 1d __ STA ACCU + 2
+1a5e : a5 14 __ LDA P7
+1a60 : 85 1e __ STA ACCU + 3
+1a62 : a9 00 __ LDA #$00
+1a64 : 85 03 __ STA $03
+1a66 : 85 04 __ STA $04
+1a68 : a9 20 __ LDA #$20
+1a6a : 85 05 __ STA $05
+1a6c : a9 41 __ LDA #$41
+1a6e : 85 06 __ STA $06
+1a70 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1a73 : 20 48 20 JSR $2048 ; (fdiv + 0)
+1a76 : a5 1b __ LDA ACCU + 0
+1a78 : 85 11 __ STA P4
+1a7a : a5 1c __ LDA ACCU + 1
+1a7c : 85 12 __ STA P5
+1a7e : a5 1d __ LDA ACCU + 2
+1a80 : 85 13 __ STA P6
+1a82 : a5 1e __ LDA ACCU + 3
+1a84 : 85 14 __ STA P7
+1a86 : e6 43 __ INC T0 + 0
+1a88 : d0 02 __ BNE $1a8c
+1a8a : e6 44 __ INC T0 + 1
+1a8c : a5 44 __ LDA T0 + 1
+1a8e : 30 c2 __ BMI $1a52
+1a90 : 4c 76 17 JMP $1776 ; (nformf + 563)
+1a93 : a9 00 __ LDA #$00
+1a95 : 85 47 __ STA T2 + 0
+1a97 : 85 48 __ STA T2 + 1
+1a99 : 85 49 __ STA T2 + 2
+1a9b : a9 3f __ LDA #$3f
+1a9d : 85 4a __ STA T2 + 3
+1a9f : a5 4e __ LDA T5 + 0
+1aa1 : f0 03 __ BEQ $1aa6
+1aa3 : 4c 42 1b JMP $1b42 ; (nformf + 1535)
+1aa6 : a5 11 __ LDA P4
+1aa8 : 85 1b __ STA ACCU + 0
+1aaa : a5 12 __ LDA P5
+1aac : 85 1c __ STA ACCU + 1
+1aae : a5 13 __ LDA P6
+1ab0 : 85 1d __ STA ACCU + 2
+1ab2 : a5 14 __ LDA P7
+1ab4 : 85 1e __ STA ACCU + 3
+1ab6 : a5 47 __ LDA T2 + 0
+1ab8 : 85 03 __ STA $03
+1aba : a5 48 __ LDA T2 + 1
+1abc : 85 04 __ STA $04
+1abe : a5 49 __ LDA T2 + 2
+1ac0 : 85 05 __ STA $05
+1ac2 : a5 4a __ LDA T2 + 3
+1ac4 : 85 06 __ STA $06
+1ac6 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1ac9 : 20 e2 1e JSR $1ee2 ; (faddsub + 0)
+1acc : a5 1b __ LDA ACCU + 0
+1ace : 85 11 __ STA P4
+1ad0 : 85 47 __ STA T2 + 0
+1ad2 : 85 03 __ STA $03
+1ad4 : a5 1c __ LDA ACCU + 1
+1ad6 : 85 12 __ STA P5
+1ad8 : 85 48 __ STA T2 + 1
+1ada : 85 04 __ STA $04
+1adc : a5 1d __ LDA ACCU + 2
+1ade : 85 13 __ STA P6
+1ae0 : 85 49 __ STA T2 + 2
+1ae2 : 85 05 __ STA $05
+1ae4 : a5 1e __ LDA ACCU + 3
+1ae6 : 85 14 __ STA P7
+1ae8 : 85 4a __ STA T2 + 3
+1aea : 85 06 __ STA $06
+1aec : a9 00 __ LDA #$00
+1aee : 85 1b __ STA ACCU + 0
+1af0 : 85 1c __ STA ACCU + 1
+1af2 : a9 20 __ LDA #$20
+1af4 : 85 1d __ STA ACCU + 2
+1af6 : a9 41 __ LDA #$41
+1af8 : 85 1e __ STA ACCU + 3
+1afa : 20 3b 22 JSR $223b ; (fcmp + 0)
+1afd : 10 03 __ BPL $1b02
+1aff : 4c 23 18 JMP $1823 ; (nformf + 736)
+1b02 : a5 47 __ LDA T2 + 0
+1b04 : 85 1b __ STA ACCU + 0
+1b06 : a5 48 __ LDA T2 + 1
+1b08 : 85 1c __ STA ACCU + 1
+1b0a : a5 49 __ LDA T2 + 2
+1b0c : 85 1d __ STA ACCU + 2
+1b0e : a5 4a __ LDA T2 + 3
+1b10 : 85 1e __ STA ACCU + 3
+1b12 : a9 00 __ LDA #$00
+1b14 : 85 03 __ STA $03
+1b16 : 85 04 __ STA $04
+1b18 : a9 20 __ LDA #$20
+1b1a : 85 05 __ STA $05
+1b1c : a9 41 __ LDA #$41
+1b1e : 85 06 __ STA $06
+1b20 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1b23 : 20 48 20 JSR $2048 ; (fdiv + 0)
+1b26 : a5 1b __ LDA ACCU + 0
+1b28 : 85 11 __ STA P4
+1b2a : a5 1c __ LDA ACCU + 1
+1b2c : 85 12 __ STA P5
+1b2e : a5 1d __ LDA ACCU + 2
+1b30 : 85 13 __ STA P6
+1b32 : a5 1e __ LDA ACCU + 3
+1b34 : 85 14 __ STA P7
+1b36 : e6 43 __ INC T0 + 0
+1b38 : f0 03 __ BEQ $1b3d
+1b3a : 4c 23 18 JMP $1823 ; (nformf + 736)
+1b3d : e6 44 __ INC T0 + 1
+1b3f : 4c 23 18 JMP $1823 ; (nformf + 736)
+1b42 : a9 00 __ LDA #$00
+1b44 : 85 50 __ STA T6 + 0
+1b46 : a5 47 __ LDA T2 + 0
+1b48 : 85 1b __ STA ACCU + 0
+1b4a : a5 48 __ LDA T2 + 1
+1b4c : 85 1c __ STA ACCU + 1
+1b4e : a5 49 __ LDA T2 + 2
+1b50 : 85 1d __ STA ACCU + 2
+1b52 : a5 4a __ LDA T2 + 3
+1b54 : 85 1e __ STA ACCU + 3
+1b56 : a9 00 __ LDA #$00
+1b58 : 85 03 __ STA $03
+1b5a : 85 04 __ STA $04
+1b5c : a9 20 __ LDA #$20
+1b5e : 85 05 __ STA $05
+1b60 : a9 41 __ LDA #$41
+1b62 : 85 06 __ STA $06
+1b64 : 20 b1 1e JSR $1eb1 ; (freg + 20)
+1b67 : 20 48 20 JSR $2048 ; (fdiv + 0)
+1b6a : a5 1b __ LDA ACCU + 0
+1b6c : 85 47 __ STA T2 + 0
+1b6e : a5 1c __ LDA ACCU + 1
+1b70 : 85 48 __ STA T2 + 1
+1b72 : a5 1d __ LDA ACCU + 2
+1b74 : 85 49 __ STA T2 + 2
+1b76 : a5 1e __ LDA ACCU + 3
+1b78 : 85 4a __ STA T2 + 3
+1b7a : e6 50 __ INC T6 + 0
+1b7c : a5 50 __ LDA T6 + 0
+1b7e : c5 4e __ CMP T5 + 0
+1b80 : 90 c4 __ BCC $1b46
+1b82 : 4c a6 1a JMP $1aa6 ; (nformf + 1379)
+1b85 : a5 44 __ LDA T0 + 1
+1b87 : 10 0e __ BPL $1b97
+1b89 : a5 44 __ LDA T0 + 1
+1b8b : 30 03 __ BMI $1b90
+1b8d : 4c 68 17 JMP $1768 ; (nformf + 549)
+1b90 : a9 01 __ LDA #$01
+1b92 : 85 52 __ STA T8 + 0
+1b94 : 4c 93 1a JMP $1a93 ; (nformf + 1360)
+1b97 : d0 f7 __ BNE $1b90
+1b99 : a9 03 __ LDA #$03
+1b9b : c5 43 __ CMP T0 + 0
+1b9d : 90 f1 __ BCC $1b90
+1b9f : 4c 89 1b JMP $1b89 ; (nformf + 1606)
+1ba2 : a9 01 __ LDA #$01
+1ba4 : 4c 55 17 JMP $1755 ; (nformf + 530)
+1ba7 : a5 14 __ LDA P7
+1ba9 : 49 80 __ EOR #$80
+1bab : 85 14 __ STA P7
+1bad : a9 2d __ LDA #$2d
+1baf : a0 00 __ LDY #$00
+1bb1 : 91 0f __ STA (P2),y
+1bb3 : a9 01 __ LDA #$01
+1bb5 : 85 4b __ STA T3 + 0
+1bb7 : 4c 90 15 JMP $1590 ; (nformf + 77)
+--------------------------------------------------------------------
+rand:
+1bbf : ad e5 22 LDA $22e5 ; (seed + 1)
+1bc2 : 4a __ __ LSR
+1bc3 : ad e4 22 LDA $22e4 ; (seed + 0)
+1bc6 : 6a __ __ ROR
+1bc7 : aa __ __ TAX
+1bc8 : a9 00 __ LDA #$00
+1bca : 6a __ __ ROR
+1bcb : 4d e4 22 EOR $22e4 ; (seed + 0)
+1bce : 85 43 __ STA T0 + 0
+1bd0 : 8a __ __ TXA
+1bd1 : 4d e5 22 EOR $22e5 ; (seed + 1)
+1bd4 : 85 44 __ STA T0 + 1
+1bd6 : 4a __ __ LSR
+1bd7 : 45 43 __ EOR T0 + 0
+1bd9 : aa __ __ TAX
+1bda : 85 1b __ STA ACCU + 0
+1bdc : 45 44 __ EOR T0 + 1
+1bde : a8 __ __ TAY
+1bdf : 8e e4 22 STX $22e4 ; (seed + 0)
+1be2 : 98 __ __ TYA
+1be3 : 84 1c __ STY ACCU + 1
+1be5 : 8d e5 22 STA $22e5 ; (seed + 1)
+1be8 : 60 __ __ RTS
+--------------------------------------------------------------------
+qsort:
+1be9 : 38 __ __ SEC
+1bea : a5 23 __ LDA SP + 0
+1bec : e9 12 __ SBC #$12
+1bee : 85 23 __ STA SP + 0
+1bf0 : a5 24 __ LDA SP + 1
+1bf2 : e9 00 __ SBC #$00
+1bf4 : 85 24 __ STA SP + 1
+1bf6 : a0 03 __ LDY #$03
+1bf8 : b9 53 00 LDA $0053,y 
+1bfb : 91 23 __ STA (SP + 0),y
+1bfd : 88 __ __ DEY
+1bfe : 10 f8 __ BPL $1bf8
+1c00 : 38 __ __ SEC
+1c01 : a5 23 __ LDA SP + 0
+1c03 : e9 06 __ SBC #$06
+1c05 : 85 23 __ STA SP + 0
+1c07 : a5 24 __ LDA SP + 1
+1c09 : e9 00 __ SBC #$00
+1c0b : 85 24 __ STA SP + 1
+1c0d : a0 1c __ LDY #$1c
+1c0f : b1 23 __ LDA (SP + 0),y
+1c11 : 85 53 __ STA T0 + 0
+1c13 : c8 __ __ INY
+1c14 : b1 23 __ LDA (SP + 0),y
+1c16 : 85 54 __ STA T0 + 1
+1c18 : 10 25 __ BPL $1c3f
+1c1a : 18 __ __ CLC
+1c1b : a5 23 __ LDA SP + 0
+1c1d : 69 06 __ ADC #$06
+1c1f : 85 23 __ STA SP + 0
+1c21 : a5 24 __ LDA SP + 1
+1c23 : 69 00 __ ADC #$00
+1c25 : 85 24 __ STA SP + 1
+1c27 : a0 03 __ LDY #$03
+1c29 : b1 23 __ LDA (SP + 0),y
+1c2b : 99 53 00 STA $0053,y 
+1c2e : 88 __ __ DEY
+1c2f : 10 f8 __ BPL $1c29
+1c31 : 18 __ __ CLC
+1c32 : a5 23 __ LDA SP + 0
+1c34 : 69 12 __ ADC #$12
+1c36 : 85 23 __ STA SP + 0
+1c38 : a5 24 __ LDA SP + 1
+1c3a : 69 00 __ ADC #$00
+1c3c : 85 24 __ STA SP + 1
+1c3e : 60 __ __ RTS
+1c3f : d0 06 __ BNE $1c47
+1c41 : a9 01 __ LDA #$01
+1c43 : c5 53 __ CMP T0 + 0
+1c45 : b0 d3 __ BCS $1c1a
+1c47 : 18 __ __ CLC
+1c48 : a5 23 __ LDA SP + 0
+1c4a : 69 0a __ ADC #$0a
+1c4c : 85 55 __ STA T2 + 0
+1c4e : a5 24 __ LDA SP + 1
+1c50 : 69 00 __ ADC #$00
+1c52 : 85 56 __ STA T2 + 1
+1c54 : a0 1a __ LDY #$1a
+1c56 : b1 23 __ LDA (SP + 0),y
+1c58 : 85 44 __ STA T3 + 0
+1c5a : c8 __ __ INY
+1c5b : b1 23 __ LDA (SP + 0),y
+1c5d : 85 45 __ STA T3 + 1
+1c5f : a0 0b __ LDY #$0b
+1c61 : b1 44 __ LDA (T3 + 0),y
+1c63 : 91 55 __ STA (T2 + 0),y
+1c65 : 88 __ __ DEY
+1c66 : 10 f9 __ BPL $1c61
+1c68 : a9 00 __ LDA #$00
+1c6a : 85 55 __ STA T2 + 0
+1c6c : 85 56 __ STA T2 + 1
+1c6e : a5 54 __ LDA T0 + 1
+1c70 : 30 03 __ BMI $1c75
+1c72 : 4c 37 1d JMP $1d37 ; (qsort + 334)
+1c75 : a0 1a __ LDY #$1a
+1c77 : b1 23 __ LDA (SP + 0),y
+1c79 : 85 53 __ STA T0 + 0
+1c7b : c8 __ __ INY
+1c7c : b1 23 __ LDA (SP + 0),y
+1c7e : 85 54 __ STA T0 + 1
+1c80 : a5 55 __ LDA T2 + 0
+1c82 : 0a __ __ ASL
+1c83 : aa __ __ TAX
+1c84 : a5 56 __ LDA T2 + 1
+1c86 : 2a __ __ ROL
+1c87 : a8 __ __ TAY
+1c88 : 18 __ __ CLC
+1c89 : 8a __ __ TXA
+1c8a : 65 55 __ ADC T2 + 0
+1c8c : 85 1b __ STA ACCU + 0
+1c8e : 98 __ __ TYA
+1c8f : 65 56 __ ADC T2 + 1
+1c91 : 06 1b __ ASL ACCU + 0
+1c93 : 2a __ __ ROL
+1c94 : 06 1b __ ASL ACCU + 0
+1c96 : 2a __ __ ROL
+1c97 : 85 1c __ STA ACCU + 1
+1c99 : 18 __ __ CLC
+1c9a : a5 53 __ LDA T0 + 0
+1c9c : 65 1b __ ADC ACCU + 0
+1c9e : 85 44 __ STA T3 + 0
+1ca0 : a5 54 __ LDA T0 + 1
+1ca2 : 65 1c __ ADC ACCU + 1
+1ca4 : 85 45 __ STA T3 + 1
+1ca6 : 18 __ __ CLC
+1ca7 : a5 23 __ LDA SP + 0
+1ca9 : 69 0a __ ADC #$0a
+1cab : 85 46 __ STA T4 + 0
+1cad : a5 24 __ LDA SP + 1
+1caf : 69 00 __ ADC #$00
+1cb1 : 85 47 __ STA T4 + 1
+1cb3 : a0 0b __ LDY #$0b
+1cb5 : b1 46 __ LDA (T4 + 0),y
+1cb7 : 91 44 __ STA (T3 + 0),y
+1cb9 : 88 __ __ DEY
+1cba : 10 f9 __ BPL $1cb5
+1cbc : a5 53 __ LDA T0 + 0
+1cbe : a0 02 __ LDY #$02
+1cc0 : 91 23 __ STA (SP + 0),y
+1cc2 : a5 54 __ LDA T0 + 1
+1cc4 : c8 __ __ INY
+1cc5 : 91 23 __ STA (SP + 0),y
+1cc7 : a5 55 __ LDA T2 + 0
+1cc9 : c8 __ __ INY
+1cca : 91 23 __ STA (SP + 0),y
+1ccc : a5 56 __ LDA T2 + 1
+1cce : c8 __ __ INY
+1ccf : 91 23 __ STA (SP + 0),y
+1cd1 : 20 e9 1b JSR $1be9 ; (qsort + 0)
+1cd4 : a0 1a __ LDY #$1a
+1cd6 : b1 23 __ LDA (SP + 0),y
+1cd8 : 85 53 __ STA T0 + 0
+1cda : c8 __ __ INY
+1cdb : b1 23 __ LDA (SP + 0),y
+1cdd : 85 54 __ STA T0 + 1
+1cdf : a5 55 __ LDA T2 + 0
+1ce1 : 0a __ __ ASL
+1ce2 : aa __ __ TAX
+1ce3 : a5 56 __ LDA T2 + 1
+1ce5 : 2a __ __ ROL
+1ce6 : a8 __ __ TAY
+1ce7 : 18 __ __ CLC
+1ce8 : 8a __ __ TXA
+1ce9 : 65 55 __ ADC T2 + 0
+1ceb : 85 1b __ STA ACCU + 0
+1ced : 98 __ __ TYA
+1cee : 65 56 __ ADC T2 + 1
+1cf0 : 06 1b __ ASL ACCU + 0
+1cf2 : 2a __ __ ROL
+1cf3 : 06 1b __ ASL ACCU + 0
+1cf5 : 2a __ __ ROL
+1cf6 : 85 1c __ STA ACCU + 1
+1cf8 : 18 __ __ CLC
+1cf9 : a5 53 __ LDA T0 + 0
+1cfb : 65 1b __ ADC ACCU + 0
+1cfd : aa __ __ TAX
+1cfe : a5 54 __ LDA T0 + 1
+1d00 : 65 1c __ ADC ACCU + 1
+1d02 : 85 54 __ STA T0 + 1
+1d04 : 18 __ __ CLC
+1d05 : 8a __ __ TXA
+1d06 : 69 0c __ ADC #$0c
+1d08 : a0 02 __ LDY #$02
+1d0a : 91 23 __ STA (SP + 0),y
+1d0c : a5 54 __ LDA T0 + 1
+1d0e : 69 00 __ ADC #$00
+1d10 : c8 __ __ INY
+1d11 : 91 23 __ STA (SP + 0),y
+1d13 : a0 1c __ LDY #$1c
+1d15 : b1 23 __ LDA (SP + 0),y
+1d17 : 38 __ __ SEC
+1d18 : e5 55 __ SBC T2 + 0
+1d1a : aa __ __ TAX
+1d1b : c8 __ __ INY
+1d1c : b1 23 __ LDA (SP + 0),y
+1d1e : e5 56 __ SBC T2 + 1
+1d20 : 85 54 __ STA T0 + 1
+1d22 : 38 __ __ SEC
+1d23 : 8a __ __ TXA
+1d24 : e9 01 __ SBC #$01
+1d26 : a0 04 __ LDY #$04
+1d28 : 91 23 __ STA (SP + 0),y
+1d2a : a5 54 __ LDA T0 + 1
+1d2c : e9 00 __ SBC #$00
+1d2e : c8 __ __ INY
+1d2f : 91 23 __ STA (SP + 0),y
+1d31 : 20 e9 1b JSR $1be9 ; (qsort + 0)
+1d34 : 4c 1a 1c JMP $1c1a ; (qsort + 49)
+1d37 : d0 09 __ BNE $1d42
+1d39 : a9 01 __ LDA #$01
+1d3b : c5 53 __ CMP T0 + 0
+1d3d : 90 03 __ BCC $1d42
+1d3f : 4c 75 1c JMP $1c75 ; (qsort + 140)
+1d42 : a9 01 __ LDA #$01
+1d44 : 85 53 __ STA T0 + 0
+1d46 : a9 00 __ LDA #$00
+1d48 : 85 54 __ STA T0 + 1
+1d4a : a0 1a __ LDY #$1a
+1d4c : b1 23 __ LDA (SP + 0),y
+1d4e : 85 44 __ STA T3 + 0
+1d50 : c8 __ __ INY
+1d51 : b1 23 __ LDA (SP + 0),y
+1d53 : 85 45 __ STA T3 + 1
+1d55 : a5 53 __ LDA T0 + 0
+1d57 : 0a __ __ ASL
+1d58 : aa __ __ TAX
+1d59 : a5 54 __ LDA T0 + 1
+1d5b : 2a __ __ ROL
+1d5c : a8 __ __ TAY
+1d5d : 18 __ __ CLC
+1d5e : 8a __ __ TXA
+1d5f : 65 53 __ ADC T0 + 0
+1d61 : 85 1b __ STA ACCU + 0
+1d63 : 98 __ __ TYA
+1d64 : 65 54 __ ADC T0 + 1
+1d66 : 06 1b __ ASL ACCU + 0
+1d68 : 2a __ __ ROL
+1d69 : 06 1b __ ASL ACCU + 0
+1d6b : 2a __ __ ROL
+1d6c : 85 1c __ STA ACCU + 1
+1d6e : 18 __ __ CLC
+1d6f : a5 44 __ LDA T3 + 0
+1d71 : 65 1b __ ADC ACCU + 0
+1d73 : aa __ __ TAX
+1d74 : a5 45 __ LDA T3 + 1
+1d76 : 65 1c __ ADC ACCU + 1
+1d78 : a8 __ __ TAY
+1d79 : 18 __ __ CLC
+1d7a : 8a __ __ TXA
+1d7b : 69 02 __ ADC #$02
+1d7d : 85 0d __ STA P0
+1d7f : 98 __ __ TYA
+1d80 : 69 00 __ ADC #$00
+1d82 : 85 0e __ STA P1
+1d84 : 18 __ __ CLC
+1d85 : a5 23 __ LDA SP + 0
+1d87 : 69 0c __ ADC #$0c
+1d89 : 85 0f __ STA P2
+1d8b : a5 24 __ LDA SP + 1
+1d8d : 69 00 __ ADC #$00
+1d8f : 85 10 __ STA P3
+1d91 : 20 3c 1e JSR $1e3c ; (strcmp + 0)
+1d94 : a5 1c __ LDA ACCU + 1
+1d96 : 30 24 __ BMI $1dbc
+1d98 : a0 1c __ LDY #$1c
+1d9a : b1 23 __ LDA (SP + 0),y
+1d9c : 85 44 __ STA T3 + 0
+1d9e : c8 __ __ INY
+1d9f : b1 23 __ LDA (SP + 0),y
+1da1 : e6 53 __ INC T0 + 0
+1da3 : d0 02 __ BNE $1da7
+1da5 : e6 54 __ INC T0 + 1
+1da7 : 49 80 __ EOR #$80
+1da9 : 85 03 __ STA $03
+1dab : a5 54 __ LDA T0 + 1
+1dad : 49 80 __ EOR #$80
+1daf : c5 03 __ CMP $03
+1db1 : d0 04 __ BNE $1db7
+1db3 : a5 53 __ LDA T0 + 0
+1db5 : c5 44 __ CMP T3 + 0
+1db7 : 90 91 __ BCC $1d4a
+1db9 : 4c 75 1c JMP $1c75 ; (qsort + 140)
+1dbc : a0 1a __ LDY #$1a
+1dbe : b1 23 __ LDA (SP + 0),y
+1dc0 : 85 44 __ STA T3 + 0
+1dc2 : c8 __ __ INY
+1dc3 : b1 23 __ LDA (SP + 0),y
+1dc5 : 85 45 __ STA T3 + 1
+1dc7 : a5 55 __ LDA T2 + 0
+1dc9 : 0a __ __ ASL
+1dca : aa __ __ TAX
+1dcb : a5 56 __ LDA T2 + 1
+1dcd : 2a __ __ ROL
+1dce : a8 __ __ TAY
+1dcf : 18 __ __ CLC
+1dd0 : 8a __ __ TXA
+1dd1 : 65 55 __ ADC T2 + 0
+1dd3 : 85 1b __ STA ACCU + 0
+1dd5 : 98 __ __ TYA
+1dd6 : 65 56 __ ADC T2 + 1
+1dd8 : 06 1b __ ASL ACCU + 0
+1dda : 2a __ __ ROL
+1ddb : 06 1b __ ASL ACCU + 0
+1ddd : 2a __ __ ROL
+1dde : 85 1c __ STA ACCU + 1
+1de0 : 18 __ __ CLC
+1de1 : a5 44 __ LDA T3 + 0
+1de3 : 65 1b __ ADC ACCU + 0
+1de5 : 85 46 __ STA T4 + 0
+1de7 : a5 45 __ LDA T3 + 1
+1de9 : 65 1c __ ADC ACCU + 1
+1deb : 85 47 __ STA T4 + 1
+1ded : a5 53 __ LDA T0 + 0
+1def : 0a __ __ ASL
+1df0 : aa __ __ TAX
+1df1 : a5 54 __ LDA T0 + 1
+1df3 : 2a __ __ ROL
+1df4 : a8 __ __ TAY
+1df5 : 18 __ __ CLC
+1df6 : 8a __ __ TXA
+1df7 : 65 53 __ ADC T0 + 0
+1df9 : 85 1b __ STA ACCU + 0
+1dfb : 98 __ __ TYA
+1dfc : 65 54 __ ADC T0 + 1
+1dfe : 06 1b __ ASL ACCU + 0
+1e00 : 2a __ __ ROL
+1e01 : 06 1b __ ASL ACCU + 0
+1e03 : 2a __ __ ROL
+1e04 : 85 1c __ STA ACCU + 1
+1e06 : 18 __ __ CLC
+1e07 : a5 44 __ LDA T3 + 0
+1e09 : 65 1b __ ADC ACCU + 0
+1e0b : 85 44 __ STA T3 + 0
+1e0d : a5 45 __ LDA T3 + 1
+1e0f : 65 1c __ ADC ACCU + 1
+1e11 : 85 45 __ STA T3 + 1
+1e13 : a0 0b __ LDY #$0b
+1e15 : b1 44 __ LDA (T3 + 0),y
+1e17 : 91 46 __ STA (T4 + 0),y
+1e19 : 88 __ __ DEY
+1e1a : 10 f9 __ BPL $1e15
+1e1c : 18 __ __ CLC
+1e1d : a5 46 __ LDA T4 + 0
+1e1f : 69 0c __ ADC #$0c
+1e21 : 85 46 __ STA T4 + 0
+1e23 : 90 02 __ BCC $1e27
+1e25 : e6 47 __ INC T4 + 1
+1e27 : a0 0b __ LDY #$0b
+1e29 : b1 46 __ LDA (T4 + 0),y
+1e2b : 91 44 __ STA (T3 + 0),y
+1e2d : 88 __ __ DEY
+1e2e : 10 f9 __ BPL $1e29
+1e30 : e6 55 __ INC T2 + 0
+1e32 : f0 03 __ BEQ $1e37
+1e34 : 4c 98 1d JMP $1d98 ; (qsort + 431)
+1e37 : e6 56 __ INC T2 + 1
+1e39 : 4c 98 1d JMP $1d98 ; (qsort + 431)
+--------------------------------------------------------------------
+strcmp:
+1e3c : a0 00 __ LDY #$00
+1e3e : 84 1c __ STY ACCU + 1
+1e40 : b1 0d __ LDA (P0),y
+1e42 : f0 16 __ BEQ $1e5a
+1e44 : d1 0f __ CMP (P2),y
+1e46 : d0 16 __ BNE $1e5e
+1e48 : c8 __ __ INY
+1e49 : b1 0d __ LDA (P0),y
+1e4b : f0 0d __ BEQ $1e5a
+1e4d : d1 0f __ CMP (P2),y
+1e4f : d0 0d __ BNE $1e5e
+1e51 : c8 __ __ INY
+1e52 : d0 ec __ BNE $1e40
+1e54 : e6 0e __ INC P1
+1e56 : e6 10 __ INC P3
+1e58 : d0 e6 __ BNE $1e40
+1e5a : d1 0f __ CMP (P2),y
+1e5c : f0 0a __ BEQ $1e68
+1e5e : b0 06 __ BCS $1e66
+1e60 : a9 ff __ LDA #$ff
+1e62 : 85 1c __ STA ACCU + 1
+1e64 : 30 02 __ BMI $1e68
+1e66 : a9 01 __ LDA #$01
+1e68 : 85 1b __ STA ACCU + 0
+1e6a : 60 __ __ RTS
+--------------------------------------------------------------------
+assert:
+1e6b : a0 02 __ LDY #$02
+1e6d : b1 23 __ LDA (SP + 0),y
+1e6f : d0 09 __ BNE $1e7a
+1e71 : a9 ff __ LDA #$ff
+1e73 : 85 0d __ STA P0
+1e75 : 85 0e __ STA P1
+1e77 : 20 7b 1e JSR $1e7b ; (exit + 0)
+1e7a : 60 __ __ RTS
+--------------------------------------------------------------------
+exit:
+1e7b : a5 0d __ LDA P0
+1e7d : 85 1b __ STA ACCU + 0
+1e7f : a5 0e __ LDA P1
+1e81 : 85 1c __ STA ACCU + 1
+1e83 : ae e3 22 LDX $22e3 ; (spentry + 0)
+1e86 : 9a __ __ TXS
+1e87 : a9 4c __ LDA #$4c
+1e89 : 85 54 __ STA $54
+1e8b : a9 00 __ LDA #$00
+1e8d : 85 13 __ STA P6
+1e8f : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1e90 : a9 4c __ LDA #$4c
+1e92 : 85 54 __ STA $54
+1e94 : a9 00 __ LDA #$00
+1e96 : 85 13 __ STA P6
+1e98 : a9 19 __ LDA #$19
+1e9a : 85 16 __ STA P9
+1e9c : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1e9d : b1 19 __ LDA (IP + 0),y
+1e9f : c8 __ __ INY
+1ea0 : aa __ __ TAX
+1ea1 : b5 00 __ LDA $00,x
+1ea3 : 85 03 __ STA $03
+1ea5 : b5 01 __ LDA $01,x
+1ea7 : 85 04 __ STA $04
+1ea9 : b5 02 __ LDA $02,x
+1eab : 85 05 __ STA $05
+1ead : b5 03 __ LDA $03,x
+1eaf : 85 06 __ STA $06
+1eb1 : a5 05 __ LDA $05
+1eb3 : 0a __ __ ASL
+1eb4 : a5 06 __ LDA $06
+1eb6 : 2a __ __ ROL
+1eb7 : 85 08 __ STA $08
+1eb9 : f0 06 __ BEQ $1ec1
+1ebb : a5 05 __ LDA $05
+1ebd : 09 80 __ ORA #$80
+1ebf : 85 05 __ STA $05
+1ec1 : a5 1d __ LDA ACCU + 2
+1ec3 : 0a __ __ ASL
+1ec4 : a5 1e __ LDA ACCU + 3
+1ec6 : 2a __ __ ROL
+1ec7 : 85 07 __ STA $07
+1ec9 : f0 06 __ BEQ $1ed1
+1ecb : a5 1d __ LDA ACCU + 2
+1ecd : 09 80 __ ORA #$80
+1ecf : 85 1d __ STA ACCU + 2
+1ed1 : 60 __ __ RTS
+1ed2 : 06 1e __ ASL ACCU + 3
+1ed4 : a5 07 __ LDA $07
+1ed6 : 6a __ __ ROR
+1ed7 : 85 1e __ STA ACCU + 3
+1ed9 : b0 06 __ BCS $1ee1
+1edb : a5 1d __ LDA ACCU + 2
+1edd : 29 7f __ AND #$7f
+1edf : 85 1d __ STA ACCU + 2
+1ee1 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1ee2 : 38 __ __ SEC
+1ee3 : a5 07 __ LDA $07
+1ee5 : e5 08 __ SBC $08
+1ee7 : f0 38 __ BEQ $1f21
+1ee9 : aa __ __ TAX
+1eea : b0 25 __ BCS $1f11
+1eec : e0 e9 __ CPX #$e9
+1eee : b0 0e __ BCS $1efe
+1ef0 : a5 08 __ LDA $08
+1ef2 : 85 07 __ STA $07
+1ef4 : a9 00 __ LDA #$00
+1ef6 : 85 1b __ STA ACCU + 0
+1ef8 : 85 1c __ STA ACCU + 1
+1efa : 85 1d __ STA ACCU + 2
+1efc : f0 23 __ BEQ $1f21
+1efe : a5 1d __ LDA ACCU + 2
+1f00 : 4a __ __ LSR
+1f01 : 66 1c __ ROR ACCU + 1
+1f03 : 66 1b __ ROR ACCU + 0
+1f05 : e8 __ __ INX
+1f06 : d0 f8 __ BNE $1f00
+1f08 : 85 1d __ STA ACCU + 2
+1f0a : a5 08 __ LDA $08
+1f0c : 85 07 __ STA $07
+1f0e : 4c 21 1f JMP $1f21 ; (faddsub + 63)
+1f11 : e0 18 __ CPX #$18
+1f13 : b0 33 __ BCS $1f48
+1f15 : a5 05 __ LDA $05
+1f17 : 4a __ __ LSR
+1f18 : 66 04 __ ROR $04
+1f1a : 66 03 __ ROR $03
+1f1c : ca __ __ DEX
+1f1d : d0 f8 __ BNE $1f17
+1f1f : 85 05 __ STA $05
+1f21 : a5 1e __ LDA ACCU + 3
+1f23 : 29 80 __ AND #$80
+1f25 : 85 1e __ STA ACCU + 3
+1f27 : 45 06 __ EOR $06
+1f29 : 30 2d __ BMI $1f58
+1f2b : 18 __ __ CLC
+1f2c : a5 1b __ LDA ACCU + 0
+1f2e : 65 03 __ ADC $03
+1f30 : 85 1b __ STA ACCU + 0
+1f32 : a5 1c __ LDA ACCU + 1
+1f34 : 65 04 __ ADC $04
+1f36 : 85 1c __ STA ACCU + 1
+1f38 : a5 1d __ LDA ACCU + 2
+1f3a : 65 05 __ ADC $05
+1f3c : 85 1d __ STA ACCU + 2
+1f3e : 90 08 __ BCC $1f48
+1f40 : 66 1d __ ROR ACCU + 2
+1f42 : 66 1c __ ROR ACCU + 1
+1f44 : 66 1b __ ROR ACCU + 0
+1f46 : e6 07 __ INC $07
+1f48 : a5 07 __ LDA $07
+1f4a : 4a __ __ LSR
+1f4b : 05 1e __ ORA ACCU + 3
+1f4d : 85 1e __ STA ACCU + 3
+1f4f : b0 06 __ BCS $1f57
+1f51 : a5 1d __ LDA ACCU + 2
+1f53 : 29 7f __ AND #$7f
+1f55 : 85 1d __ STA ACCU + 2
+1f57 : 60 __ __ RTS
+1f58 : 38 __ __ SEC
+1f59 : a5 1b __ LDA ACCU + 0
+1f5b : e5 03 __ SBC $03
+1f5d : 85 1b __ STA ACCU + 0
+1f5f : a5 1c __ LDA ACCU + 1
+1f61 : e5 04 __ SBC $04
+1f63 : 85 1c __ STA ACCU + 1
+1f65 : a5 1d __ LDA ACCU + 2
+1f67 : e5 05 __ SBC $05
+1f69 : 85 1d __ STA ACCU + 2
+1f6b : b0 19 __ BCS $1f86
+1f6d : 38 __ __ SEC
+1f6e : a9 00 __ LDA #$00
+1f70 : e5 1b __ SBC ACCU + 0
+1f72 : 85 1b __ STA ACCU + 0
+1f74 : a9 00 __ LDA #$00
+1f76 : e5 1c __ SBC ACCU + 1
+1f78 : 85 1c __ STA ACCU + 1
+1f7a : a9 00 __ LDA #$00
+1f7c : e5 1d __ SBC ACCU + 2
+1f7e : 85 1d __ STA ACCU + 2
+1f80 : a5 1e __ LDA ACCU + 3
+1f82 : 49 80 __ EOR #$80
+1f84 : 85 1e __ STA ACCU + 3
+1f86 : a5 1d __ LDA ACCU + 2
+1f88 : 30 be __ BMI $1f48
+1f8a : 05 1c __ ORA ACCU + 1
+1f8c : 05 1b __ ORA ACCU + 0
+1f8e : f0 0f __ BEQ $1f9f
+1f90 : c6 07 __ DEC $07
+1f92 : f0 0b __ BEQ $1f9f
+1f94 : 06 1b __ ASL ACCU + 0
+1f96 : 26 1c __ ROL ACCU + 1
+1f98 : 26 1d __ ROL ACCU + 2
+1f9a : 10 f4 __ BPL $1f90
+1f9c : 4c 48 1f JMP $1f48 ; (faddsub + 102)
+1f9f : a9 00 __ LDA #$00
+1fa1 : 85 1b __ STA ACCU + 0
+1fa3 : 85 1c __ STA ACCU + 1
+1fa5 : 85 1d __ STA ACCU + 2
+1fa7 : 85 1e __ STA ACCU + 3
+1fa9 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1faa : a5 1b __ LDA ACCU + 0
+1fac : 05 1c __ ORA ACCU + 1
+1fae : 05 1d __ ORA ACCU + 2
+1fb0 : d0 03 __ BNE $1fb5
+1fb2 : 85 1e __ STA ACCU + 3
+1fb4 : 60 __ __ RTS
+1fb5 : a5 03 __ LDA $03
+1fb7 : 05 04 __ ORA $04
+1fb9 : 05 05 __ ORA $05
+1fbb : d0 09 __ BNE $1fc6
+1fbd : 85 1b __ STA ACCU + 0
+1fbf : 85 1c __ STA ACCU + 1
+1fc1 : 85 1d __ STA ACCU + 2
+1fc3 : 85 1e __ STA ACCU + 3
+1fc5 : 60 __ __ RTS
+1fc6 : a9 00 __ LDA #$00
+1fc8 : 85 09 __ STA $09
+1fca : 85 0a __ STA $0a
+1fcc : 85 0b __ STA $0b
+1fce : a4 1b __ LDY ACCU + 0
+1fd0 : a5 03 __ LDA $03
+1fd2 : d0 06 __ BNE $1fda
+1fd4 : a5 04 __ LDA $04
+1fd6 : f0 0a __ BEQ $1fe2
+1fd8 : d0 05 __ BNE $1fdf
+1fda : 20 1a 20 JSR $201a ; (fmul8 + 0)
+1fdd : a5 04 __ LDA $04
+1fdf : 20 1a 20 JSR $201a ; (fmul8 + 0)
+1fe2 : a5 05 __ LDA $05
+1fe4 : 20 1a 20 JSR $201a ; (fmul8 + 0)
+1fe7 : 38 __ __ SEC
+1fe8 : a5 0b __ LDA $0b
+1fea : 30 06 __ BMI $1ff2
+1fec : 06 09 __ ASL $09
+1fee : 26 0a __ ROL $0a
+1ff0 : 2a __ __ ROL
+1ff1 : 18 __ __ CLC
+1ff2 : 29 7f __ AND #$7f
+1ff4 : 85 0b __ STA $0b
+1ff6 : a5 1e __ LDA ACCU + 3
+1ff8 : 45 06 __ EOR $06
+1ffa : 29 80 __ AND #$80
+1ffc : 85 1e __ STA ACCU + 3
+1ffe : a5 07 __ LDA $07
+2000 : e9 7e __ SBC #$7e
+2002 : 18 __ __ CLC
+2003 : 65 08 __ ADC $08
+2005 : 4a __ __ LSR
+2006 : 05 1e __ ORA ACCU + 3
+2008 : 85 1e __ STA ACCU + 3
+200a : a9 00 __ LDA #$00
+200c : 6a __ __ ROR
+200d : 05 0b __ ORA $0b
+200f : 85 1d __ STA ACCU + 2
+2011 : a5 0a __ LDA $0a
+2013 : 85 1c __ STA ACCU + 1
+2015 : a5 09 __ LDA $09
+2017 : 85 1b __ STA ACCU + 0
+2019 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+201a : 38 __ __ SEC
+201b : 6a __ __ ROR
+201c : 90 1e __ BCC $203c
+201e : aa __ __ TAX
+201f : 18 __ __ CLC
+2020 : 98 __ __ TYA
+2021 : 65 09 __ ADC $09
+2023 : 85 09 __ STA $09
+2025 : a5 0a __ LDA $0a
+2027 : 65 1c __ ADC ACCU + 1
+2029 : 85 0a __ STA $0a
+202b : a5 0b __ LDA $0b
+202d : 65 1d __ ADC ACCU + 2
+202f : 6a __ __ ROR
+2030 : 85 0b __ STA $0b
+2032 : 8a __ __ TXA
+2033 : 66 0a __ ROR $0a
+2035 : 66 09 __ ROR $09
+2037 : 4a __ __ LSR
+2038 : f0 0d __ BEQ $2047
+203a : b0 e2 __ BCS $201e
+203c : 66 0b __ ROR $0b
+203e : 66 0a __ ROR $0a
+2040 : 66 09 __ ROR $09
+2042 : 4a __ __ LSR
+2043 : 90 f7 __ BCC $203c
+2045 : d0 d7 __ BNE $201e
+2047 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+2048 : a5 1b __ LDA ACCU + 0
+204a : 05 1c __ ORA ACCU + 1
+204c : 05 1d __ ORA ACCU + 2
+204e : d0 03 __ BNE $2053
+2050 : 85 1e __ STA ACCU + 3
+2052 : 60 __ __ RTS
+2053 : a5 1e __ LDA ACCU + 3
+2055 : 45 06 __ EOR $06
+2057 : 29 80 __ AND #$80
+2059 : 85 1e __ STA ACCU + 3
+205b : a9 00 __ LDA #$00
+205d : 85 09 __ STA $09
+205f : 85 0a __ STA $0a
+2061 : 85 0b __ STA $0b
+2063 : a2 18 __ LDX #$18
+2065 : a5 1b __ LDA ACCU + 0
+2067 : c5 03 __ CMP $03
+2069 : a5 1c __ LDA ACCU + 1
+206b : e5 04 __ SBC $04
+206d : a5 1d __ LDA ACCU + 2
+206f : e5 05 __ SBC $05
+2071 : 90 13 __ BCC $2086
+2073 : a5 1b __ LDA ACCU + 0
+2075 : e5 03 __ SBC $03
+2077 : 85 1b __ STA ACCU + 0
+2079 : a5 1c __ LDA ACCU + 1
+207b : e5 04 __ SBC $04
+207d : 85 1c __ STA ACCU + 1
+207f : a5 1d __ LDA ACCU + 2
+2081 : e5 05 __ SBC $05
+2083 : 85 1d __ STA ACCU + 2
+2085 : 38 __ __ SEC
+2086 : 26 09 __ ROL $09
+2088 : 26 0a __ ROL $0a
+208a : 26 0b __ ROL $0b
+208c : ca __ __ DEX
+208d : f0 0a __ BEQ $2099
+208f : 06 1b __ ASL ACCU + 0
+2091 : 26 1c __ ROL ACCU + 1
+2093 : 26 1d __ ROL ACCU + 2
+2095 : b0 dc __ BCS $2073
+2097 : 90 cc __ BCC $2065
+2099 : 38 __ __ SEC
+209a : a5 0b __ LDA $0b
+209c : 30 06 __ BMI $20a4
+209e : 06 09 __ ASL $09
+20a0 : 26 0a __ ROL $0a
+20a2 : 2a __ __ ROL
+20a3 : 18 __ __ CLC
+20a4 : 29 7f __ AND #$7f
+20a6 : 85 0b __ STA $0b
+20a8 : a5 08 __ LDA $08
+20aa : 49 7f __ EOR #$7f
+20ac : 65 07 __ ADC $07
+20ae : 38 __ __ SEC
+20af : e9 01 __ SBC #$01
+20b1 : 4a __ __ LSR
+20b2 : 05 1e __ ORA ACCU + 3
+20b4 : 85 1e __ STA ACCU + 3
+20b6 : a9 00 __ LDA #$00
+20b8 : 6a __ __ ROR
+20b9 : 05 0b __ ORA $0b
+20bb : 85 1d __ STA ACCU + 2
+20bd : a5 0a __ LDA $0a
+20bf : 85 1c __ STA ACCU + 1
+20c1 : a5 09 __ LDA $09
+20c3 : 85 1b __ STA ACCU + 0
+20c5 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+20c6 : 24 1c __ BIT ACCU + 1
+20c8 : 10 0d __ BPL $20d7
+20ca : 20 e4 20 JSR $20e4 ; (negaccu + 0)
+20cd : 24 04 __ BIT $04
+20cf : 10 0d __ BPL $20de
+20d1 : 20 f2 20 JSR $20f2 ; (negtmp + 0)
+20d4 : 4c 00 21 JMP $2100 ; (divmod + 0)
+20d7 : 24 04 __ BIT $04
+20d9 : 10 f9 __ BPL $20d4
+20db : 20 f2 20 JSR $20f2 ; (negtmp + 0)
+20de : 20 00 21 JSR $2100 ; (divmod + 0)
+20e1 : 4c e4 20 JMP $20e4 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+20e4 : 38 __ __ SEC
+20e5 : a9 00 __ LDA #$00
+20e7 : e5 1b __ SBC ACCU + 0
+20e9 : 85 1b __ STA ACCU + 0
+20eb : a9 00 __ LDA #$00
+20ed : e5 1c __ SBC ACCU + 1
+20ef : 85 1c __ STA ACCU + 1
+20f1 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+20f2 : 38 __ __ SEC
+20f3 : a9 00 __ LDA #$00
+20f5 : e5 03 __ SBC $03
+20f7 : 85 03 __ STA $03
+20f9 : a9 00 __ LDA #$00
+20fb : e5 04 __ SBC $04
+20fd : 85 04 __ STA $04
+20ff : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+2100 : a5 1c __ LDA ACCU + 1
+2102 : d0 31 __ BNE $2135
+2104 : a5 04 __ LDA $04
+2106 : d0 1e __ BNE $2126
+2108 : 85 06 __ STA $06
+210a : a2 04 __ LDX #$04
+210c : 06 1b __ ASL ACCU + 0
+210e : 2a __ __ ROL
+210f : c5 03 __ CMP $03
+2111 : 90 02 __ BCC $2115
+2113 : e5 03 __ SBC $03
+2115 : 26 1b __ ROL ACCU + 0
+2117 : 2a __ __ ROL
+2118 : c5 03 __ CMP $03
+211a : 90 02 __ BCC $211e
+211c : e5 03 __ SBC $03
+211e : 26 1b __ ROL ACCU + 0
+2120 : ca __ __ DEX
+2121 : d0 eb __ BNE $210e
+2123 : 85 05 __ STA $05
+2125 : 60 __ __ RTS
+2126 : a5 1b __ LDA ACCU + 0
+2128 : 85 05 __ STA $05
+212a : a5 1c __ LDA ACCU + 1
+212c : 85 06 __ STA $06
+212e : a9 00 __ LDA #$00
+2130 : 85 1b __ STA ACCU + 0
+2132 : 85 1c __ STA ACCU + 1
+2134 : 60 __ __ RTS
+2135 : a5 04 __ LDA $04
+2137 : d0 1f __ BNE $2158
+2139 : a5 03 __ LDA $03
+213b : 30 1b __ BMI $2158
+213d : a9 00 __ LDA #$00
+213f : 85 06 __ STA $06
+2141 : a2 10 __ LDX #$10
+2143 : 06 1b __ ASL ACCU + 0
+2145 : 26 1c __ ROL ACCU + 1
+2147 : 2a __ __ ROL
+2148 : c5 03 __ CMP $03
+214a : 90 02 __ BCC $214e
+214c : e5 03 __ SBC $03
+214e : 26 1b __ ROL ACCU + 0
+2150 : 26 1c __ ROL ACCU + 1
+2152 : ca __ __ DEX
+2153 : d0 f2 __ BNE $2147
+2155 : 85 05 __ STA $05
+2157 : 60 __ __ RTS
+2158 : a9 00 __ LDA #$00
+215a : 85 05 __ STA $05
+215c : 85 06 __ STA $06
+215e : 84 02 __ STY $02
+2160 : a0 10 __ LDY #$10
+2162 : 18 __ __ CLC
+2163 : 26 1b __ ROL ACCU + 0
+2165 : 26 1c __ ROL ACCU + 1
+2167 : 26 05 __ ROL $05
+2169 : 26 06 __ ROL $06
+216b : 38 __ __ SEC
+216c : a5 05 __ LDA $05
+216e : e5 03 __ SBC $03
+2170 : aa __ __ TAX
+2171 : a5 06 __ LDA $06
+2173 : e5 04 __ SBC $04
+2175 : 90 04 __ BCC $217b
+2177 : 86 05 __ STX $05
+2179 : 85 06 __ STA $06
+217b : 88 __ __ DEY
+217c : d0 e5 __ BNE $2163
+217e : 26 1b __ ROL ACCU + 0
+2180 : 26 1c __ ROL ACCU + 1
+2182 : a4 02 __ LDY $02
+2184 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2185 : 24 1c __ BIT ACCU + 1
+2187 : 10 0d __ BPL $2196
+2189 : 20 e4 20 JSR $20e4 ; (negaccu + 0)
+218c : 24 04 __ BIT $04
+218e : 10 0d __ BPL $219d
+2190 : 20 f2 20 JSR $20f2 ; (negtmp + 0)
+2193 : 4c 00 21 JMP $2100 ; (divmod + 0)
+2196 : 24 04 __ BIT $04
+2198 : 10 f9 __ BPL $2193
+219a : 20 f2 20 JSR $20f2 ; (negtmp + 0)
+219d : 20 00 21 JSR $2100 ; (divmod + 0)
+21a0 : 38 __ __ SEC
+21a1 : a9 00 __ LDA #$00
+21a3 : e5 05 __ SBC $05
+21a5 : 85 05 __ STA $05
+21a7 : a9 00 __ LDA #$00
+21a9 : e5 06 __ SBC $06
+21ab : 85 06 __ STA $06
+21ad : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+21ae : 20 c1 1e JSR $1ec1 ; (freg + 36)
+21b1 : a5 07 __ LDA $07
+21b3 : c9 7f __ CMP #$7f
+21b5 : b0 07 __ BCS $21be
+21b7 : a9 00 __ LDA #$00
+21b9 : 85 1b __ STA ACCU + 0
+21bb : 85 1c __ STA ACCU + 1
+21bd : 60 __ __ RTS
+21be : 38 __ __ SEC
+21bf : e9 8e __ SBC #$8e
+21c1 : 90 0a __ BCC $21cd
+21c3 : a9 ff __ LDA #$ff
+21c5 : 85 1b __ STA ACCU + 0
+21c7 : a9 7f __ LDA #$7f
+21c9 : 85 1c __ STA ACCU + 1
+21cb : d0 08 __ BNE $21d5
+21cd : aa __ __ TAX
+21ce : 46 1d __ LSR ACCU + 2
+21d0 : 66 1c __ ROR ACCU + 1
+21d2 : e8 __ __ INX
+21d3 : d0 f9 __ BNE $21ce
+21d5 : 24 1e __ BIT ACCU + 3
+21d7 : 10 0e __ BPL $21e7
+21d9 : 38 __ __ SEC
+21da : a9 00 __ LDA #$00
+21dc : e5 1c __ SBC ACCU + 1
+21de : 85 1b __ STA ACCU + 0
+21e0 : a9 00 __ LDA #$00
+21e2 : e5 1d __ SBC ACCU + 2
+21e4 : 85 1c __ STA ACCU + 1
+21e6 : 60 __ __ RTS
+21e7 : a5 1c __ LDA ACCU + 1
+21e9 : 85 1b __ STA ACCU + 0
+21eb : a5 1d __ LDA ACCU + 2
+21ed : 85 1c __ STA ACCU + 1
+21ef : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+21f0 : 24 1c __ BIT ACCU + 1
+21f2 : 30 03 __ BMI $21f7
+21f4 : 4c 0e 22 JMP $220e ; (uint16_to_float + 0)
+21f7 : 38 __ __ SEC
+21f8 : a9 00 __ LDA #$00
+21fa : e5 1b __ SBC ACCU + 0
+21fc : 85 1b __ STA ACCU + 0
+21fe : a9 00 __ LDA #$00
+2200 : e5 1c __ SBC ACCU + 1
+2202 : 85 1c __ STA ACCU + 1
+2204 : 20 0e 22 JSR $220e ; (uint16_to_float + 0)
+2207 : a5 1e __ LDA ACCU + 3
+2209 : 09 80 __ ORA #$80
+220b : 85 1e __ STA ACCU + 3
+220d : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+220e : a5 1b __ LDA ACCU + 0
+2210 : 05 1c __ ORA ACCU + 1
+2212 : d0 05 __ BNE $2219
+2214 : 85 1d __ STA ACCU + 2
+2216 : 85 1e __ STA ACCU + 3
+2218 : 60 __ __ RTS
+2219 : a2 8e __ LDX #$8e
+221b : a5 1c __ LDA ACCU + 1
+221d : 30 06 __ BMI $2225
+221f : ca __ __ DEX
+2220 : 06 1b __ ASL ACCU + 0
+2222 : 2a __ __ ROL
+2223 : 10 fa __ BPL $221f
+2225 : 29 7f __ AND #$7f
+2227 : 85 1d __ STA ACCU + 2
+2229 : a5 1b __ LDA ACCU + 0
+222b : 85 1c __ STA ACCU + 1
+222d : 8a __ __ TXA
+222e : 4a __ __ LSR
+222f : 85 1e __ STA ACCU + 3
+2231 : a9 00 __ LDA #$00
+2233 : 85 1b __ STA ACCU + 0
+2235 : 6a __ __ ROR
+2236 : 05 1d __ ORA ACCU + 2
+2238 : 85 1d __ STA ACCU + 2
+223a : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+223b : a5 1e __ LDA ACCU + 3
+223d : 45 06 __ EOR $06
+223f : 29 80 __ AND #$80
+2241 : f0 1e __ BEQ $2261
+2243 : a5 1e __ LDA ACCU + 3
+2245 : 29 7f __ AND #$7f
+2247 : 05 1d __ ORA ACCU + 2
+2249 : 05 1c __ ORA ACCU + 1
+224b : 05 1b __ ORA ACCU + 0
+224d : d0 0c __ BNE $225b
+224f : a5 06 __ LDA $06
+2251 : 29 7f __ AND #$7f
+2253 : 05 05 __ ORA $05
+2255 : 05 04 __ ORA $04
+2257 : 05 03 __ ORA $03
+2259 : f0 1e __ BEQ $2279
+225b : a5 1e __ LDA ACCU + 3
+225d : 30 23 __ BMI $2282
+225f : 10 28 __ BPL $2289
+2261 : a5 1e __ LDA ACCU + 3
+2263 : c5 06 __ CMP $06
+2265 : d0 15 __ BNE $227c
+2267 : a5 1d __ LDA ACCU + 2
+2269 : c5 05 __ CMP $05
+226b : d0 0f __ BNE $227c
+226d : a5 1c __ LDA ACCU + 1
+226f : c5 04 __ CMP $04
+2271 : d0 09 __ BNE $227c
+2273 : a5 1b __ LDA ACCU + 0
+2275 : c5 03 __ CMP $03
+2277 : d0 03 __ BNE $227c
+2279 : a9 00 __ LDA #$00
+227b : 60 __ __ RTS
+227c : b0 07 __ BCS $2285
+227e : 24 1e __ BIT ACCU + 3
+2280 : 30 07 __ BMI $2289
+2282 : a9 01 __ LDA #$01
+2284 : 60 __ __ RTS
+2285 : 24 1e __ BIT ACCU + 3
+2287 : 30 f9 __ BMI $2282
+2289 : a9 ff __ LDA #$ff
+228b : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+228c : 84 02 __ STY $02
+228e : a9 00 __ LDA #$00
+2290 : 85 07 __ STA $07
+2292 : 85 08 __ STA $08
+2294 : 85 09 __ STA $09
+2296 : 85 0a __ STA $0a
+2298 : a0 20 __ LDY #$20
+229a : 18 __ __ CLC
+229b : 26 1b __ ROL ACCU + 0
+229d : 26 1c __ ROL ACCU + 1
+229f : 26 1d __ ROL ACCU + 2
+22a1 : 26 1e __ ROL ACCU + 3
+22a3 : 26 07 __ ROL $07
+22a5 : 26 08 __ ROL $08
+22a7 : 26 09 __ ROL $09
+22a9 : 26 0a __ ROL $0a
+22ab : a5 07 __ LDA $07
+22ad : c5 03 __ CMP $03
+22af : a5 08 __ LDA $08
+22b1 : e5 04 __ SBC $04
+22b3 : a5 09 __ LDA $09
+22b5 : e5 05 __ SBC $05
+22b7 : a5 0a __ LDA $0a
+22b9 : e5 06 __ SBC $06
+22bb : 90 18 __ BCC $22d5
+22bd : a5 07 __ LDA $07
+22bf : e5 03 __ SBC $03
+22c1 : 85 07 __ STA $07
+22c3 : a5 08 __ LDA $08
+22c5 : e5 04 __ SBC $04
+22c7 : 85 08 __ STA $08
+22c9 : a5 09 __ LDA $09
+22cb : e5 05 __ SBC $05
+22cd : 85 09 __ STA $09
+22cf : a5 0a __ LDA $0a
+22d1 : e5 06 __ SBC $06
+22d3 : 85 0a __ STA $0a
+22d5 : 88 __ __ DEY
+22d6 : d0 c3 __ BNE $229b
+22d8 : 26 1b __ ROL ACCU + 0
+22da : 26 1c __ ROL ACCU + 1
+22dc : 26 1d __ ROL ACCU + 2
+22de : 26 1e __ ROL ACCU + 3
+22e0 : a4 02 __ LDY $02
+22e2 : 60 __ __ RTS
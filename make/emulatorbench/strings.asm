@@ -0,0 +1,1054 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 8a 11 STX $118a ; (spentry + 0)
+0811 : a9 ad __ LDA #$ad
+0813 : 85 19 __ STA IP + 0
+0815 : a9 11 __ LDA #$11
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 13 __ LDA #$13
+081c : e9 11 __ SBC #$11
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 ad __ LDA #$ad
+0832 : e9 ad __ SBC #$ad
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	2, 20
+0a04:	PUSH	#$0002
+0a07:	MOV	T0, #0
+0a0a:	MOV	T1, #0
+0a0d:	MOV	ACCU, #0
+0a10:	MOVB	buffer + 0, ACCU
+0a14:	MOV	T2, #0
+0a17:	LEA	T3, $0c49
+0a1b:	LEA	T4, buffer + 0
+0a1f:	MOV	ACCU, T4
+0a21:	MOV	P0, ACCU
+0a23:	MOV	ACCU, T2
+0a25:	SHL	ACCU, #1
+0a27:	LEA	T5, text + 0
+0a2b:	ADD	T5, ACCU
+0a2d:	MOV	ADDR, T5
+0a2f:	MOV	P2, 0(ADDR)
+0a32:	JSR	strcat + 0
+0a35:	MOV	ACCU, T4
+0a37:	MOV	P0, ACCU
+0a39:	MOV	ACCU, T3
+0a3b:	MOV	P2, ACCU
+0a3d:	JSR	strcat + 0
+0a40:	ADD	T2, #$0001
+0a44:	MOV	ACCU, T2
+0a46:	CMPS	ACCU, #$0011
+0a49:	BGT	$0A1F
+0a4b:	MOV	T2, #0
+0a4e:	MOVUB	ACCU, buffer + 0
+0a52:	BNEF	$0B97
+0a55:	MOV	ACCU, T2
+0a57:	ADD	T0, ACCU
+0a59:	MOV	T2, #0
+0a5c:	MOVUB	ACCU, buffer + 0
+0a60:	BNEF	$0B6F
+0a63:	MOV	ACCU, T2
+0a65:	ADD	T0, ACCU
+0a67:	MOV	T2, #0
+0a6a:	MOV	ACCU, T2
+0a6c:	MUL	ACCU, #16
+0a6f:	LEA	T3, words + 0
+0a73:	ADD	T3, ACCU
+0a75:	MOV	ACCU, T2
+0a77:	MUL	ACCU, #5
+0a7a:	ADD	ACCU, T1
+0a7c:	MOV	ADDR, #17
+0a7f:	MODS	ACCU, ADDR
+0a81:	SHL	ACCU, #1
+0a83:	LEA	T4, text + 0
+0a87:	ADD	T4, ACCU
+0a89:	MOV	ADDR, T4
+0a8b:	MOV	T4, 0(ADDR)
+0a8e:	MOV	ADDR, T3
+0a90:	MOV	ACCU, T4
+0a92:	STRCPY
+0a93:	ADD	T2, #$0001
+0a97:	MOV	ACCU, T2
+0a99:	CMPS	ACCU, #$0010
+0a9c:	BGT	$0A6A
+0a9e:	MOV	T2, #16
+0aa1:	MOV	T3, #1
+0aa4:	MOV	ACCU, T3
+0aa6:	MUL	ACCU, #16
+0aa9:	LEA	T4, words + 0
+0aad:	ADD	T4, ACCU
+0aaf:	LEA	ADDR, 0(FP)
+0ab3:	MOV	ACCU, T4
+0ab5:	STRCPY
+0ab6:	MOV	ACCU, T3
+0ab8:	MOV	T4, ACCU
+0aba:	BLE	$0AFF
+0abc:	MOV	ACCU, T4
+0abe:	ADD	ACCU, #$FFFF
+0ac2:	MOV	T5, ACCU
+0ac4:	MUL	T5, #16
+0ac7:	LEA	ACCU, words + 0
+0acb:	ADD	ACCU, T5
+0acd:	MOV	P0, ACCU
+0acf:	LEA	P2, 0(FP)
+0ad3:	JSR	strcmp + 0
+0ad6:	BLE	$0AFF
+0ad8:	MOV	ACCU, T4
+0ada:	MUL	ACCU, #16
+0add:	LEA	T5, words + 0
+0ae1:	ADD	T5, ACCU
+0ae3:	MOV	ADDR, T5
+0ae5:	MOV	ACCU, T4
+0ae7:	ADD	ACCU, #$FFFF
+0aeb:	MOV	T8, ACCU
+0aed:	MUL	T8, #16
+0af0:	LEA	ACCU, words + 0
+0af4:	ADD	ACCU, T8
+0af6:	STRCPY
+0af7:	ADD	T4, #$FFFF
+0afb:	MOV	ACCU, T4
+0afd:	BGT	$0ABC
+0aff:	MUL	T4, #16
+0b02:	LEAX	ADDR, words + 0 + T4
+0b06:	LEA	ACCU, 0(FP)
+0b0a:	STRCPY
+0b0b:	ADD	T3, #$0001
+0b0f:	MOV	ACCU, T2
+0b11:	CMPS	ACCU, T3
+0b13:	BLT	$0AA4
+0b15:	MOV	T2, #1
+0b18:	MOV	ACCU, T2
+0b1a:	ADD	ACCU, #$FFFF
+0b1e:	MOV	T3, ACCU
+0b20:	MUL	T3, #16
+0b23:	LEA	ACCU, words + 0
+0b27:	ADD	ACCU, T3
+0b29:	MOV	P0, ACCU
+0b2b:	MOV	ACCU, T2
+0b2d:	MUL	ACCU, #16
+0b30:	LEA	T3, words + 0
+0b34:	ADD	ACCU, T3
+0b36:	MOV	P2, ACCU
+0b38:	JSR	strcmp + 0
+0b3b:	BGT	$0B6A
+0b3d:	ADD	T2, #$0001
+0b41:	MOV	ACCU, T2
+0b43:	CMPS	ACCU, #$0010
+0b46:	BGT	$0B18
+0b48:	ADD	T1, #$0001
+0b4c:	MOV	ACCU, T1
+0b4e:	CMPS	ACCU, #$0014
+0b51:	BGTF	$0A0D
+0b54:	MOV	ACCU, T0
+0b56:	CMPU	ACCU, #$071C
+0b59:	BNE	$0B60
+0b5b:	MOV	ACCU, #0
+0b5e:	JUMP	$0B63
+0b60:	MOV	ACCU, #2
+0b63:	POP	#$0002
+0b66:	RETURN	2, 20
+0b6a:	MOV	ACCU, #1
+0b6d:	JUMP	$0B63
+0b6f:	LEA	T3, buffer + 0
+0b73:	MOVB	T6, #111
+0b76:	MOV	ACCU, T3
+0b78:	MOV	T4, ACCU
+0b7a:	MOV	ADDR, T3
+0b7c:	MOVB	T7, 0(ADDR)
+0b7f:	MOVB	ACCU, T6
+0b81:	CMPUB	ACCU, T7
+0b83:	BNE	$0B89
+0b85:	ADD	T2, #$0001
+0b89:	ADD	T3, #$0001
+0b8d:	MOV	ADDR, T4
+0b8f:	MOVUB	ACCU, 1(ADDR)
+0b92:	BNE	$0B76
+0b94:	JUMPF	$0A63
+0b97:	LEA	T3, buffer + 0
+0b9b:	MOV	ACCU, T3
+0b9d:	LEAX	ADDR, T2 + ACCU
+0b9f:	MOVUB	ACCU, 1(ADDR)
+0ba2:	ADD	T2, #$0001
+0ba6:	BNE	$0B9B
+0ba8:	JUMPF	$0A55
+--------------------------------------------------------------------
+strcat:
+0bab : ea __ __ NOP
+0bac : a5 0f __ LDA P2
+0bae : 85 43 __ STA T0 + 0
+0bb0 : a5 10 __ LDA P3
+0bb2 : 85 44 __ STA T0 + 1
+0bb4 : a5 0d __ LDA P0
+0bb6 : 85 45 __ STA T1 + 0
+0bb8 : a5 0e __ LDA P1
+0bba : 85 46 __ STA T1 + 1
+0bbc : a0 00 __ LDY #$00
+0bbe : b1 0d __ LDA (P0),y
+0bc0 : f0 14 __ BEQ $0bd6
+0bc2 : a5 45 __ LDA T1 + 0
+0bc4 : 85 48 __ STA T3 + 0
+0bc6 : a5 46 __ LDA T1 + 1
+0bc8 : 85 49 __ STA T3 + 1
+0bca : e6 45 __ INC T1 + 0
+0bcc : d0 02 __ BNE $0bd0
+0bce : e6 46 __ INC T1 + 1
+0bd0 : a0 01 __ LDY #$01
+0bd2 : b1 48 __ LDA (T3 + 0),y
+0bd4 : d0 ec __ BNE $0bc2
+0bd6 : a0 00 __ LDY #$00
+0bd8 : b1 43 __ LDA (T0 + 0),y
+0bda : aa __ __ TAX
+0bdb : 91 45 __ STA (T1 + 0),y
+0bdd : e6 45 __ INC T1 + 0
+0bdf : d0 02 __ BNE $0be3
+0be1 : e6 46 __ INC T1 + 1
+0be3 : e6 43 __ INC T0 + 0
+0be5 : d0 02 __ BNE $0be9
+0be7 : e6 44 __ INC T0 + 1
+0be9 : 8a __ __ TXA
+0bea : d0 ea __ BNE $0bd6
+0bec : a5 0d __ LDA P0
+0bee : 85 1b __ STA ACCU + 0
+0bf0 : a5 0e __ LDA P1
+0bf2 : 85 1c __ STA ACCU + 1
+0bf4 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0c4b : ea __ __ NOP
+0c4c : a0 00 __ LDY #$00
+0c4e : 84 1c __ STY ACCU + 1
+0c50 : b1 0d __ LDA (P0),y
+0c52 : f0 16 __ BEQ $0c6a
+0c54 : d1 0f __ CMP (P2),y
+0c56 : d0 16 __ BNE $0c6e
+0c58 : c8 __ __ INY
+0c59 : b1 0d __ LDA (P0),y
+0c5b : f0 0d __ BEQ $0c6a
+0c5d : d1 0f __ CMP (P2),y
+0c5f : d0 0d __ BNE $0c6e
+0c61 : c8 __ __ INY
+0c62 : d0 ec __ BNE $0c50
+0c64 : e6 0e __ INC P1
+0c66 : e6 10 __ INC P3
+0c68 : d0 e6 __ BNE $0c50
+0c6a : d1 0f __ CMP (P2),y
+0c6c : f0 0a __ BEQ $0c78
+0c6e : b0 06 __ BCS $0c76
+0c70 : a9 ff __ LDA #$ff
+0c72 : 85 1c __ STA ACCU + 1
+0c74 : 30 02 __ BMI $0c78
+0c76 : a9 01 __ LDA #$01
+0c78 : 85 1b __ STA ACCU + 0
+0c7a : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0c7b : 38 __ __ SEC
+0c7c : a9 00 __ LDA #$00
+0c7e : e5 1b __ SBC ACCU + 0
+0c80 : 85 1b __ STA ACCU + 0
+0c82 : a9 00 __ LDA #$00
+0c84 : e5 1c __ SBC ACCU + 1
+0c86 : 85 1c __ STA ACCU + 1
+0c88 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0c89 : 38 __ __ SEC
+0c8a : a9 00 __ LDA #$00
+0c8c : e5 03 __ SBC $03
+0c8e : 85 03 __ STA $03
+0c90 : a9 00 __ LDA #$00
+0c92 : e5 04 __ SBC $04
+0c94 : 85 04 __ STA $04
+0c96 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0c97 : a5 1c __ LDA ACCU + 1
+0c99 : d0 31 __ BNE $0ccc
+0c9b : a5 04 __ LDA $04
+0c9d : d0 1e __ BNE $0cbd
+0c9f : 85 06 __ STA $06
+0ca1 : a2 04 __ LDX #$04
+0ca3 : 06 1b __ ASL ACCU + 0
+0ca5 : 2a __ __ ROL
+0ca6 : c5 03 __ CMP $03
+0ca8 : 90 02 __ BCC $0cac
+0caa : e5 03 __ SBC $03
+0cac : 26 1b __ ROL ACCU + 0
+0cae : 2a __ __ ROL
+0caf : c5 03 __ CMP $03
+0cb1 : 90 02 __ BCC $0cb5
+0cb3 : e5 03 __ SBC $03
+0cb5 : 26 1b __ ROL ACCU + 0
+0cb7 : ca __ __ DEX
+0cb8 : d0 eb __ BNE $0ca5
+0cba : 85 05 __ STA $05
+0cbc : 60 __ __ RTS
+0cbd : a5 1b __ LDA ACCU + 0
+0cbf : 85 05 __ STA $05
+0cc1 : a5 1c __ LDA ACCU + 1
+0cc3 : 85 06 __ STA $06
+0cc5 : a9 00 __ LDA #$00
+0cc7 : 85 1b __ STA ACCU + 0
+0cc9 : 85 1c __ STA ACCU + 1
+0ccb : 60 __ __ RTS
+0ccc : a5 04 __ LDA $04
+0cce : d0 1f __ BNE $0cef
+0cd0 : a5 03 __ LDA $03
+0cd2 : 30 1b __ BMI $0cef
+0cd4 : a9 00 __ LDA #$00
+0cd6 : 85 06 __ STA $06
+0cd8 : a2 10 __ LDX #$10
+0cda : 06 1b __ ASL ACCU + 0
+0cdc : 26 1c __ ROL ACCU + 1
+0cde : 2a __ __ ROL
+0cdf : c5 03 __ CMP $03
+0ce1 : 90 02 __ BCC $0ce5
+0ce3 : e5 03 __ SBC $03
+0ce5 : 26 1b __ ROL ACCU + 0
+0ce7 : 26 1c __ ROL ACCU + 1
+0ce9 : ca __ __ DEX
+0cea : d0 f2 __ BNE $0cde
+0cec : 85 05 __ STA $05
+0cee : 60 __ __ RTS
+0cef : a9 00 __ LDA #$00
+0cf1 : 85 05 __ STA $05
+0cf3 : 85 06 __ STA $06
+0cf5 : 84 02 __ STY $02
+0cf7 : a0 10 __ LDY #$10
+0cf9 : 18 __ __ CLC
+0cfa : 26 1b __ ROL ACCU + 0
+0cfc : 26 1c __ ROL ACCU + 1
+0cfe : 26 05 __ ROL $05
+0d00 : 26 06 __ ROL $06
+0d02 : 38 __ __ SEC
+0d03 : a5 05 __ LDA $05
+0d05 : e5 03 __ SBC $03
+0d07 : aa __ __ TAX
+0d08 : a5 06 __ LDA $06
+0d0a : e5 04 __ SBC $04
+0d0c : 90 04 __ BCC $0d12
+0d0e : 86 05 __ STX $05
+0d10 : 85 06 __ STA $06
+0d12 : 88 __ __ DEY
+0d13 : d0 e5 __ BNE $0cfa
+0d15 : 26 1b __ ROL ACCU + 0
+0d17 : 26 1c __ ROL ACCU + 1
+0d19 : a4 02 __ LDY $02
+0d1b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0d1c : a9 4c __ LDA #$4c
+0d1e : 85 54 __ STA $54
+0d20 : a9 00 __ LDA #$00
+0d22 : 85 13 __ STA P6
+0d24 : a9 19 __ LDA #$19
+0d26 : 85 16 __ STA P9
+0d28 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+0d29 : b1 19 __ LDA (IP + 0),y
+0d2b : aa __ __ TAX
+0d2c : c8 __ __ INY
+0d2d : b1 19 __ LDA (IP + 0),y
+0d2f : 95 00 __ STA $00,x
+0d31 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+0d34 : b1 19 __ LDA (IP + 0),y
+0d36 : aa __ __ TAX
+0d37 : c8 __ __ INY
+0d38 : b1 19 __ LDA (IP + 0),y
+0d3a : 95 00 __ STA $00,x
+0d3c : a9 00 __ LDA #$00
+0d3e : 95 01 __ STA $01,x
+0d40 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+0d43 : b1 19 __ LDA (IP + 0),y
+0d45 : aa __ __ TAX
+0d46 : b5 00 __ LDA $00,x
+0d48 : 85 1b __ STA ACCU + 0
+0d4a : a9 00 __ LDA #$00
+0d4c : 85 1c __ STA ACCU + 1
+0d4e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+0d51 : b1 19 __ LDA (IP + 0),y
+0d53 : aa __ __ TAX
+0d54 : b5 00 __ LDA $00,x
+0d56 : 85 1b __ STA ACCU + 0
+0d58 : b5 01 __ LDA $01,x
+0d5a : 85 1c __ STA ACCU + 1
+0d5c : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+0d5f : b1 19 __ LDA (IP + 0),y
+0d61 : aa __ __ TAX
+0d62 : a5 1b __ LDA ACCU + 0
+0d64 : 95 00 __ STA $00,x
+0d66 : a5 1c __ LDA ACCU + 1
+0d68 : 95 01 __ STA $01,x
+0d6a : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+0d6d : b1 19 __ LDA (IP + 0),y
+0d6f : aa __ __ TAX
+0d70 : b5 00 __ LDA $00,x
+0d72 : 85 1f __ STA ADDR + 0
+0d74 : b5 01 __ LDA $01,x
+0d76 : 85 20 __ STA ADDR + 1
+0d78 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+0d7b : b1 19 __ LDA (IP + 0),y
+0d7d : 85 1f __ STA ADDR + 0
+0d7f : c8 __ __ INY
+0d80 : b1 19 __ LDA (IP + 0),y
+0d82 : 85 20 __ STA ADDR + 1
+0d84 : c8 __ __ INY
+0d85 : b1 19 __ LDA (IP + 0),y
+0d87 : aa __ __ TAX
+0d88 : 84 02 __ STY $02
+0d8a : a0 00 __ LDY #$00
+0d8c : b1 1f __ LDA (ADDR + 0),y
+0d8e : 95 00 __ STA $00,x
+0d90 : a9 00 __ LDA #$00
+0d92 : 95 01 __ STA $01,x
+0d94 : a4 02 __ LDY $02
+0d96 : 4c 50 08 JMP $0850 ; (startup + 79)
+0d99 : b1 19 __ LDA (IP + 0),y
+0d9b : aa __ __ TAX
+0d9c : c8 __ __ INY
+0d9d : b1 19 __ LDA (IP + 0),y
+0d9f : 84 02 __ STY $02
+0da1 : a8 __ __ TAY
+0da2 : 4c 8c 0d JMP $0d8c ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+0da5 : b1 19 __ LDA (IP + 0),y
+0da7 : 85 1f __ STA ADDR + 0
+0da9 : c8 __ __ INY
+0daa : b1 19 __ LDA (IP + 0),y
+0dac : 85 20 __ STA ADDR + 1
+0dae : c8 __ __ INY
+0daf : b1 19 __ LDA (IP + 0),y
+0db1 : aa __ __ TAX
+0db2 : 84 02 __ STY $02
+0db4 : a0 00 __ LDY #$00
+0db6 : b5 00 __ LDA $00,x
+0db8 : 91 1f __ STA (ADDR + 0),y
+0dba : a4 02 __ LDY $02
+0dbc : 4c 50 08 JMP $0850 ; (startup + 79)
+0dbf : b1 19 __ LDA (IP + 0),y
+0dc1 : aa __ __ TAX
+0dc2 : c8 __ __ INY
+0dc3 : b1 19 __ LDA (IP + 0),y
+0dc5 : 84 02 __ STY $02
+0dc7 : a8 __ __ TAY
+0dc8 : 4c b6 0d JMP $0db6 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+0dcb : b1 19 __ LDA (IP + 0),y
+0dcd : aa __ __ TAX
+0dce : c8 __ __ INY
+0dcf : b1 19 __ LDA (IP + 0),y
+0dd1 : 95 00 __ STA $00,x
+0dd3 : c8 __ __ INY
+0dd4 : b1 19 __ LDA (IP + 0),y
+0dd6 : 95 01 __ STA $01,x
+0dd8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_abs_index:
+0ddb : b1 19 __ LDA (IP + 0),y
+0ddd : aa __ __ TAX
+0dde : c8 __ __ INY
+0ddf : 18 __ __ CLC
+0de0 : b5 00 __ LDA $00,x
+0de2 : 71 19 __ ADC (IP + 0),y
+0de4 : 85 1f __ STA ADDR + 0
+0de6 : c8 __ __ INY
+0de7 : b5 01 __ LDA $01,x
+0de9 : 71 19 __ ADC (IP + 0),y
+0deb : 85 20 __ STA ADDR + 1
+0ded : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+0df0 : b1 19 __ LDA (IP + 0),y
+0df2 : aa __ __ TAX
+0df3 : 18 __ __ CLC
+0df4 : b5 00 __ LDA $00,x
+0df6 : 65 1b __ ADC ACCU + 0
+0df8 : 85 1f __ STA ADDR + 0
+0dfa : b5 01 __ LDA $01,x
+0dfc : 65 1c __ ADC ACCU + 1
+0dfe : 85 20 __ STA ADDR + 1
+0e00 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+0e03 : b1 19 __ LDA (IP + 0),y
+0e05 : aa __ __ TAX
+0e06 : c8 __ __ INY
+0e07 : 18 __ __ CLC
+0e08 : b1 19 __ LDA (IP + 0),y
+0e0a : 65 25 __ ADC FP + 0
+0e0c : 95 00 __ STA $00,x
+0e0e : c8 __ __ INY
+0e0f : b1 19 __ LDA (IP + 0),y
+0e11 : 65 26 __ ADC FP + 1
+0e13 : 95 01 __ STA $01,x
+0e15 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+0e18 : b1 19 __ LDA (IP + 0),y
+0e1a : 85 1f __ STA ADDR + 0
+0e1c : c8 __ __ INY
+0e1d : b1 19 __ LDA (IP + 0),y
+0e1f : 85 20 __ STA ADDR + 1
+0e21 : c8 __ __ INY
+0e22 : b1 19 __ LDA (IP + 0),y
+0e24 : aa __ __ TAX
+0e25 : 84 02 __ STY $02
+0e27 : a0 00 __ LDY #$00
+0e29 : b1 1f __ LDA (ADDR + 0),y
+0e2b : 95 00 __ STA $00,x
+0e2d : a4 02 __ LDY $02
+0e2f : 4c 50 08 JMP $0850 ; (startup + 79)
+0e32 : b1 19 __ LDA (IP + 0),y
+0e34 : aa __ __ TAX
+0e35 : c8 __ __ INY
+0e36 : b1 19 __ LDA (IP + 0),y
+0e38 : 84 02 __ STY $02
+0e3a : a8 __ __ TAY
+0e3b : 4c 29 0e JMP $0e29 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16:
+0e3e : b1 19 __ LDA (IP + 0),y
+0e40 : 85 1f __ STA ADDR + 0
+0e42 : c8 __ __ INY
+0e43 : b1 19 __ LDA (IP + 0),y
+0e45 : 85 20 __ STA ADDR + 1
+0e47 : c8 __ __ INY
+0e48 : b1 19 __ LDA (IP + 0),y
+0e4a : aa __ __ TAX
+0e4b : 84 02 __ STY $02
+0e4d : a0 00 __ LDY #$00
+0e4f : b1 1f __ LDA (ADDR + 0),y
+0e51 : 95 00 __ STA $00,x
+0e53 : c8 __ __ INY
+0e54 : b1 1f __ LDA (ADDR + 0),y
+0e56 : 95 01 __ STA $01,x
+0e58 : a4 02 __ LDY $02
+0e5a : 4c 50 08 JMP $0850 ; (startup + 79)
+0e5d : b1 19 __ LDA (IP + 0),y
+0e5f : aa __ __ TAX
+0e60 : c8 __ __ INY
+0e61 : b1 19 __ LDA (IP + 0),y
+0e63 : 84 02 __ STY $02
+0e65 : a8 __ __ TAY
+0e66 : 4c 4f 0e JMP $0e4f ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+0e69 : b1 19 __ LDA (IP + 0),y
+0e6b : aa __ __ TAX
+0e6c : 18 __ __ CLC
+0e6d : a5 1b __ LDA ACCU + 0
+0e6f : 75 00 __ ADC $00,x
+0e71 : 85 1b __ STA ACCU + 0
+0e73 : a5 1c __ LDA ACCU + 1
+0e75 : 75 01 __ ADC $01,x
+0e77 : 85 1c __ STA ACCU + 1
+0e79 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+0e7c : b1 19 __ LDA (IP + 0),y
+0e7e : aa __ __ TAX
+0e7f : b5 00 __ LDA $00,x
+0e81 : 85 03 __ STA $03
+0e83 : b5 01 __ LDA $01,x
+0e85 : 85 04 __ STA $04
+0e87 : 24 1c __ BIT ACCU + 1
+0e89 : 10 18 __ BPL $0ea3
+0e8b : 20 7b 0c JSR $0c7b ; (negaccu + 0)
+0e8e : 24 04 __ BIT $04
+0e90 : 10 18 __ BPL $0eaa
+0e92 : 20 89 0c JSR $0c89 ; (negtmp + 0)
+0e95 : 20 97 0c JSR $0c97 ; (divmod + 0)
+0e98 : a5 05 __ LDA $05
+0e9a : 85 1b __ STA ACCU + 0
+0e9c : a5 06 __ LDA $06
+0e9e : 85 1c __ STA ACCU + 1
+0ea0 : 4c 50 08 JMP $0850 ; (startup + 79)
+0ea3 : 24 04 __ BIT $04
+0ea5 : 10 ee __ BPL $0e95
+0ea7 : 20 89 0c JSR $0c89 ; (negtmp + 0)
+0eaa : 20 97 0c JSR $0c97 ; (divmod + 0)
+0ead : a5 05 __ LDA $05
+0eaf : 85 1b __ STA ACCU + 0
+0eb1 : a5 06 __ LDA $06
+0eb3 : 85 1c __ STA ACCU + 1
+0eb5 : 20 7b 0c JSR $0c7b ; (negaccu + 0)
+0eb8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+0ebb : b1 19 __ LDA (IP + 0),y
+0ebd : aa __ __ TAX
+0ebe : 18 __ __ CLC
+0ebf : b5 00 __ LDA $00,x
+0ec1 : 65 1b __ ADC ACCU + 0
+0ec3 : 95 00 __ STA $00,x
+0ec5 : b5 01 __ LDA $01,x
+0ec7 : 65 1c __ ADC ACCU + 1
+0ec9 : 95 01 __ STA $01,x
+0ecb : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+0ece : b1 19 __ LDA (IP + 0),y
+0ed0 : c8 __ __ INY
+0ed1 : aa __ __ TAX
+0ed2 : 18 __ __ CLC
+0ed3 : b5 00 __ LDA $00,x
+0ed5 : 71 19 __ ADC (IP + 0),y
+0ed7 : c8 __ __ INY
+0ed8 : 95 00 __ STA $00,x
+0eda : b5 01 __ LDA $01,x
+0edc : 71 19 __ ADC (IP + 0),y
+0ede : 95 01 __ STA $01,x
+0ee0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+0ee3 : b1 19 __ LDA (IP + 0),y
+0ee5 : c8 __ __ INY
+0ee6 : aa __ __ TAX
+0ee7 : a9 00 __ LDA #$00
+0ee9 : 85 05 __ STA $05
+0eeb : 85 06 __ STA $06
+0eed : b5 00 __ LDA $00,x
+0eef : 85 03 __ STA $03
+0ef1 : b5 01 __ LDA $01,x
+0ef3 : 85 04 __ STA $04
+0ef5 : b1 19 __ LDA (IP + 0),y
+0ef7 : 4a __ __ LSR
+0ef8 : 85 07 __ STA $07
+0efa : 90 0d __ BCC $0f09
+0efc : 18 __ __ CLC
+0efd : a5 05 __ LDA $05
+0eff : 65 03 __ ADC $03
+0f01 : 85 05 __ STA $05
+0f03 : a5 06 __ LDA $06
+0f05 : 65 04 __ ADC $04
+0f07 : 85 06 __ STA $06
+0f09 : 06 03 __ ASL $03
+0f0b : 26 04 __ ROL $04
+0f0d : 46 07 __ LSR $07
+0f0f : b0 eb __ BCS $0efc
+0f11 : d0 f6 __ BNE $0f09
+0f13 : a5 05 __ LDA $05
+0f15 : 95 00 __ STA $00,x
+0f17 : a5 06 __ LDA $06
+0f19 : 95 01 __ STA $01,x
+0f1b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+0f1e : b1 19 __ LDA (IP + 0),y
+0f20 : aa __ __ TAX
+0f21 : b5 00 __ LDA $00,x
+0f23 : 2c b1 19 BIT $19b1 
+0f26 : 29 0f __ AND #$0f
+0f28 : f0 0b __ BEQ $0f35
+0f2a : aa __ __ TAX
+0f2b : a5 1c __ LDA ACCU + 1
+0f2d : 06 1b __ ASL ACCU + 0
+0f2f : 2a __ __ ROL
+0f30 : ca __ __ DEX
+0f31 : d0 fa __ BNE $0f2d
+0f33 : 85 1c __ STA ACCU + 1
+0f35 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+0f38 : b1 19 __ LDA (IP + 0),y
+0f3a : aa __ __ TAX
+0f3b : 38 __ __ SEC
+0f3c : b5 01 __ LDA $01,x
+0f3e : e5 1c __ SBC ACCU + 1
+0f40 : f0 11 __ BEQ $0f53
+0f42 : 50 02 __ BVC $0f46
+0f44 : 49 80 __ EOR #$80
+0f46 : 30 2a __ BMI $0f72
+0f48 : 10 33 __ BPL $0f7d
+0f4a : b1 19 __ LDA (IP + 0),y
+0f4c : aa __ __ TAX
+0f4d : b5 01 __ LDA $01,x
+0f4f : c5 1c __ CMP ACCU + 1
+0f51 : d0 28 __ BNE $0f7b
+0f53 : b5 00 __ LDA $00,x
+0f55 : c5 1b __ CMP ACCU + 0
+0f57 : d0 22 __ BNE $0f7b
+0f59 : f0 0e __ BEQ $0f69
+0f5b : b1 19 __ LDA (IP + 0),y
+0f5d : aa __ __ TAX
+0f5e : c8 __ __ INY
+0f5f : b1 19 __ LDA (IP + 0),y
+0f61 : c5 1c __ CMP ACCU + 1
+0f63 : d0 16 __ BNE $0f7b
+0f65 : e4 1b __ CPX ACCU + 0
+0f67 : d0 12 __ BNE $0f7b
+0f69 : a9 00 __ LDA #$00
+0f6b : 85 1b __ STA ACCU + 0
+0f6d : 85 1c __ STA ACCU + 1
+0f6f : 4c 50 08 JMP $0850 ; (startup + 79)
+0f72 : a9 ff __ LDA #$ff
+0f74 : 85 1b __ STA ACCU + 0
+0f76 : 85 1c __ STA ACCU + 1
+0f78 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f7b : 90 f5 __ BCC $0f72
+0f7d : a9 01 __ LDA #$01
+0f7f : 85 1b __ STA ACCU + 0
+0f81 : a9 00 __ LDA #$00
+0f83 : 85 1c __ STA ACCU + 1
+0f85 : 4c 50 08 JMP $0850 ; (startup + 79)
+0f88 : b1 19 __ LDA (IP + 0),y
+0f8a : c8 __ __ INY
+0f8b : aa __ __ TAX
+0f8c : b1 19 __ LDA (IP + 0),y
+0f8e : 38 __ __ SEC
+0f8f : e5 1c __ SBC ACCU + 1
+0f91 : d0 af __ BNE $0f42
+0f93 : e4 1b __ CPX ACCU + 0
+0f95 : d0 e4 __ BNE $0f7b
+0f97 : f0 d0 __ BEQ $0f69
+0f99 : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+0f9a : b1 19 __ LDA (IP + 0),y
+0f9c : aa __ __ TAX
+0f9d : 38 __ __ SEC
+0f9e : b5 00 __ LDA $00,x
+0fa0 : e5 1b __ SBC ACCU + 0
+0fa2 : f0 19 __ BEQ $0fbd
+0fa4 : 50 02 __ BVC $0fa8
+0fa6 : 49 80 __ EOR #$80
+0fa8 : 30 1c __ BMI $0fc6
+0faa : 10 25 __ BPL $0fd1
+0fac : b1 19 __ LDA (IP + 0),y
+0fae : aa __ __ TAX
+0faf : b5 00 __ LDA $00,x
+0fb1 : c5 1b __ CMP ACCU + 0
+0fb3 : d0 1a __ BNE $0fcf
+0fb5 : f0 06 __ BEQ $0fbd
+0fb7 : b1 19 __ LDA (IP + 0),y
+0fb9 : c5 1b __ CMP ACCU + 0
+0fbb : d0 12 __ BNE $0fcf
+0fbd : a9 00 __ LDA #$00
+0fbf : 85 1b __ STA ACCU + 0
+0fc1 : 85 1c __ STA ACCU + 1
+0fc3 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fc6 : a9 ff __ LDA #$ff
+0fc8 : 85 1b __ STA ACCU + 0
+0fca : 85 1c __ STA ACCU + 1
+0fcc : 4c 50 08 JMP $0850 ; (startup + 79)
+0fcf : 90 f5 __ BCC $0fc6
+0fd1 : a9 01 __ LDA #$01
+0fd3 : 85 1b __ STA ACCU + 0
+0fd5 : a9 00 __ LDA #$00
+0fd7 : 85 1c __ STA ACCU + 1
+0fd9 : 4c 50 08 JMP $0850 ; (startup + 79)
+0fdc : b1 19 __ LDA (IP + 0),y
+0fde : 38 __ __ SEC
+0fdf : e5 1b __ SBC ACCU + 0
+0fe1 : d0 c1 __ BNE $0fa4
+0fe3 : f0 d8 __ BEQ $0fbd
+0fe5 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra:
+0fe6 : b1 19 __ LDA (IP + 0),y
+0fe8 : 30 0c __ BMI $0ff6
+0fea : 38 __ __ SEC
+0feb : 65 19 __ ADC IP + 0
+0fed : 85 19 __ STA IP + 0
+0fef : 90 02 __ BCC $0ff3
+0ff1 : e6 1a __ INC IP + 1
+0ff3 : 4c 51 08 JMP $0851 ; (startup + 80)
+0ff6 : 38 __ __ SEC
+0ff7 : 65 19 __ ADC IP + 0
+0ff9 : 85 19 __ STA IP + 0
+0ffb : b0 02 __ BCS $0fff
+0ffd : c6 1a __ DEC IP + 1
+0fff : 4c 51 08 JMP $0851 ; (startup + 80)
+1002 : a5 1b __ LDA ACCU + 0
+1004 : 05 1c __ ORA ACCU + 1
+1006 : f0 de __ BEQ $0fe6
+1008 : 4c 50 08 JMP $0850 ; (startup + 79)
+100b : a5 1b __ LDA ACCU + 0
+100d : 05 1c __ ORA ACCU + 1
+100f : d0 d5 __ BNE $0fe6
+1011 : 4c 50 08 JMP $0850 ; (startup + 79)
+1014 : a5 1c __ LDA ACCU + 1
+1016 : 30 04 __ BMI $101c
+1018 : 05 1b __ ORA ACCU + 0
+101a : d0 ca __ BNE $0fe6
+101c : 4c 50 08 JMP $0850 ; (startup + 79)
+101f : a5 1c __ LDA ACCU + 1
+1021 : 10 c3 __ BPL $0fe6
+1023 : 4c 50 08 JMP $0850 ; (startup + 79)
+1026 : a5 1c __ LDA ACCU + 1
+1028 : 30 bc __ BMI $0fe6
+102a : 4c 50 08 JMP $0850 ; (startup + 79)
+102d : a5 1c __ LDA ACCU + 1
+102f : 30 b5 __ BMI $0fe6
+1031 : 05 1b __ ORA ACCU + 0
+1033 : f0 b1 __ BEQ $0fe6
+1035 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+1038 : 38 __ __ SEC
+1039 : b1 19 __ LDA (IP + 0),y
+103b : 65 19 __ ADC IP + 0
+103d : aa __ __ TAX
+103e : c8 __ __ INY
+103f : b1 19 __ LDA (IP + 0),y
+1041 : 65 1a __ ADC IP + 1
+1043 : 85 1a __ STA IP + 1
+1045 : 86 19 __ STX IP + 0
+1047 : 4c 51 08 JMP $0851 ; (startup + 80)
+104a : a5 1b __ LDA ACCU + 0
+104c : 05 1c __ ORA ACCU + 1
+104e : f0 e8 __ BEQ $1038
+1050 : c8 __ __ INY
+1051 : 4c 50 08 JMP $0850 ; (startup + 79)
+1054 : a5 1b __ LDA ACCU + 0
+1056 : 05 1c __ ORA ACCU + 1
+1058 : d0 de __ BNE $1038
+105a : c8 __ __ INY
+105b : 4c 50 08 JMP $0850 ; (startup + 79)
+105e : a5 1c __ LDA ACCU + 1
+1060 : 30 04 __ BMI $1066
+1062 : 05 1b __ ORA ACCU + 0
+1064 : d0 d2 __ BNE $1038
+1066 : c8 __ __ INY
+1067 : 4c 50 08 JMP $0850 ; (startup + 79)
+106a : a5 1c __ LDA ACCU + 1
+106c : 10 ca __ BPL $1038
+106e : c8 __ __ INY
+106f : 4c 50 08 JMP $0850 ; (startup + 79)
+1072 : a5 1c __ LDA ACCU + 1
+1074 : 30 c2 __ BMI $1038
+1076 : c8 __ __ INY
+1077 : 4c 50 08 JMP $0850 ; (startup + 79)
+107a : a5 1c __ LDA ACCU + 1
+107c : 30 ba __ BMI $1038
+107e : 05 1b __ ORA ACCU + 0
+1080 : f0 b6 __ BEQ $1038
+1082 : c8 __ __ INY
+1083 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_jsr:
+1086 : b1 19 __ LDA (IP + 0),y
+1088 : 8d 9c 10 STA $109c ; (inp_jsr + 22)
+108b : c8 __ __ INY
+108c : b1 19 __ LDA (IP + 0),y
+108e : 8d 9d 10 STA $109d ; (inp_jsr + 23)
+1091 : 98 __ __ TYA
+1092 : 38 __ __ SEC
+1093 : 65 19 __ ADC IP + 0
+1095 : 85 19 __ STA IP + 0
+1097 : 90 02 __ BCC $109b
+1099 : e6 1a __ INC IP + 1
+109b : 20 00 00 JSR $0000 
+109e : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+10a1 : 98 __ __ TYA
+10a2 : 18 __ __ CLC
+10a3 : 65 19 __ ADC IP + 0
+10a5 : 8d b0 10 STA $10b0 ; (inp_native + 15)
+10a8 : a5 1a __ LDA IP + 1
+10aa : 69 00 __ ADC #$00
+10ac : 8d b1 10 STA $10b1 ; (inp_native + 16)
+10af : 20 00 00 JSR $0000 
+10b2 : a0 00 __ LDY #$00
+10b4 : b1 23 __ LDA (SP + 0),y
+10b6 : 85 19 __ STA IP + 0
+10b8 : c8 __ __ INY
+10b9 : b1 23 __ LDA (SP + 0),y
+10bb : 85 1a __ STA IP + 1
+10bd : 88 __ __ DEY
+10be : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+10c1 : 38 __ __ SEC
+10c2 : a5 23 __ LDA SP + 0
+10c4 : f1 19 __ SBC (IP + 0),y
+10c6 : c8 __ __ INY
+10c7 : 85 23 __ STA SP + 0
+10c9 : a5 24 __ LDA SP + 1
+10cb : f1 19 __ SBC (IP + 0),y
+10cd : c8 __ __ INY
+10ce : 85 24 __ STA SP + 1
+10d0 : b1 19 __ LDA (IP + 0),y
+10d2 : 84 02 __ STY $02
+10d4 : a8 __ __ TAY
+10d5 : a5 25 __ LDA FP + 0
+10d7 : 91 23 __ STA (SP + 0),y
+10d9 : c8 __ __ INY
+10da : a5 26 __ LDA FP + 1
+10dc : 91 23 __ STA (SP + 0),y
+10de : 98 __ __ TYA
+10df : 38 __ __ SEC
+10e0 : 65 23 __ ADC SP + 0
+10e2 : 85 25 __ STA FP + 0
+10e4 : a9 00 __ LDA #$00
+10e6 : 65 24 __ ADC SP + 1
+10e8 : 85 26 __ STA FP + 1
+10ea : 88 __ __ DEY
+10eb : f0 08 __ BEQ $10f5
+10ed : b9 52 00 LDA $0052,y 
+10f0 : 88 __ __ DEY
+10f1 : 91 23 __ STA (SP + 0),y
+10f3 : d0 f8 __ BNE $10ed
+10f5 : a4 02 __ LDY $02
+10f7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+10fa : b1 19 __ LDA (IP + 0),y
+10fc : c8 __ __ INY
+10fd : 84 02 __ STY $02
+10ff : a8 __ __ TAY
+1100 : b1 23 __ LDA (SP + 0),y
+1102 : 85 25 __ STA FP + 0
+1104 : c8 __ __ INY
+1105 : b1 23 __ LDA (SP + 0),y
+1107 : 85 26 __ STA FP + 1
+1109 : 88 __ __ DEY
+110a : f0 09 __ BEQ $1115
+110c : 88 __ __ DEY
+110d : b1 23 __ LDA (SP + 0),y
+110f : 99 53 00 STA $0053,y 
+1112 : 88 __ __ DEY
+1113 : 10 f8 __ BPL $110d
+1115 : a4 02 __ LDY $02
+1117 : 18 __ __ CLC
+1118 : b1 19 __ LDA (IP + 0),y
+111a : c8 __ __ INY
+111b : 65 23 __ ADC SP + 0
+111d : 85 23 __ STA SP + 0
+111f : b1 19 __ LDA (IP + 0),y
+1121 : c8 __ __ INY
+1122 : 65 24 __ ADC SP + 1
+1124 : 85 24 __ STA SP + 1
+1126 : a0 01 __ LDY #$01
+1128 : b1 23 __ LDA (SP + 0),y
+112a : 85 1a __ STA IP + 1
+112c : 88 __ __ DEY
+112d : b1 23 __ LDA (SP + 0),y
+112f : 85 19 __ STA IP + 0
+1131 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+1134 : b1 19 __ LDA (IP + 0),y
+1136 : 85 1f __ STA ADDR + 0
+1138 : c8 __ __ INY
+1139 : b1 19 __ LDA (IP + 0),y
+113b : 85 20 __ STA ADDR + 1
+113d : c8 __ __ INY
+113e : 98 __ __ TYA
+113f : a0 00 __ LDY #$00
+1141 : 18 __ __ CLC
+1142 : 65 19 __ ADC IP + 0
+1144 : 91 23 __ STA (SP + 0),y
+1146 : c8 __ __ INY
+1147 : a5 1a __ LDA IP + 1
+1149 : 69 00 __ ADC #$00
+114b : 91 23 __ STA (SP + 0),y
+114d : a5 1f __ LDA ADDR + 0
+114f : 85 19 __ STA IP + 0
+1151 : a5 20 __ LDA ADDR + 1
+1153 : 85 1a __ STA IP + 1
+1155 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+1158 : 38 __ __ SEC
+1159 : a5 23 __ LDA SP + 0
+115b : f1 19 __ SBC (IP + 0),y
+115d : c8 __ __ INY
+115e : 85 23 __ STA SP + 0
+1160 : a5 24 __ LDA SP + 1
+1162 : f1 19 __ SBC (IP + 0),y
+1164 : 85 24 __ STA SP + 1
+1166 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+1169 : 18 __ __ CLC
+116a : b1 19 __ LDA (IP + 0),y
+116c : c8 __ __ INY
+116d : 65 23 __ ADC SP + 0
+116f : 85 23 __ STA SP + 0
+1171 : b1 19 __ LDA (IP + 0),y
+1173 : 65 24 __ ADC SP + 1
+1175 : 85 24 __ STA SP + 1
+1177 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_strcpy:
+117a : 84 02 __ STY $02
+117c : a0 ff __ LDY #$ff
+117e : c8 __ __ INY
+117f : b1 1b __ LDA (ACCU + 0),y
+1181 : 91 1f __ STA (ADDR + 0),y
+1183 : d0 f9 __ BNE $117e
+1185 : a4 02 __ LDY $02
+1187 : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -0,0 +1,701 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 14 0e STX $0e14 ; (spentry + 0)
+0811 : a9 37 __ LDA #$37
+0813 : 85 19 __ STA IP + 0
+0815 : a9 0e __ LDA #$0e
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 10 __ LDA #$10
+081c : e9 0e __ SBC #$0e
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 37 __ LDA #$37
+0832 : e9 37 __ SBC #$37
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 3d 0d JMP $0d3d ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a0 01 __ LDY #$01
+090f : b9 53 00 LDA $0053,y 
+0912 : 91 23 __ STA (SP + 0),y
+0914 : 88 __ __ DEY
+0915 : 10 f8 __ BPL $090f
+0917 : a9 00 __ LDA #$00
+0919 : 85 4a __ STA T0 + 0
+091b : 85 4b __ STA T0 + 1
+091d : 85 4c __ STA T1 + 0
+091f : 85 4d __ STA T1 + 1
+0921 : a9 00 __ LDA #$00
+0923 : 8d 37 0e STA $0e37 ; (buffer + 0)
+0926 : 85 4e __ STA T2 + 0
+0928 : 85 4f __ STA T2 + 1
+092a : a9 37 __ LDA #$37
+092c : 85 0d __ STA P0
+092e : a9 0e __ LDA #$0e
+0930 : 85 0e __ STA P1
+0932 : a5 4e __ LDA T2 + 0
+0934 : 0a __ __ ASL
+0935 : a8 __ __ TAY
+0936 : b9 15 0e LDA $0e15,y ; (text + 0)
+0939 : 85 0f __ STA P2
+093b : b9 16 0e LDA $0e16,y ; (text + 1)
+093e : 85 10 __ STA P3
+0940 : 20 6f 0c JSR $0c6f ; (strcat + 0)
+0943 : a9 37 __ LDA #$37
+0945 : 85 0d __ STA P0
+0947 : a9 0e __ LDA #$0e
+0949 : 85 0e __ STA P1
+094b : a9 0c __ LDA #$0c
+094d : 85 0f __ STA P2
+094f : a9 0d __ LDA #$0d
+0951 : 85 10 __ STA P3
+0953 : 20 6f 0c JSR $0c6f ; (strcat + 0)
+0956 : e6 4e __ INC T2 + 0
+0958 : d0 02 __ BNE $095c
+095a : e6 4f __ INC T2 + 1
+095c : a5 4f __ LDA T2 + 1
+095e : 30 ca __ BMI $092a
+0960 : d0 06 __ BNE $0968
+0962 : a5 4e __ LDA T2 + 0
+0964 : c9 11 __ CMP #$11
+0966 : 90 c2 __ BCC $092a
+0968 : a9 00 __ LDA #$00
+096a : 85 4e __ STA T2 + 0
+096c : 85 4f __ STA T2 + 1
+096e : ad 37 0e LDA $0e37 ; (buffer + 0)
+0971 : f0 03 __ BEQ $0976
+0973 : 4c 53 0c JMP $0c53 ; (main + 851)
+0976 : 18 __ __ CLC
+0977 : a5 4a __ LDA T0 + 0
+0979 : 65 4e __ ADC T2 + 0
+097b : 85 4a __ STA T0 + 0
+097d : a5 4b __ LDA T0 + 1
+097f : 65 4f __ ADC T2 + 1
+0981 : 85 4b __ STA T0 + 1
+0983 : a9 00 __ LDA #$00
+0985 : 85 4e __ STA T2 + 0
+0987 : 85 4f __ STA T2 + 1
+0989 : ad 37 0e LDA $0e37 ; (buffer + 0)
+098c : f0 03 __ BEQ $0991
+098e : 4c 26 0c JMP $0c26 ; (main + 806)
+0991 : 18 __ __ CLC
+0992 : a5 4a __ LDA T0 + 0
+0994 : 65 4e __ ADC T2 + 0
+0996 : 85 4a __ STA T0 + 0
+0998 : a5 4b __ LDA T0 + 1
+099a : 65 4f __ ADC T2 + 1
+099c : 85 4b __ STA T0 + 1
+099e : a9 00 __ LDA #$00
+09a0 : 85 4e __ STA T2 + 0
+09a2 : 85 4f __ STA T2 + 1
+09a4 : a5 4e __ LDA T2 + 0
+09a6 : 85 1b __ STA ACCU + 0
+09a8 : a5 4f __ LDA T2 + 1
+09aa : 06 1b __ ASL ACCU + 0
+09ac : 2a __ __ ROL
+09ad : 06 1b __ ASL ACCU + 0
+09af : 2a __ __ ROL
+09b0 : 06 1b __ ASL ACCU + 0
+09b2 : 2a __ __ ROL
+09b3 : 06 1b __ ASL ACCU + 0
+09b5 : 2a __ __ ROL
+09b6 : 85 1c __ STA ACCU + 1
+09b8 : 18 __ __ CLC
+09b9 : a9 37 __ LDA #$37
+09bb : 65 1b __ ADC ACCU + 0
+09bd : 85 50 __ STA T3 + 0
+09bf : a9 0f __ LDA #$0f
+09c1 : 65 1c __ ADC ACCU + 1
+09c3 : 85 51 __ STA T3 + 1
+09c5 : a5 4e __ LDA T2 + 0
+09c7 : 0a __ __ ASL
+09c8 : 85 07 __ STA $07
+09ca : a5 4f __ LDA T2 + 1
+09cc : 2a __ __ ROL
+09cd : 06 07 __ ASL $07
+09cf : 2a __ __ ROL
+09d0 : aa __ __ TAX
+09d1 : 18 __ __ CLC
+09d2 : a5 07 __ LDA $07
+09d4 : 65 4e __ ADC T2 + 0
+09d6 : 85 1b __ STA ACCU + 0
+09d8 : 8a __ __ TXA
+09d9 : 65 4f __ ADC T2 + 1
+09db : 85 1c __ STA ACCU + 1
+09dd : 18 __ __ CLC
+09de : a5 1b __ LDA ACCU + 0
+09e0 : 65 4c __ ADC T1 + 0
+09e2 : 85 1b __ STA ACCU + 0
+09e4 : a5 1c __ LDA ACCU + 1
+09e6 : 65 4d __ ADC T1 + 1
+09e8 : 85 1c __ STA ACCU + 1
+09ea : a9 11 __ LDA #$11
+09ec : 85 03 __ STA $03
+09ee : a9 00 __ LDA #$00
+09f0 : 85 04 __ STA $04
+09f2 : 20 eb 0d JSR $0deb ; (mods16 + 0)
+09f5 : a5 05 __ LDA $05
+09f7 : 0a __ __ ASL
+09f8 : a8 __ __ TAY
+09f9 : b9 15 0e LDA $0e15,y ; (text + 0)
+09fc : 85 53 __ STA T4 + 0
+09fe : b9 16 0e LDA $0e16,y ; (text + 1)
+0a01 : 85 54 __ STA T4 + 1
+0a03 : a0 ff __ LDY #$ff
+0a05 : c8 __ __ INY
+0a06 : b1 53 __ LDA (T4 + 0),y
+0a08 : 91 50 __ STA (T3 + 0),y
+0a0a : d0 f9 __ BNE $0a05
+0a0c : e6 4e __ INC T2 + 0
+0a0e : d0 02 __ BNE $0a12
+0a10 : e6 4f __ INC T2 + 1
+0a12 : a5 4f __ LDA T2 + 1
+0a14 : 30 8e __ BMI $09a4
+0a16 : d0 06 __ BNE $0a1e
+0a18 : a5 4e __ LDA T2 + 0
+0a1a : c9 10 __ CMP #$10
+0a1c : 90 86 __ BCC $09a4
+0a1e : a9 01 __ LDA #$01
+0a20 : 85 50 __ STA T3 + 0
+0a22 : a9 00 __ LDA #$00
+0a24 : 85 51 __ STA T3 + 1
+0a26 : a5 50 __ LDA T3 + 0
+0a28 : 85 1b __ STA ACCU + 0
+0a2a : a5 51 __ LDA T3 + 1
+0a2c : 06 1b __ ASL ACCU + 0
+0a2e : 2a __ __ ROL
+0a2f : 06 1b __ ASL ACCU + 0
+0a31 : 2a __ __ ROL
+0a32 : 06 1b __ ASL ACCU + 0
+0a34 : 2a __ __ ROL
+0a35 : 06 1b __ ASL ACCU + 0
+0a37 : 2a __ __ ROL
+0a38 : 85 1c __ STA ACCU + 1
+0a3a : 18 __ __ CLC
+0a3b : a9 37 __ LDA #$37
+0a3d : 65 1b __ ADC ACCU + 0
+0a3f : 85 53 __ STA T4 + 0
+0a41 : a9 0f __ LDA #$0f
+0a43 : 65 1c __ ADC ACCU + 1
+0a45 : 85 54 __ STA T4 + 1
+0a47 : 18 __ __ CLC
+0a48 : a5 23 __ LDA SP + 0
+0a4a : 69 02 __ ADC #$02
+0a4c : 85 43 __ STA T5 + 0
+0a4e : a5 24 __ LDA SP + 1
+0a50 : 69 00 __ ADC #$00
+0a52 : 85 44 __ STA T5 + 1
+0a54 : a0 ff __ LDY #$ff
+0a56 : c8 __ __ INY
+0a57 : b1 53 __ LDA (T4 + 0),y
+0a59 : 91 43 __ STA (T5 + 0),y
+0a5b : d0 f9 __ BNE $0a56
+0a5d : a5 50 __ LDA T3 + 0
+0a5f : 85 53 __ STA T4 + 0
+0a61 : a5 51 __ LDA T3 + 1
+0a63 : 85 54 __ STA T4 + 1
+0a65 : 30 45 __ BMI $0aac
+0a67 : 05 50 __ ORA T3 + 0
+0a69 : f0 41 __ BEQ $0aac
+0a6b : 38 __ __ SEC
+0a6c : a5 53 __ LDA T4 + 0
+0a6e : e9 01 __ SBC #$01
+0a70 : 85 1b __ STA ACCU + 0
+0a72 : a5 54 __ LDA T4 + 1
+0a74 : e9 00 __ SBC #$00
+0a76 : 06 1b __ ASL ACCU + 0
+0a78 : 2a __ __ ROL
+0a79 : 06 1b __ ASL ACCU + 0
+0a7b : 2a __ __ ROL
+0a7c : 06 1b __ ASL ACCU + 0
+0a7e : 2a __ __ ROL
+0a7f : 06 1b __ ASL ACCU + 0
+0a81 : 2a __ __ ROL
+0a82 : 85 1c __ STA ACCU + 1
+0a84 : 18 __ __ CLC
+0a85 : a9 37 __ LDA #$37
+0a87 : 65 1b __ ADC ACCU + 0
+0a89 : 85 0d __ STA P0
+0a8b : a9 0f __ LDA #$0f
+0a8d : 65 1c __ ADC ACCU + 1
+0a8f : 85 0e __ STA P1
+0a91 : 18 __ __ CLC
+0a92 : a5 23 __ LDA SP + 0
+0a94 : 69 02 __ ADC #$02
+0a96 : 85 0f __ STA P2
+0a98 : a5 24 __ LDA SP + 1
+0a9a : 69 00 __ ADC #$00
+0a9c : 85 10 __ STA P3
+0a9e : 20 0e 0d JSR $0d0e ; (strcmp + 0)
+0aa1 : a5 1c __ LDA ACCU + 1
+0aa3 : 30 07 __ BMI $0aac
+0aa5 : 05 1b __ ORA ACCU + 0
+0aa7 : f0 03 __ BEQ $0aac
+0aa9 : 4c ba 0b JMP $0bba ; (main + 698)
+0aac : a5 53 __ LDA T4 + 0
+0aae : 85 1b __ STA ACCU + 0
+0ab0 : a5 54 __ LDA T4 + 1
+0ab2 : 06 1b __ ASL ACCU + 0
+0ab4 : 2a __ __ ROL
+0ab5 : 06 1b __ ASL ACCU + 0
+0ab7 : 2a __ __ ROL
+0ab8 : 06 1b __ ASL ACCU + 0
+0aba : 2a __ __ ROL
+0abb : 06 1b __ ASL ACCU + 0
+0abd : 2a __ __ ROL
+0abe : 85 1c __ STA ACCU + 1
+0ac0 : 18 __ __ CLC
+0ac1 : a9 37 __ LDA #$37
+0ac3 : 65 1b __ ADC ACCU + 0
+0ac5 : 85 53 __ STA T4 + 0
+0ac7 : a9 0f __ LDA #$0f
+0ac9 : 65 1c __ ADC ACCU + 1
+0acb : 85 54 __ STA T4 + 1
+0acd : 18 __ __ CLC
+0ace : a5 23 __ LDA SP + 0
+0ad0 : 69 02 __ ADC #$02
+0ad2 : 85 43 __ STA T5 + 0
+0ad4 : a5 24 __ LDA SP + 1
+0ad6 : 69 00 __ ADC #$00
+0ad8 : 85 44 __ STA T5 + 1
+0ada : a0 ff __ LDY #$ff
+0adc : c8 __ __ INY
+0add : b1 43 __ LDA (T5 + 0),y
+0adf : 91 53 __ STA (T4 + 0),y
+0ae1 : d0 f9 __ BNE $0adc
+0ae3 : e6 50 __ INC T3 + 0
+0ae5 : d0 02 __ BNE $0ae9
+0ae7 : e6 51 __ INC T3 + 1
+0ae9 : a5 51 __ LDA T3 + 1
+0aeb : 49 80 __ EOR #$80
+0aed : c9 80 __ CMP #$80
+0aef : d0 04 __ BNE $0af5
+0af1 : a5 50 __ LDA T3 + 0
+0af3 : c9 10 __ CMP #$10
+0af5 : b0 03 __ BCS $0afa
+0af7 : 4c 26 0a JMP $0a26 ; (main + 294)
+0afa : a9 01 __ LDA #$01
+0afc : 85 4e __ STA T2 + 0
+0afe : a9 00 __ LDA #$00
+0b00 : 85 4f __ STA T2 + 1
+0b02 : 38 __ __ SEC
+0b03 : a5 4e __ LDA T2 + 0
+0b05 : e9 01 __ SBC #$01
+0b07 : 85 1b __ STA ACCU + 0
+0b09 : a5 4f __ LDA T2 + 1
+0b0b : e9 00 __ SBC #$00
+0b0d : 06 1b __ ASL ACCU + 0
+0b0f : 2a __ __ ROL
+0b10 : 06 1b __ ASL ACCU + 0
+0b12 : 2a __ __ ROL
+0b13 : 06 1b __ ASL ACCU + 0
+0b15 : 2a __ __ ROL
+0b16 : 06 1b __ ASL ACCU + 0
+0b18 : 2a __ __ ROL
+0b19 : 85 1c __ STA ACCU + 1
+0b1b : 18 __ __ CLC
+0b1c : a9 37 __ LDA #$37
+0b1e : 65 1b __ ADC ACCU + 0
+0b20 : 85 0d __ STA P0
+0b22 : a9 0f __ LDA #$0f
+0b24 : 65 1c __ ADC ACCU + 1
+0b26 : 85 0e __ STA P1
+0b28 : a5 4e __ LDA T2 + 0
+0b2a : 85 1b __ STA ACCU + 0
+0b2c : a5 4f __ LDA T2 + 1
+0b2e : 06 1b __ ASL ACCU + 0
+0b30 : 2a __ __ ROL
+0b31 : 06 1b __ ASL ACCU + 0
+0b33 : 2a __ __ ROL
+0b34 : 06 1b __ ASL ACCU + 0
+0b36 : 2a __ __ ROL
+0b37 : 06 1b __ ASL ACCU + 0
+0b39 : 2a __ __ ROL
+0b3a : 85 1c __ STA ACCU + 1
+0b3c : 18 __ __ CLC
+0b3d : a9 37 __ LDA #$37
+0b3f : 65 1b __ ADC ACCU + 0
+0b41 : 85 0f __ STA P2
+0b43 : a9 0f __ LDA #$0f
+0b45 : 65 1c __ ADC ACCU + 1
+0b47 : 85 10 __ STA P3
+0b49 : 20 0e 0d JSR $0d0e ; (strcmp + 0)
+0b4c : a5 1c __ LDA ACCU + 1
+0b4e : 30 04 __ BMI $0b54
+0b50 : 05 1b __ ORA ACCU + 0
+0b52 : d0 5d __ BNE $0bb1
+0b54 : e6 4e __ INC T2 + 0
+0b56 : d0 02 __ BNE $0b5a
+0b58 : e6 4f __ INC T2 + 1
+0b5a : a5 4f __ LDA T2 + 1
+0b5c : 30 a4 __ BMI $0b02
+0b5e : d0 06 __ BNE $0b66
+0b60 : a5 4e __ LDA T2 + 0
+0b62 : c9 10 __ CMP #$10
+0b64 : 90 9c __ BCC $0b02
+0b66 : e6 4c __ INC T1 + 0
+0b68 : d0 02 __ BNE $0b6c
+0b6a : e6 4d __ INC T1 + 1
+0b6c : a5 4d __ LDA T1 + 1
+0b6e : 10 03 __ BPL $0b73
+0b70 : 4c 21 09 JMP $0921 ; (main + 33)
+0b73 : d0 09 __ BNE $0b7e
+0b75 : a5 4c __ LDA T1 + 0
+0b77 : c9 14 __ CMP #$14
+0b79 : b0 03 __ BCS $0b7e
+0b7b : 4c 21 09 JMP $0921 ; (main + 33)
+0b7e : a5 4b __ LDA T0 + 1
+0b80 : c9 07 __ CMP #$07
+0b82 : d0 06 __ BNE $0b8a
+0b84 : a5 4a __ LDA T0 + 0
+0b86 : c9 1c __ CMP #$1c
+0b88 : f0 20 __ BEQ $0baa
+0b8a : a9 02 __ LDA #$02
+0b8c : 85 1b __ STA ACCU + 0
+0b8e : a9 00 __ LDA #$00
+0b90 : 85 1c __ STA ACCU + 1
+0b92 : a0 01 __ LDY #$01
+0b94 : b1 23 __ LDA (SP + 0),y
+0b96 : 99 53 00 STA $0053,y 
+0b99 : 88 __ __ DEY
+0b9a : 10 f8 __ BPL $0b94
+0b9c : 18 __ __ CLC
+0b9d : a5 23 __ LDA SP + 0
+0b9f : 69 12 __ ADC #$12
+0ba1 : 85 23 __ STA SP + 0
+0ba3 : a5 24 __ LDA SP + 1
+0ba5 : 69 00 __ ADC #$00
+0ba7 : 85 24 __ STA SP + 1
+0ba9 : 60 __ __ RTS
+0baa : a9 00 __ LDA #$00
+0bac : 85 1b __ STA ACCU + 0
+0bae : 4c 90 0b JMP $0b90 ; (main + 656)
+0bb1 : a9 01 __ LDA #$01
+0bb3 : 85 1b __ STA ACCU + 0
+0bb5 : a9 00 __ LDA #$00
+0bb7 : 4c 90 0b JMP $0b90 ; (main + 656)
+0bba : a5 53 __ LDA T4 + 0
+0bbc : 85 1b __ STA ACCU + 0
+0bbe : a5 54 __ LDA T4 + 1
+0bc0 : 06 1b __ ASL ACCU + 0
+0bc2 : 2a __ __ ROL
+0bc3 : 06 1b __ ASL ACCU + 0
+0bc5 : 2a __ __ ROL
+0bc6 : 06 1b __ ASL ACCU + 0
+0bc8 : 2a __ __ ROL
+0bc9 : 06 1b __ ASL ACCU + 0
+0bcb : 2a __ __ ROL
+0bcc : 85 1c __ STA ACCU + 1
+0bce : 18 __ __ CLC
+0bcf : a9 37 __ LDA #$37
+0bd1 : 65 1b __ ADC ACCU + 0
+0bd3 : 85 43 __ STA T5 + 0
+0bd5 : a9 0f __ LDA #$0f
+0bd7 : 65 1c __ ADC ACCU + 1
+0bd9 : 85 44 __ STA T5 + 1
+0bdb : 38 __ __ SEC
+0bdc : a5 53 __ LDA T4 + 0
+0bde : e9 01 __ SBC #$01
+0be0 : 85 1b __ STA ACCU + 0
+0be2 : a5 54 __ LDA T4 + 1
+0be4 : e9 00 __ SBC #$00
+0be6 : 06 1b __ ASL ACCU + 0
+0be8 : 2a __ __ ROL
+0be9 : 06 1b __ ASL ACCU + 0
+0beb : 2a __ __ ROL
+0bec : 06 1b __ ASL ACCU + 0
+0bee : 2a __ __ ROL
+0bef : 06 1b __ ASL ACCU + 0
+0bf1 : 2a __ __ ROL
+0bf2 : 85 1c __ STA ACCU + 1
+0bf4 : 18 __ __ CLC
+0bf5 : a9 37 __ LDA #$37
+0bf7 : 65 1b __ ADC ACCU + 0
+0bf9 : 85 47 __ STA T8 + 0
+0bfb : a9 0f __ LDA #$0f
+0bfd : 65 1c __ ADC ACCU + 1
+0bff : 85 48 __ STA T8 + 1
+0c01 : a0 ff __ LDY #$ff
+0c03 : c8 __ __ INY
+0c04 : b1 47 __ LDA (T8 + 0),y
+0c06 : 91 43 __ STA (T5 + 0),y
+0c08 : d0 f9 __ BNE $0c03
+0c0a : 18 __ __ CLC
+0c0b : a5 53 __ LDA T4 + 0
+0c0d : 69 ff __ ADC #$ff
+0c0f : 85 53 __ STA T4 + 0
+0c11 : a5 54 __ LDA T4 + 1
+0c13 : 69 ff __ ADC #$ff
+0c15 : 85 54 __ STA T4 + 1
+0c17 : 10 03 __ BPL $0c1c
+0c19 : 4c ac 0a JMP $0aac ; (main + 428)
+0c1c : 05 53 __ ORA T4 + 0
+0c1e : f0 03 __ BEQ $0c23
+0c20 : 4c 6b 0a JMP $0a6b ; (main + 363)
+0c23 : 4c ac 0a JMP $0aac ; (main + 428)
+0c26 : a9 37 __ LDA #$37
+0c28 : 85 50 __ STA T3 + 0
+0c2a : a9 0e __ LDA #$0e
+0c2c : 85 51 __ STA T3 + 1
+0c2e : a5 50 __ LDA T3 + 0
+0c30 : 85 53 __ STA T4 + 0
+0c32 : a5 51 __ LDA T3 + 1
+0c34 : 85 54 __ STA T4 + 1
+0c36 : a0 00 __ LDY #$00
+0c38 : b1 50 __ LDA (T3 + 0),y
+0c3a : c9 6f __ CMP #$6f
+0c3c : d0 06 __ BNE $0c44
+0c3e : e6 4e __ INC T2 + 0
+0c40 : d0 02 __ BNE $0c44
+0c42 : e6 4f __ INC T2 + 1
+0c44 : e6 50 __ INC T3 + 0
+0c46 : d0 02 __ BNE $0c4a
+0c48 : e6 51 __ INC T3 + 1
+0c4a : a0 01 __ LDY #$01
+0c4c : b1 53 __ LDA (T4 + 0),y
+0c4e : d0 de __ BNE $0c2e
+0c50 : 4c 91 09 JMP $0991 ; (main + 145)
+0c53 : 18 __ __ CLC
+0c54 : a9 37 __ LDA #$37
+0c56 : 65 4e __ ADC T2 + 0
+0c58 : 85 53 __ STA T4 + 0
+0c5a : a9 0e __ LDA #$0e
+0c5c : 65 4f __ ADC T2 + 1
+0c5e : 85 54 __ STA T4 + 1
+0c60 : e6 4e __ INC T2 + 0
+0c62 : d0 02 __ BNE $0c66
+0c64 : e6 4f __ INC T2 + 1
+0c66 : a0 01 __ LDY #$01
+0c68 : b1 53 __ LDA (T4 + 0),y
+0c6a : d0 e7 __ BNE $0c53
+0c6c : 4c 76 09 JMP $0976 ; (main + 118)
+--------------------------------------------------------------------
+strcat:
+0c6f : a5 0f __ LDA P2
+0c71 : 85 43 __ STA T0 + 0
+0c73 : a5 10 __ LDA P3
+0c75 : 85 44 __ STA T0 + 1
+0c77 : a5 0d __ LDA P0
+0c79 : 85 45 __ STA T1 + 0
+0c7b : a5 0e __ LDA P1
+0c7d : 85 46 __ STA T1 + 1
+0c7f : a0 00 __ LDY #$00
+0c81 : b1 0d __ LDA (P0),y
+0c83 : f0 14 __ BEQ $0c99
+0c85 : a5 45 __ LDA T1 + 0
+0c87 : 85 48 __ STA T3 + 0
+0c89 : a5 46 __ LDA T1 + 1
+0c8b : 85 49 __ STA T3 + 1
+0c8d : e6 45 __ INC T1 + 0
+0c8f : d0 02 __ BNE $0c93
+0c91 : e6 46 __ INC T1 + 1
+0c93 : a0 01 __ LDY #$01
+0c95 : b1 48 __ LDA (T3 + 0),y
+0c97 : d0 ec __ BNE $0c85
+0c99 : a0 00 __ LDY #$00
+0c9b : b1 43 __ LDA (T0 + 0),y
+0c9d : aa __ __ TAX
+0c9e : 91 45 __ STA (T1 + 0),y
+0ca0 : e6 45 __ INC T1 + 0
+0ca2 : d0 02 __ BNE $0ca6
+0ca4 : e6 46 __ INC T1 + 1
+0ca6 : e6 43 __ INC T0 + 0
+0ca8 : d0 02 __ BNE $0cac
+0caa : e6 44 __ INC T0 + 1
+0cac : 8a __ __ TXA
+0cad : d0 ea __ BNE $0c99
+0caf : a5 0d __ LDA P0
+0cb1 : 85 1b __ STA ACCU + 0
+0cb3 : a5 0e __ LDA P1
+0cb5 : 85 1c __ STA ACCU + 1
+0cb7 : 60 __ __ RTS
+--------------------------------------------------------------------
+strcmp:
+0d0e : a0 00 __ LDY #$00
+0d10 : 84 1c __ STY ACCU + 1
+0d12 : b1 0d __ LDA (P0),y
+0d14 : f0 16 __ BEQ $0d2c
+0d16 : d1 0f __ CMP (P2),y
+0d18 : d0 16 __ BNE $0d30
+0d1a : c8 __ __ INY
+0d1b : b1 0d __ LDA (P0),y
+0d1d : f0 0d __ BEQ $0d2c
+0d1f : d1 0f __ CMP (P2),y
+0d21 : d0 0d __ BNE $0d30
+0d23 : c8 __ __ INY
+0d24 : d0 ec __ BNE $0d12
+0d26 : e6 0e __ INC P1
+0d28 : e6 10 __ INC P3
+0d2a : d0 e6 __ BNE $0d12
+0d2c : d1 0f __ CMP (P2),y
+0d2e : f0 0a __ BEQ $0d3a
+0d30 : b0 06 __ BCS $0d38
+0d32 : a9 ff __ LDA #$ff
+0d34 : 85 1c __ STA ACCU + 1
+0d36 : 30 02 __ BMI $0d3a
+0d38 : a9 01 __ LDA #$01
+0d3a : 85 1b __ STA ACCU + 0
+0d3c : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+0d3d : a9 4c __ LDA #$4c
+0d3f : 85 54 __ STA $54
+0d41 : a9 00 __ LDA #$00
+0d43 : 85 13 __ STA P6
+0d45 : a9 19 __ LDA #$19
+0d47 : 85 16 __ STA P9
+0d49 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+0d4a : 38 __ __ SEC
+0d4b : a9 00 __ LDA #$00
+0d4d : e5 1b __ SBC ACCU + 0
+0d4f : 85 1b __ STA ACCU + 0
+0d51 : a9 00 __ LDA #$00
+0d53 : e5 1c __ SBC ACCU + 1
+0d55 : 85 1c __ STA ACCU + 1
+0d57 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+0d58 : 38 __ __ SEC
+0d59 : a9 00 __ LDA #$00
+0d5b : e5 03 __ SBC $03
+0d5d : 85 03 __ STA $03
+0d5f : a9 00 __ LDA #$00
+0d61 : e5 04 __ SBC $04
+0d63 : 85 04 __ STA $04
+0d65 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+0d66 : a5 1c __ LDA ACCU + 1
+0d68 : d0 31 __ BNE $0d9b
+0d6a : a5 04 __ LDA $04
+0d6c : d0 1e __ BNE $0d8c
+0d6e : 85 06 __ STA $06
+0d70 : a2 04 __ LDX #$04
+0d72 : 06 1b __ ASL ACCU + 0
+0d74 : 2a __ __ ROL
+0d75 : c5 03 __ CMP $03
+0d77 : 90 02 __ BCC $0d7b
+0d79 : e5 03 __ SBC $03
+0d7b : 26 1b __ ROL ACCU + 0
+0d7d : 2a __ __ ROL
+0d7e : c5 03 __ CMP $03
+0d80 : 90 02 __ BCC $0d84
+0d82 : e5 03 __ SBC $03
+0d84 : 26 1b __ ROL ACCU + 0
+0d86 : ca __ __ DEX
+0d87 : d0 eb __ BNE $0d74
+0d89 : 85 05 __ STA $05
+0d8b : 60 __ __ RTS
+0d8c : a5 1b __ LDA ACCU + 0
+0d8e : 85 05 __ STA $05
+0d90 : a5 1c __ LDA ACCU + 1
+0d92 : 85 06 __ STA $06
+0d94 : a9 00 __ LDA #$00
+0d96 : 85 1b __ STA ACCU + 0
+0d98 : 85 1c __ STA ACCU + 1
+0d9a : 60 __ __ RTS
+0d9b : a5 04 __ LDA $04
+0d9d : d0 1f __ BNE $0dbe
+0d9f : a5 03 __ LDA $03
+0da1 : 30 1b __ BMI $0dbe
+0da3 : a9 00 __ LDA #$00
+0da5 : 85 06 __ STA $06
+0da7 : a2 10 __ LDX #$10
+0da9 : 06 1b __ ASL ACCU + 0
+0dab : 26 1c __ ROL ACCU + 1
+0dad : 2a __ __ ROL
+0dae : c5 03 __ CMP $03
+0db0 : 90 02 __ BCC $0db4
+0db2 : e5 03 __ SBC $03
+0db4 : 26 1b __ ROL ACCU + 0
+0db6 : 26 1c __ ROL ACCU + 1
+0db8 : ca __ __ DEX
+0db9 : d0 f2 __ BNE $0dad
+0dbb : 85 05 __ STA $05
+0dbd : 60 __ __ RTS
+0dbe : a9 00 __ LDA #$00
+0dc0 : 85 05 __ STA $05
+0dc2 : 85 06 __ STA $06
+0dc4 : 84 02 __ STY $02
+0dc6 : a0 10 __ LDY #$10
+0dc8 : 18 __ __ CLC
+0dc9 : 26 1b __ ROL ACCU + 0
+0dcb : 26 1c __ ROL ACCU + 1
+0dcd : 26 05 __ ROL $05
+0dcf : 26 06 __ ROL $06
+0dd1 : 38 __ __ SEC
+0dd2 : a5 05 __ LDA $05
+0dd4 : e5 03 __ SBC $03
+0dd6 : aa __ __ TAX
+0dd7 : a5 06 __ LDA $06
+0dd9 : e5 04 __ SBC $04
+0ddb : 90 04 __ BCC $0de1
+0ddd : 86 05 __ STX $05
+0ddf : 85 06 __ STA $06
+0de1 : 88 __ __ DEY
+0de2 : d0 e5 __ BNE $0dc9
+0de4 : 26 1b __ ROL ACCU + 0
+0de6 : 26 1c __ ROL ACCU + 1
+0de8 : a4 02 __ LDY $02
+0dea : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+0deb : 24 1c __ BIT ACCU + 1
+0ded : 10 0d __ BPL $0dfc
+0def : 20 4a 0d JSR $0d4a ; (negaccu + 0)
+0df2 : 24 04 __ BIT $04
+0df4 : 10 0d __ BPL $0e03
+0df6 : 20 58 0d JSR $0d58 ; (negtmp + 0)
+0df9 : 4c 66 0d JMP $0d66 ; (divmod + 0)
+0dfc : 24 04 __ BIT $04
+0dfe : 10 f9 __ BPL $0df9
+0e00 : 20 58 0d JSR $0d58 ; (negtmp + 0)
+0e03 : 20 66 0d JSR $0d66 ; (divmod + 0)
+0e06 : 38 __ __ SEC
+0e07 : a9 00 __ LDA #$00
+0e09 : e5 05 __ SBC $05
+0e0b : 85 05 __ STA $05
+0e0d : a9 00 __ LDA #$00
+0e0f : e5 06 __ SBC $06
+0e11 : 85 06 __ STA $06
+0e13 : 60 __ __ RTS
@@ -0,0 +1,3410 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e cf 22 STX $22cf ; (spentry + 0)
+0811 : a9 d1 __ LDA #$d1
+0813 : 85 19 __ STA IP + 0
+0815 : a9 22 __ LDA #$22
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 23 __ LDA #$23
+081c : e9 22 __ SBC #$22
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 3d __ LDA #$3d
+0832 : e9 d1 __ SBC #$d1
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : 20 00 09 JSR $0900 ; (main + 0)
+0849 : 4c 16 1e JMP $1e16 ; (inp_exit + 0)
+--------------------------------------------------------------------
+main:
+0900 : 38 __ __ SEC
+0901 : a5 23 __ LDA SP + 0
+0903 : e9 12 __ SBC #$12
+0905 : 85 23 __ STA SP + 0
+0907 : a5 24 __ LDA SP + 1
+0909 : e9 00 __ SBC #$00
+090b : 85 24 __ STA SP + 1
+090d : a9 00 __ LDA #$00
+090f : 85 67 __ STA T0 + 0
+0911 : 85 68 __ STA T0 + 1
+0913 : 85 69 __ STA T1 + 0
+0915 : 85 6a __ STA T1 + 1
+0917 : a9 d1 __ LDA #$d1
+0919 : a0 02 __ LDY #$02
+091b : 91 23 __ STA (SP + 0),y
+091d : a9 22 __ LDA #$22
+091f : c8 __ __ INY
+0920 : 91 23 __ STA (SP + 0),y
+0922 : a9 79 __ LDA #$79
+0924 : c8 __ __ INY
+0925 : 91 23 __ STA (SP + 0),y
+0927 : a9 1d __ LDA #$1d
+0929 : c8 __ __ INY
+092a : 91 23 __ STA (SP + 0),y
+092c : a5 69 __ LDA T1 + 0
+092e : 85 1b __ STA ACCU + 0
+0930 : a5 6a __ LDA T1 + 1
+0932 : 85 1c __ STA ACCU + 1
+0934 : a9 4b __ LDA #$4b
+0936 : 85 03 __ STA $03
+0938 : a9 01 __ LDA #$01
+093a : 85 04 __ STA $04
+093c : 20 70 20 JSR $2070 ; (mul16 + 0)
+093f : 38 __ __ SEC
+0940 : a5 05 __ LDA $05
+0942 : e9 80 __ SBC #$80
+0944 : a0 06 __ LDY #$06
+0946 : 91 23 __ STA (SP + 0),y
+0948 : a5 06 __ LDA $06
+094a : e9 3e __ SBC #$3e
+094c : c8 __ __ INY
+094d : 91 23 __ STA (SP + 0),y
+094f : a5 69 __ LDA T1 + 0
+0951 : 85 1b __ STA ACCU + 0
+0953 : a5 6a __ LDA T1 + 1
+0955 : 85 1c __ STA ACCU + 1
+0957 : a9 69 __ LDA #$69
+0959 : 85 03 __ STA $03
+095b : a9 02 __ LDA #$02
+095d : 85 04 __ STA $04
+095f : 20 70 20 JSR $2070 ; (mul16 + 0)
+0962 : a5 05 __ LDA $05
+0964 : a0 08 __ LDY #$08
+0966 : 91 23 __ STA (SP + 0),y
+0968 : a5 06 __ LDA $06
+096a : c8 __ __ INY
+096b : 91 23 __ STA (SP + 0),y
+096d : a5 69 __ LDA T1 + 0
+096f : 85 1b __ STA ACCU + 0
+0971 : a5 6a __ LDA T1 + 1
+0973 : 85 1c __ STA ACCU + 1
+0975 : a9 61 __ LDA #$61
+0977 : 85 03 __ STA $03
+0979 : 20 23 1e JSR $1e23 ; (mul16by8 + 0)
+097c : a5 05 __ LDA $05
+097e : a0 0a __ LDY #$0a
+0980 : 91 23 __ STA (SP + 0),y
+0982 : a5 06 __ LDA $06
+0984 : c8 __ __ INY
+0985 : 91 23 __ STA (SP + 0),y
+0987 : a5 69 __ LDA T1 + 0
+0989 : c8 __ __ INY
+098a : 91 23 __ STA (SP + 0),y
+098c : a5 6a __ LDA T1 + 1
+098e : c8 __ __ INY
+098f : 91 23 __ STA (SP + 0),y
+0991 : 38 __ __ SEC
+0992 : a9 00 __ LDA #$00
+0994 : e5 69 __ SBC T1 + 0
+0996 : c8 __ __ INY
+0997 : 91 23 __ STA (SP + 0),y
+0999 : a9 00 __ LDA #$00
+099b : e5 6a __ SBC T1 + 1
+099d : c8 __ __ INY
+099e : 91 23 __ STA (SP + 0),y
+09a0 : a9 8e __ LDA #$8e
+09a2 : c8 __ __ INY
+09a3 : 91 23 __ STA (SP + 0),y
+09a5 : a9 1d __ LDA #$1d
+09a7 : c8 __ __ INY
+09a8 : 91 23 __ STA (SP + 0),y
+09aa : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+09ad : a9 d1 __ LDA #$d1
+09af : 85 0d __ STA P0
+09b1 : a9 22 __ LDA #$22
+09b3 : 85 0e __ STA P1
+09b5 : 20 92 1d JSR $1d92 ; (strlen + 0)
+09b8 : 18 __ __ CLC
+09b9 : a5 1b __ LDA ACCU + 0
+09bb : 65 67 __ ADC T0 + 0
+09bd : 85 67 __ STA T0 + 0
+09bf : a5 1c __ LDA ACCU + 1
+09c1 : 65 68 __ ADC T0 + 1
+09c3 : 85 68 __ STA T0 + 1
+09c5 : ad d1 22 LDA $22d1 ; (buffer + 0)
+09c8 : f0 03 __ BEQ $09cd
+09ca : 4c 0d 0b JMP $0b0d ; (main + 525)
+09cd : e6 69 __ INC T1 + 0
+09cf : d0 02 __ BNE $09d3
+09d1 : e6 6a __ INC T1 + 1
+09d3 : a5 69 __ LDA T1 + 0
+09d5 : c9 64 __ CMP #$64
+09d7 : b0 03 __ BCS $09dc
+09d9 : 4c 17 09 JMP $0917 ; (main + 23)
+09dc : a9 00 __ LDA #$00
+09de : 85 6d __ STA T4 + 0
+09e0 : a9 d1 __ LDA #$d1
+09e2 : a0 02 __ LDY #$02
+09e4 : 91 23 __ STA (SP + 0),y
+09e6 : a9 22 __ LDA #$22
+09e8 : c8 __ __ INY
+09e9 : 91 23 __ STA (SP + 0),y
+09eb : a9 c3 __ LDA #$c3
+09ed : c8 __ __ INY
+09ee : 91 23 __ STA (SP + 0),y
+09f0 : a9 1d __ LDA #$1d
+09f2 : c8 __ __ INY
+09f3 : 91 23 __ STA (SP + 0),y
+09f5 : a5 6d __ LDA T4 + 0
+09f7 : 85 1b __ STA ACCU + 0
+09f9 : a9 00 __ LDA #$00
+09fb : 85 1c __ STA ACCU + 1
+09fd : 20 dc 21 JSR $21dc ; (sint16_to_float + 0)
+0a00 : a5 1b __ LDA ACCU + 0
+0a02 : 85 47 __ STA T6 + 0
+0a04 : a5 1c __ LDA ACCU + 1
+0a06 : 85 48 __ STA T6 + 1
+0a08 : a5 1d __ LDA ACCU + 2
+0a0a : 85 49 __ STA T6 + 2
+0a0c : a5 1e __ LDA ACCU + 3
+0a0e : 85 4a __ STA T6 + 3
+0a10 : a9 00 __ LDA #$00
+0a12 : 85 03 __ STA $03
+0a14 : 85 04 __ STA $04
+0a16 : a9 a0 __ LDA #$a0
+0a18 : 85 05 __ STA $05
+0a1a : a9 3f __ LDA #$3f
+0a1c : 85 06 __ STA $06
+0a1e : 20 5b 1e JSR $1e5b ; (freg + 20)
+0a21 : 20 54 1f JSR $1f54 ; (fmul + 0)
+0a24 : a5 1b __ LDA ACCU + 0
+0a26 : a0 06 __ LDY #$06
+0a28 : 91 23 __ STA (SP + 0),y
+0a2a : a5 1c __ LDA ACCU + 1
+0a2c : c8 __ __ INY
+0a2d : 91 23 __ STA (SP + 0),y
+0a2f : a5 1d __ LDA ACCU + 2
+0a31 : c8 __ __ INY
+0a32 : 91 23 __ STA (SP + 0),y
+0a34 : a5 1e __ LDA ACCU + 3
+0a36 : c8 __ __ INY
+0a37 : 91 23 __ STA (SP + 0),y
+0a39 : a5 47 __ LDA T6 + 0
+0a3b : 85 1b __ STA ACCU + 0
+0a3d : a5 48 __ LDA T6 + 1
+0a3f : 85 1c __ STA ACCU + 1
+0a41 : a5 49 __ LDA T6 + 2
+0a43 : 85 1d __ STA ACCU + 2
+0a45 : a5 4a __ LDA T6 + 3
+0a47 : 85 1e __ STA ACCU + 3
+0a49 : a9 00 __ LDA #$00
+0a4b : 85 03 __ STA $03
+0a4d : 85 04 __ STA $04
+0a4f : a9 80 __ LDA #$80
+0a51 : 85 05 __ STA $05
+0a53 : a9 bd __ LDA #$bd
+0a55 : 85 06 __ STA $06
+0a57 : 20 5b 1e JSR $1e5b ; (freg + 20)
+0a5a : 20 54 1f JSR $1f54 ; (fmul + 0)
+0a5d : a5 1b __ LDA ACCU + 0
+0a5f : a0 0a __ LDY #$0a
+0a61 : 91 23 __ STA (SP + 0),y
+0a63 : a5 1c __ LDA ACCU + 1
+0a65 : c8 __ __ INY
+0a66 : 91 23 __ STA (SP + 0),y
+0a68 : a5 1d __ LDA ACCU + 2
+0a6a : c8 __ __ INY
+0a6b : 91 23 __ STA (SP + 0),y
+0a6d : a5 1e __ LDA ACCU + 3
+0a6f : c8 __ __ INY
+0a70 : 91 23 __ STA (SP + 0),y
+0a72 : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+0a75 : a9 d1 __ LDA #$d1
+0a77 : 85 0d __ STA P0
+0a79 : a9 22 __ LDA #$22
+0a7b : 85 0e __ STA P1
+0a7d : 20 92 1d JSR $1d92 ; (strlen + 0)
+0a80 : e6 6d __ INC T4 + 0
+0a82 : 18 __ __ CLC
+0a83 : a5 1b __ LDA ACCU + 0
+0a85 : 65 67 __ ADC T0 + 0
+0a87 : 85 67 __ STA T0 + 0
+0a89 : a5 1c __ LDA ACCU + 1
+0a8b : 65 68 __ ADC T0 + 1
+0a8d : 85 68 __ STA T0 + 1
+0a8f : a5 6d __ LDA T4 + 0
+0a91 : c9 14 __ CMP #$14
+0a93 : b0 03 __ BCS $0a98
+0a95 : 4c e0 09 JMP $09e0 ; (main + 224)
+0a98 : a9 d1 __ LDA #$d1
+0a9a : a0 02 __ LDY #$02
+0a9c : 91 23 __ STA (SP + 0),y
+0a9e : a9 22 __ LDA #$22
+0aa0 : c8 __ __ INY
+0aa1 : 91 23 __ STA (SP + 0),y
+0aa3 : a9 cc __ LDA #$cc
+0aa5 : c8 __ __ INY
+0aa6 : 91 23 __ STA (SP + 0),y
+0aa8 : a9 1d __ LDA #$1d
+0aaa : c8 __ __ INY
+0aab : 91 23 __ STA (SP + 0),y
+0aad : a9 85 __ LDA #$85
+0aaf : c8 __ __ INY
+0ab0 : 91 23 __ STA (SP + 0),y
+0ab2 : a9 ff __ LDA #$ff
+0ab4 : c8 __ __ INY
+0ab5 : 91 23 __ STA (SP + 0),y
+0ab7 : a9 d5 __ LDA #$d5
+0ab9 : c8 __ __ INY
+0aba : 91 23 __ STA (SP + 0),y
+0abc : a9 1d __ LDA #$1d
+0abe : c8 __ __ INY
+0abf : 91 23 __ STA (SP + 0),y
+0ac1 : a9 ef __ LDA #$ef
+0ac3 : c8 __ __ INY
+0ac4 : 91 23 __ STA (SP + 0),y
+0ac6 : a9 be __ LDA #$be
+0ac8 : c8 __ __ INY
+0ac9 : 91 23 __ STA (SP + 0),y
+0acb : 20 3f 0b JSR $0b3f ; (sprintf + 0)
+0ace : a9 d1 __ LDA #$d1
+0ad0 : 85 0d __ STA P0
+0ad2 : a9 22 __ LDA #$22
+0ad4 : 85 0e __ STA P1
+0ad6 : a9 08 __ LDA #$08
+0ad8 : 85 0f __ STA P2
+0ada : a9 1e __ LDA #$1e
+0adc : 85 10 __ STA P3
+0ade : 20 d9 1d JSR $1dd9 ; (strcmp + 0)
+0ae1 : a5 1b __ LDA ACCU + 0
+0ae3 : 05 1c __ ORA ACCU + 1
+0ae5 : d0 21 __ BNE $0b08
+0ae7 : a5 67 __ LDA T0 + 0
+0ae9 : 05 68 __ ORA T0 + 1
+0aeb : f0 16 __ BEQ $0b03
+0aed : a9 00 __ LDA #$00
+0aef : 85 1b __ STA ACCU + 0
+0af1 : a9 00 __ LDA #$00
+0af3 : 85 1c __ STA ACCU + 1
+0af5 : 18 __ __ CLC
+0af6 : a5 23 __ LDA SP + 0
+0af8 : 69 12 __ ADC #$12
+0afa : 85 23 __ STA SP + 0
+0afc : a5 24 __ LDA SP + 1
+0afe : 69 00 __ ADC #$00
+0b00 : 85 24 __ STA SP + 1
+0b02 : 60 __ __ RTS
+0b03 : a9 01 __ LDA #$01
+0b05 : 4c ef 0a JMP $0aef ; (main + 495)
+0b08 : a9 01 __ LDA #$01
+0b0a : 4c ef 0a JMP $0aef ; (main + 495)
+0b0d : a9 00 __ LDA #$00
+0b0f : 85 6b __ STA T2 + 0
+0b11 : 85 6c __ STA T2 + 1
+0b13 : 18 __ __ CLC
+0b14 : a9 d2 __ LDA #$d2
+0b16 : 65 6b __ ADC T2 + 0
+0b18 : 85 45 __ STA T5 + 0
+0b1a : a9 22 __ LDA #$22
+0b1c : 69 00 __ ADC #$00
+0b1e : 85 46 __ STA T5 + 1
+0b20 : 18 __ __ CLC
+0b21 : a4 6b __ LDY T2 + 0
+0b23 : b9 d1 22 LDA $22d1,y ; (buffer + 0)
+0b26 : 65 67 __ ADC T0 + 0
+0b28 : 85 67 __ STA T0 + 0
+0b2a : a9 00 __ LDA #$00
+0b2c : 65 68 __ ADC T0 + 1
+0b2e : 85 68 __ STA T0 + 1
+0b30 : a0 00 __ LDY #$00
+0b32 : e6 6b __ INC T2 + 0
+0b34 : d0 02 __ BNE $0b38
+0b36 : e6 6c __ INC T2 + 1
+0b38 : b1 45 __ LDA (T5 + 0),y
+0b3a : d0 d7 __ BNE $0b13
+0b3c : 4c cd 09 JMP $09cd ; (main + 205)
+--------------------------------------------------------------------
+sprintf:
+0b3f : 38 __ __ SEC
+0b40 : a5 23 __ LDA SP + 0
+0b42 : e9 09 __ SBC #$09
+0b44 : 85 23 __ STA SP + 0
+0b46 : a5 24 __ LDA SP + 1
+0b48 : e9 00 __ SBC #$00
+0b4a : 85 24 __ STA SP + 1
+0b4c : a0 0b __ LDY #$0b
+0b4e : b1 23 __ LDA (SP + 0),y
+0b50 : a0 02 __ LDY #$02
+0b52 : 91 23 __ STA (SP + 0),y
+0b54 : a0 0c __ LDY #$0c
+0b56 : b1 23 __ LDA (SP + 0),y
+0b58 : a0 03 __ LDY #$03
+0b5a : 91 23 __ STA (SP + 0),y
+0b5c : a0 0d __ LDY #$0d
+0b5e : b1 23 __ LDA (SP + 0),y
+0b60 : a0 04 __ LDY #$04
+0b62 : 91 23 __ STA (SP + 0),y
+0b64 : a0 0e __ LDY #$0e
+0b66 : b1 23 __ LDA (SP + 0),y
+0b68 : a0 05 __ LDY #$05
+0b6a : 91 23 __ STA (SP + 0),y
+0b6c : 18 __ __ CLC
+0b6d : a5 23 __ LDA SP + 0
+0b6f : 69 0f __ ADC #$0f
+0b71 : c8 __ __ INY
+0b72 : 91 23 __ STA (SP + 0),y
+0b74 : a5 24 __ LDA SP + 1
+0b76 : 69 00 __ ADC #$00
+0b78 : c8 __ __ INY
+0b79 : 91 23 __ STA (SP + 0),y
+0b7b : a9 00 __ LDA #$00
+0b7d : c8 __ __ INY
+0b7e : 91 23 __ STA (SP + 0),y
+0b80 : 20 a9 0b JSR $0ba9 ; (sformat + 0)
+0b83 : a0 0b __ LDY #$0b
+0b85 : b1 23 __ LDA (SP + 0),y
+0b87 : 85 45 __ STA T1 + 0
+0b89 : c8 __ __ INY
+0b8a : b1 23 __ LDA (SP + 0),y
+0b8c : 85 46 __ STA T1 + 1
+0b8e : 38 __ __ SEC
+0b8f : a5 1b __ LDA ACCU + 0
+0b91 : e5 45 __ SBC T1 + 0
+0b93 : 85 1b __ STA ACCU + 0
+0b95 : a5 1c __ LDA ACCU + 1
+0b97 : e5 46 __ SBC T1 + 1
+0b99 : 85 1c __ STA ACCU + 1
+0b9b : 18 __ __ CLC
+0b9c : a5 23 __ LDA SP + 0
+0b9e : 69 09 __ ADC #$09
+0ba0 : 85 23 __ STA SP + 0
+0ba2 : a5 24 __ LDA SP + 1
+0ba4 : 69 00 __ ADC #$00
+0ba6 : 85 24 __ STA SP + 1
+0ba8 : 60 __ __ RTS
+--------------------------------------------------------------------
+sformat:
+0ba9 : a0 02 __ LDY #$02
+0bab : b1 23 __ LDA (SP + 0),y
+0bad : 85 5d __ STA T0 + 0
+0baf : c8 __ __ INY
+0bb0 : b1 23 __ LDA (SP + 0),y
+0bb2 : 85 5e __ STA T0 + 1
+0bb4 : a9 00 __ LDA #$00
+0bb6 : 85 5f __ STA T1 + 0
+0bb8 : c8 __ __ INY
+0bb9 : b1 23 __ LDA (SP + 0),y
+0bbb : 85 61 __ STA T2 + 0
+0bbd : c8 __ __ INY
+0bbe : b1 23 __ LDA (SP + 0),y
+0bc0 : 85 62 __ STA T2 + 1
+0bc2 : a0 00 __ LDY #$00
+0bc4 : b1 61 __ LDA (T2 + 0),y
+0bc6 : 85 43 __ STA T3 + 0
+0bc8 : d0 42 __ BNE $0c0c
+0bca : 18 __ __ CLC
+0bcb : a5 5d __ LDA T0 + 0
+0bcd : 65 5f __ ADC T1 + 0
+0bcf : 85 61 __ STA T2 + 0
+0bd1 : a5 5e __ LDA T0 + 1
+0bd3 : 69 00 __ ADC #$00
+0bd5 : 85 62 __ STA T2 + 1
+0bd7 : a9 00 __ LDA #$00
+0bd9 : a4 5f __ LDY T1 + 0
+0bdb : 91 5d __ STA (T0 + 0),y
+0bdd : 98 __ __ TYA
+0bde : d0 09 __ BNE $0be9
+0be0 : a5 5d __ LDA T0 + 0
+0be2 : 85 1b __ STA ACCU + 0
+0be4 : a5 5e __ LDA T0 + 1
+0be6 : 85 1c __ STA ACCU + 1
+0be8 : 60 __ __ RTS
+0be9 : a0 08 __ LDY #$08
+0beb : b1 23 __ LDA (SP + 0),y
+0bed : d0 09 __ BNE $0bf8
+0bef : a5 61 __ LDA T2 + 0
+0bf1 : 85 1b __ STA ACCU + 0
+0bf3 : a5 62 __ LDA T2 + 1
+0bf5 : 4c e6 0b JMP $0be6 ; (sformat + 61)
+0bf8 : a5 5d __ LDA T0 + 0
+0bfa : 85 0d __ STA P0
+0bfc : a5 5e __ LDA T0 + 1
+0bfe : 85 0e __ STA P1
+0c00 : 20 f2 14 JSR $14f2 ; (puts + 0)
+0c03 : a5 5d __ LDA T0 + 0
+0c05 : 85 1b __ STA ACCU + 0
+0c07 : a5 5e __ LDA T0 + 1
+0c09 : 4c e6 0b JMP $0be6 ; (sformat + 61)
+0c0c : e6 61 __ INC T2 + 0
+0c0e : d0 02 __ BNE $0c12
+0c10 : e6 62 __ INC T2 + 1
+0c12 : a5 43 __ LDA T3 + 0
+0c14 : c9 25 __ CMP #$25
+0c16 : f0 72 __ BEQ $0c8a
+0c18 : a4 5f __ LDY T1 + 0
+0c1a : 91 5d __ STA (T0 + 0),y
+0c1c : e6 5f __ INC T1 + 0
+0c1e : a5 5f __ LDA T1 + 0
+0c20 : c9 28 __ CMP #$28
+0c22 : 90 57 __ BCC $0c7b
+0c24 : a0 08 __ LDY #$08
+0c26 : b1 23 __ LDA (SP + 0),y
+0c28 : d0 24 __ BNE $0c4e
+0c2a : 18 __ __ CLC
+0c2b : a5 5d __ LDA T0 + 0
+0c2d : 65 5f __ ADC T1 + 0
+0c2f : 85 5d __ STA T0 + 0
+0c31 : 90 02 __ BCC $0c35
+0c33 : e6 5e __ INC T0 + 1
+0c35 : a9 00 __ LDA #$00
+0c37 : 85 5f __ STA T1 + 0
+0c39 : a0 00 __ LDY #$00
+0c3b : b1 61 __ LDA (T2 + 0),y
+0c3d : 85 45 __ STA T4 + 0
+0c3f : e6 61 __ INC T2 + 0
+0c41 : d0 02 __ BNE $0c45
+0c43 : e6 62 __ INC T2 + 1
+0c45 : a5 45 __ LDA T4 + 0
+0c47 : 85 43 __ STA T3 + 0
+0c49 : d0 c7 __ BNE $0c12
+0c4b : 4c ca 0b JMP $0bca ; (sformat + 33)
+0c4e : 18 __ __ CLC
+0c4f : a5 5d __ LDA T0 + 0
+0c51 : 85 0d __ STA P0
+0c53 : 65 5f __ ADC T1 + 0
+0c55 : 85 47 __ STA T5 + 0
+0c57 : a5 5e __ LDA T0 + 1
+0c59 : 85 0e __ STA P1
+0c5b : 69 00 __ ADC #$00
+0c5d : 85 48 __ STA T5 + 1
+0c5f : a9 00 __ LDA #$00
+0c61 : a0 00 __ LDY #$00
+0c63 : 91 47 __ STA (T5 + 0),y
+0c65 : 20 f2 14 JSR $14f2 ; (puts + 0)
+0c68 : a9 00 __ LDA #$00
+0c6a : 85 5f __ STA T1 + 0
+0c6c : a0 00 __ LDY #$00
+0c6e : b1 61 __ LDA (T2 + 0),y
+0c70 : 85 45 __ STA T4 + 0
+0c72 : e6 61 __ INC T2 + 0
+0c74 : d0 02 __ BNE $0c78
+0c76 : e6 62 __ INC T2 + 1
+0c78 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0c7b : a0 00 __ LDY #$00
+0c7d : b1 61 __ LDA (T2 + 0),y
+0c7f : 85 45 __ STA T4 + 0
+0c81 : e6 61 __ INC T2 + 0
+0c83 : d0 02 __ BNE $0c87
+0c85 : e6 62 __ INC T2 + 1
+0c87 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0c8a : a5 5f __ LDA T1 + 0
+0c8c : f0 03 __ BEQ $0c91
+0c8e : 4c b9 14 JMP $14b9 ; (sformat + 2320)
+0c91 : a0 00 __ LDY #$00
+0c93 : b1 61 __ LDA (T2 + 0),y
+0c95 : 85 43 __ STA T3 + 0
+0c97 : a9 0a __ LDA #$0a
+0c99 : 8d 38 23 STA $2338 ; (sframe + 3)
+0c9c : a9 00 __ LDA #$00
+0c9e : 8d 39 23 STA $2339 ; (sframe + 4)
+0ca1 : a9 01 __ LDA #$01
+0ca3 : 8d 36 23 STA $2336 ; (sframe + 1)
+0ca6 : a9 ff __ LDA #$ff
+0ca8 : 8d 37 23 STA $2337 ; (sframe + 2)
+0cab : a9 20 __ LDA #$20
+0cad : 8d 35 23 STA $2335 ; (sframe + 0)
+0cb0 : a9 00 __ LDA #$00
+0cb2 : 8d 3a 23 STA $233a ; (sframe + 5)
+0cb5 : 8d 3b 23 STA $233b ; (sframe + 6)
+0cb8 : 8d 3c 23 STA $233c ; (sframe + 7)
+0cbb : e6 61 __ INC T2 + 0
+0cbd : d0 02 __ BNE $0cc1
+0cbf : e6 62 __ INC T2 + 1
+0cc1 : a5 43 __ LDA T3 + 0
+0cc3 : c9 2b __ CMP #$2b
+0cc5 : d0 03 __ BNE $0cca
+0cc7 : 4c ab 14 JMP $14ab ; (sformat + 2306)
+0cca : c9 30 __ CMP #$30
+0ccc : d0 03 __ BNE $0cd1
+0cce : 4c 9d 14 JMP $149d ; (sformat + 2292)
+0cd1 : c9 23 __ CMP #$23
+0cd3 : d0 03 __ BNE $0cd8
+0cd5 : 4c 8f 14 JMP $148f ; (sformat + 2278)
+0cd8 : c9 30 __ CMP #$30
+0cda : 90 64 __ BCC $0d40
+0cdc : a9 39 __ LDA #$39
+0cde : c5 43 __ CMP T3 + 0
+0ce0 : 90 5e __ BCC $0d40
+0ce2 : a9 00 __ LDA #$00
+0ce4 : 85 47 __ STA T5 + 0
+0ce6 : 85 48 __ STA T5 + 1
+0ce8 : a5 43 __ LDA T3 + 0
+0cea : c9 30 __ CMP #$30
+0cec : 90 4d __ BCC $0d3b
+0cee : a9 39 __ LDA #$39
+0cf0 : c5 43 __ CMP T3 + 0
+0cf2 : 90 47 __ BCC $0d3b
+0cf4 : a5 43 __ LDA T3 + 0
+0cf6 : 85 49 __ STA T6 + 0
+0cf8 : a0 00 __ LDY #$00
+0cfa : b1 61 __ LDA (T2 + 0),y
+0cfc : 85 43 __ STA T3 + 0
+0cfe : e6 61 __ INC T2 + 0
+0d00 : d0 02 __ BNE $0d04
+0d02 : e6 62 __ INC T2 + 1
+0d04 : a5 47 __ LDA T5 + 0
+0d06 : 0a __ __ ASL
+0d07 : 85 07 __ STA $07
+0d09 : a5 48 __ LDA T5 + 1
+0d0b : 2a __ __ ROL
+0d0c : 06 07 __ ASL $07
+0d0e : 2a __ __ ROL
+0d0f : aa __ __ TAX
+0d10 : 18 __ __ CLC
+0d11 : a5 07 __ LDA $07
+0d13 : 65 47 __ ADC T5 + 0
+0d15 : 85 1b __ STA ACCU + 0
+0d17 : 8a __ __ TXA
+0d18 : 65 48 __ ADC T5 + 1
+0d1a : 06 1b __ ASL ACCU + 0
+0d1c : 2a __ __ ROL
+0d1d : 85 1c __ STA ACCU + 1
+0d1f : 18 __ __ CLC
+0d20 : a5 1b __ LDA ACCU + 0
+0d22 : 65 49 __ ADC T6 + 0
+0d24 : aa __ __ TAX
+0d25 : a5 1c __ LDA ACCU + 1
+0d27 : 69 00 __ ADC #$00
+0d29 : a8 __ __ TAY
+0d2a : 38 __ __ SEC
+0d2b : 8a __ __ TXA
+0d2c : e9 30 __ SBC #$30
+0d2e : 85 47 __ STA T5 + 0
+0d30 : 98 __ __ TYA
+0d31 : e9 00 __ SBC #$00
+0d33 : 85 48 __ STA T5 + 1
+0d35 : a5 43 __ LDA T3 + 0
+0d37 : c9 30 __ CMP #$30
+0d39 : b0 b3 __ BCS $0cee
+0d3b : a5 47 __ LDA T5 + 0
+0d3d : 8d 36 23 STA $2336 ; (sframe + 1)
+0d40 : a5 43 __ LDA T3 + 0
+0d42 : c9 2e __ CMP #$2e
+0d44 : d0 03 __ BNE $0d49
+0d46 : 4c 22 14 JMP $1422 ; (sformat + 2169)
+0d49 : a5 43 __ LDA T3 + 0
+0d4b : c9 64 __ CMP #$64
+0d4d : d0 03 __ BNE $0d52
+0d4f : 4c 8c 12 JMP $128c ; (sformat + 1763)
+0d52 : c9 75 __ CMP #$75
+0d54 : d0 03 __ BNE $0d59
+0d56 : 4c 3b 11 JMP $113b ; (sformat + 1426)
+0d59 : c9 78 __ CMP #$78
+0d5b : d0 03 __ BNE $0d60
+0d5d : 4c d3 0f JMP $0fd3 ; (sformat + 1066)
+0d60 : c9 6c __ CMP #$6c
+0d62 : d0 03 __ BNE $0d67
+0d64 : 4c c6 0e JMP $0ec6 ; (sformat + 797)
+0d67 : c9 66 __ CMP #$66
+0d69 : d0 03 __ BNE $0d6e
+0d6b : 4c 55 0e JMP $0e55 ; (sformat + 684)
+0d6e : c9 67 __ CMP #$67
+0d70 : d0 03 __ BNE $0d75
+0d72 : 4c 55 0e JMP $0e55 ; (sformat + 684)
+0d75 : c9 65 __ CMP #$65
+0d77 : d0 03 __ BNE $0d7c
+0d79 : 4c 55 0e JMP $0e55 ; (sformat + 684)
+0d7c : c9 73 __ CMP #$73
+0d7e : f0 57 __ BEQ $0dd7
+0d80 : c9 63 __ CMP #$63
+0d82 : f0 1e __ BEQ $0da2
+0d84 : 09 00 __ ORA #$00
+0d86 : d0 03 __ BNE $0d8b
+0d88 : 4c 7b 0c JMP $0c7b ; (sformat + 210)
+0d8b : a5 43 __ LDA T3 + 0
+0d8d : a4 5f __ LDY T1 + 0
+0d8f : 91 5d __ STA (T0 + 0),y
+0d91 : e6 5f __ INC T1 + 0
+0d93 : a0 00 __ LDY #$00
+0d95 : b1 61 __ LDA (T2 + 0),y
+0d97 : 85 45 __ STA T4 + 0
+0d99 : e6 61 __ INC T2 + 0
+0d9b : d0 02 __ BNE $0d9f
+0d9d : e6 62 __ INC T2 + 1
+0d9f : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0da2 : a0 06 __ LDY #$06
+0da4 : b1 23 __ LDA (SP + 0),y
+0da6 : 85 47 __ STA T5 + 0
+0da8 : 18 __ __ CLC
+0da9 : 69 02 __ ADC #$02
+0dab : aa __ __ TAX
+0dac : c8 __ __ INY
+0dad : b1 23 __ LDA (SP + 0),y
+0daf : 85 48 __ STA T5 + 1
+0db1 : 69 00 __ ADC #$00
+0db3 : 85 4a __ STA T6 + 1
+0db5 : 8a __ __ TXA
+0db6 : 88 __ __ DEY
+0db7 : 91 23 __ STA (SP + 0),y
+0db9 : a5 4a __ LDA T6 + 1
+0dbb : c8 __ __ INY
+0dbc : 91 23 __ STA (SP + 0),y
+0dbe : a0 00 __ LDY #$00
+0dc0 : b1 47 __ LDA (T5 + 0),y
+0dc2 : a4 5f __ LDY T1 + 0
+0dc4 : 91 5d __ STA (T0 + 0),y
+0dc6 : e6 5f __ INC T1 + 0
+0dc8 : a0 00 __ LDY #$00
+0dca : b1 61 __ LDA (T2 + 0),y
+0dcc : 85 45 __ STA T4 + 0
+0dce : e6 61 __ INC T2 + 0
+0dd0 : d0 02 __ BNE $0dd4
+0dd2 : e6 62 __ INC T2 + 1
+0dd4 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0dd7 : a0 06 __ LDY #$06
+0dd9 : b1 23 __ LDA (SP + 0),y
+0ddb : 85 47 __ STA T5 + 0
+0ddd : 18 __ __ CLC
+0dde : 69 02 __ ADC #$02
+0de0 : aa __ __ TAX
+0de1 : c8 __ __ INY
+0de2 : b1 23 __ LDA (SP + 0),y
+0de4 : 85 48 __ STA T5 + 1
+0de6 : 69 00 __ ADC #$00
+0de8 : 85 4a __ STA T6 + 1
+0dea : 8a __ __ TXA
+0deb : 88 __ __ DEY
+0dec : 91 23 __ STA (SP + 0),y
+0dee : a5 4a __ LDA T6 + 1
+0df0 : c8 __ __ INY
+0df1 : 91 23 __ STA (SP + 0),y
+0df3 : a0 00 __ LDY #$00
+0df5 : b1 47 __ LDA (T5 + 0),y
+0df7 : 85 02 __ STA $02
+0df9 : c8 __ __ INY
+0dfa : b1 47 __ LDA (T5 + 0),y
+0dfc : 85 48 __ STA T5 + 1
+0dfe : a5 02 __ LDA $02
+0e00 : 85 47 __ STA T5 + 0
+0e02 : a0 08 __ LDY #$08
+0e04 : b1 23 __ LDA (SP + 0),y
+0e06 : d0 33 __ BNE $0e3b
+0e08 : a0 00 __ LDY #$00
+0e0a : b1 47 __ LDA (T5 + 0),y
+0e0c : 85 43 __ STA T3 + 0
+0e0e : d0 03 __ BNE $0e13
+0e10 : 4c 7b 0c JMP $0c7b ; (sformat + 210)
+0e13 : 18 __ __ CLC
+0e14 : a5 02 __ LDA $02
+0e16 : 69 01 __ ADC #$01
+0e18 : 85 47 __ STA T5 + 0
+0e1a : 90 02 __ BCC $0e1e
+0e1c : e6 48 __ INC T5 + 1
+0e1e : a5 43 __ LDA T3 + 0
+0e20 : a0 00 __ LDY #$00
+0e22 : 91 5d __ STA (T0 + 0),y
+0e24 : e6 5d __ INC T0 + 0
+0e26 : d0 02 __ BNE $0e2a
+0e28 : e6 5e __ INC T0 + 1
+0e2a : b1 47 __ LDA (T5 + 0),y
+0e2c : aa __ __ TAX
+0e2d : e6 47 __ INC T5 + 0
+0e2f : d0 02 __ BNE $0e33
+0e31 : e6 48 __ INC T5 + 1
+0e33 : 8a __ __ TXA
+0e34 : 86 43 __ STX T3 + 0
+0e36 : d0 e6 __ BNE $0e1e
+0e38 : 4c 7b 0c JMP $0c7b ; (sformat + 210)
+0e3b : a5 02 __ LDA $02
+0e3d : 85 0d __ STA P0
+0e3f : a5 48 __ LDA T5 + 1
+0e41 : 85 0e __ STA P1
+0e43 : 20 f2 14 JSR $14f2 ; (puts + 0)
+0e46 : a0 00 __ LDY #$00
+0e48 : b1 61 __ LDA (T2 + 0),y
+0e4a : 85 45 __ STA T4 + 0
+0e4c : e6 61 __ INC T2 + 0
+0e4e : d0 02 __ BNE $0e52
+0e50 : e6 62 __ INC T2 + 1
+0e52 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0e55 : a9 35 __ LDA #$35
+0e57 : 85 0d __ STA P0
+0e59 : a9 23 __ LDA #$23
+0e5b : 85 0e __ STA P1
+0e5d : a5 5d __ LDA T0 + 0
+0e5f : 85 0f __ STA P2
+0e61 : a5 5e __ LDA T0 + 1
+0e63 : 85 10 __ STA P3
+0e65 : a0 06 __ LDY #$06
+0e67 : b1 23 __ LDA (SP + 0),y
+0e69 : 85 47 __ STA T5 + 0
+0e6b : c8 __ __ INY
+0e6c : b1 23 __ LDA (SP + 0),y
+0e6e : 85 48 __ STA T5 + 1
+0e70 : a0 00 __ LDY #$00
+0e72 : b1 47 __ LDA (T5 + 0),y
+0e74 : 85 11 __ STA P4
+0e76 : c8 __ __ INY
+0e77 : b1 47 __ LDA (T5 + 0),y
+0e79 : 85 12 __ STA P5
+0e7b : c8 __ __ INY
+0e7c : b1 47 __ LDA (T5 + 0),y
+0e7e : 85 13 __ STA P6
+0e80 : c8 __ __ INY
+0e81 : b1 47 __ LDA (T5 + 0),y
+0e83 : 85 14 __ STA P7
+0e85 : 20 2c 17 JSR $172c ; (nformf + 0)
+0e88 : a5 1b __ LDA ACCU + 0
+0e8a : 85 5f __ STA T1 + 0
+0e8c : a0 06 __ LDY #$06
+0e8e : b1 23 __ LDA (SP + 0),y
+0e90 : 85 47 __ STA T5 + 0
+0e92 : 18 __ __ CLC
+0e93 : 69 02 __ ADC #$02
+0e95 : aa __ __ TAX
+0e96 : c8 __ __ INY
+0e97 : b1 23 __ LDA (SP + 0),y
+0e99 : 85 48 __ STA T5 + 1
+0e9b : 69 00 __ ADC #$00
+0e9d : 85 4a __ STA T6 + 1
+0e9f : 8a __ __ TXA
+0ea0 : 88 __ __ DEY
+0ea1 : 91 23 __ STA (SP + 0),y
+0ea3 : a5 4a __ LDA T6 + 1
+0ea5 : c8 __ __ INY
+0ea6 : 91 23 __ STA (SP + 0),y
+0ea8 : 18 __ __ CLC
+0ea9 : a5 47 __ LDA T5 + 0
+0eab : 69 04 __ ADC #$04
+0ead : 88 __ __ DEY
+0eae : 91 23 __ STA (SP + 0),y
+0eb0 : a5 48 __ LDA T5 + 1
+0eb2 : 69 00 __ ADC #$00
+0eb4 : c8 __ __ INY
+0eb5 : 91 23 __ STA (SP + 0),y
+0eb7 : a0 00 __ LDY #$00
+0eb9 : b1 61 __ LDA (T2 + 0),y
+0ebb : 85 45 __ STA T4 + 0
+0ebd : e6 61 __ INC T2 + 0
+0ebf : d0 02 __ BNE $0ec3
+0ec1 : e6 62 __ INC T2 + 1
+0ec3 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0ec6 : a0 06 __ LDY #$06
+0ec8 : b1 23 __ LDA (SP + 0),y
+0eca : 85 47 __ STA T5 + 0
+0ecc : 18 __ __ CLC
+0ecd : 69 02 __ ADC #$02
+0ecf : aa __ __ TAX
+0ed0 : c8 __ __ INY
+0ed1 : b1 23 __ LDA (SP + 0),y
+0ed3 : 85 48 __ STA T5 + 1
+0ed5 : a0 00 __ LDY #$00
+0ed7 : b1 47 __ LDA (T5 + 0),y
+0ed9 : 85 63 __ STA T10 + 0
+0edb : c8 __ __ INY
+0edc : b1 47 __ LDA (T5 + 0),y
+0ede : 85 64 __ STA T10 + 1
+0ee0 : c8 __ __ INY
+0ee1 : b1 47 __ LDA (T5 + 0),y
+0ee3 : 85 65 __ STA T10 + 2
+0ee5 : c8 __ __ INY
+0ee6 : b1 47 __ LDA (T5 + 0),y
+0ee8 : 85 66 __ STA T10 + 3
+0eea : a5 48 __ LDA T5 + 1
+0eec : 69 00 __ ADC #$00
+0eee : 85 4a __ STA T6 + 1
+0ef0 : 8a __ __ TXA
+0ef1 : a0 06 __ LDY #$06
+0ef3 : 91 23 __ STA (SP + 0),y
+0ef5 : a5 4a __ LDA T6 + 1
+0ef7 : c8 __ __ INY
+0ef8 : 91 23 __ STA (SP + 0),y
+0efa : 18 __ __ CLC
+0efb : a5 47 __ LDA T5 + 0
+0efd : 69 04 __ ADC #$04
+0eff : 88 __ __ DEY
+0f00 : 91 23 __ STA (SP + 0),y
+0f02 : a5 48 __ LDA T5 + 1
+0f04 : 69 00 __ ADC #$00
+0f06 : c8 __ __ INY
+0f07 : 91 23 __ STA (SP + 0),y
+0f09 : a0 00 __ LDY #$00
+0f0b : b1 61 __ LDA (T2 + 0),y
+0f0d : aa __ __ TAX
+0f0e : e6 61 __ INC T2 + 0
+0f10 : d0 02 __ BNE $0f14
+0f12 : e6 62 __ INC T2 + 1
+0f14 : 8a __ __ TXA
+0f15 : e0 64 __ CPX #$64
+0f17 : d0 03 __ BNE $0f1c
+0f19 : 4c 9d 0f JMP $0f9d ; (sformat + 1012)
+0f1c : c9 75 __ CMP #$75
+0f1e : f0 47 __ BEQ $0f67
+0f20 : c9 78 __ CMP #$78
+0f22 : f0 03 __ BEQ $0f27
+0f24 : 4c 7b 0c JMP $0c7b ; (sformat + 210)
+0f27 : a9 10 __ LDA #$10
+0f29 : 8d 38 23 STA $2338 ; (sframe + 3)
+0f2c : a9 00 __ LDA #$00
+0f2e : 8d 39 23 STA $2339 ; (sframe + 4)
+0f31 : a9 35 __ LDA #$35
+0f33 : 85 0d __ STA P0
+0f35 : a9 23 __ LDA #$23
+0f37 : 85 0e __ STA P1
+0f39 : a5 5d __ LDA T0 + 0
+0f3b : 85 0f __ STA P2
+0f3d : a5 5e __ LDA T0 + 1
+0f3f : 85 10 __ STA P3
+0f41 : a5 63 __ LDA T10 + 0
+0f43 : 85 11 __ STA P4
+0f45 : a5 64 __ LDA T10 + 1
+0f47 : 85 12 __ STA P5
+0f49 : a5 65 __ LDA T10 + 2
+0f4b : 85 13 __ STA P6
+0f4d : a5 66 __ LDA T10 + 3
+0f4f : 85 14 __ STA P7
+0f51 : 20 30 15 JSR $1530 ; (nforml + 0)
+0f54 : a5 1b __ LDA ACCU + 0
+0f56 : 85 5f __ STA T1 + 0
+0f58 : a0 00 __ LDY #$00
+0f5a : b1 61 __ LDA (T2 + 0),y
+0f5c : 85 45 __ STA T4 + 0
+0f5e : e6 61 __ INC T2 + 0
+0f60 : d0 02 __ BNE $0f64
+0f62 : e6 62 __ INC T2 + 1
+0f64 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0f67 : a9 35 __ LDA #$35
+0f69 : 85 0d __ STA P0
+0f6b : a9 23 __ LDA #$23
+0f6d : 85 0e __ STA P1
+0f6f : a5 5d __ LDA T0 + 0
+0f71 : 85 0f __ STA P2
+0f73 : a5 5e __ LDA T0 + 1
+0f75 : 85 10 __ STA P3
+0f77 : a5 63 __ LDA T10 + 0
+0f79 : 85 11 __ STA P4
+0f7b : a5 64 __ LDA T10 + 1
+0f7d : 85 12 __ STA P5
+0f7f : a5 65 __ LDA T10 + 2
+0f81 : 85 13 __ STA P6
+0f83 : a5 66 __ LDA T10 + 3
+0f85 : 85 14 __ STA P7
+0f87 : 20 30 15 JSR $1530 ; (nforml + 0)
+0f8a : a5 1b __ LDA ACCU + 0
+0f8c : 85 5f __ STA T1 + 0
+0f8e : a0 00 __ LDY #$00
+0f90 : b1 61 __ LDA (T2 + 0),y
+0f92 : 85 45 __ STA T4 + 0
+0f94 : e6 61 __ INC T2 + 0
+0f96 : d0 02 __ BNE $0f9a
+0f98 : e6 62 __ INC T2 + 1
+0f9a : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0f9d : a9 35 __ LDA #$35
+0f9f : 85 0d __ STA P0
+0fa1 : a9 23 __ LDA #$23
+0fa3 : 85 0e __ STA P1
+0fa5 : a5 5d __ LDA T0 + 0
+0fa7 : 85 0f __ STA P2
+0fa9 : a5 5e __ LDA T0 + 1
+0fab : 85 10 __ STA P3
+0fad : a5 63 __ LDA T10 + 0
+0faf : 85 11 __ STA P4
+0fb1 : a5 64 __ LDA T10 + 1
+0fb3 : 85 12 __ STA P5
+0fb5 : a5 65 __ LDA T10 + 2
+0fb7 : 85 13 __ STA P6
+0fb9 : a5 66 __ LDA T10 + 3
+0fbb : 85 14 __ STA P7
+0fbd : 20 30 15 JSR $1530 ; (nforml + 0)
+0fc0 : a5 1b __ LDA ACCU + 0
+0fc2 : 85 5f __ STA T1 + 0
+0fc4 : a0 00 __ LDY #$00
+0fc6 : b1 61 __ LDA (T2 + 0),y
+0fc8 : 85 45 __ STA T4 + 0
+0fca : e6 61 __ INC T2 + 0
+0fcc : d0 02 __ BNE $0fd0
+0fce : e6 62 __ INC T2 + 1
+0fd0 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+0fd3 : a9 10 __ LDA #$10
+0fd5 : 8d 38 23 STA $2338 ; (sframe + 3)
+0fd8 : a9 00 __ LDA #$00
+0fda : 8d 39 23 STA $2339 ; (sframe + 4)
+0fdd : a0 06 __ LDY #$06
+0fdf : b1 23 __ LDA (SP + 0),y
+0fe1 : 85 47 __ STA T5 + 0
+0fe3 : 18 __ __ CLC
+0fe4 : 69 02 __ ADC #$02
+0fe6 : aa __ __ TAX
+0fe7 : c8 __ __ INY
+0fe8 : b1 23 __ LDA (SP + 0),y
+0fea : 85 48 __ STA T5 + 1
+0fec : 69 00 __ ADC #$00
+0fee : 85 4a __ STA T6 + 1
+0ff0 : 8a __ __ TXA
+0ff1 : 88 __ __ DEY
+0ff2 : 91 23 __ STA (SP + 0),y
+0ff4 : a5 4a __ LDA T6 + 1
+0ff6 : c8 __ __ INY
+0ff7 : 91 23 __ STA (SP + 0),y
+0ff9 : a5 5d __ LDA T0 + 0
+0ffb : 85 49 __ STA T6 + 0
+0ffd : a5 5e __ LDA T0 + 1
+0fff : 85 4a __ STA T6 + 1
+1001 : a9 0a __ LDA #$0a
+1003 : 85 5f __ STA T1 + 0
+1005 : a0 00 __ LDY #$00
+1007 : b1 47 __ LDA (T5 + 0),y
+1009 : aa __ __ TAX
+100a : c8 __ __ INY
+100b : b1 47 __ LDA (T5 + 0),y
+100d : 86 47 __ STX T5 + 0
+100f : 85 48 __ STA T5 + 1
+1011 : 8a __ __ TXA
+1012 : 05 48 __ ORA T5 + 1
+1014 : f0 03 __ BEQ $1019
+1016 : 4c e3 10 JMP $10e3 ; (sformat + 1338)
+1019 : ad 37 23 LDA $2337 ; (sframe + 2)
+101c : c9 ff __ CMP #$ff
+101e : d0 03 __ BNE $1023
+1020 : 4c d5 10 JMP $10d5 ; (sformat + 1324)
+1023 : 38 __ __ SEC
+1024 : a9 0a __ LDA #$0a
+1026 : ed 37 23 SBC $2337 ; (sframe + 2)
+1029 : 85 43 __ STA T3 + 0
+102b : c5 5f __ CMP T1 + 0
+102d : b0 0e __ BCS $103d
+102f : c6 5f __ DEC T1 + 0
+1031 : a9 30 __ LDA #$30
+1033 : a4 5f __ LDY T1 + 0
+1035 : 91 49 __ STA (T6 + 0),y
+1037 : a5 43 __ LDA T3 + 0
+1039 : c5 5f __ CMP T1 + 0
+103b : 90 f2 __ BCC $102f
+103d : ad 3c 23 LDA $233c ; (sframe + 7)
+1040 : f0 33 __ BEQ $1075
+1042 : ad 38 23 LDA $2338 ; (sframe + 3)
+1045 : 85 47 __ STA T5 + 0
+1047 : ad 39 23 LDA $2339 ; (sframe + 4)
+104a : d0 29 __ BNE $1075
+104c : a5 47 __ LDA T5 + 0
+104e : c9 10 __ CMP #$10
+1050 : d0 23 __ BNE $1075
+1052 : 18 __ __ CLC
+1053 : a5 5f __ LDA T1 + 0
+1055 : 69 ff __ ADC #$ff
+1057 : 18 __ __ CLC
+1058 : 65 49 __ ADC T6 + 0
+105a : 85 47 __ STA T5 + 0
+105c : a5 4a __ LDA T6 + 1
+105e : 69 00 __ ADC #$00
+1060 : 85 48 __ STA T5 + 1
+1062 : a9 58 __ LDA #$58
+1064 : a0 00 __ LDY #$00
+1066 : 91 47 __ STA (T5 + 0),y
+1068 : 18 __ __ CLC
+1069 : a5 5f __ LDA T1 + 0
+106b : 69 fe __ ADC #$fe
+106d : 85 5f __ STA T1 + 0
+106f : a9 30 __ LDA #$30
+1071 : a4 5f __ LDY T1 + 0
+1073 : 91 49 __ STA (T6 + 0),y
+1075 : ad 3a 23 LDA $233a ; (sframe + 5)
+1078 : f0 08 __ BEQ $1082
+107a : c6 5f __ DEC T1 + 0
+107c : a9 2b __ LDA #$2b
+107e : a4 5f __ LDY T1 + 0
+1080 : 91 49 __ STA (T6 + 0),y
+1082 : 38 __ __ SEC
+1083 : a9 0a __ LDA #$0a
+1085 : ed 36 23 SBC $2336 ; (sframe + 1)
+1088 : 85 47 __ STA T5 + 0
+108a : a9 00 __ LDA #$00
+108c : e9 00 __ SBC #$00
+108e : 49 80 __ EOR #$80
+1090 : c9 80 __ CMP #$80
+1092 : d0 04 __ BNE $1098
+1094 : a5 47 __ LDA T5 + 0
+1096 : c5 5f __ CMP T1 + 0
+1098 : 90 2f __ BCC $10c9
+109a : a9 00 __ LDA #$00
+109c : 85 43 __ STA T3 + 0
+109e : a5 5f __ LDA T1 + 0
+10a0 : c9 0a __ CMP #$0a
+10a2 : b0 12 __ BCS $10b6
+10a4 : a4 5f __ LDY T1 + 0
+10a6 : b1 49 __ LDA (T6 + 0),y
+10a8 : a4 43 __ LDY T3 + 0
+10aa : 91 49 __ STA (T6 + 0),y
+10ac : e6 43 __ INC T3 + 0
+10ae : e6 5f __ INC T1 + 0
+10b0 : a5 5f __ LDA T1 + 0
+10b2 : c9 0a __ CMP #$0a
+10b4 : 90 ee __ BCC $10a4
+10b6 : a0 00 __ LDY #$00
+10b8 : b1 61 __ LDA (T2 + 0),y
+10ba : 85 45 __ STA T4 + 0
+10bc : e6 61 __ INC T2 + 0
+10be : d0 02 __ BNE $10c2
+10c0 : e6 62 __ INC T2 + 1
+10c2 : a5 43 __ LDA T3 + 0
+10c4 : 85 5f __ STA T1 + 0
+10c6 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+10c9 : c6 5f __ DEC T1 + 0
+10cb : ad 35 23 LDA $2335 ; (sframe + 0)
+10ce : a4 5f __ LDY T1 + 0
+10d0 : 91 49 __ STA (T6 + 0),y
+10d2 : 4c 82 10 JMP $1082 ; (sformat + 1241)
+10d5 : a9 09 __ LDA #$09
+10d7 : 85 43 __ STA T3 + 0
+10d9 : c5 5f __ CMP T1 + 0
+10db : b0 03 __ BCS $10e0
+10dd : 4c 2f 10 JMP $102f ; (sformat + 1158)
+10e0 : 4c 3d 10 JMP $103d ; (sformat + 1172)
+10e3 : a5 47 __ LDA T5 + 0
+10e5 : 85 1b __ STA ACCU + 0
+10e7 : a5 48 __ LDA T5 + 1
+10e9 : 85 1c __ STA ACCU + 1
+10eb : ad 38 23 LDA $2338 ; (sframe + 3)
+10ee : 85 03 __ STA $03
+10f0 : ad 39 23 LDA $2339 ; (sframe + 4)
+10f3 : 85 04 __ STA $04
+10f5 : 20 ec 20 JSR $20ec ; (divmod + 0)
+10f8 : a5 06 __ LDA $06
+10fa : 10 2f __ BPL $112b
+10fc : 18 __ __ CLC
+10fd : a5 05 __ LDA $05
+10ff : 69 30 __ ADC #$30
+1101 : c6 5f __ DEC T1 + 0
+1103 : a4 5f __ LDY T1 + 0
+1105 : 91 49 __ STA (T6 + 0),y
+1107 : a5 47 __ LDA T5 + 0
+1109 : 85 1b __ STA ACCU + 0
+110b : a5 48 __ LDA T5 + 1
+110d : 85 1c __ STA ACCU + 1
+110f : ad 38 23 LDA $2338 ; (sframe + 3)
+1112 : 85 03 __ STA $03
+1114 : ad 39 23 LDA $2339 ; (sframe + 4)
+1117 : 85 04 __ STA $04
+1119 : 20 ec 20 JSR $20ec ; (divmod + 0)
+111c : a5 1b __ LDA ACCU + 0
+111e : 85 47 __ STA T5 + 0
+1120 : a5 1c __ LDA ACCU + 1
+1122 : 85 48 __ STA T5 + 1
+1124 : 05 1b __ ORA ACCU + 0
+1126 : d0 bb __ BNE $10e3
+1128 : 4c 19 10 JMP $1019 ; (sformat + 1136)
+112b : d0 06 __ BNE $1133
+112d : a5 05 __ LDA $05
+112f : c9 0a __ CMP #$0a
+1131 : 90 c9 __ BCC $10fc
+1133 : 18 __ __ CLC
+1134 : a5 05 __ LDA $05
+1136 : 69 37 __ ADC #$37
+1138 : 4c 01 11 JMP $1101 ; (sformat + 1368)
+113b : a0 06 __ LDY #$06
+113d : b1 23 __ LDA (SP + 0),y
+113f : 85 47 __ STA T5 + 0
+1141 : 18 __ __ CLC
+1142 : 69 02 __ ADC #$02
+1144 : aa __ __ TAX
+1145 : c8 __ __ INY
+1146 : b1 23 __ LDA (SP + 0),y
+1148 : 85 48 __ STA T5 + 1
+114a : 69 00 __ ADC #$00
+114c : 85 4a __ STA T6 + 1
+114e : 8a __ __ TXA
+114f : 88 __ __ DEY
+1150 : 91 23 __ STA (SP + 0),y
+1152 : a5 4a __ LDA T6 + 1
+1154 : c8 __ __ INY
+1155 : 91 23 __ STA (SP + 0),y
+1157 : a5 5d __ LDA T0 + 0
+1159 : 85 49 __ STA T6 + 0
+115b : a5 5e __ LDA T0 + 1
+115d : 85 4a __ STA T6 + 1
+115f : a9 0a __ LDA #$0a
+1161 : 85 5f __ STA T1 + 0
+1163 : a0 00 __ LDY #$00
+1165 : b1 47 __ LDA (T5 + 0),y
+1167 : aa __ __ TAX
+1168 : c8 __ __ INY
+1169 : b1 47 __ LDA (T5 + 0),y
+116b : 86 47 __ STX T5 + 0
+116d : 85 48 __ STA T5 + 1
+116f : 8a __ __ TXA
+1170 : 05 48 __ ORA T5 + 1
+1172 : f0 03 __ BEQ $1177
+1174 : 4c 34 12 JMP $1234 ; (sformat + 1675)
+1177 : ad 37 23 LDA $2337 ; (sframe + 2)
+117a : c9 ff __ CMP #$ff
+117c : d0 03 __ BNE $1181
+117e : 4c 26 12 JMP $1226 ; (sformat + 1661)
+1181 : 38 __ __ SEC
+1182 : a9 0a __ LDA #$0a
+1184 : ed 37 23 SBC $2337 ; (sframe + 2)
+1187 : 85 43 __ STA T3 + 0
+1189 : c5 5f __ CMP T1 + 0
+118b : b0 0e __ BCS $119b
+118d : c6 5f __ DEC T1 + 0
+118f : a9 30 __ LDA #$30
+1191 : a4 5f __ LDY T1 + 0
+1193 : 91 49 __ STA (T6 + 0),y
+1195 : a5 43 __ LDA T3 + 0
+1197 : c5 5f __ CMP T1 + 0
+1199 : 90 f2 __ BCC $118d
+119b : ad 3c 23 LDA $233c ; (sframe + 7)
+119e : f0 33 __ BEQ $11d3
+11a0 : ad 38 23 LDA $2338 ; (sframe + 3)
+11a3 : 85 47 __ STA T5 + 0
+11a5 : ad 39 23 LDA $2339 ; (sframe + 4)
+11a8 : d0 29 __ BNE $11d3
+11aa : a5 47 __ LDA T5 + 0
+11ac : c9 10 __ CMP #$10
+11ae : d0 23 __ BNE $11d3
+11b0 : 18 __ __ CLC
+11b1 : a5 5f __ LDA T1 + 0
+11b3 : 69 ff __ ADC #$ff
+11b5 : 18 __ __ CLC
+11b6 : 65 49 __ ADC T6 + 0
+11b8 : 85 47 __ STA T5 + 0
+11ba : a5 4a __ LDA T6 + 1
+11bc : 69 00 __ ADC #$00
+11be : 85 48 __ STA T5 + 1
+11c0 : a9 58 __ LDA #$58
+11c2 : a0 00 __ LDY #$00
+11c4 : 91 47 __ STA (T5 + 0),y
+11c6 : 18 __ __ CLC
+11c7 : a5 5f __ LDA T1 + 0
+11c9 : 69 fe __ ADC #$fe
+11cb : 85 5f __ STA T1 + 0
+11cd : a9 30 __ LDA #$30
+11cf : a4 5f __ LDY T1 + 0
+11d1 : 91 49 __ STA (T6 + 0),y
+11d3 : ad 3a 23 LDA $233a ; (sframe + 5)
+11d6 : f0 08 __ BEQ $11e0
+11d8 : c6 5f __ DEC T1 + 0
+11da : a9 2b __ LDA #$2b
+11dc : a4 5f __ LDY T1 + 0
+11de : 91 49 __ STA (T6 + 0),y
+11e0 : 38 __ __ SEC
+11e1 : a9 0a __ LDA #$0a
+11e3 : ed 36 23 SBC $2336 ; (sframe + 1)
+11e6 : 85 47 __ STA T5 + 0
+11e8 : a9 00 __ LDA #$00
+11ea : e9 00 __ SBC #$00
+11ec : 49 80 __ EOR #$80
+11ee : c9 80 __ CMP #$80
+11f0 : d0 04 __ BNE $11f6
+11f2 : a5 47 __ LDA T5 + 0
+11f4 : c5 5f __ CMP T1 + 0
+11f6 : 90 22 __ BCC $121a
+11f8 : a9 00 __ LDA #$00
+11fa : 85 43 __ STA T3 + 0
+11fc : a5 5f __ LDA T1 + 0
+11fe : c9 0a __ CMP #$0a
+1200 : 90 03 __ BCC $1205
+1202 : 4c b6 10 JMP $10b6 ; (sformat + 1293)
+1205 : a4 5f __ LDY T1 + 0
+1207 : b1 49 __ LDA (T6 + 0),y
+1209 : a4 43 __ LDY T3 + 0
+120b : 91 49 __ STA (T6 + 0),y
+120d : e6 43 __ INC T3 + 0
+120f : e6 5f __ INC T1 + 0
+1211 : a5 5f __ LDA T1 + 0
+1213 : c9 0a __ CMP #$0a
+1215 : 90 ee __ BCC $1205
+1217 : 4c b6 10 JMP $10b6 ; (sformat + 1293)
+121a : c6 5f __ DEC T1 + 0
+121c : ad 35 23 LDA $2335 ; (sframe + 0)
+121f : a4 5f __ LDY T1 + 0
+1221 : 91 49 __ STA (T6 + 0),y
+1223 : 4c e0 11 JMP $11e0 ; (sformat + 1591)
+1226 : a9 09 __ LDA #$09
+1228 : 85 43 __ STA T3 + 0
+122a : c5 5f __ CMP T1 + 0
+122c : b0 03 __ BCS $1231
+122e : 4c 8d 11 JMP $118d ; (sformat + 1508)
+1231 : 4c 9b 11 JMP $119b ; (sformat + 1522)
+1234 : a5 47 __ LDA T5 + 0
+1236 : 85 1b __ STA ACCU + 0
+1238 : a5 48 __ LDA T5 + 1
+123a : 85 1c __ STA ACCU + 1
+123c : ad 38 23 LDA $2338 ; (sframe + 3)
+123f : 85 03 __ STA $03
+1241 : ad 39 23 LDA $2339 ; (sframe + 4)
+1244 : 85 04 __ STA $04
+1246 : 20 ec 20 JSR $20ec ; (divmod + 0)
+1249 : a5 06 __ LDA $06
+124b : 10 2f __ BPL $127c
+124d : 18 __ __ CLC
+124e : a5 05 __ LDA $05
+1250 : 69 30 __ ADC #$30
+1252 : c6 5f __ DEC T1 + 0
+1254 : a4 5f __ LDY T1 + 0
+1256 : 91 49 __ STA (T6 + 0),y
+1258 : a5 47 __ LDA T5 + 0
+125a : 85 1b __ STA ACCU + 0
+125c : a5 48 __ LDA T5 + 1
+125e : 85 1c __ STA ACCU + 1
+1260 : ad 38 23 LDA $2338 ; (sframe + 3)
+1263 : 85 03 __ STA $03
+1265 : ad 39 23 LDA $2339 ; (sframe + 4)
+1268 : 85 04 __ STA $04
+126a : 20 ec 20 JSR $20ec ; (divmod + 0)
+126d : a5 1b __ LDA ACCU + 0
+126f : 85 47 __ STA T5 + 0
+1271 : a5 1c __ LDA ACCU + 1
+1273 : 85 48 __ STA T5 + 1
+1275 : 05 1b __ ORA ACCU + 0
+1277 : d0 bb __ BNE $1234
+1279 : 4c 77 11 JMP $1177 ; (sformat + 1486)
+127c : d0 06 __ BNE $1284
+127e : a5 05 __ LDA $05
+1280 : c9 0a __ CMP #$0a
+1282 : 90 c9 __ BCC $124d
+1284 : 18 __ __ CLC
+1285 : a5 05 __ LDA $05
+1287 : 69 37 __ ADC #$37
+1289 : 4c 52 12 JMP $1252 ; (sformat + 1705)
+128c : a0 06 __ LDY #$06
+128e : b1 23 __ LDA (SP + 0),y
+1290 : 85 47 __ STA T5 + 0
+1292 : 18 __ __ CLC
+1293 : 69 02 __ ADC #$02
+1295 : aa __ __ TAX
+1296 : c8 __ __ INY
+1297 : b1 23 __ LDA (SP + 0),y
+1299 : 85 48 __ STA T5 + 1
+129b : 69 00 __ ADC #$00
+129d : 85 4a __ STA T6 + 1
+129f : 8a __ __ TXA
+12a0 : 88 __ __ DEY
+12a1 : 91 23 __ STA (SP + 0),y
+12a3 : a5 4a __ LDA T6 + 1
+12a5 : c8 __ __ INY
+12a6 : 91 23 __ STA (SP + 0),y
+12a8 : a5 5d __ LDA T0 + 0
+12aa : 85 49 __ STA T6 + 0
+12ac : a5 5e __ LDA T0 + 1
+12ae : 85 4a __ STA T6 + 1
+12b0 : a0 00 __ LDY #$00
+12b2 : b1 47 __ LDA (T5 + 0),y
+12b4 : 85 02 __ STA $02
+12b6 : c8 __ __ INY
+12b7 : b1 47 __ LDA (T5 + 0),y
+12b9 : 85 48 __ STA T5 + 1
+12bb : 10 03 __ BPL $12c0
+12bd : 4c 06 14 JMP $1406 ; (sformat + 2141)
+12c0 : a5 02 __ LDA $02
+12c2 : 85 4b __ STA T7 + 0
+12c4 : a5 48 __ LDA T5 + 1
+12c6 : 85 4c __ STA T7 + 1
+12c8 : a9 00 __ LDA #$00
+12ca : 85 5f __ STA T1 + 0
+12cc : a9 0a __ LDA #$0a
+12ce : 85 43 __ STA T3 + 0
+12d0 : a5 02 __ LDA $02
+12d2 : 05 48 __ ORA T5 + 1
+12d4 : f0 03 __ BEQ $12d9
+12d6 : 4c ae 13 JMP $13ae ; (sformat + 2053)
+12d9 : ad 37 23 LDA $2337 ; (sframe + 2)
+12dc : c9 ff __ CMP #$ff
+12de : d0 03 __ BNE $12e3
+12e0 : 4c a0 13 JMP $13a0 ; (sformat + 2039)
+12e3 : 38 __ __ SEC
+12e4 : a9 0a __ LDA #$0a
+12e6 : ed 37 23 SBC $2337 ; (sframe + 2)
+12e9 : 85 45 __ STA T4 + 0
+12eb : c5 43 __ CMP T3 + 0
+12ed : b0 0e __ BCS $12fd
+12ef : c6 43 __ DEC T3 + 0
+12f1 : a9 30 __ LDA #$30
+12f3 : a4 43 __ LDY T3 + 0
+12f5 : 91 49 __ STA (T6 + 0),y
+12f7 : a5 45 __ LDA T4 + 0
+12f9 : c5 43 __ CMP T3 + 0
+12fb : 90 f2 __ BCC $12ef
+12fd : ad 3c 23 LDA $233c ; (sframe + 7)
+1300 : f0 33 __ BEQ $1335
+1302 : ad 38 23 LDA $2338 ; (sframe + 3)
+1305 : 85 47 __ STA T5 + 0
+1307 : ad 39 23 LDA $2339 ; (sframe + 4)
+130a : d0 29 __ BNE $1335
+130c : a5 47 __ LDA T5 + 0
+130e : c9 10 __ CMP #$10
+1310 : d0 23 __ BNE $1335
+1312 : 18 __ __ CLC
+1313 : a5 43 __ LDA T3 + 0
+1315 : 69 ff __ ADC #$ff
+1317 : 18 __ __ CLC
+1318 : 65 49 __ ADC T6 + 0
+131a : 85 47 __ STA T5 + 0
+131c : a5 4a __ LDA T6 + 1
+131e : 69 00 __ ADC #$00
+1320 : 85 48 __ STA T5 + 1
+1322 : a9 58 __ LDA #$58
+1324 : a0 00 __ LDY #$00
+1326 : 91 47 __ STA (T5 + 0),y
+1328 : 18 __ __ CLC
+1329 : a5 43 __ LDA T3 + 0
+132b : 69 fe __ ADC #$fe
+132d : 85 43 __ STA T3 + 0
+132f : a9 30 __ LDA #$30
+1331 : a4 43 __ LDY T3 + 0
+1333 : 91 49 __ STA (T6 + 0),y
+1335 : a5 5f __ LDA T1 + 0
+1337 : d0 5c __ BNE $1395
+1339 : ad 3a 23 LDA $233a ; (sframe + 5)
+133c : f0 08 __ BEQ $1346
+133e : c6 43 __ DEC T3 + 0
+1340 : a9 2b __ LDA #$2b
+1342 : a4 43 __ LDY T3 + 0
+1344 : 91 49 __ STA (T6 + 0),y
+1346 : 38 __ __ SEC
+1347 : a9 0a __ LDA #$0a
+1349 : ed 36 23 SBC $2336 ; (sframe + 1)
+134c : 85 47 __ STA T5 + 0
+134e : a9 00 __ LDA #$00
+1350 : e9 00 __ SBC #$00
+1352 : 49 80 __ EOR #$80
+1354 : c9 80 __ CMP #$80
+1356 : d0 04 __ BNE $135c
+1358 : a5 47 __ LDA T5 + 0
+135a : c5 43 __ CMP T3 + 0
+135c : 90 2b __ BCC $1389
+135e : a9 00 __ LDA #$00
+1360 : 85 5f __ STA T1 + 0
+1362 : a5 43 __ LDA T3 + 0
+1364 : c9 0a __ CMP #$0a
+1366 : b0 12 __ BCS $137a
+1368 : a4 43 __ LDY T3 + 0
+136a : b1 49 __ LDA (T6 + 0),y
+136c : a4 5f __ LDY T1 + 0
+136e : 91 49 __ STA (T6 + 0),y
+1370 : e6 5f __ INC T1 + 0
+1372 : e6 43 __ INC T3 + 0
+1374 : a5 43 __ LDA T3 + 0
+1376 : c9 0a __ CMP #$0a
+1378 : 90 ee __ BCC $1368
+137a : a0 00 __ LDY #$00
+137c : b1 61 __ LDA (T2 + 0),y
+137e : 85 45 __ STA T4 + 0
+1380 : e6 61 __ INC T2 + 0
+1382 : d0 02 __ BNE $1386
+1384 : e6 62 __ INC T2 + 1
+1386 : 4c 45 0c JMP $0c45 ; (sformat + 156)
+1389 : c6 43 __ DEC T3 + 0
+138b : ad 35 23 LDA $2335 ; (sframe + 0)
+138e : a4 43 __ LDY T3 + 0
+1390 : 91 49 __ STA (T6 + 0),y
+1392 : 4c 46 13 JMP $1346 ; (sformat + 1949)
+1395 : c6 43 __ DEC T3 + 0
+1397 : a9 2d __ LDA #$2d
+1399 : a4 43 __ LDY T3 + 0
+139b : 91 49 __ STA (T6 + 0),y
+139d : 4c 46 13 JMP $1346 ; (sformat + 1949)
+13a0 : a9 09 __ LDA #$09
+13a2 : 85 45 __ STA T4 + 0
+13a4 : c5 43 __ CMP T3 + 0
+13a6 : b0 03 __ BCS $13ab
+13a8 : 4c ef 12 JMP $12ef ; (sformat + 1862)
+13ab : 4c fd 12 JMP $12fd ; (sformat + 1876)
+13ae : a5 4b __ LDA T7 + 0
+13b0 : 85 1b __ STA ACCU + 0
+13b2 : a5 4c __ LDA T7 + 1
+13b4 : 85 1c __ STA ACCU + 1
+13b6 : ad 38 23 LDA $2338 ; (sframe + 3)
+13b9 : 85 03 __ STA $03
+13bb : ad 39 23 LDA $2339 ; (sframe + 4)
+13be : 85 04 __ STA $04
+13c0 : 20 ec 20 JSR $20ec ; (divmod + 0)
+13c3 : a5 06 __ LDA $06
+13c5 : 10 2f __ BPL $13f6
+13c7 : 18 __ __ CLC
+13c8 : a5 05 __ LDA $05
+13ca : 69 30 __ ADC #$30
+13cc : c6 43 __ DEC T3 + 0
+13ce : a4 43 __ LDY T3 + 0
+13d0 : 91 49 __ STA (T6 + 0),y
+13d2 : a5 4b __ LDA T7 + 0
+13d4 : 85 1b __ STA ACCU + 0
+13d6 : a5 4c __ LDA T7 + 1
+13d8 : 85 1c __ STA ACCU + 1
+13da : ad 38 23 LDA $2338 ; (sframe + 3)
+13dd : 85 03 __ STA $03
+13df : ad 39 23 LDA $2339 ; (sframe + 4)
+13e2 : 85 04 __ STA $04
+13e4 : 20 ec 20 JSR $20ec ; (divmod + 0)
+13e7 : a5 1b __ LDA ACCU + 0
+13e9 : 85 4b __ STA T7 + 0
+13eb : a5 1c __ LDA ACCU + 1
+13ed : 85 4c __ STA T7 + 1
+13ef : 05 1b __ ORA ACCU + 0
+13f1 : d0 bb __ BNE $13ae
+13f3 : 4c d9 12 JMP $12d9 ; (sformat + 1840)
+13f6 : d0 06 __ BNE $13fe
+13f8 : a5 05 __ LDA $05
+13fa : c9 0a __ CMP #$0a
+13fc : 90 c9 __ BCC $13c7
+13fe : 18 __ __ CLC
+13ff : a5 05 __ LDA $05
+1401 : 69 37 __ ADC #$37
+1403 : 4c cc 13 JMP $13cc ; (sformat + 2083)
+1406 : a9 01 __ LDA #$01
+1408 : 85 5f __ STA T1 + 0
+140a : a9 0a __ LDA #$0a
+140c : 85 43 __ STA T3 + 0
+140e : 38 __ __ SEC
+140f : a9 00 __ LDA #$00
+1411 : e5 02 __ SBC $02
+1413 : 85 4b __ STA T7 + 0
+1415 : a9 00 __ LDA #$00
+1417 : e5 48 __ SBC T5 + 1
+1419 : 85 4c __ STA T7 + 1
+141b : 05 4b __ ORA T7 + 0
+141d : d0 8f __ BNE $13ae
+141f : 4c d9 12 JMP $12d9 ; (sformat + 1840)
+1422 : a9 00 __ LDA #$00
+1424 : 85 47 __ STA T5 + 0
+1426 : 85 48 __ STA T5 + 1
+1428 : a0 00 __ LDY #$00
+142a : b1 61 __ LDA (T2 + 0),y
+142c : 85 43 __ STA T3 + 0
+142e : e6 61 __ INC T2 + 0
+1430 : d0 02 __ BNE $1434
+1432 : e6 62 __ INC T2 + 1
+1434 : a5 43 __ LDA T3 + 0
+1436 : c9 30 __ CMP #$30
+1438 : 90 4d __ BCC $1487
+143a : a9 39 __ LDA #$39
+143c : c5 43 __ CMP T3 + 0
+143e : 90 47 __ BCC $1487
+1440 : a5 43 __ LDA T3 + 0
+1442 : 85 49 __ STA T6 + 0
+1444 : a0 00 __ LDY #$00
+1446 : b1 61 __ LDA (T2 + 0),y
+1448 : 85 43 __ STA T3 + 0
+144a : e6 61 __ INC T2 + 0
+144c : d0 02 __ BNE $1450
+144e : e6 62 __ INC T2 + 1
+1450 : a5 47 __ LDA T5 + 0
+1452 : 0a __ __ ASL
+1453 : 85 07 __ STA $07
+1455 : a5 48 __ LDA T5 + 1
+1457 : 2a __ __ ROL
+1458 : 06 07 __ ASL $07
+145a : 2a __ __ ROL
+145b : aa __ __ TAX
+145c : 18 __ __ CLC
+145d : a5 07 __ LDA $07
+145f : 65 47 __ ADC T5 + 0
+1461 : 85 1b __ STA ACCU + 0
+1463 : 8a __ __ TXA
+1464 : 65 48 __ ADC T5 + 1
+1466 : 06 1b __ ASL ACCU + 0
+1468 : 2a __ __ ROL
+1469 : 85 1c __ STA ACCU + 1
+146b : 18 __ __ CLC
+146c : a5 1b __ LDA ACCU + 0
+146e : 65 49 __ ADC T6 + 0
+1470 : aa __ __ TAX
+1471 : a5 1c __ LDA ACCU + 1
+1473 : 69 00 __ ADC #$00
+1475 : a8 __ __ TAY
+1476 : 38 __ __ SEC
+1477 : 8a __ __ TXA
+1478 : e9 30 __ SBC #$30
+147a : 85 47 __ STA T5 + 0
+147c : 98 __ __ TYA
+147d : e9 00 __ SBC #$00
+147f : 85 48 __ STA T5 + 1
+1481 : a5 43 __ LDA T3 + 0
+1483 : c9 30 __ CMP #$30
+1485 : b0 b3 __ BCS $143a
+1487 : a5 47 __ LDA T5 + 0
+1489 : 8d 37 23 STA $2337 ; (sframe + 2)
+148c : 4c 49 0d JMP $0d49 ; (sformat + 416)
+148f : a9 01 __ LDA #$01
+1491 : 8d 3c 23 STA $233c ; (sframe + 7)
+1494 : a0 00 __ LDY #$00
+1496 : b1 61 __ LDA (T2 + 0),y
+1498 : 85 43 __ STA T3 + 0
+149a : 4c bb 0c JMP $0cbb ; (sformat + 274)
+149d : a9 30 __ LDA #$30
+149f : 8d 35 23 STA $2335 ; (sframe + 0)
+14a2 : a0 00 __ LDY #$00
+14a4 : b1 61 __ LDA (T2 + 0),y
+14a6 : 85 43 __ STA T3 + 0
+14a8 : 4c bb 0c JMP $0cbb ; (sformat + 274)
+14ab : a9 01 __ LDA #$01
+14ad : 8d 3a 23 STA $233a ; (sframe + 5)
+14b0 : a0 00 __ LDY #$00
+14b2 : b1 61 __ LDA (T2 + 0),y
+14b4 : 85 43 __ STA T3 + 0
+14b6 : 4c bb 0c JMP $0cbb ; (sformat + 274)
+14b9 : a0 08 __ LDY #$08
+14bb : b1 23 __ LDA (SP + 0),y
+14bd : d0 12 __ BNE $14d1
+14bf : 18 __ __ CLC
+14c0 : a5 5d __ LDA T0 + 0
+14c2 : 65 5f __ ADC T1 + 0
+14c4 : 85 5d __ STA T0 + 0
+14c6 : 90 02 __ BCC $14ca
+14c8 : e6 5e __ INC T0 + 1
+14ca : a9 00 __ LDA #$00
+14cc : 85 5f __ STA T1 + 0
+14ce : 4c 91 0c JMP $0c91 ; (sformat + 232)
+14d1 : 18 __ __ CLC
+14d2 : a5 5d __ LDA T0 + 0
+14d4 : 85 0d __ STA P0
+14d6 : 65 5f __ ADC T1 + 0
+14d8 : 85 47 __ STA T5 + 0
+14da : a5 5e __ LDA T0 + 1
+14dc : 85 0e __ STA P1
+14de : 69 00 __ ADC #$00
+14e0 : 85 48 __ STA T5 + 1
+14e2 : a9 00 __ LDA #$00
+14e4 : a0 00 __ LDY #$00
+14e6 : 91 47 __ STA (T5 + 0),y
+14e8 : 20 f2 14 JSR $14f2 ; (puts + 0)
+14eb : a9 00 __ LDA #$00
+14ed : 85 5f __ STA T1 + 0
+14ef : 4c 91 0c JMP $0c91 ; (sformat + 232)
+--------------------------------------------------------------------
+puts:
+14f2 : a0 00 __ LDY #$00
+14f4 : b1 0d __ LDA (P0),y
+14f6 : f0 0b __ BEQ $1503
+14f8 : 20 04 15 JSR $1504 ; (putpch + 0)
+14fb : e6 0d __ INC P0
+14fd : d0 f3 __ BNE $14f2
+14ff : e6 0e __ INC P1
+1501 : d0 ef __ BNE $14f2
+1503 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+1504 : ae d0 22 LDX $22d0 ; (giocharmap + 0)
+1507 : e0 01 __ CPX #$01
+1509 : 90 22 __ BCC $152d
+150b : c9 0a __ CMP #$0a
+150d : d0 02 __ BNE $1511
+150f : a9 0d __ LDA #$0d
+1511 : e0 02 __ CPX #$02
+1513 : 90 18 __ BCC $152d
+1515 : c9 41 __ CMP #$41
+1517 : 90 14 __ BCC $152d
+1519 : c9 7b __ CMP #$7b
+151b : b0 10 __ BCS $152d
+151d : c9 61 __ CMP #$61
+151f : b0 04 __ BCS $1525
+1521 : c9 5b __ CMP #$5b
+1523 : b0 08 __ BCS $152d
+1525 : 49 20 __ EOR #$20
+1527 : e0 03 __ CPX #$03
+1529 : f0 02 __ BEQ $152d
+152b : 29 df __ AND #$df
+152d : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+1530 : a5 11 __ LDA P4
+1532 : 85 47 __ STA T1 + 0
+1534 : a5 12 __ LDA P5
+1536 : 85 48 __ STA T1 + 1
+1538 : a5 13 __ LDA P6
+153a : 85 49 __ STA T1 + 2
+153c : a5 14 __ LDA P7
+153e : 85 4a __ STA T1 + 3
+1540 : a9 00 __ LDA #$00
+1542 : 85 4d __ STA T3 + 0
+1544 : a5 15 __ LDA P8
+1546 : f0 03 __ BEQ $154b
+1548 : 4c d7 16 JMP $16d7 ; (nforml + 423)
+154b : a9 10 __ LDA #$10
+154d : 85 4e __ STA T4 + 0
+154f : a9 00 __ LDA #$00
+1551 : c5 14 __ CMP P7
+1553 : d0 0a __ BNE $155f
+1555 : c5 13 __ CMP P6
+1557 : d0 06 __ BNE $155f
+1559 : c5 12 __ CMP P5
+155b : d0 02 __ BNE $155f
+155d : c5 11 __ CMP P4
+155f : b0 03 __ BCS $1564
+1561 : 4c 4b 16 JMP $164b ; (nforml + 283)
+1564 : a0 02 __ LDY #$02
+1566 : b1 0d __ LDA (P0),y
+1568 : 85 4f __ STA T5 + 0
+156a : c9 ff __ CMP #$ff
+156c : d0 03 __ BNE $1571
+156e : 4c 3d 16 JMP $163d ; (nforml + 269)
+1571 : 38 __ __ SEC
+1572 : a9 10 __ LDA #$10
+1574 : e5 4f __ SBC T5 + 0
+1576 : 85 4f __ STA T5 + 0
+1578 : c5 4e __ CMP T4 + 0
+157a : b0 0e __ BCS $158a
+157c : c6 4e __ DEC T4 + 0
+157e : a9 30 __ LDA #$30
+1580 : a4 4e __ LDY T4 + 0
+1582 : 91 0f __ STA (P2),y
+1584 : a5 4f __ LDA T5 + 0
+1586 : c5 4e __ CMP T4 + 0
+1588 : 90 f2 __ BCC $157c
+158a : a0 07 __ LDY #$07
+158c : b1 0d __ LDA (P0),y
+158e : f0 34 __ BEQ $15c4
+1590 : a0 03 __ LDY #$03
+1592 : b1 0d __ LDA (P0),y
+1594 : 85 53 __ STA T7 + 0
+1596 : c8 __ __ INY
+1597 : b1 0d __ LDA (P0),y
+1599 : d0 29 __ BNE $15c4
+159b : a5 53 __ LDA T7 + 0
+159d : c9 10 __ CMP #$10
+159f : d0 23 __ BNE $15c4
+15a1 : 18 __ __ CLC
+15a2 : a5 4e __ LDA T4 + 0
+15a4 : 69 ff __ ADC #$ff
+15a6 : 18 __ __ CLC
+15a7 : 65 0f __ ADC P2
+15a9 : 85 53 __ STA T7 + 0
+15ab : a5 10 __ LDA P3
+15ad : 69 00 __ ADC #$00
+15af : 85 54 __ STA T7 + 1
+15b1 : a9 58 __ LDA #$58
+15b3 : a0 00 __ LDY #$00
+15b5 : 91 53 __ STA (T7 + 0),y
+15b7 : 18 __ __ CLC
+15b8 : a5 4e __ LDA T4 + 0
+15ba : 69 fe __ ADC #$fe
+15bc : 85 4e __ STA T4 + 0
+15be : a9 30 __ LDA #$30
+15c0 : a4 4e __ LDY T4 + 0
+15c2 : 91 0f __ STA (P2),y
+15c4 : a5 4d __ LDA T3 + 0
+15c6 : d0 6a __ BNE $1632
+15c8 : a0 05 __ LDY #$05
+15ca : b1 0d __ LDA (P0),y
+15cc : f0 08 __ BEQ $15d6
+15ce : c6 4e __ DEC T4 + 0
+15d0 : a9 2b __ LDA #$2b
+15d2 : a4 4e __ LDY T4 + 0
+15d4 : 91 0f __ STA (P2),y
+15d6 : a0 01 __ LDY #$01
+15d8 : b1 0d __ LDA (P0),y
+15da : 85 53 __ STA T7 + 0
+15dc : 38 __ __ SEC
+15dd : a9 10 __ LDA #$10
+15df : e5 53 __ SBC T7 + 0
+15e1 : 85 53 __ STA T7 + 0
+15e3 : a9 00 __ LDA #$00
+15e5 : e9 00 __ SBC #$00
+15e7 : 49 80 __ EOR #$80
+15e9 : c9 80 __ CMP #$80
+15eb : d0 04 __ BNE $15f1
+15ed : a5 53 __ LDA T7 + 0
+15ef : c5 4e __ CMP T4 + 0
+15f1 : 90 32 __ BCC $1625
+15f3 : a9 00 __ LDA #$00
+15f5 : 85 4d __ STA T3 + 0
+15f7 : a5 4e __ LDA T4 + 0
+15f9 : c9 10 __ CMP #$10
+15fb : 90 09 __ BCC $1606
+15fd : a5 4d __ LDA T3 + 0
+15ff : 85 1b __ STA ACCU + 0
+1601 : a9 00 __ LDA #$00
+1603 : 85 1c __ STA ACCU + 1
+1605 : 60 __ __ RTS
+1606 : aa __ __ TAX
+1607 : 8a __ __ TXA
+1608 : 18 __ __ CLC
+1609 : 65 0f __ ADC P2
+160b : 85 51 __ STA T6 + 0
+160d : a5 10 __ LDA P3
+160f : 69 00 __ ADC #$00
+1611 : 85 52 __ STA T6 + 1
+1613 : a0 00 __ LDY #$00
+1615 : b1 51 __ LDA (T6 + 0),y
+1617 : a4 4d __ LDY T3 + 0
+1619 : 91 0f __ STA (P2),y
+161b : e6 4d __ INC T3 + 0
+161d : e8 __ __ INX
+161e : e0 10 __ CPX #$10
+1620 : 90 e5 __ BCC $1607
+1622 : 4c fd 15 JMP $15fd ; (nforml + 205)
+1625 : c6 4e __ DEC T4 + 0
+1627 : a0 00 __ LDY #$00
+1629 : b1 0d __ LDA (P0),y
+162b : a4 4e __ LDY T4 + 0
+162d : 91 0f __ STA (P2),y
+162f : 4c d6 15 JMP $15d6 ; (nforml + 166)
+1632 : c6 4e __ DEC T4 + 0
+1634 : a9 2d __ LDA #$2d
+1636 : a4 4e __ LDY T4 + 0
+1638 : 91 0f __ STA (P2),y
+163a : 4c d6 15 JMP $15d6 ; (nforml + 166)
+163d : a9 0f __ LDA #$0f
+163f : 85 4f __ STA T5 + 0
+1641 : c5 4e __ CMP T4 + 0
+1643 : b0 03 __ BCS $1648
+1645 : 4c 7c 15 JMP $157c ; (nforml + 76)
+1648 : 4c 8a 15 JMP $158a ; (nforml + 90)
+164b : a0 03 __ LDY #$03
+164d : b1 0d __ LDA (P0),y
+164f : 85 03 __ STA $03
+1651 : c8 __ __ INY
+1652 : b1 0d __ LDA (P0),y
+1654 : 85 04 __ STA $04
+1656 : a9 00 __ LDA #$00
+1658 : 85 05 __ STA $05
+165a : 85 06 __ STA $06
+165c : a5 47 __ LDA T1 + 0
+165e : 85 1b __ STA ACCU + 0
+1660 : a5 48 __ LDA T1 + 1
+1662 : 85 1c __ STA ACCU + 1
+1664 : a5 49 __ LDA T1 + 2
+1666 : 85 1d __ STA ACCU + 2
+1668 : a5 4a __ LDA T1 + 3
+166a : 85 1e __ STA ACCU + 3
+166c : 20 78 22 JSR $2278 ; (divmod32 + 0)
+166f : a5 08 __ LDA $08
+1671 : 10 54 __ BPL $16c7
+1673 : 18 __ __ CLC
+1674 : a5 07 __ LDA $07
+1676 : 69 30 __ ADC #$30
+1678 : c6 4e __ DEC T4 + 0
+167a : a4 4e __ LDY T4 + 0
+167c : 91 0f __ STA (P2),y
+167e : a0 03 __ LDY #$03
+1680 : b1 0d __ LDA (P0),y
+1682 : 85 03 __ STA $03
+1684 : c8 __ __ INY
+1685 : b1 0d __ LDA (P0),y
+1687 : 85 04 __ STA $04
+1689 : a9 00 __ LDA #$00
+168b : 85 05 __ STA $05
+168d : 85 06 __ STA $06
+168f : a5 47 __ LDA T1 + 0
+1691 : 85 1b __ STA ACCU + 0
+1693 : a5 48 __ LDA T1 + 1
+1695 : 85 1c __ STA ACCU + 1
+1697 : a5 49 __ LDA T1 + 2
+1699 : 85 1d __ STA ACCU + 2
+169b : a5 4a __ LDA T1 + 3
+169d : 85 1e __ STA ACCU + 3
+169f : 20 78 22 JSR $2278 ; (divmod32 + 0)
+16a2 : a5 1b __ LDA ACCU + 0
+16a4 : 85 47 __ STA T1 + 0
+16a6 : a5 1c __ LDA ACCU + 1
+16a8 : 85 48 __ STA T1 + 1
+16aa : a5 1d __ LDA ACCU + 2
+16ac : 85 49 __ STA T1 + 2
+16ae : a5 1e __ LDA ACCU + 3
+16b0 : 85 4a __ STA T1 + 3
+16b2 : a9 00 __ LDA #$00
+16b4 : c5 1e __ CMP ACCU + 3
+16b6 : d0 0a __ BNE $16c2
+16b8 : c5 1d __ CMP ACCU + 2
+16ba : d0 06 __ BNE $16c2
+16bc : c5 1c __ CMP ACCU + 1
+16be : d0 02 __ BNE $16c2
+16c0 : c5 1b __ CMP ACCU + 0
+16c2 : 90 87 __ BCC $164b
+16c4 : 4c 64 15 JMP $1564 ; (nforml + 52)
+16c7 : d0 06 __ BNE $16cf
+16c9 : a5 07 __ LDA $07
+16cb : c9 0a __ CMP #$0a
+16cd : 90 a4 __ BCC $1673
+16cf : 18 __ __ CLC
+16d0 : a5 07 __ LDA $07
+16d2 : 69 37 __ ADC #$37
+16d4 : 4c 78 16 JMP $1678 ; (nforml + 328)
+16d7 : a5 14 __ LDA P7
+16d9 : 49 80 __ EOR #$80
+16db : c9 80 __ CMP #$80
+16dd : d0 0f __ BNE $16ee
+16df : a5 13 __ LDA P6
+16e1 : c9 00 __ CMP #$00
+16e3 : d0 09 __ BNE $16ee
+16e5 : a5 12 __ LDA P5
+16e7 : c9 00 __ CMP #$00
+16e9 : d0 03 __ BNE $16ee
+16eb : 4c 4b 15 JMP $154b ; (nforml + 27)
+16ee : 90 03 __ BCC $16f3
+16f0 : 4c 4b 15 JMP $154b ; (nforml + 27)
+16f3 : a9 01 __ LDA #$01
+16f5 : 85 4d __ STA T3 + 0
+16f7 : a9 10 __ LDA #$10
+16f9 : 85 4e __ STA T4 + 0
+16fb : 38 __ __ SEC
+16fc : a9 00 __ LDA #$00
+16fe : e5 11 __ SBC P4
+1700 : 85 47 __ STA T1 + 0
+1702 : a9 00 __ LDA #$00
+1704 : e5 12 __ SBC P5
+1706 : 85 48 __ STA T1 + 1
+1708 : a9 00 __ LDA #$00
+170a : e5 13 __ SBC P6
+170c : 85 49 __ STA T1 + 2
+170e : a9 00 __ LDA #$00
+1710 : e5 14 __ SBC P7
+1712 : 85 4a __ STA T1 + 3
+1714 : a9 00 __ LDA #$00
+1716 : c5 4a __ CMP T1 + 3
+1718 : d0 0a __ BNE $1724
+171a : c5 49 __ CMP T1 + 2
+171c : d0 06 __ BNE $1724
+171e : c5 48 __ CMP T1 + 1
+1720 : d0 02 __ BNE $1724
+1722 : c5 47 __ CMP T1 + 0
+1724 : b0 03 __ BCS $1729
+1726 : 4c 4b 16 JMP $164b ; (nforml + 283)
+1729 : 4c 64 15 JMP $1564 ; (nforml + 52)
+--------------------------------------------------------------------
+nformf:
+172c : a9 00 __ LDA #$00
+172e : 85 1b __ STA ACCU + 0
+1730 : 85 1c __ STA ACCU + 1
+1732 : 85 1d __ STA ACCU + 2
+1734 : 85 1e __ STA ACCU + 3
+1736 : a5 11 __ LDA P4
+1738 : 85 03 __ STA $03
+173a : a5 12 __ LDA P5
+173c : 85 04 __ STA $04
+173e : a5 13 __ LDA P6
+1740 : 85 05 __ STA $05
+1742 : a5 14 __ LDA P7
+1744 : 85 06 __ STA $06
+1746 : 20 27 22 JSR $2227 ; (fcmp + 0)
+1749 : 10 03 __ BPL $174e
+174b : 4c 66 1d JMP $1d66 ; (nformf + 1594)
+174e : a9 00 __ LDA #$00
+1750 : 85 4b __ STA T3 + 0
+1752 : a0 05 __ LDY #$05
+1754 : b1 0d __ LDA (P0),y
+1756 : f0 0a __ BEQ $1762
+1758 : a9 2b __ LDA #$2b
+175a : a0 00 __ LDY #$00
+175c : 91 0f __ STA (P2),y
+175e : a9 01 __ LDA #$01
+1760 : 85 4b __ STA T3 + 0
+1762 : a9 00 __ LDA #$00
+1764 : 85 43 __ STA T0 + 0
+1766 : 85 44 __ STA T0 + 1
+1768 : a0 02 __ LDY #$02
+176a : b1 0d __ LDA (P0),y
+176c : 85 4e __ STA T5 + 0
+176e : c9 ff __ CMP #$ff
+1770 : d0 04 __ BNE $1776
+1772 : a9 06 __ LDA #$06
+1774 : 85 4e __ STA T5 + 0
+1776 : a9 00 __ LDA #$00
+1778 : 85 1b __ STA ACCU + 0
+177a : 85 1c __ STA ACCU + 1
+177c : 85 1d __ STA ACCU + 2
+177e : 85 1e __ STA ACCU + 3
+1780 : a5 11 __ LDA P4
+1782 : 85 03 __ STA $03
+1784 : a5 12 __ LDA P5
+1786 : 85 04 __ STA $04
+1788 : a5 13 __ LDA P6
+178a : 85 05 __ STA $05
+178c : a5 14 __ LDA P7
+178e : 85 06 __ STA $06
+1790 : 20 27 22 JSR $2227 ; (fcmp + 0)
+1793 : d0 03 __ BNE $1798
+1795 : 4c 1c 19 JMP $191c ; (nformf + 496)
+1798 : a9 00 __ LDA #$00
+179a : 85 1b __ STA ACCU + 0
+179c : 85 1c __ STA ACCU + 1
+179e : a9 7a __ LDA #$7a
+17a0 : 85 1d __ STA ACCU + 2
+17a2 : a9 44 __ LDA #$44
+17a4 : 85 1e __ STA ACCU + 3
+17a6 : a5 11 __ LDA P4
+17a8 : 85 03 __ STA $03
+17aa : a5 12 __ LDA P5
+17ac : 85 04 __ STA $04
+17ae : a5 13 __ LDA P6
+17b0 : 85 05 __ STA $05
+17b2 : a5 14 __ LDA P7
+17b4 : 85 06 __ STA $06
+17b6 : 20 27 22 JSR $2227 ; (fcmp + 0)
+17b9 : 30 5a __ BMI $1815
+17bb : a5 11 __ LDA P4
+17bd : 85 1b __ STA ACCU + 0
+17bf : a5 12 __ LDA P5
+17c1 : 85 1c __ STA ACCU + 1
+17c3 : a5 13 __ LDA P6
+17c5 : 85 1d __ STA ACCU + 2
+17c7 : a5 14 __ LDA P7
+17c9 : 85 1e __ STA ACCU + 3
+17cb : a9 00 __ LDA #$00
+17cd : 85 03 __ STA $03
+17cf : 85 04 __ STA $04
+17d1 : a9 7a __ LDA #$7a
+17d3 : 85 05 __ STA $05
+17d5 : a9 44 __ LDA #$44
+17d7 : 85 06 __ STA $06
+17d9 : 20 5b 1e JSR $1e5b ; (freg + 20)
+17dc : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+17df : a5 1b __ LDA ACCU + 0
+17e1 : 85 11 __ STA P4
+17e3 : 85 03 __ STA $03
+17e5 : a5 1c __ LDA ACCU + 1
+17e7 : 85 12 __ STA P5
+17e9 : 85 04 __ STA $04
+17eb : a5 1d __ LDA ACCU + 2
+17ed : 85 13 __ STA P6
+17ef : 85 05 __ STA $05
+17f1 : a5 1e __ LDA ACCU + 3
+17f3 : 85 14 __ STA P7
+17f5 : 85 06 __ STA $06
+17f7 : 18 __ __ CLC
+17f8 : a5 43 __ LDA T0 + 0
+17fa : 69 03 __ ADC #$03
+17fc : 85 43 __ STA T0 + 0
+17fe : 90 02 __ BCC $1802
+1800 : e6 44 __ INC T0 + 1
+1802 : a9 00 __ LDA #$00
+1804 : 85 1b __ STA ACCU + 0
+1806 : 85 1c __ STA ACCU + 1
+1808 : a9 7a __ LDA #$7a
+180a : 85 1d __ STA ACCU + 2
+180c : a9 44 __ LDA #$44
+180e : 85 1e __ STA ACCU + 3
+1810 : 20 27 22 JSR $2227 ; (fcmp + 0)
+1813 : 10 a6 __ BPL $17bb
+1815 : a9 00 __ LDA #$00
+1817 : 85 1b __ STA ACCU + 0
+1819 : 85 1c __ STA ACCU + 1
+181b : a9 80 __ LDA #$80
+181d : 85 1d __ STA ACCU + 2
+181f : a9 3f __ LDA #$3f
+1821 : 85 1e __ STA ACCU + 3
+1823 : a5 11 __ LDA P4
+1825 : 85 03 __ STA $03
+1827 : a5 12 __ LDA P5
+1829 : 85 04 __ STA $04
+182b : a5 13 __ LDA P6
+182d : 85 05 __ STA $05
+182f : a5 14 __ LDA P7
+1831 : 85 06 __ STA $06
+1833 : 20 27 22 JSR $2227 ; (fcmp + 0)
+1836 : 10 5c __ BPL $1894
+1838 : a5 11 __ LDA P4
+183a : 85 1b __ STA ACCU + 0
+183c : a5 12 __ LDA P5
+183e : 85 1c __ STA ACCU + 1
+1840 : a5 13 __ LDA P6
+1842 : 85 1d __ STA ACCU + 2
+1844 : a5 14 __ LDA P7
+1846 : 85 1e __ STA ACCU + 3
+1848 : a9 00 __ LDA #$00
+184a : 85 03 __ STA $03
+184c : 85 04 __ STA $04
+184e : a9 7a __ LDA #$7a
+1850 : 85 05 __ STA $05
+1852 : a9 44 __ LDA #$44
+1854 : 85 06 __ STA $06
+1856 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1859 : 20 54 1f JSR $1f54 ; (fmul + 0)
+185c : a5 1b __ LDA ACCU + 0
+185e : 85 11 __ STA P4
+1860 : 85 03 __ STA $03
+1862 : a5 1c __ LDA ACCU + 1
+1864 : 85 12 __ STA P5
+1866 : 85 04 __ STA $04
+1868 : a5 1d __ LDA ACCU + 2
+186a : 85 13 __ STA P6
+186c : 85 05 __ STA $05
+186e : a5 1e __ LDA ACCU + 3
+1870 : 85 14 __ STA P7
+1872 : 85 06 __ STA $06
+1874 : 38 __ __ SEC
+1875 : a5 43 __ LDA T0 + 0
+1877 : e9 03 __ SBC #$03
+1879 : 85 43 __ STA T0 + 0
+187b : a5 44 __ LDA T0 + 1
+187d : e9 00 __ SBC #$00
+187f : 85 44 __ STA T0 + 1
+1881 : a9 00 __ LDA #$00
+1883 : 85 1b __ STA ACCU + 0
+1885 : 85 1c __ STA ACCU + 1
+1887 : a9 80 __ LDA #$80
+1889 : 85 1d __ STA ACCU + 2
+188b : a9 3f __ LDA #$3f
+188d : 85 1e __ STA ACCU + 3
+188f : 20 27 22 JSR $2227 ; (fcmp + 0)
+1892 : 30 a4 __ BMI $1838
+1894 : a9 00 __ LDA #$00
+1896 : 85 1b __ STA ACCU + 0
+1898 : 85 1c __ STA ACCU + 1
+189a : a9 20 __ LDA #$20
+189c : 85 1d __ STA ACCU + 2
+189e : a9 41 __ LDA #$41
+18a0 : 85 1e __ STA ACCU + 3
+18a2 : a5 11 __ LDA P4
+18a4 : 85 03 __ STA $03
+18a6 : a5 12 __ LDA P5
+18a8 : 85 04 __ STA $04
+18aa : a5 13 __ LDA P6
+18ac : 85 05 __ STA $05
+18ae : a5 14 __ LDA P7
+18b0 : 85 06 __ STA $06
+18b2 : 20 27 22 JSR $2227 ; (fcmp + 0)
+18b5 : 30 65 __ BMI $191c
+18b7 : a5 11 __ LDA P4
+18b9 : 85 1b __ STA ACCU + 0
+18bb : a5 12 __ LDA P5
+18bd : 85 1c __ STA ACCU + 1
+18bf : a5 13 __ LDA P6
+18c1 : 85 1d __ STA ACCU + 2
+18c3 : a5 14 __ LDA P7
+18c5 : 85 1e __ STA ACCU + 3
+18c7 : a9 00 __ LDA #$00
+18c9 : 85 03 __ STA $03
+18cb : 85 04 __ STA $04
+18cd : a9 20 __ LDA #$20
+18cf : 85 05 __ STA $05
+18d1 : a9 41 __ LDA #$41
+18d3 : 85 06 __ STA $06
+18d5 : 20 5b 1e JSR $1e5b ; (freg + 20)
+18d8 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+18db : a5 1b __ LDA ACCU + 0
+18dd : 85 11 __ STA P4
+18df : 85 47 __ STA T2 + 0
+18e1 : a5 1c __ LDA ACCU + 1
+18e3 : 85 12 __ STA P5
+18e5 : 85 48 __ STA T2 + 1
+18e7 : a5 1d __ LDA ACCU + 2
+18e9 : 85 13 __ STA P6
+18eb : 85 49 __ STA T2 + 2
+18ed : a5 1e __ LDA ACCU + 3
+18ef : 85 14 __ STA P7
+18f1 : 85 4a __ STA T2 + 3
+18f3 : e6 43 __ INC T0 + 0
+18f5 : d0 02 __ BNE $18f9
+18f7 : e6 44 __ INC T0 + 1
+18f9 : a9 00 __ LDA #$00
+18fb : 85 1b __ STA ACCU + 0
+18fd : 85 1c __ STA ACCU + 1
+18ff : a9 20 __ LDA #$20
+1901 : 85 1d __ STA ACCU + 2
+1903 : a9 41 __ LDA #$41
+1905 : 85 1e __ STA ACCU + 3
+1907 : a5 47 __ LDA T2 + 0
+1909 : 85 03 __ STA $03
+190b : a5 48 __ LDA T2 + 1
+190d : 85 04 __ STA $04
+190f : a5 49 __ LDA T2 + 2
+1911 : 85 05 __ STA $05
+1913 : a5 4a __ LDA T2 + 3
+1915 : 85 06 __ STA $06
+1917 : 20 27 22 JSR $2227 ; (fcmp + 0)
+191a : 10 9b __ BPL $18b7
+191c : a5 15 __ LDA P8
+191e : c9 65 __ CMP #$65
+1920 : d0 03 __ BNE $1925
+1922 : 4c 61 1d JMP $1d61 ; (nformf + 1589)
+1925 : a9 00 __ LDA #$00
+1927 : 85 51 __ STA T7 + 0
+1929 : 85 52 __ STA T8 + 0
+192b : a5 4e __ LDA T5 + 0
+192d : 85 4c __ STA T4 + 0
+192f : e6 4c __ INC T4 + 0
+1931 : a5 15 __ LDA P8
+1933 : c9 67 __ CMP #$67
+1935 : d0 03 __ BNE $193a
+1937 : 4c 44 1d JMP $1d44 ; (nformf + 1560)
+193a : a5 51 __ LDA T7 + 0
+193c : f0 03 __ BEQ $1941
+193e : 4c 52 1c JMP $1c52 ; (nformf + 1318)
+1941 : a5 44 __ LDA T0 + 1
+1943 : 10 03 __ BPL $1948
+1945 : 4c 11 1c JMP $1c11 ; (nformf + 1253)
+1948 : a9 00 __ LDA #$00
+194a : 85 47 __ STA T2 + 0
+194c : 85 48 __ STA T2 + 1
+194e : 85 49 __ STA T2 + 2
+1950 : a9 3f __ LDA #$3f
+1952 : 85 4a __ STA T2 + 3
+1954 : 18 __ __ CLC
+1955 : a5 4e __ LDA T5 + 0
+1957 : 65 43 __ ADC T0 + 0
+1959 : 85 4c __ STA T4 + 0
+195b : e6 4c __ INC T4 + 0
+195d : a9 01 __ LDA #$01
+195f : c5 4c __ CMP T4 + 0
+1961 : b0 03 __ BCS $1966
+1963 : 4c d0 1b JMP $1bd0 ; (nformf + 1188)
+1966 : a5 11 __ LDA P4
+1968 : 85 1b __ STA ACCU + 0
+196a : a5 12 __ LDA P5
+196c : 85 1c __ STA ACCU + 1
+196e : a5 13 __ LDA P6
+1970 : 85 1d __ STA ACCU + 2
+1972 : a5 14 __ LDA P7
+1974 : 85 1e __ STA ACCU + 3
+1976 : a5 47 __ LDA T2 + 0
+1978 : 85 03 __ STA $03
+197a : a5 48 __ LDA T2 + 1
+197c : 85 04 __ STA $04
+197e : a5 49 __ LDA T2 + 2
+1980 : 85 05 __ STA $05
+1982 : a5 4a __ LDA T2 + 3
+1984 : 85 06 __ STA $06
+1986 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1989 : 20 8c 1e JSR $1e8c ; (faddsub + 0)
+198c : a5 1b __ LDA ACCU + 0
+198e : 85 11 __ STA P4
+1990 : 85 47 __ STA T2 + 0
+1992 : 85 03 __ STA $03
+1994 : a5 1c __ LDA ACCU + 1
+1996 : 85 12 __ STA P5
+1998 : 85 48 __ STA T2 + 1
+199a : 85 04 __ STA $04
+199c : a5 1d __ LDA ACCU + 2
+199e : 85 13 __ STA P6
+19a0 : 85 49 __ STA T2 + 2
+19a2 : 85 05 __ STA $05
+19a4 : a5 1e __ LDA ACCU + 3
+19a6 : 85 14 __ STA P7
+19a8 : 85 4a __ STA T2 + 3
+19aa : 85 06 __ STA $06
+19ac : a9 00 __ LDA #$00
+19ae : 85 1b __ STA ACCU + 0
+19b0 : 85 1c __ STA ACCU + 1
+19b2 : a9 20 __ LDA #$20
+19b4 : 85 1d __ STA ACCU + 2
+19b6 : a9 41 __ LDA #$41
+19b8 : 85 1e __ STA ACCU + 3
+19ba : 20 27 22 JSR $2227 ; (fcmp + 0)
+19bd : 30 36 __ BMI $19f5
+19bf : a5 47 __ LDA T2 + 0
+19c1 : 85 1b __ STA ACCU + 0
+19c3 : a5 48 __ LDA T2 + 1
+19c5 : 85 1c __ STA ACCU + 1
+19c7 : a5 49 __ LDA T2 + 2
+19c9 : 85 1d __ STA ACCU + 2
+19cb : a5 4a __ LDA T2 + 3
+19cd : 85 1e __ STA ACCU + 3
+19cf : a9 00 __ LDA #$00
+19d1 : 85 03 __ STA $03
+19d3 : 85 04 __ STA $04
+19d5 : a9 20 __ LDA #$20
+19d7 : 85 05 __ STA $05
+19d9 : a9 41 __ LDA #$41
+19db : 85 06 __ STA $06
+19dd : 20 5b 1e JSR $1e5b ; (freg + 20)
+19e0 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+19e3 : a5 1b __ LDA ACCU + 0
+19e5 : 85 11 __ STA P4
+19e7 : a5 1c __ LDA ACCU + 1
+19e9 : 85 12 __ STA P5
+19eb : a5 1d __ LDA ACCU + 2
+19ed : 85 13 __ STA P6
+19ef : a5 1e __ LDA ACCU + 3
+19f1 : 85 14 __ STA P7
+19f3 : c6 4e __ DEC T5 + 0
+19f5 : 38 __ __ SEC
+19f6 : a5 4c __ LDA T4 + 0
+19f8 : e5 4e __ SBC T5 + 0
+19fa : 85 53 __ STA T10 + 0
+19fc : 85 4e __ STA T5 + 0
+19fe : a9 14 __ LDA #$14
+1a00 : c5 4c __ CMP T4 + 0
+1a02 : b0 02 __ BCS $1a06
+1a04 : 85 4c __ STA T4 + 0
+1a06 : a5 53 __ LDA T10 + 0
+1a08 : d0 08 __ BNE $1a12
+1a0a : a9 30 __ LDA #$30
+1a0c : a4 4b __ LDY T3 + 0
+1a0e : 91 0f __ STA (P2),y
+1a10 : e6 4b __ INC T3 + 0
+1a12 : a9 00 __ LDA #$00
+1a14 : 85 50 __ STA T6 + 0
+1a16 : a5 4c __ LDA T4 + 0
+1a18 : f0 03 __ BEQ $1a1d
+1a1a : 4c 3f 1b JMP $1b3f ; (nformf + 1043)
+1a1d : a5 52 __ LDA T8 + 0
+1a1f : f0 03 __ BEQ $1a24
+1a21 : 4c bf 1a JMP $1abf ; (nformf + 915)
+1a24 : a5 4b __ LDA T3 + 0
+1a26 : a0 01 __ LDY #$01
+1a28 : d1 0d __ CMP (P0),y
+1a2a : 90 07 __ BCC $1a33
+1a2c : 85 1b __ STA ACCU + 0
+1a2e : a9 00 __ LDA #$00
+1a30 : 85 1c __ STA ACCU + 1
+1a32 : 60 __ __ RTS
+1a33 : c9 01 __ CMP #$01
+1a35 : 90 53 __ BCC $1a8a
+1a37 : a9 01 __ LDA #$01
+1a39 : 85 4e __ STA T5 + 0
+1a3b : a5 0d __ LDA P0
+1a3d : 85 43 __ STA T0 + 0
+1a3f : a5 0e __ LDA P1
+1a41 : 85 44 __ STA T0 + 1
+1a43 : a5 4b __ LDA T3 + 0
+1a45 : 85 4c __ STA T4 + 0
+1a47 : 38 __ __ SEC
+1a48 : a5 4c __ LDA T4 + 0
+1a4a : e5 4e __ SBC T5 + 0
+1a4c : 85 55 __ STA T11 + 0
+1a4e : a9 00 __ LDA #$00
+1a50 : e9 00 __ SBC #$00
+1a52 : 85 56 __ STA T11 + 1
+1a54 : 18 __ __ CLC
+1a55 : a5 0f __ LDA P2
+1a57 : 65 55 __ ADC T11 + 0
+1a59 : 85 55 __ STA T11 + 0
+1a5b : a5 10 __ LDA P3
+1a5d : 65 56 __ ADC T11 + 1
+1a5f : 85 56 __ STA T11 + 1
+1a61 : a0 01 __ LDY #$01
+1a63 : b1 43 __ LDA (T0 + 0),y
+1a65 : 38 __ __ SEC
+1a66 : e5 4e __ SBC T5 + 0
+1a68 : 85 53 __ STA T10 + 0
+1a6a : a9 00 __ LDA #$00
+1a6c : e9 00 __ SBC #$00
+1a6e : 85 54 __ STA T10 + 1
+1a70 : 18 __ __ CLC
+1a71 : a5 0f __ LDA P2
+1a73 : 65 53 __ ADC T10 + 0
+1a75 : 85 53 __ STA T10 + 0
+1a77 : a5 10 __ LDA P3
+1a79 : 65 54 __ ADC T10 + 1
+1a7b : 85 54 __ STA T10 + 1
+1a7d : 88 __ __ DEY
+1a7e : b1 55 __ LDA (T11 + 0),y
+1a80 : 91 53 __ STA (T10 + 0),y
+1a82 : e6 4e __ INC T5 + 0
+1a84 : a5 4b __ LDA T3 + 0
+1a86 : c5 4e __ CMP T5 + 0
+1a88 : b0 bd __ BCS $1a47
+1a8a : a9 00 __ LDA #$00
+1a8c : 85 4e __ STA T5 + 0
+1a8e : a5 4b __ LDA T3 + 0
+1a90 : 85 43 __ STA T0 + 0
+1a92 : a0 01 __ LDY #$01
+1a94 : b1 0d __ LDA (P0),y
+1a96 : 85 4b __ STA T3 + 0
+1a98 : 38 __ __ SEC
+1a99 : e5 43 __ SBC T0 + 0
+1a9b : 85 53 __ STA T10 + 0
+1a9d : a9 00 __ LDA #$00
+1a9f : e9 00 __ SBC #$00
+1aa1 : 85 54 __ STA T10 + 1
+1aa3 : a9 00 __ LDA #$00
+1aa5 : c5 54 __ CMP T10 + 1
+1aa7 : d0 04 __ BNE $1aad
+1aa9 : a5 4e __ LDA T5 + 0
+1aab : c5 53 __ CMP T10 + 0
+1aad : 90 05 __ BCC $1ab4
+1aaf : a5 4b __ LDA T3 + 0
+1ab1 : 4c 2c 1a JMP $1a2c ; (nformf + 768)
+1ab4 : a9 20 __ LDA #$20
+1ab6 : a4 4e __ LDY T5 + 0
+1ab8 : 91 0f __ STA (P2),y
+1aba : e6 4e __ INC T5 + 0
+1abc : 4c 92 1a JMP $1a92 ; (nformf + 870)
+1abf : a9 45 __ LDA #$45
+1ac1 : a4 4b __ LDY T3 + 0
+1ac3 : 91 0f __ STA (P2),y
+1ac5 : c8 __ __ INY
+1ac6 : a5 44 __ LDA T0 + 1
+1ac8 : 30 5a __ BMI $1b24
+1aca : a9 2b __ LDA #$2b
+1acc : 91 0f __ STA (P2),y
+1ace : 18 __ __ CLC
+1acf : a5 4b __ LDA T3 + 0
+1ad1 : 69 02 __ ADC #$02
+1ad3 : 85 4b __ STA T3 + 0
+1ad5 : a5 43 __ LDA T0 + 0
+1ad7 : 85 1b __ STA ACCU + 0
+1ad9 : a5 44 __ LDA T0 + 1
+1adb : 85 1c __ STA ACCU + 1
+1add : a9 0a __ LDA #$0a
+1adf : 85 03 __ STA $03
+1ae1 : a9 00 __ LDA #$00
+1ae3 : 85 04 __ STA $04
+1ae5 : 20 b2 20 JSR $20b2 ; (divs16 + 0)
+1ae8 : 18 __ __ CLC
+1ae9 : a5 1b __ LDA ACCU + 0
+1aeb : 69 30 __ ADC #$30
+1aed : a4 4b __ LDY T3 + 0
+1aef : 91 0f __ STA (P2),y
+1af1 : c8 __ __ INY
+1af2 : 98 __ __ TYA
+1af3 : 18 __ __ CLC
+1af4 : 65 0f __ ADC P2
+1af6 : 85 4c __ STA T4 + 0
+1af8 : a5 10 __ LDA P3
+1afa : 69 00 __ ADC #$00
+1afc : 85 4d __ STA T4 + 1
+1afe : a5 43 __ LDA T0 + 0
+1b00 : 85 1b __ STA ACCU + 0
+1b02 : a5 44 __ LDA T0 + 1
+1b04 : 85 1c __ STA ACCU + 1
+1b06 : a9 0a __ LDA #$0a
+1b08 : 85 03 __ STA $03
+1b0a : a9 00 __ LDA #$00
+1b0c : 85 04 __ STA $04
+1b0e : 20 71 21 JSR $2171 ; (mods16 + 0)
+1b11 : 18 __ __ CLC
+1b12 : a5 05 __ LDA $05
+1b14 : 69 30 __ ADC #$30
+1b16 : a0 00 __ LDY #$00
+1b18 : 91 4c __ STA (T4 + 0),y
+1b1a : 18 __ __ CLC
+1b1b : a5 4b __ LDA T3 + 0
+1b1d : 69 02 __ ADC #$02
+1b1f : 85 4b __ STA T3 + 0
+1b21 : 4c 24 1a JMP $1a24 ; (nformf + 760)
+1b24 : a9 2d __ LDA #$2d
+1b26 : 91 0f __ STA (P2),y
+1b28 : 18 __ __ CLC
+1b29 : a5 4b __ LDA T3 + 0
+1b2b : 69 02 __ ADC #$02
+1b2d : 85 4b __ STA T3 + 0
+1b2f : 38 __ __ SEC
+1b30 : a9 00 __ LDA #$00
+1b32 : e5 43 __ SBC T0 + 0
+1b34 : 85 43 __ STA T0 + 0
+1b36 : a9 00 __ LDA #$00
+1b38 : e5 44 __ SBC T0 + 1
+1b3a : 85 44 __ STA T0 + 1
+1b3c : 4c d5 1a JMP $1ad5 ; (nformf + 937)
+1b3f : a5 50 __ LDA T6 + 0
+1b41 : c5 4e __ CMP T5 + 0
+1b43 : d0 08 __ BNE $1b4d
+1b45 : a9 2e __ LDA #$2e
+1b47 : a4 4b __ LDY T3 + 0
+1b49 : 91 0f __ STA (P2),y
+1b4b : e6 4b __ INC T3 + 0
+1b4d : a5 11 __ LDA P4
+1b4f : 85 1b __ STA ACCU + 0
+1b51 : a5 12 __ LDA P5
+1b53 : 85 1c __ STA ACCU + 1
+1b55 : a5 13 __ LDA P6
+1b57 : 85 1d __ STA ACCU + 2
+1b59 : a5 14 __ LDA P7
+1b5b : 85 1e __ STA ACCU + 3
+1b5d : 20 9a 21 JSR $219a ; (f32_to_i16 + 0)
+1b60 : a5 1b __ LDA ACCU + 0
+1b62 : 85 53 __ STA T10 + 0
+1b64 : 20 dc 21 JSR $21dc ; (sint16_to_float + 0)
+1b67 : a5 1b __ LDA ACCU + 0
+1b69 : 85 03 __ STA $03
+1b6b : a5 1c __ LDA ACCU + 1
+1b6d : 85 04 __ STA $04
+1b6f : a5 1d __ LDA ACCU + 2
+1b71 : 85 05 __ STA $05
+1b73 : a5 1e __ LDA ACCU + 3
+1b75 : 85 06 __ STA $06
+1b77 : a5 11 __ LDA P4
+1b79 : 85 1b __ STA ACCU + 0
+1b7b : a5 12 __ LDA P5
+1b7d : 85 1c __ STA ACCU + 1
+1b7f : a5 13 __ LDA P6
+1b81 : 85 1d __ STA ACCU + 2
+1b83 : a5 14 __ LDA P7
+1b85 : 85 1e __ STA ACCU + 3
+1b87 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1b8a : a5 06 __ LDA $06
+1b8c : 49 80 __ EOR #$80
+1b8e : 85 06 __ STA $06
+1b90 : 20 8c 1e JSR $1e8c ; (faddsub + 0)
+1b93 : a9 00 __ LDA #$00
+1b95 : 85 03 __ STA $03
+1b97 : 85 04 __ STA $04
+1b99 : a9 20 __ LDA #$20
+1b9b : 85 05 __ STA $05
+1b9d : a9 41 __ LDA #$41
+1b9f : 85 06 __ STA $06
+1ba1 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1ba4 : 20 54 1f JSR $1f54 ; (fmul + 0)
+1ba7 : a5 1b __ LDA ACCU + 0
+1ba9 : 85 11 __ STA P4
+1bab : a5 1c __ LDA ACCU + 1
+1bad : 85 12 __ STA P5
+1baf : a5 1d __ LDA ACCU + 2
+1bb1 : 85 13 __ STA P6
+1bb3 : a5 1e __ LDA ACCU + 3
+1bb5 : 85 14 __ STA P7
+1bb7 : 18 __ __ CLC
+1bb8 : a5 53 __ LDA T10 + 0
+1bba : 69 30 __ ADC #$30
+1bbc : a4 4b __ LDY T3 + 0
+1bbe : 91 0f __ STA (P2),y
+1bc0 : e6 4b __ INC T3 + 0
+1bc2 : e6 50 __ INC T6 + 0
+1bc4 : a5 50 __ LDA T6 + 0
+1bc6 : c5 4c __ CMP T4 + 0
+1bc8 : b0 03 __ BCS $1bcd
+1bca : 4c 3f 1b JMP $1b3f ; (nformf + 1043)
+1bcd : 4c 1d 1a JMP $1a1d ; (nformf + 753)
+1bd0 : 85 50 __ STA T6 + 0
+1bd2 : a5 47 __ LDA T2 + 0
+1bd4 : 85 1b __ STA ACCU + 0
+1bd6 : a5 48 __ LDA T2 + 1
+1bd8 : 85 1c __ STA ACCU + 1
+1bda : a5 49 __ LDA T2 + 2
+1bdc : 85 1d __ STA ACCU + 2
+1bde : a5 4a __ LDA T2 + 3
+1be0 : 85 1e __ STA ACCU + 3
+1be2 : a9 00 __ LDA #$00
+1be4 : 85 03 __ STA $03
+1be6 : 85 04 __ STA $04
+1be8 : a9 20 __ LDA #$20
+1bea : 85 05 __ STA $05
+1bec : a9 41 __ LDA #$41
+1bee : 85 06 __ STA $06
+1bf0 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1bf3 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+1bf6 : a5 1b __ LDA ACCU + 0
+1bf8 : 85 47 __ STA T2 + 0
+1bfa : a5 1c __ LDA ACCU + 1
+1bfc : 85 48 __ STA T2 + 1
+1bfe : a5 1d __ LDA ACCU + 2
+1c00 : 85 49 __ STA T2 + 2
+1c02 : a5 1e __ LDA ACCU + 3
+1c04 : 85 4a __ STA T2 + 3
+1c06 : e6 50 __ INC T6 + 0
+1c08 : a5 50 __ LDA T6 + 0
+1c0a : c5 4c __ CMP T4 + 0
+1c0c : 90 c4 __ BCC $1bd2
+1c0e : 4c 66 19 JMP $1966 ; (nformf + 570)
+1c11 : a5 11 __ LDA P4
+1c13 : 85 1b __ STA ACCU + 0
+1c15 : a5 12 __ LDA P5
+1c17 : 85 1c __ STA ACCU + 1
+1c19 : a5 13 __ LDA P6
+1c1b : 85 1d __ STA ACCU + 2
+1c1d : a5 14 __ LDA P7
+1c1f : 85 1e __ STA ACCU + 3
+1c21 : a9 00 __ LDA #$00
+1c23 : 85 03 __ STA $03
+1c25 : 85 04 __ STA $04
+1c27 : a9 20 __ LDA #$20
+1c29 : 85 05 __ STA $05
+1c2b : a9 41 __ LDA #$41
+1c2d : 85 06 __ STA $06
+1c2f : 20 5b 1e JSR $1e5b ; (freg + 20)
+1c32 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+1c35 : a5 1b __ LDA ACCU + 0
+1c37 : 85 11 __ STA P4
+1c39 : a5 1c __ LDA ACCU + 1
+1c3b : 85 12 __ STA P5
+1c3d : a5 1d __ LDA ACCU + 2
+1c3f : 85 13 __ STA P6
+1c41 : a5 1e __ LDA ACCU + 3
+1c43 : 85 14 __ STA P7
+1c45 : e6 43 __ INC T0 + 0
+1c47 : d0 02 __ BNE $1c4b
+1c49 : e6 44 __ INC T0 + 1
+1c4b : a5 44 __ LDA T0 + 1
+1c4d : 30 c2 __ BMI $1c11
+1c4f : 4c 48 19 JMP $1948 ; (nformf + 540)
+1c52 : a9 00 __ LDA #$00
+1c54 : 85 47 __ STA T2 + 0
+1c56 : 85 48 __ STA T2 + 1
+1c58 : 85 49 __ STA T2 + 2
+1c5a : a9 3f __ LDA #$3f
+1c5c : 85 4a __ STA T2 + 3
+1c5e : a5 4e __ LDA T5 + 0
+1c60 : f0 03 __ BEQ $1c65
+1c62 : 4c 01 1d JMP $1d01 ; (nformf + 1493)
+1c65 : a5 11 __ LDA P4
+1c67 : 85 1b __ STA ACCU + 0
+1c69 : a5 12 __ LDA P5
+1c6b : 85 1c __ STA ACCU + 1
+1c6d : a5 13 __ LDA P6
+1c6f : 85 1d __ STA ACCU + 2
+1c71 : a5 14 __ LDA P7
+1c73 : 85 1e __ STA ACCU + 3
+1c75 : a5 47 __ LDA T2 + 0
+1c77 : 85 03 __ STA $03
+1c79 : a5 48 __ LDA T2 + 1
+1c7b : 85 04 __ STA $04
+1c7d : a5 49 __ LDA T2 + 2
+1c7f : 85 05 __ STA $05
+1c81 : a5 4a __ LDA T2 + 3
+1c83 : 85 06 __ STA $06
+1c85 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1c88 : 20 8c 1e JSR $1e8c ; (faddsub + 0)
+1c8b : a5 1b __ LDA ACCU + 0
+1c8d : 85 11 __ STA P4
+1c8f : 85 47 __ STA T2 + 0
+1c91 : 85 03 __ STA $03
+1c93 : a5 1c __ LDA ACCU + 1
+1c95 : 85 12 __ STA P5
+1c97 : 85 48 __ STA T2 + 1
+1c99 : 85 04 __ STA $04
+1c9b : a5 1d __ LDA ACCU + 2
+1c9d : 85 13 __ STA P6
+1c9f : 85 49 __ STA T2 + 2
+1ca1 : 85 05 __ STA $05
+1ca3 : a5 1e __ LDA ACCU + 3
+1ca5 : 85 14 __ STA P7
+1ca7 : 85 4a __ STA T2 + 3
+1ca9 : 85 06 __ STA $06
+1cab : a9 00 __ LDA #$00
+1cad : 85 1b __ STA ACCU + 0
+1caf : 85 1c __ STA ACCU + 1
+1cb1 : a9 20 __ LDA #$20
+1cb3 : 85 1d __ STA ACCU + 2
+1cb5 : a9 41 __ LDA #$41
+1cb7 : 85 1e __ STA ACCU + 3
+1cb9 : 20 27 22 JSR $2227 ; (fcmp + 0)
+1cbc : 10 03 __ BPL $1cc1
+1cbe : 4c f5 19 JMP $19f5 ; (nformf + 713)
+1cc1 : a5 47 __ LDA T2 + 0
+1cc3 : 85 1b __ STA ACCU + 0
+1cc5 : a5 48 __ LDA T2 + 1
+1cc7 : 85 1c __ STA ACCU + 1
+1cc9 : a5 49 __ LDA T2 + 2
+1ccb : 85 1d __ STA ACCU + 2
+1ccd : a5 4a __ LDA T2 + 3
+1ccf : 85 1e __ STA ACCU + 3
+1cd1 : a9 00 __ LDA #$00
+1cd3 : 85 03 __ STA $03
+1cd5 : 85 04 __ STA $04
+1cd7 : a9 20 __ LDA #$20
+1cd9 : 85 05 __ STA $05
+1cdb : a9 41 __ LDA #$41
+1cdd : 85 06 __ STA $06
+1cdf : 20 5b 1e JSR $1e5b ; (freg + 20)
+1ce2 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+1ce5 : a5 1b __ LDA ACCU + 0
+1ce7 : 85 11 __ STA P4
+1ce9 : a5 1c __ LDA ACCU + 1
+1ceb : 85 12 __ STA P5
+1ced : a5 1d __ LDA ACCU + 2
+1cef : 85 13 __ STA P6
+1cf1 : a5 1e __ LDA ACCU + 3
+1cf3 : 85 14 __ STA P7
+1cf5 : e6 43 __ INC T0 + 0
+1cf7 : f0 03 __ BEQ $1cfc
+1cf9 : 4c f5 19 JMP $19f5 ; (nformf + 713)
+1cfc : e6 44 __ INC T0 + 1
+1cfe : 4c f5 19 JMP $19f5 ; (nformf + 713)
+1d01 : a9 00 __ LDA #$00
+1d03 : 85 50 __ STA T6 + 0
+1d05 : a5 47 __ LDA T2 + 0
+1d07 : 85 1b __ STA ACCU + 0
+1d09 : a5 48 __ LDA T2 + 1
+1d0b : 85 1c __ STA ACCU + 1
+1d0d : a5 49 __ LDA T2 + 2
+1d0f : 85 1d __ STA ACCU + 2
+1d11 : a5 4a __ LDA T2 + 3
+1d13 : 85 1e __ STA ACCU + 3
+1d15 : a9 00 __ LDA #$00
+1d17 : 85 03 __ STA $03
+1d19 : 85 04 __ STA $04
+1d1b : a9 20 __ LDA #$20
+1d1d : 85 05 __ STA $05
+1d1f : a9 41 __ LDA #$41
+1d21 : 85 06 __ STA $06
+1d23 : 20 5b 1e JSR $1e5b ; (freg + 20)
+1d26 : 20 f2 1f JSR $1ff2 ; (fdiv + 0)
+1d29 : a5 1b __ LDA ACCU + 0
+1d2b : 85 47 __ STA T2 + 0
+1d2d : a5 1c __ LDA ACCU + 1
+1d2f : 85 48 __ STA T2 + 1
+1d31 : a5 1d __ LDA ACCU + 2
+1d33 : 85 49 __ STA T2 + 2
+1d35 : a5 1e __ LDA ACCU + 3
+1d37 : 85 4a __ STA T2 + 3
+1d39 : e6 50 __ INC T6 + 0
+1d3b : a5 50 __ LDA T6 + 0
+1d3d : c5 4e __ CMP T5 + 0
+1d3f : 90 c4 __ BCC $1d05
+1d41 : 4c 65 1c JMP $1c65 ; (nformf + 1337)
+1d44 : a5 44 __ LDA T0 + 1
+1d46 : 10 0e __ BPL $1d56
+1d48 : a5 44 __ LDA T0 + 1
+1d4a : 30 03 __ BMI $1d4f
+1d4c : 4c 3a 19 JMP $193a ; (nformf + 526)
+1d4f : a9 01 __ LDA #$01
+1d51 : 85 52 __ STA T8 + 0
+1d53 : 4c 52 1c JMP $1c52 ; (nformf + 1318)
+1d56 : d0 f7 __ BNE $1d4f
+1d58 : a9 03 __ LDA #$03
+1d5a : c5 43 __ CMP T0 + 0
+1d5c : 90 f1 __ BCC $1d4f
+1d5e : 4c 48 1d JMP $1d48 ; (nformf + 1564)
+1d61 : a9 01 __ LDA #$01
+1d63 : 4c 27 19 JMP $1927 ; (nformf + 507)
+1d66 : a5 14 __ LDA P7
+1d68 : 49 80 __ EOR #$80
+1d6a : 85 14 __ STA P7
+1d6c : a9 2d __ LDA #$2d
+1d6e : a0 00 __ LDY #$00
+1d70 : 91 0f __ STA (P2),y
+1d72 : a9 01 __ LDA #$01
+1d74 : 85 4b __ STA T3 + 0
+1d76 : 4c 62 17 JMP $1762 ; (nformf + 54)
+--------------------------------------------------------------------
+strlen:
+1d92 : a9 00 __ LDA #$00
+1d94 : 85 43 __ STA T0 + 0
+1d96 : 85 44 __ STA T0 + 1
+1d98 : a0 00 __ LDY #$00
+1d9a : b1 0d __ LDA (P0),y
+1d9c : d0 09 __ BNE $1da7
+1d9e : a5 43 __ LDA T0 + 0
+1da0 : 85 1b __ STA ACCU + 0
+1da2 : a5 44 __ LDA T0 + 1
+1da4 : 85 1c __ STA ACCU + 1
+1da6 : 60 __ __ RTS
+1da7 : 18 __ __ CLC
+1da8 : a5 0d __ LDA P0
+1daa : 65 43 __ ADC T0 + 0
+1dac : 85 48 __ STA T3 + 0
+1dae : a5 0e __ LDA P1
+1db0 : 65 44 __ ADC T0 + 1
+1db2 : 85 49 __ STA T3 + 1
+1db4 : e6 43 __ INC T0 + 0
+1db6 : d0 02 __ BNE $1dba
+1db8 : e6 44 __ INC T0 + 1
+1dba : a0 01 __ LDY #$01
+1dbc : b1 48 __ LDA (T3 + 0),y
+1dbe : d0 e7 __ BNE $1da7
+1dc0 : 4c 9e 1d JMP $1d9e ; (strlen + 12)
+--------------------------------------------------------------------
+strcmp:
+1dd9 : a0 00 __ LDY #$00
+1ddb : 84 1c __ STY ACCU + 1
+1ddd : b1 0d __ LDA (P0),y
+1ddf : f0 16 __ BEQ $1df7
+1de1 : d1 0f __ CMP (P2),y
+1de3 : d0 16 __ BNE $1dfb
+1de5 : c8 __ __ INY
+1de6 : b1 0d __ LDA (P0),y
+1de8 : f0 0d __ BEQ $1df7
+1dea : d1 0f __ CMP (P2),y
+1dec : d0 0d __ BNE $1dfb
+1dee : c8 __ __ INY
+1def : d0 ec __ BNE $1ddd
+1df1 : e6 0e __ INC P1
+1df3 : e6 10 __ INC P3
+1df5 : d0 e6 __ BNE $1ddd
+1df7 : d1 0f __ CMP (P2),y
+1df9 : f0 0a __ BEQ $1e05
+1dfb : b0 06 __ BCS $1e03
+1dfd : a9 ff __ LDA #$ff
+1dff : 85 1c __ STA ACCU + 1
+1e01 : 30 02 __ BMI $1e05
+1e03 : a9 01 __ LDA #$01
+1e05 : 85 1b __ STA ACCU + 0
+1e07 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1e16 : a9 4c __ LDA #$4c
+1e18 : 85 54 __ STA $54
+1e1a : a9 00 __ LDA #$00
+1e1c : 85 13 __ STA P6
+1e1e : a9 19 __ LDA #$19
+1e20 : 85 16 __ STA P9
+1e22 : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16by8:
+1e23 : a9 00 __ LDA #$00
+1e25 : 85 05 __ STA $05
+1e27 : 85 06 __ STA $06
+1e29 : a5 03 __ LDA $03
+1e2b : 4a __ __ LSR
+1e2c : 90 0f __ BCC $1e3d
+1e2e : aa __ __ TAX
+1e2f : 18 __ __ CLC
+1e30 : a5 05 __ LDA $05
+1e32 : 65 1b __ ADC ACCU + 0
+1e34 : 85 05 __ STA $05
+1e36 : a5 06 __ LDA $06
+1e38 : 65 1c __ ADC ACCU + 1
+1e3a : 85 06 __ STA $06
+1e3c : 8a __ __ TXA
+1e3d : 06 1b __ ASL ACCU + 0
+1e3f : 26 1c __ ROL ACCU + 1
+1e41 : 4a __ __ LSR
+1e42 : b0 ea __ BCS $1e2e
+1e44 : d0 f7 __ BNE $1e3d
+1e46 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1e47 : b1 19 __ LDA (IP + 0),y
+1e49 : c8 __ __ INY
+1e4a : aa __ __ TAX
+1e4b : b5 00 __ LDA $00,x
+1e4d : 85 03 __ STA $03
+1e4f : b5 01 __ LDA $01,x
+1e51 : 85 04 __ STA $04
+1e53 : b5 02 __ LDA $02,x
+1e55 : 85 05 __ STA $05
+1e57 : b5 03 __ LDA $03,x
+1e59 : 85 06 __ STA $06
+1e5b : a5 05 __ LDA $05
+1e5d : 0a __ __ ASL
+1e5e : a5 06 __ LDA $06
+1e60 : 2a __ __ ROL
+1e61 : 85 08 __ STA $08
+1e63 : f0 06 __ BEQ $1e6b
+1e65 : a5 05 __ LDA $05
+1e67 : 09 80 __ ORA #$80
+1e69 : 85 05 __ STA $05
+1e6b : a5 1d __ LDA ACCU + 2
+1e6d : 0a __ __ ASL
+1e6e : a5 1e __ LDA ACCU + 3
+1e70 : 2a __ __ ROL
+1e71 : 85 07 __ STA $07
+1e73 : f0 06 __ BEQ $1e7b
+1e75 : a5 1d __ LDA ACCU + 2
+1e77 : 09 80 __ ORA #$80
+1e79 : 85 1d __ STA ACCU + 2
+1e7b : 60 __ __ RTS
+1e7c : 06 1e __ ASL ACCU + 3
+1e7e : a5 07 __ LDA $07
+1e80 : 6a __ __ ROR
+1e81 : 85 1e __ STA ACCU + 3
+1e83 : b0 06 __ BCS $1e8b
+1e85 : a5 1d __ LDA ACCU + 2
+1e87 : 29 7f __ AND #$7f
+1e89 : 85 1d __ STA ACCU + 2
+1e8b : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+1e8c : 38 __ __ SEC
+1e8d : a5 07 __ LDA $07
+1e8f : e5 08 __ SBC $08
+1e91 : f0 38 __ BEQ $1ecb
+1e93 : aa __ __ TAX
+1e94 : b0 25 __ BCS $1ebb
+1e96 : e0 e9 __ CPX #$e9
+1e98 : b0 0e __ BCS $1ea8
+1e9a : a5 08 __ LDA $08
+1e9c : 85 07 __ STA $07
+1e9e : a9 00 __ LDA #$00
+1ea0 : 85 1b __ STA ACCU + 0
+1ea2 : 85 1c __ STA ACCU + 1
+1ea4 : 85 1d __ STA ACCU + 2
+1ea6 : f0 23 __ BEQ $1ecb
+1ea8 : a5 1d __ LDA ACCU + 2
+1eaa : 4a __ __ LSR
+1eab : 66 1c __ ROR ACCU + 1
+1ead : 66 1b __ ROR ACCU + 0
+1eaf : e8 __ __ INX
+1eb0 : d0 f8 __ BNE $1eaa
+1eb2 : 85 1d __ STA ACCU + 2
+1eb4 : a5 08 __ LDA $08
+1eb6 : 85 07 __ STA $07
+1eb8 : 4c cb 1e JMP $1ecb ; (faddsub + 63)
+1ebb : e0 18 __ CPX #$18
+1ebd : b0 33 __ BCS $1ef2
+1ebf : a5 05 __ LDA $05
+1ec1 : 4a __ __ LSR
+1ec2 : 66 04 __ ROR $04
+1ec4 : 66 03 __ ROR $03
+1ec6 : ca __ __ DEX
+1ec7 : d0 f8 __ BNE $1ec1
+1ec9 : 85 05 __ STA $05
+1ecb : a5 1e __ LDA ACCU + 3
+1ecd : 29 80 __ AND #$80
+1ecf : 85 1e __ STA ACCU + 3
+1ed1 : 45 06 __ EOR $06
+1ed3 : 30 2d __ BMI $1f02
+1ed5 : 18 __ __ CLC
+1ed6 : a5 1b __ LDA ACCU + 0
+1ed8 : 65 03 __ ADC $03
+1eda : 85 1b __ STA ACCU + 0
+1edc : a5 1c __ LDA ACCU + 1
+1ede : 65 04 __ ADC $04
+1ee0 : 85 1c __ STA ACCU + 1
+1ee2 : a5 1d __ LDA ACCU + 2
+1ee4 : 65 05 __ ADC $05
+1ee6 : 85 1d __ STA ACCU + 2
+1ee8 : 90 08 __ BCC $1ef2
+1eea : 66 1d __ ROR ACCU + 2
+1eec : 66 1c __ ROR ACCU + 1
+1eee : 66 1b __ ROR ACCU + 0
+1ef0 : e6 07 __ INC $07
+1ef2 : a5 07 __ LDA $07
+1ef4 : 4a __ __ LSR
+1ef5 : 05 1e __ ORA ACCU + 3
+1ef7 : 85 1e __ STA ACCU + 3
+1ef9 : b0 06 __ BCS $1f01
+1efb : a5 1d __ LDA ACCU + 2
+1efd : 29 7f __ AND #$7f
+1eff : 85 1d __ STA ACCU + 2
+1f01 : 60 __ __ RTS
+1f02 : 38 __ __ SEC
+1f03 : a5 1b __ LDA ACCU + 0
+1f05 : e5 03 __ SBC $03
+1f07 : 85 1b __ STA ACCU + 0
+1f09 : a5 1c __ LDA ACCU + 1
+1f0b : e5 04 __ SBC $04
+1f0d : 85 1c __ STA ACCU + 1
+1f0f : a5 1d __ LDA ACCU + 2
+1f11 : e5 05 __ SBC $05
+1f13 : 85 1d __ STA ACCU + 2
+1f15 : b0 19 __ BCS $1f30
+1f17 : 38 __ __ SEC
+1f18 : a9 00 __ LDA #$00
+1f1a : e5 1b __ SBC ACCU + 0
+1f1c : 85 1b __ STA ACCU + 0
+1f1e : a9 00 __ LDA #$00
+1f20 : e5 1c __ SBC ACCU + 1
+1f22 : 85 1c __ STA ACCU + 1
+1f24 : a9 00 __ LDA #$00
+1f26 : e5 1d __ SBC ACCU + 2
+1f28 : 85 1d __ STA ACCU + 2
+1f2a : a5 1e __ LDA ACCU + 3
+1f2c : 49 80 __ EOR #$80
+1f2e : 85 1e __ STA ACCU + 3
+1f30 : a5 1d __ LDA ACCU + 2
+1f32 : 30 be __ BMI $1ef2
+1f34 : 05 1c __ ORA ACCU + 1
+1f36 : 05 1b __ ORA ACCU + 0
+1f38 : f0 0f __ BEQ $1f49
+1f3a : c6 07 __ DEC $07
+1f3c : f0 0b __ BEQ $1f49
+1f3e : 06 1b __ ASL ACCU + 0
+1f40 : 26 1c __ ROL ACCU + 1
+1f42 : 26 1d __ ROL ACCU + 2
+1f44 : 10 f4 __ BPL $1f3a
+1f46 : 4c f2 1e JMP $1ef2 ; (faddsub + 102)
+1f49 : a9 00 __ LDA #$00
+1f4b : 85 1b __ STA ACCU + 0
+1f4d : 85 1c __ STA ACCU + 1
+1f4f : 85 1d __ STA ACCU + 2
+1f51 : 85 1e __ STA ACCU + 3
+1f53 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+1f54 : a5 1b __ LDA ACCU + 0
+1f56 : 05 1c __ ORA ACCU + 1
+1f58 : 05 1d __ ORA ACCU + 2
+1f5a : d0 03 __ BNE $1f5f
+1f5c : 85 1e __ STA ACCU + 3
+1f5e : 60 __ __ RTS
+1f5f : a5 03 __ LDA $03
+1f61 : 05 04 __ ORA $04
+1f63 : 05 05 __ ORA $05
+1f65 : d0 09 __ BNE $1f70
+1f67 : 85 1b __ STA ACCU + 0
+1f69 : 85 1c __ STA ACCU + 1
+1f6b : 85 1d __ STA ACCU + 2
+1f6d : 85 1e __ STA ACCU + 3
+1f6f : 60 __ __ RTS
+1f70 : a9 00 __ LDA #$00
+1f72 : 85 09 __ STA $09
+1f74 : 85 0a __ STA $0a
+1f76 : 85 0b __ STA $0b
+1f78 : a4 1b __ LDY ACCU + 0
+1f7a : a5 03 __ LDA $03
+1f7c : d0 06 __ BNE $1f84
+1f7e : a5 04 __ LDA $04
+1f80 : f0 0a __ BEQ $1f8c
+1f82 : d0 05 __ BNE $1f89
+1f84 : 20 c4 1f JSR $1fc4 ; (fmul8 + 0)
+1f87 : a5 04 __ LDA $04
+1f89 : 20 c4 1f JSR $1fc4 ; (fmul8 + 0)
+1f8c : a5 05 __ LDA $05
+1f8e : 20 c4 1f JSR $1fc4 ; (fmul8 + 0)
+1f91 : 38 __ __ SEC
+1f92 : a5 0b __ LDA $0b
+1f94 : 30 06 __ BMI $1f9c
+1f96 : 06 09 __ ASL $09
+1f98 : 26 0a __ ROL $0a
+1f9a : 2a __ __ ROL
+1f9b : 18 __ __ CLC
+1f9c : 29 7f __ AND #$7f
+1f9e : 85 0b __ STA $0b
+1fa0 : a5 1e __ LDA ACCU + 3
+1fa2 : 45 06 __ EOR $06
+1fa4 : 29 80 __ AND #$80
+1fa6 : 85 1e __ STA ACCU + 3
+1fa8 : a5 07 __ LDA $07
+1faa : e9 7e __ SBC #$7e
+1fac : 18 __ __ CLC
+1fad : 65 08 __ ADC $08
+1faf : 4a __ __ LSR
+1fb0 : 05 1e __ ORA ACCU + 3
+1fb2 : 85 1e __ STA ACCU + 3
+1fb4 : a9 00 __ LDA #$00
+1fb6 : 6a __ __ ROR
+1fb7 : 05 0b __ ORA $0b
+1fb9 : 85 1d __ STA ACCU + 2
+1fbb : a5 0a __ LDA $0a
+1fbd : 85 1c __ STA ACCU + 1
+1fbf : a5 09 __ LDA $09
+1fc1 : 85 1b __ STA ACCU + 0
+1fc3 : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+1fc4 : 38 __ __ SEC
+1fc5 : 6a __ __ ROR
+1fc6 : 90 1e __ BCC $1fe6
+1fc8 : aa __ __ TAX
+1fc9 : 18 __ __ CLC
+1fca : 98 __ __ TYA
+1fcb : 65 09 __ ADC $09
+1fcd : 85 09 __ STA $09
+1fcf : a5 0a __ LDA $0a
+1fd1 : 65 1c __ ADC ACCU + 1
+1fd3 : 85 0a __ STA $0a
+1fd5 : a5 0b __ LDA $0b
+1fd7 : 65 1d __ ADC ACCU + 2
+1fd9 : 6a __ __ ROR
+1fda : 85 0b __ STA $0b
+1fdc : 8a __ __ TXA
+1fdd : 66 0a __ ROR $0a
+1fdf : 66 09 __ ROR $09
+1fe1 : 4a __ __ LSR
+1fe2 : f0 0d __ BEQ $1ff1
+1fe4 : b0 e2 __ BCS $1fc8
+1fe6 : 66 0b __ ROR $0b
+1fe8 : 66 0a __ ROR $0a
+1fea : 66 09 __ ROR $09
+1fec : 4a __ __ LSR
+1fed : 90 f7 __ BCC $1fe6
+1fef : d0 d7 __ BNE $1fc8
+1ff1 : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1ff2 : a5 1b __ LDA ACCU + 0
+1ff4 : 05 1c __ ORA ACCU + 1
+1ff6 : 05 1d __ ORA ACCU + 2
+1ff8 : d0 03 __ BNE $1ffd
+1ffa : 85 1e __ STA ACCU + 3
+1ffc : 60 __ __ RTS
+1ffd : a5 1e __ LDA ACCU + 3
+1fff : 45 06 __ EOR $06
+2001 : 29 80 __ AND #$80
+2003 : 85 1e __ STA ACCU + 3
+2005 : a9 00 __ LDA #$00
+2007 : 85 09 __ STA $09
+2009 : 85 0a __ STA $0a
+200b : 85 0b __ STA $0b
+200d : a2 18 __ LDX #$18
+200f : a5 1b __ LDA ACCU + 0
+2011 : c5 03 __ CMP $03
+2013 : a5 1c __ LDA ACCU + 1
+2015 : e5 04 __ SBC $04
+2017 : a5 1d __ LDA ACCU + 2
+2019 : e5 05 __ SBC $05
+201b : 90 13 __ BCC $2030
+201d : a5 1b __ LDA ACCU + 0
+201f : e5 03 __ SBC $03
+2021 : 85 1b __ STA ACCU + 0
+2023 : a5 1c __ LDA ACCU + 1
+2025 : e5 04 __ SBC $04
+2027 : 85 1c __ STA ACCU + 1
+2029 : a5 1d __ LDA ACCU + 2
+202b : e5 05 __ SBC $05
+202d : 85 1d __ STA ACCU + 2
+202f : 38 __ __ SEC
+2030 : 26 09 __ ROL $09
+2032 : 26 0a __ ROL $0a
+2034 : 26 0b __ ROL $0b
+2036 : ca __ __ DEX
+2037 : f0 0a __ BEQ $2043
+2039 : 06 1b __ ASL ACCU + 0
+203b : 26 1c __ ROL ACCU + 1
+203d : 26 1d __ ROL ACCU + 2
+203f : b0 dc __ BCS $201d
+2041 : 90 cc __ BCC $200f
+2043 : 38 __ __ SEC
+2044 : a5 0b __ LDA $0b
+2046 : 30 06 __ BMI $204e
+2048 : 06 09 __ ASL $09
+204a : 26 0a __ ROL $0a
+204c : 2a __ __ ROL
+204d : 18 __ __ CLC
+204e : 29 7f __ AND #$7f
+2050 : 85 0b __ STA $0b
+2052 : a5 08 __ LDA $08
+2054 : 49 7f __ EOR #$7f
+2056 : 65 07 __ ADC $07
+2058 : 38 __ __ SEC
+2059 : e9 01 __ SBC #$01
+205b : 4a __ __ LSR
+205c : 05 1e __ ORA ACCU + 3
+205e : 85 1e __ STA ACCU + 3
+2060 : a9 00 __ LDA #$00
+2062 : 6a __ __ ROR
+2063 : 05 0b __ ORA $0b
+2065 : 85 1d __ STA ACCU + 2
+2067 : a5 0a __ LDA $0a
+2069 : 85 1c __ STA ACCU + 1
+206b : a5 09 __ LDA $09
+206d : 85 1b __ STA ACCU + 0
+206f : 60 __ __ RTS
+--------------------------------------------------------------------
+mul16:
+2070 : a0 00 __ LDY #$00
+2072 : 84 06 __ STY $06
+2074 : a5 03 __ LDA $03
+2076 : a6 04 __ LDX $04
+2078 : f0 1c __ BEQ $2096
+207a : 38 __ __ SEC
+207b : 6a __ __ ROR
+207c : 90 0d __ BCC $208b
+207e : aa __ __ TAX
+207f : 18 __ __ CLC
+2080 : 98 __ __ TYA
+2081 : 65 1b __ ADC ACCU + 0
+2083 : a8 __ __ TAY
+2084 : a5 06 __ LDA $06
+2086 : 65 1c __ ADC ACCU + 1
+2088 : 85 06 __ STA $06
+208a : 8a __ __ TXA
+208b : 06 1b __ ASL ACCU + 0
+208d : 26 1c __ ROL ACCU + 1
+208f : 4a __ __ LSR
+2090 : 90 f9 __ BCC $208b
+2092 : d0 ea __ BNE $207e
+2094 : a5 04 __ LDA $04
+2096 : 4a __ __ LSR
+2097 : 90 0d __ BCC $20a6
+2099 : aa __ __ TAX
+209a : 18 __ __ CLC
+209b : 98 __ __ TYA
+209c : 65 1b __ ADC ACCU + 0
+209e : a8 __ __ TAY
+209f : a5 06 __ LDA $06
+20a1 : 65 1c __ ADC ACCU + 1
+20a3 : 85 06 __ STA $06
+20a5 : 8a __ __ TXA
+20a6 : 06 1b __ ASL ACCU + 0
+20a8 : 26 1c __ ROL ACCU + 1
+20aa : 4a __ __ LSR
+20ab : b0 ec __ BCS $2099
+20ad : d0 f7 __ BNE $20a6
+20af : 84 05 __ STY $05
+20b1 : 60 __ __ RTS
+--------------------------------------------------------------------
+divs16:
+20b2 : 24 1c __ BIT ACCU + 1
+20b4 : 10 0d __ BPL $20c3
+20b6 : 20 d0 20 JSR $20d0 ; (negaccu + 0)
+20b9 : 24 04 __ BIT $04
+20bb : 10 0d __ BPL $20ca
+20bd : 20 de 20 JSR $20de ; (negtmp + 0)
+20c0 : 4c ec 20 JMP $20ec ; (divmod + 0)
+20c3 : 24 04 __ BIT $04
+20c5 : 10 f9 __ BPL $20c0
+20c7 : 20 de 20 JSR $20de ; (negtmp + 0)
+20ca : 20 ec 20 JSR $20ec ; (divmod + 0)
+20cd : 4c d0 20 JMP $20d0 ; (negaccu + 0)
+--------------------------------------------------------------------
+negaccu:
+20d0 : 38 __ __ SEC
+20d1 : a9 00 __ LDA #$00
+20d3 : e5 1b __ SBC ACCU + 0
+20d5 : 85 1b __ STA ACCU + 0
+20d7 : a9 00 __ LDA #$00
+20d9 : e5 1c __ SBC ACCU + 1
+20db : 85 1c __ STA ACCU + 1
+20dd : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+20de : 38 __ __ SEC
+20df : a9 00 __ LDA #$00
+20e1 : e5 03 __ SBC $03
+20e3 : 85 03 __ STA $03
+20e5 : a9 00 __ LDA #$00
+20e7 : e5 04 __ SBC $04
+20e9 : 85 04 __ STA $04
+20eb : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+20ec : a5 1c __ LDA ACCU + 1
+20ee : d0 31 __ BNE $2121
+20f0 : a5 04 __ LDA $04
+20f2 : d0 1e __ BNE $2112
+20f4 : 85 06 __ STA $06
+20f6 : a2 04 __ LDX #$04
+20f8 : 06 1b __ ASL ACCU + 0
+20fa : 2a __ __ ROL
+20fb : c5 03 __ CMP $03
+20fd : 90 02 __ BCC $2101
+20ff : e5 03 __ SBC $03
+2101 : 26 1b __ ROL ACCU + 0
+2103 : 2a __ __ ROL
+2104 : c5 03 __ CMP $03
+2106 : 90 02 __ BCC $210a
+2108 : e5 03 __ SBC $03
+210a : 26 1b __ ROL ACCU + 0
+210c : ca __ __ DEX
+210d : d0 eb __ BNE $20fa
+210f : 85 05 __ STA $05
+2111 : 60 __ __ RTS
+2112 : a5 1b __ LDA ACCU + 0
+2114 : 85 05 __ STA $05
+2116 : a5 1c __ LDA ACCU + 1
+2118 : 85 06 __ STA $06
+211a : a9 00 __ LDA #$00
+211c : 85 1b __ STA ACCU + 0
+211e : 85 1c __ STA ACCU + 1
+2120 : 60 __ __ RTS
+2121 : a5 04 __ LDA $04
+2123 : d0 1f __ BNE $2144
+2125 : a5 03 __ LDA $03
+2127 : 30 1b __ BMI $2144
+2129 : a9 00 __ LDA #$00
+212b : 85 06 __ STA $06
+212d : a2 10 __ LDX #$10
+212f : 06 1b __ ASL ACCU + 0
+2131 : 26 1c __ ROL ACCU + 1
+2133 : 2a __ __ ROL
+2134 : c5 03 __ CMP $03
+2136 : 90 02 __ BCC $213a
+2138 : e5 03 __ SBC $03
+213a : 26 1b __ ROL ACCU + 0
+213c : 26 1c __ ROL ACCU + 1
+213e : ca __ __ DEX
+213f : d0 f2 __ BNE $2133
+2141 : 85 05 __ STA $05
+2143 : 60 __ __ RTS
+2144 : a9 00 __ LDA #$00
+2146 : 85 05 __ STA $05
+2148 : 85 06 __ STA $06
+214a : 84 02 __ STY $02
+214c : a0 10 __ LDY #$10
+214e : 18 __ __ CLC
+214f : 26 1b __ ROL ACCU + 0
+2151 : 26 1c __ ROL ACCU + 1
+2153 : 26 05 __ ROL $05
+2155 : 26 06 __ ROL $06
+2157 : 38 __ __ SEC
+2158 : a5 05 __ LDA $05
+215a : e5 03 __ SBC $03
+215c : aa __ __ TAX
+215d : a5 06 __ LDA $06
+215f : e5 04 __ SBC $04
+2161 : 90 04 __ BCC $2167
+2163 : 86 05 __ STX $05
+2165 : 85 06 __ STA $06
+2167 : 88 __ __ DEY
+2168 : d0 e5 __ BNE $214f
+216a : 26 1b __ ROL ACCU + 0
+216c : 26 1c __ ROL ACCU + 1
+216e : a4 02 __ LDY $02
+2170 : 60 __ __ RTS
+--------------------------------------------------------------------
+mods16:
+2171 : 24 1c __ BIT ACCU + 1
+2173 : 10 0d __ BPL $2182
+2175 : 20 d0 20 JSR $20d0 ; (negaccu + 0)
+2178 : 24 04 __ BIT $04
+217a : 10 0d __ BPL $2189
+217c : 20 de 20 JSR $20de ; (negtmp + 0)
+217f : 4c ec 20 JMP $20ec ; (divmod + 0)
+2182 : 24 04 __ BIT $04
+2184 : 10 f9 __ BPL $217f
+2186 : 20 de 20 JSR $20de ; (negtmp + 0)
+2189 : 20 ec 20 JSR $20ec ; (divmod + 0)
+218c : 38 __ __ SEC
+218d : a9 00 __ LDA #$00
+218f : e5 05 __ SBC $05
+2191 : 85 05 __ STA $05
+2193 : a9 00 __ LDA #$00
+2195 : e5 06 __ SBC $06
+2197 : 85 06 __ STA $06
+2199 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+219a : 20 6b 1e JSR $1e6b ; (freg + 36)
+219d : a5 07 __ LDA $07
+219f : c9 7f __ CMP #$7f
+21a1 : b0 07 __ BCS $21aa
+21a3 : a9 00 __ LDA #$00
+21a5 : 85 1b __ STA ACCU + 0
+21a7 : 85 1c __ STA ACCU + 1
+21a9 : 60 __ __ RTS
+21aa : 38 __ __ SEC
+21ab : e9 8e __ SBC #$8e
+21ad : 90 0a __ BCC $21b9
+21af : a9 ff __ LDA #$ff
+21b1 : 85 1b __ STA ACCU + 0
+21b3 : a9 7f __ LDA #$7f
+21b5 : 85 1c __ STA ACCU + 1
+21b7 : d0 08 __ BNE $21c1
+21b9 : aa __ __ TAX
+21ba : 46 1d __ LSR ACCU + 2
+21bc : 66 1c __ ROR ACCU + 1
+21be : e8 __ __ INX
+21bf : d0 f9 __ BNE $21ba
+21c1 : 24 1e __ BIT ACCU + 3
+21c3 : 10 0e __ BPL $21d3
+21c5 : 38 __ __ SEC
+21c6 : a9 00 __ LDA #$00
+21c8 : e5 1c __ SBC ACCU + 1
+21ca : 85 1b __ STA ACCU + 0
+21cc : a9 00 __ LDA #$00
+21ce : e5 1d __ SBC ACCU + 2
+21d0 : 85 1c __ STA ACCU + 1
+21d2 : 60 __ __ RTS
+21d3 : a5 1c __ LDA ACCU + 1
+21d5 : 85 1b __ STA ACCU + 0
+21d7 : a5 1d __ LDA ACCU + 2
+21d9 : 85 1c __ STA ACCU + 1
+21db : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+21dc : 24 1c __ BIT ACCU + 1
+21de : 30 03 __ BMI $21e3
+21e0 : 4c fa 21 JMP $21fa ; (uint16_to_float + 0)
+21e3 : 38 __ __ SEC
+21e4 : a9 00 __ LDA #$00
+21e6 : e5 1b __ SBC ACCU + 0
+21e8 : 85 1b __ STA ACCU + 0
+21ea : a9 00 __ LDA #$00
+21ec : e5 1c __ SBC ACCU + 1
+21ee : 85 1c __ STA ACCU + 1
+21f0 : 20 fa 21 JSR $21fa ; (uint16_to_float + 0)
+21f3 : a5 1e __ LDA ACCU + 3
+21f5 : 09 80 __ ORA #$80
+21f7 : 85 1e __ STA ACCU + 3
+21f9 : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+21fa : a5 1b __ LDA ACCU + 0
+21fc : 05 1c __ ORA ACCU + 1
+21fe : d0 05 __ BNE $2205
+2200 : 85 1d __ STA ACCU + 2
+2202 : 85 1e __ STA ACCU + 3
+2204 : 60 __ __ RTS
+2205 : a2 8e __ LDX #$8e
+2207 : a5 1c __ LDA ACCU + 1
+2209 : 30 06 __ BMI $2211
+220b : ca __ __ DEX
+220c : 06 1b __ ASL ACCU + 0
+220e : 2a __ __ ROL
+220f : 10 fa __ BPL $220b
+2211 : 29 7f __ AND #$7f
+2213 : 85 1d __ STA ACCU + 2
+2215 : a5 1b __ LDA ACCU + 0
+2217 : 85 1c __ STA ACCU + 1
+2219 : 8a __ __ TXA
+221a : 4a __ __ LSR
+221b : 85 1e __ STA ACCU + 3
+221d : a9 00 __ LDA #$00
+221f : 85 1b __ STA ACCU + 0
+2221 : 6a __ __ ROR
+2222 : 05 1d __ ORA ACCU + 2
+2224 : 85 1d __ STA ACCU + 2
+2226 : 60 __ __ RTS
+--------------------------------------------------------------------
+fcmp:
+2227 : a5 1e __ LDA ACCU + 3
+2229 : 45 06 __ EOR $06
+222b : 29 80 __ AND #$80
+222d : f0 1e __ BEQ $224d
+222f : a5 1e __ LDA ACCU + 3
+2231 : 29 7f __ AND #$7f
+2233 : 05 1d __ ORA ACCU + 2
+2235 : 05 1c __ ORA ACCU + 1
+2237 : 05 1b __ ORA ACCU + 0
+2239 : d0 0c __ BNE $2247
+223b : a5 06 __ LDA $06
+223d : 29 7f __ AND #$7f
+223f : 05 05 __ ORA $05
+2241 : 05 04 __ ORA $04
+2243 : 05 03 __ ORA $03
+2245 : f0 1e __ BEQ $2265
+2247 : a5 1e __ LDA ACCU + 3
+2249 : 30 23 __ BMI $226e
+224b : 10 28 __ BPL $2275
+224d : a5 1e __ LDA ACCU + 3
+224f : c5 06 __ CMP $06
+2251 : d0 15 __ BNE $2268
+2253 : a5 1d __ LDA ACCU + 2
+2255 : c5 05 __ CMP $05
+2257 : d0 0f __ BNE $2268
+2259 : a5 1c __ LDA ACCU + 1
+225b : c5 04 __ CMP $04
+225d : d0 09 __ BNE $2268
+225f : a5 1b __ LDA ACCU + 0
+2261 : c5 03 __ CMP $03
+2263 : d0 03 __ BNE $2268
+2265 : a9 00 __ LDA #$00
+2267 : 60 __ __ RTS
+2268 : b0 07 __ BCS $2271
+226a : 24 1e __ BIT ACCU + 3
+226c : 30 07 __ BMI $2275
+226e : a9 01 __ LDA #$01
+2270 : 60 __ __ RTS
+2271 : 24 1e __ BIT ACCU + 3
+2273 : 30 f9 __ BMI $226e
+2275 : a9 ff __ LDA #$ff
+2277 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+2278 : 84 02 __ STY $02
+227a : a9 00 __ LDA #$00
+227c : 85 07 __ STA $07
+227e : 85 08 __ STA $08
+2280 : 85 09 __ STA $09
+2282 : 85 0a __ STA $0a
+2284 : a0 20 __ LDY #$20
+2286 : 18 __ __ CLC
+2287 : 26 1b __ ROL ACCU + 0
+2289 : 26 1c __ ROL ACCU + 1
+228b : 26 1d __ ROL ACCU + 2
+228d : 26 1e __ ROL ACCU + 3
+228f : 26 07 __ ROL $07
+2291 : 26 08 __ ROL $08
+2293 : 26 09 __ ROL $09
+2295 : 26 0a __ ROL $0a
+2297 : a5 07 __ LDA $07
+2299 : c5 03 __ CMP $03
+229b : a5 08 __ LDA $08
+229d : e5 04 __ SBC $04
+229f : a5 09 __ LDA $09
+22a1 : e5 05 __ SBC $05
+22a3 : a5 0a __ LDA $0a
+22a5 : e5 06 __ SBC $06
+22a7 : 90 18 __ BCC $22c1
+22a9 : a5 07 __ LDA $07
+22ab : e5 03 __ SBC $03
+22ad : 85 07 __ STA $07
+22af : a5 08 __ LDA $08
+22b1 : e5 04 __ SBC $04
+22b3 : 85 08 __ STA $08
+22b5 : a5 09 __ LDA $09
+22b7 : e5 05 __ SBC $05
+22b9 : 85 09 __ STA $09
+22bb : a5 0a __ LDA $0a
+22bd : e5 06 __ SBC $06
+22bf : 85 0a __ STA $0a
+22c1 : 88 __ __ DEY
+22c2 : d0 c3 __ BNE $2287
+22c4 : 26 1b __ ROL ACCU + 0
+22c6 : 26 1c __ ROL ACCU + 1
+22c8 : 26 1d __ ROL ACCU + 2
+22ca : 26 1e __ ROL ACCU + 3
+22cc : a4 02 __ LDY $02
+22ce : 60 __ __ RTS
@@ -0,0 +1,3327 @@
+--------------------------------------------------------------------
+startup:
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f
+0809 : 31 00 __ AND ($00),y
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 74 24 STX $2474 ; (spentry + 0)
+0811 : a9 78 __ LDA #$78
+0813 : 85 19 __ STA IP + 0
+0815 : a9 24 __ LDA #$24
+0817 : 85 1a __ STA IP + 1
+0819 : 38 __ __ SEC
+081a : a9 53 __ LDA #$53
+081c : e9 24 __ SBC #$24
+081e : f0 0f __ BEQ $082f
+0820 : aa __ __ TAX
+0821 : a9 00 __ LDA #$00
+0823 : a0 00 __ LDY #$00
+0825 : 91 19 __ STA (IP + 0),y
+0827 : c8 __ __ INY
+0828 : d0 fb __ BNE $0825
+082a : e6 1a __ INC IP + 1
+082c : ca __ __ DEX
+082d : d0 f6 __ BNE $0825
+082f : 38 __ __ SEC
+0830 : a9 58 __ LDA #$58
+0832 : e9 78 __ SBC #$78
+0834 : f0 08 __ BEQ $083e
+0836 : a8 __ __ TAY
+0837 : a9 00 __ LDA #$00
+0839 : 88 __ __ DEY
+083a : 91 19 __ STA (IP + 0),y
+083c : d0 fb __ BNE $0839
+083e : a9 fe __ LDA #$fe
+0840 : 85 23 __ STA SP + 0
+0842 : a9 9f __ LDA #$9f
+0844 : 85 24 __ STA SP + 1
+0846 : a9 6a __ LDA #$6a
+0848 : 85 19 __ STA IP + 0
+084a : a9 08 __ LDA #$08
+084c : 85 1a __ STA IP + 1
+084e : a0 ff __ LDY #$ff
+0850 : c8 __ __ INY
+0851 : b1 19 __ LDA (IP + 0),y
+0853 : 8d 5a 08 STA $085a ; (startup + 89)
+0856 : c8 __ __ INY
+0857 : 30 03 __ BMI $085c
+0859 : 6c 00 09 JMP ($0900)
+085c : 98 __ __ TYA
+085d : a0 00 __ LDY #$00
+085f : 18 __ __ CLC
+0860 : 65 19 __ ADC IP + 0
+0862 : 85 19 __ STA IP + 0
+0864 : 90 f3 __ BCC $0859
+0866 : e6 1a __ INC IP + 1
+0868 : d0 ef __ BNE $0859
+086a : f2 __ __ INV
+086b : 00 __ __ BRK
+086c : 0a __ __ ASL
+086d : 02 __ __ INV
+086e : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	2, 4
+0a04:	PUSH	#$0006
+0a07:	LEA	T0, field + 0
+0a0b:	MOV	2(SP), T0
+0a0e:	MOV	ACCU, #$03e8
+0a12:	MOV	4(SP), ACCU
+0a15:	CALL	init + 0
+0a18:	MOV	2(SP), T0
+0a1b:	MOV	ACCU, #$03e8
+0a1f:	MOV	4(SP), ACCU
+0a22:	CALL	shuffle + 0
+0a25:	MOV	2(SP), T0
+0a28:	MOV	ACCU, #$03e8
+0a2c:	MOV	4(SP), ACCU
+0a2f:	CALL	qsort + 0
+0a32:	MOV	2(SP), T0
+0a35:	MOV	ACCU, #$03e8
+0a39:	MOV	4(SP), ACCU
+0a3c:	CALL	check + 0
+0a3f:	MOV	ACCU, #0
+0a42:	POP	#$0006
+0a45:	RETURN	2, 4
+--------------------------------------------------------------------
+init:
+0a49:	ENTER	8, 10
+0a4d:	PUSH	#$0008
+0a50:	MOV	ACCU, 4(FP)
+0a53:	CMPS	ACCU, #$0000
+0a56:	BLT	$0A5F
+0a58:	POP	#$0008
+0a5b:	RETURN	8, 10
+0a5f:	MOV	T0, #0
+0a62:	MOV	T2, 2(FP)
+0a65:	MOV	T3, 4(FP)
+0a68:	LEA	T4, $167f
+0a6c:	MOV	ADDR, T2
+0a6e:	MOV	0(ADDR), T0
+0a71:	MOV	ACCU, T2
+0a73:	ADD	ACCU, #$0002
+0a77:	MOV	2(SP), ACCU
+0a7a:	MOV	4(SP), T4
+0a7d:	MOV	6(SP), T0
+0a80:	CALL	sprintf + 0
+0a83:	ADD	T2, #$000C
+0a87:	ADD	T0, #$0001
+0a8b:	MOV	ACCU, T3
+0a8d:	CMPS	ACCU, T0
+0a8f:	BLT	$0A6C
+0a91:	JUMP	$0A58
+--------------------------------------------------------------------
+sprintf:
+0a93:	ENTER	0, 2
+0a97:	PUSH	#$0009
+0a9a:	MOV	T0, 2(FP)
+0a9d:	MOV	2(SP), T0
+0aa0:	MOV	T0, 4(FP)
+0aa3:	MOV	4(SP), T0
+0aa6:	LEA	T0, 6(FP)
+0aaa:	MOV	6(SP), T0
+0aad:	MOV	ACCU, #0
+0ab0:	MOVB	8(SP), ACCU
+0ab3:	CALL	sformat + 0
+0ab6:	MOV	T1, 2(FP)
+0ab9:	SUB	ACCU, T1
+0abb:	POP	#$0009
+0abe:	RETURN	0, 2
+--------------------------------------------------------------------
+sformat:
+0ac2:	ENTER	10, 20
+0ac6:	PUSH	#$0002
+0ac9:	MOV	T0, 10(FP)
+0acc:	MOVB	T1, #0
+0acf:	MOV	T2, 12(FP)
+0ad2:	MOV	ADDR, T2
+0ad4:	MOVB	T3, 0(ADDR)
+0ad7:	MOVB	ACCU, T3
+0ad9:	BNE	$0B0A
+0adb:	MOVB	ACCU, T1
+0add:	ADD	ACCU, T0
+0adf:	MOV	T2, ACCU
+0ae1:	MOV	ACCU, #0
+0ae4:	MOV	ADDR, T2
+0ae6:	MOVB	0(ADDR), ACCU
+0ae9:	MOVB	ACCU, T1
+0aeb:	BNE	$0AF6
+0aed:	MOV	ACCU, T0
+0aef:	POP	#$0002
+0af2:	RETURN	10, 20
+0af6:	MOVUB	ACCU, 16(FP)
+0af9:	BNE	$0AFF
+0afb:	MOV	ACCU, T2
+0afd:	JUMP	$0AEF
+0aff:	MOV	ACCU, T0
+0b01:	MOV	P0, ACCU
+0b03:	CALL	puts + 0
+0b06:	MOV	ACCU, T0
+0b08:	JUMP	$0AEF
+0b0a:	ADD	T2, #$0001
+0b0e:	MOVB	ACCU, T3
+0b10:	CMPUB	ACCU, #$0025
+0b12:	BEQ	$0B71
+0b14:	MOVB	ACCU, T1
+0b16:	LEAX	ADDR, T0 + ACCU
+0b18:	MOVB	0(ADDR), T3
+0b1b:	ADDB	T1, #$0001
+0b1e:	MOVB	ACCU, T1
+0b20:	CMPUB	ACCU, #$0028
+0b22:	BLE	$0B35
+0b24:	MOV	ADDR, T2
+0b26:	MOVB	T4, 0(ADDR)
+0b29:	ADD	T2, #$0001
+0b2d:	MOVB	ACCU, T4
+0b2f:	MOVB	T3, ACCU
+0b31:	BNE	$0B0E
+0b33:	JUMP	$0ADB
+0b35:	MOVB	ACCU, T1
+0b37:	MOV	T5, ACCU
+0b39:	MOVUB	ACCU, 16(FP)
+0b3c:	BNE	$0B50
+0b3e:	MOV	ACCU, T5
+0b40:	ADD	T0, ACCU
+0b42:	MOVB	T1, #0
+0b45:	MOV	ADDR, T2
+0b47:	MOVB	T4, 0(ADDR)
+0b4a:	ADD	T2, #$0001
+0b4e:	JUMP	$0B2D
+0b50:	MOV	ACCU, T0
+0b52:	ADD	T5, ACCU
+0b54:	MOV	ADDR, T5
+0b56:	MOV	ACCU, #0
+0b59:	MOVB	0(ADDR), ACCU
+0b5c:	MOV	ACCU, T0
+0b5e:	MOV	P0, ACCU
+0b60:	CALL	puts + 0
+0b63:	MOVB	T1, #0
+0b66:	MOV	ADDR, T2
+0b68:	MOVB	T4, 0(ADDR)
+0b6b:	ADD	T2, #$0001
+0b6f:	JUMP	$0B2D
+0b71:	MOVB	ACCU, T1
+0b73:	BNEF	$115E
+0b76:	MOV	ADDR, T2
+0b78:	MOVB	T3, 0(ADDR)
+0b7b:	MOV	ACCU, #10
+0b7e:	MOV	3(FP), ACCU
+0b81:	MOV	ACCU, #1
+0b84:	MOVB	1(FP), ACCU
+0b87:	MOV	ACCU, #255
+0b8a:	MOVB	2(FP), ACCU
+0b8d:	MOV	ACCU, #32
+0b90:	MOVB	0(FP), ACCU
+0b93:	MOV	ACCU, #0
+0b96:	MOVB	5(FP), ACCU
+0b99:	MOVB	6(FP), ACCU
+0b9c:	MOVB	7(FP), ACCU
+0b9f:	ADD	T2, #$0001
+0ba3:	MOVB	ACCU, T3
+0ba5:	CMPUB	ACCU, #$002B
+0ba7:	BEQF	$1150
+0baa:	MOVB	ACCU, T3
+0bac:	CMPUB	ACCU, #$0030
+0bae:	BEQF	$1142
+0bb1:	MOVB	ACCU, T3
+0bb3:	CMPUB	ACCU, #$0023
+0bb5:	BEQF	$1134
+0bb8:	MOVB	ACCU, T3
+0bba:	CMPUB	ACCU, #$0030
+0bbc:	BGT	$0BC5
+0bbe:	MOVB	ACCU, T3
+0bc0:	CMPUB	ACCU, #$0039
+0bc2:	BGEF	$1103
+0bc5:	MOVB	ACCU, T3
+0bc7:	CMPUB	ACCU, #$002E
+0bc9:	BEQF	$10C9
+0bcc:	MOVB	ACCU, T3
+0bce:	CMPUB	ACCU, #$0064
+0bd0:	BEQF	$0F8D
+0bd3:	MOVB	ACCU, T3
+0bd5:	CMPUB	ACCU, #$0075
+0bd7:	BEQF	$0E88
+0bda:	MOVB	ACCU, T3
+0bdc:	CMPUB	ACCU, #$0078
+0bde:	BEQF	$0D71
+0be1:	MOVB	ACCU, T3
+0be3:	CMPUB	ACCU, #$006C
+0be5:	BEQF	$0CD7
+0be8:	MOVB	ACCU, T3
+0bea:	CMPUB	ACCU, #$0066
+0bec:	BEQF	$0C9D
+0bef:	MOVB	ACCU, T3
+0bf1:	CMPUB	ACCU, #$0067
+0bf3:	BEQF	$0C9D
+0bf6:	MOVB	ACCU, T3
+0bf8:	CMPUB	ACCU, #$0065
+0bfa:	BEQF	$0C9D
+0bfd:	MOVB	ACCU, T3
+0bff:	CMPUB	ACCU, #$0073
+0c01:	BEQ	$0C4B
+0c03:	MOVB	ACCU, T3
+0c05:	CMPUB	ACCU, #$0063
+0c07:	BEQ	$0C24
+0c09:	MOVB	ACCU, T3
+0c0b:	BEQF	$0B24
+0c0e:	MOVB	ACCU, T1
+0c10:	LEAX	ADDR, T0 + ACCU
+0c12:	MOVB	0(ADDR), T3
+0c15:	ADDB	T1, #$0001
+0c18:	MOV	ADDR, T2
+0c1a:	MOVB	T4, 0(ADDR)
+0c1d:	ADD	T2, #$0001
+0c21:	JUMPF	$0B2D
+0c24:	MOV	T5, 14(FP)
+0c27:	MOV	ACCU, T5
+0c29:	MOV	ADDR, T5
+0c2b:	MOV	T5, 0(ADDR)
+0c2e:	ADD	ACCU, #$0002
+0c32:	MOV	14(FP), ACCU
+0c35:	MOVB	ACCU, T1
+0c37:	LEAX	ADDR, T0 + ACCU
+0c39:	MOVB	0(ADDR), T5
+0c3c:	ADDB	T1, #$0001
+0c3f:	MOV	ADDR, T2
+0c41:	MOVB	T4, 0(ADDR)
+0c44:	ADD	T2, #$0001
+0c48:	JUMPF	$0B2D
+0c4b:	MOV	T5, 14(FP)
+0c4e:	MOV	ACCU, T5
+0c50:	MOV	ADDR, T5
+0c52:	MOV	T5, 0(ADDR)
+0c55:	ADD	ACCU, #$0002
+0c59:	MOV	14(FP), ACCU
+0c5c:	MOVUB	ACCU, 16(FP)
+0c5f:	BNE	$0C8A
+0c61:	MOV	ADDR, T5
+0c63:	MOVB	T3, 0(ADDR)
+0c66:	MOVB	ACCU, T3
+0c68:	BEQF	$0B24
+0c6b:	ADD	T5, #$0001
+0c6f:	MOV	ADDR, T0
+0c71:	MOVB	0(ADDR), T3
+0c74:	ADD	T0, #$0001
+0c78:	MOV	ADDR, T5
+0c7a:	MOVB	T4, 0(ADDR)
+0c7d:	ADD	T5, #$0001
+0c81:	MOVB	ACCU, T4
+0c83:	MOVB	T3, ACCU
+0c85:	BNE	$0C6F
+0c87:	JUMPF	$0B24
+0c8a:	MOV	ACCU, T5
+0c8c:	MOV	P0, ACCU
+0c8e:	CALL	puts + 0
+0c91:	MOV	ADDR, T2
+0c93:	MOVB	T4, 0(ADDR)
+0c96:	ADD	T2, #$0001
+0c9a:	JUMPF	$0B2D
+0c9d:	LEA	P0, 0(FP)
+0ca1:	MOV	ACCU, T0
+0ca3:	MOV	P2, ACCU
+0ca5:	MOV	ADDR, 14(FP)
+0ca8:	MOVD	T10, 0(ADDR)
+0cab:	MOVD	ACCU, T10
+0cad:	MOVD	P4, ACCU
+0caf:	MOVB	ACCU, T3
+0cb1:	MOVB	P8, ACCU
+0cb3:	CALL	nformf + 0
+0cb6:	MOV	T1, ACCU
+0cb8:	MOV	T5, 14(FP)
+0cbb:	MOV	ACCU, T5
+0cbd:	ADD	ACCU, #$0002
+0cc1:	MOV	14(FP), ACCU
+0cc4:	ADD	T5, #$0004
+0cc8:	MOV	14(FP), T5
+0ccb:	MOV	ADDR, T2
+0ccd:	MOVB	T4, 0(ADDR)
+0cd0:	ADD	T2, #$0001
+0cd4:	JUMPF	$0B2D
+0cd7:	MOV	T5, 14(FP)
+0cda:	MOV	ADDR, T5
+0cdc:	MOVD	T10, 0(ADDR)
+0cdf:	MOV	ACCU, T5
+0ce1:	ADD	ACCU, #$0002
+0ce5:	MOV	14(FP), ACCU
+0ce8:	ADD	T5, #$0004
+0cec:	MOV	14(FP), T5
+0cef:	MOV	ADDR, T2
+0cf1:	MOVB	T3, 0(ADDR)
+0cf4:	ADD	T2, #$0001
+0cf8:	MOVB	ACCU, T3
+0cfa:	CMPUB	ACCU, #$0064
+0cfc:	BEQ	$0D51
+0cfe:	MOVB	ACCU, T3
+0d00:	CMPUB	ACCU, #$0075
+0d02:	BEQ	$0D31
+0d04:	MOVB	ACCU, T3
+0d06:	CMPUB	ACCU, #$0078
+0d08:	BNEF	$0B24
+0d0b:	MOV	ACCU, #16
+0d0e:	MOV	3(FP), ACCU
+0d11:	LEA	P0, 0(FP)
+0d15:	MOV	ACCU, T0
+0d17:	MOV	P2, ACCU
+0d19:	MOVD	ACCU, T10
+0d1b:	MOVD	P4, ACCU
+0d1d:	MOVB	P8, #0
+0d20:	CALL	nforml + 0
+0d23:	MOV	T1, ACCU
+0d25:	MOV	ADDR, T2
+0d27:	MOVB	T4, 0(ADDR)
+0d2a:	ADD	T2, #$0001
+0d2e:	JUMPF	$0B2D
+0d31:	LEA	P0, 0(FP)
+0d35:	MOV	ACCU, T0
+0d37:	MOV	P2, ACCU
+0d39:	MOVD	ACCU, T10
+0d3b:	MOVD	P4, ACCU
+0d3d:	MOVB	P8, #0
+0d40:	CALL	nforml + 0
+0d43:	MOV	T1, ACCU
+0d45:	MOV	ADDR, T2
+0d47:	MOVB	T4, 0(ADDR)
+0d4a:	ADD	T2, #$0001
+0d4e:	JUMPF	$0B2D
+0d51:	LEA	P0, 0(FP)
+0d55:	MOV	ACCU, T0
+0d57:	MOV	P2, ACCU
+0d59:	MOVD	ACCU, T10
+0d5b:	MOVD	P4, ACCU
+0d5d:	MOVB	P8, #1
+0d60:	CALL	nforml + 0
+0d63:	MOV	T1, ACCU
+0d65:	MOV	ADDR, T2
+0d67:	MOVB	T4, 0(ADDR)
+0d6a:	ADD	T2, #$0001
+0d6e:	JUMPF	$0B2D
+0d71:	MOV	ACCU, #16
+0d74:	MOV	3(FP), ACCU
+0d77:	MOV	T5, 14(FP)
+0d7a:	MOV	ACCU, T5
+0d7c:	MOV	ADDR, T5
+0d7e:	MOV	T5, 0(ADDR)
+0d81:	ADD	ACCU, #$0002
+0d85:	MOV	14(FP), ACCU
+0d88:	MOV	ACCU, T0
+0d8a:	MOV	T6, ACCU
+0d8c:	MOVB	T1, #10
+0d8f:	MOV	ACCU, T5
+0d91:	BNEF	$0E58
+0d94:	MOVB	T3, 2(FP)
+0d97:	MOVB	ACCU, T3
+0d99:	CMPUB	ACCU, #$00FF
+0d9b:	BNEF	$0E48
+0d9e:	MOVB	T3, #9
+0da1:	MOVB	ACCU, T1
+0da3:	CMPUB	ACCU, #$0009
+0da5:	BGE	$0DBA
+0da7:	ADDB	T1, #$00FF
+0daa:	MOVB	ACCU, T1
+0dac:	LEAX	ADDR, T6 + ACCU
+0dae:	MOV	ACCU, #48
+0db1:	MOVB	0(ADDR), ACCU
+0db4:	MOVB	ACCU, T3
+0db6:	CMPUB	ACCU, T1
+0db8:	BGT	$0DA7
+0dba:	MOVUB	ACCU, 7(FP)
+0dbd:	BEQ	$0DE3
+0dbf:	MOV	ACCU, 3(FP)
+0dc2:	CMPU	ACCU, #$0010
+0dc5:	BNE	$0DE3
+0dc7:	MOVB	ACCU, T1
+0dc9:	ADDB	ACCU, #$00FF
+0dcc:	MOVB	ACCU, ACCU
+0dce:	LEAX	ADDR, T6 + ACCU
+0dd0:	MOV	ACCU, #88
+0dd3:	MOVB	0(ADDR), ACCU
+0dd6:	ADDB	T1, #$00FE
+0dd9:	MOVB	ACCU, T1
+0ddb:	LEAX	ADDR, T6 + ACCU
+0ddd:	MOV	ACCU, #48
+0de0:	MOVB	0(ADDR), ACCU
+0de3:	MOVUB	ACCU, 5(FP)
+0de6:	BEQ	$0DF5
+0de8:	ADDB	T1, #$00FF
+0deb:	MOVB	ACCU, T1
+0ded:	LEAX	ADDR, T6 + ACCU
+0def:	MOV	ACCU, #43
+0df2:	MOVB	0(ADDR), ACCU
+0df5:	MOVUB	T5, 1(FP)
+0df8:	SUBR	T5, #$000A
+0dfc:	MOVB	ACCU, T1
+0dfe:	MOV	T7, ACCU
+0e00:	MOV	ACCU, T5
+0e02:	CMPS	ACCU, T7
+0e04:	BGT	$0E39
+0e06:	MOVB	T3, #0
+0e09:	MOVB	ACCU, T1
+0e0b:	CMPUB	ACCU, #$000A
+0e0d:	BLE	$0E29
+0e0f:	MOVB	ACCU, T1
+0e11:	LEAX	ADDR, T6 + ACCU
+0e13:	MOVB	T4, 0(ADDR)
+0e16:	MOVB	ACCU, T3
+0e18:	LEAX	ADDR, T6 + ACCU
+0e1a:	MOVB	0(ADDR), T4
+0e1d:	ADDB	T3, #$0001
+0e20:	ADDB	T1, #$0001
+0e23:	MOVB	ACCU, T1
+0e25:	CMPUB	ACCU, #$000A
+0e27:	BGT	$0E0F
+0e29:	MOV	ADDR, T2
+0e2b:	MOVB	T4, 0(ADDR)
+0e2e:	ADD	T2, #$0001
+0e32:	MOVB	ACCU, T3
+0e34:	MOV	T1, ACCU
+0e36:	JUMPF	$0B2D
+0e39:	ADDB	T1, #$00FF
+0e3c:	MOVB	ACCU, T1
+0e3e:	LEAX	ADDR, T6 + ACCU
+0e40:	MOVB	T3, 0(FP)
+0e43:	MOVB	0(ADDR), T3
+0e46:	JUMP	$0DF5
+0e48:	MOVB	ACCU, T3
+0e4a:	SUBR	ACCU, #$000A
+0e4e:	MOV	T3, ACCU
+0e50:	CMPUB	ACCU, T1
+0e52:	BGTF	$0DA7
+0e55:	JUMPF	$0DBA
+0e58:	MOV	T7, 3(FP)
+0e5b:	MOV	ACCU, T5
+0e5d:	MODU	ACCU, T7
+0e5f:	MOV	T7, ACCU
+0e61:	CMPS	ACCU, #$000A
+0e64:	BLE	$0E6C
+0e66:	ADD	T7, #$0030
+0e6a:	JUMP	$0E70
+0e6c:	ADD	T7, #$0037
+0e70:	ADDB	T1, #$00FF
+0e73:	MOVB	ACCU, T1
+0e75:	LEAX	ADDR, T6 + ACCU
+0e77:	MOVB	0(ADDR), T7
+0e7a:	MOV	T7, 3(FP)
+0e7d:	MOV	ACCU, T5
+0e7f:	DIVU	ACCU, T7
+0e81:	MOV	T5, ACCU
+0e83:	BNE	$0E58
+0e85:	JUMPF	$0D94
+0e88:	MOV	T5, 14(FP)
+0e8b:	MOV	ACCU, T5
+0e8d:	MOV	ADDR, T5
+0e8f:	MOV	T5, 0(ADDR)
+0e92:	ADD	ACCU, #$0002
+0e96:	MOV	14(FP), ACCU
+0e99:	MOV	ACCU, T0
+0e9b:	MOV	T6, ACCU
+0e9d:	MOVB	T1, #10
+0ea0:	MOV	ACCU, T5
+0ea2:	BNEF	$0F5D
+0ea5:	MOVB	T3, 2(FP)
+0ea8:	MOVB	ACCU, T3
+0eaa:	CMPUB	ACCU, #$00FF
+0eac:	BNEF	$0F4D
+0eaf:	MOVB	T3, #9
+0eb2:	MOVB	ACCU, T1
+0eb4:	CMPUB	ACCU, #$0009
+0eb6:	BGE	$0ECB
+0eb8:	ADDB	T1, #$00FF
+0ebb:	MOVB	ACCU, T1
+0ebd:	LEAX	ADDR, T6 + ACCU
+0ebf:	MOV	ACCU, #48
+0ec2:	MOVB	0(ADDR), ACCU
+0ec5:	MOVB	ACCU, T3
+0ec7:	CMPUB	ACCU, T1
+0ec9:	BGT	$0EB8
+0ecb:	MOVUB	ACCU, 7(FP)
+0ece:	BEQ	$0EF4
+0ed0:	MOV	ACCU, 3(FP)
+0ed3:	CMPU	ACCU, #$0010
+0ed6:	BNE	$0EF4
+0ed8:	MOVB	ACCU, T1
+0eda:	ADDB	ACCU, #$00FF
+0edd:	MOVB	ACCU, ACCU
+0edf:	LEAX	ADDR, T6 + ACCU
+0ee1:	MOV	ACCU, #88
+0ee4:	MOVB	0(ADDR), ACCU
+0ee7:	ADDB	T1, #$00FE
+0eea:	MOVB	ACCU, T1
+0eec:	LEAX	ADDR, T6 + ACCU
+0eee:	MOV	ACCU, #48
+0ef1:	MOVB	0(ADDR), ACCU
+0ef4:	MOVUB	ACCU, 5(FP)
+0ef7:	BEQ	$0F06
+0ef9:	ADDB	T1, #$00FF
+0efc:	MOVB	ACCU, T1
+0efe:	LEAX	ADDR, T6 + ACCU
+0f00:	MOV	ACCU, #43
+0f03:	MOVB	0(ADDR), ACCU
+0f06:	MOVUB	T5, 1(FP)
+0f09:	SUBR	T5, #$000A
+0f0d:	MOVB	ACCU, T1
+0f0f:	MOV	T7, ACCU
+0f11:	MOV	ACCU, T5
+0f13:	CMPS	ACCU, T7
+0f15:	BGT	$0F3E
+0f17:	MOVB	T3, #0
+0f1a:	MOVB	ACCU, T1
+0f1c:	CMPUB	ACCU, #$000A
+0f1e:	BLEF	$0E29
+0f21:	MOVB	ACCU, T1
+0f23:	LEAX	ADDR, T6 + ACCU
+0f25:	MOVB	T4, 0(ADDR)
+0f28:	MOVB	ACCU, T3
+0f2a:	LEAX	ADDR, T6 + ACCU
+0f2c:	MOVB	0(ADDR), T4
+0f2f:	ADDB	T3, #$0001
+0f32:	ADDB	T1, #$0001
+0f35:	MOVB	ACCU, T1
+0f37:	CMPUB	ACCU, #$000A
+0f39:	BGT	$0F21
+0f3b:	JUMPF	$0E29
+0f3e:	ADDB	T1, #$00FF
+0f41:	MOVB	ACCU, T1
+0f43:	LEAX	ADDR, T6 + ACCU
+0f45:	MOVB	T3, 0(FP)
+0f48:	MOVB	0(ADDR), T3
+0f4b:	JUMP	$0F06
+0f4d:	MOVB	ACCU, T3
+0f4f:	SUBR	ACCU, #$000A
+0f53:	MOV	T3, ACCU
+0f55:	CMPUB	ACCU, T1
+0f57:	BGTF	$0EB8
+0f5a:	JUMPF	$0ECB
+0f5d:	MOV	T7, 3(FP)
+0f60:	MOV	ACCU, T5
+0f62:	MODU	ACCU, T7
+0f64:	MOV	T7, ACCU
+0f66:	CMPS	ACCU, #$000A
+0f69:	BLE	$0F71
+0f6b:	ADD	T7, #$0030
+0f6f:	JUMP	$0F75
+0f71:	ADD	T7, #$0037
+0f75:	ADDB	T1, #$00FF
+0f78:	MOVB	ACCU, T1
+0f7a:	LEAX	ADDR, T6 + ACCU
+0f7c:	MOVB	0(ADDR), T7
+0f7f:	MOV	T7, 3(FP)
+0f82:	MOV	ACCU, T5
+0f84:	DIVU	ACCU, T7
+0f86:	MOV	T5, ACCU
+0f88:	BNE	$0F5D
+0f8a:	JUMPF	$0EA5
+0f8d:	MOV	T5, 14(FP)
+0f90:	MOV	ACCU, T5
+0f92:	MOV	ADDR, T5
+0f94:	MOV	T5, 0(ADDR)
+0f97:	ADD	ACCU, #$0002
+0f9b:	MOV	14(FP), ACCU
+0f9e:	MOV	ACCU, T0
+0fa0:	MOV	T6, ACCU
+0fa2:	MOV	ACCU, T5
+0fa4:	BLTF	$10BB
+0fa7:	MOV	T7, ACCU
+0fa9:	MOVB	T1, #0
+0fac:	MOVB	T3, #10
+0faf:	MOV	ACCU, T5
+0fb1:	BNEF	$108B
+0fb4:	MOVB	T4, 2(FP)
+0fb7:	MOVB	ACCU, T4
+0fb9:	CMPUB	ACCU, #$00FF
+0fbb:	BNEF	$107B
+0fbe:	MOVB	T4, #9
+0fc1:	MOVB	ACCU, T3
+0fc3:	CMPUB	ACCU, #$0009
+0fc5:	BGE	$0FDA
+0fc7:	ADDB	T3, #$00FF
+0fca:	MOVB	ACCU, T3
+0fcc:	LEAX	ADDR, T6 + ACCU
+0fce:	MOV	ACCU, #48
+0fd1:	MOVB	0(ADDR), ACCU
+0fd4:	MOVB	ACCU, T4
+0fd6:	CMPUB	ACCU, T3
+0fd8:	BGT	$0FC7
+0fda:	MOVUB	ACCU, 7(FP)
+0fdd:	BEQ	$1003
+0fdf:	MOV	ACCU, 3(FP)
+0fe2:	CMPU	ACCU, #$0010
+0fe5:	BNE	$1003
+0fe7:	MOVB	ACCU, T3
+0fe9:	ADDB	ACCU, #$00FF
+0fec:	MOVB	ACCU, ACCU
+0fee:	LEAX	ADDR, T6 + ACCU
+0ff0:	MOV	ACCU, #88
+0ff3:	MOVB	0(ADDR), ACCU
+0ff6:	ADDB	T3, #$00FE
+0ff9:	MOVB	ACCU, T3
+0ffb:	LEAX	ADDR, T6 + ACCU
+0ffd:	MOV	ACCU, #48
+1000:	MOVB	0(ADDR), ACCU
+1003:	MOVB	ACCU, T1
+1005:	BNE	$106C
+1007:	MOVUB	ACCU, 5(FP)
+100a:	BEQ	$1019
+100c:	ADDB	T3, #$00FF
+100f:	MOVB	ACCU, T3
+1011:	LEAX	ADDR, T6 + ACCU
+1013:	MOV	ACCU, #43
+1016:	MOVB	0(ADDR), ACCU
+1019:	MOVUB	T5, 1(FP)
+101c:	SUBR	T5, #$000A
+1020:	MOVB	ACCU, T3
+1022:	MOV	T7, ACCU
+1024:	MOV	ACCU, T5
+1026:	CMPS	ACCU, T7
+1028:	BGT	$105D
+102a:	MOVB	T1, #0
+102d:	MOVB	ACCU, T3
+102f:	CMPUB	ACCU, #$000A
+1031:	BLE	$104D
+1033:	MOVB	ACCU, T3
+1035:	LEAX	ADDR, T6 + ACCU
+1037:	MOVB	T4, 0(ADDR)
+103a:	MOVB	ACCU, T1
+103c:	LEAX	ADDR, T6 + ACCU
+103e:	MOVB	0(ADDR), T4
+1041:	ADDB	T1, #$0001
+1044:	ADDB	T3, #$0001
+1047:	MOVB	ACCU, T3
+1049:	CMPUB	ACCU, #$000A
+104b:	BGT	$1033
+104d:	MOV	ADDR, T2
+104f:	MOVB	T4, 0(ADDR)
+1052:	ADD	T2, #$0001
+1056:	AND	T1, #$00FF
+105a:	JUMPF	$0B2D
+105d:	ADDB	T3, #$00FF
+1060:	MOVB	ACCU, T3
+1062:	LEAX	ADDR, T6 + ACCU
+1064:	MOVB	T1, 0(FP)
+1067:	MOVB	0(ADDR), T1
+106a:	JUMP	$1019
+106c:	ADDB	T3, #$00FF
+106f:	MOVB	ACCU, T3
+1071:	LEAX	ADDR, T6 + ACCU
+1073:	MOV	ACCU, #45
+1076:	MOVB	0(ADDR), ACCU
+1079:	JUMP	$1019
+107b:	MOVB	ACCU, T4
+107d:	SUBR	ACCU, #$000A
+1081:	MOV	T4, ACCU
+1083:	CMPUB	ACCU, T3
+1085:	BGTF	$0FC7
+1088:	JUMPF	$0FDA
+108b:	MOV	T5, 3(FP)
+108e:	MOV	ACCU, T7
+1090:	MODU	ACCU, T5
+1092:	MOV	T5, ACCU
+1094:	CMPS	ACCU, #$000A
+1097:	BLE	$109F
+1099:	ADD	T5, #$0030
+109d:	JUMP	$10A3
+109f:	ADD	T5, #$0037
+10a3:	ADDB	T3, #$00FF
+10a6:	MOVB	ACCU, T3
+10a8:	LEAX	ADDR, T6 + ACCU
+10aa:	MOVB	0(ADDR), T5
+10ad:	MOV	T5, 3(FP)
+10b0:	MOV	ACCU, T7
+10b2:	DIVU	ACCU, T5
+10b4:	MOV	T7, ACCU
+10b6:	BNE	$108B
+10b8:	JUMPF	$0FB4
+10bb:	MOVB	T1, #1
+10be:	MOVB	T3, #10
+10c1:	NEG	ACCU
+10c2:	MOV	T7, ACCU
+10c4:	BNE	$108B
+10c6:	JUMPF	$0FB4
+10c9:	MOV	T5, #0
+10cc:	MOV	ADDR, T2
+10ce:	MOVB	T3, 0(ADDR)
+10d1:	ADD	T2, #$0001
+10d5:	MOVB	ACCU, T3
+10d7:	CMPUB	ACCU, #$0030
+10d9:	BGT	$10FD
+10db:	MOVB	ACCU, T3
+10dd:	CMPUB	ACCU, #$0039
+10df:	BLT	$10FD
+10e1:	MOVB	ACCU, T3
+10e3:	MOV	T6, ACCU
+10e5:	MOV	ADDR, T2
+10e7:	MOVB	T3, 0(ADDR)
+10ea:	ADD	T2, #$0001
+10ee:	MUL	T5, #10
+10f1:	ADD	T5, ACCU
+10f3:	ADD	T5, #$FFD0
+10f7:	MOVB	ACCU, T3
+10f9:	CMPUB	ACCU, #$0030
+10fb:	BLE	$10DB
+10fd:	MOVB	2(FP), T5
+1100:	JUMPF	$0BCC
+1103:	MOV	T5, #0
+1106:	MOVB	ACCU, T3
+1108:	CMPUB	ACCU, #$0030
+110a:	BGT	$112E
+110c:	MOVB	ACCU, T3
+110e:	CMPUB	ACCU, #$0039
+1110:	BLT	$112E
+1112:	MOVB	ACCU, T3
+1114:	MOV	T6, ACCU
+1116:	MOV	ADDR, T2
+1118:	MOVB	T3, 0(ADDR)
+111b:	ADD	T2, #$0001
+111f:	MUL	T5, #10
+1122:	ADD	T5, ACCU
+1124:	ADD	T5, #$FFD0
+1128:	MOVB	ACCU, T3
+112a:	CMPUB	ACCU, #$0030
+112c:	BLE	$110C
+112e:	MOVB	1(FP), T5
+1131:	JUMPF	$0BC5
+1134:	MOV	ACCU, #1
+1137:	MOVB	7(FP), ACCU
+113a:	MOV	ADDR, T2
+113c:	MOVB	T3, 0(ADDR)
+113f:	JUMPF	$0B9F
+1142:	MOV	ACCU, #48
+1145:	MOVB	0(FP), ACCU
+1148:	MOV	ADDR, T2
+114a:	MOVB	T3, 0(ADDR)
+114d:	JUMPF	$0B9F
+1150:	MOV	ACCU, #1
+1153:	MOVB	5(FP), ACCU
+1156:	MOV	ADDR, T2
+1158:	MOVB	T3, 0(ADDR)
+115b:	JUMPF	$0B9F
+115e:	MOVUB	ACCU, 16(FP)
+1161:	BNE	$116D
+1163:	MOVB	ACCU, T1
+1165:	ADD	T0, ACCU
+1167:	MOVB	T1, #0
+116a:	JUMPF	$0B76
+116d:	MOVB	ACCU, T1
+116f:	LEAX	ADDR, T0 + ACCU
+1171:	MOV	ACCU, #0
+1174:	MOVB	0(ADDR), ACCU
+1177:	MOV	ACCU, T0
+1179:	MOV	P0, ACCU
+117b:	CALL	puts + 0
+117e:	MOVB	T1, #0
+1181:	JUMPF	$0B76
+--------------------------------------------------------------------
+puts:
+1184:	ENTER	0, 2
+1188:	JSR	$118f
+118b:	RETURN	0, 2
+--------------------------------------------------------------------
+118f : a0 00 __ LDY #$00
+1191 : b1 0d __ LDA (P0),y
+1193 : f0 0b __ BEQ $11a0
+1195 : 20 a1 11 JSR $11a1 ; (putpch + 0)
+1198 : e6 0d __ INC P0
+119a : d0 f3 __ BNE $118f
+119c : e6 0e __ INC P1
+119e : d0 ef __ BNE $118f
+11a0 : 60 __ __ RTS
+--------------------------------------------------------------------
+putpch:
+11a1 : ae 75 24 LDX $2475 ; (giocharmap + 0)
+11a4 : e0 01 __ CPX #$01
+11a6 : 90 22 __ BCC $11ca
+11a8 : c9 0a __ CMP #$0a
+11aa : d0 02 __ BNE $11ae
+11ac : a9 0d __ LDA #$0d
+11ae : e0 02 __ CPX #$02
+11b0 : 90 18 __ BCC $11ca
+11b2 : c9 41 __ CMP #$41
+11b4 : 90 14 __ BCC $11ca
+11b6 : c9 7b __ CMP #$7b
+11b8 : b0 10 __ BCS $11ca
+11ba : c9 61 __ CMP #$61
+11bc : b0 04 __ BCS $11c2
+11be : c9 5b __ CMP #$5b
+11c0 : b0 08 __ BCS $11ca
+11c2 : 49 20 __ EOR #$20
+11c4 : e0 03 __ CPX #$03
+11c6 : f0 02 __ BEQ $11ca
+11c8 : 29 df __ AND #$df
+11ca : 4c d2 ff JMP $ffd2 
+--------------------------------------------------------------------
+nforml:
+11cd:	ENTER	5, 7
+11d1:	MOVD	ACCU, P4
+11d3:	MOVD	T0, ACCU
+11d5:	MOVD	T1, ACCU
+11d7:	MOV	ACCU, P2
+11d9:	MOV	T2, ACCU
+11db:	MOVB	T3, #0
+11de:	MOVB	ACCU, P8
+11e0:	BEQ	$11EF
+11e2:	MOVD	ACCU, #$00000000
+11e8:	EXTRT	T0, inp_op_cmp_s32 + 0
+11ec:	BLTF	$1334
+11ef:	MOVB	T4, #16
+11f2:	MOVD	ACCU, #$00000000
+11f8:	EXTRT	T0, inp_op_cmp_u32 + 0
+11fc:	BGTF	$12DC
+11ff:	MOV	ADDR, P0
+1201:	MOVB	T5, 2(ADDR)
+1204:	MOVB	ACCU, T5
+1206:	CMPUB	ACCU, #$00FF
+1208:	BNEF	$12CC
+120b:	MOVB	T5, #15
+120e:	MOVB	ACCU, T4
+1210:	CMPUB	ACCU, #$000F
+1212:	BGE	$1227
+1214:	ADDB	T4, #$00FF
+1217:	MOVB	ACCU, T4
+1219:	LEAX	ADDR, T2 + ACCU
+121b:	MOV	ACCU, #48
+121e:	MOVB	0(ADDR), ACCU
+1221:	MOVB	ACCU, T5
+1223:	CMPUB	ACCU, T4
+1225:	BGT	$1214
+1227:	MOV	ACCU, P0
+1229:	MOV	T6, ACCU
+122b:	MOV	ADDR, T6
+122d:	MOVUB	ACCU, 7(ADDR)
+1230:	BEQ	$1256
+1232:	MOV	ACCU, 3(ADDR)
+1235:	CMPU	ACCU, #$0010
+1238:	BNE	$1256
+123a:	MOVB	ACCU, T4
+123c:	ADDB	ACCU, #$00FF
+123f:	MOVB	ACCU, ACCU
+1241:	LEAX	ADDR, T2 + ACCU
+1243:	MOV	ACCU, #88
+1246:	MOVB	0(ADDR), ACCU
+1249:	ADDB	T4, #$00FE
+124c:	MOVB	ACCU, T4
+124e:	LEAX	ADDR, T2 + ACCU
+1250:	MOV	ACCU, #48
+1253:	MOVB	0(ADDR), ACCU
+1256:	MOVB	ACCU, T3
+1258:	BNE	$12BD
+125a:	MOV	ADDR, T6
+125c:	MOVUB	ACCU, 5(ADDR)
+125f:	BEQ	$126E
+1261:	ADDB	T4, #$00FF
+1264:	MOVB	ACCU, T4
+1266:	LEAX	ADDR, T2 + ACCU
+1268:	MOV	ACCU, #43
+126b:	MOVB	0(ADDR), ACCU
+126e:	MOV	ACCU, P0
+1270:	MOV	T6, ACCU
+1272:	MOV	ADDR, T6
+1274:	MOVUB	T7, 1(ADDR)
+1277:	SUBR	T7, #$0010
+127b:	MOVB	ACCU, T4
+127d:	MOV	T8, ACCU
+127f:	MOV	ACCU, T7
+1281:	CMPS	ACCU, T8
+1283:	BGT	$12AE
+1285:	MOVB	T3, #0
+1288:	MOVB	ACCU, T4
+128a:	CMPUB	ACCU, #$0010
+128c:	BLE	$12A8
+128e:	MOVB	ACCU, T4
+1290:	LEAX	ADDR, T2 + ACCU
+1292:	MOVB	T5, 0(ADDR)
+1295:	MOVB	ACCU, T3
+1297:	LEAX	ADDR, T2 + ACCU
+1299:	MOVB	0(ADDR), T5
+129c:	ADDB	T3, #$0001
+129f:	ADDB	T4, #$0001
+12a2:	MOVB	ACCU, T4
+12a4:	CMPUB	ACCU, #$0010
+12a6:	BGT	$128E
+12a8:	MOVB	ACCU, T3
+12aa:	RETURN	5, 7
+12ae:	MOVB	T3, 0(ADDR)
+12b1:	ADDB	T4, #$00FF
+12b4:	MOVB	ACCU, T4
+12b6:	LEAX	ADDR, T2 + ACCU
+12b8:	MOVB	0(ADDR), T3
+12bb:	JUMP	$126E
+12bd:	ADDB	T4, #$00FF
+12c0:	MOVB	ACCU, T4
+12c2:	LEAX	ADDR, T2 + ACCU
+12c4:	MOV	ACCU, #45
+12c7:	MOVB	0(ADDR), ACCU
+12ca:	JUMP	$126E
+12cc:	MOVB	ACCU, T5
+12ce:	SUBR	ACCU, #$0010
+12d2:	MOV	T5, ACCU
+12d4:	CMPUB	ACCU, T4
+12d6:	BGTF	$1214
+12d9:	JUMPF	$1227
+12dc:	MOV	ACCU, P0
+12de:	MOV	T6, ACCU
+12e0:	MOV	ADDR, T6
+12e2:	MOV	ACCU, 3(ADDR)
+12e5:	EXTRT	$00, inp_op_ext_u16 + 0
+12e9:	MOVD	T0, ACCU
+12eb:	MOVD	ACCU, T1
+12ed:	EXTRT	T0, inp_binop_mod_u32 + 0
+12f1:	MOVD	T0, ACCU
+12f3:	CMPS	ACCU, #$000A
+12f6:	BLE	$1300
+12f8:	MOV	ACCU, T0
+12fa:	ADD	ACCU, #$0030
+12fe:	JUMP	$1306
+1300:	MOV	ACCU, T0
+1302:	ADD	ACCU, #$0037
+1306:	MOV	T7, ACCU
+1308:	ADDB	T4, #$00FF
+130b:	MOVB	ACCU, T4
+130d:	LEAX	ADDR, T2 + ACCU
+130f:	MOVB	0(ADDR), T7
+1312:	MOV	ADDR, T6
+1314:	MOV	ACCU, 3(ADDR)
+1317:	EXTRT	$00, inp_op_ext_u16 + 0
+131b:	MOVD	T0, ACCU
+131d:	MOVD	ACCU, T1
+131f:	EXTRT	T0, inp_binop_div_u32 + 0
+1323:	MOVD	T1, ACCU
+1325:	MOVD	ACCU, #$00000000
+132b:	EXTRT	T1, inp_op_cmp_u32 + 0
+132f:	BGT	$12DC
+1331:	JUMPF	$11FF
+1334:	MOVB	T3, #1
+1337:	MOVB	T4, #16
+133a:	MOVD	ACCU, T0
+133c:	EXTRT	$00, negaccu32 + 0
+1340:	MOVD	T1, ACCU
+1342:	MOVD	ACCU, #$00000000
+1348:	EXTRT	T1, inp_op_cmp_u32 + 0
+134c:	BGT	$12DC
+134e:	JUMPF	$11FF
+--------------------------------------------------------------------
+nformf:
+1351:	ENTER	10, 12
+1355:	MOV	ACCU, P2
+1357:	MOV	T0, ACCU
+1359:	MOV	T1, ACCU
+135b:	MOVD	ACCU, P4
+135d:	MOVD	T2, ACCU
+135f:	MOVD	ACCU, #$00000000
+1365:	CMPF	ACCU, T2
+1367:	BLTF	$166A
+136a:	MOVB	T3, #0
+136d:	MOV	ADDR, P0
+136f:	MOVUB	ACCU, 5(ADDR)
+1372:	BEQ	$137F
+1374:	MOV	ACCU, #43
+1377:	MOV	ADDR, T0
+1379:	MOVB	0(ADDR), ACCU
+137c:	MOVB	T3, #1
+137f:	MOV	T0, #0
+1382:	MOV	ADDR, P0
+1384:	MOVB	T5, 2(ADDR)
+1387:	MOVB	ACCU, T5
+1389:	CMPUB	ACCU, #$00FF
+138b:	BNE	$1392
+138d:	MOVB	T5, #6
+1390:	JUMP	$1396
+1392:	AND	T5, #$00FF
+1396:	MOVD	ACCU, P4
+1398:	MOVD	T2, #$00000000
+139e:	CMPF	ACCU, T2
+13a0:	BNEF	$15EE
+13a3:	MOVB	ACCU, P8
+13a5:	MOVB	T6, ACCU
+13a7:	CMPUB	ACCU, #$0065
+13a9:	SEQ
+13aa:	MOVB	T7, ACCU
+13ac:	MOVB	T8, ACCU
+13ae:	MOVB	ACCU, T5
+13b0:	MOV	T4, ACCU
+13b2:	ADD	T4, #$0001
+13b6:	MOVB	ACCU, T6
+13b8:	CMPUB	ACCU, #$0067
+13ba:	BEQF	$15DD
+13bd:	MOVB	ACCU, T7
+13bf:	BNEF	$1591
+13c2:	MOV	ACCU, T0
+13c4:	BGE	$13DC
+13c6:	MOVD	ACCU, P4
+13c8:	MOVD	$03, #$41200000
+13ce:	DIVF	ACCU, $03
+13d0:	MOVD	T2, ACCU
+13d2:	MOVD	P4, ACCU
+13d4:	ADD	T0, #$0001
+13d8:	MOV	ACCU, T0
+13da:	BLT	$13C6
+13dc:	MOVD	T2, #$3f000000
+13e2:	MOVB	ACCU, T5
+13e4:	ADD	ACCU, T0
+13e6:	MOV	T4, ACCU
+13e8:	ADD	T4, #$0001
+13ec:	MOVB	ACCU, T4
+13ee:	CMPUB	ACCU, #$0001
+13f0:	BLTF	$1576
+13f3:	MOVD	ACCU, P4
+13f5:	ADDF	ACCU, T2
+13f7:	MOVD	T2, ACCU
+13f9:	MOVD	P4, ACCU
+13fb:	MOVD	ACCU, #$41200000
+1401:	CMPF	ACCU, T2
+1403:	BLT	$1416
+1405:	MOVD	ACCU, T2
+1407:	MOVD	$03, #$41200000
+140d:	DIVF	ACCU, $03
+140f:	MOVD	T2, ACCU
+1411:	MOVD	P4, ACCU
+1413:	ADDB	T5, #$00FF
+1416:	MOVB	ACCU, T4
+1418:	MOV	T10, ACCU
+141a:	MOVB	ACCU, T5
+141c:	NEG	ACCU
+141d:	ADD	ACCU, T10
+141f:	MOV	T10, ACCU
+1421:	MOVB	T5, ACCU
+1423:	MOVB	ACCU, T4
+1425:	CMPUB	ACCU, #$0014
+1427:	BGE	$142C
+1429:	MOVB	T4, #20
+142c:	MOVB	ACCU, T10
+142e:	BNE	$143D
+1430:	MOVB	ACCU, T3
+1432:	LEAX	ADDR, T1 + ACCU
+1434:	MOV	ACCU, #48
+1437:	MOVB	0(ADDR), ACCU
+143a:	ADDB	T3, #$0001
+143d:	MOVB	T6, #0
+1440:	MOVB	ACCU, T4
+1442:	BNEF	$152F
+1445:	MOVB	ACCU, T8
+1447:	BNE	$14BE
+1449:	MOV	ADDR, P0
+144b:	MOVUB	ACCU, 1(ADDR)
+144e:	CMPUB	ACCU, T3
+1450:	BLT	$1458
+1452:	MOVB	ACCU, T3
+1454:	RETURN	10, 12
+1458:	MOVB	ACCU, T3
+145a:	CMPUB	ACCU, #$0001
+145c:	BLE	$148D
+145e:	MOVB	T5, #0
+1461:	MOVB	ACCU, T3
+1463:	MOV	T0, ACCU
+1465:	MOV	ADDR, P0
+1467:	MOVUB	ACCU, 1(ADDR)
+146a:	MOV	T4, ACCU
+146c:	SUB	ACCU, T0
+146e:	MOV	T10, ACCU
+1470:	MOVB	ACCU, T5
+1472:	MOV	T11, ACCU
+1474:	MOV	ACCU, T10
+1476:	CMPU	ACCU, T11
+1478:	BLT	$147E
+147a:	MOV	ACCU, T4
+147c:	JUMP	$1454
+147e:	MOV	ACCU, T1
+1480:	LEAX	ADDR, T11 + ACCU
+1482:	MOV	ACCU, #32
+1485:	MOVB	0(ADDR), ACCU
+1488:	ADDB	T5, #$0001
+148b:	JUMP	$1465
+148d:	MOVB	T5, #1
+1490:	MOV	ACCU, P0
+1492:	MOV	T0, ACCU
+1494:	MOVB	ACCU, T3
+1496:	MOV	T4, ACCU
+1498:	MOVB	ACCU, T5
+149a:	MOV	T10, ACCU
+149c:	MOV	ACCU, T4
+149e:	SUB	ACCU, T10
+14a0:	MOV	ADDR, T0
+14a2:	MOVB	T6, 1(ADDR)
+14a5:	LEAX	ADDR, T1 + ACCU
+14a7:	MOVB	ACCU, T6
+14a9:	MOVB	T6, 0(ADDR)
+14ac:	SUB	ACCU, T10
+14ae:	LEAX	ADDR, T1 + ACCU
+14b0:	MOVB	0(ADDR), T6
+14b3:	ADDB	T5, #$0001
+14b6:	MOVB	ACCU, T3
+14b8:	CMPUB	ACCU, T5
+14ba:	BLE	$1498
+14bc:	JUMP	$145E
+14be:	MOVB	ACCU, T3
+14c0:	LEAX	ADDR, T1 + ACCU
+14c2:	MOV	ACCU, #69
+14c5:	MOVB	0(ADDR), ACCU
+14c8:	MOVB	ACCU, T3
+14ca:	ADDB	ACCU, #$0001
+14cd:	MOVB	T5, ACCU
+14cf:	MOV	ACCU, T0
+14d1:	BLT	$14E2
+14d3:	MOVB	ACCU, T5
+14d5:	LEAX	ADDR, T1 + ACCU
+14d7:	MOV	ACCU, #43
+14da:	MOVB	0(ADDR), ACCU
+14dd:	ADDB	T3, #$0002
+14e0:	JUMP	$14F4
+14e2:	MOVB	ACCU, T5
+14e4:	LEAX	ADDR, T1 + ACCU
+14e6:	MOV	ACCU, #45
+14e9:	MOVB	0(ADDR), ACCU
+14ec:	ADDB	T3, #$0002
+14ef:	MOV	ACCU, T0
+14f1:	NEG	ACCU
+14f2:	MOV	T0, ACCU
+14f4:	MOVB	ACCU, T3
+14f6:	ADD	ACCU, T1
+14f8:	MOV	T4, ACCU
+14fa:	MOV	ACCU, T0
+14fc:	MOV	ADDR, #10
+14ff:	DIVS	ACCU, ADDR
+1501:	MOV	ADDR, T4
+1503:	MOV	T10, ACCU
+1505:	ADD	T10, #$0030
+1509:	MOVB	0(ADDR), T10
+150c:	MOVB	ACCU, T3
+150e:	ADDB	ACCU, #$0001
+1511:	MOVB	ACCU, ACCU
+1513:	ADD	ACCU, T1
+1515:	MOV	T4, ACCU
+1517:	MOV	ACCU, T0
+1519:	MOV	ADDR, #10
+151c:	MODS	ACCU, ADDR
+151e:	MOV	ADDR, T4
+1520:	MOV	T0, ACCU
+1522:	ADD	T0, #$0030
+1526:	MOVB	0(ADDR), T0
+1529:	ADDB	T3, #$0002
+152c:	JUMPF	$1449
+152f:	MOVB	ACCU, T5
+1531:	CMPUB	ACCU, T6
+1533:	BNE	$1542
+1535:	MOVB	ACCU, T3
+1537:	LEAX	ADDR, T1 + ACCU
+1539:	MOV	ACCU, #46
+153c:	MOVB	0(ADDR), ACCU
+153f:	ADDB	T3, #$0001
+1542:	MOVD	ACCU, P4
+1544:	MOVD	T2, ACCU
+1546:	CNVFS	ACCU
+1547:	MOV	T10, ACCU
+1549:	CNVSF	ACCU
+154a:	MOVD	T9, ACCU
+154c:	MOVD	ACCU, T2
+154e:	SUBF	ACCU, T9
+1550:	MOVD	$03, #$41200000
+1556:	MULF	ACCU, $03
+1558:	MOVD	T2, ACCU
+155a:	MOVD	P4, ACCU
+155c:	MOVB	ACCU, T3
+155e:	LEAX	ADDR, T1 + ACCU
+1560:	ADD	T10, #$0030
+1564:	MOVB	0(ADDR), T10
+1567:	ADDB	T3, #$0001
+156a:	ADDB	T6, #$0001
+156d:	MOVB	ACCU, T4
+156f:	CMPUB	ACCU, T6
+1571:	BLT	$152F
+1573:	JUMPF	$1445
+1576:	MOVB	T6, #1
+1579:	MOVD	ACCU, T2
+157b:	MOVD	$03, #$41200000
+1581:	DIVF	ACCU, $03
+1583:	MOVD	T2, ACCU
+1585:	ADDB	T6, #$0001
+1588:	MOVB	ACCU, T4
+158a:	CMPUB	ACCU, T6
+158c:	BLT	$1579
+158e:	JUMPF	$13F3
+1591:	MOVD	T2, #$3f000000
+1597:	MOVB	ACCU, T5
+1599:	BNE	$15C3
+159b:	MOVD	ACCU, P4
+159d:	ADDF	ACCU, T2
+159f:	MOVD	T2, ACCU
+15a1:	MOVD	P4, ACCU
+15a3:	MOVD	ACCU, #$41200000
+15a9:	CMPF	ACCU, T2
+15ab:	BLTF	$1416
+15ae:	MOVD	ACCU, T2
+15b0:	MOVD	$03, #$41200000
+15b6:	DIVF	ACCU, $03
+15b8:	MOVD	T2, ACCU
+15ba:	MOVD	P4, ACCU
+15bc:	ADD	T0, #$0001
+15c0:	JUMPF	$1416
+15c3:	MOVB	T6, #0
+15c6:	MOVD	ACCU, T2
+15c8:	MOVD	$03, #$41200000
+15ce:	DIVF	ACCU, $03
+15d0:	MOVD	T2, ACCU
+15d2:	ADDB	T6, #$0001
+15d5:	MOVB	ACCU, T5
+15d7:	CMPUB	ACCU, T6
+15d9:	BLT	$15C6
+15db:	JUMP	$159B
+15dd:	MOV	ACCU, T0
+15df:	CMPS	ACCU, #$0003
+15e2:	BLT	$15E9
+15e4:	MOV	ACCU, T0
+15e6:	BGEF	$13BD
+15e9:	MOVB	T8, #1
+15ec:	JUMP	$1591
+15ee:	MOVD	ACCU, P4
+15f0:	MOVD	T2, #$447a0000
+15f6:	CMPF	ACCU, T2
+15f8:	BGT	$1616
+15fa:	MOVD	ACCU, P4
+15fc:	MOVD	$03, #$447a0000
+1602:	DIVF	ACCU, $03
+1604:	MOVD	T2, ACCU
+1606:	MOVD	P4, ACCU
+1608:	ADD	T0, #$0003
+160c:	MOVD	ACCU, #$447a0000
+1612:	CMPF	ACCU, T2
+1614:	BGE	$15FA
+1616:	MOVD	ACCU, P4
+1618:	MOVD	T2, #$3f800000
+161e:	CMPF	ACCU, T2
+1620:	BLE	$163E
+1622:	MOVD	ACCU, P4
+1624:	MOVD	$03, #$447a0000
+162a:	MULF	ACCU, $03
+162c:	MOVD	T2, ACCU
+162e:	MOVD	P4, ACCU
+1630:	ADD	T0, #$FFFD
+1634:	MOVD	ACCU, #$3f800000
+163a:	CMPF	ACCU, T2
+163c:	BLT	$1622
+163e:	MOVD	ACCU, P4
+1640:	MOVD	T2, #$41200000
+1646:	CMPF	ACCU, T2
+1648:	BGTF	$13A3
+164b:	MOVD	ACCU, P4
+164d:	MOVD	$03, #$41200000
+1653:	DIVF	ACCU, $03
+1655:	MOVD	T2, ACCU
+1657:	MOVD	P4, ACCU
+1659:	ADD	T0, #$0001
+165d:	MOVD	ACCU, #$41200000
+1663:	CMPF	ACCU, T2
+1665:	BGE	$164B
+1667:	JUMPF	$13A3
+166a:	MOV	ADDR, T0
+166c:	MOVD	ACCU, T2
+166e:	NEGF	ACCU
+166f:	MOVD	T2, ACCU
+1671:	MOVD	P4, ACCU
+1673:	MOV	ACCU, #45
+1676:	MOVB	0(ADDR), ACCU
+1679:	MOVB	T3, #1
+167c:	JUMPF	$137F
+--------------------------------------------------------------------
+shuffle:
+1684:	ENTER	0, 14
+1688:	PUSH	#$0002
+168b:	MOV	ACCU, 16(FP)
+168e:	CMPS	ACCU, #$0000
+1691:	BLT	$169A
+1693:	POP	#$0002
+1696:	RETURN	0, 14
+169a:	MOV	T0, 14(FP)
+169d:	MOV	ACCU, T0
+169f:	MOV	T2, ACCU
+16a1:	MOV	T3, 16(FP)
+16a4:	MOV	ACCU, T3
+16a6:	MUL	ACCU, #12
+16a9:	ADD	ACCU, T0
+16ab:	MOV	T4, ACCU
+16ad:	LEA	T5, 0(FP)
+16b1:	CALL	rand + 0
+16b4:	MOV	T6, ACCU
+16b6:	MOV	ADDR, T5
+16b8:	MOV	ACCU, T2
+16ba:	COPY	#12
+16bc:	MOV	ACCU, T6
+16be:	MODU	ACCU, T3
+16c0:	MUL	ACCU, #12
+16c3:	ADD	ACCU, T0
+16c5:	MOV	T6, ACCU
+16c7:	MOV	ADDR, T2
+16c9:	COPY	#12
+16cb:	MOV	ADDR, T6
+16cd:	MOV	ACCU, T5
+16cf:	COPY	#12
+16d1:	ADD	T2, #$000C
+16d5:	MOV	ACCU, T4
+16d7:	CMPU	ACCU, T2
+16d9:	BLT	$16B1
+16db:	JUMP	$1693
+--------------------------------------------------------------------
+rand:
+16dd:	ENTER	0, 2
+16e1:	MOV	T0, seed + 0
+16e5:	MOV	ACCU, T0
+16e7:	SHL	ACCU, #7
+16e9:	XOR	ACCU, T0
+16eb:	MOV	T0, ACCU
+16ed:	SHRU	ACCU, #9
+16ef:	XOR	ACCU, T0
+16f1:	MOV	T0, ACCU
+16f3:	SHL	ACCU, #8
+16f5:	XOR	ACCU, T0
+16f7:	MOV	T0, ACCU
+16f9:	MOV	seed + 0, T0
+16fd:	RETURN	0, 2
+--------------------------------------------------------------------
+qsort:
+1701:	ENTER	4, 20
+1705:	PUSH	#$0006
+1708:	MOV	T0, 18(FP)
+170b:	MOV	ACCU, T0
+170d:	CMPS	ACCU, #$0001
+1710:	BLT	$1719
+1712:	POP	#$0006
+1715:	RETURN	4, 20
+1719:	LEA	ADDR, 0(FP)
+171d:	MOV	ACCU, 16(FP)
+1720:	COPY	#12
+1722:	MOV	T2, #0
+1725:	MOV	ACCU, T0
+1727:	CMPS	ACCU, #$0001
+172a:	BLT	$1767
+172c:	MOV	T0, 16(FP)
+172f:	MOV	ACCU, T2
+1731:	MUL	ACCU, #12
+1734:	LEAX	ADDR, T0 + ACCU
+1736:	LEA	ACCU, 0(FP)
+173a:	COPY	#12
+173c:	MOV	2(SP), T0
+173f:	MOV	4(SP), T2
+1742:	CALL	qsort + 0
+1745:	MOV	T0, 16(FP)
+1748:	MOV	ACCU, T2
+174a:	MUL	ACCU, #12
+174d:	ADD	ACCU, T0
+174f:	ADD	ACCU, #$000C
+1753:	MOV	2(SP), ACCU
+1756:	MOV	ACCU, 18(FP)
+1759:	SUB	ACCU, T2
+175b:	ADD	ACCU, #$FFFF
+175f:	MOV	4(SP), ACCU
+1762:	CALL	qsort + 0
+1765:	JUMP	$1712
+1767:	MOV	T0, #1
+176a:	MOV	T3, 16(FP)
+176d:	MOV	ACCU, T0
+176f:	MUL	ACCU, #12
+1772:	ADD	ACCU, T3
+1774:	ADD	ACCU, #$0002
+1778:	MOV	P0, ACCU
+177a:	LEA	P2, 2(FP)
+177e:	JSR	strcmp + 0
+1781:	BGE	$17AA
+1783:	MOV	T3, 16(FP)
+1786:	MOV	ACCU, T2
+1788:	MUL	ACCU, #12
+178b:	ADD	ACCU, T3
+178d:	MOV	T4, ACCU
+178f:	MOV	ACCU, T0
+1791:	MUL	ACCU, #12
+1794:	ADD	ACCU, T3
+1796:	MOV	T3, ACCU
+1798:	MOV	ADDR, T4
+179a:	COPY	#12
+179c:	MOV	ADDR, T3
+179e:	ADD	T4, #$000C
+17a2:	MOV	ACCU, T4
+17a4:	COPY	#12
+17a6:	ADD	T2, #$0001
+17aa:	MOV	T3, 18(FP)
+17ad:	ADD	T0, #$0001
+17b1:	MOV	ACCU, T3
+17b3:	CMPS	ACCU, T0
+17b5:	BLT	$176A
+17b7:	JUMPF	$172C
+--------------------------------------------------------------------
+strcmp:
+17ba : ea __ __ NOP
+17bb : a0 00 __ LDY #$00
+17bd : 84 1c __ STY ACCU + 1
+17bf : b1 0d __ LDA (P0),y
+17c1 : f0 16 __ BEQ $17d9
+17c3 : d1 0f __ CMP (P2),y
+17c5 : d0 16 __ BNE $17dd
+17c7 : c8 __ __ INY
+17c8 : b1 0d __ LDA (P0),y
+17ca : f0 0d __ BEQ $17d9
+17cc : d1 0f __ CMP (P2),y
+17ce : d0 0d __ BNE $17dd
+17d0 : c8 __ __ INY
+17d1 : d0 ec __ BNE $17bf
+17d3 : e6 0e __ INC P1
+17d5 : e6 10 __ INC P3
+17d7 : d0 e6 __ BNE $17bf
+17d9 : d1 0f __ CMP (P2),y
+17db : f0 0a __ BEQ $17e7
+17dd : b0 06 __ BCS $17e5
+17df : a9 ff __ LDA #$ff
+17e1 : 85 1c __ STA ACCU + 1
+17e3 : 30 02 __ BMI $17e7
+17e5 : a9 01 __ LDA #$01
+17e7 : 85 1b __ STA ACCU + 0
+17e9 : 60 __ __ RTS
+--------------------------------------------------------------------
+check:
+17ea:	ENTER	0, 2
+17ee:	PUSH	#$0003
+17f1:	MOV	ACCU, 4(FP)
+17f4:	CMPS	ACCU, #$0000
+17f7:	BLT	$1800
+17f9:	POP	#$0003
+17fc:	RETURN	0, 2
+1800:	MOV	T0, #0
+1803:	MOV	T2, 2(FP)
+1806:	MOV	T3, 4(FP)
+1809:	MOV	ADDR, T2
+180b:	MOV	T4, 0(ADDR)
+180e:	MOV	ACCU, T0
+1810:	CMPU	ACCU, T4
+1812:	SEQ
+1813:	MOVB	2(SP), ACCU
+1816:	CALL	assert + 0
+1819:	ADD	T2, #$000C
+181d:	ADD	T0, #$0001
+1821:	MOV	ACCU, T3
+1823:	CMPS	ACCU, T0
+1825:	BLT	$1809
+1827:	JUMP	$17F9
+--------------------------------------------------------------------
+assert:
+1829:	ENTER	0, 2
+182d:	PUSH	#$0002
+1830:	MOVUB	ACCU, 2(FP)
+1833:	BNE	$183B
+1835:	MOV	P0, #-1
+1838:	CALL	exit + 0
+183b:	POP	#$0002
+183e:	RETURN	0, 2
+--------------------------------------------------------------------
+exit:
+1842:	ENTER	0, 2
+1846:	JSR	$184d
+1849:	RETURN	0, 2
+--------------------------------------------------------------------
+184d : a5 0d __ LDA P0
+184f : 85 1b __ STA ACCU + 0
+1851 : a5 0e __ LDA P1
+1853 : 85 1c __ STA ACCU + 1
+1855 : ae 74 24 LDX $2474 ; (spentry + 0)
+1858 : 9a __ __ TXS
+1859 : a9 4c __ LDA #$4c
+185b : 85 54 __ STA $54
+185d : a9 00 __ LDA #$00
+185f : 85 13 __ STA P6
+1861 : 60 __ __ RTS
+--------------------------------------------------------------------
+freg:
+1862 : b1 19 __ LDA (IP + 0),y
+1864 : c8 __ __ INY
+1865 : aa __ __ TAX
+1866 : b5 00 __ LDA $00,x
+1868 : 85 03 __ STA $03
+186a : b5 01 __ LDA $01,x
+186c : 85 04 __ STA $04
+186e : b5 02 __ LDA $02,x
+1870 : 85 05 __ STA $05
+1872 : b5 03 __ LDA $03,x
+1874 : 85 06 __ STA $06
+1876 : a5 05 __ LDA $05
+1878 : 0a __ __ ASL
+1879 : a5 06 __ LDA $06
+187b : 2a __ __ ROL
+187c : 85 08 __ STA $08
+187e : f0 06 __ BEQ $1886
+1880 : a5 05 __ LDA $05
+1882 : 09 80 __ ORA #$80
+1884 : 85 05 __ STA $05
+1886 : a5 1d __ LDA ACCU + 2
+1888 : 0a __ __ ASL
+1889 : a5 1e __ LDA ACCU + 3
+188b : 2a __ __ ROL
+188c : 85 07 __ STA $07
+188e : f0 06 __ BEQ $1896
+1890 : a5 1d __ LDA ACCU + 2
+1892 : 09 80 __ ORA #$80
+1894 : 85 1d __ STA ACCU + 2
+1896 : 60 __ __ RTS
+1897 : 06 1e __ ASL ACCU + 3
+1899 : a5 07 __ LDA $07
+189b : 6a __ __ ROR
+189c : 85 1e __ STA ACCU + 3
+189e : b0 06 __ BCS $18a6
+18a0 : a5 1d __ LDA ACCU + 2
+18a2 : 29 7f __ AND #$7f
+18a4 : 85 1d __ STA ACCU + 2
+18a6 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub:
+18a7 : 38 __ __ SEC
+18a8 : a5 07 __ LDA $07
+18aa : e5 08 __ SBC $08
+18ac : f0 38 __ BEQ $18e6
+18ae : aa __ __ TAX
+18af : b0 25 __ BCS $18d6
+18b1 : e0 e9 __ CPX #$e9
+18b3 : b0 0e __ BCS $18c3
+18b5 : a5 08 __ LDA $08
+18b7 : 85 07 __ STA $07
+18b9 : a9 00 __ LDA #$00
+18bb : 85 1b __ STA ACCU + 0
+18bd : 85 1c __ STA ACCU + 1
+18bf : 85 1d __ STA ACCU + 2
+18c1 : f0 23 __ BEQ $18e6
+18c3 : a5 1d __ LDA ACCU + 2
+18c5 : 4a __ __ LSR
+18c6 : 66 1c __ ROR ACCU + 1
+18c8 : 66 1b __ ROR ACCU + 0
+18ca : e8 __ __ INX
+18cb : d0 f8 __ BNE $18c5
+18cd : 85 1d __ STA ACCU + 2
+18cf : a5 08 __ LDA $08
+18d1 : 85 07 __ STA $07
+18d3 : 4c e6 18 JMP $18e6 ; (faddsub + 63)
+18d6 : e0 18 __ CPX #$18
+18d8 : b0 33 __ BCS $190d
+18da : a5 05 __ LDA $05
+18dc : 4a __ __ LSR
+18dd : 66 04 __ ROR $04
+18df : 66 03 __ ROR $03
+18e1 : ca __ __ DEX
+18e2 : d0 f8 __ BNE $18dc
+18e4 : 85 05 __ STA $05
+18e6 : a5 1e __ LDA ACCU + 3
+18e8 : 29 80 __ AND #$80
+18ea : 85 1e __ STA ACCU + 3
+18ec : 45 06 __ EOR $06
+18ee : 30 2d __ BMI $191d
+18f0 : 18 __ __ CLC
+18f1 : a5 1b __ LDA ACCU + 0
+18f3 : 65 03 __ ADC $03
+18f5 : 85 1b __ STA ACCU + 0
+18f7 : a5 1c __ LDA ACCU + 1
+18f9 : 65 04 __ ADC $04
+18fb : 85 1c __ STA ACCU + 1
+18fd : a5 1d __ LDA ACCU + 2
+18ff : 65 05 __ ADC $05
+1901 : 85 1d __ STA ACCU + 2
+1903 : 90 08 __ BCC $190d
+1905 : 66 1d __ ROR ACCU + 2
+1907 : 66 1c __ ROR ACCU + 1
+1909 : 66 1b __ ROR ACCU + 0
+190b : e6 07 __ INC $07
+190d : a5 07 __ LDA $07
+190f : 4a __ __ LSR
+1910 : 05 1e __ ORA ACCU + 3
+1912 : 85 1e __ STA ACCU + 3
+1914 : b0 06 __ BCS $191c
+1916 : a5 1d __ LDA ACCU + 2
+1918 : 29 7f __ AND #$7f
+191a : 85 1d __ STA ACCU + 2
+191c : 60 __ __ RTS
+191d : 38 __ __ SEC
+191e : a5 1b __ LDA ACCU + 0
+1920 : e5 03 __ SBC $03
+1922 : 85 1b __ STA ACCU + 0
+1924 : a5 1c __ LDA ACCU + 1
+1926 : e5 04 __ SBC $04
+1928 : 85 1c __ STA ACCU + 1
+192a : a5 1d __ LDA ACCU + 2
+192c : e5 05 __ SBC $05
+192e : 85 1d __ STA ACCU + 2
+1930 : b0 19 __ BCS $194b
+1932 : 38 __ __ SEC
+1933 : a9 00 __ LDA #$00
+1935 : e5 1b __ SBC ACCU + 0
+1937 : 85 1b __ STA ACCU + 0
+1939 : a9 00 __ LDA #$00
+193b : e5 1c __ SBC ACCU + 1
+193d : 85 1c __ STA ACCU + 1
+193f : a9 00 __ LDA #$00
+1941 : e5 1d __ SBC ACCU + 2
+1943 : 85 1d __ STA ACCU + 2
+1945 : a5 1e __ LDA ACCU + 3
+1947 : 49 80 __ EOR #$80
+1949 : 85 1e __ STA ACCU + 3
+194b : a5 1d __ LDA ACCU + 2
+194d : 30 be __ BMI $190d
+194f : 05 1c __ ORA ACCU + 1
+1951 : 05 1b __ ORA ACCU + 0
+1953 : f0 0f __ BEQ $1964
+1955 : c6 07 __ DEC $07
+1957 : f0 0b __ BEQ $1964
+1959 : 06 1b __ ASL ACCU + 0
+195b : 26 1c __ ROL ACCU + 1
+195d : 26 1d __ ROL ACCU + 2
+195f : 10 f4 __ BPL $1955
+1961 : 4c 0d 19 JMP $190d ; (faddsub + 102)
+1964 : a9 00 __ LDA #$00
+1966 : 85 1b __ STA ACCU + 0
+1968 : 85 1c __ STA ACCU + 1
+196a : 85 1d __ STA ACCU + 2
+196c : 85 1e __ STA ACCU + 3
+196e : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul:
+196f : a5 1b __ LDA ACCU + 0
+1971 : 05 1c __ ORA ACCU + 1
+1973 : 05 1d __ ORA ACCU + 2
+1975 : d0 03 __ BNE $197a
+1977 : 85 1e __ STA ACCU + 3
+1979 : 60 __ __ RTS
+197a : a5 03 __ LDA $03
+197c : 05 04 __ ORA $04
+197e : 05 05 __ ORA $05
+1980 : d0 09 __ BNE $198b
+1982 : 85 1b __ STA ACCU + 0
+1984 : 85 1c __ STA ACCU + 1
+1986 : 85 1d __ STA ACCU + 2
+1988 : 85 1e __ STA ACCU + 3
+198a : 60 __ __ RTS
+198b : a9 00 __ LDA #$00
+198d : 85 09 __ STA $09
+198f : 85 0a __ STA $0a
+1991 : 85 0b __ STA $0b
+1993 : a4 1b __ LDY ACCU + 0
+1995 : a5 03 __ LDA $03
+1997 : d0 06 __ BNE $199f
+1999 : a5 04 __ LDA $04
+199b : f0 0a __ BEQ $19a7
+199d : d0 05 __ BNE $19a4
+199f : 20 df 19 JSR $19df ; (fmul8 + 0)
+19a2 : a5 04 __ LDA $04
+19a4 : 20 df 19 JSR $19df ; (fmul8 + 0)
+19a7 : a5 05 __ LDA $05
+19a9 : 20 df 19 JSR $19df ; (fmul8 + 0)
+19ac : 38 __ __ SEC
+19ad : a5 0b __ LDA $0b
+19af : 30 06 __ BMI $19b7
+19b1 : 06 09 __ ASL $09
+19b3 : 26 0a __ ROL $0a
+19b5 : 2a __ __ ROL
+19b6 : 18 __ __ CLC
+19b7 : 29 7f __ AND #$7f
+19b9 : 85 0b __ STA $0b
+19bb : a5 1e __ LDA ACCU + 3
+19bd : 45 06 __ EOR $06
+19bf : 29 80 __ AND #$80
+19c1 : 85 1e __ STA ACCU + 3
+19c3 : a5 07 __ LDA $07
+19c5 : e9 7e __ SBC #$7e
+19c7 : 18 __ __ CLC
+19c8 : 65 08 __ ADC $08
+19ca : 4a __ __ LSR
+19cb : 05 1e __ ORA ACCU + 3
+19cd : 85 1e __ STA ACCU + 3
+19cf : a9 00 __ LDA #$00
+19d1 : 6a __ __ ROR
+19d2 : 05 0b __ ORA $0b
+19d4 : 85 1d __ STA ACCU + 2
+19d6 : a5 0a __ LDA $0a
+19d8 : 85 1c __ STA ACCU + 1
+19da : a5 09 __ LDA $09
+19dc : 85 1b __ STA ACCU + 0
+19de : 60 __ __ RTS
+--------------------------------------------------------------------
+fmul8:
+19df : 38 __ __ SEC
+19e0 : 6a __ __ ROR
+19e1 : 90 1e __ BCC $1a01
+19e3 : aa __ __ TAX
+19e4 : 18 __ __ CLC
+19e5 : 98 __ __ TYA
+19e6 : 65 09 __ ADC $09
+19e8 : 85 09 __ STA $09
+19ea : a5 0a __ LDA $0a
+19ec : 65 1c __ ADC ACCU + 1
+19ee : 85 0a __ STA $0a
+19f0 : a5 0b __ LDA $0b
+19f2 : 65 1d __ ADC ACCU + 2
+19f4 : 6a __ __ ROR
+19f5 : 85 0b __ STA $0b
+19f7 : 8a __ __ TXA
+19f8 : 66 0a __ ROR $0a
+19fa : 66 09 __ ROR $09
+19fc : 4a __ __ LSR
+19fd : f0 0d __ BEQ $1a0c
+19ff : b0 e2 __ BCS $19e3
+1a01 : 66 0b __ ROR $0b
+1a03 : 66 0a __ ROR $0a
+1a05 : 66 09 __ ROR $09
+1a07 : 4a __ __ LSR
+1a08 : 90 f7 __ BCC $1a01
+1a0a : d0 d7 __ BNE $19e3
+1a0c : 60 __ __ RTS
+--------------------------------------------------------------------
+fdiv:
+1a0d : a5 1b __ LDA ACCU + 0
+1a0f : 05 1c __ ORA ACCU + 1
+1a11 : 05 1d __ ORA ACCU + 2
+1a13 : d0 03 __ BNE $1a18
+1a15 : 85 1e __ STA ACCU + 3
+1a17 : 60 __ __ RTS
+1a18 : a5 1e __ LDA ACCU + 3
+1a1a : 45 06 __ EOR $06
+1a1c : 29 80 __ AND #$80
+1a1e : 85 1e __ STA ACCU + 3
+1a20 : a9 00 __ LDA #$00
+1a22 : 85 09 __ STA $09
+1a24 : 85 0a __ STA $0a
+1a26 : 85 0b __ STA $0b
+1a28 : a2 18 __ LDX #$18
+1a2a : a5 1b __ LDA ACCU + 0
+1a2c : c5 03 __ CMP $03
+1a2e : a5 1c __ LDA ACCU + 1
+1a30 : e5 04 __ SBC $04
+1a32 : a5 1d __ LDA ACCU + 2
+1a34 : e5 05 __ SBC $05
+1a36 : 90 13 __ BCC $1a4b
+1a38 : a5 1b __ LDA ACCU + 0
+1a3a : e5 03 __ SBC $03
+1a3c : 85 1b __ STA ACCU + 0
+1a3e : a5 1c __ LDA ACCU + 1
+1a40 : e5 04 __ SBC $04
+1a42 : 85 1c __ STA ACCU + 1
+1a44 : a5 1d __ LDA ACCU + 2
+1a46 : e5 05 __ SBC $05
+1a48 : 85 1d __ STA ACCU + 2
+1a4a : 38 __ __ SEC
+1a4b : 26 09 __ ROL $09
+1a4d : 26 0a __ ROL $0a
+1a4f : 26 0b __ ROL $0b
+1a51 : ca __ __ DEX
+1a52 : f0 0a __ BEQ $1a5e
+1a54 : 06 1b __ ASL ACCU + 0
+1a56 : 26 1c __ ROL ACCU + 1
+1a58 : 26 1d __ ROL ACCU + 2
+1a5a : b0 dc __ BCS $1a38
+1a5c : 90 cc __ BCC $1a2a
+1a5e : 38 __ __ SEC
+1a5f : a5 0b __ LDA $0b
+1a61 : 30 06 __ BMI $1a69
+1a63 : 06 09 __ ASL $09
+1a65 : 26 0a __ ROL $0a
+1a67 : 2a __ __ ROL
+1a68 : 18 __ __ CLC
+1a69 : 29 7f __ AND #$7f
+1a6b : 85 0b __ STA $0b
+1a6d : a5 08 __ LDA $08
+1a6f : 49 7f __ EOR #$7f
+1a71 : 65 07 __ ADC $07
+1a73 : 38 __ __ SEC
+1a74 : e9 01 __ SBC #$01
+1a76 : 4a __ __ LSR
+1a77 : 05 1e __ ORA ACCU + 3
+1a79 : 85 1e __ STA ACCU + 3
+1a7b : a9 00 __ LDA #$00
+1a7d : 6a __ __ ROR
+1a7e : 05 0b __ ORA $0b
+1a80 : 85 1d __ STA ACCU + 2
+1a82 : a5 0a __ LDA $0a
+1a84 : 85 1c __ STA ACCU + 1
+1a86 : a5 09 __ LDA $09
+1a88 : 85 1b __ STA ACCU + 0
+1a8a : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu:
+1a8b : 38 __ __ SEC
+1a8c : a9 00 __ LDA #$00
+1a8e : e5 1b __ SBC ACCU + 0
+1a90 : 85 1b __ STA ACCU + 0
+1a92 : a9 00 __ LDA #$00
+1a94 : e5 1c __ SBC ACCU + 1
+1a96 : 85 1c __ STA ACCU + 1
+1a98 : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp:
+1a99 : 38 __ __ SEC
+1a9a : a9 00 __ LDA #$00
+1a9c : e5 03 __ SBC $03
+1a9e : 85 03 __ STA $03
+1aa0 : a9 00 __ LDA #$00
+1aa2 : e5 04 __ SBC $04
+1aa4 : 85 04 __ STA $04
+1aa6 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod:
+1aa7 : a5 1c __ LDA ACCU + 1
+1aa9 : d0 31 __ BNE $1adc
+1aab : a5 04 __ LDA $04
+1aad : d0 1e __ BNE $1acd
+1aaf : 85 06 __ STA $06
+1ab1 : a2 04 __ LDX #$04
+1ab3 : 06 1b __ ASL ACCU + 0
+1ab5 : 2a __ __ ROL
+1ab6 : c5 03 __ CMP $03
+1ab8 : 90 02 __ BCC $1abc
+1aba : e5 03 __ SBC $03
+1abc : 26 1b __ ROL ACCU + 0
+1abe : 2a __ __ ROL
+1abf : c5 03 __ CMP $03
+1ac1 : 90 02 __ BCC $1ac5
+1ac3 : e5 03 __ SBC $03
+1ac5 : 26 1b __ ROL ACCU + 0
+1ac7 : ca __ __ DEX
+1ac8 : d0 eb __ BNE $1ab5
+1aca : 85 05 __ STA $05
+1acc : 60 __ __ RTS
+1acd : a5 1b __ LDA ACCU + 0
+1acf : 85 05 __ STA $05
+1ad1 : a5 1c __ LDA ACCU + 1
+1ad3 : 85 06 __ STA $06
+1ad5 : a9 00 __ LDA #$00
+1ad7 : 85 1b __ STA ACCU + 0
+1ad9 : 85 1c __ STA ACCU + 1
+1adb : 60 __ __ RTS
+1adc : a5 04 __ LDA $04
+1ade : d0 1f __ BNE $1aff
+1ae0 : a5 03 __ LDA $03
+1ae2 : 30 1b __ BMI $1aff
+1ae4 : a9 00 __ LDA #$00
+1ae6 : 85 06 __ STA $06
+1ae8 : a2 10 __ LDX #$10
+1aea : 06 1b __ ASL ACCU + 0
+1aec : 26 1c __ ROL ACCU + 1
+1aee : 2a __ __ ROL
+1aef : c5 03 __ CMP $03
+1af1 : 90 02 __ BCC $1af5
+1af3 : e5 03 __ SBC $03
+1af5 : 26 1b __ ROL ACCU + 0
+1af7 : 26 1c __ ROL ACCU + 1
+1af9 : ca __ __ DEX
+1afa : d0 f2 __ BNE $1aee
+1afc : 85 05 __ STA $05
+1afe : 60 __ __ RTS
+1aff : a9 00 __ LDA #$00
+1b01 : 85 05 __ STA $05
+1b03 : 85 06 __ STA $06
+1b05 : 84 02 __ STY $02
+1b07 : a0 10 __ LDY #$10
+1b09 : 18 __ __ CLC
+1b0a : 26 1b __ ROL ACCU + 0
+1b0c : 26 1c __ ROL ACCU + 1
+1b0e : 26 05 __ ROL $05
+1b10 : 26 06 __ ROL $06
+1b12 : 38 __ __ SEC
+1b13 : a5 05 __ LDA $05
+1b15 : e5 03 __ SBC $03
+1b17 : aa __ __ TAX
+1b18 : a5 06 __ LDA $06
+1b1a : e5 04 __ SBC $04
+1b1c : 90 04 __ BCC $1b22
+1b1e : 86 05 __ STX $05
+1b20 : 85 06 __ STA $06
+1b22 : 88 __ __ DEY
+1b23 : d0 e5 __ BNE $1b0a
+1b25 : 26 1b __ ROL ACCU + 0
+1b27 : 26 1c __ ROL ACCU + 1
+1b29 : a4 02 __ LDY $02
+1b2b : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16:
+1b2c : 20 86 18 JSR $1886 ; (freg + 36)
+1b2f : a5 07 __ LDA $07
+1b31 : c9 7f __ CMP #$7f
+1b33 : b0 07 __ BCS $1b3c
+1b35 : a9 00 __ LDA #$00
+1b37 : 85 1b __ STA ACCU + 0
+1b39 : 85 1c __ STA ACCU + 1
+1b3b : 60 __ __ RTS
+1b3c : 38 __ __ SEC
+1b3d : e9 8e __ SBC #$8e
+1b3f : 90 0a __ BCC $1b4b
+1b41 : a9 ff __ LDA #$ff
+1b43 : 85 1b __ STA ACCU + 0
+1b45 : a9 7f __ LDA #$7f
+1b47 : 85 1c __ STA ACCU + 1
+1b49 : d0 08 __ BNE $1b53
+1b4b : aa __ __ TAX
+1b4c : 46 1d __ LSR ACCU + 2
+1b4e : 66 1c __ ROR ACCU + 1
+1b50 : e8 __ __ INX
+1b51 : d0 f9 __ BNE $1b4c
+1b53 : 24 1e __ BIT ACCU + 3
+1b55 : 10 0e __ BPL $1b65
+1b57 : 38 __ __ SEC
+1b58 : a9 00 __ LDA #$00
+1b5a : e5 1c __ SBC ACCU + 1
+1b5c : 85 1b __ STA ACCU + 0
+1b5e : a9 00 __ LDA #$00
+1b60 : e5 1d __ SBC ACCU + 2
+1b62 : 85 1c __ STA ACCU + 1
+1b64 : 60 __ __ RTS
+1b65 : a5 1c __ LDA ACCU + 1
+1b67 : 85 1b __ STA ACCU + 0
+1b69 : a5 1d __ LDA ACCU + 2
+1b6b : 85 1c __ STA ACCU + 1
+1b6d : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float:
+1b6e : 24 1c __ BIT ACCU + 1
+1b70 : 30 03 __ BMI $1b75
+1b72 : 4c 8c 1b JMP $1b8c ; (uint16_to_float + 0)
+1b75 : 38 __ __ SEC
+1b76 : a9 00 __ LDA #$00
+1b78 : e5 1b __ SBC ACCU + 0
+1b7a : 85 1b __ STA ACCU + 0
+1b7c : a9 00 __ LDA #$00
+1b7e : e5 1c __ SBC ACCU + 1
+1b80 : 85 1c __ STA ACCU + 1
+1b82 : 20 8c 1b JSR $1b8c ; (uint16_to_float + 0)
+1b85 : a5 1e __ LDA ACCU + 3
+1b87 : 09 80 __ ORA #$80
+1b89 : 85 1e __ STA ACCU + 3
+1b8b : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float:
+1b8c : a5 1b __ LDA ACCU + 0
+1b8e : 05 1c __ ORA ACCU + 1
+1b90 : d0 05 __ BNE $1b97
+1b92 : 85 1d __ STA ACCU + 2
+1b94 : 85 1e __ STA ACCU + 3
+1b96 : 60 __ __ RTS
+1b97 : a2 8e __ LDX #$8e
+1b99 : a5 1c __ LDA ACCU + 1
+1b9b : 30 06 __ BMI $1ba3
+1b9d : ca __ __ DEX
+1b9e : 06 1b __ ASL ACCU + 0
+1ba0 : 2a __ __ ROL
+1ba1 : 10 fa __ BPL $1b9d
+1ba3 : 29 7f __ AND #$7f
+1ba5 : 85 1d __ STA ACCU + 2
+1ba7 : a5 1b __ LDA ACCU + 0
+1ba9 : 85 1c __ STA ACCU + 1
+1bab : 8a __ __ TXA
+1bac : 4a __ __ LSR
+1bad : 85 1e __ STA ACCU + 3
+1baf : a9 00 __ LDA #$00
+1bb1 : 85 1b __ STA ACCU + 0
+1bb3 : 6a __ __ ROR
+1bb4 : 05 1d __ ORA ACCU + 2
+1bb6 : 85 1d __ STA ACCU + 2
+1bb8 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32:
+1bb9 : 38 __ __ SEC
+1bba : a9 00 __ LDA #$00
+1bbc : e5 1b __ SBC ACCU + 0
+1bbe : 85 1b __ STA ACCU + 0
+1bc0 : a9 00 __ LDA #$00
+1bc2 : e5 1c __ SBC ACCU + 1
+1bc4 : 85 1c __ STA ACCU + 1
+1bc6 : a9 00 __ LDA #$00
+1bc8 : e5 1d __ SBC ACCU + 2
+1bca : 85 1d __ STA ACCU + 2
+1bcc : a9 00 __ LDA #$00
+1bce : e5 1e __ SBC ACCU + 3
+1bd0 : 85 1e __ STA ACCU + 3
+1bd2 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32:
+1bd3 : 84 02 __ STY $02
+1bd5 : a9 00 __ LDA #$00
+1bd7 : 85 07 __ STA $07
+1bd9 : 85 08 __ STA $08
+1bdb : 85 09 __ STA $09
+1bdd : 85 0a __ STA $0a
+1bdf : a0 20 __ LDY #$20
+1be1 : 18 __ __ CLC
+1be2 : 26 1b __ ROL ACCU + 0
+1be4 : 26 1c __ ROL ACCU + 1
+1be6 : 26 1d __ ROL ACCU + 2
+1be8 : 26 1e __ ROL ACCU + 3
+1bea : 26 07 __ ROL $07
+1bec : 26 08 __ ROL $08
+1bee : 26 09 __ ROL $09
+1bf0 : 26 0a __ ROL $0a
+1bf2 : a5 07 __ LDA $07
+1bf4 : c5 03 __ CMP $03
+1bf6 : a5 08 __ LDA $08
+1bf8 : e5 04 __ SBC $04
+1bfa : a5 09 __ LDA $09
+1bfc : e5 05 __ SBC $05
+1bfe : a5 0a __ LDA $0a
+1c00 : e5 06 __ SBC $06
+1c02 : 90 18 __ BCC $1c1c
+1c04 : a5 07 __ LDA $07
+1c06 : e5 03 __ SBC $03
+1c08 : 85 07 __ STA $07
+1c0a : a5 08 __ LDA $08
+1c0c : e5 04 __ SBC $04
+1c0e : 85 08 __ STA $08
+1c10 : a5 09 __ LDA $09
+1c12 : e5 05 __ SBC $05
+1c14 : 85 09 __ STA $09
+1c16 : a5 0a __ LDA $0a
+1c18 : e5 06 __ SBC $06
+1c1a : 85 0a __ STA $0a
+1c1c : 88 __ __ DEY
+1c1d : d0 c3 __ BNE $1be2
+1c1f : 26 1b __ ROL ACCU + 0
+1c21 : 26 1c __ ROL ACCU + 1
+1c23 : 26 1d __ ROL ACCU + 2
+1c25 : 26 1e __ ROL ACCU + 3
+1c27 : a4 02 __ LDY $02
+1c29 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16:
+1c2a : a9 00 __ LDA #$00
+1c2c : 85 1d __ STA ACCU + 2
+1c2e : 85 1e __ STA ACCU + 3
+1c30 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32:
+1c31 : b5 00 __ LDA $00,x
+1c33 : 85 03 __ STA $03
+1c35 : b5 01 __ LDA $01,x
+1c37 : 85 04 __ STA $04
+1c39 : b5 02 __ LDA $02,x
+1c3b : 85 05 __ STA $05
+1c3d : b5 03 __ LDA $03,x
+1c3f : 85 06 __ STA $06
+1c41 : 20 d3 1b JSR $1bd3 ; (divmod32 + 0)
+1c44 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32:
+1c45 : b5 00 __ LDA $00,x
+1c47 : 85 03 __ STA $03
+1c49 : b5 01 __ LDA $01,x
+1c4b : 85 04 __ STA $04
+1c4d : b5 02 __ LDA $02,x
+1c4f : 85 05 __ STA $05
+1c51 : b5 03 __ LDA $03,x
+1c53 : 85 06 __ STA $06
+1c55 : 20 d3 1b JSR $1bd3 ; (divmod32 + 0)
+1c58 : a5 07 __ LDA $07
+1c5a : 85 1b __ STA ACCU + 0
+1c5c : a5 08 __ LDA $08
+1c5e : 85 1c __ STA ACCU + 1
+1c60 : a5 09 __ LDA $09
+1c62 : 85 1d __ STA ACCU + 2
+1c64 : a5 0a __ LDA $0a
+1c66 : 85 1e __ STA ACCU + 3
+1c68 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32:
+1c69 : b5 03 __ LDA $03,x
+1c6b : c5 1e __ CMP ACCU + 3
+1c6d : d0 20 __ BNE $1c8f
+1c6f : b5 02 __ LDA $02,x
+1c71 : c5 1d __ CMP ACCU + 2
+1c73 : d0 1a __ BNE $1c8f
+1c75 : b5 01 __ LDA $01,x
+1c77 : c5 1c __ CMP ACCU + 1
+1c79 : d0 14 __ BNE $1c8f
+1c7b : b5 00 __ LDA $00,x
+1c7d : c5 1b __ CMP ACCU + 0
+1c7f : d0 0e __ BNE $1c8f
+1c81 : a9 00 __ LDA #$00
+1c83 : 85 1b __ STA ACCU + 0
+1c85 : 85 1c __ STA ACCU + 1
+1c87 : 60 __ __ RTS
+1c88 : a9 ff __ LDA #$ff
+1c8a : 85 1b __ STA ACCU + 0
+1c8c : 85 1c __ STA ACCU + 1
+1c8e : 60 __ __ RTS
+1c8f : 90 f7 __ BCC $1c88
+1c91 : a9 01 __ LDA #$01
+1c93 : 85 1b __ STA ACCU + 0
+1c95 : a9 00 __ LDA #$00
+1c97 : 85 1c __ STA ACCU + 1
+1c99 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32:
+1c9a : a5 1e __ LDA ACCU + 3
+1c9c : 49 80 __ EOR #$80
+1c9e : 85 1e __ STA ACCU + 3
+1ca0 : b5 03 __ LDA $03,x
+1ca2 : 49 80 __ EOR #$80
+1ca4 : c5 1e __ CMP ACCU + 3
+1ca6 : d0 20 __ BNE $1cc8
+1ca8 : b5 02 __ LDA $02,x
+1caa : c5 1d __ CMP ACCU + 2
+1cac : d0 1a __ BNE $1cc8
+1cae : b5 01 __ LDA $01,x
+1cb0 : c5 1c __ CMP ACCU + 1
+1cb2 : d0 14 __ BNE $1cc8
+1cb4 : b5 00 __ LDA $00,x
+1cb6 : c5 1b __ CMP ACCU + 0
+1cb8 : d0 0e __ BNE $1cc8
+1cba : a9 00 __ LDA #$00
+1cbc : 85 1b __ STA ACCU + 0
+1cbe : 85 1c __ STA ACCU + 1
+1cc0 : 60 __ __ RTS
+1cc1 : a9 ff __ LDA #$ff
+1cc3 : 85 1b __ STA ACCU + 0
+1cc5 : 85 1c __ STA ACCU + 1
+1cc7 : 60 __ __ RTS
+1cc8 : 90 f7 __ BCC $1cc1
+1cca : a9 01 __ LDA #$01
+1ccc : 85 1b __ STA ACCU + 0
+1cce : a9 00 __ LDA #$00
+1cd0 : 85 1c __ STA ACCU + 1
+1cd2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_exit:
+1cd3 : a9 4c __ LDA #$4c
+1cd5 : 85 54 __ STA $54
+1cd7 : a9 00 __ LDA #$00
+1cd9 : 85 13 __ STA P6
+1cdb : a9 19 __ LDA #$19
+1cdd : 85 16 __ STA P9
+1cdf : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_const_8:
+1ce0 : b1 19 __ LDA (IP + 0),y
+1ce2 : aa __ __ TAX
+1ce3 : c8 __ __ INY
+1ce4 : b1 19 __ LDA (IP + 0),y
+1ce6 : 95 00 __ STA $00,x
+1ce8 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_p8:
+1ceb : b1 19 __ LDA (IP + 0),y
+1ced : aa __ __ TAX
+1cee : c8 __ __ INY
+1cef : b1 19 __ LDA (IP + 0),y
+1cf1 : 95 00 __ STA $00,x
+1cf3 : a9 00 __ LDA #$00
+1cf5 : 95 01 __ STA $01,x
+1cf7 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_n8:
+1cfa : b1 19 __ LDA (IP + 0),y
+1cfc : aa __ __ TAX
+1cfd : c8 __ __ INY
+1cfe : b1 19 __ LDA (IP + 0),y
+1d00 : 95 00 __ STA $00,x
+1d02 : a9 ff __ LDA #$ff
+1d04 : 95 01 __ STA $01,x
+1d06 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_16:
+1d09 : b1 19 __ LDA (IP + 0),y
+1d0b : aa __ __ TAX
+1d0c : c8 __ __ INY
+1d0d : b1 19 __ LDA (IP + 0),y
+1d0f : 95 00 __ STA $00,x
+1d11 : c8 __ __ INY
+1d12 : b1 19 __ LDA (IP + 0),y
+1d14 : 95 01 __ STA $01,x
+1d16 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_const_32:
+1d19 : b1 19 __ LDA (IP + 0),y
+1d1b : aa __ __ TAX
+1d1c : c8 __ __ INY
+1d1d : b1 19 __ LDA (IP + 0),y
+1d1f : 95 00 __ STA $00,x
+1d21 : c8 __ __ INY
+1d22 : b1 19 __ LDA (IP + 0),y
+1d24 : 95 01 __ STA $01,x
+1d26 : c8 __ __ INY
+1d27 : b1 19 __ LDA (IP + 0),y
+1d29 : 95 02 __ STA $02,x
+1d2b : c8 __ __ INY
+1d2c : b1 19 __ LDA (IP + 0),y
+1d2e : 95 03 __ STA $03,x
+1d30 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_8:
+1d33 : b1 19 __ LDA (IP + 0),y
+1d35 : aa __ __ TAX
+1d36 : b5 00 __ LDA $00,x
+1d38 : 85 1b __ STA ACCU + 0
+1d3a : a9 00 __ LDA #$00
+1d3c : 85 1c __ STA ACCU + 1
+1d3e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_8:
+1d41 : b1 19 __ LDA (IP + 0),y
+1d43 : aa __ __ TAX
+1d44 : a5 1b __ LDA ACCU + 0
+1d46 : 95 00 __ STA $00,x
+1d48 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_16:
+1d4b : b1 19 __ LDA (IP + 0),y
+1d4d : aa __ __ TAX
+1d4e : b5 00 __ LDA $00,x
+1d50 : 85 1b __ STA ACCU + 0
+1d52 : b5 01 __ LDA $01,x
+1d54 : 85 1c __ STA ACCU + 1
+1d56 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_16:
+1d59 : b1 19 __ LDA (IP + 0),y
+1d5b : aa __ __ TAX
+1d5c : a5 1b __ LDA ACCU + 0
+1d5e : 95 00 __ STA $00,x
+1d60 : a5 1c __ LDA ACCU + 1
+1d62 : 95 01 __ STA $01,x
+1d64 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_addr_reg:
+1d67 : b1 19 __ LDA (IP + 0),y
+1d69 : aa __ __ TAX
+1d6a : b5 00 __ LDA $00,x
+1d6c : 85 1f __ STA ADDR + 0
+1d6e : b5 01 __ LDA $01,x
+1d70 : 85 20 __ STA ADDR + 1
+1d72 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_reg_32:
+1d75 : b1 19 __ LDA (IP + 0),y
+1d77 : aa __ __ TAX
+1d78 : b5 00 __ LDA $00,x
+1d7a : 85 1b __ STA ACCU + 0
+1d7c : b5 01 __ LDA $01,x
+1d7e : 85 1c __ STA ACCU + 1
+1d80 : b5 02 __ LDA $02,x
+1d82 : 85 1d __ STA ACCU + 2
+1d84 : b5 03 __ LDA $03,x
+1d86 : 85 1e __ STA ACCU + 3
+1d88 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_reg_32:
+1d8b : b1 19 __ LDA (IP + 0),y
+1d8d : aa __ __ TAX
+1d8e : a5 1b __ LDA ACCU + 0
+1d90 : 95 00 __ STA $00,x
+1d92 : a5 1c __ LDA ACCU + 1
+1d94 : 95 01 __ STA $01,x
+1d96 : a5 1d __ LDA ACCU + 2
+1d98 : 95 02 __ STA $02,x
+1d9a : a5 1e __ LDA ACCU + 3
+1d9c : 95 03 __ STA $03,x
+1d9e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_16:
+1da1 : b1 19 __ LDA (IP + 0),y
+1da3 : 85 1f __ STA ADDR + 0
+1da5 : c8 __ __ INY
+1da6 : b1 19 __ LDA (IP + 0),y
+1da8 : 85 20 __ STA ADDR + 1
+1daa : c8 __ __ INY
+1dab : b1 19 __ LDA (IP + 0),y
+1dad : aa __ __ TAX
+1dae : 84 02 __ STY $02
+1db0 : a0 00 __ LDY #$00
+1db2 : b1 1f __ LDA (ADDR + 0),y
+1db4 : 95 00 __ STA $00,x
+1db6 : c8 __ __ INY
+1db7 : b1 1f __ LDA (ADDR + 0),y
+1db9 : 95 01 __ STA $01,x
+1dbb : a4 02 __ LDY $02
+1dbd : 4c 50 08 JMP $0850 ; (startup + 79)
+1dc0 : b1 19 __ LDA (IP + 0),y
+1dc2 : aa __ __ TAX
+1dc3 : c8 __ __ INY
+1dc4 : b1 19 __ LDA (IP + 0),y
+1dc6 : 84 02 __ STY $02
+1dc8 : a8 __ __ TAY
+1dc9 : 4c b2 1d JMP $1db2 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16:
+1dcc : b1 19 __ LDA (IP + 0),y
+1dce : 85 1f __ STA ADDR + 0
+1dd0 : c8 __ __ INY
+1dd1 : b1 19 __ LDA (IP + 0),y
+1dd3 : 85 20 __ STA ADDR + 1
+1dd5 : c8 __ __ INY
+1dd6 : b1 19 __ LDA (IP + 0),y
+1dd8 : aa __ __ TAX
+1dd9 : 84 02 __ STY $02
+1ddb : a0 00 __ LDY #$00
+1ddd : b5 00 __ LDA $00,x
+1ddf : 91 1f __ STA (ADDR + 0),y
+1de1 : c8 __ __ INY
+1de2 : b5 01 __ LDA $01,x
+1de4 : 91 1f __ STA (ADDR + 0),y
+1de6 : a4 02 __ LDY $02
+1de8 : 4c 50 08 JMP $0850 ; (startup + 79)
+1deb : b1 19 __ LDA (IP + 0),y
+1ded : aa __ __ TAX
+1dee : c8 __ __ INY
+1def : b1 19 __ LDA (IP + 0),y
+1df1 : 84 02 __ STY $02
+1df3 : a8 __ __ TAY
+1df4 : 4c dd 1d JMP $1ddd ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_lea_abs:
+1df7 : b1 19 __ LDA (IP + 0),y
+1df9 : aa __ __ TAX
+1dfa : c8 __ __ INY
+1dfb : b1 19 __ LDA (IP + 0),y
+1dfd : 95 00 __ STA $00,x
+1dff : c8 __ __ INY
+1e00 : b1 19 __ LDA (IP + 0),y
+1e02 : 95 01 __ STA $01,x
+1e04 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_accu_index:
+1e07 : b1 19 __ LDA (IP + 0),y
+1e09 : aa __ __ TAX
+1e0a : 18 __ __ CLC
+1e0b : b5 00 __ LDA $00,x
+1e0d : 65 1b __ ADC ACCU + 0
+1e0f : 85 1f __ STA ADDR + 0
+1e11 : b5 01 __ LDA $01,x
+1e13 : 65 1c __ ADC ACCU + 1
+1e15 : 85 20 __ STA ADDR + 1
+1e17 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_8:
+1e1a : b1 19 __ LDA (IP + 0),y
+1e1c : aa __ __ TAX
+1e1d : c8 __ __ INY
+1e1e : b1 19 __ LDA (IP + 0),y
+1e20 : 84 02 __ STY $02
+1e22 : a8 __ __ TAY
+1e23 : b1 25 __ LDA (FP + 0),y
+1e25 : 95 00 __ STA $00,x
+1e27 : a4 02 __ LDY $02
+1e29 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_u8:
+1e2c : b1 19 __ LDA (IP + 0),y
+1e2e : aa __ __ TAX
+1e2f : c8 __ __ INY
+1e30 : b1 19 __ LDA (IP + 0),y
+1e32 : 84 02 __ STY $02
+1e34 : a8 __ __ TAY
+1e35 : b1 25 __ LDA (FP + 0),y
+1e37 : 95 00 __ STA $00,x
+1e39 : a9 00 __ LDA #$00
+1e3b : 95 01 __ STA $01,x
+1e3d : a4 02 __ LDY $02
+1e3f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_local_16:
+1e42 : b1 19 __ LDA (IP + 0),y
+1e44 : aa __ __ TAX
+1e45 : c8 __ __ INY
+1e46 : b1 19 __ LDA (IP + 0),y
+1e48 : 84 02 __ STY $02
+1e4a : a8 __ __ TAY
+1e4b : b1 25 __ LDA (FP + 0),y
+1e4d : 95 00 __ STA $00,x
+1e4f : c8 __ __ INY
+1e50 : b1 25 __ LDA (FP + 0),y
+1e52 : 95 01 __ STA $01,x
+1e54 : a4 02 __ LDY $02
+1e56 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_8:
+1e59 : b1 19 __ LDA (IP + 0),y
+1e5b : aa __ __ TAX
+1e5c : c8 __ __ INY
+1e5d : b1 19 __ LDA (IP + 0),y
+1e5f : 84 02 __ STY $02
+1e61 : a8 __ __ TAY
+1e62 : b5 00 __ LDA $00,x
+1e64 : 91 25 __ STA (FP + 0),y
+1e66 : a4 02 __ LDY $02
+1e68 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_local_16:
+1e6b : b1 19 __ LDA (IP + 0),y
+1e6d : aa __ __ TAX
+1e6e : c8 __ __ INY
+1e6f : b1 19 __ LDA (IP + 0),y
+1e71 : 84 02 __ STY $02
+1e73 : a8 __ __ TAY
+1e74 : b5 00 __ LDA $00,x
+1e76 : 91 25 __ STA (FP + 0),y
+1e78 : c8 __ __ INY
+1e79 : b5 01 __ LDA $01,x
+1e7b : 91 25 __ STA (FP + 0),y
+1e7d : a4 02 __ LDY $02
+1e7f : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_lea_local:
+1e82 : b1 19 __ LDA (IP + 0),y
+1e84 : aa __ __ TAX
+1e85 : c8 __ __ INY
+1e86 : 18 __ __ CLC
+1e87 : b1 19 __ LDA (IP + 0),y
+1e89 : 65 25 __ ADC FP + 0
+1e8b : 95 00 __ STA $00,x
+1e8d : c8 __ __ INY
+1e8e : b1 19 __ LDA (IP + 0),y
+1e90 : 65 26 __ ADC FP + 1
+1e92 : 95 01 __ STA $01,x
+1e94 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_8:
+1e97 : b1 19 __ LDA (IP + 0),y
+1e99 : aa __ __ TAX
+1e9a : c8 __ __ INY
+1e9b : b1 19 __ LDA (IP + 0),y
+1e9d : 84 02 __ STY $02
+1e9f : a8 __ __ TAY
+1ea0 : b5 00 __ LDA $00,x
+1ea2 : 91 23 __ STA (SP + 0),y
+1ea4 : a4 02 __ LDY $02
+1ea6 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_store_frame_16:
+1ea9 : b1 19 __ LDA (IP + 0),y
+1eab : aa __ __ TAX
+1eac : c8 __ __ INY
+1ead : b1 19 __ LDA (IP + 0),y
+1eaf : 84 02 __ STY $02
+1eb1 : a8 __ __ TAY
+1eb2 : b5 00 __ LDA $00,x
+1eb4 : 91 23 __ STA (SP + 0),y
+1eb6 : c8 __ __ INY
+1eb7 : b5 01 __ LDA $01,x
+1eb9 : 91 23 __ STA (SP + 0),y
+1ebb : a4 02 __ LDY $02
+1ebd : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_load_abs_8:
+1ec0 : b1 19 __ LDA (IP + 0),y
+1ec2 : 85 1f __ STA ADDR + 0
+1ec4 : c8 __ __ INY
+1ec5 : b1 19 __ LDA (IP + 0),y
+1ec7 : 85 20 __ STA ADDR + 1
+1ec9 : c8 __ __ INY
+1eca : b1 19 __ LDA (IP + 0),y
+1ecc : aa __ __ TAX
+1ecd : 84 02 __ STY $02
+1ecf : a0 00 __ LDY #$00
+1ed1 : b1 1f __ LDA (ADDR + 0),y
+1ed3 : 95 00 __ STA $00,x
+1ed5 : a4 02 __ LDY $02
+1ed7 : 4c 50 08 JMP $0850 ; (startup + 79)
+1eda : b1 19 __ LDA (IP + 0),y
+1edc : aa __ __ TAX
+1edd : c8 __ __ INY
+1ede : b1 19 __ LDA (IP + 0),y
+1ee0 : 84 02 __ STY $02
+1ee2 : a8 __ __ TAY
+1ee3 : 4c d1 1e JMP $1ed1 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8:
+1ee6 : b1 19 __ LDA (IP + 0),y
+1ee8 : 85 1f __ STA ADDR + 0
+1eea : c8 __ __ INY
+1eeb : b1 19 __ LDA (IP + 0),y
+1eed : 85 20 __ STA ADDR + 1
+1eef : c8 __ __ INY
+1ef0 : b1 19 __ LDA (IP + 0),y
+1ef2 : aa __ __ TAX
+1ef3 : 84 02 __ STY $02
+1ef5 : a0 00 __ LDY #$00
+1ef7 : b1 1f __ LDA (ADDR + 0),y
+1ef9 : 95 00 __ STA $00,x
+1efb : a9 00 __ LDA #$00
+1efd : 95 01 __ STA $01,x
+1eff : a4 02 __ LDY $02
+1f01 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f04 : b1 19 __ LDA (IP + 0),y
+1f06 : aa __ __ TAX
+1f07 : c8 __ __ INY
+1f08 : b1 19 __ LDA (IP + 0),y
+1f0a : 84 02 __ STY $02
+1f0c : a8 __ __ TAY
+1f0d : 4c f7 1e JMP $1ef7 ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32:
+1f10 : b1 19 __ LDA (IP + 0),y
+1f12 : 85 1f __ STA ADDR + 0
+1f14 : c8 __ __ INY
+1f15 : b1 19 __ LDA (IP + 0),y
+1f17 : 85 20 __ STA ADDR + 1
+1f19 : c8 __ __ INY
+1f1a : b1 19 __ LDA (IP + 0),y
+1f1c : aa __ __ TAX
+1f1d : 84 02 __ STY $02
+1f1f : a0 00 __ LDY #$00
+1f21 : b1 1f __ LDA (ADDR + 0),y
+1f23 : 95 00 __ STA $00,x
+1f25 : c8 __ __ INY
+1f26 : b1 1f __ LDA (ADDR + 0),y
+1f28 : 95 01 __ STA $01,x
+1f2a : c8 __ __ INY
+1f2b : b1 1f __ LDA (ADDR + 0),y
+1f2d : 95 02 __ STA $02,x
+1f2f : c8 __ __ INY
+1f30 : b1 1f __ LDA (ADDR + 0),y
+1f32 : 95 03 __ STA $03,x
+1f34 : a4 02 __ LDY $02
+1f36 : 4c 50 08 JMP $0850 ; (startup + 79)
+1f39 : b1 19 __ LDA (IP + 0),y
+1f3b : aa __ __ TAX
+1f3c : c8 __ __ INY
+1f3d : b1 19 __ LDA (IP + 0),y
+1f3f : 84 02 __ STY $02
+1f41 : a8 __ __ TAY
+1f42 : 4c 21 1f JMP $1f21 ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8:
+1f45 : b1 19 __ LDA (IP + 0),y
+1f47 : 85 1f __ STA ADDR + 0
+1f49 : c8 __ __ INY
+1f4a : b1 19 __ LDA (IP + 0),y
+1f4c : 85 20 __ STA ADDR + 1
+1f4e : c8 __ __ INY
+1f4f : b1 19 __ LDA (IP + 0),y
+1f51 : aa __ __ TAX
+1f52 : 84 02 __ STY $02
+1f54 : a0 00 __ LDY #$00
+1f56 : b5 00 __ LDA $00,x
+1f58 : 91 1f __ STA (ADDR + 0),y
+1f5a : a4 02 __ LDY $02
+1f5c : 4c 50 08 JMP $0850 ; (startup + 79)
+1f5f : b1 19 __ LDA (IP + 0),y
+1f61 : aa __ __ TAX
+1f62 : c8 __ __ INY
+1f63 : b1 19 __ LDA (IP + 0),y
+1f65 : 84 02 __ STY $02
+1f67 : a8 __ __ TAY
+1f68 : 4c 56 1f JMP $1f56 ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16:
+1f6b : b1 19 __ LDA (IP + 0),y
+1f6d : aa __ __ TAX
+1f6e : 18 __ __ CLC
+1f6f : a5 1b __ LDA ACCU + 0
+1f71 : 75 00 __ ADC $00,x
+1f73 : 85 1b __ STA ACCU + 0
+1f75 : a5 1c __ LDA ACCU + 1
+1f77 : 75 01 __ ADC $01,x
+1f79 : 85 1c __ STA ACCU + 1
+1f7b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subr_16:
+1f7e : b1 19 __ LDA (IP + 0),y
+1f80 : aa __ __ TAX
+1f81 : 38 __ __ SEC
+1f82 : a5 1b __ LDA ACCU + 0
+1f84 : f5 00 __ SBC $00,x
+1f86 : 85 1b __ STA ACCU + 0
+1f88 : a5 1c __ LDA ACCU + 1
+1f8a : f5 01 __ SBC $01,x
+1f8c : 85 1c __ STA ACCU + 1
+1f8e : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_xorr_16:
+1f91 : b1 19 __ LDA (IP + 0),y
+1f93 : aa __ __ TAX
+1f94 : a5 1b __ LDA ACCU + 0
+1f96 : 55 00 __ EOR $00,x
+1f98 : 85 1b __ STA ACCU + 0
+1f9a : a5 1c __ LDA ACCU + 1
+1f9c : 55 01 __ EOR $01,x
+1f9e : 85 1c __ STA ACCU + 1
+1fa0 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_u16:
+1fa3 : b1 19 __ LDA (IP + 0),y
+1fa5 : aa __ __ TAX
+1fa6 : b5 00 __ LDA $00,x
+1fa8 : 85 03 __ STA $03
+1faa : b5 01 __ LDA $01,x
+1fac : 85 04 __ STA $04
+1fae : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+1fb1 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_u16:
+1fb4 : b1 19 __ LDA (IP + 0),y
+1fb6 : aa __ __ TAX
+1fb7 : b5 00 __ LDA $00,x
+1fb9 : 85 03 __ STA $03
+1fbb : b5 01 __ LDA $01,x
+1fbd : 85 04 __ STA $04
+1fbf : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+1fc2 : a5 05 __ LDA $05
+1fc4 : 85 1b __ STA ACCU + 0
+1fc6 : a5 06 __ LDA $06
+1fc8 : 85 1c __ STA ACCU + 1
+1fca : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_divr_s16:
+1fcd : b1 19 __ LDA (IP + 0),y
+1fcf : aa __ __ TAX
+1fd0 : b5 00 __ LDA $00,x
+1fd2 : 85 03 __ STA $03
+1fd4 : b5 01 __ LDA $01,x
+1fd6 : 85 04 __ STA $04
+1fd8 : 24 1c __ BIT ACCU + 1
+1fda : 10 10 __ BPL $1fec
+1fdc : 20 8b 1a JSR $1a8b ; (negaccu + 0)
+1fdf : 24 04 __ BIT $04
+1fe1 : 10 10 __ BPL $1ff3
+1fe3 : 20 99 1a JSR $1a99 ; (negtmp + 0)
+1fe6 : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+1fe9 : 4c 50 08 JMP $0850 ; (startup + 79)
+1fec : 24 04 __ BIT $04
+1fee : 10 f6 __ BPL $1fe6
+1ff0 : 20 99 1a JSR $1a99 ; (negtmp + 0)
+1ff3 : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+1ff6 : 20 8b 1a JSR $1a8b ; (negaccu + 0)
+1ff9 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_modr_s16:
+1ffc : b1 19 __ LDA (IP + 0),y
+1ffe : aa __ __ TAX
+1fff : b5 00 __ LDA $00,x
+2001 : 85 03 __ STA $03
+2003 : b5 01 __ LDA $01,x
+2005 : 85 04 __ STA $04
+2007 : 24 1c __ BIT ACCU + 1
+2009 : 10 18 __ BPL $2023
+200b : 20 8b 1a JSR $1a8b ; (negaccu + 0)
+200e : 24 04 __ BIT $04
+2010 : 10 18 __ BPL $202a
+2012 : 20 99 1a JSR $1a99 ; (negtmp + 0)
+2015 : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+2018 : a5 05 __ LDA $05
+201a : 85 1b __ STA ACCU + 0
+201c : a5 06 __ LDA $06
+201e : 85 1c __ STA ACCU + 1
+2020 : 4c 50 08 JMP $0850 ; (startup + 79)
+2023 : 24 04 __ BIT $04
+2025 : 10 ee __ BPL $2015
+2027 : 20 99 1a JSR $1a99 ; (negtmp + 0)
+202a : 20 a7 1a JSR $1aa7 ; (divmod + 0)
+202d : a5 05 __ LDA $05
+202f : 85 1b __ STA ACCU + 0
+2031 : a5 06 __ LDA $06
+2033 : 85 1c __ STA ACCU + 1
+2035 : 20 8b 1a JSR $1a8b ; (negaccu + 0)
+2038 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_adda_16:
+203b : b1 19 __ LDA (IP + 0),y
+203d : aa __ __ TAX
+203e : 18 __ __ CLC
+203f : b5 00 __ LDA $00,x
+2041 : 65 1b __ ADC ACCU + 0
+2043 : 95 00 __ STA $00,x
+2045 : b5 01 __ LDA $01,x
+2047 : 65 1c __ ADC ACCU + 1
+2049 : 95 01 __ STA $01,x
+204b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_16:
+204e : b1 19 __ LDA (IP + 0),y
+2050 : c8 __ __ INY
+2051 : aa __ __ TAX
+2052 : 18 __ __ CLC
+2053 : b5 00 __ LDA $00,x
+2055 : 71 19 __ ADC (IP + 0),y
+2057 : c8 __ __ INY
+2058 : 95 00 __ STA $00,x
+205a : b5 01 __ LDA $01,x
+205c : 71 19 __ ADC (IP + 0),y
+205e : 95 01 __ STA $01,x
+2060 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_subi_16:
+2063 : b1 19 __ LDA (IP + 0),y
+2065 : c8 __ __ INY
+2066 : aa __ __ TAX
+2067 : 38 __ __ SEC
+2068 : b1 19 __ LDA (IP + 0),y
+206a : c8 __ __ INY
+206b : f5 00 __ SBC $00,x
+206d : 95 00 __ STA $00,x
+206f : b1 19 __ LDA (IP + 0),y
+2071 : f5 01 __ SBC $01,x
+2073 : 95 01 __ STA $01,x
+2075 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_andi_16:
+2078 : b1 19 __ LDA (IP + 0),y
+207a : c8 __ __ INY
+207b : aa __ __ TAX
+207c : b5 00 __ LDA $00,x
+207e : 31 19 __ AND (IP + 0),y
+2080 : c8 __ __ INY
+2081 : 95 00 __ STA $00,x
+2083 : b5 01 __ LDA $01,x
+2085 : 31 19 __ AND (IP + 0),y
+2087 : 95 01 __ STA $01,x
+2089 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_muli8_16:
+208c : b1 19 __ LDA (IP + 0),y
+208e : c8 __ __ INY
+208f : aa __ __ TAX
+2090 : a9 00 __ LDA #$00
+2092 : 85 05 __ STA $05
+2094 : 85 06 __ STA $06
+2096 : b5 00 __ LDA $00,x
+2098 : 85 03 __ STA $03
+209a : b5 01 __ LDA $01,x
+209c : 85 04 __ STA $04
+209e : b1 19 __ LDA (IP + 0),y
+20a0 : 4a __ __ LSR
+20a1 : 85 07 __ STA $07
+20a3 : 90 0d __ BCC $20b2
+20a5 : 18 __ __ CLC
+20a6 : a5 05 __ LDA $05
+20a8 : 65 03 __ ADC $03
+20aa : 85 05 __ STA $05
+20ac : a5 06 __ LDA $06
+20ae : 65 04 __ ADC $04
+20b0 : 85 06 __ STA $06
+20b2 : 06 03 __ ASL $03
+20b4 : 26 04 __ ROL $04
+20b6 : 46 07 __ LSR $07
+20b8 : b0 eb __ BCS $20a5
+20ba : d0 f6 __ BNE $20b2
+20bc : a5 05 __ LDA $05
+20be : 95 00 __ STA $00,x
+20c0 : a5 06 __ LDA $06
+20c2 : 95 01 __ STA $01,x
+20c4 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_addi_8:
+20c7 : b1 19 __ LDA (IP + 0),y
+20c9 : c8 __ __ INY
+20ca : aa __ __ TAX
+20cb : 18 __ __ CLC
+20cc : b5 00 __ LDA $00,x
+20ce : 71 19 __ ADC (IP + 0),y
+20d0 : 95 00 __ STA $00,x
+20d2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shl_16:
+20d5 : b1 19 __ LDA (IP + 0),y
+20d7 : aa __ __ TAX
+20d8 : b5 00 __ LDA $00,x
+20da : 2c b1 19 BIT $19b1 ; (fmul + 66)
+20dd : 29 0f __ AND #$0f
+20df : f0 0b __ BEQ $20ec
+20e1 : aa __ __ TAX
+20e2 : a5 1c __ LDA ACCU + 1
+20e4 : 06 1b __ ASL ACCU + 0
+20e6 : 2a __ __ ROL
+20e7 : ca __ __ DEX
+20e8 : d0 fa __ BNE $20e4
+20ea : 85 1c __ STA ACCU + 1
+20ec : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_binop_shr_u16:
+20ef : b1 19 __ LDA (IP + 0),y
+20f1 : aa __ __ TAX
+20f2 : b5 00 __ LDA $00,x
+20f4 : 2c b1 19 BIT $19b1 ; (fmul + 66)
+20f7 : 29 0f __ AND #$0f
+20f9 : f0 0b __ BEQ $2106
+20fb : aa __ __ TAX
+20fc : a5 1c __ LDA ACCU + 1
+20fe : 4a __ __ LSR
+20ff : 66 1b __ ROR ACCU + 0
+2101 : ca __ __ DEX
+2102 : d0 fa __ BNE $20fe
+2104 : 85 1c __ STA ACCU + 1
+2106 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+cmp16:
+2109 : b1 19 __ LDA (IP + 0),y
+210b : aa __ __ TAX
+210c : 38 __ __ SEC
+210d : b5 01 __ LDA $01,x
+210f : e5 1c __ SBC ACCU + 1
+2111 : f0 11 __ BEQ $2124
+2113 : 50 02 __ BVC $2117
+2115 : 49 80 __ EOR #$80
+2117 : 30 2a __ BMI $2143
+2119 : 10 33 __ BPL $214e
+211b : b1 19 __ LDA (IP + 0),y
+211d : aa __ __ TAX
+211e : b5 01 __ LDA $01,x
+2120 : c5 1c __ CMP ACCU + 1
+2122 : d0 28 __ BNE $214c
+2124 : b5 00 __ LDA $00,x
+2126 : c5 1b __ CMP ACCU + 0
+2128 : d0 22 __ BNE $214c
+212a : f0 0e __ BEQ $213a
+212c : b1 19 __ LDA (IP + 0),y
+212e : aa __ __ TAX
+212f : c8 __ __ INY
+2130 : b1 19 __ LDA (IP + 0),y
+2132 : c5 1c __ CMP ACCU + 1
+2134 : d0 16 __ BNE $214c
+2136 : e4 1b __ CPX ACCU + 0
+2138 : d0 12 __ BNE $214c
+213a : a9 00 __ LDA #$00
+213c : 85 1b __ STA ACCU + 0
+213e : 85 1c __ STA ACCU + 1
+2140 : 4c 50 08 JMP $0850 ; (startup + 79)
+2143 : a9 ff __ LDA #$ff
+2145 : 85 1b __ STA ACCU + 0
+2147 : 85 1c __ STA ACCU + 1
+2149 : 4c 50 08 JMP $0850 ; (startup + 79)
+214c : 90 f5 __ BCC $2143
+214e : a9 01 __ LDA #$01
+2150 : 85 1b __ STA ACCU + 0
+2152 : a9 00 __ LDA #$00
+2154 : 85 1c __ STA ACCU + 1
+2156 : 4c 50 08 JMP $0850 ; (startup + 79)
+2159 : b1 19 __ LDA (IP + 0),y
+215b : c8 __ __ INY
+215c : aa __ __ TAX
+215d : b1 19 __ LDA (IP + 0),y
+215f : 38 __ __ SEC
+2160 : e5 1c __ SBC ACCU + 1
+2162 : d0 af __ BNE $2113
+2164 : e4 1b __ CPX ACCU + 0
+2166 : d0 e4 __ BNE $214c
+2168 : f0 d0 __ BEQ $213a
+216a : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8:
+216b : b1 19 __ LDA (IP + 0),y
+216d : aa __ __ TAX
+216e : 38 __ __ SEC
+216f : b5 00 __ LDA $00,x
+2171 : e5 1b __ SBC ACCU + 0
+2173 : f0 19 __ BEQ $218e
+2175 : 50 02 __ BVC $2179
+2177 : 49 80 __ EOR #$80
+2179 : 30 1c __ BMI $2197
+217b : 10 25 __ BPL $21a2
+217d : b1 19 __ LDA (IP + 0),y
+217f : aa __ __ TAX
+2180 : b5 00 __ LDA $00,x
+2182 : c5 1b __ CMP ACCU + 0
+2184 : d0 1a __ BNE $21a0
+2186 : f0 06 __ BEQ $218e
+2188 : b1 19 __ LDA (IP + 0),y
+218a : c5 1b __ CMP ACCU + 0
+218c : d0 12 __ BNE $21a0
+218e : a9 00 __ LDA #$00
+2190 : 85 1b __ STA ACCU + 0
+2192 : 85 1c __ STA ACCU + 1
+2194 : 4c 50 08 JMP $0850 ; (startup + 79)
+2197 : a9 ff __ LDA #$ff
+2199 : 85 1b __ STA ACCU + 0
+219b : 85 1c __ STA ACCU + 1
+219d : 4c 50 08 JMP $0850 ; (startup + 79)
+21a0 : 90 f5 __ BCC $2197
+21a2 : a9 01 __ LDA #$01
+21a4 : 85 1b __ STA ACCU + 0
+21a6 : a9 00 __ LDA #$00
+21a8 : 85 1c __ STA ACCU + 1
+21aa : 4c 50 08 JMP $0850 ; (startup + 79)
+21ad : b1 19 __ LDA (IP + 0),y
+21af : 38 __ __ SEC
+21b0 : e5 1b __ SBC ACCU + 0
+21b2 : d0 c1 __ BNE $2175
+21b4 : f0 d8 __ BEQ $218e
+21b6 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16:
+21b7 : 38 __ __ SEC
+21b8 : a9 00 __ LDA #$00
+21ba : e5 1b __ SBC ACCU + 0
+21bc : 85 1b __ STA ACCU + 0
+21be : a9 00 __ LDA #$00
+21c0 : e5 1c __ SBC ACCU + 1
+21c2 : 85 1c __ STA ACCU + 1
+21c4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_add_f32:
+21c7 : 20 62 18 JSR $1862 ; (freg + 0)
+21ca : 20 a7 18 JSR $18a7 ; (faddsub + 0)
+21cd : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_sub_f32:
+21d0 : 20 62 18 JSR $1862 ; (freg + 0)
+21d3 : a5 06 __ LDA $06
+21d5 : 49 80 __ EOR #$80
+21d7 : 85 06 __ STA $06
+21d9 : 20 a7 18 JSR $18a7 ; (faddsub + 0)
+21dc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mul_f32:
+21df : 20 62 18 JSR $1862 ; (freg + 0)
+21e2 : 84 02 __ STY $02
+21e4 : 20 6f 19 JSR $196f ; (fmul + 0)
+21e7 : a4 02 __ LDY $02
+21e9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_div_f32:
+21ec : 20 62 18 JSR $1862 ; (freg + 0)
+21ef : 20 0d 1a JSR $1a0d ; (fdiv + 0)
+21f2 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_cmp_f32:
+21f5 : b1 19 __ LDA (IP + 0),y
+21f7 : c8 __ __ INY
+21f8 : aa __ __ TAX
+21f9 : a5 1e __ LDA ACCU + 3
+21fb : 55 03 __ EOR $03,x
+21fd : 29 80 __ AND #$80
+21ff : f0 1e __ BEQ $221f
+2201 : a5 1e __ LDA ACCU + 3
+2203 : 29 7f __ AND #$7f
+2205 : 05 1d __ ORA ACCU + 2
+2207 : 05 1c __ ORA ACCU + 1
+2209 : 05 1b __ ORA ACCU + 0
+220b : d0 0c __ BNE $2219
+220d : b5 03 __ LDA $03,x
+220f : 29 7f __ AND #$7f
+2211 : 15 02 __ ORA $02,x
+2213 : 15 01 __ ORA $01,x
+2215 : 15 00 __ ORA $00,x
+2217 : f0 1e __ BEQ $2237
+2219 : a5 1e __ LDA ACCU + 3
+221b : 30 29 __ BMI $2246
+221d : 10 36 __ BPL $2255
+221f : a5 1e __ LDA ACCU + 3
+2221 : d5 03 __ CMP $03,x
+2223 : d0 1b __ BNE $2240
+2225 : a5 1d __ LDA ACCU + 2
+2227 : d5 02 __ CMP $02,x
+2229 : d0 15 __ BNE $2240
+222b : a5 1c __ LDA ACCU + 1
+222d : d5 01 __ CMP $01,x
+222f : d0 0f __ BNE $2240
+2231 : a5 1b __ LDA ACCU + 0
+2233 : d5 00 __ CMP $00,x
+2235 : d0 09 __ BNE $2240
+2237 : a9 00 __ LDA #$00
+2239 : 85 1b __ STA ACCU + 0
+223b : 85 1c __ STA ACCU + 1
+223d : 4c 51 08 JMP $0851 ; (startup + 80)
+2240 : b0 0f __ BCS $2251
+2242 : 24 1e __ BIT ACCU + 3
+2244 : 30 0f __ BMI $2255
+2246 : a9 00 __ LDA #$00
+2248 : 85 1c __ STA ACCU + 1
+224a : a9 01 __ LDA #$01
+224c : 85 1b __ STA ACCU + 0
+224e : 4c 51 08 JMP $0851 ; (startup + 80)
+2251 : 24 1e __ BIT ACCU + 3
+2253 : 30 f1 __ BMI $2246
+2255 : a9 ff __ LDA #$ff
+2257 : 85 1b __ STA ACCU + 0
+2259 : 85 1c __ STA ACCU + 1
+225b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_negate_f32:
+225e : a5 1e __ LDA ACCU + 3
+2260 : 49 80 __ EOR #$80
+2262 : 85 1e __ STA ACCU + 3
+2264 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_i16_f32:
+2267 : 20 6e 1b JSR $1b6e ; (sint16_to_float + 0)
+226a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_conv_f32_i16:
+226d : 20 2c 1b JSR $1b2c ; (f32_to_i16 + 0)
+2270 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+bra:
+2273 : b1 19 __ LDA (IP + 0),y
+2275 : 30 0c __ BMI $2283
+2277 : 38 __ __ SEC
+2278 : 65 19 __ ADC IP + 0
+227a : 85 19 __ STA IP + 0
+227c : 90 02 __ BCC $2280
+227e : e6 1a __ INC IP + 1
+2280 : 4c 51 08 JMP $0851 ; (startup + 80)
+2283 : 38 __ __ SEC
+2284 : 65 19 __ ADC IP + 0
+2286 : 85 19 __ STA IP + 0
+2288 : b0 02 __ BCS $228c
+228a : c6 1a __ DEC IP + 1
+228c : 4c 51 08 JMP $0851 ; (startup + 80)
+228f : a5 1b __ LDA ACCU + 0
+2291 : 05 1c __ ORA ACCU + 1
+2293 : f0 de __ BEQ $2273
+2295 : 4c 50 08 JMP $0850 ; (startup + 79)
+2298 : a5 1b __ LDA ACCU + 0
+229a : 05 1c __ ORA ACCU + 1
+229c : d0 d5 __ BNE $2273
+229e : 4c 50 08 JMP $0850 ; (startup + 79)
+22a1 : a5 1c __ LDA ACCU + 1
+22a3 : 30 04 __ BMI $22a9
+22a5 : 05 1b __ ORA ACCU + 0
+22a7 : d0 ca __ BNE $2273
+22a9 : 4c 50 08 JMP $0850 ; (startup + 79)
+22ac : a5 1c __ LDA ACCU + 1
+22ae : 10 c3 __ BPL $2273
+22b0 : 4c 50 08 JMP $0850 ; (startup + 79)
+22b3 : a5 1c __ LDA ACCU + 1
+22b5 : 30 bc __ BMI $2273
+22b7 : 4c 50 08 JMP $0850 ; (startup + 79)
+22ba : a5 1c __ LDA ACCU + 1
+22bc : 30 b5 __ BMI $2273
+22be : 05 1b __ ORA ACCU + 0
+22c0 : f0 b1 __ BEQ $2273
+22c2 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+braf:
+22c5 : 38 __ __ SEC
+22c6 : b1 19 __ LDA (IP + 0),y
+22c8 : 65 19 __ ADC IP + 0
+22ca : aa __ __ TAX
+22cb : c8 __ __ INY
+22cc : b1 19 __ LDA (IP + 0),y
+22ce : 65 1a __ ADC IP + 1
+22d0 : 85 1a __ STA IP + 1
+22d2 : 86 19 __ STX IP + 0
+22d4 : 4c 51 08 JMP $0851 ; (startup + 80)
+22d7 : a5 1b __ LDA ACCU + 0
+22d9 : 05 1c __ ORA ACCU + 1
+22db : f0 e8 __ BEQ $22c5
+22dd : c8 __ __ INY
+22de : 4c 50 08 JMP $0850 ; (startup + 79)
+22e1 : a5 1b __ LDA ACCU + 0
+22e3 : 05 1c __ ORA ACCU + 1
+22e5 : d0 de __ BNE $22c5
+22e7 : c8 __ __ INY
+22e8 : 4c 50 08 JMP $0850 ; (startup + 79)
+22eb : a5 1c __ LDA ACCU + 1
+22ed : 30 04 __ BMI $22f3
+22ef : 05 1b __ ORA ACCU + 0
+22f1 : d0 d2 __ BNE $22c5
+22f3 : c8 __ __ INY
+22f4 : 4c 50 08 JMP $0850 ; (startup + 79)
+22f7 : a5 1c __ LDA ACCU + 1
+22f9 : 10 ca __ BPL $22c5
+22fb : c8 __ __ INY
+22fc : 4c 50 08 JMP $0850 ; (startup + 79)
+22ff : a5 1c __ LDA ACCU + 1
+2301 : 30 c2 __ BMI $22c5
+2303 : c8 __ __ INY
+2304 : 4c 50 08 JMP $0850 ; (startup + 79)
+2307 : a5 1c __ LDA ACCU + 1
+2309 : 30 ba __ BMI $22c5
+230b : 05 1b __ ORA ACCU + 0
+230d : f0 b6 __ BEQ $22c5
+230f : c8 __ __ INY
+2310 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+set:
+2313 : a9 00 __ LDA #$00
+2315 : 2c a9 01 BIT $01a9 
+2318 : 85 1b __ STA ACCU + 0
+231a : a9 00 __ LDA #$00
+231c : 85 1c __ STA ACCU + 1
+231e : 4c 51 08 JMP $0851 ; (startup + 80)
+2321 : a5 1b __ LDA ACCU + 0
+2323 : 05 1c __ ORA ACCU + 1
+2325 : f0 ef __ BEQ $2316
+2327 : d0 ea __ BNE $2313
+2329 : a5 1b __ LDA ACCU + 0
+232b : 05 1c __ ORA ACCU + 1
+232d : d0 e7 __ BNE $2316
+232f : f0 e2 __ BEQ $2313
+2331 : a5 1c __ LDA ACCU + 1
+2333 : 30 de __ BMI $2313
+2335 : 05 1b __ ORA ACCU + 0
+2337 : d0 dd __ BNE $2316
+2339 : f0 d8 __ BEQ $2313
+233b : a5 1c __ LDA ACCU + 1
+233d : 10 d7 __ BPL $2316
+233f : 30 d2 __ BMI $2313
+2341 : a5 1c __ LDA ACCU + 1
+2343 : 30 d1 __ BMI $2316
+2345 : 10 cc __ BPL $2313
+2347 : a5 1c __ LDA ACCU + 1
+2349 : 30 cb __ BMI $2316
+234b : 05 1b __ ORA ACCU + 0
+234d : f0 c7 __ BEQ $2316
+234f : d0 c2 __ BNE $2313
+2351 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_jsr:
+2352 : b1 19 __ LDA (IP + 0),y
+2354 : 8d 68 23 STA $2368 ; (inp_jsr + 22)
+2357 : c8 __ __ INY
+2358 : b1 19 __ LDA (IP + 0),y
+235a : 8d 69 23 STA $2369 ; (inp_jsr + 23)
+235d : 98 __ __ TYA
+235e : 38 __ __ SEC
+235f : 65 19 __ ADC IP + 0
+2361 : 85 19 __ STA IP + 0
+2363 : 90 02 __ BCC $2367
+2365 : e6 1a __ INC IP + 1
+2367 : 20 00 00 JSR $0000 
+236a : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_native:
+236d : 98 __ __ TYA
+236e : 18 __ __ CLC
+236f : 65 19 __ ADC IP + 0
+2371 : 8d 7c 23 STA $237c ; (inp_native + 15)
+2374 : a5 1a __ LDA IP + 1
+2376 : 69 00 __ ADC #$00
+2378 : 8d 7d 23 STA $237d ; (inp_native + 16)
+237b : 20 00 00 JSR $0000 
+237e : a0 00 __ LDY #$00
+2380 : b1 23 __ LDA (SP + 0),y
+2382 : 85 19 __ STA IP + 0
+2384 : c8 __ __ INY
+2385 : b1 23 __ LDA (SP + 0),y
+2387 : 85 1a __ STA IP + 1
+2389 : 88 __ __ DEY
+238a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_enter:
+238d : 38 __ __ SEC
+238e : a5 23 __ LDA SP + 0
+2390 : f1 19 __ SBC (IP + 0),y
+2392 : c8 __ __ INY
+2393 : 85 23 __ STA SP + 0
+2395 : a5 24 __ LDA SP + 1
+2397 : f1 19 __ SBC (IP + 0),y
+2399 : c8 __ __ INY
+239a : 85 24 __ STA SP + 1
+239c : b1 19 __ LDA (IP + 0),y
+239e : 84 02 __ STY $02
+23a0 : a8 __ __ TAY
+23a1 : a5 25 __ LDA FP + 0
+23a3 : 91 23 __ STA (SP + 0),y
+23a5 : c8 __ __ INY
+23a6 : a5 26 __ LDA FP + 1
+23a8 : 91 23 __ STA (SP + 0),y
+23aa : 98 __ __ TYA
+23ab : 38 __ __ SEC
+23ac : 65 23 __ ADC SP + 0
+23ae : 85 25 __ STA FP + 0
+23b0 : a9 00 __ LDA #$00
+23b2 : 65 24 __ ADC SP + 1
+23b4 : 85 26 __ STA FP + 1
+23b6 : 88 __ __ DEY
+23b7 : f0 08 __ BEQ $23c1
+23b9 : b9 52 00 LDA $0052,y 
+23bc : 88 __ __ DEY
+23bd : 91 23 __ STA (SP + 0),y
+23bf : d0 f8 __ BNE $23b9
+23c1 : a4 02 __ LDY $02
+23c3 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_return:
+23c6 : b1 19 __ LDA (IP + 0),y
+23c8 : c8 __ __ INY
+23c9 : 84 02 __ STY $02
+23cb : a8 __ __ TAY
+23cc : b1 23 __ LDA (SP + 0),y
+23ce : 85 25 __ STA FP + 0
+23d0 : c8 __ __ INY
+23d1 : b1 23 __ LDA (SP + 0),y
+23d3 : 85 26 __ STA FP + 1
+23d5 : 88 __ __ DEY
+23d6 : f0 09 __ BEQ $23e1
+23d8 : 88 __ __ DEY
+23d9 : b1 23 __ LDA (SP + 0),y
+23db : 99 53 00 STA $0053,y 
+23de : 88 __ __ DEY
+23df : 10 f8 __ BPL $23d9
+23e1 : a4 02 __ LDY $02
+23e3 : 18 __ __ CLC
+23e4 : b1 19 __ LDA (IP + 0),y
+23e6 : c8 __ __ INY
+23e7 : 65 23 __ ADC SP + 0
+23e9 : 85 23 __ STA SP + 0
+23eb : b1 19 __ LDA (IP + 0),y
+23ed : c8 __ __ INY
+23ee : 65 24 __ ADC SP + 1
+23f0 : 85 24 __ STA SP + 1
+23f2 : a0 01 __ LDY #$01
+23f4 : b1 23 __ LDA (SP + 0),y
+23f6 : 85 1a __ STA IP + 1
+23f8 : 88 __ __ DEY
+23f9 : b1 23 __ LDA (SP + 0),y
+23fb : 85 19 __ STA IP + 0
+23fd : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_call:
+2400 : b1 19 __ LDA (IP + 0),y
+2402 : 85 1f __ STA ADDR + 0
+2404 : c8 __ __ INY
+2405 : b1 19 __ LDA (IP + 0),y
+2407 : 85 20 __ STA ADDR + 1
+2409 : c8 __ __ INY
+240a : 98 __ __ TYA
+240b : a0 00 __ LDY #$00
+240d : 18 __ __ CLC
+240e : 65 19 __ ADC IP + 0
+2410 : 91 23 __ STA (SP + 0),y
+2412 : c8 __ __ INY
+2413 : a5 1a __ LDA IP + 1
+2415 : 69 00 __ ADC #$00
+2417 : 91 23 __ STA (SP + 0),y
+2419 : a5 1f __ LDA ADDR + 0
+241b : 85 19 __ STA IP + 0
+241d : a5 20 __ LDA ADDR + 1
+241f : 85 1a __ STA IP + 1
+2421 : 4c 4e 08 JMP $084e ; (startup + 77)
+--------------------------------------------------------------------
+inp_push_frame:
+2424 : 38 __ __ SEC
+2425 : a5 23 __ LDA SP + 0
+2427 : f1 19 __ SBC (IP + 0),y
+2429 : c8 __ __ INY
+242a : 85 23 __ STA SP + 0
+242c : a5 24 __ LDA SP + 1
+242e : f1 19 __ SBC (IP + 0),y
+2430 : 85 24 __ STA SP + 1
+2432 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_pop_frame:
+2435 : 18 __ __ CLC
+2436 : b1 19 __ LDA (IP + 0),y
+2438 : c8 __ __ INY
+2439 : 65 23 __ ADC SP + 0
+243b : 85 23 __ STA SP + 0
+243d : b1 19 __ LDA (IP + 0),y
+243f : 65 24 __ ADC SP + 1
+2441 : 85 24 __ STA SP + 1
+2443 : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_copy:
+2446 : b1 19 __ LDA (IP + 0),y
+2448 : 84 02 __ STY $02
+244a : a8 __ __ TAY
+244b : 88 __ __ DEY
+244c : f0 07 __ BEQ $2455
+244e : b1 1b __ LDA (ACCU + 0),y
+2450 : 91 1f __ STA (ADDR + 0),y
+2452 : 88 __ __ DEY
+2453 : d0 f9 __ BNE $244e
+2455 : b1 1b __ LDA (ACCU + 0),y
+2457 : 91 1f __ STA (ADDR + 0),y
+2459 : a4 02 __ LDY $02
+245b : 4c 50 08 JMP $0850 ; (startup + 79)
+--------------------------------------------------------------------
+inp_op_extrt:
+245e : b1 19 __ LDA (IP + 0),y
+2460 : c8 __ __ INY
+2461 : 8d 6f 24 STA $246f ; (inp_op_extrt + 17)
+2464 : b1 19 __ LDA (IP + 0),y
+2466 : c8 __ __ INY
+2467 : 8d 70 24 STA $2470 ; (inp_op_extrt + 18)
+246a : b1 19 __ LDA (IP + 0),y
+246c : c8 __ __ INY
+246d : aa __ __ TAX
+246e : 20 00 00 JSR $0000 
+2471 : 4c 51 08 JMP $0851 ; (startup + 80)
@@ -1,6 +1,67 @@
 #pragma once
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+
+// Element storage of the arrays.  Trivial types live in malloc'ed memory that
+// grows with realloc, other types are moved into a new array.
+
+template <class T, bool trivial = std::is_trivial<T>::value>
+struct ArrayStorage
+{
+	static T* Allocate(int n)
+	{
+		return new T[n];
+	}
+
+	static void Free(T* a)
+	{
+		delete[] a;
+	}
+
+	static T* Resize(T* a, int used, int n)
+	{
+		T* a2 = new T[n];
+		for (int i = 0; i < used; i++)
+			a2[i] = std::move(a[i]);
+		delete[] a;
+		return a2;
+	}
+
+	static void Copy(T* dst, const T* src, int n)
+	{
+		for (int i = 0; i < n; i++)
+			dst[i] = src[i];
+	}
+};
+
+template <class T>
+struct ArrayStorage<T, true>
+{
+	static T* Allocate(int n)
+	{
+		return (T*)malloc(n * sizeof(T));
+	}
+
+	static void Free(T* a)
+	{
+		free(a);
+	}
+
+	static T* Resize(T* a, int used, int n)
+	{
+		return (T*)realloc(a, n * sizeof(T));
+	}
+
+	static void Copy(T* dst, const T* src, int n)
+	{
+		if (n > 0)
+			memcpy(dst, src, n * sizeof(T));
+	}
+};
 
 template <class T>
 class DynamicArray
@@ -18,7 +79,7 @@ protected:
 		{
 			range = (size + by) * 2;
 			a2 = new T[range];
-			for (i = 0; i < size; i++) a2[i] = array[i];
+			for (i = 0; i < size; i++) a2[i] = std::move(array[i]);
 			delete[] array;
 			array = a2;
 		}
@@ -151,15 +212,14 @@ template <class T>
 class GrowingArray
 {
 protected:
+	typedef ArrayStorage<T>	Storage;
+
 	int		size, range;
 	T* array;
 	T			empty;
 
 	void Grow(int to, bool clear)
 	{
-		T* a2;
-		int i;
-
 		if (clear) size = 0;
 
 		if (to > range)
@@ -169,17 +229,10 @@ protected:
 			else
 				range = range * 2;
 
-			a2 = new T[range];
-			if (to > size)
-				for (i = 0; i < size; i++) a2[i] = array[i];
-			else
-				for (i = 0; i < to; i++) a2[i] = array[i];
-
-			delete[] array;
-			array = a2;
+			array = Storage::Resize(array, to > size ? size : to, range);
 		}
 
-		for (i = size; i < to; i++) array[i] = empty;
+		for (int i = size; i < to; i++) array[i] = empty;
 
 		size = to;
 	}
@@ -190,30 +243,64 @@ public:
 	{
 		size = 0;
 		range = 4;
-		array = new T[range];
+		array = Storage::Allocate(range);
 	}
 
 	GrowingArray(const GrowingArray& a)
 		: empty(a.empty)
 	{
-		int i;
 		size = a.size;
 		range = a.range;
-		array = new T[range];
-		for (i = 0; i < size; i++) array[i] = a.array[i];
+		array = Storage::Allocate(range);
+		Storage::Copy(array, a.array, size);
+	}
+
+	// The moved from array is empty and without storage
+
+	GrowingArray(GrowingArray&& a)
+		: empty(a.empty)
+	{
+		size = a.size;
+		range = a.range;
+		array = a.array;
+
+		a.size = 0;
+		a.range = 0;
+		a.array = nullptr;
 	}
 
 	GrowingArray & operator=(const GrowingArray& a)
 	{
-		Grow(a.size, true);
-		int i;
-		for (i = 0; i < size; i++) array[i] = a.array[i];
+		if (this != &a)
+		{
+			if (a.size > range)
+			{
+				Storage::Free(array);
+				range = a.size;
+				array = Storage::Allocate(range);
+			}
+			size = a.size;
+			Storage::Copy(array, a.array, size);
+		}
+		return *this;
+	}
+
+	GrowingArray& operator=(GrowingArray&& a)
+	{
+		Swap(a);
 		return *this;
 	}
 
 	~GrowingArray(void)
 	{
-		delete[] array;
+		Storage::Free(array);
+	}
+
+	void Swap(GrowingArray& a)
+	{
+		std::swap(size, a.size);
+		std::swap(range, a.range);
+		std::swap(array, a.array);
 	}
 
 	T& operator[](int n)
@@ -230,9 +317,28 @@ public:
 		else return array[n];
 	}
 
+	// Access to an existing element without the range check and growth of
+	// the index operator
+
+	T& At(int n)
+	{
+		assert(n >= 0 && n < size);
+		return array[n];
+	}
+
+	const T& At(int n) const
+	{
+		assert(n >= 0 && n < size);
+		return array[n];
+	}
+
 	void Push(T t)
 	{
-		(*this)[size] = t;
+		if (size == range)
+			Grow(size + 1, false);
+		else
+			size++;
+		array[size - 1] = std::move(t);
 	}
 
 	T Pop(void)
@@ -247,17 +353,17 @@ public:
 		int	j = size - 1;
 		while (j > at)
 		{
-			array[j] = array[j - 1];
+			array[j] = std::move(array[j - 1]);
 			j--;
 		}
-		array[at] = t;
+		array[at] = std::move(t);
 	}
 
 	void Remove(int at)
 	{
 		while (at + 1 < size)
 		{
-			array[at] = array[at + 1];
+			array[at] = std::move(array[at + 1]);
 			at++;
 		}
 		Grow(at, false);
@@ -272,6 +378,8 @@ public:
 
 	int Size(void) const { return size; }
 
+	int Capacity(void) const { return range; }
+
 	T Last() const
 	{
 		assert(size > 0);
@@ -288,17 +396,21 @@ public:
 		if (to > range)
 		{
 			range = to;
+			array = Storage::Resize(array, size, range);
 
-			T* a2 = new T[range];
-			if (to > size)
-				for (int i = 0; i < size; i++) a2[i] = array[i];
-			else
-				for (int i = 0; i < to; i++) a2[i] = array[i];
+			for (int i = size; i < range; i++) array[i] = empty;
+		}
+	}
 
-			delete[] array;
-			array = a2;
+	// Release the storage beyond the current size
 
-			for (int i = size; i < range; i++) array[i] = empty;
+	void Shrink(void)
+	{
+		int	to = size > 4 ? size : 4;
+		if (to < range)
+		{
+			range = to;
+			array = Storage::Resize(array, size, range);
 		}
 	}
 
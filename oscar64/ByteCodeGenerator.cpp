@@ -212,7 +212,7 @@ static ByteCode TransposeBranchCondition(ByteCode code)
 }
 
 ByteCodeInstruction::ByteCodeInstruction(ByteCode code)
-	: mCode(code), mRelocate(false), mRegisterFinal(false), mLinkerObject(nullptr), mValue(0), mRegister(0)
+	: mCode(code), mRelocate(false), mRegisterFinal(false), mLinkerObject(nullptr), mRuntime(nullptr), mValue(0), mRegister(0), mLive(0)
 {
 }
 
@@ -738,6 +738,9 @@ bool ByteCodeInstruction::UsesRegister(uint32 reg) const
 
 		if (mCode == BC_BINOP_ADDA_16)
 			return true;
+
+		if (mCode == BC_JUMP_TABLE)
+			return true;
 	}
 
 	if (reg == BC_REG_ACCU)
@@ -851,11 +854,13 @@ bool ByteCodeInstruction::ChangesRegister(uint32 reg) const
 			return true;
 		if (mCode == BC_LEA_ABS_INDEX || mCode == BC_LEA_ABS_INDEX_U8 || mCode == BC_LEA_ACCU_INDEX)
 			return true;
+		if (mCode == BC_JUMP_TABLE)
+			return true;
 	}
 
 	if (reg == BC_REG_WORK)
 	{
-		if (mCode == BC_JSR || mCode == BC_CALL_ADDR || mCode == BC_CALL_ABS)
+		if (mCode == BC_JSR || mCode == BC_CALL_ADDR || mCode == BC_CALL_ABS || mCode == BC_JUMP_TABLE)
 			return true;
 
 		if (mCode == BC_BINOP_DIVR_I16 || mCode == BC_BINOP_DIVR_U16 || mCode == BC_BINOP_MODR_I16 || mCode == BC_BINOP_MODR_U16 ||
@@ -1162,6 +1167,27 @@ void ByteCodeInstruction::Assemble(ByteCodeGenerator* generator, ByteCodeBasicBl
 		block->PutWord(0);
 	}	break;
 
+	case BC_JUMP_TABLE:
+	{
+		block->PutCode(generator, mCode);
+		block->PutByte(mRegister);
+
+		LinkerReference	rl;
+		rl.mOffset = block->mCode.Size();
+		rl.mFlags = LREF_HIGHBYTE | LREF_LOWBYTE;
+		rl.mRefObject = mLinkerObject;
+		rl.mRefOffset = 0;
+		block->mRelocations.Push(rl);
+
+		block->PutWord(0);
+
+		rl.mOffset = block->mCode.Size();
+		rl.mRefOffset = mValue;
+		block->mRelocations.Push(rl);
+
+		block->PutWord(0);
+	}	break;
+
 	case BC_LOAD_ADDR_8:
 	case BC_LOAD_ADDR_U8:
 	case BC_LOAD_ADDR_16:
@@ -1261,7 +1287,7 @@ void ByteCodeBasicBlock::PutBytes(const uint8* code, int num)
 void ByteCodeBasicBlock::PutCode(ByteCodeGenerator* generator, ByteCode code)
 {
 	PutByte(uint8(code) * 2);
-	generator->mByteCodeUsed[code]++;
+	mByteCodeUsed[code]++;
 }
 
 int ByteCodeBasicBlock::PutBranch(ByteCodeGenerator* generator, ByteCode code, int offset)
@@ -1285,12 +1311,20 @@ ByteCodeBasicBlock::ByteCodeBasicBlock(void)
 {
 	mTrueJump = mFalseJump = NULL;
 	mTrueLink = mFalseLink = NULL;
+	mIndex = 0;
+	mBranch = BC_NOP;
 	mOffset = 0x7fffffff;
+	mSize = 0;
+	mPlaced = false;
+	mVisited = false;
 	mCopied = false;
 	mAssembled = false;
 	mKnownShortBranch = false;
 	mBypassed = false;
 	mExitLive = 0;
+	mJumpTable = nullptr;
+	for (int i = 0; i < 128; i++)
+		mByteCodeUsed[i] = 0;
 }
 
 void ByteCodeBasicBlock::IntConstToAccu(int64 val)
@@ -3092,7 +3126,7 @@ ByteCode ByteCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const
 		cins.mRegisterFinal = ins->mSrc[1].mFinal;
 		mIns.Push(cins);
 	}
-	else if (ins->mSrc[0].mType == IT_INT8)
+	else if (ins->mSrc[0].mType == IT_INT8 || ins->mSrc[0].mType == IT_BOOL)
 	{
 		if (ins->mSrc[1].mTemp < 0)
 		{
@@ -4232,6 +4266,21 @@ void ByteCodeBasicBlock::Compile(InterCodeProcedure* iproc, ByteCodeProcedure* p
 			}
 			return;
 
+		case IC_JUMPI:
+			if (ins->mSrc[0].mTemp >= 0)
+			{
+				ByteCodeInstruction	jins(BC_JUMP_TABLE);
+				jins.mRegister = BC_REG_TMP + iproc->mTempOffset[ins->mSrc[0].mTemp];
+				jins.mRegisterFinal = ins->mSrc[0].mFinal;
+				jins.mLinkerObject = ins->mConst.mLinkerObject;
+				jins.mValue = ins->mConst.mLinkerObject->mSize / 2;
+				mIns.Push(jins);
+
+				mJumpTable = ins->mConst.mLinkerObject;
+			}
+
+			this->Close(proc->CompileBlock(iproc, sblock->mTrueJump), proc->CompileBlock(iproc, sblock->mFalseJump), BC_JUMP_TABLE);
+			return;
 		}
 
 		i++;
@@ -4306,7 +4355,7 @@ bool ByteCodeBasicBlock::JoinTailCodeSequences(void)
 			}
 		}
 
-		if (mTrueJump && mFalseJump && mTrueJump->mEntryBlocks.Size() == 1 && mFalseJump->mEntryBlocks.Size() == 1)
+		if (mTrueJump && mFalseJump && mBranch != BC_JUMP_TABLE && mTrueJump->mEntryBlocks.Size() == 1 && mFalseJump->mEntryBlocks.Size() == 1)
 		{
 			while (mTrueJump->mIns.Size() > 0 && mFalseJump->mIns.Size() > 0 && !mTrueJump->mIns[0].ChangesAccu() && mTrueJump->mIns[0].IsSame(mFalseJump->mIns[0]))
 			{
@@ -5505,6 +5554,14 @@ ByteCodeBasicBlock* ByteCodeBasicBlock::BypassEmptyBlocks(void)
 		if (mTrueJump)
 			mTrueJump = mTrueJump->BypassEmptyBlocks();
 
+		if (mFalseJump && mFalseJump == mTrueJump && mBranch != BC_JUMP_TABLE)
+		{
+			// Both branch targets collapsed into the same block
+
+			mFalseJump = nullptr;
+			mBranch = BC_JUMPS;
+		}
+
 		return this;
 	}
 }
@@ -5520,6 +5577,12 @@ void ByteCodeBasicBlock::CopyCode(ByteCodeGenerator* generator, LinkerObject* li
 	{
 		mCopied = true;
 
+		if (mSize > 0)
+		{
+			linkerObject->mBlockOffsets.Push(mOffset);
+			linkerObject->mBlockLocations.Push(mLocation);
+		}
+
 		for (int i = 0; i < mRelocations.Size(); i++)
 		{
 			LinkerReference	rl = mRelocations[i];
@@ -5531,7 +5594,35 @@ void ByteCodeBasicBlock::CopyCode(ByteCodeGenerator* generator, LinkerObject* li
 		end = mOffset + mCode.Size();
 		next = mOffset + mSize;
 
-		if (mFalseJump)
+		if (mBranch == BC_JUMP_TABLE)
+		{
+			if (mJumpTable && mJumpTable->mReferences.Size() == 0)
+			{
+				// Resolve the table entries to the now placed case blocks
+
+				int	size = mJumpTable->mSize / 2;
+				for (int i = 0; i < size; i++)
+				{
+					ByteCodeBasicBlock* block = this;
+					for (int j = 0; j < mJumpTable->mData[i]; j++)
+						block = block->mFalseJump;
+					block = block->mTrueJump;
+
+					LinkerReference		rl;
+					rl.mObject = mJumpTable;
+					rl.mRefObject = linkerObject;
+					rl.mRefOffset = block->mOffset;
+					rl.mOffset = i;
+					rl.mFlags = LREF_LOWBYTE;
+					mJumpTable->AddReference(rl);
+
+					rl.mOffset = i + size;
+					rl.mFlags = LREF_HIGHBYTE;
+					mJumpTable->AddReference(rl);
+				}
+			}
+		}
+		else if (mFalseJump)
 		{
 			if (mFalseJump->mOffset <= mOffset)
 			{
@@ -5580,7 +5671,17 @@ void ByteCodeBasicBlock::CalculateOffset(int& total)
 		mOffset = total;
 		next = total + mCode.Size();
 
-		if (mFalseJump)
+		if (mBranch == BC_JUMP_TABLE)
+		{
+			// Dispatch through a jump table, the successors only need to be placed
+
+			total = next;
+			mSize = total - mOffset;
+
+			mTrueJump->CalculateOffset(total);
+			mFalseJump->CalculateOffset(total);
+		}
+		else if (mFalseJump)
 		{
 			if (mFalseJump->mOffset <= total)
 			{
@@ -5719,12 +5820,15 @@ void ByteCodeBasicBlock::CalculateOffset(int& total)
 }
 
 ByteCodeProcedure::ByteCodeProcedure(void)
-	: mBlocks(nullptr)
+	: tblocks(nullptr), mBlocks(nullptr)
 {
 }
 
 ByteCodeProcedure::~ByteCodeProcedure(void)
 {
+	for (int i = 0; i < mBlocks.Size(); i++)
+		delete mBlocks[i];
+	delete[] tblocks;
 }
 
 
@@ -5742,6 +5846,7 @@ void ByteCodeProcedure::Compile(ByteCodeGenerator* generator, InterCodeProcedure
 	int		tempSave = proc->mTempSize > 16 ? proc->mTempSize - 16 : 0;
 
 	entryBlock = new ByteCodeBasicBlock();
+	entryBlock->mLocation = proc->mBlocks[0]->mLocation;
 	mBlocks.Push(entryBlock);
 	entryBlock->PutCode(generator, BC_ENTER); entryBlock->PutWord(proc->mLocalSize + 2 + tempSave); entryBlock->PutByte(tempSave);
 
@@ -5814,6 +5919,14 @@ void ByteCodeProcedure::Compile(ByteCodeGenerator* generator, InterCodeProcedure
 
 	lentryBlock->CopyCode(generator, proc->mLinkerObject, data);
 	mProgSize = total; 
+
+	for (int i = 0; i < 128; i++)
+	{
+		mByteCodeUsed[i] = 0;
+		for (int j = 0; j < mBlocks.Size(); j++)
+			mByteCodeUsed[i] += mBlocks[j]->mByteCodeUsed[i];
+		generator->mByteCodeUsed[i] += mByteCodeUsed[i];
+	}
 }
 
 ByteCodeBasicBlock* ByteCodeProcedure::CompileBlock(InterCodeProcedure* iproc, InterCodeBasicBlock* sblock)
@@ -5824,6 +5937,7 @@ ByteCodeBasicBlock* ByteCodeProcedure::CompileBlock(InterCodeProcedure* iproc, I
 	ByteCodeBasicBlock	*	block = new ByteCodeBasicBlock();
 	mBlocks.Push(block);
 	tblocks[sblock->mIndex] = block;
+	block->mLocation = sblock->mLocation;
 	block->Compile(iproc, this, sblock);
 	
 	return block;
@@ -5866,7 +5980,7 @@ bool ByteCodeGenerator::WriteByteCodeStats(const char* filename)
 		for (int i = 0; i < 128; i++)
 		{
 			if (mByteCodeUsed[i] > 0)
-				fprintf(file, "BC %s : %d\n", ByteCodeNames[i], mByteCodeUsed[i]);
+				fprintf(file, "BC %s : %d\n", ByteCodeNames[i], int(mByteCodeUsed[i]));
 		}
 		fclose(file);
 
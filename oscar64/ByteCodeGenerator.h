@@ -3,6 +3,7 @@
 #include "InterCode.h"
 #include "Ident.h"
 #include "Disassembler.h"
+#include <atomic>
 
 enum ByteCode
 {
@@ -149,6 +150,7 @@ enum ByteCode
 	BC_SET_LE,
 
 	BC_JSR,
+	BC_JUMP_TABLE,
 
 	BC_NATIVE = 0x75,
 
@@ -238,6 +240,7 @@ class ByteCodeBasicBlock
 public:
 	DynamicArray<uint8>					mCode;
 	int									mIndex;
+	Location							mLocation;
 
 	ByteCodeBasicBlock				*	mTrueJump, * mFalseJump;
 	ByteCodeBasicBlock				*	mTrueLink, * mFalseLink;
@@ -250,6 +253,8 @@ public:
 	int						mOffset, mSize;
 	bool					mPlaced, mCopied, mKnownShortBranch, mBypassed, mAssembled, mVisited;
 	uint32					mExitLive;
+	LinkerObject		*	mJumpTable;
+	uint16					mByteCodeUsed[128];
 
 	ByteCodeBasicBlock(void);
 
@@ -317,6 +322,7 @@ public:
 	GrowingArray < ByteCodeBasicBlock*>	 mBlocks;
 
 	int		mProgSize, mID, mNumBlocks;
+	uint32	mByteCodeUsed[128];
 
 	void Compile(ByteCodeGenerator* generator, InterCodeProcedure* proc);
 	ByteCodeBasicBlock * CompileBlock(InterCodeProcedure* iproc, InterCodeBasicBlock* block);
@@ -336,7 +342,7 @@ public:
 	Errors* mErrors;
 	Linker* mLinker;
 
-	uint32	mByteCodeUsed[128];
+	std::atomic<uint32>	mByteCodeUsed[128];
 	LinkerObject* mExtByteCodes[128];
 
 	bool WriteByteCodeStats(const char* filename);
@@ -0,0 +1,674 @@
+#include "CodeCache.h"
+#include "InterCode.h"
+#include "ByteCodeGenerator.h"
+#include "NativeCodeGenerator.h"
+#include <string.h>
+
+static const char CodeCacheMagic[] = "oscar64 code cache 1";
+
+// Entries not used by the current program are only kept up to this limit
+
+static const int CodeCacheLimit = 65536;
+
+static void WriteInt(FILE* file, int64 i)
+{
+	fwrite(&i, sizeof(i), 1, file);
+}
+
+static void WriteString(FILE* file, const char* str)
+{
+	int	n = str ? (int)strlen(str) : -1;
+	WriteInt(file, n);
+	if (n > 0)
+		fwrite(str, 1, n, file);
+}
+
+static bool ReadInt(FILE* file, int64& i)
+{
+	return fread(&i, sizeof(i), 1, file) == 1;
+}
+
+static bool ReadInt(FILE* file, int& i)
+{
+	int64	l;
+	if (ReadInt(file, l) && l >= -1 && l < 0x1000000)
+	{
+		i = int(l);
+		return true;
+	}
+	else
+		return false;
+}
+
+static bool ReadString(FILE* file, const char*& str)
+{
+	int	n;
+	if (!ReadInt(file, n) || n >= 65536)
+		return false;
+
+	if (n < 0)
+		str = nullptr;
+	else
+	{
+		char* s = new char[n + 1];
+		if (fread(s, 1, n, file) != size_t(n))
+		{
+			delete[] s;
+			return false;
+		}
+		s[n] = 0;
+		str = s;
+	}
+
+	return true;
+}
+
+template<class T>
+static void WriteArray(FILE* file, GrowingArray<T>& a)
+{
+	WriteInt(file, a.Size());
+	if (a.Size() > 0)
+		fwrite(&a[0], sizeof(T), a.Size(), file);
+}
+
+template<class T>
+static bool ReadArray(FILE* file, GrowingArray<T>& a)
+{
+	int	n;
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	a.SetSize(n);
+	return n == 0 || fread(&a[0], sizeof(T), n, file) == size_t(n);
+}
+
+static inline void HashBytes(uint64& h, const void* data, int size)
+{
+	const uint8* p = (const uint8*)data;
+	for (int i = 0; i < size; i++)
+		h = (h ^ p[i]) * 0x100000001b3ULL;
+}
+
+static inline void HashInt(uint64& h, int64 i)
+{
+	HashBytes(h, &i, sizeof(i));
+}
+
+static void HashString(uint64& h, const char* str)
+{
+	if (str)
+		HashBytes(h, str, (int)strlen(str) + 1);
+	else
+		HashInt(h, -1);
+}
+
+static void HashLocation(uint64& h, const Location& loc)
+{
+	HashString(h, loc.mFileName);
+	HashInt(h, loc.mLine);
+	HashInt(h, loc.mColumn);
+}
+
+static int ObjectIndex(CodeCacheKey& key, LinkerObject* obj)
+{
+	if (!obj)
+		return -1;
+
+	int	i = key.mObjects.IndexOf(obj);
+	if (i < 0)
+	{
+		i = key.mObjects.Size();
+		key.mObjects.Push(obj);
+	}
+	return i;
+}
+
+static void HashOperand(uint64& h, CodeCacheKey& key, const InterOperand& op)
+{
+	HashInt(h, op.mIntConst);
+	HashBytes(h, &op.mFloatConst, sizeof(op.mFloatConst));
+	HashInt(h, ObjectIndex(key, op.mLinkerObject));
+	HashInt(h, op.mTemp);
+	HashInt(h, op.mVarIndex);
+	HashInt(h, op.mOperandSize);
+	HashInt(h, op.mType);
+	HashInt(h, op.mMemory);
+	HashInt(h, op.mFinal);
+}
+
+CodeCacheEntry::CodeCacheEntry(void)
+	: mHash(0), mType(LOT_NONE), mFlags(0), mUsed(false), mData(0), mReferences({ 0 }), mBlockOffsets(0), mBlockLocations(Location()),
+	  mTempSize(0), mTempOffset(0), mTempSizes(0)
+{
+	for (int i = 0; i < 128; i++)
+		mByteCodeUsed[i] = 0;
+}
+
+CodeCacheEntry::~CodeCacheEntry(void)
+{
+}
+
+void CodeCacheEntry::Write(FILE* file)
+{
+	WriteInt(file, mHash);
+	WriteInt(file, mType);
+	WriteInt(file, mFlags);
+	WriteArray(file, mData);
+	WriteArray(file, mReferences);
+	WriteArray(file, mBlockOffsets);
+
+	WriteInt(file, mBlockLocations.Size());
+	for (int i = 0; i < mBlockLocations.Size(); i++)
+	{
+		WriteString(file, mBlockLocations[i].mFileName);
+		WriteInt(file, mBlockLocations[i].mLine);
+		WriteInt(file, mBlockLocations[i].mColumn);
+	}
+
+	WriteInt(file, mTempSize);
+	WriteArray(file, mTempOffset);
+	WriteArray(file, mTempSizes);
+
+	fwrite(mByteCodeUsed, sizeof(uint32), 128, file);
+}
+
+bool CodeCacheEntry::Read(FILE* file)
+{
+	int64	hash, type, flags;
+	if (!ReadInt(file, hash) || !ReadInt(file, type) || !ReadInt(file, flags))
+		return false;
+	if (type != LOT_BYTE_CODE && type != LOT_NATIVE_CODE)
+		return false;
+
+	mHash = hash;
+	mType = LinkerObjectType(type);
+	mFlags = uint32(flags);
+
+	if (!ReadArray(file, mData) || !ReadArray(file, mReferences) || !ReadArray(file, mBlockOffsets))
+		return false;
+
+	int	n;
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	for (int i = 0; i < n; i++)
+	{
+		Location	loc;
+		if (!ReadString(file, loc.mFileName) || !ReadInt(file, loc.mLine) || !ReadInt(file, loc.mColumn))
+			return false;
+		mBlockLocations.Push(loc);
+	}
+
+	if (mBlockLocations.Size() != mBlockOffsets.Size())
+		return false;
+
+	if (!ReadInt(file, mTempSize) || !ReadArray(file, mTempOffset) || !ReadArray(file, mTempSizes))
+		return false;
+
+	if (fread(mByteCodeUsed, sizeof(uint32), 128, file) != 128)
+		return false;
+
+	for (int i = 0; i < mReferences.Size(); i++)
+	{
+		const CodeCacheReference& ref(mReferences[i]);
+		if (ref.mOffset < 0 || ref.mOffset >= mData.Size() || ref.mObject < 0)
+			return false;
+	}
+
+	return true;
+}
+
+CodeCacheKey::CodeCacheKey(void)
+	: mHash(0), mValid(false), mObjects(nullptr)
+{
+}
+
+CodeCache::CodeCache(ByteCodeGenerator* byteCodeGenerator, NativeCodeGenerator* nativeCodeGenerator, const char* version)
+	: mHits(0), mMisses(0), mByteCodeGenerator(byteCodeGenerator), mNativeCodeGenerator(nativeCodeGenerator), mOptions(0), mChanged(false),
+	  mEntries(nullptr), mHash(nullptr), mHashSize(0)
+{
+	int	n = (int)strlen(version);
+	mVersion = new char[n + 1];
+	strcpy_s(mVersion, n + 1, version);
+}
+
+CodeCache::~CodeCache(void)
+{
+	for (int i = 0; i < mEntries.Size(); i++)
+		delete mEntries[i];
+	delete[] mHash;
+	delete[] mVersion;
+}
+
+void CodeCache::Prepare(uint64 compilerOptions)
+{
+	mOptions = 0xcbf29ce484222325ULL;
+	HashString(mOptions, mVersion);
+	HashInt(mOptions, compilerOptions);
+
+	for (int i = 0; i < mNativeCodeGenerator->mRuntime.Size(); i++)
+	{
+		const NativeCodeGenerator::Runtime& rt(mNativeCodeGenerator->mRuntime[i]);
+		HashString(mOptions, rt.mIdent->mString);
+		HashInt(mOptions, rt.mOffset);
+	}
+}
+
+CodeCacheEntry* CodeCache::Find(uint64 hash)
+{
+	if (mHashSize > 0)
+	{
+		int	i = int(hash & (mHashSize - 1));
+		while (mHash[i])
+		{
+			if (mHash[i]->mHash == hash)
+				return mHash[i];
+			i = (i + 1) & (mHashSize - 1);
+		}
+	}
+
+	return nullptr;
+}
+
+void CodeCache::Insert(CodeCacheEntry* entry)
+{
+	mEntries.Push(entry);
+
+	if (2 * mEntries.Size() >= mHashSize)
+	{
+		delete[] mHash;
+
+		mHashSize = mHashSize ? 2 * mHashSize : 1024;
+		mHash = new CodeCacheEntry * [mHashSize];
+		for (int i = 0; i < mHashSize; i++)
+			mHash[i] = nullptr;
+
+		for (int j = 0; j < mEntries.Size(); j++)
+		{
+			int	i = int(mEntries[j]->mHash & (mHashSize - 1));
+			while (mHash[i])
+				i = (i + 1) & (mHashSize - 1);
+			mHash[i] = mEntries[j];
+		}
+	}
+	else
+	{
+		int	i = int(entry->mHash & (mHashSize - 1));
+		while (mHash[i])
+			i = (i + 1) & (mHashSize - 1);
+		mHash[i] = entry;
+	}
+}
+
+bool CodeCache::Read(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "rb");
+	if (!file)
+		return false;
+
+	// A different compiler version invalidates all entries
+
+	const char* magic = nullptr, * version = nullptr;
+	int64		n;
+	bool		ok = false;
+
+	if (ReadString(file, magic) && magic && !strcmp(magic, CodeCacheMagic) &&
+		ReadString(file, version) && version && !strcmp(version, mVersion) && ReadInt(file, n) && n >= 0)
+	{
+		ok = true;
+		for (int i = 0; ok && i < n; i++)
+		{
+			CodeCacheEntry* entry = new CodeCacheEntry();
+			if (entry->Read(file) && !Find(entry->mHash))
+				Insert(entry);
+			else
+			{
+				delete entry;
+				ok = false;
+			}
+		}
+	}
+
+	delete[] magic;
+	delete[] version;
+
+	fclose(file);
+
+	if (!ok)
+	{
+		for (int i = 0; i < mEntries.Size(); i++)
+			delete mEntries[i];
+		mEntries.SetSize(0);
+		for (int i = 0; i < mHashSize; i++)
+			mHash[i] = nullptr;
+	}
+
+	return ok;
+}
+
+bool CodeCache::Write(const char* filename)
+{
+	if (!mChanged)
+		return true;
+
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (!file)
+		return false;
+
+	// Entries of the current program first, then older ones up to the limit
+
+	GrowingArray<CodeCacheEntry*>	entries(nullptr);
+	for (int i = 0; i < mEntries.Size(); i++)
+		if (mEntries[i]->mUsed)
+			entries.Push(mEntries[i]);
+	for (int i = 0; i < mEntries.Size() && entries.Size() < CodeCacheLimit; i++)
+		if (!mEntries[i]->mUsed)
+			entries.Push(mEntries[i]);
+
+	WriteString(file, CodeCacheMagic);
+	WriteString(file, mVersion);
+	WriteInt(file, entries.Size());
+	for (int i = 0; i < entries.Size(); i++)
+		entries[i]->Write(file);
+
+	bool	ok = !ferror(file);
+	fclose(file);
+
+	mChanged = false;
+
+	return ok;
+}
+
+void CodeCache::BuildKey(InterCodeProcedure* proc, CodeCacheKey& key)
+{
+	uint64	h = mOptions;
+
+	key.mValid = true;
+	key.mObjects.SetSize(0);
+	key.mObjects.Push(proc->mLinkerObject);
+
+	HashInt(h, proc->mNativeProcedure);
+	HashInt(h, proc->mLeafProcedure);
+	HashInt(h, proc->mCallsFunctionPointer);
+	HashInt(h, proc->mHasDynamicStack);
+	HashInt(h, proc->mHasInlineAssembler);
+	HashInt(h, proc->mCallsByteCode);
+	HashInt(h, proc->mFastCallProcedure);
+	HashInt(h, proc->mStaticTemps);
+	HashInt(h, proc->mTempBase);
+	HashInt(h, proc->mTempSize);
+	HashInt(h, proc->mCommonFrameSize);
+	HashInt(h, proc->mCallerSavedTemps);
+	HashInt(h, proc->mLocalSize);
+
+	HashInt(h, proc->mTemporaries.Size());
+	for (int i = 0; i < proc->mTemporaries.Size(); i++)
+		HashInt(h, proc->mTemporaries[i]);
+	HashInt(h, proc->mTempOffset.Size());
+	for (int i = 0; i < proc->mTempOffset.Size(); i++)
+		HashInt(h, proc->mTempOffset[i]);
+	HashInt(h, proc->mTempSizes.Size());
+	for (int i = 0; i < proc->mTempSizes.Size(); i++)
+		HashInt(h, proc->mTempSizes[i]);
+
+	HashInt(h, proc->mLocalVars.Size());
+	for (int i = 0; i < proc->mLocalVars.Size(); i++)
+	{
+		const InterVariable* var = proc->mLocalVars[i];
+		if (var)
+		{
+			HashInt(h, var->mOffset);
+			HashInt(h, var->mSize);
+			HashInt(h, var->mAliased);
+		}
+		else
+			HashInt(h, -1);
+	}
+
+	HashInt(h, proc->mBlocks.Size());
+	for (int i = 0; i < proc->mBlocks.Size(); i++)
+	{
+		const InterCodeBasicBlock* block = proc->mBlocks[i];
+		if (!block)
+		{
+			HashInt(h, -1);
+			continue;
+		}
+
+		HashInt(h, block->mIndex);
+		HashInt(h, block->mTrueJump ? block->mTrueJump->mIndex : -1);
+		HashInt(h, block->mFalseJump ? block->mFalseJump->mIndex : -1);
+		HashLocation(h, block->mLocation);
+
+		HashInt(h, block->mInstructions.Size());
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			const InterInstruction* ins = block->mInstructions[j];
+			if (!ins)
+			{
+				HashInt(h, -1);
+				continue;
+			}
+
+			// Inline assembler and jump tables are completed by the code generator
+			// of the procedure, so the procedure changes other linker objects
+
+			if (ins->mCode == IC_ASSEMBLER || ins->mCode == IC_JUMPI)
+				key.mValid = false;
+
+			HashInt(h, ins->mCode);
+			HashInt(h, ins->mOperator);
+			HashInt(h, ins->mNumOperands);
+			HashInt(h, ins->mInUse);
+			HashInt(h, ins->mInvariant);
+			HashInt(h, ins->mVolatile);
+			HashLocation(h, ins->mLocation);
+			HashOperand(h, key, ins->mDst);
+			HashOperand(h, key, ins->mConst);
+			for (int k = 0; k < ins->mNumOperands; k++)
+				HashOperand(h, key, ins->mSrc[k]);
+		}
+	}
+
+	// Objects the generated code may refer to, without being named in the
+	// intermediate code
+
+	for (int i = 0; i < mNativeCodeGenerator->mRuntime.Size(); i++)
+		ObjectIndex(key, mNativeCodeGenerator->mRuntime[i].mLinkerObject);
+	for (int i = 0; i < 128; i++)
+		ObjectIndex(key, mByteCodeGenerator->mExtByteCodes[i]);
+
+	for (int i = 0; i < key.mObjects.Size(); i++)
+	{
+		LinkerObject* obj = key.mObjects[i];
+		if (obj->mFlags & LOBJF_INLINE)
+		{
+			for (int j = 0; j < obj->mReferences.Size(); j++)
+				ObjectIndex(key, obj->mReferences[j]->mRefObject);
+		}
+	}
+
+	// Properties of the objects the code generator uses, the type and size of
+	// a procedure change while the procedures are compiled
+
+	HashInt(h, key.mObjects.Size());
+	for (int i = 0; i < key.mObjects.Size(); i++)
+	{
+		LinkerObject* obj = key.mObjects[i];
+
+		HashInt(h, obj->mFlags & (LOBJF_INLINE | LOBJF_CONST));
+		if (obj->mProc)
+			HashInt(h, -1);
+		else
+		{
+			HashInt(h, obj->mType);
+			HashInt(h, obj->mSize);
+		}
+
+		HashInt(h, obj->mNumTemporaries);
+		for (int j = 0; j < obj->mNumTemporaries; j++)
+		{
+			HashInt(h, obj->mTemporaries[j]);
+			HashInt(h, obj->mTempSizes[j]);
+		}
+
+		if (obj->mFlags & LOBJF_INLINE)
+		{
+			HashBytes(h, obj->mData, obj->mSize);
+			HashInt(h, obj->mReferences.Size());
+			for (int j = 0; j < obj->mReferences.Size(); j++)
+			{
+				const LinkerReference* ref = obj->mReferences[j];
+				HashInt(h, ref->mOffset);
+				HashInt(h, ref->mRefOffset);
+				HashInt(h, ref->mFlags);
+				HashInt(h, key.mObjects.IndexOf(ref->mObject));
+				HashInt(h, key.mObjects.IndexOf(ref->mRefObject));
+			}
+		}
+	}
+
+	key.mHash = h;
+}
+
+bool CodeCache::Restore(InterCodeProcedure* proc, CodeCacheKey& key)
+{
+	BuildKey(proc, key);
+
+	CodeCacheEntry* entry = nullptr;
+	if (key.mValid)
+	{
+		std::lock_guard<std::mutex>	lock(mMutex);
+
+		entry = Find(key.mHash);
+		if (entry)
+			entry->mUsed = true;
+	}
+
+	if (entry)
+	{
+		for (int i = 0; i < entry->mReferences.Size(); i++)
+		{
+			if (entry->mReferences[i].mObject >= key.mObjects.Size())
+				entry = nullptr;
+		}
+	}
+
+	if (!entry)
+	{
+		mMisses++;
+		return false;
+	}
+
+	LinkerObject* lobj = proc->mLinkerObject;
+
+	lobj->mType = entry->mType;
+	proc->mLinkerFlags |= entry->mFlags;
+
+	uint8* data = lobj->AddSpace(entry->mData.Size());
+	if (entry->mData.Size() > 0)
+		memcpy(data, &entry->mData[0], entry->mData.Size());
+
+	for (int i = 0; i < entry->mReferences.Size(); i++)
+	{
+		const CodeCacheReference& ref(entry->mReferences[i]);
+
+		LinkerReference	rl;
+		rl.mObject = lobj;
+		rl.mOffset = ref.mOffset;
+		rl.mRefObject = key.mObjects[ref.mObject];
+		rl.mRefOffset = ref.mRefOffset;
+		rl.mFlags = ref.mFlags;
+		lobj->AddReference(rl);
+	}
+
+	for (int i = 0; i < entry->mBlockOffsets.Size(); i++)
+	{
+		lobj->mBlockOffsets.Push(entry->mBlockOffsets[i]);
+		lobj->mBlockLocations.Push(entry->mBlockLocations[i]);
+	}
+
+	// The native code generator compresses the temporaries of the procedure
+
+	proc->mTempSize = entry->mTempSize;
+	for (int i = 0; i < entry->mTempOffset.Size(); i++)
+		proc->mTempOffset[i] = entry->mTempOffset[i];
+	for (int i = 0; i < entry->mTempSizes.Size(); i++)
+		proc->mTempSizes[i] = entry->mTempSizes[i];
+
+	for (int i = 0; i < 128; i++)
+		mByteCodeGenerator->mByteCodeUsed[i] += entry->mByteCodeUsed[i];
+
+	mHits++;
+
+	return true;
+}
+
+void CodeCache::Store(InterCodeProcedure* proc, const CodeCacheKey& key, const uint32* byteCodeUsed)
+{
+	if (!key.mValid)
+		return;
+
+	LinkerObject* lobj = proc->mLinkerObject;
+
+	CodeCacheEntry* entry = new CodeCacheEntry();
+	entry->mHash = key.mHash;
+	entry->mType = lobj->mType;
+	entry->mFlags = proc->mLinkerFlags & LOBJF_NO_FRAME;
+	entry->mUsed = true;
+
+	entry->mData.SetSize(lobj->mSize);
+	if (lobj->mSize > 0)
+		memcpy(&entry->mData[0], lobj->mData, lobj->mSize);
+
+	for (int i = 0; i < lobj->mReferences.Size(); i++)
+	{
+		const LinkerReference* rl = lobj->mReferences[i];
+
+		CodeCacheReference	ref;
+		ref.mOffset = rl->mOffset;
+		ref.mObject = key.mObjects.Size() - 1;
+		while (ref.mObject >= 0 && key.mObjects[ref.mObject] != rl->mRefObject)
+			ref.mObject--;
+		ref.mRefOffset = rl->mRefOffset;
+		ref.mFlags = rl->mFlags;
+
+		// The code refers to an object that is not part of the key
+
+		if (rl->mObject != lobj || ref.mObject < 0)
+		{
+			delete entry;
+			return;
+		}
+
+		entry->mReferences.Push(ref);
+	}
+
+	for (int i = 0; i < lobj->mBlockOffsets.Size(); i++)
+	{
+		entry->mBlockOffsets.Push(lobj->mBlockOffsets[i]);
+		entry->mBlockLocations.Push(lobj->mBlockLocations[i]);
+	}
+
+	entry->mTempSize = proc->mTempSize;
+	for (int i = 0; i < proc->mTempOffset.Size(); i++)
+		entry->mTempOffset.Push(proc->mTempOffset[i]);
+	for (int i = 0; i < proc->mTempSizes.Size(); i++)
+		entry->mTempSizes.Push(proc->mTempSizes[i]);
+
+	if (byteCodeUsed)
+	{
+		for (int i = 0; i < 128; i++)
+			entry->mByteCodeUsed[i] = byteCodeUsed[i];
+	}
+
+	std::lock_guard<std::mutex>	lock(mMutex);
+
+	if (Find(entry->mHash))
+		delete entry;
+	else
+	{
+		Insert(entry);
+		mChanged = true;
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Linker.h"
+#include "Array.h"
+#include "MachineTypes.h"
+#include <mutex>
+#include <atomic>
+
+class InterCodeProcedure;
+class ByteCodeGenerator;
+class NativeCodeGenerator;
+
+// Persistent cache of the generated code of procedures.  The key is a hash
+// of the final intermediate code of a procedure, the properties of the
+// linker objects it references and the compiler options.  Linker objects are
+// hashed by their position in the procedure, not by name, so a procedure that
+// did not change reuses its code even if its callees moved.
+
+struct CodeCacheReference
+{
+	int		mOffset, mObject, mRefOffset;
+	uint32	mFlags;
+};
+
+class CodeCacheEntry
+{
+public:
+	CodeCacheEntry(void);
+	~CodeCacheEntry(void);
+
+	uint64								mHash;
+	LinkerObjectType					mType;
+	uint32								mFlags;
+	bool								mUsed;
+
+	GrowingArray<uint8>					mData;
+	GrowingArray<CodeCacheReference>	mReferences;
+	GrowingArray<int>					mBlockOffsets;
+	GrowingArray<Location>				mBlockLocations;
+
+	int									mTempSize;
+	GrowingArray<int>					mTempOffset, mTempSizes;
+
+	uint32								mByteCodeUsed[128];
+
+	bool Read(FILE* file);
+	void Write(FILE* file);
+};
+
+class CodeCacheKey
+{
+public:
+	CodeCacheKey(void);
+
+	uint64							mHash;
+	bool							mValid;
+
+	// Linker objects referenced by the procedure, the procedure itself first
+
+	GrowingArray<LinkerObject*>		mObjects;
+};
+
+class CodeCache
+{
+public:
+	CodeCache(ByteCodeGenerator* byteCodeGenerator, NativeCodeGenerator* nativeCodeGenerator, const char* version);
+	~CodeCache(void);
+
+	std::atomic<int>	mHits, mMisses;
+
+	// Hash the options that apply to all procedures, after the runtime was registered
+
+	void Prepare(uint64 compilerOptions);
+
+	bool Read(const char* filename);
+	bool Write(const char* filename);
+
+	// Build the key of the procedure and restore its code on a hit
+
+	bool Restore(InterCodeProcedure* proc, CodeCacheKey& key);
+
+	// Remember the code of a compiled procedure, byteCodeUsed counts the byte codes of a
+	// byte code procedure
+
+	void Store(InterCodeProcedure* proc, const CodeCacheKey& key, const uint32* byteCodeUsed);
+protected:
+	ByteCodeGenerator		*	mByteCodeGenerator;
+	NativeCodeGenerator		*	mNativeCodeGenerator;
+	uint64						mOptions;
+	char					*	mVersion;
+	bool						mChanged;
+
+	GrowingArray<CodeCacheEntry*>	mEntries;
+	CodeCacheEntry			**	mHash;
+	int							mHashSize;
+
+	std::mutex					mMutex;
+
+	void BuildKey(InterCodeProcedure* proc, CodeCacheKey& key);
+	void Insert(CodeCacheEntry* entry);
+	CodeCacheEntry* Find(uint64 hash);
+};
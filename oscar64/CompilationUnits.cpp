@@ -22,10 +22,15 @@ CompilationUnits::CompilationUnits(Errors * errors)
 
 CompilationUnits::~CompilationUnits(void)
 {
-
+	while (mCompilationUnits)
+	{
+		CompilationUnit* cunit = mCompilationUnits;
+		mCompilationUnits = cunit->mNext;
+		delete cunit;
+	}
 }
 
-bool CompilationUnits::AddUnit(Location& location, const char* name, const char* from)
+bool CompilationUnits::AddUnit(Location& location, const char* name, const char* from, bool prelude)
 {
 	char	filename[200];
 
@@ -77,6 +82,7 @@ bool CompilationUnits::AddUnit(Location& location, const char* name, const char*
 	cunit->mLocation = location;
 	strcpy_s(cunit->mFileName, filename);
 	cunit->mCompiled = false;
+	cunit->mPrelude = prelude;
 	cunit->mNext = nullptr;
 
 	if (punit)
@@ -10,7 +10,7 @@ public:
 	Location			mLocation;
 	char				mFileName[200];
 	CompilationUnit	*	mNext;
-	bool				mCompiled;
+	bool				mCompiled, mPrelude;
 };
 
 class CompilationUnits
@@ -30,7 +30,7 @@ public:
 	LinkerSection* mSectionCode, * mSectionData, * mSectionBSS, * mSectionHeap, * mSectionStack;
 	Linker* mLinker;
 
-	bool AddUnit(Location & location, const char* name, const char * from);
+	bool AddUnit(Location & location, const char* name, const char * from, bool prelude);
 	CompilationUnit* PendingUnit(void);
 protected:
 	Errors* mErrors;
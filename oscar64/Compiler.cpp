@@ -7,9 +7,11 @@
 #include "NativeCodeGenerator.h"
 #include "Emulator.h"
 #include <stdio.h>
+#include <thread>
+#include <atomic>
 
 Compiler::Compiler(void)
-	: mByteCodeFunctions(nullptr), mCompilerOptions(COPT_DEFAULT), mDefines({nullptr, nullptr})
+	: mByteCodeFunctions(nullptr), mParsers(nullptr), mCompilerOptions(COPT_DEFAULT), mThreadCount(1), mLazyParse(false), mProfile(nullptr), mProfilePath(nullptr), mCallgrindPath(nullptr), mPassReportPath(nullptr), mPrelude(nullptr), mPreludePath(nullptr), mCodeCache(nullptr), mCodeCachePath(nullptr), mDefines({nullptr, nullptr})
 {
 	mErrors = new Errors();
 	mLinker = new Linker(mErrors);
@@ -20,6 +22,9 @@ Compiler::Compiler(void)
 	mNativeCodeGenerator = new NativeCodeGenerator(mErrors, mLinker);
 	mInterCodeModule = new InterCodeModule();
 	mGlobalAnalyzer = new GlobalAnalyzer(mErrors, mLinker);
+	mPassManager = new PassManager();
+
+	mInterCodeModule->mPassManager = mPassManager;
 
 	mCompilationUnits->mLinker = mLinker;
 
@@ -33,36 +38,144 @@ Compiler::Compiler(void)
 
 Compiler::~Compiler(void)
 {
-
+	for (int i = 0; i < mByteCodeFunctions.Size(); i++)
+		delete mByteCodeFunctions[i];
+
+	for (int i = 0; i < mParsers.Size(); i++)
+		delete mParsers[i];
+
+	for (int i = 0; i < mDefines.Size(); i++)
+		free((char*)mDefines[i].mValue);
+
+	delete mCodeCache;
+	delete mProfile;
+	delete mPassManager;
+	delete mGlobalAnalyzer;
+	delete mInterCodeModule;
+	delete mNativeCodeGenerator;
+	delete mInterCodeGenerator;
+	delete mByteCodeGenerator;
+	delete mPreprocessor;
+	delete mCompilationUnits;
+	delete mLinker;
+	delete mErrors;
 }
 
 void Compiler::AddDefine(const Ident* ident, const char* value)
 {
 	Define	define;
 	define.mIdent = ident;
-	define.mValue = value;
+	define.mValue = _strdup(value);
 	mDefines.Push(define);
 }
 
 
+void Compiler::LoadPrelude(const char* filename, const char* version, Prelude* warm)
+{
+	// The token streams depend on the compiler, the defines and the include paths
+
+	int	size = (int)strlen(version) + 2;
+	for (int i = 0; i < mDefines.Size(); i++)
+		size += (int)strlen(mDefines[i].mIdent->mString) + (int)strlen(mDefines[i].mValue) + 2;
+	for (SourcePath* path = mPreprocessor->mPaths; path; path = path->mNext)
+		size += (int)strlen(path->mPathName) + 1;
+
+	char* key = new char[size];
+	strcpy_s(key, size, version);
+	for (int i = 0; i < mDefines.Size(); i++)
+	{
+		strcat_s(key, size, " ");
+		strcat_s(key, size, mDefines[i].mIdent->mString);
+		strcat_s(key, size, "=");
+		strcat_s(key, size, mDefines[i].mValue);
+	}
+	strcat_s(key, size, ";");
+	for (SourcePath* path = mPreprocessor->mPaths; path; path = path->mNext)
+	{
+		strcat_s(key, size, path->mPathName);
+		strcat_s(key, size, ";");
+	}
+
+	if (warm && warm->HasKey(key))
+		mPrelude = warm;
+	else
+	{
+		mPrelude = new Prelude();
+		mPrelude->Read(filename, key);
+	}
+	mPreludePath = filename;
+
+	delete[] key;
+}
+
+void Compiler::LoadCodeCache(const char* filename, const char* version)
+{
+	// Disabled passes and bisecting change the code without changing the key
+
+	if (mPassManager->Unrestricted())
+	{
+		mCodeCache = new CodeCache(mByteCodeGenerator, mNativeCodeGenerator, version);
+		mCodeCache->Read(filename);
+		mCodeCachePath = filename;
+	}
+}
+
 bool Compiler::ParseSource(void)
 {
 	CompilationUnit* cunit;
 	while (mErrors->mErrorCount == 0 && (cunit = mCompilationUnits->PendingUnit()))
 	{
-		if (mPreprocessor->OpenSource("Compiling", cunit->mFileName, true))
+		PreludeUnit* punit = nullptr;
+		if (mPrelude && cunit->mPrelude)
+			punit = mPrelude->Find(cunit->mFileName);
+
+		if (punit)
 		{
-			Scanner* scanner = new Scanner(mErrors, mPreprocessor);
+			printf("Compiling \"%s\" from prelude\n", cunit->mFileName);
 
-			for (int i = 0; i < mDefines.Size(); i++)
-				scanner->AddMacro(mDefines[i].mIdent, mDefines[i].mValue);
+			Scanner* scanner = new Scanner(mErrors, mPreprocessor, punit);
 
 			Parser* parser = new Parser(mErrors, scanner, mCompilationUnits);
+			parser->mLazyBodies = mLazyParse && cunit->mPrelude;
+			mParsers.Push(parser);
 
 			parser->Parse();
 		}
 		else
-			mErrors->Error(cunit->mLocation, EERR_FILE_NOT_FOUND, "Could not open source file", cunit->mFileName);
+		{
+			SourceFile* sources = mPreprocessor->mSourceList;
+
+			if (mPreprocessor->OpenSource("Compiling", cunit->mFileName, true))
+			{
+				Scanner* scanner = new Scanner(mErrors, mPreprocessor);
+
+				if (mPrelude && cunit->mPrelude)
+				{
+					scanner->mRecord = mPrelude->Add(cunit->mFileName);
+					scanner->mRecord->Record(scanner);
+				}
+
+				for (int i = 0; i < mDefines.Size(); i++)
+					scanner->AddMacro(mDefines[i].mIdent, mDefines[i].mValue);
+
+				Parser* parser = new Parser(mErrors, scanner, mCompilationUnits);
+				parser->mLazyBodies = mLazyParse && cunit->mPrelude;
+				mParsers.Push(parser);
+
+				parser->Parse();
+
+				if (scanner->mRecord)
+					scanner->mRecord->AddFiles(mPreprocessor->mSourceList, sources);
+			}
+			else
+				mErrors->Error(cunit->mLocation, EERR_FILE_NOT_FOUND, "Could not open source file", cunit->mFileName);
+		}
+	}
+
+	if (mPrelude && mPrelude->mChanged && mPreludePath && mErrors->mErrorCount == 0)
+	{
+		if (!mPrelude->Write(mPreludePath))
+			mErrors->Error(Location(), EERR_FILE_NOT_FOUND, "Could not write prelude file", mPreludePath);
 	}
 
 	return mErrors->mErrorCount == 0;
@@ -106,6 +219,99 @@ void Compiler::RegisterRuntime(const Location & loc, const Ident* ident)
 	}
 }
 
+void Compiler::CompileProcedure(InterCodeProcedure* proc, ByteCodeProcedure*& bgproc)
+{
+	// Code created while compiling belongs to the procedure, the workers
+	// have no compiler arena of their own
+
+	MemoryArena::Scope	arenaScope(&proc->mArena);
+
+//	proc->ReduceTemporaries();
+
+#if _DEBUG
+	proc->Disassemble("final");
+#endif
+
+	CodeCacheKey	key;
+	if (mCodeCache && mCodeCache->Restore(proc, key))
+	{
+		bgproc = nullptr;
+		return;
+	}
+
+	if (proc->mNativeProcedure)
+	{
+		NativeCodeProcedure* ncproc = new NativeCodeProcedure(mNativeCodeGenerator);
+		ncproc->Compile(proc);
+		delete ncproc;
+		bgproc = nullptr;
+	}
+	else
+	{
+		bgproc = new ByteCodeProcedure();
+		bgproc->Compile(mByteCodeGenerator, proc);
+	}
+
+	if (mCodeCache)
+		mCodeCache->Store(proc, key, bgproc ? bgproc->mByteCodeUsed : nullptr);
+}
+
+void Compiler::CompileProcedures(void)
+{
+	int	nprocs = mInterCodeModule->mProcedures.Size();
+
+	GrowingArray<ByteCodeProcedure*>	bgprocs(nullptr);
+	bgprocs.SetSize(nprocs);
+
+#if _DEBUG
+	// Debug disassembly is written to a single shared file
+	int	nthreads = 1;
+#else
+	int	nthreads = mThreadCount < nprocs ? mThreadCount : nprocs;
+#endif
+
+	if (nthreads > 1)
+	{
+		//
+		// Each procedure is compiled into its own linker object, so the
+		// procedures are handed out to a pool of workers in any order, while
+		// the results are collected in procedure order below, keeping the
+		// output identical to a serial build
+		//
+		std::atomic<int>	next(0);
+
+		GrowingArray<std::thread*>	workers(nullptr);
+		for (int i = 0; i < nthreads; i++)
+		{
+			workers.Push(new std::thread([this, &next, &bgprocs, nprocs]() {
+				int	i;
+				while ((i = next++) < nprocs)
+					CompileProcedure(mInterCodeModule->mProcedures[i], bgprocs[i]);
+			}));
+		}
+
+		for (int i = 0; i < nthreads; i++)
+		{
+			workers[i]->join();
+			delete workers[i];
+		}
+	}
+	else
+	{
+		for (int i = 0; i < nprocs; i++)
+			CompileProcedure(mInterCodeModule->mProcedures[i], bgprocs[i]);
+	}
+
+	for (int i = 0; i < nprocs; i++)
+	{
+		InterCodeProcedure* proc = mInterCodeModule->mProcedures[i];
+		proc->mLinkerObject->mFlags |= proc->mLinkerFlags;
+
+		if (bgprocs[i])
+			mByteCodeFunctions.Push(bgprocs[i]);
+	}
+}
+
 bool Compiler::GenerateCode(void)
 {
 	Location	loc;
@@ -173,9 +379,12 @@ bool Compiler::GenerateCode(void)
 	dcrtstart->mSection = sectionStartup;
 
 	mGlobalAnalyzer->mCompilerOptions = mCompilerOptions;
+	mGlobalAnalyzer->mProfile = mProfile;
 
 	mGlobalAnalyzer->AnalyzeAssembler(dcrtstart->mValue, nullptr);
 //	mGlobalAnalyzer->DumpCallGraph();
+	if (mProfile)
+		mGlobalAnalyzer->ApplyProfile();
 	mGlobalAnalyzer->AutoInline();
 //	mGlobalAnalyzer->DumpCallGraph();
 
@@ -248,30 +457,22 @@ bool Compiler::GenerateCode(void)
 	}
 #endif
 
-	for (int i = 0; i < mInterCodeModule->mProcedures.Size(); i++)
+	if (mCompilerOptions & COPT_OPTIMIZE_BASIC)
 	{
-		InterCodeProcedure* proc = mInterCodeModule->mProcedures[i];
+		mGlobalAnalyzer->AllocateZeroPage(mInterCodeModule);
+		mGlobalAnalyzer->AllocateStaticFrames(mInterCodeModule, loc, mCompilationUnits->mSectionBSS);
+	}
 
-//		proc->ReduceTemporaries();
+	if (mCodeCache)
+		mCodeCache->Prepare(mCompilerOptions);
 
-#if _DEBUG
-		proc->Disassemble("final");
-#endif
+	CompileProcedures();
 
+	if (mCodeCache)
+		printf("Code cache %d hits, %d misses\n", int(mCodeCache->mHits), int(mCodeCache->mMisses));
 
-		if (proc->mNativeProcedure)
-		{
-			NativeCodeProcedure* ncproc = new NativeCodeProcedure(mNativeCodeGenerator);
-			ncproc->Compile(proc);
-		}
-		else
-		{
-			ByteCodeProcedure* bgproc = new ByteCodeProcedure();
-
-			bgproc->Compile(mByteCodeGenerator, proc);
-			mByteCodeFunctions.Push(bgproc);
-		}
-	}
+	if (mPassManager->mStatistics && !mPassManager->WriteReport(mPassReportPath, mInterCodeModule))
+		mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write pass report", mPassReportPath);
 
 	LinkerObject* byteCodeObject = nullptr;
 	if (!(mCompilerOptions & COPT_NATIVE))
@@ -333,6 +534,9 @@ bool Compiler::GenerateCode(void)
 
 	mLinker->Link();
 
+	if (mCodeCache && mErrors->mErrorCount == 0 && !mCodeCache->Write(mCodeCachePath))
+		mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write code cache file", mCodeCachePath);
+
 	return mErrors->mErrorCount == 0;
 }
 
@@ -385,6 +589,9 @@ bool Compiler::WriteOutputFile(const char* targetPath)
 	printf("Writing <%s>\n", intPath);	
 	mInterCodeModule->Disassemble(intPath);
 
+	for (int i = 0; i < mInterCodeModule->mProcedures.Size(); i++)
+		mInterCodeModule->mProcedures[i]->ReleaseCode();
+
 	if (!(mCompilerOptions & COPT_NATIVE))
 	{
 		printf("Writing <%s>\n", bcsPath);
@@ -400,6 +607,7 @@ int Compiler::ExecuteCode(void)
 
 	printf("Running emulation...\n");
 	Emulator* emu = new Emulator(mLinker);
+	emu->mProfile = mProfilePath != nullptr || mCallgrindPath != nullptr;
 
 	int ecode = 20;
 	if (mCompilerOptions & COPT_TARGET_PRG)
@@ -417,6 +625,24 @@ int Compiler::ExecuteCode(void)
 
 	printf("Emulation result %d\n", ecode);
 
+	if (mProfilePath)
+	{
+		printf("Writing <%s>\n", mProfilePath);
+
+		Profile	profile(mErrors);
+		if (!profile.Write(mProfilePath, mLinker, emu->mProfileCycles))
+			mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write profile file", mProfilePath);
+	}
+
+	if (mCallgrindPath)
+	{
+		printf("Writing <%s>\n", mCallgrindPath);
+
+		Profile	profile(mErrors);
+		if (!profile.WriteCallgrind(mCallgrindPath, mLinker, emu))
+			mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write callgrind file", mCallgrindPath);
+	}
+
 	if (ecode != 0)
 	{
 		char	sd[20];
@@ -424,5 +650,7 @@ int Compiler::ExecuteCode(void)
 		mErrors->Error(loc, EERR_EXECUTION_FAILED, "Execution failed", sd);
 	}
 
+	delete emu;
+
 	return ecode;
 }
@@ -9,6 +9,11 @@
 #include "GlobalAnalyzer.h"
 #include "Linker.h"
 #include "CompilerTypes.h"
+#include "Profile.h"
+#include "Prelude.h"
+#include "CodeCache.h"
+
+class Parser;
 
 class Compiler
 {
@@ -25,10 +30,23 @@ public:
 	InterCodeGenerator* mInterCodeGenerator;
 	InterCodeModule* mInterCodeModule;
 	GlobalAnalyzer* mGlobalAnalyzer;
+	PassManager* mPassManager;
 
 	GrowingArray<ByteCodeProcedure*>	mByteCodeFunctions;
+	GrowingArray<Parser*>				mParsers;
 
 	uint64	mCompilerOptions;
+	int		mThreadCount;
+	bool	mLazyParse;
+
+	Profile		*	mProfile;
+	const char	*	mProfilePath, * mCallgrindPath, * mPassReportPath;
+
+	Prelude		*	mPrelude;
+	const char	*	mPreludePath;
+
+	CodeCache	*	mCodeCache;
+	const char	*	mCodeCachePath;
 
 	struct Define
 	{
@@ -38,6 +56,11 @@ public:
 
 	GrowingArray<Define>	mDefines;
 
+	// Reuse the prelude of an earlier compile when it was built with the same
+	// defines and include paths
+
+	void LoadPrelude(const char* filename, const char* version, Prelude* warm = nullptr);
+	void LoadCodeCache(const char* filename, const char* version);
 	bool ParseSource(void);
 	bool GenerateCode(void);
 	bool WriteOutputFile(const char* targetPath);
@@ -46,4 +69,7 @@ public:
 	void AddDefine(const Ident* ident, const char* value);
 
 	void RegisterRuntime(const Location& loc, const Ident* ident);
+
+	void CompileProcedure(InterCodeProcedure* proc, ByteCodeProcedure*& bgproc);
+	void CompileProcedures(void);
 };
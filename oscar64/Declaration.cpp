@@ -13,6 +13,16 @@ DeclarationScope::~DeclarationScope(void)
 	delete[] mHash;
 }
 
+void* DeclarationScope::operator new(size_t size)
+{
+	return MemoryArena::Current()->AllocateObject<DeclarationScope>(size);
+}
+
+void DeclarationScope::operator delete(void* ptr)
+{
+	// Destroyed when the arena of the compiler is released
+}
+
 Declaration * DeclarationScope::Insert(const Ident* ident, Declaration* dec)
 {
 	if (!mHash)
@@ -94,6 +104,16 @@ Expression::~Expression(void)
 
 }
 
+void* Expression::operator new(size_t size)
+{
+	return MemoryArena::Current()->Allocate(size);
+}
+
+void Expression::operator delete(void* ptr)
+{
+	// Memory is returned with the arena of the compiler
+}
+
 Expression* Expression::LogicInvertExpression(void) 
 {
 	if (mType == EX_LOGICAL_NOT)
@@ -368,13 +388,25 @@ Expression* Expression::ConstantFold(Errors * errors)
 }
 
 Declaration::Declaration(const Location& loc, DecType type)
-	: mLocation(loc), mType(type), mScope(nullptr), mData(nullptr), mIdent(nullptr), mSize(0), mOffset(0), mFlags(0), mComplexity(0), mLocalSize(0), mBase(nullptr), mParams(nullptr), mValue(nullptr), mNext(nullptr), mVarIndex(-1), mLinkerObject(nullptr), mCallers(nullptr), mCalled(nullptr)
+	: mLocation(loc), mType(type), mScope(nullptr), mData(nullptr), mIdent(nullptr), mSize(0), mOffset(0), mFlags(0), mComplexity(0), mLocalSize(0), mBase(nullptr), mParams(nullptr), mValue(nullptr), mNext(nullptr), mVarIndex(-1), mLinkerObject(nullptr), mBody(nullptr), mCallers(nullptr), mCalled(nullptr)
 {}
 
 Declaration::~Declaration(void)
 {
-	delete mScope;
-	delete[] mData;
+}
+
+// The declarations, their scopes and constant data live as long as the
+// compiler, the builtin types are created before any compiler and stay
+// in the default arena of the process
+
+void* Declaration::operator new(size_t size)
+{
+	return MemoryArena::Current()->AllocateObject<Declaration>(size);
+}
+
+void Declaration::operator delete(void* ptr)
+{
+	// Destroyed when the arena of the compiler is released
 }
 
 bool Declaration::IsSubType(const Declaration* dec) const
@@ -5,9 +5,11 @@
 #include "MachineTypes.h"
 #include "Assembler.h"
 #include "Array.h"
+#include "MemoryArena.h"
 
 class LinkerObject;
 class LinkerSection;
+class DeferredBody;
 
 enum DecType
 {
@@ -71,6 +73,8 @@ static const uint32 DTF_FUNC_VARIABLE	= 0x00040000;
 static const uint32 DTF_FUNC_ASSEMBLER	= 0x00080000;
 static const uint32 DTF_FUNC_RECURSIVE  = 0x00100000;
 static const uint32 DTF_FUNC_ANALYZING  = 0x00200000;
+static const uint32 DTF_FUNC_HOT		= 0x00800000;
+static const uint32 DTF_FUNC_COLD		= 0x01000000;
 
 static const uint32 DTF_VAR_ALIASING	= 0x00400000;
 
@@ -83,6 +87,9 @@ public:
 	DeclarationScope(DeclarationScope * parent);
 	~DeclarationScope(void);
 
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
 	Declaration* Insert(const Ident* ident, Declaration* dec);
 	Declaration* Lookup(const Ident* ident);
 
@@ -142,6 +149,9 @@ public:
 	Expression(const Location& loc, ExpressionType type);
 	~Expression(void);
 
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
 	Location				mLocation;
 	ExpressionType			mType;
 	Expression			*	mLeft, * mRight;
@@ -161,6 +171,9 @@ public:
 	Declaration(const Location & loc, DecType type);
 	~Declaration(void);
 
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
 	Location			mLocation;
 	DecType				mType;
 	Token				mToken;
@@ -175,6 +188,7 @@ public:
 	LinkerSection	*	mSection;
 	const uint8		*	mData;
 	LinkerObject	*	mLinkerObject;
+	DeferredBody	*	mBody;
 
 	GrowingArray<Declaration*>	mCallers, mCalled;
 
@@ -1,12 +1,17 @@
 #include "Emulator.h"
 #include "Linker.h"
+#include "ByteCodeGenerator.h"
 #include <stdio.h>
 
+static void BuildTables(void);
+
 Emulator::Emulator(Linker* linker)
-	: mLinker(linker)
+	: mProfile(false), mCalls({ 0 }), mFrames({ 0 }), mCountCycles(true), mDecodeCore(false), mTrace(0), mLinker(linker)
 {
 	for (int i = 0; i < 0x10000; i++)
 		mMemory[i] = 0;
+
+	BuildTables();
 }
 
 
@@ -15,11 +20,63 @@ Emulator::~Emulator(void)
 
 }
 
+static const uint8 PROFILE_NONE = 0;
+static const uint8 PROFILE_NATIVE = 1;
+static const uint8 PROFILE_BYTECODE = 2;
+static const uint8 PROFILE_CALL_ABS = 3;
+static const uint8 PROFILE_CALL_ADDR = 4;
+static const uint8 PROFILE_RETURN = 5;
+
 static const uint8 STATUS_SIGN = 0x80;
 static const uint8 STATUS_OVERFLOW = 0x40;
 static const uint8 STATUS_ZERO = 0x02;
 static const uint8 STATUS_CARRY = 0x01;
 
+// Zero and sign flags of each result and the cycles of each opcode without
+// the taken branch, both derived for the fast core
+
+static uint8	NZFlags[256];
+static uint8	OpCycles[256];
+
+static void BuildTables(void)
+{
+	static const uint8 ModeCycles[NUM_ASM_INS_MODES] = { 2, 2, 3, 3, 3, 4, 5, 5, 6, 6, 6, 2 };
+
+	for (int i = 0; i < 256; i++)
+	{
+		NZFlags[i] = (i == 0 ? STATUS_ZERO : 0) | (i & 0x80 ? STATUS_SIGN : 0);
+
+		const AsmInsData& d(DecInsData[i]);
+
+		int	cycles = ModeCycles[d.mMode];
+		switch (d.mType)
+		{
+		case ASMIT_ASL:
+		case ASMIT_LSR:
+		case ASMIT_ROL:
+		case ASMIT_ROR:
+		case ASMIT_INC:
+		case ASMIT_DEC:
+			if (d.mMode != ASMIM_IMPLIED)
+				cycles += 2;
+			break;
+		case ASMIT_JSR:
+			cycles += 2;
+			break;
+		case ASMIT_PHA:
+		case ASMIT_PHP:
+		case ASMIT_PLA:
+		case ASMIT_PLP:
+			cycles++;
+			break;
+		case ASMIT_RTS:
+			cycles += 4;
+			break;
+		}
+		OpCycles[i] = cycles;
+	}
+}
+
 void Emulator::UpdateStatus(uint8 result)
 {
 	mRegP &= ~(STATUS_ZERO | STATUS_SIGN);
@@ -114,6 +171,133 @@ void Emulator::DumpCycles(void)
 	}
 }
 
+void Emulator::BuildProfileCode(void)
+{
+	for (int i = 0; i < 0x10000; i++)
+	{
+		mProfileCycles[i] = 0;
+		mProfileCode[i] = PROFILE_NONE;
+	}
+
+	for (int i = 0; i < mLinker->mObjects.Size(); i++)
+	{
+		LinkerObject* lobj = mLinker->mObjects[i];
+		if (lobj->mProc && (lobj->mFlags & LOBJF_PLACED))
+		{
+			uint8	code = PROFILE_NONE;
+			if (lobj->mType == LOT_NATIVE_CODE)
+				code = PROFILE_NATIVE;
+			else if (lobj->mType == LOT_BYTE_CODE)
+				code = PROFILE_BYTECODE;
+
+			for (int j = lobj->mAddress; j < lobj->mAddress + lobj->mSize && j < 0x10000; j++)
+				mProfileCode[j] = code;
+		}
+	}
+
+	// Entries of the byte code call and return handlers from the dispatch table
+
+	mByteCodeExec = -1;
+	for (int i = 0; i < mLinker->mObjects.Size(); i++)
+	{
+		LinkerObject* lobj = mLinker->mObjects[i];
+		if (lobj->mIdent && (lobj->mFlags & LOBJF_PLACED))
+		{
+			if (!strcmp(lobj->mIdent->mString, "bcexec"))
+				mByteCodeExec = lobj->mAddress;
+			else if (!strcmp(lobj->mIdent->mString, "bytecode") && lobj->mType == LOT_RUNTIME)
+			{
+				static const struct { int mByteCode; uint8 mCode; } handlers[] = {
+					{ BC_CALL_ABS, PROFILE_CALL_ABS }, { BC_CALL_ADDR, PROFILE_CALL_ADDR }, { BC_RETURN, PROFILE_RETURN } };
+
+				for (int j = 0; j < 3; j++)
+				{
+					int	at = lobj->mAddress + 2 * handlers[j].mByteCode;
+					int	addr = mMemory[at] + 256 * mMemory[at + 1];
+					if (addr)
+						mProfileCode[addr] = handlers[j].mCode;
+				}
+			}
+		}
+	}
+
+	mCalls.SetSize(0);
+	mFrames.SetSize(0);
+	for (int i = 0; i < 0x10000; i++)
+		mCallSites[i] = -1;
+	mProfileTotal = 0;
+}
+
+void Emulator::ProfileCall(int site, int target, int stack, bool bytecode)
+{
+	// Native code calls byte code functions through bcexec with the address in the accu
+
+	if (target == mByteCodeExec)
+		target = mMemory[BC_REG_ACCU] + 256 * mMemory[BC_REG_ACCU + 1];
+
+	int	i = mCallSites[site];
+	while (i >= 0 && mCalls[i].mTarget != target)
+		i = mCalls[i].mNext;
+
+	if (i < 0)
+	{
+		EmulatorCall	call;
+		call.mSite = site;
+		call.mTarget = target;
+		call.mNext = mCallSites[site];
+		call.mCount = 0;
+		call.mCycles = 0;
+
+		i = mCalls.Size();
+		mCalls.Push(call);
+		mCallSites[site] = i;
+	}
+
+	mCalls[i].mCount++;
+
+	EmulatorFrame	frame;
+	frame.mCall = i;
+	frame.mStart = mProfileTotal;
+	frame.mStack = stack;
+	frame.mByteCode = bytecode;
+	mFrames.Push(frame);
+}
+
+// A native return leaves all frames that were entered below its stack level
+
+void Emulator::ProfileReturn(int stack)
+{
+	while (mFrames.Size() > 0 && mFrames.Top().mStack < stack)
+	{
+		EmulatorFrame	frame = mFrames.Pop();
+		mCalls[frame.mCall].mCycles += mProfileTotal - frame.mStart;
+	}
+}
+
+// The first instruction of a byte code call handler leaves the operand offset in Y
+
+void Emulator::ProfileByteCode(uint8 code, int ip, uint8 y, int stack)
+{
+	int	at = (ip + y) & 0xffff;
+
+	switch (code)
+	{
+	case PROFILE_CALL_ABS:
+		ProfileCall((at - 1) & 0xffff, mMemory[at] + 256 * mMemory[(at + 1) & 0xffff], stack, true);
+		break;
+	case PROFILE_CALL_ADDR:
+		ProfileCall((at - 1) & 0xffff, mMemory[BC_REG_ADDR] + 256 * mMemory[BC_REG_ADDR + 1], stack, true);
+		break;
+	case PROFILE_RETURN:
+		if (mFrames.Size() > 0 && mFrames.Top().mByteCode)
+		{
+			EmulatorFrame	frame = mFrames.Pop();
+			mCalls[frame.mCall].mCycles += mProfileTotal - frame.mStart;
+		}
+		break;
+	}
+}
+
 bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, int & cycles)
 {
 	int	t;
@@ -493,11 +677,29 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 
 int Emulator::Emulate(int startIP)
 {
-	int	trace = 0;
+	int	result = Run(startIP);
+
+	if (mIP == 0 && mRegS == 0)
+	{
+#if 0
+		for (int i = 0; i < 256; i++)
+			if (mMemory[i] != 0)
+				printf("ZP %02x : %02x\n", i, mMemory[i]);
+#endif
+		DumpCycles();
+	}
+
+	return result;
+}
 
+int Emulator::Run(int startIP)
+{
 	for (int i = 0; i < 0x10000; i++)
 		mCycles[i] = 0;
 
+	if (mProfile)
+		BuildProfileCode();
+
 	mIP = startIP;
 	mRegA = 0;
 	mRegX = 0;
@@ -508,6 +710,27 @@ int Emulator::Emulate(int startIP)
 	mMemory[0x1fe] = 0xff;
 	mMemory[0x1ff] = 0xff;
 
+	bool	done;
+	if (mDecodeCore || mTrace)
+		done = ExecuteDecode();
+	else if (mProfile)
+		done = Execute<true, true>();
+	else if (mCountCycles)
+		done = Execute<true, false>();
+	else
+		done = Execute<false, false>();
+
+	if (mProfile)
+		ProfileReturn(0x100);
+
+	if (done && mRegS == 0)
+		return int16(mMemory[BC_REG_ACCU] + 256 * mMemory[BC_REG_ACCU + 1]);
+
+	return -1;
+}
+
+bool Emulator::ExecuteDecode(void)
+{
 	int		ticks = 0;
 	while (mIP != 0)
 	{
@@ -534,6 +757,8 @@ int Emulator::Emulate(int startIP)
 				putchar(mRegA);
 			mIP = mMemory[0x100 + mRegS] + 256 * mMemory[0x101 + mRegS] + 1;
 			mRegS += 2;
+			if (mProfile)
+				ProfileReturn(mRegS);
 		}
 		else if (mIP == 0xffcf)
 		{
@@ -541,6 +766,8 @@ int Emulator::Emulate(int startIP)
 			mRegA = ch;
 			mIP = mMemory[0x100 + mRegS] + 256 * mMemory[0x101 + mRegS] + 1;
 			mRegS += 2;
+			if (mProfile)
+				ProfileReturn(mRegS);
 		}
 
 		uint8	opcode = mMemory[mIP];
@@ -548,44 +775,45 @@ int Emulator::Emulate(int startIP)
 		int	addr = 0, taddr;
 		int	ip = mIP;
 		int	iip = mMemory[BC_REG_IP] + 256 * mMemory[BC_REG_IP + 1];
+		int	cycles = mCycles[ip];
 
 		mIP++;
 		switch (d.mMode)
 		{
 			case ASMIM_IMPLIED:
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x __ __ %s         (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], AsmInstructionNames[d.mType], mRegA, mRegX, mRegY, mRegP, mRegS);
 				mCycles[ip] += 2;
 				break;
 			case ASMIM_IMMEDIATE:
 				addr = mMemory[mIP++];
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s #$%02x    (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], mMemory[ip+1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS);
 				mCycles[ip] += 2;
 				break;
 			case ASMIM_ZERO_PAGE:
 				addr = mMemory[mIP++];
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS);
 				mCycles[ip] += 3;
 				break;
 			case ASMIM_ZERO_PAGE_X:
 				taddr = mMemory[mIP++];
 				addr = (taddr + mRegX) & 0xff;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s $%02x,x   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mCycles[ip] += 3;
 				break;
 			case ASMIM_ZERO_PAGE_Y:
 				taddr = mMemory[mIP++];
 				addr = (taddr + mRegY) & 0xff;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s $%02x,y   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mCycles[ip] += 3;
 				break;
 			case ASMIM_ABSOLUTE:
 				addr = mMemory[mIP] + 256 * mMemory[mIP + 1];
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x %02x %s $%04x   (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS);
 				mIP += 2;
 				mCycles[ip] += 4;
@@ -593,7 +821,7 @@ int Emulator::Emulate(int startIP)
 			case ASMIM_ABSOLUTE_X:
 				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
 				addr = (taddr + mRegX) & 0xffff;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x %02x %s $%04x,x (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mIP += 2;
 				mCycles[ip] += 5;
@@ -601,7 +829,7 @@ int Emulator::Emulate(int startIP)
 			case ASMIM_ABSOLUTE_Y:
 				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
 				addr = (taddr + mRegY) & 0xffff;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x %02x %s $%04x,y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mIP += 2;
 				mCycles[ip] += 5;
@@ -610,21 +838,21 @@ int Emulator::Emulate(int startIP)
 				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
 				mIP += 2;
 				addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x %02x %s ($%04x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mCycles[ip] += 6;
 				break;
 			case ASMIM_INDIRECT_X:
 				taddr = (mMemory[mIP++] + mRegX) & 0xff;
 				addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s ($%02x,x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], mMemory[ip + 1], mRegA, mRegX, mRegY, mRegP, mRegS, taddr, addr);
 				mCycles[ip] += 6;
 				break;
 			case ASMIM_INDIRECT_Y:
 				taddr = mMemory[mIP++];
 				addr = (mMemory[taddr] + 256 * mMemory[taddr + 1] + mRegY) & 0xffff;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s ($%02x),y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mCycles[ip] += 6;
 				break;
@@ -634,13 +862,13 @@ int Emulator::Emulate(int startIP)
 					addr = taddr + mIP - 256;
 				else
 					addr = taddr + mIP;
-				if (trace & 2)
+				if (mTrace & 2)
 					printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 				mCycles[ip] += 2;
 				break;
 		}
 
-		if ((trace & 1) && ip == 0x0850)
+		if ((mTrace & 1) && ip == 0x0850)
 		{
 			int	accu = mMemory[BC_REG_ACCU] + 256 * mMemory[BC_REG_ACCU + 1];
 			int	ptr = mMemory[BC_REG_ADDR] + 256 * mMemory[BC_REG_ADDR + 1];
@@ -673,19 +901,295 @@ int Emulator::Emulate(int startIP)
 		}
 
 		if (!EmulateInstruction(d.mType, d.mMode, addr, mCycles[ip]))
-			return -1;
+			return false;
+
+		if (mProfile)
+		{
+			int	at = mProfileCode[ip] != PROFILE_NATIVE && mProfileCode[iip] == PROFILE_BYTECODE ? iip : ip;
+			mProfileCycles[at] += mCycles[ip] - cycles;
+			mProfileTotal += mCycles[ip] - cycles;
+
+			if (d.mType == ASMIT_JSR)
+				ProfileCall(at, mIP, mRegS, false);
+			else if (d.mType == ASMIT_RTS)
+				ProfileReturn(mRegS);
+			else if (mProfileCode[ip] >= PROFILE_CALL_ABS)
+				ProfileByteCode(mProfileCode[ip], iip, mRegY, mRegS);
+		}
 	}
 
-	if (mRegS == 0)
+	return true;
+}
+
+// Addressing modes of the fast core, the operand bytes follow the opcode
+
+#define EMU_ZP		(mem[ip++])
+#define EMU_ZPX		((mem[ip++] + x) & 0xff)
+#define EMU_ZPY		((mem[ip++] + y) & 0xff)
+#define EMU_ABS		(ip += 2, mem[ip - 2] + 256 * mem[ip - 1])
+#define EMU_ABSX	((EMU_ABS + x) & 0xffff)
+#define EMU_ABSY	((EMU_ABS + y) & 0xffff)
+#define EMU_IND		(zt = EMU_ABS, mem[zt] + 256 * mem[zt + 1])
+#define EMU_INDX	(zt = (mem[ip++] + x) & 0xff, mem[zt] + 256 * mem[zt + 1])
+#define EMU_INDY	(zt = mem[ip++], (mem[zt] + 256 * mem[zt + 1] + y) & 0xffff)
+
+// Instructions of the fast core, the flags match EmulateInstruction
+
+#define EMU_NZ(r)			p = (p & ~(STATUS_ZERO | STATUS_SIGN)) | NZFlags[r]
+#define EMU_NZC(r, c)		p = (p & ~(STATUS_ZERO | STATUS_SIGN | STATUS_CARRY)) | NZFlags[r] | (c)
+#define EMU_LD(r, m)		{ r = m; EMU_NZ(r); }
+#define EMU_AND(m)			{ a &= m; EMU_NZ(a); }
+#define EMU_ORA(m)			{ a |= m; EMU_NZ(a); }
+#define EMU_EOR(m)			{ a ^= m; EMU_NZ(a); }
+#define EMU_ADC(m)			{ int v = m; t = a + v + (p & STATUS_CARRY); p = ((~(a ^ v) & (a ^ t) & 0x80) >> 1) | NZFlags[t & 255] | (t >> 8); a = t & 255; }
+#define EMU_SBC(m)			{ int v = m; t = a + (v ^ 0xff) + (p & STATUS_CARRY); p = (((a ^ v) & (a ^ t) & 0x80) >> 1) | NZFlags[t & 255] | (t >> 8); a = t & 255; }
+#define EMU_CMP(r, m)		{ int v = m; t = r + (v ^ 0xff) + 1; p = (((r ^ v) & (r ^ t) & 0x80) >> 1) | NZFlags[t & 255] | (t >> 8); }
+#define EMU_BIT(m)			{ int v = m; p = (p & ~(STATUS_ZERO | STATUS_SIGN | STATUS_OVERFLOW)) | (v & (STATUS_SIGN | STATUS_OVERFLOW)) | ((v & a) ? 0 : STATUS_ZERO); }
+#define EMU_ASL(r)			{ t = r << 1; r = t & 255; EMU_NZC(r, t >> 8); }
+#define EMU_ROL(r)			{ t = (r << 1) | (p & STATUS_CARRY); r = t & 255; EMU_NZC(r, t >> 8); }
+#define EMU_LSR(r)			{ t = r & 1; r >>= 1; EMU_NZC(r, t); }
+#define EMU_ROR(r)			{ t = r & 1; r = (r >> 1) | ((p & STATUS_CARRY) << 7); EMU_NZC(r, t); }
+#define EMU_INC(r)			{ r++; EMU_NZ(r); }
+#define EMU_DEC(r)			{ r--; EMU_NZ(r); }
+#define EMU_BRANCH(cc, tc)	{ t = int8(mem[ip++]); if (cc) { ip += t; c += tc; } }
+#define EMU_FAIL			{ ok = false; goto done; }
+
+template<bool cycles, bool profile>
+bool Emulator::Execute(void)
+{
+	uint8	*	mem = mMemory;
+	int			ip = mIP;
+	uint8		a = mRegA, x = mRegX, y = mRegY, s = mRegS, p = mRegP;
+	bool		ok = true;
+	int			ticks = 0;
+
+	while (ip != 0)
 	{
-#if 0
-		for (int i = 0; i < 256; i++)
-			if (mMemory[i] != 0)
-				printf("ZP %02x : %02x\n", i, mMemory[i]);
-#endif
-		DumpCycles();
-		return int16(mMemory[BC_REG_ACCU] + 256 * mMemory[BC_REG_ACCU + 1]);
+		ticks++;
+		if (ticks > 4500)
+		{
+			mem[0xa2]++;
+			if (!mem[0xa2])
+			{
+				mem[0xa1]++;
+				if (!mem[0xa1])
+					mem[0xa0]++;
+			}
+			ticks = 0;
+		}
+
+		if (ip >= 0xffcf)
+		{
+			if (ip == 0xffd2)
+			{
+				if (a == 13)
+					putchar('\n');
+				else
+					putchar(a);
+				ip = mem[0x100 + s] + 256 * mem[0x101 + s] + 1;
+				s += 2;
+				if (profile)
+					ProfileReturn(s);
+			}
+			else if (ip == 0xffcf)
+			{
+				a = getchar();
+				ip = mem[0x100 + s] + 256 * mem[0x101 + s] + 1;
+				s += 2;
+				if (profile)
+					ProfileReturn(s);
+			}
+		}
+
+		int		pip = ip, iip = 0;
+		if (profile)
+			iip = mem[BC_REG_IP] + 256 * mem[BC_REG_IP + 1];
+
+		uint8	opcode = mem[ip++];
+		int		c = OpCycles[opcode], t, ad, zt;
+
+		switch (opcode)
+		{
+		case 0x00: EMU_FAIL; break;
+		case 0x01: EMU_ORA(mem[EMU_INDX]); break;
+		case 0x05: EMU_ORA(mem[EMU_ZP]); break;
+		case 0x06: ad = EMU_ZP; EMU_ASL(mem[ad]); break;
+		case 0x08: mem[0x100 + --s] = p; break;
+		case 0x09: EMU_ORA(mem[ip++]); break;
+		case 0x0a: EMU_ASL(a); break;
+		case 0x0d: EMU_ORA(mem[EMU_ABS]); break;
+		case 0x0e: ad = EMU_ABS; EMU_ASL(mem[ad]); break;
+		case 0x10: EMU_BRANCH(!(p & STATUS_SIGN), 1); break;
+		case 0x11: EMU_ORA(mem[EMU_INDY]); break;
+		case 0x15: EMU_ORA(mem[EMU_ZPX]); break;
+		case 0x16: ad = EMU_ZPX; EMU_ASL(mem[ad]); break;
+		case 0x18: p &= ~STATUS_CARRY; break;
+		case 0x19: EMU_ORA(mem[EMU_ABSY]); break;
+		case 0x1d: EMU_ORA(mem[EMU_ABSX]); break;
+		case 0x1e: ad = EMU_ABSX; EMU_ASL(mem[ad]); break;
+		case 0x20: ad = EMU_ABS; mem[0x100 + --s] = (ip - 1) >> 8; mem[0x100 + --s] = (ip - 1) & 0xff; ip = ad; break;
+		case 0x21: EMU_AND(mem[EMU_INDX]); break;
+		case 0x24: EMU_BIT(mem[EMU_ZP]); break;
+		case 0x25: EMU_AND(mem[EMU_ZP]); break;
+		case 0x26: ad = EMU_ZP; EMU_ROL(mem[ad]); break;
+		case 0x28: p = mem[0x100 + s++]; break;
+		case 0x29: EMU_AND(mem[ip++]); break;
+		case 0x2a: EMU_ROL(a); break;
+		case 0x2c: EMU_BIT(mem[EMU_ABS]); break;
+		case 0x2d: EMU_AND(mem[EMU_ABS]); break;
+		case 0x2e: ad = EMU_ABS; EMU_ROL(mem[ad]); break;
+		case 0x30: EMU_BRANCH(p & STATUS_SIGN, 1); break;
+		case 0x31: EMU_AND(mem[EMU_INDY]); break;
+		case 0x35: EMU_AND(mem[EMU_ZPX]); break;
+		case 0x36: ad = EMU_ZPX; EMU_ROL(mem[ad]); break;
+		case 0x38: p |= STATUS_CARRY; break;
+		case 0x39: EMU_AND(mem[EMU_ABSY]); break;
+		case 0x3d: EMU_AND(mem[EMU_ABSX]); break;
+		case 0x3e: ad = EMU_ABSX; EMU_ROL(mem[ad]); break;
+		case 0x40: break;
+		case 0x41: EMU_EOR(mem[EMU_INDX]); break;
+		case 0x45: EMU_EOR(mem[EMU_ZP]); break;
+		case 0x46: ad = EMU_ZP; EMU_LSR(mem[ad]); break;
+		case 0x48: mem[0x100 + --s] = a; break;
+		case 0x49: EMU_EOR(mem[ip++]); break;
+		case 0x4a: EMU_LSR(a); break;
+		case 0x4c: ip = EMU_ABS; break;
+		case 0x4d: EMU_EOR(mem[EMU_ABS]); break;
+		case 0x4e: ad = EMU_ABS; EMU_LSR(mem[ad]); break;
+		case 0x50: EMU_BRANCH(!(p & STATUS_OVERFLOW), 1); break;
+		case 0x51: EMU_EOR(mem[EMU_INDY]); break;
+		case 0x55: EMU_EOR(mem[EMU_ZPX]); break;
+		case 0x56: ad = EMU_ZPX; EMU_LSR(mem[ad]); break;
+		case 0x58: break;
+		case 0x59: EMU_EOR(mem[EMU_ABSY]); break;
+		case 0x5d: EMU_EOR(mem[EMU_ABSX]); break;
+		case 0x5e: ad = EMU_ABSX; EMU_LSR(mem[ad]); break;
+		case 0x60: ip = (mem[0x100 + s] + 256 * mem[0x101 + s] + 1) & 0xffff; s += 2; break;
+		case 0x61: EMU_ADC(mem[EMU_INDX]); break;
+		case 0x65: EMU_ADC(mem[EMU_ZP]); break;
+		case 0x66: ad = EMU_ZP; EMU_ROR(mem[ad]); break;
+		case 0x68: a = mem[0x100 + s++]; break;
+		case 0x69: EMU_ADC(mem[ip++]); break;
+		case 0x6a: EMU_ROR(a); break;
+		case 0x6c: ip = EMU_IND; break;
+		case 0x6d: EMU_ADC(mem[EMU_ABS]); break;
+		case 0x6e: ad = EMU_ABS; EMU_ROR(mem[ad]); break;
+		case 0x70: EMU_BRANCH(p & STATUS_OVERFLOW, 1); break;
+		case 0x71: EMU_ADC(mem[EMU_INDY]); break;
+		case 0x75: EMU_ADC(mem[EMU_ZPX]); break;
+		case 0x76: ad = EMU_ZPX; EMU_ROR(mem[ad]); break;
+		case 0x78: break;
+		case 0x79: EMU_ADC(mem[EMU_ABSY]); break;
+		case 0x7d: EMU_ADC(mem[EMU_ABSX]); break;
+		case 0x7e: ad = EMU_ABSX; EMU_ROR(mem[ad]); break;
+		case 0x81: mem[EMU_INDX] = a; break;
+		case 0x84: mem[EMU_ZP] = y; break;
+		case 0x85: mem[EMU_ZP] = a; break;
+		case 0x86: mem[EMU_ZP] = x; break;
+		case 0x88: y--; EMU_NZ(y); break;
+		case 0x8a: a = x; EMU_NZ(a); break;
+		case 0x8c: mem[EMU_ABS] = y; break;
+		case 0x8d: mem[EMU_ABS] = a; break;
+		case 0x8e: mem[EMU_ABS] = x; break;
+		case 0x90: EMU_BRANCH(!(p & STATUS_CARRY), 0); break;
+		case 0x91: mem[EMU_INDY] = a; break;
+		case 0x94: mem[EMU_ZPX] = y; break;
+		case 0x95: mem[EMU_ZPX] = a; break;
+		case 0x96: mem[EMU_ZPY] = x; break;
+		case 0x98: a = y; EMU_NZ(a); break;
+		case 0x99: mem[EMU_ABSY] = a; break;
+		case 0x9a: s = x; break;
+		case 0x9d: mem[EMU_ABSX] = a; break;
+		case 0xa0: EMU_LD(y, mem[ip++]); break;
+		case 0xa1: EMU_LD(a, mem[EMU_INDX]); break;
+		case 0xa2: EMU_LD(x, mem[ip++]); break;
+		case 0xa4: EMU_LD(y, mem[EMU_ZP]); break;
+		case 0xa5: EMU_LD(a, mem[EMU_ZP]); break;
+		case 0xa6: EMU_LD(x, mem[EMU_ZP]); break;
+		case 0xa8: y = a; EMU_NZ(y); break;
+		case 0xa9: EMU_LD(a, mem[ip++]); break;
+		case 0xaa: x = a; EMU_NZ(x); break;
+		case 0xac: EMU_LD(y, mem[EMU_ABS]); break;
+		case 0xad: EMU_LD(a, mem[EMU_ABS]); break;
+		case 0xae: EMU_LD(x, mem[EMU_ABS]); break;
+		case 0xb0: EMU_BRANCH(p & STATUS_CARRY, 0); break;
+		case 0xb1: EMU_LD(a, mem[EMU_INDY]); break;
+		case 0xb4: EMU_LD(y, mem[EMU_ZPX]); break;
+		case 0xb5: EMU_LD(a, mem[EMU_ZPX]); break;
+		case 0xb6: EMU_LD(x, mem[EMU_ZPY]); break;
+		case 0xb8: p &= ~STATUS_OVERFLOW; break;
+		case 0xb9: EMU_LD(a, mem[EMU_ABSY]); break;
+		case 0xba: x = s; EMU_NZ(x); break;
+		case 0xbc: EMU_LD(y, mem[EMU_ABSX]); break;
+		case 0xbd: EMU_LD(a, mem[EMU_ABSX]); break;
+		case 0xbe: EMU_LD(x, mem[EMU_ABSY]); break;
+		case 0xc0: EMU_CMP(y, mem[ip++]); break;
+		case 0xc1: EMU_CMP(a, mem[EMU_INDX]); break;
+		case 0xc4: EMU_CMP(y, mem[EMU_ZP]); break;
+		case 0xc5: EMU_CMP(a, mem[EMU_ZP]); break;
+		case 0xc6: ad = EMU_ZP; EMU_DEC(mem[ad]); break;
+		case 0xc8: y++; EMU_NZ(y); break;
+		case 0xc9: EMU_CMP(a, mem[ip++]); break;
+		case 0xca: x--; EMU_NZ(x); break;
+		case 0xcc: EMU_CMP(y, mem[EMU_ABS]); break;
+		case 0xcd: EMU_CMP(a, mem[EMU_ABS]); break;
+		case 0xce: ad = EMU_ABS; EMU_DEC(mem[ad]); break;
+		case 0xd0: EMU_BRANCH(!(p & STATUS_ZERO), 1); break;
+		case 0xd1: EMU_CMP(a, mem[EMU_INDY]); break;
+		case 0xd5: EMU_CMP(a, mem[EMU_ZPX]); break;
+		case 0xd6: ad = EMU_ZPX; EMU_DEC(mem[ad]); break;
+		case 0xd8: break;
+		case 0xd9: EMU_CMP(a, mem[EMU_ABSY]); break;
+		case 0xdd: EMU_CMP(a, mem[EMU_ABSX]); break;
+		case 0xde: ad = EMU_ABSX; EMU_DEC(mem[ad]); break;
+		case 0xe0: EMU_CMP(x, mem[ip++]); break;
+		case 0xe1: EMU_SBC(mem[EMU_INDX]); break;
+		case 0xe4: EMU_CMP(x, mem[EMU_ZP]); break;
+		case 0xe5: EMU_SBC(mem[EMU_ZP]); break;
+		case 0xe6: ad = EMU_ZP; EMU_INC(mem[ad]); break;
+		case 0xe8: x++; EMU_NZ(x); break;
+		case 0xe9: EMU_SBC(mem[ip++]); break;
+		case 0xea: break;
+		case 0xec: EMU_CMP(x, mem[EMU_ABS]); break;
+		case 0xed: EMU_SBC(mem[EMU_ABS]); break;
+		case 0xee: ad = EMU_ABS; EMU_INC(mem[ad]); break;
+		case 0xf0: EMU_BRANCH(p & STATUS_ZERO, 0); break;
+		case 0xf1: EMU_SBC(mem[EMU_INDY]); break;
+		case 0xf5: EMU_SBC(mem[EMU_ZPX]); break;
+		case 0xf6: ad = EMU_ZPX; EMU_INC(mem[ad]); break;
+		case 0xf8: break;
+		case 0xf9: EMU_SBC(mem[EMU_ABSY]); break;
+		case 0xfd: EMU_SBC(mem[EMU_ABSX]); break;
+		case 0xfe: ad = EMU_ABSX; EMU_INC(mem[ad]); break;
+		default:
+			EMU_FAIL;
+		}
+
+		if (cycles)
+			mCycles[pip] += c;
+
+		if (profile)
+		{
+			int	at = mProfileCode[pip] != PROFILE_NATIVE && mProfileCode[iip] == PROFILE_BYTECODE ? iip : pip;
+			mProfileCycles[at] += c;
+			mProfileTotal += c;
+
+			if (opcode == 0x20)
+				ProfileCall(at, ip, s, false);
+			else if (opcode == 0x60)
+				ProfileReturn(s);
+			else if (mProfileCode[pip] >= PROFILE_CALL_ABS)
+				ProfileByteCode(mProfileCode[pip], iip, y, s);
+		}
 	}
 
-	return -1;
+done:
+	mIP = ip;
+	mRegA = a;
+	mRegX = x;
+	mRegY = y;
+	mRegS = s;
+	mRegP = p;
+
+	return ok;
 }
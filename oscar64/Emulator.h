@@ -2,9 +2,24 @@
 
 #include "Assembler.h"
 #include "MachineTypes.h"
+#include "Array.h"
 
 class Linker;
 
+struct EmulatorCall
+{
+	int		mSite, mTarget, mNext;
+	int64	mCount, mCycles;
+};
+
+struct EmulatorFrame
+{
+	int		mCall;
+	int64	mStart;
+	int		mStack;
+	bool	mByteCode;
+};
+
 class Emulator
 {
 public:
@@ -14,15 +29,47 @@ public:
 	uint8		mMemory[0x10000];
 	int			mCycles[0x10000];
 
+	// Cycles per code address for the profile, time spent in the byte code
+	// interpreter is charged to the byte code that is being executed
+
+	bool		mProfile;
+	int			mProfileCycles[0x10000];
+	uint8		mProfileCode[0x10000];
+
+	// Native JSR and RTS and the calls and returns of the byte code interpreter
+	// keep a shadow call stack during a profile.  Each pair of call site and
+	// target counts its calls and the cycles until the return.
+
+	GrowingArray<EmulatorCall>	mCalls;
+	GrowingArray<EmulatorFrame>	mFrames;
+	int							mCallSites[0x10000];
+	int64						mProfileTotal;
+	int							mByteCodeExec;
+
+	// The fast core dispatches on the opcode and counts the cycles only when
+	// asked to, the decoding core follows DecInsData and can trace the execution
+
+	bool		mCountCycles, mDecodeCore;
+	int			mTrace;
+
 	int		mIP;
 	uint8	mRegA, mRegX, mRegY, mRegS, mRegP;
 
 	Linker* mLinker;
 
 	int Emulate(int startIP);
+	int Run(int startIP);
 	bool EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, int & cycles);
 protected:
 	void UpdateStatus(uint8 result);
 	void UpdateStatusCarry(uint8 result, bool carry);
 	void DumpCycles(void);
+	void BuildProfileCode(void);
+
+	void ProfileCall(int site, int target, int stack, bool bytecode);
+	void ProfileReturn(int stack);
+	void ProfileByteCode(uint8 code, int ip, uint8 y, int stack);
+
+	bool ExecuteDecode(void);
+	template<bool cycles, bool profile> bool Execute(void);
 };
\ No newline at end of file
@@ -3,13 +3,15 @@
 #include <stdlib.h>
 
 Errors::Errors(void)
-	: mErrorCount(0)
+	: mErrorCount(0), mExitOnLimit(true)
 {
 
 }
 
 void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const char* info) 
 {
+	std::lock_guard<std::mutex>	lock(mMutex);
+
 	const char* level = "info";
 	if (eid >= EERR_GENERIC)
 	{
@@ -21,12 +23,17 @@ void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const char
 		level = "warning";
 	}
 
+	// When not exiting at the error limit, later messages are dropped
+
+	if (mErrorCount > 11)
+		return;
+
 	if (info)
 		printf("%s(%d, %d) : %s %d: %s '%s'\n", loc.mFileName, loc.mLine, loc.mColumn, level ,eid, msg, info);
 	else
 		printf("%s(%d, %d) : %s %d: %s\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg);
 
-	if (mErrorCount > 10)
+	if (mErrorCount > 10 && mExitOnLimit)
 		exit(20);
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 class Location
 {
 public:
@@ -63,6 +65,9 @@ public:
 	Errors(void);
 
 	int		mErrorCount;
+	bool	mExitOnLimit;
+
+	std::mutex	mMutex;
 
 	void Error(const Location& loc, ErrorID eid, const char* msg, const char* info = nullptr);
 };
@@ -1,7 +1,8 @@
 #include "GlobalAnalyzer.h"
+#include "Parser.h"
 
 GlobalAnalyzer::GlobalAnalyzer(Errors* errors, Linker* linker)
-	: mErrors(errors), mLinker(linker), mCalledFunctions(nullptr), mCallingFunctions(nullptr), mVariableFunctions(nullptr), mFunctions(nullptr), mCompilerOptions(COPT_DEFAULT)
+	: mErrors(errors), mLinker(linker), mCalledFunctions(nullptr), mCallingFunctions(nullptr), mVariableFunctions(nullptr), mFunctions(nullptr), mCompilerOptions(COPT_DEFAULT), mProfile(nullptr)
 {
 
 }
@@ -49,6 +50,40 @@ void GlobalAnalyzer::DumpCallGraph(void)
 	}
 }
 
+// A function is hot when it takes at least 1/ProfileHotShare of the profiled cycles
+
+static const int	ProfileHotShare = 50;
+
+void GlobalAnalyzer::ApplyProfile(void)
+{
+	// Without a total every executed function would be hot
+
+	if (mProfile->mTotalCycles <= 0)
+	{
+		Location	loc;
+		mErrors->Error(loc, EWARN_GENERIC, "Profile without cycle total ignored");
+		return;
+	}
+
+	for (int i = 0; i < mFunctions.Size(); i++)
+	{
+		Declaration* f = mFunctions[i];
+
+		int64	cycles;
+		if (f->mIdent && mProfile->Lookup(f->mIdent, cycles))
+		{
+			if (cycles == 0)
+				f->mFlags |= DTF_FUNC_COLD;
+			else if (cycles * ProfileHotShare >= mProfile->mTotalCycles)
+			{
+				f->mFlags |= DTF_FUNC_HOT;
+				if (!(f->mFlags & (DTF_FUNC_ASSEMBLER | DTF_INTRINSIC)))
+					f->mFlags |= DTF_NATIVE;
+			}
+		}
+	}
+}
+
 void GlobalAnalyzer::AutoInline(void)
 {
 	bool	changed = false;
@@ -76,7 +111,9 @@ void GlobalAnalyzer::AutoInline(void)
 					doinline = true;
 				if ((mCompilerOptions & COPT_OPTIMIZE_AUTO_INLINE) && (cost * (f->mCallers.Size() - 1) <= 0))
 					doinline = true;
-				if ((mCompilerOptions & COPT_OPTIMIZE_AUTO_INLINE_ALL) && (cost * (f->mCallers.Size() - 1) <= 10000))
+				if ((mCompilerOptions & COPT_OPTIMIZE_AUTO_INLINE_ALL) && !(f->mFlags & DTF_FUNC_COLD) && (cost * (f->mCallers.Size() - 1) <= 10000))
+					doinline = true;
+				if ((mCompilerOptions & COPT_OPTIMIZE_AUTO_INLINE) && (f->mFlags & DTF_FUNC_HOT) && (cost * (f->mCallers.Size() - 1) <= 10000))
 					doinline = true;
 
 				if (doinline)
@@ -89,6 +126,11 @@ void GlobalAnalyzer::AutoInline(void)
 					{
 						Declaration* cf = f->mCallers[j];
 
+						// The caller now executes the hot code, so it has to be compiled like it
+
+						if (f->mFlags & DTF_FUNC_HOT)
+							cf->mFlags = (cf->mFlags & ~DTF_FUNC_COLD) | (f->mFlags & (DTF_FUNC_HOT | DTF_NATIVE));
+
 						int sk = 0, dk = 0;
 						while (sk < cf->mCalled.Size())
 						{
@@ -156,7 +198,11 @@ void GlobalAnalyzer::AnalyzeProcedure(Expression* exp, Declaration* dec)
 		if (dec->mFlags & DTF_INTRINSIC)
 			;
 		else if (dec->mFlags & DTF_DEFINED)
+		{
+			if (dec->mBody)
+				exp = dec->mBody->mParser->ParseDeferredFunction(dec);
 			Analyze(exp, dec);
+		}
 		else
 			mErrors->Error(dec->mLocation, EERR_UNDEFINED_OBJECT, "Calling undefined function", dec->mIdent->mString);
 
@@ -429,3 +475,299 @@ void GlobalAnalyzer::RegisterProc(Declaration* to)
 		mVariableFunctions.Push(to);
 	}
 }
+
+// Call graph of the intermediate code procedures and the procedures reachable
+// from each, a procedure is recursive when it reaches itself.  A procedure is
+// unknown when it is called through a pointer, from byte code, from assembler
+// or from anywhere else outside the graph, and so is everything it calls.
+
+void GlobalAnalyzer::BuildCallGraph(InterCodeModule* mod, GrowingArray<int>& edges, GrowingArray<int>& first, GrowingArray<bool>& unknown, NumberSet* reach)
+{
+	int	n = mod->mProcedures.Size();
+
+	GrowingArray<Declaration*>	decs(nullptr);
+	decs.SetSize(n);
+
+	for (int i = 0; i < mFunctions.Size(); i++)
+	{
+		Declaration* f = mFunctions[i];
+		if (f->mLinkerObject && f->mLinkerObject->mProc)
+			decs[f->mLinkerObject->mProc->mID] = f;
+	}
+
+	unknown.SetSize(n);
+
+	NumberSet	addressed(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeProcedure* proc = mod->mProcedures[i];
+
+		first.Push(edges.Size());
+		for (int j = 0; j < proc->mCalledFunctions.Size(); j++)
+			edges.Push(proc->mCalledFunctions[j]->mID);
+
+		Declaration* dec = decs[i];
+		if (dec)
+		{
+			for (int j = 0; j < dec->mCalled.Size(); j++)
+			{
+				Declaration* cdec = dec->mCalled[j];
+				if (cdec->mType == DT_CONST_FUNCTION && cdec->mLinkerObject && cdec->mLinkerObject->mProc)
+					edges.Push(cdec->mLinkerObject->mProc->mID);
+			}
+		}
+
+		if (!dec || (dec->mFlags & DTF_FUNC_VARIABLE) || !proc->mNativeProcedure || proc->mHasInlineAssembler)
+			unknown[i] = true;
+
+		proc->CollectAddressedProcedures(addressed);
+	}
+	first.Push(edges.Size());
+
+	for (int i = 0; i < n; i++)
+		if (addressed[i])
+			unknown[i] = true;
+
+	for (int i = 0; i < n; i++)
+		reach[i].Reset(n);
+
+	bool	changed;
+	do
+	{
+		changed = false;
+		for (int i = 0; i < n; i++)
+		{
+			for (int j = first[i]; j < first[i + 1]; j++)
+			{
+				int	c = edges[j];
+				if (!reach[i][c] || !(reach[c] <= reach[i]))
+				{
+					reach[i] += c;
+					reach[i] |= reach[c];
+					changed = true;
+				}
+			}
+		}
+	} while (changed);
+
+	GrowingArray<int>	stack(0);
+	for (int i = 0; i < n; i++)
+		if (unknown[i])
+			stack.Push(i);
+
+	while (stack.Size() > 0)
+	{
+		int	i = stack.Pop();
+		for (int j = first[i]; j < first[i + 1]; j++)
+		{
+			int	c = edges[j];
+			if (!unknown[c])
+			{
+				unknown[c] = true;
+				stack.Push(c);
+			}
+		}
+	}
+}
+
+// The callee saved temporaries of a native procedure are placed above the
+// range its callees may leave modified, so it does not have to save them on
+// entry.  Unknown procedures keep the fixed range and save it.  Recursive
+// procedures save their range above their callees.  The ranges stay in the
+// 32 registers saved by setjmp.
+
+static const int	StaticTempsSize = 32;
+
+void GlobalAnalyzer::AllocateZeroPage(InterCodeModule* mod)
+{
+	int	n = mod->mProcedures.Size();
+
+	GrowingArray<int>	edges(0), first(0);
+	GrowingArray<bool>	unknown(false);
+
+	NumberSet* reach = new NumberSet[n];
+	BuildCallGraph(mod, edges, first, unknown, reach);
+
+	GrowingArray<int>	base(0), clobber(0), size(0);
+	GrowingArray<bool>	saver(false);
+	base.SetSize(n);
+	clobber.SetSize(n);
+	size.SetSize(n);
+	saver.SetSize(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeProcedure* proc = mod->mProcedures[i];
+		size[i] = proc->mTempSize > 16 ? proc->mTempSize - 16 : 0;
+		saver[i] = unknown[i] || reach[i][i];
+	}
+
+	bool	changed, overflow;
+	do
+	{
+		// The base of a procedure is the largest range left modified by its
+		// callees, a saving procedure leaves only the range of its callees
+		// modified.  All members of a recursive cycle share their base.
+
+		for (int i = 0; i < n; i++)
+		{
+			base[i] = 0;
+			clobber[i] = 0;
+		}
+
+		do
+		{
+			changed = false;
+			for (int i = 0; i < n; i++)
+			{
+				if (!unknown[i])
+				{
+					int	b = 0;
+					for (int k = 0; k < n; k++)
+					{
+						if (k == i || reach[i][k] && reach[k][i])
+						{
+							for (int j = first[k]; j < first[k + 1]; j++)
+							{
+								int	c = edges[j];
+								if (!(reach[i][c] && reach[c][i]) && clobber[c] > b)
+									b = clobber[c];
+							}
+						}
+					}
+
+					int	c = saver[i] ? b : b + size[i];
+					if (b != base[i] || c != clobber[i])
+					{
+						base[i] = b;
+						clobber[i] = c;
+						changed = true;
+					}
+				}
+			}
+		} while (changed);
+
+		// A range beyond the saved registers is brought down by letting the
+		// static procedure that pushed it up save its range
+
+		overflow = false;
+		for (int i = 0; i < n && !overflow; i++)
+		{
+			if (base[i] > 0 && base[i] + size[i] > StaticTempsSize)
+			{
+				int	k = i;
+				while (!overflow)
+				{
+					int	m = -1;
+					for (int l = 0; l < n && m < 0; l++)
+					{
+						if (l == k || reach[k][l] && reach[l][k])
+						{
+							for (int j = first[l]; j < first[l + 1] && m < 0; j++)
+							{
+								int	c = edges[j];
+								if (!(reach[k][c] && reach[c][k]) && clobber[c] == base[k])
+									m = c;
+							}
+						}
+					}
+
+					if (saver[m])
+						k = m;
+					else
+					{
+						saver[m] = true;
+						overflow = true;
+					}
+				}
+			}
+		}
+
+	} while (overflow);
+
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeProcedure* proc = mod->mProcedures[i];
+		proc->mTempBase = base[i];
+		proc->mStaticTemps = !saver[i];
+	}
+
+	delete[] reach;
+}
+
+// Procedures that are neither unknown nor recursive place their locals into a
+// static frame instead of the stack.  The locals of a procedure start above
+// those of all procedures that may be active when it is called, so procedures
+// that are never active at the same time overlay their locals.  The frame is
+// an object of the bss section, the stack section only reserves space at the
+// end of its region and does not place objects.
+
+void GlobalAnalyzer::AllocateStaticFrames(InterCodeModule* mod, const Location& loc, LinkerSection* section)
+{
+	int	n = mod->mProcedures.Size();
+
+	GrowingArray<int>	edges(0), first(0);
+	GrowingArray<bool>	unknown(false);
+
+	NumberSet* reach = new NumberSet[n];
+	BuildCallGraph(mod, edges, first, unknown, reach);
+
+	GrowingArray<int>	base(0), size(0);
+	base.SetSize(n);
+	size.SetSize(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		if (!unknown[i] && !reach[i][i])
+			size[i] = mod->mProcedures[i]->mLocalSize;
+	}
+
+	// Only acyclic paths add to the base, so this terminates
+
+	bool	changed;
+	do
+	{
+		changed = false;
+		for (int i = 0; i < n; i++)
+		{
+			for (int j = first[i]; j < first[i + 1]; j++)
+			{
+				int	c = edges[j];
+				if (base[i] + size[i] > base[c])
+				{
+					base[c] = base[i] + size[i];
+					changed = true;
+				}
+			}
+		}
+	} while (changed);
+
+	int	total = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (size[i] > 0 && base[i] + size[i] > total)
+			total = base[i] + size[i];
+	}
+
+	if (total > 0)
+	{
+		LinkerObject* frame = mLinker->AddObject(loc, Ident::Unique("sframe"), section, LOT_DATA);
+		frame->AddSpace(total);
+
+		for (int i = 0; i < n; i++)
+		{
+			if (size[i] > 0)
+			{
+				InterCodeProcedure* proc = mod->mProcedures[i];
+				int	offset = base[i];
+
+				proc->RunPass(OPASS_STATIC_FRAMES, [proc, frame, offset]() {
+					return proc->MapStaticFrame(frame, offset);
+				});
+			}
+		}
+	}
+
+	delete[] reach;
+}
@@ -3,6 +3,8 @@
 #include "Declaration.h"
 #include "Linker.h"
 #include "CompilerTypes.h"
+#include "Profile.h"
+#include "InterCode.h"
 
 class GlobalAnalyzer
 {
@@ -12,12 +14,16 @@ public:
 
 	void DumpCallGraph(void);
 	void AutoInline(void);
+	void ApplyProfile(void);
+	void AllocateZeroPage(InterCodeModule* mod);
+	void AllocateStaticFrames(InterCodeModule* mod, const Location& loc, LinkerSection* section);
 
 	void AnalyzeProcedure(Expression* exp, Declaration* procDec);
 	void AnalyzeAssembler(Expression* exp, Declaration* procDec);
 	void AnalyzeGlobalVariable(Declaration* dec);
 
 	uint64		mCompilerOptions;
+	Profile	*	mProfile;
 
 protected:
 	Errors* mErrors;
@@ -29,5 +35,7 @@ protected:
 
 	void RegisterCall(Declaration* from, Declaration* to);
 	void RegisterProc(Declaration* to);
+
+	void BuildCallGraph(InterCodeModule* mod, GrowingArray<int>& edges, GrowingArray<int>& first, GrowingArray<bool>& unknown, NumberSet* reach);
 };
 
@@ -1,47 +1,99 @@
 #include "Ident.h"
 #include "MachineTypes.h"
+#include "MemoryArena.h"
 #include <string.h>
+#include <mutex>
 
-Ident::~Ident()
+static unsigned int IHash(const char* str, int& length)
 {
-	delete[] mString;
-}
+	// FNV-1a with a final mix, so the low bits used to index the
+	// hash tables depend on all characters
 
-unsigned int IHash(const char* str)
-{
-	unsigned int	hash = 32324124;
+	unsigned int	hash = 2166136261u;
 	int		i = 0;
 	while (str[i])
 	{
-		hash = hash * 123211 + str[i];
+		hash = (hash ^ (unsigned char)str[i]) * 16777619u;
 		i++;
 	}
 
+	length = i;
+
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+
 	return hash;
 }
 
-Ident::Ident(const char* str, unsigned int hash)
+Ident::Ident(char* str, int length, unsigned int hash)
+	: mString(str), mHash(hash), mLength(length)
 {
-	int	ssize = strlen(str);
-	mString = new char[ssize + 1];
-	strcpy_s(mString, ssize + 1, str);
-
-	mHash = hash;
 }
 
-Ident	*	UniqueIdents[0x10000];
+static MemoryArena	*	IdentArena;
+static Ident		**	UniqueIdents;
+static int				UniqueIdentsSize, UniqueIdentsFill;
+static std::mutex		UniqueIdentsMutex;
 
 const Ident* Ident::Unique(const char* str)
 {
-	unsigned int hash = IHash(str);
-	int i = hash & 0xffff;
-	while (UniqueIdents[i])
+	int		length;
+	unsigned int hash = IHash(str, length);
+
+	std::lock_guard<std::mutex>	lock(UniqueIdentsMutex);
+
+	if (!UniqueIdents)
+	{
+		IdentArena = new MemoryArena();
+		UniqueIdentsSize = 4096;
+		UniqueIdentsFill = 0;
+		UniqueIdents = new Ident * [UniqueIdentsSize]();
+	}
+
+	int		hm = UniqueIdentsSize - 1;
+	int		hi = hash & hm;
+	while (Ident* ident = UniqueIdents[hi])
 	{
-		if (!strcmp(UniqueIdents[i]->mString, str))
-			return UniqueIdents[i];
-		i = (i + 1) & 0xffff;
+		if (ident->mHash == hash && ident->mLength == length && !memcmp(ident->mString, str, length))
+			return ident;
+		hi = (hi + 1) & hm;
 	}
-	return UniqueIdents[i] = new Ident(str, hash);
+
+	char* mem = (char*)IdentArena->Allocate(sizeof(Ident) + length + 1);
+	char* nstr = mem + sizeof(Ident);
+	memcpy(nstr, str, length + 1);
+
+	Ident* ident = new (mem) Ident(nstr, length, hash);
+	UniqueIdents[hi] = ident;
+	UniqueIdentsFill++;
+
+	if (2 * UniqueIdentsFill >= UniqueIdentsSize)
+	{
+		int			size = UniqueIdentsSize;
+		Ident	**	idents = UniqueIdents;
+
+		UniqueIdentsSize *= 2;
+		UniqueIdents = new Ident * [UniqueIdentsSize]();
+
+		hm = UniqueIdentsSize - 1;
+		for (int i = 0; i < size; i++)
+		{
+			if (idents[i])
+			{
+				hi = idents[i]->mHash & hm;
+				while (UniqueIdents[hi])
+					hi = (hi + 1) & hm;
+				UniqueIdents[hi] = idents[i];
+			}
+		}
+
+		delete[] idents;
+	}
+
+	return ident;
 }
 
 
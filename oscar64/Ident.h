@@ -1,16 +1,19 @@
 #pragma once
 
+// Identifiers are unique, two identifiers with the same name are the same
+// object.  They are interned in a growing hash table and allocated together
+// with their names in an arena, they live as long as the process.
+
 class Ident
 {
 public:
-	~Ident();
-
 	char		*	mString;
 	unsigned int	mHash;
+	int				mLength;
 
 	static const Ident* Unique(const char* str);
 protected:
-	Ident(const char* str, unsigned int hash);
+	Ident(char* str, int length, unsigned int hash);
 };
 
 class IdentDict
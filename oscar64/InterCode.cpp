@@ -56,6 +56,23 @@ ValueSet& ValueSet::operator=(const ValueSet& values)
 	return *this;
 }
 
+ValueSet::ValueSet(ValueSet&& values)
+	: mInstructions(values.mInstructions), mNum(values.mNum), mSize(values.mSize)
+{
+	values.mInstructions = nullptr;
+	values.mNum = 0;
+	values.mSize = 0;
+}
+
+ValueSet& ValueSet::operator=(ValueSet&& values)
+{
+	std::swap(mInstructions, values.mInstructions);
+	std::swap(mNum, values.mNum);
+	std::swap(mSize, values.mSize);
+
+	return *this;
+}
+
 ValueSet::~ValueSet(void)
 {
 	delete[] mInstructions;
@@ -362,7 +379,7 @@ void ValueSet::InsertValue(InterInstruction * ins)
 
 	if (mNum == mSize)
 	{
-		mSize *= 2;
+		mSize = mSize ? 2 * mSize : 32;
 		nins = new InterInstructionPtr[mSize];
 		for (i = 0; i < mNum; i++)
 			nins[i] = mInstructions[i];
@@ -514,7 +531,7 @@ bool InterInstruction::IsEqual(const InterInstruction* ins) const
 		if (!mSrc[i].IsEqual(ins->mSrc[i]))
 			return false;
 
-	if (mCode == IC_CONSTANT && !mConst.IsEqual(ins->mConst))
+	if ((mCode == IC_CONSTANT || mCode == IC_JUMPI) && !mConst.IsEqual(ins->mConst))
 		return false;
 
 	return true;
@@ -1471,12 +1488,54 @@ InterInstruction::InterInstruction(void)
 	mCode = IC_NONE;
 	mOperator = IA_NONE;
 
+	mSrc = mInlineSrc;
+	mMaxOperands = 3;
 	mNumOperands = 3;
 
 	mInUse = false;
+	mInvariant = false;
 	mVolatile = false;
 }
 
+InterInstruction::InterInstruction(const InterInstruction& ins)
+	: mCode(ins.mCode), mDst(ins.mDst), mConst(ins.mConst), mOperator(ins.mOperator), mNumOperands(ins.mNumOperands), mLocation(ins.mLocation),
+	mInUse(ins.mInUse), mInvariant(ins.mInvariant), mVolatile(ins.mVolatile)
+{
+	mSrc = mInlineSrc;
+	mMaxOperands = 3;
+	ReserveOperands(ins.mMaxOperands);
+
+	for (int i = 0; i < ins.mMaxOperands; i++)
+		mSrc[i] = ins.mSrc[i];
+}
+
+void* InterInstruction::operator new(size_t size)
+{
+	return MemoryArena::Current()->Allocate(size);
+}
+
+void InterInstruction::operator delete(void* ptr)
+{
+	// Memory is returned with the arena of the procedure
+}
+
+void InterInstruction::ReserveOperands(int num)
+{
+	if (num > mMaxOperands)
+	{
+		// Operands beyond the inline ones, e.g. the variables referenced by inline assembler,
+		// are taken from the arena of the instruction, so it stays free of a destructor
+
+		InterOperand* src = (InterOperand*)MemoryArena::Current()->Allocate(num * sizeof(InterOperand));
+		for (int i = 0; i < num; i++)
+			new (src + i) InterOperand();
+		for (int i = 0; i < mMaxOperands; i++)
+			src[i] = mSrc[i];
+		mSrc = src;
+		mMaxOperands = num;
+	}
+}
+
 void InterInstruction::SetCode(const Location& loc, InterCode code)
 {
 	this->mCode = code;
@@ -1743,7 +1802,7 @@ bool HasSideEffect(InterCode code)
 
 bool IsMoveable(InterCode code)
 {
-	if (HasSideEffect(code) || code == IC_COPY || code == IC_STRCPY || code == IC_STORE || code == IC_BRANCH || code == IC_POP_FRAME || code == IC_PUSH_FRAME)
+	if (HasSideEffect(code) || code == IC_COPY || code == IC_STRCPY || code == IC_STORE || code == IC_BRANCH || code == IC_JUMPI || code == IC_POP_FRAME || code == IC_PUSH_FRAME)
 		return false;
 	if (code == IC_RETURN || code == IC_RETURN_STRUCT || code == IC_RETURN_VALUE)
 		return false;
@@ -2224,6 +2283,12 @@ void InterInstruction::Disassemble(FILE* file)
 		case IC_JUMPF:
 			fprintf(file, "JUMPF");
 			break;
+		case IC_JUMPI:
+			fprintf(file, "JUMPI\t%d", int(mConst.mIntConst));
+			break;
+		case IC_PHI:
+			fprintf(file, "PHI");
+			break;
 		case IC_PUSH_FRAME:
 			fprintf(file, "PUSHF\t%d", int(mConst.mIntConst));
 			break;
@@ -2255,6 +2320,14 @@ void InterInstruction::Disassemble(FILE* file)
 		if (mDst.mTemp >= 0) fprintf(file, "R%d(%c)", mDst.mTemp, typechars[mDst.mType]);
 		fprintf(file, "\t<-\t");
 
+		if (this->mCode == IC_PHI)
+		{
+			for (int i = 0; i < mNumOperands; i++)
+				fprintf(file, "%sR%d(%c)", i ? ", " : "", mSrc[i].mTemp, typechars[mSrc[i].mType]);
+			fprintf(file, "\n");
+			return;
+		}
+
 		if (mSrc[2].mTemp >= 0) fprintf(file, "R%d(%c%c), ", mSrc[2].mTemp, typechars[mSrc[2].mType], mSrc[2].mFinal ? 'F' : '-');
 		if (mSrc[1].mTemp >= 0) 
 			fprintf(file, "R%d(%c%c), ", mSrc[1].mTemp, typechars[mSrc[1].mType], mSrc[1].mFinal ? 'F' : '-');
@@ -2287,8 +2360,12 @@ void InterInstruction::Disassemble(FILE* file)
 }
 
 InterCodeBasicBlock::InterCodeBasicBlock(void)
-	: mInstructions(nullptr), mEntryRenameTable(-1), mExitRenameTable(-1), mMergeTValues(nullptr), mTrueJump(nullptr), mFalseJump(nullptr), mDominator(nullptr)
+	: mInstructions(nullptr), mEntryRenameTable(-1), mExitRenameTable(-1), mMergeTValues(nullptr), mEntryBlocks(nullptr), mTrueJump(nullptr), mFalseJump(nullptr), mDominator(nullptr)
 {
+	mIndex = -1;
+	mNumEntries = 0;
+	mNumEntered = 0;
+	mVisited = false;
 	mInPath = false;
 	mLoopHead = false;
 	mChecked = false;
@@ -2299,6 +2376,16 @@ InterCodeBasicBlock::~InterCodeBasicBlock(void)
 {
 }
 
+void* InterCodeBasicBlock::operator new(size_t size)
+{
+	return MemoryArena::Current()->AllocateObject<InterCodeBasicBlock>(size);
+}
+
+void InterCodeBasicBlock::operator delete(void* ptr)
+{
+	// Destroyed when the arena of the procedure is released
+}
+
 
 void InterCodeBasicBlock::Append(InterInstruction * code)
 {
@@ -2332,6 +2419,19 @@ void InterCodeBasicBlock::CollectEntries(void)
 	}
 }
 
+void InterCodeBasicBlock::CollectPostOrder(GrowingInterCodeBasicBlockPtrArray& order)
+{
+	if (!mVisited)
+	{
+		mVisited = true;
+
+		if (mTrueJump) mTrueJump->CollectPostOrder(order);
+		if (mFalseJump) mFalseJump->CollectPostOrder(order);
+
+		order.Push(this);
+	}
+}
+
 static bool IsInfiniteLoop(InterCodeBasicBlock* head, InterCodeBasicBlock* block)
 {
 	if (!block->mChecked)
@@ -3126,20 +3226,6 @@ void InterCodeBasicBlock::BuildLocalTempSets(int num)
 	}
 }
 
-void InterCodeBasicBlock::BuildGlobalProvidedTempSet(NumberSet fromProvidedTemps)
-{
-	if (!mVisited || !(fromProvidedTemps <= mEntryProvidedTemps))
-	{
-		mEntryProvidedTemps |= fromProvidedTemps;
-		fromProvidedTemps |= exitProvidedTemps;
-
-		mVisited = true;
-
-		if (mTrueJump) mTrueJump->BuildGlobalProvidedTempSet(fromProvidedTemps);
-		if (mFalseJump) mFalseJump->BuildGlobalProvidedTempSet(fromProvidedTemps);
-	}
-}
-
 void InterCodeBasicBlock::PerformTempForwarding(TempForwardingTable& forwardingTable)
 {
 	int i;
@@ -3170,7 +3256,7 @@ void InterCodeBasicBlock::PerformTempForwarding(TempForwardingTable& forwardingT
 
 			if (mNumEntered < mNumEntries)
 			{
-				mMergeForwardingTable = localForwardingTable;
+				mMergeForwardingTable = std::move(localForwardingTable);
 				return;
 			}
 		}
@@ -3187,36 +3273,6 @@ void InterCodeBasicBlock::PerformTempForwarding(TempForwardingTable& forwardingT
 	}
 }
 
-bool InterCodeBasicBlock::BuildGlobalRequiredTempSet(NumberSet& fromRequiredTemps)
-{
-	bool revisit = false;
-	int	i;
-
-	if (!mVisited)
-	{
-		mVisited = true;
-
-		NumberSet	newRequiredTemps(mExitRequiredTemps);
-
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredTempSet(newRequiredTemps)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredTempSet(newRequiredTemps)) revisit = true;
-
-		if (!(newRequiredTemps <= mExitRequiredTemps))
-		{
-			revisit = true;
-
-			mExitRequiredTemps = newRequiredTemps;
-			newRequiredTemps -= mLocalProvidedTemps;
-			mEntryRequiredTemps |= newRequiredTemps;
-		}
-
-	}
-
-	fromRequiredTemps |= mEntryRequiredTemps;
-
-	return revisit;
-}
-
 bool InterCodeBasicBlock::RemoveUnusedResultInstructions(void)
 {
 	bool	changed = false;
@@ -3299,50 +3355,6 @@ void InterCodeBasicBlock::BuildStaticVariableSet(const GrowingVariableArray& sta
 	}
 }
 
-void InterCodeBasicBlock::BuildGlobalProvidedStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet fromProvidedVars)
-{
-	if (!mVisited || !(fromProvidedVars <= mEntryProvidedStatics))
-	{
-		mEntryProvidedStatics |= fromProvidedVars;
-		fromProvidedVars |= mExitProvidedStatics;
-
-		mVisited = true;
-
-		if (mTrueJump) mTrueJump->BuildGlobalProvidedStaticVariableSet(staticVars, fromProvidedVars);
-		if (mFalseJump) mFalseJump->BuildGlobalProvidedStaticVariableSet(staticVars, fromProvidedVars);
-	}
-}
-
-bool InterCodeBasicBlock::BuildGlobalRequiredStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet& fromRequiredVars)
-{
-	bool revisit = false;
-	int	i;
-
-	if (!mVisited)
-	{
-		mVisited = true;
-
-		NumberSet	newRequiredVars(mExitRequiredStatics);
-
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredStaticVariableSet(staticVars, newRequiredVars)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredStaticVariableSet(staticVars, newRequiredVars)) revisit = true;
-
-		if (!(newRequiredVars <= mExitRequiredStatics))
-		{
-			revisit = true;
-
-			mExitRequiredStatics = newRequiredVars;
-			newRequiredVars -= mLocalProvidedStatics;
-			mEntryRequiredStatics |= newRequiredVars;
-		}
-
-	}
-
-	fromRequiredVars |= mEntryRequiredStatics;
-
-	return revisit;
-}
-
 bool InterCodeBasicBlock::RemoveUnusedStaticStoreInstructions(const GrowingVariableArray& staticVars)
 {
 	bool	changed = false;
@@ -3416,59 +3428,6 @@ void InterCodeBasicBlock::BuildLocalVariableSets(const GrowingVariableArray& loc
 	}
 }
 
-void InterCodeBasicBlock::BuildGlobalProvidedVariableSet(const GrowingVariableArray& localVars, NumberSet fromProvidedVars, const GrowingVariableArray& params, NumberSet fromProvidedParams, InterMemory paramMemory)
-{
-	if (!mVisited || !(fromProvidedVars <= mEntryProvidedVars) || !(fromProvidedParams <= mEntryProvidedParams))
-	{
-		mEntryProvidedVars |= fromProvidedVars;
-		fromProvidedVars |= mExitProvidedVars;
-
-		mEntryProvidedParams |= fromProvidedParams;
-		fromProvidedParams |= mExitProvidedParams;
-
-		mVisited = true;
-
-		if (mTrueJump) mTrueJump->BuildGlobalProvidedVariableSet(localVars, fromProvidedVars, params, fromProvidedParams, paramMemory);
-		if (mFalseJump) mFalseJump->BuildGlobalProvidedVariableSet(localVars, fromProvidedVars, params, fromProvidedParams, paramMemory);
-	}
-}
-
-bool InterCodeBasicBlock::BuildGlobalRequiredVariableSet(const GrowingVariableArray& localVars, NumberSet& fromRequiredVars, const GrowingVariableArray& params, NumberSet& fromRequiredParams, InterMemory paramMemory)
-{
-	bool revisit = false;
-	int	i;
-
-	if (!mVisited)
-	{
-		mVisited = true;
-
-		NumberSet	newRequiredVars(mExitRequiredVars);
-		NumberSet	newRequiredParams(mExitRequiredParams);
-
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredVariableSet(localVars, newRequiredVars, params, newRequiredParams, paramMemory)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredVariableSet(localVars, newRequiredVars, params, newRequiredParams, paramMemory)) revisit = true;
-
-		if (!(newRequiredVars <= mExitRequiredVars) || !(newRequiredParams <= mExitRequiredParams))
-		{
-			revisit = true;
-
-			mExitRequiredVars = newRequiredVars;
-			newRequiredVars -= mLocalProvidedVars;
-			mEntryRequiredVars |= newRequiredVars;
-
-			mExitRequiredParams = newRequiredParams;
-			newRequiredParams -= mLocalProvidedParams;
-			mEntryRequiredParams |= newRequiredParams;
-		}
-
-	}
-
-	fromRequiredVars |= mEntryRequiredVars;
-	fromRequiredParams |= mEntryRequiredParams;
-
-	return revisit;
-}
-
 bool InterCodeBasicBlock::RemoveUnusedStoreInstructions(const GrowingVariableArray& localVars, const GrowingVariableArray& params, InterMemory paramMemory)
 {
 	bool	changed = false;
@@ -3541,8 +3500,8 @@ void InterCodeBasicBlock::PerformValueForwarding(const GrowingInstructionPtrArra
 
 			if (mNumEntered < mNumEntries)
 			{
-				mMergeTValues = ltvalue;
-				mMergeValues = lvalues;
+				mMergeTValues = std::move(ltvalue);
+				mMergeValues = std::move(lvalues);
 				return;
 			}
 		}
@@ -3803,7 +3762,7 @@ void InterCodeBasicBlock::PerformMachineSpecificValueUsageCheck(const GrowingIns
 
 			if (mNumEntered < mNumEntries)
 			{
-				mMergeTValues = ltvalue;
+				mMergeTValues = std::move(ltvalue);
 				return;
 			}
 		}
@@ -4112,6 +4071,82 @@ void InterCodeBasicBlock::MarkRelevantStatics(void)
 	}
 }
 
+void InterCodeBasicBlock::CollectAddressedProcedures(NumberSet& procs)
+{
+	if (!mVisited)
+	{
+		mVisited = true;
+
+		for (int i = 0; i < mInstructions.Size(); i++)
+		{
+			const InterInstruction* ins(mInstructions[i]);
+			if (ins->mCode == IC_CONSTANT && ins->mConst.mMemory == IM_PROCEDURE && ins->mConst.mLinkerObject && ins->mConst.mLinkerObject->mProc)
+				procs += ins->mConst.mLinkerObject->mProc->mID;
+
+			// The target of a direct call does not escape
+
+			for (int j = (ins->mCode == IC_CALL || ins->mCode == IC_CALL_NATIVE) ? 1 : 0; j < ins->mNumOperands; j++)
+			{
+				const InterOperand& op(ins->mSrc[j]);
+				if (op.mTemp < 0 && op.mMemory == IM_PROCEDURE && op.mLinkerObject && op.mLinkerObject->mProc)
+					procs += op.mLinkerObject->mProc->mID;
+			}
+		}
+
+		if (mTrueJump) mTrueJump->CollectAddressedProcedures(procs);
+		if (mFalseJump) mFalseJump->CollectAddressedProcedures(procs);
+	}
+}
+
+bool InterCodeBasicBlock::MapStaticFrame(const GrowingVariableArray& localVars, LinkerObject* frame, int offset)
+{
+	bool	changed = false;
+
+	if (!mVisited)
+	{
+		mVisited = true;
+
+		for (int i = 0; i < mInstructions.Size(); i++)
+		{
+			InterInstruction* ins = mInstructions[i];
+
+			for (int j = -1; j < ins->mNumOperands; j++)
+			{
+				InterOperand& op(j < 0 ? ins->mConst : ins->mSrc[j]);
+				if (op.mTemp < 0 && op.mMemory == IM_LOCAL)
+				{
+					op.mMemory = IM_GLOBAL;
+					op.mLinkerObject = frame;
+					op.mIntConst += offset + localVars[op.mVarIndex]->mOffset;
+					op.mVarIndex = -1;
+					changed = true;
+				}
+			}
+		}
+
+		if (mTrueJump && mTrueJump->MapStaticFrame(localVars, frame, offset))
+			changed = true;
+		if (mFalseJump && mFalseJump->MapStaticFrame(localVars, frame, offset))
+			changed = true;
+	}
+
+	return changed;
+}
+
+int InterCodeBasicBlock::CountInstructions(void)
+{
+	int	num = 0;
+	if (!mVisited)
+	{
+		mVisited = true;
+
+		num = mInstructions.Size();
+		if (mTrueJump) num += mTrueJump->CountInstructions();
+		if (mFalseJump) num += mFalseJump->CountInstructions();
+	}
+	return num;
+}
+
 bool InterCodeBasicBlock::PushSinglePathResultInstructions(void)
 {
 	int i;
@@ -4122,7 +4157,7 @@ bool InterCodeBasicBlock::PushSinglePathResultInstructions(void)
 	{
 		mVisited = true;
 
-		if (mTrueJump && mFalseJump)
+		if (mTrueJump && mFalseJump && mInstructions[mInstructions.Size() - 1]->mCode != IC_JUMPI)
 		{
 			NumberSet	trueExitRequiredTemps(mTrueJump->mEntryRequiredTemps), falseExitRequiredTems(mFalseJump->mEntryRequiredTemps);
 			NumberSet	providedTemps(mExitRequiredTemps.Size()), requiredTemps(mExitRequiredTemps.Size());
@@ -4796,7 +4831,7 @@ void InterCodeBasicBlock::PeepholeOptimization(void)
 		int	limit = mInstructions.Size() - 1;
 		if (limit >= 0 && mInstructions[limit]->mCode == IC_BRANCH)
 			limit -= 2;
-		else if (limit >= 0 && mInstructions[limit]->mCode == IC_JUMP)
+		else if (limit >= 0 && (mInstructions[limit]->mCode == IC_JUMP || mInstructions[limit]->mCode == IC_JUMPI))
 			limit -= 1;
 
 		int i = limit;
@@ -5188,18 +5223,40 @@ void InterCodeBasicBlock::Disassemble(FILE* file, bool dumpSets)
 InterCodeProcedure::InterCodeProcedure(InterCodeModule * mod, const Location & location, const Ident* ident, LinkerObject * linkerObject)
 	: mTemporaries(IT_NONE), mBlocks(nullptr), mLocation(location), mTempOffset(-1), mTempSizes(0), 
 	mRenameTable(-1), mRenameUnionTable(-1), mGlobalRenameTable(-1),
-	mValueForwardingTable(nullptr), mLocalVars(nullptr), mParamVars(nullptr), mModule(mod),
-	mIdent(ident), mLinkerObject(linkerObject),
-	mNativeProcedure(false), mLeafProcedure(false), mCallsFunctionPointer(false), mCalledFunctions(nullptr), mFastCallProcedure(false)
+	mValueForwardingTable(nullptr), mPostOrder(nullptr), mPostOrderIndex(-1), mPredStart(0), mPreds(0), mIDom(-1), mSSATemps(-1), mSSABase(0),
+	mLocalVars(nullptr), mParamVars(nullptr), mModule(mod),
+	mIdent(ident), mLinkerObject(linkerObject), mLinkerFlags(0),
+	mNativeProcedure(false), mLeafProcedure(false), mCallsFunctionPointer(false), mCalledFunctions(nullptr), mFastCallProcedure(false), mColdProcedure(false)
 {
 	mID = mModule->mProcedures.Size();
 	mModule->mProcedures.Push(this);
 	mLinkerObject->mProc = this;
 	mCallerSavedTemps = 16;
+	mTempBase = 0;
+	mStaticTemps = false;
+	mDataFlowSolves = 0;
+	mDataFlowVisits = 0;
+	mPassStatistics = nullptr;
 }
 
 InterCodeProcedure::~InterCodeProcedure(void)
 {
+	for (int i = 0; i < mLocalVars.Size(); i++)
+		delete mLocalVars[i];
+	for (int i = 0; i < mParamVars.Size(); i++)
+		delete mParamVars[i];
+
+	delete[] mPassStatistics;
+}
+
+void InterCodeProcedure::ReleaseCode(void)
+{
+	mEntryBlock = nullptr;
+	mBlocks.SetSize(0);
+	mPostOrder.SetSize(0);
+	mValueForwardingTable.SetSize(0);
+
+	mArena.Release();
 }
 
 void InterCodeProcedure::ResetVisited(void)
@@ -5257,88 +5314,245 @@ void InterCodeProcedure::BuildTraces(bool expand)
 	DisassembleDebug("BuildTraces");
 }
 
-void InterCodeProcedure::BuildDataFlowSets(void)
-{
-	int	numTemps = mTemporaries.Size();
+static const InterDataFlowSets TempDataFlowSets = {
+	&InterCodeBasicBlock::mLocalProvidedTemps,
+	&InterCodeBasicBlock::mEntryRequiredTemps, &InterCodeBasicBlock::mExitRequiredTemps,
+	&InterCodeBasicBlock::mEntryProvidedTemps, &InterCodeBasicBlock::exitProvidedTemps
+};
 
-	//
-	//	Build set with local provided/required temporaries
-	//
-	ResetVisited();
-	mEntryBlock->BuildLocalTempSets(numTemps);
+static const InterDataFlowSets VariableDataFlowSets = {
+	&InterCodeBasicBlock::mLocalProvidedVars,
+	&InterCodeBasicBlock::mEntryRequiredVars, &InterCodeBasicBlock::mExitRequiredVars,
+	&InterCodeBasicBlock::mEntryProvidedVars, &InterCodeBasicBlock::mExitProvidedVars
+};
 
-	//
-	// Build set of globaly provided temporaries
-	//
+static const InterDataFlowSets ParamDataFlowSets = {
+	&InterCodeBasicBlock::mLocalProvidedParams,
+	&InterCodeBasicBlock::mEntryRequiredParams, &InterCodeBasicBlock::mExitRequiredParams,
+	&InterCodeBasicBlock::mEntryProvidedParams, &InterCodeBasicBlock::mExitProvidedParams
+};
+
+static const InterDataFlowSets StaticDataFlowSets = {
+	&InterCodeBasicBlock::mLocalProvidedStatics,
+	&InterCodeBasicBlock::mEntryRequiredStatics, &InterCodeBasicBlock::mExitRequiredStatics,
+	&InterCodeBasicBlock::mEntryProvidedStatics, &InterCodeBasicBlock::mExitProvidedStatics
+};
+
+void InterCodeProcedure::BuildPostOrder(void)
+{
+	mPostOrder.SetSize(0, true);
 	ResetVisited();
-	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps));
+	mEntryBlock->CollectPostOrder(mPostOrder);
+
+	int	n = mPostOrder.Size();
+
+	mPostOrderIndex.SetSize(mBlocks.Size(), true);
+	for (int i = 0; i < n; i++)
+		mPostOrderIndex[mPostOrder[i]->mIndex] = i;
 
 	//
-	// Build set of globaly required temporaries, might need
-	// multiple iterations until it stabilizes
+	// Predecessors of each reachable block by post order index,
+	// mPreds[mPredStart[i]] .. mPreds[mPredStart[i + 1] - 1]
 	//
-	NumberSet	totalRequired(numTemps);
+	mPredStart.SetSize(n + 1, true);
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		if (block->mTrueJump) mPredStart[mPostOrderIndex[block->mTrueJump->mIndex] + 1]++;
+		if (block->mFalseJump) mPredStart[mPostOrderIndex[block->mFalseJump->mIndex] + 1]++;
+	}
+	for (int i = 0; i < n; i++)
+		mPredStart[i + 1] += mPredStart[i];
 
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired));
+	GrowingIntArray	fill(mPredStart);
+	mPreds.SetSize(mPredStart[n], true);
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		if (block->mTrueJump) mPreds[fill[mPostOrderIndex[block->mTrueJump->mIndex]]++] = i;
+		if (block->mFalseJump) mPreds[fill[mPostOrderIndex[block->mFalseJump->mIndex]]++] = i;
+	}
 }
 
-void InterCodeProcedure::RenameTemporaries(void)
+void InterCodeProcedure::SolveProvidedSets(const InterDataFlowSets& sets)
 {
-	int	numTemps = mTemporaries.Size();
-
 	//
-	// Now we can rename temporaries to remove false dependencies
+	// Forward problem, a value is provided on entry of a block if it is
+	// provided by any path from the procedure entry.  Blocks are processed
+	// in reverse post order, a block is only revisited when the provided
+	// set of one of its predecessors grew.
 	//
-	mRenameTable.SetSize(numTemps, true);
+	int	n = mPostOrder.Size();
 
-	int		i, j, numRename;
+	NumberSet	pending(n, true);
 
-	numRename = 0;
+	mDataFlowSolves++;
 
-	//
-	// First localy rename all temporaries
-	//
-	ResetVisited();
-	mEntryBlock->LocalRenameRegister(mRenameTable, numRename);
+	int	i = n - 1;
+	while (i >= 0)
+	{
+		if (pending[i])
+		{
+			pending -= i;
+			mDataFlowVisits++;
 
-	DisassembleDebug("local renamed temps");
+			InterCodeBasicBlock* block = mPostOrder[i];
 
-	//
-	// Build a union find data structure for rename merging, this
-	// merges renames temporaries back, that have been renamed differently
-	// on separate paths.
-	//
-	mRenameUnionTable.SetSize(numRename);
-	for (i = 0; i < numRename; i++)
-		mRenameUnionTable[i] = i;
+			NumberSet	provided(block->*sets.mEntryProvided);
+			provided |= block->*sets.mExitProvided;
 
-	//
-	// Build global rename table using a union/find algorithm
-	//
-	mRenameTable.SetSize(numTemps, true);
+			int	next = i - 1;
 
-	ResetVisited();
-	mEntryBlock->BuildGlobalRenameRegisterTable(mRenameTable, mRenameUnionTable);
+			InterCodeBasicBlock* succ[2] = { block->mTrueJump, block->mFalseJump };
+			for (int j = 0; j < 2; j++)
+			{
+				if (succ[j] && !(provided <= succ[j]->*sets.mEntryProvided))
+				{
+					succ[j]->*sets.mEntryProvided |= provided;
+
+					int	si = mPostOrderIndex[succ[j]->mIndex];
+					pending += si;
+					if (si > next)
+						next = si;
+				}
+			}
+
+			i = next;
+		}
+		else
+			i--;
+	}
+}
 
+void InterCodeProcedure::SolveRequiredSets(const InterDataFlowSets& sets)
+{
 	//
-	// Now calculate the global temporary IDs for all local ids
+	// Backward problem, a value is required on exit of a block if it is
+	// required on entry of any successor.  Blocks are processed in post
+	// order, a block is only revisited when the required set on entry
+	// of one of its successors grew.
 	//
-	int		numRenamedTemps;
+	int	n = mPostOrder.Size();
 
-	mGlobalRenameTable.SetSize(numRename, true);
+	NumberSet	pending(n, true);
 
-	numRenamedTemps = 0;
+	mDataFlowSolves++;
 
-	for (i = 0; i < numRename; i++)
+	int	i = 0;
+	while (i < n)
 	{
-		j = Find(mRenameUnionTable, i);
+		if (pending[i])
+		{
+			pending -= i;
+			mDataFlowVisits++;
 
-		if (mGlobalRenameTable[j] < 0)
-			mGlobalRenameTable[j] = numRenamedTemps++;
+			InterCodeBasicBlock* block = mPostOrder[i];
 
-		mGlobalRenameTable[i] = mGlobalRenameTable[j];
+			NumberSet	required(block->*sets.mExitRequired);
+			if (block->mTrueJump) required |= block->mTrueJump->*sets.mEntryRequired;
+			if (block->mFalseJump) required |= block->mFalseJump->*sets.mEntryRequired;
+
+			int	next = i + 1;
+
+			if (!(required <= block->*sets.mExitRequired))
+			{
+				block->*sets.mExitRequired = required;
+				required -= block->*sets.mLocalProvided;
+
+				if (!(required <= block->*sets.mEntryRequired))
+				{
+					block->*sets.mEntryRequired |= required;
+
+					for (int j = mPredStart[i]; j < mPredStart[i + 1]; j++)
+					{
+						int	pi = mPreds[j];
+						pending += pi;
+						if (pi < next)
+							next = pi;
+					}
+				}
+			}
+
+			i = next;
+		}
+		else
+			i++;
+	}
+}
+
+void InterCodeProcedure::BuildDataFlowSets(void)
+{
+	int	numTemps = mTemporaries.Size();
+
+	//
+	//	Build set with local provided/required temporaries
+	//
+	ResetVisited();
+	mEntryBlock->BuildLocalTempSets(numTemps);
+
+	//
+	// Build set of globaly provided and required temporaries
+	//
+	BuildPostOrder();
+	SolveProvidedSets(TempDataFlowSets);
+	SolveRequiredSets(TempDataFlowSets);
+}
+
+void InterCodeProcedure::RenameTemporaries(void)
+{
+	int	numTemps = mTemporaries.Size();
+
+	//
+	// Now we can rename temporaries to remove false dependencies
+	//
+	mRenameTable.SetSize(numTemps, true);
+
+	int		i, j, numRename;
+
+	numRename = 0;
+
+	//
+	// First localy rename all temporaries
+	//
+	ResetVisited();
+	mEntryBlock->LocalRenameRegister(mRenameTable, numRename);
+
+	DisassembleDebug("local renamed temps");
+
+	//
+	// Build a union find data structure for rename merging, this
+	// merges renames temporaries back, that have been renamed differently
+	// on separate paths.
+	//
+	mRenameUnionTable.SetSize(numRename);
+	for (i = 0; i < numRename; i++)
+		mRenameUnionTable[i] = i;
+
+	//
+	// Build global rename table using a union/find algorithm
+	//
+	mRenameTable.SetSize(numTemps, true);
+
+	ResetVisited();
+	mEntryBlock->BuildGlobalRenameRegisterTable(mRenameTable, mRenameUnionTable);
+
+	//
+	// Now calculate the global temporary IDs for all local ids
+	//
+	int		numRenamedTemps;
+
+	mGlobalRenameTable.SetSize(numRename, true);
+
+	numRenamedTemps = 0;
+
+	for (i = 0; i < numRename; i++)
+	{
+		j = Find(mRenameUnionTable, i);
+
+		if (mGlobalRenameTable[j] < 0)
+			mGlobalRenameTable[j] = numRenamedTemps++;
+
+		mGlobalRenameTable[i] = mGlobalRenameTable[j];
 	}
 
 	mTemporaries.SetSize(numRenamedTemps, true);
@@ -5382,14 +5596,9 @@ void InterCodeProcedure::RemoveUnusedInstructions(void)
 		ResetVisited();
 		mEntryBlock->BuildLocalTempSets(numTemps);
 
-		ResetVisited();
-		mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps));
-
-		NumberSet	totalRequired2(numTemps);
-
-		do {
-			ResetVisited();
-		} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired2));
+		BuildPostOrder();
+		SolveProvidedSets(TempDataFlowSets);
+		SolveRequiredSets(TempDataFlowSets);
 
 		ResetVisited();
 	} while (mEntryBlock->RemoveUnusedResultInstructions());
@@ -5404,7 +5613,12 @@ void InterCodeProcedure::Close(void)
 
 	DisassembleDebug("start");
 
-	BuildTraces(true);
+	// Code that never ran in the profile is not duplicated into its predecessors
+
+	RunPass(OPASS_TRACES, [this]() {
+		BuildTraces(!mColdProcedure);
+		return false;
+	});
 
 	ResetVisited();
 	mLeafProcedure = mEntryBlock->IsLeafProcedure();
@@ -5423,11 +5637,16 @@ void InterCodeProcedure::Close(void)
 	else
 		mCommonFrameSize = 0;
 
-	BuildDataFlowSets();
-
-	RenameTemporaries();
+	RunPass(OPASS_RENAME_TEMPS, [this]() {
+		BuildDataFlowSets();
+		RenameTemporaries();
+		return false;
+	});
 
-	TempForwarding();
+	RunPass(OPASS_TEMP_FORWARDING, [this]() {
+		TempForwarding();
+		return false;
+	});
 
 	int	numTemps = mTemporaries.Size();
 
@@ -5455,31 +5674,35 @@ void InterCodeProcedure::Close(void)
 	FastNumberSet	tvalidSet(numTemps + 32);
 
 
-	bool	eliminated;
 	//
 	//	Now forward constant values
 	//
-	do {
-		valueSet.FlushAll();
-		mValueForwardingTable.SetSize(numTemps, true);
-		tvalidSet.Reset(numTemps + 32);
+	RunPass(OPASS_VALUE_FORWARDING, [&]() {
+		bool	eliminated, changed = false;
+		do {
+			valueSet.FlushAll();
+			mValueForwardingTable.SetSize(numTemps, true);
+			tvalidSet.Reset(numTemps + 32);
 
-		ResetVisited();
-		mEntryBlock->PerformValueForwarding(mValueForwardingTable, valueSet, tvalidSet, mLocalAliasedSet, mParamAliasedSet, numTemps, mModule->mGlobalVars);
+			ResetVisited();
+			mEntryBlock->PerformValueForwarding(mValueForwardingTable, valueSet, tvalidSet, mLocalAliasedSet, mParamAliasedSet, numTemps, mModule->mGlobalVars);
 
-		ResetVisited();
-		eliminated = mEntryBlock->EliminateDeadBranches();
-		if (eliminated)
-		{
-			BuildTraces(false);
-			/*
 			ResetVisited();
-			for (int i = 0; i < mBlocks.Size(); i++)
-				mBlocks[i]->mNumEntries = 0;
-			mEntryBlock->CollectEntries();
-			*/
-		}
-	} while (eliminated);
+			eliminated = mEntryBlock->EliminateDeadBranches();
+			if (eliminated)
+			{
+				BuildTraces(false);
+				/*
+				ResetVisited();
+				for (int i = 0; i < mBlocks.Size(); i++)
+					mBlocks[i]->mNumEntries = 0;
+				mEntryBlock->CollectEntries();
+				*/
+				changed = true;
+			}
+		} while (eliminated);
+		return changed;
+	});
 
 
 	DisassembleDebug("value forwarding");
@@ -5487,10 +5710,12 @@ void InterCodeProcedure::Close(void)
 	mValueForwardingTable.SetSize(numTemps, true);
 	mTemporaries.SetSize(numTemps, true);
 
-	ResetVisited();
-	mEntryBlock->PerformMachineSpecificValueUsageCheck(mValueForwardingTable, tvalidSet);
+	RunPass(OPASS_CONSTANT_PROPAGATION, [&]() {
+		ResetVisited();
+		mEntryBlock->PerformMachineSpecificValueUsageCheck(mValueForwardingTable, tvalidSet);
 
-	GlobalConstantPropagation();
+		return GlobalConstantPropagation();
+	});
 
 	DisassembleDebug("machine value forwarding");
 
@@ -5498,11 +5723,14 @@ void InterCodeProcedure::Close(void)
 	// Now remove needless temporary moves, that apear due to
 	// stack evaluation
 	//
-	mTempForwardingTable.Reset();
-	mTempForwardingTable.SetSize(numTemps);
+	RunPass(OPASS_TEMP_FORWARDING, [&]() {
+		mTempForwardingTable.Reset();
+		mTempForwardingTable.SetSize(numTemps);
 
-	ResetVisited();
-	mEntryBlock->PerformTempForwarding(mTempForwardingTable);
+		ResetVisited();
+		mEntryBlock->PerformTempForwarding(mTempForwardingTable);
+		return false;
+	});
 
 	DisassembleDebug("temp forwarding 2");
 
@@ -5511,21 +5739,20 @@ void InterCodeProcedure::Close(void)
 	// Now remove unused instructions
 	//
 
-	do {
-		ResetVisited();
-		mEntryBlock->BuildLocalTempSets(numTemps);
-
-		ResetVisited();
-		mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps));
-
-		NumberSet	totalRequired2(numTemps);
-
+	RunPass(OPASS_DEAD_CODE, [&]() {
+		bool	changed = false;
 		do {
 			ResetVisited();
-		} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired2));
+			mEntryBlock->BuildLocalTempSets(numTemps);
 
-		ResetVisited();
-	} while (mEntryBlock->RemoveUnusedResultInstructions());
+			BuildPostOrder();
+			SolveProvidedSets(TempDataFlowSets);
+			SolveRequiredSets(TempDataFlowSets);
+
+			ResetVisited();
+		} while (mEntryBlock->RemoveUnusedResultInstructions() && (changed = true));
+		return changed;
+	});
 
 	DisassembleDebug("removed unused instructions");
 
@@ -5552,22 +5779,22 @@ void InterCodeProcedure::Close(void)
 		// Now remove unused stores
 		//
 
-		do {
-			ResetVisited();
-			mEntryBlock->BuildLocalVariableSets(mLocalVars, mParamVars, paramMemory);
-
-			ResetVisited();
-			mEntryBlock->BuildGlobalProvidedVariableSet(mLocalVars, NumberSet(mLocalVars.Size()), mParamVars, NumberSet(mParamVars.Size()), paramMemory);
-
-			NumberSet	totalRequired2(mLocalVars.Size());
-			NumberSet	totalRequiredParams(mParamVars.Size());
-
+		RunPass(OPASS_DEAD_LOCAL_STORES, [&]() {
+			bool	changed = false;
 			do {
 				ResetVisited();
-			} while (mEntryBlock->BuildGlobalRequiredVariableSet(mLocalVars, totalRequired2, mParamVars, totalRequiredParams, paramMemory));
+				mEntryBlock->BuildLocalVariableSets(mLocalVars, mParamVars, paramMemory);
 
-			ResetVisited();
-		} while (mEntryBlock->RemoveUnusedStoreInstructions(mLocalVars, mParamVars, paramMemory));
+				BuildPostOrder();
+				SolveProvidedSets(VariableDataFlowSets);
+				SolveProvidedSets(ParamDataFlowSets);
+				SolveRequiredSets(VariableDataFlowSets);
+				SolveRequiredSets(ParamDataFlowSets);
+
+				ResetVisited();
+			} while (mEntryBlock->RemoveUnusedStoreInstructions(mLocalVars, mParamVars, paramMemory) && (changed = true));
+			return changed;
+		});
 
 		DisassembleDebug("removed unused local stores");
 	}
@@ -5576,21 +5803,20 @@ void InterCodeProcedure::Close(void)
 
 	if (mModule->mGlobalVars.Size())
 	{
-		do {
-			ResetVisited();
-			mEntryBlock->BuildStaticVariableSet(mModule->mGlobalVars);
-
-			ResetVisited();
-			mEntryBlock->BuildGlobalProvidedStaticVariableSet(mModule->mGlobalVars, NumberSet(mModule->mGlobalVars.Size()));
-
-			NumberSet	totalRequired2(mModule->mGlobalVars.Size());
-
+		RunPass(OPASS_DEAD_STATIC_STORES, [&]() {
+			bool	changed = false;
 			do {
 				ResetVisited();
-			} while (mEntryBlock->BuildGlobalRequiredStaticVariableSet(mModule->mGlobalVars, totalRequired2));
+				mEntryBlock->BuildStaticVariableSet(mModule->mGlobalVars);
 
-			ResetVisited();
-		} while (mEntryBlock->RemoveUnusedStaticStoreInstructions(mModule->mGlobalVars));
+				BuildPostOrder();
+				SolveProvidedSets(StaticDataFlowSets);
+				SolveRequiredSets(StaticDataFlowSets);
+
+				ResetVisited();
+			} while (mEntryBlock->RemoveUnusedStaticStoreInstructions(mModule->mGlobalVars) && (changed = true));
+			return changed;
+		});
 
 		DisassembleDebug("removed unused static stores");
 	}
@@ -5602,49 +5828,76 @@ void InterCodeProcedure::Close(void)
 		// Promote local variables to temporaries
 		//
 
-		FastNumberSet	simpleLocals(nlocals), complexLocals(nlocals);
-		GrowingTypeArray	localTypes(IT_NONE);
+		RunPass(OPASS_LOCALS_TO_TEMPS, [&]() {
+			FastNumberSet	simpleLocals(nlocals), complexLocals(nlocals);
+			GrowingTypeArray	localTypes(IT_NONE);
 
-		FastNumberSet	simpleParams(nparams), complexParams(nparams);
-		GrowingTypeArray	paramTypes(IT_NONE);
+			FastNumberSet	simpleParams(nparams), complexParams(nparams);
+			GrowingTypeArray	paramTypes(IT_NONE);
 
-		ResetVisited();
-		mEntryBlock->CollectSimpleLocals(complexLocals, simpleLocals, localTypes, complexParams, simpleParams, paramTypes);
+			ResetVisited();
+			mEntryBlock->CollectSimpleLocals(complexLocals, simpleLocals, localTypes, complexParams, simpleParams, paramTypes);
 
-		for (int i = 0; i < simpleLocals.Num(); i++)
-		{
-			int vi = simpleLocals.Element(i);
-			if (!complexLocals[vi])
+			bool	changed = false;
+			for (int i = 0; i < simpleLocals.Num(); i++)
 			{
-				ResetVisited();
-				mEntryBlock->SimpleLocalToTemp(vi, AddTemporary(localTypes[vi]));
+				int vi = simpleLocals.Element(i);
+				if (!complexLocals[vi])
+				{
+					ResetVisited();
+					mEntryBlock->SimpleLocalToTemp(vi, AddTemporary(localTypes[vi]));
+					changed = true;
+				}
 			}
-		}
+			return changed;
+		});
 
 		DisassembleDebug("local variables to temps");
 
-		BuildTraces(false);
+		RunPass(OPASS_TRACES, [this]() {
+			BuildTraces(false);
+			return false;
+		});
 
-		BuildDataFlowSets();
+		RunPass(OPASS_RENAME_TEMPS, [this]() {
+			BuildDataFlowSets();
+			RenameTemporaries();
+			return false;
+		});
 
-		RenameTemporaries();
+		RunPass(OPASS_SPARSE_CONSTANT_PROPAGATION, [this]() {
+			return SparseConditionalConstantPropagation();
+		});
 
-		do {
-			TempForwarding();
-		} while (GlobalConstantPropagation());
+		RunPass(OPASS_CONSTANT_PROPAGATION, [this]() {
+			bool	changed = false;
+			do {
+				TempForwarding();
+			} while (GlobalConstantPropagation() && (changed = true));
+			return changed;
+		});
 
 		//
 		// Now remove unused instructions
 		//
 
-		RemoveUnusedInstructions();
+		RunPass(OPASS_DEAD_CODE, [this]() {
+			RemoveUnusedInstructions();
+			return false;
+		});
 
 		DisassembleDebug("removed unused instructions 2");
 
-		TempForwarding();
+		RunPass(OPASS_TEMP_FORWARDING, [this]() {
+			TempForwarding();
+			return false;
+		});
 	}
 
-	BuildDominators();
+	RunPass(OPASS_DOMINATORS, [this]() {
+		BuildDominators();
+		return false;
+	});
 	DisassembleDebug("added dominators");
 
 	ResetVisited();
@@ -5652,83 +5905,182 @@ void InterCodeProcedure::Close(void)
 
 	BuildDataFlowSets();
 
-	ResetVisited();
-	mEntryBlock->OptimizeIntervalCompare();
+	RunPass(OPASS_INTERVAL_COMPARE, [this]() {
+		ResetVisited();
+		mEntryBlock->OptimizeIntervalCompare();
+		return false;
+	});
 
 	DisassembleDebug("interval compare");
 
 	BuildDataFlowSets();
 
-	ResetVisited();
-	mEntryBlock->PeepholeOptimization();
+	RunPass(OPASS_PEEPHOLE, [this]() {
+		ResetVisited();
+		mEntryBlock->PeepholeOptimization();
+		return false;
+	});
 
 	DisassembleDebug("Peephole optimized");
 
-	TempForwarding();
-	RemoveUnusedInstructions();
+	RunPass(OPASS_TEMP_FORWARDING, [this]() {
+		TempForwarding();
+		return false;
+	});
+	RunPass(OPASS_DEAD_CODE, [this]() {
+		RemoveUnusedInstructions();
+		return false;
+	});
 
-	ResetVisited();
-	mEntryBlock->SingleBlockLoopOptimisation(mParamAliasedSet);
+	RunPass(OPASS_SINGLE_BLOCK_LOOP, [this]() {
+		ResetVisited();
+		mEntryBlock->SingleBlockLoopOptimisation(mParamAliasedSet);
+		return false;
+	});
 
 	DisassembleDebug("single block loop opt");
 
+	RunPass(OPASS_LOOP_INVARIANT, [this]() {
+		return LoopInvariantCodeMotion();
+	});
+
+	RunPass(OPASS_INDUCTION_VARIABLES, [this]() {
+		return InductionVariableStrengthReduction();
+	});
+
+	RunPass(OPASS_VALUE_RANGE, [this]() {
+		return ValueRangeNarrowing();
+	});
+
 	BuildDataFlowSets();
 
-	ResetVisited();
-	mEntryBlock->PeepholeOptimization();
+	RunPass(OPASS_PEEPHOLE, [this]() {
+		ResetVisited();
+		mEntryBlock->PeepholeOptimization();
+		return false;
+	});
 
-	TempForwarding();
-	RemoveUnusedInstructions();
+	RunPass(OPASS_TEMP_FORWARDING, [this]() {
+		TempForwarding();
+		return false;
+	});
+	RunPass(OPASS_DEAD_CODE, [this]() {
+		RemoveUnusedInstructions();
+		return false;
+	});
 
 	DisassembleDebug("Peephole optimized");
 
-	bool	changed = false;
-	do
-	{
-		BuildDataFlowSets();
+	RunPass(OPASS_SINGLE_PATH, [this]() {
+		bool	changed, moved = false;
+		do
+		{
+			BuildDataFlowSets();
 
-		ResetVisited();
-		changed = mEntryBlock->PushSinglePathResultInstructions();
+			ResetVisited();
+			changed = mEntryBlock->PushSinglePathResultInstructions();
+			if (changed)
+				moved = true;
 
-	} while (changed);
+		} while (changed);
+		return moved;
+	});
 
 	BuildDataFlowSets();
 
-	TempForwarding();
-	RemoveUnusedInstructions();
+	RunPass(OPASS_TEMP_FORWARDING, [this]() {
+		TempForwarding();
+		return false;
+	});
+	RunPass(OPASS_DEAD_CODE, [this]() {
+		RemoveUnusedInstructions();
+		return false;
+	});
 
 	DisassembleDebug("Moved single path instructions");
 
-	FastNumberSet	activeSet(numTemps);
-
 	//
 	// And remove unused temporaries
 	//
 
-	ResetVisited();
-	mEntryBlock->CollectActiveTemporaries(activeSet);
+	RunPass(OPASS_REDUCE_TEMPS, [&]() {
+		FastNumberSet	activeSet(numTemps);
 
+		ResetVisited();
+		mEntryBlock->CollectActiveTemporaries(activeSet);
 
-	mTemporaries.SetSize(activeSet.Num(), true);
 
+		mTemporaries.SetSize(activeSet.Num(), true);
 
-	ResetVisited();
-	mEntryBlock->ShrinkActiveTemporaries(activeSet, mTemporaries);
 
-	MapVariables();
+		ResetVisited();
+		mEntryBlock->ShrinkActiveTemporaries(activeSet, mTemporaries);
+
+		MapVariables();
 
-	DisassembleDebug("mapped variabled");
+		DisassembleDebug("mapped variabled");
 
-	ReduceTemporaries();
+		ReduceTemporaries();
+		return false;
+	});
 
 	DisassembleDebug("Reduced Temporaries");
 
 	// Optimize for size
 
-	MergeBasicBlocks();
+	RunPass(OPASS_MERGE_BLOCKS, [this]() {
+		MergeBasicBlocks();
+		return false;
+	});
 	DisassembleDebug("Merged basic blocks");
 }
 
+bool InterCodeProcedure::RunPass(OptimizerPass pass, const std::function<bool(void)>& run)
+{
+	return RunPass(pass, run, [this]() { return NumInstructions(); });
+}
+
+bool InterCodeProcedure::RunPass(OptimizerPass pass, const std::function<bool(void)>& run, const std::function<int(void)>& count)
+{
+	PassManager* manager = mModule->mPassManager;
+
+	if (!manager)
+		return run();
+	else if (!manager->Enabled(pass, mIdent ? mIdent->mString : nullptr))
+		return false;
+	else if (!manager->mStatistics)
+		return run();
+	else
+	{
+		if (!mPassStatistics)
+			mPassStatistics = new PassStatistics[NUM_OPTIMIZER_PASSES];
+
+		int		before = count();
+		PassRun	prun(before);
+		bool	changed = run();
+		int		after = count();
+		prun.Finish(mPassStatistics[pass], changed || after != before, after);
+
+		return changed;
+	}
+}
+
+bool InterCodeProcedure::MapStaticFrame(LinkerObject* frame, int offset)
+{
+	ResetVisited();
+	bool	changed = mEntryBlock->MapStaticFrame(mLocalVars, frame, offset);
+
+	mLocalSize = 0;
+
+	return changed;
+}
+
+int InterCodeProcedure::NumInstructions(void)
+{
+	ResetVisited();
+	return mEntryBlock->CountInstructions();
+}
+
 void InterCodeProcedure::AddCalledFunction(InterCodeProcedure* proc)
 {
 	mCalledFunctions.Push(proc);
@@ -5746,6 +6098,12 @@ void InterCodeProcedure::MarkRelevantStatics(void)
 
 }
 
+void InterCodeProcedure::CollectAddressedProcedures(NumberSet& procs)
+{
+	ResetVisited();
+	mEntryBlock->CollectAddressedProcedures(procs);
+}
+
 void InterCodeProcedure::RemoveNonRelevantStatics(void)
 {
 	ResetVisited();
@@ -5901,23 +6259,2817 @@ bool InterCodeProcedure::GlobalConstantPropagation(void)
 	return mEntryBlock->PropagateConstTemps(ctemps);
 }
 
-void InterCodeProcedure::ReduceTemporaries(void)
+void InterCodeProcedure::BuildDominatorTree(void)
 {
-	NumberSet* collisionSet;
-	int i, j, numRenamedTemps;
-	int numTemps = mTemporaries.Size();
+	//
+	// Immediate dominators by post order index, the dominators of the
+	// predecessors are intersected in reverse post order until the tree
+	// is stable.  The entry block dominates itself.
+	//
+	int	n = mPostOrder.Size();
 
-	ResetVisited();
-	mEntryBlock->BuildLocalTempSets(numTemps);
+	mIDom.SetSize(n);
+	for (int i = 0; i < n; i++)
+		mIDom[i] = -1;
+	mIDom[n - 1] = n - 1;
+
+	bool	changed;
+	do
+	{
+		changed = false;
+		for (int i = n - 2; i >= 0; i--)
+		{
+			int	dom = -1;
+			for (int j = mPredStart[i]; j < mPredStart[i + 1]; j++)
+			{
+				int	p = mPreds[j];
+				if (mIDom[p] >= 0)
+				{
+					if (dom < 0)
+						dom = p;
+					else
+					{
+						while (dom != p)
+						{
+							while (dom < p)
+								dom = mIDom[dom];
+							while (p < dom)
+								p = mIDom[p];
+						}
+					}
+				}
+			}
+
+			if (dom != mIDom[i])
+			{
+				mIDom[i] = dom;
+				changed = true;
+			}
+		}
+	} while (changed);
+}
+
+void InterCodeProcedure::BuildSSA(void)
+{
+	BuildDataFlowSets();
+	BuildDominatorTree();
+
+	int	n = mPostOrder.Size();
+	int	numTemps = mTemporaries.Size();
+
+	mSSABase = numTemps;
+	mSSATemps.SetSize(numTemps);
+	for (int i = 0; i < numTemps; i++)
+		mSSATemps[i] = i;
+
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		block->mEntryBlocks.SetSize(0);
+		for (int j = mPredStart[i]; j < mPredStart[i + 1]; j++)
+			block->mEntryBlocks.Push(mPostOrder[mPreds[j]]);
+	}
+
+	//
+	// Dominance frontiers, a join block is in the frontier of each block
+	// on the dominator tree path from its predecessors up to its immediate
+	// dominator
+	//
+	GrowingIntArray	frontierStart(0), frontiers(0), frontierBlocks(0), frontierJoins(0), lastJoin(-1);
+
+	lastJoin.SetSize(n);
+	for (int i = 0; i < n; i++)
+		lastJoin[i] = -1;
+
+	for (int i = 0; i < n; i++)
+	{
+		if (mPredStart[i + 1] - mPredStart[i] > 1)
+		{
+			for (int j = mPredStart[i]; j < mPredStart[i + 1]; j++)
+			{
+				int	r = mPreds[j];
+				while (r != mIDom[i] && lastJoin[r] != i)
+				{
+					lastJoin[r] = i;
+					frontierBlocks.Push(r);
+					frontierJoins.Push(i);
+					r = mIDom[r];
+				}
+			}
+		}
+	}
+
+	frontierStart.SetSize(n + 1, true);
+	for (int i = 0; i < frontierBlocks.Size(); i++)
+		frontierStart[frontierBlocks[i] + 1]++;
+	for (int i = 0; i < n; i++)
+		frontierStart[i + 1] += frontierStart[i];
+	GrowingIntArray	fill(frontierStart);
+	frontiers.SetSize(frontierBlocks.Size());
+	for (int i = 0; i < frontierBlocks.Size(); i++)
+		frontiers[fill[frontierBlocks[i]]++] = frontierJoins[i];
+
+	//
+	// Place phi instructions on the iterated dominance frontier of the
+	// definitions of each temporary, but only where it is live on entry
+	//
+	GrowingIntArray	work(0);
+	NumberSet		hasPhi(n), queued(n);
+
+	for (int t = 0; t < numTemps; t++)
+	{
+		hasPhi.Clear();
+		queued.Clear();
+
+		for (int i = 0; i < n; i++)
+		{
+			if (mPostOrder[i]->mLocalProvidedTemps[t])
+			{
+				queued += i;
+				work.Push(i);
+			}
+		}
+
+		while (work.Size() > 0)
+		{
+			int	i = work.Pop();
+			for (int j = frontierStart[i]; j < frontierStart[i + 1]; j++)
+			{
+				int	d = frontiers[j];
+				InterCodeBasicBlock* block = mPostOrder[d];
+
+				if (!hasPhi[d] && block->mEntryRequiredTemps[t])
+				{
+					hasPhi += d;
+
+					InterInstruction* ins = new InterInstruction();
+					ins->mCode = IC_PHI;
+					ins->mLocation = block->mLocation;
+					ins->mDst.mTemp = t;
+					ins->mDst.mType = mTemporaries[t];
+					ins->ReserveOperands(block->mEntryBlocks.Size());
+					ins->mNumOperands = block->mEntryBlocks.Size();
+					for (int k = 0; k < ins->mNumOperands; k++)
+					{
+						ins->mSrc[k].mTemp = t;
+						ins->mSrc[k].mType = mTemporaries[t];
+					}
+					block->mInstructions.Insert(0, ins);
+
+					if (!queued[d])
+					{
+						queued += d;
+						work.Push(d);
+					}
+				}
+			}
+		}
+	}
+
+	//
+	// Rename each definition to a new temporary walking the dominator tree,
+	// uses without a reaching definition keep the original temporary
+	//
+	GrowingIntArray	domStart(0), domChildren(0), current(-1);
+
+	domStart.SetSize(n + 1, true);
+	for (int i = 0; i < n - 1; i++)
+		domStart[mIDom[i] + 1]++;
+	for (int i = 0; i < n; i++)
+		domStart[i + 1] += domStart[i];
+	fill = domStart;
+	domChildren.SetSize(n - 1);
+	for (int i = 0; i < n - 1; i++)
+		domChildren[fill[mIDom[i]]++] = i;
+
+	current.SetSize(numTemps);
+	for (int i = 0; i < numTemps; i++)
+		current[i] = -1;
+
+	RenameSSA(n - 1, current, domStart, domChildren);
+
+	DisassembleDebug("ssa form");
+}
+
+void InterCodeProcedure::RenameSSA(int bi, GrowingIntArray& current, const GrowingIntArray& domStart, const GrowingIntArray& domChildren)
+{
+	InterCodeBasicBlock* block = mPostOrder[bi];
+
+	GrowingIntArray	defined(0);
+
+	for (int i = 0; i < block->mInstructions.Size(); i++)
+	{
+		InterInstruction* ins = block->mInstructions[i];
+		if (ins->mCode != IC_NONE)
+		{
+			if (ins->mCode != IC_PHI)
+			{
+				for (int j = 0; j < ins->mNumOperands; j++)
+				{
+					int	t = ins->mSrc[j].mTemp;
+					if (t >= 0 && current[t] >= 0)
+						ins->mSrc[j].mTemp = current[t];
+				}
+			}
+
+			int	t = ins->mDst.mTemp;
+			if (t >= 0)
+			{
+				int	s = AddTemporary(mTemporaries[t]);
+				mSSATemps[s] = t;
+				defined.Push(t);
+				defined.Push(current[t]);
+				current[t] = s;
+				ins->mDst.mTemp = s;
+			}
+		}
+	}
+
+	for (int k = 0; k < 2; k++)
+	{
+		InterCodeBasicBlock* succ = k == 0 ? block->mTrueJump : block->mFalseJump;
+		if (succ && (k == 0 || succ != block->mTrueJump))
+		{
+			for (int j = 0; j < succ->mEntryBlocks.Size(); j++)
+			{
+				if (succ->mEntryBlocks[j] == block)
+				{
+					for (int i = 0; i < succ->mInstructions.Size() && succ->mInstructions[i]->mCode == IC_PHI; i++)
+					{
+						InterInstruction* ins = succ->mInstructions[i];
+						int	t = mSSATemps[ins->mDst.mTemp];
+						if (current[t] >= 0)
+							ins->mSrc[j].mTemp = current[t];
+					}
+				}
+			}
+		}
+	}
+
+	for (int i = domStart[bi]; i < domStart[bi + 1]; i++)
+		RenameSSA(domChildren[i], current, domStart, domChildren);
+
+	for (int i = defined.Size() - 2; i >= 0; i -= 2)
+		current[defined[i]] = defined[i + 1];
+}
+
+void InterCodeProcedure::DestroySSA(void)
+{
+	//
+	// The optimizations in SSA form do not move code, so all temporaries
+	// of one original temporary are merged back and the phi instructions
+	// are removed without copies
+	//
+	for (int i = 0; i < mBlocks.Size(); i++)
+	{
+		InterCodeBasicBlock* block = mBlocks[i];
+
+		int	j = 0;
+		while (j < block->mInstructions.Size())
+		{
+			InterInstruction* ins = block->mInstructions[j];
+			if (ins->mCode == IC_PHI)
+				block->mInstructions.Remove(j);
+			else
+			{
+				if (ins->mDst.mTemp >= 0)
+					ins->mDst.mTemp = mSSATemps[ins->mDst.mTemp];
+				for (int k = 0; k < ins->mNumOperands; k++)
+				{
+					if (ins->mSrc[k].mTemp >= 0)
+						ins->mSrc[k].mTemp = mSSATemps[ins->mSrc[k].mTemp];
+				}
+				j++;
+			}
+		}
+
+		block->mEntryBlocks.SetSize(0);
+	}
+
+	mTemporaries.SetSize(mSSABase);
+	mSSATemps.SetSize(0);
+}
+
+// Sparse conditional constant propagation on the SSA form after Wegman
+// and Zadeck.  Each temporary is unknown, a known integer constant or
+// varying, and only instructions in blocks reached by an executable edge
+// are evaluated, so constants flow through phi instructions and branches
+// that never execute.
+
+enum SCCPLattice : uint8
+{
+	SCCP_UNKNOWN,
+	SCCP_CONSTANT,
+	SCCP_VARYING
+};
+
+static bool SCCPType(InterType type)
+{
+	return type == IT_BOOL || IsIntegerType(type);
+}
+
+class SparseConstantPropagation
+{
+public:
+	SparseConstantPropagation(const GrowingInterCodeBasicBlockPtrArray& blocks, const GrowingIntArray& blockIndex, int numTemps, int numOriginal)
+		: mBlocks(blocks), mBlockIndex(blockIndex), mState(SCCP_UNKNOWN), mValue(0),
+		mUseStart(0), mUseBlocks(0), mUses(nullptr), mBlockWork(0), mTempWork(0),
+		mExecutable(blocks.Size()), mTrueEdges(blocks.Size()), mFalseEdges(blocks.Size())
+	{
+		mState.SetSize(numTemps, true);
+		mValue.SetSize(numTemps, true);
+		for (int i = 0; i < numOriginal; i++)
+			mState[i] = SCCP_VARYING;
+
+		int	n = blocks.Size();
+
+		mUseStart.SetSize(numTemps + 1, true);
+		for (int i = 0; i < n; i++)
+		{
+			const InterCodeBasicBlock* block = mBlocks[i];
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				const InterInstruction* ins = block->mInstructions[j];
+				if (ins->mCode != IC_NONE)
+				{
+					for (int k = 0; k < ins->mNumOperands; k++)
+						if (ins->mSrc[k].mTemp >= 0)
+							mUseStart[ins->mSrc[k].mTemp + 1]++;
+				}
+			}
+		}
+		for (int i = 0; i < numTemps; i++)
+			mUseStart[i + 1] += mUseStart[i];
+
+		GrowingIntArray	fill(mUseStart);
+		mUses.SetSize(mUseStart[numTemps]);
+		mUseBlocks.SetSize(mUseStart[numTemps]);
+		for (int i = 0; i < n; i++)
+		{
+			InterCodeBasicBlock* block = mBlocks[i];
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				InterInstruction* ins = block->mInstructions[j];
+				if (ins->mCode != IC_NONE)
+				{
+					for (int k = 0; k < ins->mNumOperands; k++)
+					{
+						int	t = ins->mSrc[k].mTemp;
+						if (t >= 0)
+						{
+							mUses[fill[t]] = ins;
+							mUseBlocks[fill[t]] = i;
+							fill[t]++;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void Run(void)
+	{
+		int	entry = mBlocks.Size() - 1;
+		mExecutable += entry;
+		mBlockWork.Push(entry);
+
+		while (mBlockWork.Size() > 0 || mTempWork.Size() > 0)
+		{
+			if (mBlockWork.Size() > 0)
+			{
+				int	bi = mBlockWork.Pop();
+				InterCodeBasicBlock* block = mBlocks[bi];
+				for (int i = 0; i < block->mInstructions.Size(); i++)
+					Evaluate(bi, block->mInstructions[i]);
+				EvaluateBranch(bi);
+			}
+			else
+			{
+				int	t = mTempWork.Pop();
+				for (int i = mUseStart[t]; i < mUseStart[t + 1]; i++)
+				{
+					int	bi = mUseBlocks[i];
+					if (mExecutable[bi])
+					{
+						Evaluate(bi, mUses[i]);
+						if (mUses[i]->mCode == IC_BRANCH)
+							EvaluateBranch(bi);
+					}
+				}
+			}
+		}
+	}
+
+	bool Executable(int bi) const
+	{
+		return mExecutable[bi];
+	}
+
+	bool Constant(int temp, int64& value) const
+	{
+		if (temp >= 0 && mState[temp] == SCCP_CONSTANT)
+		{
+			value = mValue[temp];
+			return true;
+		}
+		return false;
+	}
+
+protected:
+	const GrowingInterCodeBasicBlockPtrArray&	mBlocks;
+	const GrowingIntArray&						mBlockIndex;
+
+	GrowingArray<SCCPLattice>		mState;
+	GrowingArray<int64>				mValue;
+	GrowingIntArray					mUseStart, mUseBlocks;
+	GrowingInstructionPtrArray		mUses;
+	GrowingIntArray					mBlockWork, mTempWork;
+	NumberSet						mExecutable, mTrueEdges, mFalseEdges;
+
+	void Lower(int temp, SCCPLattice state, int64 value)
+	{
+		if (state == SCCP_UNKNOWN || mState[temp] == SCCP_VARYING)
+			return;
+
+		if (mState[temp] == SCCP_CONSTANT)
+		{
+			if (state == SCCP_CONSTANT && value == mValue[temp])
+				return;
+			state = SCCP_VARYING;
+		}
+
+		mState[temp] = state;
+		mValue[temp] = value;
+		mTempWork.Push(temp);
+	}
+
+	SCCPLattice Operand(const InterOperand& op, int64& value) const
+	{
+		if (op.mTemp < 0)
+		{
+			value = op.mIntConst;
+			return SCCP_CONSTANT;
+		}
+		value = mValue[op.mTemp];
+		return mState[op.mTemp];
+	}
+
+	bool EdgeExecutable(int from, int to) const
+	{
+		const InterCodeBasicBlock* block = mBlocks[from];
+		return
+			(mTrueEdges[from] && block->mTrueJump == mBlocks[to]) ||
+			(mFalseEdges[from] && block->mFalseJump == mBlocks[to]);
+	}
+
+	void MarkEdge(int bi, bool taken)
+	{
+		InterCodeBasicBlock* block = mBlocks[bi];
+		InterCodeBasicBlock* succ = taken ? block->mTrueJump : block->mFalseJump;
+		NumberSet& edges(taken ? mTrueEdges : mFalseEdges);
+
+		if (succ && !edges[bi])
+		{
+			edges += bi;
+
+			int	si = mBlockIndex[succ->mIndex];
+			if (!mExecutable[si])
+			{
+				mExecutable += si;
+				mBlockWork.Push(si);
+			}
+			else
+			{
+				for (int i = 0; i < succ->mInstructions.Size() && succ->mInstructions[i]->mCode == IC_PHI; i++)
+					Evaluate(si, succ->mInstructions[i]);
+			}
+		}
+	}
+
+	void EvaluateBranch(int bi)
+	{
+		InterCodeBasicBlock* block = mBlocks[bi];
+		int	n = block->mInstructions.Size();
+		InterCode	code = n > 0 ? block->mInstructions[n - 1]->mCode : IC_NONE;
+
+		if (code == IC_BRANCH)
+		{
+			int64		value;
+			SCCPLattice	state = Operand(block->mInstructions[n - 1]->mSrc[0], value);
+
+			if (state == SCCP_VARYING)
+			{
+				MarkEdge(bi, true);
+				MarkEdge(bi, false);
+			}
+			else if (state == SCCP_CONSTANT)
+				MarkEdge(bi, value != 0);
+		}
+		else if (code == IC_JUMP)
+			MarkEdge(bi, true);
+		else if (code == IC_JUMPF)
+			MarkEdge(bi, false);
+		else
+		{
+			MarkEdge(bi, true);
+			MarkEdge(bi, false);
+		}
+	}
+
+	void Evaluate(int bi, const InterInstruction* ins)
+	{
+		int	dst = ins->mDst.mTemp;
+		if (dst < 0 || ins->mCode == IC_NONE)
+			return;
+
+		if (!SCCPType(ins->mDst.mType))
+		{
+			Lower(dst, SCCP_VARYING, 0);
+			return;
+		}
+
+		int64		v0, v1;
+		SCCPLattice	s0, s1;
+
+		switch (ins->mCode)
+		{
+		case IC_CONSTANT:
+			Lower(dst, SCCP_CONSTANT, ins->mConst.mIntConst);
+			break;
+
+		case IC_LOAD_TEMPORARY:
+			if (SCCPType(ins->mSrc[0].mType))
+			{
+				s0 = Operand(ins->mSrc[0], v0);
+				Lower(dst, s0, v0);
+			}
+			else
+				Lower(dst, SCCP_VARYING, 0);
+			break;
+
+		case IC_PHI:
+		{
+			const InterCodeBasicBlock* block = mBlocks[bi];
+			for (int i = 0; i < ins->mNumOperands; i++)
+			{
+				if (EdgeExecutable(mBlockIndex[block->mEntryBlocks[i]->mIndex], bi))
+				{
+					s0 = Operand(ins->mSrc[i], v0);
+					Lower(dst, s0, v0);
+				}
+			}
+		}	break;
+
+		case IC_BINARY_OPERATOR:
+		case IC_RELATIONAL_OPERATOR:
+			if (SCCPType(ins->mSrc[0].mType) && SCCPType(ins->mSrc[1].mType))
+			{
+				s0 = Operand(ins->mSrc[0], v0);
+				s1 = Operand(ins->mSrc[1], v1);
+				if (s0 == SCCP_VARYING || s1 == SCCP_VARYING)
+					Lower(dst, SCCP_VARYING, 0);
+				else if (s0 == SCCP_CONSTANT && s1 == SCCP_CONSTANT)
+				{
+					switch (ins->mOperator)
+					{
+					case IA_DIVU:
+					case IA_DIVS:
+					case IA_MODU:
+					case IA_MODS:
+						if (v0 == 0)
+							Lower(dst, SCCP_VARYING, 0);
+						else
+							Lower(dst, SCCP_CONSTANT, ConstantFolding(ins->mOperator, ins->mDst.mType, v1, v0));
+						break;
+					case IA_SHL:
+					case IA_SHR:
+					case IA_SAR:
+						if (v0 < 0 || v0 >= 32)
+							Lower(dst, SCCP_VARYING, 0);
+						else
+							Lower(dst, SCCP_CONSTANT, ConstantFolding(ins->mOperator, ins->mDst.mType, v1, v0));
+						break;
+					case IA_ADD:
+					case IA_SUB:
+					case IA_MUL:
+					case IA_OR:
+					case IA_AND:
+					case IA_XOR:
+					case IA_CMPEQ:
+					case IA_CMPNE:
+					case IA_CMPGES:
+					case IA_CMPLES:
+					case IA_CMPGS:
+					case IA_CMPLS:
+					case IA_CMPGEU:
+					case IA_CMPLEU:
+					case IA_CMPGU:
+					case IA_CMPLU:
+						Lower(dst, SCCP_CONSTANT, ConstantFolding(ins->mOperator, ins->mDst.mType, v1, v0));
+						break;
+					default:
+						Lower(dst, SCCP_VARYING, 0);
+					}
+				}
+			}
+			else
+				Lower(dst, SCCP_VARYING, 0);
+			break;
+
+		case IC_UNARY_OPERATOR:
+			if (SCCPType(ins->mSrc[0].mType) && (ins->mOperator == IA_NEG || ins->mOperator == IA_NOT))
+			{
+				s0 = Operand(ins->mSrc[0], v0);
+				if (s0 == SCCP_CONSTANT)
+					Lower(dst, SCCP_CONSTANT, ConstantFolding(ins->mOperator, ins->mDst.mType, v0));
+				else
+					Lower(dst, s0, 0);
+			}
+			else
+				Lower(dst, SCCP_VARYING, 0);
+			break;
+
+		case IC_CONVERSION_OPERATOR:
+			s0 = Operand(ins->mSrc[0], v0);
+			if (s0 != SCCP_CONSTANT)
+				Lower(dst, s0, 0);
+			else
+			{
+				switch (ins->mOperator)
+				{
+				case IA_EXT8TO16S:
+					Lower(dst, SCCP_CONSTANT, int8(v0));
+					break;
+				case IA_EXT8TO16U:
+					Lower(dst, SCCP_CONSTANT, uint8(v0));
+					break;
+				case IA_EXT16TO32S:
+					Lower(dst, SCCP_CONSTANT, int16(v0));
+					break;
+				case IA_EXT16TO32U:
+					Lower(dst, SCCP_CONSTANT, uint16(v0));
+					break;
+				default:
+					Lower(dst, SCCP_VARYING, 0);
+				}
+			}
+			break;
+
+		default:
+			Lower(dst, SCCP_VARYING, 0);
+		}
+	}
+};
+
+bool InterCodeProcedure::SparseConditionalConstantPropagation(void)
+{
+	BuildSSA();
+
+	SparseConstantPropagation	sccp(mPostOrder, mPostOrderIndex, mTemporaries.Size(), mSSABase);
+	sccp.Run();
+
+	//
+	// Replace the instructions with a constant result and the constant
+	// operands, branches on a constant condition become jumps
+	//
+	bool	changed = false, branches = false;
+
+	for (int i = 0; i < mPostOrder.Size(); i++)
+	{
+		if (!sccp.Executable(i))
+			continue;
+
+		InterCodeBasicBlock* block = mPostOrder[i];
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+			int64	value;
+
+			switch (ins->mCode)
+			{
+			case IC_LOAD_TEMPORARY:
+			case IC_BINARY_OPERATOR:
+			case IC_UNARY_OPERATOR:
+			case IC_RELATIONAL_OPERATOR:
+			case IC_CONVERSION_OPERATOR:
+				if (sccp.Constant(ins->mDst.mTemp, value))
+				{
+					ins->mCode = IC_CONSTANT;
+					ins->mConst.mType = ins->mDst.mType;
+					ins->mConst.mIntConst = value;
+					for (int k = 0; k < ins->mNumOperands; k++)
+						ins->mSrc[k].mTemp = -1;
+					changed = true;
+				}
+				else if (ins->mCode == IC_BINARY_OPERATOR || ins->mCode == IC_RELATIONAL_OPERATOR)
+				{
+					if (IsIntegerType(ins->mSrc[1].mType) && sccp.Constant(ins->mSrc[1].mTemp, value))
+					{
+						ins->mSrc[1].mIntConst = value;
+						ins->mSrc[1].mTemp = -1;
+						changed = true;
+					}
+					else if (IsIntegerType(ins->mSrc[0].mType) && sccp.Constant(ins->mSrc[0].mTemp, value))
+					{
+						ins->mSrc[0].mIntConst = value;
+						ins->mSrc[0].mTemp = -1;
+						changed = true;
+					}
+				}
+				break;
+
+			case IC_STORE:
+			case IC_RETURN_VALUE:
+				if (IsIntegerType(ins->mSrc[0].mType) && sccp.Constant(ins->mSrc[0].mTemp, value))
+				{
+					ins->mSrc[0].mIntConst = value;
+					ins->mSrc[0].mTemp = -1;
+					changed = true;
+				}
+				break;
+
+			case IC_BRANCH:
+				if (sccp.Constant(ins->mSrc[0].mTemp, value))
+				{
+					ins->mCode = value ? IC_JUMP : IC_JUMPF;
+					ins->mSrc[0].mTemp = -1;
+					branches = true;
+				}
+				break;
+			}
+		}
+	}
+
+	DestroySSA();
+
+	if (branches)
+	{
+		ResetVisited();
+		mEntryBlock->EliminateDeadBranches();
+		BuildTraces(false);
+		changed = true;
+	}
+
+	DisassembleDebug("sparse conditional constant propagation");
+
+	return changed;
+}
+
+static bool IsSameLoopInvariant(const InterInstruction* ins, const InterInstruction* mins)
+{
+	if (ins->mCode != mins->mCode || ins->mOperator != mins->mOperator || ins->mNumOperands != mins->mNumOperands || ins->mDst.mType != mins->mDst.mType)
+		return false;
+
+	for (int i = 0; i < ins->mNumOperands; i++)
+		if (!ins->mSrc[i].IsEqual(mins->mSrc[i]))
+			return false;
+
+	return true;
+}
+
+// Collect the blocks of the natural loop with its head at post order index h,
+// the blocks are marked with h in inLoop.  Only loops entered through a
+// preheader are considered.
+
+bool InterCodeProcedure::CollectNaturalLoop(int h, GrowingIntArray& body, GrowingIntArray& inLoop)
+{
+	InterCodeBasicBlock* head = mPostOrder[h];
+	InterCodeBasicBlock* pre = head->mDominator;
+
+	if (!head->mLoopHead || !pre || pre->mTrueJump != head || pre->mFalseJump || mPostOrderIndex[pre->mIndex] < 0)
+		return false;
+
+	//
+	// Natural loop, the head has to dominate all its predecessors
+	// except for the preheader, the body is collected backwards from
+	// the sources of the back edges
+	//
+	int	preIndex = mPostOrderIndex[pre->mIndex];
+	bool	natural = true;
+
+	body.SetSize(0);
+	body.Push(h);
+	inLoop[h] = h;
+
+	for (int j = mPredStart[h]; natural && j < mPredStart[h + 1]; j++)
+	{
+		int	p = mPreds[j];
+		if (p != preIndex)
+		{
+			int	d = p;
+			while (d < h && mIDom[d] != d)
+				d = mIDom[d];
+			if (d != h)
+				natural = false;
+			else if (inLoop[p] != h)
+			{
+				inLoop[p] = h;
+				body.Push(p);
+			}
+		}
+	}
+
+	for (int k = 1; natural && k < body.Size(); k++)
+	{
+		int	b = body[k];
+		for (int j = mPredStart[b]; j < mPredStart[b + 1]; j++)
+		{
+			int	p = mPreds[j];
+			if (inLoop[p] != h)
+			{
+				inLoop[p] = h;
+				body.Push(p);
+			}
+		}
+	}
+
+	return natural;
+}
+
+bool InterCodeProcedure::LoopInvariantCodeMotion(void)
+{
+	BuildDataFlowSets();
+	BuildDominatorTree();
+
+	int	n = mPostOrder.Size();
+	int	numTemps = mTemporaries.Size();
+
+	bool	changed = false;
+
+	GrowingIntArray	inLoop(-1), body(0), defs(0), pdefs(0);
+	GrowingInstructionPtrArray	tdefs(nullptr), minvariants(nullptr);
+	GrowingArray<InterOperand*>	stores(nullptr);
+
+	inLoop.SetSize(n);
+	for (int i = 0; i < n; i++)
+		inLoop[i] = -1;
+	defs.SetSize(numTemps);
+	pdefs.SetSize(numTemps);
+	tdefs.SetSize(numTemps);
+	for (int i = 0; i < numTemps; i++)
+	{
+		defs[i] = 0;
+		pdefs[i] = 0;
+	}
+
+	//
+	// Temporaries with a single definition in the procedure, to find the
+	// variable behind the address of an indirect store
+	//
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+			if (ins->mDst.mTemp >= 0)
+			{
+				pdefs[ins->mDst.mTemp]++;
+				tdefs[ins->mDst.mTemp] = ins;
+			}
+		}
+	}
+
+	//
+	// Loop heads by increasing post order index, so inner loops are
+	// processed before the loops that contain them
+	//
+	for (int h = 0; h < n; h++)
+	{
+		if (!CollectNaturalLoop(h, body, inLoop))
+			continue;
+
+		InterCodeBasicBlock* head = mPostOrder[h];
+		InterCodeBasicBlock* pre = head->mDominator;
+
+		bool	hasCall = false, hasIndirectStore = false, hasAbsoluteStore = false;
+
+		stores.SetSize(0);
+		minvariants.SetSize(0);
+
+		for (int k = 0; k < body.Size(); k++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[body[k]];
+			for (int i = 0; i < block->mInstructions.Size(); i++)
+			{
+				InterInstruction* ins = block->mInstructions[i];
+
+				if (ins->mDst.mTemp >= 0)
+					defs[ins->mDst.mTemp]++;
+
+				if (HasSideEffect(ins->mCode))
+					hasCall = true;
+				else if (ins->mCode == IC_COPY || ins->mCode == IC_STRCPY)
+					hasIndirectStore = true;
+				else if (ins->mCode == IC_STORE)
+				{
+					if (ins->mSrc[1].mTemp >= 0)
+					{
+						// Follow the address to a variable, an offset
+						// stays within the variable
+
+						InterOperand* op = nullptr;
+						int	t = ins->mSrc[1].mTemp, steps = 0;
+						while (t >= 0 && pdefs[t] == 1 && steps < 8)
+						{
+							InterInstruction* tins = tdefs[t];
+							if (tins->mCode == IC_LEA)
+							{
+								op = tins->mSrc + 1;
+								t = op->mTemp;
+							}
+							else if (tins->mCode == IC_CONSTANT && tins->mDst.mType == IT_POINTER)
+							{
+								op = &(tins->mConst);
+								t = -1;
+							}
+							else
+								break;
+							steps++;
+						}
+
+						if (t < 0 && op && ((op->mMemory == IM_GLOBAL && op->mLinkerObject) || op->mMemory == IM_LOCAL || op->mMemory == IM_PARAM || op->mMemory == IM_FPARAM))
+							stores.Push(op);
+						else
+							hasIndirectStore = true;
+					}
+					else if (ins->mSrc[1].mMemory == IM_ABSOLUTE)
+						hasAbsoluteStore = true;
+					else
+						stores.Push(ins->mSrc + 1);
+				}
+			}
+		}
+
+		//
+		// Move instructions with a single definition in the loop, that
+		// is not needed on entry of the loop, and with operands from
+		// outside the loop until no more instructions qualify.  Blocks
+		// are visited dominators first to keep the moved definitions
+		// in order.
+		//
+		int	pos = pre->mInstructions.Size();
+		if (pos > 0 && pre->mInstructions[pos - 1]->mCode == IC_JUMP)
+			pos--;
+
+		bool	moved;
+		do
+		{
+			moved = false;
+
+			for (int k = body.Size() - 1; k >= 0; k--)
+			{
+				InterCodeBasicBlock* block = mPostOrder[body[k]];
+
+				int	j = 0;
+				for (int i = 0; i < block->mInstructions.Size(); i++)
+				{
+					InterInstruction* ins = block->mInstructions[i];
+					int	t = ins->mDst.mTemp;
+
+					bool	invariant = false;
+					if (t >= 0 && defs[t] == 1 && !head->mEntryRequiredTemps[t])
+					{
+						switch (ins->mCode)
+						{
+						case IC_BINARY_OPERATOR:
+						case IC_UNARY_OPERATOR:
+						case IC_CONVERSION_OPERATOR:
+						case IC_LEA:
+						case IC_LOAD_TEMPORARY:
+							invariant = true;
+							break;
+						case IC_LOAD:
+							// Fast call parameters are already in the zero page, so
+							// they are not moved
+
+							if (ins->mSrc[0].mTemp < 0 && !ins->mVolatile)
+							{
+								InterMemory	mem = ins->mSrc[0].mMemory;
+								int			vi = ins->mSrc[0].mVarIndex;
+
+								if (mem == IM_GLOBAL)
+									invariant = !hasCall && !hasIndirectStore && !hasAbsoluteStore;
+								else if (mem == IM_LOCAL)
+									invariant = !hasIndirectStore && (!hasCall || vi >= mLocalAliasedSet.Size() || !mLocalAliasedSet[vi]);
+								else if (mem == IM_PARAM)
+									invariant = !hasIndirectStore && (!hasCall || vi >= mParamAliasedSet.Size() || !mParamAliasedSet[vi]);
+
+								for (int s = 0; invariant && s < stores.Size(); s++)
+								{
+									InterOperand* sop = stores[s];
+									if (sop->mMemory == mem && (mem == IM_GLOBAL ? sop->mLinkerObject == ins->mSrc[0].mLinkerObject : sop->mVarIndex == vi))
+										invariant = false;
+								}
+							}
+							break;
+						}
+
+						for (int s = 0; invariant && s < ins->mNumOperands; s++)
+						{
+							if (ins->mSrc[s].mTemp >= 0 && defs[ins->mSrc[s].mTemp] > 0)
+								invariant = false;
+						}
+					}
+
+					if (invariant)
+					{
+						// Reuse the result of an equal instruction that was already moved
+
+						int	m = 0;
+						while (m < minvariants.Size() && !IsSameLoopInvariant(ins, minvariants[m]))
+							m++;
+
+						if (m < minvariants.Size())
+						{
+							ins->mCode = IC_LOAD_TEMPORARY;
+							ins->mSrc[0] = minvariants[m]->mDst;
+							ins->mNumOperands = 1;
+						}
+						else
+							minvariants.Push(ins);
+
+						pre->mInstructions.Insert(pos++, ins);
+						defs[t] = 0;
+						moved = true;
+					}
+					else
+						block->mInstructions[j++] = ins;
+				}
+				block->mInstructions.SetSize(j);
+			}
+
+			if (moved)
+				changed = true;
+
+		} while (moved);
+
+		for (int k = 0; k < body.Size(); k++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[body[k]];
+			for (int i = 0; i < block->mInstructions.Size(); i++)
+			{
+				InterInstruction* ins = block->mInstructions[i];
+				if (ins->mDst.mTemp >= 0)
+					defs[ins->mDst.mTemp] = 0;
+			}
+		}
+	}
+
+	DisassembleDebug("loop invariant code motion");
+
+	return changed;
+}
+
+// Index of the last definition of a temporary in a block before position at
+
+static int FindLocalDefinition(const InterCodeBasicBlock* block, int at, int temp)
+{
+	int	i = at - 1;
+	while (i >= 0 && block->mInstructions[i]->mDst.mTemp != temp)
+		i--;
+	return i;
+}
+
+static int64 WrapInt16(int64 v)
+{
+	return (int16)(v & 0xffff);
+}
+
+//
+// Array access derived from an induction variable, the pointer is
+// maintained in its own temporary and advanced with the variable
+//
+struct InductionReduction
+{
+	int					mVar, mPointer, mBlock;
+	int64				mScale;
+	InterInstruction*	mChain[2];
+	int					mChainOperand[2], mChainSize;
+	InterOperand		mBase, mStart;
+	Location			mLocation;
+};
+
+static bool IsSameInductionAccess(const InductionReduction& r0, const InductionReduction& r1)
+{
+	if (r0.mVar != r1.mVar || r0.mScale != r1.mScale || r0.mChainSize != r1.mChainSize)
+		return false;
+
+	InterOperand	base = r0.mBase;
+	base.mIntConst = r1.mBase.mIntConst;
+	if (!base.IsEqual(r1.mBase))
+		return false;
+
+	for (int i = 0; i < r0.mChainSize; i++)
+	{
+		const InterInstruction* ins0 = r0.mChain[i], * ins1 = r1.mChain[i];
+		int	ci = r0.mChainOperand[i];
+
+		if (ins0->mOperator != ins1->mOperator || ci != r1.mChainOperand[i] || !ins0->mSrc[1 - ci].IsEqual(ins1->mSrc[1 - ci]))
+			return false;
+	}
+
+	return true;
+}
+
+// Compute the index of the access for a value of the induction variable at
+// the given position in a block, constant values are folded
+
+static InterOperand BuildInductionIndex(InterCodeProcedure* proc, InterCodeBasicBlock* block, int& pos, const InductionReduction& r, const InterOperand& value)
+{
+	InterOperand	op = value;
+	op.mFinal = false;
+
+	for (int i = 0; i < r.mChainSize; i++)
+	{
+		const InterInstruction* cins = r.mChain[i];
+		int	ci = r.mChainOperand[i];
+
+		if (op.mTemp < 0 && cins->mSrc[1 - ci].mTemp < 0)
+		{
+			int64	val = cins->mSrc[1 - ci].mIntConst;
+			op.mIntConst = WrapInt16(ci == 1 ? ConstantFolding(cins->mOperator, IT_INT16, op.mIntConst, val) : ConstantFolding(cins->mOperator, IT_INT16, val, op.mIntConst));
+		}
+		else
+		{
+			InterInstruction* ins = new InterInstruction(*cins);
+			ins->mSrc[ci] = op;
+			ins->mSrc[1 - ci].mFinal = false;
+			ins->mDst.mTemp = proc->AddTemporary(ins->mDst.mType);
+			block->mInstructions.Insert(pos++, ins);
+			op = ins->mDst;
+		}
+	}
+
+	return op;
+}
+
+// Index of the access for a constant value of the induction variable
+
+static bool ConstantInductionIndex(const InductionReduction& r, const InterOperand& value, int64& index)
+{
+	if (value.mTemp >= 0)
+		return false;
+
+	index = value.mIntConst;
+	for (int i = 0; i < r.mChainSize; i++)
+	{
+		const InterInstruction* cins = r.mChain[i];
+		int	ci = r.mChainOperand[i];
+
+		if (cins->mSrc[1 - ci].mTemp >= 0)
+			return false;
+
+		// Folded without wrapping, so a bound beyond the address range is
+		// not mistaken for one within the array
+
+		int64	val = cins->mSrc[1 - ci].mIntConst;
+		index = ci == 1 ? ConstantFolding(cins->mOperator, IT_INT32, index, val) : ConstantFolding(cins->mOperator, IT_INT32, val, index);
+	}
+
+	return true;
+}
+
+// An index that addresses the array of the access or the element after it
+
+static bool InductionIndexWithinBase(InterCodeProcedure* proc, const InductionReduction& r, int64 index)
+{
+	if (r.mBase.mTemp >= 0)
+		return false;
+
+	int	size;
+	if (r.mBase.mMemory == IM_GLOBAL && r.mBase.mLinkerObject)
+		size = r.mBase.mLinkerObject->mSize;
+	else if (r.mBase.mMemory == IM_LOCAL && proc->mLocalVars[r.mBase.mVarIndex])
+		size = proc->mLocalVars[r.mBase.mVarIndex]->mSize;
+	else
+		return false;
+
+	int64	offset = r.mBase.mIntConst + index;
+	return offset >= 0 && offset <= size;
+}
+
+// Compute the address of the access for an index at the given position in a block
+
+static InterOperand BuildInductionPointer(InterCodeProcedure* proc, InterCodeBasicBlock* block, int& pos, const InductionReduction& r, const InterOperand& index)
+{
+	InterInstruction* ins = new InterInstruction();
+
+	if (index.mTemp < 0 && r.mBase.mTemp < 0)
+	{
+		ins->mCode = IC_CONSTANT;
+		ins->mConst = r.mBase;
+		ins->mConst.mIntConst += index.mIntConst;
+	}
+	else if (index.mTemp < 0 && index.mIntConst == 0)
+	{
+		ins->mCode = IC_LOAD_TEMPORARY;
+		ins->mSrc[0] = r.mBase;
+		ins->mNumOperands = 1;
+	}
+	else
+	{
+		ins->mCode = IC_LEA;
+		ins->mSrc[0] = index;
+		ins->mSrc[1] = r.mBase;
+	}
+
+	ins->mDst.mType = IT_POINTER;
+	ins->mDst.mTemp = proc->AddTemporary(ins->mDst.mType);
+	ins->mLocation = r.mLocation;
+	block->mInstructions.Insert(pos++, ins);
+
+	return ins->mDst;
+}
+
+static InterOperator InvertRelationalOperator(InterOperator op)
+{
+	switch (op)
+	{
+	case IA_CMPEQ:	return IA_CMPNE;
+	case IA_CMPNE:	return IA_CMPEQ;
+	case IA_CMPGES:	return IA_CMPLS;
+	case IA_CMPLES:	return IA_CMPGS;
+	case IA_CMPGS:	return IA_CMPLES;
+	case IA_CMPLS:	return IA_CMPGES;
+	case IA_CMPGEU:	return IA_CMPLU;
+	case IA_CMPLEU:	return IA_CMPGU;
+	case IA_CMPGU:	return IA_CMPLEU;
+	case IA_CMPLU:	return IA_CMPGEU;
+	default:
+		return op;
+	}
+}
+
+static InterOperator TransposeRelationalOperator(InterOperator op)
+{
+	switch (op)
+	{
+	case IA_CMPGES:	return IA_CMPLES;
+	case IA_CMPLES:	return IA_CMPGES;
+	case IA_CMPGS:	return IA_CMPLS;
+	case IA_CMPLS:	return IA_CMPGS;
+	case IA_CMPGEU:	return IA_CMPLEU;
+	case IA_CMPLEU:	return IA_CMPGEU;
+	case IA_CMPGU:	return IA_CMPLU;
+	case IA_CMPLU:	return IA_CMPGU;
+	default:
+		return op;
+	}
+}
+
+static InterOperator UnsignedRelationalOperator(InterOperator op)
+{
+	switch (op)
+	{
+	case IA_CMPGES:
+		return IA_CMPGEU;
+	case IA_CMPLES:
+		return IA_CMPLEU;
+	case IA_CMPGS:
+		return IA_CMPGU;
+	case IA_CMPLS:
+		return IA_CMPLU;
+	default:
+		return op;
+	}
+}
+
+// A comparison on the path into a loop, that proves the bound of its exit test
+// to be at least the start value of the induction variable.  The guard has to
+// reach the preheader at post order index pi through blocks with a single
+// entry, and neither value may change on the way.  The bound may be reloaded
+// from the same memory after the guard.
+
+bool InterCodeProcedure::InductionBoundGuarded(int pi, const InterOperand& start, const InterOperand& bound, bool unsign)
+{
+	if (bound.mTemp < 0)
+	{
+		if (start.mTemp < 0)
+			return unsign ? uint16(bound.mIntConst) >= uint16(start.mIntConst) : int16(bound.mIntConst) >= int16(start.mIntConst);
+		return false;
+	}
+
+	const InterInstruction* bload = nullptr;
+	bool	clobbered = false;
+
+	while (mPredStart[pi + 1] - mPredStart[pi] == 1)
+	{
+		InterCodeBasicBlock* block = mPostOrder[pi];
+
+		for (int i = block->mInstructions.Size() - 1; i >= 0; i--)
+		{
+			const InterInstruction* ins = block->mInstructions[i];
+			if (ins->mDst.mTemp >= 0 && ins->mDst.mTemp == start.mTemp)
+				return false;
+			else if (ins->mDst.mTemp == bound.mTemp)
+			{
+				if (bload || ins->mCode != IC_LOAD || ins->mSrc[0].mTemp >= 0 || ins->mVolatile)
+					return false;
+				bload = ins;
+			}
+			else if (bload && !CanBypassLoad(bload, ins))
+				clobbered = true;
+		}
+
+		pi = mPreds[mPredStart[pi]];
+		InterCodeBasicBlock* gblock = mPostOrder[pi];
+
+		int	bi = gblock->mInstructions.Size() - 1;
+		if (bi >= 0 && gblock->mInstructions[bi]->mCode == IC_BRANCH && gblock->mInstructions[bi]->mSrc[0].mTemp >= 0 && gblock->mTrueJump != gblock->mFalseJump)
+		{
+			int	ri = FindLocalDefinition(gblock, bi, gblock->mInstructions[bi]->mSrc[0].mTemp);
+			if (ri >= 0 && gblock->mInstructions[ri]->mCode == IC_RELATIONAL_OPERATOR)
+			{
+				const InterInstruction* cins = gblock->mInstructions[ri];
+
+				bool	changed = false;
+				for (int i = ri + 1; i < bi; i++)
+				{
+					const InterInstruction* ins = gblock->mInstructions[i];
+					if (ins->mDst.mTemp >= 0 && (ins->mDst.mTemp == start.mTemp || ins->mDst.mTemp == bound.mTemp))
+						changed = true;
+					else if (bload && !CanBypassLoad(bload, ins))
+						changed = true;
+				}
+
+				// Normalize the condition of the edge into the loop to a >= b or a > b
+
+				InterOperator	op = gblock->mTrueJump == block ? cins->mOperator : InvertRelationalOperator(cins->mOperator);
+				InterOperand	a = cins->mSrc[1], b = cins->mSrc[0];
+
+				if (op == IA_CMPLES || op == IA_CMPLS || op == IA_CMPLEU || op == IA_CMPLU)
+				{
+					op = TransposeRelationalOperator(op);
+					a = cins->mSrc[0];
+					b = cins->mSrc[1];
+				}
+
+				bool	strict = op == IA_CMPGS || op == IA_CMPGU;
+				bool	usable = op == IA_CMPEQ || (unsign ? op == IA_CMPGEU || op == IA_CMPGU : op == IA_CMPGES || op == IA_CMPGS);
+
+				// The upper side is the bound itself, or a load of the same
+				// memory that is not changed until the bound is reloaded
+
+				bool	upper = false;
+				if (a.mTemp >= 0 && a.mTemp == bound.mTemp)
+					upper = !bload;
+				else if (a.mTemp >= 0 && bload && !clobbered)
+				{
+					int	li = FindLocalDefinition(gblock, ri, a.mTemp);
+					if (li >= 0)
+					{
+						const InterInstruction* lins = gblock->mInstructions[li];
+						if (lins->mCode == IC_LOAD && !lins->mVolatile && lins->mSrc[0].IsEqual(bload->mSrc[0]) && lins->mSrc[0].mOperandSize == bload->mSrc[0].mOperandSize)
+						{
+							upper = true;
+							for (int i = li + 1; upper && i < ri; i++)
+								if (!CanBypassLoad(bload, gblock->mInstructions[i]))
+									upper = false;
+						}
+					}
+				}
+
+				bool	lower = false;
+				if (start.mTemp >= 0)
+					lower = b.mTemp == start.mTemp;
+				else if (b.mTemp < 0)
+				{
+					int64	low = unsign ? uint16(b.mIntConst) : int16(b.mIntConst);
+					if (strict)
+						low++;
+					lower = low >= (unsign ? uint16(start.mIntConst) : int16(start.mIntConst));
+				}
+
+				if (usable && upper && lower && !changed)
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool InterCodeProcedure::InductionVariableStrengthReduction(void)
+{
+	BuildDataFlowSets();
+	BuildDominatorTree();
+
+	int	n = mPostOrder.Size();
+
+	bool	changed = false;
+
+	GrowingIntArray	inLoop(-1), body(0), defs(0), uses(0);
+	GrowingInstructionPtrArray	incs(nullptr);
+	GrowingArray<InductionReduction>	reductions(InductionReduction{});
+
+	inLoop.SetSize(n);
+	for (int i = 0; i < n; i++)
+		inLoop[i] = -1;
+
+	for (int h = 0; h < n; h++)
+	{
+		if (!CollectNaturalLoop(h, body, inLoop))
+			continue;
+
+		InterCodeBasicBlock* head = mPostOrder[h];
+		InterCodeBasicBlock* pre = head->mDominator;
+
+		int	numTemps = mTemporaries.Size();
+
+		defs.SetSize(numTemps);
+		incs.SetSize(numTemps);
+		for (int i = 0; i < numTemps; i++)
+		{
+			defs[i] = 0;
+			incs[i] = nullptr;
+		}
+
+		for (int k = 0; k < body.Size(); k++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[body[k]];
+			for (int i = 0; i < block->mInstructions.Size(); i++)
+			{
+				InterInstruction* ins = block->mInstructions[i];
+				if (ins->mDst.mTemp >= 0)
+				{
+					defs[ins->mDst.mTemp]++;
+					incs[ins->mDst.mTemp] = ins;
+				}
+			}
+		}
+
+		//
+		// Basic induction variables are 16 bit integers carried around the
+		// loop, that are only changed by adding a constant
+		//
+		for (int t = 0; t < numTemps; t++)
+		{
+			InterInstruction* ins = incs[t];
+			if (ins)
+			{
+				bool	basic = false;
+				if (defs[t] == 1 && head->mEntryRequiredTemps[t] && ins->mCode == IC_BINARY_OPERATOR && ins->mDst.mType == IT_INT16)
+				{
+					if (ins->mOperator == IA_ADD)
+						basic = (ins->mSrc[1].mTemp == t && ins->mSrc[0].mTemp < 0) || (ins->mSrc[0].mTemp == t && ins->mSrc[1].mTemp < 0);
+					else if (ins->mOperator == IA_SUB)
+						basic = ins->mSrc[1].mTemp == t && ins->mSrc[0].mTemp < 0;
+				}
+				if (!basic)
+					incs[t] = nullptr;
+			}
+		}
+
+		//
+		// Address calculations with an index that is linear in an induction
+		// variable, the index is scaled and may have an invariant offset
+		//
+		reductions.SetSize(0);
+
+		for (int k = 0; k < body.Size(); k++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[body[k]];
+			for (int i = 0; i < block->mInstructions.Size(); i++)
+			{
+				InterInstruction* lins = block->mInstructions[i];
+
+				if (lins->mCode != IC_LEA || lins->mSrc[0].mTemp < 0 || lins->mDst.mTemp < 0 || (lins->mSrc[1].mTemp >= 0 && defs[lins->mSrc[1].mTemp] > 0))
+					continue;
+
+				// Small global arrays are accessed with an indexed address mode
+				// in native code, a pointer would be more expensive
+
+				if (mNativeProcedure && lins->mSrc[1].mTemp < 0 && lins->mSrc[1].mMemory == IM_GLOBAL && lins->mSrc[1].mLinkerObject && lins->mSrc[1].mLinkerObject->mSize < 256)
+					continue;
+
+				InductionReduction	r;
+				r.mVar = -1;
+				r.mScale = 1;
+				r.mChainSize = 0;
+				r.mBase = lins->mSrc[1];
+				r.mBase.mFinal = false;
+				r.mLocation = lins->mLocation;
+				r.mBlock = body[k];
+
+				// Follow the index back to the induction variable through
+				// at most two scaling or offset steps in the block
+
+				int	t = lins->mSrc[0].mTemp, at = i;
+
+				while (!incs[t] && r.mChainSize < 2)
+				{
+					int	j = FindLocalDefinition(block, at, t);
+					if (j < 0)
+						break;
+
+					InterInstruction* ins = block->mInstructions[j];
+					if (ins->mCode != IC_BINARY_OPERATOR || ins->mDst.mType != IT_INT16)
+						break;
+
+					int		ci = -1;
+					int64	scale = 1;
+
+					if (ins->mOperator == IA_ADD && ins->mSrc[1].mTemp >= 0 && (ins->mSrc[0].mTemp < 0 || defs[ins->mSrc[0].mTemp] == 0))
+						ci = 1;
+					else if (ins->mOperator == IA_ADD && ins->mSrc[0].mTemp >= 0 && (ins->mSrc[1].mTemp < 0 || defs[ins->mSrc[1].mTemp] == 0))
+						ci = 0;
+					else if (ins->mOperator == IA_SUB && ins->mSrc[1].mTemp >= 0 && (ins->mSrc[0].mTemp < 0 || defs[ins->mSrc[0].mTemp] == 0))
+						ci = 1;
+					else if (ins->mOperator == IA_SHL && ins->mSrc[1].mTemp >= 0 && ins->mSrc[0].mTemp < 0 && ins->mSrc[0].mIntConst >= 0 && ins->mSrc[0].mIntConst < 16)
+					{
+						ci = 1;
+						scale = 1LL << ins->mSrc[0].mIntConst;
+					}
+					else if (ins->mOperator == IA_MUL && ins->mSrc[1].mTemp >= 0 && ins->mSrc[0].mTemp < 0)
+					{
+						ci = 1;
+						scale = ins->mSrc[0].mIntConst;
+					}
+					else if (ins->mOperator == IA_MUL && ins->mSrc[0].mTemp >= 0 && ins->mSrc[1].mTemp < 0)
+					{
+						ci = 0;
+						scale = ins->mSrc[1].mIntConst;
+					}
+					else
+						break;
+
+					for (int c = r.mChainSize; c > 0; c--)
+					{
+						r.mChain[c] = r.mChain[c - 1];
+						r.mChainOperand[c] = r.mChainOperand[c - 1];
+					}
+					r.mChain[0] = ins;
+					r.mChainOperand[0] = ci;
+					r.mChainSize++;
+					r.mScale = WrapInt16(r.mScale * scale);
+
+					t = ins->mSrc[ci].mTemp;
+					at = j;
+				}
+
+				// An unscaled index is added as cheaply as a pointer is advanced
+
+				if (!incs[t] || r.mChainSize == 0 || r.mScale == 0 || FindLocalDefinition(block, i, t) >= at)
+					continue;
+
+				r.mVar = t;
+
+				// Share the pointer with an access that differs only by a
+				// constant offset
+
+				int	m = 0;
+				while (m < reductions.Size() && !IsSameInductionAccess(reductions[m], r))
+					m++;
+
+				if (m == reductions.Size())
+				{
+					int	pos = pre->mInstructions.Size();
+					if (pos > 0 && pre->mInstructions[pos - 1]->mCode == IC_JUMP)
+						pos--;
+
+					InterOperand	vop;
+					vop.mTemp = r.mVar;
+					vop.mType = IT_INT16;
+
+					// Fold the index when the variable enters the loop with a constant,
+					// the definition may be in a single entry block before the preheader
+
+					int	pi = mPostOrderIndex[pre->mIndex];
+					int	d = FindLocalDefinition(pre, pos, r.mVar);
+					while (d < 0 && mPredStart[pi + 1] - mPredStart[pi] == 1)
+					{
+						pi = mPreds[mPredStart[pi]];
+						d = FindLocalDefinition(mPostOrder[pi], mPostOrder[pi]->mInstructions.Size(), r.mVar);
+					}
+
+					if (d >= 0 && mPostOrder[pi]->mInstructions[d]->mCode == IC_CONSTANT)
+					{
+						vop.mTemp = -1;
+						vop.mIntConst = mPostOrder[pi]->mInstructions[d]->mConst.mIntConst;
+					}
+
+					InterOperand	pop = BuildInductionPointer(this, pre, pos, r, BuildInductionIndex(this, pre, pos, r, vop));
+					r.mPointer = pop.mTemp;
+					r.mStart = vop;
+					reductions.Push(r);
+				}
+
+				int64	delta = r.mBase.mIntConst - reductions[m].mBase.mIntConst;
+
+				if (delta == 0)
+				{
+					lins->mCode = IC_LOAD_TEMPORARY;
+					lins->mSrc[0] = InterOperand();
+					lins->mSrc[0].mTemp = reductions[m].mPointer;
+					lins->mSrc[0].mType = IT_POINTER;
+					lins->mSrc[1] = InterOperand();
+					lins->mNumOperands = 1;
+				}
+				else
+				{
+					lins->mSrc[0] = InterOperand();
+					lins->mSrc[0].mIntConst = delta;
+					lins->mSrc[0].mType = IT_INT16;
+					lins->mSrc[1] = InterOperand();
+					lins->mSrc[1].mTemp = reductions[m].mPointer;
+					lins->mSrc[1].mType = IT_POINTER;
+					lins->mSrc[1].mMemory = IM_INDIRECT;
+				}
+			}
+		}
+
+		if (reductions.Size() == 0)
+			continue;
+
+		changed = true;
+
+		//
+		// Advance the pointers with their induction variables
+		//
+		for (int m = 0; m < reductions.Size(); m++)
+		{
+			const InductionReduction& r = reductions[m];
+			InterInstruction* iins = incs[r.mVar];
+
+			InterInstruction* ains = new InterInstruction();
+			ains->mCode = IC_LEA;
+			ains->mSrc[1].mMemory = IM_INDIRECT;
+			ains->mSrc[1].mType = IT_POINTER;
+			ains->mSrc[1].mTemp = r.mPointer;
+			ains->mSrc[0].mType = IT_INT16;
+			ains->mSrc[0].mIntConst = WrapInt16(r.mScale * (iins->mOperator == IA_SUB ? -iins->mSrc[0].mIntConst : (iins->mSrc[0].mTemp < 0 ? iins->mSrc[0].mIntConst : iins->mSrc[1].mIntConst)));
+			ains->mDst.mType = IT_POINTER;
+			ains->mDst.mTemp = r.mPointer;
+			ains->mLocation = iins->mLocation;
+
+			for (int k = 0; k < body.Size(); k++)
+			{
+				InterCodeBasicBlock* block = mPostOrder[body[k]];
+				int	i = 0;
+				while (i < block->mInstructions.Size() && block->mInstructions[i] != iins)
+					i++;
+				if (i < block->mInstructions.Size())
+					block->mInstructions.Insert(i + 1, ains);
+			}
+		}
+
+		//
+		// Remove the instructions that calculated the replaced addresses
+		//
+		int	nt = mTemporaries.Size();
+		uses.SetSize(nt);
+		for (int i = 0; i < nt; i++)
+			uses[i] = 0;
+
+		for (int i = 0; i < n; i++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[i];
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				InterInstruction* ins = block->mInstructions[j];
+				for (int s = 0; s < ins->mNumOperands; s++)
+					if (ins->mSrc[s].mTemp >= 0)
+						uses[ins->mSrc[s].mTemp]++;
+			}
+		}
+
+		bool	removed;
+		do
+		{
+			removed = false;
+			for (int k = 0; k < body.Size(); k++)
+			{
+				InterCodeBasicBlock* block = mPostOrder[body[k]];
+
+				int	j = 0;
+				for (int i = 0; i < block->mInstructions.Size(); i++)
+				{
+					InterInstruction* ins = block->mInstructions[i];
+					if (ins->mDst.mTemp >= 0 && uses[ins->mDst.mTemp] == 0 &&
+						(ins->mCode == IC_BINARY_OPERATOR || ins->mCode == IC_LEA || ins->mCode == IC_LOAD_TEMPORARY))
+					{
+						for (int s = 0; s < ins->mNumOperands; s++)
+							if (ins->mSrc[s].mTemp >= 0)
+								uses[ins->mSrc[s].mTemp]--;
+						removed = true;
+					}
+					else
+						block->mInstructions[j++] = ins;
+				}
+				block->mInstructions.SetSize(j);
+			}
+		} while (removed);
+
+		//
+		// A counting induction variable that is only used for the exit test
+		// is replaced by a comparison of one of its pointers.  The access is
+		// executed in every iteration, so the addresses stay within the
+		// array when the test is the only exit of the loop and the bound is
+		// not below the start value.  A bound below the start or beyond the
+		// array with other exits could wrap the end address around, so it
+		// has to be a constant within the array otherwise.
+		//
+		for (int m = 0; m < reductions.Size(); m++)
+		{
+			const InductionReduction& r = reductions[m];
+			InterInstruction* iins = incs[r.mVar];
+
+			if (!iins || r.mScale < 0 || iins->mOperator != IA_ADD || (iins->mSrc[0].mTemp < 0 ? iins->mSrc[0].mIntConst : iins->mSrc[1].mIntConst) <= 0)
+				continue;
+			if (r.mBase.mTemp < 0 && r.mBase.mMemory != IM_GLOBAL && r.mBase.mMemory != IM_ABSOLUTE && r.mBase.mMemory != IM_LOCAL && r.mBase.mMemory != IM_PARAM)
+				continue;
+
+			bool	valid = true;
+			for (int j = mPredStart[h]; valid && j < mPredStart[h + 1]; j++)
+			{
+				int	d = mPreds[j];
+				if (inLoop[d] == h)
+				{
+					while (d < r.mBlock && mIDom[d] != d)
+						d = mIDom[d];
+					if (d != r.mBlock)
+						valid = false;
+				}
+			}
+
+			InterInstruction* cins = nullptr;
+			int	cuses = 0;
+
+			GrowingInterCodeBasicBlockPtrArray	exits(nullptr);
+
+			for (int k = 0; valid && k < body.Size(); k++)
+			{
+				InterCodeBasicBlock* block = mPostOrder[body[k]];
+
+				bool	texit = block->mTrueJump && inLoop[mPostOrderIndex[block->mTrueJump->mIndex]] != h;
+				bool	fexit = block->mFalseJump && inLoop[mPostOrderIndex[block->mFalseJump->mIndex]] != h;
+
+				if (texit || fexit)
+					exits.Push(block);
+
+				if ((texit && block->mTrueJump->mEntryRequiredTemps[r.mVar]) || (fexit && block->mFalseJump->mEntryRequiredTemps[r.mVar]))
+					valid = false;
+
+				for (int i = 0; i < block->mInstructions.Size(); i++)
+				{
+					InterInstruction* ins = block->mInstructions[i];
+					if (ins != iins && ins->ReferencesTemp(r.mVar))
+					{
+						cuses++;
+						if (ins->mCode == IC_RELATIONAL_OPERATOR && (
+							(ins->mSrc[0].mTemp == r.mVar && (ins->mSrc[1].mTemp < 0 || defs[ins->mSrc[1].mTemp] == 0)) ||
+							(ins->mSrc[1].mTemp == r.mVar && (ins->mSrc[0].mTemp < 0 || defs[ins->mSrc[0].mTemp] == 0))))
+							cins = ins;
+					}
+				}
+			}
+
+			if (valid && cins && cuses == 1)
+			{
+				for (int k = 0; valid && k < exits.Size(); k++)
+				{
+					InterCodeBasicBlock* block = exits[k];
+					int	bi = block->mInstructions.Size() - 1;
+					if (bi < 0 || block->mInstructions[bi]->mCode != IC_BRANCH || block->mInstructions[bi]->mSrc[0].mTemp != cins->mDst.mTemp)
+						valid = false;
+				}
+
+				const InterOperand& bound(cins->mSrc[cins->mSrc[0].mTemp == r.mVar ? 1 : 0]);
+
+				int64	index;
+				if (ConstantInductionIndex(r, bound, index) && InductionIndexWithinBase(this, r, index))
+					valid = true;
+				else if (valid)
+				{
+					InterOperator	op = cins->mOperator;
+					valid = InductionBoundGuarded(mPostOrderIndex[pre->mIndex], r.mStart, bound, op == IA_CMPGEU || op == IA_CMPLEU || op == IA_CMPGU || op == IA_CMPLU);
+				}
+			}
+
+			if (valid && cins && cuses == 1)
+			{
+				int	pos = pre->mInstructions.Size();
+				if (pos > 0 && pre->mInstructions[pos - 1]->mCode == IC_JUMP)
+					pos--;
+
+				int	ci = cins->mSrc[0].mTemp == r.mVar ? 0 : 1;
+
+				InterOperand	bop = BuildInductionPointer(this, pre, pos, r, BuildInductionIndex(this, pre, pos, r, cins->mSrc[1 - ci]));
+
+				cins->mSrc[ci] = InterOperand();
+				cins->mSrc[ci].mTemp = r.mPointer;
+				cins->mSrc[ci].mType = IT_POINTER;
+				cins->mSrc[1 - ci] = bop;
+				cins->mOperator = UnsignedRelationalOperator(cins->mOperator);
+
+				for (int k = 0; k < body.Size(); k++)
+				{
+					InterCodeBasicBlock* block = mPostOrder[body[k]];
+					int	j = 0;
+					for (int i = 0; i < block->mInstructions.Size(); i++)
+					{
+						if (block->mInstructions[i] != iins)
+							block->mInstructions[j++] = block->mInstructions[i];
+					}
+					block->mInstructions.SetSize(j);
+				}
+
+				incs[r.mVar] = nullptr;
+			}
+		}
+
+		BuildDataFlowSets();
+	}
+
+	DisassembleDebug("induction variable strength reduction");
+
+	return changed;
+}
+
+// Value range propagation on the SSA form.  Each integer temporary gets an
+// interval of its signed value, 8 bit temporaries the interval of their
+// unsigned byte.  A branch on a comparison limits the temporaries in the
+// blocks dominated by the taken edge and in the phi operands of the edge.
+// Growing intervals are widened to the constants of the comparisons and
+// narrowed again after the first fixed point.
+
+static void TypeRange(InterType type, int64& min, int64& max)
+{
+	switch (type)
+	{
+	case IT_BOOL:
+		min = 0;
+		max = 1;
+		break;
+	case IT_INT8:
+		min = 0;
+		max = 255;
+		break;
+	case IT_INT16:
+		min = -32768;
+		max = 32767;
+		break;
+	default:
+		min = -2147483647LL - 1;
+		max = 2147483647LL;
+	}
+}
+
+static int64 TypeValue(InterType type, int64 val)
+{
+	switch (type)
+	{
+	case IT_BOOL:
+		return val ? 1 : 0;
+	case IT_INT8:
+		return uint8(val);
+	case IT_INT16:
+		return int16(val);
+	default:
+		return int32(val);
+	}
+}
+
+static InterOperator SignedRelationalOperator(InterOperator op)
+{
+	switch (op)
+	{
+	case IA_CMPGEU:	return IA_CMPGES;
+	case IA_CMPLEU:	return IA_CMPLES;
+	case IA_CMPGU:	return IA_CMPGS;
+	case IA_CMPLU:	return IA_CMPLS;
+	default:
+		return op;
+	}
+}
+
+class ValueRangePropagation
+{
+public:
+	ValueRangePropagation(const GrowingInterCodeBasicBlockPtrArray& blocks, const GrowingIntArray& blockIndex, const GrowingIntArray& idom, const GrowingTypeArray& temporaries, int numOriginal)
+		: mBlocks(blocks), mBlockIndex(blockIndex), mIDom(idom), mTemporaries(temporaries),
+		mMin(0), mMax(0), mGrowth(0), mDefBlock(-1), mDefs(nullptr), mConditions(nullptr), mThresholds(0),
+		mConditionTrue(blocks.Size())
+	{
+		int	numTemps = temporaries.Size();
+		int	n = blocks.Size();
+
+		mMin.SetSize(numTemps);
+		mMax.SetSize(numTemps);
+		mGrowth.SetSize(numTemps, true);
+		mDefBlock.SetSize(numTemps);
+		mDefs.SetSize(numTemps, true);
+
+		//
+		// Temporaries without a definition in SSA form are undefined and
+		// may hold any value, all others start empty
+		//
+		for (int i = 0; i < numTemps; i++)
+		{
+			mDefBlock[i] = -1;
+			if (i < numOriginal)
+				TypeRange(temporaries[i], mMin[i], mMax[i]);
+			else
+			{
+				mMin[i] = 1;
+				mMax[i] = 0;
+			}
+		}
+
+		AddThreshold(-2147483647LL - 1);
+		AddThreshold(-32768);
+		AddThreshold(0);
+		AddThreshold(255);
+		AddThreshold(32767);
+		AddThreshold(65535);
+		AddThreshold(2147483647LL);
+
+		for (int i = 0; i < n; i++)
+		{
+			const InterCodeBasicBlock* block = mBlocks[i];
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				InterInstruction* ins = block->mInstructions[j];
+				if (ins->mDst.mTemp >= 0)
+				{
+					mDefs[ins->mDst.mTemp] = ins;
+					mDefBlock[ins->mDst.mTemp] = i;
+				}
+
+				if (ins->mCode == IC_RELATIONAL_OPERATOR)
+				{
+					for (int k = 0; k < 2; k++)
+					{
+						if (ins->mSrc[k].mTemp < 0 && IsIntegerType(ins->mSrc[k].mType))
+						{
+							int64	v = TypeValue(ins->mSrc[k].mType, ins->mSrc[k].mIntConst);
+							AddThreshold(v - 1);
+							AddThreshold(v);
+							AddThreshold(v + 1);
+						}
+					}
+				}
+			}
+		}
+
+		//
+		// A block with a single predecessor that ends with a branch on a
+		// comparison is entered only if the comparison has the value of
+		// the edge
+		//
+		mConditions.SetSize(n, true);
+		for (int i = 0; i < n; i++)
+		{
+			InterCodeBasicBlock* block = mBlocks[i];
+			if (block->mEntryBlocks.Size() == 1)
+			{
+				bool	truth;
+				const InterInstruction* cins = EdgeCondition(block->mEntryBlocks[0], block, truth);
+				if (cins)
+				{
+					mConditions[i] = cins;
+					if (truth)
+						mConditionTrue += i;
+				}
+			}
+		}
+	}
+
+	bool Run(void)
+	{
+		int		n = mBlocks.Size();
+		int		rounds = 0;
+		bool	changed;
+
+		do
+		{
+			changed = false;
+			for (int i = n - 1; i >= 0; i--)
+			{
+				const InterCodeBasicBlock* block = mBlocks[i];
+				for (int j = 0; j < block->mInstructions.Size(); j++)
+				{
+					const InterInstruction* ins = block->mInstructions[j];
+					int64	min, max;
+					if (ins->mDst.mTemp >= 0 && SCCPType(ins->mDst.mType) && Evaluate(i, ins, min, max) && Widen(ins->mDst.mTemp, min, max))
+						changed = true;
+				}
+			}
+			rounds++;
+		} while (changed && rounds < 64);
+
+		if (changed)
+			return false;
+
+		for (int k = 0; k < 2; k++)
+		{
+			for (int i = n - 1; i >= 0; i--)
+			{
+				const InterCodeBasicBlock* block = mBlocks[i];
+				for (int j = 0; j < block->mInstructions.Size(); j++)
+				{
+					const InterInstruction* ins = block->mInstructions[j];
+					int64	min, max;
+					if (ins->mDst.mTemp >= 0 && SCCPType(ins->mDst.mType) && Evaluate(i, ins, min, max))
+					{
+						int	t = ins->mDst.mTemp;
+						if (min < mMin[t])
+							min = mMin[t];
+						if (max > mMax[t])
+							max = mMax[t];
+						if (min <= max)
+						{
+							mMin[t] = min;
+							mMax[t] = max;
+						}
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// Range of an operand in a block
+
+	bool Range(int bi, const InterOperand& op, int64& min, int64& max) const
+	{
+		if (op.mTemp < 0)
+		{
+			min = max = TypeValue(op.mType, op.mIntConst);
+			return true;
+		}
+
+		int	t = op.mTemp;
+		if (mMin[t] > mMax[t])
+			return false;
+
+		min = mMin[t];
+		max = mMax[t];
+
+		InterType	type = mTemporaries[t];
+		if (op.mType != type)
+		{
+			if (op.mType == IT_INT8 && SCCPType(type))
+			{
+				if (min < 0 || max > 255)
+				{
+					min = 0;
+					max = 255;
+				}
+			}
+			else
+				TypeRange(op.mType, min, max);
+			return true;
+		}
+
+		if (type == IT_INT16 || type == IT_INT32)
+		{
+			int	d = bi;
+			for (;;)
+			{
+				if (mConditions[d])
+					Constrain(mConditions[d], mConditionTrue[d], t, min, max);
+				if (d == mDefBlock[t] || mIDom[d] == d)
+					break;
+				d = mIDom[d];
+			}
+		}
+
+		return min <= max;
+	}
+
+	// Range of the value of a temporary over all its uses
+
+	bool Range(int temp, int64& min, int64& max) const
+	{
+		min = mMin[temp];
+		max = mMax[temp];
+		return min <= max;
+	}
+
+	const InterInstruction* Definition(int temp) const
+	{
+		return mDefs[temp];
+	}
+
+protected:
+	const GrowingInterCodeBasicBlockPtrArray&	mBlocks;
+	const GrowingIntArray&						mBlockIndex, & mIDom;
+	const GrowingTypeArray&						mTemporaries;
+
+	GrowingArray<int64>					mMin, mMax;
+	GrowingIntArray						mGrowth, mDefBlock;
+	GrowingArray<const InterInstruction*>	mDefs, mConditions;
+	GrowingArray<int64>					mThresholds;
+	NumberSet							mConditionTrue;
+
+	void AddThreshold(int64 v)
+	{
+		int	i = mThresholds.Size();
+		while (i > 0 && mThresholds[i - 1] > v)
+			i--;
+		if (i == 0 || mThresholds[i - 1] != v)
+			mThresholds.Insert(i, v);
+	}
+
+	const InterInstruction* EdgeCondition(const InterCodeBasicBlock* from, const InterCodeBasicBlock* to, bool& truth) const
+	{
+		int	n = from->mInstructions.Size();
+		if (n > 0 && from->mTrueJump != from->mFalseJump && from->mFalseJump)
+		{
+			const InterInstruction* bins = from->mInstructions[n - 1];
+			if (bins->mCode == IC_BRANCH && bins->mSrc[0].mTemp >= 0)
+			{
+				const InterInstruction* cins = mDefs[bins->mSrc[0].mTemp];
+				if (cins && cins->mCode == IC_RELATIONAL_OPERATOR)
+				{
+					truth = from->mTrueJump == to;
+					return cins;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	void Constrain(const InterInstruction* cins, bool truth, int t, int64& min, int64& max) const
+	{
+		InterType	type = cins->mSrc[0].mType;
+		if ((type != IT_INT16 && type != IT_INT32) || cins->mSrc[1].mType != type || type != mTemporaries[t])
+			return;
+
+		InterOperator	op = truth ? cins->mOperator : InvertRelationalOperator(cins->mOperator);
+
+		int	k;
+		if (cins->mSrc[1].mTemp == t)
+			k = 1;
+		else if (cins->mSrc[0].mTemp == t)
+		{
+			k = 0;
+			op = TransposeRelationalOperator(op);
+		}
+		else
+			return;
+
+		const InterOperand& o(cins->mSrc[1 - k]);
+		int64	omin, omax;
+		if (o.mTemp < 0)
+			omin = omax = TypeValue(type, o.mIntConst);
+		else if (mMin[o.mTemp] <= mMax[o.mTemp])
+		{
+			omin = mMin[o.mTemp];
+			omax = mMax[o.mTemp];
+		}
+		else
+			return;
+
+		// Unsigned comparisons of non negative values are signed, and a
+		// value below a non negative bound is not negative
+
+		switch (op)
+		{
+		case IA_CMPGEU:
+		case IA_CMPLEU:
+		case IA_CMPGU:
+		case IA_CMPLU:
+			if (omin < 0)
+				return;
+			if (min < 0)
+			{
+				if (op != IA_CMPLU && op != IA_CMPLEU)
+					return;
+				min = 0;
+			}
+			op = SignedRelationalOperator(op);
+			break;
+		}
+
+		switch (op)
+		{
+		case IA_CMPEQ:
+			if (min < omin)
+				min = omin;
+			if (max > omax)
+				max = omax;
+			break;
+		case IA_CMPNE:
+			if (omin == omax)
+			{
+				if (min == omin)
+					min++;
+				if (max == omax)
+					max--;
+			}
+			break;
+		case IA_CMPLS:
+			if (max > omax - 1)
+				max = omax - 1;
+			break;
+		case IA_CMPLES:
+			if (max > omax)
+				max = omax;
+			break;
+		case IA_CMPGS:
+			if (min < omin + 1)
+				min = omin + 1;
+			break;
+		case IA_CMPGES:
+			if (min < omin)
+				min = omin;
+			break;
+		}
+	}
+
+	bool Widen(int t, int64 min, int64 max)
+	{
+		if (mMin[t] > mMax[t])
+		{
+			mMin[t] = min;
+			mMax[t] = max;
+			return true;
+		}
+
+		if (min >= mMin[t] && max <= mMax[t])
+			return false;
+
+		if (mGrowth[t]++ >= 2)
+		{
+			int	i = mThresholds.Size() - 1;
+			while (i > 0 && mThresholds[i] > min)
+				i--;
+			if (min < mMin[t])
+				min = mThresholds[i];
+
+			i = 0;
+			while (i < mThresholds.Size() - 1 && mThresholds[i] < max)
+				i++;
+			if (max > mMax[t])
+				max = mThresholds[i];
+		}
+
+		int64	tmin, tmax;
+		TypeRange(mTemporaries[t], tmin, tmax);
+
+		if (min < mMin[t])
+			mMin[t] = min < tmin ? tmin : min;
+		if (max > mMax[t])
+			mMax[t] = max > tmax ? tmax : max;
+
+		return true;
+	}
+
+	bool BinaryRange(InterOperator oper, InterType type, int64 min1, int64 max1, int64 min0, int64 max0, int64& min, int64& max) const
+	{
+		// Signed operations on bytes do not work on the unsigned interval
+
+		if (type == IT_INT8 && (oper == IA_DIVS || oper == IA_MODS || oper == IA_SAR))
+			return false;
+
+		switch (oper)
+		{
+		case IA_ADD:
+			min = min1 + min0;
+			max = max1 + max0;
+			return true;
+		case IA_SUB:
+			min = min1 - max0;
+			max = max1 - min0;
+			return true;
+		case IA_MUL:
+		{
+			int64	p[4] = { min1 * min0, min1 * max0, max1 * min0, max1 * max0 };
+			min = max = p[0];
+			for (int i = 1; i < 4; i++)
+			{
+				if (p[i] < min)
+					min = p[i];
+				if (p[i] > max)
+					max = p[i];
+			}
+		}	return true;
+		case IA_AND:
+			if (min1 >= 0 && min0 >= 0)
+			{
+				min = 0;
+				max = max1 < max0 ? max1 : max0;
+				return true;
+			}
+			else if (min1 >= 0 || min0 >= 0)
+			{
+				min = 0;
+				max = min1 >= 0 ? max1 : max0;
+				return true;
+			}
+			return false;
+		case IA_OR:
+		case IA_XOR:
+			if (min1 >= 0 && min0 >= 0)
+			{
+				int64	m = max1 | max0;
+				max = 0;
+				while (max < m)
+					max = 2 * max + 1;
+				min = 0;
+				return true;
+			}
+			return false;
+		case IA_SHL:
+			if (min0 == max0 && min0 >= 0 && min0 < 32)
+			{
+				min = min1 * (int64(1) << min0);
+				max = max1 * (int64(1) << min0);
+				return true;
+			}
+			return false;
+		case IA_SHR:
+			if (min0 == max0 && min0 >= 0 && min0 < 32 && min1 >= 0)
+			{
+				min = min1 >> min0;
+				max = max1 >> min0;
+				return true;
+			}
+			return false;
+		case IA_SAR:
+			if (min0 == max0 && min0 >= 0 && min0 < 32)
+			{
+				min = min1 >> min0;
+				max = max1 >> min0;
+				return true;
+			}
+			return false;
+		case IA_DIVU:
+		case IA_DIVS:
+			if (min0 == max0 && min0 > 0 && (min1 >= 0 || oper == IA_DIVS))
+			{
+				min = min1 / min0;
+				max = max1 / min0;
+				return true;
+			}
+			return false;
+		case IA_MODU:
+		case IA_MODS:
+			if (min0 == max0 && min0 > 0)
+			{
+				if (min1 >= 0)
+				{
+					min = 0;
+					max = max1 < min0 - 1 ? max1 : min0 - 1;
+					return true;
+				}
+				else if (oper == IA_MODU)
+				{
+					min = 0;
+					max = min0 - 1;
+					return true;
+				}
+				else
+				{
+					min = 1 - min0;
+					max = min0 - 1;
+					return true;
+				}
+			}
+			return false;
+		default:
+			return false;
+		}
+	}
 
-	ResetVisited();
-	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps));
+	bool Evaluate(int bi, const InterInstruction* ins, int64& min, int64& max) const
+	{
+		InterType	type = ins->mDst.mType;
+		int64		min0, max0, min1, max1;
+		bool		known = false;
 
-	NumberSet	totalRequired2(numTemps);
+		switch (ins->mCode)
+		{
+		case IC_CONSTANT:
+			min = max = TypeValue(type, ins->mConst.mIntConst);
+			return true;
 
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired2));
+		case IC_RELATIONAL_OPERATOR:
+			min = 0;
+			max = 1;
+			return true;
+
+		case IC_LOAD_TEMPORARY:
+			if (ins->mSrc[0].mType == type)
+			{
+				if (!Range(bi, ins->mSrc[0], min, max))
+					return false;
+				known = true;
+			}
+			break;
+
+		case IC_PHI:
+		{
+			const InterCodeBasicBlock* block = mBlocks[bi];
+			bool	any = false;
+			for (int i = 0; i < ins->mNumOperands; i++)
+			{
+				const InterCodeBasicBlock* from = block->mEntryBlocks[i];
+				if (Range(mBlockIndex[from->mIndex], ins->mSrc[i], min0, max0))
+				{
+					int	t = ins->mSrc[i].mTemp;
+					bool	truth;
+					const InterInstruction* cins = EdgeCondition(from, block, truth);
+					if (t >= 0 && cins)
+						Constrain(cins, truth, t, min0, max0);
+
+					if (min0 <= max0)
+					{
+						if (!any)
+						{
+							min = min0;
+							max = max0;
+							any = true;
+						}
+						else
+						{
+							if (min0 < min)
+								min = min0;
+							if (max0 > max)
+								max = max0;
+						}
+					}
+				}
+			}
+			if (!any)
+				return false;
+			known = true;
+		}	break;
+
+		case IC_BINARY_OPERATOR:
+			if (IsIntegerType(type) && ins->mSrc[1].mType == type && (ins->mSrc[0].mType == type || ins->mSrc[0].mTemp < 0))
+			{
+				if (!Range(bi, ins->mSrc[1], min1, max1) || !Range(bi, ins->mSrc[0], min0, max0))
+					return false;
+				known = BinaryRange(ins->mOperator, type, min1, max1, min0, max0, min, max);
+			}
+			break;
+
+		case IC_UNARY_OPERATOR:
+			if ((type == IT_INT16 || type == IT_INT32) && ins->mSrc[0].mType == type && (ins->mOperator == IA_NEG || ins->mOperator == IA_NOT))
+			{
+				if (!Range(bi, ins->mSrc[0], min0, max0))
+					return false;
+				min = -max0;
+				max = -min0;
+				if (ins->mOperator == IA_NOT)
+				{
+					min--;
+					max--;
+				}
+				known = true;
+			}
+			break;
+
+		case IC_CONVERSION_OPERATOR:
+			switch (ins->mOperator)
+			{
+			case IA_EXT8TO16U:
+			case IA_EXT8TO16S:
+			case IA_EXT16TO32U:
+			case IA_EXT16TO32S:
+				if (!Range(bi, ins->mSrc[0], min, max))
+					return false;
+				if (ins->mOperator == IA_EXT8TO16S && max > 127)
+				{
+					min = -128;
+					max = 127;
+				}
+				else if (ins->mOperator == IA_EXT16TO32U && min < 0)
+				{
+					min = 0;
+					max = 65535;
+				}
+				known = true;
+				break;
+			}
+			break;
+		}
+
+		int64	tmin, tmax;
+		TypeRange(type, tmin, tmax);
+
+		if (!known || min < tmin || max > tmax)
+		{
+			min = tmin;
+			max = tmax;
+		}
+
+		return true;
+	}
+};
+
+bool InterCodeProcedure::ValueRangeNarrowing(void)
+{
+	BuildSSA();
+
+	ValueRangePropagation	vrp(mPostOrder, mPostOrderIndex, mIDom, mTemporaries, mSSABase);
+	if (!vrp.Run())
+	{
+		DestroySSA();
+		return false;
+	}
+
+	bool	changed = false;
+	int		n = mPostOrder.Size();
+
+	//
+	// Comparisons of non negative values that fit into a byte are unsigned
+	// byte comparisons, long comparisons of unsigned words word comparisons.
+	// The byte code interpreter gains little from the smaller comparisons but
+	// needs extra handlers for them, so these are kept to native code
+	//
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+			InterType	type = ins->mSrc[0].mType;
+
+			if (mNativeProcedure && ins->mCode == IC_RELATIONAL_OPERATOR && (type == IT_INT16 || type == IT_INT32) && ins->mSrc[1].mType == type)
+			{
+				int64	min0, max0, min1, max1;
+				if (vrp.Range(i, ins->mSrc[0], min0, max0) && vrp.Range(i, ins->mSrc[1], min1, max1) && min0 >= 0 && min1 >= 0)
+				{
+					InterType	ntype = IT_NONE;
+					if (max0 < 256 && max1 < 256)
+						ntype = IT_INT8;
+					else if (type == IT_INT32 && max0 < 65536 && max1 < 65536)
+						ntype = IT_INT16;
+
+					if (ntype != IT_NONE)
+					{
+						for (int k = 0; k < 2; k++)
+						{
+							if (ins->mSrc[k].mTemp < 0)
+								ins->mSrc[k].mIntConst = TypeValue(type, ins->mSrc[k].mIntConst);
+							ins->mSrc[k].mType = ntype;
+						}
+						ins->mOperator = UnsignedRelationalOperator(ins->mOperator);
+						changed = true;
+					}
+				}
+			}
+		}
+	}
+
+	//
+	// Word temporaries with all definitions in the byte range, and long
+	// temporaries in the word range are candidates for a smaller type, if
+	// they are only computed from constants, copies, extensions and
+	// operations that work on the low part of the operands
+	//
+	GrowingTypeArray	narrow(IT_NONE);
+	GrowingIntArray		extensions(0), operations(0);
+
+	narrow.SetSize(mSSABase);
+	for (int i = 0; i < mSSABase; i++)
+	{
+		if (mTemporaries[i] == IT_INT16)
+			narrow[i] = IT_INT8;
+		else if (mTemporaries[i] == IT_INT32)
+			narrow[i] = IT_INT16;
+		else
+			narrow[i] = IT_NONE;
+	}
+
+	for (int i = 0; i < n; i++)
+	{
+		InterCodeBasicBlock* block = mPostOrder[i];
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+
+			for (int k = 0; k < ins->mNumOperands; k++)
+			{
+				int	t = ins->mSrc[k].mTemp;
+				if (t >= 0 && t < mSSABase)
+					narrow[t] = IT_NONE;
+			}
+
+			int	t = ins->mDst.mTemp;
+			if (t >= 0)
+			{
+				int	o = mSSATemps[t];
+				InterType	ntype = narrow[o];
+
+				if (ntype != IT_NONE)
+				{
+					int64	min, max;
+					bool	valid = vrp.Range(t, min, max) && min >= 0 && max < (ntype == IT_INT8 ? 256 : 65536);
+
+					if (valid)
+					{
+						switch (ins->mCode)
+						{
+						case IC_PHI:
+						case IC_CONSTANT:
+						case IC_LOAD_TEMPORARY:
+							break;
+						case IC_BINARY_OPERATOR:
+							switch (ins->mOperator)
+							{
+							case IA_ADD:
+							case IA_SUB:
+							case IA_AND:
+							case IA_OR:
+							case IA_XOR:
+								// Loads are merged into the operation by the native code generator
+								// with the size of the load, so they have to stay in a wide temporary
+
+								for (int k = 0; k < 2; k++)
+								{
+									const InterInstruction* dins = ins->mSrc[k].mTemp >= 0 ? vrp.Definition(ins->mSrc[k].mTemp) : nullptr;
+									if (dins && dins->mCode == IC_LOAD)
+										valid = false;
+								}
+								break;
+							default:
+								valid = false;
+							}
+							break;
+						case IC_CONVERSION_OPERATOR:
+							if (ntype == IT_INT8)
+								valid = ins->mOperator == IA_EXT8TO16U || ins->mOperator == IA_EXT8TO16S;
+							else
+								valid = ins->mOperator == IA_EXT16TO32U || ins->mOperator == IA_EXT16TO32S;
+							break;
+						default:
+							valid = false;
+						}
+					}
+
+					if (!valid)
+						narrow[o] = IT_NONE;
+				}
+			}
+		}
+	}
+
+	//
+	// Uses that need the wide value get an extension, a temporary is only
+	// narrowed if it saves more than the extensions cost, which is never
+	// the case for byte code
+	//
+	extensions.SetSize(mSSABase);
+	operations.SetSize(mSSABase);
+
+	bool	reduced;
+	do
+	{
+		for (int i = 0; i < mSSABase; i++)
+		{
+			extensions[i] = 0;
+			operations[i] = 0;
+		}
+
+		for (int i = 0; i < n; i++)
+		{
+			InterCodeBasicBlock* block = mPostOrder[i];
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				InterInstruction* ins = block->mInstructions[j];
+				if (ins->mCode == IC_PHI)
+					continue;
+
+				InterType	dtype = ins->mDst.mTemp >= 0 ? narrow[mSSATemps[ins->mDst.mTemp]] : IT_NONE;
+				if (dtype != IT_NONE && ins->mCode == IC_BINARY_OPERATOR)
+					operations[mSSATemps[ins->mDst.mTemp]]++;
+
+				for (int k = 0; k < ins->mNumOperands; k++)
+				{
+					int	t = ins->mSrc[k].mTemp;
+					if (t >= 0)
+					{
+						int	o = mSSATemps[t];
+						if (narrow[o] != IT_NONE && ins->mSrc[k].mType == mTemporaries[o] &&
+							!(dtype == narrow[o] && (ins->mCode == IC_LOAD_TEMPORARY || ins->mCode == IC_BINARY_OPERATOR)))
+							extensions[o]++;
+					}
+				}
+			}
+		}
+
+		reduced = false;
+		for (int i = 0; i < mSSABase; i++)
+		{
+			if (narrow[i] != IT_NONE && extensions[i] > (mNativeProcedure ? operations[i] : 0))
+			{
+				narrow[i] = IT_NONE;
+				reduced = true;
+			}
+		}
+
+	} while (reduced);
+
+	DestroySSA();
+
+	//
+	// Change the definitions and uses of the narrowed temporaries
+	//
+	int	numTemps = mTemporaries.Size();
+
+	for (int i = 0; i < mBlocks.Size(); i++)
+	{
+		InterCodeBasicBlock* block = mBlocks[i];
+		for (int j = 0; j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+
+			InterType	dtype = ins->mDst.mTemp >= 0 && ins->mDst.mTemp < numTemps ? narrow[ins->mDst.mTemp] : IT_NONE;
+			bool		absorb = dtype != IT_NONE && (ins->mCode == IC_LOAD_TEMPORARY || ins->mCode == IC_BINARY_OPERATOR);
+
+			int	et = -1, ext = -1;
+			for (int k = 0; k < ins->mNumOperands; k++)
+			{
+				int	t = ins->mSrc[k].mTemp;
+				if (t >= 0 && t < numTemps && narrow[t] != IT_NONE && ins->mSrc[k].mType == mTemporaries[t])
+				{
+					if (absorb && narrow[t] == dtype)
+						ins->mSrc[k].mType = dtype;
+					else
+					{
+						if (et != t)
+						{
+							InterInstruction* cins = new InterInstruction();
+							cins->mCode = IC_CONVERSION_OPERATOR;
+							cins->mOperator = narrow[t] == IT_INT8 ? IA_EXT8TO16U : IA_EXT16TO32U;
+							cins->mSrc[0].mTemp = t;
+							cins->mSrc[0].mType = narrow[t];
+							cins->mDst.mType = mTemporaries[t];
+							cins->mDst.mTemp = AddTemporary(cins->mDst.mType);
+							cins->mLocation = ins->mLocation;
+							block->mInstructions.Insert(j++, cins);
+
+							et = t;
+							ext = cins->mDst.mTemp;
+						}
+						ins->mSrc[k].mTemp = ext;
+						ins->mSrc[k].mFinal = false;
+					}
+				}
+			}
+
+			if (dtype != IT_NONE)
+			{
+				InterType	wtype = mTemporaries[ins->mDst.mTemp];
+
+				switch (ins->mCode)
+				{
+				case IC_CONSTANT:
+					ins->mConst.mType = dtype;
+					break;
+				case IC_LOAD_TEMPORARY:
+					ins->mSrc[0].mType = dtype;
+					break;
+				case IC_BINARY_OPERATOR:
+					for (int k = 0; k < 2; k++)
+					{
+						if (ins->mSrc[k].mTemp < 0)
+							ins->mSrc[k].mIntConst = dtype == IT_INT8 ? int8(ins->mSrc[k].mIntConst) : int16(ins->mSrc[k].mIntConst);
+						else if (ins->mSrc[k].mType == wtype)
+							ins->mSrc[k].mType = dtype;
+					}
+					break;
+				case IC_CONVERSION_OPERATOR:
+					ins->mCode = IC_LOAD_TEMPORARY;
+					ins->mOperator = IA_NONE;
+					break;
+				}
+				ins->mDst.mType = dtype;
+				changed = true;
+			}
+		}
+	}
+
+	for (int i = 0; i < numTemps; i++)
+	{
+		if (narrow[i] != IT_NONE)
+			mTemporaries[i] = narrow[i];
+	}
+
+	DisassembleDebug("value range narrowing");
+
+	return changed;
+}
+
+void InterCodeProcedure::ReduceTemporaries(void)
+{
+	NumberSet* collisionSet;
+	int i, j, numRenamedTemps;
+	int numTemps = mTemporaries.Size();
+
+	ResetVisited();
+	mEntryBlock->BuildLocalTempSets(numTemps);
+
+	BuildPostOrder();
+	SolveProvidedSets(TempDataFlowSets);
+	SolveRequiredSets(TempDataFlowSets);
 
 	collisionSet = new NumberSet[numTemps];
 
@@ -5963,14 +9115,9 @@ void InterCodeProcedure::ReduceTemporaries(void)
 	ResetVisited();
 	mEntryBlock->BuildLocalTempSets(numRenamedTemps);
 
-	ResetVisited();
-	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numRenamedTemps));
-
-	NumberSet	totalRequired3(numRenamedTemps);
-
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired3));
+	BuildPostOrder();
+	SolveProvidedSets(TempDataFlowSets);
+	SolveRequiredSets(TempDataFlowSets);
 
 
 	NumberSet	callerSaved(numRenamedTemps);
@@ -6026,6 +9173,7 @@ void InterCodeProcedure::Disassemble(FILE* file)
 {
 	fprintf(file, "--------------------------------------------------------------------\n");
 	fprintf(file, "%s: %s:%d\n", mIdent->mString, mLocation.mFileName, mLocation.mLine);
+	fprintf(file, "dataflow: %d solves, %d block visits\n", mDataFlowSolves, mDataFlowVisits);
 
 	static char typechars[] = "NBCILFP";
 	for (int i = 0; i < mTemporaries.Size(); i++)
@@ -6077,13 +9225,16 @@ void InterCodeProcedure::Disassemble(const char* name, bool dumpSets)
 }
 
 InterCodeModule::InterCodeModule(void)
-	: mGlobalVars(nullptr), mProcedures(nullptr)
+	: mGlobalVars(nullptr), mProcedures(nullptr), mPassManager(nullptr)
 {
 }
 
 InterCodeModule::~InterCodeModule(void)
 {
-
+	for (int i = 0; i < mProcedures.Size(); i++)
+		delete mProcedures[i];
+	for (int i = 0; i < mGlobalVars.Size(); i++)
+		delete mGlobalVars[i];
 }
 
 bool InterCodeModule::Disassemble(const char* filename)
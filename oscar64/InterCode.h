@@ -8,6 +8,9 @@
 #include "MachineTypes.h"
 #include "Ident.h"
 #include "Linker.h"
+#include "MemoryArena.h"
+#include "PassManager.h"
+#include <functional>
 
 enum InterCode
 {
@@ -35,10 +38,12 @@ enum InterCode
 	IC_RETURN_STRUCT,
 	IC_RETURN,
 	IC_ASSEMBLER,
-	IC_JUMPF
+	IC_JUMPF,
+	IC_JUMPI,
+	IC_PHI
 };
 
-enum InterType
+enum InterType : uint8
 {
 	IT_NONE,
 	IT_BOOL,
@@ -51,7 +56,7 @@ enum InterType
 
 extern int InterTypeSize[];
 
-enum InterMemory
+enum InterMemory : uint8
 {
 	IM_NONE,
 	IM_PARAM,
@@ -136,9 +141,11 @@ protected:
 public:
 	ValueSet(void);
 	ValueSet(const ValueSet& values);
+	ValueSet(ValueSet&& values);
 	~ValueSet(void);
 
 	ValueSet& operator=(const ValueSet& values);
+	ValueSet& operator=(ValueSet&& values);
 
 	void FlushAll(void);
 	void FlushCallAliases(void);
@@ -159,9 +166,8 @@ protected:
 	{
 		int	mAssoc, mSucc, mPred;
 
-		Assoc(void) {}
+		Assoc(void) = default;
 		Assoc(int assoc, int succ, int pred) { this->mAssoc = assoc; this->mSucc = succ; this->mPred = pred; }
-		Assoc(const Assoc& assoc) { this->mAssoc = assoc.mAssoc; this->mSucc = assoc.mSucc; this->mPred = assoc.mPred; }
 	};
 
 	GrowingArray<Assoc>		mAssoc;
@@ -171,26 +177,23 @@ public:
 	{
 	}
 
-	TempForwardingTable(const TempForwardingTable & table) : mAssoc(Assoc(-1, -1, -1))
+	TempForwardingTable(const TempForwardingTable & table) : mAssoc(table.mAssoc)
+	{
+	}
+
+	TempForwardingTable(TempForwardingTable&& table) : mAssoc(std::move(table.mAssoc))
 	{
-		for (int i = 0; i < table.mAssoc.Size(); i++)
-		{
-			mAssoc[i].mAssoc = table.mAssoc[i].mAssoc;
-			mAssoc[i].mSucc = table.mAssoc[i].mSucc;
-			mAssoc[i].mPred = table.mAssoc[i].mPred;
-		}
 	}
 
 	TempForwardingTable& operator=(const TempForwardingTable& table)
 	{
-		mAssoc.SetSize(table.mAssoc.Size());
-		for (int i = 0; i < table.mAssoc.Size(); i++)
-		{
-			mAssoc[i].mAssoc = table.mAssoc[i].mAssoc;
-			mAssoc[i].mSucc = table.mAssoc[i].mSucc;
-			mAssoc[i].mPred = table.mAssoc[i].mPred;
-		}
+		mAssoc = table.mAssoc;
+		return *this;
+	}
 
+	TempForwardingTable& operator=(TempForwardingTable&& table)
+	{
+		mAssoc = std::move(table.mAssoc);
 		return *this;
 	}
 
@@ -209,7 +212,7 @@ public:
 		mAssoc.SetSize(size);
 
 		for (i = 0; i < size; i++)
-			mAssoc[i] = Assoc(i, i, i);
+			mAssoc.At(i) = Assoc(i, i, i);
 	}
 
 	void Reset(void)
@@ -217,7 +220,7 @@ public:
 		int i;
 
 		for (i = 0; i < mAssoc.Size(); i++)
-			mAssoc[i] = Assoc(i, i, i);
+			mAssoc.At(i) = Assoc(i, i, i);
 	}
 
 	int operator[](int n)
@@ -292,14 +295,14 @@ public:
 class InterOperand
 {
 public:
-	int					mTemp;
-	InterType			mType;
-	bool				mFinal;
 	int64				mIntConst;
 	double				mFloatConst;
-	int					mVarIndex, mOperandSize;
 	LinkerObject	*	mLinkerObject;
+	int					mTemp;
+	int					mVarIndex, mOperandSize;
+	InterType			mType;
 	InterMemory			mMemory;
+	bool				mFinal;
 
 	InterOperand(void);
 
@@ -310,7 +313,7 @@ class InterInstruction
 {
 public:
 	InterCode							mCode;
-	InterOperand						mSrc[8];
+	InterOperand					*	mSrc;
 	InterOperand						mDst;
 	InterOperand						mConst;
 	InterOperator						mOperator;
@@ -320,6 +323,12 @@ public:
 	bool								mInUse, mInvariant, mVolatile;
 
 	InterInstruction(void);
+	InterInstruction(const InterInstruction& ins);
+
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
+	void ReserveOperands(int num);
 
 	bool IsEqual(const InterInstruction* ins) const;
 
@@ -357,6 +366,11 @@ public:
 	void SimpleLocalToTemp(int vindex, int temp);
 
 	void Disassemble(FILE* file);
+protected:
+	InterOperand						mInlineSrc[3];
+	int									mMaxOperands;
+
+	InterInstruction& operator=(const InterInstruction& ins);
 };
 
 
@@ -410,6 +424,7 @@ public:
 	int								mIndex, mNumEntries, mNumEntered, mTraceIndex;
 	InterCodeBasicBlock			*	mTrueJump, * mFalseJump, * mDominator;
 	GrowingInstructionArray			mInstructions;
+	Location						mLocation;
 
 	bool							mVisited, mInPath, mLoopHead, mChecked;
 
@@ -433,13 +448,22 @@ public:
 	ValueSet						mMergeValues;
 	TempForwardingTable				mMergeForwardingTable;
 
+	// Predecessors in SSA form, operand i of a phi instruction is the value
+	// on entry from mEntryBlocks[i]
+
+	GrowingInterCodeBasicBlockPtrArray	mEntryBlocks;
+
 	InterCodeBasicBlock(void);
 	~InterCodeBasicBlock(void);
 
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
 	void Append(InterInstruction * code);
 	void Close(InterCodeBasicBlock* trueJump, InterCodeBasicBlock* falseJump);
 
 	void CollectEntries(void);
+	void CollectPostOrder(GrowingInterCodeBasicBlockPtrArray& order);
 	void GenerateTraces(bool expand);
 
 	void LocalToTemp(int vindex, int temp);
@@ -451,19 +475,13 @@ public:
 	bool PropagateConstTemps(const GrowingInstructionPtrArray& ctemps);
 
 	void BuildLocalTempSets(int num);
-	void BuildGlobalProvidedTempSet(NumberSet fromProvidedTemps);
-	bool BuildGlobalRequiredTempSet(NumberSet& fromRequiredTemps);
 	bool RemoveUnusedResultInstructions(void);
 	void BuildCallerSaveTempSet(NumberSet& callerSaveTemps);
 
 	void BuildLocalVariableSets(const GrowingVariableArray& localVars, const GrowingVariableArray& params, InterMemory paramMemory);
-	void BuildGlobalProvidedVariableSet(const GrowingVariableArray& localVars, NumberSet fromProvidedVars, const GrowingVariableArray& params, NumberSet fromProvidedParams, InterMemory paramMemory);
-	bool BuildGlobalRequiredVariableSet(const GrowingVariableArray& localVars, NumberSet& fromRequiredVars, const GrowingVariableArray& params, NumberSet& fromRequiredParams, InterMemory paramMemory);
 	bool RemoveUnusedStoreInstructions(const GrowingVariableArray& localVars, const GrowingVariableArray& params, InterMemory paramMemory);
 
 	void BuildStaticVariableSet(const GrowingVariableArray& staticVars);
-	void BuildGlobalProvidedStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet fromProvidedVars);
-	bool BuildGlobalRequiredStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet& fromRequiredVars);
 	bool RemoveUnusedStaticStoreInstructions(const GrowingVariableArray& staticVars);
 
 	GrowingIntArray			mEntryRenameTable;
@@ -501,6 +519,9 @@ public:
 
 	void MarkRelevantStatics(void);
 	void RemoveNonRelevantStatics(void);
+	void CollectAddressedProcedures(NumberSet& procs);
+	bool MapStaticFrame(const GrowingVariableArray& localVars, LinkerObject* frame, int offset);
+	int CountInstructions(void);
 
 	bool PushSinglePathResultInstructions(void);
 
@@ -518,6 +539,17 @@ public:
 	bool OptimizeIntervalCompare(void);
 };
 
+// The block sets of one dataflow problem, temporaries, local variables, parameters or statics
+
+struct InterDataFlowSets
+{
+	NumberSet InterCodeBasicBlock::*	mLocalProvided;
+	NumberSet InterCodeBasicBlock::*	mEntryRequired;
+	NumberSet InterCodeBasicBlock::*	mExitRequired;
+	NumberSet InterCodeBasicBlock::*	mEntryProvided;
+	NumberSet InterCodeBasicBlock::*	mExitProvided;
+};
+
 class InterCodeModule;
 
 class InterCodeProcedure
@@ -528,6 +560,15 @@ protected:
 	GrowingInstructionPtrArray			mValueForwardingTable;
 	NumberSet							mLocalAliasedSet, mParamAliasedSet;
 
+	GrowingInterCodeBasicBlockPtrArray	mPostOrder;
+	GrowingIntArray						mPostOrderIndex, mPredStart, mPreds;
+
+	// Immediate dominator of each block by post order index, and the
+	// original temporary of each temporary while in SSA form
+
+	GrowingIntArray						mIDom, mSSATemps;
+	int									mSSABase;
+
 	void ResetVisited(void);
 public:
 	InterCodeBasicBlock				*	mEntryBlock;
@@ -535,7 +576,14 @@ public:
 	GrowingTypeArray					mTemporaries;
 	GrowingIntArray						mTempOffset, mTempSizes;
 	int									mTempSize, mCommonFrameSize, mCallerSavedTemps;
-	bool								mLeafProcedure, mNativeProcedure, mCallsFunctionPointer, mHasDynamicStack, mHasInlineAssembler, mCallsByteCode, mFastCallProcedure;
+
+	// Offset of the callee saved temporaries in the saved registers, they are
+	// not saved on entry when the whole program allocation made them static
+
+	int									mTempBase;
+	bool								mStaticTemps;
+
+	bool								mLeafProcedure, mNativeProcedure, mCallsFunctionPointer, mHasDynamicStack, mHasInlineAssembler, mCallsByteCode, mFastCallProcedure, mColdProcedure;
 	GrowingInterCodeProcedurePtrArray	mCalledFunctions;
 
 	InterCodeModule					*	mModule;
@@ -549,6 +597,18 @@ public:
 
 	LinkerObject					*	mLinkerObject;
 
+	// Flags of the linker object found by the code generator, the procedures
+	// are compiled in parallel and read the flags of the other objects, so
+	// they are merged into the linker object after all are compiled
+
+	uint32								mLinkerFlags;
+
+	MemoryArena							mArena;
+
+	int									mDataFlowSolves, mDataFlowVisits;
+
+	PassStatistics					*	mPassStatistics;
+
 	InterCodeProcedure(InterCodeModule * module, const Location & location, const Ident * ident, LinkerObject* linkerObject);
 	~InterCodeProcedure(void);
 
@@ -557,6 +617,11 @@ public:
 	void Append(InterCodeBasicBlock * block);
 	void Close(void);
 
+	// Return the blocks and instructions to the arena once the code and the
+	// listings of the procedure have been written
+
+	void ReleaseCode(void);
+
 //	void Set(InterCodeIDMapper* mapper, BitVector localStructure, Scanner scanner, bool debug);
 
 	void AddCalledFunction(InterCodeProcedure* proc);
@@ -564,20 +629,48 @@ public:
 
 	void MarkRelevantStatics(void);
 	void RemoveNonRelevantStatics(void);
+	void CollectAddressedProcedures(NumberSet& procs);
+
+	// Place the locals at a fixed offset into a frame shared by procedures
+	// that are never active at the same time
+
+	bool MapStaticFrame(LinkerObject* frame, int offset);
 
 	void MapVariables(void);
 	void ReduceTemporaries(void);
 	void Disassemble(FILE* file);
 	void Disassemble(const char* name, bool dumpSets = false);
+
+	// Run an optimization pass under control of the pass manager, the pass
+	// returns if it changed the code, the native code passes count their
+	// own instructions
+
+	bool RunPass(OptimizerPass pass, const std::function<bool(void)>& run);
+	bool RunPass(OptimizerPass pass, const std::function<bool(void)>& run, const std::function<int(void)>& count);
+	int NumInstructions(void);
 protected:
 	void BuildTraces(bool expand);
 	void BuildDataFlowSets(void);
+	void BuildPostOrder(void);
+	void SolveProvidedSets(const InterDataFlowSets& sets);
+	void SolveRequiredSets(const InterDataFlowSets& sets);
 	void RenameTemporaries(void);
 	void TempForwarding(void);
 	void RemoveUnusedInstructions(void);
 	bool GlobalConstantPropagation(void);
 	void BuildDominators(void);
 
+	void BuildDominatorTree(void);
+	void BuildSSA(void);
+	void RenameSSA(int block, GrowingIntArray& current, const GrowingIntArray& domStart, const GrowingIntArray& domChildren);
+	void DestroySSA(void);
+	bool SparseConditionalConstantPropagation(void);
+	bool CollectNaturalLoop(int head, GrowingIntArray& body, GrowingIntArray& inLoop);
+	bool LoopInvariantCodeMotion(void);
+	bool InductionBoundGuarded(int pi, const InterOperand& start, const InterOperand& bound, bool unsign);
+	bool InductionVariableStrengthReduction(void);
+	bool ValueRangeNarrowing(void);
+
 	void MergeBasicBlocks(void);
 
 	void DisassembleDebug(const char* name);
@@ -594,4 +687,6 @@ public:
 	GrowingInterCodeProcedurePtrArray	mProcedures;
 
 	GrowingVariableArray				mGlobalVars;
+
+	PassManager						*	mPassManager;
 };
@@ -1,4 +1,5 @@
 #include "InterCodeGenerator.h"
+#include "Parser.h"
 
 InterCodeGenerator::InterCodeGenerator(Errors* errors, Linker* linker)
 	: mErrors(errors), mLinker(linker), mCompilerOptions(COPT_DEFAULT)
@@ -557,8 +558,191 @@ void InterCodeGenerator::TranslateAssembler(InterCodeModule* mod, Expression* ex
 	assert(offset == osize);
 }
 
+static const int	SwitchTableMinCases = 6;
+static const int	SwitchTableMaxSize = 128;
+
+void InterCodeGenerator::BuildSwitchBranch(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, InterOperator oper, int value, InterCodeBasicBlock* tblock, InterCodeBasicBlock* fblock)
+{
+	InterInstruction* vins = new InterInstruction();
+	vins->mCode = IC_CONSTANT;
+	vins->mConst.mType = InterTypeOf(v.mType);
+	vins->mConst.mIntConst = value;
+	vins->mDst.mType = vins->mConst.mType;
+	vins->mDst.mTemp = proc->AddTemporary(vins->mDst.mType);
+	block->Append(vins);
+
+	InterInstruction* cins = new InterInstruction();
+	cins->mCode = IC_RELATIONAL_OPERATOR;
+	cins->mOperator = oper;
+	cins->mSrc[0].mType = vins->mDst.mType;
+	cins->mSrc[0].mTemp = vins->mDst.mTemp;
+	cins->mSrc[1].mType = vins->mDst.mType;
+	cins->mSrc[1].mTemp = v.mTemp;
+	cins->mDst.mType = IT_BOOL;
+	cins->mDst.mTemp = proc->AddTemporary(cins->mDst.mType);
+	block->Append(cins);
+
+	InterInstruction* bins = new InterInstruction();
+	bins->mCode = IC_BRANCH;
+	bins->mSrc[0].mType = IT_BOOL;
+	bins->mSrc[0].mTemp = cins->mDst.mTemp;
+	block->Append(bins);
+
+	block->Close(tblock, fblock);
+}
+
+void InterCodeGenerator::BuildSwitchTable(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, const SwitchNodeArray& nodes, int left, int right, InterCodeBasicBlock* dblock)
+{
+	int	lo = nodes[left].mValue, size = nodes[right - 1].mValue - lo + 1;
+
+	InterType	vtype = InterTypeOf(v.mType);
+
+	// Rebase the selector to zero, a single unsigned compare then covers both ends of the range
+
+	if (lo != 0)
+	{
+		InterInstruction* vins = new InterInstruction();
+		vins->mCode = IC_CONSTANT;
+		vins->mConst.mType = vtype;
+		vins->mConst.mIntConst = lo;
+		vins->mDst.mType = vtype;
+		vins->mDst.mTemp = proc->AddTemporary(vins->mDst.mType);
+		block->Append(vins);
+
+		InterInstruction* sins = new InterInstruction();
+		sins->mCode = IC_BINARY_OPERATOR;
+		sins->mOperator = IA_SUB;
+		sins->mSrc[0].mType = vtype;
+		sins->mSrc[0].mTemp = vins->mDst.mTemp;
+		sins->mSrc[1].mType = vtype;
+		sins->mSrc[1].mTemp = v.mTemp;
+		sins->mDst.mType = vtype;
+		sins->mDst.mTemp = proc->AddTemporary(sins->mDst.mType);
+		block->Append(sins);
+
+		v.mTemp = sins->mDst.mTemp;
+	}
+
+	InterCodeBasicBlock* tblock = new InterCodeBasicBlock();
+	proc->Append(tblock);
+
+	BuildSwitchBranch(proc, block, v, IA_CMPLU, size, tblock, dblock);
+
+	// The table holds the low bytes of the case addresses followed by the high bytes,
+	// it is aligned so that neither half crosses a page.  Until the code is placed,
+	// each entry holds the position of its target in the chain of dispatch blocks.
+
+	LinkerObject* table = mLinker->AddObject(proc->mLocation, nullptr, proc->mLinkerObject->mSection, LOT_DATA);
+	uint8* data = table->AddSpace(2 * size);
+
+	table->mAlignment = 1;
+	while (table->mAlignment < 2 * size)
+		table->mAlignment *= 2;
+
+	GrowingArray<InterCodeBasicBlock*>	targets(nullptr);
+
+	int	j = left;
+	for (int i = 0; i < size; i++)
+	{
+		InterCodeBasicBlock* cblock = dblock;
+		if (nodes[j].mValue == lo + i)
+			cblock = nodes[j++].mBlock;
+
+		int k = 0;
+		while (k < targets.Size() && targets[k] != cblock)
+			k++;
+		if (k == targets.Size())
+			targets.Push(cblock);
+
+		data[i] = k;
+		data[i + size] = 0;
+	}
+
+	// A block has at most two successors, so the targets are attached to a chain of
+	// dispatch blocks, the first one does the indirect jump, the others only link
+
+	for (int k = 0; k < targets.Size(); k++)
+	{
+		InterCodeBasicBlock* nblock = dblock;
+		if (k + 1 < targets.Size())
+		{
+			nblock = new InterCodeBasicBlock();
+			proc->Append(nblock);
+		}
+
+		InterInstruction* jins = new InterInstruction();
+		jins->mCode = IC_JUMPI;
+		jins->mNumOperands = 1;
+		if (k == 0)
+		{
+			jins->mSrc[0].mType = vtype;
+			jins->mSrc[0].mTemp = v.mTemp;
+		}
+		jins->mConst.mLinkerObject = table;
+		jins->mConst.mIntConst = k;
+		tblock->Append(jins);
+		tblock->Close(targets[k], nblock);
+
+		tblock = nblock;
+	}
+}
+
 void InterCodeGenerator::BuildSwitchTree(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, const SwitchNodeArray& nodes, int left, int right, InterCodeBasicBlock* dblock)
 {
+	InterType		vtype = InterTypeOf(v.mType);
+	InterOperator	ltop = (vtype == IT_INT8 && !(v.mType->mFlags & DTF_SIGNED)) ? IA_CMPLU : IA_CMPLS;
+
+	if (right - left >= SwitchTableMinCases)
+	{
+		// Find the largest cluster of cases that fills at least 40% of its table
+
+		int	tleft = left, tright = left;
+		for (int i = left; i + SwitchTableMinCases <= right && right - i > tright - tleft; i++)
+		{
+			if (nodes[i].mValue < -32768)
+				continue;
+
+			for (int j = i + SwitchTableMinCases; j <= right && nodes[j - 1].mValue - nodes[i].mValue < SwitchTableMaxSize && nodes[j - 1].mValue < 32768; j++)
+			{
+				if (j - i > tright - tleft && 5 * (j - i) >= 2 * (nodes[j - 1].mValue - nodes[i].mValue + 1))
+				{
+					tleft = i;
+					tright = j;
+				}
+			}
+		}
+
+		if (tright > tleft)
+		{
+			if (tleft > left)
+			{
+				InterCodeBasicBlock* lblock = new InterCodeBasicBlock();
+				proc->Append(lblock);
+				InterCodeBasicBlock* rblock = new InterCodeBasicBlock();
+				proc->Append(rblock);
+
+				BuildSwitchBranch(proc, block, v, ltop, nodes[tleft].mValue, lblock, rblock);
+				BuildSwitchTree(proc, lblock, v, nodes, left, tleft, dblock);
+				block = rblock;
+			}
+
+			if (tright < right)
+			{
+				InterCodeBasicBlock* lblock = new InterCodeBasicBlock();
+				proc->Append(lblock);
+				InterCodeBasicBlock* rblock = new InterCodeBasicBlock();
+				proc->Append(rblock);
+
+				BuildSwitchBranch(proc, block, v, ltop, nodes[tright].mValue, lblock, rblock);
+				BuildSwitchTree(proc, rblock, v, nodes, tright, right, dblock);
+				block = lblock;
+			}
+
+			BuildSwitchTable(proc, block, v, nodes, tleft, tright, dblock);
+			return;
+		}
+	}
+
 	if (right - left < 5)
 	{
 		for (int i = left; i < right; i++)
@@ -568,9 +752,9 @@ void InterCodeGenerator::BuildSwitchTree(InterCodeProcedure* proc, InterCodeBasi
 
 			InterInstruction* vins = new InterInstruction();
 			vins->mCode = IC_CONSTANT;
-			vins->mConst.mType = IT_INT16;
+			vins->mConst.mType = vtype;
 			vins->mConst.mIntConst = nodes[i].mValue;
-			vins->mDst.mType = IT_INT16;
+			vins->mDst.mType = vtype;
 			vins->mDst.mTemp = proc->AddTemporary(vins->mDst.mType);
 			block->Append(vins);
 
@@ -618,9 +802,9 @@ void InterCodeGenerator::BuildSwitchTree(InterCodeProcedure* proc, InterCodeBasi
 
 		InterInstruction* vins = new InterInstruction();
 		vins->mCode = IC_CONSTANT;
-		vins->mConst.mType = IT_INT16;
+		vins->mConst.mType = vtype;
 		vins->mConst.mIntConst = nodes[center].mValue;
-		vins->mDst.mType = IT_INT16;
+		vins->mDst.mType = vtype;
 		vins->mDst.mTemp = proc->AddTemporary(vins->mDst.mType);
 		block->Append(vins);
 
@@ -646,7 +830,7 @@ void InterCodeGenerator::BuildSwitchTree(InterCodeProcedure* proc, InterCodeBasi
 
 		InterInstruction* rins = new InterInstruction();
 		rins->mCode = IC_RELATIONAL_OPERATOR;
-		rins->mOperator = IA_CMPLS;
+		rins->mOperator = ltop;
 		rins->mSrc[0].mType = vins->mDst.mType;
 		rins->mSrc[0].mTemp = vins->mDst.mTemp;
 		rins->mSrc[1].mType = vins->mDst.mType;
@@ -676,6 +860,9 @@ InterCodeGenerator::ExValue InterCodeGenerator::TranslateExpression(Declaration*
 
 	for (;;)
 	{
+		if (!block->mLocation.mFileName)
+			block->mLocation = exp->mLocation;
+
 		switch (exp->mType)
 		{
 		case EX_VOID:
@@ -2364,6 +2551,7 @@ InterCodeGenerator::ExValue InterCodeGenerator::TranslateExpression(Declaration*
 				jins->mSrc[0].mType = IT_POINTER;
 				jins->mSrc[0].mTemp = ins->mDst.mTemp;
 				jins->mNumOperands = 1;
+				jins->ReserveOperands(refvars.Size() + 1);
 
 				for (int i = 0; i < refvars.Size(); i++)
 				{
@@ -3013,7 +3201,12 @@ InterCodeGenerator::ExValue InterCodeGenerator::TranslateExpression(Declaration*
 		{
 			vl = TranslateExpression(procType, proc, block, exp->mLeft, breakBlock, continueBlock, inlineMapper);
 			vl = Dereference(proc, block, vl);
-			vl = CoerceType(proc, block, vl, TheSignedIntTypeDeclaration);
+
+			// Byte sized selectors are compared in eight bit, all others as int
+
+			bool	bsel = (vl.mType->mType == DT_TYPE_INTEGER || vl.mType->mType == DT_TYPE_ENUM) && vl.mType->mSize == 1;
+			if (!bsel)
+				vl = CoerceType(proc, block, vl, TheSignedIntTypeDeclaration);
 
 			InterCodeBasicBlock	* dblock = nullptr;
 			InterCodeBasicBlock* sblock = block;
@@ -3090,6 +3283,22 @@ InterCodeGenerator::ExValue InterCodeGenerator::TranslateExpression(Declaration*
 				sexp = sexp->mRight;
 			}
 
+			if (bsel)
+			{
+				// Cases outside of the range of the selector can never match
+
+				int	vmin = (vl.mType->mFlags & DTF_SIGNED) ? -128 : 0;
+
+				int i = 0;
+				while (i < switchNodes.Size())
+				{
+					if (switchNodes[i].mValue < vmin || switchNodes[i].mValue > vmin + 255)
+						switchNodes.Remove(i);
+					else
+						i++;
+				}
+			}
+
 			BuildSwitchTree(proc, sblock, vl, switchNodes, 0, switchNodes.Size(), dblock ? dblock : eblock);
 
 			if (block)
@@ -3259,8 +3468,13 @@ void InterCodeGenerator::TranslateLogic(Declaration* procType, InterCodeProcedur
 
 InterCodeProcedure* InterCodeGenerator::TranslateProcedure(InterCodeModule * mod, Expression* exp, Declaration * dec)
 {
+	if (dec->mBody)
+		exp = dec->mBody->mParser->ParseDeferredFunction(dec);
+
 	InterCodeProcedure* proc = new InterCodeProcedure(mod, dec->mLocation, dec->mIdent, mLinker->AddObject(dec->mLocation, dec->mIdent, dec->mSection, LOT_BYTE_CODE));
 
+	MemoryArena::Scope	arenaScope(&proc->mArena);
+
 	dec->mVarIndex = proc->mID;
 	dec->mLinkerObject = proc->mLinkerObject;
 	proc->mNumLocals = dec->mNumVars;
@@ -3271,6 +3485,9 @@ InterCodeProcedure* InterCodeGenerator::TranslateProcedure(InterCodeModule * mod
 	if (dec->mFlags & DTF_NATIVE)
 		proc->mNativeProcedure = true;
 
+	if (dec->mFlags & DTF_FUNC_COLD)
+		proc->mColdProcedure = true;
+
 	if (dec->mBase->mFlags & DTF_FASTCALL)
 	{
 		proc->mFastCallProcedure = true;
@@ -51,6 +51,8 @@ protected:
 	typedef GrowingArray<SwitchNode>	SwitchNodeArray;
 
 	void BuildSwitchTree(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, const SwitchNodeArray& nodes, int left, int right, InterCodeBasicBlock* dblock);
+	void BuildSwitchTable(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, const SwitchNodeArray& nodes, int left, int right, InterCodeBasicBlock* dblock);
+	void BuildSwitchBranch(InterCodeProcedure* proc, InterCodeBasicBlock* block, ExValue v, InterOperator oper, int value, InterCodeBasicBlock* tblock, InterCodeBasicBlock* fblock);
 
 	ExValue Dereference(InterCodeProcedure* proc, InterCodeBasicBlock*& block, ExValue v, int level = 0);
 	ExValue CoerceType(InterCodeProcedure* proc, InterCodeBasicBlock*& block, ExValue v, Declaration * type);
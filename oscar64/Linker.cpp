@@ -12,12 +12,14 @@ LinkerSection::LinkerSection(void)
 {}
 
 LinkerObject::LinkerObject(void)
-	: mReferences(nullptr), mNumTemporaries(0)
+	: mReferences(nullptr), mBlockOffsets(0), mBlockLocations(Location()), mAlignment(1), mNumTemporaries(0)
 {}
 
 LinkerObject::~LinkerObject(void)
 {
-
+	for (int i = 0; i < mReferences.Size(); i++)
+		delete mReferences[i];
+	delete[] mData;
 }
 
 void LinkerObject::AddReference(const LinkerReference& ref)
@@ -43,7 +45,7 @@ uint8* LinkerObject::AddSpace(int size)
 }
 
 Linker::Linker(Errors* errors)
-	: mErrors(errors), mSections(nullptr), mReferences(nullptr), mObjects(nullptr), mRegions(nullptr)
+	: mErrors(errors), mSections(nullptr), mReferences(nullptr), mObjects(nullptr), mRegions(nullptr), mAddressObjects(nullptr)
 {
 	for (int i = 0; i < 64; i++)
 	{
@@ -55,7 +57,14 @@ Linker::Linker(Errors* errors)
 
 Linker::~Linker(void)
 {
+	for (int i = 0; i < mObjects.Size(); i++)
+		delete mObjects[i];
+	for (int i = 0; i < mSections.Size(); i++)
+		delete mSections[i];
+	for (int i = 0; i < mRegions.Size(); i++)
+		delete mRegions[i];
 
+	delete[] mAddressObjects;
 }
 
 
@@ -120,6 +129,9 @@ bool Linker::IsSectionPlaced(LinkerSection* section)
 
 LinkerObject* Linker::FindObjectByAddr(int addr)
 {
+	if (mAddressObjects)
+		return addr >= 0 && addr < 0x10000 ? mAddressObjects[addr] : nullptr;
+
 	for (int i = 0; i < mObjects.Size(); i++)
 	{
 		LinkerObject* lobj = mObjects[i];
@@ -133,8 +145,37 @@ LinkerObject* Linker::FindObjectByAddr(int addr)
 	return nullptr;
 }
 
+void Linker::BuildAddressIndex(void)
+{
+	if (!mAddressObjects)
+		mAddressObjects = new LinkerObject*[0x10000];
+
+	for (int i = 0; i < 0x10000; i++)
+		mAddressObjects[i] = nullptr;
+
+	// Objects of cartridge banks share their addresses, the first object in
+	// the list wins as with the linear search
+
+	for (int i = mObjects.Size() - 1; i >= 0; i--)
+	{
+		LinkerObject* lobj = mObjects[i];
+		if (lobj->mFlags & LOBJF_PLACED)
+		{
+			int	start = lobj->mAddress, end = lobj->mAddress + lobj->mSize;
+			if (start < 0)
+				start = 0;
+			if (end > 0x10000)
+				end = 0x10000;
+			for (int addr = start; addr < end; addr++)
+				mAddressObjects[addr] = lobj;
+		}
+	}
+}
+
 LinkerObject * Linker::AddObject(const Location& location, const Ident* ident, LinkerSection * section, LinkerObjectType type)
 {
+	std::lock_guard<std::mutex>	lock(mMutex);
+
 	LinkerObject* obj = new LinkerObject;
 	obj->mLocation = location;
 	obj->mID = mObjects.Size();
@@ -146,6 +187,7 @@ LinkerObject * Linker::AddObject(const Location& location, const Ident* ident, L
 	obj->mRegion = nullptr;
 	obj->mProc = nullptr;
 	obj->mFlags = 0;
+	obj->mAlignment = 1;
 	section->mObjects.Push(obj);
 	mObjects.Push(obj);
 	return obj;
@@ -198,11 +240,12 @@ void Linker::Link(void)
 				for (int k = 0; k < lsec->mObjects.Size(); k++)
 				{
 					LinkerObject* lobj = lsec->mObjects[k];
-					if ((lobj->mFlags & LOBJF_REFERENCED) && !(lobj->mFlags & LOBJF_PLACED) && lrgn->mStart + lrgn->mUsed + lobj->mSize <= lrgn->mEnd)
+					int	start = (lrgn->mStart + lrgn->mUsed + lobj->mAlignment - 1) & ~(lobj->mAlignment - 1);
+					if ((lobj->mFlags & LOBJF_REFERENCED) && !(lobj->mFlags & LOBJF_PLACED) && start + lobj->mSize <= lrgn->mEnd)
 					{
 						lobj->mFlags |= LOBJF_PLACED;
-						lobj->mAddress = lrgn->mStart + lrgn->mUsed;
-						lrgn->mUsed += lobj->mSize;
+						lobj->mAddress = start;
+						lrgn->mUsed = start + lobj->mSize - lrgn->mStart;
 						lobj->mRegion = lrgn;
 
 						if (lsec->mType == LST_DATA)
@@ -311,6 +354,8 @@ void Linker::Link(void)
 					*dp += obj->mTemporaries[ref->mRefOffset];
 			}
 		}
+
+		BuildAddressIndex();
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "Array.h"
 #include "Errors.h"
 #include "Disassembler.h"
+#include <mutex>
 
 class InterCodeProcedure;
 
@@ -98,6 +99,7 @@ public:
 	uint8			*	mData;
 	InterCodeProcedure* mProc;
 	uint32				mFlags;
+	int					mAlignment;
 	uint8				mTemporaries[16], mTempSizes[16];
 	int					mNumTemporaries;
 
@@ -109,6 +111,12 @@ public:
 
 	GrowingArray<LinkerReference*>	mReferences;
 
+	// Start offsets of the basic blocks of a procedure and the source location
+	// of their first statement, used to map profiles back to code
+
+	GrowingArray<int>				mBlockOffsets;
+	GrowingArray<Location>			mBlockLocations;
+
 	void AddReference(const LinkerReference& ref);
 };
 
@@ -124,6 +132,8 @@ public:
 	LinkerSection * AddSection(const Ident* section, LinkerSectionType type);
 	LinkerSection* FindSection(const Ident* section);
 
+	// Placed object at an address, from an index built at the end of Link
+
 	LinkerObject* FindObjectByAddr(int addr);
 
 	bool IsSectionPlaced(LinkerSection* section);
@@ -159,4 +169,10 @@ protected:
 	ByteCodeDisassembler	mByteCodeDisassembler;
 
 	Errors* mErrors;
+
+	LinkerObject	**	mAddressObjects;
+
+	void BuildAddressIndex(void);
+
+	std::mutex	mMutex;
 };
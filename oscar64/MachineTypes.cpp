@@ -14,3 +14,19 @@ uint8 BC_REG_LOCALS = 0x25;
 uint8 BC_REG_TMP = 0x43;
 uint8 BC_REG_TMP_SAVED = 0x53;
 
+void ResetRegisters(void)
+{
+	BC_REG_WORK = 0x03;
+	BC_REG_WORK_Y = 0x02;
+	BC_REG_FPARAMS = 0x0d;
+	BC_REG_FPARAMS_END = 0x19;
+
+	BC_REG_IP = 0x19;
+	BC_REG_ACCU = 0x1b;
+	BC_REG_ADDR = 0x1f;
+	BC_REG_STACK = 0x23;
+	BC_REG_LOCALS = 0x25;
+
+	BC_REG_TMP = 0x43;
+	BC_REG_TMP_SAVED = 0x53;
+}
@@ -95,3 +95,7 @@ extern uint8 BC_REG_LOCALS;
 extern uint8 BC_REG_TMP;
 extern uint8 BC_REG_TMP_SAVED;
 
+// Default locations, the runtime may move the registers with #pragma register
+
+void ResetRegisters(void);
+
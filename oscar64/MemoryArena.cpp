@@ -0,0 +1,99 @@
+#include "MemoryArena.h"
+#include <stdlib.h>
+
+static const size_t ArenaChunkSize = 0x10000;
+
+static thread_local MemoryArena* CurrentArena = nullptr;
+static thread_local MemoryArena* DefaultArena = nullptr;
+
+MemoryArena::MemoryArena(void)
+	: mChunks(nullptr), mCleanups(nullptr), mPos(nullptr), mEnd(nullptr), mUsed(0)
+{
+}
+
+MemoryArena::~MemoryArena(void)
+{
+	Release();
+}
+
+void* MemoryArena::Allocate(size_t size)
+{
+	size = (size + 15) & ~size_t(15);
+
+	if (size_t(mEnd - mPos) < size)
+	{
+		size_t	csize = ArenaChunkSize;
+		if (size + sizeof(Chunk) > csize)
+			csize = size + sizeof(Chunk);
+
+		Chunk* chunk = (Chunk*)malloc(csize);
+		if (!chunk)
+			throw std::bad_alloc();
+
+		chunk->mNext = mChunks;
+		chunk->mSize = csize;
+		mChunks = chunk;
+
+		mPos = (char*)chunk + ((sizeof(Chunk) + 15) & ~size_t(15));
+		mEnd = (char*)chunk + csize;
+	}
+
+	void* p = mPos;
+	mPos += size;
+	mUsed += size;
+
+	return p;
+}
+
+void MemoryArena::AddCleanup(void(*destroy)(void* obj), void* obj)
+{
+	Cleanup* c = (Cleanup*)Allocate(sizeof(Cleanup));
+	c->mNext = mCleanups;
+	c->mDestroy = destroy;
+	c->mObject = obj;
+	mCleanups = c;
+}
+
+void MemoryArena::Release(void)
+{
+	while (mCleanups)
+	{
+		Cleanup* c = mCleanups;
+		mCleanups = c->mNext;
+		c->mDestroy(c->mObject);
+	}
+
+	while (mChunks)
+	{
+		Chunk* c = mChunks;
+		mChunks = c->mNext;
+		free(c);
+	}
+
+	mPos = mEnd = nullptr;
+	mUsed = 0;
+}
+
+MemoryArena* MemoryArena::Current(void)
+{
+	if (CurrentArena)
+		return CurrentArena;
+
+	// Only the builtins created before the first compiler, that live as long
+	// as the process, are allocated outside of a compiler or procedure scope
+
+	if (!DefaultArena)
+		DefaultArena = new MemoryArena();
+	return DefaultArena;
+}
+
+MemoryArena::Scope::Scope(MemoryArena* arena)
+	: mPrev(CurrentArena)
+{
+	CurrentArena = arena;
+}
+
+MemoryArena::Scope::~Scope(void)
+{
+	CurrentArena = mPrev;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include <new>
+
+// Bump allocator for the intermediate and native code of a single procedure.
+// Objects are never freed individually, all memory is returned in one go
+// when the arena is released.  Objects that own heap memory register their
+// destructor, which is run on release in reverse order of allocation.
+
+class MemoryArena
+{
+public:
+	MemoryArena(void);
+	~MemoryArena(void);
+
+	void* Allocate(size_t size);
+
+	template<class T> void* AllocateObject(size_t size);
+
+	void Release(void);
+
+	size_t Used(void) const { return mUsed; }
+
+	// Arena used by class level operator new of the code objects on this thread
+
+	static MemoryArena* Current(void);
+
+	class Scope
+	{
+	public:
+		Scope(MemoryArena* arena);
+		~Scope(void);
+	protected:
+		MemoryArena* mPrev;
+	};
+
+protected:
+	struct Chunk
+	{
+		Chunk	*	mNext;
+		size_t		mSize;
+	};
+
+	struct Cleanup
+	{
+		Cleanup	*	mNext;
+		void		(*mDestroy)(void* obj);
+		void	*	mObject;
+	};
+
+	Chunk	*	mChunks;
+	Cleanup	*	mCleanups;
+	char	*	mPos, * mEnd;
+	size_t		mUsed;
+
+	void AddCleanup(void(*destroy)(void* obj), void* obj);
+
+	template<class T> static void Destroy(void* obj)
+	{
+		((T*)obj)->~T();
+	}
+};
+
+template<class T> void* MemoryArena::AllocateObject(size_t size)
+{
+	void* obj = Allocate(size);
+	AddCleanup(Destroy<T>, obj);
+	return obj;
+}
+
@@ -16,7 +16,7 @@ static const uint32 LIVE_CPU_REG_C = 0x00000008;
 static const uint32 LIVE_CPU_REG_Z = 0x00000010;
 static const uint32 LIVE_MEM	   = 0x00000020;
 
-static int GlobalValueNumber = 0;
+static thread_local int GlobalValueNumber = 0;
 
 NativeRegisterData::NativeRegisterData(void)
 	: mMode(NRDM_UNKNOWN), mValue(GlobalValueNumber++)
@@ -121,7 +121,7 @@ void NativeRegisterDataSet::Intersect(const NativeRegisterDataSet& set)
 }
 
 NativeCodeInstruction::NativeCodeInstruction(AsmInsType type, AsmInsMode mode, int address, LinkerObject* linkerObject, uint32 flags)
-	: mType(type), mMode(mode), mAddress(address), mLinkerObject(linkerObject), mFlags(flags)
+	: mType(type), mMode(mode), mAddress(address), mLinkerObject(linkerObject), mFlags(flags), mLive(0)
 {}
 
 bool NativeCodeInstruction::IsUsedResultInstructions(NumberSet& requiredTemps)
@@ -1560,9 +1560,9 @@ bool NativeCodeInstruction::ValueForwarding(NativeRegisterDataSet& data, AsmInsT
 
 				int c = t >= 256;
 
-				if (t && !data.mRegs[CPU_REG_C].mValue)
+				if (c && !data.mRegs[CPU_REG_C].mValue)
 					carryop = ASMIT_SEC;
-				else if (!t && data.mRegs[CPU_REG_C].mValue)
+				else if (!c && data.mRegs[CPU_REG_C].mValue)
 					carryop = ASMIT_CLC;
 
 				changed = true;
@@ -6388,6 +6388,8 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 	else if (ins->mSrc[1].mTemp < 0 && ins->mSrc[1].mIntConst == 0 || ins->mSrc[0].mTemp < 0 && ins->mSrc[0].mIntConst == 0)
 	{
 		int	rt = ins->mSrc[1].mTemp;
+		bool	byte = ins->mSrc[0].mType == IT_INT8 || ins->mSrc[0].mType == IT_BOOL;
+
 		if (rt < 0)
 		{
 			rt = ins->mSrc[0].mTemp;
@@ -6425,14 +6427,14 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 		case IA_CMPEQ:
 		case IA_CMPLEU:
 			mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 0));
-			if (ins->mSrc[0].mType != IT_INT8)
+			if (!byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_ORA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
 			this->Close(trueJump, falseJump, ASMIT_BEQ);
 			break;
 		case IA_CMPNE:
 		case IA_CMPGU:
 			mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 0));
-			if (ins->mSrc[0].mType != IT_INT8)
+			if (!byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_ORA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
 			this->Close(trueJump, falseJump, ASMIT_BNE);
 			break;
@@ -6443,14 +6445,14 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 			this->Close(falseJump, nullptr, ASMIT_JMP);
 			break;
 		case IA_CMPGES:
-			if (ins->mSrc[0].mType == IT_INT8)
+			if (byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt]));
 			else
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
 			this->Close(trueJump, falseJump, ASMIT_BPL);
 			break;
 		case IA_CMPLS:
-			if (ins->mSrc[0].mType == IT_INT8)
+			if (byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt]));
 			else
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
@@ -6459,12 +6461,12 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 		case IA_CMPGS:
 		{
 			NativeCodeBasicBlock* eblock = nproc->AllocateBlock();
-			if (ins->mSrc[0].mType == IT_INT8)
+			if (byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt]));
 			else
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
 			this->Close(eblock, falseJump, ASMIT_BPL);
-			if (ins->mSrc[0].mType != IT_INT8)
+			if (!byte)
 				eblock->mIns.Push(NativeCodeInstruction(ASMIT_ORA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 0));
 			eblock->Close(trueJump, falseJump, ASMIT_BNE);
 			break;
@@ -6472,12 +6474,12 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 		case IA_CMPLES:
 		{
 			NativeCodeBasicBlock* eblock = nproc->AllocateBlock();
-			if (ins->mSrc[0].mType == IT_INT8)
+			if (byte)
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt]));
 			else
 				mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 1));
 			this->Close(eblock, trueJump, ASMIT_BPL);
-			if (ins->mSrc[0].mType != IT_INT8)
+			if (!byte)
 				eblock->mIns.Push(NativeCodeInstruction(ASMIT_ORA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[rt] + 0));
 			eblock->Close(trueJump, falseJump, ASMIT_BEQ);
 			break;
@@ -6485,7 +6487,7 @@ void NativeCodeBasicBlock::RelationalOperator(InterCodeProcedure* proc, const In
 
 		}
 	}
-	else if (ins->mSrc[0].mType == IT_INT8)
+	else if (ins->mSrc[0].mType == IT_INT8 || ins->mSrc[0].mType == IT_BOOL)
 	{
 		NativeCodeBasicBlock* eblock = nproc->AllocateBlock();
 		NativeCodeBasicBlock* nblock = nproc->AllocateBlock();
@@ -7103,6 +7105,14 @@ void NativeCodeBasicBlock::BuildLocalRegSets(void)
 		mEntryRequiredRegs = mLocalRequiredRegs;
 		mExitProvidedRegs = mLocalProvidedRegs;
 
+		if (mJumpTable)
+		{
+			// The indirect jump at the end of the block uses the address register
+
+			mExitRequiredRegs += BC_REG_ADDR;
+			mExitRequiredRegs += BC_REG_ADDR + 1;
+		}
+
 		if (mTrueJump) mTrueJump->BuildLocalRegSets();
 		if (mFalseJump) mFalseJump->BuildLocalRegSets();
 	}
@@ -7250,6 +7260,7 @@ bool NativeCodeBasicBlock::MergeBasicBlocks(void)
 				for (int i = 0; i < mTrueJump->mIns.Size(); i++)
 					mIns.Push(mTrueJump->mIns[i]);
 				mBranch = mTrueJump->mBranch;
+				mJumpTable = mTrueJump->mJumpTable;
 				mFalseJump = mTrueJump->mFalseJump;
 				mTrueJump = mTrueJump->mTrueJump;
 				changed = true;
@@ -7425,6 +7436,12 @@ void NativeCodeBasicBlock::FindZeroPageAlias(const NumberSet& statics, NumberSet
 				accu = -1;
 		}
 
+		if (mJumpTable)
+		{
+			invalid += BC_REG_ADDR;
+			invalid += BC_REG_ADDR + 1;
+		}
+
 		if (mTrueJump)
 			mTrueJump->FindZeroPageAlias(statics, invalid, alias, accu);
 		if (mFalseJump)
@@ -7467,6 +7484,13 @@ void NativeCodeBasicBlock::CollectZeroPageUsage(NumberSet& used, NumberSet &modi
 			}
 		}
 
+		if (mJumpTable)
+		{
+			used += BC_REG_ADDR + 0;
+			used += BC_REG_ADDR + 1;
+			pairs += BC_REG_ADDR;
+		}
+
 		if (mTrueJump)
 			mTrueJump->CollectZeroPageUsage(used, modified, pairs);
 		if (mFalseJump)
@@ -7796,6 +7820,16 @@ void NativeCodeBasicBlock::GlobalRegisterXYCheck(int* xregs, int* yregs)
 			}
 		}
 
+		if (mJumpTable)
+		{
+			// The indirect jump reads the address register from memory
+
+			xregs[BC_REG_ADDR + 0] = -1;
+			xregs[BC_REG_ADDR + 1] = -1;
+			yregs[BC_REG_ADDR + 0] = -1;
+			yregs[BC_REG_ADDR + 1] = -1;
+		}
+
 		if (xregs[0] >= 0 || yregs[0] >= 0)
 		{
 			if (mTrueJump)
@@ -8969,6 +9003,8 @@ bool NativeCodeBasicBlock::OptimizeInnerLoop(NativeCodeProcedure* proc, NativeCo
 	for (int j = 0; j < lblocks.Size(); j++)
 	{
 		NativeCodeBasicBlock* block = lblocks[j];
+		if (block->mBranch == ASMIT_INV)
+			simple = false;
 		for (int i = 0; i < block->mIns.Size(); i++)
 		{
 			if (block->mIns[i].mType == ASMIT_JSR)
@@ -9222,7 +9258,10 @@ bool NativeCodeBasicBlock::OptimizeInnerLoops(NativeCodeProcedure* proc)
 		{
 			NativeCodeBasicBlock* tail = FindTailBlock(this);
 
-			if (tail)
+			// Single block loops are left to the simple loop optimization, the
+			// rewrite below assumes a separate head and tail block
+
+			if (tail && tail != this)
 			{
 				GrowingArray<NativeCodeBasicBlock*>	 lblocks(nullptr);
 				CollectInnerLoop(this, lblocks);
@@ -9245,6 +9284,20 @@ bool NativeCodeBasicBlock::OptimizeInnerLoops(NativeCodeProcedure* proc)
 // Size reduction violating various assumptions such as no branches in basic blocks
 // must be last step before actual assembly
 
+int NativeCodeBasicBlock::CountInstructions(void)
+{
+	int	num = 0;
+	if (!mVisited)
+	{
+		mVisited = true;
+
+		num = mIns.Size();
+		if (mTrueJump) num += mTrueJump->CountInstructions();
+		if (mFalseJump) num += mFalseJump->CountInstructions();
+	}
+	return num;
+}
+
 void NativeCodeBasicBlock::BlockSizeReduction(void)
 {
 	if (!mVisited)
@@ -9442,6 +9495,645 @@ bool NativeCodeBasicBlock::RemoveNops(void)
 	return changed;
 }
 
+// Table driven peephole patterns, a pattern matches one to four consecutive
+// instructions, patterns of the same length are tried in table order and
+// the first matching one is applied
+
+struct NativePeepHoleOperand
+{
+	AsmInsType	mType;		// NUM_ASM_INS_TYPES matches any instruction
+	uint32		mModes;		// mask of accepted addressing modes, zero for any
+	int			mValue;		// required immediate operand or -1
+	uint32		mDead;		// live flags that must not be set
+	uint32		mFlags;		// required properties of the instruction
+};
+
+enum NativePeepHoleFlag
+{
+	NPHF_CHANGES_ACCU = 0x0001,		// changes accu and flags
+	NPHF_KEEPS_ACCU = 0x0002,
+	NPHF_NO_ACCU = 0x0004,			// neither uses nor requires the accu
+	NPHF_NO_ACCU_REQUIRED = 0x0008,
+	NPHF_KEEPS_X = 0x0010,
+	NPHF_KEEPS_Y = 0x0020,
+	NPHF_KEEPS_ADDRESS = 0x0040,
+	NPHF_KEEPS_GLOBAL = 0x0080,
+	NPHF_COMMUTATIVE = 0x0100,
+	NPHF_SHIFT = 0x0200
+};
+
+enum NativePeepHoleCheck
+{
+	NPHC_NONE,
+	NPHC_SAME_ADDRESS,
+	NPHC_OTHER_ADDRESS,
+	NPHC_SAME_EFFECTIVE_ADDRESS,
+	NPHC_OTHER_EFFECTIVE_ADDRESS,
+	NPHC_NO_ZERO_PAGE_USE,			// a does not use the zero page address of b
+	NPHC_NO_ZERO_PAGE_CHANGE,		// a does not change the zero page address of b
+	NPHC_HAS_MODE,					// a exists with the addressing mode of b
+	NPHC_LOW_BYTE,					// the low byte of the operand of a is b
+	NPHC_AT_MOST					// the operand of a is at most b
+};
+
+struct NativePeepHoleTest
+{
+	NativePeepHoleCheck	mCheck;
+	int					mA, mB;
+};
+
+enum NativePeepHoleAction
+{
+	NPHA_TYPE0,
+	NPHA_NOP0,
+	NPHA_NOP1,
+	NPHA_NOP1_LIVE_A,
+	NPHA_NOP1_LIVE_Z,
+	NPHA_AND_IMMEDIATE,
+	NPHA_ORA_IMMEDIATE,
+	NPHA_EOR_IMMEDIATE,
+	NPHA_NOP0_TYPE1,
+	NPHA_TYPE1,
+	NPHA_TYPE1_IMPLIED,
+	NPHA_TYPE1_LIVE0,
+	NPHA_TRANSFER1,
+	NPHA_LOAD_REGISTER,
+	NPHA_SHIFT_STORE,
+	NPHA_SHIFT_LOAD,
+	NPHA_SHIFT_TAY,
+
+	NPHA_NOP0_IMPLIED,
+	NPHA_NOP2,
+	NPHA_NOP2_LIVE_Z,
+	NPHA_NOP2_LIVE_ACCU,
+	NPHA_NOP2_LIVE_ACCU_BOTH,
+	NPHA_TYPE2_IMPLIED,
+	NPHA_LOAD_REGISTER_EARLY,
+	NPHA_STORE_ADD,
+	NPHA_COMMUTE,
+	NPHA_CARRY_CLEAR,
+	NPHA_SHIFT_MEMORY,
+	NPHA_SHIFT_STORE_DOWN,
+	NPHA_SHIFT_STORE_IMMEDIATE,
+	NPHA_CONST_SUB,
+	NPHA_CONST_ADD,
+	NPHA_CLC_UP,
+	NPHA_INCREMENT_Y,
+	NPHA_SHIFT_ACCU,
+
+	NPHA_MEMORY_TYPE3,
+	NPHA_DEC_LOAD,
+	NPHA_COMPARE_SOURCE,
+	NPHA_STORE_X_UP,
+	NPHA_EOR_INDIRECT,
+	NPHA_REVERSE_SUB,
+	NPHA_SET_ROL,
+	NPHA_OPERAND_SOURCE,
+	NPHA_NOP0123,
+	NPHA_FLIP_ADD
+};
+
+struct NativePeepHolePattern
+{
+	int						mLength;
+	NativePeepHoleOperand	mIns[4];
+	NativePeepHoleTest		mTests[3];
+	NativePeepHoleAction	mAction;
+	AsmInsType				mNewType;
+	uint32					mLive;
+};
+
+#define NPHM(m)		(1u << ASMIM_##m)
+#define NPH_ANY		NUM_ASM_INS_TYPES
+
+static const uint32 NPHM_STORE = NPHM(ZERO_PAGE) | NPHM(ABSOLUTE);
+static const uint32 NPHM_LOAD = NPHM(IMMEDIATE) | NPHM(ZERO_PAGE) | NPHM(ABSOLUTE);
+
+static const NativePeepHolePattern NativePeepHolePatterns[] =
+{
+	{ 1, { { ASMIT_AND, NPHM(IMMEDIATE), 0x00, 0 } }, {}, NPHA_TYPE0, ASMIT_LDA },
+	{ 1, { { ASMIT_AND, NPHM(IMMEDIATE), 0xff, LIVE_CPU_REG_Z } }, {}, NPHA_NOP0 },
+	{ 1, { { ASMIT_ORA, NPHM(IMMEDIATE), 0xff, 0 } }, {}, NPHA_TYPE0, ASMIT_LDA },
+	{ 1, { { ASMIT_ORA, NPHM(IMMEDIATE), 0x00, LIVE_CPU_REG_Z } }, {}, NPHA_NOP0 },
+	{ 1, { { ASMIT_ROR, NPHM(IMPLIED), -1, LIVE_CPU_REG_A | LIVE_CPU_REG_Z } }, {}, NPHA_TYPE0, ASMIT_LSR },
+	{ 1, { { ASMIT_ROL, NPHM(IMPLIED), -1, LIVE_CPU_REG_A | LIVE_CPU_REG_Z } }, {}, NPHA_TYPE0, ASMIT_ASL },
+
+	{ 2, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_LDA, 0, -1, 0 } }, {}, NPHA_NOP0 },
+	{ 2, { { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_NOP1 },
+	{ 2, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_Z } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_NOP1_LIVE_A },
+	{ 2, { { ASMIT_AND, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_AND, NPHM(IMMEDIATE), -1, 0 } }, {}, NPHA_AND_IMMEDIATE },
+	{ 2, { { ASMIT_ORA, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_ORA, NPHM(IMMEDIATE), -1, 0 } }, {}, NPHA_ORA_IMMEDIATE },
+	{ 2, { { ASMIT_EOR, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_EOR, NPHM(IMMEDIATE), -1, 0 } }, {}, NPHA_EOR_IMMEDIATE },
+	{ 2, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_ORA, NPHM(IMMEDIATE), 0x00, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_EOR, NPHM(IMMEDIATE), 0x00, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_AND, NPHM(IMMEDIATE), 0xff, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_CLC, 0, -1, 0 }, { ASMIT_ROR, 0, -1, 0 } }, {}, NPHA_NOP0_TYPE1, ASMIT_LSR },
+	{ 2, { { ASMIT_LDA, NPHM(IMMEDIATE), 0x00, 0 }, { ASMIT_LSR, NPHM(IMPLIED), -1, 0 } }, {}, NPHA_TYPE1, ASMIT_CLC },
+	{ 2, { { ASMIT_CLC, 0, -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), 0x00, LIVE_CPU_REG_Z } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_SEC, 0, -1, 0 }, { ASMIT_SBC, NPHM(IMMEDIATE), 0x00, LIVE_CPU_REG_Z } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_ADC, 0, -1, 0 } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 1 } }, NPHA_TYPE1_IMPLIED, ASMIT_ROL },
+	{ 2, { { NPH_ANY, 0, -1, 0, NPHF_CHANGES_ACCU }, { ASMIT_ORA, NPHM(IMMEDIATE), 0x00, 0 } }, {}, NPHA_NOP1_LIVE_Z },
+	{ 2, { { NPH_ANY, 0, -1, 0, NPHF_CHANGES_ACCU }, { ASMIT_CMP, NPHM(IMMEDIATE), 0x00, LIVE_CPU_REG_C } }, {}, NPHA_NOP1_LIVE_Z },
+	{ 2, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A }, { ASMIT_LSR, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_STORE },
+	{ 2, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A }, { ASMIT_ASL, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_STORE },
+	{ 2, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A }, { ASMIT_ROL, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_STORE },
+	{ 2, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A }, { ASMIT_ROR, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_STORE },
+	{ 2, { { ASMIT_ASL, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDY, NPHM(ZERO_PAGE), -1, LIVE_MEM | LIVE_CPU_REG_A } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_TAY },
+	{ 2, { { ASMIT_STA, 0, -1, 0 }, { ASMIT_LDY, 0, -1, 0 } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 1 } }, NPHA_TRANSFER1, ASMIT_TAY },
+	{ 2, { { ASMIT_STA, 0, -1, 0 }, { ASMIT_LDX, 0, -1, 0 } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 1 } }, NPHA_TRANSFER1, ASMIT_TAX },
+	{ 2, { { ASMIT_TXA, 0, -1, 0 }, { ASMIT_STA, NPHM_STORE, -1, 0 } }, {}, NPHA_TYPE1, ASMIT_STX },
+	{ 2, { { ASMIT_TYA, 0, -1, 0 }, { ASMIT_STA, NPHM_STORE, -1, 0 } }, {}, NPHA_TYPE1, ASMIT_STY },
+	{ 2, { { ASMIT_TAX, 0, -1, 0 }, { ASMIT_STX, NPHM_STORE, -1, 0 } }, {}, NPHA_TYPE1, ASMIT_STA },
+	{ 2, { { ASMIT_TAY, 0, -1, 0 }, { ASMIT_STY, NPHM_STORE, -1, 0 } }, {}, NPHA_TYPE1, ASMIT_STA },
+	{ 2, { { ASMIT_TXA, 0, -1, 0 }, { ASMIT_TAX, 0, -1, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_TYA, 0, -1, 0 }, { ASMIT_TAY, 0, -1, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_TAX, 0, -1, 0 }, { ASMIT_TXA, 0, -1, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_TAY, 0, -1, 0 }, { ASMIT_TYA, 0, -1, 0 } }, {}, NPHA_NOP1 },
+	{ 2, { { ASMIT_LDA, NPHM_LOAD, -1, 0 }, { ASMIT_TAY, 0, -1, LIVE_CPU_REG_A } }, {}, NPHA_LOAD_REGISTER, ASMIT_LDY },
+	{ 2, { { ASMIT_LDA, NPHM_LOAD, -1, 0 }, { ASMIT_TAX, 0, -1, LIVE_CPU_REG_A } }, {}, NPHA_LOAD_REGISTER, ASMIT_LDX },
+	{ 2, { { ASMIT_LDY, NPHM_LOAD, -1, 0 }, { ASMIT_TYA, 0, -1, LIVE_CPU_REG_Y } }, {}, NPHA_LOAD_REGISTER, ASMIT_LDA },
+	{ 2, { { ASMIT_LDX, NPHM_LOAD, -1, 0 }, { ASMIT_TXA, 0, -1, LIVE_CPU_REG_X } }, {}, NPHA_LOAD_REGISTER, ASMIT_LDA },
+	{ 2, { { ASMIT_TXA, 0, -1, 0 }, { ASMIT_CMP, NPHM(IMMEDIATE) | NPHM(ZERO_PAGE), -1, 0 } }, {}, NPHA_TYPE1_LIVE0, ASMIT_CPX, CPU_REG_X },
+	{ 2, { { ASMIT_TYA, 0, -1, 0 }, { ASMIT_CMP, NPHM(IMMEDIATE) | NPHM(ZERO_PAGE), -1, 0 } }, {}, NPHA_TYPE1_LIVE0, ASMIT_CPY, CPU_REG_Y },
+	{ 2, { { ASMIT_ASL, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_LOAD },
+	{ 2, { { ASMIT_LSR, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_LOAD },
+	{ 2, { { ASMIT_ROL, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_LOAD },
+	{ 2, { { ASMIT_ROR, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_SAME_ADDRESS, 0, 1 } }, NPHA_SHIFT_LOAD },
+
+	{ 3, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_CLC, 0, -1, 0 }, { ASMIT_LDA, 0, -1, 0 } }, {}, NPHA_NOP0 },
+	{ 3, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_SEC, 0, -1, 0 }, { ASMIT_LDA, 0, -1, 0 } }, {}, NPHA_NOP0 },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_INC, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_C } }, { { NPHC_SAME_ADDRESS, 0, 1 }, { NPHC_SAME_ADDRESS, 0, 2 } }, NPHA_STORE_ADD, ASMIT_ADC },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, ~NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, NPHM(ZERO_PAGE), -1, LIVE_MEM, NPHF_COMMUTATIVE } }, { { NPHC_SAME_ADDRESS, 0, 2 }, { NPHC_HAS_MODE, 2, 1 } }, NPHA_COMMUTE },
+	{ 3, { { NPH_ANY, 0, -1, 0, NPHF_CHANGES_ACCU }, { ASMIT_STA, 0, -1, 0 }, { ASMIT_LDA, 0, -1, 0 } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 1, 2 } }, NPHA_NOP2 },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, 0, -1, 0, NPHF_KEEPS_ACCU }, { ASMIT_LDY, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 2 }, { NPHC_OTHER_EFFECTIVE_ADDRESS, 1, 0 } }, NPHA_TYPE2_IMPLIED, ASMIT_TAY },
+	{ 3, { { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, 0, -1, LIVE_CPU_REG_Y, NPHF_KEEPS_ACCU | NPHF_NO_ACCU_REQUIRED }, { ASMIT_TAY, 0, -1, LIVE_CPU_REG_A | LIVE_CPU_REG_Z } }, {}, NPHA_LOAD_REGISTER_EARLY, ASMIT_LDY },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_DEC, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_C } }, { { NPHC_SAME_ADDRESS, 0, 1 }, { NPHC_SAME_ADDRESS, 0, 2 } }, NPHA_STORE_ADD, ASMIT_SBC },
+	{ 3, { { ASMIT_LDA, NPHM(IMMEDIATE), 0x00, 0 }, { ASMIT_CMP, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_ROR, NPHM(IMPLIED), -1, 0 } }, {}, NPHA_CARRY_CLEAR },
+	{ 3, { { NPH_ANY, 0, -1, 0, NPHF_CHANGES_ACCU }, { ASMIT_STA, 0, -1, 0 }, { ASMIT_ORA, NPHM(IMMEDIATE), 0x00, 0 } }, {}, NPHA_NOP2_LIVE_ACCU },
+	{ 3, { { NPH_ANY, 0, -1, 0, NPHF_CHANGES_ACCU }, { ASMIT_STA, 0, -1, 0 }, { ASMIT_CMP, NPHM(IMMEDIATE), 0x00, LIVE_CPU_REG_C } }, {}, NPHA_NOP2_LIVE_ACCU_BOTH },
+	{ 3, { { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, 0, -1, 0, NPHF_SHIFT }, { ASMIT_STA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A } }, { { NPHC_SAME_ADDRESS, 0, 2 } }, NPHA_SHIFT_MEMORY },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, 0, -1, 0, NPHF_NO_ACCU }, { NPH_ANY, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A, NPHF_SHIFT } }, { { NPHC_SAME_ADDRESS, 0, 2 }, { NPHC_NO_ZERO_PAGE_USE, 1, 0 } }, NPHA_SHIFT_STORE_DOWN },
+	{ 3, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(IMMEDIATE), -1, 0 }, { NPH_ANY, NPHM(ZERO_PAGE), -1, 0, NPHF_SHIFT } }, { { NPHC_SAME_ADDRESS, 0, 2 } }, NPHA_SHIFT_STORE_IMMEDIATE },
+	{ 3, { { NPH_ANY, ~NPHM(RELATIVE), -1, 0 }, { ASMIT_DEC, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A } }, { { NPHC_SAME_ADDRESS, 1, 2 } }, NPHA_NOP2_LIVE_Z },
+	{ 3, { { NPH_ANY, ~NPHM(RELATIVE), -1, 0 }, { ASMIT_INC, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A } }, { { NPHC_SAME_ADDRESS, 1, 2 } }, NPHA_NOP2_LIVE_Z },
+	{ 3, { { ASMIT_TAX, 0, -1, 0 }, { NPH_ANY, 0, -1, 0, NPHF_KEEPS_X }, { ASMIT_TXA, 0, -1, LIVE_CPU_REG_Z } }, {}, NPHA_NOP2 },
+	{ 3, { { ASMIT_SEC, 0, -1, 0 }, { ASMIT_LDA, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_SBC, NPHM(IMMEDIATE), -1, 0 } }, {}, NPHA_CONST_SUB },
+	{ 3, { { ASMIT_CLC, 0, -1, 0 }, { ASMIT_LDA, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), -1, 0 } }, {}, NPHA_CONST_ADD },
+	{ 3, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_CLC, 0, -1, 0 }, { ASMIT_ADC, 0, -1, 0 } }, {}, NPHA_CLC_UP },
+	{ 3, { { ASMIT_CLC, 0, -1, 0 }, { ASMIT_TYA, 0, -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), -1, LIVE_CPU_REG_C | LIVE_CPU_REG_Y } }, { { NPHC_AT_MOST, 2, 2 } }, NPHA_INCREMENT_Y },
+	{ 3, { { ASMIT_STA, 0, -1, 0 }, { NPH_ANY, 0, -1, 0, NPHF_KEEPS_ADDRESS | NPHF_KEEPS_GLOBAL | NPHF_KEEPS_X | NPHF_KEEPS_Y }, { ASMIT_STA, 0, -1, 0 } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 2 } }, NPHA_NOP0_IMPLIED },
+	{ 3, { { ASMIT_ASL, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_ASL, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_ASL, NPHM(ZERO_PAGE), -1, LIVE_CPU_REG_A } }, { { NPHC_SAME_ADDRESS, 0, 1 }, { NPHC_SAME_ADDRESS, 0, 2 } }, NPHA_SHIFT_ACCU },
+
+	{ 4, { { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_CLC, 0, -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C | LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 3 } }, NPHA_MEMORY_TYPE3, ASMIT_INC },
+	{ 4, { { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_SEC, 0, -1, 0 }, { ASMIT_SBC, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C | LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 3 } }, NPHA_MEMORY_TYPE3, ASMIT_DEC },
+	{ 4, { { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_SEC, 0, -1, 0 }, { ASMIT_SBC, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 3 } }, NPHA_DEC_LOAD },
+	{ 4, { { ASMIT_CLC, 0, -1, 0 }, { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C | LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 1, 3 } }, NPHA_MEMORY_TYPE3, ASMIT_INC },
+	{ 4, { { ASMIT_SEC, 0, -1, 0 }, { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_SBC, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C | LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 1, 3 } }, NPHA_MEMORY_TYPE3, ASMIT_DEC },
+	{ 4, { { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_CLC, 0, -1, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_C | LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 3 }, { NPHC_LOW_BYTE, 2, 0xff } }, NPHA_MEMORY_TYPE3, ASMIT_DEC },
+	{ 4, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_CMP, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_OTHER_ADDRESS, 2, 1 }, { NPHC_SAME_ADDRESS, 3, 1 } }, NPHA_COMPARE_SOURCE },
+	{ 4, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, 0, -1, 0 }, { ASMIT_LDX, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_STX, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 2, 0 }, { NPHC_NO_ZERO_PAGE_CHANGE, 1, 0 }, { NPHC_NO_ZERO_PAGE_USE, 1, 3 } }, NPHA_STORE_X_UP },
+	{ 4, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDY, NPHM(IMMEDIATE), -1, 0 }, { ASMIT_LDA, NPHM(INDIRECT_Y), -1, 0 }, { ASMIT_EOR, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 3, 0 } }, NPHA_EOR_INDIRECT },
+	{ 4, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_SEC, 0, -1, 0 }, { ASMIT_SBC, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_OTHER_ADDRESS, 0, 1 }, { NPHC_SAME_ADDRESS, 0, 3 } }, NPHA_REVERSE_SUB },
+	{ 4, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_SEC, 0, -1, 0 }, { ASMIT_LDA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_SBC, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_OTHER_ADDRESS, 0, 2 }, { NPHC_SAME_ADDRESS, 0, 3 } }, NPHA_REVERSE_SUB },
+	{ 4, { { ASMIT_LDA, NPHM_STORE, -1, 0 }, { ASMIT_ASL, NPHM(IMPLIED), -1, 0 }, { ASMIT_ORA, NPHM(IMMEDIATE), 1, 0 }, { ASMIT_STA, 0, -1, LIVE_CPU_REG_A } }, { { NPHC_SAME_EFFECTIVE_ADDRESS, 0, 3 } }, NPHA_SET_ROL },
+	{ 4, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, NPHM(IMPLIED), -1, 0, NPHF_SHIFT }, { NPH_ANY, NPHM(ZERO_PAGE), -1, LIVE_MEM, NPHF_COMMUTATIVE } }, { { NPHC_SAME_ADDRESS, 1, 3 } }, NPHA_OPERAND_SOURCE },
+	{ 4, { { ASMIT_LDA, 0, -1, 0 }, { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { NPH_ANY, NPHM(IMPLIED), -1, 0, NPHF_SHIFT }, { ASMIT_SBC, NPHM(ZERO_PAGE), -1, LIVE_MEM } }, { { NPHC_SAME_ADDRESS, 1, 3 } }, NPHA_OPERAND_SOURCE },
+	{ 4, { { ASMIT_LDA, NPHM(IMMEDIATE), 0x00, 0 }, { ASMIT_ADC, NPHM(IMMEDIATE), 0xff, 0 }, { ASMIT_EOR, NPHM(IMMEDIATE), 0xff, 0 }, { ASMIT_LSR, NPHM(IMPLIED), -1, LIVE_CPU_REG_A | LIVE_CPU_REG_Z } }, {}, NPHA_NOP0123 },
+	{ 4, { { ASMIT_STA, NPHM(ZERO_PAGE), -1, 0 }, { ASMIT_CLC, 0, -1, 0 }, { ASMIT_LDA, 0, -1, 0 }, { ASMIT_ADC, NPHM(ZERO_PAGE), -1, 0 } }, { { NPHC_SAME_ADDRESS, 0, 3 } }, NPHA_FLIP_ADD },
+};
+
+#undef NPHM
+
+static const int NumNativePeepHolePatterns = sizeof(NativePeepHolePatterns) / sizeof(NativePeepHolePatterns[0]);
+
+// Decision table selecting the candidate patterns by the instruction types
+// at the start of the window, wildcard patterns are merged into every
+// matching slot in table order, so a single lookup replaces the sequential
+// test of the chain.  Longer patterns are selected by their first two
+// instructions.
+
+struct NativePeepHoleIndex
+{
+	uint16	mSingle[NUM_ASM_INS_TYPES + 1];
+	uint16	mPair[3][NUM_ASM_INS_TYPES * NUM_ASM_INS_TYPES + 1];
+	uint8	mPatterns[NUM_ASM_INS_TYPES * NUM_ASM_INS_TYPES * 4];
+
+	NativePeepHoleIndex(void)
+	{
+		int	n = 0;
+		for (int t = 0; t < NUM_ASM_INS_TYPES; t++)
+		{
+			mSingle[t] = n;
+			for (int k = 0; k < NumNativePeepHolePatterns; k++)
+			{
+				const NativePeepHolePattern& p(NativePeepHolePatterns[k]);
+				if (p.mLength == 1 && (p.mIns[0].mType == t || p.mIns[0].mType == NPH_ANY))
+					mPatterns[n++] = k;
+			}
+		}
+		mSingle[NUM_ASM_INS_TYPES] = n;
+
+		for (int l = 0; l < 3; l++)
+		{
+			for (int t = 0; t < NUM_ASM_INS_TYPES * NUM_ASM_INS_TYPES; t++)
+			{
+				mPair[l][t] = n;
+				for (int k = 0; k < NumNativePeepHolePatterns; k++)
+				{
+					const NativePeepHolePattern& p(NativePeepHolePatterns[k]);
+					if (p.mLength == l + 2 &&
+						(p.mIns[0].mType == t / NUM_ASM_INS_TYPES || p.mIns[0].mType == NPH_ANY) &&
+						(p.mIns[1].mType == t % NUM_ASM_INS_TYPES || p.mIns[1].mType == NPH_ANY))
+					{
+						assert(n < int(sizeof(mPatterns)));
+						mPatterns[n++] = k;
+					}
+				}
+			}
+			mPair[l][NUM_ASM_INS_TYPES * NUM_ASM_INS_TYPES] = n;
+		}
+	}
+};
+
+static bool MatchPeepHoleOperand(const NativePeepHoleOperand& op, const NativeCodeInstruction& ins)
+{
+	if (op.mType != NPH_ANY && ins.mType != op.mType)
+		return false;
+	if (op.mModes && !(op.mModes & (1u << ins.mMode)))
+		return false;
+	if (op.mValue >= 0 && ins.mAddress != op.mValue)
+		return false;
+	if (ins.mLive & op.mDead)
+		return false;
+
+	if (op.mFlags)
+	{
+		if ((op.mFlags & NPHF_CHANGES_ACCU) && !ins.ChangesAccuAndFlag())
+			return false;
+		if ((op.mFlags & NPHF_KEEPS_ACCU) && ins.ChangesAccu())
+			return false;
+		if ((op.mFlags & NPHF_NO_ACCU) && ins.UsesAccu())
+			return false;
+		if ((op.mFlags & NPHF_NO_ACCU_REQUIRED) && ins.RequiresAccu())
+			return false;
+		if ((op.mFlags & NPHF_KEEPS_X) && ins.ChangesXReg())
+			return false;
+		if ((op.mFlags & NPHF_KEEPS_Y) && ins.ChangesYReg())
+			return false;
+		if ((op.mFlags & NPHF_KEEPS_ADDRESS) && ins.ChangesAddress())
+			return false;
+		if ((op.mFlags & NPHF_KEEPS_GLOBAL) && ins.ChangesGlobalMemory())
+			return false;
+		if ((op.mFlags & NPHF_COMMUTATIVE) && !ins.IsCommutative())
+			return false;
+		if ((op.mFlags & NPHF_SHIFT) && !ins.IsShift())
+			return false;
+	}
+
+	return true;
+}
+
+#undef NPH_ANY
+
+static bool MatchPeepHoleTest(const NativePeepHoleTest& test, const NativeCodeInstruction* ins)
+{
+	const NativeCodeInstruction& a(ins[test.mA]), & b(ins[test.mB]);
+
+	switch (test.mCheck)
+	{
+	case NPHC_SAME_ADDRESS:
+		return a.mAddress == b.mAddress;
+	case NPHC_OTHER_ADDRESS:
+		return a.mAddress != b.mAddress;
+	case NPHC_SAME_EFFECTIVE_ADDRESS:
+		return a.SameEffectiveAddress(b);
+	case NPHC_OTHER_EFFECTIVE_ADDRESS:
+		return !a.SameEffectiveAddress(b);
+	case NPHC_NO_ZERO_PAGE_USE:
+		return !a.UsesZeroPage(b.mAddress);
+	case NPHC_NO_ZERO_PAGE_CHANGE:
+		return !a.ChangesZeroPage(b.mAddress);
+	case NPHC_HAS_MODE:
+		return HasAsmInstructionMode(a.mType, b.mMode);
+	case NPHC_LOW_BYTE:
+		return (a.mAddress & 0xff) == test.mB;
+	case NPHC_AT_MOST:
+		return a.mAddress <= test.mB;
+	default:
+		return true;
+	}
+}
+
+bool NativeCodeBasicBlock::ApplyPeepHolePattern(int at, int length)
+{
+	static const NativePeepHoleIndex	index;
+
+	NativeCodeInstruction* ins = &(mIns[at]);
+
+	int	first, last;
+	if (length == 1)
+	{
+		first = index.mSingle[ins[0].mType];
+		last = index.mSingle[ins[0].mType + 1];
+	}
+	else
+	{
+		int	t = ins[0].mType * NUM_ASM_INS_TYPES + ins[1].mType;
+		first = index.mPair[length - 2][t];
+		last = index.mPair[length - 2][t + 1];
+	}
+
+	for (int k = first; k < last; k++)
+	{
+		const NativePeepHolePattern& p(NativePeepHolePatterns[index.mPatterns[k]]);
+
+		int	j = 0;
+		while (j < length && MatchPeepHoleOperand(p.mIns[j], ins[j]))
+			j++;
+		if (j < length)
+			continue;
+
+		j = 0;
+		while (j < 3 && MatchPeepHoleTest(p.mTests[j], ins))
+			j++;
+		if (j < 3)
+			continue;
+
+		switch (p.mAction)
+		{
+		case NPHA_TYPE0:
+			ins[0].mType = p.mNewType;
+			break;
+		case NPHA_NOP0:
+			ins[0].mType = ASMIT_NOP;
+			break;
+		case NPHA_NOP1:
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_NOP1_LIVE_A:
+			ins[1].mLive |= LIVE_CPU_REG_A;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_NOP1_LIVE_Z:
+			ins[0].mLive |= ins[1].mLive & LIVE_CPU_REG_Z;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_AND_IMMEDIATE:
+			ins[0].mAddress &= ins[1].mAddress;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_ORA_IMMEDIATE:
+			ins[0].mAddress |= ins[1].mAddress;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_EOR_IMMEDIATE:
+			ins[0].mAddress ^= ins[1].mAddress;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_NOP0_TYPE1:
+			ins[0].mType = ASMIT_NOP;
+			ins[1].mType = p.mNewType;
+			break;
+		case NPHA_TYPE1:
+			ins[1].mType = p.mNewType;
+			break;
+		case NPHA_TYPE1_IMPLIED:
+			ins[1].mType = p.mNewType;
+			ins[1].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_TYPE1_LIVE0:
+			ins[1].mType = p.mNewType;
+			ins[0].mLive |= p.mLive;
+			break;
+		case NPHA_TRANSFER1:
+			ins[1].mType = p.mNewType;
+			ins[1].mMode = ASMIM_IMPLIED;
+			ins[0].mLive |= LIVE_CPU_REG_A;
+			break;
+		case NPHA_LOAD_REGISTER:
+			ins[0].mType = p.mNewType;
+			ins[0].mLive |= ins[1].mLive;
+			ins[1].mType = ASMIT_NOP;
+			break;
+		case NPHA_SHIFT_STORE:
+			ins[0].mType = ins[1].mType;
+			ins[0].mMode = ASMIM_IMPLIED;
+			ins[0].mLive |= LIVE_CPU_REG_A;
+			ins[1].mType = ASMIT_STA;
+			break;
+		case NPHA_SHIFT_LOAD:
+			ins[1].mType = ins[0].mType;
+			ins[1].mMode = ASMIM_IMPLIED;
+			ins[1].mLive |= LIVE_CPU_REG_A;
+			ins[0].mLive |= LIVE_CPU_REG_A;
+			ins[0].mType = ASMIT_LDA;
+			break;
+		case NPHA_SHIFT_TAY:
+			ins[0].mType = ASMIT_LDA;
+			ins[0].mLive |= LIVE_CPU_REG_A;
+			ins[1].mType = ASMIT_ASL;
+			ins[1].mMode = ASMIM_IMPLIED;
+			mIns.Insert(at + 2, NativeCodeInstruction(ASMIT_TAY, ASMIM_IMPLIED));
+			mIns[at + 2].mLive = mIns[at + 1].mLive;
+			mIns[at + 1].mLive |= LIVE_CPU_REG_A;
+			break;
+
+		case NPHA_NOP0_IMPLIED:
+			ins[0].mType = ASMIT_NOP;
+			ins[0].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_NOP2:
+			ins[2].mType = ASMIT_NOP;
+			break;
+		case NPHA_NOP2_LIVE_Z:
+			ins[2].mType = ASMIT_NOP;
+			ins[1].mLive |= LIVE_CPU_REG_Z;
+			break;
+		case NPHA_NOP2_LIVE_ACCU:
+			ins[2].mType = ASMIT_NOP; ins[2].mMode = ASMIM_IMPLIED;
+			ins[1].mLive |= ins[2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
+			break;
+		case NPHA_NOP2_LIVE_ACCU_BOTH:
+			ins[2].mType = ASMIT_NOP; ins[2].mMode = ASMIM_IMPLIED;
+			ins[0].mLive |= ins[2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
+			ins[1].mLive |= ins[2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
+			break;
+		case NPHA_TYPE2_IMPLIED:
+			ins[2].mType = p.mNewType;
+			ins[2].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_LOAD_REGISTER_EARLY:
+			ins[0].mType = p.mNewType;
+			ins[2].mType = ASMIT_NOP;
+			break;
+		case NPHA_STORE_ADD:
+			ins[0].mType = p.mNewType == ASMIT_ADC ? ASMIT_CLC : ASMIT_SEC; ins[0].mMode = ASMIM_IMPLIED;
+			ins[1].mType = p.mNewType; ins[1].mMode = ASMIM_IMMEDIATE; ins[1].mAddress = 1;
+			ins[2].mType = ASMIT_STA;
+			break;
+		case NPHA_COMMUTE:
+			ins[1].mType = ins[2].mType;
+			ins[0].mType = ASMIT_NOP;
+			ins[2].mType = ASMIT_NOP;
+			break;
+		case NPHA_CARRY_CLEAR:
+			ins[1].mType = ASMIT_NOP; ins[1].mMode = ASMIM_IMPLIED;
+			ins[2].mType = ASMIT_CLC; ins[2].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_SHIFT_MEMORY:
+			ins[2].mType = ins[1].mType;
+			ins[0].mType = ASMIT_NOP; ins[0].mMode = ASMIM_IMPLIED;
+			ins[1].mType = ASMIT_NOP; ins[1].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_SHIFT_STORE_DOWN:
+			ins[0] = ins[1];
+			ins[1] = ins[2];
+			ins[1].mMode = ASMIM_IMPLIED;
+			ins[1].mLive |= LIVE_CPU_REG_A;
+			ins[2].mType = ASMIT_STA;
+			ins[2].mLive |= ins[1].mLive & LIVE_CPU_REG_C;
+			break;
+		case NPHA_SHIFT_STORE_IMMEDIATE:
+			ins[0] = ins[2];
+			ins[2] = ins[1];
+			ins[1] = ins[0];
+			ins[0].mMode = ASMIM_IMPLIED;
+			ins[0].mLive |= LIVE_CPU_REG_A;
+			ins[1].mType = ASMIT_STA;
+			ins[2].mLive |= ins[1].mLive & LIVE_CPU_REG_C;
+			break;
+		case NPHA_CONST_SUB:
+		{
+			int	t = (ins[2].mAddress ^ 0xff) + ins[1].mAddress + 1;
+
+			ins[1].mType = ASMIT_NOP; ins[1].mMode = ASMIM_IMPLIED;
+			ins[2].mType = ASMIT_LDA; ins[2].mAddress = t & 0xff;
+			if (t < 256)
+				ins[0].mType = ASMIT_CLC;
+		}	break;
+		case NPHA_CONST_ADD:
+		{
+			int	t = ins[2].mAddress + ins[1].mAddress;
+
+			ins[1].mType = ASMIT_NOP; ins[1].mMode = ASMIM_IMPLIED;
+			ins[2].mType = ASMIT_LDA; ins[2].mAddress = t & 0xff;
+			if (t >= 256)
+				ins[0].mType = ASMIT_SEC;
+		}	break;
+		case NPHA_CLC_UP:
+			ins[1] = ins[0];
+			ins[0].mType = ASMIT_CLC;
+			ins[0].mMode = ASMIM_IMPLIED;
+			ins[0].mLive |= LIVE_CPU_REG_C;
+			ins[1].mLive |= LIVE_CPU_REG_C;
+			break;
+		case NPHA_INCREMENT_Y:
+			ins[0].mType = ASMIT_INY;
+			if (ins[2].mAddress > 1)
+				ins[1].mType = ASMIT_INY;
+			else
+				ins[1].mType = ASMIT_NOP;
+			ins[1].mLive |= LIVE_CPU_REG_Y;
+			ins[2].mType = ASMIT_TYA; ins[2].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_SHIFT_ACCU:
+		{
+			int addr = ins[0].mAddress;
+
+			mIns.Insert(at, NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, addr));
+			mIns.Insert(at + 4, NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, addr));
+
+			ins = &(mIns[at]);
+			ins[0].mLive = ins[1].mLive | LIVE_CPU_REG_A;
+			ins[1].mMode = ASMIM_IMPLIED;
+			ins[1].mLive |= LIVE_CPU_REG_A;
+			ins[2].mMode = ASMIM_IMPLIED;
+			ins[2].mLive |= LIVE_CPU_REG_A;
+			ins[3].mMode = ASMIM_IMPLIED;
+			ins[3].mLive |= LIVE_CPU_REG_A;
+			ins[4].mLive = ins[3].mLive;
+		}	break;
+
+		case NPHA_MEMORY_TYPE3:
+			ins[0].mType = ASMIT_NOP;
+			ins[1].mType = ASMIT_NOP;
+			ins[2].mType = ASMIT_NOP;
+			ins[3].mType = p.mNewType;
+			break;
+		case NPHA_DEC_LOAD:
+			ins[0].mType = ASMIT_DEC;
+			ins[1].mType = ASMIT_NOP;
+			ins[2].mType = ASMIT_NOP;
+			ins[3].mType = ASMIT_LDA;
+			break;
+		case NPHA_COMPARE_SOURCE:
+			ins[3].mMode = ins[0].mMode;
+			ins[3].mAddress = ins[0].mAddress;
+			ins[3].mLinkerObject = ins[0].mLinkerObject;
+			break;
+		case NPHA_STORE_X_UP:
+			mIns.Insert(at + 1, NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, ins[3].mAddress));
+
+			ins = &(mIns[at]);
+			ins[4].mType = ASMIT_NOP;
+			ins[4].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_EOR_INDIRECT:
+			ins[2].mType = ins[3].mType;
+			ins[3].mType = ASMIT_NOP;
+			ins[3].mMode = ASMIM_IMPLIED;
+			break;
+		case NPHA_REVERSE_SUB:
+		{
+			int	l = ins[1].mType == ASMIT_LDA ? 1 : 2;
+
+			ins[0].mType = ASMIT_EOR;
+			ins[0].mMode = ASMIM_IMMEDIATE;
+			ins[0].mAddress = 0xff;
+
+			ins[3].mType = ASMIT_ADC;
+			ins[3].mAddress = ins[l].mAddress;
+
+			ins[l].mType = ASMIT_NOP;
+			ins[l].mMode = ASMIM_IMPLIED;
+		}	break;
+		case NPHA_SET_ROL:
+			ins[0].mType = ASMIT_NOP;
+			ins[1].mType = ASMIT_NOP;
+			ins[2].mType = ASMIT_SEC;
+			ins[2].mMode = ASMIM_IMPLIED;
+			ins[2].mLive |= LIVE_CPU_REG_C;
+			ins[3].mType = ASMIT_ROL;
+			break;
+		case NPHA_OPERAND_SOURCE:
+			ins[1].mType = ASMIT_NOP;
+			ins[3].mMode = ins[0].mMode;
+			ins[3].mAddress = ins[0].mAddress;
+			ins[3].mLinkerObject = ins[0].mLinkerObject;
+			ins[3].mFlags = ins[0].mFlags;
+			break;
+		case NPHA_NOP0123:
+			ins[0].mType = ASMIT_NOP;
+			ins[1].mType = ASMIT_NOP;
+			ins[2].mType = ASMIT_NOP;
+			ins[3].mType = ASMIT_NOP;
+			break;
+		case NPHA_FLIP_ADD:
+			// Flip arguments of ADC if second parameter in accu at entry
+
+			ins[3] = ins[2];
+			ins[3].mType = ASMIT_ADC;
+			ins[2].mMode = ASMIM_ZERO_PAGE;
+			ins[2].mAddress = ins[0].mAddress;
+			break;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 {
 	if (!mVisited)
@@ -9718,42 +10410,8 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 			for (int i = 0; i < mIns.Size(); i++)
 			{
 #if 1
-#if 1
-				if (mIns[i].mType == ASMIT_AND && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i].mAddress == 0)
-				{
-					mIns[i].mType = ASMIT_LDA;
-					progress = true;
-				}
-				else if (mIns[i].mType == ASMIT_AND && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i].mAddress == 0xff && (mIns[i].mLive & LIVE_CPU_REG_Z) == 0)
-				{
-					mIns[i].mType = ASMIT_NOP;
-					progress = true;
-				}
-				else if (mIns[i].mType == ASMIT_ORA && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i].mAddress == 0xff)
-				{
-					mIns[i].mType = ASMIT_LDA;
-					progress = true;
-				}
-				else if (mIns[i].mType == ASMIT_ORA && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i].mAddress == 0x00 && (mIns[i].mLive & LIVE_CPU_REG_Z) == 0)
-				{
-					mIns[i].mType = ASMIT_NOP;
-					progress = true;
-				}
-#endif
-#if 1
-				else if (mIns[i].mType == ASMIT_ROR && mIns[i].mMode == ASMIM_IMPLIED && (mIns[i].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)) == 0)
-				{
-					mIns[i].mType = ASMIT_LSR;
-					progress = true;
-				}
-#endif
-#if 1
-				else if (mIns[i].mType == ASMIT_ROL && mIns[i].mMode == ASMIM_IMPLIED && (mIns[i].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)) == 0)
-				{
-					mIns[i].mType = ASMIT_ASL;
+				if (ApplyPeepHolePattern(i, 1))
 					progress = true;
-				}
-#endif
 #if 1
 				int	apos;
 				if (mIns[i].mMode == ASMIM_INDIRECT_Y && FindGlobalAddress(i, mIns[i].mAddress, apos))
@@ -9824,261 +10482,12 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 #if 1
 				if (i + 1 < mIns.Size())
 				{
-					if (mIns[i].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_LDA)
-					{
-						mIns[i].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_STA && mIns[i].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i].mAddress == mIns[i + 1].mAddress)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
+					if (ApplyPeepHolePattern(i, 2))
 						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_STA && mIns[i + 1].mType == ASMIT_LDA && mIns[i].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i].mAddress == mIns[i + 1].mAddress && (mIns[i + 1].mLive & LIVE_CPU_REG_Z) == 0)
-					{
-						mIns[i + 1].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_AND && mIns[i + 1].mType == ASMIT_AND && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mMode == ASMIM_IMMEDIATE)
-					{
-						mIns[i].mAddress &= mIns[i + 1].mAddress;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_ORA && mIns[i + 1].mType == ASMIT_ORA && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mMode == ASMIM_IMMEDIATE)
-					{
-						mIns[i].mAddress |= mIns[i + 1].mAddress;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_EOR && mIns[i + 1].mType == ASMIT_EOR && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mMode == ASMIM_IMMEDIATE)
-					{
-						mIns[i].mAddress ^= mIns[i + 1].mAddress;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_ORA && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_EOR && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_AND && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0xff)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_CLC && mIns[i + 1].mType == ASMIT_ROR)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_LSR;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_LDA && mIns[i].mMode == ASMIM_IMMEDIATE && mIns[i].mAddress == 0 && mIns[i + 1].mType == ASMIT_LSR && mIns[i + 1].mMode == ASMIM_IMPLIED)
-					{
-						mIns[i + 1].mType = ASMIT_CLC;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_CLC && mIns[i + 1].mType == ASMIT_ADC && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0 && !(mIns[i + 1].mLive & LIVE_CPU_REG_Z))
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i].mType == ASMIT_SEC && mIns[i + 1].mType == ASMIT_SBC && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0 && !(mIns[i + 1].mLive & LIVE_CPU_REG_Z))
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_LDA && mIns[i + 1].mType == ASMIT_ADC && mIns[i + 1].SameEffectiveAddress(mIns[i + 0]))
-					{
-						mIns[i + 1].mType = ASMIT_ROL;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						progress = true;
-					}
-					else if (mIns[i + 1].mType == ASMIT_ORA && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0 && mIns[i].ChangesAccuAndFlag())
-					{
-						mIns[i + 0].mLive |= (mIns[i + 1].mLive & LIVE_CPU_REG_Z);
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i + 1].mType == ASMIT_CMP && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0 && mIns[i].ChangesAccuAndFlag() && !(mIns[i + 1].mLive & LIVE_CPU_REG_C))
-					{
-						mIns[i + 0].mLive |= (mIns[i + 1].mLive & LIVE_CPU_REG_Z);
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i].mAddress == mIns[i + 1].mAddress &&
-						(mIns[i + 1].mType == ASMIT_LSR || mIns[i + 1].mType == ASMIT_ASL || mIns[i + 1].mType == ASMIT_ROL || mIns[i + 1].mType == ASMIT_ROR) && !(mIns[i + 0].mLive & LIVE_CPU_REG_A))
-					{
-						mIns[i + 0].mType = mIns[i + 1].mType;
-						mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 1].mType = ASMIT_STA;
-						progress = true;
-					}
 #if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_ASL && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDY && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 1].mAddress && !(mIns[i + 1].mLive & (LIVE_MEM | LIVE_CPU_REG_A)))
-					{
-						mIns[i + 0].mType = ASMIT_LDA;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 1].mType = ASMIT_ASL;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns.Insert(i + 2, NativeCodeInstruction(ASMIT_TAY, ASMIM_IMPLIED));
-						mIns[i + 2].mLive = mIns[i + 1].mLive;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_A;
-						progress = true;
-					}
-#endif
-					else if (
-						mIns[i + 0].mType == ASMIT_STA &&
-						mIns[i + 1].mType == ASMIT_LDY && mIns[i + 0].SameEffectiveAddress(mIns[i + 1]))
-					{
-						mIns[i + 1].mType = ASMIT_TAY;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA &&
-						mIns[i + 1].mType == ASMIT_LDX && mIns[i + 0].SameEffectiveAddress(mIns[i + 1]))
+					else if (mIns[i + 0].mType == ASMIT_LDY && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mMode == ASMIM_INDIRECT_Y)
 					{
-						mIns[i + 1].mType = ASMIT_TAX;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						progress = true;
-					}
-
-					else if (
-						mIns[i + 0].mType == ASMIT_TXA &&
-						mIns[i + 1].mType == ASMIT_STA && (mIns[i + 1].mMode == ASMIM_ZERO_PAGE || mIns[i + 1].mMode == ASMIM_ABSOLUTE))
-					{
-						mIns[i + 1].mType = ASMIT_STX;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TYA &&
-						mIns[i + 1].mType == ASMIT_STA && (mIns[i + 1].mMode == ASMIM_ZERO_PAGE || mIns[i + 1].mMode == ASMIM_ABSOLUTE))
-					{
-						mIns[i + 1].mType = ASMIT_STY;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TAX &&
-						mIns[i + 1].mType == ASMIT_STX && (mIns[i + 1].mMode == ASMIM_ZERO_PAGE || mIns[i + 1].mMode == ASMIM_ABSOLUTE))
-					{
-						mIns[i + 1].mType = ASMIT_STA;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TAY &&
-						mIns[i + 1].mType == ASMIT_STY && (mIns[i + 1].mMode == ASMIM_ZERO_PAGE || mIns[i + 1].mMode == ASMIM_ABSOLUTE))
-					{
-						mIns[i + 1].mType = ASMIT_STA;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TXA &&
-						mIns[i + 1].mType == ASMIT_TAX)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TYA &&
-						mIns[i + 1].mType == ASMIT_TAY)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TAX &&
-						mIns[i + 1].mType == ASMIT_TXA)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TAY &&
-						mIns[i + 1].mType == ASMIT_TYA)
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && (mIns[i + 0].mMode == ASMIM_IMMEDIATE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE || mIns[i + 0].mMode == ASMIM_ABSOLUTE) &&
-						mIns[i + 1].mType == ASMIT_TAY && !(mIns[i + 1].mLive & LIVE_CPU_REG_A))
-					{
-						mIns[i + 0].mType = ASMIT_LDY; mIns[i + 0].mLive |= mIns[i + 1].mLive;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && (mIns[i + 0].mMode == ASMIM_IMMEDIATE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE || mIns[i + 0].mMode == ASMIM_ABSOLUTE) &&
-						mIns[i + 1].mType == ASMIT_TAX && !(mIns[i + 1].mLive & LIVE_CPU_REG_A))
-					{
-						mIns[i + 0].mType = ASMIT_LDX; mIns[i + 0].mLive |= mIns[i + 1].mLive;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDY && (mIns[i + 0].mMode == ASMIM_IMMEDIATE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE || mIns[i + 0].mMode == ASMIM_ABSOLUTE) &&
-						mIns[i + 1].mType == ASMIT_TYA && !(mIns[i + 1].mLive & LIVE_CPU_REG_Y))
-					{
-						mIns[i + 0].mType = ASMIT_LDA; mIns[i + 0].mLive |= mIns[i + 1].mLive;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDX && (mIns[i + 0].mMode == ASMIM_IMMEDIATE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE || mIns[i + 0].mMode == ASMIM_ABSOLUTE) &&
-						mIns[i + 1].mType == ASMIT_TXA && !(mIns[i + 1].mLive & LIVE_CPU_REG_X))
-					{
-						mIns[i + 0].mType = ASMIT_LDA; mIns[i + 0].mLive |= mIns[i + 1].mLive;
-						mIns[i + 1].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TXA &&
-						mIns[i + 1].mType == ASMIT_CMP && (mIns[i + 1].mMode == ASMIM_IMMEDIATE || mIns[i + 1].mMode == ASMIM_ZERO_PAGE))
-					{
-						mIns[i + 1].mType = ASMIT_CPX;
-						mIns[i + 0].mLive |= CPU_REG_X;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_TYA &&
-						mIns[i + 1].mType == ASMIT_CMP && (mIns[i + 1].mMode == ASMIM_IMMEDIATE || mIns[i + 1].mMode == ASMIM_ZERO_PAGE))
-					{
-						mIns[i + 1].mType = ASMIT_CPY;
-						mIns[i + 0].mLive |= CPU_REG_Y;
-						progress = true;
-					}
-
-#if 1
-					else if (
-						(mIns[i + 0].mType == ASMIT_ASL || mIns[i + 0].mType == ASMIT_LSR || mIns[i + 0].mType == ASMIT_ROL || mIns[i + 0].mType == ASMIT_ROR) && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mAddress == mIns[i + 0].mAddress && !(mIns[i + 1].mLive & LIVE_MEM))
-					{
-						mIns[i + 1].mType = mIns[i + 0].mType;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 0].mType = ASMIT_LDA;
-						progress = true;
-					}
-#endif
-
-#if 1
-					else if (mIns[i + 0].mType == ASMIT_LDY && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mMode == ASMIM_INDIRECT_Y)
-					{
-						const NativeCodeInstruction* ains, *iins;
+						const NativeCodeInstruction* ains, *iins;
 
 						int sreg = mIns[i + 1].mAddress;
 						int	apos;
@@ -10146,243 +10555,9 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 #if 1
 				if (i + 2 < mIns.Size())
 				{
-					if (mIns[i].mType == ASMIT_LDA && mIns[i + 2].mType == ASMIT_LDA && (mIns[i + 1].mType == ASMIT_CLC || mIns[i + 1].mType == ASMIT_SEC))
-					{
-						mIns[i].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 2].mAddress &&
-						mIns[i + 1].mType == ASMIT_INC && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 1].mAddress && (mIns[i + 2].mLive & LIVE_CPU_REG_C) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_CLC;
-						mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mType = ASMIT_ADC;
-						mIns[i + 1].mMode = ASMIM_IMMEDIATE;
-						mIns[i + 1].mAddress = 1;
-						mIns[i + 2].mType = ASMIT_STA;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode != ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 2].mAddress &&
-						mIns[i + 2].IsCommutative() && HasAsmInstructionMode(mIns[i + 2].mType, mIns[i + 1].mMode) &&
-						(mIns[i + 2].mLive & LIVE_MEM) == 0)
-					{
-						mIns[i + 1].mType = mIns[i + 2].mType;
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].ChangesAccuAndFlag() &&
-						mIns[i + 1].mType == ASMIT_STA && mIns[i + 2].mType == ASMIT_LDA &&
-						mIns[i + 1].SameEffectiveAddress(mIns[i + 2]))
-					{
-						mIns[i + 2].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_LDY && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress &&
-						!mIns[i + 1].SameEffectiveAddress(mIns[i + 0]) && !mIns[i + 1].ChangesAccu())
-					{
-						mIns[i + 2].mType = ASMIT_TAY;
-						mIns[i + 2].mMode = ASMIM_IMPLIED;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_TAY && !(mIns[i + 2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)) &&
-						!mIns[i + 1].ChangesAccu() && !mIns[i + 1].RequiresAccu() && !(mIns[i + 1].mLive & LIVE_CPU_REG_Y))
-					{
-						mIns[i + 0].mType = ASMIT_LDY;
-						mIns[i + 2].mType = ASMIT_NOP;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress &&
-						mIns[i + 1].mType == ASMIT_DEC && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mAddress == mIns[i + 0].mAddress &&
-						!(mIns[i + 2].mLive & LIVE_CPU_REG_C))
-					{
-						mIns[i + 0].mType = ASMIT_SEC; mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mType = ASMIT_SBC; mIns[i + 1].mMode = ASMIM_IMMEDIATE; mIns[i + 1].mAddress = 1;
-						mIns[i + 2].mType = ASMIT_STA;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 0].mAddress == 0 &&
-						mIns[i + 1].mType == ASMIT_CMP && mIns[i + 1].mMode == ASMIM_IMMEDIATE &&
-						mIns[i + 2].mType == ASMIT_ROR && mIns[i + 2].mMode == ASMIM_IMPLIED)
-					{
-						mIns[i + 1].mType = ASMIT_NOP; mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 2].mType = ASMIT_CLC; mIns[i + 2].mMode = ASMIM_IMPLIED;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].ChangesAccuAndFlag() &&
-						mIns[i + 1].mType == ASMIT_STA && 
-						mIns[i + 2].mType == ASMIT_ORA && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 0)
-					{
-						mIns[i + 2].mType = ASMIT_NOP; mIns[i + 2].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mLive |= mIns[i + 2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].ChangesAccuAndFlag() &&
-						mIns[i + 1].mType == ASMIT_STA &&
-						mIns[i + 2].mType == ASMIT_CMP && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 0 && !(mIns[i + 2].mLive & LIVE_CPU_REG_C))
-					{
-						mIns[i + 2].mType = ASMIT_NOP; mIns[i + 2].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= mIns[i + 2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
-						mIns[i + 1].mLive |= mIns[i + 2].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z);
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						(mIns[i + 1].mType == ASMIT_ASL || mIns[i + 1].mType == ASMIT_LSR || mIns[i + 1].mType == ASMIT_ROL || mIns[i + 1].mType == ASMIT_ROR) &&
-						mIns[i + 2].mType == ASMIT_STA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress && !(mIns[i + 2].mLive & LIVE_CPU_REG_A))
-					{
-						mIns[i + 2].mType = mIns[i + 1].mType;
-						mIns[i + 0].mType = ASMIT_NOP; mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mType = ASMIT_NOP; mIns[i + 1].mMode = ASMIM_IMPLIED;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						!mIns[i + 1].UsesZeroPage(mIns[i + 0].mAddress) && !mIns[i + 1].UsesAccu() &&
-						mIns[i + 2].IsShift() && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress && !(mIns[i + 2].mLive & LIVE_CPU_REG_A))
-					{
-						mIns[i + 0] = mIns[i + 1];
-						mIns[i + 1] = mIns[i + 2];
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 2].mType = ASMIT_STA;
-						mIns[i + 2].mLive |= mIns[i + 1].mLive & LIVE_CPU_REG_C;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_IMMEDIATE &&
-						mIns[i + 2].IsShift() && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress)
-					{
-						mIns[i + 0] = mIns[i + 2];
-						mIns[i + 2] = mIns[i + 1];
-						mIns[i + 1] = mIns[i + 0];
-						mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 1].mType = ASMIT_STA;
-						mIns[i + 2].mLive |= mIns[i + 1].mLive & LIVE_CPU_REG_C;
-						progress = true;
-					}
-#if 1
-					else if (
-						mIns[i + 0].mMode != ASMIM_RELATIVE &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && !(mIns[i + 2].mLive & LIVE_CPU_REG_A) &&
-						mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mAddress == mIns[i + 1].mAddress &&
-						(mIns[i + 1].mType == ASMIT_DEC || mIns[i + 1].mType == ASMIT_INC))
-					{
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_Z;
-						progress = true;
-					}
-#endif
-					else if (
-						mIns[i + 0].mType == ASMIT_TAX &&
-						!mIns[i + 1].ChangesXReg() &&
-						mIns[i + 2].mType == ASMIT_TXA && !(mIns[i + 2].mLive & LIVE_CPU_REG_Z))
-					{
-						mIns[i + 2].mType = ASMIT_NOP;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_SEC && 
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_IMMEDIATE &&
-						mIns[i + 2].mType == ASMIT_SBC && mIns[i + 2].mMode == ASMIM_IMMEDIATE)
-					{
-						int	t = (mIns[i + 2].mAddress ^ 0xff) + mIns[i + 1].mAddress + 1;
-
-						mIns[i + 1].mType = ASMIT_NOP; mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 2].mType = ASMIT_LDA; mIns[i + 2].mAddress = t & 0xff;
-						if (t < 256)
-							mIns[i + 0].mType = ASMIT_CLC;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_CLC && 
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_IMMEDIATE &&
-						mIns[i + 2].mType == ASMIT_ADC && mIns[i + 2].mMode == ASMIM_IMMEDIATE)
-					{
-						int	t = mIns[i + 2].mAddress + mIns[i + 1].mAddress;
-
-						mIns[i + 1].mType = ASMIT_NOP; mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 2].mType = ASMIT_LDA; mIns[i + 2].mAddress = t & 0xff;
-						if (t >= 256)
-							mIns[i + 0].mType = ASMIT_SEC;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA &&
-						mIns[i + 1].mType == ASMIT_CLC &&
-						mIns[i + 2].mType == ASMIT_ADC)
-					{
-						mIns[i + 1] = mIns[i + 0];
-						mIns[i + 0].mType = ASMIT_CLC;
-						mIns[i + 0].mMode = ASMIM_IMPLIED;
-						mIns[i + 0].mLive |= LIVE_CPU_REG_C;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_C;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_CLC && 
-						mIns[i + 1].mType == ASMIT_TYA &&
-						mIns[i + 2].mType == ASMIT_ADC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress <= 2 && !(mIns[i + 2].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_Y)))
-					{
-						int t = mIns[i + 2].mAddress;
-						mIns[i + 0].mType = ASMIT_INY;
-						if (t > 1)
-							mIns[i + 1].mType = ASMIT_INY;
-						else
-							mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_Y;
-						mIns[i + 2].mType = ASMIT_TYA; mIns[i + 2].mMode = ASMIM_IMPLIED;
+					if (ApplyPeepHolePattern(i, 3))
 						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA &&
-						mIns[i + 2].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 2]) &&
-						!mIns[i + 1].ChangesAddress() && !mIns[i + 1].ChangesGlobalMemory() && 
-						!mIns[i + 1].ChangesYReg() && !mIns[i + 1].ChangesXReg())
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 0].mMode = ASMIM_IMPLIED;
-						progress = true;
-					}
 
-#if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_ASL && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_ASL && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mAddress == mIns[i + 0].mAddress &&
-						mIns[i + 2].mType == ASMIT_ASL && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress &&
-						!(mIns[i + 2].mLive & LIVE_CPU_REG_A))
-					{
-						int addr = mIns[i + 0].mAddress;
-
-						mIns.Insert(i, NativeCodeInstruction(ASMIT_LDA, ASMIM_ZERO_PAGE, addr));
-						mIns.Insert(i + 4, NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, addr));
-
-						mIns[i + 0].mLive = mIns[i + 1].mLive | LIVE_CPU_REG_A;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-						mIns[i + 1].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 2].mMode = ASMIM_IMPLIED;
-						mIns[i + 2].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 3].mMode = ASMIM_IMPLIED;
-						mIns[i + 3].mLive |= LIVE_CPU_REG_A;
-						mIns[i + 4].mLive = mIns[i + 3].mLive;
-
-						progress = true;
-					}
-#endif
 #if 1
 					if (
 						mIns[i + 0].mType == ASMIT_LDY && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 0].mAddress == 0 &&
@@ -10425,196 +10600,8 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 
 				if (i + 3 < mIns.Size())
 				{
-					if (mIns[i + 0].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 1].mType == ASMIT_CLC && mIns[i + 2].mType == ASMIT_ADC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 &&
-						(mIns[i + 0].mMode == ASMIM_ABSOLUTE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_A)) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_INC;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 1].mType == ASMIT_SEC && mIns[i + 2].mType == ASMIT_SBC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 &&
-						(mIns[i + 0].mMode == ASMIM_ABSOLUTE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_A)) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_DEC;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 1].mType == ASMIT_SEC && mIns[i + 2].mType == ASMIT_SBC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 &&
-						(mIns[i + 0].mMode == ASMIM_ABSOLUTE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & LIVE_CPU_REG_C) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_DEC;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_LDA;
+					if (ApplyPeepHolePattern(i, 4))
 						progress = true;
-					}
-					else if (mIns[i + 1].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 1].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 0].mType == ASMIT_CLC && mIns[i + 2].mType == ASMIT_ADC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 &&
-						(mIns[i + 1].mMode == ASMIM_ABSOLUTE || mIns[i + 1].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_A)) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_INC;
-						progress = true;
-					}
-					else if (mIns[i + 1].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 1].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 0].mType == ASMIT_SEC && mIns[i + 2].mType == ASMIT_SBC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 &&
-						(mIns[i + 1].mMode == ASMIM_ABSOLUTE || mIns[i + 1].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_A)) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_DEC;
-						progress = true;
-					}
-					else if (mIns[i + 0].mType == ASMIT_LDA && mIns[i + 3].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 3]) &&
-						mIns[i + 1].mType == ASMIT_CLC && mIns[i + 2].mType == ASMIT_ADC && mIns[i + 2].mMode == ASMIM_IMMEDIATE && (mIns[i + 2].mAddress & 0xff) == 0xff &&
-						(mIns[i + 0].mMode == ASMIM_ABSOLUTE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE) &&
-						(mIns[i + 3].mLive & (LIVE_CPU_REG_C | LIVE_CPU_REG_A)) == 0)
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_DEC;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA &&
-						mIns[i + 1].mType == ASMIT_STA && mIns[i + 1].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress != mIns[i + 1].mAddress &&
-						mIns[i + 3].mType == ASMIT_CMP && mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 3].mAddress == mIns[i + 1].mAddress && !(mIns[i + 3].mLive & LIVE_MEM))
-					{
-						mIns[i + 3].mMode = mIns[i + 0].mMode;
-						mIns[i + 3].mAddress = mIns[i + 0].mAddress;
-						mIns[i + 3].mLinkerObject = mIns[i + 0].mLinkerObject;
-
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 2].mType == ASMIT_LDX && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress == mIns[i + 0].mAddress &&
-						mIns[i + 3].mType == ASMIT_STX && mIns[i + 3].mMode == ASMIM_ZERO_PAGE &&
-						!mIns[i + 1].ChangesZeroPage(mIns[i + 0].mAddress) && !mIns[i + 1].UsesZeroPage(mIns[i + 3].mAddress))
-					{
-						mIns.Insert(i + 1, NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, mIns[i + 3].mAddress));
-
-						mIns[i + 4].mType = ASMIT_NOP;
-						mIns[i + 4].mMode = ASMIM_IMPLIED;
-
-						progress = true;
-					}
-#if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDY && mIns[i + 1].mMode == ASMIM_IMMEDIATE &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_INDIRECT_Y &&
-						mIns[i + 3].mType == ASMIT_EOR && mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 3].mAddress == mIns[i + 0].mAddress)
-					{
-						mIns[i + 2].mType = mIns[i + 3].mType;
-						mIns[i + 3].mType = ASMIT_NOP;
-						mIns[i + 3].mMode = ASMIM_IMPLIED;
-
-						progress = true;
-					}
-#endif
-#if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress != mIns[i + 1].mAddress &&
-						mIns[i + 2].mType == ASMIT_SEC &&
-						mIns[i + 3].mType == ASMIT_SBC && mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 3].mAddress && !(mIns[i + 3].mLive & LIVE_MEM))
-					{
-						mIns[i + 0].mType = ASMIT_EOR;
-						mIns[i + 0].mMode = ASMIM_IMMEDIATE;
-						mIns[i + 0].mAddress = 0xff;
-
-						mIns[i + 3].mType = ASMIT_ADC;
-						mIns[i + 3].mAddress = mIns[i + 1].mAddress;
-
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 1].mMode = ASMIM_IMPLIED;
-
-						progress = true;
-					}
-#endif
-#if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 1].mType == ASMIT_SEC &&
-						mIns[i + 2].mType == ASMIT_LDA && mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress != mIns[i + 2].mAddress &&
-						mIns[i + 3].mType == ASMIT_SBC && mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 3].mAddress && !(mIns[i + 3].mLive & LIVE_MEM))
-					{
-						mIns[i + 0].mType = ASMIT_EOR;
-						mIns[i + 0].mMode = ASMIM_IMMEDIATE;
-						mIns[i + 0].mAddress = 0xff;
-
-						mIns[i + 3].mType = ASMIT_ADC;
-						mIns[i + 3].mAddress = mIns[i + 2].mAddress;
-
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 2].mMode = ASMIM_IMPLIED;
-
-						progress = true;
-					}
-#endif
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA &&
-						mIns[i + 3].mType == ASMIT_STA && mIns[i + 0].SameEffectiveAddress(mIns[i + 3]) &&
-						(mIns[i + 0].mMode == ASMIM_ABSOLUTE || mIns[i + 0].mMode == ASMIM_ZERO_PAGE) &&
-						mIns[i + 1].mType == ASMIT_ASL && mIns[i + 1].mMode == ASMIM_IMPLIED &&
-						mIns[i + 2].mType == ASMIT_ORA && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 1 && !(mIns[i + 3].mLive & LIVE_CPU_REG_A))
-
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_SEC;
-						mIns[i + 2].mMode = ASMIM_IMPLIED;
-						mIns[i + 2].mLive |= LIVE_CPU_REG_C;
-						mIns[i + 3].mType = ASMIT_ROL;
-						progress = true;
-					}
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && 
-						mIns[i + 1].mType == ASMIT_STA && mIns[i + 1].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 1].mAddress && mIns[i + 3].mAddress &&
-						mIns[i + 2].mMode == ASMIM_IMPLIED && !(mIns[i + 3].mLive & LIVE_MEM) &&
-						(mIns[i + 2].mType == ASMIT_ASL || mIns[i + 2].mType == ASMIT_LSR || mIns[i + 2].mType == ASMIT_ROL || mIns[i + 2].mType == ASMIT_ROR) &&
-						(mIns[i + 3].mType == ASMIT_ORA || mIns[i + 3].mType == ASMIT_AND || mIns[i + 3].mType == ASMIT_EOR || mIns[i + 3].mType == ASMIT_ADC || mIns[i + 3].mType == ASMIT_SBC))
-					{
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 3].mMode = mIns[i + 0].mMode;
-						mIns[i + 3].mAddress= mIns[i + 0].mAddress;
-						mIns[i + 3].mLinkerObject = mIns[i + 0].mLinkerObject;
-						mIns[i + 3].mFlags = mIns[i + 0].mFlags;
-						progress = true;
-					}
-#if 1
-					else if (
-						mIns[i + 0].mType == ASMIT_LDA && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 0].mAddress == 0 &&
-						mIns[i + 1].mType == ASMIT_ADC && mIns[i + 1].mMode == ASMIM_IMMEDIATE && mIns[i + 1].mAddress == 0xff &&
-						mIns[i + 2].mType == ASMIT_EOR && mIns[i + 2].mMode == ASMIM_IMMEDIATE && mIns[i + 2].mAddress == 0xff &&
-						mIns[i + 3].mType == ASMIT_LSR && mIns[i + 3].mMode == ASMIM_IMPLIED && !(mIns[i + 3].mLive & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)))
-					{
-						mIns[i + 0].mType = ASMIT_NOP;
-						mIns[i + 1].mType = ASMIT_NOP;
-						mIns[i + 2].mType = ASMIT_NOP;
-						mIns[i + 3].mType = ASMIT_NOP;
-						progress = true;
-					}
-#endif
 
 #if 1
 					if (
@@ -10653,20 +10640,8 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 
 				if (i + 4 < mIns.Size())
 				{
-					if (mIns[i + 0].mType == ASMIT_STA && mIns[i + 0].mMode == ASMIM_ZERO_PAGE &&
-						mIns[i + 3].mType == ASMIT_ADC && mIns[i + 3].mMode == ASMIM_ZERO_PAGE && mIns[i + 0].mAddress == mIns[i + 3].mAddress &&
-						mIns[i + 1].mType == ASMIT_CLC && mIns[i + 2].mType == ASMIT_LDA)
-					{
-						// Flip arguments of ADC if second parameter in accu at entry
-
-						mIns[i + 3] = mIns[i + 2];
-						mIns[i + 3].mType = ASMIT_ADC;
-						mIns[i + 2].mMode = ASMIM_ZERO_PAGE;
-						mIns[i + 2].mAddress = mIns[i + 0].mAddress;
-						progress = true;
-					}
 #if 1
-					else if (
+					if (
 						mIns[i + 0].mType == ASMIT_LDY && mIns[i + 0].mMode == ASMIM_IMMEDIATE && mIns[i + 0].mAddress == 0 &&
 						mIns[i + 1].mType == ASMIT_LDA && mIns[i + 1].mMode == ASMIM_INDIRECT_Y &&
 						!mIns[i + 2].ChangesYReg() && (mIns[i + 2].mMode == ASMIM_IMMEDIATE || mIns[i + 2].mMode == ASMIM_ZERO_PAGE && mIns[i + 2].mAddress != mIns[i + 1].mAddress) &&
@@ -10824,10 +10799,50 @@ void NativeCodeBasicBlock::CopyCode(NativeCodeProcedure * proc, uint8* target)
 	{
 		mCopied = true;
 
+		if (mSize > 0)
+		{
+			proc->mInterProc->mLinkerObject->mBlockOffsets.Push(mOffset);
+			proc->mInterProc->mLinkerObject->mBlockLocations.Push(mLocation);
+		}
 
 		next = mOffset + mCode.Size();
 
-		if (mFalseJump)
+		if (mBranch == ASMIT_INV)
+		{
+			if (mJumpTable)
+			{
+				PutByte(AsmInsOpcodes[ASMIT_JMP][ASMIM_INDIRECT]);
+				PutWord(BC_REG_ADDR);
+				next += 3;
+
+				if (mJumpTable->mReferences.Size() == 0)
+				{
+					// Resolve the table entries to the now placed case blocks
+
+					int	size = mJumpTable->mSize / 2;
+					for (int i = 0; i < size; i++)
+					{
+						NativeCodeBasicBlock* block = this;
+						for (int j = 0; j < mJumpTable->mData[i]; j++)
+							block = block->mFalseJump;
+						block = block->mTrueJump;
+
+						LinkerReference		rl;
+						rl.mObject = mJumpTable;
+						rl.mRefObject = proc->mInterProc->mLinkerObject;
+						rl.mRefOffset = block->mOffset;
+						rl.mOffset = i;
+						rl.mFlags = LREF_LOWBYTE;
+						mJumpTable->AddReference(rl);
+
+						rl.mOffset = i + size;
+						rl.mFlags = LREF_HIGHBYTE;
+						mJumpTable->AddReference(rl);
+					}
+				}
+			}
+		}
+		else if (mFalseJump)
 		{
 			if (mFalseJump->mOffset <= mOffset)
 			{
@@ -10883,7 +10898,19 @@ void NativeCodeBasicBlock::CalculateOffset(int& total)
 		mOffset = total;
 		next = total + mCode.Size();
 
-		if (mFalseJump)
+		if (mBranch == ASMIT_INV)
+		{
+			// Dispatch through a jump table, the successors only need to be placed
+
+			total = next;
+			if (mJumpTable)
+				total += 3;
+			mSize = total - mOffset;
+
+			mTrueJump->CalculateOffset(total);
+			mFalseJump->CalculateOffset(total);
+		}
+		else if (mFalseJump)
 		{
 			if (mFalseJump->mOffset <= total)
 			{
@@ -11009,13 +11036,26 @@ NativeCodeBasicBlock::NativeCodeBasicBlock(void)
 	: mIns(NativeCodeInstruction(ASMIT_INV, ASMIM_IMPLIED)), mRelocations({ 0 }), mEntryBlocks(nullptr), mCode(0)
 {
 	mTrueJump = mFalseJump = NULL;
+	mFromJump = nullptr;
+	mBranch = ASMIT_RTS;
+	mIndex = 0;
 	mOffset = 0x7fffffff;
+	mSize = 0;
+	mNumEntries = 0;
+	mNumEntered = 0;
+	mFrameOffset = 0;
+	mPlaced = false;
+	mNoFrame = false;
+	mVisited = false;
+	mLoopHead = false;
+	mVisiting = false;
 	mCopied = false;
 	mKnownShortBranch = false;
 	mBypassed = false;
 	mAssembled = false;
 	mLocked = false;
 	mLoopHeadBlock = nullptr;
+	mJumpTable = nullptr;
 }
 
 NativeCodeBasicBlock::~NativeCodeBasicBlock(void)
@@ -11023,15 +11063,25 @@ NativeCodeBasicBlock::~NativeCodeBasicBlock(void)
 
 }
 
+void* NativeCodeBasicBlock::operator new(size_t size)
+{
+	return MemoryArena::Current()->AllocateObject<NativeCodeBasicBlock>(size);
+}
+
+void NativeCodeBasicBlock::operator delete(void* ptr)
+{
+	// Destroyed when the arena of the procedure is released
+}
+
 NativeCodeProcedure::NativeCodeProcedure(NativeCodeGenerator* generator)
-	: mGenerator(generator), mRelocations({ 0 }), mBlocks(nullptr)
+	: tblocks(nullptr), mGenerator(generator), mRelocations({ 0 }), mBlocks(nullptr)
 {
 	mTempBlocks = 1000;
 }
 
 NativeCodeProcedure::~NativeCodeProcedure(void)
 {
-
+	delete[] tblocks;
 }
 
 void NativeCodeProcedure::CompressTemporaries(void)
@@ -11048,7 +11098,7 @@ void NativeCodeProcedure::CompressTemporaries(void)
 		for (int i = 0; i < 256; i++)
 			remap[i] = i;
 
-		int	tpos = BC_REG_TMP_SAVED;
+		int	tpos = BC_REG_TMP_SAVED + mInterProc->mTempBase;
 		for (int i = 0; i < mInterProc->mTempOffset.Size(); i++)
 		{
 			bool	tused = false;
@@ -11084,13 +11134,15 @@ void NativeCodeProcedure::CompressTemporaries(void)
 
 		mInterProc->mTempSize = tpos - BC_REG_TMP;
 
-		if (mNoFrame && !used[BC_REG_STACK] && mInterProc->mTempSize <= 16)
+		if (mNoFrame && !used[BC_REG_STACK] && (mInterProc->mStaticTemps || mInterProc->mTempSize <= 16 + mInterProc->mTempBase))
 			mStackExpand = 0;
 	}
 }
 
 void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 {
+	MemoryArena::Scope	arenaScope(&mArena);
+
 	mInterProc = proc;
 
 	int	nblocks = proc->mBlocks.Size();
@@ -11100,7 +11152,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 
 	mIndex = proc->mID;
 
-	int		tempSave = proc->mTempSize > 16 ? proc->mTempSize - 16 : 0;
+	int		tempSave = proc->mTempSize > 16 && !proc->mStaticTemps ? proc->mTempSize - 16 : 0;
 	int		commonFrameSize = proc->mCommonFrameSize;
 
 	mStackExpand = tempSave + proc->mLocalSize;
@@ -11112,7 +11164,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 	mNoFrame = (mStackExpand + proc->mCommonFrameSize) < 64 && !proc->mHasDynamicStack;// && !(proc->mHasInlineAssembler && !proc->mLeafProcedure);
 
 	if (mNoFrame)
-		proc->mLinkerObject->mFlags |= LOBJF_NO_FRAME;
+		proc->mLinkerFlags |= LOBJF_NO_FRAME;
 
 	if (mNoFrame)
 	{
@@ -11153,11 +11205,14 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 
 	mExitBlock->mIns.Pop();
 
-	CompressTemporaries();
+	RunPass(OPASS_NATIVE_COMPRESS_TEMPS, [this]() {
+		CompressTemporaries();
+		return false;
+	});
 
 	int frameSpace = tempSave;
 
-	tempSave = proc->mTempSize > 16 ? proc->mTempSize - 16 : 0;
+	tempSave = proc->mTempSize > 16 + proc->mTempBase && !proc->mStaticTemps ? proc->mTempSize - 16 - proc->mTempBase : 0;
 
 	if (!(mGenerator->mCompilerOptions & COPT_NATIVE))
 		mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_BYTE, ASMIM_IMPLIED, 0xea));
@@ -11177,7 +11232,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 			if (tempSave)
 			{
 				mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDY, ASMIM_IMMEDIATE, tempSave - 1));
-				mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED));
+				mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED + proc->mTempBase));
 				mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_INDIRECT_Y, BC_REG_STACK));
 				if (tempSave > 1)
 				{
@@ -11209,7 +11264,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 			mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_DEY, ASMIM_IMPLIED));
 			mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_DEY, ASMIM_IMPLIED));
 
-			mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED));
+			mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED + proc->mTempBase));
 			mEntryBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_INDIRECT_Y, BC_REG_STACK));
 			if (tempSave > 1)
 			{
@@ -11261,7 +11316,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 				mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDY, ASMIM_IMMEDIATE, tempSave - 1));
 
 				mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_INDIRECT_Y, BC_REG_STACK));
-				mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED));
+				mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED + proc->mTempBase));
 				if (tempSave > 1)
 				{
 					mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_DEY, ASMIM_IMPLIED));
@@ -11293,7 +11348,7 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 			mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_DEY, ASMIM_IMPLIED));
 
 			mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_INDIRECT_Y, BC_REG_STACK));
-			mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED));
+			mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ABSOLUTE_Y, BC_REG_TMP_SAVED + proc->mTempBase));
 			if (tempSave > 1)
 			{
 				mExitBlock->mIns.Push(NativeCodeInstruction(ASMIT_DEY, ASMIM_IMPLIED));
@@ -11394,29 +11449,41 @@ void NativeCodeProcedure::Optimize(void)
 		mEntryBlock->CountEntries(nullptr);
 
 #if 1
-		do
-		{
-			BuildDataFlowSets();
-			ResetVisited();
-			changed = mEntryBlock->RemoveUnusedResultInstructions();
+		RunPass(OPASS_NATIVE_VALUE_FORWARDING, [this]() {
+			bool	forwarded, changed = false;
+			do
+			{
+				BuildDataFlowSets();
+				ResetVisited();
+				forwarded = mEntryBlock->RemoveUnusedResultInstructions();
 
-			ResetVisited();
-			NativeRegisterDataSet	data;
-			if (mEntryBlock->ValueForwarding(data))
-				changed = true;
+				ResetVisited();
+				NativeRegisterDataSet	data;
+				if (mEntryBlock->ValueForwarding(data))
+					forwarded = true;
 
-		} while (changed);
+				if (forwarded)
+					changed = true;
+			} while (forwarded);
+			return changed;
+		});
 #endif
-		ResetVisited();
-		if (mEntryBlock->PeepHoleOptimizer(step))
+		if (RunPass(OPASS_NATIVE_PEEPHOLE, [&]() {
+			ResetVisited();
+			return mEntryBlock->PeepHoleOptimizer(step);
+		}))
 			changed = true;
 
-		ResetVisited();
-		if (mEntryBlock->OptimizeSimpleLoop(this))
+		if (RunPass(OPASS_NATIVE_SIMPLE_LOOP, [this]() {
+			ResetVisited();
+			return mEntryBlock->OptimizeSimpleLoop(this);
+		}))
 			changed = true;
 
-		ResetVisited();
-		if (mEntryBlock->MergeBasicBlocks())
+		if (RunPass(OPASS_NATIVE_MERGE_BLOCKS, [this]() {
+			ResetVisited();
+			return mEntryBlock->MergeBasicBlocks();
+		}))
 			changed = true;
 
 		ResetVisited();
@@ -11426,102 +11493,120 @@ void NativeCodeProcedure::Optimize(void)
 
 		if (step == 2)
 		{
-			if (MapFastParamsToTemps())
+			if (RunPass(OPASS_NATIVE_FAST_PARAMS, [this]() {
+				return MapFastParamsToTemps();
+			}))
 				changed = true;
 		}
 
 		if (step > 2)
 		{
-			ResetVisited();
-			if (mEntryBlock->JoinTailCodeSequences())
+			if (RunPass(OPASS_NATIVE_TAIL_JOIN, [this]() {
+				ResetVisited();
+				return mEntryBlock->JoinTailCodeSequences();
+			}))
 				changed = true;
 		}
 
 		if (step == 3)
 		{
-			ResetVisited();
-			changed = mEntryBlock->OptimizeInnerLoops(this);
+			changed = RunPass(OPASS_NATIVE_INNER_LOOPS, [this]() {
+				// The loop body marker must not survive from a previous round, a
+				// stale marker would collect an empty loop body for the same head
+
+				ResetVisited();
+				for (int i = 0; i < mBlocks.Size(); i++)
+					mBlocks[i]->mLoopHeadBlock = nullptr;
+				return mEntryBlock->OptimizeInnerLoops(this);
+			});
 		}
 		else if (step == 4)
 		{
 #if 1
-			int	xregs[256], yregs[256];
-			for (int i = 0; i < 256; i++)
-				xregs[i] = yregs[i] = 0;
+			if (RunPass(OPASS_NATIVE_REGISTER_XY, [&]() {
+				bool	mapped = false;
+				int	xregs[256], yregs[256];
+				for (int i = 0; i < 256; i++)
+					xregs[i] = yregs[i] = 0;
 
-			for (int i = 0; i < 4; i++)
-			{
-				xregs[BC_REG_ACCU + i] = -1;
-				yregs[BC_REG_ACCU + i] = -1;
-				xregs[BC_REG_WORK + i] = -1;
-				yregs[BC_REG_WORK + i] = -1;
-			}
+				for (int i = 0; i < 4; i++)
+				{
+					xregs[BC_REG_ACCU + i] = -1;
+					yregs[BC_REG_ACCU + i] = -1;
+					xregs[BC_REG_WORK + i] = -1;
+					yregs[BC_REG_WORK + i] = -1;
+				}
 
-			if (!mInterProc->mLeafProcedure)
-			{
-				for (int i = BC_REG_FPARAMS; i < BC_REG_FPARAMS_END; i++)
+				if (!mInterProc->mLeafProcedure)
 				{
-					xregs[i] = -1;
-					yregs[i] = -1;
+					for (int i = BC_REG_FPARAMS; i < BC_REG_FPARAMS_END; i++)
+					{
+						xregs[i] = -1;
+						yregs[i] = -1;
+					}
 				}
-			}
 
-			if (xmapped)
-				xregs[0] = -1;
-			if (ymapped)
-				yregs[0] = -1;
+				if (xmapped)
+					xregs[0] = -1;
+				if (ymapped)
+					yregs[0] = -1;
 
-			ResetVisited();
-			mEntryBlock->GlobalRegisterXYCheck(xregs, yregs);
-			if (xregs[0] >= 0)
-			{
-				int j = 1;
-				for (int i = 0; i < 256; i++)
-					if (xregs[i] > xregs[j])
-						j = i;
-				if (xregs[j] > 0)
+				ResetVisited();
+				mEntryBlock->GlobalRegisterXYCheck(xregs, yregs);
+				if (xregs[0] >= 0)
 				{
-					ResetVisited();
-					mEntryBlock->GlobalRegisterXMap(j);
-					if (j >= BC_REG_FPARAMS && j < BC_REG_FPARAMS_END)
-						mEntryBlock->mTrueJump->mIns.Insert(0, NativeCodeInstruction(ASMIT_LDX, ASMIM_ZERO_PAGE, j));
-					changed = true;
-					xmapped = true;
+					int j = 1;
+					for (int i = 0; i < 256; i++)
+						if (xregs[i] > xregs[j])
+							j = i;
+					if (xregs[j] > 0)
+					{
+						ResetVisited();
+						mEntryBlock->GlobalRegisterXMap(j);
+						if (j >= BC_REG_FPARAMS && j < BC_REG_FPARAMS_END)
+							mEntryBlock->mTrueJump->mIns.Insert(0, NativeCodeInstruction(ASMIT_LDX, ASMIM_ZERO_PAGE, j));
+						mapped = true;
+						xmapped = true;
+					}
 				}
-			}
 			
-			if (!changed && yregs[0] >= 0)
-			{
-				int j = 1;
-				for (int i = 0; i < 256; i++)
-					if (yregs[i] > yregs[j])
-						j = i;
-				if (yregs[j] > 0)
+				if (!changed && !mapped && yregs[0] >= 0)
 				{
-					ResetVisited();
-					mEntryBlock->GlobalRegisterYMap(j);
-					if (j >= BC_REG_FPARAMS && j < BC_REG_FPARAMS_END)
-						mEntryBlock->mTrueJump->mIns.Insert(0, NativeCodeInstruction(ASMIT_LDY, ASMIM_ZERO_PAGE, j));
-					changed = true;
-					ymapped = true;
+					int j = 1;
+					for (int i = 0; i < 256; i++)
+						if (yregs[i] > yregs[j])
+							j = i;
+					if (yregs[j] > 0)
+					{
+						ResetVisited();
+						mEntryBlock->GlobalRegisterYMap(j);
+						if (j >= BC_REG_FPARAMS && j < BC_REG_FPARAMS_END)
+							mEntryBlock->mTrueJump->mIns.Insert(0, NativeCodeInstruction(ASMIT_LDY, ASMIM_ZERO_PAGE, j));
+						mapped = true;
+						ymapped = true;
+					}
 				}
-			}
 
-			if (!changed)
-			{
-				ResetVisited();
-				if (mEntryBlock->LocalRegisterXYMap())
-					changed = true;
-			}
+				if (!changed && !mapped)
+				{
+					ResetVisited();
+					if (mEntryBlock->LocalRegisterXYMap())
+						mapped = true;
+				}
+				return mapped;
+			}))
+				changed = true;
 #endif
 		}
 #if 1
-		ResetVisited();
-		NativeRegisterDataSet	data;
-		mEntryBlock->BuildEntryDataSet(data);
+		if (RunPass(OPASS_NATIVE_ENTRY_DATA, [this]() {
+			ResetVisited();
+			NativeRegisterDataSet	data;
+			mEntryBlock->BuildEntryDataSet(data);
 
-		ResetVisited();
-		if (mEntryBlock->ApplyEntryDataSet())
+			ResetVisited();
+			return mEntryBlock->ApplyEntryDataSet();
+		}))
 			changed = true;
 #endif
 		if (!changed && step < 5)
@@ -11531,11 +11616,25 @@ void NativeCodeProcedure::Optimize(void)
 		}
 	} while (changed);
 
-	ResetVisited();
-	mEntryBlock->BlockSizeReduction();
+	RunPass(OPASS_NATIVE_BLOCK_SIZE, [this]() {
+		ResetVisited();
+		mEntryBlock->BlockSizeReduction();
+		return false;
+	});
 #endif
 }
 
+bool NativeCodeProcedure::RunPass(OptimizerPass pass, const std::function<bool(void)>& run)
+{
+	return mInterProc->RunPass(pass, run, [this]() { return NumInstructions(); });
+}
+
+int NativeCodeProcedure::NumInstructions(void)
+{
+	ResetVisited();
+	return mEntryBlock->CountInstructions();
+}
+
 void NativeCodeProcedure::BuildDataFlowSets(void)
 {
 	//
@@ -11584,6 +11683,7 @@ NativeCodeBasicBlock* NativeCodeProcedure::CompileBlock(InterCodeProcedure* ipro
 
 	tblocks[sblock->mIndex] = block;
 	block->mIndex = sblock->mIndex;
+	block->mLocation = sblock->mLocation;
 
 	CompileInterBlock(iproc, sblock, block);
 
@@ -11880,6 +11980,23 @@ void NativeCodeProcedure::CompileInterBlock(InterCodeProcedure* iproc, InterCode
 			}
 			return;
 
+		case IC_JUMPI:
+			if (ins->mSrc[0].mTemp >= 0)
+			{
+				LinkerObject* table = ins->mConst.mLinkerObject;
+
+				block->mIns.Push(NativeCodeInstruction(ASMIT_LDX, ASMIM_ZERO_PAGE, BC_REG_TMP + iproc->mTempOffset[ins->mSrc[0].mTemp]));
+				block->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, table));
+				block->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, BC_REG_ADDR));
+				block->mIns.Push(NativeCodeInstruction(ASMIT_LDA, ASMIM_ABSOLUTE_X, table->mSize / 2, table));
+				block->mIns.Push(NativeCodeInstruction(ASMIT_STA, ASMIM_ZERO_PAGE, BC_REG_ADDR + 1));
+				block->mJumpTable = table;
+			}
+			else
+				block->mLocked = true;
+
+			block->Close(CompileBlock(iproc, iblock->mTrueJump), CompileBlock(iproc, iblock->mFalseJump), ASMIT_INV);
+			return;
 		}
 
 		i++;
@@ -94,8 +94,12 @@ public:
 	NativeCodeBasicBlock(void);
 	~NativeCodeBasicBlock(void);
 
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+
 	GrowingArray<uint8>					mCode;
 	int									mIndex;
+	Location							mLocation;
 
 	NativeCodeBasicBlock* mTrueJump, * mFalseJump, * mFromJump;
 	AsmInsType							mBranch;
@@ -108,6 +112,7 @@ public:
 	int						mOffset, mSize, mNumEntries, mNumEntered, mFrameOffset;
 	bool					mPlaced, mCopied, mKnownShortBranch, mBypassed, mAssembled, mNoFrame, mVisited, mLoopHead, mVisiting, mLocked;
 	NativeCodeBasicBlock* mLoopHeadBlock;
+	LinkerObject		* mJumpTable;
 
 	NativeRegisterDataSet	mDataSet, mNDataSet;
 
@@ -122,7 +127,9 @@ public:
 	void Close(NativeCodeBasicBlock* trueJump, NativeCodeBasicBlock* falseJump, AsmInsType branch);
 
 	bool RemoveNops(void);
+	int CountInstructions(void);
 	bool PeepHoleOptimizer(int pass);
+	bool ApplyPeepHolePattern(int at, int length);
 	void BlockSizeReduction(void);
 	bool OptimizeSimpleLoop(NativeCodeProcedure* proc);
 	bool OptimizeInnerLoop(NativeCodeProcedure* proc, NativeCodeBasicBlock* head, NativeCodeBasicBlock* tail, GrowingArray<NativeCodeBasicBlock*>& blocks);
@@ -230,8 +237,12 @@ class NativeCodeProcedure
 		GrowingArray<LinkerReference>	mRelocations;
 		GrowingArray < NativeCodeBasicBlock*>	 mBlocks;
 
+		MemoryArena						mArena;
+
 		void Compile(InterCodeProcedure* proc);
 		void Optimize(void);
+		bool RunPass(OptimizerPass pass, const std::function<bool(void)>& run);
+		int NumInstructions(void);
 
 		NativeCodeBasicBlock* CompileBlock(InterCodeProcedure* iproc, InterCodeBasicBlock* block);
 		NativeCodeBasicBlock* AllocateBlock(void);
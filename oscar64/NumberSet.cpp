@@ -1,154 +1,422 @@
 #include "NumberSet.h"
 
-NumberSet::NumberSet(void)
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define NUMBERSET_X86	1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+//
+// Bulk kernels on 64 bit words
+//
+
+static void ScalarAnd(uint64* d, const uint64* s, int n)
 {
-	size = 0;
-	dwsize = 0;
-	bits = 0;
+	for (int i = 0; i < n; i++)
+		d[i] &= s[i];
 }
 
-NumberSet::NumberSet(int size, bool set)
+static void ScalarOr(uint64* d, const uint64* s, int n)
 {
-	int i;
+	for (int i = 0; i < n; i++)
+		d[i] |= s[i];
+}
 
-	this->size = size;
-	dwsize = (size + 31) >> 5;
+static void ScalarAndNot(uint64* d, const uint64* s, int n)
+{
+	for (int i = 0; i < n; i++)
+		d[i] &= ~s[i];
+}
 
-	bits = new uint32[dwsize];
+static void ScalarOrNot(uint64* d, const uint64* s, int n)
+{
+	for (int i = 0; i < n; i++)
+		d[i] |= ~s[i];
+}
 
-	if (set)
+static bool ScalarSubset(const uint64* d, const uint64* s, int n)
+{
+	for (int i = 0; i < n; i++)
+		if (d[i] & ~s[i]) return false;
+	return true;
+}
+
+#if NUMBERSET_X86
+
+static void SSE2And(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 2 <= n; i += 2)
+		_mm_storeu_si128((__m128i*)(d + i), _mm_and_si128(_mm_loadu_si128((const __m128i*)(d + i)), _mm_loadu_si128((const __m128i*)(s + i))));
+	for (; i < n; i++)
+		d[i] &= s[i];
+}
+
+static void SSE2Or(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 2 <= n; i += 2)
+		_mm_storeu_si128((__m128i*)(d + i), _mm_or_si128(_mm_loadu_si128((const __m128i*)(d + i)), _mm_loadu_si128((const __m128i*)(s + i))));
+	for (; i < n; i++)
+		d[i] |= s[i];
+}
+
+static void SSE2AndNot(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 2 <= n; i += 2)
+		_mm_storeu_si128((__m128i*)(d + i), _mm_andnot_si128(_mm_loadu_si128((const __m128i*)(s + i)), _mm_loadu_si128((const __m128i*)(d + i))));
+	for (; i < n; i++)
+		d[i] &= ~s[i];
+}
+
+static void SSE2OrNot(uint64* d, const uint64* s, int n)
+{
+	const __m128i	ones = _mm_set1_epi32(-1);
+
+	int	i = 0;
+	for (; i + 2 <= n; i += 2)
+		_mm_storeu_si128((__m128i*)(d + i), _mm_or_si128(_mm_loadu_si128((const __m128i*)(d + i)), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(s + i)), ones)));
+	for (; i < n; i++)
+		d[i] |= ~s[i];
+}
+
+static bool SSE2Subset(const uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 2 <= n; i += 2)
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0xffffffff;
+		__m128i	r = _mm_andnot_si128(_mm_loadu_si128((const __m128i*)(s + i)), _mm_loadu_si128((const __m128i*)(d + i)));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(r, _mm_setzero_si128())) != 0xffff)
+			return false;
 	}
-	else
+	for (; i < n; i++)
+		if (d[i] & ~s[i]) return false;
+	return true;
+}
+
+TARGET_AVX2 static void AVX2And(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 4 <= n; i += 4)
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(d + i)), _mm256_loadu_si256((const __m256i*)(s + i))));
+	for (; i < n; i++)
+		d[i] &= s[i];
+}
+
+TARGET_AVX2 static void AVX2Or(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 4 <= n; i += 4)
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(d + i)), _mm256_loadu_si256((const __m256i*)(s + i))));
+	for (; i < n; i++)
+		d[i] |= s[i];
+}
+
+TARGET_AVX2 static void AVX2AndNot(uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 4 <= n; i += 4)
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(s + i)), _mm256_loadu_si256((const __m256i*)(d + i))));
+	for (; i < n; i++)
+		d[i] &= ~s[i];
+}
+
+TARGET_AVX2 static void AVX2OrNot(uint64* d, const uint64* s, int n)
+{
+	const __m256i	ones = _mm256_set1_epi32(-1);
+
+	int	i = 0;
+	for (; i + 4 <= n; i += 4)
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(d + i)), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(s + i)), ones)));
+	for (; i < n; i++)
+		d[i] |= ~s[i];
+}
+
+TARGET_AVX2 static bool AVX2Subset(const uint64* d, const uint64* s, int n)
+{
+	int	i = 0;
+	for (; i + 4 <= n; i += 4)
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0;
+		__m256i	r = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(s + i)), _mm256_loadu_si256((const __m256i*)(d + i)));
+		if (!_mm256_testz_si256(r, r))
+			return false;
 	}
+	for (; i < n; i++)
+		if (d[i] & ~s[i]) return false;
+	return true;
 }
 
-NumberSet::NumberSet(const NumberSet& set)
+static bool HasAVX2(void)
 {
-	int i;
+#ifdef _MSC_VER
+	int	info[4];
 
-	this->size = set.size;
-	this->dwsize = set.dwsize;
-	this->bits = new uint32[dwsize];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] = set.bits[i];
+	// AVX and OS support for saving the YMM registers
+
+	__cpuid(info, 1);
+	if ((info[2] & (3 << 27)) != (3 << 27) || (_xgetbv(0) & 6) != 6)
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
 }
 
-NumberSet::~NumberSet(void)
+#endif
+
+struct NumberSetKernels
 {
-	delete[] bits;
+	NumberSetKernel		mKernel;
+	void				(*mAnd)(uint64* d, const uint64* s, int n);
+	void				(*mOr)(uint64* d, const uint64* s, int n);
+	void				(*mAndNot)(uint64* d, const uint64* s, int n);
+	void				(*mOrNot)(uint64* d, const uint64* s, int n);
+	bool				(*mSubset)(const uint64* d, const uint64* s, int n);
+};
+
+static const NumberSetKernels ScalarKernels = { NSK_SCALAR, ScalarAnd, ScalarOr, ScalarAndNot, ScalarOrNot, ScalarSubset };
+#if NUMBERSET_X86
+static const NumberSetKernels SSE2Kernels = { NSK_SSE2, SSE2And, SSE2Or, SSE2AndNot, SSE2OrNot, SSE2Subset };
+static const NumberSetKernels AVX2Kernels = { NSK_AVX2, AVX2And, AVX2Or, AVX2AndNot, AVX2OrNot, AVX2Subset };
+#endif
+
+// Statically initialized, so sets used before the dynamic initialization still work
+
+static const NumberSetKernels* Kernels = &ScalarKernels;
+
+bool NumberSet::SelectKernel(NumberSetKernel kernel)
+{
+	switch (kernel)
+	{
+	case NSK_SCALAR:
+		Kernels = &ScalarKernels;
+		return true;
+#if NUMBERSET_X86
+	case NSK_SSE2:
+		Kernels = &SSE2Kernels;
+		return true;
+	case NSK_AVX2:
+		if (HasAVX2())
+		{
+			Kernels = &AVX2Kernels;
+			return true;
+		}
+		break;
+#endif
+	}
+
+	return false;
 }
 
-void NumberSet::Reset(int size, bool set)
+NumberSetKernel NumberSet::Kernel(void)
 {
-	int i;
+	return Kernels->mKernel;
+}
 
-	delete[] bits;
+static bool SelectDefaultKernel(void)
+{
+	return NumberSet::SelectKernel(NSK_AVX2) || NumberSet::SelectKernel(NSK_SSE2);
+}
+
+static bool DefaultKernelSelected = SelectDefaultKernel();
 
+//
+// NumberSet
+//
+
+void NumberSet::Allocate(int size)
+{
 	this->size = size;
-	dwsize = (size + 31) >> 5;
+	qwsize = (size + 63) >> 6;
 
-	bits = new uint32[dwsize];
+	if (qwsize <= NumberSetInlineWords)
+		bits = smallbits;
+	else
+		bits = new uint64[qwsize];
+}
+
+void NumberSet::MaskTail(void)
+{
+	// Keep the bits beyond the last element clear, so that whole words can be compared
+
+	if (size & 63)
+		bits[qwsize - 1] &= (1ULL << (size & 63)) - 1;
+}
+
+NumberSet::NumberSet(void)
+{
+	size = 0;
+	qwsize = 0;
+	bits = smallbits;
+}
+
+NumberSet::NumberSet(int size, bool set)
+{
+	Allocate(size);
 
 	if (set)
+		Fill();
+	else
+		Clear();
+}
+
+NumberSet::NumberSet(const NumberSet& set)
+{
+	Allocate(set.size);
+	memcpy(bits, set.bits, qwsize * sizeof(uint64));
+}
+
+NumberSet::NumberSet(NumberSet&& set)
+{
+	size = set.size;
+	qwsize = set.qwsize;
+
+	if (set.bits == set.smallbits)
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0xffffffff;
+		bits = smallbits;
+		memcpy(bits, set.bits, qwsize * sizeof(uint64));
 	}
 	else
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0;
+		bits = set.bits;
+		set.bits = set.smallbits;
+		set.size = set.qwsize = 0;
 	}
 }
 
-void NumberSet::Fill(void)
+NumberSet::~NumberSet(void)
 {
-	int i;
+	if (bits != smallbits)
+		delete[] bits;
+}
+
+void NumberSet::Reset(int size, bool set)
+{
+	if (bits != smallbits)
+		delete[] bits;
+
+	Allocate(size);
+
+	if (set)
+		Fill();
+	else
+		Clear();
+}
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] = 0xffffffff;
+void NumberSet::Fill(void)
+{
+	if (qwsize)
+	{
+		memset(bits, 0xff, qwsize * sizeof(uint64));
+		MaskTail();
+	}
 }
 
 void NumberSet::OrNot(const NumberSet& set)
 {
-	int i;
+	if (qwsize > NumberSetInlineWords)
+		Kernels->mOrNot(bits, set.bits, qwsize);
+	else
+		ScalarOrNot(bits, set.bits, qwsize);
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] |= ~set.bits[i];
+	if (qwsize)
+		MaskTail();
 }
 
 void NumberSet::Clear(void)
 {
-	int i;
-
-	for (i = 0; i < dwsize; i++)
-		bits[i] = 0;
+	memset(bits, 0, qwsize * sizeof(uint64));
 }
 
 NumberSet& NumberSet::operator=(const NumberSet& set)
 {
-	int i;
+	if (this != &set)
+	{
+		if (qwsize != set.qwsize)
+		{
+			if (bits != smallbits)
+				delete[] bits;
+			Allocate(set.size);
+		}
+		else
+			this->size = set.size;
 
-	this->size = set.size;
+		memcpy(bits, set.bits, qwsize * sizeof(uint64));
+	}
 
-	if (dwsize != set.dwsize)
+	return *this;
+}
+
+NumberSet& NumberSet::operator=(NumberSet&& set)
+{
+	if (this != &set)
 	{
-		delete[] bits;
-		this->dwsize = set.dwsize;
-		this->bits = new uint32[dwsize];
-	}
+		if (set.bits == set.smallbits)
+			return *this = (const NumberSet&)set;
+
+		if (bits != smallbits)
+			delete[] bits;
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] = set.bits[i];
+		size = set.size;
+		qwsize = set.qwsize;
+		bits = set.bits;
+
+		set.bits = set.smallbits;
+		set.size = set.qwsize = 0;
+	}
 
 	return *this;
 }
 
 NumberSet& NumberSet::operator&=(const NumberSet& set)
 {
-	int i;
-
-	for (i = 0; i < dwsize; i++)
-		bits[i] &= set.bits[i];
+	if (qwsize > NumberSetInlineWords)
+		Kernels->mAnd(bits, set.bits, qwsize);
+	else
+		ScalarAnd(bits, set.bits, qwsize);
 
 	return *this;
 }
 
 NumberSet& NumberSet::operator|=(const NumberSet& set)
 {
-	int i;
-
-	for (i = 0; i < dwsize; i++)
-		bits[i] |= set.bits[i];
+	if (qwsize > NumberSetInlineWords)
+		Kernels->mOr(bits, set.bits, qwsize);
+	else
+		ScalarOr(bits, set.bits, qwsize);
 
 	return *this;
 }
 
 NumberSet& NumberSet::operator-=(const NumberSet& set)
 {
-	int i;
-
-	for (i = 0; i < dwsize; i++)
-		bits[i] &= ~set.bits[i];
+	if (qwsize > NumberSetInlineWords)
+		Kernels->mAndNot(bits, set.bits, qwsize);
+	else
+		ScalarAndNot(bits, set.bits, qwsize);
 
 	return *this;
 }
 
 bool NumberSet::operator<=(const NumberSet& set)
 {
-	int i;
-
-	for (i = 0; i < dwsize; i++)
-		if (bits[i] & ~set.bits[i]) return false;
-
-	return true;
+	if (qwsize > NumberSetInlineWords)
+		return Kernels->mSubset(bits, set.bits, qwsize);
+	else
+		return ScalarSubset(bits, set.bits, qwsize);
 }
 
 
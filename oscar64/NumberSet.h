@@ -4,15 +4,33 @@
 
 #include "MachineTypes.h"
 
+// Sets with up to NumberSetInlineWords * 64 elements are stored inside the
+// object, larger sets on the heap.  The bulk operations on large sets use
+// SSE2 or AVX2 kernels when the processor supports them.
+
+static const int NumberSetInlineWords = 4;
+
+enum NumberSetKernel
+{
+	NSK_SCALAR,
+	NSK_SSE2,
+	NSK_AVX2
+};
+
 class NumberSet
 {
 protected:
-	uint32				* bits;
-	int					size, dwsize;
+	uint64				* bits;
+	int					size, qwsize;
+	uint64				smallbits[NumberSetInlineWords];
+
+	void Allocate(int size);
+	void MaskTail(void);
 public:
 	NumberSet(void);
 	NumberSet(int size, bool set = false);
 	NumberSet(const NumberSet& set);
+	NumberSet(NumberSet&& set);
 	~NumberSet(void);
 
 	void Reset(int size, bool set = false);
@@ -23,6 +41,7 @@ public:
 	bool operator[](int elem) const;
 
 	NumberSet& operator=(const NumberSet& set);
+	NumberSet& operator=(NumberSet&& set);
 
 	NumberSet& operator&=(const NumberSet& set);
 	NumberSet& operator|=(const NumberSet& set);
@@ -36,12 +55,16 @@ public:
 	void Fill(void);
 
 	int Size(void) { return size; }
+
+	// Select the kernels used for large sets, fails if not supported by the processor
+	static bool SelectKernel(NumberSetKernel kernel);
+	static NumberSetKernel Kernel(void);
 };
 
 inline NumberSet& NumberSet::operator+=(int elem)
 {
 	assert(elem >= 0 && elem < size);
-	bits[elem >> 5] |= (1UL << (elem & 31));
+	bits[elem >> 6] |= (1ULL << (elem & 63));
 
 	return *this;
 }
@@ -49,7 +72,7 @@ inline NumberSet& NumberSet::operator+=(int elem)
 inline NumberSet& NumberSet::operator-=(int elem)
 {
 	assert(elem >= 0 && elem < size);
-	bits[elem >> 5] &= ~(1UL << (elem & 31));
+	bits[elem >> 6] &= ~(1ULL << (elem & 63));
 
 	return *this;
 }
@@ -57,7 +80,7 @@ inline NumberSet& NumberSet::operator-=(int elem)
 inline bool NumberSet::operator[](int elem) const
 {
 	assert(elem >= 0 && elem < size);
-	return (bits[elem >> 5] & (1UL << (elem & 31))) != 0;
+	return (bits[elem >> 6] & (1ULL << (elem & 63))) != 0;
 }
 
 
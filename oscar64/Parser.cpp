@@ -2,9 +2,10 @@
 #include <string.h>
 #include "Assembler.h"
 #include "MachineTypes.h"
+#include "Prelude.h"
 
 Parser::Parser(Errors* errors, Scanner* scanner, CompilationUnits* compilationUnits)
-	: mErrors(errors), mScanner(scanner), mCompilationUnits(compilationUnits)
+	: mErrors(errors), mScanner(scanner), mCompilationUnits(compilationUnits), mLazyBodies(false), mDeferredTokens(nullptr), mDeferredScanner(nullptr), mDeferredCharMap(nullptr)
 {
 	mGlobals = new DeclarationScope(compilationUnits->mScope);
 	mScope = mGlobals;
@@ -19,7 +20,10 @@ Parser::Parser(Errors* errors, Scanner* scanner, CompilationUnits* compilationUn
 
 Parser::~Parser(void)
 {
-
+	delete mScanner;
+	delete mDeferredScanner;
+	delete mDeferredTokens;
+	delete[] mDeferredCharMap;
 }
 
 Declaration* Parser::ParseStructDeclaration(uint32 flags, DecType dt)
@@ -293,7 +297,7 @@ Declaration* Parser::ParseBaseTypeDeclaration(uint32 flags)
 							mErrors->Error(mScanner->mLocation, EERR_CONSTANT_TYPE, "Integer constant expected");
 					}
 					cdec->mInteger = nitem++;
-					if (dec->mInteger < 0)
+					if (cdec->mInteger < 0)
 						dec->mFlags |= DTF_SIGNED;
 					if (cdec->mInteger < -128 || cdec->mInteger > 127)
 						dec->mSize = 2;
@@ -661,7 +665,7 @@ Expression* Parser::ParseInitExpression(Declaration* dtype)
 			dec->mSize = dtype->mSize;
 			dec->mSection = mDataSection;
 
-			uint8* d = new uint8[dtype->mSize];
+			uint8* d = (uint8*)MemoryArena::Current()->Allocate(dtype->mSize);
 			dec->mData = d;
 
 			if (strlen(mScanner->mTokenString) < dtype->mSize)
@@ -672,8 +676,8 @@ Expression* Parser::ParseInitExpression(Declaration* dtype)
 					d[i] = mCharMap[mScanner->mTokenString[i]];
 					i++;
 				}
-				if (i < dec->mSize)
-					d[i] = 0;
+				while (i < dec->mSize)
+					d[i++] = 0;
 			}
 			else
 				mErrors->Error(mScanner->mLocation, EERR_CONSTANT_INITIALIZER, "String constant is too large for char array");
@@ -754,6 +758,8 @@ Declaration* Parser::ParseDeclaration(bool variable)
 
 		ndec = ReverseDeclaration(ndec, bdec);
 
+		Location	nloc = ndec->mLocation;
+
 		// Make room for return value pointer on struct return
 		if (ndec->mBase->mType == DT_TYPE_FUNCTION && ndec->mBase->mBase->mType == DT_TYPE_STRUCT)
 		{
@@ -879,10 +885,18 @@ Declaration* Parser::ParseDeclaration(bool variable)
 				if (ndec->mFlags & DTF_DEFINED)
 					mErrors->Error(ndec->mLocation, EERR_DUPLICATE_DEFINITION, "Duplicate function definition");
 
+				// A function is located at its definition, not at a prototype
+
+				ndec->mLocation = nloc;
 				ndec->mVarIndex = -1;
-				ndec->mValue = ParseFunction(ndec->mBase);
+				if (mLazyBodies)
+					ndec->mBody = DeferFunction(ndec->mBase);
+				else
+				{
+					ndec->mValue = ParseFunction(ndec->mBase);
+					ndec->mNumVars = mLocalIndex;
+				}
 				ndec->mFlags |= DTF_DEFINED;
-				ndec->mNumVars = mLocalIndex;
 			}
 			return rdec;
 		}
@@ -1043,7 +1057,7 @@ Expression* Parser::ParseSimpleExpression(void)
 		dec->mBase->mSize = dec->mSize;
 		dec->mBase->mBase = TheConstCharTypeDeclaration;
 		dec->mBase->mFlags |= DTF_DEFINED;
-		uint8* d = new uint8[dec->mSize];
+		uint8* d = (uint8*)MemoryArena::Current()->Allocate(dec->mSize);
 		dec->mData = d;
 
 		int i = 0;
@@ -1064,17 +1078,17 @@ Expression* Parser::ParseSimpleExpression(void)
 		while (mScanner->mToken == TK_STRING)
 		{
 			int	s = strlen(mScanner->mTokenString);
-			uint8* d = new uint8[dec->mSize + s];
+			uint8* d = (uint8*)MemoryArena::Current()->Allocate(dec->mSize + s);
 			memcpy(d, dec->mData, dec->mSize - 1);
 			int i = 0;
 			while (mScanner->mTokenString[i])
 			{
-				d[i + dec->mSize] = mCharMap[mScanner->mTokenString[i]];
+				d[i + dec->mSize - 1] = mCharMap[mScanner->mTokenString[i]];
 				i++;
 			}
-			d[i + dec->mSize] = 0;
+			d[i + dec->mSize - 1] = 0;
 			dec->mSize += s;
-			delete[] dec->mData;
+			dec->mBase->mSize = dec->mSize;
 			dec->mData = d;
 			mScanner->NextToken();
 		}
@@ -1680,6 +1694,122 @@ Expression* Parser::ParseFunction(Declaration * dec)
 	return exp;
 }
 
+void* DeferredBody::operator new(size_t size)
+{
+	return MemoryArena::Current()->Allocate(size);
+}
+
+void DeferredBody::operator delete(void* ptr)
+{
+	// Bodies that are never referenced are returned with the arena of the compiler
+}
+
+DeferredBody* Parser::DeferFunction(Declaration* dec)
+{
+	if (!mDeferredTokens)
+		mDeferredTokens = new PreludeUnit("deferred");
+
+	if (!mDeferredCharMap)
+	{
+		mDeferredCharMap = new char[256];
+		memcpy(mDeferredCharMap, mCharMap, 256);
+	}
+
+	DeferredBody* body = new DeferredBody();
+	body->mParser = this;
+	body->mType = dec;
+	body->mStart = mDeferredTokens->Mark();
+	body->mCodeSection = mCodeSection;
+	body->mDataSection = mDataSection;
+	body->mBSSection = mBSSection;
+	body->mCharMap = mDeferredCharMap;
+
+	// Record the tokens up to the matching closing brace, assembler blocks
+	// switch the scanner mode after their first token just as ParseAssembler
+
+	int	depth = 0, asmstate = 0;
+	do
+	{
+		mDeferredTokens->Record(mScanner);
+
+		Token	token = mScanner->mToken;
+		if (token == TK_EOF)
+		{
+			mErrors->Error(mScanner->mLocation, EERR_SYNTAX, "'}' expected");
+			break;
+		}
+		else if (asmstate == 3)
+		{
+			if (token == TK_CLOSE_BRACE)
+			{
+				mScanner->SetAssemblerMode(false);
+				asmstate = 0;
+			}
+		}
+		else if (asmstate == 1 && token == TK_OPEN_BRACE)
+			asmstate = 2;
+		else
+		{
+			asmstate = 0;
+			if (token == TK_ASM)
+				asmstate = 1;
+			else if (token == TK_OPEN_BRACE)
+				depth++;
+			else if (token == TK_CLOSE_BRACE)
+				depth--;
+		}
+
+		mScanner->NextToken();
+
+		if (asmstate == 2)
+		{
+			mScanner->SetAssemblerMode(true);
+			asmstate = 3;
+		}
+	} while (depth > 0);
+
+	return body;
+}
+
+Expression* Parser::ParseDeferredFunction(Declaration* dec)
+{
+	DeferredBody* body = dec->mBody;
+	dec->mBody = nullptr;
+
+	Scanner* scanner = mScanner;
+	DeclarationScope* scope = mScope;
+	LinkerSection* codeSection = mCodeSection, * dataSection = mDataSection, * bssSection = mBSSection;
+	char	charMap[256];
+	memcpy(charMap, mCharMap, 256);
+
+	mDeferredTokens->Seek(body->mStart);
+	if (mDeferredScanner)
+		mDeferredScanner->NextToken();
+	else
+		mDeferredScanner = new Scanner(mErrors, scanner->mPreprocessor, mDeferredTokens);
+
+	mScanner = mDeferredScanner;
+	mScope = mGlobals;
+	mCodeSection = body->mCodeSection;
+	mDataSection = body->mDataSection;
+	mBSSection = body->mBSSection;
+	memcpy(mCharMap, body->mCharMap, 256);
+
+	dec->mValue = ParseFunction(body->mType);
+	dec->mNumVars = mLocalIndex;
+
+	mScanner = scanner;
+	mScope = scope;
+	mCodeSection = codeSection;
+	mDataSection = dataSection;
+	mBSSection = bssSection;
+	memcpy(mCharMap, charMap, 256);
+
+	delete body;
+
+	return dec->mValue;
+}
+
 Expression* Parser::ParseStatement(void)
 {
 	Expression* exp = nullptr;
@@ -2623,7 +2753,7 @@ void Parser::ParsePragma(void)
 			ConsumeToken(TK_OPEN_PARENTHESIS);
 			if (mScanner->mToken == TK_STRING)
 			{
-				mCompilationUnits->AddUnit(mScanner->mLocation, mScanner->mTokenString, mScanner->mLocation.mFileName);
+				mCompilationUnits->AddUnit(mScanner->mLocation, mScanner->mTokenString, mScanner->mLocation.mFileName, true);
 				mScanner->NextToken();
 			}
 			ConsumeToken(TK_CLOSE_PARENTHESIS);
@@ -2848,6 +2978,7 @@ void Parser::ParsePragma(void)
 					for (int i = 0; i < ccount; i++)
 					{
 						mCharMap[cindex] = ccode;
+						mDeferredCharMap = nullptr;
 						cindex = (cindex + 1) & 255;
 						ccode = (ccode + 1) & 255;
 					}
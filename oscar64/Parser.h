@@ -4,6 +4,24 @@
 #include "Declaration.h"
 #include "CompilationUnits.h"
 
+class Parser;
+
+// Token range of a function body that was skipped by a lazy parser, parsed
+// when the function is first referenced
+
+class DeferredBody
+{
+public:
+	Parser			*	mParser;
+	Declaration		*	mType;
+	int					mStart;
+	LinkerSection	*	mCodeSection, * mDataSection, * mBSSection;
+	const char		*	mCharMap;
+
+	void* operator new(size_t size);
+	void operator delete(void* ptr);
+};
+
 class Parser
 {
 public:
@@ -16,13 +34,20 @@ public:
 	
 	LinkerSection	* mCodeSection, * mDataSection, * mBSSection;
 
+	bool					mLazyBodies;
+
 	void Parse(void);
+
+	Expression* ParseDeferredFunction(Declaration* dec);
 protected:
 	bool ConsumeToken(Token token);
 	bool ConsumeTokenIf(Token token);
 
 	char			mCharMap[256];
 
+	PreludeUnit	*	mDeferredTokens;
+	Scanner		*	mDeferredScanner;
+	char		*	mDeferredCharMap;
 
 	void ParsePragma(void);
 
@@ -38,6 +63,7 @@ protected:
 	Declaration* ReverseDeclaration(Declaration* odec, Declaration* bdec);
 
 	Expression* ParseFunction(Declaration* dec);
+	DeferredBody* DeferFunction(Declaration* dec);
 	Expression* ParseAssembler(void);
 
 	Expression* ParseAssemblerBaseOperand(void);
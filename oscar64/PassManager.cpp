@@ -0,0 +1,274 @@
+#include "PassManager.h"
+#include "InterCode.h"
+#include <stdio.h>
+#include <string.h>
+
+struct PassInfo
+{
+	const char	*	mName;
+	bool			mOptional;
+};
+
+static const PassInfo PassInfos[NUM_OPTIMIZER_PASSES] = {
+	{ "traces",						false },
+	{ "value-forwarding",			false },
+	{ "constant-propagation",		false },
+	{ "temp-forwarding",			false },
+	{ "dead-code",					false },
+	{ "dead-local-stores",			true },
+	{ "dead-static-stores",			true },
+	{ "locals-to-temps",			true },
+	{ "rename-temps",				false },
+	{ "dominators",					false },
+	{ "interval-compare",			true },
+	{ "peephole",					true },
+	{ "single-block-loop",			true },
+	{ "single-path",				true },
+	{ "reduce-temps",				false },
+	{ "merge-blocks",				true },
+	{ "sparse-constant-propagation",	true },
+	{ "loop-invariant",				true },
+	{ "induction-variables",		true },
+	{ "value-range",				true },
+	{ "static-frames",				true },
+
+	{ "native-value-forwarding",	false },
+	{ "native-peephole",			true },
+	{ "native-simple-loop",			false },
+	{ "native-merge-blocks",		true },
+	{ "native-fast-params",			true },
+	{ "native-tail-join",			true },
+	{ "native-inner-loops",			true },
+	{ "native-register-xy",			true },
+	{ "native-entry-data",			true },
+	{ "native-block-size",			true },
+	{ "native-compress-temps",		false }
+};
+
+PassStatistics::PassStatistics(void)
+	: mRuns(0), mChanges(0), mNanoSeconds(0), mArenaBytes(0), mInstructionDelta(0)
+{
+}
+
+void PassStatistics::Add(const PassStatistics& stats)
+{
+	mRuns += stats.mRuns;
+	mChanges += stats.mChanges;
+	mNanoSeconds += stats.mNanoSeconds;
+	mArenaBytes += stats.mArenaBytes;
+	mInstructionDelta += stats.mInstructionDelta;
+}
+
+PassManager::PassManager(void)
+	: mStatistics(false), mBisectLimit(-1), mRunCount(0)
+{
+	for (int i = 0; i < NUM_OPTIMIZER_PASSES; i++)
+		mDisabled[i] = false;
+}
+
+PassManager::~PassManager(void)
+{
+}
+
+const char* PassManager::Name(OptimizerPass pass)
+{
+	return PassInfos[pass].mName;
+}
+
+bool PassManager::Optional(OptimizerPass pass)
+{
+	return PassInfos[pass].mOptional;
+}
+
+bool PassManager::Disable(const char* names)
+{
+	while (*names)
+	{
+		int	n = 0;
+		while (names[n] && names[n] != ',')
+			n++;
+
+		int	i = 0;
+		while (i < NUM_OPTIMIZER_PASSES && !(PassInfos[i].mOptional && strlen(PassInfos[i].mName) == n && !strncmp(PassInfos[i].mName, names, n)))
+			i++;
+
+		if (i == NUM_OPTIMIZER_PASSES)
+			return false;
+
+		mDisabled[i] = true;
+
+		names += n;
+		if (*names)
+			names++;
+	}
+
+	return true;
+}
+
+bool PassManager::Enabled(OptimizerPass pass, const char* proc)
+{
+	if (!PassInfos[pass].mOptional)
+		return true;
+	else if (mDisabled[pass])
+		return false;
+	else if (mBisectLimit >= 0)
+	{
+		int	run = ++mRunCount;
+		bool	enabled = run <= mBisectLimit;
+
+		printf("BISECT: %s pass (%d) %s on %s\n", enabled ? "running" : "NOT running", run, PassInfos[pass].mName, proc ? proc : "?");
+
+		return enabled;
+	}
+	else
+		return true;
+}
+
+bool PassManager::Unrestricted(void) const
+{
+	if (mBisectLimit >= 0)
+		return false;
+
+	for (int i = 0; i < NUM_OPTIMIZER_PASSES; i++)
+		if (mDisabled[i])
+			return false;
+
+	return true;
+}
+
+static const char* ProcedureName(const InterCodeProcedure* proc)
+{
+	return proc->mIdent ? proc->mIdent->mString : "?";
+}
+
+static int64 ProcedureTime(const InterCodeProcedure* proc)
+{
+	int64	t = 0;
+	if (proc->mPassStatistics)
+	{
+		for (int i = 0; i < NUM_OPTIMIZER_PASSES; i++)
+			t += proc->mPassStatistics[i].mNanoSeconds;
+	}
+	return t;
+}
+
+static void WriteStatisticsJSON(FILE* file, const char* name, const PassStatistics& stats)
+{
+	fprintf(file, "{\"name\": \"%s\", \"runs\": %d, \"changed\": %d, \"time_ms\": %.3f, \"arena_bytes\": %lld, \"instructions\": %lld}",
+		name, stats.mRuns, stats.mChanges, stats.mNanoSeconds * 1e-6, (long long)stats.mArenaBytes, (long long)stats.mInstructionDelta);
+}
+
+static void WriteStatisticsText(FILE* file, const char* name, const PassStatistics& stats)
+{
+	fprintf(file, "%-32s %8d %8d %10.3f %10lld %12lld\n",
+		name, stats.mRuns, stats.mChanges, stats.mNanoSeconds * 1e-6, (long long)(stats.mArenaBytes / 1024), (long long)stats.mInstructionDelta);
+}
+
+bool PassManager::WriteReport(const char* filename, InterCodeModule* mod)
+{
+	FILE* file = stdout;
+	if (filename && filename[0])
+	{
+		fopen_s(&file, filename, "w");
+		if (!file)
+			return false;
+	}
+
+	PassStatistics	total[NUM_OPTIMIZER_PASSES], sum;
+
+	for (int i = 0; i < mod->mProcedures.Size(); i++)
+	{
+		const InterCodeProcedure* proc = mod->mProcedures[i];
+		if (proc->mPassStatistics)
+		{
+			for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+				total[j].Add(proc->mPassStatistics[j]);
+		}
+	}
+
+	for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+		sum.Add(total[j]);
+
+	// Procedures by decreasing optimization time
+
+	GrowingArray<const InterCodeProcedure*>	procs(nullptr);
+	for (int i = 0; i < mod->mProcedures.Size(); i++)
+	{
+		const InterCodeProcedure* proc = mod->mProcedures[i];
+		if (proc->mPassStatistics)
+		{
+			int64	t = ProcedureTime(proc);
+			int	k = procs.Size();
+			procs.Push(proc);
+			while (k > 0 && ProcedureTime(procs[k - 1]) < t)
+			{
+				procs[k] = procs[k - 1];
+				k--;
+			}
+			procs[k] = proc;
+		}
+	}
+
+	int	n = (int)strlen(filename ? filename : "");
+	if (n > 5 && !strcmp(filename + n - 5, ".json"))
+	{
+		fprintf(file, "{\n  \"passes\": [\n");
+		for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+		{
+			fprintf(file, "    ");
+			WriteStatisticsJSON(file, PassInfos[j].mName, total[j]);
+			fprintf(file, "%s\n", j + 1 < NUM_OPTIMIZER_PASSES ? "," : "");
+		}
+		fprintf(file, "  ],\n  \"total\": ");
+		WriteStatisticsJSON(file, "total", sum);
+		fprintf(file, ",\n  \"procedures\": [\n");
+		for (int i = 0; i < procs.Size(); i++)
+		{
+			const InterCodeProcedure* proc = procs[i];
+			fprintf(file, "    {\"name\": \"%s\", \"time_ms\": %.3f, \"passes\": [", ProcedureName(proc), ProcedureTime(proc) * 1e-6);
+
+			bool	first = true;
+			for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+			{
+				if (proc->mPassStatistics[j].mRuns)
+				{
+					fprintf(file, "%s\n      ", first ? "" : ",");
+					WriteStatisticsJSON(file, PassInfos[j].mName, proc->mPassStatistics[j]);
+					first = false;
+				}
+			}
+			fprintf(file, "]}%s\n", i + 1 < procs.Size() ? "," : "");
+		}
+		fprintf(file, "  ]\n}\n");
+	}
+	else
+	{
+		fprintf(file, "%-32s %8s %8s %10s %10s %12s\n", "pass", "runs", "changed", "time ms", "arena KB", "instructions");
+		for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+			WriteStatisticsText(file, PassInfos[j].mName, total[j]);
+		WriteStatisticsText(file, "total", sum);
+
+		fprintf(file, "\n%-32s %8s %8s %10s %10s %12s  %s\n", "procedure", "runs", "changed", "time ms", "arena KB", "instructions", "slowest pass");
+		for (int i = 0; i < procs.Size(); i++)
+		{
+			const InterCodeProcedure* proc = procs[i];
+
+			PassStatistics	psum;
+			int				slowest = 0;
+			for (int j = 0; j < NUM_OPTIMIZER_PASSES; j++)
+			{
+				psum.Add(proc->mPassStatistics[j]);
+				if (proc->mPassStatistics[j].mNanoSeconds > proc->mPassStatistics[slowest].mNanoSeconds)
+					slowest = j;
+			}
+
+			fprintf(file, "%-32s %8d %8d %10.3f %10lld %12lld  %s\n",
+				ProcedureName(proc), psum.mRuns, psum.mChanges, psum.mNanoSeconds * 1e-6, (long long)(psum.mArenaBytes / 1024), (long long)psum.mInstructionDelta, PassInfos[slowest].mName);
+		}
+	}
+
+	if (file != stdout)
+		fclose(file);
+
+	return true;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "MachineTypes.h"
+#include "MemoryArena.h"
+#include <atomic>
+#include <chrono>
+
+class InterCodeModule;
+
+// Optimization passes of the intermediate and native code generation.  With
+// statistics enabled each run of a pass is timed and its arena memory and
+// instruction count change is collected per procedure.  Optional passes can
+// be disabled by name, and the number of optional pass runs can be limited
+// to bisect a pass that miscompiles or pessimizes a program.
+
+enum OptimizerPass
+{
+	OPASS_TRACES,
+	OPASS_VALUE_FORWARDING,
+	OPASS_CONSTANT_PROPAGATION,
+	OPASS_TEMP_FORWARDING,
+	OPASS_DEAD_CODE,
+	OPASS_DEAD_LOCAL_STORES,
+	OPASS_DEAD_STATIC_STORES,
+	OPASS_LOCALS_TO_TEMPS,
+	OPASS_RENAME_TEMPS,
+	OPASS_DOMINATORS,
+	OPASS_INTERVAL_COMPARE,
+	OPASS_PEEPHOLE,
+	OPASS_SINGLE_BLOCK_LOOP,
+	OPASS_SINGLE_PATH,
+	OPASS_REDUCE_TEMPS,
+	OPASS_MERGE_BLOCKS,
+	OPASS_SPARSE_CONSTANT_PROPAGATION,
+	OPASS_LOOP_INVARIANT,
+	OPASS_INDUCTION_VARIABLES,
+	OPASS_VALUE_RANGE,
+	OPASS_STATIC_FRAMES,
+
+	OPASS_NATIVE_VALUE_FORWARDING,
+	OPASS_NATIVE_PEEPHOLE,
+	OPASS_NATIVE_SIMPLE_LOOP,
+	OPASS_NATIVE_MERGE_BLOCKS,
+	OPASS_NATIVE_FAST_PARAMS,
+	OPASS_NATIVE_TAIL_JOIN,
+	OPASS_NATIVE_INNER_LOOPS,
+	OPASS_NATIVE_REGISTER_XY,
+	OPASS_NATIVE_ENTRY_DATA,
+	OPASS_NATIVE_BLOCK_SIZE,
+	OPASS_NATIVE_COMPRESS_TEMPS,
+
+	NUM_OPTIMIZER_PASSES
+};
+
+struct PassStatistics
+{
+	int			mRuns, mChanges;
+	int64		mNanoSeconds, mArenaBytes, mInstructionDelta;
+
+	PassStatistics(void);
+
+	void Add(const PassStatistics& stats);
+};
+
+// Measures a single run of a pass
+
+class PassRun
+{
+public:
+	PassRun(int instructions)
+		: mStart(std::chrono::steady_clock::now()), mArena(MemoryArena::Current()->Used()), mInstructions(instructions)
+	{}
+
+	void Finish(PassStatistics& stats, bool changed, int instructions)
+	{
+		stats.mRuns++;
+		if (changed)
+			stats.mChanges++;
+		stats.mNanoSeconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count();
+		stats.mArenaBytes += int64(MemoryArena::Current()->Used() - mArena);
+		stats.mInstructionDelta += instructions - mInstructions;
+	}
+
+protected:
+	std::chrono::steady_clock::time_point	mStart;
+	size_t									mArena;
+	int										mInstructions;
+};
+
+class PassManager
+{
+public:
+	PassManager(void);
+	~PassManager(void);
+
+	bool	mStatistics;
+	int		mBisectLimit;
+
+	static const char* Name(OptimizerPass pass);
+	static bool Optional(OptimizerPass pass);
+
+	// Disable a comma separated list of passes, false for an unknown name
+
+	bool Disable(const char* names);
+
+	// Check if the pass runs on the procedure, counts the runs of the optional
+	// passes for bisecting
+
+	bool Enabled(OptimizerPass pass, const char* proc);
+
+	// No pass disabled and no bisecting
+
+	bool Unrestricted(void) const;
+
+	// Report in JSON when the file name ends with .json, to stdout without name
+
+	bool WriteReport(const char* filename, InterCodeModule* mod);
+
+protected:
+	bool				mDisabled[NUM_OPTIMIZER_PASSES];
+	std::atomic<int>	mRunCount;
+};
@@ -0,0 +1,575 @@
+#include "Prelude.h"
+#include <sys/stat.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+
+static const char PreludeMagic[] = "oscar64 prelude 2";
+
+// Token streams of different defines or include paths are kept side by side
+// in one file, up to this number of keys
+
+static const int PreludeKeyLimit = 8;
+
+// Tokens are stored field by field in 32 bit words, the number in two
+
+static const int PreludeTokenWords = 9;
+
+static bool FileStamp(const char* name, int64& size, int64& time)
+{
+	struct stat	st;
+	if (stat(name, &st) == 0)
+	{
+		size = st.st_size;
+		time = st.st_mtime;
+		return true;
+	}
+	else
+		return false;
+}
+
+static void WriteInt(FILE* file, int64 i)
+{
+	fwrite(&i, sizeof(i), 1, file);
+}
+
+static void WriteString(FILE* file, const char* str)
+{
+	int	n = (int)strlen(str);
+	WriteInt(file, n);
+	fwrite(str, 1, n, file);
+}
+
+static bool ReadInt(FILE* file, int64& i)
+{
+	return fread(&i, sizeof(i), 1, file) == 1;
+}
+
+static bool ReadInt(FILE* file, int& i)
+{
+	int64	l;
+	if (ReadInt(file, l) && l >= INT_MIN && l <= INT_MAX)
+	{
+		i = int(l);
+		return true;
+	}
+	else
+		return false;
+}
+
+static char* CopyString(const char* str)
+{
+	int	n = (int)strlen(str);
+	char* nstr = new char[n + 1];
+	memcpy(nstr, str, n + 1);
+	return nstr;
+}
+
+static char* ReadString(FILE* file)
+{
+	int	n;
+	if (ReadInt(file, n) && n >= 0 && n < 65536)
+	{
+		char* str = new char[n + 1];
+		if (fread(str, 1, n, file) == size_t(n))
+		{
+			str[n] = 0;
+			return str;
+		}
+		delete[] str;
+	}
+
+	return nullptr;
+}
+
+PreludeUnit::PreludeUnit(const char* filename)
+	: mFiles({ nullptr, 0, 0 }), mIdents(nullptr), mStrings(nullptr), mTokens(PreludeToken()),
+	  mPosition(0), mLastFile(-1), mLastName(nullptr), mLastString(nullptr), mIdentHash(nullptr), mIdentIndex(nullptr), mIdentHashSize(0)
+{
+	strcpy_s(mFileName, filename);
+}
+
+PreludeUnit::~PreludeUnit(void)
+{
+	for (int i = 0; i < mFiles.Size(); i++)
+		delete[] mFiles[i].mName;
+	for (int i = 0; i < mStrings.Size(); i++)
+		delete[] mStrings[i];
+	delete[] mIdentHash;
+	delete[] mIdentIndex;
+}
+
+int PreludeUnit::FileIndex(const char* name)
+{
+	if (!name)
+		return -1;
+	else if (name == mLastName)
+		return mLastFile;
+
+	int	i = 0;
+	while (i < mFiles.Size() && strcmp(mFiles[i].mName, name))
+		i++;
+
+	if (i == mFiles.Size())
+	{
+		PreludeFile	pf;
+		pf.mName = CopyString(name);
+		pf.mSize = 0;
+		pf.mTime = 0;
+		mFiles.Push(pf);
+	}
+
+	mLastName = name;
+	mLastFile = i;
+
+	return i;
+}
+
+int PreludeUnit::IdentIndex(const Ident* ident)
+{
+	if (!ident)
+		return -1;
+
+	if (2 * mIdents.Size() >= mIdentHashSize)
+	{
+		delete[] mIdentHash;
+		delete[] mIdentIndex;
+
+		mIdentHashSize = mIdentHashSize ? 2 * mIdentHashSize : 1024;
+		mIdentHash = new const Ident * [mIdentHashSize];
+		mIdentIndex = new int[mIdentHashSize];
+		for (int i = 0; i < mIdentHashSize; i++)
+			mIdentHash[i] = nullptr;
+
+		for (int i = 0; i < mIdents.Size(); i++)
+		{
+			int	h = mIdents[i]->mHash & (mIdentHashSize - 1);
+			while (mIdentHash[h])
+				h = (h + 1) & (mIdentHashSize - 1);
+			mIdentHash[h] = mIdents[i];
+			mIdentIndex[h] = i;
+		}
+	}
+
+	int	h = ident->mHash & (mIdentHashSize - 1);
+	while (mIdentHash[h])
+	{
+		if (mIdentHash[h] == ident)
+			return mIdentIndex[h];
+		h = (h + 1) & (mIdentHashSize - 1);
+	}
+
+	mIdentHash[h] = ident;
+	mIdentIndex[h] = mIdents.Size();
+	mIdents.Push(ident);
+
+	return mIdentIndex[h];
+}
+
+void PreludeUnit::Record(const Scanner* scanner)
+{
+	PreludeToken	t;
+
+	t.mToken = scanner->mToken;
+	t.mFile = FileIndex(scanner->mLocation.mFileName);
+	t.mLine = scanner->mLocation.mLine;
+	t.mColumn = scanner->mLocation.mColumn;
+	t.mIdent = IdentIndex(scanner->mTokenIdent);
+	t.mInteger = scanner->mTokenInteger;
+	t.mNumber = scanner->mTokenNumber;
+
+	// The token string is only stored when it changes
+
+	if (!mLastString || strcmp(mLastString, scanner->mTokenString))
+	{
+		mLastString = CopyString(scanner->mTokenString);
+		t.mString = mStrings.Size();
+		mStrings.Push(mLastString);
+	}
+	else
+		t.mString = -1;
+
+	mTokens.Push(t);
+}
+
+void PreludeUnit::Rewind(void)
+{
+	mPosition = 0;
+}
+
+void PreludeUnit::Seek(int position)
+{
+	mPosition = position;
+}
+
+int PreludeUnit::Mark(void)
+{
+	// A replay can start here, so the next token may not rely on the string
+	// of the token recorded before
+
+	mLastString = nullptr;
+	return mTokens.Size();
+}
+
+void PreludeUnit::Replay(Scanner* scanner)
+{
+	const PreludeToken& t(mTokens[mPosition]);
+
+	// Stay at the end of file token
+
+	if (mPosition + 1 < mTokens.Size())
+		mPosition++;
+
+	scanner->mToken = t.mToken;
+	scanner->mLocation.mFileName = t.mFile >= 0 ? mFiles[t.mFile].mName : nullptr;
+	scanner->mLocation.mLine = t.mLine;
+	scanner->mLocation.mColumn = t.mColumn;
+	scanner->mTokenIdent = t.mIdent >= 0 ? mIdents[t.mIdent] : nullptr;
+	scanner->mTokenInteger = t.mInteger;
+	scanner->mTokenNumber = t.mNumber;
+	if (t.mString >= 0)
+		strcpy_s(scanner->mTokenString, mStrings[t.mString]);
+}
+
+void PreludeUnit::AddFiles(const SourceFile* sources, const SourceFile* last)
+{
+	for (const SourceFile* source = sources; source != last; source = source->mNext)
+		FileIndex(source->mFileName);
+
+	for (int i = 0; i < mFiles.Size(); i++)
+		FileStamp(mFiles[i].mName, mFiles[i].mSize, mFiles[i].mTime);
+}
+
+bool PreludeUnit::Valid(void) const
+{
+	for (int i = 0; i < mFiles.Size(); i++)
+	{
+		int64	size, time;
+		if (!FileStamp(mFiles[i].mName, size, time) || size != mFiles[i].mSize || time != mFiles[i].mTime)
+			return false;
+	}
+
+	return mTokens.Size() > 0;
+}
+
+void PreludeUnit::Write(FILE* file)
+{
+	WriteString(file, mFileName);
+
+	WriteInt(file, mFiles.Size());
+	for (int i = 0; i < mFiles.Size(); i++)
+	{
+		WriteString(file, mFiles[i].mName);
+		WriteInt(file, mFiles[i].mSize);
+		WriteInt(file, mFiles[i].mTime);
+	}
+
+	WriteInt(file, mIdents.Size());
+	for (int i = 0; i < mIdents.Size(); i++)
+		WriteString(file, mIdents[i]->mString);
+
+	WriteInt(file, mStrings.Size());
+	for (int i = 0; i < mStrings.Size(); i++)
+		WriteString(file, mStrings[i]);
+
+	WriteInt(file, mTokens.Size());
+	if (mTokens.Size() > 0)
+	{
+		int* words = new int[mTokens.Size() * PreludeTokenWords];
+
+		for (int i = 0; i < mTokens.Size(); i++)
+		{
+			const PreludeToken& t(mTokens[i]);
+			int* w = words + i * PreludeTokenWords;
+
+			w[0] = t.mToken;
+			w[1] = t.mFile;
+			w[2] = t.mLine;
+			w[3] = t.mColumn;
+			w[4] = t.mIdent;
+			w[5] = t.mString;
+			w[6] = int(t.mInteger);
+			memcpy(w + 7, &t.mNumber, sizeof(t.mNumber));
+		}
+
+		fwrite(words, sizeof(int) * PreludeTokenWords, mTokens.Size(), file);
+		delete[] words;
+	}
+}
+
+bool PreludeUnit::Read(FILE* file)
+{
+	int	n;
+
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	for (int i = 0; i < n; i++)
+	{
+		PreludeFile	pf;
+		if (!(pf.mName = ReadString(file)) || !ReadInt(file, pf.mSize) || !ReadInt(file, pf.mTime))
+			return false;
+		mFiles.Push(pf);
+	}
+
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	for (int i = 0; i < n; i++)
+	{
+		char* str = ReadString(file);
+		if (!str)
+			return false;
+		mIdents.Push(Ident::Unique(str));
+		delete[] str;
+	}
+
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	for (int i = 0; i < n; i++)
+	{
+		char* str = ReadString(file);
+		if (!str || strlen(str) >= 1024)
+			return false;
+		mStrings.Push(str);
+	}
+
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+	if (n > 0)
+	{
+		int* words = new int[n * PreludeTokenWords];
+		bool	ok = fread(words, sizeof(int) * PreludeTokenWords, n, file) == size_t(n);
+
+		mTokens.SetSize(n);
+		for (int i = 0; ok && i < n; i++)
+		{
+			PreludeToken& t(mTokens[i]);
+			const int* w = words + i * PreludeTokenWords;
+
+			if (w[0] < 0 || w[0] >= NUM_TOKENS || w[1] >= mFiles.Size() || w[4] >= mIdents.Size() || w[5] >= mStrings.Size())
+				ok = false;
+			else
+			{
+				t.mToken = Token(w[0]);
+				t.mFile = w[1];
+				t.mLine = w[2];
+				t.mColumn = w[3];
+				t.mIdent = w[4];
+				t.mString = w[5];
+				t.mInteger = (unsigned int)w[6];
+				memcpy(&t.mNumber, w + 7, sizeof(t.mNumber));
+			}
+		}
+
+		delete[] words;
+
+		if (!ok)
+			return false;
+	}
+
+	return true;
+}
+
+Prelude::Prelude(void)
+	: mChanged(false), mKey(nullptr), mUnits(nullptr), mOthers({ nullptr, nullptr, 0 })
+{
+}
+
+Prelude::~Prelude(void)
+{
+	for (int i = 0; i < mUnits.Size(); i++)
+		delete mUnits[i];
+	for (int i = 0; i < mOthers.Size(); i++)
+	{
+		delete[] mOthers[i].mKey;
+		delete[] mOthers[i].mData;
+	}
+	delete[] mKey;
+}
+
+bool Prelude::ReadUnits(FILE* file)
+{
+	int	n;
+	if (!ReadInt(file, n) || n < 0)
+		return false;
+
+	for (int i = 0; i < n; i++)
+	{
+		char* name = ReadString(file);
+		if (!name)
+			return false;
+
+		PreludeUnit* unit = new PreludeUnit(name);
+		delete[] name;
+
+		if (!unit->Read(file))
+		{
+			delete unit;
+			return false;
+		}
+		mUnits.Push(unit);
+	}
+
+	return true;
+}
+
+bool Prelude::Read(const char* filename, const char* key)
+{
+	mKey = CopyString(key);
+
+	if (!filename)
+		return false;
+
+	FILE* file;
+	fopen_s(&file, filename, "rb");
+	if (!file)
+		return false;
+
+	// Each key has its own units, a different compiler version, defines or
+	// include paths do not invalidate the units of the other keys
+
+	bool	ok = false, found = false;
+	char* magic = ReadString(file);
+	int		n;
+
+	if (magic && !strcmp(magic, PreludeMagic) && ReadInt(file, n) && n >= 0)
+	{
+		ok = true;
+		for (int i = 0; ok && i < n; i++)
+		{
+			PreludeKeySet	set;
+			set.mKey = ReadString(file);
+			set.mData = nullptr;
+
+			if (set.mKey && ReadInt(file, set.mSize) && set.mSize >= 0)
+			{
+				if (!found && !strcmp(set.mKey, mKey))
+				{
+					long	start = ftell(file);
+					ok = ReadUnits(file) && ftell(file) == start + set.mSize;
+					found = ok;
+				}
+				else
+				{
+					set.mData = new char[set.mSize];
+					if (fread(set.mData, 1, set.mSize, file) == size_t(set.mSize))
+					{
+						mOthers.Push(set);
+						set.mKey = nullptr;
+						set.mData = nullptr;
+					}
+					else
+						ok = false;
+				}
+			}
+			else
+				ok = false;
+
+			delete[] set.mKey;
+			delete[] set.mData;
+		}
+	}
+
+	delete[] magic;
+
+	fclose(file);
+
+	if (!ok)
+	{
+		for (int i = 0; i < mUnits.Size(); i++)
+			delete mUnits[i];
+		mUnits.SetSize(0);
+
+		for (int i = 0; i < mOthers.Size(); i++)
+		{
+			delete[] mOthers[i].mKey;
+			delete[] mOthers[i].mData;
+		}
+		mOthers.SetSize(0);
+	}
+
+	return found;
+}
+
+bool Prelude::HasKey(const char* key) const
+{
+	return mKey && !strcmp(mKey, key);
+}
+
+bool Prelude::Write(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (!file)
+		return false;
+
+	// The current key goes first, the least recently written keys are dropped
+
+	int	n = mOthers.Size() < PreludeKeyLimit - 1 ? mOthers.Size() : PreludeKeyLimit - 1;
+
+	WriteString(file, PreludeMagic);
+	WriteInt(file, n + 1);
+
+	WriteString(file, mKey ? mKey : "");
+
+	long	start = ftell(file);
+	WriteInt(file, 0);
+
+	WriteInt(file, mUnits.Size());
+	for (int i = 0; i < mUnits.Size(); i++)
+		mUnits[i]->Write(file);
+
+	long	end = ftell(file);
+	fseek(file, start, SEEK_SET);
+	WriteInt(file, end - start - 8);
+	fseek(file, end, SEEK_SET);
+
+	for (int i = 0; i < n; i++)
+	{
+		WriteString(file, mOthers[i].mKey);
+		WriteInt(file, mOthers[i].mSize);
+		fwrite(mOthers[i].mData, 1, mOthers[i].mSize, file);
+	}
+
+	bool	ok = !ferror(file);
+	fclose(file);
+
+	mChanged = false;
+
+	return ok;
+}
+
+PreludeUnit* Prelude::Find(const char* filename)
+{
+	for (int i = 0; i < mUnits.Size(); i++)
+	{
+		if (!strcmp(mUnits[i]->mFileName, filename))
+		{
+			if (mUnits[i]->Valid())
+			{
+				mUnits[i]->Rewind();
+				return mUnits[i];
+			}
+			else
+				return nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+PreludeUnit* Prelude::Add(const char* filename)
+{
+	PreludeUnit* unit = new PreludeUnit(filename);
+
+	int	i = 0;
+	while (i < mUnits.Size() && strcmp(mUnits[i]->mFileName, filename))
+		i++;
+
+	if (i < mUnits.Size())
+		delete mUnits[i];
+	mUnits[i] = unit;
+
+	mChanged = true;
+
+	return unit;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Scanner.h"
+#include "Array.h"
+#include "MachineTypes.h"
+
+// Precompiled prelude, the preprocessed token streams of the runtime and
+// library compilation units.  A unit whose source and header files did not
+// change is replayed into the parser, skipping file reading, preprocessing
+// and scanning.
+
+struct PreludeToken
+{
+	Token			mToken;
+	int				mFile, mLine, mColumn;
+	int				mIdent, mString;
+	unsigned int	mInteger;
+	double			mNumber;
+};
+
+struct PreludeFile
+{
+	const char	*	mName;
+	int64			mSize, mTime;
+};
+
+class PreludeUnit
+{
+public:
+	PreludeUnit(const char* filename);
+	~PreludeUnit(void);
+
+	char							mFileName[200];
+	GrowingArray<PreludeFile>		mFiles;
+	GrowingArray<const Ident*>		mIdents;
+	GrowingArray<const char*>		mStrings;
+	GrowingArray<PreludeToken>		mTokens;
+
+	void Record(const Scanner* scanner);
+	void Replay(Scanner* scanner);
+	void Rewind(void);
+	void Seek(int position);
+
+	// Position of the next recorded token for a later seek
+
+	int Mark(void);
+
+	// Add the files opened for the unit and take their time stamps
+
+	void AddFiles(const SourceFile* sources, const SourceFile* last);
+	bool Valid(void) const;
+
+	bool Read(FILE* file);
+	void Write(FILE* file);
+protected:
+	int				mPosition, mLastFile;
+	const char	*	mLastName, * mLastString;
+	const Ident	**	mIdentHash;
+	int			*	mIdentIndex;
+	int				mIdentHashSize;
+
+	int FileIndex(const char* name);
+	int IdentIndex(const Ident* ident);
+};
+
+class Prelude
+{
+public:
+	Prelude(void);
+	~Prelude(void);
+
+	bool	mChanged;
+
+	// Read the units of a file built with the same key, without a file name
+	// the prelude starts empty and is only kept in memory.  The units of
+	// other keys are kept unchanged for the next write.
+
+	bool Read(const char* filename, const char* key);
+	bool HasKey(const char* key) const;
+	bool Write(const char* filename);
+
+	// Unit with unchanged sources, or nullptr
+
+	PreludeUnit* Find(const char* filename);
+
+	// Start recording a unit, replacing an outdated one
+
+	PreludeUnit* Add(const char* filename);
+protected:
+	struct PreludeKeySet
+	{
+		char	*	mKey, * mData;
+		int			mSize;
+	};
+
+	char						*	mKey;
+	GrowingArray<PreludeUnit*>		mUnits;
+	GrowingArray<PreludeKeySet>		mOthers;
+
+	bool ReadUnits(FILE* file);
+};
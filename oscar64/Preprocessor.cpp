@@ -19,30 +19,97 @@ SourcePath::~SourcePath(void)
 
 }
 
-bool SourceFile::ReadLine(char* line)
+SourceBuffer::SourceBuffer(void)
+	: mFileName{ 0 }, mBinary(false), mData(nullptr), mSize(0), mNext(nullptr)
 {
-	if (mFile)
+
+}
+
+SourceBuffer::~SourceBuffer(void)
+{
+	delete[] mData;
+}
+
+bool SourceBuffer::Read(FILE* file)
+{
+	fseek(file, 0, SEEK_END);
+	long	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	if (size < 0 || size >= 0x10000000)
+		return false;
+
+	char* data = new char[size + 1];
+	if (fread(data, 1, size, file) != size_t(size))
 	{
-		if (mBinary)
+		delete[] data;
+		return false;
+	}
+
+	if (mBinary)
+	{
+		mData = data;
+		mSize = size;
+		return true;
+	}
+
+	// Terminate each line with a zero byte after its line feed, carriage
+	// returns before a line feed are dropped
+
+	int	lines = 1;
+	for (long i = 0; i < size; i++)
+		if (data[i] == '\n')
+			lines++;
+
+	mData = new char[size + lines + 1];
+
+	int	n = 0;
+	for (long i = 0; i < size; i++)
+	{
+		char	c = data[i];
+		if (c == '\n')
 		{
-			if (mLimit)
-				mLimit--;
+			mData[n++] = c;
+			mData[n++] = 0;
+		}
+		else if (c != '\r' || i + 1 == size || data[i + 1] != '\n')
+			mData[n++] = c;
+	}
+
+	if (n > 0 && mData[n - 1] != 0)
+		mData[n++] = 0;
 
-			int c = fgetc(mFile);
-			if (c >= 0)
+	mSize = n;
+
+	delete[] data;
+
+	return true;
+}
+
+bool SourceFile::ReadLine(const char*& line, int& size)
+{
+	if (mBuffer)
+	{
+		if (mBinary)
+		{
+			if (mLimit > 0 && mPos < mBuffer->mSize)
 			{
-				sprintf_s(line, 1024, "0x%02x, ", c);
+				mLimit--;
+				sprintf_s(mByte, 8, "0x%02x, ", (uint8)mBuffer->mData[mPos++]);
+				line = mByte;
+				size = 6;
 				return true;
 			}
 		}
-		else
+		else if (mPos < mBuffer->mSize)
 		{
-			if (fgets(line, 1024, mFile))
-				return true;
+			line = mBuffer->mData + mPos;
+			size = int(strlen(line));
+			mPos += size + 1;
+			return true;
 		}
 
-		fclose(mFile);
-		mFile = nullptr;
+		mBuffer = nullptr;
 	}
 
 	return false;
@@ -51,26 +118,21 @@ bool SourceFile::ReadLine(char* line)
 void SourceFile::Limit(int skip, int limit)
 {
 	mLimit = limit;
-	if (mFile)
-		fseek(mFile, skip, SEEK_SET);
+	if (mBuffer)
+		mPos = skip < mBuffer->mSize ? skip : mBuffer->mSize;
 }
 
 SourceFile::SourceFile(void) 
-	: mFile(nullptr), mFileName{ 0 }, mStack(nullptr)
+	: mFileName{ 0 }, mStack(nullptr), mUp(nullptr), mNext(nullptr), mBuffer(nullptr), mPos(0)
 {
 
 }
 
 SourceFile::~SourceFile(void)
 {
-	if (mFile)
-	{
-		fclose(mFile);
-		mFile = nullptr;
-	}
 }
 
-bool SourceFile::Open(const char* name, const char* path, bool binary)
+bool SourceFile::Open(const char* name, const char* path, SourceBuffer*& buffers, bool binary)
 {
 	char	fname[220];
 
@@ -88,32 +150,57 @@ bool SourceFile::Open(const char* name, const char* path, bool binary)
 
 	strcat_s(fname + n, sizeof(fname) - n, name);
 
-	if (!fopen_s(&mFile, fname, binary ? "rb" : "r"))
+	if (!_fullpath(mFileName, fname, sizeof(mFileName)))
+		return false;
+
+	char* p = mFileName;
+	while (*p)
+	{
+		if (*p == '\\')
+			*p = '/';
+		p++;
+	}
+
+	// Files that were included before are not read again
+
+	SourceBuffer* buffer = buffers;
+	while (buffer && (buffer->mBinary != binary || strcmp(buffer->mFileName, mFileName)))
+		buffer = buffer->mNext;
+
+	if (!buffer)
 	{
-		_fullpath(mFileName, fname, sizeof(mFileName));
-		char* p = mFileName;
-		while (*p)
+		FILE* file;
+		if (fopen_s(&file, fname, "rb"))
+			return false;
+
+		buffer = new SourceBuffer();
+		strcpy_s(buffer->mFileName, mFileName);
+		buffer->mBinary = binary;
+
+		bool	ok = buffer->Read(file);
+		fclose(file);
+
+		if (!ok)
 		{
-			if (*p == '\\')
-				*p = '/';
-			p++;
+			delete buffer;
+			return false;
 		}
-		mBinary = binary;
-		mLimit = 0x10000;
 
-		return true;
+		buffer->mNext = buffers;
+		buffers = buffer;
 	}
 
-	return false;
+	mBuffer = buffer;
+	mPos = 0;
+	mBinary = binary;
+	mLimit = 0x10000;
+
+	return true;
 }
 
 void SourceFile::Close(void)
 {
-	if (mFile)
-	{
-		fclose(mFile);
-		mFile = nullptr;
-	}
+	mBuffer = nullptr;
 }
 
 bool SourceFile::PushSource(void)
@@ -121,7 +208,7 @@ bool SourceFile::PushSource(void)
 	SourceStack* stack = new SourceStack();
 	stack->mUp = mStack;
 	mStack = stack;
-	stack->mFilePos = ftell(mFile);
+	stack->mFilePos = mPos;
 	return true;
 }
 
@@ -130,7 +217,7 @@ bool SourceFile::PopSource(void)
 	SourceStack* stack = mStack;
 	if (stack)
 	{
-		fseek(mFile, stack->mFilePos, SEEK_SET);
+		mPos = stack->mFilePos;
 		mStack = mStack->mUp;
 		return true;
 	}
@@ -152,41 +239,71 @@ bool SourceFile::DropSource(void)
 
 bool Preprocessor::NextLine(void)
 {
-	int	s = 0;
-	while (mSource->ReadLine(mLine + s))
-	{
-		mLocation.mLine++;
+	const char* line;
+	int			size;
 
-		s = strlen(mLine);
-		while (s > 0 && mLine[s - 1] == '\n')
-			s--;
-		if (s == 0 || mLine[s - 1] != '\\')
-			return true;
+	if (!mSource->ReadLine(line, size))
+		return false;
+
+	mLocation.mLine++;
+
+	int	s = size;
+	while (s > 0 && line[s - 1] == '\n')
 		s--;
+	if (s == 0 || line[s - 1] != '\\')
+	{
+		mLine = line;
+		return true;
 	}
 
-	return false;
-}
+	// Join continued lines in the line buffer
 
-bool Preprocessor::EmbedData(const char* reason, const char* name, bool local, int skip, int limit)
-{
-	if (strlen(name) > 200)
+	int	n = 0;
+	for (;;)
 	{
-		mErrors->Error(mLocation, EERR_FILE_NOT_FOUND, "Binary file path exceeds max path length");
-		return false;
+		if (s == 0 || line[s - 1] != '\\')
+			s = size;
+		else
+			s--;
+
+		if (n + s + 1 > mLineBufferSize)
+		{
+			int		bsize = 2 * (n + s + 1);
+			char* buffer = new char[bsize];
+			if (n > 0)
+				memcpy(buffer, mLineBuffer, n);
+			delete[] mLineBuffer;
+			mLineBuffer = buffer;
+			mLineBufferSize = bsize;
+		}
+
+		memcpy(mLineBuffer + n, line, s);
+		n += s;
+
+		if (s == size || !mSource->ReadLine(line, size))
+			break;
+
+		mLocation.mLine++;
+
+		s = size;
+		while (s > 0 && line[s - 1] == '\n')
+			s--;
 	}
 
-	if (mSource)
-		mSource->mLocation = mLocation;
+	mLineBuffer[n] = 0;
+	mLine = mLineBuffer;
 
-	SourceFile* source = new SourceFile();
+	return true;
+}
 
-	bool	ok = false;
+SourceFile* Preprocessor::FindSource(const char* name, bool local, bool binary)
+{
+	SourceFile* source = new SourceFile();
 
-	if (source->Open(name, "", true))
-		ok = true;
+	if (source->Open(name, "", mBuffers, binary))
+		return source;
 
-	if (!ok && local && mSource)
+	if (local && mSource)
 	{
 		char	lpath[220];
 		strcpy_s(lpath, mSource->mFileName);
@@ -195,38 +312,51 @@ bool Preprocessor::EmbedData(const char* reason, const char* name, bool local, i
 			i--;
 		lpath[i] = 0;
 
-		if (source->Open(name, lpath, true))
-			ok = true;
+		if (source->Open(name, lpath, mBuffers, binary))
+			return source;
 	}
 
-	SourcePath* p = mPaths;
-	while (!ok && p)
+	for (SourcePath* p = mPaths; p; p = p->mNext)
 	{
-		if (source->Open(name, p->mPathName, true))
-			ok = true;
-		else
-			p = p->mNext;
+		if (source->Open(name, p->mPathName, mBuffers, binary))
+			return source;
+	}
+
+	delete source;
+	return nullptr;
+}
+
+bool Preprocessor::EmbedData(const char* reason, const char* name, bool local, int skip, int limit)
+{
+	if (strlen(name) > 200)
+	{
+		mErrors->Error(mLocation, EERR_FILE_NOT_FOUND, "Binary file path exceeds max path length");
+		return false;
 	}
 
-	if (ok)
+	if (mSource)
+		mSource->mLocation = mLocation;
+
+	SourceFile* source = FindSource(name, local, true);
+
+	if (source)
 	{
 		printf("%s \"%s\"\n", reason, source->mFileName);
 
 		source->Limit(skip, limit);
 
 		source->mUp = mSource;
+		source->mNext = mSourceList;
+		mSourceList = source;
 		mSource = source;
 		mLocation.mFileName = mSource->mFileName;
 		mLocation.mLine = 0;
-		mLine[0] = 0;
+		mLine = "";
 
 		return true;
 	}
 	else
-	{
-		delete source;
 		return false;
-	}
 }
 
 bool Preprocessor::OpenSource(const char * reason, const char* name, bool local)
@@ -240,43 +370,18 @@ bool Preprocessor::OpenSource(const char * reason, const char* name, bool local)
 	if (mSource)
 		mSource->mLocation = mLocation;
 
-	SourceFile	*	source = new SourceFile();
-
-	bool	ok = false;
-
-	if (source->Open(name, ""))
-		ok = true;
-
-	if (!ok && local && mSource)
-	{
-		char	lpath[220];
-		strcpy_s(lpath, mSource->mFileName);
-		int	i = strlen(lpath);
-		while (i > 0 && lpath[i - 1] != '/')
-			i--;
-		lpath[i] = 0;
-
-		if (source->Open(name, lpath))
-			ok = true;
-	}
+	SourceFile* source = FindSource(name, local, false);
 
-	SourcePath* p = mPaths;
-	while (!ok && p)
-	{
-		if (source->Open(name, p->mPathName))
-			ok = true;
-		else
-			p = p->mNext;
-	}
-	
-	if (ok)
+	if (source)
 	{
 		printf("%s \"%s\"\n", reason, source->mFileName);
 		source->mUp = mSource;
+		source->mNext = mSourceList;
+		mSourceList = source;
 		mSource = source;
 		mLocation.mFileName = mSource->mFileName;
 		mLocation.mLine = 0;
-		mLine[0] = 0;
+		mLine = "";
 
 		return true;
 	}
@@ -292,7 +397,7 @@ bool Preprocessor::CloseSource(void)
 		if (mSource)
 		{
 			mLocation = mSource->mLocation;
-			mLine[0] = 0;
+			mLine = "";
 			return true;
 		}
 	}
@@ -318,13 +423,32 @@ bool Preprocessor::DropSource(void)
 }
 
 Preprocessor::Preprocessor(Errors* errors)
-	: mSource(nullptr), mSourceList(nullptr), mPaths(nullptr), mErrors(errors)
+	: mLine(""), mSource(nullptr), mSourceList(nullptr), mPaths(nullptr), mBuffers(nullptr), mErrors(errors), mLineBuffer(nullptr), mLineBufferSize(0)
 {
 
 }
 
 Preprocessor::~Preprocessor(void)
 {
+	while (mSourceList)
+	{
+		SourceFile* source = mSourceList;
+		mSourceList = source->mNext;
+		delete source;
+	}
+	while (mPaths)
+	{
+		SourcePath* path = mPaths;
+		mPaths = path->mNext;
+		delete path;
+	}
+	while (mBuffers)
+	{
+		SourceBuffer* buffer = mBuffers;
+		mBuffers = buffer->mNext;
+		delete buffer;
+	}
+	delete[] mLineBuffer;
 }
 
 void Preprocessor::AddPath(const char* path)
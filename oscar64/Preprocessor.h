@@ -13,6 +13,26 @@ public:
 	Location		mLocation;
 };
 
+// Contents of a source file, read once and shared by all includes of the file.
+// Text files are split into lines, each terminated by a zero byte, so the
+// scanner can work on the lines in place.
+
+class SourceBuffer
+{
+public:
+	char			mFileName[MAXPATHLEN];
+	bool			mBinary;
+	char		*	mData;
+	int				mSize;
+
+	SourceBuffer	*	mNext;
+
+	SourceBuffer(void);
+	~SourceBuffer(void);
+
+	bool Read(FILE* file);
+};
+
 class SourceFile
 {
 public:
@@ -24,12 +44,12 @@ public:
 	bool			mBinary;
 	int				mLimit;
 
-	bool ReadLine(char* line);
+	bool ReadLine(const char*& line, int& size);
 
 	SourceFile(void);
 	~SourceFile(void);
 
-	bool Open(const char* name, const char * path, bool binary = false);
+	bool Open(const char* name, const char * path, SourceBuffer*& buffers, bool binary = false);
 	void Close(void);
 
 	void Limit(int skip, int limit);
@@ -39,7 +59,9 @@ public:
 	bool DropSource(void);
 
 protected:
-	FILE* mFile;
+	SourceBuffer	*	mBuffer;
+	int					mPos;
+	char				mByte[8];
 };
 
 class SourcePath
@@ -56,13 +78,14 @@ public:
 class Preprocessor
 {
 public:
-	char		mLine[32768];
+	const char*	mLine;
 
 	Location	mLocation;
 	Errors* mErrors;
 
 	SourceFile* mSource, * mSourceList;
 	SourcePath* mPaths;
+	SourceBuffer* mBuffers;
 
 	void AddPath(const char* path);
 	bool NextLine(void);
@@ -78,4 +101,9 @@ public:
 
 	Preprocessor(Errors * errors);
 	~Preprocessor(void);
+protected:
+	char	*	mLineBuffer;
+	int			mLineBufferSize;
+
+	SourceFile* FindSource(const char* name, bool local, bool binary);
 };
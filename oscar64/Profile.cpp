@@ -0,0 +1,253 @@
+#include "Profile.h"
+#include "Emulator.h"
+
+Profile::Profile(Errors* errors)
+	: mTotalCycles(0), mErrors(errors), mFunctions({ nullptr, 0 })
+{
+
+}
+
+Profile::~Profile(void)
+{
+
+}
+
+bool Profile::Write(const char* filename, Linker* linker, const int* cycles)
+{
+	FILE* file;
+	fopen_s(&file, filename, "w");
+	if (file)
+	{
+		mTotalCycles = 0;
+		for (int i = 0; i < 0x10000; i++)
+			mTotalCycles += cycles[i];
+
+		fprintf(file, "oscar64 profile\n");
+		fprintf(file, "total %lld\n", (long long)mTotalCycles);
+
+		for (int i = 0; i < linker->mObjects.Size(); i++)
+		{
+			LinkerObject* lobj = linker->mObjects[i];
+			if (lobj->mProc && lobj->mIdent && (lobj->mFlags & LOBJF_PLACED) && (lobj->mType == LOT_NATIVE_CODE || lobj->mType == LOT_BYTE_CODE))
+			{
+				int64	fcycles = 0;
+				for (int j = 0; j < lobj->mSize; j++)
+					fcycles += cycles[lobj->mAddress + j];
+
+				fprintf(file, "function %s %lld %d %s\n", lobj->mIdent->mString, (long long)fcycles, lobj->mSize, lobj->mType == LOT_NATIVE_CODE ? "native" : "bytecode");
+
+				if (fcycles > 0)
+				{
+					// Blocks are copied in control flow order, list them by address
+
+					GrowingArray<int>	offsets(0);
+					for (int j = 0; j < lobj->mBlockOffsets.Size(); j++)
+					{
+						int	offset = lobj->mBlockOffsets[j];
+						int	k = offsets.Size();
+						offsets.Push(offset);
+						while (k > 0 && offsets[k - 1] > offset)
+						{
+							offsets[k] = offsets[k - 1];
+							k--;
+						}
+						offsets[k] = offset;
+					}
+
+					for (int j = 0; j < offsets.Size(); j++)
+					{
+						int	start = offsets[j], end = j + 1 < offsets.Size() ? offsets[j + 1] : lobj->mSize;
+
+						int64	bcycles = 0;
+						for (int k = start; k < end; k++)
+							bcycles += cycles[lobj->mAddress + k];
+
+						if (bcycles > 0)
+							fprintf(file, "block %d %d %lld\n", start, end - start, (long long)bcycles);
+					}
+				}
+			}
+		}
+
+		fclose(file);
+
+		return true;
+	}
+	else
+		return false;
+}
+
+// Source location of the first statement of the block containing the offset,
+// blocks added by the optimizer belong to the block before them
+
+static const Location& SourceLocation(LinkerObject* lobj, int offset)
+{
+	int	best = -1;
+	for (int i = 0; i < lobj->mBlockLocations.Size(); i++)
+	{
+		int	boffset = lobj->mBlockOffsets[i];
+		if (lobj->mBlockLocations[i].mFileName && boffset <= offset && (best < 0 || boffset > lobj->mBlockOffsets[best]))
+			best = i;
+	}
+
+	if (best >= 0)
+		return lobj->mBlockLocations[best];
+	else
+		return lobj->mLocation;
+}
+
+static const char* SourceFile(const Location& loc)
+{
+	return loc.mFileName ? loc.mFileName : "???";
+}
+
+static void WriteFunctionName(FILE* file, const char* tag, LinkerObject* lobj, int addr)
+{
+	if (lobj && lobj->mIdent)
+		fprintf(file, "%s=%s\n", tag, lobj->mIdent->mString);
+	else
+		fprintf(file, "%s=0x%04x\n", tag, addr);
+}
+
+bool Profile::WriteCallgrind(const char* filename, Linker* linker, const Emulator* emu)
+{
+	FILE* file;
+	fopen_s(&file, filename, "w");
+	if (file)
+	{
+		int64	total = 0;
+		for (int i = 0; i < 0x10000; i++)
+			total += emu->mProfileCycles[i];
+
+		fprintf(file, "# callgrind format\n");
+		fprintf(file, "version: 1\n");
+		fprintf(file, "creator: oscar64\n");
+		fprintf(file, "positions: instr line\n");
+		fprintf(file, "events: Cycles\n");
+		fprintf(file, "summary: %lld\n", (long long)total);
+
+		for (int i = 0; i < linker->mObjects.Size(); i++)
+		{
+			LinkerObject* lobj = linker->mObjects[i];
+			if ((lobj->mFlags & LOBJF_PLACED) && lobj->mSize > 0 && (lobj->mType == LOT_NATIVE_CODE || lobj->mType == LOT_BYTE_CODE || lobj->mType == LOT_RUNTIME))
+			{
+				int	start = lobj->mAddress, end = lobj->mAddress + lobj->mSize;
+				if (end > 0x10000)
+					end = 0x10000;
+
+				bool	used = false;
+				for (int addr = start; addr < end && !used; addr++)
+					used = emu->mProfileCycles[addr] > 0 || emu->mCallSites[addr] >= 0;
+
+				if (used)
+				{
+					const char* fname = SourceFile(lobj->mLocation), * cname = fname;
+
+					fprintf(file, "\nfl=%s\n", fname);
+					WriteFunctionName(file, "fn", lobj, start);
+
+					for (int addr = start; addr < end; addr++)
+					{
+						int	cycles = emu->mProfileCycles[addr], call = emu->mCallSites[addr];
+						if (cycles > 0 || call >= 0)
+						{
+							const Location& loc(SourceLocation(lobj, addr - start));
+
+							// Inlined code comes from a different file
+
+							if (strcmp(SourceFile(loc), cname))
+							{
+								cname = SourceFile(loc);
+								fprintf(file, "%s=%s\n", strcmp(cname, fname) ? "fi" : "fe", cname);
+							}
+
+							if (cycles > 0)
+								fprintf(file, "0x%04x %d %d\n", addr, loc.mLine, cycles);
+
+							while (call >= 0)
+							{
+								const EmulatorCall& ec(emu->mCalls[call]);
+
+								LinkerObject* cobj = linker->FindObjectByAddr(ec.mTarget);
+								int	cline = cobj ? SourceLocation(cobj, ec.mTarget - cobj->mAddress).mLine : 0;
+
+								fprintf(file, "cfl=%s\n", SourceFile(cobj ? cobj->mLocation : Location()));
+								WriteFunctionName(file, "cfn", cobj, ec.mTarget);
+								fprintf(file, "calls=%lld 0x%04x %d\n", (long long)ec.mCount, ec.mTarget, cline);
+								fprintf(file, "0x%04x %d %lld\n", addr, loc.mLine, (long long)ec.mCycles);
+
+								call = ec.mNext;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		fclose(file);
+
+		return true;
+	}
+	else
+		return false;
+}
+
+bool Profile::Read(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "r");
+	if (file)
+	{
+		char		line[512], name[256];
+		long long	lcycles;
+
+		mTotalCycles = 0;
+		mFunctions.SetSize(0);
+
+		while (fgets(line, sizeof(line), file))
+		{
+			if (sscanf(line, "function %255s %lld", name, &lcycles) == 2)
+			{
+				// Static functions of different units may share a name
+
+				const Ident* ident = Ident::Unique(name);
+
+				int i = 0;
+				while (i < mFunctions.Size() && mFunctions[i].mIdent != ident)
+					i++;
+
+				if (i < mFunctions.Size())
+					mFunctions[i].mCycles += lcycles;
+				else
+				{
+					ProfileFunction	pf;
+					pf.mIdent = ident;
+					pf.mCycles = lcycles;
+					mFunctions.Push(pf);
+				}
+			}
+			else if (sscanf(line, "total %lld", &lcycles) == 1)
+				mTotalCycles = lcycles;
+		}
+
+		fclose(file);
+
+		return true;
+	}
+	else
+		return false;
+}
+
+bool Profile::Lookup(const Ident* ident, int64& cycles)
+{
+	for (int i = 0; i < mFunctions.Size(); i++)
+	{
+		if (mFunctions[i].mIdent == ident)
+		{
+			cycles = mFunctions[i].mCycles;
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Errors.h"
+#include "Linker.h"
+
+class Emulator;
+
+// Cycle profile of a program run in the emulator.  It is written at the end
+// of an emulation and read back by a later compile of the same program to
+// choose between native and byte code and to guide the inlining.  The call
+// graph of the run can be written in the callgrind format for the usual
+// viewers, with costs per code address and source line.
+
+struct ProfileFunction
+{
+	const Ident	*	mIdent;
+	int64			mCycles;
+};
+
+class Profile
+{
+public:
+	Profile(Errors* errors);
+	~Profile(void);
+
+	int64		mTotalCycles;
+
+	bool Write(const char* filename, Linker* linker, const int* cycles);
+	bool WriteCallgrind(const char* filename, Linker* linker, const Emulator* emu);
+	bool Read(const char* filename);
+
+	bool Lookup(const Ident* ident, int64& cycles);
+
+protected:
+	Errors* mErrors;
+
+	GrowingArray<ProfileFunction>	mFunctions;
+};
@@ -1,4 +1,5 @@
 #include "Scanner.h"
+#include "Prelude.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -146,7 +147,7 @@ Macro::Macro(const Ident* ident)
 
 Macro::~Macro(void)
 {
-
+	delete[] mString;
 }
 
 void Macro::SetString(const char* str)
@@ -172,6 +173,7 @@ void Macro::SetString(const char* str, int length)
 
 	nstr[length] = ' ';
 	nstr[length + 1] = 0;
+	delete[] mString;
 	mString = nstr;
 }
 
@@ -190,6 +192,8 @@ MacroDict::MacroDict(void)
 
 MacroDict::~MacroDict(void)
 {
+	for (int i = 0; i < mHashSize; i++)
+		delete mHash[i];
 	delete[] mHash;
 }
 
@@ -211,6 +215,7 @@ void MacroDict::Insert(Macro * macro)
 	{
 		if (macro->mIdent == mHash[hi]->mIdent)
 		{
+			delete mHash[hi];
 			mHash[hi] = macro;
 			return;
 		}
@@ -260,8 +265,8 @@ Macro* MacroDict::Lookup(const Ident* ident)
 
 
 
-Scanner::Scanner(Errors* errors, Preprocessor* preprocessor)
-	: mErrors(errors), mPreprocessor(preprocessor)
+Scanner::Scanner(Errors* errors, Preprocessor* preprocessor, PreludeUnit* replay)
+	: mErrors(errors), mPreprocessor(preprocessor), mRecord(nullptr), mReplay(replay)
 {
 	mOffset = 0;
 	mLine = mPreprocessor->mLine;
@@ -275,8 +280,19 @@ Scanner::Scanner(Errors* errors, Preprocessor* preprocessor)
 	mDefines = new MacroDict();
 	mDefineArguments = nullptr;
 
-	NextChar();
-	NextToken();
+	mToken = TK_NONE;
+	mTokenIdent = nullptr;
+	mTokenString[0] = 0;
+	mTokenInteger = 0;
+	mTokenNumber = 0;
+
+	if (mReplay)
+		mReplay->Replay(this);
+	else
+	{
+		NextChar();
+		ScanToken();
+	}
 
 	assert(sizeof(TokenNames) == NUM_TOKENS * sizeof(char*));
 }
@@ -364,6 +380,18 @@ void Scanner::AddMacro(const Ident* ident, const char* value)
 }
 
 void Scanner::NextToken(void)
+{
+	if (mReplay)
+		mReplay->Replay(this);
+	else
+	{
+		ScanToken();
+		if (mRecord)
+			mRecord->Record(this);
+	}
+}
+
+void Scanner::ScanToken(void)
 {
 	for (;;)
 	{
@@ -411,7 +439,7 @@ void Scanner::NextToken(void)
 				mPreprocessorMode = true;
 				mPrepCondFalse = 0;
 
-				NextToken();
+				ScanToken();
 				int v = PrepParseConditional();
 				if (v)
 				{
@@ -440,6 +468,7 @@ void Scanner::NextToken(void)
 			if (!mPreprocessor->CloseSource())
 				return;
 			mToken = TK_NONE;
+			mLine = mPreprocessor->mLine;
 			mOffset = 0;
 		}
 		else if (mPrepCondFalse > 0 || mPrepCondExit)
@@ -538,7 +567,7 @@ void Scanner::NextToken(void)
 		else if (mToken == TK_PREP_IF)
 		{
 			mPreprocessorMode = true;
-			NextToken();
+			ScanToken();
 			int v = PrepParseConditional();
 			if (v)
 				mPrepCondDepth++;
@@ -556,7 +585,7 @@ void Scanner::NextToken(void)
 			{
 				const Ident* ident = mTokenIdent;
 
-				NextToken();
+				ScanToken();
 
 				int v = PrepParseConditional();
 				Macro* macro = mDefines->Lookup(ident);
@@ -580,7 +609,7 @@ void Scanner::NextToken(void)
 		else if (mToken == TK_PREP_UNTIL)
 		{
 			mPreprocessorMode = true;
-			NextToken();
+			ScanToken();
 			int v = PrepParseConditional();
 			if (mToken != TK_EOL)
 				mErrors->Error(mLocation, ERRR_PREPROCESSOR, "End of line expected");
@@ -592,6 +621,7 @@ void Scanner::NextToken(void)
 				mPreprocessor->PopSource();
 				mPreprocessor->PushSource();
 				mPreprocessor->NextLine();
+				mLine = mPreprocessor->mLine;
 				mOffset = 0;
 			}
 			mPreprocessorMode = false;
@@ -816,14 +846,14 @@ void Scanner::NextRawToken(void)
 					}
 				}
 				NextChar();
-				NextToken();
+				ScanToken();
 			}
 			else if (mTokenChar == '/')
 			{
 				NextChar();
 				while (!IsLineBreak(mTokenChar) && NextChar())
 					;
-				NextToken();
+				ScanToken();
 			}
 			else if (mTokenChar == '=')
 			{
@@ -1392,6 +1422,7 @@ bool Scanner::NextChar(void)
 		}
 		else if (mPreprocessor->NextLine())
 		{
+			mLine = mPreprocessor->mLine;
 			mOffset = 0;
 			mStartOfLine = true;
 		}
@@ -1600,32 +1631,32 @@ int64 Scanner::PrepParseSimple(void)
 	case TK_INTEGERL:
 	case TK_INTEGERUL:
 		v = mTokenInteger;
-		NextToken();
+		ScanToken();
 		break;
 	case TK_SUB:
-		NextToken();
+		ScanToken();
 		v = -PrepParseSimple();
 		break;
 	case TK_LOGICAL_NOT:
-		NextToken();
+		ScanToken();
 		v = !PrepParseSimple();
 		break;
 	case TK_BINARY_NOT:
-		NextToken();
+		ScanToken();
 		v = ~PrepParseSimple();
 		break;
 	case TK_OPEN_PARENTHESIS:
-		NextToken();
+		ScanToken();
 		v = PrepParseConditional();
 		if (mToken == TK_CLOSE_PARENTHESIS)
-			NextToken();
+			ScanToken();
 		else
 			mErrors->Error(mLocation, ERRR_PREPROCESSOR, "')' expected");
 		break;
 	case TK_IDENT:
 		if (strcmp(mTokenIdent->mString, "defined") == 0)
 		{
-			NextToken();
+			ScanToken();
 			if (mToken == TK_OPEN_PARENTHESIS)
 			{
 				NextRawToken();
@@ -1640,13 +1671,13 @@ int64 Scanner::PrepParseSimple(void)
 						v = 1;
 					else
 						v = 0;
-					NextToken();
+					ScanToken();
 				}
 				else
 					mErrors->Error(mLocation, ERRR_PREPROCESSOR, "Identifier expected");
 
 				if (mToken == TK_CLOSE_PARENTHESIS)
-					NextToken();
+					ScanToken();
 				else
 					mErrors->Error(mLocation, ERRR_PREPROCESSOR, "')' expected");
 			}
@@ -1659,7 +1690,7 @@ int64 Scanner::PrepParseSimple(void)
 	default:
 		mErrors->Error(mLocation, ERRR_PREPROCESSOR, "Invalid preprocessor token", TokenName(mToken));
 		if (mToken != TK_EOL)
-			NextToken();
+			ScanToken();
 	}
 	
 	return v;
@@ -1674,11 +1705,11 @@ int64 Scanner::PrepParseMul(void)
 		switch (mToken)
 		{
 		case TK_MUL:
-			NextToken();
+			ScanToken();
 			v *= PrepParseSimple();
 			break;
 		case TK_DIV:
-			NextToken();
+			ScanToken();
 			u = PrepParseSimple();
 			if (u == 0)
 				mErrors->Error(mLocation, ERRR_PREPROCESSOR, "Division by zero");
@@ -1706,11 +1737,11 @@ int64 Scanner::PrepParseAdd(void)
 		switch (mToken)
 		{
 		case TK_ADD:
-			NextToken();
+			ScanToken();
 			v += PrepParseMul();
 			break;
 		case TK_SUB:
-			NextToken();
+			ScanToken();
 			v -= PrepParseMul();
 			break;
 		default:
@@ -1727,11 +1758,11 @@ int64 Scanner::PrepParseShift(void)
 		switch (mToken)
 		{
 		case TK_LEFT_SHIFT:
-			NextToken();
+			ScanToken();
 			v <<= PrepParseAdd();
 			break;
 		case TK_RIGHT_SHIFT:
-			NextToken();
+			ScanToken();
 			v >>= PrepParseAdd();
 			break;
 		default:
@@ -1748,27 +1779,27 @@ int64 Scanner::PrepParseRel(void)
 		switch (mToken)
 		{
 		case TK_LESS_THAN:
-			NextToken();
+			ScanToken();
 			v = v < PrepParseShift();
 			break;
 		case TK_GREATER_THAN:
-			NextToken();
+			ScanToken();
 			v = v > PrepParseShift();
 			break;
 		case TK_LESS_EQUAL:
-			NextToken();
+			ScanToken();
 			v = v <= PrepParseShift();
 			break;
 		case TK_GREATER_EQUAL:
-			NextToken();
+			ScanToken();
 			v = v >= PrepParseShift();
 			break;
 		case TK_EQUAL:
-			NextToken();
+			ScanToken();
 			v = v == PrepParseShift();
 			break;
 		case TK_NOT_EQUAL:
-			NextToken();
+			ScanToken();
 			v = v != PrepParseShift();
 			break;
 		default:
@@ -1783,7 +1814,7 @@ int64 Scanner::PrepParseBinaryAnd(void)
 	int64	v = PrepParseRel();
 	while (mToken == TK_BINARY_AND)
 	{
-		NextToken();
+		ScanToken();
 		v &= PrepParseRel();
 	}
 	return v;
@@ -1794,7 +1825,7 @@ int64 Scanner::PrepParseBinaryXor(void)
 	int64	v = PrepParseBinaryAnd();
 	while (mToken == TK_BINARY_XOR)
 	{
-		NextToken();
+		ScanToken();
 		v ^= PrepParseBinaryAnd();
 	}
 	return v;
@@ -1805,7 +1836,7 @@ int64 Scanner::PrepParseBinaryOr(void)
 	int64	v = PrepParseBinaryXor();
 	while (mToken == TK_BINARY_OR)
 	{
-		NextToken();
+		ScanToken();
 		v |= PrepParseBinaryXor();
 	}
 	return v;
@@ -1816,7 +1847,7 @@ int64 Scanner::PrepParseLogicalAnd(void)
 	int64	v = PrepParseBinaryOr();
 	while (mToken == TK_LOGICAL_AND)
 	{
-		NextToken();
+		ScanToken();
 		if (!PrepParseBinaryOr())
 			v = 0;
 	}
@@ -1828,7 +1859,7 @@ int64 Scanner::PrepParseLogicalOr(void)
 	int64	v = PrepParseLogicalAnd();
 	while (mToken == TK_LOGICAL_OR)
 	{
-		NextToken();
+		ScanToken();
 		if (PrepParseLogicalAnd())
 			v = 1;
 	}
@@ -1840,10 +1871,10 @@ int64 Scanner::PrepParseConditional(void)
 	int64	v = PrepParseLogicalOr();
 	if (mToken == TK_QUESTIONMARK)
 	{
-		NextToken();
+		ScanToken();
 		int64	vt = PrepParseConditional();
 		if (mToken == TK_COLON)
-			NextToken();
+			ScanToken();
 		else
 			mErrors->Error(mLocation, ERRR_PREPROCESSOR, "':' expected");
 		int64	vf = PrepParseConditional();
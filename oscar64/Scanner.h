@@ -171,10 +171,12 @@ protected:
 	int				mHashSize, mHashFill;
 };
 
+class PreludeUnit;
+
 class Scanner
 {
 public:
-	Scanner(Errors * errors, Preprocessor * preprocessor);
+	Scanner(Errors * errors, Preprocessor * preprocessor, PreludeUnit * replay = nullptr);
 	~Scanner(void);
 
 	const char* TokenName(Token token) const;
@@ -186,6 +188,7 @@ public:
 
 	Errors* mErrors;
 	Preprocessor	*	mPreprocessor;
+	PreludeUnit		*	mRecord, * mReplay;
 
 	int				mPrepCondFalse, mPrepCondDepth;
 	bool			mPrepCondExit;
@@ -213,6 +216,7 @@ public:
 
 	void AddMacro(const Ident* ident, const char* value);
 protected:
+	void ScanToken(void);
 	void NextRawToken(void);
 
 	struct MacroExpansion
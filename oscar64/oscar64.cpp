@@ -56,6 +56,271 @@ bool GetProductAndVersion(char* strProductName, char* strProductVersion)
 }
 #endif
 
+static const char Usage[] = "oscar64 {-i=includePath} [-o=output.prg] [-rt=runtime.c] [-e] [-n] [-j=threads] [-profile=file] [-callgrind=file] [-pgo=file] [-prelude=file] [-code-cache=file] [-lazy-parse] [-time-passes[=file]] [-disable-pass=names] [-pass-bisect=n] [-dSYMBOL[=value]] {source.c}\n       oscar64 -server\n";
+
+static int Compile(int argc, const char** argv, const char* basePath, const char* strProductVersion, Prelude*& prelude, bool server)
+{
+	char	crtPath[200], includePath[200], targetPath[200];
+	const char	*	preludePath = nullptr, * codeCachePath = nullptr;
+
+	// Declarations and expressions of the compile, released after the compiler
+
+	MemoryArena			arena;
+	MemoryArena::Scope	arenaScope(&arena);
+
+	Compiler* compiler = new Compiler();
+	compiler->mErrors->mExitOnLimit = !server;
+
+	Location	loc;
+
+	compiler->mPreprocessor->AddPath(basePath);
+	strcpy_s(includePath, basePath);
+	strcat_s(includePath, "include/");
+	compiler->mPreprocessor->AddPath(includePath);
+	strcpy_s(crtPath, includePath);
+	strcat_s(crtPath, "crt.c");
+
+	bool		emulate = false;
+
+	targetPath[0] = 0;
+
+	char	targetFormat[20];
+	strcpy_s(targetFormat, "prg");
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (arg[0] == '-')
+		{
+			if (arg[1] == 'i' && arg[2] == '=')
+			{
+				compiler->mPreprocessor->AddPath(arg + 3);
+			}
+			else if (arg[1] == 'o' && arg[2] == '=')
+			{
+				strcpy_s(targetPath, arg + 3);
+			}
+			else if (arg[1] == 'r' && arg[2] == 't' && arg[3] == '=')
+			{
+				strcpy_s(crtPath, arg + 4);
+			}
+			else if (arg[1] == 't' && arg[2] == 'f' && arg[3] == '=')
+			{
+				strcpy_s(targetFormat, arg + 4);
+			}
+			else if (arg[1] == 'j' && arg[2] == '=')
+			{
+				compiler->mThreadCount = atoi(arg + 3);
+				if (compiler->mThreadCount < 1)
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid number of threads", arg);
+			}
+			else if (!strncmp(arg, "-profile=", 9))
+			{
+				compiler->mProfilePath = arg + 9;
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-callgrind=", 11))
+			{
+				compiler->mCallgrindPath = arg + 11;
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-pgo=", 5))
+			{
+				compiler->mProfile = new Profile(compiler->mErrors);
+				if (!compiler->mProfile->Read(arg + 5))
+					compiler->mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not open profile file", arg + 5);
+			}
+			else if (!strncmp(arg, "-prelude=", 9))
+			{
+				preludePath = arg + 9;
+			}
+			else if (!strncmp(arg, "-code-cache=", 12))
+			{
+				codeCachePath = arg + 12;
+			}
+			else if (!strcmp(arg, "-lazy-parse"))
+			{
+				compiler->mLazyParse = true;
+			}
+			else if (!strcmp(arg, "-time-passes"))
+			{
+				compiler->mPassManager->mStatistics = true;
+			}
+			else if (!strncmp(arg, "-time-passes=", 13))
+			{
+				compiler->mPassManager->mStatistics = true;
+				compiler->mPassReportPath = arg + 13;
+			}
+			else if (!strncmp(arg, "-disable-pass=", 14))
+			{
+				if (!compiler->mPassManager->Disable(arg + 14))
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid optimizer pass", arg + 14);
+			}
+			else if (!strncmp(arg, "-pass-bisect=", 13))
+			{
+				compiler->mPassManager->mBisectLimit = atoi(arg + 13);
+				if (compiler->mPassManager->mBisectLimit < 0)
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid pass bisect limit", arg);
+			}
+			else if (arg[1] == 'n')
+			{
+				compiler->mCompilerOptions |= COPT_NATIVE;
+				compiler->AddDefine(Ident::Unique("OSCAR_NATIVE_ALL"), "1");
+			}
+			else if (arg[1] == 'O')
+			{
+				if (arg[2] == '0')
+					compiler->mCompilerOptions &= ~(COPT_OPTIMIZE_ALL);
+				else if (arg[2] == '1' || arg[2] == 0)
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_DEFAULT;
+				else if (arg[2] == '2')
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_SPEED;
+				else if (arg[2] == '3')
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_ALL;
+				else if (arg[2] == 's')
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_SIZE;
+				else
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+			}
+			else if (arg[1] == 'e')
+			{
+				emulate = true;
+			}
+			else if (arg[1] == 'd')
+			{
+				char	def[100];
+				int i = 2;
+				while (arg[i] && arg[i] != '=')
+				{
+					def[i - 2] = arg[i];
+					i++;
+				}
+				def[i - 2] = 0;
+				if (arg[i] == '=')
+					compiler->AddDefine(Ident::Unique(def), arg + i + 1);
+				else
+					compiler->AddDefine(Ident::Unique(def), "");
+			}
+			else
+				compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+		}
+		else
+		{
+			if (!targetPath[0])
+				strcpy_s(targetPath, argv[i]);
+			compiler->mCompilationUnits->AddUnit(loc, argv[i], nullptr, false);
+		}
+	}
+
+	// Bisecting needs a deterministic order of the pass runs
+
+	if (compiler->mPassManager->mBisectLimit >= 0)
+		compiler->mThreadCount = 1;
+
+	if (!strcmp(targetFormat, "prg"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_PRG;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_PRG"), "1");
+	}
+	else if (!strcmp(targetFormat, "crt"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_CRT16;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT16"), "1");
+	}
+	else
+		compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target format option", targetFormat);
+
+	if (compiler->mErrors->mErrorCount == 0)
+	{
+		if (preludePath || server)
+		{
+			compiler->LoadPrelude(preludePath, strProductVersion, prelude);
+			if (compiler->mPrelude != prelude)
+			{
+				delete prelude;
+				prelude = compiler->mPrelude;
+			}
+		}
+		if (codeCachePath)
+			compiler->LoadCodeCache(codeCachePath, strProductVersion);
+
+		// Add runtime module
+
+		compiler->mCompilationUnits->AddUnit(loc, crtPath, nullptr, true);
+
+		if (compiler->ParseSource() && compiler->GenerateCode())
+		{
+			compiler->WriteOutputFile(targetPath);
+
+			if (emulate)
+				compiler->ExecuteCode();
+		}
+	}
+
+	int	result = compiler->mErrors->mErrorCount != 0 ? 20 : 0;
+
+	delete compiler;
+
+	return result;
+}
+
+// Read compile requests from stdin, one command line per line, and answer
+// each with the compiler output and a line "@done <result>".  The interned
+// identifiers, the declarations of the builtin types and the token streams
+// of the runtime and library units are kept between the requests.
+
+static int Serve(const char* basePath, const char* strProductVersion)
+{
+	Prelude* prelude = nullptr;
+
+	static char	line[32768];
+	const char* argv[256];
+
+	while (fgets(line, sizeof(line), stdin))
+	{
+		int		argc = 0;
+		argv[argc++] = "oscar64";
+
+		char* cp = line;
+		for (;;)
+		{
+			while (*cp == ' ' || *cp == '\t' || *cp == '\r' || *cp == '\n')
+				cp++;
+			if (!*cp || argc == 255)
+				break;
+
+			char* dp = cp;
+			argv[argc++] = dp;
+
+			bool	quoted = false;
+			while (*cp && (quoted || !(*cp == ' ' || *cp == '\t' || *cp == '\r' || *cp == '\n')))
+			{
+				if (*cp == '"')
+					quoted = !quoted;
+				else
+					*dp++ = *cp;
+				cp++;
+			}
+			if (*cp)
+				cp++;
+			*dp = 0;
+		}
+
+		if (argc > 1)
+		{
+			ResetRegisters();
+
+			int	result = Compile(argc, argv, basePath, strProductVersion, prelude, true);
+			printf("@done %d\n", result);
+			fflush(stdout);
+		}
+	}
+
+	delete prelude;
+
+	return 0;
+}
+
 int main(int argc, const char** argv)
 {
 	InitDeclarations();
@@ -63,7 +328,7 @@ int main(int argc, const char** argv)
 
 	if (argc > 1)
 	{
-		char	basePath[200], crtPath[200], includePath[200], targetPath[200];
+		char	basePath[200];
 		char	strProductName[100], strProductVersion[200];
 
 #ifdef _WIN32
@@ -71,11 +336,15 @@ int main(int argc, const char** argv)
 		{
 			printf("Starting %s %s\n", strProductName, strProductVersion);
 		}
+		else
+			strProductVersion[0] = 0;
 
 		DWORD length = ::GetModuleFileNameA(NULL, basePath, sizeof(basePath));
 
 #else
-		printf("Starting oscar64 1.1.47\n");
+		strcpy_s(strProductName, "oscar64");
+		strcpy_s(strProductVersion, "1.1.47");
+		printf("Starting %s %s\n", strProductName, strProductVersion);
 
 #ifdef __APPLE__
 		uint32_t length = sizeof(basePath);
@@ -101,131 +370,16 @@ int main(int argc, const char** argv)
 
 		basePath[length] = 0;
 
-		Compiler* compiler = new Compiler();
-
-		Location	loc;
-
-		compiler->mPreprocessor->AddPath(basePath);
-		strcpy_s(includePath, basePath);
-		strcat_s(includePath, "include/");
-		compiler->mPreprocessor->AddPath(includePath);
-		strcpy_s(crtPath, includePath);
-		strcat_s(crtPath, "crt.c");
-
-		bool		emulate = false;
-
-		targetPath[0] = 0;
-
-		char	targetFormat[20];
-		strcpy_s(targetFormat, "prg");
-
-		for (int i = 1; i < argc; i++)
-		{
-			const char* arg = argv[i];
-			if (arg[0] == '-')
-			{
-				if (arg[1] == 'i' && arg[2] == '=')
-				{
-					compiler->mPreprocessor->AddPath(arg + 3);
-				}
-				else if (arg[1] == 'o' && arg[2] == '=')
-				{
-					strcpy_s(targetPath, arg + 3);
-				}
-				else if (arg[1] == 'r' && arg[2] == 't' && arg[3] == '=')
-				{
-					strcpy_s(crtPath, arg + 4);
-				}
-				else if (arg[1] == 't' && arg[2] == 'f' && arg[3] == '=')
-				{
-					strcpy_s(targetFormat, arg + 4);
-				}
-				else if (arg[1] == 'n')
-				{
-					compiler->mCompilerOptions |= COPT_NATIVE;
-					compiler->AddDefine(Ident::Unique("OSCAR_NATIVE_ALL"), "1");
-				}
-				else if (arg[1] == 'O')
-				{
-					if (arg[2] == '0')
-						compiler->mCompilerOptions &= ~(COPT_OPTIMIZE_ALL);
-					else if (arg[1] == '1' || arg[1] == 0)
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_DEFAULT;
-					else if (arg[2] == '2')
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_SPEED;
-					else if (arg[2] == '3')
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_ALL;
-					else if (arg[2] == 's')
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_SIZE;
-				}
-				else if (arg[1] == 'e')
-				{
-					emulate = true;
-				}
-				else if (arg[1] == 'd')
-				{
-					char	def[100];
-					int i = 2;
-					while (arg[i] && arg[i] != '=')
-					{
-						def[i - 2] = arg[i];
-						i++;
-					}
-					def[i - 2] = 0;
-					if (arg[i] == '=')
-						compiler->AddDefine(Ident::Unique(def), _strdup(arg + i + 1));
-					else
-						compiler->AddDefine(Ident::Unique(def), "");
-				}
-				else
-					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
-			}
-			else
-			{
-				if (!targetPath[0])
-					strcpy_s(targetPath, argv[i]);
-				compiler->mCompilationUnits->AddUnit(loc, argv[i], nullptr);
-			}
-		}
-
-		if (!strcmp(targetFormat, "prg"))
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_PRG;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_PRG"), "1");
-		}
-		else if (!strcmp(targetFormat, "crt"))
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_CRT16;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT16"), "1");
-		}
-		else
-			compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target format option", targetFormat);
-
-		if (compiler->mErrors->mErrorCount == 0)
-		{
-			// Add runtime module
-
-			compiler->mCompilationUnits->AddUnit(loc, crtPath, nullptr);
-
-			if (compiler->ParseSource() && compiler->GenerateCode())
-			{
-				compiler->WriteOutputFile(targetPath);
-
-				if (emulate)
-					compiler->ExecuteCode();
-			}
-		}
+		if (argc == 2 && !strcmp(argv[1], "-server"))
+			return Serve(basePath, strProductVersion);
 
-		if (compiler->mErrors->mErrorCount != 0)
-			return 20;
+		Prelude* prelude = nullptr;
+		return Compile(argc, argv, basePath, strProductVersion, prelude, false);
 	}
 	else
 	{
-		printf("oscar64 {-i=includePath} [-o=output.prg] [-rt=runtime.c] [-e] [-n] [-dSYMBOL[=value]] {source.c}\n");
+		printf("%s", Usage);
 
 		return 0;
 	}
-
-	return 0;
 }
-